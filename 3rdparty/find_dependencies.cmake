@@ -996,6 +996,13 @@ if(BUILD_RPC_INTERFACE)
     if( DEFINED ZEROMQ_ADDITIONAL_LIBS )
         list(APPEND Open3D_3RDPARTY_PRIVATE_TARGETS ${ZEROMQ_ADDITIONAL_LIBS})
     endif()
+    # shm_open of the shared memory transport
+    if(UNIX AND NOT APPLE)
+        find_library(RT_LIBRARY rt)
+        if(RT_LIBRARY)
+            target_link_libraries(3rdparty_zeromq INTERFACE ${RT_LIBRARY})
+        endif()
+    endif()
 
     # msgpack
     include(${Open3D_3RDPARTY_DIR}/msgpack/msgpack_build.cmake)
@@ -1085,6 +1092,19 @@ else()
     list(APPEND Open3D_3RDPARTY_PRIVATE_TARGETS "${MKL_TARGET}")
 endif()
 
+# zstd
+if(WITH_ZSTD)
+    pkg_config_3rdparty_library(3rdparty_zstd libzstd>=1.4.0)
+    if(3rdparty_zstd_FOUND)
+        set(ZSTD_TARGET "3rdparty_zstd")
+        set(USE_SYSTEM_ZSTD ON)
+        list(APPEND Open3D_3RDPARTY_PRIVATE_TARGETS "${ZSTD_TARGET}")
+    else()
+        message(STATUS "zstd files are not supported without libzstd")
+        set(WITH_ZSTD OFF)
+    endif()
+endif()
+
 # Faiss
 if (WITH_FAISS AND WIN32)
     message(STATUS "Faiss is not supported on Windows")
@@ -387,7 +387,10 @@ private:
      */
     NodePtr divideTree(int left, int right, BoundingBox& bbox)
     {
-        NodePtr node = new (pool_) Node(); // allocate memory
+        NodePtr node;
+        // Open3D: subtrees may be built by concurrent tasks, see below.
+#pragma omp critical(flann_kdtree_single_index_pool)
+        node = new (pool_) Node(); // allocate memory
 
         /* If too few exemplars remain, then make this a leaf node. */
         if ( (right-left) <= leaf_max_size_) {
@@ -417,11 +420,21 @@ private:
 
             BoundingBox left_bbox(bbox);
             left_bbox[cutfeat].high = cutval;
-            node->child1 = divideTree(left, left+idx, left_bbox);
-
             BoundingBox right_bbox(bbox);
             right_bbox[cutfeat].low = cutval;
+
+            // Open3D: the two halves are disjoint ranges of vind_, so large
+            // ones are built as tasks when buildIndex() is called from an
+            // OpenMP parallel region. Outside of one, tasks run immediately.
+#if defined(_OPENMP) && _OPENMP >= 200805
+#pragma omp task shared(left_bbox) if (idx > 4096)
+            node->child1 = divideTree(left, left+idx, left_bbox);
+            node->child2 = divideTree(left+idx, right, right_bbox);
+#pragma omp taskwait
+#else
+            node->child1 = divideTree(left, left+idx, left_bbox);
             node->child2 = divideTree(left+idx, right, right_bbox);
+#endif
 
             node->divlow = left_bbox[cutfeat].high;
             node->divhigh = right_bbox[cutfeat].low;
@@ -0,0 +1,413 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/hashmap/Hashmap.h"
+
+#include <benchmark/benchmark.h>
+
+#include <numeric>
+#include <random>
+
+#include "open3d/core/Device.h"
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/ParallelUtil.h"
+
+namespace open3d {
+namespace core {
+
+/// Keys with duplicates: \p n keys drawn from \p slots distinct values.
+static Tensor HashmapBenchmarkKeys(int64_t n,
+                                   int64_t slots,
+                                   const Device& device) {
+    std::vector<int> keys(n);
+    std::iota(keys.begin(), keys.end(), 0);
+    std::shuffle(keys.begin(), keys.end(), std::default_random_engine(0));
+    for (auto& key : keys) {
+        key = (key % slots) * 100;
+    }
+    return Tensor(keys, {n}, Dtype::Int32, device);
+}
+
+/// Thread count of the OpenMP parallel loops, restored on destruction.
+class ScopedNumThreads {
+public:
+    ScopedNumThreads(int num_threads)
+        : prev_num_threads_(kernel::GetMaxThreads()) {
+#ifdef _OPENMP
+        omp_set_num_threads(num_threads);
+#endif
+    }
+    ~ScopedNumThreads() {
+#ifdef _OPENMP
+        omp_set_num_threads(prev_num_threads_);
+#endif
+    }
+
+private:
+    int prev_num_threads_;
+};
+
+void HashmapBackendInsert(benchmark::State& state,
+                          const Device& device,
+                          const HashmapBackend& backend) {
+    ScopedNumThreads num_threads(static_cast<int>(state.range(0)));
+    const int64_t n = 1000000;
+    const int64_t slots = n / 2;
+    Tensor keys = HashmapBenchmarkKeys(n, slots, device);
+    Tensor values = Tensor::Ones({n}, Dtype::Int32, device);
+
+    Tensor addrs, masks;
+    for (auto _ : state) {
+        state.PauseTiming();
+        Hashmap hashmap(slots, Dtype::Int32, Dtype::Int32, {1}, {1}, device,
+                        backend);
+        state.ResumeTiming();
+
+        hashmap.Insert(keys, values, addrs, masks);
+    }
+}
+
+void HashmapBackendFind(benchmark::State& state,
+                        const Device& device,
+                        const HashmapBackend& backend) {
+    ScopedNumThreads num_threads(static_cast<int>(state.range(0)));
+    const int64_t n = 1000000;
+    const int64_t slots = n / 2;
+    Tensor keys = HashmapBenchmarkKeys(n, slots, device);
+    Tensor values = Tensor::Ones({n}, Dtype::Int32, device);
+
+    Hashmap hashmap(slots, Dtype::Int32, Dtype::Int32, {1}, {1}, device,
+                    backend);
+    Tensor addrs, masks;
+    hashmap.Insert(keys, values, addrs, masks);
+    for (auto _ : state) {
+        hashmap.Find(keys, addrs, masks);
+    }
+}
+
+// The argument is the number of CPU threads.
+BENCHMARK_CAPTURE(HashmapBackendInsert,
+                  CPU_Default,
+                  Device("CPU:0"),
+                  HashmapBackend::Default)
+        ->RangeMultiplier(4)
+        ->Range(1, 64)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(HashmapBackendInsert,
+                  CPU_LinearProbing,
+                  Device("CPU:0"),
+                  HashmapBackend::LinearProbing)
+        ->RangeMultiplier(4)
+        ->Range(1, 64)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(HashmapBackendFind,
+                  CPU_Default,
+                  Device("CPU:0"),
+                  HashmapBackend::Default)
+        ->RangeMultiplier(4)
+        ->Range(1, 64)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(HashmapBackendFind,
+                  CPU_LinearProbing,
+                  Device("CPU:0"),
+                  HashmapBackend::LinearProbing)
+        ->RangeMultiplier(4)
+        ->Range(1, 64)
+        ->Unit(benchmark::kMillisecond);
+
+#ifdef BUILD_CUDA_MODULE
+BENCHMARK_CAPTURE(HashmapBackendInsert,
+                  CUDA,
+                  Device("CUDA:0"),
+                  HashmapBackend::Default)
+        ->Arg(1)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(HashmapBackendFind,
+                  CUDA,
+                  Device("CUDA:0"),
+                  HashmapBackend::Default)
+        ->Arg(1)
+        ->Unit(benchmark::kMillisecond);
+#endif
+
+// The suite below sweeps the parameters per operation. Number of keys is
+// fixed, load factor is the number of keys per bucket, value size is in Int32
+// elements and hit ratio is the percentage of queries found in the hashmap.
+static constexpr int64_t kSuiteNumKeys = 1 << 18;
+
+/// Key indices of \p n queries, the first \p hit_percent% of which refer to
+/// keys [0, n) stored by the suite, the others to keys [n, 2n) never stored.
+static std::vector<int64_t> HashmapQueryIndices(int64_t n,
+                                                int64_t hit_percent) {
+    const int64_t hits = n * hit_percent / 100;
+    std::vector<int64_t> indices(n);
+    std::iota(indices.begin(), indices.end(), 0);
+    for (int64_t i = hits; i < n; ++i) {
+        indices[i] += n;
+    }
+    std::shuffle(indices.begin(), indices.end(),
+                 std::default_random_engine(0));
+    return indices;
+}
+
+/// Coordinate-like keys of shape {N, dim}: each index is unrolled into a
+/// grid of 64^(dim-1) x (remainder), similar to TSDF block coordinates.
+static Tensor HashmapSuiteKeys(const std::vector<int64_t>& indices,
+                               const Dtype& dtype,
+                               int64_t dim,
+                               const Device& device) {
+    const int64_t n = static_cast<int64_t>(indices.size());
+    Tensor keys;
+    DISPATCH_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        std::vector<scalar_t> coords(n * dim);
+        for (int64_t i = 0; i < n; ++i) {
+            int64_t index = indices[i];
+            for (int64_t d = 0; d < dim - 1; ++d) {
+                coords[i * dim + d] = static_cast<scalar_t>(index % 64);
+                index /= 64;
+            }
+            coords[i * dim + dim - 1] = static_cast<scalar_t>(index);
+        }
+        keys = Tensor(coords, {n, dim}, dtype, device);
+    });
+    return keys;
+}
+
+/// Hashmap holding kSuiteNumKeys keys at \p load_factor once filled. The
+/// initial capacity sets the bucket count, Reserve then grows the buffer only.
+static Hashmap HashmapSuiteMap(const Dtype& dtype_key,
+                               int64_t dim_key,
+                               int64_t dim_value,
+                               int64_t load_factor,
+                               const Device& device) {
+    Hashmap hashmap(
+            kSuiteNumKeys * Hashmap::kDefaultElemsPerBucket / load_factor,
+            dtype_key, Dtype::Int32, {dim_key}, {dim_value}, device);
+    hashmap.SetMaxLoadFactor(static_cast<float>(load_factor));
+    hashmap.Reserve(kSuiteNumKeys);
+    return hashmap;
+}
+
+// Args: {value size, load factor}.
+void HashmapInsert(benchmark::State& state,
+                   const Device& device,
+                   const Dtype& dtype_key,
+                   int64_t dim_key) {
+    const int64_t dim_value = state.range(0);
+    const int64_t load_factor = state.range(1);
+    Tensor keys = HashmapSuiteKeys(HashmapQueryIndices(kSuiteNumKeys, 100),
+                                   dtype_key, dim_key, device);
+    Tensor values =
+            Tensor::Ones({kSuiteNumKeys, dim_value}, Dtype::Int32, device);
+
+    Tensor addrs, masks;
+    for (auto _ : state) {
+        state.PauseTiming();
+        Hashmap hashmap = HashmapSuiteMap(dtype_key, dim_key, dim_value,
+                                          load_factor, device);
+        state.ResumeTiming();
+
+        hashmap.Insert(keys, values, addrs, masks);
+
+        state.PauseTiming();
+        state.counters["load_factor"] = hashmap.LoadFactor();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * kSuiteNumKeys);
+}
+
+// Args: {value size, load factor}.
+void HashmapActivate(benchmark::State& state,
+                     const Device& device,
+                     const Dtype& dtype_key,
+                     int64_t dim_key) {
+    const int64_t dim_value = state.range(0);
+    const int64_t load_factor = state.range(1);
+    Tensor keys = HashmapSuiteKeys(HashmapQueryIndices(kSuiteNumKeys, 100),
+                                   dtype_key, dim_key, device);
+
+    Tensor addrs, masks;
+    for (auto _ : state) {
+        state.PauseTiming();
+        Hashmap hashmap = HashmapSuiteMap(dtype_key, dim_key, dim_value,
+                                          load_factor, device);
+        state.ResumeTiming();
+
+        hashmap.Activate(keys, addrs, masks);
+    }
+    state.SetItemsProcessed(state.iterations() * kSuiteNumKeys);
+}
+
+// Args: {load factor, hit ratio}.
+void HashmapFind(benchmark::State& state,
+                 const Device& device,
+                 const Dtype& dtype_key,
+                 int64_t dim_key) {
+    const int64_t load_factor = state.range(0);
+    const int64_t hit_percent = state.range(1);
+    Tensor keys = HashmapSuiteKeys(HashmapQueryIndices(kSuiteNumKeys, 100),
+                                   dtype_key, dim_key, device);
+    Tensor queries =
+            HashmapSuiteKeys(HashmapQueryIndices(kSuiteNumKeys, hit_percent),
+                             dtype_key, dim_key, device);
+
+    Hashmap hashmap =
+            HashmapSuiteMap(dtype_key, dim_key, 1, load_factor, device);
+    Tensor addrs, masks;
+    hashmap.Activate(keys, addrs, masks);
+    for (auto _ : state) {
+        hashmap.Find(queries, addrs, masks);
+    }
+    state.SetItemsProcessed(state.iterations() * kSuiteNumKeys);
+}
+
+// Args: {load factor, hit ratio}.
+void HashmapErase(benchmark::State& state,
+                  const Device& device,
+                  const Dtype& dtype_key,
+                  int64_t dim_key) {
+    const int64_t load_factor = state.range(0);
+    const int64_t hit_percent = state.range(1);
+    Tensor keys = HashmapSuiteKeys(HashmapQueryIndices(kSuiteNumKeys, 100),
+                                   dtype_key, dim_key, device);
+    Tensor queries =
+            HashmapSuiteKeys(HashmapQueryIndices(kSuiteNumKeys, hit_percent),
+                             dtype_key, dim_key, device);
+
+    Tensor addrs, masks;
+    for (auto _ : state) {
+        state.PauseTiming();
+        Hashmap hashmap =
+                HashmapSuiteMap(dtype_key, dim_key, 1, load_factor, device);
+        hashmap.Activate(keys, addrs, masks);
+        state.ResumeTiming();
+
+        hashmap.Erase(queries, masks);
+    }
+    state.SetItemsProcessed(state.iterations() * kSuiteNumKeys);
+}
+
+// Args: {value size, load factor}. Rehashes to twice the bucket count, which
+// also doubles the buffer and copies the stored values.
+void HashmapRehash(benchmark::State& state,
+                   const Device& device,
+                   const Dtype& dtype_key,
+                   int64_t dim_key) {
+    const int64_t dim_value = state.range(0);
+    const int64_t load_factor = state.range(1);
+    Tensor keys = HashmapSuiteKeys(HashmapQueryIndices(kSuiteNumKeys, 100),
+                                   dtype_key, dim_key, device);
+    Tensor values =
+            Tensor::Ones({kSuiteNumKeys, dim_value}, Dtype::Int32, device);
+
+    Tensor addrs, masks;
+    for (auto _ : state) {
+        state.PauseTiming();
+        Hashmap hashmap = HashmapSuiteMap(dtype_key, dim_key, dim_value,
+                                          load_factor, device);
+        hashmap.Insert(keys, values, addrs, masks);
+        state.ResumeTiming();
+
+        hashmap.Rehash(hashmap.GetBucketCount() * 2);
+    }
+    state.SetItemsProcessed(state.iterations() * kSuiteNumKeys);
+}
+
+// Args: {load factor}.
+void HashmapGetActiveIndices(benchmark::State& state,
+                             const Device& device,
+                             const Dtype& dtype_key,
+                             int64_t dim_key) {
+    const int64_t load_factor = state.range(0);
+    Tensor keys = HashmapSuiteKeys(HashmapQueryIndices(kSuiteNumKeys, 100),
+                                   dtype_key, dim_key, device);
+
+    Hashmap hashmap =
+            HashmapSuiteMap(dtype_key, dim_key, 1, load_factor, device);
+    Tensor addrs, masks;
+    hashmap.Activate(keys, addrs, masks);
+
+    Tensor active_indices;
+    for (auto _ : state) {
+        hashmap.GetActiveIndices(active_indices);
+    }
+    state.SetItemsProcessed(state.iterations() * kSuiteNumKeys);
+}
+
+static void HashmapValueSizeLoadFactorArgs(benchmark::internal::Benchmark* b) {
+    for (int64_t dim_value : {1, 64}) {
+        for (int64_t load_factor : {1, 4, 16}) {
+            b->Args({dim_value, load_factor});
+        }
+    }
+}
+
+static void HashmapLoadFactorHitRatioArgs(benchmark::internal::Benchmark* b) {
+    for (int64_t load_factor : {1, 4, 16}) {
+        for (int64_t hit_percent : {0, 50, 100}) {
+            b->Args({load_factor, hit_percent});
+        }
+    }
+}
+
+static void HashmapLoadFactorArgs(benchmark::internal::Benchmark* b) {
+    for (int64_t load_factor : {1, 4, 16}) {
+        b->Arg(load_factor);
+    }
+}
+
+#define REGISTER_HASHMAP_SUITE(NAME, DEVICE, DTYPE_KEY, DIM_KEY)               \
+    BENCHMARK_CAPTURE(HashmapInsert, NAME, DEVICE, DTYPE_KEY, DIM_KEY)        \
+            ->Apply(HashmapValueSizeLoadFactorArgs)                           \
+            ->Unit(benchmark::kMillisecond);                                  \
+    BENCHMARK_CAPTURE(HashmapActivate, NAME, DEVICE, DTYPE_KEY, DIM_KEY)      \
+            ->Apply(HashmapValueSizeLoadFactorArgs)                           \
+            ->Unit(benchmark::kMillisecond);                                  \
+    BENCHMARK_CAPTURE(HashmapFind, NAME, DEVICE, DTYPE_KEY, DIM_KEY)          \
+            ->Apply(HashmapLoadFactorHitRatioArgs)                            \
+            ->Unit(benchmark::kMillisecond);                                  \
+    BENCHMARK_CAPTURE(HashmapErase, NAME, DEVICE, DTYPE_KEY, DIM_KEY)         \
+            ->Apply(HashmapLoadFactorHitRatioArgs)                            \
+            ->Unit(benchmark::kMillisecond);                                  \
+    BENCHMARK_CAPTURE(HashmapRehash, NAME, DEVICE, DTYPE_KEY, DIM_KEY)        \
+            ->Apply(HashmapValueSizeLoadFactorArgs)                           \
+            ->Unit(benchmark::kMillisecond);                                  \
+    BENCHMARK_CAPTURE(HashmapGetActiveIndices, NAME, DEVICE, DTYPE_KEY,       \
+                      DIM_KEY)                                                \
+            ->Apply(HashmapLoadFactorArgs)                                    \
+            ->Unit(benchmark::kMillisecond)
+
+REGISTER_HASHMAP_SUITE(CPU_Int32x3, Device("CPU:0"), Dtype::Int32, 3);
+REGISTER_HASHMAP_SUITE(CPU_Int64, Device("CPU:0"), Dtype::Int64, 1);
+
+#ifdef BUILD_CUDA_MODULE
+REGISTER_HASHMAP_SUITE(CUDA_Int32x3, Device("CUDA:0"), Dtype::Int32, 3);
+REGISTER_HASHMAP_SUITE(CUDA_Int64, Device("CUDA:0"), Dtype::Int64, 1);
+#endif
+
+}  // namespace core
+}  // namespace open3d
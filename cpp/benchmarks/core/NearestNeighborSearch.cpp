@@ -0,0 +1,451 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <random>
+#include <unordered_map>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/nns/FaissIndex.h"
+#include "open3d/core/nns/FixedRadiusIndex.h"
+#include "open3d/core/nns/FlannIndex.h"
+#include "open3d/core/nns/KnnIndex.h"
+#include "open3d/core/nns/NanoFlannIndex.h"
+#include "open3d/geometry/KDTreeFlann.h"
+
+namespace open3d {
+namespace core {
+
+// Clustered 33-D points, similar to FPFH features of a large scan.
+static constexpr int64_t kNNSNumPoints = 1 << 17;
+static constexpr int64_t kNNSNumQueries = 1 << 12;
+static constexpr int64_t kNNSDimension = 33;
+
+static const Tensor& NNSPoints() {
+    static const Tensor points = [] {
+        std::vector<float> values(kNNSNumPoints * kNNSDimension);
+        for (int64_t i = 0; i < kNNSNumPoints; ++i) {
+            int64_t cluster = i % 1000;
+            for (int64_t d = 0; d < kNNSDimension; ++d) {
+                int64_t j = i * kNNSDimension + d;
+                values[j] = std::sin(cluster * 7.13 + d * 3.7) * 10.0f +
+                            std::sin(j * 12.9898) * 2.0f;
+            }
+        }
+        return Tensor(values, {kNNSNumPoints, kNNSDimension}, Dtype::Float32);
+    }();
+    return points;
+}
+
+static const Tensor& NNSQueries() {
+    static const Tensor queries =
+            NNSPoints().Slice(0, 0, kNNSNumQueries).Mul(1.01);
+    return queries;
+}
+
+// Exact neighbors of NNSQueries, cached per knn.
+static const Tensor& NNSExactIndices(int knn) {
+    static std::unordered_map<int, Tensor> cache;
+    if (cache.count(knn) == 0) {
+        nns::NanoFlannIndex index(NNSPoints());
+        cache[knn] = index.SearchKnn(NNSQueries(), knn).first;
+    }
+    return cache.at(knn);
+}
+
+// Fraction of the exact neighbors found.
+static double NNSRecall(const Tensor& indices, int knn) {
+    std::vector<int64_t> found = indices.ToFlatVector<int64_t>();
+    std::vector<int64_t> exact = NNSExactIndices(knn).ToFlatVector<int64_t>();
+    int64_t num_found = 0;
+    for (int64_t i = 0; i < kNNSNumQueries; ++i) {
+        for (int j = 0; j < knn; ++j) {
+            for (int k = 0; k < knn; ++k) {
+                if (found[i * knn + j] == exact[i * knn + k]) {
+                    ++num_found;
+                    break;
+                }
+            }
+        }
+    }
+    return double(num_found) / (kNNSNumQueries * knn);
+}
+
+void NNSExactKnn(benchmark::State& state) {
+    int knn = static_cast<int>(state.range(0));
+    nns::NanoFlannIndex index(NNSPoints());
+    for (auto _ : state) {
+        std::pair<Tensor, Tensor> result = index.SearchKnn(NNSQueries(), knn);
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(state.iterations() * kNNSNumQueries);
+}
+
+// state.range(0): knn, state.range(1): checks, -1 for exact search.
+void NNSApproxKnn(benchmark::State& state) {
+    int knn = static_cast<int>(state.range(0));
+    int checks = static_cast<int>(state.range(1));
+    nns::FlannIndex index(NNSPoints());
+    std::pair<Tensor, Tensor> result;
+    for (auto _ : state) {
+        result = index.SearchKnn(NNSQueries(), knn, checks);
+    }
+    state.SetItemsProcessed(state.iterations() * kNNSNumQueries);
+    state.counters["recall"] = NNSRecall(result.first, knn);
+}
+
+void NNSExactKnnIndex(benchmark::State& state) {
+    for (auto _ : state) {
+        nns::NanoFlannIndex index(NNSPoints());
+    }
+}
+
+// state.range(0): number of trees.
+void NNSApproxKnnIndex(benchmark::State& state) {
+    int num_trees = static_cast<int>(state.range(0));
+    for (auto _ : state) {
+        nns::FlannIndex index(NNSPoints(), num_trees);
+    }
+}
+
+static void NNSKnnChecksArgs(benchmark::internal::Benchmark* b) {
+    for (int64_t knn : {1, 10}) {
+        for (int64_t checks : {16, 32, 64, 128, 256, 512, -1}) {
+            b->Args({knn, checks});
+        }
+    }
+}
+
+BENCHMARK(NNSExactKnn)->Arg(1)->Arg(10)->Unit(benchmark::kMillisecond);
+BENCHMARK(NNSApproxKnn)->Apply(NNSKnnChecksArgs)->Unit(benchmark::kMillisecond);
+BENCHMARK(NNSExactKnnIndex)->Unit(benchmark::kMillisecond);
+BENCHMARK(NNSApproxKnnIndex)
+        ->Arg(1)
+        ->Arg(4)
+        ->Arg(8)
+        ->Unit(benchmark::kMillisecond);
+
+// Backend matrix. Each backend is benchmarked on the workloads it supports:
+// NanoFlannIndex and the legacy KDTreeFlann on CPU, FixedRadiusIndex and
+// KnnIndex on CUDA, and FaissIndex on both when built with Faiss. Index
+// construction and queries are timed separately.
+
+enum class NNSBackend { NanoFlann, KDTreeFlann, Faiss, FixedRadius, Knn };
+
+enum class NNSSearchType { Knn, Radius, Hybrid };
+
+// Dataset points: uniform points in the unit cube for 3-D, the clustered
+// points of NNSPoints for 33-D. Cached per dimension and size.
+static const Tensor& NNSDataset(int64_t dimension, int64_t num_points) {
+    static std::map<std::pair<int64_t, int64_t>, Tensor> cache;
+    auto key = std::make_pair(dimension, num_points);
+    if (cache.count(key) == 0) {
+        if (dimension == 3) {
+            std::mt19937 rng(0);
+            std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+            std::vector<float> values(num_points * 3);
+            for (float& v : values) {
+                v = dist(rng);
+            }
+            cache[key] = Tensor(values, {num_points, 3}, Dtype::Float32);
+        } else if (dimension == kNNSDimension &&
+                   num_points <= kNNSNumPoints) {
+            cache[key] = NNSPoints().Slice(0, 0, num_points).Contiguous();
+        } else {
+            utility::LogError("Unsupported dataset of {} points in {}-D.",
+                              num_points, dimension);
+        }
+    }
+    return cache.at(key);
+}
+
+// Queries near the dataset: other uniform points for 3-D, perturbed dataset
+// points for 33-D.
+static const Tensor& NNSQueryset(int64_t dimension, int64_t num_queries) {
+    static std::map<std::pair<int64_t, int64_t>, Tensor> cache;
+    auto key = std::make_pair(dimension, num_queries);
+    if (cache.count(key) == 0) {
+        if (dimension == 3) {
+            std::mt19937 rng(1);
+            std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+            std::vector<float> values(num_queries * 3);
+            for (float& v : values) {
+                v = dist(rng);
+            }
+            cache[key] = Tensor(values, {num_queries, 3}, Dtype::Float32);
+        } else {
+            cache[key] = NNSDataset(dimension, num_queries).Mul(1.01);
+        }
+    }
+    return cache.at(key);
+}
+
+// Radius holding \p num_neighbors points on average, for uniform 3-D points.
+static double NNSRadius(int64_t num_points, int64_t num_neighbors) {
+    return std::cbrt(3.0 * num_neighbors / (4.0 * M_PI * num_points));
+}
+
+// Column-major copy of 2D Float32 points, as used by the legacy KDTreeFlann.
+static Eigen::MatrixXd NNSToEigen(const Tensor& points) {
+    std::vector<double> values =
+            points.To(Dtype::Float64).Contiguous().ToFlatVector<double>();
+    return Eigen::Map<Eigen::MatrixXd>(values.data(), points.GetShape(1),
+                                       points.GetShape(0));
+}
+
+// Search index of one backend. The legacy KDTreeFlann is searched in parallel
+// with SearchBatch, like the tensor indices.
+class NNSBenchmarkIndex {
+public:
+    NNSBenchmarkIndex(NNSBackend backend,
+                      const Tensor& points,
+                      double radius = 0.0) {
+        switch (backend) {
+            case NNSBackend::NanoFlann:
+                index_ = std::make_unique<nns::NanoFlannIndex>(points);
+                break;
+            case NNSBackend::KDTreeFlann:
+                kdtree_ = std::make_unique<geometry::KDTreeFlann>(
+                        NNSToEigen(points));
+                break;
+#ifdef WITH_FAISS
+            case NNSBackend::Faiss:
+                index_ = std::make_unique<nns::FaissIndex>(points);
+                break;
+#endif
+            case NNSBackend::FixedRadius:
+                index_ = std::make_unique<nns::FixedRadiusIndex>(points,
+                                                                 radius);
+                break;
+            case NNSBackend::Knn:
+                index_ = std::make_unique<nns::KnnIndex>(points);
+                break;
+            default:
+                utility::LogError("Backend not available in this build.");
+        }
+        cuda::Synchronize();
+    }
+
+    // Searches the neighbors of the queries, keeping the result for
+    // NumNeighbors().
+    void Search(const Tensor& queries,
+                const Eigen::MatrixXd& legacy_queries,
+                NNSSearchType type,
+                double radius,
+                int knn) {
+        if (kdtree_) {
+            if (type == NNSSearchType::Knn) {
+                kdtree_->SearchBatch(legacy_queries,
+                                     geometry::KDTreeSearchParamKNN(knn),
+                                     legacy_result_);
+            } else if (type == NNSSearchType::Radius) {
+                kdtree_->SearchBatch(legacy_queries,
+                                     geometry::KDTreeSearchParamRadius(radius),
+                                     legacy_result_);
+            } else {
+                kdtree_->SearchBatch(
+                        legacy_queries,
+                        geometry::KDTreeSearchParamHybrid(radius, knn),
+                        legacy_result_);
+            }
+            return;
+        }
+
+        if (type == NNSSearchType::Knn) {
+            indices_ = index_->SearchKnn(queries, knn).first;
+        } else if (type == NNSSearchType::Radius) {
+            indices_ = std::get<0>(index_->SearchRadius(queries, radius));
+        } else {
+            indices_ = index_->SearchHybrid(queries, static_cast<float>(radius),
+                                            knn)
+                               .first;
+        }
+        cuda::Synchronize();
+    }
+
+    // Total number of neighbors found by the last search. Knn and hybrid
+    // results are padded with -1.
+    int64_t NumNeighbors() const {
+        if (kdtree_) {
+            return static_cast<int64_t>(legacy_result_.indices_.size());
+        }
+        std::vector<int64_t> indices =
+                indices_.To(Dtype::Int64).ToFlatVector<int64_t>();
+        return std::count_if(indices.begin(), indices.end(),
+                             [](int64_t index) { return index >= 0; });
+    }
+
+private:
+    std::unique_ptr<nns::NNSIndex> index_;
+    std::unique_ptr<geometry::KDTreeFlann> kdtree_;
+    Tensor indices_;
+    geometry::KDTreeSearchResult legacy_result_;
+};
+
+// state.range(0): dimension, state.range(1): number of points.
+void NNSBuild(benchmark::State& state,
+              NNSBackend backend,
+              const Device& device) {
+    int64_t num_points = state.range(1);
+    Tensor points = NNSDataset(state.range(0), num_points).Copy(device);
+    double radius = NNSRadius(num_points, 32);
+    for (auto _ : state) {
+        NNSBenchmarkIndex index(backend, points, radius);
+    }
+    state.SetItemsProcessed(state.iterations() * num_points);
+}
+
+// state.range(0): dimension, state.range(1): number of points,
+// state.range(2): number of queries, state.range(3): knn for Knn and Hybrid
+// searches, and the average number of neighbors within the radius for Radius
+// and Hybrid searches.
+void NNSSearch(benchmark::State& state,
+               NNSBackend backend,
+               NNSSearchType type,
+               const Device& device) {
+    int64_t dimension = state.range(0);
+    int64_t num_points = state.range(1);
+    int64_t num_queries = state.range(2);
+    int knn = static_cast<int>(state.range(3));
+    // Hybrid searches use a radius holding twice the neighbors on average, so
+    // that the knn limit applies to most queries.
+    double radius = NNSRadius(
+            num_points, type == NNSSearchType::Hybrid ? 2 * knn : knn);
+
+    Tensor points = NNSDataset(dimension, num_points).Copy(device);
+    Tensor queries = NNSQueryset(dimension, num_queries).Copy(device);
+    Eigen::MatrixXd legacy_queries;
+    if (backend == NNSBackend::KDTreeFlann) {
+        legacy_queries = NNSToEigen(NNSQueryset(dimension, num_queries));
+    }
+    NNSBenchmarkIndex index(backend, points, radius);
+
+    for (auto _ : state) {
+        index.Search(queries, legacy_queries, type, radius, knn);
+    }
+    state.SetItemsProcessed(state.iterations() * num_queries);
+    state.counters["neighbors"] =
+            static_cast<double>(index.NumNeighbors()) / num_queries;
+}
+
+static void NNSBuildArgs(benchmark::internal::Benchmark* b) {
+    b->ArgNames({"dim", "points"});
+    for (int64_t num_points : {1 << 14, 1 << 17, 1 << 20}) {
+        b->Args({3, num_points});
+    }
+    for (int64_t num_points : {1 << 14, 1 << 17}) {
+        b->Args({kNNSDimension, num_points});
+    }
+}
+
+static void NNSKnnArgs(benchmark::internal::Benchmark* b) {
+    b->ArgNames({"dim", "points", "queries", "knn"});
+    for (int64_t num_points : {1 << 14, 1 << 17, 1 << 20}) {
+        for (int64_t num_queries : {1 << 10, 1 << 14}) {
+            for (int64_t knn : {1, 8, 32}) {
+                b->Args({3, num_points, num_queries, knn});
+            }
+        }
+    }
+    for (int64_t num_points : {1 << 14, 1 << 17}) {
+        for (int64_t knn : {1, 10}) {
+            b->Args({kNNSDimension, num_points, kNNSNumQueries, knn});
+        }
+    }
+}
+
+// Radius and hybrid searches, on 3-D points only.
+static void NNSRadiusArgs(benchmark::internal::Benchmark* b) {
+    b->ArgNames({"dim", "points", "queries", "neighbors"});
+    for (int64_t num_points : {1 << 14, 1 << 17, 1 << 20}) {
+        for (int64_t num_queries : {1 << 10, 1 << 14}) {
+            for (int64_t num_neighbors : {8, 32}) {
+                b->Args({3, num_points, num_queries, num_neighbors});
+            }
+        }
+    }
+}
+
+#define NNS_BENCHMARK_BUILD(BACKEND, DEVICE, ARGS)                          \
+    BENCHMARK_CAPTURE(NNSBuild, BACKEND##_##DEVICE, NNSBackend::BACKEND,    \
+                      Device(#DEVICE ":0"))                                 \
+            ->Apply(ARGS)                                                   \
+            ->Unit(benchmark::kMillisecond);
+
+#define NNS_BENCHMARK_SEARCH(BACKEND, TYPE, DEVICE, ARGS)                   \
+    BENCHMARK_CAPTURE(NNSSearch, BACKEND##_##TYPE##_##DEVICE,               \
+                      NNSBackend::BACKEND, NNSSearchType::TYPE,             \
+                      Device(#DEVICE ":0"))                                 \
+            ->Apply(ARGS)                                                   \
+            ->Unit(benchmark::kMillisecond);
+
+NNS_BENCHMARK_BUILD(NanoFlann, CPU, NNSBuildArgs)
+NNS_BENCHMARK_SEARCH(NanoFlann, Knn, CPU, NNSKnnArgs)
+NNS_BENCHMARK_SEARCH(NanoFlann, Radius, CPU, NNSRadiusArgs)
+NNS_BENCHMARK_SEARCH(NanoFlann, Hybrid, CPU, NNSRadiusArgs)
+
+NNS_BENCHMARK_BUILD(KDTreeFlann, CPU, NNSBuildArgs)
+NNS_BENCHMARK_SEARCH(KDTreeFlann, Knn, CPU, NNSKnnArgs)
+NNS_BENCHMARK_SEARCH(KDTreeFlann, Radius, CPU, NNSRadiusArgs)
+NNS_BENCHMARK_SEARCH(KDTreeFlann, Hybrid, CPU, NNSRadiusArgs)
+
+#ifdef WITH_FAISS
+NNS_BENCHMARK_BUILD(Faiss, CPU, NNSBuildArgs)
+NNS_BENCHMARK_SEARCH(Faiss, Knn, CPU, NNSKnnArgs)
+NNS_BENCHMARK_SEARCH(Faiss, Hybrid, CPU, NNSRadiusArgs)
+#endif
+
+#ifdef BUILD_CUDA_MODULE
+// FixedRadiusIndex only supports 3-D points.
+static void NNSRadiusBuildArgs(benchmark::internal::Benchmark* b) {
+    b->ArgNames({"dim", "points"});
+    for (int64_t num_points : {1 << 14, 1 << 17, 1 << 20}) {
+        b->Args({3, num_points});
+    }
+}
+
+NNS_BENCHMARK_BUILD(FixedRadius, CUDA, NNSRadiusBuildArgs)
+NNS_BENCHMARK_SEARCH(FixedRadius, Radius, CUDA, NNSRadiusArgs)
+NNS_BENCHMARK_SEARCH(FixedRadius, Hybrid, CUDA, NNSRadiusArgs)
+
+NNS_BENCHMARK_BUILD(Knn, CUDA, NNSBuildArgs)
+NNS_BENCHMARK_SEARCH(Knn, Knn, CUDA, NNSKnnArgs)
+
+#ifdef WITH_FAISS
+NNS_BENCHMARK_BUILD(Faiss, CUDA, NNSBuildArgs)
+NNS_BENCHMARK_SEARCH(Faiss, Knn, CUDA, NNSKnnArgs)
+NNS_BENCHMARK_SEARCH(Faiss, Hybrid, CUDA, NNSRadiusArgs)
+#endif
+#endif
+
+}  // namespace core
+}  // namespace open3d
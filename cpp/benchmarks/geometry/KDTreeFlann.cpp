@@ -38,11 +38,16 @@ class TestKDTreeLine0 {
     constexpr static double step = .139;
     geometry::PointCloud pc_;
     geometry::KDTreeFlann kdtree_;
+    geometry::KDTreeFlann::Precision precision_;
 
     int pos_ = 0;
     int size_ = 0;
 
 public:
+    explicit TestKDTreeLine0(geometry::KDTreeFlann::Precision precision =
+                                     geometry::KDTreeFlann::Precision::Float64)
+        : kdtree_(precision), precision_(precision) {}
+
     void setup(int size) {
         if (this->size_ == size) return;
         utility::LogInfo("setup KDTree size={:d}", size);
@@ -78,6 +83,8 @@ public:
 };
 // reuse the same instance so we don't recreate the kdtree every time
 TestKDTreeLine0 testKDTreeLine0;
+TestKDTreeLine0 testKDTreeLine0Float32(
+        geometry::KDTreeFlann::Precision::Float32);
 
 static void BM_TestKDTreeLine0(benchmark::State& state) {
     // state.range(n) are arguments that are passed to us
@@ -96,5 +103,39 @@ BENCHMARK(BM_TestKDTreeLine0)
         ->MinTime(0.1)
         ->Ranges({{1 << 0, 1 << 14}, {1 << 16, 1 << 22}});
 
+static void BM_TestKDTreeLine0Float32(benchmark::State& state) {
+    int radius = state.range(0);
+    int size = state.range(1);
+    testKDTreeLine0Float32.setup(size);
+    for (auto _ : state) {
+        testKDTreeLine0Float32.search(radius);
+    }
+}
+BENCHMARK(BM_TestKDTreeLine0Float32)
+        ->MinTime(0.1)
+        ->Ranges({{1 << 0, 1 << 14}, {1 << 16, 1 << 22}});
+
+// Tree construction over a random cloud, run with the given precision.
+static void BM_KDTreeBuild(benchmark::State& state,
+                           geometry::KDTreeFlann::Precision precision) {
+    geometry::PointCloud pc;
+    pc.points_.resize(state.range(0));
+    for (auto& point : pc.points_) {
+        point = Eigen::Vector3d::Random();
+    }
+    for (auto _ : state) {
+        geometry::KDTreeFlann kdtree(pc, precision);
+        benchmark::DoNotOptimize(kdtree);
+    }
+}
+BENCHMARK_CAPTURE(BM_KDTreeBuild, Float64,
+                  geometry::KDTreeFlann::Precision::Float64)
+        ->Range(1 << 14, 1 << 22)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_KDTreeBuild, Float32,
+                  geometry::KDTreeFlann::Precision::Float32)
+        ->Range(1 << 14, 1 << 22)
+        ->Unit(benchmark::kMillisecond);
+
 }  // namespace benchmarks
 }  // namespace open3d
@@ -28,6 +28,7 @@
 
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/io/TriangleMeshIO.h"
+#include "open3d/t/geometry/TriangleMesh.h"
 
 namespace open3d {
 namespace benchmarks {
@@ -60,5 +61,31 @@ BENCHMARK_DEFINE_F(SamplePointsFixture, Uniform)(benchmark::State& state) {
 
 BENCHMARK_REGISTER_F(SamplePointsFixture, Uniform)->Args({123})->Args({1000});
 
+BENCHMARK_DEFINE_F(SamplePointsFixture, TensorPoisson)
+(benchmark::State& state) {
+    t::geometry::TriangleMesh mesh =
+            t::geometry::TriangleMesh::FromLegacyTriangleMesh(*trimesh);
+    for (auto _ : state) {
+        mesh.SamplePointsPoissonDisk(state.range(0));
+    }
+}
+
+BENCHMARK_REGISTER_F(SamplePointsFixture, TensorPoisson)
+        ->Args({123})
+        ->Args({1000});
+
+BENCHMARK_DEFINE_F(SamplePointsFixture, TensorUniform)
+(benchmark::State& state) {
+    t::geometry::TriangleMesh mesh =
+            t::geometry::TriangleMesh::FromLegacyTriangleMesh(*trimesh);
+    for (auto _ : state) {
+        mesh.SamplePointsUniformly(state.range(0));
+    }
+}
+
+BENCHMARK_REGISTER_F(SamplePointsFixture, TensorUniform)
+        ->Args({123})
+        ->Args({1000});
+
 }  // namespace benchmarks
 }  // namespace open3d
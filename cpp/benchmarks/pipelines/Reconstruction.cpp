@@ -0,0 +1,344 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+// End-to-end RGB-D reconstruction: load, odometry, integration, ray casting,
+// surface extraction, mesh cleanup and write, on the legacy and the tensor
+// pipelines. Each benchmark iteration reconstructs the whole sequence. The
+// counters hold the 50th, 90th and 99th percentiles of every stage, the
+// throughput in frames per second and the peak memory. Run with
+// --benchmark_filter=Reconstruction --benchmark_out=report.json
+// --benchmark_out_format=json for a JSON report to track across releases and
+// hardware.
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+
+#include "open3d/camera/PinholeCameraIntrinsic.h"
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/EigenConverter.h"
+#include "open3d/core/MemoryManager.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/geometry/RGBDImage.h"
+#include "open3d/geometry/TriangleMesh.h"
+#include "open3d/io/ImageIO.h"
+#include "open3d/io/PinholeCameraTrajectoryIO.h"
+#include "open3d/io/TriangleMeshIO.h"
+#include "open3d/pipelines/integration/ScalableTSDFVolume.h"
+#include "open3d/pipelines/odometry/Odometry.h"
+#include "open3d/t/geometry/RGBDImage.h"
+#include "open3d/t/geometry/TSDFVoxelGrid.h"
+#include "open3d/t/geometry/TriangleMesh.h"
+#include "open3d/t/io/RGBDSequenceLoader.h"
+#include "open3d/t/io/TriangleMeshIO.h"
+#include "open3d/t/pipelines/odometry/RGBDOdometry.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Timer.h"
+
+namespace open3d {
+namespace benchmarks {
+
+namespace {
+
+constexpr float kVoxelSize = 3.0f / 512.0f;
+constexpr float kSDFTrunc = 0.04f;
+constexpr float kDepthScale = 1000.0f;
+constexpr float kDepthMax = 3.0f;
+
+/// Color and depth files of the RGB-D sequence, in the layout of
+/// examples/test_data/RGBD. Set OPEN3D_BENCHMARK_RGBD_DIR to a downloaded
+/// sequence in the same layout for longer runs, as for the TSDF integration
+/// benchmarks. The poses in odometry.log are not used, the camera is tracked
+/// by odometry.
+std::vector<std::pair<std::string, std::string>> GetSequenceFiles() {
+    const char* env_dir = std::getenv("OPEN3D_BENCHMARK_RGBD_DIR");
+    std::string dir = env_dir != nullptr ? std::string(env_dir)
+                                         : std::string(TEST_DATA_DIR) + "/RGBD";
+    auto trajectory =
+            io::CreatePinholeCameraTrajectoryFromFile(dir + "/odometry.log");
+    std::vector<std::pair<std::string, std::string>> files;
+    for (size_t i = 0; i < trajectory->parameters_.size(); ++i) {
+        files.emplace_back(fmt::format("{}/color/{:05d}.jpg", dir, i),
+                           fmt::format("{}/depth/{:05d}.png", dir, i));
+    }
+    if (files.empty()) {
+        utility::LogError("No frames found in {}.", dir);
+    }
+    return files;
+}
+
+std::string GetOutputFile() {
+    return utility::filesystem::GetWorkingDirectory() +
+           "/ReconstructionBenchmark.ply";
+}
+
+/// Resets the peak resident set size of the process, where supported.
+void ResetHostPeakMemory() {
+#ifdef __linux__
+    std::ofstream("/proc/self/clear_refs") << "5";
+#endif
+}
+
+/// Peak resident set size of the process in MB since the last reset, or 0
+/// where it is not available.
+double GetHostPeakMemoryMB() {
+#ifdef __linux__
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.compare(0, 6, "VmHWM:") == 0) {
+            return std::stod(line.substr(6)) / 1024.0;
+        }
+    }
+#endif
+    return 0.0;
+}
+
+/// Latencies of the pipeline stages in milliseconds, over all the frames and
+/// benchmark iterations.
+class StageTimings {
+public:
+    /// Runs \p func and records its duration for \p stage. CUDA work is
+    /// synchronized before the timer stops.
+    template <typename Func>
+    void Time(const std::string& stage, Func&& func) {
+        utility::Timer timer;
+        timer.Start();
+        func();
+        core::cuda::Synchronize();
+        timer.Stop();
+        latencies_[stage].push_back(timer.GetDuration());
+    }
+
+    /// Reports the percentiles of each stage, and the frames per second of
+    /// the per-frame stages in \p frame_stages.
+    void Report(benchmark::State& state,
+                const std::vector<std::string>& frame_stages,
+                size_t num_frames) const {
+        for (const auto& it : latencies_) {
+            std::vector<double> latencies = it.second;
+            std::sort(latencies.begin(), latencies.end());
+            auto percentile = [&latencies](double p) {
+                size_t i = static_cast<size_t>(
+                        p * (latencies.size() - 1) + 0.5);
+                return latencies[i];
+            };
+            state.counters[it.first + "_p50_ms"] = percentile(0.5);
+            state.counters[it.first + "_p90_ms"] = percentile(0.9);
+            state.counters[it.first + "_p99_ms"] = percentile(0.99);
+        }
+
+        double frame_ms = 0.0;
+        for (const std::string& stage : frame_stages) {
+            auto it = latencies_.find(stage);
+            if (it != latencies_.end()) {
+                for (double latency : it->second) {
+                    frame_ms += latency;
+                }
+            }
+        }
+        if (frame_ms > 0.0) {
+            state.counters["fps"] =
+                    1000.0 * num_frames * state.iterations() / frame_ms;
+        }
+    }
+
+private:
+    std::map<std::string, std::vector<double>> latencies_;
+};
+
+}  // namespace
+
+/// Legacy pipeline: RGBDOdometryTracker, ScalableTSDFVolume and the legacy
+/// TriangleMesh cleanup.
+void ReconstructionLegacy(benchmark::State& state) {
+    const auto files = GetSequenceFiles();
+    const camera::PinholeCameraIntrinsic intrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    const std::string output_file = GetOutputFile();
+    StageTimings timings;
+    size_t num_triangles = 0;
+
+    ResetHostPeakMemory();
+    for (auto _ : state) {
+        pipelines::integration::ScalableTSDFVolume volume(
+                kVoxelSize, kSDFTrunc,
+                pipelines::integration::TSDFVolumeColorType::RGB8);
+        pipelines::odometry::RGBDOdometryTracker tracker(intrinsic);
+        // Camera to world transformation of the current frame.
+        Eigen::Matrix4d pose = Eigen::Matrix4d::Identity();
+
+        for (const auto& file : files) {
+            std::shared_ptr<geometry::RGBDImage> rgbd, rgbd_intensity;
+            timings.Time("load", [&]() {
+                auto color = io::CreateImageFromFile(file.first);
+                auto depth = io::CreateImageFromFile(file.second);
+                rgbd = geometry::RGBDImage::CreateFromColorAndDepth(
+                        *color, *depth, kDepthScale, kDepthMax, false);
+                rgbd_intensity = geometry::RGBDImage::CreateFromColorAndDepth(
+                        *color, *depth, kDepthScale, kDepthMax, true);
+            });
+
+            bool has_previous = tracker.HasPreviousFrame();
+            timings.Time(has_previous ? "odometry" : "odometry_first", [&]() {
+                auto result = tracker.Track(*rgbd_intensity);
+                // The odometry maps the previous camera to the current one.
+                if (std::get<0>(result)) {
+                    pose = pose * std::get<1>(result).inverse();
+                }
+            });
+
+            timings.Time("integrate", [&]() {
+                volume.Integrate(*rgbd, intrinsic, pose.inverse());
+            });
+        }
+
+        std::shared_ptr<geometry::TriangleMesh> mesh;
+        timings.Time("extract",
+                     [&]() { mesh = volume.ExtractTriangleMesh(); });
+        timings.Time("cleanup", [&]() {
+            mesh->RemoveDuplicatedVertices();
+            mesh->RemoveDegenerateTriangles();
+            mesh->RemoveUnreferencedVertices();
+            mesh->ComputeVertexNormals();
+        });
+        timings.Time("write",
+                     [&]() { io::WriteTriangleMesh(output_file, *mesh); });
+        num_triangles = mesh->triangles_.size();
+    }
+    utility::filesystem::RemoveFile(output_file);
+
+    timings.Report(state, {"load", "odometry", "odometry_first", "integrate"},
+                   files.size());
+    state.counters["frames"] = static_cast<double>(files.size());
+    state.counters["triangles"] = static_cast<double>(num_triangles);
+    state.counters["host_peak_MB"] = GetHostPeakMemoryMB();
+}
+
+/// Tensor pipeline on \p device: RGBDSequenceLoader, RGBDOdometryMultiScale,
+/// TSDFVoxelGrid integration and ray casting, and the tensor TriangleMesh
+/// cleanup. The model is ray cast from every new pose, as a frame-to-model
+/// tracker would.
+void ReconstructionTensor(benchmark::State& state, const core::Device& device) {
+    const auto files = GetSequenceFiles();
+    const camera::PinholeCameraIntrinsic intrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    const core::Tensor intrinsics =
+            core::eigen_converter::EigenMatrixToTensor(
+                    intrinsic.intrinsic_matrix_)
+                    .To(core::Dtype::Float32);
+    const std::string output_file = GetOutputFile();
+    StageTimings timings;
+    size_t num_triangles = 0;
+
+    ResetHostPeakMemory();
+    core::MemoryManager::ResetPeakStatistics(device);
+    for (auto _ : state) {
+        t::geometry::TSDFVoxelGrid voxel_grid(
+                {{"tsdf", core::Dtype::Float32},
+                 {"weight", core::Dtype::UInt16},
+                 {"color", core::Dtype::UInt16}},
+                kVoxelSize, kSDFTrunc, 16, 1000, device);
+        t::io::RGBDSequenceLoader loader(files, device);
+        // Camera to world transformation of the current frame.
+        core::Tensor pose = core::Tensor::Eye(4, core::Dtype::Float64,
+                                              core::Device("CPU:0"));
+        t::geometry::RGBDImage previous;
+
+        for (size_t i = 0; i < files.size(); ++i) {
+            t::geometry::RGBDImage rgbd;
+            timings.Time("load", [&]() { rgbd = loader.NextFrame(); });
+
+            if (i > 0) {
+                timings.Time("odometry", [&]() {
+                    // The odometry maps the current camera to the previous
+                    // one.
+                    auto result =
+                            t::pipelines::odometry::RGBDOdometryMultiScale(
+                                    rgbd, previous, intrinsics,
+                                    core::Tensor::Eye(4, core::Dtype::Float64,
+                                                      core::Device("CPU:0")),
+                                    kDepthScale, kDepthMax);
+                    pose = pose.Matmul(
+                            result.transformation_.To(core::Dtype::Float64));
+                });
+            }
+
+            core::Tensor extrinsics = pose.Inverse().To(core::Dtype::Float32);
+            timings.Time("integrate", [&]() {
+                voxel_grid.Integrate(rgbd.depth_, rgbd.color_, intrinsics,
+                                     extrinsics, kDepthScale, kDepthMax);
+            });
+            timings.Time("raycast", [&]() {
+                voxel_grid.RayCast(intrinsics, extrinsics,
+                                   rgbd.depth_.GetCols(), rgbd.depth_.GetRows(),
+                                   0.1f, kDepthMax);
+            });
+            previous = rgbd;
+        }
+
+        t::geometry::TriangleMesh mesh;
+        timings.Time("extract",
+                     [&]() { mesh = voxel_grid.ExtractSurfaceMesh(); });
+        timings.Time("cleanup", [&]() {
+            mesh.RemoveDuplicatedVertices();
+            mesh.ComputeVertexNormals();
+        });
+        timings.Time("write",
+                     [&]() { t::io::WriteTriangleMesh(output_file, mesh); });
+        num_triangles = mesh.HasTriangles()
+                                ? static_cast<size_t>(
+                                          mesh.GetTriangles().GetLength())
+                                : 0;
+    }
+    utility::filesystem::RemoveFile(output_file);
+
+    timings.Report(state, {"load", "odometry", "integrate", "raycast"},
+                   files.size());
+    state.counters["frames"] = static_cast<double>(files.size());
+    state.counters["triangles"] = static_cast<double>(num_triangles);
+    state.counters["host_peak_MB"] = GetHostPeakMemoryMB();
+    state.counters["device_peak_MB"] =
+            static_cast<double>(core::MemoryManager::GetStatistics(device)
+                                        .peak_bytes_allocated_) /
+            (1 << 20);
+}
+
+BENCHMARK(ReconstructionLegacy)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ReconstructionTensor, CPU, core::Device("CPU:0"))
+        ->Unit(benchmark::kMillisecond);
+#ifdef BUILD_CUDA_MODULE
+BENCHMARK_CAPTURE(ReconstructionTensor, CUDA, core::Device("CUDA:0"))
+        ->Unit(benchmark::kMillisecond);
+#endif
+
+}  // namespace benchmarks
+}  // namespace open3d
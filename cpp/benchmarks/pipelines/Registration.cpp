@@ -0,0 +1,515 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include <benchmark/benchmark.h>
+
+#include <map>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/EigenConverter.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/io/PointCloudIO.h"
+#include "open3d/pipelines/registration/ColoredICP.h"
+#include "open3d/pipelines/registration/FastGlobalRegistration.h"
+#include "open3d/pipelines/registration/Feature.h"
+#include "open3d/pipelines/registration/Registration.h"
+#include "open3d/pipelines/registration/TransformationEstimation.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/pipelines/registration/FastGlobalRegistration.h"
+#include "open3d/t/pipelines/registration/Feature.h"
+#include "open3d/t/pipelines/registration/Registration.h"
+#include "open3d/t/pipelines/registration/TransformationEstimation.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/Timer.h"
+
+namespace open3d {
+namespace benchmarks {
+
+namespace {
+
+namespace registration = pipelines::registration;
+namespace t_registration = t::pipelines::registration;
+
+/// ICP runs a fixed number of iterations, with the convergence checks
+/// disabled, so that the time per iteration is comparable across methods.
+constexpr int kICPIterations = 20;
+/// Number of hypotheses tested by RANSAC, with the early exit disabled.
+constexpr int kRANSACIterations = 10000;
+/// Maximum number of neighbors of the FPFH features.
+constexpr int kFPFHMaxNN = 100;
+
+/// Initial alignment of ICP/cloud_bin_0.pcd to ICP/cloud_bin_1.pcd, as in the
+/// ICP tutorial.
+Eigen::Matrix4d InitialTransformation() {
+    Eigen::Matrix4d init;
+    init << 0.862, 0.011, -0.507, 0.5, -0.139, 0.967, -0.215, 0.7, 0.487,
+            0.255, 0.835, -1.4, 0.0, 0.0, 0.0, 1.0;
+    return init;
+}
+
+/// Overlapping scans of the bundled ICP dataset, with colors, downsampled to
+/// \p voxel_mm with normals re-estimated, and cached per voxel size. The
+/// voxel size sets the cloud sizes: about 95k, 18k and 5k source points for
+/// 10, 25 and 50 mm.
+struct RegistrationPair {
+    geometry::PointCloud source_;
+    geometry::PointCloud target_;
+    double voxel_size_ = 0.0;
+};
+
+const RegistrationPair& GetRegistrationPair(int voxel_mm) {
+    static std::map<int, RegistrationPair> cache;
+    auto it = cache.find(voxel_mm);
+    if (it != cache.end()) {
+        return it->second;
+    }
+    RegistrationPair pair;
+    pair.voxel_size_ = voxel_mm * 0.001;
+    geometry::PointCloud* clouds[] = {&pair.source_, &pair.target_};
+    for (int i = 0; i < 2; ++i) {
+        std::string path =
+                fmt::format("{}/ICP/cloud_bin_{}.pcd", TEST_DATA_DIR, i);
+        geometry::PointCloud pcd;
+        if (!io::ReadPointCloud(path, pcd) || !pcd.HasColors()) {
+            utility::LogError("Unable to read colored points from {}.", path);
+        }
+        *clouds[i] = *pcd.VoxelDownSample(pair.voxel_size_);
+        clouds[i]->EstimateNormals(
+                geometry::KDTreeSearchParamHybrid(2 * pair.voxel_size_, 30));
+    }
+    utility::LogInfo("Registration pair at {} mm: {} and {} points.", voxel_mm,
+                     pair.source_.points_.size(), pair.target_.points_.size());
+    return cache.emplace(voxel_mm, std::move(pair)).first->second;
+}
+
+/// FPFH features of a registration pair with a radius of 5 voxels, cached per
+/// voxel size.
+const std::pair<registration::Feature, registration::Feature>& GetFPFHFeatures(
+        int voxel_mm) {
+    static std::map<int, std::pair<registration::Feature,
+                                   registration::Feature>>
+            cache;
+    auto it = cache.find(voxel_mm);
+    if (it != cache.end()) {
+        return it->second;
+    }
+    const RegistrationPair& pair = GetRegistrationPair(voxel_mm);
+    geometry::KDTreeSearchParamHybrid param(5 * pair.voxel_size_, kFPFHMaxNN);
+    auto source_feature = registration::ComputeFPFHFeature(pair.source_, param);
+    auto target_feature = registration::ComputeFPFHFeature(pair.target_, param);
+    return cache
+            .emplace(voxel_mm,
+                     std::make_pair(*source_feature, *target_feature))
+            .first->second;
+}
+
+/// Benchmark arguments of ICP: voxel size and maximum correspondence
+/// distance, both in millimeters.
+void ICPArgs(benchmark::internal::Benchmark* b) {
+    b->ArgNames({"voxel_mm", "dist_mm"});
+    for (int64_t voxel_mm : {10, 25, 50}) {
+        b->Args({voxel_mm, voxel_mm * 3 / 2});
+        b->Args({voxel_mm, voxel_mm * 3});
+    }
+}
+
+/// Benchmark arguments of global registration and features: voxel size in
+/// millimeters.
+void GlobalArgs(benchmark::internal::Benchmark* b) {
+    b->ArgNames({"voxel_mm"});
+    b->Arg(25)->Arg(50);
+}
+
+/// Report the time per ICP iteration or RANSAC hypothesis, and the
+/// registration quality.
+template <typename Result>
+void ReportRegistration(benchmark::State& state,
+                        double total_ms,
+                        int iterations_per_run,
+                        const Result& result,
+                        const std::string& counter_name) {
+    if (state.iterations() > 0) {
+        state.counters[counter_name] =
+                total_ms / (state.iterations() * iterations_per_run);
+    }
+    state.counters["fitness"] = result.fitness_;
+    state.counters["inlier_rmse"] = result.inlier_rmse_;
+}
+
+std::unique_ptr<registration::TransformationEstimation>
+CreateLegacyEstimation(registration::TransformationEstimationType type) {
+    switch (type) {
+        case registration::TransformationEstimationType::PointToPoint:
+            return std::make_unique<
+                    registration::TransformationEstimationPointToPoint>();
+        case registration::TransformationEstimationType::PointToPlane:
+            return std::make_unique<
+                    registration::TransformationEstimationPointToPlane>();
+        default:
+            utility::LogError("Unsupported estimation type.");
+    }
+    return nullptr;
+}
+
+std::unique_ptr<t_registration::TransformationEstimation>
+CreateTensorEstimation(t_registration::TransformationEstimationType type) {
+    switch (type) {
+        case t_registration::TransformationEstimationType::PointToPoint:
+            return std::make_unique<
+                    t_registration::TransformationEstimationPointToPoint>();
+        case t_registration::TransformationEstimationType::PointToPlane:
+            return std::make_unique<
+                    t_registration::TransformationEstimationPointToPlane>();
+        case t_registration::TransformationEstimationType::ColoredICP:
+            return std::make_unique<
+                    t_registration::TransformationEstimationForColoredICP>();
+        default:
+            utility::LogError("Unsupported estimation type.");
+    }
+    return nullptr;
+}
+
+}  // namespace
+
+void LegacyICP(benchmark::State& state,
+               registration::TransformationEstimationType type) {
+    const RegistrationPair& pair =
+            GetRegistrationPair(static_cast<int>(state.range(0)));
+    double max_distance = state.range(1) * 0.001;
+    registration::ICPConvergenceCriteria criteria(0.0, 0.0, kICPIterations);
+    // Colored ICP has its own entry point, which computes the color gradients
+    // of the target before the iterations.
+    bool colored =
+            type == registration::TransformationEstimationType::ColoredICP;
+    auto estimation = colored ? nullptr : CreateLegacyEstimation(type);
+    auto run = [&]() {
+        if (colored) {
+            return registration::RegistrationColoredICP(
+                    pair.source_, pair.target_, max_distance,
+                    InitialTransformation(),
+                    registration::TransformationEstimationForColoredICP(),
+                    criteria);
+        }
+        return registration::RegistrationICP(pair.source_, pair.target_,
+                                             max_distance,
+                                             InitialTransformation(),
+                                             *estimation, criteria);
+    };
+
+    // Warm up.
+    registration::RegistrationResult result = run();
+
+    utility::Timer timer;
+    double total_ms = 0.0;
+    for (auto _ : state) {
+        timer.Start();
+        result = run();
+        timer.Stop();
+        total_ms += timer.GetDuration();
+    }
+    ReportRegistration(state, total_ms, kICPIterations, result,
+                       "iteration_ms");
+}
+
+void TensorICP(benchmark::State& state,
+               t_registration::TransformationEstimationType type,
+               const core::Device& device) {
+    const RegistrationPair& pair =
+            GetRegistrationPair(static_cast<int>(state.range(0)));
+    double max_distance = state.range(1) * 0.001;
+    t::geometry::PointCloud source = t::geometry::PointCloud::
+            FromLegacyPointCloud(pair.source_, core::Dtype::Float32, device);
+    t::geometry::PointCloud target = t::geometry::PointCloud::
+            FromLegacyPointCloud(pair.target_, core::Dtype::Float32, device);
+    core::Tensor init =
+            core::eigen_converter::EigenMatrixToTensor(InitialTransformation())
+                    .To(core::Dtype::Float32)
+                    .Copy(device);
+    auto estimation = CreateTensorEstimation(type);
+    t_registration::ICPConvergenceCriteria criteria(0.0, 0.0, kICPIterations);
+
+    // Warm up.
+    t_registration::RegistrationResult result = t_registration::RegistrationICP(
+            source, target, max_distance, init, *estimation, criteria);
+
+    utility::Timer timer;
+    double total_ms = 0.0;
+    for (auto _ : state) {
+        timer.Start();
+        result = t_registration::RegistrationICP(
+                source, target, max_distance, init, *estimation, criteria);
+        core::cuda::Synchronize();
+        timer.Stop();
+        total_ms += timer.GetDuration();
+    }
+    ReportRegistration(state, total_ms, kICPIterations, result,
+                       "iteration_ms");
+}
+
+void LegacyRANSACFeatureMatching(benchmark::State& state) {
+    int voxel_mm = static_cast<int>(state.range(0));
+    const RegistrationPair& pair = GetRegistrationPair(voxel_mm);
+    const auto& features = GetFPFHFeatures(voxel_mm);
+    double max_distance = 1.5 * pair.voxel_size_;
+    registration::CorrespondenceCheckerBasedOnEdgeLength edge_checker(0.9);
+    registration::CorrespondenceCheckerBasedOnDistance distance_checker(
+            max_distance);
+    auto run = [&]() {
+        return registration::RegistrationRANSACBasedOnFeatureMatching(
+                pair.source_, pair.target_, features.first, features.second,
+                true, max_distance,
+                registration::TransformationEstimationPointToPoint(false), 3,
+                {edge_checker, distance_checker},
+                registration::RANSACConvergenceCriteria(kRANSACIterations,
+                                                        1.0));
+    };
+
+    registration::RegistrationResult result = run();
+    utility::Timer timer;
+    double total_ms = 0.0;
+    for (auto _ : state) {
+        timer.Start();
+        result = run();
+        timer.Stop();
+        total_ms += timer.GetDuration();
+    }
+    ReportRegistration(state, total_ms * 1000.0, kRANSACIterations, result,
+                       "hypothesis_us");
+}
+
+void TensorRANSACFeatureMatching(benchmark::State& state,
+                                 const core::Device& device) {
+    int voxel_mm = static_cast<int>(state.range(0));
+    const RegistrationPair& pair = GetRegistrationPair(voxel_mm);
+    const auto& features = GetFPFHFeatures(voxel_mm);
+    double max_distance = 1.5 * pair.voxel_size_;
+    t::geometry::PointCloud source = t::geometry::PointCloud::
+            FromLegacyPointCloud(pair.source_, core::Dtype::Float32, device);
+    t::geometry::PointCloud target = t::geometry::PointCloud::
+            FromLegacyPointCloud(pair.target_, core::Dtype::Float32, device);
+    core::Tensor source_features =
+            core::eigen_converter::EigenMatrixToTensor(features.first.data_)
+                    .T()
+                    .To(core::Dtype::Float32)
+                    .Copy(device);
+    core::Tensor target_features =
+            core::eigen_converter::EigenMatrixToTensor(features.second.data_)
+                    .T()
+                    .To(core::Dtype::Float32)
+                    .Copy(device);
+    // Matching is part of the timed run, as in the legacy benchmark.
+    auto run = [&]() {
+        t_registration::CorrespondenceSet corres =
+                t_registration::CorrespondencesFromFeatures(
+                        source_features, target_features, true);
+        return t_registration::RegistrationRANSACBasedOnCorrespondence(
+                source, target, corres, max_distance, 3, 0.9,
+                t_registration::RANSACConvergenceCriteria(kRANSACIterations,
+                                                          1.0));
+    };
+
+    t_registration::RegistrationResult result = run();
+    utility::Timer timer;
+    double total_ms = 0.0;
+    for (auto _ : state) {
+        timer.Start();
+        result = run();
+        core::cuda::Synchronize();
+        timer.Stop();
+        total_ms += timer.GetDuration();
+    }
+    ReportRegistration(state, total_ms * 1000.0, kRANSACIterations, result,
+                       "hypothesis_us");
+}
+
+void LegacyFastGlobalRegistration(benchmark::State& state) {
+    int voxel_mm = static_cast<int>(state.range(0));
+    const RegistrationPair& pair = GetRegistrationPair(voxel_mm);
+    const auto& features = GetFPFHFeatures(voxel_mm);
+    registration::FastGlobalRegistrationOption option(
+            1.4, true, true, 0.5 * pair.voxel_size_);
+
+    registration::RegistrationResult result;
+    for (auto _ : state) {
+        result = registration::FastGlobalRegistration(
+                pair.source_, pair.target_, features.first, features.second,
+                option);
+    }
+    state.counters["fitness"] = result.fitness_;
+}
+
+void TensorFastGlobalRegistration(benchmark::State& state,
+                                  const core::Device& device) {
+    int voxel_mm = static_cast<int>(state.range(0));
+    const RegistrationPair& pair = GetRegistrationPair(voxel_mm);
+    const auto& features = GetFPFHFeatures(voxel_mm);
+    t::geometry::PointCloud source = t::geometry::PointCloud::
+            FromLegacyPointCloud(pair.source_, core::Dtype::Float32, device);
+    t::geometry::PointCloud target = t::geometry::PointCloud::
+            FromLegacyPointCloud(pair.target_, core::Dtype::Float32, device);
+    core::Tensor source_features =
+            core::eigen_converter::EigenMatrixToTensor(features.first.data_)
+                    .T()
+                    .To(core::Dtype::Float32)
+                    .Copy(device);
+    core::Tensor target_features =
+            core::eigen_converter::EigenMatrixToTensor(features.second.data_)
+                    .T()
+                    .To(core::Dtype::Float32)
+                    .Copy(device);
+    t_registration::FastGlobalRegistrationOption option(
+            1.4, true, true, 0.5 * pair.voxel_size_);
+
+    // Warm up.
+    t_registration::RegistrationResult result =
+            t_registration::FastGlobalRegistration(
+                    source, target, source_features, target_features, option);
+    for (auto _ : state) {
+        result = t_registration::FastGlobalRegistration(
+                source, target, source_features, target_features, option);
+        core::cuda::Synchronize();
+    }
+    state.counters["fitness"] = result.fitness_;
+}
+
+void LegacyComputeFPFHFeature(benchmark::State& state) {
+    const RegistrationPair& pair =
+            GetRegistrationPair(static_cast<int>(state.range(0)));
+    geometry::KDTreeSearchParamHybrid param(5 * pair.voxel_size_, kFPFHMaxNN);
+    for (auto _ : state) {
+        auto feature = registration::ComputeFPFHFeature(pair.source_, param);
+    }
+    state.counters["points"] = static_cast<double>(pair.source_.points_.size());
+}
+
+void TensorComputeFPFHFeature(benchmark::State& state,
+                              const core::Device& device) {
+    const RegistrationPair& pair =
+            GetRegistrationPair(static_cast<int>(state.range(0)));
+    t::geometry::PointCloud source = t::geometry::PointCloud::
+            FromLegacyPointCloud(pair.source_, core::Dtype::Float32, device);
+
+    // Warm up.
+    core::Tensor feature = t_registration::ComputeFPFHFeature(
+            source, kFPFHMaxNN, 5 * pair.voxel_size_);
+    for (auto _ : state) {
+        feature = t_registration::ComputeFPFHFeature(source, kFPFHMaxNN,
+                                                     5 * pair.voxel_size_);
+        core::cuda::Synchronize();
+    }
+    state.counters["points"] = static_cast<double>(pair.source_.points_.size());
+}
+
+BENCHMARK_CAPTURE(LegacyICP,
+                  PointToPoint,
+                  registration::TransformationEstimationType::PointToPoint)
+        ->Apply(ICPArgs)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(LegacyICP,
+                  PointToPlane,
+                  registration::TransformationEstimationType::PointToPlane)
+        ->Apply(ICPArgs)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(LegacyICP,
+                  ColoredICP,
+                  registration::TransformationEstimationType::ColoredICP)
+        ->Apply(ICPArgs)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(TensorICP,
+                  PointToPoint_CPU,
+                  t_registration::TransformationEstimationType::PointToPoint,
+                  core::Device("CPU:0"))
+        ->Apply(ICPArgs)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(TensorICP,
+                  PointToPlane_CPU,
+                  t_registration::TransformationEstimationType::PointToPlane,
+                  core::Device("CPU:0"))
+        ->Apply(ICPArgs)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(TensorICP,
+                  ColoredICP_CPU,
+                  t_registration::TransformationEstimationType::ColoredICP,
+                  core::Device("CPU:0"))
+        ->Apply(ICPArgs)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(LegacyRANSACFeatureMatching)
+        ->Apply(GlobalArgs)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(TensorRANSACFeatureMatching, CPU, core::Device("CPU:0"))
+        ->Apply(GlobalArgs)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(LegacyFastGlobalRegistration)
+        ->Apply(GlobalArgs)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(TensorFastGlobalRegistration, CPU, core::Device("CPU:0"))
+        ->Apply(GlobalArgs)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(LegacyComputeFPFHFeature)
+        ->Apply(GlobalArgs)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(TensorComputeFPFHFeature, CPU, core::Device("CPU:0"))
+        ->Apply(GlobalArgs)
+        ->Unit(benchmark::kMillisecond);
+
+#ifdef BUILD_CUDA_MODULE
+BENCHMARK_CAPTURE(TensorICP,
+                  PointToPoint_CUDA,
+                  t_registration::TransformationEstimationType::PointToPoint,
+                  core::Device("CUDA:0"))
+        ->Apply(ICPArgs)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(TensorICP,
+                  PointToPlane_CUDA,
+                  t_registration::TransformationEstimationType::PointToPlane,
+                  core::Device("CUDA:0"))
+        ->Apply(ICPArgs)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(TensorICP,
+                  ColoredICP_CUDA,
+                  t_registration::TransformationEstimationType::ColoredICP,
+                  core::Device("CUDA:0"))
+        ->Apply(ICPArgs)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(TensorRANSACFeatureMatching, CUDA, core::Device("CUDA:0"))
+        ->Apply(GlobalArgs)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(TensorFastGlobalRegistration, CUDA, core::Device("CUDA:0"))
+        ->Apply(GlobalArgs)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(TensorComputeFPFHFeature, CUDA, core::Device("CUDA:0"))
+        ->Apply(GlobalArgs)
+        ->Unit(benchmark::kMillisecond);
+#endif
+
+}  // namespace benchmarks
+}  // namespace open3d
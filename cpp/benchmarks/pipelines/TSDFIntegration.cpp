@@ -0,0 +1,368 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdlib>
+
+#include "open3d/camera/PinholeCameraIntrinsic.h"
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/EigenConverter.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/geometry/RGBDImage.h"
+#include "open3d/io/ImageIO.h"
+#include "open3d/io/PinholeCameraTrajectoryIO.h"
+#include "open3d/pipelines/integration/ScalableTSDFVolume.h"
+#include "open3d/pipelines/integration/UniformTSDFVolume.h"
+#include "open3d/t/geometry/TSDFVoxelGrid.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/Timer.h"
+
+namespace open3d {
+namespace benchmarks {
+
+namespace {
+
+/// RGB-D sequence in the layout of examples/test_data/RGBD: depth/%05d.png,
+/// color/%05d.jpg and the camera poses in odometry.log, captured with the
+/// PrimeSense default intrinsics. The bundled sequence is used by default;
+/// set OPEN3D_BENCHMARK_RGBD_DIR to a downloaded sequence in the same layout
+/// for longer runs.
+struct RGBDSequence {
+    std::vector<geometry::Image> depths_;
+    std::vector<geometry::Image> colors_;
+    std::vector<Eigen::Matrix4d> extrinsics_;
+    camera::PinholeCameraIntrinsic intrinsic_ = camera::PinholeCameraIntrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+};
+
+const RGBDSequence& GetRGBDSequence() {
+    static RGBDSequence sequence = []() {
+        const char* env_dir = std::getenv("OPEN3D_BENCHMARK_RGBD_DIR");
+        std::string dir = env_dir != nullptr
+                                  ? std::string(env_dir)
+                                  : std::string(TEST_DATA_DIR) + "/RGBD";
+        auto trajectory = io::CreatePinholeCameraTrajectoryFromFile(
+                dir + "/odometry.log");
+
+        RGBDSequence sequence;
+        for (size_t i = 0; i < trajectory->parameters_.size(); ++i) {
+            auto depth = io::CreateImageFromFile(
+                    fmt::format("{}/depth/{:05d}.png", dir, i));
+            auto color = io::CreateImageFromFile(
+                    fmt::format("{}/color/{:05d}.jpg", dir, i));
+            if (depth->IsEmpty() || color->IsEmpty()) {
+                utility::LogError("Unable to read frame {} of {}.", i, dir);
+            }
+            sequence.depths_.push_back(*depth);
+            sequence.colors_.push_back(*color);
+            sequence.extrinsics_.push_back(
+                    trajectory->parameters_[i].extrinsic_);
+        }
+        utility::LogInfo("Loaded {} RGB-D frames from {}.",
+                         sequence.depths_.size(), dir);
+        return sequence;
+    }();
+    return sequence;
+}
+
+/// Report the 50th, 90th and 99th percentiles of per-frame latencies.
+void ReportLatencies(benchmark::State& state, std::vector<double> latencies) {
+    if (latencies.empty()) {
+        return;
+    }
+    std::sort(latencies.begin(), latencies.end());
+    auto percentile = [&latencies](double p) {
+        size_t i = static_cast<size_t>(p * (latencies.size() - 1) + 0.5);
+        return latencies[i];
+    };
+    state.counters["p50_ms"] = percentile(0.5);
+    state.counters["p90_ms"] = percentile(0.9);
+    state.counters["p99_ms"] = percentile(0.99);
+}
+
+/// Benchmark arguments: voxel size in millimeters and block resolution.
+void TSDFArgs(benchmark::internal::Benchmark* b) {
+    b->ArgNames({"voxel_mm", "block_res"});
+    b->Args({8, 16})->Args({5, 16})->Args({8, 8})->Args({5, 32});
+}
+
+/// Truncation of 4 cm, within the half block size the TSDFVoxelGrid accepts.
+float SDFTrunc(float voxel_size, int64_t block_resolution) {
+    return std::min(0.04f, 0.49f * voxel_size * block_resolution);
+}
+
+/// Tensor TSDF integration of the whole sequence, timed per frame.
+class TSDFVoxelGridIntegrator {
+public:
+    TSDFVoxelGridIntegrator(const benchmark::State& state,
+                            const core::Device& device)
+        : voxel_size_(state.range(0) * 0.001f),
+          block_resolution_(state.range(1)),
+          device_(device) {
+        const RGBDSequence& sequence = GetRGBDSequence();
+        auto focal_length = sequence.intrinsic_.GetFocalLength();
+        auto principal_point = sequence.intrinsic_.GetPrincipalPoint();
+        intrinsics_ = core::Tensor(
+                std::vector<float>({static_cast<float>(focal_length.first), 0,
+                                    static_cast<float>(principal_point.first),
+                                    0, static_cast<float>(focal_length.second),
+                                    static_cast<float>(principal_point.second),
+                                    0, 0, 1}),
+                {3, 3}, core::Dtype::Float32);
+        for (size_t i = 0; i < sequence.depths_.size(); ++i) {
+            depths_.push_back(t::geometry::Image::FromLegacyImage(
+                    sequence.depths_[i], device));
+            colors_.push_back(t::geometry::Image::FromLegacyImage(
+                    sequence.colors_[i], device));
+            extrinsics_.push_back(core::eigen_converter::EigenMatrixToTensor(
+                                          sequence.extrinsics_[i])
+                                          .To(core::Dtype::Float32));
+        }
+    }
+
+    /// Integrate all frames into a new voxel grid, appending per-frame
+    /// latencies in milliseconds to \p latencies.
+    t::geometry::TSDFVoxelGrid Integrate(std::vector<double>& latencies) {
+        t::geometry::TSDFVoxelGrid voxel_grid(
+                {{"tsdf", core::Dtype::Float32},
+                 {"weight", core::Dtype::UInt16},
+                 {"color", core::Dtype::UInt16}},
+                voxel_size_, SDFTrunc(voxel_size_, block_resolution_),
+                block_resolution_, 1000, device_);
+        utility::Timer timer;
+        for (size_t i = 0; i < depths_.size(); ++i) {
+            timer.Start();
+            voxel_grid.Integrate(depths_[i], colors_[i], intrinsics_,
+                                 extrinsics_[i]);
+            core::cuda::Synchronize();
+            timer.Stop();
+            latencies.push_back(timer.GetDuration());
+        }
+        return voxel_grid;
+    }
+
+    /// Memory of the allocated voxels in MB, at 12 bytes per voxel.
+    double MemoryMB(const t::geometry::TSDFVoxelGrid& voxel_grid) const {
+        return static_cast<double>(voxel_grid.GetActiveBlockCount() *
+                                   block_resolution_ * block_resolution_ *
+                                   block_resolution_ * 12) /
+               (1 << 20);
+    }
+
+private:
+    float voxel_size_;
+    int64_t block_resolution_;
+    core::Device device_;
+    core::Tensor intrinsics_;
+    std::vector<t::geometry::Image> depths_;
+    std::vector<t::geometry::Image> colors_;
+    std::vector<core::Tensor> extrinsics_;
+};
+
+/// Legacy scalable TSDF integration of the whole sequence, timed per frame.
+class ScalableTSDFVolumeIntegrator {
+public:
+    ScalableTSDFVolumeIntegrator(const benchmark::State& state)
+        : voxel_size_(state.range(0) * 0.001),
+          volume_unit_resolution_(static_cast<int>(state.range(1))) {
+        const RGBDSequence& sequence = GetRGBDSequence();
+        for (size_t i = 0; i < sequence.depths_.size(); ++i) {
+            rgbds_.push_back(*geometry::RGBDImage::CreateFromColorAndDepth(
+                    sequence.colors_[i], sequence.depths_[i], 1000.0, 3.0,
+                    false));
+        }
+    }
+
+    std::shared_ptr<pipelines::integration::ScalableTSDFVolume> Integrate(
+            std::vector<double>& latencies) {
+        auto volume =
+                std::make_shared<pipelines::integration::ScalableTSDFVolume>(
+                        voxel_size_,
+                        SDFTrunc(static_cast<float>(voxel_size_),
+                                 volume_unit_resolution_),
+                        pipelines::integration::TSDFVolumeColorType::RGB8,
+                        volume_unit_resolution_);
+        const RGBDSequence& sequence = GetRGBDSequence();
+        utility::Timer timer;
+        for (size_t i = 0; i < rgbds_.size(); ++i) {
+            timer.Start();
+            volume->Integrate(rgbds_[i], sequence.intrinsic_,
+                              sequence.extrinsics_[i]);
+            timer.Stop();
+            latencies.push_back(timer.GetDuration());
+        }
+        return volume;
+    }
+
+    /// Memory of the allocated voxels in MB.
+    double MemoryMB(
+            const pipelines::integration::ScalableTSDFVolume& volume) const {
+        int64_t unit_voxels = static_cast<int64_t>(volume_unit_resolution_) *
+                              volume_unit_resolution_ * volume_unit_resolution_;
+        return static_cast<double>(volume.volume_units_.size() * unit_voxels *
+                                   sizeof(geometry::TSDFVoxel)) /
+               (1 << 20);
+    }
+
+private:
+    double voxel_size_;
+    int volume_unit_resolution_;
+    std::vector<geometry::RGBDImage> rgbds_;
+};
+
+}  // namespace
+
+void TSDFVoxelGridIntegrate(benchmark::State& state,
+                            const core::Device& device) {
+    TSDFVoxelGridIntegrator integrator(state, device);
+    std::vector<double> latencies;
+
+    // Warm up.
+    t::geometry::TSDFVoxelGrid voxel_grid = integrator.Integrate(latencies);
+    latencies.clear();
+
+    for (auto _ : state) {
+        t::geometry::TSDFVoxelGrid voxel_grid = integrator.Integrate(latencies);
+    }
+    ReportLatencies(state, latencies);
+    state.counters["memory_MB"] = integrator.MemoryMB(voxel_grid);
+}
+
+void TSDFVoxelGridExtractSurfacePoints(benchmark::State& state,
+                                       const core::Device& device) {
+    TSDFVoxelGridIntegrator integrator(state, device);
+    std::vector<double> latencies;
+    t::geometry::TSDFVoxelGrid voxel_grid = integrator.Integrate(latencies);
+
+    int64_t num_points =
+            voxel_grid.ExtractSurfacePoints().GetPoints().GetLength();
+    for (auto _ : state) {
+        t::geometry::PointCloud pcd = voxel_grid.ExtractSurfacePoints();
+        core::cuda::Synchronize();
+    }
+    state.counters["points"] = static_cast<double>(num_points);
+    state.counters["memory_MB"] = integrator.MemoryMB(voxel_grid);
+}
+
+void TSDFVoxelGridExtractSurfaceMesh(benchmark::State& state,
+                                     const core::Device& device) {
+    TSDFVoxelGridIntegrator integrator(state, device);
+    std::vector<double> latencies;
+    t::geometry::TSDFVoxelGrid voxel_grid = integrator.Integrate(latencies);
+
+    int64_t num_triangles =
+            voxel_grid.ExtractSurfaceMesh().GetTriangles().GetLength();
+    for (auto _ : state) {
+        t::geometry::TriangleMesh mesh = voxel_grid.ExtractSurfaceMesh();
+        core::cuda::Synchronize();
+    }
+    state.counters["triangles"] = static_cast<double>(num_triangles);
+    state.counters["memory_MB"] = integrator.MemoryMB(voxel_grid);
+}
+
+void ScalableTSDFVolumeIntegrate(benchmark::State& state) {
+    ScalableTSDFVolumeIntegrator integrator(state);
+    std::vector<double> latencies;
+
+    // Warm up.
+    auto volume = integrator.Integrate(latencies);
+    latencies.clear();
+
+    for (auto _ : state) {
+        auto volume = integrator.Integrate(latencies);
+    }
+    ReportLatencies(state, latencies);
+    state.counters["memory_MB"] = integrator.MemoryMB(*volume);
+}
+
+void ScalableTSDFVolumeExtractPointCloud(benchmark::State& state) {
+    ScalableTSDFVolumeIntegrator integrator(state);
+    std::vector<double> latencies;
+    auto volume = integrator.Integrate(latencies);
+
+    size_t num_points = volume->ExtractPointCloud()->points_.size();
+    for (auto _ : state) {
+        auto pcd = volume->ExtractPointCloud();
+    }
+    state.counters["points"] = static_cast<double>(num_points);
+    state.counters["memory_MB"] = integrator.MemoryMB(*volume);
+}
+
+void ScalableTSDFVolumeExtractTriangleMesh(benchmark::State& state) {
+    ScalableTSDFVolumeIntegrator integrator(state);
+    std::vector<double> latencies;
+    auto volume = integrator.Integrate(latencies);
+
+    size_t num_triangles = volume->ExtractTriangleMesh()->triangles_.size();
+    for (auto _ : state) {
+        auto mesh = volume->ExtractTriangleMesh();
+    }
+    state.counters["triangles"] = static_cast<double>(num_triangles);
+    state.counters["memory_MB"] = integrator.MemoryMB(*volume);
+}
+
+BENCHMARK_CAPTURE(TSDFVoxelGridIntegrate, CPU, core::Device("CPU:0"))
+        ->Apply(TSDFArgs)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(TSDFVoxelGridExtractSurfacePoints,
+                  CPU,
+                  core::Device("CPU:0"))
+        ->Apply(TSDFArgs)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(TSDFVoxelGridExtractSurfaceMesh, CPU, core::Device("CPU:0"))
+        ->Apply(TSDFArgs)
+        ->Unit(benchmark::kMillisecond);
+
+#ifdef BUILD_CUDA_MODULE
+BENCHMARK_CAPTURE(TSDFVoxelGridIntegrate, CUDA, core::Device("CUDA:0"))
+        ->Apply(TSDFArgs)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(TSDFVoxelGridExtractSurfacePoints,
+                  CUDA,
+                  core::Device("CUDA:0"))
+        ->Apply(TSDFArgs)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(TSDFVoxelGridExtractSurfaceMesh,
+                  CUDA,
+                  core::Device("CUDA:0"))
+        ->Apply(TSDFArgs)
+        ->Unit(benchmark::kMillisecond);
+#endif
+
+BENCHMARK(ScalableTSDFVolumeIntegrate)
+        ->Apply(TSDFArgs)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(ScalableTSDFVolumeExtractPointCloud)
+        ->Apply(TSDFArgs)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(ScalableTSDFVolumeExtractTriangleMesh)
+        ->Apply(TSDFArgs)
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace benchmarks
+}  // namespace open3d
@@ -0,0 +1,186 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/TSDFVoxelGrid.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+static const int kSphereWidth = 320;
+static const int kSphereHeight = 240;
+static const float kSphereRadius = 0.5f;
+static const float kSphereDepth = 1.5f;
+
+/// Depth image in millimeters of a sphere of radius kSphereRadius centered at
+/// (\p dx, 0, kSphereDepth) in camera coordinates, with the intrinsics of
+/// SphereIntrinsics.
+static Image SphereDepth(float dx, const core::Device& device) {
+    const float f = 300.0f, cx = kSphereWidth / 2.0f, cy = kSphereHeight / 2.0f;
+    std::vector<uint16_t> depth(kSphereWidth * kSphereHeight, 0);
+    for (int v = 0; v < kSphereHeight; ++v) {
+        for (int u = 0; u < kSphereWidth; ++u) {
+            // Ray (x, y, 1) intersected with the sphere: the depth is the
+            // smallest root t of |t * ray - center|^2 = radius^2.
+            float x = (u - cx) / f, y = (v - cy) / f;
+            float a = x * x + y * y + 1.0f;
+            float b = x * dx + kSphereDepth;
+            float c = dx * dx + kSphereDepth * kSphereDepth -
+                      kSphereRadius * kSphereRadius;
+            float delta = b * b - a * c;
+            if (delta >= 0) {
+                float t = (b - std::sqrt(delta)) / a;
+                depth[v * kSphereWidth + u] =
+                        static_cast<uint16_t>(std::round(t * 1000.0f));
+            }
+        }
+    }
+    return Image(core::Tensor(depth, {kSphereHeight, kSphereWidth, 1},
+                              core::Dtype::UInt16, device));
+}
+
+static core::Tensor SphereIntrinsics() {
+    return core::Tensor(std::vector<float>{300.0f, 0.0f, kSphereWidth / 2.0f,
+                                           0.0f, 300.0f, kSphereHeight / 2.0f,
+                                           0.0f, 0.0f, 1.0f},
+                        {3, 3}, core::Dtype::Float32);
+}
+
+/// Integrates views of a sphere taken from the cameras translated along x,
+/// with the voxels of \p attr_dtype_map. Reports the bytes per voxel, the
+/// memory of the allocated voxels and the RMS distance of the extracted
+/// surface points to the sphere, to compare the precision of the voxel
+/// types.
+void IntegrateSphere(
+        benchmark::State& state,
+        const std::unordered_map<std::string, core::Dtype>& attr_dtype_map,
+        const core::Device& device) {
+    const int num_frames = 10;
+    const float voxel_size = 0.008f;
+    const int64_t block_resolution = 16;
+
+    core::Tensor intrinsics = SphereIntrinsics();
+    std::vector<Image> depths, colors;
+    std::vector<core::Tensor> extrinsics;
+    for (int i = 0; i < num_frames; ++i) {
+        // The camera at (tx, 0, 0) sees the sphere at (-tx, 0, depth).
+        float tx = 0.01f * (i - num_frames / 2);
+        depths.push_back(SphereDepth(-tx, device));
+        colors.push_back(Image(core::Tensor::Full(
+                {kSphereHeight, kSphereWidth, 3}, 0.5f, core::Dtype::Float32,
+                device)));
+        extrinsics.push_back(
+                core::Tensor(std::vector<float>{1, 0, 0, -tx, 0, 1, 0, 0, 0,
+                                                0, 1, 0, 0, 0, 0, 1},
+                             {4, 4}, core::Dtype::Float32));
+    }
+    bool has_color = attr_dtype_map.count("color") != 0;
+    int64_t byte_size = 0;
+    for (auto& kv : attr_dtype_map) {
+        // Colors have 3 channels.
+        byte_size += kv.second.ByteSize() * (kv.first == "color" ? 3 : 1);
+    }
+
+    auto integrate = [&]() {
+        TSDFVoxelGrid voxel_grid(attr_dtype_map, voxel_size, 0.04f,
+                                 block_resolution, 1000, device);
+        for (int i = 0; i < num_frames; ++i) {
+            if (has_color) {
+                voxel_grid.Integrate(depths[i], colors[i], intrinsics,
+                                     extrinsics[i]);
+            } else {
+                voxel_grid.Integrate(depths[i], intrinsics, extrinsics[i]);
+            }
+        }
+        return voxel_grid;
+    };
+
+    // Warm up.
+    TSDFVoxelGrid voxel_grid = integrate();
+
+    for (auto _ : state) {
+        TSDFVoxelGrid voxel_grid = integrate();
+    }
+
+    core::Tensor points = voxel_grid.ExtractSurfacePoints().GetPoints().To(
+            core::Dtype::Float64);
+    core::Tensor center(std::vector<double>{0, 0, kSphereDepth}, {1, 3},
+                        core::Dtype::Float64, device);
+    core::Tensor error =
+            (points - center).Mul(points - center).Sum({1}).Sqrt() -
+            kSphereRadius;
+    double rms = 0.0;
+    if (points.GetLength() > 0) {
+        rms = std::sqrt(error.Mul(error).Sum({0}).Item<double>() /
+                        points.GetLength());
+    }
+
+    int64_t memory = voxel_grid.GetActiveBlockCount() * block_resolution *
+                     block_resolution * block_resolution * byte_size;
+    state.counters["bytes_per_voxel"] = static_cast<double>(byte_size);
+    state.counters["memory_MB"] = static_cast<double>(memory) / (1 << 20);
+    state.counters["rms_mm"] = rms * 1000.0;
+}
+
+#define TSDF_VOXEL_BENCHMARKS(DEVICE_NAME, DEVICE)                           \
+    BENCHMARK_CAPTURE(IntegrateSphere, Float32_Float32_##DEVICE_NAME,        \
+                      {{"tsdf", core::Dtype::Float32},                       \
+                       {"weight", core::Dtype::Float32}},                    \
+                      DEVICE)                                                \
+            ->Unit(benchmark::kMillisecond);                                 \
+    BENCHMARK_CAPTURE(IntegrateSphere, Float32_UInt16_UInt16_##DEVICE_NAME,  \
+                      {{"tsdf", core::Dtype::Float32},                       \
+                       {"weight", core::Dtype::UInt16},                      \
+                       {"color", core::Dtype::UInt16}},                      \
+                      DEVICE)                                                \
+            ->Unit(benchmark::kMillisecond);                                 \
+    BENCHMARK_CAPTURE(IntegrateSphere, Int16_UInt16_##DEVICE_NAME,           \
+                      {{"tsdf", core::Dtype::Int16},                         \
+                       {"weight", core::Dtype::UInt16}},                     \
+                      DEVICE)                                                \
+            ->Unit(benchmark::kMillisecond);                                 \
+    BENCHMARK_CAPTURE(IntegrateSphere, Int16_UInt16_UInt8_##DEVICE_NAME,     \
+                      {{"tsdf", core::Dtype::Int16},                         \
+                       {"weight", core::Dtype::UInt16},                      \
+                       {"color", core::Dtype::UInt8}},                       \
+                      DEVICE)                                                \
+            ->Unit(benchmark::kMillisecond);
+
+TSDF_VOXEL_BENCHMARKS(CPU, core::Device("CPU:0"))
+
+#ifdef BUILD_CUDA_MODULE
+TSDF_VOXEL_BENCHMARKS(CUDA, core::Device("CUDA:0"))
+#endif
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
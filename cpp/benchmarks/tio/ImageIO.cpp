@@ -0,0 +1,162 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/t/io/ImageIO.h"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+#include "open3d/geometry/Image.h"
+#include "open3d/io/ImageIO.h"
+#include "open3d/t/geometry/Image.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/FileSystem.h"
+
+namespace open3d {
+namespace benchmarks {
+
+namespace {
+
+/// An image file format and the pixel layout written to it.
+struct TImageFormat {
+    std::string extension;
+    int num_channels;
+    int bytes_per_channel;
+};
+
+/// Writes a \p width x \p height image of \p format and returns its file
+/// name. The pixels are a gradient with noise, which compresses like a
+/// camera frame rather than a constant image.
+std::string WriteTestImage(const TImageFormat& format,
+                           int width,
+                           int height) {
+    geometry::Image image;
+    image.Prepare(width, height, format.num_channels,
+                  format.bytes_per_channel);
+    std::mt19937 rng(0);
+    std::uniform_int_distribution<int> noise(0, 15);
+    for (int v = 0; v < height; ++v) {
+        for (int u = 0; u < width; ++u) {
+            for (int c = 0; c < format.num_channels; ++c) {
+                int value = (u + v + 64 * c) % 224 + noise(rng);
+                uint8_t* pixel = image.data_.data() +
+                                 ((v * width + u) * format.num_channels + c) *
+                                         format.bytes_per_channel;
+                if (format.bytes_per_channel == 2) {
+                    // Depth in millimeters up to about 4m.
+                    *reinterpret_cast<uint16_t*>(pixel) =
+                            static_cast<uint16_t>(value * 16);
+                } else {
+                    *pixel = static_cast<uint8_t>(value);
+                }
+            }
+        }
+    }
+    const std::string filename = utility::filesystem::GetWorkingDirectory() +
+                                 "/TImageIO." + format.extension;
+    if (!io::WriteImage(filename, image)) {
+        utility::LogError("Failed to write {}.", filename);
+    }
+    return filename;
+}
+
+int64_t GetFileSizeInBytes(const std::string& filename) {
+    utility::filesystem::CFile file;
+    if (!file.Open(filename, "rb")) {
+        utility::LogError("Failed to open {}.", filename);
+    }
+    return file.GetFileSize();
+}
+
+void ReportImageIO(benchmark::State& state,
+                   const std::string& filename,
+                   const TImageFormat& format) {
+    const int64_t num_bytes = state.range(0) * state.range(1) *
+                              format.num_channels * format.bytes_per_channel;
+    // bytes_per_second counts decoded bytes, file_MB the encoded size.
+    state.SetBytesProcessed(state.iterations() * num_bytes);
+    state.counters["file_MB"] =
+            static_cast<double>(GetFileSizeInBytes(filename)) / (1 << 20);
+}
+
+}  // namespace
+
+/// Decodes a state.range(0) x state.range(1) image into a reused tensor image,
+/// as a frame loop does.
+void TReadImageInto(benchmark::State& state, const TImageFormat& format) {
+    const std::string filename = WriteTestImage(
+            format, static_cast<int>(state.range(0)),
+            static_cast<int>(state.range(1)));
+    t::geometry::Image image;
+
+    for (auto _ : state) {
+        if (!t::io::ReadImageInto(filename, image)) {
+            utility::LogError("Failed to read {}.", filename);
+        }
+    }
+    ReportImageIO(state, filename, format);
+    utility::filesystem::RemoveFile(filename);
+}
+
+/// Decodes the same image with the legacy reader, for reference.
+void LegacyReadImage(benchmark::State& state, const TImageFormat& format) {
+    const std::string filename = WriteTestImage(
+            format, static_cast<int>(state.range(0)),
+            static_cast<int>(state.range(1)));
+
+    for (auto _ : state) {
+        geometry::Image image;
+        if (!io::ReadImage(filename, image)) {
+            utility::LogError("Failed to read {}.", filename);
+        }
+    }
+    ReportImageIO(state, filename, format);
+    utility::filesystem::RemoveFile(filename);
+}
+
+/// VGA, 720p and 1080p frames.
+static void TImageIOArgs(benchmark::internal::Benchmark* b) {
+    b->Args({640, 480});
+    b->Args({1280, 720});
+    b->Args({1920, 1080});
+}
+
+#define TIMAGE_IO_BENCHMARK(NAME, ...)                                       \
+    BENCHMARK_CAPTURE(TReadImageInto, NAME, TImageFormat{__VA_ARGS__})       \
+            ->Apply(TImageIOArgs)                                            \
+            ->Unit(benchmark::kMillisecond);                                 \
+    BENCHMARK_CAPTURE(LegacyReadImage, NAME, TImageFormat{__VA_ARGS__})      \
+            ->Apply(TImageIOArgs)                                            \
+            ->Unit(benchmark::kMillisecond);
+
+TIMAGE_IO_BENCHMARK(PNG_RGB, "png", 3, 1)
+TIMAGE_IO_BENCHMARK(PNG_Depth16, "png", 1, 2)
+TIMAGE_IO_BENCHMARK(JPG_RGB, "jpg", 3, 1)
+
+}  // namespace benchmarks
+}  // namespace open3d
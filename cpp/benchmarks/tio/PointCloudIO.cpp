@@ -0,0 +1,236 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/t/io/PointCloudIO.h"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/FileSystem.h"
+
+namespace open3d {
+namespace benchmarks {
+
+namespace {
+
+/// Attributes of the benchmark point clouds, from the narrowest to the widest
+/// record.
+enum class PointAttributes : int {
+    Points = 0,             ///< Points only.
+    PointsNormalsColors,    ///< Points, normals and colors.
+    PointsNormalsColorsEx,  ///< As above, plus intensities and labels.
+};
+
+/// A point cloud file format and its encoding.
+struct TPointCloudFormat {
+    std::string extension;
+    bool write_ascii;
+    bool compressed;
+    /// Dtype of the floating point attributes. The XYZI writer only takes
+    /// Float64 clouds.
+    core::Dtype dtype = core::Dtype::Float32;
+    /// Reads every attribute after reading the file. O3DT files are memory
+    /// mapped, so without it a read only maps the file.
+    bool touch = false;
+};
+
+/// Returns the size of \p filename in bytes.
+int64_t GetFileSizeInBytes(const std::string& filename) {
+    utility::filesystem::CFile file;
+    if (!file.Open(filename, "rb")) {
+        utility::LogError("Failed to open {}.", filename);
+    }
+    return file.GetFileSize();
+}
+
+/// Returns a point cloud of \p num_points random points, with values spread
+/// over their whole range so that compression does not get a free pass.
+t::geometry::PointCloud CreatePointCloud(int64_t num_points,
+                                         PointAttributes attributes,
+                                         core::Dtype dtype) {
+    std::mt19937 rng(0);
+    auto random_tensor = [&rng, dtype](int64_t rows, int64_t cols,
+                                       float min_val, float max_val) {
+        std::uniform_real_distribution<float> dist(min_val, max_val);
+        std::vector<float> values(rows * cols);
+        for (float& value : values) {
+            value = dist(rng);
+        }
+        return core::Tensor(values, {rows, cols}, core::Dtype::Float32)
+                .To(dtype);
+    };
+
+    t::geometry::PointCloud pcd(random_tensor(num_points, 3, -10.0f, 10.0f));
+    if (attributes == PointAttributes::Points) {
+        return pcd;
+    }
+    pcd.SetPointNormals(random_tensor(num_points, 3, -1.0f, 1.0f));
+    pcd.SetPointColors(random_tensor(num_points, 3, 0.0f, 1.0f));
+    if (attributes == PointAttributes::PointsNormalsColors) {
+        return pcd;
+    }
+    pcd.SetPointAttr("intensities", random_tensor(num_points, 1, 0.0f, 1.0f));
+    std::uniform_int_distribution<int32_t> label_dist(0, 255);
+    std::vector<int32_t> labels(num_points);
+    for (int32_t& label : labels) {
+        label = label_dist(rng);
+    }
+    pcd.SetPointAttr("labels", core::Tensor(labels, {num_points, 1},
+                                            core::Dtype::Int32));
+    return pcd;
+}
+
+std::string GetFileName(const TPointCloudFormat& format) {
+    return utility::filesystem::GetWorkingDirectory() + "/TPointCloudIO." +
+           format.extension;
+}
+
+void WriteOrThrow(const std::string& filename,
+                  const t::geometry::PointCloud& pcd,
+                  const TPointCloudFormat& format) {
+    if (!t::io::WritePointCloud(
+                filename, pcd,
+                {format.write_ascii, format.compressed, false})) {
+        utility::LogError("Failed to write {}.", filename);
+    }
+}
+
+}  // namespace
+
+/// Reads a point cloud of state.range(0) points with the attributes
+/// state.range(1) from \p format. bytes_per_second is the file size over the
+/// read time.
+void TReadPointCloud(benchmark::State& state,
+                     const TPointCloudFormat& format) {
+    const std::string filename = GetFileName(format);
+    WriteOrThrow(filename,
+                 CreatePointCloud(state.range(0),
+                                  static_cast<PointAttributes>(state.range(1)),
+                                  format.dtype),
+                 format);
+    const int64_t file_size = GetFileSizeInBytes(filename);
+    // The tensor readers do not remove non-finite points.
+    const open3d::io::ReadPointCloudOption params("auto", false, false, false);
+
+    for (auto _ : state) {
+        t::geometry::PointCloud pcd;
+        if (!t::io::ReadPointCloud(filename, pcd, params)) {
+            utility::LogError("Failed to read {}.", filename);
+        }
+        if (format.touch) {
+            for (const auto& kv : pcd.GetPointAttr()) {
+                benchmark::DoNotOptimize(kv.second.Sum({0}));
+            }
+        }
+    }
+    utility::filesystem::RemoveFile(filename);
+
+    state.SetBytesProcessed(state.iterations() * file_size);
+    state.counters["file_MB"] = static_cast<double>(file_size) / (1 << 20);
+}
+
+/// Writes a point cloud of state.range(0) points with the attributes
+/// state.range(1) to \p format. bytes_per_second is the file size over the
+/// write time.
+void TWritePointCloud(benchmark::State& state,
+                      const TPointCloudFormat& format) {
+    const std::string filename = GetFileName(format);
+    const t::geometry::PointCloud pcd = CreatePointCloud(
+            state.range(0), static_cast<PointAttributes>(state.range(1)),
+            format.dtype);
+
+    for (auto _ : state) {
+        WriteOrThrow(filename, pcd, format);
+    }
+    const int64_t file_size = GetFileSizeInBytes(filename);
+    utility::filesystem::RemoveFile(filename);
+
+    state.SetBytesProcessed(state.iterations() * file_size);
+    state.counters["file_MB"] = static_cast<double>(file_size) / (1 << 20);
+}
+
+/// Point counts from 16K to 1M, with every attribute set.
+static void TPointCloudIOArgs(benchmark::internal::Benchmark* b) {
+    for (int64_t num_points = 1 << 14; num_points <= 1 << 20;
+         num_points <<= 3) {
+        for (int attributes = 0; attributes <= 2; ++attributes) {
+            b->Args({num_points, attributes});
+        }
+    }
+}
+
+/// The XYZ family stores a fixed set of attributes, so only the point count
+/// varies. The clouds have all the attributes, for XYZI intensities.
+static void TPointCloudIOPointsArgs(benchmark::internal::Benchmark* b) {
+    for (int64_t num_points = 1 << 14; num_points <= 1 << 20;
+         num_points <<= 3) {
+        b->Args({num_points,
+                 static_cast<int>(PointAttributes::PointsNormalsColorsEx)});
+    }
+}
+
+#define TPOINTCLOUD_IO_BENCHMARK(NAME, ARGS, ...)                      \
+    BENCHMARK_CAPTURE(TReadPointCloud, NAME,                           \
+                      TPointCloudFormat{__VA_ARGS__})                  \
+            ->Apply(ARGS)                                              \
+            ->Unit(benchmark::kMillisecond);                           \
+    BENCHMARK_CAPTURE(TWritePointCloud, NAME,                          \
+                      TPointCloudFormat{__VA_ARGS__})                  \
+            ->Apply(ARGS)                                              \
+            ->Unit(benchmark::kMillisecond);
+
+TPOINTCLOUD_IO_BENCHMARK(PLY_ASCII, TPointCloudIOArgs, "ply", true, false)
+TPOINTCLOUD_IO_BENCHMARK(PLY_Binary, TPointCloudIOArgs, "ply", false, false)
+TPOINTCLOUD_IO_BENCHMARK(PLY_Gzip, TPointCloudIOArgs, "ply.gz", false, false)
+TPOINTCLOUD_IO_BENCHMARK(PCD_ASCII, TPointCloudIOArgs, "pcd", true, false)
+TPOINTCLOUD_IO_BENCHMARK(PCD_Binary, TPointCloudIOArgs, "pcd", false, false)
+TPOINTCLOUD_IO_BENCHMARK(PCD_BinaryCompressed, TPointCloudIOArgs, "pcd",
+                         false, true)
+TPOINTCLOUD_IO_BENCHMARK(O3DT, TPointCloudIOArgs, "o3dt", false, false,
+                         core::Dtype::Float32, true)
+BENCHMARK_CAPTURE(TReadPointCloud,
+                  O3DT_Mapped,
+                  TPointCloudFormat{"o3dt", false, false})
+        ->Apply(TPointCloudIOArgs)
+        ->Unit(benchmark::kMillisecond);
+TPOINTCLOUD_IO_BENCHMARK(XYZ, TPointCloudIOPointsArgs, "xyz", true, false,
+                         core::Dtype::Float64)
+TPOINTCLOUD_IO_BENCHMARK(XYZI, TPointCloudIOPointsArgs, "xyzi", true, false,
+                         core::Dtype::Float64)
+TPOINTCLOUD_IO_BENCHMARK(XYZN, TPointCloudIOPointsArgs, "xyzn", true, false,
+                         core::Dtype::Float64)
+TPOINTCLOUD_IO_BENCHMARK(XYZRGB, TPointCloudIOPointsArgs, "xyzrgb", true,
+                         false, core::Dtype::Float64)
+TPOINTCLOUD_IO_BENCHMARK(PTS, TPointCloudIOPointsArgs, "pts", true, false,
+                         core::Dtype::Float64)
+
+}  // namespace benchmarks
+}  // namespace open3d
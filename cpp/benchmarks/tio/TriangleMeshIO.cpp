@@ -0,0 +1,157 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/t/io/TriangleMeshIO.h"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+#include "open3d/geometry/TriangleMesh.h"
+#include "open3d/t/geometry/TriangleMesh.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/FileSystem.h"
+
+namespace open3d {
+namespace benchmarks {
+
+namespace {
+
+/// A triangle mesh file format and its encoding.
+struct TTriangleMeshFormat {
+    std::string extension;
+    bool write_ascii;
+};
+
+/// Returns a sphere of about 2 * \p resolution^2 vertices with normals and
+/// random colors.
+t::geometry::TriangleMesh CreateMesh(int resolution) {
+    auto legacy_mesh = geometry::TriangleMesh::CreateSphere(1.0, resolution);
+    legacy_mesh->ComputeVertexNormals();
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> dist(0.0, 1.0);
+    legacy_mesh->vertex_colors_.resize(legacy_mesh->vertices_.size());
+    for (auto& color : legacy_mesh->vertex_colors_) {
+        color = Eigen::Vector3d(dist(rng), dist(rng), dist(rng));
+    }
+    return t::geometry::TriangleMesh::FromLegacyTriangleMesh(*legacy_mesh);
+}
+
+std::string GetFileName(const TTriangleMeshFormat& format) {
+    return utility::filesystem::GetWorkingDirectory() + "/TTriangleMeshIO." +
+           format.extension;
+}
+
+void WriteOrThrow(const std::string& filename,
+                  const t::geometry::TriangleMesh& mesh,
+                  const TTriangleMeshFormat& format) {
+    if (!t::io::WriteTriangleMesh(filename, mesh, format.write_ascii)) {
+        utility::LogError("Failed to write {}.", filename);
+    }
+}
+
+int64_t GetFileSizeInBytes(const std::string& filename) {
+    utility::filesystem::CFile file;
+    if (!file.Open(filename, "rb")) {
+        utility::LogError("Failed to open {}.", filename);
+    }
+    return file.GetFileSize();
+}
+
+void ReportMeshIO(benchmark::State& state,
+                  const std::string& filename,
+                  const t::geometry::TriangleMesh& mesh) {
+    const int64_t file_size = GetFileSizeInBytes(filename);
+    state.SetBytesProcessed(state.iterations() * file_size);
+    state.counters["file_MB"] = static_cast<double>(file_size) / (1 << 20);
+    state.counters["vertices"] =
+            static_cast<double>(mesh.GetVertices().GetLength());
+}
+
+}  // namespace
+
+/// Reads a sphere of resolution state.range(0) from \p format.
+/// bytes_per_second is the file size over the read time.
+void TReadTriangleMesh(benchmark::State& state,
+                       const TTriangleMeshFormat& format) {
+    const std::string filename = GetFileName(format);
+    const t::geometry::TriangleMesh mesh =
+            CreateMesh(static_cast<int>(state.range(0)));
+    WriteOrThrow(filename, mesh, format);
+
+    for (auto _ : state) {
+        t::geometry::TriangleMesh read_mesh;
+        if (!t::io::ReadTriangleMesh(filename, read_mesh)) {
+            utility::LogError("Failed to read {}.", filename);
+        }
+    }
+    ReportMeshIO(state, filename, mesh);
+    utility::filesystem::RemoveFile(filename);
+}
+
+/// Writes a sphere of resolution state.range(0) to \p format.
+/// bytes_per_second is the file size over the write time.
+void TWriteTriangleMesh(benchmark::State& state,
+                        const TTriangleMeshFormat& format) {
+    const std::string filename = GetFileName(format);
+    const t::geometry::TriangleMesh mesh =
+            CreateMesh(static_cast<int>(state.range(0)));
+
+    for (auto _ : state) {
+        WriteOrThrow(filename, mesh, format);
+    }
+    ReportMeshIO(state, filename, mesh);
+    utility::filesystem::RemoveFile(filename);
+}
+
+/// Spheres of about 20K, 320K and 1.3M vertices.
+static void TTriangleMeshIOArgs(benchmark::internal::Benchmark* b) {
+    for (int resolution = 100; resolution <= 800; resolution *= 4) {
+        b->Args({resolution});
+    }
+}
+
+#define TTRIANGLEMESH_IO_BENCHMARK(NAME, ...)                      \
+    BENCHMARK_CAPTURE(TReadTriangleMesh, NAME,                     \
+                      TTriangleMeshFormat{__VA_ARGS__})            \
+            ->Apply(TTriangleMeshIOArgs)                           \
+            ->Unit(benchmark::kMillisecond);                       \
+    BENCHMARK_CAPTURE(TWriteTriangleMesh, NAME,                    \
+                      TTriangleMeshFormat{__VA_ARGS__})            \
+            ->Apply(TTriangleMeshIOArgs)                           \
+            ->Unit(benchmark::kMillisecond);
+
+TTRIANGLEMESH_IO_BENCHMARK(PLY_ASCII, "ply", true)
+TTRIANGLEMESH_IO_BENCHMARK(PLY_Binary, "ply", false)
+TTRIANGLEMESH_IO_BENCHMARK(PLY_Gzip, "ply.gz", false)
+TTRIANGLEMESH_IO_BENCHMARK(STL, "stl", false)
+TTRIANGLEMESH_IO_BENCHMARK(OBJ, "obj", true)
+TTRIANGLEMESH_IO_BENCHMARK(OFF, "off", true)
+TTRIANGLEMESH_IO_BENCHMARK(O3DT, "o3dt", false)
+
+}  // namespace benchmarks
+}  // namespace open3d
@@ -32,6 +32,8 @@
 #include <intrin.h>
 #pragma intrinsic(_InterlockedExchangeAdd)
 #pragma intrinsic(_InterlockedExchangeAdd64)
+#pragma intrinsic(_InterlockedCompareExchange)
+#pragma intrinsic(_InterlockedCompareExchange64)
 #endif
 
 namespace open3d {
@@ -57,5 +59,56 @@ inline uint64_t AtomicFetchAddRelaxed(uint64_t* address, uint64_t val) {
 #endif
 }
 
+/// Atomically sets *address to min(*address, val) and returns the old value.
+inline uint32_t AtomicFetchMinRelaxed(uint32_t* address, uint32_t val) {
+#ifdef __GNUC__
+    uint32_t old = __atomic_load_n(address, __ATOMIC_RELAXED);
+    while (val < old &&
+           !__atomic_compare_exchange_n(address, &old, val, true,
+                                        __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+    }
+    return old;
+#elif _MSC_VER
+    uint32_t old = *address;
+    while (val < old) {
+        uint32_t prev = uint32_t(_InterlockedCompareExchange(
+                reinterpret_cast<volatile long*>(address), long(val),
+                long(old)));
+        if (prev == old) {
+            break;
+        }
+        old = prev;
+    }
+    return old;
+#else
+    static_assert(false, "AtomicFetchMinRelaxed not implemented for platform");
+#endif
+}
+
+inline uint64_t AtomicFetchMinRelaxed(uint64_t* address, uint64_t val) {
+#ifdef __GNUC__
+    uint64_t old = __atomic_load_n(address, __ATOMIC_RELAXED);
+    while (val < old &&
+           !__atomic_compare_exchange_n(address, &old, val, true,
+                                        __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+    }
+    return old;
+#elif _MSC_VER
+    uint64_t old = *address;
+    while (val < old) {
+        uint64_t prev = uint64_t(_InterlockedCompareExchange64(
+                reinterpret_cast<volatile __int64*>(address), __int64(val),
+                __int64(old)));
+        if (prev == old) {
+            break;
+        }
+        old = prev;
+    }
+    return old;
+#else
+    static_assert(false, "AtomicFetchMinRelaxed not implemented for platform");
+#endif
+}
+
 }  // namespace core
 }  // namespace open3d
@@ -29,12 +29,248 @@
 #include "open3d/utility/Console.h"
 
 #ifdef BUILD_CUDA_MODULE
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
 #include "open3d/core/CUDAState.cuh"
 #include "open3d/core/MemoryManager.h"
 #endif
 
 namespace open3d {
 namespace core {
+
+#ifdef BUILD_CUDA_MODULE
+static thread_local cudaStream_t current_stream = 0;
+
+cudaStream_t GetCUDACurrentStream() { return current_stream; }
+
+void SetCUDACurrentStream(cudaStream_t stream) { current_stream = stream; }
+
+CUDAStream::CUDAStream(const Device& device) : device_(device) {
+    if (device.GetType() != Device::DeviceType::CUDA) {
+        utility::LogError("CUDAStream: {} is not a CUDA device.",
+                          device.ToString());
+    }
+    CUDADeviceSwitcher switcher(device);
+    OPEN3D_CUDA_CHECK(cudaStreamCreate(&stream_));
+}
+
+CUDAStream::~CUDAStream() {
+    CUDADeviceSwitcher switcher(device_);
+    // Returns immediately, the resources are released once the submitted work
+    // is done.
+    cudaStreamDestroy(stream_);
+}
+
+void CUDAStream::Synchronize() const {
+    OPEN3D_CUDA_CHECK(cudaStreamSynchronize(stream_));
+}
+
+CUDAEvent::CUDAEvent() {
+    OPEN3D_CUDA_CHECK(
+            cudaEventCreateWithFlags(&event_, cudaEventDisableTiming));
+}
+
+CUDAEvent::~CUDAEvent() { cudaEventDestroy(event_); }
+
+void CUDAEvent::Record(cudaStream_t stream) {
+    OPEN3D_CUDA_CHECK(cudaEventRecord(event_, stream));
+}
+
+void CUDAEvent::Wait(cudaStream_t stream) const {
+    OPEN3D_CUDA_CHECK(cudaStreamWaitEvent(stream, event_, 0));
+}
+
+void CUDAEvent::Synchronize() const {
+    OPEN3D_CUDA_CHECK(cudaEventSynchronize(event_));
+}
+
+bool CUDAEvent::IsCompleted() const {
+    cudaError_t err = cudaEventQuery(event_);
+    if (err == cudaErrorNotReady) {
+        // Not a failure, reset the last error.
+        cudaGetLastError();
+        return false;
+    }
+    OPEN3D_CUDA_CHECK(err);
+    return true;
+}
+
+namespace {
+
+/// Objects kept alive until the work submitted before an event is done, see
+/// ReleaseAfterCurrentStream().
+class PendingReleases {
+public:
+    static PendingReleases& GetInstance() {
+        // Never destroyed, the objects still pending at exit must not be
+        // freed after the CUDA runtime has shut down.
+        static PendingReleases* instance = new PendingReleases();
+        return *instance;
+    }
+
+    void Add(const Device& device, std::vector<std::shared_ptr<void>> objects) {
+        std::unique_ptr<CUDAEvent> event;
+        {
+            CUDADeviceSwitcher switcher(device);
+            event.reset(new CUDAEvent());
+            event->Record(GetCUDACurrentStream());
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        ReleaseCompleted();
+        pending_.emplace_back(std::move(event), std::move(objects));
+    }
+
+    void Release() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ReleaseCompleted();
+    }
+
+private:
+    void ReleaseCompleted() {
+        for (auto it = pending_.begin(); it != pending_.end();) {
+            if (it->first->IsCompleted()) {
+                it = pending_.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    std::mutex mutex_;
+    std::list<std::pair<std::unique_ptr<CUDAEvent>,
+                        std::vector<std::shared_ptr<void>>>>
+            pending_;
+};
+
+}  // namespace
+
+void ReleaseAfterCurrentStream(const Device& device,
+                               std::vector<std::shared_ptr<void>> objects) {
+    PendingReleases::GetInstance().Add(device, std::move(objects));
+}
+
+namespace {
+
+/// Device spans whose timings are resolved when the trace is collected.
+class CUDATraceRegistry {
+public:
+    static CUDATraceRegistry& GetInstance() {
+        static CUDATraceRegistry instance;
+        return instance;
+    }
+
+    /// Records, once per device, an anchor event together with the host time
+    /// at which it completed. Device events are placed on the host timeline
+    /// relative to it.
+    void EnsureAnchor(int device_id) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (anchors_.count(device_id)) {
+            return;
+        }
+        cudaEvent_t anchor;
+        OPEN3D_CUDA_CHECK(cudaEventCreate(&anchor));
+        OPEN3D_CUDA_CHECK(cudaEventRecord(anchor, 0));
+        OPEN3D_CUDA_CHECK(cudaEventSynchronize(anchor));
+        anchors_[device_id] = {anchor, utility::trace::NowMicroseconds()};
+    }
+
+    void Add(const char* name,
+             int device_id,
+             cudaEvent_t begin,
+             cudaEvent_t end) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (pending_.size() >= kMaxPending) {
+            // Drop the span rather than growing without bound.
+            cudaEventDestroy(begin);
+            cudaEventDestroy(end);
+            return;
+        }
+        pending_.push_back({name, device_id, begin, end});
+    }
+
+    void Flush() {
+        std::vector<PendingSpan> pending;
+        std::unordered_map<int, std::pair<cudaEvent_t, int64_t>> anchors;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            pending.swap(pending_);
+            anchors = anchors_;
+        }
+        for (const PendingSpan& span : pending) {
+            CUDADeviceSwitcher switcher(Device(Device::DeviceType::CUDA,
+                                               span.device_id));
+            const auto& anchor = anchors.at(span.device_id);
+            float begin_ms = 0, end_ms = 0;
+            OPEN3D_CUDA_CHECK(cudaEventSynchronize(span.end));
+            OPEN3D_CUDA_CHECK(
+                    cudaEventElapsedTime(&begin_ms, anchor.first, span.begin));
+            OPEN3D_CUDA_CHECK(
+                    cudaEventElapsedTime(&end_ms, anchor.first, span.end));
+            utility::trace::RecordEvent(
+                    span.name,
+                    anchor.second + static_cast<int64_t>(begin_ms * 1000),
+                    anchor.second + static_cast<int64_t>(end_ms * 1000),
+                    utility::trace::DeviceTrack(
+                            fmt::format("CUDA:{}", span.device_id)));
+            cudaEventDestroy(span.begin);
+            cudaEventDestroy(span.end);
+        }
+    }
+
+private:
+    CUDATraceRegistry() {
+        utility::trace::AddFlushCallback([this]() { Flush(); });
+    }
+
+    struct PendingSpan {
+        const char* name;
+        int device_id;
+        cudaEvent_t begin;
+        cudaEvent_t end;
+    };
+
+    static constexpr size_t kMaxPending = 1 << 16;
+    std::mutex mutex_;
+    std::vector<PendingSpan> pending_;
+    std::unordered_map<int, std::pair<cudaEvent_t, int64_t>> anchors_;
+};
+
+}  // namespace
+
+CUDAScopedTrace::CUDAScopedTrace(const char* name) : name_(name) {
+    if (!utility::trace::IsEnabled()) {
+        return;
+    }
+    OPEN3D_CUDA_CHECK(cudaGetDevice(&device_id_));
+    CUDATraceRegistry::GetInstance().EnsureAnchor(device_id_);
+    OPEN3D_CUDA_CHECK(cudaEventCreate(&begin_));
+    OPEN3D_CUDA_CHECK(cudaEventRecord(begin_, GetCUDACurrentStream()));
+}
+
+CUDAScopedTrace::~CUDAScopedTrace() {
+    if (begin_ == nullptr) {
+        return;
+    }
+    // Destructors must not throw, drop the span on errors instead.
+    cudaEvent_t end;
+    if (cudaEventCreate(&end) != cudaSuccess) {
+        cudaEventDestroy(begin_);
+        return;
+    }
+    if (cudaEventRecord(end, GetCUDACurrentStream()) != cudaSuccess) {
+        cudaEventDestroy(begin_);
+        cudaEventDestroy(end);
+        return;
+    }
+    CUDATraceRegistry::GetInstance().Add(name_, device_id_, begin_, end);
+}
+#endif
+
 namespace cuda {
 
 int DeviceCount() {
@@ -67,6 +303,37 @@ void ReleaseCache() {
 #endif
 }
 
+void Synchronize() {
+#ifdef BUILD_CUDA_MODULE
+    OPEN3D_CUDA_CHECK(cudaStreamSynchronize(GetCUDACurrentStream()));
+    PendingReleases::GetInstance().Release();
+#endif
+}
+
+intptr_t GetCurrentStreamHandle() {
+#ifdef BUILD_CUDA_MODULE
+    cudaStream_t stream = GetCUDACurrentStream();
+    if (stream == 0) {
+        return reinterpret_cast<intptr_t>(cudaStreamLegacy);
+    }
+    return reinterpret_cast<intptr_t>(stream);
+#else
+    return 1;
+#endif
+}
+
+void StreamWaitCurrent(intptr_t stream_handle) {
+#ifdef BUILD_CUDA_MODULE
+    if (stream_handle == GetCurrentStreamHandle()) {
+        return;
+    }
+    // The wait stays enqueued after the event is destroyed.
+    CUDAEvent event;
+    event.Record(GetCUDACurrentStream());
+    event.Wait(reinterpret_cast<cudaStream_t>(stream_handle));
+#endif
+}
+
 }  // namespace cuda
 }  // namespace core
 }  // namespace open3d
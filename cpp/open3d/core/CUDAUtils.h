@@ -32,7 +32,13 @@
 
 #pragma once
 
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "open3d/core/Device.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/Trace.h"
 
 #ifdef BUILD_CUDA_MODULE
 
@@ -49,6 +55,14 @@
 #define OPEN3D_GET_LAST_CUDA_ERROR(message) \
     __OPEN3D_GET_LAST_CUDA_ERROR(message, __FILE__, __LINE__)
 
+#ifdef BUILD_TRACING
+#define OPEN3D_TRACE_CUDA_SCOPE(name)                        \
+    ::open3d::core::CUDAScopedTrace OPEN3D_TRACE_CONCAT( \
+            open3d_cuda_trace_scope_, __LINE__)(name)
+#else
+#define OPEN3D_TRACE_CUDA_SCOPE(name)
+#endif
+
 #else  // #ifdef BUILD_CUDA_MODULE
 
 #define OPEN3D_HOST_DEVICE
@@ -56,6 +70,7 @@
 #define OPEN3D_ASSERT_HOST_DEVICE_LAMBDA(type)
 #define OPEN3D_CUDA_CHECK(err)
 #define OPEN3D_GET_LAST_CUDA_ERROR(message)
+#define OPEN3D_TRACE_CUDA_SCOPE(name)
 
 #endif  // #ifdef BUILD_CUDA_MODULE
 
@@ -103,6 +118,129 @@ inline int GetCUDACurrentDeviceTextureAlignment() {
     }
     return value;
 }
+
+/// Returns the CUDA stream used by the current thread for kernel launches and
+/// asynchronous copies. Defaults to the legacy default stream (0).
+cudaStream_t GetCUDACurrentStream();
+
+/// Sets the CUDA stream used by the current thread. Prefer CUDAScopedStream,
+/// which restores the previous stream.
+void SetCUDACurrentStream(cudaStream_t stream);
+
+/// \class CUDAStream
+///
+/// Owns a CUDA stream created on a device. The stream synchronizes with the
+/// legacy default stream, so work submitted outside of it stays correctly
+/// ordered, while work on different CUDAStreams can overlap.
+class CUDAStream {
+public:
+    explicit CUDAStream(const Device& device);
+    ~CUDAStream();
+
+    CUDAStream(CUDAStream const&) = delete;
+    void operator=(CUDAStream const&) = delete;
+
+    cudaStream_t Get() const { return stream_; }
+
+    const Device& GetDevice() const { return device_; }
+
+    /// Blocks the host until all work submitted to the stream is done.
+    void Synchronize() const;
+
+private:
+    Device device_;
+    cudaStream_t stream_;
+};
+
+/// \class CUDAScopedStream
+///
+/// Sets the current CUDA stream of the current thread within the scope. The
+/// previous stream is restored once leaving the scope.
+///
+/// Example:
+/// ```cpp
+/// CUDAStream stream(Device("CUDA:0"));
+/// {
+///     CUDAScopedStream scoped_stream(stream.Get());
+///     // Kernels and Tensor::CopyAsync are submitted to stream.
+///     Tensor frame_cuda = frame.CopyAsync(Device("CUDA:0"));
+/// }
+/// stream.Synchronize();
+/// ```
+class CUDAScopedStream {
+public:
+    explicit CUDAScopedStream(cudaStream_t stream)
+        : prev_stream_(GetCUDACurrentStream()) {
+        SetCUDACurrentStream(stream);
+    }
+
+    ~CUDAScopedStream() { SetCUDACurrentStream(prev_stream_); }
+
+    CUDAScopedStream(CUDAScopedStream const&) = delete;
+    void operator=(CUDAScopedStream const&) = delete;
+
+private:
+    cudaStream_t prev_stream_;
+};
+
+/// \class CUDAEvent
+///
+/// Marks a point in a CUDA stream, used to synchronize the host or other
+/// streams with the work submitted before it.
+class CUDAEvent {
+public:
+    CUDAEvent();
+    ~CUDAEvent();
+
+    CUDAEvent(CUDAEvent const&) = delete;
+    void operator=(CUDAEvent const&) = delete;
+
+    /// Records the event after the work currently submitted to \p stream.
+    void Record(cudaStream_t stream = GetCUDACurrentStream());
+
+    /// Makes the future work submitted to \p stream wait for the event.
+    /// Does not block the host.
+    void Wait(cudaStream_t stream = GetCUDACurrentStream()) const;
+
+    /// Blocks the host until the event has completed.
+    void Synchronize() const;
+
+    /// Returns true if the event has completed.
+    bool IsCompleted() const;
+
+    cudaEvent_t Get() const { return event_; }
+
+private:
+    cudaEvent_t event_;
+};
+
+/// Keeps \p objects alive until the work submitted so far to the current CUDA
+/// stream is done, e.g. the buffers of an asynchronous copy, such that their
+/// memory cannot be reused by another allocation while the copy is running.
+/// \p device is the device of the current stream. The objects are released
+/// by later calls and by cuda::Synchronize() once the work is done.
+void ReleaseAfterCurrentStream(const Device& device,
+                               std::vector<std::shared_ptr<void>> objects);
+
+/// \class CUDAScopedTrace
+///
+/// Records the device time of the work submitted to the current CUDA stream
+/// within the scope as a trace event on the "CUDA:<id>" track. Timings are
+/// resolved when the trace is collected, so the host is not blocked. Use
+/// OPEN3D_TRACE_CUDA_SCOPE, which is compiled out without BUILD_TRACING.
+class CUDAScopedTrace {
+public:
+    explicit CUDAScopedTrace(const char* name);
+    ~CUDAScopedTrace();
+
+    CUDAScopedTrace(CUDAScopedTrace const&) = delete;
+    void operator=(CUDAScopedTrace const&) = delete;
+
+private:
+    const char* name_;
+    int device_id_ = -1;
+    cudaEvent_t begin_ = nullptr;
+};
 #endif
 
 namespace cuda {
@@ -111,6 +249,21 @@ int DeviceCount();
 bool IsAvailable();
 void ReleaseCache();
 
+/// Blocks the host until all work submitted to the current CUDA stream of the
+/// current thread is done. No-op if built without CUDA.
+void Synchronize();
+
+/// Returns the current CUDA stream of the current thread as an integer handle,
+/// following the DLPack and __cuda_array_interface__ convention where 1 is the
+/// legacy default stream. Returns 1 if built without CUDA.
+intptr_t GetCurrentStreamHandle();
+
+/// Makes the future work submitted to the stream \p stream_handle, given in
+/// the same convention as GetCurrentStreamHandle(), wait for the work
+/// submitted so far to the current CUDA stream of the current thread. Does not
+/// block the host. No-op if built without CUDA.
+void StreamWaitCurrent(intptr_t stream_handle);
+
 }  // namespace cuda
 }  // namespace core
 }  // namespace open3d
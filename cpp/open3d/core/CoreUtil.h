@@ -31,17 +31,17 @@
 namespace open3d {
 namespace core {
 
-#define DISPATCH_FLOAT32_FLOAT64_DTYPE(DTYPE, ...)       \
-    [&] {                                                \
-        if (DTYPE == Dtype::Float32) {                   \
-            using scalar_t = float;                      \
-            return __VA_ARGS__();                        \
-        } else if (DTYPE == Dtype::Float64) {            \
-            using scalar_t = double;                     \
-            return __VA_ARGS__();                        \
-        } else {                                         \
-            utility::LogError("Unsupported data type."); \
-        }                                                \
+#define DISPATCH_FLOAT32_FLOAT64_DTYPE(DTYPE, ...)               \
+    [&] {                                                        \
+        if (DTYPE == open3d::core::Dtype::Float32) {             \
+            using scalar_t = float;                              \
+            return __VA_ARGS__();                                \
+        } else if (DTYPE == open3d::core::Dtype::Float64) {      \
+            using scalar_t = double;                             \
+            return __VA_ARGS__();                                \
+        } else {                                                 \
+            open3d::utility::LogError("Unsupported data type."); \
+        }                                                        \
     }()
 
 }  // namespace core
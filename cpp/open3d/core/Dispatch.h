@@ -54,6 +54,12 @@
         } else if (DTYPE == open3d::core::Dtype::Float64) { \
             using scalar_t = double;                        \
             return __VA_ARGS__();                           \
+        } else if (DTYPE == open3d::core::Dtype::Int8) {    \
+            using scalar_t = int8_t;                        \
+            return __VA_ARGS__();                           \
+        } else if (DTYPE == open3d::core::Dtype::Int16) {   \
+            using scalar_t = int16_t;                       \
+            return __VA_ARGS__();                           \
         } else if (DTYPE == open3d::core::Dtype::Int32) {   \
             using scalar_t = int32_t;                       \
             return __VA_ARGS__();                           \
@@ -80,3 +86,26 @@
             DISPATCH_DTYPE_TO_TEMPLATE(DTYPE, __VA_ARGS__); \
         }                                                   \
     }()
+
+/// Same as DISPATCH_DTYPE_TO_TEMPLATE, but also dispatches Dtype::Float16 to
+/// open3d::core::Float16. Float16 is a storage type that converts to float
+/// for arithmetic, so only kernels written against that contract opt in.
+#define DISPATCH_DTYPE_TO_TEMPLATE_WITH_FLOAT16(DTYPE, ...) \
+    [&] {                                                   \
+        if (DTYPE == open3d::core::Dtype::Float16) {        \
+            using scalar_t = open3d::core::Float16;         \
+            return __VA_ARGS__();                           \
+        } else {                                            \
+            DISPATCH_DTYPE_TO_TEMPLATE(DTYPE, __VA_ARGS__); \
+        }                                                   \
+    }()
+
+#define DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_FLOAT16(DTYPE, ...)  \
+    [&] {                                                             \
+        if (DTYPE == open3d::core::Dtype::Float16) {                  \
+            using scalar_t = open3d::core::Float16;                   \
+            return __VA_ARGS__();                                     \
+        } else {                                                      \
+            DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(DTYPE, __VA_ARGS__); \
+        }                                                             \
+    }()
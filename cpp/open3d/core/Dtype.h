@@ -31,6 +31,7 @@
 
 #include "open3d/Macro.h"
 #include "open3d/core/Dispatch.h"
+#include "open3d/core/Float16.h"
 #include "open3d/utility/Console.h"
 
 namespace open3d {
@@ -39,8 +40,11 @@ namespace core {
 class OPEN3D_API Dtype {
 public:
     static const Dtype Undefined;
+    static const Dtype Float16;
     static const Dtype Float32;
     static const Dtype Float64;
+    static const Dtype Int8;
+    static const Dtype Int16;
     static const Dtype Int32;
     static const Dtype Int64;
     static const Dtype UInt8;
@@ -87,6 +91,11 @@ private:
     char name_[max_name_len_];  // MSVC warns if std::string is exported to DLL.
 };
 
+template <>
+inline const Dtype Dtype::FromType<core::Float16>() {
+    return Dtype::Float16;
+}
+
 template <>
 inline const Dtype Dtype::FromType<float>() {
     return Dtype::Float32;
@@ -97,11 +106,21 @@ inline const Dtype Dtype::FromType<double>() {
     return Dtype::Float64;
 }
 
+template <>
+inline const Dtype Dtype::FromType<int8_t>() {
+    return Dtype::Int8;
+}
+
 template <>
 inline const Dtype Dtype::FromType<int32_t>() {
     return Dtype::Int32;
 }
 
+template <>
+inline const Dtype Dtype::FromType<int16_t>() {
+    return Dtype::Int16;
+}
+
 template <>
 inline const Dtype Dtype::FromType<int64_t>() {
     return Dtype::Int64;
@@ -0,0 +1,206 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+#include "open3d/core/CUDAUtils.h"
+
+#ifdef __CUDACC__
+#include <cuda_fp16.h>
+#endif
+
+namespace open3d {
+namespace core {
+
+/// IEEE 754 half precision floating point number.
+///
+/// Float16 is a storage type. Arithmetic converts the operands to float, so
+/// expressions are evaluated in FP32 and only rounded to FP16 when the result
+/// is stored. The conversions use the CUDA intrinsics in device code and an
+/// exact software implementation with round-to-nearest-even on the host.
+class Float16 {
+public:
+    Float16() = default;
+
+    OPEN3D_HOST_DEVICE Float16(float value) : bits_(FloatToBits(value)) {}
+
+    OPEN3D_HOST_DEVICE operator float() const { return BitsToFloat(bits_); }
+
+    OPEN3D_HOST_DEVICE Float16& operator+=(float other) {
+        return *this = static_cast<float>(*this) + other;
+    }
+    OPEN3D_HOST_DEVICE Float16& operator-=(float other) {
+        return *this = static_cast<float>(*this) - other;
+    }
+    OPEN3D_HOST_DEVICE Float16& operator*=(float other) {
+        return *this = static_cast<float>(*this) * other;
+    }
+    OPEN3D_HOST_DEVICE Float16& operator/=(float other) {
+        return *this = static_cast<float>(*this) / other;
+    }
+
+    /// Creates a Float16 from its binary representation.
+    static constexpr Float16 FromBits(uint16_t bits) {
+        return Float16(bits, FromBitsTag());
+    }
+
+    /// Returns the binary representation.
+    OPEN3D_HOST_DEVICE uint16_t ToBits() const { return bits_; }
+
+private:
+    struct FromBitsTag {};
+    constexpr Float16(uint16_t bits, FromBitsTag) : bits_(bits) {}
+
+    static OPEN3D_HOST_DEVICE uint16_t FloatToBits(float value) {
+#if defined(__CUDA_ARCH__)
+        return __half_as_ushort(__float2half_rn(value));
+#else
+        uint32_t f;
+        std::memcpy(&f, &value, sizeof(f));
+        const uint16_t sign = static_cast<uint16_t>((f >> 16) & 0x8000u);
+        const uint32_t abs = f & 0x7fffffffu;
+
+        if (abs > 0x7f800000u) {
+            // NaN, keep it quiet.
+            return sign | 0x7e00u;
+        }
+        if (abs >= 0x47800000u) {
+            // Inf, or finite values that overflow the largest exponent.
+            return sign | 0x7c00u;
+        }
+
+        uint32_t h;
+        uint32_t rem;
+        uint32_t halfway;
+        if (abs < 0x38800000u) {
+            // Subnormal half or zero. The half mantissa counts multiples of
+            // 2^-24, which is the float mantissa shifted by 126 - exponent.
+            const uint32_t shift = 126u - (abs >> 23);
+            if (shift > 24u) {
+                return sign;
+            }
+            const uint32_t mant = (abs & 0x7fffffu) | 0x800000u;
+            h = mant >> shift;
+            rem = mant & ((1u << shift) - 1u);
+            halfway = 1u << (shift - 1u);
+        } else {
+            // Normal half. Rebias the exponent from 127 to 15.
+            h = (((abs >> 23) - 112u) << 10) | ((abs & 0x7fffffu) >> 13);
+            rem = abs & 0x1fffu;
+            halfway = 0x1000u;
+        }
+        // Round to nearest even. A carry into the exponent is correct and
+        // may round up to Inf.
+        if (rem > halfway || (rem == halfway && (h & 1u))) {
+            ++h;
+        }
+        return sign | static_cast<uint16_t>(h);
+#endif
+    }
+
+    static OPEN3D_HOST_DEVICE float BitsToFloat(uint16_t bits) {
+#if defined(__CUDA_ARCH__)
+        return __half2float(__ushort_as_half(bits));
+#else
+        const uint32_t sign = static_cast<uint32_t>(bits & 0x8000u) << 16;
+        uint32_t exp = (bits >> 10) & 0x1fu;
+        uint32_t mant = bits & 0x3ffu;
+        uint32_t f;
+        if (exp == 0) {
+            if (mant == 0) {
+                f = sign;
+            } else {
+                // Subnormal half, normalize the mantissa.
+                exp = 113;
+                while (!(mant & 0x400u)) {
+                    mant <<= 1;
+                    --exp;
+                }
+                f = sign | (exp << 23) | ((mant & 0x3ffu) << 13);
+            }
+        } else if (exp == 0x1f) {
+            f = sign | 0x7f800000u | (mant << 13);
+        } else {
+            f = sign | ((exp + 112u) << 23) | (mant << 13);
+        }
+        float value;
+        std::memcpy(&value, &f, sizeof(value));
+        return value;
+#endif
+    }
+
+    uint16_t bits_;
+};
+
+static_assert(sizeof(Float16) == 2, "Float16 must be 2 bytes.");
+
+}  // namespace core
+}  // namespace open3d
+
+namespace std {
+
+template <>
+class numeric_limits<open3d::core::Float16> {
+public:
+    using Float16 = open3d::core::Float16;
+
+    static constexpr bool is_specialized = true;
+    static constexpr bool is_signed = true;
+    static constexpr bool is_integer = false;
+    static constexpr bool is_exact = false;
+    static constexpr bool has_infinity = true;
+    static constexpr bool has_quiet_NaN = true;
+    static constexpr int digits = 11;
+    static constexpr int max_exponent = 16;
+    static constexpr int min_exponent = -13;
+
+    static constexpr Float16 min() { return Float16::FromBits(0x0400); }
+    static constexpr Float16 lowest() { return Float16::FromBits(0xfbff); }
+    static constexpr Float16 max() { return Float16::FromBits(0x7bff); }
+    static constexpr Float16 epsilon() { return Float16::FromBits(0x1400); }
+    static constexpr Float16 infinity() { return Float16::FromBits(0x7c00); }
+    static constexpr Float16 quiet_NaN() { return Float16::FromBits(0x7e00); }
+    static constexpr Float16 denorm_min() { return Float16::FromBits(0x0001); }
+};
+
+}  // namespace std
+
+namespace fmt {
+
+template <>
+struct formatter<open3d::core::Float16> : formatter<float> {
+    template <typename FormatContext>
+    auto format(const open3d::core::Float16& value, FormatContext& ctx)
+            -> decltype(ctx.out()) {
+        return formatter<float>::format(static_cast<float>(value), ctx);
+    }
+};
+
+}  // namespace fmt
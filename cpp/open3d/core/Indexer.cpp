@@ -225,6 +225,31 @@ bool Indexer::CanUse32BitIndexing() const {
     return true;
 }
 
+bool Indexer::IsContiguous() const {
+    auto is_contiguous = [&](const TensorRef& tr) {
+        for (int64_t dim = 0; dim < ndims_; dim++) {
+            // Size-1 dimensions never contribute to the offsets.
+            if (master_shape_[dim] > 1 &&
+                tr.byte_strides_[dim] !=
+                        master_strides_[dim] * tr.dtype_byte_size_) {
+                return false;
+            }
+        }
+        return true;
+    };
+    for (int64_t i = 0; i < num_inputs_; i++) {
+        if (!is_contiguous(inputs_[i])) {
+            return false;
+        }
+    }
+    for (int64_t i = 0; i < num_outputs_; i++) {
+        if (!is_contiguous(outputs_[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
 IndexerIterator Indexer::SplitTo32BitIndexing() const {
     return IndexerIterator(*this);
 }
@@ -280,6 +280,11 @@ public:
     /// Returns true iff the maximum_offsets in bytes are smaller than 2^31 - 1.
     bool CanUse32BitIndexing() const;
 
+    /// Returns true iff every input and output is laid out contiguously in the
+    /// master shape, i.e. without broadcasting or restriding. The byte offset
+    /// of a workload is then workload_idx * dtype_byte_size_ for each operand.
+    bool IsContiguous() const;
+
     /// Returns an iterator of Indexers, each of which can be indexed in 32
     /// bits.
     IndexerIterator SplitTo32BitIndexing() const;
@@ -0,0 +1,331 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/LazyTensor.h"
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+#include "open3d/core/ShapeUtil.h"
+#include "open3d/core/kernel/FusedEW.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+
+LazyTensor::LazyTensor(const Tensor& tensor)
+    : shape_(tensor.GetShape()),
+      dtype_(tensor.GetDtype()),
+      device_(tensor.GetDevice()) {
+    auto node = std::make_shared<Node>();
+    node->type_ = Node::Type::Leaf;
+    node->tensor_ = tensor;
+    node_ = node;
+}
+
+Tensor LazyTensor::Eval() const { return EvalNode(node_); }
+
+LazyTensor LazyTensor::Add(const LazyTensor& value) const {
+    return Binary(kernel::BinaryEWOpCode::Add, value);
+}
+
+LazyTensor LazyTensor::Sub(const LazyTensor& value) const {
+    return Binary(kernel::BinaryEWOpCode::Sub, value);
+}
+
+LazyTensor LazyTensor::Mul(const LazyTensor& value) const {
+    return Binary(kernel::BinaryEWOpCode::Mul, value);
+}
+
+LazyTensor LazyTensor::Div(const LazyTensor& value) const {
+    return Binary(kernel::BinaryEWOpCode::Div, value);
+}
+
+LazyTensor LazyTensor::Sqrt() const {
+    return Unary(kernel::UnaryEWOpCode::Sqrt);
+}
+
+LazyTensor LazyTensor::Sin() const { return Unary(kernel::UnaryEWOpCode::Sin); }
+
+LazyTensor LazyTensor::Cos() const { return Unary(kernel::UnaryEWOpCode::Cos); }
+
+LazyTensor LazyTensor::Neg() const { return Unary(kernel::UnaryEWOpCode::Neg); }
+
+LazyTensor LazyTensor::Exp() const { return Unary(kernel::UnaryEWOpCode::Exp); }
+
+LazyTensor LazyTensor::Abs() const { return Unary(kernel::UnaryEWOpCode::Abs); }
+
+LazyTensor LazyTensor::Floor() const {
+    return Unary(kernel::UnaryEWOpCode::Floor);
+}
+
+LazyTensor LazyTensor::Ceil() const {
+    return Unary(kernel::UnaryEWOpCode::Ceil);
+}
+
+LazyTensor LazyTensor::Round() const {
+    return Unary(kernel::UnaryEWOpCode::Round);
+}
+
+LazyTensor LazyTensor::Trunc() const {
+    return Unary(kernel::UnaryEWOpCode::Trunc);
+}
+
+LazyTensor LazyTensor::Unary(kernel::UnaryEWOpCode op_code) const {
+    if (op_code == kernel::UnaryEWOpCode::LogicalNot) {
+        utility::LogError("LazyTensor does not support boolean ops.");
+    }
+    if ((op_code == kernel::UnaryEWOpCode::Sqrt ||
+         op_code == kernel::UnaryEWOpCode::Sin ||
+         op_code == kernel::UnaryEWOpCode::Cos ||
+         op_code == kernel::UnaryEWOpCode::Exp) &&
+        dtype_ != Dtype::Float32 && dtype_ != Dtype::Float64) {
+        utility::LogError("Only supports Float32 and Float64, but {} is used.",
+                          dtype_.ToString());
+    }
+    auto node = std::make_shared<Node>();
+    node->type_ = Node::Type::Unary;
+    node->unary_op_code_ = op_code;
+    node->lhs_ = node_;
+    return LazyTensor(node, shape_, dtype_, device_);
+}
+
+LazyTensor LazyTensor::Binary(kernel::BinaryEWOpCode op_code,
+                              const LazyTensor& value) const {
+    if (kernel::s_boolean_binary_ew_op_codes.count(op_code) != 0) {
+        utility::LogError("LazyTensor does not support boolean ops.");
+    }
+    if (value.dtype_ != dtype_) {
+        utility::LogError("Dtype mismatch {} != {}.", dtype_.ToString(),
+                          value.dtype_.ToString());
+    }
+    if (value.device_ != device_) {
+        utility::LogError("Device mismatch {} != {}.", device_.ToString(),
+                          value.device_.ToString());
+    }
+    auto node = std::make_shared<Node>();
+    node->type_ = Node::Type::Binary;
+    node->binary_op_code_ = op_code;
+    node->lhs_ = node_;
+    node->rhs_ = value.node_;
+    return LazyTensor(node,
+                      shape_util::BroadcastedShape(shape_, value.shape_),
+                      dtype_, device_);
+}
+
+bool LazyTensor::FusedSize::Fits() const {
+    return num_instrs_ <= kernel::MAX_FUSED_EW_INSTRUCTIONS &&
+           max_stack_size_ <= kernel::MAX_FUSED_EW_STACK_SIZE &&
+           static_cast<int64_t>(inputs_.size()) <= MAX_INPUTS;
+}
+
+Tensor LazyTensor::EvalNode(const std::shared_ptr<const Node>& node) const {
+    if (node->type_ == Node::Type::Leaf) {
+        return node->tensor_;
+    } else if (node->type_ == Node::Type::Scalar) {
+        return Tensor::Full({}, node->scalar_, dtype_, device_);
+    }
+    EvaluatedNodes evaluated;
+    SplitNode(node, evaluated);
+    return EvalFused(node, evaluated);
+}
+
+LazyTensor::FusedSize LazyTensor::SplitNode(
+        const std::shared_ptr<const Node>& node,
+        EvaluatedNodes& evaluated) const {
+    FusedSize size;
+    auto evaluated_it = evaluated.find(node.get());
+    if (evaluated_it != evaluated.end()) {
+        size.num_instrs_ = 1;
+        size.max_stack_size_ = 1;
+        size.inputs_.push_back(evaluated_it->second);
+        return size;
+    }
+
+    // Evaluates an operand and returns the size of loading the result.
+    auto evaluate = [this, &evaluated](const std::shared_ptr<const Node>& n,
+                                       const FusedSize& n_size) {
+        if (n->type_ == Node::Type::Leaf || n->type_ == Node::Type::Scalar ||
+            evaluated.count(n.get()) != 0) {
+            return n_size;
+        }
+        FusedSize loaded;
+        loaded.num_instrs_ = 1;
+        loaded.max_stack_size_ = 1;
+        loaded.inputs_.push_back(EvalFused(n, evaluated));
+        evaluated[n.get()] = loaded.inputs_[0];
+        return loaded;
+    };
+
+    switch (node->type_) {
+        case Node::Type::Leaf:
+            size.num_instrs_ = 1;
+            size.max_stack_size_ = 1;
+            size.inputs_.push_back(node->tensor_);
+            break;
+        case Node::Type::Scalar:
+            size.num_instrs_ = 1;
+            size.max_stack_size_ = 1;
+            break;
+        case Node::Type::Unary:
+            size = SplitNode(node->lhs_, evaluated);
+            size.num_instrs_++;
+            if (!size.Fits()) {
+                size = evaluate(node->lhs_, size);
+                size.num_instrs_++;
+            }
+            break;
+        case Node::Type::Binary: {
+            FusedSize lhs_size = SplitNode(node->lhs_, evaluated);
+            FusedSize rhs_size = SplitNode(node->rhs_, evaluated);
+            auto combine = [&lhs_size, &rhs_size]() {
+                FusedSize combined;
+                combined.num_instrs_ =
+                        lhs_size.num_instrs_ + rhs_size.num_instrs_ + 1;
+                combined.max_stack_size_ =
+                        std::max(lhs_size.max_stack_size_,
+                                 rhs_size.max_stack_size_ + 1);
+                combined.inputs_ = lhs_size.inputs_;
+                for (const Tensor& input : rhs_size.inputs_) {
+                    if (std::none_of(combined.inputs_.begin(),
+                                     combined.inputs_.end(),
+                                     [&input](const Tensor& t) {
+                                         return t.IsSame(input);
+                                     })) {
+                        combined.inputs_.push_back(input);
+                    }
+                }
+                return combined;
+            };
+            // Evaluate the larger operand first, the smaller one may still be
+            // fused with the remaining expression.
+            bool lhs_first = lhs_size.num_instrs_ >= rhs_size.num_instrs_;
+            size = combine();
+            if (!size.Fits()) {
+                if (lhs_first) {
+                    lhs_size = evaluate(node->lhs_, lhs_size);
+                } else {
+                    rhs_size = evaluate(node->rhs_, rhs_size);
+                }
+                size = combine();
+            }
+            if (!size.Fits()) {
+                if (lhs_first) {
+                    rhs_size = evaluate(node->rhs_, rhs_size);
+                } else {
+                    lhs_size = evaluate(node->lhs_, lhs_size);
+                }
+                size = combine();
+            }
+            break;
+        }
+    }
+    return size;
+}
+
+Tensor LazyTensor::EvalFused(const std::shared_ptr<const Node>& node,
+                             const EvaluatedNodes& evaluated) const {
+    // Compile the sub-expression to a postfix program. Leaf tensors used
+    // multiple times are loaded from the same input.
+    std::vector<Tensor> inputs;
+    kernel::FusedEWProgram program;
+    int64_t stack_size = 0;
+
+    auto load_input = [&](const Tensor& tensor) {
+        int64_t input_idx = 0;
+        while (input_idx < static_cast<int64_t>(inputs.size()) &&
+               !inputs[input_idx].IsSame(tensor)) {
+            input_idx++;
+        }
+        if (input_idx == static_cast<int64_t>(inputs.size())) {
+            inputs.push_back(tensor);
+        }
+        kernel::FusedEWInstr instr{};
+        instr.type_ = kernel::FusedEWInstrType::LoadInput;
+        instr.input_idx_ = input_idx;
+        return instr;
+    };
+    auto append = [&](const kernel::FusedEWInstr& instr) {
+        program.instrs_[program.num_instrs_++] = instr;
+    };
+    auto push = [&]() {
+        stack_size++;
+        program.max_stack_size_ =
+                std::max(program.max_stack_size_, stack_size);
+    };
+
+    std::function<SizeVector(const std::shared_ptr<const Node>&)> emit =
+            [&](const std::shared_ptr<const Node>& n) -> SizeVector {
+        kernel::FusedEWInstr instr{};
+        SizeVector shape;
+        auto evaluated_it = evaluated.find(n.get());
+        if (evaluated_it != evaluated.end()) {
+            append(load_input(evaluated_it->second));
+            push();
+            return evaluated_it->second.GetShape();
+        }
+        switch (n->type_) {
+            case Node::Type::Leaf:
+                append(load_input(n->tensor_));
+                push();
+                shape = n->tensor_.GetShape();
+                break;
+            case Node::Type::Scalar:
+                instr.type_ = kernel::FusedEWInstrType::LoadScalar;
+                instr.scalar_ = n->scalar_;
+                append(instr);
+                push();
+                shape = {};
+                break;
+            case Node::Type::Unary:
+                shape = emit(n->lhs_);
+                instr.type_ = kernel::FusedEWInstrType::Unary;
+                instr.unary_op_code_ = n->unary_op_code_;
+                append(instr);
+                break;
+            case Node::Type::Binary: {
+                SizeVector lhs_shape = emit(n->lhs_);
+                SizeVector rhs_shape = emit(n->rhs_);
+                instr.type_ = kernel::FusedEWInstrType::Binary;
+                instr.binary_op_code_ = n->binary_op_code_;
+                append(instr);
+                stack_size--;
+                shape = shape_util::BroadcastedShape(lhs_shape, rhs_shape);
+                break;
+            }
+        }
+        return shape;
+    };
+    SizeVector dst_shape = emit(node);
+
+    Tensor dst(dst_shape, dtype_, device_);
+    kernel::FusedEW(inputs, program, dst);
+    return dst;
+}
+
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,220 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "open3d/core/Device.h"
+#include "open3d/core/Dtype.h"
+#include "open3d/core/SizeVector.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/BinaryEW.h"
+#include "open3d/core/kernel/UnaryEW.h"
+
+namespace open3d {
+namespace core {
+
+/// A LazyTensor records a chain of elementwise ops instead of executing them
+/// immediately. When the result is read with LazyTensor::Eval() (or by
+/// converting to Tensor), the whole chain is compiled to a single fused
+/// kernel, such that no intermediate Tensor is materialized.
+///
+/// Example:
+/// ```cpp
+/// // One kernel launch and one output allocation, instead of three.
+/// Tensor dist = (a.Lazy() - b).Mul(c).Sqrt().Eval();
+/// ```
+///
+/// Only arithmetic ops (Add, Sub, Mul, Div) and non-boolean unary ops are
+/// supported. All operands must have the same dtype and device; scalar
+/// operands are casted to the operands' dtype, same as in Tensor. If the
+/// expression is too large to be fused in one kernel, it is split into
+/// several fused kernels.
+class LazyTensor {
+public:
+    /// Scalar operand overloads only accept arithmetic types. Tensor operands
+    /// take the explicit overloads, which are preferred over the free scalar
+    /// operators in Tensor.h.
+    template <typename T>
+    using EnableIfScalar =
+            typename std::enable_if<std::is_arithmetic<T>::value>::type;
+
+    /// Creates a LazyTensor referencing \p tensor. No data is copied.
+    LazyTensor(const Tensor& tensor);
+
+    /// Evaluates the recorded expression and returns the resulting Tensor.
+    Tensor Eval() const;
+
+    /// Implicit evaluation, e.g. `Tensor c = a.Lazy() + b;`.
+    operator Tensor() const { return Eval(); }
+
+    LazyTensor Add(const LazyTensor& value) const;
+    template <typename T, typename = EnableIfScalar<T>>
+    LazyTensor Add(T scalar_value) const {
+        return BinaryScalar(kernel::BinaryEWOpCode::Add, scalar_value);
+    }
+    LazyTensor operator+(const LazyTensor& value) const { return Add(value); }
+    LazyTensor operator+(const Tensor& value) const {
+        return Add(LazyTensor(value));
+    }
+    template <typename T, typename = EnableIfScalar<T>>
+    LazyTensor operator+(T scalar_value) const {
+        return Add(scalar_value);
+    }
+
+    LazyTensor Sub(const LazyTensor& value) const;
+    template <typename T, typename = EnableIfScalar<T>>
+    LazyTensor Sub(T scalar_value) const {
+        return BinaryScalar(kernel::BinaryEWOpCode::Sub, scalar_value);
+    }
+    LazyTensor operator-(const LazyTensor& value) const { return Sub(value); }
+    LazyTensor operator-(const Tensor& value) const {
+        return Sub(LazyTensor(value));
+    }
+    template <typename T, typename = EnableIfScalar<T>>
+    LazyTensor operator-(T scalar_value) const {
+        return Sub(scalar_value);
+    }
+
+    LazyTensor Mul(const LazyTensor& value) const;
+    template <typename T, typename = EnableIfScalar<T>>
+    LazyTensor Mul(T scalar_value) const {
+        return BinaryScalar(kernel::BinaryEWOpCode::Mul, scalar_value);
+    }
+    LazyTensor operator*(const LazyTensor& value) const { return Mul(value); }
+    LazyTensor operator*(const Tensor& value) const {
+        return Mul(LazyTensor(value));
+    }
+    template <typename T, typename = EnableIfScalar<T>>
+    LazyTensor operator*(T scalar_value) const {
+        return Mul(scalar_value);
+    }
+
+    LazyTensor Div(const LazyTensor& value) const;
+    template <typename T, typename = EnableIfScalar<T>>
+    LazyTensor Div(T scalar_value) const {
+        return BinaryScalar(kernel::BinaryEWOpCode::Div, scalar_value);
+    }
+    LazyTensor operator/(const LazyTensor& value) const { return Div(value); }
+    LazyTensor operator/(const Tensor& value) const {
+        return Div(LazyTensor(value));
+    }
+    template <typename T, typename = EnableIfScalar<T>>
+    LazyTensor operator/(T scalar_value) const {
+        return Div(scalar_value);
+    }
+
+    LazyTensor Sqrt() const;
+    LazyTensor Sin() const;
+    LazyTensor Cos() const;
+    LazyTensor Neg() const;
+    LazyTensor Exp() const;
+    LazyTensor Abs() const;
+    LazyTensor Floor() const;
+    LazyTensor Ceil() const;
+    LazyTensor Round() const;
+    LazyTensor Trunc() const;
+
+    /// Shape of the result, i.e. the broadcasted shape of all operands.
+    inline SizeVector GetShape() const { return shape_; }
+
+    inline Dtype GetDtype() const { return dtype_; }
+
+    inline Device GetDevice() const { return device_; }
+
+protected:
+    /// Node of the recorded expression tree.
+    struct Node {
+        enum class Type { Leaf, Scalar, Unary, Binary };
+
+        Type type_;
+        Tensor tensor_;   // Type::Leaf.
+        double scalar_;   // Type::Scalar.
+        kernel::UnaryEWOpCode unary_op_code_;    // Type::Unary.
+        kernel::BinaryEWOpCode binary_op_code_;  // Type::Binary.
+        std::shared_ptr<const Node> lhs_;  // Type::Unary and Type::Binary.
+        std::shared_ptr<const Node> rhs_;  // Type::Binary.
+    };
+
+    LazyTensor(const std::shared_ptr<const Node>& node,
+               const SizeVector& shape,
+               Dtype dtype,
+               const Device& device)
+        : node_(node), shape_(shape), dtype_(dtype), device_(device) {}
+
+    LazyTensor Unary(kernel::UnaryEWOpCode op_code) const;
+
+    LazyTensor Binary(kernel::BinaryEWOpCode op_code,
+                      const LazyTensor& value) const;
+
+    template <typename T>
+    LazyTensor BinaryScalar(kernel::BinaryEWOpCode op_code,
+                            T scalar_value) const {
+        auto scalar_node = std::make_shared<Node>();
+        scalar_node->type_ = Node::Type::Scalar;
+        scalar_node->scalar_ = static_cast<double>(scalar_value);
+        return Binary(op_code, LazyTensor(scalar_node, {}, dtype_, device_));
+    }
+
+    /// Sub-expressions that have already been evaluated. They are loaded as
+    /// inputs by the expressions using them.
+    using EvaluatedNodes = std::unordered_map<const Node*, Tensor>;
+
+    /// Size of the fused program of a sub-expression.
+    struct FusedSize {
+        int64_t num_instrs_ = 0;
+        int64_t max_stack_size_ = 0;
+        std::vector<Tensor> inputs_;
+
+        bool Fits() const;
+    };
+
+    /// Evaluates the sub-expression rooted at \p node.
+    Tensor EvalNode(const std::shared_ptr<const Node>& node) const;
+
+    /// Evaluates the largest sub-expressions of \p node that fit in one
+    /// fused kernel, such that the remaining expression also fits. Returns
+    /// the size of the remaining expression.
+    FusedSize SplitNode(const std::shared_ptr<const Node>& node,
+                        EvaluatedNodes& evaluated) const;
+
+    /// Evaluates the sub-expression rooted at \p node with one fused kernel.
+    Tensor EvalFused(const std::shared_ptr<const Node>& node,
+                     const EvaluatedNodes& evaluated) const;
+
+protected:
+    std::shared_ptr<const Node> node_;
+    SizeVector shape_;
+    Dtype dtype_;
+    Device device_;
+};
+
+}  // namespace core
+}  // namespace open3d
@@ -26,14 +26,23 @@
 
 #include "open3d/core/MemoryManager.h"
 
+#include <algorithm>
+#include <cstdlib>
 #include <numeric>
+#include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "open3d/core/Blob.h"
+#include "open3d/core/CUDAUtils.h"
 #include "open3d/core/Device.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/Helper.h"
 
+#ifdef BUILD_CUDA_MODULE
+#include "open3d/core/CUDAState.cuh"
+#endif
+
 namespace open3d {
 namespace core {
 
@@ -77,6 +86,39 @@ void MemoryManager::Memcpy(void* dst_ptr,
     device_mm->Memcpy(dst_ptr, dst_device, src_ptr, src_device, num_bytes);
 }
 
+void MemoryManager::MemcpyAsync(void* dst_ptr,
+                                const Device& dst_device,
+                                const void* src_ptr,
+                                const Device& src_device,
+                                size_t num_bytes) {
+    // 0-element Tensor's data_ptr_ is nullptr
+    if (num_bytes == 0) {
+        return;
+    } else if (src_ptr == nullptr || dst_ptr == nullptr) {
+        utility::LogError("src_ptr and dst_ptr cannot be nullptr.");
+    }
+
+    if ((dst_device.GetType() != Device::DeviceType::CPU &&
+         dst_device.GetType() != Device::DeviceType::CUDA) ||
+        (src_device.GetType() != Device::DeviceType::CPU &&
+         src_device.GetType() != Device::DeviceType::CUDA)) {
+        utility::LogError("MemoryManager::MemcpyAsync: Unimplemented device.");
+    }
+
+    std::shared_ptr<DeviceMemoryManager> device_mm;
+    if (dst_device.GetType() == Device::DeviceType::CPU &&
+        src_device.GetType() == Device::DeviceType::CPU) {
+        device_mm = GetDeviceMemoryManager(src_device);
+    } else if (src_device.GetType() == Device::DeviceType::CUDA) {
+        device_mm = GetDeviceMemoryManager(src_device);
+    } else {
+        device_mm = GetDeviceMemoryManager(dst_device);
+    }
+
+    device_mm->MemcpyAsync(dst_ptr, dst_device, src_ptr, src_device,
+                           num_bytes);
+}
+
 void MemoryManager::MemcpyFromHost(void* dst_ptr,
                                    const Device& dst_device,
                                    const void* host_ptr,
@@ -93,14 +135,233 @@ void MemoryManager::MemcpyToHost(void* host_ptr,
     Memcpy(host_ptr, Device("CPU:0"), src_ptr, src_device, num_bytes);
 }
 
+void* MemoryManager::MallocPinned(size_t byte_size) {
+    return GetPinnedMemoryManager()->Malloc(byte_size, Device("CPU:0"));
+}
+
+void MemoryManager::FreePinned(void* ptr) {
+    GetPinnedMemoryManager()->Free(ptr, Device("CPU:0"));
+}
+
+MemoryStatistics MemoryManager::GetStatistics(const Device& device) {
+    return GetDeviceMemoryManager(device)->GetStatistics(device);
+}
+
+void MemoryManager::ResetPeakStatistics(const Device& device) {
+    GetDeviceMemoryManager(device)->ResetPeakStatistics(device);
+}
+
+namespace {
+
+/// Interned tags of the MemoryTagScopes, such that allocations only keep a
+/// tag id. Id 0 is the empty tag.
+struct MemoryTagRegistry {
+    std::mutex mutex_;
+    std::vector<std::string> tags_{""};
+    std::unordered_map<std::string, int> tag_ids_{{"", 0}};
+};
+
+MemoryTagRegistry& GetMemoryTagRegistry() {
+    static MemoryTagRegistry registry;
+    return registry;
+}
+
+const std::string kEmptyTag;
+thread_local const std::string* current_tag = &kEmptyTag;
+thread_local int current_tag_id = 0;
+
+}  // namespace
+
+MemoryTagScope::MemoryTagScope(const std::string& tag)
+    : tag_(tag), prev_tag_(current_tag), prev_tag_id_(current_tag_id) {
+    MemoryTagRegistry& registry = GetMemoryTagRegistry();
+    {
+        std::lock_guard<std::mutex> lock(registry.mutex_);
+        auto it = registry.tag_ids_.find(tag_);
+        if (it == registry.tag_ids_.end()) {
+            int tag_id = static_cast<int>(registry.tags_.size());
+            it = registry.tag_ids_.emplace(tag_, tag_id).first;
+            registry.tags_.push_back(tag_);
+        }
+        tag_id_ = it->second;
+    }
+    current_tag = &tag_;
+    current_tag_id = tag_id_;
+}
+
+MemoryTagScope::~MemoryTagScope() {
+    current_tag = prev_tag_;
+    current_tag_id = prev_tag_id_;
+}
+
+const std::string& MemoryTagScope::GetCurrentTag() { return *current_tag; }
+
+int MemoryTagScope::GetCurrentTagId() { return current_tag_id; }
+
+std::string MemoryTagScope::GetTag(int tag_id) {
+    MemoryTagRegistry& registry = GetMemoryTagRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex_);
+    return registry.tags_.at(tag_id);
+}
+
+MemoryAccountant::DeviceCounters& MemoryAccountant::GetCounters(
+        const Device& device) {
+    int device_id = device.GetID();
+    if (device_id < 0 || device_id >= kMaxDevices) {
+        utility::LogError("Device id {} out of range [0, {}).", device_id,
+                          kMaxDevices);
+    }
+    return device_counters_[device_id];
+}
+
+int MemoryAccountant::RecordMalloc(size_t byte_size, const Device& device) {
+    DeviceCounters& counters = GetCounters(device);
+    int64_t num_bytes = static_cast<int64_t>(byte_size);
+    int64_t bytes_allocated =
+            counters.bytes_allocated_.fetch_add(num_bytes,
+                                                std::memory_order_relaxed) +
+            num_bytes;
+    int64_t peak_bytes_allocated =
+            counters.peak_bytes_allocated_.load(std::memory_order_relaxed);
+    while (bytes_allocated > peak_bytes_allocated &&
+           !counters.peak_bytes_allocated_.compare_exchange_weak(
+                   peak_bytes_allocated, bytes_allocated,
+                   std::memory_order_relaxed)) {
+    }
+    counters.num_allocations_.fetch_add(1, std::memory_order_relaxed);
+    counters.num_total_allocations_.fetch_add(1, std::memory_order_relaxed);
+
+    int tag_id = MemoryTagScope::GetCurrentTagId();
+    if (tag_id != 0) {
+        std::lock_guard<std::mutex> lock(counters.tag_mutex_);
+        counters.bytes_allocated_per_tag_id_[tag_id] += num_bytes;
+    }
+    return tag_id;
+}
+
+void MemoryAccountant::RecordFree(size_t byte_size,
+                                  int tag_id,
+                                  const Device& device) {
+    DeviceCounters& counters = GetCounters(device);
+    int64_t num_bytes = static_cast<int64_t>(byte_size);
+    counters.bytes_allocated_.fetch_sub(num_bytes, std::memory_order_relaxed);
+    counters.num_allocations_.fetch_sub(1, std::memory_order_relaxed);
+    if (tag_id != 0) {
+        std::lock_guard<std::mutex> lock(counters.tag_mutex_);
+        auto it = counters.bytes_allocated_per_tag_id_.find(tag_id);
+        if (it != counters.bytes_allocated_per_tag_id_.end()) {
+            it->second -= num_bytes;
+            if (it->second == 0) {
+                counters.bytes_allocated_per_tag_id_.erase(it);
+            }
+        }
+    }
+}
+
+MemoryStatistics MemoryAccountant::GetStatistics(const Device& device) {
+    DeviceCounters& counters = GetCounters(device);
+    MemoryStatistics statistics;
+    statistics.bytes_allocated_ = counters.bytes_allocated_.load();
+    statistics.peak_bytes_allocated_ = counters.peak_bytes_allocated_.load();
+    statistics.num_allocations_ = counters.num_allocations_.load();
+    statistics.num_total_allocations_ = counters.num_total_allocations_.load();
+    std::lock_guard<std::mutex> lock(counters.tag_mutex_);
+    for (const auto& tag_bytes : counters.bytes_allocated_per_tag_id_) {
+        statistics.bytes_allocated_per_tag_[MemoryTagScope::GetTag(
+                tag_bytes.first)] = tag_bytes.second;
+    }
+    return statistics;
+}
+
+void MemoryAccountant::ResetPeakStatistics(const Device& device) {
+    DeviceCounters& counters = GetCounters(device);
+    counters.peak_bytes_allocated_ = counters.bytes_allocated_.load();
+}
+
+void MemoryBlockRecords::Insert(void* ptr, size_t byte_size, int tag_id) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    records_[ptr] = std::make_pair(byte_size, tag_id);
+}
+
+bool MemoryBlockRecords::Erase(void* ptr, size_t& byte_size, int& tag_id) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = records_.find(ptr);
+    if (it == records_.end()) {
+        return false;
+    }
+    byte_size = it->second.first;
+    tag_id = it->second.second;
+    records_.erase(it);
+    return true;
+}
+
+#ifdef BUILD_CUDA_MODULE
+void CUDAMemcpyAsync(DeviceMemoryManager& device_mm,
+                     void* dst_ptr,
+                     const Device& dst_device,
+                     const void* src_ptr,
+                     const Device& src_device,
+                     size_t num_bytes) {
+    cudaStream_t stream = GetCUDACurrentStream();
+    if (dst_device.GetType() == Device::DeviceType::CUDA &&
+        src_device.GetType() == Device::DeviceType::CPU) {
+        CUDADeviceSwitcher switcher(dst_device);
+        OPEN3D_CUDA_CHECK(cudaMemcpyAsync(dst_ptr, src_ptr, num_bytes,
+                                          cudaMemcpyHostToDevice, stream));
+    } else if (dst_device.GetType() == Device::DeviceType::CPU &&
+               src_device.GetType() == Device::DeviceType::CUDA) {
+        CUDADeviceSwitcher switcher(src_device);
+        OPEN3D_CUDA_CHECK(cudaMemcpyAsync(dst_ptr, src_ptr, num_bytes,
+                                          cudaMemcpyDeviceToHost, stream));
+    } else if (dst_device.GetType() == Device::DeviceType::CUDA &&
+               src_device.GetType() == Device::DeviceType::CUDA) {
+        if (dst_device == src_device) {
+            CUDADeviceSwitcher switcher(src_device);
+            OPEN3D_CUDA_CHECK(cudaMemcpyAsync(dst_ptr, src_ptr, num_bytes,
+                                              cudaMemcpyDeviceToDevice,
+                                              stream));
+        } else if (CUDAState::GetInstance()->IsP2PEnabled(src_device.GetID(),
+                                                          dst_device.GetID())) {
+            OPEN3D_CUDA_CHECK(cudaMemcpyPeerAsync(
+                    dst_ptr, dst_device.GetID(), src_ptr, src_device.GetID(),
+                    num_bytes, stream));
+        } else {
+            // The copy staged through a host buffer is synchronous, wait for
+            // the work already submitted to the stream first.
+            OPEN3D_CUDA_CHECK(cudaStreamSynchronize(stream));
+            device_mm.Memcpy(dst_ptr, dst_device, src_ptr, src_device,
+                             num_bytes);
+        }
+    } else {
+        utility::LogError("Wrong cudaMemcpyKind.");
+    }
+}
+#endif
+
+/// Selects the CPU memory manager from the OPEN3D_CPU_MEMORY_MANAGER
+/// environment variable.
+static std::shared_ptr<DeviceMemoryManager> CreateCPUMemoryManager() {
+    const char* env = std::getenv("OPEN3D_CPU_MEMORY_MANAGER");
+    std::string type = env == nullptr ? "" : utility::ToLower(env);
+    if (type == "cached") {
+        utility::LogDebug("Using CPUCachedMemoryManager.");
+        return std::make_shared<CPUCachedMemoryManager>();
+    } else if (!type.empty() && type != "simple") {
+        utility::LogWarning(
+                "Unknown OPEN3D_CPU_MEMORY_MANAGER \"{}\", expected "
+                "\"simple\" or \"cached\". Using \"simple\".",
+                type);
+    }
+    return std::make_shared<CPUMemoryManager>();
+}
+
 std::shared_ptr<DeviceMemoryManager> MemoryManager::GetDeviceMemoryManager(
         const Device& device) {
     static std::unordered_map<Device::DeviceType,
                               std::shared_ptr<DeviceMemoryManager>,
                               utility::hash_enum_class>
             map_device_type_to_memory_manager = {
-                    {Device::DeviceType::CPU,
-                     std::make_shared<CPUMemoryManager>()},
+                    {Device::DeviceType::CPU, CreateCPUMemoryManager()},
 #ifdef BUILD_CUDA_MODULE
 #ifdef BUILD_CACHED_CUDA_MANAGER
                     {Device::DeviceType::CUDA,
@@ -119,5 +380,21 @@ std::shared_ptr<DeviceMemoryManager> MemoryManager::GetDeviceMemoryManager(
     return map_device_type_to_memory_manager.at(device.GetType());
 }
 
+std::shared_ptr<DeviceMemoryManager> MemoryManager::GetPinnedMemoryManager() {
+    static std::shared_ptr<DeviceMemoryManager> pinned_memory_manager = []() {
+#ifdef BUILD_CUDA_MODULE
+        if (cuda::IsAvailable()) {
+            return std::shared_ptr<DeviceMemoryManager>(
+                    std::make_shared<CUDAPinnedMemoryManager>());
+        }
+#endif
+        utility::LogDebug(
+                "No CUDA device available, pinned memory falls back to "
+                "pageable memory.");
+        return GetDeviceMemoryManager(Device("CPU:0"));
+    }();
+    return pinned_memory_manager;
+}
+
 }  // namespace core
 }  // namespace open3d
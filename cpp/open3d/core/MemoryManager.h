@@ -26,8 +26,11 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <cstring>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <string>
 #include <unordered_map>
@@ -39,6 +42,73 @@ namespace core {
 
 class DeviceMemoryManager;
 
+/// Memory usage of one device, see MemoryManager::GetStatistics().
+struct MemoryStatistics {
+    /// Number of bytes currently allocated by the user.
+    int64_t bytes_allocated_ = 0;
+    /// Number of bytes freed by the user but held by the memory manager for
+    /// reuse. Always 0 for non-caching memory managers.
+    int64_t bytes_cached_ = 0;
+    /// Maximum of bytes_allocated_ since the start of the process or the last
+    /// MemoryManager::ResetPeakStatistics() call.
+    int64_t peak_bytes_allocated_ = 0;
+    /// Number of allocations currently alive.
+    int64_t num_allocations_ = 0;
+    /// Number of allocations since the start of the process.
+    int64_t num_total_allocations_ = 0;
+    /// Number of bytes currently allocated within each MemoryTagScope. The
+    /// allocations made outside of any scope are not listed.
+    std::unordered_map<std::string, int64_t> bytes_allocated_per_tag_;
+};
+
+/// Attributes the allocations made by the current thread to a tag while the
+/// scope is alive, e.g.
+///
+/// \code{.cpp}
+/// {
+///     MemoryTagScope scope("integrate");
+///     voxel_grid.Integrate(depth, color, intrinsic, extrinsic);
+/// }
+/// std::cout << MemoryManager::GetStatistics(device)
+///                      .bytes_allocated_per_tag_["integrate"];
+/// \endcode
+///
+/// Scopes can be nested, the innermost tag is used. Memory is accounted to
+/// the tag it was allocated with, regardless of where it is freed.
+class MemoryTagScope {
+public:
+    explicit MemoryTagScope(const std::string& tag);
+    ~MemoryTagScope();
+    MemoryTagScope(const MemoryTagScope&) = delete;
+    MemoryTagScope& operator=(const MemoryTagScope&) = delete;
+
+    /// Returns the tag of the innermost scope of the current thread, or an
+    /// empty string if there is none.
+    static const std::string& GetCurrentTag();
+
+    /// Returns the id of GetCurrentTag(), 0 if there is no scope. Each tag
+    /// string has a unique id.
+    static int GetCurrentTagId();
+
+    /// Returns the tag string of \p tag_id.
+    static std::string GetTag(int tag_id);
+
+private:
+    std::string tag_;
+    int tag_id_;
+    const std::string* prev_tag_;
+    int prev_tag_id_;
+};
+
+/// Top-level memory interface. Calls are dispatched to the DeviceMemoryManager
+/// of the device type.
+///
+/// For CPU devices, the default CPUMemoryManager directly calls the system
+/// allocator. Setting the environment variable
+/// `OPEN3D_CPU_MEMORY_MANAGER=cached` before the first CPU allocation selects
+/// the CPUCachedMemoryManager instead. Both map large allocations with the
+/// NUMA and huge page options set with
+/// CPUMemoryManager::SetLargeAllocationOptions().
 class MemoryManager {
 public:
     static void* Malloc(size_t byte_size, const Device& device);
@@ -58,10 +128,87 @@ public:
                              const void* src_ptr,
                              const Device& src_device,
                              size_t num_bytes);
+    /// Same as Memcpy, but copies involving CUDA devices are submitted to the
+    /// current CUDA stream (see CUDAScopedStream) and may return before the
+    /// copy is done. Both buffers must stay alive until the stream has been
+    /// synchronized. The copy is effectively synchronous if the host buffer
+    /// is pageable, or if it is a copy between CUDA devices without P2P
+    /// access. CPU to CPU copies are always synchronous.
+    static void MemcpyAsync(void* dst_ptr,
+                            const Device& dst_device,
+                            const void* src_ptr,
+                            const Device& src_device,
+                            size_t num_bytes);
+
+    /// Allocates page-locked (pinned) host memory, which can be transferred
+    /// to and from CUDA devices at full bandwidth and asynchronously, see
+    /// MemcpyAsync(). The memory belongs to the CPU:0 device and must be freed
+    /// with FreePinned(). Falls back to pageable memory if no CUDA device is
+    /// available.
+    ///
+    /// Page-locked memory is a scarce system resource, use it for transfer
+    /// buffers only.
+    static void* MallocPinned(size_t byte_size);
+    static void FreePinned(void* ptr);
+
+    /// Returns the memory usage of \p device.
+    static MemoryStatistics GetStatistics(const Device& device);
+    /// Resets the peak_bytes_allocated_ of \p device to its current
+    /// bytes_allocated_.
+    static void ResetPeakStatistics(const Device& device);
 
 protected:
     static std::shared_ptr<DeviceMemoryManager> GetDeviceMemoryManager(
             const Device& device);
+    static std::shared_ptr<DeviceMemoryManager> GetPinnedMemoryManager();
+};
+
+/// Keeps the allocation statistics of a DeviceMemoryManager, per device id.
+///
+/// Thread-safe. The counters are atomic, only the allocations made within a
+/// MemoryTagScope take a lock to update the per-tag statistics. The memory
+/// manager keeps the size and the tag id of each block, e.g. in a block
+/// header, and passes them back to RecordFree().
+class MemoryAccountant {
+public:
+    /// Maximum number of devices of one type.
+    static constexpr int kMaxDevices = 64;
+
+    /// Records an allocation of \p byte_size bytes. Returns the id of the tag
+    /// the allocation is accounted to, see MemoryTagScope::GetCurrentTagId().
+    int RecordMalloc(size_t byte_size, const Device& device);
+    void RecordFree(size_t byte_size, int tag_id, const Device& device);
+    /// The returned bytes_cached_ is always 0.
+    MemoryStatistics GetStatistics(const Device& device);
+    void ResetPeakStatistics(const Device& device);
+
+private:
+    struct DeviceCounters {
+        std::atomic<int64_t> bytes_allocated_{0};
+        std::atomic<int64_t> peak_bytes_allocated_{0};
+        std::atomic<int64_t> num_allocations_{0};
+        std::atomic<int64_t> num_total_allocations_{0};
+        std::mutex tag_mutex_;
+        std::unordered_map<int, int64_t> bytes_allocated_per_tag_id_;
+    };
+
+    DeviceCounters& GetCounters(const Device& device);
+
+    std::array<DeviceCounters, kMaxDevices> device_counters_;
+};
+
+/// Size and tag id of the live blocks of a DeviceMemoryManager which cannot
+/// store them next to the block, e.g. for device memory. Thread-safe.
+class MemoryBlockRecords {
+public:
+    void Insert(void* ptr, size_t byte_size, int tag_id);
+    /// Removes \p ptr and returns its size and tag id. Returns false if
+    /// \p ptr has not been inserted.
+    bool Erase(void* ptr, size_t& byte_size, int& tag_id);
+
+private:
+    std::mutex mutex_;
+    std::unordered_map<void*, std::pair<size_t, int>> records_;
 };
 
 class DeviceMemoryManager {
@@ -73,7 +220,55 @@ public:
                         const void* src_ptr,
                         const Device& src_device,
                         size_t num_bytes) = 0;
+    /// Defaults to the synchronous Memcpy.
+    virtual void MemcpyAsync(void* dst_ptr,
+                             const Device& dst_device,
+                             const void* src_ptr,
+                             const Device& src_device,
+                             size_t num_bytes) {
+        Memcpy(dst_ptr, dst_device, src_ptr, src_device, num_bytes);
+    }
+    virtual MemoryStatistics GetStatistics(const Device& device) {
+        return accountant_.GetStatistics(device);
+    }
+    virtual void ResetPeakStatistics(const Device& device) {
+        accountant_.ResetPeakStatistics(device);
+    }
     virtual ~DeviceMemoryManager() {}
+
+protected:
+    MemoryAccountant accountant_;
+};
+
+/// Placement of the pages of large CPU allocations on NUMA systems.
+enum class CPUPagePlacement {
+    /// Each page is placed on the NUMA node of the thread first writing it.
+    FirstTouch,
+    /// The pages are written at allocation time by the threads of a static
+    /// parallel schedule, as used by the CPU kernels, so that each thread
+    /// finds its share of the tensor on its own NUMA node. This requires
+    /// bound threads, e.g. OMP_PROC_BIND=close and OMP_PLACES=cores.
+    ParallelFirstTouch,
+    /// The pages are interleaved over all NUMA nodes, which balances the
+    /// memory traffic when the access pattern is unknown.
+    Interleave,
+};
+
+/// Options of the CPU allocations of at least min_bytes_ bytes, see
+/// CPUMemoryManager::SetLargeAllocationOptions().
+struct CPULargeAllocationOptions {
+    /// Allocations of at least this size are mapped directly from the system
+    /// with the options below. 0 disables large allocations. The
+    /// CPUCachedMemoryManager only maps the blocks too large to be cached.
+    size_t min_bytes_ = 0;
+    /// Placement of the pages on NUMA nodes.
+    CPUPagePlacement placement_ = CPUPagePlacement::ParallelFirstTouch;
+    /// Aligns the mappings to 2 MiB and requests transparent huge pages for
+    /// them, to reduce TLB misses.
+    bool transparent_huge_pages_ = true;
+    /// Tries to map explicitly reserved huge pages (MAP_HUGETLB) first. Falls
+    /// back to regular pages if none are available.
+    bool hugetlb_ = false;
 };
 
 class CPUMemoryManager : public DeviceMemoryManager {
@@ -86,9 +281,72 @@ public:
                 const void* src_ptr,
                 const Device& src_device,
                 size_t num_bytes) override;
+
+    /// Sets the options of large allocations, for both CPU memory managers.
+    /// Applies to the allocations made after the call. Large allocations are
+    /// only supported on Linux, and are made with the system allocator on
+    /// other platforms.
+    static void SetLargeAllocationOptions(
+            const CPULargeAllocationOptions& options);
+    static CPULargeAllocationOptions GetLargeAllocationOptions();
+
+    /// Maps \p byte_size bytes with the large allocation options. Returns
+    /// nullptr if \p byte_size is below the threshold or the mapping failed.
+    static void* MallocLarge(size_t byte_size);
+    /// Unmaps \p ptr and returns true if it was allocated by MallocLarge().
+    static bool FreeLarge(void* ptr);
+};
+
+/// Statistics of the CPUCachedMemoryManager, accumulated over all threads.
+struct CPUCacheStatistics {
+    /// Number of Malloc calls with non-zero size.
+    int64_t num_mallocs_ = 0;
+    /// Number of Malloc calls served from the cache.
+    int64_t num_cache_hits_ = 0;
+    /// Number of free blocks currently held in the cache.
+    int64_t num_cached_blocks_ = 0;
+    /// Total size of the free blocks currently held in the cache.
+    int64_t bytes_cached_ = 0;
+};
+
+/// Caching CPU memory manager.
+///
+/// Allocations are rounded up to size classes (four classes per power of two)
+/// and freed blocks are kept in per-thread caches for reuse by subsequent
+/// Malloc calls of the same size class, avoiding repeated system allocations
+/// and page faults for identically sized temporary buffers. Blocks larger than
+/// the largest size class are not cached. To return the cached memory to the
+/// system, use CPUCachedMemoryManager::ReleaseCache().
+class CPUCachedMemoryManager : public DeviceMemoryManager {
+public:
+    CPUCachedMemoryManager();
+    void* Malloc(size_t byte_size, const Device& device) override;
+    void Free(void* ptr, const Device& device) override;
+    void Memcpy(void* dst_ptr,
+                const Device& dst_device,
+                const void* src_ptr,
+                const Device& src_device,
+                size_t num_bytes) override;
+    MemoryStatistics GetStatistics(const Device& device) override;
+
+public:
+    /// Frees all cached blocks of all threads.
+    static void ReleaseCache();
+
+    static CPUCacheStatistics GetCacheStatistics();
 };
 
 #ifdef BUILD_CUDA_MODULE
+/// MemcpyAsync of the CUDA memory managers. Copies between CUDA devices
+/// without P2P access are staged through the host with \p device_mm's
+/// Memcpy, once the work submitted to the current stream is done.
+void CUDAMemcpyAsync(DeviceMemoryManager& device_mm,
+                     void* dst_ptr,
+                     const Device& dst_device,
+                     const void* src_ptr,
+                     const Device& src_device,
+                     size_t num_bytes);
+
 class CUDASimpleMemoryManager : public DeviceMemoryManager {
 public:
     CUDASimpleMemoryManager();
@@ -99,12 +357,36 @@ public:
                 const void* src_ptr,
                 const Device& src_device,
                 size_t num_bytes) override;
+    void MemcpyAsync(void* dst_ptr,
+                     const Device& dst_device,
+                     const void* src_ptr,
+                     const Device& src_device,
+                     size_t num_bytes) override;
 
 public:
     static void ReleaseCache(){};
 
 protected:
     bool IsCUDAPointer(const void* ptr);
+
+    MemoryBlockRecords records_;
+};
+
+/// Allocates page-locked host memory with cudaHostAlloc. The memory is
+/// accessible from all CUDA devices.
+class CUDAPinnedMemoryManager : public DeviceMemoryManager {
+public:
+    CUDAPinnedMemoryManager();
+    void* Malloc(size_t byte_size, const Device& device) override;
+    void Free(void* ptr, const Device& device) override;
+    void Memcpy(void* dst_ptr,
+                const Device& dst_device,
+                const void* src_ptr,
+                const Device& src_device,
+                size_t num_bytes) override;
+
+protected:
+    MemoryBlockRecords records_;
 };
 
 class CUDACachedMemoryManager : public DeviceMemoryManager {
@@ -117,6 +399,12 @@ public:
                 const void* src_ptr,
                 const Device& src_device,
                 size_t num_bytes) override;
+    void MemcpyAsync(void* dst_ptr,
+                     const Device& dst_device,
+                     const void* src_ptr,
+                     const Device& src_device,
+                     size_t num_bytes) override;
+    MemoryStatistics GetStatistics(const Device& device) override;
 
 public:
     static void ReleaseCache();
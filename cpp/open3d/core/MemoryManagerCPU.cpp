@@ -24,27 +24,156 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <atomic>
+#include <cstdint>
 #include <cstdlib>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <unordered_map>
 
 #include "open3d/core/MemoryManager.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/Parallel.h"
+
+#ifdef __linux__
+#include <linux/mempolicy.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 namespace open3d {
 namespace core {
 
+namespace {
+
+/// Header stored in front of every block, keeps the size and the memory tag
+/// of the block for the MemoryAccountant. The alignment keeps the user pointer
+/// aligned to 64 bytes (cache line) if the system allocator's pointer is.
+struct alignas(64) CPUAllocationHeader {
+    size_t byte_size_;
+    int tag_id_;
+    bool is_large_;
+};
+
+/// Process-wide state of the large allocations.
+struct CPULargeAllocations {
+    std::mutex mutex_;
+    CPULargeAllocationOptions options_;
+    /// Mapped size of each live large allocation.
+    std::unordered_map<void*, size_t> mappings_;
+};
+
+CPULargeAllocations& GetLargeAllocations() {
+    static CPULargeAllocations large_allocations;
+    return large_allocations;
+}
+
+/// Copy of options_.min_bytes_, read by every Malloc without locking.
+std::atomic<size_t> g_large_min_bytes(0);
+/// Number of live large allocations, so that Free only looks up pointers
+/// while there are some.
+std::atomic<int64_t> g_num_large_allocations(0);
+
+#ifdef __linux__
+constexpr size_t kHugePageSize = size_t(1) << 21;
+
+/// Returns the bit mask of the online NUMA nodes, or 0 if unknown.
+unsigned long GetOnlineNumaNodes() {
+    std::ifstream file("/sys/devices/system/node/online");
+    std::string ranges;
+    if (!std::getline(file, ranges)) {
+        return 0;
+    }
+    // Comma separated list of nodes and node ranges, e.g. "0-1,3".
+    unsigned long mask = 0;
+    size_t pos = 0;
+    while (pos < ranges.size()) {
+        size_t end = ranges.find(',', pos);
+        if (end == std::string::npos) {
+            end = ranges.size();
+        }
+        std::string range = ranges.substr(pos, end - pos);
+        size_t dash = range.find('-');
+        int first = std::atoi(range.c_str());
+        int last = dash == std::string::npos
+                           ? first
+                           : std::atoi(range.c_str() + dash + 1);
+        for (int node = first; node <= last && node < 64; ++node) {
+            mask |= 1ul << node;
+        }
+        pos = end + 1;
+    }
+    return mask;
+}
+
+/// Interleaves the pages of [ptr, ptr + num_bytes) over the NUMA nodes. Must
+/// be called before the pages are touched.
+void InterleavePages(void* ptr, size_t num_bytes) {
+    static const unsigned long nodes = GetOnlineNumaNodes();
+    if ((nodes & (nodes - 1)) == 0) {
+        // A single node, or unknown nodes.
+        return;
+    }
+    if (syscall(SYS_mbind, ptr, num_bytes, MPOL_INTERLEAVE, &nodes,
+                sizeof(nodes) * 8, 0) != 0) {
+        utility::LogDebug("mbind(MPOL_INTERLEAVE) failed, using first touch.");
+    }
+}
+
+/// Writes the first byte of every page, with the same static schedule as the
+/// CPU kernels, so that each page is placed on the node of the thread that
+/// will process it.
+void TouchPagesParallel(void* ptr, size_t num_bytes, size_t page_size) {
+    static std::atomic<bool> warned(false);
+    if (!utility::AreThreadsBound() && !warned.exchange(true)) {
+        utility::LogWarning(
+                "Parallel first touch without bound threads, the pages may "
+                "not stay local to their threads. Set OMP_PROC_BIND=close and "
+                "OMP_PLACES=cores.");
+    }
+    volatile char* bytes = static_cast<char*>(ptr);
+    const int64_t num_pages = int64_t((num_bytes + page_size - 1) / page_size);
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int64_t page = 0; page < num_pages; ++page) {
+        bytes[page * page_size] = 0;
+    }
+}
+#endif
+
+}  // namespace
+
 CPUMemoryManager::CPUMemoryManager() {}
 
 void* CPUMemoryManager::Malloc(size_t byte_size, const Device& device) {
-    void* ptr;
-    ptr = std::malloc(byte_size);
-    if (byte_size != 0 && !ptr) {
+    if (byte_size == 0) return nullptr;
+    const size_t alloc_bytes = sizeof(CPUAllocationHeader) + byte_size;
+    void* raw_ptr = MallocLarge(alloc_bytes);
+    bool is_large = raw_ptr != nullptr;
+    if (!is_large) {
+        raw_ptr = std::malloc(alloc_bytes);
+    }
+    if (!raw_ptr) {
         utility::LogError("CPU malloc failed");
     }
-    return ptr;
+    CPUAllocationHeader* header = static_cast<CPUAllocationHeader*>(raw_ptr);
+    header->byte_size_ = byte_size;
+    header->tag_id_ = accountant_.RecordMalloc(byte_size, device);
+    header->is_large_ = is_large;
+    return header + 1;
 }
 
 void CPUMemoryManager::Free(void* ptr, const Device& device) {
     if (ptr) {
-        std::free(ptr);
+        CPUAllocationHeader* header =
+                static_cast<CPUAllocationHeader*>(ptr) - 1;
+        accountant_.RecordFree(header->byte_size_, header->tag_id_, device);
+        if (header->is_large_) {
+            FreeLarge(header);
+        } else {
+            std::free(header);
+        }
     }
 }
 
@@ -56,5 +185,107 @@ void CPUMemoryManager::Memcpy(void* dst_ptr,
     std::memcpy(dst_ptr, src_ptr, num_bytes);
 }
 
+void CPUMemoryManager::SetLargeAllocationOptions(
+        const CPULargeAllocationOptions& options) {
+    CPULargeAllocations& large_allocations = GetLargeAllocations();
+    std::lock_guard<std::mutex> lock(large_allocations.mutex_);
+    large_allocations.options_ = options;
+    g_large_min_bytes = options.min_bytes_;
+}
+
+CPULargeAllocationOptions CPUMemoryManager::GetLargeAllocationOptions() {
+    CPULargeAllocations& large_allocations = GetLargeAllocations();
+    std::lock_guard<std::mutex> lock(large_allocations.mutex_);
+    return large_allocations.options_;
+}
+
+void* CPUMemoryManager::MallocLarge(size_t byte_size) {
+    const size_t min_bytes = g_large_min_bytes.load(std::memory_order_relaxed);
+    if (min_bytes == 0 || byte_size < min_bytes) {
+        return nullptr;
+    }
+#ifdef __linux__
+    const CPULargeAllocationOptions options = GetLargeAllocationOptions();
+    const size_t map_bytes =
+            (byte_size + kHugePageSize - 1) / kHugePageSize * kHugePageSize;
+    const int prot = PROT_READ | PROT_WRITE;
+    const int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+
+    void* ptr = MAP_FAILED;
+    size_t page_size = size_t(sysconf(_SC_PAGESIZE));
+    if (options.hugetlb_) {
+        ptr = mmap(nullptr, map_bytes, prot, flags | MAP_HUGETLB, -1, 0);
+        if (ptr == MAP_FAILED) {
+            utility::LogDebug("MAP_HUGETLB failed, using regular pages.");
+        } else {
+            page_size = kHugePageSize;
+        }
+    }
+    if (ptr == MAP_FAILED) {
+        // Over-allocate by one huge page to align the mapping, so that it can
+        // be backed by transparent huge pages from its first byte.
+        const size_t padded_bytes = map_bytes + kHugePageSize;
+        char* raw_ptr = static_cast<char*>(
+                mmap(nullptr, padded_bytes, prot, flags, -1, 0));
+        if (raw_ptr == MAP_FAILED) {
+            return nullptr;
+        }
+        char* aligned_ptr = reinterpret_cast<char*>(
+                (reinterpret_cast<uintptr_t>(raw_ptr) + kHugePageSize - 1) /
+                kHugePageSize * kHugePageSize);
+        const size_t head_bytes = aligned_ptr - raw_ptr;
+        if (head_bytes > 0) {
+            munmap(raw_ptr, head_bytes);
+        }
+        if (padded_bytes - head_bytes > map_bytes) {
+            munmap(aligned_ptr + map_bytes,
+                   padded_bytes - head_bytes - map_bytes);
+        }
+        ptr = aligned_ptr;
+        if (options.transparent_huge_pages_) {
+            madvise(ptr, map_bytes, MADV_HUGEPAGE);
+        }
+    }
+
+    if (options.placement_ == CPUPagePlacement::Interleave) {
+        InterleavePages(ptr, map_bytes);
+    } else if (options.placement_ == CPUPagePlacement::ParallelFirstTouch) {
+        TouchPagesParallel(ptr, map_bytes, page_size);
+    }
+
+    CPULargeAllocations& large_allocations = GetLargeAllocations();
+    std::lock_guard<std::mutex> lock(large_allocations.mutex_);
+    large_allocations.mappings_[ptr] = map_bytes;
+    g_num_large_allocations++;
+    return ptr;
+#else
+    return nullptr;
+#endif
+}
+
+bool CPUMemoryManager::FreeLarge(void* ptr) {
+    if (g_num_large_allocations.load(std::memory_order_relaxed) == 0) {
+        return false;
+    }
+#ifdef __linux__
+    size_t map_bytes = 0;
+    {
+        CPULargeAllocations& large_allocations = GetLargeAllocations();
+        std::lock_guard<std::mutex> lock(large_allocations.mutex_);
+        auto it = large_allocations.mappings_.find(ptr);
+        if (it == large_allocations.mappings_.end()) {
+            return false;
+        }
+        map_bytes = it->second;
+        large_allocations.mappings_.erase(it);
+        g_num_large_allocations--;
+    }
+    munmap(ptr, map_bytes);
+    return true;
+#else
+    return false;
+#endif
+}
+
 }  // namespace core
 }  // namespace open3d
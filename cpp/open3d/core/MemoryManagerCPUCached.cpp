@@ -0,0 +1,314 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+#include "open3d/core/MemoryManager.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+
+// Header stored in front of every block. The alignment keeps the user pointer
+// aligned to 64 bytes (cache line) if the system allocator's pointer is.
+struct alignas(64) CPUBlockHeader {
+    // Size class index, -1 if the block is not cached, or kLargeBlock.
+    int64_t size_class_;
+    // Requested size and memory tag of the current allocation of the block,
+    // for the MemoryAccountant.
+    size_t byte_size_;
+    int tag_id_;
+};
+
+static CPUBlockHeader* GetBlockHeader(void* ptr) {
+    return reinterpret_cast<CPUBlockHeader*>(static_cast<char*>(ptr) -
+                                             sizeof(CPUBlockHeader));
+}
+
+// Size class of the blocks allocated with CPUMemoryManager::MallocLarge().
+static constexpr int64_t kLargeBlock = -2;
+
+// Per-thread free lists indexed by size class. Each cache is guarded by its
+// own mutex, which is uncontended except during ReleaseCache().
+struct CPUThreadCache {
+    std::mutex mutex_;
+    std::vector<std::vector<void*>> free_lists_;
+    size_t bytes_cached_ = 0;
+};
+
+// Singleton cacher.
+// Freed blocks are pushed to the calling thread's cache instead of being
+// returned to the system, and are reused by following Malloc calls of the same
+// size class. Sizes are rounded up to 4 classes per power of two, bounding the
+// internal fragmentation to 25%. To clear the cache, use
+// CPUCachedMemoryManager::ReleaseCache().
+class CPUCacher {
+public:
+    static std::shared_ptr<CPUCacher> GetInstance() {
+        static std::shared_ptr<CPUCacher> instance =
+                std::make_shared<CPUCacher>();
+        return instance;
+    }
+
+public:
+    // Smallest size class is 256 bytes.
+    static constexpr int64_t kMinSizeLog2 = 8;
+    // Largest cached size class is 64 MiB, larger blocks are not cached.
+    static constexpr int64_t kMaxSizeLog2 = 26;
+    static constexpr int64_t kSubClasses = 4;
+    static constexpr int64_t kNumSizeClasses =
+            (kMaxSizeLog2 - kMinSizeLog2) * kSubClasses + 1;
+    // A thread releases blocks to the system once its cache holds more bytes.
+    static constexpr size_t kMaxBytesPerThread = size_t(1) << 30;
+
+    // Returns the size class index of byte_size, or -1 if not cacheable.
+    static int64_t GetSizeClass(size_t byte_size) {
+        if (byte_size <= (size_t(1) << kMinSizeLog2)) {
+            return 0;
+        }
+        if (byte_size > (size_t(1) << kMaxSizeLog2)) {
+            return -1;
+        }
+        int64_t log2 = kMinSizeLog2;
+        while ((size_t(1) << (log2 + 1)) < byte_size) {
+            log2++;
+        }
+        // byte_size in (2^log2, 2^(log2+1)], split into kSubClasses steps.
+        size_t step = (size_t(1) << log2) / kSubClasses;
+        int64_t sub = static_cast<int64_t>(
+                (byte_size - (size_t(1) << log2) + step - 1) / step);
+        return (log2 - kMinSizeLog2) * kSubClasses + sub;
+    }
+
+    static size_t GetSizeClassBytes(int64_t size_class) {
+        if (size_class == 0) {
+            return size_t(1) << kMinSizeLog2;
+        }
+        int64_t log2 = kMinSizeLog2 + (size_class - 1) / kSubClasses;
+        int64_t sub = (size_class - 1) % kSubClasses + 1;
+        return (size_t(1) << log2) + sub * ((size_t(1) << log2) / kSubClasses);
+    }
+
+    void* Malloc(size_t byte_size) {
+        num_mallocs_++;
+        int64_t size_class = GetSizeClass(byte_size);
+
+        if (size_class >= 0) {
+            std::shared_ptr<CPUThreadCache> cache = GetThreadCache();
+            if (cache) {
+                std::lock_guard<std::mutex> lock(cache->mutex_);
+                std::vector<void*>& free_list = cache->free_lists_[size_class];
+                if (!free_list.empty()) {
+                    void* ptr = free_list.back();
+                    free_list.pop_back();
+                    size_t class_bytes = GetSizeClassBytes(size_class);
+                    cache->bytes_cached_ -= class_bytes;
+                    bytes_cached_ -= class_bytes;
+                    num_cached_blocks_--;
+                    num_cache_hits_++;
+                    return ptr;
+                }
+            }
+        }
+
+        size_t alloc_bytes =
+                size_class >= 0 ? GetSizeClassBytes(size_class) : byte_size;
+        if (size_class < 0) {
+            void* raw_ptr = CPUMemoryManager::MallocLarge(
+                    sizeof(CPUBlockHeader) + alloc_bytes);
+            if (raw_ptr) {
+                static_cast<CPUBlockHeader*>(raw_ptr)->size_class_ =
+                        kLargeBlock;
+                return static_cast<char*>(raw_ptr) + sizeof(CPUBlockHeader);
+            }
+        }
+        void* raw_ptr = std::malloc(sizeof(CPUBlockHeader) + alloc_bytes);
+        if (!raw_ptr) {
+            // The cached blocks may be fragmenting the memory, retry once.
+            ReleaseCache();
+            raw_ptr = std::malloc(sizeof(CPUBlockHeader) + alloc_bytes);
+            if (!raw_ptr) {
+                utility::LogError("CPU malloc failed");
+            }
+        }
+        static_cast<CPUBlockHeader*>(raw_ptr)->size_class_ = size_class;
+        return static_cast<char*>(raw_ptr) + sizeof(CPUBlockHeader);
+    }
+
+    void Free(void* ptr) {
+        CPUBlockHeader* header = GetBlockHeader(ptr);
+        int64_t size_class = header->size_class_;
+        if (size_class >= 0) {
+            std::shared_ptr<CPUThreadCache> cache = GetThreadCache();
+            size_t class_bytes = GetSizeClassBytes(size_class);
+            if (cache) {
+                std::lock_guard<std::mutex> lock(cache->mutex_);
+                if (cache->bytes_cached_ + class_bytes <= kMaxBytesPerThread) {
+                    cache->free_lists_[size_class].push_back(ptr);
+                    cache->bytes_cached_ += class_bytes;
+                    bytes_cached_ += class_bytes;
+                    num_cached_blocks_++;
+                    return;
+                }
+            }
+        }
+        if (size_class == kLargeBlock) {
+            CPUMemoryManager::FreeLarge(header);
+            return;
+        }
+        std::free(header);
+    }
+
+    void ReleaseCache() {
+        std::lock_guard<std::mutex> lock(registry_mutex_);
+        size_t total_bytes = 0;
+        for (const std::shared_ptr<CPUThreadCache>& cache : registry_) {
+            total_bytes += ReleaseThreadCache(*cache);
+        }
+        utility::LogDebug("[CPUCacher] {} bytes released.", total_bytes);
+    }
+
+    CPUCacheStatistics GetStatistics() const {
+        CPUCacheStatistics statistics;
+        statistics.num_mallocs_ = num_mallocs_.load();
+        statistics.num_cache_hits_ = num_cache_hits_.load();
+        statistics.num_cached_blocks_ = num_cached_blocks_.load();
+        statistics.bytes_cached_ = bytes_cached_.load();
+        return statistics;
+    }
+
+private:
+    // Owns the cache of one thread. Releases the cached blocks when the thread
+    // exits.
+    struct ThreadCacheHolder {
+        ThreadCacheHolder() {
+            cache_ = std::make_shared<CPUThreadCache>();
+            cache_->free_lists_.resize(kNumSizeClasses);
+            cacher_ = GetInstance();
+            std::lock_guard<std::mutex> lock(cacher_->registry_mutex_);
+            cacher_->registry_.insert(cache_);
+        }
+        ~ThreadCacheHolder() {
+            thread_cache_alive_ = false;
+            std::lock_guard<std::mutex> lock(cacher_->registry_mutex_);
+            cacher_->ReleaseThreadCache(*cache_);
+            cacher_->registry_.erase(cache_);
+        }
+        std::shared_ptr<CPUThreadCache> cache_;
+        std::shared_ptr<CPUCacher> cacher_;
+    };
+
+    // Returns nullptr if the calling thread's cache has already been
+    // destroyed, e.g. for Tensors freed during static destruction.
+    std::shared_ptr<CPUThreadCache> GetThreadCache() {
+        if (!thread_cache_alive_) {
+            return nullptr;
+        }
+        thread_local ThreadCacheHolder holder;
+        return holder.cache_;
+    }
+
+    // Frees all blocks of cache, returns the number of bytes released.
+    size_t ReleaseThreadCache(CPUThreadCache& cache) {
+        std::lock_guard<std::mutex> lock(cache.mutex_);
+        size_t total_bytes = 0;
+        for (int64_t size_class = 0; size_class < kNumSizeClasses;
+             ++size_class) {
+            std::vector<void*>& free_list = cache.free_lists_[size_class];
+            size_t class_bytes = GetSizeClassBytes(size_class);
+            for (void* ptr : free_list) {
+                std::free(static_cast<char*>(ptr) - sizeof(CPUBlockHeader));
+                total_bytes += class_bytes;
+            }
+            num_cached_blocks_ -= static_cast<int64_t>(free_list.size());
+            free_list.clear();
+        }
+        cache.bytes_cached_ = 0;
+        bytes_cached_ -= static_cast<int64_t>(total_bytes);
+        return total_bytes;
+    }
+
+    std::mutex registry_mutex_;
+    std::unordered_set<std::shared_ptr<CPUThreadCache>> registry_;
+
+    std::atomic<int64_t> num_mallocs_{0};
+    std::atomic<int64_t> num_cache_hits_{0};
+    std::atomic<int64_t> num_cached_blocks_{0};
+    std::atomic<int64_t> bytes_cached_{0};
+
+    static thread_local bool thread_cache_alive_;
+};
+
+thread_local bool CPUCacher::thread_cache_alive_ = true;
+
+CPUCachedMemoryManager::CPUCachedMemoryManager() {}
+
+void* CPUCachedMemoryManager::Malloc(size_t byte_size, const Device& device) {
+    if (byte_size == 0) return nullptr;
+    void* ptr = CPUCacher::GetInstance()->Malloc(byte_size);
+    CPUBlockHeader* header = GetBlockHeader(ptr);
+    header->byte_size_ = byte_size;
+    header->tag_id_ = accountant_.RecordMalloc(byte_size, device);
+    return ptr;
+}
+
+void CPUCachedMemoryManager::Free(void* ptr, const Device& device) {
+    if (ptr == nullptr) return;
+    const CPUBlockHeader* header = GetBlockHeader(ptr);
+    accountant_.RecordFree(header->byte_size_, header->tag_id_, device);
+    CPUCacher::GetInstance()->Free(ptr);
+}
+
+void CPUCachedMemoryManager::Memcpy(void* dst_ptr,
+                                    const Device& dst_device,
+                                    const void* src_ptr,
+                                    const Device& src_device,
+                                    size_t num_bytes) {
+    std::memcpy(dst_ptr, src_ptr, num_bytes);
+}
+
+MemoryStatistics CPUCachedMemoryManager::GetStatistics(const Device& device) {
+    MemoryStatistics statistics = accountant_.GetStatistics(device);
+    statistics.bytes_cached_ = GetCacheStatistics().bytes_cached_;
+    return statistics;
+}
+
+void CPUCachedMemoryManager::ReleaseCache() {
+    CPUCacher::GetInstance()->ReleaseCache();
+}
+
+CPUCacheStatistics CPUCachedMemoryManager::GetCacheStatistics() {
+    return CPUCacher::GetInstance()->GetStatistics();
+}
+
+}  // namespace core
+}  // namespace open3d
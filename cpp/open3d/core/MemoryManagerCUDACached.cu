@@ -55,6 +55,11 @@ struct Block {
 
     bool in_use_;
 
+    // Requested size and memory tag of the allocation using the block, for
+    // the MemoryAccountant.
+    size_t requested_size_ = 0;
+    int tag_id_ = 0;
+
     Block(int device,
           size_t size,
           void* ptr = nullptr,
@@ -123,7 +128,8 @@ public:
         ReleaseCache();
     }
 
-    void* Malloc(size_t byte_size, const Device& device) {
+    // Returns the block allocated for byte_size bytes.
+    BlockPtr Malloc(size_t byte_size, const Device& device) {
         auto find_free_block = [&](BlockPtr query_block) -> BlockPtr {
             auto pool = get_pool(query_block->size_);
             auto it = pool->lower_bound(query_block);
@@ -146,6 +152,7 @@ public:
             BlockPtr new_block = new Block(device.GetID(), alloc_size, ptr);
             new_block->in_use_ = true;
             allocated_blocks_.insert({ptr, new_block});
+            return new_block;
         } else {
             ptr = found_block->ptr_;
 
@@ -170,9 +177,14 @@ public:
             found_block->size_ = alloc_size;
             found_block->in_use_ = true;
             allocated_blocks_.insert({ptr, found_block});
+            return found_block;
         }
+    }
 
-        return ptr;
+    // Returns the block allocated at ptr, or nullptr.
+    BlockPtr GetAllocatedBlock(void* ptr) const {
+        auto it = allocated_blocks_.find(ptr);
+        return it == allocated_blocks_.end() ? nullptr : it->second;
     }
 
     void Free(void* ptr, const Device& device) {
@@ -283,6 +295,20 @@ public:
         utility::LogInfo("[CUDACacher] {} bytes released.", total_bytes);
     }
 
+    // Returns the total size of the free blocks of device \p device_id.
+    size_t GetCachedBytes(int device_id) const {
+        size_t total_bytes = 0;
+        for (const std::shared_ptr<BlockPool>& pool :
+             {small_block_pool_, large_block_pool_}) {
+            for (const BlockPtr& block : *pool) {
+                if (block->device_ == device_id) {
+                    total_bytes += block->size_;
+                }
+            }
+        }
+        return total_bytes;
+    }
+
 private:
     std::unordered_map<void*, BlockPtr> allocated_blocks_;
     std::shared_ptr<BlockPool> small_block_pool_;
@@ -303,7 +329,10 @@ void* CUDACachedMemoryManager::Malloc(size_t byte_size, const Device& device) {
 
     if (device.GetType() == Device::DeviceType::CUDA) {
         std::shared_ptr<CUDACacher> instance = CUDACacher::GetInstance();
-        return instance->Malloc(byte_size, device);
+        BlockPtr block = instance->Malloc(byte_size, device);
+        block->requested_size_ = byte_size;
+        block->tag_id_ = accountant_.RecordMalloc(byte_size, device);
+        return block->ptr_;
     } else {
         utility::LogError(
                 "[CUDACachedMemoryManager] Malloc: Unimplemented device.");
@@ -321,6 +350,11 @@ void CUDACachedMemoryManager::Free(void* ptr, const Device& device) {
     if (device.GetType() == Device::DeviceType::CUDA) {
         if (ptr && IsCUDAPointer(ptr)) {
             std::shared_ptr<CUDACacher> instance = CUDACacher::GetInstance();
+            BlockPtr block = instance->GetAllocatedBlock(ptr);
+            if (block) {
+                accountant_.RecordFree(block->requested_size_, block->tag_id_,
+                                       device);
+            }
             instance->Free(ptr, device);
         } else {
             utility::LogError(
@@ -388,6 +422,22 @@ void CUDACachedMemoryManager::Memcpy(void* dst_ptr,
     }
 }
 
+void CUDACachedMemoryManager::MemcpyAsync(void* dst_ptr,
+                                          const Device& dst_device,
+                                          const void* src_ptr,
+                                          const Device& src_device,
+                                          size_t num_bytes) {
+    CUDAMemcpyAsync(*this, dst_ptr, dst_device, src_ptr, src_device,
+                    num_bytes);
+}
+
+MemoryStatistics CUDACachedMemoryManager::GetStatistics(const Device& device) {
+    MemoryStatistics statistics = accountant_.GetStatistics(device);
+    statistics.bytes_cached_ = static_cast<int64_t>(
+            CUDACacher::GetInstance()->GetCachedBytes(device.GetID()));
+    return statistics;
+}
+
 bool CUDACachedMemoryManager::IsCUDAPointer(const void* ptr) {
     cudaPointerAttributes attributes;
     cudaPointerGetAttributes(&attributes, ptr);
@@ -0,0 +1,81 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cuda.h>
+#include <cuda_runtime.h>
+
+#include <cstring>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/MemoryManager.h"
+
+namespace open3d {
+namespace core {
+
+CUDAPinnedMemoryManager::CUDAPinnedMemoryManager() {}
+
+void* CUDAPinnedMemoryManager::Malloc(size_t byte_size, const Device& device) {
+    if (byte_size == 0) return nullptr;
+
+    void* ptr;
+    if (device.GetType() == Device::DeviceType::CPU) {
+        OPEN3D_CUDA_CHECK(
+                cudaHostAlloc(&ptr, byte_size, cudaHostAllocPortable));
+        records_.Insert(ptr, byte_size,
+                        accountant_.RecordMalloc(byte_size, device));
+    } else {
+        utility::LogError(
+                "CUDAPinnedMemoryManager::Malloc: Unimplemented device.");
+    }
+    return ptr;
+}
+
+void CUDAPinnedMemoryManager::Free(void* ptr, const Device& device) {
+    if (ptr == nullptr) return;
+
+    if (device.GetType() == Device::DeviceType::CPU) {
+        size_t byte_size;
+        int tag_id;
+        if (records_.Erase(ptr, byte_size, tag_id)) {
+            accountant_.RecordFree(byte_size, tag_id, device);
+        }
+        OPEN3D_CUDA_CHECK(cudaFreeHost(ptr));
+    } else {
+        utility::LogError(
+                "CUDAPinnedMemoryManager::Free: Unimplemented device.");
+    }
+}
+
+void CUDAPinnedMemoryManager::Memcpy(void* dst_ptr,
+                                     const Device& dst_device,
+                                     const void* src_ptr,
+                                     const Device& src_device,
+                                     size_t num_bytes) {
+    std::memcpy(dst_ptr, src_ptr, num_bytes);
+}
+
+}  // namespace core
+}  // namespace open3d
@@ -41,6 +41,8 @@ void* CUDASimpleMemoryManager::Malloc(size_t byte_size, const Device& device) {
     void* ptr;
     if (device.GetType() == Device::DeviceType::CUDA) {
         OPEN3D_CUDA_CHECK(cudaMalloc(static_cast<void**>(&ptr), byte_size));
+        records_.Insert(ptr, byte_size,
+                        accountant_.RecordMalloc(byte_size, device));
     } else {
         utility::LogError(
                 "CUDASimpleMemoryManager::Malloc: Unimplemented device.");
@@ -52,6 +54,11 @@ void CUDASimpleMemoryManager::Free(void* ptr, const Device& device) {
     CUDADeviceSwitcher switcher(device);
     if (device.GetType() == Device::DeviceType::CUDA) {
         if (ptr && IsCUDAPointer(ptr)) {
+            size_t byte_size;
+            int tag_id;
+            if (records_.Erase(ptr, byte_size, tag_id)) {
+                accountant_.RecordFree(byte_size, tag_id, device);
+            }
             OPEN3D_CUDA_CHECK(cudaFree(ptr));
         }
     } else {
@@ -116,6 +123,15 @@ void CUDASimpleMemoryManager::Memcpy(void* dst_ptr,
     }
 }
 
+void CUDASimpleMemoryManager::MemcpyAsync(void* dst_ptr,
+                                          const Device& dst_device,
+                                          const void* src_ptr,
+                                          const Device& src_device,
+                                          size_t num_bytes) {
+    CUDAMemcpyAsync(*this, dst_ptr, dst_device, src_ptr, src_device,
+                    num_bytes);
+}
+
 bool CUDASimpleMemoryManager::IsCUDAPointer(const void* ptr) {
     cudaPointerAttributes attributes;
     cudaPointerGetAttributes(&attributes, ptr);
@@ -0,0 +1,300 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+/// \file ParallelFor.h
+/// \brief Device-agnostic parallel loops for user-defined kernels.
+///
+/// ParallelFor() and ParallelReduce() run a lambda over [0, n) on a CPU or
+/// CUDA device, so that a fused op only has to be written once:
+///
+/// ```cpp
+/// core::TensorAccessor<const float, 2> src(points);
+/// core::TensorAccessor<float, 1> dst(norms);
+/// core::ParallelFor(device, n, [=] OPEN3D_HOST_DEVICE(int64_t i) {
+///     dst(i) = sqrtf(src(i, 0) * src(i, 0) + src(i, 1) * src(i, 1) +
+///                    src(i, 2) * src(i, 2));
+/// });
+/// ```
+///
+/// Code calling them on CUDA devices must be compiled by nvcc with
+/// --extended-lambda, e.g. in a .cu file or a .cpp file compiled as CUDA.
+/// The same source then serves both devices. Calls on CUDA devices from code
+/// compiled by the host compiler raise an error.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Device.h"
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/ParallelUtil.h"
+#include "open3d/utility/Console.h"
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+#include "open3d/core/CUDAState.cuh"
+#include "open3d/core/MemoryManager.h"
+#include "open3d/core/kernel/CUDALauncher.cuh"
+#endif
+
+namespace open3d {
+namespace core {
+
+/// \class TensorAccessor
+///
+/// Typed view of the elements of a tensor with NDIMS dimensions, usable in
+/// host and device code. The view holds the data pointer, shape and strides
+/// of the tensor, but does not keep the tensor alive. Use a const scalar_t
+/// for read-only access.
+template <typename scalar_t, int NDIMS>
+class TensorAccessor {
+public:
+    static_assert(NDIMS > 0, "TensorAccessor needs at least one dimension.");
+
+    explicit TensorAccessor(const Tensor& tensor) {
+        tensor.AssertDtype(
+                Dtype::FromType<typename std::remove_const<scalar_t>::type>());
+        if (tensor.NumDims() != NDIMS) {
+            utility::LogError(
+                    "TensorAccessor expects a tensor with {} dimensions, but "
+                    "got shape {}.",
+                    NDIMS, tensor.GetShape().ToString());
+        }
+        for (int dim = 0; dim < NDIMS; ++dim) {
+            shape_[dim] = tensor.GetShape(dim);
+            strides_[dim] = tensor.GetStride(dim);
+        }
+        data_ptr_ = static_cast<scalar_t*>(
+                const_cast<void*>(tensor.GetDataPtr()));
+    }
+
+    /// Returns the size of dimension \p dim.
+    OPEN3D_HOST_DEVICE int64_t GetShape(int dim) const { return shape_[dim]; }
+
+    /// Returns the pointer to the first element.
+    OPEN3D_HOST_DEVICE scalar_t* GetDataPtr() const { return data_ptr_; }
+
+    /// Returns the element at the given NDIMS indices. Indices are not
+    /// checked against the shape.
+    template <typename... index_t>
+    OPEN3D_HOST_DEVICE scalar_t& operator()(index_t... indices) const {
+        static_assert(sizeof...(index_t) == NDIMS,
+                      "Expected one index per dimension.");
+        const int64_t index_array[] = {static_cast<int64_t>(indices)...};
+        int64_t offset = 0;
+        for (int dim = 0; dim < NDIMS; ++dim) {
+            offset += index_array[dim] * strides_[dim];
+        }
+        return data_ptr_[offset];
+    }
+
+private:
+    scalar_t* data_ptr_;
+    int64_t shape_[NDIMS];
+    int64_t strides_[NDIMS];
+};
+
+namespace detail {
+
+/// Result of one range of ParallelReduce on CPU. The padding keeps the results
+/// of different threads out of each other's cache lines, and, unlike
+/// std::vector<bool>, a bool result is never packed with others into a word
+/// written by several threads.
+template <typename scalar_t>
+struct ParallelReduceSlot {
+    scalar_t value;
+    char padding[64];
+};
+
+}  // namespace detail
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+namespace detail {
+
+static constexpr int kParallelReduceBlockSize = 256;
+static constexpr int64_t kParallelReduceMaxBlocks = 1024;
+
+/// Reduces a grid-strided subset of [0, n) per thread, then the threads of
+/// each block in shared memory, and writes one result per block.
+template <typename scalar_t, typename map_func_t, typename reduce_func_t>
+__global__ void ParallelReduceKernel(int64_t n,
+                                     scalar_t identity,
+                                     map_func_t map_func,
+                                     reduce_func_t reduce_func,
+                                     scalar_t* block_results) {
+    // Raw storage, as __shared__ variables cannot have constructors.
+    __shared__ typename std::aligned_storage<sizeof(scalar_t),
+                                             alignof(scalar_t)>::type
+            storage[kParallelReduceBlockSize];
+    scalar_t* shared = reinterpret_cast<scalar_t*>(storage);
+
+    scalar_t result = identity;
+    for (int64_t workload_idx =
+                 static_cast<int64_t>(blockIdx.x) * kParallelReduceBlockSize +
+                 threadIdx.x;
+         workload_idx < n; workload_idx += static_cast<int64_t>(gridDim.x) *
+                                           kParallelReduceBlockSize) {
+        result = reduce_func(result, map_func(workload_idx));
+    }
+    shared[threadIdx.x] = result;
+    __syncthreads();
+
+    for (int stride = kParallelReduceBlockSize / 2; stride > 0; stride >>= 1) {
+        if (threadIdx.x < stride) {
+            shared[threadIdx.x] = reduce_func(shared[threadIdx.x],
+                                              shared[threadIdx.x + stride]);
+        }
+        __syncthreads();
+    }
+    if (threadIdx.x == 0) {
+        block_results[blockIdx.x] = shared[0];
+    }
+}
+
+}  // namespace detail
+#endif
+
+/// Calls func(workload_idx) for workload_idx in [0, n) in parallel on
+/// \p device. In code compiled by nvcc, func must be an OPEN3D_HOST_DEVICE
+/// lambda capturing by value. On CUDA devices, the kernel is launched on the
+/// current CUDA stream without synchronizing.
+///
+/// \param schedule Scheduling of the workloads on CPU, see
+/// kernel::ParallelSchedule. Has no effect on CUDA devices.
+template <typename func_t>
+void ParallelFor(const Device& device,
+                 int64_t n,
+                 const func_t& func,
+                 const kernel::ParallelSchedule& schedule =
+                         kernel::ParallelSchedule()) {
+    if (n <= 0) {
+        return;
+    }
+    if (device.GetType() == Device::DeviceType::CPU) {
+        kernel::ParallelFor(n, func, schedule);
+    } else if (device.GetType() == Device::DeviceType::CUDA) {
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+        CUDADeviceSwitcher switcher(device);
+        kernel::CUDALauncher::LaunchGeneralKernel(n, func);
+#else
+        utility::LogError(
+                "ParallelFor on {} must be called from code compiled by nvcc "
+                "with BUILD_CUDA_MODULE.",
+                device.ToString());
+#endif
+    } else {
+        utility::LogError("Unimplemented device.");
+    }
+}
+
+/// Returns the reduction of map_func(workload_idx) for workload_idx in
+/// [0, n) with reduce_func, computed in parallel on \p device.
+///
+/// \param identity Identity element of reduce_func, the result for n <= 0.
+/// \param map_func Returns the scalar_t value of one workload.
+/// \param reduce_func Combines two scalar_t values. Must be associative, the
+/// order of the combinations is unspecified. In code compiled by nvcc,
+/// map_func and reduce_func must be OPEN3D_HOST_DEVICE lambdas, and scalar_t
+/// must be trivially copyable.
+///
+/// Blocks until the result is available.
+template <typename scalar_t, typename map_func_t, typename reduce_func_t>
+scalar_t ParallelReduce(const Device& device,
+                        int64_t n,
+                        const scalar_t& identity,
+                        const map_func_t& map_func,
+                        const reduce_func_t& reduce_func) {
+    if (n <= 0) {
+        return identity;
+    }
+    if (device.GetType() == Device::DeviceType::CPU) {
+        // Contiguous ranges per thread, combined in order, so the result only
+        // depends on the number of threads.
+        int64_t num_ranges = std::min<int64_t>(kernel::GetMaxThreads(), n);
+        int64_t range_size = (n + num_ranges - 1) / num_ranges;
+        std::vector<detail::ParallelReduceSlot<scalar_t>> range_results(
+                num_ranges, detail::ParallelReduceSlot<scalar_t>{identity, {}});
+        kernel::ParallelFor(num_ranges, [&](int64_t range_idx) {
+            int64_t begin = range_idx * range_size;
+            int64_t end = std::min(begin + range_size, n);
+            scalar_t result = identity;
+            for (int64_t workload_idx = begin; workload_idx < end;
+                 ++workload_idx) {
+                result = reduce_func(result, map_func(workload_idx));
+            }
+            range_results[range_idx].value = result;
+        });
+        scalar_t result = identity;
+        for (const auto& range_result : range_results) {
+            result = reduce_func(result, range_result.value);
+        }
+        return result;
+    } else if (device.GetType() == Device::DeviceType::CUDA) {
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+        static_assert(std::is_trivially_copyable<scalar_t>::value,
+                      "scalar_t must be trivially copyable on CUDA devices.");
+        CUDADeviceSwitcher switcher(device);
+        int64_t num_blocks = std::min<int64_t>(
+                (n + detail::kParallelReduceBlockSize - 1) /
+                        detail::kParallelReduceBlockSize,
+                detail::kParallelReduceMaxBlocks);
+        scalar_t* block_results = static_cast<scalar_t*>(
+                MemoryManager::Malloc(num_blocks * sizeof(scalar_t), device));
+        cudaStream_t stream = GetCUDACurrentStream();
+        detail::ParallelReduceKernel<<<num_blocks,
+                                       detail::kParallelReduceBlockSize, 0,
+                                       stream>>>(n, identity, map_func,
+                                                 reduce_func, block_results);
+        OPEN3D_GET_LAST_CUDA_ERROR("ParallelReduce failed.");
+        OPEN3D_CUDA_CHECK(cudaStreamSynchronize(stream));
+
+        std::vector<scalar_t> host_results(num_blocks, identity);
+        MemoryManager::MemcpyToHost(host_results.data(), block_results,
+                                    device, num_blocks * sizeof(scalar_t));
+        MemoryManager::Free(block_results, device);
+        scalar_t result = identity;
+        for (const scalar_t& block_result : host_results) {
+            result = reduce_func(result, block_result);
+        }
+        return result;
+#else
+        utility::LogError(
+                "ParallelReduce on {} must be called from code compiled by "
+                "nvcc with BUILD_CUDA_MODULE.",
+                device.ToString());
+#endif
+    } else {
+        utility::LogError("Unimplemented device.");
+    }
+    return identity;
+}
+
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,133 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/core/SegmentedReduce.h"
+
+#include <algorithm>
+
+#include "open3d/core/kernel/IndexGetSet.h"
+#include "open3d/core/kernel/Sort.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+
+std::pair<Tensor, Tensor> SegmentedReduce(const Tensor& keys,
+                                          const Tensor& values,
+                                          kernel::ReductionOpCode op_code) {
+    if (values.NumDims() == 0 || values.GetLength() != keys.GetLength()) {
+        utility::LogError(
+                "SegmentedReduce: values of shape {} must have one row per "
+                "key, but got {} keys.",
+                values.GetShape(), keys.GetLength());
+    }
+    values.AssertDevice(keys.GetDevice());
+
+    Tensor sorted_keys, order;
+    kernel::ArgSort(keys, sorted_keys, order);
+    Tensor unique_keys, segment_ids, segment_splits;
+    kernel::RunLengthEncode(sorted_keys, unique_keys, segment_ids,
+                            segment_splits);
+
+    // Group the rows by key so that each segment is a contiguous range.
+    const SizeVector& values_shape = values.GetShape();
+    SizeVector row_shape(values_shape.begin() + 1, values_shape.end());
+    Tensor sorted_values = values.IndexGet({order}).Reshape(
+            {values.GetLength(), row_shape.NumElements()});
+
+    const int64_t num_segments = unique_keys.GetLength();
+    Tensor reduced({num_segments, row_shape.NumElements()}, values.GetDtype(),
+                   values.GetDevice());
+    kernel::SegmentedReduce(sorted_values, segment_splits, reduced, op_code);
+
+    SizeVector reduced_shape{num_segments};
+    reduced_shape.insert(reduced_shape.end(), row_shape.begin(),
+                         row_shape.end());
+    return std::make_pair(unique_keys, reduced.Reshape(reduced_shape));
+}
+
+void ScatterReduce_(Tensor& dst,
+                    const Tensor& index,
+                    const Tensor& values,
+                    kernel::ReductionOpCode op_code) {
+    const SizeVector& dst_shape = dst.GetShape();
+    const SizeVector& values_shape = values.GetShape();
+    if (dst.NumDims() == 0 || values.NumDims() != dst.NumDims() ||
+        index.NumDims() != 1 || values.GetLength() != index.GetLength() ||
+        !std::equal(values_shape.begin() + 1, values_shape.end(),
+                    dst_shape.begin() + 1)) {
+        utility::LogError(
+                "ScatterReduce_: values of shape {} must have one row of dst "
+                "shape {} per index, but got {} indices.",
+                values_shape, dst_shape, index.GetLength());
+    }
+    values.AssertDtype(dst.GetDtype());
+    values.AssertDevice(dst.GetDevice());
+    index.AssertDevice(dst.GetDevice());
+
+    const int64_t row_size =
+            SizeVector(dst_shape.begin() + 1, dst_shape.end()).NumElements();
+    Tensor dst_contiguous = dst.Contiguous();
+    Tensor dst_view = dst_contiguous.Reshape({1, dst.GetLength(), row_size});
+    kernel::IndexReduce(
+            index.To(Dtype::Int64),
+            values.Contiguous().Reshape({1, values.GetLength(), row_size}),
+            dst_view, op_code);
+    if (!dst.IsContiguous()) {
+        dst.AsRvalue() = dst_contiguous;
+    }
+}
+
+std::pair<Tensor, Tensor> ScatterMean(const Tensor& index,
+                                      const Tensor& values,
+                                      int64_t num_rows) {
+    if (values.NumDims() == 0) {
+        utility::LogError("ScatterMean: values must have at least one dim.");
+    }
+    SizeVector mean_shape = values.GetShape();
+    mean_shape[0] = num_rows;
+    Tensor mean = Tensor::Zeros(mean_shape, values.GetDtype(),
+                                values.GetDevice());
+    ScatterReduce_(mean, index, values, kernel::ReductionOpCode::Sum);
+    Tensor counts = Tensor::Zeros({num_rows}, Dtype::Int64, values.GetDevice());
+    ScatterReduce_(counts, index,
+                   Tensor::Ones({index.GetLength()}, Dtype::Int64,
+                                values.GetDevice()),
+                   kernel::ReductionOpCode::Sum);
+
+    // Rows without values keep their zero sum.
+    SizeVector divisor_shape(mean_shape.size(), 1);
+    divisor_shape[0] = num_rows;
+    Tensor divisor = (counts + counts.Eq(0).To(Dtype::Int64))
+                             .To(values.GetDtype())
+                             .Reshape(divisor_shape);
+    mean.Div_(divisor);
+    return std::make_pair(mean, counts);
+}
+
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,85 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <utility>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/Reduction.h"
+
+namespace open3d {
+namespace core {
+
+/// \brief Reduces the rows of \p values that share the same key.
+///
+/// E.g. SegmentedReduce([2, 0, 2], [[1, 1], [2, 2], [3, 3]], Sum)
+///      -> ([0, 2], [[2, 2], [4, 4]])
+/// \param keys 1-D tensor of length N. Multi-column keys, e.g. voxel
+/// coordinates, can be packed into a single Int64 key first.
+/// \param values Tensor of shape {N, ...} on the same device as \p keys.
+/// \param op_code One of Sum, Prod, Min or Max.
+/// \return (unique_keys, reduced): the K distinct keys in ascending order, and
+/// the reduced values of shape {K, ...} in the same order.
+std::pair<Tensor, Tensor> SegmentedReduce(const Tensor& keys,
+                                          const Tensor& values,
+                                          kernel::ReductionOpCode op_code);
+
+/// \brief Reduces the rows of \p values into the rows of \p dst given by
+/// \p index, in-place.
+///
+/// dst[index[i]] = op(dst[index[i]], values[i]); rows of \p dst that are not
+/// indexed are left unchanged. Unlike SegmentedReduce, no sort is needed when
+/// the output rows are known, e.g. voxel, vertex or cluster indices.
+/// E.g. ScatterReduce_([[0], [5], [5]], [1, 0, 2], [[1], [2], [3]], Max)
+///      -> dst = [[2], [5], [5]]
+/// \param dst Tensor of shape {M, ...}.
+/// \param index Int64 (or Int32) 1-D tensor of length N, with values in
+/// [0, M).
+/// \param values Tensor of shape {N, ...} with the dtype of \p dst.
+/// \param op_code One of Sum, Prod, Min or Max. On CUDA, only Float32,
+/// Float64, Int32 and Int64 are supported.
+void ScatterReduce_(Tensor& dst,
+                    const Tensor& index,
+                    const Tensor& values,
+                    kernel::ReductionOpCode op_code);
+
+/// \brief Averages the rows of \p values that share the same index.
+///
+/// \param index Int64 (or Int32) 1-D tensor of length N, with values in
+/// [0, \p num_rows).
+/// \param values Tensor of shape {N, ...}. The mean of integer values is
+/// truncated.
+/// \param num_rows Number of output rows.
+/// \return (mean, counts): the {num_rows, ...} means, zero for the rows
+/// without values, and the Int64 {num_rows} number of values per row.
+std::pair<Tensor, Tensor> ScatterMean(const Tensor& index,
+                                      const Tensor& values,
+                                      int64_t num_rows);
+
+}  // namespace core
+}  // namespace open3d
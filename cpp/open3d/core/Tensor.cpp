@@ -26,13 +26,17 @@
 
 #include "open3d/core/Tensor.h"
 
+#include <numeric>
 #include <sstream>
 
 #include "open3d/core/AdvancedIndexing.h"
 #include "open3d/core/Blob.h"
+#include "open3d/core/CUDAUtils.h"
 #include "open3d/core/Device.h"
 #include "open3d/core/Dispatch.h"
 #include "open3d/core/Dtype.h"
+#include "open3d/core/LazyTensor.h"
+#include "open3d/core/MemoryManager.h"
 #include "open3d/core/ShapeUtil.h"
 #include "open3d/core/SizeVector.h"
 #include "open3d/core/TensorKey.h"
@@ -78,10 +82,16 @@ private:
         DLDataType dl_data_type;
         Dtype dtype = o3d_tensor_.GetDtype();
 
-        if (dtype == Dtype::Float32) {
+        if (dtype == Dtype::Float16) {
+            dl_data_type.code = DLDataTypeCode::kDLFloat;
+        } else if (dtype == Dtype::Float32) {
             dl_data_type.code = DLDataTypeCode::kDLFloat;
         } else if (dtype == Dtype::Float64) {
             dl_data_type.code = DLDataTypeCode::kDLFloat;
+        } else if (dtype == Dtype::Int8) {
+            dl_data_type.code = DLDataTypeCode::kDLInt;
+        } else if (dtype == Dtype::Int16) {
+            dl_data_type.code = DLDataTypeCode::kDLInt;
         } else if (dtype == Dtype::Int32) {
             dl_data_type.code = DLDataTypeCode::kDLInt;
         } else if (dtype == Dtype::Int64) {
@@ -180,6 +190,15 @@ Tensor Tensor::Empty(const SizeVector& shape,
     return Tensor(shape, dtype, device);
 }
 
+Tensor Tensor::EmptyPinned(const SizeVector& shape, Dtype dtype) {
+    void* data_ptr = MemoryManager::MallocPinned(shape.NumElements() *
+                                                 dtype.ByteSize());
+    auto blob = std::make_shared<Blob>(
+            Device("CPU:0"), data_ptr,
+            [data_ptr](void*) { MemoryManager::FreePinned(data_ptr); });
+    return Tensor(shape, DefaultStrides(shape), data_ptr, dtype, blob);
+}
+
 Tensor Tensor::Zeros(const SizeVector& shape,
                      Dtype dtype,
                      const Device& device) {
@@ -478,6 +497,28 @@ Tensor Tensor::Copy(const Device& device) const {
     return dst_tensor;
 }
 
+Tensor Tensor::CopyAsync(const Device& device) const {
+    if (!IsContiguous()) {
+        return Copy(device);
+    }
+    Tensor dst_tensor(shape_, dtype_, device);
+    MemoryManager::MemcpyAsync(dst_tensor.GetDataPtr(), device, GetDataPtr(),
+                               GetDevice(),
+                               dtype_.ByteSize() * shape_.NumElements());
+#ifdef BUILD_CUDA_MODULE
+    // The copy may still be running when the Tensors are destroyed, keep
+    // their memory from being reused until it is done.
+    const Device& stream_device =
+            GetDevice().GetType() == Device::DeviceType::CUDA ? GetDevice()
+                                                              : device;
+    if (stream_device.GetType() == Device::DeviceType::CUDA &&
+        blob_ != nullptr) {
+        ReleaseAfterCurrentStream(stream_device, {blob_, dst_tensor.blob_});
+    }
+#endif
+    return dst_tensor;
+}
+
 Tensor Tensor::To(Dtype dtype, bool copy) const {
     if (!copy && dtype_ == dtype) {
         return *this;
@@ -641,7 +682,7 @@ std::string Tensor::ScalarPtrToString(const void* ptr) const {
     } else if (dtype_.IsObject()) {
         str = fmt::format("{}", fmt::ptr(ptr));
     } else {
-        DISPATCH_DTYPE_TO_TEMPLATE(dtype_, [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_FLOAT16(dtype_, [&]() {
             str = fmt::format("{}", *static_cast<const scalar_t*>(ptr));
         });
     }
@@ -715,6 +756,15 @@ Tensor Tensor::Slice(int64_t dim,
 }
 
 Tensor Tensor::IndexGet(const std::vector<Tensor>& index_tensors) const {
+    // A single boolean mask over the leading dimensions is a stream
+    // compaction, which does not need the NonZero index tensors.
+    if (index_tensors.size() == 1 &&
+        index_tensors[0].GetDtype() == Dtype::Bool &&
+        index_tensors[0].NumDims() > 0 &&
+        index_tensors[0].NumDims() <= NumDims()) {
+        return MaskedSelect(index_tensors[0]);
+    }
+
     AdvancedIndexPreprocessor aip(*this, index_tensors);
     Tensor dst = Tensor(aip.GetOutputShape(), dtype_, GetDevice());
     kernel::IndexGet(aip.GetTensor(), dst, aip.GetIndexTensors(),
@@ -723,6 +773,10 @@ Tensor Tensor::IndexGet(const std::vector<Tensor>& index_tensors) const {
     return dst;
 }
 
+Tensor Tensor::MaskedSelect(const Tensor& mask) const {
+    return kernel::MaskedSelect(*this, mask);
+}
+
 void Tensor::IndexSet(const std::vector<Tensor>& index_tensors,
                       const Tensor& src_tensor) {
     AdvancedIndexPreprocessor aip(*this, index_tensors);
@@ -731,6 +785,44 @@ void Tensor::IndexSet(const std::vector<Tensor>& index_tensors,
                      aip.GetIndexedShape(), aip.GetIndexedStrides());
 }
 
+Tensor Tensor::IndexAdd_(int64_t dim, const Tensor& index, const Tensor& src) {
+    if (NumDims() == 0) {
+        utility::LogError("IndexAdd_ is not supported for 0-D tensors.");
+    }
+    dim = shape_util::WrapDim(dim, NumDims());
+    if (index.NumDims() != 1) {
+        utility::LogError("IndexAdd_: index must be 1-D, but got shape {}.",
+                          index.GetShape());
+    }
+    SizeVector expected_shape = shape_;
+    expected_shape[dim] = index.GetLength();
+    if (src.GetShape() != expected_shape) {
+        utility::LogError(
+                "IndexAdd_: src must have shape {} for {} indices along dim "
+                "{}, but got {}.",
+                expected_shape, index.GetLength(), dim, src.GetShape());
+    }
+    src.AssertDtype(dtype_);
+    src.AssertDevice(GetDevice());
+    index.AssertDevice(GetDevice());
+
+    // View both tensors as {outer, dim, inner}.
+    const int64_t outer =
+            SizeVector(shape_.begin(), shape_.begin() + dim).NumElements();
+    const int64_t inner =
+            SizeVector(shape_.begin() + dim + 1, shape_.end()).NumElements();
+    Tensor dst = Contiguous();
+    Tensor dst_view = dst.Reshape({outer, shape_[dim], inner});
+    kernel::IndexReduce(
+            index.To(Dtype::Int64),
+            src.Contiguous().Reshape({outer, index.GetLength(), inner}),
+            dst_view, kernel::ReductionOpCode::Sum);
+    if (!IsContiguous()) {
+        AsRvalue() = dst;
+    }
+    return *this;
+}
+
 Tensor Tensor::Permute(const SizeVector& dims) const {
     // Check dimension size
     if (static_cast<int64_t>(dims.size()) != NumDims()) {
@@ -795,6 +887,69 @@ Tensor Tensor::T() const {
     }
 }
 
+/// Writes src.Permute(dims) to dst, reusing dst's memory when possible.
+static void PermuteContiguousTo(const Tensor& src,
+                                const SizeVector& dims,
+                                Tensor& dst) {
+    Tensor permuted = src.Permute(dims);
+    bool reuse_dst = dst.IsContiguous() &&
+                     dst.GetShape() == permuted.GetShape() &&
+                     dst.GetDtype() == src.GetDtype() &&
+                     dst.GetDevice() == src.GetDevice() &&
+                     dst.GetBlob() != src.GetBlob();
+    if (reuse_dst && !permuted.IsContiguous()) {
+        dst.AsRvalue() = permuted;
+    } else {
+        dst = permuted.Contiguous();
+    }
+}
+
+static SizeVector ChannelFirstDims(int64_t n_dims) {
+    if (n_dims < 2) {
+        utility::LogError(
+                "Layout conversion expects a Tensor with >= 2 dimensions, but "
+                "the Tensor has {} dimensions.",
+                n_dims);
+    }
+    SizeVector dims(n_dims);
+    dims[0] = n_dims - 1;
+    std::iota(dims.begin() + 1, dims.end(), 0);
+    return dims;
+}
+
+static SizeVector ChannelLastDims(int64_t n_dims) {
+    if (n_dims < 2) {
+        utility::LogError(
+                "Layout conversion expects a Tensor with >= 2 dimensions, but "
+                "the Tensor has {} dimensions.",
+                n_dims);
+    }
+    SizeVector dims(n_dims);
+    std::iota(dims.begin(), dims.end() - 1, 1);
+    dims[n_dims - 1] = 0;
+    return dims;
+}
+
+Tensor Tensor::ToChannelFirst() const {
+    Tensor dst;
+    ToChannelFirst(dst);
+    return dst;
+}
+
+void Tensor::ToChannelFirst(Tensor& dst) const {
+    PermuteContiguousTo(*this, ChannelFirstDims(NumDims()), dst);
+}
+
+Tensor Tensor::ToChannelLast() const {
+    Tensor dst;
+    ToChannelLast(dst);
+    return dst;
+}
+
+void Tensor::ToChannelLast(Tensor& dst) const {
+    PermuteContiguousTo(*this, ChannelLastDims(NumDims()), dst);
+}
+
 double Tensor::Det() const {
     // TODO: Create a proper op for Determinant.
     this->AssertShape({3, 3});
@@ -806,6 +961,17 @@ double Tensor::Det() const {
     return static_cast<double>(D_[0][0].Item<float>());
 }
 
+/// Checks the output tensor of an output version of an op.
+static void AssertOutputTensor(const Tensor& dst,
+                               const SizeVector& shape,
+                               Dtype dtype,
+                               const Device& device) {
+    const std::string error_msg = "invalid output tensor";
+    dst.AssertShape(shape, error_msg);
+    dst.AssertDtype(dtype, error_msg);
+    dst.AssertDevice(device, error_msg);
+}
+
 Tensor Tensor::Add(const Tensor& value) const {
     Tensor dst_tensor(shape_util::BroadcastedShape(shape_, value.shape_),
                       dtype_, GetDevice());
@@ -813,6 +979,12 @@ Tensor Tensor::Add(const Tensor& value) const {
     return dst_tensor;
 }
 
+void Tensor::Add(const Tensor& value, Tensor& dst) const {
+    AssertOutputTensor(dst, shape_util::BroadcastedShape(shape_, value.shape_),
+                       dtype_, GetDevice());
+    kernel::Add(*this, value, dst);
+}
+
 Tensor Tensor::Add_(const Tensor& value) {
     kernel::Add(*this, value, *this);
     return *this;
@@ -825,6 +997,12 @@ Tensor Tensor::Sub(const Tensor& value) const {
     return dst_tensor;
 }
 
+void Tensor::Sub(const Tensor& value, Tensor& dst) const {
+    AssertOutputTensor(dst, shape_util::BroadcastedShape(shape_, value.shape_),
+                       dtype_, GetDevice());
+    kernel::Sub(*this, value, dst);
+}
+
 Tensor Tensor::Sub_(const Tensor& value) {
     kernel::Sub(*this, value, *this);
     return *this;
@@ -837,6 +1015,12 @@ Tensor Tensor::Mul(const Tensor& value) const {
     return dst_tensor;
 }
 
+void Tensor::Mul(const Tensor& value, Tensor& dst) const {
+    AssertOutputTensor(dst, shape_util::BroadcastedShape(shape_, value.shape_),
+                       dtype_, GetDevice());
+    kernel::Mul(*this, value, dst);
+}
+
 Tensor Tensor::Mul_(const Tensor& value) {
     kernel::Mul(*this, value, *this);
     return *this;
@@ -849,11 +1033,25 @@ Tensor Tensor::Div(const Tensor& value) const {
     return dst_tensor;
 }
 
+void Tensor::Div(const Tensor& value, Tensor& dst) const {
+    AssertOutputTensor(dst, shape_util::BroadcastedShape(shape_, value.shape_),
+                       dtype_, GetDevice());
+    kernel::Div(*this, value, dst);
+}
+
 Tensor Tensor::Div_(const Tensor& value) {
     kernel::Div(*this, value, *this);
     return *this;
 }
 
+LazyTensor Tensor::Lazy() const { return LazyTensor(*this); }
+
+void Tensor::Sum(const SizeVector& dims, bool keepdim, Tensor& dst) const {
+    AssertOutputTensor(dst, shape_util::ReductionShape(shape_, dims, keepdim),
+                       dtype_, GetDevice());
+    kernel::Reduction(*this, dst, dims, keepdim, kernel::ReductionOpCode::Sum);
+}
+
 Tensor Tensor::Sum(const SizeVector& dims, bool keepdim) const {
     Tensor dst(shape_util::ReductionShape(shape_, dims, keepdim), dtype_,
                GetDevice());
@@ -879,6 +1077,26 @@ Tensor Tensor::Mean(const SizeVector& dims, bool keepdim) const {
     return sum * factor;
 }
 
+void Tensor::Prod(const SizeVector& dims, bool keepdim, Tensor& dst) const {
+    AssertOutputTensor(dst, shape_util::ReductionShape(shape_, dims, keepdim),
+                       dtype_, GetDevice());
+    kernel::Reduction(*this, dst, dims, keepdim, kernel::ReductionOpCode::Prod);
+}
+
+void Tensor::Mean(const SizeVector& dims, bool keepdim, Tensor& dst) const {
+    if (dtype_ != Dtype::Float32 && dtype_ != Dtype::Float64) {
+        utility::LogError(
+                "Can only compute mean for Float32 or Float64, got {} instead.",
+                dtype_.ToString());
+    }
+    if (NumElements() == 0) {
+        utility::LogWarning("Computing mean of 0-sized Tensor.");
+    }
+    Sum(dims, keepdim, dst);
+    double factor = static_cast<double>(dst.NumElements()) / NumElements();
+    dst.Mul_(factor);
+}
+
 Tensor Tensor::Prod(const SizeVector& dims, bool keepdim) const {
     Tensor dst(shape_util::ReductionShape(shape_, dims, keepdim), dtype_,
                GetDevice());
@@ -886,6 +1104,12 @@ Tensor Tensor::Prod(const SizeVector& dims, bool keepdim) const {
     return dst;
 }
 
+void Tensor::Min(const SizeVector& dims, bool keepdim, Tensor& dst) const {
+    AssertOutputTensor(dst, shape_util::ReductionShape(shape_, dims, keepdim),
+                       dtype_, GetDevice());
+    kernel::Reduction(*this, dst, dims, keepdim, kernel::ReductionOpCode::Min);
+}
+
 Tensor Tensor::Min(const SizeVector& dims, bool keepdim) const {
     Tensor dst(shape_util::ReductionShape(shape_, dims, keepdim), dtype_,
                GetDevice());
@@ -893,6 +1117,12 @@ Tensor Tensor::Min(const SizeVector& dims, bool keepdim) const {
     return dst;
 }
 
+void Tensor::Max(const SizeVector& dims, bool keepdim, Tensor& dst) const {
+    AssertOutputTensor(dst, shape_util::ReductionShape(shape_, dims, keepdim),
+                       dtype_, GetDevice());
+    kernel::Reduction(*this, dst, dims, keepdim, kernel::ReductionOpCode::Max);
+}
+
 Tensor Tensor::Max(const SizeVector& dims, bool keepdim) const {
     Tensor dst(shape_util::ReductionShape(shape_, dims, keepdim), dtype_,
                GetDevice());
@@ -900,6 +1130,35 @@ Tensor Tensor::Max(const SizeVector& dims, bool keepdim) const {
     return dst;
 }
 
+std::tuple<Tensor, Tensor> Tensor::MinMax(const SizeVector& dims,
+                                          bool keepdim) const {
+    SizeVector dst_shape = shape_util::ReductionShape(shape_, dims, keepdim);
+    Tensor dst_min(dst_shape, dtype_, GetDevice());
+    Tensor dst_max(dst_shape, dtype_, GetDevice());
+    kernel::FusedReduction(*this, dst_min, dst_max, dims, keepdim,
+                           kernel::FusedReductionOpCode::MinMax);
+    return std::make_tuple(dst_min, dst_max);
+}
+
+std::tuple<Tensor, Tensor> Tensor::MeanVar(const SizeVector& dims,
+                                           bool keepdim) const {
+    if (dtype_ != Dtype::Float32 && dtype_ != Dtype::Float64) {
+        utility::LogError(
+                "Can only compute mean and variance for Float32 or Float64, "
+                "got {} instead.",
+                dtype_.ToString());
+    }
+    if (NumElements() == 0) {
+        utility::LogWarning("Computing mean and variance of 0-sized Tensor.");
+    }
+    SizeVector dst_shape = shape_util::ReductionShape(shape_, dims, keepdim);
+    Tensor dst_mean(dst_shape, dtype_, GetDevice());
+    Tensor dst_var(dst_shape, dtype_, GetDevice());
+    kernel::FusedReduction(*this, dst_mean, dst_var, dims, keepdim,
+                           kernel::FusedReductionOpCode::MeanVar);
+    return std::make_tuple(dst_mean, dst_var);
+}
+
 Tensor Tensor::ArgMin(const SizeVector& dims) const {
     Tensor dst(shape_util::ReductionShape(shape_, dims, false), Dtype::Int64,
                GetDevice());
@@ -920,6 +1179,11 @@ Tensor Tensor::Sqrt() const {
     return dst_tensor;
 }
 
+void Tensor::Sqrt(Tensor& dst) const {
+    AssertOutputTensor(dst, shape_, dtype_, GetDevice());
+    kernel::UnaryEW(*this, dst, kernel::UnaryEWOpCode::Sqrt);
+}
+
 Tensor Tensor::Sqrt_() {
     kernel::UnaryEW(*this, *this, kernel::UnaryEWOpCode::Sqrt);
     return *this;
@@ -931,6 +1195,11 @@ Tensor Tensor::Sin() const {
     return dst_tensor;
 }
 
+void Tensor::Sin(Tensor& dst) const {
+    AssertOutputTensor(dst, shape_, dtype_, GetDevice());
+    kernel::UnaryEW(*this, dst, kernel::UnaryEWOpCode::Sin);
+}
+
 Tensor Tensor::Sin_() {
     kernel::UnaryEW(*this, *this, kernel::UnaryEWOpCode::Sin);
     return *this;
@@ -942,6 +1211,11 @@ Tensor Tensor::Cos() const {
     return dst_tensor;
 }
 
+void Tensor::Cos(Tensor& dst) const {
+    AssertOutputTensor(dst, shape_, dtype_, GetDevice());
+    kernel::UnaryEW(*this, dst, kernel::UnaryEWOpCode::Cos);
+}
+
 Tensor Tensor::Cos_() {
     kernel::UnaryEW(*this, *this, kernel::UnaryEWOpCode::Cos);
     return *this;
@@ -953,6 +1227,11 @@ Tensor Tensor::Neg() const {
     return dst_tensor;
 }
 
+void Tensor::Neg(Tensor& dst) const {
+    AssertOutputTensor(dst, shape_, dtype_, GetDevice());
+    kernel::UnaryEW(*this, dst, kernel::UnaryEWOpCode::Neg);
+}
+
 Tensor Tensor::Neg_() {
     kernel::UnaryEW(*this, *this, kernel::UnaryEWOpCode::Neg);
     return *this;
@@ -964,6 +1243,11 @@ Tensor Tensor::Exp() const {
     return dst_tensor;
 }
 
+void Tensor::Exp(Tensor& dst) const {
+    AssertOutputTensor(dst, shape_, dtype_, GetDevice());
+    kernel::UnaryEW(*this, dst, kernel::UnaryEWOpCode::Exp);
+}
+
 Tensor Tensor::Exp_() {
     kernel::UnaryEW(*this, *this, kernel::UnaryEWOpCode::Exp);
     return *this;
@@ -975,6 +1259,11 @@ Tensor Tensor::Abs() const {
     return dst_tensor;
 }
 
+void Tensor::Abs(Tensor& dst) const {
+    AssertOutputTensor(dst, shape_, dtype_, GetDevice());
+    kernel::UnaryEW(*this, dst, kernel::UnaryEWOpCode::Abs);
+}
+
 Tensor Tensor::Abs_() {
     kernel::UnaryEW(*this, *this, kernel::UnaryEWOpCode::Abs);
     return *this;
@@ -986,24 +1275,44 @@ Tensor Tensor::Floor() const {
     return dst_tensor;
 }
 
+void Tensor::Floor(Tensor& dst) const {
+    AssertOutputTensor(dst, shape_, dtype_, GetDevice());
+    kernel::UnaryEW(*this, dst, kernel::UnaryEWOpCode::Floor);
+}
+
 Tensor Tensor::Ceil() const {
     Tensor dst_tensor(shape_, dtype_, GetDevice());
     kernel::UnaryEW(*this, dst_tensor, kernel::UnaryEWOpCode::Ceil);
     return dst_tensor;
 }
 
+void Tensor::Ceil(Tensor& dst) const {
+    AssertOutputTensor(dst, shape_, dtype_, GetDevice());
+    kernel::UnaryEW(*this, dst, kernel::UnaryEWOpCode::Ceil);
+}
+
 Tensor Tensor::Round() const {
     Tensor dst_tensor(shape_, dtype_, GetDevice());
     kernel::UnaryEW(*this, dst_tensor, kernel::UnaryEWOpCode::Round);
     return dst_tensor;
 }
 
+void Tensor::Round(Tensor& dst) const {
+    AssertOutputTensor(dst, shape_, dtype_, GetDevice());
+    kernel::UnaryEW(*this, dst, kernel::UnaryEWOpCode::Round);
+}
+
 Tensor Tensor::Trunc() const {
     Tensor dst_tensor(shape_, dtype_, GetDevice());
     kernel::UnaryEW(*this, dst_tensor, kernel::UnaryEWOpCode::Trunc);
     return dst_tensor;
 }
 
+void Tensor::Trunc(Tensor& dst) const {
+    AssertOutputTensor(dst, shape_, dtype_, GetDevice());
+    kernel::UnaryEW(*this, dst, kernel::UnaryEWOpCode::Trunc);
+}
+
 Device Tensor::GetDevice() const {
     if (blob_ == nullptr) {
         utility::LogError("Blob is null, cannot get device");
@@ -1133,6 +1442,42 @@ Tensor Tensor::Ne_(const Tensor& value) {
     return *this;
 }
 
+Tensor Tensor::Sort() const {
+    Tensor sorted, indices;
+    kernel::ArgSort(*this, sorted, indices);
+    return sorted;
+}
+
+Tensor Tensor::ArgSort() const {
+    Tensor sorted, indices;
+    kernel::ArgSort(*this, sorted, indices);
+    return indices;
+}
+
+std::tuple<Tensor, Tensor, Tensor> Tensor::Unique(bool return_inverse,
+                                                  bool return_counts) const {
+    Tensor sorted, indices;
+    kernel::ArgSort(*this, sorted, indices);
+    Tensor unique, segment_ids, segment_splits;
+    kernel::RunLengthEncode(sorted, unique, segment_ids, segment_splits);
+
+    Tensor inverse;
+    if (return_inverse) {
+        // segment_ids is in sorted order, scatter it back to input order.
+        inverse = Tensor({GetLength()}, Dtype::Int64, GetDevice());
+        if (GetLength() > 0) {
+            inverse.IndexSet({indices}, segment_ids);
+        }
+    }
+    Tensor counts;
+    if (return_counts) {
+        const int64_t num_unique = unique.GetLength();
+        counts = segment_splits.Slice(0, 1, num_unique + 1) -
+                 segment_splits.Slice(0, 0, num_unique);
+    }
+    return std::make_tuple(unique, inverse, counts);
+}
+
 std::vector<Tensor> Tensor::NonZeroNumpy() const {
     Tensor result = kernel::NonZero(*this);
     std::vector<Tensor> results;
@@ -1151,7 +1496,7 @@ bool Tensor::IsNonZero() const {
                 "boolean.");
     }
     bool rc = false;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_FLOAT16(dtype_, [&]() {
         rc = Item<scalar_t>() != static_cast<scalar_t>(0);
     });
     return rc;
@@ -1210,6 +1555,12 @@ Tensor Tensor::FromDLPack(const DLManagedTensor* src) {
             break;
         case DLDataTypeCode::kDLInt:
             switch (src->dl_tensor.dtype.bits) {
+                case 8:
+                    dtype = Dtype::Int8;
+                    break;
+                case 16:
+                    dtype = Dtype::Int16;
+                    break;
                 case 32:
                     dtype = Dtype::Int32;
                     break;
@@ -1223,6 +1574,9 @@ Tensor Tensor::FromDLPack(const DLManagedTensor* src) {
             break;
         case DLDataTypeCode::kDLFloat:
             switch (src->dl_tensor.dtype.bits) {
+                case 16:
+                    dtype = Dtype::Float16;
+                    break;
                 case 32:
                     dtype = Dtype::Float32;
                     break;
@@ -1355,6 +1709,15 @@ Tensor Tensor::Matmul(const Tensor& rhs) const {
     return output;
 }
 
+void Tensor::Matmul(const Tensor& rhs, Tensor& dst) const {
+    Tensor output = dst;
+    core::Matmul(*this, rhs, output);
+    if (!output.IsSame(dst)) {
+        // core::Matmul has allocated a new output.
+        AssertOutputTensor(dst, output.GetShape(), dtype_, GetDevice());
+    }
+}
+
 Tensor Tensor::Solve(const Tensor& rhs) const {
     Tensor output;
     core::Solve(*this, rhs, output);
@@ -30,6 +30,7 @@
 #include <cstddef>
 #include <memory>
 #include <string>
+#include <tuple>
 #include <type_traits>
 
 #include "open3d/core/Blob.h"
@@ -44,6 +45,8 @@
 namespace open3d {
 namespace core {
 
+class LazyTensor;
+
 /// A Tensor is a "view" of a data Blob with shape, stride, data_ptr.
 /// Tensor can also be used to perform numerical operations.
 class Tensor {
@@ -156,7 +159,7 @@ public:
                     "Assignment with scalar only works for scalar Tensor of "
                     "shape ()");
         }
-        DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(GetDtype(), [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_FLOAT16(GetDtype(), [&]() {
             scalar_t casted_v = static_cast<scalar_t>(v);
             MemoryManager::MemcpyFromHost(GetDataPtr(), GetDevice(), &casted_v,
                                           sizeof(scalar_t));
@@ -193,6 +196,11 @@ public:
                         Dtype dtype,
                         const Device& device = Device("CPU:0"));
 
+    /// Create a CPU:0 tensor with uninitialized values in page-locked (pinned)
+    /// host memory, see MemoryManager::MallocPinned(). Copies between pinned
+    /// tensors and CUDA devices are faster and CopyAsync() does not block.
+    static Tensor EmptyPinned(const SizeVector& shape, Dtype dtype);
+
     /// Create a tensor with uninitialized values with the same dtype and device
     /// as the other tensor.
     static Tensor EmptyLike(const Tensor& other) {
@@ -470,6 +478,15 @@ public:
     /// Copy Tensor to the same device.
     Tensor Copy() const { return Copy(GetDevice()); };
 
+    /// Same as Copy(device), but copies involving CUDA devices are submitted
+    /// to the current CUDA stream and may return before the copy is done, see
+    /// MemoryManager::MemcpyAsync(). The result must not be read from the host
+    /// before the stream has been synchronized, e.g. with cuda::Synchronize()
+    /// or a CUDAEvent. The memory of both Tensors is not reused by other
+    /// allocations until the copy is done, even if the Tensors are destroyed
+    /// earlier. Non-contiguous Tensors are copied synchronously.
+    Tensor CopyAsync(const Device& device) const;
+
     /// Copy Tensor values to current tensor for source tensor
     void CopyFrom(const Tensor& other);
 
@@ -519,6 +536,15 @@ public:
     /// https://docs.scipy.org/doc/numpy/reference/arrays.indexing.html
     Tensor IndexGet(const std::vector<Tensor>& index_tensors) const;
 
+    /// \brief Selects the slices where \p mask is true, i.e. tensor[mask] in
+    /// Numpy.
+    ///
+    /// \p mask is a Bool tensor whose shape matches the leading dimensions of
+    /// this tensor. The result has shape {num_true} + the remaining dimensions.
+    /// This is a single compaction pass, and IndexGet() uses it for a single
+    /// boolean index tensor.
+    Tensor MaskedSelect(const Tensor& mask) const;
+
     /// \brief Advanced indexing getter.
     ///
     /// We use the Numpy advanced indexing symnatics, see:
@@ -529,6 +555,19 @@ public:
     void IndexSet(const std::vector<Tensor>& index_tensors,
                   const Tensor& src_tensor);
 
+    /// \brief Adds the slices of \p src along dimension \p dim to this tensor
+    /// at the positions given by \p index, in-place.
+    ///
+    /// For dim == 0, this[index[i], ...] += src[i, ...]. Unlike IndexSet(),
+    /// duplicate indices accumulate, e.g. for histograms or per-voxel sums.
+    ///
+    /// \param dim The dimension to index.
+    /// \param index Int64 (or Int32) 1-D tensor of length src.GetShape(dim),
+    /// with values in [0, GetShape(dim)).
+    /// \param src Tensor with the dtype and device of this tensor, and its
+    /// shape except along \p dim.
+    Tensor IndexAdd_(int64_t dim, const Tensor& index, const Tensor& src);
+
     /// \brief Permute (dimension shuffle) the Tensor, returns a view.
     ///
     /// \param dims The desired ordering of dimensions.
@@ -551,6 +590,30 @@ public:
     /// 0-D and 1-D Tensor remains the same.
     Tensor T() const;
 
+    /// \brief Moves the last (channel) dimension to the front and returns a
+    /// contiguous tensor.
+    ///
+    /// E.g. {N, C} points in array-of-structures layout become {C, N} in
+    /// structure-of-arrays layout, and {H, W, C} images become {C, H, W}.
+    /// Returns a view if no data movement is needed. Expects >= 2 dimensions.
+    Tensor ToChannelFirst() const;
+
+    /// \brief Same as ToChannelFirst(), writing the result to \p dst.
+    ///
+    /// \p dst is reused if it is contiguous, has the result's shape, dtype
+    /// and device, and does not share memory with this tensor. Otherwise it
+    /// is reassigned. Keeping \p dst alive across calls in hot loops avoids
+    /// allocating a new buffer for every conversion.
+    void ToChannelFirst(Tensor& dst) const;
+
+    /// \brief Moves the first (channel) dimension to the back and returns a
+    /// contiguous tensor. This is the inverse of ToChannelFirst().
+    Tensor ToChannelLast() const;
+
+    /// \brief Same as ToChannelLast(), writing the result to \p dst. See
+    /// ToChannelFirst(Tensor&) for when \p dst is reused.
+    void ToChannelLast(Tensor& dst) const;
+
     /// \brief Expects input to be 3x3 Matrix.
     /// \return returns the determinant of the matrix (double).
     double Det() const;
@@ -582,6 +645,12 @@ public:
         return Add(Tensor::Full({}, scalar_value, dtype_, GetDevice()));
     }
 
+    /// Output version of Tensor::Add. The result is written to \p dst, which
+    /// must already have the shape, dtype and device of the result. This
+    /// allows reusing buffers without memory allocation, e.g. in iterative
+    /// algorithms. The other output versions follow the same rules.
+    void Add(const Tensor& value, Tensor& dst) const;
+
     /// Inplace version of Tensor::Add. Adds a tensor to the current tensor and
     /// returns the current tensor.
     Tensor Add_(const Tensor& value);
@@ -607,6 +676,9 @@ public:
         return Sub(Tensor::Full({}, scalar_value, dtype_, GetDevice()));
     }
 
+    /// Output version of Tensor::Sub, writes the result to \p dst.
+    void Sub(const Tensor& value, Tensor& dst) const;
+
     /// Inplace version of Tensor::Sub. Substracts a tensor to the current
     /// tensor and returns the current tensor.
     Tensor Sub_(const Tensor& value);
@@ -632,6 +704,9 @@ public:
         return Mul(Tensor::Full({}, scalar_value, dtype_, GetDevice()));
     }
 
+    /// Output version of Tensor::Mul, writes the result to \p dst.
+    void Mul(const Tensor& value, Tensor& dst) const;
+
     /// Inplace version of Tensor::Mul. Multiplies a tensor to the current
     /// tensor and returns the current tensor.
     Tensor Mul_(const Tensor& value);
@@ -657,6 +732,9 @@ public:
         return Div(Tensor::Full({}, scalar_value, dtype_, GetDevice()));
     }
 
+    /// Output version of Tensor::Div, writes the result to \p dst.
+    void Div(const Tensor& value, Tensor& dst) const;
+
     /// Inplace version of Tensor::Div. Divides a tensor to the current
     /// tensor and returns the current tensor.
     Tensor Div_(const Tensor& value);
@@ -670,31 +748,66 @@ public:
         return Div_(Tensor::Full({}, scalar_value, dtype_, GetDevice()));
     }
 
+    /// Returns a LazyTensor referencing this tensor. Elementwise ops on the
+    /// LazyTensor are recorded and fused into a single kernel when the result
+    /// is evaluated, see LazyTensor for details.
+    LazyTensor Lazy() const;
+
     /// Returns the sum of the tensor along the given \p dims.
     /// \param dims A list of dimensions to be reduced.
     /// \param keepdim If true, the reduced dims will be retained as size 1.
     Tensor Sum(const SizeVector& dims, bool keepdim = false) const;
 
+    /// Output version of Tensor::Sum, writes the result to \p dst.
+    void Sum(const SizeVector& dims, bool keepdim, Tensor& dst) const;
+
     /// Returns the mean of the tensor along the given \p dims.
     /// \param dims A list of dimensions to be reduced.
     /// \param keepdim If true, the reduced dims will be retained as size 1.
     Tensor Mean(const SizeVector& dims, bool keepdim = false) const;
 
+    /// Output version of Tensor::Mean, writes the result to \p dst.
+    void Mean(const SizeVector& dims, bool keepdim, Tensor& dst) const;
+
     /// Returns the product of the tensor along the given \p dims.
     /// \param dims A list of dimensions to be reduced.
     /// \param keepdim If true, the reduced dims will be retained as size 1.
     Tensor Prod(const SizeVector& dims, bool keepdim = false) const;
 
+    /// Output version of Tensor::Prod, writes the result to \p dst.
+    void Prod(const SizeVector& dims, bool keepdim, Tensor& dst) const;
+
     /// Returns min of the tensor along the given \p dims.
     /// \param dims A list of dimensions to be reduced.
     /// \param keepdim If true, the reduced dims will be retained as size 1.
     Tensor Min(const SizeVector& dims, bool keepdim = false) const;
 
+    /// Output version of Tensor::Min, writes the result to \p dst.
+    void Min(const SizeVector& dims, bool keepdim, Tensor& dst) const;
+
     /// Returns max of the tensor along the given \p dims.
     /// \param dims A list of dimensions to be reduced.
     /// \param keepdim If true, the reduced dims will be retained as size 1.
     Tensor Max(const SizeVector& dims, bool keepdim = false) const;
 
+    /// Output version of Tensor::Max, writes the result to \p dst.
+    void Max(const SizeVector& dims, bool keepdim, Tensor& dst) const;
+
+    /// Returns the min and the max of the tensor along the given \p dims,
+    /// computed in a single traversal.
+    /// \param dims A list of dimensions to be reduced.
+    /// \param keepdim If true, the reduced dims will be retained as size 1.
+    std::tuple<Tensor, Tensor> MinMax(const SizeVector& dims,
+                                      bool keepdim = false) const;
+
+    /// Returns the mean and the population variance (divided by the number of
+    /// reduced elements) of the tensor along the given \p dims, computed in a
+    /// single traversal. Only Float32 and Float64 are supported.
+    /// \param dims A list of dimensions to be reduced.
+    /// \param keepdim If true, the reduced dims will be retained as size 1.
+    std::tuple<Tensor, Tensor> MeanVar(const SizeVector& dims,
+                                       bool keepdim = false) const;
+
     /// Returns minimum index of the tensor along the given \p dim. The returned
     /// tensor has dtype int64_t, and has the same shape as original tensor
     /// except that the reduced dimension is removed.
@@ -718,51 +831,81 @@ public:
     /// Element-wise square root of a tensor, returns a new tensor.
     Tensor Sqrt() const;
 
+    /// Output version of Tensor::Sqrt, writes the result to \p dst.
+    void Sqrt(Tensor& dst) const;
+
     /// Element-wise square root of a tensor, in-place.
     Tensor Sqrt_();
 
     /// Element-wise sine of a tensor, returning a new tensor.
     Tensor Sin() const;
 
+    /// Output version of Tensor::Sin, writes the result to \p dst.
+    void Sin(Tensor& dst) const;
+
     /// Element-wise sine of a tensor, in-place.
     Tensor Sin_();
 
     /// Element-wise cosine of a tensor, returning a new tensor.
     Tensor Cos() const;
 
+    /// Output version of Tensor::Cos, writes the result to \p dst.
+    void Cos(Tensor& dst) const;
+
     /// Element-wise cosine of a tensor, in-place.
     Tensor Cos_();
 
     /// Element-wise negation of a tensor, returning a new tensor.
     Tensor Neg() const;
 
+    /// Output version of Tensor::Neg, writes the result to \p dst.
+    void Neg(Tensor& dst) const;
+
     /// Element-wise negation of a tensor, in-place.
     Tensor Neg_();
 
     /// Element-wise exponential of a tensor, returning a new tensor.
     Tensor Exp() const;
 
+    /// Output version of Tensor::Exp, writes the result to \p dst.
+    void Exp(Tensor& dst) const;
+
     /// Element-wise base-e exponential of a tensor, in-place.
     Tensor Exp_();
 
     /// Element-wise absolute value of a tensor, returning a new tensor.
     Tensor Abs() const;
 
+    /// Output version of Tensor::Abs, writes the result to \p dst.
+    void Abs(Tensor& dst) const;
+
     /// Element-wise absolute value of a tensor, in-place.
     Tensor Abs_();
 
     /// Element-wise floor value of a tensor, returning a new tensor.
     Tensor Floor() const;
 
+    /// Output version of Tensor::Floor, writes the result to \p dst.
+    void Floor(Tensor& dst) const;
+
     /// Element-wise ceil value of a tensor, returning a new tensor.
     Tensor Ceil() const;
 
+    /// Output version of Tensor::Ceil, writes the result to \p dst.
+    void Ceil(Tensor& dst) const;
+
     /// Element-wise round value of a tensor, returning a new tensor.
     Tensor Round() const;
 
+    /// Output version of Tensor::Round, writes the result to \p dst.
+    void Round(Tensor& dst) const;
+
     /// Element-wise trunc value of a tensor, returning a new tensor.
     Tensor Trunc() const;
 
+    /// Output version of Tensor::Trunc, writes the result to \p dst.
+    void Trunc(Tensor& dst) const;
+
     /// Element-wise logical not of a tensor, returning a new boolean tensor.
     ///
     /// If the tensor is not boolean, 0 will be treated as False, while non-zero
@@ -944,6 +1087,27 @@ public:
         return Ne_(Tensor::Full({}, scalar_value, dtype_, GetDevice()));
     }
 
+    /// Returns the elements of a 1-D tensor sorted in ascending order.
+    Tensor Sort() const;
+
+    /// Returns the Int64 indices that sort a 1-D tensor in ascending order.
+    /// The sort is stable: equal elements keep their relative order.
+    Tensor ArgSort() const;
+
+    /// \brief Finds the unique elements of a 1-D tensor.
+    ///
+    /// Returns (unique, inverse, counts). unique holds the distinct elements in
+    /// ascending order. If \p return_inverse, inverse is the Int64 index into
+    /// unique of each input element, such that unique.IndexGet({inverse})
+    /// reconstructs the input. If \p return_counts, counts is the Int64 number
+    /// of occurrences of each unique element. Outputs that are not requested
+    /// are empty tensors.
+    ///
+    /// Multi-column keys, e.g. voxel coordinates, can be packed into a single
+    /// Int64 key first.
+    std::tuple<Tensor, Tensor, Tensor> Unique(bool return_inverse = false,
+                                              bool return_counts = false) const;
+
     /// Find the indices of the elements that are non-zero. Returns a vector of
     /// int64 Tensors, each containing the indices of the non-zero elements in
     /// each dimension.
@@ -1047,11 +1211,16 @@ public:
     Tensor Contiguous() const;
 
     /// Computes matrix multiplication with *this and rhs and returns the
-    /// result.
+    /// result. For a (batch_size, m, k) *this and a (batch_size, k, n) rhs,
+    /// the matrices of the batches are multiplied pairwise.
     Tensor Matmul(const Tensor& rhs) const;
 
+    /// Output version of Tensor::Matmul, writes the result to \p dst.
+    void Matmul(const Tensor& rhs, Tensor& dst) const;
+
     /// Solves the linear system AX = B with QR decomposition and returns X.
-    /// A must be a square matrix.
+    /// A must be a square matrix, or a (batch_size, n, n) batch of square
+    /// matrices with a (batch_size, n) or (batch_size, n, k) B.
     Tensor Solve(const Tensor& rhs) const;
 
     /// Solves the linear system AX = B with QR decomposition and returns X.
@@ -1059,11 +1228,13 @@ public:
     Tensor LeastSquares(const Tensor& rhs) const;
 
     /// Computes the matrix inversion of the square matrix *this with LU
-    /// factorization and returns the result.
+    /// factorization and returns the result. A (batch_size, n, n) *this is
+    /// inverted matrix by matrix.
     Tensor Inverse() const;
 
     /// Computes the matrix SVD decomposition A = U S VT and returns the result.
-    /// Note VT (V transpose) is returned instead of V.
+    /// Note VT (V transpose) is returned instead of V. For a (batch_size, m, n)
+    /// *this, U, S and VT are batches of the per-matrix results.
     std::tuple<Tensor, Tensor, Tensor> SVD() const;
 
     /// Returns the size of the first dimension. If NumDims() == 0, an exception
@@ -1250,7 +1421,7 @@ inline bool Tensor::Item() const {
 
 template <typename S>
 inline void Tensor::Fill(S v) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(GetDtype(), [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_FLOAT16(GetDtype(), [&]() {
         scalar_t casted_v = static_cast<scalar_t>(v);
         Tensor tmp(std::vector<scalar_t>({casted_v}), SizeVector({}),
                    GetDtype(), GetDevice());
@@ -0,0 +1,175 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/core/TensorRingBuffer.h"
+
+#include <algorithm>
+#include <string>
+
+#include "open3d/core/ShapeUtil.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+
+TensorRingBuffer::TensorRingBuffer(int64_t capacity,
+                                   const SizeVector& element_shape,
+                                   Dtype dtype,
+                                   const Device& device)
+    : element_shape_(element_shape), capacity_(capacity) {
+    if (capacity <= 0) {
+        utility::LogError("Ring buffer capacity must be positive, but got {}.",
+                          capacity);
+    }
+    internal_tensor_ = Tensor(shape_util::Concat({capacity_}, element_shape_),
+                              dtype, device);
+}
+
+void TensorRingBuffer::PushBack(const Tensor& tensor) {
+    AssertCompatible(tensor, element_shape_);
+    if (IsFull()) {
+        utility::LogError("Ring buffer is full with capacity {}.", capacity_);
+    }
+    internal_tensor_[StorageIndex(size_)] = tensor;
+    size_++;
+}
+
+void TensorRingBuffer::Extend(const Tensor& tensors) {
+    if (tensors.NumDims() == 0) {
+        utility::LogError(
+                "Extend expects a batch of tensors, but got a 0-d tensor.");
+    }
+    int64_t count = tensors.GetLength();
+    AssertCompatible(tensors, shape_util::Concat({count}, element_shape_));
+    if (size_ + count > capacity_) {
+        utility::LogError(
+                "Cannot add {} elements to ring buffer of size {} and "
+                "capacity {}.",
+                count, size_, capacity_);
+    }
+
+    if (count == 0) {
+        return;
+    }
+
+    // The free space starts at the back and may wrap around. Assigning to a
+    // Tensor rvalue is an actual copy.
+    int64_t start = StorageIndex(size_);
+    int64_t first_count = std::min(count, capacity_ - start);
+    internal_tensor_.Slice(0, start, start + first_count) =
+            tensors.Slice(0, 0, first_count);
+    if (first_count < count) {
+        internal_tensor_.Slice(0, 0, count - first_count) =
+                tensors.Slice(0, first_count, count);
+    }
+    size_ += count;
+}
+
+void TensorRingBuffer::PopFront(int64_t count) {
+    if (count < 0 || count > size_) {
+        utility::LogError("Cannot pop {} elements from ring buffer of size {}.",
+                          count, size_);
+    }
+    begin_ = StorageIndex(count);
+    size_ -= count;
+}
+
+std::vector<Tensor> TensorRingBuffer::GetRange(int64_t start,
+                                               int64_t stop) const {
+    if (start < 0 || start > stop || stop > size_) {
+        utility::LogError("Invalid range [{}, {}) for ring buffer of size {}.",
+                          start, stop, size_);
+    }
+    std::vector<Tensor> slices;
+    if (start == stop) {
+        return slices;
+    }
+    int64_t first = StorageIndex(start);
+    int64_t count = stop - start;
+    if (first + count <= capacity_) {
+        slices.push_back(internal_tensor_.Slice(0, first, first + count));
+    } else {
+        slices.push_back(internal_tensor_.Slice(0, first, capacity_));
+        slices.push_back(
+                internal_tensor_.Slice(0, 0, first + count - capacity_));
+    }
+    return slices;
+}
+
+Tensor TensorRingBuffer::AsTensor() const {
+    std::vector<Tensor> slices = GetRange(0, size_);
+    if (slices.empty()) {
+        return internal_tensor_.Slice(0, 0, 0);
+    } else if (slices.size() == 1) {
+        return slices[0];
+    }
+    Tensor dst(shape_util::Concat({size_}, element_shape_), GetDtype(),
+               GetDevice());
+    int64_t first_count = slices[0].GetLength();
+    dst.Slice(0, 0, first_count) = slices[0];
+    dst.Slice(0, first_count, size_) = slices[1];
+    return dst;
+}
+
+Tensor TensorRingBuffer::operator[](int64_t index) const {
+    // WrapDim asserts index is within range.
+    index = shape_util::WrapDim(index, size_);
+    return internal_tensor_[StorageIndex(index)];
+}
+
+void TensorRingBuffer::Clear() {
+    begin_ = 0;
+    size_ = 0;
+}
+
+std::string TensorRingBuffer::ToString() const {
+    return fmt::format(
+            "TensorRingBuffer[size: {}, capacity: {}, element_shape: {}, "
+            "dtype: {}, device: {}]",
+            size_, capacity_, element_shape_.ToString(), GetDtype().ToString(),
+            GetDevice().ToString());
+}
+
+void TensorRingBuffer::AssertCompatible(const Tensor& tensor,
+                                        const SizeVector& shape) const {
+    if (tensor.GetShape() != shape) {
+        utility::LogError("Expected tensor of shape {}, but got {}.", shape,
+                          tensor.GetShape());
+    }
+    if (tensor.GetDtype() != GetDtype()) {
+        utility::LogError("Ring buffer has dtype {}, but tensor has dtype {}.",
+                          GetDtype().ToString(), tensor.GetDtype().ToString());
+    }
+    if (tensor.GetDevice() != GetDevice()) {
+        utility::LogError(
+                "Ring buffer has device {}, but tensor has device {}.",
+                GetDevice().ToString(), tensor.GetDevice().ToString());
+    }
+}
+
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,147 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "open3d/core/Device.h"
+#include "open3d/core/Dtype.h"
+#include "open3d/core/SizeVector.h"
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+
+/// A fixed-capacity FIFO of tensors of the same shape, stored in one
+/// preallocated internal tensor that is used circularly. Unlike TensorList,
+/// elements can be removed from the front, and pushing and popping never
+/// allocate.
+///
+/// Example: a sliding window over the points of the last frames.
+/// - element_shape        : (3,)
+/// - capacity             : M, the maximum number of points in the window
+/// - internal_tensor.shape: (M, 3)
+///
+/// ```cpp
+/// TensorRingBuffer window(M, {3}, Dtype::Float32, device);
+/// window.Extend(frame_points);            // {N_i, 3}
+/// window.PopFront(oldest_frame_size);
+/// for (const Tensor& points : window.GetRange(0, window.GetSize())) {...}
+/// ```
+class TensorRingBuffer {
+public:
+    /// Constructs an empty ring buffer.
+    ///
+    /// \param capacity Maximum number of elements. The storage for all of
+    /// them is allocated on \p device at construction.
+    /// \param element_shape Shape of the contained tensors, e.g. {3,}.
+    /// \param dtype Data type of the contained tensors.
+    /// \param device Device of the contained tensors.
+    TensorRingBuffer(int64_t capacity,
+                     const SizeVector& element_shape,
+                     Dtype dtype,
+                     const Device& device = Device("CPU:0"));
+
+    /// Copies \p tensor to the back. \p tensor must have the element shape,
+    /// dtype and device of the ring buffer, and the buffer must not be full.
+    void PushBack(const Tensor& tensor);
+
+    /// Copies the rows of \p tensors, of shape {N, *element_shape}, to the
+    /// back. The copy is split in two when it wraps around the end of the
+    /// storage.
+    void Extend(const Tensor& tensors);
+
+    /// Removes \p count elements from the front. No data is moved.
+    void PopFront(int64_t count = 1);
+
+    /// Returns views of the elements [start, stop), counted from the front.
+    ///
+    /// A range that wraps around the end of the storage is returned as two
+    /// slices, in order. Otherwise a single slice is returned, or none for an
+    /// empty range. The views share memory with the ring buffer and are
+    /// invalidated once their elements are popped and overwritten.
+    std::vector<Tensor> GetRange(int64_t start, int64_t stop) const;
+
+    /// Returns all elements as one {size, *element_shape} tensor. This is a
+    /// view if the elements do not wrap around, and a copy otherwise.
+    Tensor AsTensor() const;
+
+    /// Returns a view of the \p index -th element from the front. Negative
+    /// indices count from the back.
+    Tensor operator[](int64_t index) const;
+
+    /// Removes all elements. The storage is kept.
+    void Clear();
+
+    std::string ToString() const;
+
+    SizeVector GetElementShape() const { return element_shape_; }
+
+    Device GetDevice() const { return internal_tensor_.GetDevice(); }
+
+    Dtype GetDtype() const { return internal_tensor_.GetDtype(); }
+
+    int64_t GetSize() const { return size_; }
+
+    int64_t GetCapacity() const { return capacity_; }
+
+    bool IsFull() const { return size_ == capacity_; }
+
+    const Tensor& GetInternalTensor() const { return internal_tensor_; }
+
+protected:
+    /// Returns the storage index of the \p index -th element from the front.
+    int64_t StorageIndex(int64_t index) const {
+        return (begin_ + index) % capacity_;
+    }
+
+    /// Checks that \p tensor has the given shape, and the dtype and device of
+    /// the ring buffer.
+    void AssertCompatible(const Tensor& tensor, const SizeVector& shape) const;
+
+protected:
+    /// The shape for each element tensor in the ring buffer.
+    SizeVector element_shape_;
+
+    /// Maximum number of elements, i.e. internal_tensor_.GetLength().
+    int64_t capacity_ = 0;
+
+    /// Storage index of the front element.
+    int64_t begin_ = 0;
+
+    /// Number of valid elements, starting at begin_ and wrapping around.
+    int64_t size_ = 0;
+
+    /// The internal tensor for data storage, of shape
+    /// (capacity_, *element_shape_).
+    Tensor internal_tensor_;
+};
+
+}  // namespace core
+}  // namespace open3d
@@ -24,6 +24,7 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/core/hashmap/CPU/LinearProbingHashmapCPU.h"
 #include "open3d/core/hashmap/CPU/TemplateHashmapCPU.hpp"
 
 namespace open3d {
@@ -35,8 +36,13 @@ std::shared_ptr<DefaultDeviceHashmap> CreateDefaultCPUHashmap(
         int64_t init_capacity,
         int64_t dsize_key,
         int64_t dsize_value,
-        const Device& device) {
-    return std::make_shared<CPUHashmap<DefaultHash, DefaultKeyEq>>(
+        const Device& device,
+        const HashmapBackend& backend) {
+    if (backend == HashmapBackend::LinearProbing) {
+        return CreateSpecializedDeviceHashmap<CPULinearProbingHashmap>(
+                init_buckets, init_capacity, dsize_key, dsize_value, device);
+    }
+    return CreateSpecializedDeviceHashmap<CPUHashmap>(
             init_buckets, init_capacity, dsize_key, dsize_value, device);
 }
 
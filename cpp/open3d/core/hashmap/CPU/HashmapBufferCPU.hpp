@@ -33,6 +33,7 @@
 #include <vector>
 
 #include "open3d/core/hashmap/HashmapBuffer.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace core {
@@ -56,8 +57,20 @@ public:
         std::memset(values_, 0, capacity_ * dsize_value_);
     }
 
+    /// Point the context to an extended buffer. The heap counter is kept so
+    /// that addresses handed out before remain valid; fresh values are
+    /// zero-initialized.
+    void Rebind(int64_t capacity, Tensor &keys, Tensor &values, Tensor &heap) {
+        keys_ = static_cast<uint8_t *>(keys.GetDataPtr());
+        values_ = static_cast<uint8_t *>(values.GetDataPtr());
+        heap_ = static_cast<addr_t *>(heap.GetDataPtr());
+        std::memset(values_ + capacity_ * dsize_value_, 0,
+                    (capacity - capacity_) * dsize_value_);
+        capacity_ = capacity;
+    }
+
     void Reset() {
-#pragma omp parallel for
+#pragma omp parallel for num_threads(utility::EstimateMaxThreads())
         for (int i = 0; i < capacity_; ++i) {
             heap_[i] = i;
         }
@@ -32,6 +32,8 @@
 
 #include "open3d/core/hashmap/CPU/HashmapBufferCPU.hpp"
 #include "open3d/core/hashmap/DeviceHashmap.h"
+#include "open3d/core/kernel/ParallelUtil.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace core {
@@ -48,6 +50,8 @@ public:
 
     void Rehash(int64_t buckets) override;
 
+    void Reserve(int64_t capacity) override;
+
     void Insert(const void* input_keys,
                 const void* input_values,
                 addr_t* output_addrs,
@@ -59,6 +63,12 @@ public:
                   bool* output_masks,
                   int64_t count) override;
 
+    void InsertOrFind(const void* input_keys,
+                      const void* input_values,
+                      addr_t* output_addrs,
+                      bool* output_masks,
+                      int64_t count) override;
+
     void Find(const void* input_keys,
               addr_t* output_addrs,
               bool* output_masks,
@@ -75,6 +85,8 @@ public:
     std::vector<int64_t> BucketSizes() const override;
     float LoadFactor() const override;
 
+    void SetMaxLoadFactor(float max_load_factor) override;
+
 protected:
     std::shared_ptr<tbb::concurrent_unordered_map<void*, addr_t, Hash, KeyEq>>
             impl_;
@@ -88,6 +100,13 @@ protected:
                     int64_t count);
 
     void Allocate(int64_t capacity, int64_t buckets);
+
+    /// Extend the buffer to \p capacity without moving active addresses.
+    void ExtendBuffer(int64_t capacity);
+
+    /// Rebuild the index over the active addresses with \p buckets buckets.
+    /// Keys and values are not copied, only the key pointers are reinserted.
+    void Reindex(int64_t buckets);
 };
 
 template <typename Hash, typename KeyEq>
@@ -122,12 +141,7 @@ void CPUHashmap<Hash, KeyEq>::Insert(const void* input_keys,
                                      int64_t count) {
     int64_t new_size = Size() + count;
     if (new_size > this->capacity_) {
-        float avg_capacity_per_bucket =
-                float(this->capacity_) / float(this->bucket_count_);
-        int64_t expected_buckets = std::max(
-                this->bucket_count_ * 2,
-                int64_t(std::ceil(new_size / avg_capacity_per_bucket)));
-        Rehash(expected_buckets);
+        Reserve(this->GrowthCapacity(new_size));
     }
     InsertImpl(input_keys, input_values, output_addrs, output_masks, count);
 }
@@ -139,22 +153,75 @@ void CPUHashmap<Hash, KeyEq>::Activate(const void* input_keys,
                                        int64_t count) {
     int64_t new_size = Size() + count;
     if (new_size > this->capacity_) {
-        float avg_capacity_per_bucket =
-                float(this->capacity_) / float(this->bucket_count_);
-        int64_t expected_buckets = std::max(
-                this->bucket_count_ * 2,
-                int64_t(std::ceil(new_size / avg_capacity_per_bucket)));
-        Rehash(expected_buckets);
+        Reserve(this->GrowthCapacity(new_size));
     }
     InsertImpl(input_keys, nullptr, output_addrs, output_masks, count);
 }
 
+template <typename Hash, typename KeyEq>
+void CPUHashmap<Hash, KeyEq>::InsertOrFind(const void* input_keys,
+                                           const void* input_values,
+                                           addr_t* output_addrs,
+                                           bool* output_masks,
+                                           int64_t count) {
+    int64_t new_size = Size() + count;
+    if (new_size > this->capacity_) {
+        Reserve(this->GrowthCapacity(new_size));
+    }
+
+    // Allocated addresses of failed insertions, freed after the parallel loop
+    // since allocation and free cannot interleave on the heap.
+    std::vector<addr_t> allocated_addrs(count);
+    kernel::ParallelFor(
+            count,
+            [&](int64_t i) {
+                const uint8_t* src_key =
+                        static_cast<const uint8_t*>(input_keys) +
+                        this->dsize_key_ * i;
+
+                addr_t dst_kv_addr = buffer_ctx_->DeviceAllocate();
+                auto dst_kv_iter = buffer_ctx_->ExtractIterator(dst_kv_addr);
+
+                uint8_t* dst_key = static_cast<uint8_t*>(dst_kv_iter.first);
+                std::memcpy(dst_key, src_key, this->dsize_key_);
+
+                // Try insertion, and fall back to the existing entry.
+                auto res = impl_->insert({dst_key, dst_kv_addr});
+                if (res.second) {
+                    uint8_t* dst_value =
+                            static_cast<uint8_t*>(dst_kv_iter.second);
+                    if (input_values != nullptr) {
+                        const uint8_t* src_value =
+                                static_cast<const uint8_t*>(input_values) +
+                                this->dsize_value_ * i;
+                        std::memcpy(dst_value, src_value, this->dsize_value_);
+                    } else {
+                        std::memset(dst_value, 0, this->dsize_value_);
+                    }
+                }
+
+                allocated_addrs[i] = dst_kv_addr;
+                output_addrs[i] = res.first->second;
+                output_masks[i] = res.second;
+            },
+            kernel::ParallelSchedule::Dynamic());
+
+#pragma omp parallel for num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < count; ++i) {
+        if (!output_masks[i]) {
+            buffer_ctx_->DeviceFree(allocated_addrs[i]);
+        }
+    }
+
+    this->bucket_count_ = impl_->unsafe_bucket_count();
+}
+
 template <typename Hash, typename KeyEq>
 void CPUHashmap<Hash, KeyEq>::Find(const void* input_keys,
                                    addr_t* output_addrs,
                                    bool* output_masks,
                                    int64_t count) {
-#pragma omp parallel for
+#pragma omp parallel for num_threads(utility::EstimateMaxThreads())
     for (int64_t i = 0; i < count; ++i) {
         uint8_t* key = const_cast<uint8_t*>(
                 static_cast<const uint8_t*>(input_keys) + this->dsize_key_ * i);
@@ -198,39 +265,26 @@ int64_t CPUHashmap<Hash, KeyEq>::GetActiveIndices(addr_t* output_indices) {
 
 template <typename Hash, typename KeyEq>
 void CPUHashmap<Hash, KeyEq>::Rehash(int64_t buckets) {
-    int64_t iterator_count = Size();
-
-    Tensor active_keys;
-    Tensor active_values;
-
-    if (iterator_count > 0) {
-        Tensor active_addrs({iterator_count}, Dtype::Int32, this->device_);
-        GetActiveIndices(static_cast<addr_t*>(active_addrs.GetDataPtr()));
-
-        Tensor active_indices = active_addrs.To(Dtype::Int64);
-        active_keys = this->GetKeyBuffer().IndexGet({active_indices});
-        active_values = this->GetValueBuffer().IndexGet({active_indices});
+    int64_t capacity =
+            int64_t(std::ceil(buckets * this->avg_capacity_bucket_ratio()));
+    if (capacity > this->capacity_) {
+        ExtendBuffer(capacity);
+        Reindex(buckets);
+    } else {
+        // The split-ordered list only splits buckets, elements stay in place.
+        impl_->rehash(buckets);
+        this->bucket_count_ = impl_->unsafe_bucket_count();
     }
+}
 
-    float avg_capacity_per_bucket =
-            float(this->capacity_) / float(this->bucket_count_);
-
-    int64_t new_capacity =
-            int64_t(std::ceil(buckets * avg_capacity_per_bucket));
-    Allocate(new_capacity, buckets);
-
-    if (iterator_count > 0) {
-        Tensor output_addrs({iterator_count}, Dtype::Int32, this->device_);
-        Tensor output_masks({iterator_count}, Dtype::Bool, this->device_);
-
-        InsertImpl(active_keys.GetDataPtr(), active_values.GetDataPtr(),
-                   static_cast<addr_t*>(output_addrs.GetDataPtr()),
-                   static_cast<bool*>(output_masks.GetDataPtr()),
-                   iterator_count);
+template <typename Hash, typename KeyEq>
+void CPUHashmap<Hash, KeyEq>::Reserve(int64_t capacity) {
+    if (capacity <= this->capacity_) {
+        return;
     }
 
-    impl_->rehash(buckets);
-    this->bucket_count_ = impl_->unsafe_bucket_count();
+    ExtendBuffer(capacity);
+    Reindex(this->ExpectedBucketCount(capacity));
 }
 
 template <typename Hash, typename KeyEq>
@@ -248,41 +302,51 @@ float CPUHashmap<Hash, KeyEq>::LoadFactor() const {
     return impl_->load_factor();
 }
 
+template <typename Hash, typename KeyEq>
+void CPUHashmap<Hash, KeyEq>::SetMaxLoadFactor(float max_load_factor) {
+    DeviceHashmap<Hash, KeyEq>::SetMaxLoadFactor(max_load_factor);
+    impl_->max_load_factor(max_load_factor);
+}
+
 template <typename Hash, typename KeyEq>
 void CPUHashmap<Hash, KeyEq>::InsertImpl(const void* input_keys,
                                          const void* input_values,
                                          addr_t* output_addrs,
                                          bool* output_masks,
                                          int64_t count) {
-#pragma omp parallel for
-    for (int64_t i = 0; i < count; ++i) {
-        const uint8_t* src_key =
-                static_cast<const uint8_t*>(input_keys) + this->dsize_key_ * i;
-
-        addr_t dst_kv_addr = buffer_ctx_->DeviceAllocate();
-        auto dst_kv_iter = buffer_ctx_->ExtractIterator(dst_kv_addr);
-
-        uint8_t* dst_key = static_cast<uint8_t*>(dst_kv_iter.first);
-        uint8_t* dst_value = static_cast<uint8_t*>(dst_kv_iter.second);
-        std::memcpy(dst_key, src_key, this->dsize_key_);
-
-        if (input_values != nullptr) {
-            const uint8_t* src_value =
-                    static_cast<const uint8_t*>(input_values) +
-                    this->dsize_value_ * i;
-            std::memcpy(dst_value, src_value, this->dsize_value_);
-        } else {
-            std::memset(dst_value, 0, this->dsize_value_);
-        }
-
-        // Try insertion.
-        auto res = impl_->insert({dst_key, dst_kv_addr});
-
-        output_addrs[i] = dst_kv_addr;
-        output_masks[i] = res.second;
-    }
-
-#pragma omp parallel for
+    // The cost of an insertion depends on the collisions in its bucket.
+    kernel::ParallelFor(
+            count,
+            [&](int64_t i) {
+                const uint8_t* src_key =
+                        static_cast<const uint8_t*>(input_keys) +
+                        this->dsize_key_ * i;
+
+                addr_t dst_kv_addr = buffer_ctx_->DeviceAllocate();
+                auto dst_kv_iter = buffer_ctx_->ExtractIterator(dst_kv_addr);
+
+                uint8_t* dst_key = static_cast<uint8_t*>(dst_kv_iter.first);
+                uint8_t* dst_value = static_cast<uint8_t*>(dst_kv_iter.second);
+                std::memcpy(dst_key, src_key, this->dsize_key_);
+
+                if (input_values != nullptr) {
+                    const uint8_t* src_value =
+                            static_cast<const uint8_t*>(input_values) +
+                            this->dsize_value_ * i;
+                    std::memcpy(dst_value, src_value, this->dsize_value_);
+                } else {
+                    std::memset(dst_value, 0, this->dsize_value_);
+                }
+
+                // Try insertion.
+                auto res = impl_->insert({dst_key, dst_kv_addr});
+
+                output_addrs[i] = dst_kv_addr;
+                output_masks[i] = res.second;
+            },
+            kernel::ParallelSchedule::Dynamic());
+
+#pragma omp parallel for num_threads(utility::EstimateMaxThreads())
     for (int64_t i = 0; i < count; ++i) {
         if (!output_masks[i]) {
             buffer_ctx_->DeviceFree(output_addrs[i]);
@@ -309,6 +373,42 @@ void CPUHashmap<Hash, KeyEq>::Allocate(int64_t capacity, int64_t buckets) {
     impl_ = std::make_shared<
             tbb::concurrent_unordered_map<void*, addr_t, Hash, KeyEq>>(
             buckets, Hash(this->dsize_key_), KeyEq(this->dsize_key_));
+    impl_->max_load_factor(this->max_load_factor_);
+}
+
+template <typename Hash, typename KeyEq>
+void CPUHashmap<Hash, KeyEq>::ExtendBuffer(int64_t capacity) {
+    this->buffer_->Extend(capacity);
+    buffer_ctx_->Rebind(capacity, this->buffer_->GetKeyBuffer(),
+                        this->buffer_->GetValueBuffer(),
+                        this->buffer_->GetHeap());
+    this->capacity_ = capacity;
+}
+
+template <typename Hash, typename KeyEq>
+void CPUHashmap<Hash, KeyEq>::Reindex(int64_t buckets) {
+    int64_t iterator_count = Size();
+
+    std::vector<addr_t> active_addrs(iterator_count);
+    GetActiveIndices(active_addrs.data());
+
+    // Keys in the index point into the buffer, which may have been moved.
+    auto new_impl = std::make_shared<
+            tbb::concurrent_unordered_map<void*, addr_t, Hash, KeyEq>>(
+            buckets, Hash(this->dsize_key_), KeyEq(this->dsize_key_));
+    new_impl->max_load_factor(this->max_load_factor_);
+
+    kernel::ParallelFor(
+            iterator_count,
+            [&](int64_t i) {
+                addr_t addr = active_addrs[i];
+                new_impl->insert(
+                        {buffer_ctx_->ExtractIterator(addr).first, addr});
+            },
+            kernel::ParallelSchedule::Dynamic());
+
+    impl_ = new_impl;
+    this->bucket_count_ = impl_->unsafe_bucket_count();
 }
 
 }  // namespace core
@@ -0,0 +1,473 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "open3d/core/hashmap/CPU/HashmapBufferCPU.hpp"
+#include "open3d/core/hashmap/DeviceHashmap.h"
+#include "open3d/core/kernel/ParallelUtil.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace core {
+
+/// Lock-free open-addressing hashmap on a flat slot array with linear probing.
+/// Each slot holds the buffer address of a key value pair, claimed by an
+/// atomic compare-and-swap, so threads never contend on a shared lock or on
+/// per-bucket lists. Erased slots become tombstones that are dropped when the
+/// slot array is rebuilt.
+///
+/// The bucket count is the number of slots, a power of two. The occupancy of
+/// the slots is bounded by the max load factor if it is below 1, and by
+/// kDefaultMaxOccupancy otherwise.
+template <typename Hash, typename KeyEq>
+class CPULinearProbingHashmap : public DeviceHashmap<Hash, KeyEq> {
+public:
+    CPULinearProbingHashmap(int64_t init_buckets,
+                            int64_t init_capacity,
+                            int64_t dsize_key,
+                            int64_t dsize_value,
+                            const Device& device);
+
+    ~CPULinearProbingHashmap();
+
+    void Rehash(int64_t buckets) override;
+
+    void Reserve(int64_t capacity) override;
+
+    void Insert(const void* input_keys,
+                const void* input_values,
+                addr_t* output_addrs,
+                bool* output_masks,
+                int64_t count) override;
+
+    void Activate(const void* input_keys,
+                  addr_t* output_addrs,
+                  bool* output_masks,
+                  int64_t count) override;
+
+    void InsertOrFind(const void* input_keys,
+                      const void* input_values,
+                      addr_t* output_addrs,
+                      bool* output_masks,
+                      int64_t count) override;
+
+    void Find(const void* input_keys,
+              addr_t* output_addrs,
+              bool* output_masks,
+              int64_t count) override;
+
+    void Erase(const void* input_keys,
+               bool* output_masks,
+               int64_t count) override;
+
+    int64_t GetActiveIndices(addr_t* output_indices) override;
+
+    int64_t Size() const override;
+
+    std::vector<int64_t> BucketSizes() const override;
+    float LoadFactor() const override;
+
+    static constexpr float kDefaultMaxOccupancy = 0.5f;
+
+protected:
+    static constexpr addr_t kEmptySlot = 0xFFFFFFFF;
+    static constexpr addr_t kErasedSlot = 0xFFFFFFFE;
+
+    Hash hash_fn_;
+    KeyEq cmp_fn_;
+
+    std::shared_ptr<CPUHashmapBufferContext> buffer_ctx_;
+
+    std::unique_ptr<std::atomic<addr_t>[]> slots_;
+    int64_t slot_mask_;
+    std::atomic<int64_t> erased_count_;
+
+    /// Shared by Insert, Activate and InsertOrFind. Output addresses of keys
+    /// that already exist are the existing ones if \p find_existing, and the
+    /// (released) allocated ones otherwise.
+    void InsertImpl(const void* input_keys,
+                    const void* input_values,
+                    addr_t* output_addrs,
+                    bool* output_masks,
+                    int64_t count,
+                    bool find_existing);
+
+    /// Grow the capacity and the slot array, or drop tombstones, so that
+    /// \p count more keys fit within the max occupancy.
+    void PrepareInsert(int64_t count);
+
+    float MaxOccupancy() const {
+        return this->max_load_factor_ < 1 ? this->max_load_factor_
+                                          : kDefaultMaxOccupancy;
+    }
+
+    static int64_t NextPowerOfTwo(int64_t n) {
+        int64_t power = 1;
+        while (power < n) {
+            power <<= 1;
+        }
+        return power;
+    }
+
+    /// Smallest power of two slot count holding \p capacity elements within
+    /// the max occupancy.
+    int64_t ExpectedSlotCount(int64_t capacity) const {
+        return NextPowerOfTwo(int64_t(std::ceil(capacity / MaxOccupancy())));
+    }
+
+    const void* KeyAt(addr_t addr) const {
+        return buffer_ctx_->keys_ + addr * this->dsize_key_;
+    }
+
+    void ExtendBuffer(int64_t capacity);
+
+    /// Rebuild the slot array with \p slot_count slots over the active
+    /// addresses, dropping tombstones. Keys and values are not moved.
+    void RebuildSlots(int64_t slot_count);
+};
+
+template <typename Hash, typename KeyEq>
+CPULinearProbingHashmap<Hash, KeyEq>::CPULinearProbingHashmap(
+        int64_t init_buckets,
+        int64_t init_capacity,
+        int64_t dsize_key,
+        int64_t dsize_value,
+        const Device& device)
+    : DeviceHashmap<Hash, KeyEq>(
+              init_buckets, init_capacity, dsize_key, dsize_value, device),
+      hash_fn_(dsize_key),
+      cmp_fn_(dsize_key),
+      slot_mask_(0),
+      erased_count_(0) {
+    this->buffer_ =
+            std::make_shared<HashmapBuffer>(this->capacity_, this->dsize_key_,
+                                            this->dsize_value_, this->device_);
+    buffer_ctx_ = std::make_shared<CPUHashmapBufferContext>(
+            this->capacity_, this->dsize_key_, this->dsize_value_,
+            this->buffer_->GetKeyBuffer(), this->buffer_->GetValueBuffer(),
+            this->buffer_->GetHeap());
+    buffer_ctx_->Reset();
+
+    RebuildSlots(ExpectedSlotCount(this->capacity_));
+}
+
+template <typename Hash, typename KeyEq>
+CPULinearProbingHashmap<Hash, KeyEq>::~CPULinearProbingHashmap() {}
+
+template <typename Hash, typename KeyEq>
+int64_t CPULinearProbingHashmap<Hash, KeyEq>::Size() const {
+    return buffer_ctx_->HeapCounter();
+}
+
+template <typename Hash, typename KeyEq>
+void CPULinearProbingHashmap<Hash, KeyEq>::Rehash(int64_t buckets) {
+    int64_t capacity =
+            int64_t(std::ceil(buckets * this->avg_capacity_bucket_ratio()));
+    if (capacity > this->capacity_) {
+        ExtendBuffer(capacity);
+    }
+    RebuildSlots(std::max(NextPowerOfTwo(buckets),
+                          ExpectedSlotCount(this->capacity_)));
+}
+
+template <typename Hash, typename KeyEq>
+void CPULinearProbingHashmap<Hash, KeyEq>::Reserve(int64_t capacity) {
+    if (capacity <= this->capacity_) {
+        return;
+    }
+
+    ExtendBuffer(capacity);
+
+    int64_t slot_count = ExpectedSlotCount(capacity);
+    if (slot_count > this->bucket_count_) {
+        RebuildSlots(slot_count);
+    }
+}
+
+template <typename Hash, typename KeyEq>
+void CPULinearProbingHashmap<Hash, KeyEq>::Insert(const void* input_keys,
+                                                  const void* input_values,
+                                                  addr_t* output_addrs,
+                                                  bool* output_masks,
+                                                  int64_t count) {
+    PrepareInsert(count);
+    InsertImpl(input_keys, input_values, output_addrs, output_masks, count,
+               false);
+}
+
+template <typename Hash, typename KeyEq>
+void CPULinearProbingHashmap<Hash, KeyEq>::Activate(const void* input_keys,
+                                                    addr_t* output_addrs,
+                                                    bool* output_masks,
+                                                    int64_t count) {
+    PrepareInsert(count);
+    InsertImpl(input_keys, nullptr, output_addrs, output_masks, count, false);
+}
+
+template <typename Hash, typename KeyEq>
+void CPULinearProbingHashmap<Hash, KeyEq>::InsertOrFind(
+        const void* input_keys,
+        const void* input_values,
+        addr_t* output_addrs,
+        bool* output_masks,
+        int64_t count) {
+    PrepareInsert(count);
+    InsertImpl(input_keys, input_values, output_addrs, output_masks, count,
+               true);
+}
+
+template <typename Hash, typename KeyEq>
+void CPULinearProbingHashmap<Hash, KeyEq>::Find(const void* input_keys,
+                                                addr_t* output_addrs,
+                                                bool* output_masks,
+                                                int64_t count) {
+#pragma omp parallel for num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < count; ++i) {
+        const void* key = static_cast<const uint8_t*>(input_keys) +
+                          this->dsize_key_ * i;
+
+        bool flag = false;
+        addr_t addr = 0;
+        for (int64_t slot = hash_fn_(key) & slot_mask_;;
+             slot = (slot + 1) & slot_mask_) {
+            addr_t slot_addr = slots_[slot].load(std::memory_order_acquire);
+            if (slot_addr == kEmptySlot) {
+                break;
+            }
+            if (slot_addr != kErasedSlot && cmp_fn_(KeyAt(slot_addr), key)) {
+                flag = true;
+                addr = slot_addr;
+                break;
+            }
+        }
+
+        output_masks[i] = flag;
+        output_addrs[i] = addr;
+    }
+}
+
+template <typename Hash, typename KeyEq>
+void CPULinearProbingHashmap<Hash, KeyEq>::Erase(const void* input_keys,
+                                                 bool* output_masks,
+                                                 int64_t count) {
+#pragma omp parallel for num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < count; ++i) {
+        const void* key = static_cast<const uint8_t*>(input_keys) +
+                          this->dsize_key_ * i;
+
+        bool flag = false;
+        for (int64_t slot = hash_fn_(key) & slot_mask_;;
+             slot = (slot + 1) & slot_mask_) {
+            addr_t slot_addr = slots_[slot].load(std::memory_order_acquire);
+            if (slot_addr == kEmptySlot) {
+                break;
+            }
+            if (slot_addr != kErasedSlot && cmp_fn_(KeyAt(slot_addr), key)) {
+                // Only one of the duplicated keys in the input succeeds.
+                flag = slots_[slot].compare_exchange_strong(slot_addr,
+                                                            kErasedSlot);
+                if (flag) {
+                    buffer_ctx_->DeviceFree(slot_addr);
+                    erased_count_.fetch_add(1);
+                }
+                break;
+            }
+        }
+
+        output_masks[i] = flag;
+    }
+}
+
+template <typename Hash, typename KeyEq>
+int64_t CPULinearProbingHashmap<Hash, KeyEq>::GetActiveIndices(
+        addr_t* output_indices) {
+    int64_t count = 0;
+    for (int64_t slot = 0; slot < this->bucket_count_; ++slot) {
+        addr_t slot_addr = slots_[slot].load(std::memory_order_relaxed);
+        if (slot_addr != kEmptySlot && slot_addr != kErasedSlot) {
+            output_indices[count++] = slot_addr;
+        }
+    }
+
+    return count;
+}
+
+template <typename Hash, typename KeyEq>
+std::vector<int64_t> CPULinearProbingHashmap<Hash, KeyEq>::BucketSizes()
+        const {
+    std::vector<int64_t> ret(this->bucket_count_);
+    for (int64_t slot = 0; slot < this->bucket_count_; ++slot) {
+        addr_t slot_addr = slots_[slot].load(std::memory_order_relaxed);
+        ret[slot] = (slot_addr != kEmptySlot && slot_addr != kErasedSlot);
+    }
+    return ret;
+}
+
+template <typename Hash, typename KeyEq>
+float CPULinearProbingHashmap<Hash, KeyEq>::LoadFactor() const {
+    return float(Size()) / float(this->bucket_count_);
+}
+
+template <typename Hash, typename KeyEq>
+void CPULinearProbingHashmap<Hash, KeyEq>::InsertImpl(const void* input_keys,
+                                                      const void* input_values,
+                                                      addr_t* output_addrs,
+                                                      bool* output_masks,
+                                                      int64_t count,
+                                                      bool find_existing) {
+    // Allocated addresses of failed insertions, freed after the parallel loop
+    // since allocation and free cannot interleave on the heap.
+    std::vector<addr_t> allocated_addrs(count);
+
+    // The cost of an insertion depends on the length of its probe sequence.
+    kernel::ParallelFor(
+            count,
+            [&](int64_t i) {
+                const uint8_t* src_key =
+                        static_cast<const uint8_t*>(input_keys) +
+                        this->dsize_key_ * i;
+
+                // The key is written before its address is published by CAS,
+                // so that other threads probing the slot can compare it.
+                addr_t dst_kv_addr = buffer_ctx_->DeviceAllocate();
+                auto dst_kv_iter = buffer_ctx_->ExtractIterator(dst_kv_addr);
+                std::memcpy(dst_kv_iter.first, src_key, this->dsize_key_);
+
+                bool inserted = false;
+                addr_t found_addr = dst_kv_addr;
+                int64_t slot = hash_fn_(src_key) & slot_mask_;
+                while (true) {
+                    addr_t slot_addr =
+                            slots_[slot].load(std::memory_order_acquire);
+                    if (slot_addr == kEmptySlot) {
+                        if (slots_[slot].compare_exchange_strong(
+                                    slot_addr, dst_kv_addr,
+                                    std::memory_order_acq_rel)) {
+                            inserted = true;
+                            break;
+                        }
+                        // Lost the race, examine the winner in the same slot.
+                        continue;
+                    }
+                    if (slot_addr != kErasedSlot &&
+                        cmp_fn_(KeyAt(slot_addr), src_key)) {
+                        found_addr = slot_addr;
+                        break;
+                    }
+                    slot = (slot + 1) & slot_mask_;
+                }
+
+                if (inserted) {
+                    uint8_t* dst_value =
+                            static_cast<uint8_t*>(dst_kv_iter.second);
+                    if (input_values != nullptr) {
+                        const uint8_t* src_value =
+                                static_cast<const uint8_t*>(input_values) +
+                                this->dsize_value_ * i;
+                        std::memcpy(dst_value, src_value, this->dsize_value_);
+                    } else {
+                        std::memset(dst_value, 0, this->dsize_value_);
+                    }
+                }
+
+                allocated_addrs[i] = dst_kv_addr;
+                output_addrs[i] = find_existing ? found_addr : dst_kv_addr;
+                output_masks[i] = inserted;
+            },
+            kernel::ParallelSchedule::Dynamic());
+
+#pragma omp parallel for num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < count; ++i) {
+        if (!output_masks[i]) {
+            buffer_ctx_->DeviceFree(allocated_addrs[i]);
+        }
+    }
+}
+
+template <typename Hash, typename KeyEq>
+void CPULinearProbingHashmap<Hash, KeyEq>::PrepareInsert(int64_t count) {
+    int64_t new_size = Size() + count;
+    if (new_size > this->capacity_) {
+        Reserve(this->GrowthCapacity(new_size));
+    }
+
+    // Tombstones are never reused, so that concurrent insertions of the same
+    // key cannot claim two slots. Drop them when they crowd the slots.
+    int64_t max_used_slots = int64_t(this->bucket_count_ * MaxOccupancy());
+    if (new_size + erased_count_.load() > max_used_slots) {
+        RebuildSlots(ExpectedSlotCount(this->capacity_));
+    }
+}
+
+template <typename Hash, typename KeyEq>
+void CPULinearProbingHashmap<Hash, KeyEq>::ExtendBuffer(int64_t capacity) {
+    this->buffer_->Extend(capacity);
+    buffer_ctx_->Rebind(capacity, this->buffer_->GetKeyBuffer(),
+                        this->buffer_->GetValueBuffer(),
+                        this->buffer_->GetHeap());
+    this->capacity_ = capacity;
+}
+
+template <typename Hash, typename KeyEq>
+void CPULinearProbingHashmap<Hash, KeyEq>::RebuildSlots(int64_t slot_count) {
+    std::vector<addr_t> active_addrs;
+    if (slots_ != nullptr) {
+        active_addrs.resize(Size());
+        GetActiveIndices(active_addrs.data());
+    }
+
+    slots_.reset(new std::atomic<addr_t>[slot_count]);
+    slot_mask_ = slot_count - 1;
+    this->bucket_count_ = slot_count;
+    erased_count_ = 0;
+
+#pragma omp parallel for num_threads(utility::EstimateMaxThreads())
+    for (int64_t slot = 0; slot < slot_count; ++slot) {
+        slots_[slot].store(kEmptySlot, std::memory_order_relaxed);
+    }
+
+    // Active keys are unique, so only empty slots need to be claimed.
+    kernel::ParallelFor(
+            active_addrs.size(),
+            [&](int64_t i) {
+                addr_t addr = active_addrs[i];
+                int64_t slot = hash_fn_(KeyAt(addr)) & slot_mask_;
+                addr_t expected = kEmptySlot;
+                while (!slots_[slot].compare_exchange_strong(expected, addr)) {
+                    expected = kEmptySlot;
+                    slot = (slot + 1) & slot_mask_;
+                }
+            },
+            kernel::ParallelSchedule::Dynamic());
+}
+
+}  // namespace core
+}  // namespace open3d
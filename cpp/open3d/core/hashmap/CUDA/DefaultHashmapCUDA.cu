@@ -36,7 +36,7 @@ std::shared_ptr<DefaultDeviceHashmap> CreateDefaultCUDAHashmap(
         int64_t dsize_key,
         int64_t dsize_value,
         const Device& device) {
-    return std::make_shared<CUDAHashmap<DefaultHash, DefaultKeyEq>>(
+    return CreateSpecializedDeviceHashmap<CUDAHashmap>(
             init_buckets, init_capacity, dsize_key, dsize_value, device);
 }
 
@@ -67,6 +67,21 @@ public:
         OPEN3D_CUDA_CHECK(cudaMemset(values_, 0, capacity_ * dsize_value_));
     }
 
+    /// Point the context to an extended buffer. The heap counter is kept so
+    /// that addresses handed out before remain valid; fresh values are
+    /// zero-initialized.
+    __host__ void Rebind(int64_t capacity,
+                         Tensor &keys,
+                         Tensor &values,
+                         Tensor &heap) {
+        keys_ = static_cast<uint8_t *>(keys.GetDataPtr());
+        values_ = static_cast<uint8_t *>(values.GetDataPtr());
+        heap_ = static_cast<addr_t *>(heap.GetDataPtr());
+        OPEN3D_CUDA_CHECK(cudaMemset(values_ + capacity_ * dsize_value_, 0,
+                                     (capacity - capacity_) * dsize_value_));
+        capacity_ = capacity;
+    }
+
     __host__ void Reset(const Device &device) {
         int heap_counter = 0;
         MemoryManager::Memcpy(heap_counter_, device, &heap_counter,
@@ -62,6 +62,8 @@ public:
 
     void Rehash(int64_t buckets) override;
 
+    void Reserve(int64_t capacity) override;
+
     void Insert(const void* input_keys,
                 const void* input_values,
                 addr_t* output_addrs,
@@ -73,6 +75,12 @@ public:
                   bool* output_masks,
                   int64_t count) override;
 
+    void InsertOrFind(const void* input_keys,
+                      const void* input_values,
+                      addr_t* output_addrs,
+                      bool* output_masks,
+                      int64_t count) override;
+
     void Find(const void* input_keys,
               addr_t* output_addrs,
               bool* output_masks,
@@ -106,7 +114,17 @@ protected:
                     int64_t count);
 
     void Allocate(int64_t bucket_count, int64_t capacity);
+    void AllocateBuckets(int64_t bucket_count);
     void Free();
+
+    /// Extend the buffer to \p capacity. Slabs store addresses rather than
+    /// pointers, so the bucket index stays valid and is left untouched.
+    void ExtendBuffer(int64_t capacity);
+
+    /// Rebuild the slab lists with \p buckets buckets over the active
+    /// addresses. Only keys are gathered to recompute buckets; values and
+    /// addresses are not touched.
+    void Rebucket(int64_t buckets);
 };
 
 template <typename Hash, typename KeyEq>
@@ -127,40 +145,28 @@ CUDAHashmap<Hash, KeyEq>::~CUDAHashmap() {
 
 template <typename Hash, typename KeyEq>
 void CUDAHashmap<Hash, KeyEq>::Rehash(int64_t buckets) {
-    int64_t iterator_count = Size();
-
-    Tensor active_keys;
-    Tensor active_values;
-
-    if (iterator_count > 0) {
-        Tensor active_addrs =
-                Tensor({iterator_count}, Dtype::Int32, this->device_);
-        GetActiveIndices(static_cast<addr_t*>(active_addrs.GetDataPtr()));
-
-        Tensor active_indices = active_addrs.To(Dtype::Int64);
-        active_keys = this->buffer_->GetKeyBuffer().IndexGet({active_indices});
-        active_values =
-                this->buffer_->GetValueBuffer().IndexGet({active_indices});
+    int64_t capacity =
+            int64_t(std::ceil(buckets * this->avg_capacity_bucket_ratio()));
+    if (capacity > this->capacity_) {
+        ExtendBuffer(capacity);
     }
+    if (buckets != this->bucket_count_) {
+        Rebucket(buckets);
+    }
+}
 
-    float avg_capacity_per_bucket =
-            float(this->capacity_) / float(this->bucket_count_);
-
-    Free();
-    CUDACachedMemoryManager::ReleaseCache();
-
-    Allocate(buckets, int64_t(std::ceil(buckets * avg_capacity_per_bucket)));
+template <typename Hash, typename KeyEq>
+void CUDAHashmap<Hash, KeyEq>::Reserve(int64_t capacity) {
+    if (capacity <= this->capacity_) {
+        return;
+    }
 
-    if (iterator_count > 0) {
-        Tensor output_addrs({iterator_count}, Dtype::Int32, this->device_);
-        Tensor output_masks({iterator_count}, Dtype::Bool, this->device_);
+    ExtendBuffer(capacity);
 
-        InsertImpl(active_keys.GetDataPtr(), active_values.GetDataPtr(),
-                   static_cast<addr_t*>(output_addrs.GetDataPtr()),
-                   static_cast<bool*>(output_masks.GetDataPtr()),
-                   iterator_count);
+    int64_t buckets = this->ExpectedBucketCount(capacity);
+    if (buckets > this->bucket_count_) {
+        Rebucket(buckets);
     }
-    CUDACachedMemoryManager::ReleaseCache();
 }
 
 template <typename Hash, typename KeyEq>
@@ -171,12 +177,7 @@ void CUDAHashmap<Hash, KeyEq>::Insert(const void* input_keys,
                                       int64_t count) {
     int64_t new_size = Size() + count;
     if (new_size > this->capacity_) {
-        float avg_capacity_per_bucket =
-                float(this->capacity_) / float(this->bucket_count_);
-        int64_t expected_buckets = std::max(
-                int64_t(this->bucket_count_ * 2),
-                int64_t(std::ceil(new_size / avg_capacity_per_bucket)));
-        Rehash(expected_buckets);
+        Reserve(this->GrowthCapacity(new_size));
     }
 
     InsertImpl(input_keys, input_values, output_addrs, output_masks, count);
@@ -189,17 +190,40 @@ void CUDAHashmap<Hash, KeyEq>::Activate(const void* input_keys,
                                         int64_t count) {
     int64_t new_size = Size() + count;
     if (new_size > this->capacity_) {
-        float avg_capacity_per_bucket =
-                float(this->capacity_) / float(this->bucket_count_);
-        int64_t expected_buckets = std::max(
-                int64_t(this->bucket_count_ * 2),
-                int64_t(std::ceil(new_size / avg_capacity_per_bucket)));
-        Rehash(expected_buckets);
+        Reserve(this->GrowthCapacity(new_size));
     }
 
     InsertImpl(input_keys, nullptr, output_addrs, output_masks, count);
 }
 
+template <typename Hash, typename KeyEq>
+void CUDAHashmap<Hash, KeyEq>::InsertOrFind(const void* input_keys,
+                                            const void* input_values,
+                                            addr_t* output_addrs,
+                                            bool* output_masks,
+                                            int64_t count) {
+    int64_t new_size = Size() + count;
+    if (new_size > this->capacity_) {
+        Reserve(this->GrowthCapacity(new_size));
+    }
+
+    if (count == 0) return;
+
+    int prev_heap_counter = buffer_ctx_.HeapCounter(this->device_);
+    *thrust::device_ptr<int>(gpu_context_.kv_mgr_ctx_.heap_counter_) =
+            prev_heap_counter + count;
+
+    const int64_t num_blocks =
+            (count + kThreadsPerBlock - 1) / kThreadsPerBlock;
+    InsertKernelPass0<<<num_blocks, kThreadsPerBlock>>>(
+            gpu_context_, input_keys, output_addrs, prev_heap_counter, count);
+    InsertOrFindKernelPass1<<<num_blocks, kThreadsPerBlock>>>(
+            gpu_context_, input_keys, input_values, output_addrs, output_masks,
+            count);
+    OPEN3D_CUDA_CHECK(cudaDeviceSynchronize());
+    OPEN3D_CUDA_CHECK(cudaGetLastError());
+}
+
 template <typename Hash, typename KeyEq>
 void CUDAHashmap<Hash, KeyEq>::Find(const void* input_keys,
                                     addr_t* output_addrs,
@@ -318,7 +342,6 @@ void CUDAHashmap<Hash, KeyEq>::InsertImpl(const void* input_keys,
 template <typename Hash, typename KeyEq>
 void CUDAHashmap<Hash, KeyEq>::Allocate(int64_t bucket_count,
                                         int64_t capacity) {
-    this->bucket_count_ = bucket_count;
     this->capacity_ = capacity;
 
     // Allocate buffer for key values.
@@ -332,8 +355,16 @@ void CUDAHashmap<Hash, KeyEq>::Allocate(int64_t bucket_count,
                       this->buffer_->GetHeap());
     buffer_ctx_.Reset(this->device_);
 
+    AllocateBuckets(bucket_count);
+}
+
+template <typename Hash, typename KeyEq>
+void CUDAHashmap<Hash, KeyEq>::AllocateBuckets(int64_t bucket_count) {
+    this->bucket_count_ = bucket_count;
+
     // Allocate buffer for linked list nodes.
-    node_mgr_ = std::make_shared<InternalNodeManager>(this->device_);
+    node_mgr_ = std::make_shared<InternalNodeManager>(this->device_,
+                                                      this->capacity_);
 
     // Allocate linked list heads.
     gpu_context_.bucket_list_head_ = static_cast<Slab*>(MemoryManager::Malloc(
@@ -351,5 +382,50 @@ void CUDAHashmap<Hash, KeyEq>::Free() {
     buffer_ctx_.HostFree(this->device_);
     MemoryManager::Free(gpu_context_.bucket_list_head_, this->device_);
 }
+
+template <typename Hash, typename KeyEq>
+void CUDAHashmap<Hash, KeyEq>::ExtendBuffer(int64_t capacity) {
+    this->buffer_->Extend(capacity);
+    buffer_ctx_.Rebind(capacity, this->buffer_->GetKeyBuffer(),
+                       this->buffer_->GetValueBuffer(),
+                       this->buffer_->GetHeap());
+    this->capacity_ = capacity;
+    node_mgr_->Reserve(capacity);
+
+    gpu_context_.Setup(this->bucket_count_, this->capacity_, this->dsize_key_,
+                       this->dsize_value_, node_mgr_->gpu_context_,
+                       buffer_ctx_);
+}
+
+template <typename Hash, typename KeyEq>
+void CUDAHashmap<Hash, KeyEq>::Rebucket(int64_t buckets) {
+    int64_t iterator_count = Size();
+
+    Tensor active_addrs;
+    Tensor active_keys;
+    if (iterator_count > 0) {
+        active_addrs = Tensor({iterator_count}, Dtype::Int32, this->device_);
+        GetActiveIndices(static_cast<addr_t*>(active_addrs.GetDataPtr()));
+
+        Tensor active_indices = active_addrs.To(Dtype::Int64);
+        active_keys = this->buffer_->GetKeyBuffer().IndexGet({active_indices});
+    }
+
+    MemoryManager::Free(gpu_context_.bucket_list_head_, this->device_);
+    AllocateBuckets(buckets);
+
+    if (iterator_count > 0) {
+        Tensor output_masks({iterator_count}, Dtype::Bool, this->device_);
+
+        const int64_t num_blocks =
+                (iterator_count + kThreadsPerBlock - 1) / kThreadsPerBlock;
+        InsertKernelPass1<<<num_blocks, kThreadsPerBlock>>>(
+                gpu_context_, active_keys.GetDataPtr(),
+                static_cast<addr_t*>(active_addrs.GetDataPtr()),
+                static_cast<bool*>(output_masks.GetDataPtr()), iterator_count);
+        OPEN3D_CUDA_CHECK(cudaDeviceSynchronize());
+        OPEN3D_CUDA_CHECK(cudaGetLastError());
+    }
+}
 }  // namespace core
 }  // namespace open3d
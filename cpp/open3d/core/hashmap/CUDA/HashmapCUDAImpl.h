@@ -45,11 +45,13 @@ public:
                         const InternalNodeManagerContext& node_mgr_ctx,
                         const CUDAHashmapBufferContext& kv_mgr_ctx);
 
-    __device__ bool Insert(bool lane_active,
-                           uint32_t lane_id,
-                           uint32_t bucket_id,
-                           const void* key_ptr,
-                           addr_t iterator_addr);
+    /// Returns the address holding the key (\p iterator_addr on success, the
+    /// pre-existing one otherwise) and whether the insertion succeeded.
+    __device__ Pair<addr_t, bool> Insert(bool lane_active,
+                                         uint32_t lane_id,
+                                         uint32_t bucket_id,
+                                         const void* key_ptr,
+                                         addr_t iterator_addr);
 
     __device__ Pair<addr_t, bool> Find(bool lane_active,
                                        uint32_t lane_id,
@@ -123,6 +125,15 @@ __global__ void InsertKernelPass2(CUDAHashmapImplContext<Hash, KeyEq> hash_ctx,
                                   bool* output_masks,
                                   int64_t count);
 
+template <typename Hash, typename KeyEq>
+__global__ void InsertOrFindKernelPass1(
+        CUDAHashmapImplContext<Hash, KeyEq> hash_ctx,
+        const void* input_keys,
+        const void* input_values,
+        addr_t* output_addrs,
+        bool* output_masks,
+        int64_t count);
+
 template <typename Hash, typename KeyEq>
 __global__ void FindKernel(CUDAHashmapImplContext<Hash, KeyEq> hash_ctx,
                            const void* input_keys,
@@ -174,12 +185,12 @@ void CUDAHashmapImplContext<Hash, KeyEq>::Setup(
     node_mgr_ctx_ = allocator_ctx;
     kv_mgr_ctx_ = pair_allocator_ctx;
 
-    hash_fn_.key_size_in_int_ = dsize_key / sizeof(int);
-    cmp_fn_.key_size_in_int_ = dsize_key / sizeof(int);
+    hash_fn_ = Hash(dsize_key);
+    cmp_fn_ = KeyEq(dsize_key);
 }
 
 template <typename Hash, typename KeyEq>
-__device__ bool CUDAHashmapImplContext<Hash, KeyEq>::Insert(
+__device__ Pair<addr_t, bool> CUDAHashmapImplContext<Hash, KeyEq>::Insert(
         bool lane_active,
         uint32_t lane_id,
         uint32_t bucket_id,
@@ -190,6 +201,7 @@ __device__ bool CUDAHashmapImplContext<Hash, KeyEq>::Insert(
     uint32_t curr_slab_ptr = kHeadSlabAddr;
     uint8_t src_key[kMaxKeyByteSize];
 
+    addr_t iterator = kNullAddr;
     bool mask = false;
 
     // > Loop when we have active lanes
@@ -215,9 +227,14 @@ __device__ bool CUDAHashmapImplContext<Hash, KeyEq>::Insert(
 
         // Branch 1: key already existing, ABORT
         if (lane_found >= 0) {
+            // broadcast the existing iterator address
+            addr_t found_iterator_addr = __shfl_sync(
+                    kSyncLanesMask, unit_data, lane_found, kWarpSize);
+
             if (lane_id == src_lane) {
                 // free memory heap
                 lane_active = false;
+                iterator = found_iterator_addr;
             }
         }
 
@@ -240,6 +257,7 @@ __device__ bool CUDAHashmapImplContext<Hash, KeyEq>::Insert(
                 // Branch 2.1: SUCCEED
                 if (old_iterator_addr == kEmptyNodeAddr) {
                     lane_active = false;
+                    iterator = iterator_addr;
                     mask = true;
                 }
                 // Branch 2.2: failed: RESTART
@@ -293,7 +311,7 @@ __device__ bool CUDAHashmapImplContext<Hash, KeyEq>::Insert(
         prev_work_queue = work_queue;
     }
 
-    return mask;
+    return make_pair(iterator, mask);
 }
 
 template <typename Hash, typename KeyEq>
@@ -542,7 +560,8 @@ __global__ void InsertKernelPass1(CUDAHashmapImplContext<Hash, KeyEq> hash_ctx,
 
     // Index out-of-bound threads still have to run for warp synchronization.
     bool mask = hash_ctx.Insert(lane_active, lane_id, bucket_id, key,
-                                iterator_addr);
+                                iterator_addr)
+                        .second;
 
     if (tid < count) {
         output_masks[tid] = mask;
@@ -578,6 +597,64 @@ __global__ void InsertKernelPass2(CUDAHashmapImplContext<Hash, KeyEq> hash_ctx,
     }
 }
 
+template <typename Hash, typename KeyEq>
+__global__ void InsertOrFindKernelPass1(
+        CUDAHashmapImplContext<Hash, KeyEq> hash_ctx,
+        const void* input_keys,
+        const void* input_values,
+        addr_t* output_addrs,
+        bool* output_masks,
+        int64_t count) {
+    uint32_t tid = threadIdx.x + blockIdx.x * blockDim.x;
+    uint32_t lane_id = tid & 0x1F;
+
+    if (tid - lane_id >= count) {
+        return;
+    }
+
+    hash_ctx.node_mgr_ctx_.Init(tid, lane_id);
+
+    bool lane_active = false;
+    uint32_t bucket_id = 0;
+    addr_t iterator_addr = 0;
+
+    // Dummy.
+    uint8_t dummy_key[kMaxKeyByteSize];
+    const void* key = reinterpret_cast<const void*>(dummy_key);
+
+    if (tid < count) {
+        lane_active = true;
+        key = static_cast<const uint8_t*>(input_keys) +
+              tid * hash_ctx.dsize_key_;
+        iterator_addr = output_addrs[tid];
+        bucket_id = hash_ctx.ComputeBucket(key);
+    }
+
+    // Index out-of-bound threads still have to run for warp synchronization.
+    Pair<addr_t, bool> result = hash_ctx.Insert(lane_active, lane_id,
+                                                bucket_id, key, iterator_addr);
+
+    if (tid < count) {
+        // Insertion and value copy are fused, since a failed insertion
+        // returns the existing address in place of the allocated one.
+        if (result.second) {
+            if (input_values != nullptr) {
+                iterator_t iterator =
+                        hash_ctx.kv_mgr_ctx_.ExtractIterator(iterator_addr);
+                MEMCPY_AS_INTS(iterator.second,
+                               static_cast<const uint8_t*>(input_values) +
+                                       tid * hash_ctx.dsize_value_,
+                               hash_ctx.dsize_value_);
+            }
+        } else {
+            hash_ctx.kv_mgr_ctx_.DeviceFree(iterator_addr);
+        }
+
+        output_addrs[tid] = result.first;
+        output_masks[tid] = result.second;
+    }
+}
+
 template <typename Hash, typename KeyEq>
 __global__ void FindKernel(CUDAHashmapImplContext<Hash, KeyEq> hash_ctx,
                            const void* input_keys,
@@ -68,6 +68,7 @@ class InternalNodeManagerContext {
 public:
     InternalNodeManagerContext()
         : super_blocks_(nullptr),
+          num_super_blocks_(0),
           hash_coef_(0),
           num_attempts_(0),
           memory_block_index_(0),
@@ -183,7 +184,7 @@ private:
 
     // Called at the beginning of the kernel.
     __device__ void createMemBlockIndex(uint32_t global_warp_id) {
-        super_block_index_ = global_warp_id % kSuperBlocks;
+        super_block_index_ = global_warp_id % num_super_blocks_;
         memory_block_index_ = (hash_coef_ * global_warp_id) >>
                               (32 - kBlocksPerSuperBlockInBits);
     }
@@ -192,8 +193,9 @@ private:
     __device__ void updateMemBlockIndex(uint32_t global_warp_id) {
         num_attempts_++;
         super_block_index_++;
-        super_block_index_ =
-                (super_block_index_ == kSuperBlocks) ? 0 : super_block_index_;
+        super_block_index_ = (super_block_index_ == num_super_blocks_)
+                                     ? 0
+                                     : super_block_index_;
         memory_block_index_ = (hash_coef_ * (global_warp_id + num_attempts_)) >>
                               (32 - kBlocksPerSuperBlockInBits);
         // Loading the assigned memory block.
@@ -220,6 +222,8 @@ private:
 public:
     /// A pointer to each super-block.
     uint32_t* super_blocks_;
+    /// Number of super blocks in use, at most kSuperBlocks.
+    uint32_t num_super_blocks_;
     /// hash_coef (register): used as (16 bits, 16 bits) for hashing.
     uint32_t hash_coef_;  // A random 32-bit.
 
@@ -234,40 +238,75 @@ private:
 __global__ void CountSlabsPerSuperblockKernel(
         InternalNodeManagerContext context, uint32_t* slabs_per_superblock);
 
+/// Owns the slab pool of a CUDA hashmap. The pool holds as many super blocks
+/// as the capacity requires and grows with it, so that small hashmaps do not
+/// pay for the full kSuperBlocks. Pools are requested from the MemoryManager
+/// in power-of-two super block counts; with the CUDACachedMemoryManager a
+/// pool released by one hashmap is reused by the next one of similar size.
 class InternalNodeManager {
 public:
-    InternalNodeManager(const Device& device) : device_(device) {
+    InternalNodeManager(const Device& device, int64_t capacity)
+        : device_(device) {
         /// Random coefficients for allocator's hash function.
         std::mt19937 rng(time(0));
         gpu_context_.hash_coef_ = rng();
 
         /// In the light version, we put num_super_blocks super blocks within
         /// a single array.
-        gpu_context_.super_blocks_ =
-                static_cast<uint32_t*>(MemoryManager::Malloc(
-                        kUIntsPerSuperBlock * kSuperBlocks * sizeof(uint32_t),
-                        device_));
+        const uint32_t num_super_blocks = ExpectedSuperBlocks(capacity);
+        gpu_context_.super_blocks_ = MallocSuperBlocks(num_super_blocks);
+        InitSuperBlocks(gpu_context_.super_blocks_, 0, num_super_blocks);
+        gpu_context_.num_super_blocks_ = num_super_blocks;
+    }
 
-        OPEN3D_CUDA_CHECK(cudaMemset(
-                gpu_context_.super_blocks_, 0xFF,
-                kUIntsPerSuperBlock * kSuperBlocks * sizeof(uint32_t)));
+    ~InternalNodeManager() {
+        MemoryManager::Free(gpu_context_.super_blocks_, device_);
+    }
 
-        for (uint32_t i = 0; i < kSuperBlocks; i++) {
-            // setting bitmaps into zeros:
-            OPEN3D_CUDA_CHECK(cudaMemset(
-                    gpu_context_.super_blocks_ + i * kUIntsPerSuperBlock, 0x00,
-                    kBlocksPerSuperBlock * kSlabsPerBlock * sizeof(uint32_t)));
+    /// Number of super blocks needed to hold the overflow slabs of a hashmap
+    /// with \p capacity entries. A bucket only owns overflow slabs past its
+    /// first 31 entries, and all but its last overflow slab are full, so
+    /// capacity / 31 slabs suffice; the bound is doubled to leave room for the
+    /// randomized warp allocator.
+    static uint32_t ExpectedSuperBlocks(int64_t capacity) {
+        const int64_t slabs =
+                2 * ((capacity + kWarpSize - 2) / (kWarpSize - 1));
+        uint32_t num_super_blocks = 1;
+        while (num_super_blocks < kSuperBlocks &&
+               int64_t(num_super_blocks) * kSlabsPerSuperBlock < slabs) {
+            num_super_blocks <<= 1;
         }
+        return num_super_blocks;
     }
 
-    ~InternalNodeManager() {
+    /// Grow the pool to serve \p capacity entries. Slab addresses encode the
+    /// super block index and offsets only, so existing super blocks are copied
+    /// as-is and the slab lists built on them remain valid. Contexts copied
+    /// before the call must be refreshed from gpu_context_.
+    void Reserve(int64_t capacity) {
+        const uint32_t num_super_blocks = ExpectedSuperBlocks(capacity);
+        const uint32_t prev_num_super_blocks = gpu_context_.num_super_blocks_;
+        if (num_super_blocks <= prev_num_super_blocks) {
+            return;
+        }
+
+        uint32_t* super_blocks = MallocSuperBlocks(num_super_blocks);
+        MemoryManager::Memcpy(super_blocks, device_,
+                              gpu_context_.super_blocks_, device_,
+                              kUIntsPerSuperBlock * prev_num_super_blocks *
+                                      sizeof(uint32_t));
+        InitSuperBlocks(super_blocks, prev_num_super_blocks,
+                        num_super_blocks);
         MemoryManager::Free(gpu_context_.super_blocks_, device_);
+
+        gpu_context_.super_blocks_ = super_blocks;
+        gpu_context_.num_super_blocks_ = num_super_blocks;
     }
 
     std::vector<int> CountSlabsPerSuperblock() {
-        const uint32_t num_super_blocks = kSuperBlocks;
+        const uint32_t num_super_blocks = gpu_context_.num_super_blocks_;
 
-        thrust::device_vector<uint32_t> slabs_per_superblock(kSuperBlocks);
+        thrust::device_vector<uint32_t> slabs_per_superblock(num_super_blocks);
         thrust::fill(slabs_per_superblock.begin(), slabs_per_superblock.end(),
                      0);
 
@@ -288,6 +327,30 @@ public:
         return std::move(result);
     }
 
+private:
+    uint32_t* MallocSuperBlocks(uint32_t num_super_blocks) {
+        return static_cast<uint32_t*>(MemoryManager::Malloc(
+                kUIntsPerSuperBlock * num_super_blocks * sizeof(uint32_t),
+                device_));
+    }
+
+    /// Mark the slabs of super blocks [begin, end) as empty and their bitmaps
+    /// as free.
+    static void InitSuperBlocks(uint32_t* super_blocks,
+                                uint32_t begin,
+                                uint32_t end) {
+        OPEN3D_CUDA_CHECK(cudaMemset(
+                super_blocks + begin * kUIntsPerSuperBlock, 0xFF,
+                kUIntsPerSuperBlock * (end - begin) * sizeof(uint32_t)));
+
+        for (uint32_t i = begin; i < end; i++) {
+            // setting bitmaps into zeros:
+            OPEN3D_CUDA_CHECK(cudaMemset(
+                    super_blocks + i * kUIntsPerSuperBlock, 0x00,
+                    kBitmapsPerSuperBlock * sizeof(uint32_t)));
+        }
+    }
+
 public:
     InternalNodeManagerContext gpu_context_;
     Device device_;
@@ -302,7 +365,7 @@ __global__ void CountSlabsPerSuperblockKernel(
         return;
     }
 
-    for (uint32_t i = 0; i < kSuperBlocks; i++) {
+    for (uint32_t i = 0; i < context.num_super_blocks_; i++) {
         uint32_t read_bitmap = *(context.get_ptr_for_bitmap(i, tid));
         atomicAdd(&slabs_per_superblock[i], __popc(read_bitmap));
     }
@@ -53,6 +53,8 @@ static constexpr uint32_t kWarpSize = 32;
 // Tunable variables
 //////////////////////
 // Hashmap
+// Upper bound of the super blocks owned by a node manager: a slab address
+// spends its top 5 bits on the super block index.
 static constexpr uint32_t kSuperBlocks = 32;
 static constexpr uint32_t kBlocksPerSuperBlock = 4;
 static constexpr uint32_t kBlocksPerSuperBlockInBits = 2;
@@ -72,6 +74,8 @@ static constexpr uint32_t kBitmapsPerSuperBlock =
         kBlocksPerSuperBlock * kSlabsPerBlock;
 static constexpr uint32_t kUIntsPerSuperBlock =
         kBlocksPerSuperBlock * kUIntsPerBlock + kBitmapsPerSuperBlock;
+static constexpr uint32_t kSlabsPerSuperBlock =
+        kBlocksPerSuperBlock * kSlabsPerBlock;
 
 //////////////////////
 // Non-tunable variables
@@ -43,13 +43,19 @@ std::shared_ptr<DefaultDeviceHashmap> CreateDefaultDeviceHashmap(
         int64_t init_capacity,
         int64_t dsize_key,
         int64_t dsize_value,
-        const Device& device) {
+        const Device& device,
+        const HashmapBackend& backend) {
     if (device.GetType() == Device::DeviceType::CPU) {
         return CreateDefaultCPUHashmap(init_buckets, init_capacity, dsize_key,
-                                       dsize_value, device);
+                                       dsize_value, device, backend);
     }
 #if defined(BUILD_CUDA_MODULE)
     else if (device.GetType() == Device::DeviceType::CUDA) {
+        if (backend != HashmapBackend::Default) {
+            utility::LogError(
+                    "[CreateDefaultDeviceHashmap]: Unsupported backend for "
+                    "CUDA");
+        }
         return CreateDefaultCUDAHashmap(init_buckets, init_capacity, dsize_key,
                                         dsize_value, device);
     }
@@ -26,9 +26,13 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cmath>
+
 #include "open3d/core/CUDAUtils.h"
 #include "open3d/core/MemoryManager.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/core/hashmap/Hashmap.h"
 #include "open3d/core/hashmap/HashmapBuffer.h"
 
 namespace open3d {
@@ -96,12 +100,75 @@ public:
     int64_t key_size_in_int_;
 };
 
-/// Base class: shared interface
-template <typename Hash, typename KeyEq>
-class DeviceHashmap {
+/// Hash and equal functions specialized for keys of a fixed number of ints,
+/// e.g. Int32, Int64 and Int32x3 voxel coordinates. The loops are unrolled at
+/// compile time, instead of running over the key size known at runtime.
+/// The hash values are identical to DefaultHash.
+template <int kKeySizeInInt>
+class FixedSizeHash {
+public:
+    FixedSizeHash() {}
+    FixedSizeHash(int64_t key_size) {
+        if (key_size != int64_t(kKeySizeInInt * sizeof(int))) {
+            utility::LogError(
+                    "[FixedSizeHash] Expected key byte size {}, but got {}",
+                    kKeySizeInInt * sizeof(int), key_size);
+        }
+    }
+
+    uint64_t OPEN3D_HOST_DEVICE operator()(const void* key_ptr) const {
+        uint64_t hash = UINT64_C(14695981039346656037);
+
+        auto cast_key_ptr = static_cast<const int*>(key_ptr);
+#if defined(__CUDA_ARCH__)
+#pragma unroll
+#endif
+        for (int i = 0; i < kKeySizeInInt; ++i) {
+            hash ^= cast_key_ptr[i];
+            hash *= UINT64_C(1099511628211);
+        }
+        return hash;
+    }
+};
+
+template <int kKeySizeInInt>
+class FixedSizeKeyEq {
+public:
+    FixedSizeKeyEq() {}
+    FixedSizeKeyEq(int64_t key_size) {
+        if (key_size != int64_t(kKeySizeInInt * sizeof(int))) {
+            utility::LogError(
+                    "[FixedSizeKeyEq] Expected key byte size {}, but got {}",
+                    kKeySizeInInt * sizeof(int), key_size);
+        }
+    }
+
+    bool OPEN3D_HOST_DEVICE operator()(const void* lhs, const void* rhs) const {
+        if (lhs == nullptr || rhs == nullptr) {
+            return false;
+        }
+
+        auto lhs_key_ptr = static_cast<const int*>(lhs);
+        auto rhs_key_ptr = static_cast<const int*>(rhs);
+
+        // Branch-free comparison of all the ints.
+        int diff = 0;
+#if defined(__CUDA_ARCH__)
+#pragma unroll
+#endif
+        for (int i = 0; i < kKeySizeInInt; ++i) {
+            diff |= lhs_key_ptr[i] ^ rhs_key_ptr[i];
+        }
+        return diff == 0;
+    }
+};
+
+/// Base class: shared interface, independent of the hash and equal functions
+/// so that hashmaps of different key types can be used interchangeably.
+class DeviceHashmapBase {
 public:
     /// Comprehensive constructor for the developer.
-    DeviceHashmap(int64_t init_buckets,
+    DeviceHashmapBase(int64_t init_buckets,
                   int64_t init_capacity,
                   int64_t dsize_key,
                   int64_t dsize_value,
@@ -110,17 +177,21 @@ public:
           capacity_(init_capacity),
           dsize_key_(dsize_key),
           dsize_value_(dsize_value),
-          device_(device) {}
-    virtual ~DeviceHashmap() {}
-
-    /// Rehash expects a lot of extra memory space at runtime,
-    /// since it consists of
-    /// 1) dumping all key value pairs to a buffer
-    /// 2) creating a new hash table
-    /// 3) parallel inserting dumped key value pairs
-    /// 4) deallocating old hash table
+          device_(device),
+          max_load_factor_(float(init_capacity) / float(init_buckets)) {}
+    virtual ~DeviceHashmapBase() {}
+
+    /// Rehash resizes the bucket array to \p buckets and grows the buffer to
+    /// keep the current capacity / bucket ratio. Key value pairs are not
+    /// dumped or reinserted: the buffer is extended in place and only the
+    /// bucket index is rebuilt, so addresses remain valid.
     virtual void Rehash(int64_t buckets) = 0;
 
+    /// Grow the buffer to hold at least \p capacity elements, and the bucket
+    /// array to keep the load factor below the max load factor. Addresses
+    /// remain valid. No-op if the capacity is already large enough.
+    virtual void Reserve(int64_t capacity) = 0;
+
     /// Parallel insert contiguous arrays of keys and values.
     virtual void Insert(const void* input_keys,
                         const void* input_values,
@@ -136,6 +207,16 @@ public:
                           bool* output_masks,
                           int64_t count) = 0;
 
+    /// Parallel insert contiguous arrays of keys and values, and find keys
+    /// that already exist, with a single probe per key. \p input_values can
+    /// be nullptr to activate without copying values. All output iterators
+    /// are valid; output masks are true for newly inserted keys.
+    virtual void InsertOrFind(const void* input_keys,
+                              const void* input_values,
+                              addr_t* output_iterators,
+                              bool* output_masks,
+                              int64_t count) = 0;
+
     /// Parallel find a contiguous array of keys.
     virtual void Find(const void* input_keys,
                       addr_t* output_iterators,
@@ -168,6 +249,13 @@ public:
     /// Return size / bucket_count.
     virtual float LoadFactor() const = 0;
 
+    /// The max load factor bounds size / bucket_count: buckets are added
+    /// whenever growth would exceed it.
+    virtual void SetMaxLoadFactor(float max_load_factor) {
+        max_load_factor_ = max_load_factor;
+    }
+    float GetMaxLoadFactor() const { return max_load_factor_; }
+
 public:
     int64_t bucket_count_;
     int64_t capacity_;
@@ -178,9 +266,31 @@ public:
 
     std::shared_ptr<HashmapBuffer> buffer_;
 
+    float max_load_factor_;
+
     float avg_capacity_bucket_ratio() {
         return float(capacity_) / float(bucket_count_);
     }
+
+    /// Capacity to reserve when \p new_size elements no longer fit. Doubling
+    /// keeps the amortized cost of growth constant per insertion.
+    int64_t GrowthCapacity(int64_t new_size) const {
+        return std::max(capacity_ * 2, new_size);
+    }
+
+    /// Bucket count required to hold \p capacity elements within the max
+    /// load factor. Never smaller than the current bucket count.
+    int64_t ExpectedBucketCount(int64_t capacity) const {
+        return std::max(bucket_count_,
+                        int64_t(std::ceil(capacity / max_load_factor_)));
+    }
+};
+
+/// Hashmap with a given hash and equal function.
+template <typename Hash, typename KeyEq>
+class DeviceHashmap : public DeviceHashmapBase {
+public:
+    using DeviceHashmapBase::DeviceHashmapBase;
 };
 
 /// Factory functions:
@@ -191,21 +301,56 @@ public:
 /// - Template constructor switch is in TemplateHashmap.h
 /// - Template CPU constructor is in CPU/TemplateHashmapCPU.hpp
 /// - Template CUDA constructor is in CUDA/TemplateHashmapCUDA.cuh
-typedef DeviceHashmap<DefaultHash, DefaultKeyEq> DefaultDeviceHashmap;
+typedef DeviceHashmapBase DefaultDeviceHashmap;
+
+/// Instantiate \p DeviceHashmapT (CPUHashmap or CUDAHashmap) with the
+/// fixed-size hash and equal functions for the common key sizes (Int32, Int64
+/// and Int32x3), falling back to the generic DefaultHash / DefaultKeyEq.
+template <template <typename, typename> class DeviceHashmapT>
+std::shared_ptr<DefaultDeviceHashmap> CreateSpecializedDeviceHashmap(
+        int64_t init_buckets,
+        int64_t init_capacity,
+        int64_t dsize_key,
+        int64_t dsize_value,
+        const Device& device) {
+    switch (dsize_key) {
+        case sizeof(int):
+            return std::make_shared<
+                    DeviceHashmapT<FixedSizeHash<1>, FixedSizeKeyEq<1>>>(
+                    init_buckets, init_capacity, dsize_key, dsize_value,
+                    device);
+        case 2 * sizeof(int):
+            return std::make_shared<
+                    DeviceHashmapT<FixedSizeHash<2>, FixedSizeKeyEq<2>>>(
+                    init_buckets, init_capacity, dsize_key, dsize_value,
+                    device);
+        case 3 * sizeof(int):
+            return std::make_shared<
+                    DeviceHashmapT<FixedSizeHash<3>, FixedSizeKeyEq<3>>>(
+                    init_buckets, init_capacity, dsize_key, dsize_value,
+                    device);
+        default:
+            return std::make_shared<DeviceHashmapT<DefaultHash, DefaultKeyEq>>(
+                    init_buckets, init_capacity, dsize_key, dsize_value,
+                    device);
+    }
+}
 
 std::shared_ptr<DefaultDeviceHashmap> CreateDefaultDeviceHashmap(
         int64_t init_buckets,
         int64_t init_capacity,
         int64_t dsize_key,
         int64_t dsize_value,
-        const Device& device);
+        const Device& device,
+        const HashmapBackend& backend = HashmapBackend::Default);
 
 std::shared_ptr<DefaultDeviceHashmap> CreateDefaultCPUHashmap(
         int64_t init_buckets,
         int64_t init_capacity,
         int64_t dsize_key,
         int64_t dsize_value,
-        const Device& device);
+        const Device& device,
+        const HashmapBackend& backend = HashmapBackend::Default);
 
 std::shared_ptr<DefaultDeviceHashmap> CreateDefaultCUDAHashmap(
         int64_t init_buckets,
@@ -32,24 +32,147 @@
 
 #include "open3d/core/hashmap/Hashmap.h"
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <cstring>
+
 #include "open3d/core/Tensor.h"
 #include "open3d/core/hashmap/DeviceHashmap.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Helper.h"
 
 namespace open3d {
 namespace core {
 
+/// Binary format written by Hashmap::Save:
+/// - magic "O3DHMAP\0", version, capacity, size
+/// - key dtype (code, byte size, name) and element shape
+/// - value dtype (code, byte size, name) and element shape
+/// - keys [size * key byte size], aligned to Hashmap::kFileAlignment
+/// - values [size * value byte size], aligned to Hashmap::kFileAlignment
+static const char kHashmapFileMagic[8] = "O3DHMAP";
+static constexpr int64_t kHashmapFileVersion = 1;
+static constexpr int64_t kDtypeNameLen = 16;
+
+static int64_t AlignOffset(int64_t offset) {
+    return (offset + Hashmap::kFileAlignment - 1) / Hashmap::kFileAlignment *
+           Hashmap::kFileAlignment;
+}
+
+static void WriteInt64(std::vector<uint8_t>& header, int64_t value) {
+    const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&value);
+    header.insert(header.end(), ptr, ptr + sizeof(int64_t));
+}
+
+static void WriteDtypeAndShape(std::vector<uint8_t>& header,
+                               const Dtype& dtype,
+                               const SizeVector& element_shape) {
+    WriteInt64(header, static_cast<int64_t>(dtype.GetDtypeCode()));
+    WriteInt64(header, dtype.ByteSize());
+    char name[kDtypeNameLen] = {0};
+    std::strncpy(name, dtype.ToString().c_str(), kDtypeNameLen - 1);
+    header.insert(header.end(), name, name + kDtypeNameLen);
+    WriteInt64(header, static_cast<int64_t>(element_shape.size()));
+    for (int64_t dim : element_shape) {
+        WriteInt64(header, dim);
+    }
+}
+
+static int64_t ReadInt64(const uint8_t* data,
+                         int64_t file_size,
+                         int64_t& offset) {
+    if (offset + int64_t(sizeof(int64_t)) > file_size) {
+        utility::LogError("[Hashmap] Truncated hashmap file.");
+    }
+    int64_t value;
+    std::memcpy(&value, data + offset, sizeof(int64_t));
+    offset += sizeof(int64_t);
+    return value;
+}
+
+static void ReadDtypeAndShape(const uint8_t* data,
+                              int64_t file_size,
+                              int64_t& offset,
+                              Dtype& dtype,
+                              SizeVector& element_shape) {
+    auto dtype_code =
+            static_cast<Dtype::DtypeCode>(ReadInt64(data, file_size, offset));
+    int64_t byte_size = ReadInt64(data, file_size, offset);
+    if (offset + kDtypeNameLen > file_size) {
+        utility::LogError("[Hashmap] Truncated hashmap file.");
+    }
+    char name[kDtypeNameLen];
+    std::memcpy(name, data + offset, kDtypeNameLen);
+    name[kDtypeNameLen - 1] = '\0';
+    offset += kDtypeNameLen;
+    dtype = Dtype(dtype_code, byte_size, name);
+
+    int64_t ndims = ReadInt64(data, file_size, offset);
+    element_shape.clear();
+    for (int64_t i = 0; i < ndims; ++i) {
+        element_shape.push_back(ReadInt64(data, file_size, offset));
+    }
+}
+
+/// Map the file into memory when supported, otherwise read it into a CPU
+/// blob. The returned blob owns the mapping.
+static std::shared_ptr<Blob> MapHashmapFile(const std::string& file_name,
+                                            int64_t& file_size) {
+#ifndef _WIN32
+    int fd = open(file_name.c_str(), O_RDONLY);
+    if (fd < 0) {
+        utility::LogError("[Hashmap] Unable to open {}.", file_name);
+    }
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) != 0 || file_stat.st_size == 0) {
+        close(fd);
+        utility::LogError("[Hashmap] Unable to read {}.", file_name);
+    }
+    file_size = static_cast<int64_t>(file_stat.st_size);
+    void* data_ptr = mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data_ptr == MAP_FAILED) {
+        utility::LogError("[Hashmap] Unable to map {}.", file_name);
+    }
+    return std::make_shared<Blob>(
+            Device("CPU:0"), data_ptr,
+            [data_ptr, file_size](void*) { munmap(data_ptr, file_size); });
+#else
+    FILE* fp = utility::filesystem::FOpen(file_name, "rb");
+    if (fp == nullptr) {
+        utility::LogError("[Hashmap] Unable to open {}.", file_name);
+    }
+    fseek(fp, 0, SEEK_END);
+    file_size = static_cast<int64_t>(ftell(fp));
+    fseek(fp, 0, SEEK_SET);
+    auto blob = std::make_shared<Blob>(file_size, Device("CPU:0"));
+    size_t read_size = fread(blob->GetDataPtr(), 1, file_size, fp);
+    fclose(fp);
+    if (static_cast<int64_t>(read_size) != file_size) {
+        utility::LogError("[Hashmap] Unable to read {}.", file_name);
+    }
+    return blob;
+#endif
+}
+
 Hashmap::Hashmap(int64_t init_capacity,
                  const Dtype& dtype_key,
                  const Dtype& dtype_value,
                  const SizeVector& element_shape_key,
                  const SizeVector& element_shape_value,
-                 const Device& device)
+                 const Device& device,
+                 const HashmapBackend& backend)
     : dtype_key_(dtype_key),
       dtype_value_(dtype_value),
       element_shape_key_(element_shape_key),
-      element_shape_value_(element_shape_value) {
+      element_shape_value_(element_shape_value),
+      backend_(backend) {
     if (dtype_key_.GetDtypeCode() == Dtype::DtypeCode::Undefined ||
         dtype_key_.GetDtypeCode() == Dtype::DtypeCode::Undefined) {
         utility::LogError(
@@ -68,13 +191,18 @@ Hashmap::Hashmap(int64_t init_capacity,
             init_capacity,
             dtype_key.ByteSize() * element_shape_key_.NumElements(),
             dtype_value.ByteSize() * element_shape_value_.NumElements(),
-            device);
+            device, backend);
+    device_hashmap_->SetMaxLoadFactor(kDefaultElemsPerBucket);
 }
 
 void Hashmap::Rehash(int64_t buckets) {
     return device_hashmap_->Rehash(buckets);
 }
 
+void Hashmap::Reserve(int64_t capacity) {
+    return device_hashmap_->Reserve(capacity);
+}
+
 void Hashmap::Insert(const Tensor& input_keys,
                      const Tensor& input_values,
                      Tensor& output_addrs,
@@ -145,6 +273,75 @@ void Hashmap::Activate(const Tensor& input_keys,
                               count);
 }
 
+void Hashmap::InsertOrFind(const Tensor& input_keys,
+                           const Tensor& input_values,
+                           Tensor& output_addrs,
+                           Tensor& output_masks) {
+    SizeVector input_key_elem_shape(input_keys.GetShape());
+    input_key_elem_shape.erase(input_key_elem_shape.begin());
+    AssertKeyDtype(input_keys.GetDtype(), input_key_elem_shape);
+
+    SizeVector input_value_elem_shape(input_values.GetShape());
+    input_value_elem_shape.erase(input_value_elem_shape.begin());
+    AssertValueDtype(input_values.GetDtype(), input_value_elem_shape);
+
+    SizeVector shape = input_keys.GetShape();
+    if (shape.size() == 0 || shape[0] == 0) {
+        utility::LogError("[Hashmap]: Invalid key tensor shape");
+    }
+    if (input_keys.GetDevice() != GetDevice()) {
+        utility::LogError(
+                "[Hashmap]: Incompatible key device, expected {}, but got {}",
+                GetDevice().ToString(), input_keys.GetDevice().ToString());
+    }
+
+    SizeVector value_shape = input_values.GetShape();
+    if (value_shape.size() == 0 || value_shape[0] != shape[0]) {
+        utility::LogError("[Hashmap]: Invalid value tensor shape");
+    }
+    if (input_values.GetDevice() != GetDevice()) {
+        utility::LogError(
+                "[Hashmap]: Incompatible value device, expected {}, but got {}",
+                GetDevice().ToString(), input_values.GetDevice().ToString());
+    }
+
+    int64_t count = shape[0];
+    output_addrs = Tensor({count}, Dtype::Int32, GetDevice());
+    output_masks = Tensor({count}, Dtype::Bool, GetDevice());
+
+    device_hashmap_->InsertOrFind(
+            input_keys.GetDataPtr(), input_values.GetDataPtr(),
+            static_cast<addr_t*>(output_addrs.GetDataPtr()),
+            static_cast<bool*>(output_masks.GetDataPtr()), count);
+}
+
+void Hashmap::InsertOrFind(const Tensor& input_keys,
+                           Tensor& output_addrs,
+                           Tensor& output_masks) {
+    SizeVector input_key_elem_shape(input_keys.GetShape());
+    input_key_elem_shape.erase(input_key_elem_shape.begin());
+    AssertKeyDtype(input_keys.GetDtype(), input_key_elem_shape);
+
+    SizeVector shape = input_keys.GetShape();
+    if (shape.size() == 0 || shape[0] == 0) {
+        utility::LogError("[Hashmap]: Invalid key tensor shape");
+    }
+    if (input_keys.GetDevice() != GetDevice()) {
+        utility::LogError(
+                "[Hashmap]: Incompatible device, expected {}, but got {}",
+                GetDevice().ToString(), input_keys.GetDevice().ToString());
+    }
+
+    int64_t count = shape[0];
+    output_addrs = Tensor({count}, Dtype::Int32, GetDevice());
+    output_masks = Tensor({count}, Dtype::Bool, GetDevice());
+
+    device_hashmap_->InsertOrFind(
+            input_keys.GetDataPtr(), nullptr,
+            static_cast<addr_t*>(output_addrs.GetDataPtr()),
+            static_cast<bool*>(output_masks.GetDataPtr()), count);
+}
+
 void Hashmap::Find(const Tensor& input_keys,
                    Tensor& output_addrs,
                    Tensor& output_masks) {
@@ -204,8 +401,13 @@ void Hashmap::GetActiveIndices(Tensor& output_addrs) {
 }
 
 Hashmap Hashmap::Copy(const Device& device) {
+    // The backend is kept when available on the target device.
+    HashmapBackend backend = device.GetType() == Device::DeviceType::CPU
+                                     ? backend_
+                                     : HashmapBackend::Default;
     Hashmap new_hashmap(GetCapacity(), dtype_key_, dtype_value_,
-                        element_shape_key_, element_shape_value_, device);
+                        element_shape_key_, element_shape_value_, device,
+                        backend);
 
     Tensor keys = GetKeyTensor().Copy(device);
     Tensor values = GetValueTensor().Copy(device);
@@ -221,6 +423,115 @@ Hashmap Hashmap::Copy(const Device& device) {
     return new_hashmap;
 }
 
+void Hashmap::Save(const std::string& file_name) {
+    Tensor active_addrs;
+    GetActiveIndices(active_addrs);
+    int64_t count = active_addrs.GetLength();
+
+    // Gather on the hashmap's device, then download in bulk.
+    Tensor keys, values;
+    if (count > 0) {
+        Tensor active_indices = active_addrs.To(Dtype::Int64);
+        keys = GetKeyTensor().IndexGet({active_indices}).Copy(Device("CPU:0"));
+        values = GetValueTensor().IndexGet({active_indices}).Copy(
+                Device("CPU:0"));
+    }
+
+    std::vector<uint8_t> header(kHashmapFileMagic,
+                                kHashmapFileMagic + sizeof(kHashmapFileMagic));
+    WriteInt64(header, kHashmapFileVersion);
+    WriteInt64(header, GetCapacity());
+    WriteInt64(header, count);
+    WriteDtypeAndShape(header, dtype_key_, element_shape_key_);
+    WriteDtypeAndShape(header, dtype_value_, element_shape_value_);
+
+    int64_t keys_offset = AlignOffset(header.size());
+    int64_t keys_byte_size = count * GetKeyBytesize();
+    int64_t values_offset = AlignOffset(keys_offset + keys_byte_size);
+    int64_t values_byte_size = count * GetValueBytesize();
+    header.resize(keys_offset, 0);
+
+    FILE* fp = utility::filesystem::FOpen(file_name, "wb");
+    if (fp == nullptr) {
+        utility::LogError("[Hashmap] Unable to open {} for writing.",
+                          file_name);
+    }
+    bool success = fwrite(header.data(), 1, header.size(), fp) == header.size();
+    if (count > 0) {
+        std::vector<uint8_t> padding(
+                values_offset - keys_offset - keys_byte_size, 0);
+        success = success &&
+                  fwrite(keys.GetDataPtr(), 1, keys_byte_size, fp) ==
+                          size_t(keys_byte_size) &&
+                  fwrite(padding.data(), 1, padding.size(), fp) ==
+                          padding.size() &&
+                  fwrite(values.GetDataPtr(), 1, values_byte_size, fp) ==
+                          size_t(values_byte_size);
+    }
+    fclose(fp);
+    if (!success) {
+        utility::LogError("[Hashmap] Unable to write {}.", file_name);
+    }
+}
+
+Hashmap Hashmap::Load(const std::string& file_name, const Device& device) {
+    int64_t file_size = 0;
+    std::shared_ptr<Blob> blob = MapHashmapFile(file_name, file_size);
+    const uint8_t* data = static_cast<const uint8_t*>(blob->GetDataPtr());
+
+    if (file_size < int64_t(sizeof(kHashmapFileMagic)) ||
+        std::memcmp(data, kHashmapFileMagic, sizeof(kHashmapFileMagic)) != 0) {
+        utility::LogError("[Hashmap] {} is not a hashmap file.", file_name);
+    }
+    int64_t offset = sizeof(kHashmapFileMagic);
+    int64_t version = ReadInt64(data, file_size, offset);
+    if (version != kHashmapFileVersion) {
+        utility::LogError("[Hashmap] Unsupported hashmap file version {}.",
+                          version);
+    }
+    int64_t capacity = ReadInt64(data, file_size, offset);
+    int64_t count = ReadInt64(data, file_size, offset);
+
+    Dtype dtype_key, dtype_value;
+    SizeVector element_shape_key, element_shape_value;
+    ReadDtypeAndShape(data, file_size, offset, dtype_key, element_shape_key);
+    ReadDtypeAndShape(data, file_size, offset, dtype_value,
+                      element_shape_value);
+
+    Hashmap hashmap(std::max(capacity, std::max(count, int64_t(1))), dtype_key,
+                    dtype_value, element_shape_key, element_shape_value,
+                    device);
+    if (count == 0) {
+        return hashmap;
+    }
+
+    int64_t keys_offset = AlignOffset(offset);
+    int64_t values_offset =
+            AlignOffset(keys_offset + count * hashmap.GetKeyBytesize());
+    if (values_offset + count * hashmap.GetValueBytesize() > file_size) {
+        utility::LogError("[Hashmap] Truncated hashmap file.");
+    }
+
+    // Views into the mapped file, sharing its blob.
+    SizeVector key_shape = element_shape_key;
+    key_shape.insert(key_shape.begin(), count);
+    SizeVector value_shape = element_shape_value;
+    value_shape.insert(value_shape.begin(), count);
+    Tensor keys(key_shape, Tensor::DefaultStrides(key_shape),
+                const_cast<uint8_t*>(data) + keys_offset, dtype_key, blob);
+    Tensor values(value_shape, Tensor::DefaultStrides(value_shape),
+                  const_cast<uint8_t*>(data) + values_offset, dtype_value,
+                  blob);
+
+    Tensor addrs, masks;
+    if (device.GetType() == Device::DeviceType::CPU) {
+        hashmap.Insert(keys, values, addrs, masks);
+    } else {
+        hashmap.Insert(keys.Copy(device), values.Copy(device), addrs, masks);
+    }
+    return hashmap;
+}
+
 Hashmap Hashmap::CPU() {
     if (GetDevice().GetType() == Device::DeviceType::CPU) {
         return *this;
@@ -279,6 +590,19 @@ std::vector<int64_t> Hashmap::BucketSizes() const {
 /// Return size / bucket_count.
 float Hashmap::LoadFactor() const { return device_hashmap_->LoadFactor(); }
 
+void Hashmap::SetMaxLoadFactor(float max_load_factor) {
+    if (max_load_factor <= 0) {
+        utility::LogError(
+                "[Hashmap] Max load factor must be positive, but got {}",
+                max_load_factor);
+    }
+    device_hashmap_->SetMaxLoadFactor(max_load_factor);
+}
+
+float Hashmap::GetMaxLoadFactor() const {
+    return device_hashmap_->GetMaxLoadFactor();
+}
+
 void Hashmap::AssertKeyDtype(const Dtype& dtype_key,
                              const SizeVector& element_shape_key) const {
     int64_t elem_byte_size =
@@ -24,6 +24,10 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#pragma once
+
+#include <string>
+
 #include "open3d/core/Dtype.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/core/hashmap/HashmapBuffer.h"
@@ -32,16 +36,19 @@ namespace open3d {
 namespace core {
 
 // Forward declaration of device-dependent classes
-class DefaultHash;
-class DefaultKeyEq;
+class DeviceHashmapBase;
+typedef DeviceHashmapBase DefaultDeviceHashmap;
 
-template <typename Hash, typename KeyEq>
-class DeviceHashmap;
-typedef DeviceHashmap<DefaultHash, DefaultKeyEq> DefaultDeviceHashmap;
+/// Hashmap backends.
+/// - Default: TBB concurrent unordered map on CPU, slab hash on CUDA.
+/// - LinearProbing: lock-free open addressing with linear probing on a flat
+///   slot array (CPU only), which scales better with many threads.
+enum class HashmapBackend { Default, LinearProbing };
 
 class Hashmap {
 public:
     static constexpr int64_t kDefaultElemsPerBucket = 4;
+    static constexpr int64_t kFileAlignment = 64;
 
     /// Constructor for primitive and custom types, supporting element shapes.
     /// Example 1:
@@ -62,17 +69,22 @@ public:
             const Dtype& dtype_value,
             const SizeVector& element_shape_key,
             const SizeVector& element_shape_value,
-            const Device& device);
+            const Device& device,
+            const HashmapBackend& backend = HashmapBackend::Default);
 
     ~Hashmap(){};
 
-    /// Rehash expects extra memory space at runtime, since it consists of
-    /// 1) dumping all key value pairs to a buffer
-    /// 2) deallocate old hash table
-    /// 3) create a new hash table
-    /// 4) parallel insert dumped key value pairs
+    /// Rehash resizes the bucket array to \p buckets, growing the capacity
+    /// proportionally. The key value buffer is extended in place and only the
+    /// bucket index is rebuilt, so existing addresses remain valid.
     void Rehash(int64_t buckets);
 
+    /// Reserve buffer space for at least \p capacity elements, adding buckets
+    /// to stay within the max load factor. Existing addresses remain valid.
+    /// Insert and Activate grow automatically by doubling the capacity, so
+    /// Reserve is only needed to avoid repeated growth for known sizes.
+    void Reserve(int64_t capacity);
+
     /// Parallel insert arrays of keys and values in Tensors.
     /// Return \addrs: internal indices that can be directly used for advanced
     /// indexing in Tensor key/value buffers.
@@ -94,6 +106,26 @@ public:
                   Tensor& output_addrs,
                   Tensor& output_masks);
 
+    /// Parallel insert arrays of keys and values in Tensors, and find the keys
+    /// that already exist, probing each key once.
+    /// Return \addrs: internal indices of all the keys, either newly inserted
+    /// or pre-existing, that can be directly used for advanced indexing in
+    /// Tensor key/value buffers.
+    /// \masks: true for newly inserted keys, false for pre-existing ones.
+    void InsertOrFind(const Tensor& input_keys,
+                      const Tensor& input_values,
+                      Tensor& output_addrs,
+                      Tensor& output_masks);
+
+    /// Parallel activate arrays of keys in Tensor, and find the keys that
+    /// already exist, probing each key once. Same as Activate followed by
+    /// Find, with half the hashing traffic.
+    /// Return \addrs: internal indices of all the keys.
+    /// \masks: true for newly activated keys, false for pre-existing ones.
+    void InsertOrFind(const Tensor& input_keys,
+                      Tensor& output_addrs,
+                      Tensor& output_masks);
+
     /// Parallel find an array of keys in Tensor.
     /// Return \addrs: internal indices that can be directly used for advanced
     /// indexing in Tensor key/value buffers.
@@ -118,8 +150,21 @@ public:
     Hashmap CPU();
     Hashmap CUDA(int device_id = 0);
 
+    /// Save the active keys and values to \p file_name in a compact binary
+    /// format: a header with the dtypes, element shapes, capacity and size,
+    /// followed by the contiguous key and value arrays, each aligned to
+    /// kFileAlignment bytes.
+    void Save(const std::string& file_name);
+
+    /// Load a hashmap written by Save() onto \p device. On CPU the file is
+    /// memory-mapped where supported and inserted directly from the mapping;
+    /// on CUDA the keys and values are uploaded in bulk before insertion.
+    static Hashmap Load(const std::string& file_name,
+                        const Device& device = Device("CPU:0"));
+
     int64_t Size() const;
 
+    HashmapBackend GetBackend() const { return backend_; }
     int64_t GetCapacity() const;
     int64_t GetBucketCount() const;
     Device GetDevice() const;
@@ -139,6 +184,11 @@ public:
     /// Return size / bucket_count.
     float LoadFactor() const;
 
+    /// Max size / bucket_count before buckets are added during growth.
+    /// Defaults to kDefaultElemsPerBucket.
+    void SetMaxLoadFactor(float max_load_factor);
+    float GetMaxLoadFactor() const;
+
 protected:
     void AssertKeyDtype(const Dtype& dtype_key,
                         const SizeVector& elem_shape) const;
@@ -156,6 +206,8 @@ private:
 
     SizeVector element_shape_key_;
     SizeVector element_shape_value_;
+
+    HashmapBackend backend_;
 };
 
 }  // namespace core
@@ -78,6 +78,49 @@ public:
         heap_ = Tensor({capacity_}, Dtype::Int32, device_);
     }
 
+    /// Grow the buffer to \p new_capacity in place of a full rehash. Active
+    /// key/value pairs are moved with one bulk copy per buffer and keep their
+    /// addresses, while the newly added slots are appended to the free part
+    /// of the heap. The heap counter and the zero-initialization of fresh
+    /// values are handled by the device contexts. Shrinking is not supported.
+    void Extend(int64_t new_capacity) {
+        if (new_capacity <= capacity_) {
+            return;
+        }
+
+        Tensor new_key_buffer(
+                {new_capacity},
+                Dtype(Dtype::DtypeCode::Object, dsize_key_, "_hash_k"),
+                device_);
+        Tensor new_value_buffer(
+                {new_capacity},
+                Dtype(Dtype::DtypeCode::Object, dsize_value_, "_hash_v"),
+                device_);
+        Tensor new_heap({new_capacity}, Dtype::Int32, device_);
+
+        MemoryManager::Memcpy(new_key_buffer.GetDataPtr(), device_,
+                              key_buffer_.GetDataPtr(), device_,
+                              capacity_ * dsize_key_);
+        MemoryManager::Memcpy(new_value_buffer.GetDataPtr(), device_,
+                              value_buffer_.GetDataPtr(), device_,
+                              capacity_ * dsize_value_);
+        MemoryManager::Memcpy(new_heap.GetDataPtr(), device_,
+                              heap_.GetDataPtr(), device_,
+                              capacity_ * sizeof(addr_t));
+
+        // Addresses of the fresh slots are appended to the heap.
+        new_heap.Slice(0, capacity_, new_capacity).AsRvalue() =
+                Tensor::Arange(capacity_, new_capacity, 1, Dtype::Int32,
+                               device_);
+
+        capacity_ = new_capacity;
+        key_buffer_ = new_key_buffer;
+        value_buffer_ = new_value_buffer;
+        heap_ = new_heap;
+    }
+
+    int64_t GetCapacity() const { return capacity_; }
+
     Tensor &GetKeyBuffer() { return key_buffer_; }
     Tensor &GetValueBuffer() { return value_buffer_; }
     Tensor &GetHeap() { return heap_; }
@@ -28,6 +28,7 @@
 
 #include <vector>
 
+#include "open3d/core/CUDAUtils.h"
 #include "open3d/core/ShapeUtil.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/utility/Console.h"
@@ -68,11 +69,13 @@ void BinaryEW(const Tensor& lhs,
                 broadcasted_input_shape, dst.GetShape());
     }
 
+    OPEN3D_TRACE_SCOPE("core::BinaryEW");
     Device::DeviceType device_type = lhs.GetDevice().GetType();
     if (device_type == Device::DeviceType::CPU) {
         BinaryEWCPU(lhs, rhs, dst, op_code);
     } else if (device_type == Device::DeviceType::CUDA) {
 #ifdef BUILD_CUDA_MODULE
+        OPEN3D_TRACE_CUDA_SCOPE("core::BinaryEW");
         BinaryEWCUDA(lhs, rhs, dst, op_code);
 #else
         utility::LogError("Not compiled with CUDA, but CUDA device is used.");
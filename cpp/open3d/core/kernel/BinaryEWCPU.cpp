@@ -31,6 +31,7 @@
 #include "open3d/core/Tensor.h"
 #include "open3d/core/kernel/BinaryEW.h"
 #include "open3d/core/kernel/CPULauncher.h"
+#include "open3d/core/kernel/CPUVectorized.h"
 #include "open3d/utility/Console.h"
 
 namespace open3d {
@@ -176,12 +177,16 @@ void BinaryEWCPU(const Tensor& lhs,
                  const Tensor& rhs,
                  Tensor& dst,
                  BinaryEWOpCode op_code) {
+    if (TryBinaryEWContiguousCPU(lhs, rhs, dst, op_code)) {
+        return;
+    }
+
     Dtype src_dtype = lhs.GetDtype();
     Dtype dst_dtype = dst.GetDtype();
 
     if (s_boolean_binary_ew_op_codes.find(op_code) !=
         s_boolean_binary_ew_op_codes.end()) {
-        DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src_dtype, [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_FLOAT16(src_dtype, [&]() {
             if (dst_dtype == src_dtype) {
                 // Inplace boolean op's output type is the same as the
                 // input. e.g. np.logical_and(a, b, out=a), where a, b are
@@ -203,7 +208,7 @@ void BinaryEWCPU(const Tensor& lhs,
         });
     } else {
         Indexer indexer({lhs, rhs}, dst, DtypePolicy::ALL_SAME);
-        DISPATCH_DTYPE_TO_TEMPLATE(src_dtype, [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_FLOAT16(src_dtype, [&]() {
             switch (op_code) {
                 case BinaryEWOpCode::Add:
                     CPULauncher::LaunchBinaryEWKernel(
@@ -34,6 +34,7 @@
 #include "open3d/core/Tensor.h"
 #include "open3d/core/kernel/ParallelUtil.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace core {
@@ -51,17 +52,32 @@ public:
     template <typename func_t>
     static void LaunchIndexFillKernel(const Indexer& indexer,
                                       func_t element_kernel) {
-#pragma omp parallel for schedule(static)
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
         for (int64_t workload_idx = 0; workload_idx < indexer.NumWorkloads();
              ++workload_idx) {
             element_kernel(indexer.GetInputPtr(0, workload_idx), workload_idx);
         }
     }
 
+    /// Contiguous operands without broadcasting skip the per-dimension offset
+    /// math of the Indexer and are indexed linearly.
     template <typename func_t>
     static void LaunchUnaryEWKernel(const Indexer& indexer,
                                     func_t element_kernel) {
-#pragma omp parallel for schedule(static)
+        if (indexer.IsContiguous()) {
+            char* src = static_cast<char*>(indexer.GetInput(0).data_ptr_);
+            char* dst = static_cast<char*>(indexer.GetOutput(0).data_ptr_);
+            const int64_t src_size = indexer.GetInput(0).dtype_byte_size_;
+            const int64_t dst_size = indexer.GetOutput(0).dtype_byte_size_;
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+            for (int64_t workload_idx = 0;
+                 workload_idx < indexer.NumWorkloads(); ++workload_idx) {
+                element_kernel(src + workload_idx * src_size,
+                               dst + workload_idx * dst_size);
+            }
+            return;
+        }
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
         for (int64_t workload_idx = 0; workload_idx < indexer.NumWorkloads();
              ++workload_idx) {
             element_kernel(indexer.GetInputPtr(0, workload_idx),
@@ -69,10 +85,27 @@ public:
         }
     }
 
+    /// Same as LaunchUnaryEWKernel, with two inputs.
     template <typename func_t>
     static void LaunchBinaryEWKernel(const Indexer& indexer,
                                      func_t element_kernel) {
-#pragma omp parallel for schedule(static)
+        if (indexer.IsContiguous()) {
+            char* lhs = static_cast<char*>(indexer.GetInput(0).data_ptr_);
+            char* rhs = static_cast<char*>(indexer.GetInput(1).data_ptr_);
+            char* dst = static_cast<char*>(indexer.GetOutput(0).data_ptr_);
+            const int64_t lhs_size = indexer.GetInput(0).dtype_byte_size_;
+            const int64_t rhs_size = indexer.GetInput(1).dtype_byte_size_;
+            const int64_t dst_size = indexer.GetOutput(0).dtype_byte_size_;
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+            for (int64_t workload_idx = 0;
+                 workload_idx < indexer.NumWorkloads(); ++workload_idx) {
+                element_kernel(lhs + workload_idx * lhs_size,
+                               rhs + workload_idx * rhs_size,
+                               dst + workload_idx * dst_size);
+            }
+            return;
+        }
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
         for (int64_t workload_idx = 0; workload_idx < indexer.NumWorkloads();
              ++workload_idx) {
             element_kernel(indexer.GetInputPtr(0, workload_idx),
@@ -84,7 +117,7 @@ public:
     template <typename func_t>
     static void LaunchAdvancedIndexerKernel(const AdvancedIndexer& indexer,
                                             func_t element_kernel) {
-#pragma omp parallel for schedule(static)
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
         for (int64_t workload_idx = 0; workload_idx < indexer.NumWorkloads();
              ++workload_idx) {
             element_kernel(indexer.GetInputPtr(workload_idx),
@@ -119,7 +152,7 @@ public:
                 (num_workloads + num_threads - 1) / num_threads;
         std::vector<scalar_t> thread_results(num_threads, identity);
 
-#pragma omp parallel for schedule(static)
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
         for (int64_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
             int64_t start = thread_idx * workload_per_thread;
             int64_t end = std::min(start + workload_per_thread, num_workloads);
@@ -163,7 +196,7 @@ public:
                     "LaunchReductionKernelTwoPass instead.");
         }
 
-#pragma omp parallel for schedule(static)
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
         for (int64_t i = 0; i < indexer_shape[best_dim]; ++i) {
             Indexer sub_indexer(indexer);
             sub_indexer.ShrinkDim(best_dim, i, 1);
@@ -172,12 +205,16 @@ public:
     }
 
     /// General kernels with non-conventional indexers
+    ///
+    /// \param schedule Scheduling of the workloads. Kernels with irregular
+    /// per-workload cost should use ParallelSchedule::WorkStealing() or
+    /// ParallelSchedule::Dynamic().
     template <typename func_t>
-    static void LaunchGeneralKernel(int64_t n, func_t element_kernel) {
-#pragma omp parallel for schedule(static)
-        for (int64_t workload_idx = 0; workload_idx < n; ++workload_idx) {
-            element_kernel(workload_idx);
-        }
+    static void LaunchGeneralKernel(
+            int64_t n,
+            func_t element_kernel,
+            const ParallelSchedule& schedule = ParallelSchedule()) {
+        ParallelFor(n, element_kernel, schedule);
     }
 };
 
@@ -0,0 +1,416 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/kernel/CPUVectorized.h"
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+#include <algorithm>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "open3d/core/Dtype.h"
+#include "open3d/core/kernel/CPUVectorizedKernels.h"
+#include "open3d/core/kernel/ParallelUtil.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/Helper.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+using namespace vectorized;
+
+// Number of elements processed by one call to a vectorized kernel.
+static constexpr int64_t kChunkSize = 32768;
+
+static bool CPUSupports(CPUCapability capability) {
+    if (capability == CPUCapability::Default) {
+        return true;
+    }
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    __builtin_cpu_init();
+    if (capability == CPUCapability::AVX2) {
+        return __builtin_cpu_supports("avx2");
+    }
+    return __builtin_cpu_supports("avx512f") &&
+           __builtin_cpu_supports("avx512dq") &&
+           __builtin_cpu_supports("avx512bw") &&
+           __builtin_cpu_supports("avx512vl");
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    int info[4];
+    __cpuid(info, 1);
+    bool os_xsave = (info[2] & (1 << 27)) != 0;
+    if (!os_xsave) {
+        return false;
+    }
+    // The OS must save the YMM (and ZMM) registers on context switches.
+    uint64_t xcr0 = _xgetbv(0);
+    __cpuidex(info, 7, 0);
+    if (capability == CPUCapability::AVX2) {
+        return (xcr0 & 0x6) == 0x6 && (info[1] & (1 << 5)) != 0;
+    }
+    const int avx512_bits = (1 << 16) | (1 << 17) | (1 << 30) | (1 << 31);
+    return (xcr0 & 0xe6) == 0xe6 && (info[1] & avx512_bits) == avx512_bits;
+#else
+    return false;
+#endif
+}
+
+static const VecKernels& GetKernels(CPUCapability capability) {
+    switch (capability) {
+        case CPUCapability::AVX512:
+            return GetVecKernelsAVX512();
+        case CPUCapability::AVX2:
+            return GetVecKernelsAVX2();
+        default:
+            return GetVecKernelsDefault();
+    }
+}
+
+static CPUCapability DetectCPUCapability() {
+    CPUCapability max_capability = CPUCapability::AVX512;
+    const char* env = std::getenv("OPEN3D_CPU_CAPABILITY");
+    if (env != nullptr) {
+        std::string value = utility::ToLower(env);
+        if (value == "default") {
+            max_capability = CPUCapability::Default;
+        } else if (value == "avx2") {
+            max_capability = CPUCapability::AVX2;
+        } else if (value != "avx512") {
+            utility::LogWarning(
+                    "Unknown OPEN3D_CPU_CAPABILITY \"{}\", expected "
+                    "\"default\", \"avx2\" or \"avx512\".",
+                    value);
+        }
+    }
+    for (CPUCapability capability :
+         {CPUCapability::AVX512, CPUCapability::AVX2}) {
+        if (capability <= max_capability && GetKernels(capability).compiled_ &&
+            CPUSupports(capability)) {
+            return capability;
+        }
+    }
+    return CPUCapability::Default;
+}
+
+CPUCapability GetCPUCapability() {
+    static const CPUCapability capability = DetectCPUCapability();
+    return capability;
+}
+
+static bool ToVecDtype(Dtype dtype, VecDtype* vec_dtype) {
+    if (dtype == Dtype::Float32) {
+        *vec_dtype = VecDtype::Float32;
+    } else if (dtype == Dtype::Float64) {
+        *vec_dtype = VecDtype::Float64;
+    } else if (dtype == Dtype::Int32) {
+        *vec_dtype = VecDtype::Int32;
+    } else if (dtype == Dtype::Int64) {
+        *vec_dtype = VecDtype::Int64;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+static bool ToVecBinaryOp(BinaryEWOpCode op_code, VecBinaryOp* op) {
+    switch (op_code) {
+        case BinaryEWOpCode::Add:
+            *op = VecBinaryOp::Add;
+            return true;
+        case BinaryEWOpCode::Sub:
+            *op = VecBinaryOp::Sub;
+            return true;
+        case BinaryEWOpCode::Mul:
+            *op = VecBinaryOp::Mul;
+            return true;
+        case BinaryEWOpCode::Div:
+            *op = VecBinaryOp::Div;
+            return true;
+        case BinaryEWOpCode::Gt:
+            *op = VecBinaryOp::Gt;
+            return true;
+        case BinaryEWOpCode::Lt:
+            *op = VecBinaryOp::Lt;
+            return true;
+        case BinaryEWOpCode::Ge:
+            *op = VecBinaryOp::Ge;
+            return true;
+        case BinaryEWOpCode::Le:
+            *op = VecBinaryOp::Le;
+            return true;
+        case BinaryEWOpCode::Eq:
+            *op = VecBinaryOp::Eq;
+            return true;
+        case BinaryEWOpCode::Ne:
+            *op = VecBinaryOp::Ne;
+            return true;
+        default:
+            return false;
+    }
+}
+
+/// Calls f(start, end) for chunks of [0, n) in parallel.
+template <typename func_t>
+static void ParallelForChunks(int64_t n, func_t f) {
+    int64_t num_chunks = (n + kChunkSize - 1) / kChunkSize;
+    if (num_chunks <= 1) {
+        f(0, n);
+        return;
+    }
+    ParallelFor(num_chunks, [&](int64_t chunk_idx) {
+        int64_t start = chunk_idx * kChunkSize;
+        f(start, std::min(start + kChunkSize, n));
+    });
+}
+
+bool TryBinaryEWContiguousCPU(const Tensor& lhs,
+                              const Tensor& rhs,
+                              Tensor& dst,
+                              BinaryEWOpCode op_code) {
+    VecBinaryOp op;
+    VecDtype dtype;
+    if (!ToVecBinaryOp(op_code, &op) || lhs.GetDtype() != rhs.GetDtype() ||
+        !ToVecDtype(lhs.GetDtype(), &dtype)) {
+        return false;
+    }
+    bool is_comparison = s_boolean_binary_ew_op_codes.find(op_code) !=
+                         s_boolean_binary_ew_op_codes.end();
+    if (dst.GetDtype() != (is_comparison ? Dtype::Bool : lhs.GetDtype())) {
+        return false;
+    }
+    if (!lhs.IsContiguous() || !rhs.IsContiguous() || !dst.IsContiguous()) {
+        return false;
+    }
+
+    const SizeVector& shape = dst.GetShape();
+    VecBroadcast broadcast;
+    if (lhs.GetShape() == shape && rhs.GetShape() == shape) {
+        broadcast = VecBroadcast::None;
+    } else if (lhs.GetShape() == shape && rhs.NumElements() == 1) {
+        broadcast = VecBroadcast::Rhs;
+    } else if (rhs.GetShape() == shape && lhs.NumElements() == 1) {
+        broadcast = VecBroadcast::Lhs;
+    } else {
+        return false;
+    }
+
+    const VecKernels& kernels = GetKernels(GetCPUCapability());
+    const char* lhs_ptr = static_cast<const char*>(lhs.GetDataPtr());
+    const char* rhs_ptr = static_cast<const char*>(rhs.GetDataPtr());
+    char* dst_ptr = static_cast<char*>(dst.GetDataPtr());
+    int64_t byte_size = lhs.GetDtype().ByteSize();
+    int64_t lhs_stride = broadcast == VecBroadcast::Lhs ? 0 : byte_size;
+    int64_t rhs_stride = broadcast == VecBroadcast::Rhs ? 0 : byte_size;
+    int64_t dst_stride = dst.GetDtype().ByteSize();
+    ParallelForChunks(dst.NumElements(), [&](int64_t start, int64_t end) {
+        kernels.binary_ew_(op, dtype, lhs_ptr + start * lhs_stride,
+                           rhs_ptr + start * rhs_stride,
+                           dst_ptr + start * dst_stride, end - start,
+                           broadcast);
+    });
+    return true;
+}
+
+bool TryUnaryEWContiguousCPU(const Tensor& src,
+                             Tensor& dst,
+                             UnaryEWOpCode op_code) {
+    VecUnaryOp op;
+    VecDtype dtype;
+    if (!ToVecDtype(src.GetDtype(), &dtype) ||
+        dst.GetDtype() != src.GetDtype()) {
+        return false;
+    }
+    switch (op_code) {
+        case UnaryEWOpCode::Neg:
+            op = VecUnaryOp::Neg;
+            break;
+        case UnaryEWOpCode::Abs:
+            op = VecUnaryOp::Abs;
+            break;
+        case UnaryEWOpCode::Sqrt:
+            // Integer Sqrt raises an error in the generic kernel.
+            if (dtype != VecDtype::Float32 && dtype != VecDtype::Float64) {
+                return false;
+            }
+            op = VecUnaryOp::Sqrt;
+            break;
+        default:
+            return false;
+    }
+    if (!src.IsContiguous() || !dst.IsContiguous() ||
+        src.GetShape() != dst.GetShape()) {
+        return false;
+    }
+
+    const VecKernels& kernels = GetKernels(GetCPUCapability());
+    const char* src_ptr = static_cast<const char*>(src.GetDataPtr());
+    char* dst_ptr = static_cast<char*>(dst.GetDataPtr());
+    int64_t stride = src.GetDtype().ByteSize();
+    ParallelForChunks(src.NumElements(), [&](int64_t start, int64_t end) {
+        kernels.unary_ew_(op, dtype, src_ptr + start * stride,
+                          dst_ptr + start * stride, end - start);
+    });
+    return true;
+}
+
+/// Reduces chunks of src in parallel and combines their results in order.
+template <typename scalar_t>
+static void ReductionChunks(const VecKernels& kernels,
+                            VecReductionOp op,
+                            VecDtype dtype,
+                            const scalar_t* src,
+                            int64_t n,
+                            scalar_t* result,
+                            int64_t* result_idx) {
+    int64_t num_chunks = (n + kChunkSize - 1) / kChunkSize;
+    std::vector<scalar_t> results(num_chunks);
+    std::vector<int64_t> result_indices(num_chunks, 0);
+    ParallelForChunks(n, [&](int64_t start, int64_t end) {
+        int64_t chunk_idx = start / kChunkSize;
+        kernels.reduction_(op, dtype, src + start, end - start,
+                           &results[chunk_idx], &result_indices[chunk_idx]);
+        result_indices[chunk_idx] += start;
+    });
+
+    scalar_t acc = results[0];
+    int64_t acc_idx = result_indices[0];
+    for (int64_t i = 1; i < num_chunks; ++i) {
+        const scalar_t& val = results[i];
+        switch (op) {
+            case VecReductionOp::Sum:
+                acc += val;
+                break;
+            case VecReductionOp::Min:
+                acc = val < acc ? val : acc;
+                break;
+            case VecReductionOp::Max:
+                acc = val > acc ? val : acc;
+                break;
+            // Strict comparisons keep the first extremum.
+            case VecReductionOp::ArgMin:
+                if (val < acc) {
+                    acc = val;
+                    acc_idx = result_indices[i];
+                }
+                break;
+            case VecReductionOp::ArgMax:
+                if (val > acc) {
+                    acc = val;
+                    acc_idx = result_indices[i];
+                }
+                break;
+        }
+    }
+    *result = acc;
+    *result_idx = acc_idx;
+}
+
+/// Runs ReductionChunks and writes the value, or the index for ArgMin and
+/// ArgMax, to dst_ptr.
+template <typename scalar_t>
+static void ReductionToDst(const VecKernels& kernels,
+                           VecReductionOp op,
+                           VecDtype dtype,
+                           const void* src_ptr,
+                           int64_t n,
+                           void* dst_ptr) {
+    scalar_t result;
+    int64_t result_idx;
+    ReductionChunks(kernels, op, dtype, static_cast<const scalar_t*>(src_ptr),
+                    n, &result, &result_idx);
+    if (op == VecReductionOp::ArgMin || op == VecReductionOp::ArgMax) {
+        *static_cast<int64_t*>(dst_ptr) = result_idx;
+    } else {
+        *static_cast<scalar_t*>(dst_ptr) = result;
+    }
+}
+
+bool TryReductionContiguousCPU(const Tensor& src,
+                               Tensor& dst,
+                               const SizeVector& dims,
+                               ReductionOpCode op_code) {
+    VecReductionOp op;
+    VecDtype dtype;
+    if (!ToVecDtype(src.GetDtype(), &dtype)) {
+        return false;
+    }
+    switch (op_code) {
+        case ReductionOpCode::Sum:
+            op = VecReductionOp::Sum;
+            break;
+        case ReductionOpCode::Min:
+            op = VecReductionOp::Min;
+            break;
+        case ReductionOpCode::Max:
+            op = VecReductionOp::Max;
+            break;
+        case ReductionOpCode::ArgMin:
+            op = VecReductionOp::ArgMin;
+            break;
+        case ReductionOpCode::ArgMax:
+            op = VecReductionOp::ArgMax;
+            break;
+        default:
+            return false;
+    }
+    bool is_arg = op == VecReductionOp::ArgMin || op == VecReductionOp::ArgMax;
+    if (dst.GetDtype() != (is_arg ? Dtype::Int64 : src.GetDtype())) {
+        return false;
+    }
+    int64_t n = src.NumElements();
+    if (!src.IsContiguous() || n == 0 || dst.NumElements() != 1 ||
+        static_cast<int64_t>(dims.size()) != src.NumDims()) {
+        return false;
+    }
+
+    const VecKernels& kernels = GetKernels(GetCPUCapability());
+    const void* src_ptr = src.GetDataPtr();
+    void* dst_ptr = dst.GetDataPtr();
+    switch (dtype) {
+        case VecDtype::Float32:
+            ReductionToDst<float>(kernels, op, dtype, src_ptr, n, dst_ptr);
+            break;
+        case VecDtype::Float64:
+            ReductionToDst<double>(kernels, op, dtype, src_ptr, n, dst_ptr);
+            break;
+        case VecDtype::Int32:
+            ReductionToDst<int32_t>(kernels, op, dtype, src_ptr, n, dst_ptr);
+            break;
+        case VecDtype::Int64:
+            ReductionToDst<int64_t>(kernels, op, dtype, src_ptr, n, dst_ptr);
+            break;
+    }
+    return true;
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
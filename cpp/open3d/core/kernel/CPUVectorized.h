@@ -0,0 +1,78 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+/// \file CPUVectorized.h
+///
+/// Fast paths of the CPU element-wise and reduction kernels for contiguous
+/// operands of the same dtype. They skip the per-element offset computation of
+/// Indexer and run loops vectorized for the best instruction set supported by
+/// the CPU, selected at runtime.
+
+#pragma once
+
+#include "open3d/core/SizeVector.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/BinaryEW.h"
+#include "open3d/core/kernel/Reduction.h"
+#include "open3d/core/kernel/UnaryEW.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+enum class CPUCapability { Default, AVX2, AVX512 };
+
+/// Returns the best instruction set supported by both the build and the CPU.
+/// It can be lowered with the environment variable OPEN3D_CPU_CAPABILITY set
+/// to "default", "avx2" or "avx512".
+CPUCapability GetCPUCapability();
+
+/// Computes the op and returns true if lhs, rhs and dst are contiguous and
+/// have the same shape, or if lhs or rhs is a single broadcasted element.
+/// Returns false without side-effect otherwise, and for unsupported ops and
+/// dtypes.
+bool TryBinaryEWContiguousCPU(const Tensor& lhs,
+                              const Tensor& rhs,
+                              Tensor& dst,
+                              BinaryEWOpCode op_code);
+
+/// Computes the op and returns true if src and dst are contiguous. Returns
+/// false without side-effect otherwise, and for unsupported ops and dtypes.
+bool TryUnaryEWContiguousCPU(const Tensor& src,
+                             Tensor& dst,
+                             UnaryEWOpCode op_code);
+
+/// Computes the op and returns true if src is contiguous, non-empty and
+/// reduced over all of its dimensions. Returns false without side-effect
+/// otherwise, and for unsupported ops and dtypes.
+bool TryReductionContiguousCPU(const Tensor& src,
+                               Tensor& dst,
+                               const SizeVector& dims,
+                               ReductionOpCode op_code);
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,387 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+/// \file CPUVectorizedImpl.h
+///
+/// Contiguous CPU loops, included by one translation unit per instruction set.
+/// The including file defines OPEN3D_VEC_KERNELS_GETTER as the name of the
+/// function returning the VecKernels, e.g. GetVecKernelsAVX2. The loops are
+/// written to be vectorized by the compiler for the instruction set enabled in
+/// that translation unit.
+///
+/// Everything but the getter has internal linkage, see CPUVectorizedKernels.h.
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+#include "open3d/core/kernel/CPUVectorizedKernels.h"
+
+#ifndef OPEN3D_VEC_KERNELS_GETTER
+#error "OPEN3D_VEC_KERNELS_GETTER must be defined."
+#endif
+
+#ifdef _MSC_VER
+#define OPEN3D_VEC_PRAGMA(x) __pragma(x)
+#else
+#define OPEN3D_VEC_PRAGMA(x) _Pragma(#x)
+#endif
+
+// OpenMP 4.0 simd loops allow reordering floating point reductions.
+#if defined(_OPENMP) && _OPENMP >= 201307
+#define OPEN3D_VEC_SIMD OPEN3D_VEC_PRAGMA(omp simd)
+#define OPEN3D_VEC_SIMD_REDUCTION(op, var) \
+    OPEN3D_VEC_PRAGMA(omp simd reduction(op : var))
+#else
+#define OPEN3D_VEC_SIMD
+#define OPEN3D_VEC_SIMD_REDUCTION(op, var)
+#endif
+
+namespace open3d {
+namespace core {
+namespace kernel {
+namespace vectorized {
+namespace {
+
+struct AddOp {
+    template <typename T>
+    static T Apply(T a, T b) {
+        return a + b;
+    }
+};
+struct SubOp {
+    template <typename T>
+    static T Apply(T a, T b) {
+        return a - b;
+    }
+};
+struct MulOp {
+    template <typename T>
+    static T Apply(T a, T b) {
+        return a * b;
+    }
+};
+struct DivOp {
+    template <typename T>
+    static T Apply(T a, T b) {
+        return a / b;
+    }
+};
+struct GtOp {
+    template <typename T>
+    static bool Apply(T a, T b) {
+        return a > b;
+    }
+};
+struct LtOp {
+    template <typename T>
+    static bool Apply(T a, T b) {
+        return a < b;
+    }
+};
+struct GeOp {
+    template <typename T>
+    static bool Apply(T a, T b) {
+        return a >= b;
+    }
+};
+struct LeOp {
+    template <typename T>
+    static bool Apply(T a, T b) {
+        return a <= b;
+    }
+};
+struct EqOp {
+    template <typename T>
+    static bool Apply(T a, T b) {
+        return a == b;
+    }
+};
+struct NeOp {
+    template <typename T>
+    static bool Apply(T a, T b) {
+        return a != b;
+    }
+};
+
+template <typename op_t, typename scalar_t, typename dst_t>
+void BinaryLoop(const scalar_t* lhs,
+                const scalar_t* rhs,
+                dst_t* dst,
+                int64_t n,
+                VecBroadcast broadcast) {
+    if (broadcast == VecBroadcast::Lhs) {
+        const scalar_t lhs_val = lhs[0];
+        OPEN3D_VEC_SIMD
+        for (int64_t i = 0; i < n; ++i) {
+            dst[i] = op_t::Apply(lhs_val, rhs[i]);
+        }
+    } else if (broadcast == VecBroadcast::Rhs) {
+        const scalar_t rhs_val = rhs[0];
+        OPEN3D_VEC_SIMD
+        for (int64_t i = 0; i < n; ++i) {
+            dst[i] = op_t::Apply(lhs[i], rhs_val);
+        }
+    } else {
+        OPEN3D_VEC_SIMD
+        for (int64_t i = 0; i < n; ++i) {
+            dst[i] = op_t::Apply(lhs[i], rhs[i]);
+        }
+    }
+}
+
+template <typename scalar_t>
+void BinaryEWTyped(VecBinaryOp op,
+                   const void* lhs,
+                   const void* rhs,
+                   void* dst,
+                   int64_t n,
+                   VecBroadcast broadcast) {
+    const scalar_t* lhs_ptr = static_cast<const scalar_t*>(lhs);
+    const scalar_t* rhs_ptr = static_cast<const scalar_t*>(rhs);
+    scalar_t* dst_ptr = static_cast<scalar_t*>(dst);
+    bool* dst_bool_ptr = static_cast<bool*>(dst);
+    switch (op) {
+        case VecBinaryOp::Add:
+            BinaryLoop<AddOp>(lhs_ptr, rhs_ptr, dst_ptr, n, broadcast);
+            break;
+        case VecBinaryOp::Sub:
+            BinaryLoop<SubOp>(lhs_ptr, rhs_ptr, dst_ptr, n, broadcast);
+            break;
+        case VecBinaryOp::Mul:
+            BinaryLoop<MulOp>(lhs_ptr, rhs_ptr, dst_ptr, n, broadcast);
+            break;
+        case VecBinaryOp::Div:
+            BinaryLoop<DivOp>(lhs_ptr, rhs_ptr, dst_ptr, n, broadcast);
+            break;
+        case VecBinaryOp::Gt:
+            BinaryLoop<GtOp>(lhs_ptr, rhs_ptr, dst_bool_ptr, n, broadcast);
+            break;
+        case VecBinaryOp::Lt:
+            BinaryLoop<LtOp>(lhs_ptr, rhs_ptr, dst_bool_ptr, n, broadcast);
+            break;
+        case VecBinaryOp::Ge:
+            BinaryLoop<GeOp>(lhs_ptr, rhs_ptr, dst_bool_ptr, n, broadcast);
+            break;
+        case VecBinaryOp::Le:
+            BinaryLoop<LeOp>(lhs_ptr, rhs_ptr, dst_bool_ptr, n, broadcast);
+            break;
+        case VecBinaryOp::Eq:
+            BinaryLoop<EqOp>(lhs_ptr, rhs_ptr, dst_bool_ptr, n, broadcast);
+            break;
+        case VecBinaryOp::Ne:
+            BinaryLoop<NeOp>(lhs_ptr, rhs_ptr, dst_bool_ptr, n, broadcast);
+            break;
+    }
+}
+
+void BinaryEW(VecBinaryOp op,
+              VecDtype dtype,
+              const void* lhs,
+              const void* rhs,
+              void* dst,
+              int64_t n,
+              VecBroadcast broadcast) {
+    switch (dtype) {
+        case VecDtype::Float32:
+            BinaryEWTyped<float>(op, lhs, rhs, dst, n, broadcast);
+            break;
+        case VecDtype::Float64:
+            BinaryEWTyped<double>(op, lhs, rhs, dst, n, broadcast);
+            break;
+        case VecDtype::Int32:
+            BinaryEWTyped<int32_t>(op, lhs, rhs, dst, n, broadcast);
+            break;
+        case VecDtype::Int64:
+            BinaryEWTyped<int64_t>(op, lhs, rhs, dst, n, broadcast);
+            break;
+    }
+}
+
+inline float AbsValue(float a) { return std::fabs(a); }
+inline double AbsValue(double a) { return std::fabs(a); }
+inline int32_t AbsValue(int32_t a) { return a < 0 ? -a : a; }
+inline int64_t AbsValue(int64_t a) { return a < 0 ? -a : a; }
+
+template <typename scalar_t>
+void UnaryEWTyped(VecUnaryOp op, const void* src, void* dst, int64_t n) {
+    const scalar_t* src_ptr = static_cast<const scalar_t*>(src);
+    scalar_t* dst_ptr = static_cast<scalar_t*>(dst);
+    switch (op) {
+        case VecUnaryOp::Neg:
+            OPEN3D_VEC_SIMD
+            for (int64_t i = 0; i < n; ++i) {
+                dst_ptr[i] = -src_ptr[i];
+            }
+            break;
+        case VecUnaryOp::Abs:
+            OPEN3D_VEC_SIMD
+            for (int64_t i = 0; i < n; ++i) {
+                dst_ptr[i] = AbsValue(src_ptr[i]);
+            }
+            break;
+        case VecUnaryOp::Sqrt:
+            OPEN3D_VEC_SIMD
+            for (int64_t i = 0; i < n; ++i) {
+                dst_ptr[i] = static_cast<scalar_t>(std::sqrt(src_ptr[i]));
+            }
+            break;
+    }
+}
+
+void UnaryEW(VecUnaryOp op,
+             VecDtype dtype,
+             const void* src,
+             void* dst,
+             int64_t n) {
+    switch (dtype) {
+        case VecDtype::Float32:
+            UnaryEWTyped<float>(op, src, dst, n);
+            break;
+        case VecDtype::Float64:
+            UnaryEWTyped<double>(op, src, dst, n);
+            break;
+        case VecDtype::Int32:
+            UnaryEWTyped<int32_t>(op, src, dst, n);
+            break;
+        case VecDtype::Int64:
+            UnaryEWTyped<int64_t>(op, src, dst, n);
+            break;
+    }
+}
+
+template <typename scalar_t>
+scalar_t MinLoop(const scalar_t* src, int64_t n) {
+    scalar_t acc = src[0];
+    OPEN3D_VEC_SIMD_REDUCTION(min, acc)
+    for (int64_t i = 0; i < n; ++i) {
+        acc = src[i] < acc ? src[i] : acc;
+    }
+    return acc;
+}
+
+template <typename scalar_t>
+scalar_t MaxLoop(const scalar_t* src, int64_t n) {
+    scalar_t acc = src[0];
+    OPEN3D_VEC_SIMD_REDUCTION(max, acc)
+    for (int64_t i = 0; i < n; ++i) {
+        acc = src[i] > acc ? src[i] : acc;
+    }
+    return acc;
+}
+
+/// Returns the index of the first element equal to the extremum found by the
+/// vectorized loop. Falls back to a serial scan with the same semantics as
+/// the generic CPU kernel if there is none, e.g. if the extremum is NaN.
+template <typename scalar_t, bool is_min>
+int64_t ArgExtremum(const scalar_t* src, int64_t n) {
+    scalar_t extremum = is_min ? MinLoop(src, n) : MaxLoop(src, n);
+    for (int64_t i = 0; i < n; ++i) {
+        if (src[i] == extremum) {
+            return i;
+        }
+    }
+    int64_t best_idx = 0;
+    scalar_t best = is_min ? std::numeric_limits<scalar_t>::max()
+                           : std::numeric_limits<scalar_t>::lowest();
+    for (int64_t i = 0; i < n; ++i) {
+        if (is_min ? src[i] < best : src[i] > best) {
+            best = src[i];
+            best_idx = i;
+        }
+    }
+    return best_idx;
+}
+
+template <typename scalar_t>
+void ReductionTyped(VecReductionOp op,
+                    const void* src,
+                    int64_t n,
+                    void* result,
+                    int64_t* result_idx) {
+    const scalar_t* src_ptr = static_cast<const scalar_t*>(src);
+    scalar_t* result_ptr = static_cast<scalar_t*>(result);
+    switch (op) {
+        case VecReductionOp::Sum: {
+            scalar_t acc = 0;
+            OPEN3D_VEC_SIMD_REDUCTION(+, acc)
+            for (int64_t i = 0; i < n; ++i) {
+                acc += src_ptr[i];
+            }
+            *result_ptr = acc;
+            break;
+        }
+        case VecReductionOp::Min:
+            *result_ptr = MinLoop(src_ptr, n);
+            break;
+        case VecReductionOp::Max:
+            *result_ptr = MaxLoop(src_ptr, n);
+            break;
+        case VecReductionOp::ArgMin:
+            *result_idx = ArgExtremum<scalar_t, true>(src_ptr, n);
+            *result_ptr = src_ptr[*result_idx];
+            break;
+        case VecReductionOp::ArgMax:
+            *result_idx = ArgExtremum<scalar_t, false>(src_ptr, n);
+            *result_ptr = src_ptr[*result_idx];
+            break;
+    }
+}
+
+void Reduction(VecReductionOp op,
+               VecDtype dtype,
+               const void* src,
+               int64_t n,
+               void* result,
+               int64_t* result_idx) {
+    switch (dtype) {
+        case VecDtype::Float32:
+            ReductionTyped<float>(op, src, n, result, result_idx);
+            break;
+        case VecDtype::Float64:
+            ReductionTyped<double>(op, src, n, result, result_idx);
+            break;
+        case VecDtype::Int32:
+            ReductionTyped<int32_t>(op, src, n, result, result_idx);
+            break;
+        case VecDtype::Int64:
+            ReductionTyped<int64_t>(op, src, n, result, result_idx);
+            break;
+    }
+}
+
+}  // namespace
+
+const VecKernels& OPEN3D_VEC_KERNELS_GETTER() {
+    static const VecKernels kernels{BinaryEW, UnaryEW, Reduction,
+                                    OPEN3D_VEC_KERNELS_COMPILED};
+    return kernels;
+}
+
+}  // namespace vectorized
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
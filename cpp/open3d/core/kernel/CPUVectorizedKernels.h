@@ -0,0 +1,92 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+/// \file CPUVectorizedKernels.h
+///
+/// Interface of the contiguous CPU loops, which are compiled once per
+/// instruction set (CPUVectorizedDefault.cpp, CPUVectorizedAVX2.cpp and
+/// CPUVectorizedAVX512.cpp) and selected at runtime by CPUVectorized.cpp.
+///
+/// The instruction-set specific translation units must not instantiate code
+/// with external linkage: the linker could pick their AVX version for callers
+/// running on CPUs without AVX. Hence this header only uses plain types.
+
+#pragma once
+
+#include <cstdint>
+
+namespace open3d {
+namespace core {
+namespace kernel {
+namespace vectorized {
+
+enum class VecDtype { Float32, Float64, Int32, Int64 };
+
+enum class VecBinaryOp { Add, Sub, Mul, Div, Gt, Lt, Ge, Le, Eq, Ne };
+
+enum class VecUnaryOp { Neg, Abs, Sqrt };
+
+enum class VecReductionOp { Sum, Min, Max, ArgMin, ArgMax };
+
+/// The operand holding a single element, which is broadcasted to all others.
+enum class VecBroadcast { None, Lhs, Rhs };
+
+struct VecKernels {
+    /// dst[i] = lhs[i] op rhs[i] for i in [0, n). Comparisons write bool.
+    void (*binary_ew_)(VecBinaryOp op,
+                       VecDtype dtype,
+                       const void* lhs,
+                       const void* rhs,
+                       void* dst,
+                       int64_t n,
+                       VecBroadcast broadcast);
+    /// dst[i] = op(src[i]) for i in [0, n).
+    void (*unary_ew_)(VecUnaryOp op,
+                      VecDtype dtype,
+                      const void* src,
+                      void* dst,
+                      int64_t n);
+    /// Reduces src[0, n), n > 0, to *result. ArgMin and ArgMax also write the
+    /// index of the first extremum to *result_idx.
+    void (*reduction_)(VecReductionOp op,
+                       VecDtype dtype,
+                       const void* src,
+                       int64_t n,
+                       void* result,
+                       int64_t* result_idx);
+    /// True if the translation unit has been compiled for its instruction
+    /// set, i.e. the compiler and target architecture support it.
+    bool compiled_;
+};
+
+const VecKernels& GetVecKernelsDefault();
+const VecKernels& GetVecKernelsAVX2();
+const VecKernels& GetVecKernelsAVX512();
+
+}  // namespace vectorized
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -34,12 +34,16 @@
 #include "open3d/core/Indexer.h"
 #include "open3d/core/SizeVector.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/ParallelUtil.h"
 
 // CUDA kernel launcher's goal is to separate scheduling (looping through each
 // valid element) and computation (operations performed on each element).
 //
 // The kernel launch mechanism is inspired by PyTorch's launch Loops.cuh.
 // See: https://tinyurl.com/y4lak257
+//
+// Kernels are launched on the current CUDA stream of the calling thread, see
+// CUDAScopedStream.
 
 static constexpr int64_t default_block_size = 128;
 static constexpr int64_t default_thread_size = 4;
@@ -50,10 +54,15 @@ namespace kernel {
 
 // Applies f for each element
 // Works for unary / binary elementwise operations
-template <int64_t block_size, int64_t thread_size, typename func_t>
-__global__ void ElementWiseKernel(int64_t n, func_t f) {
-    int64_t items_per_block = block_size * thread_size;
-    int64_t idx = blockIdx.x * items_per_block + threadIdx.x;
+//
+// index_t is int64_t in general, or uint32_t when all offsets fit in 32 bits.
+template <int64_t block_size,
+          int64_t thread_size,
+          typename index_t,
+          typename func_t>
+__global__ void ElementWiseKernel(index_t n, func_t f) {
+    index_t items_per_block = block_size * thread_size;
+    index_t idx = blockIdx.x * items_per_block + threadIdx.x;
 #pragma unroll
     for (int64_t i = 0; i < thread_size; i++) {
         if (idx < n) {
@@ -63,11 +72,45 @@ __global__ void ElementWiseKernel(int64_t n, func_t f) {
     }
 }
 
+// Returns a 32-bit offset calculator over the inputs followed by the output of
+// an elementwise indexer. OffsetCalculator iterates its first dimension
+// fastest, so the dimensions are reversed.
+template <int NARGS>
+static OffsetCalculator<NARGS, uint32_t> MakeOffsetCalculator(
+        const Indexer& indexer) {
+    const int64_t ndims = indexer.NumDims();
+    int64_t shape[MAX_DIMS];
+    int64_t byte_strides[NARGS][MAX_DIMS];
+    const int64_t* strides[NARGS];
+    for (int64_t dim = 0; dim < ndims; dim++) {
+        int64_t src_dim = ndims - 1 - dim;
+        shape[dim] = indexer.GetMasterShape()[src_dim];
+        for (int arg = 0; arg < NARGS - 1; arg++) {
+            byte_strides[arg][dim] =
+                    indexer.GetInput(arg).byte_strides_[src_dim];
+        }
+        byte_strides[NARGS - 1][dim] =
+                indexer.GetOutput(0).byte_strides_[src_dim];
+    }
+    for (int arg = 0; arg < NARGS; arg++) {
+        strides[arg] = byte_strides[arg];
+    }
+    return OffsetCalculator<NARGS, uint32_t>(static_cast<int>(ndims), shape,
+                                             strides);
+}
+
 class CUDALauncher {
 public:
-    template <typename func_t>
-    static void LaunchUnaryEWKernel(const Indexer& indexer,
-                                    func_t element_kernel) {
+    /// Calls operands_kernel(ptrs) for each workload, where ptrs holds the
+    /// data pointers of the first NARGS - 1 inputs followed by the output.
+    ///
+    /// The indexing is specialized at dispatch. Contiguous operands without
+    /// broadcasting use linear offsets, and operands whose byte offsets fit
+    /// in 31 bits use 32-bit integer math. Only the general case captures the
+    /// full Indexer.
+    template <int NARGS, typename func_t>
+    static void LaunchOperandsKernel(const Indexer& indexer,
+                                     func_t operands_kernel) {
         OPEN3D_ASSERT_HOST_DEVICE_LAMBDA(func_t);
 
         int64_t n = indexer.NumWorkloads();
@@ -76,38 +119,105 @@ public:
         }
         int64_t items_per_block = default_block_size * default_thread_size;
         int64_t grid_size = (n + items_per_block - 1) / items_per_block;
+        cudaStream_t stream = GetCUDACurrentStream();
 
-        auto f = [=] OPEN3D_HOST_DEVICE(int64_t workload_idx) {
-            element_kernel(indexer.GetInputPtr(0, workload_idx),
-                           indexer.GetOutputPtr(workload_idx));
-        };
+        SmallArray<char*, NARGS> data_ptrs;
+        SmallArray<int64_t, NARGS> element_sizes;
+        for (int arg = 0; arg < NARGS - 1; arg++) {
+            const TensorRef& input = indexer.GetInput(arg);
+            data_ptrs[arg] = static_cast<char*>(input.data_ptr_);
+            element_sizes[arg] = input.dtype_byte_size_;
+        }
+        const TensorRef& output = indexer.GetOutput(0);
+        data_ptrs[NARGS - 1] = static_cast<char*>(output.data_ptr_);
+        element_sizes[NARGS - 1] = output.dtype_byte_size_;
 
-        ElementWiseKernel<default_block_size, default_thread_size>
-                <<<grid_size, default_block_size, 0>>>(n, f);
-        OPEN3D_GET_LAST_CUDA_ERROR("LaunchUnaryEWKernel failed.");
+        bool is_contiguous = indexer.IsContiguous();
+        bool use_32bit = indexer.CanUse32BitIndexing();
+        if (is_contiguous && use_32bit) {
+            SmallArray<uint32_t, NARGS> element_sizes_32;
+            for (int arg = 0; arg < NARGS; arg++) {
+                element_sizes_32[arg] =
+                        static_cast<uint32_t>(element_sizes[arg]);
+            }
+            auto f = [=] OPEN3D_HOST_DEVICE(uint32_t workload_idx) {
+                SmallArray<char*, NARGS> ptrs;
+#pragma unroll
+                for (int arg = 0; arg < NARGS; arg++) {
+                    ptrs[arg] = data_ptrs[arg] +
+                                workload_idx * element_sizes_32[arg];
+                }
+                operands_kernel(ptrs);
+            };
+            ElementWiseKernel<default_block_size, default_thread_size>
+                    <<<grid_size, default_block_size, 0, stream>>>(
+                            static_cast<uint32_t>(n), f);
+        } else if (is_contiguous) {
+            auto f = [=] OPEN3D_HOST_DEVICE(int64_t workload_idx) {
+                SmallArray<char*, NARGS> ptrs;
+#pragma unroll
+                for (int arg = 0; arg < NARGS; arg++) {
+                    ptrs[arg] = data_ptrs[arg] +
+                                workload_idx * element_sizes[arg];
+                }
+                operands_kernel(ptrs);
+            };
+            ElementWiseKernel<default_block_size, default_thread_size>
+                    <<<grid_size, default_block_size, 0, stream>>>(n, f);
+        } else if (use_32bit) {
+            OffsetCalculator<NARGS, uint32_t> offset_calculator =
+                    MakeOffsetCalculator<NARGS>(indexer);
+            auto f = [=] OPEN3D_HOST_DEVICE(uint32_t workload_idx) {
+                SmallArray<uint32_t, NARGS> offsets =
+                        offset_calculator.get(workload_idx);
+                SmallArray<char*, NARGS> ptrs;
+#pragma unroll
+                for (int arg = 0; arg < NARGS; arg++) {
+                    ptrs[arg] = data_ptrs[arg] + offsets[arg];
+                }
+                operands_kernel(ptrs);
+            };
+            ElementWiseKernel<default_block_size, default_thread_size>
+                    <<<grid_size, default_block_size, 0, stream>>>(
+                            static_cast<uint32_t>(n), f);
+        } else {
+            auto f = [=] OPEN3D_HOST_DEVICE(int64_t workload_idx) {
+                SmallArray<char*, NARGS> ptrs;
+#pragma unroll
+                for (int arg = 0; arg < NARGS - 1; arg++) {
+                    ptrs[arg] = indexer.GetInputPtr(arg, workload_idx);
+                }
+                ptrs[NARGS - 1] = indexer.GetOutputPtr(workload_idx);
+                operands_kernel(ptrs);
+            };
+            ElementWiseKernel<default_block_size, default_thread_size>
+                    <<<grid_size, default_block_size, 0, stream>>>(n, f);
+        }
+        OPEN3D_GET_LAST_CUDA_ERROR("LaunchOperandsKernel failed.");
     }
 
     template <typename func_t>
-    static void LaunchBinaryEWKernel(const Indexer& indexer,
-                                     func_t element_kernel) {
+    static void LaunchUnaryEWKernel(const Indexer& indexer,
+                                    func_t element_kernel) {
         OPEN3D_ASSERT_HOST_DEVICE_LAMBDA(func_t);
 
-        int64_t n = indexer.NumWorkloads();
-        if (n == 0) {
-            return;
-        }
-        int64_t items_per_block = default_block_size * default_thread_size;
-        int64_t grid_size = (n + items_per_block - 1) / items_per_block;
+        LaunchOperandsKernel<2>(
+                indexer,
+                [=] OPEN3D_HOST_DEVICE(const SmallArray<char*, 2>& ptrs) {
+                    element_kernel(ptrs[0], ptrs[1]);
+                });
+    }
 
-        auto f = [=] OPEN3D_HOST_DEVICE(int64_t workload_idx) {
-            element_kernel(indexer.GetInputPtr(0, workload_idx),
-                           indexer.GetInputPtr(1, workload_idx),
-                           indexer.GetOutputPtr(workload_idx));
-        };
+    template <typename func_t>
+    static void LaunchBinaryEWKernel(const Indexer& indexer,
+                                     func_t element_kernel) {
+        OPEN3D_ASSERT_HOST_DEVICE_LAMBDA(func_t);
 
-        ElementWiseKernel<default_block_size, default_thread_size>
-                <<<grid_size, default_block_size, 0>>>(n, f);
-        OPEN3D_GET_LAST_CUDA_ERROR("LaunchBinaryEWKernel failed.");
+        LaunchOperandsKernel<3>(
+                indexer,
+                [=] OPEN3D_HOST_DEVICE(const SmallArray<char*, 3>& ptrs) {
+                    element_kernel(ptrs[0], ptrs[1], ptrs[2]);
+                });
     }
 
     template <typename func_t>
@@ -128,7 +238,8 @@ public:
         };
 
         ElementWiseKernel<default_block_size, default_thread_size>
-                <<<grid_size, default_block_size, 0>>>(n, f);
+                <<<grid_size, default_block_size, 0, GetCUDACurrentStream()>>>(
+                        n, f);
         OPEN3D_GET_LAST_CUDA_ERROR("LaunchAdvancedIndexerKernel failed.");
     }
 
@@ -144,9 +255,19 @@ public:
         int64_t grid_size = (n + items_per_block - 1) / items_per_block;
 
         ElementWiseKernel<default_block_size, default_thread_size>
-                <<<grid_size, default_block_size, 0>>>(n, element_kernel);
+                <<<grid_size, default_block_size, 0, GetCUDACurrentStream()>>>(
+                        n, element_kernel);
         OPEN3D_GET_LAST_CUDA_ERROR("LaunchGeneralKernel failed.");
     }
+
+    /// Same as LaunchGeneralKernel(n, element_kernel). The CPU schedule is
+    /// accepted for kernels shared with CPULauncher and has no effect.
+    template <typename func_t>
+    static void LaunchGeneralKernel(int64_t n,
+                                    func_t element_kernel,
+                                    const ParallelSchedule& schedule) {
+        LaunchGeneralKernel(n, element_kernel);
+    }
 };
 }  // namespace kernel
 }  // namespace core
@@ -0,0 +1,181 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cmath>
+#include <vector>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Indexer.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/BinaryEW.h"
+#include "open3d/core/kernel/UnaryEW.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+// Maximum number of instructions of a fused elementwise program. The program
+// is passed as a kernel argument together with the Indexer, this keeps the
+// total argument size well below CUDA's 4KB limit.
+static constexpr int64_t MAX_FUSED_EW_INSTRUCTIONS = 24;
+
+// Maximum depth of the per-element evaluation stack.
+static constexpr int64_t MAX_FUSED_EW_STACK_SIZE = 8;
+
+enum class FusedEWInstrType {
+    LoadInput,   // Push the value of input_idx_-th input tensor.
+    LoadScalar,  // Push scalar_ casted to the program's dtype.
+    Unary,       // Pop one value, push unary_op_code_(value).
+    Binary,      // Pop rhs and lhs, push binary_op_code_(lhs, rhs).
+};
+
+struct FusedEWInstr {
+    FusedEWInstrType type_;
+    int64_t input_idx_;
+    double scalar_;
+    UnaryEWOpCode unary_op_code_;
+    BinaryEWOpCode binary_op_code_;
+};
+
+/// A postfix (stack machine) program describing a chain of elementwise
+/// operations. The program is evaluated once per output element, such that
+/// intermediate results never leave registers.
+///
+/// The program is a fixed-size POD, it can be captured by value in CUDA
+/// kernels.
+struct FusedEWProgram {
+    SmallArray<FusedEWInstr, MAX_FUSED_EW_INSTRUCTIONS> instrs_;
+    int64_t num_instrs_ = 0;
+    int64_t max_stack_size_ = 0;
+};
+
+/// Evaluates \p program with all \p inputs broadcasted to the shape of \p dst
+/// in a single kernel launch. All inputs and dst must have the same dtype and
+/// device. Only arithmetic (non-boolean) ops are supported.
+void FusedEW(const std::vector<Tensor>& inputs,
+             const FusedEWProgram& program,
+             Tensor& dst);
+
+void FusedEWCPU(const std::vector<Tensor>& inputs,
+                const FusedEWProgram& program,
+                Tensor& dst);
+
+#ifdef BUILD_CUDA_MODULE
+void FusedEWCUDA(const std::vector<Tensor>& inputs,
+                 const FusedEWProgram& program,
+                 Tensor& dst);
+#endif
+
+/// Evaluates \p program for one workload of \p indexer. Shared by the CPU and
+/// CUDA kernels. Math functions are evaluated in double precision, consistent
+/// with the CUDA unary kernels.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE inline scalar_t EvalFusedEWProgram(
+        const FusedEWProgram& program,
+        const Indexer& indexer,
+        int64_t workload_idx) {
+    scalar_t stack[MAX_FUSED_EW_STACK_SIZE];
+    int64_t top = 0;
+    for (int64_t i = 0; i < program.num_instrs_; ++i) {
+        const FusedEWInstr& instr = program.instrs_.data_[i];
+        switch (instr.type_) {
+            case FusedEWInstrType::LoadInput:
+                stack[top++] = *reinterpret_cast<const scalar_t*>(
+                        indexer.GetInputPtr(instr.input_idx_, workload_idx));
+                break;
+            case FusedEWInstrType::LoadScalar:
+                stack[top++] = static_cast<scalar_t>(instr.scalar_);
+                break;
+            case FusedEWInstrType::Unary: {
+                scalar_t& v = stack[top - 1];
+                double d = static_cast<double>(v);
+                switch (instr.unary_op_code_) {
+                    case UnaryEWOpCode::Sqrt:
+                        v = static_cast<scalar_t>(sqrt(d));
+                        break;
+                    case UnaryEWOpCode::Sin:
+                        v = static_cast<scalar_t>(sin(d));
+                        break;
+                    case UnaryEWOpCode::Cos:
+                        v = static_cast<scalar_t>(cos(d));
+                        break;
+                    case UnaryEWOpCode::Neg:
+                        v = static_cast<scalar_t>(-v);
+                        break;
+                    case UnaryEWOpCode::Exp:
+                        v = static_cast<scalar_t>(exp(d));
+                        break;
+                    case UnaryEWOpCode::Abs:
+                        v = static_cast<scalar_t>(fabs(d));
+                        break;
+                    case UnaryEWOpCode::Floor:
+                        v = static_cast<scalar_t>(floor(d));
+                        break;
+                    case UnaryEWOpCode::Ceil:
+                        v = static_cast<scalar_t>(ceil(d));
+                        break;
+                    case UnaryEWOpCode::Round:
+                        v = static_cast<scalar_t>(round(d));
+                        break;
+                    case UnaryEWOpCode::Trunc:
+                        v = static_cast<scalar_t>(trunc(d));
+                        break;
+                    default:
+                        break;
+                }
+                break;
+            }
+            case FusedEWInstrType::Binary: {
+                scalar_t rhs = stack[--top];
+                scalar_t& lhs = stack[top - 1];
+                switch (instr.binary_op_code_) {
+                    case BinaryEWOpCode::Add:
+                        lhs = lhs + rhs;
+                        break;
+                    case BinaryEWOpCode::Sub:
+                        lhs = lhs - rhs;
+                        break;
+                    case BinaryEWOpCode::Mul:
+                        lhs = lhs * rhs;
+                        break;
+                    case BinaryEWOpCode::Div:
+                        lhs = lhs / rhs;
+                        break;
+                    default:
+                        break;
+                }
+                break;
+            }
+        }
+    }
+    return stack[0];
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,127 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/kernel/FusedReduction.h"
+
+#include <vector>
+
+#include "open3d/core/ShapeUtil.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+void FusedReduction(const Tensor& src,
+                    Tensor& dst0,
+                    Tensor& dst1,
+                    const SizeVector& dims,
+                    bool keepdim,
+                    FusedReductionOpCode op_code) {
+    SizeVector dst_shape =
+            shape_util::ReductionShape(src.GetShape(), dims, keepdim);
+    for (const Tensor* dst : {&dst0, &dst1}) {
+        if (dst->GetShape() != dst_shape) {
+            utility::LogError("Expected output shape {} but got {}.",
+                              dst_shape.ToString(),
+                              dst->GetShape().ToString());
+        }
+        if (dst->GetDtype() != src.GetDtype()) {
+            utility::LogError("Expected output dtype {} but got {}.",
+                              src.GetDtype().ToString(),
+                              dst->GetDtype().ToString());
+        }
+        if (dst->GetDevice() != src.GetDevice()) {
+            utility::LogError("Device mismatch {} != {}.",
+                              src.GetDevice().ToString(),
+                              dst->GetDevice().ToString());
+        }
+    }
+    if (op_code == FusedReductionOpCode::MeanVar &&
+        src.GetDtype() != Dtype::Float32 && src.GetDtype() != Dtype::Float64) {
+        utility::LogError(
+                "MeanVar only supports Float32 and Float64, but {} is used.",
+                src.GetDtype().ToString());
+    }
+
+    // Moves the reduction dimensions to the inner-most positions, such that
+    // each output element reduces a row of the permuted view.
+    int64_t num_dims = src.NumDims();
+    std::vector<bool> is_reduction_dim(num_dims, false);
+    for (int64_t dim : dims) {
+        is_reduction_dim[shape_util::WrapDim(dim, num_dims)] = true;
+    }
+    SizeVector permutation;
+    for (int64_t dim = 0; dim < num_dims; ++dim) {
+        if (!is_reduction_dim[dim]) {
+            permutation.push_back(dim);
+        }
+    }
+    for (int64_t dim = 0; dim < num_dims; ++dim) {
+        if (is_reduction_dim[dim]) {
+            permutation.push_back(dim);
+        }
+    }
+    Tensor src_permuted = src.Permute(permutation);
+
+    int64_t num_outputs = dst0.NumElements();
+    if (num_outputs == 0) {
+        return;
+    }
+    if (src.NumElements() == 0 && op_code == FusedReductionOpCode::MinMax) {
+        utility::LogError("Zero-size Tensor does not suport MinMax.");
+    }
+
+    // The device kernels write to contiguous outputs.
+    Tensor dst0_contiguous = dst0.Contiguous();
+    Tensor dst1_contiguous = dst1.Contiguous();
+
+    Device::DeviceType device_type = src.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        FusedReductionCPU(src_permuted, dst0_contiguous, dst1_contiguous,
+                          op_code);
+    } else if (device_type == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        FusedReductionCUDA(src_permuted, dst0_contiguous, dst1_contiguous,
+                           op_code);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device.");
+    }
+
+    if (!dst0.IsContiguous()) {
+        dst0.AsRvalue() = dst0_contiguous;
+    }
+    if (!dst1.IsContiguous()) {
+        dst1.AsRvalue() = dst1_contiguous;
+    }
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,273 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cmath>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Indexer.h"
+#include "open3d/core/SizeVector.h"
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+enum class FusedReductionOpCode {
+    MinMax,   // dst0 = min, dst1 = max.
+    MeanVar,  // dst0 = mean, dst1 = population variance.
+};
+
+/// Computes two reductions of \p src along \p dims in a single traversal.
+/// dst0 and dst1 have the same dtype as src and the shape
+/// shape_util::ReductionShape(src.GetShape(), dims, keepdim).
+void FusedReduction(const Tensor& src,
+                    Tensor& dst0,
+                    Tensor& dst1,
+                    const SizeVector& dims,
+                    bool keepdim,
+                    FusedReductionOpCode op_code);
+
+/// \p src has been permuted such that the reduction dimensions are the
+/// inner-most ones. dst0 and dst1 are contiguous, with one element per
+/// combination of the outer dimensions of src.
+void FusedReductionCPU(const Tensor& src,
+                       Tensor& dst0,
+                       Tensor& dst1,
+                       FusedReductionOpCode op_code);
+
+#ifdef BUILD_CUDA_MODULE
+void FusedReductionCUDA(const Tensor& src,
+                        Tensor& dst0,
+                        Tensor& dst1,
+                        FusedReductionOpCode op_code);
+#endif
+
+/// Element access of the permuted source of FusedReductionCPU/CUDA as a
+/// [num_rows, row_size] matrix, where each row is reduced to one output.
+struct FusedReductionSrc {
+    FusedReductionSrc(const Tensor& src, int64_t num_rows)
+        : ref_(src),
+          row_size_(num_rows == 0 ? 0 : src.NumElements() / num_rows),
+          inner_size_(src.NumDims() == 0 ? 1 : src.GetShape().back()),
+          inner_byte_stride_(src.NumDims() == 0
+                                     ? 0
+                                     : src.GetStride(src.NumDims() - 1) *
+                                               src.GetDtype().ByteSize()) {}
+
+    template <typename scalar_t>
+    OPEN3D_HOST_DEVICE const scalar_t* GetPtr(int64_t row, int64_t col) const {
+        int64_t idx = row * row_size_ + col;
+        int64_t offset = 0;
+        for (int64_t dim = ref_.ndims_ - 1; dim >= 0; --dim) {
+            offset += (idx % ref_.shape_[dim]) * ref_.byte_strides_[dim];
+            idx /= ref_.shape_[dim];
+        }
+        return reinterpret_cast<const scalar_t*>(
+                static_cast<const char*>(ref_.data_ptr_) + offset);
+    }
+
+    TensorRef ref_;
+    int64_t row_size_;
+    // Size and byte stride of the inner-most dimension. Consecutive columns
+    // within it are one stride apart, which avoids computing the offset of
+    // each element.
+    int64_t inner_size_;
+    int64_t inner_byte_stride_;
+};
+
+/// Running min and max. An empty state (count_ == 0) is the identity, which
+/// avoids std::numeric_limits in device code.
+template <typename scalar_t>
+struct FusedMinMaxOp {
+    struct State {
+        int64_t count_;
+        scalar_t min_;
+        scalar_t max_;
+    };
+
+    struct Accumulator {
+        OPEN3D_HOST_DEVICE Accumulator()
+            : state_{0, scalar_t(0), scalar_t(0)} {}
+        OPEN3D_HOST_DEVICE void Add(scalar_t x) {
+            if (state_.count_ == 0) {
+                state_.min_ = x;
+                state_.max_ = x;
+            } else {
+                state_.min_ = x < state_.min_ ? x : state_.min_;
+                state_.max_ = x > state_.max_ ? x : state_.max_;
+            }
+            state_.count_++;
+        }
+        OPEN3D_HOST_DEVICE State Get() const { return state_; }
+        State state_;
+    };
+
+    OPEN3D_HOST_DEVICE static State Merge(const State& a, const State& b) {
+        if (a.count_ == 0) {
+            return b;
+        }
+        if (b.count_ == 0) {
+            return a;
+        }
+        return State{a.count_ + b.count_, b.min_ < a.min_ ? b.min_ : a.min_,
+                     b.max_ > a.max_ ? b.max_ : a.max_};
+    }
+
+    OPEN3D_HOST_DEVICE static void Write(const State& state,
+                                         scalar_t* dst0,
+                                         scalar_t* dst1) {
+        *dst0 = state.min_;
+        *dst1 = state.max_;
+    }
+};
+
+/// Mean and M2 (sum of squared deviations from the mean) in double precision.
+/// States of chunks are merged with Chan et al.'s parallel update.
+template <typename scalar_t>
+struct FusedMeanVarOp {
+    struct State {
+        int64_t count_;
+        double mean_;
+        double m2_;
+    };
+
+    /// Sums of the values shifted by the first one. Cheaper than Welford's
+    /// per-element update, and as accurate for chunks of moderate size.
+    struct Accumulator {
+        OPEN3D_HOST_DEVICE Accumulator()
+            : count_(0), shift_(0), sum_(0), sum_sq_(0) {}
+        OPEN3D_HOST_DEVICE void Add(scalar_t x) {
+            double v = static_cast<double>(x);
+            if (count_ == 0) {
+                shift_ = v;
+            }
+            v -= shift_;
+            sum_ += v;
+            sum_sq_ += v * v;
+            count_++;
+        }
+        OPEN3D_HOST_DEVICE State Get() const {
+            if (count_ == 0) {
+                return State{0, 0, 0};
+            }
+            double n = static_cast<double>(count_);
+            double m2 = sum_sq_ - sum_ * sum_ / n;
+            return State{count_, shift_ + sum_ / n, m2 > 0 ? m2 : 0};
+        }
+        int64_t count_;
+        double shift_;
+        double sum_;
+        double sum_sq_;
+    };
+
+    OPEN3D_HOST_DEVICE static State Merge(const State& a, const State& b) {
+        if (a.count_ == 0) {
+            return b;
+        }
+        if (b.count_ == 0) {
+            return a;
+        }
+        int64_t count = a.count_ + b.count_;
+        double n_a = static_cast<double>(a.count_);
+        double n_b = static_cast<double>(b.count_);
+        double delta = b.mean_ - a.mean_;
+        return State{count, a.mean_ + delta * n_b / (n_a + n_b),
+                     a.m2_ + b.m2_ + delta * delta * n_a * n_b / (n_a + n_b)};
+    }
+
+    OPEN3D_HOST_DEVICE static void Write(const State& state,
+                                         scalar_t* dst0,
+                                         scalar_t* dst1) {
+        if (state.count_ == 0) {
+            *dst0 = static_cast<scalar_t>(NAN);
+            *dst1 = static_cast<scalar_t>(NAN);
+        } else {
+            *dst0 = static_cast<scalar_t>(state.mean_);
+            *dst1 = static_cast<scalar_t>(state.m2_ / state.count_);
+        }
+    }
+};
+
+/// Reduces the columns of \p row assigned to \p task_idx, the \p task_idx-th
+/// of \p num_tasks tasks of the row. With \p interleaved, the task visits
+/// columns task_idx, task_idx + num_tasks, ..., such that consecutive GPU
+/// threads read consecutive elements. Otherwise, it visits a contiguous block
+/// of columns, which is cache friendly on CPU.
+template <typename scalar_t, typename op_t>
+OPEN3D_HOST_DEVICE typename op_t::State FusedReduceRowTask(
+        const FusedReductionSrc& src,
+        int64_t row,
+        int64_t task_idx,
+        int64_t num_tasks,
+        bool interleaved) {
+    typename op_t::Accumulator acc;
+    if (interleaved) {
+        for (int64_t col = task_idx; col < src.row_size_; col += num_tasks) {
+            acc.Add(*src.GetPtr<scalar_t>(row, col));
+        }
+        return acc.Get();
+    }
+
+    int64_t block_size = (src.row_size_ + num_tasks - 1) / num_tasks;
+    int64_t col = task_idx * block_size;
+    int64_t end = col + block_size < src.row_size_ ? col + block_size
+                                                   : src.row_size_;
+    while (col < end) {
+        // Walks the rest of the current inner-most dimension by stride.
+        int64_t inner_idx = (row * src.row_size_ + col) % src.inner_size_;
+        int64_t run = src.inner_size_ - inner_idx;
+        run = run < end - col ? run : end - col;
+        const char* ptr =
+                reinterpret_cast<const char*>(src.GetPtr<scalar_t>(row, col));
+        for (int64_t i = 0; i < run; ++i) {
+            acc.Add(*reinterpret_cast<const scalar_t*>(ptr));
+            ptr += src.inner_byte_stride_;
+        }
+        col += run;
+    }
+    return acc.Get();
+}
+
+/// Merges the \p num_tasks states of \p row in order and writes its outputs.
+template <typename scalar_t, typename op_t>
+OPEN3D_HOST_DEVICE void FusedReduceRowMerge(
+        const typename op_t::State* task_states,
+        int64_t row,
+        int64_t num_tasks,
+        scalar_t* dst0,
+        scalar_t* dst1) {
+    typename op_t::State state = task_states[row * num_tasks];
+    for (int64_t i = 1; i < num_tasks; ++i) {
+        state = op_t::Merge(state, task_states[row * num_tasks + i]);
+    }
+    op_t::Write(state, dst0 + row, dst1 + row);
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,107 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+
+#include "open3d/core/CUDAState.cuh"
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/CUDALauncher.cuh"
+#include "open3d/core/kernel/FusedReduction.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+// Minimum number of elements reduced by one thread, and maximum number of
+// threads per row. The per-row merge of the thread states is serial.
+static constexpr int64_t kMinTaskSize = 64;
+static constexpr int64_t kMaxTasksPerRow = 1024;
+
+template <typename scalar_t, typename op_t>
+static void FusedReductionCUDATyped(const Tensor& src,
+                                    Tensor& dst0,
+                                    Tensor& dst1) {
+    using State = typename op_t::State;
+    int64_t num_rows = dst0.NumElements();
+    FusedReductionSrc src_ref(src, num_rows);
+    int64_t num_tasks = std::max<int64_t>(
+            1, std::min<int64_t>(src_ref.row_size_ / kMinTaskSize,
+                                 kMaxTasksPerRow));
+
+    Tensor task_states_buffer(
+            {num_rows * num_tasks * static_cast<int64_t>(sizeof(State))},
+            Dtype::UInt8, src.GetDevice());
+    State* task_states = static_cast<State*>(task_states_buffer.GetDataPtr());
+    CUDALauncher::LaunchGeneralKernel(
+            num_rows * num_tasks, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                task_states[workload_idx] = FusedReduceRowTask<scalar_t, op_t>(
+                        src_ref, workload_idx / num_tasks,
+                        workload_idx % num_tasks, num_tasks,
+                        /*interleaved=*/true);
+            });
+
+    scalar_t* dst0_ptr = static_cast<scalar_t*>(dst0.GetDataPtr());
+    scalar_t* dst1_ptr = static_cast<scalar_t*>(dst1.GetDataPtr());
+    CUDALauncher::LaunchGeneralKernel(
+            num_rows, [=] OPEN3D_DEVICE(int64_t row) {
+                FusedReduceRowMerge<scalar_t, op_t>(task_states, row, num_tasks,
+                                                    dst0_ptr, dst1_ptr);
+            });
+}
+
+void FusedReductionCUDA(const Tensor& src,
+                        Tensor& dst0,
+                        Tensor& dst1,
+                        FusedReductionOpCode op_code) {
+    CUDADeviceSwitcher switcher(src.GetDevice());
+    Dtype dtype = src.GetDtype();
+    switch (op_code) {
+        case FusedReductionOpCode::MinMax:
+            DISPATCH_DTYPE_TO_TEMPLATE(dtype, [&]() {
+                FusedReductionCUDATyped<scalar_t, FusedMinMaxOp<scalar_t>>(
+                        src, dst0, dst1);
+            });
+            break;
+        case FusedReductionOpCode::MeanVar:
+            if (dtype == Dtype::Float32) {
+                FusedReductionCUDATyped<float, FusedMeanVarOp<float>>(
+                        src, dst0, dst1);
+            } else {
+                FusedReductionCUDATyped<double, FusedMeanVarOp<double>>(
+                        src, dst0, dst1);
+            }
+            break;
+        default:
+            utility::LogError("Unsupported op code.");
+            break;
+    }
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -88,6 +88,56 @@ void IndexSet(const Tensor& src,
     }
 }
 
+void IndexReduce(const Tensor& index,
+                 const Tensor& src,
+                 Tensor& dst,
+                 ReductionOpCode op_code) {
+    if (index.NumDims() != 1 || index.GetDtype() != Dtype::Int64) {
+        utility::LogError(
+                "IndexReduce: index must be a 1-D Int64 tensor, but got shape "
+                "{} and dtype {}.",
+                index.GetShape(), index.GetDtype().ToString());
+    }
+    if (src.NumDims() != 3 || dst.NumDims() != 3 ||
+        src.GetShape()[0] != dst.GetShape()[0] ||
+        src.GetShape()[1] != index.GetLength() ||
+        src.GetShape()[2] != dst.GetShape()[2]) {
+        utility::LogError(
+                "IndexReduce: src of shape {} does not match dst of shape {} "
+                "and {} indices.",
+                src.GetShape(), dst.GetShape(), index.GetLength());
+    }
+    if (!src.IsContiguous() || !dst.IsContiguous()) {
+        utility::LogError("IndexReduce: src and dst must be contiguous.");
+    }
+    src.AssertDtype(dst.GetDtype());
+    src.AssertDevice(dst.GetDevice());
+    index.AssertDevice(dst.GetDevice());
+    if (index.GetLength() == 0) {
+        return;
+    }
+    const int64_t min_index = index.Min({0}).Item<int64_t>();
+    const int64_t max_index = index.Max({0}).Item<int64_t>();
+    if (min_index < 0 || max_index >= dst.GetShape()[1]) {
+        utility::LogError(
+                "IndexReduce: indices must be in [0, {}), but got [{}, {}].",
+                dst.GetShape()[1], min_index, max_index);
+    }
+
+    Tensor index_contiguous = index.Contiguous();
+    if (dst.GetDevice().GetType() == Device::DeviceType::CPU) {
+        IndexReduceCPU(index_contiguous, src, dst, op_code);
+    } else if (dst.GetDevice().GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        IndexReduceCUDA(index_contiguous, src, dst, op_code);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("IndexReduce: Unimplemented device");
+    }
+}
+
 }  // namespace kernel
 }  // namespace core
 }  // namespace open3d
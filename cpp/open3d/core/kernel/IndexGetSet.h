@@ -27,6 +27,7 @@
 #pragma once
 
 #include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/Reduction.h"
 #include "open3d/utility/Console.h"
 
 namespace open3d {
@@ -73,6 +74,37 @@ void IndexSetCUDA(const Tensor& src,
                   const SizeVector& indexed_strides);
 #endif
 
+/// Reduces the slices of \p src into \p dst at the positions given by
+/// \p index, i.e. dst[o, index[i], k] = op(dst[o, index[i], k], src[o, i, k])
+/// for a {outer, N, inner} \p src and a {outer, M, inner} \p dst. Duplicate
+/// indices accumulate and slices of \p dst that are not indexed are left
+/// unchanged.
+///
+/// \param index Int64 {N} tensor with values in [0, M).
+/// \param src Contiguous 3-D tensor with the dtype of \p dst.
+/// \param dst Contiguous 3-D tensor, reduced in place.
+/// \param op_code One of Sum, Prod, Min and Max.
+///
+/// The CPU kernel groups the source slices by destination and needs no
+/// atomics. The CUDA kernel uses atomics and supports Float32, Float64, Int32
+/// and Int64.
+void IndexReduce(const Tensor& index,
+                 const Tensor& src,
+                 Tensor& dst,
+                 ReductionOpCode op_code);
+
+void IndexReduceCPU(const Tensor& index,
+                    const Tensor& src,
+                    Tensor& dst,
+                    ReductionOpCode op_code);
+
+#ifdef BUILD_CUDA_MODULE
+void IndexReduceCUDA(const Tensor& index,
+                     const Tensor& src,
+                     Tensor& dst,
+                     ReductionOpCode op_code);
+#endif
+
 }  // namespace kernel
 }  // namespace core
 }  // namespace open3d
@@ -24,11 +24,14 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <vector>
+
 #include "open3d/core/AdvancedIndexing.h"
 #include "open3d/core/Dispatch.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/core/kernel/CPULauncher.h"
 #include "open3d/core/kernel/IndexGetSet.h"
+#include "open3d/core/kernel/ParallelUtil.h"
 #include "open3d/utility/Console.h"
 
 namespace open3d {
@@ -63,7 +66,7 @@ void IndexGetCPU(const Tensor& src,
                     CPUCopyObjectElementKernel(src, dst, object_byte_size);
                 });
     } else {
-        DISPATCH_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_FLOAT16(dtype, [&]() {
             CPULauncher::LaunchAdvancedIndexerKernel(
                     ai, CPUCopyElementKernel<scalar_t>);
         });
@@ -85,13 +88,100 @@ void IndexSetCPU(const Tensor& src,
                     CPUCopyObjectElementKernel(src, dst, object_byte_size);
                 });
     } else {
-        DISPATCH_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_FLOAT16(dtype, [&]() {
             CPULauncher::LaunchAdvancedIndexerKernel(
                     ai, CPUCopyElementKernel<scalar_t>);
         });
     }
 }
 
+template <typename scalar_t, typename func_t>
+static void LaunchIndexReduceCPUKernel(const Tensor& index,
+                                       const Tensor& src,
+                                       Tensor& dst,
+                                       func_t reduce_func) {
+    const int64_t num_outer = src.GetShape()[0];
+    const int64_t num_src = src.GetShape()[1];
+    const int64_t num_inner = src.GetShape()[2];
+    const int64_t num_dst = dst.GetShape()[1];
+    const int64_t* index_ptr = static_cast<const int64_t*>(index.GetDataPtr());
+    const scalar_t* src_ptr = static_cast<const scalar_t*>(src.GetDataPtr());
+    scalar_t* dst_ptr = static_cast<scalar_t*>(dst.GetDataPtr());
+
+    // Group the source slices by destination with a counting sort, so that
+    // each destination slice is reduced by a single thread: no atomics are
+    // needed, and the reduction order, hence the floating point result, does
+    // not depend on the number of threads.
+    std::vector<int64_t> dst_splits(num_dst + 1, 0);
+    for (int64_t i = 0; i < num_src; ++i) {
+        dst_splits[index_ptr[i] + 1]++;
+    }
+    std::vector<int64_t> targets;
+    for (int64_t m = 0; m < num_dst; ++m) {
+        if (dst_splits[m + 1] > 0) {
+            targets.push_back(m);
+        }
+        dst_splits[m + 1] += dst_splits[m];
+    }
+    std::vector<int64_t> src_order(num_src);
+    std::vector<int64_t> offsets(dst_splits.begin(), dst_splits.end() - 1);
+    for (int64_t i = 0; i < num_src; ++i) {
+        src_order[offsets[index_ptr[i]]++] = i;
+    }
+
+    const int64_t num_targets = static_cast<int64_t>(targets.size());
+    // The number of source slices per destination is arbitrary, hence the
+    // dynamic schedule.
+    ParallelFor(
+            num_outer * num_targets,
+            [&](int64_t workload_idx) {
+                const int64_t o = workload_idx / num_targets;
+                const int64_t m = targets[workload_idx % num_targets];
+                scalar_t* acc = dst_ptr + (o * num_dst + m) * num_inner;
+                for (int64_t j = dst_splits[m]; j < dst_splits[m + 1]; ++j) {
+                    const scalar_t* src_slice =
+                            src_ptr + (o * num_src + src_order[j]) * num_inner;
+                    for (int64_t k = 0; k < num_inner; ++k) {
+                        acc[k] = reduce_func(acc[k], src_slice[k]);
+                    }
+                }
+            },
+            ParallelSchedule::Dynamic());
+}
+
+void IndexReduceCPU(const Tensor& index,
+                    const Tensor& src,
+                    Tensor& dst,
+                    ReductionOpCode op_code) {
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        switch (op_code) {
+            case ReductionOpCode::Sum:
+                LaunchIndexReduceCPUKernel<scalar_t>(
+                        index, src, dst,
+                        [](scalar_t a, scalar_t b) { return a + b; });
+                break;
+            case ReductionOpCode::Prod:
+                LaunchIndexReduceCPUKernel<scalar_t>(
+                        index, src, dst,
+                        [](scalar_t a, scalar_t b) { return a * b; });
+                break;
+            case ReductionOpCode::Min:
+                LaunchIndexReduceCPUKernel<scalar_t>(
+                        index, src, dst,
+                        [](scalar_t a, scalar_t b) { return a < b ? a : b; });
+                break;
+            case ReductionOpCode::Max:
+                LaunchIndexReduceCPUKernel<scalar_t>(
+                        index, src, dst,
+                        [](scalar_t a, scalar_t b) { return a > b ? a : b; });
+                break;
+            default:
+                utility::LogError("Unsupported op code.");
+                break;
+        }
+    });
+}
+
 }  // namespace kernel
 }  // namespace core
 }  // namespace open3d
@@ -24,6 +24,9 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <cstring>
+#include <type_traits>
+
 #include "open3d/core/CUDAState.cuh"
 #include "open3d/core/CUDAUtils.h"
 #include "open3d/core/Dispatch.h"
@@ -66,7 +69,7 @@ void IndexGetCUDA(const Tensor& src,
                     CUDACopyObjectElementKernel(src, dst, object_byte_size);
                 });
     } else {
-        DISPATCH_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_FLOAT16(dtype, [&]() {
             CUDALauncher::LaunchAdvancedIndexerKernel(
                     ai,
                     // Need to wrap as extended CUDA lambda function
@@ -93,7 +96,7 @@ void IndexSetCUDA(const Tensor& src,
                     CUDACopyObjectElementKernel(src, dst, object_byte_size);
                 });
     } else {
-        DISPATCH_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_FLOAT16(dtype, [&]() {
             CUDALauncher::LaunchAdvancedIndexerKernel(
                     ai,
                     // Need to wrap as extended CUDA lambda function
@@ -104,6 +107,147 @@ void IndexSetCUDA(const Tensor& src,
     }
 }
 
+/// Atomically replaces *address by func(*address, value) with a compare and
+/// swap loop on the 4 or 8 byte word holding it.
+template <typename scalar_t, typename func_t>
+static OPEN3D_DEVICE void CUDAAtomicReduce(scalar_t* address,
+                                           scalar_t value,
+                                           func_t func) {
+    static_assert(sizeof(scalar_t) == 4 || sizeof(scalar_t) == 8,
+                  "Only 4 and 8 byte types are supported.");
+    using word_t = typename std::conditional<sizeof(scalar_t) == 4,
+                                             unsigned int,
+                                             unsigned long long int>::type;
+    word_t* address_as_word = reinterpret_cast<word_t*>(address);
+    word_t old_word = *address_as_word;
+    word_t assumed_word;
+    do {
+        assumed_word = old_word;
+        scalar_t current;
+        memcpy(&current, &assumed_word, sizeof(scalar_t));
+        const scalar_t updated = func(current, value);
+        word_t updated_word;
+        memcpy(&updated_word, &updated, sizeof(scalar_t));
+        old_word = atomicCAS(address_as_word, assumed_word, updated_word);
+    } while (assumed_word != old_word);
+}
+
+static OPEN3D_DEVICE void CUDAAtomicAdd(float* address, float value) {
+    atomicAdd(address, value);
+}
+
+static OPEN3D_DEVICE void CUDAAtomicAdd(double* address, double value) {
+#if !defined(__CUDA_ARCH__) || __CUDA_ARCH__ >= 600
+    atomicAdd(address, value);
+#else
+    CUDAAtomicReduce(address, value, [](double a, double b) { return a + b; });
+#endif
+}
+
+static OPEN3D_DEVICE void CUDAAtomicAdd(int32_t* address, int32_t value) {
+    atomicAdd(reinterpret_cast<int*>(address), static_cast<int>(value));
+}
+
+static OPEN3D_DEVICE void CUDAAtomicAdd(int64_t* address, int64_t value) {
+    // Two's complement addition is the same for signed and unsigned words.
+    atomicAdd(reinterpret_cast<unsigned long long int*>(address),
+              static_cast<unsigned long long int>(value));
+}
+
+template <typename scalar_t, typename func_t>
+static void LaunchIndexReduceCUDAKernel(const Tensor& index,
+                                        const Tensor& src,
+                                        Tensor& dst,
+                                        func_t atomic_func) {
+    const int64_t num_src = src.GetShape()[1];
+    const int64_t num_inner = src.GetShape()[2];
+    const int64_t num_dst = dst.GetShape()[1];
+    const int64_t* index_ptr = static_cast<const int64_t*>(index.GetDataPtr());
+    const scalar_t* src_ptr = static_cast<const scalar_t*>(src.GetDataPtr());
+    scalar_t* dst_ptr = static_cast<scalar_t*>(dst.GetDataPtr());
+    CUDALauncher::LaunchGeneralKernel(
+            src.NumElements(), [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                const int64_t k = workload_idx % num_inner;
+                const int64_t i = (workload_idx / num_inner) % num_src;
+                const int64_t o = workload_idx / (num_inner * num_src);
+                atomic_func(
+                        dst_ptr + (o * num_dst + index_ptr[i]) * num_inner + k,
+                        src_ptr[workload_idx]);
+            });
+}
+
+template <typename scalar_t>
+static void IndexReduceCUDATyped(const Tensor& index,
+                                 const Tensor& src,
+                                 Tensor& dst,
+                                 ReductionOpCode op_code) {
+    switch (op_code) {
+        case ReductionOpCode::Sum:
+            LaunchIndexReduceCUDAKernel<scalar_t>(
+                    index, src, dst,
+                    [] OPEN3D_DEVICE(scalar_t * address, scalar_t value) {
+                        CUDAAtomicAdd(address, value);
+                    });
+            break;
+        case ReductionOpCode::Prod:
+            LaunchIndexReduceCUDAKernel<scalar_t>(
+                    index, src, dst,
+                    [] OPEN3D_DEVICE(scalar_t * address, scalar_t value) {
+                        CUDAAtomicReduce(address, value,
+                                         [](scalar_t a, scalar_t b) {
+                                             return a * b;
+                                         });
+                    });
+            break;
+        case ReductionOpCode::Min:
+            LaunchIndexReduceCUDAKernel<scalar_t>(
+                    index, src, dst,
+                    [] OPEN3D_DEVICE(scalar_t * address, scalar_t value) {
+                        CUDAAtomicReduce(address, value,
+                                         [](scalar_t a, scalar_t b) {
+                                             return a < b ? a : b;
+                                         });
+                    });
+            break;
+        case ReductionOpCode::Max:
+            LaunchIndexReduceCUDAKernel<scalar_t>(
+                    index, src, dst,
+                    [] OPEN3D_DEVICE(scalar_t * address, scalar_t value) {
+                        CUDAAtomicReduce(address, value,
+                                         [](scalar_t a, scalar_t b) {
+                                             return a > b ? a : b;
+                                         });
+                    });
+            break;
+        default:
+            utility::LogError("Unsupported op code.");
+            break;
+    }
+}
+
+void IndexReduceCUDA(const Tensor& index,
+                     const Tensor& src,
+                     Tensor& dst,
+                     ReductionOpCode op_code) {
+    CUDADeviceSwitcher switcher(dst.GetDevice());
+    // Limited to the dtypes with 4 or 8 byte atomics.
+    Dtype dtype = src.GetDtype();
+    if (dtype == Dtype::Float32) {
+        IndexReduceCUDATyped<float>(index, src, dst, op_code);
+    } else if (dtype == Dtype::Float64) {
+        IndexReduceCUDATyped<double>(index, src, dst, op_code);
+    } else if (dtype == Dtype::Int32) {
+        IndexReduceCUDATyped<int32_t>(index, src, dst, op_code);
+    } else if (dtype == Dtype::Int64) {
+        IndexReduceCUDATyped<int64_t>(index, src, dst, op_code);
+    } else {
+        utility::LogError(
+                "IndexReduce on CUDA supports Float32, Float64, Int32 and "
+                "Int64, but got {}.",
+                dtype.ToString());
+    }
+}
+
 }  // namespace kernel
 }  // namespace core
 }  // namespace open3d
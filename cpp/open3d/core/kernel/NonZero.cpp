@@ -26,6 +26,8 @@
 
 #include "open3d/core/kernel/NonZero.h"
 
+#include <algorithm>
+
 #include "open3d/core/Device.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/utility/Console.h"
@@ -49,6 +51,49 @@ Tensor NonZero(const Tensor& src) {
     }
 }
 
+Tensor MaskedSelect(const Tensor& src, const Tensor& mask) {
+    mask.AssertDtype(Dtype::Bool);
+    const SizeVector& src_shape = src.GetShape();
+    const SizeVector& mask_shape = mask.GetShape();
+    const int64_t mask_ndims = mask.NumDims();
+    if (mask_ndims == 0 || mask_ndims > src.NumDims() ||
+        !std::equal(mask_shape.begin(), mask_shape.end(),
+                    src_shape.begin())) {
+        utility::LogError(
+                "MaskedSelect: mask of shape {} does not match the leading "
+                "dimensions of tensor of shape {}.",
+                mask_shape, src_shape);
+    }
+
+    // View both as rows: each true mask element selects one contiguous row.
+    const int64_t num_rows = mask_shape.NumElements();
+    SizeVector row_shape(src_shape.begin() + mask_ndims, src_shape.end());
+    Tensor src_rows =
+            src.Contiguous().Reshape({num_rows, row_shape.NumElements()});
+    Tensor mask_rows = mask.Contiguous().Reshape({num_rows});
+    if (mask_rows.GetDevice() != src.GetDevice()) {
+        mask_rows = mask_rows.Copy(src.GetDevice());
+    }
+
+    Tensor dst;
+    Device::DeviceType device_type = src.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        dst = MaskedSelectCPU(src_rows, mask_rows);
+    } else if (device_type == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        dst = MaskedSelectCUDA(src_rows, mask_rows);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("MaskedSelect: Unimplemented device");
+    }
+
+    SizeVector dst_shape{dst.GetLength()};
+    dst_shape.insert(dst_shape.end(), row_shape.begin(), row_shape.end());
+    return dst.Reshape(dst_shape);
+}
+
 }  // namespace kernel
 }  // namespace core
 }  // namespace open3d
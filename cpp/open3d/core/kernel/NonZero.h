@@ -40,6 +40,23 @@ Tensor NonZeroCPU(const Tensor& src);
 Tensor NonZeroCUDA(const Tensor& src);
 #endif
 
+/// Gathers the slices of \p src selected by the boolean \p mask, i.e. src[mask]
+/// in NumPy. The shape of \p mask must match the leading dimensions of \p src.
+/// The output has shape {num_true} + src.GetShape()[mask.NumDims():].
+///
+/// Unlike IndexGet with NonZero indices, this is a single stream compaction
+/// pass that writes the gathered slices directly, without intermediate index
+/// tensors.
+Tensor MaskedSelect(const Tensor& src, const Tensor& mask);
+
+/// \p src is a contiguous {num_rows, row_size} tensor and \p mask is a
+/// contiguous {num_rows} Bool tensor on the same device.
+Tensor MaskedSelectCPU(const Tensor& src, const Tensor& mask);
+
+#ifdef BUILD_CUDA_MODULE
+Tensor MaskedSelectCUDA(const Tensor& src, const Tensor& mask);
+#endif
+
 }  // namespace kernel
 }  // namespace core
 }  // namespace open3d
@@ -24,9 +24,14 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <cstring>
+#include <numeric>
+
 #include "open3d/core/Indexer.h"
 #include "open3d/core/kernel/NonZero.h"
+#include "open3d/core/kernel/ParallelUtil.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace core {
@@ -39,7 +44,7 @@ Tensor NonZeroCPU(const Tensor& src) {
     std::vector<int64_t> indices(static_cast<size_t>(num_elements));
     std::iota(std::begin(indices), std::end(indices), 0);
     std::vector<int64_t> non_zero_indices(num_elements);
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src.GetDtype(), [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_FLOAT16(src.GetDtype(), [&]() {
         auto it = std::copy_if(
                 indices.begin(), indices.end(), non_zero_indices.begin(),
                 [&src_iter](int64_t index) {
@@ -60,7 +65,7 @@ Tensor NonZeroCPU(const Tensor& src) {
 
     std::vector<std::vector<int64_t>> non_zero_indices_by_dimensions(
             num_dims, std::vector<int64_t>(num_non_zeros, 0));
-#pragma omp parallel for schedule(static)
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
     for (int64_t i = 0; i < static_cast<int64_t>(num_non_zeros); i++) {
         int64_t non_zero_index = non_zero_indices[i];
         for (int64_t dim = num_dims - 1; dim >= 0; dim--) {
@@ -73,6 +78,53 @@ Tensor NonZeroCPU(const Tensor& src) {
     return result;
 }
 
+Tensor MaskedSelectCPU(const Tensor& src, const Tensor& mask) {
+    const int64_t num_rows = mask.GetLength();
+    const int64_t row_byte_size = src.GetShape()[1] * src.GetDtype().ByteSize();
+    const bool* mask_ptr = static_cast<const bool*>(mask.GetDataPtr());
+    const char* src_ptr = static_cast<const char*>(src.GetDataPtr());
+
+    // Split the rows into one block per thread. Small inputs are not worth
+    // waking up the thread pool for.
+    constexpr int64_t kMinRowsPerBlock = 4096;
+    const int64_t num_blocks = std::max<int64_t>(
+            1, std::min<int64_t>(GetMaxThreads(), num_rows / kMinRowsPerBlock));
+    const int64_t rows_per_block = (num_rows + num_blocks - 1) / num_blocks;
+
+    // Count the selected rows of each block, then an exclusive prefix sum
+    // over the block counts gives each block its first output row.
+    std::vector<int64_t> block_offsets(num_blocks + 1, 0);
+#pragma omp parallel for schedule(static) if (num_blocks > 1) num_threads(utility::EstimateMaxThreads())
+    for (int64_t block_idx = 0; block_idx < num_blocks; ++block_idx) {
+        const int64_t begin = block_idx * rows_per_block;
+        const int64_t end = std::min(begin + rows_per_block, num_rows);
+        int64_t count = 0;
+        for (int64_t i = begin; i < end; ++i) {
+            count += mask_ptr[i];
+        }
+        block_offsets[block_idx + 1] = count;
+    }
+    std::partial_sum(block_offsets.begin(), block_offsets.end(),
+                     block_offsets.begin());
+
+    Tensor dst({block_offsets.back(), src.GetShape()[1]}, src.GetDtype(),
+               src.GetDevice());
+    char* dst_ptr = static_cast<char*>(dst.GetDataPtr());
+#pragma omp parallel for schedule(static) if (num_blocks > 1) num_threads(utility::EstimateMaxThreads())
+    for (int64_t block_idx = 0; block_idx < num_blocks; ++block_idx) {
+        const int64_t begin = block_idx * rows_per_block;
+        const int64_t end = std::min(begin + rows_per_block, num_rows);
+        char* out = dst_ptr + block_offsets[block_idx] * row_byte_size;
+        for (int64_t i = begin; i < end; ++i) {
+            if (mask_ptr[i]) {
+                std::memcpy(out, src_ptr + i * row_byte_size, row_byte_size);
+                out += row_byte_size;
+            }
+        }
+    }
+    return dst;
+}
+
 }  // namespace kernel
 }  // namespace core
 }  // namespace open3d
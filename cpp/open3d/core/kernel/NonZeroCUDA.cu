@@ -24,11 +24,14 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <cub/cub.cuh>
 #include <thrust/device_vector.h>
 #include <thrust/execution_policy.h>
 #include <thrust/for_each.h>
 #include <thrust/iterator/zip_iterator.h>
 
+#include "open3d/core/CUDAState.cuh"
+#include "open3d/core/CUDAUtils.h"
 #include "open3d/core/Indexer.h"
 #include "open3d/core/kernel/NonZero.h"
 
@@ -85,7 +88,7 @@ Tensor NonZeroCUDA(const Tensor& src) {
 
     // Get flattened non-zero indices.
     thrust::device_vector<int64_t> non_zero_indices(num_elements);
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src.GetDtype(), [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_FLOAT16(src.GetDtype(), [&]() {
         thrust::device_ptr<const scalar_t> src_ptr(static_cast<const scalar_t*>(
                 src_contiguous.GetBlob()->GetDataPtr()));
 
@@ -116,6 +119,122 @@ Tensor NonZeroCUDA(const Tensor& src) {
     return result;
 }
 
+struct BoolToInt64Functor {
+    __host__ __device__ int64_t operator()(bool value) const {
+        return value ? 1 : 0;
+    }
+};
+
+/// Copies the rows listed in \p indices, as words of type word_t.
+template <typename word_t>
+__global__ void GatherRowsKernel(const word_t* src,
+                                 const int64_t* indices,
+                                 word_t* dst,
+                                 int64_t num_selected,
+                                 int64_t words_per_row) {
+    const int64_t num_words = num_selected * words_per_row;
+    for (int64_t i = blockIdx.x * int64_t(blockDim.x) + threadIdx.x;
+         i < num_words; i += int64_t(blockDim.x) * gridDim.x) {
+        const int64_t row = i / words_per_row;
+        const int64_t word = i - row * words_per_row;
+        dst[i] = src[indices[row] * words_per_row + word];
+    }
+}
+
+/// Runs cub::DeviceSelect::Flagged, allocating the temporary storage from
+/// the Open3D memory manager.
+template <typename InputIterator, typename OutputIterator>
+static void DeviceSelectFlagged(InputIterator in,
+                                const bool* flags,
+                                OutputIterator out,
+                                int64_t num_items,
+                                const Device& device) {
+    Tensor num_selected({}, Dtype::Int64, device);
+    int64_t* num_selected_ptr =
+            static_cast<int64_t*>(num_selected.GetDataPtr());
+    size_t temp_bytes = 0;
+    OPEN3D_CUDA_CHECK(cub::DeviceSelect::Flagged(
+            nullptr, temp_bytes, in, flags, out, num_selected_ptr,
+            static_cast<int>(num_items)));
+    Tensor temp({static_cast<int64_t>(temp_bytes)}, Dtype::UInt8, device);
+    OPEN3D_CUDA_CHECK(cub::DeviceSelect::Flagged(
+            temp.GetDataPtr(), temp_bytes, in, flags, out, num_selected_ptr,
+            static_cast<int>(num_items)));
+}
+
+template <typename word_t>
+static void MaskedSelectRows(const Tensor& src,
+                             const Tensor& mask,
+                             Tensor& dst) {
+    const int64_t num_rows = mask.GetLength();
+    const int64_t num_selected = dst.GetLength();
+    const int64_t words_per_row =
+            src.GetShape()[1] * src.GetDtype().ByteSize() / sizeof(word_t);
+    const word_t* src_ptr = static_cast<const word_t*>(src.GetDataPtr());
+    const bool* mask_ptr = static_cast<const bool*>(mask.GetDataPtr());
+    word_t* dst_ptr = static_cast<word_t*>(dst.GetDataPtr());
+
+    if (words_per_row == 1) {
+        // Each row is a single word: compact the values directly.
+        DeviceSelectFlagged(src_ptr, mask_ptr, dst_ptr, num_rows,
+                            src.GetDevice());
+    } else {
+        Tensor indices({num_selected}, Dtype::Int64, src.GetDevice());
+        int64_t* indices_ptr = static_cast<int64_t*>(indices.GetDataPtr());
+        DeviceSelectFlagged(cub::CountingInputIterator<int64_t>(0), mask_ptr,
+                            indices_ptr, num_rows, src.GetDevice());
+        const int64_t num_words = num_selected * words_per_row;
+        const int threads = 256;
+        const int blocks = static_cast<int>(std::min<int64_t>(
+                (num_words + threads - 1) / threads, 65535));
+        GatherRowsKernel<word_t><<<blocks, threads>>>(
+                src_ptr, indices_ptr, dst_ptr, num_selected, words_per_row);
+        OPEN3D_CUDA_CHECK(cudaGetLastError());
+    }
+}
+
+Tensor MaskedSelectCUDA(const Tensor& src, const Tensor& mask) {
+    CUDADeviceSwitcher switcher(src.GetDevice());
+    const int64_t num_rows = mask.GetLength();
+    const int64_t row_byte_size = src.GetShape()[1] * src.GetDtype().ByteSize();
+    const bool* mask_ptr = static_cast<const bool*>(mask.GetDataPtr());
+
+    // Count first, so that the output is allocated with its exact size.
+    Tensor num_selected({}, Dtype::Int64, src.GetDevice());
+    cub::TransformInputIterator<int64_t, BoolToInt64Functor, const bool*>
+            mask_as_int64(mask_ptr, BoolToInt64Functor());
+    size_t temp_bytes = 0;
+    OPEN3D_CUDA_CHECK(cub::DeviceReduce::Sum(
+            nullptr, temp_bytes, mask_as_int64,
+            static_cast<int64_t*>(num_selected.GetDataPtr()),
+            static_cast<int>(num_rows)));
+    Tensor temp({static_cast<int64_t>(temp_bytes)}, Dtype::UInt8,
+                src.GetDevice());
+    OPEN3D_CUDA_CHECK(cub::DeviceReduce::Sum(
+            temp.GetDataPtr(), temp_bytes, mask_as_int64,
+            static_cast<int64_t*>(num_selected.GetDataPtr()),
+            static_cast<int>(num_rows)));
+
+    Tensor dst({num_selected.Item<int64_t>(), src.GetShape()[1]},
+               src.GetDtype(), src.GetDevice());
+    if (dst.NumElements() == 0) {
+        return dst;
+    }
+
+    // Rows are copied as the widest word that divides the row size. Rows
+    // start at multiples of the row size, so the words are always aligned.
+    if (row_byte_size % 8 == 0) {
+        MaskedSelectRows<uint64_t>(src, mask, dst);
+    } else if (row_byte_size % 4 == 0) {
+        MaskedSelectRows<uint32_t>(src, mask, dst);
+    } else if (row_byte_size % 2 == 0) {
+        MaskedSelectRows<uint16_t>(src, mask, dst);
+    } else {
+        MaskedSelectRows<uint8_t>(src, mask, dst);
+    }
+    return dst;
+}
+
 }  // namespace kernel
 }  // namespace core
 }  // namespace open3d
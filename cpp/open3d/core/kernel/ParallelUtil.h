@@ -26,24 +26,167 @@
 
 #pragma once
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#include "open3d/utility/Parallel.h"
+
 namespace open3d {
 namespace core {
 namespace kernel {
 
-inline int GetMaxThreads() {
+/// Number of threads of the next parallel region, see
+/// utility::EstimateMaxThreads().
+inline int GetMaxThreads() { return utility::EstimateMaxThreads(); }
+
+inline bool InParallel() { return utility::InParallel(); }
+
+inline int GetThreadNum() {
 #ifdef _OPENMP
-    return omp_get_max_threads();
+    return omp_get_thread_num();
 #else
-    return 1;
+    return 0;
 #endif
 }
 
-inline bool InParallel() {
-#ifdef _OPENMP
-    return omp_in_parallel();
-#else
-    return false;
-#endif
+/// Scheduling of ParallelFor(), declared by kernels according to the cost
+/// profile of their workloads.
+class ParallelSchedule {
+public:
+    enum class Type {
+        /// Equal contiguous ranges per thread. Best for uniform per-workload
+        /// cost, e.g. dense element-wise ops.
+        Static,
+        /// Chunks of grain_size workloads handed out on demand.
+        Dynamic,
+        /// Like Dynamic, with chunk sizes decreasing down to grain_size.
+        Guided,
+        /// Each thread processes its own contiguous range in chunks of
+        /// grain_size workloads, and steals chunks from the other threads'
+        /// ranges once done. Keeps the memory locality of Static while
+        /// balancing irregular per-workload cost, e.g. TSDF integration.
+        WorkStealing,
+    };
+
+    /// Default: static scheduling.
+    ParallelSchedule() : type_(Type::Static), grain_size_(0) {}
+
+    /// \param grain_size Number of workloads per chunk. If 0, picks a grain
+    /// size giving each thread a few chunks.
+    ParallelSchedule(Type type, int64_t grain_size = 0)
+        : type_(type), grain_size_(grain_size) {}
+
+    static ParallelSchedule Static() { return ParallelSchedule(); }
+    static ParallelSchedule Dynamic(int64_t grain_size = 0) {
+        return ParallelSchedule(Type::Dynamic, grain_size);
+    }
+    static ParallelSchedule Guided(int64_t grain_size = 0) {
+        return ParallelSchedule(Type::Guided, grain_size);
+    }
+    static ParallelSchedule WorkStealing(int64_t grain_size = 0) {
+        return ParallelSchedule(Type::WorkStealing, grain_size);
+    }
+
+    Type GetType() const { return type_; }
+
+    /// Returns the grain size used for \p n workloads.
+    int64_t GetGrainSize(int64_t n) const {
+        if (grain_size_ > 0) {
+            return grain_size_;
+        }
+        // 16 chunks per thread.
+        int64_t num_chunks = static_cast<int64_t>(GetMaxThreads()) * 16;
+        return std::max<int64_t>(1, n / num_chunks);
+    }
+
+private:
+    Type type_;
+    int64_t grain_size_;
+};
+
+namespace detail {
+
+template <typename func_t>
+void ParallelForWorkStealing(int64_t n, int64_t grain_size, func_t f) {
+    // Range of one thread, padded to avoid false sharing of next_.
+    struct Range {
+        std::atomic<int64_t> next_;
+        int64_t end_;
+        char padding_[64 - sizeof(std::atomic<int64_t>) - sizeof(int64_t)];
+    };
+
+    int64_t num_chunks = (n + grain_size - 1) / grain_size;
+    int64_t num_ranges = std::min<int64_t>(GetMaxThreads(), num_chunks);
+    // Ranges are aligned to chunks, so that chunks never straddle two ranges.
+    int64_t chunks_per_range = (num_chunks + num_ranges - 1) / num_ranges;
+    std::vector<Range> ranges(num_ranges);
+    for (int64_t i = 0; i < num_ranges; ++i) {
+        ranges[i].next_ = std::min(i * chunks_per_range * grain_size, n);
+        ranges[i].end_ = std::min((i + 1) * chunks_per_range * grain_size, n);
+    }
+
+    // If the runtime starts fewer threads, the unowned ranges are stolen.
+#pragma omp parallel num_threads(static_cast<int>(num_ranges))
+    {
+        int64_t thread_idx = GetThreadNum();
+        for (int64_t k = 0; k < num_ranges; ++k) {
+            Range& range = ranges[(thread_idx + k) % num_ranges];
+            while (true) {
+                int64_t begin = range.next_.fetch_add(grain_size);
+                if (begin >= range.end_) {
+                    break;
+                }
+                int64_t end = std::min(begin + grain_size, range.end_);
+                for (int64_t workload_idx = begin; workload_idx < end;
+                     ++workload_idx) {
+                    f(workload_idx);
+                }
+            }
+        }
+    }
+}
+
+}  // namespace detail
+
+/// Calls f(workload_idx) for workload_idx in [0, n) in parallel, distributing
+/// the workloads to the threads according to \p schedule.
+template <typename func_t>
+void ParallelFor(int64_t n,
+                 func_t f,
+                 const ParallelSchedule& schedule = ParallelSchedule()) {
+    if (n <= 0) {
+        return;
+    }
+    int64_t grain_size = schedule.GetGrainSize(n);
+    switch (schedule.GetType()) {
+        case ParallelSchedule::Type::Dynamic:
+#pragma omp parallel for schedule(dynamic, grain_size) num_threads(GetMaxThreads())
+            for (int64_t workload_idx = 0; workload_idx < n; ++workload_idx) {
+                f(workload_idx);
+            }
+            break;
+        case ParallelSchedule::Type::Guided:
+#pragma omp parallel for schedule(guided, grain_size) num_threads(GetMaxThreads())
+            for (int64_t workload_idx = 0; workload_idx < n; ++workload_idx) {
+                f(workload_idx);
+            }
+            break;
+        case ParallelSchedule::Type::WorkStealing:
+            detail::ParallelForWorkStealing(n, grain_size, f);
+            break;
+        default:
+#pragma omp parallel for schedule(static) num_threads(GetMaxThreads())
+            for (int64_t workload_idx = 0; workload_idx < n; ++workload_idx) {
+                f(workload_idx);
+            }
+            break;
+    }
 }
 
 }  // namespace kernel
@@ -26,6 +26,7 @@
 
 #include "open3d/core/kernel/Reduction.h"
 
+#include "open3d/core/CUDAUtils.h"
 #include "open3d/core/SizeVector.h"
 
 namespace open3d {
@@ -88,11 +89,26 @@ void Reduction(const Tensor& src,
                           dst.GetDevice().ToString());
     }
 
+    // Float16 only has 11 bits of mantissa, so running sums and products lose
+    // precision quickly. Accumulate in Float32 and round once at the end.
+    if (src.GetDtype() == Dtype::Float16 &&
+        (op_code == ReductionOpCode::Sum || op_code == ReductionOpCode::Prod)) {
+        Tensor dst_fp32(keepdim_shape, Dtype::Float32, dst.GetDevice());
+        Reduction(src.To(Dtype::Float32), dst_fp32, dims, true, op_code);
+        dst.AsRvalue() = dst_fp32;
+        if (!keepdim) {
+            dst = dst.Reshape(non_keepdim_shape);
+        }
+        return;
+    }
+
+    OPEN3D_TRACE_SCOPE("core::Reduction");
     Device::DeviceType device_type = src.GetDevice().GetType();
     if (device_type == Device::DeviceType::CPU) {
         ReductionCPU(src, dst, dims, keepdim, op_code);
     } else if (device_type == Device::DeviceType::CUDA) {
 #ifdef BUILD_CUDA_MODULE
+        OPEN3D_TRACE_CUDA_SCOPE("core::Reduction");
         ReductionCUDA(src, dst, dims, keepdim, op_code);
 #else
         utility::LogError("Not compiled with CUDA, but CUDA device is used.");
@@ -975,7 +975,8 @@ private:
             buffer = MemoryManager::Malloc(config.GlobalMemorySize(), device);
             semaphores = MemoryManager::Malloc(config.SemaphoreSize(), device);
             OPEN3D_CUDA_CHECK(
-                    cudaMemset(semaphores, 0, config.SemaphoreSize()));
+                    cudaMemsetAsync(semaphores, 0, config.SemaphoreSize(),
+                                    GetCUDACurrentStream()));
         }
 
         assert(can_use_32bit_indexing);
@@ -992,10 +993,12 @@ private:
 
         // Launch reduce kernel
         int shared_memory = config.SharedMemorySize();
+        // The result is read by the caller, wait for the kernel.
+        cudaStream_t stream = GetCUDACurrentStream();
         ReduceKernel<ReduceConfig::MAX_NUM_THREADS>
-                <<<config.GridDim(), config.BlockDim(), shared_memory>>>(
-                        reduce_op);
-        OPEN3D_CUDA_CHECK(cudaDeviceSynchronize());
+                <<<config.GridDim(), config.BlockDim(), shared_memory,
+                   stream>>>(reduce_op);
+        OPEN3D_CUDA_CHECK(cudaStreamSynchronize(stream));
         OPEN3D_CUDA_CHECK(cudaGetLastError());
     }
 
@@ -1013,7 +1016,7 @@ void ReductionCUDA(const Tensor& src,
         CUDAReductionEngine re(indexer);
         Dtype dtype = src.GetDtype();
         CUDADeviceSwitcher switcher(src.GetDevice());
-        DISPATCH_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_FLOAT16(dtype, [&]() {
             switch (op_code) {
                 case ReductionOpCode::Sum:
                     if (indexer.NumWorkloads() == 0) {
@@ -1071,7 +1074,7 @@ void ReductionCUDA(const Tensor& src,
         CUDAReductionEngine re(indexer);
         Dtype dtype = src.GetDtype();
         CUDADeviceSwitcher switcher(src.GetDevice());
-        DISPATCH_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_FLOAT16(dtype, [&]() {
             switch (op_code) {
                 case ReductionOpCode::ArgMin:
                     if (indexer.NumWorkloads() == 0) {
@@ -0,0 +1,126 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/kernel/Sort.h"
+
+#include "open3d/core/Device.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+void ArgSort(const Tensor& keys, Tensor& sorted_keys, Tensor& indices) {
+    if (keys.NumDims() != 1) {
+        utility::LogError("ArgSort: keys must be 1-D, but got shape {}.",
+                          keys.GetShape());
+    }
+    Tensor keys_contiguous = keys.Contiguous();
+    Device::DeviceType device_type = keys.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        ArgSortCPU(keys_contiguous, sorted_keys, indices);
+    } else if (device_type == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        ArgSortCUDA(keys_contiguous, sorted_keys, indices);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("ArgSort: Unimplemented device");
+    }
+}
+
+void RunLengthEncode(const Tensor& sorted_keys,
+                     Tensor& unique_keys,
+                     Tensor& segment_ids,
+                     Tensor& segment_splits) {
+    if (sorted_keys.NumDims() != 1) {
+        utility::LogError(
+                "RunLengthEncode: keys must be 1-D, but got shape {}.",
+                sorted_keys.GetShape());
+    }
+    Tensor keys_contiguous = sorted_keys.Contiguous();
+    Device::DeviceType device_type = sorted_keys.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        RunLengthEncodeCPU(keys_contiguous, unique_keys, segment_ids,
+                           segment_splits);
+    } else if (device_type == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        RunLengthEncodeCUDA(keys_contiguous, unique_keys, segment_ids,
+                            segment_splits);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("RunLengthEncode: Unimplemented device");
+    }
+}
+
+void SegmentedReduce(const Tensor& values,
+                     const Tensor& segment_splits,
+                     Tensor& dst,
+                     ReductionOpCode op_code) {
+    if (op_code != ReductionOpCode::Sum && op_code != ReductionOpCode::Prod &&
+        op_code != ReductionOpCode::Min && op_code != ReductionOpCode::Max) {
+        utility::LogError(
+                "SegmentedReduce: only Sum, Prod, Min and Max are supported.");
+    }
+    values.AssertShapeCompatible({utility::nullopt, utility::nullopt});
+    segment_splits.AssertDtype(Dtype::Int64);
+    segment_splits.AssertDevice(values.GetDevice());
+    if (segment_splits.NumDims() != 1 || segment_splits.GetLength() == 0) {
+        utility::LogError(
+                "SegmentedReduce: segment_splits must be a non-empty 1-D "
+                "tensor.");
+    }
+    dst.AssertShape({segment_splits.GetLength() - 1, values.GetShape()[1]});
+    dst.AssertDtype(values.GetDtype());
+    dst.AssertDevice(values.GetDevice());
+    if (!dst.IsContiguous()) {
+        utility::LogError("SegmentedReduce: dst must be contiguous.");
+    }
+
+    Tensor values_contiguous = values.Contiguous();
+    Tensor splits_contiguous = segment_splits.Contiguous();
+    Device::DeviceType device_type = values.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        SegmentedReduceCPU(values_contiguous, splits_contiguous, dst, op_code);
+    } else if (device_type == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        SegmentedReduceCUDA(values_contiguous, splits_contiguous, dst,
+                            op_code);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("SegmentedReduce: Unimplemented device");
+    }
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
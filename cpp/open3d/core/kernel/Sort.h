@@ -0,0 +1,89 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/Reduction.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+/// Stable ascending sort of the 1-D tensor \p keys. Returns the sorted keys
+/// in \p sorted_keys and, in \p indices, the Int64 positions in \p keys they
+/// came from.
+void ArgSort(const Tensor& keys, Tensor& sorted_keys, Tensor& indices);
+
+/// Run-length encodes the sorted 1-D tensor \p sorted_keys.
+///
+/// \param unique_keys Output {K} tensor with the distinct keys.
+/// \param segment_ids Output Int64 {N} tensor, the index into \p unique_keys
+/// of each key.
+/// \param segment_splits Output Int64 {K + 1} tensor, segment k spans
+/// [segment_splits[k], segment_splits[k + 1]) in \p sorted_keys.
+void RunLengthEncode(const Tensor& sorted_keys,
+                     Tensor& unique_keys,
+                     Tensor& segment_ids,
+                     Tensor& segment_splits);
+
+/// Reduces the rows of the {N, C} tensor \p values over the segments given by
+/// the Int64 {K + 1} tensor \p segment_splits, writing the {K, C} result to
+/// \p dst. \p op_code is one of Sum, Prod, Min and Max.
+void SegmentedReduce(const Tensor& values,
+                     const Tensor& segment_splits,
+                     Tensor& dst,
+                     ReductionOpCode op_code);
+
+void ArgSortCPU(const Tensor& keys, Tensor& sorted_keys, Tensor& indices);
+
+void RunLengthEncodeCPU(const Tensor& sorted_keys,
+                        Tensor& unique_keys,
+                        Tensor& segment_ids,
+                        Tensor& segment_splits);
+
+void SegmentedReduceCPU(const Tensor& values,
+                        const Tensor& segment_splits,
+                        Tensor& dst,
+                        ReductionOpCode op_code);
+
+#ifdef BUILD_CUDA_MODULE
+void ArgSortCUDA(const Tensor& keys, Tensor& sorted_keys, Tensor& indices);
+
+void RunLengthEncodeCUDA(const Tensor& sorted_keys,
+                         Tensor& unique_keys,
+                         Tensor& segment_ids,
+                         Tensor& segment_splits);
+
+void SegmentedReduceCUDA(const Tensor& values,
+                         const Tensor& segment_splits,
+                         Tensor& dst,
+                         ReductionOpCode op_code);
+#endif
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,319 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cstring>
+#include <limits>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/ParallelUtil.h"
+#include "open3d/core/kernel/Sort.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+/// Number of contiguous blocks the CPU kernels split n workloads into: one per
+/// thread, unless the input is too small to be worth waking up the threads.
+static int64_t GetNumBlocks(int64_t n) {
+    constexpr int64_t kMinWorkloadsPerBlock = 4096;
+    return std::max<int64_t>(
+            1, std::min<int64_t>(GetMaxThreads(), n / kMinWorkloadsPerBlock));
+}
+
+/// Unsigned integer type with the same size as scalar_t.
+template <typename scalar_t>
+using RadixBits = typename std::conditional<
+        sizeof(scalar_t) == 1,
+        uint8_t,
+        typename std::conditional<
+                sizeof(scalar_t) == 2,
+                uint16_t,
+                typename std::conditional<sizeof(scalar_t) == 4,
+                                          uint32_t,
+                                          uint64_t>::type>::type>::type;
+
+/// Maps a key to an unsigned integer with the same ordering, so that keys of
+/// any dtype can be radix sorted digit by digit.
+template <typename scalar_t>
+static inline RadixBits<scalar_t> ToRadixBits(scalar_t value) {
+    using bits_t = RadixBits<scalar_t>;
+    constexpr bits_t kSignBit = bits_t(bits_t(1) << (sizeof(bits_t) * 8 - 1));
+    if (std::is_floating_point<scalar_t>::value && value == scalar_t(0)) {
+        // -0 and +0 compare equal, keep them in input order.
+        value = scalar_t(0);
+    }
+    bits_t bits;
+    std::memcpy(&bits, &value, sizeof(bits_t));
+    if (std::is_floating_point<scalar_t>::value) {
+        // Negative floats order reversed by magnitude: flip all bits.
+        return (bits & kSignBit) ? bits_t(~bits) : bits_t(bits | kSignBit);
+    } else if (std::is_signed<scalar_t>::value) {
+        return bits_t(bits ^ kSignBit);
+    } else {
+        return bits;
+    }
+}
+
+/// Stable LSD radix sort of (keys, values) pairs with 8-bit digits. Each pass
+/// builds per-block digit histograms in parallel, and scatters the blocks in
+/// parallel to the offsets given by the digit-major prefix sum of the
+/// histograms. Passes where all keys share the same digit are skipped.
+template <typename bits_t>
+static void RadixSortPairs(std::vector<bits_t>& keys,
+                           std::vector<int64_t>& values) {
+    constexpr int kDigitBits = 8;
+    constexpr int64_t kNumDigits = int64_t(1) << kDigitBits;
+    const int64_t n = static_cast<int64_t>(keys.size());
+    const int64_t num_blocks = GetNumBlocks(n);
+    const int64_t block_size = (n + num_blocks - 1) / num_blocks;
+
+    std::vector<bits_t> keys_alt(n);
+    std::vector<int64_t> values_alt(n);
+    std::vector<int64_t> offsets(num_blocks * kNumDigits);
+    for (int shift = 0; shift < static_cast<int>(sizeof(bits_t)) * 8;
+         shift += kDigitBits) {
+        std::fill(offsets.begin(), offsets.end(), 0);
+#pragma omp parallel for schedule(static) if (num_blocks > 1) num_threads(utility::EstimateMaxThreads())
+        for (int64_t block_idx = 0; block_idx < num_blocks; ++block_idx) {
+            int64_t* histogram = offsets.data() + block_idx * kNumDigits;
+            const int64_t end = std::min((block_idx + 1) * block_size, n);
+            for (int64_t i = block_idx * block_size; i < end; ++i) {
+                ++histogram[(keys[i] >> shift) & (kNumDigits - 1)];
+            }
+        }
+
+        int64_t offset = 0;
+        bool is_trivial_pass = false;
+        for (int64_t digit = 0; digit < kNumDigits; ++digit) {
+            int64_t digit_count = 0;
+            for (int64_t block_idx = 0; block_idx < num_blocks; ++block_idx) {
+                int64_t& block_offset = offsets[block_idx * kNumDigits + digit];
+                const int64_t count = block_offset;
+                block_offset = offset;
+                offset += count;
+                digit_count += count;
+            }
+            if (digit_count == n) {
+                is_trivial_pass = true;
+                break;
+            }
+        }
+        if (is_trivial_pass) {
+            continue;
+        }
+
+#pragma omp parallel for schedule(static) if (num_blocks > 1) num_threads(utility::EstimateMaxThreads())
+        for (int64_t block_idx = 0; block_idx < num_blocks; ++block_idx) {
+            int64_t* block_offsets = offsets.data() + block_idx * kNumDigits;
+            const int64_t end = std::min((block_idx + 1) * block_size, n);
+            for (int64_t i = block_idx * block_size; i < end; ++i) {
+                const int64_t dst_idx =
+                        block_offsets[(keys[i] >> shift) & (kNumDigits - 1)]++;
+                keys_alt[dst_idx] = keys[i];
+                values_alt[dst_idx] = values[i];
+            }
+        }
+        keys.swap(keys_alt);
+        values.swap(values_alt);
+    }
+}
+
+template <typename scalar_t>
+static void ArgSortCPUKernel(const Tensor& keys,
+                             Tensor& sorted_keys,
+                             Tensor& indices) {
+    const int64_t n = keys.GetLength();
+    const scalar_t* keys_ptr = static_cast<const scalar_t*>(keys.GetDataPtr());
+    std::vector<RadixBits<scalar_t>> radix_keys(n);
+    std::vector<int64_t> order(n);
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < n; ++i) {
+        radix_keys[i] = ToRadixBits(keys_ptr[i]);
+        order[i] = i;
+    }
+
+    RadixSortPairs(radix_keys, order);
+
+    scalar_t* sorted_keys_ptr =
+            static_cast<scalar_t*>(sorted_keys.GetDataPtr());
+    int64_t* indices_ptr = static_cast<int64_t*>(indices.GetDataPtr());
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < n; ++i) {
+        indices_ptr[i] = order[i];
+        sorted_keys_ptr[i] = keys_ptr[order[i]];
+    }
+}
+
+void ArgSortCPU(const Tensor& keys, Tensor& sorted_keys, Tensor& indices) {
+    const int64_t n = keys.GetLength();
+    sorted_keys = Tensor({n}, keys.GetDtype(), keys.GetDevice());
+    indices = Tensor({n}, Dtype::Int64, keys.GetDevice());
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(keys.GetDtype(), [&]() {
+        ArgSortCPUKernel<scalar_t>(keys, sorted_keys, indices);
+    });
+}
+
+template <typename scalar_t>
+static void RunLengthEncodeCPUKernel(const Tensor& sorted_keys,
+                                     Tensor& unique_keys,
+                                     Tensor& segment_ids,
+                                     Tensor& segment_splits) {
+    const int64_t n = sorted_keys.GetLength();
+    const scalar_t* keys_ptr =
+            static_cast<const scalar_t*>(sorted_keys.GetDataPtr());
+    auto is_segment_start = [keys_ptr](int64_t i) {
+        return i == 0 || keys_ptr[i] != keys_ptr[i - 1];
+    };
+
+    // Count the segment starts of each block, then an exclusive prefix sum
+    // gives the id of the first segment starting in each block.
+    const int64_t num_blocks = GetNumBlocks(n);
+    const int64_t block_size = (n + num_blocks - 1) / num_blocks;
+    std::vector<int64_t> block_offsets(num_blocks + 1, 0);
+#pragma omp parallel for schedule(static) if (num_blocks > 1) num_threads(utility::EstimateMaxThreads())
+    for (int64_t block_idx = 0; block_idx < num_blocks; ++block_idx) {
+        const int64_t end = std::min((block_idx + 1) * block_size, n);
+        int64_t count = 0;
+        for (int64_t i = block_idx * block_size; i < end; ++i) {
+            count += is_segment_start(i);
+        }
+        block_offsets[block_idx + 1] = count;
+    }
+    std::partial_sum(block_offsets.begin(), block_offsets.end(),
+                     block_offsets.begin());
+
+    const int64_t num_segments = block_offsets.back();
+    unique_keys = Tensor({num_segments}, sorted_keys.GetDtype(),
+                         sorted_keys.GetDevice());
+    segment_ids = Tensor({n}, Dtype::Int64, sorted_keys.GetDevice());
+    segment_splits =
+            Tensor({num_segments + 1}, Dtype::Int64, sorted_keys.GetDevice());
+    scalar_t* unique_keys_ptr =
+            static_cast<scalar_t*>(unique_keys.GetDataPtr());
+    int64_t* segment_ids_ptr = static_cast<int64_t*>(segment_ids.GetDataPtr());
+    int64_t* segment_splits_ptr =
+            static_cast<int64_t*>(segment_splits.GetDataPtr());
+#pragma omp parallel for schedule(static) if (num_blocks > 1) num_threads(utility::EstimateMaxThreads())
+    for (int64_t block_idx = 0; block_idx < num_blocks; ++block_idx) {
+        const int64_t end = std::min((block_idx + 1) * block_size, n);
+        int64_t segment_id = block_offsets[block_idx] - 1;
+        for (int64_t i = block_idx * block_size; i < end; ++i) {
+            if (is_segment_start(i)) {
+                ++segment_id;
+                unique_keys_ptr[segment_id] = keys_ptr[i];
+                segment_splits_ptr[segment_id] = i;
+            }
+            segment_ids_ptr[i] = segment_id;
+        }
+    }
+    segment_splits_ptr[num_segments] = n;
+}
+
+void RunLengthEncodeCPU(const Tensor& sorted_keys,
+                        Tensor& unique_keys,
+                        Tensor& segment_ids,
+                        Tensor& segment_splits) {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(sorted_keys.GetDtype(), [&]() {
+        RunLengthEncodeCPUKernel<scalar_t>(sorted_keys, unique_keys,
+                                           segment_ids, segment_splits);
+    });
+}
+
+template <typename scalar_t, typename func_t>
+static void LaunchSegmentedReduceCPUKernel(const Tensor& values,
+                                           const Tensor& segment_splits,
+                                           Tensor& dst,
+                                           scalar_t identity,
+                                           func_t reduce_func) {
+    const int64_t num_segments = segment_splits.GetLength() - 1;
+    const int64_t num_columns = values.GetShape()[1];
+    const scalar_t* values_ptr =
+            static_cast<const scalar_t*>(values.GetDataPtr());
+    const int64_t* splits_ptr =
+            static_cast<const int64_t*>(segment_splits.GetDataPtr());
+    scalar_t* dst_ptr = static_cast<scalar_t*>(dst.GetDataPtr());
+
+    // Segment sizes are arbitrary, hence the dynamic schedule.
+    ParallelFor(
+            num_segments,
+            [&](int64_t segment_idx) {
+                scalar_t* acc = dst_ptr + segment_idx * num_columns;
+                std::fill(acc, acc + num_columns, identity);
+                for (int64_t row = splits_ptr[segment_idx];
+                     row < splits_ptr[segment_idx + 1]; ++row) {
+                    const scalar_t* src = values_ptr + row * num_columns;
+                    for (int64_t col = 0; col < num_columns; ++col) {
+                        acc[col] = reduce_func(acc[col], src[col]);
+                    }
+                }
+            },
+            ParallelSchedule::Dynamic());
+}
+
+void SegmentedReduceCPU(const Tensor& values,
+                        const Tensor& segment_splits,
+                        Tensor& dst,
+                        ReductionOpCode op_code) {
+    DISPATCH_DTYPE_TO_TEMPLATE(values.GetDtype(), [&]() {
+        switch (op_code) {
+            case ReductionOpCode::Sum:
+                LaunchSegmentedReduceCPUKernel<scalar_t>(
+                        values, segment_splits, dst, 0,
+                        [](scalar_t a, scalar_t b) { return a + b; });
+                break;
+            case ReductionOpCode::Prod:
+                LaunchSegmentedReduceCPUKernel<scalar_t>(
+                        values, segment_splits, dst, 1,
+                        [](scalar_t a, scalar_t b) { return a * b; });
+                break;
+            case ReductionOpCode::Min:
+                LaunchSegmentedReduceCPUKernel<scalar_t>(
+                        values, segment_splits, dst,
+                        std::numeric_limits<scalar_t>::max(),
+                        [](scalar_t a, scalar_t b) { return a < b ? a : b; });
+                break;
+            case ReductionOpCode::Max:
+                LaunchSegmentedReduceCPUKernel<scalar_t>(
+                        values, segment_splits, dst,
+                        std::numeric_limits<scalar_t>::lowest(),
+                        [](scalar_t a, scalar_t b) { return a > b ? a : b; });
+                break;
+            default:
+                utility::LogError("Unsupported op code.");
+                break;
+        }
+    });
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,276 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cub/cub.cuh>
+#include <limits>
+
+#include "open3d/core/CUDAState.cuh"
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/Sort.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+static constexpr int kThreadsPerBlock = 256;
+
+static int GetNumBlocks(int64_t n) {
+    return static_cast<int>(std::min<int64_t>(
+            (n + kThreadsPerBlock - 1) / kThreadsPerBlock, 65535));
+}
+
+template <typename scalar_t>
+static void ArgSortCUDAKernel(const Tensor& keys,
+                              Tensor& sorted_keys,
+                              Tensor& indices) {
+    const int64_t n = keys.GetLength();
+    const Device device = keys.GetDevice();
+    Tensor order = Tensor::Arange(0, n, 1, Dtype::Int64, device);
+    const scalar_t* keys_ptr = static_cast<const scalar_t*>(keys.GetDataPtr());
+    scalar_t* sorted_keys_ptr =
+            static_cast<scalar_t*>(sorted_keys.GetDataPtr());
+    const int64_t* order_ptr = static_cast<const int64_t*>(order.GetDataPtr());
+    int64_t* indices_ptr = static_cast<int64_t*>(indices.GetDataPtr());
+
+    size_t temp_bytes = 0;
+    OPEN3D_CUDA_CHECK(cub::DeviceRadixSort::SortPairs(
+            nullptr, temp_bytes, keys_ptr, sorted_keys_ptr, order_ptr,
+            indices_ptr, static_cast<int>(n)));
+    Tensor temp({static_cast<int64_t>(temp_bytes)}, Dtype::UInt8, device);
+    OPEN3D_CUDA_CHECK(cub::DeviceRadixSort::SortPairs(
+            temp.GetDataPtr(), temp_bytes, keys_ptr, sorted_keys_ptr,
+            order_ptr, indices_ptr, static_cast<int>(n)));
+}
+
+void ArgSortCUDA(const Tensor& keys, Tensor& sorted_keys, Tensor& indices) {
+    CUDADeviceSwitcher switcher(keys.GetDevice());
+    const int64_t n = keys.GetLength();
+    sorted_keys = Tensor({n}, keys.GetDtype(), keys.GetDevice());
+    indices = Tensor({n}, Dtype::Int64, keys.GetDevice());
+    if (n == 0) {
+        return;
+    }
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(keys.GetDtype(), [&]() {
+        ArgSortCUDAKernel<scalar_t>(keys, sorted_keys, indices);
+    });
+}
+
+template <typename scalar_t>
+__global__ void SegmentStartsKernel(const scalar_t* keys,
+                                    int64_t n,
+                                    int64_t* segment_starts) {
+    for (int64_t i = blockIdx.x * int64_t(blockDim.x) + threadIdx.x; i < n;
+         i += int64_t(blockDim.x) * gridDim.x) {
+        segment_starts[i] = (i == 0 || keys[i] != keys[i - 1]) ? 1 : 0;
+    }
+}
+
+/// \p segment_ids holds the inclusive prefix sum of the segment starts, and
+/// is turned into 0-based ids.
+template <typename scalar_t>
+__global__ void ScatterSegmentsKernel(const scalar_t* keys,
+                                      int64_t n,
+                                      const int64_t* segment_starts,
+                                      int64_t* segment_ids,
+                                      scalar_t* unique_keys,
+                                      int64_t* segment_splits) {
+    for (int64_t i = blockIdx.x * int64_t(blockDim.x) + threadIdx.x; i < n;
+         i += int64_t(blockDim.x) * gridDim.x) {
+        const int64_t segment_id = segment_ids[i] - 1;
+        if (segment_starts[i]) {
+            unique_keys[segment_id] = keys[i];
+            segment_splits[segment_id] = i;
+        }
+        segment_ids[i] = segment_id;
+    }
+}
+
+template <typename scalar_t>
+static void RunLengthEncodeCUDAKernel(const Tensor& sorted_keys,
+                                      Tensor& unique_keys,
+                                      Tensor& segment_ids,
+                                      Tensor& segment_splits) {
+    const int64_t n = sorted_keys.GetLength();
+    const Device device = sorted_keys.GetDevice();
+    const scalar_t* keys_ptr =
+            static_cast<const scalar_t*>(sorted_keys.GetDataPtr());
+
+    Tensor segment_starts({n}, Dtype::Int64, device);
+    int64_t* segment_starts_ptr =
+            static_cast<int64_t*>(segment_starts.GetDataPtr());
+    int64_t* segment_ids_ptr = static_cast<int64_t*>(segment_ids.GetDataPtr());
+    SegmentStartsKernel<<<GetNumBlocks(n), kThreadsPerBlock>>>(
+            keys_ptr, n, segment_starts_ptr);
+    OPEN3D_CUDA_CHECK(cudaGetLastError());
+
+    size_t temp_bytes = 0;
+    OPEN3D_CUDA_CHECK(cub::DeviceScan::InclusiveSum(
+            nullptr, temp_bytes, segment_starts_ptr, segment_ids_ptr,
+            static_cast<int>(n)));
+    Tensor temp({static_cast<int64_t>(temp_bytes)}, Dtype::UInt8, device);
+    OPEN3D_CUDA_CHECK(cub::DeviceScan::InclusiveSum(
+            temp.GetDataPtr(), temp_bytes, segment_starts_ptr,
+            segment_ids_ptr, static_cast<int>(n)));
+
+    const int64_t num_segments = segment_ids[n - 1].Item<int64_t>();
+    unique_keys = Tensor({num_segments}, sorted_keys.GetDtype(), device);
+    segment_splits = Tensor({num_segments + 1}, Dtype::Int64, device);
+    ScatterSegmentsKernel<<<GetNumBlocks(n), kThreadsPerBlock>>>(
+            keys_ptr, n, segment_starts_ptr, segment_ids_ptr,
+            static_cast<scalar_t*>(unique_keys.GetDataPtr()),
+            static_cast<int64_t*>(segment_splits.GetDataPtr()));
+    OPEN3D_CUDA_CHECK(cudaGetLastError());
+    segment_splits[num_segments] = n;
+}
+
+void RunLengthEncodeCUDA(const Tensor& sorted_keys,
+                         Tensor& unique_keys,
+                         Tensor& segment_ids,
+                         Tensor& segment_splits) {
+    CUDADeviceSwitcher switcher(sorted_keys.GetDevice());
+    const int64_t n = sorted_keys.GetLength();
+    const Device device = sorted_keys.GetDevice();
+    segment_ids = Tensor({n}, Dtype::Int64, device);
+    if (n == 0) {
+        unique_keys = Tensor({0}, sorted_keys.GetDtype(), device);
+        segment_splits = Tensor::Zeros({1}, Dtype::Int64, device);
+        return;
+    }
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(sorted_keys.GetDtype(), [&]() {
+        RunLengthEncodeCUDAKernel<scalar_t>(sorted_keys, unique_keys,
+                                            segment_ids, segment_splits);
+    });
+}
+
+struct SumOp {
+    template <typename scalar_t>
+    __device__ scalar_t operator()(scalar_t a, scalar_t b) const {
+        return a + b;
+    }
+};
+
+struct ProdOp {
+    template <typename scalar_t>
+    __device__ scalar_t operator()(scalar_t a, scalar_t b) const {
+        return a * b;
+    }
+};
+
+struct MinOp {
+    template <typename scalar_t>
+    __device__ scalar_t operator()(scalar_t a, scalar_t b) const {
+        return a < b ? a : b;
+    }
+};
+
+struct MaxOp {
+    template <typename scalar_t>
+    __device__ scalar_t operator()(scalar_t a, scalar_t b) const {
+        return a > b ? a : b;
+    }
+};
+
+/// One thread per output element, looping over the rows of its segment.
+template <typename scalar_t, typename op_t>
+__global__ void SegmentedReduceKernel(const scalar_t* values,
+                                      const int64_t* segment_splits,
+                                      int64_t num_segments,
+                                      int64_t num_columns,
+                                      scalar_t identity,
+                                      op_t op,
+                                      scalar_t* dst) {
+    const int64_t num_outputs = num_segments * num_columns;
+    for (int64_t i = blockIdx.x * int64_t(blockDim.x) + threadIdx.x;
+         i < num_outputs; i += int64_t(blockDim.x) * gridDim.x) {
+        const int64_t segment_idx = i / num_columns;
+        const int64_t col = i - segment_idx * num_columns;
+        scalar_t acc = identity;
+        for (int64_t row = segment_splits[segment_idx];
+             row < segment_splits[segment_idx + 1]; ++row) {
+            acc = op(acc, values[row * num_columns + col]);
+        }
+        dst[i] = acc;
+    }
+}
+
+template <typename scalar_t, typename op_t>
+static void LaunchSegmentedReduceCUDAKernel(const Tensor& values,
+                                            const Tensor& segment_splits,
+                                            Tensor& dst,
+                                            scalar_t identity,
+                                            op_t op) {
+    const int64_t num_segments = segment_splits.GetLength() - 1;
+    const int64_t num_columns = values.GetShape()[1];
+    const int64_t num_outputs = num_segments * num_columns;
+    if (num_outputs == 0) {
+        return;
+    }
+    SegmentedReduceKernel<<<GetNumBlocks(num_outputs), kThreadsPerBlock>>>(
+            static_cast<const scalar_t*>(values.GetDataPtr()),
+            static_cast<const int64_t*>(segment_splits.GetDataPtr()),
+            num_segments, num_columns, identity, op,
+            static_cast<scalar_t*>(dst.GetDataPtr()));
+    OPEN3D_CUDA_CHECK(cudaGetLastError());
+}
+
+void SegmentedReduceCUDA(const Tensor& values,
+                         const Tensor& segment_splits,
+                         Tensor& dst,
+                         ReductionOpCode op_code) {
+    CUDADeviceSwitcher switcher(values.GetDevice());
+    DISPATCH_DTYPE_TO_TEMPLATE(values.GetDtype(), [&]() {
+        switch (op_code) {
+            case ReductionOpCode::Sum:
+                LaunchSegmentedReduceCUDAKernel<scalar_t>(
+                        values, segment_splits, dst, 0, SumOp());
+                break;
+            case ReductionOpCode::Prod:
+                LaunchSegmentedReduceCUDAKernel<scalar_t>(
+                        values, segment_splits, dst, 1, ProdOp());
+                break;
+            case ReductionOpCode::Min:
+                LaunchSegmentedReduceCUDAKernel<scalar_t>(
+                        values, segment_splits, dst,
+                        std::numeric_limits<scalar_t>::max(), MinOp());
+                break;
+            case ReductionOpCode::Max:
+                LaunchSegmentedReduceCUDAKernel<scalar_t>(
+                        values, segment_splits, dst,
+                        std::numeric_limits<scalar_t>::lowest(), MaxOp());
+                break;
+            default:
+                utility::LogError("Unsupported op code.");
+                break;
+        }
+    });
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
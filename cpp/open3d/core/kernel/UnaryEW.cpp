@@ -26,6 +26,7 @@
 
 #include "open3d/core/kernel/UnaryEW.h"
 
+#include "open3d/core/CUDAUtils.h"
 #include "open3d/core/ShapeUtil.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/utility/Console.h"
@@ -49,10 +50,12 @@ void UnaryEW(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
                           src_device.ToString(), dst_device.ToString());
     }
 
+    OPEN3D_TRACE_SCOPE("core::UnaryEW");
     if (src_device.GetType() == Device::DeviceType::CPU) {
         UnaryEWCPU(src, dst, op_code);
     } else if (src_device.GetType() == Device::DeviceType::CUDA) {
 #ifdef BUILD_CUDA_MODULE
+        OPEN3D_TRACE_CUDA_SCOPE("core::UnaryEW");
         UnaryEWCUDA(src, dst, op_code);
 #else
         utility::LogError("Not compiled with CUDA, but CUDA device is used.");
@@ -78,11 +81,13 @@ void Copy(const Tensor& src, Tensor& dst) {
          dst_device_type != Device::DeviceType::CUDA)) {
         utility::LogError("Copy: Unimplemented device");
     }
+    OPEN3D_TRACE_SCOPE("core::Copy");
     if (src_device_type == Device::DeviceType::CPU &&
         dst_device_type == Device::DeviceType::CPU) {
         CopyCPU(src, dst);
     } else {
 #ifdef BUILD_CUDA_MODULE
+        OPEN3D_TRACE_CUDA_SCOPE("core::Copy");
         CopyCUDA(src, dst);
 #else
         utility::LogError("Not compiled with CUDA, but CUDA device is used.");
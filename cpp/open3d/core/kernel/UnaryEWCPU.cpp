@@ -33,6 +33,7 @@
 #include "open3d/core/SizeVector.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/core/kernel/CPULauncher.h"
+#include "open3d/core/kernel/CPUVectorized.h"
 #include "open3d/core/kernel/UnaryEW.h"
 #include "open3d/utility/Console.h"
 
@@ -140,33 +141,41 @@ void CopyCPU(const Tensor& src, Tensor& dst) {
                     });
 
         } else {
-            DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src_dtype, [&]() {
+            DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_FLOAT16(src_dtype, [&]() {
                 using src_t = scalar_t;
-                DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dst_dtype, [&]() {
-                    using dst_t = scalar_t;
-                    CPULauncher::LaunchUnaryEWKernel(
-                            indexer, CPUCopyElementKernel<src_t, dst_t>);
-                });
+                DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_FLOAT16(
+                        dst_dtype, [&]() {
+                            using dst_t = scalar_t;
+                            CPULauncher::LaunchUnaryEWKernel(
+                                    indexer,
+                                    CPUCopyElementKernel<src_t, dst_t>);
+                        });
             });
         }
     }
 }
 
 void UnaryEWCPU(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
+    if (TryUnaryEWContiguousCPU(src, dst, op_code)) {
+        return;
+    }
+
     // src and dst have been chaged to have the same shape, device
     Dtype src_dtype = src.GetDtype();
     Dtype dst_dtype = dst.GetDtype();
 
     auto assert_dtype_is_float = [](Dtype dtype) -> void {
-        if (dtype != Dtype::Float32 && dtype != Dtype::Float64) {
+        if (dtype != Dtype::Float16 && dtype != Dtype::Float32 &&
+            dtype != Dtype::Float64) {
             utility::LogError(
-                    "Only supports Float32 and Float64, but {} is used.",
+                    "Only supports Float16, Float32 and Float64, but {} is "
+                    "used.",
                     dtype.ToString());
         }
     };
 
     if (op_code == UnaryEWOpCode::LogicalNot) {
-        DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src_dtype, [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_FLOAT16(src_dtype, [&]() {
             if (dst_dtype == src_dtype) {
                 Indexer indexer({src}, dst, DtypePolicy::ALL_SAME);
                 CPULauncher::LaunchUnaryEWKernel(
@@ -185,7 +194,7 @@ void UnaryEWCPU(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
         });
     } else {
         Indexer indexer({src}, dst, DtypePolicy::ALL_SAME);
-        DISPATCH_DTYPE_TO_TEMPLATE(src_dtype, [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_FLOAT16(src_dtype, [&]() {
             switch (op_code) {
                 case UnaryEWOpCode::Sqrt:
                     assert_dtype_is_float(src_dtype);
@@ -162,20 +162,25 @@ void CopyCUDA(const Tensor& src, Tensor& dst) {
                         });
 
             } else {
-                DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src_dtype, [&]() {
-                    using src_t = scalar_t;
-                    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dst_dtype, [&]() {
-                        using dst_t = scalar_t;
-                        CUDALauncher::LaunchUnaryEWKernel(
-                                indexer,
-                                // Need to wrap as extended CUDA lambda function
-                                [] OPEN3D_HOST_DEVICE(const void* src,
-                                                      void* dst) {
-                                    CUDACopyElementKernel<src_t, dst_t>(src,
-                                                                        dst);
-                                });
-                    });
-                });
+                DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_FLOAT16(
+                        src_dtype, [&]() {
+                            using src_t = scalar_t;
+                            DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_FLOAT16(
+                                    dst_dtype, [&]() {
+                                        using dst_t = scalar_t;
+                                        // Need to wrap as extended CUDA lambda
+                                        // function
+                                        CUDALauncher::LaunchUnaryEWKernel(
+                                                indexer,
+                                                [] OPEN3D_HOST_DEVICE(
+                                                        const void* src,
+                                                        void* dst) {
+                                                    CUDACopyElementKernel<
+                                                            src_t, dst_t>(src,
+                                                                          dst);
+                                                });
+                                    });
+                        });
             }
         } else {
             dst.CopyFrom(src.Contiguous().Copy(dst_device));
@@ -205,15 +210,17 @@ void UnaryEWCUDA(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
     Dtype dst_dtype = dst.GetDtype();
 
     auto assert_dtype_is_float = [](Dtype dtype) -> void {
-        if (dtype != Dtype::Float32 && dtype != Dtype::Float64) {
+        if (dtype != Dtype::Float16 && dtype != Dtype::Float32 &&
+            dtype != Dtype::Float64) {
             utility::LogError(
-                    "Only supports Float32 and Float64, but {} is used.",
+                    "Only supports Float16, Float32 and Float64, but {} is "
+                    "used.",
                     dtype.ToString());
         }
     };
 
     if (op_code == UnaryEWOpCode::LogicalNot) {
-        DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src_dtype, [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_FLOAT16(src_dtype, [&]() {
             if (dst_dtype == src_dtype) {
                 Indexer indexer({src}, dst, DtypePolicy::ALL_SAME);
                 CUDALauncher::LaunchUnaryEWKernel(
@@ -239,7 +246,7 @@ void UnaryEWCUDA(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
         });
     } else {
         Indexer indexer({src}, dst, DtypePolicy::ALL_SAME);
-        DISPATCH_DTYPE_TO_TEMPLATE(src_dtype, [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_FLOAT16(src_dtype, [&]() {
             switch (op_code) {
                 case UnaryEWOpCode::Sqrt:
                     assert_dtype_is_float(src_dtype);
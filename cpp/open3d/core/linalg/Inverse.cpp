@@ -33,6 +33,57 @@
 namespace open3d {
 namespace core {
 
+static Dtype GetCPUIpivDtype() {
+    if (sizeof(OPEN3D_CPU_LINALG_INT) == 4) {
+        return Dtype::Int32;
+    } else if (sizeof(OPEN3D_CPU_LINALG_INT) == 8) {
+        return Dtype::Int64;
+    } else {
+        utility::LogError("Unsupported OPEN3D_CPU_LINALG_INT type.");
+    }
+}
+
+/// Inverts a (batch_size, n, n) tensor. A row-major matrix has the memory
+/// layout of its transpose in column-major order, and inv(A^T) = inv(A)^T, so
+/// the contiguous batch is inverted directly without transposes.
+static void InverseBatched(const Tensor &A, Tensor &output) {
+    Device device = A.GetDevice();
+    Dtype dtype = A.GetDtype();
+    SizeVector A_shape = A.GetShape();
+    if (A_shape[1] != A_shape[2]) {
+        utility::LogError("Tensor A must be a batch of square matrices, but got "
+                          "{} x {}.",
+                          A_shape[1], A_shape[2]);
+    }
+
+    int64_t batch_size = A_shape[0];
+    int64_t n = A_shape[1];
+    if (n == 0) {
+        utility::LogError(
+                "Tensor shapes should not contain dimensions with zero.");
+    }
+    if (batch_size == 0) {
+        output = Tensor::Empty(A_shape, dtype, device);
+        return;
+    }
+
+    if (device.GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        Tensor A_copy = A.Copy(device);
+        output = Tensor::Empty(A_shape, dtype, device);
+        InverseBatchedCUDA(A_copy.GetDataPtr(), output.GetDataPtr(),
+                           batch_size, n, dtype, device);
+#else
+        utility::LogError("Unimplemented device.");
+#endif
+    } else {
+        Tensor ipiv = Tensor::Empty({batch_size, n}, GetCPUIpivDtype(), device);
+        output = A.Copy(device);
+        InverseBatchedCPU(output.GetDataPtr(), ipiv.GetDataPtr(), batch_size,
+                          n, dtype, device);
+    }
+}
+
 void Inverse(const Tensor &A, Tensor &output) {
     // Check devices
     Device device = A.GetDevice();
@@ -48,8 +99,13 @@ void Inverse(const Tensor &A, Tensor &output) {
 
     // Check dimensions
     SizeVector A_shape = A.GetShape();
+    if (A_shape.size() == 3) {
+        InverseBatched(A, output);
+        return;
+    }
     if (A_shape.size() != 2) {
-        utility::LogError("Tensor A must be 2D, but got {}D.", A_shape.size());
+        utility::LogError("Tensor A must be 2D or 3D, but got {}D.",
+                          A_shape.size());
     }
     if (A_shape[0] != A_shape[1]) {
         utility::LogError("Tensor A must be square, but got {} x {}.",
@@ -81,15 +137,7 @@ void Inverse(const Tensor &A, Tensor &output) {
         utility::LogError("Unimplemented device.");
 #endif
     } else {
-        Dtype ipiv_dtype;
-        if (sizeof(OPEN3D_CPU_LINALG_INT) == 4) {
-            ipiv_dtype = Dtype::Int32;
-        } else if (sizeof(OPEN3D_CPU_LINALG_INT) == 8) {
-            ipiv_dtype = Dtype::Int64;
-        } else {
-            utility::LogError("Unsupported OPEN3D_CPU_LINALG_INT type.");
-        }
-        Tensor ipiv = Tensor::Empty({n}, ipiv_dtype, device);
+        Tensor ipiv = Tensor::Empty({n}, GetCPUIpivDtype(), device);
         void *ipiv_data = ipiv.GetDataPtr();
 
         // LAPACKE supports getri, A is in-place modified as output.
@@ -32,6 +32,8 @@ namespace open3d {
 namespace core {
 
 /// Computes A^{-1} with LU factorization, where A is a N x N square matrix.
+/// A can also be a (batch_size, N, N) batch of matrices, which are inverted
+/// independently.
 void Inverse(const Tensor& A, Tensor& output);
 
 void InverseCPU(void* A_data,
@@ -41,6 +43,14 @@ void InverseCPU(void* A_data,
                 Dtype dtype,
                 const Device& device);
 
+/// Inverts the contiguous batch of n x n matrices in A_data in-place.
+void InverseBatchedCPU(void* A_data,
+                       void* ipiv_data,
+                       int64_t batch_size,
+                       int64_t n,
+                       Dtype dtype,
+                       const Device& device);
+
 #ifdef BUILD_CUDA_MODULE
 void InverseCUDA(void* A_data,
                  void* ipiv_data,
@@ -48,6 +58,15 @@ void InverseCUDA(void* A_data,
                  int64_t n,
                  Dtype dtype,
                  const Device& device);
+
+/// Writes the inverses of the contiguous batch of n x n matrices in A_data to
+/// output_data. A_data is overwritten by the LU factorizations.
+void InverseBatchedCUDA(void* A_data,
+                        void* output_data,
+                        int64_t batch_size,
+                        int64_t n,
+                        Dtype dtype,
+                        const Device& device);
 #endif
 
 }  // namespace core
@@ -51,5 +51,31 @@ void InverseCPU(void* A_data,
     });
 }
 
+void InverseBatchedCPU(void* A_data,
+                       void* ipiv_data,
+                       int64_t batch_size,
+                       int64_t n,
+                       Dtype dtype,
+                       const Device& device) {
+    DISPATCH_LINALG_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        scalar_t* A = static_cast<scalar_t*>(A_data);
+        OPEN3D_CPU_LINALG_INT* ipiv =
+                static_cast<OPEN3D_CPU_LINALG_INT*>(ipiv_data);
+        ParallelForBatchLAPACK(
+                batch_size, "getrf/getri failed in InverseBatchedCPU",
+                [&](int64_t i) {
+                    scalar_t* A_i = A + i * n * n;
+                    OPEN3D_CPU_LINALG_INT* ipiv_i = ipiv + i * n;
+                    OPEN3D_CPU_LINALG_INT info = getrf_cpu<scalar_t>(
+                            LAPACK_COL_MAJOR, n, n, A_i, n, ipiv_i);
+                    if (info == 0) {
+                        info = getri_cpu<scalar_t>(LAPACK_COL_MAJOR, n, A_i,
+                                                   n, ipiv_i);
+                    }
+                    return info;
+                });
+    });
+}
+
 }  // namespace core
 }  // namespace open3d
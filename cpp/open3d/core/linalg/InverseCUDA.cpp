@@ -24,6 +24,7 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/core/linalg/BlasWrapper.h"
 #include "open3d/core/linalg/Inverse.h"
 #include "open3d/core/linalg/LapackWrapper.h"
 #include "open3d/core/linalg/LinalgUtils.h"
@@ -69,5 +70,45 @@ void InverseCUDA(void* A_data,
     });
 }
 
+void InverseBatchedCUDA(void* A_data,
+                        void* output_data,
+                        int64_t batch_size,
+                        int64_t n,
+                        Dtype dtype,
+                        const Device& device) {
+    cublasHandle_t handle = CuBLASContext::GetInstance()->GetHandle();
+
+    DISPATCH_LINALG_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        scalar_t** A_array = CreateBatchedPointers<scalar_t>(
+                A_data, batch_size, n * n, device);
+        scalar_t** output_array = CreateBatchedPointers<scalar_t>(
+                output_data, batch_size, n * n, device);
+        int* ipiv = static_cast<int*>(
+                MemoryManager::Malloc(batch_size * n * sizeof(int), device));
+        int* dinfo = static_cast<int*>(
+                MemoryManager::Malloc(batch_size * sizeof(int), device));
+
+        OPEN3D_CUBLAS_CHECK(
+                getrf_batched_cuda<scalar_t>(handle, n, A_array, n, ipiv, dinfo,
+                                             batch_size),
+                "getrf_batched failed in InverseBatchedCUDA");
+        OPEN3D_CHECK_BATCHED_DINFO("getrf_batched failed in InverseBatchedCUDA",
+                                   dinfo, batch_size, device);
+
+        OPEN3D_CUBLAS_CHECK(
+                getri_batched_cuda<scalar_t>(handle, n, A_array, n, ipiv,
+                                             output_array, n, dinfo,
+                                             batch_size),
+                "getri_batched failed in InverseBatchedCUDA");
+        OPEN3D_CHECK_BATCHED_DINFO("getri_batched failed in InverseBatchedCUDA",
+                                   dinfo, batch_size, device);
+
+        MemoryManager::Free(A_array, device);
+        MemoryManager::Free(output_array, device);
+        MemoryManager::Free(ipiv, device);
+        MemoryManager::Free(dinfo, device);
+    });
+}
+
 }  // namespace core
 }  // namespace open3d
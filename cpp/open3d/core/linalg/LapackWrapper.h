@@ -345,6 +345,47 @@ inline cusolverStatus_t gesvd_cuda(cusolverDnHandle_t handle,
     return CUSOLVER_STATUS_INTERNAL_ERROR;
 }
 
+template <typename scalar_t>
+inline cusolverStatus_t gesvdj_batched_cuda_buffersize(
+        cusolverDnHandle_t handle,
+        cusolverEigMode_t jobz,
+        int m,
+        int n,
+        const scalar_t* A,
+        int lda,
+        const scalar_t* S,
+        const scalar_t* U,
+        int ldu,
+        const scalar_t* V,
+        int ldv,
+        int* len,
+        gesvdjInfo_t params,
+        int batch_size) {
+    utility::LogError("Unsupported data type.");
+    return CUSOLVER_STATUS_INTERNAL_ERROR;
+}
+
+template <typename scalar_t>
+inline cusolverStatus_t gesvdj_batched_cuda(cusolverDnHandle_t handle,
+                                            cusolverEigMode_t jobz,
+                                            int m,
+                                            int n,
+                                            scalar_t* A,
+                                            int lda,
+                                            scalar_t* S,
+                                            scalar_t* U,
+                                            int ldu,
+                                            scalar_t* V,
+                                            int ldv,
+                                            scalar_t* workspace,
+                                            int len,
+                                            int* dinfo,
+                                            gesvdjInfo_t params,
+                                            int batch_size) {
+    utility::LogError("Unsupported data type.");
+    return CUSOLVER_STATUS_INTERNAL_ERROR;
+}
+
 template <>
 inline cusolverStatus_t getrf_cuda_buffersize<float>(
         cusolverDnHandle_t handle, int m, int n, int lda, int* len) {
@@ -575,6 +616,91 @@ inline cusolverStatus_t gesvd_cuda<double>(cusolverDnHandle_t handle,
                             ldvt, workspace, len, rwork, dinfo);
 }
 
+template <>
+inline cusolverStatus_t gesvdj_batched_cuda_buffersize<float>(
+        cusolverDnHandle_t handle,
+        cusolverEigMode_t jobz,
+        int m,
+        int n,
+        const float* A,
+        int lda,
+        const float* S,
+        const float* U,
+        int ldu,
+        const float* V,
+        int ldv,
+        int* len,
+        gesvdjInfo_t params,
+        int batch_size) {
+    return cusolverDnSgesvdjBatched_bufferSize(handle, jobz, m, n, A, lda, S,
+                                               U, ldu, V, ldv, len, params,
+                                               batch_size);
+}
+
+template <>
+inline cusolverStatus_t gesvdj_batched_cuda<float>(cusolverDnHandle_t handle,
+                                                   cusolverEigMode_t jobz,
+                                                   int m,
+                                                   int n,
+                                                   float* A,
+                                                   int lda,
+                                                   float* S,
+                                                   float* U,
+                                                   int ldu,
+                                                   float* V,
+                                                   int ldv,
+                                                   float* workspace,
+                                                   int len,
+                                                   int* dinfo,
+                                                   gesvdjInfo_t params,
+                                                   int batch_size) {
+    return cusolverDnSgesvdjBatched(handle, jobz, m, n, A, lda, S, U, ldu, V,
+                                    ldv, workspace, len, dinfo, params,
+                                    batch_size);
+}
+
+template <>
+inline cusolverStatus_t gesvdj_batched_cuda_buffersize<double>(
+        cusolverDnHandle_t handle,
+        cusolverEigMode_t jobz,
+        int m,
+        int n,
+        const double* A,
+        int lda,
+        const double* S,
+        const double* U,
+        int ldu,
+        const double* V,
+        int ldv,
+        int* len,
+        gesvdjInfo_t params,
+        int batch_size) {
+    return cusolverDnDgesvdjBatched_bufferSize(handle, jobz, m, n, A, lda, S,
+                                               U, ldu, V, ldv, len, params,
+                                               batch_size);
+}
+
+template <>
+inline cusolverStatus_t gesvdj_batched_cuda<double>(cusolverDnHandle_t handle,
+                                                    cusolverEigMode_t jobz,
+                                                    int m,
+                                                    int n,
+                                                    double* A,
+                                                    int lda,
+                                                    double* S,
+                                                    double* U,
+                                                    int ldu,
+                                                    double* V,
+                                                    int ldv,
+                                                    double* workspace,
+                                                    int len,
+                                                    int* dinfo,
+                                                    gesvdjInfo_t params,
+                                                    int batch_size) {
+    return cusolverDnDgesvdjBatched(handle, jobz, m, n, A, lda, S, U, ldu, V,
+                                    ldv, workspace, len, dinfo, params,
+                                    batch_size);
+}
 #endif
 }  // namespace core
 }  // namespace open3d
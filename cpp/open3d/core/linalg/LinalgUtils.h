@@ -26,14 +26,17 @@
 
 #pragma once
 
+#include <algorithm>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "open3d/core/Dtype.h"
 #include "open3d/core/MemoryManager.h"
 #include "open3d/core/linalg/LinalgHeadersCPU.h"
 #include "open3d/core/linalg/LinalgHeadersCUDA.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace core {
@@ -60,6 +63,59 @@ inline void OPEN3D_LAPACK_CHECK(OPEN3D_CPU_LINALG_INT info,
     }
 }
 
+/// Runs \p func(i) for each of the \p batch_size matrices of a batched CPU
+/// call. The matrices are processed in parallel with single threaded BLAS and
+/// LAPACK calls, as threaded ones nested in the batch loop would oversubscribe
+/// the cores. A batch run by one thread keeps the threaded calls instead.
+/// OpenMP pragmas cannot be placed in the dispatch macro's arguments, hence
+/// the helper.
+template <typename func_t>
+void ParallelForBatchCPU(int64_t batch_size, func_t func) {
+    int num_threads = static_cast<int>(std::min<int64_t>(
+            utility::EstimateMaxThreads(), batch_size));
+    if (num_threads <= 1) {
+        for (int64_t i = 0; i < batch_size; ++i) {
+            func(i);
+        }
+        return;
+    }
+#if defined(USE_BLAS) && defined(OPENBLAS_VERSION)
+    // OpenBLAS only has a process-wide thread count.
+    int prev_blas_threads = openblas_get_num_threads();
+    openblas_set_num_threads(1);
+#endif
+#pragma omp parallel num_threads(num_threads)
+    {
+#ifndef USE_BLAS
+        int prev_mkl_threads = mkl_set_num_threads_local(1);
+#endif
+#pragma omp for schedule(static)
+        for (int64_t i = 0; i < batch_size; ++i) {
+            func(i);
+        }
+#ifndef USE_BLAS
+        mkl_set_num_threads_local(prev_mkl_threads);
+#endif
+    }
+#if defined(USE_BLAS) && defined(OPENBLAS_VERSION)
+    openblas_set_num_threads(prev_blas_threads);
+#endif
+}
+
+/// ParallelForBatchCPU() for \p func(i) returning the LAPACK info code of
+/// matrix i. Exceptions must not escape the parallel region, so the codes are
+/// checked afterwards.
+template <typename func_t>
+void ParallelForBatchLAPACK(int64_t batch_size,
+                            const std::string& msg,
+                            func_t func) {
+    std::vector<OPEN3D_CPU_LINALG_INT> infos(batch_size, 0);
+    ParallelForBatchCPU(batch_size, [&](int64_t i) { infos[i] = func(i); });
+    for (OPEN3D_CPU_LINALG_INT info : infos) {
+        OPEN3D_LAPACK_CHECK(info, msg);
+    }
+}
+
 #ifdef BUILD_CUDA_MODULE
 inline void OPEN3D_CUBLAS_CHECK(cublasStatus_t status, const std::string& msg) {
     if (CUBLAS_STATUS_SUCCESS != status) {
@@ -91,6 +147,45 @@ inline void OPEN3D_CUSOLVER_CHECK_WITH_DINFO(cusolverStatus_t status,
     }
 }
 
+/// Checks the per-matrix info array \p dinfo of a batched cuBLAS / cuSOLVER
+/// call, with \p batch_size entries on \p device.
+inline void OPEN3D_CHECK_BATCHED_DINFO(const std::string& msg,
+                                       int* dinfo,
+                                       int64_t batch_size,
+                                       const Device& device) {
+    std::vector<int> hinfo(batch_size);
+    MemoryManager::MemcpyToHost(hinfo.data(), dinfo, device,
+                                batch_size * sizeof(int));
+    for (int64_t i = 0; i < batch_size; ++i) {
+        if (hinfo[i] < 0) {
+            utility::LogError("{}: {}-th parameter is invalid.", msg,
+                              -hinfo[i]);
+        } else if (hinfo[i] > 0) {
+            utility::LogError("{}: singular condition detected in matrix {}.",
+                              msg, i);
+        }
+    }
+}
+
+/// Returns a device array with the pointers to the \p batch_size matrices of
+/// \p stride elements each in \p data, as taken by the batched cuBLAS
+/// routines. The array must be freed with MemoryManager::Free.
+template <typename scalar_t>
+inline scalar_t** CreateBatchedPointers(void* data,
+                                        int64_t batch_size,
+                                        int64_t stride,
+                                        const Device& device) {
+    std::vector<scalar_t*> host_ptrs(batch_size);
+    for (int64_t i = 0; i < batch_size; ++i) {
+        host_ptrs[i] = static_cast<scalar_t*>(data) + i * stride;
+    }
+    scalar_t** ptrs = static_cast<scalar_t**>(
+            MemoryManager::Malloc(batch_size * sizeof(scalar_t*), device));
+    MemoryManager::MemcpyFromHost(ptrs, device, host_ptrs.data(),
+                                  batch_size * sizeof(scalar_t*));
+    return ptrs;
+}
+
 class CuSolverContext {
 public:
     static std::shared_ptr<CuSolverContext> GetInstance();
@@ -28,6 +28,8 @@
 
 #include <unordered_map>
 
+#include "open3d/core/CUDAUtils.h"
+
 namespace open3d {
 namespace core {
 
@@ -56,8 +58,30 @@ void Matmul(const Tensor& A, const Tensor& B, Tensor& output) {
     SizeVector A_shape = A.GetShape();
     SizeVector B_shape = B.GetShape();
 
+    // A batch of matrices is multiplied matrix by matrix.
+    bool batched = A_shape.size() == 3;
+    int64_t batch_size = 1;
+    if (batched) {
+        if (B_shape.size() != 3) {
+            utility::LogError(
+                    "Tensor B must be 3D (batch of matrices) for a batched "
+                    "Tensor A, but got {}D.",
+                    B_shape.size());
+        }
+        if (A_shape[0] != B_shape[0]) {
+            utility::LogError(
+                    "Tensor A batch size {} mismatch with Tensor B batch size "
+                    "{}.",
+                    A_shape[0], B_shape[0]);
+        }
+        batch_size = A_shape[0];
+        A_shape = SizeVector({A_shape[1], A_shape[2]});
+        B_shape = SizeVector({B_shape[1], B_shape[2]});
+    }
+
     if (A_shape.size() != 2) {
-        utility::LogError("Tensor A must be 2D, but got {}D.", A_shape.size());
+        utility::LogError("Tensor A must be 2D or 3D, but got {}D.",
+                          A_shape.size());
     }
     if (B_shape.size() != 1 && B_shape.size() != 2) {
         utility::LogError(
@@ -79,25 +103,58 @@ void Matmul(const Tensor& A, const Tensor& B, Tensor& output) {
                 "Tensor shapes should not contain dimensions with zero.");
     }
 
-    Tensor A_T = A.T().Contiguous().To(dtype);
-    Tensor B_T = B.T().Contiguous().To(dtype);
-    void* A_data = A_T.GetDataPtr();
-    void* B_data = B_T.GetDataPtr();
+    // The BLAS backends are column-major. The row-major C = AB is the
+    // column-major C^T = B^T A^T, hence the operands are swapped instead of
+    // transposed.
+    Tensor A_contiguous = A.Contiguous().To(dtype);
+    Tensor B_contiguous = B.Contiguous().To(dtype);
+    void* A_data = A_contiguous.GetDataPtr();
+    void* B_data = B_contiguous.GetDataPtr();
 
-    output = Tensor::Empty({n, m}, dtype, device);
-    void* C_data = output.GetDataPtr();
+    SizeVector output_shape =
+            batched ? SizeVector({batch_size, m, n}) : SizeVector({m, n});
+    bool reuse_output = output.GetShape() == output_shape &&
+                        output.GetDtype() == dtype_original &&
+                        output.GetDevice() == device;
+    bool write_to_output = reuse_output && output.IsContiguous() &&
+                           dtype == dtype_original &&
+                           output.GetBlob() != A.GetBlob() &&
+                           output.GetBlob() != B.GetBlob();
+    Tensor C = write_to_output ? output
+                               : Tensor::Empty(output_shape, dtype, device);
+    void* C_data = C.GetDataPtr();
 
-    if (device.GetType() == Device::DeviceType::CUDA) {
+    OPEN3D_TRACE_SCOPE("core::Matmul");
+    if (batch_size == 0) {
+        // Nothing to compute.
+    } else if (device.GetType() == Device::DeviceType::CUDA) {
 #ifdef BUILD_CUDA_MODULE
-        MatmulCUDA(A_data, B_data, C_data, m, k, n, dtype);
+        OPEN3D_TRACE_CUDA_SCOPE("core::Matmul");
+        if (batched) {
+            MatmulBatchedCUDA(B_data, A_data, C_data, batch_size, n, k, m,
+                              dtype);
+        } else {
+            MatmulCUDA(B_data, A_data, C_data, n, k, m, dtype);
+        }
 #else
         utility::LogError("Unimplemented device.");
 #endif
     } else {
-        MatmulCPU(A_data, B_data, C_data, m, k, n, dtype);
+        if (batched) {
+            MatmulBatchedCPU(B_data, A_data, C_data, batch_size, n, k, m,
+                             dtype);
+        } else {
+            MatmulCPU(B_data, A_data, C_data, n, k, m, dtype);
+        }
     }
 
-    output = output.T().To(dtype_original);
+    if (write_to_output) {
+        return;
+    } else if (reuse_output) {
+        output.AsRvalue() = C;
+    } else {
+        output = C.To(dtype_original);
+    }
 };
 
 }  // namespace core
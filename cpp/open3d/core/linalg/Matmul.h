@@ -32,6 +32,13 @@ namespace open3d {
 namespace core {
 
 /// Computes matrix multiplication C = AB.
+///
+/// A and B can also be batches of matrices with shapes (batch_size, m, k) and
+/// (batch_size, k, n), then C has shape (batch_size, m, n).
+///
+/// If C already has the shape, dtype and device of the result, the result is
+/// written to C's memory. For a contiguous C of a floating point dtype, this
+/// does not allocate memory. Otherwise, C is assigned a new tensor.
 void Matmul(const Tensor& A, const Tensor& B, Tensor& C);
 
 #ifdef BUILD_CUDA_MODULE
@@ -42,6 +49,15 @@ void MatmulCUDA(void* A_data,
                 int64_t k,
                 int64_t n,
                 Dtype dtype);
+
+void MatmulBatchedCUDA(void* A_data,
+                       void* B_data,
+                       void* C_data,
+                       int64_t batch_size,
+                       int64_t m,
+                       int64_t k,
+                       int64_t n,
+                       Dtype dtype);
 #endif
 void MatmulCPU(void* A_data,
                void* B_data,
@@ -50,5 +66,15 @@ void MatmulCPU(void* A_data,
                int64_t k,
                int64_t n,
                Dtype dtype);
+
+/// Column-major C[i] = A[i] B[i] for each matrix of the contiguous batches.
+void MatmulBatchedCPU(void* A_data,
+                      void* B_data,
+                      void* C_data,
+                      int64_t batch_size,
+                      int64_t m,
+                      int64_t k,
+                      int64_t n,
+                      Dtype dtype);
 }  // namespace core
 }  // namespace open3d
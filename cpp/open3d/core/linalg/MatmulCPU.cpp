@@ -30,6 +30,10 @@
 
 namespace open3d {
 namespace core {
+
+// Maximum m * k * n of the batched matrices multiplied without BLAS.
+static constexpr int64_t kSmallMatmulSize = 512;
+
 void MatmulCPU(void* A_data,
                void* B_data,
                void* C_data,
@@ -46,5 +50,42 @@ void MatmulCPU(void* A_data,
     });
 }
 
+void MatmulBatchedCPU(void* A_data,
+                      void* B_data,
+                      void* C_data,
+                      int64_t batch_size,
+                      int64_t m,
+                      int64_t k,
+                      int64_t n,
+                      Dtype dtype) {
+    DISPATCH_LINALG_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        const scalar_t* A = static_cast<const scalar_t*>(A_data);
+        const scalar_t* B = static_cast<const scalar_t*>(B_data);
+        scalar_t* C = static_cast<scalar_t*>(C_data);
+        // The BLAS call overhead dominates for small matrices, e.g. 3x3 or
+        // 6x6 blocks, which are multiplied directly.
+        bool small = m * k * n <= kSmallMatmulSize;
+        ParallelForBatchCPU(batch_size, [&](int64_t i) {
+            const scalar_t* A_i = A + i * m * k;
+            const scalar_t* B_i = B + i * k * n;
+            scalar_t* C_i = C + i * m * n;
+            if (small) {
+                for (int64_t col = 0; col < n; ++col) {
+                    for (int64_t row = 0; row < m; ++row) {
+                        scalar_t sum = 0;
+                        for (int64_t j = 0; j < k; ++j) {
+                            sum += A_i[j * m + row] * B_i[col * k + j];
+                        }
+                        C_i[col * m + row] = sum;
+                    }
+                }
+            } else {
+                gemm_cpu<scalar_t>(CblasColMajor, CblasNoTrans, CblasNoTrans,
+                                   m, n, k, 1, A_i, m, B_i, k, 0, C_i, m);
+            }
+        });
+    });
+}
+
 }  // namespace core
 }  // namespace open3d
@@ -52,5 +52,26 @@ void MatmulCUDA(void* A_data,
     });
 }
 
+void MatmulBatchedCUDA(void* A_data,
+                       void* B_data,
+                       void* C_data,
+                       int64_t batch_size,
+                       int64_t m,
+                       int64_t k,
+                       int64_t n,
+                       Dtype dtype) {
+    cublasHandle_t handle = CuBLASContext::GetInstance()->GetHandle();
+    DISPATCH_LINALG_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        scalar_t alpha = 1, beta = 0;
+        OPEN3D_CUBLAS_CHECK(
+                gemm_strided_batched_cuda<scalar_t>(
+                        handle, CUBLAS_OP_N, CUBLAS_OP_N, m, n, k, &alpha,
+                        static_cast<const scalar_t*>(A_data), m, m * k,
+                        static_cast<const scalar_t*>(B_data), k, k * n, &beta,
+                        static_cast<scalar_t*>(C_data), m, m * n, batch_size),
+                "cuda batched gemm failed");
+    });
+}
+
 }  // namespace core
 }  // namespace open3d
@@ -26,11 +26,75 @@
 
 #include "open3d/core/linalg/SVD.h"
 
+#include <algorithm>
 #include <unordered_map>
 
 namespace open3d {
 namespace core {
 
+/// Decomposes a (batch_size, m, n) tensor. The dtype is already checked.
+static void SVDBatched(const Tensor &A, Tensor &U, Tensor &S, Tensor &VT) {
+    Device device = A.GetDevice();
+    Dtype dtype = A.GetDtype();
+    SizeVector A_shape = A.GetShape();
+
+    int64_t batch_size = A_shape[0];
+    int64_t m = A_shape[1], n = A_shape[2];
+    if (m == 0 || n == 0) {
+        utility::LogError(
+                "Tensor shapes should not contain dimensions with zero.");
+    }
+    if (m < n) {
+        utility::LogError("Only support m >= n, but got {} and {} matrix", m,
+                          n);
+    }
+
+    Tensor A_T = A.Transpose(1, 2).Contiguous();
+    U = Tensor::Empty({batch_size, m, m}, dtype, device);
+    S = Tensor::Empty({batch_size, n}, dtype, device);
+    VT = Tensor::Empty({batch_size, n, n}, dtype, device);
+    if (batch_size == 0) {
+        return;
+    }
+
+    void *A_data = A_T.GetDataPtr();
+    void *U_data = U.GetDataPtr();
+    void *S_data = S.GetDataPtr();
+    void *VT_data = VT.GetDataPtr();
+
+    if (device.GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        if (m <= kSVDBatchedCUDAMaxSize && n <= kSVDBatchedCUDAMaxSize) {
+            // V in column-major order has the memory layout of a row-major VT.
+            SVDBatchedCUDA(A_data, U_data, S_data, VT_data, batch_size, m, n,
+                           dtype, device);
+            U = U.Transpose(1, 2);
+            return;
+        }
+
+        // Larger matrices are decomposed one by one.
+        Tensor superb = Tensor::Empty({std::min(m, n) - 1}, dtype, device);
+        int64_t element_size = dtype.ByteSize();
+        for (int64_t i = 0; i < batch_size; ++i) {
+            SVDCUDA(static_cast<char *>(A_data) + i * m * n * element_size,
+                    static_cast<char *>(U_data) + i * m * m * element_size,
+                    static_cast<char *>(S_data) + i * n * element_size,
+                    static_cast<char *>(VT_data) + i * n * n * element_size,
+                    superb.GetDataPtr(), m, n, dtype, device);
+        }
+#else
+        utility::LogError("Unimplemented device.");
+#endif
+    } else {
+        Tensor superb = Tensor::Empty({batch_size, std::min(m, n) - 1}, dtype,
+                                      device);
+        SVDBatchedCPU(A_data, U_data, S_data, VT_data, superb.GetDataPtr(),
+                      batch_size, m, n, dtype, device);
+    }
+    U = U.Transpose(1, 2);
+    VT = VT.Transpose(1, 2);
+}
+
 void SVD(const Tensor &A, Tensor &U, Tensor &S, Tensor &VT) {
     // Check devices
     Device device = A.GetDevice();
@@ -46,8 +110,13 @@ void SVD(const Tensor &A, Tensor &U, Tensor &S, Tensor &VT) {
 
     // Check dimensions
     SizeVector A_shape = A.GetShape();
+    if (A_shape.size() == 3) {
+        SVDBatched(A, U, S, VT);
+        return;
+    }
     if (A_shape.size() != 2) {
-        utility::LogError("Tensor A must be 2D, but got {}D", A_shape.size());
+        utility::LogError("Tensor A must be 2D or 3D, but got {}D",
+                          A_shape.size());
     }
 
     int64_t m = A_shape[0], n = A_shape[1];
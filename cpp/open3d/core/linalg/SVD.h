@@ -32,7 +32,8 @@ namespace open3d {
 namespace core {
 
 /// Computes SVD decomposition A = U S VT, where A is an m x n, U is an m x m, S
-/// is a min(m, n), VT is an n x n tensor.
+/// is a min(m, n), VT is an n x n tensor. A can also be a (batch_size, m, n)
+/// batch of matrices, which are decomposed independently.
 void SVD(const Tensor& A, Tensor& U, Tensor& S, Tensor& VT);
 
 #ifdef BUILD_CUDA_MODULE
@@ -45,6 +46,22 @@ void SVDCUDA(const void* A_data,
              int64_t n,
              Dtype dtype,
              const Device& device);
+
+/// Maximum m and n supported by SVDBatchedCUDA.
+constexpr int64_t kSVDBatchedCUDAMaxSize = 32;
+
+/// Decomposes the contiguous column-major batch of m x n matrices in A_data
+/// with Jacobi sweeps. U and V (not VT) are written in column-major order.
+/// m and n must not exceed kSVDBatchedCUDAMaxSize.
+void SVDBatchedCUDA(const void* A_data,
+                    void* U_data,
+                    void* S_data,
+                    void* V_data,
+                    int64_t batch_size,
+                    int64_t m,
+                    int64_t n,
+                    Dtype dtype,
+                    const Device& device);
 #endif
 
 void SVDCPU(const void* A_data,
@@ -57,5 +74,18 @@ void SVDCPU(const void* A_data,
             Dtype dtype,
             const Device& device);
 
+/// SVDCPU for a contiguous batch of matrices, with batch_size results of the
+/// sizes of SVDCPU in each output.
+void SVDBatchedCPU(const void* A_data,
+                   void* U_data,
+                   void* S_data,
+                   void* VT_data,
+                   void* superb_data,
+                   int64_t batch_size,
+                   int64_t m,
+                   int64_t n,
+                   Dtype dtype,
+                   const Device& device);
+
 }  // namespace core
 }  // namespace open3d
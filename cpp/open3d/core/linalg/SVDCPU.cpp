@@ -24,6 +24,8 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
+
 #include "open3d/core/linalg/LapackWrapper.h"
 #include "open3d/core/linalg/LinalgUtils.h"
 #include "open3d/core/linalg/SVD.h"
@@ -54,5 +56,33 @@ void SVDCPU(const void* A_data,
     });
 }
 
+void SVDBatchedCPU(const void* A_data,
+                   void* U_data,
+                   void* S_data,
+                   void* VT_data,
+                   void* superb_data,
+                   int64_t batch_size,
+                   int64_t m,
+                   int64_t n,
+                   Dtype dtype,
+                   const Device& device) {
+    DISPATCH_LINALG_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        scalar_t* A =
+                const_cast<scalar_t*>(static_cast<const scalar_t*>(A_data));
+        scalar_t* U = static_cast<scalar_t*>(U_data);
+        scalar_t* S = static_cast<scalar_t*>(S_data);
+        scalar_t* VT = static_cast<scalar_t*>(VT_data);
+        scalar_t* superb = static_cast<scalar_t*>(superb_data);
+        int64_t min_mn = std::min(m, n);
+        ParallelForBatchLAPACK(
+                batch_size, "gesvd failed in SVDBatchedCPU", [&](int64_t i) {
+                    return gesvd_cpu<scalar_t>(
+                            LAPACK_COL_MAJOR, 'A', 'A', m, n, A + i * m * n,
+                            m, S + i * min_mn, U + i * m * m, m,
+                            VT + i * n * n, n, superb + i * (min_mn - 1));
+                });
+    });
+}
+
 }  // namespace core
 }  // namespace open3d
@@ -67,5 +67,54 @@ void SVDCUDA(const void* A_data,
         MemoryManager::Free(workspace, device);
     });
 }
+
+void SVDBatchedCUDA(const void* A_data,
+                    void* U_data,
+                    void* S_data,
+                    void* V_data,
+                    int64_t batch_size,
+                    int64_t m,
+                    int64_t n,
+                    Dtype dtype,
+                    const Device& device) {
+    cusolverDnHandle_t handle = CuSolverContext::GetInstance()->GetHandle();
+
+    DISPATCH_LINALG_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        scalar_t* A =
+                const_cast<scalar_t*>(static_cast<const scalar_t*>(A_data));
+        scalar_t* U = static_cast<scalar_t*>(U_data);
+        scalar_t* S = static_cast<scalar_t*>(S_data);
+        scalar_t* V = static_cast<scalar_t*>(V_data);
+
+        gesvdjInfo_t params;
+        OPEN3D_CUSOLVER_CHECK(cusolverDnCreateGesvdjInfo(&params),
+                              "CreateGesvdjInfo failed in SVDBatchedCUDA");
+
+        int len;
+        OPEN3D_CUSOLVER_CHECK(
+                gesvdj_batched_cuda_buffersize<scalar_t>(
+                        handle, CUSOLVER_EIG_MODE_VECTOR, m, n, A, m, S, U, m,
+                        V, n, &len, params, batch_size),
+                "gesvdj_batched_buffersize failed in SVDBatchedCUDA");
+
+        void* workspace = MemoryManager::Malloc(len * sizeof(scalar_t), device);
+        int* dinfo = static_cast<int*>(
+                MemoryManager::Malloc(batch_size * sizeof(int), device));
+
+        OPEN3D_CUSOLVER_CHECK(
+                gesvdj_batched_cuda<scalar_t>(
+                        handle, CUSOLVER_EIG_MODE_VECTOR, m, n, A, m, S, U, m,
+                        V, n, static_cast<scalar_t*>(workspace), len, dinfo,
+                        params, batch_size),
+                "gesvdj_batched failed in SVDBatchedCUDA");
+        OPEN3D_CHECK_BATCHED_DINFO("gesvdj_batched failed in SVDBatchedCUDA",
+                                   dinfo, batch_size, device);
+
+        MemoryManager::Free(workspace, device);
+        MemoryManager::Free(dinfo, device);
+        cusolverDnDestroyGesvdjInfo(params);
+    });
+}
+
 }  // namespace core
 }  // namespace open3d
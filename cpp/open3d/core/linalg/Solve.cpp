@@ -37,6 +37,75 @@
 namespace open3d {
 namespace core {
 
+static Dtype GetCPUIpivDtype() {
+    if (sizeof(OPEN3D_CPU_LINALG_INT) == 4) {
+        return Dtype::Int32;
+    } else if (sizeof(OPEN3D_CPU_LINALG_INT) == 8) {
+        return Dtype::Int64;
+    } else {
+        utility::LogError("Unsupported OPEN3D_CPU_LINALG_INT type.");
+    }
+}
+
+/// Solves a (batch_size, n, n) tensor A with B of shape (batch_size, n) or
+/// (batch_size, n, k). Devices and dtypes are already checked.
+static void SolveBatched(const Tensor &A, const Tensor &B, Tensor &X) {
+    Device device = A.GetDevice();
+    Dtype dtype = A.GetDtype();
+    SizeVector A_shape = A.GetShape();
+    SizeVector B_shape = B.GetShape();
+    if (A_shape[1] != A_shape[2]) {
+        utility::LogError(
+                "Tensor A must be a batch of square matrices, but got {} x {}.",
+                A_shape[1], A_shape[2]);
+    }
+    if (B_shape.size() != 2 && B_shape.size() != 3) {
+        utility::LogError(
+                "Tensor B must be 2D (batch of vectors) or 3D (batch of "
+                "matrices) for a batched Tensor A, but got {}D",
+                B_shape.size());
+    }
+    if (B_shape[0] != A_shape[0] || B_shape[1] != A_shape[1]) {
+        utility::LogError("Tensor A and B's first two dimensions mismatch.");
+    }
+
+    int64_t batch_size = A_shape[0];
+    int64_t n = A_shape[1];
+    int64_t k = B_shape.size() == 3 ? B_shape[2] : 1;
+    if (n == 0 || k == 0) {
+        utility::LogError(
+                "Tensor shapes should not contain dimensions with zero.");
+    }
+    if (batch_size == 0) {
+        X = Tensor::Empty(B_shape, dtype, device);
+        return;
+    }
+
+    // A and B are modified in-place, in column-major order.
+    Tensor A_copy = A.Transpose(1, 2).Copy(device);
+    void *A_data = A_copy.GetDataPtr();
+
+    X = B_shape.size() == 3 ? B.Transpose(1, 2).Copy(device) : B.Copy(device);
+    void *B_data = X.GetDataPtr();
+
+    if (device.GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        SolveBatchedCUDA(A_data, B_data, batch_size, n, k, dtype, device);
+#else
+        utility::LogError("Unimplemented device.");
+#endif
+    } else {
+        Tensor ipiv = Tensor::Empty({batch_size, n}, GetCPUIpivDtype(), device);
+        void *ipiv_data = ipiv.GetDataPtr();
+
+        SolveBatchedCPU(A_data, B_data, ipiv_data, batch_size, n, k, dtype,
+                        device);
+    }
+    if (B_shape.size() == 3) {
+        X = X.Transpose(1, 2);
+    }
+}
+
 void Solve(const Tensor &A, const Tensor &B, Tensor &X) {
     // Check devices
     Device device = A.GetDevice();
@@ -62,8 +131,13 @@ void Solve(const Tensor &A, const Tensor &B, Tensor &X) {
     // Check dimensions
     SizeVector A_shape = A.GetShape();
     SizeVector B_shape = B.GetShape();
+    if (A_shape.size() == 3) {
+        SolveBatched(A, B, X);
+        return;
+    }
     if (A_shape.size() != 2) {
-        utility::LogError("Tensor A must be 2D, but got {}D", A_shape.size());
+        utility::LogError("Tensor A must be 2D or 3D, but got {}D",
+                          A_shape.size());
     }
     if (A_shape[0] != A_shape[1]) {
         utility::LogError("Tensor A must be square, but got {} x {}.",
@@ -102,15 +176,7 @@ void Solve(const Tensor &A, const Tensor &B, Tensor &X) {
         utility::LogError("Unimplemented device.");
 #endif
     } else {
-        Dtype ipiv_dtype;
-        if (sizeof(OPEN3D_CPU_LINALG_INT) == 4) {
-            ipiv_dtype = Dtype::Int32;
-        } else if (sizeof(OPEN3D_CPU_LINALG_INT) == 8) {
-            ipiv_dtype = Dtype::Int64;
-        } else {
-            utility::LogError("Unsupported OPEN3D_CPU_LINALG_INT type.");
-        }
-        Tensor ipiv = Tensor::Empty({n}, ipiv_dtype, device);
+        Tensor ipiv = Tensor::Empty({n}, GetCPUIpivDtype(), device);
         void *ipiv_data = ipiv.GetDataPtr();
 
         SolveCPU(A_data, B_data, ipiv_data, n, k, dtype, device);
@@ -32,6 +32,8 @@ namespace open3d {
 namespace core {
 
 /// Solve AX = B with LU decomposition. A is a square matrix.
+/// A can also be a (batch_size, n, n) batch of matrices with B of shape
+/// (batch_size, n) or (batch_size, n, k), which are solved independently.
 void Solve(const Tensor& A, const Tensor& B, Tensor& X);
 
 void SolveCPU(void* A_data,
@@ -42,6 +44,17 @@ void SolveCPU(void* A_data,
               Dtype dtype,
               const Device& device);
 
+/// Solves the contiguous column-major batches of n x n matrices A_data and
+/// n x k matrices B_data, B_data is overwritten by the solutions.
+void SolveBatchedCPU(void* A_data,
+                     void* B_data,
+                     void* ipiv_data,
+                     int64_t batch_size,
+                     int64_t n,
+                     int64_t k,
+                     Dtype dtype,
+                     const Device& device);
+
 #ifdef BUILD_CUDA_MODULE
 void SolveCUDA(void* A_data,
                void* B_data,
@@ -50,6 +63,14 @@ void SolveCUDA(void* A_data,
                int64_t k,
                Dtype dtype,
                const Device& device);
+
+void SolveBatchedCUDA(void* A_data,
+                      void* B_data,
+                      int64_t batch_size,
+                      int64_t n,
+                      int64_t k,
+                      Dtype dtype,
+                      const Device& device);
 #endif
 
 }  // namespace core
@@ -48,5 +48,27 @@ void SolveCPU(void* A_data,
     });
 }
 
+void SolveBatchedCPU(void* A_data,
+                     void* B_data,
+                     void* ipiv_data,
+                     int64_t batch_size,
+                     int64_t n,
+                     int64_t k,
+                     Dtype dtype,
+                     const Device& device) {
+    DISPATCH_LINALG_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        scalar_t* A = static_cast<scalar_t*>(A_data);
+        scalar_t* B = static_cast<scalar_t*>(B_data);
+        OPEN3D_CPU_LINALG_INT* ipiv =
+                static_cast<OPEN3D_CPU_LINALG_INT*>(ipiv_data);
+        ParallelForBatchLAPACK(
+                batch_size, "gesv failed in SolveBatchedCPU", [&](int64_t i) {
+                    return gesv_cpu<scalar_t>(LAPACK_COL_MAJOR, n, k,
+                                              A + i * n * n, n, ipiv + i * n,
+                                              B + i * n * k, n);
+                });
+    });
+}
+
 }  // namespace core
 }  // namespace open3d
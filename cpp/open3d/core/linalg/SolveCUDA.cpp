@@ -73,5 +73,52 @@ void SolveCUDA(void* A_data,
     });
 }
 
+// Same as SolveCUDA, with the batched LU decomposition and solver of cuBLAS.
+void SolveBatchedCUDA(void* A_data,
+                      void* B_data,
+                      int64_t batch_size,
+                      int64_t n,
+                      int64_t k,
+                      Dtype dtype,
+                      const Device& device) {
+    cublasHandle_t handle = CuBLASContext::GetInstance()->GetHandle();
+
+    DISPATCH_LINALG_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        scalar_t** A_array = CreateBatchedPointers<scalar_t>(
+                A_data, batch_size, n * n, device);
+        scalar_t** B_array = CreateBatchedPointers<scalar_t>(
+                B_data, batch_size, n * k, device);
+        int* ipiv = static_cast<int*>(
+                MemoryManager::Malloc(batch_size * n * sizeof(int), device));
+        int* dinfo = static_cast<int*>(
+                MemoryManager::Malloc(batch_size * sizeof(int), device));
+
+        OPEN3D_CUBLAS_CHECK(
+                getrf_batched_cuda<scalar_t>(handle, n, A_array, n, ipiv, dinfo,
+                                             batch_size),
+                "getrf_batched failed in SolveBatchedCUDA");
+        OPEN3D_CHECK_BATCHED_DINFO("getrf_batched failed in SolveBatchedCUDA",
+                                   dinfo, batch_size, device);
+
+        int hinfo;
+        OPEN3D_CUBLAS_CHECK(
+                getrs_batched_cuda<scalar_t>(handle, CUBLAS_OP_N, n, k, A_array,
+                                             n, ipiv, B_array, n, &hinfo,
+                                             batch_size),
+                "getrs_batched failed in SolveBatchedCUDA");
+        if (hinfo < 0) {
+            utility::LogError(
+                    "getrs_batched failed in SolveBatchedCUDA: {}-th parameter "
+                    "is invalid.",
+                    -hinfo);
+        }
+
+        MemoryManager::Free(A_array, device);
+        MemoryManager::Free(B_array, device);
+        MemoryManager::Free(ipiv, device);
+        MemoryManager::Free(dinfo, device);
+    });
+}
+
 }  // namespace core
 }  // namespace open3d
@@ -0,0 +1,79 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/linalg/SymmetricEigen3x3.h"
+
+namespace open3d {
+namespace core {
+
+void SymmetricEigen3x3(const Tensor& A,
+                       Tensor& eigenvalues,
+                       Tensor& eigenvectors) {
+    Device device = A.GetDevice();
+
+    // Check dtypes
+    Dtype dtype = A.GetDtype();
+    if (dtype != Dtype::Float32 && dtype != Dtype::Float64) {
+        utility::LogError(
+                "Only tensors with Float32 or Float64 are supported, but "
+                "received {}.",
+                dtype.ToString());
+    }
+
+    // Check dimensions
+    SizeVector A_shape = A.GetShape();
+    if (A_shape.size() != 3 || A_shape[1] != 3 || A_shape[2] != 3) {
+        utility::LogError("Tensor A must have shape (N, 3, 3), but got {}.",
+                          A_shape.ToString());
+    }
+
+    int64_t n = A_shape[0];
+    Tensor A_contiguous = A.Contiguous();
+    eigenvalues = Tensor::Empty({n, 3}, dtype, device);
+    eigenvectors = Tensor::Empty({n, 3, 3}, dtype, device);
+    if (n == 0) {
+        return;
+    }
+
+    const void* A_data = A_contiguous.GetDataPtr();
+    void* eigenvalues_data = eigenvalues.GetDataPtr();
+    void* eigenvectors_data = eigenvectors.GetDataPtr();
+
+    if (device.GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        SymmetricEigen3x3CUDA(A_data, eigenvalues_data, eigenvectors_data, n,
+                              dtype);
+#else
+        utility::LogError("Unimplemented device.");
+#endif
+    } else {
+        SymmetricEigen3x3CPU(A_data, eigenvalues_data, eigenvectors_data, n,
+                             dtype);
+    }
+}
+
+}  // namespace core
+}  // namespace open3d
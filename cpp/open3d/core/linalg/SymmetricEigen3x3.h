@@ -0,0 +1,62 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+
+/// Computes the eigenvalues and eigenvectors of a (N, 3, 3) batch of symmetric
+/// matrices in closed form, see SymmetricEigen3x3Shared.h. Only the upper
+/// triangles of the matrices are read.
+///
+/// \param A The (N, 3, 3) Float32 or Float64 tensor.
+/// \param eigenvalues Output (N, 3) tensor, with the eigenvalues of each
+/// matrix in ascending order.
+/// \param eigenvectors Output (N, 3, 3) tensor, with the unit eigenvector of
+/// eigenvalues[i, j] in column j of eigenvectors[i].
+void SymmetricEigen3x3(const Tensor& A,
+                       Tensor& eigenvalues,
+                       Tensor& eigenvectors);
+
+void SymmetricEigen3x3CPU(const void* A_data,
+                          void* eigenvalues_data,
+                          void* eigenvectors_data,
+                          int64_t n,
+                          Dtype dtype);
+
+#ifdef BUILD_CUDA_MODULE
+void SymmetricEigen3x3CUDA(const void* A_data,
+                           void* eigenvalues_data,
+                           void* eigenvectors_data,
+                           int64_t n,
+                           Dtype dtype);
+#endif
+
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,54 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/kernel/CPULauncher.h"
+#include "open3d/core/linalg/LinalgUtils.h"
+#include "open3d/core/linalg/SymmetricEigen3x3.h"
+#include "open3d/core/linalg/SymmetricEigen3x3Shared.h"
+
+namespace open3d {
+namespace core {
+
+void SymmetricEigen3x3CPU(const void* A_data,
+                          void* eigenvalues_data,
+                          void* eigenvectors_data,
+                          int64_t n,
+                          Dtype dtype) {
+    DISPATCH_LINALG_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        const scalar_t* A = static_cast<const scalar_t*>(A_data);
+        scalar_t* eigenvalues = static_cast<scalar_t*>(eigenvalues_data);
+        scalar_t* eigenvectors = static_cast<scalar_t*>(eigenvectors_data);
+        kernel::CPULauncher::LaunchGeneralKernel(
+                n, [&](int64_t workload_idx) {
+                    SymmetricEigen3x3(A + 9 * workload_idx,
+                                      eigenvalues + 3 * workload_idx,
+                                      eigenvectors + 9 * workload_idx);
+                });
+    });
+}
+
+}  // namespace core
+}  // namespace open3d
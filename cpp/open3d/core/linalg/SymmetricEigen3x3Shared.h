@@ -0,0 +1,271 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cmath>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/utility/MiniVec.h"
+
+// Closed-form eigendecomposition of symmetric 3x3 matrices, usable in CPU code
+// and in CUDA kernels. Based on
+// https://www.geometrictools.com/Documentation/RobustEigenSymmetric3x3.pdf
+// which handles edge cases like points on a plane.
+
+namespace open3d {
+namespace core {
+namespace eigen3x3 {
+
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE inline scalar_t Dot3(const scalar_t* a, const scalar_t* b) {
+    return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE inline void Cross3(const scalar_t* a,
+                                      const scalar_t* b,
+                                      scalar_t* c) {
+    c[0] = a[1] * b[2] - a[2] * b[1];
+    c[1] = a[2] * b[0] - a[0] * b[2];
+    c[2] = a[0] * b[1] - a[1] * b[0];
+}
+
+/// Eigenvector of the row-major symmetric matrix A for the eigenvalue eval0
+/// of multiplicity one.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE inline void ComputeEigenvector0(const scalar_t* A,
+                                                   scalar_t eval0,
+                                                   scalar_t* evec0) {
+    scalar_t row0[3] = {A[0] - eval0, A[1], A[2]};
+    scalar_t row1[3] = {A[1], A[4] - eval0, A[5]};
+    scalar_t row2[3] = {A[2], A[5], A[8] - eval0};
+    scalar_t rxr[3][3];
+    Cross3(row0, row1, rxr[0]);
+    Cross3(row0, row2, rxr[1]);
+    Cross3(row1, row2, rxr[2]);
+    scalar_t d[3] = {Dot3(rxr[0], rxr[0]), Dot3(rxr[1], rxr[1]),
+                     Dot3(rxr[2], rxr[2])};
+
+    int imax = 0;
+    if (d[1] > d[imax]) {
+        imax = 1;
+    }
+    if (d[2] > d[imax]) {
+        imax = 2;
+    }
+
+    scalar_t inv_length = 1 / std::sqrt(d[imax]);
+    for (int i = 0; i < 3; ++i) {
+        evec0[i] = rxr[imax][i] * inv_length;
+    }
+}
+
+/// Eigenvector of the row-major symmetric matrix A for the eigenvalue eval1,
+/// orthogonal to the unit eigenvector evec0.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE inline void ComputeEigenvector1(const scalar_t* A,
+                                                   const scalar_t* evec0,
+                                                   scalar_t eval1,
+                                                   scalar_t* evec1) {
+    scalar_t U[3], V[3];
+    if (std::abs(evec0[0]) > std::abs(evec0[1])) {
+        scalar_t inv_length =
+                1 / std::sqrt(evec0[0] * evec0[0] + evec0[2] * evec0[2]);
+        U[0] = -evec0[2] * inv_length;
+        U[1] = 0;
+        U[2] = evec0[0] * inv_length;
+    } else {
+        scalar_t inv_length =
+                1 / std::sqrt(evec0[1] * evec0[1] + evec0[2] * evec0[2]);
+        U[0] = 0;
+        U[1] = evec0[2] * inv_length;
+        U[2] = -evec0[1] * inv_length;
+    }
+    Cross3(evec0, U, V);
+
+    scalar_t AU[3] = {Dot3(A, U), Dot3(A + 3, U), Dot3(A + 6, U)};
+    scalar_t AV[3] = {Dot3(A, V), Dot3(A + 3, V), Dot3(A + 6, V)};
+
+    scalar_t m00 = Dot3(U, AU) - eval1;
+    scalar_t m01 = Dot3(U, AV);
+    scalar_t m11 = Dot3(V, AV) - eval1;
+
+    scalar_t abs_m00 = std::abs(m00);
+    scalar_t abs_m01 = std::abs(m01);
+    scalar_t abs_m11 = std::abs(m11);
+    scalar_t u_coeff = 1, v_coeff = 0;
+    if (abs_m00 >= abs_m11) {
+        if (abs_m00 > 0 || abs_m01 > 0) {
+            if (abs_m00 >= abs_m01) {
+                m01 /= m00;
+                m00 = 1 / std::sqrt(1 + m01 * m01);
+                m01 *= m00;
+            } else {
+                m00 /= m01;
+                m01 = 1 / std::sqrt(1 + m00 * m00);
+                m00 *= m01;
+            }
+            u_coeff = m01;
+            v_coeff = -m00;
+        }
+    } else {
+        if (abs_m11 > 0 || abs_m01 > 0) {
+            if (abs_m11 >= abs_m01) {
+                m01 /= m11;
+                m11 = 1 / std::sqrt(1 + m01 * m01);
+                m01 *= m11;
+            } else {
+                m11 /= m01;
+                m01 = 1 / std::sqrt(1 + m11 * m11);
+                m11 *= m01;
+            }
+            u_coeff = m11;
+            v_coeff = -m01;
+        }
+    }
+    for (int i = 0; i < 3; ++i) {
+        evec1[i] = u_coeff * U[i] + v_coeff * V[i];
+    }
+}
+
+}  // namespace eigen3x3
+
+/// Computes the eigenvalues and eigenvectors of the symmetric 3x3 matrix A in
+/// closed form. Only the upper triangle of A is read.
+///
+/// \param A Row-major 3x3 matrix.
+/// \param eigenvalues The 3 eigenvalues in ascending order.
+/// \param eigenvectors Row-major 3x3 matrix with the unit eigenvector of
+/// eigenvalues[i] in column i.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE inline void SymmetricEigen3x3(const scalar_t* A,
+                                                 scalar_t* eigenvalues,
+                                                 scalar_t* eigenvectors) {
+    using namespace eigen3x3;
+
+    // Scale the matrix to avoid overflow and underflow.
+    scalar_t max_abs = 0;
+    const int upper[6] = {0, 1, 2, 4, 5, 8};
+    for (int i = 0; i < 6; ++i) {
+        scalar_t abs_i = std::abs(A[upper[i]]);
+        max_abs = abs_i > max_abs ? abs_i : max_abs;
+    }
+    if (max_abs == 0) {
+        for (int i = 0; i < 9; ++i) {
+            eigenvectors[i] = (i % 4 == 0) ? 1 : 0;
+        }
+        eigenvalues[0] = eigenvalues[1] = eigenvalues[2] = 0;
+        return;
+    }
+    scalar_t B[9] = {A[0] / max_abs, A[1] / max_abs, A[2] / max_abs,
+                     A[1] / max_abs, A[4] / max_abs, A[5] / max_abs,
+                     A[2] / max_abs, A[5] / max_abs, A[8] / max_abs};
+
+    scalar_t evecs[3][3];
+    scalar_t norm = B[1] * B[1] + B[2] * B[2] + B[5] * B[5];
+    if (norm > 0) {
+        scalar_t q = (B[0] + B[4] + B[8]) / 3;
+
+        scalar_t b00 = B[0] - q;
+        scalar_t b11 = B[4] - q;
+        scalar_t b22 = B[8] - q;
+
+        scalar_t p =
+                std::sqrt((b00 * b00 + b11 * b11 + b22 * b22 + norm * 2) / 6);
+
+        scalar_t c00 = b11 * b22 - B[5] * B[5];
+        scalar_t c01 = B[1] * b22 - B[5] * B[2];
+        scalar_t c02 = B[1] * B[5] - b11 * B[2];
+        scalar_t det = (b00 * c00 - B[1] * c01 + B[2] * c02) / (p * p * p);
+
+        scalar_t half_det = det * scalar_t(0.5);
+        half_det = half_det < -1 ? -1 : (half_det > 1 ? 1 : half_det);
+
+        // beta0 <= beta1 <= beta2, so the eigenvalues are in ascending order.
+        scalar_t angle = std::acos(half_det) / 3;
+        const scalar_t two_thirds_pi = scalar_t(2.09439510239319549);
+        scalar_t beta2 = std::cos(angle) * 2;
+        scalar_t beta0 = std::cos(angle + two_thirds_pi) * 2;
+        scalar_t beta1 = -(beta0 + beta2);
+
+        eigenvalues[0] = q + p * beta0;
+        eigenvalues[1] = q + p * beta1;
+        eigenvalues[2] = q + p * beta2;
+
+        // The eigenvector of the eigenvalue farthest from the others is the
+        // most robust one to start with.
+        if (half_det >= 0) {
+            ComputeEigenvector0(B, eigenvalues[2], evecs[2]);
+            ComputeEigenvector1(B, evecs[2], eigenvalues[1], evecs[1]);
+            Cross3(evecs[1], evecs[2], evecs[0]);
+        } else {
+            ComputeEigenvector0(B, eigenvalues[0], evecs[0]);
+            ComputeEigenvector1(B, evecs[0], eigenvalues[1], evecs[1]);
+            Cross3(evecs[0], evecs[1], evecs[2]);
+        }
+        for (int i = 0; i < 3; ++i) {
+            eigenvalues[i] *= max_abs;
+        }
+    } else {
+        // A is diagonal, sort the diagonal entries.
+        int order[3] = {0, 1, 2};
+        for (int i = 0; i < 2; ++i) {
+            for (int j = 0; j < 2 - i; ++j) {
+                if (A[order[j] * 4] > A[order[j + 1] * 4]) {
+                    int tmp = order[j];
+                    order[j] = order[j + 1];
+                    order[j + 1] = tmp;
+                }
+            }
+        }
+        for (int i = 0; i < 3; ++i) {
+            eigenvalues[i] = A[order[i] * 4];
+            for (int j = 0; j < 3; ++j) {
+                evecs[i][j] = (j == order[i]) ? 1 : 0;
+            }
+        }
+    }
+
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            eigenvectors[j * 3 + i] = evecs[i][j];
+        }
+    }
+}
+
+/// Same as SymmetricEigen3x3(A, eigenvalues, eigenvectors) for MiniVec inputs
+/// and outputs.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE inline void SymmetricEigen3x3(
+        const utility::MiniVec<scalar_t, 9>& A,
+        utility::MiniVec<scalar_t, 3>& eigenvalues,
+        utility::MiniVec<scalar_t, 9>& eigenvectors) {
+    SymmetricEigen3x3(&A.arr[0], &eigenvalues.arr[0], &eigenvectors.arr[0]);
+}
+
+}  // namespace core
+}  // namespace open3d
@@ -26,17 +26,64 @@
 
 #include "open3d/core/nns/FixedRadiusIndex.h"
 
-#ifdef BUILD_CUDA_MODULE
-#include "open3d/core/nns/FixedRadiusSearch.h"
-#endif
+#include <cmath>
 
 #include "open3d/core/CoreUtil.h"
+#include "open3d/core/nns/FixedRadiusSearch.h"
 #include "open3d/utility/Console.h"
 
 namespace open3d {
 namespace core {
 namespace nns {
 
+namespace {
+
+/// Checks that the spatial hash table is implemented for the device and the
+/// dimension of \p dataset_points, and that \p radius is positive.
+void AssertSupported(const Tensor &dataset_points, double radius) {
+    if (dataset_points.GetDevice().GetType() == Device::DeviceType::CUDA) {
+#ifndef BUILD_CUDA_MODULE
+        utility::LogError(
+                "[FixedRadiusIndex::SetTensorData] BUILD_CUDA_MODULE is OFF. "
+                "Please compile Open3d with BUILD_CUDA_MODULE=ON.");
+#endif
+    } else if (dataset_points.GetDevice().GetType() !=
+               Device::DeviceType::CPU) {
+        utility::LogError(
+                "[FixedRadiusIndex::SetTensorData] Unsupported device {}.",
+                dataset_points.GetDevice().ToString());
+    }
+    if (dataset_points.NumDims() != 2 || dataset_points.GetShape()[1] != 3) {
+        utility::LogError(
+                "[FixedRadiusIndex::SetTensorData] dataset_points must have "
+                "shape {{n, 3}}, but got {}.",
+                dataset_points.GetShape().ToString());
+    }
+    if (radius <= 0) {
+        utility::LogError(
+                "[FixedRadiusIndex::SetTensorData] radius should be positive.");
+    }
+}
+
+/// Returns \p value clamped to \p max_value, allowing for the rounding of
+/// values passed as float. Errors out if \p value is larger.
+double ClampSearchRadius(double value,
+                         double max_value,
+                         const std::string &function) {
+    if (value > max_value) {
+        if (value > max_value * (1 + 1e-5)) {
+            utility::LogError(
+                    "[FixedRadiusIndex::{}] radius {} exceeds the radius {} "
+                    "of the index.",
+                    function, value, max_value);
+        }
+        return max_value;
+    }
+    return value;
+}
+
+}  // namespace
+
 FixedRadiusIndex::FixedRadiusIndex(){};
 
 FixedRadiusIndex::FixedRadiusIndex(const Tensor &dataset_points,
@@ -48,23 +95,43 @@ FixedRadiusIndex::~FixedRadiusIndex(){};
 
 bool FixedRadiusIndex::SetTensorData(const Tensor &dataset_points,
                                      double radius) {
-#ifdef BUILD_CUDA_MODULE
-    if (dataset_points.GetDevice().GetType() != Device::DeviceType::CUDA) {
-        utility::LogError(
-                "[FixedRadiusIndex::SetTensorData] dataset_points should be "
-                "GPU Tensor.");
-    }
-    if (radius <= 0) {
-        utility::LogError(
-                "[FixedRadiusIndex::SetTensorData] radius should be positive.");
-    }
+    AssertSupported(dataset_points, radius);
+    dataset_points_ = dataset_points.Contiguous();
+    radius_ = radius;
+    num_indices_ = GetDatasetSize();
+    point_indices_ = Tensor::Arange(0, num_indices_, 1, Dtype::Int64,
+                                    dataset_points_.GetDevice());
+    points_row_splits_ = std::vector<int64_t>({0, num_indices_});
+    BuildHashTable();
+    return true;
+};
+
+bool FixedRadiusIndex::SetTensorData(const Tensor &dataset_points,
+                                     const Tensor &points_row_splits,
+                                     double radius) {
+    AssertSupported(dataset_points, radius);
     dataset_points_ = dataset_points.Contiguous();
-    int64_t num_points = GetDatasetSize();
-    int64_t hash_table_size = std::min<int64_t>(
-            std::max<int64_t>(hash_table_size_factor * num_points, 1),
-            max_hash_tabls_size);
-    points_row_splits_ = std::vector<int64_t>({0, num_points});
-    hash_table_splits_ = std::vector<uint32_t>({0, (uint32_t)hash_table_size});
+    radius_ = radius;
+    num_indices_ = GetDatasetSize();
+    point_indices_ = Tensor::Arange(0, num_indices_, 1, Dtype::Int64,
+                                    dataset_points_.GetDevice());
+    points_row_splits_ = GetRowSplits(points_row_splits, num_indices_);
+    BuildHashTable();
+    return true;
+}
+
+void FixedRadiusIndex::BuildHashTable() {
+    size_t num_batches = points_row_splits_.size() - 1;
+    hash_table_splits_ = std::vector<uint32_t>(num_batches + 1, 0);
+    for (size_t i = 0; i < num_batches; ++i) {
+        int64_t num_points_i =
+                points_row_splits_[i + 1] - points_row_splits_[i];
+        int64_t hash_table_size = std::min<int64_t>(
+                std::max<int64_t>(hash_table_size_factor * num_points_i, 1),
+                max_hash_tabls_size);
+        hash_table_splits_[i + 1] =
+                hash_table_splits_[i] + (uint32_t)hash_table_size;
+    }
 
     hash_table_index_ =
             Tensor::Empty({dataset_points_.GetShape()[0]}, Dtype::Int32,
@@ -73,20 +140,37 @@ bool FixedRadiusIndex::SetTensorData(const Tensor &dataset_points,
             Tensor::Empty({hash_table_splits_.back() + 1}, Dtype::Int32,
                           dataset_points_.GetDevice());
 
-    out_hash_table_splits_ = std::vector<uint32_t>(2, 0);
-    for (size_t i = 0; i < hash_table_splits_.size(); ++i) {
-        out_hash_table_splits_[i] = hash_table_splits_[i];
+    out_hash_table_splits_ = hash_table_splits_;
+
+    Dtype dtype = GetDtype();
+    if (GetDevice().GetType() == Device::DeviceType::CPU) {
+        hash_table_points_ = Tensor::Empty(dataset_points_.GetShape(), dtype,
+                                           dataset_points_.GetDevice());
+        DISPATCH_FLOAT32_FLOAT64_DTYPE(dtype, [&]() {
+            BuildSpatialHashTableCPU(
+                    GetDatasetSize(),
+                    static_cast<const scalar_t *>(dataset_points_.GetDataPtr()),
+                    static_cast<scalar_t>(radius_), points_row_splits_.size(),
+                    points_row_splits_.data(), hash_table_splits_.data(),
+                    hash_table_cell_splits_.GetShape()[0],
+                    (uint32_t *)static_cast<int32_t *>(
+                            hash_table_cell_splits_.GetDataPtr()),
+                    (uint32_t *)static_cast<int32_t *>(
+                            hash_table_index_.GetDataPtr()),
+                    static_cast<scalar_t *>(hash_table_points_.GetDataPtr()));
+        });
+        return;
     }
 
+#ifdef BUILD_CUDA_MODULE
     void *temp_ptr = nullptr;
     size_t temp_size = 0;
 
-    Dtype dtype = GetDtype();
     DISPATCH_FLOAT32_FLOAT64_DTYPE(dtype, [&]() {
         BuildSpatialHashTableCUDA(
                 temp_ptr, temp_size, dataset_points_.GetShape()[1],
                 static_cast<scalar_t *>(dataset_points_.GetDataPtr()),
-                static_cast<scalar_t>(radius), points_row_splits_.size(),
+                static_cast<scalar_t>(radius_), points_row_splits_.size(),
                 points_row_splits_.data(), hash_table_splits_.data(),
                 hash_table_cell_splits_.GetShape()[0],
                 (uint32_t *)static_cast<int32_t *>(
@@ -100,7 +184,7 @@ bool FixedRadiusIndex::SetTensorData(const Tensor &dataset_points,
         BuildSpatialHashTableCUDA(
                 temp_ptr, temp_size, dataset_points_.GetShape()[1],
                 static_cast<scalar_t *>(dataset_points_.GetDataPtr()),
-                static_cast<scalar_t>(radius), points_row_splits_.size(),
+                static_cast<scalar_t>(radius_), points_row_splits_.size(),
                 points_row_splits_.data(), hash_table_splits_.data(),
                 hash_table_cell_splits_.GetShape()[0],
                 (uint32_t *)static_cast<int32_t *>(
@@ -108,17 +192,92 @@ bool FixedRadiusIndex::SetTensorData(const Tensor &dataset_points,
                 (uint32_t *)static_cast<int32_t *>(
                         hash_table_index_.GetDataPtr()));
     });
-    return true;
 #else
     utility::LogError(
-            "FixedRadiusIndex::SetTensorData BUILD_CUDA_MODULE is OFF. Please "
+            "FixedRadiusIndex::BuildHashTable BUILD_CUDA_MODULE is OFF. Please "
             "compile Open3d with BUILD_CUDA_MODULE=ON.");
 #endif
-};
+}
+
+bool FixedRadiusIndex::AddPoints(const Tensor &points) {
+    if (points_row_splits_.size() > 2) {
+        utility::LogError(
+                "[FixedRadiusIndex::AddPoints] Not supported for batched "
+                "indices.");
+    }
+    points.AssertDtype(GetDtype());
+    points.AssertDevice(GetDevice());
+    points.AssertShapeCompatible({utility::nullopt, GetDimension()});
+
+    int64_t num_dataset_points = GetDatasetSize();
+    int64_t num_points = points.GetShape()[0];
+    if (num_points == 0) {
+        return true;
+    }
+
+    Tensor dataset_points =
+            Tensor::Empty({num_dataset_points + num_points, GetDimension()},
+                          GetDtype(), GetDevice());
+    dataset_points.Slice(0, 0, num_dataset_points).AsRvalue() =
+            dataset_points_;
+    dataset_points.Slice(0, num_dataset_points, num_dataset_points + num_points)
+            .AsRvalue() = points;
+
+    Tensor point_indices = Tensor::Empty({num_dataset_points + num_points},
+                                         Dtype::Int64, GetDevice());
+    point_indices.Slice(0, 0, num_dataset_points).AsRvalue() = point_indices_;
+    point_indices.Slice(0, num_dataset_points, num_dataset_points + num_points)
+            .AsRvalue() = Tensor::Arange(num_indices_,
+                                         num_indices_ + num_points, 1,
+                                         Dtype::Int64, GetDevice());
+
+    dataset_points_ = dataset_points;
+    point_indices_ = point_indices;
+    num_indices_ += num_points;
+    points_row_splits_ =
+            std::vector<int64_t>({0, num_dataset_points + num_points});
+    BuildHashTable();
+    return true;
+}
+
+bool FixedRadiusIndex::RemovePoints(const Tensor &indices) {
+    if (points_row_splits_.size() > 2) {
+        utility::LogError(
+                "[FixedRadiusIndex::RemovePoints] Not supported for batched "
+                "indices.");
+    }
+    indices.AssertDtype(Dtype::Int64);
+    if (indices.NumDims() != 1) {
+        utility::LogError(
+                "[FixedRadiusIndex::RemovePoints] indices must be 1D, with "
+                "shape {n,}.");
+    }
+    if (indices.GetShape()[0] == 0) {
+        return true;
+    }
+    if (indices.Lt(0).Any() || indices.Ge(num_indices_).Any()) {
+        utility::LogError(
+                "[FixedRadiusIndex::RemovePoints] Indices out of range [0, "
+                "{}).",
+                num_indices_);
+    }
+
+    // Flag the removed dataset indices, then keep the points not flagged.
+    Tensor removed = Tensor::Zeros({num_indices_}, Dtype::Bool, GetDevice());
+    removed.IndexSet({indices.Copy(GetDevice())},
+                     Tensor::Ones({}, Dtype::Bool, GetDevice()));
+    Tensor keep = removed.IndexGet({point_indices_}).LogicalNot();
+
+    dataset_points_ = dataset_points_.IndexGet({keep}).Contiguous();
+    point_indices_ = point_indices_.IndexGet({keep}).Contiguous();
+    points_row_splits_ = std::vector<int64_t>(
+            {0, static_cast<int64_t>(GetDatasetSize())});
+    BuildHashTable();
+    return true;
+}
 
 std::tuple<Tensor, Tensor, Tensor> FixedRadiusIndex::SearchRadius(
         const Tensor &query_points, double radius) const {
-#ifdef BUILD_CUDA_MODULE
     // Check dtype.
     query_points.AssertDtype(GetDtype());
 
@@ -132,12 +291,49 @@ std::tuple<Tensor, Tensor, Tensor> FixedRadiusIndex::SearchRadius(
         utility::LogError(
                 "[FixedRadiusIndex::SearchRadius] radius should be positive.");
     }
+    if (points_row_splits_.size() > 2) {
+        utility::LogError(
+                "[FixedRadiusIndex::SearchRadius] queries_row_splits is "
+                "required for batched indices.");
+    }
+    int64_t num_query_points = query_points.GetShape()[0];
+    return SearchRadiusInBatches(query_points, {0, num_query_points}, radius);
+};
+
+std::tuple<Tensor, Tensor, Tensor> FixedRadiusIndex::SearchRadius(
+        const Tensor &query_points,
+        const Tensor &queries_row_splits,
+        double radius) const {
+    // Check dtype.
+    query_points.AssertDtype(GetDtype());
+
+    // Check shape.
+    query_points.AssertShapeCompatible({utility::nullopt, GetDimension()});
+
+    // Check device.
+    query_points.AssertDevice(GetDevice());
+
+    if (radius <= 0) {
+        utility::LogError(
+                "[FixedRadiusIndex::SearchRadius] radius should be positive.");
+    }
+    std::vector<int64_t> queries_splits =
+            GetRowSplits(queries_row_splits, query_points.GetShape()[0]);
+    if (queries_splits.size() != points_row_splits_.size()) {
+        utility::LogError(
+                "[FixedRadiusIndex::SearchRadius] Batch size of queries {} "
+                "does not match batch size of dataset points {}.",
+                queries_splits.size() - 1, points_row_splits_.size() - 1);
+    }
+    return SearchRadiusInBatches(query_points, queries_splits, radius);
+}
+
+std::tuple<Tensor, Tensor, Tensor> FixedRadiusIndex::SearchRadiusInBatches(
+        const Tensor &query_points,
+        const std::vector<int64_t> &queries_row_splits,
+        double radius) const {
     Tensor query_points_ = query_points.Contiguous();
     int64_t num_query_points = query_points_.GetShape()[0];
-    std::vector<int64_t> queries_row_splits({0, num_query_points});
-
-    void *temp_ptr = nullptr;
-    size_t temp_size = 0;
 
     Dtype dtype = GetDtype();
     Tensor neighbors_index;
@@ -145,61 +341,170 @@ std::tuple<Tensor, Tensor, Tensor> FixedRadiusIndex::SearchRadius(
     Tensor neighbors_row_splits = Tensor({num_query_points + 1}, Dtype::Int64,
                                          dataset_points_.GetDevice());
 
-    DISPATCH_FLOAT32_FLOAT64_DTYPE(dtype, [&]() {
-        NeighborSearchAllocator<scalar_t> output_allocator(
-                dataset_points_.GetDevice());
-        FixedRadiusSearchCUDA(
-                temp_ptr, temp_size,
-                static_cast<int64_t *>(neighbors_row_splits.GetDataPtr()),
-                GetDatasetSize(),
-                static_cast<const scalar_t *>(dataset_points_.GetDataPtr()),
-                num_query_points,
-                static_cast<scalar_t *>(query_points_.GetDataPtr()),
-                static_cast<scalar_t>(radius), points_row_splits_.size(),
-                points_row_splits_.data(), queries_row_splits.size(),
-                queries_row_splits.data(), hash_table_splits_.data(),
-                hash_table_cell_splits_.GetShape()[0],
-                (uint32_t *)static_cast<const int32_t *>(
-                        hash_table_cell_splits_.GetDataPtr()),
-                (uint32_t *)static_cast<const int32_t *>(
-                        hash_table_index_.GetDataPtr()),
-                output_allocator);
+    if (GetDevice().GetType() == Device::DeviceType::CPU) {
+        // The hash table cells only cover balls up to the radius of the
+        // index.
+        radius = ClampSearchRadius(radius, radius_, "SearchRadius");
+        DISPATCH_FLOAT32_FLOAT64_DTYPE(dtype, [&]() {
+            NeighborSearchAllocator<scalar_t> output_allocator(
+                    dataset_points_.GetDevice());
+            FixedRadiusSearchCPU(
+                    static_cast<int64_t *>(neighbors_row_splits.GetDataPtr()),
+                    GetDatasetSize(),
+                    static_cast<const scalar_t *>(
+                            hash_table_points_.GetDataPtr()),
+                    num_query_points,
+                    static_cast<const scalar_t *>(query_points_.GetDataPtr()),
+                    static_cast<scalar_t>(radius),
+                    static_cast<scalar_t>(radius_), points_row_splits_.size(),
+                    points_row_splits_.data(), queries_row_splits.size(),
+                    queries_row_splits.data(), hash_table_splits_.data(),
+                    hash_table_cell_splits_.GetShape()[0],
+                    (uint32_t *)static_cast<const int32_t *>(
+                            hash_table_cell_splits_.GetDataPtr()),
+                    (uint32_t *)static_cast<const int32_t *>(
+                            hash_table_index_.GetDataPtr()),
+                    output_allocator);
+            neighbors_index =
+                    output_allocator.NeighborsIndex().To(Dtype::Int64);
+            neighbors_distance = output_allocator.NeighborsDistance();
+        });
+    } else {
+#ifdef BUILD_CUDA_MODULE
+        void *temp_ptr = nullptr;
+        size_t temp_size = 0;
 
-        Tensor temp_tensor = Tensor::Empty({int64_t(temp_size)}, Dtype::UInt8,
-                                           dataset_points_.GetDevice());
-        temp_ptr = temp_tensor.GetDataPtr();
+        DISPATCH_FLOAT32_FLOAT64_DTYPE(dtype, [&]() {
+            NeighborSearchAllocator<scalar_t> output_allocator(
+                    dataset_points_.GetDevice());
+            FixedRadiusSearchCUDA(
+                    temp_ptr, temp_size,
+                    static_cast<int64_t *>(neighbors_row_splits.GetDataPtr()),
+                    GetDatasetSize(),
+                    static_cast<const scalar_t *>(dataset_points_.GetDataPtr()),
+                    num_query_points,
+                    static_cast<scalar_t *>(query_points_.GetDataPtr()),
+                    static_cast<scalar_t>(radius), points_row_splits_.size(),
+                    points_row_splits_.data(), queries_row_splits.size(),
+                    queries_row_splits.data(), hash_table_splits_.data(),
+                    hash_table_cell_splits_.GetShape()[0],
+                    (uint32_t *)static_cast<const int32_t *>(
+                            hash_table_cell_splits_.GetDataPtr()),
+                    (uint32_t *)static_cast<const int32_t *>(
+                            hash_table_index_.GetDataPtr()),
+                    output_allocator);
+
+            Tensor temp_tensor =
+                    Tensor::Empty({int64_t(temp_size)}, Dtype::UInt8,
+                                  dataset_points_.GetDevice());
+            temp_ptr = temp_tensor.GetDataPtr();
+
+            FixedRadiusSearchCUDA(
+                    temp_ptr, temp_size,
+                    static_cast<int64_t *>(neighbors_row_splits.GetDataPtr()),
+                    GetDatasetSize(),
+                    static_cast<const scalar_t *>(dataset_points_.GetDataPtr()),
+                    num_query_points,
+                    static_cast<scalar_t *>(query_points_.GetDataPtr()),
+                    static_cast<scalar_t>(radius), points_row_splits_.size(),
+                    points_row_splits_.data(), queries_row_splits.size(),
+                    queries_row_splits.data(), hash_table_splits_.data(),
+                    hash_table_cell_splits_.GetShape()[0],
+                    (uint32_t *)static_cast<const int32_t *>(
+                            hash_table_cell_splits_.GetDataPtr()),
+                    (uint32_t *)static_cast<const int32_t *>(
+                            hash_table_index_.GetDataPtr()),
+                    output_allocator);
+
+            neighbors_index =
+                    output_allocator.NeighborsIndex().To(Dtype::Int64);
+            neighbors_distance = output_allocator.NeighborsDistance();
+        });
+#endif
+    }
+
+    // Map back to dataset indices after removals.
+    if (int64_t(GetDatasetSize()) != num_indices_) {
+        neighbors_index = point_indices_.IndexGet({neighbors_index});
+    }
+
+    Tensor num_neighbors =
+            neighbors_row_splits.Slice(0, 1, num_query_points + 1)
+                    .Sub(neighbors_row_splits.Slice(0, 0, num_query_points));
+    return std::make_tuple(neighbors_index, neighbors_distance, num_neighbors);
+}
+
+std::pair<Tensor, Tensor> FixedRadiusIndex::SearchHybrid(
+        const Tensor &query_points, float radius, int max_knn) const {
+    // Check dtype.
+    query_points.AssertDtype(GetDtype());
+
+    // Check shape.
+    query_points.AssertShapeCompatible({utility::nullopt, GetDimension()});
+
+    // Check device.
+    query_points.AssertDevice(GetDevice());
+
+    if (GetDevice().GetType() != Device::DeviceType::CPU) {
+        utility::LogError(
+                "[FixedRadiusIndex::SearchHybrid] Only implemented for CPU "
+                "tensors.");
+    }
+    if (max_knn <= 0) {
+        utility::LogError(
+                "[FixedRadiusIndex::SearchHybrid] max_knn should be larger "
+                "than 0.");
+    }
+    if (radius <= 0) {
+        utility::LogError(
+                "[FixedRadiusIndex::SearchHybrid] radius should be larger "
+                "than 0.");
+    }
+    if (points_row_splits_.size() > 2) {
+        utility::LogError(
+                "[FixedRadiusIndex::SearchHybrid] Not supported for batched "
+                "indices.");
+    }
+    // As for the other indices, radius bounds the squared distances.
+    double max_sqr_distance =
+            ClampSearchRadius(radius, radius_ * radius_, "SearchHybrid");
 
-        FixedRadiusSearchCUDA(
-                temp_ptr, temp_size,
-                static_cast<int64_t *>(neighbors_row_splits.GetDataPtr()),
+    Tensor query_points_ = query_points.Contiguous();
+    int64_t num_query_points = query_points_.GetShape()[0];
+    int64_t queries_row_splits[2] = {0, num_query_points};
+    Dtype dtype = GetDtype();
+    Tensor indices = Tensor::Empty({num_query_points, max_knn}, Dtype::Int64,
+                                   GetDevice());
+    Tensor distances =
+            Tensor::Empty({num_query_points, max_knn}, dtype, GetDevice());
+    DISPATCH_FLOAT32_FLOAT64_DTYPE(dtype, [&]() {
+        HybridSearchCPU(
                 GetDatasetSize(),
-                static_cast<const scalar_t *>(dataset_points_.GetDataPtr()),
+                static_cast<const scalar_t *>(hash_table_points_.GetDataPtr()),
                 num_query_points,
-                static_cast<scalar_t *>(query_points_.GetDataPtr()),
-                static_cast<scalar_t>(radius), points_row_splits_.size(),
-                points_row_splits_.data(), queries_row_splits.size(),
-                queries_row_splits.data(), hash_table_splits_.data(),
+                static_cast<const scalar_t *>(query_points_.GetDataPtr()),
+                static_cast<scalar_t>(max_sqr_distance),
+                static_cast<scalar_t>(radius_), max_knn,
+                points_row_splits_.size(), points_row_splits_.data(), 2,
+                queries_row_splits,
+                hash_table_splits_.data(),
                 hash_table_cell_splits_.GetShape()[0],
                 (uint32_t *)static_cast<const int32_t *>(
                         hash_table_cell_splits_.GetDataPtr()),
                 (uint32_t *)static_cast<const int32_t *>(
                         hash_table_index_.GetDataPtr()),
-                output_allocator);
-
-        neighbors_index = output_allocator.NeighborsIndex().To(Dtype::Int64);
-        neighbors_distance = output_allocator.NeighborsDistance();
+                static_cast<int64_t *>(indices.GetDataPtr()),
+                static_cast<scalar_t *>(distances.GetDataPtr()));
     });
 
-    Tensor num_neighbors =
-            neighbors_row_splits.Slice(0, 1, num_query_points + 1)
-                    .Sub(neighbors_row_splits.Slice(0, 0, num_query_points));
-    return std::make_tuple(neighbors_index, neighbors_distance, num_neighbors);
-#else
-    utility::LogError(
-            "FixedRadiusIndex::SearchRadius BUILD_CUDA_MODULE is OFF. Please "
-            "compile Open3d with BUILD_CUDA_MODULE=ON.");
-#endif
-};
+    // Map back to dataset indices after removals.
+    if (int64_t(GetDatasetSize()) != num_indices_) {
+        Tensor valid = indices.Ne(-1);
+        indices.IndexSet({valid},
+                         point_indices_.IndexGet({indices.IndexGet({valid})}));
+    }
+    return std::make_pair(indices, distances);
+}
 
 }  // namespace nns
 }  // namespace core
@@ -39,6 +39,11 @@ namespace nns {
 /// \class FixedRadiusIndex
 ///
 /// \brief FixedRadiusIndex for nearest neighbor range search.
+///
+/// The 3D dataset points are bucketed in a spatial hash table with voxels of
+/// twice the radius of the index, on CPU or CUDA devices. On the CPU, search
+/// radii must not exceed the radius of the index and the neighbors of each
+/// query are sorted by distance.
 class FixedRadiusIndex : public NNSIndex {
 public:
     /// \brief Default Constructor.
@@ -62,6 +67,21 @@ public:
 
     bool SetTensorData(const Tensor& dataset_points, double radius) override;
 
+    /// Set the data of a batch of datasets. Each batch gets its own part of
+    /// the spatial hash table and the batched searches only return neighbors
+    /// from the batch of the query. Batched indices do not support adding and
+    /// removing points.
+    ///
+    /// \param dataset_points Dataset points of all the batches. Must be 2D,
+    /// with shape {n, d}.
+    /// \param points_row_splits Row splits of the batches in dataset_points.
+    /// Must be 1D, with shape {batch_size + 1,} and dtype Int64.
+    /// \param radius Radius of the searches.
+    /// \return Returns true if the construction success, otherwise false.
+    bool SetTensorData(const Tensor& dataset_points,
+                       const Tensor& points_row_splits,
+                       double radius);
+
     std::pair<Tensor, Tensor> SearchKnn(const Tensor& query_points,
                                         int knn) const override {
         utility::LogError("FixedRadiusIndex::SearchKnn not implemented.");
@@ -86,21 +106,79 @@ public:
     std::tuple<Tensor, Tensor, Tensor> SearchRadius(
             const Tensor& query_points, double radius) const override;
 
+    /// Perform radius search on a batched index. The search of all the
+    /// batches is done with a single call to FixedRadiusSearchCUDA or
+    /// FixedRadiusSearchCPU.
+    ///
+    /// \param query_points Query points of all the batches. Must be 2D, with
+    /// shape {m, d}, same dtype with dataset_points.
+    /// \param queries_row_splits Row splits of the batches in query_points.
+    /// Must be 1D, with shape {batch_size + 1,} and dtype Int64.
+    /// \param radius Radius.
+    /// \return Tuple of Tensors, (indices, distances, num_neighbors):
+    /// - indicecs: Tensor of shape {total_num_neighbors,}, dtype Int64.
+    /// Indices are rows of dataset_points.
+    /// - distances: Tensor of shape {total_num_neighbors,}, same dtype with
+    /// dataset_points.
+    /// - num_neighbors: Tensor of shape {m}, dtype Int64.
+    std::tuple<Tensor, Tensor, Tensor> SearchRadius(
+            const Tensor& query_points,
+            const Tensor& queries_row_splits,
+            double radius) const;
+
+    /// Perform hybrid search, only implemented for CPU tensors.
+    ///
+    /// \param query_points Query points. Must be 2D, with shape {n, d}, same
+    /// dtype with dataset_points.
+    /// \param radius Maximum squared distance of the neighbors, as for the
+    /// other indices. Must not be larger than the squared radius of the index.
+    /// \param max_knn Maximum number of neighbors to search per query point.
+    /// \return Pair of Tensors, (indices, distances):
+    /// - indices: Tensor of shape {n, max_knn}, dtype Int64, -1 for missing
+    /// neighbors.
+    /// - distances: Tensor of shape {n, max_knn}, same dtype with
+    /// dataset_points, -1 for missing neighbors.
     std::pair<Tensor, Tensor> SearchHybrid(const Tensor& query_points,
                                            float radius,
-                                           int max_knn) const override {
-        utility::LogError("FixedRadiusIndex::SearchHybrid not implemented.");
-    }
+                                           int max_knn) const override;
+
+    /// Add points to the index. The spatial hash table is rebuilt over all
+    /// points, which takes linear time.
+    bool AddPoints(const Tensor& points) override;
 
-    const double hash_table_size_factor = 1 / 32;
-    const int64_t max_hash_tabls_size = 10000;
+    /// Remove points from the index. The remaining points are compacted and
+    /// the spatial hash table is rebuilt, which takes linear time.
+    bool RemovePoints(const Tensor& indices) override;
+
+    const double hash_table_size_factor = 0.25;
+    const int64_t max_hash_tabls_size = 33554432;
 
 protected:
+    /// Builds the spatial hash table of dataset_points_ with radius_, one
+    /// part per batch of points_row_splits_.
+    void BuildHashTable();
+
+    /// Searches the queries of each batch of \p queries_row_splits in the
+    /// hash table of the same batch.
+    std::tuple<Tensor, Tensor, Tensor> SearchRadiusInBatches(
+            const Tensor& query_points,
+            const std::vector<int64_t>& queries_row_splits,
+            double radius) const;
+
+    double radius_;
+    /// Dataset index of each point of dataset_points_. Search results are
+    /// mapped through it once points have been removed.
+    Tensor point_indices_;
+    /// Number of dataset indices handed out, removed ones included.
+    int64_t num_indices_ = 0;
+
     std::vector<int64_t> points_row_splits_;
     std::vector<uint32_t> hash_table_splits_;
     std::vector<uint32_t> out_hash_table_splits_;
     Tensor hash_table_cell_splits_;
     Tensor hash_table_index_;
+    /// Dataset points in hash table order, only built on the CPU.
+    Tensor hash_table_points_;
 };
 
 template <class T>
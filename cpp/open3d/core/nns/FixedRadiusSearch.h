@@ -202,6 +202,88 @@ void FixedRadiusSearchCUDA(void* temp,
                            const uint32_t* const hash_table_index,
                            NeighborSearchAllocator<T>& output_allocator);
 
+/// Builds a spatial hash table for a fixed radius search of 3D points on the
+/// CPU. The arguments are the same as for BuildSpatialHashTableCUDA, except
+/// that all pointers point to host memory and no temporary memory is needed.
+/// The indices within each cell of the hash table are sorted.
+///
+/// \param hash_table_points    This is an output array storing the points in
+///        the order of \p hash_table_index, for contiguous reads of the cells
+///        by the searches. The size of the array is 3 * num_points.
+template <class TReal, class TIndex>
+void BuildSpatialHashTableCPU(const size_t num_points,
+                              const TReal* const points,
+                              const TReal radius,
+                              const size_t points_row_splits_size,
+                              const int64_t* points_row_splits,
+                              const TIndex* hash_table_splits,
+                              const size_t hash_table_cell_splits_size,
+                              TIndex* hash_table_cell_splits,
+                              TIndex* hash_table_index,
+                              TReal* hash_table_points);
+
+/// Fixed radius search on the CPU. The arguments are the same as for
+/// FixedRadiusSearchCUDA, except that all pointers point to host memory and
+/// no temporary memory is needed. The neighbors of each query are sorted by
+/// their squared L2 distance.
+///
+/// \param hash_table_points    The points in hash table order, an output of
+///        BuildSpatialHashTableCPU. Replaces the points argument of
+///        FixedRadiusSearchCUDA.
+///
+/// \param hash_table_radius    The radius the hash table was built with. The
+///        search \p radius must not be larger.
+template <class T>
+void FixedRadiusSearchCPU(int64_t* query_neighbors_row_splits,
+                          size_t num_points,
+                          const T* const hash_table_points,
+                          size_t num_queries,
+                          const T* const queries,
+                          const T radius,
+                          const T hash_table_radius,
+                          const size_t points_row_splits_size,
+                          const int64_t* const points_row_splits,
+                          const size_t queries_row_splits_size,
+                          const int64_t* const queries_row_splits,
+                          const uint32_t* const hash_table_splits,
+                          size_t hash_table_cell_splits_size,
+                          const uint32_t* const hash_table_cell_splits,
+                          const uint32_t* const hash_table_index,
+                          NeighborSearchAllocator<T>& output_allocator);
+
+/// Hybrid search on the CPU with a spatial hash table built by
+/// BuildSpatialHashTableCPU. For each query, up to \p max_knn nearest
+/// neighbors with a squared L2 distance of at most \p max_sqr_distance are
+/// returned, sorted by distance. \p hash_table_points are the points in hash
+/// table order, see FixedRadiusSearchCPU.
+///
+/// \param max_sqr_distance    Maximum squared distance of the neighbors. Must
+///        not be larger than the square of \p hash_table_radius.
+///
+/// \param neighbors_index    Output array of shape {num_queries, max_knn}.
+///        Missing neighbors are set to -1.
+///
+/// \param neighbors_distance    Output array of shape {num_queries, max_knn}
+///        with the squared distances. Missing neighbors are set to -1.
+template <class T>
+void HybridSearchCPU(size_t num_points,
+                     const T* const hash_table_points,
+                     size_t num_queries,
+                     const T* const queries,
+                     const T max_sqr_distance,
+                     const T hash_table_radius,
+                     const int max_knn,
+                     const size_t points_row_splits_size,
+                     const int64_t* const points_row_splits,
+                     const size_t queries_row_splits_size,
+                     const int64_t* const queries_row_splits,
+                     const uint32_t* const hash_table_splits,
+                     size_t hash_table_cell_splits_size,
+                     const uint32_t* const hash_table_cell_splits,
+                     const uint32_t* const hash_table_index,
+                     int64_t* neighbors_index,
+                     T* neighbors_distance);
+
 }  // namespace nns
 }  // namespace core
 }  // namespace open3d
@@ -0,0 +1,366 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include <algorithm>
+#include <vector>
+
+#include "open3d/core/nns/FixedRadiusSearch.h"
+#include "open3d/core/nns/NeighborSearchCommon.h"
+#include "open3d/utility/MiniVec.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace core {
+namespace nns {
+
+namespace {
+
+template <class T>
+using Vec3 = utility::MiniVec<T, 3>;
+
+/// Maximum number of hash table cells overlapped by a query ball.
+constexpr int kMaxQueryCells = 9;
+
+/// Computes the hash table cells to visit for a query ball of radius
+/// \p hash_table_radius. With a voxel size of twice the radius, the ball
+/// overlaps at most two voxels per axis, which are the voxels of its
+/// bounding box corners. The voxel of the center is added for robustness
+/// against rounding at voxel borders.
+///
+/// \return Returns the number of unique cells written to \p cells.
+template <class T>
+int GetQueryCells(const Vec3<T>& pos,
+                  T hash_table_radius,
+                  T inv_voxel_size,
+                  size_t hash_table_size,
+                  size_t first_cell_idx,
+                  size_t* cells) {
+    int num_cells = 0;
+    cells[num_cells++] =
+            first_cell_idx +
+            SpatialHash(ComputeVoxelIndex(pos, inv_voxel_size)) %
+                    hash_table_size;
+    for (int dz = -1; dz <= 1; dz += 2) {
+        for (int dy = -1; dy <= 1; dy += 2) {
+            for (int dx = -1; dx <= 1; dx += 2) {
+                Vec3<T> p = pos + hash_table_radius * Vec3<T>(T(dx), T(dy),
+                                                              T(dz));
+                cells[num_cells++] =
+                        first_cell_idx +
+                        SpatialHash(ComputeVoxelIndex(p, inv_voxel_size)) %
+                                hash_table_size;
+            }
+        }
+    }
+    std::sort(cells, cells + num_cells);
+    return int(std::unique(cells, cells + num_cells) - cells);
+}
+
+/// Calls \p func(point_idx, sqr_distance) for each point of the hash table
+/// cells of the query within \p threshold squared distance. The points of
+/// the cells are read from \p hash_table_points, in hash table order.
+template <class T, class Func>
+void ForEachNeighbor(const Vec3<T>& pos,
+                     const T* const hash_table_points,
+                     T threshold,
+                     const size_t* cells,
+                     int num_cells,
+                     const uint32_t* const hash_table_cell_splits,
+                     const uint32_t* const hash_table_index,
+                     Func func) {
+    for (int c = 0; c < num_cells; ++c) {
+        const uint32_t begin_idx = hash_table_cell_splits[cells[c]];
+        const uint32_t end_idx = hash_table_cell_splits[cells[c] + 1];
+        for (uint32_t j = begin_idx; j < end_idx; ++j) {
+            const T dx = hash_table_points[3 * j + 0] - pos[0];
+            const T dy = hash_table_points[3 * j + 1] - pos[1];
+            const T dz = hash_table_points[3 * j + 2] - pos[2];
+            const T dist = dx * dx + dy * dy + dz * dz;
+            if (dist <= threshold) {
+                func(hash_table_index[j], dist);
+            }
+        }
+    }
+}
+
+}  // namespace
+
+template <class TReal, class TIndex>
+void BuildSpatialHashTableCPU(const size_t num_points,
+                              const TReal* const points,
+                              const TReal radius,
+                              const size_t points_row_splits_size,
+                              const int64_t* points_row_splits,
+                              const TIndex* hash_table_splits,
+                              const size_t hash_table_cell_splits_size,
+                              TIndex* hash_table_cell_splits,
+                              TIndex* hash_table_index,
+                              TReal* hash_table_points) {
+    const int64_t batch_size = int64_t(points_row_splits_size) - 1;
+    const TReal inv_voxel_size = 1 / (2 * radius);
+
+    // Hash the points in parallel. Counting and scattering are linear
+    // passes over the cells, done serially so that the indices within each
+    // cell stay sorted.
+    std::vector<TIndex> point_cells(num_points);
+    for (int64_t b = 0; b < batch_size; ++b) {
+        const size_t hash_table_size =
+                hash_table_splits[b + 1] - hash_table_splits[b];
+        const size_t first_cell_idx = hash_table_splits[b];
+        const int64_t begin = points_row_splits[b];
+        const int64_t end = points_row_splits[b + 1];
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+        for (int64_t i = begin; i < end; ++i) {
+            Vec3<TReal> pos(points + 3 * i);
+            point_cells[i] = TIndex(
+                    first_cell_idx +
+                    SpatialHash(ComputeVoxelIndex(pos, inv_voxel_size)) %
+                            hash_table_size);
+        }
+    }
+
+    std::fill(hash_table_cell_splits,
+              hash_table_cell_splits + hash_table_cell_splits_size, 0);
+    for (size_t i = 0; i < num_points; ++i) {
+        hash_table_cell_splits[point_cells[i] + 1]++;
+    }
+    for (size_t c = 1; c < hash_table_cell_splits_size; ++c) {
+        hash_table_cell_splits[c] += hash_table_cell_splits[c - 1];
+    }
+    std::vector<TIndex> offsets(hash_table_cell_splits,
+                                hash_table_cell_splits +
+                                        hash_table_cell_splits_size - 1);
+    for (size_t i = 0; i < num_points; ++i) {
+        hash_table_index[offsets[point_cells[i]]++] = TIndex(i);
+    }
+
+    // Copy the points in hash table order, so that the points of a cell are
+    // read contiguously by the searches.
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int64_t j = 0; j < int64_t(num_points); ++j) {
+        const TIndex idx = hash_table_index[j];
+        hash_table_points[3 * j + 0] = points[3 * idx + 0];
+        hash_table_points[3 * j + 1] = points[3 * idx + 1];
+        hash_table_points[3 * j + 2] = points[3 * idx + 2];
+    }
+}
+
+template <class T>
+void FixedRadiusSearchCPU(int64_t* query_neighbors_row_splits,
+                          size_t num_points,
+                          const T* const hash_table_points,
+                          size_t num_queries,
+                          const T* const queries,
+                          const T radius,
+                          const T hash_table_radius,
+                          const size_t points_row_splits_size,
+                          const int64_t* const points_row_splits,
+                          const size_t queries_row_splits_size,
+                          const int64_t* const queries_row_splits,
+                          const uint32_t* const hash_table_splits,
+                          size_t hash_table_cell_splits_size,
+                          const uint32_t* const hash_table_cell_splits,
+                          const uint32_t* const hash_table_index,
+                          NeighborSearchAllocator<T>& output_allocator) {
+    const int64_t batch_size = int64_t(points_row_splits_size) - 1;
+    const T threshold = radius * radius;
+    const T inv_voxel_size = 1 / (2 * hash_table_radius);
+
+    query_neighbors_row_splits[0] = 0;
+    if (num_points == 0 || num_queries == 0) {
+        std::fill(query_neighbors_row_splits,
+                  query_neighbors_row_splits + num_queries + 1, 0);
+        int32_t* indices_ptr;
+        output_allocator.AllocIndices(&indices_ptr, 0);
+        T* distances_ptr;
+        output_allocator.AllocDistances(&distances_ptr, 0);
+        return;
+    }
+
+    // Count the neighbors of each query.
+    for (int64_t b = 0; b < batch_size; ++b) {
+        const size_t hash_table_size =
+                hash_table_splits[b + 1] - hash_table_splits[b];
+        const size_t first_cell_idx = hash_table_splits[b];
+        const int64_t begin = queries_row_splits[b];
+        const int64_t end = queries_row_splits[b + 1];
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+        for (int64_t i = begin; i < end; ++i) {
+            Vec3<T> pos(queries + 3 * i);
+            size_t cells[kMaxQueryCells];
+            int num_cells = GetQueryCells(pos, hash_table_radius,
+                                          inv_voxel_size, hash_table_size,
+                                          first_cell_idx, cells);
+            int64_t count = 0;
+            ForEachNeighbor(pos, hash_table_points, threshold, cells, num_cells,
+                            hash_table_cell_splits, hash_table_index,
+                            [&count](uint32_t, T) { count++; });
+            query_neighbors_row_splits[i + 1] = count;
+        }
+    }
+    for (size_t i = 0; i < num_queries; ++i) {
+        query_neighbors_row_splits[i + 1] += query_neighbors_row_splits[i];
+    }
+
+    const size_t num_indices = query_neighbors_row_splits[num_queries];
+    int32_t* indices_ptr;
+    output_allocator.AllocIndices(&indices_ptr, num_indices);
+    T* distances_ptr;
+    output_allocator.AllocDistances(&distances_ptr, num_indices);
+
+    // Write the neighbors of each query, sorted by distance.
+    for (int64_t b = 0; b < batch_size; ++b) {
+        const size_t hash_table_size =
+                hash_table_splits[b + 1] - hash_table_splits[b];
+        const size_t first_cell_idx = hash_table_splits[b];
+        const int64_t begin = queries_row_splits[b];
+        const int64_t end = queries_row_splits[b + 1];
+#pragma omp parallel num_threads(utility::EstimateMaxThreads())
+        {
+            std::vector<std::pair<T, int32_t>> neighbors;
+#pragma omp for schedule(static)
+            for (int64_t i = begin; i < end; ++i) {
+                Vec3<T> pos(queries + 3 * i);
+                size_t cells[kMaxQueryCells];
+                int num_cells = GetQueryCells(pos, hash_table_radius,
+                                              inv_voxel_size, hash_table_size,
+                                              first_cell_idx, cells);
+                neighbors.clear();
+                ForEachNeighbor(pos, hash_table_points, threshold, cells,
+                                num_cells, hash_table_cell_splits,
+                                hash_table_index,
+                                [&neighbors](uint32_t idx, T dist) {
+                                    neighbors.emplace_back(dist, int32_t(idx));
+                                });
+                std::sort(neighbors.begin(), neighbors.end());
+                const int64_t offset = query_neighbors_row_splits[i];
+                for (size_t k = 0; k < neighbors.size(); ++k) {
+                    indices_ptr[offset + k] = neighbors[k].second;
+                    distances_ptr[offset + k] = neighbors[k].first;
+                }
+            }
+        }
+    }
+}
+
+template <class T>
+void HybridSearchCPU(size_t num_points,
+                     const T* const hash_table_points,
+                     size_t num_queries,
+                     const T* const queries,
+                     const T max_sqr_distance,
+                     const T hash_table_radius,
+                     const int max_knn,
+                     const size_t points_row_splits_size,
+                     const int64_t* const points_row_splits,
+                     const size_t queries_row_splits_size,
+                     const int64_t* const queries_row_splits,
+                     const uint32_t* const hash_table_splits,
+                     size_t hash_table_cell_splits_size,
+                     const uint32_t* const hash_table_cell_splits,
+                     const uint32_t* const hash_table_index,
+                     int64_t* neighbors_index,
+                     T* neighbors_distance) {
+    const int64_t batch_size = int64_t(points_row_splits_size) - 1;
+    const T inv_voxel_size = 1 / (2 * hash_table_radius);
+
+    std::fill(neighbors_index, neighbors_index + num_queries * max_knn, -1);
+    std::fill(neighbors_distance, neighbors_distance + num_queries * max_knn,
+              T(-1));
+    if (num_points == 0) {
+        return;
+    }
+
+    for (int64_t b = 0; b < batch_size; ++b) {
+        const size_t hash_table_size =
+                hash_table_splits[b + 1] - hash_table_splits[b];
+        const size_t first_cell_idx = hash_table_splits[b];
+        const int64_t begin = queries_row_splits[b];
+        const int64_t end = queries_row_splits[b + 1];
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+        for (int64_t i = begin; i < end; ++i) {
+            Vec3<T> pos(queries + 3 * i);
+            size_t cells[kMaxQueryCells];
+            int num_cells = GetQueryCells(pos, hash_table_radius,
+                                          inv_voxel_size, hash_table_size,
+                                          first_cell_idx, cells);
+            // Keep the max_knn nearest neighbors sorted by insertion, ties
+            // broken by index.
+            int64_t* knn_index = neighbors_index + i * max_knn;
+            T* knn_distance = neighbors_distance + i * max_knn;
+            int num_found = 0;
+            ForEachNeighbor(
+                    pos, hash_table_points, max_sqr_distance, cells, num_cells,
+                    hash_table_cell_splits, hash_table_index,
+                    [&](uint32_t idx, T dist) {
+                        if (num_found == max_knn &&
+                            (dist > knn_distance[max_knn - 1] ||
+                             (dist == knn_distance[max_knn - 1] &&
+                              idx > knn_index[max_knn - 1]))) {
+                            return;
+                        }
+                        int k = num_found < max_knn ? num_found++
+                                                    : max_knn - 1;
+                        while (k > 0 && (knn_distance[k - 1] > dist ||
+                                         (knn_distance[k - 1] == dist &&
+                                          knn_index[k - 1] > idx))) {
+                            knn_distance[k] = knn_distance[k - 1];
+                            knn_index[k] = knn_index[k - 1];
+                            --k;
+                        }
+                        knn_distance[k] = dist;
+                        knn_index[k] = idx;
+                    });
+        }
+    }
+}
+
+#define INSTANTIATE(T)                                                        \
+    template void BuildSpatialHashTableCPU<T, uint32_t>(                      \
+            const size_t, const T* const, const T, const size_t,              \
+            const int64_t*, const uint32_t*, const size_t, uint32_t*,         \
+            uint32_t*, T*);                                                   \
+    template void FixedRadiusSearchCPU<T>(                                    \
+            int64_t*, size_t, const T* const, size_t, const T* const,         \
+            const T, const T, const size_t, const int64_t* const,             \
+            const size_t, const int64_t* const, const uint32_t* const,        \
+            size_t, const uint32_t* const, const uint32_t* const,             \
+            NeighborSearchAllocator<T>&);                                     \
+    template void HybridSearchCPU<T>(                                         \
+            size_t, const T* const, size_t, const T* const, const T, const T, \
+            const int, const size_t, const int64_t* const, const size_t,      \
+            const int64_t* const, const uint32_t* const, size_t,              \
+            const uint32_t* const, const uint32_t* const, int64_t*, T*);
+
+INSTANTIATE(float)
+INSTANTIATE(double)
+
+#undef INSTANTIATE
+
+}  // namespace nns
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,192 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 4267)
+#endif
+
+#include "open3d/core/nns/FlannIndex.h"
+
+#include <tbb/parallel_for.h>
+
+#include <algorithm>
+#include <flann/flann.hpp>
+
+#include "open3d/core/CoreUtil.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+namespace nns {
+
+namespace {
+
+/// FLANN Index Holder.
+template <class T>
+struct FlannIndexHolder : FlannIndexHolderBase {
+    FlannIndexHolder(size_t dataset_size,
+                     int dimension,
+                     const T *data_ptr,
+                     int num_trees)
+        : dataset_(const_cast<T *>(data_ptr), dataset_size, dimension) {
+        index_.reset(new flann::Index<flann::L2<T>>(
+                dataset_, flann::KDTreeIndexParams(num_trees)));
+        index_->buildIndex();
+    }
+
+    flann::Matrix<T> dataset_;
+    std::unique_ptr<flann::Index<flann::L2<T>>> index_;
+};
+
+}  // namespace
+
+constexpr int FlannIndex::kDefaultNumTrees;
+constexpr int FlannIndex::kDefaultChecks;
+
+FlannIndex::FlannIndex(int num_trees) : num_trees_(num_trees) {}
+
+FlannIndex::FlannIndex(const Tensor &dataset_points, int num_trees)
+    : num_trees_(num_trees) {
+    SetTensorData(dataset_points);
+}
+
+FlannIndex::~FlannIndex() {}
+
+bool FlannIndex::SetTensorData(const Tensor &dataset_points) {
+    if (dataset_points.NumDims() != 2) {
+        utility::LogError(
+                "[FlannIndex::SetTensorData] dataset_points must be 2D "
+                "matrix, with shape {n_dataset_points, d}.");
+    }
+    if (dataset_points.GetDevice().GetType() != Device::DeviceType::CPU) {
+        utility::LogError(
+                "[FlannIndex::SetTensorData] dataset_points should be CPU "
+                "Tensor.");
+    }
+    if (num_trees_ <= 0) {
+        utility::LogError(
+                "[FlannIndex::SetTensorData] num_trees should be larger than "
+                "0.");
+    }
+    dataset_points_ = dataset_points.Contiguous();
+    size_t dataset_size = GetDatasetSize();
+    int dimension = GetDimension();
+    if (dataset_size == 0 || dimension == 0) {
+        utility::LogError(
+                "[FlannIndex::SetTensorData] dataset_points should not be "
+                "empty.");
+    }
+
+    DISPATCH_FLOAT32_FLOAT64_DTYPE(GetDtype(), [&]() {
+        const scalar_t *data_ptr =
+                static_cast<const scalar_t *>(dataset_points_.GetDataPtr());
+        holder_.reset(new FlannIndexHolder<scalar_t>(dataset_size, dimension,
+                                                     data_ptr, num_trees_));
+    });
+    return true;
+}
+
+std::pair<Tensor, Tensor> FlannIndex::SearchKnn(const Tensor &query_points,
+                                                int knn) const {
+    return SearchKnn(query_points, knn, kDefaultChecks);
+}
+
+std::pair<Tensor, Tensor> FlannIndex::SearchKnn(const Tensor &query_points,
+                                                int knn,
+                                                int checks) const {
+    // Check dtype.
+    query_points.AssertDtype(GetDtype());
+
+    // Check shapes.
+    query_points.AssertShapeCompatible({utility::nullopt, GetDimension()});
+
+    // Check device.
+    query_points.AssertDevice(GetDevice());
+
+    if (knn <= 0) {
+        utility::LogError(
+                "[FlannIndex::SearchKnn] knn should be larger than 0.");
+    }
+    if (checks != flann::FLANN_CHECKS_UNLIMITED && checks <= 0) {
+        utility::LogError(
+                "[FlannIndex::SearchKnn] checks should be larger than 0, or "
+                "-1 for exact search.");
+    }
+
+    Tensor query_points_ = query_points.Contiguous();
+    int64_t num_query_points = query_points_.GetShape()[0];
+    int dimension = GetDimension();
+    knn = static_cast<int>(
+            std::min<int64_t>(knn, static_cast<int64_t>(GetDatasetSize())));
+    // Fewer checks than knn would leave neighbors unfilled.
+    if (checks != flann::FLANN_CHECKS_UNLIMITED) {
+        checks = std::max(checks, knn);
+    }
+
+    Dtype dtype = GetDtype();
+    Tensor indices = Tensor::Full({num_query_points, knn}, -1, Dtype::Int64);
+    Tensor distances;
+    DISPATCH_FLOAT32_FLOAT64_DTYPE(dtype, [&]() {
+        distances = Tensor::Full({num_query_points, knn}, -1, dtype);
+        auto holder = static_cast<FlannIndexHolder<scalar_t> *>(holder_.get());
+        flann::SearchParams params(checks);
+        scalar_t *query_ptr =
+                static_cast<scalar_t *>(query_points_.GetDataPtr());
+        int64_t *indices_ptr = static_cast<int64_t *>(indices.GetDataPtr());
+        scalar_t *distances_ptr =
+                static_cast<scalar_t *>(distances.GetDataPtr());
+
+        // Parallel search, by blocks of queries.
+        tbb::parallel_for(
+                tbb::blocked_range<int64_t>(0, num_query_points),
+                [&](const tbb::blocked_range<int64_t> &r) {
+                    size_t num_block_points = r.end() - r.begin();
+                    flann::Matrix<scalar_t> query_flann(
+                            query_ptr + r.begin() * dimension,
+                            num_block_points, dimension);
+                    std::vector<size_t> block_indices(num_block_points * knn);
+                    flann::Matrix<size_t> indices_flann(
+                            block_indices.data(), num_block_points, knn);
+                    flann::Matrix<scalar_t> distances_flann(
+                            distances_ptr + r.begin() * knn, num_block_points,
+                            knn);
+                    holder->index_->knnSearch(query_flann, indices_flann,
+                                              distances_flann, knn, params);
+                    std::copy(block_indices.begin(), block_indices.end(),
+                              indices_ptr + r.begin() * knn);
+                });
+    });
+    return std::make_pair(indices, distances);
+}
+
+}  // namespace nns
+}  // namespace core
+}  // namespace open3d
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
@@ -0,0 +1,132 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/nns/NNSIndex.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+namespace nns {
+
+/// Base struct for the FLANN index holder.
+struct FlannIndexHolderBase {
+    virtual ~FlannIndexHolderBase() {}
+};
+
+/// \class FlannIndex
+///
+/// \brief Randomized KDTree forest from FLANN for approximate knn search.
+///
+/// Each tree splits on a dimension picked at random among the ones with the
+/// largest variance. A search descends all the trees and then visits the
+/// closest unexplored branches of the forest until \p checks leaf points have
+/// been compared, which trades accuracy for speed. This is well suited to
+/// high dimensional data, e.g. 33-D FPFH features, where exact KDTrees degrade
+/// to a linear scan.
+class FlannIndex : public NNSIndex {
+public:
+    /// \brief Default Constructor.
+    ///
+    /// \param num_trees Number of randomized KDTrees. More trees raise the
+    /// recall for a given number of checks, at the cost of memory and build
+    /// time.
+    FlannIndex(int num_trees = kDefaultNumTrees);
+
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param dataset_points Provides a set of data points as Tensor for the
+    /// KDTree forest construction.
+    /// \param num_trees Number of randomized KDTrees.
+    FlannIndex(const Tensor &dataset_points, int num_trees = kDefaultNumTrees);
+    ~FlannIndex();
+    FlannIndex(const FlannIndex &) = delete;
+    FlannIndex &operator=(const FlannIndex &) = delete;
+
+public:
+    bool SetTensorData(const Tensor &dataset_points) override;
+
+    bool SetTensorData(const Tensor &dataset_points, double radius) override {
+        utility::LogError(
+                "FlannIndex::SetTensorData with radius not implemented.");
+    }
+
+    /// Perform approximate knn search with kDefaultChecks checks.
+    std::pair<Tensor, Tensor> SearchKnn(const Tensor &query_points,
+                                        int knn) const override;
+
+    /// Perform approximate knn search.
+    ///
+    /// \param query_points Query points. Must be 2D, with shape {n, d}, same
+    /// dtype with dataset_points.
+    /// \param knn Number of nearest neighbor to search.
+    /// \param checks Number of dataset points compared per query, at least
+    /// knn. Higher values are more accurate and slower. -1 gives the exact
+    /// neighbors.
+    /// \return Pair of Tensors: (indices, distances):
+    /// - indices: Tensor of shape {n, knn}, with dtype Int64.
+    /// - distainces: Tensor of shape {n, knn}, same dtype with dataset_points.
+    /// Distances are squared L2 distances sorted in ascending order. knn is
+    /// clipped to the number of dataset points.
+    std::pair<Tensor, Tensor> SearchKnn(const Tensor &query_points,
+                                        int knn,
+                                        int checks) const;
+
+    std::tuple<Tensor, Tensor, Tensor> SearchRadius(
+            const Tensor &query_points, const Tensor &radii) const override {
+        utility::LogError("FlannIndex::SearchRadius not implemented.");
+    }
+
+    std::tuple<Tensor, Tensor, Tensor> SearchRadius(
+            const Tensor &query_points, double radius) const override {
+        utility::LogError("FlannIndex::SearchRadius not implemented.");
+    }
+
+    std::pair<Tensor, Tensor> SearchHybrid(const Tensor &query_points,
+                                           float radius,
+                                           int max_knn) const override {
+        utility::LogError("FlannIndex::SearchHybrid not implemented.");
+    }
+
+    /// Default number of randomized KDTrees.
+    static constexpr int kDefaultNumTrees = 4;
+
+    /// Default number of checks of SearchKnn.
+    static constexpr int kDefaultChecks = 32;
+
+protected:
+    int num_trees_;
+    std::unique_ptr<FlannIndexHolderBase> holder_;
+};
+
+}  // namespace nns
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,331 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/nns/KnnIndex.h"
+
+#include <algorithm>
+#include <cmath>
+
+#ifdef BUILD_CUDA_MODULE
+#include "open3d/core/nns/FixedRadiusSearch.h"
+#include "open3d/core/nns/KnnSearch.h"
+#endif
+
+#include "open3d/core/CoreUtil.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+namespace nns {
+
+constexpr int KnnIndex::kMaxKnn;
+constexpr double KnnIndex::kPointsPerCell;
+
+KnnIndex::KnnIndex(){};
+
+KnnIndex::KnnIndex(const Tensor &dataset_points) {
+    SetTensorData(dataset_points);
+};
+
+KnnIndex::KnnIndex(const Tensor &dataset_points,
+                   const Tensor &points_row_splits) {
+    SetTensorData(dataset_points, points_row_splits);
+};
+
+KnnIndex::~KnnIndex(){};
+
+bool KnnIndex::SetTensorData(const Tensor &dataset_points) {
+#ifdef BUILD_CUDA_MODULE
+    if (dataset_points.GetDevice().GetType() != Device::DeviceType::CUDA) {
+        utility::LogError(
+                "[KnnIndex::SetTensorData] dataset_points should be GPU "
+                "Tensor.");
+    }
+    dataset_points.AssertShapeCompatible({utility::nullopt, 3});
+    if (dataset_points.GetShape()[0] == 0) {
+        utility::LogError(
+                "[KnnIndex::SetTensorData] dataset_points should not be "
+                "empty.");
+    }
+    dataset_points_ = dataset_points.Contiguous();
+    points_row_splits_ =
+            std::vector<int64_t>({0, static_cast<int64_t>(GetDatasetSize())});
+    BuildHashTable();
+    return true;
+#else
+    utility::LogError(
+            "KnnIndex::SetTensorData BUILD_CUDA_MODULE is OFF. Please compile "
+            "Open3d with BUILD_CUDA_MODULE=ON.");
+#endif
+};
+
+bool KnnIndex::SetTensorData(const Tensor &dataset_points,
+                             const Tensor &points_row_splits) {
+#ifdef BUILD_CUDA_MODULE
+    if (dataset_points.GetDevice().GetType() != Device::DeviceType::CUDA) {
+        utility::LogError(
+                "[KnnIndex::SetTensorData] dataset_points should be GPU "
+                "Tensor.");
+    }
+    dataset_points.AssertShapeCompatible({utility::nullopt, 3});
+    if (dataset_points.GetShape()[0] == 0) {
+        utility::LogError(
+                "[KnnIndex::SetTensorData] dataset_points should not be "
+                "empty.");
+    }
+    dataset_points_ = dataset_points.Contiguous();
+    points_row_splits_ = GetRowSplits(
+            points_row_splits, static_cast<int64_t>(GetDatasetSize()));
+    BuildHashTable();
+    return true;
+#else
+    utility::LogError(
+            "KnnIndex::SetTensorData BUILD_CUDA_MODULE is OFF. Please compile "
+            "Open3d with BUILD_CUDA_MODULE=ON.");
+#endif
+}
+
+void KnnIndex::BuildHashTable() {
+#ifdef BUILD_CUDA_MODULE
+    int64_t num_points = GetDatasetSize();
+
+    // Pick the cell size for kPointsPerCell points per cell on average over
+    // the non-degenerated extents of the bounding box, assuming that the
+    // batches cover the same volume.
+    size_t num_batches = points_row_splits_.size() - 1;
+    double num_points_per_batch = double(num_points) / num_batches;
+    std::vector<double> min_bound =
+            dataset_points_.Min({0}).To(Dtype::Float64).ToFlatVector<double>();
+    std::vector<double> max_bound =
+            dataset_points_.Max({0}).To(Dtype::Float64).ToFlatVector<double>();
+    double volume = 1;
+    double max_extent = 0;
+    int num_extents = 0;
+    for (int i = 0; i < 3; ++i) {
+        double extent = max_bound[i] - min_bound[i];
+        if (extent > 0) {
+            volume *= extent;
+            max_extent = std::max(max_extent, extent);
+            ++num_extents;
+        }
+    }
+    double cell_size = 1;
+    if (num_extents > 0) {
+        cell_size = std::pow(volume * kPointsPerCell / num_points_per_batch,
+                             1.0 / num_extents);
+        // Keep voxel indices far from the int range.
+        cell_size = std::max(cell_size, max_extent / (1 << 20));
+    }
+    cell_radius_ = cell_size / 2;
+
+    // Pad by one cell to be robust to rounding of the voxel indices computed
+    // with the dtype of the points.
+    for (int i = 0; i < 3; ++i) {
+        grid_min_[i] = static_cast<int>(std::floor(min_bound[i] / cell_size));
+        grid_max_[i] = static_cast<int>(std::floor(max_bound[i] / cell_size));
+        grid_min_[i] -= 1;
+        grid_max_[i] += 1;
+    }
+
+    hash_table_splits_ = std::vector<uint32_t>(num_batches + 1, 0);
+    for (size_t i = 0; i < num_batches; ++i) {
+        int64_t num_points_i =
+                points_row_splits_[i + 1] - points_row_splits_[i];
+        int64_t hash_table_size = std::max<int64_t>(
+                static_cast<int64_t>(num_points_i / kPointsPerCell), 1);
+        hash_table_splits_[i + 1] =
+                hash_table_splits_[i] + (uint32_t)hash_table_size;
+    }
+
+    hash_table_index_ = Tensor::Empty({num_points}, Dtype::Int32,
+                                      dataset_points_.GetDevice());
+    hash_table_cell_splits_ =
+            Tensor::Empty({hash_table_splits_.back() + 1}, Dtype::Int32,
+                          dataset_points_.GetDevice());
+
+    void *temp_ptr = nullptr;
+    size_t temp_size = 0;
+
+    Dtype dtype = GetDtype();
+    DISPATCH_FLOAT32_FLOAT64_DTYPE(dtype, [&]() {
+        BuildSpatialHashTableCUDA(
+                temp_ptr, temp_size, num_points,
+                static_cast<scalar_t *>(dataset_points_.GetDataPtr()),
+                static_cast<scalar_t>(cell_radius_), points_row_splits_.size(),
+                points_row_splits_.data(), hash_table_splits_.data(),
+                hash_table_cell_splits_.GetShape()[0],
+                (uint32_t *)static_cast<int32_t *>(
+                        hash_table_cell_splits_.GetDataPtr()),
+                (uint32_t *)static_cast<int32_t *>(
+                        hash_table_index_.GetDataPtr()));
+        Tensor temp_tensor = Tensor::Empty({int64_t(temp_size)}, Dtype::UInt8,
+                                           dataset_points_.GetDevice());
+        temp_ptr = temp_tensor.GetDataPtr();
+
+        BuildSpatialHashTableCUDA(
+                temp_ptr, temp_size, num_points,
+                static_cast<scalar_t *>(dataset_points_.GetDataPtr()),
+                static_cast<scalar_t>(cell_radius_), points_row_splits_.size(),
+                points_row_splits_.data(), hash_table_splits_.data(),
+                hash_table_cell_splits_.GetShape()[0],
+                (uint32_t *)static_cast<int32_t *>(
+                        hash_table_cell_splits_.GetDataPtr()),
+                (uint32_t *)static_cast<int32_t *>(
+                        hash_table_index_.GetDataPtr()));
+    });
+#else
+    utility::LogError(
+            "KnnIndex::BuildHashTable BUILD_CUDA_MODULE is OFF. Please compile "
+            "Open3d with BUILD_CUDA_MODULE=ON.");
+#endif
+}
+
+std::pair<Tensor, Tensor> KnnIndex::SearchKnn(const Tensor &query_points,
+                                              int knn) const {
+#ifdef BUILD_CUDA_MODULE
+    // Check dtype.
+    query_points.AssertDtype(GetDtype());
+
+    // Check shape.
+    query_points.AssertShapeCompatible({utility::nullopt, GetDimension()});
+
+    // Check device.
+    query_points.AssertDevice(GetDevice());
+
+    if (knn <= 0) {
+        utility::LogError("[KnnIndex::SearchKnn] knn should be larger than 0.");
+    }
+    if (points_row_splits_.size() > 2) {
+        utility::LogError(
+                "[KnnIndex::SearchKnn] queries_row_splits is required for "
+                "batched indices.");
+    }
+    knn = std::min(knn, (int)GetDatasetSize());
+    if (knn > kMaxKnn) {
+        utility::LogError(
+                "[KnnIndex::SearchKnn] knn should not be larger than {}, but "
+                "got {}.",
+                kMaxKnn, knn);
+    }
+
+    int64_t num_query_points = query_points.GetShape()[0];
+    return SearchKnnInBatches(query_points, {0, num_query_points}, knn);
+#else
+    utility::LogError(
+            "KnnIndex::SearchKnn BUILD_CUDA_MODULE is OFF. Please compile "
+            "Open3d with BUILD_CUDA_MODULE=ON.");
+#endif
+};
+
+std::pair<Tensor, Tensor> KnnIndex::SearchKnn(const Tensor &query_points,
+                                              const Tensor &queries_row_splits,
+                                              int knn) const {
+#ifdef BUILD_CUDA_MODULE
+    // Check dtype.
+    query_points.AssertDtype(GetDtype());
+
+    // Check shape.
+    query_points.AssertShapeCompatible({utility::nullopt, GetDimension()});
+
+    // Check device.
+    query_points.AssertDevice(GetDevice());
+
+    if (knn <= 0) {
+        utility::LogError("[KnnIndex::SearchKnn] knn should be larger than 0.");
+    }
+    std::vector<int64_t> queries_splits =
+            GetRowSplits(queries_row_splits, query_points.GetShape()[0]);
+    if (queries_splits.size() != points_row_splits_.size()) {
+        utility::LogError(
+                "[KnnIndex::SearchKnn] Batch size of queries {} does not match "
+                "batch size of dataset points {}.",
+                queries_splits.size() - 1, points_row_splits_.size() - 1);
+    }
+    int64_t max_batch_size = 0;
+    for (size_t i = 0; i + 1 < points_row_splits_.size(); ++i) {
+        max_batch_size =
+                std::max(max_batch_size,
+                         points_row_splits_[i + 1] - points_row_splits_[i]);
+    }
+    knn = static_cast<int>(std::min<int64_t>(knn, max_batch_size));
+    if (knn > kMaxKnn) {
+        utility::LogError(
+                "[KnnIndex::SearchKnn] knn should not be larger than {}, but "
+                "got {}.",
+                kMaxKnn, knn);
+    }
+
+    return SearchKnnInBatches(query_points, queries_splits, knn);
+#else
+    utility::LogError(
+            "KnnIndex::SearchKnn BUILD_CUDA_MODULE is OFF. Please compile "
+            "Open3d with BUILD_CUDA_MODULE=ON.");
+#endif
+}
+
+std::pair<Tensor, Tensor> KnnIndex::SearchKnnInBatches(
+        const Tensor &query_points,
+        const std::vector<int64_t> &queries_row_splits,
+        int knn) const {
+#ifdef BUILD_CUDA_MODULE
+    Tensor query_points_ = query_points.Contiguous();
+    int64_t num_query_points = query_points_.GetShape()[0];
+
+    Dtype dtype = GetDtype();
+    Tensor indices = Tensor::Empty({num_query_points, knn}, Dtype::Int64,
+                                   dataset_points_.GetDevice());
+    Tensor distances = Tensor::Empty({num_query_points, knn}, dtype,
+                                     dataset_points_.GetDevice());
+
+    DISPATCH_FLOAT32_FLOAT64_DTYPE(dtype, [&]() {
+        KnnSearchCUDA(
+                static_cast<int64_t *>(indices.GetDataPtr()),
+                static_cast<scalar_t *>(distances.GetDataPtr()),
+                GetDatasetSize(),
+                static_cast<const scalar_t *>(dataset_points_.GetDataPtr()),
+                num_query_points,
+                static_cast<const scalar_t *>(query_points_.GetDataPtr()), knn,
+                static_cast<scalar_t>(cell_radius_), grid_min_, grid_max_,
+                points_row_splits_.size(), points_row_splits_.data(),
+                queries_row_splits.size(), queries_row_splits.data(),
+                hash_table_splits_.data(),
+                hash_table_cell_splits_.GetShape()[0],
+                (uint32_t *)static_cast<const int32_t *>(
+                        hash_table_cell_splits_.GetDataPtr()),
+                (uint32_t *)static_cast<const int32_t *>(
+                        hash_table_index_.GetDataPtr()));
+    });
+    return std::make_pair(indices, distances);
+#else
+    utility::LogError(
+            "KnnIndex::SearchKnnInBatches BUILD_CUDA_MODULE is OFF. Please "
+            "compile Open3d with BUILD_CUDA_MODULE=ON.");
+#endif
+}
+
+}  // namespace nns
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,165 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <vector>
+
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/nns/NNSIndex.h"
+#include "open3d/utility/MiniVec.h"
+
+namespace open3d {
+namespace core {
+namespace nns {
+
+/// \class KnnIndex
+///
+/// \brief KnnIndex for k nearest neighbor search of 3D points on GPU.
+///
+/// The dataset points are binned into the spatial hash table of
+/// FixedRadiusIndex. Cells are visited in growing shells around each query
+/// until the k-th nearest neighbor found is closer than any unvisited cell.
+class KnnIndex : public NNSIndex {
+public:
+    /// \brief Default Constructor.
+    KnnIndex();
+
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param dataset_points Provides a set of data points as Tensor for the
+    /// spatial hash table construction.
+    KnnIndex(const Tensor& dataset_points);
+
+    /// \brief Parameterized Constructor for a batch of datasets.
+    ///
+    /// \param dataset_points Provides the data points of all the batches.
+    /// \param points_row_splits Row splits of the batches in dataset_points.
+    KnnIndex(const Tensor& dataset_points, const Tensor& points_row_splits);
+    ~KnnIndex();
+    KnnIndex(const KnnIndex&) = delete;
+    KnnIndex& operator=(const KnnIndex&) = delete;
+
+public:
+    bool SetTensorData(const Tensor& dataset_points) override;
+
+    bool SetTensorData(const Tensor& dataset_points, double radius) override {
+        utility::LogError(
+                "KnnIndex::SetTensorData with radius not implemented.");
+    }
+
+    /// Set the data of a batch of datasets. Each batch gets its own part of
+    /// the spatial hash table and the batched searches only return neighbors
+    /// from the batch of the query.
+    ///
+    /// \param dataset_points Dataset points of all the batches. Must be 2D,
+    /// with shape {n, 3}.
+    /// \param points_row_splits Row splits of the batches in dataset_points.
+    /// Must be 1D, with shape {batch_size + 1,} and dtype Int64.
+    /// \return Returns true if the construction success, otherwise false.
+    bool SetTensorData(const Tensor& dataset_points,
+                       const Tensor& points_row_splits);
+
+    /// Perform knn search.
+    ///
+    /// \param query_points Query points. Must be 2D, with shape {n, 3}, same
+    /// dtype and device with dataset_points.
+    /// \param knn Number of nearest neighbor to search, at most kMaxKnn.
+    /// \return Pair of Tensors: (indices, distances):
+    /// - indices: Tensor of shape {n, knn}, with dtype Int64.
+    /// - distainces: Tensor of shape {n, knn}, same dtype with dataset_points.
+    /// Distances are squared L2 distances sorted in ascending order. knn is
+    /// clipped to the number of dataset points.
+    std::pair<Tensor, Tensor> SearchKnn(const Tensor& query_points,
+                                        int knn) const override;
+
+    /// Perform knn search on a batched index. The search of all the batches
+    /// is done with a single call to KnnSearchCUDA.
+    ///
+    /// \param query_points Query points of all the batches. Must be 2D, with
+    /// shape {m, 3}, same dtype and device with dataset_points.
+    /// \param queries_row_splits Row splits of the batches in query_points.
+    /// Must be 1D, with shape {batch_size + 1,} and dtype Int64.
+    /// \param knn Number of nearest neighbor to search, at most kMaxKnn.
+    /// \return Pair of Tensors: (indices, distances):
+    /// - indices: Tensor of shape {m, knn}, with dtype Int64. Indices are
+    /// rows of dataset_points. Queries of batches with less than knn points
+    /// are padded with -1.
+    /// - distainces: Tensor of shape {m, knn}, same dtype with dataset_points.
+    /// knn is clipped to the number of points of the largest batch.
+    std::pair<Tensor, Tensor> SearchKnn(const Tensor& query_points,
+                                        const Tensor& queries_row_splits,
+                                        int knn) const;
+
+    std::tuple<Tensor, Tensor, Tensor> SearchRadius(
+            const Tensor& query_points, const Tensor& radii) const override {
+        utility::LogError("KnnIndex::SearchRadius not implemented.");
+    }
+
+    std::tuple<Tensor, Tensor, Tensor> SearchRadius(
+            const Tensor& query_points, double radius) const override {
+        utility::LogError("KnnIndex::SearchRadius not implemented.");
+    }
+
+    std::pair<Tensor, Tensor> SearchHybrid(const Tensor& query_points,
+                                           float radius,
+                                           int max_knn) const override {
+        utility::LogError("KnnIndex::SearchHybrid not implemented.");
+    }
+
+    /// Largest knn supported, bounded by the per-thread candidate lists.
+    static constexpr int kMaxKnn = 256;
+
+    /// Expected number of points per cell, used to choose the cell size.
+    static constexpr double kPointsPerCell = 8;
+
+protected:
+    /// Builds the spatial hash table of dataset_points_, one part per batch of
+    /// points_row_splits_.
+    void BuildHashTable();
+
+    /// Searches the queries of each batch of \p queries_row_splits in the
+    /// hash table of the same batch.
+    std::pair<Tensor, Tensor> SearchKnnInBatches(
+            const Tensor& query_points,
+            const std::vector<int64_t>& queries_row_splits,
+            int knn) const;
+
+    /// Half of the cell size, as the radius of BuildSpatialHashTableCUDA.
+    double cell_radius_;
+    /// Voxel index range of the cells covering the dataset points.
+    utility::MiniVec<int, 3> grid_min_;
+    utility::MiniVec<int, 3> grid_max_;
+
+    std::vector<int64_t> points_row_splits_;
+    std::vector<uint32_t> hash_table_splits_;
+    Tensor hash_table_cell_splits_;
+    Tensor hash_table_index_;
+};
+}  // namespace nns
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,270 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/nns/KnnSearch.h"
+#include "open3d/core/nns/NeighborSearchCommon.h"
+#include "open3d/utility/Helper.h"
+#include "open3d/utility/MiniVec.h"
+
+namespace open3d {
+namespace core {
+namespace nns {
+
+namespace {
+
+template <class T>
+using Vec3 = utility::MiniVec<T, 3>;
+
+/// Inserts a point into the sorted list of the closest points found so far.
+/// The list holds \p count elements and at most \p knn.
+template <class T>
+inline __device__ void InsertNeighbor(T* best_distances,
+                                      uint32_t* best_indices,
+                                      int& count,
+                                      int knn,
+                                      T dist,
+                                      uint32_t idx) {
+    if (count == knn && dist >= best_distances[knn - 1]) return;
+
+    int i = count < knn ? count++ : knn - 1;
+    for (; i > 0 && best_distances[i - 1] > dist; --i) {
+        best_distances[i] = best_distances[i - 1];
+        best_indices[i] = best_indices[i - 1];
+    }
+    best_distances[i] = dist;
+    best_indices[i] = idx;
+}
+
+/// Kernel for KnnSearchCUDA. The candidate lists have a compile-time size
+/// \p MAX_K so that they are kept in registers or local memory.
+template <class T, int MAX_K>
+__global__ void KnnSearchKernel(
+        int64_t* __restrict__ indices,
+        T* __restrict__ distances,
+        const uint32_t* const __restrict__ point_index_table,
+        const uint32_t* const __restrict__ hash_table_cell_splits,
+        size_t hash_table_size,
+        const T* const __restrict__ query_points,
+        size_t num_queries,
+        const T* const __restrict__ points,
+        int knn,
+        const T inv_voxel_size,
+        const T voxel_size,
+        const Vec3<int> grid_min,
+        const Vec3<int> grid_max) {
+    int query_idx = blockDim.x * blockIdx.x + threadIdx.x;
+    if (query_idx >= num_queries) return;
+
+    T best_distances[MAX_K];
+    uint32_t best_indices[MAX_K];
+    int count = 0;
+
+    Vec3<T> query_pos(&query_points[query_idx * 3]);
+    Vec3<int> query_voxel = ComputeVoxelIndex(query_pos, inv_voxel_size);
+
+    // Shells further than max_shell do not intersect the grid.
+    int max_shell = 0;
+    for (int i = 0; i < 3; ++i) {
+        max_shell = max(max_shell, abs(query_voxel[i] - grid_min[i]));
+        max_shell = max(max_shell, abs(grid_max[i] - query_voxel[i]));
+    }
+
+    for (int shell = 0; shell <= max_shell; ++shell) {
+        for (int dz = -shell; dz <= shell; ++dz) {
+            const int z = query_voxel[2] + dz;
+            if (z < grid_min[2] || z > grid_max[2]) continue;
+
+            for (int dy = -shell; dy <= shell; ++dy) {
+                const int y = query_voxel[1] + dy;
+                if (y < grid_min[1] || y > grid_max[1]) continue;
+
+                // Rows inside the shell only have their two end cells on it.
+                const bool full_row = abs(dz) == shell || abs(dy) == shell;
+                const int step = full_row ? 1 : 2 * shell;
+                for (int dx = -shell; dx <= shell; dx += step) {
+                    const int x = query_voxel[0] + dx;
+                    if (x < grid_min[0] || x > grid_max[0]) continue;
+
+                    size_t hash = SpatialHash(x, y, z) % hash_table_size;
+                    size_t begin_idx = hash_table_cell_splits[hash];
+                    size_t end_idx = hash_table_cell_splits[hash + 1];
+
+                    for (size_t j = begin_idx; j < end_idx; ++j) {
+                        uint32_t idx = point_index_table[j];
+
+                        Vec3<T> p(&points[idx * 3 + 0]);
+
+                        // Skip points of other cells hashed to the same entry,
+                        // so that every point is visited once.
+                        Vec3<int> voxel_index =
+                                ComputeVoxelIndex(p, inv_voxel_size);
+                        if (voxel_index[0] != x || voxel_index[1] != y ||
+                            voxel_index[2] != z) {
+                            continue;
+                        }
+
+                        Vec3<T> d = p - query_pos;
+                        InsertNeighbor(best_distances, best_indices, count,
+                                       knn, d.dot(d), idx);
+                    }
+                }
+            }
+        }
+
+        // Points in the next shells are at least shell * voxel_size away.
+        const T shell_distance = shell * voxel_size;
+        if (count == knn &&
+            best_distances[knn - 1] <= shell_distance * shell_distance) {
+            break;
+        }
+    }
+
+    for (int i = 0; i < count; ++i) {
+        indices[query_idx * knn + i] = best_indices[i];
+        distances[query_idx * knn + i] = best_distances[i];
+    }
+    for (int i = count; i < knn; ++i) {
+        indices[query_idx * knn + i] = -1;
+        distances[query_idx * knn + i] = -1;
+    }
+}
+
+}  // namespace
+
+template <class T>
+void KnnSearchCUDA(int64_t* indices,
+                   T* distances,
+                   size_t num_points,
+                   const T* const points,
+                   size_t num_queries,
+                   const T* const queries,
+                   int knn,
+                   const T radius,
+                   const utility::MiniVec<int, 3>& grid_min,
+                   const utility::MiniVec<int, 3>& grid_max,
+                   const size_t points_row_splits_size,
+                   const int64_t* const points_row_splits,
+                   const size_t queries_row_splits_size,
+                   const int64_t* const queries_row_splits,
+                   const uint32_t* const hash_table_splits,
+                   size_t hash_table_cell_splits_size,
+                   const uint32_t* const hash_table_cell_splits,
+                   const uint32_t* const hash_table_index) {
+    const cudaStream_t stream = GetCUDACurrentStream();
+
+    // Same cell size as BuildSpatialHashTableCUDA.
+    const T voxel_size = 2 * radius;
+    const T inv_voxel_size = 1 / voxel_size;
+
+    const int batch_size = points_row_splits_size - 1;
+    const int BLOCKSIZE = 64;
+    dim3 block(BLOCKSIZE, 1, 1);
+
+    for (int i = 0; i < batch_size; ++i) {
+        const size_t hash_table_size =
+                hash_table_splits[i + 1] - hash_table_splits[i];
+        const size_t first_cell_idx = hash_table_splits[i];
+        const T* const queries_i = queries + 3 * queries_row_splits[i];
+        const size_t num_queries_i =
+                queries_row_splits[i + 1] - queries_row_splits[i];
+        int64_t* const indices_i = indices + knn * queries_row_splits[i];
+        T* const distances_i = distances + knn * queries_row_splits[i];
+
+        dim3 grid(0, 1, 1);
+        grid.x = utility::DivUp(num_queries_i, block.x);
+        if (!grid.x) continue;
+
+#define FN_PARAMETERS                                                 \
+    indices_i, distances_i, hash_table_index,                         \
+            hash_table_cell_splits + first_cell_idx, hash_table_size, \
+            queries_i, num_queries_i, points, knn, inv_voxel_size,    \
+            voxel_size, grid_min, grid_max
+
+#define CALL_TEMPLATE(MAX_K) \
+    KnnSearchKernel<T, MAX_K><<<grid, block, 0, stream>>>(FN_PARAMETERS)
+
+        if (knn <= 8) {
+            CALL_TEMPLATE(8);
+        } else if (knn <= 16) {
+            CALL_TEMPLATE(16);
+        } else if (knn <= 32) {
+            CALL_TEMPLATE(32);
+        } else if (knn <= 64) {
+            CALL_TEMPLATE(64);
+        } else if (knn <= 128) {
+            CALL_TEMPLATE(128);
+        } else {
+            CALL_TEMPLATE(256);
+        }
+        OPEN3D_GET_LAST_CUDA_ERROR("KnnSearchKernel failed.");
+
+#undef CALL_TEMPLATE
+#undef FN_PARAMETERS
+    }
+}
+
+template void KnnSearchCUDA(int64_t* indices,
+                            float* distances,
+                            size_t num_points,
+                            const float* const points,
+                            size_t num_queries,
+                            const float* const queries,
+                            int knn,
+                            const float radius,
+                            const utility::MiniVec<int, 3>& grid_min,
+                            const utility::MiniVec<int, 3>& grid_max,
+                            const size_t points_row_splits_size,
+                            const int64_t* const points_row_splits,
+                            const size_t queries_row_splits_size,
+                            const int64_t* const queries_row_splits,
+                            const uint32_t* const hash_table_splits,
+                            size_t hash_table_cell_splits_size,
+                            const uint32_t* const hash_table_cell_splits,
+                            const uint32_t* const hash_table_index);
+
+template void KnnSearchCUDA(int64_t* indices,
+                            double* distances,
+                            size_t num_points,
+                            const double* const points,
+                            size_t num_queries,
+                            const double* const queries,
+                            int knn,
+                            const double radius,
+                            const utility::MiniVec<int, 3>& grid_min,
+                            const utility::MiniVec<int, 3>& grid_max,
+                            const size_t points_row_splits_size,
+                            const int64_t* const points_row_splits,
+                            const size_t queries_row_splits_size,
+                            const int64_t* const queries_row_splits,
+                            const uint32_t* const hash_table_splits,
+                            size_t hash_table_cell_splits_size,
+                            const uint32_t* const hash_table_cell_splits,
+                            const uint32_t* const hash_table_index);
+
+}  // namespace nns
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,123 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/nns/NeighborSearchCommon.h"
+#include "open3d/utility/MiniVec.h"
+
+namespace open3d {
+namespace core {
+namespace nns {
+
+/// K nearest neighbor search on the spatial hash table built by
+/// BuildSpatialHashTableCUDA. For each query point the cells are visited in
+/// shells of growing Chebyshev distance around the cell of the query, keeping
+/// the k closest points in a sorted per-thread list. The search stops once the
+/// list is full and its last distance is below the distance of the next shell.
+///
+/// All pointer arguments point to device memory.
+///
+/// \tparam T    Floating-point data type for the point positions.
+///
+/// \param indices    Output array of size \p num_queries * \p knn with the
+///        indices of the neighbors, sorted by distance for each query. Queries
+///        of batch items with less than \p knn points are padded with -1.
+///
+/// \param distances    Output array of size \p num_queries * \p knn with the
+///        squared L2 distances of the neighbors, padded with -1 like
+///        \p indices.
+///
+/// \param num_points    The number of points.
+///
+/// \param points    Array with the 3D point positions.
+///
+/// \param num_queries    The number of query points.
+///
+/// \param queries    Array with the 3D query positions.
+///
+/// \param knn    The number of neighbors to search. Must be in
+///        [1, KnnIndex::kMaxKnn].
+///
+/// \param radius    The radius used to build the spatial hash table. The cell
+///        size is 2 * radius.
+///
+/// \param grid_min    Smallest voxel index of the cells containing points.
+///
+/// \param grid_max    Largest voxel index of the cells containing points.
+///
+/// \param points_row_splits_size    The size of the points_row_splits array.
+///        The size of the array is batch_size+1.
+///
+/// \param points_row_splits    Defines the start and end of the points in
+///        each batch item. This pointer points to host memory.
+///
+/// \param queries_row_splits_size    The size of the queries_row_splits
+///        array. The size of the array is batch_size+1.
+///
+/// \param queries_row_splits    Defines the start and end of the queries in
+///        each batch item. This pointer points to host memory.
+///
+/// \param hash_table_splits    Array defining the start and end the hash
+///        table for each batch item. This is [0, number of cells] if there is
+///        only 1 batch item or [0, hash_table_cell_splits_size-1] which is the
+///        same. This pointer points to host memory.
+///
+/// \param hash_table_cell_splits_size    This is the length of the
+///        hash_table_cell_splits array.
+///
+/// \param hash_table_cell_splits    This is an output of the function
+///        BuildSpatialHashTableCUDA. The row splits array describing the start
+///        and end of each cell.
+///
+/// \param hash_table_index    This is an output of the function
+///        BuildSpatialHashTableCUDA. This is array storing the values of the
+///        hash table, which are the indices to the points. The size of the
+///        array must be equal to the number of points.
+///
+template <class T>
+void KnnSearchCUDA(int64_t* indices,
+                   T* distances,
+                   size_t num_points,
+                   const T* const points,
+                   size_t num_queries,
+                   const T* const queries,
+                   int knn,
+                   const T radius,
+                   const utility::MiniVec<int, 3>& grid_min,
+                   const utility::MiniVec<int, 3>& grid_max,
+                   const size_t points_row_splits_size,
+                   const int64_t* const points_row_splits,
+                   const size_t queries_row_splits_size,
+                   const int64_t* const queries_row_splits,
+                   const uint32_t* const hash_table_splits,
+                   size_t hash_table_cell_splits_size,
+                   const uint32_t* const hash_table_cell_splits,
+                   const uint32_t* const hash_table_index);
+
+}  // namespace nns
+}  // namespace core
+}  // namespace open3d
@@ -47,6 +47,38 @@ Dtype NNSIndex::GetDtype() const { return dataset_points_.GetDtype(); }
 
 Device NNSIndex::GetDevice() const { return dataset_points_.GetDevice(); }
 
+bool NNSIndex::AddPoints(const Tensor &points) {
+    utility::LogError("[NNSIndex::AddPoints] Not implemented for this index.");
+}
+
+bool NNSIndex::RemovePoints(const Tensor &indices) {
+    utility::LogError(
+            "[NNSIndex::RemovePoints] Not implemented for this index.");
+}
+
+std::vector<int64_t> NNSIndex::GetRowSplits(const Tensor &row_splits,
+                                            int64_t num_rows) {
+    row_splits.AssertDtype(Dtype::Int64);
+    if (row_splits.NumDims() != 1 || row_splits.GetShape()[0] < 2) {
+        utility::LogError(
+                "[NNSIndex] row_splits must be 1D, with shape {batch_size + "
+                "1,}.");
+    }
+    std::vector<int64_t> splits = row_splits.ToFlatVector<int64_t>();
+    if (splits.front() != 0 || splits.back() != num_rows) {
+        utility::LogError(
+                "[NNSIndex] row_splits must start with 0 and end with the "
+                "number of points {}, but got [{}, ..., {}].",
+                num_rows, splits.front(), splits.back());
+    }
+    for (size_t i = 1; i < splits.size(); ++i) {
+        if (splits[i] < splits[i - 1]) {
+            utility::LogError("[NNSIndex] row_splits must be non-decreasing.");
+        }
+    }
+    return splits;
+}
+
 }  // namespace nns
 }  // namespace core
 }  // namespace open3d
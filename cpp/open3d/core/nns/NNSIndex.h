@@ -110,6 +110,24 @@ public:
                                                    float radius,
                                                    int max_knn) const = 0;
 
+    /// Add points to the index. The new points get the indices following the
+    /// ones of the points already added, so that indices returned by searches
+    /// remain valid.
+    ///
+    /// \param points Points to add. Must be 2D, with shape {n, d}, same dtype
+    /// and device with dataset_points.
+    /// \return Returns true if the update success, otherwise false.
+    virtual bool AddPoints(const Tensor &points);
+
+    /// Remove points from the index. Indices of the other points do not
+    /// change and removed indices are not reused. Indices already removed are
+    /// ignored.
+    ///
+    /// \param indices Indices of the points to remove. Must be 1D, with dtype
+    /// Int64.
+    /// \return Returns true if the update success, otherwise false.
+    virtual bool RemovePoints(const Tensor &indices);
+
     /// Get dimension of the dataset points.
     /// \return dimension of dataset points.
     int GetDimension() const;
@@ -127,6 +145,13 @@ public:
     Device GetDevice() const;
 
 protected:
+    /// Checks that \p row_splits is a valid row splits Tensor for \p num_rows
+    /// rows and returns its values. A valid row splits Tensor is 1D, with
+    /// dtype Int64, starts with 0, is non-decreasing and ends with
+    /// \p num_rows.
+    static std::vector<int64_t> GetRowSplits(const Tensor &row_splits,
+                                             int64_t num_rows);
+
     Tensor dataset_points_;
 };
 }  // namespace nns
@@ -28,7 +28,10 @@
 
 #include <tbb/parallel_for.h>
 
+#include <algorithm>
+#include <limits>
 #include <nanoflann.hpp>
+#include <numeric>
 
 #include "open3d/core/CoreUtil.h"
 #include "open3d/utility/Console.h"
@@ -37,6 +40,121 @@ namespace open3d {
 namespace core {
 namespace nns {
 
+namespace {
+
+/// NanoFlann result set keeping the knn closest points over the trees of the
+/// index, skipping removed points. Same insertion order as KNNResultSet.
+template <class T>
+class KnnResultSet {
+public:
+    KnnResultSet(int64_t knn,
+                 int64_t *indices,
+                 T *distances,
+                 const std::vector<bool> &removed)
+        : knn_(knn),
+          indices_(indices),
+          distances_(distances),
+          removed_(removed) {}
+
+    /// Set the dataset indices of the tree being searched.
+    void SetTreeIndices(const std::vector<int64_t> *tree_indices) {
+        tree_indices_ = tree_indices;
+    }
+
+    size_t size() const { return count_; }
+
+    bool full() const { return count_ == knn_; }
+
+    bool addPoint(T dist, int64_t tree_index) {
+        int64_t index = (*tree_indices_)[tree_index];
+        if (removed_[index]) {
+            return true;
+        }
+        int64_t i;
+        for (i = count_; i > 0; --i) {
+            if (distances_[i - 1] > dist) {
+                if (i < knn_) {
+                    distances_[i] = distances_[i - 1];
+                    indices_[i] = indices_[i - 1];
+                }
+            } else {
+                break;
+            }
+        }
+        if (i < knn_) {
+            distances_[i] = dist;
+            indices_[i] = index;
+        }
+        if (count_ < knn_) {
+            count_++;
+        }
+        return true;
+    }
+
+    T worstDist() const {
+        return full() ? distances_[knn_ - 1] : std::numeric_limits<T>::max();
+    }
+
+private:
+    int64_t knn_;
+    int64_t count_ = 0;
+    int64_t *indices_;
+    T *distances_;
+    const std::vector<bool> &removed_;
+    const std::vector<int64_t> *tree_indices_ = nullptr;
+};
+
+/// NanoFlann result set collecting the points within a radius over the trees
+/// of the index, skipping removed points.
+template <class T>
+class RadiusResultSet {
+public:
+    RadiusResultSet(T squared_radius,
+                    std::vector<std::pair<int64_t, T>> &matches,
+                    const std::vector<bool> &removed)
+        : squared_radius_(squared_radius),
+          matches_(matches),
+          removed_(removed) {}
+
+    /// Set the dataset indices of the tree being searched.
+    void SetTreeIndices(const std::vector<int64_t> *tree_indices) {
+        tree_indices_ = tree_indices;
+    }
+
+    size_t size() const { return matches_.size(); }
+
+    bool full() const { return true; }
+
+    bool addPoint(T dist, int64_t tree_index) {
+        int64_t index = (*tree_indices_)[tree_index];
+        if (dist < squared_radius_ && !removed_[index]) {
+            matches_.emplace_back(index, dist);
+        }
+        return true;
+    }
+
+    T worstDist() const { return squared_radius_; }
+
+private:
+    T squared_radius_;
+    std::vector<std::pair<int64_t, T>> &matches_;
+    const std::vector<bool> &removed_;
+    const std::vector<int64_t> *tree_indices_ = nullptr;
+};
+
+/// Stacks the rows of \p a and \p b.
+Tensor ConcatenateRows(const Tensor &a, const Tensor &b) {
+    int64_t num_a = a.GetShape()[0];
+    int64_t num_b = b.GetShape()[0];
+    Tensor result = Tensor::Empty({num_a + num_b, a.GetShape()[1]},
+                                  a.GetDtype(), a.GetDevice());
+    result.Slice(0, 0, num_a).AsRvalue() = a;
+    result.Slice(0, num_a, num_a + num_b).AsRvalue() = b;
+    return result;
+}
+
+}  // namespace
+
 NanoFlannIndex::NanoFlannIndex(){};
 
 NanoFlannIndex::NanoFlannIndex(const Tensor &dataset_points) {
@@ -53,18 +171,182 @@ bool NanoFlannIndex::SetTensorData(const Tensor &dataset_points) {
                 "2D matrix, with shape {n_dataset_points, d}.");
     }
     dataset_points_ = dataset_points.Contiguous();
-    size_t dataset_size = GetDatasetSize();
-    int dimension = GetDimension();
-    Dtype dtype = GetDtype();
+    int64_t dataset_size = static_cast<int64_t>(GetDatasetSize());
+
+    std::vector<int64_t> indices(dataset_size);
+    std::iota(indices.begin(), indices.end(), 0);
+    removed_ = std::vector<bool>(dataset_size, false);
+    trees_.clear();
+    if (dataset_size > 0) {
+        trees_.push_back(BuildTree(dataset_points_, std::move(indices)));
+    }
+    num_active_points_ = dataset_size;
+    points_row_splits_.clear();
+    return true;
+};
 
-    DISPATCH_FLOAT32_FLOAT64_DTYPE(dtype, [&]() {
+bool NanoFlannIndex::SetTensorData(const Tensor &dataset_points,
+                                   const Tensor &points_row_splits) {
+    if (dataset_points.NumDims() != 2) {
+        utility::LogError(
+                "[NanoFlannIndex::SetTensorData] dataset_points must be "
+                "2D matrix, with shape {n_dataset_points, d}.");
+    }
+    dataset_points_ = dataset_points.Contiguous();
+    int64_t dataset_size = static_cast<int64_t>(GetDatasetSize());
+    points_row_splits_ = GetRowSplits(points_row_splits, dataset_size);
+
+    // One tree per batch, including the empty ones, so that tree i holds
+    // batch i.
+    removed_ = std::vector<bool>(dataset_size, false);
+    trees_.clear();
+    for (size_t i = 0; i + 1 < points_row_splits_.size(); ++i) {
+        int64_t begin = points_row_splits_[i];
+        int64_t end = points_row_splits_[i + 1];
+        std::vector<int64_t> indices(end - begin);
+        std::iota(indices.begin(), indices.end(), begin);
+        trees_.push_back(BuildTree(dataset_points_.Slice(0, begin, end),
+                                   std::move(indices)));
+    }
+    num_active_points_ = dataset_size;
+    return true;
+}
+
+NanoFlannIndex::NanoFlannTree NanoFlannIndex::BuildTree(
+        const Tensor &points, std::vector<int64_t> indices) const {
+    std::vector<int64_t> keep;
+    for (size_t i = 0; i < indices.size(); ++i) {
+        if (!removed_[indices[i]]) {
+            keep.push_back(i);
+        }
+    }
+
+    NanoFlannTree tree;
+    if (keep.size() == indices.size()) {
+        tree.points_ = points.Contiguous();
+        tree.indices_ = std::move(indices);
+    } else {
+        int64_t num_keep = static_cast<int64_t>(keep.size());
+        tree.points_ = points.IndexGet({Tensor(keep, {num_keep}, Dtype::Int64,
+                                               points.GetDevice())});
+        for (int64_t i = 0; i < num_keep; ++i) {
+            tree.indices_.push_back(indices[keep[i]]);
+        }
+    }
+
+    size_t tree_size = tree.indices_.size();
+    if (tree_size == 0) {
+        return tree;
+    }
+    int dimension = GetDimension();
+    DISPATCH_FLOAT32_FLOAT64_DTYPE(GetDtype(), [&]() {
         const scalar_t *data_ptr =
-                static_cast<const scalar_t *>(dataset_points.GetDataPtr());
-        holder_.reset(new NanoFlannIndexHolder<L2, scalar_t>(
-                dataset_size, dimension, data_ptr));
+                static_cast<const scalar_t *>(tree.points_.GetDataPtr());
+        tree.holder_.reset(new NanoFlannIndexHolder<L2, scalar_t>(
+                tree_size, dimension, data_ptr));
     });
+    return tree;
+}
+
+void NanoFlannIndex::RebuildTree(size_t tree_idx, bool merge_next) {
+    NanoFlannTree &tree = trees_[tree_idx];
+    Tensor points = tree.points_;
+    std::vector<int64_t> indices = std::move(tree.indices_);
+    if (merge_next) {
+        NanoFlannTree &next = trees_[tree_idx + 1];
+        points = ConcatenateRows(points, next.points_);
+        indices.insert(indices.end(), next.indices_.begin(),
+                       next.indices_.end());
+        trees_.erase(trees_.begin() + tree_idx + 1);
+    }
+
+    NanoFlannTree rebuilt = BuildTree(points, std::move(indices));
+    if (rebuilt.indices_.empty()) {
+        trees_.erase(trees_.begin() + tree_idx);
+    } else {
+        trees_[tree_idx] = std::move(rebuilt);
+    }
+}
+
+bool NanoFlannIndex::AddPoints(const Tensor &points) {
+    if (!points_row_splits_.empty()) {
+        utility::LogError(
+                "[NanoFlannIndex::AddPoints] Not supported for batched "
+                "indices.");
+    }
+    points.AssertDtype(GetDtype());
+    points.AssertDevice(GetDevice());
+    points.AssertShapeCompatible({utility::nullopt, GetDimension()});
+
+    int64_t num_points = points.GetShape()[0];
+    if (num_points == 0) {
+        return true;
+    }
+    std::vector<int64_t> indices(num_points);
+    std::iota(indices.begin(), indices.end(),
+              static_cast<int64_t>(removed_.size()));
+    removed_.resize(removed_.size() + num_points, false);
+    trees_.push_back(BuildTree(points, std::move(indices)));
+    num_active_points_ += num_points;
+
+    // Merge the newest trees while they have comparable sizes, keeping a
+    // logarithmic number of trees.
+    while (trees_.size() >= 2) {
+        const NanoFlannTree &prev = trees_[trees_.size() - 2];
+        const NanoFlannTree &last = trees_.back();
+        int64_t prev_size = prev.indices_.size() - prev.num_removed_;
+        int64_t last_size = last.indices_.size() - last.num_removed_;
+        if (prev_size > 2 * last_size) {
+            break;
+        }
+        RebuildTree(trees_.size() - 2, true);
+    }
     return true;
-};
+}
+
+bool NanoFlannIndex::RemovePoints(const Tensor &indices) {
+    if (!points_row_splits_.empty()) {
+        utility::LogError(
+                "[NanoFlannIndex::RemovePoints] Not supported for batched "
+                "indices.");
+    }
+    indices.AssertDtype(Dtype::Int64);
+    if (indices.NumDims() != 1) {
+        utility::LogError(
+                "[NanoFlannIndex::RemovePoints] indices must be 1D, with "
+                "shape {n,}.");
+    }
+
+    int64_t num_indices = static_cast<int64_t>(removed_.size());
+    for (int64_t index : indices.ToFlatVector<int64_t>()) {
+        if (index < 0 || index >= num_indices) {
+            utility::LogError(
+                    "[NanoFlannIndex::RemovePoints] Index {} out of range "
+                    "[0, {}).",
+                    index, num_indices);
+        }
+        if (removed_[index]) {
+            continue;
+        }
+        removed_[index] = true;
+        --num_active_points_;
+
+        // Trees hold disjoint increasing ranges of indices.
+        auto it = std::upper_bound(trees_.begin(), trees_.end(), index,
+                                   [](int64_t value, const NanoFlannTree &t) {
+                                       return value < t.indices_.front();
+                                   });
+        (it - 1)->num_removed_++;
+    }
+
+    // Rebuild the trees made of mostly removed points.
+    for (size_t i = trees_.size(); i-- > 0;) {
+        if (2 * trees_[i].num_removed_ > int64_t(trees_[i].indices_.size())) {
+            RebuildTree(i, false);
+        }
+    }
+    return true;
+}
 
 std::pair<Tensor, Tensor> NanoFlannIndex::SearchKnn(const Tensor &query_points,
                                                     int knn) const {
@@ -79,55 +361,111 @@ std::pair<Tensor, Tensor> NanoFlannIndex::SearchKnn(const Tensor &query_points,
                 "[NanoFlannIndex::SearchKnn] knn should be larger than 0.");
     }
 
+    int64_t num_query_points = query_points.GetShape()[0];
+    knn = static_cast<int>(std::min<int64_t>(knn, num_active_points_));
+    return SearchKnnInBatches(query_points, {0, num_query_points},
+                              {0, static_cast<int64_t>(trees_.size())}, knn);
+};
+
+std::pair<Tensor, Tensor> NanoFlannIndex::SearchKnn(
+        const Tensor &query_points,
+        const Tensor &queries_row_splits,
+        int knn) const {
+    // Check dtype.
+    query_points.AssertDtype(GetDtype());
+
+    // Check shapes.
+    query_points.AssertShapeCompatible({utility::nullopt, GetDimension()});
+
+    if (knn <= 0) {
+        utility::LogError(
+                "[NanoFlannIndex::SearchKnn] knn should be larger than 0.");
+    }
+    if (points_row_splits_.empty()) {
+        utility::LogError(
+                "[NanoFlannIndex::SearchKnn] queries_row_splits requires a "
+                "batched index.");
+    }
+    std::vector<int64_t> queries_splits =
+            GetRowSplits(queries_row_splits, query_points.GetShape()[0]);
+    if (queries_splits.size() != points_row_splits_.size()) {
+        utility::LogError(
+                "[NanoFlannIndex::SearchKnn] Batch size of queries {} does "
+                "not match batch size of dataset points {}.",
+                queries_splits.size() - 1, points_row_splits_.size() - 1);
+    }
+
+    int64_t max_batch_size = 0;
+    for (size_t i = 0; i + 1 < points_row_splits_.size(); ++i) {
+        max_batch_size =
+                std::max(max_batch_size,
+                         points_row_splits_[i + 1] - points_row_splits_[i]);
+    }
+    knn = static_cast<int>(std::min<int64_t>(knn, max_batch_size));
+
+    std::vector<int64_t> tree_splits(points_row_splits_.size());
+    std::iota(tree_splits.begin(), tree_splits.end(), 0);
+    return SearchKnnInBatches(query_points, queries_splits, tree_splits, knn);
+}
+
+std::pair<Tensor, Tensor> NanoFlannIndex::SearchKnnInBatches(
+        const Tensor &query_points,
+        const std::vector<int64_t> &queries_row_splits,
+        const std::vector<int64_t> &tree_splits,
+        int knn) const {
     int64_t num_query_points = query_points.GetShape()[0];
     Dtype dtype = GetDtype();
 
     Tensor indices;
     Tensor distances;
     DISPATCH_FLOAT32_FLOAT64_DTYPE(dtype, [&]() {
-        Tensor batch_indices =
-                Tensor::Full({num_query_points, knn}, -1, Dtype::Int64);
-        Tensor batch_distances =
-                Tensor::Full({num_query_points, knn}, -1, dtype);
-
-        auto holder = static_cast<NanoFlannIndexHolder<L2, scalar_t> *>(
-                holder_.get());
-
-        // Parallel search.
-        tbb::parallel_for(
-                tbb::blocked_range<size_t>(0, num_query_points),
-                [&](const tbb::blocked_range<size_t> &r) {
-                    for (size_t i = r.begin(); i != r.end(); ++i) {
-                        auto single_indices = static_cast<int64_t *>(
-                                batch_indices[i].GetDataPtr());
-                        auto single_distances = static_cast<scalar_t *>(
-                                batch_distances[i].GetDataPtr());
-
-                        // search
-                        holder->index_->knnSearch(
-                                static_cast<scalar_t *>(
-                                        query_points[i].GetDataPtr()),
-                                static_cast<size_t>(knn), single_indices,
-                                single_distances);
-                    }
-                });
-        // Check if the number of neighbors are same.
-        Tensor check_valid =
-                batch_indices.Ge(0).To(Dtype::Int64).Sum({-1}, false);
-        int64_t num_neighbors = check_valid[0].Item<int64_t>();
-        if (check_valid.Ne(num_neighbors).Any()) {
-            utility::LogError(
-                    "[NanoFlannIndex::SearchKnn] The number of neighbors are "
-                    "different. Something went wrong.");
+        indices = Tensor::Full({num_query_points, knn}, -1, Dtype::Int64);
+        distances = Tensor::Full({num_query_points, knn}, -1, dtype);
+        if (knn == 0) {
+            return;
+        }
+
+        nanoflann::SearchParams params;
+
+        for (size_t b = 0; b + 1 < queries_row_splits.size(); ++b) {
+            // Parallel search.
+            tbb::parallel_for(
+                    tbb::blocked_range<int64_t>(queries_row_splits[b],
+                                                queries_row_splits[b + 1]),
+                    [&](const tbb::blocked_range<int64_t> &r) {
+                        for (int64_t i = r.begin(); i != r.end(); ++i) {
+                            KnnResultSet<scalar_t> result_set(
+                                    knn,
+                                    static_cast<int64_t *>(
+                                            indices[i].GetDataPtr()),
+                                    static_cast<scalar_t *>(
+                                            distances[i].GetDataPtr()),
+                                    removed_);
+                            const scalar_t *query_ptr =
+                                    static_cast<const scalar_t *>(
+                                            query_points[i].GetDataPtr());
+
+                            // Search the trees of the batch with the same
+                            // result set.
+                            for (int64_t t = tree_splits[b];
+                                 t < tree_splits[b + 1]; ++t) {
+                                const NanoFlannTree &tree = trees_[t];
+                                if (!tree.holder_) {
+                                    continue;
+                                }
+                                auto holder = static_cast<
+                                        NanoFlannIndexHolder<L2, scalar_t> *>(
+                                        tree.holder_.get());
+                                result_set.SetTreeIndices(&tree.indices_);
+                                holder->index_->findNeighbors(
+                                        result_set, query_ptr, params);
+                            }
+                        }
+                    });
         }
-        // Slice non-zero items.
-        indices = batch_indices.Slice(1, 0, num_neighbors)
-                          .View({num_query_points, num_neighbors});
-        distances = batch_distances.Slice(1, 0, num_neighbors)
-                            .View({num_query_points, num_neighbors});
     });
     return std::make_pair(indices, distances);
-};
+}
 
 std::tuple<Tensor, Tensor, Tensor> NanoFlannIndex::SearchRadius(
         const Tensor &query_points, const Tensor &radii) const {
@@ -140,6 +478,83 @@ std::tuple<Tensor, Tensor, Tensor> NanoFlannIndex::SearchRadius(
     query_points.AssertShapeCompatible({utility::nullopt, GetDimension()});
     radii.AssertShape({num_query_points});
 
+    // Check if the raii has negative values.
+    Tensor below_zero = radii.Le(0);
+    if (below_zero.Any()) {
+        utility::LogError(
+                "[NanoFlannIndex::SearchRadius] radius should be "
+                "larger than 0.");
+    }
+
+    return SearchRadiusInBatches(query_points, radii, {0, num_query_points},
+                                 {0, static_cast<int64_t>(trees_.size())});
+};
+
+std::tuple<Tensor, Tensor, Tensor> NanoFlannIndex::SearchRadius(
+        const Tensor &query_points, double radius) const {
+    int64_t num_query_points = query_points.GetShape()[0];
+    Dtype dtype = GetDtype();
+    std::tuple<Tensor, Tensor, Tensor> result;
+    DISPATCH_FLOAT32_FLOAT64_DTYPE(dtype, [&]() {
+        Tensor radii(std::vector<scalar_t>(num_query_points,
+                                           static_cast<scalar_t>(radius)),
+                     {num_query_points}, dtype);
+        result = SearchRadius(query_points, radii);
+    });
+    return result;
+};
+
+std::tuple<Tensor, Tensor, Tensor> NanoFlannIndex::SearchRadius(
+        const Tensor &query_points,
+        const Tensor &queries_row_splits,
+        double radius) const {
+    // Check dtype.
+    query_points.AssertDtype(GetDtype());
+
+    // Check shapes.
+    int64_t num_query_points = query_points.GetShape()[0];
+    query_points.AssertShapeCompatible({utility::nullopt, GetDimension()});
+
+    if (radius <= 0) {
+        utility::LogError(
+                "[NanoFlannIndex::SearchRadius] radius should be larger than "
+                "0.");
+    }
+    if (points_row_splits_.empty()) {
+        utility::LogError(
+                "[NanoFlannIndex::SearchRadius] queries_row_splits requires a "
+                "batched index.");
+    }
+    std::vector<int64_t> queries_splits =
+            GetRowSplits(queries_row_splits, num_query_points);
+    if (queries_splits.size() != points_row_splits_.size()) {
+        utility::LogError(
+                "[NanoFlannIndex::SearchRadius] Batch size of queries {} does "
+                "not match batch size of dataset points {}.",
+                queries_splits.size() - 1, points_row_splits_.size() - 1);
+    }
+
+    std::vector<int64_t> tree_splits(points_row_splits_.size());
+    std::iota(tree_splits.begin(), tree_splits.end(), 0);
+
+    Dtype dtype = GetDtype();
+    std::tuple<Tensor, Tensor, Tensor> result;
+    DISPATCH_FLOAT32_FLOAT64_DTYPE(dtype, [&]() {
+        Tensor radii(std::vector<scalar_t>(num_query_points,
+                                           static_cast<scalar_t>(radius)),
+                     {num_query_points}, dtype);
+        result = SearchRadiusInBatches(query_points, radii, queries_splits,
+                                       tree_splits);
+    });
+    return result;
+}
+
+std::tuple<Tensor, Tensor, Tensor> NanoFlannIndex::SearchRadiusInBatches(
+        const Tensor &query_points,
+        const Tensor &radii,
+        const std::vector<int64_t> &queries_row_splits,
+        const std::vector<int64_t> &tree_splits) const {
+    int64_t num_query_points = query_points.GetShape()[0];
     Dtype dtype = GetDtype();
     Tensor indices;
     Tensor distances;
@@ -150,43 +565,55 @@ std::tuple<Tensor, Tensor, Tensor> NanoFlannIndex::SearchRadius(
         std::vector<std::vector<scalar_t>> batch_distances(num_query_points);
         std::vector<int64_t> batch_nums;
 
-        auto holder = static_cast<NanoFlannIndexHolder<L2, scalar_t> *>(
-                holder_.get());
-
         nanoflann::SearchParams params;
 
-        // Check if the raii has negative values.
-        Tensor below_zero = radii.Le(0);
-        if (below_zero.Any()) {
-            utility::LogError(
-                    "[NanoFlannIndex::SearchRadius] radius should be "
-                    "larger than 0.");
-        }
-
-        // Parallel search.
-        tbb::parallel_for(
-                tbb::blocked_range<size_t>(0, num_query_points),
-                [&](const tbb::blocked_range<size_t> &r) {
-                    std::vector<std::pair<int64_t, scalar_t>> ret_matches;
-                    for (size_t i = r.begin(); i != r.end(); ++i) {
-                        scalar_t radius = radii[i].Item<scalar_t>();
-
-                        size_t num_results = holder->index_->radiusSearch(
-                                static_cast<scalar_t *>(
-                                        query_points[i].GetDataPtr()),
-                                radius * radius, ret_matches, params);
-                        ret_matches.resize(num_results);
-                        std::vector<size_t> single_indices;
-                        std::vector<scalar_t> single_distances;
-                        for (auto it = ret_matches.begin();
-                             it < ret_matches.end(); it++) {
-                            single_indices.push_back(it->first);
-                            single_distances.push_back(it->second);
+        for (size_t b = 0; b + 1 < queries_row_splits.size(); ++b) {
+            // Parallel search.
+            tbb::parallel_for(
+                    tbb::blocked_range<int64_t>(queries_row_splits[b],
+                                                queries_row_splits[b + 1]),
+                    [&](const tbb::blocked_range<int64_t> &r) {
+                        std::vector<std::pair<int64_t, scalar_t>> ret_matches;
+                        for (int64_t i = r.begin(); i != r.end(); ++i) {
+                            scalar_t radius = radii[i].Item<scalar_t>();
+                            const scalar_t *query_ptr =
+                                    static_cast<const scalar_t *>(
+                                            query_points[i].GetDataPtr());
+
+                            ret_matches.clear();
+                            RadiusResultSet<scalar_t> result_set(
+                                    radius * radius, ret_matches, removed_);
+                            for (int64_t t = tree_splits[b];
+                                 t < tree_splits[b + 1]; ++t) {
+                                const NanoFlannTree &tree = trees_[t];
+                                if (!tree.holder_) {
+                                    continue;
+                                }
+                                auto holder = static_cast<
+                                        NanoFlannIndexHolder<L2, scalar_t> *>(
+                                        tree.holder_.get());
+                                result_set.SetTreeIndices(&tree.indices_);
+                                holder->index_->findNeighbors(
+                                        result_set, query_ptr, params);
+                            }
+                            std::sort(
+                                    ret_matches.begin(), ret_matches.end(),
+                                    [](const std::pair<int64_t, scalar_t> &a,
+                                       const std::pair<int64_t, scalar_t> &b) {
+                                        return a.second < b.second;
+                                    });
+                            std::vector<size_t> single_indices;
+                            std::vector<scalar_t> single_distances;
+                            for (auto it = ret_matches.begin();
+                                 it < ret_matches.end(); it++) {
+                                single_indices.push_back(it->first);
+                                single_distances.push_back(it->second);
+                            }
+                            batch_indices[i] = single_indices;
+                            batch_distances[i] = single_distances;
                         }
-                        batch_indices[i] = single_indices;
-                        batch_distances[i] = single_distances;
-                    }
-                });
+                    });
+        }
 
         // Flatten.
         std::vector<int64_t> batch_indices2;
@@ -210,21 +637,7 @@ std::tuple<Tensor, Tensor, Tensor> NanoFlannIndex::SearchRadius(
         num_neighbors = Tensor(batch_nums, {num_query_points}, Dtype::Int64);
     });
     return std::make_tuple(indices, distances, num_neighbors);
-};
-
-std::tuple<Tensor, Tensor, Tensor> NanoFlannIndex::SearchRadius(
-        const Tensor &query_points, double radius) const {
-    int64_t num_query_points = query_points.GetShape()[0];
-    Dtype dtype = GetDtype();
-    std::tuple<Tensor, Tensor, Tensor> result;
-    DISPATCH_FLOAT32_FLOAT64_DTYPE(dtype, [&]() {
-        Tensor radii(std::vector<scalar_t>(num_query_points,
-                                           static_cast<scalar_t>(radius)),
-                     {num_query_points}, dtype);
-        result = SearchRadius(query_points, radii);
-    });
-    return result;
-};
+}
 
 std::pair<Tensor, Tensor> NanoFlannIndex::SearchHybrid(
         const Tensor &query_points, float radius, int max_knn) const {
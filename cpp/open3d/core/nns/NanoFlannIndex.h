@@ -122,6 +122,11 @@ struct NanoFlannIndexHolder : NanoFlannIndexHolderBase {
 /// \class NanoFlann
 ///
 /// \brief KDTree with NanoFlann for nearest neighbor search.
+///
+/// Points can be added and removed after construction. The index is then a
+/// log-structured forest of KDTrees: added points get a new tree, which is
+/// merged with the previous one when their sizes are comparable, and removed
+/// points are skipped by the searches until their tree is rebuilt.
 class NanoFlannIndex : public NNSIndex {
 public:
     /// \brief Default Constructor.
@@ -144,6 +149,18 @@ public:
                 "NanoFlannIndex::SetTensorData with radius not implemented.");
     }
 
+    /// Set the data of a batch of datasets. Each batch gets its own KDTree and
+    /// the batched searches only return neighbors from the batch of the
+    /// query. Batched indices do not support adding and removing points.
+    ///
+    /// \param dataset_points Dataset points of all the batches. Must be 2D,
+    /// with shape {n, d}.
+    /// \param points_row_splits Row splits of the batches in dataset_points.
+    /// Must be 1D, with shape {batch_size + 1,} and dtype Int64.
+    /// \return Returns true if the construction success, otherwise false.
+    bool SetTensorData(const Tensor &dataset_points,
+                       const Tensor &points_row_splits);
+
     std::pair<Tensor, Tensor> SearchKnn(const Tensor &query_points,
                                         int knn) const override;
 
@@ -157,9 +174,91 @@ public:
                                            float radius,
                                            int max_knn) const override;
 
+    /// Perform K nearest neighbor search on a batched index.
+    ///
+    /// \param query_points Query points of all the batches. Must be 2D, with
+    /// shape {m, d}, same dtype with dataset_points.
+    /// \param queries_row_splits Row splits of the batches in query_points.
+    /// Must be 1D, with shape {batch_size + 1,} and dtype Int64.
+    /// \param knn Number of nearest neighbor to search.
+    /// \return Pair of Tensors: (indices, distances):
+    /// - indices: Tensor of shape {m, knn}, with dtype Int64. Indices are
+    /// rows of dataset_points. Queries of batches with less than knn points
+    /// are padded with -1.
+    /// - distainces: Tensor of shape {m, knn}, same dtype with dataset_points.
+    std::pair<Tensor, Tensor> SearchKnn(const Tensor &query_points,
+                                        const Tensor &queries_row_splits,
+                                        int knn) const;
+
+    /// Perform radius search on a batched index.
+    ///
+    /// \param query_points Query points of all the batches. Must be 2D, with
+    /// shape {m, d}, same dtype with dataset_points.
+    /// \param queries_row_splits Row splits of the batches in query_points.
+    /// Must be 1D, with shape {batch_size + 1,} and dtype Int64.
+    /// \param radius Radius.
+    /// \return Tuple of Tensors, (indices, distances, num_neighbors):
+    /// - indicecs: Tensor of shape {total_num_neighbors,}, dtype Int64.
+    /// Indices are rows of dataset_points.
+    /// - distances: Tensor of shape {total_num_neighbors,}, same dtype with
+    /// dataset_points.
+    /// - num_neighbors: Tensor of shape {m}, dtype Int64.
+    std::tuple<Tensor, Tensor, Tensor> SearchRadius(
+            const Tensor &query_points,
+            const Tensor &queries_row_splits,
+            double radius) const;
+
+    bool AddPoints(const Tensor &points) override;
+
+    bool RemovePoints(const Tensor &indices) override;
+
 protected:
-    // Tensor dataset_points_;
-    std::unique_ptr<NanoFlannIndexHolderBase> holder_;
+    /// KDTree over a subset of the dataset points.
+    struct NanoFlannTree {
+        /// Points of the tree, contiguous.
+        Tensor points_;
+        /// Dataset index of each point of the tree, in increasing order.
+        std::vector<int64_t> indices_;
+        std::unique_ptr<NanoFlannIndexHolderBase> holder_;
+        /// Number of points of the tree removed since it was built.
+        int64_t num_removed_ = 0;
+    };
+
+    /// Builds a tree from \p points, skipping the removed ones.
+    NanoFlannTree BuildTree(const Tensor &points,
+                            std::vector<int64_t> indices) const;
+
+    /// Rebuilds the tree \p tree_idx without its removed points, merged with
+    /// the next tree if \p merge_next.
+    void RebuildTree(size_t tree_idx, bool merge_next);
+
+    /// Searches the queries of each batch in the trees of the same batch.
+    /// Batch i has the queries in [queries_row_splits[i],
+    /// queries_row_splits[i + 1]) and the trees in [tree_splits[i],
+    /// tree_splits[i + 1]).
+    std::pair<Tensor, Tensor> SearchKnnInBatches(
+            const Tensor &query_points,
+            const std::vector<int64_t> &queries_row_splits,
+            const std::vector<int64_t> &tree_splits,
+            int knn) const;
+
+    /// Radius search counterpart of SearchKnnInBatches.
+    std::tuple<Tensor, Tensor, Tensor> SearchRadiusInBatches(
+            const Tensor &query_points,
+            const Tensor &radii,
+            const std::vector<int64_t> &queries_row_splits,
+            const std::vector<int64_t> &tree_splits) const;
+
+    /// Trees ordered by dataset indices: the first one holds the points set
+    /// with SetTensorData, the next ones the points added later. Batched
+    /// indices have one tree per batch instead. Empty trees have no holder.
+    std::vector<NanoFlannTree> trees_;
+    /// Removal flag of each dataset index.
+    std::vector<bool> removed_;
+    /// Number of points in the index, not removed.
+    int64_t num_active_points_ = 0;
+    /// Row splits of the batches, one tree each. Empty if not batched.
+    std::vector<int64_t> points_row_splits_;
 };
 }  // namespace nns
 }  // namespace core
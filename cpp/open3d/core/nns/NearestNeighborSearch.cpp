@@ -28,6 +28,7 @@
 
 #include "open3d/core/CoreUtil.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/Trace.h"
 
 namespace open3d {
 namespace core {
@@ -37,27 +38,55 @@ NearestNeighborSearch::~NearestNeighborSearch(){};
 
 bool NearestNeighborSearch::SetIndex() {
     nanoflann_index_.reset(new NanoFlannIndex());
+    if (IsBatched()) {
+        return nanoflann_index_->SetTensorData(dataset_points_,
+                                               points_row_splits_);
+    }
     return nanoflann_index_->SetTensorData(dataset_points_);
 };
 
 bool NearestNeighborSearch::KnnIndex() {
+    OPEN3D_TRACE_SCOPE("nns::KnnIndex");
     if (dataset_points_.GetDevice().GetType() == Device::DeviceType::CUDA) {
 #ifdef WITH_FAISS
-        faiss_index_.reset(new FaissIndex());
-        return faiss_index_->SetTensorData(dataset_points_);
+        // Faiss does not support batches, the native KnnIndex does.
+        if (!IsBatched()) {
+            faiss_index_.reset(new FaissIndex());
+            return faiss_index_->SetTensorData(dataset_points_);
+        }
+#endif
+#ifdef BUILD_CUDA_MODULE
+        knn_index_.reset(new nns::KnnIndex());
+        if (IsBatched()) {
+            return knn_index_->SetTensorData(dataset_points_,
+                                             points_row_splits_);
+        }
+        return knn_index_->SetTensorData(dataset_points_);
 #else
         utility::LogError(
-                "[NearestNeighborSearch::KnnIndex] Currently, Faiss is "
-                "disabled. Please recompile Open3D with WITH_FAISS=ON.");
+                "[NearestNeighborSearch::KnnIndex] KnnIndex with GPU tensor "
+                "is disabled since BUILD_CUDA_MODULE is OFF. Please recompile "
+                "Open3D with BUILD_CUDA_MODULE=ON.");
 #endif
     } else {
         return SetIndex();
     }
 };
 
-bool NearestNeighborSearch::MultiRadiusIndex() { return SetIndex(); };
+bool NearestNeighborSearch::ApproxKnnIndex(int num_trees) {
+    AssertBatched(false);
+    AssertNotCUDA(dataset_points_);
+    flann_index_.reset(new FlannIndex(num_trees));
+    return flann_index_->SetTensorData(dataset_points_);
+}
+
+bool NearestNeighborSearch::MultiRadiusIndex() {
+    AssertBatched(false);
+    return SetIndex();
+};
 
 bool NearestNeighborSearch::FixedRadiusIndex(utility::optional<double> radius) {
+    OPEN3D_TRACE_SCOPE("nns::FixedRadiusIndex");
     if (dataset_points_.GetDevice().GetType() == Device::DeviceType::CUDA) {
         if (!radius.has_value())
             utility::LogError(
@@ -65,6 +94,10 @@ bool NearestNeighborSearch::FixedRadiusIndex(utility::optional<double> radius) {
                     "required for GPU FixedRadiusIndex.");
 #ifdef BUILD_CUDA_MODULE
         fixed_radius_index_.reset(new nns::FixedRadiusIndex());
+        if (IsBatched()) {
+            return fixed_radius_index_->SetTensorData(
+                    dataset_points_, points_row_splits_, radius.value());
+        }
         return fixed_radius_index_->SetTensorData(dataset_points_,
                                                   radius.value());
 #else
@@ -74,12 +107,26 @@ bool NearestNeighborSearch::FixedRadiusIndex(utility::optional<double> radius) {
                 "Please recompile Open3D with BUILD_CUDA_MODULE=ON.");
 #endif
 
+    } else if (radius.has_value() && dataset_points_.NumDims() == 2 &&
+               dataset_points_.GetShape()[1] == 3) {
+        // The spatial hash table of FixedRadiusIndex answers searches up to
+        // the given radius faster than the KDTree.
+        fixed_radius_index_.reset(new nns::FixedRadiusIndex());
+        if (IsBatched()) {
+            return fixed_radius_index_->SetTensorData(
+                    dataset_points_, points_row_splits_, radius.value());
+        }
+        return fixed_radius_index_->SetTensorData(dataset_points_,
+                                                  radius.value());
     } else {
+        fixed_radius_index_.reset();
         return SetIndex();
     }
 }
 
-bool NearestNeighborSearch::HybridIndex() {
+bool NearestNeighborSearch::HybridIndex(utility::optional<double> radius) {
+    OPEN3D_TRACE_SCOPE("nns::HybridIndex");
+    AssertBatched(false);
     if (dataset_points_.GetDevice().GetType() == Device::DeviceType::CUDA) {
 #ifdef WITH_FAISS
         faiss_index_.reset(new FaissIndex());
@@ -89,18 +136,29 @@ bool NearestNeighborSearch::HybridIndex() {
                 "[NearestNeighborSearch::HybridIndex] Currently, Faiss is "
                 "disabled. Please recompile Open3D with WITH_FAISS=ON.");
 #endif
+    } else if (radius.has_value() && dataset_points_.NumDims() == 2 &&
+               dataset_points_.GetShape()[1] == 3) {
+        fixed_radius_index_.reset(new nns::FixedRadiusIndex());
+        return fixed_radius_index_->SetTensorData(dataset_points_,
+                                                  radius.value());
     } else {
+        fixed_radius_index_.reset();
         return SetIndex();
     }
 };
 
 std::pair<Tensor, Tensor> NearestNeighborSearch::KnnSearch(
         const Tensor& query_points, int knn) {
+    OPEN3D_TRACE_SCOPE("nns::KnnSearch");
+    AssertBatched(false);
 #ifdef WITH_FAISS
     if (faiss_index_) {
         return faiss_index_->SearchKnn(query_points, knn);
     }
 #endif
+    if (knn_index_) {
+        return knn_index_->SearchKnn(query_points, knn);
+    }
     if (nanoflann_index_) {
         return nanoflann_index_->SearchKnn(query_points, knn);
     } else {
@@ -109,8 +167,20 @@ std::pair<Tensor, Tensor> NearestNeighborSearch::KnnSearch(
     }
 }
 
+std::pair<Tensor, Tensor> NearestNeighborSearch::ApproxKnnSearch(
+        const Tensor& query_points, int knn, int checks) {
+    OPEN3D_TRACE_SCOPE("nns::ApproxKnnSearch");
+    if (!flann_index_) {
+        utility::LogError(
+                "[NearestNeighborSearch::ApproxKnnSearch] Index is not set.");
+    }
+    return flann_index_->SearchKnn(query_points, knn, checks);
+}
+
 std::tuple<Tensor, Tensor, Tensor> NearestNeighborSearch::FixedRadiusSearch(
         const Tensor& query_points, double radius) {
+    OPEN3D_TRACE_SCOPE("nns::FixedRadiusSearch");
+    AssertBatched(false);
     if (dataset_points_.GetDevice().GetType() == Device::DeviceType::CUDA) {
         if (fixed_radius_index_) {
             return fixed_radius_index_->SearchRadius(query_points, radius);
@@ -120,7 +190,9 @@ std::tuple<Tensor, Tensor, Tensor> NearestNeighborSearch::FixedRadiusSearch(
                     "set.");
         }
     } else {
-        if (nanoflann_index_) {
+        if (fixed_radius_index_) {
+            return fixed_radius_index_->SearchRadius(query_points, radius);
+        } else if (nanoflann_index_) {
             return nanoflann_index_->SearchRadius(query_points, radius);
         } else {
             utility::LogError(
@@ -130,8 +202,55 @@ std::tuple<Tensor, Tensor, Tensor> NearestNeighborSearch::FixedRadiusSearch(
     }
 }
 
+std::pair<Tensor, Tensor> NearestNeighborSearch::KnnSearch(
+        const Tensor& query_points, const Tensor& queries_row_splits, int knn) {
+    OPEN3D_TRACE_SCOPE("nns::KnnSearch");
+    AssertBatched(true);
+    if (knn_index_) {
+        return knn_index_->SearchKnn(query_points, queries_row_splits, knn);
+    }
+    if (nanoflann_index_) {
+        return nanoflann_index_->SearchKnn(query_points, queries_row_splits,
+                                           knn);
+    } else {
+        utility::LogError(
+                "[NearestNeighborSearch::KnnSearch] Index is not set.");
+    }
+}
+
+std::tuple<Tensor, Tensor, Tensor> NearestNeighborSearch::FixedRadiusSearch(
+        const Tensor& query_points,
+        const Tensor& queries_row_splits,
+        double radius) {
+    OPEN3D_TRACE_SCOPE("nns::FixedRadiusSearch");
+    AssertBatched(true);
+    if (dataset_points_.GetDevice().GetType() == Device::DeviceType::CUDA) {
+        if (fixed_radius_index_) {
+            return fixed_radius_index_->SearchRadius(
+                    query_points, queries_row_splits, radius);
+        } else {
+            utility::LogError(
+                    "[NearsetNeighborSearch::FixedRadiusSearch] Index is not "
+                    "set.");
+        }
+    } else {
+        if (fixed_radius_index_) {
+            return fixed_radius_index_->SearchRadius(
+                    query_points, queries_row_splits, radius);
+        } else if (nanoflann_index_) {
+            return nanoflann_index_->SearchRadius(
+                    query_points, queries_row_splits, radius);
+        } else {
+            utility::LogError(
+                    "[NearestNeighborSearch::FixedRadiusSearch] Index is not "
+                    "set.");
+        }
+    }
+}
+
 std::tuple<Tensor, Tensor, Tensor> NearestNeighborSearch::MultiRadiusSearch(
         const Tensor& query_points, const Tensor& radii) {
+    OPEN3D_TRACE_SCOPE("nns::MultiRadiusSearch");
     AssertNotCUDA(query_points);
     if (!nanoflann_index_) {
         utility::LogError(
@@ -153,11 +272,17 @@ std::tuple<Tensor, Tensor, Tensor> NearestNeighborSearch::MultiRadiusSearch(
 
 std::pair<Tensor, Tensor> NearestNeighborSearch::HybridSearch(
         const Tensor& query_points, double radius, int max_knn) {
+    OPEN3D_TRACE_SCOPE("nns::HybridSearch");
 #ifdef WITH_FAISS
     if (faiss_index_) {
         return faiss_index_->SearchHybrid(query_points, radius, max_knn);
     }
 #endif
+    if (fixed_radius_index_ &&
+        dataset_points_.GetDevice().GetType() == Device::DeviceType::CPU) {
+        return fixed_radius_index_->SearchHybrid(
+                query_points, static_cast<float>(radius), max_knn);
+    }
     if (nanoflann_index_) {
         return nanoflann_index_->SearchHybrid(
                 query_points, static_cast<float>(radius), max_knn);
@@ -167,6 +292,60 @@ std::pair<Tensor, Tensor> NearestNeighborSearch::HybridSearch(
     }
 }
 
+bool NearestNeighborSearch::AddPoints(const Tensor& points) {
+    AssertDynamicIndex();
+    bool success = true;
+    if (nanoflann_index_) {
+        success = nanoflann_index_->AddPoints(points) && success;
+    }
+    if (fixed_radius_index_) {
+        success = fixed_radius_index_->AddPoints(points) && success;
+    }
+    return success;
+}
+
+bool NearestNeighborSearch::RemovePoints(const Tensor& indices) {
+    AssertDynamicIndex();
+    bool success = true;
+    if (nanoflann_index_) {
+        success = nanoflann_index_->RemovePoints(indices) && success;
+    }
+    if (fixed_radius_index_) {
+        success = fixed_radius_index_->RemovePoints(indices) && success;
+    }
+    return success;
+}
+
+void NearestNeighborSearch::AssertDynamicIndex() const {
+    if (IsBatched()) {
+        utility::LogError(
+                "[NearestNeighborSearch] Adding and removing points is not "
+                "supported for batched dataset_points.");
+    }
+    if (faiss_index_ || knn_index_ || flann_index_) {
+        utility::LogError(
+                "[NearestNeighborSearch] Adding and removing points is only "
+                "supported by the exact CPU indices and FixedRadiusIndex.");
+    }
+    if (!nanoflann_index_ && !fixed_radius_index_) {
+        utility::LogError("[NearestNeighborSearch] Index is not set.");
+    }
+}
+
+void NearestNeighborSearch::AssertBatched(bool batched) const {
+    if (batched && !IsBatched()) {
+        utility::LogError(
+                "[NearestNeighborSearch] queries_row_splits requires batched "
+                "dataset_points, constructed with points_row_splits.");
+    }
+    if (!batched && IsBatched()) {
+        utility::LogError(
+                "[NearestNeighborSearch] Only KnnIndex and FixedRadiusIndex "
+                "support batched dataset_points, searched with "
+                "queries_row_splits.");
+    }
+}
+
 void NearestNeighborSearch::AssertNotCUDA(const Tensor& t) const {
     if (t.GetDevice().GetType() == Device::DeviceType::CUDA) {
         utility::LogError(
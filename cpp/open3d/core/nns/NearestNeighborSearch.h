@@ -31,6 +31,8 @@
 #include "open3d/core/Tensor.h"
 #include "open3d/core/nns/FaissIndex.h"
 #include "open3d/core/nns/FixedRadiusIndex.h"
+#include "open3d/core/nns/FlannIndex.h"
+#include "open3d/core/nns/KnnIndex.h"
 #include "open3d/core/nns/NanoFlannIndex.h"
 #include "open3d/utility/Optional.h"
 
@@ -50,16 +52,40 @@ public:
     NearestNeighborSearch(const Tensor &dataset_points)
         : dataset_points_(dataset_points){};
 
+    /// Constructor for a batch of datasets, such as the point clouds of a
+    /// batch of scenes. Only KnnIndex and FixedRadiusIndex support batches.
+    /// They build one index for all the batches, and the batched KnnSearch
+    /// and FixedRadiusSearch only return neighbors from the batch of each
+    /// query.
+    ///
+    /// \param dataset_points Dataset points of all the batches. Must be 2D,
+    /// with shape {n, d}.
+    /// \param points_row_splits Row splits of the batches in dataset_points.
+    /// Must be 1D, with shape {batch_size + 1,} and dtype Int64.
+    NearestNeighborSearch(const Tensor &dataset_points,
+                          const Tensor &points_row_splits)
+        : dataset_points_(dataset_points),
+          points_row_splits_(points_row_splits){};
+
     ~NearestNeighborSearch();
     NearestNeighborSearch(const NearestNeighborSearch &) = delete;
     NearestNeighborSearch &operator=(const NearestNeighborSearch &) = delete;
 
 public:
-    /// Set index for knn search.
+    /// Set index for knn search. On GPU, Faiss is used if available and the
+    /// native KnnIndex for 3D points otherwise.
     ///
     /// \return Returns true if building index success, otherwise false.
     bool KnnIndex();
 
+    /// Set index for approximate knn search, a randomized KDTree forest. CPU
+    /// only.
+    ///
+    /// \param num_trees Number of randomized KDTrees. More trees raise the
+    /// recall for a given number of checks.
+    /// \return Returns true if building index success, otherwise false.
+    bool ApproxKnnIndex(int num_trees = FlannIndex::kDefaultNumTrees);
+
     /// Set index for multi-radius search.
     ///
     /// \return Returns true if building index success, otherwise false.
@@ -68,13 +94,19 @@ public:
     /// Set index for fixed-radius search.
     ///
     /// \param radius optional radius parameter. required for gpu fixed radius
-    /// index. \return Returns true if building index success, otherwise false.
+    /// index. For CPU tensors, a radius builds a spatial hash table instead of
+    /// a KDTree, and later searches must not use a larger radius.
+    /// \return Returns true if building index success, otherwise false.
     bool FixedRadiusIndex(utility::optional<double> radius = {});
 
     /// Set index for hybrid search.
     ///
+    /// \param radius optional maximum distance of the neighbors. For CPU
+    /// tensors, it builds a spatial hash table instead of a KDTree, and the
+    /// radius of later HybridSearch calls, which bounds the squared distances,
+    /// must not be larger than its square. Ignored for GPU tensors.
     /// \return Returns true if building index success, otherwise false.
-    bool HybridIndex();
+    bool HybridIndex(utility::optional<double> radius = {});
 
     /// Perform knn search.
     ///
@@ -85,6 +117,37 @@ public:
     /// - distainces: Tensor of shape {n, knn}, same dtype with query_points.
     std::pair<Tensor, Tensor> KnnSearch(const Tensor &query_points, int knn);
 
+    /// Perform knn search for a batch of queries.
+    ///
+    /// \param query_points Query points of all the batches. Must be 2D, with
+    /// shape {m, d}.
+    /// \param queries_row_splits Row splits of the batches in query_points,
+    /// with the same batch size as points_row_splits. Must be 1D, with dtype
+    /// Int64.
+    /// \param knn Number of neighbors to search per query point.
+    /// \return Pair of Tensors, (indices, distances):
+    /// - indices: Tensor of shape {m, knn}, with dtype Int64. Indices are
+    /// rows of dataset_points. Queries of batches with less than knn points
+    /// are padded with -1.
+    /// - distainces: Tensor of shape {m, knn}, same dtype with query_points.
+    std::pair<Tensor, Tensor> KnnSearch(const Tensor &query_points,
+                                        const Tensor &queries_row_splits,
+                                        int knn);
+
+    /// Perform approximate knn search, with the index set by ApproxKnnIndex.
+    ///
+    /// \param query_points Query points. Must be 2D, with shape {n, d}.
+    /// \param knn Number of neighbors to search per query point.
+    /// \param checks Number of dataset points compared per query, trading
+    /// accuracy for speed. -1 gives the exact neighbors.
+    /// \return Pair of Tensors, (indices, distances):
+    /// - indices: Tensor of shape {n, knn}, with dtype Int64.
+    /// - distainces: Tensor of shape {n, knn}, same dtype with query_points.
+    std::pair<Tensor, Tensor> ApproxKnnSearch(
+            const Tensor &query_points,
+            int knn,
+            int checks = FlannIndex::kDefaultChecks);
+
     /// Perform fixed radius search. All query points share the same radius.
     ///
     /// \param query_points Data points for querying. Must be 2D, with shape {n,
@@ -99,6 +162,25 @@ public:
     std::tuple<Tensor, Tensor, Tensor> FixedRadiusSearch(
             const Tensor &query_points, double radius);
 
+    /// Perform fixed radius search for a batch of queries.
+    ///
+    /// \param query_points Query points of all the batches. Must be 2D, with
+    /// shape {m, d}.
+    /// \param queries_row_splits Row splits of the batches in query_points,
+    /// with the same batch size as points_row_splits. Must be 1D, with dtype
+    /// Int64.
+    /// \param radius Radius.
+    /// \return Tuple of Tensors, (indices, distances, num_neighbors):
+    /// - indicecs: Tensor of shape {total_number_of_neighbors,}, with dtype
+    /// Int64. Indices are rows of dataset_points.
+    /// - distances: Tensor of shape {total_number_of_neighbors,}, same dtype
+    /// with query_points.
+    /// - num_neighbors: Tensor of shape {m,}, with dtype Int64.
+    std::tuple<Tensor, Tensor, Tensor> FixedRadiusSearch(
+            const Tensor &query_points,
+            const Tensor &queries_row_splits,
+            double radius);
+
     /// Perform multi-radius search. Each query point has an independent radius.
     ///
     /// \param query_points Query points. Must be 2D, with shape {n, d}.
@@ -127,9 +209,37 @@ public:
                                            double radius,
                                            int max_knn);
 
+    /// Add points to the dataset of the indices set so far. The new points
+    /// get the indices following the ones of the points already added, so
+    /// indices returned by previous searches remain valid.
+    ///
+    /// \param points Points to add. Must be 2D, with shape {n, d}, same dtype
+    /// and device with dataset_points.
+    /// \return Returns true if the update success, otherwise false.
+    bool AddPoints(const Tensor &points);
+
+    /// Remove points from the dataset of the indices set so far. Indices of
+    /// the other points do not change and removed indices are not reused.
+    ///
+    /// \param indices Indices of the points to remove. Must be 1D, with dtype
+    /// Int64.
+    /// \return Returns true if the update success, otherwise false.
+    bool RemovePoints(const Tensor &indices);
+
 private:
     bool SetIndex();
 
+    /// Returns true if the dataset points are split in batches.
+    bool IsBatched() const { return points_row_splits_.NumElements() > 0; }
+
+    /// Assert that the dataset points are split in batches if \p batched,
+    /// and are not otherwise.
+    void AssertBatched(bool batched) const;
+
+    /// Assert that an index is set and all the set indices support adding and
+    /// removing points.
+    void AssertDynamicIndex() const;
+
     /// Assert a Tensor is not CUDA tensoer. This will be removed in the future.
     void AssertNotCUDA(const Tensor &t) const;
 
@@ -137,7 +247,11 @@ protected:
     std::unique_ptr<NanoFlannIndex> nanoflann_index_;
     std::unique_ptr<FaissIndex> faiss_index_;
     std::unique_ptr<nns::FixedRadiusIndex> fixed_radius_index_;
+    std::unique_ptr<nns::KnnIndex> knn_index_;
+    std::unique_ptr<FlannIndex> flann_index_;
     const Tensor dataset_points_;
+    /// Row splits of the batches of dataset_points_, empty if not batched.
+    const Tensor points_row_splits_;
 };
 }  // namespace nns
 }  // namespace core
@@ -0,0 +1,118 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <Eigen/Sparse>
+#include <memory>
+#include <vector>
+
+#include "open3d/geometry/MeshBase.h"
+
+namespace open3d {
+namespace geometry {
+
+class TriangleMesh;
+
+/// \class ARAPDeformer
+///
+/// \brief Deforms a mesh with the method by Sorkine and Alexa,
+/// "As-Rigid-As-Possible Surface Modeling", 2007, keeping its state between
+/// calls for interactive editing.
+///
+/// The adjacency and the cotangent weights of the rest mesh are computed
+/// once. The positions of the free vertices are the solution of a symmetric
+/// positive definite system in which the constrained vertices are
+/// eliminated, so that its Cholesky factorization only depends on the set of
+/// constrained vertices and is reused while it does not change. Each call
+/// starts from the positions and rotations of the previous one.
+class ARAPDeformer {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param mesh Rest mesh, which is copied.
+    /// \param energy Energy model that should be optimized.
+    /// \param smoothed_alpha Alpha parameter of the smoothed ARAP model.
+    ARAPDeformer(const TriangleMesh &mesh,
+                 MeshBase::DeformAsRigidAsPossibleEnergy energy =
+                         MeshBase::DeformAsRigidAsPossibleEnergy::Spokes,
+                 double smoothed_alpha = 0.01);
+
+public:
+    /// \brief Deforms the rest mesh to satisfy the constraints.
+    ///
+    /// \param constraint_vertex_indices Indices of the vertices that should
+    /// be constrained by the vertex positions in constraint_vertex_positions.
+    /// \param constraint_vertex_positions Vertex positions used for the
+    /// constraints.
+    /// \param max_iter Maximum number of iterations to minimize the energy
+    /// functional.
+    /// \return The deformed TriangleMesh.
+    std::shared_ptr<TriangleMesh> Deform(
+            const std::vector<int> &constraint_vertex_indices,
+            const std::vector<Eigen::Vector3d> &constraint_vertex_positions,
+            size_t max_iter);
+
+    /// Restarts the next deformation from the rest mesh.
+    void Reset();
+
+    /// Positions of the vertices after the last deformation.
+    const std::vector<Eigen::Vector3d> &GetPositions() const {
+        return positions_;
+    }
+
+protected:
+    /// Builds and factorizes the system of the free vertices.
+    void Factorize(const std::vector<int> &constrained_vertices);
+
+protected:
+    std::shared_ptr<TriangleMesh> mesh_;
+    MeshBase::DeformAsRigidAsPossibleEnergy energy_;
+    double smoothed_alpha_;
+    double surface_area_ = -1;
+
+    /// Neighbors of vertex i and the cotangent weights of the edges in
+    /// [neighbor_offsets_[i], neighbor_offsets_[i + 1]).
+    std::vector<int> neighbor_offsets_;
+    std::vector<int> neighbors_;
+    std::vector<double> weights_;
+
+    /// Sorted indices of the constrained vertices of the factorization.
+    std::vector<int> constrained_vertices_;
+    /// Index of each vertex in the system, -1 for the constrained ones.
+    std::vector<int> free_index_;
+    std::vector<int> free_vertices_;
+    Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> solver_;
+    bool factorized_ = false;
+
+    std::vector<Eigen::Vector3d> positions_;
+    std::vector<Eigen::Matrix3d> rotations_;
+    bool has_rotations_ = false;
+};
+
+}  // namespace geometry
+}  // namespace open3d
@@ -27,12 +27,15 @@
 #include "open3d/geometry/BoundingVolume.h"
 
 #include <Eigen/Eigenvalues>
-#include <numeric>
+#include <algorithm>
+#include <limits>
+#include <utility>
 
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/Qhull.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
@@ -145,15 +148,44 @@ OrientedBoundingBox OrientedBoundingBox::CreateFromAxisAlignedBoundingBox(
     return obox;
 }
 
-OrientedBoundingBox OrientedBoundingBox::CreateFromPoints(
-        const std::vector<Eigen::Vector3d>& points) {
-    PointCloud hull_pcd;
-    hull_pcd.points_ = std::get<0>(Qhull::ComputeConvexHull(points))->vertices_;
+namespace {
 
-    Eigen::Vector3d mean;
-    Eigen::Matrix3d cov;
-    std::tie(mean, cov) = hull_pcd.ComputeMeanAndCovariance();
+// Below this size, starting the threads costs more than the reductions.
+constexpr int kMinPointsPerThread = 16384;
 
+// Mean and covariance of the points in a single parallel pass. The points are
+// accumulated relative to the first one to limit the cancellation in the
+// covariance.
+std::pair<Eigen::Vector3d, Eigen::Matrix3d> ComputeMeanAndCovarianceParallel(
+        const std::vector<Eigen::Vector3d>& points) {
+    const int num_points = static_cast<int>(points.size());
+    const Eigen::Vector3d& origin = points[0];
+    Eigen::Vector3d sum = Eigen::Vector3d::Zero();
+    Eigen::Matrix3d sum_sq = Eigen::Matrix3d::Zero();
+#pragma omp parallel if (num_points > kMinPointsPerThread) num_threads(utility::EstimateMaxThreads())
+    {
+        Eigen::Vector3d local_sum = Eigen::Vector3d::Zero();
+        Eigen::Matrix3d local_sum_sq = Eigen::Matrix3d::Zero();
+#pragma omp for nowait
+        for (int i = 0; i < num_points; i++) {
+            const Eigen::Vector3d p = points[i] - origin;
+            local_sum += p;
+            local_sum_sq.noalias() += p * p.transpose();
+        }
+#pragma omp critical
+        {
+            sum += local_sum;
+            sum_sq += local_sum_sq;
+        }
+    }
+    const Eigen::Vector3d mean = sum / num_points;
+    const Eigen::Matrix3d cov = sum_sq / num_points - mean * mean.transpose();
+    return std::make_pair(mean + origin, cov);
+}
+
+// Unit eigenvectors of the covariance as the columns, sorted by decreasing
+// eigenvalue.
+Eigen::Matrix3d ComputePrincipalAxes(const Eigen::Matrix3d& cov) {
     Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> es(cov);
     Eigen::Vector3d evals = es.eigenvalues();
     Eigen::Matrix3d R = es.eigenvectors();
@@ -179,20 +211,205 @@ OrientedBoundingBox OrientedBoundingBox::CreateFromPoints(
         R.col(2) = R.col(1);
         R.col(1) = tmp;
     }
+    return R;
+}
 
-    for (auto& pt : hull_pcd.points_) {
-        pt = R.transpose() * (pt - mean);
+// The box with the axes R that encloses the points. The points are projected
+// relative to origin to limit the cancellation.
+OrientedBoundingBox FitBoxWithAxes(const std::vector<Eigen::Vector3d>& points,
+                                   const Eigen::Matrix3d& R,
+                                   const Eigen::Vector3d& origin) {
+    const int num_points = static_cast<int>(points.size());
+    const Eigen::Matrix3d Rt = R.transpose();
+    Eigen::Array3d min_bound = (Rt * (points[0] - origin)).array();
+    Eigen::Array3d max_bound = min_bound;
+#pragma omp parallel if (num_points > kMinPointsPerThread) num_threads(utility::EstimateMaxThreads())
+    {
+        Eigen::Array3d local_min = min_bound;
+        Eigen::Array3d local_max = max_bound;
+#pragma omp for nowait
+        for (int i = 0; i < num_points; i++) {
+            const Eigen::Array3d p = (Rt * (points[i] - origin)).array();
+            local_min = local_min.min(p);
+            local_max = local_max.max(p);
+        }
+#pragma omp critical
+        {
+            min_bound = min_bound.min(local_min);
+            max_bound = max_bound.max(local_max);
+        }
     }
-    const auto aabox = hull_pcd.GetAxisAlignedBoundingBox();
-
     OrientedBoundingBox obox;
-    obox.center_ = R * aabox.GetCenter() + mean;
+    obox.center_ = R * ((min_bound + max_bound) * 0.5).matrix() + origin;
     obox.R_ = R;
-    obox.extent_ = aabox.GetExtent();
-
+    obox.extent_ = (max_bound - min_bound).matrix();
     return obox;
 }
 
+double Cross2D(const Eigen::Vector2d& o,
+               const Eigen::Vector2d& a,
+               const Eigen::Vector2d& b) {
+    return (a(0) - o(0)) * (b(1) - o(1)) - (a(1) - o(1)) * (b(0) - o(0));
+}
+
+// Convex hull of 2D points in counter-clockwise order, with Andrew's monotone
+// chain. The points are sorted in-place.
+std::vector<Eigen::Vector2d> ComputeConvexHull2D(
+        std::vector<Eigen::Vector2d>& points) {
+    std::sort(points.begin(), points.end(),
+              [](const Eigen::Vector2d& a, const Eigen::Vector2d& b) {
+                  return a(0) < b(0) || (a(0) == b(0) && a(1) < b(1));
+              });
+    const size_t n = points.size();
+    if (n < 3) {
+        return points;
+    }
+    std::vector<Eigen::Vector2d> hull(2 * n);
+    size_t k = 0;
+    for (size_t i = 0; i < n; i++) {
+        while (k >= 2 && Cross2D(hull[k - 2], hull[k - 1], points[i]) <= 0) {
+            k--;
+        }
+        hull[k++] = points[i];
+    }
+    for (size_t i = n - 1, lower = k + 1; i > 0; i--) {
+        while (k >= lower &&
+               Cross2D(hull[k - 2], hull[k - 1], points[i - 1]) <= 0) {
+            k--;
+        }
+        hull[k++] = points[i - 1];
+    }
+    hull.resize(k - 1);
+    return hull;
+}
+
+}  // namespace
+
+OrientedBoundingBox OrientedBoundingBox::CreateFromPoints(
+        const std::vector<Eigen::Vector3d>& points) {
+    PointCloud hull_pcd;
+    hull_pcd.points_ = std::get<0>(Qhull::ComputeConvexHull(points))->vertices_;
+
+    Eigen::Vector3d mean;
+    Eigen::Matrix3d cov;
+    std::tie(mean, cov) = hull_pcd.ComputeMeanAndCovariance();
+    return FitBoxWithAxes(hull_pcd.points_, ComputePrincipalAxes(cov), mean);
+}
+
+OrientedBoundingBox OrientedBoundingBox::CreateFromPointsPCA(
+        const std::vector<Eigen::Vector3d>& points) {
+    if (points.empty()) {
+        return OrientedBoundingBox();
+    }
+    Eigen::Vector3d mean;
+    Eigen::Matrix3d cov;
+    std::tie(mean, cov) = ComputeMeanAndCovarianceParallel(points);
+    return FitBoxWithAxes(points, ComputePrincipalAxes(cov), mean);
+}
+
+OrientedBoundingBox OrientedBoundingBox::CreateFromPointsMinimal(
+        const std::vector<Eigen::Vector3d>& points) {
+    std::shared_ptr<TriangleMesh> hull;
+    std::tie(hull, std::ignore) = Qhull::ComputeConvexHull(points);
+    const std::vector<Eigen::Vector3d>& vertices = hull->vertices_;
+    const int num_vertices = static_cast<int>(vertices.size());
+    const int num_faces = static_cast<int>(hull->triangles_.size());
+
+    Eigen::Vector3d mean;
+    Eigen::Matrix3d cov;
+    std::tie(mean, cov) = ComputeMeanAndCovarianceParallel(vertices);
+    const OrientedBoundingBox pca_box =
+            FitBoxWithAxes(vertices, ComputePrincipalAxes(cov), mean);
+
+    // Faces are compared by (volume, index) so that the result does not
+    // depend on the thread scheduling.
+    double best_volume = pca_box.Volume();
+    int best_face = -1;
+    Eigen::Matrix3d best_R = pca_box.R_;
+#pragma omp parallel num_threads(utility::EstimateMaxThreads())
+    {
+        double local_volume = best_volume;
+        int local_face = -1;
+        Eigen::Matrix3d local_R = best_R;
+        std::vector<Eigen::Vector2d> projected(num_vertices);
+#pragma omp for schedule(dynamic) nowait
+        for (int f = 0; f < num_faces; f++) {
+            const Eigen::Vector3i& triangle = hull->triangles_[f];
+            const Eigen::Vector3d e0 =
+                    vertices[triangle(1)] - vertices[triangle(0)];
+            const Eigen::Vector3d e1 =
+                    vertices[triangle(2)] - vertices[triangle(0)];
+            Eigen::Vector3d n = e0.cross(e1);
+            if (n.norm() == 0 || e0.norm() == 0) {
+                continue;
+            }
+            n.normalize();
+            const Eigen::Vector3d u = e0.normalized();
+            const Eigen::Vector3d w = n.cross(u);
+
+            // Height along the normal and the 2D hull in the face plane.
+            double min_h = std::numeric_limits<double>::max();
+            double max_h = std::numeric_limits<double>::lowest();
+            for (int i = 0; i < num_vertices; i++) {
+                const Eigen::Vector3d p = vertices[i] - mean;
+                projected[i] = Eigen::Vector2d(u.dot(p), w.dot(p));
+                min_h = std::min(min_h, n.dot(p));
+                max_h = std::max(max_h, n.dot(p));
+            }
+            const double height = max_h - min_h;
+            const std::vector<Eigen::Vector2d> hull_2d =
+                    ComputeConvexHull2D(projected);
+
+            // The minimal-area rectangle has a side on an edge of the hull.
+            for (size_t j = 0; j < hull_2d.size(); j++) {
+                Eigen::Vector2d d =
+                        hull_2d[(j + 1) % hull_2d.size()] - hull_2d[j];
+                if (d.norm() == 0) {
+                    continue;
+                }
+                d.normalize();
+                double min_a = std::numeric_limits<double>::max();
+                double max_a = std::numeric_limits<double>::lowest();
+                double min_b = std::numeric_limits<double>::max();
+                double max_b = std::numeric_limits<double>::lowest();
+                for (const Eigen::Vector2d& q : hull_2d) {
+                    const double a = d.dot(q);
+                    const double b = d(0) * q(1) - d(1) * q(0);
+                    min_a = std::min(min_a, a);
+                    max_a = std::max(max_a, a);
+                    min_b = std::min(min_b, b);
+                    max_b = std::max(max_b, b);
+                }
+                const double volume =
+                        (max_a - min_a) * (max_b - min_b) * height;
+                if (volume < local_volume ||
+                    (volume == local_volume && local_face >= 0 &&
+                     f < local_face)) {
+                    local_volume = volume;
+                    local_face = f;
+                    local_R.col(0) = d(0) * u + d(1) * w;
+                    local_R.col(1) = -d(1) * u + d(0) * w;
+                    local_R.col(2) = n;
+                }
+            }
+        }
+#pragma omp critical
+        {
+            if (local_face >= 0 &&
+                (local_volume < best_volume ||
+                 (local_volume == best_volume && local_face < best_face))) {
+                best_volume = local_volume;
+                best_face = local_face;
+                best_R = local_R;
+            }
+        }
+    }
+    if (best_face < 0) {
+        return pca_box;
+    }
+    return FitBoxWithAxes(vertices, best_R, mean);
+}
+
 AxisAlignedBoundingBox& AxisAlignedBoundingBox::Clear() {
     min_bound_.setZero();
     max_bound_.setZero();
@@ -279,21 +496,7 @@ AxisAlignedBoundingBox& AxisAlignedBoundingBox::operator+=(
 AxisAlignedBoundingBox AxisAlignedBoundingBox::CreateFromPoints(
         const std::vector<Eigen::Vector3d>& points) {
     AxisAlignedBoundingBox box;
-    if (points.empty()) {
-        box.min_bound_ = Eigen::Vector3d(0.0, 0.0, 0.0);
-        box.max_bound_ = Eigen::Vector3d(0.0, 0.0, 0.0);
-    } else {
-        box.min_bound_ = std::accumulate(
-                points.begin(), points.end(), points[0],
-                [](const Eigen::Vector3d& a, const Eigen::Vector3d& b) {
-                    return a.array().min(b.array()).matrix();
-                });
-        box.max_bound_ = std::accumulate(
-                points.begin(), points.end(), points[0],
-                [](const Eigen::Vector3d& a, const Eigen::Vector3d& b) {
-                    return a.array().max(b.array()).matrix();
-                });
-    }
+    std::tie(box.min_bound_, box.max_bound_) = ComputeMinMaxBound(points);
     return box;
 }
 
@@ -127,6 +127,32 @@ public:
     static OrientedBoundingBox CreateFromPoints(
             const std::vector<Eigen::Vector3d>& points);
 
+    /// \brief Creates an oriented bounding box using a PCA over all points,
+    /// without computing the convex hull.
+    ///
+    /// The mean, the covariance and the extents are parallel reductions over
+    /// the points, so this is much faster than CreateFromPoints() for large
+    /// sets, but the box axes can differ as the interior points contribute to
+    /// the covariance. Any number of points is accepted, an empty set gives an
+    /// empty box.
+    ///
+    /// \param points A list of points.
+    static OrientedBoundingBox CreateFromPointsPCA(
+            const std::vector<Eigen::Vector3d>& points);
+
+    /// \brief Creates an approximately minimal-volume oriented bounding box.
+    ///
+    /// For every face of the convex hull, the box with a face flush with it
+    /// and the minimal-area rectangle of the hull projected onto that face is
+    /// evaluated, and the smallest one is kept, starting from the PCA box of
+    /// the hull as CreateFromPoints(). The exact minimum, cf. O'Rourke's
+    /// algorithm, can have no face flush with the hull, but this search is
+    /// exact for the boxes that do. The faces are searched in parallel.
+    ///
+    /// \param points A list of points, at least 4 and not coplanar.
+    static OrientedBoundingBox CreateFromPointsMinimal(
+            const std::vector<Eigen::Vector3d>& points);
+
 public:
     /// The center point of the bounding box.
     Eigen::Vector3d center_;
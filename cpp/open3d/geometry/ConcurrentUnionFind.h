@@ -0,0 +1,85 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <utility>
+#include <vector>
+
+namespace open3d {
+namespace geometry {
+
+/// Union-find over integers that supports concurrent Union() and Find()
+/// calls. Roots are linked to the smaller root with compare-and-swap, so the
+/// root of a set is always its smallest element.
+class ConcurrentUnionFind {
+public:
+    explicit ConcurrentUnionFind(int size) : parent_(size) {
+        for (int i = 0; i < size; ++i) {
+            parent_[i].store(i, std::memory_order_relaxed);
+        }
+    }
+
+    int Find(int x) {
+        while (true) {
+            int parent = parent_[x].load(std::memory_order_relaxed);
+            if (parent == x) {
+                return x;
+            }
+            // Path halving; a failed exchange only means another thread
+            // already shortened the path.
+            int grandparent = parent_[parent].load(std::memory_order_relaxed);
+            parent_[x].compare_exchange_weak(parent, grandparent,
+                                             std::memory_order_relaxed);
+            x = grandparent;
+        }
+    }
+
+    void Union(int a, int b) {
+        while (true) {
+            a = Find(a);
+            b = Find(b);
+            if (a == b) {
+                return;
+            }
+            if (a < b) {
+                std::swap(a, b);
+            }
+            int expected = a;
+            if (parent_[a].compare_exchange_strong(expected, b,
+                                                   std::memory_order_relaxed)) {
+                return;
+            }
+        }
+    }
+
+private:
+    std::vector<std::atomic<int>> parent_;
+};
+
+}  // namespace geometry
+}  // namespace open3d
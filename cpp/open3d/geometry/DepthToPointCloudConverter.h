@@ -0,0 +1,129 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <memory>
+#include <vector>
+
+#include "open3d/camera/PinholeCameraIntrinsic.h"
+
+namespace open3d {
+namespace geometry {
+
+class Image;
+class PointCloud;
+class RGBDImage;
+
+/// \class DepthToPointCloudConverter
+///
+/// \brief Converts the depth and RGB-D images of a camera to point clouds,
+/// as PointCloud::CreateFromDepthImage and PointCloud::CreateFromRGBDImage,
+/// for a stream of frames.
+///
+/// The ray directions (u - cx) / fx and (v - cy) / fy of the sampled pixels
+/// are computed once for the intrinsics. The valid pixels of each row are
+/// counted in parallel and the points are written in parallel at their
+/// final index, into a PointCloud whose buffers are reserved for the whole
+/// image and reused from one frame to the next.
+class DepthToPointCloudConverter {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param intrinsic Intrinsic parameters of the camera.
+    /// \param stride Sampling factor to support coarse point cloud
+    /// extraction.
+    DepthToPointCloudConverter(const camera::PinholeCameraIntrinsic &intrinsic,
+                               int stride = 1);
+
+public:
+    /// \brief Converts a depth image, either a float image or a uint16_t
+    /// image, to the points of \p pointcloud.
+    ///
+    /// \param depth The depth image, of the size of the intrinsics.
+    /// \param pointcloud Output PointCloud. Its points are overwritten and
+    /// its other attributes cleared.
+    /// \param extrinsic Extrinsic parameters of the camera.
+    /// \param depth_scale The depth is scaled by 1 / \p depth_scale.
+    /// \param depth_trunc Truncated at \p depth_trunc distance.
+    /// \param project_valid_depth_only If false, there is a point for each
+    /// sampled pixel, and invalid depth results in NaN points.
+    void ConvertDepthImage(
+            const Image &depth,
+            PointCloud &pointcloud,
+            const Eigen::Matrix4d &extrinsic = Eigen::Matrix4d::Identity(),
+            double depth_scale = 1000.0,
+            double depth_trunc = 1000.0,
+            bool project_valid_depth_only = true);
+
+    /// \brief Converts an RGB-D image with a float depth image to the
+    /// points and colors of \p pointcloud.
+    ///
+    /// \param image The RGB-D image, of the size of the intrinsics.
+    /// \param pointcloud Output PointCloud. Its points and colors are
+    /// overwritten and its normals cleared.
+    /// \param extrinsic Extrinsic parameters of the camera.
+    /// \param project_valid_depth_only If false, there is a point for each
+    /// sampled pixel, and invalid depth results in NaN points.
+    void ConvertRGBDImage(
+            const RGBDImage &image,
+            PointCloud &pointcloud,
+            const Eigen::Matrix4d &extrinsic = Eigen::Matrix4d::Identity(),
+            bool project_valid_depth_only = true);
+
+    /// \brief Converts a depth image to a new PointCloud.
+    std::shared_ptr<PointCloud> CreateFromDepthImage(
+            const Image &depth,
+            const Eigen::Matrix4d &extrinsic = Eigen::Matrix4d::Identity(),
+            double depth_scale = 1000.0,
+            double depth_trunc = 1000.0,
+            bool project_valid_depth_only = true);
+
+    /// \brief Converts an RGB-D image to a new PointCloud.
+    std::shared_ptr<PointCloud> CreateFromRGBDImage(
+            const RGBDImage &image,
+            const Eigen::Matrix4d &extrinsic = Eigen::Matrix4d::Identity(),
+            bool project_valid_depth_only = true);
+
+protected:
+    /// Checks that an image has the size of the intrinsics.
+    void CheckImageSize(const Image &image, const char *function) const;
+
+protected:
+    int width_;
+    int height_;
+    int stride_;
+    /// (u - cx) / fx of the sampled columns u and (v - cy) / fy of the
+    /// sampled rows v.
+    std::vector<double> ray_x_;
+    std::vector<double> ray_y_;
+    /// Index of the first point of each sampled row in the last conversion.
+    std::vector<int> row_offsets_;
+};
+
+}  // namespace geometry
+}  // namespace open3d
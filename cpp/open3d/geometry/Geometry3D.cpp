@@ -30,6 +30,7 @@
 #include <numeric>
 
 #include "open3d/utility/Console.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
@@ -40,27 +41,43 @@ Geometry3D& Geometry3D::Rotate(const Eigen::Matrix3d& R) {
 
 Eigen::Vector3d Geometry3D::ComputeMinBound(
         const std::vector<Eigen::Vector3d>& points) const {
-    if (points.empty()) {
-        return Eigen::Vector3d(0.0, 0.0, 0.0);
-    }
-    return std::accumulate(
-            points.begin(), points.end(), points[0],
-            [](const Eigen::Vector3d& a, const Eigen::Vector3d& b) {
-                return a.array().min(b.array()).matrix();
-            });
+    return ComputeMinMaxBound(points).first;
 }
 
 Eigen::Vector3d Geometry3D::ComputeMaxBound(
         const std::vector<Eigen::Vector3d>& points) const {
+    return ComputeMinMaxBound(points).second;
+}
+
+std::pair<Eigen::Vector3d, Eigen::Vector3d> Geometry3D::ComputeMinMaxBound(
+        const std::vector<Eigen::Vector3d>& points) {
     if (points.empty()) {
-        return Eigen::Vector3d(0.0, 0.0, 0.0);
+        return std::make_pair(Eigen::Vector3d::Zero(), Eigen::Vector3d::Zero());
     }
-    return std::accumulate(
-            points.begin(), points.end(), points[0],
-            [](const Eigen::Vector3d& a, const Eigen::Vector3d& b) {
-                return a.array().max(b.array()).matrix();
-            });
+    // Below this size, starting the threads costs more than the reduction.
+    const int kMinPointsPerThread = 16384;
+    const int num_points = static_cast<int>(points.size());
+    Eigen::Array3d min_bound = points[0].array();
+    Eigen::Array3d max_bound = points[0].array();
+#pragma omp parallel if (num_points > kMinPointsPerThread) num_threads(utility::EstimateMaxThreads())
+    {
+        Eigen::Array3d local_min = points[0].array();
+        Eigen::Array3d local_max = points[0].array();
+#pragma omp for nowait
+        for (int i = 0; i < num_points; i++) {
+            local_min = local_min.min(points[i].array());
+            local_max = local_max.max(points[i].array());
+        }
+#pragma omp critical
+        {
+            min_bound = min_bound.min(local_min);
+            max_bound = max_bound.max(local_max);
+        }
+    }
+    return std::make_pair(Eigen::Vector3d(min_bound.matrix()),
+                          Eigen::Vector3d(max_bound.matrix()));
 }
+
 Eigen::Vector3d Geometry3D::ComputeCenter(
         const std::vector<Eigen::Vector3d>& points) const {
     Eigen::Vector3d center(0, 0, 0);
@@ -95,7 +112,9 @@ void Geometry3D::ResizeAndPaintUniformColor(
 
 void Geometry3D::TransformPoints(const Eigen::Matrix4d& transformation,
                                  std::vector<Eigen::Vector3d>& points) const {
-    for (auto& point : points) {
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < int64_t(points.size()); i++) {
+        Eigen::Vector3d& point = points[i];
         Eigen::Vector4d new_point =
                 transformation *
                 Eigen::Vector4d(point(0), point(1), point(2), 1.0);
@@ -105,7 +124,9 @@ void Geometry3D::TransformPoints(const Eigen::Matrix4d& transformation,
 
 void Geometry3D::TransformNormals(const Eigen::Matrix4d& transformation,
                                   std::vector<Eigen::Vector3d>& normals) const {
-    for (auto& normal : normals) {
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < int64_t(normals.size()); i++) {
+        Eigen::Vector3d& normal = normals[i];
         Eigen::Vector4d new_normal =
                 transformation *
                 Eigen::Vector4d(normal(0), normal(1), normal(2), 0.0);
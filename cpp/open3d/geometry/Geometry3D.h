@@ -28,6 +28,8 @@
 
 #include <Eigen/Core>
 #include <Eigen/Geometry>
+#include <utility>
+#include <vector>
 
 #include "open3d/geometry/Geometry.h"
 #include "open3d/utility/Eigen.h"
@@ -129,6 +131,12 @@ protected:
     /// Compute max bound of a list points.
     Eigen::Vector3d ComputeMaxBound(
             const std::vector<Eigen::Vector3d>& points) const;
+    /// \brief Compute the min and max bound of a list of points in a single
+    /// parallel pass.
+    ///
+    /// Returns zeros for an empty list.
+    static std::pair<Eigen::Vector3d, Eigen::Vector3d> ComputeMinMaxBound(
+            const std::vector<Eigen::Vector3d>& points);
     /// Computer center of a list of points.
     Eigen::Vector3d ComputeCenter(
             const std::vector<Eigen::Vector3d>& points) const;
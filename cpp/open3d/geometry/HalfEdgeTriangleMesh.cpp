@@ -26,15 +26,134 @@
 
 #include "open3d/geometry/HalfEdgeTriangleMesh.h"
 
+#include <algorithm>
+#include <limits>
 #include <numeric>
 
+#include "open3d/core/EigenConverter.h"
+#include "open3d/core/Tensor.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/Helper.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
 
+HalfEdgeArrays HalfEdgeArrays::Create(
+        const std::vector<Eigen::Vector3i> &triangles) {
+    const int64_t num_half_edges = int64_t(triangles.size()) * 3;
+    if (num_half_edges > std::numeric_limits<int>::max()) {
+        utility::LogError("Too many triangles for HalfEdgeArrays: {}.",
+                          triangles.size());
+    }
+    auto Source = [&](int64_t he) { return triangles[he / 3](he % 3); };
+    auto Target = [&](int64_t he) {
+        return triangles[he / 3]((he % 3 + 1) % 3);
+    };
+
+    int num_vertices = 0;
+#pragma omp parallel for schedule(static) reduction(max : num_vertices) num_threads(utility::EstimateMaxThreads())
+    for (int64_t tidx = 0; tidx < int64_t(triangles.size()); ++tidx) {
+        num_vertices = std::max(num_vertices, triangles[tidx].maxCoeff() + 1);
+    }
+
+    // Bucket the half-edges by the smaller vertex of their edge, then sort
+    // each bucket by the larger vertex. Equal keys are then adjacent.
+    std::vector<int64_t> bucket_offsets(num_vertices + 1, 0);
+    for (int64_t he = 0; he < num_half_edges; ++he) {
+        bucket_offsets[std::min(Source(he), Target(he)) + 1]++;
+    }
+    std::partial_sum(bucket_offsets.begin(), bucket_offsets.end(),
+                     bucket_offsets.begin());
+    HalfEdgeArrays arrays;
+    arrays.edge_half_edges_.resize(num_half_edges);
+    {
+        std::vector<int64_t> cursors(bucket_offsets.begin(),
+                                     bucket_offsets.end() - 1);
+        for (int64_t he = 0; he < num_half_edges; ++he) {
+            arrays.edge_half_edges_[cursors[std::min(Source(he),
+                                                     Target(he))]++] = int(he);
+        }
+    }
+
+    std::vector<int64_t> edge_counts(num_vertices + 1, 0);
+    int *sorted = arrays.edge_half_edges_.data();
+#pragma omp parallel for schedule(dynamic, 256) num_threads(utility::EstimateMaxThreads())
+    for (int v = 0; v < num_vertices; ++v) {
+        auto MaxVertex = [&](int he) {
+            return std::max(Source(he), Target(he));
+        };
+        // Half-edges are already in increasing order within the bucket, so
+        // a stable sort keeps them ordered within each edge.
+        std::stable_sort(sorted + bucket_offsets[v],
+                         sorted + bucket_offsets[v + 1],
+                         [&](int he0, int he1) {
+                             return MaxVertex(he0) < MaxVertex(he1);
+                         });
+        int64_t count = 0;
+        for (int64_t idx = bucket_offsets[v]; idx < bucket_offsets[v + 1];
+             ++idx) {
+            if (idx == bucket_offsets[v] ||
+                MaxVertex(sorted[idx]) != MaxVertex(sorted[idx - 1])) {
+                count++;
+            }
+        }
+        edge_counts[v + 1] = count;
+    }
+    std::partial_sum(edge_counts.begin(), edge_counts.end(),
+                     edge_counts.begin());
+    const int64_t num_edges = edge_counts[num_vertices];
+
+    arrays.twins_.resize(num_half_edges);
+    arrays.edge_indices_.resize(num_half_edges);
+    arrays.edges_.resize(num_edges);
+    arrays.edge_offsets_.resize(num_edges + 1);
+    arrays.edge_offsets_[num_edges] = num_half_edges;
+#pragma omp parallel for schedule(dynamic, 256) num_threads(utility::EstimateMaxThreads())
+    for (int v = 0; v < num_vertices; ++v) {
+        int64_t edge = edge_counts[v] - 1;
+        for (int64_t idx = bucket_offsets[v]; idx < bucket_offsets[v + 1];
+             ++idx) {
+            const int he = sorted[idx];
+            const int max_vertex = std::max(Source(he), Target(he));
+            if (idx == bucket_offsets[v] ||
+                max_vertex != arrays.edges_[edge](1)) {
+                edge++;
+                arrays.edges_[edge] = Eigen::Vector2i(v, max_vertex);
+                arrays.edge_offsets_[edge] = idx;
+            }
+            arrays.edge_indices_[he] = int(edge);
+        }
+    }
+
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int64_t edge = 0; edge < num_edges; ++edge) {
+        const int64_t begin = arrays.edge_offsets_[edge];
+        const int64_t end = arrays.edge_offsets_[edge + 1];
+        for (int64_t idx = begin; idx < end; ++idx) {
+            arrays.twins_[sorted[idx]] = -1;
+        }
+        if (end - begin == 2 &&
+            Source(sorted[begin]) != Source(sorted[end - 1])) {
+            arrays.twins_[sorted[begin]] = sorted[end - 1];
+            arrays.twins_[sorted[end - 1]] = sorted[begin];
+        }
+    }
+    return arrays;
+}
+
+HalfEdgeArrays HalfEdgeArrays::Create(const core::Tensor &triangles) {
+    triangles.AssertShapeCompatible({utility::nullopt, 3});
+    if (triangles.GetDtype() != core::Dtype::Int32 &&
+        triangles.GetDtype() != core::Dtype::Int64) {
+        utility::LogError("Triangles must be Int32 or Int64, but got {}.",
+                          triangles.GetDtype().ToString());
+    }
+    return Create(
+            core::eigen_converter::TensorToEigenVector3iVector(triangles));
+}
+
 HalfEdgeTriangleMesh::HalfEdge::HalfEdge(const Eigen::Vector2i &vertex_indices,
                                          int triangle_index,
                                          int next,
@@ -171,113 +290,108 @@ HalfEdgeTriangleMesh::CreateFromTriangleMesh(const TriangleMesh &mesh) {
     mesh_cpy->RemoveUnreferencedVertices();
     mesh_cpy->RemoveDegenerateTriangles();
 
-    // Collect half edges
-    // Check: for valid manifolds, there mustn't be duplicated half-edges
-    std::unordered_map<Eigen::Vector2i, size_t,
-                       utility::hash_eigen<Eigen::Vector2i>>
-            vertex_indices_to_half_edge_index;
-
-    for (size_t triangle_index = 0;
-         triangle_index < mesh_cpy->triangles_.size(); triangle_index++) {
-        const Eigen::Vector3i &triangle = mesh_cpy->triangles_[triangle_index];
-        size_t num_half_edges = het_mesh->half_edges_.size();
-
-        size_t he_0_index = num_half_edges;
-        size_t he_1_index = num_half_edges + 1;
-        size_t he_2_index = num_half_edges + 2;
-        HalfEdge he_0(Eigen::Vector2i(triangle(0), triangle(1)),
-                      int(triangle_index), int(he_1_index), -1);
-        HalfEdge he_1(Eigen::Vector2i(triangle(1), triangle(2)),
-                      int(triangle_index), int(he_2_index), -1);
-        HalfEdge he_2(Eigen::Vector2i(triangle(2), triangle(0)),
-                      int(triangle_index), int(he_0_index), -1);
-
-        if (vertex_indices_to_half_edge_index.find(he_0.vertex_indices_) !=
-                    vertex_indices_to_half_edge_index.end() ||
-            vertex_indices_to_half_edge_index.find(he_1.vertex_indices_) !=
-                    vertex_indices_to_half_edge_index.end() ||
-            vertex_indices_to_half_edge_index.find(he_2.vertex_indices_) !=
-                    vertex_indices_to_half_edge_index.end()) {
-            utility::LogError(
-                    "ComputeHalfEdges failed. Duplicated half-edges.");
+    // Collect half edges. Half-edge 3 * t + i goes from vertex i to vertex
+    // (i + 1) % 3 of triangle t.
+    // Check: for valid manifolds, there mustn't be duplicated half-edges, so
+    // each edge has one half-edge or two twin half-edges.
+    const HalfEdgeArrays arrays = HalfEdgeArrays::Create(mesh_cpy->triangles_);
+    bool duplicated = false;
+#pragma omp parallel for schedule(static) reduction(|| : duplicated) num_threads(utility::EstimateMaxThreads())
+    for (int64_t edge = 0; edge < arrays.NumEdges(); ++edge) {
+        int64_t num_half_edges = arrays.NumHalfEdgesOfEdge(edge);
+        if (num_half_edges > 2 ||
+            (num_half_edges == 2 &&
+             arrays.twins_[arrays.edge_half_edges_
+                                   [arrays.edge_offsets_[edge]]] == -1)) {
+            duplicated = true;
         }
-
-        het_mesh->half_edges_.push_back(he_0);
-        het_mesh->half_edges_.push_back(he_1);
-        het_mesh->half_edges_.push_back(he_2);
-        vertex_indices_to_half_edge_index[he_0.vertex_indices_] = he_0_index;
-        vertex_indices_to_half_edge_index[he_1.vertex_indices_] = he_1_index;
-        vertex_indices_to_half_edge_index[he_2.vertex_indices_] = he_2_index;
+    }
+    if (duplicated) {
+        utility::LogError("ComputeHalfEdges failed. Duplicated half-edges.");
     }
 
-    // Fill twin half-edge. In the previous step, it is already guaranteed that
-    // each half-edge can have at most one twin half-edge.
-    for (size_t this_he_index = 0; this_he_index < het_mesh->half_edges_.size();
-         this_he_index++) {
-        HalfEdge &this_he = het_mesh->half_edges_[this_he_index];
-        Eigen::Vector2i twin_end_points(this_he.vertex_indices_(1),
-                                        this_he.vertex_indices_(0));
-        if (this_he.twin_ == -1 &&
-            vertex_indices_to_half_edge_index.find(twin_end_points) !=
-                    vertex_indices_to_half_edge_index.end()) {
-            size_t twin_he_index =
-                    vertex_indices_to_half_edge_index[twin_end_points];
-            HalfEdge &twin_he = het_mesh->half_edges_[twin_he_index];
-            this_he.twin_ = int(twin_he_index);
-            twin_he.twin_ = int(this_he_index);
+    const int64_t num_triangles = int64_t(mesh_cpy->triangles_.size());
+    het_mesh->half_edges_.resize(num_triangles * 3);
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int64_t triangle_index = 0; triangle_index < num_triangles;
+         triangle_index++) {
+        const Eigen::Vector3i &triangle = mesh_cpy->triangles_[triangle_index];
+        for (int i = 0; i < 3; ++i) {
+            int64_t he_index = triangle_index * 3 + i;
+            het_mesh->half_edges_[he_index] = HalfEdge(
+                    Eigen::Vector2i(triangle(i), triangle((i + 1) % 3)),
+                    int(triangle_index), int(triangle_index * 3 + (i + 1) % 3),
+                    arrays.twins_[he_index]);
         }
     }
 
-    // Get out-going half-edges from each vertex. This can be done during
-    // half-edge construction. Done here for readability.
-    std::vector<std::vector<int>> half_edges_from_vertex(
-            mesh_cpy->vertices_.size());
-    for (size_t half_edge_index = 0;
-         half_edge_index < het_mesh->half_edges_.size(); half_edge_index++) {
-        int src_vertex_index =
-                het_mesh->half_edges_[half_edge_index].vertex_indices_(0);
-        half_edges_from_vertex[src_vertex_index].push_back(
-                int(half_edge_index));
+    // Get out-going half-edges from each vertex, in increasing order.
+    const int num_vertices = int(mesh_cpy->vertices_.size());
+    std::vector<int64_t> vertex_offsets(num_vertices + 1, 0);
+    for (const HalfEdge &he : het_mesh->half_edges_) {
+        vertex_offsets[he.vertex_indices_(0) + 1]++;
+    }
+    std::partial_sum(vertex_offsets.begin(), vertex_offsets.end(),
+                     vertex_offsets.begin());
+    std::vector<int> half_edges_from_vertex(het_mesh->half_edges_.size());
+    {
+        std::vector<int64_t> cursors(vertex_offsets.begin(),
+                                     vertex_offsets.end() - 1);
+        for (size_t half_edge_index = 0;
+             half_edge_index < het_mesh->half_edges_.size();
+             half_edge_index++) {
+            int src_vertex_index =
+                    het_mesh->half_edges_[half_edge_index].vertex_indices_(0);
+            half_edges_from_vertex[cursors[src_vertex_index]++] =
+                    int(half_edge_index);
+        }
     }
 
     // Find ordered half-edges from each vertex by traversal. To be a valid
     // manifold, there can be at most 1 boundary half-edge from each vertex.
-    het_mesh->ordered_half_edge_from_vertex_.resize(mesh_cpy->vertices_.size());
-    for (size_t vertex_index = 0; vertex_index < mesh_cpy->vertices_.size();
-         vertex_index++) {
+    het_mesh->ordered_half_edge_from_vertex_.resize(num_vertices);
+    bool invalid_vertex = false;
+#pragma omp parallel for schedule(static) reduction(|| : invalid_vertex) num_threads(utility::EstimateMaxThreads())
+    for (int vertex_index = 0; vertex_index < num_vertices; vertex_index++) {
         size_t num_boundaries = 0;
         int init_half_edge_index = 0;
-        for (const int &half_edge_index :
-             half_edges_from_vertex[vertex_index]) {
+        for (int64_t idx = vertex_offsets[vertex_index];
+             idx < vertex_offsets[vertex_index + 1]; ++idx) {
+            int half_edge_index = half_edges_from_vertex[idx];
             if (het_mesh->half_edges_[half_edge_index].IsBoundary()) {
                 num_boundaries++;
                 init_half_edge_index = half_edge_index;
             }
         }
         if (num_boundaries > 1) {
-            utility::LogError("ComputeHalfEdges failed. Invalid vertex.");
+            invalid_vertex = true;
+            continue;
         }
         // If there is a boundary edge, start from that; otherwise start
         // with any half-edge (default 0) started from this vertex.
         if (num_boundaries == 0) {
-            init_half_edge_index = half_edges_from_vertex[vertex_index][0];
+            init_half_edge_index =
+                    half_edges_from_vertex[vertex_offsets[vertex_index]];
         }
 
         // Push edges to ordered_half_edge_from_vertex_.
+        std::vector<int> &ordered_half_edges =
+                het_mesh->ordered_half_edge_from_vertex_[vertex_index];
         int curr_he_index = init_half_edge_index;
-        het_mesh->ordered_half_edge_from_vertex_[vertex_index].push_back(
-                curr_he_index);
+        ordered_half_edges.push_back(curr_he_index);
         int next_next_twin_he_index =
                 het_mesh->NextHalfEdgeFromVertex(curr_he_index);
         curr_he_index = next_next_twin_he_index;
         while (curr_he_index != -1 && curr_he_index != init_half_edge_index) {
-            het_mesh->ordered_half_edge_from_vertex_[vertex_index].push_back(
-                    curr_he_index);
+            ordered_half_edges.push_back(curr_he_index);
             next_next_twin_he_index =
                     het_mesh->NextHalfEdgeFromVertex(curr_he_index);
             curr_he_index = next_next_twin_he_index;
         }
     }
+    if (invalid_vertex) {
+        utility::LogError("ComputeHalfEdges failed. Invalid vertex.");
+    }
 
     mesh_cpy->ComputeVertexNormals();
     het_mesh->vertices_ = mesh_cpy->vertices_;
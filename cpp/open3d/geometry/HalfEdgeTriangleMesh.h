@@ -28,13 +28,62 @@
 
 #include <Eigen/Core>
 #include <unordered_map>
+#include <vector>
 
 #include "open3d/geometry/Geometry3D.h"
 #include "open3d/geometry/MeshBase.h"
 
 namespace open3d {
+
+namespace core {
+class Tensor;
+}
+
 namespace geometry {
 
+/// \class HalfEdgeArrays
+///
+/// \brief Compact structure-of-arrays half-edge connectivity of a triangle
+/// list.
+///
+/// Half-edge 3 * t + i goes from vertex triangles[t](i) to vertex
+/// triangles[t]((i + 1) % 3), so the next half-edge and the triangle of a
+/// half-edge are implicit and only the twins are stored. The undirected edges
+/// are found by sorting the half-edges by their (min, max) vertex keys, in
+/// parallel, and each edge lists the half-edges lying on it.
+class HalfEdgeArrays {
+public:
+    /// Computes the half-edge arrays of \p triangles.
+    static HalfEdgeArrays Create(const std::vector<Eigen::Vector3i> &triangles);
+
+    /// Computes the half-edge arrays of an Int32 or Int64 tensor of shape
+    /// {n, 3}, on any device.
+    static HalfEdgeArrays Create(const core::Tensor &triangles);
+
+    /// Returns the number of undirected edges.
+    int64_t NumEdges() const { return int64_t(edges_.size()); }
+
+    /// Returns the number of half-edges lying on the undirected edge \p edge,
+    /// i.e. the number of triangles sharing it.
+    int64_t NumHalfEdgesOfEdge(int64_t edge) const {
+        return edge_offsets_[edge + 1] - edge_offsets_[edge];
+    }
+
+public:
+    /// Twin of each half-edge, or -1 if the half-edge is on the boundary or
+    /// its edge is not shared by exactly two opposite half-edges.
+    std::vector<int> twins_;
+    /// Index of the undirected edge of each half-edge.
+    std::vector<int> edge_indices_;
+    /// Undirected edges (vertex0, vertex1) with vertex0 <= vertex1, sorted.
+    std::vector<Eigen::Vector2i> edges_;
+    /// The half-edges of edge e are edge_half_edges_[edge_offsets_[e]] to
+    /// edge_half_edges_[edge_offsets_[e + 1] - 1], in increasing order.
+    std::vector<int64_t> edge_offsets_;
+    /// Half-edges grouped by undirected edge.
+    std::vector<int> edge_half_edges_;
+};
+
 /// \class HalfEdgeTriangleMesh
 ///
 /// \brief HalfEdgeTriangleMesh inherits TriangleMesh class with the addition of
@@ -103,7 +152,8 @@ public:
     HalfEdgeTriangleMesh operator+(const HalfEdgeTriangleMesh &mesh) const;
 
     /// Convert HalfEdgeTriangleMesh from TriangleMesh. Throws exception if the
-    /// input mesh is not manifold.
+    /// input mesh is not manifold. The half-edges are computed in parallel
+    /// with HalfEdgeArrays, and half-edge 3 * t + i belongs to triangle t.
     static std::shared_ptr<HalfEdgeTriangleMesh> CreateFromTriangleMesh(
             const TriangleMesh &mesh);
 
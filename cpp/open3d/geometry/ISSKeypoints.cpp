@@ -29,42 +29,32 @@
 // ----------------------------------------------------------------------------
 
 #include <Eigen/Core>
-#include <Eigen/Eigenvalues>
+#include <algorithm>
 #include <cmath>
 #include <memory>
 #include <tuple>
 #include <vector>
 
+#include "open3d/core/linalg/SymmetricEigen3x3Shared.h"
 #include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/Keypoint.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/Eigen.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 
 namespace {
 
-bool IsLocalMaxima(int query_idx,
-                   const std::vector<int>& indices,
-                   const std::vector<double>& third_eigen_values) {
-    for (const auto& idx : indices) {
-        if (third_eigen_values[query_idx] < third_eigen_values[idx]) {
-            return false;
-        }
-    }
-    return true;
-}
-
 double ComputeModelResolution(const std::vector<Eigen::Vector3d>& points,
                               const geometry::KDTreeFlann& kdtree) {
-    std::vector<int> indices(2);
-    std::vector<double> distances(2);
+    geometry::KDTreeSearchResult neighbors;
+    kdtree.SearchBatch(points, geometry::KDTreeSearchParamKNN(2), neighbors);
     double resolution = 0.0;
-
-    for (const auto& point : points) {
-        if (kdtree.SearchKNN(point, 2, indices, distances) != 0) {
-            resolution += std::sqrt(distances[1]);
+    for (size_t i = 0; i < points.size(); i++) {
+        if (neighbors.NumNeighbors(i) > 1) {
+            resolution += std::sqrt(neighbors.Distance2(i)[1]);
         }
     }
     resolution /= points.size();
@@ -99,46 +89,78 @@ std::shared_ptr<PointCloud> ComputeISSKeypoints(
                 salient_radius, non_max_radius);
     }
 
+    // A single radius search with the larger radius serves both the saliency
+    // and the non-maximum suppression, which select their neighbors by
+    // distance.
+    KDTreeSearchResult neighbors;
+    kdtree.SearchBatch(points,
+                       KDTreeSearchParamRadius(
+                               std::max(salient_radius, non_max_radius)),
+                       neighbors);
+    const double salient_radius2 = salient_radius * salient_radius;
+    const double non_max_radius2 = non_max_radius * non_max_radius;
+
     std::vector<double> third_eigen_values(points.size());
-#pragma omp parallel for schedule(static) shared(third_eigen_values)
-    for (int i = 0; i < (int)points.size(); i++) {
-        std::vector<int> indices;
-        std::vector<double> dist;
-        int nb_neighbors =
-                kdtree.SearchRadius(points[i], salient_radius, indices, dist);
-        if (nb_neighbors < min_neighbors) {
-            continue;
-        }
+#pragma omp parallel num_threads(utility::EstimateMaxThreads())
+    {
+        std::vector<int> salient_indices;
+#pragma omp for schedule(static)
+        for (int i = 0; i < (int)points.size(); i++) {
+            const int* indices = neighbors.Indices(i);
+            const double* distance2 = neighbors.Distance2(i);
+            salient_indices.clear();
+            for (int j = 0; j < neighbors.NumNeighbors(i); j++) {
+                if (distance2[j] <= salient_radius2) {
+                    salient_indices.push_back(indices[j]);
+                }
+            }
+            if ((int)salient_indices.size() < min_neighbors) {
+                continue;
+            }
 
-        Eigen::Matrix3d cov = utility::ComputeCovariance(points, indices);
-        if (cov.isZero()) {
-            continue;
-        }
+            Eigen::Matrix3d cov = utility::ComputeCovariance(
+                    points, salient_indices.data(), salient_indices.size());
+            if (cov.isZero()) {
+                continue;
+            }
 
-        Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> solver(cov);
-        const double& e1c = solver.eigenvalues()[2];
-        const double& e2c = solver.eigenvalues()[1];
-        const double& e3c = solver.eigenvalues()[0];
+            // Eigenvalues in ascending order.
+            double eigenvalues[3];
+            double eigenvectors[9];
+            core::SymmetricEigen3x3(cov.data(), eigenvalues, eigenvectors);
+            const double& e1c = eigenvalues[2];
+            const double& e2c = eigenvalues[1];
+            const double& e3c = eigenvalues[0];
 
-        if ((e2c / e1c) < gamma_21 && e3c / e2c < gamma_32) {
-            third_eigen_values[i] = e3c;
+            if ((e2c / e1c) < gamma_21 && e3c / e2c < gamma_32) {
+                third_eigen_values[i] = e3c;
+            }
         }
     }
 
-    std::vector<size_t> kp_indices;
-    kp_indices.reserve(points.size());
-#pragma omp parallel for schedule(static) shared(kp_indices)
+    std::vector<uint8_t> is_keypoint(points.size(), 0);
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
     for (int i = 0; i < (int)points.size(); i++) {
         if (third_eigen_values[i] > 0.0) {
-            std::vector<int> nn_indices;
-            std::vector<double> dist;
-            int nb_neighbors = kdtree.SearchRadius(points[i], non_max_radius,
-                                                   nn_indices, dist);
-
-            if (nb_neighbors >= min_neighbors &&
-                IsLocalMaxima(i, nn_indices, third_eigen_values)) {
-                kp_indices.emplace_back(i);
+            const int* indices = neighbors.Indices(i);
+            const double* distance2 = neighbors.Distance2(i);
+            int nb_neighbors = 0;
+            bool is_local_maxima = true;
+            for (int j = 0; j < neighbors.NumNeighbors(i); j++) {
+                if (distance2[j] <= non_max_radius2) {
+                    nb_neighbors++;
+                    is_local_maxima &= third_eigen_values[i] >=
+                                       third_eigen_values[indices[j]];
+                }
             }
+            is_keypoint[i] = nb_neighbors >= min_neighbors && is_local_maxima;
+        }
+    }
+
+    std::vector<size_t> kp_indices;
+    for (size_t i = 0; i < points.size(); i++) {
+        if (is_keypoint[i]) {
+            kp_indices.push_back(i);
         }
     }
 
@@ -26,6 +26,10 @@
 
 #include "open3d/geometry/Image.h"
 
+#include <algorithm>
+
+#include "open3d/utility/Parallel.h"
+
 namespace {
 /// Isotropic 2D kernels are separable:
 /// two 1D kernels are applied in x and y direction.
@@ -35,6 +39,134 @@ const std::vector<double> Gaussian7 = {0.03125, 0.109375, 0.21875, 0.28125,
                                        0.21875, 0.109375, 0.03125};
 const std::vector<double> Sobel31 = {-1.0, 0.0, 1.0};
 const std::vector<double> Sobel32 = {1.0, 2.0, 1.0};
+
+/// Separable filters are evaluated on output tiles. A tile row plus its halo
+/// stays in L1, and each horizontally filtered row of a tile is reused by all
+/// vertical taps while it is still in cache, so no full-size intermediate
+/// image is written. Both dimensions are even so that tiles stay aligned with
+/// the 2x2 blocks of Image::FilterAndDownsample.
+constexpr int kFilterTileWidth = 256;
+constexpr int kFilterTileHeight = 32;
+
+/// Per-thread scratch buffers of the tiled filters.
+struct FilterScratch {
+    std::vector<float> padded_row;
+    std::vector<float> strip;
+    std::vector<float> tile;
+    std::vector<double> acc;
+    std::vector<const float *> taps;
+};
+
+/// Computes out[x] = sum_i taps[i][x] * weights[i] for x in [0, width).
+///
+/// The products are formed in float and summed in double in tap order, which
+/// is exactly what the per-pixel loops did before. Looping over taps outside
+/// and over x inside keeps the inner loop contiguous so that the compiler
+/// vectorizes it for the target (SSE/AVX on x86, NEON on ARM).
+void ConvolveRows(const float *const *taps,
+                  const std::vector<float> &weights,
+                  int width,
+                  double *acc,
+                  float *out) {
+    for (int x = 0; x < width; x++) {
+        acc[x] = 0.0;
+    }
+    for (size_t i = 0; i < weights.size(); i++) {
+        const float *src = taps[i];
+        const float w = weights[i];
+        for (int x = 0; x < width; x++) {
+            acc[x] += (double)(src[x] * w);
+        }
+    }
+    for (int x = 0; x < width; x++) {
+        out[x] = (float)acc[x];
+    }
+}
+
+/// Copies row \p y of \p image over [x0 - half_kernel_size, x1 +
+/// half_kernel_size) into \p padded_row, clamping coordinates to the image.
+void LoadPaddedRow(const open3d::geometry::Image &image,
+                   int y,
+                   int x0,
+                   int x1,
+                   int half_kernel_size,
+                   std::vector<float> &padded_row) {
+    const float *row = image.PointerAt<float>(0, y);
+    const int padded_width = x1 - x0 + 2 * half_kernel_size;
+    padded_row.resize(padded_width);
+    for (int i = 0; i < padded_width; i++) {
+        int x = std::min(std::max(x0 - half_kernel_size + i, 0),
+                         image.width_ - 1);
+        padded_row[i] = row[x];
+    }
+}
+
+/// Filters the tile [x0, x1) x [y0, y1) of \p image with the separable kernel
+/// (\p kx, \p ky) and writes it to \p out with a row stride of
+/// \p out_stride floats. Borders are clamped as in Image::FilterHorizontal.
+void FilterTile(const open3d::geometry::Image &image,
+                const std::vector<float> &kx,
+                const std::vector<float> &ky,
+                int x0,
+                int x1,
+                int y0,
+                int y1,
+                FilterScratch &scratch,
+                float *out,
+                int out_stride) {
+    const int half_kx = (int)kx.size() / 2;
+    const int half_ky = (int)ky.size() / 2;
+    const int tile_width = x1 - x0;
+    const int strip_height = y1 - y0 + 2 * half_ky;
+    scratch.strip.resize((size_t)strip_height * tile_width);
+    scratch.acc.resize(tile_width);
+    scratch.taps.resize(std::max(kx.size(), ky.size()));
+
+    // Horizontal pass over the rows of the tile and its vertical halo.
+    for (int r = 0; r < strip_height; r++) {
+        int y = std::min(std::max(y0 - half_ky + r, 0), image.height_ - 1);
+        LoadPaddedRow(image, y, x0, x1, half_kx, scratch.padded_row);
+        for (size_t i = 0; i < kx.size(); i++) {
+            scratch.taps[i] = scratch.padded_row.data() + i;
+        }
+        ConvolveRows(scratch.taps.data(), kx, tile_width, scratch.acc.data(),
+                     scratch.strip.data() + (size_t)r * tile_width);
+    }
+
+    // Vertical pass, reading whole cached rows of the strip.
+    for (int r = 0; r < y1 - y0; r++) {
+        for (size_t j = 0; j < ky.size(); j++) {
+            scratch.taps[j] = scratch.strip.data() + (r + j) * tile_width;
+        }
+        ConvolveRows(scratch.taps.data(), ky, tile_width, scratch.acc.data(),
+                     out + (size_t)r * out_stride);
+    }
+}
+
+std::vector<float> ToFloatKernel(const std::vector<double> &kernel) {
+    return std::vector<float>(kernel.begin(), kernel.end());
+}
+
+/// Returns the (dx, dy) kernels of a pre-defined filter type.
+std::pair<const std::vector<double> *, const std::vector<double> *>
+GetSeparableKernels(open3d::geometry::Image::FilterType type) {
+    using FilterType = open3d::geometry::Image::FilterType;
+    switch (type) {
+        case FilterType::Gaussian3:
+            return {&Gaussian3, &Gaussian3};
+        case FilterType::Gaussian5:
+            return {&Gaussian5, &Gaussian5};
+        case FilterType::Gaussian7:
+            return {&Gaussian7, &Gaussian7};
+        case FilterType::Sobel3Dx:
+            return {&Sobel31, &Sobel32};
+        case FilterType::Sobel3Dy:
+            return {&Sobel32, &Sobel31};
+        default:
+            open3d::utility::LogError("[Filter] Unsupported filter type.");
+    }
+    return {nullptr, nullptr};
+}
 }  // unnamed namespace
 
 namespace open3d {
@@ -155,9 +287,9 @@ std::shared_ptr<Image> Image::Downsample() const {
     output->Prepare(half_width, half_height, 1, 4);
 
 #ifdef _WIN32
-#pragma omp parallel for schedule(static)
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
 #else
-#pragma omp parallel for collapse(2) schedule(static)
+#pragma omp parallel for collapse(2) schedule(static) num_threads(utility::EstimateMaxThreads())
 #endif
     for (int y = 0; y < output->height_; y++) {
         for (int x = 0; x < output->width_; x++) {
@@ -184,56 +316,33 @@ std::shared_ptr<Image> Image::FilterHorizontal(
     output->Prepare(width_, height_, 1, 4);
 
     const int half_kernel_size = (int)(floor((double)kernel.size() / 2.0));
-
-#ifdef _WIN32
-#pragma omp parallel for schedule(static)
-#else
-#pragma omp parallel for collapse(2) schedule(static)
-#endif
-    for (int y = 0; y < height_; y++) {
-        for (int x = 0; x < width_; x++) {
-            float *po = output->PointerAt<float>(x, y, 0);
-            double temp = 0;
-            for (int i = -half_kernel_size; i <= half_kernel_size; i++) {
-                int x_shift = x + i;
-                if (x_shift < 0) x_shift = 0;
-                if (x_shift > width_ - 1) x_shift = width_ - 1;
-                float *pi = PointerAt<float>(x_shift, y, 0);
-                temp += (*pi * (float)kernel[i + half_kernel_size]);
+    const std::vector<float> kernel_f = ToFloatKernel(kernel);
+
+#pragma omp parallel num_threads(utility::EstimateMaxThreads())
+    {
+        FilterScratch scratch;
+        scratch.acc.resize(width_);
+        scratch.taps.resize(kernel_f.size());
+#pragma omp for schedule(static)
+        for (int y = 0; y < height_; y++) {
+            LoadPaddedRow(*this, y, 0, width_, half_kernel_size,
+                          scratch.padded_row);
+            for (size_t i = 0; i < kernel_f.size(); i++) {
+                scratch.taps[i] = scratch.padded_row.data() + i;
             }
-            *po = (float)temp;
+            ConvolveRows(scratch.taps.data(), kernel_f, width_,
+                         scratch.acc.data(), output->PointerAt<float>(0, y));
         }
     }
     return output;
 }
 
 std::shared_ptr<Image> Image::Filter(Image::FilterType type) const {
-    auto output = std::make_shared<Image>();
     if (num_of_channels_ != 1 || bytes_per_channel_ != 4) {
         utility::LogError("[Filter] Unsupported image format.");
     }
-
-    switch (type) {
-        case Image::FilterType::Gaussian3:
-            output = Filter(Gaussian3, Gaussian3);
-            break;
-        case Image::FilterType::Gaussian5:
-            output = Filter(Gaussian5, Gaussian5);
-            break;
-        case Image::FilterType::Gaussian7:
-            output = Filter(Gaussian7, Gaussian7);
-            break;
-        case Image::FilterType::Sobel3Dx:
-            output = Filter(Sobel31, Sobel32);
-            break;
-        case Image::FilterType::Sobel3Dy:
-            output = Filter(Sobel32, Sobel31);
-            break;
-        default:
-            utility::LogError("[Filter] Unsupported filter type.");
-            break;
-    }
-    return output;
+    auto kernels = GetSeparableKernels(type);
+    return Filter(*kernels.first, *kernels.second);
 }
 
 ImagePyramid Image::FilterPyramid(const ImagePyramid &input,
@@ -252,12 +361,80 @@ std::shared_ptr<Image> Image::Filter(const std::vector<double> &dx,
     if (num_of_channels_ != 1 || bytes_per_channel_ != 4) {
         utility::LogError("[Filter] Unsupported image format.");
     }
+    if (dx.size() % 2 != 1 || dy.size() % 2 != 1) {
+        utility::LogError("[Filter] Unsupported kernel size.");
+    }
+    output->Prepare(width_, height_, 1, 4);
+
+    const std::vector<float> kx = ToFloatKernel(dx);
+    const std::vector<float> ky = ToFloatKernel(dy);
+    const int tiles_x = (width_ + kFilterTileWidth - 1) / kFilterTileWidth;
+    const int tiles_y = (height_ + kFilterTileHeight - 1) / kFilterTileHeight;
+
+#pragma omp parallel num_threads(utility::EstimateMaxThreads())
+    {
+        FilterScratch scratch;
+#pragma omp for schedule(static)
+        for (int t = 0; t < tiles_x * tiles_y; t++) {
+            int x0 = (t % tiles_x) * kFilterTileWidth;
+            int y0 = (t / tiles_x) * kFilterTileHeight;
+            int x1 = std::min(x0 + kFilterTileWidth, width_);
+            int y1 = std::min(y0 + kFilterTileHeight, height_);
+            FilterTile(*this, kx, ky, x0, x1, y0, y1, scratch,
+                       output->PointerAt<float>(x0, y0), width_);
+        }
+    }
+    return output;
+}
+
+std::shared_ptr<Image> Image::FilterAndDownsample(
+        Image::FilterType type) const {
+    auto output = std::make_shared<Image>();
+    if (num_of_channels_ != 1 || bytes_per_channel_ != 4) {
+        utility::LogError("[FilterAndDownsample] Unsupported image format.");
+    }
+    auto kernels = GetSeparableKernels(type);
+    const std::vector<float> kx = ToFloatKernel(*kernels.first);
+    const std::vector<float> ky = ToFloatKernel(*kernels.second);
+
+    int half_width = (int)floor((double)width_ / 2.0);
+    int half_height = (int)floor((double)height_ / 2.0);
+    output->Prepare(half_width, half_height, 1, 4);
 
-    auto temp1 = FilterHorizontal(dx);
-    auto temp2 = temp1->Transpose();
-    auto temp3 = temp2->FilterHorizontal(dy);
-    auto temp4 = temp3->Transpose();
-    return temp4;
+    // Only the filtered pixels covered by a 2x2 block are needed. Clamping
+    // still uses the full input extent, so an odd last row or column affects
+    // its neighbours exactly as in Filter() followed by Downsample().
+    const int width = 2 * half_width;
+    const int height = 2 * half_height;
+    const int tiles_x = (width + kFilterTileWidth - 1) / kFilterTileWidth;
+    const int tiles_y = (height + kFilterTileHeight - 1) / kFilterTileHeight;
+
+#pragma omp parallel num_threads(utility::EstimateMaxThreads())
+    {
+        FilterScratch scratch;
+        scratch.tile.resize(kFilterTileWidth * kFilterTileHeight);
+#pragma omp for schedule(static)
+        for (int t = 0; t < tiles_x * tiles_y; t++) {
+            int x0 = (t % tiles_x) * kFilterTileWidth;
+            int y0 = (t / tiles_x) * kFilterTileHeight;
+            int x1 = std::min(x0 + kFilterTileWidth, width);
+            int y1 = std::min(y0 + kFilterTileHeight, height);
+            int tile_width = x1 - x0;
+            FilterTile(*this, kx, ky, x0, x1, y0, y1, scratch,
+                       scratch.tile.data(), tile_width);
+            for (int r = 0; r < (y1 - y0) / 2; r++) {
+                const float *row0 = scratch.tile.data() + 2 * r * tile_width;
+                const float *row1 = row0 + tile_width;
+                float *p = output->PointerAt<float>(x0 / 2, y0 / 2 + r);
+                for (int c = 0; c < tile_width / 2; c++) {
+                    p[c] = (row0[2 * c] + row0[2 * c + 1] + row1[2 * c] +
+                            row1[2 * c + 1]) /
+                           4.0f;
+                }
+            }
+        }
+    }
+    return output;
 }
 
 std::shared_ptr<Image> Image::Transpose() const {
@@ -269,9 +446,9 @@ std::shared_ptr<Image> Image::Transpose() const {
     int bytes_per_pixel = num_of_channels_ * bytes_per_channel_;
 
 #ifdef _WIN32
-#pragma omp parallel for schedule(static)
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
 #else
-#pragma omp parallel for collapse(2) schedule(static)
+#pragma omp parallel for collapse(2) schedule(static) num_threads(utility::EstimateMaxThreads())
 #endif
     for (int y = 0; y < height_; y++) {
         for (int x = 0; x < width_; x++) {
@@ -292,7 +469,7 @@ std::shared_ptr<Image> Image::FlipVertical() const {
     output->Prepare(width_, height_, num_of_channels_, bytes_per_channel_);
 
     int bytes_per_line = BytesPerLine();
-#pragma omp parallel for schedule(static)
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
     for (int y = 0; y < height_; y++) {
         std::copy(data_.data() + y * bytes_per_line,
                   data_.data() + (y + 1) * bytes_per_line,
@@ -308,9 +485,9 @@ std::shared_ptr<Image> Image::FlipHorizontal() const {
     int bytes_per_line = BytesPerLine();
     int bytes_per_pixel = num_of_channels_ * bytes_per_channel_;
 #ifdef _WIN32
-#pragma omp parallel for schedule(static)
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
 #else
-#pragma omp parallel for collapse(2) schedule(static)
+#pragma omp parallel for collapse(2) schedule(static) num_threads(utility::EstimateMaxThreads())
 #endif
     for (int y = 0; y < height_; y++) {
         for (int x = 0; x < width_; x++) {
@@ -333,9 +510,9 @@ std::shared_ptr<Image> Image::Dilate(int half_kernel_size /* = 1 */) const {
     output->Prepare(width_, height_, 1, 1);
 
 #ifdef _WIN32
-#pragma omp parallel for schedule(static)
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
 #else
-#pragma omp parallel for collapse(2) schedule(static)
+#pragma omp parallel for collapse(2) schedule(static) num_threads(utility::EstimateMaxThreads())
 #endif
     for (int y = 0; y < height_; y++) {
         for (int x = 0; x < width_; x++) {
@@ -371,9 +548,9 @@ std::shared_ptr<Image> Image::CreateDepthBoundaryMask(
     mask->Prepare(width, height, 1, 1);
 
 #ifdef _WIN32
-#pragma omp parallel for schedule(static)
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
 #else
-#pragma omp parallel for collapse(2) schedule(static)
+#pragma omp parallel for collapse(2) schedule(static) num_threads(utility::EstimateMaxThreads())
 #endif
     for (int v = 0; v < height; v++) {
         for (int u = 0; u < width; u++) {
@@ -193,6 +193,11 @@ public:
     /// Function to 2x image downsample using simple 2x2 averaging.
     std::shared_ptr<Image> Downsample() const;
 
+    /// Function to filter and 2x downsample the image in a single pass.
+    /// Equivalent to Filter(type)->Downsample(), but without creating the
+    /// full-resolution filtered image.
+    std::shared_ptr<Image> FilterAndDownsample(Image::FilterType type) const;
+
     /// Function to dilate 8bit mask map.
     std::shared_ptr<Image> Dilate(int half_kernel_size = 1) const;
 
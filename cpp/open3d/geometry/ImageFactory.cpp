@@ -158,9 +158,8 @@ ImagePyramid Image::CreatePyramid(size_t num_of_levels,
         } else {
             if (with_gaussian_filter) {
                 // https://en.wikipedia.org/wiki/Pyramid_(image_processing)
-                auto level_b = pyramid_image[i - 1]->Filter(
+                auto level_bd = pyramid_image[i - 1]->FilterAndDownsample(
                         Image::FilterType::Gaussian3);
-                auto level_bd = level_b->Downsample();
                 pyramid_image.push_back(level_bd);
             } else {
                 auto level_d = pyramid_image[i - 1]->Downsample();
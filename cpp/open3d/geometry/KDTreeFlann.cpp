@@ -31,23 +31,235 @@
 
 #include "open3d/geometry/KDTreeFlann.h"
 
+#include <algorithm>
 #include <flann/flann.hpp>
 
+#include "open3d/core/kernel/ParallelUtil.h"
 #include "open3d/geometry/HalfEdgeTriangleMesh.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
 
-KDTreeFlann::KDTreeFlann() {}
+namespace {
 
-KDTreeFlann::KDTreeFlann(const Eigen::MatrixXd &data) { SetMatrixData(data); }
+template <typename Scalar>
+using FlannIndex = flann::Index<flann::L2<Scalar>>;
 
-KDTreeFlann::KDTreeFlann(const Geometry &geometry) { SetGeometry(geometry); }
+// Float64 indices search the caller's buffers in place, Float32 indices go
+// through converted copies. The overloads below select either by the type of
+// the scratch buffer.
+const double *ToIndexScalar(const double *data,
+                            size_t size,
+                            std::vector<double> &buffer) {
+    return data;
+}
+
+const float *ToIndexScalar(const double *data,
+                           size_t size,
+                           std::vector<float> &buffer) {
+    buffer.assign(data, data + size);
+    return buffer.data();
+}
+
+double *DistanceBuffer(std::vector<double> &distance2,
+                       std::vector<double> &buffer) {
+    return distance2.data();
+}
+
+float *DistanceBuffer(std::vector<double> &distance2,
+                      std::vector<float> &buffer) {
+    buffer.resize(distance2.size());
+    return buffer.data();
+}
+
+void StoreDistances(const std::vector<double> &buffer,
+                    std::vector<double> &distance2) {}
+
+void StoreDistances(const std::vector<float> &buffer,
+                    std::vector<double> &distance2) {
+    std::copy(buffer.begin(), buffer.begin() + distance2.size(),
+              distance2.begin());
+}
+
+template <typename Scalar>
+int SearchKNNImpl(FlannIndex<Scalar> &index,
+                  const double *query,
+                  size_t dimension,
+                  int knn,
+                  std::vector<int> &indices,
+                  std::vector<double> &distance2) {
+    std::vector<Scalar> query_buffer;
+    std::vector<Scalar> dists_buffer;
+    flann::Matrix<Scalar> query_flann(
+            (Scalar *)ToIndexScalar(query, dimension, query_buffer), 1,
+            dimension);
+    indices.resize(knn);
+    distance2.resize(knn);
+    flann::Matrix<int> indices_flann(indices.data(), query_flann.rows, knn);
+    flann::Matrix<Scalar> dists_flann(DistanceBuffer(distance2, dists_buffer),
+                                      query_flann.rows, knn);
+    int k = index.knnSearch(query_flann, indices_flann, dists_flann, knn,
+                            flann::SearchParams(-1, 0.0));
+    indices.resize(k);
+    distance2.resize(k);
+    StoreDistances(dists_buffer, distance2);
+    return k;
+}
 
-KDTreeFlann::KDTreeFlann(const pipelines::registration::Feature &feature) {
+template <typename Scalar>
+int SearchRadiusImpl(FlannIndex<Scalar> &index,
+                     const double *query,
+                     size_t dimension,
+                     double radius,
+                     std::vector<int> &indices,
+                     std::vector<double> &distance2) {
+    std::vector<Scalar> query_buffer;
+    flann::Matrix<Scalar> query_flann(
+            (Scalar *)ToIndexScalar(query, dimension, query_buffer), 1,
+            dimension);
+    flann::SearchParams param(-1, 0.0);
+    param.max_neighbors = -1;
+    std::vector<std::vector<int>> indices_vec(1);
+    std::vector<std::vector<Scalar>> dists_vec(1);
+    int k = index.radiusSearch(query_flann, indices_vec, dists_vec,
+                               float(radius * radius), param);
+    indices = indices_vec[0];
+    distance2.assign(dists_vec[0].begin(), dists_vec[0].end());
+    return k;
+}
+
+template <typename Scalar>
+int SearchHybridImpl(FlannIndex<Scalar> &index,
+                     const double *query,
+                     size_t dimension,
+                     double radius,
+                     int max_nn,
+                     std::vector<int> &indices,
+                     std::vector<double> &distance2) {
+    std::vector<Scalar> query_buffer;
+    std::vector<Scalar> dists_buffer;
+    flann::Matrix<Scalar> query_flann(
+            (Scalar *)ToIndexScalar(query, dimension, query_buffer), 1,
+            dimension);
+    flann::SearchParams param(-1, 0.0);
+    param.max_neighbors = max_nn;
+    indices.resize(max_nn);
+    distance2.resize(max_nn);
+    flann::Matrix<int> indices_flann(indices.data(), query_flann.rows, max_nn);
+    flann::Matrix<Scalar> dists_flann(DistanceBuffer(distance2, dists_buffer),
+                                      query_flann.rows, max_nn);
+    int k = index.radiusSearch(query_flann, indices_flann, dists_flann,
+                               float(radius * radius), param);
+    indices.resize(k);
+    distance2.resize(k);
+    StoreDistances(dists_buffer, distance2);
+    return k;
+}
+
+/// Searches the queries [begin, end) with a single flann call and appends
+/// their neighbors to \p indices and \p distance2. The neighbor count of
+/// query i is written to offsets[i + 1].
+template <typename Scalar>
+void SearchChunk(FlannIndex<Scalar> &index,
+                 const double *queries,
+                 size_t dimension,
+                 size_t begin,
+                 size_t end,
+                 KDTreeSearchParam::SearchType search_type,
+                 double radius,
+                 int max_nn,
+                 std::vector<int> &indices,
+                 std::vector<double> &distance2,
+                 std::vector<size_t> &offsets) {
+    std::vector<Scalar> queries_buffer;
+    flann::Matrix<Scalar> queries_flann(
+            (Scalar *)ToIndexScalar(queries + begin * dimension,
+                                    (end - begin) * dimension, queries_buffer),
+            end - begin, dimension);
+    flann::SearchParams search_param(-1, 0.0);
+    search_param.max_neighbors = max_nn;
+    if (search_type == KDTreeSearchParam::SearchType::Radius) {
+        std::vector<std::vector<size_t>> indices_vec;
+        std::vector<std::vector<Scalar>> dists_vec;
+        index.radiusSearch(queries_flann, indices_vec, dists_vec,
+                           float(radius * radius), search_param);
+        for (size_t i = begin; i < end; i++) {
+            const auto &query_indices = indices_vec[i - begin];
+            const auto &query_dists = dists_vec[i - begin];
+            indices.insert(indices.end(), query_indices.begin(),
+                           query_indices.end());
+            distance2.insert(distance2.end(), query_dists.begin(),
+                             query_dists.end());
+            offsets[i + 1] = query_indices.size();
+        }
+    } else if (max_nn > 0) {
+        // Unused neighbor slots keep the invalid index.
+        std::vector<size_t> indices_buf((end - begin) * max_nn, size_t(-1));
+        std::vector<Scalar> dists_buf((end - begin) * max_nn);
+        flann::Matrix<size_t> indices_flann(indices_buf.data(), end - begin,
+                                            max_nn);
+        flann::Matrix<Scalar> dists_flann(dists_buf.data(), end - begin,
+                                          max_nn);
+        if (search_type == KDTreeSearchParam::SearchType::Knn) {
+            index.knnSearch(queries_flann, indices_flann, dists_flann, max_nn,
+                            search_param);
+        } else {
+            index.radiusSearch(queries_flann, indices_flann, dists_flann,
+                               float(radius * radius), search_param);
+        }
+        indices.reserve(indices_buf.size());
+        distance2.reserve(dists_buf.size());
+        for (size_t i = begin; i < end; i++) {
+            const size_t *query_indices = indices_flann[i - begin];
+            const Scalar *query_dists = dists_flann[i - begin];
+            size_t k = 0;
+            while (k < size_t(max_nn) && query_indices[k] != size_t(-1)) {
+                indices.push_back(int(query_indices[k]));
+                distance2.push_back(query_dists[k]);
+                k++;
+            }
+            offsets[i + 1] = k;
+        }
+    }
+}
+
+/// Builds a flann index over \p data. The index keeps its own reordered copy
+/// of the points, so \p data is only referenced during the build.
+template <typename Scalar>
+std::unique_ptr<FlannIndex<Scalar>> BuildIndex(const Scalar *data,
+                                               size_t dataset_size,
+                                               size_t dimension) {
+    flann::Matrix<Scalar> dataset((Scalar *)data, dataset_size, dimension);
+    std::unique_ptr<FlannIndex<Scalar>> index(new FlannIndex<Scalar>(
+            dataset, flann::KDTreeSingleIndexParams(15, true)));
+    // The subtrees are split into OpenMP tasks picked up by the team.
+#pragma omp parallel num_threads(utility::EstimateMaxThreads())
+#pragma omp single
+    index->buildIndex();
+    return index;
+}
+
+}  // namespace
+
+KDTreeFlann::KDTreeFlann(Precision precision) : precision_(precision) {}
+
+KDTreeFlann::KDTreeFlann(const Eigen::MatrixXd &data, Precision precision)
+    : precision_(precision) {
+    SetMatrixData(data);
+}
+
+KDTreeFlann::KDTreeFlann(const Geometry &geometry, Precision precision)
+    : precision_(precision) {
+    SetGeometry(geometry);
+}
+
+KDTreeFlann::KDTreeFlann(const pipelines::registration::Feature &feature,
+                         Precision precision)
+    : precision_(precision) {
     SetFeature(feature);
 }
 
@@ -116,20 +328,15 @@ int KDTreeFlann::SearchKNN(const T &query,
     // This is optimized code for heavily repeated search.
     // Other flann::Index::knnSearch() implementations lose performance due to
     // memory allocation/deallocation.
-    if (data_.empty() || dataset_size_ <= 0 ||
-        size_t(query.rows()) != dimension_ || knn < 0) {
+    if (dataset_size_ <= 0 || size_t(query.rows()) != dimension_ || knn < 0) {
         return -1;
     }
-    flann::Matrix<double> query_flann((double *)query.data(), 1, dimension_);
-    indices.resize(knn);
-    distance2.resize(knn);
-    flann::Matrix<int> indices_flann(indices.data(), query_flann.rows, knn);
-    flann::Matrix<double> dists_flann(distance2.data(), query_flann.rows, knn);
-    int k = flann_index_->knnSearch(query_flann, indices_flann, dists_flann,
-                                    knn, flann::SearchParams(-1, 0.0));
-    indices.resize(k);
-    distance2.resize(k);
-    return k;
+    if (flann_index_float_) {
+        return SearchKNNImpl(*flann_index_float_, query.data(), dimension_,
+                             knn, indices, distance2);
+    }
+    return SearchKNNImpl(*flann_index_, query.data(), dimension_, knn, indices,
+                         distance2);
 }
 
 template <typename T>
@@ -141,20 +348,15 @@ int KDTreeFlann::SearchRadius(const T &query,
     // Since max_nn is not given, we let flann to do its own memory management.
     // Other flann::Index::radiusSearch() implementations lose performance due
     // to memory management and CPU caching.
-    if (data_.empty() || dataset_size_ <= 0 ||
-        size_t(query.rows()) != dimension_) {
+    if (dataset_size_ <= 0 || size_t(query.rows()) != dimension_) {
         return -1;
     }
-    flann::Matrix<double> query_flann((double *)query.data(), 1, dimension_);
-    flann::SearchParams param(-1, 0.0);
-    param.max_neighbors = -1;
-    std::vector<std::vector<int>> indices_vec(1);
-    std::vector<std::vector<double>> dists_vec(1);
-    int k = flann_index_->radiusSearch(query_flann, indices_vec, dists_vec,
-                                       float(radius * radius), param);
-    indices = indices_vec[0];
-    distance2 = dists_vec[0];
-    return k;
+    if (flann_index_float_) {
+        return SearchRadiusImpl(*flann_index_float_, query.data(), dimension_,
+                                radius, indices, distance2);
+    }
+    return SearchRadiusImpl(*flann_index_, query.data(), dimension_, radius,
+                            indices, distance2);
 }
 
 template <typename T>
@@ -167,40 +369,137 @@ int KDTreeFlann::SearchHybrid(const T &query,
     // It is also the recommended setting for search.
     // Other flann::Index::radiusSearch() implementations lose performance due
     // to memory allocation/deallocation.
-    if (data_.empty() || dataset_size_ <= 0 ||
-        size_t(query.rows()) != dimension_ || max_nn < 0) {
+    if (dataset_size_ <= 0 || size_t(query.rows()) != dimension_ ||
+        max_nn < 0) {
         return -1;
     }
-    flann::Matrix<double> query_flann((double *)query.data(), 1, dimension_);
-    flann::SearchParams param(-1, 0.0);
-    param.max_neighbors = max_nn;
-    indices.resize(max_nn);
-    distance2.resize(max_nn);
-    flann::Matrix<int> indices_flann(indices.data(), query_flann.rows, max_nn);
-    flann::Matrix<double> dists_flann(distance2.data(), query_flann.rows,
-                                      max_nn);
-    int k = flann_index_->radiusSearch(query_flann, indices_flann, dists_flann,
-                                       float(radius * radius), param);
-    indices.resize(k);
-    distance2.resize(k);
-    return k;
+    if (flann_index_float_) {
+        return SearchHybridImpl(*flann_index_float_, query.data(), dimension_,
+                                radius, max_nn, indices, distance2);
+    }
+    return SearchHybridImpl(*flann_index_, query.data(), dimension_, radius,
+                            max_nn, indices, distance2);
+}
+
+bool KDTreeFlann::SearchBatch(const std::vector<Eigen::Vector3d> &queries,
+                              const KDTreeSearchParam &param,
+                              KDTreeSearchResult &result) const {
+    return SearchBatchRaw(Eigen::Map<const Eigen::MatrixXd>(
+                                  (const double *)queries.data(), 3,
+                                  queries.size()),
+                          param, result);
+}
+
+bool KDTreeFlann::SearchBatch(const Eigen::MatrixXd &queries,
+                              const KDTreeSearchParam &param,
+                              KDTreeSearchResult &result) const {
+    return SearchBatchRaw(Eigen::Map<const Eigen::MatrixXd>(
+                                  queries.data(), queries.rows(),
+                                  queries.cols()),
+                          param, result);
+}
+
+bool KDTreeFlann::SearchBatchRaw(
+        const Eigen::Map<const Eigen::MatrixXd> &queries,
+        const KDTreeSearchParam &param,
+        KDTreeSearchResult &result) const {
+    const size_t num_queries = size_t(queries.cols());
+    result.indices_.clear();
+    result.distance2_.clear();
+    result.offsets_.assign(num_queries + 1, 0);
+    if (dataset_size_ <= 0 || size_t(queries.rows()) != dimension_) {
+        return false;
+    }
+
+    // Knn and hybrid searches write at most max_nn neighbors per query into a
+    // preallocated buffer, radius searches let flann size the buffer.
+    const auto search_type = param.GetSearchType();
+    int max_nn = -1;
+    double radius = 0.0;
+    switch (search_type) {
+        case KDTreeSearchParam::SearchType::Knn:
+            max_nn = ((const KDTreeSearchParamKNN &)param).knn_;
+            break;
+        case KDTreeSearchParam::SearchType::Radius:
+            radius = ((const KDTreeSearchParamRadius &)param).radius_;
+            break;
+        case KDTreeSearchParam::SearchType::Hybrid:
+            radius = ((const KDTreeSearchParamHybrid &)param).radius_;
+            max_nn = ((const KDTreeSearchParamHybrid &)param).max_nn_;
+            break;
+        default:
+            return false;
+    }
+    if (search_type != KDTreeSearchParam::SearchType::Radius && max_nn < 0) {
+        return false;
+    }
+    if (num_queries == 0) {
+        return true;
+    }
+
+    // Queries are split into contiguous chunks, each searched by a single
+    // flann call whose neighbors are appended into the buffers of the chunk;
+    // the chunks are then concatenated in query order.
+    const size_t num_chunks = std::min(
+            num_queries, size_t(4 * core::kernel::GetMaxThreads()));
+    std::vector<std::vector<int>> chunk_indices(num_chunks);
+    std::vector<std::vector<double>> chunk_distance2(num_chunks);
+#pragma omp parallel for schedule(dynamic, 1) num_threads(utility::EstimateMaxThreads())
+    for (int chunk = 0; chunk < int(num_chunks); chunk++) {
+        const size_t begin = num_queries * chunk / num_chunks;
+        const size_t end = num_queries * (chunk + 1) / num_chunks;
+        if (flann_index_float_) {
+            SearchChunk(*flann_index_float_, queries.data(), dimension_, begin,
+                        end, search_type, radius, max_nn, chunk_indices[chunk],
+                        chunk_distance2[chunk], result.offsets_);
+        } else {
+            SearchChunk(*flann_index_, queries.data(), dimension_, begin, end,
+                        search_type, radius, max_nn, chunk_indices[chunk],
+                        chunk_distance2[chunk], result.offsets_);
+        }
+    }
+
+    for (size_t i = 0; i < num_queries; i++) {
+        result.offsets_[i + 1] += result.offsets_[i];
+    }
+    result.indices_.resize(result.offsets_[num_queries]);
+    result.distance2_.resize(result.offsets_[num_queries]);
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int chunk = 0; chunk < int(num_chunks); chunk++) {
+        const size_t offset = result.offsets_[num_queries * chunk / num_chunks];
+        std::copy(chunk_indices[chunk].begin(), chunk_indices[chunk].end(),
+                  result.indices_.begin() + offset);
+        std::copy(chunk_distance2[chunk].begin(), chunk_distance2[chunk].end(),
+                  result.distance2_.begin() + offset);
+    }
+    return true;
 }
 
 bool KDTreeFlann::SetRawData(const Eigen::Map<const Eigen::MatrixXd> &data) {
+    flann_index_.reset();
+    flann_index_float_.reset();
     dimension_ = data.rows();
     dataset_size_ = data.cols();
     if (dimension_ == 0 || dataset_size_ == 0) {
+        dimension_ = 0;
+        dataset_size_ = 0;
         utility::LogWarning("[KDTreeFlann::SetRawData] Failed due to no data.");
         return false;
     }
-    data_.resize(dataset_size_ * dimension_);
-    memcpy(data_.data(), data.data(),
-           dataset_size_ * dimension_ * sizeof(double));
-    flann_dataset_.reset(new flann::Matrix<double>((double *)data_.data(),
-                                                   dataset_size_, dimension_));
-    flann_index_.reset(new flann::Index<flann::L2<double>>(
-            *flann_dataset_, flann::KDTreeSingleIndexParams(15)));
-    flann_index_->buildIndex();
+    // flann reorders the points into its own buffer, so the input is indexed
+    // in place instead of being copied first.
+    if (precision_ == Precision::Float32) {
+        std::vector<float> data_float(dataset_size_ * dimension_);
+        const double *src = data.data();
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+        for (int64_t i = 0; i < int64_t(data_float.size()); i++) {
+            data_float[i] = float(src[i]);
+        }
+        flann_index_float_ =
+                BuildIndex(data_float.data(), dataset_size_, dimension_);
+    } else {
+        flann_index_ = BuildIndex(data.data(), dataset_size_, dimension_);
+    }
     return true;
 }
 
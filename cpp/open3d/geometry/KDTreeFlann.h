@@ -37,8 +37,6 @@
 /// @cond
 namespace flann {
 template <typename T>
-class Matrix;
-template <typename T>
 struct L2;
 template <typename T>
 class Index;
@@ -48,26 +46,81 @@ class Index;
 namespace open3d {
 namespace geometry {
 
+/// \class KDTreeSearchResult
+///
+/// \brief Neighbors of a batch of queries, in compressed sparse row layout.
+///
+/// The neighbors of query i and their squared distances are stored in
+/// indices_ and distance2_ in the range [offsets_[i], offsets_[i + 1]).
+class KDTreeSearchResult {
+public:
+    /// Returns the number of queries.
+    size_t NumQueries() const {
+        return offsets_.empty() ? 0 : offsets_.size() - 1;
+    }
+    /// Returns the number of neighbors found for query \p i.
+    int NumNeighbors(size_t i) const {
+        return int(offsets_[i + 1] - offsets_[i]);
+    }
+    /// Returns the neighbor indices of query \p i.
+    const int *Indices(size_t i) const {
+        return indices_.data() + offsets_[i];
+    }
+    /// Returns the squared neighbor distances of query \p i.
+    const double *Distance2(size_t i) const {
+        return distance2_.data() + offsets_[i];
+    }
+
+public:
+    /// Neighbor indices of all queries.
+    std::vector<int> indices_;
+    /// Squared neighbor distances of all queries.
+    std::vector<double> distance2_;
+    /// Start of the neighbors of each query, with one extra final entry.
+    std::vector<size_t> offsets_;
+};
+
 /// \class KDTreeFlann
 ///
 /// \brief KDTree with FLANN for nearest neighbor search.
+///
+/// The tree is built in parallel and keeps its own reordered copy of the data
+/// points, so the input does not have to outlive it.
 class KDTreeFlann {
+public:
+    /// \brief Scalar type of the points stored in the index.
+    enum class Precision {
+        /// Double precision, exact distances.
+        Float64,
+        /// Single precision, half the memory at the cost of distances and
+        /// neighbor ordering only accurate to single precision.
+        Float32,
+    };
+
 public:
     /// \brief Default Constructor.
-    KDTreeFlann();
+    ///
+    /// \param precision Scalar type of the points stored in the index.
+    KDTreeFlann(Precision precision = Precision::Float64);
     /// \brief Parameterized Constructor.
     ///
     /// \param data Provides set of data points for KDTree construction.
-    KDTreeFlann(const Eigen::MatrixXd &data);
+    /// \param precision Scalar type of the points stored in the index.
+    KDTreeFlann(const Eigen::MatrixXd &data,
+                Precision precision = Precision::Float64);
     /// \brief Parameterized Constructor.
     ///
     /// \param geometry Provides geometry from which KDTree is constructed.
-    KDTreeFlann(const Geometry &geometry);
+    /// \param precision Scalar type of the points stored in the index.
+    KDTreeFlann(const Geometry &geometry,
+                Precision precision = Precision::Float64);
     /// \brief Parameterized Constructor.
     ///
     /// \param feature Provides a set of features from which the KDTree is
     /// constructed.
-    KDTreeFlann(const pipelines::registration::Feature &feature);
+    /// \param precision Scalar type of the points stored in the index.
+    KDTreeFlann(const pipelines::registration::Feature &feature,
+                Precision precision = Precision::Float64);
     ~KDTreeFlann();
     KDTreeFlann(const KDTreeFlann &) = delete;
     KDTreeFlann &operator=(const KDTreeFlann &) = delete;
@@ -86,6 +139,9 @@ public:
     /// \param feature Set of features for KDTree construction.
     bool SetFeature(const pipelines::registration::Feature &feature);
 
+    /// Returns the scalar type of the points stored in the index.
+    Precision GetPrecision() const { return precision_; }
+
     template <typename T>
     int Search(const T &query,
                const KDTreeSearchParam &param,
@@ -111,6 +167,30 @@ public:
                      std::vector<int> &indices,
                      std::vector<double> &distance2) const;
 
+    /// \brief Searches the neighbors of a batch of points in parallel.
+    ///
+    /// The buffers of \p result are reused, so the same result can be passed
+    /// to repeated searches without reallocating.
+    ///
+    /// \param queries Query points.
+    /// \param param Search parameters, as in Search().
+    /// \param result Neighbors of every query, in query order.
+    /// \return false if the tree has no data or the queries do not match its
+    /// dimension.
+    bool SearchBatch(const std::vector<Eigen::Vector3d> &queries,
+                     const KDTreeSearchParam &param,
+                     KDTreeSearchResult &result) const;
+    /// \brief Searches the neighbors of a batch of queries in parallel.
+    ///
+    /// \param queries Query matrix, with one query per column.
+    /// \param param Search parameters, as in Search().
+    /// \param result Neighbors of every query, in column order.
+    /// \return false if the tree has no data or the queries do not match its
+    /// dimension.
+    bool SearchBatch(const Eigen::MatrixXd &queries,
+                     const KDTreeSearchParam &param,
+                     KDTreeSearchResult &result) const;
+
 private:
     /// \brief Sets the KDTree data from the data provided by the other methods.
     ///
@@ -118,10 +198,17 @@ private:
     /// features, geometry, etc.
     bool SetRawData(const Eigen::Map<const Eigen::MatrixXd> &data);
 
+    /// \brief Searches the queries provided by the SearchBatch() overloads.
+    bool SearchBatchRaw(const Eigen::Map<const Eigen::MatrixXd> &queries,
+                        const KDTreeSearchParam &param,
+                        KDTreeSearchResult &result) const;
+
 protected:
-    std::vector<double> data_;
-    std::unique_ptr<flann::Matrix<double>> flann_dataset_;
+    Precision precision_ = Precision::Float64;
+    /// Index of Float64 precision trees.
     std::unique_ptr<flann::Index<flann::L2<double>>> flann_index_;
+    /// Index of Float32 precision trees.
+    std::unique_ptr<flann::Index<flann::L2<float>>> flann_index_float_;
     size_t dimension_ = 0;
     size_t dataset_size_ = 0;
 };
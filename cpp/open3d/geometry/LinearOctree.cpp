@@ -0,0 +1,498 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/LinearOctree.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/geometry/VoxelGrid.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/Parallel.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace open3d {
+namespace geometry {
+
+namespace {
+
+// Moves the lowest 21 bits of v to every third bit.
+uint64_t SpreadBits(uint64_t v) {
+    v &= 0x1fffff;
+    v = (v | (v << 32)) & 0x1f00000000ffffull;
+    v = (v | (v << 16)) & 0x1f0000ff0000ffull;
+    v = (v | (v << 8)) & 0x100f00f00f00f00full;
+    v = (v | (v << 4)) & 0x10c30c30c30c30c3ull;
+    v = (v | (v << 2)) & 0x1249249249249249ull;
+    return v;
+}
+
+// Gathers every third bit of v, the inverse of SpreadBits.
+uint64_t CompactBits(uint64_t v) {
+    v &= 0x1249249249249249ull;
+    v = (v | (v >> 2)) & 0x10c30c30c30c30c3ull;
+    v = (v | (v >> 4)) & 0x100f00f00f00f00full;
+    v = (v | (v >> 8)) & 0x1f0000ff0000ffull;
+    v = (v | (v >> 16)) & 0x1f00000000ffffull;
+    v = (v | (v >> 32)) & 0x1fffff;
+    return v;
+}
+
+// Morton code of the cell of the point at the given depth, clamped to the
+// bounds of the octree.
+uint64_t ComputeMortonCode(const Eigen::Vector3d& point,
+                           const Eigen::Vector3d& origin,
+                           double size,
+                           size_t depth) {
+    const int64_t num_cells = int64_t(1) << depth;
+    const double scale = size > 0 ? num_cells / size : 0;
+    uint64_t code = 0;
+    for (int axis = 0; axis < 3; ++axis) {
+        int64_t index = static_cast<int64_t>(
+                std::floor((point(axis) - origin(axis)) * scale));
+        index = std::min(std::max(index, int64_t(0)), num_cells - 1);
+        code |= SpreadBits(uint64_t(index)) << axis;
+    }
+    return code;
+}
+
+// Sorts the keys by their lowest num_bits bits and permutes the values
+// along, with a least significant digit radix sort on 8-bit digits. Each
+// pass counts the digits of one block of keys per thread, then each thread
+// scatters its block from its own offsets, which keeps the sort stable.
+void RadixSortPairs(std::vector<uint64_t>& keys,
+                    std::vector<size_t>& values,
+                    size_t num_bits) {
+    const int64_t n = static_cast<int64_t>(keys.size());
+    std::vector<uint64_t> sorted_keys(n);
+    std::vector<size_t> sorted_values(n);
+    int max_threads = utility::EstimateMaxThreads();
+    std::vector<int64_t> offsets(max_threads * 256);
+    for (size_t shift = 0; shift < num_bits; shift += 8) {
+        std::fill(offsets.begin(), offsets.end(), 0);
+#pragma omp parallel num_threads(max_threads)
+        {
+            int thread = 0;
+            int num_threads = 1;
+#ifdef _OPENMP
+            thread = omp_get_thread_num();
+            num_threads = omp_get_num_threads();
+#endif
+            const int64_t begin = n * thread / num_threads;
+            const int64_t end = n * (thread + 1) / num_threads;
+            int64_t* thread_offsets = offsets.data() + thread * 256;
+            for (int64_t i = begin; i < end; ++i) {
+                thread_offsets[(keys[i] >> shift) & 0xff]++;
+            }
+#pragma omp barrier
+#pragma omp single
+            {
+                int64_t offset = 0;
+                for (int digit = 0; digit < 256; ++digit) {
+                    for (int t = 0; t < num_threads; ++t) {
+                        int64_t count = offsets[t * 256 + digit];
+                        offsets[t * 256 + digit] = offset;
+                        offset += count;
+                    }
+                }
+            }
+            for (int64_t i = begin; i < end; ++i) {
+                int64_t pos = thread_offsets[(keys[i] >> shift) & 0xff]++;
+                sorted_keys[pos] = keys[i];
+                sorted_values[pos] = values[i];
+            }
+        }
+        keys.swap(sorted_keys);
+        values.swap(sorted_values);
+    }
+}
+
+// Computes the sorted Morton codes of the distinct leaves at the given depth
+// that contain points, and the average color of their points if colors is
+// not empty.
+void ComputeSortedLeaves(const std::vector<Eigen::Vector3d>& points,
+                         const std::vector<Eigen::Vector3d>& colors,
+                         const Eigen::Vector3d& origin,
+                         double size,
+                         size_t depth,
+                         std::vector<uint64_t>& leaf_codes,
+                         std::vector<Eigen::Vector3d>& leaf_colors) {
+    const int64_t n = static_cast<int64_t>(points.size());
+    std::vector<uint64_t> codes(n);
+    std::vector<size_t> order(n);
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < n; ++i) {
+        codes[i] = ComputeMortonCode(points[i], origin, size, depth);
+        order[i] = size_t(i);
+    }
+    RadixSortPairs(codes, order, 3 * depth);
+
+    // Each run of equal codes is a leaf.
+    std::vector<int64_t> starts;
+    for (int64_t i = 0; i < n; ++i) {
+        if (i == 0 || codes[i] != codes[i - 1]) {
+            starts.push_back(i);
+        }
+    }
+    starts.push_back(n);
+    const int64_t num_leaves = static_cast<int64_t>(starts.size()) - 1;
+    leaf_codes.resize(num_leaves);
+    leaf_colors.assign(num_leaves, Eigen::Vector3d::Zero());
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int64_t leaf = 0; leaf < num_leaves; ++leaf) {
+        leaf_codes[leaf] = codes[starts[leaf]];
+        if (!colors.empty()) {
+            for (int64_t i = starts[leaf]; i < starts[leaf + 1]; ++i) {
+                leaf_colors[leaf] += colors[order[i]];
+            }
+            leaf_colors[leaf] /= double(starts[leaf + 1] - starts[leaf]);
+        }
+    }
+}
+
+}  // unnamed namespace
+
+const size_t LinearOctree::kMaxDepth;
+
+LinearOctree& LinearOctree::Clear() {
+    child_masks_.clear();
+    colors_.clear();
+    codes_.clear();
+    depths_.clear();
+    subtree_sizes_.clear();
+    return *this;
+}
+
+OctreeNodeInfo LinearOctree::GetNodeInfo(size_t node) const {
+    const size_t depth = depths_[node];
+    const uint64_t code = codes_[node];
+    const double node_size = std::ldexp(size_, -int(depth));
+    Eigen::Vector3d index(double(CompactBits(code)),
+                          double(CompactBits(code >> 1)),
+                          double(CompactBits(code >> 2)));
+    return OctreeNodeInfo(origin_ + index * node_size, node_size, depth,
+                          size_t(code & 7));
+}
+
+void LinearOctree::ConvertFromPointCloud(
+        const geometry::PointCloud& point_cloud, double size_expand) {
+    if (size_expand > 1 || size_expand < 0) {
+        utility::LogError("size_expand shall be between 0 and 1");
+    }
+    if (max_depth_ > kMaxDepth) {
+        utility::LogError("max_depth shall be at most {}, but got {}.",
+                          kMaxDepth, max_depth_);
+    }
+
+    // Set bounds
+    Clear();
+    Eigen::Array3d min_bound = point_cloud.GetMinBound();
+    Eigen::Array3d max_bound = point_cloud.GetMaxBound();
+    Eigen::Array3d center = (min_bound + max_bound) / 2;
+    Eigen::Array3d half_sizes = center - min_bound;
+    double max_half_size = half_sizes.maxCoeff();
+    origin_ = min_bound.min(center - max_half_size);
+    if (max_half_size == 0) {
+        size_ = size_expand;
+    } else {
+        size_ = max_half_size * 2 * (1 + size_expand);
+    }
+    if (!point_cloud.HasPoints()) {
+        return;
+    }
+
+    std::vector<uint64_t> leaf_codes;
+    std::vector<Eigen::Vector3d> leaf_colors;
+    ComputeSortedLeaves(point_cloud.points_, point_cloud.colors_, origin_,
+                        size_, max_depth_, leaf_codes, leaf_colors);
+    BuildFromSortedLeaves(leaf_codes, leaf_colors);
+}
+
+void LinearOctree::BuildFromSortedLeaves(
+        const std::vector<uint64_t>& leaf_codes,
+        const std::vector<Eigen::Vector3d>& leaf_colors) {
+    Clear();
+    const size_t max_depth = max_depth_;
+
+    // Each leaf adds the nodes on its path that it does not share with the
+    // previous leaf, which is depth-first order. path[d] is the last node at
+    // depth d.
+    std::vector<size_t> path(max_depth + 1, 0);
+    for (size_t leaf = 0; leaf < leaf_codes.size(); ++leaf) {
+        const uint64_t code = leaf_codes[leaf];
+        size_t first_new_depth = 0;
+        if (leaf > 0) {
+            const uint64_t diff = code ^ leaf_codes[leaf - 1];
+            first_new_depth = 1;
+            while ((diff >> (3 * (max_depth - first_new_depth))) == 0) {
+                ++first_new_depth;
+            }
+        }
+        for (size_t depth = first_new_depth; depth <= max_depth; ++depth) {
+            if (depth > 0) {
+                child_masks_[path[depth - 1]] |= uint8_t(
+                        1 << ((code >> (3 * (max_depth - depth))) & 7));
+            }
+            path[depth] = child_masks_.size();
+            child_masks_.push_back(0);
+            colors_.push_back(depth == max_depth ? leaf_colors[leaf]
+                                                 : Eigen::Vector3d::Zero());
+        }
+    }
+    UpdateLayout();
+}
+
+bool LinearOctree::UpdateLayout() {
+    const size_t n = child_masks_.size();
+    codes_.assign(n, 0);
+    depths_.assign(n, 0);
+    subtree_sizes_.assign(n, 1);
+    colors_.resize(n, Eigen::Vector3d::Zero());
+    if (n == 0) {
+        return true;
+    }
+
+    // Walk the nodes in depth-first order, keeping the path from the root
+    // with the children of each node on it that are not visited yet.
+    std::vector<size_t> parents(n, 0);
+    std::vector<size_t> path{0};
+    std::vector<uint8_t> unvisited{child_masks_[0]};
+    bool valid = max_depth_ <= kMaxDepth;
+    for (size_t node = 1; node < n && valid; ++node) {
+        while (!path.empty() && unvisited.back() == 0) {
+            path.pop_back();
+            unvisited.pop_back();
+        }
+        if (path.empty()) {
+            valid = false;
+            break;
+        }
+        const size_t parent = path.back();
+        int child = 0;
+        while ((unvisited.back() & (1 << child)) == 0) {
+            ++child;
+        }
+        unvisited.back() &= uint8_t(~(1 << child));
+        parents[node] = parent;
+        depths_[node] = uint8_t(depths_[parent] + 1);
+        codes_[node] = (codes_[parent] << 3) | uint64_t(child);
+        valid = depths_[node] <= max_depth_;
+        path.push_back(node);
+        unvisited.push_back(child_masks_[node]);
+    }
+    for (uint8_t mask : unvisited) {
+        valid = valid && mask == 0;
+    }
+    if (!valid) {
+        Clear();
+        return false;
+    }
+
+    // Descendants come after their ancestors, so a backward pass sums the
+    // subtrees. The colors of internal nodes are sums of leaf colors until
+    // the node is reached.
+    std::vector<size_t> num_leaves(n, 0);
+    for (size_t node = 0; node < n; ++node) {
+        if (IsLeaf(node)) {
+            num_leaves[node] = 1;
+        } else {
+            colors_[node].setZero();
+        }
+    }
+    for (size_t node = n - 1; node > 0; --node) {
+        const size_t parent = parents[node];
+        subtree_sizes_[parent] += subtree_sizes_[node];
+        num_leaves[parent] += num_leaves[node];
+        colors_[parent] += colors_[node];
+        if (!IsLeaf(node)) {
+            colors_[node] /= double(num_leaves[node]);
+        }
+    }
+    if (!IsLeaf(0)) {
+        colors_[0] /= double(num_leaves[0]);
+    }
+    return true;
+}
+
+int64_t LinearOctree::LocateLeafNode(const Eigen::Vector3d& point) const {
+    if (IsEmpty() || !Octree::IsPointInBound(point, origin_, size_)) {
+        return -1;
+    }
+    const uint64_t code = ComputeMortonCode(point, origin_, size_, max_depth_);
+    size_t node = 0;
+    while (!IsLeaf(node)) {
+        const uint8_t mask = child_masks_[node];
+        const int child = int(
+                (code >> (3 * (max_depth_ - depths_[node] - 1))) & 7);
+        if ((mask & (1 << child)) == 0) {
+            return -1;
+        }
+        // Skip the subtrees of the previous siblings.
+        size_t next = node + 1;
+        for (int sibling = 0; sibling < child; ++sibling) {
+            if (mask & (1 << sibling)) {
+                next += subtree_sizes_[next];
+            }
+        }
+        node = next;
+    }
+    return int64_t(node);
+}
+
+void LinearOctree::Traverse(
+        const std::function<bool(size_t, const OctreeNodeInfo&)>& f) const {
+    for (size_t node = 0; node < NumNodes();) {
+        bool skip_children = f(node, GetNodeInfo(node));
+        node += skip_children ? subtree_sizes_[node] : 1;
+    }
+}
+
+std::shared_ptr<geometry::VoxelGrid> LinearOctree::ToVoxelGrid() const {
+    auto voxel_grid = std::make_shared<geometry::VoxelGrid>();
+    voxel_grid->origin_ = origin_;
+    size_t leaf_depth = 0;
+    for (size_t node = 0; node < NumNodes(); ++node) {
+        if (IsLeaf(node)) {
+            leaf_depth = std::max(leaf_depth, size_t(depths_[node]));
+        }
+    }
+    voxel_grid->voxel_size_ = std::ldexp(size_, -int(leaf_depth));
+    for (size_t node = 0; node < NumNodes(); ++node) {
+        if (!IsLeaf(node)) {
+            continue;
+        }
+        OctreeNodeInfo node_info = GetNodeInfo(node);
+        Eigen::Array3d node_center =
+                Eigen::Array3d(node_info.origin_) + node_info.size_ / 2.0;
+        Eigen::Vector3i grid_index =
+                Eigen::floor((node_center - Eigen::Array3d(origin_)) /
+                             voxel_grid->voxel_size_)
+                        .cast<int>();
+        voxel_grid->AddVoxel(Voxel(grid_index, colors_[node]));
+    }
+    return voxel_grid;
+}
+
+void LinearOctree::CreateFromVoxelGrid(const geometry::VoxelGrid& voxel_grid) {
+    if (max_depth_ > kMaxDepth) {
+        utility::LogError("max_depth shall be at most {}, but got {}.",
+                          kMaxDepth, max_depth_);
+    }
+    origin_ = voxel_grid.origin_;
+    size_ = (voxel_grid.GetMaxBound() - origin_).maxCoeff();
+    Clear();
+
+    double half_voxel_size = voxel_grid.voxel_size_ / 2.;
+    std::vector<Eigen::Vector3d> mid_points;
+    std::vector<Eigen::Vector3d> colors;
+    mid_points.reserve(voxel_grid.voxels_.size());
+    colors.reserve(voxel_grid.voxels_.size());
+    for (const auto& voxel_iter : voxel_grid.voxels_) {
+        const geometry::Voxel& voxel = voxel_iter.second;
+        mid_points.push_back(half_voxel_size + origin_.array() +
+                             voxel.grid_index_.array().cast<double>() *
+                                     voxel_grid.voxel_size_);
+        colors.push_back(voxel.color_);
+    }
+
+    std::vector<uint64_t> leaf_codes;
+    std::vector<Eigen::Vector3d> leaf_colors;
+    ComputeSortedLeaves(mid_points, colors, origin_, size_, max_depth_,
+                        leaf_codes, leaf_colors);
+    BuildFromSortedLeaves(leaf_codes, leaf_colors);
+}
+
+std::shared_ptr<geometry::Octree> LinearOctree::ToOctree() const {
+    auto octree = std::make_shared<geometry::Octree>(max_depth_, origin_,
+                                                     size_);
+    if (IsEmpty()) {
+        return octree;
+    }
+    std::function<std::shared_ptr<OctreeNode>(size_t)> create_node =
+            [&](size_t node) -> std::shared_ptr<OctreeNode> {
+        if (IsLeaf(node)) {
+            auto leaf_node = std::make_shared<OctreeColorLeafNode>();
+            leaf_node->color_ = colors_[node];
+            return leaf_node;
+        }
+        auto internal_node = std::make_shared<OctreeInternalNode>();
+        size_t child_node = node + 1;
+        for (int child = 0; child < 8; ++child) {
+            if (child_masks_[node] & (1 << child)) {
+                internal_node->children_[child] = create_node(child_node);
+                child_node += subtree_sizes_[child_node];
+            }
+        }
+        return internal_node;
+    };
+    octree->root_node_ = create_node(0);
+    return octree;
+}
+
+void LinearOctree::CreateFromOctree(const geometry::Octree& octree) {
+    origin_ = octree.origin_;
+    size_ = octree.size_;
+    max_depth_ = octree.max_depth_;
+    if (max_depth_ > kMaxDepth) {
+        utility::LogError("max_depth shall be at most {}, but got {}.",
+                          kMaxDepth, max_depth_);
+    }
+    Clear();
+
+    std::function<void(const std::shared_ptr<OctreeNode>&)> append_node =
+            [&](const std::shared_ptr<OctreeNode>& node) {
+                const size_t index = child_masks_.size();
+                child_masks_.push_back(0);
+                colors_.push_back(Eigen::Vector3d::Zero());
+                if (auto internal_node =
+                            std::dynamic_pointer_cast<OctreeInternalNode>(
+                                    node)) {
+                    for (size_t child = 0; child < 8; ++child) {
+                        if (internal_node->children_[child] != nullptr) {
+                            child_masks_[index] |= uint8_t(1 << child);
+                            append_node(internal_node->children_[child]);
+                        }
+                    }
+                } else if (auto leaf_node = std::dynamic_pointer_cast<
+                                   OctreeColorLeafNode>(node)) {
+                    colors_[index] = leaf_node->color_;
+                }
+            };
+    if (octree.root_node_ != nullptr) {
+        append_node(octree.root_node_);
+    }
+    if (!UpdateLayout()) {
+        utility::LogError("The octree is deeper than its max_depth {}.",
+                          max_depth_);
+    }
+}
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,176 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "open3d/geometry/Octree.h"
+
+namespace open3d {
+namespace geometry {
+
+class PointCloud;
+class VoxelGrid;
+
+/// \class LinearOctree
+///
+/// \brief Pointer-free octree stored as contiguous arrays of nodes.
+///
+/// The nodes are stored in depth-first order, with the children of a node in
+/// the order of their child index as in OctreeInternalNode. This is the order
+/// of the Morton codes of the nodes, parents first. A node is a leaf iff it
+/// has no children, and each leaf holds a color. The color of an internal
+/// node is the average color of the leaves below it, which serves as a level
+/// of detail.
+///
+/// The Morton code of a node at depth d interleaves the d bits of its integer
+/// coordinates in the grid of 2^d cells per axis, with x in the lowest bit of
+/// each triple, so that the last three bits are the child index of the node.
+/// Codes are 64-bit, which limits max_depth_ to 21.
+class LinearOctree {
+public:
+    /// Maximum depth whose Morton codes fit in 64 bits.
+    static const size_t kMaxDepth = 21;
+
+    /// \brief Default Constructor.
+    LinearOctree() : origin_(0, 0, 0), size_(0), max_depth_(0) {}
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param max_depth Sets the value of the max depth of the LinearOctree.
+    LinearOctree(size_t max_depth)
+        : origin_(0, 0, 0), size_(0), max_depth_(max_depth) {}
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param max_depth Sets the value of the max depth of the LinearOctree.
+    /// \param origin Sets the global min bound of the LinearOctree.
+    /// \param size Sets the outer bounding box edge size for the whole octree.
+    LinearOctree(size_t max_depth, const Eigen::Vector3d& origin, double size)
+        : origin_(origin), size_(size), max_depth_(max_depth) {}
+
+public:
+    /// Removes all the nodes, keeping the bounds and max depth.
+    LinearOctree& Clear();
+    /// Returns true if the octree has no nodes.
+    bool IsEmpty() const { return child_masks_.empty(); }
+    /// Number of nodes, including the internal ones.
+    size_t NumNodes() const { return child_masks_.size(); }
+    /// Returns true if the node has no children.
+    bool IsLeaf(size_t node) const { return child_masks_[node] == 0; }
+
+    /// Computes the origin, size, depth and child index of a node.
+    OctreeNodeInfo GetNodeInfo(size_t node) const;
+
+    /// \brief Builds the octree of a point cloud, with leaves at max_depth_.
+    ///
+    /// The bounds are computed as in Octree::ConvertFromPointCloud. The
+    /// Morton codes of the points are computed and radix sorted in parallel,
+    /// and each leaf gets the average color of its points.
+    ///
+    /// \param point_cloud Input point cloud.
+    /// \param size_expand A small expansion size such that the octree is
+    /// slightly bigger than the original point cloud bounds to accomodate all
+    /// points.
+    void ConvertFromPointCloud(const geometry::PointCloud& point_cloud,
+                               double size_expand = 0.01);
+
+    /// \brief Returns the index of the leaf containing the point, or -1 if
+    /// the point is out of bounds or in an empty part of the octree.
+    ///
+    /// \param point Coordinates of the point.
+    int64_t LocateLeafNode(const Eigen::Vector3d& point) const;
+
+    /// \brief Depth-first traversal of the octree from the root, with
+    /// callback function called for each node.
+    ///
+    /// \param f Called with the index and information of each node. The
+    /// children of a node are skipped if f returns true.
+    void Traverse(
+            const std::function<bool(size_t, const OctreeNodeInfo&)>& f) const;
+
+    /// Convert to VoxelGrid, with one voxel per leaf at the size of the
+    /// smallest leaf, as Octree::ToVoxelGrid.
+    std::shared_ptr<geometry::VoxelGrid> ToVoxelGrid() const;
+
+    /// Convert from VoxelGrid, inserting the voxel centers as
+    /// Octree::CreateFromVoxelGrid.
+    void CreateFromVoxelGrid(const geometry::VoxelGrid& voxel_grid);
+
+    /// Convert to Octree with OctreeColorLeafNode leaves.
+    std::shared_ptr<geometry::Octree> ToOctree() const;
+
+    /// Convert from Octree. Leaves other than OctreeColorLeafNode get a zero
+    /// color.
+    void CreateFromOctree(const geometry::Octree& octree);
+
+    /// \brief Rebuilds the codes, depths, subtree sizes and internal colors
+    /// from the child masks and the leaf colors.
+    ///
+    /// \return false if the child masks do not describe a tree of at most
+    /// max_depth_ levels, in which case the octree is cleared.
+    bool UpdateLayout();
+
+public:
+    /// Global min bound (include). A point is within bound iff
+    /// origin_ <= point < origin_ + size_.
+    Eigen::Vector3d origin_;
+
+    /// Outer bounding box edge size for the whole octree. A point is within
+    /// bound iff origin_ <= point < origin_ + size_.
+    double size_;
+
+    /// Max depth of octree. A tree with only the root node has depth 0.
+    size_t max_depth_;
+
+    /// Bit i is set iff the node has the child of index i.
+    std::vector<uint8_t> child_masks_;
+
+    /// Color of each node.
+    std::vector<Eigen::Vector3d> colors_;
+
+    /// Morton code of each node at its depth.
+    std::vector<uint64_t> codes_;
+
+    /// Depth of each node, the root is of depth 0.
+    std::vector<uint8_t> depths_;
+
+    /// Number of nodes in the subtree of each node, including itself. The
+    /// next sibling of node i is node i + subtree_sizes_[i].
+    std::vector<uint64_t> subtree_sizes_;
+
+private:
+    /// Rebuilds the nodes from the sorted Morton codes of distinct leaves at
+    /// max_depth_ and their colors.
+    void BuildFromSortedLeaves(const std::vector<uint64_t>& leaf_codes,
+                               const std::vector<Eigen::Vector3d>& leaf_colors);
+};
+
+}  // namespace geometry
+}  // namespace open3d
@@ -27,14 +27,17 @@
 #include "open3d/geometry/PointCloud.h"
 
 #include <Eigen/Dense>
+#include <algorithm>
 #include <numeric>
 
+#include "open3d/core/kernel/ParallelUtil.h"
 #include "open3d/geometry/BoundingVolume.h"
 #include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/Qhull.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/Eigen.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
@@ -127,7 +130,7 @@ std::vector<double> PointCloud::ComputePointCloudDistance(
     std::vector<double> distances(points_.size());
     KDTreeFlann kdtree;
     kdtree.SetGeometry(target);
-#pragma omp parallel for schedule(static)
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
     for (int i = 0; i < (int)points_.size(); i++) {
         std::vector<int> indices(1);
         std::vector<double> dists(1);
@@ -183,122 +186,164 @@ std::shared_ptr<PointCloud> PointCloud::SelectByIndex(
         mask[i] = !invert;
     }
 
+    std::vector<size_t> selected;
     for (size_t i = 0; i < points_.size(); i++) {
         if (mask[i]) {
-            output->points_.push_back(points_[i]);
-            if (has_normals) output->normals_.push_back(normals_[i]);
-            if (has_colors) output->colors_.push_back(colors_[i]);
+            selected.push_back(i);
         }
     }
+    output->points_.resize(selected.size());
+    if (has_normals) output->normals_.resize(selected.size());
+    if (has_colors) output->colors_.resize(selected.size());
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int k = 0; k < int(selected.size()); k++) {
+        output->points_[k] = points_[selected[k]];
+        if (has_normals) output->normals_[k] = normals_[selected[k]];
+        if (has_colors) output->colors_[k] = colors_[selected[k]];
+    }
     utility::LogDebug(
             "Pointcloud down sampled from {:d} points to {:d} points.",
             (int)points_.size(), (int)output->points_.size());
     return output;
 }
 
-// helper classes for VoxelDownSample and VoxelDownSampleAndTrace
+// helpers for VoxelDownSample and VoxelDownSampleAndTrace
 namespace {
-class AccumulatedPoint {
-public:
-    AccumulatedPoint()
-        : num_of_points_(0),
-          point_(0.0, 0.0, 0.0),
-          normal_(0.0, 0.0, 0.0),
-          color_(0.0, 0.0, 0.0) {}
-
-public:
-    void AddPoint(const PointCloud &cloud, int index) {
-        point_ += cloud.points_[index];
-        if (cloud.HasNormals()) {
-            if (!std::isnan(cloud.normals_[index](0)) &&
-                !std::isnan(cloud.normals_[index](1)) &&
-                !std::isnan(cloud.normals_[index](2))) {
-                normal_ += cloud.normals_[index];
+
+/// Stable parallel least significant digit radix sort of \p values by \p keys,
+/// looking only at the lowest \p num_bits bits of the keys.
+void RadixSortByKey(std::vector<uint64_t> &keys,
+                    std::vector<int> &values,
+                    int num_bits) {
+    const int kDigitBits = 8;
+    const int kNumBuckets = 1 << kDigitBits;
+    const size_t n = keys.size();
+    const size_t num_chunks =
+            std::min(n, size_t(4 * core::kernel::GetMaxThreads()));
+    std::vector<uint64_t> keys_tmp(n);
+    std::vector<int> values_tmp(n);
+    std::vector<size_t> offsets(num_chunks * kNumBuckets);
+    for (int shift = 0; shift < num_bits; shift += kDigitBits) {
+        std::fill(offsets.begin(), offsets.end(), 0);
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+        for (int chunk = 0; chunk < int(num_chunks); chunk++) {
+            size_t *count = &offsets[chunk * kNumBuckets];
+            for (size_t i = n * chunk / num_chunks;
+                 i < n * (chunk + 1) / num_chunks; i++) {
+                count[(keys[i] >> shift) & (kNumBuckets - 1)]++;
+            }
+        }
+        // Scanning bucket by bucket, chunk by chunk keeps the sort stable.
+        size_t sum = 0;
+        for (int bucket = 0; bucket < kNumBuckets; bucket++) {
+            for (size_t chunk = 0; chunk < num_chunks; chunk++) {
+                size_t count = offsets[chunk * kNumBuckets + bucket];
+                offsets[chunk * kNumBuckets + bucket] = sum;
+                sum += count;
             }
         }
-        if (cloud.HasColors()) {
-            color_ += cloud.colors_[index];
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+        for (int chunk = 0; chunk < int(num_chunks); chunk++) {
+            size_t *offset = &offsets[chunk * kNumBuckets];
+            for (size_t i = n * chunk / num_chunks;
+                 i < n * (chunk + 1) / num_chunks; i++) {
+                size_t dst = offset[(keys[i] >> shift) & (kNumBuckets - 1)]++;
+                keys_tmp[dst] = keys[i];
+                values_tmp[dst] = values[i];
+            }
         }
-        num_of_points_++;
+        keys.swap(keys_tmp);
+        values.swap(values_tmp);
     }
+}
 
-    Eigen::Vector3d GetAveragePoint() const {
-        return point_ / double(num_of_points_);
+/// Groups the points by the voxel of size \p voxel_size they fall into, with
+/// voxel (0, 0, 0) starting at \p voxel_min_bound. The points of the v-th
+/// voxel are point_order[voxel_begin[v]] to point_order[voxel_begin[v + 1] - 1]
+/// in ascending index order. Voxels are ordered by their voxel index.
+void GroupPointsByVoxel(const std::vector<Eigen::Vector3d> &points,
+                        const Eigen::Vector3d &voxel_min_bound,
+                        double voxel_size,
+                        std::vector<int> &point_order,
+                        std::vector<int> &voxel_begin) {
+    const size_t n = points.size();
+    point_order.resize(n);
+    std::iota(point_order.begin(), point_order.end(), 0);
+    voxel_begin.assign(1, 0);
+    if (n == 0) {
+        return;
+    }
+
+    std::vector<Eigen::Vector3i> voxel_indices(n);
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int i = 0; i < int(n); i++) {
+        Eigen::Vector3d ref_coord = (points[i] - voxel_min_bound) / voxel_size;
+        voxel_indices[i] << int(floor(ref_coord(0))), int(floor(ref_coord(1))),
+                int(floor(ref_coord(2)));
     }
 
-    Eigen::Vector3d GetAverageNormal() const {
-        // Call NormalizeNormals() afterwards if necessary
-        return normal_ / double(num_of_points_);
+    const size_t num_chunks =
+            std::min(n, size_t(4 * core::kernel::GetMaxThreads()));
+    std::vector<Eigen::Vector3i> chunk_min(num_chunks), chunk_max(num_chunks);
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int chunk = 0; chunk < int(num_chunks); chunk++) {
+        size_t begin = n * chunk / num_chunks;
+        chunk_min[chunk] = chunk_max[chunk] = voxel_indices[begin];
+        for (size_t i = begin + 1; i < n * (chunk + 1) / num_chunks; i++) {
+            chunk_min[chunk] = chunk_min[chunk].cwiseMin(voxel_indices[i]);
+            chunk_max[chunk] = chunk_max[chunk].cwiseMax(voxel_indices[i]);
+        }
     }
-
-    Eigen::Vector3d GetAverageColor() const {
-        return color_ / double(num_of_points_);
+    Eigen::Vector3i index_min = chunk_min[0], index_max = chunk_max[0];
+    for (size_t chunk = 1; chunk < num_chunks; chunk++) {
+        index_min = index_min.cwiseMin(chunk_min[chunk]);
+        index_max = index_max.cwiseMax(chunk_max[chunk]);
     }
 
-public:
-    int num_of_points_;
-    Eigen::Vector3d point_;
-    Eigen::Vector3d normal_;
-    Eigen::Vector3d color_;
-};
-
-class point_cubic_id {
-public:
-    size_t point_id;
-    int cubic_id;
-};
-
-class AccumulatedPointForTrace : public AccumulatedPoint {
-public:
-    void AddPoint(const PointCloud &cloud,
-                  size_t index,
-                  int cubic_index,
-                  bool approximate_class) {
-        point_ += cloud.points_[index];
-        if (cloud.HasNormals()) {
-            if (!std::isnan(cloud.normals_[index](0)) &&
-                !std::isnan(cloud.normals_[index](1)) &&
-                !std::isnan(cloud.normals_[index](2))) {
-                normal_ += cloud.normals_[index];
-            }
+    // Pack the voxel index relative to index_min into a single key, using
+    // only as many bits as the extent of the cloud needs in each dimension.
+    int bits[3];
+    for (int c = 0; c < 3; c++) {
+        uint64_t extent = uint64_t(int64_t(index_max(c)) - index_min(c));
+        bits[c] = 0;
+        while (bits[c] < 64 && (extent >> bits[c]) != 0) {
+            bits[c]++;
         }
-        if (cloud.HasColors()) {
-            if (approximate_class) {
-                auto got = classes.find(int(cloud.colors_[index][0]));
-                if (got == classes.end())
-                    classes[int(cloud.colors_[index][0])] = 1;
-                else
-                    classes[int(cloud.colors_[index][0])] += 1;
-            } else {
-                color_ += cloud.colors_[index];
+    }
+    const int num_bits = bits[0] + bits[1] + bits[2];
+    if (num_bits <= 64) {
+        std::vector<uint64_t> keys(n);
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+        for (int i = 0; i < int(n); i++) {
+            uint64_t key = 0;
+            for (int c = 0; c < 3; c++) {
+                key = (key << bits[c]) |
+                      uint64_t(int64_t(voxel_indices[i](c)) - index_min(c));
             }
+            keys[i] = key;
         }
-        point_cubic_id new_id;
-        new_id.point_id = index;
-        new_id.cubic_id = cubic_index;
-        original_id.push_back(new_id);
-        num_of_points_++;
-    }
-
-    Eigen::Vector3d GetMaxClass() {
-        int max_class = -1;
-        int max_count = -1;
-        for (auto it = classes.begin(); it != classes.end(); it++) {
-            if (it->second > max_count) {
-                max_count = it->second;
-                max_class = it->first;
-            }
+        RadixSortByKey(keys, point_order, num_bits);
+    } else {
+        // The keys do not fit in 64 bits, fall back to a comparison sort.
+        std::stable_sort(point_order.begin(), point_order.end(),
+                         [&voxel_indices](int a, int b) {
+                             return std::lexicographical_compare(
+                                     voxel_indices[a].data(),
+                                     voxel_indices[a].data() + 3,
+                                     voxel_indices[b].data(),
+                                     voxel_indices[b].data() + 3);
+                         });
+    }
+
+    for (size_t k = 1; k < n; k++) {
+        if (voxel_indices[point_order[k]] !=
+            voxel_indices[point_order[k - 1]]) {
+            voxel_begin.push_back(int(k));
         }
-        return Eigen::Vector3d(max_class, max_class, max_class);
     }
+    voxel_begin.push_back(int(n));
+}
 
-    std::vector<point_cubic_id> GetOriginalID() { return original_id; }
-
-private:
-    // original point cloud id in higher resolution + its cubic id
-    std::vector<point_cubic_id> original_id;
-    std::unordered_map<int, int> classes;
-};
 }  // namespace
 
 std::shared_ptr<PointCloud> PointCloud::VoxelDownSample(
@@ -315,27 +360,44 @@ std::shared_ptr<PointCloud> PointCloud::VoxelDownSample(
         (voxel_max_bound - voxel_min_bound).maxCoeff()) {
         utility::LogError("[VoxelDownSample] voxel_size is too small.");
     }
-    std::unordered_map<Eigen::Vector3i, AccumulatedPoint,
-                       utility::hash_eigen<Eigen::Vector3i>>
-            voxelindex_to_accpoint;
+    std::vector<int> point_order, voxel_begin;
+    GroupPointsByVoxel(points_, voxel_min_bound, voxel_size, point_order,
+                       voxel_begin);
 
-    Eigen::Vector3d ref_coord;
-    Eigen::Vector3i voxel_index;
-    for (int i = 0; i < (int)points_.size(); i++) {
-        ref_coord = (points_[i] - voxel_min_bound) / voxel_size;
-        voxel_index << int(floor(ref_coord(0))), int(floor(ref_coord(1))),
-                int(floor(ref_coord(2)));
-        voxelindex_to_accpoint[voxel_index].AddPoint(*this, i);
-    }
     bool has_normals = HasNormals();
     bool has_colors = HasColors();
-    for (auto accpoint : voxelindex_to_accpoint) {
-        output->points_.push_back(accpoint.second.GetAveragePoint());
+    const int num_voxels = int(voxel_begin.size()) - 1;
+    output->points_.resize(num_voxels);
+    if (has_normals) {
+        output->normals_.resize(num_voxels);
+    }
+    if (has_colors) {
+        output->colors_.resize(num_voxels);
+    }
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int v = 0; v < num_voxels; v++) {
+        Eigen::Vector3d point(0.0, 0.0, 0.0);
+        Eigen::Vector3d normal(0.0, 0.0, 0.0);
+        Eigen::Vector3d color(0.0, 0.0, 0.0);
+        for (int k = voxel_begin[v]; k < voxel_begin[v + 1]; k++) {
+            int i = point_order[k];
+            point += points_[i];
+            if (has_normals && !normals_[i].array().isNaN().any()) {
+                normal += normals_[i];
+            }
+            if (has_colors) {
+                color += colors_[i];
+            }
+        }
+        // Normals with NaN are skipped but still count towards the average,
+        // call NormalizeNormals() afterwards if necessary.
+        double num_points = double(voxel_begin[v + 1] - voxel_begin[v]);
+        output->points_[v] = point / num_points;
         if (has_normals) {
-            output->normals_.push_back(accpoint.second.GetAverageNormal());
+            output->normals_[v] = normal / num_points;
         }
         if (has_colors) {
-            output->colors_.push_back(accpoint.second.GetAverageColor());
+            output->colors_[v] = color / num_points;
         }
     }
     utility::LogDebug(
@@ -364,51 +426,86 @@ PointCloud::VoxelDownSampleAndTrace(double voxel_size,
         (voxel_max_bound - voxel_min_bound).maxCoeff()) {
         utility::LogError("[VoxelDownSample] voxel_size is too small.");
     }
-    std::unordered_map<Eigen::Vector3i, AccumulatedPointForTrace,
-                       utility::hash_eigen<Eigen::Vector3i>>
-            voxelindex_to_accpoint;
-    int cid_temp[3] = {1, 2, 4};
-    for (size_t i = 0; i < points_.size(); i++) {
-        auto ref_coord = (points_[i] - voxel_min_bound) / voxel_size;
-        auto voxel_index = Eigen::Vector3i(int(floor(ref_coord(0))),
-                                           int(floor(ref_coord(1))),
-                                           int(floor(ref_coord(2))));
-        int cid = 0;
-        for (int c = 0; c < 3; c++) {
-            if ((ref_coord(c) - voxel_index(c)) >= 0.5) {
-                cid += cid_temp[c];
-            }
-        }
-        voxelindex_to_accpoint[voxel_index].AddPoint(*this, i, cid,
-                                                     approximate_class);
-    }
+    std::vector<int> point_order, voxel_begin;
+    GroupPointsByVoxel(points_, voxel_min_bound, voxel_size, point_order,
+                       voxel_begin);
+
     bool has_normals = HasNormals();
     bool has_colors = HasColors();
-    int cnt = 0;
-    cubic_id.resize(voxelindex_to_accpoint.size(), 8);
+    const int num_voxels = int(voxel_begin.size()) - 1;
+    output->points_.resize(num_voxels);
+    if (has_normals) {
+        output->normals_.resize(num_voxels);
+    }
+    if (has_colors) {
+        output->colors_.resize(num_voxels);
+    }
+    cubic_id.resize(num_voxels, 8);
     cubic_id.setConstant(-1);
-    std::vector<std::vector<int>> original_indices(
-            voxelindex_to_accpoint.size());
-    for (auto accpoint : voxelindex_to_accpoint) {
-        output->points_.push_back(accpoint.second.GetAveragePoint());
+    std::vector<std::vector<int>> original_indices(num_voxels);
+    const int cid_temp[3] = {1, 2, 4};
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int v = 0; v < num_voxels; v++) {
+        Eigen::Vector3d point(0.0, 0.0, 0.0);
+        Eigen::Vector3d normal(0.0, 0.0, 0.0);
+        Eigen::Vector3d color(0.0, 0.0, 0.0);
+        std::vector<int> classes;
+        original_indices[v].reserve(voxel_begin[v + 1] - voxel_begin[v]);
+        for (int k = voxel_begin[v]; k < voxel_begin[v + 1]; k++) {
+            int i = point_order[k];
+            point += points_[i];
+            if (has_normals && !normals_[i].array().isNaN().any()) {
+                normal += normals_[i];
+            }
+            if (has_colors) {
+                if (approximate_class) {
+                    classes.push_back(int(colors_[i][0]));
+                } else {
+                    color += colors_[i];
+                }
+            }
+            Eigen::Vector3d ref_coord =
+                    (points_[i] - voxel_min_bound) / voxel_size;
+            int cid = 0;
+            for (int c = 0; c < 3; c++) {
+                if ((ref_coord(c) - floor(ref_coord(c))) >= 0.5) {
+                    cid += cid_temp[c];
+                }
+            }
+            // Points are visited in ascending index order, so the last point
+            // of each sub-voxel is recorded.
+            cubic_id(v, cid) = i;
+            original_indices[v].push_back(i);
+        }
+        double num_points = double(voxel_begin[v + 1] - voxel_begin[v]);
+        output->points_[v] = point / num_points;
         if (has_normals) {
-            output->normals_.push_back(accpoint.second.GetAverageNormal());
+            output->normals_[v] = normal / num_points;
         }
         if (has_colors) {
             if (approximate_class) {
-                output->colors_.push_back(accpoint.second.GetMaxClass());
+                // Most frequent class, the smallest one on ties.
+                std::sort(classes.begin(), classes.end());
+                int max_class = -1;
+                size_t max_count = 0;
+                for (size_t begin = 0; begin < classes.size();) {
+                    size_t end = begin;
+                    while (end < classes.size() &&
+                           classes[end] == classes[begin]) {
+                        end++;
+                    }
+                    if (end - begin > max_count) {
+                        max_count = end - begin;
+                        max_class = classes[begin];
+                    }
+                    begin = end;
+                }
+                output->colors_[v] =
+                        Eigen::Vector3d(max_class, max_class, max_class);
             } else {
-                output->colors_.push_back(accpoint.second.GetAverageColor());
+                output->colors_[v] = color / num_points;
             }
         }
-        auto original_id = accpoint.second.GetOriginalID();
-        for (int i = 0; i < (int)original_id.size(); i++) {
-            size_t pid = original_id[i].point_id;
-            int cid = original_id[i].cubic_id;
-            cubic_id(cnt, cid) = int(pid);
-            original_indices[cnt].push_back(int(pid));
-        }
-        cnt++;
     }
     utility::LogDebug(
             "Pointcloud down sampled from {:d} points to {:d} points.",
@@ -456,18 +553,16 @@ PointCloud::RemoveRadiusOutliers(size_t nb_points, double search_radius) const {
     }
     KDTreeFlann kdtree;
     kdtree.SetGeometry(*this);
-    std::vector<bool> mask = std::vector<bool>(points_.size());
-#pragma omp parallel for schedule(static)
-    for (int i = 0; i < int(points_.size()); i++) {
-        std::vector<int> tmp_indices;
-        std::vector<double> dist;
-        size_t nb_neighbors = kdtree.SearchRadius(points_[i], search_radius,
-                                                  tmp_indices, dist);
-        mask[i] = (nb_neighbors > nb_points);
-    }
+    // Only whether a point has more than nb_points neighbors matters, so the
+    // search stops after nb_points + 1 of them instead of keeping them all.
+    KDTreeSearchResult neighbors;
+    kdtree.SearchBatch(points_,
+                       KDTreeSearchParamHybrid(search_radius,
+                                               int(nb_points) + 1),
+                       neighbors);
     std::vector<size_t> indices;
-    for (size_t i = 0; i < mask.size(); i++) {
-        if (mask[i]) {
+    for (size_t i = 0; i < points_.size(); i++) {
+        if (size_t(neighbors.NumNeighbors(i)) > nb_points) {
             indices.push_back(i);
         }
     }
@@ -492,17 +587,22 @@ PointCloud::RemoveStatisticalOutliers(size_t nb_neighbors,
     std::vector<size_t> indices;
     size_t valid_distances = 0;
 
-#pragma omp parallel for schedule(static)
+    KDTreeSearchResult neighbors;
+    kdtree.SearchBatch(points_, KDTreeSearchParamKNN(int(nb_neighbors)),
+                       neighbors);
+
+#pragma omp parallel for schedule(static) reduction(+ : valid_distances) num_threads(utility::EstimateMaxThreads())
     for (int i = 0; i < int(points_.size()); i++) {
-        std::vector<int> tmp_indices;
-        std::vector<double> dist;
-        kdtree.SearchKNN(points_[i], int(nb_neighbors), tmp_indices, dist);
+        const int num_dists = neighbors.NumNeighbors(i);
+        const double *dist = neighbors.Distance2(i);
         double mean = -1.0;
-        if (dist.size() > 0u) {
+        if (num_dists > 0) {
             valid_distances++;
-            std::for_each(dist.begin(), dist.end(),
-                          [](double &d) { d = std::sqrt(d); });
-            mean = std::accumulate(dist.begin(), dist.end(), 0.0) / dist.size();
+            mean = std::accumulate(dist, dist + num_dists, 0.0,
+                                   [](double sum, double d) {
+                                       return sum + std::sqrt(d);
+                                   }) /
+                   num_dists;
         }
         avg_distances[i] = mean;
     }
@@ -548,7 +648,7 @@ std::vector<double> PointCloud::ComputeMahalanobisDistance() const {
     Eigen::Matrix3d covariance;
     std::tie(mean, covariance) = ComputeMeanAndCovariance();
     Eigen::Matrix3d cov_inv = covariance.inverse();
-#pragma omp parallel for schedule(static)
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
     for (int i = 0; i < (int)points_.size(); i++) {
         Eigen::Vector3d p = points_[i] - mean;
         mahalanobis[i] = std::sqrt(p.transpose() * cov_inv * p);
@@ -563,7 +663,7 @@ std::vector<double> PointCloud::ComputeNearestNeighborDistance() const {
 
     std::vector<double> nn_dis(points_.size());
     KDTreeFlann kdtree(*this);
-#pragma omp parallel for schedule(static)
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
     for (int i = 0; i < (int)points_.size(); i++) {
         std::vector<int> indices(2);
         std::vector<double> dists(2);
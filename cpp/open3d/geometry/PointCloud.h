@@ -32,6 +32,7 @@
 #include <vector>
 
 #include "open3d/geometry/Geometry3D.h"
+#include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/KDTreeSearchParam.h"
 
 namespace open3d {
@@ -206,9 +207,12 @@ public:
     /// search. \param fast_normal_computation If true, the normal estiamtion
     /// uses a non-iterative method to extract the eigenvector from the
     /// covariance matrix. This is faster, but is not as numerical stable.
+    /// \param precision Scalar type of the KDTree used for the neighborhood
+    /// search. Float32 halves the memory of the tree for large point clouds.
     void EstimateNormals(
             const KDTreeSearchParam &search_param = KDTreeSearchParamKNN(),
-            bool fast_normal_computation = true);
+            bool fast_normal_computation = true,
+            KDTreeFlann::Precision precision = KDTreeFlann::Precision::Float64);
 
     /// \brief Function to orient the normals of a point cloud.
     ///
@@ -281,6 +285,10 @@ public:
     /// Returns a list of point labels, -1 indicates noise according to
     /// the algorithm.
     ///
+    /// The points are bucketed in a grid of cells of side eps / sqrt(3), and
+    /// the clusters are merged with a union-find in parallel, so the memory
+    /// does not depend on the size of the neighbourhoods.
+    ///
     /// \param eps Density parameter that is used to find neighbouring points.
     /// \param min_points Minimum number of points to form a cluster.
     /// \param print_progress If `true` the progress is visualized in the
@@ -291,17 +299,48 @@ public:
 
     /// \brief Segment PointCloud plane using the RANSAC algorithm.
     ///
+    /// The hypotheses are evaluated in parallel, and the iterations stop early
+    /// once the best plane was sampled with the given \p probability.
+    ///
     /// \param distance_threshold Max distance a point can be from the plane
     /// model, and still be considered an inlier.
     /// \param ransac_n Number of initial points to be considered inliers in
     /// each iteration.
-    /// \param num_iterations Number of iterations.
+    /// \param num_iterations Maximum number of iterations.
+    /// \param probability Expected probability of finding the optimal plane.
     /// \return Returns the plane model ax + by + cz + d = 0 and the indices of
     /// the plane inliers.
     std::tuple<Eigen::Vector4d, std::vector<size_t>> SegmentPlane(
             const double distance_threshold = 0.01,
             const int ransac_n = 3,
-            const int num_iterations = 100) const;
+            const int num_iterations = 100,
+            const double probability = 0.99999999) const;
+
+    /// \brief Segment up to \p max_planes planes using the RANSAC algorithm.
+    ///
+    /// The planes are segmented one after the other as with SegmentPlane(),
+    /// each among the points that are not inliers of the previous planes.
+    /// The inliers are excluded by their indices, without copying the point
+    /// cloud.
+    ///
+    /// \param max_planes Maximum number of planes.
+    /// \param distance_threshold Max distance a point can be from the plane
+    /// model, and still be considered an inlier.
+    /// \param ransac_n Number of initial points to be considered inliers in
+    /// each iteration.
+    /// \param num_iterations Maximum number of iterations for each plane.
+    /// \param min_num_inliers The segmentation stops at the first plane with
+    /// fewer inliers.
+    /// \param probability Expected probability of finding the optimal plane.
+    /// \return Returns the plane models ax + by + cz + d = 0 and the indices
+    /// of their inliers, in the order they were found.
+    std::vector<std::tuple<Eigen::Vector4d, std::vector<size_t>>>
+    SegmentPlanes(const int max_planes,
+                  const double distance_threshold = 0.01,
+                  const int ransac_n = 3,
+                  const int num_iterations = 100,
+                  const size_t min_num_inliers = 3,
+                  const double probability = 0.99999999) const;
 
     /// \brief Factory function to create a pointcloud from a depth image and a
     /// camera model.
@@ -25,82 +25,227 @@
 // ----------------------------------------------------------------------------
 
 #include <Eigen/Dense>
-#include <unordered_set>
+#include <algorithm>
+#include <cmath>
 
-#include "open3d/geometry/KDTreeFlann.h"
+#include "open3d/geometry/ConcurrentUnionFind.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
 
+namespace {
+
+using Cell = Eigen::Matrix<int64_t, 3, 1>;
+
+bool LessCell(const Cell &a, const Cell &b) {
+    return std::lexicographical_compare(a.data(), a.data() + 3, b.data(),
+                                        b.data() + 3);
+}
+
+}  // namespace
+
 std::vector<int> PointCloud::ClusterDBSCAN(double eps,
                                            size_t min_points,
                                            bool print_progress) const {
-    KDTreeFlann kdtree(*this);
-
-    // precompute all neighbours
-    utility::LogDebug("Precompute Neighbours");
-    utility::ConsoleProgressBar progress_bar(
-            points_.size(), "Precompute Neighbours", print_progress);
-    std::vector<std::vector<int>> nbs(points_.size());
-#pragma omp parallel for schedule(static)
-    for (int idx = 0; idx < int(points_.size()); ++idx) {
-        std::vector<double> dists2;
-        kdtree.SearchRadius(points_[idx], eps, nbs[idx], dists2);
+    if (eps <= 0) {
+        utility::LogError("[ClusterDBSCAN] eps must be positive.");
+    }
+    const int num_points = int(points_.size());
+    std::vector<int> labels(num_points, -1);
+    if (num_points == 0) {
+        return labels;
+    }
+    const double eps2 = eps * eps;
 
-#pragma omp critical
-        { ++progress_bar; }
+    // Sort the points into cells of side eps / sqrt(3), so that any two
+    // points of a cell are neighbours. Only the points and the cells are
+    // stored instead of the neighbourhoods of all points.
+    utility::LogDebug("Compute Cells");
+    const double cell_size = eps / std::sqrt(3.0);
+    const Eigen::Vector3d min_bound = GetMinBound();
+    auto ToCell = [&](const Eigen::Vector3d &p) -> Cell {
+        return ((p - min_bound) / cell_size).array().floor().cast<int64_t>();
+    };
+    std::vector<int> order(num_points);
+    for (int i = 0; i < num_points; ++i) {
+        order[i] = i;
     }
-    utility::LogDebug("Done Precompute Neighbours");
+    std::vector<Cell> point_cells(num_points);
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int i = 0; i < num_points; ++i) {
+        point_cells[i] = ToCell(points_[i]);
+    }
+    std::stable_sort(order.begin(), order.end(), [&](int a, int b) {
+        return LessCell(point_cells[a], point_cells[b]);
+    });
 
-    // set all labels to undefined (-2)
-    utility::LogDebug("Compute Clusters");
-    progress_bar.reset(points_.size(), "Clustering", print_progress);
-    std::vector<int> labels(points_.size(), -2);
-    int cluster_label = 0;
-    for (size_t idx = 0; idx < points_.size(); ++idx) {
-        if (labels[idx] != -2) {  // label is not undefined
-            continue;
+    // The points of cell c are order[cell_begin[c], cell_begin[c + 1]), and
+    // the cells are sorted lexicographically.
+    std::vector<int> cell_begin;
+    std::vector<Cell> cells;
+    for (int i = 0; i < num_points; ++i) {
+        const Cell &cell = point_cells[order[i]];
+        if (cells.empty() || cells.back() != cell) {
+            cells.push_back(cell);
+            cell_begin.push_back(i);
         }
+    }
+    cell_begin.push_back(num_points);
+    point_cells.clear();
+    point_cells.shrink_to_fit();
+    const int num_cells = int(cells.size());
 
-        // check density
-        if (nbs[idx].size() < min_points) {
-            labels[idx] = -1;
-            continue;
+    // Returns the other cells that may contain neighbours, i.e. the cells
+    // within two cells whose closest points are nearer than eps. The cells
+    // with the same x and y are contiguous, so each of the 25 columns is
+    // found by a binary search.
+    auto NeighbourCells = [&](int c) {
+        std::vector<int> neighbours;
+        for (int64_t dx = -2; dx <= 2; ++dx) {
+            for (int64_t dy = -2; dy <= 2; ++dy) {
+                const Cell first = cells[c] + Cell(dx, dy, -2);
+                auto it = std::lower_bound(cells.begin(), cells.end(), first,
+                                           LessCell);
+                for (; it != cells.end() && (*it)(0) == first(0) &&
+                       (*it)(1) == first(1) && (*it)(2) <= cells[c](2) + 2;
+                     ++it) {
+                    const Cell gap =
+                            (*it - cells[c]).cwiseAbs().array().max(1) - 1;
+                    if (*it != cells[c] && gap.squaredNorm() < 3) {
+                        neighbours.push_back(int(it - cells.begin()));
+                    }
+                }
+            }
         }
+        return neighbours;
+    };
 
-        std::unordered_set<int> nbs_next(nbs[idx].begin(), nbs[idx].end());
-        std::unordered_set<int> nbs_visited;
-        nbs_visited.insert(int(idx));
-
-        labels[idx] = cluster_label;
-        ++progress_bar;
-        while (!nbs_next.empty()) {
-            int nb = *nbs_next.begin();
-            nbs_next.erase(nbs_next.begin());
-            nbs_visited.insert(nb);
-
-            if (labels[nb] == -1) {  // noise label
-                labels[nb] = cluster_label;
-                ++progress_bar;
+    // A point is a core point if it has at least min_points neighbours,
+    // including itself. The points of the cells with at least min_points
+    // points are core points without looking at the other cells.
+    utility::LogDebug("Compute Core Points");
+    utility::ConsoleProgressBar progress_bar(num_cells, "Find core points",
+                                             print_progress);
+    std::vector<char> is_core(num_points, 0);
+#pragma omp parallel for schedule(dynamic, 64) num_threads(utility::EstimateMaxThreads())
+    for (int c = 0; c < num_cells; ++c) {
+        const size_t cell_count = size_t(cell_begin[c + 1] - cell_begin[c]);
+        if (cell_count >= min_points) {
+            for (int i = cell_begin[c]; i < cell_begin[c + 1]; ++i) {
+                is_core[order[i]] = 1;
             }
-            if (labels[nb] != -2) {  // not undefined label
-                continue;
+        } else {
+            const std::vector<int> neighbours = NeighbourCells(c);
+            for (int i = cell_begin[c]; i < cell_begin[c + 1]; ++i) {
+                const Eigen::Vector3d &p = points_[order[i]];
+                size_t count = cell_count;
+                for (auto n = neighbours.begin();
+                     n != neighbours.end() && count < min_points; ++n) {
+                    for (int j = cell_begin[*n];
+                         j < cell_begin[*n + 1] && count < min_points; ++j) {
+                        if ((points_[order[j]] - p).squaredNorm() < eps2) {
+                            ++count;
+                        }
+                    }
+                }
+                is_core[order[i]] = count >= min_points;
             }
-            labels[nb] = cluster_label;
-            ++progress_bar;
+        }
+#pragma omp critical
+        { ++progress_bar; }
+    }
 
-            if (nbs[nb].size() >= min_points) {
-                for (int qnb : nbs[nb]) {
-                    if (nbs_visited.count(qnb) == 0) {
-                        nbs_next.insert(qnb);
+    // Core points of the same cell are connected. Neighbouring cells are
+    // connected if any pair of their core points are neighbours.
+    utility::LogDebug("Connect Core Points");
+    progress_bar.reset(num_cells, "Connect core points", print_progress);
+    ConcurrentUnionFind union_find(num_points);
+    std::vector<int> cell_core(num_cells, -1);
+    for (int c = 0; c < num_cells; ++c) {
+        for (int i = cell_begin[c]; i < cell_begin[c + 1]; ++i) {
+            if (is_core[order[i]]) {
+                if (cell_core[c] < 0) {
+                    cell_core[c] = order[i];
+                } else {
+                    union_find.Union(cell_core[c], order[i]);
+                }
+            }
+        }
+    }
+#pragma omp parallel for schedule(dynamic, 64) num_threads(utility::EstimateMaxThreads())
+    for (int c = 0; c < num_cells; ++c) {
+        if (cell_core[c] >= 0) {
+            for (int n : NeighbourCells(c)) {
+                // Each pair of cells is checked once.
+                if (n < c || cell_core[n] < 0 ||
+                    union_find.Find(cell_core[c]) ==
+                            union_find.Find(cell_core[n])) {
+                    continue;
+                }
+                bool connected = false;
+                for (int i = cell_begin[c]; i < cell_begin[c + 1] && !connected;
+                     ++i) {
+                    if (!is_core[order[i]]) continue;
+                    const Eigen::Vector3d &p = points_[order[i]];
+                    for (int j = cell_begin[n];
+                         j < cell_begin[n + 1] && !connected; ++j) {
+                        connected = is_core[order[j]] &&
+                                    (points_[order[j]] - p).squaredNorm() <
+                                            eps2;
                     }
                 }
+                if (connected) {
+                    union_find.Union(cell_core[c], cell_core[n]);
+                }
             }
         }
+#pragma omp critical
+        { ++progress_bar; }
+    }
 
-        cluster_label++;
+    // Clusters are numbered by their smallest core point, and border points
+    // join the cluster with the smallest label among their neighbouring core
+    // points, as in the sequential expansion of the clusters.
+    utility::LogDebug("Label Points");
+    int cluster_label = 0;
+    std::vector<int> root_label(num_points, -1);
+    for (int i = 0; i < num_points; ++i) {
+        if (is_core[i]) {
+            const int root = union_find.Find(i);
+            if (root_label[root] < 0) {
+                root_label[root] = cluster_label++;
+            }
+            labels[i] = root_label[root];
+        }
+    }
+#pragma omp parallel for schedule(dynamic, 64) num_threads(utility::EstimateMaxThreads())
+    for (int c = 0; c < num_cells; ++c) {
+        std::vector<int> neighbours;
+        bool has_neighbours = false;
+        for (int i = cell_begin[c]; i < cell_begin[c + 1]; ++i) {
+            const int idx = order[i];
+            if (is_core[idx]) continue;
+            if (!has_neighbours) {
+                neighbours = NeighbourCells(c);
+                neighbours.push_back(c);
+                has_neighbours = true;
+            }
+            const Eigen::Vector3d &p = points_[idx];
+            int label = -1;
+            for (int n : neighbours) {
+                for (int j = cell_begin[n]; j < cell_begin[n + 1]; ++j) {
+                    const int nb = order[j];
+                    if (is_core[nb] && (label < 0 || labels[nb] < label) &&
+                        (points_[nb] - p).squaredNorm() < eps2) {
+                        label = labels[nb];
+                    }
+                }
+            }
+            labels[idx] = label;
+        }
     }
 
     utility::LogDebug("Done Compute Clusters: {:d}", cluster_label);
@@ -26,176 +26,283 @@
 
 #include <Eigen/Dense>
 #include <limits>
+#include <numeric>
+#include <vector>
 
 #include "open3d/camera/PinholeCameraIntrinsic.h"
+#include "open3d/geometry/DepthToPointCloudConverter.h"
 #include "open3d/geometry/Image.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/RGBDImage.h"
 #include "open3d/geometry/VoxelGrid.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 
 namespace {
 using namespace geometry;
 
-int CountValidDepthPixels(const Image &depth, int stride) {
-    int num_valid_pixels = 0;
-    for (int i = 0; i < depth.height_; i += stride) {
-        for (int j = 0; j < depth.width_; j += stride) {
-            const float *p = depth.PointerAt<float>(j, i);
-            if (*p > 0) num_valid_pixels += 1;
+// Writes the points of the sampled pixels of a depth image in parallel. The
+// number of points of each sampled row is counted first, so that each row
+// knows the index of its first point. GetDepth(u, v) returns the depth of a
+// pixel, 0 if it is invalid, and SetColor(u, v, index, valid) writes the
+// color of a point.
+template <typename GetDepthFunc, typename SetColorFunc>
+void ProjectDepthPixels(const std::vector<double> &ray_x,
+                        const std::vector<double> &ray_y,
+                        int stride,
+                        const Eigen::Matrix4d &extrinsic,
+                        bool project_valid_depth_only,
+                        GetDepthFunc GetDepth,
+                        SetColorFunc SetColor,
+                        std::vector<int> &row_offsets,
+                        PointCloud &pointcloud,
+                        bool has_colors) {
+    const int rows = int(ray_y.size());
+    const int cols = int(ray_x.size());
+    row_offsets.resize(rows + 1);
+    row_offsets[0] = 0;
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int r = 0; r < rows; r++) {
+        int count = cols;
+        if (project_valid_depth_only) {
+            count = 0;
+            for (int c = 0; c < cols; c++) {
+                if (GetDepth(c * stride, r * stride) > 0) count++;
+            }
         }
+        row_offsets[r + 1] = count;
     }
-    return num_valid_pixels;
-}
+    std::partial_sum(row_offsets.begin(), row_offsets.end(),
+                     row_offsets.begin());
 
-std::shared_ptr<PointCloud> CreatePointCloudFromFloatDepthImage(
-        const Image &depth,
-        const camera::PinholeCameraIntrinsic &intrinsic,
-        const Eigen::Matrix4d &extrinsic,
-        int stride,
-        bool project_valid_depth_only) {
-    auto pointcloud = std::make_shared<PointCloud>();
-    Eigen::Matrix4d camera_pose = extrinsic.inverse();
-    auto focal_length = intrinsic.GetFocalLength();
-    auto principal_point = intrinsic.GetPrincipalPoint();
-    int num_valid_pixels;
-    if (!project_valid_depth_only) {
-        num_valid_pixels =
-                int(depth.height_ / stride) * int(depth.width_ / stride);
+    // Reserving the whole image keeps the buffers from being reallocated in
+    // the next conversions.
+    const size_t num_points = size_t(row_offsets[rows]);
+    pointcloud.points_.reserve(size_t(rows) * size_t(cols));
+    pointcloud.points_.resize(num_points);
+    pointcloud.normals_.clear();
+    if (has_colors) {
+        pointcloud.colors_.reserve(size_t(rows) * size_t(cols));
+        pointcloud.colors_.resize(num_points);
     } else {
-        num_valid_pixels = CountValidDepthPixels(depth, stride);
+        pointcloud.colors_.clear();
     }
-    pointcloud->points_.resize(num_valid_pixels);
-    int cnt = 0;
-    for (int i = 0; i < depth.height_; i += stride) {
-        for (int j = 0; j < depth.width_; j += stride) {
-            const float *p = depth.PointerAt<float>(j, i);
-            if (*p > 0) {
-                double z = (double)(*p);
-                double x = (j - principal_point.first) * z / focal_length.first;
-                double y =
-                        (i - principal_point.second) * z / focal_length.second;
-                Eigen::Vector4d point =
-                        camera_pose * Eigen::Vector4d(x, y, z, 1.0);
-                pointcloud->points_[cnt++] = point.block<3, 1>(0, 0);
+
+    const Eigen::Matrix4d camera_pose = extrinsic.inverse();
+    const Eigen::Matrix3d rotation = camera_pose.block<3, 3>(0, 0);
+    const Eigen::Vector3d translation = camera_pose.block<3, 1>(0, 3);
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int r = 0; r < rows; r++) {
+        int idx = row_offsets[r];
+        for (int c = 0; c < cols; c++) {
+            float d = GetDepth(c * stride, r * stride);
+            if (d > 0) {
+                double z = double(d);
+                pointcloud.points_[idx] =
+                        rotation * Eigen::Vector3d(ray_x[c] * z, ray_y[r] * z,
+                                                   z) +
+                        translation;
+                SetColor(c * stride, r * stride, idx++, true);
             } else if (!project_valid_depth_only) {
-                double z = std::numeric_limits<float>::quiet_NaN();
-                double x = std::numeric_limits<float>::quiet_NaN();
-                double y = std::numeric_limits<float>::quiet_NaN();
-                pointcloud->points_[cnt++] = Eigen::Vector3d(x, y, z);
+                pointcloud.points_[idx] = Eigen::Vector3d(nan, nan, nan);
+                SetColor(c * stride, r * stride, idx++, false);
             }
         }
     }
-    return pointcloud;
 }
 
 template <typename TC, int NC>
-std::shared_ptr<PointCloud> CreatePointCloudFromRGBDImageT(
-        const RGBDImage &image,
-        const camera::PinholeCameraIntrinsic &intrinsic,
-        const Eigen::Matrix4d &extrinsic,
-        bool project_valid_depth_only) {
-    auto pointcloud = std::make_shared<PointCloud>();
-    Eigen::Matrix4d camera_pose = extrinsic.inverse();
+void ProjectRGBDPixels(const RGBDImage &image,
+                       const std::vector<double> &ray_x,
+                       const std::vector<double> &ray_y,
+                       int stride,
+                       const Eigen::Matrix4d &extrinsic,
+                       bool project_valid_depth_only,
+                       std::vector<int> &row_offsets,
+                       PointCloud &pointcloud) {
+    const double scale = (sizeof(TC) == 1) ? 255.0 : 1.0;
+    const uint8_t *color_data = image.color_.data_.data();
+    const int color_bytes_per_line = image.color_.BytesPerLine();
+    auto GetDepth = [&](int u, int v) {
+        return *image.depth_.PointerAt<float>(u, v);
+    };
+    auto SetColor = [&](int u, int v, int idx, bool valid) {
+        if (valid) {
+            const TC *pc = reinterpret_cast<const TC *>(
+                                   color_data + v * color_bytes_per_line) +
+                           u * NC;
+            pointcloud.colors_[idx] =
+                    Eigen::Vector3d(pc[0], pc[(NC - 1) / 2], pc[NC - 1]) /
+                    scale;
+        } else {
+            pointcloud.colors_[idx] =
+                    Eigen::Vector3d(std::numeric_limits<TC>::quiet_NaN(),
+                                    std::numeric_limits<TC>::quiet_NaN(),
+                                    std::numeric_limits<TC>::quiet_NaN());
+        }
+    };
+    ProjectDepthPixels(ray_x, ray_y, stride, extrinsic,
+                       project_valid_depth_only, GetDepth, SetColor,
+                       row_offsets, pointcloud, true);
+}
+
+}  // unnamed namespace
+
+namespace geometry {
+
+DepthToPointCloudConverter::DepthToPointCloudConverter(
+        const camera::PinholeCameraIntrinsic &intrinsic, int stride)
+    : width_(intrinsic.width_),
+      height_(intrinsic.height_),
+      stride_(stride) {
+    if (stride <= 0) {
+        utility::LogError(
+                "[DepthToPointCloudConverter] stride must be positive, but "
+                "got {}.",
+                stride);
+    }
     auto focal_length = intrinsic.GetFocalLength();
     auto principal_point = intrinsic.GetPrincipalPoint();
-    double scale = (sizeof(TC) == 1) ? 255.0 : 1.0;
-    int num_valid_pixels;
-    if (!project_valid_depth_only) {
-        num_valid_pixels = image.depth_.height_ * image.depth_.width_;
-    } else {
-        num_valid_pixels = CountValidDepthPixels(image.depth_, 1);
+    for (int u = 0; u < width_; u += stride_) {
+        ray_x_.push_back((u - principal_point.first) / focal_length.first);
     }
-    pointcloud->points_.resize(num_valid_pixels);
-    pointcloud->colors_.resize(num_valid_pixels);
-    int cnt = 0;
-    for (int i = 0; i < image.depth_.height_; i++) {
-        float *p = (float *)(image.depth_.data_.data() +
-                             i * image.depth_.BytesPerLine());
-        TC *pc = (TC *)(image.color_.data_.data() +
-                        i * image.color_.BytesPerLine());
-        for (int j = 0; j < image.depth_.width_; j++, p++, pc += NC) {
-            if (*p > 0) {
-                double z = (double)(*p);
-                double x = (j - principal_point.first) * z / focal_length.first;
-                double y =
-                        (i - principal_point.second) * z / focal_length.second;
-                Eigen::Vector4d point =
-                        camera_pose * Eigen::Vector4d(x, y, z, 1.0);
-                pointcloud->points_[cnt] = point.block<3, 1>(0, 0);
-                pointcloud->colors_[cnt++] =
-                        Eigen::Vector3d(pc[0], pc[(NC - 1) / 2], pc[NC - 1]) /
-                        scale;
-            } else if (!project_valid_depth_only) {
-                double z = std::numeric_limits<float>::quiet_NaN();
-                double x = std::numeric_limits<float>::quiet_NaN();
-                double y = std::numeric_limits<float>::quiet_NaN();
-                pointcloud->points_[cnt] = Eigen::Vector3d(x, y, z);
-                pointcloud->colors_[cnt++] =
-                        Eigen::Vector3d(std::numeric_limits<TC>::quiet_NaN(),
-                                        std::numeric_limits<TC>::quiet_NaN(),
-                                        std::numeric_limits<TC>::quiet_NaN());
-            }
-        }
+    for (int v = 0; v < height_; v += stride_) {
+        ray_y_.push_back((v - principal_point.second) / focal_length.second);
     }
-    return pointcloud;
 }
 
-}  // unnamed namespace
+void DepthToPointCloudConverter::CheckImageSize(const Image &image,
+                                                const char *function) const {
+    if (image.width_ != width_ || image.height_ != height_) {
+        utility::LogError(
+                "[{}] Image size {}x{} does not match the intrinsics size "
+                "{}x{}.",
+                function, image.width_, image.height_, width_, height_);
+    }
+}
 
-namespace geometry {
-std::shared_ptr<PointCloud> PointCloud::CreateFromDepthImage(
+void DepthToPointCloudConverter::ConvertDepthImage(
         const Image &depth,
-        const camera::PinholeCameraIntrinsic &intrinsic,
+        PointCloud &pointcloud,
         const Eigen::Matrix4d &extrinsic /* = Eigen::Matrix4d::Identity()*/,
         double depth_scale /* = 1000.0*/,
         double depth_trunc /* = 1000.0*/,
-        int stride /* = 1*/,
-        bool project_valid_depth_only) {
-    if (depth.num_of_channels_ == 1) {
-        if (depth.bytes_per_channel_ == 2) {
-            auto float_depth =
-                    depth.ConvertDepthToFloatImage(depth_scale, depth_trunc);
-            return CreatePointCloudFromFloatDepthImage(
-                    *float_depth, intrinsic, extrinsic, stride,
-                    project_valid_depth_only);
-        } else if (depth.bytes_per_channel_ == 4) {
-            return CreatePointCloudFromFloatDepthImage(
-                    depth, intrinsic, extrinsic, stride,
-                    project_valid_depth_only);
-        }
+        bool project_valid_depth_only /* = true*/) {
+    CheckImageSize(depth, "ConvertDepthImage");
+    auto SetColor = [](int, int, int, bool) {};
+    if (depth.num_of_channels_ == 1 && depth.bytes_per_channel_ == 2) {
+        // Same conversion as Image::ConvertDepthToFloatImage, without the
+        // intermediate image.
+        const float scale = float(depth_scale);
+        auto GetDepth = [&](int u, int v) {
+            float d = float(*depth.PointerAt<uint16_t>(u, v)) / scale;
+            return d >= depth_trunc ? 0.0f : d;
+        };
+        ProjectDepthPixels(ray_x_, ray_y_, stride_, extrinsic,
+                           project_valid_depth_only, GetDepth, SetColor,
+                           row_offsets_, pointcloud, false);
+    } else if (depth.num_of_channels_ == 1 && depth.bytes_per_channel_ == 4) {
+        auto GetDepth = [&](int u, int v) {
+            return *depth.PointerAt<float>(u, v);
+        };
+        ProjectDepthPixels(ray_x_, ray_y_, stride_, extrinsic,
+                           project_valid_depth_only, GetDepth, SetColor,
+                           row_offsets_, pointcloud, false);
+    } else {
+        utility::LogError(
+                "[CreatePointCloudFromDepthImage] Unsupported image format.");
     }
-    utility::LogError(
-            "[CreatePointCloudFromDepthImage] Unsupported image format.");
-    return std::make_shared<PointCloud>();
 }
 
-std::shared_ptr<PointCloud> PointCloud::CreateFromRGBDImage(
+void DepthToPointCloudConverter::ConvertRGBDImage(
         const RGBDImage &image,
-        const camera::PinholeCameraIntrinsic &intrinsic,
+        PointCloud &pointcloud,
         const Eigen::Matrix4d &extrinsic /* = Eigen::Matrix4d::Identity()*/,
-        bool project_valid_depth_only) {
+        bool project_valid_depth_only /* = true*/) {
+    CheckImageSize(image.depth_, "ConvertRGBDImage");
+    CheckImageSize(image.color_, "ConvertRGBDImage");
     if (image.depth_.num_of_channels_ == 1 &&
         image.depth_.bytes_per_channel_ == 4) {
         if (image.color_.bytes_per_channel_ == 1 &&
             image.color_.num_of_channels_ == 3) {
-            return CreatePointCloudFromRGBDImageT<uint8_t, 3>(
-                    image, intrinsic, extrinsic, project_valid_depth_only);
+            return ProjectRGBDPixels<uint8_t, 3>(
+                    image, ray_x_, ray_y_, stride_, extrinsic,
+                    project_valid_depth_only, row_offsets_, pointcloud);
         } else if (image.color_.bytes_per_channel_ == 1 &&
                    image.color_.num_of_channels_ == 4) {
-            return CreatePointCloudFromRGBDImageT<uint8_t, 4>(
-                    image, intrinsic, extrinsic, project_valid_depth_only);
+            return ProjectRGBDPixels<uint8_t, 4>(
+                    image, ray_x_, ray_y_, stride_, extrinsic,
+                    project_valid_depth_only, row_offsets_, pointcloud);
         } else if (image.color_.bytes_per_channel_ == 4 &&
                    image.color_.num_of_channels_ == 1) {
-            return CreatePointCloudFromRGBDImageT<float, 1>(
-                    image, intrinsic, extrinsic, project_valid_depth_only);
+            return ProjectRGBDPixels<float, 1>(
+                    image, ray_x_, ray_y_, stride_, extrinsic,
+                    project_valid_depth_only, row_offsets_, pointcloud);
         }
     }
     utility::LogError(
             "[CreatePointCloudFromRGBDImage] Unsupported image format.");
-    return std::make_shared<PointCloud>();
+}
+
+std::shared_ptr<PointCloud> DepthToPointCloudConverter::CreateFromDepthImage(
+        const Image &depth,
+        const Eigen::Matrix4d &extrinsic /* = Eigen::Matrix4d::Identity()*/,
+        double depth_scale /* = 1000.0*/,
+        double depth_trunc /* = 1000.0*/,
+        bool project_valid_depth_only /* = true*/) {
+    auto pointcloud = std::make_shared<PointCloud>();
+    ConvertDepthImage(depth, *pointcloud, extrinsic, depth_scale, depth_trunc,
+                      project_valid_depth_only);
+    return pointcloud;
+}
+
+std::shared_ptr<PointCloud> DepthToPointCloudConverter::CreateFromRGBDImage(
+        const RGBDImage &image,
+        const Eigen::Matrix4d &extrinsic /* = Eigen::Matrix4d::Identity()*/,
+        bool project_valid_depth_only /* = true*/) {
+    auto pointcloud = std::make_shared<PointCloud>();
+    ConvertRGBDImage(image, *pointcloud, extrinsic, project_valid_depth_only);
+    return pointcloud;
+}
+
+std::shared_ptr<PointCloud> PointCloud::CreateFromDepthImage(
+        const Image &depth,
+        const camera::PinholeCameraIntrinsic &intrinsic,
+        const Eigen::Matrix4d &extrinsic /* = Eigen::Matrix4d::Identity()*/,
+        double depth_scale /* = 1000.0*/,
+        double depth_trunc /* = 1000.0*/,
+        int stride /* = 1*/,
+        bool project_valid_depth_only) {
+    // The intrinsics are only used for the focal length and principal point.
+    auto focal_length = intrinsic.GetFocalLength();
+    auto principal_point = intrinsic.GetPrincipalPoint();
+    DepthToPointCloudConverter converter(
+            camera::PinholeCameraIntrinsic(
+                    depth.width_, depth.height_, focal_length.first,
+                    focal_length.second, principal_point.first,
+                    principal_point.second),
+            stride);
+    return converter.CreateFromDepthImage(depth, extrinsic, depth_scale,
+                                          depth_trunc,
+                                          project_valid_depth_only);
+}
+
+std::shared_ptr<PointCloud> PointCloud::CreateFromRGBDImage(
+        const RGBDImage &image,
+        const camera::PinholeCameraIntrinsic &intrinsic,
+        const Eigen::Matrix4d &extrinsic /* = Eigen::Matrix4d::Identity()*/,
+        bool project_valid_depth_only) {
+    auto focal_length = intrinsic.GetFocalLength();
+    auto principal_point = intrinsic.GetPrincipalPoint();
+    DepthToPointCloudConverter converter(camera::PinholeCameraIntrinsic(
+            image.depth_.width_, image.depth_.height_, focal_length.first,
+            focal_length.second, principal_point.first,
+            principal_point.second));
+    return converter.CreateFromRGBDImage(image, extrinsic,
+                                         project_valid_depth_only);
 }
 
 std::shared_ptr<PointCloud> PointCloud::CreateFromVoxelGrid(
@@ -26,7 +26,9 @@
 
 #include <Eigen/Dense>
 #include <algorithm>
+#include <cmath>
 #include <iterator>
+#include <limits>
 #include <numeric>
 #include <random>
 #include <unordered_set>
@@ -34,6 +36,7 @@
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
@@ -51,34 +54,34 @@ public:
     double inlier_rmse_;
 };
 
-// Calculates the number of inliers given a list of points and a plane model,
-// and the total distance between the inliers and the plane. These numbers are
-// then used to evaluate how well the plane model fits the given points.
+// Calculates the number of inliers among the candidate points given a plane
+// model, and the total distance between the inliers and the plane. These
+// numbers are then used to evaluate how well the plane model fits the given
+// points.
 RANSACResult EvaluateRANSACBasedOnDistance(
         const std::vector<Eigen::Vector3d> &points,
+        const std::vector<size_t> &candidates,
         const Eigen::Vector4d plane_model,
-        std::vector<size_t> &inliers,
-        double distance_threshold,
-        double error) {
+        double distance_threshold) {
     RANSACResult result;
-
-    for (size_t idx = 0; idx < points.size(); ++idx) {
+    double error = 0;
+    size_t inlier_num = 0;
+    for (size_t idx : candidates) {
         Eigen::Vector4d point(points[idx](0), points[idx](1), points[idx](2),
                               1);
         double distance = std::abs(plane_model.dot(point));
 
         if (distance < distance_threshold) {
             error += distance;
-            inliers.emplace_back(idx);
+            ++inlier_num;
         }
     }
 
-    size_t inlier_num = inliers.size();
     if (inlier_num == 0) {
         result.fitness_ = 0;
         result.inlier_rmse_ = 0;
     } else {
-        result.fitness_ = (double)inlier_num / (double)points.size();
+        result.fitness_ = (double)inlier_num / (double)candidates.size();
         result.inlier_rmse_ = error / std::sqrt((double)inlier_num);
     }
     return result;
@@ -132,70 +135,129 @@ Eigen::Vector4d GetPlaneFromPoints(const std::vector<Eigen::Vector3d> &points,
     return Eigen::Vector4d(abc(0), abc(1), abc(2), d);
 }
 
-std::tuple<Eigen::Vector4d, std::vector<size_t>> PointCloud::SegmentPlane(
-        const double distance_threshold /* = 0.01 */,
-        const int ransac_n /* = 3 */,
-        const int num_iterations /* = 100 */) const {
-    RANSACResult result;
-    double error = 0;
+// Returns the number of RANSAC iterations needed to sample sample_size
+// inliers with the given probability, when a fraction fitness of the points
+// are inliers.
+int RANSACIterationsNeeded(double fitness,
+                           int sample_size,
+                           double probability) {
+    const double all_inliers = std::pow(fitness, sample_size);
+    if (all_inliers <= 0) {
+        return std::numeric_limits<int>::max();
+    }
+    if (all_inliers >= 1) {
+        return 0;
+    }
+    const double iterations =
+            std::log(1 - probability) / std::log(1 - all_inliers);
+    return iterations < std::numeric_limits<int>::max()
+                   ? int(std::ceil(iterations))
+                   : std::numeric_limits<int>::max();
+}
 
-    // Initialize the plane model ax + by + cz + d = 0.
-    Eigen::Vector4d plane_model = Eigen::Vector4d(0, 0, 0, 0);
-    // Initialize the best plane model.
-    Eigen::Vector4d best_plane_model = Eigen::Vector4d(0, 0, 0, 0);
+// Runs RANSAC on the candidate points and returns the best plane model, or a
+// zero model if no sample spans a plane. The hypotheses are drawn serially
+// and evaluated in parallel by batches, after which the iterations stop as
+// soon as the best plane was found with the given probability.
+Eigen::Vector4d RANSACPlane(const std::vector<Eigen::Vector3d> &points,
+                            const std::vector<size_t> &candidates,
+                            double distance_threshold,
+                            int ransac_n,
+                            int num_iterations,
+                            double probability,
+                            std::mt19937 &rng,
+                            RANSACResult &result) {
+    const int kBatchSize = 16;
+    const size_t num_candidates = candidates.size();
+    Eigen::Vector4d best_plane_model(0, 0, 0, 0);
+    std::vector<Eigen::Vector4d> plane_models;
+    std::vector<RANSACResult> results;
+    std::vector<size_t> sample;
 
-    // Initialize consensus set.
-    std::vector<size_t> inliers;
+    int itr = 0;
+    while (itr < num_iterations) {
+        const int batch_size = std::min(kBatchSize, num_iterations - itr);
+        plane_models.clear();
+        for (int b = 0; b < batch_size; ++b) {
+            // Only the first three of the ransac_n distinct points define the
+            // plane.
+            sample.clear();
+            while (sample.size() < size_t(ransac_n)) {
+                size_t idx = candidates[rng() % num_candidates];
+                if (std::find(sample.begin(), sample.end(), idx) ==
+                    sample.end()) {
+                    sample.push_back(idx);
+                }
+            }
+            plane_models.push_back(TriangleMesh::ComputeTrianglePlane(
+                    points[sample[0]], points[sample[1]], points[sample[2]]));
+        }
 
-    size_t num_points = points_.size();
-    std::vector<size_t> indices(num_points);
-    std::iota(std::begin(indices), std::end(indices), 0);
+        results.assign(batch_size, RANSACResult());
+#pragma omp parallel for schedule(dynamic) num_threads(utility::EstimateMaxThreads())
+        for (int b = 0; b < batch_size; ++b) {
+            if (!plane_models[b].isZero(0)) {
+                results[b] = EvaluateRANSACBasedOnDistance(
+                        points, candidates, plane_models[b],
+                        distance_threshold);
+            }
+        }
+        for (int b = 0; b < batch_size; ++b) {
+            if (plane_models[b].isZero(0)) {
+                continue;
+            }
+            if (results[b].fitness_ > result.fitness_ ||
+                (results[b].fitness_ == result.fitness_ &&
+                 results[b].inlier_rmse_ < result.inlier_rmse_)) {
+                result = results[b];
+                best_plane_model = plane_models[b];
+            }
+        }
 
-    std::random_device rd;
-    std::mt19937 rng(rd());
+        // Only three points of each sample need to be inliers.
+        itr += batch_size;
+        if (itr >= RANSACIterationsNeeded(result.fitness_, 3, probability)) {
+            break;
+        }
+    }
+    utility::LogDebug("RANSAC | Iterations: {:d}", itr);
+    return best_plane_model;
+}
 
-    // Return if ransac_n is less than the required plane model parameters.
+void CheckRANSACParameters(int ransac_n,
+                           double probability,
+                           size_t num_points) {
     if (ransac_n < 3) {
         utility::LogError(
                 "ransac_n should be set to higher than or equal to 3.");
-        return std::make_tuple(best_plane_model, inliers);
+    }
+    if (probability <= 0 || probability > 1) {
+        utility::LogError("probability must be in (0, 1].");
     }
     if (num_points < size_t(ransac_n)) {
         utility::LogError("There must be at least 'ransac_n' points.");
-        return std::make_tuple(best_plane_model, inliers);
     }
+}
 
-    for (int itr = 0; itr < num_iterations; itr++) {
-        for (int i = 0; i < ransac_n; ++i) {
-            std::swap(indices[i], indices[rng() % num_points]);
-        }
-        inliers.clear();
-        for (int idx = 0; idx < ransac_n; ++idx) {
-            inliers.emplace_back(indices[idx]);
-        }
+std::tuple<Eigen::Vector4d, std::vector<size_t>> PointCloud::SegmentPlane(
+        const double distance_threshold /* = 0.01 */,
+        const int ransac_n /* = 3 */,
+        const int num_iterations /* = 100 */,
+        const double probability /* = 0.99999999 */) const {
+    CheckRANSACParameters(ransac_n, probability, points_.size());
 
-        // Fit model to num_model_parameters randomly selected points among the
-        // inliers.
-        plane_model = TriangleMesh::ComputeTrianglePlane(
-                points_[inliers[0]], points_[inliers[1]], points_[inliers[2]]);
-        if (plane_model.isZero(0)) {
-            continue;
-        }
+    std::vector<size_t> candidates(points_.size());
+    std::iota(std::begin(candidates), std::end(candidates), 0);
 
-        error = 0;
-        inliers.clear();
-        auto this_result = EvaluateRANSACBasedOnDistance(
-                points_, plane_model, inliers, distance_threshold, error);
-        if (this_result.fitness_ > result.fitness_ ||
-            (this_result.fitness_ == result.fitness_ &&
-             this_result.inlier_rmse_ < result.inlier_rmse_)) {
-            result = this_result;
-            best_plane_model = plane_model;
-        }
-    }
+    std::random_device rd;
+    std::mt19937 rng(rd());
+    RANSACResult result;
+    Eigen::Vector4d best_plane_model =
+            RANSACPlane(points_, candidates, distance_threshold, ransac_n,
+                        num_iterations, probability, rng, result);
 
     // Find the final inliers using best_plane_model.
-    inliers.clear();
+    std::vector<size_t> inliers;
     for (size_t idx = 0; idx < points_.size(); ++idx) {
         Eigen::Vector4d point(points_[idx](0), points_[idx](1), points_[idx](2),
                               1);
@@ -214,5 +276,59 @@ std::tuple<Eigen::Vector4d, std::vector<size_t>> PointCloud::SegmentPlane(
     return std::make_tuple(best_plane_model, inliers);
 }
 
+std::vector<std::tuple<Eigen::Vector4d, std::vector<size_t>>>
+PointCloud::SegmentPlanes(const int max_planes,
+                          const double distance_threshold /* = 0.01 */,
+                          const int ransac_n /* = 3 */,
+                          const int num_iterations /* = 100 */,
+                          const size_t min_num_inliers /* = 3 */,
+                          const double probability /* = 0.99999999 */) const {
+    CheckRANSACParameters(ransac_n, probability, points_.size());
+
+    // The inliers of the planes found are removed from the candidates, and
+    // the point cloud itself is never copied.
+    std::vector<size_t> candidates(points_.size());
+    std::iota(std::begin(candidates), std::end(candidates), 0);
+    std::vector<bool> is_inlier(points_.size(), false);
+
+    std::random_device rd;
+    std::mt19937 rng(rd());
+    std::vector<std::tuple<Eigen::Vector4d, std::vector<size_t>>> planes;
+    while (int(planes.size()) < max_planes &&
+           candidates.size() >= size_t(ransac_n)) {
+        RANSACResult result;
+        Eigen::Vector4d plane_model =
+                RANSACPlane(points_, candidates, distance_threshold, ransac_n,
+                            num_iterations, probability, rng, result);
+        if (plane_model.isZero(0)) {
+            break;
+        }
+
+        std::vector<size_t> inliers;
+        for (size_t idx : candidates) {
+            Eigen::Vector4d point(points_[idx](0), points_[idx](1),
+                                  points_[idx](2), 1);
+            if (std::abs(plane_model.dot(point)) < distance_threshold) {
+                inliers.emplace_back(idx);
+                is_inlier[idx] = true;
+            }
+        }
+        if (inliers.size() < min_num_inliers) {
+            break;
+        }
+        candidates.erase(std::remove_if(candidates.begin(), candidates.end(),
+                                        [&](size_t idx) {
+                                            return is_inlier[idx];
+                                        }),
+                         candidates.end());
+
+        utility::LogDebug("RANSAC | Plane {:d}, Inliers: {:d}, Fitness: {:e}",
+                          planes.size(), inliers.size(), result.fitness_);
+        planes.emplace_back(GetPlaneFromPoints(points_, inliers),
+                            std::move(inliers));
+    }
+    return planes;
+}
+
 }  // namespace geometry
 }  // namespace open3d
@@ -26,10 +26,13 @@
 
 #include "open3d/geometry/Qhull.h"
 
+#include <algorithm>
+
 #include "libqhullcpp/PointCoordinates.h"
 #include "libqhullcpp/Qhull.h"
 #include "libqhullcpp/QhullFacet.h"
 #include "libqhullcpp/QhullFacetList.h"
+#include "libqhullcpp/QhullVertex.h"
 #include "libqhullcpp/QhullVertexSet.h"
 #include "open3d/geometry/TetraMesh.h"
 #include "open3d/geometry/TriangleMesh.h"
@@ -101,6 +104,27 @@ Qhull::ComputeConvexHull(const std::vector<Eigen::Vector3d>& points) {
     return std::make_tuple(convex_hull, pt_map);
 }
 
+std::vector<size_t> Qhull::ComputeConvexHullVertices(
+        const std::vector<Eigen::Vector3d>& points) {
+    std::vector<size_t> hull_vertices;
+    if (points.empty()) {
+        return hull_vertices;
+    }
+
+    // Eigen::Vector3d has no padding, so Qhull reads the points in place.
+    orgQhull::Qhull qhull;
+    qhull.runQhull("", 3, int(points.size()), points[0].data(), "Qt");
+
+    hull_vertices.reserve(qhull.vertexCount());
+    orgQhull::QhullVertexList vertices = qhull.vertexList();
+    for (orgQhull::QhullVertexList::iterator it = vertices.begin();
+         it != vertices.end(); ++it) {
+        hull_vertices.push_back(size_t((*it).point().id()));
+    }
+    std::sort(hull_vertices.begin(), hull_vertices.end());
+    return hull_vertices;
+}
+
 std::tuple<std::shared_ptr<TetraMesh>, std::vector<size_t>>
 Qhull::ComputeDelaunayTetrahedralization(
         const std::vector<Eigen::Vector3d>& points) {
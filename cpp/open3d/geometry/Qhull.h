@@ -41,6 +41,12 @@ public:
     static std::tuple<std::shared_ptr<TriangleMesh>, std::vector<size_t>>
     ComputeConvexHull(const std::vector<Eigen::Vector3d>& points);
 
+    /// Computes the indices of the points on the convex hull, in increasing
+    /// order, without building the hull mesh. Separate calls use separate
+    /// reentrant Qhull instances, so they can run concurrently.
+    static std::vector<size_t> ComputeConvexHullVertices(
+            const std::vector<Eigen::Vector3d>& points);
+
     static std::tuple<std::shared_ptr<TetraMesh>, std::vector<size_t>>
     ComputeDelaunayTetrahedralization(
             const std::vector<Eigen::Vector3d>& points);
@@ -25,65 +25,41 @@
 // ----------------------------------------------------------------------------
 
 #include <Eigen/Dense>
+#include <algorithm>
 #include <iostream>
+#include <limits>
 #include <list>
+#include <tuple>
 
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/Qhull.h"
 #include "open3d/geometry/TetraMesh.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
 
-std::shared_ptr<TriangleMesh> TriangleMesh::CreateFromPointCloudAlphaShape(
-        const PointCloud& pcd,
-        double alpha,
-        std::shared_ptr<TetraMesh> tetra_mesh,
-        std::vector<size_t>* pt_map) {
-    std::vector<size_t> pt_map_computed;
-    if (tetra_mesh == nullptr) {
-        utility::LogDebug(
-                "[CreateFromPointCloudAlphaShape] "
-                "ComputeDelaunayTetrahedralization");
-        std::tie(tetra_mesh, pt_map_computed) =
-                Qhull::ComputeDelaunayTetrahedralization(pcd.points_);
-        pt_map = &pt_map_computed;
-        utility::LogDebug(
-                "[CreateFromPointCloudAlphaShape] done "
-                "ComputeDelaunayTetrahedralization");
-    }
+namespace {
 
-    utility::LogDebug("[CreateFromPointCloudAlphaShape] init triangle mesh");
-    auto mesh = std::make_shared<TriangleMesh>();
-    mesh->vertices_ = tetra_mesh->vertices_;
-    if (pcd.HasNormals()) {
-        mesh->vertex_normals_.resize(mesh->vertices_.size());
-        for (size_t idx = 0; idx < (*pt_map).size(); ++idx) {
-            mesh->vertex_normals_[idx] = pcd.normals_[(*pt_map)[idx]];
-        }
-    }
-    if (pcd.HasColors()) {
-        mesh->vertex_colors_.resize(mesh->vertices_.size());
-        for (size_t idx = 0; idx < (*pt_map).size(); ++idx) {
-            mesh->vertex_colors_[idx] = pcd.colors_[(*pt_map)[idx]];
-        }
-    }
-    utility::LogDebug(
-            "[CreateFromPointCloudAlphaShape] done init triangle mesh");
+/// Faces of a tetra, in the order in which they are added to the mesh.
+constexpr int kTetraFaces[4][3] = {{0, 1, 2}, {0, 1, 3}, {0, 2, 3}, {1, 2, 3}};
 
-    std::vector<double> vsqn(tetra_mesh->vertices_.size());
+/// Returns the circumradius of each tetra of \p tetra_mesh.
+std::vector<double> ComputeTetraCircumradii(const TetraMesh& tetra_mesh) {
+    const auto& verts = tetra_mesh.vertices_;
+    const auto& tetras = tetra_mesh.tetras_;
+    std::vector<double> vsqn(verts.size());
     for (size_t vidx = 0; vidx < vsqn.size(); ++vidx) {
-        vsqn[vidx] = tetra_mesh->vertices_[vidx].squaredNorm();
+        vsqn[vidx] = verts[vidx].squaredNorm();
     }
 
-    utility::LogDebug(
-            "[CreateFromPointCloudAlphaShape] add triangles from tetras that "
-            "satisfy constraint");
-    const auto& verts = tetra_mesh->vertices_;
-    for (size_t tidx = 0; tidx < tetra_mesh->tetras_.size(); ++tidx) {
-        const auto& tetra = tetra_mesh->tetras_[tidx];
+    std::vector<double> radii(tetras.size());
+    bool invalid = false;
+#pragma omp parallel for schedule(static) reduction(|| : invalid) num_threads(utility::EstimateMaxThreads())
+    for (int64_t tidx = 0; tidx < int64_t(tetras.size()); ++tidx) {
+        const auto& tetra = tetras[tidx];
         // clang-format off
         Eigen::Matrix4d tmp;
         tmp << verts[tetra(0)](0), verts[tetra(0)](1), verts[tetra(0)](2), 1,
@@ -113,66 +89,204 @@ std::shared_ptr<TriangleMesh> TriangleMesh::CreateFromPointCloudAlphaShape(
         double dz = tmp.determinant();
         // clang-format on
         if (a == 0) {
-            utility::LogError(
-                    "[CreateFromPointCloudAlphaShape] invalid tetra in "
-                    "TetraMesh");
+            invalid = true;
+            continue;
         }
-        double r = std::sqrt(dx * dx + dy * dy + dz * dz - 4 * a * c) /
-                   (2 * std::abs(a));
-
-        if (r <= alpha) {
-            mesh->triangles_.push_back(TriangleMesh::GetOrderedTriangle(
-                    tetra(0), tetra(1), tetra(2)));
-            mesh->triangles_.push_back(TriangleMesh::GetOrderedTriangle(
-                    tetra(0), tetra(1), tetra(3)));
-            mesh->triangles_.push_back(TriangleMesh::GetOrderedTriangle(
-                    tetra(0), tetra(2), tetra(3)));
-            mesh->triangles_.push_back(TriangleMesh::GetOrderedTriangle(
-                    tetra(1), tetra(2), tetra(3)));
+        radii[tidx] = std::sqrt(dx * dx + dy * dy + dz * dz - 4 * a * c) /
+                      (2 * std::abs(a));
+    }
+    if (invalid) {
+        utility::LogError(
+                "[CreateFromPointCloudAlphaShape] invalid tetra in "
+                "TetraMesh");
+    }
+    return radii;
+}
+
+/// For each face (tidx * 4 + fidx) of the tetras, returns the smallest
+/// circumradius of the other tetras sharing this face, or infinity for faces
+/// on the convex hull. For a given alpha, a face of an accepted tetra is on
+/// the boundary of the alpha shape iff this radius is larger than alpha.
+std::vector<double> ComputeNeighborRadii(const TetraMesh& tetra_mesh,
+                                         const std::vector<double>& radii) {
+    const auto& tetras = tetra_mesh.tetras_;
+    typedef std::tuple<int, int, int, int64_t> FaceEntry;
+    std::vector<FaceEntry> faces(tetras.size() * 4);
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int64_t tidx = 0; tidx < int64_t(tetras.size()); ++tidx) {
+        const auto& tetra = tetras[tidx];
+        for (int fidx = 0; fidx < 4; ++fidx) {
+            Eigen::Vector3i triangle = TriangleMesh::GetOrderedTriangle(
+                    tetra(kTetraFaces[fidx][0]), tetra(kTetraFaces[fidx][1]),
+                    tetra(kTetraFaces[fidx][2]));
+            faces[tidx * 4 + fidx] = std::make_tuple(
+                    triangle(0), triangle(1), triangle(2), tidx * 4 + fidx);
         }
     }
-    utility::LogDebug(
-            "[CreateFromPointCloudAlphaShape] done add triangles from tetras "
-            "that satisfy constraint");
+    std::sort(faces.begin(), faces.end());
 
-    utility::LogDebug(
-            "[CreateFromPointCloudAlphaShape] remove triangles within "
-            "the mesh");
-    std::unordered_map<Eigen::Vector3i, int,
-                       utility::hash_eigen<Eigen::Vector3i>>
-            triangle_count;
-    for (size_t tidx = 0; tidx < mesh->triangles_.size(); ++tidx) {
-        Eigen::Vector3i triangle = mesh->triangles_[tidx];
-        if (triangle_count.count(triangle) == 0) {
-            triangle_count[triangle] = 1;
-        } else {
-            triangle_count[triangle] += 1;
+    const double inf = std::numeric_limits<double>::infinity();
+    std::vector<double> neighbor_radii(faces.size(), inf);
+    size_t begin = 0;
+    while (begin < faces.size()) {
+        size_t end = begin + 1;
+        while (end < faces.size() &&
+               std::get<0>(faces[end]) == std::get<0>(faces[begin]) &&
+               std::get<1>(faces[end]) == std::get<1>(faces[begin]) &&
+               std::get<2>(faces[end]) == std::get<2>(faces[begin])) {
+            end++;
+        }
+        // Two smallest radii of the run, so that each face can exclude its
+        // own tetra.
+        double min0 = inf, min1 = inf;
+        for (size_t idx = begin; idx < end; ++idx) {
+            double r = radii[std::get<3>(faces[idx]) / 4];
+            if (r < min0) {
+                min1 = min0;
+                min0 = r;
+            } else if (r < min1) {
+                min1 = r;
+            }
         }
+        for (size_t idx = begin; idx < end; ++idx) {
+            int64_t face = std::get<3>(faces[idx]);
+            neighbor_radii[face] = radii[face / 4] == min0 ? min1 : min0;
+        }
+        begin = end;
+    }
+    return neighbor_radii;
+}
+
+}  // namespace
+
+std::shared_ptr<TriangleMesh> TriangleMesh::CreateFromPointCloudAlphaShape(
+        const PointCloud& pcd,
+        double alpha,
+        std::shared_ptr<TetraMesh> tetra_mesh,
+        std::vector<size_t>* pt_map) {
+    return CreateFromPointCloudAlphaShapes(pcd, {alpha}, tetra_mesh,
+                                           pt_map)[0];
+}
+
+std::vector<std::shared_ptr<TriangleMesh>>
+TriangleMesh::CreateFromPointCloudAlphaShapes(
+        const PointCloud& pcd,
+        const std::vector<double>& alphas,
+        std::shared_ptr<TetraMesh> tetra_mesh,
+        std::vector<size_t>* pt_map) {
+    std::vector<size_t> pt_map_computed;
+    if (tetra_mesh == nullptr) {
+        utility::LogDebug(
+                "[CreateFromPointCloudAlphaShape] "
+                "ComputeDelaunayTetrahedralization");
+        std::tie(tetra_mesh, pt_map_computed) =
+                Qhull::ComputeDelaunayTetrahedralization(pcd.points_);
+        pt_map = &pt_map_computed;
+        utility::LogDebug(
+                "[CreateFromPointCloudAlphaShape] done "
+                "ComputeDelaunayTetrahedralization");
     }
 
-    size_t to_idx = 0;
-    for (size_t tidx = 0; tidx < mesh->triangles_.size(); ++tidx) {
-        Eigen::Vector3i triangle = mesh->triangles_[tidx];
-        if (triangle_count[triangle] == 1) {
-            mesh->triangles_[to_idx] = triangle;
-            to_idx++;
+    utility::LogDebug("[CreateFromPointCloudAlphaShape] init triangle mesh");
+    TriangleMesh base_mesh;
+    base_mesh.vertices_ = tetra_mesh->vertices_;
+    if (pcd.HasNormals()) {
+        base_mesh.vertex_normals_.resize(base_mesh.vertices_.size());
+        for (size_t idx = 0; idx < (*pt_map).size(); ++idx) {
+            base_mesh.vertex_normals_[idx] = pcd.normals_[(*pt_map)[idx]];
+        }
+    }
+    if (pcd.HasColors()) {
+        base_mesh.vertex_colors_.resize(base_mesh.vertices_.size());
+        for (size_t idx = 0; idx < (*pt_map).size(); ++idx) {
+            base_mesh.vertex_colors_[idx] = pcd.colors_[(*pt_map)[idx]];
         }
     }
-    mesh->triangles_.resize(to_idx);
     utility::LogDebug(
-            "[CreateFromPointCloudAlphaShape] done remove triangles within "
-            "the mesh");
+            "[CreateFromPointCloudAlphaShape] done init triangle mesh");
 
     utility::LogDebug(
-            "[CreateFromPointCloudAlphaShape] remove duplicate triangles and "
-            "unreferenced vertices");
-    mesh->RemoveDuplicatedTriangles();
-    mesh->RemoveUnreferencedVertices();
+            "[CreateFromPointCloudAlphaShape] compute tetra circumradii and "
+            "face adjacency");
+    const auto& tetras = tetra_mesh->tetras_;
+    const std::vector<double> radii = ComputeTetraCircumradii(*tetra_mesh);
+    const std::vector<double> neighbor_radii =
+            ComputeNeighborRadii(*tetra_mesh, radii);
+    std::vector<int64_t> tetras_by_radius(tetras.size());
+    for (size_t tidx = 0; tidx < tetras.size(); ++tidx) {
+        tetras_by_radius[tidx] = int64_t(tidx);
+    }
+    std::sort(tetras_by_radius.begin(), tetras_by_radius.end(),
+              [&](int64_t t0, int64_t t1) {
+                  return radii[t0] < radii[t1] ||
+                         (radii[t0] == radii[t1] && t0 < t1);
+              });
     utility::LogDebug(
-            "[CreateFromPointCloudAlphaShape] done remove duplicate triangles "
-            "and unreferenced vertices");
+            "[CreateFromPointCloudAlphaShape] done compute tetra circumradii "
+            "and face adjacency");
+
+    // Alphas are processed in increasing order, so that the accepted tetras
+    // only grow. They are kept sorted by index, so that every mesh lists its
+    // triangles in the same order as a single alpha reconstruction.
+    std::vector<size_t> alpha_order(alphas.size());
+    for (size_t aidx = 0; aidx < alphas.size(); ++aidx) {
+        alpha_order[aidx] = aidx;
+    }
+    std::sort(alpha_order.begin(), alpha_order.end(),
+              [&](size_t a0, size_t a1) { return alphas[a0] < alphas[a1]; });
+
+    std::vector<std::shared_ptr<TriangleMesh>> meshes(alphas.size());
+    std::vector<int64_t> accepted;
+    std::vector<uint8_t> is_boundary;
+    size_t num_accepted = 0;
+    for (size_t aidx : alpha_order) {
+        const double alpha = alphas[aidx];
+        utility::LogDebug(
+                "[CreateFromPointCloudAlphaShape] add boundary triangles for "
+                "alpha {}",
+                alpha);
+        size_t end = num_accepted;
+        while (end < tetras_by_radius.size() &&
+               radii[tetras_by_radius[end]] <= alpha) {
+            end++;
+        }
+        size_t num_merged = accepted.size();
+        accepted.insert(accepted.end(),
+                        tetras_by_radius.begin() + num_accepted,
+                        tetras_by_radius.begin() + end);
+        std::sort(accepted.begin() + num_merged, accepted.end());
+        std::inplace_merge(accepted.begin(), accepted.begin() + num_merged,
+                           accepted.end());
+        num_accepted = end;
+
+        // A face of an accepted tetra is kept iff no other tetra sharing it
+        // is accepted. Faces are unique after this, so there are no
+        // duplicated triangles to remove.
+        is_boundary.resize(accepted.size() * 4);
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+        for (int64_t idx = 0; idx < int64_t(is_boundary.size()); ++idx) {
+            is_boundary[idx] =
+                    neighbor_radii[accepted[idx / 4] * 4 + idx % 4] > alpha;
+        }
+
+        auto mesh = std::make_shared<TriangleMesh>(base_mesh);
+        for (size_t idx = 0; idx < is_boundary.size(); ++idx) {
+            if (is_boundary[idx]) {
+                const auto& tetra = tetras[accepted[idx / 4]];
+                const int* face = kTetraFaces[idx % 4];
+                mesh->triangles_.push_back(TriangleMesh::GetOrderedTriangle(
+                        tetra(face[0]), tetra(face[1]), tetra(face[2])));
+            }
+        }
+        mesh->RemoveUnreferencedVertices();
+        meshes[aidx] = mesh;
+        utility::LogDebug(
+                "[CreateFromPointCloudAlphaShape] done add boundary triangles "
+                "for alpha {}",
+                alpha);
+    }
 
-    return mesh;
+    return meshes;
 }
 
 }  // namespace geometry
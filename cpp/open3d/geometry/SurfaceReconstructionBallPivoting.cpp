@@ -25,6 +25,8 @@
 // ----------------------------------------------------------------------------
 
 #include <Eigen/Dense>
+#include <algorithm>
+#include <deque>
 #include <iostream>
 #include <list>
 
@@ -33,6 +35,7 @@
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
@@ -41,9 +44,10 @@ class BallPivotingVertex;
 class BallPivotingEdge;
 class BallPivotingTriangle;
 
+// The vertices, edges and triangles are owned by the arenas of BallPivoting.
 typedef BallPivotingVertex* BallPivotingVertexPtr;
-typedef std::shared_ptr<BallPivotingEdge> BallPivotingEdgePtr;
-typedef std::shared_ptr<BallPivotingTriangle> BallPivotingTrianglePtr;
+typedef BallPivotingEdge* BallPivotingEdgePtr;
+typedef BallPivotingTriangle* BallPivotingTrianglePtr;
 
 class BallPivotingVertex {
 public:
@@ -54,13 +58,18 @@ public:
                        const Eigen::Vector3d& normal)
         : idx_(idx), point_(point), normal_(normal), type_(Orphan) {}
 
+    void AddEdge(BallPivotingEdgePtr edge) {
+        if (std::find(edges_.begin(), edges_.end(), edge) == edges_.end()) {
+            edges_.push_back(edge);
+        }
+    }
     void UpdateType();
 
 public:
     int idx_;
     const Eigen::Vector3d& point_;
     const Eigen::Vector3d& normal_;
-    std::unordered_set<BallPivotingEdgePtr> edges_;
+    std::vector<BallPivotingEdgePtr> edges_;
     Type type_;
 };
 
@@ -69,7 +78,11 @@ public:
     enum Type { Border = 0, Front = 1, Inner = 2 };
 
     BallPivotingEdge(BallPivotingVertexPtr source, BallPivotingVertexPtr target)
-        : source_(source), target_(target), type_(Type::Front) {}
+        : source_(source),
+          target_(target),
+          triangle0_(nullptr),
+          triangle1_(nullptr),
+          type_(Type::Front) {}
 
     void AddAdjacentTriangle(BallPivotingTrianglePtr triangle);
     BallPivotingVertexPtr GetOppositeVertex();
@@ -164,17 +177,60 @@ public:
         mesh_->vertices_ = pcd.points_;
         mesh_->vertex_normals_ = pcd.normals_;
         mesh_->vertex_colors_ = pcd.colors_;
+        vertex_arena_.reserve(pcd.points_.size());
         for (size_t vidx = 0; vidx < pcd.points_.size(); ++vidx) {
-            vertices.emplace_back(new BallPivotingVertex(static_cast<int>(vidx),
-                                                         pcd.points_[vidx],
-                                                         pcd.normals_[vidx]));
+            vertex_arena_.emplace_back(static_cast<int>(vidx),
+                                       pcd.points_[vidx], pcd.normals_[vidx]);
+            vertices.push_back(&vertex_arena_.back());
+        }
+    }
+
+    virtual ~BallPivoting() {}
+
+    // Caches the neighbours within 2 * radius of every vertex that can
+    // still get new triangles. The ball through a vertex and the points it
+    // must not contain all lie in this neighbourhood.
+    void CacheNeighborhoods(double radius) {
+        const int n_vertices = static_cast<int>(vertices.size());
+        std::vector<std::vector<int>> neighbors(n_vertices);
+#pragma omp parallel for schedule(dynamic, 256) num_threads(utility::EstimateMaxThreads())
+        for (int vidx = 0; vidx < n_vertices; ++vidx) {
+            if (vertices[vidx]->type_ == BallPivotingVertex::Type::Inner) {
+                continue;
+            }
+            std::vector<double> dists2;
+            kdtree_.SearchRadius(vertices[vidx]->point_, 2 * radius,
+                                 neighbors[vidx], dists2);
         }
+        neighbor_offsets_.assign(n_vertices + 1, 0);
+        for (int vidx = 0; vidx < n_vertices; ++vidx) {
+            neighbor_offsets_[vidx + 1] =
+                    neighbor_offsets_[vidx] + neighbors[vidx].size();
+        }
+        neighbor_indices_.resize(neighbor_offsets_.back());
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+        for (int vidx = 0; vidx < n_vertices; ++vidx) {
+            std::copy(neighbors[vidx].begin(), neighbors[vidx].end(),
+                      neighbor_indices_.begin() + neighbor_offsets_[vidx]);
+        }
+        neighbor_radius_ = radius;
     }
 
-    virtual ~BallPivoting() {
-        for (auto vert : vertices) {
-            delete vert;
+    // The cached neighbours within 2 * radius of v, in the order of the
+    // KDTree search.
+    std::vector<int> GetNeighbors(const BallPivotingVertexPtr& v,
+                                  double radius) {
+        std::vector<int> indices;
+        if (radius == neighbor_radius_ &&
+            neighbor_offsets_[v->idx_ + 1] > neighbor_offsets_[v->idx_]) {
+            indices.assign(
+                    neighbor_indices_.begin() + neighbor_offsets_[v->idx_],
+                    neighbor_indices_.begin() + neighbor_offsets_[v->idx_ + 1]);
+        } else {
+            std::vector<double> dists2;
+            kdtree_.SearchRadius(v->point_, 2 * radius, indices, dists2);
         }
+        return indices;
     }
 
     bool ComputeBallCenter(int vidx1,
@@ -232,12 +288,9 @@ public:
 
     BallPivotingEdgePtr GetLinkingEdge(const BallPivotingVertexPtr& v0,
                                        const BallPivotingVertexPtr& v1) {
-        for (BallPivotingEdgePtr edge0 : v0->edges_) {
-            for (BallPivotingEdgePtr edge1 : v1->edges_) {
-                if (edge0->source_->idx_ == edge1->source_->idx_ &&
-                    edge0->target_->idx_ == edge1->target_->idx_) {
-                    return edge0;
-                }
+        for (BallPivotingEdgePtr edge : v0->edges_) {
+            if (edge->source_ == v1 || edge->target_ == v1) {
+                return edge;
             }
         }
         return nullptr;
@@ -250,32 +303,35 @@ public:
         utility::LogDebug(
                 "[CreateTriangle] with v0.idx={}, v1.idx={}, v2.idx={}",
                 v0->idx_, v1->idx_, v2->idx_);
-        BallPivotingTrianglePtr triangle =
-                std::make_shared<BallPivotingTriangle>(v0, v1, v2, center);
+        triangle_arena_.emplace_back(v0, v1, v2, center);
+        BallPivotingTrianglePtr triangle = &triangle_arena_.back();
 
         BallPivotingEdgePtr e0 = GetLinkingEdge(v0, v1);
         if (e0 == nullptr) {
-            e0 = std::make_shared<BallPivotingEdge>(v0, v1);
+            edge_arena_.emplace_back(v0, v1);
+            e0 = &edge_arena_.back();
         }
         e0->AddAdjacentTriangle(triangle);
-        v0->edges_.insert(e0);
-        v1->edges_.insert(e0);
+        v0->AddEdge(e0);
+        v1->AddEdge(e0);
 
         BallPivotingEdgePtr e1 = GetLinkingEdge(v1, v2);
         if (e1 == nullptr) {
-            e1 = std::make_shared<BallPivotingEdge>(v1, v2);
+            edge_arena_.emplace_back(v1, v2);
+            e1 = &edge_arena_.back();
         }
         e1->AddAdjacentTriangle(triangle);
-        v1->edges_.insert(e1);
-        v2->edges_.insert(e1);
+        v1->AddEdge(e1);
+        v2->AddEdge(e1);
 
         BallPivotingEdgePtr e2 = GetLinkingEdge(v2, v0);
         if (e2 == nullptr) {
-            e2 = std::make_shared<BallPivotingEdge>(v2, v0);
+            edge_arena_.emplace_back(v2, v0);
+            e2 = &edge_arena_.back();
         }
         e2->AddAdjacentTriangle(triangle);
-        v2->edges_.insert(e2);
-        v0->edges_.insert(e2);
+        v2->AddEdge(e2);
+        v0->AddEdge(e2);
 
         v0->UpdateType();
         v1->UpdateType();
@@ -357,9 +413,10 @@ public:
         Eigen::Vector3d a = center - mp;
         a /= a.norm();
 
-        std::vector<int> indices;
-        std::vector<double> dists2;
-        kdtree_.SearchRadius(mp, 2 * radius, indices, dists2);
+        // A candidate is on a ball of the radius through src, and so is every
+        // point that could be inside the ball, so the neighbourhood of src
+        // contains them all.
+        std::vector<int> indices = GetNeighbors(src, radius);
         utility::LogDebug("[FindCandidateVertex] found {} potential candidates",
                           indices.size());
 
@@ -570,17 +627,19 @@ public:
         return true;
     }
 
-    bool TrySeed(BallPivotingVertexPtr& v, double radius) {
-        utility::LogDebug("[TrySeed] with v.idx={}, radius={}", v->idx_,
-                          radius);
-        std::vector<int> indices;
-        std::vector<double> dists2;
-        kdtree_.SearchRadius(v->point_, 2 * radius, indices, dists2);
-        if (indices.size() < 3u) {
-            return false;
-        }
-
-        for (size_t nbidx0 = 0; nbidx0 < indices.size(); ++nbidx0) {
+    // Finds the first seed triangle of v, starting at the neighbour
+    // indices[first_nbidx0], without changing the triangulation. Only reads
+    // v, its neighbours and their edges.
+    bool FindSeed(const BallPivotingVertexPtr& v,
+                  const std::vector<int>& indices,
+                  double radius,
+                  size_t first_nbidx0,
+                  BallPivotingVertexPtr& seed_nb0,
+                  BallPivotingVertexPtr& seed_nb1,
+                  Eigen::Vector3d& seed_center,
+                  size_t& next_nbidx0) {
+        for (size_t nbidx0 = first_nbidx0; nbidx0 < indices.size();
+             ++nbidx0) {
             const BallPivotingVertexPtr& nb0 = vertices[indices[nbidx0]];
             if (nb0->type_ != BallPivotingVertex::Type::Orphan) {
                 continue;
@@ -625,27 +684,49 @@ public:
                     continue;
                 }
 
-                CreateTriangle(v, nb0, nb1, center);
+                seed_nb0 = nb0;
+                seed_nb1 = nb1;
+                seed_center = center;
+                next_nbidx0 = nbidx0 + 1;
+                return true;
+            }
+        }
+        return false;
+    }
 
-                e0 = GetLinkingEdge(v, nb1);
-                e1 = GetLinkingEdge(nb0, nb1);
-                e2 = GetLinkingEdge(v, nb0);
-                if (e0->type_ == BallPivotingEdge::Type::Front) {
-                    edge_front_.push_front(e0);
-                }
-                if (e1->type_ == BallPivotingEdge::Type::Front) {
-                    edge_front_.push_front(e1);
-                }
-                if (e2->type_ == BallPivotingEdge::Type::Front) {
-                    edge_front_.push_front(e2);
-                }
+    bool TrySeed(BallPivotingVertexPtr& v, double radius) {
+        utility::LogDebug("[TrySeed] with v.idx={}, radius={}", v->idx_,
+                          radius);
+        std::vector<int> indices = GetNeighbors(v, radius);
+        if (indices.size() < 3u) {
+            return false;
+        }
 
-                if (edge_front_.size() > 0) {
-                    utility::LogDebug(
-                            "[TrySeed] edge_front_.size() > 0 => return "
-                            "true");
-                    return true;
-                }
+        BallPivotingVertexPtr nb0;
+        BallPivotingVertexPtr nb1;
+        Eigen::Vector3d center;
+        size_t nbidx0 = 0;
+        while (FindSeed(v, indices, radius, nbidx0, nb0, nb1, center,
+                        nbidx0)) {
+            CreateTriangle(v, nb0, nb1, center);
+
+            BallPivotingEdgePtr e0 = GetLinkingEdge(v, nb1);
+            BallPivotingEdgePtr e1 = GetLinkingEdge(nb0, nb1);
+            BallPivotingEdgePtr e2 = GetLinkingEdge(v, nb0);
+            if (e0->type_ == BallPivotingEdge::Type::Front) {
+                edge_front_.push_front(e0);
+            }
+            if (e1->type_ == BallPivotingEdge::Type::Front) {
+                edge_front_.push_front(e1);
+            }
+            if (e2->type_ == BallPivotingEdge::Type::Front) {
+                edge_front_.push_front(e2);
+            }
+
+            if (edge_front_.size() > 0) {
+                utility::LogDebug(
+                        "[TrySeed] edge_front_.size() > 0 => return true");
+                return true;
             }
         }
 
@@ -654,11 +735,46 @@ public:
     }
 
     void FindSeedTriangle(double radius) {
-        for (size_t vidx = 0; vidx < vertices.size(); ++vidx) {
-            utility::LogDebug("[FindSeedTriangle] with radius={}, vidx={}",
-                              radius, vidx);
-            if (vertices[vidx]->type_ == BallPivotingVertex::Type::Orphan) {
-                if (TrySeed(vertices[vidx], radius)) {
+        // Most orphan vertices have no seed triangle. The vertices of a block
+        // are first searched for seeds in parallel, then seeded in order. A
+        // seed only has orphan vertices, which have no edges, and vertices
+        // never become orphans again, so a vertex without seed still has none
+        // when its turn comes and is skipped. This gives the same
+        // triangulation as seeding all the vertices in order. The search is
+        // not repeated when it cannot run in parallel.
+        bool prescreen = utility::EstimateMaxThreads() > 1;
+        const int n_vertices = static_cast<int>(vertices.size());
+        const int block_size = 4096;
+        std::vector<char> has_seed(block_size, 1);
+        for (int begin = 0; begin < n_vertices; begin += block_size) {
+            const int end = std::min(begin + block_size, n_vertices);
+            if (prescreen) {
+#pragma omp parallel for schedule(dynamic, 16) num_threads(utility::EstimateMaxThreads())
+                for (int vidx = begin; vidx < end; ++vidx) {
+                    const BallPivotingVertexPtr& v = vertices[vidx];
+                    has_seed[vidx - begin] = 1;
+                    if (v->type_ == BallPivotingVertex::Type::Orphan) {
+                        std::vector<int> indices = GetNeighbors(v, radius);
+                        BallPivotingVertexPtr nb0;
+                        BallPivotingVertexPtr nb1;
+                        Eigen::Vector3d center;
+                        size_t next_nbidx0;
+                        has_seed[vidx - begin] =
+                                indices.size() >= 3u &&
+                                FindSeed(v, indices, radius, 0, nb0, nb1,
+                                         center, next_nbidx0);
+                    }
+                }
+            }
+
+            for (int vidx = begin; vidx < end; ++vidx) {
+                utility::LogDebug("[FindSeedTriangle] with radius={}, vidx={}",
+                                  radius, vidx);
+                if (vertices[vidx]->type_ != BallPivotingVertex::Type::Orphan) {
+                    continue;
+                }
+                if (has_seed[vidx - begin] &&
+                    TrySeed(vertices[vidx], radius)) {
                     ExpandTriangulation(radius);
                 }
             }
@@ -680,6 +796,8 @@ public:
                         "got an invalid, negative radius as parameter");
             }
 
+            CacheNeighborhoods(radius);
+
             // update radius => update border edges
             for (auto it = border_edges_.begin(); it != border_edges_.end();) {
                 BallPivotingEdgePtr edge = *it;
@@ -695,14 +813,16 @@ public:
                                       triangle->vert1_->idx_,
                                       triangle->vert2_->idx_, radius, center)) {
                     utility::LogDebug("[Run]   yes, we can work on this");
-                    std::vector<int> indices;
-                    std::vector<double> dists2;
-                    kdtree_.SearchRadius(center, radius, indices, dists2);
+                    // The ball is within 2 * radius of the triangle vertices.
+                    std::vector<int> indices =
+                            GetNeighbors(triangle->vert0_, radius);
                     bool empty_ball = true;
                     for (auto idx : indices) {
                         if (idx != triangle->vert0_->idx_ &&
                             idx != triangle->vert1_->idx_ &&
-                            idx != triangle->vert2_->idx_) {
+                            idx != triangle->vert2_->idx_ &&
+                            (center - vertices[idx]->point_).squaredNorm() <
+                                    radius * radius) {
                             utility::LogDebug(
                                     "[Run]   but no, the ball is not empty");
                             empty_ball = false;
@@ -744,6 +864,17 @@ private:
     std::list<BallPivotingEdgePtr> border_edges_;
     std::vector<BallPivotingVertexPtr> vertices;
     std::shared_ptr<TriangleMesh> mesh_;
+
+    // Storage of the vertices, edges and triangles, a deque keeps the
+    // records in place as it grows.
+    std::vector<BallPivotingVertex> vertex_arena_;
+    std::deque<BallPivotingEdge> edge_arena_;
+    std::deque<BallPivotingTriangle> triangle_arena_;
+
+    // Neighbours within 2 * neighbor_radius_ of each vertex, in CSR layout.
+    double neighbor_radius_ = 0;
+    std::vector<size_t> neighbor_offsets_;
+    std::vector<int> neighbor_indices_;
 };
 
 std::shared_ptr<TriangleMesh> TriangleMesh::CreateFromPointCloudBallPivoting(
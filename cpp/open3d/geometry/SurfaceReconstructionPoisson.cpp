@@ -30,11 +30,17 @@
 #include <cstdio>
 #include <cstdlib>
 #include <iostream>
+#include <limits>
 #include <list>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/Helper.h"
+#include "open3d/utility/Parallel.h"
 
 // clang-format off
 #include "PoissonRecon/Src/PreProcessor.h"
@@ -252,6 +258,17 @@ XForm<Real, Dim + 1> GetBoundingBoxXForm(Point<Real, Dim> min,
     return sXForm * tXForm;
 }
 
+// Maps the cube with corner origin and edge length size to the unit cube.
+template <class Real, unsigned int Dim>
+XForm<Real, Dim + 1> GetCubeXForm(const Eigen::Vector3d& origin, double size) {
+    XForm<Real, Dim + 1> tXForm = XForm<Real, Dim + 1>::Identity(),
+                         sXForm = XForm<Real, Dim + 1>::Identity();
+    for (unsigned int i = 0; i < Dim; i++) {
+        sXForm(i, i) = (Real)(1. / size), tXForm(Dim, i) = (Real)-origin(i);
+    }
+    return sXForm * tXForm;
+}
+
 template <class Real, unsigned int Dim>
 XForm<Real, Dim + 1> GetPointXForm(InputPointStream<Real, Dim>& stream,
                                    Real width,
@@ -408,6 +425,8 @@ void Execute(const open3d::geometry::PointCloud& pcd,
              size_t width,
              float scale,
              bool linear_fit,
+             const Eigen::Vector3d& cube_origin,
+             double cube_size,
              UIntPack<FEMSigs...>) {
     static const int Dim = sizeof...(FEMSigs);
     typedef UIntPack<FEMSigs...> Sigs;
@@ -456,7 +475,9 @@ void Execute(const open3d::geometry::PointCloud& pcd,
     {
         Open3DPointStream<Real> pointStream(&pcd);
 
-        if (width > 0) {
+        if (cube_size > 0) {
+            xForm = GetCubeXForm<Real, Dim>(cube_origin, cube_size) * xForm;
+        } else if (width > 0) {
             xForm = GetPointXForm<Real, Dim>(pointStream, (Real)width,
                                              (Real)(scale > 0 ? scale : 1.),
                                              depth) *
@@ -723,6 +744,33 @@ void Execute(const open3d::geometry::PointCloud& pcd,
                       Time() - startTime, FEMTree<Dim, Real>::MaxMemoryUsage());
 }
 
+// Removes the vertices whose density is below the given quantile of the
+// densities, together with their triangles.
+void TrimByDensity(TriangleMesh& mesh,
+                   std::vector<double>& densities,
+                   double density_quantile) {
+    if (density_quantile <= 0 || densities.empty()) {
+        return;
+    }
+    std::vector<double> sorted_densities = densities;
+    auto nth = sorted_densities.begin() +
+               static_cast<size_t>(density_quantile *
+                                   (sorted_densities.size() - 1));
+    std::nth_element(sorted_densities.begin(), nth, sorted_densities.end());
+    double threshold = *nth;
+
+    std::vector<bool> vertex_mask(densities.size());
+    size_t num_kept = 0;
+    for (size_t vidx = 0; vidx < densities.size(); ++vidx) {
+        vertex_mask[vidx] = densities[vidx] < threshold;
+        if (!vertex_mask[vidx]) {
+            densities[num_kept++] = densities[vidx];
+        }
+    }
+    densities.resize(num_kept);
+    mesh.RemoveVerticesByMask(vertex_mask);
+}
+
 }  // namespace poisson
 
 std::tuple<std::shared_ptr<TriangleMesh>, std::vector<double>>
@@ -731,7 +779,8 @@ TriangleMesh::CreateFromPointCloudPoisson(const PointCloud& pcd,
                                           size_t width,
                                           float scale,
                                           bool linear_fit,
-                                          int n_threads) {
+                                          int n_threads,
+                                          double density_quantile) {
     static const BoundaryType BType = poisson::DEFAULT_FEM_BOUNDARY;
     typedef IsotropicUIntPack<
             poisson::DIMENSION,
@@ -741,9 +790,15 @@ TriangleMesh::CreateFromPointCloudPoisson(const PointCloud& pcd,
     if (!pcd.HasNormals()) {
         utility::LogError("[CreateFromPointCloudPoisson] pcd has no normals");
     }
+    if (density_quantile < 0 || density_quantile >= 1) {
+        utility::LogError(
+                "[CreateFromPointCloudPoisson] density_quantile (={}) has to "
+                "be in [0, 1)",
+                density_quantile);
+    }
 
     if (n_threads <= 0) {
-        n_threads = (int)std::thread::hardware_concurrency();
+        n_threads = utility::EstimateMaxThreads();
     }
 
 #ifdef _OPENMP
@@ -757,10 +812,185 @@ TriangleMesh::CreateFromPointCloudPoisson(const PointCloud& pcd,
     auto mesh = std::make_shared<TriangleMesh>();
     std::vector<double> densities;
     poisson::Execute<float>(pcd, mesh, densities, static_cast<int>(depth),
-                            width, scale, linear_fit, FEMSigs());
+                            width, scale, linear_fit, Eigen::Vector3d::Zero(),
+                            0, FEMSigs());
+
+    ThreadPool::Terminate();
+
+    poisson::TrimByDensity(*mesh, densities, density_quantile);
+    return std::make_tuple(mesh, densities);
+}
+
+std::tuple<std::shared_ptr<TriangleMesh>, std::vector<double>>
+TriangleMesh::CreateFromPointCloudPoissonTiled(const PointCloud& pcd,
+                                               double tile_size,
+                                               double overlap,
+                                               size_t depth,
+                                               bool linear_fit,
+                                               int n_threads,
+                                               double density_quantile) {
+    static const BoundaryType BType = poisson::DEFAULT_FEM_BOUNDARY;
+    typedef IsotropicUIntPack<
+            poisson::DIMENSION,
+            FEMDegreeAndBType</* Degree */ 1, BType>::Signature>
+            FEMSigs;
+
+    if (!pcd.HasNormals()) {
+        utility::LogError(
+                "[CreateFromPointCloudPoissonTiled] pcd has no normals");
+    }
+    if (tile_size <= 0 || overlap < 0) {
+        utility::LogError(
+                "[CreateFromPointCloudPoissonTiled] tile_size (={}) has to be "
+                "positive and overlap (={}) non-negative",
+                tile_size, overlap);
+    }
+    if (density_quantile < 0 || density_quantile >= 1) {
+        utility::LogError(
+                "[CreateFromPointCloudPoissonTiled] density_quantile (={}) has "
+                "to be in [0, 1)",
+                density_quantile);
+    }
+    if (depth < 2 || depth > 30) {
+        utility::LogError(
+                "[CreateFromPointCloudPoissonTiled] depth (={}) has to be in "
+                "[2, 30]",
+                depth);
+    }
+
+    // Each tile is reconstructed in a cube that extends it by at least
+    // overlap on every side. The cubes are sized so that the tiles span a
+    // whole number of finest cells, which aligns the grids of all the tiles.
+    double num_cells = double(size_t(1) << depth);
+    double num_tile_cells =
+            std::floor(num_cells * tile_size / (tile_size + 2 * overlap));
+    if (num_tile_cells < 1) {
+        utility::LogError(
+                "[CreateFromPointCloudPoissonTiled] overlap (={}) is too "
+                "large for tile_size (={}) at depth {}",
+                overlap, tile_size, depth);
+    }
+    double cube_size = num_cells * tile_size / num_tile_cells;
+    double margin = (cube_size - tile_size) / 2;
+
+    // Assign each point to the tiles whose cube contains it, and only
+    // reconstruct the tiles that contain points themselves.
+    const Eigen::Vector3d min_bound = pcd.GetMinBound();
+    const Eigen::Vector3i num_tiles =
+            ((pcd.GetMaxBound() - min_bound) / tile_size)
+                    .array()
+                    .floor()
+                    .cast<int>()
+                    .matrix() +
+            Eigen::Vector3i::Ones();
+    std::unordered_map<Eigen::Vector3i, std::vector<size_t>,
+                       utility::hash_eigen<Eigen::Vector3i>>
+            tile_points;
+    std::unordered_set<Eigen::Vector3i, utility::hash_eigen<Eigen::Vector3i>>
+            core_tiles;
+    for (size_t pidx = 0; pidx < pcd.points_.size(); ++pidx) {
+        Eigen::Array3d rel = (pcd.points_[pidx] - min_bound) / tile_size;
+        Eigen::Array3i lo = (rel - margin / tile_size).floor().cast<int>();
+        Eigen::Array3i hi = (rel + margin / tile_size).floor().cast<int>();
+        lo = lo.max(0);
+        hi = hi.min(num_tiles.array() - 1);
+        for (int x = lo(0); x <= hi(0); ++x) {
+            for (int y = lo(1); y <= hi(1); ++y) {
+                for (int z = lo(2); z <= hi(2); ++z) {
+                    tile_points[Eigen::Vector3i(x, y, z)].push_back(pidx);
+                }
+            }
+        }
+        core_tiles.insert(
+                rel.floor().cast<int>().min(num_tiles.array() - 1).matrix());
+    }
+    std::vector<Eigen::Vector3i> tiles(core_tiles.begin(), core_tiles.end());
+    std::sort(tiles.begin(), tiles.end(),
+              [](const Eigen::Vector3i& a, const Eigen::Vector3i& b) {
+                  return std::make_tuple(a(0), a(1), a(2)) <
+                         std::make_tuple(b(0), b(1), b(2));
+              });
+
+    if (n_threads <= 0) {
+        n_threads = utility::EstimateMaxThreads();
+    }
+
+#ifdef _OPENMP
+    ThreadPool::Init((ThreadPool::ParallelType)(int)ThreadPool::OPEN_MP,
+                     n_threads);
+#else
+    ThreadPool::Init((ThreadPool::ParallelType)(int)ThreadPool::THREAD_POOL,
+                     n_threads);
+#endif
+
+    // The tiles are reconstructed one after the other, each with all the
+    // threads, so that only one octree is in memory at a time. Each tile
+    // keeps the triangles whose centroid lies in the tile, where the tiles on
+    // the border extend to infinity.
+    auto mesh = std::make_shared<TriangleMesh>();
+    std::vector<double> densities;
+    const double inf = std::numeric_limits<double>::infinity();
+    for (const Eigen::Vector3i& tile : tiles) {
+        auto tile_pcd = pcd.SelectByIndex(tile_points[tile]);
+        std::vector<size_t>().swap(tile_points[tile]);
+        Eigen::Vector3d tile_min = min_bound + tile.cast<double>() * tile_size;
+        auto tile_mesh = std::make_shared<TriangleMesh>();
+        std::vector<double> tile_densities;
+        poisson::Execute<float>(*tile_pcd, tile_mesh, tile_densities,
+                                static_cast<int>(depth), 0, 0, linear_fit,
+                                tile_min - Eigen::Vector3d::Constant(margin),
+                                cube_size,
+                                FEMSigs());
+
+        Eigen::Vector3d core_min = tile_min, core_max;
+        for (int i = 0; i < 3; ++i) {
+            core_max(i) = tile(i) == num_tiles(i) - 1 ? inf
+                                                      : tile_min(i) + tile_size;
+            if (tile(i) == 0) {
+                core_min(i) = -inf;
+            }
+        }
+        std::vector<int> vertex_map(tile_mesh->vertices_.size(), -1);
+        for (const Eigen::Vector3i& triangle : tile_mesh->triangles_) {
+            Eigen::Vector3d centroid = (tile_mesh->vertices_[triangle(0)] +
+                                        tile_mesh->vertices_[triangle(1)] +
+                                        tile_mesh->vertices_[triangle(2)]) /
+                                       3;
+            if ((centroid.array() < core_min.array()).any() ||
+                (centroid.array() >= core_max.array()).any()) {
+                continue;
+            }
+            Eigen::Vector3i new_triangle;
+            for (int k = 0; k < 3; ++k) {
+                int& vidx = vertex_map[triangle(k)];
+                if (vidx < 0) {
+                    vidx = static_cast<int>(mesh->vertices_.size());
+                    mesh->vertices_.push_back(
+                            tile_mesh->vertices_[triangle(k)]);
+                    if (tile_mesh->HasVertexNormals()) {
+                        mesh->vertex_normals_.push_back(
+                                tile_mesh->vertex_normals_[triangle(k)]);
+                    }
+                    if (tile_mesh->HasVertexColors()) {
+                        mesh->vertex_colors_.push_back(
+                                tile_mesh->vertex_colors_[triangle(k)]);
+                    }
+                    densities.push_back(tile_densities[triangle(k)]);
+                }
+                new_triangle(k) = vidx;
+            }
+            mesh->triangles_.push_back(new_triangle);
+        }
+        utility::LogDebug(
+                "[CreateFromPointCloudPoissonTiled] Tile ({:d}, {:d}, {:d}): "
+                "{:d} points, {:d} triangles in total",
+                tile(0), tile(1), tile(2), tile_pcd->points_.size(),
+                mesh->triangles_.size());
+    }
 
     ThreadPool::Terminate();
 
+    poisson::TrimByDensity(*mesh, densities, density_quantile);
     return std::make_tuple(mesh, densities);
 }
 
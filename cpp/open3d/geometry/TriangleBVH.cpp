@@ -0,0 +1,278 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/TriangleBVH.h"
+
+#include <tbb/parallel_invoke.h>
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace geometry {
+
+namespace {
+
+/// Subtrees with fewer triangles are built serially.
+constexpr int kParallelBuildSize = 4096;
+
+/// Number of nodes of a subtree with count triangles. The sizes of the
+/// subtrees at one level differ by at most one, so a level is described by
+/// the numbers of subtrees of size k and k + 1.
+int NumSubtreeNodes(size_t count, size_t max_leaf_size) {
+    size_t k = count;
+    size_t num_k = 1;
+    size_t num_k1 = 0;
+    size_t num_nodes = 0;
+    while (num_k + num_k1 > 0) {
+        num_nodes += num_k + num_k1;
+        const size_t split_k = k > max_leaf_size ? num_k : 0;
+        const size_t split_k1 = k + 1 > max_leaf_size ? num_k1 : 0;
+        if (k % 2 == 0) {
+            num_k = 2 * split_k + split_k1;
+            num_k1 = split_k1;
+        } else {
+            num_k = split_k;
+            num_k1 = split_k + 2 * split_k1;
+        }
+        k /= 2;
+    }
+    return int(num_nodes);
+}
+
+double SquaredDistanceToAABB(const Eigen::Vector3d &point,
+                             const Eigen::Vector3d &min_bound,
+                             const Eigen::Vector3d &max_bound) {
+    return (point.cwiseMax(min_bound).cwiseMin(max_bound) - point)
+            .squaredNorm();
+}
+
+Eigen::Vector3d ClosestPointOnSegment(const Eigen::Vector3d &p,
+                                      const Eigen::Vector3d &a,
+                                      const Eigen::Vector3d &b) {
+    const Eigen::Vector3d ab = b - a;
+    const double length2 = ab.squaredNorm();
+    if (length2 == 0) {
+        return a;
+    }
+    const double t = std::min(std::max((p - a).dot(ab) / length2, 0.0), 1.0);
+    return a + t * ab;
+}
+
+/// Closest point on the triangle (a, b, c) to p, from Ericson, Real-Time
+/// Collision Detection, Section 5.1.5.
+Eigen::Vector3d ClosestPointOnTriangle(const Eigen::Vector3d &p,
+                                       const Eigen::Vector3d &a,
+                                       const Eigen::Vector3d &b,
+                                       const Eigen::Vector3d &c) {
+    const Eigen::Vector3d ab = b - a;
+    const Eigen::Vector3d ac = c - a;
+    const Eigen::Vector3d ap = p - a;
+    const double d1 = ab.dot(ap);
+    const double d2 = ac.dot(ap);
+    if (d1 <= 0 && d2 <= 0) {
+        return a;
+    }
+    const Eigen::Vector3d bp = p - b;
+    const double d3 = ab.dot(bp);
+    const double d4 = ac.dot(bp);
+    if (d3 >= 0 && d4 <= d3) {
+        return b;
+    }
+    const double vc = d1 * d4 - d3 * d2;
+    if (vc <= 0 && d1 >= 0 && d3 <= 0) {
+        return a + d1 / (d1 - d3) * ab;
+    }
+    const Eigen::Vector3d cp = p - c;
+    const double d5 = ab.dot(cp);
+    const double d6 = ac.dot(cp);
+    if (d6 >= 0 && d5 <= d6) {
+        return c;
+    }
+    const double vb = d5 * d2 - d1 * d6;
+    if (vb <= 0 && d2 >= 0 && d6 <= 0) {
+        return a + d2 / (d2 - d6) * ac;
+    }
+    const double va = d3 * d6 - d5 * d4;
+    if (va <= 0 && d4 - d3 >= 0 && d5 - d6 >= 0) {
+        return b + (d4 - d3) / ((d4 - d3) + (d5 - d6)) * (c - b);
+    }
+    const double denom = va + vb + vc;
+    if (denom == 0) {
+        // Degenerate triangle, take the closest point on its edges.
+        Eigen::Vector3d best = ClosestPointOnSegment(p, a, b);
+        for (const Eigen::Vector3d &q :
+             {ClosestPointOnSegment(p, b, c), ClosestPointOnSegment(p, c, a)}) {
+            if ((q - p).squaredNorm() < (best - p).squaredNorm()) {
+                best = q;
+            }
+        }
+        return best;
+    }
+    return a + vb / denom * ab + vc / denom * ac;
+}
+
+}  // unnamed namespace
+
+TriangleBVH::TriangleBVH(const std::vector<Eigen::Vector3d> &vertices,
+                         const std::vector<Eigen::Vector3i> &triangles,
+                         size_t max_leaf_size) {
+    Build(vertices, triangles, max_leaf_size);
+}
+
+void TriangleBVH::Build(const std::vector<Eigen::Vector3d> &vertices,
+                        const std::vector<Eigen::Vector3i> &triangles,
+                        size_t max_leaf_size) {
+    vertices_ = vertices;
+    triangles_ = triangles;
+    nodes_.clear();
+    order_.clear();
+    triangle_min_bounds_.resize(triangles_.size());
+    triangle_max_bounds_.resize(triangles_.size());
+    if (triangles_.empty()) {
+        return;
+    }
+    max_leaf_size = std::max(max_leaf_size, size_t(1));
+
+    std::vector<Eigen::Vector3d> centroids(triangles_.size());
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int tidx = 0; tidx < int(triangles_.size()); ++tidx) {
+        const Eigen::Vector3i &triangle = triangles_[tidx];
+        const Eigen::Vector3d &v0 = vertices_[triangle(0)];
+        const Eigen::Vector3d &v1 = vertices_[triangle(1)];
+        const Eigen::Vector3d &v2 = vertices_[triangle(2)];
+        triangle_min_bounds_[tidx] = v0.cwiseMin(v1).cwiseMin(v2);
+        triangle_max_bounds_[tidx] = v0.cwiseMax(v1).cwiseMax(v2);
+        centroids[tidx] = (v0 + v1 + v2) / 3;
+    }
+
+    order_.resize(triangles_.size());
+    std::iota(order_.begin(), order_.end(), 0);
+    nodes_.resize(NumSubtreeNodes(triangles_.size(), max_leaf_size));
+    BuildNode(centroids, 0, 0, int(triangles_.size()), max_leaf_size);
+}
+
+void TriangleBVH::BuildNode(const std::vector<Eigen::Vector3d> &centroids,
+                            int node,
+                            int begin,
+                            int end,
+                            size_t max_leaf_size) {
+    Node &n = nodes_[node];
+    n.min_bound_ = triangle_min_bounds_[order_[begin]];
+    n.max_bound_ = triangle_max_bounds_[order_[begin]];
+    Eigen::Vector3d centroid_min = centroids[order_[begin]];
+    Eigen::Vector3d centroid_max = centroid_min;
+    for (int i = begin + 1; i < end; ++i) {
+        const int tidx = order_[i];
+        n.min_bound_ = n.min_bound_.cwiseMin(triangle_min_bounds_[tidx]);
+        n.max_bound_ = n.max_bound_.cwiseMax(triangle_max_bounds_[tidx]);
+        centroid_min = centroid_min.cwiseMin(centroids[tidx]);
+        centroid_max = centroid_max.cwiseMax(centroids[tidx]);
+    }
+    if (size_t(end - begin) <= max_leaf_size) {
+        n.first_ = begin;
+        n.count_ = end - begin;
+        return;
+    }
+
+    int axis;
+    (centroid_max - centroid_min).maxCoeff(&axis);
+    const int mid = begin + (end - begin) / 2;
+    std::nth_element(order_.begin() + begin, order_.begin() + mid,
+                     order_.begin() + end, [&](int lhs, int rhs) {
+                         return centroids[lhs](axis) < centroids[rhs](axis);
+                     });
+    const int left = node + 1;
+    const int right = left + NumSubtreeNodes(mid - begin, max_leaf_size);
+    n.first_ = right;
+    n.count_ = 0;
+    if (end - begin >= kParallelBuildSize) {
+        tbb::parallel_invoke(
+                [&] { BuildNode(centroids, left, begin, mid, max_leaf_size); },
+                [&] { BuildNode(centroids, right, mid, end, max_leaf_size); });
+    } else {
+        BuildNode(centroids, left, begin, mid, max_leaf_size);
+        BuildNode(centroids, right, mid, end, max_leaf_size);
+    }
+}
+
+std::tuple<int, Eigen::Vector3d, double> TriangleBVH::ComputeClosestPoint(
+        const Eigen::Vector3d &query, double max_distance) const {
+    int closest_triangle = -1;
+    Eigen::Vector3d closest_point(0, 0, 0);
+    double closest_distance2 = max_distance * max_distance;
+    if (nodes_.empty()) {
+        return std::make_tuple(closest_triangle, closest_point,
+                               closest_distance2);
+    }
+
+    int stack[64];
+    int top = 0;
+    stack[top++] = 0;
+    while (top > 0) {
+        const int node = stack[--top];
+        const Node &n = nodes_[node];
+        if (SquaredDistanceToAABB(query, n.min_bound_, n.max_bound_) >=
+            closest_distance2) {
+            continue;
+        }
+        if (n.count_ > 0) {
+            for (int i = n.first_; i < n.first_ + n.count_; ++i) {
+                const Eigen::Vector3i &triangle = triangles_[order_[i]];
+                const Eigen::Vector3d point = ClosestPointOnTriangle(
+                        query, vertices_[triangle(0)], vertices_[triangle(1)],
+                        vertices_[triangle(2)]);
+                const double distance2 = (point - query).squaredNorm();
+                if (distance2 < closest_distance2) {
+                    closest_triangle = order_[i];
+                    closest_point = point;
+                    closest_distance2 = distance2;
+                }
+            }
+        } else {
+            // Push the farther child first to visit the nearer one first.
+            const int left = node + 1;
+            const int right = n.first_;
+            const Node &l = nodes_[left];
+            const Node &r = nodes_[right];
+            if (SquaredDistanceToAABB(query, l.min_bound_, l.max_bound_) <
+                SquaredDistanceToAABB(query, r.min_bound_, r.max_bound_)) {
+                stack[top++] = right;
+                stack[top++] = left;
+            } else {
+                stack[top++] = left;
+                stack[top++] = right;
+            }
+        }
+    }
+    return std::make_tuple(closest_triangle, closest_point, closest_distance2);
+}
+
+}  // namespace geometry
+}  // namespace open3d
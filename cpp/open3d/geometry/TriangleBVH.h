@@ -0,0 +1,167 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <limits>
+#include <tuple>
+#include <vector>
+
+namespace open3d {
+namespace geometry {
+
+/// \class TriangleBVH
+///
+/// \brief Bounding volume hierarchy over the axis-aligned bounding boxes of
+/// the triangles of a mesh.
+///
+/// The tree is built top-down by splitting the triangles at the median of
+/// their centroids along the longest axis of the centroid bounds, so that it
+/// is balanced and has a depth of about log2(#triangles / max_leaf_size).
+/// The size of every subtree then only depends on its number of triangles,
+/// so the subtrees are built in parallel into preallocated nodes.
+/// The nodes are stored in depth-first order: the left child of an internal
+/// node directly follows it. The BVH keeps a copy of the vertices and
+/// triangles, so it stays valid when the mesh is modified.
+class TriangleBVH {
+public:
+    /// \brief Default Constructor.
+    TriangleBVH() {}
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param vertices Vertex coordinates of the mesh.
+    /// \param triangles Vertex indices of the triangles of the mesh.
+    /// \param max_leaf_size Maximum number of triangles in a leaf.
+    TriangleBVH(const std::vector<Eigen::Vector3d> &vertices,
+                const std::vector<Eigen::Vector3i> &triangles,
+                size_t max_leaf_size = 4);
+
+public:
+    /// Builds the BVH over the triangles, replacing the previous one.
+    void Build(const std::vector<Eigen::Vector3d> &vertices,
+               const std::vector<Eigen::Vector3i> &triangles,
+               size_t max_leaf_size = 4);
+
+    /// Returns true if the BVH has no triangles.
+    bool IsEmpty() const { return nodes_.empty(); }
+    /// Number of nodes, including the internal ones.
+    size_t NumNodes() const { return nodes_.size(); }
+
+    /// \brief Calls f with the index of each triangle whose bounding box
+    /// overlaps the box [min_bound, max_bound], until f returns true.
+    ///
+    /// Boxes that only touch are overlapping. Returns true if the query was
+    /// stopped by f.
+    template <typename F>
+    bool QueryAABB(const Eigen::Vector3d &min_bound,
+                   const Eigen::Vector3d &max_bound,
+                   F f) const {
+        if (nodes_.empty()) {
+            return false;
+        }
+        // The depth is logarithmic in the number of triangles, so a small
+        // fixed stack is enough.
+        int stack[64];
+        int top = 0;
+        stack[top++] = 0;
+        while (top > 0) {
+            const int node = stack[--top];
+            const Node &n = nodes_[node];
+            if ((n.min_bound_.array() > max_bound.array()).any() ||
+                (n.max_bound_.array() < min_bound.array()).any()) {
+                continue;
+            }
+            if (n.count_ > 0) {
+                for (int i = n.first_; i < n.first_ + n.count_; ++i) {
+                    const int tidx = order_[i];
+                    if ((triangle_min_bounds_[tidx].array() <=
+                         max_bound.array())
+                                .all() &&
+                        (triangle_max_bounds_[tidx].array() >=
+                         min_bound.array())
+                                .all() &&
+                        f(tidx)) {
+                        return true;
+                    }
+                }
+            } else {
+                stack[top++] = n.first_;
+                stack[top++] = node + 1;
+            }
+        }
+        return false;
+    }
+
+    /// \brief Finds the closest point on the triangles to a query point.
+    ///
+    /// Returns the index of the closest triangle, the closest point on it
+    /// and the squared distance to the query. The index is -1 if no triangle
+    /// is closer than max_distance, e.g. if the BVH is empty.
+    ///
+    /// \param query Query point.
+    /// \param max_distance Only the triangles closer than max_distance are
+    /// considered, so that the farther subtrees are skipped.
+    std::tuple<int, Eigen::Vector3d, double> ComputeClosestPoint(
+            const Eigen::Vector3d &query,
+            double max_distance =
+                    std::numeric_limits<double>::infinity()) const;
+
+protected:
+    /// A node is a leaf if count_ > 0, and then holds the triangles
+    /// order_[first_, first_ + count_). Otherwise, first_ is the index of
+    /// its right child.
+    struct Node {
+        Eigen::Vector3d min_bound_;
+        Eigen::Vector3d max_bound_;
+        int first_;
+        int count_;
+    };
+
+    /// Builds the subtree of node over the triangles order_[begin, end).
+    void BuildNode(const std::vector<Eigen::Vector3d> &centroids,
+                   int node,
+                   int begin,
+                   int end,
+                   size_t max_leaf_size);
+
+public:
+    /// Vertex coordinates of the mesh.
+    std::vector<Eigen::Vector3d> vertices_;
+    /// Vertex indices of the triangles of the mesh.
+    std::vector<Eigen::Vector3i> triangles_;
+
+protected:
+    std::vector<Node> nodes_;
+    /// Triangle indices in the order of the leaves.
+    std::vector<int> order_;
+    /// Bounding boxes of the triangles.
+    std::vector<Eigen::Vector3d> triangle_min_bounds_;
+    std::vector<Eigen::Vector3d> triangle_max_bounds_;
+};
+
+}  // namespace geometry
+}  // namespace open3d
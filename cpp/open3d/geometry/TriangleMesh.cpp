@@ -26,18 +26,27 @@
 
 #include "open3d/geometry/TriangleMesh.h"
 
+#include <tbb/parallel_sort.h>
+
 #include <Eigen/Dense>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
 #include <numeric>
 #include <queue>
 #include <random>
 #include <tuple>
 
 #include "open3d/geometry/BoundingVolume.h"
+#include "open3d/geometry/ConcurrentUnionFind.h"
+#include "open3d/geometry/HalfEdgeTriangleMesh.h"
 #include "open3d/geometry/IntersectionTest.h"
 #include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/Qhull.h"
+#include "open3d/geometry/TriangleBVH.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
@@ -151,230 +160,144 @@ TriangleMesh &TriangleMesh::ComputeAdjacencyList() {
     return *this;
 }
 
-std::shared_ptr<TriangleMesh> TriangleMesh::FilterSharpen(
-        int number_of_iterations, double strength, FilterScope scope) const {
-    bool filter_vertex =
-            scope == FilterScope::All || scope == FilterScope::Vertex;
-    bool filter_normal =
-            (scope == FilterScope::All || scope == FilterScope::Normal) &&
-            HasVertexNormals();
-    bool filter_color =
-            (scope == FilterScope::All || scope == FilterScope::Color) &&
-            HasVertexColors();
-
-    std::vector<Eigen::Vector3d> prev_vertices = vertices_;
-    std::vector<Eigen::Vector3d> prev_vertex_normals = vertex_normals_;
-    std::vector<Eigen::Vector3d> prev_vertex_colors = vertex_colors_;
+namespace {
+
+/// Vertex filters of FilterSharpen, FilterSmoothSimple and
+/// FilterSmoothLaplacian / FilterSmoothTaubin.
+enum class NeighborFilter { Sharpen, Simple, Laplacian };
+
+/// One step of a filter of the vertices: the filter and its strength, or
+/// lambda / mu for the Laplacian.
+typedef std::pair<NeighborFilter, double> FilterStep;
+
+/// Filters the vertex attributes of mesh in the scope, running all the steps
+/// in each iteration. The adjacency lists are flattened once to compressed
+/// sparse row arrays, and each step reads the attributes of the previous one
+/// and writes the other buffer, in parallel over the vertices. The weights of
+/// the Laplacian depend on the vertex positions only, so they are computed
+/// once per step for all the attributes.
+std::shared_ptr<TriangleMesh> FilterVertices(
+        const TriangleMesh &input,
+        int number_of_iterations,
+        const std::vector<FilterStep> &steps,
+        MeshBase::FilterScope scope) {
+    bool filter_vertex = scope == MeshBase::FilterScope::All ||
+                         scope == MeshBase::FilterScope::Vertex;
+    bool filter_normal = (scope == MeshBase::FilterScope::All ||
+                          scope == MeshBase::FilterScope::Normal) &&
+                         input.HasVertexNormals();
+    bool filter_color = (scope == MeshBase::FilterScope::All ||
+                         scope == MeshBase::FilterScope::Color) &&
+                        input.HasVertexColors();
 
     std::shared_ptr<TriangleMesh> mesh = std::make_shared<TriangleMesh>();
-    mesh->vertices_.resize(vertices_.size());
-    mesh->vertex_normals_.resize(vertex_normals_.size());
-    mesh->vertex_colors_.resize(vertex_colors_.size());
-    mesh->triangles_ = triangles_;
-    mesh->adjacency_list_ = adjacency_list_;
+    mesh->vertices_ = input.vertices_;
+    mesh->vertex_normals_ = input.vertex_normals_;
+    mesh->vertex_colors_ = input.vertex_colors_;
+    mesh->triangles_ = input.triangles_;
+    mesh->adjacency_list_ = input.adjacency_list_;
     if (!mesh->HasAdjacencyList()) {
         mesh->ComputeAdjacencyList();
     }
 
-    for (int iter = 0; iter < number_of_iterations; ++iter) {
-        for (size_t vidx = 0; vidx < mesh->vertices_.size(); ++vidx) {
-            Eigen::Vector3d vertex_sum(0, 0, 0);
-            Eigen::Vector3d normal_sum(0, 0, 0);
-            Eigen::Vector3d color_sum(0, 0, 0);
-            for (int nbidx : mesh->adjacency_list_[vidx]) {
-                if (filter_vertex) {
-                    vertex_sum += prev_vertices[nbidx];
-                }
-                if (filter_normal) {
-                    normal_sum += prev_vertex_normals[nbidx];
-                }
-                if (filter_color) {
-                    color_sum += prev_vertex_colors[nbidx];
-                }
+    const int num_vertices = int(mesh->vertices_.size());
+    std::vector<int> offsets(num_vertices + 1, 0);
+    for (int vidx = 0; vidx < num_vertices; ++vidx) {
+        offsets[vidx + 1] =
+                offsets[vidx] + int(mesh->adjacency_list_[vidx].size());
+    }
+    std::vector<int> neighbors(offsets[num_vertices]);
+    for (int vidx = 0; vidx < num_vertices; ++vidx) {
+        std::copy(mesh->adjacency_list_[vidx].begin(),
+                  mesh->adjacency_list_[vidx].end(),
+                  neighbors.begin() + offsets[vidx]);
+    }
+
+    std::vector<double> weights;
+    auto FilterAttribute = [&](const FilterStep &step,
+                               std::vector<Eigen::Vector3d> &values,
+                               std::vector<Eigen::Vector3d> &buffer) {
+        buffer.resize(values.size());
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+        for (int vidx = 0; vidx < num_vertices; ++vidx) {
+            Eigen::Vector3d sum(0, 0, 0);
+            double total_weight = 0;
+            for (int k = offsets[vidx]; k < offsets[vidx + 1]; ++k) {
+                double weight = weights.empty() ? 1.0 : weights[k];
+                sum += weight * values[neighbors[k]];
+                total_weight += weight;
             }
-
-            size_t nb_size = mesh->adjacency_list_[vidx].size();
-            if (filter_vertex) {
-                mesh->vertices_[vidx] =
-                        prev_vertices[vidx] +
-                        strength * (prev_vertices[vidx] * nb_size - vertex_sum);
-            }
-            if (filter_normal) {
-                mesh->vertex_normals_[vidx] =
-                        prev_vertex_normals[vidx] +
-                        strength * (prev_vertex_normals[vidx] * nb_size -
-                                    normal_sum);
-            }
-            if (filter_color) {
-                mesh->vertex_colors_[vidx] =
-                        prev_vertex_colors[vidx] +
-                        strength * (prev_vertex_colors[vidx] * nb_size -
-                                    color_sum);
+            const Eigen::Vector3d &value = values[vidx];
+            switch (step.first) {
+                case NeighborFilter::Sharpen:
+                    buffer[vidx] =
+                            value + step.second * (value * total_weight - sum);
+                    break;
+                case NeighborFilter::Simple:
+                    buffer[vidx] = (value + sum) / (1 + total_weight);
+                    break;
+                case NeighborFilter::Laplacian:
+                    buffer[vidx] = value;
+                    if (total_weight > 0) {
+                        buffer[vidx] +=
+                                step.second * (sum / total_weight - value);
+                    }
+                    break;
             }
         }
-        if (iter < number_of_iterations - 1) {
-            std::swap(mesh->vertices_, prev_vertices);
-            std::swap(mesh->vertex_normals_, prev_vertex_normals);
-            std::swap(mesh->vertex_colors_, prev_vertex_colors);
-        }
-    }
-
-    return mesh;
-}
-
-std::shared_ptr<TriangleMesh> TriangleMesh::FilterSmoothSimple(
-        int number_of_iterations, FilterScope scope) const {
-    bool filter_vertex =
-            scope == FilterScope::All || scope == FilterScope::Vertex;
-    bool filter_normal =
-            (scope == FilterScope::All || scope == FilterScope::Normal) &&
-            HasVertexNormals();
-    bool filter_color =
-            (scope == FilterScope::All || scope == FilterScope::Color) &&
-            HasVertexColors();
-
-    std::vector<Eigen::Vector3d> prev_vertices = vertices_;
-    std::vector<Eigen::Vector3d> prev_vertex_normals = vertex_normals_;
-    std::vector<Eigen::Vector3d> prev_vertex_colors = vertex_colors_;
-
-    std::shared_ptr<TriangleMesh> mesh = std::make_shared<TriangleMesh>();
-    mesh->vertices_.resize(vertices_.size());
-    mesh->vertex_normals_.resize(vertex_normals_.size());
-    mesh->vertex_colors_.resize(vertex_colors_.size());
-    mesh->triangles_ = triangles_;
-    mesh->adjacency_list_ = adjacency_list_;
-    if (!mesh->HasAdjacencyList()) {
-        mesh->ComputeAdjacencyList();
-    }
+        std::swap(values, buffer);
+    };
 
+    std::vector<Eigen::Vector3d> buffer;
     for (int iter = 0; iter < number_of_iterations; ++iter) {
-        for (size_t vidx = 0; vidx < mesh->vertices_.size(); ++vidx) {
-            Eigen::Vector3d vertex_sum(0, 0, 0);
-            Eigen::Vector3d normal_sum(0, 0, 0);
-            Eigen::Vector3d color_sum(0, 0, 0);
-            for (int nbidx : mesh->adjacency_list_[vidx]) {
-                if (filter_vertex) {
-                    vertex_sum += prev_vertices[nbidx];
-                }
-                if (filter_normal) {
-                    normal_sum += prev_vertex_normals[nbidx];
-                }
-                if (filter_color) {
-                    color_sum += prev_vertex_colors[nbidx];
+        for (const FilterStep &step : steps) {
+            weights.clear();
+            if (step.first == NeighborFilter::Laplacian) {
+                weights.resize(neighbors.size());
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+                for (int vidx = 0; vidx < num_vertices; ++vidx) {
+                    for (int k = offsets[vidx]; k < offsets[vidx + 1]; ++k) {
+                        double dist = (mesh->vertices_[vidx] -
+                                       mesh->vertices_[neighbors[k]])
+                                              .norm();
+                        weights[k] = 1. / (dist + 1e-12);
+                    }
                 }
             }
-
-            size_t nb_size = mesh->adjacency_list_[vidx].size();
-            if (filter_vertex) {
-                mesh->vertices_[vidx] =
-                        (prev_vertices[vidx] + vertex_sum) / (1 + nb_size);
-            }
             if (filter_normal) {
-                mesh->vertex_normals_[vidx] =
-                        (prev_vertex_normals[vidx] + normal_sum) /
-                        (1 + nb_size);
+                FilterAttribute(step, mesh->vertex_normals_, buffer);
             }
             if (filter_color) {
-                mesh->vertex_colors_[vidx] =
-                        (prev_vertex_colors[vidx] + color_sum) / (1 + nb_size);
+                FilterAttribute(step, mesh->vertex_colors_, buffer);
+            }
+            if (filter_vertex) {
+                FilterAttribute(step, mesh->vertices_, buffer);
             }
-        }
-        if (iter < number_of_iterations - 1) {
-            std::swap(mesh->vertices_, prev_vertices);
-            std::swap(mesh->vertex_normals_, prev_vertex_normals);
-            std::swap(mesh->vertex_colors_, prev_vertex_colors);
         }
     }
     return mesh;
 }
 
-void TriangleMesh::FilterSmoothLaplacianHelper(
-        std::shared_ptr<TriangleMesh> &mesh,
-        const std::vector<Eigen::Vector3d> &prev_vertices,
-        const std::vector<Eigen::Vector3d> &prev_vertex_normals,
-        const std::vector<Eigen::Vector3d> &prev_vertex_colors,
-        const std::vector<std::unordered_set<int>> &adjacency_list,
-        double lambda,
-        bool filter_vertex,
-        bool filter_normal,
-        bool filter_color) const {
-    for (size_t vidx = 0; vidx < mesh->vertices_.size(); ++vidx) {
-        Eigen::Vector3d vertex_sum(0, 0, 0);
-        Eigen::Vector3d normal_sum(0, 0, 0);
-        Eigen::Vector3d color_sum(0, 0, 0);
-        double total_weight = 0;
-        for (int nbidx : mesh->adjacency_list_[vidx]) {
-            auto diff = prev_vertices[vidx] - prev_vertices[nbidx];
-            double dist = diff.norm();
-            double weight = 1. / (dist + 1e-12);
-            total_weight += weight;
+}  // unnamed namespace
 
-            if (filter_vertex) {
-                vertex_sum += weight * prev_vertices[nbidx];
-            }
-            if (filter_normal) {
-                normal_sum += weight * prev_vertex_normals[nbidx];
-            }
-            if (filter_color) {
-                color_sum += weight * prev_vertex_colors[nbidx];
-            }
-        }
+std::shared_ptr<TriangleMesh> TriangleMesh::FilterSharpen(
+        int number_of_iterations, double strength, FilterScope scope) const {
+    return FilterVertices(*this, number_of_iterations,
+                          {FilterStep(NeighborFilter::Sharpen, strength)},
+                          scope);
+}
 
-        if (filter_vertex) {
-            mesh->vertices_[vidx] =
-                    prev_vertices[vidx] +
-                    lambda * (vertex_sum / total_weight - prev_vertices[vidx]);
-        }
-        if (filter_normal) {
-            mesh->vertex_normals_[vidx] = prev_vertex_normals[vidx] +
-                                          lambda * (normal_sum / total_weight -
-                                                    prev_vertex_normals[vidx]);
-        }
-        if (filter_color) {
-            mesh->vertex_colors_[vidx] = prev_vertex_colors[vidx] +
-                                         lambda * (color_sum / total_weight -
-                                                   prev_vertex_colors[vidx]);
-        }
-    }
+std::shared_ptr<TriangleMesh> TriangleMesh::FilterSmoothSimple(
+        int number_of_iterations, FilterScope scope) const {
+    return FilterVertices(*this, number_of_iterations,
+                          {FilterStep(NeighborFilter::Simple, 0)}, scope);
 }
 
 std::shared_ptr<TriangleMesh> TriangleMesh::FilterSmoothLaplacian(
         int number_of_iterations, double lambda, FilterScope scope) const {
-    bool filter_vertex =
-            scope == FilterScope::All || scope == FilterScope::Vertex;
-    bool filter_normal =
-            (scope == FilterScope::All || scope == FilterScope::Normal) &&
-            HasVertexNormals();
-    bool filter_color =
-            (scope == FilterScope::All || scope == FilterScope::Color) &&
-            HasVertexColors();
-
-    std::vector<Eigen::Vector3d> prev_vertices = vertices_;
-    std::vector<Eigen::Vector3d> prev_vertex_normals = vertex_normals_;
-    std::vector<Eigen::Vector3d> prev_vertex_colors = vertex_colors_;
-
-    std::shared_ptr<TriangleMesh> mesh = std::make_shared<TriangleMesh>();
-    mesh->vertices_.resize(vertices_.size());
-    mesh->vertex_normals_.resize(vertex_normals_.size());
-    mesh->vertex_colors_.resize(vertex_colors_.size());
-    mesh->triangles_ = triangles_;
-    mesh->adjacency_list_ = adjacency_list_;
-    if (!mesh->HasAdjacencyList()) {
-        mesh->ComputeAdjacencyList();
-    }
-
-    for (int iter = 0; iter < number_of_iterations; ++iter) {
-        FilterSmoothLaplacianHelper(mesh, prev_vertices, prev_vertex_normals,
-                                    prev_vertex_colors, mesh->adjacency_list_,
-                                    lambda, filter_vertex, filter_normal,
-                                    filter_color);
-        if (iter < number_of_iterations - 1) {
-            std::swap(mesh->vertices_, prev_vertices);
-            std::swap(mesh->vertex_normals_, prev_vertex_normals);
-            std::swap(mesh->vertex_colors_, prev_vertex_colors);
-        }
-    }
-    return mesh;
+    return FilterVertices(*this, number_of_iterations,
+                          {FilterStep(NeighborFilter::Laplacian, lambda)},
+                          scope);
 }
 
 std::shared_ptr<TriangleMesh> TriangleMesh::FilterSmoothTaubin(
@@ -382,47 +305,10 @@ std::shared_ptr<TriangleMesh> TriangleMesh::FilterSmoothTaubin(
         double lambda,
         double mu,
         FilterScope scope) const {
-    bool filter_vertex =
-            scope == FilterScope::All || scope == FilterScope::Vertex;
-    bool filter_normal =
-            (scope == FilterScope::All || scope == FilterScope::Normal) &&
-            HasVertexNormals();
-    bool filter_color =
-            (scope == FilterScope::All || scope == FilterScope::Color) &&
-            HasVertexColors();
-
-    std::vector<Eigen::Vector3d> prev_vertices = vertices_;
-    std::vector<Eigen::Vector3d> prev_vertex_normals = vertex_normals_;
-    std::vector<Eigen::Vector3d> prev_vertex_colors = vertex_colors_;
-
-    std::shared_ptr<TriangleMesh> mesh = std::make_shared<TriangleMesh>();
-    mesh->vertices_.resize(vertices_.size());
-    mesh->vertex_normals_.resize(vertex_normals_.size());
-    mesh->vertex_colors_.resize(vertex_colors_.size());
-    mesh->triangles_ = triangles_;
-    mesh->adjacency_list_ = adjacency_list_;
-    if (!mesh->HasAdjacencyList()) {
-        mesh->ComputeAdjacencyList();
-    }
-    for (int iter = 0; iter < number_of_iterations; ++iter) {
-        FilterSmoothLaplacianHelper(mesh, prev_vertices, prev_vertex_normals,
-                                    prev_vertex_colors, mesh->adjacency_list_,
-                                    lambda, filter_vertex, filter_normal,
-                                    filter_color);
-        std::swap(mesh->vertices_, prev_vertices);
-        std::swap(mesh->vertex_normals_, prev_vertex_normals);
-        std::swap(mesh->vertex_colors_, prev_vertex_colors);
-        FilterSmoothLaplacianHelper(mesh, prev_vertices, prev_vertex_normals,
-                                    prev_vertex_colors, mesh->adjacency_list_,
-                                    mu, filter_vertex, filter_normal,
-                                    filter_color);
-        if (iter < number_of_iterations - 1) {
-            std::swap(mesh->vertices_, prev_vertices);
-            std::swap(mesh->vertex_normals_, prev_vertex_normals);
-            std::swap(mesh->vertex_colors_, prev_vertex_colors);
-        }
-    }
-    return mesh;
+    return FilterVertices(*this, number_of_iterations,
+                          {FilterStep(NeighborFilter::Laplacian, lambda),
+                           FilterStep(NeighborFilter::Laplacian, mu)},
+                          scope);
 }
 
 std::shared_ptr<PointCloud> TriangleMesh::SamplePointsUniformlyImpl(
@@ -659,39 +545,95 @@ std::shared_ptr<PointCloud> TriangleMesh::SamplePointsPoissonDisk(
     return pcl;
 }
 
+namespace {
+
+/// Orders coordinates with the NaNs last, so that sorting stays well defined.
+bool CoordinateLess(double a, double b) {
+    if (std::isnan(a)) {
+        return false;
+    }
+    return std::isnan(b) || a < b;
+}
+
+bool VertexLess(const Eigen::Vector3d &a, const Eigen::Vector3d &b) {
+    for (int i = 0; i < 3; ++i) {
+        if (CoordinateLess(a(i), b(i))) {
+            return true;
+        }
+        if (CoordinateLess(b(i), a(i))) {
+            return false;
+        }
+    }
+    return false;
+}
+
+}  // unnamed namespace
+
 TriangleMesh &TriangleMesh::RemoveDuplicatedVertices() {
-    typedef std::tuple<double, double, double> Coordinate3;
-    std::unordered_map<Coordinate3, size_t, utility::hash_tuple<Coordinate3>>
-            point_to_old_index;
-    std::vector<int> index_old_to_new(vertices_.size());
+    bool has_adjacency_list = HasAdjacencyList();
     bool has_vert_normal = HasVertexNormals();
     bool has_vert_color = HasVertexColors();
     size_t old_vertex_num = vertices_.size();
-    size_t k = 0;                                  // new index
-    for (size_t i = 0; i < old_vertex_num; i++) {  // old index
-        Coordinate3 coord = std::make_tuple(vertices_[i](0), vertices_[i](1),
-                                            vertices_[i](2));
-        if (point_to_old_index.find(coord) == point_to_old_index.end()) {
-            point_to_old_index[coord] = i;
-            vertices_[k] = vertices_[i];
-            if (has_vert_normal) vertex_normals_[k] = vertex_normals_[i];
-            if (has_vert_color) vertex_colors_[k] = vertex_colors_[i];
-            index_old_to_new[i] = (int)k;
-            k++;
-        } else {
-            index_old_to_new[i] = index_old_to_new[point_to_old_index[coord]];
-        }
+    int n = static_cast<int>(old_vertex_num);
+
+    // Sorting brings the vertices with equal coordinates together, ordered by
+    // index. Vertices with NaN coordinates are never equal.
+    std::vector<int> order(n);
+    std::iota(order.begin(), order.end(), 0);
+    tbb::parallel_sort(order.begin(), order.end(), [&](int a, int b) {
+        if (VertexLess(vertices_[a], vertices_[b])) {
+            return true;
+        }
+        return !VertexLess(vertices_[b], vertices_[a]) && a < b;
+    });
+    std::vector<int> first_of(n);
+    for (int k = 0; k < n; ++k) {
+        bool is_first =
+                k == 0 || vertices_[order[k]] != vertices_[order[k - 1]];
+        first_of[order[k]] = is_first ? order[k] : first_of[order[k - 1]];
+    }
+
+    // The first vertex of each group is kept, in the original order.
+    std::vector<int> num_kept(n);
+    for (int i = 0; i < n; ++i) {
+        num_kept[i] = first_of[i] == i;
+    }
+    std::partial_sum(num_kept.begin(), num_kept.end(), num_kept.begin());
+    size_t k = n > 0 ? num_kept.back() : 0;
+    std::vector<int> index_old_to_new(n);
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int i = 0; i < n; ++i) {
+        index_old_to_new[i] = num_kept[first_of[i]] - 1;
     }
-    vertices_.resize(k);
-    if (has_vert_normal) vertex_normals_.resize(k);
-    if (has_vert_color) vertex_colors_.resize(k);
     if (k < old_vertex_num) {
-        for (auto &triangle : triangles_) {
+        std::vector<Eigen::Vector3d> new_vertices(k);
+        std::vector<Eigen::Vector3d> new_vertex_normals(has_vert_normal ? k
+                                                                        : 0);
+        std::vector<Eigen::Vector3d> new_vertex_colors(has_vert_color ? k : 0);
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+        for (int i = 0; i < n; ++i) {
+            if (first_of[i] != i) {
+                continue;
+            }
+            new_vertices[index_old_to_new[i]] = vertices_[i];
+            if (has_vert_normal) {
+                new_vertex_normals[index_old_to_new[i]] = vertex_normals_[i];
+            }
+            if (has_vert_color) {
+                new_vertex_colors[index_old_to_new[i]] = vertex_colors_[i];
+            }
+        }
+        vertices_.swap(new_vertices);
+        if (has_vert_normal) vertex_normals_.swap(new_vertex_normals);
+        if (has_vert_color) vertex_colors_.swap(new_vertex_colors);
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+        for (int tidx = 0; tidx < int(triangles_.size()); ++tidx) {
+            Eigen::Vector3i &triangle = triangles_[tidx];
             triangle(0) = index_old_to_new[triangle(0)];
             triangle(1) = index_old_to_new[triangle(1)];
             triangle(2) = index_old_to_new[triangle(2)];
         }
-        if (HasAdjacencyList()) {
+        if (has_adjacency_list) {
             ComputeAdjacencyList();
         }
     }
@@ -908,14 +850,74 @@ TriangleMesh &TriangleMesh::RemoveNonManifoldEdges() {
 }
 
 TriangleMesh &TriangleMesh::MergeCloseVertices(double eps) {
-    KDTreeFlann kdtree(*this);
-    // precompute all neighbours
+    int num_vertices = static_cast<int>(vertices_.size());
+    if (num_vertices == 0 || eps <= 0) {
+        return *this;
+    }
+
+    // The neighbours of a vertex are the vertices closer than eps, as for a
+    // KD-tree radius search. They lie in the 27 cells of size eps around its
+    // cell, which are found by binary search in the vertices sorted by cell.
+    typedef std::tuple<int64_t, int64_t, int64_t> Cell;
+    const Eigen::Vector3d min_bound = GetMinBound();
+    std::vector<Cell> cells(num_vertices);
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int idx = 0; idx < num_vertices; ++idx) {
+        Eigen::Vector3d coord = (vertices_[idx] - min_bound) / eps;
+        cells[idx] = Cell(int64_t(std::floor(coord(0))),
+                          int64_t(std::floor(coord(1))),
+                          int64_t(std::floor(coord(2))));
+    }
+    std::vector<int> order(num_vertices);
+    std::iota(order.begin(), order.end(), 0);
+    tbb::parallel_sort(order.begin(), order.end(), [&](int a, int b) {
+        return std::tie(cells[a], a) < std::tie(cells[b], b);
+    });
+    std::vector<Cell> sorted_cells(num_vertices);
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int k = 0; k < num_vertices; ++k) {
+        sorted_cells[k] = cells[order[k]];
+    }
+    const double eps2 = eps * eps;
+    auto ForEachNeighbour = [&](int idx, auto f) {
+        const Cell &cell = cells[idx];
+        for (int64_t dx = -1; dx <= 1; ++dx) {
+            for (int64_t dy = -1; dy <= 1; ++dy) {
+                int64_t x = std::get<0>(cell) + dx;
+                int64_t y = std::get<1>(cell) + dy;
+                int64_t z = std::get<2>(cell);
+                auto begin = std::lower_bound(sorted_cells.begin(),
+                                              sorted_cells.end(),
+                                              Cell(x, y, z - 1));
+                auto end = std::upper_bound(begin, sorted_cells.end(),
+                                            Cell(x, y, z + 1));
+                for (auto it = begin; it != end; ++it) {
+                    int nb = order[it - sorted_cells.begin()];
+                    if ((vertices_[nb] - vertices_[idx]).squaredNorm() < eps2) {
+                        f(nb);
+                    }
+                }
+            }
+        }
+    };
+
+    // Precompute all neighbours in increasing order, nbs[nbs_offsets[idx]]
+    // to nbs[nbs_offsets[idx + 1] - 1] for vertex idx.
     utility::LogDebug("Precompute Neighbours");
-    std::vector<std::vector<int>> nbs(vertices_.size());
-#pragma omp parallel for schedule(static)
-    for (int idx = 0; idx < int(vertices_.size()); ++idx) {
-        std::vector<double> dists2;
-        kdtree.SearchRadius(vertices_[idx], eps, nbs[idx], dists2);
+    std::vector<int> nbs_offsets(num_vertices + 1, 0);
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int idx = 0; idx < num_vertices; ++idx) {
+        ForEachNeighbour(idx, [&](int) { nbs_offsets[idx + 1]++; });
+    }
+    std::partial_sum(nbs_offsets.begin(), nbs_offsets.end(),
+                     nbs_offsets.begin());
+    std::vector<int> nbs(nbs_offsets.back());
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int idx = 0; idx < num_vertices; ++idx) {
+        int pos = nbs_offsets[idx];
+        ForEachNeighbour(idx, [&](int nb) { nbs[pos++] = nb; });
+        std::sort(nbs.begin() + nbs_offsets[idx],
+                  nbs.begin() + nbs_offsets[idx + 1]);
     }
     utility::LogDebug("Done Precompute Neighbours");
 
@@ -924,9 +926,9 @@ TriangleMesh &TriangleMesh::MergeCloseVertices(double eps) {
     std::vector<Eigen::Vector3d> new_vertices;
     std::vector<Eigen::Vector3d> new_vertex_normals;
     std::vector<Eigen::Vector3d> new_vertex_colors;
-    std::unordered_map<int, int> new_vert_mapping;
-    for (int vidx = 0; vidx < int(vertices_.size()); ++vidx) {
-        if (new_vert_mapping.count(vidx) > 0) {
+    std::vector<int> new_vert_mapping(num_vertices, -1);
+    for (int vidx = 0; vidx < num_vertices; ++vidx) {
+        if (new_vert_mapping[vidx] >= 0) {
             continue;
         }
 
@@ -943,8 +945,9 @@ TriangleMesh &TriangleMesh::MergeCloseVertices(double eps) {
             color = vertex_colors_[vidx];
         }
         int n = 1;
-        for (int nb : nbs[vidx]) {
-            if (vidx == nb || new_vert_mapping.count(nb) > 0) {
+        for (int i = nbs_offsets[vidx]; i < nbs_offsets[vidx + 1]; ++i) {
+            int nb = nbs[i];
+            if (vidx == nb || new_vert_mapping[nb] >= 0) {
                 continue;
             }
             vertex += vertices_[nb];
@@ -972,7 +975,9 @@ TriangleMesh &TriangleMesh::MergeCloseVertices(double eps) {
     std::swap(vertex_normals_, new_vertex_normals);
     std::swap(vertex_colors_, new_vertex_colors);
 
-    for (auto &triangle : triangles_) {
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int tidx = 0; tidx < int(triangles_.size()); ++tidx) {
+        Eigen::Vector3i &triangle = triangles_[tidx];
         triangle(0) = new_vert_mapping[triangle(0)];
         triangle(1) = new_vert_mapping[triangle(1)];
         triangle(2) = new_vert_mapping[triangle(2)];
@@ -1207,7 +1212,7 @@ double TriangleMesh::GetVolume() const {
 
     double volume = 0;
     int64_t num_triangles = triangles_.size();
-#pragma omp parallel for reduction(+ : volume)
+#pragma omp parallel for reduction(+ : volume) num_threads(utility::EstimateMaxThreads())
     for (int64_t tidx = 0; tidx < num_triangles; ++tidx) {
         volume += GetSignedVolumeOfTriangle(tidx);
     }
@@ -1255,13 +1260,13 @@ int TriangleMesh::EulerPoincareCharacteristic() const {
 
 std::vector<Eigen::Vector2i> TriangleMesh::GetNonManifoldEdges(
         bool allow_boundary_edges /* = true */) const {
-    auto edges = GetEdgeToTrianglesMap();
+    const HalfEdgeArrays arrays = HalfEdgeArrays::Create(triangles_);
     std::vector<Eigen::Vector2i> non_manifold_edges;
-    for (auto &kv : edges) {
-        if ((allow_boundary_edges &&
-             (kv.second.size() < 1 || kv.second.size() > 2)) ||
-            (!allow_boundary_edges && kv.second.size() != 2)) {
-            non_manifold_edges.push_back(kv.first);
+    for (int64_t edge = 0; edge < arrays.NumEdges(); ++edge) {
+        int64_t num_triangles = arrays.NumHalfEdgesOfEdge(edge);
+        if ((allow_boundary_edges && num_triangles > 2) ||
+            (!allow_boundary_edges && num_triangles != 2)) {
+            non_manifold_edges.push_back(arrays.edges_[edge]);
         }
     }
     return non_manifold_edges;
@@ -1269,11 +1274,11 @@ std::vector<Eigen::Vector2i> TriangleMesh::GetNonManifoldEdges(
 
 bool TriangleMesh::IsEdgeManifold(
         bool allow_boundary_edges /* = true */) const {
-    auto edges = GetEdgeToTrianglesMap();
-    for (auto &kv : edges) {
-        if ((allow_boundary_edges &&
-             (kv.second.size() < 1 || kv.second.size() > 2)) ||
-            (!allow_boundary_edges && kv.second.size() != 2)) {
+    const HalfEdgeArrays arrays = HalfEdgeArrays::Create(triangles_);
+    for (int64_t edge = 0; edge < arrays.NumEdges(); ++edge) {
+        int64_t num_triangles = arrays.NumHalfEdgesOfEdge(edge);
+        if ((allow_boundary_edges && num_triangles > 2) ||
+            (!allow_boundary_edges && num_triangles != 2)) {
             return false;
         }
     }
@@ -1340,40 +1345,81 @@ bool TriangleMesh::IsVertexManifold() const {
     return GetNonManifoldVertices().empty();
 }
 
-std::vector<Eigen::Vector2i> TriangleMesh::GetSelfIntersectingTriangles()
-        const {
-    std::vector<Eigen::Vector2i> self_intersecting_triangles;
-    for (size_t tidx0 = 0; tidx0 < triangles_.size() - 1; ++tidx0) {
-        const Eigen::Vector3i &tria_p = triangles_[tidx0];
-        const Eigen::Vector3d &p0 = vertices_[tria_p(0)];
-        const Eigen::Vector3d &p1 = vertices_[tria_p(1)];
-        const Eigen::Vector3d &p2 = vertices_[tria_p(2)];
-        for (size_t tidx1 = tidx0 + 1; tidx1 < triangles_.size(); ++tidx1) {
-            const Eigen::Vector3i &tria_q = triangles_[tidx1];
-            // check if neighbour triangle
-            if (tria_p(0) == tria_q(0) || tria_p(0) == tria_q(1) ||
-                tria_p(0) == tria_q(2) || tria_p(1) == tria_q(0) ||
-                tria_p(1) == tria_q(1) || tria_p(1) == tria_q(2) ||
-                tria_p(2) == tria_q(0) || tria_p(2) == tria_q(1) ||
-                tria_p(2) == tria_q(2)) {
-                continue;
-            }
+namespace {
 
-            // check for intersection
-            const Eigen::Vector3d &q0 = vertices_[tria_q(0)];
-            const Eigen::Vector3d &q1 = vertices_[tria_q(1)];
-            const Eigen::Vector3d &q2 = vertices_[tria_q(2)];
-            if (IntersectionTest::TriangleTriangle3d(p0, p1, p2, q0, q1, q2)) {
-                self_intersecting_triangles.push_back(
-                        Eigen::Vector2i(tidx0, tidx1));
-            }
+bool TrianglesShareVertex(const Eigen::Vector3i &tria_p,
+                          const Eigen::Vector3i &tria_q) {
+    return tria_p(0) == tria_q(0) || tria_p(0) == tria_q(1) ||
+           tria_p(0) == tria_q(2) || tria_p(1) == tria_q(0) ||
+           tria_p(1) == tria_q(1) || tria_p(1) == tria_q(2) ||
+           tria_p(2) == tria_q(0) || tria_p(2) == tria_q(1) ||
+           tria_p(2) == tria_q(2);
+}
+
+/// Calls f(tidx0, tidx1) in parallel for each pair of triangles of the BVH
+/// with tidx0 < tidx1 that do not share a vertex and intersect, until f
+/// returns true. Returns true if f returned true.
+template <typename F>
+bool ForEachSelfIntersection(const TriangleBVH &bvh, F f) {
+    const auto &vertices = bvh.vertices_;
+    const auto &triangles = bvh.triangles_;
+    std::atomic<bool> stop(false);
+#pragma omp parallel for schedule(dynamic, 256) num_threads(utility::EstimateMaxThreads())
+    for (int tidx0 = 0; tidx0 < int(triangles.size()); ++tidx0) {
+        if (stop) {
+            continue;
         }
+        const Eigen::Vector3i &tria_p = triangles[tidx0];
+        const Eigen::Vector3d &p0 = vertices[tria_p(0)];
+        const Eigen::Vector3d &p1 = vertices[tria_p(1)];
+        const Eigen::Vector3d &p2 = vertices[tria_p(2)];
+        bvh.QueryAABB(
+                p0.cwiseMin(p1).cwiseMin(p2), p0.cwiseMax(p1).cwiseMax(p2),
+                [&](int tidx1) {
+                    if (tidx1 <= tidx0) {
+                        return bool(stop);
+                    }
+                    const Eigen::Vector3i &tria_q = triangles[tidx1];
+                    if (TrianglesShareVertex(tria_p, tria_q)) {
+                        return bool(stop);
+                    }
+                    const Eigen::Vector3d &q0 = vertices[tria_q(0)];
+                    const Eigen::Vector3d &q1 = vertices[tria_q(1)];
+                    const Eigen::Vector3d &q2 = vertices[tria_q(2)];
+                    if (IntersectionTest::TriangleTriangle3d(p0, p1, p2, q0,
+                                                             q1, q2) &&
+                        f(tidx0, tidx1)) {
+                        stop = true;
+                    }
+                    return bool(stop);
+                });
     }
+    return stop;
+}
+
+}  // unnamed namespace
+
+std::vector<Eigen::Vector2i> TriangleMesh::GetSelfIntersectingTriangles()
+        const {
+    std::vector<Eigen::Vector2i> self_intersecting_triangles;
+    const TriangleBVH bvh(vertices_, triangles_);
+    ForEachSelfIntersection(bvh, [&](int tidx0, int tidx1) {
+#pragma omp critical
+        self_intersecting_triangles.push_back(Eigen::Vector2i(tidx0, tidx1));
+        return false;
+    });
+    std::sort(self_intersecting_triangles.begin(),
+              self_intersecting_triangles.end(),
+              [](const Eigen::Vector2i &lhs, const Eigen::Vector2i &rhs) {
+                  return std::make_pair(lhs(0), lhs(1)) <
+                         std::make_pair(rhs(0), rhs(1));
+              });
     return self_intersecting_triangles;
 }
 
 bool TriangleMesh::IsSelfIntersecting() const {
-    return !GetSelfIntersectingTriangles().empty();
+    const TriangleBVH bvh(vertices_, triangles_);
+    return ForEachSelfIntersection(bvh, [](int, int) { return true; });
 }
 
 bool TriangleMesh::IsBoundingBoxIntersecting(const TriangleMesh &other) const {
@@ -1385,88 +1431,90 @@ bool TriangleMesh::IsIntersecting(const TriangleMesh &other) const {
     if (!IsBoundingBoxIntersecting(other)) {
         return false;
     }
-    for (size_t tidx0 = 0; tidx0 < triangles_.size(); ++tidx0) {
+    const TriangleBVH bvh(other.vertices_, other.triangles_);
+    std::atomic<bool> intersecting(false);
+#pragma omp parallel for schedule(dynamic, 256) num_threads(utility::EstimateMaxThreads())
+    for (int tidx0 = 0; tidx0 < int(triangles_.size()); ++tidx0) {
+        if (intersecting) {
+            continue;
+        }
         const Eigen::Vector3i &tria_p = triangles_[tidx0];
         const Eigen::Vector3d &p0 = vertices_[tria_p(0)];
         const Eigen::Vector3d &p1 = vertices_[tria_p(1)];
         const Eigen::Vector3d &p2 = vertices_[tria_p(2)];
-        for (size_t tidx1 = 0; tidx1 < other.triangles_.size(); ++tidx1) {
-            const Eigen::Vector3i &tria_q = other.triangles_[tidx1];
-            const Eigen::Vector3d &q0 = other.vertices_[tria_q(0)];
-            const Eigen::Vector3d &q1 = other.vertices_[tria_q(1)];
-            const Eigen::Vector3d &q2 = other.vertices_[tria_q(2)];
-            if (IntersectionTest::TriangleTriangle3d(p0, p1, p2, q0, q1, q2)) {
-                return true;
-            }
-        }
+        bvh.QueryAABB(
+                p0.cwiseMin(p1).cwiseMin(p2), p0.cwiseMax(p1).cwiseMax(p2),
+                [&](int tidx1) {
+                    const Eigen::Vector3i &tria_q = other.triangles_[tidx1];
+                    const Eigen::Vector3d &q0 = other.vertices_[tria_q(0)];
+                    const Eigen::Vector3d &q1 = other.vertices_[tria_q(1)];
+                    const Eigen::Vector3d &q2 = other.vertices_[tria_q(2)];
+                    if (IntersectionTest::TriangleTriangle3d(p0, p1, p2, q0,
+                                                             q1, q2)) {
+                        intersecting = true;
+                    }
+                    return bool(intersecting);
+                });
     }
-    return false;
+    return intersecting;
 }
 
 std::tuple<std::vector<int>, std::vector<size_t>, std::vector<double>>
 TriangleMesh::ClusterConnectedTriangles() const {
-    std::vector<int> triangle_clusters(triangles_.size(), -1);
-    std::vector<size_t> num_triangles;
-    std::vector<double> areas;
+    const int num_triangles = int(triangles_.size());
+    std::vector<int> triangle_clusters(num_triangles, -1);
+    std::vector<size_t> cluster_num_triangles;
+    std::vector<double> cluster_areas;
 
+    // Sort the (edge, triangle) pairs by edge so that the triangles sharing
+    // an edge end up next to each other, then join consecutive triangles.
     utility::LogDebug("[ClusterConnectedTriangles] Compute triangle adjacency");
-    auto edges_to_triangles = GetEdgeToTrianglesMap();
-    std::vector<std::unordered_set<int>> adjacency_list(triangles_.size());
-#pragma omp parallel for schedule(static)
-    for (int tidx = 0; tidx < int(triangles_.size()); ++tidx) {
+    std::vector<std::pair<uint64_t, int>> edge_triangles(3 * num_triangles);
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int tidx = 0; tidx < num_triangles; ++tidx) {
         const auto &triangle = triangles_[tidx];
-        for (auto tnb :
-             edges_to_triangles[GetOrderedEdge(triangle(0), triangle(1))]) {
-            adjacency_list[tidx].insert(tnb);
-        }
-        for (auto tnb :
-             edges_to_triangles[GetOrderedEdge(triangle(0), triangle(2))]) {
-            adjacency_list[tidx].insert(tnb);
-        }
-        for (auto tnb :
-             edges_to_triangles[GetOrderedEdge(triangle(1), triangle(2))]) {
-            adjacency_list[tidx].insert(tnb);
+        for (int i = 0; i < 3; ++i) {
+            uint64_t v0 = uint32_t(triangle(i));
+            uint64_t v1 = uint32_t(triangle((i + 1) % 3));
+            if (v0 > v1) {
+                std::swap(v0, v1);
+            }
+            edge_triangles[3 * tidx + i] = {(v0 << 32) | v1, tidx};
         }
     }
+    tbb::parallel_sort(edge_triangles.begin(), edge_triangles.end());
     utility::LogDebug(
             "[ClusterConnectedTriangles] Done computing triangle adjacency");
 
-    int cluster_idx = 0;
-    for (int tidx = 0; tidx < int(triangles_.size()); ++tidx) {
-        if (triangle_clusters[tidx] != -1) {
-            continue;
+    ConcurrentUnionFind union_find(num_triangles);
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int i = 1; i < int(edge_triangles.size()); ++i) {
+        if (edge_triangles[i].first == edge_triangles[i - 1].first) {
+            union_find.Union(edge_triangles[i].second,
+                             edge_triangles[i - 1].second);
         }
+    }
 
-        std::queue<int> triangle_queue;
-        int cluster_n_triangles = 0;
-        double cluster_area = 0;
-
-        triangle_queue.push(tidx);
-        triangle_clusters[tidx] = cluster_idx;
-        while (!triangle_queue.empty()) {
-            int cluster_tidx = triangle_queue.front();
-            triangle_queue.pop();
-
-            cluster_n_triangles++;
-            cluster_area += GetTriangleArea(cluster_tidx);
-
-            for (auto tnb : adjacency_list[cluster_tidx]) {
-                if (triangle_clusters[tnb] == -1) {
-                    triangle_queue.push(tnb);
-                    triangle_clusters[tnb] = cluster_idx;
-                }
-            }
+    // The root of each set is its smallest triangle, so numbering the roots
+    // in order gives the clusters in order of their first triangle.
+    for (int tidx = 0; tidx < num_triangles; ++tidx) {
+        const int root = union_find.Find(tidx);
+        if (root == tidx) {
+            triangle_clusters[tidx] = int(cluster_num_triangles.size());
+            cluster_num_triangles.push_back(0);
+            cluster_areas.push_back(0);
+        } else {
+            triangle_clusters[tidx] = triangle_clusters[root];
         }
-
-        num_triangles.push_back(cluster_n_triangles);
-        areas.push_back(cluster_area);
-        cluster_idx++;
+        cluster_num_triangles[triangle_clusters[tidx]]++;
+        cluster_areas[triangle_clusters[tidx]] += GetTriangleArea(tidx);
     }
 
     utility::LogDebug(
             "[ClusterConnectedTriangles] Done clustering, #clusters={}",
-            cluster_idx);
-    return std::make_tuple(triangle_clusters, num_triangles, areas);
+            cluster_num_triangles.size());
+    return std::make_tuple(triangle_clusters, cluster_num_triangles,
+                           cluster_areas);
 }
 
 void TriangleMesh::RemoveTrianglesByIndex(
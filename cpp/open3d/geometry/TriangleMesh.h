@@ -27,6 +27,7 @@
 #pragma once
 
 #include <Eigen/Core>
+#include <limits>
 #include <memory>
 #include <numeric>
 #include <tuple>
@@ -233,7 +234,7 @@ public:
 
     /// Function that returns the non-manifold edges of the triangle mesh.
     /// If \param allow_boundary_edges is set to false, then also boundary
-    /// edges are returned.
+    /// edges are returned. The edges are sorted, as in HalfEdgeArrays.
     std::vector<Eigen::Vector2i> GetNonManifoldEdges(
             bool allow_boundary_edges = true) const;
 
@@ -254,11 +255,13 @@ public:
     bool IsVertexManifold() const;
 
     /// Function that returns a list of triangles that are intersecting the
-    /// mesh.
+    /// mesh, as pairs of triangle indices sorted in increasing order.
+    /// The candidate pairs are found with a TriangleBVH.
     std::vector<Eigen::Vector2i> GetSelfIntersectingTriangles() const;
 
     /// Function that tests if the triangle mesh is self-intersecting.
-    /// Tests each triangle pair for intersection.
+    /// Tests the triangle pairs with overlapping bounding boxes for
+    /// intersection, and stops at the first intersecting pair.
     bool IsSelfIntersecting() const;
 
     /// Function that tests if the bounding boxes of the triangle meshes are
@@ -266,7 +269,8 @@ public:
     bool IsBoundingBoxIntersecting(const TriangleMesh &other) const;
 
     /// Function that tests if the triangle mesh intersects another triangle
-    /// mesh. Tests each triangle against each other triangle.
+    /// mesh. Tests each triangle against the triangles of the other mesh with
+    /// overlapping bounding boxes, and stops at the first intersecting pair.
     bool IsIntersecting(const TriangleMesh &other) const;
 
     /// Function that tests if the given triangle mesh is orientable, i.e.
@@ -430,6 +434,24 @@ public:
             double maximum_error,
             double boundary_weight) const;
 
+    /// Parallel variant of SimplifyQuadricDecimation for large meshes.
+    /// Each round, every vertex proposes its cheapest non-flipping edge
+    /// collapse, and the cheapest proposals that do not move the vertices
+    /// around each other are collapsed concurrently. The adjacency is kept in
+    /// flat arrays, so the memory is linear in the mesh size.
+    /// \param target_number_of_triangles defines the number of triangles that
+    /// the simplified mesh should have. It is not guaranteed that this number
+    /// will be reached.
+    /// \param maximum_error defines the maximum error where a vertex is allowed
+    /// to be merged. With a target of 0 triangles, the mesh is simplified
+    /// until no edge can be collapsed within this error.
+    /// \param boundary_weight a weight applied to edge vertices used to
+    /// preserve boundaries
+    std::shared_ptr<TriangleMesh> SimplifyQuadricDecimationParallel(
+            int target_number_of_triangles,
+            double maximum_error = std::numeric_limits<double>::infinity(),
+            double boundary_weight = 1.0) const;
+
     /// Function to select points from \p input TriangleMesh into
     /// output TriangleMesh
     /// Vertices with indices in \p indices are selected.
@@ -509,6 +531,8 @@ public:
     /// \param energy energy model that should be optimized
     /// \param smoothed_alpha alpha parameter of the smoothed ARAP model
     /// \return The deformed TriangleMesh
+    ///
+    /// Use an ARAPDeformer to deform the same mesh repeatedly.
     std::shared_ptr<TriangleMesh> DeformAsRigidAsPossible(
             const std::vector<int> &constraint_vertex_indices,
             const std::vector<Eigen::Vector3d> &constraint_vertex_positions,
@@ -534,6 +558,27 @@ public:
             std::shared_ptr<TetraMesh> tetra_mesh = nullptr,
             std::vector<size_t> *pt_map = nullptr);
 
+    /// \brief Computes the alpha shapes of \p pcd for several alpha values.
+    ///
+    /// The tetrahedralization, the circumradii and the face adjacency are
+    /// computed once and shared by all alpha values, so a sweep costs about
+    /// as much as a single CreateFromPointCloudAlphaShape call plus the
+    /// output meshes.
+    /// \param pcd PointCloud for what the alpha shapes should be computed.
+    /// \param alphas Parameters to control the shapes, in any order.
+    /// \param tetra_mesh If not a nullptr, then uses this to construct the
+    /// alpha shapes. Otherwise, ComputeDelaunayTetrahedralization is called.
+    /// \param pt_map Optional map from tetra_mesh vertex indices to pcd
+    /// points.
+    /// \return One TriangleMesh per entry of \p alphas, each equal to the
+    /// result of CreateFromPointCloudAlphaShape for that alpha.
+    static std::vector<std::shared_ptr<TriangleMesh>>
+    CreateFromPointCloudAlphaShapes(
+            const PointCloud &pcd,
+            const std::vector<double> &alphas,
+            std::shared_ptr<TetraMesh> tetra_mesh = nullptr,
+            std::vector<size_t> *pt_map = nullptr);
+
     /// Function that computes a triangle mesh from an oriented PointCloud \p
     /// pcd. This implements the Ball Pivoting algorithm proposed in F.
     /// Bernardini et al., "The ball-pivoting algorithm for surface
@@ -571,6 +616,9 @@ public:
     /// linear interpolation to estimate the positions of iso-vertices.
     /// \param n_threads Number of threads used for reconstruction. Set to -1
     /// to automatically determine it.
+    /// \param density_quantile The vertices whose density is below this
+    /// quantile of the densities are removed with their triangles. 0 keeps all
+    /// the vertices.
     /// \return The estimated TriangleMesh, and per vertex densitie values that
     /// can be used to to trim the mesh.
     static std::tuple<std::shared_ptr<TriangleMesh>, std::vector<double>>
@@ -579,7 +627,42 @@ public:
                                 size_t width = 0,
                                 float scale = 1.1f,
                                 bool linear_fit = false,
-                                int n_threads = -1);
+                                int n_threads = -1,
+                                double density_quantile = 0.0);
+
+    /// \brief Function that computes a triangle mesh from an oriented
+    /// PointCloud pcd with the Screened Poisson Reconstruction, tile by tile.
+    ///
+    /// Space is partitioned into cubic tiles of edge length tile_size. Each
+    /// tile is reconstructed from the points within overlap of it, and keeps
+    /// the triangles whose centroid lies in the tile. The tiles are
+    /// reconstructed one after the other with all the threads, so the memory
+    /// is bounded by the largest tile rather than by the whole cloud. The
+    /// grids of the tiles are aligned, but the seams between the tiles are
+    /// not welded.
+    ///
+    /// \param pcd PointCloud with normals and optionally colors.
+    /// \param tile_size Edge length of the tiles.
+    /// \param overlap Minimum distance by which the reconstruction of a tile
+    /// extends beyond the tile, to avoid artifacts at the seams.
+    /// \param depth Maximum depth of the octree of each tile, whose cube is
+    /// about tile_size + 2 * overlap wide.
+    /// \param linear_fit If true, the reconstructor use linear interpolation
+    /// to estimate the positions of iso-vertices.
+    /// \param n_threads Number of threads used for reconstruction. Set to -1
+    /// to automatically determine it.
+    /// \param density_quantile The vertices whose density is below this
+    /// quantile of the densities are removed with their triangles. 0 keeps all
+    /// the vertices.
+    /// \return The estimated TriangleMesh, and per vertex density values.
+    static std::tuple<std::shared_ptr<TriangleMesh>, std::vector<double>>
+    CreateFromPointCloudPoissonTiled(const PointCloud &pcd,
+                                     double tile_size,
+                                     double overlap,
+                                     size_t depth = 8,
+                                     bool linear_fit = false,
+                                     int n_threads = -1,
+                                     double density_quantile = 0.0);
 
     /// Factory function to create a tetrahedron mesh (trianglemeshfactory.cpp).
     /// the mesh centroid will be at (0,0,0) and \param radius defines the
@@ -723,16 +806,7 @@ protected:
     // Forward child class type to avoid indirect nonvirtual base
     TriangleMesh(Geometry::GeometryType type) : MeshBase(type) {}
 
-    void FilterSmoothLaplacianHelper(
-            std::shared_ptr<TriangleMesh> &mesh,
-            const std::vector<Eigen::Vector3d> &prev_vertices,
-            const std::vector<Eigen::Vector3d> &prev_vertex_normals,
-            const std::vector<Eigen::Vector3d> &prev_vertex_colors,
-            const std::vector<std::unordered_set<int>> &adjacency_list,
-            double lambda,
-            bool filter_vertex,
-            bool filter_normal,
-            bool filter_color) const;
+    friend class ARAPDeformer;
 
     /// \brief Function that computes for each edge in the triangle mesh and
     /// passed as parameter edges_to_vertices the cot weight.
@@ -27,111 +27,166 @@
 #include <Eigen/Dense>
 #include <Eigen/Sparse>
 #include <algorithm>
+#include <map>
 
+#include "open3d/geometry/ARAPDeformer.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
 
-std::shared_ptr<TriangleMesh> TriangleMesh::DeformAsRigidAsPossible(
-        const std::vector<int> &constraint_vertex_indices,
-        const std::vector<Eigen::Vector3d> &constraint_vertex_positions,
-        size_t max_iter,
-        DeformAsRigidAsPossibleEnergy energy_model,
-        double smoothed_alpha) const {
-    auto prime = std::make_shared<TriangleMesh>();
-    prime->vertices_ = this->vertices_;
-    prime->triangles_ = this->triangles_;
+ARAPDeformer::ARAPDeformer(const TriangleMesh &mesh,
+                           MeshBase::DeformAsRigidAsPossibleEnergy energy,
+                           double smoothed_alpha)
+    : mesh_(std::make_shared<TriangleMesh>()),
+      energy_(energy),
+      smoothed_alpha_(smoothed_alpha) {
+    mesh_->vertices_ = mesh.vertices_;
+    mesh_->triangles_ = mesh.triangles_;
 
-    utility::LogDebug("[DeformAsRigidAsPossible] setting up S'");
-    prime->ComputeAdjacencyList();
-    auto edges_to_vertices = prime->GetEdgeToVerticesMap();
+    utility::LogDebug("[ARAPDeformer] setting up S'");
+    mesh_->ComputeAdjacencyList();
+    auto edges_to_vertices = mesh_->GetEdgeToVerticesMap();
     auto edge_weights =
-            prime->ComputeEdgeWeightsCot(edges_to_vertices, /*min_weight=*/0);
-    utility::LogDebug("[DeformAsRigidAsPossible] done setting up S'");
-
-    std::unordered_map<int, Eigen::Vector3d> constraints;
-    for (size_t idx = 0; idx < constraint_vertex_indices.size() &&
-                         idx < constraint_vertex_positions.size();
-         ++idx) {
-        constraints[constraint_vertex_indices[idx]] =
-                constraint_vertex_positions[idx];
+            mesh_->ComputeEdgeWeightsCot(edges_to_vertices, /*min_weight=*/0);
+    const int n = int(mesh_->vertices_.size());
+    neighbor_offsets_.resize(n + 1, 0);
+    for (int i = 0; i < n; ++i) {
+        neighbor_offsets_[i + 1] =
+                neighbor_offsets_[i] + int(mesh_->adjacency_list_[i].size());
     }
+    neighbors_.resize(neighbor_offsets_[n]);
+    weights_.resize(neighbor_offsets_[n]);
+    for (int i = 0; i < n; ++i) {
+        int k = neighbor_offsets_[i];
+        for (int j : mesh_->adjacency_list_[i]) {
+            neighbors_[k] = j;
+            weights_[k] = edge_weights[TriangleMesh::GetOrderedEdge(i, j)];
+            ++k;
+        }
+    }
+    if (energy_ == MeshBase::DeformAsRigidAsPossibleEnergy::Smoothed) {
+        surface_area_ = mesh_->GetSurfaceArea();
+    }
+    utility::LogDebug("[ARAPDeformer] done setting up S'");
+    Reset();
+}
 
-    double surface_area = -1;
-    // std::vector<Eigen::Matrix3d> Rs(vertices_.size(),
-    // Eigen::Matrix3d::Identity());
-    std::vector<Eigen::Matrix3d> Rs(vertices_.size());
-    std::vector<Eigen::Matrix3d> Rs_old;
-    if (energy_model == DeformAsRigidAsPossibleEnergy::Smoothed) {
-        surface_area = prime->GetSurfaceArea();
-        Rs_old.resize(vertices_.size());
+void ARAPDeformer::Reset() {
+    positions_ = mesh_->vertices_;
+    rotations_.assign(positions_.size(), Eigen::Matrix3d::Identity());
+    has_rotations_ = false;
+}
+
+void ARAPDeformer::Factorize(const std::vector<int> &constrained_vertices) {
+    const int n = int(mesh_->vertices_.size());
+    constrained_vertices_ = constrained_vertices;
+    free_index_.assign(n, 0);
+    for (int i : constrained_vertices_) {
+        free_index_[i] = -1;
+    }
+    free_vertices_.clear();
+    for (int i = 0; i < n; ++i) {
+        if (free_index_[i] >= 0) {
+            free_index_[i] = int(free_vertices_.size());
+            free_vertices_.push_back(i);
+        }
     }
 
-    // Build system matrix L and its solver
-    utility::LogDebug("[DeformAsRigidAsPossible] setting up system matrix L");
+    // The rows of the free vertices of the Laplacian, without the columns of
+    // the constrained vertices, which move to the right hand side.
+    utility::LogDebug("[ARAPDeformer] setting up system matrix L");
     std::vector<Eigen::Triplet<double>> triplets;
-    for (int i = 0; i < int(vertices_.size()); ++i) {
-        if (constraints.count(i) > 0) {
-            triplets.push_back(Eigen::Triplet<double>(i, i, 1));
-        } else {
-            double W = 0;
-            for (int j : prime->adjacency_list_[i]) {
-                double w = edge_weights[GetOrderedEdge(i, j)];
-                triplets.push_back(Eigen::Triplet<double>(i, j, -w));
-                W += w;
-            }
-            if (W > 0) {
-                triplets.push_back(Eigen::Triplet<double>(i, i, W));
+    for (int r = 0; r < int(free_vertices_.size()); ++r) {
+        const int i = free_vertices_[r];
+        double W = 0;
+        for (int k = neighbor_offsets_[i]; k < neighbor_offsets_[i + 1]; ++k) {
+            const int c = free_index_[neighbors_[k]];
+            if (c >= 0) {
+                triplets.push_back(Eigen::Triplet<double>(r, c, -weights_[k]));
             }
+            W += weights_[k];
+        }
+        if (W > 0) {
+            triplets.push_back(Eigen::Triplet<double>(r, r, W));
         }
     }
-    Eigen::SparseMatrix<double> L(vertices_.size(), vertices_.size());
+    Eigen::SparseMatrix<double> L(free_vertices_.size(),
+                                  free_vertices_.size());
     L.setFromTriplets(triplets.begin(), triplets.end());
-    utility::LogDebug(
-            "[DeformAsRigidAsPossible] done setting up system matrix L");
-
-    utility::LogDebug("[DeformAsRigidAsPossible] setting up sparse solver");
-    Eigen::SparseLU<Eigen::SparseMatrix<double>> solver;
-    solver.analyzePattern(L);
-    solver.factorize(L);
-    if (solver.info() != Eigen::Success) {
-        utility::LogError(
-                "[DeformAsRigidAsPossible] Failed to build solver (factorize)");
-    } else {
-        utility::LogDebug(
-                "[DeformAsRigidAsPossible] done setting up sparse solver");
+
+    utility::LogDebug("[ARAPDeformer] setting up sparse solver");
+    factorized_ = false;
+    solver_.compute(L);
+    if (solver_.info() != Eigen::Success) {
+        utility::LogError("[ARAPDeformer] Failed to build solver (factorize)");
     }
+    factorized_ = true;
+    utility::LogDebug("[ARAPDeformer] done setting up sparse solver");
+}
 
-    std::vector<Eigen::VectorXd> b = {Eigen::VectorXd(vertices_.size()),
-                                      Eigen::VectorXd(vertices_.size()),
-                                      Eigen::VectorXd(vertices_.size())};
+std::shared_ptr<TriangleMesh> ARAPDeformer::Deform(
+        const std::vector<int> &constraint_vertex_indices,
+        const std::vector<Eigen::Vector3d> &constraint_vertex_positions,
+        size_t max_iter) {
+    const int n = int(mesh_->vertices_.size());
+    const std::vector<Eigen::Vector3d> &vertices = mesh_->vertices_;
+
+    std::map<int, Eigen::Vector3d> constraints;
+    for (size_t idx = 0; idx < constraint_vertex_indices.size() &&
+                         idx < constraint_vertex_positions.size();
+         ++idx) {
+        const int vidx = constraint_vertex_indices[idx];
+        if (vidx < 0 || vidx >= n) {
+            utility::LogError(
+                    "[ARAPDeformer] constraint vertex index {} out of range.",
+                    vidx);
+        }
+        constraints[vidx] = constraint_vertex_positions[idx];
+    }
+    std::vector<int> constrained_vertices;
+    for (const auto &constraint : constraints) {
+        constrained_vertices.push_back(constraint.first);
+        positions_[constraint.first] = constraint.second;
+    }
+    if (!factorized_ || constrained_vertices != constrained_vertices_) {
+        Factorize(constrained_vertices);
+    }
+
+    std::vector<Eigen::Matrix3d> rotations_old;
+    const bool smoothed =
+            energy_ == MeshBase::DeformAsRigidAsPossibleEnergy::Smoothed;
+    const int num_free = int(free_vertices_.size());
+    std::vector<Eigen::VectorXd> b = {Eigen::VectorXd(num_free),
+                                      Eigen::VectorXd(num_free),
+                                      Eigen::VectorXd(num_free)};
     for (size_t iter = 0; iter < max_iter; ++iter) {
-        if (energy_model == DeformAsRigidAsPossibleEnergy::Smoothed) {
-            std::swap(Rs, Rs_old);
+        if (smoothed) {
+            rotations_old = rotations_;
         }
 
-#pragma omp parallel for schedule(static)
-        for (int i = 0; i < int(vertices_.size()); ++i) {
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+        for (int i = 0; i < n; ++i) {
             // Update rotations
             Eigen::Matrix3d S = Eigen::Matrix3d::Zero();
             Eigen::Matrix3d R = Eigen::Matrix3d::Zero();
             int n_nbs = 0;
-            for (int j : prime->adjacency_list_[i]) {
-                Eigen::Vector3d e0 = vertices_[i] - vertices_[j];
-                Eigen::Vector3d e1 = prime->vertices_[i] - prime->vertices_[j];
-                double w = edge_weights[GetOrderedEdge(i, j)];
-                S += w * (e0 * e1.transpose());
-                if (energy_model == DeformAsRigidAsPossibleEnergy::Smoothed) {
-                    R += Rs_old[j];
+            for (int k = neighbor_offsets_[i]; k < neighbor_offsets_[i + 1];
+                 ++k) {
+                const int j = neighbors_[k];
+                Eigen::Vector3d e0 = vertices[i] - vertices[j];
+                Eigen::Vector3d e1 = positions_[i] - positions_[j];
+                S += weights_[k] * (e0 * e1.transpose());
+                if (smoothed) {
+                    R += rotations_old[j];
                 }
                 n_nbs++;
             }
-            if (energy_model == DeformAsRigidAsPossibleEnergy::Smoothed &&
-                iter > 0 && n_nbs > 0) {
-                S = 2 * S +
-                    (4 * smoothed_alpha * surface_area / n_nbs) * R.transpose();
+            if (smoothed && has_rotations_ && n_nbs > 0) {
+                S = 2 * S + (4 * smoothed_alpha_ * surface_area_ / n_nbs) *
+                                    R.transpose();
             }
             Eigen::JacobiSVD<Eigen::Matrix3d> svd(
                     S, Eigen::ComputeFullU | Eigen::ComputeFullV);
@@ -140,67 +195,88 @@ std::shared_ptr<TriangleMesh> TriangleMesh::DeformAsRigidAsPossible(
             Eigen::Vector3d D(1, 1, (V * U.transpose()).determinant());
             // ensure rotation:
             // http://graphics.stanford.edu/~smr/ICP/comparison/eggert_comparison_mva97.pdf
-            Rs[i] = V * D.asDiagonal() * U.transpose();
-            if (Rs[i].determinant() <= 0) {
+            rotations_[i] = V * D.asDiagonal() * U.transpose();
+            if (rotations_[i].determinant() <= 0) {
                 utility::LogError(
-                        "[DeformAsRigidAsPossible] something went wrong with "
-                        "updating R");
+                        "[ARAPDeformer] something went wrong with updating R");
             }
         }
+        has_rotations_ = true;
 
-#pragma omp parallel for schedule(static)
-        for (int i = 0; i < int(vertices_.size()); ++i) {
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+        for (int r = 0; r < num_free; ++r) {
             // Update Positions
+            const int i = free_vertices_[r];
             Eigen::Vector3d bi(0, 0, 0);
-            if (constraints.count(i) > 0) {
-                bi = constraints[i];
-            } else {
-                for (int j : prime->adjacency_list_[i]) {
-                    double w = edge_weights[GetOrderedEdge(i, j)];
-                    bi += w / 2 *
-                          ((Rs[i] + Rs[j]) * (vertices_[i] - vertices_[j]));
+            for (int k = neighbor_offsets_[i]; k < neighbor_offsets_[i + 1];
+                 ++k) {
+                const int j = neighbors_[k];
+                const double w = weights_[k];
+                bi += w / 2 *
+                      ((rotations_[i] + rotations_[j]) *
+                       (vertices[i] - vertices[j]));
+                if (free_index_[j] < 0) {
+                    bi += w * positions_[j];
                 }
             }
-            b[0](i) = bi(0);
-            b[1](i) = bi(1);
-            b[2](i) = bi(2);
+            b[0](r) = bi(0);
+            b[1](r) = bi(1);
+            b[2](r) = bi(2);
         }
-#pragma omp parallel for schedule(static)
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
         for (int comp = 0; comp < 3; ++comp) {
-            Eigen::VectorXd p_prime = solver.solve(b[comp]);
-            if (solver.info() != Eigen::Success) {
-                utility::LogError(
-                        "[DeformAsRigidAsPossible] Cholesky solve failed");
+            if (num_free == 0) {
+                continue;
+            }
+            Eigen::VectorXd p_prime = solver_.solve(b[comp]);
+            if (solver_.info() != Eigen::Success) {
+                utility::LogError("[ARAPDeformer] Cholesky solve failed");
             }
-            for (int i = 0; i < int(vertices_.size()); ++i) {
-                prime->vertices_[i](comp) = p_prime(i);
+            for (int r = 0; r < num_free; ++r) {
+                positions_[free_vertices_[r]](comp) = p_prime(r);
             }
         }
 
         // Compute energy and log
         double energy = 0;
         double reg = 0;
-        for (int i = 0; i < int(vertices_.size()); ++i) {
-            for (int j : prime->adjacency_list_[i]) {
-                double w = edge_weights[GetOrderedEdge(i, j)];
-                Eigen::Vector3d e0 = vertices_[i] - vertices_[j];
-                Eigen::Vector3d e1 = prime->vertices_[i] - prime->vertices_[j];
-                Eigen::Vector3d diff = e1 - Rs[i] * e0;
-                energy += w * diff.squaredNorm();
-                if (energy_model == DeformAsRigidAsPossibleEnergy::Smoothed) {
-                    reg += (Rs[i] - Rs[j]).squaredNorm();
+        for (int i = 0; i < n; ++i) {
+            for (int k = neighbor_offsets_[i]; k < neighbor_offsets_[i + 1];
+                 ++k) {
+                const int j = neighbors_[k];
+                Eigen::Vector3d e0 = vertices[i] - vertices[j];
+                Eigen::Vector3d e1 = positions_[i] - positions_[j];
+                Eigen::Vector3d diff = e1 - rotations_[i] * e0;
+                energy += weights_[k] * diff.squaredNorm();
+                if (smoothed) {
+                    reg += (rotations_[i] - rotations_[j]).squaredNorm();
                 }
             }
         }
-        if (energy_model == DeformAsRigidAsPossibleEnergy::Smoothed) {
-            energy = energy + smoothed_alpha * surface_area * reg;
+        if (smoothed) {
+            energy = energy + smoothed_alpha_ * surface_area_ * reg;
         }
-        utility::LogDebug("[DeformAsRigidAsPossible] iter={}, energy={:e}",
-                          iter, energy);
+        utility::LogDebug("[ARAPDeformer] iter={}, energy={:e}", iter,
+                          energy);
     }
 
+    auto prime = std::make_shared<TriangleMesh>();
+    prime->vertices_ = positions_;
+    prime->triangles_ = mesh_->triangles_;
+    prime->adjacency_list_ = mesh_->adjacency_list_;
     return prime;
 }
 
+std::shared_ptr<TriangleMesh> TriangleMesh::DeformAsRigidAsPossible(
+        const std::vector<int> &constraint_vertex_indices,
+        const std::vector<Eigen::Vector3d> &constraint_vertex_positions,
+        size_t max_iter,
+        DeformAsRigidAsPossibleEnergy energy_model,
+        double smoothed_alpha) const {
+    ARAPDeformer deformer(*this, energy_model, smoothed_alpha);
+    return deformer.Deform(constraint_vertex_indices,
+                           constraint_vertex_positions, max_iter);
+}
+
 }  // namespace geometry
 }  // namespace open3d
@@ -24,12 +24,21 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <tbb/parallel_sort.h>
+
 #include <Eigen/Dense>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <numeric>
 #include <queue>
 #include <tuple>
 
+#include "open3d/geometry/HalfEdgeTriangleMesh.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
@@ -88,6 +97,55 @@ public:
     double c_;
 };
 
+namespace {
+
+/// Computes the vertex to triangle adjacency of the triangles that are not
+/// deleted. The triangles of vertex vidx are adj_triangles[adj_offsets[vidx]]
+/// up to adj_triangles[adj_offsets[vidx + 1] - 1], in increasing order.
+void ComputeVertexTriangleAdjacency(
+        const std::vector<Eigen::Vector3i>& triangles,
+        const std::vector<char>& triangles_deleted,
+        int n_vertices,
+        std::vector<int>& adj_offsets,
+        std::vector<int>& adj_triangles) {
+    const int n_triangles = static_cast<int>(triangles.size());
+    adj_offsets.assign(n_vertices + 1, 0);
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int tidx = 0; tidx < n_triangles; ++tidx) {
+        if (triangles_deleted[tidx]) {
+            continue;
+        }
+        for (int k = 0; k < 3; ++k) {
+#pragma omp atomic
+            adj_offsets[triangles[tidx](k) + 1]++;
+        }
+    }
+    std::partial_sum(adj_offsets.begin(), adj_offsets.end(),
+                     adj_offsets.begin());
+    adj_triangles.resize(adj_offsets.back());
+    std::vector<int> cursors(adj_offsets.begin(), adj_offsets.end() - 1);
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int tidx = 0; tidx < n_triangles; ++tidx) {
+        if (triangles_deleted[tidx]) {
+            continue;
+        }
+        for (int k = 0; k < 3; ++k) {
+            int pos;
+#pragma omp atomic capture
+            pos = cursors[triangles[tidx](k)]++;
+            adj_triangles[pos] = tidx;
+        }
+    }
+    // Sorting makes the result independent of the thread scheduling.
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int vidx = 0; vidx < n_vertices; ++vidx) {
+        std::sort(adj_triangles.begin() + adj_offsets[vidx],
+                  adj_triangles.begin() + adj_offsets[vidx + 1]);
+    }
+}
+
+}  // unnamed namespace
+
 std::shared_ptr<TriangleMesh> TriangleMesh::SimplifyVertexClustering(
         double voxel_size,
         SimplificationContraction
@@ -118,116 +176,123 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SimplifyVertexClustering(
         return idx;
     };
 
-    std::unordered_map<Eigen::Vector3i, std::unordered_set<int>,
-                       utility::hash_eigen<Eigen::Vector3i>>
-            voxel_vertices;
-    std::unordered_map<Eigen::Vector3i, int,
-                       utility::hash_eigen<Eigen::Vector3i>>
-            voxel_vert_ind;
-    int new_vidx = 0;
-    for (size_t vidx = 0; vidx < vertices_.size(); ++vidx) {
-        const Eigen::Vector3i vox_idx = GetVoxelIdx(vertices_[vidx]);
-        voxel_vertices[vox_idx].insert(int(vidx));
-
-        if (voxel_vert_ind.count(vox_idx) == 0) {
-            voxel_vert_ind[vox_idx] = new_vidx;
-            new_vidx++;
+    // Sorting the vertices by voxel, and then by index, makes the vertices of
+    // a voxel contiguous in voxel_order. The voxels are numbered in the order
+    // of their first vertex.
+    const int n_vertices = static_cast<int>(vertices_.size());
+    std::vector<Eigen::Vector3i> voxel_idxs(n_vertices);
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int vidx = 0; vidx < n_vertices; ++vidx) {
+        voxel_idxs[vidx] = GetVoxelIdx(vertices_[vidx]);
+    }
+    auto VoxelKey = [&](int vidx) {
+        const Eigen::Vector3i& voxel_idx = voxel_idxs[vidx];
+        return std::make_tuple(voxel_idx(0), voxel_idx(1), voxel_idx(2), vidx);
+    };
+    std::vector<int> voxel_order(n_vertices);
+    std::iota(voxel_order.begin(), voxel_order.end(), 0);
+    tbb::parallel_sort(
+            voxel_order.begin(), voxel_order.end(),
+            [&](int a, int b) { return VoxelKey(a) < VoxelKey(b); });
+    std::vector<int> first_of(n_vertices);
+    std::vector<int> voxel_begins;
+    for (int k = 0; k < n_vertices; ++k) {
+        const int vidx = voxel_order[k];
+        if (k == 0 || voxel_idxs[vidx] != voxel_idxs[voxel_order[k - 1]]) {
+            first_of[vidx] = vidx;
+            voxel_begins.push_back(k);
+        } else {
+            first_of[vidx] = first_of[voxel_order[k - 1]];
         }
     }
+    const int n_voxels = static_cast<int>(voxel_begins.size());
+    voxel_begins.push_back(n_vertices);
+    std::vector<int> voxel_vert_ind(n_vertices);
+    for (int vidx = 0; vidx < n_vertices; ++vidx) {
+        voxel_vert_ind[vidx] = first_of[vidx] == vidx;
+    }
+    std::partial_sum(voxel_vert_ind.begin(), voxel_vert_ind.end(),
+                     voxel_vert_ind.begin());
+    std::vector<int> new_vidxs(n_vertices);
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int vidx = 0; vidx < n_vertices; ++vidx) {
+        new_vidxs[vidx] = voxel_vert_ind[first_of[vidx]] - 1;
+    }
 
     // aggregate vertex info
     bool has_vert_normal = HasVertexNormals();
     bool has_vert_color = HasVertexColors();
-    mesh->vertices_.resize(voxel_vertices.size());
+    mesh->vertices_.resize(n_voxels);
     if (has_vert_normal) {
-        mesh->vertex_normals_.resize(voxel_vertices.size());
+        mesh->vertex_normals_.resize(n_voxels);
     }
     if (has_vert_color) {
-        mesh->vertex_colors_.resize(voxel_vertices.size());
+        mesh->vertex_colors_.resize(n_voxels);
     }
 
-    auto AvgVertex = [&](const std::unordered_set<int> ind) {
+    auto Avg = [&](const std::vector<Eigen::Vector3d>& values, int voxel) {
         Eigen::Vector3d aggr(0, 0, 0);
-        for (int vidx : ind) {
-            aggr += vertices_[vidx];
+        for (int k = voxel_begins[voxel]; k < voxel_begins[voxel + 1]; ++k) {
+            aggr += values[voxel_order[k]];
         }
-        aggr /= double(ind.size());
+        aggr /= double(voxel_begins[voxel + 1] - voxel_begins[voxel]);
         return aggr;
     };
-    auto AvgNormal = [&](const std::unordered_set<int> ind) {
-        Eigen::Vector3d aggr(0, 0, 0);
-        for (int vidx : ind) {
-            aggr += vertex_normals_[vidx];
-        }
-        aggr /= double(ind.size());
-        return aggr;
-    };
-    auto AvgColor = [&](const std::unordered_set<int> ind) {
-        Eigen::Vector3d aggr(0, 0, 0);
-        for (int vidx : ind) {
-            aggr += vertex_colors_[vidx];
-        }
-        aggr /= double(ind.size());
-        return aggr;
-    };
-
-    if (contraction == SimplificationContraction::Average) {
-        for (const auto& voxel : voxel_vertices) {
-            int vox_vidx = voxel_vert_ind[voxel.first];
-            mesh->vertices_[vox_vidx] = AvgVertex(voxel.second);
-            if (has_vert_normal) {
-                mesh->vertex_normals_[vox_vidx] = AvgNormal(voxel.second);
-            }
-            if (has_vert_color) {
-                mesh->vertex_colors_[vox_vidx] = AvgColor(voxel.second);
-            }
-        }
-    } else if (contraction == SimplificationContraction::Quadric) {
-        // Map triangles
-        std::unordered_map<int, std::unordered_set<int>> vert_to_triangles;
-        for (size_t tidx = 0; tidx < triangles_.size(); ++tidx) {
-            vert_to_triangles[triangles_[tidx](0)].emplace(int(tidx));
-            vert_to_triangles[triangles_[tidx](1)].emplace(int(tidx));
-            vert_to_triangles[triangles_[tidx](2)].emplace(int(tidx));
-        }
-
-        for (const auto& voxel : voxel_vertices) {
-            int vox_vidx = voxel_vert_ind[voxel.first];
 
+    std::vector<int> adj_offsets;
+    std::vector<int> adj_triangles;
+    if (contraction == SimplificationContraction::Quadric) {
+        ComputeVertexTriangleAdjacency(
+                triangles_, std::vector<char>(triangles_.size(), 0),
+                n_vertices, adj_offsets, adj_triangles);
+    }
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int voxel = 0; voxel < n_voxels; ++voxel) {
+        int vox_vidx = new_vidxs[voxel_order[voxel_begins[voxel]]];
+        bool use_average = contraction == SimplificationContraction::Average;
+        if (contraction == SimplificationContraction::Quadric) {
             Quadric q;
-            for (int vidx : voxel.second) {
-                for (int tidx : vert_to_triangles[vidx]) {
+            for (int k = voxel_begins[voxel]; k < voxel_begins[voxel + 1];
+                 ++k) {
+                int vidx = voxel_order[k];
+                for (int i = adj_offsets[vidx]; i < adj_offsets[vidx + 1];
+                     ++i) {
+                    int tidx = adj_triangles[i];
                     Eigen::Vector4d p = GetTrianglePlane(tidx);
                     double area = GetTriangleArea(tidx);
                     q += Quadric(p, area);
                 }
             }
             if (q.IsInvertible()) {
-                Eigen::Vector3d v = q.Minimum();
-                mesh->vertices_[vox_vidx] = v;
+                mesh->vertices_[vox_vidx] = q.Minimum();
             } else {
-                mesh->vertices_[vox_vidx] = AvgVertex(voxel.second);
-            }
-
-            if (has_vert_normal) {
-                mesh->vertex_normals_[vox_vidx] = AvgNormal(voxel.second);
-            }
-            if (has_vert_color) {
-                mesh->vertex_colors_[vox_vidx] = AvgColor(voxel.second);
+                use_average = true;
             }
         }
+        if (use_average) {
+            mesh->vertices_[vox_vidx] = Avg(vertices_, voxel);
+        }
+        if (has_vert_normal) {
+            mesh->vertex_normals_[vox_vidx] = Avg(vertex_normals_, voxel);
+        }
+        if (has_vert_color) {
+            mesh->vertex_colors_[vox_vidx] = Avg(vertex_colors_, voxel);
+        }
     }
 
     //  connect vertices
-    std::unordered_set<Eigen::Vector3i, utility::hash_eigen<Eigen::Vector3i>>
-            triangles;
-    for (const auto& triangle : triangles_) {
-        int vidx0 = voxel_vert_ind[GetVoxelIdx(vertices_[triangle(0)])];
-        int vidx1 = voxel_vert_ind[GetVoxelIdx(vertices_[triangle(1)])];
-        int vidx2 = voxel_vert_ind[GetVoxelIdx(vertices_[triangle(2)])];
+    const int n_triangles = static_cast<int>(triangles_.size());
+    std::vector<Eigen::Vector3i> triangles(n_triangles);
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int tidx = 0; tidx < n_triangles; ++tidx) {
+        const Eigen::Vector3i& triangle = triangles_[tidx];
+        int vidx0 = new_vidxs[triangle(0)];
+        int vidx1 = new_vidxs[triangle(1)];
+        int vidx2 = new_vidxs[triangle(2)];
 
         // only connect if in different voxels
         if (vidx0 == vidx1 || vidx0 == vidx2 || vidx1 == vidx2) {
+            triangles[tidx] = Eigen::Vector3i(-1, -1, -1);
             continue;
         }
 
@@ -245,15 +310,22 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SimplifyVertexClustering(
             vidx2 = tmp;
         }
 
-        triangles.emplace(Eigen::Vector3i(vidx0, vidx1, vidx2));
+        triangles[tidx] = Eigen::Vector3i(vidx0, vidx1, vidx2);
     }
 
-    mesh->triangles_.resize(triangles.size());
-    int tidx = 0;
-    for (const Eigen::Vector3i& triangle : triangles) {
-        mesh->triangles_[tidx] = triangle;
-        tidx++;
+    // Remove the degenerate and the duplicated triangles, which are adjacent
+    // once sorted.
+    auto TriangleLess = [](const Eigen::Vector3i& a, const Eigen::Vector3i& b) {
+        return std::make_tuple(a(0), a(1), a(2)) <
+               std::make_tuple(b(0), b(1), b(2));
+    };
+    tbb::parallel_sort(triangles.begin(), triangles.end(), TriangleLess);
+    triangles.erase(std::unique(triangles.begin(), triangles.end()),
+                    triangles.end());
+    if (!triangles.empty() && triangles[0](0) < 0) {
+        triangles.erase(triangles.begin());
     }
+    mesh->triangles_ = std::move(triangles);
 
     if (HasTriangleNormals()) {
         mesh->ComputeTriangleNormals();
@@ -304,13 +376,10 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SimplifyQuadricDecimation(
     }
 
     // For boundary edges add perpendicular plane quadric
-    auto edge_triangle_count = GetEdgeToTrianglesMap();
-    auto AddPerpPlaneQuadric = [&](int vidx0, int vidx1, int vidx2,
+    const HalfEdgeArrays half_edges = HalfEdgeArrays::Create(triangles_);
+    auto AddPerpPlaneQuadric = [&](size_t he, int vidx0, int vidx1, int vidx2,
                                    double area) {
-        int min = std::min(vidx0, vidx1);
-        int max = std::max(vidx0, vidx1);
-        Eigen::Vector2i edge(min, max);
-        if (edge_triangle_count[edge].size() != 1) {
+        if (half_edges.NumHalfEdgesOfEdge(half_edges.edge_indices_[he]) != 1) {
             return;
         }
         const auto& vert0 = mesh->vertices_[vidx0];
@@ -325,9 +394,9 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SimplifyQuadricDecimation(
     for (size_t tidx = 0; tidx < triangles_.size(); ++tidx) {
         const auto& tria = triangles_[tidx];
         double area = triangle_areas[tidx];
-        AddPerpPlaneQuadric(tria(0), tria(1), tria(2), area);
-        AddPerpPlaneQuadric(tria(1), tria(2), tria(0), area);
-        AddPerpPlaneQuadric(tria(2), tria(0), tria(1), area);
+        AddPerpPlaneQuadric(3 * tidx, tria(0), tria(1), tria(2), area);
+        AddPerpPlaneQuadric(3 * tidx + 1, tria(1), tria(2), tria(0), area);
+        AddPerpPlaneQuadric(3 * tidx + 2, tria(2), tria(0), tria(1), area);
     }
 
     // Get valid edges and compute cost
@@ -552,5 +621,384 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SimplifyQuadricDecimation(
     return mesh;
 }
 
+namespace {
+
+/// Pseudo-random priority of the collapse proposed by vertex vidx in a round,
+/// from the SplitMix64 generator. Ordering the proposals by cost instead
+/// leaves few local minima where the cost varies smoothly.
+uint64_t CollapsePriority(int vidx, int round) {
+    uint64_t z = (static_cast<uint64_t>(round) << 32) |
+                 static_cast<uint64_t>(static_cast<uint32_t>(vidx));
+    z += 0x9e3779b97f4a7c15ULL;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+void AtomicMin(std::atomic<uint64_t>& target, uint64_t value) {
+    uint64_t current = target.load(std::memory_order_relaxed);
+    while (value < current &&
+           !target.compare_exchange_weak(current, value,
+                                         std::memory_order_relaxed)) {
+    }
+}
+
+bool TriangleHasVertex(const Eigen::Vector3i& tria, int vidx) {
+    return vidx == tria(0) || vidx == tria(1) || vidx == tria(2);
+}
+
+}  // unnamed namespace
+
+std::shared_ptr<TriangleMesh> TriangleMesh::SimplifyQuadricDecimationParallel(
+        int target_number_of_triangles,
+        double maximum_error /* = inf */,
+        double boundary_weight /* = 1.0 */) const {
+    if (HasTriangleUvs()) {
+        utility::LogWarning(
+                "[SimplifyQuadricDecimationParallel] This mesh contains "
+                "triangle uvs that are not handled in this function");
+    }
+    typedef std::tuple<double, int, Eigen::Vector3d> Candidate;
+
+    auto mesh = std::make_shared<TriangleMesh>();
+    mesh->vertices_ = vertices_;
+    mesh->vertex_normals_ = vertex_normals_;
+    mesh->vertex_colors_ = vertex_colors_;
+    mesh->triangles_ = triangles_;
+
+    const int n_vertices = static_cast<int>(vertices_.size());
+    const int n_all_triangles = static_cast<int>(triangles_.size());
+    // The flags are written concurrently, which std::vector<bool> does not
+    // allow.
+    std::vector<char> vertices_deleted(n_vertices, 0);
+    std::vector<char> triangles_deleted(n_all_triangles, 0);
+
+    // Vertex to triangle adjacency of the remaining triangles. The triangles
+    // of vertex vidx are adj_triangles[adj_offsets[vidx]] up to
+    // adj_triangles[adj_offsets[vidx + 1] - 1], in increasing order.
+    std::vector<int> adj_offsets(n_vertices + 1);
+    std::vector<int> adj_triangles;
+    auto BuildAdjacency = [&]() {
+        ComputeVertexTriangleAdjacency(mesh->triangles_, triangles_deleted,
+                                       n_vertices, adj_offsets, adj_triangles);
+    };
+    BuildAdjacency();
+
+    // Compute the error metric per vertex. Boundary edges, i.e. edges of a
+    // single triangle, add the quadric of the plane through the edge that is
+    // perpendicular to the triangle.
+    std::vector<Quadric> Qs(n_vertices);
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int vidx = 0; vidx < n_vertices; ++vidx) {
+        for (int i = adj_offsets[vidx]; i < adj_offsets[vidx + 1]; ++i) {
+            const int tidx = adj_triangles[i];
+            const Eigen::Vector3i& tria = triangles_[tidx];
+            const Eigen::Vector4d plane = GetTrianglePlane(tidx);
+            const double area = GetTriangleArea(tidx);
+            Qs[vidx] += Quadric(plane, area);
+            for (int k = 0; k < 3; ++k) {
+                const int other = tria(k);
+                if (other == vidx) {
+                    continue;
+                }
+                int edge_triangle_count = 0;
+                for (int j = adj_offsets[vidx]; j < adj_offsets[vidx + 1];
+                     ++j) {
+                    edge_triangle_count += TriangleHasVertex(
+                            triangles_[adj_triangles[j]], other);
+                }
+                if (edge_triangle_count != 1) {
+                    continue;
+                }
+                const Eigen::Vector3d& vert0 = vertices_[vidx];
+                const Eigen::Vector3d& vert1 = vertices_[other];
+                Eigen::Vector4d perp_plane = ComputeTrianglePlane(
+                        vert0, vert1, vert0 + plane.head<3>());
+                Qs[vidx] += Quadric(perp_plane, area * boundary_weight);
+            }
+        }
+    }
+
+    // Same cost and placement as SimplifyQuadricDecimation.
+    auto ComputeCollapse = [&](int vidx0, int vidx1, Eigen::Vector3d& vbar) {
+        Quadric Qbar = Qs[vidx0] + Qs[vidx1];
+        if (Qbar.IsInvertible()) {
+            vbar = Qbar.Minimum();
+            return Qbar.Eval(vbar);
+        }
+        const Eigen::Vector3d& v0 = mesh->vertices_[vidx0];
+        const Eigen::Vector3d& v1 = mesh->vertices_[vidx1];
+        Eigen::Vector3d vmid = (v0 + v1) / 2;
+        double cost0 = Qbar.Eval(v0);
+        double cost1 = Qbar.Eval(v1);
+        double costmid = Qbar.Eval(vmid);
+        double cost = std::min(cost0, std::min(cost1, costmid));
+        if (cost == costmid) {
+            vbar = vmid;
+        } else if (cost == cost0) {
+            vbar = v0;
+        } else {
+            vbar = v1;
+        }
+        return cost;
+    };
+
+    // Returns true if moving both vertices of the edge to vbar flips the
+    // normal of one of the remaining triangles around them.
+    auto CollapseFlipsTriangle = [&](int vidx0, int vidx1,
+                                     const Eigen::Vector3d& vbar) {
+        for (int vidx : {vidx0, vidx1}) {
+            for (int i = adj_offsets[vidx]; i < adj_offsets[vidx + 1]; ++i) {
+                const Eigen::Vector3i& tria =
+                        mesh->triangles_[adj_triangles[i]];
+                if (TriangleHasVertex(tria, vidx0) &&
+                    TriangleHasVertex(tria, vidx1)) {
+                    continue;
+                }
+                Eigen::Vector3d verts[3];
+                for (int k = 0; k < 3; ++k) {
+                    verts[k] = mesh->vertices_[tria(k)];
+                }
+                Eigen::Vector3d norm_before =
+                        (verts[1] - verts[0]).cross(verts[2] - verts[0]);
+                for (int k = 0; k < 3; ++k) {
+                    if (tria(k) == vidx) {
+                        verts[k] = vbar;
+                    }
+                }
+                Eigen::Vector3d norm_after =
+                        (verts[1] - verts[0]).cross(verts[2] - verts[0]);
+                if (norm_before.dot(norm_after) < 0) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    };
+
+    bool has_vert_normal = HasVertexNormals();
+    bool has_vert_color = HasVertexColors();
+    std::vector<double> costs(n_vertices);
+    std::vector<int> partners(n_vertices);
+    std::vector<Eigen::Vector3d> vbars(n_vertices);
+    std::vector<std::atomic<uint64_t>> readers(n_vertices);
+    std::vector<std::atomic<uint64_t>> writers(n_vertices);
+    std::vector<char> accepted(n_vertices);
+    std::vector<double> proposal_costs;
+    int n_triangles = n_all_triangles;
+    for (int round = 0; n_triangles > target_number_of_triangles; ++round) {
+        // Every vertex proposes its cheapest edge collapse within the maximum
+        // error that does not flip a triangle. The vertex is kept and moved
+        // to vbar, and its partner is deleted.
+#pragma omp parallel num_threads(utility::EstimateMaxThreads())
+        {
+            std::vector<Candidate> candidates;
+#pragma omp for schedule(static)
+            for (int vidx0 = 0; vidx0 < n_vertices; ++vidx0) {
+                partners[vidx0] = -1;
+                candidates.clear();
+                for (int i = adj_offsets[vidx0]; i < adj_offsets[vidx0 + 1];
+                     ++i) {
+                    const Eigen::Vector3i& tria =
+                            mesh->triangles_[adj_triangles[i]];
+                    for (int k = 0; k < 3; ++k) {
+                        const int vidx1 = tria(k);
+                        bool seen = vidx1 == vidx0;
+                        for (const Candidate& candidate : candidates) {
+                            seen = seen || std::get<1>(candidate) == vidx1;
+                        }
+                        if (seen) {
+                            continue;
+                        }
+                        Eigen::Vector3d vbar;
+                        double cost = ComputeCollapse(vidx0, vidx1, vbar);
+                        candidates.emplace_back(cost, vidx1, vbar);
+                    }
+                }
+                std::sort(candidates.begin(), candidates.end(),
+                          [](const Candidate& a, const Candidate& b) {
+                              return std::make_tuple(std::get<0>(a),
+                                                     std::get<1>(a)) <
+                                     std::make_tuple(std::get<0>(b),
+                                                     std::get<1>(b));
+                          });
+                for (const Candidate& candidate : candidates) {
+                    if (std::get<0>(candidate) > maximum_error) {
+                        break;
+                    }
+                    if (!CollapseFlipsTriangle(vidx0, std::get<1>(candidate),
+                                               std::get<2>(candidate))) {
+                        std::tie(costs[vidx0], partners[vidx0],
+                                 vbars[vidx0]) = candidate;
+                        break;
+                    }
+                }
+            }
+        }
+
+        // Only the cheapest proposals are considered in a round, and not
+        // more than the collapses left to reach the target, as a collapse
+        // usually removes two triangles.
+        proposal_costs.clear();
+        for (int vidx = 0; vidx < n_vertices; ++vidx) {
+            if (partners[vidx] >= 0) {
+                proposal_costs.push_back(costs[vidx]);
+            }
+        }
+        if (proposal_costs.empty()) {
+            break;
+        }
+        const size_t n_needed = static_cast<size_t>(
+                (int64_t(n_triangles) - target_number_of_triangles + 1) / 2);
+        const size_t n_selected = std::max(
+                size_t(1), std::min(n_needed, proposal_costs.size() / 4));
+        std::nth_element(proposal_costs.begin(),
+                         proposal_costs.begin() + n_selected - 1,
+                         proposal_costs.end());
+        const double threshold = proposal_costs[n_selected - 1];
+        auto IsSelected = [&](int vidx) {
+            return partners[vidx] >= 0 && costs[vidx] <= threshold;
+        };
+
+        // A collapse reads the vertices of the triangles around its edge and
+        // writes the two vertices of the edge. A selected proposal is
+        // collapsed if no selected proposal with a smaller priority writes a
+        // vertex it reads or reads a vertex it writes, so the collapses of a
+        // round are independent.
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+        for (int vidx = 0; vidx < n_vertices; ++vidx) {
+            readers[vidx].store(std::numeric_limits<uint64_t>::max(),
+                                std::memory_order_relaxed);
+            writers[vidx].store(std::numeric_limits<uint64_t>::max(),
+                                std::memory_order_relaxed);
+        }
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+        for (int vidx0 = 0; vidx0 < n_vertices; ++vidx0) {
+            if (!IsSelected(vidx0)) {
+                continue;
+            }
+            const uint64_t key = CollapsePriority(vidx0, round);
+            for (int vidx : {vidx0, partners[vidx0]}) {
+                AtomicMin(writers[vidx], key);
+                for (int i = adj_offsets[vidx]; i < adj_offsets[vidx + 1];
+                     ++i) {
+                    const Eigen::Vector3i& tria =
+                            mesh->triangles_[adj_triangles[i]];
+                    for (int k = 0; k < 3; ++k) {
+                        AtomicMin(readers[tria(k)], key);
+                    }
+                }
+            }
+        }
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+        for (int vidx0 = 0; vidx0 < n_vertices; ++vidx0) {
+            accepted[vidx0] = 0;
+            if (!IsSelected(vidx0)) {
+                continue;
+            }
+            const uint64_t key = CollapsePriority(vidx0, round);
+            bool independent = true;
+            for (int vidx : {vidx0, partners[vidx0]}) {
+                independent = independent &&
+                              readers[vidx].load(std::memory_order_relaxed) ==
+                                      key;
+                for (int i = adj_offsets[vidx]; i < adj_offsets[vidx + 1];
+                     ++i) {
+                    const Eigen::Vector3i& tria =
+                            mesh->triangles_[adj_triangles[i]];
+                    for (int k = 0; k < 3; ++k) {
+                        independent = independent &&
+                                      writers[tria(k)].load(
+                                              std::memory_order_relaxed) >= key;
+                    }
+                }
+            }
+            accepted[vidx0] = independent;
+        }
+
+        // Connect the triangles from vidx1 to vidx0, or mark them deleted.
+        int n_removed = 0;
+#pragma omp parallel for schedule(static) reduction(+ : n_removed) num_threads(utility::EstimateMaxThreads())
+        for (int vidx0 = 0; vidx0 < n_vertices; ++vidx0) {
+            if (!accepted[vidx0]) {
+                continue;
+            }
+            const int vidx1 = partners[vidx0];
+            for (int i = adj_offsets[vidx1]; i < adj_offsets[vidx1 + 1]; ++i) {
+                const int tidx = adj_triangles[i];
+                Eigen::Vector3i& tria = mesh->triangles_[tidx];
+                if (TriangleHasVertex(tria, vidx0)) {
+                    triangles_deleted[tidx] = 1;
+                    n_removed++;
+                    continue;
+                }
+                for (int k = 0; k < 3; ++k) {
+                    if (tria(k) == vidx1) {
+                        tria(k) = vidx0;
+                    }
+                }
+            }
+
+            mesh->vertices_[vidx0] = vbars[vidx0];
+            Qs[vidx0] += Qs[vidx1];
+            if (has_vert_normal) {
+                mesh->vertex_normals_[vidx0] =
+                        0.5 * (mesh->vertex_normals_[vidx0] +
+                               mesh->vertex_normals_[vidx1]);
+            }
+            if (has_vert_color) {
+                mesh->vertex_colors_[vidx0] =
+                        0.5 * (mesh->vertex_colors_[vidx0] +
+                               mesh->vertex_colors_[vidx1]);
+            }
+            vertices_deleted[vidx1] = 1;
+        }
+        n_triangles -= n_removed;
+        BuildAdjacency();
+    }
+
+    // Apply changes to the triangle mesh
+    int next_free = 0;
+    std::vector<int> vert_remapping(n_vertices, -1);
+    for (int idx = 0; idx < n_vertices; ++idx) {
+        if (!vertices_deleted[idx]) {
+            vert_remapping[idx] = next_free;
+            mesh->vertices_[next_free] = mesh->vertices_[idx];
+            if (has_vert_normal) {
+                mesh->vertex_normals_[next_free] = mesh->vertex_normals_[idx];
+            }
+            if (has_vert_color) {
+                mesh->vertex_colors_[next_free] = mesh->vertex_colors_[idx];
+            }
+            next_free++;
+        }
+    }
+    mesh->vertices_.resize(next_free);
+    if (has_vert_normal) {
+        mesh->vertex_normals_.resize(next_free);
+    }
+    if (has_vert_color) {
+        mesh->vertex_colors_.resize(next_free);
+    }
+
+    next_free = 0;
+    for (int idx = 0; idx < n_all_triangles; ++idx) {
+        if (!triangles_deleted[idx]) {
+            const Eigen::Vector3i tria = mesh->triangles_[idx];
+            mesh->triangles_[next_free](0) = vert_remapping[tria(0)];
+            mesh->triangles_[next_free](1) = vert_remapping[tria(1)];
+            mesh->triangles_[next_free](2) = vert_remapping[tria(2)];
+            next_free++;
+        }
+    }
+    mesh->triangles_.resize(next_free);
+
+    if (HasTriangleNormals()) {
+        mesh->ComputeTriangleNormals();
+    }
+
+    return mesh;
+}
+
 }  // namespace geometry
 }  // namespace open3d
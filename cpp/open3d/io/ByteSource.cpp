@@ -0,0 +1,596 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/io/ByteSource.h"
+
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <fcntl.h>
+#include <netdb.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
+
+#include "open3d/utility/Console.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Parallel.h"
+
+#if !defined(_WIN32) && !defined(MSG_NOSIGNAL)
+#define MSG_NOSIGNAL 0
+#endif
+
+namespace open3d {
+namespace io {
+
+/// Size of the blocks downloaded by ReadRemoteFile.
+static const int64_t kDownloadBlockSize = 1 << 26;
+/// Number of attempts of an HTTP request before a read fails.
+static const int kHTTPAttempts = 3;
+/// Timeout in seconds of the socket operations of an HTTP request.
+static const int kHTTPTimeout = 60;
+
+bool ByteSource::ReadRanges(const std::vector<ByteRange> &ranges) {
+    std::vector<ByteRange> parts;
+    const int64_t part_size = GetPartSize();
+    for (const ByteRange &range : ranges) {
+        for (int64_t begin = 0; begin < range.size_; begin += part_size) {
+            parts.push_back({range.offset_ + begin,
+                             std::min(part_size, range.size_ - begin),
+                             static_cast<char *>(range.data_) + begin});
+        }
+    }
+    const int64_t num_parts = static_cast<int64_t>(parts.size());
+    if (num_parts == 1) {
+        return Read(parts[0].offset_, parts[0].size_, parts[0].data_);
+    }
+    const int num_threads = static_cast<int>(std::max<int64_t>(
+            1, std::min<int64_t>(GetMaxConcurrentReads(), num_parts)));
+    std::atomic<bool> success(true);
+#pragma omp parallel for schedule(dynamic) num_threads(num_threads)
+    for (int64_t p = 0; p < num_parts; ++p) {
+        const ByteRange &part = parts[p];
+        if (success && !Read(part.offset_, part.size_, part.data_)) {
+            success = false;
+        }
+    }
+    return success;
+}
+
+int ByteSource::GetMaxConcurrentReads() const {
+    return utility::EstimateMaxThreads();
+}
+
+FileByteSource::FileByteSource(const std::string &filename)
+    : filename_(filename) {
+#ifndef _WIN32
+    fd_ = open(filename.c_str(), O_RDONLY);
+    struct stat file_stat;
+    if (fd_ >= 0 && fstat(fd_, &file_stat) == 0) {
+        size_ = static_cast<int64_t>(file_stat.st_size);
+    }
+#else
+    FILE *file = utility::filesystem::FOpen(filename, "rb");
+    if (file != nullptr) {
+        if (_fseeki64(file, 0, SEEK_END) == 0) {
+            size_ = static_cast<int64_t>(_ftelli64(file));
+        }
+        fclose(file);
+    }
+#endif
+}
+
+FileByteSource::~FileByteSource() {
+#ifndef _WIN32
+    if (fd_ >= 0) {
+        close(fd_);
+    }
+#endif
+}
+
+bool FileByteSource::Read(int64_t offset, int64_t size, void *data) {
+    if (offset < 0 || size < 0 || offset > size_ || size > size_ - offset) {
+        return false;
+    }
+#ifndef _WIN32
+    char *dst = static_cast<char *>(data);
+    while (size > 0) {
+        ssize_t read_size = pread(fd_, dst, static_cast<size_t>(size), offset);
+        if (read_size <= 0) {
+            return false;
+        }
+        dst += read_size;
+        offset += read_size;
+        size -= read_size;
+    }
+    return true;
+#else
+    // Each read uses its own handle, so that reads may be concurrent.
+    FILE *file = utility::filesystem::FOpen(filename_, "rb");
+    if (file == nullptr) {
+        return false;
+    }
+    bool success = _fseeki64(file, offset, SEEK_SET) == 0 &&
+                   fread(data, 1, static_cast<size_t>(size), file) ==
+                           static_cast<size_t>(size);
+    fclose(file);
+    return success;
+#endif
+}
+
+MemoryMappedByteSource::MemoryMappedByteSource(const std::string &filename) {
+#ifndef _WIN32
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return;
+    }
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) != 0 || file_stat.st_size == 0) {
+        close(fd);
+        return;
+    }
+    int64_t size = static_cast<int64_t>(file_stat.st_size);
+    void *data_ptr = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data_ptr != MAP_FAILED) {
+        data_ = static_cast<const char *>(data_ptr);
+        size_ = size;
+    }
+#endif
+}
+
+MemoryMappedByteSource::~MemoryMappedByteSource() {
+#ifndef _WIN32
+    if (data_ != nullptr) {
+        munmap(const_cast<char *>(data_), size_);
+    }
+#endif
+}
+
+bool MemoryMappedByteSource::Read(int64_t offset, int64_t size, void *data) {
+    if (offset < 0 || size < 0 || offset > size_ || size > size_ - offset) {
+        return false;
+    }
+    std::memcpy(data, data_ + offset, size);
+    return true;
+}
+
+#ifndef _WIN32
+/// Sends all \p size bytes at \p data to \p socket_fd.
+static bool SendAll(int socket_fd, const char *data, size_t size) {
+    while (size > 0) {
+        ssize_t sent_size = send(socket_fd, data, size, MSG_NOSIGNAL);
+        if (sent_size <= 0) {
+            return false;
+        }
+        data += sent_size;
+        size -= sent_size;
+    }
+    return true;
+}
+
+/// Connects to \p host at \p port, with timeouts on sending and receiving.
+/// Returns the socket, or -1 on failure.
+static int ConnectHTTP(const std::string &host, const std::string &port) {
+    struct addrinfo hints;
+    std::memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    struct addrinfo *addresses = nullptr;
+    if (getaddrinfo(host.c_str(), port.c_str(), &hints, &addresses) != 0) {
+        return -1;
+    }
+    int socket_fd = -1;
+    for (struct addrinfo *address = addresses; address != nullptr;
+         address = address->ai_next) {
+        socket_fd = socket(address->ai_family, address->ai_socktype,
+                           address->ai_protocol);
+        if (socket_fd < 0) {
+            continue;
+        }
+        struct timeval timeout;
+        timeout.tv_sec = kHTTPTimeout;
+        timeout.tv_usec = 0;
+        setsockopt(socket_fd, SOL_SOCKET, SO_RCVTIMEO, &timeout,
+                   sizeof(timeout));
+        setsockopt(socket_fd, SOL_SOCKET, SO_SNDTIMEO, &timeout,
+                   sizeof(timeout));
+#ifdef SO_NOSIGPIPE
+        int no_sigpipe = 1;
+        setsockopt(socket_fd, SOL_SOCKET, SO_NOSIGPIPE, &no_sigpipe,
+                   sizeof(no_sigpipe));
+#endif
+        if (connect(socket_fd, address->ai_addr, address->ai_addrlen) == 0) {
+            break;
+        }
+        close(socket_fd);
+        socket_fd = -1;
+    }
+    freeaddrinfo(addresses);
+    return socket_fd;
+}
+#endif
+
+/// Returns the value of the header \p name, in lower case, of the HTTP
+/// response \p headers, or an empty string.
+static std::string GetHTTPHeader(const std::string &headers,
+                                 const std::string &name) {
+    std::string lower_headers = headers;
+    std::transform(lower_headers.begin(), lower_headers.end(),
+                   lower_headers.begin(), ::tolower);
+    size_t pos = lower_headers.find("\r\n" + name + ":");
+    if (pos == std::string::npos) {
+        return "";
+    }
+    pos += name.size() + 3;
+    size_t end = lower_headers.find("\r\n", pos);
+    std::string value = lower_headers.substr(pos, end - pos);
+    size_t first = value.find_first_not_of(" \t");
+    size_t last = value.find_last_not_of(" \t");
+    return first == std::string::npos ? ""
+                                      : value.substr(first, last - first + 1);
+}
+
+HTTPByteSource::HTTPByteSource(const std::string &url) {
+    const std::string prefix = "http://";
+    if (GetPathScheme(url) != "http") {
+        return;
+    }
+    std::string rest = url.substr(prefix.size());
+    rest = rest.substr(0, rest.find('#'));
+    size_t target_pos = rest.find_first_of("/?");
+    std::string authority = rest.substr(0, target_pos);
+    target_ = target_pos == std::string::npos ? "/" : rest.substr(target_pos);
+    if (target_[0] == '?') {
+        target_ = "/" + target_;
+    }
+    authority = authority.substr(authority.find('@') + 1);
+    // Bracketed IPv6 addresses contain colons.
+    size_t port_pos = authority.rfind(':');
+    if (port_pos != std::string::npos &&
+        authority.find(']', port_pos) == std::string::npos) {
+        host_ = authority.substr(0, port_pos);
+        port_ = authority.substr(port_pos + 1);
+    } else {
+        host_ = authority;
+        port_ = "80";
+    }
+    if (host_.size() > 2 && host_.front() == '[' && host_.back() == ']') {
+        host_ = host_.substr(1, host_.size() - 2);
+    }
+    if (host_.empty()) {
+        return;
+    }
+    // The size is taken from the response to a request of the first byte.
+    // Unlike HEAD requests, this works with URLs presigned for GET.
+    char first_byte;
+    int64_t total_size = -1;
+    for (int attempt = 0; attempt < kHTTPAttempts && total_size < 0;
+         ++attempt) {
+        if (!Request(0, 1, &first_byte, total_size)) {
+            total_size = -1;
+        }
+    }
+    size_ = total_size;
+}
+
+bool HTTPByteSource::Read(int64_t offset, int64_t size, void *data) {
+    if (offset < 0 || size < 0 || offset > size_ || size > size_ - offset) {
+        return false;
+    }
+    if (size == 0) {
+        return true;
+    }
+    int64_t total_size;
+    for (int attempt = 0; attempt < kHTTPAttempts; ++attempt) {
+        if (Request(offset, size, data, total_size)) {
+            return total_size == size_;
+        }
+    }
+    return false;
+}
+
+bool HTTPByteSource::Request(int64_t offset,
+                             int64_t size,
+                             void *data,
+                             int64_t &total_size) const {
+#ifndef _WIN32
+    int socket_fd = ConnectHTTP(host_, port_);
+    if (socket_fd < 0) {
+        return false;
+    }
+    std::string host = host_.find(':') == std::string::npos
+                               ? host_
+                               : "[" + host_ + "]";
+    if (port_ != "80") {
+        host += ":" + port_;
+    }
+    std::string request = "GET " + target_ + " HTTP/1.1\r\nHost: " + host +
+                          "\r\nRange: bytes=" + std::to_string(offset) + "-" +
+                          std::to_string(offset + size - 1) +
+                          "\r\nUser-Agent: Open3D\r\nConnection: close\r\n\r\n";
+    if (!SendAll(socket_fd, request.data(), request.size())) {
+        close(socket_fd);
+        return false;
+    }
+
+    // Reads the headers, and possibly the beginning of the body.
+    std::string response;
+    size_t headers_end = std::string::npos;
+    std::vector<char> buffer(1 << 16);
+    while (headers_end == std::string::npos) {
+        ssize_t received_size =
+                recv(socket_fd, buffer.data(), buffer.size(), 0);
+        if (received_size <= 0) {
+            close(socket_fd);
+            return false;
+        }
+        response.append(buffer.data(), received_size);
+        headers_end = response.find("\r\n\r\n");
+    }
+    std::string headers = response.substr(0, headers_end + 2);
+    std::string body = response.substr(headers_end + 4);
+
+    // Partial responses cover the requested range. Servers ignoring ranges
+    // send the whole file, from which the range is cut out.
+    int status = 0;
+    size_t status_pos = headers.find(' ');
+    if (status_pos != std::string::npos) {
+        status = std::atoi(headers.c_str() + status_pos + 1);
+    }
+    int64_t skip_size = 0;
+    total_size = -1;
+    if (status == 206) {
+        // Content-Range: bytes <first>-<last>/<total>
+        std::string content_range = GetHTTPHeader(headers, "content-range");
+        long long first = -1, last = -1, total = -1;
+        if (std::sscanf(content_range.c_str(), "bytes %lld-%lld/%lld", &first,
+                        &last, &total) != 3 ||
+            first != offset || last != offset + size - 1) {
+            close(socket_fd);
+            return false;
+        }
+        total_size = total;
+    } else if (status == 200) {
+        std::string content_length = GetHTTPHeader(headers, "content-length");
+        if (content_length.empty()) {
+            close(socket_fd);
+            return false;
+        }
+        total_size = std::atoll(content_length.c_str());
+        skip_size = offset;
+        if (total_size < offset + size) {
+            close(socket_fd);
+            return false;
+        }
+    } else {
+        if (status != 0) {
+            utility::LogDebug("HTTP request of {}{} failed with status {}.",
+                              host, target_, status);
+        }
+        close(socket_fd);
+        return false;
+    }
+    if (GetHTTPHeader(headers, "transfer-encoding").find("chunked") !=
+        std::string::npos) {
+        close(socket_fd);
+        return false;
+    }
+
+    // Copies the body, skipping the bytes before the range.
+    char *dst = static_cast<char *>(data);
+    int64_t remaining_size = size;
+    auto consume = [&](const char *src, int64_t src_size) {
+        int64_t skipped = std::min(skip_size, src_size);
+        skip_size -= skipped;
+        int64_t copied = std::min(remaining_size, src_size - skipped);
+        std::memcpy(dst, src + skipped, copied);
+        dst += copied;
+        remaining_size -= copied;
+    };
+    consume(body.data(), static_cast<int64_t>(body.size()));
+    while (remaining_size > 0) {
+        ssize_t received_size =
+                recv(socket_fd, buffer.data(), buffer.size(), 0);
+        if (received_size <= 0) {
+            break;
+        }
+        consume(buffer.data(), received_size);
+    }
+    close(socket_fd);
+    return remaining_size == 0;
+#else
+    return false;
+#endif
+}
+
+static std::mutex &GetByteSourceFactoriesMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+static std::unordered_map<std::string, ByteSourceFactory>
+        &GetByteSourceFactories() {
+    static std::unordered_map<std::string, ByteSourceFactory> factories{
+            {"file",
+             [](const std::string &path) -> std::shared_ptr<ByteSource> {
+                 auto source = std::make_shared<FileByteSource>(
+                         path.substr(std::strlen("file://")));
+                 return source->IsOpen() ? source : nullptr;
+             }},
+            {"http",
+             [](const std::string &path) -> std::shared_ptr<ByteSource> {
+                 auto source = std::make_shared<HTTPByteSource>(path);
+                 return source->IsOpen() ? source : nullptr;
+             }},
+    };
+    return factories;
+}
+
+void RegisterByteSource(const std::string &scheme,
+                        const ByteSourceFactory &factory) {
+    std::string lower_scheme = scheme;
+    std::transform(lower_scheme.begin(), lower_scheme.end(),
+                   lower_scheme.begin(), ::tolower);
+    std::lock_guard<std::mutex> lock(GetByteSourceFactoriesMutex());
+    GetByteSourceFactories()[lower_scheme] = factory;
+}
+
+std::string GetPathScheme(const std::string &path) {
+    size_t scheme_end = path.find("://");
+    if (scheme_end == std::string::npos || scheme_end < 2 ||
+        !std::isalpha(static_cast<unsigned char>(path[0]))) {
+        return "";
+    }
+    std::string scheme = path.substr(0, scheme_end);
+    for (char &c : scheme) {
+        if (!std::isalnum(static_cast<unsigned char>(c)) && c != '+' &&
+            c != '-' && c != '.') {
+            return "";
+        }
+        c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    }
+    return scheme;
+}
+
+bool IsURL(const std::string &path) { return !GetPathScheme(path).empty(); }
+
+/// Returns \p path without the query string and fragment of URLs.
+static std::string GetPathWithoutQuery(const std::string &path) {
+    if (!IsURL(path)) {
+        return path;
+    }
+    size_t authority_pos = path.find("://") + 3;
+    return path.substr(0, path.find_first_of("?#", authority_pos));
+}
+
+std::string GetPathExtensionInLowerCase(const std::string &path) {
+    return utility::filesystem::GetFileExtensionInLowerCase(
+            GetPathWithoutQuery(path));
+}
+
+std::shared_ptr<ByteSource> OpenByteSource(const std::string &path,
+                                           bool map_local) {
+    std::string scheme = GetPathScheme(path);
+    std::shared_ptr<ByteSource> source;
+    if (map_local && (scheme.empty() || scheme == "file")) {
+        auto mapped_source = std::make_shared<MemoryMappedByteSource>(
+                scheme.empty() ? path : path.substr(std::strlen("file://")));
+        if (mapped_source->IsOpen()) {
+            return mapped_source;
+        }
+    }
+    if (scheme.empty()) {
+        auto file_source = std::make_shared<FileByteSource>(path);
+        if (file_source->IsOpen()) {
+            source = file_source;
+        }
+    } else {
+        ByteSourceFactory factory;
+        {
+            std::lock_guard<std::mutex> lock(GetByteSourceFactoriesMutex());
+            auto it = GetByteSourceFactories().find(scheme);
+            if (it == GetByteSourceFactories().end()) {
+                utility::LogWarning("No byte source registered for {}://.",
+                                    scheme);
+                return nullptr;
+            }
+            factory = it->second;
+        }
+        source = factory(path);
+    }
+    return source;
+}
+
+/// Returns a unique temporary path for the download of \p path, ending with
+/// its file name.
+static std::string GetTemporaryPath(const std::string &path) {
+    static std::atomic<int64_t> counter(0);
+#ifdef _WIN32
+    int64_t pid = _getpid();
+#else
+    int64_t pid = getpid();
+#endif
+    std::string name = utility::filesystem::GetFileNameWithoutDirectory(
+            GetPathWithoutQuery(path));
+    std::string directory =
+            utility::filesystem::DirectoryExists("/dev/shm")
+                    ? "/dev/shm/"
+                    : utility::filesystem::GetRegularizedDirectoryName(
+                              utility::filesystem::GetWorkingDirectory());
+    return directory + "open3d_" + std::to_string(pid) + "_" +
+           std::to_string(counter++) + "_" + name;
+}
+
+bool ReadRemoteFile(const std::string &path,
+                    const std::function<bool(const std::string &)> &read) {
+    std::shared_ptr<ByteSource> source = OpenByteSource(path);
+    if (source == nullptr) {
+        utility::LogWarning("Unable to open {}.", path);
+        return false;
+    }
+    std::string temporary_path = GetTemporaryPath(path);
+    FILE *file = utility::filesystem::FOpen(temporary_path, "wb");
+    if (file == nullptr) {
+        utility::LogWarning("Unable to create temporary file {}.",
+                            temporary_path);
+        return false;
+    }
+    const int64_t size = source->GetSize();
+    std::vector<char> buffer(std::min(size, kDownloadBlockSize));
+    bool success = true;
+    for (int64_t begin = 0; success && begin < size;
+         begin += kDownloadBlockSize) {
+        int64_t length = std::min(kDownloadBlockSize, size - begin);
+        success = source->ReadRanges({{begin, length, buffer.data()}}) &&
+                  fwrite(buffer.data(), 1, length, file) ==
+                          static_cast<size_t>(length);
+    }
+    success = fclose(file) == 0 && success;
+    if (!success) {
+        utility::LogWarning("Unable to download {}.", path);
+    } else {
+        success = read(temporary_path);
+    }
+    utility::filesystem::RemoveFile(temporary_path);
+    return success;
+}
+
+}  // namespace io
+}  // namespace open3d
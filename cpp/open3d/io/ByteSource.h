@@ -0,0 +1,205 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace open3d {
+namespace io {
+
+/// Range of \p size_ bytes at \p offset_ of a ByteSource, read into \p data_.
+struct ByteRange {
+    int64_t offset_;
+    int64_t size_;
+    void *data_;
+};
+
+/// \class ByteSource
+///
+/// \brief Random access to the bytes of a local or remote file.
+///
+/// Readers fetch the headers and the parts of the data they need with Read()
+/// and ReadRanges() instead of reading the whole file. Read() may be called
+/// concurrently.
+class ByteSource {
+public:
+    virtual ~ByteSource() {}
+
+public:
+    /// Size of the file in bytes.
+    virtual int64_t GetSize() const = 0;
+
+    /// Reads \p size bytes at \p offset into \p data. Returns false if the
+    /// range is not entirely in the file or can not be read.
+    virtual bool Read(int64_t offset, int64_t size, void *data) = 0;
+
+    /// Returns the contents of the file if it is mapped in memory, otherwise
+    /// nullptr.
+    virtual const char *GetData() const { return nullptr; }
+
+    /// Whether the bytes are fetched over the network.
+    virtual bool IsRemote() const { return false; }
+
+    /// Reads \p ranges concurrently. Ranges larger than GetPartSize() are
+    /// split into parts, which are read by up to GetMaxConcurrentReads()
+    /// threads.
+    bool ReadRanges(const std::vector<ByteRange> &ranges);
+
+protected:
+    /// Number of reads issued concurrently by ReadRanges().
+    virtual int GetMaxConcurrentReads() const;
+
+    /// Maximum size of a part read by ReadRanges().
+    virtual int64_t GetPartSize() const { return 1 << 23; }
+};
+
+/// ByteSource of a local file read with positioned reads.
+class FileByteSource : public ByteSource {
+public:
+    /// Opens \p filename. IsOpen() returns false if it can not be opened.
+    explicit FileByteSource(const std::string &filename);
+    ~FileByteSource() override;
+
+public:
+    bool IsOpen() const { return size_ >= 0; }
+    int64_t GetSize() const override { return size_; }
+    bool Read(int64_t offset, int64_t size, void *data) override;
+
+private:
+    std::string filename_;
+    int fd_ = -1;
+    int64_t size_ = -1;
+};
+
+/// ByteSource of a local file mapped read-only in memory. Mapping is not
+/// supported on Windows, where IsOpen() returns false.
+class MemoryMappedByteSource : public ByteSource {
+public:
+    explicit MemoryMappedByteSource(const std::string &filename);
+    ~MemoryMappedByteSource() override;
+
+public:
+    bool IsOpen() const { return data_ != nullptr; }
+    int64_t GetSize() const override { return size_; }
+    bool Read(int64_t offset, int64_t size, void *data) override;
+    const char *GetData() const override { return data_; }
+
+private:
+    const char *data_ = nullptr;
+    int64_t size_ = 0;
+};
+
+/// \brief ByteSource of a file served over HTTP, read with range requests.
+///
+/// Each read opens a connection and sends a GET request with a Range header,
+/// so that presigned URLs of S3-compatible storage can be used. Servers that
+/// ignore the Range header are supported, at the cost of transferring the
+/// file up to the end of each range. Only plain http:// URLs are supported;
+/// HTTPS and other protocols can be added with RegisterByteSource(). Not
+/// supported on Windows, where IsOpen() returns false.
+class HTTPByteSource : public ByteSource {
+public:
+    /// Opens \p url and requests the size of the file.
+    explicit HTTPByteSource(const std::string &url);
+
+public:
+    bool IsOpen() const { return size_ >= 0; }
+    int64_t GetSize() const override { return size_; }
+    bool Read(int64_t offset, int64_t size, void *data) override;
+    bool IsRemote() const override { return true; }
+
+protected:
+    int GetMaxConcurrentReads() const override { return 8; }
+
+private:
+    /// Sends a GET request for [offset, offset + size) and reads the body
+    /// into \p data. \p total_size is set from the response headers.
+    bool Request(int64_t offset,
+                 int64_t size,
+                 void *data,
+                 int64_t &total_size) const;
+
+    std::string host_;
+    std::string port_;
+    std::string target_;
+    int64_t size_ = -1;
+};
+
+/// Creates the ByteSource of a path, or returns nullptr if it can not be
+/// opened.
+using ByteSourceFactory =
+        std::function<std::shared_ptr<ByteSource>(const std::string &)>;
+
+/// \brief Registers \p factory for the paths starting with "<scheme>://",
+/// e.g. "s3" for "s3://bucket/scan.pcd". A factory registered for a scheme
+/// replaces the previous one; "file" and "http" are registered by default.
+void RegisterByteSource(const std::string &scheme,
+                        const ByteSourceFactory &factory);
+
+/// Returns the lower case scheme of \p path, e.g. "http" for
+/// "http://host/scan.ply", or an empty string for local paths. Single letter
+/// schemes are taken for Windows drive letters.
+std::string GetPathScheme(const std::string &path);
+
+/// Returns whether \p path is a URL, e.g. "http://host/scan.ply" or
+/// "file:///data/scan.ply", which is opened by the ByteSource registered for
+/// its scheme instead of the file system.
+bool IsURL(const std::string &path);
+
+/// Returns the lower case extension of \p path like
+/// utility::filesystem::GetFileExtensionInLowerCase, ignoring the query
+/// string and fragment of URLs.
+std::string GetPathExtensionInLowerCase(const std::string &path);
+
+/// \brief Opens \p path with the ByteSource registered for its scheme.
+///
+/// Local paths and "file://" URLs are mapped in memory when \p map_local is
+/// true and mapping is supported, otherwise read with positioned reads.
+/// \return The source, or nullptr if \p path can not be opened.
+std::shared_ptr<ByteSource> OpenByteSource(const std::string &path,
+                                           bool map_local = false);
+
+/// \brief Reads a remote file by downloading it with parallel range reads
+/// into a temporary file and calling \p read with its path.
+///
+/// This is the fallback for readers without ranged reads. The temporary file
+/// keeps the extension of \p path, so that \p read can dispatch on it, and is
+/// removed afterwards. It is created in shared memory where available
+/// (/dev/shm), otherwise in the working directory.
+///
+/// \return The result of \p read, or false if the file can not be
+/// downloaded.
+bool ReadRemoteFile(const std::string &path,
+                    const std::function<bool(const std::string &)> &read);
+
+}  // namespace io
+}  // namespace open3d
@@ -0,0 +1,459 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/io/CompressedFileIO.h"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <zlib.h>
+#ifdef WITH_ZSTD
+#include <zstd.h>
+#endif
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "open3d/utility/ASCIIParser.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace io {
+
+/// Size of the blocks compressed in parallel, and of the decompression
+/// buffer.
+static const int64_t kCompressionBlockSize = 1 << 22;
+
+std::string GetFileCompression(const std::string &filename) {
+    std::string extension =
+            utility::filesystem::GetFileExtensionInLowerCase(filename);
+    return extension == "gz" || extension == "zst" ? extension : "";
+}
+
+struct CompressedFileReader::Impl {
+    gzFile gz_file_ = nullptr;
+#ifdef WITH_ZSTD
+    FILE *file_ = nullptr;
+    ZSTD_DCtx *context_ = nullptr;
+    std::vector<char> input_;
+    ZSTD_inBuffer input_buffer_ = {nullptr, 0, 0};
+    // Nonzero while a zstd frame is incomplete.
+    size_t frame_remaining_ = 0;
+#endif
+};
+
+CompressedFileReader::CompressedFileReader() : impl_(new Impl()) {}
+
+CompressedFileReader::~CompressedFileReader() { Close(); }
+
+bool CompressedFileReader::Open(const std::string &filename) {
+    Close();
+    std::string compression = GetFileCompression(filename);
+    if (compression == "gz") {
+        impl_->gz_file_ = gzopen(filename.c_str(), "rb");
+        if (impl_->gz_file_ == nullptr) {
+            return false;
+        }
+        gzbuffer(impl_->gz_file_,
+                 static_cast<unsigned int>(kCompressionBlockSize));
+        return true;
+    }
+#ifdef WITH_ZSTD
+    if (compression == "zst") {
+        impl_->file_ = utility::filesystem::FOpen(filename, "rb");
+        impl_->context_ = ZSTD_createDCtx();
+        if (impl_->file_ == nullptr || impl_->context_ == nullptr) {
+            Close();
+            return false;
+        }
+        impl_->input_.resize(ZSTD_DStreamInSize());
+        impl_->input_buffer_ = {impl_->input_.data(), 0, 0};
+        return true;
+    }
+#endif
+    utility::LogWarning(
+            "Read failed: unsupported compression (zstd requires WITH_ZSTD) "
+            "of file: {}",
+            filename);
+    return false;
+}
+
+int64_t CompressedFileReader::Read(char *data, int64_t size) {
+    size = std::min<int64_t>(size, INT_MAX);
+    if (size <= 0) {
+        return 0;
+    }
+    if (impl_->gz_file_ != nullptr) {
+        int count = gzread(impl_->gz_file_, data,
+                           static_cast<unsigned int>(size));
+        // A truncated file ends as a complete one, with an error set.
+        int error = Z_OK;
+        if (count == 0) {
+            gzerror(impl_->gz_file_, &error);
+        }
+        return error == Z_OK ? count : -1;
+    }
+#ifdef WITH_ZSTD
+    if (impl_->context_ != nullptr) {
+        ZSTD_inBuffer &input = impl_->input_buffer_;
+        ZSTD_outBuffer output = {data, static_cast<size_t>(size), 0};
+        while (output.pos == 0) {
+            if (input.pos == input.size) {
+                input.size = fread(impl_->input_.data(), 1,
+                                   impl_->input_.size(), impl_->file_);
+                input.pos = 0;
+                if (input.size == 0) {
+                    return ferror(impl_->file_) != 0 ||
+                                           impl_->frame_remaining_ != 0
+                                   ? -1
+                                   : 0;
+                }
+            }
+            impl_->frame_remaining_ =
+                    ZSTD_decompressStream(impl_->context_, &output, &input);
+            if (ZSTD_isError(impl_->frame_remaining_)) {
+                return -1;
+            }
+        }
+        return static_cast<int64_t>(output.pos);
+    }
+#endif
+    return -1;
+}
+
+void CompressedFileReader::Close() {
+    if (impl_->gz_file_ != nullptr) {
+        gzclose(impl_->gz_file_);
+        impl_->gz_file_ = nullptr;
+    }
+#ifdef WITH_ZSTD
+    if (impl_->file_ != nullptr) {
+        fclose(impl_->file_);
+        impl_->file_ = nullptr;
+    }
+    ZSTD_freeDCtx(impl_->context_);
+    impl_->context_ = nullptr;
+    impl_->frame_remaining_ = 0;
+#endif
+}
+
+bool ReadASCIIRowsFromFile(const std::string &filename,
+                           int64_t num_columns,
+                           std::vector<double> &rows,
+                           int64_t skip_lines /* = 0*/,
+                           int64_t max_rows /* = -1*/) {
+    if (GetFileCompression(filename).empty()) {
+        return utility::ReadASCIIRows(filename, num_columns, rows, skip_lines,
+                                      max_rows);
+    }
+    CompressedFileReader reader;
+    if (!reader.Open(filename)) {
+        return false;
+    }
+    return utility::ReadASCIIRows(
+            [&](char *data, int64_t size) { return reader.Read(data, size); },
+            num_columns, rows, skip_lines, max_rows);
+}
+
+/// Returns the directory for temporary files, without a trailing separator.
+static std::string GetTemporaryDirectory() {
+#ifdef _WIN32
+    const char *variables[] = {"TMP", "TEMP"};
+    std::string directory = ".";
+#else
+    const char *variables[] = {"TMPDIR"};
+    std::string directory = "/tmp";
+#endif
+    for (const char *variable : variables) {
+        const char *value = std::getenv(variable);
+        if (value != nullptr && *value != '\0') {
+            directory = value;
+            break;
+        }
+    }
+    while (directory.size() > 1 &&
+           (directory.back() == '/' || directory.back() == '\\')) {
+        directory.pop_back();
+    }
+    return directory;
+}
+
+/// \brief Creates an empty temporary file for the content of the compressed
+/// file \p filename, ending with its inner extension.
+///
+/// As mkstemp, the file gets a random name and is created with O_EXCL, so that
+/// an existing file or symbolic link is never reused, and is only accessible
+/// by its owner.
+///
+/// \return The path of the file, or an empty string on failure.
+static std::string CreateTemporaryFile(const std::string &filename) {
+    std::string extension = utility::filesystem::GetFileExtensionInLowerCase(
+            utility::filesystem::GetFileNameWithoutExtension(filename));
+    std::string prefix = GetTemporaryDirectory() + "/open3d_";
+    std::string suffix = extension.empty() ? "" : "." + extension;
+    std::random_device device;
+    std::mt19937_64 generator((static_cast<uint64_t>(device()) << 32) ^
+                              device());
+    for (int attempt = 0; attempt < 100; ++attempt) {
+        std::string path =
+                prefix + fmt::format("{:016x}", generator()) + suffix;
+#ifdef _WIN32
+        int fd = _open(path.c_str(), _O_CREAT | _O_EXCL | _O_WRONLY | _O_BINARY,
+                       _S_IREAD | _S_IWRITE);
+        if (fd >= 0) {
+            _close(fd);
+            return path;
+        }
+#else
+        int fd = open(path.c_str(), O_CREAT | O_EXCL | O_WRONLY, 0600);
+        if (fd >= 0) {
+            close(fd);
+            return path;
+        }
+#endif
+        if (errno != EEXIST) {
+            break;
+        }
+    }
+    utility::LogWarning("Unable to create a temporary file in {}: {}",
+                        GetTemporaryDirectory(), std::strerror(errno));
+    return "";
+}
+
+/// Decompresses \p filename into \p output_filename one buffer at a time.
+static bool DecompressFile(const std::string &filename,
+                           const std::string &output_filename) {
+    CompressedFileReader reader;
+    if (!reader.Open(filename)) {
+        return false;
+    }
+    FILE *output = utility::filesystem::FOpen(output_filename, "wb");
+    if (output == nullptr) {
+        return false;
+    }
+    std::vector<char> buffer(kCompressionBlockSize);
+    bool success = true;
+    while (success) {
+        int64_t size = reader.Read(buffer.data(), buffer.size());
+        if (size <= 0) {
+            success = size == 0;
+            break;
+        }
+        success = fwrite(buffer.data(), 1, size, output) ==
+                  static_cast<size_t>(size);
+    }
+    return fclose(output) == 0 && success;
+}
+
+/// Compresses \p size bytes at \p data into a gzip member.
+static bool CompressGzipMember(const char *data,
+                               int64_t size,
+                               std::vector<char> &member) {
+    z_stream stream;
+    std::memset(&stream, 0, sizeof(stream));
+    // 16 selects the gzip wrapper.
+    if (deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 + 16, 8,
+                     Z_DEFAULT_STRATEGY) != Z_OK) {
+        return false;
+    }
+    member.resize(deflateBound(&stream, static_cast<uLong>(size)));
+    stream.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(data));
+    stream.avail_in = static_cast<uInt>(size);
+    stream.next_out = reinterpret_cast<Bytef *>(member.data());
+    stream.avail_out = static_cast<uInt>(member.size());
+    int result = deflate(&stream, Z_FINISH);
+    member.resize(stream.total_out);
+    deflateEnd(&stream);
+    return result == Z_STREAM_END;
+}
+
+/// Compresses \p input into the gzip file \p output, reading one block per
+/// thread at a time and compressing the blocks in parallel.
+static bool CompressGzipFile(FILE *input, FILE *output) {
+    int64_t num_threads = utility::EstimateMaxThreads();
+    std::vector<std::vector<char>> blocks(num_threads);
+    std::vector<std::vector<char>> members(num_threads);
+    bool success = true;
+    bool is_first = true;
+    while (success) {
+        int64_t num_blocks = 0;
+        for (; num_blocks < num_threads; ++num_blocks) {
+            std::vector<char> &block = blocks[num_blocks];
+            block.resize(kCompressionBlockSize);
+            block.resize(fread(block.data(), 1, block.size(), input));
+            if (block.empty()) {
+                break;
+            }
+        }
+        // An empty file still gets a member.
+        if (num_blocks == 0 && !is_first) {
+            break;
+        }
+        num_blocks = std::max<int64_t>(num_blocks, 1);
+        is_first = false;
+        std::vector<char> block_success(num_blocks, 1);
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+        for (int64_t b = 0; b < num_blocks; ++b) {
+            block_success[b] = CompressGzipMember(blocks[b].data(),
+                                                  blocks[b].size(), members[b]);
+        }
+        for (int64_t b = 0; b < num_blocks && success; ++b) {
+            success = block_success[b] &&
+                      fwrite(members[b].data(), 1, members[b].size(), output) ==
+                              members[b].size();
+        }
+        if (blocks[num_blocks - 1].size() <
+            static_cast<size_t>(kCompressionBlockSize)) {
+            break;
+        }
+    }
+    return success;
+}
+
+#ifdef WITH_ZSTD
+/// Compresses \p input into the zstd file \p output, with the worker threads
+/// of libzstd where it is built with multithreading support.
+static bool CompressZstdFile(FILE *input, FILE *output) {
+    ZSTD_CCtx *context = ZSTD_createCCtx();
+    if (context == nullptr) {
+        return false;
+    }
+    ZSTD_CCtx_setParameter(context, ZSTD_c_compressionLevel,
+                           ZSTD_CLEVEL_DEFAULT);
+    // Fails, and compresses on the calling thread, without multithreading.
+    ZSTD_CCtx_setParameter(context, ZSTD_c_nbWorkers,
+                           static_cast<int>(utility::EstimateMaxThreads()));
+    std::vector<char> input_data(ZSTD_CStreamInSize());
+    std::vector<char> output_data(ZSTD_CStreamOutSize());
+    bool success = true;
+    bool is_last = false;
+    while (success && !is_last) {
+        size_t size = fread(input_data.data(), 1, input_data.size(), input);
+        is_last = size < input_data.size();
+        ZSTD_EndDirective mode = is_last ? ZSTD_e_end : ZSTD_e_continue;
+        ZSTD_inBuffer input_buffer = {input_data.data(), size, 0};
+        bool is_done = false;
+        while (success && !is_done) {
+            ZSTD_outBuffer output_buffer = {output_data.data(),
+                                            output_data.size(), 0};
+            size_t remaining = ZSTD_compressStream2(context, &output_buffer,
+                                                    &input_buffer, mode);
+            success = !ZSTD_isError(remaining) &&
+                      fwrite(output_data.data(), 1, output_buffer.pos,
+                             output) == output_buffer.pos;
+            is_done = is_last ? remaining == 0
+                              : input_buffer.pos == input_buffer.size;
+        }
+    }
+    ZSTD_freeCCtx(context);
+    return success;
+}
+#endif
+
+/// Compresses \p filename into \p output_filename as given by the compression
+/// of \p output_filename.
+static bool CompressFile(const std::string &filename,
+                         const std::string &output_filename) {
+    FILE *input = utility::filesystem::FOpen(filename, "rb");
+    if (input == nullptr) {
+        return false;
+    }
+    FILE *output = utility::filesystem::FOpen(output_filename, "wb");
+    if (output == nullptr) {
+        fclose(input);
+        return false;
+    }
+    bool success;
+#ifdef WITH_ZSTD
+    if (GetFileCompression(output_filename) == "zst") {
+        success = CompressZstdFile(input, output);
+    } else
+#endif
+    {
+        success = CompressGzipFile(input, output);
+    }
+    success = success && ferror(input) == 0;
+    fclose(input);
+    return fclose(output) == 0 && success;
+}
+
+bool ReadCompressedFile(const std::string &filename,
+                        const std::function<bool(const std::string &)> &read) {
+    std::string temporary_path = CreateTemporaryFile(filename);
+    if (temporary_path.empty()) {
+        return false;
+    }
+    if (!DecompressFile(filename, temporary_path)) {
+        utility::filesystem::RemoveFile(temporary_path);
+        utility::LogWarning("Read failed: unable to decompress file: {}",
+                            filename);
+        return false;
+    }
+    bool success = read(temporary_path);
+    utility::filesystem::RemoveFile(temporary_path);
+    return success;
+}
+
+bool WriteCompressedFile(
+        const std::string &filename,
+        const std::function<bool(const std::string &)> &write) {
+#ifndef WITH_ZSTD
+    if (GetFileCompression(filename) == "zst") {
+        utility::LogWarning(
+                "Write failed: zstd requires building with WITH_ZSTD: {}",
+                filename);
+        return false;
+    }
+#endif
+    std::string temporary_path = CreateTemporaryFile(filename);
+    if (temporary_path.empty()) {
+        return false;
+    }
+    bool success = write(temporary_path);
+    if (success && !CompressFile(temporary_path, filename)) {
+        utility::LogWarning("Write failed: unable to compress file: {}",
+                            filename);
+        success = false;
+    }
+    utility::filesystem::RemoveFile(temporary_path);
+    return success;
+}
+
+}  // namespace io
+}  // namespace open3d
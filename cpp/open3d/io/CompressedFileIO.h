@@ -0,0 +1,107 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace open3d {
+namespace io {
+
+/// Returns the compression of \p filename from its last extension, "gz" for
+/// gzip, "zst" for zstd, or an empty string for uncompressed files such as
+/// "scan.ply". zstd files are only supported when built with WITH_ZSTD.
+std::string GetFileCompression(const std::string &filename);
+
+/// Sequential reader of a compressed file, which decompresses it one buffer
+/// at a time.
+class CompressedFileReader {
+public:
+    CompressedFileReader();
+    ~CompressedFileReader();
+
+    /// Opens \p filename, whose compression is given by GetFileCompression.
+    bool Open(const std::string &filename);
+
+    /// \brief Decompresses up to \p size bytes into \p data.
+    ///
+    /// \return The number of bytes read, 0 at the end of the file, or -1 if
+    /// the file is corrupted or truncated.
+    int64_t Read(char *data, int64_t size);
+
+    void Close();
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+/// \brief Reads the rows of numbers of an ASCII file as
+/// utility::ReadASCIIRows, decompressing it on the fly if it is compressed,
+/// e.g. "cloud.xyz.gz".
+///
+/// The decompressed content is parsed in blocks and never written to disk or
+/// held in memory as a whole.
+bool ReadASCIIRowsFromFile(const std::string &filename,
+                           int64_t num_columns,
+                           std::vector<double> &rows,
+                           int64_t skip_lines = 0,
+                           int64_t max_rows = -1);
+
+/// \brief Reads a compressed file, e.g. "cloud.ply.gz", by decompressing it
+/// into a temporary file and calling \p read with its path.
+///
+/// The temporary file is created exclusively, readable only by its owner, in
+/// the temporary directory (TMPDIR, or /tmp), keeps the inner extension so
+/// that \p read can dispatch on it, and is removed afterwards. Files
+/// referenced by relative path, such as the materials of an OBJ file, are not
+/// found. ASCII point clouds are streamed by ReadASCIIRowsFromFile instead.
+///
+/// \return The result of \p read, or false if the file can not be
+/// decompressed.
+bool ReadCompressedFile(const std::string &filename,
+                        const std::function<bool(const std::string &)> &read);
+
+/// \brief Writes a compressed file, e.g. "scan.ply.gz", by calling \p write
+/// with the path of a temporary file and compressing it into \p filename.
+///
+/// The temporary file is created as by ReadCompressedFile, and only it is
+/// compressed: side files such as OBJ materials are left next to it. gzip
+/// files are compressed in parallel blocks written as concatenated gzip
+/// members, which standard gzip tools read as a single stream, and zstd files
+/// with the worker threads of libzstd.
+///
+/// \return The result of \p write, or false if the file can not be
+/// compressed.
+bool WriteCompressedFile(const std::string &filename,
+                         const std::function<bool(const std::string &)> &write);
+
+}  // namespace io
+}  // namespace open3d
@@ -28,6 +28,7 @@
 
 #include <map>
 
+#include "open3d/io/CompressedFileIO.h"
 #include "open3d/utility/FileSystem.h"
 
 namespace open3d {
@@ -49,6 +50,14 @@ static std::map<std::string, FileGeometry (*)(const std::string&)> gExt2Func = {
 };
 
 FileGeometry ReadFileGeometryType(const std::string& path) {
+    if (!GetFileCompression(path).empty()) {
+        FileGeometry geometry = CONTENTS_UNKNOWN;
+        ReadCompressedFile(path, [&](const std::string& inner_path) {
+            geometry = ReadFileGeometryType(inner_path);
+            return true;
+        });
+        return geometry;
+    }
     auto ext = utility::filesystem::GetFileExtensionInLowerCase(path);
     auto it = gExt2Func.find(ext);
     if (it != gExt2Func.end()) {
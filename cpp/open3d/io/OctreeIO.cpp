@@ -40,6 +40,7 @@ static const std::unordered_map<
         std::function<bool(const std::string &, geometry::Octree &)>>
         file_extension_to_octree_read_function{
                 {"json", ReadOctreeFromJson},
+                {"o3doct", ReadOctreeFromO3DOCT},
         };
 
 static const std::unordered_map<
@@ -47,12 +48,13 @@ static const std::unordered_map<
         std::function<bool(const std::string &, const geometry::Octree &)>>
         file_extension_to_octree_write_function{
                 {"json", WriteOctreeToJson},
+                {"o3doct", WriteOctreeToO3DOCT},
         };
 
 std::shared_ptr<geometry::Octree> CreateOctreeFromFile(
         const std::string &filename, const std::string &format) {
     auto octree = std::make_shared<geometry::Octree>();
-    WriteOctree(filename, *octree);
+    ReadOctree(filename, *octree, format);
     return octree;
 }
 
@@ -109,5 +111,33 @@ bool WriteOctreeToJson(const std::string &filename,
                        const geometry::Octree &octree) {
     return WriteIJsonConvertibleToJSON(filename, octree);
 }
+
+bool ReadLinearOctree(const std::string &filename,
+                      geometry::LinearOctree &octree) {
+    std::string filename_ext =
+            utility::filesystem::GetFileExtensionInLowerCase(filename);
+    if (filename_ext != "o3doct") {
+        utility::LogWarning(
+                "Read geometry::LinearOctree failed: unknown file extension.");
+        return false;
+    }
+    bool success = ReadLinearOctreeFromO3DOCT(filename, octree);
+    utility::LogDebug("Read geometry::LinearOctree.");
+    return success;
+}
+
+bool WriteLinearOctree(const std::string &filename,
+                       const geometry::LinearOctree &octree) {
+    std::string filename_ext =
+            utility::filesystem::GetFileExtensionInLowerCase(filename);
+    if (filename_ext != "o3doct") {
+        utility::LogWarning(
+                "Write geometry::LinearOctree failed: unknown file extension.");
+        return false;
+    }
+    bool success = WriteLinearOctreeToO3DOCT(filename, octree);
+    utility::LogDebug("Write geometry::LinearOctree.");
+    return success;
+}
 }  // namespace io
 }  // namespace open3d
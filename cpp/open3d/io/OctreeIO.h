@@ -28,6 +28,7 @@
 
 #include <string>
 
+#include "open3d/geometry/LinearOctree.h"
 #include "open3d/geometry/Octree.h"
 
 namespace open3d {
@@ -57,5 +58,35 @@ bool ReadOctreeFromJson(const std::string &filename, geometry::Octree &octree);
 bool WriteOctreeToJson(const std::string &filename,
                        const geometry::Octree &octree);
 
+/// Reads an Octree from the binary .o3doct format, see
+/// ReadLinearOctreeFromO3DOCT.
+bool ReadOctreeFromO3DOCT(const std::string &filename,
+                          geometry::Octree &octree);
+
+/// Writes an Octree to the binary .o3doct format through its LinearOctree.
+bool WriteOctreeToO3DOCT(const std::string &filename,
+                         const geometry::Octree &octree);
+
+/// The general entrance for reading a LinearOctree from a file. Only the
+/// .o3doct format is supported.
+/// \return return true if the read function is successful, false otherwise.
+bool ReadLinearOctree(const std::string &filename,
+                      geometry::LinearOctree &octree);
+
+/// The general entrance for writing a LinearOctree to a file. Only the
+/// .o3doct format is supported.
+/// \return return true if the write function is successful, false otherwise.
+bool WriteLinearOctree(const std::string &filename,
+                       const geometry::LinearOctree &octree);
+
+/// Reads a LinearOctree from the binary .o3doct format, which stores the
+/// bounds, one child mask byte per node in depth-first order and the colors
+/// of the leaves.
+bool ReadLinearOctreeFromO3DOCT(const std::string &filename,
+                                geometry::LinearOctree &octree);
+
+bool WriteLinearOctreeToO3DOCT(const std::string &filename,
+                               const geometry::LinearOctree &octree);
+
 }  // namespace io
 }  // namespace open3d
@@ -57,6 +57,7 @@ static const std::unordered_map<
                 {"log", ReadPinholeCameraTrajectoryFromLOG},
                 {"json", ReadPinholeCameraTrajectoryFromJSON},
                 {"txt", ReadPinholeCameraTrajectoryFromTUM},
+                {"o3dtraj", ReadPinholeCameraTrajectoryFromO3DTRAJ},
         };
 
 static const std::unordered_map<
@@ -67,6 +68,7 @@ static const std::unordered_map<
                 {"log", WritePinholeCameraTrajectoryToLOG},
                 {"json", WritePinholeCameraTrajectoryToJSON},
                 {"txt", WritePinholeCameraTrajectoryToTUM},
+                {"o3dtraj", WritePinholeCameraTrajectoryToO3DTRAJ},
         };
 
 }  // unnamed namespace
@@ -68,5 +68,15 @@ bool WritePinholeCameraTrajectoryToTUM(
         const std::string &filename,
         const camera::PinholeCameraTrajectory &trajectory);
 
+/// Reads a PinholeCameraTrajectory from the binary .o3dtraj format, which
+/// stores the camera parameters as fixed-size little-endian records.
+bool ReadPinholeCameraTrajectoryFromO3DTRAJ(
+        const std::string &filename,
+        camera::PinholeCameraTrajectory &trajectory);
+
+bool WritePinholeCameraTrajectoryToO3DTRAJ(
+        const std::string &filename,
+        const camera::PinholeCameraTrajectory &trajectory);
+
 }  // namespace io
 }  // namespace open3d
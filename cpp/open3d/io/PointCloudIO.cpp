@@ -28,11 +28,15 @@
 
 #include <iostream>
 #include <unordered_map>
+#include <unordered_set>
 
+#include "open3d/io/ByteSource.h"
+#include "open3d/io/CompressedFileIO.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Helper.h"
 #include "open3d/utility/ProgressReporters.h"
+#include "open3d/utility/Trace.h"
 
 namespace open3d {
 namespace io {
@@ -65,6 +69,11 @@ static const std::unordered_map<
                 {"pts", WritePointCloudToPTS},
         };
 
+/// Formats whose readers decompress compressed files on the fly. Other
+/// compressed files are decompressed into a temporary file first.
+static const std::unordered_set<std::string> streamed_compressed_formats{
+        "xyz", "xyzn", "xyzrgb"};
+
 std::shared_ptr<geometry::PointCloud> CreatePointCloudFromFile(
         const std::string &filename,
         const std::string &format,
@@ -77,10 +86,28 @@ std::shared_ptr<geometry::PointCloud> CreatePointCloudFromFile(
 bool ReadPointCloud(const std::string &filename,
                     geometry::PointCloud &pointcloud,
                     const ReadPointCloudOption &params) {
+    OPEN3D_TRACE_SCOPE("io::ReadPointCloud");
+    if (IsURL(filename)) {
+        return ReadRemoteFile(filename, [&](const std::string &path) {
+            return ReadPointCloud(path, pointcloud, params);
+        });
+    }
     std::string format = params.format;
     if (format == "auto") {
         format = utility::filesystem::GetFileExtensionInLowerCase(filename);
     }
+    std::string compression = GetFileCompression(filename);
+    if (!compression.empty() && format == compression) {
+        format = utility::filesystem::GetFileExtensionInLowerCase(
+                utility::filesystem::GetFileNameWithoutExtension(filename));
+        if (streamed_compressed_formats.count(format) == 0) {
+            return ReadCompressedFile(filename, [&](const std::string &path) {
+                ReadPointCloudOption inner_params = params;
+                inner_params.format = "auto";
+                return ReadPointCloud(path, pointcloud, inner_params);
+            });
+        }
+    }
 
     utility::LogDebug("Format {} File {}", params.format, filename);
 
@@ -127,6 +154,12 @@ bool ReadPointCloud(const std::string &filename,
 bool WritePointCloud(const std::string &filename,
                      const geometry::PointCloud &pointcloud,
                      const WritePointCloudOption &params) {
+    OPEN3D_TRACE_SCOPE("io::WritePointCloud");
+    if (!GetFileCompression(filename).empty()) {
+        return WriteCompressedFile(filename, [&](const std::string &path) {
+            return WritePointCloud(path, pointcloud, params);
+        });
+    }
     std::string format =
             utility::filesystem::GetFileExtensionInLowerCase(filename);
     auto map_itr = file_extension_to_pointcloud_write_function.find(format);
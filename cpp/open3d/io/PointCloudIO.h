@@ -79,6 +79,8 @@ struct ReadPointCloudOption {
 
 /// The general entrance for reading a PointCloud from a file
 /// The function calls read functions based on the extension name of filename.
+/// Files given by URL, e.g. "http://host/scan.ply", are downloaded with
+/// parallel range reads, see io::OpenByteSource().
 /// See \p ReadPointCloudOption for additional options you can pass.
 /// \return return true if the read function is successful, false otherwise.
 bool ReadPointCloud(const std::string &filename,
@@ -54,6 +54,7 @@ static const std::unordered_map<
                            pipelines::registration::PoseGraph &)>>
         file_extension_to_pose_graph_read_function{
                 {"json", ReadPoseGraphFromJSON},
+                {"o3dpg", ReadPoseGraphFromO3DPG},
         };
 
 static const std::unordered_map<
@@ -62,6 +63,7 @@ static const std::unordered_map<
                            const pipelines::registration::PoseGraph &)>>
         file_extension_to_pose_graph_write_function{
                 {"json", WritePoseGraphToJSON},
+                {"o3dpg", WritePoseGraphToO3DPG},
         };
 
 }  // unnamed namespace
@@ -51,5 +51,15 @@ bool ReadPoseGraph(const std::string &filename,
 bool WritePoseGraph(const std::string &filename,
                     const pipelines::registration::PoseGraph &pose_graph);
 
+/// Reads a PoseGraph from the binary .o3dpg format, which stores the nodes
+/// and edges as fixed-size little-endian records and loads much faster than
+/// JSON for large graphs.
+bool ReadPoseGraphFromO3DPG(const std::string &filename,
+                            pipelines::registration::PoseGraph &pose_graph);
+
+bool WritePoseGraphToO3DPG(
+        const std::string &filename,
+        const pipelines::registration::PoseGraph &pose_graph);
+
 }  // namespace io
 }  // namespace open3d
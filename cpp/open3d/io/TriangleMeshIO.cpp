@@ -28,8 +28,10 @@
 
 #include <unordered_map>
 
+#include "open3d/io/CompressedFileIO.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Trace.h"
 
 namespace open3d {
 
@@ -84,6 +86,13 @@ bool ReadTriangleMesh(const std::string &filename,
                       geometry::TriangleMesh &mesh,
                       bool enable_post_processing /* = false */,
                       bool print_progress /* = false */) {
+    OPEN3D_TRACE_SCOPE("io::ReadTriangleMesh");
+    if (!GetFileCompression(filename).empty()) {
+        return ReadCompressedFile(filename, [&](const std::string &path) {
+            return ReadTriangleMesh(path, mesh, enable_post_processing,
+                                    print_progress);
+        });
+    }
     std::string filename_ext =
             utility::filesystem::GetFileExtensionInLowerCase(filename);
     if (filename_ext.empty()) {
@@ -121,6 +130,14 @@ bool WriteTriangleMesh(const std::string &filename,
                        bool write_vertex_colors /* = true*/,
                        bool write_triangle_uvs /* = true*/,
                        bool print_progress /* = false*/) {
+    OPEN3D_TRACE_SCOPE("io::WriteTriangleMesh");
+    if (!GetFileCompression(filename).empty()) {
+        return WriteCompressedFile(filename, [&](const std::string &path) {
+            return WriteTriangleMesh(path, mesh, write_ascii, compressed,
+                                     write_vertex_normals, write_vertex_colors,
+                                     write_triangle_uvs, print_progress);
+        });
+    }
     std::string filename_ext =
             utility::filesystem::GetFileExtensionInLowerCase(filename);
     if (filename_ext.empty()) {
@@ -0,0 +1,193 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "open3d/io/OctreeIO.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/FileSystem.h"
+
+// The .o3doct format stores a LinearOctree. The structure is given by the
+// child masks of the nodes in depth-first order, from which the Morton codes
+// and subtree sizes are rebuilt, and only the leaves store a color. All
+// values are little-endian.
+//
+//     char[4]   magic "O3DO"
+//     uint32    version
+//     uint32    max depth
+//     float64   origin x, y, z
+//     float64   size
+//     uint64    number of nodes n
+//     uint8[n]  child masks
+//     float64[] colors of the leaves, r, g, b per leaf in depth-first order
+
+namespace open3d {
+
+namespace {
+
+const char kO3DOCTMagic[4] = {'O', '3', 'D', 'O'};
+const uint32_t kO3DOCTVersion = 1;
+
+template <typename T>
+bool ReadValues(FILE *file, T *values, size_t count) {
+    return fread(values, sizeof(T), count, file) == count;
+}
+
+template <typename T>
+bool WriteValues(FILE *file, const T *values, size_t count) {
+    return fwrite(values, sizeof(T), count, file) == count;
+}
+
+}  // unnamed namespace
+
+namespace io {
+
+bool ReadLinearOctreeFromO3DOCT(const std::string &filename,
+                                geometry::LinearOctree &octree) {
+    FILE *file = utility::filesystem::FOpen(filename, "rb");
+    if (file == NULL) {
+        utility::LogWarning("Read O3DOCT failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+
+    char magic[4];
+    uint32_t version, max_depth;
+    double origin[3], size;
+    uint64_t num_nodes;
+    bool success = ReadValues(file, magic, 4) &&
+                   std::memcmp(magic, kO3DOCTMagic, 4) == 0 &&
+                   ReadValues(file, &version, 1) &&
+                   version == kO3DOCTVersion &&
+                   ReadValues(file, &max_depth, 1) &&
+                   max_depth <= geometry::LinearOctree::kMaxDepth &&
+                   ReadValues(file, origin, 3) && ReadValues(file, &size, 1) &&
+                   ReadValues(file, &num_nodes, 1);
+    if (!success) {
+        utility::LogWarning("Read O3DOCT failed: invalid header in {}",
+                            filename);
+        fclose(file);
+        return false;
+    }
+
+    octree.Clear();
+    octree.max_depth_ = max_depth;
+    octree.origin_ = Eigen::Vector3d(origin[0], origin[1], origin[2]);
+    octree.size_ = size;
+    octree.child_masks_.resize(num_nodes);
+    success = ReadValues(file, octree.child_masks_.data(), num_nodes);
+    size_t num_leaves = 0;
+    for (uint8_t mask : octree.child_masks_) {
+        num_leaves += mask == 0 ? 1 : 0;
+    }
+    std::vector<double> leaf_colors(3 * num_leaves);
+    success = success && ReadValues(file, leaf_colors.data(), 3 * num_leaves);
+    fclose(file);
+    if (!success) {
+        utility::LogWarning("Read O3DOCT failed: unexpected EOF in {}",
+                            filename);
+        octree.Clear();
+        return false;
+    }
+
+    octree.colors_.assign(num_nodes, Eigen::Vector3d::Zero());
+    size_t leaf = 0;
+    for (size_t node = 0; node < num_nodes; ++node) {
+        if (octree.IsLeaf(node)) {
+            octree.colors_[node] = Eigen::Vector3d(leaf_colors[3 * leaf],
+                                                   leaf_colors[3 * leaf + 1],
+                                                   leaf_colors[3 * leaf + 2]);
+            ++leaf;
+        }
+    }
+    if (!octree.UpdateLayout()) {
+        utility::LogWarning("Read O3DOCT failed: invalid tree in {}",
+                            filename);
+        return false;
+    }
+    return true;
+}
+
+bool WriteLinearOctreeToO3DOCT(const std::string &filename,
+                               const geometry::LinearOctree &octree) {
+    FILE *file = utility::filesystem::FOpen(filename, "wb");
+    if (file == NULL) {
+        utility::LogWarning("Write O3DOCT failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+
+    const uint32_t max_depth = static_cast<uint32_t>(octree.max_depth_);
+    const uint64_t num_nodes = octree.NumNodes();
+    std::vector<double> leaf_colors;
+    for (size_t node = 0; node < num_nodes; ++node) {
+        if (octree.IsLeaf(node)) {
+            const Eigen::Vector3d &color = octree.colors_[node];
+            leaf_colors.insert(leaf_colors.end(),
+                               {color(0), color(1), color(2)});
+        }
+    }
+    bool success = WriteValues(file, kO3DOCTMagic, 4) &&
+                   WriteValues(file, &kO3DOCTVersion, 1) &&
+                   WriteValues(file, &max_depth, 1) &&
+                   WriteValues(file, octree.origin_.data(), 3) &&
+                   WriteValues(file, &octree.size_, 1) &&
+                   WriteValues(file, &num_nodes, 1) &&
+                   WriteValues(file, octree.child_masks_.data(), num_nodes) &&
+                   WriteValues(file, leaf_colors.data(), leaf_colors.size());
+    fclose(file);
+    if (!success) {
+        utility::LogWarning("Write O3DOCT failed: unexpected error.");
+    }
+    return success;
+}
+
+bool ReadOctreeFromO3DOCT(const std::string &filename,
+                          geometry::Octree &octree) {
+    geometry::LinearOctree linear_octree;
+    if (!ReadLinearOctreeFromO3DOCT(filename, linear_octree)) {
+        return false;
+    }
+    std::shared_ptr<geometry::Octree> result = linear_octree.ToOctree();
+    octree.origin_ = result->origin_;
+    octree.size_ = result->size_;
+    octree.max_depth_ = result->max_depth_;
+    octree.root_node_ = result->root_node_;
+    return true;
+}
+
+bool WriteOctreeToO3DOCT(const std::string &filename,
+                         const geometry::Octree &octree) {
+    geometry::LinearOctree linear_octree;
+    linear_octree.CreateFromOctree(octree);
+    return WriteLinearOctreeToO3DOCT(filename, linear_octree);
+}
+
+}  // namespace io
+}  // namespace open3d
@@ -0,0 +1,205 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "open3d/io/PoseGraphIO.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/FileSystem.h"
+
+// The .o3dpg format stores a PoseGraph as fixed-size records, so that the
+// nodes and edges can be read in bulk or from a memory mapping. All values are
+// little-endian, matrices are column-major, and every record starts at a
+// multiple of 8 bytes.
+//
+//     char[4]        magic "O3PG"
+//     uint32         version
+//     uint64         number of nodes n
+//     uint64         number of edges m
+//     float64[16 n]  poses of the nodes
+//     edges, 448 bytes each:
+//         int64        source node id
+//         int64        target node id
+//         float64[16]  transformation
+//         float64[36]  information
+//         float64      confidence
+//         uint64       flags, bit 0 is set for uncertain edges
+
+namespace open3d {
+
+namespace {
+
+const char kO3DPGMagic[4] = {'O', '3', 'P', 'G'};
+const uint32_t kO3DPGVersion = 1;
+
+struct O3DPGEdge {
+    int64_t source_node_id;
+    int64_t target_node_id;
+    double transformation[16];
+    double information[36];
+    double confidence;
+    uint64_t flags;
+};
+static_assert(sizeof(O3DPGEdge) == 448, "Unexpected O3DPG edge layout.");
+
+const uint64_t kO3DPGUncertain = 1;
+
+bool IsLittleEndianHost() {
+    const uint16_t value = 1;
+    uint8_t first_byte;
+    std::memcpy(&first_byte, &value, 1);
+    return first_byte == 1;
+}
+
+template <typename T>
+bool ReadValues(FILE *file, T *values, size_t count) {
+    return fread(values, sizeof(T), count, file) == count;
+}
+
+template <typename T>
+bool WriteValues(FILE *file, const T *values, size_t count) {
+    return fwrite(values, sizeof(T), count, file) == count;
+}
+
+}  // unnamed namespace
+
+namespace io {
+
+bool ReadPoseGraphFromO3DPG(const std::string &filename,
+                            pipelines::registration::PoseGraph &pose_graph) {
+    if (!IsLittleEndianHost()) {
+        utility::LogWarning(
+                "Read O3DPG failed: only little-endian hosts are supported.");
+        return false;
+    }
+    FILE *file = utility::filesystem::FOpen(filename, "rb");
+    if (file == NULL) {
+        utility::LogWarning("Read O3DPG failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+
+    char magic[4];
+    uint32_t version;
+    uint64_t num_nodes, num_edges;
+    bool success = ReadValues(file, magic, 4) &&
+                   std::memcmp(magic, kO3DPGMagic, 4) == 0 &&
+                   ReadValues(file, &version, 1) && version == kO3DPGVersion &&
+                   ReadValues(file, &num_nodes, 1) &&
+                   ReadValues(file, &num_edges, 1);
+    if (!success) {
+        utility::LogWarning("Read O3DPG failed: invalid header in {}",
+                            filename);
+        fclose(file);
+        return false;
+    }
+
+    std::vector<double> poses(16 * num_nodes);
+    std::vector<O3DPGEdge> edges(num_edges);
+    success = ReadValues(file, poses.data(), poses.size()) &&
+              ReadValues(file, edges.data(), edges.size());
+    fclose(file);
+    if (!success) {
+        utility::LogWarning("Read O3DPG failed: unexpected EOF in {}",
+                            filename);
+        return false;
+    }
+
+    pose_graph.nodes_.resize(num_nodes);
+    for (size_t i = 0; i < num_nodes; i++) {
+        pose_graph.nodes_[i].pose_ =
+                Eigen::Map<const Eigen::Matrix4d>(&poses[16 * i]);
+    }
+    pose_graph.edges_.resize(num_edges);
+    for (size_t i = 0; i < num_edges; i++) {
+        const O3DPGEdge &record = edges[i];
+        auto &edge = pose_graph.edges_[i];
+        edge.source_node_id_ = static_cast<int>(record.source_node_id);
+        edge.target_node_id_ = static_cast<int>(record.target_node_id);
+        edge.transformation_ =
+                Eigen::Map<const Eigen::Matrix4d>(record.transformation);
+        edge.information_ =
+                Eigen::Map<const Eigen::Matrix6d>(record.information);
+        edge.confidence_ = record.confidence;
+        edge.uncertain_ = (record.flags & kO3DPGUncertain) != 0;
+    }
+    return true;
+}
+
+bool WritePoseGraphToO3DPG(
+        const std::string &filename,
+        const pipelines::registration::PoseGraph &pose_graph) {
+    if (!IsLittleEndianHost()) {
+        utility::LogWarning(
+                "Write O3DPG failed: only little-endian hosts are supported.");
+        return false;
+    }
+    FILE *file = utility::filesystem::FOpen(filename, "wb");
+    if (file == NULL) {
+        utility::LogWarning("Write O3DPG failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+
+    const uint64_t num_nodes = pose_graph.nodes_.size();
+    const uint64_t num_edges = pose_graph.edges_.size();
+    std::vector<double> poses(16 * num_nodes);
+    for (size_t i = 0; i < num_nodes; i++) {
+        Eigen::Map<Eigen::Matrix4d> pose(&poses[16 * i]);
+        pose = pose_graph.nodes_[i].pose_;
+    }
+    std::vector<O3DPGEdge> edges(num_edges);
+    for (size_t i = 0; i < num_edges; i++) {
+        const auto &edge = pose_graph.edges_[i];
+        O3DPGEdge &record = edges[i];
+        record.source_node_id = edge.source_node_id_;
+        record.target_node_id = edge.target_node_id_;
+        Eigen::Map<Eigen::Matrix4d> transformation(record.transformation);
+        transformation = edge.transformation_;
+        Eigen::Map<Eigen::Matrix6d> information(record.information);
+        information = edge.information_;
+        record.confidence = edge.confidence_;
+        record.flags = edge.uncertain_ ? kO3DPGUncertain : 0;
+    }
+    bool success = WriteValues(file, kO3DPGMagic, 4) &&
+                   WriteValues(file, &kO3DPGVersion, 1) &&
+                   WriteValues(file, &num_nodes, 1) &&
+                   WriteValues(file, &num_edges, 1) &&
+                   WriteValues(file, poses.data(), poses.size()) &&
+                   WriteValues(file, edges.data(), edges.size());
+    fclose(file);
+    if (!success) {
+        utility::LogWarning("Write O3DPG failed: unexpected error.");
+    }
+    return success;
+}
+
+}  // namespace io
+}  // namespace open3d
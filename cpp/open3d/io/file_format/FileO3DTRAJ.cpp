@@ -0,0 +1,182 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "open3d/io/PinholeCameraTrajectoryIO.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/FileSystem.h"
+
+// The .o3dtraj format stores a PinholeCameraTrajectory as fixed-size records,
+// so that the parameters can be read in bulk or from a memory mapping. All
+// values are little-endian, matrices are column-major, and every record
+// starts at a multiple of 8 bytes.
+//
+//     char[4]  magic "O3TJ"
+//     uint32   version
+//     uint64   number of camera parameters n
+//     camera parameters, 208 bytes each:
+//         int32        width
+//         int32        height
+//         float64[9]   intrinsic matrix
+//         float64[16]  extrinsic matrix
+
+namespace open3d {
+
+namespace {
+
+const char kO3DTRAJMagic[4] = {'O', '3', 'T', 'J'};
+const uint32_t kO3DTRAJVersion = 1;
+
+struct O3DTRAJParameters {
+    int32_t width;
+    int32_t height;
+    double intrinsic_matrix[9];
+    double extrinsic[16];
+};
+static_assert(sizeof(O3DTRAJParameters) == 208,
+              "Unexpected O3DTRAJ parameters layout.");
+
+bool IsLittleEndianHost() {
+    const uint16_t value = 1;
+    uint8_t first_byte;
+    std::memcpy(&first_byte, &value, 1);
+    return first_byte == 1;
+}
+
+template <typename T>
+bool ReadValues(FILE *file, T *values, size_t count) {
+    return fread(values, sizeof(T), count, file) == count;
+}
+
+template <typename T>
+bool WriteValues(FILE *file, const T *values, size_t count) {
+    return fwrite(values, sizeof(T), count, file) == count;
+}
+
+}  // unnamed namespace
+
+namespace io {
+
+bool ReadPinholeCameraTrajectoryFromO3DTRAJ(
+        const std::string &filename,
+        camera::PinholeCameraTrajectory &trajectory) {
+    if (!IsLittleEndianHost()) {
+        utility::LogWarning(
+                "Read O3DTRAJ failed: only little-endian hosts are "
+                "supported.");
+        return false;
+    }
+    FILE *file = utility::filesystem::FOpen(filename, "rb");
+    if (file == NULL) {
+        utility::LogWarning("Read O3DTRAJ failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+
+    char magic[4];
+    uint32_t version;
+    uint64_t num_parameters;
+    bool success = ReadValues(file, magic, 4) &&
+                   std::memcmp(magic, kO3DTRAJMagic, 4) == 0 &&
+                   ReadValues(file, &version, 1) &&
+                   version == kO3DTRAJVersion &&
+                   ReadValues(file, &num_parameters, 1);
+    if (!success) {
+        utility::LogWarning("Read O3DTRAJ failed: invalid header in {}",
+                            filename);
+        fclose(file);
+        return false;
+    }
+
+    std::vector<O3DTRAJParameters> records(num_parameters);
+    success = ReadValues(file, records.data(), records.size());
+    fclose(file);
+    if (!success) {
+        utility::LogWarning("Read O3DTRAJ failed: unexpected EOF in {}",
+                            filename);
+        return false;
+    }
+
+    trajectory.parameters_.resize(num_parameters);
+    for (size_t i = 0; i < num_parameters; i++) {
+        const O3DTRAJParameters &record = records[i];
+        auto &parameters = trajectory.parameters_[i];
+        parameters.intrinsic_.width_ = record.width;
+        parameters.intrinsic_.height_ = record.height;
+        parameters.intrinsic_.intrinsic_matrix_ =
+                Eigen::Map<const Eigen::Matrix3d>(record.intrinsic_matrix);
+        parameters.extrinsic_ =
+                Eigen::Map<const Eigen::Matrix4d>(record.extrinsic);
+    }
+    return true;
+}
+
+bool WritePinholeCameraTrajectoryToO3DTRAJ(
+        const std::string &filename,
+        const camera::PinholeCameraTrajectory &trajectory) {
+    if (!IsLittleEndianHost()) {
+        utility::LogWarning(
+                "Write O3DTRAJ failed: only little-endian hosts are "
+                "supported.");
+        return false;
+    }
+    FILE *file = utility::filesystem::FOpen(filename, "wb");
+    if (file == NULL) {
+        utility::LogWarning("Write O3DTRAJ failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+
+    const uint64_t num_parameters = trajectory.parameters_.size();
+    std::vector<O3DTRAJParameters> records(num_parameters);
+    for (size_t i = 0; i < num_parameters; i++) {
+        const auto &parameters = trajectory.parameters_[i];
+        O3DTRAJParameters &record = records[i];
+        record.width = parameters.intrinsic_.width_;
+        record.height = parameters.intrinsic_.height_;
+        Eigen::Map<Eigen::Matrix3d> intrinsic_matrix(record.intrinsic_matrix);
+        intrinsic_matrix = parameters.intrinsic_.intrinsic_matrix_;
+        Eigen::Map<Eigen::Matrix4d> extrinsic(record.extrinsic);
+        extrinsic = parameters.extrinsic_;
+    }
+    bool success = WriteValues(file, kO3DTRAJMagic, 4) &&
+                   WriteValues(file, &kO3DTRAJVersion, 1) &&
+                   WriteValues(file, &num_parameters, 1) &&
+                   WriteValues(file, records.data(), records.size());
+    fclose(file);
+    if (!success) {
+        utility::LogWarning("Write O3DTRAJ failed: unexpected error.");
+    }
+    return success;
+}
+
+}  // namespace io
+}  // namespace open3d
@@ -68,7 +68,11 @@ int ReadVertexCallback(p_ply_argument argument) {
     if (index == 2) {  // reading 'z'
         state_ptr->vertex_index++;
         if (state_ptr->vertex_index % 1000 == 0) {
-            state_ptr->progress_bar->Update(state_ptr->vertex_index);
+            // Returning 0 aborts ply_read(), which lets the caller cancel
+            // the loading from the update_progress callback.
+            if (!state_ptr->progress_bar->Update(state_ptr->vertex_index)) {
+                return 0;
+            }
         }
     }
     return 1;
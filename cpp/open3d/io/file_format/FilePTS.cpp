@@ -25,12 +25,15 @@
 // ----------------------------------------------------------------------------
 
 #include <cstdio>
+#include <vector>
 
 #include "open3d/io/FileFormatIO.h"
 #include "open3d/io/PointCloudIO.h"
+#include "open3d/utility/ASCIIParser.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Helper.h"
+#include "open3d/utility/Parallel.h"
 #include "open3d/utility/ProgressReporters.h"
 
 namespace open3d {
@@ -60,43 +63,42 @@ bool ReadPointCloudFromPTS(const std::string &filename,
             utility::LogWarning("Read PTS failed: unable to read header.");
             return false;
         }
+        // The first data line gives the fields: X Y Z, or X Y Z I R G B.
+        if ((line_buffer = file.ReadLine())) {
+            std::vector<std::string> st;
+            utility::SplitString(st, line_buffer, " ");
+            num_of_fields = (int)st.size();
+        }
+        file.Close();
+        if (num_of_fields < 3) {
+            utility::LogWarning("Read PTS failed: insufficient data fields.");
+            return false;
+        }
         utility::CountingProgressReporter reporter(params.update_progress);
-        reporter.SetTotal(num_of_pts);
+        int num_of_columns = num_of_fields >= 7 ? 7 : 3;
+        std::vector<double> rows;
+        if (!utility::ReadASCIIRows(filename, num_of_columns, rows, 1,
+                                    static_cast<int64_t>(num_of_pts))) {
+            utility::LogWarning("Read PTS failed: unable to read file: {}",
+                                filename);
+            return false;
+        }
 
         pointcloud.Clear();
-        size_t idx = 0;
-        while (idx < num_of_pts && (line_buffer = file.ReadLine())) {
-            if (num_of_fields == 0) {
-                std::vector<std::string> st;
-                utility::SplitString(st, line_buffer, " ");
-                num_of_fields = (int)st.size();
-                if (num_of_fields < 3) {
-                    utility::LogWarning(
-                            "Read PTS failed: insufficient data fields.");
-                    return false;
-                }
-                pointcloud.points_.resize(num_of_pts);
-                if (num_of_fields >= 7) {
-                    // X Y Z I R G B
-                    pointcloud.colors_.resize(num_of_pts);
-                }
-            }
-            double x, y, z;
-            int i, r, g, b;
-            if (num_of_fields < 7) {
-                if (sscanf(line_buffer, "%lf %lf %lf", &x, &y, &z) == 3) {
-                    pointcloud.points_[idx] = Eigen::Vector3d(x, y, z);
-                }
-            } else {
-                if (sscanf(line_buffer, "%lf %lf %lf %d %d %d %d", &x, &y, &z,
-                           &i, &r, &g, &b) == 7) {
-                    pointcloud.points_[idx] = Eigen::Vector3d(x, y, z);
-                    pointcloud.colors_[idx] = utility::ColorToDouble(r, g, b);
-                }
-            }
-            idx++;
-            if (idx % 1000 == 0) {
-                reporter.Update(idx);
+        int64_t num_points = static_cast<int64_t>(rows.size()) / num_of_columns;
+        pointcloud.points_.resize(num_points);
+        if (num_of_columns == 7) {
+            pointcloud.colors_.resize(num_points);
+        }
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+        for (int64_t i = 0; i < num_points; i++) {
+            const double *row = rows.data() + i * num_of_columns;
+            pointcloud.points_[i] = Eigen::Vector3d(row[0], row[1], row[2]);
+            if (num_of_columns == 7) {
+                pointcloud.colors_[i] = utility::ColorToDouble(
+                        static_cast<uint8_t>(row[4]),
+                        static_cast<uint8_t>(row[5]),
+                        static_cast<uint8_t>(row[6]));
             }
         }
         reporter.Finish();
@@ -25,11 +25,14 @@
 // ----------------------------------------------------------------------------
 
 #include <cstdio>
+#include <vector>
 
+#include "open3d/io/CompressedFileIO.h"
 #include "open3d/io/FileFormatIO.h"
 #include "open3d/io/PointCloudIO.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Parallel.h"
 #include "open3d/utility/ProgressReporters.h"
 
 namespace open3d {
@@ -43,26 +46,21 @@ bool ReadPointCloudFromXYZ(const std::string &filename,
                            geometry::PointCloud &pointcloud,
                            const ReadPointCloudOption &params) {
     try {
-        utility::filesystem::CFile file;
-        if (!file.Open(filename, "r")) {
+        utility::CountingProgressReporter reporter(params.update_progress);
+        std::vector<double> rows;
+        if (!ReadASCIIRowsFromFile(filename, 3, rows)) {
             utility::LogWarning("Read XYZ failed: unable to open file: {}",
                                 filename);
             return false;
         }
-        utility::CountingProgressReporter reporter(params.update_progress);
-        reporter.SetTotal(file.GetFileSize());
 
         pointcloud.Clear();
-        int i = 0;
-        double x, y, z;
-        const char *line_buffer;
-        while ((line_buffer = file.ReadLine())) {
-            if (sscanf(line_buffer, "%lf %lf %lf", &x, &y, &z) == 3) {
-                pointcloud.points_.push_back(Eigen::Vector3d(x, y, z));
-            }
-            if (++i % 1000 == 0) {
-                reporter.Update(file.CurPos());
-            }
+        int64_t num_points = static_cast<int64_t>(rows.size()) / 3;
+        pointcloud.points_.resize(num_points);
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+        for (int64_t i = 0; i < num_points; i++) {
+            const double *row = rows.data() + i * 3;
+            pointcloud.points_[i] = Eigen::Vector3d(row[0], row[1], row[2]);
         }
         reporter.Finish();
 
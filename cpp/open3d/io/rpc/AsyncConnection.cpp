@@ -0,0 +1,242 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/io/rpc/AsyncConnection.h"
+
+#include <algorithm>
+#include <chrono>
+#include <zmq.hpp>
+
+#include "open3d/io/rpc/MessageUtils.h"
+#include "open3d/io/rpc/ZMQContext.h"
+#include "open3d/utility/Console.h"
+
+using namespace open3d::utility;
+
+namespace open3d {
+namespace io {
+namespace rpc {
+
+struct AsyncConnection::PendingMessage {
+    std::vector<zmq::message_t> frames;
+    std::promise<std::shared_ptr<zmq::message_t>> reply;
+    /// True for messages sent without a future, whose errors are logged.
+    bool log_errors;
+    std::chrono::steady_clock::time_point send_time;
+};
+
+AsyncConnection::AsyncConnection(const std::string& address,
+                                 int connect_timeout,
+                                 int timeout,
+                                 int max_in_flight,
+                                 bool drop_oldest)
+    : context_(GetZMQContext()),
+      address_(address),
+      connect_timeout_(connect_timeout),
+      timeout_(timeout),
+      max_in_flight_(std::max(max_in_flight, 1)),
+      drop_oldest_(drop_oldest),
+      keep_running_(true) {
+    thread_ = std::thread(&AsyncConnection::Mainloop, this);
+}
+
+AsyncConnection::~AsyncConnection() {
+    {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        keep_running_ = false;
+    }
+    cv_.notify_all();
+    thread_.join();
+}
+
+std::future<std::shared_ptr<zmq::message_t>> AsyncConnection::SendAsync(
+        std::vector<zmq::message_t>& send_msgs) {
+    return Enqueue(send_msgs, false);
+}
+
+std::shared_ptr<zmq::message_t> AsyncConnection::Send(
+        zmq::message_t& send_msg) {
+    std::vector<zmq::message_t> send_msgs;
+    send_msgs.push_back(std::move(send_msg));
+    return Send(send_msgs);
+}
+
+std::shared_ptr<zmq::message_t> AsyncConnection::Send(const void* data,
+                                                      size_t size) {
+    zmq::message_t send_msg(data, size);
+    return Send(send_msg);
+}
+
+std::shared_ptr<zmq::message_t> AsyncConnection::Send(
+        std::vector<zmq::message_t>& send_msgs) {
+    Enqueue(send_msgs, true);
+    return CreateStatusOKMsg();
+}
+
+void AsyncConnection::Flush() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this]() { return queue_.empty() && in_flight_.empty(); });
+}
+
+std::future<std::shared_ptr<zmq::message_t>> AsyncConnection::Enqueue(
+        std::vector<zmq::message_t>& send_msgs, bool log_errors) {
+    auto message = std::make_shared<PendingMessage>();
+    for (zmq::message_t& send_msg : send_msgs) {
+        message->frames.push_back(std::move(send_msg));
+    }
+    message->log_errors = log_errors;
+    std::future<std::shared_ptr<zmq::message_t>> reply =
+            message->reply.get_future();
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (queue_.size() >= max_in_flight_) {
+        if (drop_oldest_) {
+            LogDebug("AsyncConnection: dropping the oldest queued message");
+            queue_.front()->reply.set_value(nullptr);
+            queue_.pop_front();
+        } else {
+            cv_.wait(lock);
+        }
+    }
+    queue_.push_back(message);
+    lock.unlock();
+    cv_.notify_all();
+    return reply;
+}
+
+void AsyncConnection::Mainloop() {
+    ResetSocket();
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (keep_running_ || !queue_.empty() || !in_flight_.empty()) {
+        while (!queue_.empty() && in_flight_.size() < max_in_flight_) {
+            std::shared_ptr<PendingMessage> message = queue_.front();
+            queue_.pop_front();
+            if (SendFrames(*message)) {
+                message->send_time = std::chrono::steady_clock::now();
+                in_flight_.push_back(message);
+            } else {
+                message->reply.set_value(nullptr);
+            }
+            cv_.notify_all();
+        }
+        if (in_flight_.empty()) {
+            cv_.wait(lock,
+                     [this]() { return !keep_running_ || !queue_.empty(); });
+            continue;
+        }
+
+        lock.unlock();
+        zmq::pollitem_t items[] = {{socket_->handle(), 0, ZMQ_POLLIN, 0}};
+        zmq::poll(items, 1, std::chrono::milliseconds(1));
+        std::vector<std::shared_ptr<zmq::message_t>> replies;
+        if (items[0].revents & ZMQ_POLLIN) {
+            replies = ReceiveReplies();
+        }
+        lock.lock();
+
+        for (const auto& reply : replies) {
+            if (in_flight_.empty()) {
+                break;
+            }
+            std::shared_ptr<PendingMessage> message = in_flight_.front();
+            in_flight_.pop_front();
+            if (message->log_errors && !ReplyIsOKStatus(*reply)) {
+                LogWarning("AsyncConnection: received an error reply");
+            }
+            message->reply.set_value(reply);
+        }
+        if (!in_flight_.empty() &&
+            std::chrono::steady_clock::now() - in_flight_.front()->send_time >
+                    std::chrono::milliseconds(timeout_)) {
+            LogWarning("AsyncConnection: no reply within {} ms, {} messages "
+                       "failed",
+                       timeout_, in_flight_.size());
+            for (const auto& message : in_flight_) {
+                message->reply.set_value(nullptr);
+            }
+            in_flight_.clear();
+            ResetSocket();
+        }
+        cv_.notify_all();
+    }
+    socket_->close();
+}
+
+bool AsyncConnection::SendFrames(PendingMessage& message) {
+    zmq::message_t delimiter;
+    if (!socket_->send(delimiter, zmq::send_flags::sndmore)) {
+        return false;
+    }
+    for (size_t i = 0; i < message.frames.size(); ++i) {
+        zmq::send_flags flags = i + 1 < message.frames.size()
+                                        ? zmq::send_flags::sndmore
+                                        : zmq::send_flags::none;
+        if (!socket_->send(message.frames[i], flags)) {
+            LogInfo("AsyncConnection: send failed");
+            return false;
+        }
+    }
+    return true;
+}
+
+std::vector<std::shared_ptr<zmq::message_t>>
+AsyncConnection::ReceiveReplies() {
+    std::vector<std::shared_ptr<zmq::message_t>> replies;
+    while (true) {
+        zmq::message_t delimiter;
+        if (!socket_->recv(delimiter, zmq::recv_flags::dontwait)) {
+            break;
+        }
+        auto reply = std::make_shared<zmq::message_t>();
+        if (!socket_->recv(*reply)) {
+            break;
+        }
+        // Skip unexpected frames of the reply.
+        bool more = reply->more();
+        while (more) {
+            zmq::message_t frame;
+            socket_->recv(frame);
+            more = frame.more();
+        }
+        replies.push_back(reply);
+    }
+    return replies;
+}
+
+void AsyncConnection::ResetSocket() {
+    if (socket_) {
+        socket_->close();
+    }
+    socket_.reset(new zmq::socket_t(*context_, ZMQ_DEALER));
+    socket_->set(zmq::sockopt::linger, timeout_);
+    socket_->set(zmq::sockopt::connect_timeout, connect_timeout_);
+    socket_->set(zmq::sockopt::sndtimeo, timeout_);
+    socket_->connect(address_.c_str());
+}
+
+}  // namespace rpc
+}  // namespace io
+}  // namespace open3d
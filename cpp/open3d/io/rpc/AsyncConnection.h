@@ -0,0 +1,142 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "open3d/io/rpc/ConnectionBase.h"
+
+namespace zmq {
+class context_t;
+}  // namespace zmq
+
+namespace open3d {
+namespace io {
+namespace rpc {
+
+/// Connection which sends messages without waiting for the replies, e.g. for
+/// streaming the frames of a live sensor to a viewer.
+///
+/// A background thread sends the messages over a DEALER socket and matches
+/// the replies to the messages in order, which works with the REP socket of
+/// ReceiverBase. At most max_in_flight messages await a reply, and at most
+/// max_in_flight more wait in a queue. When the queue is full, sending blocks
+/// until a reply arrives, or, with drop_oldest, the oldest queued message is
+/// dropped. Dropping suits time series, e.g. SetMeshData and SetTime per
+/// frame, where only the latest data matters.
+class AsyncConnection : public ConnectionBase {
+public:
+    /// Creates an AsyncConnection object used for sending data.
+    /// \param address          The address of the receiving end.
+    ///
+    /// \param connect_timeout  The timeout for the connect operation of the
+    /// socket.
+    ///
+    /// \param timeout          The timeout for the reply to a message, after
+    /// which all messages awaiting a reply fail.
+    ///
+    /// \param max_in_flight    The maximum number of messages awaiting a
+    /// reply, and of queued messages.
+    ///
+    /// \param drop_oldest      If true, sending to a full queue drops the
+    /// oldest queued message instead of blocking.
+    AsyncConnection(const std::string& address,
+                    int connect_timeout,
+                    int timeout,
+                    int max_in_flight = 4,
+                    bool drop_oldest = false);
+
+    /// Waits for the replies to the queued messages, up to the timeout.
+    ~AsyncConnection();
+
+    /// Queues the frames of a message, taking their content, and returns the
+    /// future reply. The reply is empty if the message is dropped or fails.
+    std::future<std::shared_ptr<zmq::message_t>> SendAsync(
+            std::vector<zmq::message_t>& send_msgs);
+
+    /// Queues a message and returns an OK status without waiting for the
+    /// reply. Replies which are not OK are logged.
+    std::shared_ptr<zmq::message_t> Send(zmq::message_t& send_msg);
+
+    /// Function for sending raw data. Meant for testing purposes
+    std::shared_ptr<zmq::message_t> Send(const void* data, size_t size);
+
+    /// Queues the frames of a multipart message, see Send(zmq::message_t&).
+    std::shared_ptr<zmq::message_t> Send(
+            std::vector<zmq::message_t>& send_msgs);
+
+    bool SupportsMultipart() const { return true; }
+
+    /// Blocks until all messages are replied to, dropped or failed.
+    void Flush();
+
+private:
+    struct PendingMessage;
+
+    std::future<std::shared_ptr<zmq::message_t>> Enqueue(
+            std::vector<zmq::message_t>& send_msgs, bool log_errors);
+
+    void Mainloop();
+
+    /// Sends the frames of a message after the empty delimiter frame of the
+    /// REP socket.
+    bool SendFrames(PendingMessage& message);
+
+    /// Receives all available replies without blocking.
+    std::vector<std::shared_ptr<zmq::message_t>> ReceiveReplies();
+
+    /// Creates the socket, also to drop the replies of failed messages.
+    void ResetSocket();
+
+    std::shared_ptr<zmq::context_t> context_;
+    std::unique_ptr<zmq::socket_t> socket_;
+    const std::string address_;
+    const int connect_timeout_;
+    const int timeout_;
+    const size_t max_in_flight_;
+    const bool drop_oldest_;
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    /// Messages waiting to be sent.
+    std::deque<std::shared_ptr<PendingMessage>> queue_;
+    /// Messages awaiting their reply, in the order of sending.
+    std::deque<std::shared_ptr<PendingMessage>> in_flight_;
+    bool keep_running_;
+    std::thread thread_;
+};
+
+}  // namespace rpc
+}  // namespace io
+}  // namespace open3d
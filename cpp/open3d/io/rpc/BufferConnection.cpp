@@ -56,6 +56,12 @@ std::shared_ptr<zmq::message_t> BufferConnection::Send(const void* data,
     return Send(send_msg);
 }
 
+std::shared_ptr<zmq::message_t> BufferConnection::Send(
+        std::vector<zmq::message_t>& send_msgs) {
+    LogError("BufferConnection does not support multipart messages.");
+    return std::shared_ptr<zmq::message_t>();
+}
+
 }  // namespace rpc
 }  // namespace io
 }  // namespace open3d
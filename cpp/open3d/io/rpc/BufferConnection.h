@@ -46,6 +46,11 @@ public:
     /// Function for sending raw data. Meant for testing purposes
     std::shared_ptr<zmq::message_t> Send(const void* data, size_t size);
 
+    /// Multipart messages are not supported, since the frames can not be
+    /// chained in the buffer.
+    std::shared_ptr<zmq::message_t> Send(
+            std::vector<zmq::message_t>& send_msgs);
+
     std::stringstream& buffer() { return buffer_; }
     const std::stringstream& buffer() const { return buffer_; }
 
@@ -75,7 +75,33 @@ std::shared_ptr<zmq::message_t> Connection::Send(zmq::message_t& send_msg) {
             LogInfo("Connection::send() send failed with: {}", err.what());
         }
     }
+    return ReceiveReply();
+}
 
+std::shared_ptr<zmq::message_t> Connection::Send(const void* data,
+                                                 size_t size) {
+    zmq::message_t send_msg(data, size);
+    return Send(send_msg);
+}
+
+std::shared_ptr<zmq::message_t> Connection::Send(
+        std::vector<zmq::message_t>& send_msgs) {
+    for (size_t i = 0; i < send_msgs.size(); ++i) {
+        zmq::send_flags flags = i + 1 < send_msgs.size()
+                                        ? zmq::send_flags::sndmore
+                                        : zmq::send_flags::none;
+        if (!socket_->send(send_msgs[i], flags)) {
+            zmq::error_t err;
+            if (err.num()) {
+                LogInfo("Connection::send() send failed with: {}",
+                        err.what());
+            }
+        }
+    }
+    return ReceiveReply();
+}
+
+std::shared_ptr<zmq::message_t> Connection::ReceiveReply() {
     std::shared_ptr<zmq::message_t> msg(new zmq::message_t());
     if (socket_->recv(*msg)) {
         LogDebug("Connection::send() received answer with {} bytes",
@@ -89,12 +115,6 @@ std::shared_ptr<zmq::message_t> Connection::Send(zmq::message_t& send_msg) {
     return msg;
 }
 
-std::shared_ptr<zmq::message_t> Connection::Send(const void* data,
-                                                 size_t size) {
-    zmq::message_t send_msg(data, size);
-    return Send(send_msg);
-}
-
 std::string Connection::DefaultAddress() { return defaults.address; }
 
 }  // namespace rpc
@@ -60,9 +60,18 @@ public:
     /// Function for sending raw data. Meant for testing purposes
     std::shared_ptr<zmq::message_t> Send(const void* data, size_t size);
 
+    /// Function for sending the frames of a multipart message.
+    std::shared_ptr<zmq::message_t> Send(
+            std::vector<zmq::message_t>& send_msgs);
+
+    bool SupportsMultipart() const { return true; }
+
     static std::string DefaultAddress();
 
 private:
+    /// Receives the reply to the last message.
+    std::shared_ptr<zmq::message_t> ReceiveReply();
+
     std::shared_ptr<zmq::context_t> context_;
     std::unique_ptr<zmq::socket_t> socket_;
     const std::string address_;
@@ -27,6 +27,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 namespace zmq {
 class message_t;
@@ -47,6 +48,16 @@ public:
     virtual std::shared_ptr<zmq::message_t> Send(zmq::message_t& send_msg) = 0;
     virtual std::shared_ptr<zmq::message_t> Send(const void* data,
                                                  size_t size) = 0;
+
+    /// Function for sending the frames of a multipart message, the msgpack
+    /// data followed by the data of messages::Array objects. Only called if
+    /// SupportsMultipart() is true.
+    virtual std::shared_ptr<zmq::message_t> Send(
+            std::vector<zmq::message_t>& send_msgs) = 0;
+
+    /// Returns true if the connection can send multipart messages, so that
+    /// large arrays do not need to be copied into the msgpack data.
+    virtual bool SupportsMultipart() const { return false; }
 };
 }  // namespace rpc
 }  // namespace io
@@ -52,6 +52,24 @@ public:
             const MsgpackObject& obj) override {
         return CreateStatusOKMsg();
     }
+    std::shared_ptr<zmq::message_t> ProcessMessage(
+            const messages::Request& req,
+            const messages::AppendMeshData& msg,
+            const MsgpackObject& obj) override {
+        return CreateStatusOKMsg();
+    }
+    std::shared_ptr<zmq::message_t> ProcessMessage(
+            const messages::Request& req,
+            const messages::SetVertexAttributeRange& msg,
+            const MsgpackObject& obj) override {
+        return CreateStatusOKMsg();
+    }
+    std::shared_ptr<zmq::message_t> ProcessMessage(
+            const messages::Request& req,
+            const messages::RemoveVertices& msg,
+            const MsgpackObject& obj) override {
+        return CreateStatusOKMsg();
+    }
     std::shared_ptr<zmq::message_t> ProcessMessage(
             const messages::Request& req,
             const messages::SetCameraData& msg,
@@ -114,6 +114,9 @@ inline std::string TypeStr<uint64_t>() {
 ///       return np.frombuffer(dic['data'],
 ///       dtype=np.dtype(dic['type'])).reshape(dic['shape'])
 ///
+/// Large arrays can also travel outside of the msgpack data as extra frames of
+/// a multipart ZMQ message. Their 'data' is then empty and 'frame' is the
+/// index of the frame after the first one holding the array.
 struct Array {
     static std::string MsgId() { return "array"; }
 
@@ -132,6 +135,8 @@ struct Array {
     std::string type;
     std::vector<int64_t> shape;
     msgpack::type::raw_ref data;
+    /// Index of the extra frame with the data, or -1 if the data is inline.
+    int64_t frame = -1;
 
     template <class T>
     const T* Ptr() const {
@@ -239,7 +244,7 @@ struct Array {
     }
 
     // macro for creating the serialization/deserialization code
-    MSGPACK_DEFINE_MAP(type, shape, data);
+    MSGPACK_DEFINE_MAP(type, shape, data, frame);
 };
 
 /// struct for storing MeshData, e.g., PointClouds, TriangleMesh, ..
@@ -374,6 +379,74 @@ struct GetMeshData {
     MSGPACK_DEFINE_MAP(path, time, layer);
 };
 
+/// struct for defining an "append_mesh_data" message, which appends vertices
+/// and faces to the mesh data at a path, e.g. the new points of a growing map.
+/// The vertex attributes must match those of the existing data. The faces
+/// index all vertices, including the existing ones.
+struct AppendMeshData {
+    static std::string MsgId() { return "append_mesh_data"; }
+
+    AppendMeshData() : time(0) {}
+
+    /// Path defining the location in the scene tree.
+    std::string path;
+    /// The time associated with this data
+    int32_t time;
+    /// The layer for this data
+    std::string layer;
+
+    /// The data to be appended
+    MeshData data;
+
+    MSGPACK_DEFINE_MAP(path, time, layer, data);
+};
+
+/// struct for defining a "set_vertex_attribute_range" message, which
+/// overwrites a range of vertices of the mesh data at a path, e.g. to update
+/// the colors of some points.
+struct SetVertexAttributeRange {
+    static std::string MsgId() { return "set_vertex_attribute_range"; }
+
+    SetVertexAttributeRange() : time(0), start(0) {}
+
+    /// Path defining the location in the scene tree.
+    std::string path;
+    /// The time associated with this data
+    int32_t time;
+    /// The layer for this data
+    std::string layer;
+
+    /// Name of the vertex attribute, or "vertices" for the positions.
+    std::string attribute;
+    /// Index of the first vertex to overwrite.
+    int64_t start;
+    /// The new values with shape [num_verts, ...], where the remaining dims
+    /// match the attribute.
+    Array values;
+
+    MSGPACK_DEFINE_MAP(path, time, layer, attribute, start, values);
+};
+
+/// struct for defining a "remove_vertices" message, which removes vertices of
+/// the mesh data at a path, together with the faces using them.
+struct RemoveVertices {
+    static std::string MsgId() { return "remove_vertices"; }
+
+    RemoveVertices() : time(0) {}
+
+    /// Path defining the location in the scene tree.
+    std::string path;
+    /// The time associated with this data
+    int32_t time;
+    /// The layer for this data
+    std::string layer;
+
+    /// The indices of the vertices to remove, of type int32_t or int64_t.
+    Array indices;
+
+    MSGPACK_DEFINE_MAP(path, time, layer, indices);
+};
+
 /// struct for storing camera data
 struct CameraData {
     static std::string MsgId() { return "camera_data"; }
@@ -455,6 +528,21 @@ struct SetProperties {
     MSGPACK_DEFINE_MAP(path);
 };
 
+/// struct for defining a "shared_memory_frames" message, which precedes a
+/// message whose frames are regions of a POSIX shared memory segment of the
+/// sender on the same host, instead of extra frames of a multipart message.
+struct SharedMemoryFrames {
+    static std::string MsgId() { return "shared_memory_frames"; }
+    /// Name of the shared memory segment.
+    std::string name;
+    /// Byte offsets of the frames in the segment.
+    std::vector<int64_t> offsets;
+    /// Byte sizes of the frames.
+    std::vector<int64_t> sizes;
+
+    MSGPACK_DEFINE_MAP(name, offsets, sizes);
+};
+
 /// struct for defining a "request" message, which describes the subsequent
 /// message by storing the msg_id.
 struct Request {
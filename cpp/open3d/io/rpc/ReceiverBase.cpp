@@ -26,8 +26,16 @@
 
 #include "open3d/io/rpc/ReceiverBase.h"
 
+#include <cstring>
 #include <zmq.hpp>
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 #include "open3d/io/rpc/Messages.h"
 #include "open3d/io/rpc/ZMQContext.h"
 
@@ -45,6 +53,77 @@ std::shared_ptr<zmq::message_t> CreateStatusMessage(
 
     return msg;
 }
+
+/// Returns the size in bytes of the elements of an array type, e.g. 4 for
+/// "<f4".
+int64_t GetArrayItemSize(const std::string& type) {
+    if (type.size() < 3) {
+        throw std::runtime_error("invalid array type " + type);
+    }
+    return std::stoll(type.substr(2));
+}
+
+/// Points the data of an array sent as an extra frame to the frame.
+void AttachFrame(open3d::io::rpc::messages::Array& array,
+                 const std::vector<open3d::io::rpc::MessageFrame>& frames) {
+    if (array.frame < 0) {
+        return;
+    }
+    if (array.frame >= int64_t(frames.size())) {
+        throw std::runtime_error("missing frame " +
+                                 std::to_string(array.frame));
+    }
+    const open3d::io::rpc::MessageFrame& frame = frames[array.frame];
+    int64_t byte_size = GetArrayItemSize(array.type);
+    for (int64_t d : array.shape) {
+        byte_size *= d;
+    }
+    if (byte_size != int64_t(frame.size)) {
+        throw std::runtime_error("size mismatch of frame " +
+                                 std::to_string(array.frame));
+    }
+    array.data.ptr = static_cast<const char*>(frame.data);
+    array.data.size = uint32_t(frame.size);
+}
+
+template <class T>
+void AttachFrames(T& msg,
+                  const std::vector<open3d::io::rpc::MessageFrame>& frames) {
+}
+
+void AttachFrames(open3d::io::rpc::messages::MeshData& data,
+                  const std::vector<open3d::io::rpc::MessageFrame>& frames) {
+    AttachFrame(data.vertices, frames);
+    AttachFrame(data.faces, frames);
+    AttachFrame(data.lines, frames);
+    for (auto* arrays : {&data.vertex_attributes, &data.face_attributes,
+                         &data.line_attributes, &data.textures}) {
+        for (auto& item : *arrays) {
+            AttachFrame(item.second, frames);
+        }
+    }
+}
+
+void AttachFrames(open3d::io::rpc::messages::SetMeshData& msg,
+                  const std::vector<open3d::io::rpc::MessageFrame>& frames) {
+    AttachFrames(msg.data, frames);
+}
+
+void AttachFrames(open3d::io::rpc::messages::AppendMeshData& msg,
+                  const std::vector<open3d::io::rpc::MessageFrame>& frames) {
+    AttachFrames(msg.data, frames);
+}
+
+void AttachFrames(open3d::io::rpc::messages::SetVertexAttributeRange& msg,
+                  const std::vector<open3d::io::rpc::MessageFrame>& frames) {
+    AttachFrame(msg.values, frames);
+}
+
+void AttachFrames(open3d::io::rpc::messages::RemoveVertices& msg,
+                  const std::vector<open3d::io::rpc::MessageFrame>& frames) {
+    AttachFrame(msg.indices, frames);
+}
+
 }  // namespace
 
 namespace open3d {
@@ -62,7 +141,8 @@ ReceiverBase::ReceiverBase(const std::string& address, int timeout)
       keep_running_(false),
       loop_running_(false),
       mainloop_error_code_(0),
-      mainloop_exception_("") {}
+      mainloop_exception_(""),
+      shared_memory_size_(0) {}
 
 ReceiverBase::~ReceiverBase() { Stop(); }
 
@@ -152,6 +232,17 @@ void ReceiverBase::Mainloop() {
             if (!socket_->recv(message)) {
                 continue;
             }
+            // The data of large arrays follows in extra frames.
+            frames_.clear();
+            bool more = message.more();
+            while (more) {
+                auto frame = std::make_shared<zmq::message_t>();
+                if (!socket_->recv(*frame)) {
+                    break;
+                }
+                more = frame->more();
+                frames_.push_back({frame->data(), frame->size(), frame});
+            }
 
             const char* buffer = (char*)message.data();
             size_t buffer_size = message.size();
@@ -177,6 +268,7 @@ void ReceiverBase::Mainloop() {
         auto obj = oh.get();                                            \
         MSGTYPE msg;                                                    \
         msg = obj.as<MSGTYPE>();                                        \
+        AttachFrames(msg, frames_);                                     \
         auto reply = ProcessMessage(req, msg, MsgpackObject(obj));      \
         if (reply) {                                                    \
             replies.push_back(reply);                                   \
@@ -185,8 +277,20 @@ void ReceiverBase::Mainloop() {
                     messages::Status::ErrorProcessingMessage()));       \
         }                                                               \
     }
+                    else if (messages::SharedMemoryFrames::MsgId() ==
+                             req.msg_id) {
+                        // Describes the frames of the next message and gets
+                        // no reply of its own.
+                        auto oh = msgpack::unpack(buffer, buffer_size, offset,
+                                                  nullptr, nullptr, limits);
+                        MapSharedMemoryFrames(
+                                oh.get().as<messages::SharedMemoryFrames>());
+                    }
                     PROCESS_MESSAGE(messages::SetMeshData)
                     PROCESS_MESSAGE(messages::GetMeshData)
+                    PROCESS_MESSAGE(messages::AppendMeshData)
+                    PROCESS_MESSAGE(messages::SetVertexAttributeRange)
+                    PROCESS_MESSAGE(messages::RemoveVertices)
                     PROCESS_MESSAGE(messages::SetCameraData)
                     PROCESS_MESSAGE(messages::SetProperties)
                     PROCESS_MESSAGE(messages::SetActiveCamera)
@@ -226,10 +330,100 @@ void ReceiverBase::Mainloop() {
             LogInfo("ReceiverBase::Mainloop: {}", err.what());
         }
     }
+    frames_.clear();
+    shared_memory_.reset();
     socket_->close();
     loop_running_.store(false);
 }
 
+void ReceiverBase::MapSharedMemoryFrames(
+        const messages::SharedMemoryFrames& msg) {
+#ifdef _WIN32
+    throw std::runtime_error("shared memory frames are not supported");
+#else
+    if (msg.name != shared_memory_name_) {
+        shared_memory_.reset();
+        shared_memory_name_ = "";
+        int fd = shm_open(msg.name.c_str(), O_RDONLY, 0);
+        if (fd < 0) {
+            throw std::runtime_error("unable to open shared memory " +
+                                     msg.name);
+        }
+        struct stat st;
+        void* data = MAP_FAILED;
+        if (fstat(fd, &st) == 0 && st.st_size > 0) {
+            data = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+        }
+        close(fd);
+        if (data == MAP_FAILED) {
+            throw std::runtime_error("unable to map shared memory " +
+                                     msg.name);
+        }
+        size_t size = st.st_size;
+        shared_memory_ = std::shared_ptr<void>(
+                data, [size](void* data) { munmap(data, size); });
+        shared_memory_name_ = msg.name;
+        shared_memory_size_ = size;
+    }
+    if (msg.offsets.size() != msg.sizes.size()) {
+        throw std::runtime_error("invalid shared memory frames");
+    }
+    frames_.clear();
+    for (size_t i = 0; i < msg.offsets.size(); ++i) {
+        if (msg.offsets[i] < 0 || msg.sizes[i] < 0 ||
+            size_t(msg.offsets[i] + msg.sizes[i]) > shared_memory_size_) {
+            throw std::runtime_error("shared memory frame out of bounds");
+        }
+        frames_.push_back({static_cast<const char*>(shared_memory_.get()) +
+                                   msg.offsets[i],
+                           size_t(msg.sizes[i]), shared_memory_});
+    }
+#endif
+}
+
+core::Tensor ReceiverBase::GetArrayTensor(const messages::Array& array) const {
+    core::Dtype dtype;
+    if (array.type == messages::TypeStr<float>()) {
+        dtype = core::Dtype::Float32;
+    } else if (array.type == messages::TypeStr<double>()) {
+        dtype = core::Dtype::Float64;
+    } else if (array.type == messages::TypeStr<int8_t>()) {
+        dtype = core::Dtype::Int8;
+    } else if (array.type == messages::TypeStr<int16_t>()) {
+        dtype = core::Dtype::Int16;
+    } else if (array.type == messages::TypeStr<int32_t>()) {
+        dtype = core::Dtype::Int32;
+    } else if (array.type == messages::TypeStr<int64_t>()) {
+        dtype = core::Dtype::Int64;
+    } else if (array.type == messages::TypeStr<uint8_t>()) {
+        dtype = core::Dtype::UInt8;
+    } else if (array.type == messages::TypeStr<uint16_t>()) {
+        dtype = core::Dtype::UInt16;
+    } else {
+        LogError("ReceiverBase::GetArrayTensor: unsupported array type {}",
+                 array.type);
+    }
+    core::SizeVector shape(array.shape);
+    core::Device device("CPU:0");
+    if (array.frame >= 0 && array.frame < int64_t(frames_.size())) {
+        const MessageFrame& frame = frames_[array.frame];
+        std::shared_ptr<void> owner = frame.owner;
+        void* data = const_cast<void*>(frame.data);
+        auto blob = std::make_shared<core::Blob>(device, data,
+                                                 [owner](void*) {});
+        return core::Tensor(shape, core::Tensor::DefaultStrides(shape), data,
+                            dtype, blob);
+    }
+    int64_t byte_size = shape.NumElements() * dtype.ByteSize();
+    if (int64_t(array.data.size) != byte_size) {
+        LogError("ReceiverBase::GetArrayTensor: expected {} bytes but got {}",
+                 byte_size, array.data.size);
+    }
+    core::Tensor tensor(shape, dtype, device);
+    std::memcpy(tensor.GetDataPtr(), array.data.ptr, byte_size);
+    return tensor;
+}
+
 std::shared_ptr<zmq::message_t> ReceiverBase::ProcessMessage(
         const messages::Request& req,
         const messages::SetMeshData& msg,
@@ -254,6 +448,42 @@ std::shared_ptr<zmq::message_t> ReceiverBase::ProcessMessage(
     status.str += ": messages with id " + msg.MsgId() + " are not supported";
     return CreateStatusMessage(status);
 }
+std::shared_ptr<zmq::message_t> ReceiverBase::ProcessMessage(
+        const messages::Request& req,
+        const messages::AppendMeshData& msg,
+        const MsgpackObject& obj) {
+    utility::LogInfo(
+            "ReceiverBase::ProcessMessage: messages with id {} will be "
+            "ignored",
+            msg.MsgId());
+    auto status = messages::Status::ErrorProcessingMessage();
+    status.str += ": messages with id " + msg.MsgId() + " are not supported";
+    return CreateStatusMessage(status);
+}
+std::shared_ptr<zmq::message_t> ReceiverBase::ProcessMessage(
+        const messages::Request& req,
+        const messages::SetVertexAttributeRange& msg,
+        const MsgpackObject& obj) {
+    utility::LogInfo(
+            "ReceiverBase::ProcessMessage: messages with id {} will be "
+            "ignored",
+            msg.MsgId());
+    auto status = messages::Status::ErrorProcessingMessage();
+    status.str += ": messages with id " + msg.MsgId() + " are not supported";
+    return CreateStatusMessage(status);
+}
+std::shared_ptr<zmq::message_t> ReceiverBase::ProcessMessage(
+        const messages::Request& req,
+        const messages::RemoveVertices& msg,
+        const MsgpackObject& obj) {
+    utility::LogInfo(
+            "ReceiverBase::ProcessMessage: messages with id {} will be "
+            "ignored",
+            msg.MsgId());
+    auto status = messages::Status::ErrorProcessingMessage();
+    status.str += ": messages with id " + msg.MsgId() + " are not supported";
+    return CreateStatusMessage(status);
+}
 std::shared_ptr<zmq::message_t> ReceiverBase::ProcessMessage(
         const messages::Request& req,
         const messages::SetCameraData& msg,
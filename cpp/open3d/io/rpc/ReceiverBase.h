@@ -29,7 +29,9 @@
 #include <atomic>
 #include <mutex>
 #include <thread>
+#include <vector>
 
+#include "open3d/core/Tensor.h"
 #include "open3d/utility/Console.h"
 
 namespace zmq {
@@ -43,15 +45,29 @@ namespace io {
 namespace rpc {
 
 namespace messages {
+struct Array;
 struct Request;
+struct SharedMemoryFrames;
 struct SetMeshData;
 struct GetMeshData;
+struct AppendMeshData;
+struct SetVertexAttributeRange;
+struct RemoveVertices;
 struct SetCameraData;
 struct SetProperties;
 struct SetActiveCamera;
 struct SetTime;
 }  // namespace messages
 
+/// Data of an array sent outside of the msgpack data, in an extra frame of a
+/// multipart message or in shared memory.
+struct MessageFrame {
+    const void* data;
+    size_t size;
+    /// Keeps the data alive.
+    std::shared_ptr<void> owner;
+};
+
 /// Base class for the server side receiving requests from a client.
 /// Subclass from this and implement the overloaded ProcessMessage functions as
 /// needed.
@@ -99,6 +115,18 @@ protected:
             const messages::Request& req,
             const messages::GetMeshData& msg,
             const MsgpackObject& obj);
+    virtual std::shared_ptr<zmq::message_t> ProcessMessage(
+            const messages::Request& req,
+            const messages::AppendMeshData& msg,
+            const MsgpackObject& obj);
+    virtual std::shared_ptr<zmq::message_t> ProcessMessage(
+            const messages::Request& req,
+            const messages::SetVertexAttributeRange& msg,
+            const MsgpackObject& obj);
+    virtual std::shared_ptr<zmq::message_t> ProcessMessage(
+            const messages::Request& req,
+            const messages::RemoveVertices& msg,
+            const MsgpackObject& obj);
     virtual std::shared_ptr<zmq::message_t> ProcessMessage(
             const messages::Request& req,
             const messages::SetCameraData& msg,
@@ -116,9 +144,23 @@ protected:
             const messages::SetTime& msg,
             const MsgpackObject& obj);
 
+    /// Returns a CPU tensor with the data of an array of the message being
+    /// processed. The data of an array sent as an extra frame is not copied:
+    /// the tensor keeps the frame alive. The data of an array in shared
+    /// memory is not copied either, but the sender reuses the memory after
+    /// the reply, so such tensors must be cloned to be kept.
+    core::Tensor GetArrayTensor(const messages::Array& array) const;
+
 private:
     void Mainloop();
 
+    /// Sets the frames of the next message to the regions of a shared memory
+    /// segment of the sender.
+    void MapSharedMemoryFrames(const messages::SharedMemoryFrames& msg);
+
+    /// The frames of the message being processed.
+    std::vector<MessageFrame> frames_;
+
     const std::string address_;
     const int timeout_;
     std::shared_ptr<zmq::context_t> context_;
@@ -129,6 +171,10 @@ private:
     std::atomic<bool> loop_running_;
     std::atomic<int> mainloop_error_code_;
     std::runtime_error mainloop_exception_;
+    /// The last shared memory segment mapped, which the sender reuses.
+    std::string shared_memory_name_;
+    std::shared_ptr<void> shared_memory_;
+    size_t shared_memory_size_;
 };
 
 }  // namespace rpc
@@ -41,6 +41,85 @@ namespace open3d {
 namespace io {
 namespace rpc {
 
+/// Arrays of at least this many bytes are sent as extra frames of a multipart
+/// message instead of being copied into the msgpack data.
+static const int64_t kMinFrameByteSize = 1 << 16;
+
+/// Frees the Tensor which keeps the data of a frame alive, once ZMQ is done
+/// with the frame.
+static void ReleaseTensorFrame(void* data, void* hint) {
+    delete static_cast<core::Tensor*>(hint);
+}
+
+namespace {
+
+/// Creates the arrays of a message from tensors and sends the message. Large
+/// tensors are sent without copies as extra frames, which reference the
+/// tensors until they are sent.
+class MessageArrays {
+public:
+    explicit MessageArrays(const ConnectionBase& connection)
+        : multipart_(connection.SupportsMultipart()) {}
+
+    /// Returns the array of a contiguous CPU version of \p tensor, which is
+    /// kept alive by this object.
+    messages::Array Create(const core::Tensor& tensor) {
+        if (tensor.GetDevice().GetType() != core::Device::DeviceType::CPU) {
+            tensors_.push_back(tensor.Copy(core::Device("CPU:0")));
+        } else {
+            tensors_.push_back(tensor.Contiguous());
+        }
+        const core::Tensor& a = tensors_.back();
+        messages::Array array =
+                DISPATCH_DTYPE_TO_TEMPLATE(a.GetDtype(), [&]() {
+                    return messages::Array::FromPtr(
+                            (scalar_t*)a.GetDataPtr(),
+                            static_cast<std::vector<int64_t>>(a.GetShape()));
+                });
+        if (multipart_ && a.NumElements() * a.GetDtype().ByteSize() >=
+                                  kMinFrameByteSize) {
+            array.data = msgpack::type::raw_ref();
+            array.frame = int64_t(frame_tensors_.size());
+            frame_tensors_.push_back(a);
+        }
+        return array;
+    }
+
+    /// Sends \p msg with the frames of its arrays and returns true if the
+    /// reply is OK.
+    template <class T>
+    bool Send(const T& msg, ConnectionBase& connection) const {
+        msgpack::sbuffer sbuf;
+        messages::Request request{msg.MsgId()};
+        msgpack::pack(sbuf, request);
+        msgpack::pack(sbuf, msg);
+
+        std::shared_ptr<zmq::message_t> reply;
+        if (frame_tensors_.empty()) {
+            zmq::message_t send_msg(sbuf.data(), sbuf.size());
+            reply = connection.Send(send_msg);
+        } else {
+            std::vector<zmq::message_t> send_msgs;
+            send_msgs.emplace_back(sbuf.data(), sbuf.size());
+            for (const core::Tensor& tensor : frame_tensors_) {
+                send_msgs.emplace_back(
+                        const_cast<void*>(tensor.GetDataPtr()),
+                        tensor.NumElements() * tensor.GetDtype().ByteSize(),
+                        ReleaseTensorFrame, new core::Tensor(tensor));
+            }
+            reply = connection.Send(send_msgs);
+        }
+        return ReplyIsOKStatus(*reply);
+    }
+
+private:
+    const bool multipart_;
+    std::vector<core::Tensor> tensors_;
+    std::vector<core::Tensor> frame_tensors_;
+};
+
+}  // namespace
+
 bool SetPointCloud(const geometry::PointCloud& pcd,
                    const std::string& path,
                    int time,
@@ -188,38 +267,23 @@ bool SetMeshData(const core::Tensor& vertices,
                 vertices.GetDtype().ToString());
     }
 
-    auto PrepareTensor = [](const core::Tensor& a) {
-        if (a.GetDevice().GetType() != core::Device::DeviceType::CPU) {
-            return a.Copy(core::Device("CPU:0"));
-        }
-        return a.Contiguous();
-    };
-
-    auto CreateArray = [](const core::Tensor& a) {
-        return DISPATCH_DTYPE_TO_TEMPLATE(a.GetDtype(), [&]() {
-            return messages::Array::FromPtr(
-                    (scalar_t*)a.GetDataPtr(),
-                    static_cast<std::vector<int64_t>>(a.GetShape()));
-        });
-    };
+    if (!connection) {
+        connection = std::shared_ptr<Connection>(new Connection());
+    }
+    MessageArrays arrays(*connection);
 
     messages::SetMeshData msg;
     msg.path = path;
     msg.time = time;
     msg.layer = layer;
 
-    const core::Tensor vertices_ok = PrepareTensor(vertices);
-    msg.data.vertices = CreateArray(vertices_ok);
+    msg.data.vertices = arrays.Create(vertices);
 
-    // store tensors in this vector to make sure the memory blob is alive
-    // for tensors where a deep copy was necessary.
-    std::vector<core::Tensor> tensor_cache;
     for (const auto& item : vertex_attributes) {
-        tensor_cache.push_back(PrepareTensor(item.second));
-        const core::Tensor& tensor = tensor_cache.back();
+        const core::Tensor& tensor = item.second;
         if (tensor.NumDims() >= 1 &&
             tensor.GetShape()[0] == vertices.GetShape()[0]) {
-            msg.data.vertex_attributes[item.first] = CreateArray(tensor);
+            msg.data.vertex_attributes[item.first] = arrays.Create(tensor);
         } else {
             LogError("SetMeshData: Attribute {} has incompatible shape {}",
                      item.first, tensor.GetShape().ToString());
@@ -240,16 +304,14 @@ bool SetMeshData(const core::Tensor& vertices,
             LogError("SetMeshData: last dim of faces must be >=3 but is {}",
                      faces.GetShape()[1]);
         } else {
-            tensor_cache.push_back(PrepareTensor(faces));
-            const core::Tensor& faces_ok = tensor_cache.back();
-            msg.data.faces = CreateArray(faces_ok);
+            msg.data.faces = arrays.Create(faces);
 
             for (const auto& item : face_attributes) {
-                tensor_cache.push_back(PrepareTensor(item.second));
-                const core::Tensor& tensor = tensor_cache.back();
+                const core::Tensor& tensor = item.second;
                 if (tensor.NumDims() >= 1 &&
                     tensor.GetShape()[0] == faces.GetShape()[0]) {
-                    msg.data.face_attributes[item.first] = CreateArray(tensor);
+                    msg.data.face_attributes[item.first] =
+                            arrays.Create(tensor);
                 } else {
                     LogError(
                             "SetMeshData: Attribute {} has incompatible shape "
@@ -274,16 +336,14 @@ bool SetMeshData(const core::Tensor& vertices,
             LogError("SetMeshData: last dim of lines must be >=2 but is {}",
                      lines.GetShape()[1]);
         } else {
-            tensor_cache.push_back(PrepareTensor(lines));
-            const core::Tensor& lines_ok = tensor_cache.back();
-            msg.data.lines = CreateArray(lines_ok);
+            msg.data.lines = arrays.Create(lines);
 
             for (const auto& item : line_attributes) {
-                tensor_cache.push_back(PrepareTensor(item.second));
-                const core::Tensor& tensor = tensor_cache.back();
+                const core::Tensor& tensor = item.second;
                 if (tensor.NumDims() >= 1 &&
                     tensor.GetShape()[0] == lines.GetShape()[0]) {
-                    msg.data.line_attributes[item.first] = CreateArray(tensor);
+                    msg.data.line_attributes[item.first] =
+                            arrays.Create(tensor);
                 } else {
                     LogError(
                             "SetMeshData: Attribute {} has incompatible shape "
@@ -295,26 +355,131 @@ bool SetMeshData(const core::Tensor& vertices,
     }
 
     for (const auto& item : textures) {
-        tensor_cache.push_back(PrepareTensor(item.second));
-        const core::Tensor& tensor = tensor_cache.back();
-        if (tensor.NumElements()) {
-            msg.data.textures[item.first] = CreateArray(tensor);
+        if (item.second.NumElements()) {
+            msg.data.textures[item.first] = arrays.Create(item.second);
         } else {
             LogError("SetMeshData: Texture {} is empty", item.first);
         }
     }
 
-    msgpack::sbuffer sbuf;
-    messages::Request request{msg.MsgId()};
-    msgpack::pack(sbuf, request);
-    msgpack::pack(sbuf, msg);
+    return arrays.Send(msg, *connection);
+}
+
+bool AppendMeshData(
+        const core::Tensor& vertices,
+        const std::string& path,
+        int time,
+        const std::string& layer,
+        const std::map<std::string, core::Tensor>& vertex_attributes,
+        const core::Tensor& faces,
+        std::shared_ptr<ConnectionBase> connection) {
+    if (vertices.NumDims() != 2 || vertices.GetShape()[1] != 3) {
+        LogInfo("AppendMeshData: vertices must have shape [N,3] but is {}",
+                vertices.GetShape().ToString());
+        return false;
+    }
+    if (vertices.GetDtype() != core::Dtype::Float32 &&
+        vertices.GetDtype() != core::Dtype::Float64) {
+        LogError(
+                "AppendMeshData: vertices must have dtype Float32 or Float64 "
+                "but is {}",
+                vertices.GetDtype().ToString());
+    }
 
-    zmq::message_t send_msg(sbuf.data(), sbuf.size());
     if (!connection) {
         connection = std::shared_ptr<Connection>(new Connection());
     }
-    auto reply = connection->Send(send_msg);
-    return ReplyIsOKStatus(*reply);
+    MessageArrays arrays(*connection);
+
+    messages::AppendMeshData msg;
+    msg.path = path;
+    msg.time = time;
+    msg.layer = layer;
+
+    msg.data.vertices = arrays.Create(vertices);
+    for (const auto& item : vertex_attributes) {
+        const core::Tensor& tensor = item.second;
+        if (tensor.NumDims() >= 1 &&
+            tensor.GetShape()[0] == vertices.GetShape()[0]) {
+            msg.data.vertex_attributes[item.first] = arrays.Create(tensor);
+        } else {
+            LogError("AppendMeshData: Attribute {} has incompatible shape {}",
+                     item.first, tensor.GetShape().ToString());
+        }
+    }
+
+    if (faces.NumElements()) {
+        if (faces.GetDtype() != core::Dtype::Int32 &&
+            faces.GetDtype() != core::Dtype::Int64) {
+            LogError(
+                    "AppendMeshData: faces must have dtype Int32 or Int64 but "
+                    "is {}",
+                    faces.GetDtype().ToString());
+        } else if (faces.NumDims() != 2 || faces.GetShape()[1] != 3) {
+            LogError("AppendMeshData: faces must have shape [N,3] but is {}",
+                     faces.GetShape().ToString());
+        } else {
+            msg.data.faces = arrays.Create(faces);
+        }
+    }
+
+    return arrays.Send(msg, *connection);
+}
+
+bool SetVertexAttributeRange(const std::string& attribute,
+                             const core::Tensor& values,
+                             int64_t start,
+                             const std::string& path,
+                             int time,
+                             const std::string& layer,
+                             std::shared_ptr<ConnectionBase> connection) {
+    if (values.NumDims() < 1 || start < 0) {
+        LogInfo("SetVertexAttributeRange: invalid range of {} at {}",
+                values.GetShape().ToString(), start);
+        return false;
+    }
+
+    if (!connection) {
+        connection = std::shared_ptr<Connection>(new Connection());
+    }
+    MessageArrays arrays(*connection);
+
+    messages::SetVertexAttributeRange msg;
+    msg.path = path;
+    msg.time = time;
+    msg.layer = layer;
+    msg.attribute = attribute;
+    msg.start = start;
+    msg.values = arrays.Create(values);
+
+    return arrays.Send(msg, *connection);
+}
+
+bool RemoveVertices(const core::Tensor& indices,
+                    const std::string& path,
+                    int time,
+                    const std::string& layer,
+                    std::shared_ptr<ConnectionBase> connection) {
+    if (indices.NumDims() != 1 || (indices.GetDtype() != core::Dtype::Int32 &&
+                                   indices.GetDtype() != core::Dtype::Int64)) {
+        LogError(
+                "RemoveVertices: indices must be Int32 or Int64 of rank 1 but "
+                "are {} of shape {}",
+                indices.GetDtype().ToString(), indices.GetShape().ToString());
+    }
+
+    if (!connection) {
+        connection = std::shared_ptr<Connection>(new Connection());
+    }
+    MessageArrays arrays(*connection);
+
+    messages::RemoveVertices msg;
+    msg.path = path;
+    msg.time = time;
+    msg.layer = layer;
+    msg.indices = arrays.Create(indices);
+
+    return arrays.Send(msg, *connection);
 }
 
 bool SetLegacyCamera(const camera::PinholeCameraParameters& camera,
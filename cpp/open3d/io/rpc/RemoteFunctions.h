@@ -141,6 +141,84 @@ bool SetMeshData(const core::Tensor& vertices,
                  std::shared_ptr<ConnectionBase> connection =
                          std::shared_ptr<ConnectionBase>());
 
+/// Function for appending vertices and faces to the mesh data at a path,
+/// e.g. the new points of a growing map, without sending the existing data.
+/// \param vertices    Tensor with the new vertices of shape [N,3]
+///
+/// \param path               Path descriptor of the existing mesh data.
+///
+/// \param time               The time point associated with the object.
+///
+/// \param layer              The layer for this object.
+///
+/// \param vertex_attributes  Map with Tensors storing the attributes of the
+/// new vertices. The attributes must match those of the existing data.
+///
+/// \param faces              Tensor with the new triangles of shape
+/// [num_faces,3], which index all vertices including the existing ones.
+///
+/// \param connection  The connection object used for sending the data.
+///                    If nullptr a default connection object will be used.
+///
+bool AppendMeshData(const core::Tensor& vertices,
+                    const std::string& path = "",
+                    int time = 0,
+                    const std::string& layer = "",
+                    const std::map<std::string, core::Tensor>&
+                            vertex_attributes =
+                                    std::map<std::string, core::Tensor>(),
+                    const core::Tensor& faces =
+                            core::Tensor({0}, core::Dtype::Int32),
+                    std::shared_ptr<ConnectionBase> connection =
+                            std::shared_ptr<ConnectionBase>());
+
+/// Function for overwriting a range of vertices of the mesh data at a path,
+/// e.g. to update the colors of some points.
+/// \param attribute   Name of the vertex attribute, e.g. 'colors', or
+/// 'vertices' for the positions.
+///
+/// \param values      Tensor with the new values of shape [N,...].
+///
+/// \param start       Index of the first vertex to overwrite.
+///
+/// \param path        Path descriptor of the existing mesh data.
+///
+/// \param time        The time point associated with the object.
+///
+/// \param layer       The layer for this object.
+///
+/// \param connection  The connection object used for sending the data.
+///                    If nullptr a default connection object will be used.
+///
+bool SetVertexAttributeRange(const std::string& attribute,
+                             const core::Tensor& values,
+                             int64_t start,
+                             const std::string& path = "",
+                             int time = 0,
+                             const std::string& layer = "",
+                             std::shared_ptr<ConnectionBase> connection =
+                                     std::shared_ptr<ConnectionBase>());
+
+/// Function for removing vertices of the mesh data at a path, together with
+/// the faces using them.
+/// \param indices     Int32 or Int64 Tensor with the indices of the vertices.
+///
+/// \param path        Path descriptor of the existing mesh data.
+///
+/// \param time        The time point associated with the object.
+///
+/// \param layer       The layer for this object.
+///
+/// \param connection  The connection object used for sending the data.
+///                    If nullptr a default connection object will be used.
+///
+bool RemoveVertices(const core::Tensor& indices,
+                    const std::string& path = "",
+                    int time = 0,
+                    const std::string& layer = "",
+                    std::shared_ptr<ConnectionBase> connection =
+                            std::shared_ptr<ConnectionBase>());
+
 /// Function for sending Camera data.
 /// \param camera      The PinholeCameraParameters object.
 ///
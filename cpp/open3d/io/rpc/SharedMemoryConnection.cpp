@@ -0,0 +1,177 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/io/rpc/SharedMemoryConnection.h"
+
+#include <algorithm>
+#include <msgpack.hpp>
+#include <zmq.hpp>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include <cstring>
+
+#include "open3d/io/rpc/Messages.h"
+#include "open3d/utility/Console.h"
+
+using namespace open3d::utility;
+
+namespace {
+
+struct SharedMemoryConnectionDefaults {
+    std::string address = "ipc:///tmp/open3d_ipc";
+    int connect_timeout = 5000;
+    int timeout = 10000;
+} defaults;
+
+/// Alignment of the frames in the segment.
+constexpr size_t kFrameAlignment = 64;
+
+/// Minimum size of the segment.
+constexpr size_t kMinSegmentSize = size_t(1) << 24;
+
+}  // namespace
+
+namespace open3d {
+namespace io {
+namespace rpc {
+
+SharedMemoryConnection::SharedMemoryConnection()
+    : SharedMemoryConnection(defaults.address,
+                             defaults.connect_timeout,
+                             defaults.timeout) {}
+
+SharedMemoryConnection::SharedMemoryConnection(const std::string& address,
+                                               int connect_timeout,
+                                               int timeout)
+    : connection_(address, connect_timeout, timeout),
+      data_(nullptr),
+      size_(0),
+      num_segments_(0) {}
+
+SharedMemoryConnection::~SharedMemoryConnection() { Release(); }
+
+std::shared_ptr<zmq::message_t> SharedMemoryConnection::Send(
+        zmq::message_t& send_msg) {
+    return connection_.Send(send_msg);
+}
+
+std::shared_ptr<zmq::message_t> SharedMemoryConnection::Send(const void* data,
+                                                             size_t size) {
+    return connection_.Send(data, size);
+}
+
+std::shared_ptr<zmq::message_t> SharedMemoryConnection::Send(
+        std::vector<zmq::message_t>& send_msgs) {
+    if (send_msgs.size() < 2) {
+        return connection_.Send(send_msgs);
+    }
+    messages::SharedMemoryFrames frames;
+    size_t total_size = 0;
+    for (size_t i = 1; i < send_msgs.size(); ++i) {
+        total_size = (total_size + kFrameAlignment - 1) / kFrameAlignment *
+                     kFrameAlignment;
+        frames.offsets.push_back(total_size);
+        frames.sizes.push_back(send_msgs[i].size());
+        total_size += send_msgs[i].size();
+    }
+    if (!Reserve(total_size)) {
+        return connection_.Send(send_msgs);
+    }
+    frames.name = name_;
+    for (size_t i = 1; i < send_msgs.size(); ++i) {
+        std::memcpy(static_cast<char*>(data_) + frames.offsets[i - 1],
+                    send_msgs[i].data(), send_msgs[i].size());
+    }
+
+    msgpack::sbuffer sbuf;
+    messages::Request request{frames.MsgId()};
+    msgpack::pack(sbuf, request);
+    msgpack::pack(sbuf, frames);
+    sbuf.write(static_cast<const char*>(send_msgs[0].data()),
+               send_msgs[0].size());
+    zmq::message_t msg(sbuf.data(), sbuf.size());
+    return connection_.Send(msg);
+}
+
+bool SharedMemoryConnection::Reserve(size_t size) {
+#ifdef _WIN32
+    return false;
+#else
+    if (data_ && size <= size_) {
+        return true;
+    }
+    Release();
+    // Grow geometrically to reuse the segment for slightly larger messages.
+    size_t new_size = std::max(kMinSegmentSize, size + size / 2);
+    std::string name = "/open3d_" + std::to_string(getpid()) + "_" +
+                       std::to_string(num_segments_++);
+    int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0) {
+        LogWarning("SharedMemoryConnection: unable to create {}", name);
+        return false;
+    }
+    void* data = MAP_FAILED;
+    if (ftruncate(fd, new_size) == 0) {
+        data = mmap(nullptr, new_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd,
+                    0);
+    }
+    close(fd);
+    if (data == MAP_FAILED) {
+        LogWarning("SharedMemoryConnection: unable to map {} bytes", new_size);
+        shm_unlink(name.c_str());
+        return false;
+    }
+    name_ = name;
+    data_ = data;
+    size_ = new_size;
+    return true;
+#endif
+}
+
+void SharedMemoryConnection::Release() {
+#ifndef _WIN32
+    if (data_) {
+        munmap(data_, size_);
+        shm_unlink(name_.c_str());
+    }
+#endif
+    name_ = "";
+    data_ = nullptr;
+    size_ = 0;
+}
+
+std::string SharedMemoryConnection::DefaultAddress() {
+    return defaults.address;
+}
+
+}  // namespace rpc
+}  // namespace io
+}  // namespace open3d
@@ -0,0 +1,105 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "open3d/io/rpc/Connection.h"
+
+namespace open3d {
+namespace io {
+namespace rpc {
+
+/// Connection for a receiver on the same host, which passes the frames of
+/// multipart messages, i.e. the large arrays of SetMeshData, through a POSIX
+/// shared memory segment instead of the socket.
+///
+/// The frames are copied once into the segment and the receiver maps them
+/// without copying. Only a "shared_memory_frames" message with their offsets
+/// precedes the message on the socket, e.g. over an ipc:// address. The
+/// segment is reused for all messages and grows as needed. Since every
+/// message waits for its reply, the receiver is done with the frames of a
+/// message before the next one overwrites them.
+///
+/// Without shared memory support, e.g. on Windows, the frames are sent over
+/// the socket as with Connection.
+class SharedMemoryConnection : public ConnectionBase {
+public:
+    /// Creates a connection with the default parameters
+    SharedMemoryConnection();
+
+    /// Creates a SharedMemoryConnection object used for sending data.
+    /// \param address          The address of the receiving end, which must
+    /// be on the same host.
+    ///
+    /// \param connect_timeout  The timeout for the connect operation of the
+    /// socket.
+    ///
+    /// \param timeout          The timeout for sending data.
+    ///
+    SharedMemoryConnection(const std::string& address,
+                           int connect_timeout,
+                           int timeout);
+
+    /// Unlinks the shared memory segment.
+    ~SharedMemoryConnection();
+
+    /// Function for sending data wrapped in a zmq message object.
+    std::shared_ptr<zmq::message_t> Send(zmq::message_t& send_msg);
+
+    /// Function for sending raw data. Meant for testing purposes
+    std::shared_ptr<zmq::message_t> Send(const void* data, size_t size);
+
+    /// Sends the first frame of a multipart message over the socket and the
+    /// other frames through the shared memory segment.
+    std::shared_ptr<zmq::message_t> Send(
+            std::vector<zmq::message_t>& send_msgs);
+
+    bool SupportsMultipart() const { return true; }
+
+    static std::string DefaultAddress();
+
+private:
+    /// Makes the segment hold at least \p size bytes. Returns false if no
+    /// segment can be created.
+    bool Reserve(size_t size);
+
+    /// Unmaps and unlinks the segment.
+    void Release();
+
+    Connection connection_;
+    std::string name_;
+    void* data_;
+    size_t size_;
+    int num_segments_;
+};
+
+}  // namespace rpc
+}  // namespace io
+}  // namespace open3d
@@ -56,6 +56,16 @@ public:
 
     /// Flush data to recording file and disconnect from sensor
     virtual bool CloseRecord() = 0;
+
+    /// Write frames to the recording file from a background thread, with up
+    /// to \p queue_size frames waiting to be written. RecordFrame() then only
+    /// waits for the file if the queue is full. 0 writes the frames in
+    /// RecordFrame(). Call before OpenRecord().
+    ///
+    /// \return false if the recorder does not support the setting.
+    virtual bool SetWriteQueueSize(size_t queue_size) {
+        return queue_size == 0;
+    }
 };
 
 }  // namespace io
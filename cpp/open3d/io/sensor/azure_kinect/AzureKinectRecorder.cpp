@@ -77,6 +77,10 @@ bool AzureKinectRecorder::OpenRecord(const std::string& filename) {
         utility::LogInfo("Writing to header");
 
         is_record_created_ = true;
+        if (write_queue_size_ > 0) {
+            stop_writing_ = false;
+            write_thread_ = std::thread(&AzureKinectRecorder::WriteLoop, this);
+        }
     }
     return true;
 }
@@ -84,6 +88,15 @@ bool AzureKinectRecorder::OpenRecord(const std::string& filename) {
 bool AzureKinectRecorder::CloseRecord() {
     if (is_record_created_) {
         utility::LogInfo("Saving recording...");
+        if (write_thread_.joinable()) {
+            {
+                std::lock_guard<std::mutex> lock(write_mutex_);
+                stop_writing_ = true;
+            }
+            write_queue_changed_.notify_all();
+            // The write thread empties the queue before exiting.
+            write_thread_.join();
+        }
         if (K4A_FAILED(k4a_plugin::k4a_record_flush(recording_))) {
             utility::LogWarning("Unable to flush record file");
             return false;
@@ -96,12 +109,51 @@ bool AzureKinectRecorder::CloseRecord() {
     return true;
 }
 
+bool AzureKinectRecorder::SetWriteQueueSize(size_t queue_size) {
+    if (is_record_created_) {
+        utility::LogWarning(
+                "The write queue size must be set before OpenRecord().");
+        return false;
+    }
+    write_queue_size_ = queue_size;
+    return true;
+}
+
+void AzureKinectRecorder::WriteLoop() {
+    std::unique_lock<std::mutex> lock(write_mutex_);
+    while (true) {
+        write_queue_changed_.wait(lock, [this] {
+            return stop_writing_ || !write_queue_.empty();
+        });
+        if (write_queue_.empty()) return;  // Stopped and all written.
+        k4a_capture_t capture = write_queue_.front();
+        write_queue_.pop_front();
+        write_queue_changed_.notify_all();
+        lock.unlock();
+        if (K4A_FAILED(k4a_plugin::k4a_record_write_capture(recording_,
+                                                            capture))) {
+            utility::LogWarning("Unable to write to capture");
+        }
+        k4a_plugin::k4a_capture_release(capture);
+        lock.lock();
+    }
+}
+
 std::shared_ptr<geometry::RGBDImage> AzureKinectRecorder::RecordFrame(
         bool write, bool enable_align_depth_to_color) {
     k4a_capture_t capture = sensor_.CaptureRawFrame();
     if (capture != nullptr && is_record_created_ && write) {
-        if (K4A_FAILED(k4a_plugin::k4a_record_write_capture(recording_,
-                                                            capture))) {
+        if (write_thread_.joinable()) {
+            // The write thread releases its reference after writing.
+            k4a_plugin::k4a_capture_reference(capture);
+            std::unique_lock<std::mutex> lock(write_mutex_);
+            write_queue_changed_.wait(lock, [this] {
+                return write_queue_.size() < write_queue_size_;
+            });
+            write_queue_.push_back(capture);
+            write_queue_changed_.notify_all();
+        } else if (K4A_FAILED(k4a_plugin::k4a_record_write_capture(
+                           recording_, capture))) {
             utility::LogError("Unable to write to capture");
         }
     }
@@ -110,11 +162,13 @@ std::shared_ptr<geometry::RGBDImage> AzureKinectRecorder::RecordFrame(
             capture, enable_align_depth_to_color
                              ? sensor_.transform_depth_to_color_
                              : nullptr);
+    if (capture != nullptr) {
+        k4a_plugin::k4a_capture_release(capture);
+    }
     if (im_rgbd == nullptr) {
         utility::LogInfo("Invalid capture, skipping this frame");
         return nullptr;
     }
-    k4a_plugin::k4a_capture_release(capture);
     return im_rgbd;
 }
 }  // namespace io
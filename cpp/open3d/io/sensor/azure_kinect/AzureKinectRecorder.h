@@ -27,14 +27,19 @@
 #pragma once
 
 #include <atomic>
+#include <condition_variable>
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 
 #include "open3d/io/sensor/RGBDRecorder.h"
 #include "open3d/io/sensor/azure_kinect/AzureKinectSensor.h"
 #include "open3d/io/sensor/azure_kinect/AzureKinectSensorConfig.h"
 
-struct _k4a_record_t;  // typedef _k4a_record_t* k4a_record_t;
+struct _k4a_record_t;   // typedef _k4a_record_t* k4a_record_t;
+struct _k4a_capture_t;  // typedef _k4a_capture_t* k4a_capture_t;
 
 namespace open3d {
 
@@ -70,6 +75,13 @@ public:
     std::shared_ptr<geometry::RGBDImage> RecordFrame(
             bool write, bool enable_align_depth_to_color) override;
 
+    /// Write the captures to the mkv file from a background thread, see
+    /// RGBDRecorder::SetWriteQueueSize().
+    ///
+    /// \param queue_size Max number of captures waiting to be written. 0
+    /// writes them in RecordFrame().
+    bool SetWriteQueueSize(size_t queue_size) override;
+
     /// Check if the mkv file is created.
     bool IsRecordCreated() { return is_record_created_; }
 
@@ -79,6 +91,15 @@ protected:
     size_t device_index_;
 
     bool is_record_created_ = false;
+
+    /// Writes the queued captures until CloseRecord().
+    void WriteLoop();
+    size_t write_queue_size_ = 0;
+    std::thread write_thread_;
+    std::mutex write_mutex_;
+    std::condition_variable write_queue_changed_;
+    std::deque<_k4a_capture_t*> write_queue_;
+    bool stop_writing_ = false;
 };
 
 }  // namespace io
@@ -37,6 +37,7 @@
 
 #include <tbb/parallel_for.h>
 
+#include <algorithm>
 #include <iostream>
 #include <numeric>
 
@@ -136,6 +137,34 @@ static void AllPairsSortedIoU(const float *boxes,
             });
 }
 
+/// Greedy suppression over the IoU bitmask of boxes sorted by descending
+/// score. Sets keep[i] to 1 if the i-th sorted box is selected.
+static void MarkKeptBoxes(const uint64_t *mask, int n, uint8_t *keep) {
+    const int num_block_cols = utility::DivUp(n, NMS_BLOCK_SIZE);
+
+    // remv_cpu has n bits in total. If the bit is 1, the corresponding box
+    // will be removed.
+    std::vector<uint64_t> remv_cpu(num_block_cols, 0);
+    for (int i = 0; i < n; i++) {
+        int block_col_idx = i / NMS_BLOCK_SIZE;
+        int inner_block_col_idx = i % NMS_BLOCK_SIZE;  // threadIdx.x
+
+        // Querying the i-th bit in remv_cpu, counted from the right.
+        // - remv_cpu[block_col_idx]: the block bitmap containing the query.
+        // - 1ULL << inner_block_col_idx: the one-hot bitmap to extract i.
+        if (!(remv_cpu[block_col_idx] & (1ULL << inner_block_col_idx))) {
+            // Keep the i-th box.
+            keep[i] = 1;
+
+            // Any box that overlaps with the i-th box will be removed.
+            const uint64_t *p = mask + int64_t(i) * num_block_cols;
+            for (int j = block_col_idx; j < num_block_cols; j++) {
+                remv_cpu[j] |= p[j];
+            }
+        }
+    }
+}
+
 std::vector<int64_t> NmsCPUKernel(const float *boxes,
                                   const float *scores,
                                   int n,
@@ -152,28 +181,95 @@ std::vector<int64_t> NmsCPUKernel(const float *boxes,
     AllPairsSortedIoU(boxes, scores, sort_indices.data(), mask, n,
                       nms_overlap_thresh);
 
-    // Write to keep. remv_cpu has n bits in total. If the bit is 1, the
-    // corresponding box will be removed.
-    std::vector<uint64_t> remv_cpu(num_block_cols, 0);
+    // Write to keep.
+    std::vector<uint8_t> keep(n, 0);
+    MarkKeptBoxes(mask, n, keep.data());
     std::vector<int64_t> keep_indices;
     for (int i = 0; i < n; i++) {
-        int block_col_idx = i / NMS_BLOCK_SIZE;
-        int inner_block_col_idx = i % NMS_BLOCK_SIZE;  // threadIdx.x
-
-        // Querying the i-th bit in remv_cpu, counted from the right.
-        // - remv_cpu[block_col_idx]: the block bitmap containing the query.
-        // - 1ULL << inner_block_col_idx: the one-hot bitmap to extract i.
-        if (!(remv_cpu[block_col_idx] & (1ULL << inner_block_col_idx))) {
-            // Keep the i-th box.
+        if (keep[i]) {
             keep_indices.push_back(sort_indices[i]);
+        }
+    }
 
-            // Any box that overlaps with the i-th box will be removed.
-            uint64_t *p = mask + i * num_block_cols;
-            for (int j = block_col_idx; j < num_block_cols; j++) {
-                remv_cpu[j] |= p[j];
-            }
+    return keep_indices;
+}
+
+std::vector<int64_t> BatchedNmsCPUKernel(
+        const float *boxes,
+        const float *scores,
+        const int64_t *labels,
+        const int64_t *row_splits,
+        int n,
+        int num_segments,
+        double nms_overlap_thresh,
+        std::vector<int64_t> &keep_row_splits) {
+    keep_row_splits.assign(num_segments + 1, 0);
+    if (n == 0) {
+        return {};
+    }
+
+    std::vector<int64_t> segment_ids(n);
+    for (int s = 0; s < num_segments; ++s) {
+        std::fill(segment_ids.begin() + row_splits[s],
+                  segment_ids.begin() + row_splits[s + 1], s);
+    }
+
+    // Orders boxes by (segment, label). Boxes that compare equal belong to
+    // the same group and may suppress each other.
+    auto GroupLess = [&](int64_t i, int64_t j) {
+        if (segment_ids[i] != segment_ids[j]) {
+            return segment_ids[i] < segment_ids[j];
+        }
+        return labels && labels[i] < labels[j];
+    };
+
+    // Sort by group and descending score. Each group is a contiguous range
+    // of sort_indices afterwards.
+    std::vector<int64_t> sort_indices(n);
+    std::iota(sort_indices.begin(), sort_indices.end(), 0);
+    std::stable_sort(sort_indices.begin(), sort_indices.end(),
+                     [&](int64_t i, int64_t j) {
+                         if (GroupLess(i, j)) return true;
+                         if (GroupLess(j, i)) return false;
+                         return scores[i] > scores[j];
+                     });
+
+    std::vector<int> group_splits(1, 0);
+    for (int i = 1; i < n; ++i) {
+        if (GroupLess(sort_indices[i - 1], sort_indices[i])) {
+            group_splits.push_back(i);
+        }
+    }
+    group_splits.push_back(n);
+    const int num_groups = group_splits.size() - 1;
+
+    // Run the all pairs IoU and the suppression for each group in parallel.
+    std::vector<uint8_t> keep(n, 0);
+    tbb::parallel_for(
+            tbb::blocked_range<int>(0, num_groups, 1),
+            [&](const tbb::blocked_range<int> &r) {
+                for (int g = r.begin(); g != r.end(); ++g) {
+                    const int begin = group_splits[g];
+                    const int m = group_splits[g + 1] - begin;
+                    const int num_block_cols =
+                            utility::DivUp(m, NMS_BLOCK_SIZE);
+                    std::vector<uint64_t> mask(int64_t(m) * num_block_cols);
+                    AllPairsSortedIoU(boxes, scores,
+                                      sort_indices.data() + begin, mask.data(),
+                                      m, nms_overlap_thresh);
+                    MarkKeptBoxes(mask.data(), m, keep.data() + begin);
+                }
+            });
+
+    std::vector<int64_t> keep_indices;
+    for (int i = 0; i < n; i++) {
+        if (keep[i]) {
+            keep_indices.push_back(sort_indices[i]);
+            ++keep_row_splits[segment_ids[sort_indices[i]] + 1];
         }
     }
+    std::partial_sum(keep_row_splits.begin(), keep_row_splits.end(),
+                     keep_row_splits.begin());
 
     return keep_indices;
 }
@@ -33,11 +33,17 @@
 // Written by Shaoshuai Shi
 // All Rights Reserved 2019-2020.
 
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
 #include <thrust/device_vector.h>
+#include <thrust/functional.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/sequence.h>
 #include <thrust/sort.h>
 
+#include <algorithm>
+#include <numeric>
+
 #include "open3d/ml/Helper.h"
 #include "open3d/ml/contrib/IoUImpl.h"
 #include "open3d/ml/contrib/Nms.h"
@@ -212,6 +218,272 @@ std::vector<int64_t> NmsCUDAKernel(const float *boxes,
     return keep_indices;
 }
 
+/// Orders boxes by segment, label and descending score.
+struct BatchedNmsLess {
+    const float *scores;
+    const int64_t *labels;
+    const int64_t *segment_ids;
+
+    __device__ bool SameGroup(int64_t i, int64_t j) const {
+        return segment_ids[i] == segment_ids[j] &&
+               (!labels || labels[i] == labels[j]);
+    }
+
+    __device__ bool operator()(int64_t i, int64_t j) const {
+        if (segment_ids[i] != segment_ids[j]) {
+            return segment_ids[i] < segment_ids[j];
+        }
+        if (labels && labels[i] != labels[j]) {
+            return labels[i] < labels[j];
+        }
+        return scores[i] > scores[j];
+    }
+};
+
+/// Returns true if the i-th sorted box starts a new group.
+struct IsGroupStart {
+    BatchedNmsLess less;
+    const int64_t *sort_indices;
+
+    __device__ bool operator()(int64_t i) const {
+        return i == 0 || !less.SameGroup(sort_indices[i - 1], sort_indices[i]);
+    }
+};
+
+/// Computes the IoU bitmask for all groups in one launch. Each thread block
+/// processes one 64x64 tile of one group. The tiles of group g start at
+/// tile_splits[g] and the mask of group g at mask_splits[g]. Only the tiles on
+/// and above the diagonal are computed since the suppression does not read
+/// the other tiles.
+__global__ void BatchedNmsKernel(const float *boxes,
+                                 const int64_t *sort_indices,
+                                 const int64_t *group_splits,
+                                 const int64_t *tile_splits,
+                                 const int64_t *mask_splits,
+                                 uint64_t *mask,
+                                 const int num_groups,
+                                 const double nms_overlap_thresh) {
+    const int64_t tile_idx = blockIdx.x;
+
+    // Binary search for the group of this tile.
+    int lo = 0;
+    int hi = num_groups - 1;
+    while (lo < hi) {
+        const int mid = (lo + hi + 1) / 2;
+        if (tile_splits[mid] <= tile_idx) {
+            lo = mid;
+        } else {
+            hi = mid - 1;
+        }
+    }
+    const int group_idx = lo;
+
+    const int64_t begin = group_splits[group_idx];
+    const int n = group_splits[group_idx + 1] - begin;
+    const int num_block_cols = (n + NMS_BLOCK_SIZE - 1) / NMS_BLOCK_SIZE;
+    const int64_t local_tile_idx = tile_idx - tile_splits[group_idx];
+    const int block_row_idx = local_tile_idx / num_block_cols;
+    const int block_col_idx = local_tile_idx % num_block_cols;
+    if (block_col_idx < block_row_idx) {
+        return;
+    }
+
+    sort_indices += begin;
+    mask += mask_splits[group_idx];
+
+    const int row_size =
+            fminf(n - block_row_idx * NMS_BLOCK_SIZE, NMS_BLOCK_SIZE);
+    const int col_size =
+            fminf(n - block_col_idx * NMS_BLOCK_SIZE, NMS_BLOCK_SIZE);
+
+    __shared__ float block_boxes[NMS_BLOCK_SIZE * 5];
+    if (threadIdx.x < col_size) {
+        float *dst = block_boxes + threadIdx.x * 5;
+        const int src_idx = NMS_BLOCK_SIZE * block_col_idx + threadIdx.x;
+        const float *src = boxes + sort_indices[src_idx] * 5;
+        dst[0] = src[0];
+        dst[1] = src[1];
+        dst[2] = src[2];
+        dst[3] = src[3];
+        dst[4] = src[4];
+    }
+    __syncthreads();
+
+    if (threadIdx.x < row_size) {
+        const int src_idx = NMS_BLOCK_SIZE * block_row_idx + threadIdx.x;
+        int dst_idx = block_row_idx == block_col_idx ? threadIdx.x + 1 : 0;
+
+        uint64_t t = 0;
+        while (dst_idx < col_size) {
+            if (IoUBev2DWithMinAndMax(boxes + sort_indices[src_idx] * 5,
+                                      block_boxes + dst_idx * 5) >
+                nms_overlap_thresh) {
+                t |= 1ULL << dst_idx;
+            }
+            dst_idx++;
+        }
+        mask[int64_t(src_idx) * num_block_cols + block_col_idx] = t;
+    }
+}
+
+/// Greedy suppression with one thread block per group. The boxes of a group
+/// are visited in order of descending score. The threads of the block merge
+/// the mask row of each selected box into the removal bitmap in parallel.
+/// The removal bitmap is stored in shared memory or, if it does not fit, in
+/// \p remv_global at offset remv_splits[g].
+__global__ void BatchedNmsSuppressKernel(const int64_t *group_splits,
+                                         const int64_t *mask_splits,
+                                         const uint64_t *mask,
+                                         uint64_t *remv_global,
+                                         const int64_t *remv_splits,
+                                         uint8_t *keep) {
+    extern __shared__ uint64_t remv_shared[];
+
+    const int group_idx = blockIdx.x;
+    const int64_t begin = group_splits[group_idx];
+    const int n = group_splits[group_idx + 1] - begin;
+    const int num_block_cols = (n + NMS_BLOCK_SIZE - 1) / NMS_BLOCK_SIZE;
+    mask += mask_splits[group_idx];
+    keep += begin;
+
+    uint64_t *remv = remv_global ? remv_global + remv_splits[group_idx]
+                                 : remv_shared;
+    for (int j = threadIdx.x; j < num_block_cols; j += blockDim.x) {
+        remv[j] = 0;
+    }
+    __syncthreads();
+
+    for (int i = 0; i < n; i++) {
+        const int block_col_idx = i / NMS_BLOCK_SIZE;
+        const int inner_block_col_idx = i % NMS_BLOCK_SIZE;
+        const bool removed =
+                remv[block_col_idx] & (1ULL << inner_block_col_idx);
+        __syncthreads();
+        if (!removed) {
+            if (threadIdx.x == 0) {
+                keep[i] = 1;
+            }
+            const uint64_t *p = mask + int64_t(i) * num_block_cols;
+            for (int j = block_col_idx + threadIdx.x; j < num_block_cols;
+                 j += blockDim.x) {
+                remv[j] |= p[j];
+            }
+            __syncthreads();
+        }
+    }
+}
+
+std::vector<int64_t> BatchedNmsCUDAKernel(
+        const float *boxes,
+        const float *scores,
+        const int64_t *labels,
+        const int64_t *row_splits,
+        int n,
+        int num_segments,
+        double nms_overlap_thresh,
+        std::vector<int64_t> &keep_row_splits) {
+    keep_row_splits.assign(num_segments + 1, 0);
+    if (n == 0) {
+        return {};
+    }
+
+    // Segment id of each box.
+    thrust::device_vector<int64_t> segment_ids(n);
+    thrust::upper_bound(thrust::device_pointer_cast(row_splits + 1),
+                        thrust::device_pointer_cast(row_splits + num_segments),
+                        thrust::counting_iterator<int64_t>(0),
+                        thrust::counting_iterator<int64_t>(n),
+                        segment_ids.begin());
+
+    // Sort by segment, label and descending score in one pass. Each group is
+    // a contiguous range of sort_indices afterwards.
+    BatchedNmsLess less{scores, labels, segment_ids.data().get()};
+    thrust::device_vector<int64_t> sort_indices(n);
+    thrust::sequence(sort_indices.begin(), sort_indices.end(), 0);
+    thrust::stable_sort(sort_indices.begin(), sort_indices.end(), less);
+
+    // Find the start of each group.
+    const int64_t *sort_indices_ptr = sort_indices.data().get();
+    thrust::device_vector<int64_t> group_starts(n);
+    auto group_starts_end = thrust::copy_if(
+            thrust::counting_iterator<int64_t>(0),
+            thrust::counting_iterator<int64_t>(n), group_starts.begin(),
+            IsGroupStart{less, sort_indices_ptr});
+    const int num_groups = group_starts_end - group_starts.begin();
+
+    // The layout of the tiles and masks only depends on the group sizes,
+    // which are small enough to be prepared on the host.
+    std::vector<int64_t> group_splits(num_groups + 1);
+    thrust::copy(group_starts.begin(), group_starts_end, group_splits.begin());
+    group_splits[num_groups] = n;
+    std::vector<int64_t> tile_splits(num_groups + 1, 0);
+    std::vector<int64_t> mask_splits(num_groups + 1, 0);
+    std::vector<int64_t> remv_splits(num_groups + 1, 0);
+    int max_block_cols = 0;
+    for (int g = 0; g < num_groups; ++g) {
+        const int64_t m = group_splits[g + 1] - group_splits[g];
+        const int64_t num_block_cols = utility::DivUp(m, NMS_BLOCK_SIZE);
+        tile_splits[g + 1] = tile_splits[g] + num_block_cols * num_block_cols;
+        mask_splits[g + 1] = mask_splits[g] + m * num_block_cols;
+        remv_splits[g + 1] = remv_splits[g] + num_block_cols;
+        max_block_cols = std::max<int>(max_block_cols, num_block_cols);
+    }
+    thrust::device_vector<int64_t> group_splits_dev(group_splits);
+    thrust::device_vector<int64_t> tile_splits_dev(tile_splits);
+    thrust::device_vector<int64_t> mask_splits_dev(mask_splits);
+    thrust::device_vector<int64_t> remv_splits_dev(remv_splits);
+    thrust::device_vector<uint64_t> mask(mask_splits[num_groups]);
+
+    BatchedNmsKernel<<<tile_splits[num_groups], NMS_BLOCK_SIZE>>>(
+            boxes, sort_indices_ptr, group_splits_dev.data().get(),
+            tile_splits_dev.data().get(), mask_splits_dev.data().get(),
+            mask.data().get(), num_groups, nms_overlap_thresh);
+    OPEN3D_ML_CUDA_CHECK(cudaGetLastError());
+
+    // Keep the removal bitmaps in shared memory unless a group is too large.
+    const size_t max_shared_mem = 48 * 1024;
+    const size_t remv_bytes = max_block_cols * sizeof(uint64_t);
+    thrust::device_vector<uint64_t> remv_global;
+    if (remv_bytes > max_shared_mem) {
+        remv_global.resize(remv_splits[num_groups]);
+    }
+    thrust::device_vector<uint8_t> keep(n, 0);
+    BatchedNmsSuppressKernel<<<num_groups, NMS_BLOCK_SIZE,
+                               remv_global.empty() ? remv_bytes : 0>>>(
+            group_splits_dev.data().get(), mask_splits_dev.data().get(),
+            mask.data().get(),
+            remv_global.empty() ? nullptr : remv_global.data().get(),
+            remv_splits_dev.data().get(), keep.data().get());
+    OPEN3D_ML_CUDA_CHECK(cudaGetLastError());
+
+    // Compact the selected indices.
+    thrust::device_vector<int64_t> keep_indices_dev(n);
+    auto keep_indices_end = thrust::copy_if(
+            sort_indices.begin(), sort_indices.end(), keep.begin(),
+            keep_indices_dev.begin(), thrust::identity<uint8_t>());
+    std::vector<int64_t> keep_indices(keep_indices_end -
+                                      keep_indices_dev.begin());
+    thrust::copy(keep_indices_dev.begin(), keep_indices_end,
+                 keep_indices.begin());
+
+    // The selected indices are sorted by segment.
+    std::vector<int64_t> row_splits_cpu(num_segments + 1);
+    OPEN3D_ML_CUDA_CHECK(cudaMemcpy(row_splits_cpu.data(), row_splits,
+                                    (num_segments + 1) * sizeof(int64_t),
+                                    cudaMemcpyDeviceToHost));
+    for (const int64_t idx : keep_indices) {
+        const int64_t segment_id =
+                std::upper_bound(row_splits_cpu.begin() + 1,
+                                 row_splits_cpu.end() - 1, idx) -
+                (row_splits_cpu.begin() + 1);
+        ++keep_row_splits[segment_id + 1];
+    }
+    std::partial_sum(keep_row_splits.begin(), keep_row_splits.end(),
+                     keep_row_splits.begin());
+
+    return keep_indices;
+}
+
 }  // namespace contrib
 }  // namespace ml
 }  // namespace open3d
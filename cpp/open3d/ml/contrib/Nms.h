@@ -54,6 +54,37 @@ std::vector<int64_t> NmsCUDAKernel(const float *boxes,
                                    const float *scores,
                                    int n,
                                    double nms_overlap_thresh);
+
+/// Batched multi-class NMS. The boxes are split into segments (e.g. the items
+/// of a batch) with \p row_splits and each segment is further grouped by
+/// \p labels. Boxes only suppress boxes of the same segment and label. All
+/// groups are processed with a single sort and a single launch for the IoU
+/// bitmask and the suppression.
+///
+/// \param boxes (n, 5) float32 on the device.
+/// \param scores (n,) float32 on the device.
+/// \param labels (n,) int64 class labels on the device. Can be nullptr, in
+/// which case all boxes of a segment belong to the same class.
+/// \param row_splits (num_segments+1,) int64 exclusive prefix sum on the
+/// device that defines the segments.
+/// \param n Number of boxes.
+/// \param num_segments Number of segments.
+/// \param nms_overlap_thresh When a high-score box is selected, other
+/// remaining boxes of the same group with IoU > nms_overlap_thresh will be
+/// discarded.
+/// \param keep_row_splits Output (num_segments+1,) exclusive prefix sum that
+/// defines the segments of the returned indices.
+/// \return Selected box indices to keep. The indices are sorted by segment,
+/// then by label and then by descending score.
+std::vector<int64_t> BatchedNmsCUDAKernel(
+        const float *boxes,
+        const float *scores,
+        const int64_t *labels,
+        const int64_t *row_splits,
+        int n,
+        int num_segments,
+        double nms_overlap_thresh,
+        std::vector<int64_t> &keep_row_splits);
 #endif
 
 /// \param boxes (n, 5) float32.
@@ -67,6 +98,35 @@ std::vector<int64_t> NmsCPUKernel(const float *boxes,
                                   int n,
                                   double nms_overlap_thresh);
 
+/// Batched multi-class NMS. The boxes are split into segments (e.g. the items
+/// of a batch) with \p row_splits and each segment is further grouped by
+/// \p labels. Boxes only suppress boxes of the same segment and label. The
+/// groups are processed in parallel.
+///
+/// \param boxes (n, 5) float32.
+/// \param scores (n,) float32.
+/// \param labels (n,) int64 class labels. Can be nullptr, in which case all
+/// boxes of a segment belong to the same class.
+/// \param row_splits (num_segments+1,) int64 exclusive prefix sum that
+/// defines the segments.
+/// \param n Number of boxes.
+/// \param num_segments Number of segments.
+/// \param nms_overlap_thresh When a high-score box is selected, other
+/// remaining boxes of the same group with IoU > nms_overlap_thresh will be
+/// discarded.
+/// \param keep_row_splits Output (num_segments+1,) exclusive prefix sum that
+/// defines the segments of the returned indices.
+/// \return Selected box indices to keep. The indices are sorted by segment,
+/// then by label and then by descending score.
+std::vector<int64_t> BatchedNmsCPUKernel(const float *boxes,
+                                         const float *scores,
+                                         const int64_t *labels,
+                                         const int64_t *row_splits,
+                                         int n,
+                                         int num_segments,
+                                         double nms_overlap_thresh,
+                                         std::vector<int64_t> &keep_row_splits);
+
 }  // namespace contrib
 }  // namespace ml
 }  // namespace open3d
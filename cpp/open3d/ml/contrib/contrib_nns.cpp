@@ -27,6 +27,8 @@
 #include <numeric>
 
 #include "open3d/core/nns/NearestNeighborSearch.h"
+#include "open3d/t/geometry/kernel/PointCloud.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace ml {
@@ -199,7 +201,7 @@ const core::Tensor RadiusSearch(const core::Tensor& query_points,
     core::Tensor result = core::Tensor::Full(
             {num_query_points, max_num_neighbors}, -1, core::Dtype::Int64);
 
-#pragma omp parallel for schedule(static)
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
     for (int64_t batch_idx = 0; batch_idx < num_batches; ++batch_idx) {
         int32_t result_start_idx = query_prefix_indices[batch_idx];
         int32_t result_end_idx = query_prefix_indices[batch_idx + 1];
@@ -232,6 +234,68 @@ const core::Tensor RadiusSearch(const core::Tensor& query_points,
 
     return result.To(core::Dtype::Int32);
 }
+
+core::Tensor BatchRadiusNeighbors(const core::Tensor& queries,
+                                  const core::Tensor& supports,
+                                  const core::Tensor& queries_row_splits,
+                                  const core::Tensor& supports_row_splits,
+                                  double radius) {
+    core::Device device = supports.GetDevice();
+    queries.AssertDtype(core::Dtype::Float32);
+    supports.AssertDtype(core::Dtype::Float32);
+    queries.AssertDevice(device);
+    if (queries.NumDims() != 2 || queries.GetShape()[1] != 3) {
+        utility::LogError("queries must have shape (N, 3), but got {}.",
+                          queries.GetShape().ToString());
+    }
+    if (supports.NumDims() != 2 || supports.GetShape()[1] != 3) {
+        utility::LogError("supports must have shape (N, 3), but got {}.",
+                          supports.GetShape().ToString());
+    }
+    queries_row_splits.AssertDtype(core::Dtype::Int64);
+    supports_row_splits.AssertDtype(core::Dtype::Int64);
+    queries_row_splits.AssertDevice(device);
+    supports_row_splits.AssertDevice(device);
+    if (queries_row_splits.NumDims() != 1 ||
+        supports_row_splits.NumDims() != 1 ||
+        queries_row_splits.GetLength() != supports_row_splits.GetLength()) {
+        utility::LogError(
+                "Row splits must have the same shape (n_batches + 1,), but got "
+                "{} and {}.",
+                queries_row_splits.GetShape().ToString(),
+                supports_row_splits.GetShape().ToString());
+    }
+    int64_t num_queries = queries.GetLength();
+    int64_t num_supports = supports.GetLength();
+
+    core::nns::NearestNeighborSearch nns(supports.Contiguous(),
+                                         supports_row_splits);
+    nns.FixedRadiusIndex(radius);
+    core::Tensor indices;
+    core::Tensor distances;
+    core::Tensor num_neighbors;
+    std::tie(indices, distances, num_neighbors) = nns.FixedRadiusSearch(
+            queries.Contiguous(), queries_row_splits, radius);
+
+    // Scatter the ragged neighbor list into the padded rows: neighbor k of
+    // the list is column k - neighbor_row_splits[row] of its query row.
+    int64_t max_num_neighbors =
+            num_queries > 0 ? num_neighbors.Max({0}).Item<int64_t>() : 0;
+    core::Tensor result =
+            core::Tensor::Full({num_queries, max_num_neighbors}, num_supports,
+                               core::Dtype::Int64, device);
+    core::Tensor neighbor_row_splits, rows;
+    t::geometry::kernel::pointcloud::RowSplits(num_neighbors,
+                                               neighbor_row_splits);
+    t::geometry::kernel::pointcloud::SegmentIdsFromRowSplits(
+            neighbor_row_splits, rows);
+    core::Tensor cols =
+            core::Tensor::Arange(0, rows.GetLength(), 1, core::Dtype::Int64,
+                                 device) -
+            neighbor_row_splits.IndexGet({rows});
+    result.IndexSet({rows, cols}, indices.To(core::Dtype::Int64));
+    return result;
+}
 }  // namespace contrib
 }  // namespace ml
 }  // namespace open3d
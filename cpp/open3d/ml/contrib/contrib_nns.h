@@ -60,6 +60,26 @@ const core::Tensor RadiusSearch(const core::Tensor& query_points,
                                 const core::Tensor& query_batches,
                                 const core::Tensor& dataset_batches,
                                 double radius);
+
+/// Radius neighbors of a batch of point clouds, the Tensor counterpart of
+/// batch_nanoflann_neighbors for KPConv. All the batches share one fixed
+/// radius index, the spatial hash on CUDA and nanoflann on CPU, so the search
+/// stays on the device of the points.
+///
+/// \param queries Tensor of shape {n_queries, 3}, dtype Float32.
+/// \param supports Tensor of shape {n_supports, 3}, dtype Float32.
+/// \param queries_row_splits Tensor of shape {n_batches + 1,}, dtype Int64.
+/// \param supports_row_splits Tensor of shape {n_batches + 1,}, dtype Int64.
+/// \param radius The radius to search.
+/// \return Tensor of shape {n_queries, max_neighbor}, dtype Int64, with the
+/// rows of supports neighboring each query. Like batch_nanoflann_neighbors,
+/// queries with less than max_neighbor neighbors are padded with the shadow
+/// index n_supports.
+core::Tensor BatchRadiusNeighbors(const core::Tensor& queries,
+                                  const core::Tensor& supports,
+                                  const core::Tensor& queries_row_splits,
+                                  const core::Tensor& supports_row_splits,
+                                  double radius);
 }  // namespace contrib
 }  // namespace ml
 }  // namespace open3d
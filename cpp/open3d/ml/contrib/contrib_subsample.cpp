@@ -0,0 +1,181 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/ml/contrib/contrib_subsample.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "open3d/core/hashmap/Hashmap.h"
+#include "open3d/t/geometry/kernel/PointCloud.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace ml {
+namespace contrib {
+
+namespace pointcloud = t::geometry::kernel::pointcloud;
+
+std::tuple<core::Tensor, core::Tensor, core::Tensor, core::Tensor>
+BatchGridSubsampling(const core::Tensor& points,
+                     const core::Tensor& row_splits,
+                     const utility::optional<core::Tensor>& features,
+                     const utility::optional<core::Tensor>& classes,
+                     float sampleDl,
+                     int max_p) {
+    if (sampleDl <= 0) {
+        utility::LogError("sampleDl must be positive, but got {}.", sampleDl);
+    }
+    core::Device device = points.GetDevice();
+    points.AssertDtype(core::Dtype::Float32);
+    if (points.NumDims() != 2 || points.GetShape()[1] != 3) {
+        utility::LogError("points must have shape (N, 3), but got {}.",
+                          points.GetShape().ToString());
+    }
+    row_splits.AssertDtype(core::Dtype::Int64);
+    row_splits.AssertDevice(device);
+    if (row_splits.NumDims() != 1 || row_splits.GetLength() < 2) {
+        utility::LogError(
+                "row_splits must have shape (num_batches + 1,), but got {}.",
+                row_splits.GetShape().ToString());
+    }
+    int64_t n = points.GetLength();
+    int64_t num_batches = row_splits.GetLength() - 1;
+    if (row_splits[num_batches].Item<int64_t>() != n) {
+        utility::LogError("row_splits got {} points, but points got {} points.",
+                          row_splits[num_batches].Item<int64_t>(), n);
+    }
+    if (features.has_value()) {
+        features.value().AssertDtype(core::Dtype::Float32);
+        features.value().AssertDevice(device);
+        if (features.value().NumDims() != 2 ||
+            features.value().GetLength() != n) {
+            utility::LogError("features must have shape (N, d), but got {}.",
+                              features.value().GetShape().ToString());
+        }
+    }
+    if (classes.has_value()) {
+        classes.value().AssertDtype(core::Dtype::Int32);
+        classes.value().AssertDevice(device);
+        classes.value().AssertShape({n});
+    }
+
+    core::Tensor sub_points, sub_features, sub_classes;
+    if (n == 0) {
+        sub_points = core::Tensor::Empty({0, 3}, core::Dtype::Float32, device);
+        if (features.has_value()) {
+            sub_features = features.value().Copy();
+        }
+        if (classes.has_value()) {
+            sub_classes = classes.value().Copy();
+        }
+        return std::make_tuple(sub_points, row_splits.Copy(), sub_features,
+                               sub_classes);
+    }
+
+    // The voxel key is (x, y, z, batch), so that the voxels of all the
+    // batches share one hashmap.
+    core::Tensor batch_ids;
+    pointcloud::SegmentIdsFromRowSplits(row_splits, batch_ids);
+    core::Tensor keys = core::Tensor::Empty({n, 4}, core::Dtype::Int32, device);
+    keys.Slice(1, 0, 3) = points.Div(sampleDl).Floor().To(core::Dtype::Int32);
+    keys.Slice(1, 3, 4) = batch_ids.View({n, 1}).To(core::Dtype::Int32);
+
+    core::Hashmap voxel_map(n, core::Dtype::Int32, core::Dtype::Int32, {4},
+                            {1}, device);
+    core::Tensor addrs, masks;
+    voxel_map.InsertOrFind(keys, addrs, masks);
+    core::Tensor active_addrs;
+    voxel_map.GetActiveIndices(active_addrs);
+    active_addrs = active_addrs.To(core::Dtype::Int64);
+    int64_t num_voxels = active_addrs.GetLength();
+
+    // Order the voxels by batch, which gives the output row splits.
+    core::Tensor voxel_batch_ids = voxel_map.GetKeyTensor()
+                                           .IndexGet({active_addrs})
+                                           .Slice(1, 3, 4)
+                                           .Contiguous()
+                                           .View({num_voxels})
+                                           .To(core::Dtype::Int64);
+    core::Tensor sub_row_splits, voxel_order;
+    pointcloud::SortBySegment(voxel_batch_ids, num_batches, sub_row_splits,
+                              voxel_order);
+
+    // Map the buffer address of each voxel to its output row.
+    core::Tensor segment_of_addr = core::Tensor::Empty(
+            {voxel_map.GetCapacity()}, core::Dtype::Int64, device);
+    segment_of_addr.IndexSet({active_addrs.IndexGet({voxel_order})},
+                             core::Tensor::Arange(0, num_voxels, 1,
+                                                  core::Dtype::Int64, device));
+    core::Tensor segment_ids =
+            segment_of_addr.IndexGet({addrs.To(core::Dtype::Int64)});
+
+    core::Tensor offsets, order;
+    pointcloud::SortBySegment(segment_ids, num_voxels, offsets, order);
+    pointcloud::SegmentMean(points.Contiguous(), offsets, order, sub_points);
+    if (features.has_value()) {
+        pointcloud::SegmentMean(features.value().Contiguous(), offsets, order,
+                                sub_features);
+    }
+    if (classes.has_value()) {
+        pointcloud::SegmentMode(classes.value().Contiguous(), offsets, order,
+                                sub_classes);
+    }
+
+    // Keep the first max_p voxels of the larger batches. The row splits are
+    // small, so the selection is built on the host.
+    if (max_p > 0) {
+        std::vector<int64_t> splits = sub_row_splits.ToFlatVector<int64_t>();
+        std::vector<int64_t> kept_splits(num_batches + 1, 0);
+        core::Tensor keep =
+                core::Tensor::Zeros({num_voxels}, core::Dtype::Bool, device);
+        for (int64_t b = 0; b < num_batches; ++b) {
+            int64_t count = std::min<int64_t>(splits[b + 1] - splits[b], max_p);
+            keep.Slice(0, splits[b], splits[b] + count).Fill(true);
+            kept_splits[b + 1] = kept_splits[b] + count;
+        }
+        if (kept_splits[num_batches] < num_voxels) {
+            core::Tensor indices = keep.NonZero()[0];
+            sub_points = sub_points.IndexGet({indices});
+            if (features.has_value()) {
+                sub_features = sub_features.IndexGet({indices});
+            }
+            if (classes.has_value()) {
+                sub_classes = sub_classes.IndexGet({indices});
+            }
+            sub_row_splits = core::Tensor(kept_splits, {num_batches + 1},
+                                          core::Dtype::Int64, device);
+        }
+    }
+
+    return std::make_tuple(sub_points, sub_row_splits, sub_features,
+                           sub_classes);
+}
+
+}  // namespace contrib
+}  // namespace ml
+}  // namespace open3d
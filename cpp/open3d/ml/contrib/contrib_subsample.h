@@ -0,0 +1,67 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <tuple>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/Optional.h"
+
+namespace open3d {
+namespace ml {
+namespace contrib {
+
+/// Grid subsampling of a batch of point clouds, the Tensor counterpart of
+/// batch_grid_subsampling. Runs on the device of the points: the voxels of
+/// all the batches are deduplicated in one core::Hashmap keyed by the voxel
+/// coordinates and the batch index, so there is no host round trip besides
+/// the row splits.
+///
+/// \param points Tensor of shape {n, 3}, dtype Float32.
+/// \param row_splits Tensor of shape {num_batches + 1,}, dtype Int64. The
+/// points of batch b are points[row_splits[b]:row_splits[b + 1]].
+/// \param features Optional Tensor of shape {n, d}, dtype Float32, averaged
+/// over each voxel.
+/// \param classes Optional Tensor of shape {n,}, dtype Int32, with the most
+/// frequent class of each voxel.
+/// \param sampleDl Voxel size.
+/// \param max_p If positive, keeps at most max_p voxels per batch.
+/// \return Tuple of Tensors (subsampled_points, subsampled_row_splits,
+/// subsampled_features, subsampled_classes), grouped by batch like the input.
+/// The features and classes are empty Tensors if not given.
+std::tuple<core::Tensor, core::Tensor, core::Tensor, core::Tensor>
+BatchGridSubsampling(const core::Tensor& points,
+                     const core::Tensor& row_splits,
+                     const utility::optional<core::Tensor>& features,
+                     const utility::optional<core::Tensor>& classes,
+                     float sampleDl,
+                     int max_p = 0);
+
+}  // namespace contrib
+}  // namespace ml
+}  // namespace open3d
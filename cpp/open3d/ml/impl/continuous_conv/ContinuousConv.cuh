@@ -31,6 +31,8 @@
 #include <cutlass/gemm/gemm.h>
 #include <cutlass/gemm/sgemm_traits.h>
 
+#include <type_traits>
+
 #include "open3d/ml/impl/continuous_conv/ContinuousConvCUDAKernels.h"
 #include "open3d/ml/impl/misc/MemoryAllocation.h"
 #include "open3d/utility/Helper.h"
@@ -127,20 +129,25 @@ namespace impl {
 ///        number of points (neighbors_importance is null) or by the sum of
 ///        the respective values in neighbors_importance.
 ///
-template <class TReal, class TIndex>
+/// \tparam TFeat    The type of the filter, input and output features.
+///         Either float or __half. Half precision values are converted to
+///         TReal buffers in the temporary memory and the matrix
+///         multiplication accumulates with TReal precision.
+///
+template <class TFeat, class TReal, class TIndex>
 void CConvComputeFeaturesCUDA(const cudaStream_t& stream,
                               void* temp,
                               size_t& temp_size,
                               size_t& max_temp_size,
                               int texture_alignment,
-                              TReal* out_features,
+                              TFeat* out_features,
                               const std::vector<int>& filter_dims,
-                              const TReal* filter,
+                              const TFeat* filter,
                               TIndex num_out,
                               const TReal* out_positions,
                               TIndex num_inp,
                               const TReal* inp_positions,
-                              const TReal* inp_features,
+                              const TFeat* inp_features,
                               const TReal* inp_importance,
                               size_t neighbors_index_size,
                               const TIndex* neighbors_index,
@@ -169,12 +176,23 @@ void CConvComputeFeaturesCUDA(const cudaStream_t& stream,
     int spatial_filter_size = 1;
     for (int i = 0; i < 3; ++i) spatial_filter_size *= filter_dims[i];
 
+    // half precision filters are converted to a TReal buffer. The outputs
+    // are accumulated in a TReal tile for each run and then converted.
+    const bool convert_feat = !std::is_same<TFeat, TReal>::value;
+    const size_t filter_size =
+            size_t(spatial_filter_size) * in_channels * out_channels;
+    std::pair<TReal*, size_t> filter_real(nullptr, 0);
+    if (convert_feat) {
+        filter_real = mem_temp.Alloc<TReal>(filter_size);
+    }
+
     // this defines how much temporary storage we need at least.
     // we want to allocate memory for at least 32 output points.
     const size_t min_num_cols_per_run = std::min(size_t(num_out), size_t(32));
     const size_t max_num_cols_per_run = num_out;
-    const size_t bytes_per_column =
+    size_t bytes_per_column =
             sizeof(TReal) * (spatial_filter_size * in_channels);
+    if (convert_feat) bytes_per_column += sizeof(TReal) * out_channels;
     const size_t min_temp_size_bytes = min_num_cols_per_run * bytes_per_column;
     const size_t max_temp_size_bytes = max_num_cols_per_run * bytes_per_column;
 
@@ -198,9 +216,17 @@ void CConvComputeFeaturesCUDA(const cudaStream_t& stream,
         throw std::runtime_error(ss.str());
     }
 
-    // init output
-    cudaMemsetAsync(out_features, 0, sizeof(TReal) * num_out * out_channels,
-                    stream);
+    const TReal* filter_ptr = (const TReal*)filter;
+    if (convert_feat) {
+        ConvertArray<TReal, TFeat>(stream, filter_size, filter_real.first,
+                                   filter);
+        filter_ptr = filter_real.first;
+    } else {
+        // init output
+        cudaMemsetAsync(out_features, 0,
+                        sizeof(TReal) * size_t(num_out) * out_channels,
+                        stream);
+    }
 
     size_t num_cols_per_run =
             std::min(mem_columns.second / bytes_per_column, size_t(num_out));
@@ -217,6 +243,9 @@ void CConvComputeFeaturesCUDA(const cudaStream_t& stream,
 
     // this is the pointer to the patch matrix
     TReal* columns = (TReal*)mem_columns.first;
+    // the TReal output tile used for half precision outputs
+    TReal* out_tile = columns + num_cols_per_run * spatial_filter_size *
+                                        in_channels;
 
     // if we cannot process all data at once we need multiple runs
     const size_t num_runs = DivUp(num_out, num_cols_per_run);
@@ -227,7 +256,7 @@ void CConvComputeFeaturesCUDA(const cudaStream_t& stream,
         const size_t num_cols_this_run = end_idx - begin_idx;
 
         // compute the patch matrix
-        FillColumn<TReal, TIndex>(
+        FillColumn<TFeat, TReal, TIndex>(
                 stream, columns, in_channels, begin_idx, end_idx, num_out,
                 out_positions, num_inp, inp_positions, inp_features,
                 inp_importance, neighbors_index_size, neighbors_index,
@@ -242,12 +271,18 @@ void CConvComputeFeaturesCUDA(const cudaStream_t& stream,
         int k = spatial_filter_size * in_channels;
         int n = num_cols_this_run;
         float alpha = 1;
-        const float* const A = filter;
+        const float* const A = filter_ptr;
         int lda = m;
         const float* const B = columns;
         int ldb = k;
         float beta = 1;
-        float* C = out_features + (run_i * num_cols_per_run * out_channels);
+        float* C = (TReal*)out_features +
+                   (run_i * num_cols_per_run * out_channels);
+        if (convert_feat) {
+            C = out_tile;
+            cudaMemsetAsync(C, 0, sizeof(TReal) * num_cols_this_run * m,
+                            stream);
+        }
         int ldc = m;
 
         typename Gemm::Params params;
@@ -271,6 +306,13 @@ void CConvComputeFeaturesCUDA(const cudaStream_t& stream,
         }
 
         Gemm::launch(params, stream);
+
+        if (convert_feat) {
+            ConvertArray<TFeat, TReal>(
+                    stream, num_cols_this_run * out_channels,
+                    out_features + (run_i * num_cols_per_run * out_channels),
+                    out_tile);
+        }
     }
 }
 
@@ -30,6 +30,8 @@
 #include <cutlass/gemm/gemm.h>
 #include <cutlass/gemm/sgemm_traits.h>
 
+#include <type_traits>
+
 #include "open3d/ml/impl/continuous_conv/ContinuousConvCUDAKernels.h"
 #include "open3d/ml/impl/misc/MemoryAllocation.h"
 #include "open3d/utility/Helper.h"
@@ -124,19 +126,24 @@ namespace impl {
 ///        by the number of points (neighbors_importance is null) or by the sum
 ///        of the respective values in neighbors_importance.
 ///
-template <class TReal, class TIndex>
+/// \tparam TFeat    The type of the filter gradient, input features and
+///         output feature gradients. Either float or __half. Half precision
+///         values are converted to TReal buffers in the temporary memory and
+///         the matrix multiplication accumulates with TReal precision.
+///
+template <class TFeat, class TReal, class TIndex>
 void CConvBackpropFilterCUDA(const cudaStream_t& stream,
                              void* temp,
                              size_t& temp_size,
                              size_t& max_temp_size,
                              int texture_alignment,
-                             TReal* filter_backprop,
+                             TFeat* filter_backprop,
                              const std::vector<int>& filter_dims,
                              TIndex num_out,
                              const TReal* out_positions,
                              TIndex num_inp,
                              const TReal* inp_positions,
-                             const TReal* inp_features,
+                             const TFeat* inp_features,
                              const TReal* inp_importance,
                              size_t neighbors_index_size,
                              const TIndex* neighbors_index,
@@ -144,7 +151,7 @@ void CConvBackpropFilterCUDA(const cudaStream_t& stream,
                              const int64_t* neighbors_row_splits,
                              const TReal* extents,
                              const TReal* offsets,
-                             const TReal* out_features_gradient,
+                             const TFeat* out_features_gradient,
                              InterpolationMode interpolation,
                              CoordinateMapping coordinate_mapping,
                              bool align_corners,
@@ -166,12 +173,23 @@ void CConvBackpropFilterCUDA(const cudaStream_t& stream,
     int spatial_filter_size = 1;
     for (int i = 0; i < 3; ++i) spatial_filter_size *= filter_dims[i];
 
+    // half precision filter gradients are accumulated in a TReal buffer.
+    // The output feature gradients are converted to a TReal tile per run.
+    const bool convert_feat = !std::is_same<TFeat, TReal>::value;
+    const size_t filter_size =
+            size_t(spatial_filter_size) * in_channels * out_channels;
+    std::pair<TReal*, size_t> filter_backprop_real(nullptr, 0);
+    if (convert_feat) {
+        filter_backprop_real = mem_temp.Alloc<TReal>(filter_size);
+    }
+
     // this defines how much temporary storage we need at least
     // we want to allocate memory for at least 32 output points.
     const size_t min_num_cols_per_run = std::min(size_t(num_out), size_t(32));
     const size_t max_num_cols_per_run = num_out;
-    const size_t bytes_per_column =
+    size_t bytes_per_column =
             sizeof(TReal) * (spatial_filter_size * in_channels);
+    if (convert_feat) bytes_per_column += sizeof(TReal) * out_channels;
     const size_t min_temp_size_bytes = min_num_cols_per_run * bytes_per_column;
     const size_t max_temp_size_bytes = max_num_cols_per_run * bytes_per_column;
 
@@ -195,11 +213,12 @@ void CConvBackpropFilterCUDA(const cudaStream_t& stream,
         throw std::runtime_error(ss.str());
     }
 
+    TReal* filter_backprop_ptr = (TReal*)filter_backprop;
+    if (convert_feat) filter_backprop_ptr = filter_backprop_real.first;
+
     // init output
-    cudaMemsetAsync(
-            filter_backprop, 0,
-            sizeof(TReal) * spatial_filter_size * in_channels * out_channels,
-            stream);
+    cudaMemsetAsync(filter_backprop_ptr, 0, sizeof(TReal) * filter_size,
+                    stream);
 
     size_t num_cols_per_run =
             std::min(mem_columns.second / bytes_per_column, size_t(num_out));
@@ -214,6 +233,9 @@ void CConvBackpropFilterCUDA(const cudaStream_t& stream,
     typedef cutlass::gemm::Gemm<GemmTraits> Gemm;
 
     TReal* columns = (TReal*)mem_columns.first;
+    // the TReal gradient tile used for half precision gradients
+    TReal* gradient_tile = columns + num_cols_per_run * spatial_filter_size *
+                                             in_channels;
 
     // if we cannot process all data at once we need multiple runs
     size_t num_runs = DivUp(num_out, num_cols_per_run);
@@ -223,7 +245,7 @@ void CConvBackpropFilterCUDA(const cudaStream_t& stream,
                 std::min(size_t(num_out), (run_i + 1) * num_cols_per_run);
         const size_t num_cols_this_run = end_idx - begin_idx;
 
-        FillColumn<TReal, TIndex>(
+        FillColumn<TFeat, TReal, TIndex>(
                 stream, columns, in_channels, begin_idx, end_idx, num_out,
                 out_positions, num_inp, inp_positions, inp_features,
                 inp_importance, neighbors_index_size, neighbors_index,
@@ -239,13 +261,20 @@ void CConvBackpropFilterCUDA(const cudaStream_t& stream,
         int k = num_cols_this_run;
         int n = spatial_filter_size * in_channels;
         float alpha = 1;
-        const float* const A = out_features_gradient +
-                               (run_i * num_cols_per_run * out_channels);
+        const float* A = (const TReal*)out_features_gradient +
+                         (run_i * num_cols_per_run * out_channels);
+        if (convert_feat) {
+            ConvertArray<TReal, TFeat>(
+                    stream, num_cols_this_run * out_channels, gradient_tile,
+                    out_features_gradient +
+                            (run_i * num_cols_per_run * out_channels));
+            A = gradient_tile;
+        }
         int lda = m;
         const float* const B = columns;
         int ldb = n;
         float beta = 1;
-        float* C = filter_backprop;
+        float* C = filter_backprop_ptr;
         int ldc = m;
 
         int result = params.initialize(m,      // GEMM M dimension
@@ -269,6 +298,11 @@ void CConvBackpropFilterCUDA(const cudaStream_t& stream,
 
         Gemm::launch(params, stream);
     }
+
+    if (convert_feat) {
+        ConvertArray<TFeat, TReal>(stream, filter_size, filter_backprop,
+                                   filter_backprop_ptr);
+    }
 }
 
 }  // namespace impl
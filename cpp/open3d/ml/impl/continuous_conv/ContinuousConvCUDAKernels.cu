@@ -33,8 +33,17 @@ namespace open3d {
 namespace ml {
 namespace impl {
 
+namespace {
+
+/// Loads a feature value for computing with float precision.
+__device__ inline float LoadFeature(float x) { return x; }
+__device__ inline float LoadFeature(__half x) { return __half2float(x); }
+
+}  // namespace
+
 /// Kernel for FillColumn
-template <class TReal,
+template <class TFeat,
+          class TReal,
           class TIndex,
           bool ALIGN_CORNERS,
           CoordinateMapping MAPPING,
@@ -48,7 +57,7 @@ __global__ void FillColumnKernel(
         const TReal* const __restrict__ out_positions,
         TIndex num_inp,
         const TReal* const __restrict__ inp_positions,
-        const TReal* const __restrict__ inp_features,
+        const TFeat* const __restrict__ inp_features,
         const TReal* const __restrict__ inp_importance,
         size_t neighbors_index_size,
         const TIndex* const __restrict__ neighbors_index,
@@ -151,7 +160,8 @@ __global__ void FillColumnKernel(
         if (NORMALIZE && normalizer != 0) importance /= normalizer;
 
         for (int ic = threadIdx.x; ic < in_channels; ic += blockDim.x) {
-            infeat = importance * inp_features[inp_idx * in_channels + ic];
+            infeat = importance *
+                     LoadFeature(inp_features[inp_idx * in_channels + ic]);
             for (int j = 0; j < NUM_INTERP_VALUES; ++j) {
                 TReal value = interp_weights[j] * infeat;
                 out_column[interp_indices[j] * in_channels + ic] += value;
@@ -160,7 +170,7 @@ __global__ void FillColumnKernel(
     }  // for n
 }
 
-template <class TReal, class TIndex>
+template <class TFeat, class TReal, class TIndex>
 void FillColumn(const cudaStream_t& stream,
                 TReal* columns,
                 int in_channels,
@@ -170,7 +180,7 @@ void FillColumn(const cudaStream_t& stream,
                 const TReal* const __restrict__ out_positions,
                 TIndex num_inp,
                 const TReal* const __restrict__ inp_positions,
-                const TReal* const __restrict__ inp_features,
+                const TFeat* const __restrict__ inp_features,
                 const TReal* const __restrict__ inp_importance,
                 size_t neighbors_index_size,
                 const TIndex* const __restrict__ neighbors_index,
@@ -212,7 +222,8 @@ void FillColumn(const cudaStream_t& stream,
 #define CALL_TEMPLATE(INTERPOLATION, MAPPING, ALIGN_CORNERS)                   \
     if (INTERPOLATION == interpolation && MAPPING == coordinate_mapping &&     \
         ALIGN_CORNERS == align_corners)                                        \
-        FillColumnKernel<TReal, TIndex, ALIGN_CORNERS, MAPPING, INTERPOLATION> \
+        FillColumnKernel<TFeat, TReal, TIndex, ALIGN_CORNERS, MAPPING,         \
+                         INTERPOLATION>                                        \
                 <<<grid, block, 0, stream>>>(FN_PARAMETERS);
 
 #define CALL_TEMPLATE2(INTERPOLATION, MAPPING)  \
@@ -243,33 +254,31 @@ void FillColumn(const cudaStream_t& stream,
 #undef FN_PARAMETERS
 }
 
-template void FillColumn<float, int32_t>(
-        const cudaStream_t& stream,
-        float* columns,
-        int in_channels,
-        int32_t begin_idx,
-        int32_t end_idx,
-        int32_t num_out,
-        const float* const __restrict__ out_positions,
-        int32_t num_inp,
-        const float* const __restrict__ inp_positions,
-        const float* const __restrict__ inp_features,
-        const float* const __restrict__ inp_importance,
-        size_t neighbors_index_size,
-        const int32_t* const __restrict__ neighbors_index,
-        const float* const __restrict__ neighbors_importance,
-        const int64_t* const __restrict__ neighbors_row_splits,
-        const float* const __restrict__ extents,
-        const float* const __restrict__ offsets,
-        const std::vector<int>& filter_dims,
-        InterpolationMode interpolation,
-        CoordinateMapping coordinate_mapping,
-        bool align_corners,
-        bool individual_extent,
-        bool isotropic_extent,
-        bool normalize);
-
-template <class TReal,
+#define INSTANTIATE(TFeat)                                                  \
+    template void FillColumn<TFeat, float, int32_t>(                        \
+            const cudaStream_t& stream, float* columns, int in_channels,    \
+            int32_t begin_idx, int32_t end_idx, int32_t num_out,            \
+            const float* const __restrict__ out_positions, int32_t num_inp, \
+            const float* const __restrict__ inp_positions,                  \
+            const TFeat* const __restrict__ inp_features,                   \
+            const float* const __restrict__ inp_importance,                 \
+            size_t neighbors_index_size,                                    \
+            const int32_t* const __restrict__ neighbors_index,              \
+            const float* const __restrict__ neighbors_importance,           \
+            const int64_t* const __restrict__ neighbors_row_splits,         \
+            const float* const __restrict__ extents,                        \
+            const float* const __restrict__ offsets,                        \
+            const std::vector<int>& filter_dims,                            \
+            InterpolationMode interpolation,                                \
+            CoordinateMapping coordinate_mapping, bool align_corners,       \
+            bool individual_extent, bool isotropic_extent, bool normalize);
+
+INSTANTIATE(float)
+INSTANTIATE(__half)
+#undef INSTANTIATE
+
+template <class TFeat,
+          class TReal,
           class TIndex,
           bool ALIGN_CORNERS,
           CoordinateMapping MAPPING,
@@ -283,7 +292,7 @@ __global__ void FillColumnTransposeKernel(
         const TReal* const __restrict__ out_positions,
         TIndex num_inp,
         const TReal* const __restrict__ inp_positions,
-        const TReal* const __restrict__ inp_features,
+        const TFeat* const __restrict__ inp_features,
         size_t neighbors_index_size,
         const TIndex* const __restrict__ neighbors_index,
         const TReal* const __restrict__ inp_neighbors_importance_sum,
@@ -383,7 +392,7 @@ __global__ void FillColumnTransposeKernel(
 
         TReal infeat = 0;
         for (int ic = threadIdx.x; ic < in_channels; ic += blockDim.x) {
-            infeat = inp_features[inp_idx * in_channels + ic];
+            infeat = LoadFeature(inp_features[inp_idx * in_channels + ic]);
             if (NEIGHBOR_IMPORTANCE) infeat *= neighbors_importance[n_idx];
             if (NORMALIZE) infeat *= num_inp_neighbors_normalizer;
             for (int j = 0; j < NUM_INTERP_VALUES; ++j) {
@@ -394,7 +403,7 @@ __global__ void FillColumnTransposeKernel(
     }  // for n
 }
 
-template <class TReal, class TIndex>
+template <class TFeat, class TReal, class TIndex>
 void FillColumnTranspose(
         const cudaStream_t& stream,
         TReal* columns,
@@ -405,7 +414,7 @@ void FillColumnTranspose(
         const TReal* const __restrict__ out_positions,
         TIndex num_inp,
         const TReal* const __restrict__ inp_positions,
-        const TReal* const __restrict__ inp_features,
+        const TFeat* const __restrict__ inp_features,
         const TReal* const __restrict__ inp_neighbors_importance_sum,
         const int64_t* const __restrict__ inp_neighbors_prefix_sum,
         size_t neighbors_index_size,
@@ -450,8 +459,8 @@ void FillColumnTranspose(
 #define CALL_TEMPLATE(INTERPOLATION, MAPPING, ALIGN_CORNERS)               \
     if (INTERPOLATION == interpolation && MAPPING == coordinate_mapping && \
         ALIGN_CORNERS == align_corners)                                    \
-        FillColumnTransposeKernel<TReal, TIndex, ALIGN_CORNERS, MAPPING,   \
-                                  INTERPOLATION>                           \
+        FillColumnTransposeKernel<TFeat, TReal, TIndex, ALIGN_CORNERS,     \
+                                  MAPPING, INTERPOLATION>                  \
                 <<<grid, block, 0, stream>>>(FN_PARAMETERS);
 
 #define CALL_TEMPLATE2(INTERPOLATION, MAPPING)  \
@@ -482,32 +491,29 @@ void FillColumnTranspose(
 #undef FN_PARAMETERS
 }
 
-template void FillColumnTranspose<float, int32_t>(
-        const cudaStream_t& stream,
-        float* columns,
-        int in_channels,
-        int32_t begin_idx,
-        int32_t end_idx,
-        int32_t num_out,
-        const float* const __restrict__ out_positions,
-        int32_t num_inp,
-        const float* const __restrict__ inp_positions,
-        const float* const __restrict__ inp_features,
-        const float* const __restrict__ inp_neighbors_importance_sum,
-        const int64_t* const __restrict__ inp_neighbors_prefix_sum,
-        size_t neighbors_index_size,
-        const int32_t* const __restrict__ neighbors_index,
-        const float* const __restrict__ neighbors_importance,
-        const int64_t* const __restrict__ neighbors_row_splits,
-        const float* const __restrict__ extents,
-        const float* const __restrict__ offsets,
-        const std::vector<int>& filter_dims,
-        InterpolationMode interpolation,
-        CoordinateMapping coordinate_mapping,
-        bool align_corners,
-        bool individual_extent,
-        bool isotropic_extent,
-        bool normalize);
+#define INSTANTIATE(TFeat)                                                  \
+    template void FillColumnTranspose<TFeat, float, int32_t>(               \
+            const cudaStream_t& stream, float* columns, int in_channels,    \
+            int32_t begin_idx, int32_t end_idx, int32_t num_out,            \
+            const float* const __restrict__ out_positions, int32_t num_inp, \
+            const float* const __restrict__ inp_positions,                  \
+            const TFeat* const __restrict__ inp_features,                   \
+            const float* const __restrict__ inp_neighbors_importance_sum,   \
+            const int64_t* const __restrict__ inp_neighbors_prefix_sum,     \
+            size_t neighbors_index_size,                                    \
+            const int32_t* const __restrict__ neighbors_index,              \
+            const float* const __restrict__ neighbors_importance,           \
+            const int64_t* const __restrict__ neighbors_row_splits,         \
+            const float* const __restrict__ extents,                        \
+            const float* const __restrict__ offsets,                        \
+            const std::vector<int>& filter_dims,                            \
+            InterpolationMode interpolation,                                \
+            CoordinateMapping coordinate_mapping, bool align_corners,       \
+            bool individual_extent, bool isotropic_extent, bool normalize);
+
+INSTANTIATE(float)
+INSTANTIATE(__half)
+#undef INSTANTIATE
 
 template <class T>
 __global__ void MultiplyColumnsKernel(size_t rows,
@@ -588,6 +594,51 @@ template void MultiplyAndCopyColumns<float>(
         const float* const __restrict__ col_major_matrix,
         const float* const __restrict__ vector);
 
+namespace {
+
+__device__ inline void StoreValue(float* out, float x) { *out = x; }
+__device__ inline void StoreValue(__half* out, float x) {
+    *out = __float2half(x);
+}
+
+}  // namespace
+
+template <class TOut, class TIn>
+__global__ void ConvertArrayKernel(size_t size,
+                                   TOut* __restrict__ out,
+                                   const TIn* const __restrict__ in) {
+    size_t idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (idx >= size) return;
+
+    StoreValue(out + idx, LoadFeature(in[idx]));
+}
+
+template <class TOut, class TIn>
+void ConvertArray(const cudaStream_t& stream,
+                  size_t size,
+                  TOut* __restrict__ out,
+                  const TIn* const __restrict__ in) {
+    const int BLOCKSIZE = 128;
+    dim3 block(BLOCKSIZE, 1, 1);
+    dim3 grid(0, 1, 1);
+    grid.x = DivUp(size, BLOCKSIZE);
+
+    if (grid.x) {
+        ConvertArrayKernel<TOut, TIn>
+                <<<grid, block, 0, stream>>>(size, out, in);
+    }
+}
+
+#define INSTANTIATE(TOut, TIn)                                         \
+    template void ConvertArray<TOut, TIn>(                             \
+            const cudaStream_t& stream, size_t size,                   \
+            TOut* __restrict__ out, const TIn* const __restrict__ in);
+
+INSTANTIATE(float, float)
+INSTANTIATE(float, __half)
+INSTANTIATE(__half, float)
+#undef INSTANTIATE
+
 }  // namespace impl
 }  // namespace ml
 }  // namespace open3d
@@ -26,6 +26,8 @@
 
 #pragma once
 
+#include <cuda_fp16.h>
+
 #include <vector>
 
 #include "open3d/ml/impl/continuous_conv/CoordinateTransformation.cuh"
@@ -37,7 +39,9 @@ namespace impl {
 /// Copies and transforms the features to a column, which can be multiplied
 /// with the filter matrix.
 ///
-/// \tparam TReal    Type for positions and features.
+/// \tparam TFeat    Type for the input features. Either float or __half.
+///         The columns are always computed with type TReal.
+/// \tparam TReal    Type for positions and columns.
 /// \tparam TIndex    Type for addressing neighbors.
 ///
 /// \param columns    Output array with shape
@@ -110,7 +114,7 @@ namespace impl {
 ///        number of points (neighbors_importance is null) or by the sum of
 ///        the respective values in neighbors_importance.
 ///
-template <class TReal, class TIndex>
+template <class TFeat, class TReal, class TIndex>
 void FillColumn(const cudaStream_t& stream,
                 TReal* columns,
                 int in_channels,
@@ -120,7 +124,7 @@ void FillColumn(const cudaStream_t& stream,
                 const TReal* const __restrict__ out_positions,
                 TIndex num_inp,
                 const TReal* const __restrict__ inp_positions,
-                const TReal* const __restrict__ inp_features,
+                const TFeat* const __restrict__ inp_features,
                 const TReal* const __restrict__ inp_importance,
                 size_t neighbors_index_size,
                 const TIndex* const __restrict__ neighbors_index,
@@ -136,7 +140,7 @@ void FillColumn(const cudaStream_t& stream,
                 bool isotropic_extent,
                 bool normalize);
 
-template <class TReal, class TIndex>
+template <class TFeat, class TReal, class TIndex>
 void FillColumnTranspose(
         const cudaStream_t& stream,
         TReal* columns,
@@ -147,7 +151,7 @@ void FillColumnTranspose(
         const TReal* const __restrict__ out_positions,
         TIndex num_inp,
         const TReal* const __restrict__ inp_positions,
-        const TReal* const __restrict__ inp_features,
+        const TFeat* const __restrict__ inp_features,
         const TReal* const __restrict__ inp_neighbors_importance_sum,
         const int64_t* const __restrict__ inp_neighbors_prefix_sum,
         size_t neighbors_index_size,
@@ -195,6 +199,22 @@ void MultiplyAndCopyColumns(const cudaStream_t& stream,
                             const T* const __restrict__ col_major_matrix,
                             const T* const __restrict__ vector);
 
+/// Converts an array element-wise from type TIn to type TOut. Used to move
+/// half precision features and filters to and from the float buffers used
+/// for accumulation.
+///
+/// \param size    The number of elements.
+///
+/// \param out    The output array with \p size elements.
+///
+/// \param in    The input array with \p size elements.
+///
+template <class TOut, class TIn>
+void ConvertArray(const cudaStream_t& stream,
+                  size_t size,
+                  TOut* __restrict__ out,
+                  const TIn* const __restrict__ in);
+
 }  // namespace impl
 }  // namespace ml
 }  // namespace open3d
@@ -30,6 +30,8 @@
 #include <cutlass/gemm/gemm.h>
 #include <cutlass/gemm/sgemm_traits.h>
 
+#include <type_traits>
+
 #include "open3d/ml/impl/continuous_conv/ContinuousConvCUDAKernels.h"
 #include "open3d/ml/impl/misc/MemoryAllocation.h"
 #include "open3d/utility/Helper.h"
@@ -40,22 +42,26 @@ namespace open3d {
 namespace ml {
 namespace impl {
 
-template <class TReal, class TIndex>
+/// Computes the output features of a transpose continuous convolution.
+/// The filter, input and output features can be float or __half (TFeat).
+/// Half precision values are accumulated in TReal buffers within the
+/// temporary memory.
+template <class TFeat, class TReal, class TIndex>
 void CConvTransposeComputeFeaturesCUDA(
         const cudaStream_t& stream,
         void* temp,
         size_t& temp_size,
         size_t& max_temp_size,
         int texture_alignment,
-        TReal* out_features,
+        TFeat* out_features,
         const std::vector<int>& filter_dims,
-        const TReal* filter,
+        const TFeat* filter,
         TIndex num_out,
         const TReal* out_positions,
         const TReal* out_importance,
         TIndex num_inp,
         const TReal* inp_positions,
-        const TReal* inp_features,
+        const TFeat* inp_features,
         const TReal* inp_neighbors_importance_sum,
         const int64_t* inp_neighbors_prefix_sum,
         size_t neighbors_index_size,
@@ -85,12 +91,23 @@ void CConvTransposeComputeFeaturesCUDA(
     int spatial_filter_size = 1;
     for (int i = 0; i < 3; ++i) spatial_filter_size *= filter_dims[i];
 
+    // half precision filters are converted to a TReal buffer. The outputs
+    // are accumulated in a TReal tile for each run and then converted.
+    const bool convert_feat = !std::is_same<TFeat, TReal>::value;
+    const size_t filter_size =
+            size_t(spatial_filter_size) * in_channels * out_channels;
+    std::pair<TReal*, size_t> filter_real(nullptr, 0);
+    if (convert_feat) {
+        filter_real = mem_temp.Alloc<TReal>(filter_size);
+    }
+
     // this defines how much temporary storage we need at least.
     // we want to allocate memory for at least 32 output points.
     const size_t min_num_cols_per_run = std::min(size_t(num_out), size_t(32));
     const size_t max_num_cols_per_run = num_out;
-    const size_t bytes_per_column =
+    size_t bytes_per_column =
             sizeof(TReal) * (spatial_filter_size * in_channels);
+    if (convert_feat) bytes_per_column += sizeof(TReal) * out_channels;
     const size_t min_temp_size_bytes = min_num_cols_per_run * bytes_per_column;
     const size_t max_temp_size_bytes = max_num_cols_per_run * bytes_per_column;
 
@@ -114,9 +131,17 @@ void CConvTransposeComputeFeaturesCUDA(
         throw std::runtime_error(ss.str());
     }
 
-    // init output
-    cudaMemsetAsync(out_features, 0, sizeof(TReal) * num_out * out_channels,
-                    stream);
+    const TReal* filter_ptr = (const TReal*)filter;
+    if (convert_feat) {
+        ConvertArray<TReal, TFeat>(stream, filter_size, filter_real.first,
+                                   filter);
+        filter_ptr = filter_real.first;
+    } else {
+        // init output
+        cudaMemsetAsync(out_features, 0,
+                        sizeof(TReal) * size_t(num_out) * out_channels,
+                        stream);
+    }
 
     size_t num_cols_per_run =
             std::min(mem_columns.second / bytes_per_column, size_t(num_out));
@@ -131,6 +156,9 @@ void CConvTransposeComputeFeaturesCUDA(
     typedef cutlass::gemm::Gemm<GemmTraits> Gemm;
 
     TReal* columns = (TReal*)mem_columns.first;
+    // the TReal output tile used for half precision outputs
+    TReal* out_tile = columns + num_cols_per_run * spatial_filter_size *
+                                        in_channels;
 
     // if we cannot process all data at once we need multiple runs
     size_t num_runs = DivUp(num_out, num_cols_per_run);
@@ -140,7 +168,7 @@ void CConvTransposeComputeFeaturesCUDA(
                 std::min(size_t(num_out), (run_i + 1) * num_cols_per_run);
         const size_t num_cols_this_run = end_idx - begin_idx;
 
-        FillColumnTranspose<TReal, TIndex>(
+        FillColumnTranspose<TFeat, TReal, TIndex>(
                 stream, columns, in_channels, begin_idx, end_idx, num_out,
                 out_positions, num_inp, inp_positions, inp_features,
                 inp_neighbors_importance_sum, inp_neighbors_prefix_sum,
@@ -157,12 +185,18 @@ void CConvTransposeComputeFeaturesCUDA(
         int k = spatial_filter_size * in_channels;
         int n = num_cols_this_run;
         float alpha = 1;
-        const float* const A = filter;
+        const float* const A = filter_ptr;
         int lda = m;
         const float* const B = columns;
         int ldb = k;
         float beta = 1;
-        float* C = out_features + (run_i * num_cols_per_run * out_channels);
+        float* C = (TReal*)out_features +
+                   (run_i * num_cols_per_run * out_channels);
+        if (convert_feat) {
+            C = out_tile;
+            cudaMemsetAsync(C, 0, sizeof(TReal) * num_cols_this_run * m,
+                            stream);
+        }
         int ldc = m;
 
         int result =
@@ -187,11 +221,18 @@ void CConvTransposeComputeFeaturesCUDA(
         }
 
         Gemm::launch(params, stream);
-    }
 
-    if (out_importance) {
-        MultiplyColumns(stream, out_channels, num_out, out_features,
-                        out_importance);
+        if (out_importance) {
+            MultiplyColumns(stream, out_channels, num_cols_this_run, C,
+                            out_importance + (run_i * num_cols_per_run));
+        }
+
+        if (convert_feat) {
+            ConvertArray<TFeat, TReal>(
+                    stream, num_cols_this_run * out_channels,
+                    out_features + (run_i * num_cols_per_run * out_channels),
+                    out_tile);
+        }
     }
 }
 
@@ -30,6 +30,8 @@
 #include <cutlass/gemm/gemm.h>
 #include <cutlass/gemm/sgemm_traits.h>
 
+#include <type_traits>
+
 #include "open3d/ml/impl/continuous_conv/ContinuousConvCUDAKernels.h"
 #include "open3d/ml/impl/misc/MemoryAllocation.h"
 #include "open3d/utility/Helper.h"
@@ -136,20 +138,25 @@ namespace impl {
 ///        number of points (neighbors_importance is null) or by the sum of
 ///        the respective values in neighbors_importance.
 ///
-template <class TReal, class TIndex>
+/// \tparam TFeat    The type of the filter gradient, input features and
+///         output feature gradients. Either float or __half. Half precision
+///         values are converted to TReal buffers in the temporary memory and
+///         the matrix multiplication accumulates with TReal precision.
+///
+template <class TFeat, class TReal, class TIndex>
 void CConvTransposeBackpropFilterCUDA(const cudaStream_t& stream,
                                       void* temp,
                                       size_t& temp_size,
                                       size_t& max_temp_size,
                                       int texture_alignment,
-                                      TReal* filter_backprop,
+                                      TFeat* filter_backprop,
                                       const std::vector<int>& filter_dims,
                                       TIndex num_out,
                                       const TReal* out_positions,
                                       const TReal* out_importance,
                                       TIndex num_inp,
                                       const TReal* inp_positions,
-                                      const TReal* inp_features,
+                                      const TFeat* inp_features,
                                       const TReal* inp_neighbors_importance_sum,
                                       const int64_t* inp_neighbors_row_splits,
                                       size_t neighbors_index_size,
@@ -158,7 +165,7 @@ void CConvTransposeBackpropFilterCUDA(const cudaStream_t& stream,
                                       const int64_t* neighbors_row_splits,
                                       const TReal* extents,
                                       const TReal* offsets,
-                                      const TReal* out_features_gradient,
+                                      const TFeat* out_features_gradient,
                                       InterpolationMode interpolation,
                                       CoordinateMapping coordinate_mapping,
                                       bool align_corners,
@@ -180,13 +187,24 @@ void CConvTransposeBackpropFilterCUDA(const cudaStream_t& stream,
     int spatial_filter_size = 1;
     for (int i = 0; i < 3; ++i) spatial_filter_size *= filter_dims[i];
 
+    // half precision filter gradients are accumulated in a TReal buffer.
+    // The output feature gradients are converted to a TReal tile per run.
+    const bool convert_feat = !std::is_same<TFeat, TReal>::value;
+    const size_t filter_size =
+            size_t(spatial_filter_size) * in_channels * out_channels;
+    std::pair<TReal*, size_t> filter_backprop_real(nullptr, 0);
+    if (convert_feat) {
+        filter_backprop_real = mem_temp.Alloc<TReal>(filter_size);
+    }
+
     // this defines how much temporary storage we need at least
     // we want to allocate memory for at least 32 output points.
     const size_t min_num_cols_per_run = std::min(size_t(num_out), size_t(32));
     const size_t max_num_cols_per_run = num_out;
     size_t bytes_per_column =
             sizeof(TReal) * (spatial_filter_size * in_channels);
-    if (out_importance) bytes_per_column += sizeof(TReal) * out_channels;
+    if (out_importance || convert_feat)
+        bytes_per_column += sizeof(TReal) * out_channels;
     const size_t min_temp_size_bytes = min_num_cols_per_run * bytes_per_column;
     const size_t max_temp_size_bytes = max_num_cols_per_run * bytes_per_column;
 
@@ -212,10 +230,11 @@ void CConvTransposeBackpropFilterCUDA(const cudaStream_t& stream,
         throw std::runtime_error(ss.str());
     }
 
-    cudaMemsetAsync(
-            filter_backprop, 0,
-            sizeof(TReal) * spatial_filter_size * in_channels * out_channels,
-            stream);
+    TReal* filter_backprop_ptr = (TReal*)filter_backprop;
+    if (convert_feat) filter_backprop_ptr = filter_backprop_real.first;
+
+    cudaMemsetAsync(filter_backprop_ptr, 0, sizeof(TReal) * filter_size,
+                    stream);
 
     typedef cutlass::gemm::SgemmTraits<
             cutlass::MatrixLayout::kColumnMajor,  // layout of A matrix
@@ -238,19 +257,28 @@ void CConvTransposeBackpropFilterCUDA(const cudaStream_t& stream,
                 std::min(size_t(num_out), (run_i + 1) * num_cols_per_run);
         const size_t num_cols_this_run = end_idx - begin_idx;
 
-        if (out_importance) {
+        const TFeat* gradient_this_run =
+                out_features_gradient +
+                (run_i * num_cols_per_run * out_channels);
+        if (convert_feat) {
+            ConvertArray<TReal, TFeat>(stream,
+                                       num_cols_this_run * out_channels,
+                                       gradient, gradient_this_run);
+            if (out_importance) {
+                MultiplyColumns(stream, out_channels, num_cols_this_run,
+                                gradient,
+                                out_importance + (run_i * num_cols_per_run));
+            }
+        } else if (out_importance) {
             MultiplyAndCopyColumns(
                     stream, out_channels, num_cols_this_run, gradient,
-                    out_features_gradient +
-                            (run_i * num_cols_per_run * out_channels),
+                    (const TReal*)gradient_this_run,
                     out_importance + (run_i * num_cols_per_run));
         } else {
-            gradient = const_cast<TReal*>(
-                    out_features_gradient +
-                    (run_i * num_cols_per_run * out_channels));
+            gradient = const_cast<TReal*>((const TReal*)gradient_this_run);
         }
 
-        FillColumnTranspose<TReal, TIndex>(
+        FillColumnTranspose<TFeat, TReal, TIndex>(
                 stream, columns, in_channels, begin_idx, end_idx, num_out,
                 out_positions, num_inp, inp_positions, inp_features,
                 inp_neighbors_importance_sum, inp_neighbors_row_splits,
@@ -272,7 +300,7 @@ void CConvTransposeBackpropFilterCUDA(const cudaStream_t& stream,
         const float* const B = columns;
         int ldb = n;
         float beta = 1;
-        float* C = filter_backprop;
+        float* C = filter_backprop_ptr;
         int ldc = m;
 
         int result =
@@ -297,6 +325,11 @@ void CConvTransposeBackpropFilterCUDA(const cudaStream_t& stream,
 
         Gemm::launch(params, stream);
     }
+
+    if (convert_feat) {
+        ConvertArray<TFeat, TReal>(stream, filter_size, filter_backprop,
+                                   filter_backprop_ptr);
+    }
 }
 
 }  // namespace impl
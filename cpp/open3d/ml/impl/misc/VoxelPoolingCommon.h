@@ -0,0 +1,199 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <cstdint>
+
+namespace open3d {
+namespace ml {
+namespace impl {
+
+enum AccumulationFn { AVERAGE = 0, NEAREST_NEIGHBOR, MAX, CENTER };
+
+#ifdef __CUDACC__
+#define HOST_DEVICE __host__ __device__
+#else
+#define HOST_DEVICE
+#endif
+
+/// Returns the index of the point of a voxel that is closest to the voxel
+/// center. Ties are resolved in favor of the first point in \p point_indices.
+///
+/// \param point_indices    The point indices of all voxels.
+/// \param begin    The start of the voxel in \p point_indices.
+/// \param end    The end of the voxel in \p point_indices.
+/// \param positions    Array with the 3D point positions.
+/// \param voxel_center    The 3D center of the voxel.
+///
+template <class TReal>
+HOST_DEVICE inline int64_t NearestPointToVoxelCenter(
+        const int64_t* const point_indices,
+        int64_t begin,
+        int64_t end,
+        const TReal* const positions,
+        const TReal* const voxel_center) {
+    int64_t nearest = -1;
+    TReal min_sqr_dist = 0;
+    for (int64_t k = begin; k < end; ++k) {
+        const int64_t idx = point_indices[k];
+        TReal sqr_dist = 0;
+        for (int d = 0; d < 3; ++d) {
+            TReal diff = positions[3 * idx + d] - voxel_center[d];
+            sqr_dist += diff * diff;
+        }
+        if (nearest < 0 || sqr_dist < min_sqr_dist) {
+            nearest = idx;
+            min_sqr_dist = sqr_dist;
+        }
+    }
+    return nearest;
+}
+
+/// Computes the pooled position of a voxel.
+///
+/// \param position_fn    AVERAGE, NEAREST_NEIGHBOR or CENTER.
+/// \param nearest    The result of NearestPointToVoxelCenter. Only used for
+///        NEAREST_NEIGHBOR.
+/// \param pooled_position    The output 3D position.
+///
+/// See NearestPointToVoxelCenter for the remaining parameters.
+///
+template <class TReal>
+HOST_DEVICE inline void PoolVoxelPosition(AccumulationFn position_fn,
+                                          const int64_t* const point_indices,
+                                          int64_t begin,
+                                          int64_t end,
+                                          const TReal* const positions,
+                                          const TReal* const voxel_center,
+                                          int64_t nearest,
+                                          TReal* pooled_position) {
+    for (int d = 0; d < 3; ++d) {
+        if (position_fn == AVERAGE) {
+            TReal sum = 0;
+            for (int64_t k = begin; k < end; ++k) {
+                sum += positions[3 * point_indices[k] + d];
+            }
+            pooled_position[d] = sum / (end - begin);
+        } else if (position_fn == NEAREST_NEIGHBOR) {
+            pooled_position[d] = positions[3 * nearest + d];
+        } else {  // CENTER
+            pooled_position[d] = voxel_center[d];
+        }
+    }
+}
+
+/// Computes one channel of the pooled feature of a voxel.
+///
+/// \param feature_fn    AVERAGE, NEAREST_NEIGHBOR or MAX.
+/// \param in_channels    The number of feature channels.
+/// \param features    The array with the point features. The shape is
+///        [num_points, in_channels].
+/// \param channel    The channel to pool.
+/// \param nearest    The result of NearestPointToVoxelCenter. Only used for
+///        NEAREST_NEIGHBOR.
+/// \param pooled_feature    The output feature value.
+/// \param pooling_index    If not null, the output index of the point that
+///        provides the feature value for NEAREST_NEIGHBOR and MAX.
+///
+/// See NearestPointToVoxelCenter for the remaining parameters.
+///
+template <class TFeat>
+HOST_DEVICE inline void PoolVoxelFeature(AccumulationFn feature_fn,
+                                         const int64_t* const point_indices,
+                                         int64_t begin,
+                                         int64_t end,
+                                         int in_channels,
+                                         const TFeat* const features,
+                                         int channel,
+                                         int64_t nearest,
+                                         TFeat* pooled_feature,
+                                         int64_t* pooling_index) {
+    if (feature_fn == AVERAGE) {
+        TFeat sum = 0;
+        for (int64_t k = begin; k < end; ++k) {
+            sum += features[in_channels * point_indices[k] + channel];
+        }
+        *pooled_feature = sum / TFeat(end - begin);
+    } else if (feature_fn == NEAREST_NEIGHBOR) {
+        *pooled_feature = features[in_channels * nearest + channel];
+        if (pooling_index) *pooling_index = nearest;
+    } else {  // MAX
+        int64_t argmax = point_indices[begin];
+        TFeat max_value = features[in_channels * argmax + channel];
+        for (int64_t k = begin + 1; k < end; ++k) {
+            const int64_t idx = point_indices[k];
+            if (features[in_channels * idx + channel] > max_value) {
+                max_value = features[in_channels * idx + channel];
+                argmax = idx;
+            }
+        }
+        *pooled_feature = max_value;
+        if (pooling_index) *pooling_index = argmax;
+    }
+}
+
+/// Backpropagates one channel of the pooled feature gradient of a voxel to
+/// the features of its points. The points of a voxel do not belong to any
+/// other voxel, so voxels can be processed in parallel.
+///
+/// \param features_backprop    The output array with the gradients for the
+///        features. The shape is [num_points, in_channels] and the entries
+///        of points that do not contribute must be zero.
+/// \param pooling_index    The index of the point that provided the feature
+///        value for NEAREST_NEIGHBOR and MAX.
+/// \param pooled_feature_gradient    The gradient of the pooled feature.
+///
+/// See PoolVoxelFeature for the remaining parameters.
+///
+template <class TFeat>
+HOST_DEVICE inline void BackpropVoxelFeature(
+        AccumulationFn feature_fn,
+        const int64_t* const point_indices,
+        int64_t begin,
+        int64_t end,
+        int in_channels,
+        int channel,
+        int64_t pooling_index,
+        TFeat pooled_feature_gradient,
+        TFeat* features_backprop) {
+    if (feature_fn == AVERAGE) {
+        const TFeat grad = pooled_feature_gradient / TFeat(end - begin);
+        for (int64_t k = begin; k < end; ++k) {
+            features_backprop[in_channels * point_indices[k] + channel] = grad;
+        }
+    } else {  // NEAREST_NEIGHBOR or MAX
+        features_backprop[in_channels * pooling_index + channel] =
+                pooled_feature_gradient;
+    }
+}
+
+#undef HOST_DEVICE
+
+}  // namespace impl
+}  // namespace ml
+}  // namespace open3d
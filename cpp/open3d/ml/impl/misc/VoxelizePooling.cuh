@@ -0,0 +1,253 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include "open3d/ml/impl/misc/VoxelPoolingCommon.h"
+#include "open3d/ml/impl/misc/Voxelize.cuh"
+#include "open3d/utility/Helper.h"
+#include "open3d/utility/MiniVec.h"
+
+namespace open3d {
+namespace ml {
+namespace impl {
+
+namespace {
+
+/// Output allocator wrapper that forwards the voxelization outputs and keeps
+/// the pointers for the subsequent pooling pass.
+template <class OUTPUT_ALLOCATOR>
+struct VoxelizeRecorderCUDA {
+    explicit VoxelizeRecorderCUDA(OUTPUT_ALLOCATOR& allocator)
+        : allocator(allocator) {}
+
+    void AllocVoxelCoords(int32_t** ptr, int64_t rows, int64_t cols) {
+        allocator.AllocVoxelCoords(ptr, rows, cols);
+        voxel_coords = *ptr;
+        num_voxels = rows;
+    }
+
+    void AllocVoxelPointIndices(int64_t** ptr, int64_t size) {
+        allocator.AllocVoxelPointIndices(ptr, size);
+        point_indices = *ptr;
+    }
+
+    void AllocVoxelPointRowSplits(int64_t** ptr, int64_t size) {
+        allocator.AllocVoxelPointRowSplits(ptr, size);
+        row_splits = *ptr;
+    }
+
+    OUTPUT_ALLOCATOR& allocator;
+    int64_t num_voxels = 0;
+    int32_t* voxel_coords = nullptr;
+    int64_t* point_indices = nullptr;
+    int64_t* row_splits = nullptr;
+};
+
+template <class TReal, class TFeat>
+__global__ void VoxelPoolingKernel(
+        TReal* out_positions,
+        TFeat* out_features,
+        int64_t* out_pooling_indices,
+        const int32_t* const voxel_coords,
+        const int64_t* const point_indices,
+        const int64_t* const row_splits,
+        const TReal* const positions,
+        const TFeat* const features,
+        int in_channels,
+        const utility::MiniVec<TReal, 3> voxel_size,
+        const utility::MiniVec<TReal, 3> points_range_min,
+        int64_t num_voxels,
+        AccumulationFn position_fn,
+        AccumulationFn feature_fn) {
+    const int64_t v = int64_t(blockDim.x) * blockIdx.x + threadIdx.x;
+    if (v >= num_voxels) return;
+
+    const int64_t begin = row_splits[v];
+    const int64_t end = row_splits[v + 1];
+    TReal center[3];
+    for (int d = 0; d < 3; ++d) {
+        center[d] = points_range_min[d] +
+                    (voxel_coords[3 * v + d] + TReal(0.5)) * voxel_size[d];
+    }
+    int64_t nearest = -1;
+    if (position_fn == NEAREST_NEIGHBOR || feature_fn == NEAREST_NEIGHBOR) {
+        nearest = NearestPointToVoxelCenter(point_indices, begin, end,
+                                            positions, center);
+    }
+    PoolVoxelPosition(position_fn, point_indices, begin, end, positions,
+                      center, nearest, out_positions + 3 * v);
+    for (int c = 0; c < in_channels; ++c) {
+        const int64_t i = v * in_channels + c;
+        PoolVoxelFeature(
+                feature_fn, point_indices, begin, end, in_channels, features,
+                c, nearest, out_features + i,
+                out_pooling_indices ? out_pooling_indices + i : nullptr);
+    }
+}
+
+template <class TFeat>
+__global__ void VoxelPoolingBackpropKernel(
+        TFeat* features_backprop,
+        int in_channels,
+        int64_t num_voxels,
+        const int64_t* const point_indices,
+        const int64_t* const row_splits,
+        const int64_t* const pooling_indices,
+        const TFeat* const pooled_features_gradient,
+        AccumulationFn feature_fn) {
+    const int64_t v = int64_t(blockDim.x) * blockIdx.x + threadIdx.x;
+    if (v >= num_voxels) return;
+
+    for (int c = 0; c < in_channels; ++c) {
+        const int64_t i = v * in_channels + c;
+        BackpropVoxelFeature(feature_fn, point_indices, row_splits[v],
+                             row_splits[v + 1], in_channels, c,
+                             feature_fn == AVERAGE ? -1 : pooling_indices[i],
+                             pooled_features_gradient[i], features_backprop);
+    }
+}
+
+}  // namespace
+
+/// Voxelizes a point cloud and pools the positions and features of the
+/// points in each voxel. This is the CUDA version of VoxelizePoolingCPU.
+///
+/// All pointer arguments point to device memory unless stated
+/// otherwise.
+///
+/// \param stream    The cuda stream for all kernel launches.
+///
+/// \param temp    Pointer to temporary memory. If nullptr then the required
+///        size of temporary memory will be written to \p temp_size and no
+///        work is done.
+///
+/// \param temp_size    The size of the temporary memory in bytes. This is
+///        used as an output if temp is nullptr
+///
+/// \param texture_alignment    The texture alignment in bytes. This is used
+///        for allocating segments within the temporary memory.
+///
+/// \param voxel_size    The edge lengths of the voxel. The shape is [3].
+///        This pointer points to host memory!
+///
+/// \param points_range_min    The lower bound of the domain to be
+///        voxelized. The shape is [3]. This pointer points to host memory!
+///
+/// \param points_range_max    The upper bound of the domain to be
+///        voxelized. The shape is [3]. This pointer points to host memory!
+///
+/// See VoxelizePoolingCPU for the remaining parameters.
+///
+template <class TReal, class TFeat, class OUTPUT_ALLOCATOR>
+void VoxelizePoolingCUDA(const cudaStream_t& stream,
+                         void* temp,
+                         size_t& temp_size,
+                         int texture_alignment,
+                         size_t num_points,
+                         const TReal* const positions,
+                         int in_channels,
+                         const TFeat* const features,
+                         const TReal* const voxel_size,
+                         const TReal* const points_range_min,
+                         const TReal* const points_range_max,
+                         OUTPUT_ALLOCATOR& output_allocator,
+                         AccumulationFn position_fn,
+                         AccumulationFn feature_fn) {
+    using namespace open3d::utility;
+    const bool get_temp_size = !temp;
+
+    VoxelizeRecorderCUDA<OUTPUT_ALLOCATOR> recorder(output_allocator);
+    VoxelizeCUDA<TReal, 3>(stream, temp, temp_size, texture_alignment,
+                           num_points, positions, voxel_size, points_range_min,
+                           points_range_max,
+                           std::numeric_limits<int64_t>::max(),
+                           std::numeric_limits<int64_t>::max(), recorder);
+    if (get_temp_size) {
+        return;
+    }
+    const int64_t num_voxels = recorder.num_voxels;
+
+    TReal* out_positions = nullptr;
+    output_allocator.AllocPooledPositions(&out_positions, num_voxels);
+    TFeat* out_features = nullptr;
+    output_allocator.AllocPooledFeatures(&out_features, num_voxels,
+                                         in_channels);
+    int64_t* out_pooling_indices = nullptr;
+    output_allocator.AllocPoolingIndices(
+            &out_pooling_indices, feature_fn == AVERAGE ? 0 : num_voxels,
+            in_channels);
+
+    if (num_voxels) {
+        const int BLOCKSIZE = 128;
+        dim3 block(BLOCKSIZE, 1, 1);
+        dim3 grid(DivUp(num_voxels, BLOCKSIZE), 1, 1);
+        VoxelPoolingKernel<TReal, TFeat><<<grid, block, 0, stream>>>(
+                out_positions, out_features, out_pooling_indices,
+                recorder.voxel_coords, recorder.point_indices,
+                recorder.row_splits, positions, features, in_channels,
+                MiniVec<TReal, 3>(voxel_size),
+                MiniVec<TReal, 3>(points_range_min), num_voxels, position_fn,
+                feature_fn);
+    }
+}
+
+/// Computes the gradients of the features for VoxelizePoolingCUDA.
+/// All pointer arguments point to device memory.
+///
+/// \param stream    The cuda stream for all kernel launches.
+///
+/// See VoxelizePoolingBackpropCPU for the remaining parameters.
+///
+template <class TFeat>
+void VoxelizePoolingBackpropCUDA(const cudaStream_t& stream,
+                                 TFeat* features_backprop,
+                                 size_t num_points,
+                                 int in_channels,
+                                 int64_t num_voxels,
+                                 const int64_t* const point_indices,
+                                 const int64_t* const row_splits,
+                                 const int64_t* const pooling_indices,
+                                 const TFeat* const pooled_features_gradient,
+                                 AccumulationFn feature_fn) {
+    using namespace open3d::utility;
+    cudaMemsetAsync(features_backprop, 0,
+                    sizeof(TFeat) * num_points * in_channels, stream);
+    if (num_voxels) {
+        const int BLOCKSIZE = 128;
+        dim3 block(BLOCKSIZE, 1, 1);
+        dim3 grid(DivUp(num_voxels, BLOCKSIZE), 1, 1);
+        VoxelPoolingBackpropKernel<TFeat><<<grid, block, 0, stream>>>(
+                features_backprop, in_channels, num_voxels, point_indices,
+                row_splits, pooling_indices, pooled_features_gradient,
+                feature_fn);
+    }
+}
+
+}  // namespace impl
+}  // namespace ml
+}  // namespace open3d
@@ -0,0 +1,253 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <tbb/parallel_for.h>
+
+#include <cstring>
+#include <limits>
+
+#include "open3d/ml/impl/misc/VoxelPoolingCommon.h"
+#include "open3d/ml/impl/misc/Voxelize.h"
+
+namespace open3d {
+namespace ml {
+namespace impl {
+
+namespace {
+
+/// Output allocator wrapper that forwards the voxelization outputs and keeps
+/// the pointers for the subsequent pooling pass.
+template <class OUTPUT_ALLOCATOR>
+struct VoxelizeRecorder {
+    explicit VoxelizeRecorder(OUTPUT_ALLOCATOR& allocator)
+        : allocator(allocator) {}
+
+    void AllocVoxelCoords(int32_t** ptr, int64_t rows, int64_t cols) {
+        allocator.AllocVoxelCoords(ptr, rows, cols);
+        voxel_coords = *ptr;
+        num_voxels = rows;
+    }
+
+    void AllocVoxelPointIndices(int64_t** ptr, int64_t size) {
+        allocator.AllocVoxelPointIndices(ptr, size);
+        point_indices = *ptr;
+    }
+
+    void AllocVoxelPointRowSplits(int64_t** ptr, int64_t size) {
+        allocator.AllocVoxelPointRowSplits(ptr, size);
+        row_splits = *ptr;
+    }
+
+    OUTPUT_ALLOCATOR& allocator;
+    int64_t num_voxels = 0;
+    int32_t* voxel_coords = nullptr;
+    int64_t* point_indices = nullptr;
+    int64_t* row_splits = nullptr;
+};
+
+}  // namespace
+
+/// Voxelizes a point cloud and pools the positions and features of the
+/// points in each voxel in a single pass. The grouping is the same as for
+/// VoxelizeCPU, i.e. voxels are ordered by their linear index and points
+/// outside of the range are ignored. Pooling works on the row splits of the
+/// voxelization and does not need a hash map.
+///
+/// \tparam TReal    Floating-point data type for the point positions.
+///
+/// \tparam TFeat    Data type for the point features.
+///
+/// \tparam OUTPUT_ALLOCATOR    Type of the output_allocator. See
+///         \p output_allocator for more information.
+///
+/// \param num_points    The number of points.
+///
+/// \param positions    Array with the point positions. The shape is
+///        [num_points,3].
+///
+/// \param in_channels    The number of feature channels.
+///
+/// \param features    Array with the point features. The shape is
+///        [num_points,in_channels].
+///
+/// \param voxel_size    The edge lengths of the voxel. The shape is [3].
+///
+/// \param points_range_min    The lower bound of the domain to be voxelized.
+///        The shape is [3].
+///
+/// \param points_range_max    The upper bound of the domain to be voxelized.
+///        The shape is [3].
+///
+/// \param output_allocator    An object that implements the functions of
+///         the output allocator of VoxelizeCPU and the functions
+///         AllocPooledPositions(TReal** ptr, int64_t num),
+///         AllocPooledFeatures(TFeat** ptr, int64_t num, int channels), and
+///         AllocPoolingIndices(int64_t** ptr, int64_t rows, int64_t cols).
+///         The pooling indices store the index of the point that provides
+///         each pooled feature value and have zero rows if \p feature_fn is
+///         AVERAGE. All functions must accept zero size arguments.
+///
+/// \param position_fn    Defines how the pooled position is computed.
+///        AVERAGE computes the center of gravity of the points in a voxel,
+///        NEAREST_NEIGHBOR selects the point closest to the voxel center and
+///        CENTER uses the voxel center.
+///
+/// \param feature_fn    Defines how the pooled features are computed.
+///        AVERAGE computes the average feature vector, NEAREST_NEIGHBOR
+///        selects the feature vector of the point closest to the voxel
+///        center and MAX computes the channel-wise maximum.
+///
+template <class TReal, class TFeat, class OUTPUT_ALLOCATOR>
+void VoxelizePoolingCPU(size_t num_points,
+                        const TReal* const positions,
+                        int in_channels,
+                        const TFeat* const features,
+                        const TReal* const voxel_size,
+                        const TReal* const points_range_min,
+                        const TReal* const points_range_max,
+                        OUTPUT_ALLOCATOR& output_allocator,
+                        AccumulationFn position_fn,
+                        AccumulationFn feature_fn) {
+    VoxelizeRecorder<OUTPUT_ALLOCATOR> recorder(output_allocator);
+    if (num_points) {
+        VoxelizeCPU<TReal, 3>(num_points, positions, voxel_size,
+                              points_range_min, points_range_max,
+                              std::numeric_limits<int64_t>::max(),
+                              std::numeric_limits<int64_t>::max(), recorder);
+    } else {
+        recorder.AllocVoxelCoords(&recorder.voxel_coords, 0, 3);
+        recorder.AllocVoxelPointIndices(&recorder.point_indices, 0);
+        recorder.AllocVoxelPointRowSplits(&recorder.row_splits, 1);
+        recorder.row_splits[0] = 0;
+    }
+    const int64_t num_voxels = recorder.num_voxels;
+
+    TReal* out_positions = nullptr;
+    output_allocator.AllocPooledPositions(&out_positions, num_voxels);
+    TFeat* out_features = nullptr;
+    output_allocator.AllocPooledFeatures(&out_features, num_voxels,
+                                         in_channels);
+    int64_t* out_pooling_indices = nullptr;
+    output_allocator.AllocPoolingIndices(
+            &out_pooling_indices, feature_fn == AVERAGE ? 0 : num_voxels,
+            in_channels);
+
+    const bool need_nearest =
+            position_fn == NEAREST_NEIGHBOR || feature_fn == NEAREST_NEIGHBOR;
+    tbb::parallel_for(
+            tbb::blocked_range<int64_t>(0, num_voxels),
+            [&](const tbb::blocked_range<int64_t>& r) {
+                for (int64_t v = r.begin(); v != r.end(); ++v) {
+                    const int64_t begin = recorder.row_splits[v];
+                    const int64_t end = recorder.row_splits[v + 1];
+                    TReal center[3];
+                    for (int d = 0; d < 3; ++d) {
+                        center[d] = points_range_min[d] +
+                                    (recorder.voxel_coords[3 * v + d] +
+                                     TReal(0.5)) *
+                                            voxel_size[d];
+                    }
+                    const int64_t nearest =
+                            need_nearest ? NearestPointToVoxelCenter(
+                                                   recorder.point_indices,
+                                                   begin, end, positions,
+                                                   center)
+                                         : -1;
+                    PoolVoxelPosition(position_fn, recorder.point_indices,
+                                      begin, end, positions, center, nearest,
+                                      out_positions + 3 * v);
+                    for (int c = 0; c < in_channels; ++c) {
+                        const int64_t i = v * in_channels + c;
+                        PoolVoxelFeature(
+                                feature_fn, recorder.point_indices, begin, end,
+                                in_channels, features, c, nearest,
+                                out_features + i,
+                                out_pooling_indices ? out_pooling_indices + i
+                                                    : nullptr);
+                    }
+                }
+            });
+}
+
+/// Computes the gradients of the features for VoxelizePoolingCPU.
+///
+/// \param features_backprop    The output array with the gradients for the
+///        features. The shape is [num_points,in_channels].
+///
+/// \param num_points    The number of points.
+///
+/// \param in_channels    The number of feature channels.
+///
+/// \param num_voxels    The number of voxels.
+///
+/// \param point_indices    The voxel point indices returned by
+///        VoxelizePoolingCPU.
+///
+/// \param row_splits    The voxel point row splits returned by
+///        VoxelizePoolingCPU. The shape is [num_voxels+1].
+///
+/// \param pooling_indices    The pooling indices returned by
+///        VoxelizePoolingCPU. This is only used if \p feature_fn is not
+///        AVERAGE.
+///
+/// \param pooled_features_gradient    The gradient of the pooled features.
+///        The shape is [num_voxels,in_channels].
+///
+/// \param feature_fn    The feature_fn used in the forward pass.
+///
+template <class TFeat>
+void VoxelizePoolingBackpropCPU(TFeat* features_backprop,
+                                size_t num_points,
+                                int in_channels,
+                                int64_t num_voxels,
+                                const int64_t* const point_indices,
+                                const int64_t* const row_splits,
+                                const int64_t* const pooling_indices,
+                                const TFeat* const pooled_features_gradient,
+                                AccumulationFn feature_fn) {
+    memset(features_backprop, 0, sizeof(TFeat) * num_points * in_channels);
+    tbb::parallel_for(
+            tbb::blocked_range<int64_t>(0, num_voxels),
+            [&](const tbb::blocked_range<int64_t>& r) {
+                for (int64_t v = r.begin(); v != r.end(); ++v) {
+                    for (int c = 0; c < in_channels; ++c) {
+                        const int64_t i = v * in_channels + c;
+                        BackpropVoxelFeature(
+                                feature_fn, point_indices, row_splits[v],
+                                row_splits[v + 1], in_channels, c,
+                                feature_fn == AVERAGE ? -1 : pooling_indices[i],
+                                pooled_features_gradient[i], features_backprop);
+                    }
+                }
+            });
+}
+
+}  // namespace impl
+}  // namespace ml
+}  // namespace open3d
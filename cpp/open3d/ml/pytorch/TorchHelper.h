@@ -95,6 +95,10 @@ inline TorchDtype_t ToTorchDtype<int64_t>() {
     return torch::kInt64;
 }
 template <>
+inline TorchDtype_t ToTorchDtype<at::Half>() {
+    return torch::kFloat16;
+}
+template <>
 inline TorchDtype_t ToTorchDtype<float>() {
     return torch::kFloat32;
 }
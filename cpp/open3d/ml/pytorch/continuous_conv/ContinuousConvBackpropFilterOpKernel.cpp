@@ -32,7 +32,7 @@
 
 using namespace open3d::ml::impl;
 
-template <class TReal, class TIndex>
+template <class TFeat, class TReal, class TIndex>
 void ContinuousConvBackpropFilterCPU(
         const torch::Tensor& filters,
         const torch::Tensor& out_positions,
@@ -58,10 +58,10 @@ void ContinuousConvBackpropFilterCPU(
         filter_dims.push_back(d);
     }
     CConvBackpropFilterCPU<TReal, TIndex>(
-            filter_backprop.data_ptr<TReal>(), filter_dims,
+            filter_backprop.data_ptr<TFeat>(), filter_dims,
             out_positions.size(0), out_positions.data_ptr<TReal>(),
             inp_positions.size(0), inp_positions.data_ptr<TReal>(),
-            inp_features.data_ptr<TReal>(),
+            inp_features.data_ptr<TFeat>(),
             inp_importance.size(0) ? inp_importance.data_ptr<TReal>() : nullptr,
             neighbors_index.size(0),
             (TIndex*)neighbors_index.data_ptr<TIndex>(),
@@ -69,12 +69,12 @@ void ContinuousConvBackpropFilterCPU(
                     ? neighbors_importance.data_ptr<TReal>()
                     : nullptr,
             neighbors_row_splits.data_ptr<int64_t>(), extents.data_ptr<TReal>(),
-            offset.data_ptr<TReal>(), out_features_gradient.data_ptr<TReal>(),
+            offset.data_ptr<TReal>(), out_features_gradient.data_ptr<TFeat>(),
             interpolation, coordinate_mapping, align_corners,
             individual_extents, isotropic_extents, normalize);
 }
-#define INSTANTIATE(TReal, TIndex)                                            \
-    template void ContinuousConvBackpropFilterCPU<TReal, TIndex>(             \
+#define INSTANTIATE(TFeat, TReal, TIndex)                                     \
+    template void ContinuousConvBackpropFilterCPU<TFeat, TReal, TIndex>(      \
             const torch::Tensor& filters, const torch::Tensor& out_positions, \
             const torch::Tensor& extents, const torch::Tensor& offset,        \
             const torch::Tensor& inp_positions,                               \
@@ -90,4 +90,4 @@ void ContinuousConvBackpropFilterCPU(
             const open3d::ml::impl::InterpolationMode interpolation,          \
             const int64_t max_temp_mem_MB, torch::Tensor& filter_backprop);
 
-INSTANTIATE(float, int32_t)
+INSTANTIATE(float, float, int32_t)
@@ -25,6 +25,7 @@
 // ----------------------------------------------------------------------------
 //
 
+#include <type_traits>
 #include <vector>
 
 #include "ATen/cuda/CUDAContext.h"
@@ -34,7 +35,7 @@
 
 using namespace open3d::ml::impl;
 
-template <class TReal, class TIndex>
+template <class TFeat, class TReal, class TIndex>
 void ContinuousConvCUDA(const torch::Tensor& filters,
                         const torch::Tensor& out_positions,
                         const torch::Tensor& extents,
@@ -51,6 +52,10 @@ void ContinuousConvCUDA(const torch::Tensor& filters,
                         const InterpolationMode interpolation,
                         const int64_t max_temp_mem_MB,
                         torch::Tensor& out_features) {
+    // at::Half and __half have the same memory layout
+    typedef typename std::conditional<std::is_same<TFeat, at::Half>::value,
+                                      __half, TFeat>::type TFeatCUDA;
+
     const bool individual_extents = extents.size(0) > 1;
     const bool isotropic_extents = extents.size(1) == 1;
     std::vector<int> filter_dims;
@@ -69,12 +74,13 @@ void ContinuousConvCUDA(const torch::Tensor& filters,
     size_t max_temp_size = 0;
 
     // determine temp_size
-    CConvComputeFeaturesCUDA<TReal, TIndex>(
+    CConvComputeFeaturesCUDA<TFeatCUDA, TReal, TIndex>(
             stream, temp_ptr, temp_size, max_temp_size, texture_alignment,
-            out_features.data_ptr<TReal>(), filter_dims,
-            filters.data_ptr<TReal>(), out_positions.size(0),
+            (TFeatCUDA*)out_features.data_ptr<TFeat>(), filter_dims,
+            (TFeatCUDA*)filters.data_ptr<TFeat>(), out_positions.size(0),
             out_positions.data_ptr<TReal>(), inp_positions.size(0),
-            inp_positions.data_ptr<TReal>(), inp_features.data_ptr<TReal>(),
+            inp_positions.data_ptr<TReal>(),
+            (TFeatCUDA*)inp_features.data_ptr<TFeat>(),
             inp_importance.size(0) ? inp_importance.data_ptr<TReal>() : nullptr,
             neighbors_index.size(0), neighbors_index.data_ptr<TIndex>(),
             neighbors_importance.size(0)
@@ -91,12 +97,13 @@ void ContinuousConvCUDA(const torch::Tensor& filters,
     auto temp_tensor = CreateTempTensor(temp_size, device, &temp_ptr);
 
     // actually run the operation
-    CConvComputeFeaturesCUDA<TReal, TIndex>(
+    CConvComputeFeaturesCUDA<TFeatCUDA, TReal, TIndex>(
             stream, temp_ptr, temp_size, max_temp_size, texture_alignment,
-            out_features.data_ptr<TReal>(), filter_dims,
-            filters.data_ptr<TReal>(), out_positions.size(0),
+            (TFeatCUDA*)out_features.data_ptr<TFeat>(), filter_dims,
+            (TFeatCUDA*)filters.data_ptr<TFeat>(), out_positions.size(0),
             out_positions.data_ptr<TReal>(), inp_positions.size(0),
-            inp_positions.data_ptr<TReal>(), inp_features.data_ptr<TReal>(),
+            inp_positions.data_ptr<TReal>(),
+            (TFeatCUDA*)inp_features.data_ptr<TFeat>(),
             inp_importance.size(0) ? inp_importance.data_ptr<TReal>() : nullptr,
             neighbors_index.size(0), neighbors_index.data_ptr<TIndex>(),
             neighbors_importance.size(0)
@@ -106,8 +113,8 @@ void ContinuousConvCUDA(const torch::Tensor& filters,
             offset.data_ptr<TReal>(), interpolation, coordinate_mapping,
             align_corners, individual_extents, isotropic_extents, normalize);
 }
-#define INSTANTIATE(TReal, TIndex)                                            \
-    template void ContinuousConvCUDA<TReal, TIndex>(                          \
+#define INSTANTIATE(TFeat, TReal, TIndex)                                     \
+    template void ContinuousConvCUDA<TFeat, TReal, TIndex>(                   \
             const torch::Tensor& filters, const torch::Tensor& out_positions, \
             const torch::Tensor& extents, const torch::Tensor& offset,        \
             const torch::Tensor& inp_positions,                               \
@@ -121,4 +128,5 @@ void ContinuousConvCUDA(const torch::Tensor& filters,
             const InterpolationMode interpolation,                            \
             const int64_t max_temp_mem_MB, torch::Tensor& out_features);
 
-INSTANTIATE(float, int32_t)
+INSTANTIATE(float, float, int32_t)
+INSTANTIATE(at::Half, float, int32_t)
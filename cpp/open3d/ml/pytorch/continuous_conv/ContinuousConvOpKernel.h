@@ -31,7 +31,7 @@
 #include "open3d/ml/impl/continuous_conv/ContinuousConvTypes.h"
 #include "torch/script.h"
 
-template <class TReal, class TIndex>
+template <class TFeat, class TReal, class TIndex>
 void ContinuousConvCPU(
         const torch::Tensor& filters,
         const torch::Tensor& out_positions,
@@ -51,7 +51,7 @@ void ContinuousConvCPU(
         torch::Tensor& out_features);
 
 #ifdef BUILD_CUDA_MODULE
-template <class TReal, class TIndex>
+template <class TFeat, class TReal, class TIndex>
 void ContinuousConvCUDA(
         const torch::Tensor& filters,
         const torch::Tensor& out_positions,
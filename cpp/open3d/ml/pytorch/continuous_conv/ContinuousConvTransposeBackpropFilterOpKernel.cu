@@ -24,6 +24,7 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 //
+#include <type_traits>
 #include <vector>
 
 #include "ATen/cuda/CUDAContext.h"
@@ -33,7 +34,7 @@
 
 using namespace open3d::ml::impl;
 
-template <class TReal, class TIndex>
+template <class TFeat, class TReal, class TIndex>
 void ContinuousConvTransposeBackpropFilterCUDA(
         const torch::Tensor& filters,
         const torch::Tensor& out_positions,
@@ -54,6 +55,10 @@ void ContinuousConvTransposeBackpropFilterCUDA(
         const InterpolationMode interpolation,
         const int64_t max_temp_mem_MB,
         torch::Tensor& filter_backprop) {
+    // at::Half and __half have the same memory layout
+    typedef typename std::conditional<std::is_same<TFeat, at::Half>::value,
+                                      __half, TFeat>::type TFeatCUDA;
+
     const bool individual_extents = extents.size(0) > 1;
     const bool isotropic_extents = extents.size(1) == 1;
     std::vector<int> filter_dims;
@@ -72,13 +77,13 @@ void ContinuousConvTransposeBackpropFilterCUDA(
     size_t max_temp_size = 0;
 
     // determine temp_size
-    CConvTransposeBackpropFilterCUDA<TReal, TIndex>(
+    CConvTransposeBackpropFilterCUDA<TFeatCUDA, TReal, TIndex>(
             stream, temp_ptr, temp_size, max_temp_size, texture_alignment,
-            filter_backprop.data_ptr<TReal>(), filter_dims,
+            (TFeatCUDA*)filter_backprop.data_ptr<TFeat>(), filter_dims,
             out_positions.size(0), out_positions.data_ptr<TReal>(),
             out_importance.size(0) ? out_importance.data_ptr<TReal>() : nullptr,
             inp_positions.size(0), inp_positions.data_ptr<TReal>(),
-            inp_features.data_ptr<TReal>(),
+            (TFeatCUDA*)inp_features.data_ptr<TFeat>(),
             inp_neighbors_importance_sum.size(0)
                     ? inp_neighbors_importance_sum.data_ptr<TReal>()
                     : nullptr,
@@ -88,7 +93,8 @@ void ContinuousConvTransposeBackpropFilterCUDA(
                     ? neighbors_importance.data_ptr<TReal>()
                     : nullptr,
             neighbors_row_splits.data_ptr<int64_t>(), extents.data_ptr<TReal>(),
-            offset.data_ptr<TReal>(), out_features_gradient.data_ptr<TReal>(),
+            offset.data_ptr<TReal>(),
+            (TFeatCUDA*)out_features_gradient.data_ptr<TFeat>(),
             interpolation, coordinate_mapping, align_corners,
             individual_extents, isotropic_extents, normalize);
 
@@ -99,13 +105,13 @@ void ContinuousConvTransposeBackpropFilterCUDA(
     auto temp_tensor = CreateTempTensor(temp_size, device, &temp_ptr);
 
     // actually run the operation
-    CConvTransposeBackpropFilterCUDA<TReal, TIndex>(
+    CConvTransposeBackpropFilterCUDA<TFeatCUDA, TReal, TIndex>(
             stream, temp_ptr, temp_size, max_temp_size, texture_alignment,
-            filter_backprop.data_ptr<TReal>(), filter_dims,
+            (TFeatCUDA*)filter_backprop.data_ptr<TFeat>(), filter_dims,
             out_positions.size(0), out_positions.data_ptr<TReal>(),
             out_importance.size(0) ? out_importance.data_ptr<TReal>() : nullptr,
             inp_positions.size(0), inp_positions.data_ptr<TReal>(),
-            inp_features.data_ptr<TReal>(),
+            (TFeatCUDA*)inp_features.data_ptr<TFeat>(),
             inp_neighbors_importance_sum.size(0)
                     ? inp_neighbors_importance_sum.data_ptr<TReal>()
                     : nullptr,
@@ -115,12 +121,14 @@ void ContinuousConvTransposeBackpropFilterCUDA(
                     ? neighbors_importance.data_ptr<TReal>()
                     : nullptr,
             neighbors_row_splits.data_ptr<int64_t>(), extents.data_ptr<TReal>(),
-            offset.data_ptr<TReal>(), out_features_gradient.data_ptr<TReal>(),
+            offset.data_ptr<TReal>(),
+            (TFeatCUDA*)out_features_gradient.data_ptr<TFeat>(),
             interpolation, coordinate_mapping, align_corners,
             individual_extents, isotropic_extents, normalize);
 }
-#define INSTANTIATE(TReal, TIndex)                                             \
-    template void ContinuousConvTransposeBackpropFilterCUDA<TReal, TIndex>(    \
+#define INSTANTIATE(TFeat, TReal, TIndex)                                      \
+    template void                                                              \
+    ContinuousConvTransposeBackpropFilterCUDA<TFeat, TReal, TIndex>(           \
             const torch::Tensor& filters, const torch::Tensor& out_positions,  \
             const torch::Tensor& out_importance, const torch::Tensor& extents, \
             const torch::Tensor& offset, const torch::Tensor& inp_positions,   \
@@ -136,4 +144,5 @@ void ContinuousConvTransposeBackpropFilterCUDA(
             const InterpolationMode interpolation,                             \
             const int64_t max_temp_mem_MB, torch::Tensor& filter_backprop);
 
-INSTANTIATE(float, int32_t)
+INSTANTIATE(float, float, int32_t)
+INSTANTIATE(at::Half, float, int32_t)
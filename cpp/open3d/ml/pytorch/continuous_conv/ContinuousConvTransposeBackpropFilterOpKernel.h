@@ -31,7 +31,7 @@
 #include "open3d/ml/impl/continuous_conv/ContinuousConvTypes.h"
 #include "torch/script.h"
 
-template <class TReal, class TIndex>
+template <class TFeat, class TReal, class TIndex>
 void ContinuousConvTransposeBackpropFilterCPU(
         const torch::Tensor& filters,
         const torch::Tensor& out_positions,
@@ -54,7 +54,7 @@ void ContinuousConvTransposeBackpropFilterCPU(
         torch::Tensor& filter_backprop);
 
 #ifdef BUILD_CUDA_MODULE
-template <class TReal, class TIndex>
+template <class TFeat, class TReal, class TIndex>
 void ContinuousConvTransposeBackpropFilterCUDA(
         const torch::Tensor& filters,
         const torch::Tensor& out_positions,
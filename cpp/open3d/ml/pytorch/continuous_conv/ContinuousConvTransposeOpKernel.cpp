@@ -32,7 +32,7 @@
 
 using namespace open3d::ml::impl;
 
-template <class TReal, class TIndex>
+template <class TFeat, class TReal, class TIndex>
 void ContinuousConvTransposeCPU(
         const torch::Tensor& filters,
         const torch::Tensor& out_positions,
@@ -61,12 +61,12 @@ void ContinuousConvTransposeCPU(
     }
 
     CConvTransposeComputeFeaturesCPU<TReal, TIndex>(
-            out_features.data_ptr<TReal>(), filter_dims,
-            filters.data_ptr<TReal>(), out_positions.size(0),
+            out_features.data_ptr<TFeat>(), filter_dims,
+            filters.data_ptr<TFeat>(), out_positions.size(0),
             out_positions.data_ptr<TReal>(),
             out_importance.size(0) ? out_importance.data_ptr<TReal>() : nullptr,
             inp_positions.size(0), inp_positions.data_ptr<TReal>(),
-            inp_features.data_ptr<TReal>(),
+            inp_features.data_ptr<TFeat>(),
             inp_neighbors_importance_sum.size(0)
                     ? inp_neighbors_importance_sum.data_ptr<TReal>()
                     : nullptr,
@@ -80,8 +80,8 @@ void ContinuousConvTransposeCPU(
             offset.data_ptr<TReal>(), interpolation, coordinate_mapping,
             align_corners, individual_extents, isotropic_extents, normalize);
 }
-#define INSTANTIATE(TReal, TIndex)                                             \
-    template void ContinuousConvTransposeCPU<TReal, TIndex>(                   \
+#define INSTANTIATE(TFeat, TReal, TIndex)                                      \
+    template void ContinuousConvTransposeCPU<TFeat, TReal, TIndex>(            \
             const torch::Tensor& filters, const torch::Tensor& out_positions,  \
             const torch::Tensor& out_importance, const torch::Tensor& extents, \
             const torch::Tensor& offset, const torch::Tensor& inp_positions,   \
@@ -97,4 +97,4 @@ void ContinuousConvTransposeCPU(
             const InterpolationMode interpolation,                             \
             const int64_t max_temp_mem_MB, torch::Tensor& out_features);
 
-INSTANTIATE(float, int32_t)
+INSTANTIATE(float, float, int32_t)
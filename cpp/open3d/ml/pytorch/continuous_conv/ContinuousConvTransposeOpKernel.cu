@@ -25,6 +25,7 @@
 // ----------------------------------------------------------------------------
 //
 
+#include <type_traits>
 #include <vector>
 
 #include "ATen/cuda/CUDAContext.h"
@@ -34,7 +35,7 @@
 
 using namespace open3d::ml::impl;
 
-template <class TReal, class TIndex>
+template <class TFeat, class TReal, class TIndex>
 void ContinuousConvTransposeCUDA(
         const torch::Tensor& filters,
         const torch::Tensor& out_positions,
@@ -55,6 +56,10 @@ void ContinuousConvTransposeCUDA(
         const InterpolationMode interpolation,
         const int64_t max_temp_mem_MB,
         torch::Tensor& out_features) {
+    // at::Half and __half have the same memory layout
+    typedef typename std::conditional<std::is_same<TFeat, at::Half>::value,
+                                      __half, TFeat>::type TFeatCUDA;
+
     const bool individual_extents = extents.size(0) > 1;
     const bool isotropic_extents = extents.size(1) == 1;
     std::vector<int> filter_dims;
@@ -73,14 +78,14 @@ void ContinuousConvTransposeCUDA(
     size_t max_temp_size = 0;
 
     // determine temp_size
-    CConvTransposeComputeFeaturesCUDA<TReal, TIndex>(
+    CConvTransposeComputeFeaturesCUDA<TFeatCUDA, TReal, TIndex>(
             stream, temp_ptr, temp_size, max_temp_size, texture_alignment,
-            out_features.data_ptr<TReal>(), filter_dims,
-            filters.data_ptr<TReal>(), out_positions.size(0),
+            (TFeatCUDA*)out_features.data_ptr<TFeat>(), filter_dims,
+            (TFeatCUDA*)filters.data_ptr<TFeat>(), out_positions.size(0),
             out_positions.data_ptr<TReal>(),
             out_importance.size(0) ? out_importance.data_ptr<TReal>() : nullptr,
             inp_positions.size(0), inp_positions.data_ptr<TReal>(),
-            inp_features.data_ptr<TReal>(),
+            (TFeatCUDA*)inp_features.data_ptr<TFeat>(),
             inp_neighbors_importance_sum.size(0)
                     ? inp_neighbors_importance_sum.data_ptr<TReal>()
                     : nullptr,
@@ -100,14 +105,14 @@ void ContinuousConvTransposeCUDA(
     auto temp_tensor = CreateTempTensor(temp_size, device, &temp_ptr);
 
     // actually run the operation
-    CConvTransposeComputeFeaturesCUDA<TReal, TIndex>(
+    CConvTransposeComputeFeaturesCUDA<TFeatCUDA, TReal, TIndex>(
             stream, temp_ptr, temp_size, max_temp_size, texture_alignment,
-            out_features.data_ptr<TReal>(), filter_dims,
-            filters.data_ptr<TReal>(), out_positions.size(0),
+            (TFeatCUDA*)out_features.data_ptr<TFeat>(), filter_dims,
+            (TFeatCUDA*)filters.data_ptr<TFeat>(), out_positions.size(0),
             out_positions.data_ptr<TReal>(),
             out_importance.size(0) ? out_importance.data_ptr<TReal>() : nullptr,
             inp_positions.size(0), inp_positions.data_ptr<TReal>(),
-            inp_features.data_ptr<TReal>(),
+            (TFeatCUDA*)inp_features.data_ptr<TFeat>(),
             inp_neighbors_importance_sum.size(0)
                     ? inp_neighbors_importance_sum.data_ptr<TReal>()
                     : nullptr,
@@ -120,8 +125,8 @@ void ContinuousConvTransposeCUDA(
             offset.data_ptr<TReal>(), interpolation, coordinate_mapping,
             align_corners, individual_extents, isotropic_extents, normalize);
 }
-#define INSTANTIATE(TReal, TIndex)                                             \
-    template void ContinuousConvTransposeCUDA<TReal, TIndex>(                  \
+#define INSTANTIATE(TFeat, TReal, TIndex)                                      \
+    template void ContinuousConvTransposeCUDA<TFeat, TReal, TIndex>(           \
             const torch::Tensor& filters, const torch::Tensor& out_positions,  \
             const torch::Tensor& out_importance, const torch::Tensor& extents, \
             const torch::Tensor& offset, const torch::Tensor& inp_positions,   \
@@ -137,4 +142,5 @@ void ContinuousConvTransposeCUDA(
             const InterpolationMode interpolation,                             \
             const int64_t max_temp_mem_MB, torch::Tensor& out_features);
 
-INSTANTIATE(float, int32_t)
+INSTANTIATE(float, float, int32_t)
+INSTANTIATE(at::Half, float, int32_t)
@@ -24,6 +24,7 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------q
 
+#include <tuple>
 #include <vector>
 
 #include "open3d/ml/contrib/Nms.h"
@@ -61,8 +62,72 @@ torch::Tensor Nms(torch::Tensor boxes,
     }
 }
 
+std::tuple<torch::Tensor, torch::Tensor> BatchedNms(torch::Tensor boxes,
+                                                   torch::Tensor scores,
+                                                   torch::Tensor labels,
+                                                   torch::Tensor row_splits,
+                                                   double nms_overlap_thresh) {
+    boxes = boxes.contiguous();
+    scores = scores.contiguous();
+    labels = labels.contiguous();
+    row_splits = row_splits.to(boxes.device()).contiguous();
+    CHECK_TYPE(boxes, kFloat);
+    CHECK_TYPE(scores, kFloat);
+    CHECK_TYPE(labels, kInt64);
+    CHECK_TYPE(row_splits, kInt64);
+    CHECK_SAME_DEVICE_TYPE(boxes, scores, labels);
+
+    using namespace open3d::ml::op_util;
+    Dim num_boxes("num_boxes");
+    Dim batch_size("batch_size");
+    CHECK_SHAPE(boxes, num_boxes, 5);
+    CHECK_SHAPE(scores, num_boxes);
+    CHECK_SHAPE(labels, num_boxes);
+    CHECK_SHAPE(row_splits, batch_size + 1);
+
+    std::vector<int64_t> keep_indices;
+    std::vector<int64_t> keep_row_splits;
+    if (boxes.is_cuda()) {
+#ifdef BUILD_CUDA_MODULE
+        keep_indices = open3d::ml::contrib::BatchedNmsCUDAKernel(
+                boxes.data_ptr<float>(), scores.data_ptr<float>(),
+                labels.data_ptr<int64_t>(), row_splits.data_ptr<int64_t>(),
+                boxes.size(0), batch_size.value(), nms_overlap_thresh,
+                keep_row_splits);
+#else
+        TORCH_CHECK(false, "BatchedNms was not compiled with CUDA support")
+#endif
+    } else {
+        keep_indices = open3d::ml::contrib::BatchedNmsCPUKernel(
+                boxes.data_ptr<float>(), scores.data_ptr<float>(),
+                labels.data_ptr<int64_t>(), row_splits.data_ptr<int64_t>(),
+                boxes.size(0), batch_size.value(), nms_overlap_thresh,
+                keep_row_splits);
+    }
+
+    auto options = torch::TensorOptions().dtype(torch::kLong);
+    torch::Tensor keep_indices_tensor =
+            torch::from_blob(keep_indices.data(),
+                             {static_cast<int64_t>(keep_indices.size())},
+                             options)
+                    .to(boxes.device(), /*non_blocking=*/false,
+                        /*copy=*/true);
+    torch::Tensor keep_row_splits_tensor =
+            torch::from_blob(keep_row_splits.data(),
+                             {static_cast<int64_t>(keep_row_splits.size())},
+                             options)
+                    .clone();
+    return std::make_tuple(keep_indices_tensor, keep_row_splits_tensor);
+}
+
 static auto registry = torch::RegisterOperators(
         "open3d::nms(Tensor boxes, Tensor scores, float "
         "nms_overlap_thresh) -> "
         "Tensor keep_indices",
         &Nms);
+
+static auto registry_batched = torch::RegisterOperators(
+        "open3d::batched_nms(Tensor boxes, Tensor scores, Tensor labels, "
+        "Tensor row_splits, float nms_overlap_thresh) -> "
+        "(Tensor keep_indices, Tensor keep_row_splits)",
+        &BatchedNms);
@@ -0,0 +1,140 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "ATen/cuda/CUDAContext.h"
+#include "open3d/ml/impl/misc/VoxelizePooling.cuh"
+#include "open3d/ml/pytorch/TorchHelper.h"
+#include "open3d/ml/pytorch/misc/VoxelizePoolingOpKernel.h"
+#include "torch/script.h"
+
+using namespace open3d::ml::impl;
+
+template <class TReal, class TFeat>
+void VoxelizePoolingCUDA(const torch::Tensor& positions,
+                         const torch::Tensor& features,
+                         const torch::Tensor& voxel_size,
+                         const torch::Tensor& points_range_min,
+                         const torch::Tensor& points_range_max,
+                         const AccumulationFn position_fn,
+                         const AccumulationFn feature_fn,
+                         torch::Tensor& voxel_coords,
+                         torch::Tensor& pooled_positions,
+                         torch::Tensor& pooled_features,
+                         torch::Tensor& voxel_point_indices,
+                         torch::Tensor& voxel_point_row_splits,
+                         torch::Tensor& pooling_indices) {
+    auto stream = at::cuda::getCurrentCUDAStream();
+    auto cuda_device_props = at::cuda::getCurrentDeviceProperties();
+    const int texture_alignment = cuda_device_props->textureAlignment;
+
+    VoxelizePoolingOutputAllocator<TReal, TFeat> output_allocator(
+            positions.device().type(), positions.device().index());
+
+    void* temp_ptr = nullptr;
+    size_t temp_size = 0;
+
+    // determine temp_size
+    VoxelizePoolingCUDA<TReal, TFeat>(
+            stream, temp_ptr, temp_size, texture_alignment, positions.size(0),
+            positions.data_ptr<TReal>(), features.size(1),
+            features.data_ptr<TFeat>(), voxel_size.data_ptr<TReal>(),
+            points_range_min.data_ptr<TReal>(),
+            points_range_max.data_ptr<TReal>(), output_allocator, position_fn,
+            feature_fn);
+
+    auto temp_tensor =
+            CreateTempTensor(temp_size, positions.device(), &temp_ptr);
+
+    // actually run the voxelization and pooling
+    VoxelizePoolingCUDA<TReal, TFeat>(
+            stream, temp_ptr, temp_size, texture_alignment, positions.size(0),
+            positions.data_ptr<TReal>(), features.size(1),
+            features.data_ptr<TFeat>(), voxel_size.data_ptr<TReal>(),
+            points_range_min.data_ptr<TReal>(),
+            points_range_max.data_ptr<TReal>(), output_allocator, position_fn,
+            feature_fn);
+
+    voxel_coords = output_allocator.VoxelCoords();
+    pooled_positions = output_allocator.PooledPositions();
+    pooled_features = output_allocator.PooledFeatures();
+    voxel_point_indices = output_allocator.VoxelPointIndices();
+    voxel_point_row_splits = output_allocator.VoxelPointRowSplits();
+    pooling_indices = output_allocator.PoolingIndices();
+}
+
+template <class TFeat>
+void VoxelizePoolingGradCUDA(torch::Tensor& features_backprop,
+                             const torch::Tensor& voxel_point_indices,
+                             const torch::Tensor& voxel_point_row_splits,
+                             const torch::Tensor& pooling_indices,
+                             const torch::Tensor& pooled_features_gradient,
+                             const AccumulationFn feature_fn) {
+    auto stream = at::cuda::getCurrentCUDAStream();
+    VoxelizePoolingBackpropCUDA<TFeat>(
+            stream, features_backprop.data_ptr<TFeat>(),
+            features_backprop.size(0), features_backprop.size(1),
+            voxel_point_row_splits.size(0) - 1,
+            voxel_point_indices.data_ptr<int64_t>(),
+            voxel_point_row_splits.data_ptr<int64_t>(),
+            pooling_indices.data_ptr<int64_t>(),
+            pooled_features_gradient.data_ptr<TFeat>(), feature_fn);
+}
+
+#define INSTANTIATE(TReal, TFeat)                                             \
+    template void VoxelizePoolingCUDA<TReal, TFeat>(                          \
+            const torch::Tensor& positions, const torch::Tensor& features,    \
+            const torch::Tensor& voxel_size,                                  \
+            const torch::Tensor& points_range_min,                            \
+            const torch::Tensor& points_range_max,                            \
+            const AccumulationFn position_fn, const AccumulationFn feature_fn, \
+            torch::Tensor& voxel_coords, torch::Tensor& pooled_positions,     \
+            torch::Tensor& pooled_features,                                   \
+            torch::Tensor& voxel_point_indices,                               \
+            torch::Tensor& voxel_point_row_splits,                            \
+            torch::Tensor& pooling_indices);
+
+INSTANTIATE(float, float)
+INSTANTIATE(float, int32_t)
+INSTANTIATE(float, int64_t)
+INSTANTIATE(float, double)
+INSTANTIATE(double, float)
+INSTANTIATE(double, int32_t)
+INSTANTIATE(double, int64_t)
+INSTANTIATE(double, double)
+#undef INSTANTIATE
+
+#define INSTANTIATE(TFeat)                                              \
+    template void VoxelizePoolingGradCUDA<TFeat>(                       \
+            torch::Tensor & features_backprop,                          \
+            const torch::Tensor& voxel_point_indices,                   \
+            const torch::Tensor& voxel_point_row_splits,                \
+            const torch::Tensor& pooling_indices,                       \
+            const torch::Tensor& pooled_features_gradient,              \
+            const AccumulationFn feature_fn);
+
+INSTANTIATE(float)
+INSTANTIATE(double)
@@ -0,0 +1,252 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include <vector>
+
+#include "open3d/ml/pytorch/TorchHelper.h"
+#include "open3d/ml/pytorch/misc/VoxelizePoolingOpKernel.h"
+#include "torch/script.h"
+
+using namespace open3d::ml::impl;
+using torch::autograd::AutogradContext;
+using torch::autograd::Function;
+using torch::autograd::Variable;
+using torch::autograd::variable_list;
+
+namespace {
+
+AccumulationFn ParsePositionFn(const std::string& position_fn_str) {
+    if (position_fn_str == "average") {
+        return AVERAGE;
+    } else if (position_fn_str == "nearest_neighbor") {
+        return NEAREST_NEIGHBOR;
+    } else if (position_fn_str == "center") {
+        return CENTER;
+    }
+    TORCH_CHECK(false,
+                "position_fn must be one of ('average', "
+                "'nearest_neighbor', 'center') but got " +
+                        position_fn_str);
+    return AVERAGE;
+}
+
+AccumulationFn ParseFeatureFn(const std::string& feature_fn_str) {
+    if (feature_fn_str == "average") {
+        return AVERAGE;
+    } else if (feature_fn_str == "nearest_neighbor") {
+        return NEAREST_NEIGHBOR;
+    } else if (feature_fn_str == "max") {
+        return MAX;
+    }
+    TORCH_CHECK(false,
+                "feature_fn must be one of ('average', "
+                "'nearest_neighbor', 'max') but got " +
+                        feature_fn_str);
+    return AVERAGE;
+}
+
+}  // namespace
+
+class VoxelizePoolingFunction : public Function<VoxelizePoolingFunction> {
+public:
+    static variable_list forward(AutogradContext* ctx,
+                                 Variable positions,
+                                 Variable features,
+                                 Variable voxel_size,
+                                 Variable points_range_min,
+                                 Variable points_range_max,
+                                 const std::string& position_fn_str,
+                                 const std::string& feature_fn_str) {
+        const AccumulationFn position_fn = ParsePositionFn(position_fn_str);
+        const AccumulationFn feature_fn = ParseFeatureFn(feature_fn_str);
+        positions = positions.contiguous();
+        features = features.contiguous();
+
+        // make sure that these tensors are on the cpu
+        voxel_size = voxel_size.to(torch::kCPU).contiguous();
+        points_range_min = points_range_min.to(torch::kCPU).contiguous();
+        points_range_max = points_range_max.to(torch::kCPU).contiguous();
+
+        CHECK_SAME_DTYPE(positions, voxel_size, points_range_min,
+                         points_range_max);
+
+        // check input shapes
+        {
+            using namespace open3d::ml::op_util;
+            Dim num_points("num_points");
+            Dim num_channels("num_channels");
+
+            CHECK_SHAPE(positions, num_points, 3);
+            CHECK_SHAPE(features, num_points, num_channels);
+            CHECK_SHAPE(voxel_size, 3);
+            CHECK_SHAPE(points_range_min, 3);
+            CHECK_SHAPE(points_range_max, 3);
+        }
+        ctx->saved_data["feature_fn_str"] = feature_fn_str;
+
+        const auto& positions_type = positions.dtype();
+        const auto& features_type = features.dtype();
+
+        // output tensors
+        torch::Tensor voxel_coords, pooled_positions, pooled_features,
+                voxel_point_indices, voxel_point_row_splits, pooling_indices;
+
+#define FN_PARAMETERS                                                      \
+    positions, features, voxel_size, points_range_min, points_range_max,   \
+            position_fn, feature_fn, voxel_coords, pooled_positions,       \
+            pooled_features, voxel_point_indices, voxel_point_row_splits, \
+            pooling_indices
+
+#define CALL(real_t, feat_t, fn)                                              \
+    if (CompareTorchDtype<real_t>(positions_type) &&                          \
+        CompareTorchDtype<feat_t>(features_type)) {                           \
+        fn<real_t, feat_t>(FN_PARAMETERS);                                    \
+        ctx->save_for_backward({features, voxel_point_indices,                \
+                                voxel_point_row_splits, pooling_indices});    \
+        ctx->mark_non_differentiable({voxel_coords, voxel_point_indices,      \
+                                      voxel_point_row_splits,                 \
+                                      pooling_indices});                      \
+        return {voxel_coords,        pooled_positions,       pooled_features, \
+                voxel_point_indices, voxel_point_row_splits, pooling_indices}; \
+    }
+
+        CHECK_SAME_DEVICE_TYPE(positions, features);
+        if (positions.is_cuda()) {
+#ifdef BUILD_CUDA_MODULE
+            CALL(float, float, VoxelizePoolingCUDA)
+            CALL(float, int32_t, VoxelizePoolingCUDA)
+            CALL(float, int64_t, VoxelizePoolingCUDA)
+            CALL(float, double, VoxelizePoolingCUDA)
+            CALL(double, float, VoxelizePoolingCUDA)
+            CALL(double, int32_t, VoxelizePoolingCUDA)
+            CALL(double, int64_t, VoxelizePoolingCUDA)
+            CALL(double, double, VoxelizePoolingCUDA)
+#else
+            TORCH_CHECK(false,
+                        "VoxelizePooling was not compiled with CUDA support")
+#endif
+        } else {
+            CALL(float, float, VoxelizePoolingCPU)
+            CALL(float, int32_t, VoxelizePoolingCPU)
+            CALL(float, int64_t, VoxelizePoolingCPU)
+            CALL(float, double, VoxelizePoolingCPU)
+            CALL(double, float, VoxelizePoolingCPU)
+            CALL(double, int32_t, VoxelizePoolingCPU)
+            CALL(double, int64_t, VoxelizePoolingCPU)
+            CALL(double, double, VoxelizePoolingCPU)
+        }
+#undef FN_PARAMETERS
+#undef CALL
+
+        TORCH_CHECK(false,
+                    "VoxelizePooling does not support " +
+                            positions.toString() +
+                            " as input for positions and " +
+                            features.toString() + " as input for features")
+        return {};
+    }
+
+    static variable_list backward(AutogradContext* ctx,
+                                  variable_list grad_output) {
+        const AccumulationFn feature_fn = ParseFeatureFn(
+                ctx->saved_data["feature_fn_str"].toStringRef());
+
+        auto saved_vars = ctx->get_saved_variables();
+        auto features = saved_vars[0];
+        auto voxel_point_indices = saved_vars[1];
+        auto voxel_point_row_splits = saved_vars[2];
+        auto pooling_indices = saved_vars[3];
+        auto pooled_features_gradient = grad_output[2].contiguous();
+
+        torch::Tensor features_backprop = torch::empty(
+                features.sizes(),
+                torch::dtype(features.dtype()).device(features.device()));
+
+        const auto& features_type = features.dtype();
+
+#define FN_PARAMETERS                                                   \
+    features_backprop, voxel_point_indices, voxel_point_row_splits,     \
+            pooling_indices, pooled_features_gradient, feature_fn
+
+#define CALL(feat_t, fn)                            \
+    if (CompareTorchDtype<feat_t>(features_type)) { \
+        fn<feat_t>(FN_PARAMETERS);                  \
+        dispatch_success = true;                    \
+    }
+
+        bool dispatch_success = false;
+        if (features.is_cuda()) {
+#ifdef BUILD_CUDA_MODULE
+            CALL(float, VoxelizePoolingGradCUDA)
+            CALL(double, VoxelizePoolingGradCUDA)
+#else
+            TORCH_CHECK(false,
+                        "VoxelizePooling was not compiled with CUDA support")
+#endif
+        } else {
+            CALL(float, VoxelizePoolingGradCPU)
+            CALL(double, VoxelizePoolingGradCPU)
+        }
+        TORCH_CHECK(dispatch_success,
+                    "VoxelizePooling backward does not support " +
+                            features.toString() + " as input for features")
+#undef FN_PARAMETERS
+#undef CALL
+
+        return {Variable(), features_backprop, Variable(),
+                Variable(), Variable(),        Variable(),
+                Variable()};
+    }
+};
+
+std::tuple<torch::Tensor,
+           torch::Tensor,
+           torch::Tensor,
+           torch::Tensor,
+           torch::Tensor,
+           torch::Tensor>
+VoxelizePooling(const torch::Tensor& positions,
+                const torch::Tensor& features,
+                const torch::Tensor& voxel_size,
+                const torch::Tensor& points_range_min,
+                const torch::Tensor& points_range_max,
+                const std::string& position_fn_str,
+                const std::string& feature_fn_str) {
+    auto ans = VoxelizePoolingFunction::apply(
+            positions, features, voxel_size, points_range_min,
+            points_range_max, position_fn_str, feature_fn_str);
+    return std::make_tuple(ans[0], ans[1], ans[2], ans[3], ans[4], ans[5]);
+}
+
+static auto registry = torch::RegisterOperators(
+        "open3d::voxelize_pooling(Tensor positions, Tensor features, Tensor "
+        "voxel_size, Tensor points_range_min, Tensor points_range_max, str "
+        "position_fn=\"average\", str feature_fn=\"average\") -> (Tensor "
+        "voxel_coords, Tensor pooled_positions, Tensor pooled_features, "
+        "Tensor voxel_point_indices, Tensor voxel_point_row_splits, Tensor "
+        "pooling_indices)",
+        &::VoxelizePooling);
@@ -84,6 +84,7 @@ public:
     REGISTER_KERNEL_BUILDER(                              \
             Name("Open3DContinuousConvBackpropFilter")    \
                     .Device(DEVICE_CPU)                   \
+                    .TypeConstraint<type>("TFeat")        \
                     .TypeConstraint<type>("TReal")        \
                     .TypeConstraint<indextype>("TIndex"), \
             ContinuousConvBackpropFilterOpKernelCPU<type, indextype>);
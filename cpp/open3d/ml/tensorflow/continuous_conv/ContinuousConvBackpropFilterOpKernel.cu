@@ -34,7 +34,7 @@ using namespace open3d::ml;
 using namespace open3d::ml::impl;
 using namespace tensorflow;
 
-template <class TReal, class TIndex>
+template <class TFeat, class TReal, class TIndex>
 class ContinuousConvBackpropFilterOpKernelCUDA
     : public ContinuousConvBackpropFilterOpKernel<TIndex> {
 public:
@@ -62,6 +62,11 @@ public:
                 const bool point_importances,
                 const bool has_neighbors_importances,
                 tensorflow::Tensor& filter_backprop) {
+        // Eigen::half and __half have the same memory layout
+        typedef typename std::conditional<
+                std::is_same<TFeat, Eigen::half>::value, __half, TFeat>::type
+                TFeatCUDA;
+
         auto device = context->eigen_gpu_device();
 
         void* temp_ptr = nullptr;
@@ -69,14 +74,15 @@ public:
         size_t max_temp_size = 0;
 
         // determine temp_size
-        CConvBackpropFilterCUDA<TReal, TIndex>(
+        CConvBackpropFilterCUDA<TFeatCUDA, TReal, TIndex>(
                 device.stream(), temp_ptr, temp_size, max_temp_size,
-                texture_alignment, filter_backprop.flat<TReal>().data(),
+                texture_alignment,
+                (TFeatCUDA*)filter_backprop.flat<TFeat>().data(),
                 filter_dims, out_positions.shape().dim_size(0),
                 out_positions.flat<TReal>().data(),
                 inp_positions.shape().dim_size(0),
                 inp_positions.flat<TReal>().data(),
-                inp_features.flat<TReal>().data(),
+                (TFeatCUDA*)inp_features.flat<TFeat>().data(),
                 point_importances ? inp_importance.flat<TReal>().data()
                                   : nullptr,
                 neighbors_index.shape().dim_size(0),
@@ -86,7 +92,8 @@ public:
                         : nullptr,
                 (int64_t*)neighbors_row_splits.flat<int64>().data(),
                 extents.flat<TReal>().data(), offset.flat<TReal>().data(),
-                out_features_gradient.flat<TReal>().data(), this->interpolation,
+                (TFeatCUDA*)out_features_gradient.flat<TFeat>().data(),
+                this->interpolation,
                 this->coordinate_mapping, this->align_corners,
                 individual_extents, isotropic_extents, this->normalize);
 
@@ -103,14 +110,15 @@ public:
         temp_ptr = temp_tensor.flat<uint8_t>().data();
 
         // actually run the operation
-        CConvBackpropFilterCUDA<TReal, TIndex>(
+        CConvBackpropFilterCUDA<TFeatCUDA, TReal, TIndex>(
                 device.stream(), temp_ptr, temp_size, max_temp_size,
-                texture_alignment, filter_backprop.flat<TReal>().data(),
+                texture_alignment,
+                (TFeatCUDA*)filter_backprop.flat<TFeat>().data(),
                 filter_dims, out_positions.shape().dim_size(0),
                 out_positions.flat<TReal>().data(),
                 inp_positions.shape().dim_size(0),
                 inp_positions.flat<TReal>().data(),
-                inp_features.flat<TReal>().data(),
+                (TFeatCUDA*)inp_features.flat<TFeat>().data(),
                 point_importances ? inp_importance.flat<TReal>().data()
                                   : nullptr,
                 neighbors_index.shape().dim_size(0),
@@ -120,7 +128,8 @@ public:
                         : nullptr,
                 (int64_t*)neighbors_row_splits.flat<int64>().data(),
                 extents.flat<TReal>().data(), offset.flat<TReal>().data(),
-                out_features_gradient.flat<TReal>().data(), this->interpolation,
+                (TFeatCUDA*)out_features_gradient.flat<TFeat>().data(),
+                this->interpolation,
                 this->coordinate_mapping, this->align_corners,
                 individual_extents, isotropic_extents, this->normalize);
     }
@@ -129,12 +138,15 @@ private:
     int texture_alignment;
 };
 
-#define REG_KB(type, indextype)                           \
-    REGISTER_KERNEL_BUILDER(                              \
-            Name("Open3DContinuousConvBackpropFilter")    \
-                    .Device(DEVICE_GPU)                   \
-                    .TypeConstraint<type>("TReal")        \
-                    .TypeConstraint<indextype>("TIndex"), \
-            ContinuousConvBackpropFilterOpKernelCUDA<type, indextype>);
-REG_KB(float, int32)
+#define REG_KB(feattype, type, indextype)                            \
+    REGISTER_KERNEL_BUILDER(                                         \
+            Name("Open3DContinuousConvBackpropFilter")               \
+                    .Device(DEVICE_GPU)                              \
+                    .TypeConstraint<feattype>("TFeat")               \
+                    .TypeConstraint<type>("TReal")                   \
+                    .TypeConstraint<indextype>("TIndex"),            \
+            ContinuousConvBackpropFilterOpKernelCUDA<feattype, type, \
+                                                     indextype>);
+REG_KB(float, float, int32)
+REG_KB(Eigen::half, float, int32)
 #undef REG_KB
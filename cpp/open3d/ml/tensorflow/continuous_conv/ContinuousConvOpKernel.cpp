@@ -80,6 +80,7 @@ public:
 #define REG_KB(type, indextype)                                           \
     REGISTER_KERNEL_BUILDER(Name("Open3DContinuousConv")                  \
                                     .Device(DEVICE_CPU)                   \
+                                    .TypeConstraint<type>("TFeat")        \
                                     .TypeConstraint<type>("TReal")        \
                                     .TypeConstraint<indextype>("TIndex"), \
                             ContinuousConvOpKernelCPU<type, indextype>);
@@ -34,7 +34,7 @@ using namespace open3d::ml;
 using namespace open3d::ml::impl;
 using namespace tensorflow;
 
-template <class TReal, class TIndex>
+template <class TFeat, class TReal, class TIndex>
 class ContinuousConvOpKernelCUDA : public ContinuousConvOpKernel<TIndex> {
 public:
     explicit ContinuousConvOpKernelCUDA(OpKernelConstruction* construction)
@@ -59,6 +59,11 @@ public:
                 const bool point_importances,
                 const bool has_neighbors_importances,
                 tensorflow::Tensor& out_features) {
+        // Eigen::half and __half have the same memory layout
+        typedef typename std::conditional<
+                std::is_same<TFeat, Eigen::half>::value, __half, TFeat>::type
+                TFeatCUDA;
+
         auto device = context->eigen_gpu_device();
 
         void* temp_ptr = nullptr;
@@ -66,15 +71,16 @@ public:
         size_t max_temp_size = 0;
 
         // determine temp_size
-        CConvComputeFeaturesCUDA<TReal, TIndex>(
+        CConvComputeFeaturesCUDA<TFeatCUDA, TReal, TIndex>(
                 device.stream(), temp_ptr, temp_size, max_temp_size,
-                texture_alignment, out_features.flat<TReal>().data(),
-                filter_dims, filter.flat<TReal>().data(),
+                texture_alignment,
+                (TFeatCUDA*)out_features.flat<TFeat>().data(),
+                filter_dims, (TFeatCUDA*)filter.flat<TFeat>().data(),
                 out_positions.shape().dim_size(0),
                 out_positions.flat<TReal>().data(),
                 inp_positions.shape().dim_size(0),
                 inp_positions.flat<TReal>().data(),
-                inp_features.flat<TReal>().data(),
+                (TFeatCUDA*)inp_features.flat<TFeat>().data(),
                 point_importances ? inp_importance.flat<TReal>().data()
                                   : nullptr,
                 neighbors_index.shape().dim_size(0),
@@ -101,15 +107,16 @@ public:
         temp_ptr = temp_tensor.flat<uint8_t>().data();
 
         // actually run the operation
-        CConvComputeFeaturesCUDA<TReal, TIndex>(
+        CConvComputeFeaturesCUDA<TFeatCUDA, TReal, TIndex>(
                 device.stream(), temp_ptr, temp_size, max_temp_size,
-                texture_alignment, out_features.flat<TReal>().data(),
-                filter_dims, filter.flat<TReal>().data(),
+                texture_alignment,
+                (TFeatCUDA*)out_features.flat<TFeat>().data(),
+                filter_dims, (TFeatCUDA*)filter.flat<TFeat>().data(),
                 out_positions.shape().dim_size(0),
                 out_positions.flat<TReal>().data(),
                 inp_positions.shape().dim_size(0),
                 inp_positions.flat<TReal>().data(),
-                inp_features.flat<TReal>().data(),
+                (TFeatCUDA*)inp_features.flat<TFeat>().data(),
                 point_importances ? inp_importance.flat<TReal>().data()
                                   : nullptr,
                 neighbors_index.shape().dim_size(0),
@@ -128,11 +135,14 @@ private:
     int texture_alignment;
 };
 
-#define REG_KB(type, indextype)                                           \
-    REGISTER_KERNEL_BUILDER(Name("Open3DContinuousConv")                  \
-                                    .Device(DEVICE_GPU)                   \
-                                    .TypeConstraint<type>("TReal")        \
-                                    .TypeConstraint<indextype>("TIndex"), \
-                            ContinuousConvOpKernelCUDA<type, indextype>);
-REG_KB(float, int32)
+#define REG_KB(feattype, type, indextype)                 \
+    REGISTER_KERNEL_BUILDER(                              \
+            Name("Open3DContinuousConv")                  \
+                    .Device(DEVICE_GPU)                   \
+                    .TypeConstraint<feattype>("TFeat")    \
+                    .TypeConstraint<type>("TReal")        \
+                    .TypeConstraint<indextype>("TIndex"), \
+            ContinuousConvOpKernelCUDA<feattype, type, indextype>);
+REG_KB(float, float, int32)
+REG_KB(Eigen::half, float, int32)
 #undef REG_KB
@@ -32,6 +32,7 @@
 using namespace tensorflow;
 
 REGISTER_OP("Open3DContinuousConv")
+        .Attr("TFeat: {float, half}")
         .Attr("TReal: {float, double}")
         .Attr("TIndex: {int32, int64}")
         .Attr("align_corners: bool = true")
@@ -42,17 +43,17 @@ REGISTER_OP("Open3DContinuousConv")
         .Attr("interpolation: {'linear', 'linear_border', 'nearest_neighbor'} "
               "= 'linear'")
         .Attr("max_temp_mem_MB: int = 64")
-        .Input("filters: TReal")        // [depth, height, width, in_ch, out_ch]
+        .Input("filters: TFeat")        // [depth, height, width, in_ch, out_ch]
         .Input("out_positions: TReal")  // [num_points_out, 3]
         .Input("extents: TReal")        // [num_points_out, 3]
         .Input("offset: TReal")         // [3]
         .Input("inp_positions: TReal")  // [num_points_in, 3]
-        .Input("inp_features: TReal")   // [num_points_in, in_ch]
+        .Input("inp_features: TFeat")   // [num_points_in, in_ch]
         .Input("inp_importance: TReal")        // [num_points_in]
         .Input("neighbors_index: TIndex")      // [?]
         .Input("neighbors_importance: TReal")  // [?]
         .Input("neighbors_row_splits: int64")  // [num_points_out+1]
-        .Output("out_features : TReal")        // [num_points_out, out_ch]
+        .Output("out_features : TFeat")        // [num_points_out, out_ch]
         .SetShapeFn([](::tensorflow::shape_inference::InferenceContext* c) {
             using namespace ::tensorflow::shape_inference;
             ShapeHandle filters_shape, out_positions_shape, extents_shape,
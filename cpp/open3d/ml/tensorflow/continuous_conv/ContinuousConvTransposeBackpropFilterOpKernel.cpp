@@ -90,6 +90,7 @@ public:
     REGISTER_KERNEL_BUILDER(                                       \
             Name("Open3DContinuousConvTransposeBackpropFilter")    \
                     .Device(DEVICE_CPU)                            \
+                    .TypeConstraint<type>("TFeat")                 \
                     .TypeConstraint<type>("TReal")                 \
                     .TypeConstraint<indextype>("TIndex"),          \
             ContinuousConvTransposeBackpropFilterOpKernelCPU<type, \
@@ -34,7 +34,7 @@ using namespace open3d::ml;
 using namespace open3d::ml::impl;
 using namespace tensorflow;
 
-template <class TReal, class TIndex>
+template <class TFeat, class TReal, class TIndex>
 class ContinuousConvTransposeBackpropFilterOpKernelCUDA
     : public ContinuousConvTransposeBackpropFilterOpKernel<TIndex> {
 public:
@@ -64,6 +64,11 @@ public:
                 const bool point_importances,
                 const bool has_neighbors_importances,
                 tensorflow::Tensor& filter_backprop) {
+        // Eigen::half and __half have the same memory layout
+        typedef typename std::conditional<
+                std::is_same<TFeat, Eigen::half>::value, __half, TFeat>::type
+                TFeatCUDA;
+
         auto device = context->eigen_gpu_device();
 
         void* temp_ptr = nullptr;
@@ -71,16 +76,17 @@ public:
         size_t max_temp_size = 0;
 
         // determine temp_size
-        CConvTransposeBackpropFilterCUDA<TReal, TIndex>(
+        CConvTransposeBackpropFilterCUDA<TFeatCUDA, TReal, TIndex>(
                 device.stream(), temp_ptr, temp_size, max_temp_size,
-                texture_alignment, filter_backprop.flat<TReal>().data(),
+                texture_alignment,
+                (TFeatCUDA*)filter_backprop.flat<TFeat>().data(),
                 filter_dims, out_positions.shape().dim_size(0),
                 out_positions.flat<TReal>().data(),
                 point_importances ? out_importance.flat<TReal>().data()
                                   : nullptr,
                 inp_positions.shape().dim_size(0),
                 inp_positions.flat<TReal>().data(),
-                inp_features.flat<TReal>().data(),
+                (TFeatCUDA*)inp_features.flat<TFeat>().data(),
                 has_neighbors_importances
                         ? inp_neighbors_importance_sum.flat<TReal>().data()
                         : nullptr,
@@ -92,7 +98,8 @@ public:
                         : nullptr,
                 (int64_t*)neighbors_row_splits.flat<int64>().data(),
                 extents.flat<TReal>().data(), offset.flat<TReal>().data(),
-                out_features_gradient.flat<TReal>().data(), this->interpolation,
+                (TFeatCUDA*)out_features_gradient.flat<TFeat>().data(),
+                this->interpolation,
                 this->coordinate_mapping, this->align_corners,
                 individual_extents, isotropic_extents, this->normalize);
 
@@ -109,16 +116,17 @@ public:
         temp_ptr = temp_tensor.flat<uint8_t>().data();
 
         // actually run the operation
-        CConvTransposeBackpropFilterCUDA<TReal, TIndex>(
+        CConvTransposeBackpropFilterCUDA<TFeatCUDA, TReal, TIndex>(
                 device.stream(), temp_ptr, temp_size, max_temp_size,
-                texture_alignment, filter_backprop.flat<TReal>().data(),
+                texture_alignment,
+                (TFeatCUDA*)filter_backprop.flat<TFeat>().data(),
                 filter_dims, out_positions.shape().dim_size(0),
                 out_positions.flat<TReal>().data(),
                 point_importances ? out_importance.flat<TReal>().data()
                                   : nullptr,
                 inp_positions.shape().dim_size(0),
                 inp_positions.flat<TReal>().data(),
-                inp_features.flat<TReal>().data(),
+                (TFeatCUDA*)inp_features.flat<TFeat>().data(),
                 has_neighbors_importances
                         ? inp_neighbors_importance_sum.flat<TReal>().data()
                         : nullptr,
@@ -130,7 +138,8 @@ public:
                         : nullptr,
                 (int64_t*)neighbors_row_splits.flat<int64>().data(),
                 extents.flat<TReal>().data(), offset.flat<TReal>().data(),
-                out_features_gradient.flat<TReal>().data(), this->interpolation,
+                (TFeatCUDA*)out_features_gradient.flat<TFeat>().data(),
+                this->interpolation,
                 this->coordinate_mapping, this->align_corners,
                 individual_extents, isotropic_extents, this->normalize);
     }
@@ -139,13 +148,15 @@ private:
     int texture_alignment;
 };
 
-#define REG_KB(type, indextype)                                     \
-    REGISTER_KERNEL_BUILDER(                                        \
-            Name("Open3DContinuousConvTransposeBackpropFilter")     \
-                    .Device(DEVICE_GPU)                             \
-                    .TypeConstraint<type>("TReal")                  \
-                    .TypeConstraint<indextype>("TIndex"),           \
-            ContinuousConvTransposeBackpropFilterOpKernelCUDA<type, \
+#define REG_KB(feattype, type, indextype)                                     \
+    REGISTER_KERNEL_BUILDER(                                                  \
+            Name("Open3DContinuousConvTransposeBackpropFilter")               \
+                    .Device(DEVICE_GPU)                                       \
+                    .TypeConstraint<feattype>("TFeat")                        \
+                    .TypeConstraint<type>("TReal")                            \
+                    .TypeConstraint<indextype>("TIndex"),                     \
+            ContinuousConvTransposeBackpropFilterOpKernelCUDA<feattype, type, \
                                                               indextype>);
-REG_KB(float, int32)
+REG_KB(float, float, int32)
+REG_KB(Eigen::half, float, int32)
 #undef REG_KB
@@ -32,6 +32,7 @@
 using namespace tensorflow;
 
 REGISTER_OP("Open3DContinuousConvTransposeBackpropFilter")
+        .Attr("TFeat: {float, half}")
         .Attr("TReal: {float, double}")
         .Attr("TIndex: {int32, int64}")
         .Attr("align_corners: bool = true")
@@ -43,20 +44,20 @@ REGISTER_OP("Open3DContinuousConvTransposeBackpropFilter")
               "= 'linear'")
         .Attr("max_temp_mem_MB: int = 64")
         .Attr("debug: bool = false")
-        .Input("filters: TReal")        // [depth, height, width, in_ch, out_ch]
+        .Input("filters: TFeat")        // [depth, height, width, in_ch, out_ch]
         .Input("out_positions: TReal")  // [num_points_out, 3]
         .Input("out_importance: TReal")                // [num_points_out]
         .Input("extents: TReal")                       // [num_points_in, 3]
         .Input("offset: TReal")                        // [3]
         .Input("inp_positions: TReal")                 // [num_points_in, 3]
-        .Input("inp_features: TReal")                  // [num_points_in, in_ch]
+        .Input("inp_features: TFeat")                  // [num_points_in, in_ch]
         .Input("inp_neighbors_importance_sum: TReal")  // [num_points_in]
         .Input("inp_neighbors_row_splits: int64")      // [num_points_in]
         .Input("neighbors_index: TIndex")              // [?]
         .Input("neighbors_importance: TReal")          // [?]
         .Input("neighbors_row_splits: int64")          // [num_points_out]
-        .Input("out_features_gradient: TReal")  // [num_points_out, out_ch]
-        .Output("filter_backprop : TReal")      // [depth, height, width, in_ch,
+        .Input("out_features_gradient: TFeat")  // [num_points_out, out_ch]
+        .Output("filter_backprop : TFeat")      // [depth, height, width, in_ch,
                                                 // out_ch]
         .SetShapeFn([](::tensorflow::shape_inference::InferenceContext* c) {
             using namespace ::tensorflow::shape_inference;
@@ -89,6 +89,7 @@ public:
     REGISTER_KERNEL_BUILDER(                              \
             Name("Open3DContinuousConvTranspose")         \
                     .Device(DEVICE_CPU)                   \
+                    .TypeConstraint<type>("TFeat")        \
                     .TypeConstraint<type>("TReal")        \
                     .TypeConstraint<indextype>("TIndex"), \
             ContinuousConvTransposeOpKernelCPU<type, indextype>);
@@ -34,7 +34,7 @@ using namespace open3d::ml;
 using namespace open3d::ml::impl;
 using namespace tensorflow;
 
-template <class TReal, class TIndex>
+template <class TFeat, class TReal, class TIndex>
 class ContinuousConvTransposeOpKernelCUDA
     : public ContinuousConvTransposeOpKernel<TIndex> {
 public:
@@ -63,6 +63,11 @@ public:
                 const bool point_importances,
                 const bool has_neighbors_importances,
                 tensorflow::Tensor& out_features) {
+        // Eigen::half and __half have the same memory layout
+        typedef typename std::conditional<
+                std::is_same<TFeat, Eigen::half>::value, __half, TFeat>::type
+                TFeatCUDA;
+
         auto device = context->eigen_gpu_device();
 
         void* temp_ptr = nullptr;
@@ -70,17 +75,18 @@ public:
         size_t max_temp_size = 0;
 
         // determine temp_size
-        CConvTransposeComputeFeaturesCUDA<TReal, TIndex>(
+        CConvTransposeComputeFeaturesCUDA<TFeatCUDA, TReal, TIndex>(
                 device.stream(), temp_ptr, temp_size, max_temp_size,
-                texture_alignment, out_features.flat<TReal>().data(),
-                filter_dims, filter.flat<TReal>().data(),
+                texture_alignment,
+                (TFeatCUDA*)out_features.flat<TFeat>().data(),
+                filter_dims, (TFeatCUDA*)filter.flat<TFeat>().data(),
                 out_positions.shape().dim_size(0),
                 out_positions.flat<TReal>().data(),
                 point_importances ? out_importance.flat<TReal>().data()
                                   : nullptr,
                 inp_positions.shape().dim_size(0),
                 inp_positions.flat<TReal>().data(),
-                inp_features.flat<TReal>().data(),
+                (TFeatCUDA*)inp_features.flat<TFeat>().data(),
                 has_neighbors_importances
                         ? inp_neighbors_importance_sum.flat<TReal>().data()
                         : nullptr,
@@ -109,17 +115,18 @@ public:
         temp_ptr = temp_tensor.flat<uint8_t>().data();
 
         // actually run the operation
-        CConvTransposeComputeFeaturesCUDA<TReal, TIndex>(
+        CConvTransposeComputeFeaturesCUDA<TFeatCUDA, TReal, TIndex>(
                 device.stream(), temp_ptr, temp_size, max_temp_size,
-                texture_alignment, out_features.flat<TReal>().data(),
-                filter_dims, filter.flat<TReal>().data(),
+                texture_alignment,
+                (TFeatCUDA*)out_features.flat<TFeat>().data(),
+                filter_dims, (TFeatCUDA*)filter.flat<TFeat>().data(),
                 out_positions.shape().dim_size(0),
                 out_positions.flat<TReal>().data(),
                 point_importances ? out_importance.flat<TReal>().data()
                                   : nullptr,
                 inp_positions.shape().dim_size(0),
                 inp_positions.flat<TReal>().data(),
-                inp_features.flat<TReal>().data(),
+                (TFeatCUDA*)inp_features.flat<TFeat>().data(),
                 has_neighbors_importances
                         ? inp_neighbors_importance_sum.flat<TReal>().data()
                         : nullptr,
@@ -140,12 +147,14 @@ private:
     int texture_alignment;
 };
 
-#define REG_KB(type, indextype)                           \
+#define REG_KB(feattype, type, indextype)                 \
     REGISTER_KERNEL_BUILDER(                              \
             Name("Open3DContinuousConvTranspose")         \
                     .Device(DEVICE_GPU)                   \
+                    .TypeConstraint<feattype>("TFeat")    \
                     .TypeConstraint<type>("TReal")        \
                     .TypeConstraint<indextype>("TIndex"), \
-            ContinuousConvTransposeOpKernelCUDA<type, indextype>);
-REG_KB(float, int32)
+            ContinuousConvTransposeOpKernelCUDA<feattype, type, indextype>);
+REG_KB(float, float, int32)
+REG_KB(Eigen::half, float, int32)
 #undef REG_KB
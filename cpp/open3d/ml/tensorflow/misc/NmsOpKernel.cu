@@ -59,3 +59,48 @@ public:
             NmsOpKernelCUDA);
 REG_KB(float)
 #undef REG_KB
+
+class BatchedNmsOpKernelCUDA : public BatchedNmsOpKernel {
+public:
+    explicit BatchedNmsOpKernelCUDA(OpKernelConstruction* construction)
+        : BatchedNmsOpKernel(construction) {}
+
+    void Kernel(tensorflow::OpKernelContext* context,
+                const tensorflow::Tensor& boxes,
+                const tensorflow::Tensor& scores,
+                const tensorflow::Tensor& labels,
+                const tensorflow::Tensor& row_splits) {
+        std::vector<int64_t> keep_row_splits;
+        std::vector<int64_t> keep_indices =
+                open3d::ml::contrib::BatchedNmsCUDAKernel(
+                        boxes.flat<float>().data(),
+                        scores.flat<float>().data(),
+                        (const int64_t*)labels.flat<int64>().data(),
+                        (const int64_t*)row_splits.flat<int64>().data(),
+                        boxes.dim_size(0), row_splits.dim_size(0) - 1,
+                        this->nms_overlap_thresh, keep_row_splits);
+
+        BatchedOutputAllocator output_allocator(context);
+        int64_t* ret_keep_indices = nullptr;
+        output_allocator.AllocKeepIndices(&ret_keep_indices,
+                                          keep_indices.size());
+        OPEN3D_ML_CUDA_CHECK(cudaMemcpy(ret_keep_indices, keep_indices.data(),
+                                        keep_indices.size() * sizeof(int64_t),
+                                        cudaMemcpyHostToDevice));
+        int64_t* ret_keep_row_splits = nullptr;
+        output_allocator.AllocKeepRowSplits(&ret_keep_row_splits,
+                                            keep_row_splits.size());
+        OPEN3D_ML_CUDA_CHECK(cudaMemcpy(
+                ret_keep_row_splits, keep_row_splits.data(),
+                keep_row_splits.size() * sizeof(int64_t),
+                cudaMemcpyHostToDevice));
+    }
+};
+
+#define REG_KB(type)                                            \
+    REGISTER_KERNEL_BUILDER(Name("Open3DBatchedNms")            \
+                                    .Device(DEVICE_GPU)         \
+                                    .TypeConstraint<type>("T"), \
+                            BatchedNmsOpKernelCUDA);
+REG_KB(float)
+#undef REG_KB
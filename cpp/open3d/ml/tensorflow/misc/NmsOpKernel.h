@@ -50,6 +50,34 @@ private:
     tensorflow::OpKernelContext* context;
 };
 
+class BatchedOutputAllocator {
+public:
+    BatchedOutputAllocator(tensorflow::OpKernelContext* context)
+        : context(context) {}
+
+    void AllocKeepIndices(int64_t** ptr, int64_t num) {
+        Alloc(0, ptr, num);
+    }
+
+    void AllocKeepRowSplits(int64_t** ptr, int64_t num) {
+        Alloc(1, ptr, num);
+    }
+
+private:
+    void Alloc(int output_idx, int64_t** ptr, int64_t num) {
+        using namespace tensorflow;
+        *ptr = nullptr;
+        Tensor* tensor = 0;
+        TensorShape shape({num});
+        OP_REQUIRES_OK(context,
+                       context->allocate_output(output_idx, shape, &tensor));
+        auto flat_tensor = tensor->flat<int64>();
+        *ptr = (int64_t*)flat_tensor.data();
+    }
+
+    tensorflow::OpKernelContext* context;
+};
+
 // Base class with common code for the OpKernel implementations
 class NmsOpKernel : public tensorflow::OpKernel {
 public:
@@ -85,5 +113,47 @@ protected:
     float nms_overlap_thresh;
 };
 
+// Base class with common code for the batched OpKernel implementations
+class BatchedNmsOpKernel : public tensorflow::OpKernel {
+public:
+    explicit BatchedNmsOpKernel(tensorflow::OpKernelConstruction* construction)
+        : OpKernel(construction) {
+        OP_REQUIRES_OK(construction,
+                       construction->GetAttr("nms_overlap_thresh",
+                                             &nms_overlap_thresh));
+    }
+
+    void Compute(tensorflow::OpKernelContext* context) override {
+        using namespace tensorflow;
+        const Tensor& boxes = context->input(0);
+        const Tensor& scores = context->input(1);
+        const Tensor& labels = context->input(2);
+        const Tensor& row_splits = context->input(3);
+
+        {
+            using namespace open3d::ml::op_util;
+            Dim num_points("num_points");
+            Dim batch_size("batch_size");
+            Dim five(5, "five");
+            CHECK_SHAPE(context, boxes, num_points, five);
+            CHECK_SHAPE(context, scores, num_points);
+            CHECK_SHAPE(context, labels, num_points);
+            CHECK_SHAPE(context, row_splits, batch_size + 1);
+        }
+
+        Kernel(context, boxes, scores, labels, row_splits);
+    }
+
+    // Function with the device specific code
+    virtual void Kernel(tensorflow::OpKernelContext* context,
+                        const tensorflow::Tensor& boxes,
+                        const tensorflow::Tensor& scores,
+                        const tensorflow::Tensor& labels,
+                        const tensorflow::Tensor& row_splits) = 0;
+
+protected:
+    float nms_overlap_thresh;
+};
+
 }  // namespace nms_opkernel
 /// @endcond
@@ -100,3 +100,76 @@ nms_overlap_thresh: float value between 0 and 1. When a high-score box is
 
 returns (M,) int64 tensor. The selected box indices.
 )doc");
+
+REGISTER_OP("Open3DBatchedNms")
+        .Attr("T: {float}")  // type for boxes and scores
+        .Attr("nms_overlap_thresh: float")
+        .Input("boxes: T")
+        .Input("scores: T")
+        .Input("labels: int64")
+        .Input("row_splits: int64")
+        .Output("keep_indices: int64")
+        .Output("keep_row_splits: int64")
+        .SetShapeFn([](::tensorflow::shape_inference::InferenceContext* c) {
+            using namespace ::tensorflow::shape_inference;
+            using namespace open3d::ml::op_util;
+            ShapeHandle boxes, scores, labels, row_splits;
+
+            TF_RETURN_IF_ERROR(c->WithRank(c->input(0), 2, &boxes));
+            TF_RETURN_IF_ERROR(c->WithRank(c->input(1), 1, &scores));
+            TF_RETURN_IF_ERROR(c->WithRank(c->input(2), 1, &labels));
+            TF_RETURN_IF_ERROR(c->WithRank(c->input(3), 1, &row_splits));
+
+            Dim num_points("num_points");
+            Dim batch_size("batch_size");
+            Dim five(5, "five");
+            CHECK_SHAPE_HANDLE(c, boxes, num_points, five);
+            CHECK_SHAPE_HANDLE(c, scores, num_points);
+            CHECK_SHAPE_HANDLE(c, labels, num_points);
+            CHECK_SHAPE_HANDLE(c, row_splits, batch_size + 1);
+
+            c->set_output(0, c->MakeShape({c->UnknownDim()}));
+            c->set_output(1, row_splits);
+            return Status::OK();
+        })
+        .Doc(R"doc(
+Performs non-maximum suppression for a batch of bounding boxes with multiple
+classes and returns the selected box indices. Boxes only suppress boxes of the
+same batch item and the same class. All batch items and classes are processed
+together.
+
+  # PyTorch example.
+  import torch
+  import open3d.ml.torch as ml3d
+
+  boxes = torch.Tensor([[15.0811, -7.9803, 15.6721, -6.8714, 0.5152],
+                        [15.1166, -7.9261, 15.7060, -6.8137, 0.6501],
+                        [15.1304, -7.8129, 15.7069, -6.8903, 0.7296],
+                        [15.2050, -7.8447, 15.8311, -6.7437, 1.0506],
+                        [15.1343, -7.8136, 15.7121, -6.8479, 1.0352],
+                        [15.0931, -7.9552, 15.6675, -7.0056, 0.5979]])
+  scores = torch.Tensor([3, 1.1, 5, 2, 1, 0])
+  labels = torch.LongTensor([0, 0, 0, 1, 1, 1])
+  row_splits = torch.LongTensor([0, 3, 6])
+  keep_indices, keep_row_splits = ml3d.ops.batched_nms(
+      boxes, scores, labels, row_splits, nms_overlap_thresh=0.7)
+
+boxes: (N, 5) float32 tensor. Bounding boxes are represented as (x0, y0, x1, y1, rotate).
+
+scores: (N,) float32 tensor. A higher score means a more confident bounding box.
+
+labels: (N,) int64 tensor with the class label of each box.
+
+row_splits: (B+1,) int64 tensor. The exclusive prefix sum that defines the
+  start and end of each batch item in boxes.
+
+nms_overlap_thresh: float value between 0 and 1. When a high-score box is
+  selected, other remaining boxes of the same batch item and class with
+  IoU > nms_overlap_thresh will be discarded.
+
+keep_indices: (M,) int64 tensor. The selected box indices. The indices are
+  sorted by batch item, then by class label and then by descending score.
+
+keep_row_splits: (B+1,) int64 tensor. The exclusive prefix sum that defines the
+  start and end of each batch item in keep_indices.
+)doc");
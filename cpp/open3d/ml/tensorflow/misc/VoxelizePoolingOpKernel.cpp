@@ -0,0 +1,104 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "VoxelizePoolingOpKernel.h"
+
+#include "open3d/ml/impl/misc/VoxelizePooling.h"
+
+using namespace open3d::ml::impl;
+using namespace voxelize_pooling_opkernel;
+using namespace tensorflow;
+
+template <class TReal, class TFeat>
+class VoxelizePoolingOpKernelCPU : public VoxelizePoolingOpKernel {
+public:
+    explicit VoxelizePoolingOpKernelCPU(OpKernelConstruction* construction)
+        : VoxelizePoolingOpKernel(construction) {}
+
+    void Kernel(tensorflow::OpKernelContext* context,
+                const tensorflow::Tensor& positions,
+                const tensorflow::Tensor& features,
+                const tensorflow::Tensor& voxel_size,
+                const tensorflow::Tensor& points_range_min,
+                const tensorflow::Tensor& points_range_max) {
+        OutputAllocator<TReal, TFeat> output_allocator(context);
+
+        VoxelizePoolingCPU<TReal, TFeat>(
+                positions.dim_size(0), positions.flat<TReal>().data(),
+                features.dim_size(1), features.flat<TFeat>().data(),
+                voxel_size.flat<TReal>().data(),
+                points_range_min.flat<TReal>().data(),
+                points_range_max.flat<TReal>().data(), output_allocator,
+                position_fn, feature_fn);
+    }
+};
+
+#define REG_KB(type, typefeat)                                          \
+    REGISTER_KERNEL_BUILDER(Name("Open3DVoxelizePooling")               \
+                                    .Device(DEVICE_CPU)                 \
+                                    .TypeConstraint<type>("TReal")      \
+                                    .TypeConstraint<typefeat>("TFeat"), \
+                            VoxelizePoolingOpKernelCPU<type, typefeat>);
+REG_KB(float, float)
+REG_KB(float, int)
+REG_KB(float, int64)
+REG_KB(float, double)
+REG_KB(double, float)
+REG_KB(double, int)
+REG_KB(double, int64)
+REG_KB(double, double)
+#undef REG_KB
+
+template <class TFeat>
+class VoxelizePoolingGradOpKernelCPU : public VoxelizePoolingGradOpKernel {
+public:
+    explicit VoxelizePoolingGradOpKernelCPU(
+            OpKernelConstruction* construction)
+        : VoxelizePoolingGradOpKernel(construction) {}
+
+    void Kernel(tensorflow::OpKernelContext* context,
+                tensorflow::Tensor& features_backprop,
+                const tensorflow::Tensor& voxel_point_indices,
+                const tensorflow::Tensor& voxel_point_row_splits,
+                const tensorflow::Tensor& pooling_indices,
+                const tensorflow::Tensor& pooled_features_gradient) {
+        VoxelizePoolingBackpropCPU<TFeat>(
+                features_backprop.flat<TFeat>().data(),
+                features_backprop.dim_size(0), features_backprop.dim_size(1),
+                voxel_point_row_splits.dim_size(0) - 1,
+                (int64_t*)voxel_point_indices.flat<int64>().data(),
+                (int64_t*)voxel_point_row_splits.flat<int64>().data(),
+                (int64_t*)pooling_indices.flat<int64>().data(),
+                pooled_features_gradient.flat<TFeat>().data(), feature_fn);
+    }
+};
+
+#define REG_KB(typefeat)                                                \
+    REGISTER_KERNEL_BUILDER(Name("Open3DVoxelizePoolingGrad")           \
+                                    .Device(DEVICE_CPU)                 \
+                                    .TypeConstraint<typefeat>("TFeat"), \
+                            VoxelizePoolingGradOpKernelCPU<typefeat>);
+REG_KB(float)
+REG_KB(double)
+// gradient computation is not supported for integer feature types by tensorflow
+#undef REG_KB
@@ -0,0 +1,234 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/ml/impl/misc/VoxelPoolingCommon.h"
+#include "open3d/ml/tensorflow/TensorFlowHelper.h"
+#include "tensorflow/core/framework/op.h"
+#include "tensorflow/core/framework/op_kernel.h"
+#include "tensorflow/core/lib/core/errors.h"
+
+/// @cond
+// namespace for code that is common for all kernels
+namespace voxelize_pooling_opkernel {
+
+template <class TReal, class TFeat>
+class OutputAllocator {
+public:
+    OutputAllocator(tensorflow::OpKernelContext* context) : context(context) {}
+
+    void AllocVoxelCoords(int32_t** ptr, int64_t rows, int64_t cols) {
+        using namespace tensorflow;
+        *ptr = nullptr;
+        Tensor* tensor = 0;
+        TensorShape shape({rows, cols});
+        OP_REQUIRES_OK(context, context->allocate_output(0, shape, &tensor));
+        auto flat_tensor = tensor->flat<int32_t>();
+        *ptr = flat_tensor.data();
+    }
+
+    void AllocPooledPositions(TReal** ptr, int64_t num) {
+        using namespace tensorflow;
+        *ptr = nullptr;
+        Tensor* tensor = 0;
+        TensorShape shape({num, 3});
+        OP_REQUIRES_OK(context, context->allocate_output(1, shape, &tensor));
+        auto flat_tensor = tensor->flat<TReal>();
+        *ptr = flat_tensor.data();
+    }
+
+    void AllocPooledFeatures(TFeat** ptr, int64_t num, int channels) {
+        using namespace tensorflow;
+        *ptr = nullptr;
+        Tensor* tensor = 0;
+        TensorShape shape({num, channels});
+        OP_REQUIRES_OK(context, context->allocate_output(2, shape, &tensor));
+        auto flat_tensor = tensor->flat<TFeat>();
+        *ptr = flat_tensor.data();
+    }
+
+    void AllocVoxelPointIndices(int64_t** ptr, int64_t num) {
+        using namespace tensorflow;
+        *ptr = nullptr;
+        Tensor* tensor = 0;
+        TensorShape shape({num});
+        OP_REQUIRES_OK(context, context->allocate_output(3, shape, &tensor));
+        auto flat_tensor = tensor->flat<int64>();
+        *ptr = (int64_t*)flat_tensor.data();
+    }
+
+    void AllocVoxelPointRowSplits(int64_t** ptr, int64_t num) {
+        using namespace tensorflow;
+        *ptr = nullptr;
+        Tensor* tensor = 0;
+        TensorShape shape({num});
+        OP_REQUIRES_OK(context, context->allocate_output(4, shape, &tensor));
+        auto flat_tensor = tensor->flat<int64>();
+        *ptr = (int64_t*)flat_tensor.data();
+    }
+
+    void AllocPoolingIndices(int64_t** ptr, int64_t rows, int64_t cols) {
+        using namespace tensorflow;
+        *ptr = nullptr;
+        Tensor* tensor = 0;
+        TensorShape shape({rows, cols});
+        OP_REQUIRES_OK(context, context->allocate_output(5, shape, &tensor));
+        auto flat_tensor = tensor->flat<int64>();
+        *ptr = (int64_t*)flat_tensor.data();
+    }
+
+private:
+    tensorflow::OpKernelContext* context;
+};
+
+inline open3d::ml::impl::AccumulationFn ParseFeatureFn(
+        const std::string& feat_fn_str) {
+    using namespace open3d::ml::impl;
+    if (feat_fn_str == "average")
+        return AVERAGE;
+    else if (feat_fn_str == "nearest_neighbor")
+        return NEAREST_NEIGHBOR;
+    else
+        return MAX;
+}
+
+// Base class with common code for the OpKernel implementations
+class VoxelizePoolingOpKernel : public tensorflow::OpKernel {
+public:
+    explicit VoxelizePoolingOpKernel(
+            tensorflow::OpKernelConstruction* construction)
+        : OpKernel(construction) {
+        using namespace open3d::ml::impl;
+        std::string pos_fn_str;
+        OP_REQUIRES_OK(construction,
+                       construction->GetAttr("position_fn", &pos_fn_str));
+
+        if (pos_fn_str == "average")
+            position_fn = AVERAGE;
+        else if (pos_fn_str == "nearest_neighbor")
+            position_fn = NEAREST_NEIGHBOR;
+        else
+            position_fn = CENTER;
+
+        std::string feat_fn_str;
+        OP_REQUIRES_OK(construction,
+                       construction->GetAttr("feature_fn", &feat_fn_str));
+        feature_fn = ParseFeatureFn(feat_fn_str);
+    }
+
+    void Compute(tensorflow::OpKernelContext* context) override {
+        using namespace tensorflow;
+        const Tensor& positions = context->input(0);
+        const Tensor& features = context->input(1);
+        const Tensor& voxel_size = context->input(2);
+        const Tensor& points_range_min = context->input(3);
+        const Tensor& points_range_max = context->input(4);
+
+        {
+            using namespace open3d::ml::op_util;
+            Dim num_points("num_points");
+            Dim num_channels("num_channels");
+            CHECK_SHAPE(context, positions, num_points, 3);
+            CHECK_SHAPE(context, features, num_points, num_channels);
+            CHECK_SHAPE(context, voxel_size, 3);
+            CHECK_SHAPE(context, points_range_min, 3);
+            CHECK_SHAPE(context, points_range_max, 3);
+        }
+
+        Kernel(context, positions, features, voxel_size, points_range_min,
+               points_range_max);
+    }
+
+    // Function with the device specific code
+    virtual void Kernel(tensorflow::OpKernelContext* context,
+                        const tensorflow::Tensor& positions,
+                        const tensorflow::Tensor& features,
+                        const tensorflow::Tensor& voxel_size,
+                        const tensorflow::Tensor& points_range_min,
+                        const tensorflow::Tensor& points_range_max) = 0;
+
+protected:
+    open3d::ml::impl::AccumulationFn position_fn;
+    open3d::ml::impl::AccumulationFn feature_fn;
+};
+
+// Base class with common code for the gradient OpKernel implementations
+class VoxelizePoolingGradOpKernel : public tensorflow::OpKernel {
+public:
+    explicit VoxelizePoolingGradOpKernel(
+            tensorflow::OpKernelConstruction* construction)
+        : OpKernel(construction) {
+        std::string feat_fn_str;
+        OP_REQUIRES_OK(construction,
+                       construction->GetAttr("feature_fn", &feat_fn_str));
+        feature_fn = ParseFeatureFn(feat_fn_str);
+    }
+
+    void Compute(tensorflow::OpKernelContext* context) override {
+        using namespace tensorflow;
+        const Tensor& features = context->input(0);
+        const Tensor& voxel_point_indices = context->input(1);
+        const Tensor& voxel_point_row_splits = context->input(2);
+        const Tensor& pooling_indices = context->input(3);
+        const Tensor& pooled_features_gradient = context->input(4);
+
+        {
+            using namespace open3d::ml::op_util;
+            Dim num_points("num_points");
+            Dim num_channels("num_channels");
+            Dim num_voxels("num_voxels");
+            CHECK_SHAPE(context, features, num_points, num_channels);
+            CHECK_SHAPE(context, voxel_point_indices, Dim());
+            CHECK_SHAPE(context, voxel_point_row_splits, num_voxels + 1);
+            CHECK_SHAPE(context, pooled_features_gradient, num_voxels,
+                        num_channels);
+            if (feature_fn != open3d::ml::impl::AVERAGE) {
+                CHECK_SHAPE(context, pooling_indices, num_voxels,
+                            num_channels);
+            }
+        }
+
+        Tensor* features_backprop = nullptr;
+        OP_REQUIRES_OK(context, context->allocate_output(0, features.shape(),
+                                                         &features_backprop));
+
+        Kernel(context, *features_backprop, voxel_point_indices,
+               voxel_point_row_splits, pooling_indices,
+               pooled_features_gradient);
+    }
+
+    // Function with the device specific code
+    virtual void Kernel(tensorflow::OpKernelContext* context,
+                        tensorflow::Tensor& features_backprop,
+                        const tensorflow::Tensor& voxel_point_indices,
+                        const tensorflow::Tensor& voxel_point_row_splits,
+                        const tensorflow::Tensor& pooling_indices,
+                        const tensorflow::Tensor& pooled_features_gradient) = 0;
+
+protected:
+    open3d::ml::impl::AccumulationFn feature_fn;
+};
+
+}  // namespace voxelize_pooling_opkernel
+/// @endcond
@@ -0,0 +1,221 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/ml/tensorflow/TensorFlowHelper.h"
+#include "tensorflow/core/framework/op.h"
+#include "tensorflow/core/framework/op_kernel.h"
+#include "tensorflow/core/framework/shape_inference.h"
+#include "tensorflow/core/lib/core/errors.h"
+
+using namespace tensorflow;
+
+REGISTER_OP("Open3DVoxelizePooling")
+        .Attr("TReal: {float, double}")  // type for the point positions
+        .Attr("TFeat: {float, double, int32, int64}")  // type for the features
+        .Attr("position_fn: {'average', 'nearest_neighbor', 'center'} = "
+              "'average'")
+        .Attr("feature_fn: {'average', 'nearest_neighbor', 'max'} = 'average'")
+        .Input("positions: TReal")
+        .Input("features: TFeat")
+        .Input("voxel_size: TReal")
+        .Input("points_range_min: TReal")
+        .Input("points_range_max: TReal")
+        .Output("voxel_coords: int32")
+        .Output("pooled_positions: TReal")
+        .Output("pooled_features: TFeat")
+        .Output("voxel_point_indices: int64")
+        .Output("voxel_point_row_splits: int64")
+        .Output("pooling_indices: int64")
+        .SetShapeFn([](::tensorflow::shape_inference::InferenceContext* c) {
+            using namespace ::tensorflow::shape_inference;
+            using namespace open3d::ml::op_util;
+            ShapeHandle positions, features, voxel_size, points_range_min,
+                    points_range_max;
+
+            TF_RETURN_IF_ERROR(c->WithRank(c->input(0), 2, &positions));
+            TF_RETURN_IF_ERROR(c->WithRank(c->input(1), 2, &features));
+            TF_RETURN_IF_ERROR(c->WithRank(c->input(2), 1, &voxel_size));
+            TF_RETURN_IF_ERROR(c->WithRank(c->input(3), 1, &points_range_min));
+            TF_RETURN_IF_ERROR(c->WithRank(c->input(4), 1, &points_range_max));
+
+            Dim num_points("num_points");
+            Dim num_channels("num_channels");
+            CHECK_SHAPE_HANDLE(c, positions, num_points, 3);
+            CHECK_SHAPE_HANDLE(c, features, num_points, num_channels);
+            CHECK_SHAPE_HANDLE(c, voxel_size, 3);
+            CHECK_SHAPE_HANDLE(c, points_range_min, 3);
+            CHECK_SHAPE_HANDLE(c, points_range_max, 3);
+
+            // we don't know the number of voxels
+            DimensionHandle channel_dim = c->UnknownDim();
+            if (num_channels.constant()) {
+                channel_dim = c->MakeDim(num_channels.value());
+            }
+            c->set_output(0, c->MakeShape({c->UnknownDim(), c->MakeDim(3)}));
+            c->set_output(1, c->MakeShape({c->UnknownDim(), c->MakeDim(3)}));
+            c->set_output(2, c->MakeShape({c->UnknownDim(), channel_dim}));
+            c->set_output(3, c->MakeShape({c->UnknownDim()}));
+            c->set_output(4, c->MakeShape({c->UnknownDim()}));
+            c->set_output(5, c->MakeShape({c->UnknownDim(), channel_dim}));
+
+            return Status::OK();
+        })
+        .Doc(R"doc(
+Voxelization and spatial pooling for point clouds in a single op.
+
+This op computes the same voxels as voxelize() and pools the positions and
+features of the points of each voxel. The voxels are sorted by their linear
+index and points outside of the range [points_range_min, points_range_max] are
+ignored. The grouping of the points is returned as well and is used to compute
+the gradient for the features without building a hash map again.
+
+Minimal example::
+
+  import open3d.ml.tf as ml3d
+
+  positions = [
+      [0.1,0.1,0.1],
+      [0.5,0.5,0.5],
+      [1.7,1.7,1.7],
+      [1.8,1.8,1.8],
+      [9.3,9.4,9.4]]
+
+  features = [[1.0,2.0],
+              [1.1,2.3],
+              [4.2,0.1],
+              [1.3,3.4],
+              [2.3,1.9]]
+
+  ml3d.ops.voxelize_pooling(positions,
+                            features,
+                            voxel_size=[1.0,1.0,1.0],
+                            points_range_min=[0,0,0],
+                            points_range_max=[2,2,2],
+                            position_fn='center',
+                            feature_fn='max')
+
+  # returns the voxel coordinates  [[0, 0, 0],
+  #                                 [1, 1, 1]]
+  #
+  #         the voxel centers      [[0.5, 0.5, 0.5],
+  #                                 [1.5, 1.5, 1.5]]
+  #
+  #         the max pooled features [[1.1, 2.3],
+  #                                  [4.2, 3.4]]
+  #
+  #         the point indices      [0, 1, 2, 3]
+  #
+  #         the point row splits   [0, 2, 4]
+  #
+  #         and the pooling indices [[1, 1],
+  #                                  [2, 3]]
+
+  # or with pytorch
+  import torch
+  import open3d.ml.torch as ml3d
+
+  positions = torch.Tensor([
+      [0.1,0.1,0.1],
+      [0.5,0.5,0.5],
+      [1.7,1.7,1.7],
+      [1.8,1.8,1.8],
+      [9.3,9.4,9.4]])
+
+  features = torch.Tensor([
+              [1.0,2.0],
+              [1.1,2.3],
+              [4.2,0.1],
+              [1.3,3.4],
+              [2.3,1.9]])
+
+  ml3d.ops.voxelize_pooling(positions,
+                            features,
+                            voxel_size=torch.Tensor([1.0,1.0,1.0]),
+                            points_range_min=torch.Tensor([0,0,0]),
+                            points_range_max=torch.Tensor([2,2,2]),
+                            position_fn='center',
+                            feature_fn='max')
+
+position_fn: Defines how the new point positions will be computed.
+  The options are
+    * "average" computes the center of gravity for the points within one voxel.
+    * "nearest_neighbor" selects the point closest to the voxel center.
+    * "center" uses the voxel center for the position of the generated point.
+
+feature_fn: Defines how the pooled features will be computed.
+  The options are
+    * "average" computes the average feature vector.
+    * "nearest_neighbor" selects the feature vector of the point closest to the voxel center.
+    * "max" uses the maximum feature among all points within the voxel.
+
+positions: The point positions with shape [N,3] with N as the number of points.
+
+features: The feature vector with shape [N,channels].
+
+voxel_size: The voxel size with shape [3].
+
+points_range_min: The minimum range for valid points to be voxelized. This
+  vector has shape [3] and is used as the origin for computing the voxel
+  coordinates.
+
+points_range_max: The maximum range for valid points to be voxelized. This
+  vector has shape [3].
+
+voxel_coords: The integer voxel coordinates. The shape of this tensor is [M,3]
+  with M as the number of voxels.
+
+pooled_positions: The output point positions with shape [M,3].
+
+pooled_features: The output point features with shape [M,channels].
+
+voxel_point_indices: A flat list of all the points that have been voxelized.
+  The start and end of each voxel is defined in voxel_point_row_splits.
+
+voxel_point_row_splits: This is an exclusive prefix sum that includes the total
+  number of points in the last element. The shape of this tensor is [M+1].
+
+pooling_indices: The index of the point that provides each pooled feature
+  value for the feature_fn 'nearest_neighbor' and 'max'. The shape of this
+  tensor is [M,channels] or [0,channels] if feature_fn is 'average'.
+
+)doc");
+
+REGISTER_OP("Open3DVoxelizePoolingGrad")
+        .Attr("TFeat: {float, double}")  // type for the features
+        .Attr("feature_fn: {'average', 'nearest_neighbor', 'max'} = 'average'")
+        .Input("features: TFeat")
+        .Input("voxel_point_indices: int64")
+        .Input("voxel_point_row_splits: int64")
+        .Input("pooling_indices: int64")
+        .Input("pooled_features_gradient: TFeat")
+        .Output("features_backprop: TFeat")
+        .SetShapeFn([](::tensorflow::shape_inference::InferenceContext* c) {
+            using namespace ::tensorflow::shape_inference;
+            ShapeHandle features_shape;
+            TF_RETURN_IF_ERROR(c->WithRank(c->input(0), 2, &features_shape));
+            c->set_output(0, features_shape);
+            return Status::OK();
+        })
+        .Doc(R"doc(
+Gradient for features in VoxelizePooling. For internal use only.
+)doc");
@@ -26,12 +26,16 @@
 
 #include "open3d/pipelines/color_map/ColorMapUtils.h"
 
+#include <algorithm>
+#include <numeric>
+
 #include "open3d/camera/PinholeCameraTrajectory.h"
 #include "open3d/geometry/Image.h"
 #include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/RGBDImage.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/pipelines/color_map/ImageWarpingField.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace pipelines {
@@ -130,69 +134,132 @@ std::vector<geometry::Image> CreateDepthBoundaryMasks(
     return masks;
 }
 
-std::tuple<std::vector<std::vector<int>>, std::vector<std::vector<int>>>
-CreateVertexAndImageVisibility(
+// Legacy visibility test of a vertex in one camera.
+static bool IsVertexVisible(
+        const Eigen::Vector3d& X,
+        const geometry::Image& image_depth,
+        const geometry::Image& image_mask,
+        const camera::PinholeCameraParameters& camera_parameter,
+        double maximum_allowable_depth,
+        double depth_threshold_for_visibility_check) {
+    float u, v, d;
+    std::tie(u, v, d) = Project3DPointAndGetUVDepth(X, camera_parameter);
+    int u_d = int(round(u)), v_d = int(round(v));
+    // Skip if vertex in image boundary.
+    if (d < 0.0 || !image_depth.TestImageBoundary(u_d, v_d)) {
+        return false;
+    }
+    // Skip if vertex's depth is too large (e.g. background).
+    float d_sensor = *image_depth.PointerAt<float>(u_d, v_d);
+    if (d_sensor > maximum_allowable_depth) {
+        return false;
+    }
+    // Check depth boundary mask. If a vertex is located at the boundary of an
+    // object, its color will be highly diverse from different viewing angles.
+    if (*image_mask.PointerAt<uint8_t>(u_d, v_d) == 255) {
+        return false;
+    }
+    // Check depth errors.
+    return std::fabs(d - d_sensor) < depth_threshold_for_visibility_check;
+}
+
+VertexAndImageVisibility CreateVertexAndImageVisibility(
         const geometry::TriangleMesh& mesh,
         const std::vector<geometry::Image>& images_depth,
         const std::vector<geometry::Image>& images_mask,
         const camera::PinholeCameraTrajectory& camera_trajectory,
         double maximum_allowable_depth,
         double depth_threshold_for_visibility_check) {
-    size_t n_camera = camera_trajectory.parameters_.size();
-    size_t n_vertex = mesh.vertices_.size();
-    // visibility_image_to_vertex[c]: vertices visible by camera c.
-    std::vector<std::vector<int>> visibility_image_to_vertex;
-    visibility_image_to_vertex.resize(n_camera);
-    // visibility_vertex_to_image[v]: cameras that can see vertex v.
-    std::vector<std::vector<int>> visibility_vertex_to_image;
-    visibility_vertex_to_image.resize(n_vertex);
+    int n_camera = int(camera_trajectory.parameters_.size());
+    int n_vertex = int(mesh.vertices_.size());
+    VertexAndImageVisibility visibility;
+    auto is_visible = [&](int vertex_id, int camera_id) {
+        return IsVertexVisible(mesh.vertices_[vertex_id],
+                               images_depth[camera_id], images_mask[camera_id],
+                               camera_trajectory.parameters_[camera_id],
+                               maximum_allowable_depth,
+                               depth_threshold_for_visibility_check);
+    };
 
-#pragma omp parallel for schedule(static)
-    for (int camera_id = 0; camera_id < int(n_camera); camera_id++) {
-        for (int vertex_id = 0; vertex_id < int(n_vertex); vertex_id++) {
-            Eigen::Vector3d X = mesh.vertices_[vertex_id];
-            float u, v, d;
-            std::tie(u, v, d) = Project3DPointAndGetUVDepth(
-                    X, camera_trajectory.parameters_[camera_id]);
-            int u_d = int(round(u)), v_d = int(round(v));
-            // Skip if vertex in image boundary.
-            if (d < 0.0 ||
-                !images_depth[camera_id].TestImageBoundary(u_d, v_d)) {
-                continue;
-            }
-            // Skip if vertex's depth is too large (e.g. background).
-            float d_sensor =
-                    *images_depth[camera_id].PointerAt<float>(u_d, v_d);
-            if (d_sensor > maximum_allowable_depth) {
-                continue;
+    // Count the images of each vertex, then fill them in place.
+    std::vector<int> counts(n_vertex);
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int vertex_id = 0; vertex_id < n_vertex; vertex_id++) {
+        int count = 0;
+        for (int camera_id = 0; camera_id < n_camera; camera_id++) {
+            count += is_visible(vertex_id, camera_id);
+        }
+        counts[vertex_id] = count;
+    }
+    visibility.vertex_offsets_.resize(n_vertex + 1);
+    visibility.vertex_offsets_[0] = 0;
+    std::partial_sum(counts.begin(), counts.end(),
+                     visibility.vertex_offsets_.begin() + 1);
+    visibility.vertex_to_image_.resize(visibility.vertex_offsets_[n_vertex]);
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int vertex_id = 0; vertex_id < n_vertex; vertex_id++) {
+        size_t pos = visibility.vertex_offsets_[vertex_id];
+        for (int camera_id = 0; camera_id < n_camera &&
+                                pos < visibility.vertex_offsets_[vertex_id + 1];
+             camera_id++) {
+            if (is_visible(vertex_id, camera_id)) {
+                visibility.vertex_to_image_[pos++] = camera_id;
             }
-            // Check depth boundary mask. If a vertex is located at the boundary
-            // of an object, its color will be highly diverse from different
-            // viewing angles.
-            if (*images_mask[camera_id].PointerAt<uint8_t>(u_d, v_d) == 255) {
-                continue;
+        }
+    }
+
+    // Transpose with a counting sort over contiguous chunks of vertices, so
+    // the vertices of each image stay sorted.
+    const int n_chunk = std::max(1, std::min(n_vertex, 256));
+    const int chunk_size = (n_vertex + n_chunk - 1) / n_chunk;
+    std::vector<size_t> chunk_counts(size_t(n_chunk) * n_camera, 0);
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int chunk = 0; chunk < n_chunk; chunk++) {
+        size_t* chunk_count = chunk_counts.data() + size_t(chunk) * n_camera;
+        int end = std::min(n_vertex, (chunk + 1) * chunk_size);
+        for (int vertex_id = chunk * chunk_size; vertex_id < end;
+             vertex_id++) {
+            const int* images = visibility.ImagesOfVertex(vertex_id);
+            for (int i = 0; i < visibility.NumImagesOfVertex(vertex_id); i++) {
+                chunk_count[images[i]]++;
             }
-            // Check depth errors.
-            if (std::fabs(d - d_sensor) >=
-                depth_threshold_for_visibility_check) {
-                continue;
+        }
+    }
+    visibility.image_offsets_.resize(n_camera + 1);
+    size_t total = 0;
+    for (int camera_id = 0; camera_id < n_camera; camera_id++) {
+        visibility.image_offsets_[camera_id] = total;
+        for (int chunk = 0; chunk < n_chunk; chunk++) {
+            size_t& count = chunk_counts[size_t(chunk) * n_camera + camera_id];
+            size_t start = total;
+            total += count;
+            count = start;
+        }
+    }
+    visibility.image_offsets_[n_camera] = total;
+    visibility.image_to_vertex_.resize(total);
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int chunk = 0; chunk < n_chunk; chunk++) {
+        size_t* cursor = chunk_counts.data() + size_t(chunk) * n_camera;
+        int end = std::min(n_vertex, (chunk + 1) * chunk_size);
+        for (int vertex_id = chunk * chunk_size; vertex_id < end;
+             vertex_id++) {
+            const int* images = visibility.ImagesOfVertex(vertex_id);
+            for (int i = 0; i < visibility.NumImagesOfVertex(vertex_id); i++) {
+                visibility.image_to_vertex_[cursor[images[i]]++] = vertex_id;
             }
-            visibility_image_to_vertex[camera_id].push_back(vertex_id);
-#pragma omp critical
-            { visibility_vertex_to_image[vertex_id].push_back(camera_id); }
         }
     }
 
-    for (int camera_id = 0; camera_id < int(n_camera); camera_id++) {
-        size_t n_visible_vertex = visibility_image_to_vertex[camera_id].size();
+    for (int camera_id = 0; camera_id < n_camera; camera_id++) {
+        size_t n_visible_vertex = visibility.NumVerticesOfImage(camera_id);
         utility::LogDebug(
                 "[cam {:d}]: {:d}/{:d} ({:.5f}%) vertices are visible",
                 camera_id, n_visible_vertex, n_vertex,
                 double(n_visible_vertex) / n_vertex * 100);
     }
 
-    return std::make_tuple(visibility_vertex_to_image,
-                           visibility_image_to_vertex);
+    return visibility;
 }
 
 void SetProxyIntensityForVertex(
@@ -200,19 +267,19 @@ void SetProxyIntensityForVertex(
         const std::vector<geometry::Image>& images_gray,
         const utility::optional<std::vector<ImageWarpingField>>& warping_fields,
         const camera::PinholeCameraTrajectory& camera_trajectory,
-        const std::vector<std::vector<int>>& visibility_vertex_to_image,
+        const VertexAndImageVisibility& visibility,
         std::vector<double>& proxy_intensity,
         int image_boundary_margin) {
     auto n_vertex = mesh.vertices_.size();
     proxy_intensity.resize(n_vertex);
 
-#pragma omp parallel for schedule(static)
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
     for (int i = 0; i < int(n_vertex); i++) {
         proxy_intensity[i] = 0.0;
         float sum = 0.0;
-        for (size_t iter = 0; iter < visibility_vertex_to_image[i].size();
-             iter++) {
-            int j = visibility_vertex_to_image[i][iter];
+        const int* images = visibility.ImagesOfVertex(i);
+        for (int iter = 0; iter < visibility.NumImagesOfVertex(i); iter++) {
+            int j = images[iter];
             float gray;
             bool valid = false;
             if (warping_fields.has_value()) {
@@ -243,21 +310,20 @@ void SetGeometryColorAverage(
         const std::vector<geometry::Image>& images_color,
         const utility::optional<std::vector<ImageWarpingField>>& warping_fields,
         const camera::PinholeCameraTrajectory& camera_trajectory,
-        const std::vector<std::vector<int>>& visibility_vertex_to_image,
+        const VertexAndImageVisibility& visibility,
         int image_boundary_margin,
         int invisible_vertex_color_knn) {
     size_t n_vertex = mesh.vertices_.size();
     mesh.vertex_colors_.clear();
     mesh.vertex_colors_.resize(n_vertex);
-    std::vector<size_t> valid_vertices;
-    std::vector<size_t> invalid_vertices;
-#pragma omp parallel for schedule(static)
+    std::vector<uint8_t> is_valid(n_vertex, 0);
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
     for (int i = 0; i < (int)n_vertex; i++) {
         mesh.vertex_colors_[i] = Eigen::Vector3d::Zero();
         double sum = 0.0;
-        for (size_t iter = 0; iter < visibility_vertex_to_image[i].size();
-             iter++) {
-            int j = visibility_vertex_to_image[i][iter];
+        const int* images = visibility.ImagesOfVertex(i);
+        for (int iter = 0; iter < visibility.NumImagesOfVertex(i); iter++) {
+            int j = images[iter];
             uint8_t r_temp, g_temp, b_temp;
             bool valid = false;
             utility::optional<ImageWarpingField> optional_warping_field;
@@ -283,21 +349,21 @@ void SetGeometryColorAverage(
                 sum += 1.0;
             }
         }
-#pragma omp critical
-        {
-            if (sum > 0.0) {
-                mesh.vertex_colors_[i] /= sum;
-                valid_vertices.push_back(i);
-            } else {
-                invalid_vertices.push_back(i);
-            }
+        if (sum > 0.0) {
+            mesh.vertex_colors_[i] /= sum;
+            is_valid[i] = 1;
         }
     }
+    std::vector<size_t> valid_vertices;
+    std::vector<size_t> invalid_vertices;
+    for (size_t i = 0; i < n_vertex; i++) {
+        (is_valid[i] ? valid_vertices : invalid_vertices).push_back(i);
+    }
     if (invisible_vertex_color_knn > 0) {
         std::shared_ptr<geometry::TriangleMesh> valid_mesh =
                 mesh.SelectByIndex(valid_vertices);
         geometry::KDTreeFlann kd_tree(*valid_mesh);
-#pragma omp parallel for schedule(static)
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
         for (int i = 0; i < (int)invalid_vertices.size(); ++i) {
             size_t invalid_vertex = invalid_vertices[i];
             std::vector<int> indices;  // indices to valid_mesh
@@ -41,6 +41,36 @@ namespace open3d {
 namespace pipelines {
 namespace color_map {
 
+/// \class VertexAndImageVisibility
+///
+/// \brief Visibility of the vertices in the images, as compressed sparse rows
+/// in both directions.
+struct VertexAndImageVisibility {
+    /// Number of images that see vertex \p v.
+    int NumImagesOfVertex(int v) const {
+        return int(vertex_offsets_[v + 1] - vertex_offsets_[v]);
+    }
+    /// Images that see vertex \p v, in increasing order.
+    const int* ImagesOfVertex(int v) const {
+        return vertex_to_image_.data() + vertex_offsets_[v];
+    }
+    /// Number of vertices seen by image \p c.
+    int NumVerticesOfImage(int c) const {
+        return int(image_offsets_[c + 1] - image_offsets_[c]);
+    }
+    /// Vertices seen by image \p c, in increasing order.
+    const int* VerticesOfImage(int c) const {
+        return image_to_vertex_.data() + image_offsets_[c];
+    }
+
+    /// Row offsets of vertex_to_image_, of size n_vertex + 1.
+    std::vector<size_t> vertex_offsets_;
+    std::vector<int> vertex_to_image_;
+    /// Row offsets of image_to_vertex_, of size n_camera + 1.
+    std::vector<size_t> image_offsets_;
+    std::vector<int> image_to_vertex_;
+};
+
 std::tuple<std::vector<geometry::Image>,
            std::vector<geometry::Image>,
            std::vector<geometry::Image>,
@@ -53,8 +83,10 @@ std::vector<geometry::Image> CreateDepthBoundaryMasks(
         double depth_threshold_for_discontinuity_check,
         int half_dilation_kernel_size_for_discontinuity_map);
 
-std::tuple<std::vector<std::vector<int>>, std::vector<std::vector<int>>>
-CreateVertexAndImageVisibility(
+/// Builds the visibility without locks: the images of each vertex are
+/// counted, then written after a prefix sum, and transposed into the
+/// vertices of each image by a parallel counting sort.
+VertexAndImageVisibility CreateVertexAndImageVisibility(
         const geometry::TriangleMesh& mesh,
         const std::vector<geometry::Image>& images_depth,
         const std::vector<geometry::Image>& images_mask,
@@ -67,7 +99,7 @@ void SetProxyIntensityForVertex(
         const std::vector<geometry::Image>& images_gray,
         const utility::optional<std::vector<ImageWarpingField>>& warping_fields,
         const camera::PinholeCameraTrajectory& camera_trajectory,
-        const std::vector<std::vector<int>>& visibility_vertex_to_image,
+        const VertexAndImageVisibility& visibility,
         std::vector<double>& proxy_intensity,
         int image_boundary_margin);
 
@@ -76,7 +108,7 @@ void SetGeometryColorAverage(
         const std::vector<geometry::Image>& images_color,
         const utility::optional<std::vector<ImageWarpingField>>& warping_fields,
         const camera::PinholeCameraTrajectory& camera_trajectory,
-        const std::vector<std::vector<int>>& visibility_vertex_to_image,
+        const VertexAndImageVisibility& visibility,
         int image_boundary_margin = 10,
         int invisible_vertex_color_knn = 3);
 
@@ -36,6 +36,7 @@
 #include "open3d/pipelines/color_map/ColorMapUtils.h"
 #include "open3d/pipelines/color_map/ImageWarpingField.h"
 #include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Parallel.h"
 
 namespace Eigen {
 
@@ -81,7 +82,7 @@ static std::tuple<MatOutType, VecOutType, double> ComputeJTJandJTrNonRigid(
     double r2_sum = 0.0;
     JTJ.setZero();
     JTr.setZero();
-#pragma omp parallel
+#pragma omp parallel num_threads(utility::EstimateMaxThreads())
     {
         MatOutType JTJ_private(6 + nonrigidval, 6 + nonrigidval);
         VecOutType JTr_private(6 + nonrigidval);
@@ -131,7 +132,7 @@ static void ComputeJacobianAndResidualNonRigid(
         const ImageWarpingField& warping_fields,
         const Eigen::Matrix4d& intrinsic,
         const Eigen::Matrix4d& extrinsic,
-        const std::vector<int>& visibility_image_to_vertex,
+        const int* visibility_image_to_vertex,
         const int image_boundary_margin) {
     J_r.setZero();
     pattern.setZero();
@@ -235,8 +236,7 @@ geometry::TriangleMesh RunNonRigidOptimizer(
     std::vector<geometry::Image> images_color;
     std::vector<geometry::Image> images_depth;
     std::vector<geometry::Image> images_mask;
-    std::vector<std::vector<int>> visibility_vertex_to_image;
-    std::vector<std::vector<int>> visibility_image_to_vertex;
+    VertexAndImageVisibility visibility;
     std::vector<ImageWarpingField> warping_fields_init;
 
     // Create all debugging directories. We don't delete any existing files but
@@ -280,11 +280,10 @@ geometry::TriangleMesh RunNonRigidOptimizer(
     }
 
     utility::LogDebug("[ColorMapOptimization] CreateVertexAndImageVisibility");
-    std::tie(visibility_vertex_to_image, visibility_image_to_vertex) =
-            CreateVertexAndImageVisibility(
-                    opt_mesh, images_depth, images_mask, opt_camera_trajectory,
-                    option.maximum_allowable_depth_,
-                    option.depth_threshold_for_visibility_check_);
+    visibility = CreateVertexAndImageVisibility(
+            opt_mesh, images_depth, images_mask, opt_camera_trajectory,
+            option.maximum_allowable_depth_,
+            option.depth_threshold_for_visibility_check_);
 
     utility::LogDebug("[ColorMapOptimization] Non-Rigid Optimization");
     warping_fields = CreateWarpingFields(images_gray,
@@ -295,14 +294,14 @@ geometry::TriangleMesh RunNonRigidOptimizer(
     size_t n_vertex = opt_mesh.vertices_.size();
     int n_camera = int(opt_camera_trajectory.parameters_.size());
     SetProxyIntensityForVertex(opt_mesh, images_gray, warping_fields,
-                               opt_camera_trajectory,
-                               visibility_vertex_to_image, proxy_intensity,
+                               opt_camera_trajectory, visibility,
+                               proxy_intensity,
                                option.image_boundary_margin_);
     for (int itr = 0; itr < option.maximum_iteration_; itr++) {
         utility::LogDebug("[Iteration {:04d}] ", itr + 1);
         double residual = 0.0;
         double residual_reg = 0.0;
-#pragma omp parallel for schedule(static)
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
         for (int c = 0; c < n_camera; c++) {
             int nonrigidval = warping_fields[c].anchor_w_ *
                               warping_fields[c].anchor_h_ * 2;
@@ -324,7 +323,7 @@ geometry::TriangleMesh RunNonRigidOptimizer(
                         i, J_r, r, pattern, opt_mesh, proxy_intensity,
                         images_gray[c], images_dx[c], images_dy[c],
                         warping_fields[c], intr, extrinsic,
-                        visibility_image_to_vertex[c],
+                        visibility.VerticesOfImage(c),
                         option.image_boundary_margin_);
             };
             Eigen::MatrixXd JTJ;
@@ -333,11 +332,11 @@ geometry::TriangleMesh RunNonRigidOptimizer(
             std::tie(JTJ, JTr, r2) =
                     ComputeJTJandJTrNonRigid<Eigen::Vector14d, Eigen::Vector14i,
                                              Eigen::MatrixXd, Eigen::VectorXd>(
-                            f_lambda, int(visibility_image_to_vertex[c].size()),
+                            f_lambda, visibility.NumVerticesOfImage(c),
                             nonrigidval, false);
 
             double weight = option.non_rigid_anchor_point_weight_ *
-                            visibility_image_to_vertex[c].size() / n_vertex;
+                            visibility.NumVerticesOfImage(c) / n_vertex;
             for (int j = 0; j < nonrigidval; j++) {
                 double r = weight * (warping_fields[c].flow_(j) -
                                      warping_fields_init[c].flow_(j));
@@ -371,15 +370,14 @@ geometry::TriangleMesh RunNonRigidOptimizer(
         utility::LogDebug("Residual error : {:.6f}, reg : {:.6f}", residual,
                           residual_reg);
         SetProxyIntensityForVertex(opt_mesh, images_gray, warping_fields,
-                                   opt_camera_trajectory,
-                                   visibility_vertex_to_image, proxy_intensity,
+                                   opt_camera_trajectory, visibility,
+                                   proxy_intensity,
                                    option.image_boundary_margin_);
 
         if (!option.debug_output_dir_.empty()) {
             // Save opt_mesh.
             SetGeometryColorAverage(opt_mesh, images_color, warping_fields,
-                                    opt_camera_trajectory,
-                                    visibility_vertex_to_image,
+                                    opt_camera_trajectory, visibility,
                                     option.image_boundary_margin_,
                                     option.invisible_vertex_color_knn_);
             std::string file_name = fmt::format(
@@ -407,7 +405,7 @@ geometry::TriangleMesh RunNonRigidOptimizer(
 
     utility::LogDebug("[ColorMapOptimization] Set Mesh Color");
     SetGeometryColorAverage(opt_mesh, images_color, warping_fields,
-                            opt_camera_trajectory, visibility_vertex_to_image,
+                            opt_camera_trajectory, visibility,
                             option.image_boundary_margin_,
                             option.invisible_vertex_color_knn_);
 
@@ -36,6 +36,7 @@
 #include "open3d/pipelines/color_map/ImageWarpingField.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Optional.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace pipelines {
@@ -57,7 +58,7 @@ static void ComputeJacobianAndResidualRigid(
         const geometry::Image& images_dy,
         const Eigen::Matrix4d& intrinsic,
         const Eigen::Matrix4d& extrinsic,
-        const std::vector<int>& visibility_image_to_vertex,
+        const int* visibility_image_to_vertex,
         const int image_boundary_margin) {
     J_r.setZero();
     r = 0;
@@ -104,8 +105,7 @@ geometry::TriangleMesh RunRigidOptimizer(
     std::vector<geometry::Image> images_color;
     std::vector<geometry::Image> images_depth;
     std::vector<geometry::Image> images_mask;
-    std::vector<std::vector<int>> visibility_vertex_to_image;
-    std::vector<std::vector<int>> visibility_image_to_vertex;
+    VertexAndImageVisibility visibility;
 
     // Create all debugging directories. We don't delete any existing files but
     // will overwrite them if the names are the same.
@@ -146,25 +146,24 @@ geometry::TriangleMesh RunRigidOptimizer(
     }
 
     utility::LogDebug("[ColorMapOptimization] CreateVertexAndImageVisibility");
-    std::tie(visibility_vertex_to_image, visibility_image_to_vertex) =
-            CreateVertexAndImageVisibility(
-                    opt_mesh, images_depth, images_mask, opt_camera_trajectory,
-                    option.maximum_allowable_depth_,
-                    option.depth_threshold_for_visibility_check_);
+    visibility = CreateVertexAndImageVisibility(
+            opt_mesh, images_depth, images_mask, opt_camera_trajectory,
+            option.maximum_allowable_depth_,
+            option.depth_threshold_for_visibility_check_);
 
     utility::LogDebug("[ColorMapOptimization] Rigid Optimization");
     std::vector<double> proxy_intensity;
     int total_num_ = 0;
     int n_camera = int(opt_camera_trajectory.parameters_.size());
     SetProxyIntensityForVertex(opt_mesh, images_gray, utility::nullopt,
-                               opt_camera_trajectory,
-                               visibility_vertex_to_image, proxy_intensity,
+                               opt_camera_trajectory, visibility,
+                               proxy_intensity,
                                option.image_boundary_margin_);
     for (int itr = 0; itr < option.maximum_iteration_; itr++) {
         utility::LogDebug("[Iteration {:04d}] ", itr + 1);
         double residual = 0.0;
         total_num_ = 0;
-#pragma omp parallel for schedule(static)
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
         for (int c = 0; c < n_camera; c++) {
             Eigen::Matrix4d pose;
             pose = opt_camera_trajectory.parameters_[c].extrinsic_;
@@ -182,7 +181,7 @@ geometry::TriangleMesh RunRigidOptimizer(
                 ComputeJacobianAndResidualRigid(
                         i, J_r, r, w, opt_mesh, proxy_intensity, images_gray[c],
                         images_dx[c], images_dy[c], intr, extrinsic,
-                        visibility_image_to_vertex[c],
+                        visibility.VerticesOfImage(c),
                         option.image_boundary_margin_);
             };
             Eigen::Matrix6d JTJ;
@@ -190,7 +189,7 @@ geometry::TriangleMesh RunRigidOptimizer(
             double r2;
             std::tie(JTJ, JTr, r2) =
                     utility::ComputeJTJandJTr<Eigen::Matrix6d, Eigen::Vector6d>(
-                            f_lambda, int(visibility_image_to_vertex[c].size()),
+                            f_lambda, visibility.NumVerticesOfImage(c),
                             false);
 
             bool is_success;
@@ -203,21 +202,20 @@ geometry::TriangleMesh RunRigidOptimizer(
 #pragma omp critical
             {
                 residual += r2;
-                total_num_ += int(visibility_image_to_vertex[c].size());
+                total_num_ += visibility.NumVerticesOfImage(c);
             }
         }
         utility::LogDebug("Residual error : {:.6f} (avg : {:.6f})", residual,
                           residual / total_num_);
         SetProxyIntensityForVertex(opt_mesh, images_gray, utility::nullopt,
-                                   opt_camera_trajectory,
-                                   visibility_vertex_to_image, proxy_intensity,
+                                   opt_camera_trajectory, visibility,
+                                   proxy_intensity,
                                    option.image_boundary_margin_);
 
         if (!option.debug_output_dir_.empty()) {
             // Save opt_mesh.
             SetGeometryColorAverage(opt_mesh, images_color, utility::nullopt,
-                                    opt_camera_trajectory,
-                                    visibility_vertex_to_image,
+                                    opt_camera_trajectory, visibility,
                                     option.image_boundary_margin_,
                                     option.invisible_vertex_color_knn_);
             std::string file_name = fmt::format(
@@ -236,7 +234,7 @@ geometry::TriangleMesh RunRigidOptimizer(
 
     utility::LogDebug("[ColorMapOptimization] Set Mesh Color");
     SetGeometryColorAverage(opt_mesh, images_color, utility::nullopt,
-                            opt_camera_trajectory, visibility_vertex_to_image,
+                            opt_camera_trajectory, visibility,
                             option.image_boundary_margin_,
                             option.invisible_vertex_color_knn_);
 
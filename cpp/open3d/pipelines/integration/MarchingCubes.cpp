@@ -0,0 +1,188 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/pipelines/integration/MarchingCubes.h"
+
+#include "open3d/pipelines/integration/MarchingCubesConst.h"
+
+namespace open3d {
+namespace pipelines {
+namespace integration {
+
+namespace {
+
+int NumTrianglesOf(int cube_index) {
+    int num_triangles = 0;
+    for (int i = 0; tri_table[cube_index][i] != -1; i += 3) {
+        num_triangles++;
+    }
+    return num_triangles;
+}
+
+}  // namespace
+
+constexpr float MarchingCubesBlock::kUnobserved;
+
+MarchingCubesBlock::MarchingCubesBlock(int resolution)
+    : resolution_(resolution),
+      tsdf_((resolution + 2) * (resolution + 2) * (resolution + 2),
+            kUnobserved),
+      cube_index_((resolution + 2) * (resolution + 2) * (resolution + 2), 0),
+      vertex_mask_(resolution * resolution * resolution, 0),
+      vertex_offset_(resolution * resolution * resolution, 0) {}
+
+void MarchingCubesBlock::ComputeCubeIndices(int x) {
+    int corner_offsets[8];
+    for (int i = 0; i < 8; i++) {
+        corner_offsets[i] = PaddedIndexOf(shift[i](0), shift[i](1),
+                                          shift[i](2)) -
+                            PaddedIndexOf(0, 0, 0);
+    }
+    for (int y = -1; y < resolution_; y++) {
+        for (int z = -1; z < resolution_; z++) {
+            const int ind = PaddedIndexOf(x, y, z);
+            int cube_index = 0;
+            for (int i = 0; i < 8; i++) {
+                const float f = tsdf_[ind + corner_offsets[i]];
+                if (f == kUnobserved) {
+                    cube_index = 0;
+                    break;
+                }
+                if (f < 0.0f) {
+                    cube_index |= (1 << i);
+                }
+            }
+            cube_index_[ind] = cube_index == 255 ? 0 : uint8_t(cube_index);
+        }
+    }
+}
+
+int MarchingCubesBlock::CountVertices(int x) {
+    const int strides[3] = {(resolution_ + 2) * (resolution_ + 2),
+                            resolution_ + 2, 1};
+    int num_vertices = 0;
+    for (int y = 0; y < resolution_; y++) {
+        for (int z = 0; z < resolution_; z++) {
+            const int ind = PaddedIndexOf(x, y, z);
+            const float f0 = tsdf_[ind];
+            uint8_t mask = 0;
+            for (int axis = 0; f0 != kUnobserved && axis < 3; axis++) {
+                if ((tsdf_[ind + strides[axis]] < 0.0f) == (f0 < 0.0f)) {
+                    continue;
+                }
+                // The edge has a vertex if one of the four cubes sharing it
+                // has triangles. Their configuration then has the edge set,
+                // since the signs at its ends differ.
+                const int stride1 = strides[(axis + 1) % 3];
+                const int stride2 = strides[(axis + 2) % 3];
+                if (cube_index_[ind] != 0 || cube_index_[ind - stride1] != 0 ||
+                    cube_index_[ind - stride2] != 0 ||
+                    cube_index_[ind - stride1 - stride2] != 0) {
+                    mask |= (1 << axis);
+                    num_vertices++;
+                }
+            }
+            vertex_mask_[IndexOf(x, y, z)] = mask;
+        }
+    }
+    return num_vertices;
+}
+
+int MarchingCubesBlock::SetVertexOffset(int x, int offset) {
+    for (int y = 0; y < resolution_; y++) {
+        for (int z = 0; z < resolution_; z++) {
+            const int ind = IndexOf(x, y, z);
+            vertex_offset_[ind] = offset;
+            for (int axis = 0; axis < 3; axis++) {
+                offset += (vertex_mask_[ind] >> axis) & 1;
+            }
+        }
+    }
+    return offset;
+}
+
+int MarchingCubesBlock::CountTriangles(int x) const {
+    int num_triangles = 0;
+    for (int y = 0; y < resolution_; y++) {
+        for (int z = 0; z < resolution_; z++) {
+            num_triangles +=
+                    NumTrianglesOf(cube_index_[PaddedIndexOf(x, y, z)]);
+        }
+    }
+    return num_triangles;
+}
+
+int MarchingCubesBlock::FillTriangles(
+        int x,
+        const std::array<const MarchingCubesBlock *, 8> &neighbors,
+        Eigen::Vector3i *triangles) const {
+    int num_triangles = 0;
+    int edge_to_index[12];
+    for (int y = 0; y < resolution_; y++) {
+        for (int z = 0; z < resolution_; z++) {
+            const int cube_index = cube_index_[PaddedIndexOf(x, y, z)];
+            if (cube_index == 0) {
+                continue;
+            }
+            for (int i = 0; i < 12; i++) {
+                if (edge_table[cube_index] & (1 << i)) {
+                    Eigen::Vector3i voxel = Eigen::Vector3i(x, y, z) +
+                                            edge_shift[i].head<3>();
+                    int neighbor = 0;
+                    for (int j = 0; j < 3; j++) {
+                        if (voxel(j) == resolution_) {
+                            voxel(j) = 0;
+                            neighbor |= (1 << j);
+                        }
+                    }
+                    edge_to_index[i] = neighbors[neighbor]->VertexIndexOf(
+                            voxel(0), voxel(1), voxel(2), edge_shift[i](3));
+                }
+            }
+            for (int i = 0; tri_table[cube_index][i] != -1; i += 3) {
+                triangles[num_triangles++] = Eigen::Vector3i(
+                        edge_to_index[tri_table[cube_index][i]],
+                        edge_to_index[tri_table[cube_index][i + 2]],
+                        edge_to_index[tri_table[cube_index][i + 1]]);
+            }
+        }
+    }
+    return num_triangles;
+}
+
+int MarchingCubesBlock::VertexIndexOf(int x, int y, int z, int axis) const {
+    const int ind = IndexOf(x, y, z);
+    int vertex_index = vertex_offset_[ind];
+    for (int i = 0; i < axis; i++) {
+        vertex_index += (vertex_mask_[ind] >> i) & 1;
+    }
+    return vertex_index;
+}
+
+}  // namespace integration
+}  // namespace pipelines
+}  // namespace open3d
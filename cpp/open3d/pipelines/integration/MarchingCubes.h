@@ -0,0 +1,155 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <Eigen/Core>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace open3d {
+namespace pipelines {
+namespace integration {
+
+/// \class MarchingCubesBlock
+///
+/// \brief Marching cubes over a cubic block of voxels, split into passes that
+/// can run in parallel over x slices.
+///
+/// The block owns the voxels in [0, resolution)^3 and the cubes whose origin
+/// lies there. The vertex on a grid edge is owned by the voxel at the start
+/// of the edge, so every vertex is created exactly once and its index follows
+/// from a prefix sum of the per-slice vertex counts, without a hash map of
+/// edges. The output order only depends on the voxel order, not on the
+/// number of threads.
+///
+/// TSDF values are read from a compact Float32 copy that is padded by one
+/// voxel on each side, so cubes and edges on the border of the block see the
+/// neighboring blocks. The passes are:
+/// 1. Fill TSDFAt() for coordinates in [-1, resolution].
+/// 2. ComputeCubeIndices() for x in [-1, resolution).
+/// 3. CountVertices() for x in [0, resolution).
+/// 4. SetVertexOffset() with the exclusive prefix sum of the counts, then
+///    ForEachVertex() to compute the vertex attributes.
+/// 5. CountTriangles() for x in [0, resolution), then FillTriangles() with
+///    the exclusive prefix sum of the counts.
+/// Each pass needs the previous one to be finished for all slices.
+class MarchingCubesBlock {
+public:
+    /// TSDF value of voxels that have not been observed.
+    static constexpr float kUnobserved = std::numeric_limits<float>::max();
+
+    explicit MarchingCubesBlock(int resolution);
+
+public:
+    int GetResolution() const { return resolution_; }
+
+    /// TSDF value of voxel (x, y, z), for coordinates in [-1, resolution].
+    float &TSDFAt(int x, int y, int z) { return tsdf_[PaddedIndexOf(x, y, z)]; }
+    float TSDFAt(int x, int y, int z) const {
+        return tsdf_[PaddedIndexOf(x, y, z)];
+    }
+
+    /// Computes the cube configuration of the cubes with origin in slice x.
+    void ComputeCubeIndices(int x);
+
+    /// Marks the edges owned by slice x that carry a vertex, and returns the
+    /// number of vertices.
+    int CountVertices(int x);
+
+    /// Assigns the vertices of slice x consecutive indices from \p offset,
+    /// and returns the index following the last one.
+    int SetVertexOffset(int x, int offset);
+
+    /// Calls f(vertex_index, voxel, axis, f0, f1) for every vertex owned by
+    /// slice x. The vertex lies on the edge from \p voxel to its neighbor
+    /// along \p axis, with TSDF values f0 and f1 at the two ends.
+    template <typename F>
+    void ForEachVertex(int x, F f) const {
+        for (int y = 0; y < resolution_; y++) {
+            for (int z = 0; z < resolution_; z++) {
+                const int ind = IndexOf(x, y, z);
+                if (vertex_mask_[ind] == 0) {
+                    continue;
+                }
+                int vertex_index = vertex_offset_[ind];
+                const float f0 = TSDFAt(x, y, z);
+                for (int axis = 0; axis < 3; axis++) {
+                    if (vertex_mask_[ind] & (1 << axis)) {
+                        Eigen::Vector3i voxel(x, y, z);
+                        Eigen::Vector3i voxel1 = voxel;
+                        voxel1(axis) += 1;
+                        f(vertex_index++, voxel, axis, f0,
+                          TSDFAt(voxel1(0), voxel1(1), voxel1(2)));
+                    }
+                }
+            }
+        }
+    }
+
+    /// Returns the number of triangles of the cubes with origin in slice x.
+    int CountTriangles(int x) const;
+
+    /// Writes the triangles of slice x to \p triangles, and returns their
+    /// number. Edges on the far
+    /// border of the block are owned by the neighboring blocks:
+    /// neighbors[(dz << 2) | (dy << 1) | dx] is the block offset by
+    /// (dx, dy, dz), with neighbors[0] being this block.
+    int FillTriangles(
+            int x,
+            const std::array<const MarchingCubesBlock *, 8> &neighbors,
+            Eigen::Vector3i *triangles) const;
+
+private:
+    int IndexOf(int x, int y, int z) const {
+        return (x * resolution_ + y) * resolution_ + z;
+    }
+
+    int PaddedIndexOf(int x, int y, int z) const {
+        return ((x + 1) * (resolution_ + 2) + y + 1) * (resolution_ + 2) + z +
+               1;
+    }
+
+    int VertexIndexOf(int x, int y, int z, int axis) const;
+
+private:
+    int resolution_;
+    /// Padded TSDF values.
+    std::vector<float> tsdf_;
+    /// Padded cube configurations, 0 for cubes without triangles.
+    std::vector<uint8_t> cube_index_;
+    /// Bit i is set if the edge along axis i from the voxel has a vertex.
+    std::vector<uint8_t> vertex_mask_;
+    /// Index of the first vertex owned by the voxel.
+    std::vector<int> vertex_offset_;
+};
+
+}  // namespace integration
+}  // namespace pipelines
+}  // namespace open3d
@@ -26,12 +26,17 @@
 
 #include "open3d/pipelines/integration/ScalableTSDFVolume.h"
 
+#include <array>
+#include <numeric>
 #include <unordered_set>
 
 #include "open3d/geometry/PointCloud.h"
+#include "open3d/pipelines/integration/MarchingCubes.h"
 #include "open3d/pipelines/integration/MarchingCubesConst.h"
 #include "open3d/pipelines/integration/UniformTSDFVolume.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/Parallel.h"
+#include "open3d/utility/Trace.h"
 
 namespace open3d {
 namespace pipelines {
@@ -55,6 +60,7 @@ void ScalableTSDFVolume::Integrate(
         const geometry::RGBDImage &image,
         const camera::PinholeCameraIntrinsic &intrinsic,
         const Eigen::Matrix4d &extrinsic) {
+    OPEN3D_TRACE_SCOPE("TSDF::Integrate");
     if ((image.depth_.num_of_channels_ != 1) ||
         (image.depth_.bytes_per_channel_ != 4) ||
         (color_type_ == TSDFVolumeColorType::RGB8 &&
@@ -104,22 +110,30 @@ void ScalableTSDFVolume::Integrate(
         for (auto x = min_bound(0); x <= max_bound(0); x++) {
             for (auto y = min_bound(1); y <= max_bound(1); y++) {
                 for (auto z = min_bound(2); z <= max_bound(2); z++) {
-                    auto loc = Eigen::Vector3i(x, y, z);
-                    if (touched_volume_units_.find(loc) ==
-                        touched_volume_units_.end()) {
-                        touched_volume_units_.insert(loc);
-                        auto volume = OpenVolumeUnit(Eigen::Vector3i(x, y, z));
-                        volume->IntegrateWithDepthToCameraDistanceMultiplier(
-                                image, intrinsic, extrinsic,
-                                *depth2cameradistance);
-                    }
+                    touched_volume_units_.insert(Eigen::Vector3i(x, y, z));
                 }
             }
         }
     }
+
+    // Open the volume units up front, since inserting into volume_units_ is
+    // not thread-safe. The units are then independent and integrated in
+    // parallel; the voxel loop inside each unit runs serially in the nested
+    // parallel region.
+    std::vector<std::shared_ptr<UniformTSDFVolume>> volumes;
+    volumes.reserve(touched_volume_units_.size());
+    for (const auto &index : touched_volume_units_) {
+        volumes.push_back(OpenVolumeUnit(index));
+    }
+#pragma omp parallel for schedule(dynamic) num_threads(utility::EstimateMaxThreads())
+    for (int i = 0; i < static_cast<int>(volumes.size()); i++) {
+        volumes[i]->IntegrateWithDepthToCameraDistanceMultiplier(
+                image, intrinsic, extrinsic, *depth2cameradistance);
+    }
 }
 
 std::shared_ptr<geometry::PointCloud> ScalableTSDFVolume::ExtractPointCloud() {
+    OPEN3D_TRACE_SCOPE("TSDF::ExtractPointCloud");
     auto pointcloud = std::make_shared<geometry::PointCloud>();
     double half_voxel_length = voxel_length_ * 0.5;
     float w0, w1, f0, f1;
@@ -223,150 +237,170 @@ std::shared_ptr<geometry::PointCloud> ScalableTSDFVolume::ExtractPointCloud() {
 
 std::shared_ptr<geometry::TriangleMesh>
 ScalableTSDFVolume::ExtractTriangleMesh() {
+    OPEN3D_TRACE_SCOPE("TSDF::ExtractTriangleMesh");
     // implementation of marching cubes, based on
     // http://paulbourke.net/geometry/polygonise/
+    // Every volume unit is a block processed by one thread. Vertices and
+    // triangles are counted per unit, and written to their final place after
+    // a prefix sum over the units.
     auto mesh = std::make_shared<geometry::TriangleMesh>();
     double half_voxel_length = voxel_length_ * 0.5;
-    std::unordered_map<
-            Eigen::Vector4i, int, utility::hash_eigen<Eigen::Vector4i>,
-            std::equal_to<Eigen::Vector4i>,
-            Eigen::aligned_allocator<std::pair<const Eigen::Vector4i, int>>>
-            edgeindex_to_vertexindex;
-    int edge_to_index[12];
+    const int resolution = volume_unit_resolution_;
+    std::vector<const VolumeUnit *> units;
+    std::unordered_map<Eigen::Vector3i, int,
+                       utility::hash_eigen<Eigen::Vector3i>>
+            unit_to_block;
     for (const auto &unit : volume_units_) {
         if (unit.second.volume_) {
-            const auto &volume0 = *unit.second.volume_;
-            const auto &index0 = unit.second.index_;
-            for (int x = 0; x < volume0.resolution_; x++) {
-                for (int y = 0; y < volume0.resolution_; y++) {
-                    for (int z = 0; z < volume0.resolution_; z++) {
-                        Eigen::Vector3i idx0(x, y, z);
-                        int cube_index = 0;
-                        float w[8];
-                        float f[8];
-                        Eigen::Vector3d c[8];
-                        for (int i = 0; i < 8; i++) {
-                            Eigen::Vector3i index1 = index0;
-                            Eigen::Vector3i idx1 = idx0 + shift[i];
-                            if (idx1(0) < volume_unit_resolution_ &&
-                                idx1(1) < volume_unit_resolution_ &&
-                                idx1(2) < volume_unit_resolution_) {
-                                w[i] = volume0.voxels_[volume0.IndexOf(idx1)]
-                                               .weight_;
-                                f[i] = volume0.voxels_[volume0.IndexOf(idx1)]
-                                               .tsdf_;
-                                if (color_type_ == TSDFVolumeColorType::RGB8)
-                                    c[i] = volume0.voxels_[volume0.IndexOf(
-                                                                   idx1)]
-                                                   .color_.cast<double>() /
-                                           255.0;
-                                else if (color_type_ ==
-                                         TSDFVolumeColorType::Gray32)
-                                    c[i] = volume0.voxels_[volume0.IndexOf(
-                                                                   idx1)]
-                                                   .color_.cast<double>();
-                            } else {
-                                for (int j = 0; j < 3; j++) {
-                                    if (idx1(j) >= volume_unit_resolution_) {
-                                        idx1(j) -= volume_unit_resolution_;
-                                        index1(j) += 1;
-                                    }
-                                }
-                                auto unit_itr1 = volume_units_.find(index1);
-                                if (unit_itr1 == volume_units_.end()) {
-                                    w[i] = 0.0f;
-                                    f[i] = 0.0f;
-                                } else {
-                                    const auto &volume1 =
-                                            *unit_itr1->second.volume_;
-                                    w[i] = volume1.voxels_[volume1.IndexOf(
-                                                                   idx1)]
-                                                   .weight_;
-                                    f[i] = volume1.voxels_[volume1.IndexOf(
-                                                                   idx1)]
-                                                   .tsdf_;
-                                    if (color_type_ ==
-                                        TSDFVolumeColorType::RGB8)
-                                        c[i] = volume1.voxels_[volume1.IndexOf(
-                                                                       idx1)]
-                                                       .color_.cast<double>() /
-                                               255.0;
-                                    else if (color_type_ ==
-                                             TSDFVolumeColorType::Gray32)
-                                        c[i] = volume1.voxels_[volume1.IndexOf(
-                                                                       idx1)]
-                                                       .color_.cast<double>();
-                                }
-                            }
-                            if (w[i] == 0.0f) {
-                                cube_index = 0;
-                                break;
-                            } else {
-                                if (f[i] < 0.0f) {
-                                    cube_index |= (1 << i);
-                                }
-                            }
-                        }
-                        if (cube_index == 0 || cube_index == 255) {
-                            continue;
-                        }
-                        for (int i = 0; i < 12; i++) {
-                            if (edge_table[cube_index] & (1 << i)) {
-                                Eigen::Vector4i edge_index =
-                                        Eigen::Vector4i(index0(0), index0(1),
-                                                        index0(2), 0) *
-                                                volume_unit_resolution_ +
-                                        Eigen::Vector4i(x, y, z, 0) +
-                                        edge_shift[i];
-                                if (edgeindex_to_vertexindex.find(edge_index) ==
-                                    edgeindex_to_vertexindex.end()) {
-                                    edge_to_index[i] =
-                                            (int)mesh->vertices_.size();
-                                    edgeindex_to_vertexindex[edge_index] =
-                                            (int)mesh->vertices_.size();
-                                    Eigen::Vector3d pt(
-                                            half_voxel_length +
-                                                    voxel_length_ *
-                                                            edge_index(0),
-                                            half_voxel_length +
-                                                    voxel_length_ *
-                                                            edge_index(1),
-                                            half_voxel_length +
-                                                    voxel_length_ *
-                                                            edge_index(2));
-                                    double f0 = std::abs(
-                                            (double)f[edge_to_vert[i][0]]);
-                                    double f1 = std::abs(
-                                            (double)f[edge_to_vert[i][1]]);
-                                    pt(edge_index(3)) +=
-                                            f0 * voxel_length_ / (f0 + f1);
-                                    mesh->vertices_.push_back(pt);
-                                    if (color_type_ !=
-                                        TSDFVolumeColorType::NoColor) {
-                                        const auto &c0 = c[edge_to_vert[i][0]];
-                                        const auto &c1 = c[edge_to_vert[i][1]];
-                                        mesh->vertex_colors_.push_back(
-                                                (f1 * c0 + f0 * c1) /
-                                                (f0 + f1));
-                                    }
-                                } else {
-                                    edge_to_index[i] = edgeindex_to_vertexindex
-                                            [edge_index];
-                                }
-                            }
-                        }
-                        for (int i = 0; tri_table[cube_index][i] != -1;
-                             i += 3) {
-                            mesh->triangles_.push_back(Eigen::Vector3i(
-                                    edge_to_index[tri_table[cube_index][i]],
-                                    edge_to_index[tri_table[cube_index][i + 2]],
-                                    edge_to_index[tri_table[cube_index]
-                                                           [i + 1]]));
-                        }
+            unit_to_block[unit.first] = static_cast<int>(units.size());
+            units.push_back(&unit.second);
+        }
+    }
+    const int num_units = static_cast<int>(units.size());
+
+    // neighbor_blocks[i * 27 + (dx + 1) * 9 + (dy + 1) * 3 + dz + 1] is the
+    // block of the unit offset by (dx, dy, dz) from unit i, or -1.
+    std::vector<int> neighbor_blocks(num_units * 27, -1);
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int i = 0; i < num_units; i++) {
+        for (int j = 0; j < 27; j++) {
+            auto itr = unit_to_block.find(
+                    units[i]->index_ +
+                    Eigen::Vector3i(j / 9 - 1, j / 3 % 3 - 1, j % 3 - 1));
+            if (itr != unit_to_block.end()) {
+                neighbor_blocks[i * 27 + j] = itr->second;
+            }
+        }
+    }
+    // Returns the block holding voxel idx of unit i, or -1, and makes idx
+    // relative to that block. Coordinates are in [-1, resolution].
+    auto locate = [&](int i, Eigen::Vector3i &idx) {
+        int neighbor = 0;
+        for (int j = 0; j < 3; j++) {
+            const int d = idx(j) < 0 ? -1 : (idx(j) < resolution ? 0 : 1);
+            idx(j) -= d * resolution;
+            neighbor = neighbor * 3 + d + 1;
+        }
+        return neighbor_blocks[i * 27 + neighbor];
+    };
+
+    std::vector<MarchingCubesBlock> blocks(num_units,
+                                           MarchingCubesBlock(resolution));
+    std::vector<uint8_t> observed(num_units, 0);
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int i = 0; i < num_units; i++) {
+        const auto &volume = *units[i]->volume_;
+        for (int x = 0; x < resolution; x++) {
+            for (int y = 0; y < resolution; y++) {
+                for (int z = 0; z < resolution; z++) {
+                    const auto &voxel = volume.voxels_[volume.IndexOf(x, y, z)];
+                    if (voxel.weight_ != 0.0f) {
+                        blocks[i].TSDFAt(x, y, z) = voxel.tsdf_;
+                        observed[i] = 1;
+                    }
+                }
+            }
+        }
+    }
+    std::vector<int> vertex_offsets(num_units + 1, 0);
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int i = 0; i < num_units; i++) {
+        // Every cube and edge of the block has a corner in the block, so a
+        // block without observed voxels has neither vertices nor triangles.
+        if (!observed[i]) {
+            continue;
+        }
+        // Copy the one voxel wide border from the neighboring blocks.
+        auto &block = blocks[i];
+        for (int x = -1; x <= resolution; x++) {
+            for (int y = -1; y <= resolution; y++) {
+                const bool inside =
+                        x >= 0 && x < resolution && y >= 0 && y < resolution;
+                for (int z = -1; z <= resolution;
+                     z = (inside && z == -1) ? resolution : z + 1) {
+                    Eigen::Vector3i idx(x, y, z);
+                    const int neighbor = locate(i, idx);
+                    if (neighbor >= 0) {
+                        block.TSDFAt(x, y, z) = blocks[neighbor].TSDFAt(
+                                idx(0), idx(1), idx(2));
                     }
                 }
             }
         }
+        for (int x = -1; x < resolution; x++) {
+            block.ComputeCubeIndices(x);
+        }
+        for (int x = 0; x < resolution; x++) {
+            vertex_offsets[i + 1] += block.CountVertices(x);
+        }
+    }
+    std::partial_sum(vertex_offsets.begin(), vertex_offsets.end(),
+                     vertex_offsets.begin());
+    mesh->vertices_.resize(vertex_offsets.back());
+    if (color_type_ != TSDFVolumeColorType::NoColor) {
+        mesh->vertex_colors_.resize(vertex_offsets.back());
+    }
+
+    std::vector<int> triangle_offsets(num_units + 1, 0);
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int i = 0; i < num_units; i++) {
+        auto &block = blocks[i];
+        const auto &volume0 = *units[i]->volume_;
+        const Eigen::Vector3i unit_origin = units[i]->index_ * resolution;
+        int offset = vertex_offsets[i];
+        for (int x = 0; x < resolution; x++) {
+            offset = block.SetVertexOffset(x, offset);
+            block.ForEachVertex(x, [&](int vertex_index,
+                                       const Eigen::Vector3i &idx0, int axis,
+                                       float tsdf0, float tsdf1) {
+                const Eigen::Vector3i edge_index = unit_origin + idx0;
+                Eigen::Vector3d pt(
+                        half_voxel_length + voxel_length_ * edge_index(0),
+                        half_voxel_length + voxel_length_ * edge_index(1),
+                        half_voxel_length + voxel_length_ * edge_index(2));
+                double f0 = std::abs((double)tsdf0);
+                double f1 = std::abs((double)tsdf1);
+                pt(axis) += f0 * voxel_length_ / (f0 + f1);
+                mesh->vertices_[vertex_index] = pt;
+                if (color_type_ != TSDFVolumeColorType::NoColor) {
+                    Eigen::Vector3i idx1 = idx0;
+                    idx1(axis) += 1;
+                    const auto &volume1 = *units[locate(i, idx1)]->volume_;
+                    Eigen::Vector3d c0 =
+                            volume0.voxels_[volume0.IndexOf(idx0)].color_;
+                    Eigen::Vector3d c1 =
+                            volume1.voxels_[volume1.IndexOf(idx1)].color_;
+                    if (color_type_ == TSDFVolumeColorType::RGB8) {
+                        c0 /= 255.0;
+                        c1 /= 255.0;
+                    }
+                    mesh->vertex_colors_[vertex_index] =
+                            (f1 * c0 + f0 * c1) / (f0 + f1);
+                }
+            });
+            triangle_offsets[i + 1] += block.CountTriangles(x);
+        }
+    }
+    std::partial_sum(triangle_offsets.begin(), triangle_offsets.end(),
+                     triangle_offsets.begin());
+    mesh->triangles_.resize(triangle_offsets.back());
+
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int i = 0; i < num_units; i++) {
+        // Cubes on the far border of the unit use the edges of the units
+        // offset by (dx, dy, dz) in {0, 1}^3.
+        std::array<const MarchingCubesBlock *, 8> neighbors;
+        for (int j = 0; j < 8; j++) {
+            const int block = neighbor_blocks[i * 27 + ((j & 1) + 1) * 9 +
+                                              (((j >> 1) & 1) + 1) * 3 +
+                                              (j >> 2) + 1];
+            neighbors[j] = block < 0 ? nullptr : &blocks[block];
+        }
+        Eigen::Vector3i *triangles =
+                mesh->triangles_.data() + triangle_offsets[i];
+        for (int x = 0; x < resolution; x++) {
+            triangles += blocks[i].FillTriangles(x, neighbors, triangles);
+        }
     }
     return mesh;
 }
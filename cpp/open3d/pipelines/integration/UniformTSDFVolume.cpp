@@ -26,13 +26,16 @@
 
 #include "open3d/pipelines/integration/UniformTSDFVolume.h"
 
+#include <array>
 #include <iostream>
+#include <numeric>
 #include <thread>
-#include <unordered_map>
 
 #include "open3d/geometry/VoxelGrid.h"
-#include "open3d/pipelines/integration/MarchingCubesConst.h"
+#include "open3d/pipelines/integration/MarchingCubes.h"
 #include "open3d/utility/Helper.h"
+#include "open3d/utility/Parallel.h"
+#include "open3d/utility/Trace.h"
 
 namespace open3d {
 namespace pipelines {
@@ -60,6 +63,7 @@ void UniformTSDFVolume::Integrate(
         const geometry::RGBDImage &image,
         const camera::PinholeCameraIntrinsic &intrinsic,
         const Eigen::Matrix4d &extrinsic) {
+    OPEN3D_TRACE_SCOPE("TSDF::Integrate");
     // This function goes through the voxels, and scan convert the relative
     // depth/color value into the voxel.
     // The following implementation is a highly optimized version.
@@ -102,6 +106,7 @@ void UniformTSDFVolume::Integrate(
 }
 
 std::shared_ptr<geometry::PointCloud> UniformTSDFVolume::ExtractPointCloud() {
+    OPEN3D_TRACE_SCOPE("TSDF::ExtractPointCloud");
     auto pointcloud = std::make_shared<geometry::PointCloud>();
     double half_voxel_length = voxel_length_ * 0.5;
     for (int x = 1; x < resolution_ - 1; x++) {
@@ -159,87 +164,85 @@ std::shared_ptr<geometry::PointCloud> UniformTSDFVolume::ExtractPointCloud() {
 
 std::shared_ptr<geometry::TriangleMesh>
 UniformTSDFVolume::ExtractTriangleMesh() {
+    OPEN3D_TRACE_SCOPE("TSDF::ExtractTriangleMesh");
     // implementation of marching cubes, based on
     // http://paulbourke.net/geometry/polygonise/
+    // Vertices and triangles are counted per x slice in parallel, and written
+    // to their final place after a prefix sum over the slices.
     auto mesh = std::make_shared<geometry::TriangleMesh>();
     double half_voxel_length = voxel_length_ * 0.5;
-    // Map of "edge_index = (x, y, z, 0) + edge_shift" to "global vertex index"
-    std::unordered_map<
-            Eigen::Vector4i, int, utility::hash_eigen<Eigen::Vector4i>,
-            std::equal_to<Eigen::Vector4i>,
-            Eigen::aligned_allocator<std::pair<const Eigen::Vector4i, int>>>
-            edgeindex_to_vertexindex;
-    int edge_to_index[12];
-    for (int x = 0; x < resolution_ - 1; x++) {
-        for (int y = 0; y < resolution_ - 1; y++) {
-            for (int z = 0; z < resolution_ - 1; z++) {
-                int cube_index = 0;
-                float f[8];
-                Eigen::Vector3d c[8];
-                for (int i = 0; i < 8; i++) {
-                    Eigen::Vector3i idx = Eigen::Vector3i(x, y, z) + shift[i];
-
-                    if (voxels_[IndexOf(idx)].weight_ == 0.0f) {
-                        cube_index = 0;
-                        break;
-                    } else {
-                        f[i] = voxels_[IndexOf(idx)].tsdf_;
-                        if (f[i] < 0.0f) {
-                            cube_index |= (1 << i);
-                        }
-                        if (color_type_ == TSDFVolumeColorType::RGB8) {
-                            c[i] = voxels_[IndexOf(idx)].color_.cast<double>() /
-                                   255.0;
-                        } else if (color_type_ == TSDFVolumeColorType::Gray32) {
-                            c[i] = voxels_[IndexOf(idx)].color_.cast<double>();
-                        }
-                    }
-                }
-                if (cube_index == 0 || cube_index == 255) {
-                    continue;
-                }
-                for (int i = 0; i < 12; i++) {
-                    if (edge_table[cube_index] & (1 << i)) {
-                        Eigen::Vector4i edge_index =
-                                Eigen::Vector4i(x, y, z, 0) + edge_shift[i];
-                        if (edgeindex_to_vertexindex.find(edge_index) ==
-                            edgeindex_to_vertexindex.end()) {
-                            edge_to_index[i] = (int)mesh->vertices_.size();
-                            edgeindex_to_vertexindex[edge_index] =
-                                    (int)mesh->vertices_.size();
-                            Eigen::Vector3d pt(
-                                    half_voxel_length +
-                                            voxel_length_ * edge_index(0),
-                                    half_voxel_length +
-                                            voxel_length_ * edge_index(1),
-                                    half_voxel_length +
-                                            voxel_length_ * edge_index(2));
-                            double f0 = std::abs((double)f[edge_to_vert[i][0]]);
-                            double f1 = std::abs((double)f[edge_to_vert[i][1]]);
-                            pt(edge_index(3)) += f0 * voxel_length_ / (f0 + f1);
-                            mesh->vertices_.push_back(pt + origin_);
-                            if (color_type_ != TSDFVolumeColorType::NoColor) {
-                                const auto &c0 = c[edge_to_vert[i][0]];
-                                const auto &c1 = c[edge_to_vert[i][1]];
-                                mesh->vertex_colors_.push_back(
-                                        (f1 * c0 + f0 * c1) / (f0 + f1));
-                            }
-                        } else {
-                            edge_to_index[i] =
-                                    edgeindex_to_vertexindex.find(edge_index)
-                                            ->second;
-                        }
-                    }
-                }
-                for (int i = 0; tri_table[cube_index][i] != -1; i += 3) {
-                    mesh->triangles_.push_back(Eigen::Vector3i(
-                            edge_to_index[tri_table[cube_index][i]],
-                            edge_to_index[tri_table[cube_index][i + 2]],
-                            edge_to_index[tri_table[cube_index][i + 1]]));
+    MarchingCubesBlock block(resolution_);
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int x = 0; x < resolution_; x++) {
+        for (int y = 0; y < resolution_; y++) {
+            for (int z = 0; z < resolution_; z++) {
+                const geometry::TSDFVoxel &voxel = voxels_[IndexOf(x, y, z)];
+                if (voxel.weight_ != 0.0f) {
+                    block.TSDFAt(x, y, z) = voxel.tsdf_;
                 }
             }
         }
     }
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int x = -1; x < resolution_; x++) {
+        block.ComputeCubeIndices(x);
+    }
+
+    std::vector<int> vertex_offsets(resolution_ + 1, 0);
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int x = 0; x < resolution_; x++) {
+        vertex_offsets[x + 1] = block.CountVertices(x);
+    }
+    std::partial_sum(vertex_offsets.begin(), vertex_offsets.end(),
+                     vertex_offsets.begin());
+    mesh->vertices_.resize(vertex_offsets.back());
+    if (color_type_ != TSDFVolumeColorType::NoColor) {
+        mesh->vertex_colors_.resize(vertex_offsets.back());
+    }
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int x = 0; x < resolution_; x++) {
+        block.SetVertexOffset(x, vertex_offsets[x]);
+        block.ForEachVertex(x, [&](int vertex_index,
+                                   const Eigen::Vector3i &idx0, int axis,
+                                   float tsdf0, float tsdf1) {
+            Eigen::Vector3d pt(half_voxel_length + voxel_length_ * idx0(0),
+                               half_voxel_length + voxel_length_ * idx0(1),
+                               half_voxel_length + voxel_length_ * idx0(2));
+            double f0 = std::abs((double)tsdf0);
+            double f1 = std::abs((double)tsdf1);
+            pt(axis) += f0 * voxel_length_ / (f0 + f1);
+            mesh->vertices_[vertex_index] = pt + origin_;
+            if (color_type_ != TSDFVolumeColorType::NoColor) {
+                Eigen::Vector3i idx1 = idx0;
+                idx1(axis) += 1;
+                Eigen::Vector3d c0 = voxels_[IndexOf(idx0)].color_;
+                Eigen::Vector3d c1 = voxels_[IndexOf(idx1)].color_;
+                if (color_type_ == TSDFVolumeColorType::RGB8) {
+                    c0 /= 255.0;
+                    c1 /= 255.0;
+                }
+                mesh->vertex_colors_[vertex_index] =
+                        (f1 * c0 + f0 * c1) / (f0 + f1);
+            }
+        });
+    }
+
+    std::vector<int> triangle_offsets(resolution_ + 1, 0);
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int x = 0; x < resolution_; x++) {
+        triangle_offsets[x + 1] = block.CountTriangles(x);
+    }
+    std::partial_sum(triangle_offsets.begin(), triangle_offsets.end(),
+                     triangle_offsets.begin());
+    mesh->triangles_.resize(triangle_offsets.back());
+    // Cubes on the far border have unobserved corners, so all edges are
+    // owned by this block.
+    const std::array<const MarchingCubesBlock *, 8> neighbors = {&block};
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int x = 0; x < resolution_; x++) {
+        block.FillTriangles(x, neighbors,
+                            mesh->triangles_.data() + triangle_offsets[x]);
+    }
     return mesh;
 }
 
@@ -313,9 +316,9 @@ void UniformTSDFVolume::IntegrateWithDepthToCameraDistanceMultiplier(
     const float safe_height_f = intrinsic.height_ - 0.0001f;
 
 #ifdef _WIN32
-#pragma omp parallel for schedule(static)
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
 #else
-#pragma omp parallel for collapse(2) schedule(static)
+#pragma omp parallel for collapse(2) schedule(static) num_threads(utility::EstimateMaxThreads())
 #endif
     for (int x = 0; x < resolution_; x++) {
         for (int y = 0; y < resolution_; y++) {
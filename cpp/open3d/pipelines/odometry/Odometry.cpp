@@ -33,6 +33,7 @@
 #include "open3d/geometry/RGBDImage.h"
 #include "open3d/pipelines/odometry/RGBDOdometryJacobian.h"
 #include "open3d/utility/Eigen.h"
+#include "open3d/utility/Parallel.h"
 #include "open3d/utility/Timer.h"
 
 namespace open3d {
@@ -134,7 +135,7 @@ static std::shared_ptr<CorrespondenceSetPixelWise> ComputeCorrespondence(
     std::tie(correspondence_map, depth_buffer) =
             InitializeCorrespondenceMap(depth_t.width_, depth_t.height_);
 
-#pragma omp parallel
+#pragma omp parallel num_threads(utility::EstimateMaxThreads())
     {
         std::shared_ptr<geometry::Image> correspondence_map_private;
         std::shared_ptr<geometry::Image> depth_buffer_private;
@@ -253,7 +254,7 @@ static Eigen::Matrix6d CreateInformationMatrix(
     // see http://redwood-data.org/indoor/registration.html
     // note: I comes first and q_skew is scaled by factor 2.
     Eigen::Matrix6d GTG = Eigen::Matrix6d::Identity();
-#pragma omp parallel
+#pragma omp parallel num_threads(utility::EstimateMaxThreads())
     {
         Eigen::Matrix6d GTG_private = Eigen::Matrix6d::Identity();
         Eigen::Vector6d G_r_private = Eigen::Vector6d::Zero();
@@ -286,13 +287,16 @@ static Eigen::Matrix6d CreateInformationMatrix(
     return GTG;
 }
 
-static void NormalizeIntensity(geometry::Image &image_s,
-                               geometry::Image &image_t,
-                               CorrespondenceSetPixelWise &correspondence) {
+// Scales that normalize the mean intensities of the corresponding pixels of
+// two images to 0.5.
+static std::tuple<double, double> ComputeIntensityScales(
+        const geometry::Image &image_s,
+        const geometry::Image &image_t,
+        const CorrespondenceSetPixelWise &correspondence) {
     if (image_s.width_ != image_t.width_ ||
         image_s.height_ != image_t.height_) {
         utility::LogError(
-                "[NormalizeIntensity] Size of two input images should be "
+                "[ComputeIntensityScales] Size of two input images should be "
                 "same");
     }
     double mean_s = 0.0, mean_t = 0.0;
@@ -306,8 +310,21 @@ static void NormalizeIntensity(geometry::Image &image_s,
     }
     mean_s /= (double)correspondence.size();
     mean_t /= (double)correspondence.size();
-    image_s.LinearTransform(0.5 / mean_s, 0.0);
-    image_t.LinearTransform(0.5 / mean_t, 0.0);
+    return std::make_tuple(0.5 / mean_s, 0.5 / mean_t);
+}
+
+// Copy of a pyramid with the intensities multiplied by scale. Filtering and
+// downsampling are linear, so this equals the pyramid of the scaled image.
+static geometry::RGBDImagePyramid ScaleIntensityPyramid(
+        const geometry::RGBDImagePyramid &pyramid, double scale) {
+    geometry::RGBDImagePyramid scaled;
+    scaled.reserve(pyramid.size());
+    for (const auto &level : pyramid) {
+        auto scaled_level = std::make_shared<geometry::RGBDImage>(*level);
+        scaled_level->color_.LinearTransform(scale, 0.0);
+        scaled.push_back(scaled_level);
+    }
+    return scaled;
 }
 
 static inline std::shared_ptr<geometry::RGBDImage> PackRGBDImage(
@@ -376,42 +393,64 @@ static inline bool CheckRGBDImagePair(const geometry::RGBDImage &source,
     return false;
 }
 
-static std::tuple<std::shared_ptr<geometry::RGBDImage>,
-                  std::shared_ptr<geometry::RGBDImage>>
-InitializeRGBDOdometry(
-        const geometry::RGBDImage &source,
-        const geometry::RGBDImage &target,
+static inline bool CheckRGBDImageFormat(const geometry::RGBDImage &image) {
+    return CheckImagePair(image.color_, image.depth_) &&
+           image.depth_.num_of_channels_ == 1 &&
+           image.depth_.bytes_per_channel_ == 4 &&
+           ((image.color_.num_of_channels_ == 3 &&
+             image.color_.bytes_per_channel_ == 1) ||
+            (image.color_.num_of_channels_ == 1 &&
+             image.color_.bytes_per_channel_ == 4));
+}
+
+// Frame preprocessed for the odometry: the smoothed intensity and depth
+// before the intensity normalization of a pair, their pyramids, the
+// gradients of the pyramids if the frame is a target, and the vertex maps of
+// the levels if it is a source.
+struct RGBDOdometryFrame {
+    bool is_rgb_;
+    std::shared_ptr<geometry::RGBDImage> processed_;
+    geometry::RGBDImagePyramid pyramid_;
+    geometry::RGBDImagePyramid pyramid_dx_;
+    geometry::RGBDImagePyramid pyramid_dy_;
+    std::vector<std::shared_ptr<geometry::Image>> xyz_pyramid_;
+};
+
+static std::shared_ptr<RGBDOdometryFrame> PreprocessRGBDOdometryFrame(
+        const geometry::RGBDImage &image,
         const camera::PinholeCameraIntrinsic &pinhole_camera_intrinsic,
-        const Eigen::Matrix4d &odo_init,
-        const OdometryOption &option) {
-    std::shared_ptr<geometry::Image> source_color, target_color;
-    if (IsColorImageRGB(source.color_) && IsColorImageRGB(target.color_)) {
-        source_color = source.color_.CreateFloatImage();
-        target_color = target.color_.CreateFloatImage();
-    } else {
-        source_color = std::make_shared<geometry::Image>(source.color_);
-        target_color = std::make_shared<geometry::Image>(target.color_);
+        const OdometryOption &option,
+        bool as_source,
+        bool as_target) {
+    auto frame = std::make_shared<RGBDOdometryFrame>();
+    frame->is_rgb_ = IsColorImageRGB(image.color_);
+    std::shared_ptr<geometry::Image> color =
+            frame->is_rgb_ ? image.color_.CreateFloatImage()
+                           : std::make_shared<geometry::Image>(image.color_);
+    auto gray = color->Filter(geometry::Image::FilterType::Gaussian3);
+    auto depth = PreprocessDepth(image.depth_, option)
+                         ->Filter(geometry::Image::FilterType::Gaussian3);
+
+    int num_levels = (int)option.iteration_number_per_pyramid_level_.size();
+    frame->processed_ = PackRGBDImage(*gray, *depth);
+    frame->pyramid_ = frame->processed_->CreatePyramid(num_levels);
+    if (as_target) {
+        frame->pyramid_dx_ = geometry::RGBDImage::FilterPyramid(
+                frame->pyramid_, geometry::Image::FilterType::Sobel3Dx);
+        frame->pyramid_dy_ = geometry::RGBDImage::FilterPyramid(
+                frame->pyramid_, geometry::Image::FilterType::Sobel3Dy);
     }
-
-    auto source_gray =
-            source_color->Filter(geometry::Image::FilterType::Gaussian3);
-    auto target_gray =
-            target_color->Filter(geometry::Image::FilterType::Gaussian3);
-    auto source_depth_preprocessed = PreprocessDepth(source.depth_, option);
-    auto target_depth_preprocessed = PreprocessDepth(target.depth_, option);
-    auto source_depth = source_depth_preprocessed->Filter(
-            geometry::Image::FilterType::Gaussian3);
-    auto target_depth = target_depth_preprocessed->Filter(
-            geometry::Image::FilterType::Gaussian3);
-
-    auto correspondence = ComputeCorrespondence(
-            pinhole_camera_intrinsic.intrinsic_matrix_, odo_init, *source_depth,
-            *target_depth, option);
-    NormalizeIntensity(*source_gray, *target_gray, *correspondence);
-
-    auto source_out = PackRGBDImage(*source_gray, *source_depth);
-    auto target_out = PackRGBDImage(*target_gray, *target_depth);
-    return std::make_tuple(source_out, target_out);
+    if (as_source) {
+        std::vector<Eigen::Matrix3d> pyramid_camera_matrix =
+                CreateCameraMatrixPyramid(pinhole_camera_intrinsic,
+                                          num_levels);
+        for (int level = 0; level < num_levels; level++) {
+            frame->xyz_pyramid_.push_back(ConvertDepthImageToXYZImage(
+                    frame->pyramid_[level]->depth_,
+                    pyramid_camera_matrix[level]));
+        }
+    }
+    return frame;
 }
 
 static std::tuple<bool, Eigen::Matrix4d> DoSingleIteration(
@@ -430,22 +469,15 @@ static std::tuple<bool, Eigen::Matrix4d> DoSingleIteration(
             intrinsic, extrinsic_initial, source.depth_, target.depth_, option);
     int corresps_count = (int)correspondence->size();
 
-    auto f_lambda =
-            [&](int i,
-                std::vector<Eigen::Vector6d, utility::Vector6d_allocator> &J_r,
-                std::vector<double> &r, std::vector<double> &w) {
-                jacobian_method.ComputeJacobianAndResidual(
-                        i, J_r, r, w, source, target, source_xyz, target_dx,
-                        target_dy, intrinsic, extrinsic_initial,
-                        *correspondence);
-            };
     utility::LogDebug("Iter : {:d}, Level : {:d}, ", iter, level);
     Eigen::Matrix6d JTJ;
     Eigen::Vector6d JTr;
     double r2;
-    std::tie(JTJ, JTr, r2) =
-            utility::ComputeJTJandJTr<Eigen::Matrix6d, Eigen::Vector6d>(
-                    f_lambda, corresps_count);
+    std::tie(JTJ, JTr, r2) = jacobian_method.ComputeJTJandJTr(
+            source, target, source_xyz, target_dx, target_dy, intrinsic,
+            extrinsic_initial, *correspondence);
+    utility::LogDebug("Residual : {:.2e} (# of elements : {:d})",
+                      r2 / (double)corresps_count, corresps_count);
 
     bool is_success;
     Eigen::Matrix4d extrinsic;
@@ -460,8 +492,10 @@ static std::tuple<bool, Eigen::Matrix4d> DoSingleIteration(
 }
 
 static std::tuple<bool, Eigen::Matrix4d> ComputeMultiscale(
-        const geometry::RGBDImage &source,
-        const geometry::RGBDImage &target,
+        const RGBDOdometryFrame &source,
+        const RGBDOdometryFrame &target,
+        double source_scale,
+        double target_scale,
         const camera::PinholeCameraIntrinsic &pinhole_camera_intrinsic,
         const Eigen::Matrix4d &extrinsic_initial,
         const RGBDOdometryJacobian &jacobian_method,
@@ -469,12 +503,12 @@ static std::tuple<bool, Eigen::Matrix4d> ComputeMultiscale(
     std::vector<int> iter_counts = option.iteration_number_per_pyramid_level_;
     int num_levels = (int)iter_counts.size();
 
-    auto source_pyramid = source.CreatePyramid(num_levels);
-    auto target_pyramid = target.CreatePyramid(num_levels);
-    auto target_pyramid_dx = geometry::RGBDImage::FilterPyramid(
-            target_pyramid, geometry::Image::FilterType::Sobel3Dx);
-    auto target_pyramid_dy = geometry::RGBDImage::FilterPyramid(
-            target_pyramid, geometry::Image::FilterType::Sobel3Dy);
+    auto source_pyramid = ScaleIntensityPyramid(source.pyramid_, source_scale);
+    auto target_pyramid = ScaleIntensityPyramid(target.pyramid_, target_scale);
+    auto target_pyramid_dx =
+            ScaleIntensityPyramid(target.pyramid_dx_, target_scale);
+    auto target_pyramid_dy =
+            ScaleIntensityPyramid(target.pyramid_dy_, target_scale);
 
     Eigen::Matrix4d result_odo = extrinsic_initial.isZero()
                                          ? Eigen::Matrix4d::Identity()
@@ -488,24 +522,14 @@ static std::tuple<bool, Eigen::Matrix4d> ComputeMultiscale(
         const Eigen::Matrix3d level_camera_matrix =
                 pyramid_camera_matrix[level];
 
-        auto source_xyz_level = ConvertDepthImageToXYZImage(
-                source_pyramid[level]->depth_, level_camera_matrix);
-        auto source_level = PackRGBDImage(source_pyramid[level]->color_,
-                                          source_pyramid[level]->depth_);
-        auto target_level = PackRGBDImage(target_pyramid[level]->color_,
-                                          target_pyramid[level]->depth_);
-        auto target_dx_level = PackRGBDImage(target_pyramid_dx[level]->color_,
-                                             target_pyramid_dx[level]->depth_);
-        auto target_dy_level = PackRGBDImage(target_pyramid_dy[level]->color_,
-                                             target_pyramid_dy[level]->depth_);
-
         for (int iter = 0; iter < iter_counts[num_levels - level - 1]; iter++) {
             Eigen::Matrix4d curr_odo;
             bool is_success;
             std::tie(is_success, curr_odo) = DoSingleIteration(
-                    iter, level, *source_level, *target_level,
-                    *source_xyz_level, *target_dx_level, *target_dy_level,
-                    level_camera_matrix, result_odo, jacobian_method, option);
+                    iter, level, *source_pyramid[level], *target_pyramid[level],
+                    *source.xyz_pyramid_[level], *target_pyramid_dx[level],
+                    *target_pyramid_dy[level], level_camera_matrix, result_odo,
+                    jacobian_method, option);
             result_odo = curr_odo * result_odo;
 
             if (!is_success) {
@@ -517,6 +541,42 @@ static std::tuple<bool, Eigen::Matrix4d> ComputeMultiscale(
     return std::make_tuple(true, result_odo);
 }
 
+static std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d>
+ComputeRGBDOdometryFromFrames(
+        const RGBDOdometryFrame &source,
+        const RGBDOdometryFrame &target,
+        const camera::PinholeCameraIntrinsic &pinhole_camera_intrinsic,
+        const Eigen::Matrix4d &odo_init,
+        const RGBDOdometryJacobian &jacobian_method,
+        const OdometryOption &option) {
+    const geometry::RGBDImage &source_processed = *source.processed_;
+    const geometry::RGBDImage &target_processed = *target.processed_;
+    auto correspondence = ComputeCorrespondence(
+            pinhole_camera_intrinsic.intrinsic_matrix_, odo_init,
+            source_processed.depth_, target_processed.depth_, option);
+    double source_scale, target_scale;
+    std::tie(source_scale, target_scale) =
+            ComputeIntensityScales(source_processed.color_,
+                                   target_processed.color_, *correspondence);
+
+    Eigen::Matrix4d extrinsic;
+    bool is_success;
+    std::tie(is_success, extrinsic) = ComputeMultiscale(
+            source, target, source_scale, target_scale,
+            pinhole_camera_intrinsic, odo_init, jacobian_method, option);
+
+    if (is_success) {
+        Eigen::Matrix4d trans_output = extrinsic;
+        Eigen::MatrixXd info_output = CreateInformationMatrix(
+                extrinsic, pinhole_camera_intrinsic, source_processed.depth_,
+                target_processed.depth_, option);
+        return std::make_tuple(true, trans_output, info_output);
+    } else {
+        return std::make_tuple(false, Eigen::Matrix4d::Identity(),
+                               Eigen::Matrix6d::Identity());
+    }
+}
+
 std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> ComputeRGBDOdometry(
         const geometry::RGBDImage &source,
         const geometry::RGBDImage &target,
@@ -533,28 +593,56 @@ std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> ComputeRGBDOdometry(
                                Eigen::Matrix6d::Zero());
     }
 
-    std::shared_ptr<geometry::RGBDImage> source_processed, target_processed;
-    std::tie(source_processed, target_processed) = InitializeRGBDOdometry(
-            source, target, pinhole_camera_intrinsic, odo_init, option);
+    auto source_frame = PreprocessRGBDOdometryFrame(
+            source, pinhole_camera_intrinsic, option, true, false);
+    auto target_frame = PreprocessRGBDOdometryFrame(
+            target, pinhole_camera_intrinsic, option, false, true);
+    return ComputeRGBDOdometryFromFrames(*source_frame, *target_frame,
+                                         pinhole_camera_intrinsic, odo_init,
+                                         jacobian_method, option);
+}
 
-    Eigen::Matrix4d extrinsic;
-    bool is_success;
-    std::tie(is_success, extrinsic) = ComputeMultiscale(
-            *source_processed, *target_processed, pinhole_camera_intrinsic,
-            odo_init, jacobian_method, option);
+RGBDOdometryTracker::RGBDOdometryTracker(
+        const camera::PinholeCameraIntrinsic &pinhole_camera_intrinsic,
+        const OdometryOption &option)
+    : pinhole_camera_intrinsic_(pinhole_camera_intrinsic), option_(option) {}
 
-    if (is_success) {
-        Eigen::Matrix4d trans_output = extrinsic;
-        Eigen::MatrixXd info_output = CreateInformationMatrix(
-                extrinsic, pinhole_camera_intrinsic, source_processed->depth_,
-                target_processed->depth_, option);
-        return std::make_tuple(true, trans_output, info_output);
-    } else {
+std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> RGBDOdometryTracker::Track(
+        const geometry::RGBDImage &frame,
+        const Eigen::Matrix4d &odo_init /*= Eigen::Matrix4d::Identity()*/,
+        const RGBDOdometryJacobian &jacobian_method
+        /*=RGBDOdometryJacobianFromHybridTerm*/) {
+    if (!CheckRGBDImageFormat(frame)) {
+        utility::LogWarning("[RGBDOdometryTracker] Unsupported RGBD format.");
         return std::make_tuple(false, Eigen::Matrix4d::Identity(),
-                               Eigen::Matrix6d::Identity());
+                               Eigen::Matrix6d::Zero());
     }
+    if (previous_frame_ &&
+        (!CheckImagePair(previous_frame_->processed_->depth_, frame.depth_) ||
+         previous_frame_->is_rgb_ != IsColorImageRGB(frame.color_))) {
+        utility::LogWarning(
+                "[RGBDOdometryTracker] Two RGBD pairs should be same in "
+                "size.");
+        return std::make_tuple(false, Eigen::Matrix4d::Identity(),
+                               Eigen::Matrix6d::Zero());
+    }
+
+    // The frame is the target of this pair and the source of the next one.
+    auto current_frame = PreprocessRGBDOdometryFrame(
+            frame, pinhole_camera_intrinsic_, option_, true, true);
+    std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> result(
+            false, Eigen::Matrix4d::Identity(), Eigen::Matrix6d::Zero());
+    if (previous_frame_) {
+        result = ComputeRGBDOdometryFromFrames(
+                *previous_frame_, *current_frame, pinhole_camera_intrinsic_,
+                odo_init, jacobian_method, option_);
+    }
+    previous_frame_ = current_frame;
+    return result;
 }
 
+void RGBDOdometryTracker::Reset() { previous_frame_.reset(); }
+
 }  // namespace odometry
 }  // namespace pipelines
 }  // namespace open3d
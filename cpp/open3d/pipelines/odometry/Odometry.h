@@ -28,6 +28,7 @@
 
 #include <Eigen/Core>
 #include <iostream>
+#include <memory>
 #include <tuple>
 #include <vector>
 
@@ -46,6 +47,8 @@ class RGBDImage;
 namespace pipelines {
 namespace odometry {
 
+struct RGBDOdometryFrame;
+
 /// \brief Function to estimate 6D rigid motion from two RGBD image pairs.
 ///
 /// \param source Source RGBD image.
@@ -65,6 +68,52 @@ std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> ComputeRGBDOdometry(
                 RGBDOdometryJacobianFromHybridTerm(),
         const OdometryOption &option = OdometryOption());
 
+/// \class RGBDOdometryTracker
+///
+/// \brief RGB-D odometry over a sequence of frames.
+///
+/// Each frame is the target of one pair and the source of the next one, so
+/// its preprocessing (intensity conversion, smoothing, pyramids, gradients
+/// and vertex maps) is computed once and kept until the next frame, instead
+/// of twice by consecutive ComputeRGBDOdometry calls. The results are those
+/// of ComputeRGBDOdometry on the same pairs.
+class RGBDOdometryTracker {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param pinhole_camera_intrinsic Camera intrinsic parameters.
+    /// \param option Odometry hyper parameteres.
+    RGBDOdometryTracker(
+            const camera::PinholeCameraIntrinsic &pinhole_camera_intrinsic,
+            const OdometryOption &option = OdometryOption());
+
+    /// \brief Estimates the motion from the previous frame to \p frame.
+    ///
+    /// The first frame after construction or Reset() has no previous frame
+    /// and only gets preprocessed, and the result is unsuccessful.
+    ///
+    /// \param frame Next RGBD image of the sequence.
+    /// \param odo_init Initial 4x4 motion matrix estimation.
+    /// \param jacobian_method The odometry Jacobian method to use.
+    /// \return is_success, 4x4 motion matrix, 6x6 information matrix.
+    std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> Track(
+            const geometry::RGBDImage &frame,
+            const Eigen::Matrix4d &odo_init = Eigen::Matrix4d::Identity(),
+            const RGBDOdometryJacobian &jacobian_method =
+                    RGBDOdometryJacobianFromHybridTerm());
+
+    /// Forgets the previous frame.
+    void Reset();
+
+    /// Returns true if a frame has been tracked since the last Reset().
+    bool HasPreviousFrame() const { return previous_frame_ != nullptr; }
+
+protected:
+    camera::PinholeCameraIntrinsic pinhole_camera_intrinsic_;
+    OdometryOption option_;
+    std::shared_ptr<RGBDOdometryFrame> previous_frame_;
+};
+
 }  // namespace odometry
 }  // namespace pipelines
 }  // namespace open3d
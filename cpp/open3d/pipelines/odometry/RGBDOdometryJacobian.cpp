@@ -26,9 +26,13 @@
 
 #include "open3d/pipelines/odometry/RGBDOdometryJacobian.h"
 
+#include <algorithm>
+#include <cmath>
+
 #include "open3d/geometry/Image.h"
 #include "open3d/geometry/RGBDImage.h"
 #include "open3d/pipelines/odometry/Odometry.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 
@@ -41,6 +45,88 @@ const double LAMBDA_HYBRID_DEPTH = 0.968;
 
 namespace pipelines {
 namespace odometry {
+
+namespace {
+
+// Number of correspondences evaluated together by the batched terms.
+constexpr int kRowBlockSize = 64;
+
+// Jacobian rows and residuals of a block of correspondences, stored as
+// structure of arrays: J(k, i) is coordinate k of row i, and each term of a
+// correspondence has its own kRowBlockSize columns.
+template <int NumTerms>
+using JacobianBlock =
+        Eigen::Matrix<double, 6, NumTerms * kRowBlockSize, Eigen::RowMajor>;
+template <int NumTerms>
+using ResidualBlock = Eigen::Matrix<double, NumTerms * kRowBlockSize, 1>;
+
+// Accumulates J^T J, J^T r and r^2 over num_rows correspondences.
+// fill(begin, end, J, r) writes the rows of the correspondences [begin, end)
+// to the first end - begin columns of each term of the zeroed block, so that
+// every block contributes with two dense products.
+template <int NumTerms, typename FillFunc>
+std::tuple<Eigen::Matrix6d, Eigen::Vector6d, double> AccumulateJTJandJTr(
+        int num_rows, const FillFunc &fill) {
+    Eigen::Matrix6d JTJ = Eigen::Matrix6d::Zero();
+    Eigen::Vector6d JTr = Eigen::Vector6d::Zero();
+    double r2_sum = 0.0;
+    int num_blocks = (num_rows + kRowBlockSize - 1) / kRowBlockSize;
+#pragma omp parallel num_threads(utility::EstimateMaxThreads())
+    {
+        Eigen::Matrix6d JTJ_private = Eigen::Matrix6d::Zero();
+        Eigen::Vector6d JTr_private = Eigen::Vector6d::Zero();
+        double r2_sum_private = 0.0;
+        JacobianBlock<NumTerms> J;
+        ResidualBlock<NumTerms> r;
+#pragma omp for nowait
+        for (int block = 0; block < num_blocks; block++) {
+            int begin = block * kRowBlockSize;
+            int end = std::min(num_rows, begin + kRowBlockSize);
+            J.setZero();
+            r.setZero();
+            fill(begin, end, J, r);
+            JTJ_private.noalias() += J * J.transpose();
+            JTr_private.noalias() += J * r;
+            r2_sum_private += r.squaredNorm();
+        }
+#pragma omp critical
+        {
+            JTJ += JTJ_private;
+            JTr += JTr_private;
+            r2_sum += r2_sum_private;
+        }
+    }
+    return std::make_tuple(JTJ, JTr, r2_sum);
+}
+
+inline const float *FloatData(const geometry::Image &image) {
+    return reinterpret_cast<const float *>(image.data_.data());
+}
+
+}  // unnamed namespace
+
+std::tuple<Eigen::Matrix6d, Eigen::Vector6d, double>
+RGBDOdometryJacobian::ComputeJTJandJTr(
+        const geometry::RGBDImage &source,
+        const geometry::RGBDImage &target,
+        const geometry::Image &source_xyz,
+        const geometry::RGBDImage &target_dx,
+        const geometry::RGBDImage &target_dy,
+        const Eigen::Matrix3d &intrinsic,
+        const Eigen::Matrix4d &extrinsic,
+        const CorrespondenceSetPixelWise &corresps) const {
+    auto f_lambda =
+            [&](int i,
+                std::vector<Eigen::Vector6d, utility::Vector6d_allocator> &J_r,
+                std::vector<double> &r, std::vector<double> &w) {
+                ComputeJacobianAndResidual(i, J_r, r, w, source, target,
+                                           source_xyz, target_dx, target_dy,
+                                           intrinsic, extrinsic, corresps);
+            };
+    return utility::ComputeJTJandJTr<Eigen::Matrix6d, Eigen::Vector6d>(
+            f_lambda, int(corresps.size()), false);
+}
+
 void RGBDOdometryJacobianFromColorTerm::ComputeJacobianAndResidual(
         int row,
         std::vector<Eigen::Vector6d, utility::Vector6d_allocator> &J_r,
@@ -87,6 +173,58 @@ void RGBDOdometryJacobianFromColorTerm::ComputeJacobianAndResidual(
     w[0] = 1.0;
 }
 
+std::tuple<Eigen::Matrix6d, Eigen::Vector6d, double>
+RGBDOdometryJacobianFromColorTerm::ComputeJTJandJTr(
+        const geometry::RGBDImage &source,
+        const geometry::RGBDImage &target,
+        const geometry::Image &source_xyz,
+        const geometry::RGBDImage &target_dx,
+        const geometry::RGBDImage &target_dy,
+        const Eigen::Matrix3d &intrinsic,
+        const Eigen::Matrix4d &extrinsic,
+        const CorrespondenceSetPixelWise &corresps) const {
+    const Eigen::Matrix3d R = extrinsic.block<3, 3>(0, 0);
+    const Eigen::Vector3d t = extrinsic.block<3, 1>(0, 3);
+    const double fx = intrinsic(0, 0);
+    const double fy = intrinsic(1, 1);
+    const int width_s = source.color_.width_;
+    const int width_t = target.color_.width_;
+    const float *I_s = FloatData(source.color_);
+    const float *I_t = FloatData(target.color_);
+    const float *dIdx_t = FloatData(target_dx.color_);
+    const float *dIdy_t = FloatData(target_dy.color_);
+    const float *xyz_s = FloatData(source_xyz);
+
+    auto fill = [&](int begin, int end, JacobianBlock<1> &J,
+                    ResidualBlock<1> &r) {
+        for (int row = begin; row < end; row++) {
+            const Eigen::Vector4i &corresp = corresps[row];
+            int idx_s = corresp(1) * width_s + corresp(0);
+            int idx_t = corresp(3) * width_t + corresp(2);
+            double dIdx = SOBEL_SCALE * dIdx_t[idx_t];
+            double dIdy = SOBEL_SCALE * dIdy_t[idx_t];
+            Eigen::Vector3d p3d_trans =
+                    R * Eigen::Vector3d(xyz_s[3 * idx_s], xyz_s[3 * idx_s + 1],
+                                        xyz_s[3 * idx_s + 2]) +
+                    t;
+            double invz = 1. / p3d_trans(2);
+            double c0 = dIdx * fx * invz;
+            double c1 = dIdy * fy * invz;
+            double c2 = -(c0 * p3d_trans(0) + c1 * p3d_trans(1)) * invz;
+
+            int i = row - begin;
+            J(0, i) = -p3d_trans(2) * c1 + p3d_trans(1) * c2;
+            J(1, i) = p3d_trans(2) * c0 - p3d_trans(0) * c2;
+            J(2, i) = -p3d_trans(1) * c0 + p3d_trans(0) * c1;
+            J(3, i) = c0;
+            J(4, i) = c1;
+            J(5, i) = c2;
+            r(i) = double(I_t[idx_t]) - double(I_s[idx_s]);
+        }
+    };
+    return AccumulateJTJandJTr<1>(int(corresps.size()), fill);
+}
+
 void RGBDOdometryJacobianFromHybridTerm::ComputeJacobianAndResidual(
         int row,
         std::vector<Eigen::Vector6d, utility::Vector6d_allocator> &J_r,
@@ -161,6 +299,86 @@ void RGBDOdometryJacobianFromHybridTerm::ComputeJacobianAndResidual(
     w[1] = 1.0;
 }
 
+std::tuple<Eigen::Matrix6d, Eigen::Vector6d, double>
+RGBDOdometryJacobianFromHybridTerm::ComputeJTJandJTr(
+        const geometry::RGBDImage &source,
+        const geometry::RGBDImage &target,
+        const geometry::Image &source_xyz,
+        const geometry::RGBDImage &target_dx,
+        const geometry::RGBDImage &target_dy,
+        const Eigen::Matrix3d &intrinsic,
+        const Eigen::Matrix4d &extrinsic,
+        const CorrespondenceSetPixelWise &corresps) const {
+    const double sqrt_lamba_dep = sqrt(LAMBDA_HYBRID_DEPTH);
+    const double sqrt_lambda_img = sqrt(1.0 - LAMBDA_HYBRID_DEPTH);
+    const Eigen::Matrix3d R = extrinsic.block<3, 3>(0, 0);
+    const Eigen::Vector3d t = extrinsic.block<3, 1>(0, 3);
+    const double fx = intrinsic(0, 0);
+    const double fy = intrinsic(1, 1);
+    const int width_s = source.color_.width_;
+    const int width_t = target.color_.width_;
+    const float *I_s = FloatData(source.color_);
+    const float *I_t = FloatData(target.color_);
+    const float *D_t = FloatData(target.depth_);
+    const float *dIdx_t = FloatData(target_dx.color_);
+    const float *dIdy_t = FloatData(target_dy.color_);
+    const float *dDdx_t = FloatData(target_dx.depth_);
+    const float *dDdy_t = FloatData(target_dy.depth_);
+    const float *xyz_s = FloatData(source_xyz);
+
+    // The photometric rows go to the columns [0, kRowBlockSize) and the
+    // geometric rows to [kRowBlockSize, 2 * kRowBlockSize).
+    auto fill = [&](int begin, int end, JacobianBlock<2> &J,
+                    ResidualBlock<2> &r) {
+        for (int row = begin; row < end; row++) {
+            const Eigen::Vector4i &corresp = corresps[row];
+            int idx_s = corresp(1) * width_s + corresp(0);
+            int idx_t = corresp(3) * width_t + corresp(2);
+            double dIdx = SOBEL_SCALE * dIdx_t[idx_t];
+            double dIdy = SOBEL_SCALE * dIdy_t[idx_t];
+            double dDdx = SOBEL_SCALE * dDdx_t[idx_t];
+            double dDdy = SOBEL_SCALE * dDdy_t[idx_t];
+            if (std::isnan(dDdx)) dDdx = 0;
+            if (std::isnan(dDdy)) dDdy = 0;
+            Eigen::Vector3d p3d_trans =
+                    R * Eigen::Vector3d(xyz_s[3 * idx_s], xyz_s[3 * idx_s + 1],
+                                        xyz_s[3 * idx_s + 2]) +
+                    t;
+            double invz = 1. / p3d_trans(2);
+            double c0 = dIdx * fx * invz;
+            double c1 = dIdy * fy * invz;
+            double c2 = -(c0 * p3d_trans(0) + c1 * p3d_trans(1)) * invz;
+            double d0 = dDdx * fx * invz;
+            double d1 = dDdy * fy * invz;
+            double d2 = -(d0 * p3d_trans(0) + d1 * p3d_trans(1)) * invz;
+
+            int i = row - begin;
+            J(0, i) = sqrt_lambda_img *
+                      (-p3d_trans(2) * c1 + p3d_trans(1) * c2);
+            J(1, i) = sqrt_lambda_img * (p3d_trans(2) * c0 - p3d_trans(0) * c2);
+            J(2, i) = sqrt_lambda_img *
+                      (-p3d_trans(1) * c0 + p3d_trans(0) * c1);
+            J(3, i) = sqrt_lambda_img * c0;
+            J(4, i) = sqrt_lambda_img * c1;
+            J(5, i) = sqrt_lambda_img * c2;
+            r(i) = sqrt_lambda_img *
+                   (double(I_t[idx_t]) - double(I_s[idx_s]));
+
+            int j = kRowBlockSize + i;
+            J(0, j) = sqrt_lamba_dep *
+                      ((-p3d_trans(2) * d1 + p3d_trans(1) * d2) - p3d_trans(1));
+            J(1, j) = sqrt_lamba_dep *
+                      ((p3d_trans(2) * d0 - p3d_trans(0) * d2) + p3d_trans(0));
+            J(2, j) = sqrt_lamba_dep * (-p3d_trans(1) * d0 + p3d_trans(0) * d1);
+            J(3, j) = sqrt_lamba_dep * d0;
+            J(4, j) = sqrt_lamba_dep * d1;
+            J(5, j) = sqrt_lamba_dep * (d2 - 1.0f);
+            r(j) = sqrt_lamba_dep * (D_t[idx_t] - p3d_trans(2));
+        }
+    };
+    return AccumulateJTJandJTr<2>(int(corresps.size()), fill);
+}
+
 }  // namespace odometry
 }  // namespace pipelines
 }  // namespace open3d
@@ -77,6 +77,19 @@ public:
             const Eigen::Matrix3d &intrinsic,
             const Eigen::Matrix4d &extrinsic,
             const CorrespondenceSetPixelWise &corresps) const = 0;
+
+    /// Function to compute J^T J, J^T r and the sum of r^2 over all the
+    /// correspondences. The default implementation accumulates the rows of
+    /// ComputeJacobianAndResidual one at a time.
+    virtual std::tuple<Eigen::Matrix6d, Eigen::Vector6d, double>
+    ComputeJTJandJTr(const geometry::RGBDImage &source,
+                     const geometry::RGBDImage &target,
+                     const geometry::Image &source_xyz,
+                     const geometry::RGBDImage &target_dx,
+                     const geometry::RGBDImage &target_dy,
+                     const Eigen::Matrix3d &intrinsic,
+                     const Eigen::Matrix4d &extrinsic,
+                     const CorrespondenceSetPixelWise &corresps) const;
 };
 
 /// \class RGBDOdometryJacobianFromColorTerm
@@ -109,6 +122,18 @@ public:
             const Eigen::Matrix3d &intrinsic,
             const Eigen::Matrix4d &extrinsic,
             const CorrespondenceSetPixelWise &corresps) const override;
+
+    /// Evaluates the residuals of blocks of correspondences into arrays, and
+    /// accumulates them with dense block products.
+    std::tuple<Eigen::Matrix6d, Eigen::Vector6d, double> ComputeJTJandJTr(
+            const geometry::RGBDImage &source,
+            const geometry::RGBDImage &target,
+            const geometry::Image &source_xyz,
+            const geometry::RGBDImage &target_dx,
+            const geometry::RGBDImage &target_dy,
+            const Eigen::Matrix3d &intrinsic,
+            const Eigen::Matrix4d &extrinsic,
+            const CorrespondenceSetPixelWise &corresps) const override;
 };
 
 /// \class RGBDOdometryJacobianFromHybridTerm
@@ -140,6 +165,18 @@ public:
             const Eigen::Matrix3d &intrinsic,
             const Eigen::Matrix4d &extrinsic,
             const CorrespondenceSetPixelWise &corresps) const override;
+
+    /// Evaluates the residuals of blocks of correspondences into arrays, and
+    /// accumulates them with dense block products.
+    std::tuple<Eigen::Matrix6d, Eigen::Vector6d, double> ComputeJTJandJTr(
+            const geometry::RGBDImage &source,
+            const geometry::RGBDImage &target,
+            const geometry::Image &source_xyz,
+            const geometry::RGBDImage &target_dx,
+            const geometry::RGBDImage &target_dy,
+            const Eigen::Matrix3d &intrinsic,
+            const Eigen::Matrix4d &extrinsic,
+            const CorrespondenceSetPixelWise &corresps) const override;
 };
 
 }  // namespace odometry
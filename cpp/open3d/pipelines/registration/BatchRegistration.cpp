@@ -0,0 +1,194 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/pipelines/registration/BatchRegistration.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <exception>
+
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/pipelines/registration/PoseGraph.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace pipelines {
+namespace registration {
+
+/// Calls f(i) for i in [0, n) over the workers of the option. The parallel
+/// regions of f are sized by utility::EstimateMaxThreads(), which is scoped to
+/// threads_per_worker_ in each worker. The first exception of f is rethrown.
+template <typename Func>
+static void ParallelForPairs(int n,
+                             const BatchRegistrationOption &option,
+                             Func f) {
+    std::exception_ptr exception;
+#ifdef _OPENMP
+    int num_workers = option.num_workers_ > 0 ? option.num_workers_
+                                              : utility::EstimateMaxThreads();
+    int threads_per_worker = std::max(option.threads_per_worker_, 1);
+    // Nested regions only get more than one thread if nesting is enabled. It
+    // is only enabled when the workers need it, for the duration of the
+    // batch, and the previous setting is restored afterwards.
+    int max_active_levels = omp_get_max_active_levels();
+    bool enable_nesting = threads_per_worker > 1 && max_active_levels < 2;
+    if (enable_nesting) {
+        omp_set_max_active_levels(2);
+    }
+#pragma omp parallel for schedule(dynamic) num_threads(num_workers)
+    for (int i = 0; i < n; i++) {
+        utility::ScopedMaxThreads scoped_max_threads(threads_per_worker);
+        try {
+            f(i);
+        } catch (...) {
+#pragma omp critical
+            {
+                if (!exception) exception = std::current_exception();
+            }
+        }
+    }
+    if (enable_nesting) {
+        omp_set_max_active_levels(max_active_levels);
+    }
+#else
+    for (int i = 0; i < n; i++) {
+        try {
+            f(i);
+        } catch (...) {
+            if (!exception) exception = std::current_exception();
+        }
+    }
+#endif
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+}
+
+static void CheckPairs(
+        const std::vector<std::shared_ptr<geometry::PointCloud>> &point_clouds,
+        const std::vector<std::pair<int, int>> &pairs) {
+    int n = static_cast<int>(point_clouds.size());
+    for (const std::pair<int, int> &pair : pairs) {
+        if (pair.first < 0 || pair.first >= n || pair.second < 0 ||
+            pair.second >= n) {
+            utility::LogError("Pair ({:d}, {:d}) is out of range [0, {:d}).",
+                              pair.first, pair.second, n);
+        }
+        if (!point_clouds[pair.first] || !point_clouds[pair.second]) {
+            utility::LogError("Pair ({:d}, {:d}) has an empty point cloud.",
+                              pair.first, pair.second);
+        }
+    }
+}
+
+std::vector<RegistrationResult> RegistrationICPBatch(
+        const std::vector<std::shared_ptr<geometry::PointCloud>> &point_clouds,
+        const std::vector<std::pair<int, int>> &pairs,
+        double max_correspondence_distance,
+        const std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>
+                &inits /* = {}*/,
+        const TransformationEstimation &estimation /* =
+        TransformationEstimationPointToPoint(false)*/,
+        const ICPConvergenceCriteria &criteria /* = ICPConvergenceCriteria()*/,
+        const BatchRegistrationOption &option /* =
+        BatchRegistrationOption()*/) {
+    CheckPairs(point_clouds, pairs);
+    if (!inits.empty() && inits.size() != pairs.size()) {
+        utility::LogError("{:d} initial transformations for {:d} pairs.",
+                          inits.size(), pairs.size());
+    }
+
+    int n = static_cast<int>(pairs.size());
+    std::vector<RegistrationResult> results(n);
+    ParallelForPairs(n, option, [&](int i) {
+        results[i] = RegistrationICP(
+                *point_clouds[pairs[i].first], *point_clouds[pairs[i].second],
+                max_correspondence_distance,
+                inits.empty() ? Eigen::Matrix4d::Identity() : inits[i],
+                estimation, criteria);
+    });
+    return results;
+}
+
+std::shared_ptr<PoseGraph> CreatePoseGraphFromPairwiseICP(
+        const std::vector<std::shared_ptr<geometry::PointCloud>> &point_clouds,
+        const std::vector<std::pair<int, int>> &pairs,
+        double max_correspondence_distance,
+        const TransformationEstimation &estimation /* =
+        TransformationEstimationPointToPoint(false)*/,
+        const ICPConvergenceCriteria &criteria /* = ICPConvergenceCriteria()*/,
+        const BatchRegistrationOption &option /* =
+        BatchRegistrationOption()*/) {
+    CheckPairs(point_clouds, pairs);
+
+    int n = static_cast<int>(pairs.size());
+    std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator> transformations(
+            n);
+    std::vector<Eigen::Matrix6d, utility::Matrix6d_allocator> informations(n);
+    ParallelForPairs(n, option, [&](int i) {
+        const geometry::PointCloud &source = *point_clouds[pairs[i].first];
+        const geometry::PointCloud &target = *point_clouds[pairs[i].second];
+        transformations[i] =
+                RegistrationICP(source, target, max_correspondence_distance,
+                                Eigen::Matrix4d::Identity(), estimation,
+                                criteria)
+                        .transformation_;
+        informations[i] = GetInformationMatrixFromPointClouds(
+                source, target, max_correspondence_distance,
+                transformations[i]);
+    });
+
+    // The odometry edge (i - 1, i) gives the pose of node i.
+    int num_nodes = static_cast<int>(point_clouds.size());
+    std::vector<int> odometry_edge(num_nodes, -1);
+    auto pose_graph = std::make_shared<PoseGraph>();
+    for (int i = 0; i < n; i++) {
+        bool odometry = pairs[i].second == pairs[i].first + 1;
+        if (odometry) {
+            odometry_edge[pairs[i].second] = i;
+        }
+        pose_graph->edges_.push_back(
+                PoseGraphEdge(pairs[i].first, pairs[i].second,
+                              transformations[i], informations[i], !odometry));
+    }
+    Eigen::Matrix4d odometry_pose = Eigen::Matrix4d::Identity();
+    for (int i = 0; i < num_nodes; i++) {
+        if (odometry_edge[i] >= 0) {
+            odometry_pose = transformations[odometry_edge[i]] * odometry_pose;
+        }
+        pose_graph->nodes_.push_back(PoseGraphNode(odometry_pose.inverse()));
+    }
+    return pose_graph;
+}
+
+}  // namespace registration
+}  // namespace pipelines
+}  // namespace open3d
@@ -0,0 +1,125 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <Eigen/Core>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "open3d/pipelines/registration/Registration.h"
+#include "open3d/pipelines/registration/TransformationEstimation.h"
+#include "open3d/utility/Eigen.h"
+
+namespace open3d {
+
+namespace geometry {
+class PointCloud;
+}
+
+namespace pipelines {
+namespace registration {
+
+class PoseGraph;
+
+/// \class BatchRegistrationOption
+///
+/// \brief Options for the scheduling of batches of pairwise registrations.
+///
+/// The pairs are distributed over \p num_workers_ threads. Each registration
+/// uses \p threads_per_worker_ threads for its own parallel loops, so that
+/// the batch does not oversubscribe the cores.
+class BatchRegistrationOption {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param num_workers Number of pairs registered concurrently, or 0 for
+    /// the maximum number of threads.
+    /// \param threads_per_worker Number of threads of each registration.
+    BatchRegistrationOption(int num_workers = 0, int threads_per_worker = 1)
+        : num_workers_(num_workers), threads_per_worker_(threads_per_worker) {}
+    ~BatchRegistrationOption() {}
+
+public:
+    /// Number of pairs registered concurrently, or 0 for the maximum number
+    /// of threads.
+    int num_workers_;
+    /// Number of threads of each registration.
+    int threads_per_worker_;
+};
+
+/// \brief Function for ICP registration of a batch of pairs of point clouds.
+///
+/// \param point_clouds The point clouds.
+/// \param pairs Pairs of indices (source, target) into \p point_clouds.
+/// \param max_correspondence_distance Maximum correspondence points-pair
+/// distance.
+/// \param inits Initial transformation of each pair, or empty for the
+/// identity.
+/// \param estimation Estimation method.
+/// \param criteria Convergence criteria.
+/// \param option Scheduling of the batch.
+/// \return The registration result of each pair, in the order of \p pairs.
+std::vector<RegistrationResult> RegistrationICPBatch(
+        const std::vector<std::shared_ptr<geometry::PointCloud>> &point_clouds,
+        const std::vector<std::pair<int, int>> &pairs,
+        double max_correspondence_distance,
+        const std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>
+                &inits = {},
+        const TransformationEstimation &estimation =
+                TransformationEstimationPointToPoint(false),
+        const ICPConvergenceCriteria &criteria = ICPConvergenceCriteria(),
+        const BatchRegistrationOption &option = BatchRegistrationOption());
+
+/// \brief Function to create a pose graph from the ICP registration of pairs
+/// of point clouds, such as the fragments of a multiway registration.
+///
+/// The pairs are registered as a batch, and the information matrix of each
+/// pair is computed with its registration. A pair (i, i + 1) gives an
+/// odometry edge, and the node poses follow the chain of odometry edges. The
+/// other pairs give uncertain loop closure edges.
+///
+/// \param point_clouds The point clouds, one node each.
+/// \param pairs Pairs of indices (source, target) into \p point_clouds.
+/// \param max_correspondence_distance Maximum correspondence points-pair
+/// distance.
+/// \param estimation Estimation method.
+/// \param criteria Convergence criteria.
+/// \param option Scheduling of the batch.
+std::shared_ptr<PoseGraph> CreatePoseGraphFromPairwiseICP(
+        const std::vector<std::shared_ptr<geometry::PointCloud>> &point_clouds,
+        const std::vector<std::pair<int, int>> &pairs,
+        double max_correspondence_distance,
+        const TransformationEstimation &estimation =
+                TransformationEstimationPointToPoint(false),
+        const ICPConvergenceCriteria &criteria = ICPConvergenceCriteria(),
+        const BatchRegistrationOption &option = BatchRegistrationOption());
+
+}  // namespace registration
+}  // namespace pipelines
+}  // namespace open3d
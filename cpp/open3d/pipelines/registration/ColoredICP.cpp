@@ -35,6 +35,7 @@
 #include "open3d/pipelines/registration/RobustKernel.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/Eigen.h"
+#include "open3d/utility/Trace.h"
 
 namespace open3d {
 namespace pipelines {
@@ -118,6 +119,7 @@ Eigen::Matrix4d TransformationEstimationForColoredICP::ComputeTransformation(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
         const CorrespondenceSet &corres) const {
+    OPEN3D_TRACE_SCOPE("ICP::TransformationEstimation");
     if (corres.empty() || !target.HasNormals() || !target.HasColors() ||
         !source.HasColors()) {
         return Eigen::Matrix4d::Identity();
@@ -27,6 +27,7 @@
 #include "open3d/pipelines/registration/CorrespondenceChecker.h"
 
 #include <Eigen/Dense>
+#include <algorithm>
 
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/utility/Console.h"
@@ -35,13 +36,37 @@ namespace open3d {
 namespace pipelines {
 namespace registration {
 
-bool CorrespondenceCheckerBasedOnEdgeLength::Check(
-        const geometry::PointCloud &source,
-        const geometry::PointCloud &target,
+namespace {
+
+/// Number of correspondences per hypothesis, validating the batch shapes.
+int GetBatchRansacN(
         const CorrespondenceSet &corres,
-        const Eigen::Matrix4d & /*transformation*/) const {
-    for (size_t i = 0; i < corres.size(); i++) {
-        for (size_t j = i + 1; j < corres.size(); j++) {
+        const std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>
+                &transformations,
+        const std::vector<uint8_t> &mask) {
+    if (transformations.empty()) return 0;
+    if (mask.size() != transformations.size() ||
+        corres.size() % transformations.size() != 0) {
+        utility::LogError(
+                "Batch of {} transformations does not match {} mask entries "
+                "and {} correspondences.",
+                transformations.size(), mask.size(), corres.size());
+    }
+    return static_cast<int>(corres.size() / transformations.size());
+}
+
+// The checks of one hypothesis, on the \p num_corres correspondences at
+// \p corres. Check() and CheckBatch() share them, so that a batch is checked
+// in place, without a virtual call or a copy of the correspondences per
+// hypothesis.
+
+bool CheckEdgeLength(const geometry::PointCloud &source,
+                     const geometry::PointCloud &target,
+                     const Eigen::Vector2i *corres,
+                     size_t num_corres,
+                     double similarity_threshold) {
+    for (size_t i = 0; i < num_corres; i++) {
+        for (size_t j = i + 1; j < num_corres; j++) {
             // check edge ij
             double dis_source = (source.points_[corres[i](0)] -
                                  source.points_[corres[j](0)])
@@ -49,8 +74,8 @@ bool CorrespondenceCheckerBasedOnEdgeLength::Check(
             double dis_target = (target.points_[corres[i](1)] -
                                  target.points_[corres[j](1)])
                                         .norm();
-            if (dis_source < dis_target * similarity_threshold_ ||
-                dis_target < dis_source * similarity_threshold_) {
+            if (dis_source < dis_target * similarity_threshold ||
+                dis_target < dis_source * similarity_threshold) {
                 return false;
             }
         }
@@ -58,23 +83,114 @@ bool CorrespondenceCheckerBasedOnEdgeLength::Check(
     return true;
 }
 
-bool CorrespondenceCheckerBasedOnDistance::Check(
-        const geometry::PointCloud &source,
-        const geometry::PointCloud &target,
-        const CorrespondenceSet &corres,
-        const Eigen::Matrix4d &transformation) const {
-    for (const auto &c : corres) {
-        const auto &pt = source.points_[c(0)];
+bool CheckDistance(const geometry::PointCloud &source,
+                   const geometry::PointCloud &target,
+                   const Eigen::Vector2i *corres,
+                   size_t num_corres,
+                   const Eigen::Matrix4d &transformation,
+                   double distance_threshold) {
+    for (size_t i = 0; i < num_corres; i++) {
+        const auto &pt = source.points_[corres[i](0)];
         Eigen::Vector3d pt_trans =
                 (transformation * Eigen::Vector4d(pt(0), pt(1), pt(2), 1.0))
                         .block<3, 1>(0, 0);
-        if ((target.points_[c(1)] - pt_trans).norm() > distance_threshold_) {
+        if ((target.points_[corres[i](1)] - pt_trans).norm() >
+            distance_threshold) {
             return false;
         }
     }
     return true;
 }
 
+bool CheckNormal(const geometry::PointCloud &source,
+                 const geometry::PointCloud &target,
+                 const Eigen::Vector2i *corres,
+                 size_t num_corres,
+                 const Eigen::Matrix4d &transformation,
+                 double cos_normal_angle_threshold) {
+    for (size_t i = 0; i < num_corres; i++) {
+        const auto &normal = source.normals_[corres[i](0)];
+        Eigen::Vector3d normal_trans =
+                (transformation *
+                 Eigen::Vector4d(normal(0), normal(1), normal(2), 0.0))
+                        .block<3, 1>(0, 0);
+        if (target.normals_[corres[i](1)].dot(normal_trans) <
+            cos_normal_angle_threshold) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace
+
+void CorrespondenceChecker::CheckBatch(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const CorrespondenceSet &corres,
+        const std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>
+                &transformations,
+        std::vector<uint8_t> &mask) const {
+    const int ransac_n = GetBatchRansacN(corres, transformations, mask);
+    CorrespondenceSet hypothesis_corres(ransac_n);
+    for (size_t i = 0; i < transformations.size(); i++) {
+        if (!mask[i]) continue;
+        std::copy(corres.begin() + i * ransac_n,
+                  corres.begin() + (i + 1) * ransac_n,
+                  hypothesis_corres.begin());
+        mask[i] = Check(source, target, hypothesis_corres, transformations[i]);
+    }
+}
+
+bool CorrespondenceCheckerBasedOnEdgeLength::Check(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const CorrespondenceSet &corres,
+        const Eigen::Matrix4d & /*transformation*/) const {
+    return CheckEdgeLength(source, target, corres.data(), corres.size(),
+                           similarity_threshold_);
+}
+
+void CorrespondenceCheckerBasedOnEdgeLength::CheckBatch(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const CorrespondenceSet &corres,
+        const std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>
+                &transformations,
+        std::vector<uint8_t> &mask) const {
+    const int ransac_n = GetBatchRansacN(corres, transformations, mask);
+    for (size_t i = 0; i < transformations.size(); i++) {
+        if (!mask[i]) continue;
+        mask[i] = CheckEdgeLength(source, target, &corres[i * ransac_n],
+                                  ransac_n, similarity_threshold_);
+    }
+}
+
+bool CorrespondenceCheckerBasedOnDistance::Check(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const CorrespondenceSet &corres,
+        const Eigen::Matrix4d &transformation) const {
+    return CheckDistance(source, target, corres.data(), corres.size(),
+                         transformation, distance_threshold_);
+}
+
+void CorrespondenceCheckerBasedOnDistance::CheckBatch(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const CorrespondenceSet &corres,
+        const std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>
+                &transformations,
+        std::vector<uint8_t> &mask) const {
+    const int ransac_n = GetBatchRansacN(corres, transformations, mask);
+    for (size_t i = 0; i < transformations.size(); i++) {
+        if (!mask[i]) continue;
+        mask[i] = CheckDistance(source, target, &corres[i * ransac_n],
+                                ransac_n, transformations[i],
+                                distance_threshold_);
+    }
+}
+
 bool CorrespondenceCheckerBasedOnNormal::Check(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
@@ -86,19 +202,30 @@ bool CorrespondenceCheckerBasedOnNormal::Check(
                 "normals.");
         return true;
     }
-    double cos_normal_angle_threshold = std::cos(normal_angle_threshold_);
-    for (const auto &c : corres) {
-        const auto &normal = source.normals_[c(0)];
-        Eigen::Vector3d normal_trans =
-                (transformation *
-                 Eigen::Vector4d(normal(0), normal(1), normal(2), 0.0))
-                        .block<3, 1>(0, 0);
-        if (target.normals_[c(1)].dot(normal_trans) <
-            cos_normal_angle_threshold) {
-            return false;
-        }
+    return CheckNormal(source, target, corres.data(), corres.size(),
+                       transformation, std::cos(normal_angle_threshold_));
+}
+
+void CorrespondenceCheckerBasedOnNormal::CheckBatch(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const CorrespondenceSet &corres,
+        const std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>
+                &transformations,
+        std::vector<uint8_t> &mask) const {
+    if (!source.HasNormals() || !target.HasNormals()) {
+        utility::LogWarning(
+                "[CorrespondenceCheckerBasedOnNormal::CheckBatch] Pointcloud "
+                "has no normals.");
+        return;
+    }
+    const int ransac_n = GetBatchRansacN(corres, transformations, mask);
+    const double cos_normal_angle_threshold = std::cos(normal_angle_threshold_);
+    for (size_t i = 0; i < transformations.size(); i++) {
+        if (!mask[i]) continue;
+        mask[i] = CheckNormal(source, target, &corres[i * ransac_n], ransac_n,
+                              transformations[i], cos_normal_angle_threshold);
     }
-    return true;
 }
 
 }  // namespace registration
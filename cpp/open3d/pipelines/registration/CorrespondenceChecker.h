@@ -27,11 +27,13 @@
 #pragma once
 
 #include <Eigen/Core>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
 
 #include "open3d/pipelines/registration/TransformationEstimation.h"
+#include "open3d/utility/Eigen.h"
 
 namespace open3d {
 
@@ -73,6 +75,29 @@ public:
                        const CorrespondenceSet &corres,
                        const Eigen::Matrix4d &transformation) const = 0;
 
+    /// \brief Function to check a batch of hypotheses at once.
+    ///
+    /// Hypothesis i consists of the correspondences
+    /// [i * ransac_n, (i + 1) * ransac_n) of \p corres, with ransac_n =
+    /// corres.size() / transformations.size(), and of transformations[i].
+    /// Only the hypotheses with a non-zero \p mask entry are checked, and the
+    /// entries of those that fail are set to 0, so that chained checkers only
+    /// check the survivors. The default implementation calls Check() on each
+    /// hypothesis; the built-in checkers check the batch in place, without a
+    /// virtual call or a copy of the correspondences per hypothesis.
+    /// \param source Source point cloud.
+    /// \param target Target point cloud.
+    /// \param corres Correspondences of all the hypotheses.
+    /// \param transformations The estimated transformation of each hypothesis.
+    /// \param mask Pass mask with one entry per hypothesis (inplace).
+    virtual void CheckBatch(
+            const geometry::PointCloud &source,
+            const geometry::PointCloud &target,
+            const CorrespondenceSet &corres,
+            const std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>
+                    &transformations,
+            std::vector<uint8_t> &mask) const;
+
 public:
     /// Some checkers do not require point clouds to be aligned, e.g., the edge
     /// length checker. Some checkers do, e.g., the distance checker.
@@ -104,6 +129,13 @@ public:
                const geometry::PointCloud &target,
                const CorrespondenceSet &corres,
                const Eigen::Matrix4d &transformation) const override;
+    void CheckBatch(
+            const geometry::PointCloud &source,
+            const geometry::PointCloud &target,
+            const CorrespondenceSet &corres,
+            const std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>
+                    &transformations,
+            std::vector<uint8_t> &mask) const override;
 
 public:
     /// For the check to be true,
@@ -131,6 +163,13 @@ public:
                const geometry::PointCloud &target,
                const CorrespondenceSet &corres,
                const Eigen::Matrix4d &transformation) const override;
+    void CheckBatch(
+            const geometry::PointCloud &source,
+            const geometry::PointCloud &target,
+            const CorrespondenceSet &corres,
+            const std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>
+                    &transformations,
+            std::vector<uint8_t> &mask) const override;
 
 public:
     /// Distance threashold for the check.
@@ -158,6 +197,13 @@ public:
                const geometry::PointCloud &target,
                const CorrespondenceSet &corres,
                const Eigen::Matrix4d &transformation) const override;
+    void CheckBatch(
+            const geometry::PointCloud &source,
+            const geometry::PointCloud &target,
+            const CorrespondenceSet &corres,
+            const std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>
+                    &transformations,
+            std::vector<uint8_t> &mask) const override;
 
 public:
     /// Radian value for angle threshold.
@@ -26,27 +26,30 @@
 
 #include "open3d/pipelines/registration/FastGlobalRegistration.h"
 
+#include <algorithm>
+
 #include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/pipelines/registration/Feature.h"
 #include "open3d/pipelines/registration/Registration.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/Eigen.h"
 #include "open3d/utility/Helper.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace pipelines {
 namespace registration {
 
 static std::vector<std::pair<int, int>> AdvancedMatching(
-        const std::vector<geometry::PointCloud>& point_cloud_vec,
-        const std::vector<Feature>& features_vec,
+        const std::vector<std::vector<Eigen::Vector3d>>& points_vec,
+        const std::vector<const Feature*>& features_vec,
         const FastGlobalRegistrationOption& option) {
     // STEP 0) Swap source and target if necessary
     int fi = 0, fj = 1;
     utility::LogDebug("Advanced matching : [{:d} - {:d}]", fi, fj);
     bool swapped = false;
-    if (point_cloud_vec[fj].points_.size() >
-        point_cloud_vec[fi].points_.size()) {
+    if (points_vec[fj].size() > points_vec[fi].size()) {
         int temp = fi;
         fi = fj;
         fj = temp;
@@ -54,133 +57,129 @@ static std::vector<std::pair<int, int>> AdvancedMatching(
     }
 
     // STEP 1) Initial matching
-    int nPti = int(point_cloud_vec[fi].points_.size());
-    int nPtj = int(point_cloud_vec[fj].points_.size());
-    geometry::KDTreeFlann feature_tree_i(features_vec[fi]);
-    geometry::KDTreeFlann feature_tree_j(features_vec[fj]);
-    std::vector<int> corresK;
-    std::vector<double> dis;
-    std::vector<std::pair<int, int>> corres;
-    std::vector<std::pair<int, int>> corres_ij;
-    std::vector<std::pair<int, int>> corres_ji;
+    // The nearest feature of every point of fj is searched in parallel, then
+    // the nearest feature of each point of fi matched by a point of fj.
+    int nPti = int(points_vec[fi].size());
+    int nPtj = int(points_vec[fj].size());
+    const Feature& feature_i = *features_vec[fi];
+    const Feature& feature_j = *features_vec[fj];
+    geometry::KDTreeFlann feature_tree_i(feature_i);
+    geometry::KDTreeFlann feature_tree_j(feature_j);
+    std::vector<int> j_to_i(nPtj, -1);
     std::vector<int> i_to_j(nPti, -1);
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
     for (int j = 0; j < nPtj; j++) {
-        feature_tree_i.SearchKNN(Eigen::VectorXd(features_vec[fj].data_.col(j)),
-                                 1, corresK, dis);
-        int i = corresK[0];
-        if (i_to_j[i] == -1) {
-            feature_tree_j.SearchKNN(
-                    Eigen::VectorXd(features_vec[fi].data_.col(i)), 1, corresK,
-                    dis);
-            int ij = corresK[0];
-            i_to_j[i] = ij;
-        }
-        corres_ji.push_back(std::pair<int, int>(i, j));
+        std::vector<int> corresK;
+        std::vector<double> dis;
+        feature_tree_i.SearchKNN(Eigen::VectorXd(feature_j.data_.col(j)), 1,
+                                 corresK, dis);
+        j_to_i[j] = corresK[0];
+    }
+    std::vector<char> matched_i(nPti, 0);
+    for (int j = 0; j < nPtj; j++) {
+        matched_i[j_to_i[j]] = 1;
     }
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
     for (int i = 0; i < nPti; i++) {
-        if (i_to_j[i] != -1)
-            corres_ij.push_back(std::pair<int, int>(i, i_to_j[i]));
+        if (!matched_i[i]) continue;
+        std::vector<int> corresK;
+        std::vector<double> dis;
+        feature_tree_j.SearchKNN(Eigen::VectorXd(feature_i.data_.col(i)), 1,
+                                 corresK, dis);
+        i_to_j[i] = corresK[0];
     }
-    int ncorres_ij = int(corres_ij.size());
-    int ncorres_ji = int(corres_ji.size());
-    for (int i = 0; i < ncorres_ij; ++i)
-        corres.push_back(
-                std::pair<int, int>(corres_ij[i].first, corres_ij[i].second));
-    for (int j = 0; j < ncorres_ji; ++j)
-        corres.push_back(
-                std::pair<int, int>(corres_ji[j].first, corres_ji[j].second));
-    utility::LogDebug("points are remained : {:d}", (int)corres.size());
+    int ncorres_ij = static_cast<int>(
+            std::count(matched_i.begin(), matched_i.end(), 1));
+    utility::LogDebug("points are remained : {:d}", ncorres_ij + nPtj);
 
     // STEP 2) CROSS CHECK
+    // Every point of fj has a single match in fi, so a pair (i, j) passes if
+    // i and j are mutual nearest neighbors.
     utility::LogDebug("\t[cross check] ");
     std::vector<std::pair<int, int>> corres_cross;
-    std::vector<std::vector<int>> Mi(nPti), Mj(nPtj);
-    int ci, cj;
-    for (int i = 0; i < ncorres_ij; ++i) {
-        ci = corres_ij[i].first;
-        cj = corres_ij[i].second;
-        Mi[ci].push_back(cj);
-    }
-    for (int j = 0; j < ncorres_ji; ++j) {
-        ci = corres_ji[j].first;
-        cj = corres_ji[j].second;
-        Mj[cj].push_back(ci);
-    }
     for (int i = 0; i < nPti; ++i) {
-        for (size_t ii = 0; ii < Mi[i].size(); ++ii) {
-            int j = Mi[i][ii];
-            for (size_t jj = 0; jj < Mj[j].size(); ++jj) {
-                if (Mj[j][jj] == i)
-                    corres_cross.push_back(std::pair<int, int>(i, j));
-            }
+        int j = i_to_j[i];
+        if (j != -1 && j_to_i[j] == i) {
+            corres_cross.push_back(std::pair<int, int>(i, j));
         }
     }
-    utility::LogDebug("points are remained : %d", (int)corres_cross.size());
+    utility::LogDebug("points are remained : {:d}", (int)corres_cross.size());
 
     // STEP 3) TUPLE CONSTRAINT
+    // Trials are drawn serially from the random generator, tested in parallel
+    // in batches, and accepted in order, as in a serial loop.
     utility::LogDebug("\t[tuple constraint] ");
-    int rand0, rand1, rand2, i, cnt = 0;
-    int idi0, idi1, idi2, idj0, idj1, idj2;
+    int i = 0, cnt = 0;
     double scale = option.tuple_scale_;
     int ncorr = static_cast<int>(corres_cross.size());
     int number_of_trial = ncorr * 100;
+    const int batch_size = std::max(option.maximum_tuple_count_, 1) * 4;
 
     std::vector<std::pair<int, int>> corres_tuple;
-    for (i = 0; i < number_of_trial; i++) {
-        rand0 = utility::UniformRandInt(0, ncorr - 1);
-        rand1 = utility::UniformRandInt(0, ncorr - 1);
-        rand2 = utility::UniformRandInt(0, ncorr - 1);
-        idi0 = corres_cross[rand0].first;
-        idj0 = corres_cross[rand0].second;
-        idi1 = corres_cross[rand1].first;
-        idj1 = corres_cross[rand1].second;
-        idi2 = corres_cross[rand2].first;
-        idj2 = corres_cross[rand2].second;
-
-        // collect 3 points from i-th fragment
-        Eigen::Vector3d pti0 = point_cloud_vec[fi].points_[idi0];
-        Eigen::Vector3d pti1 = point_cloud_vec[fi].points_[idi1];
-        Eigen::Vector3d pti2 = point_cloud_vec[fi].points_[idi2];
-        double li0 = (pti0 - pti1).norm();
-        double li1 = (pti1 - pti2).norm();
-        double li2 = (pti2 - pti0).norm();
-
-        // collect 3 points from j-th fragment
-        Eigen::Vector3d ptj0 = point_cloud_vec[fj].points_[idj0];
-        Eigen::Vector3d ptj1 = point_cloud_vec[fj].points_[idj1];
-        Eigen::Vector3d ptj2 = point_cloud_vec[fj].points_[idj2];
-        double lj0 = (ptj0 - ptj1).norm();
-        double lj1 = (ptj1 - ptj2).norm();
-        double lj2 = (ptj2 - ptj0).norm();
-
-        // check tuple constraint
-        if ((li0 * scale < lj0) && (lj0 < li0 / scale) && (li1 * scale < lj1) &&
-            (lj1 < li1 / scale) && (li2 * scale < lj2) && (lj2 < li2 / scale)) {
-            corres_tuple.push_back(std::pair<int, int>(idi0, idj0));
-            corres_tuple.push_back(std::pair<int, int>(idi1, idj1));
-            corres_tuple.push_back(std::pair<int, int>(idi2, idj2));
+    std::vector<Eigen::Vector3i> trials;
+    std::vector<char> accepted;
+    while (i < number_of_trial && cnt < option.maximum_tuple_count_) {
+        int num_trials = std::min(batch_size, number_of_trial - i);
+        trials.resize(num_trials);
+        accepted.assign(num_trials, 0);
+        for (Eigen::Vector3i& trial : trials) {
+            trial(0) = utility::UniformRandInt(0, ncorr - 1);
+            trial(1) = utility::UniformRandInt(0, ncorr - 1);
+            trial(2) = utility::UniformRandInt(0, ncorr - 1);
+        }
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+        for (int t = 0; t < num_trials; t++) {
+            const std::pair<int, int>& c0 = corres_cross[trials[t](0)];
+            const std::pair<int, int>& c1 = corres_cross[trials[t](1)];
+            const std::pair<int, int>& c2 = corres_cross[trials[t](2)];
+
+            // collect 3 points from i-th fragment
+            const Eigen::Vector3d& pti0 = points_vec[fi][c0.first];
+            const Eigen::Vector3d& pti1 = points_vec[fi][c1.first];
+            const Eigen::Vector3d& pti2 = points_vec[fi][c2.first];
+            double li0 = (pti0 - pti1).norm();
+            double li1 = (pti1 - pti2).norm();
+            double li2 = (pti2 - pti0).norm();
+
+            // collect 3 points from j-th fragment
+            const Eigen::Vector3d& ptj0 = points_vec[fj][c0.second];
+            const Eigen::Vector3d& ptj1 = points_vec[fj][c1.second];
+            const Eigen::Vector3d& ptj2 = points_vec[fj][c2.second];
+            double lj0 = (ptj0 - ptj1).norm();
+            double lj1 = (ptj1 - ptj2).norm();
+            double lj2 = (ptj2 - ptj0).norm();
+
+            // check tuple constraint
+            accepted[t] = (li0 * scale < lj0) && (lj0 < li0 / scale) &&
+                          (li1 * scale < lj1) && (lj1 < li1 / scale) &&
+                          (li2 * scale < lj2) && (lj2 < li2 / scale);
+        }
+        for (int t = 0; t < num_trials; t++) {
+            i++;
+            if (!accepted[t]) continue;
+            for (int k = 0; k < 3; k++) {
+                corres_tuple.push_back(corres_cross[trials[t](k)]);
+            }
             cnt++;
+            if (cnt >= option.maximum_tuple_count_) break;
         }
-        if (cnt >= option.maximum_tuple_count_) break;
     }
     utility::LogDebug("{:d} tuples ({:d} trial, {:d} actual).", cnt,
                       number_of_trial, i);
 
     if (swapped) {
-        std::vector<std::pair<int, int>> temp;
-        for (size_t i = 0; i < corres_tuple.size(); i++)
-            temp.push_back(std::pair<int, int>(corres_tuple[i].second,
-                                               corres_tuple[i].first));
-        corres_tuple.clear();
-        corres_tuple = temp;
+        for (std::pair<int, int>& corres : corres_tuple) {
+            std::swap(corres.first, corres.second);
+        }
     }
     utility::LogDebug("\t[final] matches {:d}.", (int)corres_tuple.size());
     return corres_tuple;
 }
 
 // Normalize scale of points. X' = (X-\mu)/scale
+// Only the points are copied, not the other attributes of the point clouds.
 static std::tuple<std::vector<Eigen::Vector3d>, double, double>
-NormalizePointCloud(std::vector<geometry::PointCloud>& point_cloud_vec,
+NormalizePointCloud(std::vector<std::vector<Eigen::Vector3d>>& points_vec,
                     const FastGlobalRegistrationOption& option) {
     int num = 2;
     double scale = 0;
@@ -192,20 +191,16 @@ NormalizePointCloud(std::vector<geometry::PointCloud>& point_cloud_vec,
         Eigen::Vector3d mean;
         mean.setZero();
 
-        int npti = static_cast<int>(point_cloud_vec[i].points_.size());
-        for (int ii = 0; ii < npti; ++ii)
-            mean = mean + point_cloud_vec[i].points_[ii];
+        int npti = static_cast<int>(points_vec[i].size());
+        for (int ii = 0; ii < npti; ++ii) mean = mean + points_vec[i][ii];
         mean = mean / npti;
         pcd_mean_vec.push_back(mean);
 
         utility::LogDebug("normalize points :: mean = [{:f} {:f} {:f}]",
                           mean(0), mean(1), mean(2));
-        for (int ii = 0; ii < npti; ++ii)
-            point_cloud_vec[i].points_[ii] -= mean;
-
         for (int ii = 0; ii < npti; ++ii) {
-            Eigen::Vector3d p(point_cloud_vec[i].points_[ii]);
-            double temp = p.norm();
+            points_vec[i][ii] -= mean;
+            double temp = points_vec[i][ii].norm();
             if (temp > max_scale) max_scale = temp;
         }
         if (max_scale > scale) scale = max_scale;
@@ -221,16 +216,15 @@ NormalizePointCloud(std::vector<geometry::PointCloud>& point_cloud_vec,
     utility::LogDebug("normalize points :: global scale : {:f}", scale_global);
 
     for (int i = 0; i < num; ++i) {
-        int npti = static_cast<int>(point_cloud_vec[i].points_.size());
-        for (int ii = 0; ii < npti; ++ii) {
-            point_cloud_vec[i].points_[ii] /= scale_global;
+        for (Eigen::Vector3d& point : points_vec[i]) {
+            point /= scale_global;
         }
     }
     return std::make_tuple(pcd_mean_vec, scale_global, scale_start);
 }
 
 static Eigen::Matrix4d OptimizePairwiseRegistration(
-        const std::vector<geometry::PointCloud>& point_cloud_vec,
+        const std::vector<std::vector<Eigen::Vector3d>>& points_vec,
         const std::vector<std::pair<int, int>>& corres,
         double scale_start,
         const FastGlobalRegistrationOption& option) {
@@ -239,69 +233,54 @@ static Eigen::Matrix4d OptimizePairwiseRegistration(
     int numIter = option.iteration_number_;
 
     int i = 0, j = 1;
-    geometry::PointCloud point_cloud_copy_j = point_cloud_vec[j];
 
     if (corres.size() < 10) return Eigen::Matrix4d::Identity();
 
-    std::vector<double> s(corres.size(), 1.0);
     Eigen::Matrix4d trans;
     trans.setIdentity();
 
     for (int itr = 0; itr < numIter; itr++) {
-        const int nvariable = 6;
-        Eigen::MatrixXd JTJ(nvariable, nvariable);
-        Eigen::MatrixXd JTr(nvariable, 1);
-        Eigen::MatrixXd J(nvariable, 1);
-        JTJ.setZero();
-        JTr.setZero();
-        double r = 0.0, r2 = 0.0;
-
-        for (size_t c = 0; c < corres.size(); c++) {
-            int ii = corres[c].first;
-            int jj = corres[c].second;
-            Eigen::Vector3d p, q;
-            p = point_cloud_vec[i].points_[ii];
-            q = point_cloud_copy_j.points_[jj];
-            Eigen::Vector3d rpq = p - q;
-
-            size_t c2 = c;
-            double temp = par / (rpq.dot(rpq) + par);
-            s[c2] = temp * temp;
-
-            J.setZero();
-            J(1) = -q(2);
-            J(2) = q(1);
-            J(3) = -1;
-            r = rpq(0);
-            JTJ += J * J.transpose() * s[c2];
-            JTr += J * r * s[c2];
-            r2 += r * r * s[c2];
-
-            J.setZero();
-            J(2) = -q(0);
-            J(0) = q(2);
-            J(4) = -1;
-            r = rpq(1);
-            JTJ += J * J.transpose() * s[c2];
-            JTr += J * r * s[c2];
-            r2 += r * r * s[c2];
-
-            J.setZero();
-            J(0) = -q(1);
-            J(1) = q(0);
-            J(5) = -1;
-            r = rpq(2);
-            JTJ += J * J.transpose() * s[c2];
-            JTr += J * r * s[c2];
-            r2 += r * r * s[c2];
-            r2 += (par * (1.0 - sqrt(s[c2])) * (1.0 - sqrt(s[c2])));
-        }
+        // The points of j are transformed on the fly, instead of transforming
+        // a copy of the whole point cloud after each iteration.
+        const Eigen::Matrix3d R = trans.block<3, 3>(0, 0);
+        const Eigen::Vector3d t = trans.block<3, 1>(0, 3);
+        auto compute_jacobian_and_residual =
+                [&](int c,
+                    std::vector<Eigen::Vector6d, utility::Vector6d_allocator>&
+                            J_r,
+                    std::vector<double>& r, std::vector<double>& w) {
+                    const Eigen::Vector3d& p = points_vec[i][corres[c].first];
+                    Eigen::Vector3d q = R * points_vec[j][corres[c].second] + t;
+                    Eigen::Vector3d rpq = p - q;
+
+                    double temp = par / (rpq.dot(rpq) + par);
+                    double s = temp * temp;
+
+                    J_r.resize(3);
+                    r.resize(3);
+                    w.resize(3);
+                    J_r[0] << 0, -q(2), q(1), -1, 0, 0;
+                    J_r[1] << q(2), 0, -q(0), 0, -1, 0;
+                    J_r[2] << -q(1), q(0), 0, 0, 0, -1;
+                    for (int k = 0; k < 3; k++) {
+                        r[k] = rpq(k);
+                        w[k] = s;
+                    }
+                };
+
+        Eigen::Matrix6d JTJ;
+        Eigen::Vector6d JTr;
+        double r2;
+        std::tie(JTJ, JTr, r2) =
+                utility::ComputeJTJandJTr<Eigen::Matrix6d, Eigen::Vector6d>(
+                        compute_jacobian_and_residual, (int)corres.size(),
+                        false);
+
         bool success;
         Eigen::VectorXd result;
         std::tie(success, result) = utility::SolveLinearSystemPSD(-JTJ, JTr);
         Eigen::Matrix4d delta = utility::TransformVector6dToMatrix4d(result);
         trans = delta * trans;
-        point_cloud_copy_j.Transform(delta);
 
         // graduated non-convexity.
         if (option.decrease_mu_) {
@@ -336,30 +315,25 @@ RegistrationResult FastGlobalRegistration(
         const Feature& target_feature,
         const FastGlobalRegistrationOption& option /* =
         FastGlobalRegistrationOption()*/) {
-    std::vector<geometry::PointCloud> point_cloud_vec;
-    geometry::PointCloud source_orig = source;
-    geometry::PointCloud target_orig = target;
-    point_cloud_vec.push_back(source);
-    point_cloud_vec.push_back(target);
-
-    std::vector<Feature> features_vec;
-    features_vec.push_back(source_feature);
-    features_vec.push_back(target_feature);
+    std::vector<std::vector<Eigen::Vector3d>> points_vec = {source.points_,
+                                                            target.points_};
+    std::vector<const Feature*> features_vec = {&source_feature,
+                                                &target_feature};
 
     double scale_global, scale_start;
     std::vector<Eigen::Vector3d> pcd_mean_vec;
     std::tie(pcd_mean_vec, scale_global, scale_start) =
-            NormalizePointCloud(point_cloud_vec, option);
+            NormalizePointCloud(points_vec, option);
     std::vector<std::pair<int, int>> corres;
-    corres = AdvancedMatching(point_cloud_vec, features_vec, option);
+    corres = AdvancedMatching(points_vec, features_vec, option);
     Eigen::Matrix4d transformation;
-    transformation = OptimizePairwiseRegistration(point_cloud_vec, corres,
+    transformation = OptimizePairwiseRegistration(points_vec, corres,
                                                   scale_global, option);
 
     // as the original code T * point_cloud_vec[1] is aligned with
     // point_cloud_vec[0] matrix inverse is applied here.
     return EvaluateRegistration(
-            source_orig, target_orig, option.maximum_correspondence_distance_,
+            source, target, option.maximum_correspondence_distance_,
             GetTransformationOriginalScale(transformation, pcd_mean_vec,
                                            scale_global)
                     .inverse());
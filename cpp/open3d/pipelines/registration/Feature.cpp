@@ -31,6 +31,7 @@
 #include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace pipelines {
@@ -72,20 +73,19 @@ static Eigen::Vector4d ComputePairFeatures(const Eigen::Vector3d &p1,
 
 static std::shared_ptr<Feature> ComputeSPFHFeature(
         const geometry::PointCloud &input,
-        const geometry::KDTreeFlann &kdtree,
-        const geometry::KDTreeSearchParam &search_param) {
+        const geometry::KDTreeSearchResult &neighbors) {
     auto feature = std::make_shared<Feature>();
     feature->Resize(33, (int)input.points_.size());
-#pragma omp parallel for schedule(static)
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
     for (int i = 0; i < (int)input.points_.size(); i++) {
         const auto &point = input.points_[i];
         const auto &normal = input.normals_[i];
-        std::vector<int> indices;
-        std::vector<double> distance2;
-        if (kdtree.Search(point, search_param, indices, distance2) > 1) {
+        const int num_neighbors = neighbors.NumNeighbors(i);
+        const int *indices = neighbors.Indices(i);
+        if (num_neighbors > 1) {
             // only compute SPFH feature when a point has neighbors
-            double hist_incr = 100.0 / (double)(indices.size() - 1);
-            for (size_t k = 1; k < indices.size(); k++) {
+            double hist_incr = 100.0 / (double)(num_neighbors - 1);
+            for (int k = 1; k < num_neighbors; k++) {
                 // skip the point itself, compute histogram
                 auto pf = ComputePairFeatures(point, normal,
                                               input.points_[indices[k]],
@@ -120,15 +120,17 @@ std::shared_ptr<Feature> ComputeFPFHFeature(
                 "normal.");
     }
     geometry::KDTreeFlann kdtree(input);
-    auto spfh = ComputeSPFHFeature(input, kdtree, search_param);
-#pragma omp parallel for schedule(static)
+    geometry::KDTreeSearchResult neighbors;
+    kdtree.SearchBatch(input.points_, search_param, neighbors);
+    auto spfh = ComputeSPFHFeature(input, neighbors);
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
     for (int i = 0; i < (int)input.points_.size(); i++) {
-        const auto &point = input.points_[i];
-        std::vector<int> indices;
-        std::vector<double> distance2;
-        if (kdtree.Search(point, search_param, indices, distance2) > 1) {
+        const int num_neighbors = neighbors.NumNeighbors(i);
+        const int *indices = neighbors.Indices(i);
+        const double *distance2 = neighbors.Distance2(i);
+        if (num_neighbors > 1) {
             double sum[3] = {0.0, 0.0, 0.0};
-            for (size_t k = 1; k < indices.size(); k++) {
+            for (int k = 1; k < num_neighbors; k++) {
                 // skip the point itself
                 double dist = distance2[k];
                 if (dist == 0.0) continue;
@@ -36,6 +36,7 @@
 #include "open3d/pipelines/registration/PoseGraph.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/Eigen.h"
+#include "open3d/utility/Parallel.h"
 #include "open3d/utility/Timer.h"
 
 namespace open3d {
@@ -184,6 +185,7 @@ static double ComputeResidual(const PoseGraph &pose_graph,
 static Eigen::VectorXd ComputeZeta(const PoseGraph &pose_graph) {
     int n_edges = (int)pose_graph.edges_.size();
     Eigen::VectorXd output(n_edges * 6);
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
     for (int iter_edge = 0; iter_edge < n_edges; iter_edge++) {
         Eigen::Matrix4d X_inv, Ts, Tt_inv;
         std::tie(X_inv, Ts, Tt_inv) = GetRelativePoses(pose_graph, iter_edge);
@@ -206,15 +208,19 @@ static Eigen::VectorXd ComputeZeta(const PoseGraph &pose_graph) {
 ///
 /// This function focuses the case that every edge has two nodes (not hyper
 /// graph) so we have two Jacobian matrices from one constraint.
-static std::tuple<Eigen::MatrixXd, Eigen::VectorXd> ComputeLinearSystem(
-        const PoseGraph &pose_graph, const Eigen::VectorXd &zeta) {
+///
+/// H is assembled as a sparse matrix of 6x6 blocks, with the four blocks of
+/// each edge. The Jacobians of the edges are evaluated in parallel, each edge
+/// writing its own range of triplets; duplicate entries are summed by
+/// setFromTriplets.
+static std::tuple<Eigen::SparseMatrix<double>, Eigen::VectorXd>
+ComputeLinearSystem(const PoseGraph &pose_graph, const Eigen::VectorXd &zeta) {
     int n_nodes = (int)pose_graph.nodes_.size();
     int n_edges = (int)pose_graph.edges_.size();
-    Eigen::MatrixXd H(n_nodes * 6, n_nodes * 6);
-    Eigen::VectorXd b(n_nodes * 6);
-    H.setZero();
-    b.setZero();
+    std::vector<Eigen::Triplet<double>> triplets(n_edges * 4 * 36);
+    Eigen::Matrix<double, 6, Eigen::Dynamic> b_edges(6, n_edges * 2);
 
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
     for (int iter_edge = 0; iter_edge < n_edges; iter_edge++) {
         const PoseGraphEdge &t = pose_graph.edges_[iter_edge];
         Eigen::Vector6d e = zeta.block<6, 1>(iter_edge * 6, 0);
@@ -231,22 +237,62 @@ static std::tuple<Eigen::MatrixXd, Eigen::VectorXd> ComputeLinearSystem(
 
         int id_i = t.source_node_id_ * 6;
         int id_j = t.target_node_id_ * 6;
-        H.block<6, 6>(id_i, id_i).noalias() +=
-                line_process_iter * JsT_Info * Js;
-        H.block<6, 6>(id_i, id_j).noalias() +=
-                line_process_iter * JsT_Info * Jt;
-        H.block<6, 6>(id_j, id_i).noalias() +=
-                line_process_iter * JtT_Info * Js;
-        H.block<6, 6>(id_j, id_j).noalias() +=
-                line_process_iter * JtT_Info * Jt;
-        b.block<6, 1>(id_i, 0).noalias() -=
-                line_process_iter * eT_Info.transpose() * Js;
-        b.block<6, 1>(id_j, 0).noalias() -=
-                line_process_iter * eT_Info.transpose() * Jt;
+        const Eigen::Matrix6d blocks[4] = {
+                line_process_iter * JsT_Info * Js,
+                line_process_iter * JsT_Info * Jt,
+                line_process_iter * JtT_Info * Js,
+                line_process_iter * JtT_Info * Jt};
+        const int rows[4] = {id_i, id_i, id_j, id_j};
+        const int cols[4] = {id_i, id_j, id_i, id_j};
+        Eigen::Triplet<double> *edge_triplets =
+                triplets.data() + iter_edge * 4 * 36;
+        for (int k = 0; k < 4; k++) {
+            for (int r = 0; r < 6; r++) {
+                for (int c = 0; c < 6; c++) {
+                    *edge_triplets++ = Eigen::Triplet<double>(
+                            rows[k] + r, cols[k] + c, blocks[k](r, c));
+                }
+            }
+        }
+        b_edges.col(iter_edge * 2).noalias() =
+                -line_process_iter * Js.transpose() * eT_Info;
+        b_edges.col(iter_edge * 2 + 1).noalias() =
+                -line_process_iter * Jt.transpose() * eT_Info;
+    }
+
+    Eigen::SparseMatrix<double> H(n_nodes * 6, n_nodes * 6);
+    H.setFromTriplets(triplets.begin(), triplets.end());
+    Eigen::VectorXd b(n_nodes * 6);
+    b.setZero();
+    for (int iter_edge = 0; iter_edge < n_edges; iter_edge++) {
+        const PoseGraphEdge &t = pose_graph.edges_[iter_edge];
+        b.block<6, 1>(t.source_node_id_ * 6, 0) += b_edges.col(iter_edge * 2);
+        b.block<6, 1>(t.target_node_id_ * 6, 0) +=
+                b_edges.col(iter_edge * 2 + 1);
     }
     return std::make_tuple(std::move(H), std::move(b));
 }
 
+/// Solves the sparse system H delta = b by a sparse LDLT decomposition,
+/// falling back to the dense solver if the decomposition fails.
+static std::tuple<bool, Eigen::VectorXd> SolvePoseGraphSystem(
+        const Eigen::SparseMatrix<double> &H, const Eigen::VectorXd &b) {
+    Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> H_ldlt;
+    H_ldlt.compute(H);
+    if (H_ldlt.info() == Eigen::Success) {
+        Eigen::VectorXd x = H_ldlt.solve(b);
+        if (H_ldlt.info() == Eigen::Success) {
+            return std::make_tuple(true, std::move(x));
+        }
+        utility::LogWarning(
+                "Sparse LDLT solve failed, switched to dense solver");
+    } else {
+        utility::LogWarning(
+                "Sparse LDLT decompose failed, switched to dense solver");
+    }
+    return utility::SolveLinearSystemPSD(Eigen::MatrixXd(H), b);
+}
+
 static Eigen::VectorXd UpdatePoseVector(const PoseGraph &pose_graph) {
     int n_nodes = (int)pose_graph.nodes_.size();
     Eigen::VectorXd output(n_nodes * 6);
@@ -511,7 +557,7 @@ void GlobalOptimizationGaussNewton::OptimizePoseGraph(
     valid_edges_num =
             UpdateConfidence(pose_graph, zeta, line_process_weight, option);
 
-    Eigen::MatrixXd H;
+    Eigen::SparseMatrix<double> H;
     Eigen::VectorXd b;
     Eigen::VectorXd x = UpdatePoseVector(pose_graph);
 
@@ -532,10 +578,8 @@ void GlobalOptimizationGaussNewton::OptimizePoseGraph(
         Eigen::VectorXd delta(H.cols());
         bool solver_success = false;
 
-        // Solve H_LM @ delta == b using a sparse solver
-        std::tie(solver_success, delta) = utility::SolveLinearSystemPSD(
-                H, b, /*prefer_sparse=*/true, /*check_symmetric=*/false,
-                /*check_det=*/false, /*check_psd=*/false);
+        // Solve H @ delta == b using a sparse solver
+        std::tie(solver_success, delta) = SolvePoseGraphSystem(H, b);
 
         stop = stop || CheckRelativeIncrement(delta, x, criteria);
         if (stop) {
@@ -602,8 +646,9 @@ void GlobalOptimizationLevenbergMarquardt::OptimizePoseGraph(
     int valid_edges_num =
             UpdateConfidence(pose_graph, zeta, line_process_weight, option);
 
-    Eigen::MatrixXd H_I = Eigen::MatrixXd::Identity(n_nodes * 6, n_nodes * 6);
-    Eigen::MatrixXd H;
+    Eigen::SparseMatrix<double> H_I(n_nodes * 6, n_nodes * 6);
+    H_I.setIdentity();
+    Eigen::SparseMatrix<double> H;
     Eigen::VectorXd b;
     Eigen::VectorXd x = UpdatePoseVector(pose_graph);
 
@@ -629,14 +674,12 @@ void GlobalOptimizationLevenbergMarquardt::OptimizePoseGraph(
         timer_iter.Start();
         int lm_count = 0;
         do {
-            Eigen::MatrixXd H_LM = H + current_lambda * H_I;
+            Eigen::SparseMatrix<double> H_LM = H + current_lambda * H_I;
             Eigen::VectorXd delta(H_LM.cols());
             bool solver_success = false;
 
             // Solve H_LM @ delta == b using a sparse solver
-            std::tie(solver_success, delta) = utility::SolveLinearSystemPSD(
-                    H_LM, b, /*prefer_sparse=*/true, /*check_symmetric=*/false,
-                    /*check_det=*/false, /*check_psd=*/false);
+            std::tie(solver_success, delta) = SolvePoseGraphSystem(H_LM, b);
 
             stop = stop || CheckRelativeIncrement(delta, x, criteria);
             if (!stop) {
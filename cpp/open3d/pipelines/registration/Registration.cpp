@@ -26,63 +26,93 @@
 
 #include "open3d/pipelines/registration/Registration.h"
 
+#include <algorithm>
+
 #include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/pipelines/registration/Feature.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/Helper.h"
+#include "open3d/utility/Parallel.h"
+#include "open3d/utility/Trace.h"
 
 namespace open3d {
 namespace pipelines {
 namespace registration {
 
-static RegistrationResult GetRegistrationResultAndCorrespondences(
+/// Number of RANSAC hypotheses sampled and checked together.
+static constexpr int kRANSACCheckBatchSize = 64;
+
+/// Find the nearest target point of each source point within
+/// \p max_correspondence_distance, and update \p result in place.
+/// \p target_indices is a per-source-point buffer, with -1 for the points
+/// without correspondence. Both are kept across ICP iterations, so that the
+/// search does not reallocate them.
+static void UpdateRegistrationResultAndCorrespondences(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
         const geometry::KDTreeFlann &target_kdtree,
         double max_correspondence_distance,
-        const Eigen::Matrix4d &transformation) {
-    RegistrationResult result(transformation);
+        const Eigen::Matrix4d &transformation,
+        std::vector<int> &target_indices,
+        RegistrationResult &result) {
+    OPEN3D_TRACE_SCOPE("ICP::Correspondence");
+    result.transformation_ = transformation;
+    result.correspondence_set_.clear();
+    result.fitness_ = 0.0;
+    result.inlier_rmse_ = 0.0;
     if (max_correspondence_distance <= 0.0) {
-        return result;
+        return;
     }
 
+    const int num_points = (int)source.points_.size();
+    target_indices.resize(num_points);
     double error2 = 0.0;
-
-#pragma omp parallel
+    int num_correspondences = 0;
+#pragma omp parallel reduction(+ : error2, num_correspondences) num_threads(utility::EstimateMaxThreads())
     {
-        double error2_private = 0.0;
-        CorrespondenceSet correspondence_set_private;
-#pragma omp for nowait
-        for (int i = 0; i < (int)source.points_.size(); i++) {
-            std::vector<int> indices(1);
-            std::vector<double> dists(1);
-            const auto &point = source.points_[i];
-            if (target_kdtree.SearchHybrid(point, max_correspondence_distance,
-                                           1, indices, dists) > 0) {
-                error2_private += dists[0];
-                correspondence_set_private.push_back(
-                        Eigen::Vector2i(i, indices[0]));
-            }
-        }
-#pragma omp critical
-        {
-            for (int i = 0; i < (int)correspondence_set_private.size(); i++) {
-                result.correspondence_set_.push_back(
-                        correspondence_set_private[i]);
+        // Search outputs of the thread, reused by all its queries.
+        std::vector<int> indices(1);
+        std::vector<double> distance2(1);
+#pragma omp for schedule(static)
+        for (int i = 0; i < num_points; i++) {
+            if (target_kdtree.SearchHybrid(source.points_[i],
+                                           max_correspondence_distance, 1,
+                                           indices, distance2) > 0) {
+                target_indices[i] = indices[0];
+                error2 += distance2[0];
+                num_correspondences++;
+            } else {
+                target_indices[i] = -1;
             }
-            error2 += error2_private;
         }
     }
+    if (num_correspondences == 0) {
+        return;
+    }
 
-    if (result.correspondence_set_.empty()) {
-        result.fitness_ = 0.0;
-        result.inlier_rmse_ = 0.0;
-    } else {
-        size_t corres_number = result.correspondence_set_.size();
-        result.fitness_ = (double)corres_number / (double)source.points_.size();
-        result.inlier_rmse_ = std::sqrt(error2 / (double)corres_number);
+    result.correspondence_set_.reserve(num_correspondences);
+    for (int i = 0; i < num_points; i++) {
+        if (target_indices[i] >= 0) {
+            result.correspondence_set_.push_back(
+                    Eigen::Vector2i(i, target_indices[i]));
+        }
     }
+    result.fitness_ = (double)num_correspondences / (double)num_points;
+    result.inlier_rmse_ = std::sqrt(error2 / (double)num_correspondences);
+}
+
+static RegistrationResult GetRegistrationResultAndCorrespondences(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const geometry::KDTreeFlann &target_kdtree,
+        double max_correspondence_distance,
+        const Eigen::Matrix4d &transformation) {
+    RegistrationResult result(transformation);
+    std::vector<int> target_indices;
+    UpdateRegistrationResultAndCorrespondences(
+            source, target, target_kdtree, max_correspondence_distance,
+            transformation, target_indices, result);
     return result;
 }
 
@@ -120,8 +150,10 @@ RegistrationResult EvaluateRegistration(
         const geometry::PointCloud &target,
         double max_correspondence_distance,
         const Eigen::Matrix4d
-                &transformation /* = Eigen::Matrix4d::Identity()*/) {
-    geometry::KDTreeFlann kdtree;
+                &transformation /* = Eigen::Matrix4d::Identity()*/,
+        geometry::KDTreeFlann::Precision
+                precision /* = geometry::KDTreeFlann::Precision::Float64*/) {
+    geometry::KDTreeFlann kdtree(precision);
     kdtree.SetGeometry(target);
     geometry::PointCloud pcd = source;
     if (!transformation.isIdentity()) {
@@ -139,7 +171,10 @@ RegistrationResult RegistrationICP(
         const TransformationEstimation &estimation
         /* = TransformationEstimationPointToPoint(false)*/,
         const ICPConvergenceCriteria
-                &criteria /* = ICPConvergenceCriteria()*/) {
+                &criteria /* = ICPConvergenceCriteria()*/,
+        geometry::KDTreeFlann::Precision
+                precision /* = geometry::KDTreeFlann::Precision::Float64*/) {
+    OPEN3D_TRACE_SCOPE("ICP");
     if (max_correspondence_distance <= 0.0) {
         utility::LogError("Invalid max_correspondence_distance.");
     }
@@ -155,15 +190,17 @@ RegistrationResult RegistrationICP(
     }
 
     Eigen::Matrix4d transformation = init;
-    geometry::KDTreeFlann kdtree;
+    geometry::KDTreeFlann kdtree(precision);
     kdtree.SetGeometry(target);
     geometry::PointCloud pcd = source;
     if (!init.isIdentity()) {
         pcd.Transform(init);
     }
     RegistrationResult result;
-    result = GetRegistrationResultAndCorrespondences(
-            pcd, target, kdtree, max_correspondence_distance, transformation);
+    std::vector<int> target_indices;
+    UpdateRegistrationResultAndCorrespondences(
+            pcd, target, kdtree, max_correspondence_distance, transformation,
+            target_indices, result);
     for (int i = 0; i < criteria.max_iteration_; i++) {
         utility::LogDebug("ICP Iteration #{:d}: Fitness {:.4f}, RMSE {:.4f}", i,
                           result.fitness_, result.inlier_rmse_);
@@ -171,14 +208,15 @@ RegistrationResult RegistrationICP(
                 pcd, target, result.correspondence_set_);
         transformation = update * transformation;
         pcd.Transform(update);
-        RegistrationResult backup = result;
-        result = GetRegistrationResultAndCorrespondences(
+        double prev_fitness = result.fitness_;
+        double prev_inlier_rmse = result.inlier_rmse_;
+        UpdateRegistrationResultAndCorrespondences(
                 pcd, target, kdtree, max_correspondence_distance,
-                transformation);
+                transformation, target_indices, result);
 
-        if (std::abs(backup.fitness_ - result.fitness_) <
+        if (std::abs(prev_fitness - result.fitness_) <
                     criteria.relative_fitness_ &&
-            std::abs(backup.inlier_rmse_ - result.inlier_rmse_) <
+            std::abs(prev_inlier_rmse - result.inlier_rmse_) <
                     criteria.relative_rmse_) {
             break;
         }
@@ -198,6 +236,7 @@ RegistrationResult RegistrationRANSACBasedOnCorrespondence(
                 &checkers /* = {}*/,
         const RANSACConvergenceCriteria &criteria
         /* = RANSACConvergenceCriteria()*/) {
+    OPEN3D_TRACE_SCOPE("RANSAC");
     if (ransac_n < 3 || (int)corres.size() < ransac_n ||
         max_correspondence_distance <= 0.0) {
         return RegistrationResult();
@@ -206,35 +245,51 @@ RegistrationResult RegistrationRANSACBasedOnCorrespondence(
     RegistrationResult best_result;
     int exit_itr = -1;
 
-#pragma omp parallel
+#pragma omp parallel num_threads(utility::EstimateMaxThreads())
     {
         CorrespondenceSet ransac_corres(ransac_n);
+        CorrespondenceSet batch_corres;
+        std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>
+                batch_transformations;
+        std::vector<uint8_t> batch_mask;
         RegistrationResult best_result_local;
         int exit_itr_local = criteria.max_iteration_;
 
+        // Hypotheses are sampled and checked in batches, so that each checker
+        // is called once per batch rather than once per hypothesis.
 #pragma omp for nowait
-        for (int itr = 0; itr < criteria.max_iteration_; itr++) {
-            if (itr < exit_itr_local) {
+        for (int batch_begin = 0; batch_begin < criteria.max_iteration_;
+             batch_begin += kRANSACCheckBatchSize) {
+            const int batch_end =
+                    std::min(batch_begin + kRANSACCheckBatchSize,
+                             std::min(criteria.max_iteration_, exit_itr_local));
+            batch_corres.clear();
+            batch_transformations.clear();
+            for (int itr = batch_begin; itr < batch_end; itr++) {
                 for (int j = 0; j < ransac_n; j++) {
                     ransac_corres[j] = corres[utility::UniformRandInt(
                             0, static_cast<int>(corres.size()) - 1)];
                 }
-
-                Eigen::Matrix4d transformation =
+                batch_corres.insert(batch_corres.end(), ransac_corres.begin(),
+                                    ransac_corres.end());
+                batch_transformations.push_back(
                         estimation.ComputeTransformation(source, target,
-                                                         ransac_corres);
-
-                // Check transformation: inexpensive
-                bool check = true;
-                for (const auto &checker : checkers) {
-                    if (!checker.get().Check(source, target, ransac_corres,
-                                             transformation)) {
-                        check = false;
-                        break;
-                    }
-                }
-                if (!check) continue;
+                                                         ransac_corres));
+            }
+
+            // Check transformation: inexpensive
+            batch_mask.assign(batch_transformations.size(), 1);
+            for (const auto &checker : checkers) {
+                checker.get().CheckBatch(source, target, batch_corres,
+                                         batch_transformations, batch_mask);
+            }
 
+            for (int i = 0; i < static_cast<int>(batch_mask.size()); i++) {
+                if (!batch_mask[i] || batch_begin + i >= exit_itr_local) {
+                    continue;
+                }
+                const Eigen::Matrix4d &transformation =
+                        batch_transformations[i];
                 geometry::PointCloud pcd = source;
                 pcd.Transform(transformation);
                 auto result = EvaluateRANSACBasedOnCorrespondence(
@@ -253,8 +308,8 @@ RegistrationResult RegistrationRANSACBasedOnCorrespondence(
                                     ? static_cast<int>(std::ceil(exit_itr_d))
                                     : exit_itr_local;
                 }
-            }  // if < exit_itr_local
-        }      // for loop
+            }
+        }
 #pragma omp critical
         {
             if (best_result_local.IsBetterRANSACThan(best_result)) {
@@ -286,6 +341,7 @@ RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
                 &checkers /* = {}*/,
         const RANSACConvergenceCriteria &criteria
         /* = RANSACConvergenceCriteria()*/) {
+    OPEN3D_TRACE_SCOPE("RANSAC");
     if (ransac_n < 3 || max_correspondence_distance <= 0.0) {
         return RegistrationResult();
     }
@@ -296,7 +352,7 @@ RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
     geometry::KDTreeFlann kdtree_target(target_feature);
     pipelines::registration::CorrespondenceSet corres_ij(num_src_pts);
 
-#pragma omp parallel for
+#pragma omp parallel for num_threads(utility::EstimateMaxThreads())
     for (int i = 0; i < num_src_pts; i++) {
         std::vector<int> corres_tmp(1);
         std::vector<double> dist_tmp(1);
@@ -312,7 +368,7 @@ RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
         geometry::KDTreeFlann kdtree_source(source_feature);
         pipelines::registration::CorrespondenceSet corres_ji(num_tgt_pts);
 
-#pragma omp parallel for
+#pragma omp parallel for num_threads(utility::EstimateMaxThreads())
         for (int j = 0; j < num_tgt_pts; ++j) {
             std::vector<int> corres_tmp(1);
             std::vector<double> dist_tmp(1);
@@ -368,7 +424,7 @@ Eigen::Matrix6d GetInformationMatrixFromPointClouds(
     // see http://redwood-data.org/indoor/registration.html
     // note: I comes first in this implementation
     Eigen::Matrix6d GTG = Eigen::Matrix6d::Zero();
-#pragma omp parallel
+#pragma omp parallel num_threads(utility::EstimateMaxThreads())
     {
         Eigen::Matrix6d GTG_private = Eigen::Matrix6d::Zero();
         Eigen::Vector6d G_r_private = Eigen::Vector6d::Zero();
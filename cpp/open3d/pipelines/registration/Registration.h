@@ -30,6 +30,7 @@
 #include <tuple>
 #include <vector>
 
+#include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/pipelines/registration/CorrespondenceChecker.h"
 #include "open3d/pipelines/registration/TransformationEstimation.h"
 #include "open3d/utility/Eigen.h"
@@ -148,11 +149,14 @@ public:
 /// distance. \param transformation The 4x4 transformation matrix to transform
 /// source to target. Default value: array([[1., 0., 0., 0.], [0., 1., 0., 0.],
 /// [0., 0., 1., 0.], [0., 0., 0., 1.]]).
+/// \param precision Scalar type of the KDTree built on the target.
 RegistrationResult EvaluateRegistration(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
         double max_correspondence_distance,
-        const Eigen::Matrix4d &transformation = Eigen::Matrix4d::Identity());
+        const Eigen::Matrix4d &transformation = Eigen::Matrix4d::Identity(),
+        geometry::KDTreeFlann::Precision precision =
+                geometry::KDTreeFlann::Precision::Float64);
 
 /// \brief Functions for ICP registration.
 ///
@@ -164,6 +168,9 @@ RegistrationResult EvaluateRegistration(
 ///  [0., 0., 0., 1.]])
 /// \param estimation Estimation method.
 /// \param criteria Convergence criteria.
+/// \param precision Scalar type of the KDTree built on the target. Float32
+/// halves the memory of the tree, with correspondence distances only accurate
+/// to single precision.
 RegistrationResult RegistrationICP(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
@@ -171,7 +178,9 @@ RegistrationResult RegistrationICP(
         const Eigen::Matrix4d &init = Eigen::Matrix4d::Identity(),
         const TransformationEstimation &estimation =
                 TransformationEstimationPointToPoint(false),
-        const ICPConvergenceCriteria &criteria = ICPConvergenceCriteria());
+        const ICPConvergenceCriteria &criteria = ICPConvergenceCriteria(),
+        geometry::KDTreeFlann::Precision precision =
+                geometry::KDTreeFlann::Precision::Float64);
 
 /// \brief Function for global RANSAC registration based on a given set of
 /// correspondences.
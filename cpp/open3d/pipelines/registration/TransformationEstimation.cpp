@@ -30,6 +30,7 @@
 
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/utility/Eigen.h"
+#include "open3d/utility/Trace.h"
 
 namespace open3d {
 namespace pipelines {
@@ -51,6 +52,7 @@ Eigen::Matrix4d TransformationEstimationPointToPoint::ComputeTransformation(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
         const CorrespondenceSet &corres) const {
+    OPEN3D_TRACE_SCOPE("ICP::TransformationEstimation");
     if (corres.empty()) return Eigen::Matrix4d::Identity();
     Eigen::MatrixXd source_mat(3, corres.size());
     Eigen::MatrixXd target_mat(3, corres.size());
@@ -79,6 +81,7 @@ Eigen::Matrix4d TransformationEstimationPointToPlane::ComputeTransformation(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
         const CorrespondenceSet &corres) const {
+    OPEN3D_TRACE_SCOPE("ICP::TransformationEstimation");
     if (corres.empty() || !target.HasNormals())
         return Eigen::Matrix4d::Identity();
 
@@ -26,9 +26,13 @@
 
 #include "open3d/t/geometry/Image.h"
 
+#include <cmath>
+#include <vector>
+
 #include "open3d/core/Dtype.h"
 #include "open3d/core/ShapeUtil.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/kernel/Image.h"
 #include "open3d/utility/Console.h"
 
 namespace open3d {
@@ -69,6 +73,267 @@ Image::Image(const core::Tensor &tensor)
     }
 }
 
+namespace {
+
+void AssertProcessingDtype(core::Dtype dtype) {
+    if (dtype != core::Dtype::UInt8 && dtype != core::Dtype::UInt16 &&
+        dtype != core::Dtype::Float32) {
+        utility::LogError(
+                "Only UInt8, UInt16 and Float32 images are supported, but got "
+                "{}.",
+                dtype.ToString());
+    }
+}
+
+void AssertDepthDtype(const Image &image) {
+    if (image.GetChannels() != 1 ||
+        (image.GetDtype() != core::Dtype::UInt16 &&
+         image.GetDtype() != core::Dtype::Float32)) {
+        utility::LogError(
+                "Only UInt16 and Float32 single-channel images are supported, "
+                "but got {} with {} channels.",
+                image.GetDtype().ToString(), image.GetChannels());
+    }
+}
+
+void AssertOddKernelSize(int64_t kernel_size) {
+    if (kernel_size < 1 || kernel_size % 2 == 0) {
+        utility::LogError("Kernel size must be odd and positive, but got {}.",
+                          kernel_size);
+    }
+}
+
+}  // namespace
+
+Image Image::To(core::Dtype dtype,
+                bool copy,
+                utility::optional<double> scale,
+                double offset) const {
+    AssertProcessingDtype(GetDtype());
+    AssertProcessingDtype(dtype);
+
+    double scale_value = 1.0;
+    if (scale.has_value()) {
+        scale_value = scale.value();
+    } else if (dtype == core::Dtype::Float32) {
+        if (GetDtype() == core::Dtype::UInt8) {
+            scale_value = 1.0 / 255;
+        } else if (GetDtype() == core::Dtype::UInt16) {
+            scale_value = 1.0 / 65535;
+        }
+    } else if (GetDtype() == core::Dtype::Float32) {
+        if (dtype == core::Dtype::UInt8) {
+            scale_value = 255;
+        } else if (dtype == core::Dtype::UInt16) {
+            scale_value = 65535;
+        }
+    }
+
+    if (!copy && dtype == GetDtype() && scale_value == 1.0 && offset == 0.0) {
+        return *this;
+    }
+    Image dst(GetRows(), GetCols(), GetChannels(), dtype, GetDevice());
+    kernel::image::To(data_, dst.data_, static_cast<float>(scale_value),
+                      static_cast<float>(offset));
+    return dst;
+}
+
+Image Image::ClipTransform(float scale,
+                           float min_value,
+                           float max_value,
+                           float clip_fill) const {
+    if (GetChannels() != 1 || (GetDtype() != core::Dtype::UInt16 &&
+                               GetDtype() != core::Dtype::Float32)) {
+        utility::LogError(
+                "Only UInt16 or Float32 single-channel images are supported, "
+                "but got {} with {} channels.",
+                GetDtype().ToString(), GetChannels());
+    }
+    if (scale <= 0) {
+        utility::LogError("Scale must be positive, but got {}.", scale);
+    }
+    Image dst(GetRows(), GetCols(), 1, core::Dtype::Float32, GetDevice());
+    kernel::image::ClipTransform(data_, dst.data_, scale, min_value, max_value,
+                                 clip_fill);
+    return dst;
+}
+
+Image Image::Filter(const core::Tensor &kernel) const {
+    AssertProcessingDtype(GetDtype());
+    kernel.AssertDtype(core::Dtype::Float32);
+    if (kernel.NumDims() != 2) {
+        utility::LogError("Kernel must be 2-D, but got shape {}.",
+                          kernel.GetShape());
+    }
+    AssertOddKernelSize(kernel.GetShape(0));
+    AssertOddKernelSize(kernel.GetShape(1));
+
+    Image dst(GetRows(), GetCols(), GetChannels(), GetDtype(), GetDevice());
+    kernel::image::Filter(data_, dst.data_,
+                          kernel.Contiguous().Copy(GetDevice()));
+    return dst;
+}
+
+Image Image::FilterGaussian(int kernel_size, float sigma) const {
+    AssertProcessingDtype(GetDtype());
+    AssertOddKernelSize(kernel_size);
+    if (sigma <= 0) {
+        utility::LogError("Sigma must be positive, but got {}.", sigma);
+    }
+
+    std::vector<float> weights(kernel_size);
+    float sum = 0;
+    for (int i = 0; i < kernel_size; ++i) {
+        float x = static_cast<float>(i - kernel_size / 2);
+        weights[i] = std::exp(-0.5f * x * x / (sigma * sigma));
+        sum += weights[i];
+    }
+    for (float &weight : weights) {
+        weight /= sum;
+    }
+    core::Tensor kernel(weights, {kernel_size}, core::Dtype::Float32,
+                        GetDevice());
+
+    Image dst(GetRows(), GetCols(), GetChannels(), GetDtype(), GetDevice());
+    kernel::image::FilterSeparable(data_, dst.data_, kernel, kernel);
+    return dst;
+}
+
+Image Image::FilterBilateral(int kernel_size,
+                             float value_sigma,
+                             float distance_sigma) const {
+    AssertProcessingDtype(GetDtype());
+    AssertOddKernelSize(kernel_size);
+    if (GetChannels() > 4) {
+        utility::LogError("At most 4 channels are supported, but got {}.",
+                          GetChannels());
+    }
+    if (value_sigma <= 0 || distance_sigma <= 0) {
+        utility::LogError("Sigmas must be positive, but got {} and {}.",
+                          value_sigma, distance_sigma);
+    }
+
+    Image dst(GetRows(), GetCols(), GetChannels(), GetDtype(), GetDevice());
+    kernel::image::FilterBilateral(data_, dst.data_, kernel_size, value_sigma,
+                                   distance_sigma);
+    return dst;
+}
+
+Image Image::FilterBilateralDepth(int kernel_size,
+                                  float depth_sigma,
+                                  float distance_sigma) const {
+    AssertDepthDtype(*this);
+    AssertOddKernelSize(kernel_size);
+    if (depth_sigma <= 0 || distance_sigma <= 0) {
+        utility::LogError("Sigmas must be positive, but got {} and {}.",
+                          depth_sigma, distance_sigma);
+    }
+
+    Image dst(GetRows(), GetCols(), 1, GetDtype(), GetDevice());
+    kernel::image::FilterBilateralDepth(data_.Contiguous(), dst.data_,
+                                        kernel_size, depth_sigma,
+                                        distance_sigma);
+    return dst;
+}
+
+Image Image::RegisterDepth(const core::Tensor &depth_intrinsic,
+                           const core::Tensor &target_intrinsic,
+                           const core::Tensor &extrinsic,
+                           int64_t rows,
+                           int64_t cols,
+                           float depth_scale) const {
+    AssertDepthDtype(*this);
+    depth_intrinsic.AssertShape({3, 3});
+    target_intrinsic.AssertShape({3, 3});
+    extrinsic.AssertShape({4, 4});
+    if (rows <= 0 || cols <= 0) {
+        utility::LogError("Target size must be positive, but got {}x{}.", rows,
+                          cols);
+    }
+    if (depth_scale <= 0) {
+        utility::LogError("Depth scale must be positive, but got {}.",
+                          depth_scale);
+    }
+
+    // The kernels read the matrices on the host when they are launched.
+    core::Device host("CPU:0");
+    Image dst(rows, cols, 1, GetDtype(), GetDevice());
+    kernel::image::RegisterDepth(
+            data_.Contiguous(), dst.data_,
+            depth_intrinsic.Copy(host).To(core::Dtype::Float32),
+            target_intrinsic.Copy(host).To(core::Dtype::Float32),
+            extrinsic.Copy(host).To(core::Dtype::Float32), depth_scale);
+    return dst;
+}
+
+std::pair<Image, Image> Image::FilterSobel(int kernel_size) const {
+    AssertProcessingDtype(GetDtype());
+    std::vector<float> derivative, smooth;
+    if (kernel_size == 3) {
+        derivative = {-1, 0, 1};
+        smooth = {1, 2, 1};
+    } else if (kernel_size == 5) {
+        derivative = {-1, -2, 0, 2, 1};
+        smooth = {1, 4, 6, 4, 1};
+    } else {
+        utility::LogError("Kernel size must be 3 or 5, but got {}.",
+                          kernel_size);
+    }
+    core::Tensor derivative_kernel(derivative, {kernel_size},
+                                   core::Dtype::Float32, GetDevice());
+    core::Tensor smooth_kernel(smooth, {kernel_size}, core::Dtype::Float32,
+                               GetDevice());
+
+    Image dx(GetRows(), GetCols(), GetChannels(), core::Dtype::Float32,
+             GetDevice());
+    Image dy(GetRows(), GetCols(), GetChannels(), core::Dtype::Float32,
+             GetDevice());
+    kernel::image::FilterSeparable(data_, dx.data_, derivative_kernel,
+                                   smooth_kernel);
+    kernel::image::FilterSeparable(data_, dy.data_, smooth_kernel,
+                                   derivative_kernel);
+    return std::make_pair(dx, dy);
+}
+
+Image Image::PyrDown() const {
+    AssertProcessingDtype(GetDtype());
+    Image dst((GetRows() + 1) / 2, (GetCols() + 1) / 2, GetChannels(),
+              GetDtype(), GetDevice());
+    kernel::image::PyrDown(data_, dst.data_);
+    return dst;
+}
+
+Image Image::PyrDownDepth(float diff_threshold, float invalid_fill) const {
+    if (GetChannels() != 1 || GetDtype() != core::Dtype::Float32) {
+        utility::LogError(
+                "Only Float32 single-channel images are supported, but got {} "
+                "with {} channels.",
+                GetDtype().ToString(), GetChannels());
+    }
+    Image dst((GetRows() + 1) / 2, (GetCols() + 1) / 2, 1,
+              core::Dtype::Float32, GetDevice());
+    kernel::image::PyrDownDepth(data_, dst.data_, diff_threshold,
+                                invalid_fill);
+    return dst;
+}
+
+Image Image::Resize(float sampling_rate, InterpType interp_type) const {
+    AssertProcessingDtype(GetDtype());
+    if (sampling_rate <= 0) {
+        utility::LogError("Sampling rate must be positive, but got {}.",
+                          sampling_rate);
+    }
+    int64_t rows = static_cast<int64_t>(GetRows() * sampling_rate);
+    int64_t cols = static_cast<int64_t>(GetCols() * sampling_rate);
+    if (rows == 0 || cols == 0) {
+        utility::LogError("Image of size {}x{} is empty after resizing by {}.",
+                          GetRows(), GetCols(), sampling_rate);
+    }
+    Image dst(rows, cols, GetChannels(), GetDtype(), GetDevice());
+    kernel::image::Resize(data_, dst.data_, interp_type);
+    return dst;
+}
+
 Image Image::FromLegacyImage(const open3d::geometry::Image &image_legacy,
                              const core::Device &device) {
     static const std::unordered_map<int, core::Dtype> kBytesToDtypeMap = {
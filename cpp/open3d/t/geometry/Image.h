@@ -28,11 +28,14 @@
 
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "open3d/core/Tensor.h"
 #include "open3d/geometry/Image.h"
 #include "open3d/t/geometry/Geometry.h"
+#include "open3d/t/geometry/kernel/Image.h"
+#include "open3d/utility/Optional.h"
 
 namespace open3d {
 namespace t {
@@ -141,6 +144,116 @@ public:
                             core::Dtype::Int64);
     };
 
+    /// Interpolation used by Resize().
+    using InterpType = kernel::image::InterpType;
+
+    /// \brief Returns an image of the given dtype, with the values transformed
+    /// as value * scale + offset.
+    ///
+    /// Integer results are rounded and saturated to the range of \p dtype.
+    /// UInt8, UInt16 and Float32 images are supported.
+    ///
+    /// \param dtype The dtype of the returned image.
+    /// \param copy If false and the conversion is the identity, the returned
+    /// image shares the memory of this image.
+    /// \param scale Defaults to 1 / 255 from UInt8 to Float32, 1 / 65535 from
+    /// UInt16 to Float32, the inverse the other way around, and 1 otherwise.
+    /// \param offset Added to the scaled values.
+    Image To(core::Dtype dtype,
+             bool copy = false,
+             utility::optional<double> scale = utility::nullopt,
+             double offset = 0.0) const;
+
+    /// \brief Returns a Float32 image of the values divided by \p scale, where
+    /// the values that are not in (\p min_value, \p max_value) are set to
+    /// \p clip_fill.
+    ///
+    /// Converts a UInt16 or Float32 depth image to meters, and clips the
+    /// invalid and far depths as the legacy ConvertDepthToFloatImage.
+    Image ClipTransform(float scale,
+                        float min_value,
+                        float max_value,
+                        float clip_fill = 0.0f) const;
+
+    /// \brief Convolves each channel with a Float32 2D kernel of odd sizes.
+    ///
+    /// The border pixels are replicated, and the returned image has the dtype
+    /// of this image.
+    Image Filter(const core::Tensor &kernel) const;
+
+    /// \brief Gaussian filter with an odd \p kernel_size and standard
+    /// deviation \p sigma in pixels, computed in two separable passes.
+    Image FilterGaussian(int kernel_size = 3, float sigma = 1.0f) const;
+
+    /// \brief Bilateral filter over a \p kernel_size neighborhood.
+    ///
+    /// \param kernel_size Odd size of the neighborhood.
+    /// \param value_sigma Standard deviation of the difference of the values,
+    /// in the units of this image.
+    /// \param distance_sigma Standard deviation of the distance, in pixels.
+    Image FilterBilateral(int kernel_size = 3,
+                          float value_sigma = 20.0f,
+                          float distance_sigma = 10.0f) const;
+
+    /// \brief Bilateral filter of a depth image, which averages only the
+    /// valid depths, greater than 0, and keeps the invalid depths at 0.
+    ///
+    /// Only UInt16 and Float32 single-channel images are supported.
+    ///
+    /// \param kernel_size Odd size of the neighborhood.
+    /// \param depth_sigma Standard deviation of the difference of the depths,
+    /// in the units of this image.
+    /// \param distance_sigma Standard deviation of the distance, in pixels.
+    Image FilterBilateralDepth(int kernel_size = 5,
+                               float depth_sigma = 20.0f,
+                               float distance_sigma = 3.0f) const;
+
+    /// \brief Reprojects this depth image to another camera, such as the color
+    /// camera of an RGBD sensor.
+    ///
+    /// Each depth pixel covers its footprint in the target image, which keeps
+    /// the nearest depth. The target pixels without depth are 0. Lens
+    /// distortion is ignored. Only UInt16 and Float32 single-channel images are
+    /// supported, and the returned image has the dtype of this image.
+    ///
+    /// \param depth_intrinsic 3x3 intrinsic matrix of this image.
+    /// \param target_intrinsic 3x3 intrinsic matrix of the target camera.
+    /// \param extrinsic 4x4 transformation from this camera to the target
+    /// camera, with the translation in meters.
+    /// \param rows Number of rows of the target image.
+    /// \param cols Number of columns of the target image.
+    /// \param depth_scale Depth values per meter.
+    Image RegisterDepth(const core::Tensor &depth_intrinsic,
+                        const core::Tensor &target_intrinsic,
+                        const core::Tensor &extrinsic,
+                        int64_t rows,
+                        int64_t cols,
+                        float depth_scale = 1000.0f) const;
+
+    /// \brief Returns the Float32 gradients along the columns and the rows
+    /// of this image, computed by the 3x3 or 5x5 Sobel operator.
+    std::pair<Image, Image> FilterSobel(int kernel_size = 3) const;
+
+    /// \brief Returns the half resolution image of the next pyramid level.
+    ///
+    /// The image is smoothed by a 5x5 Gaussian kernel before keeping the pixels
+    /// with even coordinates, as OpenCV's pyrDown.
+    Image PyrDown() const;
+
+    /// \brief Returns the half resolution depth image of the next pyramid
+    /// level.
+    ///
+    /// Only the valid depths within \p diff_threshold of the center pixel are
+    /// averaged, so that the depth discontinuities are not blurred. The pixels
+    /// with an invalid depth are set to \p invalid_fill. Only Float32
+    /// single-channel images are supported, see ClipTransform.
+    Image PyrDownDepth(float diff_threshold, float invalid_fill = 0.0f) const;
+
+    /// \brief Returns the image resized by \p sampling_rate in both
+    /// directions.
+    Image Resize(float sampling_rate = 0.5f,
+                 InterpType interp_type = InterpType::Nearest) const;
+
     /// Create from a legacy Open3D Image.
     static Image FromLegacyImage(
             const open3d::geometry::Image &image_legacy,
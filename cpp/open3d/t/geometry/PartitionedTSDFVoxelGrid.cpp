@@ -0,0 +1,343 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/PartitionedTSDFVoxelGrid.h"
+
+#include <Eigen/Core>
+#include <future>
+#include <unordered_set>
+
+#include "open3d/core/hashmap/Hashmap.h"
+#include "open3d/t/geometry/kernel/TSDFVoxelGrid.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/Helper.h"
+#include "open3d/utility/Trace.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+namespace {
+Image CopyToDevice(const Image &image, const core::Device &device) {
+    if (image.IsEmpty() || image.GetDevice() == device) {
+        return image;
+    }
+    return Image(image.AsTensor().Copy(device));
+}
+
+// Blocks of another partition that border the blocks of a partition.
+struct HaloBlocks {
+    core::Tensor keys;
+    core::Tensor values;
+};
+}  // namespace
+
+PartitionedTSDFVoxelGrid::PartitionedTSDFVoxelGrid(
+        const std::vector<core::Device> &devices,
+        std::unordered_map<std::string, core::Dtype> attr_dtype_map,
+        float voxel_size,
+        float sdf_trunc,
+        int64_t block_resolution,
+        int64_t block_count,
+        int64_t partition_tile_size)
+    : partition_tile_size_(partition_tile_size) {
+    if (devices.empty()) {
+        utility::LogError("[PartitionedTSDFVoxelGrid] no device is given.");
+    }
+    if (partition_tile_size <= 0) {
+        utility::LogError(
+                "[PartitionedTSDFVoxelGrid] expected a positive tile size, "
+                "but got {}.",
+                partition_tile_size);
+    }
+
+    int64_t num_partitions = static_cast<int64_t>(devices.size());
+    for (int64_t i = 0; i < num_partitions; ++i) {
+        partitions_.emplace_back(attr_dtype_map, voxel_size, sdf_trunc,
+                                 block_resolution, block_count, devices[i]);
+        partitions_.back().partition_tile_size_ = partition_tile_size;
+        partitions_.back().num_partitions_ = num_partitions;
+        partitions_.back().partition_index_ = i;
+    }
+}
+
+void PartitionedTSDFVoxelGrid::Integrate(const Image &depth,
+                                         const core::Tensor &intrinsics,
+                                         const core::Tensor &extrinsics,
+                                         float depth_scale,
+                                         float depth_max) {
+    Image empty_color;
+    Integrate(depth, empty_color, intrinsics, extrinsics, depth_scale,
+              depth_max);
+}
+
+void PartitionedTSDFVoxelGrid::Integrate(const Image &depth,
+                                         const Image &color,
+                                         const core::Tensor &intrinsics,
+                                         const core::Tensor &extrinsics,
+                                         float depth_scale,
+                                         float depth_max) {
+    OPEN3D_TRACE_SCOPE("t::PartitionedTSDF::Integrate");
+    // Each partition touches the blocks of the frame, and returns early if
+    // none of them is in its tiles.
+    ForEachPartition([&](int64_t i) {
+        TSDFVoxelGrid &grid = partitions_[i];
+        core::Device device = grid.GetDevice();
+        grid.Integrate(CopyToDevice(depth, device),
+                       CopyToDevice(color, device), intrinsics,
+                       extrinsics.Copy(device), depth_scale, depth_max);
+    });
+}
+
+TriangleMesh PartitionedTSDFVoxelGrid::ExtractSurfaceMesh() {
+    OPEN3D_TRACE_SCOPE("t::PartitionedTSDF::ExtractSurfaceMesh");
+    int64_t num_partitions = GetPartitionCount();
+
+    std::vector<int> offsets;
+    for (int dz = -1; dz <= 1; ++dz) {
+        for (int dy = -1; dy <= 1; ++dy) {
+            for (int dx = -1; dx <= 1; ++dx) {
+                if (dx != 0 || dy != 0 || dz != 0) {
+                    offsets.insert(offsets.end(), {dx, dy, dz});
+                }
+            }
+        }
+    }
+
+    // Marching Cubes and normals read the voxels of the 26 neighbor blocks.
+    // Collect the neighbors owned by the other partitions first, as the
+    // hashmaps are only read at this point.
+    std::vector<core::Tensor> mesh_addrs(num_partitions);
+    std::vector<std::vector<HaloBlocks>> halos(num_partitions);
+    for (int64_t s = 0; s < num_partitions; ++s) {
+        TSDFVoxelGrid &grid = partitions_[s];
+        core::Device device = grid.GetDevice();
+        core::Tensor active_addrs;
+        grid.block_hashmap_->GetActiveIndices(active_addrs);
+        mesh_addrs[s] = active_addrs.To(core::Dtype::Int64);
+        int64_t n = mesh_addrs[s].GetLength();
+        if (n == 0 || num_partitions == 1) {
+            continue;
+        }
+
+        core::Tensor keys =
+                grid.block_hashmap_->GetKeyTensor().IndexGet({mesh_addrs[s]});
+        core::Tensor nb_keys =
+                (keys.Reshape({n, 1, 3}) +
+                 core::Tensor(offsets, {1, 26, 3}, core::Dtype::Int32, device))
+                        .Reshape({n * 26, 3});
+
+        // Remove the duplicates shared by adjacent blocks.
+        core::Hashmap unique_keys(n * 26, core::Dtype::Int32,
+                                  core::Dtype::Int32, core::SizeVector{3},
+                                  core::SizeVector{1}, device);
+        core::Tensor addrs, masks;
+        unique_keys.Activate(nb_keys, addrs, masks);
+        nb_keys = nb_keys.IndexGet({masks});
+
+        core::Tensor nb_partitions;
+        kernel::tsdf::PartitionBlocks(nb_keys, nb_partitions,
+                                      partition_tile_size_, num_partitions);
+        for (int64_t t = 0; t < num_partitions; ++t) {
+            if (t == s) {
+                continue;
+            }
+            TSDFVoxelGrid &other = partitions_[t];
+            core::Tensor other_keys = nb_keys.IndexGet({nb_partitions.Eq(t)})
+                                              .Copy(other.GetDevice());
+            if (other_keys.GetLength() == 0) {
+                continue;
+            }
+            other.block_hashmap_->Find(other_keys, addrs, masks);
+            HaloBlocks halo;
+            halo.keys = other_keys.IndexGet({masks}).Copy(device);
+            halo.values = other.block_hashmap_->GetValueTensor()
+                                  .IndexGet({addrs.To(core::Dtype::Int64)
+                                                     .IndexGet({masks})})
+                                  .Copy(device);
+            if (halo.keys.GetLength() > 0) {
+                halos[s].push_back(halo);
+            }
+        }
+    }
+
+    // Mesh the blocks of each partition with its neighbors inserted
+    // temporarily. Each block owns a copy of the vertices on its faces.
+    std::vector<TriangleMesh> fragments(num_partitions);
+    ForEachPartition([&](int64_t s) {
+        if (mesh_addrs[s].GetLength() == 0) {
+            return;
+        }
+        TSDFVoxelGrid &grid = partitions_[s];
+        core::Hashmap &hashmap = *grid.block_hashmap_;
+        std::vector<core::Tensor> inserted_keys;
+        for (const HaloBlocks &halo : halos[s]) {
+            core::Tensor addrs, masks;
+            try {
+                hashmap.Insert(halo.keys, halo.values, addrs, masks);
+            } catch (const std::runtime_error &) {
+                utility::LogError(
+                        "[PartitionedTSDFVoxelGrid] Unable to insert {} "
+                        "neighbor blocks into partition {} with {} blocks.",
+                        halo.keys.GetLength(), s, hashmap.Size());
+            }
+            inserted_keys.push_back(halo.keys.IndexGet({masks}));
+        }
+
+        core::Tensor active_addrs;
+        hashmap.GetActiveIndices(active_addrs);
+        core::Tensor vertices, triangles, vertex_normals, vertex_colors;
+        core::Tensor vertex_blocks, triangle_blocks;
+        kernel::tsdf::ExtractSurfaceMeshBlocks(
+                mesh_addrs[s], active_addrs.To(core::Dtype::Int64),
+                hashmap.GetKeyTensor(), hashmap.GetValueTensor(), vertices,
+                triangles, vertex_normals, vertex_colors, vertex_blocks,
+                triangle_blocks, grid.block_resolution_, grid.voxel_size_);
+
+        for (const core::Tensor &keys : inserted_keys) {
+            core::Tensor masks;
+            hashmap.Erase(keys, masks);
+        }
+        if (!inserted_keys.empty()) {
+            // Buffer indices of the erased blocks may be reused by new blocks.
+            grid.incremental_mesh_valid_ = false;
+        }
+
+        core::Device host("CPU:0");
+        TriangleMesh fragment(vertices.Copy(host), triangles.Copy(host));
+        fragment.SetVertexNormals(vertex_normals.Copy(host));
+        if (vertex_colors.NumElements() != 0) {
+            fragment.SetVertexColors(vertex_colors.Copy(host));
+        }
+        fragments[s] = fragment;
+    });
+
+    // Stitch the fragments, merging the copies of the vertices. The copies of
+    // a vertex are computed from the same voxels, so they are bitwise equal.
+    std::unordered_map<Eigen::Vector3f, int64_t,
+                       utility::hash_eigen<Eigen::Vector3f>>
+            vertex_indices;
+    std::vector<float> vertices, normals, colors;
+    std::vector<int64_t> triangles;
+    bool has_colors = partitions_[0].attr_dtype_map_.count("color") != 0;
+    for (const TriangleMesh &fragment : fragments) {
+        if (!fragment.HasVertices()) {
+            continue;
+        }
+        int64_t n = fragment.GetVertices().GetLength();
+        const float *vertex_ptr = static_cast<const float *>(
+                fragment.GetVertices().GetDataPtr());
+        const float *normal_ptr = static_cast<const float *>(
+                fragment.GetVertexNormals().GetDataPtr());
+        const float *color_ptr =
+                has_colors ? static_cast<const float *>(
+                                     fragment.GetVertexColors().GetDataPtr())
+                           : nullptr;
+
+        std::vector<int64_t> index_map(n);
+        for (int64_t i = 0; i < n; ++i) {
+            Eigen::Vector3f vertex(vertex_ptr[3 * i], vertex_ptr[3 * i + 1],
+                                   vertex_ptr[3 * i + 2]);
+            auto it = vertex_indices.emplace(
+                    vertex, static_cast<int64_t>(vertices.size() / 3));
+            index_map[i] = it.first->second;
+            if (it.second) {
+                vertices.insert(vertices.end(), vertex_ptr + 3 * i,
+                                vertex_ptr + 3 * i + 3);
+                normals.insert(normals.end(), normal_ptr + 3 * i,
+                               normal_ptr + 3 * i + 3);
+                if (has_colors) {
+                    colors.insert(colors.end(), color_ptr + 3 * i,
+                                  color_ptr + 3 * i + 3);
+                }
+            }
+        }
+
+        int64_t m = fragment.GetTriangles().GetLength();
+        const int64_t *triangle_ptr = static_cast<const int64_t *>(
+                fragment.GetTriangles().GetDataPtr());
+        for (int64_t i = 0; i < 3 * m; ++i) {
+            triangles.push_back(index_map[triangle_ptr[i]]);
+        }
+    }
+
+    int64_t num_vertices = static_cast<int64_t>(vertices.size() / 3);
+    int64_t num_triangles = static_cast<int64_t>(triangles.size() / 3);
+    utility::LogDebug(
+            "[PartitionedTSDFVoxelGrid] stitched {} vertices and {} triangles "
+            "from {} partitions.",
+            num_vertices, num_triangles, num_partitions);
+    TriangleMesh mesh(
+            core::Tensor(vertices, {num_vertices, 3}, core::Dtype::Float32),
+            core::Tensor(triangles, {num_triangles, 3}, core::Dtype::Int64));
+    mesh.SetVertexNormals(
+            core::Tensor(normals, {num_vertices, 3}, core::Dtype::Float32));
+    if (has_colors && num_vertices > 0) {
+        mesh.SetVertexColors(
+                core::Tensor(colors, {num_vertices, 3}, core::Dtype::Float32));
+    }
+    return mesh;
+}
+
+int64_t PartitionedTSDFVoxelGrid::GetActiveBlockCount() const {
+    int64_t count = 0;
+    for (const TSDFVoxelGrid &grid : partitions_) {
+        count += grid.GetActiveBlockCount();
+    }
+    return count;
+}
+
+void PartitionedTSDFVoxelGrid::ForEachPartition(
+        const std::function<void(int64_t)> &f) {
+    int64_t num_partitions = GetPartitionCount();
+    bool concurrent = num_partitions > 1;
+    std::unordered_set<std::string> devices;
+    for (TSDFVoxelGrid &grid : partitions_) {
+        core::Device device = grid.GetDevice();
+        concurrent = concurrent &&
+                     device.GetType() == core::Device::DeviceType::CUDA &&
+                     devices.insert(device.ToString()).second;
+    }
+
+    if (!concurrent) {
+        for (int64_t i = 0; i < num_partitions; ++i) {
+            f(i);
+        }
+        return;
+    }
+
+    std::vector<std::future<void>> futures;
+    for (int64_t i = 0; i < num_partitions; ++i) {
+        futures.push_back(std::async(std::launch::async, f, i));
+    }
+    for (std::future<void> &future : futures) {
+        future.get();
+    }
+}
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
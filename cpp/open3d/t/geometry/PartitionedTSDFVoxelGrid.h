@@ -0,0 +1,118 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "open3d/core/Device.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/Image.h"
+#include "open3d/t/geometry/TSDFVoxelGrid.h"
+#include "open3d/t/geometry/TriangleMesh.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+/// TSDF voxel grid sharded across several devices, for scenes that exceed the
+/// memory of one device.
+/// The space is divided into tiles of partition_tile_size^3 blocks, and each
+/// tile is assigned to a partition by hashing its coordinates. Each partition
+/// is a TSDFVoxelGrid on its own device that only allocates the blocks of its
+/// tiles. A frame is integrated by every partition it touches, concurrently
+/// on CUDA devices. Surface extraction runs per partition, after copying the
+/// blocks bordering its tiles from the other partitions, and the fragments are
+/// stitched on the host.
+class PartitionedTSDFVoxelGrid {
+public:
+    /// \param devices One partition is created on each device. A device may
+    /// appear several times.
+    /// \param block_count Initial number of blocks of each partition.
+    /// \param partition_tile_size Edge length of the tiles in blocks. Larger
+    /// tiles have fewer blocks on the partition boundaries, smaller tiles
+    /// balance the load better.
+    PartitionedTSDFVoxelGrid(
+            const std::vector<core::Device> &devices,
+            std::unordered_map<std::string, core::Dtype> attr_dtype_map =
+                    {{"tsdf", core::Dtype::Float32},
+                     {"weight", core::Dtype::UInt16},
+                     {"color", core::Dtype::UInt16}},
+            float voxel_size = 3.0 / 512.0, /* in meter */
+            float sdf_trunc = 0.04,         /*  in meter  */
+            int64_t block_resolution = 16,  /*  block Tensor resolution  */
+            int64_t block_count = 1000,
+            int64_t partition_tile_size = 8);
+
+    /// Depth-only integration.
+    void Integrate(const Image &depth,
+                   const core::Tensor &intrinsics,
+                   const core::Tensor &extrinsics,
+                   float depth_scale = 1000.0f,
+                   float depth_max = 3.0f);
+
+    /// RGB-D integration. The images may be on any device, and are copied to
+    /// the devices of the partitions.
+    void Integrate(const Image &depth,
+                   const Image &color,
+                   const core::Tensor &intrinsics,
+                   const core::Tensor &extrinsics,
+                   float depth_scale = 1000.0f,
+                   float depth_max = 3.0f);
+
+    /// Extract mesh near iso-surfaces with Marching Cubes. The vertices at the
+    /// same position are merged, including the copies in the fragments of
+    /// different blocks and partitions, so the triangles match the ones of a
+    /// single TSDFVoxelGrid. Returns a mesh on CPU.
+    TriangleMesh ExtractSurfaceMesh();
+
+    /// Number of partitions, i.e. devices.
+    int64_t GetPartitionCount() const {
+        return static_cast<int64_t>(partitions_.size());
+    }
+
+    /// The voxel grid of the partition \p index.
+    TSDFVoxelGrid &GetPartition(int64_t index) { return partitions_.at(index); }
+
+    /// Number of allocated voxel blocks over all the partitions.
+    int64_t GetActiveBlockCount() const;
+
+protected:
+    std::vector<TSDFVoxelGrid> partitions_;
+    int64_t partition_tile_size_;
+
+private:
+    /// Run \p f(index) for each partition, concurrently if the partitions are
+    /// on distinct CUDA devices.
+    void ForEachPartition(const std::function<void(int64_t)> &f);
+};
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -27,16 +27,31 @@
 #include "open3d/t/geometry/PointCloud.h"
 
 #include <Eigen/Core>
+#include <Eigen/Eigenvalues>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <random>
 #include <string>
+#include <tuple>
 #include <unordered_map>
+#include <vector>
 
+#include "open3d/core/Dispatch.h"
 #include "open3d/core/EigenConverter.h"
+#include "open3d/core/SegmentedReduce.h"
 #include "open3d/core/ShapeUtil.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/core/hashmap/Hashmap.h"
 #include "open3d/core/linalg/Matmul.h"
+#include "open3d/core/nns/NearestNeighborSearch.h"
+#include "open3d/geometry/BoundingVolume.h"
+#include "open3d/geometry/Qhull.h"
 #include "open3d/t/geometry/TensorMap.h"
 #include "open3d/t/geometry/kernel/PointCloud.h"
+#include "open3d/t/geometry/kernel/Transform.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace t {
@@ -71,6 +86,10 @@ core::Tensor PointCloud::GetMinBound() const { return GetPoints().Min({0}); }
 
 core::Tensor PointCloud::GetMaxBound() const { return GetPoints().Max({0}); }
 
+std::tuple<core::Tensor, core::Tensor> PointCloud::GetMinMaxBound() const {
+    return GetPoints().MinMax({0});
+}
+
 core::Tensor PointCloud::GetCenter() const { return GetPoints().Mean({0}); }
 
 PointCloud PointCloud::Copy(const core::Device device) const {
@@ -83,26 +102,54 @@ PointCloud PointCloud::Copy(const core::Device device) const {
 
 PointCloud PointCloud::Copy() const { return Copy(GetDevice()); }
 
+PointCloud &PointCloud::Append(const PointCloud &other) {
+    if (other.GetDevice() != device_) {
+        utility::LogError(
+                "Cannot append a PointCloud on {} to a PointCloud on {}.",
+                other.GetDevice().ToString(), device_.ToString());
+    }
+    point_attr_.Append(other.point_attr_);
+    return *this;
+}
+
+namespace {
+
+// Makes the points and the normals of pcd contiguous and appends them to
+// points and normals, with an empty tensor if pcd has no normals.
+void AppendPointsAndNormals(PointCloud &pcd,
+                            std::vector<core::Tensor> &points,
+                            std::vector<core::Tensor> &normals) {
+    pcd.SetPoints(pcd.GetPoints().Contiguous());
+    points.push_back(pcd.GetPoints());
+    if (pcd.HasPointNormals()) {
+        pcd.SetPointNormals(pcd.GetPointNormals().Contiguous());
+        normals.push_back(pcd.GetPointNormals());
+    } else {
+        normals.push_back(core::Tensor());
+    }
+}
+
+}  // namespace
+
 PointCloud &PointCloud::Transform(const core::Tensor &transformation) {
     transformation.AssertShape({4, 4});
     transformation.AssertDevice(device_);
+    std::vector<core::Tensor> points, normals;
+    AppendPointsAndNormals(*this, points, normals);
+    kernel::transform::TransformPointsAndNormals(
+            transformation.Reshape({1, 4, 4}), points, normals);
+    return *this;
+}
 
-    core::Tensor R = transformation.Slice(0, 0, 3).Slice(1, 0, 3);
-    core::Tensor t = transformation.Slice(0, 0, 3).Slice(1, 3, 4);
-    // TODO: Make it more generalised [4x4][4xN] transformation.
-
-    // TODO: Consider adding a new op extending MatMul to support `AB + C`
-    // GEMM operation. Also, a parallel joint optimimsed kernel for
-    // independent MatMul operation with common matrix like AB and AC
-    // with fusion based cache optimisation.
-    core::Tensor &points = GetPoints();
-    points = (R.Matmul(points.T())).Add_(t).T();
-
-    if (HasPointNormals()) {
-        core::Tensor &normals = GetPointNormals();
-        normals = (R.Matmul(normals.T())).T();
+void PointCloud::BatchTransform(std::vector<PointCloud> &pointclouds,
+                                const core::Tensor &transformations) {
+    transformations.AssertShape({int64_t(pointclouds.size()), 4, 4});
+    std::vector<core::Tensor> points, normals;
+    for (PointCloud &pcd : pointclouds) {
+        AppendPointsAndNormals(pcd, points, normals);
     }
-    return *this;
+    kernel::transform::TransformPointsAndNormals(transformations, points,
+                                                 normals);
 }
 
 PointCloud &PointCloud::Translate(const core::Tensor &translation,
@@ -134,17 +181,806 @@ PointCloud &PointCloud::Rotate(const core::Tensor &R,
     center.AssertShape({3});
     center.AssertDevice(device_);
 
-    core::Tensor Rot = R;
+    // Multiply by R^T from the right so that the {N, 3} attributes stay
+    // contiguous, instead of rotating a transposed copy.
+    core::Tensor R_T = R.T();
     core::Tensor &points = GetPoints();
-    points = ((Rot.Matmul((points.Sub_(center)).T())).T()).Add_(center);
+    points = points.Sub_(center).Matmul(R_T).Add_(center);
 
     if (HasPointNormals()) {
         core::Tensor &normals = GetPointNormals();
-        normals = (Rot.Matmul(normals.T())).T();
+        normals = normals.Matmul(R_T);
     }
     return *this;
 }
 
+PointCloud PointCloud::VoxelDownSample(double voxel_size) const {
+    if (voxel_size <= 0) {
+        utility::LogError(
+                "[VoxelDownSample] voxel_size must be positive, but got {}.",
+                voxel_size);
+    }
+    const core::Tensor &points = GetPoints();
+    int64_t n = points.GetLength();
+    if (n == 0) {
+        return Copy();
+    }
+
+    // Points in the same voxel share the hashmap entry of its coordinates.
+    core::Tensor voxel_coords =
+            points.Div(voxel_size).Floor().To(core::Dtype::Int32);
+    core::Hashmap voxel_map(n, core::Dtype::Int32, core::Dtype::Int32, {3},
+                            {1}, device_);
+    core::Tensor addrs, masks;
+    voxel_map.InsertOrFind(voxel_coords, addrs, masks);
+
+    // Map the buffer address of each voxel to a compact segment id.
+    core::Tensor active_addrs;
+    voxel_map.GetActiveIndices(active_addrs);
+    int64_t num_voxels = active_addrs.GetLength();
+    core::Tensor segment_of_addr = core::Tensor::Empty(
+            {voxel_map.GetCapacity()}, core::Dtype::Int64, device_);
+    segment_of_addr.IndexSet({active_addrs.To(core::Dtype::Int64)},
+                             core::Tensor::Arange(0, num_voxels, 1,
+                                                  core::Dtype::Int64, device_));
+    core::Tensor segment_ids =
+            segment_of_addr.IndexGet({addrs.To(core::Dtype::Int64)});
+
+    core::Tensor offsets, order;
+    kernel::pointcloud::SortBySegment(segment_ids, num_voxels, offsets, order);
+
+    PointCloud pcd(device_);
+    for (auto &kv : point_attr_) {
+        if (!HasPointAttr(kv.first)) {
+            continue;
+        }
+        core::Tensor mean;
+        kernel::pointcloud::SegmentMean(kv.second.Contiguous(), offsets, order,
+                                        mean);
+        pcd.SetPointAttr(kv.first, mean);
+    }
+    return pcd;
+}
+
+namespace {
+
+// Marks the points inside the box of the points p with min_bound <=
+// axes * (p - center) <= max_bound.
+core::Tensor ComputeBoxMask(const core::Tensor &points,
+                            const Eigen::Vector3d &center,
+                            const Eigen::Matrix3d &axes,
+                            const Eigen::Vector3d &min_bound,
+                            const Eigen::Vector3d &max_bound) {
+    const core::Device &device = points.GetDevice();
+    auto ToTensor = [&](const Eigen::Vector3d &v) {
+        return core::Tensor(std::vector<double>{v(0), v(1), v(2)}, {3},
+                            core::Dtype::Float64, device);
+    };
+    core::Tensor mask;
+    kernel::pointcloud::ComputeBoxMask(
+            points.Contiguous(), ToTensor(center),
+            core::eigen_converter::EigenMatrixToTensor(axes).Copy(device),
+            ToTensor(min_bound), ToTensor(max_bound), mask);
+    return mask;
+}
+
+}  // namespace
+
+PointCloud PointCloud::SelectByMask(const core::Tensor &mask,
+                                    bool invert) const {
+    int64_t num_points = HasPoints() ? GetPoints().GetLength() : 0;
+    mask.AssertShape({num_points});
+    mask.AssertDtype(core::Dtype::Bool);
+    mask.AssertDevice(device_);
+    core::Tensor indices = (invert ? mask.LogicalNot() : mask).NonZero()[0];
+
+    TensorMap attrs(point_attr_.GetPrimaryKey());
+    for (auto &kv : point_attr_) {
+        if (HasPointAttr(kv.first)) {
+            attrs[kv.first] = kv.second;
+        }
+    }
+    PointCloud selected(device_);
+    for (auto &kv : attrs.IndexGet(indices)) {
+        selected.SetPointAttr(kv.first, kv.second);
+    }
+    return selected;
+}
+
+PointCloud PointCloud::SelectByIndex(const core::Tensor &indices,
+                                     bool invert) const {
+    indices.AssertDtype(core::Dtype::Int64);
+    indices.AssertDevice(device_);
+    int64_t num_points = HasPoints() ? GetPoints().GetLength() : 0;
+    core::Tensor flat_indices = indices.Reshape({-1});
+    int64_t num_indices = flat_indices.GetLength();
+    if (num_indices > 0 &&
+        (flat_indices.Min({0}).Item<int64_t>() < 0 ||
+         flat_indices.Max({0}).Item<int64_t>() >= num_points)) {
+        utility::LogError(
+                "[SelectByIndex] indices must be in [0, {}).", num_points);
+    }
+    core::Tensor mask =
+            core::Tensor::Zeros({num_points}, core::Dtype::Bool, device_);
+    mask.IndexSet({flat_indices}, core::Tensor::Ones({num_indices},
+                                                     core::Dtype::Bool,
+                                                     device_));
+    return SelectByMask(mask, invert);
+}
+
+PointCloud PointCloud::Crop(
+        const open3d::geometry::AxisAlignedBoundingBox &bbox) const {
+    if (bbox.IsEmpty()) {
+        utility::LogError(
+                "[CropPointCloud] AxisAlignedBoundingBox either has zeros "
+                "size, or has wrong bounds.");
+    }
+    return SelectByMask(ComputeBoxMask(GetPoints(), Eigen::Vector3d::Zero(),
+                                       Eigen::Matrix3d::Identity(),
+                                       bbox.min_bound_, bbox.max_bound_));
+}
+
+PointCloud PointCloud::Crop(
+        const open3d::geometry::OrientedBoundingBox &bbox) const {
+    if (bbox.IsEmpty()) {
+        utility::LogError(
+                "[CropPointCloud] OrientedBoundingBox either has zeros size, "
+                "or has wrong bounds.");
+    }
+    Eigen::Vector3d half_extent = bbox.extent_ / 2;
+    return SelectByMask(ComputeBoxMask(GetPoints(), bbox.center_,
+                                       bbox.R_.transpose(), -half_extent,
+                                       half_extent));
+}
+
+std::tuple<PointCloud, core::Tensor> PointCloud::RemoveRadiusOutliers(
+        size_t nb_points, double search_radius) const {
+    if (nb_points < 1 || search_radius <= 0) {
+        utility::LogError(
+                "[RemoveRadiusOutliers] Illegal input parameters, number of "
+                "points and radius must be positive.");
+    }
+    core::Tensor points = GetPoints().Contiguous();
+    if (points.GetLength() == 0) {
+        return std::make_tuple(
+                Copy(), core::Tensor::Empty({0}, core::Dtype::Bool, device_));
+    }
+    core::nns::NearestNeighborSearch nns(points);
+    nns.FixedRadiusIndex(search_radius);
+    core::Tensor num_neighbors;
+    std::tie(std::ignore, std::ignore, num_neighbors) =
+            nns.FixedRadiusSearch(points, search_radius);
+    // The neighbors include the point itself.
+    core::Tensor mask = num_neighbors.Gt(int64_t(nb_points));
+    return std::make_tuple(SelectByMask(mask), mask);
+}
+
+std::tuple<PointCloud, core::Tensor> PointCloud::RemoveStatisticalOutliers(
+        size_t nb_neighbors, double std_ratio) const {
+    if (nb_neighbors < 1 || std_ratio <= 0) {
+        utility::LogError(
+                "[RemoveStatisticalOutliers] Illegal input parameters, number "
+                "of neighbors and standard deviation ratio must be positive.");
+    }
+    core::Tensor points = GetPoints().Contiguous();
+    int64_t n = points.GetLength();
+    if (n == 0) {
+        return std::make_tuple(
+                Copy(), core::Tensor::Empty({0}, core::Dtype::Bool, device_));
+    }
+    core::nns::NearestNeighborSearch nns(points);
+    nns.KnnIndex();
+    core::Tensor distances;
+    std::tie(std::ignore, distances) = nns.KnnSearch(
+            points, int(std::min(int64_t(nb_neighbors), n)));
+    core::Tensor avg_distances =
+            distances.To(core::Dtype::Float64).Sqrt().Mean({1});
+
+    double cloud_mean = avg_distances.Mean({0}).Item<double>();
+    core::Tensor deviations = avg_distances.Sub(cloud_mean);
+    // Bessel's correction
+    double sq_sum = deviations.Mul(deviations).Sum({0}).Item<double>();
+    double std_dev = n > 1 ? std::sqrt(sq_sum / double(n - 1)) : 0.0;
+    double distance_threshold = cloud_mean + std_ratio * std_dev;
+    // As in the legacy PointCloud, points whose neighbors all coincide with
+    // them are removed too.
+    core::Tensor mask = avg_distances.Gt(0.0).LogicalAnd(
+            avg_distances.Lt(distance_threshold));
+    return std::make_tuple(SelectByMask(mask), mask);
+}
+
+std::tuple<PointCloud, core::Tensor> PointCloud::ComputeISSKeypoints(
+        double salient_radius,
+        double non_max_radius,
+        double gamma_21,
+        double gamma_32,
+        int min_neighbors) const {
+    core::Tensor points = GetPoints().Contiguous();
+    int64_t n = points.GetLength();
+    if (n == 0) {
+        utility::LogWarning("[ComputeISSKeypoints] Input PointCloud is empty!");
+        return std::make_tuple(
+                Copy(), core::Tensor::Empty({0}, core::Dtype::Bool, device_));
+    }
+
+    if (salient_radius == 0.0 || non_max_radius == 0.0) {
+        core::nns::NearestNeighborSearch knn(points);
+        knn.KnnIndex();
+        core::Tensor distances;
+        std::tie(std::ignore, distances) =
+                knn.KnnSearch(points, int(std::min(int64_t(2), n)));
+        double resolution =
+                n > 1 ? distances.Slice(1, 1, 2)
+                                .To(core::Dtype::Float64)
+                                .Sqrt()
+                                .Mean({0, 1})
+                                .Item<double>()
+                      : 0.0;
+        salient_radius = 6 * resolution;
+        non_max_radius = 4 * resolution;
+        utility::LogDebug(
+                "[ComputeISSKeypoints] Computed salient_radius = {}, "
+                "non_max_radius = {} from input model",
+                salient_radius, non_max_radius);
+    }
+
+    double radius = std::max(salient_radius, non_max_radius);
+    core::nns::NearestNeighborSearch nns(points);
+    nns.FixedRadiusIndex(radius);
+    core::Tensor indices, num_neighbors;
+    std::tie(indices, std::ignore, num_neighbors) =
+            nns.FixedRadiusSearch(points, radius);
+    core::Tensor row_splits;
+    kernel::pointcloud::RowSplits(num_neighbors, row_splits);
+
+    core::Tensor saliency, mask;
+    kernel::pointcloud::ComputeISSSaliency(points, indices, row_splits,
+                                           salient_radius, gamma_21, gamma_32,
+                                           min_neighbors, saliency);
+    kernel::pointcloud::FindISSKeypoints(points, indices, row_splits,
+                                         saliency, non_max_radius,
+                                         min_neighbors, mask);
+    return std::make_tuple(SelectByMask(mask), mask);
+}
+
+core::Tensor PointCloud::ComputePointCloudDistance(const PointCloud &target,
+                                                   double max_distance) const {
+    core::Tensor points = GetPoints().Contiguous();
+    core::Tensor target_points = target.GetPoints().Contiguous();
+    target_points.AssertDevice(device_);
+    target_points.AssertDtype(points.GetDtype());
+    if (target_points.GetLength() == 0) {
+        utility::LogError(
+                "[ComputePointCloudDistance] Target PointCloud is empty.");
+    }
+    if (points.GetLength() == 0) {
+        return core::Tensor::Empty({0}, points.GetDtype(), device_);
+    }
+
+    core::nns::NearestNeighborSearch nns(target_points);
+    nns.KnnIndex();
+    core::Tensor distances;
+    std::tie(std::ignore, distances) = nns.KnnSearch(points, 1);
+    distances = distances.Reshape({-1}).Sqrt();
+    if (max_distance > 0) {
+        distances.SetItem(
+                core::TensorKey::IndexTensor(distances.Gt(max_distance)),
+                core::Tensor::Full({1}, max_distance, distances.GetDtype(),
+                                   device_));
+    }
+    return distances;
+}
+
+core::Tensor PointCloud::HiddenPointRemoval(
+        const core::Tensor &camera_locations, double radius) const {
+    if (radius <= 0) {
+        utility::LogError(
+                "[HiddenPointRemoval] radius must be larger than zero.");
+    }
+    core::Tensor cameras = camera_locations.Reshape({-1, 3});
+    const std::vector<Eigen::Vector3d> points =
+            core::eigen_converter::TensorToEigenVector3dVector(GetPoints());
+    const std::vector<Eigen::Vector3d> camera_points =
+            core::eigen_converter::TensorToEigenVector3dVector(cameras);
+    const int64_t num_points = int64_t(points.size());
+    const int num_cameras = int(camera_points.size());
+
+    core::Tensor visible =
+            core::Tensor::Zeros({num_cameras, num_points}, core::Dtype::Bool);
+    bool *visible_ptr = static_cast<bool *>(visible.GetDataPtr());
+#pragma omp parallel for schedule(dynamic) num_threads(utility::EstimateMaxThreads())
+    for (int cidx = 0; cidx < num_cameras; ++cidx) {
+        // Flip the points about the sphere around the camera, with the camera
+        // itself at the end.
+        std::vector<Eigen::Vector3d> flipped(num_points + 1);
+        for (int64_t pidx = 0; pidx < num_points; ++pidx) {
+            Eigen::Vector3d p = points[pidx] - camera_points[cidx];
+            double norm = p.norm();
+            flipped[pidx] = p + 2 * (radius - norm) * p / norm;
+        }
+        flipped[num_points].setZero();
+
+        bool *visible_row = visible_ptr + cidx * num_points;
+        for (size_t vidx :
+             open3d::geometry::Qhull::ComputeConvexHullVertices(flipped)) {
+            if (int64_t(vidx) < num_points) {
+                visible_row[vidx] = true;
+            }
+        }
+    }
+
+    if (camera_locations.NumDims() == 1) {
+        visible = visible.Reshape({num_points});
+    }
+    return visible.Copy(device_);
+}
+
+core::Tensor PointCloud::ClusterDBSCAN(double eps,
+                                       size_t min_points,
+                                       bool print_progress) const {
+    open3d::geometry::PointCloud pcd_legacy;
+    if (HasPoints()) {
+        pcd_legacy.points_ =
+                core::eigen_converter::TensorToEigenVector3dVector(GetPoints());
+    }
+    std::vector<int> labels =
+            pcd_legacy.ClusterDBSCAN(eps, min_points, print_progress);
+    return core::Tensor(labels, {int64_t(labels.size())}, core::Dtype::Int32,
+                        device_);
+}
+
+namespace {
+
+// Checks the cluster labels of num_points points and returns them as Int64.
+core::Tensor CheckClusterLabels(const core::Tensor &labels,
+                                int64_t num_points,
+                                const core::Device &device) {
+    if (labels.GetDtype() != core::Dtype::Int32 &&
+        labels.GetDtype() != core::Dtype::Int64) {
+        utility::LogError("labels must be Int32 or Int64, but got {}.",
+                          labels.GetDtype().ToString());
+    }
+    if (labels.GetShape() != core::SizeVector{num_points}) {
+        utility::LogError("labels must have shape {{{}}}, but got {}.",
+                          num_points, labels.GetShape());
+    }
+    labels.AssertDevice(device);
+    return labels.To(core::Dtype::Int64);
+}
+
+}  // namespace
+
+std::tuple<core::Tensor, core::Tensor>
+PointCloud::GetClusterAxisAlignedBoundingBoxes(
+        const core::Tensor &labels) const {
+    const core::Tensor points = GetPoints();
+    const core::Tensor labels_i64 =
+            CheckClusterLabels(labels, points.GetLength(), device_);
+    const core::Tensor mask = labels_i64.Ge(0);
+    const core::Tensor index = labels_i64.IndexGet({mask});
+    const int64_t num_clusters =
+            index.GetLength() == 0 ? 0 : index.Max({0}).Item<int64_t>() + 1;
+
+    const core::Dtype dtype = points.GetDtype();
+    core::Tensor min_bound, max_bound;
+    DISPATCH_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        min_bound = core::Tensor::Full<scalar_t>(
+                {num_clusters, 3}, std::numeric_limits<scalar_t>::max(), dtype,
+                device_);
+        max_bound = core::Tensor::Full<scalar_t>(
+                {num_clusters, 3}, std::numeric_limits<scalar_t>::lowest(),
+                dtype, device_);
+    });
+    if (num_clusters == 0) {
+        return std::make_tuple(min_bound, max_bound);
+    }
+    const core::Tensor values = points.IndexGet({mask});
+    core::ScatterReduce_(min_bound, index, values,
+                         core::kernel::ReductionOpCode::Min);
+    core::ScatterReduce_(max_bound, index, values,
+                         core::kernel::ReductionOpCode::Max);
+
+    // The labels without points keep the inverted initial bounds.
+    const core::Tensor nonempty = min_bound.Le(max_bound).To(dtype);
+    return std::make_tuple(min_bound * nonempty, max_bound * nonempty);
+}
+
+std::tuple<core::Tensor, core::Tensor, core::Tensor>
+PointCloud::GetClusterOrientedBoundingBoxes(const core::Tensor &labels,
+                                            bool minimal) const {
+    const core::Tensor labels_cpu =
+            CheckClusterLabels(labels, GetPoints().GetLength(), device_)
+                    .Copy(core::Device("CPU:0"));
+    const int64_t num_points = labels_cpu.GetLength();
+    const int64_t *label_ptr =
+            static_cast<const int64_t *>(labels_cpu.GetDataPtr());
+    int64_t num_clusters = 0;
+    for (int64_t i = 0; i < num_points; i++) {
+        num_clusters = std::max(num_clusters, label_ptr[i] + 1);
+    }
+
+    // Counting sort of the points by label, so that every cluster is a
+    // contiguous range.
+    const std::vector<Eigen::Vector3d> points =
+            core::eigen_converter::TensorToEigenVector3dVector(GetPoints());
+    std::vector<int64_t> offsets(num_clusters + 1, 0);
+    for (int64_t i = 0; i < num_points; i++) {
+        if (label_ptr[i] >= 0) {
+            offsets[label_ptr[i] + 1]++;
+        }
+    }
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+    std::vector<Eigen::Vector3d> grouped(offsets.back());
+    std::vector<int64_t> cursors(offsets.begin(), offsets.end() - 1);
+    for (int64_t i = 0; i < num_points; i++) {
+        if (label_ptr[i] >= 0) {
+            grouped[cursors[label_ptr[i]]++] = points[i];
+        }
+    }
+
+    std::vector<double> centers(num_clusters * 3);
+    std::vector<double> rotations(num_clusters * 9);
+    std::vector<double> extents(num_clusters * 3);
+#pragma omp parallel for schedule(dynamic) num_threads(utility::EstimateMaxThreads())
+    for (int64_t c = 0; c < num_clusters; c++) {
+        const std::vector<Eigen::Vector3d> cluster(
+                grouped.begin() + offsets[c], grouped.begin() + offsets[c + 1]);
+        open3d::geometry::OrientedBoundingBox obb;
+        bool has_minimal_box = false;
+        if (minimal && cluster.size() >= 4) {
+            // Qhull throws for the degenerate hulls.
+            try {
+                obb = open3d::geometry::OrientedBoundingBox::
+                        CreateFromPointsMinimal(cluster);
+                has_minimal_box = true;
+            } catch (const std::exception &) {
+            }
+        }
+        if (!has_minimal_box) {
+            obb = open3d::geometry::OrientedBoundingBox::CreateFromPointsPCA(
+                    cluster);
+        }
+        Eigen::Map<Eigen::Vector3d>(centers.data() + 3 * c) = obb.center_;
+        Eigen::Map<Eigen::Matrix<double, 3, 3, Eigen::RowMajor>>(
+                rotations.data() + 9 * c) = obb.R_;
+        Eigen::Map<Eigen::Vector3d>(extents.data() + 3 * c) = obb.extent_;
+    }
+    return std::make_tuple(
+            core::Tensor(centers, {num_clusters, 3}, core::Dtype::Float64,
+                         device_),
+            core::Tensor(rotations, {num_clusters, 3, 3}, core::Dtype::Float64,
+                         device_),
+            core::Tensor(extents, {num_clusters, 3}, core::Dtype::Float64,
+                         device_));
+}
+
+namespace {
+
+// Number of RANSAC iterations needed to sample 3 inliers with the given
+// probability, when a fraction fitness of the points are inliers.
+int64_t RANSACIterationsNeeded(double fitness, double probability) {
+    const double all_inliers = fitness * fitness * fitness;
+    if (all_inliers <= 0) {
+        return std::numeric_limits<int64_t>::max();
+    }
+    if (all_inliers >= 1) {
+        return 0;
+    }
+    return int64_t(std::min(
+            std::ceil(std::log(1 - probability) / std::log(1 - all_inliers)),
+            double(std::numeric_limits<int64_t>::max() / 2)));
+}
+
+// Bool mask of the points within distance_threshold of the plane.
+core::Tensor PlaneInlierMask(const core::Tensor &points,
+                             const Eigen::Vector4d &plane,
+                             double distance_threshold) {
+    core::Tensor normal =
+            core::Tensor(std::vector<double>{plane(0), plane(1), plane(2)},
+                         {3, 1}, core::Dtype::Float64, points.GetDevice())
+                    .To(points.GetDtype());
+    return points.Matmul(normal)
+            .Add(plane(3))
+            .Abs()
+            .Lt(distance_threshold)
+            .Reshape({points.GetLength()});
+}
+
+// RANSAC plane among the points where active is true. The hypotheses are
+// drawn on the host and evaluated on the device by batches, as the product
+// of the points with the matrix of the plane normals. Returns a zero plane if
+// no sample spans a plane.
+Eigen::Vector4d RANSACPlaneBatched(const core::Tensor &points,
+                                   const core::Tensor &active,
+                                   double distance_threshold,
+                                   int ransac_n,
+                                   int num_iterations,
+                                   double probability,
+                                   std::mt19937 &rng) {
+    // The distances of a batch take at most 2^24 elements.
+    const int64_t num_points = points.GetLength();
+    const int64_t max_batch_size = (int64_t(1) << 24) / num_points;
+    const int64_t batch_size =
+            std::max(int64_t(1), std::min(int64_t(256), max_batch_size));
+    const core::Device device = points.GetDevice();
+    const core::Tensor candidates = active.NonZero()[0];
+    const int64_t num_candidates = candidates.GetLength();
+    const core::Tensor active_column = active.Reshape({num_points, 1});
+
+    Eigen::Vector4d best_plane(0, 0, 0, 0);
+    int64_t best_count = 0;
+    int64_t itr = 0;
+    while (itr < num_iterations) {
+        const int64_t num_hypotheses =
+                std::min(batch_size, int64_t(num_iterations) - itr);
+
+        // Only the first three of the ransac_n distinct points of each sample
+        // define the plane.
+        std::vector<int64_t> sample_positions;
+        std::vector<int64_t> sample;
+        for (int64_t h = 0; h < num_hypotheses; ++h) {
+            sample.clear();
+            while (sample.size() < size_t(ransac_n)) {
+                int64_t pos = int64_t(rng() % uint64_t(num_candidates));
+                if (std::find(sample.begin(), sample.end(), pos) ==
+                    sample.end()) {
+                    sample.push_back(pos);
+                }
+            }
+            sample_positions.insert(sample_positions.end(), sample.begin(),
+                                    sample.begin() + 3);
+        }
+        core::Tensor sample_indices = candidates.IndexGet({core::Tensor(
+                sample_positions, {num_hypotheses * 3}, core::Dtype::Int64,
+                device)});
+        std::vector<double> sample_points =
+                points.IndexGet({sample_indices})
+                        .To(core::Dtype::Float64)
+                        .ToFlatVector<double>();
+
+        // Degenerate samples get an infinite offset, so they have no inliers.
+        std::vector<Eigen::Vector4d> planes(num_hypotheses);
+        std::vector<double> normals(3 * num_hypotheses);
+        std::vector<double> offsets(num_hypotheses);
+        for (int64_t h = 0; h < num_hypotheses; ++h) {
+            const Eigen::Map<const Eigen::Vector3d> p0(&sample_points[9 * h]);
+            const Eigen::Map<const Eigen::Vector3d> p1(
+                    &sample_points[9 * h + 3]);
+            const Eigen::Map<const Eigen::Vector3d> p2(
+                    &sample_points[9 * h + 6]);
+            Eigen::Vector3d normal = (p1 - p0).cross(p2 - p0);
+            const double norm = normal.norm();
+            if (norm == 0) {
+                planes[h].setZero();
+                normal.setZero();
+                offsets[h] = std::numeric_limits<double>::infinity();
+            } else {
+                normal /= norm;
+                planes[h] << normal, -normal.dot(p0);
+                offsets[h] = planes[h](3);
+            }
+            for (int i = 0; i < 3; ++i) {
+                normals[i * num_hypotheses + h] = normal(i);
+            }
+        }
+
+        core::Tensor counts =
+                points.Matmul(core::Tensor(normals, {3, num_hypotheses},
+                                           core::Dtype::Float64, device)
+                                      .To(points.GetDtype()))
+                        .Add(core::Tensor(offsets, {1, num_hypotheses},
+                                          core::Dtype::Float64, device)
+                                     .To(points.GetDtype()))
+                        .Abs()
+                        .Lt(distance_threshold)
+                        .LogicalAnd(active_column)
+                        .To(core::Dtype::Int64)
+                        .Sum({0});
+        std::vector<int64_t> counts_host = counts.ToFlatVector<int64_t>();
+        for (int64_t h = 0; h < num_hypotheses; ++h) {
+            if (counts_host[h] > best_count) {
+                best_count = counts_host[h];
+                best_plane = planes[h];
+            }
+        }
+
+        itr += num_hypotheses;
+        if (itr >= RANSACIterationsNeeded(double(best_count) / num_candidates,
+                                          probability)) {
+            break;
+        }
+    }
+    utility::LogDebug("RANSAC | Iterations: {:d}, Inliers: {:d}", itr,
+                      best_count);
+    return best_plane;
+}
+
+// Least squares plane of the points, or a zero plane if the points do not
+// span a plane.
+Eigen::Vector4d FitPlane(const core::Tensor &points) {
+    core::Tensor points_f64 = points.To(core::Dtype::Float64);
+    core::Tensor centroid = points_f64.Mean({0}, true);
+    core::Tensor centered = points_f64.Sub(centroid);
+    std::vector<double> cov =
+            centered.T().Matmul(centered).ToFlatVector<double>();
+    std::vector<double> c = centroid.ToFlatVector<double>();
+    Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> solver(
+            Eigen::Map<Eigen::Matrix3d>(cov.data()));
+    if (solver.info() != Eigen::Success || solver.eigenvalues()(1) <= 0) {
+        return Eigen::Vector4d(0, 0, 0, 0);
+    }
+    // The eigenvalues are sorted in increasing order.
+    const Eigen::Vector3d normal = solver.eigenvectors().col(0);
+    Eigen::Vector4d plane;
+    plane << normal, -normal.dot(Eigen::Vector3d(c[0], c[1], c[2]));
+    return plane;
+}
+
+core::Tensor PlaneToTensor(const Eigen::Vector4d &plane,
+                           const core::Device &device) {
+    return core::Tensor(std::vector<double>(plane.data(), plane.data() + 4),
+                        {4}, core::Dtype::Float64, device);
+}
+
+void CheckSegmentPlaneParameters(double distance_threshold,
+                                 int ransac_n,
+                                 double probability,
+                                 int64_t num_points) {
+    if (distance_threshold <= 0 || ransac_n < 3 || probability <= 0 ||
+        probability > 1) {
+        utility::LogError(
+                "[SegmentPlane] Illegal input parameters, distance_threshold "
+                "must be positive, ransac_n at least 3 and probability in "
+                "(0, 1].");
+    }
+    if (num_points < ransac_n) {
+        utility::LogError("[SegmentPlane] There must be at least ransac_n "
+                          "points.");
+    }
+}
+
+}  // namespace
+
+std::tuple<core::Tensor, core::Tensor> PointCloud::SegmentPlane(
+        double distance_threshold,
+        int ransac_n,
+        int num_iterations,
+        double probability) const {
+    core::Tensor points = GetPoints().Contiguous();
+    CheckSegmentPlaneParameters(distance_threshold, ransac_n, probability,
+                                points.GetLength());
+    std::random_device rd;
+    std::mt19937 rng(rd());
+    core::Tensor active = core::Tensor::Ones({points.GetLength()},
+                                             core::Dtype::Bool, device_);
+    Eigen::Vector4d plane =
+            RANSACPlaneBatched(points, active, distance_threshold, ransac_n,
+                               num_iterations, probability, rng);
+
+    core::Tensor mask = PlaneInlierMask(points, plane, distance_threshold);
+    core::Tensor inliers = mask.NonZero()[0];
+    if (!plane.isZero(0)) {
+        plane = FitPlane(points.IndexGet({inliers}));
+    }
+    return std::make_tuple(PlaneToTensor(plane, device_), inliers);
+}
+
+std::vector<std::tuple<core::Tensor, core::Tensor>> PointCloud::SegmentPlanes(
+        int max_planes,
+        double distance_threshold,
+        int ransac_n,
+        int num_iterations,
+        int64_t min_num_inliers,
+        double probability) const {
+    core::Tensor points = GetPoints().Contiguous();
+    CheckSegmentPlaneParameters(distance_threshold, ransac_n, probability,
+                                points.GetLength());
+    std::random_device rd;
+    std::mt19937 rng(rd());
+
+    // The inliers of the planes found are removed from the active mask, and
+    // the point cloud itself is never copied.
+    core::Tensor active = core::Tensor::Ones({points.GetLength()},
+                                             core::Dtype::Bool, device_);
+    int64_t num_active = points.GetLength();
+    std::vector<std::tuple<core::Tensor, core::Tensor>> planes;
+    while (int(planes.size()) < max_planes && num_active >= ransac_n) {
+        Eigen::Vector4d plane =
+                RANSACPlaneBatched(points, active, distance_threshold, ransac_n,
+                                   num_iterations, probability, rng);
+        if (plane.isZero(0)) {
+            break;
+        }
+        core::Tensor mask =
+                PlaneInlierMask(points, plane, distance_threshold)
+                        .LogicalAnd(active);
+        core::Tensor inliers = mask.NonZero()[0];
+        if (inliers.GetLength() < min_num_inliers) {
+            break;
+        }
+        active = active.LogicalAnd(mask.LogicalNot());
+        num_active -= inliers.GetLength();
+        plane = FitPlane(points.IndexGet({inliers}));
+        planes.emplace_back(PlaneToTensor(plane, device_), inliers);
+    }
+    return planes;
+}
+
+void PointCloud::EstimateNormals(int max_nn, utility::optional<double> radius) {
+    if (max_nn < 3) {
+        utility::LogError(
+                "[EstimateNormals] max_nn must be at least 3, but got {}.",
+                max_nn);
+    }
+    if (radius.has_value() && radius.value() <= 0) {
+        utility::LogError(
+                "[EstimateNormals] radius must be positive, but got {}.",
+                radius.value());
+    }
+
+    core::Tensor points = GetPoints().Contiguous();
+    core::Dtype dtype = points.GetDtype();
+    if (dtype != core::Dtype::Float32 && dtype != core::Dtype::Float64) {
+        utility::LogError(
+                "[EstimateNormals] Points must be Float32 or Float64, but got "
+                "{}.",
+                dtype.ToString());
+    }
+    bool has_normals = HasPointNormals();
+    core::Tensor normals =
+            has_normals ? GetPointNormals().To(dtype).Contiguous()
+                        : core::Tensor::Empty(points.GetShape(), dtype,
+                                              points.GetDevice());
+    if (points.GetLength() > 0) {
+        // The knn search is native on both CPU and CUDA; the radius limit of
+        // a hybrid search is applied by the kernel.
+        core::nns::NearestNeighborSearch nns(points);
+        nns.KnnIndex();
+        core::Tensor indices, distances;
+        std::tie(indices, distances) = nns.KnnSearch(points, max_nn);
+        double max_distance2 = radius.has_value()
+                                       ? radius.value() * radius.value()
+                                       : std::numeric_limits<double>::max();
+        kernel::pointcloud::EstimateNormals(points, indices, distances, normals,
+                                            has_normals, max_distance2);
+    }
+    SetPointNormals(normals);
+}
+
+void PointCloud::OrientNormalsTowardsCameraLocation(
+        const core::Tensor &camera_location) {
+    if (!HasPointNormals()) {
+        utility::LogError(
+                "[OrientNormalsTowardsCameraLocation] No normals in the "
+                "PointCloud. Call EstimateNormals() first.");
+    }
+    camera_location.AssertShape({3});
+
+    core::Tensor points = GetPoints().Contiguous();
+    core::Tensor normals =
+            GetPointNormals().To(points.GetDtype()).Contiguous();
+    kernel::pointcloud::OrientNormalsTowardsCameraLocation(points, normals,
+                                                           camera_location);
+    SetPointNormals(normals);
+}
+
+void PointCloud::OrientNormalsConsistentTangentPlane(size_t k) {
+    if (!HasPointNormals()) {
+        utility::LogError(
+                "[OrientNormalsConsistentTangentPlane] No normals in the "
+                "PointCloud. Call EstimateNormals() first.");
+    }
+
+    open3d::geometry::PointCloud pcd_legacy;
+    pcd_legacy.points_ =
+            core::eigen_converter::TensorToEigenVector3dVector(GetPoints());
+    pcd_legacy.normals_ = core::eigen_converter::TensorToEigenVector3dVector(
+            GetPointNormals());
+    pcd_legacy.OrientNormalsConsistentTangentPlane(k);
+    SetPointNormals(core::eigen_converter::EigenVector3dVectorToTensor(
+            pcd_legacy.normals_, GetPointNormals().GetDtype(), device_));
+}
+
 PointCloud PointCloud::CreateFromDepthImage(const Image &depth,
                                             const core::Tensor &intrinsics,
                                             const core::Tensor &extrinsics,
@@ -153,12 +989,104 @@ PointCloud PointCloud::CreateFromDepthImage(const Image &depth,
                                             int stride) {
     depth.AsTensor().AssertDtype(core::Dtype::UInt16);
 
-    core::Tensor points;
-    kernel::pointcloud::Unproject(depth.AsTensor(), points, intrinsics,
-                                  extrinsics, depth_scale, depth_max, stride);
+    core::Tensor points, colors;
+    kernel::pointcloud::Unproject(depth.AsTensor(), core::Tensor(), points,
+                                  colors, intrinsics, extrinsics, depth_scale,
+                                  depth_max, stride);
     return PointCloud(points);
 }
 
+PointCloud PointCloud::CreateFromRGBDImage(const RGBDImage &rgbd_image,
+                                           const core::Tensor &intrinsics,
+                                           const core::Tensor &extrinsics,
+                                           float depth_scale,
+                                           float depth_max,
+                                           int stride) {
+    rgbd_image.depth_.AsTensor().AssertDtype(core::Dtype::UInt16);
+    if (!rgbd_image.AreAligned()) {
+        utility::LogError("The color and depth images must be aligned.");
+    }
+
+    core::Tensor points, colors;
+    kernel::pointcloud::Unproject(rgbd_image.depth_.AsTensor(),
+                                  rgbd_image.color_.AsTensor(), points, colors,
+                                  intrinsics, extrinsics, depth_scale,
+                                  depth_max, stride);
+    PointCloud pcd(points);
+    pcd.SetPointColors(colors);
+    return pcd;
+}
+
+namespace {
+
+// Float64 CPU tensor of shape {n, 3} sharing the memory of values. The
+// deleter of the blob keeps owner alive.
+core::Tensor ViewAsTensor(
+        std::vector<Eigen::Vector3d> &values,
+        const std::shared_ptr<open3d::geometry::PointCloud> &owner) {
+    // Eigen::Vector3d is not a "fixed-size vectorizable Eigen type", so the
+    // vector holds packed triplets of doubles.
+    static_assert(sizeof(Eigen::Vector3d) == 3 * sizeof(double),
+                  "Eigen::Vector3d must be 3 packed doubles.");
+    core::SizeVector shape{int64_t(values.size()), 3};
+    auto blob = std::make_shared<core::Blob>(core::Device("CPU:0"),
+                                             values.data(),
+                                             [owner](void *) { (void)owner; });
+    return core::Tensor(shape, core::Tensor::DefaultStrides(shape),
+                        values.data(), core::Dtype::Float64, blob);
+}
+
+// True if tensor is a view created by ViewAsTensor(values).
+bool IsViewOf(const core::Tensor &tensor,
+              const std::vector<Eigen::Vector3d> &values) {
+    return tensor.GetDevice() == core::Device("CPU:0") &&
+           tensor.GetDtype() == core::Dtype::Float64 &&
+           tensor.IsContiguous() &&
+           tensor.GetShape() == core::SizeVector{int64_t(values.size()), 3} &&
+           tensor.GetDataPtr() == values.data();
+}
+
+}  // namespace
+
+PointCloud PointCloud::FromLegacyPointCloudView(
+        const std::shared_ptr<open3d::geometry::PointCloud> &pcd_legacy) {
+    if (!pcd_legacy) {
+        utility::LogError("[FromLegacyPointCloudView] pcd_legacy is null.");
+    }
+    geometry::PointCloud pcd(core::Device("CPU:0"));
+    if (pcd_legacy->HasPoints()) {
+        pcd.SetPoints(ViewAsTensor(pcd_legacy->points_, pcd_legacy));
+    } else {
+        utility::LogWarning("Creating from an empty legacy PointCloud.");
+    }
+    if (pcd_legacy->HasColors()) {
+        pcd.SetPointColors(ViewAsTensor(pcd_legacy->colors_, pcd_legacy));
+    }
+    if (pcd_legacy->HasNormals()) {
+        pcd.SetPointNormals(ViewAsTensor(pcd_legacy->normals_, pcd_legacy));
+    }
+    pcd.legacy_view_ = pcd_legacy;
+    return pcd;
+}
+
+std::shared_ptr<open3d::geometry::PointCloud>
+PointCloud::ToLegacyPointCloudView() const {
+    std::shared_ptr<open3d::geometry::PointCloud> pcd_legacy =
+            legacy_view_.lock();
+    if (pcd_legacy && HasPoints() == pcd_legacy->HasPoints() &&
+        HasPointColors() == pcd_legacy->HasColors() &&
+        HasPointNormals() == pcd_legacy->HasNormals() &&
+        (!HasPoints() || IsViewOf(GetPoints(), pcd_legacy->points_)) &&
+        (!HasPointColors() ||
+         IsViewOf(GetPointColors(), pcd_legacy->colors_)) &&
+        (!HasPointNormals() ||
+         IsViewOf(GetPointNormals(), pcd_legacy->normals_))) {
+        return pcd_legacy;
+    }
+    return std::make_shared<open3d::geometry::PointCloud>(
+            ToLegacyPointCloud());
+}
+
 PointCloud PointCloud::FromLegacyPointCloud(
         const open3d::geometry::PointCloud &pcd_legacy,
         core::Dtype dtype,
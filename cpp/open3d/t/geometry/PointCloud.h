@@ -27,16 +27,22 @@
 #pragma once
 
 #include <Eigen/Core>
+#include <memory>
 #include <string>
+#include <tuple>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include "open3d/core/Tensor.h"
+#include "open3d/geometry/BoundingVolume.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/t/geometry/Geometry.h"
 #include "open3d/t/geometry/Image.h"
+#include "open3d/t/geometry/RGBDImage.h"
 #include "open3d/t/geometry/TensorMap.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/Optional.h"
 
 namespace open3d {
 namespace t {
@@ -218,6 +224,7 @@ public:
     /// Clear all data in the pointcloud.
     PointCloud &Clear() override {
         point_attr_.clear();
+        point_attr_.Shrink();
         return *this;
     }
 
@@ -230,6 +237,10 @@ public:
     /// Returns the max bound for point coordinates.
     core::Tensor GetMaxBound() const;
 
+    /// Returns the min and max bounds for point coordinates, computed in a
+    /// single pass over the points.
+    std::tuple<core::Tensor, core::Tensor> GetMinMaxBound() const;
+
     /// Returns the center for point coordinates.
     core::Tensor GetCenter() const;
 
@@ -239,6 +250,20 @@ public:
     /// Returns deep copy of the pointcloud on the same device
     PointCloud Copy() const;
 
+    /// \brief Appends the points of \p other, in-place.
+    ///
+    /// \p other must be on the same device and have the same attributes.
+    /// The attributes over-allocate their memory, so that accumulating many
+    /// frames into a map takes amortized linear time. Use Shrink() to release
+    /// the reserved memory once done.
+    PointCloud &Append(const PointCloud &other);
+
+    /// Releases the memory reserved by Append().
+    PointCloud &Shrink() {
+        point_attr_.Shrink();
+        return *this;
+    }
+
     /// \brief Transforms the points and normals (if exist)
     /// of the PointCloud.
     /// Extracts R, t from Transformation
@@ -249,9 +274,20 @@ public:
     /// and applies the transformation as P = R(P) + t
     /// \param transformation Transformation [Tensor of dim {4,4}].
     /// Should be on the same device as the PointCloud
+    /// The points and the normals are updated in place in a single kernel.
     /// \return Transformed pointcloud
     PointCloud &Transform(const core::Tensor &transformation);
 
+    /// \brief Transforms each PointCloud by its own transformation, as
+    /// Transform, with a single kernel launch for all of them.
+    ///
+    /// \param pointclouds PointClouds on the same device, with the same
+    /// dtype. They are transformed in place.
+    /// \param transformations Tensor of shape {k, 4, 4} on the device of the
+    /// PointClouds, where k is the number of PointClouds.
+    static void BatchTransform(std::vector<PointCloud> &pointclouds,
+                               const core::Tensor &transformations);
+
     /// \brief Translates the points of the PointCloud.
     /// \param translation translation tensor of dimention {3}
     /// Should be on the same device as the PointCloud
@@ -275,6 +311,260 @@ public:
     /// \return Rotated pointcloud
     PointCloud &Rotate(const core::Tensor &R, const core::Tensor &center);
 
+    /// \brief Downsamples the PointCloud with a voxel grid, on the device of
+    /// the PointCloud.
+    ///
+    /// The points falling in the same voxel are merged into one point, whose
+    /// attributes are the averages of the attributes of the merged points.
+    /// The order of the output points is unspecified.
+    ///
+    /// \param voxel_size Edge length of the voxels.
+    /// \return Downsampled pointcloud with the same attributes.
+    PointCloud VoxelDownSample(double voxel_size) const;
+
+    /// \brief Selects the points where \p mask is true, with all their
+    /// attributes, on the device of the PointCloud.
+    ///
+    /// The indices of the points are computed once and the attributes are
+    /// gathered together in a single kernel launch.
+    ///
+    /// \param mask Bool tensor of shape {n,}.
+    /// \param invert If true, selects the points where \p mask is false.
+    /// \return PointCloud of the selected points, in their original order.
+    PointCloud SelectByMask(const core::Tensor &mask,
+                            bool invert = false) const;
+
+    /// \brief Selects the points of \p indices, as
+    /// open3d::geometry::PointCloud::SelectByIndex.
+    ///
+    /// \param indices Int64 tensor of point indices in [0, n). Duplicated
+    /// indices select the point once.
+    /// \param invert If true, selects the points not in \p indices.
+    /// \return PointCloud of the selected points, in their original order.
+    PointCloud SelectByIndex(const core::Tensor &indices,
+                             bool invert = false) const;
+
+    /// \brief Crops the PointCloud to the points inside an axis-aligned
+    /// bounding box, bounds included.
+    ///
+    /// \param bbox Axis-aligned bounding box, must not be empty.
+    /// \return PointCloud of the points inside the box.
+    PointCloud Crop(const open3d::geometry::AxisAlignedBoundingBox &bbox) const;
+
+    /// \brief Crops the PointCloud to the points inside an oriented bounding
+    /// box, bounds included.
+    ///
+    /// \param bbox Oriented bounding box, must not be empty.
+    /// \return PointCloud of the points inside the box.
+    PointCloud Crop(const open3d::geometry::OrientedBoundingBox &bbox) const;
+
+    /// \brief Estimates the normals of the points from the covariance of
+    /// their neighborhoods, on the device of the PointCloud.
+    ///
+    /// Existing normals are used to orient the new ones. Points with fewer
+    /// than 3 neighbors get the normal (0, 0, 1).
+    ///
+    /// \param max_nn Maximum number of neighbors of each point, including
+    /// the point itself.
+    /// \param radius If given, neighbors farther than \p radius are ignored,
+    /// as in a hybrid search.
+    void EstimateNormals(int max_nn = 30,
+                         utility::optional<double> radius = utility::nullopt);
+
+    /// \brief Orients the normals towards a camera location.
+    ///
+    /// \param camera_location Camera location [Tensor of dim {3}]. Zero
+    /// normals are set to the direction towards the camera.
+    void OrientNormalsTowardsCameraLocation(
+            const core::Tensor &camera_location =
+                    core::Tensor::Zeros({3}, core::Dtype::Float32));
+
+    /// \brief Consistently orients the normals by propagating them along a
+    /// minimum spanning tree of a Riemannian graph, as described in Hoppe et
+    /// al., "Surface Reconstruction from Unorganized Points", 1992.
+    ///
+    /// The graph is built from a Delaunay triangulation, which is computed
+    /// with Qhull on the CPU; PointClouds on other devices are oriented on
+    /// the CPU and copied back.
+    ///
+    /// \param k Number of nearest neighbors of each point added to the graph.
+    void OrientNormalsConsistentTangentPlane(size_t k);
+
+    /// \brief Removes the points that have less than \p nb_points neighbors
+    /// in a sphere of radius \p search_radius, on the device of the
+    /// PointCloud.
+    ///
+    /// \param nb_points Number of points within the radius, excluding the
+    /// point itself.
+    /// \param search_radius Radius of the sphere.
+    /// \return Tuple of the pointcloud of the kept points and the Bool mask
+    /// of shape {n,} that is true for the kept points.
+    std::tuple<PointCloud, core::Tensor> RemoveRadiusOutliers(
+            size_t nb_points, double search_radius) const;
+
+    /// \brief Removes the points whose average distance to their
+    /// \p nb_neighbors nearest neighbors is larger than the average over the
+    /// pointcloud by more than \p std_ratio standard deviations, on the device
+    /// of the PointCloud.
+    ///
+    /// \param nb_neighbors Number of neighbors, including the point itself.
+    /// \param std_ratio Standard deviation ratio.
+    /// \return Tuple of the pointcloud of the kept points and the Bool mask
+    /// of shape {n,} that is true for the kept points.
+    std::tuple<PointCloud, core::Tensor> RemoveStatisticalOutliers(
+            size_t nb_neighbors, double std_ratio) const;
+
+    /// \brief Detects the Intrinsic Shape Signature (ISS) keypoints, as
+    /// open3d::geometry::keypoint::ComputeISSKeypoints, on the device of the
+    /// PointCloud.
+    ///
+    /// A single fixed radius search with the larger radius provides the
+    /// neighbors of both the saliency and the non-maximum suppression.
+    ///
+    /// \param salient_radius Radius of the neighborhoods of the saliency. If
+    /// 0, it is 6 times the mean distance between nearest neighbors.
+    /// \param non_max_radius Radius of the non-maximum suppression. If 0, it
+    /// is 4 times the mean distance between nearest neighbors.
+    /// \param gamma_21 Upper bound of the ratio of the second to the first
+    /// eigenvalue.
+    /// \param gamma_32 Upper bound of the ratio of the third to the second
+    /// eigenvalue.
+    /// \param min_neighbors Minimum number of neighbors of a keypoint.
+    /// \return Tuple of the pointcloud of the keypoints and the Bool mask of
+    /// shape {n,} that is true for the keypoints.
+    std::tuple<PointCloud, core::Tensor> ComputeISSKeypoints(
+            double salient_radius = 0.0,
+            double non_max_radius = 0.0,
+            double gamma_21 = 0.975,
+            double gamma_32 = 0.975,
+            int min_neighbors = 5) const;
+
+    /// \brief Computes for each point the distance to the closest point of
+    /// the target PointCloud, as
+    /// open3d::geometry::PointCloud::ComputePointCloudDistance, on the device
+    /// of the PointCloud.
+    ///
+    /// The closest points are found with a single batched nearest neighbor
+    /// search of core::nns::NearestNeighborSearch.
+    ///
+    /// \param target Target PointCloud, on the same device.
+    /// \param max_distance If positive, the distances larger than
+    /// max_distance are truncated to max_distance.
+    /// \return Tensor of shape {n,} with the distances, with the dtype of the
+    /// points.
+    core::Tensor ComputePointCloudDistance(const PointCloud &target,
+                                           double max_distance = 0.0) const;
+
+    /// \brief Finds the points visible from each of several cameras, as
+    /// open3d::geometry::PointCloud::HiddenPointRemoval.
+    ///
+    /// The points are converted once and the cameras are processed in
+    /// parallel on the CPU, each with the convex hull of its spherically
+    /// flipped points. Only the hull vertices are extracted, no mesh is
+    /// built.
+    ///
+    /// \param camera_locations Tensor of shape {k, 3} or {3,} with the
+    /// camera locations.
+    /// \param radius Radius of the spherical projection.
+    /// \return Bool tensor of shape {k, n}, or {n,} for a single camera of
+    /// shape {3,}, that is true for the points visible from each camera, on
+    /// the device of the PointCloud.
+    core::Tensor HiddenPointRemoval(const core::Tensor &camera_locations,
+                                    double radius) const;
+
+    /// \brief Segments a plane with RANSAC, on the device of the PointCloud.
+    ///
+    /// The hypotheses are evaluated by batches as a matrix product of the
+    /// points with the plane normals, and the iterations stop early once the
+    /// best plane was sampled with the given \p probability.
+    ///
+    /// \param distance_threshold Max distance a point can be from the plane
+    /// model, and still be considered an inlier.
+    /// \param ransac_n Number of initial points to be considered inliers in
+    /// each iteration.
+    /// \param num_iterations Maximum number of iterations.
+    /// \param probability Expected probability of finding the optimal plane.
+    /// \return Tuple of the Float64 plane model [a, b, c, d] of the plane
+    /// ax + by + cz + d = 0 and the Int64 indices of the inliers.
+    std::tuple<core::Tensor, core::Tensor> SegmentPlane(
+            double distance_threshold = 0.01,
+            int ransac_n = 3,
+            int num_iterations = 100,
+            double probability = 0.99999999) const;
+
+    /// \brief Segments up to \p max_planes planes with RANSAC, each among
+    /// the points that are not inliers of the previous planes.
+    ///
+    /// The inliers are removed with a mask, without copying the PointCloud.
+    ///
+    /// \param max_planes Maximum number of planes.
+    /// \param distance_threshold Max distance a point can be from the plane
+    /// model, and still be considered an inlier.
+    /// \param ransac_n Number of initial points to be considered inliers in
+    /// each iteration.
+    /// \param num_iterations Maximum number of iterations for each plane.
+    /// \param min_num_inliers The segmentation stops at the first plane with
+    /// fewer inliers.
+    /// \param probability Expected probability of finding the optimal plane.
+    /// \return The plane models and the indices of their inliers as in
+    /// SegmentPlane(), in the order they were found.
+    std::vector<std::tuple<core::Tensor, core::Tensor>> SegmentPlanes(
+            int max_planes,
+            double distance_threshold = 0.01,
+            int ransac_n = 3,
+            int num_iterations = 100,
+            int64_t min_num_inliers = 3,
+            double probability = 0.99999999) const;
+
+    /// \brief Clusters the points with DBSCAN, as
+    /// open3d::geometry::PointCloud::ClusterDBSCAN.
+    ///
+    /// The clustering runs on the CPU, the points of a CUDA PointCloud are
+    /// copied to the host.
+    ///
+    /// \param eps Density parameter that is used to find neighbouring points.
+    /// \param min_points Minimum number of points to form a cluster.
+    /// \param print_progress If `true` the progress is visualized in the
+    /// console.
+    /// \return Int32 labels of shape {n,} on the device of the PointCloud,
+    /// with -1 for the noise.
+    core::Tensor ClusterDBSCAN(double eps,
+                               size_t min_points,
+                               bool print_progress = false) const;
+
+    /// \brief Computes the axis-aligned bounding box of every cluster.
+    ///
+    /// The bounds are scatter-reduced on the device of the PointCloud in a
+    /// single pass over the points, without grouping them by cluster.
+    ///
+    /// \param labels Int32 or Int64 labels of shape {n,}, e.g. from
+    /// ClusterDBSCAN(). The points with negative labels (noise) are ignored.
+    /// \return (min_bound, max_bound) of shape {k, 3} with the dtype of the
+    /// points, where k is the largest label + 1. The labels without points get
+    /// zero bounds.
+    std::tuple<core::Tensor, core::Tensor> GetClusterAxisAlignedBoundingBoxes(
+            const core::Tensor &labels) const;
+
+    /// \brief Computes the oriented bounding box of every cluster.
+    ///
+    /// The points are grouped by label on the CPU and the clusters are boxed
+    /// in parallel with OrientedBoundingBox::CreateFromPointsPCA(), or with
+    /// OrientedBoundingBox::CreateFromPointsMinimal() if \p minimal. The
+    /// clusters with a degenerate convex hull, e.g. fewer than 4 or coplanar
+    /// points, fall back to the PCA box.
+    ///
+    /// \param labels Int32 or Int64 labels of shape {n,}, e.g. from
+    /// ClusterDBSCAN(). The points with negative labels (noise) are ignored.
+    /// \param minimal Search for the approximately minimal-volume boxes
+    /// instead of the PCA boxes.
+    /// \return (center, R, extent) Float64 tensors of shapes {k, 3},
+    /// {k, 3, 3} and {k, 3} on the device of the PointCloud, as the members of
+    /// open3d::geometry::OrientedBoundingBox, where k is the largest label + 1.
+    /// The labels without points get empty boxes.
+    std::tuple<core::Tensor, core::Tensor, core::Tensor>
+    GetClusterOrientedBoundingBoxes(const core::Tensor &labels,
+                                    bool minimal = false) const;
+
     /// \brief Returns the device attribute of this PointCloud.
     core::Device GetDevice() const { return device_; }
 
@@ -306,6 +596,31 @@ public:
             float depth_max = 3.0f,
             int stride = 1);
 
+    /// \brief Factory function to create a colored pointcloud from an RGB-D
+    /// image and a camera model.
+    ///
+    /// The points are unprojected as in CreateFromDepthImage, and each point
+    /// gets the color of its pixel in the same pass.
+    ///
+    /// \param rgbd_image The input RGB-D image. The depth image should be a
+    /// uint16_t image, and the color image an aligned 3-channel uint8_t or
+    /// float image on the same device.
+    /// \param intrinsics Intrinsic parameters of the camera.
+    /// \param extrinsics Extrinsic parameters of the camera.
+    /// \param depth_scale The depth is scaled by 1 / \p depth_scale.
+    /// \param depth_max Truncated at \p depth_max distance.
+    /// \param stride Sampling factor to support coarse point cloud extraction.
+    ///
+    /// \return A pointcloud with Float32 points and colors in [0, 1].
+    static PointCloud CreateFromRGBDImage(
+            const RGBDImage &rgbd_image,
+            const core::Tensor &intrinsics,
+            const core::Tensor &extrinsics = core::Tensor::Eye(
+                    4, core::Dtype::Float32, core::Device("CPU:0")),
+            float depth_scale = 1000.0f,
+            float depth_max = 3.0f,
+            int stride = 1);
+
     /// Create a PointCloud from a legacy Open3D PointCloud.
     static PointCloud FromLegacyPointCloud(
             const open3d::geometry::PointCloud &pcd_legacy,
@@ -315,9 +630,38 @@ public:
     /// Convert to a legacy Open3D PointCloud.
     open3d::geometry::PointCloud ToLegacyPointCloud() const;
 
+    /// \brief Create a PointCloud viewing the data of a legacy Open3D
+    /// PointCloud, without copy.
+    ///
+    /// The "points", "colors" and "normals" attributes are Float64 tensors on
+    /// CPU that share the memory of the vectors of \p pcd_legacy, which is
+    /// kept alive as long as any of the tensors. Writes through either side
+    /// are visible to the other. The vectors of \p pcd_legacy must not be
+    /// resized while they are viewed, as this reallocates their memory.
+    ///
+    /// A copy is unavoidable for any other dtype or device, use
+    /// FromLegacyPointCloud() then.
+    static PointCloud FromLegacyPointCloudView(
+            const std::shared_ptr<open3d::geometry::PointCloud> &pcd_legacy);
+
+    /// \brief Convert to a legacy Open3D PointCloud, without copy if
+    /// possible.
+    ///
+    /// If the PointCloud was created by FromLegacyPointCloudView() and its
+    /// "points", "colors" and "normals" still view the vectors of that legacy
+    /// PointCloud, the legacy PointCloud itself is returned. Otherwise, e.g.
+    /// after an attribute was set or for PointClouds on CUDA, the attributes
+    /// are copied as in ToLegacyPointCloud(), since std::vector cannot adopt
+    /// the memory of a tensor.
+    std::shared_ptr<open3d::geometry::PointCloud> ToLegacyPointCloudView()
+            const;
+
 protected:
     core::Device device_ = core::Device("CPU:0");
     TensorMap point_attr_;
+    /// Legacy PointCloud viewed by the attributes, set by
+    /// FromLegacyPointCloudView(). Its lifetime is tied to the attributes.
+    std::weak_ptr<open3d::geometry::PointCloud> legacy_view_;
 };
 
 }  // namespace geometry
@@ -0,0 +1,768 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/RaycastingScene.h"
+
+#include <Eigen/Core>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <vector>
+
+#include "open3d/utility/Console.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+namespace {
+
+const core::Device kCPU("CPU:0");
+
+/// Returns a contiguous CPU tensor with the given dtype, avoiding copies when
+/// the tensor already satisfies these.
+core::Tensor ToContiguousCPU(const core::Tensor &tensor, core::Dtype dtype) {
+    core::Tensor result = tensor.To(dtype);
+    if (result.GetDevice() != kCPU) {
+        result = result.Copy(kCPU);
+    }
+    return result.Contiguous();
+}
+
+/// Returns the shape of the queries, i.e. \p shape without its last
+/// dimension, after checking that the last dimension is \p last_dim.
+core::SizeVector QueryShape(const core::Tensor &queries,
+                            int64_t last_dim,
+                            const std::string &name) {
+    core::SizeVector shape = queries.GetShape();
+    if (shape.empty() || shape.back() != last_dim) {
+        utility::LogError("{} must have the shape {{..., {}}}, but got {}.",
+                          name, last_dim, shape.ToString());
+    }
+    shape.pop_back();
+    return shape;
+}
+
+core::SizeVector AppendDim(core::SizeVector shape, int64_t dim) {
+    shape.push_back(dim);
+    return shape;
+}
+
+/// Closest point on the triangle (a, b, c) to p, from Ericson, "Real-Time
+/// Collision Detection", section 5.1.5.
+Eigen::Vector3f ClosestPointOnTriangle(const Eigen::Vector3f &p,
+                                       const Eigen::Vector3f &a,
+                                       const Eigen::Vector3f &b,
+                                       const Eigen::Vector3f &c) {
+    const Eigen::Vector3f ab = b - a;
+    const Eigen::Vector3f ac = c - a;
+    const Eigen::Vector3f ap = p - a;
+    const float d1 = ab.dot(ap);
+    const float d2 = ac.dot(ap);
+    if (d1 <= 0.f && d2 <= 0.f) return a;
+
+    const Eigen::Vector3f bp = p - b;
+    const float d3 = ab.dot(bp);
+    const float d4 = ac.dot(bp);
+    if (d3 >= 0.f && d4 <= d3) return b;
+
+    const float vc = d1 * d4 - d3 * d2;
+    if (vc <= 0.f && d1 >= 0.f && d3 <= 0.f) {
+        return a + ab * (d1 / (d1 - d3));
+    }
+
+    const Eigen::Vector3f cp = p - c;
+    const float d5 = ab.dot(cp);
+    const float d6 = ac.dot(cp);
+    if (d6 >= 0.f && d5 <= d6) return c;
+
+    const float vb = d5 * d2 - d1 * d6;
+    if (vb <= 0.f && d2 >= 0.f && d6 <= 0.f) {
+        return a + ac * (d2 / (d2 - d6));
+    }
+
+    const float va = d3 * d6 - d5 * d4;
+    if (va <= 0.f && (d4 - d3) >= 0.f && (d5 - d6) >= 0.f) {
+        return b + (c - b) * ((d4 - d3) / ((d4 - d3) + (d5 - d6)));
+    }
+
+    const float denom = 1.f / (va + vb + vc);
+    return a + ab * (vb * denom) + ac * (vc * denom);
+}
+
+}  // namespace
+
+struct RaycastingScene::Impl {
+    /// A BVH node. Inner nodes have count == 0 and their children at
+    /// first and first + 1; leaves reference the triangles
+    /// order_[first, first + count).
+    struct Node {
+        Eigen::Vector3f min;
+        Eigen::Vector3f max;
+        uint32_t first;
+        uint32_t count;
+    };
+
+    static constexpr uint32_t kMaxLeafSize = 4;
+    static constexpr int kNumBins = 16;
+    static constexpr int kStackSize = 64;
+
+    // Triangles of all geometries, in the order they were added.
+    std::vector<Eigen::Vector3f> v0_, v1_, v2_;
+    std::vector<int64_t> geometry_ids_;
+    std::vector<int64_t> primitive_ids_;
+    int64_t num_geometries_ = 0;
+
+    std::vector<Node> nodes_;
+    std::vector<uint32_t> order_;
+    bool dirty_ = true;
+
+    void Commit() {
+        if (dirty_) {
+            Build();
+            dirty_ = false;
+        }
+    }
+
+    void Build() {
+        const uint32_t num_triangles = uint32_t(v0_.size());
+        nodes_.clear();
+        order_.resize(num_triangles);
+        if (num_triangles == 0) {
+            return;
+        }
+
+        std::vector<Eigen::Vector3f> centroids(num_triangles);
+        std::vector<Eigen::Vector3f> tri_min(num_triangles);
+        std::vector<Eigen::Vector3f> tri_max(num_triangles);
+        for (uint32_t i = 0; i < num_triangles; ++i) {
+            order_[i] = i;
+            tri_min[i] = v0_[i].cwiseMin(v1_[i]).cwiseMin(v2_[i]);
+            tri_max[i] = v0_[i].cwiseMax(v1_[i]).cwiseMax(v2_[i]);
+            centroids[i] = (v0_[i] + v1_[i] + v2_[i]) / 3.f;
+        }
+
+        nodes_.reserve(2 * num_triangles);
+        nodes_.push_back({Eigen::Vector3f::Zero(), Eigen::Vector3f::Zero(), 0,
+                          num_triangles});
+        std::vector<uint32_t> stack = {0};
+        while (!stack.empty()) {
+            const uint32_t node_idx = stack.back();
+            stack.pop_back();
+            const uint32_t first = nodes_[node_idx].first;
+            const uint32_t count = nodes_[node_idx].count;
+
+            Eigen::Vector3f bmin = tri_min[order_[first]];
+            Eigen::Vector3f bmax = tri_max[order_[first]];
+            Eigen::Vector3f cmin = centroids[order_[first]];
+            Eigen::Vector3f cmax = cmin;
+            for (uint32_t i = first + 1; i < first + count; ++i) {
+                bmin = bmin.cwiseMin(tri_min[order_[i]]);
+                bmax = bmax.cwiseMax(tri_max[order_[i]]);
+                cmin = cmin.cwiseMin(centroids[order_[i]]);
+                cmax = cmax.cwiseMax(centroids[order_[i]]);
+            }
+            nodes_[node_idx].min = bmin;
+            nodes_[node_idx].max = bmax;
+            if (count <= kMaxLeafSize) {
+                continue;
+            }
+
+            uint32_t mid = SplitSAH(first, count, cmin, cmax, centroids,
+                                    tri_min, tri_max);
+            if (mid == first || mid == first + count) {
+                // All the centroids are in the same bin, split in the middle.
+                int axis;
+                (cmax - cmin).maxCoeff(&axis);
+                mid = first + count / 2;
+                std::nth_element(order_.begin() + first, order_.begin() + mid,
+                                 order_.begin() + first + count,
+                                 [&](uint32_t a, uint32_t b) {
+                                     return centroids[a][axis] <
+                                            centroids[b][axis];
+                                 });
+            }
+
+            const uint32_t left = uint32_t(nodes_.size());
+            nodes_.push_back({bmin, bmax, first, mid - first});
+            nodes_.push_back({bmin, bmax, mid, first + count - mid});
+            nodes_[node_idx].first = left;
+            nodes_[node_idx].count = 0;
+            stack.push_back(left);
+            stack.push_back(left + 1);
+        }
+    }
+
+    /// Partitions order_[first, first + count) by the binned surface area
+    /// heuristic and returns the index of the first triangle of the right
+    /// child.
+    uint32_t SplitSAH(uint32_t first,
+                      uint32_t count,
+                      const Eigen::Vector3f &cmin,
+                      const Eigen::Vector3f &cmax,
+                      const std::vector<Eigen::Vector3f> &centroids,
+                      const std::vector<Eigen::Vector3f> &tri_min,
+                      const std::vector<Eigen::Vector3f> &tri_max) {
+        struct Bin {
+            Eigen::Vector3f min = Eigen::Vector3f::Constant(
+                    std::numeric_limits<float>::max());
+            Eigen::Vector3f max = Eigen::Vector3f::Constant(
+                    std::numeric_limits<float>::lowest());
+            uint32_t count = 0;
+        };
+        auto Area = [](const Eigen::Vector3f &min, const Eigen::Vector3f &max) {
+            const Eigen::Vector3f e = (max - min).cwiseMax(0.f);
+            return e.x() * e.y() + e.y() * e.z() + e.z() * e.x();
+        };
+
+        float best_cost = std::numeric_limits<float>::max();
+        int best_axis = -1;
+        int best_split = 0;
+        for (int axis = 0; axis < 3; ++axis) {
+            const float extent = cmax[axis] - cmin[axis];
+            if (extent <= 0.f) {
+                continue;
+            }
+            const float scale = kNumBins / extent;
+            std::array<Bin, kNumBins> bins;
+            for (uint32_t i = first; i < first + count; ++i) {
+                const uint32_t t = order_[i];
+                int b = std::min(
+                        kNumBins - 1,
+                        int((centroids[t][axis] - cmin[axis]) * scale));
+                bins[b].min = bins[b].min.cwiseMin(tri_min[t]);
+                bins[b].max = bins[b].max.cwiseMax(tri_max[t]);
+                bins[b].count++;
+            }
+
+            // Sweep from the right to get the areas of the right children.
+            std::array<float, kNumBins> right_area;
+            std::array<uint32_t, kNumBins> right_count;
+            Bin acc;
+            for (int b = kNumBins - 1; b > 0; --b) {
+                acc.min = acc.min.cwiseMin(bins[b].min);
+                acc.max = acc.max.cwiseMax(bins[b].max);
+                acc.count += bins[b].count;
+                right_area[b] = Area(acc.min, acc.max);
+                right_count[b] = acc.count;
+            }
+            acc = Bin();
+            for (int b = 0; b < kNumBins - 1; ++b) {
+                acc.min = acc.min.cwiseMin(bins[b].min);
+                acc.max = acc.max.cwiseMax(bins[b].max);
+                acc.count += bins[b].count;
+                if (acc.count == 0 || right_count[b + 1] == 0) {
+                    continue;
+                }
+                const float cost = acc.count * Area(acc.min, acc.max) +
+                                   right_count[b + 1] * right_area[b + 1];
+                if (cost < best_cost) {
+                    best_cost = cost;
+                    best_axis = axis;
+                    best_split = b + 1;
+                }
+            }
+        }
+        if (best_axis < 0) {
+            return first;
+        }
+
+        const float scale = kNumBins / (cmax[best_axis] - cmin[best_axis]);
+        auto it = std::partition(
+                order_.begin() + first, order_.begin() + first + count,
+                [&](uint32_t t) {
+                    int b = std::min(kNumBins - 1,
+                                     int((centroids[t][best_axis] -
+                                          cmin[best_axis]) *
+                                         scale));
+                    return b < best_split;
+                });
+        return uint32_t(it - order_.begin());
+    }
+
+    /// Möller-Trumbore ray triangle intersection, for both faces.
+    bool IntersectTriangle(uint32_t tri,
+                           const Eigen::Vector3f &origin,
+                           const Eigen::Vector3f &direction,
+                           float tnear,
+                           float tfar,
+                           float &t,
+                           float &u,
+                           float &v) const {
+        const Eigen::Vector3f e1 = v1_[tri] - v0_[tri];
+        const Eigen::Vector3f e2 = v2_[tri] - v0_[tri];
+        const Eigen::Vector3f p = direction.cross(e2);
+        const float det = e1.dot(p);
+        if (det == 0.f) {
+            return false;
+        }
+        const float inv_det = 1.f / det;
+        const Eigen::Vector3f s = origin - v0_[tri];
+        u = s.dot(p) * inv_det;
+        if (u < 0.f || u > 1.f) {
+            return false;
+        }
+        const Eigen::Vector3f q = s.cross(e1);
+        v = direction.dot(q) * inv_det;
+        if (v < 0.f || u + v > 1.f) {
+            return false;
+        }
+        t = e2.dot(q) * inv_det;
+        return t >= tnear && t < tfar;
+    }
+
+    /// Returns the entry distance of the ray into the box of the node, or
+    /// inf if the ray misses the box within [tnear, tfar).
+    float IntersectBox(const Node &node,
+                       const Eigen::Vector3f &origin,
+                       const Eigen::Vector3f &inv_direction,
+                       float tnear,
+                       float tfar) const {
+        for (int i = 0; i < 3; ++i) {
+            float t0 = (node.min[i] - origin[i]) * inv_direction[i];
+            float t1 = (node.max[i] - origin[i]) * inv_direction[i];
+            if (t0 > t1) std::swap(t0, t1);
+            // The comparisons are written so that NaNs, from rays in the
+            // plane of a face, do not shrink the interval.
+            tnear = t0 > tnear ? t0 : tnear;
+            tfar = t1 < tfar ? t1 : tfar;
+        }
+        return tnear <= tfar ? tnear : std::numeric_limits<float>::infinity();
+    }
+
+    /// Visits the triangles of the leaves hit by the ray in [tnear, tfar),
+    /// nearest first. \p visit(tri, tfar) may shrink tfar and returns true to
+    /// stop the traversal.
+    template <typename F>
+    void TraverseRay(const Eigen::Vector3f &origin,
+                     const Eigen::Vector3f &direction,
+                     float tnear,
+                     float &tfar,
+                     F visit) const {
+        if (nodes_.empty()) {
+            return;
+        }
+        const Eigen::Vector3f inv_direction = direction.cwiseInverse();
+        if (IntersectBox(nodes_[0], origin, inv_direction, tnear, tfar) ==
+            std::numeric_limits<float>::infinity()) {
+            return;
+        }
+        uint32_t stack[kStackSize];
+        int size = 0;
+        stack[size++] = 0;
+        while (size > 0) {
+            const Node &node = nodes_[stack[--size]];
+            if (node.count > 0) {
+                for (uint32_t i = node.first; i < node.first + node.count;
+                     ++i) {
+                    if (visit(order_[i], tfar)) {
+                        return;
+                    }
+                }
+                continue;
+            }
+            const float t_left = IntersectBox(nodes_[node.first], origin,
+                                              inv_direction, tnear, tfar);
+            const float t_right = IntersectBox(nodes_[node.first + 1], origin,
+                                               inv_direction, tnear, tfar);
+            const float inf = std::numeric_limits<float>::infinity();
+            const bool hit_left = t_left != inf;
+            const bool hit_right = t_right != inf;
+            // Push the far child first to visit the near one first.
+            if (hit_left && hit_right) {
+                if (t_left <= t_right) {
+                    stack[size++] = node.first + 1;
+                    stack[size++] = node.first;
+                } else {
+                    stack[size++] = node.first;
+                    stack[size++] = node.first + 1;
+                }
+            } else if (hit_left) {
+                stack[size++] = node.first;
+            } else if (hit_right) {
+                stack[size++] = node.first + 1;
+            }
+        }
+    }
+
+    static float BoxDistanceSquared(const Node &node,
+                                    const Eigen::Vector3f &p) {
+        const Eigen::Vector3f d =
+                (node.min - p).cwiseMax(p - node.max).cwiseMax(0.f);
+        return d.squaredNorm();
+    }
+
+    /// Returns the triangle closest to \p p and sets \p closest to the
+    /// closest point on it, or returns INVALID_ID for an empty scene.
+    int64_t ClosestPoint(const Eigen::Vector3f &p,
+                         Eigen::Vector3f &closest) const {
+        int64_t best_tri = INVALID_ID;
+        if (nodes_.empty()) {
+            return best_tri;
+        }
+        float best_d2 = std::numeric_limits<float>::infinity();
+        uint32_t stack[kStackSize];
+        int size = 0;
+        stack[size++] = 0;
+        while (size > 0) {
+            const Node &node = nodes_[stack[--size]];
+            if (BoxDistanceSquared(node, p) >= best_d2) {
+                continue;
+            }
+            if (node.count > 0) {
+                for (uint32_t i = node.first; i < node.first + node.count;
+                     ++i) {
+                    const uint32_t tri = order_[i];
+                    const Eigen::Vector3f q = ClosestPointOnTriangle(
+                            p, v0_[tri], v1_[tri], v2_[tri]);
+                    const float d2 = (q - p).squaredNorm();
+                    if (d2 < best_d2) {
+                        best_d2 = d2;
+                        best_tri = tri;
+                        closest = q;
+                    }
+                }
+                continue;
+            }
+            const float d_left = BoxDistanceSquared(nodes_[node.first], p);
+            const float d_right = BoxDistanceSquared(nodes_[node.first + 1], p);
+            if (d_left <= d_right) {
+                stack[size++] = node.first + 1;
+                stack[size++] = node.first;
+            } else {
+                stack[size++] = node.first;
+                stack[size++] = node.first + 1;
+            }
+        }
+        return best_tri;
+    }
+};
+
+constexpr int64_t RaycastingScene::INVALID_ID;
+
+RaycastingScene::RaycastingScene() : impl_(new Impl()) {}
+
+RaycastingScene::~RaycastingScene() {}
+
+int64_t RaycastingScene::AddTriangles(const core::Tensor &vertices,
+                                      const core::Tensor &triangles) {
+    vertices.AssertShapeCompatible({utility::nullopt, 3});
+    triangles.AssertShapeCompatible({utility::nullopt, 3});
+    const core::Tensor vertices_cpu =
+            ToContiguousCPU(vertices, core::Dtype::Float32);
+    const core::Tensor triangles_cpu =
+            ToContiguousCPU(triangles, core::Dtype::Int64);
+    const float *v = static_cast<const float *>(vertices_cpu.GetDataPtr());
+    const int64_t *t =
+            static_cast<const int64_t *>(triangles_cpu.GetDataPtr());
+    const int64_t num_vertices = vertices_cpu.GetLength();
+    const int64_t num_triangles = triangles_cpu.GetLength();
+    if (int64_t(impl_->v0_.size()) + num_triangles >
+        int64_t(std::numeric_limits<uint32_t>::max())) {
+        utility::LogError("Too many triangles in the RaycastingScene.");
+    }
+
+    const int64_t geometry_id = impl_->num_geometries_++;
+    auto Vertex = [&](int64_t idx) {
+        if (idx < 0 || idx >= num_vertices) {
+            utility::LogError("Triangle vertex index {} out of range [0, {}).",
+                              idx, num_vertices);
+        }
+        return Eigen::Vector3f(v[3 * idx], v[3 * idx + 1], v[3 * idx + 2]);
+    };
+    for (int64_t i = 0; i < num_triangles; ++i) {
+        impl_->v0_.push_back(Vertex(t[3 * i]));
+        impl_->v1_.push_back(Vertex(t[3 * i + 1]));
+        impl_->v2_.push_back(Vertex(t[3 * i + 2]));
+        impl_->geometry_ids_.push_back(geometry_id);
+        impl_->primitive_ids_.push_back(i);
+    }
+    impl_->dirty_ = true;
+    return geometry_id;
+}
+
+int64_t RaycastingScene::AddTriangles(const TriangleMesh &mesh) {
+    return AddTriangles(mesh.GetVertices(), mesh.GetTriangles());
+}
+
+int64_t RaycastingScene::GetNumGeometries() const {
+    return impl_->num_geometries_;
+}
+
+int64_t RaycastingScene::GetNumTriangles() const {
+    return int64_t(impl_->v0_.size());
+}
+
+std::unordered_map<std::string, core::Tensor> RaycastingScene::CastRays(
+        const core::Tensor &rays) {
+    const core::SizeVector shape = QueryShape(rays, 6, "rays");
+    const core::Tensor rays_cpu = ToContiguousCPU(rays, core::Dtype::Float32);
+    impl_->Commit();
+
+    core::Tensor t_hit = core::Tensor::Empty(shape, core::Dtype::Float32);
+    core::Tensor geometry_ids = core::Tensor::Empty(shape, core::Dtype::Int64);
+    core::Tensor primitive_ids =
+            core::Tensor::Empty(shape, core::Dtype::Int64);
+    core::Tensor primitive_uvs =
+            core::Tensor::Empty(AppendDim(shape, 2), core::Dtype::Float32);
+    core::Tensor primitive_normals =
+            core::Tensor::Empty(AppendDim(shape, 3), core::Dtype::Float32);
+
+    const float *ray_ptr = static_cast<const float *>(rays_cpu.GetDataPtr());
+    float *t_hit_ptr = static_cast<float *>(t_hit.GetDataPtr());
+    int64_t *geometry_ids_ptr =
+            static_cast<int64_t *>(geometry_ids.GetDataPtr());
+    int64_t *primitive_ids_ptr =
+            static_cast<int64_t *>(primitive_ids.GetDataPtr());
+    float *uvs_ptr = static_cast<float *>(primitive_uvs.GetDataPtr());
+    float *normals_ptr = static_cast<float *>(primitive_normals.GetDataPtr());
+
+    const Impl &impl = *impl_;
+    const int64_t num_rays = shape.NumElements();
+#pragma omp parallel for schedule(dynamic, 64) num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < num_rays; ++i) {
+        const Eigen::Map<const Eigen::Vector3f> origin(ray_ptr + 6 * i);
+        const Eigen::Map<const Eigen::Vector3f> direction(ray_ptr + 6 * i + 3);
+        float tfar = std::numeric_limits<float>::infinity();
+        int64_t hit_tri = INVALID_ID;
+        float hit_u = 0.f, hit_v = 0.f;
+        impl.TraverseRay(origin, direction, 0.f, tfar,
+                         [&](uint32_t tri, float &tfar_) {
+                             float t, u, v;
+                             if (impl.IntersectTriangle(tri, origin, direction,
+                                                        0.f, tfar_, t, u, v)) {
+                                 tfar_ = t;
+                                 hit_tri = tri;
+                                 hit_u = u;
+                                 hit_v = v;
+                             }
+                             return false;
+                         });
+
+        t_hit_ptr[i] = tfar;
+        uvs_ptr[2 * i] = hit_u;
+        uvs_ptr[2 * i + 1] = hit_v;
+        Eigen::Map<Eigen::Vector3f> normal(normals_ptr + 3 * i);
+        if (hit_tri == INVALID_ID) {
+            geometry_ids_ptr[i] = INVALID_ID;
+            primitive_ids_ptr[i] = INVALID_ID;
+            normal.setZero();
+        } else {
+            geometry_ids_ptr[i] = impl.geometry_ids_[hit_tri];
+            primitive_ids_ptr[i] = impl.primitive_ids_[hit_tri];
+            normal = (impl.v1_[hit_tri] - impl.v0_[hit_tri])
+                             .cross(impl.v2_[hit_tri] - impl.v0_[hit_tri])
+                             .normalized();
+        }
+    }
+
+    return {{"t_hit", t_hit},
+            {"geometry_ids", geometry_ids},
+            {"primitive_ids", primitive_ids},
+            {"primitive_uvs", primitive_uvs},
+            {"primitive_normals", primitive_normals}};
+}
+
+core::Tensor RaycastingScene::TestOcclusions(const core::Tensor &rays,
+                                             float tnear,
+                                             float tfar) {
+    const core::SizeVector shape = QueryShape(rays, 6, "rays");
+    const core::Tensor rays_cpu = ToContiguousCPU(rays, core::Dtype::Float32);
+    impl_->Commit();
+
+    core::Tensor occluded = core::Tensor::Empty(shape, core::Dtype::Bool);
+    const float *ray_ptr = static_cast<const float *>(rays_cpu.GetDataPtr());
+    bool *occluded_ptr = static_cast<bool *>(occluded.GetDataPtr());
+
+    const Impl &impl = *impl_;
+    const int64_t num_rays = shape.NumElements();
+#pragma omp parallel for schedule(dynamic, 64) num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < num_rays; ++i) {
+        const Eigen::Map<const Eigen::Vector3f> origin(ray_ptr + 6 * i);
+        const Eigen::Map<const Eigen::Vector3f> direction(ray_ptr + 6 * i + 3);
+        float ray_tfar = tfar;
+        bool hit = false;
+        impl.TraverseRay(origin, direction, tnear, ray_tfar,
+                         [&](uint32_t tri, float &tfar_) {
+                             float t, u, v;
+                             hit = impl.IntersectTriangle(tri, origin,
+                                                          direction, tnear,
+                                                          tfar_, t, u, v);
+                             return hit;
+                         });
+        occluded_ptr[i] = hit;
+    }
+    return occluded;
+}
+
+core::Tensor RaycastingScene::CountIntersections(const core::Tensor &rays) {
+    const core::SizeVector shape = QueryShape(rays, 6, "rays");
+    const core::Tensor rays_cpu = ToContiguousCPU(rays, core::Dtype::Float32);
+    impl_->Commit();
+
+    core::Tensor counts = core::Tensor::Empty(shape, core::Dtype::Int32);
+    const float *ray_ptr = static_cast<const float *>(rays_cpu.GetDataPtr());
+    int32_t *counts_ptr = static_cast<int32_t *>(counts.GetDataPtr());
+
+    const Impl &impl = *impl_;
+    const int64_t num_rays = shape.NumElements();
+#pragma omp parallel for schedule(dynamic, 64) num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < num_rays; ++i) {
+        const Eigen::Map<const Eigen::Vector3f> origin(ray_ptr + 6 * i);
+        const Eigen::Map<const Eigen::Vector3f> direction(ray_ptr + 6 * i + 3);
+        float tfar = std::numeric_limits<float>::infinity();
+        int32_t count = 0;
+        impl.TraverseRay(origin, direction, 0.f, tfar,
+                         [&](uint32_t tri, float &tfar_) {
+                             float t, u, v;
+                             if (impl.IntersectTriangle(tri, origin, direction,
+                                                        0.f, tfar_, t, u, v)) {
+                                 ++count;
+                             }
+                             return false;
+                         });
+        counts_ptr[i] = count;
+    }
+    return counts;
+}
+
+std::unordered_map<std::string, core::Tensor>
+RaycastingScene::ComputeClosestPoints(const core::Tensor &query_points) {
+    const core::SizeVector shape =
+            QueryShape(query_points, 3, "query_points");
+    const core::Tensor points_cpu =
+            ToContiguousCPU(query_points, core::Dtype::Float32);
+    impl_->Commit();
+
+    core::Tensor points =
+            core::Tensor::Empty(AppendDim(shape, 3), core::Dtype::Float32);
+    core::Tensor geometry_ids = core::Tensor::Empty(shape, core::Dtype::Int64);
+    core::Tensor primitive_ids =
+            core::Tensor::Empty(shape, core::Dtype::Int64);
+
+    const float *query_ptr =
+            static_cast<const float *>(points_cpu.GetDataPtr());
+    float *points_ptr = static_cast<float *>(points.GetDataPtr());
+    int64_t *geometry_ids_ptr =
+            static_cast<int64_t *>(geometry_ids.GetDataPtr());
+    int64_t *primitive_ids_ptr =
+            static_cast<int64_t *>(primitive_ids.GetDataPtr());
+
+    const Impl &impl = *impl_;
+    const int64_t num_points = shape.NumElements();
+#pragma omp parallel for schedule(dynamic, 64) num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < num_points; ++i) {
+        const Eigen::Map<const Eigen::Vector3f> p(query_ptr + 3 * i);
+        Eigen::Map<Eigen::Vector3f> closest(points_ptr + 3 * i);
+        Eigen::Vector3f q = Eigen::Vector3f::Zero();
+        const int64_t tri = impl.ClosestPoint(p, q);
+        closest = q;
+        if (tri == INVALID_ID) {
+            geometry_ids_ptr[i] = INVALID_ID;
+            primitive_ids_ptr[i] = INVALID_ID;
+        } else {
+            geometry_ids_ptr[i] = impl.geometry_ids_[tri];
+            primitive_ids_ptr[i] = impl.primitive_ids_[tri];
+        }
+    }
+
+    return {{"points", points},
+            {"geometry_ids", geometry_ids},
+            {"primitive_ids", primitive_ids}};
+}
+
+core::Tensor RaycastingScene::ComputeDistance(
+        const core::Tensor &query_points) {
+    const core::SizeVector shape =
+            QueryShape(query_points, 3, "query_points");
+    const core::Tensor points_cpu =
+            ToContiguousCPU(query_points, core::Dtype::Float32);
+    impl_->Commit();
+
+    core::Tensor distances = core::Tensor::Empty(shape, core::Dtype::Float32);
+    const float *query_ptr =
+            static_cast<const float *>(points_cpu.GetDataPtr());
+    float *distances_ptr = static_cast<float *>(distances.GetDataPtr());
+
+    const Impl &impl = *impl_;
+    const int64_t num_points = shape.NumElements();
+#pragma omp parallel for schedule(dynamic, 64) num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < num_points; ++i) {
+        const Eigen::Map<const Eigen::Vector3f> p(query_ptr + 3 * i);
+        Eigen::Vector3f q;
+        if (impl.ClosestPoint(p, q) == INVALID_ID) {
+            distances_ptr[i] = std::numeric_limits<float>::infinity();
+        } else {
+            distances_ptr[i] = (q - p).norm();
+        }
+    }
+    return distances;
+}
+
+core::Tensor RaycastingScene::CreateRaysPinhole(
+        const core::Tensor &intrinsic_matrix,
+        const core::Tensor &extrinsic_matrix,
+        int64_t width_px,
+        int64_t height_px) {
+    intrinsic_matrix.AssertShape({3, 3});
+    extrinsic_matrix.AssertShape({4, 4});
+    const core::Tensor intrinsic_cpu =
+            ToContiguousCPU(intrinsic_matrix, core::Dtype::Float64);
+    const core::Tensor extrinsic_cpu =
+            ToContiguousCPU(extrinsic_matrix, core::Dtype::Float64);
+    const Eigen::Matrix3d K = Eigen::Map<
+            const Eigen::Matrix<double, 3, 3, Eigen::RowMajor>>(
+            static_cast<const double *>(intrinsic_cpu.GetDataPtr()));
+    const Eigen::Matrix4d T = Eigen::Map<
+            const Eigen::Matrix<double, 4, 4, Eigen::RowMajor>>(
+            static_cast<const double *>(extrinsic_cpu.GetDataPtr()));
+
+    // Camera to world rotation and the camera center in world coordinates.
+    const Eigen::Matrix3d R_inv = T.block<3, 3>(0, 0).transpose();
+    const Eigen::Vector3f center =
+            (-R_inv * T.block<3, 1>(0, 3)).cast<float>();
+    const Eigen::Matrix3f M = (R_inv * K.inverse()).cast<float>();
+
+    core::Tensor rays = core::Tensor::Empty({height_px, width_px, 6},
+                                            core::Dtype::Float32);
+    float *rays_ptr = static_cast<float *>(rays.GetDataPtr());
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int64_t v = 0; v < height_px; ++v) {
+        for (int64_t u = 0; u < width_px; ++u) {
+            float *ray = rays_ptr + 6 * (v * width_px + u);
+            Eigen::Map<Eigen::Vector3f> origin(ray);
+            Eigen::Map<Eigen::Vector3f> direction(ray + 3);
+            origin = center;
+            direction = M * Eigen::Vector3f(float(u), float(v), 1.f);
+        }
+    }
+    return rays;
+}
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,156 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <limits>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/TriangleMesh.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+/// \class RaycastingScene
+/// \brief A scene of triangle meshes for ray and closest point queries.
+///
+/// The scene builds a bounding volume hierarchy (BVH) over the triangles of
+/// all added geometries, on the CPU and without a rendering context. The BVH
+/// is built lazily by the first query after the geometries changed. Queries
+/// accept tensors on any device; the tensors are copied to the CPU and the
+/// results are returned on the CPU. The queries are parallelized with OpenMP.
+///
+/// Rays are Float32 tensors of shape {..., 6}, where the last dimension is
+/// [ox, oy, oz, dx, dy, dz] with the origin and the direction of the ray. The
+/// directions do not need to be normalized, and the hit distances are
+/// expressed in multiples of the direction length.
+class RaycastingScene {
+public:
+    /// The ID of the missed geometries and primitives.
+    static constexpr int64_t INVALID_ID = -1;
+
+    RaycastingScene();
+    ~RaycastingScene();
+
+    /// \brief Adds triangles to the scene.
+    ///
+    /// \param vertices Vertices of shape {n, 3}, Float32 or Float64.
+    /// \param triangles Int32 or Int64 vertex indices of shape {m, 3}.
+    /// \return The ID of the added geometry.
+    int64_t AddTriangles(const core::Tensor &vertices,
+                         const core::Tensor &triangles);
+
+    /// \brief Adds the triangles of a mesh to the scene.
+    ///
+    /// \return The ID of the added geometry.
+    int64_t AddTriangles(const TriangleMesh &mesh);
+
+    /// Returns the number of geometries in the scene.
+    int64_t GetNumGeometries() const;
+
+    /// Returns the total number of triangles in the scene.
+    int64_t GetNumTriangles() const;
+
+    /// \brief Computes the first intersection of the rays with the scene.
+    ///
+    /// \param rays Float32 rays of shape {..., 6}.
+    /// \return A map with the following tensors, where {...} is the shape of
+    /// the rays without the last dimension:
+    /// - "t_hit": Float32 {...}, the distance to the hit, inf for the misses.
+    /// - "geometry_ids": Int64 {...}, the ID of the hit geometry.
+    /// - "primitive_ids": Int64 {...}, the index of the hit triangle in its
+    /// geometry.
+    /// - "primitive_uvs": Float32 {..., 2}, the barycentric coordinates of
+    /// the hit in the triangle.
+    /// - "primitive_normals": Float32 {..., 3}, the unit normal of the hit
+    /// triangle, following the winding order of its vertices.
+    /// The IDs are INVALID_ID and the other values are zero for the misses.
+    std::unordered_map<std::string, core::Tensor> CastRays(
+            const core::Tensor &rays);
+
+    /// \brief Tests whether the rays hit the scene in [tnear, tfar).
+    ///
+    /// This is cheaper than CastRays() since the traversal stops at the
+    /// first hit found.
+    /// \param rays Float32 rays of shape {..., 6}.
+    /// \return A Bool tensor of shape {...}.
+    core::Tensor TestOcclusions(
+            const core::Tensor &rays,
+            float tnear = 0.f,
+            float tfar = std::numeric_limits<float>::infinity());
+
+    /// \brief Counts the intersections of the rays with the scene.
+    ///
+    /// For closed meshes an odd count means that the ray origin is inside.
+    /// \param rays Float32 rays of shape {..., 6}.
+    /// \return An Int32 tensor of shape {...}.
+    core::Tensor CountIntersections(const core::Tensor &rays);
+
+    /// \brief Computes the closest points on the surfaces of the scene.
+    ///
+    /// \param query_points Float32 points of shape {..., 3}.
+    /// \return A map with the following tensors, where {...} is the shape of
+    /// the query points without the last dimension:
+    /// - "points": Float32 {..., 3}, the closest points.
+    /// - "geometry_ids": Int64 {...}, the ID of the closest geometry.
+    /// - "primitive_ids": Int64 {...}, the index of the closest triangle in
+    /// its geometry.
+    std::unordered_map<std::string, core::Tensor> ComputeClosestPoints(
+            const core::Tensor &query_points);
+
+    /// \brief Computes the distances to the surfaces of the scene.
+    ///
+    /// \param query_points Float32 points of shape {..., 3}.
+    /// \return A Float32 tensor of shape {...}.
+    core::Tensor ComputeDistance(const core::Tensor &query_points);
+
+    /// \brief Creates the rays of a pinhole camera.
+    ///
+    /// The rays start at the camera center and go through the pixels. The
+    /// directions have a unit z in the camera frame, hence "t_hit" of the
+    /// cast rays is the depth of the hits.
+    /// \param intrinsic_matrix The 3x3 intrinsic matrix.
+    /// \param extrinsic_matrix The 4x4 world to camera transformation.
+    /// \param width_px The width of the image in pixels.
+    /// \param height_px The height of the image in pixels.
+    /// \return A Float32 tensor of shape {height_px, width_px, 6}.
+    static core::Tensor CreateRaysPinhole(const core::Tensor &intrinsic_matrix,
+                                          const core::Tensor &extrinsic_matrix,
+                                          int64_t width_px,
+                                          int64_t height_px);
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
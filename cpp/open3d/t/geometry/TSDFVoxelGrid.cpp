@@ -30,11 +30,28 @@
 #include "open3d/t/geometry/PointCloud.h"
 #include "open3d/t/geometry/kernel/TSDFVoxelGrid.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/Trace.h"
 
 namespace open3d {
 namespace t {
 namespace geometry {
 
+namespace {
+// Concatenate two tensors of the same dtype along the first dimension.
+core::Tensor ConcatRows(const core::Tensor &a, const core::Tensor &b) {
+    if (a.GetLength() == 0) return b;
+    if (b.GetLength() == 0) return a;
+
+    int64_t n = a.GetLength();
+    core::SizeVector shape = a.GetShape();
+    shape[0] = n + b.GetLength();
+    core::Tensor combined(shape, a.GetDtype(), a.GetDevice());
+    combined.Slice(0, 0, n) = a;
+    combined.Slice(0, n, shape[0]) = b;
+    return combined;
+}
+}  // namespace
+
 TSDFVoxelGrid::TSDFVoxelGrid(
         std::unordered_map<std::string, core::Dtype> attr_dtype_map,
         float voxel_size,
@@ -58,7 +75,7 @@ TSDFVoxelGrid::TSDFVoxelGrid(
     int64_t total_bytes = 0;
     if (attr_dtype_map_.count("tsdf") != 0) {
         core::Dtype dtype = attr_dtype_map_.at("tsdf");
-        if (dtype != core::Dtype::Float32) {
+        if (dtype != core::Dtype::Float32 && dtype != core::Dtype::Int16) {
             utility::LogWarning(
                     "[TSDFVoxelGrid] unexpected TSDF dtype, please "
                     "implement your own Voxel structure in "
@@ -81,7 +98,8 @@ TSDFVoxelGrid::TSDFVoxelGrid(
 
     if (attr_dtype_map_.count("color") != 0) {
         core::Dtype dtype = attr_dtype_map_.at("color");
-        if (dtype != core::Dtype::Float32 && dtype != core::Dtype::UInt16) {
+        if (dtype != core::Dtype::Float32 && dtype != core::Dtype::UInt16 &&
+            dtype != core::Dtype::UInt8) {
             utility::LogWarning(
                     "[TSDFVoxelGrid] unexpected color dtype, please "
                     "implement your own Voxel structure in "
@@ -105,6 +123,8 @@ TSDFVoxelGrid::TSDFVoxelGrid(
             core::SizeVector{block_resolution_, block_resolution_,
                              block_resolution_, total_bytes},
             device);
+    dirty_block_mask_ = core::Tensor::Zeros({block_hashmap_->GetCapacity()},
+                                            core::Dtype::Bool, device);
 }
 
 void TSDFVoxelGrid::Integrate(const Image &depth,
@@ -123,6 +143,7 @@ void TSDFVoxelGrid::Integrate(const Image &depth,
                               const core::Tensor &extrinsics,
                               float depth_scale,
                               float depth_max) {
+    OPEN3D_TRACE_SCOPE("t::TSDF::Integrate");
     if (depth.IsEmpty()) {
         utility::LogError(
                 "[TSDFVoxelGrid] input depth is empty for integration.");
@@ -136,12 +157,21 @@ void TSDFVoxelGrid::Integrate(const Image &depth,
     core::Tensor block_coords;
     kernel::tsdf::Touch(pcd.GetPoints().Contiguous(), block_coords,
                         block_resolution_, voxel_size_, sdf_trunc_);
+    block_coords = SelectPartitionBlocks(block_coords);
+    if (num_partitions_ > 1 && block_coords.GetLength() == 0) {
+        return;
+    }
 
-    // Active voxel blocks in the block hashmap.
+    // Bring back the touched blocks that were streamed out before activation,
+    // so that they are updated instead of being allocated again.
+    StreamInBlocks(block_coords);
+
+    // Activate voxel blocks in the block hashmap, and collect all the blocks in
+    // the viewing frustum, including those activated in previous launches.
     core::Tensor addrs, masks;
     int64_t n = block_hashmap_->Size();
     try {
-        block_hashmap_->Activate(block_coords, addrs, masks);
+        block_hashmap_->InsertOrFind(block_coords, addrs, masks);
     } catch (const std::runtime_error &) {
         utility::LogError(
                 "[TSDFIntegrate] Unable to allocate volume during rehashing. "
@@ -152,11 +182,6 @@ void TSDFVoxelGrid::Integrate(const Image &depth,
                 n, voxel_size_);
     }
 
-    // Collect voxel blocks in the viewing frustum. Note we cannot directly
-    // reuse addrs from Activate, since some blocks might have been activated in
-    // previous launches and return false.
-    block_hashmap_->Find(block_coords, addrs, masks);
-
     core::Tensor depth_tensor = depth.AsTensor().Contiguous();
     core::Tensor color_tensor;
     if (color.IsEmpty()) {
@@ -179,29 +204,229 @@ void TSDFVoxelGrid::Integrate(const Image &depth,
                 "shape.");
     }
 
+    // Skip the blocks that no voxel update can reach, i.e. outside the view
+    // frustum or beyond the truncation band after depth_max.
+    core::Tensor block_indices = addrs.To(core::Dtype::Int64);
+    core::Tensor visible_mask;
+    kernel::tsdf::CullBlocks(block_indices, block_hashmap_->GetKeyTensor(),
+                             visible_mask, intrinsics, extrinsics,
+                             depth.GetRows(), depth.GetCols(),
+                             block_resolution_, voxel_size_, sdf_trunc_,
+                             depth_max);
+    block_indices = block_indices.IndexGet({visible_mask});
+    utility::LogDebug("[TSDFIntegrate] {} integrated blocks out of {} touched.",
+                      block_indices.GetLength(), visible_mask.GetLength());
+
     core::Tensor dst = block_hashmap_->GetValueTensor();
-    kernel::tsdf::Integrate(depth_tensor, color_tensor,
-                            addrs.To(core::Dtype::Int64).IndexGet({masks}),
+    kernel::tsdf::Integrate(depth_tensor, color_tensor, block_indices,
                             block_hashmap_->GetKeyTensor(), dst, intrinsics,
                             extrinsics, block_resolution_, voxel_size_,
                             sdf_trunc_, depth_scale, depth_max);
+    MarkDirtyBlocks(block_indices);
+
+    if (max_device_blocks_ > 0 && block_hashmap_->Size() > max_device_blocks_) {
+        int64_t n_out = StreamOutInvisibleBlocks(intrinsics, extrinsics,
+                                                 depth.GetCols(),
+                                                 depth.GetRows(), depth_max);
+        utility::LogDebug(
+                "[TSDFIntegrate] streamed out {} blocks, {} blocks left on "
+                "device.",
+                n_out, block_hashmap_->Size());
+    }
+}
+
+void TSDFVoxelGrid::IntegrateBatch(const std::vector<Image> &depths,
+                                   const std::vector<Image> &colors,
+                                   const std::vector<core::Tensor> &intrinsics,
+                                   const std::vector<core::Tensor> &extrinsics,
+                                   float depth_scale,
+                                   float depth_max) {
+    OPEN3D_TRACE_SCOPE("t::TSDF::IntegrateBatch");
+    int64_t num_frames = static_cast<int64_t>(depths.size());
+    if (num_frames == 0) {
+        utility::LogError("[TSDFVoxelGrid] no depth image for integration.");
+    }
+    if (int64_t(extrinsics.size()) != num_frames ||
+        (intrinsics.size() != 1 && int64_t(intrinsics.size()) != num_frames)) {
+        utility::LogError(
+                "[TSDFVoxelGrid] expected {} extrinsics and 1 or {} "
+                "intrinsics, but got {} and {}.",
+                num_frames, num_frames, extrinsics.size(), intrinsics.size());
+    }
+    int64_t rows = depths[0].GetRows();
+    int64_t cols = depths[0].GetCols();
+    for (const Image &depth : depths) {
+        if (depth.IsEmpty()) {
+            utility::LogError(
+                    "[TSDFVoxelGrid] input depth is empty for integration.");
+        }
+        if (depth.GetRows() != rows || depth.GetCols() != cols) {
+            utility::LogError(
+                    "[TSDFVoxelGrid] depth images of a batch must share the "
+                    "same size.");
+        }
+    }
+
+    bool integrate_color = !colors.empty();
+    if (integrate_color && int64_t(colors.size()) != num_frames) {
+        utility::LogError("[TSDFVoxelGrid] expected {} color images, got {}.",
+                          num_frames, colors.size());
+    }
+    for (const Image &color : colors) {
+        if (color.GetRows() != rows || color.GetCols() != cols ||
+            color.GetChannels() != 3) {
+            utility::LogWarning(
+                    "[TSDFIntegrate] color images are ignored for the "
+                    "incompatible shape.");
+            integrate_color = false;
+            break;
+        }
+    }
+    if (integrate_color && attr_dtype_map_.count("color") == 0) {
+        utility::LogWarning(
+                "[TSDFIntegrate] color images are ignored since voxels do not "
+                "contain colors.");
+        integrate_color = false;
+    }
+
+    // Stack the frames, and touch the union of the blocks seen by any of
+    // them from low-resolution point clouds.
+    core::Tensor depth_tensor({num_frames, rows, cols, 1}, core::Dtype::Float32,
+                              device_);
+    core::Tensor color_tensor;
+    if (integrate_color) {
+        color_tensor = core::Tensor({num_frames, rows, cols, 3},
+                                    core::Dtype::Float32, device_);
+    }
+    core::Tensor intrinsics_tensor({num_frames, 3, 3}, core::Dtype::Float32,
+                                   device_);
+    core::Tensor extrinsics_tensor({num_frames, 4, 4}, core::Dtype::Float32,
+                                   device_);
+    core::Tensor points;
+    for (int64_t k = 0; k < num_frames; ++k) {
+        const core::Tensor &intrinsic =
+                intrinsics[intrinsics.size() == 1 ? 0 : k];
+        depth_tensor[k].AsRvalue() =
+                depths[k].AsTensor().To(core::Dtype::Float32);
+        if (integrate_color) {
+            color_tensor[k].AsRvalue() =
+                    colors[k].AsTensor().To(core::Dtype::Float32);
+        }
+        intrinsics_tensor[k].AsRvalue() = intrinsic.To(core::Dtype::Float32);
+        extrinsics_tensor[k].AsRvalue() =
+                extrinsics[k].To(core::Dtype::Float32);
+
+        PointCloud pcd = PointCloud::CreateFromDepthImage(
+                depths[k], intrinsic, extrinsics[k], depth_scale, depth_max,
+                4);
+        points = ConcatRows(points, pcd.GetPoints().Contiguous());
+    }
+
+    core::Tensor block_coords;
+    kernel::tsdf::Touch(points, block_coords, block_resolution_, voxel_size_,
+                        sdf_trunc_);
+    block_coords = SelectPartitionBlocks(block_coords);
+    if (num_partitions_ > 1 && block_coords.GetLength() == 0) {
+        return;
+    }
+
+    // Bring back the touched blocks that were streamed out before activation,
+    // so that they are updated instead of being allocated again.
+    StreamInBlocks(block_coords);
+
+    core::Tensor addrs, masks;
+    int64_t n = block_hashmap_->Size();
+    try {
+        block_hashmap_->InsertOrFind(block_coords, addrs, masks);
+    } catch (const std::runtime_error &) {
+        utility::LogError(
+                "[TSDFIntegrate] Unable to allocate volume during rehashing. "
+                "Consider using a "
+                "larger block_count at initialization to avoid rehashing "
+                "(currently {}), or choosing a larger voxel_size "
+                "(currently {})",
+                n, voxel_size_);
+    }
+
+    // Keep the blocks that at least one frame can update.
+    core::Tensor block_indices = addrs.To(core::Dtype::Int64);
+    core::Tensor visible_mask = CullBlocksBatch(
+            block_indices, intrinsics_tensor, extrinsics_tensor, rows, cols,
+            depth_max);
+    block_indices = block_indices.IndexGet({visible_mask});
+    utility::LogDebug(
+            "[TSDFIntegrate] {} integrated blocks out of {} touched by {} "
+            "frames.",
+            block_indices.GetLength(), visible_mask.GetLength(), num_frames);
+
+    core::Tensor dst = block_hashmap_->GetValueTensor();
+    kernel::tsdf::IntegrateBatch(depth_tensor, color_tensor, block_indices,
+                                 block_hashmap_->GetKeyTensor(), dst,
+                                 intrinsics_tensor, extrinsics_tensor,
+                                 block_resolution_, voxel_size_, sdf_trunc_,
+                                 depth_scale, depth_max);
+    MarkDirtyBlocks(block_indices);
+
+    // Only the blocks that none of the frames can update are streamed out.
+    if (max_device_blocks_ > 0 && block_hashmap_->Size() > max_device_blocks_) {
+        core::Tensor active_addrs;
+        block_hashmap_->GetActiveIndices(active_addrs);
+        core::Tensor active_indices = active_addrs.To(core::Dtype::Int64);
+        core::Tensor active_visible_mask =
+                CullBlocksBatch(active_indices, intrinsics_tensor,
+                                extrinsics_tensor, rows, cols, depth_max);
+        core::Tensor invisible_indices =
+                active_indices.IndexGet({active_visible_mask.LogicalNot()});
+        StreamOutBlocks(invisible_indices);
+        utility::LogDebug(
+                "[TSDFIntegrate] streamed out {} blocks, {} blocks left on "
+                "device.",
+                invisible_indices.GetLength(), block_hashmap_->Size());
+    }
+}
+
+std::unordered_map<std::string, core::Tensor> TSDFVoxelGrid::RayCast(
+        const core::Tensor &intrinsics,
+        const core::Tensor &extrinsics,
+        int width,
+        int height,
+        float depth_min,
+        float depth_max) {
+    OPEN3D_TRACE_SCOPE("t::TSDF::RayCast");
+    core::Tensor active_addrs;
+    block_hashmap_->GetActiveIndices(active_addrs);
+
+    core::Tensor vertex_map, depth_map, normal_map, color_map;
+    kernel::tsdf::RayCast(active_addrs.To(core::Dtype::Int64),
+                          block_hashmap_->GetKeyTensor(),
+                          block_hashmap_->GetValueTensor(), vertex_map,
+                          depth_map, normal_map, color_map, intrinsics,
+                          extrinsics, height, width, block_resolution_,
+                          voxel_size_, sdf_trunc_, depth_min, depth_max);
+
+    std::unordered_map<std::string, core::Tensor> result{
+            {"vertex", vertex_map},
+            {"depth", depth_map},
+            {"normal", normal_map}};
+    if (color_map.NumElements() != 0) {
+        result.emplace("color", color_map);
+    }
+    return result;
 }
 
 PointCloud TSDFVoxelGrid::ExtractSurfacePoints() {
-    // Extract active voxel blocks from the hashmap.
+    OPEN3D_TRACE_SCOPE("t::TSDF::ExtractSurfacePoints");
+    // Extract active voxel blocks from the hashmap. Their neighbors are looked
+    // up on the fly in the kernel.
     core::Tensor active_addrs;
     block_hashmap_->GetActiveIndices(active_addrs);
-    core::Tensor active_nb_addrs, active_nb_masks;
-    std::tie(active_nb_addrs, active_nb_masks) =
-            BufferRadiusNeighbors(active_addrs);
 
     // Extract points around zero-crossings.
     core::Tensor points, normals, colors;
     kernel::tsdf::ExtractSurfacePoints(
-            active_addrs.To(core::Dtype::Int64),
-            active_nb_addrs.To(core::Dtype::Int64), active_nb_masks,
-            block_hashmap_->GetKeyTensor(), block_hashmap_->GetValueTensor(),
-            points, normals, colors, block_resolution_, voxel_size_);
+            active_addrs.To(core::Dtype::Int64), block_hashmap_->GetKeyTensor(),
+            block_hashmap_->GetValueTensor(), points, normals, colors,
+            block_resolution_, voxel_size_);
     auto pcd = PointCloud(points);
     pcd.SetPointNormals(normals);
     if (colors.NumElements() != 0) {
@@ -212,30 +437,17 @@ PointCloud TSDFVoxelGrid::ExtractSurfacePoints() {
 }
 
 TriangleMesh TSDFVoxelGrid::ExtractSurfaceMesh() {
-    // Query active blocks and their nearest neighbors to handle boundary cases.
+    OPEN3D_TRACE_SCOPE("t::TSDF::ExtractSurfaceMesh");
+    // Query active blocks. Their neighbors are looked up on the fly in the
+    // kernel to handle boundary cases.
     core::Tensor active_addrs;
     block_hashmap_->GetActiveIndices(active_addrs);
-    core::Tensor active_nb_addrs, active_nb_masks;
-    std::tie(active_nb_addrs, active_nb_masks) =
-            BufferRadiusNeighbors(active_addrs);
-
-    // Map active indices to [0, num_blocks] to be allocated for surface mesh.
-    int64_t num_blocks = block_hashmap_->Size();
-    core::Tensor inverse_index_map({block_hashmap_->GetCapacity()},
-                                   core::Dtype::Int64, device_);
-    std::vector<int64_t> iota_map(num_blocks);
-    std::iota(iota_map.begin(), iota_map.end(), 0);
-    inverse_index_map.IndexSet(
-            {active_addrs.To(core::Dtype::Int64)},
-            core::Tensor(iota_map, {num_blocks}, core::Dtype::Int64, device_));
 
     core::Tensor vertices, triangles, vertex_normals, vertex_colors;
     kernel::tsdf::ExtractSurfaceMesh(
-            active_addrs.To(core::Dtype::Int64), inverse_index_map,
-            active_nb_addrs.To(core::Dtype::Int64), active_nb_masks,
-            block_hashmap_->GetKeyTensor(), block_hashmap_->GetValueTensor(),
-            vertices, triangles, vertex_normals, vertex_colors,
-            block_resolution_, voxel_size_);
+            active_addrs.To(core::Dtype::Int64), block_hashmap_->GetKeyTensor(),
+            block_hashmap_->GetValueTensor(), vertices, triangles,
+            vertex_normals, vertex_colors, block_resolution_, voxel_size_);
 
     TriangleMesh mesh(vertices, triangles);
     mesh.SetVertexNormals(vertex_normals);
@@ -245,12 +457,298 @@ TriangleMesh TSDFVoxelGrid::ExtractSurfaceMesh() {
     return mesh;
 }
 
+TriangleMesh TSDFVoxelGrid::ExtractSurfaceMeshIncremental() {
+    OPEN3D_TRACE_SCOPE("t::TSDF::ExtractSurfaceMeshIncremental");
+    core::Tensor active_addrs;
+    block_hashmap_->GetActiveIndices(active_addrs);
+    active_addrs = active_addrs.To(core::Dtype::Int64);
+    MarkDirtyBlocks(core::Tensor({0}, core::Dtype::Int64, device_));
+
+    // Blocks to re-mesh, as a mask over the hashmap buffer.
+    core::Tensor remesh_mask;
+    if (!incremental_mesh_valid_) {
+        remesh_mask = core::Tensor::Zeros({block_hashmap_->GetCapacity()},
+                                          core::Dtype::Bool, device_);
+        remesh_mask.IndexSet({active_addrs},
+                             core::Tensor::Ones({active_addrs.GetLength()},
+                                                core::Dtype::Bool, device_));
+    } else {
+        core::Tensor dirty_addrs = active_addrs.IndexGet(
+                {dirty_block_mask_.IndexGet({active_addrs})});
+        int64_t n_dirty = dirty_addrs.GetLength();
+        if (n_dirty == 0) {
+            return incremental_mesh_;
+        }
+
+        // Vertices and normals of a block read the voxels of its neighbors,
+        // so the neighbors of the dirty blocks are re-meshed as well.
+        std::vector<int> offsets;
+        for (int dz = -1; dz <= 1; ++dz) {
+            for (int dy = -1; dy <= 1; ++dy) {
+                for (int dx = -1; dx <= 1; ++dx) {
+                    offsets.insert(offsets.end(), {dx, dy, dz});
+                }
+            }
+        }
+        core::Tensor dirty_keys =
+                block_hashmap_->GetKeyTensor().IndexGet({dirty_addrs});
+        core::Tensor nb_keys =
+                (dirty_keys.Reshape({n_dirty, 1, 3}) +
+                 core::Tensor(offsets, {1, 27, 3}, core::Dtype::Int32, device_))
+                        .Reshape({n_dirty * 27, 3});
+        core::Tensor nb_addrs, nb_masks;
+        block_hashmap_->Find(nb_keys, nb_addrs, nb_masks);
+        nb_addrs = nb_addrs.To(core::Dtype::Int64).IndexGet({nb_masks});
+
+        remesh_mask = core::Tensor::Zeros({block_hashmap_->GetCapacity()},
+                                          core::Dtype::Bool, device_);
+        remesh_mask.IndexSet({nb_addrs},
+                             core::Tensor::Ones({nb_addrs.GetLength()},
+                                                core::Dtype::Bool, device_));
+    }
+    core::Tensor remesh_addrs =
+            active_addrs.IndexGet({remesh_mask.IndexGet({active_addrs})});
+    utility::LogDebug("[TSDFVoxelGrid] Re-meshing {} blocks out of {}.",
+                      remesh_addrs.GetLength(), active_addrs.GetLength());
+
+    core::Tensor vertices, triangles, vertex_normals, vertex_colors;
+    core::Tensor vertex_blocks, triangle_blocks;
+    kernel::tsdf::ExtractSurfaceMeshBlocks(
+            remesh_addrs, active_addrs, block_hashmap_->GetKeyTensor(),
+            block_hashmap_->GetValueTensor(), vertices, triangles,
+            vertex_normals, vertex_colors, vertex_blocks, triangle_blocks,
+            block_resolution_, voxel_size_);
+
+    // Drop the stale fragments of the re-meshed blocks from the persistent
+    // mesh, and compact the vertex indices of the others.
+    if (incremental_mesh_valid_) {
+        core::Tensor keep_vertices =
+                remesh_mask.IndexGet({incremental_vertex_blocks_})
+                        .LogicalNot();
+        core::Tensor keep_triangles =
+                remesh_mask.IndexGet({incremental_triangle_blocks_})
+                        .LogicalNot();
+
+        core::Tensor kept_indices = keep_vertices.NonZero()[0];
+        int64_t n_kept = kept_indices.GetLength();
+        core::Tensor index_map =
+                core::Tensor::Full({keep_vertices.GetLength()}, -1,
+                                   core::Dtype::Int64, device_);
+        index_map.IndexSet({kept_indices},
+                           core::Tensor::Arange(0, n_kept, 1,
+                                                core::Dtype::Int64, device_));
+
+        core::Tensor kept_triangles =
+                incremental_mesh_.GetTriangles().IndexGet({keep_triangles});
+        kept_triangles = index_map.IndexGet({kept_triangles.Reshape({-1})})
+                                 .Reshape({-1, 3});
+
+        // Vertex indices of the new fragments follow the kept vertices.
+        vertices = ConcatRows(
+                incremental_mesh_.GetVertices().IndexGet({keep_vertices}),
+                vertices);
+        vertex_normals = ConcatRows(
+                incremental_mesh_.GetVertexNormals().IndexGet({keep_vertices}),
+                vertex_normals);
+        if (vertex_colors.NumElements() != 0) {
+            vertex_colors = ConcatRows(incremental_mesh_.GetVertexColors()
+                                               .IndexGet({keep_vertices}),
+                                       vertex_colors);
+        }
+        triangles = ConcatRows(kept_triangles, triangles.Add(n_kept));
+        vertex_blocks = ConcatRows(
+                incremental_vertex_blocks_.IndexGet({keep_vertices}),
+                vertex_blocks);
+        triangle_blocks = ConcatRows(
+                incremental_triangle_blocks_.IndexGet({keep_triangles}),
+                triangle_blocks);
+    }
+
+    incremental_mesh_ = TriangleMesh(vertices, triangles);
+    incremental_mesh_.SetVertexNormals(vertex_normals);
+    if (vertex_colors.NumElements() != 0) {
+        incremental_mesh_.SetVertexColors(vertex_colors);
+    }
+    incremental_vertex_blocks_ = vertex_blocks;
+    incremental_triangle_blocks_ = triangle_blocks;
+    incremental_mesh_valid_ = true;
+    dirty_block_mask_.Fill(false);
+
+    return incremental_mesh_;
+}
+
+core::Tensor TSDFVoxelGrid::CullBlocksBatch(const core::Tensor &block_indices,
+                                            const core::Tensor &intrinsics,
+                                            const core::Tensor &extrinsics,
+                                            int64_t rows,
+                                            int64_t cols,
+                                            float depth_max) {
+    core::Tensor visible_mask;
+    for (int64_t k = 0; k < intrinsics.GetLength(); ++k) {
+        core::Tensor frame_mask;
+        kernel::tsdf::CullBlocks(block_indices, block_hashmap_->GetKeyTensor(),
+                                 frame_mask, intrinsics[k], extrinsics[k],
+                                 rows, cols, block_resolution_, voxel_size_,
+                                 sdf_trunc_, depth_max);
+        visible_mask =
+                k == 0 ? frame_mask : visible_mask.LogicalOr(frame_mask);
+    }
+    return visible_mask;
+}
+
+void TSDFVoxelGrid::MarkDirtyBlocks(const core::Tensor &block_indices) {
+    // The buffer grows in place when the hashmap rehashes, and addresses
+    // remain valid.
+    int64_t capacity = block_hashmap_->GetCapacity();
+    int64_t n = dirty_block_mask_.GetLength();
+    if (n != capacity) {
+        core::Tensor mask =
+                core::Tensor::Zeros({capacity}, core::Dtype::Bool, device_);
+        int64_t n_kept = std::min(n, capacity);
+        mask.Slice(0, 0, n_kept) = dirty_block_mask_.Slice(0, 0, n_kept);
+        dirty_block_mask_ = mask;
+    }
+    if (block_indices.GetLength() > 0) {
+        dirty_block_mask_.IndexSet(
+                {block_indices},
+                core::Tensor::Ones({block_indices.GetLength()},
+                                   core::Dtype::Bool, device_));
+    }
+}
+
+core::Tensor TSDFVoxelGrid::SelectPartitionBlocks(
+        const core::Tensor &block_coords) {
+    if (num_partitions_ <= 1 || block_coords.GetLength() == 0) {
+        return block_coords;
+    }
+    core::Tensor partitions;
+    kernel::tsdf::PartitionBlocks(block_coords, partitions,
+                                  partition_tile_size_, num_partitions_);
+    return block_coords.IndexGet({partitions.Eq(partition_index_)});
+}
+
+core::Hashmap &TSDFVoxelGrid::GetHostHashmap() {
+    if (!host_block_hashmap_) {
+        core::SizeVector element_shape =
+                block_hashmap_->GetValueTensor().GetShape();
+        element_shape.erase(element_shape.begin());
+        host_block_hashmap_ = std::make_shared<core::Hashmap>(
+                block_count_, core::Dtype::Int32, core::Dtype::UInt8,
+                core::SizeVector{3}, element_shape, core::Device("CPU:0"));
+    }
+    return *host_block_hashmap_;
+}
+
+void TSDFVoxelGrid::StreamOutBlocks(const core::Tensor &block_indices) {
+    if (block_indices.GetLength() == 0) {
+        return;
+    }
+
+    core::Device host("CPU:0");
+    core::Tensor indices = block_indices.To(core::Dtype::Int64);
+    core::Tensor keys = block_hashmap_->GetKeyTensor().IndexGet({indices});
+    core::Tensor values =
+            block_hashmap_->GetValueTensor().IndexGet({indices}).Copy(host);
+
+    // Overwrite the values of the keys that are already on host, so that the
+    // host copy always holds the latest integration.
+    core::Hashmap &host_hashmap = GetHostHashmap();
+    core::Tensor addrs, masks;
+    host_hashmap.InsertOrFind(keys.Copy(host), addrs, masks);
+    core::Tensor host_values = host_hashmap.GetValueTensor();
+    host_values.IndexSet({addrs.To(core::Dtype::Int64)}, values);
+
+    block_hashmap_->Erase(keys, masks);
+
+    // Buffer indices of the erased blocks may be reused by new blocks.
+    incremental_mesh_valid_ = false;
+}
+
+int64_t TSDFVoxelGrid::StreamInBlocks(const core::Tensor &block_keys) {
+    if (GetHostBlockCount() == 0 || block_keys.GetLength() == 0) {
+        return 0;
+    }
+
+    core::Device host("CPU:0");
+    core::Tensor keys = block_keys.Copy(host);
+    core::Tensor addrs, masks;
+    host_block_hashmap_->Find(keys, addrs, masks);
+    keys = keys.IndexGet({masks});
+    int64_t n = keys.GetLength();
+    if (n == 0) {
+        return 0;
+    }
+
+    core::Tensor values = host_block_hashmap_->GetValueTensor().IndexGet(
+            {addrs.IndexGet({masks}).To(core::Dtype::Int64)});
+    core::Tensor device_addrs, device_masks;
+    try {
+        block_hashmap_->Insert(keys.Copy(device_), values.Copy(device_),
+                               device_addrs, device_masks);
+    } catch (const std::runtime_error &) {
+        utility::LogError(
+                "[TSDFVoxelGrid] Unable to stream in {} blocks with {} "
+                "blocks on device. Consider a smaller max_device_blocks.",
+                n, block_hashmap_->Size());
+    }
+    host_block_hashmap_->Erase(keys, masks);
+
+    incremental_mesh_valid_ = false;
+    return n;
+}
+
+int64_t TSDFVoxelGrid::StreamOutInvisibleBlocks(const core::Tensor &intrinsics,
+                                                const core::Tensor &extrinsics,
+                                                int width,
+                                                int height,
+                                                float depth_max) {
+    core::Tensor active_addrs;
+    block_hashmap_->GetActiveIndices(active_addrs);
+    core::Tensor block_indices = active_addrs.To(core::Dtype::Int64);
+
+    core::Tensor visible_mask;
+    kernel::tsdf::CullBlocks(block_indices, block_hashmap_->GetKeyTensor(),
+                             visible_mask, intrinsics, extrinsics, height,
+                             width, block_resolution_, voxel_size_, sdf_trunc_,
+                             depth_max);
+    core::Tensor invisible_indices =
+            block_indices.IndexGet({visible_mask.LogicalNot()});
+    StreamOutBlocks(invisible_indices);
+    return invisible_indices.GetLength();
+}
+
+void TSDFVoxelGrid::SaveHostBlocks(const std::string &file_name) {
+    GetHostHashmap().Save(file_name);
+    host_block_hashmap_ = nullptr;
+}
+
+void TSDFVoxelGrid::LoadHostBlocks(const std::string &file_name) {
+    auto hashmap = std::make_shared<core::Hashmap>(
+            core::Hashmap::Load(file_name, core::Device("CPU:0")));
+    if (hashmap->GetKeyBytesize() != block_hashmap_->GetKeyBytesize() ||
+        hashmap->GetValueBytesize() != block_hashmap_->GetValueBytesize()) {
+        utility::LogError(
+                "[TSDFVoxelGrid] blocks in {} do not match the voxel layout.",
+                file_name);
+    }
+    host_block_hashmap_ = hashmap;
+}
+
 TSDFVoxelGrid TSDFVoxelGrid::Copy(const core::Device &device) {
     TSDFVoxelGrid device_tsdf_voxelgrid(attr_dtype_map_, voxel_size_,
                                         sdf_trunc_, block_resolution_,
                                         block_count_, device);
     auto device_tsdf_hashmap = device_tsdf_voxelgrid.block_hashmap_;
     *device_tsdf_hashmap = block_hashmap_->Copy(device);
+    if (host_block_hashmap_) {
+        device_tsdf_voxelgrid.host_block_hashmap_ =
+                std::make_shared<core::Hashmap>(
+                        host_block_hashmap_->Copy(core::Device("CPU:0")));
+    }
+    device_tsdf_voxelgrid.max_device_blocks_ = max_device_blocks_;
+    device_tsdf_voxelgrid.partition_tile_size_ = partition_tile_size_;
+    device_tsdf_voxelgrid.num_partitions_ = num_partitions_;
+    device_tsdf_voxelgrid.partition_index_ = partition_index_;
     return device_tsdf_voxelgrid;
 }
 
@@ -269,34 +767,6 @@ TSDFVoxelGrid TSDFVoxelGrid::CUDA(int device_id) {
     }
     return Copy(device);
 }
-
-std::pair<core::Tensor, core::Tensor> TSDFVoxelGrid::BufferRadiusNeighbors(
-        const core::Tensor &active_addrs) {
-    // Fixed radius search for spatially hashed voxel blocks.
-    // A generalization will be implementing dense/sparse fixed radius search
-    // with coordinates as hashmap keys.
-    core::Tensor key_buffer_int3_tensor = block_hashmap_->GetKeyTensor();
-
-    core::Tensor active_keys = key_buffer_int3_tensor.IndexGet(
-            {active_addrs.To(core::Dtype::Int64)});
-    int64_t n = active_keys.GetShape()[0];
-
-    // Fill in radius nearest neighbors.
-    core::Tensor keys_nb({27, n, 3}, core::Dtype::Int32, device_);
-    for (int nb = 0; nb < 27; ++nb) {
-        int dz = nb / 9;
-        int dy = (nb % 9) / 3;
-        int dx = nb % 3;
-        core::Tensor dt = core::Tensor(std::vector<int>{dx - 1, dy - 1, dz - 1},
-                                       {1, 3}, core::Dtype::Int32, device_);
-        keys_nb[nb] = active_keys + dt;
-    }
-    keys_nb = keys_nb.View({27 * n, 3});
-
-    core::Tensor addrs_nb, masks_nb;
-    block_hashmap_->Find(keys_nb, addrs_nb, masks_nb);
-    return std::make_pair(addrs_nb.View({27, n, 1}), masks_nb.View({27, n, 1}));
-}
 }  // namespace geometry
 }  // namespace t
 }  // namespace open3d
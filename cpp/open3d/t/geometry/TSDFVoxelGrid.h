@@ -30,6 +30,7 @@
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include "open3d/core/Tensor.h"
 #include "open3d/core/TensorList.h"
@@ -54,6 +55,10 @@ namespace geometry {
 /// For colored TSDF voxels, channel = 5 (TSDF + weight + color).
 /// Users may specialize their own channels that can be reinterpreted from the
 /// internal Tensor.
+/// Supported {tsdf, weight, color} dtypes are {Float32, Float32},
+/// {Float32, Float32, Float32}, {Float32, UInt16, UInt16}, and the quantized
+/// {Int16, UInt16} and {Int16, UInt16, UInt8} that store the TSDF in 16 bits
+/// to save memory, at 4 and 7 bytes per voxel.
 class TSDFVoxelGrid {
 public:
     /// \brief Default Constructor.
@@ -84,12 +89,88 @@ public:
                    float depth_scale = 1000.0f,
                    float depth_max = 3.0f);
 
+    /// Integration of a batch of frames, e.g. consecutive frames of a
+    /// recorded sequence or the cameras of a multi-camera rig. The blocks
+    /// touched by any frame are activated at once, and each voxel integrates
+    /// the frames in order in a single kernel launch. All depth images must
+    /// share one size. \p colors is empty for depth-only integration, or
+    /// holds one color image per depth image. \p intrinsics holds either one
+    /// matrix shared by all the frames or one per frame.
+    void IntegrateBatch(const std::vector<Image> &depths,
+                        const std::vector<Image> &colors,
+                        const std::vector<core::Tensor> &intrinsics,
+                        const std::vector<core::Tensor> &extrinsics,
+                        float depth_scale = 1000.0f,
+                        float depth_max = 3.0f);
+
+    /// Render the zero-crossings of the TSDF seen from a camera, for
+    /// frame-to-model tracking. Rays skip the blocks that are not allocated.
+    /// Returns a map with the Float32 tensors of shape {height, width, C},
+    /// with zeros at the pixels without a hit:
+    /// - "vertex": vertices in camera coordinates, C = 3.
+    /// - "depth": depth in meters, C = 1.
+    /// - "normal": unit normals in camera coordinates, pointing to the free
+    /// space, C = 3.
+    /// - "color": colors, C = 3, only if the voxels have colors.
+    std::unordered_map<std::string, core::Tensor> RayCast(
+            const core::Tensor &intrinsics,
+            const core::Tensor &extrinsics,
+            int width,
+            int height,
+            float depth_min = 0.1f,
+            float depth_max = 3.0f);
+
     /// Extract point cloud near iso-surfaces.
     PointCloud ExtractSurfacePoints();
 
     /// Extract mesh near iso-surfaces with Marching Cubes.
     TriangleMesh ExtractSurfaceMesh();
 
+    /// Extract mesh near iso-surfaces with Marching Cubes, re-meshing only the
+    /// blocks integrated since the previous call and their neighbors. The
+    /// fragments of the other blocks are kept from the previous calls, and
+    /// stitched with the new ones into a persistent mesh. Each block owns a
+    /// copy of the vertices on the faces it shares with the next blocks, hence
+    /// these vertices are duplicated compared with ExtractSurfaceMesh. The
+    /// first call meshes all the active blocks.
+    TriangleMesh ExtractSurfaceMeshIncremental();
+
+    /// Move the blocks at the buffer indices \p block_indices of the device
+    /// hashmap to the host hashmap, releasing their device memory. The streamed
+    /// out blocks are no longer seen by ray casting and surface extraction.
+    void StreamOutBlocks(const core::Tensor &block_indices);
+
+    /// Move the blocks with coordinates \p block_keys that are in the host
+    /// hashmap back to the device hashmap. Returns the number of streamed in
+    /// blocks.
+    int64_t StreamInBlocks(const core::Tensor &block_keys);
+
+    /// Stream out all the blocks that can not be updated from a camera, i.e.
+    /// outside its view frustum or beyond depth_max plus the truncation band.
+    /// Returns the number of streamed out blocks.
+    int64_t StreamOutInvisibleBlocks(const core::Tensor &intrinsics,
+                                     const core::Tensor &extrinsics,
+                                     int width,
+                                     int height,
+                                     float depth_max = 3.0f);
+
+    /// Bound the number of blocks on device for out-of-core reconstruction.
+    /// When an integration leaves more than \p max_device_blocks blocks on
+    /// device, the blocks outside the camera frustum are streamed out to the
+    /// host hashmap. Integration streams the touched blocks back in. A
+    /// non-positive value disables streaming, which is the default.
+    void SetMaxDeviceBlocks(int64_t max_device_blocks) {
+        max_device_blocks_ = max_device_blocks;
+    }
+
+    /// Save the streamed out blocks to \p file_name in the compact binary
+    /// format of core::Hashmap::Save, and release them from host memory.
+    void SaveHostBlocks(const std::string &file_name);
+
+    /// Load the streamed out blocks saved by SaveHostBlocks, replacing the
+    /// blocks in the host hashmap. They are streamed in when revisited.
+    void LoadHostBlocks(const std::string &file_name);
+
     /// Copy TSDFVoxelGrid to the target device.
     TSDFVoxelGrid Copy(const core::Device &device);
 
@@ -101,19 +182,15 @@ public:
 
     core::Device GetDevice() { return device_; }
 
-protected:
-    /// Return  \addrs and \masks for radius (3) neighbor entries.
-    /// We first find all active entries in the hashmap with there coordinates.
-    /// We then query these coordinates and their 3^3 neighbors.
-    /// \addrs_nb: indexer used for the internal hashmap to access voxel block
-    /// coordinates in the 3^3 neighbors.
-    /// \masks_nb: flag used for hashmap to indicate whether a query is a
-    /// success.
-    /// Currently we preserve a dense output (27 x active_entries) without
-    /// compression / reduction.
-    std::pair<core::Tensor, core::Tensor> BufferRadiusNeighbors(
-            const core::Tensor &active_addrs);
+    /// Number of allocated voxel blocks on device.
+    int64_t GetActiveBlockCount() const { return block_hashmap_->Size(); }
 
+    /// Number of voxel blocks streamed out to the host hashmap.
+    int64_t GetHostBlockCount() const {
+        return host_block_hashmap_ ? host_block_hashmap_->Size() : 0;
+    }
+
+protected:
     float voxel_size_;
     float sdf_trunc_;
 
@@ -125,6 +202,51 @@ protected:
     std::shared_ptr<core::Hashmap> block_hashmap_;
 
     std::unordered_map<std::string, core::Dtype> attr_dtype_map_;
+
+    /// CPU hashmap of the blocks streamed out of the device, created on the
+    /// first stream out.
+    std::shared_ptr<core::Hashmap> host_block_hashmap_;
+    int64_t max_device_blocks_ = 0;
+
+    /// Mask over the hashmap buffer of the blocks integrated since the last
+    /// incremental mesh extraction.
+    core::Tensor dirty_block_mask_;
+
+    /// Persistent mesh of ExtractSurfaceMeshIncremental, with the buffer
+    /// indices of the blocks that own its vertices and triangles.
+    bool incremental_mesh_valid_ = false;
+    TriangleMesh incremental_mesh_;
+    core::Tensor incremental_vertex_blocks_;
+    core::Tensor incremental_triangle_blocks_;
+
+    /// Partition of the space this grid is a shard of, see
+    /// PartitionedTSDFVoxelGrid. Integration only allocates the blocks of
+    /// the partition \p partition_index_.
+    int64_t partition_tile_size_ = 0;
+    int64_t num_partitions_ = 1;
+    int64_t partition_index_ = 0;
+
+    friend class PartitionedTSDFVoxelGrid;
+
+private:
+    /// Mark blocks as dirty for the incremental mesh extraction.
+    void MarkDirtyBlocks(const core::Tensor &block_indices);
+
+    /// Mask of the blocks at \p block_indices that at least one of the
+    /// cameras in \p intrinsics {K, 3, 3} and \p extrinsics {K, 4, 4} can
+    /// update.
+    core::Tensor CullBlocksBatch(const core::Tensor &block_indices,
+                                 const core::Tensor &intrinsics,
+                                 const core::Tensor &extrinsics,
+                                 int64_t rows,
+                                 int64_t cols,
+                                 float depth_max);
+
+    /// Keep the blocks of \p block_coords in the partition of this grid.
+    core::Tensor SelectPartitionBlocks(const core::Tensor &block_coords);
+
+    /// Create the host hashmap on demand, with the layout of the device one.
+    core::Hashmap &GetHostHashmap();
 };
 }  // namespace geometry
 }  // namespace t
@@ -28,10 +28,15 @@
 
 #include <fmt/format.h>
 
+#include <algorithm>
+#include <iterator>
+#include <memory>
 #include <sstream>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
+#include "open3d/t/geometry/kernel/PointCloud.h"
 #include "open3d/utility/Console.h"
 
 namespace open3d {
@@ -72,6 +77,130 @@ void TensorMap::AssertSizeSynchronized() const {
     }
 }
 
+TensorMap TensorMap::IndexGet(const core::Tensor& indices) const {
+    indices.AssertDtype(core::Dtype::Int64);
+    std::vector<std::string> keys;
+    std::vector<core::Tensor> srcs;
+    for (auto& kv : *this) {
+        keys.push_back(kv.first);
+        srcs.push_back(kv.second.Contiguous());
+        srcs.back().AssertDevice(indices.GetDevice());
+    }
+    std::vector<core::Tensor> dsts;
+    kernel::pointcloud::GatherRows(srcs, indices.Contiguous(), dsts);
+
+    TensorMap gathered(primary_key_);
+    for (size_t i = 0; i < keys.size(); ++i) {
+        gathered[keys[i]] = dsts[i];
+    }
+    return gathered;
+}
+
+/// Returns true if \p tensor is a leading slice of \p buffer with at least
+/// \p length rows, and nothing else references their memory.
+static bool CanGrowInPlace(const core::Tensor& tensor,
+                           const core::Tensor& buffer,
+                           int64_t length) {
+    const core::SizeVector shape = tensor.GetShape();
+    const core::SizeVector buffer_shape = buffer.GetShape();
+    if (buffer.GetLength() < length || !tensor.IsContiguous() ||
+        tensor.GetDataPtr() != buffer.GetDataPtr() ||
+        tensor.GetDtype() != buffer.GetDtype() ||
+        shape.size() != buffer_shape.size() ||
+        !std::equal(shape.begin() + 1, shape.end(),
+                    buffer_shape.begin() + 1)) {
+        return false;
+    }
+    const std::shared_ptr<core::Blob> blob = tensor.GetBlob();
+    if (blob != buffer.GetBlob()) {
+        return false;
+    }
+    // References: the tensor, the buffer and blob.
+    return blob.use_count() == 3;
+}
+
+void TensorMap::Append(const TensorMap& other) {
+    if (other.empty()) {
+        return;
+    }
+    if (empty()) {
+        for (const auto& kv : other) {
+            core::SizeVector empty_shape = kv.second.GetShape();
+            empty_shape[0] = 0;
+            (*this)[kv.first] =
+                    core::Tensor::Empty(empty_shape, kv.second.GetDtype(),
+                                        kv.second.GetDevice());
+        }
+        AssertPrimaryKeyInMapOrEmpty();
+    }
+    if (size() != other.size()) {
+        utility::LogError(
+                "Cannot append a TensorMap with {} keys to one with {} keys.",
+                other.size(), size());
+    }
+    for (const auto& kv : other) {
+        if (!Contains(kv.first)) {
+            utility::LogError(
+                    "Cannot append \"{}\", which is not in the TensorMap.",
+                    kv.first);
+        }
+        const core::Tensor& tensor = at(kv.first);
+        const core::Tensor& src = kv.second;
+        src.AssertDtype(tensor.GetDtype());
+        src.AssertDevice(tensor.GetDevice());
+        const core::SizeVector shape = tensor.GetShape();
+        const core::SizeVector src_shape = src.GetShape();
+        if (shape.size() == 0 || src_shape.size() != shape.size() ||
+            !std::equal(shape.begin() + 1, shape.end(),
+                        src_shape.begin() + 1)) {
+            utility::LogError(
+                    "Cannot append \"{}\" of shape {} to a tensor of shape "
+                    "{}.",
+                    kv.first, src_shape, shape);
+        }
+    }
+
+    // Drop the buffers of keys that have been erased.
+    for (auto it = reserved_.begin(); it != reserved_.end();) {
+        it = Contains(it->first) ? std::next(it) : reserved_.erase(it);
+    }
+
+    for (const auto& kv : other) {
+        core::Tensor& tensor = at(kv.first);
+        const int64_t length = tensor.GetLength();
+        const int64_t new_length = length + kv.second.GetLength();
+        auto it = reserved_.find(kv.first);
+        if (it == reserved_.end() ||
+            !CanGrowInPlace(tensor, it->second, new_length)) {
+            core::SizeVector capacity_shape = tensor.GetShape();
+            capacity_shape[0] = std::max<int64_t>(new_length, 2 * length);
+            core::Tensor buffer = core::Tensor::Empty(
+                    capacity_shape, tensor.GetDtype(), tensor.GetDevice());
+            buffer.Slice(0, 0, length) = tensor;
+            reserved_[kv.first] = buffer;
+            tensor = buffer.Slice(0, 0, length);
+        }
+        const core::Tensor& buffer = reserved_.at(kv.first);
+        // kv.second may be the tensor itself, whose rows are not overwritten.
+        buffer.Slice(0, length, new_length) = kv.second;
+        tensor = buffer.Slice(0, 0, new_length);
+    }
+}
+
+void TensorMap::Shrink() {
+    for (const auto& kv : reserved_) {
+        if (!Contains(kv.first)) {
+            continue;
+        }
+        core::Tensor& tensor = at(kv.first);
+        if (tensor.GetBlob() == kv.second.GetBlob() &&
+            tensor.GetLength() < kv.second.GetLength()) {
+            tensor = tensor.Copy();
+        }
+    }
+    reserved_.clear();
+}
+
 }  // namespace geometry
 }  // namespace t
 }  // namespace open3d
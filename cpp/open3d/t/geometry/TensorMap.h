@@ -81,14 +81,16 @@ public:
     /// Copy constructor performs a "shallow" copy of the Tensors.
     TensorMap(const TensorMap& other)
         : std::unordered_map<std::string, core::Tensor>(other),
-          primary_key_(other.primary_key_) {
+          primary_key_(other.primary_key_),
+          reserved_(other.reserved_) {
         AssertPrimaryKeyInMapOrEmpty();
     }
 
     /// Move constructor performs a "shallow" copy of the Tensors.
     TensorMap(TensorMap&& other)
         : std::unordered_map<std::string, core::Tensor>(other),
-          primary_key_(other.primary_key_) {
+          primary_key_(other.primary_key_),
+          reserved_(other.reserved_) {
         AssertPrimaryKeyInMapOrEmpty();
     }
 
@@ -109,6 +111,29 @@ public:
     /// Same as C++20's std::unordered_map::contains().
     bool Contains(const std::string& key) const { return count(key) != 0; }
 
+    /// Returns a TensorMap with the same primary key and the rows \p indices
+    /// of all the tensors, gathered together in a single kernel launch.
+    ///
+    /// \param indices Int64 row indices of shape {k}, on the device of the
+    /// tensors.
+    TensorMap IndexGet(const core::Tensor& indices) const;
+
+    /// \brief Appends the rows of the tensors of \p other, in-place.
+    ///
+    /// \p other must have the same keys, with tensors of the same dtype,
+    /// device and element shape. An empty map takes the keys of \p other.
+    ///
+    /// Like TensorList, the tensors are views of buffers over-allocated
+    /// geometrically, so that n appends of k rows take O(n * k) time instead
+    /// of O(n^2 * k). A tensor whose memory is also referenced elsewhere,
+    /// e.g. by a shallow copy of the map, is reallocated rather than written
+    /// past its end.
+    void Append(const TensorMap& other);
+
+    /// Releases the capacity reserved by Append(), copying the tensors that
+    /// are views of larger buffers.
+    void Shrink();
+
 private:
     /// Asserts that the map indeed contains the primary_key. This is typically
     /// called in constructors.
@@ -124,6 +149,10 @@ private:
 
     /// Primary key of the TensorMap.
     std::string primary_key_;
+
+    /// Buffers reserved by Append(), of which the tensors with the same key
+    /// are leading slices.
+    std::unordered_map<std::string, core::Tensor> reserved_;
 };
 
 }  // namespace geometry
@@ -27,12 +27,27 @@
 #include "open3d/t/geometry/TriangleMesh.h"
 
 #include <Eigen/Core>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <random>
 #include <string>
+#include <tuple>
 #include <unordered_map>
+#include <vector>
 
 #include "open3d/core/EigenConverter.h"
 #include "open3d/core/ShapeUtil.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/core/hashmap/Hashmap.h"
+#include "open3d/geometry/TriangleBVH.h"
+#include "open3d/t/geometry/kernel/PointCloud.h"
+#include "open3d/t/geometry/kernel/Transform.h"
+#include "open3d/t/geometry/kernel/TriangleMesh.h"
+#include "open3d/utility/Helper.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace t {
@@ -60,6 +75,1023 @@ TriangleMesh::TriangleMesh(const core::Tensor &vertices,
     SetTriangles(triangles);
 }
 
+core::Tensor TriangleMesh::GetMinBound() const {
+    return GetVertices().Min({0});
+}
+
+core::Tensor TriangleMesh::GetMaxBound() const {
+    return GetVertices().Max({0});
+}
+
+core::Tensor TriangleMesh::GetCenter() const {
+    return GetVertices().Mean({0});
+}
+
+TriangleMesh &TriangleMesh::Append(const TriangleMesh &other) {
+    if (other.GetDevice() != device_) {
+        utility::LogError(
+                "Cannot append a TriangleMesh on {} to a TriangleMesh on {}.",
+                other.GetDevice().ToString(), device_.ToString());
+    }
+    const int64_t num_vertices =
+            vertex_attr_.Contains("vertices") ? GetVertices().GetLength() : 0;
+    if (num_vertices > 0 && other.triangle_attr_.Contains("triangles")) {
+        TensorMap other_triangle_attr(other.triangle_attr_);
+        other_triangle_attr["triangles"] =
+                other.GetTriangles().Add(num_vertices);
+        triangle_attr_.Append(other_triangle_attr);
+    } else {
+        triangle_attr_.Append(other.triangle_attr_);
+    }
+    vertex_attr_.Append(other.vertex_attr_);
+    return *this;
+}
+
+TriangleMesh &TriangleMesh::Transform(const core::Tensor &transformation) {
+    transformation.AssertShape({4, 4});
+    transformation.AssertDevice(device_);
+
+    // The vertices with their normals, and the triangle normals alone.
+    std::vector<core::Tensor> points, normals;
+    SetVertices(GetVertices().Contiguous());
+    points.push_back(GetVertices());
+    if (HasVertexNormals()) {
+        SetVertexNormals(GetVertexNormals().Contiguous());
+        normals.push_back(GetVertexNormals());
+    } else {
+        normals.push_back(core::Tensor());
+    }
+    points.push_back(core::Tensor());
+    if (HasTriangleNormals()) {
+        SetTriangleNormals(GetTriangleNormals().Contiguous());
+        normals.push_back(GetTriangleNormals());
+    } else {
+        normals.push_back(core::Tensor());
+    }
+    kernel::transform::TransformPointsAndNormals(
+            transformation.Broadcast({2, 4, 4}), points, normals);
+    return *this;
+}
+
+TriangleMesh &TriangleMesh::Translate(const core::Tensor &translation,
+                                      bool relative) {
+    translation.AssertShape({3});
+    translation.AssertDevice(device_);
+
+    core::Tensor transform =
+            relative ? translation : translation.Sub(GetCenter());
+    GetVertices() += transform;
+    return *this;
+}
+
+TriangleMesh &TriangleMesh::Scale(double scale, const core::Tensor &center) {
+    center.AssertShape({3});
+    center.AssertDevice(device_);
+
+    core::Tensor vertices = GetVertices();
+    vertices.Sub_(center).Mul_(scale).Add_(center);
+    return *this;
+}
+
+TriangleMesh &TriangleMesh::Rotate(const core::Tensor &R,
+                                   const core::Tensor &center) {
+    R.AssertShape({3, 3});
+    R.AssertDevice(device_);
+    center.AssertShape({3});
+    center.AssertDevice(device_);
+
+    // Multiply by R^T from the right so that the {N, 3} attributes stay
+    // contiguous, instead of rotating a transposed copy.
+    core::Tensor R_T = R.T();
+    core::Tensor &vertices = GetVertices();
+    vertices = vertices.Sub_(center).Matmul(R_T).Add_(center);
+    if (HasVertexNormals()) {
+        core::Tensor &normals = GetVertexNormals();
+        normals = normals.Matmul(R_T);
+    }
+    if (HasTriangleNormals()) {
+        core::Tensor &normals = GetTriangleNormals();
+        normals = normals.Matmul(R_T);
+    }
+    return *this;
+}
+
+TriangleMesh &TriangleMesh::ComputeTriangleNormals(bool normalized) {
+    if (!HasTriangles()) {
+        return *this;
+    }
+    core::Tensor vertices = GetVertices().Contiguous();
+    core::Dtype dtype = vertices.GetDtype();
+    if (dtype != core::Dtype::Float32 && dtype != core::Dtype::Float64) {
+        utility::LogError(
+                "[ComputeTriangleNormals] Vertices must be Float32 or Float64, "
+                "but got {}.",
+                dtype.ToString());
+    }
+    core::Tensor triangles =
+            GetTriangles().To(core::Dtype::Int64, /*copy=*/false).Contiguous();
+    core::Tensor normals = core::Tensor::Empty(triangles.GetShape(), dtype,
+                                               device_);
+    kernel::trianglemesh::ComputeTriangleNormals(vertices, triangles, normals);
+    if (normalized) {
+        kernel::trianglemesh::NormalizeNormals(normals);
+    }
+    SetTriangleNormals(normals);
+    return *this;
+}
+
+TriangleMesh &TriangleMesh::ComputeVertexNormals(bool normalized) {
+    if (!HasVertices()) {
+        return *this;
+    }
+    if (!HasTriangleNormals()) {
+        ComputeTriangleNormals(false);
+    }
+    core::Tensor normals = core::Tensor::Zeros(
+            GetVertices().GetShape(), GetVertices().GetDtype(), device_);
+    if (HasTriangles()) {
+        core::Tensor triangles = GetTriangles()
+                                         .To(core::Dtype::Int64,
+                                             /*copy=*/false)
+                                         .Contiguous();
+        kernel::trianglemesh::AccumulateVertexNormals(
+                triangles,
+                GetTriangleNormals().To(normals.GetDtype()).Contiguous(),
+                normals);
+    }
+    if (normalized) {
+        kernel::trianglemesh::NormalizeNormals(normals);
+    }
+    SetVertexNormals(normals);
+    return *this;
+}
+
+namespace {
+
+// Numbers the distinct rows of keys in the order of their first occurrence,
+// with a hashmap that compares the rows bitwise. Returns the Int64 group of
+// each row, and sets first_rows to the Int64 index of the first row of each
+// group, in increasing order.
+core::Tensor GroupRows(const core::Tensor &keys, core::Tensor &first_rows) {
+    const core::Device &device = keys.GetDevice();
+    int64_t n = keys.GetLength();
+    core::Hashmap key_map(n, keys.GetDtype(), core::Dtype::Int32,
+                          {keys.GetShape(1)}, {1}, device);
+    core::Tensor addrs, masks;
+    key_map.InsertOrFind(keys.Contiguous(), addrs, masks);
+
+    // Map the buffer address of each row to an id of its group.
+    core::Tensor active_addrs;
+    key_map.GetActiveIndices(active_addrs);
+    int64_t num_groups = active_addrs.GetLength();
+    core::Tensor group_of_addr = core::Tensor::Empty(
+            {key_map.GetCapacity()}, core::Dtype::Int64, device);
+    group_of_addr.IndexSet({active_addrs.To(core::Dtype::Int64)},
+                           core::Tensor::Arange(0, num_groups, 1,
+                                                core::Dtype::Int64, device));
+    core::Tensor group_ids =
+            group_of_addr.IndexGet({addrs.To(core::Dtype::Int64)});
+
+    // Renumber the groups by their first row.
+    core::Tensor first_indices;
+    kernel::trianglemesh::SegmentFirstIndex(group_ids, num_groups,
+                                            first_indices);
+    core::Tensor is_first = first_indices.IndexGet({group_ids}).Eq(
+            core::Tensor::Arange(0, n, 1, core::Dtype::Int64, device));
+    first_rows = is_first.NonZero()[0];
+    core::Tensor new_index_of_group =
+            core::Tensor::Empty({num_groups}, core::Dtype::Int64, device);
+    new_index_of_group.IndexSet({group_ids.IndexGet({first_rows})},
+                                core::Tensor::Arange(0, num_groups, 1,
+                                                     core::Dtype::Int64,
+                                                     device));
+    return new_index_of_group.IndexGet({group_ids});
+}
+
+// Replaces the vertex indices of triangles by old_to_new, keeping the dtype.
+core::Tensor RemapTriangles(const core::Tensor &triangles,
+                            const core::Tensor &old_to_new) {
+    return old_to_new
+            .IndexGet({triangles.To(core::Dtype::Int64).Reshape({-1})})
+            .Reshape(triangles.GetShape())
+            .To(triangles.GetDtype());
+}
+
+// Marks the points inside the box of the points p with min_bound <=
+// axes * (p - center) <= max_bound.
+core::Tensor ComputeBoxMask(const core::Tensor &points,
+                            const Eigen::Vector3d &center,
+                            const Eigen::Matrix3d &axes,
+                            const Eigen::Vector3d &min_bound,
+                            const Eigen::Vector3d &max_bound) {
+    const core::Device &device = points.GetDevice();
+    auto ToTensor = [&](const Eigen::Vector3d &v) {
+        return core::Tensor(std::vector<double>{v(0), v(1), v(2)}, {3},
+                            core::Dtype::Float64, device);
+    };
+    core::Tensor mask;
+    kernel::pointcloud::ComputeBoxMask(
+            points.Contiguous(), ToTensor(center),
+            core::eigen_converter::EigenMatrixToTensor(axes).Copy(device),
+            ToTensor(min_bound), ToTensor(max_bound), mask);
+    return mask;
+}
+
+// Samples points uniformly on the triangles of mesh, see
+// TriangleMesh::SamplePointsUniformly, and sets surface_area to the total
+// area of the triangles.
+PointCloud SamplePointsOnTriangles(const TriangleMesh &mesh,
+                                   int64_t number_of_points,
+                                   bool use_triangle_normal,
+                                   int seed,
+                                   double &surface_area) {
+    core::Tensor vertices = mesh.GetVertices().Contiguous();
+    core::Tensor triangles = mesh.GetTriangles()
+                                     .To(core::Dtype::Int64, /*copy=*/false)
+                                     .Contiguous();
+    core::Tensor triangle_normals = core::Tensor::Empty(
+            triangles.GetShape(), vertices.GetDtype(), vertices.GetDevice());
+    kernel::trianglemesh::ComputeTriangleNormals(vertices, triangles,
+                                                 triangle_normals);
+    core::Tensor cross = triangle_normals.To(core::Dtype::Float64);
+    core::Tensor triangle_areas = cross.Mul(cross).Sum({1}).Sqrt().Mul(0.5);
+    surface_area = triangle_areas.Sum({0}).Item<double>();
+
+    if (seed == -1) {
+        std::random_device rd;
+        seed = rd();
+    }
+    core::Tensor triangle_ids, barycentric;
+    kernel::trianglemesh::SampleTriangles(triangle_areas, number_of_points,
+                                          static_cast<uint64_t>(seed),
+                                          triangle_ids, barycentric);
+
+    // The attributes of a point are the barycentric combination of the
+    // attributes of the corners of its triangle.
+    core::Tensor corners = triangles.IndexGet({triangle_ids}).Reshape({-1});
+    core::Tensor weights = barycentric.Reshape({number_of_points, 3, 1});
+    auto Interpolate = [&](const core::Tensor &attr) {
+        return attr.IndexGet({corners})
+                .To(core::Dtype::Float64)
+                .Reshape({number_of_points, 3, attr.GetShape(1)})
+                .Mul(weights)
+                .Sum({1})
+                .To(attr.GetDtype());
+    };
+
+    PointCloud pcd(Interpolate(vertices));
+    if (use_triangle_normal) {
+        if (mesh.HasTriangleNormals()) {
+            triangle_normals = mesh.GetTriangleNormals();
+        } else {
+            kernel::trianglemesh::NormalizeNormals(triangle_normals);
+        }
+        pcd.SetPointNormals(triangle_normals.IndexGet({triangle_ids}));
+    } else if (mesh.HasVertexNormals()) {
+        pcd.SetPointNormals(Interpolate(mesh.GetVertexNormals()));
+    }
+    if (mesh.HasVertexColors()) {
+        pcd.SetPointColors(Interpolate(mesh.GetVertexColors()));
+    }
+    return pcd;
+}
+
+// Buckets the points into a grid of cubic cells of size cell_size for the
+// sample elimination kernels. cell_ids is the Int64 cell of each point,
+// neighbor_cells lists the 27 cells around each cell, -1 for the empty ones,
+// and the points of cell c are cell_order[cell_offsets[c]:cell_offsets[c+1]].
+void BuildSampleGrid(const core::Tensor &points,
+                     double cell_size,
+                     core::Tensor &cell_ids,
+                     core::Tensor &neighbor_cells,
+                     core::Tensor &cell_offsets,
+                     core::Tensor &cell_order) {
+    const core::Device &device = points.GetDevice();
+    core::Tensor cells = points.Div(cell_size).Floor().To(core::Dtype::Int32);
+    core::Tensor first_points;
+    cell_ids = GroupRows(cells, first_points);
+    int64_t num_cells = first_points.GetLength();
+    kernel::pointcloud::SortBySegment(cell_ids, num_cells, cell_offsets,
+                                      cell_order);
+
+    // The cells around each cell are looked up in a hashmap from the cell
+    // coordinates to the cell ids.
+    core::Tensor cell_keys = cells.IndexGet({first_points}).Contiguous();
+    core::Hashmap cell_map(num_cells, core::Dtype::Int32, core::Dtype::Int64,
+                           {3}, {1}, device);
+    core::Tensor addrs, masks;
+    cell_map.Insert(cell_keys,
+                    core::Tensor::Arange(0, num_cells, 1, core::Dtype::Int64,
+                                         device)
+                            .Reshape({num_cells, 1}),
+                    addrs, masks);
+
+    std::vector<int32_t> stencil;
+    for (int32_t dx = -1; dx <= 1; ++dx) {
+        for (int32_t dy = -1; dy <= 1; ++dy) {
+            for (int32_t dz = -1; dz <= 1; ++dz) {
+                stencil.insert(stencil.end(), {dx, dy, dz});
+            }
+        }
+    }
+    core::Tensor neighbor_keys =
+            cell_keys.Reshape({num_cells, 1, 3})
+                    .Add(core::Tensor(stencil, {1, 27, 3}, core::Dtype::Int32,
+                                      device))
+                    .Reshape({num_cells * 27, 3})
+                    .Contiguous();
+    cell_map.Find(neighbor_keys, addrs, masks);
+    core::Tensor found = masks.To(core::Dtype::Int64);
+    core::Tensor found_addrs = addrs.To(core::Dtype::Int64).Mul(found);
+    neighbor_cells = cell_map.GetValueTensor()
+                             .Reshape({-1})
+                             .IndexGet({found_addrs})
+                             .Add(1)
+                             .Mul(found)
+                             .Sub(1)
+                             .Reshape({num_cells, 27})
+                             .Contiguous();
+}
+
+// Angle-weighted pseudo-normals of the triangles, edges and vertices of a
+// mesh, whose dot product with the offset from the closest point on the mesh
+// gives the side of a point, as in Baerentzen and Aanaes, "Signed Distance
+// Computation Using the Angle Weighted Pseudonormal", TVCG, 2005.
+struct PseudoNormals {
+    PseudoNormals(const std::vector<Eigen::Vector3d> &vertices,
+                  const std::vector<Eigen::Vector3i> &triangles)
+        : triangle_normals_(triangles.size()),
+          vertex_normals_(vertices.size(), Eigen::Vector3d::Zero()) {
+        for (size_t tidx = 0; tidx < triangles.size(); ++tidx) {
+            const Eigen::Vector3i &triangle = triangles[tidx];
+            Eigen::Vector3d normal =
+                    (vertices[triangle(1)] - vertices[triangle(0)])
+                            .cross(vertices[triangle(2)] -
+                                   vertices[triangle(0)]);
+            if (normal.norm() > 0) {
+                normal.normalize();
+            }
+            triangle_normals_[tidx] = normal;
+            for (int i = 0; i < 3; ++i) {
+                const int v0 = triangle(i);
+                const int v1 = triangle((i + 1) % 3);
+                const int v2 = triangle((i + 2) % 3);
+                const Eigen::Vector3d e1 = vertices[v1] - vertices[v0];
+                const Eigen::Vector3d e2 = vertices[v2] - vertices[v0];
+                const double angle =
+                        std::atan2(e1.cross(e2).norm(), e1.dot(e2));
+                vertex_normals_[v0] += angle * normal;
+                edge_normals_[EdgeKey(v0, v1)] += normal;
+            }
+        }
+    }
+
+    static Eigen::Vector2i EdgeKey(int v0, int v1) {
+        return Eigen::Vector2i(std::min(v0, v1), std::max(v0, v1));
+    }
+
+    // Pseudo-normal of the feature of the triangle containing the point with
+    // barycentric coordinates weights.
+    Eigen::Vector3d Get(const Eigen::Vector3i &triangle,
+                        int tidx,
+                        const Eigen::Vector3d &weights) const {
+        const double eps = 1e-10;
+        int num_zeros = 0;
+        int nonzero = 0;
+        for (int i = 0; i < 3; ++i) {
+            if (weights(i) < eps) {
+                ++num_zeros;
+            } else {
+                nonzero = i;
+            }
+        }
+        if (num_zeros == 2) {
+            return vertex_normals_[triangle(nonzero)];
+        }
+        if (num_zeros == 1) {
+            for (int i = 0; i < 3; ++i) {
+                if (weights(i) < eps) {
+                    return edge_normals_.at(EdgeKey(triangle((i + 1) % 3),
+                                                    triangle((i + 2) % 3)));
+                }
+            }
+        }
+        return triangle_normals_[tidx];
+    }
+
+    std::vector<Eigen::Vector3d> triangle_normals_;
+    std::vector<Eigen::Vector3d> vertex_normals_;
+    std::unordered_map<Eigen::Vector2i,
+                       Eigen::Vector3d,
+                       utility::hash_eigen<Eigen::Vector2i>>
+            edge_normals_;
+};
+
+// Barycentric coordinates of the point p in the triangle (a, b, c).
+Eigen::Vector3d BarycentricCoordinates(const Eigen::Vector3d &p,
+                                       const Eigen::Vector3d &a,
+                                       const Eigen::Vector3d &b,
+                                       const Eigen::Vector3d &c) {
+    const Eigen::Vector3d v0 = b - a;
+    const Eigen::Vector3d v1 = c - a;
+    const Eigen::Vector3d v2 = p - a;
+    const double d00 = v0.dot(v0);
+    const double d01 = v0.dot(v1);
+    const double d11 = v1.dot(v1);
+    const double d20 = v2.dot(v0);
+    const double d21 = v2.dot(v1);
+    const double denom = d00 * d11 - d01 * d01;
+    if (denom == 0) {
+        return Eigen::Vector3d(1, 1, 1) / 3;
+    }
+    const double v = (d11 * d20 - d01 * d21) / denom;
+    const double w = (d00 * d21 - d01 * d20) / denom;
+    return Eigen::Vector3d(1 - v - w, v, w);
+}
+
+// Computes the neighbors of each vertex through the triangle edges, in
+// compressed sparse row layout: the Int64 neighbors of vertex i are
+// neighbors[neighbor_offsets[i]:neighbor_offsets[i + 1]].
+void ComputeVertexAdjacency(const core::Tensor &triangles,
+                            int64_t num_vertices,
+                            core::Tensor &neighbor_offsets,
+                            core::Tensor &neighbors) {
+    const core::Device &device = triangles.GetDevice();
+    // The 6 directed edges of each triangle, sources first.
+    core::Tensor columns(
+            std::vector<int64_t>{0, 1, 2, 1, 2, 0, 1, 2, 0, 0, 1, 2}, {12},
+            core::Dtype::Int64, device);
+    core::Tensor edges = triangles.To(core::Dtype::Int64)
+                                 .T()
+                                 .IndexGet({columns})
+                                 .Reshape({2, -1})
+                                 .T()
+                                 .Contiguous();
+    core::Tensor first_edges;
+    GroupRows(edges, first_edges);
+    edges = edges.IndexGet({first_edges});
+    core::Tensor order;
+    kernel::pointcloud::SortBySegment(edges.T()[0].Contiguous(), num_vertices,
+                                      neighbor_offsets, order);
+    neighbors = edges.T()[1].IndexGet({order}).Contiguous();
+}
+
+// Filters the vertex attributes of the mesh in the scope, running all the
+// steps in each iteration, as the legacy TriangleMesh.
+TriangleMesh FilterVertices(
+        const TriangleMesh &mesh,
+        int number_of_iterations,
+        const std::vector<std::pair<kernel::trianglemesh::NeighborFilter,
+                                    double>> &steps,
+        TriangleMesh::FilterScope scope) {
+    using Scope = TriangleMesh::FilterScope;
+    TriangleMesh filtered(mesh.GetDevice());
+    for (const auto &kv : mesh.GetVertexAttr()) {
+        filtered.SetVertexAttr(kv.first, kv.second.Copy());
+    }
+    for (const auto &kv : mesh.GetTriangleAttr()) {
+        filtered.SetTriangleAttr(kv.first, kv.second.Copy());
+    }
+    if (!mesh.HasVertices()) {
+        return filtered;
+    }
+    std::vector<std::string> keys;
+    if (scope == Scope::All || scope == Scope::Normal) {
+        if (mesh.HasVertexNormals()) {
+            keys.push_back("normals");
+        }
+    }
+    if (scope == Scope::All || scope == Scope::Color) {
+        if (mesh.HasVertexColors()) {
+            keys.push_back("colors");
+        }
+    }
+    // The positions last, since the Laplacian weights depend on them.
+    if (scope == Scope::All || scope == Scope::Vertex) {
+        keys.push_back("vertices");
+    }
+
+    core::Tensor neighbor_offsets, neighbors;
+    if (mesh.HasTriangles()) {
+        ComputeVertexAdjacency(mesh.GetTriangles(),
+                               mesh.GetVertices().GetLength(),
+                               neighbor_offsets, neighbors);
+    } else {
+        neighbor_offsets = core::Tensor::Zeros(
+                {mesh.GetVertices().GetLength() + 1}, core::Dtype::Int64,
+                mesh.GetDevice());
+        neighbors = core::Tensor::Empty({0}, core::Dtype::Int64,
+                                        mesh.GetDevice());
+    }
+    for (int iter = 0; iter < number_of_iterations; ++iter) {
+        for (const auto &step : steps) {
+            core::Tensor weights;
+            if (step.first == kernel::trianglemesh::NeighborFilter::Laplacian) {
+                kernel::trianglemesh::ComputeNeighborWeights(
+                        filtered.GetVertices(), neighbor_offsets, neighbors,
+                        weights);
+            } else {
+                weights = core::Tensor::Empty({0}, core::Dtype::Float64,
+                                              mesh.GetDevice());
+            }
+            for (const std::string &key : keys) {
+                core::Tensor dst;
+                kernel::trianglemesh::FilterVertexAttr(
+                        filtered.GetVertexAttr(key), neighbor_offsets,
+                        neighbors, weights, step.first, step.second, dst);
+                filtered.SetVertexAttr(key, dst);
+            }
+        }
+    }
+    return filtered;
+}
+
+}  // namespace
+
+TriangleMesh &TriangleMesh::RemoveDuplicatedVertices() {
+    if (!HasVertices()) {
+        return *this;
+    }
+    core::Tensor vertices = GetVertices().Contiguous();
+    int64_t n = vertices.GetLength();
+
+    // The hashmap compares keys bitwise, adding zero turns -0 into +0. The
+    // first vertex of each group is kept, in the original order.
+    core::Tensor kept;
+    core::Tensor old_to_new = GroupRows(vertices.Add(0), kept);
+    int64_t num_groups = kept.GetLength();
+    if (num_groups == n) {
+        return *this;
+    }
+
+    if (HasTriangles()) {
+        SetTriangles(RemapTriangles(GetTriangles(), old_to_new));
+    }
+    for (auto &kv : vertex_attr_) {
+        if (kv.first != "vertices" && HasVertexAttr(kv.first)) {
+            kv.second = kv.second.IndexGet({kept});
+        }
+    }
+    SetVertices(vertices.IndexGet({kept}));
+    utility::LogDebug(
+            "[RemoveDuplicatedVertices] {:d} vertices have been removed.",
+            n - num_groups);
+    return *this;
+}
+
+TriangleMesh TriangleMesh::FilterSharpen(int number_of_iterations,
+                                         double strength,
+                                         FilterScope scope) const {
+    return FilterVertices(
+            *this, number_of_iterations,
+            {{kernel::trianglemesh::NeighborFilter::Sharpen, strength}},
+            scope);
+}
+
+TriangleMesh TriangleMesh::FilterSmoothSimple(int number_of_iterations,
+                                              FilterScope scope) const {
+    return FilterVertices(*this, number_of_iterations,
+                          {{kernel::trianglemesh::NeighborFilter::Simple, 0}},
+                          scope);
+}
+
+TriangleMesh TriangleMesh::FilterSmoothLaplacian(int number_of_iterations,
+                                                 double lambda,
+                                                 FilterScope scope) const {
+    return FilterVertices(
+            *this, number_of_iterations,
+            {{kernel::trianglemesh::NeighborFilter::Laplacian, lambda}},
+            scope);
+}
+
+TriangleMesh TriangleMesh::FilterSmoothTaubin(int number_of_iterations,
+                                              double lambda,
+                                              double mu,
+                                              FilterScope scope) const {
+    return FilterVertices(
+            *this, number_of_iterations,
+            {{kernel::trianglemesh::NeighborFilter::Laplacian, lambda},
+             {kernel::trianglemesh::NeighborFilter::Laplacian, mu}},
+            scope);
+}
+
+TriangleMesh TriangleMesh::SimplifyVertexClustering(double voxel_size) const {
+    if (voxel_size <= 0) {
+        utility::LogError(
+                "[SimplifyVertexClustering] voxel_size must be positive, but "
+                "got {}.",
+                voxel_size);
+    }
+    if (!HasVertices()) {
+        return TriangleMesh(device_);
+    }
+
+    // The voxels are aligned as in the legacy TriangleMesh, and numbered in
+    // the order of their first vertex.
+    const core::Tensor &vertices = GetVertices();
+    core::Tensor voxel_min_bound = vertices.Min({0}).Sub(voxel_size * 0.5);
+    core::Tensor voxel_coords = vertices.Sub(voxel_min_bound)
+                                        .Div(voxel_size)
+                                        .Floor()
+                                        .To(core::Dtype::Int32);
+    core::Tensor first_vertices;
+    core::Tensor voxel_ids = GroupRows(voxel_coords, first_vertices);
+    int64_t num_voxels = first_vertices.GetLength();
+
+    // Each vertex attribute is averaged over the vertices of a voxel.
+    core::Tensor offsets, order;
+    kernel::pointcloud::SortBySegment(voxel_ids, num_voxels, offsets, order);
+    TriangleMesh mesh(device_);
+    for (auto &kv : vertex_attr_) {
+        if (!HasVertexAttr(kv.first)) {
+            continue;
+        }
+        core::Tensor mean;
+        kernel::pointcloud::SegmentMean(kv.second.Contiguous(), offsets, order,
+                                        mean);
+        mesh.SetVertexAttr(kv.first, mean);
+    }
+    if (!HasTriangles()) {
+        return mesh;
+    }
+
+    // Only the triangles with vertices in three different voxels are kept.
+    // They are rotated to start at their smallest vertex, and the duplicates
+    // are removed, but triangles of opposite orientation are both kept.
+    const core::Tensor &triangles = GetTriangles();
+    core::Tensor clustered = RemapTriangles(triangles, voxel_ids)
+                                     .To(core::Dtype::Int64)
+                                     .Contiguous();
+    core::Tensor columns = clustered.T();
+    core::Tensor non_degenerate = columns[0]
+                                          .Ne(columns[1])
+                                          .LogicalAnd(columns[1].Ne(columns[2]))
+                                          .LogicalAnd(columns[2].Ne(columns[0]))
+                                          .NonZero()[0];
+    clustered = clustered.IndexGet({non_degenerate});
+    int64_t m = clustered.GetLength();
+    core::Tensor rows =
+            core::Tensor::Arange(0, m, 1, core::Dtype::Int64, device_)
+                    .Reshape({m, 1});
+    core::Tensor rotation = core::Tensor::Arange(0, 3, 1, core::Dtype::Int64,
+                                                 device_)
+                                    .Reshape({1, 3})
+                                    .Add(clustered.ArgMin({1}).Reshape({m, 1}));
+    rotation = rotation.Sub(rotation.Ge(3).To(core::Dtype::Int64).Mul(3));
+    clustered = clustered.Reshape({-1})
+                        .IndexGet({rows.Mul(3).Add(rotation).Reshape({-1})})
+                        .Reshape({m, 3});
+    core::Tensor kept;
+    GroupRows(clustered, kept);
+
+    mesh.SetTriangles(
+            clustered.IndexGet({kept}).To(triangles.GetDtype()).Contiguous());
+    if (HasTriangleNormals()) {
+        mesh.ComputeTriangleNormals();
+    }
+    return mesh;
+}
+
+std::tuple<core::Tensor, core::Tensor, core::Tensor>
+TriangleMesh::ClusterConnectedTriangles() const {
+    const core::Device &device = GetDevice();
+    core::Tensor vertices = GetVertices().Contiguous();
+    core::Tensor triangles =
+            GetTriangles().To(core::Dtype::Int64, /*copy=*/false).Contiguous();
+    int64_t num_triangles = triangles.GetLength();
+    if (num_triangles == 0) {
+        core::Tensor empty =
+                core::Tensor::Empty({0}, core::Dtype::Int64, device);
+        return std::make_tuple(empty, empty.Copy(),
+                               empty.To(core::Dtype::Float64));
+    }
+
+    // Link each triangle to the first triangle of each of its edges.
+    core::Tensor edges, first_edges;
+    kernel::trianglemesh::ComputeTriangleEdges(triangles, edges);
+    core::Tensor edge_ids = GroupRows(edges, first_edges);
+    core::Tensor links =
+            first_edges.Div(3).IndexGet({edge_ids}).Reshape({num_triangles, 3});
+
+    // Hook the roots of linked components and compress the paths until the
+    // links are all inside components. Roots are only linked to smaller
+    // roots, so each triangle ends up labelled with the smallest triangle of
+    // its component.
+    core::Tensor labels = core::Tensor::Arange(0, num_triangles, 1,
+                                               core::Dtype::Int64, device);
+    while (true) {
+        core::Tensor parents = labels.Copy();
+        if (!kernel::trianglemesh::HookComponents(links, labels, parents)) {
+            break;
+        }
+        kernel::trianglemesh::CompressComponents(parents, labels);
+    }
+
+    // Number the clusters in the order of their smallest triangle.
+    core::Tensor roots =
+            labels.Eq(core::Tensor::Arange(0, num_triangles, 1,
+                                           core::Dtype::Int64, device))
+                    .NonZero()[0];
+    int64_t num_clusters = roots.GetLength();
+    core::Tensor cluster_of_root =
+            core::Tensor::Empty({num_triangles}, core::Dtype::Int64, device);
+    cluster_of_root.IndexSet({roots},
+                             core::Tensor::Arange(0, num_clusters, 1,
+                                                  core::Dtype::Int64, device));
+    core::Tensor triangle_clusters = cluster_of_root.IndexGet({labels});
+
+    core::Tensor offsets, order, mean_areas;
+    kernel::pointcloud::SortBySegment(triangle_clusters, num_clusters, offsets,
+                                      order);
+    core::Tensor cluster_num_triangles =
+            offsets.Slice(0, 1, num_clusters + 1)
+                    .Sub(offsets.Slice(0, 0, num_clusters));
+    core::Tensor cross = core::Tensor::Empty(
+            triangles.GetShape(), vertices.GetDtype(), device);
+    kernel::trianglemesh::ComputeTriangleNormals(vertices, triangles, cross);
+    cross = cross.To(core::Dtype::Float64);
+    kernel::pointcloud::SegmentMean(cross.Mul(cross).Sum({1}).Sqrt().Mul(0.5),
+                                    offsets, order, mean_areas);
+    core::Tensor cluster_areas = mean_areas.Mul(
+            cluster_num_triangles.To(core::Dtype::Float64));
+    return std::make_tuple(triangle_clusters, cluster_num_triangles,
+                           cluster_areas);
+}
+
+TriangleMesh TriangleMesh::SelectByMask(const core::Tensor &mask,
+                                        bool invert) const {
+    int64_t num_vertices = HasVertices() ? GetVertices().GetLength() : 0;
+    mask.AssertShape({num_vertices});
+    mask.AssertDtype(core::Dtype::Bool);
+    mask.AssertDevice(device_);
+    core::Tensor vertex_mask = invert ? mask.LogicalNot() : mask;
+
+    TriangleMesh selected(device_);
+    TensorMap vertex_attrs(vertex_attr_.GetPrimaryKey());
+    for (auto &kv : vertex_attr_) {
+        if (HasVertexAttr(kv.first)) {
+            vertex_attrs[kv.first] = kv.second;
+        }
+    }
+    core::Tensor kept_vertices = vertex_mask.NonZero()[0];
+    for (auto &kv : vertex_attrs.IndexGet(kept_vertices)) {
+        selected.SetVertexAttr(kv.first, kv.second);
+    }
+    if (!HasTriangles()) {
+        return selected;
+    }
+
+    // Keep the triangles with all their vertices selected.
+    core::Tensor triangles = GetTriangles();
+    int64_t num_triangles = triangles.GetLength();
+    core::Tensor kept_triangles =
+            vertex_mask
+                    .IndexGet({triangles.To(core::Dtype::Int64).Reshape({-1})})
+                    .Reshape({num_triangles, 3})
+                    .To(core::Dtype::Int64)
+                    .Sum({1})
+                    .Eq(3)
+                    .NonZero()[0];
+    TensorMap triangle_attrs(triangle_attr_.GetPrimaryKey());
+    for (auto &kv : triangle_attr_) {
+        if (HasTriangleAttr(kv.first)) {
+            triangle_attrs[kv.first] = kv.second;
+        }
+    }
+    for (auto &kv : triangle_attrs.IndexGet(kept_triangles)) {
+        selected.SetTriangleAttr(kv.first, kv.second);
+    }
+
+    core::Tensor old_to_new = core::Tensor::Full(
+            {num_vertices}, -1, core::Dtype::Int64, device_);
+    old_to_new.IndexSet({kept_vertices},
+                        core::Tensor::Arange(0, kept_vertices.GetLength(), 1,
+                                             core::Dtype::Int64, device_));
+    selected.SetTriangles(
+            RemapTriangles(selected.GetTriangles(), old_to_new));
+    return selected;
+}
+
+TriangleMesh TriangleMesh::SelectByIndex(const core::Tensor &indices,
+                                         bool invert) const {
+    indices.AssertDtype(core::Dtype::Int64);
+    indices.AssertDevice(device_);
+    int64_t num_vertices = HasVertices() ? GetVertices().GetLength() : 0;
+    core::Tensor flat_indices = indices.Reshape({-1});
+    int64_t num_indices = flat_indices.GetLength();
+    if (num_indices > 0 &&
+        (flat_indices.Min({0}).Item<int64_t>() < 0 ||
+         flat_indices.Max({0}).Item<int64_t>() >= num_vertices)) {
+        utility::LogError(
+                "[SelectByIndex] indices must be in [0, {}).", num_vertices);
+    }
+    core::Tensor mask =
+            core::Tensor::Zeros({num_vertices}, core::Dtype::Bool, device_);
+    mask.IndexSet({flat_indices}, core::Tensor::Ones({num_indices},
+                                                     core::Dtype::Bool,
+                                                     device_));
+    return SelectByMask(mask, invert);
+}
+
+TriangleMesh TriangleMesh::Crop(
+        const open3d::geometry::AxisAlignedBoundingBox &bbox) const {
+    if (bbox.IsEmpty()) {
+        utility::LogError(
+                "[CropTriangleMesh] AxisAlignedBoundingBox either has zeros "
+                "size, or has wrong bounds.");
+    }
+    return SelectByMask(ComputeBoxMask(GetVertices(), Eigen::Vector3d::Zero(),
+                                       Eigen::Matrix3d::Identity(),
+                                       bbox.min_bound_, bbox.max_bound_));
+}
+
+TriangleMesh TriangleMesh::Crop(
+        const open3d::geometry::OrientedBoundingBox &bbox) const {
+    if (bbox.IsEmpty()) {
+        utility::LogError(
+                "[CropTriangleMesh] OrientedBoundingBox either has zeros "
+                "size, or has wrong bounds.");
+    }
+    Eigen::Vector3d half_extent = bbox.extent_ / 2;
+    return SelectByMask(ComputeBoxMask(GetVertices(), bbox.center_,
+                                       bbox.R_.transpose(), -half_extent,
+                                       half_extent));
+}
+
+PointCloud TriangleMesh::SamplePointsUniformly(int64_t number_of_points,
+                                               bool use_triangle_normal,
+                                               int seed) const {
+    if (number_of_points <= 0) {
+        utility::LogError(
+                "[SamplePointsUniformly] number_of_points must be positive, "
+                "but got {}.",
+                number_of_points);
+    }
+    if (!HasTriangles()) {
+        utility::LogError(
+                "[SamplePointsUniformly] input mesh has no triangles.");
+    }
+    double surface_area;
+    return SamplePointsOnTriangles(*this, number_of_points,
+                                   use_triangle_normal, seed, surface_area);
+}
+
+PointCloud TriangleMesh::SamplePointsPoissonDisk(int64_t number_of_points,
+                                                 double init_factor,
+                                                 bool use_triangle_normal,
+                                                 int seed) const {
+    if (number_of_points <= 0) {
+        utility::LogError(
+                "[SamplePointsPoissonDisk] number_of_points must be positive, "
+                "but got {}.",
+                number_of_points);
+    }
+    if (init_factor < 1) {
+        utility::LogError(
+                "[SamplePointsPoissonDisk] init_factor must be at least 1, but "
+                "got {}.",
+                init_factor);
+    }
+    if (!HasTriangles()) {
+        utility::LogError(
+                "[SamplePointsPoissonDisk] input mesh has no triangles.");
+    }
+
+    double surface_area;
+    PointCloud pcd = SamplePointsOnTriangles(
+            *this, static_cast<int64_t>(init_factor * number_of_points),
+            use_triangle_normal, seed, surface_area);
+    core::Tensor points = pcd.GetPoints();
+    int64_t n = points.GetLength();
+
+    // Weight function of the paper, with the radii of the legacy TriangleMesh.
+    const double alpha = 8;
+    const double beta = 0.5;
+    const double gamma = 1.5;
+    double ratio = double(number_of_points) / double(n);
+    double r_max = 2 * std::sqrt((surface_area / number_of_points) /
+                                 (2 * std::sqrt(3.)));
+    double r_min = r_max * beta * (1 - std::pow(ratio, gamma));
+
+    core::Tensor cell_ids, neighbor_cells, cell_offsets, cell_order;
+    BuildSampleGrid(points, r_max, cell_ids, neighbor_cells, cell_offsets,
+                    cell_order);
+
+    // Each round eliminates the points heavier than all their neighbors. The
+    // heaviest point is one of them, so every round makes progress.
+    core::Tensor alive = core::Tensor::Ones({n}, core::Dtype::Bool, device_);
+    int64_t num_alive = n;
+    while (num_alive > number_of_points) {
+        core::Tensor weights, local_maxima;
+        kernel::trianglemesh::ComputeEliminationWeights(
+                points, alive, cell_ids, neighbor_cells, cell_offsets,
+                cell_order, r_max, r_min, alpha, weights);
+        kernel::trianglemesh::FindEliminationCandidates(
+                points, alive, weights, cell_ids, neighbor_cells,
+                cell_offsets, cell_order, r_max, local_maxima);
+        core::Tensor candidates = local_maxima.NonZero()[0];
+
+        // The last round only eliminates the heaviest candidates.
+        int64_t num_excess = num_alive - number_of_points;
+        if (candidates.GetLength() > num_excess) {
+            std::vector<int64_t> ids = candidates.ToFlatVector<int64_t>();
+            std::vector<double> candidate_weights =
+                    weights.IndexGet({candidates}).ToFlatVector<double>();
+            std::vector<int64_t> ranks(ids.size());
+            std::iota(ranks.begin(), ranks.end(), 0);
+            std::nth_element(ranks.begin(), ranks.begin() + num_excess,
+                             ranks.end(), [&](int64_t a, int64_t b) {
+                                 return candidate_weights[a] >
+                                                candidate_weights[b] ||
+                                        (candidate_weights[a] ==
+                                                 candidate_weights[b] &&
+                                         ids[a] < ids[b]);
+                             });
+            std::vector<int64_t> eliminated(num_excess);
+            for (int64_t i = 0; i < num_excess; ++i) {
+                eliminated[i] = ids[ranks[i]];
+            }
+            candidates = core::Tensor(eliminated, {num_excess},
+                                      core::Dtype::Int64, device_);
+        }
+        alive.IndexSet({candidates},
+                       core::Tensor::Zeros({candidates.GetLength()},
+                                           core::Dtype::Bool, device_));
+        num_alive -= candidates.GetLength();
+    }
+
+    core::Tensor kept = alive.NonZero()[0];
+    PointCloud sampled(points.IndexGet({kept}));
+    if (pcd.HasPointNormals()) {
+        sampled.SetPointNormals(pcd.GetPointNormals().IndexGet({kept}));
+    }
+    if (pcd.HasPointColors()) {
+        sampled.SetPointColors(pcd.GetPointColors().IndexGet({kept}));
+    }
+    return sampled;
+}
+
+core::Tensor TriangleMesh::ComputeDistance(const core::Tensor &query_points,
+                                           bool signed_distance,
+                                           double max_distance) const {
+    query_points.AssertShapeCompatible({utility::nullopt, 3});
+    const core::Dtype dtype = query_points.GetDtype();
+    if (dtype != core::Dtype::Float32 && dtype != core::Dtype::Float64) {
+        utility::LogError(
+                "[ComputeDistance] query_points must be Float32 or Float64, "
+                "but got {}.",
+                dtype.ToString());
+    }
+    if (!HasTriangles()) {
+        utility::LogError("[ComputeDistance] input mesh has no triangles.");
+    }
+
+    const std::vector<Eigen::Vector3d> vertices =
+            core::eigen_converter::TensorToEigenVector3dVector(GetVertices());
+    const std::vector<Eigen::Vector3i> triangles =
+            core::eigen_converter::TensorToEigenVector3iVector(GetTriangles());
+    const std::vector<Eigen::Vector3d> points =
+            core::eigen_converter::TensorToEigenVector3dVector(query_points);
+    const open3d::geometry::TriangleBVH bvh(vertices, triangles);
+    std::unique_ptr<PseudoNormals> pseudo_normals;
+    if (signed_distance) {
+        pseudo_normals.reset(new PseudoNormals(vertices, triangles));
+    }
+
+    const double search_distance = max_distance > 0
+                                           ? max_distance
+                                           : std::numeric_limits<
+                                                     double>::infinity();
+    std::vector<double> distances(points.size());
+#pragma omp parallel for schedule(dynamic, 256) num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < int64_t(points.size()); ++i) {
+        int tidx;
+        Eigen::Vector3d closest;
+        double distance2;
+        std::tie(tidx, closest, distance2) =
+                bvh.ComputeClosestPoint(points[i], search_distance);
+        if (tidx < 0) {
+            distances[i] = max_distance;
+            continue;
+        }
+        distances[i] = std::sqrt(distance2);
+        if (signed_distance) {
+            const Eigen::Vector3i &triangle = triangles[tidx];
+            const Eigen::Vector3d weights = BarycentricCoordinates(
+                    closest, vertices[triangle(0)], vertices[triangle(1)],
+                    vertices[triangle(2)]);
+            if ((points[i] - closest)
+                        .dot(pseudo_normals->Get(triangle, tidx, weights)) <
+                0) {
+                distances[i] = -distances[i];
+            }
+        }
+    }
+    return core::Tensor(distances, {int64_t(distances.size())},
+                        core::Dtype::Float64, query_points.GetDevice())
+            .To(dtype);
+}
+
 geometry::TriangleMesh TriangleMesh::FromLegacyTriangleMesh(
         const open3d::geometry::TriangleMesh &mesh_legacy,
         core::Dtype float_dtype,
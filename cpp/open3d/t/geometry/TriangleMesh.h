@@ -26,9 +26,13 @@
 
 #pragma once
 
+#include <tuple>
+
 #include "open3d/core/Tensor.h"
+#include "open3d/geometry/BoundingVolume.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/t/geometry/Geometry.h"
+#include "open3d/t/geometry/PointCloud.h"
 #include "open3d/t/geometry/TensorMap.h"
 
 namespace open3d {
@@ -105,6 +109,9 @@ namespace geometry {
 /// via the generalized helper functions.
 class TriangleMesh : public Geometry {
 public:
+    /// Vertex attributes changed by the filters, as in the legacy mesh.
+    using FilterScope = open3d::geometry::MeshBase::FilterScope;
+
     /// Construct an empty trianglemesh.
     TriangleMesh(const core::Device &device = core::Device("CPU:0"));
 
@@ -347,34 +354,284 @@ public:
     TriangleMesh &Clear() override {
         vertex_attr_.clear();
         triangle_attr_.clear();
+        vertex_attr_.Shrink();
+        triangle_attr_.Shrink();
         return *this;
     }
 
     /// Returns !HasVertices(), triangles are ignored.
     bool IsEmpty() const override { return !HasVertices(); }
 
-    core::Tensor GetMinBound() const { utility::LogError("Unimplemented"); }
+    /// \brief Appends the vertices and triangles of \p other, in-place. The
+    /// triangles of \p other are offset by the number of vertices.
+    ///
+    /// \p other must be on the same device and have the same attributes.
+    /// The attributes over-allocate their memory, so that accumulating many
+    /// meshes takes amortized linear time. Use Shrink() to release the
+    /// reserved memory once done.
+    TriangleMesh &Append(const TriangleMesh &other);
+
+    /// Releases the memory reserved by Append().
+    TriangleMesh &Shrink() {
+        vertex_attr_.Shrink();
+        triangle_attr_.Shrink();
+        return *this;
+    }
 
-    core::Tensor GetMaxBound() const { utility::LogError("Unimplemented"); }
+    /// Returns the min bound for vertex coordinates.
+    core::Tensor GetMinBound() const;
 
-    core::Tensor GetCenter() const { utility::LogError("Unimplemented"); }
+    /// Returns the max bound for vertex coordinates.
+    core::Tensor GetMaxBound() const;
 
-    TriangleMesh &Transform(const core::Tensor &transformation) {
-        utility::LogError("Unimplemented");
-    }
+    /// Returns the center for vertex coordinates.
+    core::Tensor GetCenter() const;
 
+    /// \brief Transforms the vertices, vertex normals and triangle normals
+    /// (if exist) of the TriangleMesh.
+    ///
+    /// \param transformation Transformation [Tensor of dim {4,4}], on the
+    /// same device as the TriangleMesh. The last row is assumed to be
+    /// [0, 0, 0, 1]. The vertices and the normals are updated in place in a
+    /// single kernel.
+    /// \return Transformed TriangleMesh.
+    TriangleMesh &Transform(const core::Tensor &transformation);
+
+    /// \brief Translates the vertices of the TriangleMesh.
+    ///
+    /// \param translation Translation [Tensor of dim {3}], on the same device
+    /// as the TriangleMesh.
+    /// \param relative If true (default), translates relative to the center,
+    /// otherwise moves the center to \p translation.
+    /// \return Translated TriangleMesh.
     TriangleMesh &Translate(const core::Tensor &translation,
-                            bool relative = true) {
-        utility::LogError("Unimplemented");
-    }
+                            bool relative = true);
 
-    TriangleMesh &Scale(double scale, const core::Tensor &center) {
-        utility::LogError("Unimplemented");
-    }
+    /// \brief Scales the vertices of the TriangleMesh.
+    ///
+    /// \param scale Scale factor.
+    /// \param center Center [Tensor of dim {3}] about which the TriangleMesh
+    /// is scaled, on the same device as the TriangleMesh.
+    /// \return Scaled TriangleMesh.
+    TriangleMesh &Scale(double scale, const core::Tensor &center);
+
+    /// \brief Rotates the vertices, vertex normals and triangle normals (if
+    /// exist) of the TriangleMesh.
+    ///
+    /// \param R Rotation [Tensor of dim {3,3}], on the same device as the
+    /// TriangleMesh.
+    /// \param center Center [Tensor of dim {3}] about which the TriangleMesh
+    /// is rotated, on the same device as the TriangleMesh.
+    /// \return Rotated TriangleMesh.
+    TriangleMesh &Rotate(const core::Tensor &R, const core::Tensor &center);
+
+    /// \brief Computes the triangle normals as the cross products of the
+    /// triangle edges, on the device of the TriangleMesh.
+    ///
+    /// \param normalized If true, the normals are normalized.
+    TriangleMesh &ComputeTriangleNormals(bool normalized = true);
 
-    TriangleMesh &Rotate(const core::Tensor &R, const core::Tensor &center) {
-        utility::LogError("Unimplemented");
-    }
+    /// \brief Computes the vertex normals as the sums of the normals of the
+    /// adjacent triangles, on the device of the TriangleMesh.
+    ///
+    /// Unnormalized triangle normals are computed first if there are no
+    /// triangle normals, which weighs the triangles by their area.
+    ///
+    /// \param normalized If true, the normals are normalized.
+    TriangleMesh &ComputeVertexNormals(bool normalized = true);
+
+    /// \brief Merges the vertices with exactly the same coordinates, on the
+    /// device of the TriangleMesh.
+    ///
+    /// Each group of duplicated vertices is replaced by its first vertex,
+    /// including its other attributes, and the triangles are updated
+    /// accordingly. The remaining vertices keep their relative order.
+    TriangleMesh &RemoveDuplicatedVertices();
+
+    /// \brief Sharpens the mesh, as
+    /// open3d::geometry::TriangleMesh::FilterSharpen, on the device of the
+    /// TriangleMesh.
+    ///
+    /// The vertex adjacency is computed once, and each iteration updates all
+    /// the vertices in parallel from the values of the previous iteration.
+    /// The attributes outside of the scope are copied unchanged.
+    ///
+    /// \param number_of_iterations Number of repetitions of the filter.
+    /// \param strength Strength of the filter.
+    /// \param scope Vertex attributes that are filtered.
+    /// \return The filtered TriangleMesh.
+    TriangleMesh FilterSharpen(
+            int number_of_iterations = 1,
+            double strength = 1,
+            FilterScope scope = FilterScope::All) const;
+
+    /// \brief Smoothes the mesh by averaging each vertex with its neighbors,
+    /// as open3d::geometry::TriangleMesh::FilterSmoothSimple, on the device
+    /// of the TriangleMesh.
+    ///
+    /// \param number_of_iterations Number of repetitions of the filter.
+    /// \param scope Vertex attributes that are filtered.
+    /// \return The filtered TriangleMesh.
+    TriangleMesh FilterSmoothSimple(
+            int number_of_iterations = 1,
+            FilterScope scope = FilterScope::All) const;
+
+    /// \brief Smoothes the mesh with Laplacian steps weighted by the inverse
+    /// distances to the neighbors, as
+    /// open3d::geometry::TriangleMesh::FilterSmoothLaplacian, on the device
+    /// of the TriangleMesh.
+    ///
+    /// \param number_of_iterations Number of repetitions of the filter.
+    /// \param lambda Step size of the Laplacian.
+    /// \param scope Vertex attributes that are filtered.
+    /// \return The filtered TriangleMesh.
+    TriangleMesh FilterSmoothLaplacian(
+            int number_of_iterations = 1,
+            double lambda = 0.5,
+            FilterScope scope = FilterScope::All) const;
+
+    /// \brief Smoothes the mesh with pairs of Laplacian steps of sizes lambda
+    /// and mu, as open3d::geometry::TriangleMesh::FilterSmoothTaubin, on the
+    /// device of the TriangleMesh.
+    ///
+    /// \param number_of_iterations Number of repetitions of the filter.
+    /// \param lambda Step size of the shrinking Laplacian.
+    /// \param mu Step size of the inflating Laplacian, negative.
+    /// \param scope Vertex attributes that are filtered.
+    /// \return The filtered TriangleMesh.
+    TriangleMesh FilterSmoothTaubin(
+            int number_of_iterations = 1,
+            double lambda = 0.5,
+            double mu = -0.53,
+            FilterScope scope = FilterScope::All) const;
+
+    /// \brief Simplifies the mesh by clustering its vertices in voxels, on
+    /// the device of the TriangleMesh.
+    ///
+    /// The vertices in a voxel are replaced by a vertex with their average
+    /// attributes, numbered in the order of their first vertex. Triangles
+    /// with two vertices in the same voxel are removed, and so are duplicated
+    /// triangles. Triangle normals are recomputed if present, other triangle
+    /// attributes are dropped.
+    ///
+    /// \param voxel_size Edge length of the voxels, must be positive.
+    /// \return The simplified TriangleMesh.
+    TriangleMesh SimplifyVertexClustering(double voxel_size) const;
+
+    /// \brief Clusters the triangles connected through their edges, on the
+    /// device of the TriangleMesh.
+    ///
+    /// The components are found by hooking and path compression over the
+    /// edges, with the same cluster order as
+    /// open3d::geometry::TriangleMesh::ClusterConnectedTriangles, that is in
+    /// the order of their first triangle.
+    ///
+    /// \return A tuple of an Int64 tensor of shape {m,} with the cluster of
+    /// each triangle, an Int64 tensor of shape {c,} with the number of
+    /// triangles of each cluster, and a Float64 tensor of shape {c,} with the
+    /// surface area of each cluster.
+    std::tuple<core::Tensor, core::Tensor, core::Tensor>
+    ClusterConnectedTriangles() const;
+
+    /// \brief Selects the vertices where \p mask is true and the triangles
+    /// between them, with all their attributes, on the device of the
+    /// TriangleMesh.
+    ///
+    /// The vertex and the triangle attributes are each gathered together in
+    /// a single kernel launch, and the triangles are renumbered.
+    ///
+    /// \param mask Bool tensor of shape {n,} over the vertices.
+    /// \param invert If true, selects the vertices where \p mask is false.
+    /// \return TriangleMesh of the selected vertices, in their original
+    /// order, and of the triangles with all their vertices selected.
+    TriangleMesh SelectByMask(const core::Tensor &mask,
+                              bool invert = false) const;
+
+    /// \brief Selects the vertices of \p indices and the triangles between
+    /// them, as open3d::geometry::TriangleMesh::SelectByIndex without
+    /// cleanup.
+    ///
+    /// \param indices Int64 tensor of vertex indices in [0, n). Duplicated
+    /// indices select the vertex once.
+    /// \param invert If true, selects the vertices not in \p indices.
+    /// \return TriangleMesh of the selected vertices, in their original
+    /// order, and of the triangles with all their vertices selected.
+    TriangleMesh SelectByIndex(const core::Tensor &indices,
+                               bool invert = false) const;
+
+    /// \brief Crops the TriangleMesh to the vertices inside an axis-aligned
+    /// bounding box, bounds included, and the triangles between them.
+    ///
+    /// \param bbox Axis-aligned bounding box, must not be empty.
+    /// \return The cropped TriangleMesh.
+    TriangleMesh Crop(
+            const open3d::geometry::AxisAlignedBoundingBox &bbox) const;
+
+    /// \brief Crops the TriangleMesh to the vertices inside an oriented
+    /// bounding box, bounds included, and the triangles between them.
+    ///
+    /// \param bbox Oriented bounding box, must not be empty.
+    /// \return The cropped TriangleMesh.
+    TriangleMesh Crop(const open3d::geometry::OrientedBoundingBox &bbox) const;
+
+    /// \brief Samples points uniformly on the surface of the mesh, on the
+    /// device of the TriangleMesh.
+    ///
+    /// Each point independently picks a triangle with a probability
+    /// proportional to its area and a uniform position in it. The vertex
+    /// normals and colors are interpolated if present.
+    ///
+    /// \param number_of_points Number of points to sample.
+    /// \param use_triangle_normal If true, the points get the normal of their
+    /// triangle instead of the interpolated vertex normals. The triangle
+    /// normals are computed if the mesh has none, without being stored.
+    /// \param seed Seed of the random generator, -1 for a random seed.
+    /// \return The sampled PointCloud.
+    PointCloud SamplePointsUniformly(int64_t number_of_points,
+                                     bool use_triangle_normal = false,
+                                     int seed = -1) const;
+
+    /// \brief Samples evenly spaced points (blue noise) on the surface of the
+    /// mesh, on the device of the TriangleMesh.
+    ///
+    /// init_factor x number_of_points points are sampled uniformly, then
+    /// eliminated as in Yuksel, "Sample Elimination for Generating Poisson
+    /// Disk Sample Sets", EUROGRAPHICS, 2015. Instead of removing one point
+    /// at a time, each round removes together the points whose weight is
+    /// larger than the weights of all their neighbors.
+    ///
+    /// \param number_of_points Number of points to keep.
+    /// \param init_factor Ratio of uniformly sampled to kept points, larger
+    /// than 1.
+    /// \param use_triangle_normal If true, the points get the normal of their
+    /// triangle instead of the interpolated vertex normals.
+    /// \param seed Seed of the random generator, -1 for a random seed.
+    /// \return The sampled PointCloud.
+    PointCloud SamplePointsPoissonDisk(int64_t number_of_points,
+                                       double init_factor = 5,
+                                       bool use_triangle_normal = false,
+                                       int seed = -1) const;
+
+    /// \brief Computes the distances from query points to the surface of the
+    /// mesh.
+    ///
+    /// The closest points are found with a open3d::geometry::TriangleBVH, on
+    /// the CPU in parallel over the query points. The sign of a distance is
+    /// given by the angle-weighted pseudo-normal of the closest triangle,
+    /// edge or vertex, so it is only meaningful for closed, consistently
+    /// oriented meshes.
+    ///
+    /// \param query_points Float32 or Float64 tensor of shape {n, 3}.
+    /// \param signed_distance If true, the distances of the points inside
+    /// the mesh are negative.
+    /// \param max_distance If positive, the search for the closest point
+    /// stops at max_distance and the farther points get the distance
+    /// max_distance, without a sign.
+    /// \return Tensor of shape {n,} with the distances, with the dtype and
+    /// device of query_points.
+    core::Tensor ComputeDistance(const core::Tensor &query_points,
+                                 bool signed_distance = false,
+                                 double max_distance = 0.0) const;
 
     core::Device GetDevice() const { return device_; }
 
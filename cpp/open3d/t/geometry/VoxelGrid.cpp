@@ -0,0 +1,314 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/VoxelGrid.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "open3d/t/geometry/kernel/PointCloud.h"
+#include "open3d/t/geometry/kernel/VoxelGrid.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+VoxelGrid::VoxelGrid(float voxel_size,
+                     const core::Tensor &origin,
+                     int64_t init_capacity,
+                     const core::Device &device)
+    : voxel_size_(voxel_size), device_(device) {
+    if (voxel_size <= 0) {
+        utility::LogError("[VoxelGrid] voxel_size <= 0.");
+    }
+    origin.AssertShape({3});
+    origin_ = origin.To(core::Dtype::Float32).Copy(core::Device("CPU:0"));
+    voxel_hashmap_ = std::make_shared<core::Hashmap>(
+            init_capacity, core::Dtype::Int32, core::Dtype::Float32,
+            core::SizeVector{3}, core::SizeVector{3}, device);
+}
+
+VoxelGrid VoxelGrid::CreateFromPointCloud(const PointCloud &pcd,
+                                          float voxel_size) {
+    core::Device device = pcd.GetDevice();
+    if (!pcd.HasPoints()) {
+        utility::LogWarning("[CreateFromPointCloud] point cloud is empty.");
+        return VoxelGrid(voxel_size,
+                         core::Tensor::Zeros({3}, core::Dtype::Float32), 1000,
+                         device);
+    }
+
+    core::Tensor points = pcd.GetPoints().To(core::Dtype::Float32);
+    core::Tensor origin = points.Min({0}).Sub(0.5f * voxel_size);
+    int64_t n = points.GetLength();
+    VoxelGrid voxel_grid(voxel_size, origin, n, device);
+    voxel_grid.InsertVoxels(
+            voxel_grid.GetVoxelIndices(points),
+            pcd.HasPointColors() ? pcd.GetPointColors() : core::Tensor());
+    utility::LogDebug(
+            "Pointcloud is voxelized from {:d} points to {:d} voxels.", n,
+            voxel_grid.NumVoxels());
+    return voxel_grid;
+}
+
+VoxelGrid VoxelGrid::CreateFromTriangleMesh(const TriangleMesh &mesh,
+                                            float voxel_size) {
+    core::Device device = mesh.GetDevice();
+    if (!mesh.HasVertices() || !mesh.HasTriangles()) {
+        utility::LogWarning("[CreateFromTriangleMesh] mesh is empty.");
+        return VoxelGrid(voxel_size,
+                         core::Tensor::Zeros({3}, core::Dtype::Float32), 1000,
+                         device);
+    }
+
+    core::Tensor vertices = mesh.GetVertices().To(core::Dtype::Float32);
+    core::Tensor origin = vertices.Min({0}).Sub(0.5f * voxel_size);
+    VoxelGrid voxel_grid(voxel_size, origin, mesh.GetTriangles().GetLength(),
+                         device);
+
+    core::Tensor voxel_keys;
+    kernel::voxel_grid::VoxelizeTriangles(
+            vertices.Contiguous(),
+            mesh.GetTriangles().To(core::Dtype::Int64).Contiguous(),
+            voxel_grid.origin_, voxel_size, voxel_keys);
+    voxel_grid.InsertVoxels(voxel_keys, core::Tensor());
+    return voxel_grid;
+}
+
+VoxelGrid &VoxelGrid::CarveDepthMap(const Image &depth,
+                                    const core::Tensor &intrinsics,
+                                    const core::Tensor &extrinsics,
+                                    bool keep_voxels_outside_image,
+                                    float depth_scale) {
+    if (depth.GetChannels() != 1) {
+        utility::LogError("[CarveDepthMap] depth must have a single channel.");
+    }
+    if (!HasVoxels()) {
+        return *this;
+    }
+
+    core::Tensor voxel_keys = GetVoxelCoordinates();
+    core::Tensor keep_mask;
+    kernel::voxel_grid::Carve(
+            voxel_keys,
+            depth.AsTensor().To(core::Dtype::Float32).Div(depth_scale),
+            intrinsics, extrinsics, origin_, voxel_size_, true,
+            keep_voxels_outside_image, keep_mask);
+    EraseVoxels(voxel_keys, keep_mask);
+    return *this;
+}
+
+VoxelGrid &VoxelGrid::CarveSilhouette(const Image &silhouette_mask,
+                                      const core::Tensor &intrinsics,
+                                      const core::Tensor &extrinsics,
+                                      bool keep_voxels_outside_image) {
+    if (silhouette_mask.GetChannels() != 1) {
+        utility::LogError(
+                "[CarveSilhouette] silhouette_mask must have a single "
+                "channel.");
+    }
+    if (!HasVoxels()) {
+        return *this;
+    }
+
+    core::Tensor voxel_keys = GetVoxelCoordinates();
+    core::Tensor keep_mask;
+    kernel::voxel_grid::Carve(
+            voxel_keys, silhouette_mask.AsTensor().To(core::Dtype::Float32),
+            intrinsics, extrinsics, origin_, voxel_size_, false,
+            keep_voxels_outside_image, keep_mask);
+    EraseVoxels(voxel_keys, keep_mask);
+    return *this;
+}
+
+core::Tensor VoxelGrid::CheckIfIncluded(const core::Tensor &queries) {
+    queries.AssertShapeCompatible({utility::nullopt, 3});
+    if (queries.GetDevice() != device_) {
+        utility::LogError(
+                "[CheckIfIncluded] queries are on {}, but the voxel grid is "
+                "on {}.",
+                queries.GetDevice().ToString(), device_.ToString());
+    }
+
+    core::Tensor addrs, masks;
+    voxel_hashmap_->Find(GetVoxelIndices(queries), addrs, masks);
+    return masks;
+}
+
+core::Tensor VoxelGrid::GetVoxelIndices(const core::Tensor &points) const {
+    return points.To(core::Dtype::Float32)
+            .Sub(origin_.Copy(points.GetDevice()))
+            .Div(voxel_size_)
+            .Floor()
+            .To(core::Dtype::Int32)
+            .Contiguous();
+}
+
+core::Tensor VoxelGrid::GetVoxelCoordinates() {
+    core::Tensor active_addrs;
+    voxel_hashmap_->GetActiveIndices(active_addrs);
+    return voxel_hashmap_->GetKeyTensor().IndexGet(
+            {active_addrs.To(core::Dtype::Int64)});
+}
+
+core::Tensor VoxelGrid::GetVoxelColors() {
+    core::Tensor active_addrs;
+    voxel_hashmap_->GetActiveIndices(active_addrs);
+    return voxel_hashmap_->GetValueTensor().IndexGet(
+            {active_addrs.To(core::Dtype::Int64)});
+}
+
+core::Tensor VoxelGrid::GetVoxelCenterCoordinates() {
+    return GetVoxelCoordinates()
+            .To(core::Dtype::Float32)
+            .Add(0.5f)
+            .Mul(voxel_size_)
+            .Add(origin_.Copy(device_));
+}
+
+void VoxelGrid::InsertVoxels(const core::Tensor &voxel_keys,
+                             const core::Tensor &colors) {
+    if (voxel_keys.GetLength() == 0) {
+        return;
+    }
+
+    core::Tensor addrs, masks;
+    voxel_hashmap_->InsertOrFind(voxel_keys, addrs, masks);
+    core::Tensor new_addrs = addrs.IndexGet({masks}).To(core::Dtype::Int64);
+    int64_t num_new = new_addrs.GetLength();
+    if (num_new == 0) {
+        return;
+    }
+
+    // The value tensor is taken after the insertion, which may have grown the
+    // buffer.
+    core::Tensor values = voxel_hashmap_->GetValueTensor();
+    if (colors.NumElements() == 0) {
+        values.IndexSet({new_addrs},
+                        core::Tensor::Zeros({num_new, 3}, core::Dtype::Float32,
+                                            device_));
+        return;
+    }
+
+    // Average the colors over each voxel, with the buffer addresses as the
+    // segments.
+    core::Tensor offsets, order, means;
+    kernel::pointcloud::SortBySegment(addrs.To(core::Dtype::Int64),
+                                      voxel_hashmap_->GetCapacity(), offsets,
+                                      order);
+    kernel::pointcloud::SegmentMean(
+            colors.To(core::Dtype::Float32).Contiguous(), offsets, order,
+            means);
+    values.IndexSet({new_addrs}, means.IndexGet({new_addrs}));
+}
+
+void VoxelGrid::EraseVoxels(const core::Tensor &voxel_keys,
+                            const core::Tensor &keep_mask) {
+    core::Tensor erase_keys =
+            voxel_keys.IndexGet({keep_mask.LogicalNot()}).Contiguous();
+    if (erase_keys.GetLength() == 0) {
+        return;
+    }
+    core::Tensor masks;
+    voxel_hashmap_->Erase(erase_keys, masks);
+}
+
+VoxelGrid VoxelGrid::Copy(const core::Device &device) {
+    VoxelGrid device_voxel_grid(voxel_size_, origin_,
+                                voxel_hashmap_->GetCapacity(), device);
+    *device_voxel_grid.voxel_hashmap_ = voxel_hashmap_->Copy(device);
+    return device_voxel_grid;
+}
+
+VoxelGrid VoxelGrid::CPU() {
+    if (GetDevice().GetType() == core::Device::DeviceType::CPU) {
+        return *this;
+    }
+    return Copy(core::Device("CPU:0"));
+}
+
+VoxelGrid VoxelGrid::CUDA(int device_id) {
+    core::Device device =
+            core::Device(core::Device::DeviceType::CUDA, device_id);
+    if (GetDevice() == device) {
+        return *this;
+    }
+    return Copy(device);
+}
+
+VoxelGrid VoxelGrid::FromLegacyVoxelGrid(
+        const open3d::geometry::VoxelGrid &voxel_grid_legacy,
+        const core::Device &device) {
+    std::vector<float> origin(voxel_grid_legacy.origin_.data(),
+                              voxel_grid_legacy.origin_.data() + 3);
+    int64_t n = static_cast<int64_t>(voxel_grid_legacy.voxels_.size());
+    VoxelGrid voxel_grid(static_cast<float>(voxel_grid_legacy.voxel_size_),
+                         core::Tensor(origin, {3}, core::Dtype::Float32),
+                         std::max<int64_t>(n, 1), device);
+    if (n == 0) {
+        return voxel_grid;
+    }
+
+    std::vector<int32_t> keys;
+    std::vector<float> colors;
+    keys.reserve(3 * n);
+    colors.reserve(3 * n);
+    for (const auto &it : voxel_grid_legacy.voxels_) {
+        const open3d::geometry::Voxel &voxel = it.second;
+        for (int c = 0; c < 3; ++c) {
+            keys.push_back(voxel.grid_index_(c));
+            colors.push_back(static_cast<float>(voxel.color_(c)));
+        }
+    }
+    core::Tensor addrs, masks;
+    voxel_grid.voxel_hashmap_->Insert(
+            core::Tensor(keys, {n, 3}, core::Dtype::Int32, device),
+            core::Tensor(colors, {n, 3}, core::Dtype::Float32, device), addrs,
+            masks);
+    return voxel_grid;
+}
+
+open3d::geometry::VoxelGrid VoxelGrid::ToLegacyVoxelGrid() {
+    open3d::geometry::VoxelGrid voxel_grid_legacy;
+    voxel_grid_legacy.voxel_size_ = voxel_size_;
+    for (int c = 0; c < 3; ++c) {
+        voxel_grid_legacy.origin_(c) = origin_[c].Item<float>();
+    }
+
+    std::vector<int32_t> keys = GetVoxelCoordinates().ToFlatVector<int32_t>();
+    std::vector<float> colors = GetVoxelColors().ToFlatVector<float>();
+    for (size_t i = 0; i < keys.size(); i += 3) {
+        voxel_grid_legacy.AddVoxel(open3d::geometry::Voxel(
+                Eigen::Vector3i(keys[i], keys[i + 1], keys[i + 2]),
+                Eigen::Vector3d(colors[i], colors[i + 1], colors[i + 2])));
+    }
+    return voxel_grid_legacy;
+}
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
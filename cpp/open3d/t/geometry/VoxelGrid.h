@@ -0,0 +1,184 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/hashmap/Hashmap.h"
+#include "open3d/geometry/VoxelGrid.h"
+#include "open3d/t/geometry/Image.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/geometry/TriangleMesh.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+/// \class VoxelGrid
+///
+/// \brief A sparse voxel grid stored in a core::Hashmap, from the Int32 voxel
+/// coordinates of shape {3} to the Float32 voxel colors of shape {3}.
+///
+/// Voxel (i, j, k) spans [origin + (i, j, k) * voxel_size,
+/// origin + (i + 1, j + 1, k + 1) * voxel_size). Creation, carving and
+/// queries run as parallel kernels on the device of the hashmap, CPU or
+/// CUDA, so that occupancy grids can be rebuilt per frame.
+class VoxelGrid {
+public:
+    /// \brief Constructor.
+    ///
+    /// \param voxel_size Edge length of the voxels.
+    /// \param origin Float32 tensor of shape {3}, the corner of voxel
+    /// (0, 0, 0). Defaults to the world origin.
+    /// \param init_capacity Initial capacity of the hashmap, which grows
+    /// with insertions.
+    /// \param device The device of the hashmap.
+    VoxelGrid(float voxel_size = 1.0f,
+              const core::Tensor &origin = core::Tensor::Zeros(
+                      {3}, core::Dtype::Float32, core::Device("CPU:0")),
+              int64_t init_capacity = 1000,
+              const core::Device &device = core::Device("CPU:0"));
+
+    ~VoxelGrid(){};
+
+    /// Creates the voxels occupied by the points of a point cloud, on the
+    /// device of the point cloud. The voxel colors are the average colors of
+    /// their points, or zeros if the point cloud has no colors. As in
+    /// open3d::geometry::VoxelGrid, the origin is the minimum bound of the
+    /// points minus half a voxel.
+    static VoxelGrid CreateFromPointCloud(const PointCloud &pcd,
+                                          float voxel_size);
+
+    /// Creates the voxels intersected by the triangles of a mesh, on the
+    /// device of the mesh. The voxel colors are zeros. As in
+    /// open3d::geometry::VoxelGrid, the origin is the minimum bound of the
+    /// vertices minus half a voxel.
+    static VoxelGrid CreateFromTriangleMesh(const TriangleMesh &mesh,
+                                            float voxel_size);
+
+    /// Removes the voxels that are in front of a depth map. A voxel is kept
+    /// if one of its corners is behind the depth map, or projects outside of
+    /// the image when \p keep_voxels_outside_image is set.
+    ///
+    /// \param depth Single channel depth map, divided by \p depth_scale to get
+    /// the depth in meters, on the device of the voxel grid.
+    /// \param intrinsics Tensor of shape {3, 3}.
+    /// \param extrinsics Tensor of shape {4, 4}, world to camera.
+    VoxelGrid &CarveDepthMap(const Image &depth,
+                             const core::Tensor &intrinsics,
+                             const core::Tensor &extrinsics,
+                             bool keep_voxels_outside_image,
+                             float depth_scale = 1.0f);
+
+    /// Removes the voxels that project outside of a silhouette. A voxel is
+    /// kept if one of its corners projects into the silhouette (a positive
+    /// pixel), or outside of the image when \p keep_voxels_outside_image is
+    /// set.
+    ///
+    /// \param silhouette_mask Single channel mask, on the device of the voxel
+    /// grid.
+    /// \param intrinsics Tensor of shape {3, 3}.
+    /// \param extrinsics Tensor of shape {4, 4}, world to camera.
+    VoxelGrid &CarveSilhouette(const Image &silhouette_mask,
+                               const core::Tensor &intrinsics,
+                               const core::Tensor &extrinsics,
+                               bool keep_voxels_outside_image);
+
+    /// Checks in a single batched hashmap lookup whether the voxels of
+    /// queries are in the grid.
+    ///
+    /// \param queries Tensor of shape {n, 3}.
+    /// \return Bool tensor of shape {n}.
+    core::Tensor CheckIfIncluded(const core::Tensor &queries);
+
+    /// Returns the Int32 coordinates of the voxels containing \p points, of
+    /// shape {n, 3}.
+    core::Tensor GetVoxelIndices(const core::Tensor &points) const;
+
+    /// Returns the Int32 coordinates of the voxels of shape {n, 3}, in the
+    /// order of the hashmap buffer.
+    core::Tensor GetVoxelCoordinates();
+
+    /// Returns the Float32 colors of the voxels of shape {n, 3}, in the same
+    /// order as GetVoxelCoordinates().
+    core::Tensor GetVoxelColors();
+
+    /// Returns the Float32 centers of the voxels of shape {n, 3}, in the same
+    /// order as GetVoxelCoordinates().
+    core::Tensor GetVoxelCenterCoordinates();
+
+    /// Number of voxels.
+    int64_t NumVoxels() const { return voxel_hashmap_->Size(); }
+
+    bool HasVoxels() const { return NumVoxels() > 0; }
+
+    float GetVoxelSize() const { return voxel_size_; }
+
+    /// Float32 origin of shape {3}, on host.
+    core::Tensor GetOrigin() const { return origin_; }
+
+    core::Device GetDevice() const { return device_; }
+
+    /// Copy VoxelGrid to the target device.
+    VoxelGrid Copy(const core::Device &device);
+
+    /// Copy VoxelGrid to CPU.
+    VoxelGrid CPU();
+
+    /// Copy VoxelGrid to CUDA.
+    VoxelGrid CUDA(int device_id = 0);
+
+    /// Create a VoxelGrid from a legacy Open3D VoxelGrid.
+    static VoxelGrid FromLegacyVoxelGrid(
+            const open3d::geometry::VoxelGrid &voxel_grid_legacy,
+            const core::Device &device = core::Device("CPU:0"));
+
+    /// Convert to a legacy Open3D VoxelGrid.
+    open3d::geometry::VoxelGrid ToLegacyVoxelGrid();
+
+protected:
+    /// Inserts voxels, and sets the colors of the new ones to the average
+    /// \p colors of their rows, or zeros if \p colors is empty.
+    void InsertVoxels(const core::Tensor &voxel_keys,
+                      const core::Tensor &colors);
+
+    /// Erases the voxels whose \p keep_mask is false, in the order of
+    /// GetVoxelCoordinates().
+    void EraseVoxels(const core::Tensor &voxel_keys,
+                     const core::Tensor &keep_mask);
+
+    float voxel_size_;
+    core::Tensor origin_;
+    core::Device device_ = core::Device("CPU:0");
+
+    std::shared_ptr<core::Hashmap> voxel_hashmap_;
+};
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,224 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/kernel/Image.h"
+
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+namespace image {
+
+void To(const core::Tensor& src, core::Tensor& dst, float scale, float offset) {
+    core::Device::DeviceType device_type = src.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ToCPU(src, dst, scale, offset);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        ToCUDA(src, dst, scale, offset);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void ClipTransform(const core::Tensor& src,
+                   core::Tensor& dst,
+                   float scale,
+                   float min_value,
+                   float max_value,
+                   float clip_fill) {
+    core::Device::DeviceType device_type = src.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ClipTransformCPU(src, dst, scale, min_value, max_value, clip_fill);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        ClipTransformCUDA(src, dst, scale, min_value, max_value, clip_fill);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void Filter(const core::Tensor& src,
+            core::Tensor& dst,
+            const core::Tensor& kernel) {
+    core::Device::DeviceType device_type = src.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        FilterCPU(src, dst, kernel);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        FilterCUDA(src, dst, kernel);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void FilterSeparable(const core::Tensor& src,
+                     core::Tensor& dst,
+                     const core::Tensor& kernel_x,
+                     const core::Tensor& kernel_y) {
+    core::Device::DeviceType device_type = src.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        FilterSeparableCPU(src, dst, kernel_x, kernel_y);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        FilterSeparableCUDA(src, dst, kernel_x, kernel_y);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void FilterBilateral(const core::Tensor& src,
+                     core::Tensor& dst,
+                     int kernel_size,
+                     float value_sigma,
+                     float distance_sigma) {
+    core::Device::DeviceType device_type = src.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        FilterBilateralCPU(src, dst, kernel_size, value_sigma, distance_sigma);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        FilterBilateralCUDA(src, dst, kernel_size, value_sigma, distance_sigma);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void FilterBilateralDepth(const core::Tensor& src,
+                          core::Tensor& dst,
+                          int kernel_size,
+                          float depth_sigma,
+                          float distance_sigma) {
+    core::Device::DeviceType device_type = src.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        FilterBilateralDepthCPU(src, dst, kernel_size, depth_sigma,
+                                distance_sigma);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        FilterBilateralDepthCUDA(src, dst, kernel_size, depth_sigma,
+                                 distance_sigma);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void RegisterDepth(const core::Tensor& src,
+                   core::Tensor& dst,
+                   const core::Tensor& src_intrinsic,
+                   const core::Tensor& dst_intrinsic,
+                   const core::Tensor& extrinsic,
+                   float depth_scale) {
+    core::Device::DeviceType device_type = src.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        RegisterDepthCPU(src, dst, src_intrinsic, dst_intrinsic, extrinsic,
+                         depth_scale);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        RegisterDepthCUDA(src, dst, src_intrinsic, dst_intrinsic, extrinsic,
+                          depth_scale);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void PyrDown(const core::Tensor& src, core::Tensor& dst) {
+    core::Device::DeviceType device_type = src.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        PyrDownCPU(src, dst);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        PyrDownCUDA(src, dst);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void PyrDownDepth(const core::Tensor& src,
+                  core::Tensor& dst,
+                  float diff_threshold,
+                  float invalid_fill) {
+    core::Device::DeviceType device_type = src.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        PyrDownDepthCPU(src, dst, diff_threshold, invalid_fill);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        PyrDownDepthCUDA(src, dst, diff_threshold, invalid_fill);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void Resize(const core::Tensor& src,
+            core::Tensor& dst,
+            InterpType interp_type) {
+    core::Device::DeviceType device_type = src.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ResizeCPU(src, dst, interp_type);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        ResizeCUDA(src, dst, interp_type);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+}  // namespace image
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,281 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+namespace image {
+
+/// Interpolation of the resized images.
+enum class InterpType {
+    /// Value of the nearest pixel.
+    Nearest,
+    /// Bilinear interpolation of the 4 nearest pixels.
+    Linear
+};
+
+/// Converts src to the dtype of dst, with the values transformed as
+/// value * scale + offset. Integer results are rounded and saturated.
+///
+/// \param src Contiguous UInt8, UInt16 or Float32 image.
+/// \param dst Output image of the shape of src, UInt8, UInt16 or Float32.
+void To(const core::Tensor& src, core::Tensor& dst, float scale, float offset);
+
+void ToCPU(const core::Tensor& src,
+           core::Tensor& dst,
+           float scale,
+           float offset);
+
+#ifdef BUILD_CUDA_MODULE
+void ToCUDA(const core::Tensor& src,
+            core::Tensor& dst,
+            float scale,
+            float offset);
+#endif
+
+/// Divides the values of a single-channel image by scale, and sets the
+/// values that are not in (min_value, max_value) to clip_fill.
+///
+/// \param src Contiguous UInt16 or Float32 image.
+/// \param dst Output Float32 image of the shape of src.
+void ClipTransform(const core::Tensor& src,
+                   core::Tensor& dst,
+                   float scale,
+                   float min_value,
+                   float max_value,
+                   float clip_fill);
+
+void ClipTransformCPU(const core::Tensor& src,
+                      core::Tensor& dst,
+                      float scale,
+                      float min_value,
+                      float max_value,
+                      float clip_fill);
+
+#ifdef BUILD_CUDA_MODULE
+void ClipTransformCUDA(const core::Tensor& src,
+                       core::Tensor& dst,
+                       float scale,
+                       float min_value,
+                       float max_value,
+                       float clip_fill);
+#endif
+
+/// Convolves each channel of src with a 2D kernel, replicating the border
+/// pixels.
+///
+/// \param src Contiguous UInt8, UInt16 or Float32 image.
+/// \param dst Output image of the shape and dtype of src.
+/// \param kernel Float32 kernel of shape {kh, kw} with odd sizes, on the same
+/// device as src.
+void Filter(const core::Tensor& src,
+            core::Tensor& dst,
+            const core::Tensor& kernel);
+
+void FilterCPU(const core::Tensor& src,
+               core::Tensor& dst,
+               const core::Tensor& kernel);
+
+#ifdef BUILD_CUDA_MODULE
+void FilterCUDA(const core::Tensor& src,
+                core::Tensor& dst,
+                const core::Tensor& kernel);
+#endif
+
+/// Convolves each channel of src with kernel_x along the columns, then with
+/// kernel_y along the rows, replicating the border pixels.
+///
+/// \param src Contiguous UInt8, UInt16 or Float32 image.
+/// \param dst Output image of the shape of src, UInt8, UInt16 or Float32.
+/// \param kernel_x Float32 kernel of odd size, on the same device as src.
+/// \param kernel_y Float32 kernel of odd size, on the same device as src.
+void FilterSeparable(const core::Tensor& src,
+                     core::Tensor& dst,
+                     const core::Tensor& kernel_x,
+                     const core::Tensor& kernel_y);
+
+void FilterSeparableCPU(const core::Tensor& src,
+                        core::Tensor& dst,
+                        const core::Tensor& kernel_x,
+                        const core::Tensor& kernel_y);
+
+#ifdef BUILD_CUDA_MODULE
+void FilterSeparableCUDA(const core::Tensor& src,
+                         core::Tensor& dst,
+                         const core::Tensor& kernel_x,
+                         const core::Tensor& kernel_y);
+#endif
+
+/// Bilateral filter, weighting the neighbors by their distance in pixels and
+/// the distance between their values over all the channels.
+///
+/// \param src Contiguous UInt8, UInt16 or Float32 image with at most 4
+/// channels.
+/// \param dst Output image of the shape and dtype of src.
+/// \param kernel_size Odd size of the square neighborhood.
+void FilterBilateral(const core::Tensor& src,
+                     core::Tensor& dst,
+                     int kernel_size,
+                     float value_sigma,
+                     float distance_sigma);
+
+void FilterBilateralCPU(const core::Tensor& src,
+                        core::Tensor& dst,
+                        int kernel_size,
+                        float value_sigma,
+                        float distance_sigma);
+
+#ifdef BUILD_CUDA_MODULE
+void FilterBilateralCUDA(const core::Tensor& src,
+                         core::Tensor& dst,
+                         int kernel_size,
+                         float value_sigma,
+                         float distance_sigma);
+#endif
+
+/// Bilateral filter of a depth image, averaging only the valid neighbors.
+/// The pixels with an invalid depth, not greater than 0, stay 0.
+///
+/// \param src Contiguous UInt16 or Float32 single-channel image.
+/// \param dst Output image of the shape and dtype of src.
+/// \param kernel_size Odd size of the square neighborhood.
+void FilterBilateralDepth(const core::Tensor& src,
+                          core::Tensor& dst,
+                          int kernel_size,
+                          float depth_sigma,
+                          float distance_sigma);
+
+void FilterBilateralDepthCPU(const core::Tensor& src,
+                             core::Tensor& dst,
+                             int kernel_size,
+                             float depth_sigma,
+                             float distance_sigma);
+
+#ifdef BUILD_CUDA_MODULE
+void FilterBilateralDepthCUDA(const core::Tensor& src,
+                              core::Tensor& dst,
+                              int kernel_size,
+                              float depth_sigma,
+                              float distance_sigma);
+#endif
+
+/// Reprojects a depth image to another camera. Each valid depth pixel is
+/// splatted over the footprint of the pixel in dst, and dst keeps the nearest
+/// depth of each pixel, or 0.
+///
+/// \param src Contiguous UInt16 or Float32 single-channel depth image.
+/// \param dst Output image of the target size and the dtype of src.
+/// \param src_intrinsic Float32 3x3 intrinsic matrix of src on the host.
+/// \param dst_intrinsic Float32 3x3 intrinsic matrix of dst on the host.
+/// \param extrinsic Float32 4x4 transformation from the src camera to the dst
+/// camera on the host, in meters.
+/// \param depth_scale Depth values per meter.
+void RegisterDepth(const core::Tensor& src,
+                   core::Tensor& dst,
+                   const core::Tensor& src_intrinsic,
+                   const core::Tensor& dst_intrinsic,
+                   const core::Tensor& extrinsic,
+                   float depth_scale);
+
+void RegisterDepthCPU(const core::Tensor& src,
+                      core::Tensor& dst,
+                      const core::Tensor& src_intrinsic,
+                      const core::Tensor& dst_intrinsic,
+                      const core::Tensor& extrinsic,
+                      float depth_scale);
+
+#ifdef BUILD_CUDA_MODULE
+void RegisterDepthCUDA(const core::Tensor& src,
+                       core::Tensor& dst,
+                       const core::Tensor& src_intrinsic,
+                       const core::Tensor& dst_intrinsic,
+                       const core::Tensor& extrinsic,
+                       float depth_scale);
+#endif
+
+/// Smooths src with the 5x5 Gaussian kernel of OpenCV's pyrDown and keeps
+/// the pixels with even coordinates.
+///
+/// \param src Contiguous UInt8, UInt16 or Float32 image.
+/// \param dst Output image of shape {(rows + 1) / 2, (cols + 1) / 2,
+/// channels} and the dtype of src.
+void PyrDown(const core::Tensor& src, core::Tensor& dst);
+
+void PyrDownCPU(const core::Tensor& src, core::Tensor& dst);
+
+#ifdef BUILD_CUDA_MODULE
+void PyrDownCUDA(const core::Tensor& src, core::Tensor& dst);
+#endif
+
+/// Downsamples a depth image like PyrDown, only averaging the valid neighbors
+/// whose depth is within diff_threshold of the center pixel. The pixels with
+/// an invalid center are set to invalid_fill.
+///
+/// \param src Contiguous Float32 single-channel image.
+/// \param dst Output image of shape {(rows + 1) / 2, (cols + 1) / 2, 1}.
+void PyrDownDepth(const core::Tensor& src,
+                  core::Tensor& dst,
+                  float diff_threshold,
+                  float invalid_fill);
+
+void PyrDownDepthCPU(const core::Tensor& src,
+                     core::Tensor& dst,
+                     float diff_threshold,
+                     float invalid_fill);
+
+#ifdef BUILD_CUDA_MODULE
+void PyrDownDepthCUDA(const core::Tensor& src,
+                      core::Tensor& dst,
+                      float diff_threshold,
+                      float invalid_fill);
+#endif
+
+/// Resizes src to the size of dst.
+///
+/// \param src Contiguous UInt8, UInt16 or Float32 image.
+/// \param dst Output image with the channels and dtype of src.
+void Resize(const core::Tensor& src, core::Tensor& dst, InterpType interp_type);
+
+void ResizeCPU(const core::Tensor& src,
+               core::Tensor& dst,
+               InterpType interp_type);
+
+#ifdef BUILD_CUDA_MODULE
+void ResizeCUDA(const core::Tensor& src,
+                core::Tensor& dst,
+                InterpType interp_type);
+#endif
+
+}  // namespace image
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,718 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#include "open3d/core/Atomic.h"
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/kernel/GeometryIndexer.h"
+#include "open3d/t/geometry/kernel/Image.h"
+#include "open3d/utility/Console.h"
+
+/// Dispatches the dtypes of the legacy images: UInt8, UInt16 and Float32.
+#define DISPATCH_IMAGE_DTYPE_TO_TEMPLATE(DTYPE, ...)                 \
+    [&] {                                                            \
+        if (DTYPE == open3d::core::Dtype::UInt8) {                   \
+            using scalar_t = uint8_t;                                \
+            return __VA_ARGS__();                                    \
+        } else if (DTYPE == open3d::core::Dtype::UInt16) {           \
+            using scalar_t = uint16_t;                               \
+            return __VA_ARGS__();                                    \
+        } else if (DTYPE == open3d::core::Dtype::Float32) {          \
+            using scalar_t = float;                                  \
+            return __VA_ARGS__();                                    \
+        } else {                                                     \
+            open3d::utility::LogError("Unsupported image dtype {}.", \
+                                      DTYPE.ToString());             \
+        }                                                            \
+    }()
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+namespace image {
+
+/// Rounds and saturates v to the range of scalar_t. NaN maps to zero.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE inline scalar_t SaturateCast(float v);
+
+template <>
+OPEN3D_HOST_DEVICE inline uint8_t SaturateCast<uint8_t>(float v) {
+    if (!(v > 0.0f)) return 0;
+    if (v >= 255.0f) return 255;
+    return static_cast<uint8_t>(v + 0.5f);
+}
+
+template <>
+OPEN3D_HOST_DEVICE inline uint16_t SaturateCast<uint16_t>(float v) {
+    if (!(v > 0.0f)) return 0;
+    if (v >= 65535.0f) return 65535;
+    return static_cast<uint16_t>(v + 0.5f);
+}
+
+template <>
+OPEN3D_HOST_DEVICE inline float SaturateCast<float>(float v) {
+    return v;
+}
+
+/// Clamps the coordinate i to [0, n), replicating the border pixels.
+OPEN3D_HOST_DEVICE inline int64_t ClampCoord(int64_t i, int64_t n) {
+    return i < 0 ? 0 : (i >= n ? n - 1 : i);
+}
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void ToCUDA
+#else
+void ToCPU
+#endif
+        (const core::Tensor& src,
+         core::Tensor& dst,
+         float scale,
+         float offset) {
+    int64_t n = src.NumElements();
+    DISPATCH_IMAGE_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        using src_t = scalar_t;
+        const src_t* src_ptr = static_cast<const src_t*>(src.GetDataPtr());
+        DISPATCH_IMAGE_DTYPE_TO_TEMPLATE(dst.GetDtype(), [&]() {
+            scalar_t* dst_ptr = static_cast<scalar_t*>(dst.GetDataPtr());
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+            core::kernel::CUDALauncher::LaunchGeneralKernel(
+                    n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+#else
+            core::kernel::CPULauncher::LaunchGeneralKernel(
+                    n, [&](int64_t workload_idx) {
+#endif
+                        dst_ptr[workload_idx] = SaturateCast<scalar_t>(
+                                static_cast<float>(src_ptr[workload_idx]) *
+                                        scale +
+                                offset);
+                    });
+        });
+    });
+}
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void ClipTransformCUDA
+#else
+void ClipTransformCPU
+#endif
+        (const core::Tensor& src,
+         core::Tensor& dst,
+         float scale,
+         float min_value,
+         float max_value,
+         float clip_fill) {
+    int64_t n = src.NumElements();
+    float* dst_ptr = static_cast<float*>(dst.GetDataPtr());
+    DISPATCH_IMAGE_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        const scalar_t* src_ptr =
+                static_cast<const scalar_t*>(src.GetDataPtr());
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+        core::kernel::CUDALauncher::LaunchGeneralKernel(
+                n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+#else
+        core::kernel::CPULauncher::LaunchGeneralKernel(
+                n, [&](int64_t workload_idx) {
+#endif
+                    float v = static_cast<float>(src_ptr[workload_idx]) / scale;
+                    dst_ptr[workload_idx] =
+                            (v > min_value && v < max_value) ? v : clip_fill;
+                });
+    });
+}
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void FilterCUDA
+#else
+void FilterCPU
+#endif
+        (const core::Tensor& src,
+         core::Tensor& dst,
+         const core::Tensor& kernel) {
+    int64_t rows = src.GetShape(0);
+    int64_t cols = src.GetShape(1);
+    int64_t channels = src.GetShape(2);
+    int64_t kernel_rows = kernel.GetShape(0);
+    int64_t kernel_cols = kernel.GetShape(1);
+    const float* kernel_ptr = static_cast<const float*>(kernel.GetDataPtr());
+
+    int64_t n = rows * cols * channels;
+    DISPATCH_IMAGE_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        const scalar_t* src_ptr =
+                static_cast<const scalar_t*>(src.GetDataPtr());
+        scalar_t* dst_ptr = static_cast<scalar_t*>(dst.GetDataPtr());
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+        core::kernel::CUDALauncher::LaunchGeneralKernel(
+                n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+#else
+        core::kernel::CPULauncher::LaunchGeneralKernel(
+                n, [&](int64_t workload_idx) {
+#endif
+                    int64_t ch = workload_idx % channels;
+                    int64_t pixel = workload_idx / channels;
+                    int64_t r = pixel / cols;
+                    int64_t c = pixel % cols;
+
+                    float sum = 0;
+                    for (int64_t i = 0; i < kernel_rows; ++i) {
+                        int64_t r_src =
+                                ClampCoord(r + i - kernel_rows / 2, rows);
+                        for (int64_t j = 0; j < kernel_cols; ++j) {
+                            int64_t c_src =
+                                    ClampCoord(c + j - kernel_cols / 2, cols);
+                            sum += kernel_ptr[i * kernel_cols + j] *
+                                   src_ptr[(r_src * cols + c_src) * channels +
+                                           ch];
+                        }
+                    }
+                    dst_ptr[workload_idx] = SaturateCast<scalar_t>(sum);
+                });
+    });
+}
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void FilterSeparableCUDA
+#else
+void FilterSeparableCPU
+#endif
+        (const core::Tensor& src,
+         core::Tensor& dst,
+         const core::Tensor& kernel_x,
+         const core::Tensor& kernel_y) {
+    int64_t rows = src.GetShape(0);
+    int64_t cols = src.GetShape(1);
+    int64_t channels = src.GetShape(2);
+    int64_t n = rows * cols * channels;
+
+    // Rows filtered along the columns, kept in float to avoid rounding twice.
+    core::Tensor tmp(src.GetShape(), core::Dtype::Float32, src.GetDevice());
+    float* tmp_ptr = static_cast<float*>(tmp.GetDataPtr());
+
+    int64_t kernel_x_size = kernel_x.NumElements();
+    const float* kernel_x_ptr =
+            static_cast<const float*>(kernel_x.GetDataPtr());
+    DISPATCH_IMAGE_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        const scalar_t* src_ptr =
+                static_cast<const scalar_t*>(src.GetDataPtr());
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+        core::kernel::CUDALauncher::LaunchGeneralKernel(
+                n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+#else
+        core::kernel::CPULauncher::LaunchGeneralKernel(
+                n, [&](int64_t workload_idx) {
+#endif
+                    int64_t ch = workload_idx % channels;
+                    int64_t pixel = workload_idx / channels;
+                    int64_t r = pixel / cols;
+                    int64_t c = pixel % cols;
+
+                    float sum = 0;
+                    for (int64_t j = 0; j < kernel_x_size; ++j) {
+                        int64_t c_src =
+                                ClampCoord(c + j - kernel_x_size / 2, cols);
+                        sum += kernel_x_ptr[j] *
+                               src_ptr[(r * cols + c_src) * channels + ch];
+                    }
+                    tmp_ptr[workload_idx] = sum;
+                });
+    });
+
+    int64_t kernel_y_size = kernel_y.NumElements();
+    const float* kernel_y_ptr =
+            static_cast<const float*>(kernel_y.GetDataPtr());
+    DISPATCH_IMAGE_DTYPE_TO_TEMPLATE(dst.GetDtype(), [&]() {
+        scalar_t* dst_ptr = static_cast<scalar_t*>(dst.GetDataPtr());
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+        core::kernel::CUDALauncher::LaunchGeneralKernel(
+                n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+#else
+        core::kernel::CPULauncher::LaunchGeneralKernel(
+                n, [&](int64_t workload_idx) {
+#endif
+                    int64_t ch = workload_idx % channels;
+                    int64_t pixel = workload_idx / channels;
+                    int64_t r = pixel / cols;
+                    int64_t c = pixel % cols;
+
+                    float sum = 0;
+                    for (int64_t i = 0; i < kernel_y_size; ++i) {
+                        int64_t r_src =
+                                ClampCoord(r + i - kernel_y_size / 2, rows);
+                        sum += kernel_y_ptr[i] *
+                               tmp_ptr[(r_src * cols + c) * channels + ch];
+                    }
+                    dst_ptr[workload_idx] = SaturateCast<scalar_t>(sum);
+                });
+    });
+}
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void FilterBilateralCUDA
+#else
+void FilterBilateralCPU
+#endif
+        (const core::Tensor& src,
+         core::Tensor& dst,
+         int kernel_size,
+         float value_sigma,
+         float distance_sigma) {
+    int64_t rows = src.GetShape(0);
+    int64_t cols = src.GetShape(1);
+    int64_t channels = src.GetShape(2);
+    int64_t half = kernel_size / 2;
+    float value_factor = -0.5f / (value_sigma * value_sigma);
+    float distance_factor = -0.5f / (distance_sigma * distance_sigma);
+
+    int64_t n = rows * cols;
+    DISPATCH_IMAGE_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        const scalar_t* src_ptr =
+                static_cast<const scalar_t*>(src.GetDataPtr());
+        scalar_t* dst_ptr = static_cast<scalar_t*>(dst.GetDataPtr());
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+        core::kernel::CUDALauncher::LaunchGeneralKernel(
+                n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+#else
+        core::kernel::CPULauncher::LaunchGeneralKernel(
+                n, [&](int64_t workload_idx) {
+#endif
+                    int64_t r = workload_idx / cols;
+                    int64_t c = workload_idx % cols;
+                    const scalar_t* center = src_ptr + workload_idx * channels;
+
+                    float sum[4] = {0, 0, 0, 0};
+                    float weight_sum = 0;
+                    for (int64_t i = -half; i <= half; ++i) {
+                        int64_t r_src = ClampCoord(r + i, rows);
+                        for (int64_t j = -half; j <= half; ++j) {
+                            int64_t c_src = ClampCoord(c + j, cols);
+                            const scalar_t* neighbor =
+                                    src_ptr + (r_src * cols + c_src) * channels;
+
+                            float value_dist2 = 0;
+                            for (int64_t ch = 0; ch < channels; ++ch) {
+                                float diff = static_cast<float>(neighbor[ch]) -
+                                             static_cast<float>(center[ch]);
+                                value_dist2 += diff * diff;
+                            }
+                            float weight =
+                                    expf(value_factor * value_dist2 +
+                                         distance_factor * (i * i + j * j));
+                            weight_sum += weight;
+                            for (int64_t ch = 0; ch < channels; ++ch) {
+                                sum[ch] += weight * neighbor[ch];
+                            }
+                        }
+                    }
+
+                    // The center pixel has a unit weight, so weight_sum > 0.
+                    scalar_t* out = dst_ptr + workload_idx * channels;
+                    for (int64_t ch = 0; ch < channels; ++ch) {
+                        out[ch] = SaturateCast<scalar_t>(sum[ch] / weight_sum);
+                    }
+                });
+    });
+}
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void FilterBilateralDepthCUDA
+#else
+void FilterBilateralDepthCPU
+#endif
+        (const core::Tensor& src,
+         core::Tensor& dst,
+         int kernel_size,
+         float depth_sigma,
+         float distance_sigma) {
+    int64_t rows = src.GetShape(0);
+    int64_t cols = src.GetShape(1);
+    int64_t half = kernel_size / 2;
+    float depth_factor = -0.5f / (depth_sigma * depth_sigma);
+    float distance_factor = -0.5f / (distance_sigma * distance_sigma);
+
+    int64_t n = rows * cols;
+    DISPATCH_IMAGE_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        const scalar_t* src_ptr =
+                static_cast<const scalar_t*>(src.GetDataPtr());
+        scalar_t* dst_ptr = static_cast<scalar_t*>(dst.GetDataPtr());
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+        core::kernel::CUDALauncher::LaunchGeneralKernel(
+                n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+#else
+        core::kernel::CPULauncher::LaunchGeneralKernel(
+                n, [&](int64_t workload_idx) {
+#endif
+                    int64_t r = workload_idx / cols;
+                    int64_t c = workload_idx % cols;
+                    float center = static_cast<float>(src_ptr[workload_idx]);
+                    if (!(center > 0)) {
+                        dst_ptr[workload_idx] = 0;
+                        return;
+                    }
+
+                    // Invalid neighbors are skipped instead of pulling the
+                    // depth towards 0 at the boundaries of holes.
+                    float sum = 0;
+                    float weight_sum = 0;
+                    for (int64_t i = -half; i <= half; ++i) {
+                        int64_t r_src = r + i;
+                        if (r_src < 0 || r_src >= rows) continue;
+                        for (int64_t j = -half; j <= half; ++j) {
+                            int64_t c_src = c + j;
+                            if (c_src < 0 || c_src >= cols) continue;
+                            float d = static_cast<float>(
+                                    src_ptr[r_src * cols + c_src]);
+                            if (!(d > 0)) continue;
+                            float diff = d - center;
+                            float weight =
+                                    expf(depth_factor * diff * diff +
+                                         distance_factor * (i * i + j * j));
+                            sum += weight * d;
+                            weight_sum += weight;
+                        }
+                    }
+                    dst_ptr[workload_idx] =
+                            SaturateCast<scalar_t>(sum / weight_sum);
+                });
+    });
+}
+
+/// Bits of a non-negative float, which compare as the floats do.
+OPEN3D_HOST_DEVICE inline uint32_t FloatToOrderedBits(float v) {
+#if defined(__CUDA_ARCH__)
+    return __float_as_uint(v);
+#else
+    uint32_t bits;
+    std::memcpy(&bits, &v, sizeof(bits));
+    return bits;
+#endif
+}
+
+OPEN3D_HOST_DEVICE inline float OrderedBitsToFloat(uint32_t bits) {
+#if defined(__CUDA_ARCH__)
+    return __uint_as_float(bits);
+#else
+    float v;
+    std::memcpy(&v, &bits, sizeof(v));
+    return v;
+#endif
+}
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void RegisterDepthCUDA
+#else
+void RegisterDepthCPU
+#endif
+        (const core::Tensor& src,
+         core::Tensor& dst,
+         const core::Tensor& src_intrinsic,
+         const core::Tensor& dst_intrinsic,
+         const core::Tensor& extrinsic,
+         float depth_scale) {
+    int64_t src_rows = src.GetShape(0);
+    int64_t src_cols = src.GetShape(1);
+    int64_t dst_rows = dst.GetShape(0);
+    int64_t dst_cols = dst.GetShape(1);
+    float inv_depth_scale = 1.0f / depth_scale;
+
+    TransformIndexer src_indexer(src_intrinsic, extrinsic);
+    TransformIndexer dst_indexer(dst_intrinsic);
+
+    // Nearest depth in meters of each dst pixel as ordered bits, where all
+    // bits set marks the pixels without depth.
+    core::Tensor z_buffer = core::Tensor::Full(
+            {dst_rows, dst_cols}, -1, core::Dtype::Int32, src.GetDevice());
+    uint32_t* z_ptr = static_cast<uint32_t*>(z_buffer.GetDataPtr());
+
+    DISPATCH_IMAGE_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        const scalar_t* src_ptr =
+                static_cast<const scalar_t*>(src.GetDataPtr());
+        scalar_t* dst_ptr = static_cast<scalar_t*>(dst.GetDataPtr());
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+        core::kernel::CUDALauncher::LaunchGeneralKernel(
+                src_rows * src_cols, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+#else
+        core::kernel::CPULauncher::LaunchGeneralKernel(
+                src_rows * src_cols, [&](int64_t workload_idx) {
+#endif
+                    float d = static_cast<float>(src_ptr[workload_idx]) *
+                              inv_depth_scale;
+                    if (!(d > 0)) return;
+                    float u = static_cast<float>(workload_idx % src_cols);
+                    float v = static_cast<float>(workload_idx / src_cols);
+
+                    // Splats the footprint of the src pixel, from its top
+                    // left to its bottom right corner, to cover the dst
+                    // pixels of a magnified view without holes.
+                    float u_min = 0, v_min = 0, u_max = 0, v_max = 0, z = 0;
+                    for (int k = 0; k < 2; ++k) {
+                        float x, y, zc, xt, yt, zt, ut, vt;
+                        float offset = k == 0 ? -0.5f : 0.5f;
+                        src_indexer.Unproject(u + offset, v + offset, d, &x,
+                                              &y, &zc);
+                        src_indexer.RigidTransform(x, y, zc, &xt, &yt, &zt);
+                        if (!(zt > 0)) return;
+                        dst_indexer.Project(xt, yt, zt, &ut, &vt);
+                        if (k == 0) {
+                            u_min = u_max = ut;
+                            v_min = v_max = vt;
+                            z = zt;
+                        } else {
+                            u_min = fminf(u_min, ut);
+                            u_max = fmaxf(u_max, ut);
+                            v_min = fminf(v_min, vt);
+                            v_max = fmaxf(v_max, vt);
+                            z = fmaxf(z, zt);
+                        }
+                    }
+
+                    int64_t c0 = static_cast<int64_t>(ceilf(u_min));
+                    int64_t c1 = static_cast<int64_t>(floorf(u_max));
+                    int64_t r0 = static_cast<int64_t>(ceilf(v_min));
+                    int64_t r1 = static_cast<int64_t>(floorf(v_max));
+                    // A minified pixel may not cover any pixel center.
+                    if (c0 > c1) {
+                        c0 = c1 = static_cast<int64_t>(
+                                roundf(0.5f * (u_min + u_max)));
+                    }
+                    if (r0 > r1) {
+                        r0 = r1 = static_cast<int64_t>(
+                                roundf(0.5f * (v_min + v_max)));
+                    }
+                    if (c1 < 0 || c0 >= dst_cols || r1 < 0 ||
+                        r0 >= dst_rows) {
+                        return;
+                    }
+                    c0 = c0 < 0 ? 0 : c0;
+                    r0 = r0 < 0 ? 0 : r0;
+                    c1 = c1 >= dst_cols ? dst_cols - 1 : c1;
+                    r1 = r1 >= dst_rows ? dst_rows - 1 : r1;
+
+                    uint32_t z_bits = FloatToOrderedBits(z);
+                    for (int64_t r = r0; r <= r1; ++r) {
+                        for (int64_t c = c0; c <= c1; ++c) {
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+                            atomicMin(reinterpret_cast<unsigned int*>(
+                                              z_ptr + r * dst_cols + c),
+                                      z_bits);
+#else
+                            core::AtomicFetchMinRelaxed(
+                                    z_ptr + r * dst_cols + c, z_bits);
+#endif
+                        }
+                    }
+                });
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+        core::kernel::CUDALauncher::LaunchGeneralKernel(
+                dst_rows * dst_cols, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+#else
+        core::kernel::CPULauncher::LaunchGeneralKernel(
+                dst_rows * dst_cols, [&](int64_t workload_idx) {
+#endif
+                    uint32_t z_bits = z_ptr[workload_idx];
+                    dst_ptr[workload_idx] =
+                            z_bits == UINT32_MAX
+                                    ? scalar_t(0)
+                                    : SaturateCast<scalar_t>(
+                                              OrderedBitsToFloat(z_bits) *
+                                              depth_scale);
+                });
+    });
+}
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void PyrDownCUDA
+#else
+void PyrDownCPU
+#endif
+        (const core::Tensor& src, core::Tensor& dst) {
+    int64_t rows = src.GetShape(0);
+    int64_t cols = src.GetShape(1);
+    int64_t channels = src.GetShape(2);
+    int64_t cols_down = dst.GetShape(1);
+
+    int64_t n = dst.NumElements();
+    DISPATCH_IMAGE_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        const scalar_t* src_ptr =
+                static_cast<const scalar_t*>(src.GetDataPtr());
+        scalar_t* dst_ptr = static_cast<scalar_t*>(dst.GetDataPtr());
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+        core::kernel::CUDALauncher::LaunchGeneralKernel(
+                n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+#else
+        core::kernel::CPULauncher::LaunchGeneralKernel(
+                n, [&](int64_t workload_idx) {
+#endif
+                    const float weights[5] = {1.0f / 16, 4.0f / 16, 6.0f / 16,
+                                              4.0f / 16, 1.0f / 16};
+                    int64_t ch = workload_idx % channels;
+                    int64_t pixel = workload_idx / channels;
+                    int64_t r = (pixel / cols_down) * 2;
+                    int64_t c = (pixel % cols_down) * 2;
+
+                    float sum = 0;
+                    for (int64_t i = 0; i < 5; ++i) {
+                        int64_t r_src = ClampCoord(r + i - 2, rows);
+                        float row_sum = 0;
+                        for (int64_t j = 0; j < 5; ++j) {
+                            int64_t c_src = ClampCoord(c + j - 2, cols);
+                            row_sum += weights[j] *
+                                       src_ptr[(r_src * cols + c_src) *
+                                                       channels +
+                                               ch];
+                        }
+                        sum += weights[i] * row_sum;
+                    }
+                    dst_ptr[workload_idx] = SaturateCast<scalar_t>(sum);
+                });
+    });
+}
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void PyrDownDepthCUDA
+#else
+void PyrDownDepthCPU
+#endif
+        (const core::Tensor& src,
+         core::Tensor& dst,
+         float diff_threshold,
+         float invalid_fill) {
+    int64_t rows = src.GetShape(0);
+    int64_t cols = src.GetShape(1);
+    int64_t cols_down = dst.GetShape(1);
+    const float* src_ptr = static_cast<const float*>(src.GetDataPtr());
+    float* dst_ptr = static_cast<float*>(dst.GetDataPtr());
+
+    int64_t n = dst.NumElements();
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+    core::kernel::CUDALauncher::LaunchGeneralKernel(
+            n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+#else
+    core::kernel::CPULauncher::LaunchGeneralKernel(
+            n, [&](int64_t workload_idx) {
+#endif
+                const float weights[5] = {1.0f / 16, 4.0f / 16, 6.0f / 16,
+                                          4.0f / 16, 1.0f / 16};
+                int64_t r = (workload_idx / cols_down) * 2;
+                int64_t c = (workload_idx % cols_down) * 2;
+
+                float center = src_ptr[r * cols + c];
+                if (!(center > 0.0f)) {
+                    dst_ptr[workload_idx] = invalid_fill;
+                    return;
+                }
+
+                float sum = 0;
+                float weight_sum = 0;
+                for (int64_t i = 0; i < 5; ++i) {
+                    int64_t r_src = ClampCoord(r + i - 2, rows);
+                    for (int64_t j = 0; j < 5; ++j) {
+                        int64_t c_src = ClampCoord(c + j - 2, cols);
+                        float d = src_ptr[r_src * cols + c_src];
+                        if (d > 0.0f && fabsf(d - center) < diff_threshold) {
+                            float weight = weights[i] * weights[j];
+                            sum += weight * d;
+                            weight_sum += weight;
+                        }
+                    }
+                }
+                dst_ptr[workload_idx] = sum / weight_sum;
+            });
+}
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void ResizeCUDA
+#else
+void ResizeCPU
+#endif
+        (const core::Tensor& src, core::Tensor& dst, InterpType interp_type) {
+    int64_t rows = src.GetShape(0);
+    int64_t cols = src.GetShape(1);
+    int64_t channels = src.GetShape(2);
+    int64_t rows_dst = dst.GetShape(0);
+    int64_t cols_dst = dst.GetShape(1);
+    float scale_r = static_cast<float>(rows) / rows_dst;
+    float scale_c = static_cast<float>(cols) / cols_dst;
+    bool linear = interp_type == InterpType::Linear;
+
+    int64_t n = dst.NumElements();
+    DISPATCH_IMAGE_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        const scalar_t* src_ptr =
+                static_cast<const scalar_t*>(src.GetDataPtr());
+        scalar_t* dst_ptr = static_cast<scalar_t*>(dst.GetDataPtr());
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+        core::kernel::CUDALauncher::LaunchGeneralKernel(
+                n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+#else
+        core::kernel::CPULauncher::LaunchGeneralKernel(
+                n, [&](int64_t workload_idx) {
+#endif
+                    int64_t ch = workload_idx % channels;
+                    int64_t pixel = workload_idx / channels;
+                    int64_t r = pixel / cols_dst;
+                    int64_t c = pixel % cols_dst;
+
+                    if (!linear) {
+                        int64_t r_src = ClampCoord(
+                                static_cast<int64_t>(r * scale_r), rows);
+                        int64_t c_src = ClampCoord(
+                                static_cast<int64_t>(c * scale_c), cols);
+                        dst_ptr[workload_idx] =
+                                src_ptr[(r_src * cols + c_src) * channels + ch];
+                        return;
+                    }
+
+                    // Pixel centers are aligned as in OpenCV.
+                    float y = fmaxf((r + 0.5f) * scale_r - 0.5f, 0.0f);
+                    float x = fmaxf((c + 0.5f) * scale_c - 0.5f, 0.0f);
+                    int64_t r0 = ClampCoord(static_cast<int64_t>(y), rows);
+                    int64_t c0 = ClampCoord(static_cast<int64_t>(x), cols);
+                    int64_t r1 = ClampCoord(r0 + 1, rows);
+                    int64_t c1 = ClampCoord(c0 + 1, cols);
+                    float wy = fminf(y - r0, 1.0f);
+                    float wx = fminf(x - c0, 1.0f);
+
+                    float v00 = src_ptr[(r0 * cols + c0) * channels + ch];
+                    float v01 = src_ptr[(r0 * cols + c1) * channels + ch];
+                    float v10 = src_ptr[(r1 * cols + c0) * channels + ch];
+                    float v11 = src_ptr[(r1 * cols + c1) * channels + ch];
+                    float v = (1 - wy) * ((1 - wx) * v00 + wx * v01) +
+                              wy * ((1 - wx) * v10 + wx * v11);
+                    dst_ptr[workload_idx] = SaturateCast<scalar_t>(v);
+                });
+    });
+}
+
+}  // namespace image
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
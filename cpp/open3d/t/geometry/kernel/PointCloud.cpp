@@ -37,33 +37,105 @@ namespace t {
 namespace geometry {
 namespace kernel {
 namespace pointcloud {
+namespace {
+
+// Reuses the memory of buffer if it can hold n points on device, otherwise
+// allocates a new Float32 tensor of shape {n, 3}.
+void ReserveFloat3(core::Tensor& buffer,
+                   int64_t n,
+                   const core::Device& device) {
+    if (buffer.GetDtype() != core::Dtype::Float32 || buffer.NumDims() != 2 ||
+        buffer.GetShape(1) != 3 || buffer.GetLength() < n ||
+        buffer.GetDevice() != device || !buffer.IsContiguous()) {
+        buffer = core::Tensor({n, 3}, core::Dtype::Float32, device);
+    }
+}
+
+}  // namespace
+
 void Unproject(const core::Tensor& depth,
+               const core::Tensor& image_colors,
                core::Tensor& points,
+               core::Tensor& colors,
                const core::Tensor& intrinsics,
                const core::Tensor& extrinsics,
                float depth_scale,
                float depth_max,
                int64_t stride) {
     core::Device device = depth.GetDevice();
+    depth.AssertDtype(core::Dtype::UInt16);
+    if (stride < 1) {
+        utility::LogError("Illegal stride {}, must be positive.", stride);
+    }
+
+    bool has_colors = image_colors.NumElements() != 0;
+    if (has_colors) {
+        image_colors.AssertDevice(device);
+        if (image_colors.NumDims() != 3 || image_colors.GetShape(2) != 3 ||
+            image_colors.GetShape(0) != depth.GetShape(0) ||
+            image_colors.GetShape(1) != depth.GetShape(1)) {
+            utility::LogError(
+                    "Color image of shape {} does not match the depth image "
+                    "of shape {}.",
+                    image_colors.GetShape(), depth.GetShape());
+        }
+        if (image_colors.GetDtype() != core::Dtype::UInt8 &&
+            image_colors.GetDtype() != core::Dtype::Float32) {
+            utility::LogError("Unsupported color image dtype {}.",
+                              image_colors.GetDtype().ToString());
+        }
+    }
 
-    core::Tensor intrinsics_d = intrinsics;
-    if (intrinsics.GetDevice() != device) {
-        intrinsics_d = intrinsics.Copy(device);
+    // The camera parameters are only read on host to set up the indexer, so
+    // they are kept on CPU to avoid device round trips.
+    core::Device host("CPU:0");
+    core::Tensor intrinsics_h = intrinsics;
+    if (intrinsics.GetDevice() != host) {
+        intrinsics_h = intrinsics.Copy(host);
     }
 
-    core::Tensor extrinsics_d = extrinsics;
-    if (extrinsics.GetDevice() != device) {
-        extrinsics_d = extrinsics.Copy(device);
+    core::Tensor extrinsics_h = extrinsics;
+    if (extrinsics.GetDevice() != host) {
+        extrinsics_h = extrinsics.Copy(host);
+    }
+
+    int64_t rows_strided = (depth.GetShape(0) + stride - 1) / stride;
+    int64_t cols_strided = (depth.GetShape(1) + stride - 1) / stride;
+    ReserveFloat3(points, rows_strided * cols_strided, device);
+    if (has_colors) {
+        ReserveFloat3(colors, rows_strided * cols_strided, device);
     }
 
     core::Device::DeviceType device_type = device.GetType();
     if (device_type == core::Device::DeviceType::CPU) {
-        UnprojectCPU(depth, points, intrinsics_d, extrinsics_d, depth_scale,
-                     depth_max, stride);
+        UnprojectCPU(depth, image_colors, points, colors, intrinsics_h,
+                     extrinsics_h, depth_scale, depth_max, stride);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        UnprojectCUDA(depth, image_colors, points, colors, intrinsics_h,
+                      extrinsics_h, depth_scale, depth_max, stride);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void EstimateNormals(const core::Tensor& points,
+                     const core::Tensor& neighbor_indices,
+                     const core::Tensor& neighbor_distances,
+                     core::Tensor& normals,
+                     bool has_normals,
+                     double max_distance2) {
+    core::Device::DeviceType device_type = points.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        EstimateNormalsCPU(points, neighbor_indices, neighbor_distances,
+                           normals, has_normals, max_distance2);
     } else if (device_type == core::Device::DeviceType::CUDA) {
 #ifdef BUILD_CUDA_MODULE
-        UnprojectCUDA(depth, points, intrinsics_d, extrinsics_d, depth_scale,
-                      depth_max, stride);
+        EstimateNormalsCUDA(points, neighbor_indices, neighbor_distances,
+                            normals, has_normals, max_distance2);
 #else
         utility::LogError("Not compiled with CUDA, but CUDA device is used.");
 #endif
@@ -71,6 +143,203 @@ void Unproject(const core::Tensor& depth,
         utility::LogError("Unimplemented device");
     }
 }
+
+void OrientNormalsTowardsCameraLocation(const core::Tensor& points,
+                                        core::Tensor& normals,
+                                        const core::Tensor& camera_location) {
+    core::Device::DeviceType device_type = points.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        OrientNormalsTowardsCameraLocationCPU(points, normals, camera_location);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        OrientNormalsTowardsCameraLocationCUDA(points, normals,
+                                               camera_location);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void SortBySegment(const core::Tensor& segment_ids,
+                   int64_t num_segments,
+                   core::Tensor& offsets,
+                   core::Tensor& order) {
+    core::Device::DeviceType device_type = segment_ids.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        SortBySegmentCPU(segment_ids, num_segments, offsets, order);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        SortBySegmentCUDA(segment_ids, num_segments, offsets, order);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void SegmentMean(const core::Tensor& src,
+                 const core::Tensor& offsets,
+                 const core::Tensor& order,
+                 core::Tensor& dst) {
+    core::Device::DeviceType device_type = src.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        SegmentMeanCPU(src, offsets, order, dst);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        SegmentMeanCUDA(src, offsets, order, dst);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void RowSplits(const core::Tensor& num_neighbors, core::Tensor& row_splits) {
+    core::Device::DeviceType device_type = num_neighbors.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        RowSplitsCPU(num_neighbors, row_splits);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        RowSplitsCUDA(num_neighbors, row_splits);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void SegmentIdsFromRowSplits(const core::Tensor& row_splits,
+                             core::Tensor& segment_ids) {
+    core::Device::DeviceType device_type = row_splits.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        SegmentIdsFromRowSplitsCPU(row_splits, segment_ids);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        SegmentIdsFromRowSplitsCUDA(row_splits, segment_ids);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void SegmentMode(const core::Tensor& labels,
+                 const core::Tensor& offsets,
+                 const core::Tensor& order,
+                 core::Tensor& dst) {
+    core::Dtype dtype = labels.GetDtype();
+    if (dtype != core::Dtype::Int32 && dtype != core::Dtype::Int64) {
+        utility::LogError("labels must be Int32 or Int64, but got {}.",
+                          dtype.ToString());
+    }
+    core::Device::DeviceType device_type = labels.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        SegmentModeCPU(labels, offsets, order, dst);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        SegmentModeCUDA(labels, offsets, order, dst);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void ComputeISSSaliency(const core::Tensor& points,
+                        const core::Tensor& neighbor_indices,
+                        const core::Tensor& neighbor_row_splits,
+                        double salient_radius,
+                        double gamma_21,
+                        double gamma_32,
+                        int min_neighbors,
+                        core::Tensor& saliency) {
+    core::Device::DeviceType device_type = points.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeISSSaliencyCPU(points, neighbor_indices, neighbor_row_splits,
+                              salient_radius, gamma_21, gamma_32,
+                              min_neighbors, saliency);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        ComputeISSSaliencyCUDA(points, neighbor_indices, neighbor_row_splits,
+                               salient_radius, gamma_21, gamma_32,
+                               min_neighbors, saliency);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void FindISSKeypoints(const core::Tensor& points,
+                      const core::Tensor& neighbor_indices,
+                      const core::Tensor& neighbor_row_splits,
+                      const core::Tensor& saliency,
+                      double non_max_radius,
+                      int min_neighbors,
+                      core::Tensor& keypoint_mask) {
+    core::Device::DeviceType device_type = points.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        FindISSKeypointsCPU(points, neighbor_indices, neighbor_row_splits,
+                            saliency, non_max_radius, min_neighbors,
+                            keypoint_mask);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        FindISSKeypointsCUDA(points, neighbor_indices, neighbor_row_splits,
+                             saliency, non_max_radius, min_neighbors,
+                             keypoint_mask);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void GatherRows(const std::vector<core::Tensor>& srcs,
+                const core::Tensor& indices,
+                std::vector<core::Tensor>& dsts) {
+    core::Device::DeviceType device_type = indices.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        GatherRowsCPU(srcs, indices, dsts);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        GatherRowsCUDA(srcs, indices, dsts);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void ComputeBoxMask(const core::Tensor& points,
+                    const core::Tensor& center,
+                    const core::Tensor& axes,
+                    const core::Tensor& min_bound,
+                    const core::Tensor& max_bound,
+                    core::Tensor& mask) {
+    core::Device::DeviceType device_type = points.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeBoxMaskCPU(points, center, axes, min_bound, max_bound, mask);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        ComputeBoxMaskCUDA(points, center, axes, min_bound, max_bound, mask);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
 }  // namespace pointcloud
 }  // namespace kernel
 }  // namespace geometry
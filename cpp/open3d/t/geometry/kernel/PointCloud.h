@@ -27,6 +27,7 @@
 #pragma once
 
 #include <unordered_map>
+#include <vector>
 
 #include "open3d/core/Tensor.h"
 
@@ -35,8 +36,30 @@ namespace t {
 namespace geometry {
 namespace kernel {
 namespace pointcloud {
+/// Unprojects the valid pixels of a depth image to points in the world frame
+/// in a single pass, gathering the colors of the same pixels if a color image
+/// is given.
+///
+/// \param depth UInt16 depth image of shape {rows, cols, 1}.
+/// \param image_colors Optional UInt8 or Float32 color image of shape {rows,
+/// cols, 3}. Pass an empty tensor to skip the colors.
+/// \param points Output Float32 points of shape {n, 3}, where n is the number
+/// of sampled pixels with a depth in (0, depth_max). If points is a contiguous
+/// Float32 tensor of shape {N, 3} on the device of depth with N at least the
+/// number of sampled pixels, its memory is reused and points becomes a view of
+/// its first n rows.
+/// \param colors Output Float32 colors in [0, 1] of shape {n, 3}, reused in
+/// the same way as points. Untouched if image_colors is empty.
+/// \param intrinsics Float32 camera intrinsic matrix of shape {3, 3}.
+/// \param extrinsics Float32 world to camera transformation of shape {4, 4}.
+/// The points are not transformed if it is the identity.
+/// \param depth_scale The depth is scaled by 1 / depth_scale.
+/// \param depth_max Pixels at depth_max or farther are skipped.
+/// \param stride Every stride-th pixel in each direction is sampled.
 void Unproject(const core::Tensor& depth,
+               const core::Tensor& image_colors,
                core::Tensor& points,
+               core::Tensor& colors,
                const core::Tensor& intrinsics,
                const core::Tensor& extrinsics,
                float depth_scale,
@@ -44,7 +67,9 @@ void Unproject(const core::Tensor& depth,
                int64_t stride);
 
 void UnprojectCPU(const core::Tensor& depth,
+                  const core::Tensor& image_colors,
                   core::Tensor& points,
+                  core::Tensor& colors,
                   const core::Tensor& intrinsics,
                   const core::Tensor& extrinsics,
                   float depth_scale,
@@ -53,13 +78,292 @@ void UnprojectCPU(const core::Tensor& depth,
 
 #ifdef BUILD_CUDA_MODULE
 void UnprojectCUDA(const core::Tensor& depth,
+                   const core::Tensor& image_colors,
                    core::Tensor& points,
+                   core::Tensor& colors,
                    const core::Tensor& intrinsics,
                    const core::Tensor& extrinsics,
                    float depth_scale,
                    float depth_max,
                    int64_t stride);
 #endif
+
+/// Estimates the normals of points from the covariance of their neighbors.
+///
+/// \param points Points of shape {n, 3}, Float32 or Float64.
+/// \param neighbor_indices Int64 indices of shape {n, max_nn} of the neighbors
+/// of each point sorted by distance, padded with -1.
+/// \param neighbor_distances Squared distances of the neighbors, same shape
+/// as neighbor_indices and same dtype as points.
+/// \param normals Normals of shape {n, 3}, same dtype as points. If
+/// has_normals, it holds the previous normals used to orient the new ones.
+/// \param has_normals Whether normals holds previous normals.
+/// \param max_distance2 Neighbors at a larger squared distance are ignored.
+void EstimateNormals(const core::Tensor& points,
+                     const core::Tensor& neighbor_indices,
+                     const core::Tensor& neighbor_distances,
+                     core::Tensor& normals,
+                     bool has_normals,
+                     double max_distance2);
+
+void EstimateNormalsCPU(const core::Tensor& points,
+                        const core::Tensor& neighbor_indices,
+                        const core::Tensor& neighbor_distances,
+                        core::Tensor& normals,
+                        bool has_normals,
+                        double max_distance2);
+
+#ifdef BUILD_CUDA_MODULE
+void EstimateNormalsCUDA(const core::Tensor& points,
+                         const core::Tensor& neighbor_indices,
+                         const core::Tensor& neighbor_distances,
+                         core::Tensor& normals,
+                         bool has_normals,
+                         double max_distance2);
+#endif
+
+/// Flips the normals pointing away from the camera location. Zero normals
+/// are set to the unit direction towards the camera.
+void OrientNormalsTowardsCameraLocation(const core::Tensor& points,
+                                        core::Tensor& normals,
+                                        const core::Tensor& camera_location);
+
+void OrientNormalsTowardsCameraLocationCPU(const core::Tensor& points,
+                                           core::Tensor& normals,
+                                           const core::Tensor& camera_location);
+
+#ifdef BUILD_CUDA_MODULE
+void OrientNormalsTowardsCameraLocationCUDA(
+        const core::Tensor& points,
+        core::Tensor& normals,
+        const core::Tensor& camera_location);
+#endif
+
+/// Groups the points by segment: order lists the point indices sorted by
+/// segment, and the points of segment s are order[offsets[s]:offsets[s + 1]].
+///
+/// \param segment_ids Int64 segment of each point, in [0, num_segments).
+/// \param num_segments Number of segments.
+/// \param offsets Output Int64 tensor of shape {num_segments + 1}.
+/// \param order Output Int64 tensor with the same shape as segment_ids.
+void SortBySegment(const core::Tensor& segment_ids,
+                   int64_t num_segments,
+                   core::Tensor& offsets,
+                   core::Tensor& order);
+
+void SortBySegmentCPU(const core::Tensor& segment_ids,
+                      int64_t num_segments,
+                      core::Tensor& offsets,
+                      core::Tensor& order);
+
+#ifdef BUILD_CUDA_MODULE
+void SortBySegmentCUDA(const core::Tensor& segment_ids,
+                       int64_t num_segments,
+                       core::Tensor& offsets,
+                       core::Tensor& order);
+#endif
+
+/// Averages the rows of src over each segment given by SortBySegment.
+///
+/// \param src Contiguous tensor of shape {n, ...}.
+/// \param offsets Segment offsets from SortBySegment.
+/// \param order Point order from SortBySegment.
+/// \param dst Output tensor of shape {num_segments, ...}, same dtype as src.
+void SegmentMean(const core::Tensor& src,
+                 const core::Tensor& offsets,
+                 const core::Tensor& order,
+                 core::Tensor& dst);
+
+void SegmentMeanCPU(const core::Tensor& src,
+                    const core::Tensor& offsets,
+                    const core::Tensor& order,
+                    core::Tensor& dst);
+
+#ifdef BUILD_CUDA_MODULE
+void SegmentMeanCUDA(const core::Tensor& src,
+                     const core::Tensor& offsets,
+                     const core::Tensor& order,
+                     core::Tensor& dst);
+#endif
+
+/// Converts the number of neighbors of each query of a radius search into the
+/// row splits of the neighbor list: the neighbors of query i are at
+/// [row_splits[i], row_splits[i + 1]).
+///
+/// \param num_neighbors Int64 tensor of shape {n}.
+/// \param row_splits Output Int64 tensor of shape {n + 1}.
+void RowSplits(const core::Tensor& num_neighbors, core::Tensor& row_splits);
+
+void RowSplitsCPU(const core::Tensor& num_neighbors, core::Tensor& row_splits);
+
+#ifdef BUILD_CUDA_MODULE
+void RowSplitsCUDA(const core::Tensor& num_neighbors, core::Tensor& row_splits);
+#endif
+
+/// The inverse of RowSplits: finds the row of each element of a ragged list,
+/// the largest r with row_splits[r] <= i.
+///
+/// \param row_splits Int64 tensor of shape {num_rows + 1}, non-decreasing.
+/// \param segment_ids Output Int64 tensor of shape {row_splits[num_rows]}.
+void SegmentIdsFromRowSplits(const core::Tensor& row_splits,
+                             core::Tensor& segment_ids);
+
+void SegmentIdsFromRowSplitsCPU(const core::Tensor& row_splits,
+                                core::Tensor& segment_ids);
+
+#ifdef BUILD_CUDA_MODULE
+void SegmentIdsFromRowSplitsCUDA(const core::Tensor& row_splits,
+                                 core::Tensor& segment_ids);
+#endif
+
+/// Takes the most frequent label over each segment given by SortBySegment,
+/// the smallest one on ties.
+///
+/// \param labels Int32 or Int64 tensor of shape {n}.
+/// \param offsets Segment offsets from SortBySegment.
+/// \param order Point order from SortBySegment.
+/// \param dst Output tensor of shape {num_segments}, same dtype as labels.
+void SegmentMode(const core::Tensor& labels,
+                 const core::Tensor& offsets,
+                 const core::Tensor& order,
+                 core::Tensor& dst);
+
+void SegmentModeCPU(const core::Tensor& labels,
+                    const core::Tensor& offsets,
+                    const core::Tensor& order,
+                    core::Tensor& dst);
+
+#ifdef BUILD_CUDA_MODULE
+void SegmentModeCUDA(const core::Tensor& labels,
+                     const core::Tensor& offsets,
+                     const core::Tensor& order,
+                     core::Tensor& dst);
+#endif
+
+/// Computes the Intrinsic Shape Signature saliency of each point, the
+/// smallest eigenvalue of the covariance of its neighbors within
+/// \p salient_radius, or 0 if the point has less than \p min_neighbors such
+/// neighbors or if the eigenvalue ratios are not below \p gamma_21 and
+/// \p gamma_32. The neighbors may come from a search with a larger radius.
+///
+/// \param points Float32 or Float64 tensor of shape {n, 3}.
+/// \param neighbor_indices Int64 neighbors of all the points.
+/// \param neighbor_row_splits Int64 row splits of the neighbors, of shape
+/// {n + 1}.
+/// \param saliency Output Float64 tensor of shape {n}.
+void ComputeISSSaliency(const core::Tensor& points,
+                        const core::Tensor& neighbor_indices,
+                        const core::Tensor& neighbor_row_splits,
+                        double salient_radius,
+                        double gamma_21,
+                        double gamma_32,
+                        int min_neighbors,
+                        core::Tensor& saliency);
+
+void ComputeISSSaliencyCPU(const core::Tensor& points,
+                           const core::Tensor& neighbor_indices,
+                           const core::Tensor& neighbor_row_splits,
+                           double salient_radius,
+                           double gamma_21,
+                           double gamma_32,
+                           int min_neighbors,
+                           core::Tensor& saliency);
+
+#ifdef BUILD_CUDA_MODULE
+void ComputeISSSaliencyCUDA(const core::Tensor& points,
+                            const core::Tensor& neighbor_indices,
+                            const core::Tensor& neighbor_row_splits,
+                            double salient_radius,
+                            double gamma_21,
+                            double gamma_32,
+                            int min_neighbors,
+                            core::Tensor& saliency);
+#endif
+
+/// Non-maximum suppression of the ISS saliency: a point with a positive
+/// saliency is a keypoint if it has at least \p min_neighbors neighbors
+/// within \p non_max_radius and none of them has a larger saliency.
+///
+/// \param keypoint_mask Output Bool tensor of shape {n}.
+void FindISSKeypoints(const core::Tensor& points,
+                      const core::Tensor& neighbor_indices,
+                      const core::Tensor& neighbor_row_splits,
+                      const core::Tensor& saliency,
+                      double non_max_radius,
+                      int min_neighbors,
+                      core::Tensor& keypoint_mask);
+
+void FindISSKeypointsCPU(const core::Tensor& points,
+                         const core::Tensor& neighbor_indices,
+                         const core::Tensor& neighbor_row_splits,
+                         const core::Tensor& saliency,
+                         double non_max_radius,
+                         int min_neighbors,
+                         core::Tensor& keypoint_mask);
+
+#ifdef BUILD_CUDA_MODULE
+void FindISSKeypointsCUDA(const core::Tensor& points,
+                          const core::Tensor& neighbor_indices,
+                          const core::Tensor& neighbor_row_splits,
+                          const core::Tensor& saliency,
+                          double non_max_radius,
+                          int min_neighbors,
+                          core::Tensor& keypoint_mask);
+#endif
+
+/// Gathers the rows indices of several tensors in a single kernel launch,
+/// copying the rows bytewise.
+///
+/// \param srcs Contiguous tensors of shape {n, ...} of any dtype, on the
+/// device of indices.
+/// \param indices Int64 row indices in [0, n) of shape {k}.
+/// \param dsts Output tensors of shape {k, ...}, one for each tensor of srcs
+/// with the same dtype.
+void GatherRows(const std::vector<core::Tensor>& srcs,
+                const core::Tensor& indices,
+                std::vector<core::Tensor>& dsts);
+
+void GatherRowsCPU(const std::vector<core::Tensor>& srcs,
+                   const core::Tensor& indices,
+                   std::vector<core::Tensor>& dsts);
+
+#ifdef BUILD_CUDA_MODULE
+void GatherRowsCUDA(const std::vector<core::Tensor>& srcs,
+                    const core::Tensor& indices,
+                    std::vector<core::Tensor>& dsts);
+#endif
+
+/// Marks the points p inside the box min_bound <= axes * (p - center) <=
+/// max_bound, bounds included.
+///
+/// \param points Points of shape {n, 3}, Float32 or Float64.
+/// \param center Float64 tensor of shape {3}.
+/// \param axes Float64 tensor of shape {3, 3} with the box axes as rows.
+/// \param min_bound Float64 tensor of shape {3}.
+/// \param max_bound Float64 tensor of shape {3}.
+/// \param mask Output Bool tensor of shape {n}.
+void ComputeBoxMask(const core::Tensor& points,
+                    const core::Tensor& center,
+                    const core::Tensor& axes,
+                    const core::Tensor& min_bound,
+                    const core::Tensor& max_bound,
+                    core::Tensor& mask);
+
+void ComputeBoxMaskCPU(const core::Tensor& points,
+                       const core::Tensor& center,
+                       const core::Tensor& axes,
+                       const core::Tensor& min_bound,
+                       const core::Tensor& max_bound,
+                       core::Tensor& mask);
+
+#ifdef BUILD_CUDA_MODULE
+void ComputeBoxMaskCUDA(const core::Tensor& points,
+                        const core::Tensor& center,
+                        const core::Tensor& axes,
+                        const core::Tensor& min_bound,
+                        const core::Tensor& max_bound,
+                        core::Tensor& mask);
+#endif
 }  // namespace pointcloud
 }  // namespace kernel
 }  // namespace geometry
@@ -25,12 +25,24 @@
 // ----------------------------------------------------------------------------
 
 #include <atomic>
+#include <limits>
+#include <numeric>
 
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+#include <thrust/device_ptr.h>
+#include <thrust/execution_policy.h>
+#include <thrust/scan.h>
+#endif
+
+#include "open3d/core/Atomic.h"
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/CoreUtil.h"
 #include "open3d/core/Dispatch.h"
 #include "open3d/core/Dtype.h"
 #include "open3d/core/MemoryManager.h"
 #include "open3d/core/SizeVector.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/core/linalg/SymmetricEigen3x3Shared.h"
 #include "open3d/t/geometry/kernel/GeometryIndexer.h"
 #include "open3d/t/geometry/kernel/GeometryMacros.h"
 #include "open3d/t/geometry/kernel/PointCloud.h"
@@ -47,24 +59,40 @@ void UnprojectCUDA
 void UnprojectCPU
 #endif
         (const core::Tensor& depth,
+         const core::Tensor& image_colors,
          core::Tensor& points,
+         core::Tensor& colors,
          const core::Tensor& intrinsics,
          const core::Tensor& extrinsics,
          float depth_scale,
          float depth_max,
          int64_t stride) {
-
     NDArrayIndexer depth_indexer(depth, 2);
-    TransformIndexer ti(intrinsics, extrinsics.Inverse(), 1.0f);
 
-    // Output
-    int64_t rows_strided = depth_indexer.GetShape(0) / stride;
-    int64_t cols_strided = depth_indexer.GetShape(1) / stride;
+    // The points are only transformed back to the world frame if the camera
+    // is not at the origin.
+    core::Tensor identity =
+            core::Tensor::Eye(4, core::Dtype::Float32, core::Device("CPU:0"));
+    bool transform = !extrinsics.AllClose(identity);
+    TransformIndexer ti(intrinsics, transform ? extrinsics.Inverse() : identity,
+                        1.0f);
 
-    points = core::Tensor({rows_strided * cols_strided, 3},
-                          core::Dtype::Float32, depth.GetDevice());
+    // Output, preallocated by the caller with at least one row per sampled
+    // pixel.
+    int64_t rows_strided = (depth_indexer.GetShape(0) + stride - 1) / stride;
+    int64_t cols_strided = (depth_indexer.GetShape(1) + stride - 1) / stride;
     NDArrayIndexer point_indexer(points, 1);
 
+    bool has_colors = image_colors.NumElements() != 0;
+    bool colors_uint8 =
+            has_colors && image_colors.GetDtype() == core::Dtype::UInt8;
+    NDArrayIndexer image_colors_indexer;
+    NDArrayIndexer colors_indexer;
+    if (has_colors) {
+        image_colors_indexer = NDArrayIndexer(image_colors, 2);
+        colors_indexer = NDArrayIndexer(colors, 1);
+    }
+
     // Counter
 #if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
     core::Tensor count(std::vector<int>{0}, {}, core::Dtype::Int32,
@@ -97,8 +125,34 @@ void UnprojectCPU
 
                     float* vertex =
                             point_indexer.GetDataPtrFromCoord<float>(idx);
-                    ti.RigidTransform(x_c, y_c, z_c, vertex + 0, vertex + 1,
-                                      vertex + 2);
+                    if (transform) {
+                        ti.RigidTransform(x_c, y_c, z_c, vertex + 0,
+                                          vertex + 1, vertex + 2);
+                    } else {
+                        vertex[0] = x_c;
+                        vertex[1] = y_c;
+                        vertex[2] = z_c;
+                    }
+
+                    if (has_colors) {
+                        float* color =
+                                colors_indexer.GetDataPtrFromCoord<float>(idx);
+                        if (colors_uint8) {
+                            const uint8_t* pixel =
+                                    image_colors_indexer
+                                            .GetDataPtrFromCoord<uint8_t>(x, y);
+                            for (int c = 0; c < 3; ++c) {
+                                color[c] = pixel[c] / 255.0f;
+                            }
+                        } else {
+                            const float* pixel =
+                                    image_colors_indexer
+                                            .GetDataPtrFromCoord<float>(x, y);
+                            for (int c = 0; c < 3; ++c) {
+                                color[c] = pixel[c];
+                            }
+                        }
+                    }
                 }
             });
 #if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
@@ -107,7 +161,651 @@ void UnprojectCPU
     int total_pts_count = (*count_ptr).load();
 #endif
     points = points.Slice(0, 0, total_pts_count);
+    if (has_colors) {
+        colors = colors.Slice(0, 0, total_pts_count);
+    }
+}
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void EstimateNormalsCUDA
+#else
+void EstimateNormalsCPU
+#endif
+        (const core::Tensor& points,
+         const core::Tensor& neighbor_indices,
+         const core::Tensor& neighbor_distances,
+         core::Tensor& normals,
+         bool has_normals,
+         double max_distance2) {
+    int64_t n = points.GetLength();
+    int64_t max_nn = neighbor_indices.GetShape(1);
+    const int64_t* indices_ptr =
+            static_cast<const int64_t*>(neighbor_indices.GetDataPtr());
+
+    DISPATCH_FLOAT32_FLOAT64_DTYPE(points.GetDtype(), [&]() {
+        const scalar_t* points_ptr =
+                static_cast<const scalar_t*>(points.GetDataPtr());
+        const scalar_t* distances_ptr =
+                static_cast<const scalar_t*>(neighbor_distances.GetDataPtr());
+        scalar_t* normals_ptr = static_cast<scalar_t*>(normals.GetDataPtr());
+        scalar_t max_dist2 = max_distance2 < std::numeric_limits<double>::max()
+                                     ? static_cast<scalar_t>(max_distance2)
+                                     : std::numeric_limits<scalar_t>::max();
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+        core::kernel::CUDALauncher::LaunchGeneralKernel(
+                n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+#else
+        core::kernel::CPULauncher::LaunchGeneralKernel(
+                n, [&](int64_t workload_idx) {
+#endif
+                    const int64_t* nb_indices =
+                            indices_ptr + workload_idx * max_nn;
+                    const scalar_t* nb_distances =
+                            distances_ptr + workload_idx * max_nn;
+                    scalar_t* normal = normals_ptr + workload_idx * 3;
+
+                    // Neighbors are sorted by distance, so the valid ones
+                    // come first.
+                    int64_t count = 0;
+                    while (count < max_nn && nb_indices[count] >= 0 &&
+                           nb_distances[count] <= max_dist2) {
+                        count++;
+                    }
+                    if (count < 3) {
+                        normal[0] = 0;
+                        normal[1] = 0;
+                        normal[2] = 1;
+                        return;
+                    }
+
+                    // Two passes over the neighbors keep the covariance
+                    // accurate in single precision.
+                    scalar_t mean[3] = {0, 0, 0};
+                    for (int64_t k = 0; k < count; ++k) {
+                        const scalar_t* p = points_ptr + 3 * nb_indices[k];
+                        mean[0] += p[0];
+                        mean[1] += p[1];
+                        mean[2] += p[2];
+                    }
+                    for (int i = 0; i < 3; ++i) {
+                        mean[i] /= count;
+                    }
+                    scalar_t covariance[9] = {0, 0, 0, 0, 0, 0, 0, 0, 0};
+                    for (int64_t k = 0; k < count; ++k) {
+                        const scalar_t* p = points_ptr + 3 * nb_indices[k];
+                        scalar_t d[3] = {p[0] - mean[0], p[1] - mean[1],
+                                         p[2] - mean[2]};
+                        covariance[0] += d[0] * d[0];
+                        covariance[1] += d[0] * d[1];
+                        covariance[2] += d[0] * d[2];
+                        covariance[4] += d[1] * d[1];
+                        covariance[5] += d[1] * d[2];
+                        covariance[8] += d[2] * d[2];
+                    }
+
+                    scalar_t n_new[3] = {0, 0, 0};
+                    if (covariance[0] != 0 || covariance[1] != 0 ||
+                        covariance[2] != 0 || covariance[4] != 0 ||
+                        covariance[5] != 0 || covariance[8] != 0) {
+                        scalar_t eigenvalues[3];
+                        scalar_t eigenvectors[9];
+                        core::SymmetricEigen3x3(covariance, eigenvalues,
+                                                eigenvectors);
+                        // The eigenvector of the smallest eigenvalue is the
+                        // first column.
+                        n_new[0] = eigenvectors[0];
+                        n_new[1] = eigenvectors[3];
+                        n_new[2] = eigenvectors[6];
+                    } else if (!has_normals) {
+                        n_new[2] = 1;
+                    } else {
+                        return;
+                    }
+                    scalar_t dot = n_new[0] * normal[0] +
+                                   n_new[1] * normal[1] + n_new[2] * normal[2];
+                    if (has_normals && dot < 0) {
+                        n_new[0] = -n_new[0];
+                        n_new[1] = -n_new[1];
+                        n_new[2] = -n_new[2];
+                    }
+                    normal[0] = n_new[0];
+                    normal[1] = n_new[1];
+                    normal[2] = n_new[2];
+                });
+    });
+}
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void OrientNormalsTowardsCameraLocationCUDA
+#else
+void OrientNormalsTowardsCameraLocationCPU
+#endif
+        (const core::Tensor& points,
+         core::Tensor& normals,
+         const core::Tensor& camera_location) {
+    int64_t n = points.GetLength();
+    std::vector<double> camera =
+            camera_location.To(core::Dtype::Float64).ToFlatVector<double>();
+
+    DISPATCH_FLOAT32_FLOAT64_DTYPE(points.GetDtype(), [&]() {
+        const scalar_t* points_ptr =
+                static_cast<const scalar_t*>(points.GetDataPtr());
+        scalar_t* normals_ptr = static_cast<scalar_t*>(normals.GetDataPtr());
+        scalar_t cx = static_cast<scalar_t>(camera[0]);
+        scalar_t cy = static_cast<scalar_t>(camera[1]);
+        scalar_t cz = static_cast<scalar_t>(camera[2]);
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+        core::kernel::CUDALauncher::LaunchGeneralKernel(
+                n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+#else
+        core::kernel::CPULauncher::LaunchGeneralKernel(
+                n, [&](int64_t workload_idx) {
+#endif
+                    const scalar_t* p = points_ptr + workload_idx * 3;
+                    scalar_t* normal = normals_ptr + workload_idx * 3;
+                    scalar_t r[3] = {cx - p[0], cy - p[1], cz - p[2]};
+                    scalar_t dot = normal[0] * r[0] + normal[1] * r[1] +
+                                   normal[2] * r[2];
+                    if (normal[0] == 0 && normal[1] == 0 && normal[2] == 0) {
+                        scalar_t norm = std::sqrt(r[0] * r[0] + r[1] * r[1] +
+                                                  r[2] * r[2]);
+                        if (norm == 0) {
+                            normal[2] = 1;
+                        } else {
+                            normal[0] = r[0] / norm;
+                            normal[1] = r[1] / norm;
+                            normal[2] = r[2] / norm;
+                        }
+                    } else if (dot < 0) {
+                        normal[0] = -normal[0];
+                        normal[1] = -normal[1];
+                        normal[2] = -normal[2];
+                    }
+                });
+    });
+}
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void SortBySegmentCUDA
+#else
+void SortBySegmentCPU
+#endif
+        (const core::Tensor& segment_ids,
+         int64_t num_segments,
+         core::Tensor& offsets,
+         core::Tensor& order) {
+    core::Device device = segment_ids.GetDevice();
+    int64_t n = segment_ids.GetLength();
+    const int64_t* segment_ptr =
+            static_cast<const int64_t*>(segment_ids.GetDataPtr());
+
+    // Counting sort: count the points of each segment, scan the counts into
+    // offsets, then scatter the points through one cursor per segment.
+    offsets = core::Tensor::Zeros({num_segments + 1}, core::Dtype::Int64,
+                                  device);
+    order = core::Tensor::Empty({n}, core::Dtype::Int64, device);
+    uint64_t* counts_ptr = static_cast<uint64_t*>(offsets.GetDataPtr()) + 1;
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+    core::kernel::CUDALauncher::LaunchGeneralKernel(
+            n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                atomicAdd(reinterpret_cast<unsigned long long*>(
+                                  counts_ptr + segment_ptr[workload_idx]),
+                          1ull);
+            });
+    int64_t* offsets_ptr = static_cast<int64_t*>(offsets.GetDataPtr());
+    thrust::inclusive_scan(thrust::device, offsets_ptr,
+                           offsets_ptr + num_segments + 1, offsets_ptr);
+#else
+    core::kernel::CPULauncher::LaunchGeneralKernel(
+            n, [&](int64_t workload_idx) {
+                core::AtomicFetchAddRelaxed(
+                        counts_ptr + segment_ptr[workload_idx], 1);
+            });
+    int64_t* offsets_ptr = static_cast<int64_t*>(offsets.GetDataPtr());
+    std::partial_sum(offsets_ptr, offsets_ptr + num_segments + 1, offsets_ptr);
+#endif
+
+    core::Tensor cursors = offsets.Slice(0, 0, num_segments).Copy();
+    uint64_t* cursors_ptr = static_cast<uint64_t*>(cursors.GetDataPtr());
+    int64_t* order_ptr = static_cast<int64_t*>(order.GetDataPtr());
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+    core::kernel::CUDALauncher::LaunchGeneralKernel(
+            n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                uint64_t pos = atomicAdd(
+                        reinterpret_cast<unsigned long long*>(
+                                cursors_ptr + segment_ptr[workload_idx]),
+                        1ull);
+                order_ptr[pos] = workload_idx;
+            });
+#else
+    core::kernel::CPULauncher::LaunchGeneralKernel(
+            n, [&](int64_t workload_idx) {
+                uint64_t pos = core::AtomicFetchAddRelaxed(
+                        cursors_ptr + segment_ptr[workload_idx], 1);
+                order_ptr[pos] = workload_idx;
+            });
+#endif
 }
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void SegmentMeanCUDA
+#else
+void SegmentMeanCPU
+#endif
+        (const core::Tensor& src,
+         const core::Tensor& offsets,
+         const core::Tensor& order,
+         core::Tensor& dst) {
+    int64_t num_segments = offsets.GetLength() - 1;
+    int64_t n = src.GetLength();
+    int64_t num_channels = n > 0 ? src.NumElements() / n : 0;
+    core::SizeVector dst_shape = src.GetShape();
+    dst_shape[0] = num_segments;
+    dst = core::Tensor::Empty(dst_shape, src.GetDtype(), src.GetDevice());
+
+    const int64_t* offsets_ptr =
+            static_cast<const int64_t*>(offsets.GetDataPtr());
+    const int64_t* order_ptr = static_cast<const int64_t*>(order.GetDataPtr());
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        const scalar_t* src_ptr =
+                static_cast<const scalar_t*>(src.GetDataPtr());
+        scalar_t* dst_ptr = static_cast<scalar_t*>(dst.GetDataPtr());
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+        core::kernel::CUDALauncher::LaunchGeneralKernel(
+                num_segments * num_channels,
+                [=] OPEN3D_DEVICE(int64_t workload_idx) {
+#else
+        core::kernel::CPULauncher::LaunchGeneralKernel(
+                num_segments * num_channels, [&](int64_t workload_idx) {
+#endif
+                    int64_t segment = workload_idx / num_channels;
+                    int64_t channel = workload_idx % num_channels;
+                    int64_t begin = offsets_ptr[segment];
+                    int64_t end = offsets_ptr[segment + 1];
+                    double sum = 0;
+                    for (int64_t k = begin; k < end; ++k) {
+                        sum += static_cast<double>(
+                                src_ptr[order_ptr[k] * num_channels + channel]);
+                    }
+                    dst_ptr[workload_idx] =
+                            static_cast<scalar_t>(sum / (end - begin));
+                });
+    });
+}
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void RowSplitsCUDA
+#else
+void RowSplitsCPU
+#endif
+        (const core::Tensor& num_neighbors, core::Tensor& row_splits) {
+    int64_t n = num_neighbors.GetLength();
+    row_splits = core::Tensor::Zeros({n + 1}, core::Dtype::Int64,
+                                     num_neighbors.GetDevice());
+    row_splits.Slice(0, 1, n + 1) = num_neighbors.To(core::Dtype::Int64);
+    int64_t* row_splits_ptr = static_cast<int64_t*>(row_splits.GetDataPtr());
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+    thrust::inclusive_scan(thrust::device, row_splits_ptr,
+                           row_splits_ptr + n + 1, row_splits_ptr);
+#else
+    std::partial_sum(row_splits_ptr, row_splits_ptr + n + 1, row_splits_ptr);
+#endif
+}
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void SegmentIdsFromRowSplitsCUDA
+#else
+void SegmentIdsFromRowSplitsCPU
+#endif
+        (const core::Tensor& row_splits, core::Tensor& segment_ids) {
+    int64_t num_rows = row_splits.GetLength() - 1;
+    int64_t n = row_splits[num_rows].Item<int64_t>();
+    segment_ids = core::Tensor::Empty({n}, core::Dtype::Int64,
+                                      row_splits.GetDevice());
+    const int64_t* row_splits_ptr =
+            static_cast<const int64_t*>(row_splits.GetDataPtr());
+    int64_t* segment_ptr = static_cast<int64_t*>(segment_ids.GetDataPtr());
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+    core::kernel::CUDALauncher::LaunchGeneralKernel(
+            n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+#else
+    core::kernel::CPULauncher::LaunchGeneralKernel(
+            n, [&](int64_t workload_idx) {
+#endif
+                // Binary search keeping row_splits[lo] <= workload_idx <
+                // row_splits[hi], which skips the empty rows.
+                int64_t lo = 0;
+                int64_t hi = num_rows;
+                while (hi - lo > 1) {
+                    int64_t mid = (lo + hi) / 2;
+                    if (row_splits_ptr[mid] <= workload_idx) {
+                        lo = mid;
+                    } else {
+                        hi = mid;
+                    }
+                }
+                segment_ptr[workload_idx] = lo;
+            });
+}
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void SegmentModeCUDA
+#else
+void SegmentModeCPU
+#endif
+        (const core::Tensor& labels,
+         const core::Tensor& offsets,
+         const core::Tensor& order,
+         core::Tensor& dst) {
+    int64_t num_segments = offsets.GetLength() - 1;
+    dst = core::Tensor::Empty({num_segments}, labels.GetDtype(),
+                              labels.GetDevice());
+
+    const int64_t* offsets_ptr =
+            static_cast<const int64_t*>(offsets.GetDataPtr());
+    const int64_t* order_ptr = static_cast<const int64_t*>(order.GetDataPtr());
+    DISPATCH_DTYPE_TO_TEMPLATE(labels.GetDtype(), [&]() {
+        const scalar_t* labels_ptr =
+                static_cast<const scalar_t*>(labels.GetDataPtr());
+        scalar_t* dst_ptr = static_cast<scalar_t*>(dst.GetDataPtr());
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+        core::kernel::CUDALauncher::LaunchGeneralKernel(
+                num_segments, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+#else
+        core::kernel::CPULauncher::LaunchGeneralKernel(
+                num_segments, [&](int64_t workload_idx) {
+#endif
+                    // Segments are small, so the votes are counted in place
+                    // instead of in a per-segment histogram.
+                    int64_t begin = offsets_ptr[workload_idx];
+                    int64_t end = offsets_ptr[workload_idx + 1];
+                    scalar_t best_label = 0;
+                    int64_t best_count = 0;
+                    for (int64_t k = begin; k < end; ++k) {
+                        scalar_t label = labels_ptr[order_ptr[k]];
+                        int64_t count = 0;
+                        for (int64_t j = begin; j < end; ++j) {
+                            count += labels_ptr[order_ptr[j]] == label;
+                        }
+                        if (count > best_count ||
+                            (count == best_count && label < best_label)) {
+                            best_label = label;
+                            best_count = count;
+                        }
+                    }
+                    dst_ptr[workload_idx] = best_label;
+                });
+    });
+}
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void ComputeISSSaliencyCUDA
+#else
+void ComputeISSSaliencyCPU
+#endif
+        (const core::Tensor& points,
+         const core::Tensor& neighbor_indices,
+         const core::Tensor& neighbor_row_splits,
+         double salient_radius,
+         double gamma_21,
+         double gamma_32,
+         int min_neighbors,
+         core::Tensor& saliency) {
+    int64_t n = points.GetLength();
+    saliency = core::Tensor::Zeros({n}, core::Dtype::Float64,
+                                   points.GetDevice());
+    double* saliency_ptr = static_cast<double*>(saliency.GetDataPtr());
+    const int64_t* indices_ptr =
+            static_cast<const int64_t*>(neighbor_indices.GetDataPtr());
+    const int64_t* row_splits_ptr =
+            static_cast<const int64_t*>(neighbor_row_splits.GetDataPtr());
+    double salient_radius2 = salient_radius * salient_radius;
+
+    DISPATCH_FLOAT32_FLOAT64_DTYPE(points.GetDtype(), [&]() {
+        const scalar_t* points_ptr =
+                static_cast<const scalar_t*>(points.GetDataPtr());
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+        core::kernel::CUDALauncher::LaunchGeneralKernel(
+                n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+#else
+        core::kernel::CPULauncher::LaunchGeneralKernel(
+                n, [&](int64_t workload_idx) {
+#endif
+                    const scalar_t* point = points_ptr + 3 * workload_idx;
+
+                    // Cumulants of the neighbors within the salient radius,
+                    // as in utility::ComputeCovariance.
+                    double cumulants[9] = {0, 0, 0, 0, 0, 0, 0, 0, 0};
+                    int count = 0;
+                    for (int64_t k = row_splits_ptr[workload_idx];
+                         k < row_splits_ptr[workload_idx + 1]; ++k) {
+                        const scalar_t* neighbor =
+                                points_ptr + 3 * indices_ptr[k];
+                        double p[3] = {double(neighbor[0]),
+                                       double(neighbor[1]),
+                                       double(neighbor[2])};
+                        double d[3] = {p[0] - point[0], p[1] - point[1],
+                                       p[2] - point[2]};
+                        if (d[0] * d[0] + d[1] * d[1] + d[2] * d[2] >
+                            salient_radius2) {
+                            continue;
+                        }
+                        cumulants[0] += p[0];
+                        cumulants[1] += p[1];
+                        cumulants[2] += p[2];
+                        cumulants[3] += p[0] * p[0];
+                        cumulants[4] += p[0] * p[1];
+                        cumulants[5] += p[0] * p[2];
+                        cumulants[6] += p[1] * p[1];
+                        cumulants[7] += p[1] * p[2];
+                        cumulants[8] += p[2] * p[2];
+                        count++;
+                    }
+                    if (count < min_neighbors) {
+                        return;
+                    }
+                    for (int i = 0; i < 9; ++i) {
+                        cumulants[i] /= count;
+                    }
+                    double covariance[9];
+                    covariance[0] = cumulants[3] - cumulants[0] * cumulants[0];
+                    covariance[4] = cumulants[6] - cumulants[1] * cumulants[1];
+                    covariance[8] = cumulants[8] - cumulants[2] * cumulants[2];
+                    covariance[1] = cumulants[4] - cumulants[0] * cumulants[1];
+                    covariance[2] = cumulants[5] - cumulants[0] * cumulants[2];
+                    covariance[5] = cumulants[7] - cumulants[1] * cumulants[2];
+                    covariance[3] = covariance[1];
+                    covariance[6] = covariance[2];
+                    covariance[7] = covariance[5];
+                    if (covariance[0] == 0 && covariance[1] == 0 &&
+                        covariance[2] == 0 && covariance[4] == 0 &&
+                        covariance[5] == 0 && covariance[8] == 0) {
+                        return;
+                    }
+
+                    // Eigenvalues in ascending order.
+                    double eigenvalues[3];
+                    double eigenvectors[9];
+                    core::SymmetricEigen3x3(covariance, eigenvalues,
+                                            eigenvectors);
+                    double e1c = eigenvalues[2];
+                    double e2c = eigenvalues[1];
+                    double e3c = eigenvalues[0];
+                    if (e2c / e1c < gamma_21 && e3c / e2c < gamma_32) {
+                        saliency_ptr[workload_idx] = e3c;
+                    }
+                });
+    });
+}
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void FindISSKeypointsCUDA
+#else
+void FindISSKeypointsCPU
+#endif
+        (const core::Tensor& points,
+         const core::Tensor& neighbor_indices,
+         const core::Tensor& neighbor_row_splits,
+         const core::Tensor& saliency,
+         double non_max_radius,
+         int min_neighbors,
+         core::Tensor& keypoint_mask) {
+    int64_t n = points.GetLength();
+    keypoint_mask = core::Tensor::Empty({n}, core::Dtype::Bool,
+                                        points.GetDevice());
+    bool* mask_ptr = static_cast<bool*>(keypoint_mask.GetDataPtr());
+    const double* saliency_ptr =
+            static_cast<const double*>(saliency.GetDataPtr());
+    const int64_t* indices_ptr =
+            static_cast<const int64_t*>(neighbor_indices.GetDataPtr());
+    const int64_t* row_splits_ptr =
+            static_cast<const int64_t*>(neighbor_row_splits.GetDataPtr());
+    double non_max_radius2 = non_max_radius * non_max_radius;
+
+    DISPATCH_FLOAT32_FLOAT64_DTYPE(points.GetDtype(), [&]() {
+        const scalar_t* points_ptr =
+                static_cast<const scalar_t*>(points.GetDataPtr());
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+        core::kernel::CUDALauncher::LaunchGeneralKernel(
+                n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+#else
+        core::kernel::CPULauncher::LaunchGeneralKernel(
+                n, [&](int64_t workload_idx) {
+#endif
+                    mask_ptr[workload_idx] = false;
+                    double value = saliency_ptr[workload_idx];
+                    if (value <= 0) {
+                        return;
+                    }
+                    const scalar_t* point = points_ptr + 3 * workload_idx;
+                    int count = 0;
+                    for (int64_t k = row_splits_ptr[workload_idx];
+                         k < row_splits_ptr[workload_idx + 1]; ++k) {
+                        int64_t j = indices_ptr[k];
+                        const scalar_t* neighbor = points_ptr + 3 * j;
+                        double d[3] = {double(neighbor[0] - point[0]),
+                                       double(neighbor[1] - point[1]),
+                                       double(neighbor[2] - point[2])};
+                        if (d[0] * d[0] + d[1] * d[1] + d[2] * d[2] >
+                            non_max_radius2) {
+                            continue;
+                        }
+                        if (saliency_ptr[j] > value) {
+                            return;
+                        }
+                        count++;
+                    }
+                    mask_ptr[workload_idx] = count >= min_neighbors;
+                });
+    });
+}
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void GatherRowsCUDA
+#else
+void GatherRowsCPU
+#endif
+        (const std::vector<core::Tensor>& srcs,
+         const core::Tensor& indices,
+         std::vector<core::Tensor>& dsts) {
+    const core::Device& device = indices.GetDevice();
+    int64_t num_rows = indices.GetLength();
+    int64_t num_tensors = int64_t(srcs.size());
+
+    // Source address, destination address and row size of each tensor.
+    std::vector<int64_t> table(3 * num_tensors);
+    dsts.clear();
+    for (int64_t i = 0; i < num_tensors; ++i) {
+        core::SizeVector shape = srcs[i].GetShape();
+        int64_t row_bytes = srcs[i].GetDtype().ByteSize();
+        for (size_t d = 1; d < shape.size(); ++d) {
+            row_bytes *= shape[d];
+        }
+        shape[0] = num_rows;
+        dsts.push_back(core::Tensor::Empty(shape, srcs[i].GetDtype(), device));
+        table[3 * i] = reinterpret_cast<int64_t>(srcs[i].GetDataPtr());
+        table[3 * i + 1] = reinterpret_cast<int64_t>(dsts[i].GetDataPtr());
+        table[3 * i + 2] = row_bytes;
+    }
+    if (num_rows == 0 || num_tensors == 0) {
+        return;
+    }
+    core::Tensor table_tensor(table, {num_tensors, 3}, core::Dtype::Int64,
+                              device);
+    const int64_t* table_ptr =
+            static_cast<const int64_t*>(table_tensor.GetDataPtr());
+    const int64_t* indices_ptr =
+            static_cast<const int64_t*>(indices.GetDataPtr());
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+    core::kernel::CUDALauncher::LaunchGeneralKernel(
+            num_rows * num_tensors, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+#else
+    core::kernel::CPULauncher::LaunchGeneralKernel(
+            num_rows * num_tensors, [&](int64_t workload_idx) {
+#endif
+                int64_t row = workload_idx / num_tensors;
+                const int64_t* entry =
+                        table_ptr + 3 * (workload_idx % num_tensors);
+                int64_t row_bytes = entry[2];
+                const uint8_t* src =
+                        reinterpret_cast<const uint8_t*>(entry[0]) +
+                        indices_ptr[row] * row_bytes;
+                uint8_t* dst =
+                        reinterpret_cast<uint8_t*>(entry[1]) + row * row_bytes;
+                for (int64_t b = 0; b < row_bytes; ++b) {
+                    dst[b] = src[b];
+                }
+            });
+}
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void ComputeBoxMaskCUDA
+#else
+void ComputeBoxMaskCPU
+#endif
+        (const core::Tensor& points,
+         const core::Tensor& center,
+         const core::Tensor& axes,
+         const core::Tensor& min_bound,
+         const core::Tensor& max_bound,
+         core::Tensor& mask) {
+    int64_t n = points.GetLength();
+    mask = core::Tensor::Empty({n}, core::Dtype::Bool, points.GetDevice());
+    bool* mask_ptr = static_cast<bool*>(mask.GetDataPtr());
+    const double* center_ptr = static_cast<const double*>(center.GetDataPtr());
+    const double* axes_ptr = static_cast<const double*>(axes.GetDataPtr());
+    const double* min_ptr = static_cast<const double*>(min_bound.GetDataPtr());
+    const double* max_ptr = static_cast<const double*>(max_bound.GetDataPtr());
+
+    DISPATCH_FLOAT32_FLOAT64_DTYPE(points.GetDtype(), [&]() {
+        const scalar_t* points_ptr =
+                static_cast<const scalar_t*>(points.GetDataPtr());
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+        core::kernel::CUDALauncher::LaunchGeneralKernel(
+                n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+#else
+        core::kernel::CPULauncher::LaunchGeneralKernel(
+                n, [&](int64_t workload_idx) {
+#endif
+                    const scalar_t* p = points_ptr + 3 * workload_idx;
+                    double dx = double(p[0]) - center_ptr[0];
+                    double dy = double(p[1]) - center_ptr[1];
+                    double dz = double(p[2]) - center_ptr[2];
+                    bool inside = true;
+                    for (int k = 0; k < 3; ++k) {
+                        const double* axis = axes_ptr + 3 * k;
+                        double d = axis[0] * dx + axis[1] * dy + axis[2] * dz;
+                        inside = inside && d >= min_ptr[k] && d <= max_ptr[k];
+                    }
+                    mask_ptr[workload_idx] = inside;
+                });
+    });
+}
+
 }  // namespace pointcloud
 }  // namespace kernel
 }  // namespace geometry
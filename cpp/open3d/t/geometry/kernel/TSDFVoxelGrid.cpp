@@ -28,6 +28,7 @@
 
 #include <vector>
 
+#include "open3d/core/CUDAUtils.h"
 #include "open3d/core/ShapeUtil.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/utility/Console.h"
@@ -60,6 +61,72 @@ void Touch(const core::Tensor& points,
     }
 }
 
+void CullBlocks(const core::Tensor& block_indices,
+                const core::Tensor& block_keys,
+                core::Tensor& visible_mask,
+                const core::Tensor& intrinsics,
+                const core::Tensor& extrinsics,
+                int64_t rows,
+                int64_t cols,
+                int64_t resolution,
+                float voxel_size,
+                float sdf_trunc,
+                float depth_max) {
+    core::Device device = block_keys.GetDevice();
+    if (block_indices.GetDevice() != device) {
+        utility::LogError("Incompatible device type for TSDF voxel grid");
+    }
+
+    // Camera parameters are read on host.
+    core::Tensor intrinsicsf32 = intrinsics.To(core::Dtype::Float32)
+                                         .Copy(core::Device("CPU:0"));
+    core::Tensor extrinsicsf32 = extrinsics.To(core::Dtype::Float32)
+                                         .Copy(core::Device("CPU:0"));
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        CullBlocksCPU(block_indices, block_keys, visible_mask, intrinsicsf32,
+                      extrinsicsf32, rows, cols, resolution, voxel_size,
+                      sdf_trunc, depth_max);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        CullBlocksCUDA(block_indices, block_keys, visible_mask, intrinsicsf32,
+                       extrinsicsf32, rows, cols, resolution, voxel_size,
+                       sdf_trunc, depth_max);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void PartitionBlocks(const core::Tensor& block_keys,
+                     core::Tensor& partitions,
+                     int64_t tile_size,
+                     int64_t num_partitions) {
+    if (tile_size <= 0 || num_partitions <= 0) {
+        utility::LogError(
+                "Expected positive tile size and number of partitions, but "
+                "got {} and {}.",
+                tile_size, num_partitions);
+    }
+    core::Tensor keys = block_keys.To(core::Dtype::Int32).Contiguous();
+
+    core::Device::DeviceType device_type = keys.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        PartitionBlocksCPU(keys, partitions, tile_size, num_partitions);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        PartitionBlocksCUDA(keys, partitions, tile_size, num_partitions);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
 void Integrate(const core::Tensor& depth,
                const core::Tensor& color,
                const core::Tensor& block_indices,
@@ -74,7 +141,9 @@ void Integrate(const core::Tensor& depth,
                float depth_max) {
     core::Device device = depth.GetDevice();
 
-    if (color.GetDevice() != device) {
+    // Color is empty for depth-only integration.
+    bool has_color = color.NumElements() != 0;
+    if (has_color && color.GetDevice() != device) {
         utility::LogError("Incompatible color device type for depth and color");
     }
     if (block_indices.GetDevice() != device ||
@@ -85,7 +154,10 @@ void Integrate(const core::Tensor& depth,
     }
 
     core::Tensor depthf32 = depth.To(core::Dtype::Float32);
-    core::Tensor colorf32 = color.To(core::Dtype::Float32);
+    core::Tensor colorf32;
+    if (has_color) {
+        colorf32 = color.To(core::Dtype::Float32);
+    }
 
     core::Tensor intrinsicsf32 = intrinsics.To(core::Dtype::Float32);
     if (intrinsicsf32.GetDevice() != device) {
@@ -104,6 +176,7 @@ void Integrate(const core::Tensor& depth,
                      voxel_size, sdf_trunc, depth_scale, depth_max);
     } else if (device_type == core::Device::DeviceType::CUDA) {
 #ifdef BUILD_CUDA_MODULE
+        OPEN3D_TRACE_CUDA_SCOPE("t::TSDF::Integrate");
         IntegrateCUDA(depthf32, colorf32, block_indices, block_keys,
                       block_values, intrinsicsf32, extrinsicsf32, resolution,
                       voxel_size, sdf_trunc, depth_scale, depth_max);
@@ -115,9 +188,77 @@ void Integrate(const core::Tensor& depth,
     }
 }
 
+void IntegrateBatch(const core::Tensor& depths,
+                    const core::Tensor& colors,
+                    const core::Tensor& block_indices,
+                    const core::Tensor& block_keys,
+                    core::Tensor& block_values,
+                    const core::Tensor& intrinsics,
+                    const core::Tensor& extrinsics,
+                    int64_t resolution,
+                    float voxel_size,
+                    float sdf_trunc,
+                    float depth_scale,
+                    float depth_max) {
+    core::Device device = depths.GetDevice();
+    int64_t num_frames = depths.GetLength();
+    depths.AssertShapeCompatible({num_frames, utility::nullopt,
+                                  utility::nullopt, 1});
+    intrinsics.AssertShape({num_frames, 3, 3});
+    extrinsics.AssertShape({num_frames, 4, 4});
+
+    // Colors are empty for depth-only integration.
+    bool has_color = colors.NumElements() != 0;
+    if (has_color) {
+        colors.AssertShape({num_frames, depths.GetShape(1), depths.GetShape(2),
+                            3});
+        if (colors.GetDevice() != device) {
+            utility::LogError(
+                    "Incompatible color device type for depth and color");
+        }
+    }
+    if (block_indices.GetDevice() != device ||
+        block_keys.GetDevice() != device ||
+        block_values.GetDevice() != device) {
+        utility::LogError(
+                "Incompatible device type for depth and TSDF voxel grid");
+    }
+
+    core::Tensor depthsf32 = depths.To(core::Dtype::Float32).Contiguous();
+    core::Tensor colorsf32;
+    if (has_color) {
+        colorsf32 = colors.To(core::Dtype::Float32).Contiguous();
+    }
+
+    // The per-frame transforms are read on the host and uploaded at once.
+    core::Device host("CPU:0");
+    core::Tensor intrinsicsf32 =
+            intrinsics.To(core::Dtype::Float32).Copy(host);
+    core::Tensor extrinsicsf32 =
+            extrinsics.To(core::Dtype::Float32).Copy(host);
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        IntegrateBatchCPU(depthsf32, colorsf32, block_indices, block_keys,
+                          block_values, intrinsicsf32, extrinsicsf32,
+                          resolution, voxel_size, sdf_trunc, depth_scale,
+                          depth_max);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        OPEN3D_TRACE_CUDA_SCOPE("t::TSDF::IntegrateBatch");
+        IntegrateBatchCUDA(depthsf32, colorsf32, block_indices, block_keys,
+                           block_values, intrinsicsf32, extrinsicsf32,
+                           resolution, voxel_size, sdf_trunc, depth_scale,
+                           depth_max);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
 void ExtractSurfacePoints(const core::Tensor& block_indices,
-                          const core::Tensor& nb_block_indices,
-                          const core::Tensor& nb_block_masks,
                           const core::Tensor& block_keys,
                           const core::Tensor& block_values,
                           core::Tensor& points,
@@ -129,13 +270,12 @@ void ExtractSurfacePoints(const core::Tensor& block_indices,
 
     core::Device::DeviceType device_type = device.GetType();
     if (device_type == core::Device::DeviceType::CPU) {
-        ExtractSurfacePointsCPU(block_indices, nb_block_indices, nb_block_masks,
-                                block_keys, block_values, points, normals,
-                                colors, block_resolution, voxel_size);
+        ExtractSurfacePointsCPU(block_indices, block_keys, block_values, points,
+                                normals, colors, block_resolution, voxel_size);
     } else if (device_type == core::Device::DeviceType::CUDA) {
 #ifdef BUILD_CUDA_MODULE
-        ExtractSurfacePointsCUDA(block_indices, nb_block_indices,
-                                 nb_block_masks, block_keys, block_values,
+        OPEN3D_TRACE_CUDA_SCOPE("t::TSDF::ExtractSurfacePoints");
+        ExtractSurfacePointsCUDA(block_indices, block_keys, block_values,
                                  points, normals, colors, block_resolution,
                                  voxel_size);
 #else
@@ -147,9 +287,6 @@ void ExtractSurfacePoints(const core::Tensor& block_indices,
 }
 
 void ExtractSurfaceMesh(const core::Tensor& block_indices,
-                        const core::Tensor& inv_block_indices,
-                        const core::Tensor& nb_block_indices,
-                        const core::Tensor& nb_block_masks,
                         const core::Tensor& block_keys,
                         const core::Tensor& block_values,
                         core::Tensor& vertices,
@@ -162,16 +299,108 @@ void ExtractSurfaceMesh(const core::Tensor& block_indices,
 
     core::Device::DeviceType device_type = device.GetType();
     if (device_type == core::Device::DeviceType::CPU) {
-        ExtractSurfaceMeshCPU(block_indices, inv_block_indices,
-                              nb_block_indices, nb_block_masks, block_keys,
-                              block_values, vertices, triangles, vertex_normals,
-                              vertex_colors, block_resolution, voxel_size);
+        ExtractSurfaceMeshCPU(block_indices, block_keys, block_values, vertices,
+                              triangles, vertex_normals, vertex_colors,
+                              block_resolution, voxel_size);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        OPEN3D_TRACE_CUDA_SCOPE("t::TSDF::ExtractSurfaceMesh");
+        ExtractSurfaceMeshCUDA(block_indices, block_keys, block_values,
+                               vertices, triangles, vertex_normals,
+                               vertex_colors, block_resolution, voxel_size);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void ExtractSurfaceMeshBlocks(const core::Tensor& mesh_indices,
+                              const core::Tensor& indices,
+                              const core::Tensor& block_keys,
+                              const core::Tensor& block_values,
+                              core::Tensor& vertices,
+                              core::Tensor& triangles,
+                              core::Tensor& vertex_normals,
+                              core::Tensor& vertex_colors,
+                              core::Tensor& vertex_block_indices,
+                              core::Tensor& triangle_block_indices,
+                              int64_t block_resolution,
+                              float voxel_size) {
+    core::Device device = block_keys.GetDevice();
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ExtractSurfaceMeshBlocksCPU(
+                mesh_indices, indices, block_keys, block_values, vertices,
+                triangles, vertex_normals, vertex_colors, vertex_block_indices,
+                triangle_block_indices, block_resolution, voxel_size);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        ExtractSurfaceMeshBlocksCUDA(
+                mesh_indices, indices, block_keys, block_values, vertices,
+                triangles, vertex_normals, vertex_colors, vertex_block_indices,
+                triangle_block_indices, block_resolution, voxel_size);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void RayCast(const core::Tensor& indices,
+             const core::Tensor& block_keys,
+             const core::Tensor& block_values,
+             core::Tensor& vertex_map,
+             core::Tensor& depth_map,
+             core::Tensor& normal_map,
+             core::Tensor& color_map,
+             const core::Tensor& intrinsics,
+             const core::Tensor& extrinsics,
+             int64_t h,
+             int64_t w,
+             int64_t block_resolution,
+             float voxel_size,
+             float sdf_trunc,
+             float depth_min,
+             float depth_max) {
+    core::Device device = block_keys.GetDevice();
+    if (indices.GetDevice() != device || block_values.GetDevice() != device) {
+        utility::LogError("Incompatible device type for TSDF voxel grid");
+    }
+    if (h <= 0 || w <= 0) {
+        utility::LogError("Invalid image size {}x{} for ray casting.", w, h);
+    }
+    if (!(depth_min > 0 && depth_min < depth_max)) {
+        utility::LogError("Invalid depth range [{}, {}] for ray casting.",
+                          depth_min, depth_max);
+    }
+    intrinsics.AssertShape({3, 3});
+    extrinsics.AssertShape({4, 4});
+
+    // Camera parameters are read on host.
+    core::Tensor intrinsicsf32 = intrinsics.To(core::Dtype::Float32)
+                                         .Copy(core::Device("CPU:0"));
+    core::Tensor posef32 = extrinsics.To(core::Dtype::Float64)
+                                   .Copy(core::Device("CPU:0"))
+                                   .Inverse()
+                                   .To(core::Dtype::Float32);
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        RayCastCPU(indices, block_keys, block_values, vertex_map, depth_map,
+                   normal_map, color_map, intrinsicsf32, posef32, h, w,
+                   block_resolution, voxel_size, sdf_trunc, depth_min,
+                   depth_max);
     } else if (device_type == core::Device::DeviceType::CUDA) {
 #ifdef BUILD_CUDA_MODULE
-        ExtractSurfaceMeshCUDA(
-                block_indices, inv_block_indices, nb_block_indices,
-                nb_block_masks, block_keys, block_values, vertices, triangles,
-                vertex_normals, vertex_colors, block_resolution, voxel_size);
+        OPEN3D_TRACE_CUDA_SCOPE("t::TSDF::RayCast");
+        RayCastCUDA(indices, block_keys, block_values, vertex_map, depth_map,
+                    normal_map, color_map, intrinsicsf32, posef32, h, w,
+                    block_resolution, voxel_size, sdf_trunc, depth_min,
+                    depth_max);
 #else
         utility::LogError("Not compiled with CUDA, but CUDA device is used.");
 #endif
@@ -41,6 +41,26 @@ void Touch(const core::Tensor& points,
            float voxel_size,
            float sdf_trunc);
 
+void CullBlocks(const core::Tensor& block_indices,
+                const core::Tensor& block_keys,
+                core::Tensor& visible_mask,
+                const core::Tensor& intrinsics,
+                const core::Tensor& extrinsics,
+                int64_t rows,
+                int64_t cols,
+                int64_t resolution,
+                float voxel_size,
+                float sdf_trunc,
+                float depth_max);
+
+/// Partition of each of the blocks with coordinates \p block_keys {N, 3}, in
+/// [0, num_partitions). The space is divided into tiles of \p tile_size^3
+/// blocks, and the tiles are hashed to the partitions.
+void PartitionBlocks(const core::Tensor& block_keys,
+                     core::Tensor& partitions,
+                     int64_t tile_size,
+                     int64_t num_partitions);
+
 void Integrate(const core::Tensor& depth,
                const core::Tensor& color,
                const core::Tensor& block_indices,
@@ -54,9 +74,24 @@ void Integrate(const core::Tensor& depth,
                float depth_scale,
                float depth_max);
 
+/// Integrates K frames into the blocks at \p block_indices, each voxel
+/// visiting the frames in order. \p depths is {K, H, W, 1}, \p colors is
+/// {K, H, W, 3} or empty, \p intrinsics is {K, 3, 3} and \p extrinsics is
+/// {K, 4, 4}.
+void IntegrateBatch(const core::Tensor& depths,
+                    const core::Tensor& colors,
+                    const core::Tensor& block_indices,
+                    const core::Tensor& block_keys,
+                    core::Tensor& block_values,
+                    const core::Tensor& intrinsics,
+                    const core::Tensor& extrinsics,
+                    int64_t resolution,
+                    float voxel_size,
+                    float sdf_trunc,
+                    float depth_scale,
+                    float depth_max);
+
 void ExtractSurfacePoints(const core::Tensor& block_indices,
-                          const core::Tensor& nb_block_indices,
-                          const core::Tensor& nb_block_masks,
                           const core::Tensor& block_keys,
                           const core::Tensor& block_values,
                           core::Tensor& points,
@@ -66,9 +101,6 @@ void ExtractSurfacePoints(const core::Tensor& block_indices,
                           float voxel_size);
 
 void ExtractSurfaceMesh(const core::Tensor& block_indices,
-                        const core::Tensor& inv_block_indices,
-                        const core::Tensor& nb_block_indices,
-                        const core::Tensor& nb_block_masks,
                         const core::Tensor& block_keys,
                         const core::Tensor& block_values,
                         core::Tensor& vertices,
@@ -78,12 +110,59 @@ void ExtractSurfaceMesh(const core::Tensor& block_indices,
                         int64_t block_resolution,
                         float voxel_size);
 
+void ExtractSurfaceMeshBlocks(const core::Tensor& mesh_indices,
+                              const core::Tensor& indices,
+                              const core::Tensor& block_keys,
+                              const core::Tensor& block_values,
+                              core::Tensor& vertices,
+                              core::Tensor& triangles,
+                              core::Tensor& vertex_normals,
+                              core::Tensor& vertex_colors,
+                              core::Tensor& vertex_block_indices,
+                              core::Tensor& triangle_block_indices,
+                              int64_t block_resolution,
+                              float voxel_size);
+
+void RayCast(const core::Tensor& indices,
+             const core::Tensor& block_keys,
+             const core::Tensor& block_values,
+             core::Tensor& vertex_map,
+             core::Tensor& depth_map,
+             core::Tensor& normal_map,
+             core::Tensor& color_map,
+             const core::Tensor& intrinsics,
+             const core::Tensor& extrinsics,
+             int64_t h,
+             int64_t w,
+             int64_t block_resolution,
+             float voxel_size,
+             float sdf_trunc,
+             float depth_min,
+             float depth_max);
+
 void TouchCPU(const core::Tensor& points,
               core::Tensor& voxel_block_coords,
               int64_t voxel_grid_resolution,
               float voxel_size,
               float sdf_trunc);
 
+void CullBlocksCPU(const core::Tensor& block_indices,
+                   const core::Tensor& block_keys,
+                   core::Tensor& visible_mask,
+                   const core::Tensor& intrinsics,
+                   const core::Tensor& extrinsics,
+                   int64_t rows,
+                   int64_t cols,
+                   int64_t resolution,
+                   float voxel_size,
+                   float sdf_trunc,
+                   float depth_max);
+
+void PartitionBlocksCPU(const core::Tensor& block_keys,
+                        core::Tensor& partitions,
+                        int64_t tile_size,
+                        int64_t num_partitions);
+
 void IntegrateCPU(const core::Tensor& depth,
                   const core::Tensor& color,
                   const core::Tensor& block_indices,
@@ -97,9 +176,20 @@ void IntegrateCPU(const core::Tensor& depth,
                   float depth_scale,
                   float depth_max);
 
+void IntegrateBatchCPU(const core::Tensor& depths,
+                       const core::Tensor& colors,
+                       const core::Tensor& block_indices,
+                       const core::Tensor& block_keys,
+                       core::Tensor& block_values,
+                       const core::Tensor& intrinsics,
+                       const core::Tensor& extrinsics,
+                       int64_t resolution,
+                       float voxel_size,
+                       float sdf_trunc,
+                       float depth_scale,
+                       float depth_max);
+
 void ExtractSurfacePointsCPU(const core::Tensor& block_indices,
-                             const core::Tensor& nb_block_indices,
-                             const core::Tensor& nb_block_masks,
                              const core::Tensor& block_keys,
                              const core::Tensor& block_values,
                              core::Tensor& points,
@@ -109,9 +199,6 @@ void ExtractSurfacePointsCPU(const core::Tensor& block_indices,
                              float voxel_size);
 
 void ExtractSurfaceMeshCPU(const core::Tensor& block_indices,
-                           const core::Tensor& inv_block_indices,
-                           const core::Tensor& nb_block_indices,
-                           const core::Tensor& nb_block_masks,
                            const core::Tensor& block_keys,
                            const core::Tensor& block_values,
                            core::Tensor& vertices,
@@ -121,6 +208,36 @@ void ExtractSurfaceMeshCPU(const core::Tensor& block_indices,
                            int64_t block_resolution,
                            float voxel_size);
 
+void ExtractSurfaceMeshBlocksCPU(const core::Tensor& mesh_indices,
+                                 const core::Tensor& indices,
+                                 const core::Tensor& block_keys,
+                                 const core::Tensor& block_values,
+                                 core::Tensor& vertices,
+                                 core::Tensor& triangles,
+                                 core::Tensor& vertex_normals,
+                                 core::Tensor& vertex_colors,
+                                 core::Tensor& vertex_block_indices,
+                                 core::Tensor& triangle_block_indices,
+                                 int64_t block_resolution,
+                                 float voxel_size);
+
+void RayCastCPU(const core::Tensor& indices,
+                const core::Tensor& block_keys,
+                const core::Tensor& block_values,
+                core::Tensor& vertex_map,
+                core::Tensor& depth_map,
+                core::Tensor& normal_map,
+                core::Tensor& color_map,
+                const core::Tensor& intrinsics,
+                const core::Tensor& pose,
+                int64_t h,
+                int64_t w,
+                int64_t block_resolution,
+                float voxel_size,
+                float sdf_trunc,
+                float depth_min,
+                float depth_max);
+
 #ifdef BUILD_CUDA_MODULE
 void TouchCUDA(const core::Tensor& points,
                core::Tensor& voxel_block_coords,
@@ -128,6 +245,23 @@ void TouchCUDA(const core::Tensor& points,
                float voxel_size,
                float sdf_trunc);
 
+void CullBlocksCUDA(const core::Tensor& block_indices,
+                    const core::Tensor& block_keys,
+                    core::Tensor& visible_mask,
+                    const core::Tensor& intrinsics,
+                    const core::Tensor& extrinsics,
+                    int64_t rows,
+                    int64_t cols,
+                    int64_t resolution,
+                    float voxel_size,
+                    float sdf_trunc,
+                    float depth_max);
+
+void PartitionBlocksCUDA(const core::Tensor& block_keys,
+                         core::Tensor& partitions,
+                         int64_t tile_size,
+                         int64_t num_partitions);
+
 void IntegrateCUDA(const core::Tensor& depth,
                    const core::Tensor& color,
                    const core::Tensor& block_indices,
@@ -141,9 +275,20 @@ void IntegrateCUDA(const core::Tensor& depth,
                    float depth_scale,
                    float depth_max);
 
+void IntegrateBatchCUDA(const core::Tensor& depths,
+                        const core::Tensor& colors,
+                        const core::Tensor& block_indices,
+                        const core::Tensor& block_keys,
+                        core::Tensor& block_values,
+                        const core::Tensor& intrinsics,
+                        const core::Tensor& extrinsics,
+                        int64_t resolution,
+                        float voxel_size,
+                        float sdf_trunc,
+                        float depth_scale,
+                        float depth_max);
+
 void ExtractSurfacePointsCUDA(const core::Tensor& block_indices,
-                              const core::Tensor& nb_block_indices,
-                              const core::Tensor& nb_block_masks,
                               const core::Tensor& block_keys,
                               const core::Tensor& block_values,
                               core::Tensor& points,
@@ -153,9 +298,6 @@ void ExtractSurfacePointsCUDA(const core::Tensor& block_indices,
                               float voxel_size);
 
 void ExtractSurfaceMeshCUDA(const core::Tensor& block_indices,
-                            const core::Tensor& inv_block_indices,
-                            const core::Tensor& nb_block_indices,
-                            const core::Tensor& nb_block_masks,
                             const core::Tensor& block_keys,
                             const core::Tensor& block_values,
                             core::Tensor& vertices,
@@ -165,6 +307,36 @@ void ExtractSurfaceMeshCUDA(const core::Tensor& block_indices,
                             int64_t block_resolution,
                             float voxel_size);
 
+void ExtractSurfaceMeshBlocksCUDA(const core::Tensor& mesh_indices,
+                                  const core::Tensor& indices,
+                                  const core::Tensor& block_keys,
+                                  const core::Tensor& block_values,
+                                  core::Tensor& vertices,
+                                  core::Tensor& triangles,
+                                  core::Tensor& vertex_normals,
+                                  core::Tensor& vertex_colors,
+                                  core::Tensor& vertex_block_indices,
+                                  core::Tensor& triangle_block_indices,
+                                  int64_t block_resolution,
+                                  float voxel_size);
+
+void RayCastCUDA(const core::Tensor& indices,
+                 const core::Tensor& block_keys,
+                 const core::Tensor& block_values,
+                 core::Tensor& vertex_map,
+                 core::Tensor& depth_map,
+                 core::Tensor& normal_map,
+                 core::Tensor& color_map,
+                 const core::Tensor& intrinsics,
+                 const core::Tensor& pose,
+                 int64_t h,
+                 int64_t w,
+                 int64_t block_resolution,
+                 float voxel_size,
+                 float sdf_trunc,
+                 float depth_min,
+                 float depth_max);
+
 #endif
 }  // namespace tsdf
 }  // namespace kernel
@@ -25,6 +25,8 @@
 // ----------------------------------------------------------------------------
 
 #include <atomic>
+#include <cstring>
+#include <vector>
 
 #include "open3d/core/Dispatch.h"
 #include "open3d/core/Dtype.h"
@@ -47,6 +49,12 @@
         } else if (BYTESIZE == sizeof(Voxel32f)) {           \
             using voxel_t = Voxel32f;                        \
             return __VA_ARGS__();                            \
+        } else if (BYTESIZE == sizeof(ColoredVoxel8i)) {     \
+            using voxel_t = ColoredVoxel8i;                  \
+            return __VA_ARGS__();                            \
+        } else if (BYTESIZE == sizeof(Voxel16i)) {           \
+            using voxel_t = Voxel16i;                        \
+            return __VA_ARGS__();                            \
         } else {                                             \
             utility::LogError("Unsupported voxel bytesize"); \
         }                                                    \
@@ -174,6 +182,226 @@ struct ColoredVoxel32f {
     }
 };
 
+/// Quantization of the normalized TSDF in [-1, 1] to int16_t. The step is
+/// sdf_trunc / 32767, far below the voxel size in practice.
+static constexpr float kTSDFQuantizationFactor = 32767.0f;
+
+inline OPEN3D_HOST_DEVICE float DequantizeTSDF(int16_t tsdf) {
+    return static_cast<float>(tsdf) / kTSDFQuantizationFactor;
+}
+
+inline OPEN3D_HOST_DEVICE int16_t QuantizeTSDF(float tsdf) {
+    tsdf = tsdf > 1.0f ? 1.0f : (tsdf < -1.0f ? -1.0f : tsdf);
+    return static_cast<int16_t>(round(tsdf * kTSDFQuantizationFactor));
+}
+
+/// 4-byte voxel structure.
+/// int16_t quantized TSDF and uint16_t weight, for geometry-only scans where
+/// memory matters more than the last bits of accuracy.
+struct Voxel16i {
+    static const uint16_t kMaxUint16 = 65535;
+
+    int16_t tsdf;
+    uint16_t weight;
+
+    static bool HasColor() { return false; }
+    OPEN3D_HOST_DEVICE float GetTSDF() { return DequantizeTSDF(tsdf); }
+    OPEN3D_HOST_DEVICE float GetWeight() { return static_cast<float>(weight); }
+    OPEN3D_HOST_DEVICE float GetR() { return 1.0; }
+    OPEN3D_HOST_DEVICE float GetG() { return 1.0; }
+    OPEN3D_HOST_DEVICE float GetB() { return 1.0; }
+
+    OPEN3D_HOST_DEVICE void Integrate(float dsdf) {
+        float w = static_cast<float>(weight);
+        tsdf = QuantizeTSDF((w * DequantizeTSDF(tsdf) + dsdf) / (w + 1));
+        weight = static_cast<uint16_t>(weight < kMaxUint16 ? weight + 1
+                                                          : kMaxUint16);
+    }
+    OPEN3D_HOST_DEVICE void Integrate(float dsdf,
+                                      float dr,
+                                      float dg,
+                                      float db) {
+        printf("[Voxel16i] should never reach here.\n");
+    }
+};
+
+/// 7-byte voxel structure.
+/// int16_t quantized TSDF, uint16_t weight and uint8_t colors, less than 60%
+/// of ColoredVoxel16i. The fields are stored as bytes so that the voxels can
+/// be packed without padding and read without unaligned accesses.
+struct ColoredVoxel8i {
+    static const uint16_t kMaxUint16 = 65535;
+
+    uint8_t tsdf[2];
+    uint8_t weight[2];
+
+    uint8_t r;
+    uint8_t g;
+    uint8_t b;
+
+    static OPEN3D_HOST_DEVICE uint16_t Load(const uint8_t* bytes) {
+        return static_cast<uint16_t>(bytes[0] | (bytes[1] << 8));
+    }
+    static OPEN3D_HOST_DEVICE void Store(uint8_t* bytes, uint16_t value) {
+        bytes[0] = static_cast<uint8_t>(value & 0xff);
+        bytes[1] = static_cast<uint8_t>(value >> 8);
+    }
+
+    static bool HasColor() { return true; }
+    OPEN3D_HOST_DEVICE float GetTSDF() {
+        return DequantizeTSDF(static_cast<int16_t>(Load(tsdf)));
+    }
+    OPEN3D_HOST_DEVICE float GetWeight() {
+        return static_cast<float>(Load(weight));
+    }
+    OPEN3D_HOST_DEVICE float GetR() { return static_cast<float>(r); }
+    OPEN3D_HOST_DEVICE float GetG() { return static_cast<float>(g); }
+    OPEN3D_HOST_DEVICE float GetB() { return static_cast<float>(b); }
+
+    OPEN3D_HOST_DEVICE void Integrate(float dsdf) {
+        uint16_t w = Load(weight);
+        float inv_wsum = 1.0f / (static_cast<float>(w) + 1);
+        Store(tsdf, static_cast<uint16_t>(QuantizeTSDF(
+                            (w * GetTSDF() + dsdf) * inv_wsum)));
+        Store(weight,
+              static_cast<uint16_t>(w < kMaxUint16 ? w + 1 : kMaxUint16));
+    }
+    OPEN3D_HOST_DEVICE void Integrate(float dsdf,
+                                      float dr,
+                                      float dg,
+                                      float db) {
+        uint16_t w = Load(weight);
+        float inv_wsum = 1.0f / (static_cast<float>(w) + 1);
+        Store(tsdf, static_cast<uint16_t>(QuantizeTSDF(
+                            (w * GetTSDF() + dsdf) * inv_wsum)));
+        r = static_cast<uint8_t>(round((w * r + dr) * inv_wsum));
+        g = static_cast<uint8_t>(round((w * g + dg) * inv_wsum));
+        b = static_cast<uint8_t>(round((w * b + db) * inv_wsum));
+        Store(weight,
+              static_cast<uint16_t>(w < kMaxUint16 ? w + 1 : kMaxUint16));
+    }
+};
+
+// Voxels are dispatched by their sizes, which must stay distinct.
+static_assert(sizeof(Voxel16i) == 4, "Voxel16i must be 4 bytes.");
+static_assert(sizeof(ColoredVoxel8i) == 7, "ColoredVoxel8i must be 7 bytes.");
+
+/// Open addressing table of the active blocks, to look up blocks by
+/// coordinates inside kernels. The slots store the positions of the blocks in
+/// the active indices, or -1 if empty. The table is a few integers per block,
+/// instead of a dense buffer of neighbors.
+class BlockTableIndexer {
+public:
+    BlockTableIndexer(const core::Tensor& table,
+                      const core::Tensor& indices,
+                      const core::Tensor& block_keys)
+        : table_ptr_(static_cast<const int*>(table.GetDataPtr())),
+          table_size_(table.GetLength()),
+          indices_ptr_(static_cast<const int64_t*>(indices.GetDataPtr())),
+          block_keys_indexer_(block_keys, 1) {}
+
+    /// Slot of a block coordinate. The table size is a power of 2.
+    static OPEN3D_HOST_DEVICE int64_t Hash(int xb,
+                                           int yb,
+                                           int zb,
+                                           int64_t table_size) {
+        uint64_t hash = (static_cast<uint64_t>(xb) * 73856093) ^
+                        (static_cast<uint64_t>(yb) * 19349669) ^
+                        (static_cast<uint64_t>(zb) * 83492791);
+        return static_cast<int64_t>(hash &
+                                    static_cast<uint64_t>(table_size - 1));
+    }
+
+    /// Buffer index of the i-th active block.
+    OPEN3D_HOST_DEVICE int64_t GetBlockIndex(int64_t i) const {
+        return indices_ptr_[i];
+    }
+
+    /// Coordinates of the i-th active block.
+    OPEN3D_HOST_DEVICE int* GetBlockKey(int64_t i) const {
+        return block_keys_indexer_.GetDataPtrFromCoord<int>(indices_ptr_[i]);
+    }
+
+    /// Position of a block in the active indices, or -1 if it is not active.
+    OPEN3D_HOST_DEVICE int64_t Find(int xb, int yb, int zb) const {
+        int64_t slot = Hash(xb, yb, zb, table_size_);
+        for (int64_t probe = 0; probe < table_size_; ++probe) {
+            int entry = table_ptr_[slot];
+            if (entry < 0) return -1;
+
+            int* key = GetBlockKey(entry);
+            if (key[0] == xb && key[1] == yb && key[2] == zb) return entry;
+            slot = (slot + 1) & (table_size_ - 1);
+        }
+        return -1;
+    }
+
+    /// Position of the neighbor of the i-th active block at the block offset
+    /// (dxb, dyb, dzb), or -1 if it is not active.
+    OPEN3D_HOST_DEVICE int64_t FindNeighbor(int64_t i,
+                                            int dxb,
+                                            int dyb,
+                                            int dzb) const {
+        if (dxb == 0 && dyb == 0 && dzb == 0) return i;
+        int* key = GetBlockKey(i);
+        return Find(key[0] + dxb, key[1] + dyb, key[2] + dzb);
+    }
+
+private:
+    const int* table_ptr_;
+    int64_t table_size_;
+    const int64_t* indices_ptr_;
+    NDArrayIndexer block_keys_indexer_;
+};
+
+namespace {
+// Builds the table of BlockTableIndexer for the active block indices. Its size
+// is a power of 2, at least twice the number of blocks.
+core::Tensor BuildBlockTable(const core::Tensor& indices,
+                             const core::Tensor& block_keys) {
+    int64_t n_blocks = indices.GetLength();
+    int64_t table_size = 1;
+    while (table_size < 2 * n_blocks) {
+        table_size *= 2;
+    }
+    core::Tensor table = core::Tensor::Full({table_size}, -1,
+                                            core::Dtype::Int32,
+                                            block_keys.GetDevice());
+    int* table_ptr = static_cast<int*>(table.GetDataPtr());
+
+    NDArrayIndexer block_keys_indexer(block_keys, 1);
+    const int64_t* indices_ptr =
+            static_cast<const int64_t*>(indices.GetDataPtr());
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+    // Keys are unique, so each thread claims the first free slot.
+    core::kernel::CUDALauncher::LaunchGeneralKernel(
+            n_blocks, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                int* key = block_keys_indexer.GetDataPtrFromCoord<int>(
+                        indices_ptr[workload_idx]);
+                int64_t slot = BlockTableIndexer::Hash(key[0], key[1], key[2],
+                                                       table_size);
+                while (atomicCAS(&table_ptr[slot], -1,
+                                 static_cast<int>(workload_idx)) != -1) {
+                    slot = (slot + 1) & (table_size - 1);
+                }
+            });
+#else
+    // Sequential insertion, the table is small compared with the voxels.
+    for (int64_t i = 0; i < n_blocks; ++i) {
+        int* key = block_keys_indexer.GetDataPtrFromCoord<int>(indices_ptr[i]);
+        int64_t slot =
+                BlockTableIndexer::Hash(key[0], key[1], key[2], table_size);
+        while (table_ptr[slot] != -1) {
+            slot = (slot + 1) & (table_size - 1);
+        }
+        table_ptr[slot] = static_cast<int>(i);
+    }
+#endif
+    return table;
+}
+}  // namespace
+
 // Get a voxel in a certain voxel block given the block id with its neighbors.
 template <typename voxel_t>
 inline OPEN3D_DEVICE voxel_t* DeviceGetVoxelAt(
@@ -182,27 +410,21 @@ inline OPEN3D_DEVICE voxel_t* DeviceGetVoxelAt(
         int zo,
         int curr_block_idx,
         int resolution,
-        const NDArrayIndexer& nb_block_masks_indexer,
-        const NDArrayIndexer& nb_block_indices_indexer,
+        const BlockTableIndexer& block_table_indexer,
         const NDArrayIndexer& blocks_indexer) {
     int xn = (xo + resolution) % resolution;
     int yn = (yo + resolution) % resolution;
     int zn = (zo + resolution) % resolution;
 
-    int64_t dxb = sign(xo - xn);
-    int64_t dyb = sign(yo - yn);
-    int64_t dzb = sign(zo - zn);
-
-    int64_t nb_idx = (dxb + 1) + (dyb + 1) * 3 + (dzb + 1) * 9;
-
-    bool block_mask_i = *nb_block_masks_indexer.GetDataPtrFromCoord<bool>(
-            curr_block_idx, nb_idx);
-    if (!block_mask_i) return nullptr;
+    int dxb = sign(xo - xn);
+    int dyb = sign(yo - yn);
+    int dzb = sign(zo - zn);
 
-    int64_t block_idx_i =
-            *nb_block_indices_indexer.GetDataPtrFromCoord<int64_t>(
-                    curr_block_idx, nb_idx);
+    int64_t nb_i =
+            block_table_indexer.FindNeighbor(curr_block_idx, dxb, dyb, dzb);
+    if (nb_i < 0) return nullptr;
 
+    int64_t block_idx_i = block_table_indexer.GetBlockIndex(nb_i);
     return blocks_indexer.GetDataPtrFromCoord<voxel_t>(xn, yn, zn, block_idx_i);
 }
 
@@ -217,13 +439,12 @@ inline OPEN3D_DEVICE void DeviceGetNormalAt(
         float* n,
         int resolution,
         float voxel_size,
-        const NDArrayIndexer& nb_block_masks_indexer,
-        const NDArrayIndexer& nb_block_indices_indexer,
+        const BlockTableIndexer& block_table_indexer,
         const NDArrayIndexer& blocks_indexer) {
     auto GetVoxelAt = [&] OPEN3D_DEVICE(int xo, int yo, int zo) {
-        return DeviceGetVoxelAt<voxel_t>(
-                xo, yo, zo, curr_block_idx, resolution, nb_block_masks_indexer,
-                nb_block_indices_indexer, blocks_indexer);
+        return DeviceGetVoxelAt<voxel_t>(xo, yo, zo, curr_block_idx,
+                                         resolution, block_table_indexer,
+                                         blocks_indexer);
     };
     voxel_t* vxp = GetVoxelAt(xo + 1, yo, zo);
     voxel_t* vxn = GetVoxelAt(xo - 1, yo, zo);
@@ -236,6 +457,127 @@ inline OPEN3D_DEVICE void DeviceGetNormalAt(
     if (vzp && vzn) n[2] = (vzp->GetTSDF() - vzn->GetTSDF()) / (2 * voxel_size);
 };
 
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void CullBlocksCUDA
+#else
+void CullBlocksCPU
+#endif
+        (const core::Tensor& block_indices,
+         const core::Tensor& block_keys,
+         core::Tensor& visible_mask,
+         const core::Tensor& intrinsics,
+         const core::Tensor& extrinsics,
+         int64_t rows,
+         int64_t cols,
+         int64_t resolution,
+         float voxel_size,
+         float sdf_trunc,
+         float depth_max) {
+    core::Device device = block_keys.GetDevice();
+    int64_t n = block_indices.GetLength();
+    visible_mask = core::Tensor({n}, core::Dtype::Bool, device);
+
+    TransformIndexer transform_indexer(intrinsics, extrinsics, voxel_size);
+    NDArrayIndexer block_keys_indexer(block_keys, 1);
+    const int64_t* indices_ptr =
+            static_cast<const int64_t*>(block_indices.GetDataPtr());
+    bool* mask_ptr = static_cast<bool*>(visible_mask.GetDataPtr());
+
+    // A voxel is updated only if it projects into the image, and lies in
+    // front of the camera within depth_max + sdf_trunc.
+    float z_far = depth_max + sdf_trunc;
+    float u_max_bound = static_cast<float>(cols - 1);
+    float v_max_bound = static_cast<float>(rows - 1);
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+    core::kernel::CUDALauncher::LaunchGeneralKernel(
+            n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+#else
+    core::kernel::CPULauncher::LaunchGeneralKernel(
+            n, [&](int64_t workload_idx) {
+#endif
+                int* key = block_keys_indexer.GetDataPtrFromCoord<int>(
+                        indices_ptr[workload_idx]);
+
+                // Bounds of the projections of the 8 corner voxels. The
+                // projection of a block is in the bounding box of its
+                // corners if they are all in front of the camera.
+                float z_min = z_far + 1, z_max = 0;
+                float u_min = u_max_bound + 1, u_max = -1;
+                float v_min = v_max_bound + 1, v_max = -1;
+                bool all_in_front = true;
+                for (int k = 0; k < 8; ++k) {
+                    float x = static_cast<float>(
+                            (key[0] + (k & 1)) * resolution - (k & 1));
+                    float y = static_cast<float>(
+                            (key[1] + ((k >> 1) & 1)) * resolution -
+                            ((k >> 1) & 1));
+                    float z = static_cast<float>(
+                            (key[2] + ((k >> 2) & 1)) * resolution -
+                            ((k >> 2) & 1));
+
+                    float xc, yc, zc, u, v;
+                    transform_indexer.RigidTransform(x, y, z, &xc, &yc, &zc);
+                    z_min = zc < z_min ? zc : z_min;
+                    z_max = zc > z_max ? zc : z_max;
+                    if (zc <= 0) {
+                        all_in_front = false;
+                        continue;
+                    }
+                    transform_indexer.Project(xc, yc, zc, &u, &v);
+                    u_min = u < u_min ? u : u_min;
+                    u_max = u > u_max ? u : u_max;
+                    v_min = v < v_min ? v : v_min;
+                    v_max = v > v_max ? v : v_max;
+                }
+
+                bool visible = z_max > 0 && z_min <= z_far;
+                if (visible && all_in_front) {
+                    visible = u_max >= 0 && u_min <= u_max_bound &&
+                              v_max >= 0 && v_min <= v_max_bound;
+                }
+                mask_ptr[workload_idx] = visible;
+            });
+}
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void PartitionBlocksCUDA
+#else
+void PartitionBlocksCPU
+#endif
+        (const core::Tensor& block_keys,
+         core::Tensor& partitions,
+         int64_t tile_size,
+         int64_t num_partitions) {
+    core::Device device = block_keys.GetDevice();
+    int64_t n = block_keys.GetLength();
+    partitions = core::Tensor({n}, core::Dtype::Int64, device);
+
+    const int* keys_ptr = static_cast<const int*>(block_keys.GetDataPtr());
+    int64_t* partitions_ptr = static_cast<int64_t*>(partitions.GetDataPtr());
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+    core::kernel::CUDALauncher::LaunchGeneralKernel(
+            n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+#else
+    core::kernel::CPULauncher::LaunchGeneralKernel(
+            n, [&](int64_t workload_idx) {
+#endif
+                // Tiles of tile_size^3 blocks are hashed as a whole, so that
+                // partitions only meet at tile boundaries.
+                uint64_t hash = 0;
+                const uint64_t primes[3] = {73856093, 19349669, 83492791};
+                for (int i = 0; i < 3; ++i) {
+                    int64_t key = keys_ptr[3 * workload_idx + i];
+                    int64_t tile = key >= 0 ? key / tile_size
+                                            : (key + 1) / tile_size - 1;
+                    hash ^= static_cast<uint64_t>(tile) * primes[i];
+                }
+                partitions_ptr[workload_idx] = static_cast<int64_t>(
+                        hash % static_cast<uint64_t>(num_partitions));
+            });
+}
+
 #if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
 void IntegrateCUDA
 #else
@@ -289,73 +631,240 @@ void IntegrateCPU
 
     DISPATCH_BYTESIZE_TO_VOXEL(
             voxel_block_buffer_indexer.ElementByteSize(), [&]() {
-                launcher.LaunchGeneralKernel(n, [=] OPEN3D_DEVICE(
-                                                        int64_t workload_idx) {
-                    // Natural index (0, N) -> (block_idx, voxel_idx)
-                    int64_t block_idx = indices_ptr[workload_idx / resolution3];
-                    int64_t voxel_idx = workload_idx % resolution3;
+                launcher.LaunchGeneralKernel(
+                        n,
+                        [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                            // Natural index (0, N) -> (block_idx, voxel_idx)
+                            int64_t block_idx =
+                                    indices_ptr[workload_idx / resolution3];
+                            int64_t voxel_idx = workload_idx % resolution3;
+
+                            /// Coordinate transform
+                            // block_idx -> (x_block, y_block, z_block)
+                            int* block_key_ptr =
+                                    block_keys_indexer.GetDataPtrFromCoord<int>(
+                                            block_idx);
+                            int64_t xb = static_cast<int64_t>(block_key_ptr[0]);
+                            int64_t yb = static_cast<int64_t>(block_key_ptr[1]);
+                            int64_t zb = static_cast<int64_t>(block_key_ptr[2]);
+
+                            // voxel_idx -> (x_voxel, y_voxel, z_voxel)
+                            int64_t xv, yv, zv;
+                            voxel_indexer.WorkloadToCoord(voxel_idx, &xv, &yv,
+                                                          &zv);
+
+                            // coordinate in world (in voxel)
+                            int64_t x = (xb * resolution + xv);
+                            int64_t y = (yb * resolution + yv);
+                            int64_t z = (zb * resolution + zv);
+
+                            // coordinate in camera (in voxel -> in meter)
+                            float xc, yc, zc, u, v;
+                            transform_indexer.RigidTransform(
+                                    static_cast<float>(x),
+                                    static_cast<float>(y),
+                                    static_cast<float>(z), &xc, &yc, &zc);
+
+                            // coordinate in image (in pixel)
+                            transform_indexer.Project(xc, yc, zc, &u, &v);
+                            if (!depth_indexer.InBoundary(u, v)) {
+                                return;
+                            }
 
-                    /// Coordinate transform
-                    // block_idx -> (x_block, y_block, z_block)
-                    int* block_key_ptr =
-                            block_keys_indexer.GetDataPtrFromCoord<int>(
-                                    block_idx);
-                    int64_t xb = static_cast<int64_t>(block_key_ptr[0]);
-                    int64_t yb = static_cast<int64_t>(block_key_ptr[1]);
-                    int64_t zb = static_cast<int64_t>(block_key_ptr[2]);
+                            // Associate image workload and compute SDF and
+                            // TSDF.
+                            float depth =
+                                    *depth_indexer.GetDataPtrFromCoord<float>(
+                                            static_cast<int64_t>(u),
+                                            static_cast<int64_t>(v)) /
+                                    depth_scale;
+
+                            float sdf = (depth - zc);
+                            if (depth <= 0 || depth > depth_max || zc <= 0 ||
+                                sdf < -sdf_trunc) {
+                                return;
+                            }
+                            sdf = sdf < sdf_trunc ? sdf : sdf_trunc;
+                            sdf /= sdf_trunc;
 
-                    // voxel_idx -> (x_voxel, y_voxel, z_voxel)
-                    int64_t xv, yv, zv;
-                    voxel_indexer.WorkloadToCoord(voxel_idx, &xv, &yv, &zv);
+                            // Associate voxel workload and update TSDF/Weights
+                            voxel_t* voxel_ptr =
+                                    voxel_block_buffer_indexer
+                                            .GetDataPtrFromCoord<voxel_t>(
+                                                    xv, yv, zv, block_idx);
 
-                    // coordinate in world (in voxel)
-                    int64_t x = (xb * resolution + xv);
-                    int64_t y = (yb * resolution + yv);
-                    int64_t z = (zb * resolution + zv);
+                            if (integrate_color) {
+                                float* color_ptr =
+                                        color_indexer
+                                                .GetDataPtrFromCoord<float>(
+                                                        static_cast<int64_t>(u),
+                                                        static_cast<int64_t>(
+                                                                v));
+
+                                voxel_ptr->Integrate(sdf, color_ptr[0],
+                                                     color_ptr[1],
+                                                     color_ptr[2]);
+                            } else {
+                                voxel_ptr->Integrate(sdf);
+                            }
+                        },
+                        core::kernel::ParallelSchedule::WorkStealing());
+            });
+}
 
-                    // coordinate in camera (in voxel -> in meter)
-                    float xc, yc, zc, u, v;
-                    transform_indexer.RigidTransform(
-                            static_cast<float>(x), static_cast<float>(y),
-                            static_cast<float>(z), &xc, &yc, &zc);
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void IntegrateBatchCUDA
+#else
+void IntegrateBatchCPU
+#endif
+        (const core::Tensor& depths,
+         const core::Tensor& colors,
+         const core::Tensor& indices,
+         const core::Tensor& block_keys,
+         core::Tensor& block_values,
+         // Transforms
+         const core::Tensor& intrinsics,
+         const core::Tensor& extrinsics,
+         // Parameters
+         int64_t resolution,
+         float voxel_size,
+         float sdf_trunc,
+         float depth_scale,
+         float depth_max) {
+    // Parameters
+    int64_t resolution3 = resolution * resolution * resolution;
+    int64_t num_frames = depths.GetLength();
+    core::Device device = block_values.GetDevice();
+
+    // One transform indexer per frame, uploaded as a plain array.
+    std::vector<TransformIndexer> transforms;
+    transforms.reserve(num_frames);
+    for (int64_t k = 0; k < num_frames; ++k) {
+        transforms.emplace_back(intrinsics[k], extrinsics[k], voxel_size);
+    }
+    std::vector<uint8_t> transform_bytes(num_frames *
+                                         sizeof(TransformIndexer));
+    std::memcpy(transform_bytes.data(), transforms.data(),
+                transform_bytes.size());
+    core::Tensor transforms_tensor(
+            transform_bytes, {static_cast<int64_t>(transform_bytes.size())},
+            core::Dtype::UInt8, device);
+    const TransformIndexer* transforms_ptr =
+            static_cast<const TransformIndexer*>(
+                    transforms_tensor.GetDataPtr());
+
+    // Shape indexer, no data involved
+    NDArrayIndexer voxel_indexer({resolution, resolution, resolution});
 
-                    // coordinate in image (in pixel)
-                    transform_indexer.Project(xc, yc, zc, &u, &v);
-                    if (!depth_indexer.InBoundary(u, v)) {
-                        return;
-                    }
+    // Real data indexers, with the frame as the last coordinate
+    NDArrayIndexer depth_indexer(depths, 3);
+    NDArrayIndexer block_keys_indexer(block_keys, 1);
+    NDArrayIndexer voxel_block_buffer_indexer(block_values, 4);
 
-                    // Associate image workload and compute SDF and TSDF.
-                    float depth = *depth_indexer.GetDataPtrFromCoord<float>(
-                                          static_cast<int64_t>(u),
-                                          static_cast<int64_t>(v)) /
-                                  depth_scale;
+    // Optional color integration
+    NDArrayIndexer color_indexer;
+    bool integrate_color = false;
+    if (colors.NumElements() != 0) {
+        color_indexer = NDArrayIndexer(colors, 3);
+        integrate_color = true;
+    }
 
-                    float sdf = (depth - zc);
-                    if (depth <= 0 || depth > depth_max || zc <= 0 ||
-                        sdf < -sdf_trunc) {
-                        return;
-                    }
-                    sdf = sdf < sdf_trunc ? sdf : sdf_trunc;
-                    sdf /= sdf_trunc;
+    // Plain arrays that does not require indexers
+    const int64_t* indices_ptr =
+            static_cast<const int64_t*>(indices.GetDataPtr());
 
-                    // Associate voxel workload and update TSDF/Weights
-                    voxel_t* voxel_ptr = voxel_block_buffer_indexer
-                                                 .GetDataPtrFromCoord<voxel_t>(
-                                                         xv, yv, zv, block_idx);
+    int64_t n = indices.GetLength() * resolution3;
 
-                    if (integrate_color) {
-                        float* color_ptr =
-                                color_indexer.GetDataPtrFromCoord<float>(
-                                        static_cast<int64_t>(u),
-                                        static_cast<int64_t>(v));
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+    core::kernel::CUDALauncher launcher;
+#else
+    core::kernel::CPULauncher launcher;
+#endif
 
-                        voxel_ptr->Integrate(sdf, color_ptr[0], color_ptr[1],
-                                             color_ptr[2]);
-                    } else {
-                        voxel_ptr->Integrate(sdf);
-                    }
-                });
+    DISPATCH_BYTESIZE_TO_VOXEL(
+            voxel_block_buffer_indexer.ElementByteSize(), [&]() {
+                launcher.LaunchGeneralKernel(
+                        n,
+                        [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                            // Natural index (0, N) -> (block_idx, voxel_idx)
+                            int64_t block_idx =
+                                    indices_ptr[workload_idx / resolution3];
+                            int64_t voxel_idx = workload_idx % resolution3;
+
+                            // block_idx -> (x_block, y_block, z_block)
+                            int* block_key_ptr =
+                                    block_keys_indexer.GetDataPtrFromCoord<int>(
+                                            block_idx);
+                            int64_t xb = static_cast<int64_t>(block_key_ptr[0]);
+                            int64_t yb = static_cast<int64_t>(block_key_ptr[1]);
+                            int64_t zb = static_cast<int64_t>(block_key_ptr[2]);
+
+                            // voxel_idx -> (x_voxel, y_voxel, z_voxel)
+                            int64_t xv, yv, zv;
+                            voxel_indexer.WorkloadToCoord(voxel_idx, &xv, &yv,
+                                                          &zv);
+
+                            // coordinate in world (in voxel)
+                            float x = static_cast<float>(xb * resolution + xv);
+                            float y = static_cast<float>(yb * resolution + yv);
+                            float z = static_cast<float>(zb * resolution + zv);
+
+                            // The voxel is loaded once and updated by the
+                            // frames in order, as sequential integration.
+                            voxel_t* voxel_ptr =
+                                    voxel_block_buffer_indexer
+                                            .GetDataPtrFromCoord<voxel_t>(
+                                                    xv, yv, zv, block_idx);
+                            for (int64_t k = 0; k < num_frames; ++k) {
+                                const TransformIndexer& transform_indexer =
+                                        transforms_ptr[k];
+
+                                // coordinate in camera (in voxel -> in meter)
+                                float xc, yc, zc, u, v;
+                                transform_indexer.RigidTransform(x, y, z, &xc,
+                                                                 &yc, &zc);
+
+                                // coordinate in image (in pixel)
+                                transform_indexer.Project(xc, yc, zc, &u, &v);
+                                if (!depth_indexer.InBoundary(
+                                            u, v, static_cast<float>(k))) {
+                                    continue;
+                                }
+
+                                float depth =
+                                        *depth_indexer
+                                                 .GetDataPtrFromCoord<float>(
+                                                         static_cast<int64_t>(
+                                                                 u),
+                                                         static_cast<int64_t>(
+                                                                 v),
+                                                         k) /
+                                        depth_scale;
+
+                                float sdf = (depth - zc);
+                                if (depth <= 0 || depth > depth_max ||
+                                    zc <= 0 || sdf < -sdf_trunc) {
+                                    continue;
+                                }
+                                sdf = sdf < sdf_trunc ? sdf : sdf_trunc;
+                                sdf /= sdf_trunc;
+
+                                if (integrate_color) {
+                                    float* color_ptr =
+                                            color_indexer.GetDataPtrFromCoord<
+                                                    float>(
+                                                    static_cast<int64_t>(u),
+                                                    static_cast<int64_t>(v),
+                                                    k);
+                                    voxel_ptr->Integrate(sdf, color_ptr[0],
+                                                         color_ptr[1],
+                                                         color_ptr[2]);
+                                } else {
+                                    voxel_ptr->Integrate(sdf);
+                                }
+                            }
+                        },
+                        core::kernel::ParallelSchedule::WorkStealing());
             });
 }
 
@@ -365,8 +874,6 @@ void ExtractSurfacePointsCUDA
 void ExtractSurfacePointsCPU
 #endif
         (const core::Tensor& indices,
-         const core::Tensor& nb_indices,
-         const core::Tensor& nb_masks,
          const core::Tensor& block_keys,
          const core::Tensor& block_values,
          core::Tensor& points,
@@ -383,8 +890,10 @@ void ExtractSurfacePointsCPU
     // Real data indexer
     NDArrayIndexer voxel_block_buffer_indexer(block_values, 4);
     NDArrayIndexer block_keys_indexer(block_keys, 1);
-    NDArrayIndexer nb_block_masks_indexer(nb_masks, 2);
-    NDArrayIndexer nb_block_indices_indexer(nb_indices, 2);
+
+    // Neighbor blocks are looked up on the fly.
+    core::Tensor block_table = BuildBlockTable(indices, block_keys);
+    BlockTableIndexer block_table_indexer(block_table, indices, block_keys);
 
     // Plain arrays that does not require indexers
     const int64_t* indices_ptr =
@@ -420,8 +929,7 @@ void ExtractSurfacePointsCPU
                         return DeviceGetVoxelAt<voxel_t>(
                                 xo, yo, zo, curr_block_idx,
                                 static_cast<int>(resolution),
-                                nb_block_masks_indexer,
-                                nb_block_indices_indexer,
+                                block_table_indexer,
                                 voxel_block_buffer_indexer);
                     };
 
@@ -505,8 +1013,7 @@ void ExtractSurfacePointsCPU
                         return DeviceGetVoxelAt<voxel_t>(
                                 xo, yo, zo, curr_block_idx,
                                 static_cast<int>(resolution),
-                                nb_block_masks_indexer,
-                                nb_block_indices_indexer,
+                                block_table_indexer,
                                 voxel_block_buffer_indexer);
                     };
                     auto GetNormalAt = [&] OPEN3D_DEVICE(int xo, int yo, int zo,
@@ -515,8 +1022,7 @@ void ExtractSurfacePointsCPU
                         return DeviceGetNormalAt<voxel_t>(
                                 xo, yo, zo, curr_block_idx, n,
                                 static_cast<int>(resolution), voxel_size,
-                                nb_block_masks_indexer,
-                                nb_block_indices_indexer,
+                                block_table_indexer,
                                 voxel_block_buffer_indexer);
                     };
 
@@ -636,9 +1142,6 @@ void ExtractSurfaceMeshCUDA
 void ExtractSurfaceMeshCPU
 #endif
         (const core::Tensor& indices,
-         const core::Tensor& inv_indices,
-         const core::Tensor& nb_indices,
-         const core::Tensor& nb_masks,
          const core::Tensor& block_keys,
          const core::Tensor& block_values,
          core::Tensor& vertices,
@@ -680,14 +1183,16 @@ void ExtractSurfaceMeshCPU
     // Real data indexer
     NDArrayIndexer voxel_block_buffer_indexer(block_values, 4);
     NDArrayIndexer mesh_structure_indexer(mesh_structure, 4);
-    NDArrayIndexer nb_block_masks_indexer(nb_masks, 2);
-    NDArrayIndexer nb_block_indices_indexer(nb_indices, 2);
+
+    // Neighbor blocks are looked up on the fly. The mesh structure is indexed
+    // by the positions of the blocks in the active indices, as returned by the
+    // table.
+    core::Tensor block_table = BuildBlockTable(indices, block_keys);
+    BlockTableIndexer block_table_indexer(block_table, indices, block_keys);
 
     // Plain arrays that does not require indexers
     const int64_t* indices_ptr =
             static_cast<const int64_t*>(indices.GetDataPtr());
-    const int64_t* inv_indices_ptr =
-            static_cast<const int64_t*>(inv_indices.GetDataPtr());
 
     int64_t n = n_blocks * resolution3;
 
@@ -709,8 +1214,7 @@ void ExtractSurfaceMeshCPU
                         return DeviceGetVoxelAt<voxel_t>(
                                 xo, yo, zo, curr_block_idx,
                                 static_cast<int>(resolution),
-                                nb_block_masks_indexer,
-                                nb_block_indices_indexer,
+                                block_table_indexer,
                                 voxel_block_buffer_indexer);
                     };
 
@@ -759,20 +1263,13 @@ void ExtractSurfaceMeshCPU
                             int dyb = static_cast<int>(yv_i / resolution);
                             int dzb = static_cast<int>(zv_i / resolution);
 
-                            int nb_idx =
-                                    (dxb + 1) + (dyb + 1) * 3 + (dzb + 1) * 9;
-
-                            int64_t block_idx_i =
-                                    *nb_block_indices_indexer
-                                             .GetDataPtrFromCoord<int64_t>(
-                                                     workload_block_idx,
-                                                     nb_idx);
+                            int64_t nb_i = block_table_indexer.FindNeighbor(
+                                    workload_block_idx, dxb, dyb, dzb);
                             int* mesh_ptr_i =
                                     mesh_structure_indexer.GetDataPtrFromCoord<
                                             int>(xv_i - dxb * resolution,
                                                  yv_i - dyb * resolution,
-                                                 zv_i - dzb * resolution,
-                                                 inv_indices_ptr[block_idx_i]);
+                                                 zv_i - dzb * resolution, nb_i);
 
                             // Non-atomic write, but we are safe
                             mesh_ptr_i[edge_i] = -1;
@@ -867,8 +1364,7 @@ void ExtractSurfaceMeshCPU
                         return DeviceGetVoxelAt<voxel_t>(
                                 xo, yo, zo, curr_block_idx,
                                 static_cast<int>(resolution),
-                                nb_block_masks_indexer,
-                                nb_block_indices_indexer,
+                                block_table_indexer,
                                 voxel_block_buffer_indexer);
                     };
 
@@ -878,8 +1374,7 @@ void ExtractSurfaceMeshCPU
                         return DeviceGetNormalAt<voxel_t>(
                                 xo, yo, zo, curr_block_idx, n,
                                 static_cast<int>(resolution), voxel_size,
-                                nb_block_masks_indexer,
-                                nb_block_indices_indexer,
+                                block_table_indexer,
                                 voxel_block_buffer_indexer);
                     };
 
@@ -1044,18 +1539,13 @@ void ExtractSurfaceMeshCPU
                         int dyb = static_cast<int>(yv_i / resolution);
                         int dzb = static_cast<int>(zv_i / resolution);
 
-                        int nb_idx = (dxb + 1) + (dyb + 1) * 3 + (dzb + 1) * 9;
-
-                        int64_t block_idx_i =
-                                *nb_block_indices_indexer
-                                         .GetDataPtrFromCoord<int64_t>(
-                                                 workload_block_idx, nb_idx);
+                        int64_t nb_i = block_table_indexer.FindNeighbor(
+                                workload_block_idx, dxb, dyb, dzb);
                         int* mesh_struct_ptr_i =
                                 mesh_structure_indexer.GetDataPtrFromCoord<int>(
                                         xv_i - dxb * resolution,
                                         yv_i - dyb * resolution,
-                                        zv_i - dzb * resolution,
-                                        inv_indices_ptr[block_idx_i]);
+                                        zv_i - dzb * resolution, nb_i);
 
                         int64_t* triangle_ptr =
                                 triangle_indexer.GetDataPtrFromCoord<int64_t>(
@@ -1074,6 +1564,704 @@ void ExtractSurfaceMeshCPU
     triangles = triangles.Slice(0, 0, total_tri_count);
 }
 
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void ExtractSurfaceMeshBlocksCUDA
+#else
+void ExtractSurfaceMeshBlocksCPU
+#endif
+        (const core::Tensor& mesh_indices,
+         const core::Tensor& indices,
+         const core::Tensor& block_keys,
+         const core::Tensor& block_values,
+         core::Tensor& vertices,
+         core::Tensor& triangles,
+         core::Tensor& normals,
+         core::Tensor& colors,
+         core::Tensor& vertex_block_indices,
+         core::Tensor& triangle_block_indices,
+         int64_t resolution,
+         float voxel_size) {
+    int64_t resolution3 = resolution * resolution * resolution;
+    int64_t padded_resolution = resolution + 1;
+    int64_t padded_resolution3 =
+            padded_resolution * padded_resolution * padded_resolution;
+
+    // Shape / transform indexers, no data involved
+    NDArrayIndexer voxel_indexer({resolution, resolution, resolution});
+    NDArrayIndexer padded_voxel_indexer(
+            {padded_resolution, padded_resolution, padded_resolution});
+
+    core::Device device = block_values.GetDevice();
+    int64_t n_blocks = mesh_indices.GetLength();
+
+    // Block-wise mesh info with one more voxel layer in each direction, to hold
+    // the edges shared with the next blocks. Each block gets its own copy of
+    // the vertices on these edges, so that the blocks can be re-meshed
+    // independently. 4 channels correspond to: 3 edges' corresponding vertex
+    // index + 1 table index.
+    core::Tensor mesh_structure;
+    try {
+        mesh_structure = core::Tensor::Zeros(
+                {n_blocks, padded_resolution, padded_resolution,
+                 padded_resolution, 4},
+                core::Dtype::Int32, device);
+    } catch (const std::runtime_error&) {
+        utility::LogError(
+                "[MeshExtractionKernel] Unable to allocate assistance mesh "
+                "structure for Marching Cubes with {} voxel blocks to "
+                "re-mesh.",
+                n_blocks);
+    }
+
+    // Real data indexer
+    NDArrayIndexer voxel_block_buffer_indexer(block_values, 4);
+    NDArrayIndexer mesh_structure_indexer(mesh_structure, 4);
+    NDArrayIndexer block_keys_indexer(block_keys, 1);
+
+    // Neighbor voxels are looked up among all the active blocks, the
+    // re-meshed ones and the ones they border.
+    core::Tensor block_table = BuildBlockTable(indices, block_keys);
+    BlockTableIndexer block_table_indexer(block_table, indices, block_keys);
+
+    // Plain arrays that does not require indexers
+    const int64_t* mesh_indices_ptr =
+            static_cast<const int64_t*>(mesh_indices.GetDataPtr());
+
+    int64_t n = n_blocks * resolution3;
+    int64_t np = n_blocks * padded_resolution3;
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+    core::kernel::CUDALauncher launcher;
+#else
+    core::kernel::CPULauncher launcher;
+#endif
+
+    // Pass 0: analyze mesh structure, set up one-on-one correspondences from
+    // edges to vertices within each block.
+    DISPATCH_BYTESIZE_TO_VOXEL(
+            voxel_block_buffer_indexer.ElementByteSize(), [&]() {
+                launcher.LaunchGeneralKernel(n, [=] OPEN3D_DEVICE(
+                                                        int64_t workload_idx) {
+                    // Natural index (0, N) -> (block_idx, voxel_idx)
+                    int64_t workload_block_idx = workload_idx / resolution3;
+                    int64_t voxel_idx = workload_idx % resolution3;
+
+                    // Position of the block among all the active blocks
+                    int* block_key_ptr =
+                            block_keys_indexer.GetDataPtrFromCoord<int>(
+                                    mesh_indices_ptr[workload_block_idx]);
+                    int curr_block_idx = static_cast<int>(
+                            block_table_indexer.Find(block_key_ptr[0],
+                                                     block_key_ptr[1],
+                                                     block_key_ptr[2]));
+
+                    // voxel_idx -> (x_voxel, y_voxel, z_voxel)
+                    int64_t xv, yv, zv;
+                    voxel_indexer.WorkloadToCoord(voxel_idx, &xv, &yv, &zv);
+
+                    // Check per-vertex sign in the cube to determine cube type
+                    int table_idx = 0;
+                    for (int i = 0; i < 8; ++i) {
+                        voxel_t* voxel_ptr_i = DeviceGetVoxelAt<voxel_t>(
+                                static_cast<int>(xv) + vtx_shifts[i][0],
+                                static_cast<int>(yv) + vtx_shifts[i][1],
+                                static_cast<int>(zv) + vtx_shifts[i][2],
+                                curr_block_idx, static_cast<int>(resolution),
+                                block_table_indexer,
+                                voxel_block_buffer_indexer);
+                        if (voxel_ptr_i == nullptr) return;
+
+                        float tsdf_i = voxel_ptr_i->GetTSDF();
+                        float weight_i = voxel_ptr_i->GetWeight();
+                        if (weight_i <= kWeightThreshold) return;
+
+                        table_idx |= ((tsdf_i < 0) ? (1 << i) : 0);
+                    }
+
+                    int* mesh_struct_ptr =
+                            mesh_structure_indexer.GetDataPtrFromCoord<int>(
+                                    xv, yv, zv, workload_block_idx);
+                    mesh_struct_ptr[3] = table_idx;
+
+                    if (table_idx == 0 || table_idx == 255) return;
+
+                    // Check per-edge sign in the cube to determine cube type
+                    int edges_with_vertices = edge_table[table_idx];
+                    for (int i = 0; i < 12; ++i) {
+                        if (edges_with_vertices & (1 << i)) {
+                            int* mesh_ptr_i =
+                                    mesh_structure_indexer.GetDataPtrFromCoord<
+                                            int>(xv + edge_shifts[i][0],
+                                                 yv + edge_shifts[i][1],
+                                                 zv + edge_shifts[i][2],
+                                                 workload_block_idx);
+
+                            // Non-atomic write, but we are safe
+                            mesh_ptr_i[edge_shifts[i][3]] = -1;
+                        }
+                    }
+                });
+            });
+
+    // Pass 1: determine valid number of vertices.
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+    core::Tensor vtx_count(std::vector<int>{0}, {}, core::Dtype::Int32,
+                           device);
+    int* vtx_count_ptr = static_cast<int*>(vtx_count.GetDataPtr());
+#else
+    std::atomic<int> vtx_count_atomic(0);
+    std::atomic<int>* vtx_count_ptr = &vtx_count_atomic;
+#endif
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+    core::kernel::CUDALauncher::LaunchGeneralKernel(
+            np, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+#else
+    core::kernel::CPULauncher::LaunchGeneralKernel(
+            np, [&](int64_t workload_idx) {
+#endif
+                int64_t workload_block_idx = workload_idx / padded_resolution3;
+                int64_t voxel_idx = workload_idx % padded_resolution3;
+
+                int64_t xv, yv, zv;
+                padded_voxel_indexer.WorkloadToCoord(voxel_idx, &xv, &yv, &zv);
+
+                int* mesh_struct_ptr =
+                        mesh_structure_indexer.GetDataPtrFromCoord<int>(
+                                xv, yv, zv, workload_block_idx);
+                for (int e = 0; e < 3; ++e) {
+                    if (mesh_struct_ptr[e] == -1) {
+                        OPEN3D_ATOMIC_ADD(vtx_count_ptr, 1);
+                    }
+                }
+            });
+
+    // Reset count_ptr
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+    int total_vtx_count = vtx_count.Item<int>();
+    vtx_count = core::Tensor(std::vector<int>{0}, {}, core::Dtype::Int32,
+                             device);
+    vtx_count_ptr = static_cast<int*>(vtx_count.GetDataPtr());
+#else
+    int total_vtx_count = (*vtx_count_ptr).load();
+    (*vtx_count_ptr) = 0;
+#endif
+
+    utility::LogDebug("Total vertex count = {} in {} re-meshed blocks",
+                      total_vtx_count, n_blocks);
+    vertices = core::Tensor({total_vtx_count, 3}, core::Dtype::Float32, device);
+    normals = core::Tensor({total_vtx_count, 3}, core::Dtype::Float32, device);
+    vertex_block_indices =
+            core::Tensor({total_vtx_count}, core::Dtype::Int64, device);
+
+    NDArrayIndexer vertex_indexer(vertices, 1);
+    NDArrayIndexer normal_indexer(normals, 1);
+    int64_t* vertex_block_indices_ptr =
+            static_cast<int64_t*>(vertex_block_indices.GetDataPtr());
+
+    // Pass 2: extract vertices.
+    DISPATCH_BYTESIZE_TO_VOXEL(
+            voxel_block_buffer_indexer.ElementByteSize(), [&]() {
+                bool extract_color = false;
+                NDArrayIndexer color_indexer;
+                if (voxel_t::HasColor()) {
+                    extract_color = true;
+                    colors = core::Tensor({total_vtx_count, 3},
+                                          core::Dtype::Float32, device);
+                    color_indexer = NDArrayIndexer(colors, 1);
+                }
+                launcher.LaunchGeneralKernel(np, [=] OPEN3D_DEVICE(
+                                                         int64_t workload_idx) {
+                    int64_t workload_block_idx =
+                            workload_idx / padded_resolution3;
+                    int64_t voxel_idx = workload_idx % padded_resolution3;
+
+                    int64_t xv, yv, zv;
+                    padded_voxel_indexer.WorkloadToCoord(voxel_idx, &xv, &yv,
+                                                         &zv);
+
+                    int* mesh_struct_ptr =
+                            mesh_structure_indexer.GetDataPtrFromCoord<int>(
+                                    xv, yv, zv, workload_block_idx);
+
+                    // Early quit -- no allocated vertex to compute
+                    if (mesh_struct_ptr[0] != -1 && mesh_struct_ptr[1] != -1 &&
+                        mesh_struct_ptr[2] != -1) {
+                        return;
+                    }
+
+                    int64_t block_idx = mesh_indices_ptr[workload_block_idx];
+                    int* block_key_ptr =
+                            block_keys_indexer.GetDataPtrFromCoord<int>(
+                                    block_idx);
+                    int curr_block_idx = static_cast<int>(
+                            block_table_indexer.Find(block_key_ptr[0],
+                                                     block_key_ptr[1],
+                                                     block_key_ptr[2]));
+
+                    auto GetVoxelAt = [&] OPEN3D_DEVICE(int xo, int yo,
+                                                        int zo) -> voxel_t* {
+                        return DeviceGetVoxelAt<voxel_t>(
+                                xo, yo, zo, curr_block_idx,
+                                static_cast<int>(resolution),
+                                block_table_indexer,
+                                voxel_block_buffer_indexer);
+                    };
+
+                    auto GetNormalAt = [&] OPEN3D_DEVICE(int xo, int yo, int zo,
+                                                         float* n) {
+                        return DeviceGetNormalAt<voxel_t>(
+                                xo, yo, zo, curr_block_idx, n,
+                                static_cast<int>(resolution), voxel_size,
+                                block_table_indexer,
+                                voxel_block_buffer_indexer);
+                    };
+
+                    // global coordinate (in voxels)
+                    int64_t x = block_key_ptr[0] * resolution + xv;
+                    int64_t y = block_key_ptr[1] * resolution + yv;
+                    int64_t z = block_key_ptr[2] * resolution + zv;
+
+                    // The voxel may belong to a next block.
+                    voxel_t* voxel_ptr =
+                            GetVoxelAt(static_cast<int>(xv),
+                                       static_cast<int>(yv),
+                                       static_cast<int>(zv));
+                    float tsdf_o = voxel_ptr->GetTSDF();
+                    float no[3] = {0}, ne[3] = {0};
+                    GetNormalAt(static_cast<int>(xv), static_cast<int>(yv),
+                                static_cast<int>(zv), no);
+
+                    // Enumerate 3 edges in the voxel
+                    for (int e = 0; e < 3; ++e) {
+                        int vertex_idx = mesh_struct_ptr[e];
+                        if (vertex_idx != -1) continue;
+
+                        voxel_t* voxel_ptr_e =
+                                GetVoxelAt(static_cast<int>(xv) + (e == 0),
+                                           static_cast<int>(yv) + (e == 1),
+                                           static_cast<int>(zv) + (e == 2));
+                        float tsdf_e = voxel_ptr_e->GetTSDF();
+                        float ratio = (0 - tsdf_o) / (tsdf_e - tsdf_o);
+
+                        int idx = OPEN3D_ATOMIC_ADD(vtx_count_ptr, 1);
+                        mesh_struct_ptr[e] = idx;
+                        vertex_block_indices_ptr[idx] = block_idx;
+
+                        float* vertex_ptr =
+                                vertex_indexer.GetDataPtrFromCoord<float>(idx);
+                        vertex_ptr[0] = voxel_size * (x + ratio * int(e == 0));
+                        vertex_ptr[1] = voxel_size * (y + ratio * int(e == 1));
+                        vertex_ptr[2] = voxel_size * (z + ratio * int(e == 2));
+
+                        float* normal_ptr =
+                                normal_indexer.GetDataPtrFromCoord<float>(idx);
+                        GetNormalAt(static_cast<int>(xv) + (e == 0),
+                                    static_cast<int>(yv) + (e == 1),
+                                    static_cast<int>(zv) + (e == 2), ne);
+                        float nx = (1 - ratio) * no[0] + ratio * ne[0];
+                        float ny = (1 - ratio) * no[1] + ratio * ne[1];
+                        float nz = (1 - ratio) * no[2] + ratio * ne[2];
+                        float norm = static_cast<float>(
+                                sqrt(nx * nx + ny * ny + nz * nz) + 1e-5);
+                        normal_ptr[0] = nx / norm;
+                        normal_ptr[1] = ny / norm;
+                        normal_ptr[2] = nz / norm;
+
+                        if (extract_color) {
+                            float* color_ptr =
+                                    color_indexer.GetDataPtrFromCoord<float>(
+                                            idx);
+                            float r_o = voxel_ptr->GetR();
+                            float g_o = voxel_ptr->GetG();
+                            float b_o = voxel_ptr->GetB();
+
+                            float r_e = voxel_ptr_e->GetR();
+                            float g_e = voxel_ptr_e->GetG();
+                            float b_e = voxel_ptr_e->GetB();
+                            color_ptr[0] =
+                                    ((1 - ratio) * r_o + ratio * r_e) / 255.0f;
+                            color_ptr[1] =
+                                    ((1 - ratio) * g_o + ratio * g_e) / 255.0f;
+                            color_ptr[2] =
+                                    ((1 - ratio) * b_o + ratio * b_e) / 255.0f;
+                        }
+                    }
+                });
+            });
+
+    // Pass 3: connect vertices and form triangles.
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+    core::Tensor triangle_count(std::vector<int>{0}, {}, core::Dtype::Int32,
+                                device);
+    int* tri_count_ptr = static_cast<int*>(triangle_count.GetDataPtr());
+#else
+    std::atomic<int> tri_count_atomic(0);
+    std::atomic<int>* tri_count_ptr = &tri_count_atomic;
+#endif
+
+    triangles =
+            core::Tensor({total_vtx_count * 3, 3}, core::Dtype::Int64, device);
+    triangle_block_indices =
+            core::Tensor({total_vtx_count * 3}, core::Dtype::Int64, device);
+    NDArrayIndexer triangle_indexer(triangles, 1);
+    int64_t* triangle_block_indices_ptr =
+            static_cast<int64_t*>(triangle_block_indices.GetDataPtr());
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+    core::kernel::CUDALauncher::LaunchGeneralKernel(
+            n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+#else
+    core::kernel::CPULauncher::LaunchGeneralKernel(
+            n, [&](int64_t workload_idx) {
+#endif
+                int64_t workload_block_idx = workload_idx / resolution3;
+                int64_t voxel_idx = workload_idx % resolution3;
+
+                int64_t xv, yv, zv;
+                voxel_indexer.WorkloadToCoord(voxel_idx, &xv, &yv, &zv);
+
+                int* mesh_struct_ptr =
+                        mesh_structure_indexer.GetDataPtrFromCoord<int>(
+                                xv, yv, zv, workload_block_idx);
+
+                int table_idx = mesh_struct_ptr[3];
+                if (tri_count[table_idx] == 0) return;
+
+                for (size_t tri = 0; tri < 16; tri += 3) {
+                    if (tri_table[table_idx][tri] == -1) return;
+
+                    int tri_idx = OPEN3D_ATOMIC_ADD(tri_count_ptr, 1);
+                    triangle_block_indices_ptr[tri_idx] =
+                            mesh_indices_ptr[workload_block_idx];
+
+                    int64_t* triangle_ptr =
+                            triangle_indexer.GetDataPtrFromCoord<int64_t>(
+                                    tri_idx);
+                    for (size_t vertex = 0; vertex < 3; ++vertex) {
+                        int edge = tri_table[table_idx][tri + vertex];
+                        int* mesh_struct_ptr_i =
+                                mesh_structure_indexer.GetDataPtrFromCoord<int>(
+                                        xv + edge_shifts[edge][0],
+                                        yv + edge_shifts[edge][1],
+                                        zv + edge_shifts[edge][2],
+                                        workload_block_idx);
+                        triangle_ptr[2 - vertex] =
+                                mesh_struct_ptr_i[edge_shifts[edge][3]];
+                    }
+                }
+            });
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+    int total_tri_count = triangle_count.Item<int>();
+#else
+    int total_tri_count = (*tri_count_ptr).load();
+#endif
+    utility::LogDebug("Total triangle count = {} in {} re-meshed blocks",
+                      total_tri_count, n_blocks);
+    triangles = triangles.Slice(0, 0, total_tri_count);
+    triangle_block_indices =
+            triangle_block_indices.Slice(0, 0, total_tri_count);
+}
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void RayCastCUDA
+#else
+void RayCastCPU
+#endif
+        (const core::Tensor& indices,
+         const core::Tensor& block_keys,
+         const core::Tensor& block_values,
+         core::Tensor& vertex_map,
+         core::Tensor& depth_map,
+         core::Tensor& normal_map,
+         core::Tensor& color_map,
+         const core::Tensor& intrinsics,
+         const core::Tensor& pose,
+         int64_t h,
+         int64_t w,
+         int64_t block_resolution,
+         float voxel_size,
+         float sdf_trunc,
+         float depth_min,
+         float depth_max) {
+    core::Device device = block_values.GetDevice();
+
+    // Rays look up blocks in the table of the active blocks, without the
+    // hashmap.
+    core::Tensor block_table = BuildBlockTable(indices, block_keys);
+    BlockTableIndexer block_table_indexer(block_table, indices, block_keys);
+    NDArrayIndexer voxel_block_buffer_indexer(block_values, 4);
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+    core::kernel::CUDALauncher launcher;
+#else
+    core::kernel::CPULauncher launcher;
+#endif
+
+    // pose is the camera to world transform, extrinsics is its inverse.
+    TransformIndexer c2w_indexer(intrinsics, pose, 1.0f);
+    float R_w2c[3][3];
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            R_w2c[i][j] = pose[j][i].Item<float>();
+        }
+    }
+    float ox, oy, oz;
+    c2w_indexer.RigidTransform(0, 0, 0, &ox, &oy, &oz);
+
+    vertex_map = core::Tensor::Zeros({h, w, 3}, core::Dtype::Float32, device);
+    depth_map = core::Tensor::Zeros({h, w, 1}, core::Dtype::Float32, device);
+    normal_map = core::Tensor::Zeros({h, w, 3}, core::Dtype::Float32, device);
+    NDArrayIndexer vertex_map_indexer(vertex_map, 2);
+    NDArrayIndexer depth_map_indexer(depth_map, 2);
+    NDArrayIndexer normal_map_indexer(normal_map, 2);
+
+    int resolution = static_cast<int>(block_resolution);
+    int64_t n = h * w;
+
+    DISPATCH_BYTESIZE_TO_VOXEL(
+            voxel_block_buffer_indexer.ElementByteSize(), [&]() {
+                bool extract_color = false;
+                NDArrayIndexer color_map_indexer;
+                if (voxel_t::HasColor()) {
+                    extract_color = true;
+                    color_map = core::Tensor::Zeros({h, w, 3},
+                                                    core::Dtype::Float32,
+                                                    device);
+                    color_map_indexer = NDArrayIndexer(color_map, 2);
+                }
+
+                launcher.LaunchGeneralKernel(
+                        n,
+                        [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                            // Voxel at integer voxel coordinates, or nullptr
+                            // if its block is not allocated. The last block
+                            // is cached, since consecutive samples mostly
+                            // fall into the same block.
+                            int cached_key[3] = {0, 0, 0};
+                            int64_t cached_block_idx = -2;
+                            auto GetVoxelAt = [&] OPEN3D_DEVICE(
+                                                      int x, int y,
+                                                      int z) -> voxel_t* {
+                                int key[3];
+                                int local[3];
+                                int coord[3] = {x, y, z};
+                                for (int i = 0; i < 3; ++i) {
+                                    key[i] = static_cast<int>(floorf(
+                                            static_cast<float>(coord[i]) /
+                                            resolution));
+                                    local[i] = coord[i] - key[i] * resolution;
+                                }
+                                if (cached_block_idx == -2 ||
+                                    key[0] != cached_key[0] ||
+                                    key[1] != cached_key[1] ||
+                                    key[2] != cached_key[2]) {
+                                    int64_t active_i =
+                                            block_table_indexer.Find(
+                                                    key[0], key[1], key[2]);
+                                    cached_block_idx =
+                                            active_i < 0
+                                                    ? -1
+                                                    : block_table_indexer
+                                                              .GetBlockIndex(
+                                                                      active_i);
+                                    for (int i = 0; i < 3; ++i) {
+                                        cached_key[i] = key[i];
+                                    }
+                                }
+                                if (cached_block_idx < 0) return nullptr;
+                                return voxel_block_buffer_indexer
+                                        .GetDataPtrFromCoord<voxel_t>(
+                                                local[0], local[1], local[2],
+                                                cached_block_idx);
+                            };
+
+                            // Trilinear TSDF at a position in voxels. Returns
+                            // false if a corner is not observed.
+                            auto GetTSDFAt = [&] OPEN3D_DEVICE(
+                                                     float x, float y, float z,
+                                                     float* tsdf) -> bool {
+                                int x0 = static_cast<int>(floorf(x));
+                                int y0 = static_cast<int>(floorf(y));
+                                int z0 = static_cast<int>(floorf(z));
+                                float a = x - x0, b = y - y0, c = z - z0;
+                                float sum = 0;
+                                for (int k = 0; k < 8; ++k) {
+                                    int i = k & 1, j = (k >> 1) & 1,
+                                        l = (k >> 2) & 1;
+                                    voxel_t* voxel_ptr =
+                                            GetVoxelAt(x0 + i, y0 + j, z0 + l);
+                                    if (voxel_ptr == nullptr ||
+                                        voxel_ptr->GetWeight() <= 0) {
+                                        return false;
+                                    }
+                                    float ratio = (i ? a : 1 - a) *
+                                                  (j ? b : 1 - b) *
+                                                  (l ? c : 1 - c);
+                                    sum += ratio * voxel_ptr->GetTSDF();
+                                }
+                                *tsdf = sum;
+                                return true;
+                            };
+
+                            int64_t y = workload_idx / w;
+                            int64_t x = workload_idx % w;
+
+                            // Ray o + t * dir in world coordinates, where t is
+                            // the depth along the camera z axis.
+                            float xc, yc, zc, dx, dy, dz;
+                            c2w_indexer.Unproject(static_cast<float>(x),
+                                                  static_cast<float>(y), 1.0f,
+                                                  &xc, &yc, &zc);
+                            c2w_indexer.RigidTransform(xc, yc, zc, &dx, &dy,
+                                                       &dz);
+                            dx -= ox;
+                            dy -= oy;
+                            dz -= oz;
+                            float inv_len =
+                                    1.0f / sqrtf(dx * dx + dy * dy + dz * dz);
+
+                            float t = depth_min;
+                            float t_prev = t;
+                            float tsdf_prev = 1.0f;
+                            bool valid_prev = false;
+                            float t_hit = -1;
+                            while (t < depth_max) {
+                                float xv = (ox + t * dx) / voxel_size;
+                                float yv = (oy + t * dy) / voxel_size;
+                                float zv = (oz + t * dz) / voxel_size;
+                                voxel_t* voxel_ptr = GetVoxelAt(
+                                        static_cast<int>(roundf(xv)),
+                                        static_cast<int>(roundf(yv)),
+                                        static_cast<int>(roundf(zv)));
+
+                                // Skip the unallocated block, jumping to
+                                // where the ray leaves it.
+                                if (voxel_ptr == nullptr) {
+                                    float d[3] = {dx, dy, dz};
+                                    float o[3] = {ox, oy, oz};
+                                    float t_exit = depth_max;
+                                    for (int i = 0; i < 3; ++i) {
+                                        if (d[i] == 0) continue;
+                                        float bound =
+                                                ((cached_key[i] + (d[i] > 0)) *
+                                                         resolution -
+                                                 0.5f) *
+                                                voxel_size;
+                                        float t_i = (bound - o[i]) / d[i];
+                                        t_exit = t_i < t_exit ? t_i : t_exit;
+                                    }
+                                    valid_prev = false;
+                                    t = (t_exit > t ? t_exit : t) +
+                                        0.01f * voxel_size * inv_len;
+                                    continue;
+                                }
+
+                                float tsdf = voxel_ptr->GetTSDF();
+                                if (voxel_ptr->GetWeight() <= 0) {
+                                    valid_prev = false;
+                                    t += voxel_size * inv_len;
+                                    continue;
+                                }
+
+                                if (valid_prev && tsdf_prev > 0 && tsdf <= 0) {
+                                    // Refine the zero crossing with the
+                                    // trilinear TSDF, falling back to the
+                                    // nearest voxels at the boundary.
+                                    float ratio =
+                                            tsdf_prev / (tsdf_prev - tsdf);
+                                    float tsdf_a, tsdf_b;
+                                    if (GetTSDFAt((ox + t_prev * dx) /
+                                                          voxel_size,
+                                                  (oy + t_prev * dy) /
+                                                          voxel_size,
+                                                  (oz + t_prev * dz) /
+                                                          voxel_size,
+                                                  &tsdf_a) &&
+                                        GetTSDFAt(xv, yv, zv, &tsdf_b) &&
+                                        tsdf_a > 0 && tsdf_b <= 0) {
+                                        ratio = tsdf_a / (tsdf_a - tsdf_b);
+                                    }
+                                    t_hit = t_prev + ratio * (t - t_prev);
+                                    break;
+                                }
+
+                                // Step by the truncated distance to the
+                                // surface, at least one voxel.
+                                valid_prev = true;
+                                tsdf_prev = tsdf;
+                                t_prev = t;
+                                float step = tsdf * sdf_trunc * 0.8f;
+                                t += (step > voxel_size ? step : voxel_size) *
+                                     inv_len;
+                            }
+                            if (t_hit < 0) return;
+
+                            float xw = ox + t_hit * dx;
+                            float yw = oy + t_hit * dy;
+                            float zw = oz + t_hit * dz;
+
+                            float* depth_ptr =
+                                    depth_map_indexer.GetDataPtrFromCoord<
+                                            float>(x, y);
+                            *depth_ptr = t_hit;
+
+                            float* vertex_ptr =
+                                    vertex_map_indexer.GetDataPtrFromCoord<
+                                            float>(x, y);
+                            vertex_ptr[0] = xc * t_hit;
+                            vertex_ptr[1] = yc * t_hit;
+                            vertex_ptr[2] = t_hit;
+
+                            // Normal from the TSDF gradient at the nearest
+                            // voxel, rotated to camera coordinates.
+                            int xi = static_cast<int>(roundf(xw / voxel_size));
+                            int yi = static_cast<int>(roundf(yw / voxel_size));
+                            int zi = static_cast<int>(roundf(zw / voxel_size));
+                            float nw[3] = {0, 0, 0};
+                            for (int i = 0; i < 3; ++i) {
+                                voxel_t* vp = GetVoxelAt(xi + (i == 0),
+                                                         yi + (i == 1),
+                                                         zi + (i == 2));
+                                voxel_t* vn = GetVoxelAt(xi - (i == 0),
+                                                         yi - (i == 1),
+                                                         zi - (i == 2));
+                                if (vp && vn) {
+                                    nw[i] = vp->GetTSDF() - vn->GetTSDF();
+                                }
+                            }
+                            float norm = sqrtf(nw[0] * nw[0] + nw[1] * nw[1] +
+                                               nw[2] * nw[2]);
+                            if (norm > 0) {
+                                float* normal_ptr =
+                                        normal_map_indexer.GetDataPtrFromCoord<
+                                                float>(x, y);
+                                for (int i = 0; i < 3; ++i) {
+                                    normal_ptr[i] = (R_w2c[i][0] * nw[0] +
+                                                     R_w2c[i][1] * nw[1] +
+                                                     R_w2c[i][2] * nw[2]) /
+                                                    norm;
+                                }
+                            }
+
+                            if (extract_color) {
+                                voxel_t* voxel_ptr = GetVoxelAt(xi, yi, zi);
+                                if (voxel_ptr != nullptr) {
+                                    float* color_ptr =
+                                            color_map_indexer
+                                                    .GetDataPtrFromCoord<float>(
+                                                            x, y);
+                                    color_ptr[0] = voxel_ptr->GetR();
+                                    color_ptr[1] = voxel_ptr->GetG();
+                                    color_ptr[2] = voxel_ptr->GetB();
+                                }
+                            }
+                        },
+                        core::kernel::ParallelSchedule::WorkStealing());
+            });
+}
+
 }  // namespace tsdf
 }  // namespace kernel
 }  // namespace geometry
@@ -0,0 +1,70 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/kernel/Transform.h"
+
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+namespace transform {
+
+void TransformPointsAndNormals(const core::Tensor& transformations,
+                               std::vector<core::Tensor>& points,
+                               std::vector<core::Tensor>& normals) {
+    int64_t num_sets = int64_t(points.size());
+    transformations.AssertShape({num_sets, 4, 4});
+    if (normals.size() != points.size()) {
+        utility::LogError(
+                "[TransformPointsAndNormals] Got {} sets of points but {} "
+                "sets of normals.",
+                points.size(), normals.size());
+    }
+    core::Device::DeviceType device_type =
+            transformations.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        TransformPointsAndNormalsCPU(transformations, points, normals);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        TransformPointsAndNormalsCUDA(transformations, points, normals);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+}  // namespace transform
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
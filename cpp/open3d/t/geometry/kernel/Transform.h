@@ -0,0 +1,67 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+namespace transform {
+
+/// Transforms several sets of points and normals in place in a single kernel
+/// launch: the points by p = R p + t and the normals by n = R n, where R and
+/// t are the rotation and the translation of the transformation of the set.
+///
+/// \param transformations Tensor of shape {k, 4, 4}, on the device of the
+/// points, one transformation per set.
+/// \param points k contiguous tensors of shape {n_i, 3}, Float32 or Float64,
+/// all with the same dtype. Empty tensors are skipped.
+/// \param normals k contiguous tensors of shape {n_i, 3} with the dtype of
+/// the points, or empty tensors. A set may have normals and no points.
+void TransformPointsAndNormals(const core::Tensor& transformations,
+                               std::vector<core::Tensor>& points,
+                               std::vector<core::Tensor>& normals);
+
+void TransformPointsAndNormalsCPU(const core::Tensor& transformations,
+                                  std::vector<core::Tensor>& points,
+                                  std::vector<core::Tensor>& normals);
+
+#ifdef BUILD_CUDA_MODULE
+void TransformPointsAndNormalsCUDA(const core::Tensor& transformations,
+                                   std::vector<core::Tensor>& points,
+                                   std::vector<core::Tensor>& normals);
+#endif
+
+}  // namespace transform
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
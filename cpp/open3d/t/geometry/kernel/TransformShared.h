@@ -0,0 +1,151 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <vector>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/CoreUtil.h"
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/kernel/Transform.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+namespace transform {
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void TransformPointsAndNormalsCUDA
+#else
+void TransformPointsAndNormalsCPU
+#endif
+        (const core::Tensor& transformations,
+         std::vector<core::Tensor>& points,
+         std::vector<core::Tensor>& normals) {
+    const core::Device& device = transformations.GetDevice();
+    int64_t num_sets = int64_t(points.size());
+    core::Tensor matrices =
+            transformations.To(core::Dtype::Float64).Contiguous();
+
+    // Points address, normals address (0 if none) and index of the first
+    // point of each set, the sets being numbered one after the other.
+    std::vector<int64_t> table(3 * num_sets);
+    int64_t num_points = 0;
+    core::Dtype dtype = core::Dtype::Undefined;
+    auto CheckSet = [&](const core::Tensor& tensor, int64_t count) {
+        if (tensor.NumElements() == 0) {
+            return;
+        }
+        tensor.AssertShape({count, 3});
+        tensor.AssertDevice(device);
+        if (!tensor.IsContiguous()) {
+            utility::LogError(
+                    "[TransformPointsAndNormals] Tensors must be contiguous.");
+        }
+        if (dtype == core::Dtype::Undefined) {
+            dtype = tensor.GetDtype();
+        }
+        tensor.AssertDtype(dtype);
+    };
+    for (int64_t i = 0; i < num_sets; ++i) {
+        int64_t count = points[i].NumElements() > 0 ? points[i].GetLength()
+                                                    : normals[i].GetLength();
+        CheckSet(points[i], count);
+        CheckSet(normals[i], count);
+        table[3 * i] = points[i].NumElements() > 0
+                               ? reinterpret_cast<int64_t>(
+                                         points[i].GetDataPtr())
+                               : 0;
+        table[3 * i + 1] = normals[i].NumElements() > 0
+                                   ? reinterpret_cast<int64_t>(
+                                             normals[i].GetDataPtr())
+                                   : 0;
+        table[3 * i + 2] = num_points;
+        num_points += count;
+    }
+    if (num_points == 0) {
+        return;
+    }
+    core::Tensor table_tensor(table, {num_sets, 3}, core::Dtype::Int64, device);
+    const int64_t* table_ptr =
+            static_cast<const int64_t*>(table_tensor.GetDataPtr());
+    const double* matrices_ptr =
+            static_cast<const double*>(matrices.GetDataPtr());
+
+    DISPATCH_FLOAT32_FLOAT64_DTYPE(dtype, [&]() {
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+        core::kernel::CUDALauncher::LaunchGeneralKernel(
+                num_points, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+#else
+        core::kernel::CPULauncher::LaunchGeneralKernel(
+                num_points, [&](int64_t workload_idx) {
+#endif
+                    // The set of the point is the last one starting at or
+                    // before it.
+                    int64_t lo = 0;
+                    int64_t hi = num_sets - 1;
+                    while (lo < hi) {
+                        int64_t mid = (lo + hi + 1) / 2;
+                        if (table_ptr[3 * mid + 2] <= workload_idx) {
+                            lo = mid;
+                        } else {
+                            hi = mid - 1;
+                        }
+                    }
+                    const int64_t* entry = table_ptr + 3 * lo;
+                    const double* T = matrices_ptr + 16 * lo;
+                    int64_t offset = 3 * (workload_idx - entry[2]);
+                    if (entry[0] != 0) {
+                        scalar_t* p = reinterpret_cast<scalar_t*>(entry[0]) +
+                                      offset;
+                        double x = p[0], y = p[1], z = p[2];
+                        for (int k = 0; k < 3; ++k) {
+                            p[k] = static_cast<scalar_t>(
+                                    T[4 * k] * x + T[4 * k + 1] * y +
+                                    T[4 * k + 2] * z + T[4 * k + 3]);
+                        }
+                    }
+                    if (entry[1] != 0) {
+                        scalar_t* n = reinterpret_cast<scalar_t*>(entry[1]) +
+                                      offset;
+                        double x = n[0], y = n[1], z = n[2];
+                        for (int k = 0; k < 3; ++k) {
+                            n[k] = static_cast<scalar_t>(T[4 * k] * x +
+                                                         T[4 * k + 1] * y +
+                                                         T[4 * k + 2] * z);
+                        }
+                    }
+                });
+    });
+}
+
+}  // namespace transform
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,276 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/kernel/TriangleMesh.h"
+
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+namespace trianglemesh {
+
+void ComputeTriangleNormals(const core::Tensor& vertices,
+                            const core::Tensor& triangles,
+                            core::Tensor& triangle_normals) {
+    core::Device::DeviceType device_type = vertices.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeTriangleNormalsCPU(vertices, triangles, triangle_normals);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        ComputeTriangleNormalsCUDA(vertices, triangles, triangle_normals);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void AccumulateVertexNormals(const core::Tensor& triangles,
+                             const core::Tensor& triangle_normals,
+                             core::Tensor& vertex_normals) {
+    core::Device::DeviceType device_type = triangles.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        AccumulateVertexNormalsCPU(triangles, triangle_normals, vertex_normals);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        AccumulateVertexNormalsCUDA(triangles, triangle_normals,
+                                    vertex_normals);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void NormalizeNormals(core::Tensor& normals) {
+    core::Device::DeviceType device_type = normals.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        NormalizeNormalsCPU(normals);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        NormalizeNormalsCUDA(normals);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void SegmentFirstIndex(const core::Tensor& segment_ids,
+                       int64_t num_segments,
+                       core::Tensor& first_indices) {
+    core::Device::DeviceType device_type = segment_ids.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        SegmentFirstIndexCPU(segment_ids, num_segments, first_indices);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        SegmentFirstIndexCUDA(segment_ids, num_segments, first_indices);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void SampleTriangles(const core::Tensor& triangle_areas,
+                     int64_t number_of_points,
+                     uint64_t seed,
+                     core::Tensor& triangle_ids,
+                     core::Tensor& barycentric) {
+    core::Device::DeviceType device_type = triangle_areas.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        SampleTrianglesCPU(triangle_areas, number_of_points, seed,
+                           triangle_ids, barycentric);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        SampleTrianglesCUDA(triangle_areas, number_of_points, seed,
+                            triangle_ids, barycentric);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void ComputeEliminationWeights(const core::Tensor& points,
+                               const core::Tensor& alive,
+                               const core::Tensor& cell_ids,
+                               const core::Tensor& neighbor_cells,
+                               const core::Tensor& cell_offsets,
+                               const core::Tensor& cell_order,
+                               double r_max,
+                               double r_min,
+                               double alpha,
+                               core::Tensor& weights) {
+    core::Device::DeviceType device_type = points.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeEliminationWeightsCPU(points, alive, cell_ids, neighbor_cells,
+                                     cell_offsets, cell_order, r_max, r_min,
+                                     alpha, weights);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        ComputeEliminationWeightsCUDA(points, alive, cell_ids, neighbor_cells,
+                                      cell_offsets, cell_order, r_max, r_min,
+                                      alpha, weights);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void FindEliminationCandidates(const core::Tensor& points,
+                               const core::Tensor& alive,
+                               const core::Tensor& weights,
+                               const core::Tensor& cell_ids,
+                               const core::Tensor& neighbor_cells,
+                               const core::Tensor& cell_offsets,
+                               const core::Tensor& cell_order,
+                               double r_max,
+                               core::Tensor& local_maxima) {
+    core::Device::DeviceType device_type = points.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        FindEliminationCandidatesCPU(points, alive, weights, cell_ids,
+                                     neighbor_cells, cell_offsets, cell_order,
+                                     r_max, local_maxima);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        FindEliminationCandidatesCUDA(points, alive, weights, cell_ids,
+                                      neighbor_cells, cell_offsets, cell_order,
+                                      r_max, local_maxima);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void ComputeNeighborWeights(const core::Tensor& vertices,
+                            const core::Tensor& neighbor_offsets,
+                            const core::Tensor& neighbors,
+                            core::Tensor& weights) {
+    core::Device::DeviceType device_type = vertices.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeNeighborWeightsCPU(vertices, neighbor_offsets, neighbors,
+                                  weights);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        ComputeNeighborWeightsCUDA(vertices, neighbor_offsets, neighbors,
+                                   weights);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void FilterVertexAttr(const core::Tensor& src,
+                      const core::Tensor& neighbor_offsets,
+                      const core::Tensor& neighbors,
+                      const core::Tensor& weights,
+                      NeighborFilter filter,
+                      double strength,
+                      core::Tensor& dst) {
+    core::Device::DeviceType device_type = src.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        FilterVertexAttrCPU(src, neighbor_offsets, neighbors, weights, filter,
+                            strength, dst);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        FilterVertexAttrCUDA(src, neighbor_offsets, neighbors, weights, filter,
+                             strength, dst);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void ComputeTriangleEdges(const core::Tensor& triangles, core::Tensor& edges) {
+    core::Device::DeviceType device_type = triangles.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeTriangleEdgesCPU(triangles, edges);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        ComputeTriangleEdgesCUDA(triangles, edges);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+bool HookComponents(const core::Tensor& links,
+                    const core::Tensor& labels,
+                    core::Tensor& parents) {
+    core::Device::DeviceType device_type = links.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        return HookComponentsCPU(links, labels, parents);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        return HookComponentsCUDA(links, labels, parents);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+    return false;
+}
+
+void CompressComponents(const core::Tensor& parents, core::Tensor& labels) {
+    core::Device::DeviceType device_type = parents.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        CompressComponentsCPU(parents, labels);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        CompressComponentsCUDA(parents, labels);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+}  // namespace trianglemesh
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,354 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+namespace trianglemesh {
+
+/// Computes the normal of each triangle as the cross product of its edges.
+///
+/// \param vertices Vertices of shape {n, 3}, Float32 or Float64.
+/// \param triangles Int64 vertex indices of shape {m, 3}.
+/// \param triangle_normals Output normals of shape {m, 3}, same dtype as
+/// vertices.
+void ComputeTriangleNormals(const core::Tensor& vertices,
+                            const core::Tensor& triangles,
+                            core::Tensor& triangle_normals);
+
+void ComputeTriangleNormalsCPU(const core::Tensor& vertices,
+                               const core::Tensor& triangles,
+                               core::Tensor& triangle_normals);
+
+#ifdef BUILD_CUDA_MODULE
+void ComputeTriangleNormalsCUDA(const core::Tensor& vertices,
+                                const core::Tensor& triangles,
+                                core::Tensor& triangle_normals);
+#endif
+
+/// Atomically adds the normal of each triangle to the normals of its
+/// vertices.
+///
+/// \param triangles Int64 vertex indices of shape {m, 3}.
+/// \param triangle_normals Normals of shape {m, 3}, Float32 or Float64.
+/// \param vertex_normals Normals of shape {n, 3}, same dtype as
+/// triangle_normals, usually initialized to zero.
+void AccumulateVertexNormals(const core::Tensor& triangles,
+                             const core::Tensor& triangle_normals,
+                             core::Tensor& vertex_normals);
+
+void AccumulateVertexNormalsCPU(const core::Tensor& triangles,
+                                const core::Tensor& triangle_normals,
+                                core::Tensor& vertex_normals);
+
+#ifdef BUILD_CUDA_MODULE
+void AccumulateVertexNormalsCUDA(const core::Tensor& triangles,
+                                 const core::Tensor& triangle_normals,
+                                 core::Tensor& vertex_normals);
+#endif
+
+/// Normalizes the normals in place. Zero normals are left unchanged.
+///
+/// \param normals Contiguous normals of shape {n, 3}, Float32 or Float64.
+void NormalizeNormals(core::Tensor& normals);
+
+void NormalizeNormalsCPU(core::Tensor& normals);
+
+#ifdef BUILD_CUDA_MODULE
+void NormalizeNormalsCUDA(core::Tensor& normals);
+#endif
+
+/// Finds the smallest index of the elements of each segment.
+///
+/// \param segment_ids Int64 segment of each element, in [0, num_segments).
+/// \param num_segments Number of segments.
+/// \param first_indices Output Int64 tensor of shape {num_segments}.
+void SegmentFirstIndex(const core::Tensor& segment_ids,
+                       int64_t num_segments,
+                       core::Tensor& first_indices);
+
+void SegmentFirstIndexCPU(const core::Tensor& segment_ids,
+                          int64_t num_segments,
+                          core::Tensor& first_indices);
+
+#ifdef BUILD_CUDA_MODULE
+void SegmentFirstIndexCUDA(const core::Tensor& segment_ids,
+                           int64_t num_segments,
+                           core::Tensor& first_indices);
+#endif
+
+/// Draws points uniformly on the surface of a mesh: each point picks a
+/// triangle with a probability proportional to its area, by a binary search
+/// in the prefix sum of the areas, and uniform barycentric coordinates in it.
+/// Every point has its own counter-based random stream, so the result only
+/// depends on the seed, not on the device or the number of threads.
+///
+/// \param triangle_areas Float64 areas of shape {m}.
+/// \param number_of_points Number of points to draw.
+/// \param seed Seed of the random streams.
+/// \param triangle_ids Output Int64 triangle of each point, shape {n}.
+/// \param barycentric Output Float64 barycentric coordinates of each point,
+/// shape {n, 3}.
+void SampleTriangles(const core::Tensor& triangle_areas,
+                     int64_t number_of_points,
+                     uint64_t seed,
+                     core::Tensor& triangle_ids,
+                     core::Tensor& barycentric);
+
+void SampleTrianglesCPU(const core::Tensor& triangle_areas,
+                        int64_t number_of_points,
+                        uint64_t seed,
+                        core::Tensor& triangle_ids,
+                        core::Tensor& barycentric);
+
+#ifdef BUILD_CUDA_MODULE
+void SampleTrianglesCUDA(const core::Tensor& triangle_areas,
+                         int64_t number_of_points,
+                         uint64_t seed,
+                         core::Tensor& triangle_ids,
+                         core::Tensor& barycentric);
+#endif
+
+/// Computes the sample elimination weight of each remaining point, the sum
+/// of (1 - max(d, r_min) / r_max)^alpha over the other remaining points at a
+/// distance d < r_max. The neighbors are found in a grid of cells of size at
+/// least r_max.
+///
+/// \param points Points of shape {n, 3}, Float32 or Float64.
+/// \param alive Bool tensor of shape {n}, false for the eliminated points.
+/// \param cell_ids Int64 grid cell of each point, shape {n}.
+/// \param neighbor_cells Int64 tensor of shape {num_cells, 27}, the cells
+/// around each cell, -1 for the empty ones.
+/// \param cell_offsets Int64 tensor of shape {num_cells + 1}, the points of
+/// cell c are cell_order[cell_offsets[c]:cell_offsets[c + 1]].
+/// \param cell_order Int64 point indices sorted by cell, shape {n}.
+/// \param weights Output Float64 weights of shape {n}, 0 for the eliminated
+/// points.
+void ComputeEliminationWeights(const core::Tensor& points,
+                               const core::Tensor& alive,
+                               const core::Tensor& cell_ids,
+                               const core::Tensor& neighbor_cells,
+                               const core::Tensor& cell_offsets,
+                               const core::Tensor& cell_order,
+                               double r_max,
+                               double r_min,
+                               double alpha,
+                               core::Tensor& weights);
+
+void ComputeEliminationWeightsCPU(const core::Tensor& points,
+                                  const core::Tensor& alive,
+                                  const core::Tensor& cell_ids,
+                                  const core::Tensor& neighbor_cells,
+                                  const core::Tensor& cell_offsets,
+                                  const core::Tensor& cell_order,
+                                  double r_max,
+                                  double r_min,
+                                  double alpha,
+                                  core::Tensor& weights);
+
+#ifdef BUILD_CUDA_MODULE
+void ComputeEliminationWeightsCUDA(const core::Tensor& points,
+                                   const core::Tensor& alive,
+                                   const core::Tensor& cell_ids,
+                                   const core::Tensor& neighbor_cells,
+                                   const core::Tensor& cell_offsets,
+                                   const core::Tensor& cell_order,
+                                   double r_max,
+                                   double r_min,
+                                   double alpha,
+                                   core::Tensor& weights);
+#endif
+
+/// Marks the remaining points whose weight is larger than the weight of all
+/// the other remaining points closer than r_max, ties broken by the smaller
+/// index. No two marked points are closer than r_max, so they can be
+/// eliminated together. The grid is the same as in ComputeEliminationWeights.
+///
+/// \param weights Float64 weights of shape {n}.
+/// \param local_maxima Output Bool tensor of shape {n}.
+void FindEliminationCandidates(const core::Tensor& points,
+                               const core::Tensor& alive,
+                               const core::Tensor& weights,
+                               const core::Tensor& cell_ids,
+                               const core::Tensor& neighbor_cells,
+                               const core::Tensor& cell_offsets,
+                               const core::Tensor& cell_order,
+                               double r_max,
+                               core::Tensor& local_maxima);
+
+void FindEliminationCandidatesCPU(const core::Tensor& points,
+                                  const core::Tensor& alive,
+                                  const core::Tensor& weights,
+                                  const core::Tensor& cell_ids,
+                                  const core::Tensor& neighbor_cells,
+                                  const core::Tensor& cell_offsets,
+                                  const core::Tensor& cell_order,
+                                  double r_max,
+                                  core::Tensor& local_maxima);
+
+#ifdef BUILD_CUDA_MODULE
+void FindEliminationCandidatesCUDA(const core::Tensor& points,
+                                   const core::Tensor& alive,
+                                   const core::Tensor& weights,
+                                   const core::Tensor& cell_ids,
+                                   const core::Tensor& neighbor_cells,
+                                   const core::Tensor& cell_offsets,
+                                   const core::Tensor& cell_order,
+                                   double r_max,
+                                   core::Tensor& local_maxima);
+#endif
+
+/// Vertex filters of TriangleMesh::FilterSharpen, FilterSmoothSimple and
+/// FilterSmoothLaplacian / FilterSmoothTaubin.
+enum class NeighborFilter { Sharpen, Simple, Laplacian };
+
+/// Computes the weights of the Laplacian smoothing, the inverse distances
+/// between each vertex and its neighbors.
+///
+/// \param vertices Vertices of shape {n, 3}, Float32 or Float64.
+/// \param neighbor_offsets Int64 tensor of shape {n + 1}. The neighbors of
+/// vertex i are neighbors[neighbor_offsets[i]:neighbor_offsets[i + 1]].
+/// \param neighbors Int64 vertex indices of the neighbors.
+/// \param weights Output Float64 tensor with the shape of neighbors.
+void ComputeNeighborWeights(const core::Tensor& vertices,
+                            const core::Tensor& neighbor_offsets,
+                            const core::Tensor& neighbors,
+                            core::Tensor& weights);
+
+void ComputeNeighborWeightsCPU(const core::Tensor& vertices,
+                               const core::Tensor& neighbor_offsets,
+                               const core::Tensor& neighbors,
+                               core::Tensor& weights);
+
+#ifdef BUILD_CUDA_MODULE
+void ComputeNeighborWeightsCUDA(const core::Tensor& vertices,
+                                const core::Tensor& neighbor_offsets,
+                                const core::Tensor& neighbors,
+                                core::Tensor& weights);
+#endif
+
+/// Runs one step of a vertex filter on a vertex attribute, with the same
+/// formulas as the legacy TriangleMesh.
+///
+/// \param src Contiguous attribute of shape {n, 3}, Float32 or Float64.
+/// \param neighbor_offsets Neighbor offsets as in ComputeNeighborWeights.
+/// \param neighbors Int64 vertex indices of the neighbors.
+/// \param weights Float64 weights of the neighbors, or an empty tensor for
+/// unit weights.
+/// \param filter Filter to apply.
+/// \param strength Strength of the sharpening, or lambda / mu of the
+/// Laplacian.
+/// \param dst Output attribute, same shape and dtype as src.
+void FilterVertexAttr(const core::Tensor& src,
+                      const core::Tensor& neighbor_offsets,
+                      const core::Tensor& neighbors,
+                      const core::Tensor& weights,
+                      NeighborFilter filter,
+                      double strength,
+                      core::Tensor& dst);
+
+void FilterVertexAttrCPU(const core::Tensor& src,
+                         const core::Tensor& neighbor_offsets,
+                         const core::Tensor& neighbors,
+                         const core::Tensor& weights,
+                         NeighborFilter filter,
+                         double strength,
+                         core::Tensor& dst);
+
+#ifdef BUILD_CUDA_MODULE
+void FilterVertexAttrCUDA(const core::Tensor& src,
+                          const core::Tensor& neighbor_offsets,
+                          const core::Tensor& neighbors,
+                          const core::Tensor& weights,
+                          NeighborFilter filter,
+                          double strength,
+                          core::Tensor& dst);
+#endif
+
+/// Lists the 3 undirected edges of each triangle, with the smaller vertex
+/// first. Edge i of triangle t is row 3 * t + i and joins vertices i and
+/// (i + 1) % 3.
+///
+/// \param triangles Contiguous Int64 vertex indices of shape {m, 3}.
+/// \param edges Output Int64 tensor of shape {3 * m, 2}.
+void ComputeTriangleEdges(const core::Tensor& triangles, core::Tensor& edges);
+
+void ComputeTriangleEdgesCPU(const core::Tensor& triangles,
+                             core::Tensor& edges);
+
+#ifdef BUILD_CUDA_MODULE
+void ComputeTriangleEdgesCUDA(const core::Tensor& triangles,
+                              core::Tensor& edges);
+#endif
+
+/// Hooking step of the connected components: for each pair of elements (i,
+/// links[i]) in different components, atomically links the larger of the two
+/// roots to the smaller one.
+///
+/// \param links Int64 tensor of shape {n, k}, the elements connected to each
+/// element.
+/// \param labels Int64 root of the component of each element, shape {n}.
+/// \param parents Copy of labels, where the roots are linked.
+/// \return Whether any root was linked.
+bool HookComponents(const core::Tensor& links,
+                    const core::Tensor& labels,
+                    core::Tensor& parents);
+
+bool HookComponentsCPU(const core::Tensor& links,
+                       const core::Tensor& labels,
+                       core::Tensor& parents);
+
+#ifdef BUILD_CUDA_MODULE
+bool HookComponentsCUDA(const core::Tensor& links,
+                        const core::Tensor& labels,
+                        core::Tensor& parents);
+#endif
+
+/// Compression step of the connected components: sets the label of each
+/// element to the root found by following parents. Parents never point to a
+/// larger element, so the paths end.
+///
+/// \param parents Int64 parent of each element, shape {n}.
+/// \param labels Output Int64 root of each element, shape {n}.
+void CompressComponents(const core::Tensor& parents, core::Tensor& labels);
+
+void CompressComponentsCPU(const core::Tensor& parents, core::Tensor& labels);
+
+#ifdef BUILD_CUDA_MODULE
+void CompressComponentsCUDA(const core::Tensor& parents,
+                            core::Tensor& labels);
+#endif
+
+}  // namespace trianglemesh
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,668 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cmath>
+#include <numeric>
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+#include <thrust/execution_policy.h>
+#include <thrust/scan.h>
+#endif
+
+#include "open3d/core/Atomic.h"
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/CoreUtil.h"
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/kernel/TriangleMesh.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+namespace trianglemesh {
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+OPEN3D_DEVICE inline void AtomicAdd(float* address, float value) {
+    atomicAdd(address, value);
+}
+
+OPEN3D_DEVICE inline void AtomicAdd(double* address, double value) {
+#if __CUDA_ARCH__ >= 600
+    atomicAdd(address, value);
+#else
+    // Native double atomicAdd needs compute capability 6.0.
+    unsigned long long* address_ull =
+            reinterpret_cast<unsigned long long*>(address);
+    unsigned long long old = *address_ull, assumed;
+    do {
+        assumed = old;
+        old = atomicCAS(address_ull, assumed,
+                        __double_as_longlong(value +
+                                             __longlong_as_double(assumed)));
+    } while (assumed != old);
+#endif
+}
+#else
+template <typename scalar_t>
+inline void AtomicAdd(scalar_t* address, scalar_t value) {
+#pragma omp atomic
+    *address += value;
+}
+#endif
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void ComputeTriangleNormalsCUDA
+#else
+void ComputeTriangleNormalsCPU
+#endif
+        (const core::Tensor& vertices,
+         const core::Tensor& triangles,
+         core::Tensor& triangle_normals) {
+    int64_t m = triangles.GetLength();
+    const int64_t* triangles_ptr =
+            static_cast<const int64_t*>(triangles.GetDataPtr());
+
+    DISPATCH_FLOAT32_FLOAT64_DTYPE(vertices.GetDtype(), [&]() {
+        const scalar_t* vertices_ptr =
+                static_cast<const scalar_t*>(vertices.GetDataPtr());
+        scalar_t* normals_ptr =
+                static_cast<scalar_t*>(triangle_normals.GetDataPtr());
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+        core::kernel::CUDALauncher::LaunchGeneralKernel(
+                m, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+#else
+        core::kernel::CPULauncher::LaunchGeneralKernel(
+                m, [&](int64_t workload_idx) {
+#endif
+                    const int64_t* triangle = triangles_ptr + 3 * workload_idx;
+                    const scalar_t* v0 = vertices_ptr + 3 * triangle[0];
+                    const scalar_t* v1 = vertices_ptr + 3 * triangle[1];
+                    const scalar_t* v2 = vertices_ptr + 3 * triangle[2];
+                    scalar_t e01[3] = {v1[0] - v0[0], v1[1] - v0[1],
+                                       v1[2] - v0[2]};
+                    scalar_t e02[3] = {v2[0] - v0[0], v2[1] - v0[1],
+                                       v2[2] - v0[2]};
+                    scalar_t* normal = normals_ptr + 3 * workload_idx;
+                    normal[0] = e01[1] * e02[2] - e01[2] * e02[1];
+                    normal[1] = e01[2] * e02[0] - e01[0] * e02[2];
+                    normal[2] = e01[0] * e02[1] - e01[1] * e02[0];
+                });
+    });
+}
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void AccumulateVertexNormalsCUDA
+#else
+void AccumulateVertexNormalsCPU
+#endif
+        (const core::Tensor& triangles,
+         const core::Tensor& triangle_normals,
+         core::Tensor& vertex_normals) {
+    int64_t m = triangles.GetLength();
+    const int64_t* triangles_ptr =
+            static_cast<const int64_t*>(triangles.GetDataPtr());
+
+    DISPATCH_FLOAT32_FLOAT64_DTYPE(triangle_normals.GetDtype(), [&]() {
+        const scalar_t* triangle_normals_ptr =
+                static_cast<const scalar_t*>(triangle_normals.GetDataPtr());
+        scalar_t* vertex_normals_ptr =
+                static_cast<scalar_t*>(vertex_normals.GetDataPtr());
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+        core::kernel::CUDALauncher::LaunchGeneralKernel(
+                m, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+#else
+        core::kernel::CPULauncher::LaunchGeneralKernel(
+                m, [&](int64_t workload_idx) {
+#endif
+                    const int64_t* triangle = triangles_ptr + 3 * workload_idx;
+                    const scalar_t* normal =
+                            triangle_normals_ptr + 3 * workload_idx;
+                    for (int i = 0; i < 3; ++i) {
+                        scalar_t* vertex_normal =
+                                vertex_normals_ptr + 3 * triangle[i];
+                        AtomicAdd(vertex_normal + 0, normal[0]);
+                        AtomicAdd(vertex_normal + 1, normal[1]);
+                        AtomicAdd(vertex_normal + 2, normal[2]);
+                    }
+                });
+    });
+}
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void NormalizeNormalsCUDA
+#else
+void NormalizeNormalsCPU
+#endif
+        (core::Tensor& normals) {
+    int64_t n = normals.GetLength();
+
+    DISPATCH_FLOAT32_FLOAT64_DTYPE(normals.GetDtype(), [&]() {
+        scalar_t* normals_ptr = static_cast<scalar_t*>(normals.GetDataPtr());
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+        core::kernel::CUDALauncher::LaunchGeneralKernel(
+                n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+#else
+        core::kernel::CPULauncher::LaunchGeneralKernel(
+                n, [&](int64_t workload_idx) {
+#endif
+                    scalar_t* normal = normals_ptr + 3 * workload_idx;
+                    scalar_t norm = std::sqrt(normal[0] * normal[0] +
+                                              normal[1] * normal[1] +
+                                              normal[2] * normal[2]);
+                    if (norm > 0) {
+                        normal[0] /= norm;
+                        normal[1] /= norm;
+                        normal[2] /= norm;
+                    }
+                });
+    });
+}
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void SegmentFirstIndexCUDA
+#else
+void SegmentFirstIndexCPU
+#endif
+        (const core::Tensor& segment_ids,
+         int64_t num_segments,
+         core::Tensor& first_indices) {
+    int64_t n = segment_ids.GetLength();
+    first_indices = core::Tensor::Full({num_segments}, n, core::Dtype::Int64,
+                                       segment_ids.GetDevice());
+    const int64_t* segment_ids_ptr =
+            static_cast<const int64_t*>(segment_ids.GetDataPtr());
+    // Indices are non-negative, so they compare the same as unsigned.
+    uint64_t* first_indices_ptr =
+            static_cast<uint64_t*>(first_indices.GetDataPtr());
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+    core::kernel::CUDALauncher::LaunchGeneralKernel(
+            n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                atomicMin(reinterpret_cast<unsigned long long*>(
+                                  first_indices_ptr +
+                                  segment_ids_ptr[workload_idx]),
+                          static_cast<unsigned long long>(workload_idx));
+            });
+#else
+    core::kernel::CPULauncher::LaunchGeneralKernel(
+            n, [&](int64_t workload_idx) {
+                core::AtomicFetchMinRelaxed(
+                        first_indices_ptr + segment_ids_ptr[workload_idx],
+                        static_cast<uint64_t>(workload_idx));
+            });
+#endif
+}
+
+// Uniform double in [0, 1) of a counter-based random stream: the SplitMix64
+// finalizer of consecutive counters gives independent random bits.
+OPEN3D_HOST_DEVICE inline uint64_t MixBits(uint64_t x) {
+    x += 0x9e3779b97f4a7c15ull;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+    return x ^ (x >> 31);
+}
+
+OPEN3D_HOST_DEVICE inline double UniformDouble(uint64_t seed,
+                                               uint64_t counter) {
+    return (MixBits(seed ^ MixBits(counter)) >> 11) *
+           (1.0 / 9007199254740992.0);
+}
+
+// Calls func(j, d2) for every remaining point j != i closer than r_max to
+// point i, until func returns false.
+template <typename scalar_t, typename func_t>
+OPEN3D_HOST_DEVICE inline void ForEachRemainingNeighbor(
+        int64_t i,
+        const scalar_t* points_ptr,
+        const bool* alive_ptr,
+        const int64_t* cell_ids_ptr,
+        const int64_t* neighbor_cells_ptr,
+        const int64_t* cell_offsets_ptr,
+        const int64_t* cell_order_ptr,
+        double r_max2,
+        func_t func) {
+    const scalar_t* p = points_ptr + 3 * i;
+    const int64_t* cells = neighbor_cells_ptr + 27 * cell_ids_ptr[i];
+    for (int k = 0; k < 27; ++k) {
+        int64_t cell = cells[k];
+        if (cell < 0) {
+            continue;
+        }
+        for (int64_t o = cell_offsets_ptr[cell]; o < cell_offsets_ptr[cell + 1];
+             ++o) {
+            int64_t j = cell_order_ptr[o];
+            if (j == i || !alive_ptr[j]) {
+                continue;
+            }
+            const scalar_t* q = points_ptr + 3 * j;
+            double dx = q[0] - p[0];
+            double dy = q[1] - p[1];
+            double dz = q[2] - p[2];
+            double d2 = dx * dx + dy * dy + dz * dz;
+            if (d2 < r_max2 && !func(j, d2)) {
+                return;
+            }
+        }
+    }
+}
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void SampleTrianglesCUDA
+#else
+void SampleTrianglesCPU
+#endif
+        (const core::Tensor& triangle_areas,
+         int64_t number_of_points,
+         uint64_t seed,
+         core::Tensor& triangle_ids,
+         core::Tensor& barycentric) {
+    core::Device device = triangle_areas.GetDevice();
+    int64_t m = triangle_areas.GetLength();
+    core::Tensor cdf = triangle_areas.Contiguous().Copy();
+    double* cdf_ptr = static_cast<double*>(cdf.GetDataPtr());
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+    thrust::inclusive_scan(thrust::device, cdf_ptr, cdf_ptr + m, cdf_ptr);
+#else
+    std::partial_sum(cdf_ptr, cdf_ptr + m, cdf_ptr);
+#endif
+
+    triangle_ids = core::Tensor::Empty({number_of_points}, core::Dtype::Int64,
+                                       device);
+    barycentric = core::Tensor::Empty({number_of_points, 3},
+                                      core::Dtype::Float64, device);
+    int64_t* triangle_ids_ptr =
+            static_cast<int64_t*>(triangle_ids.GetDataPtr());
+    double* barycentric_ptr = static_cast<double*>(barycentric.GetDataPtr());
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+    core::kernel::CUDALauncher::LaunchGeneralKernel(
+            number_of_points, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+#else
+    core::kernel::CPULauncher::LaunchGeneralKernel(
+            number_of_points, [&](int64_t workload_idx) {
+#endif
+                // The first triangle whose cumulative area exceeds the
+                // target, which skips the triangles without area.
+                uint64_t counter = 3 * static_cast<uint64_t>(workload_idx);
+                double target = UniformDouble(seed, counter) * cdf_ptr[m - 1];
+                int64_t lo = 0;
+                int64_t hi = m - 1;
+                while (lo < hi) {
+                    int64_t mid = (lo + hi) / 2;
+                    if (cdf_ptr[mid] > target) {
+                        hi = mid;
+                    } else {
+                        lo = mid + 1;
+                    }
+                }
+                triangle_ids_ptr[workload_idx] = lo;
+
+                double r1 = std::sqrt(UniformDouble(seed, counter + 1));
+                double r2 = UniformDouble(seed, counter + 2);
+                double* weights = barycentric_ptr + 3 * workload_idx;
+                weights[0] = 1 - r1;
+                weights[1] = r1 * (1 - r2);
+                weights[2] = r1 * r2;
+            });
+}
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void ComputeEliminationWeightsCUDA
+#else
+void ComputeEliminationWeightsCPU
+#endif
+        (const core::Tensor& points,
+         const core::Tensor& alive,
+         const core::Tensor& cell_ids,
+         const core::Tensor& neighbor_cells,
+         const core::Tensor& cell_offsets,
+         const core::Tensor& cell_order,
+         double r_max,
+         double r_min,
+         double alpha,
+         core::Tensor& weights) {
+    int64_t n = points.GetLength();
+    weights = core::Tensor::Empty({n}, core::Dtype::Float64,
+                                  points.GetDevice());
+    const bool* alive_ptr = static_cast<const bool*>(alive.GetDataPtr());
+    const int64_t* cell_ids_ptr =
+            static_cast<const int64_t*>(cell_ids.GetDataPtr());
+    const int64_t* neighbor_cells_ptr =
+            static_cast<const int64_t*>(neighbor_cells.GetDataPtr());
+    const int64_t* cell_offsets_ptr =
+            static_cast<const int64_t*>(cell_offsets.GetDataPtr());
+    const int64_t* cell_order_ptr =
+            static_cast<const int64_t*>(cell_order.GetDataPtr());
+    double* weights_ptr = static_cast<double*>(weights.GetDataPtr());
+    double r_max2 = r_max * r_max;
+
+    DISPATCH_FLOAT32_FLOAT64_DTYPE(points.GetDtype(), [&]() {
+        const scalar_t* points_ptr =
+                static_cast<const scalar_t*>(points.GetDataPtr());
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+        core::kernel::CUDALauncher::LaunchGeneralKernel(
+                n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+#else
+        core::kernel::CPULauncher::LaunchGeneralKernel(
+                n, [&](int64_t workload_idx) {
+#endif
+                    double weight = 0;
+                    if (alive_ptr[workload_idx]) {
+                        ForEachRemainingNeighbor(
+                                workload_idx, points_ptr, alive_ptr,
+                                cell_ids_ptr, neighbor_cells_ptr,
+                                cell_offsets_ptr, cell_order_ptr, r_max2,
+                                [&](int64_t j, double d2) {
+                                    double d = std::sqrt(d2);
+                                    if (d < r_min) {
+                                        d = r_min;
+                                    }
+                                    weight += std::pow(1 - d / r_max, alpha);
+                                    return true;
+                                });
+                    }
+                    weights_ptr[workload_idx] = weight;
+                });
+    });
+}
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void FindEliminationCandidatesCUDA
+#else
+void FindEliminationCandidatesCPU
+#endif
+        (const core::Tensor& points,
+         const core::Tensor& alive,
+         const core::Tensor& weights,
+         const core::Tensor& cell_ids,
+         const core::Tensor& neighbor_cells,
+         const core::Tensor& cell_offsets,
+         const core::Tensor& cell_order,
+         double r_max,
+         core::Tensor& local_maxima) {
+    int64_t n = points.GetLength();
+    local_maxima =
+            core::Tensor::Empty({n}, core::Dtype::Bool, points.GetDevice());
+    const bool* alive_ptr = static_cast<const bool*>(alive.GetDataPtr());
+    const double* weights_ptr =
+            static_cast<const double*>(weights.GetDataPtr());
+    const int64_t* cell_ids_ptr =
+            static_cast<const int64_t*>(cell_ids.GetDataPtr());
+    const int64_t* neighbor_cells_ptr =
+            static_cast<const int64_t*>(neighbor_cells.GetDataPtr());
+    const int64_t* cell_offsets_ptr =
+            static_cast<const int64_t*>(cell_offsets.GetDataPtr());
+    const int64_t* cell_order_ptr =
+            static_cast<const int64_t*>(cell_order.GetDataPtr());
+    bool* local_maxima_ptr = static_cast<bool*>(local_maxima.GetDataPtr());
+    double r_max2 = r_max * r_max;
+
+    DISPATCH_FLOAT32_FLOAT64_DTYPE(points.GetDtype(), [&]() {
+        const scalar_t* points_ptr =
+                static_cast<const scalar_t*>(points.GetDataPtr());
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+        core::kernel::CUDALauncher::LaunchGeneralKernel(
+                n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+#else
+        core::kernel::CPULauncher::LaunchGeneralKernel(
+                n, [&](int64_t workload_idx) {
+#endif
+                    bool is_maximum = alive_ptr[workload_idx];
+                    if (is_maximum) {
+                        double weight = weights_ptr[workload_idx];
+                        ForEachRemainingNeighbor(
+                                workload_idx, points_ptr, alive_ptr,
+                                cell_ids_ptr, neighbor_cells_ptr,
+                                cell_offsets_ptr, cell_order_ptr, r_max2,
+                                [&](int64_t j, double d2) {
+                                    if (weights_ptr[j] > weight ||
+                                        (weights_ptr[j] == weight &&
+                                         j < workload_idx)) {
+                                        is_maximum = false;
+                                    }
+                                    return is_maximum;
+                                });
+                    }
+                    local_maxima_ptr[workload_idx] = is_maximum;
+                });
+    });
+}
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void ComputeNeighborWeightsCUDA
+#else
+void ComputeNeighborWeightsCPU
+#endif
+        (const core::Tensor& vertices,
+         const core::Tensor& neighbor_offsets,
+         const core::Tensor& neighbors,
+         core::Tensor& weights) {
+    int64_t n = vertices.GetLength();
+    weights = core::Tensor::Empty({neighbors.GetLength()}, core::Dtype::Float64,
+                                  vertices.GetDevice());
+    const int64_t* offsets_ptr =
+            static_cast<const int64_t*>(neighbor_offsets.GetDataPtr());
+    const int64_t* neighbors_ptr =
+            static_cast<const int64_t*>(neighbors.GetDataPtr());
+    double* weights_ptr = static_cast<double*>(weights.GetDataPtr());
+
+    DISPATCH_FLOAT32_FLOAT64_DTYPE(vertices.GetDtype(), [&]() {
+        const scalar_t* vertices_ptr =
+                static_cast<const scalar_t*>(vertices.GetDataPtr());
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+        core::kernel::CUDALauncher::LaunchGeneralKernel(
+                n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+#else
+        core::kernel::CPULauncher::LaunchGeneralKernel(
+                n, [&](int64_t workload_idx) {
+#endif
+                    const scalar_t* v = vertices_ptr + 3 * workload_idx;
+                    for (int64_t k = offsets_ptr[workload_idx];
+                         k < offsets_ptr[workload_idx + 1]; ++k) {
+                        const scalar_t* u = vertices_ptr + 3 * neighbors_ptr[k];
+                        double dx = double(v[0]) - double(u[0]);
+                        double dy = double(v[1]) - double(u[1]);
+                        double dz = double(v[2]) - double(u[2]);
+                        double dist = sqrt(dx * dx + dy * dy + dz * dz);
+                        weights_ptr[k] = 1. / (dist + 1e-12);
+                    }
+                });
+    });
+}
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void FilterVertexAttrCUDA
+#else
+void FilterVertexAttrCPU
+#endif
+        (const core::Tensor& src,
+         const core::Tensor& neighbor_offsets,
+         const core::Tensor& neighbors,
+         const core::Tensor& weights,
+         NeighborFilter filter,
+         double strength,
+         core::Tensor& dst) {
+    int64_t n = src.GetLength();
+    dst = core::Tensor::Empty(src.GetShape(), src.GetDtype(), src.GetDevice());
+    const int64_t* offsets_ptr =
+            static_cast<const int64_t*>(neighbor_offsets.GetDataPtr());
+    const int64_t* neighbors_ptr =
+            static_cast<const int64_t*>(neighbors.GetDataPtr());
+    const double* weights_ptr =
+            weights.NumElements() > 0
+                    ? static_cast<const double*>(weights.GetDataPtr())
+                    : nullptr;
+
+    DISPATCH_FLOAT32_FLOAT64_DTYPE(src.GetDtype(), [&]() {
+        const scalar_t* src_ptr =
+                static_cast<const scalar_t*>(src.GetDataPtr());
+        scalar_t* dst_ptr = static_cast<scalar_t*>(dst.GetDataPtr());
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+        core::kernel::CUDALauncher::LaunchGeneralKernel(
+                n * 3, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+#else
+        core::kernel::CPULauncher::LaunchGeneralKernel(
+                n * 3, [&](int64_t workload_idx) {
+#endif
+                    int64_t vidx = workload_idx / 3;
+                    int64_t channel = workload_idx % 3;
+                    double sum = 0;
+                    double total_weight = 0;
+                    for (int64_t k = offsets_ptr[vidx];
+                         k < offsets_ptr[vidx + 1]; ++k) {
+                        double weight = weights_ptr ? weights_ptr[k] : 1.0;
+                        sum += weight *
+                               double(src_ptr[3 * neighbors_ptr[k] + channel]);
+                        total_weight += weight;
+                    }
+                    double value = double(src_ptr[workload_idx]);
+                    if (filter == NeighborFilter::Sharpen) {
+                        value += strength * (value * total_weight - sum);
+                    } else if (filter == NeighborFilter::Simple) {
+                        value = (value + sum) / (1 + total_weight);
+                    } else if (total_weight > 0) {
+                        value += strength * (sum / total_weight - value);
+                    }
+                    dst_ptr[workload_idx] = static_cast<scalar_t>(value);
+                });
+    });
+}
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void ComputeTriangleEdgesCUDA
+#else
+void ComputeTriangleEdgesCPU
+#endif
+        (const core::Tensor& triangles, core::Tensor& edges) {
+    int64_t n = triangles.GetLength() * 3;
+    edges = core::Tensor::Empty({n, 2}, core::Dtype::Int64,
+                                triangles.GetDevice());
+    const int64_t* triangles_ptr =
+            static_cast<const int64_t*>(triangles.GetDataPtr());
+    int64_t* edges_ptr = static_cast<int64_t*>(edges.GetDataPtr());
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+    core::kernel::CUDALauncher::LaunchGeneralKernel(
+            n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+#else
+    core::kernel::CPULauncher::LaunchGeneralKernel(
+            n, [&](int64_t workload_idx) {
+#endif
+                int64_t first = workload_idx - workload_idx % 3;
+                int64_t v0 = triangles_ptr[workload_idx];
+                int64_t v1 = triangles_ptr[first + (workload_idx + 1) % 3];
+                edges_ptr[2 * workload_idx] = v0 < v1 ? v0 : v1;
+                edges_ptr[2 * workload_idx + 1] = v0 < v1 ? v1 : v0;
+            });
+}
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+bool HookComponentsCUDA
+#else
+bool HookComponentsCPU
+#endif
+        (const core::Tensor& links,
+         const core::Tensor& labels,
+         core::Tensor& parents) {
+    int64_t k = links.GetShape(1);
+    int64_t n = links.GetLength() * k;
+    core::Tensor num_hooked = core::Tensor::Zeros({1}, core::Dtype::Int64,
+                                                  links.GetDevice());
+    const int64_t* links_ptr = static_cast<const int64_t*>(links.GetDataPtr());
+    const int64_t* labels_ptr =
+            static_cast<const int64_t*>(labels.GetDataPtr());
+    // Labels are non-negative, so they compare the same as unsigned.
+    uint64_t* parents_ptr = static_cast<uint64_t*>(parents.GetDataPtr());
+    uint64_t* num_hooked_ptr = static_cast<uint64_t*>(num_hooked.GetDataPtr());
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+    core::kernel::CUDALauncher::LaunchGeneralKernel(
+            n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+#else
+    core::kernel::CPULauncher::LaunchGeneralKernel(
+            n, [&](int64_t workload_idx) {
+#endif
+                int64_t a = labels_ptr[workload_idx / k];
+                int64_t b = labels_ptr[links_ptr[workload_idx]];
+                if (a == b) {
+                    return;
+                }
+                uint64_t root = uint64_t(a < b ? b : a);
+                uint64_t target = uint64_t(a < b ? a : b);
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+                atomicMin(reinterpret_cast<unsigned long long*>(parents_ptr +
+                                                                root),
+                          static_cast<unsigned long long>(target));
+                atomicAdd(reinterpret_cast<unsigned long long*>(num_hooked_ptr),
+                          1ull);
+#else
+                core::AtomicFetchMinRelaxed(parents_ptr + root, target);
+                core::AtomicFetchAddRelaxed(num_hooked_ptr, uint64_t(1));
+#endif
+            });
+    return num_hooked.Item<int64_t>() > 0;
+}
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void CompressComponentsCUDA
+#else
+void CompressComponentsCPU
+#endif
+        (const core::Tensor& parents, core::Tensor& labels) {
+    int64_t n = parents.GetLength();
+    const int64_t* parents_ptr =
+            static_cast<const int64_t*>(parents.GetDataPtr());
+    int64_t* labels_ptr = static_cast<int64_t*>(labels.GetDataPtr());
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+    core::kernel::CUDALauncher::LaunchGeneralKernel(
+            n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+#else
+    core::kernel::CPULauncher::LaunchGeneralKernel(
+            n, [&](int64_t workload_idx) {
+#endif
+                int64_t root = workload_idx;
+                while (parents_ptr[root] != root) {
+                    root = parents_ptr[root];
+                }
+                labels_ptr[workload_idx] = root;
+            });
+}
+
+}  // namespace trianglemesh
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,110 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/kernel/VoxelGrid.h"
+
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+namespace voxel_grid {
+
+void VoxelizeTriangles(const core::Tensor& vertices,
+                       const core::Tensor& triangles,
+                       const core::Tensor& origin,
+                       float voxel_size,
+                       core::Tensor& voxel_keys) {
+    core::Device device = vertices.GetDevice();
+    if (triangles.GetDevice() != device) {
+        utility::LogError(
+                "Incompatible device type for vertices and triangles");
+    }
+    vertices.AssertDtype(core::Dtype::Float32);
+    triangles.AssertDtype(core::Dtype::Int64);
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        VoxelizeTrianglesCPU(vertices, triangles, origin, voxel_size,
+                             voxel_keys);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        VoxelizeTrianglesCUDA(vertices, triangles, origin, voxel_size,
+                              voxel_keys);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void Carve(const core::Tensor& voxel_keys,
+           const core::Tensor& image,
+           const core::Tensor& intrinsics,
+           const core::Tensor& extrinsics,
+           const core::Tensor& origin,
+           float voxel_size,
+           bool depth_test,
+           bool keep_voxels_outside_image,
+           core::Tensor& keep_mask) {
+    core::Device device = voxel_keys.GetDevice();
+    if (image.GetDevice() != device) {
+        utility::LogError("Incompatible device type for image and voxel grid");
+    }
+    voxel_keys.AssertDtype(core::Dtype::Int32);
+    image.AssertDtype(core::Dtype::Float32);
+
+    // Camera parameters are read on host.
+    core::Tensor intrinsicsf32 = intrinsics.To(core::Dtype::Float32)
+                                         .Copy(core::Device("CPU:0"));
+    core::Tensor extrinsicsf32 = extrinsics.To(core::Dtype::Float32)
+                                         .Copy(core::Device("CPU:0"));
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        CarveCPU(voxel_keys, image, intrinsicsf32, extrinsicsf32, origin,
+                 voxel_size, depth_test, keep_voxels_outside_image, keep_mask);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        CarveCUDA(voxel_keys, image, intrinsicsf32, extrinsicsf32, origin,
+                  voxel_size, depth_test, keep_voxels_outside_image,
+                  keep_mask);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+}  // namespace voxel_grid
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,122 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+namespace voxel_grid {
+
+/// Finds the voxels intersected by triangles. Each triangle is tested against
+/// every voxel of its bounding box with the separating axis theorem, with one
+/// workload per (triangle, voxel) pair so that large triangles do not
+/// serialize a thread.
+///
+/// \param vertices Float32 tensor of shape {n, 3}.
+/// \param triangles Int64 tensor of shape {m, 3}.
+/// \param origin Float32 tensor of shape {3} on host, the corner of voxel
+/// (0, 0, 0).
+/// \param voxel_size Edge length of the voxels.
+/// \param voxel_keys Output Int32 tensor of shape {k, 3} with the coordinates
+/// of the intersected voxels, with duplicates across triangles.
+void VoxelizeTriangles(const core::Tensor& vertices,
+                       const core::Tensor& triangles,
+                       const core::Tensor& origin,
+                       float voxel_size,
+                       core::Tensor& voxel_keys);
+
+void VoxelizeTrianglesCPU(const core::Tensor& vertices,
+                          const core::Tensor& triangles,
+                          const core::Tensor& origin,
+                          float voxel_size,
+                          core::Tensor& voxel_keys);
+
+#ifdef BUILD_CUDA_MODULE
+void VoxelizeTrianglesCUDA(const core::Tensor& vertices,
+                           const core::Tensor& triangles,
+                           const core::Tensor& origin,
+                           float voxel_size,
+                           core::Tensor& voxel_keys);
+#endif
+
+/// Decides which voxels survive carving by an image: a voxel is kept if one
+/// of its 8 corners projects into the image where the bilinearly
+/// interpolated value is positive and, for depth maps, not farther than the
+/// corner. Corners outside the image keep the voxel if
+/// \p keep_voxels_outside_image is set.
+///
+/// \param voxel_keys Int32 tensor of shape {n, 3}.
+/// \param image Float32 tensor of shape {rows, cols, 1}, a depth map in
+/// meters or a silhouette mask.
+/// \param intrinsics Float32 tensor of shape {3, 3}.
+/// \param extrinsics Float32 tensor of shape {4, 4}, world to camera.
+/// \param origin Float32 tensor of shape {3} on host.
+/// \param voxel_size Edge length of the voxels.
+/// \param depth_test Compare the corner depth with the image value, for depth
+/// maps.
+/// \param keep_voxels_outside_image Keep the voxels seen outside the image.
+/// \param keep_mask Output Bool tensor of shape {n}.
+void Carve(const core::Tensor& voxel_keys,
+           const core::Tensor& image,
+           const core::Tensor& intrinsics,
+           const core::Tensor& extrinsics,
+           const core::Tensor& origin,
+           float voxel_size,
+           bool depth_test,
+           bool keep_voxels_outside_image,
+           core::Tensor& keep_mask);
+
+void CarveCPU(const core::Tensor& voxel_keys,
+              const core::Tensor& image,
+              const core::Tensor& intrinsics,
+              const core::Tensor& extrinsics,
+              const core::Tensor& origin,
+              float voxel_size,
+              bool depth_test,
+              bool keep_voxels_outside_image,
+              core::Tensor& keep_mask);
+
+#ifdef BUILD_CUDA_MODULE
+void CarveCUDA(const core::Tensor& voxel_keys,
+               const core::Tensor& image,
+               const core::Tensor& intrinsics,
+               const core::Tensor& extrinsics,
+               const core::Tensor& origin,
+               float voxel_size,
+               bool depth_test,
+               bool keep_voxels_outside_image,
+               core::Tensor& keep_mask);
+#endif
+
+}  // namespace voxel_grid
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
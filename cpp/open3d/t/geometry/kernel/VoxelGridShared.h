@@ -0,0 +1,328 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <atomic>
+#include <cmath>
+#include <numeric>
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+#include <thrust/execution_policy.h>
+#include <thrust/scan.h>
+#endif
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/kernel/GeometryIndexer.h"
+#include "open3d/t/geometry/kernel/GeometryMacros.h"
+#include "open3d/t/geometry/kernel/VoxelGrid.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+namespace voxel_grid {
+
+// Range of the voxels overlapped by the bounding box of a triangle, inclusive.
+OPEN3D_HOST_DEVICE inline void TriangleVoxelBounds(const float* vertices_ptr,
+                                                   const int64_t* triangle,
+                                                   const float* origin,
+                                                   float voxel_size,
+                                                   int* lo,
+                                                   int* hi) {
+    for (int c = 0; c < 3; ++c) {
+        float v0 = vertices_ptr[3 * triangle[0] + c];
+        float v1 = vertices_ptr[3 * triangle[1] + c];
+        float v2 = vertices_ptr[3 * triangle[2] + c];
+        float v_min = v0 < v1 ? (v0 < v2 ? v0 : v2) : (v1 < v2 ? v1 : v2);
+        float v_max = v0 > v1 ? (v0 > v2 ? v0 : v2) : (v1 > v2 ? v1 : v2);
+        lo[c] = static_cast<int>(floorf((v_min - origin[c]) / voxel_size));
+        hi[c] = static_cast<int>(floorf((v_max - origin[c]) / voxel_size));
+    }
+}
+
+// Whether the projections on an axis of a triangle, relative to the center of
+// a box, and of the box are disjoint.
+OPEN3D_HOST_DEVICE inline bool SeparatedOnAxis(const float (*v)[3],
+                                               const float* axis,
+                                               float half_size) {
+    float p0 = v[0][0] * axis[0] + v[0][1] * axis[1] + v[0][2] * axis[2];
+    float p1 = v[1][0] * axis[0] + v[1][1] * axis[1] + v[1][2] * axis[2];
+    float p2 = v[2][0] * axis[0] + v[2][1] * axis[1] + v[2][2] * axis[2];
+    float p_min = p0 < p1 ? (p0 < p2 ? p0 : p2) : (p1 < p2 ? p1 : p2);
+    float p_max = p0 > p1 ? (p0 > p2 ? p0 : p2) : (p1 > p2 ? p1 : p2);
+    float r = half_size * (fabsf(axis[0]) + fabsf(axis[1]) + fabsf(axis[2]));
+    return p_min > r || p_max < -r;
+}
+
+// Separating axis test of a triangle, relative to the center of a cube, with
+// the cube: the 3 face normals of the cube, the normal of the triangle and
+// the 9 cross products of their edges. Touching counts as intersecting, as in
+// IntersectionTest::TriangleAABB.
+OPEN3D_HOST_DEVICE inline bool TriangleIntersectsCube(const float (*v)[3],
+                                                      float half_size) {
+    float edges[3][3];
+    for (int e = 0; e < 3; ++e) {
+        for (int c = 0; c < 3; ++c) {
+            edges[e][c] = v[(e + 1) % 3][c] - v[e][c];
+        }
+    }
+
+    float axis[3];
+    for (int c = 0; c < 3; ++c) {
+        axis[0] = axis[1] = axis[2] = 0;
+        axis[c] = 1;
+        if (SeparatedOnAxis(v, axis, half_size)) {
+            return false;
+        }
+    }
+
+    axis[0] = edges[0][1] * edges[1][2] - edges[0][2] * edges[1][1];
+    axis[1] = edges[0][2] * edges[1][0] - edges[0][0] * edges[1][2];
+    axis[2] = edges[0][0] * edges[1][1] - edges[0][1] * edges[1][0];
+    if (SeparatedOnAxis(v, axis, half_size)) {
+        return false;
+    }
+
+    // Cross products of the unit axis c with the edges.
+    for (int c = 0; c < 3; ++c) {
+        int c1 = (c + 1) % 3;
+        int c2 = (c + 2) % 3;
+        for (int e = 0; e < 3; ++e) {
+            axis[c] = 0;
+            axis[c1] = -edges[e][c2];
+            axis[c2] = edges[e][c1];
+            if (SeparatedOnAxis(v, axis, half_size)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// Bilinear interpolation of a single channel image, following
+// geometry::Image::FloatValueAt. Returns false outside the image.
+OPEN3D_HOST_DEVICE inline bool FloatValueAt(const float* image_ptr,
+                                            int64_t rows,
+                                            int64_t cols,
+                                            float u,
+                                            float v,
+                                            float* value) {
+    if (u < 0 || u > cols - 1 || v < 0 || v > rows - 1) {
+        return false;
+    }
+    int64_t ui = static_cast<int64_t>(u);
+    int64_t vi = static_cast<int64_t>(v);
+    ui = ui > cols - 2 ? cols - 2 : ui;
+    vi = vi > rows - 2 ? rows - 2 : vi;
+    ui = ui < 0 ? 0 : ui;
+    vi = vi < 0 ? 0 : vi;
+    float pu = u - ui;
+    float pv = v - vi;
+    const float* row0 = image_ptr + vi * cols;
+    const float* row1 = row0 + cols;
+    *value = (row0[ui] * (1 - pv) + row1[ui] * pv) * (1 - pu) +
+             (row0[ui + 1] * (1 - pv) + row1[ui + 1] * pv) * pu;
+    return true;
+}
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void VoxelizeTrianglesCUDA
+#else
+void VoxelizeTrianglesCPU
+#endif
+        (const core::Tensor& vertices,
+         const core::Tensor& triangles,
+         const core::Tensor& origin,
+         float voxel_size,
+         core::Tensor& voxel_keys) {
+    core::Device device = vertices.GetDevice();
+    int64_t m = triangles.GetLength();
+    const float* vertices_ptr =
+            static_cast<const float*>(vertices.Contiguous().GetDataPtr());
+    core::Tensor triangles_contiguous = triangles.Contiguous();
+    const int64_t* triangles_ptr =
+            static_cast<const int64_t*>(triangles_contiguous.GetDataPtr());
+    float o0 = origin[0].Item<float>();
+    float o1 = origin[1].Item<float>();
+    float o2 = origin[2].Item<float>();
+
+    // Offsets of the candidate voxels of each triangle.
+    core::Tensor offsets =
+            core::Tensor::Zeros({m + 1}, core::Dtype::Int64, device);
+    int64_t* offsets_ptr = static_cast<int64_t*>(offsets.GetDataPtr());
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+    core::kernel::CUDALauncher::LaunchGeneralKernel(
+            m, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+#else
+    core::kernel::CPULauncher::LaunchGeneralKernel(
+            m, [&](int64_t workload_idx) {
+#endif
+                float o[3] = {o0, o1, o2};
+                int lo[3], hi[3];
+                TriangleVoxelBounds(vertices_ptr,
+                                    triangles_ptr + 3 * workload_idx, o,
+                                    voxel_size, lo, hi);
+                offsets_ptr[workload_idx + 1] =
+                        int64_t(hi[0] - lo[0] + 1) * (hi[1] - lo[1] + 1) *
+                        (hi[2] - lo[2] + 1);
+            });
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+    thrust::inclusive_scan(thrust::device, offsets_ptr + 1,
+                           offsets_ptr + m + 1, offsets_ptr + 1);
+#else
+    std::partial_sum(offsets_ptr + 1, offsets_ptr + m + 1, offsets_ptr + 1);
+#endif
+    int64_t num_candidates = offsets[m].Item<int64_t>();
+
+    voxel_keys = core::Tensor::Empty({num_candidates, 3}, core::Dtype::Int32,
+                                     device);
+    int* keys_ptr = static_cast<int*>(voxel_keys.GetDataPtr());
+
+    // Counter
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+    core::Tensor count(std::vector<int>{0}, {}, core::Dtype::Int32, device);
+    int* count_ptr = static_cast<int*>(count.GetDataPtr());
+#else
+    std::atomic<int> count_atomic(0);
+    std::atomic<int>* count_ptr = &count_atomic;
+#endif
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+    core::kernel::CUDALauncher::LaunchGeneralKernel(
+            num_candidates, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+#else
+    core::kernel::CPULauncher::LaunchGeneralKernel(
+            num_candidates, [&](int64_t workload_idx) {
+#endif
+                // The last triangle whose candidates start at or before the
+                // workload. Every triangle has at least one candidate.
+                int64_t lo_t = 0;
+                int64_t hi_t = m - 1;
+                while (lo_t < hi_t) {
+                    int64_t mid = (lo_t + hi_t + 1) / 2;
+                    if (offsets_ptr[mid] <= workload_idx) {
+                        lo_t = mid;
+                    } else {
+                        hi_t = mid - 1;
+                    }
+                }
+
+                float o[3] = {o0, o1, o2};
+                const int64_t* triangle = triangles_ptr + 3 * lo_t;
+                int lo[3], hi[3];
+                TriangleVoxelBounds(vertices_ptr, triangle, o, voxel_size, lo,
+                                    hi);
+                int64_t local = workload_idx - offsets_ptr[lo_t];
+                int64_t nx = hi[0] - lo[0] + 1;
+                int64_t ny = hi[1] - lo[1] + 1;
+                int key[3] = {lo[0] + static_cast<int>(local % nx),
+                              lo[1] + static_cast<int>((local / nx) % ny),
+                              lo[2] + static_cast<int>(local / (nx * ny))};
+
+                float v[3][3];
+                for (int i = 0; i < 3; ++i) {
+                    for (int c = 0; c < 3; ++c) {
+                        v[i][c] = vertices_ptr[3 * triangle[i] + c] - o[c] -
+                                  (key[c] + 0.5f) * voxel_size;
+                    }
+                }
+                if (TriangleIntersectsCube(v, 0.5f * voxel_size)) {
+                    int idx = OPEN3D_ATOMIC_ADD(count_ptr, 1);
+                    keys_ptr[3 * idx + 0] = key[0];
+                    keys_ptr[3 * idx + 1] = key[1];
+                    keys_ptr[3 * idx + 2] = key[2];
+                }
+            });
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+    int total_count = count.Item<int>();
+#else
+    int total_count = (*count_ptr).load();
+#endif
+    voxel_keys = voxel_keys.Slice(0, 0, total_count);
+}
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void CarveCUDA
+#else
+void CarveCPU
+#endif
+        (const core::Tensor& voxel_keys,
+         const core::Tensor& image,
+         const core::Tensor& intrinsics,
+         const core::Tensor& extrinsics,
+         const core::Tensor& origin,
+         float voxel_size,
+         bool depth_test,
+         bool keep_voxels_outside_image,
+         core::Tensor& keep_mask) {
+    core::Device device = voxel_keys.GetDevice();
+    int64_t n = voxel_keys.GetLength();
+    core::Tensor keys_contiguous = voxel_keys.Contiguous();
+    const int* keys_ptr = static_cast<const int*>(keys_contiguous.GetDataPtr());
+    core::Tensor image_contiguous = image.Contiguous();
+    const float* image_ptr =
+            static_cast<const float*>(image_contiguous.GetDataPtr());
+    int64_t rows = image.GetShape(0);
+    int64_t cols = image.GetShape(1);
+    TransformIndexer ti(intrinsics, extrinsics, 1.0f);
+    float o0 = origin[0].Item<float>();
+    float o1 = origin[1].Item<float>();
+    float o2 = origin[2].Item<float>();
+
+    keep_mask = core::Tensor::Empty({n}, core::Dtype::Bool, device);
+    bool* keep_ptr = static_cast<bool*>(keep_mask.GetDataPtr());
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+    core::kernel::CUDALauncher::LaunchGeneralKernel(
+            n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+#else
+    core::kernel::CPULauncher::LaunchGeneralKernel(
+            n, [&](int64_t workload_idx) {
+#endif
+                const int* key = keys_ptr + 3 * workload_idx;
+                bool keep = false;
+                for (int corner = 0; corner < 8 && !keep; ++corner) {
+                    float x = o0 + (key[0] + (corner & 1)) * voxel_size;
+                    float y = o1 + (key[1] + ((corner >> 1) & 1)) * voxel_size;
+                    float z = o2 + (key[2] + ((corner >> 2) & 1)) * voxel_size;
+                    float x_c, y_c, z_c, u, v, d;
+                    ti.RigidTransform(x, y, z, &x_c, &y_c, &z_c);
+                    ti.Project(x_c, y_c, z_c, &u, &v);
+                    bool in_image =
+                            FloatValueAt(image_ptr, rows, cols, u, v, &d);
+                    keep = (!in_image && keep_voxels_outside_image) ||
+                           (in_image && d > 0 && (!depth_test || z_c >= d));
+                }
+                keep_ptr[workload_idx] = keep;
+            });
+}
+
+}  // namespace voxel_grid
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,108 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/t/io/ImageIO.h"
+
+#include <functional>
+#include <unordered_map>
+
+#include "open3d/utility/Console.h"
+#include "open3d/utility/FileSystem.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+static const std::unordered_map<
+        std::string,
+        std::function<bool(const std::string &, geometry::Image &)>>
+        file_extension_to_image_read_into_function{
+                {"png", ReadImageIntoFromPNG},
+                {"jpg", ReadImageIntoFromJPG},
+                {"jpeg", ReadImageIntoFromJPG},
+        };
+
+static bool IsImageBufferReusable(const geometry::Image &image,
+                                  int64_t rows,
+                                  int64_t cols,
+                                  int64_t channels,
+                                  core::Dtype dtype) {
+    const core::Tensor &tensor = image.AsTensor();
+    return tensor.GetShape() == core::SizeVector{rows, cols, channels} &&
+           tensor.GetDtype() == dtype && tensor.IsContiguous();
+}
+
+core::Tensor GetImageDecodeBuffer(const geometry::Image &image,
+                                  int64_t rows,
+                                  int64_t cols,
+                                  int64_t channels,
+                                  core::Dtype dtype) {
+    if (image.GetDevice() == core::Device("CPU:0") &&
+        IsImageBufferReusable(image, rows, cols, channels, dtype)) {
+        return image.AsTensor();
+    }
+    return core::Tensor({rows, cols, channels}, dtype);
+}
+
+void SetImageFromDecodeBuffer(const core::Tensor &buffer,
+                              geometry::Image &image) {
+    core::Tensor tensor = image.AsTensor();
+    if (buffer.GetDataPtr() == tensor.GetDataPtr()) {
+        return;
+    }
+    const core::SizeVector &shape = buffer.GetShape();
+    if (IsImageBufferReusable(image, shape[0], shape[1], shape[2],
+                              buffer.GetDtype())) {
+        tensor.CopyFrom(buffer);
+    } else if (image.GetDevice() == buffer.GetDevice()) {
+        image = geometry::Image(buffer);
+    } else {
+        image = geometry::Image(buffer.Copy(image.GetDevice()));
+    }
+}
+
+bool ReadImageInto(const std::string &filename, geometry::Image &image) {
+    std::string filename_ext =
+            utility::filesystem::GetFileExtensionInLowerCase(filename);
+    auto map_itr =
+            file_extension_to_image_read_into_function.find(filename_ext);
+    if (map_itr != file_extension_to_image_read_into_function.end()) {
+        return map_itr->second(filename, image);
+    }
+
+    open3d::geometry::Image legacy_image;
+    if (!open3d::io::ReadImage(filename, legacy_image)) {
+        return false;
+    }
+    SetImageFromDecodeBuffer(
+            geometry::Image::FromLegacyImage(legacy_image).AsTensor(), image);
+    return true;
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
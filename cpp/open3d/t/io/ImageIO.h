@@ -0,0 +1,70 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <string>
+
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/io/ImageIO.h"
+#include "open3d/t/geometry/Image.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+/// Reads an image from a file into \p image, on the device of \p image.
+///
+/// PNG and JPG files are decoded straight into the tensor of \p image, which
+/// is reused when its shape and dtype match the file, as for a sequence of
+/// frames of the same size. 16-bit PNG files give UInt16 images, other files
+/// UInt8 images. Other formats are read with open3d::io::ReadImage.
+///
+/// \return return true if the read function is successful, false otherwise.
+bool ReadImageInto(const std::string &filename, geometry::Image &image);
+
+bool ReadImageIntoFromPNG(const std::string &filename, geometry::Image &image);
+
+bool ReadImageIntoFromJPG(const std::string &filename, geometry::Image &image);
+
+/// Returns a contiguous CPU tensor of shape {rows, cols, channels} to decode
+/// an image into: the tensor of \p image if it matches, otherwise a new one.
+core::Tensor GetImageDecodeBuffer(const geometry::Image &image,
+                                  int64_t rows,
+                                  int64_t cols,
+                                  int64_t channels,
+                                  core::Dtype dtype);
+
+/// Stores the decoded \p buffer in \p image, copying it to the device of
+/// \p image, in place when its tensor matches.
+void SetImageFromDecodeBuffer(const core::Tensor &buffer,
+                              geometry::Image &image);
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -28,12 +28,16 @@
 
 #include <iostream>
 #include <unordered_map>
+#include <unordered_set>
 
+#include "open3d/io/ByteSource.h"
+#include "open3d/io/CompressedFileIO.h"
 #include "open3d/io/PointCloudIO.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Helper.h"
 #include "open3d/utility/ProgressReporters.h"
+#include "open3d/utility/Trace.h"
 
 namespace open3d {
 namespace t {
@@ -47,6 +51,8 @@ static const std::unordered_map<
         file_extension_to_pointcloud_read_function{
                 {"xyzi", ReadPointCloudFromXYZI},
                 {"ply", ReadPointCloudFromPLY},
+                {"pcd", ReadPointCloudFromPCD},
+                {"o3dt", ReadPointCloudFromO3DT},
         };
 
 static const std::unordered_map<
@@ -57,6 +63,8 @@ static const std::unordered_map<
         file_extension_to_pointcloud_write_function{
                 {"xyzi", WritePointCloudToXYZI},
                 {"ply", WritePointCloudToPLY},
+                {"pcd", WritePointCloudToPCD},
+                {"o3dt", WritePointCloudToO3DT},
         };
 
 std::shared_ptr<geometry::PointCloud> CreatetPointCloudFromFile(
@@ -68,12 +76,49 @@ std::shared_ptr<geometry::PointCloud> CreatetPointCloudFromFile(
     return pointcloud;
 }
 
+/// Formats whose readers fetch the parts of files given by URL they need.
+/// Files of other formats are downloaded first.
+static const std::unordered_set<std::string> ranged_read_formats{"ply", "pcd",
+                                                                 "o3dt"};
+
+/// Formats whose readers, or the legacy readers they fall back to, decompress
+/// compressed files on the fly. Other compressed files are decompressed into a
+/// temporary file first.
+static const std::unordered_set<std::string> streamed_compressed_formats{
+        "xyz", "xyzn", "xyzrgb", "xyzi"};
+
 bool ReadPointCloud(const std::string &filename,
                     geometry::PointCloud &pointcloud,
                     const open3d::io::ReadPointCloudOption &params) {
+    OPEN3D_TRACE_SCOPE("t::io::ReadPointCloud");
+    if (open3d::io::IsURL(filename)) {
+        std::string format =
+                params.format == "auto"
+                        ? open3d::io::GetPathExtensionInLowerCase(filename)
+                        : params.format;
+        if (ranged_read_formats.count(format) == 0) {
+            return open3d::io::ReadRemoteFile(
+                    filename, [&](const std::string &path) {
+                        return ReadPointCloud(path, pointcloud, params);
+                    });
+        }
+    }
     std::string format = params.format;
     if (format == "auto") {
-        format = utility::filesystem::GetFileExtensionInLowerCase(filename);
+        format = open3d::io::GetPathExtensionInLowerCase(filename);
+    }
+    std::string compression = open3d::io::GetFileCompression(filename);
+    if (!compression.empty() && format == compression) {
+        format = utility::filesystem::GetFileExtensionInLowerCase(
+                utility::filesystem::GetFileNameWithoutExtension(filename));
+        if (streamed_compressed_formats.count(format) == 0) {
+            return open3d::io::ReadCompressedFile(
+                    filename, [&](const std::string &path) {
+                        open3d::io::ReadPointCloudOption inner_params = params;
+                        inner_params.format = "auto";
+                        return ReadPointCloud(path, pointcloud, inner_params);
+                    });
+        }
     }
 
     utility::LogDebug("Format {} File {}", params.format, filename);
@@ -127,6 +172,13 @@ bool ReadPointCloud(const std::string &filename,
 bool WritePointCloud(const std::string &filename,
                      const geometry::PointCloud &pointcloud,
                      const open3d::io::WritePointCloudOption &params) {
+    OPEN3D_TRACE_SCOPE("t::io::WritePointCloud");
+    if (!open3d::io::GetFileCompression(filename).empty()) {
+        return open3d::io::WriteCompressedFile(
+                filename, [&](const std::string &path) {
+                    return WritePointCloud(path, pointcloud, params);
+                });
+    }
     std::string format =
             utility::filesystem::GetFileExtensionInLowerCase(filename);
     auto map_itr = file_extension_to_pointcloud_write_function.find(format);
@@ -47,6 +47,10 @@ std::shared_ptr<geometry::PointCloud> CreatetPointCloudFromFile(
 
 /// The general entrance for reading a PointCloud from a file
 /// The function calls read functions based on the extension name of filename.
+/// Files given by URL, e.g. "http://host/scan.pcd", are opened with
+/// open3d::io::OpenByteSource(). The PLY, PCD and O3DT readers fetch the
+/// header and the data they need with parallel range reads, and files of
+/// other formats are downloaded first.
 /// See \p ReadPointCloudOption for additional options you can pass.
 /// \return return true if the read function is successful, false otherwise.
 bool ReadPointCloud(const std::string &filename,
@@ -77,6 +81,24 @@ bool WritePointCloudToPLY(const std::string &filename,
                           const geometry::PointCloud &pointcloud,
                           const WritePointCloudOption &params);
 
+bool ReadPointCloudFromPCD(const std::string &filename,
+                           geometry::PointCloud &pointcloud,
+                           const ReadPointCloudOption &params);
+
+bool WritePointCloudToPCD(const std::string &filename,
+                          const geometry::PointCloud &pointcloud,
+                          const WritePointCloudOption &params);
+
+/// Reads an .o3dt file onto the device of \p pointcloud. Uncompressed
+/// attributes read on the CPU are views of the memory mapped file.
+bool ReadPointCloudFromO3DT(const std::string &filename,
+                            geometry::PointCloud &pointcloud,
+                            const ReadPointCloudOption &params);
+
+bool WritePointCloudToO3DT(const std::string &filename,
+                           const geometry::PointCloud &pointcloud,
+                           const WritePointCloudOption &params);
+
 }  // namespace io
 }  // namespace t
 }  // namespace open3d
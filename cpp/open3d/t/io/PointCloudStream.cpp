@@ -0,0 +1,836 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/t/io/PointCloudStream.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/Helper.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+/// Returns the dtype of a PLY scalar type name with its size in bytes. Types
+/// without a tensor dtype are Undefined, and lists have size 0.
+static core::Dtype GetDtypeFromPLYType(const std::string &type,
+                                       int64_t &byte_size) {
+    static const std::unordered_map<std::string,
+                                    std::pair<core::Dtype, int64_t>>
+            types = {{"int8", {core::Dtype::Undefined, 1}},
+                     {"char", {core::Dtype::Undefined, 1}},
+                     {"uint8", {core::Dtype::UInt8, 1}},
+                     {"uchar", {core::Dtype::UInt8, 1}},
+                     {"int16", {core::Dtype::Int16, 2}},
+                     {"short", {core::Dtype::Int16, 2}},
+                     {"uint16", {core::Dtype::UInt16, 2}},
+                     {"ushort", {core::Dtype::UInt16, 2}},
+                     {"int32", {core::Dtype::Int32, 4}},
+                     {"int", {core::Dtype::Int32, 4}},
+                     {"uint32", {core::Dtype::Undefined, 4}},
+                     {"uint", {core::Dtype::Undefined, 4}},
+                     {"float32", {core::Dtype::Float32, 4}},
+                     {"float", {core::Dtype::Float32, 4}},
+                     {"float64", {core::Dtype::Float64, 8}},
+                     {"double", {core::Dtype::Float64, 8}}};
+    auto it = types.find(type);
+    if (it == types.end()) {
+        byte_size = 0;
+        return core::Dtype::Undefined;
+    }
+    byte_size = it->second.second;
+    return it->second.first;
+}
+
+static std::string GetPLYTypeFromDtype(const core::Dtype &dtype) {
+    if (dtype == core::Dtype::UInt8) {
+        return "uchar";
+    } else if (dtype == core::Dtype::Int16) {
+        return "short";
+    } else if (dtype == core::Dtype::UInt16) {
+        return "ushort";
+    } else if (dtype == core::Dtype::Int32) {
+        return "int";
+    } else if (dtype == core::Dtype::Float32) {
+        return "float";
+    } else if (dtype == core::Dtype::Float64) {
+        return "double";
+    } else {
+        return "";
+    }
+}
+
+/// Returns the dtype of a PCD field of the given type and size.
+static core::Dtype GetDtypeFromPCDType(char type, int64_t size) {
+    if (type == 'F' && size == 4) {
+        return core::Dtype::Float32;
+    } else if (type == 'F' && size == 8) {
+        return core::Dtype::Float64;
+    } else if (type == 'U' && size == 1) {
+        return core::Dtype::UInt8;
+    } else if (type == 'U' && size == 2) {
+        return core::Dtype::UInt16;
+    } else if (type == 'I' && size == 2) {
+        return core::Dtype::Int16;
+    } else if (type == 'I' && size == 4) {
+        return core::Dtype::Int32;
+    } else if (type == 'I' && size == 8) {
+        return core::Dtype::Int64;
+    } else {
+        return core::Dtype::Undefined;
+    }
+}
+
+static std::vector<std::string> SplitLine(const char *line) {
+    std::vector<std::string> tokens;
+    std::istringstream stream(line);
+    std::string token;
+    while (stream >> token) {
+        tokens.push_back(token);
+    }
+    return tokens;
+}
+
+static void SetValue(char *ptr, const core::Dtype &dtype, double value) {
+    DISPATCH_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        *reinterpret_cast<scalar_t *>(ptr) = static_cast<scalar_t>(value);
+    });
+}
+
+static bool IsLittleEndianHost() {
+    const uint16_t one = 1;
+    uint8_t first_byte;
+    std::memcpy(&first_byte, &one, 1);
+    return first_byte == 1;
+}
+
+bool PointCloudReader::Open(const std::string &filename,
+                            const std::string &format /* = "auto"*/) {
+    Close();
+    std::string file_format = format;
+    if (file_format == "auto") {
+        file_format =
+                utility::filesystem::GetFileExtensionInLowerCase(filename);
+    }
+    if (!file_.Open(filename, "rb")) {
+        utility::LogWarning("Read {} failed: unable to open file: {}.",
+                            utility::ToUpper(file_format), filename);
+        return false;
+    }
+    is_opened_ = true;
+
+    std::vector<Property> properties;
+    bool success;
+    if (file_format == "ply") {
+        success = ReadPLYHeader(properties);
+    } else if (file_format == "pcd") {
+        success = ReadPCDHeader(properties);
+    } else if (file_format == "xyz" || file_format == "xyzn" ||
+               file_format == "xyzrgb" || file_format == "xyzi" ||
+               file_format == "pts") {
+        success = ReadTextHeader(file_format, properties);
+    } else {
+        utility::LogWarning("Format {} is not supported for streaming.",
+                            file_format);
+        success = false;
+    }
+    if (success && is_binary_ && !IsLittleEndianHost()) {
+        utility::LogWarning(
+                "Binary {} files are streamed on little-endian hosts only.",
+                utility::ToUpper(file_format));
+        success = false;
+    }
+    if (!success) {
+        Close();
+        return false;
+    }
+    SetProperties(properties);
+    eof_ = num_points_ == 0;
+    return true;
+}
+
+void PointCloudReader::Close() {
+    file_.Close();
+    is_opened_ = false;
+    is_binary_ = false;
+    eof_ = true;
+    num_points_ = -1;
+    num_read_ = 0;
+    row_size_ = 0;
+    fields_.clear();
+    attributes_.clear();
+    row_buffer_.clear();
+    pending_line_.clear();
+}
+
+bool PointCloudReader::ReadPLYHeader(std::vector<Property> &properties) {
+    const char *line = file_.ReadLine();
+    if (!line || std::strncmp(line, "ply", 3) != 0) {
+        utility::LogWarning("Read PLY failed: unable to parse header.");
+        return false;
+    }
+
+    // Elements before the vertex element, skipped after the header.
+    int64_t skip_lines = 0;
+    int64_t skip_bytes = 0;
+    bool is_ascii = false;
+    bool is_vertex = false;
+    bool is_after_vertex = false;
+    bool is_fixed_size = true;
+    int64_t element_size = 0;
+    int64_t element_stride = 0;
+    int64_t token = 0;
+    while ((line = file_.ReadLine())) {
+        std::vector<std::string> tokens = SplitLine(line);
+        if (tokens.empty()) {
+            continue;
+        }
+        if (tokens[0] == "end_header") {
+            break;
+        } else if (tokens[0] == "format" && tokens.size() >= 2) {
+            is_ascii = tokens[1] == "ascii";
+            is_binary_ = tokens[1] == "binary_little_endian";
+            if (!is_ascii && !is_binary_) {
+                utility::LogWarning(
+                        "Read PLY failed: {} format is not supported for "
+                        "streaming.",
+                        tokens[1]);
+                return false;
+            }
+        } else if (tokens[0] == "element" && tokens.size() >= 3) {
+            if (is_vertex) {
+                is_after_vertex = true;
+                is_vertex = false;
+            }
+            if (is_after_vertex) {
+                continue;
+            }
+            skip_lines += element_size;
+            if (is_fixed_size) {
+                skip_bytes += element_size * element_stride;
+            } else if (is_binary_) {
+                utility::LogWarning(
+                        "Read PLY failed: list properties before the vertex "
+                        "element are not supported for streaming.");
+                return false;
+            }
+            element_size = std::strtoll(tokens[2].c_str(), nullptr, 10);
+            element_stride = 0;
+            is_vertex = tokens[1] == "vertex";
+        } else if (tokens[0] == "property" && tokens.size() >= 3 &&
+                   !is_after_vertex) {
+            if (tokens[1] == "list") {
+                if (is_vertex) {
+                    utility::LogWarning(
+                            "Read PLY failed: list property \"{}\" of the "
+                            "vertex element is not supported for streaming.",
+                            tokens.back());
+                    return false;
+                }
+                is_fixed_size = false;
+                continue;
+            }
+            int64_t byte_size;
+            core::Dtype dtype = GetDtypeFromPLYType(tokens[1], byte_size);
+            if (byte_size == 0) {
+                utility::LogWarning("Read PLY failed: unknown type \"{}\".",
+                                    tokens[1]);
+                return false;
+            }
+            if (is_vertex) {
+                if (dtype == core::Dtype::Undefined) {
+                    utility::LogWarning(
+                            "Read PLY warning: skipping property \"{}\", "
+                            "unsupported datatype \"{}\".",
+                            tokens[2], tokens[1]);
+                } else {
+                    properties.push_back(
+                            {tokens[2], dtype,
+                             is_binary_ ? element_stride : token});
+                }
+                element_stride += byte_size;
+                token++;
+            }
+        }
+    }
+    if (!line || !(is_vertex || is_after_vertex)) {
+        utility::LogWarning("Read PLY failed: no vertex element.");
+        return false;
+    }
+
+    if (is_binary_) {
+        if (skip_bytes > 0 &&
+            fseek(file_.GetFILE(), skip_bytes, SEEK_CUR) != 0) {
+            utility::LogWarning("Read PLY failed: unable to seek vertices.");
+            return false;
+        }
+    } else {
+        for (int64_t i = 0; i < skip_lines; ++i) {
+            if (!file_.ReadLine()) {
+                utility::LogWarning("Read PLY failed: unexpected end of file.");
+                return false;
+            }
+        }
+    }
+    row_size_ = is_binary_ ? element_stride : 0;
+    num_points_ = element_size;
+    return true;
+}
+
+bool PointCloudReader::ReadPCDHeader(std::vector<Property> &properties) {
+    std::vector<std::string> names, sizes, types, counts;
+    int64_t width = 0, height = 1;
+    num_points_ = -1;
+    const char *line;
+    bool has_data = false;
+    while (!has_data && (line = file_.ReadLine())) {
+        std::vector<std::string> tokens = SplitLine(line);
+        if (tokens.empty() || tokens[0][0] == '#') {
+            continue;
+        }
+        std::vector<std::string> values(tokens.begin() + 1, tokens.end());
+        if (tokens[0] == "FIELDS" || tokens[0] == "COLUMNS") {
+            names = values;
+        } else if (tokens[0] == "SIZE") {
+            sizes = values;
+        } else if (tokens[0] == "TYPE") {
+            types = values;
+        } else if (tokens[0] == "COUNT") {
+            counts = values;
+        } else if (tokens[0] == "WIDTH" && !values.empty()) {
+            width = std::strtoll(values[0].c_str(), nullptr, 10);
+        } else if (tokens[0] == "HEIGHT" && !values.empty()) {
+            height = std::strtoll(values[0].c_str(), nullptr, 10);
+        } else if (tokens[0] == "POINTS" && !values.empty()) {
+            num_points_ = std::strtoll(values[0].c_str(), nullptr, 10);
+        } else if (tokens[0] == "DATA" && !values.empty()) {
+            if (values[0] == "binary") {
+                is_binary_ = true;
+            } else if (values[0] != "ascii") {
+                utility::LogWarning(
+                        "Read PCD failed: {} data is not supported for "
+                        "streaming.",
+                        values[0]);
+                return false;
+            }
+            has_data = true;
+        }
+    }
+    if (!has_data || names.empty() || sizes.size() != names.size() ||
+        types.size() != names.size() ||
+        (!counts.empty() && counts.size() != names.size())) {
+        utility::LogWarning("Read PCD failed: unable to parse header.");
+        return false;
+    }
+    if (num_points_ < 0) {
+        num_points_ = width * height;
+    }
+
+    int64_t offset = 0;
+    int64_t token = 0;
+    for (size_t i = 0; i < names.size(); ++i) {
+        int64_t size = std::strtoll(sizes[i].c_str(), nullptr, 10);
+        int64_t count = counts.empty()
+                                ? 1
+                                : std::strtoll(counts[i].c_str(), nullptr, 10);
+        char type = types[i][0];
+        int64_t position = is_binary_ ? offset : token;
+        if ((names[i] == "rgb" || names[i] == "rgba") && size == 4 &&
+            count == 1) {
+            // Colors are packed as 0x00RRGGBB in a float or an integer.
+            const std::vector<std::string> channels = {"blue", "green",
+                                                       "red"};
+            for (int byte = 0; byte < 3; ++byte) {
+                Property property = {channels[byte], core::Dtype::UInt8,
+                                     is_binary_ ? offset + byte : token};
+                if (!is_binary_) {
+                    property.packed_byte_ = byte;
+                    property.packed_float_ = type == 'F';
+                }
+                properties.push_back(property);
+            }
+        } else if (count == 1 &&
+                   GetDtypeFromPCDType(type, size) != core::Dtype::Undefined) {
+            std::string name = names[i];
+            if (name == "normal_x" || name == "normal_y" ||
+                name == "normal_z") {
+                name = "n" + name.substr(7);
+            }
+            properties.push_back(
+                    {name, GetDtypeFromPCDType(type, size), position});
+        } else {
+            utility::LogWarning(
+                    "Read PCD warning: skipping field \"{}\", unsupported "
+                    "type {}{} with count {}.",
+                    names[i], type, size, count);
+        }
+        offset += size * count;
+        token += count;
+    }
+    row_size_ = is_binary_ ? offset : 0;
+    return true;
+}
+
+bool PointCloudReader::ReadTextHeader(const std::string &format,
+                                      std::vector<Property> &properties) {
+    std::vector<std::string> names = {"x", "y", "z"};
+    double color_scale = 1.0;
+    if (format == "xyzn") {
+        names.insert(names.end(), {"nx", "ny", "nz"});
+    } else if (format == "xyzrgb") {
+        names.insert(names.end(), {"red", "green", "blue"});
+    } else if (format == "xyzi") {
+        names.push_back("intensities");
+    } else if (format == "pts") {
+        // The number of points, then rows of X Y Z [I R G B].
+        const char *line = file_.ReadLine();
+        num_points_ = line ? std::strtoll(line, nullptr, 10) : 0;
+        if (num_points_ <= 0) {
+            utility::LogWarning("Read PTS failed: unable to read header.");
+            return false;
+        }
+        line = file_.ReadLine();
+        if (line) {
+            pending_line_ = line;
+        }
+        std::vector<std::string> tokens = SplitLine(pending_line_.c_str());
+        if (tokens.size() < 3) {
+            utility::LogWarning("Read PTS failed: insufficient data fields.");
+            return false;
+        }
+        if (tokens.size() >= 7) {
+            names.insert(names.end(), {"", "red", "green", "blue"});
+            color_scale = 1.0 / 255.0;
+        }
+    }
+    for (size_t i = 0; i < names.size(); ++i) {
+        if (names[i].empty()) {
+            continue;
+        }
+        Property property = {names[i], core::Dtype::Float64,
+                             static_cast<int64_t>(i)};
+        if (names[i] == "red" || names[i] == "green" || names[i] == "blue") {
+            property.scale_ = color_scale;
+        }
+        properties.push_back(property);
+    }
+    return true;
+}
+
+void PointCloudReader::SetProperties(const std::vector<Property> &properties) {
+    const std::vector<std::pair<std::string, std::vector<std::string>>>
+            base_attributes = {{"points", {"x", "y", "z"}},
+                               {"normals", {"nx", "ny", "nz"}},
+                               {"colors", {"red", "green", "blue"}}};
+    std::unordered_map<std::string, const Property *> name_to_property;
+    for (const Property &property : properties) {
+        name_to_property[property.name_] = &property;
+    }
+
+    auto add_attribute = [&](const std::string &name,
+                             const std::vector<std::string> &columns) {
+        int64_t attribute = static_cast<int64_t>(attributes_.size());
+        const Property *first = name_to_property.at(columns[0]);
+        attributes_.push_back({name, first->dtype_,
+                               static_cast<int64_t>(columns.size()),
+                               core::Tensor()});
+        for (size_t c = 0; c < columns.size(); ++c) {
+            fields_.push_back({*name_to_property.at(columns[c]), attribute,
+                               static_cast<int64_t>(c)});
+            name_to_property.erase(columns[c]);
+        }
+    };
+    // Base attributes are interleaved into {N, 3} tensors of a single dtype.
+    for (const auto &base_attribute : base_attributes) {
+        const std::vector<std::string> &columns = base_attribute.second;
+        bool has_columns = true;
+        for (const std::string &column : columns) {
+            has_columns = has_columns && name_to_property.count(column) != 0 &&
+                          name_to_property.at(column)->dtype_ ==
+                                  name_to_property.at(columns[0])->dtype_;
+        }
+        if (has_columns) {
+            add_attribute(base_attribute.first, columns);
+        }
+    }
+    for (const Property &property : properties) {
+        if (name_to_property.count(property.name_) != 0) {
+            add_attribute(property.name_, {property.name_});
+        }
+    }
+}
+
+geometry::PointCloud PointCloudReader::ReadNext(int64_t max_points) {
+    if (!IsOpened()) {
+        utility::LogError("Null file handler. Please call Open().");
+    }
+    if (max_points <= 0) {
+        utility::LogError("max_points must be positive, but got {}.",
+                          max_points);
+    }
+    int64_t num_rows = max_points;
+    if (num_points_ >= 0) {
+        num_rows = std::min(num_rows, num_points_ - num_read_);
+    }
+    for (Attribute &attribute : attributes_) {
+        if (attribute.buffer_.NumDims() == 0 ||
+            attribute.buffer_.GetLength() < num_rows) {
+            attribute.buffer_ = core::Tensor(
+                    {num_rows, attribute.num_columns_}, attribute.dtype_);
+        }
+    }
+
+    int64_t num_read = 0;
+    if (!eof_ && num_rows > 0) {
+        num_read = is_binary_ ? ReadBinaryRows(num_rows)
+                              : ReadTextRows(num_rows);
+    }
+    num_read_ += num_read;
+    if (num_points_ >= 0 && num_read_ >= num_points_) {
+        eof_ = true;
+    } else if (num_read < num_rows) {
+        if (num_points_ >= 0) {
+            utility::LogWarning("Read {} of {} points: unexpected end of file.",
+                                num_read_, num_points_);
+        }
+        eof_ = true;
+    }
+
+    geometry::PointCloud pointcloud(core::Device("CPU:0"));
+    for (const Attribute &attribute : attributes_) {
+        pointcloud.SetPointAttr(attribute.name_,
+                                attribute.buffer_.Slice(0, 0, num_read));
+    }
+    return pointcloud;
+}
+
+int64_t PointCloudReader::ReadBinaryRows(int64_t num_rows) {
+    row_buffer_.resize(num_rows * row_size_);
+    int64_t num_read = static_cast<int64_t>(
+            file_.ReadData(row_buffer_.data(), row_size_, num_rows));
+
+    std::vector<char *> dsts;
+    std::vector<int64_t> byte_sizes, strides;
+    for (const Field &field : fields_) {
+        Attribute &attribute = attributes_[field.attribute_];
+        int64_t byte_size = attribute.dtype_.ByteSize();
+        dsts.push_back(static_cast<char *>(attribute.buffer_.GetDataPtr()) +
+                       field.column_ * byte_size);
+        byte_sizes.push_back(byte_size);
+        strides.push_back(attribute.num_columns_ * byte_size);
+    }
+    const char *rows = row_buffer_.data();
+    const int64_t num_fields = static_cast<int64_t>(fields_.size());
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < num_read; ++i) {
+        const char *row = rows + i * row_size_;
+        for (int64_t f = 0; f < num_fields; ++f) {
+            std::memcpy(dsts[f] + i * strides[f],
+                        row + fields_[f].property_.offset_, byte_sizes[f]);
+        }
+    }
+    return num_read;
+}
+
+int64_t PointCloudReader::ReadTextRows(int64_t num_rows) {
+    int64_t num_tokens = 0;
+    for (const Field &field : fields_) {
+        num_tokens = std::max(num_tokens, field.property_.offset_ + 1);
+    }
+    std::vector<double> values;
+    int64_t num_read = 0;
+    while (num_read < num_rows) {
+        const char *line;
+        std::string pending_line;
+        if (!pending_line_.empty()) {
+            pending_line.swap(pending_line_);
+            line = pending_line.c_str();
+        } else if (!(line = file_.ReadLine())) {
+            break;
+        }
+        values.clear();
+        char *end;
+        for (double value = std::strtod(line, &end); end != line;
+             value = std::strtod(line, &end)) {
+            values.push_back(value);
+            line = end;
+        }
+        if (static_cast<int64_t>(values.size()) < num_tokens) {
+            continue;
+        }
+        for (const Field &field : fields_) {
+            const Property &property = field.property_;
+            Attribute &attribute = attributes_[field.attribute_];
+            double value = values[property.offset_];
+            if (property.packed_byte_ >= 0) {
+                uint32_t packed = static_cast<uint32_t>(value);
+                if (property.packed_float_) {
+                    float packed_float = static_cast<float>(value);
+                    std::memcpy(&packed, &packed_float, sizeof(packed));
+                }
+                value = (packed >> (8 * property.packed_byte_)) & 0xff;
+            }
+            int64_t byte_size = attribute.dtype_.ByteSize();
+            char *dst = static_cast<char *>(attribute.buffer_.GetDataPtr()) +
+                        (num_read * attribute.num_columns_ + field.column_) *
+                                byte_size;
+            SetValue(dst, attribute.dtype_, value * property.scale_);
+        }
+        num_read++;
+    }
+    return num_read;
+}
+
+bool PointCloudWriter::Open(const std::string &filename,
+                            bool write_ascii /* = false*/) {
+    Close();
+    format_ = utility::filesystem::GetFileExtensionInLowerCase(filename);
+    if (format_ != "ply" && format_ != "xyz" && format_ != "xyzn" &&
+        format_ != "xyzrgb" && format_ != "xyzi") {
+        utility::LogWarning("Format {} is not supported for streaming.",
+                            format_);
+        return false;
+    }
+    if (format_ == "ply" && !write_ascii && !IsLittleEndianHost()) {
+        utility::LogWarning(
+                "Write PLY failed: binary PLY is written on little-endian "
+                "hosts only.");
+        return false;
+    }
+    if (!file_.Open(filename, "wb")) {
+        utility::LogWarning("Write {} failed: unable to open file: {}.",
+                            utility::ToUpper(format_), filename);
+        return false;
+    }
+    is_opened_ = true;
+    write_ascii_ = format_ != "ply" || write_ascii;
+    return true;
+}
+
+void PointCloudWriter::Close() {
+    if (is_opened_ && format_ == "ply") {
+        if (!has_header_) {
+            utility::LogWarning("Write PLY failed: no points were written.");
+        } else {
+            // The header reserves a fixed width for the number of points.
+            std::string num_points = fmt::format("{:<20}", num_points_);
+            fseek(file_.GetFILE(), num_points_pos_, SEEK_SET);
+            fwrite(num_points.data(), 1, num_points.size(), file_.GetFILE());
+        }
+    }
+    file_.Close();
+    is_opened_ = false;
+    write_ascii_ = false;
+    has_header_ = false;
+    num_points_ = 0;
+    num_points_pos_ = -1;
+    columns_.clear();
+    row_buffer_.clear();
+}
+
+bool PointCloudWriter::WriteHeader(const geometry::PointCloud &pointcloud) {
+    std::vector<std::string> names = {"points"};
+    if (format_ == "xyzn") {
+        names.push_back("normals");
+    } else if (format_ == "xyzrgb") {
+        names.push_back("colors");
+    } else if (format_ == "xyzi") {
+        names.push_back("intensities");
+    } else if (format_ == "ply") {
+        if (pointcloud.HasPointNormals()) names.push_back("normals");
+        if (pointcloud.HasPointColors()) names.push_back("colors");
+        for (const auto &it : pointcloud.GetPointAttr()) {
+            if (it.first != "points" && it.first != "normals" &&
+                it.first != "colors") {
+                names.push_back(it.first);
+            }
+        }
+    }
+    for (const std::string &name : names) {
+        if (!pointcloud.HasPointAttr(name)) {
+            utility::LogWarning("Write {} failed: point cloud has no {}.",
+                                utility::ToUpper(format_), name);
+            return false;
+        }
+        const core::Tensor &tensor = pointcloud.GetPointAttr(name);
+        if (tensor.NumDims() != 2) {
+            utility::LogWarning(
+                    "Write {} failed: shape of {} is {}, but it should be NxC.",
+                    utility::ToUpper(format_), name, tensor.GetShape());
+            return false;
+        }
+        if (format_ == "ply" && GetPLYTypeFromDtype(tensor.GetDtype()) == "") {
+            utility::LogWarning(
+                    "Write PLY failed: unsupported datatype {} of {}.",
+                    tensor.GetDtype().ToString(), name);
+            return false;
+        }
+        columns_.push_back({name, tensor.GetDtype(), tensor.GetShape(1)});
+    }
+    has_header_ = true;
+    if (format_ != "ply") {
+        return true;
+    }
+
+    std::string header = fmt::format(
+            "ply\nformat {} 1.0\ncomment Created by Open3D\nelement vertex ",
+            write_ascii_ ? "ascii" : "binary_little_endian");
+    num_points_pos_ = static_cast<int64_t>(header.size());
+    header += fmt::format("{:<20}\n", 0);
+    const std::unordered_map<std::string, std::vector<std::string>>
+            base_properties = {{"points", {"x", "y", "z"}},
+                               {"normals", {"nx", "ny", "nz"}},
+                               {"colors", {"red", "green", "blue"}}};
+    for (const Column &column : columns_) {
+        std::vector<std::string> properties;
+        if (base_properties.count(column.name_) != 0 &&
+            column.num_columns_ == 3) {
+            properties = base_properties.at(column.name_);
+        } else if (column.num_columns_ == 1) {
+            properties = {column.name_};
+        } else {
+            for (int64_t c = 0; c < column.num_columns_; ++c) {
+                properties.push_back(fmt::format("{}_{}", column.name_, c));
+            }
+        }
+        for (const std::string &property : properties) {
+            header += fmt::format("property {} {}\n",
+                                  GetPLYTypeFromDtype(column.dtype_), property);
+        }
+    }
+    header += "end_header\n";
+    return fwrite(header.data(), 1, header.size(), file_.GetFILE()) ==
+           header.size();
+}
+
+bool PointCloudWriter::WriteNext(const geometry::PointCloud &pointcloud) {
+    if (!IsOpened()) {
+        utility::LogError("Null file handler. Please call Open().");
+    }
+    if (!has_header_ && !WriteHeader(pointcloud)) {
+        return false;
+    }
+
+    const core::Device host("CPU:0");
+    int64_t num_points = pointcloud.HasPointAttr("points")
+                                 ? pointcloud.GetPoints().GetLength()
+                                 : 0;
+    std::vector<core::Tensor> tensors;
+    for (const Column &column : columns_) {
+        if (!pointcloud.HasPointAttr(column.name_)) {
+            utility::LogWarning("Write {} failed: point cloud has no {}.",
+                                utility::ToUpper(format_), column.name_);
+            return false;
+        }
+        core::Tensor tensor = pointcloud.GetPointAttr(column.name_);
+        if (tensor.GetDtype() != column.dtype_ ||
+            tensor.GetShape() !=
+                    core::SizeVector({num_points, column.num_columns_})) {
+            utility::LogWarning(
+                    "Write {} failed: {} of dtype {} and shape {} does not "
+                    "match the first batch.",
+                    utility::ToUpper(format_), column.name_,
+                    tensor.GetDtype().ToString(), tensor.GetShape());
+            return false;
+        }
+        tensors.push_back(tensor.GetDevice() == host ? tensor.Contiguous()
+                                                     : tensor.Copy(host));
+    }
+
+    if (write_ascii_) {
+        std::string buffer;
+        for (int64_t i = 0; i < num_points; ++i) {
+            for (size_t t = 0; t < tensors.size(); ++t) {
+                DISPATCH_DTYPE_TO_TEMPLATE(columns_[t].dtype_, [&]() {
+                    const scalar_t *ptr =
+                            static_cast<const scalar_t *>(
+                                    tensors[t].GetDataPtr()) +
+                            i * columns_[t].num_columns_;
+                    for (int64_t c = 0; c < columns_[t].num_columns_; ++c) {
+                        if (std::is_floating_point<scalar_t>::value) {
+                            buffer += fmt::format(
+                                    "{:.10f} ", static_cast<double>(ptr[c]));
+                        } else {
+                            buffer += fmt::format(
+                                    "{} ", static_cast<int64_t>(ptr[c]));
+                        }
+                    }
+                });
+            }
+            buffer.back() = '\n';
+        }
+        if (fwrite(buffer.data(), 1, buffer.size(), file_.GetFILE()) !=
+            buffer.size()) {
+            utility::LogWarning("Write {} failed: unable to write points.",
+                                utility::ToUpper(format_));
+            return false;
+        }
+    } else {
+        int64_t row_size = 0;
+        std::vector<int64_t> offsets, byte_sizes;
+        for (const Column &column : columns_) {
+            offsets.push_back(row_size);
+            byte_sizes.push_back(column.num_columns_ *
+                                 column.dtype_.ByteSize());
+            row_size += byte_sizes.back();
+        }
+        row_buffer_.resize(num_points * row_size);
+        char *rows = row_buffer_.data();
+        const int64_t num_tensors = static_cast<int64_t>(tensors.size());
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+        for (int64_t i = 0; i < num_points; ++i) {
+            for (int64_t t = 0; t < num_tensors; ++t) {
+                std::memcpy(
+                        rows + i * row_size + offsets[t],
+                        static_cast<const char *>(tensors[t].GetDataPtr()) +
+                                i * byte_sizes[t],
+                        byte_sizes[t]);
+            }
+        }
+        if (num_points > 0 &&
+            fwrite(rows, row_size, num_points, file_.GetFILE()) !=
+                    static_cast<size_t>(num_points)) {
+            utility::LogWarning("Write PLY failed: unable to write points.");
+            return false;
+        }
+    }
+    num_points_ += num_points;
+    return true;
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
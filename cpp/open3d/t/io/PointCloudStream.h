@@ -0,0 +1,185 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/utility/FileSystem.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+/// \class PointCloudReader
+///
+/// \brief Reads a point cloud file in batches of points, so that files larger
+/// than the memory can be processed as a stream.
+///
+/// The supported formats are binary little-endian and ASCII PLY with a vertex
+/// element of scalar properties, binary and ASCII PCD, and the text formats
+/// xyz, xyzn, xyzrgb, xyzi and pts. The attributes are named as by
+/// ReadPointCloud.
+///
+/// The tensors of a batch share the buffers of the reader, which are
+/// overwritten by the next call to ReadNext. Copy them to keep them.
+class PointCloudReader {
+public:
+    PointCloudReader() {}
+    ~PointCloudReader() { Close(); }
+
+    /// Open a point cloud file and read its header.
+    ///
+    /// \param filename Path to the point cloud file.
+    /// \param format File format, or "auto" to deduce it from the extension.
+    bool Open(const std::string &filename, const std::string &format = "auto");
+
+    /// Close the opened file and release the buffers.
+    void Close();
+
+    /// Check if the point cloud file is opened.
+    bool IsOpened() const { return is_opened_; }
+
+    /// Check if all the points of the file are read.
+    bool IsEOF() const { return eof_; }
+
+    /// Number of points of the file, or -1 if the format does not store it.
+    int64_t GetNumPoints() const { return num_points_; }
+
+    /// Read the next batch of at most \p max_points points. The batch is
+    /// empty at the end of the file.
+    geometry::PointCloud ReadNext(int64_t max_points);
+
+private:
+    /// Scalar property of the file. For binary files, \p offset_ is the byte
+    /// offset of the property in a row; for ASCII files, it is the index of
+    /// its token in a line.
+    struct Property {
+        std::string name_;
+        core::Dtype dtype_;
+        int64_t offset_;
+        /// For colors packed in a 32-bit PCD field, the byte of the channel.
+        int packed_byte_ = -1;
+        /// The packed field of an ASCII PCD file is printed as a float.
+        bool packed_float_ = false;
+        /// Scale of the values of the text formats.
+        double scale_ = 1.0;
+    };
+
+    /// Column of an attribute read from a property.
+    struct Field {
+        Property property_;
+        int64_t attribute_;
+        int64_t column_;
+    };
+
+    struct Attribute {
+        std::string name_;
+        core::Dtype dtype_;
+        int64_t num_columns_;
+        core::Tensor buffer_;
+    };
+
+    bool ReadPLYHeader(std::vector<Property> &properties);
+    bool ReadPCDHeader(std::vector<Property> &properties);
+    bool ReadTextHeader(const std::string &format,
+                        std::vector<Property> &properties);
+    /// Groups the properties into the attributes, as ReadPointCloud does.
+    void SetProperties(const std::vector<Property> &properties);
+    int64_t ReadBinaryRows(int64_t num_rows);
+    int64_t ReadTextRows(int64_t num_rows);
+
+    utility::filesystem::CFile file_;
+    bool is_opened_ = false;
+    bool is_binary_ = false;
+    bool eof_ = true;
+    int64_t num_points_ = -1;
+    int64_t num_read_ = 0;
+    int64_t row_size_ = 0;
+    std::vector<Field> fields_;
+    std::vector<Attribute> attributes_;
+    std::vector<char> row_buffer_;
+    /// First data line, read ahead to find the columns of a pts file.
+    std::string pending_line_;
+};
+
+/// \class PointCloudWriter
+///
+/// \brief Writes a point cloud file in batches of points.
+///
+/// The supported formats are binary little-endian and ASCII PLY, and the text
+/// formats xyz, xyzn, xyzrgb and xyzi. The first batch sets the attributes of
+/// the file, and the next batches must have the same attributes. The number
+/// of points of a PLY header is written by Close.
+class PointCloudWriter {
+public:
+    PointCloudWriter() {}
+    ~PointCloudWriter() { Close(); }
+
+    /// Open a point cloud file for writing.
+    ///
+    /// \param filename Path to the point cloud file. The format is deduced
+    /// from the extension.
+    /// \param write_ascii Write ASCII instead of binary PLY.
+    bool Open(const std::string &filename, bool write_ascii = false);
+
+    /// Complete the header and close the file.
+    void Close();
+
+    /// Check if the point cloud file is opened.
+    bool IsOpened() const { return is_opened_; }
+
+    /// Append the points of \p pointcloud to the file.
+    bool WriteNext(const geometry::PointCloud &pointcloud);
+
+private:
+    struct Column {
+        std::string name_;
+        core::Dtype dtype_;
+        int64_t num_columns_;
+    };
+
+    bool WriteHeader(const geometry::PointCloud &pointcloud);
+
+    utility::filesystem::CFile file_;
+    bool is_opened_ = false;
+    std::string format_;
+    bool write_ascii_ = false;
+    bool has_header_ = false;
+    int64_t num_points_ = 0;
+    /// Position of the number of points in the PLY header.
+    int64_t num_points_pos_ = -1;
+    std::vector<Column> columns_;
+    std::vector<char> row_buffer_;
+};
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,131 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/t/io/RGBDSequenceLoader.h"
+
+#include <algorithm>
+
+#include "open3d/t/io/ImageIO.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+RGBDSequenceLoader::RGBDSequenceLoader(
+        const std::vector<std::pair<std::string, std::string>> &filenames,
+        const core::Device &device,
+        size_t queue_depth,
+        size_t num_workers)
+    : filenames_(filenames),
+      device_(device),
+      slots_(std::max<size_t>(queue_depth, 1)) {
+    if (num_workers == 0) {
+        num_workers = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+    num_workers = std::min(num_workers, slots_.size());
+    for (size_t i = 0; i < num_workers; ++i) {
+        workers_.emplace_back(&RGBDSequenceLoader::DecodeFrames, this);
+    }
+}
+
+RGBDSequenceLoader::~RGBDSequenceLoader() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        is_stopped_ = true;
+    }
+    slot_free_.notify_all();
+    for (std::thread &worker : workers_) {
+        worker.join();
+    }
+}
+
+bool RGBDSequenceLoader::IsEOF() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return next_frame_ >= filenames_.size();
+}
+
+void RGBDSequenceLoader::DecodeFrames() {
+    while (true) {
+        size_t frame;
+        {
+            // Frame i reuses the slot of frame i - size, which must have been
+            // returned already.
+            std::unique_lock<std::mutex> lock(mutex_);
+            slot_free_.wait(lock, [this] {
+                return is_stopped_ || next_decode_ >= filenames_.size() ||
+                       next_decode_ < next_frame_ + slots_.size();
+            });
+            if (is_stopped_ || next_decode_ >= filenames_.size()) {
+                return;
+            }
+            frame = next_decode_++;
+        }
+
+        t::geometry::RGBDImage image;
+        t::geometry::Image color(0, 0, 1, core::Dtype::UInt8, device_);
+        t::geometry::Image depth(0, 0, 1, core::Dtype::UInt16, device_);
+        if (ReadImageInto(filenames_[frame].first, color) &&
+            ReadImageInto(filenames_[frame].second, depth)) {
+            image = t::geometry::RGBDImage(color, depth);
+        } else {
+            utility::LogWarning(
+                    "[RGBDSequenceLoader] Unable to read frame {}: {}, {}.",
+                    frame, filenames_[frame].first, filenames_[frame].second);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            Slot &slot = slots_[frame % slots_.size()];
+            slot.image_ = std::move(image);
+            slot.is_ready_ = true;
+        }
+        frame_ready_.notify_all();
+    }
+}
+
+t::geometry::RGBDImage RGBDSequenceLoader::NextFrame() {
+    t::geometry::RGBDImage image;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (next_frame_ >= filenames_.size()) {
+            return image;
+        }
+        Slot &slot = slots_[next_frame_ % slots_.size()];
+        frame_ready_.wait(lock, [&slot] { return slot.is_ready_; });
+        image = std::move(slot.image_);
+        slot.image_ = t::geometry::RGBDImage();
+        slot.is_ready_ = false;
+        ++next_frame_;
+    }
+    slot_free_.notify_all();
+    return image;
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,103 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "open3d/core/Device.h"
+#include "open3d/t/geometry/RGBDImage.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+/// \class RGBDSequenceLoader
+///
+/// Loads a sequence of color and depth image files in order, decoding the
+/// next frames on worker threads while the current ones are processed.
+///
+/// At most \p queue_depth frames are decoded ahead of the last frame returned
+/// by NextFrame(). Frames are uploaded to the target device by the workers.
+class RGBDSequenceLoader {
+public:
+    static const size_t DEFAULT_QUEUE_DEPTH = 8;
+
+    /// \param filenames Pairs of color and depth image files, PNG or JPG.
+    /// \param device Device of the returned images.
+    /// \param queue_depth Maximum number of frames decoded ahead.
+    /// \param num_workers Number of decoding threads. 0 uses the number of
+    /// hardware threads, up to \p queue_depth.
+    explicit RGBDSequenceLoader(
+            const std::vector<std::pair<std::string, std::string>> &filenames,
+            const core::Device &device = core::Device("CPU:0"),
+            size_t queue_depth = DEFAULT_QUEUE_DEPTH,
+            size_t num_workers = 0);
+
+    RGBDSequenceLoader(const RGBDSequenceLoader &) = delete;
+    RGBDSequenceLoader &operator=(const RGBDSequenceLoader &) = delete;
+    ~RGBDSequenceLoader();
+
+    /// Number of frames of the sequence.
+    size_t GetNumFrames() const { return filenames_.size(); }
+
+    /// Check if all the frames have been returned.
+    bool IsEOF() const;
+
+    /// Waits for the next frame and returns it. A frame whose files cannot be
+    /// read is returned empty, and an empty RGBDImage is returned past the end
+    /// of the sequence.
+    t::geometry::RGBDImage NextFrame();
+
+private:
+    struct Slot {
+        bool is_ready_ = false;
+        t::geometry::RGBDImage image_;
+    };
+
+    void DecodeFrames();
+
+    std::vector<std::pair<std::string, std::string>> filenames_;
+    core::Device device_;
+    std::vector<Slot> slots_;  ///< Frame i is decoded into slot i % size.
+    size_t next_decode_ = 0;   ///< Next frame claimed by a worker.
+    size_t next_frame_ = 0;    ///< Next frame returned by NextFrame().
+    bool is_stopped_ = false;
+    mutable std::mutex mutex_;
+    std::condition_variable frame_ready_;
+    std::condition_variable slot_free_;
+    std::vector<std::thread> workers_;
+};
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,126 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/t/io/TriangleMeshIO.h"
+
+#include <functional>
+#include <unordered_map>
+
+#include "open3d/io/CompressedFileIO.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/FileSystem.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+static const std::unordered_map<
+        std::string,
+        std::function<bool(
+                const std::string &, geometry::TriangleMesh &, bool)>>
+        file_extension_to_trianglemesh_read_function{
+                {"obj", ReadTriangleMeshFromOBJ},
+                {"off", ReadTriangleMeshFromOFF},
+                {"ply", ReadTriangleMeshFromPLY},
+                {"stl", ReadTriangleMeshFromSTL},
+                {"o3dt", ReadTriangleMeshFromO3DT},
+        };
+
+static const std::unordered_map<
+        std::string,
+        std::function<bool(const std::string &,
+                           const geometry::TriangleMesh &,
+                           bool,
+                           bool,
+                           bool)>>
+        file_extension_to_trianglemesh_write_function{
+                {"ply", WriteTriangleMeshToPLY},
+                {"stl", WriteTriangleMeshToSTL},
+                {"o3dt", WriteTriangleMeshToO3DT},
+        };
+
+bool ReadTriangleMesh(const std::string &filename,
+                      geometry::TriangleMesh &mesh,
+                      bool print_progress) {
+    if (!open3d::io::GetFileCompression(filename).empty()) {
+        return open3d::io::ReadCompressedFile(
+                filename, [&](const std::string &path) {
+                    return ReadTriangleMesh(path, mesh, print_progress);
+                });
+    }
+    std::string format =
+            utility::filesystem::GetFileExtensionInLowerCase(filename);
+    auto map_itr = file_extension_to_trianglemesh_read_function.find(format);
+    if (map_itr == file_extension_to_trianglemesh_read_function.end()) {
+        open3d::geometry::TriangleMesh legacy_mesh;
+        if (!open3d::io::ReadTriangleMesh(filename, legacy_mesh, false,
+                                          print_progress)) {
+            return false;
+        }
+        mesh = geometry::TriangleMesh::FromLegacyTriangleMesh(
+                legacy_mesh, core::Dtype::Float32, core::Dtype::Int64,
+                mesh.GetDevice());
+        return true;
+    }
+
+    bool success = map_itr->second(filename, mesh, print_progress);
+    utility::LogDebug("Read geometry::TriangleMesh: {:d} vertices.",
+                      (int)mesh.GetVertices().GetLength());
+    return success;
+}
+
+bool WriteTriangleMesh(const std::string &filename,
+                       const geometry::TriangleMesh &mesh,
+                       bool write_ascii /* = false*/,
+                       bool compressed /* = false*/,
+                       bool print_progress /* = false*/) {
+    if (!open3d::io::GetFileCompression(filename).empty()) {
+        return open3d::io::WriteCompressedFile(
+                filename, [&](const std::string &path) {
+                    return WriteTriangleMesh(path, mesh, write_ascii,
+                                             compressed, print_progress);
+                });
+    }
+    std::string format =
+            utility::filesystem::GetFileExtensionInLowerCase(filename);
+    auto map_itr = file_extension_to_trianglemesh_write_function.find(format);
+    if (map_itr == file_extension_to_trianglemesh_write_function.end()) {
+        return open3d::io::WriteTriangleMesh(
+                filename, mesh.ToLegacyTriangleMesh(), write_ascii, compressed,
+                true, true, true, print_progress);
+    }
+
+    bool success = map_itr->second(filename, mesh, write_ascii, compressed,
+                                   print_progress);
+    utility::LogDebug("Write geometry::TriangleMesh: {:d} vertices.",
+                      (int)mesh.GetVertices().GetLength());
+    return success;
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,105 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+// clang-format off
+#include <cstddef>
+#include <cstdio>
+#include <jpeglib.h>  // Include after cstddef to define size_t
+// clang-format on
+
+#include <vector>
+
+#include "open3d/t/io/ImageIO.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/FileSystem.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+bool ReadImageIntoFromJPG(const std::string &filename,
+                          geometry::Image &image) {
+    struct jpeg_decompress_struct cinfo;
+    struct jpeg_error_mgr jerr;
+    FILE *file_in;
+
+    if ((file_in = utility::filesystem::FOpen(filename, "rb")) == NULL) {
+        utility::LogWarning("Read JPG failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+
+    cinfo.err = jpeg_std_error(&jerr);
+    jpeg_create_decompress(&cinfo);
+    jpeg_stdio_src(&cinfo, file_in);
+    jpeg_read_header(&cinfo, TRUE);
+
+    // We only support two channel types: gray, and RGB.
+    switch (cinfo.jpeg_color_space) {
+        case JCS_RGB:
+        case JCS_YCbCr:
+            cinfo.out_color_space = JCS_RGB;
+            break;
+        case JCS_GRAYSCALE:
+            cinfo.out_color_space = JCS_GRAYSCALE;
+            break;
+        case JCS_CMYK:
+        case JCS_YCCK:
+        default:
+            utility::LogWarning("Read JPG failed: color space not supported.");
+            jpeg_destroy_decompress(&cinfo);
+            fclose(file_in);
+            return false;
+    }
+    jpeg_start_decompress(&cinfo);
+
+    // Decode the scanlines straight into the image tensor, as many at a time
+    // as the decoder outputs.
+    int64_t rows = cinfo.output_height;
+    int64_t row_bytes = cinfo.output_width * cinfo.output_components;
+    core::Tensor buffer =
+            GetImageDecodeBuffer(image, rows, cinfo.output_width,
+                                 cinfo.output_components, core::Dtype::UInt8);
+    JSAMPLE *data = static_cast<JSAMPLE *>(buffer.GetDataPtr());
+    std::vector<JSAMPROW> row_pointers(rows);
+    for (int64_t r = 0; r < rows; ++r) {
+        row_pointers[r] = data + r * row_bytes;
+    }
+    while (cinfo.output_scanline < cinfo.output_height) {
+        jpeg_read_scanlines(&cinfo, row_pointers.data() + cinfo.output_scanline,
+                            cinfo.output_height - cinfo.output_scanline);
+    }
+    jpeg_finish_decompress(&cinfo);
+    jpeg_destroy_decompress(&cinfo);
+    fclose(file_in);
+    SetImageFromDecodeBuffer(buffer, image);
+    return true;
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,833 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include <liblzf/lzf.h>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "open3d/core/Blob.h"
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/io/ByteSource.h"
+#include "open3d/t/io/PointCloudIO.h"
+#include "open3d/t/io/TriangleMeshIO.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Parallel.h"
+#include "open3d/utility/ProgressReporters.h"
+
+// The .o3dt format stores the attributes of a tensor geometry as raw buffers,
+// so that loading maps the file instead of converting it. All values are
+// little-endian.
+//
+// Header:
+//     char[4]  magic "O3DT"
+//     uint32   version
+//     uint32   geometry type, 0 for PointCloud and 1 for TriangleMesh
+//     uint32   number of attributes
+// Attribute table, one entry per attribute:
+//     uint8    group, 0 for point / vertex and 1 for triangle attributes
+//     uint8    dtype code, the index in GetO3DTDtypes()
+//     uint8    compression, 0 for none and 1 for LZF
+//     uint8    number of dimensions
+//     uint32   length of the name
+//     int64[]  shape
+//     uint64   offset of the buffer in the file, a multiple of 64
+//     uint64   stored size of the buffer
+//     uint64   uncompressed size of a chunk, 0 if uncompressed
+//     char[]   name
+// Buffers follow the table. A compressed buffer starts with the uint64 stored
+// sizes of its chunks, followed by the chunks, each compressed independently.
+// A chunk whose stored size equals its uncompressed size is stored as is.
+// Filtered buffers hold whole rows per chunk, and each chunk is transposed
+// into byte planes, one per byte of a row, holding the differences of the
+// bytes of consecutive rows before compression. Neighboring vertices and
+// triangles differ by small values, so that most planes become runs of
+// zeros that compress well.
+
+namespace open3d {
+namespace t {
+namespace io {
+
+static const char kO3DTMagic[4] = {'O', '3', 'D', 'T'};
+static const uint32_t kO3DTVersion = 1;
+static const int64_t kO3DTAlignment = 64;
+static const int64_t kO3DTChunkSize = 1 << 22;
+/// Size of the first request for the header and table of remote files.
+static const int64_t kO3DTTablePrefixSize = 1 << 16;
+
+enum class O3DTGeometryType : uint32_t { PointCloud = 0, TriangleMesh = 1 };
+
+enum class O3DTCompression : uint8_t { None = 0, LZF = 1, FilteredLZF = 2 };
+
+struct O3DTAttribute {
+    uint8_t group_;
+    std::string name_;
+    core::Tensor tensor_;
+};
+
+struct O3DTEntry {
+    uint8_t group_;
+    uint8_t dtype_code_;
+    O3DTCompression compression_;
+    core::SizeVector shape_;
+    uint64_t offset_;
+    uint64_t size_;
+    uint64_t chunk_size_;
+    std::string name_;
+};
+
+/// Dtypes of the attributes, indexed by their code in the file.
+static const std::vector<core::Dtype> &GetO3DTDtypes() {
+    static const std::vector<core::Dtype> dtypes{
+            core::Dtype::Float32, core::Dtype::Float64, core::Dtype::Int16,
+            core::Dtype::Int32,   core::Dtype::Int64,   core::Dtype::UInt8,
+            core::Dtype::UInt16,  core::Dtype::Bool};
+    return dtypes;
+}
+
+static bool IsLittleEndianHost() {
+    const uint16_t value = 1;
+    uint8_t first_byte;
+    std::memcpy(&first_byte, &value, 1);
+    return first_byte == 1;
+}
+
+static int64_t AlignO3DTOffset(int64_t offset) {
+    return (offset + kO3DTAlignment - 1) / kO3DTAlignment * kO3DTAlignment;
+}
+
+template <typename T>
+static void AppendO3DTValue(std::vector<char> &buffer, const T &value) {
+    const char *bytes = reinterpret_cast<const char *>(&value);
+    buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+}
+
+template <typename T>
+static bool ReadO3DTValue(const char *data,
+                          int64_t size,
+                          int64_t &offset,
+                          T &value) {
+    if (offset < 0 || size - offset < static_cast<int64_t>(sizeof(T))) {
+        return false;
+    }
+    std::memcpy(&value, data + offset, sizeof(T));
+    offset += sizeof(T);
+    return true;
+}
+
+/// Maps the file into copy-on-write memory when supported, otherwise reads it
+/// into a CPU blob. Tensors viewing the returned blob keep the mapping alive
+/// and can be modified without changing the file.
+static std::shared_ptr<core::Blob> MapO3DTFile(const std::string &filename,
+                                               int64_t &file_size) {
+#ifndef _WIN32
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return nullptr;
+    }
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) != 0 || file_stat.st_size == 0) {
+        close(fd);
+        return nullptr;
+    }
+    file_size = static_cast<int64_t>(file_stat.st_size);
+    void *data_ptr = mmap(nullptr, file_size, PROT_READ | PROT_WRITE,
+                          MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data_ptr == MAP_FAILED) {
+        return nullptr;
+    }
+    return std::make_shared<core::Blob>(
+            core::Device("CPU:0"), data_ptr,
+            [data_ptr, file_size](void *) { munmap(data_ptr, file_size); });
+#else
+    FILE *fp = utility::filesystem::FOpen(filename, "rb");
+    if (fp == nullptr) {
+        return nullptr;
+    }
+    fseek(fp, 0, SEEK_END);
+    file_size = static_cast<int64_t>(ftell(fp));
+    fseek(fp, 0, SEEK_SET);
+    if (file_size <= 0) {
+        fclose(fp);
+        return nullptr;
+    }
+    auto blob = std::make_shared<core::Blob>(file_size, core::Device("CPU:0"));
+    size_t read_size = fread(blob->GetDataPtr(), 1, file_size, fp);
+    fclose(fp);
+    if (read_size != static_cast<size_t>(file_size)) {
+        return nullptr;
+    }
+    return blob;
+#endif
+}
+
+static bool ReadO3DTEntry(const char *data,
+                          int64_t size,
+                          int64_t &offset,
+                          O3DTEntry &entry) {
+    uint8_t compression, ndim;
+    uint32_t name_length;
+    if (!ReadO3DTValue(data, size, offset, entry.group_) ||
+        !ReadO3DTValue(data, size, offset, entry.dtype_code_) ||
+        !ReadO3DTValue(data, size, offset, compression) ||
+        !ReadO3DTValue(data, size, offset, ndim) ||
+        !ReadO3DTValue(data, size, offset, name_length)) {
+        return false;
+    }
+    entry.compression_ = static_cast<O3DTCompression>(compression);
+    entry.shape_.resize(ndim);
+    for (uint8_t d = 0; d < ndim; ++d) {
+        if (!ReadO3DTValue(data, size, offset, entry.shape_[d]) ||
+            entry.shape_[d] < 0) {
+            return false;
+        }
+    }
+    if (!ReadO3DTValue(data, size, offset, entry.offset_) ||
+        !ReadO3DTValue(data, size, offset, entry.size_) ||
+        !ReadO3DTValue(data, size, offset, entry.chunk_size_) ||
+        size - offset < static_cast<int64_t>(name_length)) {
+        return false;
+    }
+    entry.name_.assign(data + offset, name_length);
+    offset += name_length;
+    return true;
+}
+
+/// Transposes the \p length bytes of rows of \p row_size bytes at \p raw
+/// into byte planes of the differences of consecutive rows.
+static void FilterO3DTChunk(const char *raw,
+                            int64_t length,
+                            int64_t row_size,
+                            char *filtered) {
+    int64_t num_rows = length / row_size;
+    const uint8_t *src = reinterpret_cast<const uint8_t *>(raw);
+    uint8_t *dst = reinterpret_cast<uint8_t *>(filtered);
+    for (int64_t b = 0; b < row_size; ++b) {
+        uint8_t previous = 0;
+        for (int64_t r = 0; r < num_rows; ++r) {
+            uint8_t value = src[r * row_size + b];
+            dst[b * num_rows + r] = static_cast<uint8_t>(value - previous);
+            previous = value;
+        }
+    }
+}
+
+/// Inverse of FilterO3DTChunk.
+static void UnfilterO3DTChunk(const char *filtered,
+                              int64_t length,
+                              int64_t row_size,
+                              char *raw) {
+    int64_t num_rows = length / row_size;
+    const uint8_t *src = reinterpret_cast<const uint8_t *>(filtered);
+    uint8_t *dst = reinterpret_cast<uint8_t *>(raw);
+    for (int64_t b = 0; b < row_size; ++b) {
+        uint8_t value = 0;
+        for (int64_t r = 0; r < num_rows; ++r) {
+            value = static_cast<uint8_t>(value + src[b * num_rows + r]);
+            dst[r * row_size + b] = value;
+        }
+    }
+}
+
+/// Returns the size in bytes of a row of \p shape, the first dimension
+/// indexing the rows.
+static int64_t GetO3DTRowSize(const core::SizeVector &shape,
+                              const core::Dtype &dtype) {
+    int64_t row_size = dtype.ByteSize();
+    for (size_t d = 1; d < shape.size(); ++d) {
+        row_size *= shape[d];
+    }
+    return row_size;
+}
+
+/// Decompresses the chunks of a buffer in parallel into \p output. Filtered
+/// chunks hold rows of \p row_size bytes, which is 0 for unfiltered buffers.
+static bool DecompressO3DTBuffer(const char *buffer,
+                                 uint64_t buffer_size,
+                                 uint64_t chunk_size,
+                                 int64_t raw_size,
+                                 int64_t row_size,
+                                 char *output) {
+    if (raw_size == 0) {
+        return buffer_size == 0;
+    }
+    if (chunk_size == 0 ||
+        (row_size > 0 && chunk_size % static_cast<uint64_t>(row_size) != 0)) {
+        return false;
+    }
+    int64_t num_chunks = (raw_size + chunk_size - 1) / chunk_size;
+    if (buffer_size < static_cast<uint64_t>(num_chunks) * 8) {
+        return false;
+    }
+    // Offsets of the chunks from the prefix sums of their stored sizes.
+    std::vector<uint64_t> chunk_offsets(num_chunks + 1);
+    chunk_offsets[0] = num_chunks * 8;
+    for (int64_t c = 0; c < num_chunks; ++c) {
+        uint64_t stored_size;
+        std::memcpy(&stored_size, buffer + c * 8, 8);
+        chunk_offsets[c + 1] = chunk_offsets[c] + stored_size;
+        if (chunk_offsets[c + 1] > buffer_size) {
+            return false;
+        }
+    }
+
+    bool success = true;
+#pragma omp parallel for schedule(dynamic) num_threads(utility::EstimateMaxThreads())
+    for (int64_t c = 0; c < num_chunks; ++c) {
+        int64_t begin = c * static_cast<int64_t>(chunk_size);
+        int64_t length =
+                std::min(static_cast<int64_t>(chunk_size), raw_size - begin);
+        uint64_t stored_size = chunk_offsets[c + 1] - chunk_offsets[c];
+        const char *chunk = buffer + chunk_offsets[c];
+        std::vector<char> filtered(row_size > 0 ? length : 0);
+        char *decompressed = row_size > 0 ? filtered.data() : output + begin;
+        if (stored_size == static_cast<uint64_t>(length)) {
+            std::memcpy(decompressed, chunk, length);
+        } else if (lzf_decompress(chunk, static_cast<unsigned int>(stored_size),
+                                  decompressed,
+                                  static_cast<unsigned int>(length)) !=
+                   static_cast<unsigned int>(length)) {
+            success = false;
+            continue;
+        }
+        if (row_size > 0) {
+            UnfilterO3DTChunk(decompressed, length, row_size, output + begin);
+        }
+    }
+    return success;
+}
+
+/// Parses the header and attribute table of an .o3dt file of \p file_size
+/// bytes from its first \p size bytes at \p data. Returns false with
+/// \p truncated set if the table extends past \p size.
+static bool ReadO3DTTable(const char *data,
+                          int64_t size,
+                          int64_t file_size,
+                          const std::string &filename,
+                          O3DTGeometryType geometry_type,
+                          std::vector<O3DTEntry> &entries,
+                          bool &truncated) {
+    truncated = false;
+    int64_t offset = sizeof(kO3DTMagic);
+    uint32_t version, type, num_attributes;
+    if (size < offset || std::memcmp(data, kO3DTMagic, offset) != 0 ||
+        !ReadO3DTValue(data, size, offset, version) ||
+        !ReadO3DTValue(data, size, offset, type) ||
+        !ReadO3DTValue(data, size, offset, num_attributes)) {
+        truncated = size < file_size;
+        if (!truncated) {
+            utility::LogWarning("Read O3DT failed: invalid header in file: {}",
+                                filename);
+        }
+        return false;
+    }
+    if (version != kO3DTVersion) {
+        utility::LogWarning("Read O3DT failed: unsupported version {}.",
+                            version);
+        return false;
+    }
+    if (type != static_cast<uint32_t>(geometry_type)) {
+        utility::LogWarning(
+                "Read O3DT failed: the file holds a geometry of type {}.",
+                type);
+        return false;
+    }
+
+    entries.resize(num_attributes);
+    for (O3DTEntry &entry : entries) {
+        bool is_read = ReadO3DTEntry(data, size, offset, entry);
+        if (!is_read && size < file_size) {
+            truncated = true;
+            return false;
+        }
+        if (!is_read || entry.dtype_code_ >= GetO3DTDtypes().size() ||
+            entry.offset_ % kO3DTAlignment != 0 ||
+            entry.offset_ > static_cast<uint64_t>(file_size) ||
+            entry.size_ > static_cast<uint64_t>(file_size) - entry.offset_) {
+            utility::LogWarning(
+                    "Read O3DT failed: invalid attribute table in file: {}",
+                    filename);
+            return false;
+        }
+    }
+    return true;
+}
+
+/// Reads the attributes of an .o3dt file of \p geometry_type onto \p device.
+/// Uncompressed buffers on the CPU are views of the mapped file. Files given
+/// by URL are read with ranged reads of the table and of the attribute
+/// buffers, which are fetched concurrently.
+static bool ReadO3DTAttributes(const std::string &filename,
+                               O3DTGeometryType geometry_type,
+                               const core::Device &device,
+                               std::vector<O3DTAttribute> &attributes,
+                               utility::CountingProgressReporter &reporter) {
+    if (!IsLittleEndianHost()) {
+        utility::LogWarning(
+                "Read O3DT failed: big-endian hosts are not supported.");
+        return false;
+    }
+    int64_t file_size = 0;
+    std::shared_ptr<core::Blob> blob;
+    std::shared_ptr<open3d::io::ByteSource> source;
+    if (open3d::io::IsURL(filename)) {
+        source = open3d::io::OpenByteSource(filename);
+        file_size = source != nullptr ? source->GetSize() : 0;
+    } else {
+        blob = MapO3DTFile(filename, file_size);
+    }
+    if ((blob == nullptr && source == nullptr) || file_size == 0) {
+        utility::LogWarning("Read O3DT failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+
+    std::vector<O3DTEntry> entries;
+    bool truncated = false;
+    const char *data = nullptr;
+    if (blob != nullptr) {
+        data = static_cast<const char *>(blob->GetDataPtr());
+        if (!ReadO3DTTable(data, file_size, file_size, filename,
+                           geometry_type, entries, truncated)) {
+            return false;
+        }
+    } else {
+        // Requests growing prefixes until the table is complete.
+        std::vector<char> prefix;
+        int64_t prefix_size = std::min(kO3DTTablePrefixSize, file_size);
+        while (true) {
+            prefix.resize(prefix_size);
+            if (!source->Read(0, prefix_size, prefix.data())) {
+                utility::LogWarning("Read O3DT failed: unable to read file: {}",
+                                    filename);
+                return false;
+            }
+            if (ReadO3DTTable(prefix.data(), prefix_size, file_size, filename,
+                              geometry_type, entries, truncated)) {
+                break;
+            }
+            if (!truncated) {
+                return false;
+            }
+            prefix_size = std::min(2 * prefix_size, file_size);
+        }
+    }
+
+    // Remote buffers are fetched at once into blobs of their own.
+    std::vector<std::shared_ptr<core::Blob>> buffer_blobs(entries.size(),
+                                                          blob);
+    if (source != nullptr) {
+        std::vector<open3d::io::ByteRange> ranges;
+        for (size_t i = 0; i < entries.size(); ++i) {
+            buffer_blobs[i] = std::make_shared<core::Blob>(
+                    std::max<int64_t>(entries[i].size_, 1),
+                    core::Device("CPU:0"));
+            ranges.push_back({static_cast<int64_t>(entries[i].offset_),
+                              static_cast<int64_t>(entries[i].size_),
+                              buffer_blobs[i]->GetDataPtr()});
+        }
+        if (!source->ReadRanges(ranges)) {
+            utility::LogWarning("Read O3DT failed: unable to read file: {}",
+                                filename);
+            return false;
+        }
+    }
+
+    reporter.SetTotal(entries.size());
+    attributes.clear();
+    for (size_t i = 0; i < entries.size(); ++i) {
+        const O3DTEntry &entry = entries[i];
+        core::Dtype dtype = GetO3DTDtypes()[entry.dtype_code_];
+        int64_t raw_size = entry.shape_.NumElements() * dtype.ByteSize();
+        const char *buffer =
+                source != nullptr
+                        ? static_cast<const char *>(
+                                  buffer_blobs[i]->GetDataPtr())
+                        : data + entry.offset_;
+        core::Tensor tensor;
+        if (entry.compression_ == O3DTCompression::None &&
+            entry.size_ == static_cast<uint64_t>(raw_size)) {
+            tensor = core::Tensor(
+                    entry.shape_, core::Tensor::DefaultStrides(entry.shape_),
+                    const_cast<char *>(buffer), dtype, buffer_blobs[i]);
+        } else if (entry.compression_ == O3DTCompression::LZF ||
+                   entry.compression_ == O3DTCompression::FilteredLZF) {
+            tensor = core::Tensor(entry.shape_, dtype);
+            int64_t row_size =
+                    entry.compression_ == O3DTCompression::FilteredLZF
+                            ? GetO3DTRowSize(entry.shape_, dtype)
+                            : 0;
+            if (!DecompressO3DTBuffer(
+                        buffer, entry.size_, entry.chunk_size_, raw_size,
+                        row_size,
+                        static_cast<char *>(tensor.GetDataPtr()))) {
+                utility::LogWarning(
+                        "Read O3DT failed: unable to decompress attribute {}.",
+                        entry.name_);
+                return false;
+            }
+        } else {
+            utility::LogWarning("Read O3DT failed: invalid attribute {}.",
+                                entry.name_);
+            return false;
+        }
+        // Uploads straight from the mapped or decompressed host memory.
+        if (device != tensor.GetDevice()) {
+            tensor = tensor.Copy(device);
+        }
+        attributes.push_back({entry.group_, entry.name_, tensor});
+        reporter.Update(attributes.size());
+    }
+    return true;
+}
+
+/// Compresses the chunks of \p chunk_size bytes of \p raw in parallel,
+/// filtering rows of \p row_size bytes first unless it is 0.
+static void CompressO3DTBuffer(const char *raw,
+                               int64_t raw_size,
+                               int64_t chunk_size,
+                               int64_t row_size,
+                               std::vector<char> &buffer) {
+    int64_t num_chunks = (raw_size + chunk_size - 1) / chunk_size;
+    std::vector<std::vector<char>> chunks(num_chunks);
+#pragma omp parallel for schedule(dynamic) num_threads(utility::EstimateMaxThreads())
+    for (int64_t c = 0; c < num_chunks; ++c) {
+        int64_t begin = c * chunk_size;
+        int64_t length = std::min(chunk_size, raw_size - begin);
+        const char *input = raw + begin;
+        std::vector<char> filtered;
+        if (row_size > 0) {
+            filtered.resize(length);
+            FilterO3DTChunk(input, length, row_size, filtered.data());
+            input = filtered.data();
+        }
+        chunks[c].resize(length);
+        // Chunks that do not shrink are stored as is.
+        unsigned int stored_size =
+                length > 1 ? lzf_compress(input,
+                                          static_cast<unsigned int>(length),
+                                          chunks[c].data(),
+                                          static_cast<unsigned int>(length - 1))
+                           : 0;
+        if (stored_size == 0) {
+            std::memcpy(chunks[c].data(), input, length);
+        } else {
+            chunks[c].resize(stored_size);
+        }
+    }
+    buffer.clear();
+    for (const std::vector<char> &chunk : chunks) {
+        AppendO3DTValue(buffer, static_cast<uint64_t>(chunk.size()));
+    }
+    for (const std::vector<char> &chunk : chunks) {
+        buffer.insert(buffer.end(), chunk.begin(), chunk.end());
+    }
+}
+
+static bool WriteO3DTAttributes(const std::string &filename,
+                                O3DTGeometryType geometry_type,
+                                const std::vector<O3DTAttribute> &attributes,
+                                bool compressed,
+                                utility::CountingProgressReporter &reporter) {
+    if (!IsLittleEndianHost()) {
+        utility::LogWarning(
+                "Write O3DT failed: big-endian hosts are not supported.");
+        return false;
+    }
+    const std::vector<core::Dtype> &dtypes = GetO3DTDtypes();
+    std::vector<core::Tensor> tensors;
+    std::vector<O3DTEntry> entries;
+    for (const O3DTAttribute &attribute : attributes) {
+        auto dtype_itr = std::find(dtypes.begin(), dtypes.end(),
+                                   attribute.tensor_.GetDtype());
+        if (dtype_itr == dtypes.end()) {
+            utility::LogWarning(
+                    "Write O3DT failed: attribute {} has unsupported dtype "
+                    "{}.",
+                    attribute.name_, attribute.tensor_.GetDtype().ToString());
+            return false;
+        }
+        tensors.push_back(attribute.tensor_.Contiguous().Copy(
+                core::Device("CPU:0")));
+        O3DTEntry entry;
+        entry.group_ = attribute.group_;
+        entry.dtype_code_ = static_cast<uint8_t>(dtype_itr - dtypes.begin());
+        entry.shape_ = attribute.tensor_.GetShape();
+        // Compressed chunks hold whole rows to be filtered, unless a row
+        // does not fit in a chunk.
+        int64_t row_size = GetO3DTRowSize(entry.shape_,
+                                          attribute.tensor_.GetDtype());
+        if (!compressed) {
+            entry.compression_ = O3DTCompression::None;
+            entry.chunk_size_ = 0;
+        } else if (row_size > 0 && row_size <= kO3DTChunkSize) {
+            entry.compression_ = O3DTCompression::FilteredLZF;
+            entry.chunk_size_ = kO3DTChunkSize / row_size * row_size;
+        } else {
+            entry.compression_ = O3DTCompression::LZF;
+            entry.chunk_size_ = kO3DTChunkSize;
+        }
+        entry.name_ = attribute.name_;
+        entries.push_back(entry);
+    }
+
+    // Compress the buffers first, as the table holds their sizes.
+    reporter.SetTotal(entries.size());
+    std::vector<std::vector<char>> compressed_buffers(entries.size());
+    int64_t table_size = 16;
+    for (size_t i = 0; i < entries.size(); ++i) {
+        int64_t raw_size = tensors[i].NumElements() *
+                           tensors[i].GetDtype().ByteSize();
+        if (compressed) {
+            int64_t row_size =
+                    entries[i].compression_ == O3DTCompression::FilteredLZF
+                            ? GetO3DTRowSize(entries[i].shape_,
+                                             tensors[i].GetDtype())
+                            : 0;
+            CompressO3DTBuffer(
+                    static_cast<const char *>(tensors[i].GetDataPtr()),
+                    raw_size, static_cast<int64_t>(entries[i].chunk_size_),
+                    row_size, compressed_buffers[i]);
+            entries[i].size_ = compressed_buffers[i].size();
+        } else {
+            entries[i].size_ = raw_size;
+        }
+        table_size += 8 + 8 * entries[i].shape_.size() + 24 +
+                      entries[i].name_.size();
+    }
+    int64_t offset = AlignO3DTOffset(table_size);
+    for (O3DTEntry &entry : entries) {
+        entry.offset_ = offset;
+        offset = AlignO3DTOffset(offset + entry.size_);
+    }
+
+    std::vector<char> header(kO3DTMagic, kO3DTMagic + sizeof(kO3DTMagic));
+    AppendO3DTValue(header, kO3DTVersion);
+    AppendO3DTValue(header, static_cast<uint32_t>(geometry_type));
+    AppendO3DTValue(header, static_cast<uint32_t>(entries.size()));
+    for (const O3DTEntry &entry : entries) {
+        AppendO3DTValue(header, entry.group_);
+        AppendO3DTValue(header, entry.dtype_code_);
+        AppendO3DTValue(header, static_cast<uint8_t>(entry.compression_));
+        AppendO3DTValue(header, static_cast<uint8_t>(entry.shape_.size()));
+        AppendO3DTValue(header, static_cast<uint32_t>(entry.name_.size()));
+        for (int64_t dim : entry.shape_) {
+            AppendO3DTValue(header, dim);
+        }
+        AppendO3DTValue(header, entry.offset_);
+        AppendO3DTValue(header, entry.size_);
+        AppendO3DTValue(header, entry.chunk_size_);
+        header.insert(header.end(), entry.name_.begin(), entry.name_.end());
+    }
+
+    // Write to a temporary file and rename it, so that geometries still
+    // viewing a mapping of the previous file keep their data.
+    const std::string temp_filename = filename + ".tmp";
+    utility::filesystem::CFile file;
+    if (!file.Open(temp_filename, "wb")) {
+        utility::LogWarning("Write O3DT failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    const std::vector<char> padding(kO3DTAlignment, 0);
+    int64_t position = header.size();
+    bool success =
+            fwrite(header.data(), 1, header.size(), file.GetFILE()) ==
+            header.size();
+    for (size_t i = 0; i < entries.size() && success; ++i) {
+        int64_t padding_size = entries[i].offset_ - position;
+        const char *buffer =
+                compressed ? compressed_buffers[i].data()
+                           : static_cast<const char *>(tensors[i].GetDataPtr());
+        success = fwrite(padding.data(), 1, padding_size, file.GetFILE()) ==
+                          static_cast<size_t>(padding_size) &&
+                  fwrite(buffer, 1, entries[i].size_, file.GetFILE()) ==
+                          entries[i].size_;
+        position = entries[i].offset_ + entries[i].size_;
+        reporter.Update(i + 1);
+    }
+    file.Close();
+#ifdef _WIN32
+    if (success) {
+        std::remove(filename.c_str());
+    }
+#endif
+    if (!success || std::rename(temp_filename.c_str(), filename.c_str()) != 0) {
+        std::remove(temp_filename.c_str());
+        utility::LogWarning("Write O3DT failed: unable to write file: {}",
+                            filename);
+        return false;
+    }
+    return true;
+}
+
+/// Lists the attributes of \p tensor_map with the primary key first, followed
+/// by the others in name order. Returns false if their lengths differ.
+static bool AppendO3DTAttributes(const geometry::TensorMap &tensor_map,
+                                 uint8_t group,
+                                 std::vector<O3DTAttribute> &attributes) {
+    const std::string primary_key = tensor_map.GetPrimaryKey();
+    std::vector<std::string> keys;
+    for (const auto &kv : tensor_map) {
+        if (kv.first != primary_key) {
+            keys.push_back(kv.first);
+        }
+    }
+    std::sort(keys.begin(), keys.end());
+    if (tensor_map.Contains(primary_key)) {
+        keys.insert(keys.begin(), primary_key);
+    }
+    for (const std::string &key : keys) {
+        const core::Tensor &tensor = tensor_map.at(key);
+        if (tensor.NumDims() == 0 ||
+            (tensor_map.Contains(primary_key) &&
+             tensor.GetLength() != tensor_map.at(primary_key).GetLength())) {
+            utility::LogWarning(
+                    "Write O3DT failed: attribute {} of shape {} does not "
+                    "match the length of {}.",
+                    key, tensor.GetShape(), primary_key);
+            return false;
+        }
+        attributes.push_back({group, key, tensor});
+    }
+    return true;
+}
+
+bool ReadPointCloudFromO3DT(const std::string &filename,
+                            geometry::PointCloud &pointcloud,
+                            const open3d::io::ReadPointCloudOption &params) {
+    try {
+        utility::CountingProgressReporter reporter(params.update_progress);
+        std::vector<O3DTAttribute> attributes;
+        if (!ReadO3DTAttributes(filename, O3DTGeometryType::PointCloud,
+                                pointcloud.GetDevice(), attributes,
+                                reporter)) {
+            return false;
+        }
+        pointcloud.Clear();
+        for (const O3DTAttribute &attribute : attributes) {
+            pointcloud.SetPointAttr(attribute.name_, attribute.tensor_);
+        }
+        reporter.Finish();
+        return true;
+    } catch (const std::exception &e) {
+        utility::LogWarning("Read O3DT failed with exception: {}", e.what());
+        return false;
+    }
+}
+
+bool WritePointCloudToO3DT(const std::string &filename,
+                           const geometry::PointCloud &pointcloud,
+                           const open3d::io::WritePointCloudOption &params) {
+    try {
+        utility::CountingProgressReporter reporter(params.update_progress);
+        std::vector<O3DTAttribute> attributes;
+        if (!AppendO3DTAttributes(pointcloud.GetPointAttr(), 0, attributes) ||
+            !WriteO3DTAttributes(filename, O3DTGeometryType::PointCloud,
+                                 attributes, bool(params.compressed),
+                                 reporter)) {
+            return false;
+        }
+        reporter.Finish();
+        return true;
+    } catch (const std::exception &e) {
+        utility::LogWarning("Write O3DT failed with exception: {}", e.what());
+        return false;
+    }
+}
+
+bool ReadTriangleMeshFromO3DT(const std::string &filename,
+                              geometry::TriangleMesh &mesh,
+                              bool print_progress) {
+    try {
+        utility::ConsoleProgressUpdater progress_updater(
+                "Reading O3DT file: " + filename, print_progress);
+        utility::CountingProgressReporter reporter(progress_updater);
+        std::vector<O3DTAttribute> attributes;
+        if (!ReadO3DTAttributes(filename, O3DTGeometryType::TriangleMesh,
+                                mesh.GetDevice(), attributes, reporter)) {
+            return false;
+        }
+        mesh.Clear();
+        for (const O3DTAttribute &attribute : attributes) {
+            if (attribute.group_ == 0) {
+                mesh.SetVertexAttr(attribute.name_, attribute.tensor_);
+            } else {
+                mesh.SetTriangleAttr(attribute.name_, attribute.tensor_);
+            }
+        }
+        reporter.Finish();
+        return true;
+    } catch (const std::exception &e) {
+        utility::LogWarning("Read O3DT failed with exception: {}", e.what());
+        return false;
+    }
+}
+
+bool WriteTriangleMeshToO3DT(const std::string &filename,
+                             const geometry::TriangleMesh &mesh,
+                             bool write_ascii,
+                             bool compressed,
+                             bool print_progress) {
+    try {
+        utility::ConsoleProgressUpdater progress_updater(
+                "Writing O3DT file: " + filename, print_progress);
+        utility::CountingProgressReporter reporter(progress_updater);
+        std::vector<O3DTAttribute> attributes;
+        if (!AppendO3DTAttributes(mesh.GetVertexAttr(), 0, attributes) ||
+            !AppendO3DTAttributes(mesh.GetTriangleAttr(), 1, attributes) ||
+            !WriteO3DTAttributes(filename, O3DTGeometryType::TriangleMesh,
+                                 attributes, compressed, reporter)) {
+            return false;
+        }
+        reporter.Finish();
+        return true;
+    } catch (const std::exception &e) {
+        utility::LogWarning("Write O3DT failed with exception: {}", e.what());
+        return false;
+    }
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,341 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/io/TriangleMeshIO.h"
+#include "open3d/utility/ASCIIParser.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Parallel.h"
+#include "open3d/utility/ProgressReporters.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+/// Elements of the lines of a range of an OBJ file. Negative indices are
+/// relative to the number of elements before their line, which is only known
+/// within the range while parsing: they are stored relative to the start of
+/// the range, and their positions are recorded to be offset later.
+struct OBJRange {
+    std::vector<float> vertices_;
+    std::vector<float> colors_;
+    std::vector<float> normals_;
+    /// Vertex indices of the triangle corners.
+    std::vector<int64_t> corners_;
+    /// Normal indices of the triangle corners, -1 for no normal.
+    std::vector<int64_t> corner_normals_;
+    std::vector<int64_t> relative_corners_;
+    std::vector<int64_t> relative_corner_normals_;
+    /// Vertex indices, normal indices and whether they are relative, of the
+    /// polygon being parsed.
+    std::vector<int64_t> polygon_;
+    std::vector<int64_t> polygon_normals_;
+    std::vector<uint8_t> polygon_relative_;
+    bool success_ = true;
+};
+
+/// Parses the numbers after the keyword of a line into \p values, and returns
+/// how many were parsed, up to \p max_count.
+static int ParseOBJValues(const char *p,
+                          const char *line_end,
+                          int max_count,
+                          float *values) {
+    int count = 0;
+    for (; count < max_count; ++count) {
+        double value;
+        p = utility::SkipASCIISpaces(p, line_end);
+        const char *next = utility::ParseDouble(p, line_end, value);
+        if (next == p) {
+            break;
+        }
+        values[count] = static_cast<float>(value);
+        p = next;
+    }
+    return count;
+}
+
+/// Converts the 1-based or negative OBJ index \p index of an element among
+/// \p num_range_elements elements of the range to a 0-based index, and
+/// returns whether it is relative to the start of the range.
+static bool ResolveOBJIndex(int64_t &index, int64_t num_range_elements) {
+    if (index < 0) {
+        index += num_range_elements;
+        return true;
+    }
+    index -= 1;
+    return false;
+}
+
+/// Parses a face line into triangles by fan triangulation. Texture
+/// coordinate indices are skipped.
+static bool ParseOBJFace(const char *p, const char *line_end, OBJRange &range) {
+    const int64_t num_vertices =
+            static_cast<int64_t>(range.vertices_.size()) / 3;
+    const int64_t num_normals = static_cast<int64_t>(range.normals_.size()) / 3;
+    range.polygon_.clear();
+    range.polygon_normals_.clear();
+    range.polygon_relative_.clear();
+    while (true) {
+        p = utility::SkipASCIISpaces(p, line_end);
+        if (p == line_end) {
+            break;
+        }
+        int64_t index, texture_index, normal_index = 0;
+        const char *next = utility::ParseInt64(p, line_end, index);
+        if (next == p || index == 0) {
+            return false;
+        }
+        p = next;
+        if (p < line_end && *p == '/') {
+            p = utility::ParseInt64(p + 1, line_end, texture_index);
+            if (p < line_end && *p == '/') {
+                next = utility::ParseInt64(p + 1, line_end, normal_index);
+                if (next == p + 1 || normal_index == 0) {
+                    return false;
+                }
+                p = next;
+            }
+        }
+        uint8_t relative = ResolveOBJIndex(index, num_vertices) ? 1 : 0;
+        if (normal_index == 0) {
+            normal_index = -1;
+        } else if (ResolveOBJIndex(normal_index, num_normals)) {
+            relative |= 2;
+        }
+        range.polygon_.push_back(index);
+        range.polygon_normals_.push_back(normal_index);
+        range.polygon_relative_.push_back(relative);
+    }
+    if (range.polygon_.size() < 3) {
+        return range.polygon_.empty();
+    }
+
+    auto add_corner = [&range](size_t k) {
+        int64_t position = static_cast<int64_t>(range.corners_.size());
+        range.corners_.push_back(range.polygon_[k]);
+        range.corner_normals_.push_back(range.polygon_normals_[k]);
+        if (range.polygon_relative_[k] & 1) {
+            range.relative_corners_.push_back(position);
+        }
+        if (range.polygon_relative_[k] & 2) {
+            range.relative_corner_normals_.push_back(position);
+        }
+    };
+    for (size_t k = 2; k < range.polygon_.size(); ++k) {
+        add_corner(0);
+        add_corner(k - 1);
+        add_corner(k);
+    }
+    return true;
+}
+
+static void ParseOBJRange(const char *begin,
+                          const char *end,
+                          OBJRange &range) {
+    const char *line = begin;
+    while (line < end && range.success_) {
+        const char *line_end = static_cast<const char *>(
+                std::memchr(line, '\n', end - line));
+        line_end = line_end ? line_end : end;
+        const char *p = utility::SkipASCIISpaces(line, line_end);
+        float values[6];
+        if (line_end - p >= 2 && p[0] == 'v' && p[1] == ' ') {
+            // Vertex colors follow the position.
+            int count = ParseOBJValues(p + 2, line_end, 6, values);
+            range.success_ = count >= 3;
+            range.vertices_.insert(range.vertices_.end(), values, values + 3);
+            if (count == 6) {
+                range.colors_.insert(range.colors_.end(), values + 3,
+                                     values + 6);
+            }
+        } else if (line_end - p >= 3 && p[0] == 'v' && p[1] == 'n' &&
+                   p[2] == ' ') {
+            range.success_ = ParseOBJValues(p + 3, line_end, 3, values) == 3;
+            range.normals_.insert(range.normals_.end(), values, values + 3);
+        } else if (line_end - p >= 2 && p[0] == 'f' && p[1] == ' ') {
+            range.success_ = ParseOBJFace(p + 2, line_end, range);
+        }
+        line = line_end < end ? line_end + 1 : end;
+    }
+}
+
+bool ReadTriangleMeshFromOBJ(const std::string &filename,
+                             geometry::TriangleMesh &mesh,
+                             bool print_progress) {
+    try {
+        utility::ConsoleProgressUpdater progress_updater(
+                "Reading OBJ file: " + filename, print_progress);
+        utility::CountingProgressReporter reporter(progress_updater);
+        utility::ASCIIFileView view;
+        if (!view.Open(filename)) {
+            utility::LogWarning("Read OBJ failed: unable to open file: {}",
+                                filename);
+            return false;
+        }
+        const char *data = view.GetData();
+        std::vector<const char *> range_begins = utility::SplitASCIIRanges(
+                data, data + view.GetSize(), 1 << 20);
+        int64_t num_ranges = static_cast<int64_t>(range_begins.size()) - 1;
+        std::vector<OBJRange> ranges(num_ranges);
+#pragma omp parallel for schedule(dynamic) num_threads(utility::EstimateMaxThreads())
+        for (int64_t r = 0; r < num_ranges; ++r) {
+            ParseOBJRange(range_begins[r], range_begins[r + 1], ranges[r]);
+        }
+        for (const OBJRange &range : ranges) {
+            if (!range.success_) {
+                utility::LogWarning("Read OBJ failed: malformed line in: {}",
+                                    filename);
+                return false;
+            }
+        }
+        reporter.Update(50);
+
+        // Offsets of the elements of the ranges, from their prefix sums.
+        std::vector<int64_t> vertex_offsets(num_ranges + 1, 0);
+        std::vector<int64_t> color_offsets(num_ranges + 1, 0);
+        std::vector<int64_t> normal_offsets(num_ranges + 1, 0);
+        std::vector<int64_t> corner_offsets(num_ranges + 1, 0);
+        for (int64_t r = 0; r < num_ranges; ++r) {
+            vertex_offsets[r + 1] = vertex_offsets[r] +
+                                    ranges[r].vertices_.size() / 3;
+            color_offsets[r + 1] =
+                    color_offsets[r] + ranges[r].colors_.size() / 3;
+            normal_offsets[r + 1] =
+                    normal_offsets[r] + ranges[r].normals_.size() / 3;
+            corner_offsets[r + 1] =
+                    corner_offsets[r] + ranges[r].corners_.size();
+        }
+        int64_t num_vertices = vertex_offsets[num_ranges];
+        int64_t num_normals = normal_offsets[num_ranges];
+        int64_t num_corners = corner_offsets[num_ranges];
+        // Colors are only kept when all the vertices have them.
+        bool has_colors =
+                num_vertices > 0 && color_offsets[num_ranges] == num_vertices;
+
+        core::Tensor vertices({num_vertices, 3}, core::Dtype::Float32);
+        core::Tensor colors({has_colors ? num_vertices : 0, 3},
+                            core::Dtype::Float32);
+        core::Tensor triangles({num_corners / 3, 3}, core::Dtype::Int64);
+        std::vector<int64_t> corner_normals(num_normals > 0 ? num_corners : 0);
+        float *vertices_ptr = static_cast<float *>(vertices.GetDataPtr());
+        float *colors_ptr = static_cast<float *>(colors.GetDataPtr());
+        int64_t *triangles_ptr = static_cast<int64_t *>(triangles.GetDataPtr());
+        std::vector<float> normals(num_normals * 3);
+        bool valid_indices = true;
+#pragma omp parallel for schedule(dynamic) reduction(&& : valid_indices) num_threads(utility::EstimateMaxThreads())
+        for (int64_t r = 0; r < num_ranges; ++r) {
+            OBJRange &range = ranges[r];
+            for (int64_t position : range.relative_corners_) {
+                range.corners_[position] += vertex_offsets[r];
+            }
+            for (int64_t position : range.relative_corner_normals_) {
+                range.corner_normals_[position] += normal_offsets[r];
+            }
+            std::copy(range.vertices_.begin(), range.vertices_.end(),
+                      vertices_ptr + 3 * vertex_offsets[r]);
+            if (has_colors) {
+                std::copy(range.colors_.begin(), range.colors_.end(),
+                          colors_ptr + 3 * color_offsets[r]);
+            }
+            std::copy(range.normals_.begin(), range.normals_.end(),
+                      normals.begin() + 3 * normal_offsets[r]);
+            for (size_t k = 0; k < range.corners_.size(); ++k) {
+                int64_t index = range.corners_[k];
+                int64_t normal_index = range.corner_normals_[k];
+                valid_indices = valid_indices && index >= 0 &&
+                                index < num_vertices && normal_index >= -1 &&
+                                normal_index < num_normals;
+                triangles_ptr[corner_offsets[r] + k] = index;
+                if (num_normals > 0) {
+                    corner_normals[corner_offsets[r] + k] = normal_index;
+                }
+            }
+        }
+        if (!valid_indices) {
+            utility::LogWarning("Read OBJ failed: index out of range in: {}",
+                                filename);
+            return false;
+        }
+        reporter.Update(80);
+
+        // A vertex takes the normal of its first corner that has one. The
+        // normals are only kept when all the vertices have one.
+        core::Tensor vertex_normals;
+        if (num_normals > 0) {
+            vertex_normals = core::Tensor({num_vertices, 3},
+                                          core::Dtype::Float32);
+            float *vertex_normals_ptr =
+                    static_cast<float *>(vertex_normals.GetDataPtr());
+            std::vector<bool> has_normal(num_vertices, false);
+            int64_t num_vertex_normals = 0;
+            for (int64_t k = 0; k < num_corners; ++k) {
+                int64_t index = triangles_ptr[k];
+                int64_t normal_index = corner_normals[k];
+                if (normal_index >= 0 && !has_normal[index]) {
+                    std::copy(normals.begin() + 3 * normal_index,
+                              normals.begin() + 3 * normal_index + 3,
+                              vertex_normals_ptr + 3 * index);
+                    has_normal[index] = true;
+                    ++num_vertex_normals;
+                }
+            }
+            if (num_vertex_normals != num_vertices) {
+                vertex_normals = core::Tensor();
+            }
+        }
+
+        core::Device device = mesh.GetDevice();
+        auto to_device = [&device](const core::Tensor &tensor) {
+            return tensor.GetDevice() == device ? tensor : tensor.Copy(device);
+        };
+        mesh = geometry::TriangleMesh(device);
+        mesh.SetVertices(to_device(vertices));
+        mesh.SetTriangles(to_device(triangles));
+        if (has_colors) {
+            mesh.SetVertexColors(to_device(colors));
+        }
+        if (vertex_normals.NumElements() > 0) {
+            mesh.SetVertexNormals(to_device(vertex_normals));
+        }
+        reporter.Finish();
+        return true;
+    } catch (const std::exception &e) {
+        utility::LogWarning("Read OBJ failed with exception: {}", e.what());
+        return false;
+    }
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,277 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/io/TriangleMeshIO.h"
+#include "open3d/utility/ASCIIParser.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Parallel.h"
+#include "open3d/utility/ProgressReporters.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+/// Returns the end of the line at \p line, without the newline.
+static const char *GetOFFLineEnd(const char *line, const char *end) {
+    const char *line_end =
+            static_cast<const char *>(std::memchr(line, '\n', end - line));
+    return line_end ? line_end : end;
+}
+
+/// Returns whether the line has data, i.e. is not blank or a comment.
+static bool IsOFFDataLine(const char *line, const char *line_end) {
+    const char *p = utility::SkipASCIISpaces(line, line_end);
+    return p < line_end && *p != '#';
+}
+
+/// Returns the next data line at or after \p line, or \p end.
+static const char *NextOFFDataLine(const char *line, const char *end) {
+    while (line < end) {
+        const char *line_end = GetOFFLineEnd(line, end);
+        if (IsOFFDataLine(line, line_end)) {
+            return line;
+        }
+        line = line_end < end ? line_end + 1 : end;
+    }
+    return end;
+}
+
+/// Parses \p count numbers of the line at \p p and advances \p p past them.
+static bool ParseOFFValues(const char *&p,
+                           const char *line_end,
+                           int count,
+                           double *values) {
+    for (int c = 0; c < count; ++c) {
+        p = utility::SkipASCIISpaces(p, line_end);
+        const char *next = utility::ParseDouble(p, line_end, values[c]);
+        if (next == p) {
+            return false;
+        }
+        p = next;
+    }
+    return true;
+}
+
+bool ReadTriangleMeshFromOFF(const std::string &filename,
+                             geometry::TriangleMesh &mesh,
+                             bool print_progress) {
+    try {
+        utility::ConsoleProgressUpdater progress_updater(
+                "Reading OFF file: " + filename, print_progress);
+        utility::CountingProgressReporter reporter(progress_updater);
+        utility::ASCIIFileView view;
+        if (!view.Open(filename)) {
+            utility::LogWarning("Read OFF failed: unable to open file: {}",
+                                filename);
+            return false;
+        }
+        const char *data = view.GetData();
+        const char *end = data + view.GetSize();
+
+        const char *line = NextOFFDataLine(data, end);
+        const char *line_end = GetOFFLineEnd(line, end);
+        std::string header(utility::SkipASCIISpaces(line, line_end),
+                           line_end);
+        header = header.substr(0, header.find_last_not_of(" \t\r") + 1);
+        if (header != "OFF" && header != "COFF" && header != "NOFF" &&
+            header != "CNOFF") {
+            utility::LogWarning(
+                    "Read OFF failed: header keyword '{}' not supported.",
+                    header);
+            return false;
+        }
+        bool has_normals = header == "NOFF" || header == "CNOFF";
+        bool has_colors = header == "COFF" || header == "CNOFF";
+
+        line = NextOFFDataLine(line_end < end ? line_end + 1 : end, end);
+        line_end = GetOFFLineEnd(line, end);
+        double counts[3];
+        const char *p = line;
+        if (!ParseOFFValues(p, line_end, 3, counts)) {
+            utility::LogWarning("Read OFF failed: could not read file info.");
+            return false;
+        }
+        int64_t num_vertices = static_cast<int64_t>(counts[0]);
+        int64_t num_faces = static_cast<int64_t>(counts[1]);
+        if (num_vertices <= 0 || num_faces <= 0) {
+            utility::LogWarning(
+                    "Read OFF failed: mesh has no vertices or faces.");
+            return false;
+        }
+
+        // The data lines are located in parallel, then the vertex and face
+        // lines are parsed by index.
+        std::vector<const char *> range_begins = utility::SplitASCIIRanges(
+                line_end < end ? line_end + 1 : end, end, 1 << 20);
+        int64_t num_ranges = static_cast<int64_t>(range_begins.size()) - 1;
+        std::vector<std::vector<const char *>> range_lines(num_ranges);
+#pragma omp parallel for schedule(dynamic) num_threads(utility::EstimateMaxThreads())
+        for (int64_t r = 0; r < num_ranges; ++r) {
+            const char *range_line = range_begins[r];
+            while (range_line < range_begins[r + 1]) {
+                const char *range_line_end =
+                        GetOFFLineEnd(range_line, range_begins[r + 1]);
+                if (IsOFFDataLine(range_line, range_line_end)) {
+                    range_lines[r].push_back(range_line);
+                }
+                range_line = range_line_end + 1;
+            }
+        }
+        std::vector<const char *> lines;
+        for (const std::vector<const char *> &r : range_lines) {
+            lines.insert(lines.end(), r.begin(), r.end());
+        }
+        if (static_cast<int64_t>(lines.size()) < num_vertices + num_faces) {
+            utility::LogWarning("Read OFF failed: file is truncated.");
+            return false;
+        }
+        reporter.Update(20);
+
+        core::Tensor vertices({num_vertices, 3}, core::Dtype::Float32);
+        core::Tensor normals({has_normals ? num_vertices : 0, 3},
+                             core::Dtype::Float32);
+        core::Tensor colors({has_colors ? num_vertices : 0, 3},
+                            core::Dtype::Float32);
+        float *vertices_ptr = static_cast<float *>(vertices.GetDataPtr());
+        float *normals_ptr = static_cast<float *>(normals.GetDataPtr());
+        float *colors_ptr = static_cast<float *>(colors.GetDataPtr());
+        bool valid_vertices = true;
+#pragma omp parallel for schedule(static) reduction(&& : valid_vertices) num_threads(utility::EstimateMaxThreads())
+        for (int64_t i = 0; i < num_vertices; ++i) {
+            const char *p = lines[i];
+            const char *line_end = GetOFFLineEnd(p, end);
+            double values[4];
+            bool valid = ParseOFFValues(p, line_end, 3, values);
+            for (int k = 0; k < 3; ++k) {
+                vertices_ptr[3 * i + k] = static_cast<float>(values[k]);
+            }
+            if (valid && has_normals) {
+                valid = ParseOFFValues(p, line_end, 3, values);
+                for (int k = 0; k < 3; ++k) {
+                    normals_ptr[3 * i + k] = static_cast<float>(values[k]);
+                }
+            }
+            if (valid && has_colors) {
+                valid = ParseOFFValues(p, line_end, 4, values);
+                for (int k = 0; k < 3; ++k) {
+                    colors_ptr[3 * i + k] =
+                            static_cast<float>(values[k] / 255.0);
+                }
+            }
+            valid_vertices = valid_vertices && valid;
+        }
+        if (!valid_vertices) {
+            utility::LogWarning(
+                    "Read OFF failed: could not read all vertex values.");
+            return false;
+        }
+        reporter.Update(50);
+
+        // Polygons are triangulated as fans, at the offsets of the prefix sum
+        // of their numbers of triangles.
+        std::vector<int64_t> triangle_offsets(num_faces + 1, 0);
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+        for (int64_t f = 0; f < num_faces; ++f) {
+            const char *p = lines[num_vertices + f];
+            int64_t n = 0;
+            utility::ParseInt64(utility::SkipASCIISpaces(p, end), end, n);
+            triangle_offsets[f + 1] = std::max<int64_t>(n - 2, 0);
+        }
+        for (int64_t f = 0; f < num_faces; ++f) {
+            triangle_offsets[f + 1] += triangle_offsets[f];
+        }
+        int64_t num_triangles = triangle_offsets[num_faces];
+        core::Tensor triangles({num_triangles, 3}, core::Dtype::Int64);
+        int64_t *triangles_ptr = static_cast<int64_t *>(triangles.GetDataPtr());
+        bool valid_faces = true;
+#pragma omp parallel for schedule(static) reduction(&& : valid_faces) num_threads(utility::EstimateMaxThreads())
+        for (int64_t f = 0; f < num_faces; ++f) {
+            const char *p = lines[num_vertices + f];
+            const char *line_end = GetOFFLineEnd(p, end);
+            int64_t n = 0;
+            p = utility::ParseInt64(utility::SkipASCIISpaces(p, line_end),
+                                    line_end, n);
+            int64_t *triangle = triangles_ptr + 3 * triangle_offsets[f];
+            int64_t first = 0, previous = 0;
+            bool valid = n >= 3;
+            for (int64_t k = 0; k < n && valid; ++k) {
+                int64_t index;
+                p = utility::SkipASCIISpaces(p, line_end);
+                const char *next = utility::ParseInt64(p, line_end, index);
+                valid = next != p && index >= 0 && index < num_vertices;
+                p = next;
+                if (k == 0) {
+                    first = index;
+                } else if (k >= 2) {
+                    triangle[0] = first;
+                    triangle[1] = previous;
+                    triangle[2] = index;
+                    triangle += 3;
+                }
+                previous = index;
+            }
+            valid_faces = valid_faces && valid;
+        }
+        if (!valid_faces) {
+            utility::LogWarning(
+                    "Read OFF failed: could not read all vertex indices.");
+            return false;
+        }
+
+        core::Device device = mesh.GetDevice();
+        auto to_device = [&device](const core::Tensor &tensor) {
+            return tensor.GetDevice() == device ? tensor : tensor.Copy(device);
+        };
+        mesh = geometry::TriangleMesh(device);
+        mesh.SetVertices(to_device(vertices));
+        mesh.SetTriangles(to_device(triangles));
+        if (has_normals) {
+            mesh.SetVertexNormals(to_device(normals));
+        }
+        if (has_colors) {
+            mesh.SetVertexColors(to_device(colors));
+        }
+        reporter.Finish();
+        return true;
+    } catch (const std::exception &e) {
+        utility::LogWarning("Read OFF failed with exception: {}", e.what());
+        return false;
+    }
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,870 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include <liblzf/lzf.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <sstream>
+#include <type_traits>
+#include <unordered_map>
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/io/ByteSource.h"
+#include "open3d/io/FileFormatIO.h"
+#include "open3d/t/io/PointCloudIO.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Helper.h"
+#include "open3d/utility/Parallel.h"
+#include "open3d/utility/ProgressReporters.h"
+
+// References for PCD file IO
+// http://pointclouds.org/documentation/tutorials/pcd_file_format.html
+// https://github.com/PointCloudLibrary/pcl/blob/master/io/src/pcd_io.cpp
+
+namespace open3d {
+namespace t {
+namespace io {
+
+enum class PCDDataType { ASCII = 0, BINARY = 1, BINARY_COMPRESSED = 2 };
+
+struct PCDField {
+    std::string name_;
+    int64_t size_;
+    char type_;
+    int64_t count_;
+    // Byte offset of the field in a binary row.
+    int64_t offset_;
+    // Index of the first token of the field in an ASCII line.
+    int64_t count_offset_;
+};
+
+struct PCDHeader {
+    std::vector<PCDField> fields_;
+    int64_t width_ = 0;
+    int64_t height_ = 1;
+    int64_t points_ = -1;
+    PCDDataType datatype_ = PCDDataType::ASCII;
+    // Number of ASCII tokens and bytes of a point.
+    int64_t elementnum_ = 0;
+    int64_t pointsize_ = 0;
+};
+
+/// Attribute read from the fields of a PCD file. The columns of a field are
+/// \p column_ to \p column_ + count - 1 of the attribute.
+struct PCDAttribute {
+    std::string name_;
+    core::Tensor data_;
+    std::vector<std::pair<const PCDField *, int64_t>> fields_;
+    // Colors are unpacked from the bytes of a 32-bit rgb field.
+    bool is_packed_rgb_ = false;
+};
+
+/// Returns the dtype of the tensor of a field. Types without a tensor dtype
+/// are widened: I1 to Int16 and U4 to Int64.
+static core::Dtype GetDtypeFromPCDField(char type, int64_t size) {
+    if (type == 'F' && size == 4) {
+        return core::Dtype::Float32;
+    } else if (type == 'F' && size == 8) {
+        return core::Dtype::Float64;
+    } else if (type == 'U' && size == 1) {
+        return core::Dtype::UInt8;
+    } else if (type == 'U' && size == 2) {
+        return core::Dtype::UInt16;
+    } else if (type == 'U' && size == 4) {
+        return core::Dtype::Int64;
+    } else if (type == 'I' && (size == 1 || size == 2)) {
+        return core::Dtype::Int16;
+    } else if (type == 'I' && size == 4) {
+        return core::Dtype::Int32;
+    } else if (type == 'I' && size == 8) {
+        return core::Dtype::Int64;
+    } else {
+        return core::Dtype::Undefined;
+    }
+}
+
+static bool GetPCDFieldFromDtype(const core::Dtype &dtype,
+                                 char &type,
+                                 int64_t &size) {
+    size = dtype.ByteSize();
+    if (dtype == core::Dtype::Float32 || dtype == core::Dtype::Float64) {
+        type = 'F';
+    } else if (dtype == core::Dtype::UInt8 || dtype == core::Dtype::UInt16) {
+        type = 'U';
+    } else if (dtype == core::Dtype::Int16 || dtype == core::Dtype::Int32 ||
+               dtype == core::Dtype::Int64) {
+        type = 'I';
+    } else {
+        return false;
+    }
+    return true;
+}
+
+/// Reads the header of a PCD file from \p source in blocks until its DATA
+/// line, and sets \p body_begin to the offset of the data that follows.
+static bool ReadPCDHeader(open3d::io::ByteSource &source,
+                          PCDHeader &header,
+                          int64_t &body_begin) {
+    const int64_t block_size = 1 << 12;
+    const int64_t file_size = source.GetSize();
+    std::vector<char> prefix;
+    std::vector<std::string> names, sizes, types, counts;
+    bool has_data = false;
+    int64_t line_begin = 0;
+    while (!has_data && line_begin < file_size) {
+        const char *line_end = nullptr;
+        while (true) {
+            int64_t prefix_size = static_cast<int64_t>(prefix.size());
+            if (prefix_size > line_begin) {
+                line_end = static_cast<const char *>(
+                        std::memchr(prefix.data() + line_begin, '\n',
+                                    prefix_size - line_begin));
+            }
+            if (line_end != nullptr || prefix_size == file_size) {
+                break;
+            }
+            int64_t read_size = std::min(block_size, file_size - prefix_size);
+            prefix.resize(prefix_size + read_size);
+            if (!source.Read(prefix_size, read_size,
+                             prefix.data() + prefix_size)) {
+                utility::LogWarning("Read PCD failed: unable to read header.");
+                return false;
+            }
+        }
+        int64_t line_next = line_end != nullptr
+                                    ? line_end + 1 - prefix.data()
+                                    : static_cast<int64_t>(prefix.size());
+        std::string line(prefix.data() + line_begin,
+                         prefix.data() + line_next);
+        line_begin = line_next;
+
+        std::vector<std::string> st;
+        utility::SplitString(st, line, "\t\r\n ");
+        if (st.empty() || st[0][0] == '#') {
+            continue;
+        }
+        std::vector<std::string> values(st.begin() + 1, st.end());
+        if (st[0] == "FIELDS" || st[0] == "COLUMNS") {
+            names = values;
+        } else if (st[0] == "SIZE") {
+            sizes = values;
+        } else if (st[0] == "TYPE") {
+            types = values;
+        } else if (st[0] == "COUNT") {
+            counts = values;
+        } else if (st[0] == "WIDTH" && !values.empty()) {
+            header.width_ = std::strtoll(values[0].c_str(), nullptr, 10);
+        } else if (st[0] == "HEIGHT" && !values.empty()) {
+            header.height_ = std::strtoll(values[0].c_str(), nullptr, 10);
+        } else if (st[0] == "POINTS" && !values.empty()) {
+            header.points_ = std::strtoll(values[0].c_str(), nullptr, 10);
+        } else if (st[0] == "DATA") {
+            header.datatype_ = PCDDataType::ASCII;
+            if (!values.empty() && values[0] == "binary_compressed") {
+                header.datatype_ = PCDDataType::BINARY_COMPRESSED;
+            } else if (!values.empty() && values[0] == "binary") {
+                header.datatype_ = PCDDataType::BINARY;
+            }
+            has_data = true;
+        }
+    }
+    body_begin = line_begin;
+    if (!has_data || names.empty() ||
+        (!sizes.empty() && sizes.size() != names.size()) ||
+        (!types.empty() && types.size() != names.size()) ||
+        (!counts.empty() && counts.size() != names.size())) {
+        utility::LogWarning("Read PCD failed: bad PCD file format.");
+        return false;
+    }
+    if (header.points_ < 0) {
+        header.points_ = header.width_ * header.height_;
+    }
+
+    // Fields default to F4 with a count of 1.
+    for (size_t i = 0; i < names.size(); ++i) {
+        PCDField field;
+        field.name_ = names[i];
+        field.size_ = sizes.empty() ? 4
+                                    : std::strtoll(sizes[i].c_str(), nullptr,
+                                                   10);
+        field.type_ = types.empty() ? 'F' : types[i][0];
+        field.count_ = counts.empty() ? 1
+                                      : std::strtoll(counts[i].c_str(),
+                                                     nullptr, 10);
+        field.offset_ = header.pointsize_;
+        field.count_offset_ = header.elementnum_;
+        header.pointsize_ += field.size_ * field.count_;
+        header.elementnum_ += field.count_;
+        header.fields_.push_back(field);
+    }
+    if (header.points_ <= 0 || header.pointsize_ <= 0) {
+        utility::LogWarning("Read PCD failed: PCD has no data.");
+        return false;
+    }
+    return true;
+}
+
+/// Groups the fields into attributes: x, y, z into points, normal_x,
+/// normal_y, normal_z into normals, rgb or rgba into UInt8 colors, and each
+/// other field into an {N, count} attribute of the same name.
+static bool CreatePCDAttributes(const PCDHeader &header,
+                                std::vector<PCDAttribute> &attributes) {
+    std::unordered_map<std::string, const PCDField *> name_to_field;
+    for (const PCDField &field : header.fields_) {
+        name_to_field[field.name_] = &field;
+    }
+    const std::vector<std::pair<std::string, std::vector<std::string>>>
+            base_attributes = {{"points", {"x", "y", "z"}},
+                               {"normals",
+                                {"normal_x", "normal_y", "normal_z"}}};
+    for (const auto &base_attribute : base_attributes) {
+        const std::vector<std::string> &names = base_attribute.second;
+        bool has_fields = true;
+        for (const std::string &name : names) {
+            has_fields = has_fields && name_to_field.count(name) != 0 &&
+                         name_to_field.at(name)->count_ == 1 &&
+                         name_to_field.at(name)->type_ ==
+                                 name_to_field.at(names[0])->type_ &&
+                         name_to_field.at(name)->size_ ==
+                                 name_to_field.at(names[0])->size_;
+        }
+        const PCDField *first =
+                has_fields ? name_to_field.at(names[0]) : nullptr;
+        if (has_fields && GetDtypeFromPCDField(first->type_, first->size_) !=
+                                  core::Dtype::Undefined) {
+            PCDAttribute attribute;
+            attribute.name_ = base_attribute.first;
+            attribute.data_ = core::Tensor(
+                    {header.points_, 3},
+                    GetDtypeFromPCDField(first->type_, first->size_));
+            for (int64_t c = 0; c < 3; ++c) {
+                attribute.fields_.push_back({name_to_field.at(names[c]), c});
+                name_to_field.erase(names[c]);
+            }
+            attributes.push_back(attribute);
+        }
+    }
+    if (attributes.empty() || attributes[0].name_ != "points") {
+        utility::LogWarning("Read PCD failed: fields for points are missing.");
+        return false;
+    }
+
+    for (const PCDField &field : header.fields_) {
+        if (name_to_field.count(field.name_) == 0) {
+            continue;
+        }
+        PCDAttribute attribute;
+        if ((field.name_ == "rgb" || field.name_ == "rgba") &&
+            field.size_ == 4 && field.count_ == 1) {
+            attribute.name_ = "colors";
+            attribute.data_ =
+                    core::Tensor({header.points_, 3}, core::Dtype::UInt8);
+            attribute.is_packed_rgb_ = true;
+        } else if (field.name_ != "_" &&
+                   GetDtypeFromPCDField(field.type_, field.size_) !=
+                           core::Dtype::Undefined) {
+            attribute.name_ = field.name_;
+            attribute.data_ = core::Tensor(
+                    {header.points_, field.count_},
+                    GetDtypeFromPCDField(field.type_, field.size_));
+        } else {
+            if (field.name_ != "_") {
+                utility::LogWarning(
+                        "Read PCD warning: skipping field \"{}\", unsupported "
+                        "type {}{}.",
+                        field.name_, field.type_, field.size_);
+            }
+            continue;
+        }
+        attribute.fields_.push_back({&field, 0});
+        attributes.push_back(attribute);
+        name_to_field.erase(field.name_);
+    }
+    return true;
+}
+
+template <typename src_t, typename dst_t>
+static void UnpackColumn(const char *src,
+                         int64_t src_stride,
+                         int64_t num_points,
+                         dst_t *dst,
+                         int64_t dst_stride) {
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < num_points; ++i) {
+        src_t value;
+        std::memcpy(&value, src + i * src_stride, sizeof(src_t));
+        dst[i * dst_stride] = static_cast<dst_t>(value);
+    }
+}
+
+/// Converts the binary elements of a column of type \p type and size \p size
+/// to the dtype of \p dst, in parallel over the points.
+template <typename dst_t>
+static void UnpackColumn(char type,
+                         int64_t size,
+                         const char *src,
+                         int64_t src_stride,
+                         int64_t num_points,
+                         dst_t *dst,
+                         int64_t dst_stride) {
+    if (type == 'F' && size == 4) {
+        UnpackColumn<float>(src, src_stride, num_points, dst, dst_stride);
+    } else if (type == 'F' && size == 8) {
+        UnpackColumn<double>(src, src_stride, num_points, dst, dst_stride);
+    } else if (type == 'U' && size == 1) {
+        UnpackColumn<uint8_t>(src, src_stride, num_points, dst, dst_stride);
+    } else if (type == 'U' && size == 2) {
+        UnpackColumn<uint16_t>(src, src_stride, num_points, dst, dst_stride);
+    } else if (type == 'U' && size == 4) {
+        UnpackColumn<uint32_t>(src, src_stride, num_points, dst, dst_stride);
+    } else if (type == 'I' && size == 1) {
+        UnpackColumn<int8_t>(src, src_stride, num_points, dst, dst_stride);
+    } else if (type == 'I' && size == 2) {
+        UnpackColumn<int16_t>(src, src_stride, num_points, dst, dst_stride);
+    } else if (type == 'I' && size == 4) {
+        UnpackColumn<int32_t>(src, src_stride, num_points, dst, dst_stride);
+    } else if (type == 'I' && size == 8) {
+        UnpackColumn<int64_t>(src, src_stride, num_points, dst, dst_stride);
+    }
+}
+
+/// Unpacks the binary data into the attributes, one column at a time. Binary
+/// data stores the points as rows, and compressed data stores each field as a
+/// column of all the points.
+static void UnpackBinaryPCDData(const PCDHeader &header,
+                                const char *data,
+                                bool is_column_major,
+                                std::vector<PCDAttribute> &attributes) {
+    int64_t num_points = header.points_;
+    for (PCDAttribute &attribute : attributes) {
+        int64_t num_columns = attribute.data_.GetShape(1);
+        for (const auto &field_column : attribute.fields_) {
+            const PCDField &field = *field_column.first;
+            const char *src =
+                    data + field.offset_ * (is_column_major ? num_points : 1);
+            int64_t src_stride = is_column_major ? field.size_ * field.count_
+                                                 : header.pointsize_;
+            if (attribute.is_packed_rgb_) {
+                // Colors are packed in BGR order.
+                uint8_t *dst =
+                        static_cast<uint8_t *>(attribute.data_.GetDataPtr());
+                for (int64_t c = 0; c < 3; ++c) {
+                    UnpackColumn<uint8_t>(src + 2 - c, src_stride, num_points,
+                                          dst + c, 3);
+                }
+                continue;
+            }
+            DISPATCH_DTYPE_TO_TEMPLATE(attribute.data_.GetDtype(), [&]() {
+                scalar_t *dst =
+                        static_cast<scalar_t *>(attribute.data_.GetDataPtr()) +
+                        field_column.second;
+                for (int64_t k = 0; k < field.count_; ++k) {
+                    UnpackColumn(field.type_, field.size_,
+                                 src + k * field.size_, src_stride, num_points,
+                                 dst + k, num_columns);
+                }
+            });
+        }
+    }
+}
+
+/// Parses the ASCII lines, given by their first and past-the-end characters,
+/// into the attributes, in parallel over the lines. Missing tokens are left
+/// as zeros.
+static void UnpackASCIIPCDData(
+        const PCDHeader &header,
+        const std::vector<std::pair<const char *, const char *>> &lines,
+        std::vector<PCDAttribute> &attributes) {
+    // Destination of each token, ordered as in the lines.
+    struct Token {
+        char type_;
+        char *dst_;
+        int64_t dst_stride_;
+        core::Dtype dtype_;
+        bool is_packed_rgb_;
+    };
+    std::vector<Token> tokens(header.elementnum_);
+    std::vector<bool> has_token(header.elementnum_, false);
+    for (PCDAttribute &attribute : attributes) {
+        int64_t byte_size = attribute.data_.GetDtype().ByteSize();
+        int64_t num_columns = attribute.data_.GetShape(1);
+        for (const auto &field_column : attribute.fields_) {
+            const PCDField &field = *field_column.first;
+            for (int64_t k = 0; k < field.count_; ++k) {
+                tokens[field.count_offset_ + k] = {
+                        field.type_,
+                        static_cast<char *>(attribute.data_.GetDataPtr()) +
+                                (field_column.second + k) * byte_size,
+                        num_columns * byte_size, attribute.data_.GetDtype(),
+                        attribute.is_packed_rgb_};
+                has_token[field.count_offset_ + k] = true;
+            }
+        }
+    }
+
+    int64_t num_lines = std::min(static_cast<int64_t>(lines.size()),
+                                 header.points_);
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < num_lines; ++i) {
+        const char *ptr = lines[i].first;
+        for (int64_t t = 0; t < header.elementnum_; ++t) {
+            const Token &token = tokens[t];
+            char *end;
+            double value = 0.0;
+            int64_t int_value = 0;
+            uint64_t uint_value = 0;
+            if (token.type_ == 'I') {
+                int_value = std::strtoll(ptr, &end, 0);
+                value = static_cast<double>(int_value);
+            } else if (token.type_ == 'U') {
+                uint_value = std::strtoull(ptr, &end, 0);
+                value = static_cast<double>(uint_value);
+            } else {
+                value = std::strtod(ptr, &end);
+            }
+            if (end == ptr || end > lines[i].second) {
+                break;
+            }
+            ptr = end;
+            if (!has_token[t]) {
+                continue;
+            }
+            char *dst = token.dst_ + i * token.dst_stride_;
+            if (token.is_packed_rgb_) {
+                uint8_t bgra[4];
+                if (token.type_ == 'F') {
+                    float float_value = static_cast<float>(value);
+                    std::memcpy(bgra, &float_value, 4);
+                } else {
+                    uint32_t packed = token.type_ == 'I'
+                                              ? static_cast<uint32_t>(int_value)
+                                              : static_cast<uint32_t>(
+                                                        uint_value);
+                    std::memcpy(bgra, &packed, 4);
+                }
+                dst[0] = bgra[2];
+                dst[1] = bgra[1];
+                dst[2] = bgra[0];
+            } else if (token.dtype_ == core::Dtype::Int64) {
+                int64_t integer = token.type_ == 'U'
+                                          ? static_cast<int64_t>(uint_value)
+                                          : int_value;
+                std::memcpy(dst, &integer, sizeof(integer));
+            } else {
+                DISPATCH_DTYPE_TO_TEMPLATE(token.dtype_, [&]() {
+                    scalar_t scalar = static_cast<scalar_t>(value);
+                    std::memcpy(dst, &scalar, sizeof(scalar));
+                });
+            }
+        }
+    }
+}
+
+/// Reads the data of a PCD file starting at \p body_begin. Binary data is
+/// read with concurrent ranged reads of just the points of the header.
+static bool ReadPCDData(open3d::io::ByteSource &source,
+                        int64_t body_begin,
+                        const PCDHeader &header,
+                        std::vector<PCDAttribute> &attributes,
+                        const open3d::io::ReadPointCloudOption &params) {
+    utility::CountingProgressReporter reporter(params.update_progress);
+    reporter.SetTotal(header.points_);
+    for (PCDAttribute &attribute : attributes) {
+        attribute.data_.Fill(0);
+    }
+
+    // The rest of the file is the body. Binary bodies are read up to the end
+    // of the points, compressed ones up to the end of the compressed data.
+    int64_t body_size = source.GetSize() - body_begin;
+    if (header.datatype_ == PCDDataType::BINARY) {
+        body_size = std::min(body_size, header.points_ * header.pointsize_);
+    } else if (header.datatype_ == PCDDataType::BINARY_COMPRESSED) {
+        uint32_t compressed_size;
+        if (body_size < 8 || !source.Read(body_begin, 4, &compressed_size)) {
+            utility::LogWarning("Read PCD failed: unable to read data.");
+            return false;
+        }
+        body_size = std::min<int64_t>(body_size, 8 + int64_t(compressed_size));
+    }
+    std::vector<char> body(body_size + 1, '\0');
+    if (!source.ReadRanges({{body_begin, body_size, body.data()}})) {
+        utility::LogWarning("Read PCD failed: unable to read data.");
+        return false;
+    }
+
+    if (header.datatype_ == PCDDataType::ASCII) {
+        std::vector<std::pair<const char *, const char *>> lines;
+        const char *end = body.data() + body_size;
+        for (const char *line = body.data(); line < end;) {
+            const char *next = static_cast<const char *>(
+                    std::memchr(line, '\n', end - line));
+            next = next ? next + 1 : end;
+            if (std::strspn(line, " \t\r\n") <
+                static_cast<size_t>(next - line)) {
+                lines.push_back({line, next});
+            }
+            line = next;
+        }
+        UnpackASCIIPCDData(header, lines, attributes);
+    } else if (header.datatype_ == PCDDataType::BINARY) {
+        if (body_size < header.points_ * header.pointsize_) {
+            utility::LogWarning("Read PCD failed: unable to read data.");
+            return false;
+        }
+        UnpackBinaryPCDData(header, body.data(), false, attributes);
+    } else {
+        uint32_t compressed_size, uncompressed_size;
+        if (body_size < 8) {
+            utility::LogWarning("Read PCD failed: unable to read data.");
+            return false;
+        }
+        std::memcpy(&compressed_size, body.data(), 4);
+        std::memcpy(&uncompressed_size, body.data() + 4, 4);
+        if (body_size - 8 < compressed_size ||
+            uncompressed_size != header.points_ * header.pointsize_) {
+            utility::LogWarning("Read PCD failed: unable to read data.");
+            return false;
+        }
+        std::vector<char> buffer(uncompressed_size);
+        if (lzf_decompress(body.data() + 8, compressed_size, buffer.data(),
+                           uncompressed_size) != uncompressed_size) {
+            utility::LogWarning("Read PCD failed: uncompression failed.");
+            return false;
+        }
+        UnpackBinaryPCDData(header, buffer.data(), true, attributes);
+    }
+    reporter.Finish();
+    return true;
+}
+
+bool ReadPointCloudFromPCD(const std::string &filename,
+                           geometry::PointCloud &pointcloud,
+                           const open3d::io::ReadPointCloudOption &params) {
+    std::shared_ptr<open3d::io::ByteSource> source =
+            open3d::io::OpenByteSource(filename);
+    if (source == nullptr) {
+        utility::LogWarning("Read PCD failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    PCDHeader header;
+    int64_t body_begin = 0;
+    std::vector<PCDAttribute> attributes;
+    if (!ReadPCDHeader(*source, header, body_begin) ||
+        !CreatePCDAttributes(header, attributes) ||
+        !ReadPCDData(*source, body_begin, header, attributes, params)) {
+        return false;
+    }
+
+    pointcloud.Clear();
+    for (const PCDAttribute &attribute : attributes) {
+        pointcloud.SetPointAttr(attribute.name_, attribute.data_);
+    }
+    return true;
+}
+
+/// Field of a PCD file written from the column of an attribute.
+struct PCDWriteField {
+    std::string name_;
+    char type_;
+    int64_t size_;
+    int64_t count_;
+    core::Tensor data_;
+};
+
+template <typename scalar_t>
+static void PackPCDColors(const scalar_t *src,
+                          int64_t num_points,
+                          uint8_t *dst) {
+    bool is_float = std::is_floating_point<scalar_t>::value;
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < num_points; ++i) {
+        for (int64_t c = 0; c < 3; ++c) {
+            double value = static_cast<double>(src[i * 3 + c]);
+            if (is_float) {
+                value = std::round(value * 255.0);
+            }
+            dst[i * 4 + 2 - c] = static_cast<uint8_t>(
+                    std::min(std::max(value, 0.0), 255.0));
+        }
+    }
+}
+
+/// Packs the colors into the 32-bit rgb field, in BGR order. Float colors are
+/// in [0, 1].
+static core::Tensor PackPCDColors(const core::Tensor &colors) {
+    int64_t num_points = colors.GetLength();
+    core::Tensor packed = core::Tensor::Zeros({num_points, 4},
+                                              core::Dtype::UInt8);
+    uint8_t *dst = static_cast<uint8_t *>(packed.GetDataPtr());
+    DISPATCH_DTYPE_TO_TEMPLATE(colors.GetDtype(), [&]() {
+        PackPCDColors(static_cast<const scalar_t *>(colors.GetDataPtr()),
+                      num_points, dst);
+    });
+    return packed;
+}
+
+static bool CreatePCDWriteFields(const geometry::PointCloud &pointcloud,
+                                 std::vector<PCDWriteField> &fields) {
+    const core::Device host("CPU:0");
+    int64_t num_points = pointcloud.GetPoints().GetLength();
+    std::vector<std::string> names = {"points"};
+    if (pointcloud.HasPointNormals()) names.push_back("normals");
+    if (pointcloud.HasPointColors()) names.push_back("colors");
+    for (const auto &it : pointcloud.GetPointAttr()) {
+        if (it.first != "points" && it.first != "normals" &&
+            it.first != "colors") {
+            names.push_back(it.first);
+        }
+    }
+    for (const std::string &name : names) {
+        core::Tensor data = pointcloud.GetPointAttr(name);
+        data = data.GetDevice() == host ? data.Contiguous() : data.Copy(host);
+        if (data.NumDims() == 1) {
+            data = data.Reshape({num_points, 1});
+        }
+        if (data.NumDims() != 2 || data.GetLength() != num_points) {
+            utility::LogWarning(
+                    "Write PCD failed: shape of {} is {}, but it should be "
+                    "{{{}, C}}.",
+                    name, data.GetShape(), num_points);
+            return false;
+        }
+        if (name == "colors" && data.GetShape(1) == 3) {
+            fields.push_back({"rgb", 'F', 4, 1, PackPCDColors(data)});
+            continue;
+        }
+        char type;
+        int64_t size;
+        if (!GetPCDFieldFromDtype(data.GetDtype(), type, size)) {
+            utility::LogWarning(
+                    "Write PCD warning: skipping {}, unsupported datatype {}.",
+                    name, data.GetDtype().ToString());
+            continue;
+        }
+        if ((name == "points" || name == "normals") && data.GetShape(1) == 3) {
+            const std::vector<std::string> suffixes = {"x", "y", "z"};
+            for (int64_t c = 0; c < 3; ++c) {
+                fields.push_back({(name == "points" ? "" : "normal_") +
+                                          suffixes[c],
+                                  type, size, 1,
+                                  data.Slice(1, c, c + 1).Contiguous()});
+            }
+        } else {
+            fields.push_back({name, type, size, data.GetShape(1), data});
+        }
+    }
+    return true;
+}
+
+static void WritePCDHeader(FILE *file,
+                           const std::vector<PCDWriteField> &fields,
+                           int64_t num_points,
+                           PCDDataType datatype) {
+    std::string header =
+            "# .PCD v0.7 - Point Cloud Data file format\nVERSION 0.7\nFIELDS";
+    for (const PCDWriteField &field : fields) {
+        header += " " + field.name_;
+    }
+    header += "\nSIZE";
+    for (const PCDWriteField &field : fields) {
+        header += fmt::format(" {}", field.size_);
+    }
+    header += "\nTYPE";
+    for (const PCDWriteField &field : fields) {
+        header += fmt::format(" {}", field.type_);
+    }
+    header += "\nCOUNT";
+    for (const PCDWriteField &field : fields) {
+        header += fmt::format(" {}", field.count_);
+    }
+    header += fmt::format(
+            "\nWIDTH {}\nHEIGHT 1\nVIEWPOINT 0 0 0 1 0 0 0\nPOINTS {}\nDATA ",
+            num_points, num_points);
+    if (datatype == PCDDataType::BINARY) {
+        header += "binary\n";
+    } else if (datatype == PCDDataType::BINARY_COMPRESSED) {
+        header += "binary_compressed\n";
+    } else {
+        header += "ascii\n";
+    }
+    fwrite(header.data(), 1, header.size(), file);
+}
+
+/// Formats the points in blocks, in parallel, and writes the blocks in order.
+static bool WriteASCIIPCDData(FILE *file,
+                              const std::vector<PCDWriteField> &fields,
+                              int64_t num_points) {
+    const int64_t block_size = 1 << 14;
+    int64_t num_blocks = (num_points + block_size - 1) / block_size;
+    std::vector<std::string> blocks(num_blocks);
+#pragma omp parallel for schedule(dynamic) num_threads(utility::EstimateMaxThreads())
+    for (int64_t b = 0; b < num_blocks; ++b) {
+        std::string &block = blocks[b];
+        int64_t end = std::min((b + 1) * block_size, num_points);
+        for (int64_t i = b * block_size; i < end; ++i) {
+            for (const PCDWriteField &field : fields) {
+                const char *src =
+                        static_cast<const char *>(field.data_.GetDataPtr()) +
+                        i * field.size_ * field.count_;
+                for (int64_t k = 0; k < field.count_; ++k) {
+                    if (field.name_ == "rgb") {
+                        float value;
+                        std::memcpy(&value, src, 4);
+                        block += fmt::format("{} ", value);
+                        continue;
+                    }
+                    DISPATCH_DTYPE_TO_TEMPLATE(field.data_.GetDtype(), [&]() {
+                        scalar_t value;
+                        std::memcpy(&value, src + k * field.size_,
+                                    sizeof(value));
+                        block += fmt::format("{} ", value);
+                    });
+                }
+            }
+            block.back() = '\n';
+        }
+    }
+    for (const std::string &block : blocks) {
+        if (fwrite(block.data(), 1, block.size(), file) != block.size()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// Packs the fields into rows, or into columns for compressed data, in
+/// parallel over the points.
+static std::vector<char> PackBinaryPCDData(
+        const std::vector<PCDWriteField> &fields,
+        int64_t num_points,
+        bool is_column_major) {
+    int64_t point_size = 0;
+    for (const PCDWriteField &field : fields) {
+        point_size += field.size_ * field.count_;
+    }
+    std::vector<char> buffer(num_points * point_size);
+    int64_t offset = 0;
+    for (const PCDWriteField &field : fields) {
+        int64_t field_size = field.size_ * field.count_;
+        const char *src = static_cast<const char *>(field.data_.GetDataPtr());
+        char *dst = buffer.data() +
+                    offset * (is_column_major ? num_points : 1);
+        int64_t dst_stride = is_column_major ? field_size : point_size;
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+        for (int64_t i = 0; i < num_points; ++i) {
+            std::memcpy(dst + i * dst_stride, src + i * field_size,
+                        field_size);
+        }
+        offset += field_size;
+    }
+    return buffer;
+}
+
+bool WritePointCloudToPCD(const std::string &filename,
+                          const geometry::PointCloud &pointcloud,
+                          const open3d::io::WritePointCloudOption &params) {
+    if (pointcloud.IsEmpty()) {
+        utility::LogWarning("Write PCD failed: point cloud has 0 points.");
+        return false;
+    }
+    std::vector<PCDWriteField> fields;
+    if (!CreatePCDWriteFields(pointcloud, fields)) {
+        return false;
+    }
+    int64_t num_points = pointcloud.GetPoints().GetLength();
+    PCDDataType datatype = bool(params.write_ascii)
+                                   ? PCDDataType::ASCII
+                                   : (bool(params.compressed)
+                                              ? PCDDataType::BINARY_COMPRESSED
+                                              : PCDDataType::BINARY);
+
+    FILE *file = utility::filesystem::FOpen(filename.c_str(), "wb");
+    if (file == nullptr) {
+        utility::LogWarning("Write PCD failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    utility::CountingProgressReporter reporter(params.update_progress);
+    reporter.SetTotal(num_points);
+    WritePCDHeader(file, fields, num_points, datatype);
+
+    bool success = true;
+    if (datatype == PCDDataType::ASCII) {
+        success = WriteASCIIPCDData(file, fields, num_points);
+    } else if (datatype == PCDDataType::BINARY) {
+        std::vector<char> buffer = PackBinaryPCDData(fields, num_points, false);
+        success = fwrite(buffer.data(), 1, buffer.size(), file) ==
+                  buffer.size();
+    } else {
+        std::vector<char> buffer = PackBinaryPCDData(fields, num_points, true);
+        if (buffer.size() > std::numeric_limits<uint32_t>::max() / 2) {
+            utility::LogWarning(
+                    "Write PCD failed: {} bytes are too large for "
+                    "binary_compressed data.",
+                    buffer.size());
+            fclose(file);
+            return false;
+        }
+        uint32_t uncompressed_size = static_cast<uint32_t>(buffer.size());
+        std::vector<char> compressed(uncompressed_size * 2);
+        uint32_t compressed_size =
+                lzf_compress(buffer.data(), uncompressed_size,
+                             compressed.data(), uncompressed_size * 2);
+        if (compressed_size == 0) {
+            utility::LogWarning("Write PCD failed: unable to compress data.");
+            fclose(file);
+            return false;
+        }
+        success = fwrite(&compressed_size, sizeof(compressed_size), 1, file) ==
+                          1 &&
+                  fwrite(&uncompressed_size, sizeof(uncompressed_size), 1,
+                         file) == 1 &&
+                  fwrite(compressed.data(), 1, compressed_size, file) ==
+                          compressed_size;
+    }
+    fclose(file);
+    if (!success) {
+        utility::LogWarning("Write PCD failed: unable to write data.");
+        return false;
+    }
+    reporter.Finish();
+    return true;
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -26,13 +26,23 @@
 
 #include <rply.h>
 
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <sstream>
+#include <tuple>
+
 #include "open3d/core/Dtype.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/io/ByteSource.h"
 #include "open3d/io/FileFormatIO.h"
 #include "open3d/t/geometry/TensorMap.h"
 #include "open3d/t/io/PointCloudIO.h"
+#include "open3d/t/io/TriangleMeshIO.h"
+#include "open3d/utility/ASCIIParser.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Parallel.h"
 #include "open3d/utility/ProgressReporters.h"
 
 namespace open3d {
@@ -171,9 +181,305 @@ static core::Dtype GetDtype(e_ply_type type) {
     }
 }
 
+/// Layout of a fixed-size scalar property of the binary vertex element.
+struct PLYBinaryProperty {
+    std::string name_;
+    e_ply_type type_;
+    int64_t offset_;
+};
+
+/// Column of the vertex element copied into an attribute tensor.
+struct PLYBinaryColumn {
+    int64_t src_offset_;
+    int64_t byte_size_;
+    char *dst_;
+    int64_t dst_stride_;
+};
+
+/// Returns the type of a PLY type name, with its size in bytes, or PLY_LIST
+/// for list properties and unknown names.
+static e_ply_type GetPlyTypeFromName(const std::string &name,
+                                     int64_t &byte_size) {
+    static const std::vector<std::tuple<std::string, e_ply_type, int64_t>>
+            types = {{"int8", PLY_INT8, 1},       {"uint8", PLY_UINT8, 1},
+                     {"int16", PLY_INT16, 2},     {"uint16", PLY_UINT16, 2},
+                     {"int32", PLY_INT32, 4},     {"uint32", PLY_UIN32, 4},
+                     {"float32", PLY_FLOAT32, 4}, {"float64", PLY_FLOAT64, 8},
+                     {"char", PLY_CHAR, 1},       {"uchar", PLY_UCHAR, 1},
+                     {"short", PLY_SHORT, 2},     {"ushort", PLY_USHORT, 2},
+                     {"int", PLY_INT, 4},         {"uint", PLY_UINT, 4},
+                     {"float", PLY_FLOAT, 4},     {"double", PLY_DOUBLE, 8}};
+    for (const auto &type : types) {
+        if (std::get<0>(type) == name) {
+            byte_size = std::get<2>(type);
+            return std::get<1>(type);
+        }
+    }
+    byte_size = 0;
+    return PLY_LIST;
+}
+
+static bool IsLittleEndianHost() {
+    const uint16_t one = 1;
+    uint8_t first_byte;
+    std::memcpy(&first_byte, &one, 1);
+    return first_byte == 1;
+}
+
+/// Parses the header of a binary little-endian PLY file of \p file_size bytes
+/// from its first \p size bytes at \p data. Returns false when the vertex
+/// element can not be located without reading the data, i.e. for other
+/// formats and for list properties in or before the vertex element.
+static bool ParseBinaryPLYHeader(const char *data,
+                                 int64_t size,
+                                 int64_t file_size,
+                                 int64_t &vertex_offset,
+                                 int64_t &num_vertices,
+                                 int64_t &vertex_stride,
+                                 std::vector<PLYBinaryProperty> &properties) {
+    const std::string magic = "ply";
+    if (size < static_cast<int64_t>(magic.size()) ||
+        !std::equal(magic.begin(), magic.end(), data)) {
+        return false;
+    }
+    const std::string end_header = "end_header";
+    const char *header_end = std::search(data, data + size, end_header.begin(),
+                                         end_header.end());
+    const char *data_begin = static_cast<const char *>(
+            std::memchr(header_end, '\n', data + size - header_end));
+    if (data_begin == nullptr) {
+        return false;
+    }
+    std::istringstream header(std::string(data, header_end));
+    vertex_offset = data_begin + 1 - data;
+    num_vertices = -1;
+
+    std::string line;
+    bool is_binary_little_endian = false;
+    bool is_vertex = false;
+    bool is_fixed_size = true;
+    int64_t element_size = 0;
+    int64_t element_stride = 0;
+    while (std::getline(header, line)) {
+        std::istringstream tokens(line);
+        std::string keyword;
+        tokens >> keyword;
+        if (keyword == "format") {
+            std::string format;
+            tokens >> format;
+            is_binary_little_endian = format == "binary_little_endian";
+        } else if (keyword == "element") {
+            if (is_vertex) {
+                break;
+            }
+            // The previous element precedes the vertex element.
+            if (!is_fixed_size) {
+                return false;
+            }
+            vertex_offset += element_size * element_stride;
+            std::string name;
+            tokens >> name >> element_size;
+            element_stride = 0;
+            is_vertex = name == "vertex";
+        } else if (keyword == "property") {
+            std::string type_name, name;
+            tokens >> type_name >> name;
+            int64_t byte_size;
+            e_ply_type type = GetPlyTypeFromName(type_name, byte_size);
+            if (type == PLY_LIST) {
+                is_fixed_size = false;
+            } else if (is_vertex) {
+                properties.push_back({name, type, element_stride});
+            }
+            element_stride += byte_size;
+        }
+    }
+    if (!is_binary_little_endian || !is_vertex || !is_fixed_size ||
+        element_size <= 0) {
+        return false;
+    }
+    num_vertices = element_size;
+    vertex_stride = element_stride;
+    return vertex_offset + num_vertices * vertex_stride <= file_size;
+}
+
+/// Reads the header of a PLY file from \p source in blocks until the line
+/// after "end_header", or up to the end of the file.
+static bool ReadPLYHeader(open3d::io::ByteSource &source,
+                          std::vector<char> &header) {
+    const int64_t block_size = 1 << 12;
+    const std::string end_header = "end_header";
+    const int64_t file_size = source.GetSize();
+    header.clear();
+    while (static_cast<int64_t>(header.size()) < file_size) {
+        int64_t begin = static_cast<int64_t>(header.size());
+        int64_t read_size = std::min(block_size, file_size - begin);
+        header.resize(begin + read_size);
+        if (!source.Read(begin, read_size, header.data() + begin)) {
+            return false;
+        }
+        auto header_end = std::search(header.begin(), header.end(),
+                                      end_header.begin(), end_header.end());
+        if (std::find(header_end, header.end(), '\n') != header.end()) {
+            break;
+        }
+    }
+    return true;
+}
+
+/// Reads the vertex element of a binary little-endian PLY file with
+/// fixed-size vertex properties. Local files are mapped in memory, and only
+/// the header and the vertex element of files given by URL are fetched, in
+/// blocks of concurrent ranged reads. The property columns are copied in
+/// parallel into the attribute tensors, which do not alias the mapping.
+/// Returns false, without modifying \p pointcloud, when the file needs the
+/// generic reader, and with \p pointcloud cleared if the vertices can not be
+/// read.
+static bool ReadPointCloudFromBinaryPLY(
+        const std::string &filename,
+        geometry::PointCloud &pointcloud,
+        const open3d::io::ReadPointCloudOption &params) {
+    if (!IsLittleEndianHost()) {
+        return false;
+    }
+    std::shared_ptr<open3d::io::ByteSource> source =
+            open3d::io::OpenByteSource(filename, true);
+    if (source == nullptr || source->GetSize() == 0) {
+        return false;
+    }
+    const int64_t file_size = source->GetSize();
+    const char *data = source->GetData();
+    int64_t size = file_size;
+    std::vector<char> header;
+    if (data == nullptr) {
+        if (!ReadPLYHeader(*source, header)) {
+            return false;
+        }
+        data = header.data();
+        size = static_cast<int64_t>(header.size());
+    }
+
+    int64_t vertex_offset = 0, num_vertices = 0, vertex_stride = 0;
+    std::vector<PLYBinaryProperty> properties;
+    if (!ParseBinaryPLYHeader(data, size, file_size, vertex_offset,
+                              num_vertices, vertex_stride, properties)) {
+        return false;
+    }
+
+    std::unordered_map<std::string, const PLYBinaryProperty *> name_to_property;
+    for (const PLYBinaryProperty &property : properties) {
+        if (GetDtype(property.type_) == core::Dtype::Undefined) {
+            utility::LogWarning(
+                    "Read PLY warning: skipping property \"{}\", unsupported "
+                    "datatype \"{}\".",
+                    property.name_, GetDtypeString(property.type_));
+        } else {
+            name_to_property[property.name_] = &property;
+        }
+    }
+
+    // Base attributes are interleaved into {N, 3} tensors, the others are
+    // read into {N, 1} tensors.
+    const std::vector<std::pair<std::string, std::vector<std::string>>>
+            base_attributes = {{"points", {"x", "y", "z"}},
+                               {"normals", {"nx", "ny", "nz"}},
+                               {"colors", {"red", "green", "blue"}}};
+    std::vector<std::pair<std::string, std::vector<std::string>>> attributes;
+    for (const auto &base_attribute : base_attributes) {
+        const std::vector<std::string> &names = base_attribute.second;
+        if (name_to_property.count(names[0]) != 0 &&
+            name_to_property.count(names[1]) != 0 &&
+            name_to_property.count(names[2]) != 0) {
+            // Mismatched datatypes are reported by the generic reader.
+            e_ply_type type = name_to_property.at(names[0])->type_;
+            if (GetDtype(name_to_property.at(names[1])->type_) !=
+                        GetDtype(type) ||
+                GetDtype(name_to_property.at(names[2])->type_) !=
+                        GetDtype(type)) {
+                return false;
+            }
+            attributes.push_back(base_attribute);
+        }
+    }
+    const std::unordered_map<std::string, const PLYBinaryProperty *>
+            supported_properties = name_to_property;
+    for (const auto &attribute : attributes) {
+        for (const std::string &name : attribute.second) {
+            name_to_property.erase(name);
+        }
+    }
+    for (const auto &it : name_to_property) {
+        attributes.push_back({it.first, {it.first}});
+    }
+
+    pointcloud.Clear();
+    std::vector<PLYBinaryColumn> columns;
+    for (const auto &attribute : attributes) {
+        const std::vector<std::string> &names = attribute.second;
+        core::Dtype dtype = GetDtype(supported_properties.at(names[0])->type_);
+        int64_t num_columns = static_cast<int64_t>(names.size());
+        core::Tensor data_tensor({num_vertices, num_columns}, dtype);
+        char *dst = static_cast<char *>(data_tensor.GetDataPtr());
+        for (int64_t c = 0; c < num_columns; ++c) {
+            columns.push_back({supported_properties.at(names[c])->offset_,
+                               dtype.ByteSize(), dst + c * dtype.ByteSize(),
+                               num_columns * dtype.ByteSize()});
+        }
+        pointcloud.SetPointAttr(attribute.first, data_tensor);
+    }
+
+    utility::CountingProgressReporter reporter(params.update_progress);
+    reporter.SetTotal(num_vertices);
+    // Vertices that are not mapped are fetched in blocks of about 64MB.
+    const bool is_mapped = source->GetData() != nullptr;
+    const int64_t block_size =
+            is_mapped ? 1 << 20
+                      : std::max<int64_t>(1, (1 << 26) / vertex_stride);
+    std::vector<char> block;
+    for (int64_t begin = 0; begin < num_vertices; begin += block_size) {
+        int64_t end = std::min(begin + block_size, num_vertices);
+        const char *vertex_data;
+        if (is_mapped) {
+            vertex_data = data + vertex_offset + begin * vertex_stride;
+        } else {
+            block.resize((end - begin) * vertex_stride);
+            if (!source->ReadRanges({{vertex_offset + begin * vertex_stride,
+                                      static_cast<int64_t>(block.size()),
+                                      block.data()}})) {
+                utility::LogWarning("Read PLY failed: unable to read data.");
+                pointcloud.Clear();
+                return false;
+            }
+            vertex_data = block.data();
+        }
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+        for (int64_t i = begin; i < end; ++i) {
+            const char *row = vertex_data + (i - begin) * vertex_stride;
+            for (const PLYBinaryColumn &column : columns) {
+                std::memcpy(column.dst_ + i * column.dst_stride_,
+                            row + column.src_offset_, column.byte_size_);
+            }
+        }
+        reporter.Update(end);
+    }
+    reporter.Finish();
+    return true;
+}
+
 bool ReadPointCloudFromPLY(const std::string &filename,
                            geometry::PointCloud &pointcloud,
                            const open3d::io::ReadPointCloudOption &params) {
+    if (ReadPointCloudFromBinaryPLY(filename, pointcloud, params)) {
+        return true;
+    }
+    // Other files given by URL are downloaded for the generic reader.
+    if (open3d::io::IsURL(filename)) {
+        return open3d::io::ReadRemoteFile(
+                filename, [&](const std::string &path) {
+                    return ReadPointCloudFromPLY(path, pointcloud, params);
+                });
+    }
+
     p_ply ply_file = ply_open(filename.c_str(), nullptr, 0, nullptr);
     if (!ply_file) {
         utility::LogWarning("Read PLY failed: unable to open file: {}.",
@@ -467,6 +773,404 @@ bool WritePointCloudToPLY(const std::string &filename,
     return true;
 }
 
+/// Locates the face element of a binary little-endian PLY file, when all the
+/// faces are triangles stored as a one byte count and three 4 byte indices
+/// after fixed-size elements. Returns false when the faces need the generic
+/// reader.
+static bool LocateBinaryPLYTriangles(const char *data,
+                                     int64_t file_size,
+                                     int64_t &face_offset,
+                                     int64_t &num_faces) {
+    if (!IsLittleEndianHost() || file_size < 3 ||
+        std::memcmp(data, "ply", 3) != 0) {
+        return false;
+    }
+    const std::string end_header = "end_header";
+    const char *header_end =
+            std::search(data, data + file_size, end_header.begin(),
+                        end_header.end());
+    const char *data_begin = static_cast<const char *>(
+            std::memchr(header_end, '\n', data + file_size - header_end));
+    if (data_begin == nullptr) {
+        return false;
+    }
+    std::istringstream header(std::string(data, header_end));
+    face_offset = data_begin + 1 - data;
+    num_faces = -1;
+
+    std::string line;
+    bool is_binary_little_endian = false;
+    bool is_face = false;
+    bool is_fixed_size = true;
+    int64_t num_face_properties = 0;
+    int64_t element_size = 0;
+    int64_t element_stride = 0;
+    while (std::getline(header, line)) {
+        std::istringstream tokens(line);
+        std::string keyword;
+        tokens >> keyword;
+        if (keyword == "format") {
+            std::string format;
+            tokens >> format;
+            is_binary_little_endian = format == "binary_little_endian";
+        } else if (keyword == "element") {
+            if (is_face) {
+                break;
+            }
+            if (!is_fixed_size) {
+                return false;
+            }
+            face_offset += element_size * element_stride;
+            std::string name;
+            tokens >> name >> element_size;
+            element_stride = 0;
+            is_face = name == "face";
+        } else if (keyword == "property") {
+            std::string type_name;
+            tokens >> type_name;
+            int64_t byte_size;
+            if (GetPlyTypeFromName(type_name, byte_size) != PLY_LIST) {
+                element_stride += byte_size;
+            } else if (type_name != "list") {
+                return false;
+            } else {
+                std::string count_type, index_type;
+                tokens >> count_type >> index_type;
+                int64_t count_size, index_size;
+                GetPlyTypeFromName(count_type, count_size);
+                GetPlyTypeFromName(index_type, index_size);
+                is_fixed_size = false;
+                if (is_face && count_size == 1 && index_size == 4 &&
+                    index_type.find("float") == std::string::npos) {
+                    element_stride = 1 + 3 * index_size;
+                }
+            }
+            num_face_properties += is_face ? 1 : 0;
+        }
+    }
+    if (!is_binary_little_endian || !is_face || num_face_properties != 1 ||
+        element_stride != 13 ||
+        face_offset + element_size * element_stride > file_size) {
+        return false;
+    }
+    num_faces = element_size;
+    const char *faces = data + face_offset;
+    bool all_triangles = true;
+#pragma omp parallel for schedule(static) reduction(&& : all_triangles) num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < num_faces; ++i) {
+        all_triangles = all_triangles && faces[i * 13] == 3;
+    }
+    return all_triangles;
+}
+
+/// Polygons of the face element read by rply, triangulated as fans.
+struct PLYFaceState {
+    std::vector<int64_t> polygon_;
+    std::vector<int64_t> triangles_;
+};
+
+static int ReadFaceCallback(p_ply_argument argument) {
+    PLYFaceState *state_ptr;
+    long length, index;
+    ply_get_argument_user_data(argument, reinterpret_cast<void **>(&state_ptr),
+                               nullptr);
+    ply_get_argument_property(argument, nullptr, &length, &index);
+    if (index == -1) {
+        state_ptr->polygon_.clear();
+        return 1;
+    }
+    std::vector<int64_t> &polygon = state_ptr->polygon_;
+    polygon.push_back(static_cast<int64_t>(ply_get_argument_value(argument)));
+    if (index == length - 1) {
+        for (size_t k = 2; k < polygon.size(); ++k) {
+            state_ptr->triangles_.insert(state_ptr->triangles_.end(),
+                                         {polygon[0], polygon[k - 1],
+                                          polygon[k]});
+        }
+    }
+    return 1;
+}
+
+/// Reads the faces of a PLY file as Int64 triangles with rply.
+static bool ReadPLYTrianglesWithRPly(const std::string &filename,
+                                     core::Tensor &triangles) {
+    p_ply ply_file = ply_open(filename.c_str(), nullptr, 0, nullptr);
+    if (!ply_file) {
+        return false;
+    }
+    if (!ply_read_header(ply_file)) {
+        ply_close(ply_file);
+        return false;
+    }
+    PLYFaceState state;
+    if (ply_set_read_cb(ply_file, "face", "vertex_indices", ReadFaceCallback,
+                        &state, 0) == 0) {
+        ply_set_read_cb(ply_file, "face", "vertex_index", ReadFaceCallback,
+                        &state, 0);
+    }
+    if (!ply_read(ply_file)) {
+        ply_close(ply_file);
+        return false;
+    }
+    ply_close(ply_file);
+    int64_t num_triangles = static_cast<int64_t>(state.triangles_.size()) / 3;
+    triangles = core::Tensor(state.triangles_, {num_triangles, 3},
+                             core::Dtype::Int64);
+    return true;
+}
+
+bool ReadTriangleMeshFromPLY(const std::string &filename,
+                             geometry::TriangleMesh &mesh,
+                             bool print_progress) {
+    try {
+        // The vertex element is read as a point cloud, in parallel for
+        // binary files.
+        geometry::PointCloud pointcloud;
+        if (!ReadPointCloudFromPLY(filename, pointcloud,
+                                   {"auto", false, false, print_progress})) {
+            return false;
+        }
+        if (!pointcloud.HasPoints()) {
+            utility::LogWarning("Read PLY failed: no vertices in: {}",
+                                filename);
+            return false;
+        }
+
+        core::Tensor triangles;
+        utility::ASCIIFileView view;
+        int64_t face_offset, num_faces;
+        if (view.Open(filename) &&
+            LocateBinaryPLYTriangles(view.GetData(), view.GetSize(),
+                                     face_offset, num_faces)) {
+            triangles = core::Tensor({num_faces, 3}, core::Dtype::Int64);
+            int64_t *triangles_ptr =
+                    static_cast<int64_t *>(triangles.GetDataPtr());
+            const char *faces = view.GetData() + face_offset;
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+            for (int64_t i = 0; i < num_faces; ++i) {
+                int32_t indices[3];
+                std::memcpy(indices, faces + i * 13 + 1, 12);
+                for (int k = 0; k < 3; ++k) {
+                    triangles_ptr[3 * i + k] = indices[k];
+                }
+            }
+        } else if (!ReadPLYTrianglesWithRPly(filename, triangles)) {
+            utility::LogWarning("Read PLY failed: unable to read faces of: {}",
+                                filename);
+            return false;
+        }
+        int64_t num_vertices = pointcloud.GetPoints().GetLength();
+        if (triangles.NumElements() > 0 &&
+            (triangles.Min({0, 1}).Item<int64_t>() < 0 ||
+             triangles.Max({0, 1}).Item<int64_t>() >= num_vertices)) {
+            utility::LogWarning(
+                    "Read PLY failed: vertex index out of range in: {}",
+                    filename);
+            return false;
+        }
+
+        core::Device device = mesh.GetDevice();
+        auto to_device = [&device](const core::Tensor &tensor) {
+            return tensor.GetDevice() == device ? tensor : tensor.Copy(device);
+        };
+        mesh = geometry::TriangleMesh(device);
+        for (const auto &it : pointcloud.GetPointAttr()) {
+            core::Tensor value = it.second;
+            if (it.first == "points" || it.first == "normals") {
+                value = value.To(core::Dtype::Float32);
+            } else if (it.first == "colors") {
+                // Colors are in [0, 1] as for the other mesh formats.
+                value = value.GetDtype() == core::Dtype::UInt8
+                                ? value.To(core::Dtype::Float32).Div(255)
+                                : value.To(core::Dtype::Float32);
+            }
+            mesh.SetVertexAttr(it.first == "points" ? "vertices" : it.first,
+                               to_device(value));
+        }
+        mesh.SetTriangles(to_device(triangles));
+        return true;
+    } catch (const std::exception &e) {
+        utility::LogWarning("Read PLY failed with exception: {}", e.what());
+        return false;
+    }
+}
+
+/// Writes \p num_rows rows of \p row_size bytes, packed in parallel by
+/// \p pack_row in blocks.
+static bool WritePLYRows(FILE *file,
+                         int64_t num_rows,
+                         int64_t row_size,
+                         const std::function<void(int64_t, char *)> &pack_row) {
+    const int64_t block_size = 1 << 20;
+    std::vector<char> buffer(std::min(block_size, num_rows) * row_size);
+    for (int64_t begin = 0; begin < num_rows; begin += block_size) {
+        int64_t end = std::min(begin + block_size, num_rows);
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+        for (int64_t i = begin; i < end; ++i) {
+            pack_row(i, buffer.data() + (i - begin) * row_size);
+        }
+        size_t size = static_cast<size_t>((end - begin) * row_size);
+        if (fwrite(buffer.data(), 1, size, file) != size) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool WriteTriangleMeshToPLY(const std::string &filename,
+                            const geometry::TriangleMesh &mesh,
+                            bool write_ascii,
+                            bool compressed,
+                            bool print_progress) {
+    if (write_ascii) {
+        // ASCII files are written by the legacy writer.
+        return open3d::io::WriteTriangleMeshToPLY(
+                filename, mesh.ToLegacyTriangleMesh(), true, compressed, true,
+                true, false, print_progress);
+    }
+    try {
+        if (!mesh.HasVertices() || mesh.GetVertices().GetLength() == 0) {
+            utility::LogWarning("Write PLY failed: mesh has 0 vertices.");
+            return false;
+        }
+        const core::Device host("CPU:0");
+        int64_t num_vertices = mesh.GetVertices().GetLength();
+        // Float64 positions and normals are kept, colors are written as
+        // uchar as by the legacy writer.
+        auto get_float_column = [&host](const core::Tensor &tensor) {
+            core::Dtype dtype = tensor.GetDtype() == core::Dtype::Float64
+                                        ? core::Dtype::Float64
+                                        : core::Dtype::Float32;
+            return tensor.Copy(host).To(dtype);
+        };
+        std::vector<std::pair<std::vector<std::string>, core::Tensor>>
+                columns = {{{"x", "y", "z"},
+                            get_float_column(mesh.GetVertices())}};
+        if (mesh.HasVertexNormals()) {
+            columns.push_back({{"nx", "ny", "nz"},
+                               get_float_column(mesh.GetVertexNormals())});
+        }
+        if (mesh.HasVertexColors()) {
+            core::Tensor colors = mesh.GetVertexColors().Copy(host);
+            if (colors.GetDtype() != core::Dtype::UInt8) {
+                core::Tensor values = colors.To(core::Dtype::Float64);
+                colors = core::Tensor(values.GetShape(), core::Dtype::UInt8);
+                const double *values_ptr =
+                        static_cast<const double *>(values.GetDataPtr());
+                uint8_t *colors_ptr =
+                        static_cast<uint8_t *>(colors.GetDataPtr());
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+                for (int64_t i = 0; i < values.NumElements(); ++i) {
+                    colors_ptr[i] = static_cast<uint8_t>(std::min(
+                            255.0, std::max(0.0, values_ptr[i] * 255 + 0.5)));
+                }
+            }
+            columns.push_back({{"red", "green", "blue"}, colors});
+        }
+        for (const auto &column : columns) {
+            if (column.second.GetShape() !=
+                core::SizeVector({num_vertices, 3})) {
+                utility::LogWarning(
+                        "Write PLY failed: vertex attribute of shape {}, "
+                        "expected ({}, 3).",
+                        column.second.GetShape().ToString(), num_vertices);
+                return false;
+            }
+        }
+        core::Tensor triangles =
+                mesh.HasTriangles()
+                        ? mesh.GetTriangles().Copy(host).To(core::Dtype::Int64)
+                        : core::Tensor({0, 3}, core::Dtype::Int64);
+        int64_t num_triangles = triangles.GetLength();
+        if (num_triangles > 0 &&
+            (num_vertices > int64_t(INT32_MAX) ||
+             triangles.Min({0, 1}).Item<int64_t>() < 0 ||
+             triangles.Max({0, 1}).Item<int64_t>() >= num_vertices)) {
+            utility::LogWarning(
+                    "Write PLY failed: triangle indices out of range.");
+            return false;
+        }
+
+        utility::filesystem::CFile file;
+        if (!file.Open(filename, "wb")) {
+            utility::LogWarning("Write PLY failed: unable to open file: {}",
+                                filename);
+            return false;
+        }
+        utility::ConsoleProgressUpdater progress_updater(
+                "Writing PLY file: " + filename, print_progress);
+        utility::CountingProgressReporter reporter(progress_updater);
+
+        std::ostringstream header;
+        header << "ply\nformat binary_little_endian 1.0\n"
+               << "comment Created by Open3D\n"
+               << "element vertex " << num_vertices << "\n";
+        int64_t row_size = 0;
+        for (const auto &column : columns) {
+            const core::Dtype dtype = column.second.GetDtype();
+            std::string type_name = "uchar";
+            if (dtype == core::Dtype::Float64) {
+                type_name = "double";
+            } else if (dtype == core::Dtype::Float32) {
+                type_name = "float";
+            }
+            for (const std::string &name : column.first) {
+                header << "property " << type_name << " " << name << "\n";
+            }
+            row_size += 3 * dtype.ByteSize();
+        }
+        header << "element face " << num_triangles << "\n"
+               << "property list uchar int vertex_indices\nend_header\n";
+        std::string header_str = header.str();
+        if (fwrite(header_str.data(), 1, header_str.size(), file.GetFILE()) !=
+            header_str.size()) {
+            utility::LogWarning("Write PLY failed: unable to write file: {}",
+                                filename);
+            return false;
+        }
+
+        std::vector<std::pair<const char *, int64_t>> sources;
+        for (const auto &column : columns) {
+            sources.push_back(
+                    {static_cast<const char *>(column.second.GetDataPtr()),
+                     3 * column.second.GetDtype().ByteSize()});
+        }
+        bool success = WritePLYRows(
+                file.GetFILE(), num_vertices, row_size,
+                [&sources](int64_t i, char *row) {
+                    for (const auto &source : sources) {
+                        std::memcpy(row, source.first + i * source.second,
+                                    source.second);
+                        row += source.second;
+                    }
+                });
+        reporter.Update(50);
+        const int64_t *triangles_ptr =
+                static_cast<const int64_t *>(triangles.GetDataPtr());
+        success = success &&
+                  WritePLYRows(file.GetFILE(), num_triangles, 13,
+                               [triangles_ptr](int64_t i, char *row) {
+                                   int32_t indices[3];
+                                   for (int k = 0; k < 3; ++k) {
+                                       indices[k] = static_cast<int32_t>(
+                                               triangles_ptr[3 * i + k]);
+                                   }
+                                   row[0] = 3;
+                                   std::memcpy(row + 1, indices, 12);
+                               });
+        if (!success) {
+            utility::LogWarning("Write PLY failed: unable to write file: {}",
+                                filename);
+            return false;
+        }
+        reporter.Finish();
+        return true;
+    } catch (const std::exception &e) {
+        utility::LogWarning("Write PLY failed with exception: {}", e.what());
+        return false;
+    }
+}
+
 }  // namespace io
 }  // namespace t
 }  // namespace open3d
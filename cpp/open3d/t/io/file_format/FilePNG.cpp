@@ -0,0 +1,162 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include <png.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include "open3d/t/io/ImageIO.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/FileSystem.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+/// Owns the libpng read structures and the file of a PNG read.
+class PNGReadContext {
+public:
+    PNGReadContext() {
+        png_ = png_create_read_struct(PNG_LIBPNG_VER_STRING, nullptr, nullptr,
+                                      nullptr);
+        if (png_ != nullptr) {
+            info_ = png_create_info_struct(png_);
+        }
+    }
+    ~PNGReadContext() {
+        if (png_ != nullptr) {
+            png_destroy_read_struct(&png_, info_ ? &info_ : nullptr, nullptr);
+        }
+        if (file_ != nullptr) {
+            fclose(file_);
+        }
+    }
+
+    png_structp png_ = nullptr;
+    png_infop info_ = nullptr;
+    FILE *file_ = nullptr;
+};
+
+static bool IsLittleEndianHost() {
+    const uint16_t value = 1;
+    return *reinterpret_cast<const uint8_t *>(&value) == 1;
+}
+
+// libpng reports errors with longjmp, so the functions calling setjmp only
+// hold trivially destructible objects.
+
+/// Reads the header and sets up the transformations to 8-bit or 16-bit gray,
+/// gray alpha, RGB or RGBA samples, with 16-bit samples in host byte order.
+static bool ReadPNGHeader(png_structp png,
+                          png_infop info,
+                          FILE *file,
+                          int64_t &rows,
+                          int64_t &cols,
+                          int64_t &channels,
+                          int &bit_depth) {
+    if (setjmp(png_jmpbuf(png))) {
+        return false;
+    }
+    png_init_io(png, file);
+    png_read_info(png, info);
+    int color_type = png_get_color_type(png, info);
+    bit_depth = png_get_bit_depth(png, info);
+    if (color_type == PNG_COLOR_TYPE_PALETTE) {
+        png_set_palette_to_rgb(png);
+    }
+    if (color_type == PNG_COLOR_TYPE_GRAY && bit_depth < 8) {
+        png_set_expand_gray_1_2_4_to_8(png);
+    }
+    if (png_get_valid(png, info, PNG_INFO_tRNS)) {
+        png_set_tRNS_to_alpha(png);
+    }
+    if (bit_depth == 16 && IsLittleEndianHost()) {
+        png_set_swap(png);
+    }
+    png_set_interlace_handling(png);
+    png_read_update_info(png, info);
+    rows = png_get_image_height(png, info);
+    cols = png_get_image_width(png, info);
+    channels = png_get_channels(png, info);
+    bit_depth = png_get_bit_depth(png, info);
+    return true;
+}
+
+static bool ReadPNGRows(png_structp png, png_infop info, png_bytepp rows) {
+    if (setjmp(png_jmpbuf(png))) {
+        return false;
+    }
+    png_read_image(png, rows);
+    png_read_end(png, nullptr);
+    return true;
+}
+
+bool ReadImageIntoFromPNG(const std::string &filename,
+                          geometry::Image &image) {
+    PNGReadContext context;
+    if (context.png_ == nullptr || context.info_ == nullptr) {
+        utility::LogWarning("Read PNG failed: unable to create reader.");
+        return false;
+    }
+    context.file_ = utility::filesystem::FOpen(filename, "rb");
+    if (context.file_ == nullptr) {
+        utility::LogWarning("Read PNG failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    int64_t rows, cols, channels;
+    int bit_depth;
+    if (!ReadPNGHeader(context.png_, context.info_, context.file_, rows, cols,
+                       channels, bit_depth)) {
+        utility::LogWarning("Read PNG failed: unable to parse header.");
+        return false;
+    }
+
+    // Decode the rows straight into the image tensor.
+    core::Tensor buffer = GetImageDecodeBuffer(
+            image, rows, cols, channels,
+            bit_depth == 16 ? core::Dtype::UInt16 : core::Dtype::UInt8);
+    png_bytep data = static_cast<png_bytep>(buffer.GetDataPtr());
+    int64_t row_bytes = cols * channels * buffer.GetDtype().ByteSize();
+    std::vector<png_bytep> row_pointers(rows);
+    for (int64_t r = 0; r < rows; ++r) {
+        row_pointers[r] = data + r * row_bytes;
+    }
+    if (!ReadPNGRows(context.png_, context.info_, row_pointers.data())) {
+        utility::LogWarning("Read PNG failed: unable to read file: {}",
+                            filename);
+        return false;
+    }
+    SetImageFromDecodeBuffer(buffer, image);
+    return true;
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,347 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/io/TriangleMeshIO.h"
+#include "open3d/utility/ASCIIParser.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Parallel.h"
+#include "open3d/utility/ProgressReporters.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+// A binary STL file is an 80 byte header, the uint32 number of triangles and
+// one 50 byte record per triangle: the normal and the three vertices as
+// float32, followed by a uint16 attribute.
+static const int64_t kSTLHeaderSize = 84;
+static const int64_t kSTLRecordSize = 50;
+
+/// Returns the vertices and normals of the facets of an ASCII STL file, in
+/// file order. The lines are parsed in parallel.
+static bool ParseASCIISTL(const char *begin,
+                          const char *end,
+                          std::vector<float> &vertices,
+                          std::vector<float> &normals) {
+    std::vector<const char *> range_begins =
+            utility::SplitASCIIRanges(begin, end, 1 << 20);
+    int64_t num_ranges = static_cast<int64_t>(range_begins.size()) - 1;
+    std::vector<std::vector<float>> range_vertices(num_ranges);
+    std::vector<std::vector<float>> range_normals(num_ranges);
+    std::vector<char> range_success(num_ranges, 1);
+#pragma omp parallel for schedule(dynamic) num_threads(utility::EstimateMaxThreads())
+    for (int64_t r = 0; r < num_ranges; ++r) {
+        const char *line = range_begins[r];
+        const char *range_end = range_begins[r + 1];
+        while (line < range_end) {
+            const char *line_end = static_cast<const char *>(
+                    std::memchr(line, '\n', range_end - line));
+            line_end = line_end ? line_end : range_end;
+            const char *p = utility::SkipASCIISpaces(line, line_end);
+            std::vector<float> *values = nullptr;
+            if (line_end - p > 6 && std::memcmp(p, "vertex", 6) == 0) {
+                values = &range_vertices[r];
+                p += 6;
+            } else if (line_end - p > 12 &&
+                       std::memcmp(p, "facet normal", 12) == 0) {
+                values = &range_normals[r];
+                p += 12;
+            }
+            for (int c = 0; values != nullptr && c < 3; ++c) {
+                double value;
+                p = utility::SkipASCIISpaces(p, line_end);
+                const char *next = utility::ParseDouble(p, line_end, value);
+                if (next == p) {
+                    range_success[r] = 0;
+                    break;
+                }
+                values->push_back(static_cast<float>(value));
+                p = next;
+            }
+            line = line_end < range_end ? line_end + 1 : range_end;
+        }
+    }
+    if (std::find(range_success.begin(), range_success.end(), 0) !=
+        range_success.end()) {
+        return false;
+    }
+    for (int64_t r = 0; r < num_ranges; ++r) {
+        vertices.insert(vertices.end(), range_vertices[r].begin(),
+                        range_vertices[r].end());
+        normals.insert(normals.end(), range_normals[r].begin(),
+                       range_normals[r].end());
+    }
+    return vertices.size() == 3 * normals.size();
+}
+
+bool ReadTriangleMeshFromSTL(const std::string &filename,
+                             geometry::TriangleMesh &mesh,
+                             bool print_progress) {
+    try {
+        utility::ConsoleProgressUpdater progress_updater(
+                "Reading STL file: " + filename, print_progress);
+        utility::CountingProgressReporter reporter(progress_updater);
+        utility::ASCIIFileView view;
+        if (!view.Open(filename)) {
+            utility::LogWarning("Read STL failed: unable to open file: {}",
+                                filename);
+            return false;
+        }
+        const char *data = view.GetData();
+        int64_t file_size = view.GetSize();
+
+        uint32_t num_binary_triangles = 0;
+        if (file_size >= kSTLHeaderSize) {
+            std::memcpy(&num_binary_triangles, data + 80, 4);
+        }
+        bool is_binary =
+                file_size >= kSTLHeaderSize &&
+                file_size == kSTLHeaderSize + kSTLRecordSize *
+                                                      num_binary_triangles;
+        int64_t num_triangles;
+        core::Tensor vertices, normals;
+        if (is_binary) {
+            num_triangles = num_binary_triangles;
+            vertices = core::Tensor({num_triangles * 3, 3},
+                                    core::Dtype::Float32);
+            normals = core::Tensor({num_triangles, 3}, core::Dtype::Float32);
+            float *vertices_ptr = static_cast<float *>(vertices.GetDataPtr());
+            float *normals_ptr = static_cast<float *>(normals.GetDataPtr());
+            const char *records = data + kSTLHeaderSize;
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+            for (int64_t i = 0; i < num_triangles; ++i) {
+                const char *record = records + i * kSTLRecordSize;
+                std::memcpy(normals_ptr + 3 * i, record, 12);
+                std::memcpy(vertices_ptr + 9 * i, record + 12, 36);
+            }
+        } else if (file_size >= 5 && std::memcmp(data, "solid", 5) == 0) {
+            std::vector<float> vertex_values, normal_values;
+            if (!ParseASCIISTL(data, data + file_size, vertex_values,
+                               normal_values)) {
+                utility::LogWarning(
+                        "Read STL failed: malformed ASCII file: {}", filename);
+                return false;
+            }
+            num_triangles = static_cast<int64_t>(normal_values.size()) / 3;
+            vertices = core::Tensor(vertex_values, {num_triangles * 3, 3},
+                                    core::Dtype::Float32);
+            normals = core::Tensor(normal_values, {num_triangles, 3},
+                                   core::Dtype::Float32);
+        } else {
+            utility::LogWarning("Read STL failed: invalid file size: {}",
+                                filename);
+            return false;
+        }
+        reporter.Update(50);
+
+        // The facets store their own copies of the vertices, which are merged
+        // by a hashmap on the device of the mesh.
+        core::Device device = mesh.GetDevice();
+        core::Tensor triangles = core::Tensor::Arange(
+                0, num_triangles * 3, 1, core::Dtype::Int64, device);
+        auto to_device = [&device](const core::Tensor &tensor) {
+            return tensor.GetDevice() == device ? tensor : tensor.Copy(device);
+        };
+        mesh = geometry::TriangleMesh(device);
+        mesh.SetVertices(to_device(vertices));
+        mesh.SetTriangles(triangles.Reshape({num_triangles, 3}));
+        mesh.SetTriangleNormals(to_device(normals));
+        mesh.RemoveDuplicatedVertices();
+        reporter.Finish();
+        return true;
+    } catch (const std::exception &e) {
+        utility::LogWarning("Read STL failed with exception: {}", e.what());
+        return false;
+    }
+}
+
+/// Returns the unit normal of the triangle (v0, v1, v2), or zero for a
+/// degenerate triangle.
+static void ComputeSTLNormal(const float *v0,
+                             const float *v1,
+                             const float *v2,
+                             float *normal) {
+    float e1[3] = {v1[0] - v0[0], v1[1] - v0[1], v1[2] - v0[2]};
+    float e2[3] = {v2[0] - v0[0], v2[1] - v0[1], v2[2] - v0[2]};
+    normal[0] = e1[1] * e2[2] - e1[2] * e2[1];
+    normal[1] = e1[2] * e2[0] - e1[0] * e2[2];
+    normal[2] = e1[0] * e2[1] - e1[1] * e2[0];
+    float norm = std::sqrt(normal[0] * normal[0] + normal[1] * normal[1] +
+                           normal[2] * normal[2]);
+    for (int k = 0; k < 3; ++k) {
+        normal[k] = norm > 0 ? normal[k] / norm : 0;
+    }
+}
+
+bool WriteTriangleMeshToSTL(const std::string &filename,
+                            const geometry::TriangleMesh &mesh,
+                            bool write_ascii,
+                            bool compressed,
+                            bool print_progress) {
+    try {
+        if (!mesh.HasVertices() || !mesh.HasTriangles() ||
+            mesh.GetTriangles().GetLength() == 0) {
+            utility::LogWarning("Write STL failed: empty mesh.");
+            return false;
+        }
+        const core::Device host("CPU:0");
+        core::Tensor vertices =
+                mesh.GetVertices().Copy(host).To(core::Dtype::Float32);
+        core::Tensor triangles =
+                mesh.GetTriangles().Copy(host).To(core::Dtype::Int64);
+        int64_t num_vertices = vertices.GetLength();
+        int64_t num_triangles = triangles.GetLength();
+        if (num_triangles > int64_t(UINT32_MAX)) {
+            utility::LogWarning("Write STL failed: too many triangles.");
+            return false;
+        }
+        // Normals are computed from the vertices when the mesh has none.
+        core::Tensor normals;
+        if (mesh.HasTriangleNormals()) {
+            normals = mesh.GetTriangleNormals().Copy(host).To(
+                    core::Dtype::Float32);
+        }
+        const float *vertices_ptr =
+                static_cast<const float *>(vertices.GetDataPtr());
+        const int64_t *triangles_ptr =
+                static_cast<const int64_t *>(triangles.GetDataPtr());
+        const float *normals_ptr =
+                normals.NumElements() > 0
+                        ? static_cast<const float *>(normals.GetDataPtr())
+                        : nullptr;
+        if (triangles.Min({0, 1}).Item<int64_t>() < 0 ||
+            triangles.Max({0, 1}).Item<int64_t>() >= num_vertices) {
+            utility::LogWarning(
+                    "Write STL failed: triangle indices out of range.");
+            return false;
+        }
+
+        utility::filesystem::CFile file;
+        if (!file.Open(filename, write_ascii ? "w" : "wb")) {
+            utility::LogWarning("Write STL failed: unable to open file: {}",
+                                filename);
+            return false;
+        }
+        utility::ConsoleProgressUpdater progress_updater(
+                "Writing STL file: " + filename, print_progress);
+        utility::CountingProgressReporter reporter(progress_updater);
+        reporter.SetTotal(num_triangles);
+        auto get_facet = [&](int64_t i, float *normal, const float **v) {
+            for (int k = 0; k < 3; ++k) {
+                v[k] = vertices_ptr + 3 * triangles_ptr[3 * i + k];
+            }
+            if (normals_ptr != nullptr) {
+                std::memcpy(normal, normals_ptr + 3 * i, 12);
+            } else {
+                ComputeSTLNormal(v[0], v[1], v[2], normal);
+            }
+        };
+
+        if (write_ascii) {
+            fprintf(file.GetFILE(), "solid Open3D\n");
+            for (int64_t i = 0; i < num_triangles; ++i) {
+                float n[3];
+                const float *v[3];
+                get_facet(i, n, v);
+                fprintf(file.GetFILE(), "facet normal %e %e %e\nouter loop\n",
+                        n[0], n[1], n[2]);
+                for (int k = 0; k < 3; ++k) {
+                    fprintf(file.GetFILE(), "vertex %e %e %e\n", v[k][0],
+                            v[k][1], v[k][2]);
+                }
+                if (fprintf(file.GetFILE(), "endloop\nendfacet\n") < 0) {
+                    utility::LogWarning(
+                            "Write STL failed: unable to write file: {}",
+                            filename);
+                    return false;
+                }
+                if (i % 1000 == 0) {
+                    reporter.Update(i);
+                }
+            }
+            fprintf(file.GetFILE(), "endsolid Open3D\n");
+            reporter.Finish();
+            return true;
+        }
+
+        char header[kSTLHeaderSize] = "Created by Open3D";
+        uint32_t count = static_cast<uint32_t>(num_triangles);
+        std::memcpy(header + 80, &count, 4);
+        if (fwrite(header, 1, kSTLHeaderSize, file.GetFILE()) !=
+            size_t(kSTLHeaderSize)) {
+            utility::LogWarning("Write STL failed: unable to write file: {}",
+                                filename);
+            return false;
+        }
+        // The records of a block are packed in parallel, then written at
+        // once.
+        const int64_t block_size = 1 << 20;
+        std::vector<char> buffer(
+                std::min(block_size, num_triangles) * kSTLRecordSize);
+        for (int64_t begin = 0; begin < num_triangles; begin += block_size) {
+            int64_t end = std::min(begin + block_size, num_triangles);
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+            for (int64_t i = begin; i < end; ++i) {
+                char *record = buffer.data() + (i - begin) * kSTLRecordSize;
+                float n[3];
+                const float *v[3];
+                get_facet(i, n, v);
+                std::memcpy(record, n, 12);
+                for (int k = 0; k < 3; ++k) {
+                    std::memcpy(record + 12 + 12 * k, v[k], 12);
+                }
+                record[48] = record[49] = 0;
+            }
+            size_t size = static_cast<size_t>((end - begin) * kSTLRecordSize);
+            if (fwrite(buffer.data(), 1, size, file.GetFILE()) != size) {
+                utility::LogWarning(
+                        "Write STL failed: unable to write file: {}",
+                        filename);
+                return false;
+            }
+            reporter.Update(end);
+        }
+        reporter.Finish();
+        return true;
+    } catch (const std::exception &e) {
+        utility::LogWarning("Write STL failed with exception: {}", e.what());
+        return false;
+    }
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
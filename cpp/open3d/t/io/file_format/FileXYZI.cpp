@@ -25,13 +25,16 @@
 // ----------------------------------------------------------------------------
 
 #include <cstdio>
+#include <vector>
 
 #include "open3d/core/Dtype.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/io/CompressedFileIO.h"
 #include "open3d/io/FileFormatIO.h"
 #include "open3d/t/io/PointCloudIO.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Parallel.h"
 #include "open3d/utility/ProgressReporters.h"
 
 namespace open3d {
@@ -46,15 +49,14 @@ bool ReadPointCloudFromXYZI(const std::string &filename,
                             geometry::PointCloud &pointcloud,
                             const open3d::io::ReadPointCloudOption &params) {
     try {
-        utility::filesystem::CFile file;
-        if (!file.Open(filename, "r")) {
+        utility::CountingProgressReporter reporter(params.update_progress);
+        std::vector<double> rows;
+        if (!open3d::io::ReadASCIIRowsFromFile(filename, 4, rows)) {
             utility::LogWarning("Read XYZI failed: unable to open file: {}",
                                 filename);
             return false;
         }
-        utility::CountingProgressReporter reporter(params.update_progress);
-        reporter.SetTotal(file.GetFileSize());
-        int64_t num_points = file.GetNumLines();
+        int64_t num_points = static_cast<int64_t>(rows.size()) / 4;
 
         pointcloud.Clear();
         core::Tensor points({num_points, 3}, core::Dtype::Float64);
@@ -62,20 +64,12 @@ bool ReadPointCloudFromXYZI(const std::string &filename,
         double *points_ptr = static_cast<double *>(points.GetDataPtr());
         double *intensities_ptr =
                 static_cast<double *>(intensities.GetDataPtr());
-
-        int i = 0;
-        double x, y, z, I;
-        const char *line_buffer;
-        while ((line_buffer = file.ReadLine())) {
-            if (sscanf(line_buffer, "%lf %lf %lf %lf", &x, &y, &z, &I) == 4) {
-                points_ptr[3 * i + 0] = x;
-                points_ptr[3 * i + 1] = y;
-                points_ptr[3 * i + 2] = z;
-                intensities_ptr[i] = I;
-            }
-            if (++i % 1000 == 0) {
-                reporter.Update(file.CurPos());
-            }
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+        for (int64_t i = 0; i < num_points; i++) {
+            points_ptr[3 * i + 0] = rows[4 * i + 0];
+            points_ptr[3 * i + 1] = rows[4 * i + 1];
+            points_ptr[3 * i + 2] = rows[4 * i + 2];
+            intensities_ptr[i] = rows[4 * i + 3];
         }
         pointcloud.SetPoints(points);
         pointcloud.SetPointAttr("intensities", intensities);
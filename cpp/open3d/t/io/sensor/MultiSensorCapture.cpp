@@ -0,0 +1,233 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/sensor/MultiSensorCapture.h"
+
+#include <algorithm>
+
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+MultiSensorCapture::MultiSensorCapture(
+        const std::vector<std::shared_ptr<RGBDSensor>> &sensors,
+        uint64_t tolerance_us,
+        size_t buffer_size)
+    : sensors_(sensors),
+      tolerance_us_(tolerance_us),
+      buffer_size_(std::max<size_t>(buffer_size, 1)),
+      queues_(sensors.size()) {
+    if (sensors_.empty()) {
+        utility::LogError("MultiSensorCapture requires at least one sensor.");
+    }
+    for (const auto &sensor : sensors_) {
+        if (!sensor) {
+            utility::LogError("MultiSensorCapture: null sensor.");
+        }
+    }
+}
+
+MultiSensorCapture::~MultiSensorCapture() { StopCapture(); }
+
+bool MultiSensorCapture::StartCapture(bool start_record) {
+    if (!capture_threads_.empty()) {
+        utility::LogWarning("Capture already in progress.");
+        return true;
+    }
+    for (size_t i = 0; i < sensors_.size(); ++i) {
+        if (!sensors_[i]->StartCapture(start_record)) {
+            utility::LogWarning("Failed to start capture from sensor {}.", i);
+            for (size_t j = 0; j < i; ++j) {
+                sensors_[j]->StopCapture();
+            }
+            return false;
+        }
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto &queue : queues_) {
+            queue.clear();
+        }
+        is_capturing_ = true;
+        num_dropped_frames_ = 0;
+        capture_error_.clear();
+    }
+    for (size_t i = 0; i < sensors_.size(); ++i) {
+        capture_threads_.emplace_back(&MultiSensorCapture::CaptureLoop, this,
+                                      i);
+    }
+    return true;
+}
+
+void MultiSensorCapture::StopCapture() {
+    if (capture_threads_.empty()) return;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        is_capturing_ = false;
+    }
+    frames_available_.notify_all();
+    // The capture threads exit after their current frame.
+    for (auto &capture_thread : capture_threads_) {
+        capture_thread.join();
+    }
+    capture_threads_.clear();
+    for (auto &sensor : sensors_) {
+        sensor->StopCapture();
+    }
+}
+
+void MultiSensorCapture::CaptureLoop(size_t index) {
+    RGBDSensor &sensor = *sensors_[index];
+    try {
+        while (true) {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (!is_capturing_) return;
+            }
+            t::geometry::RGBDImage frame = sensor.CaptureFrame(true);
+            if (frame.IsEmpty()) continue;
+            uint64_t timestamp = sensor.GetTimestamp();
+
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto &queue = queues_[index];
+            if (queue.size() == buffer_size_) {
+                queue.pop_front();
+                ++num_dropped_frames_;
+            }
+            queue.push_back({std::move(frame), timestamp});
+            frames_available_.notify_all();
+        }
+    } catch (const std::exception &e) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        capture_error_ = fmt::format("Sensor {}: {}", index, e.what());
+        is_capturing_ = false;
+        frames_available_.notify_all();
+    }
+}
+
+bool MultiSensorCapture::PopMatchedFrames(
+        std::vector<t::geometry::RGBDImage> &frames) {
+    while (true) {
+        uint64_t newest = 0;
+        for (const auto &queue : queues_) {
+            if (queue.empty()) return false;
+            newest = std::max(newest, queue.front().timestamp);
+        }
+        // Frames older than the tolerance from the newest front frame cannot
+        // be matched, since later frames are newer still.
+        bool matched = true;
+        for (auto &queue : queues_) {
+            if (queue.front().timestamp + tolerance_us_ < newest) {
+                queue.pop_front();
+                ++num_dropped_frames_;
+                matched = false;
+            }
+        }
+        if (matched) break;
+    }
+    frames.clear();
+    timestamps_.clear();
+    for (auto &queue : queues_) {
+        frames.push_back(std::move(queue.front().frame));
+        timestamps_.push_back(queue.front().timestamp);
+        queue.pop_front();
+    }
+    return true;
+}
+
+std::vector<t::geometry::RGBDImage> MultiSensorCapture::CaptureFrames(
+        bool wait) {
+    std::vector<t::geometry::RGBDImage> frames;
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!PopMatchedFrames(frames)) {
+        if (!capture_error_.empty()) {
+            std::string error = capture_error_;
+            lock.unlock();
+            utility::LogError("Capture failed: {}", error);
+        }
+        if (!wait || !is_capturing_) {
+            return {};
+        }
+        frames_available_.wait(lock);
+    }
+    return frames;
+}
+
+uint64_t MultiSensorCapture::GetNumDroppedFrames() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return num_dropped_frames_;
+}
+
+/// Stacks the tensors of the same shape and dtype to a tensor of shape
+/// {N, ...} on \p device.
+static core::Tensor StackTensors(const std::vector<core::Tensor> &tensors,
+                                 const core::Device &device) {
+    const core::Tensor &first = tensors.front();
+    core::SizeVector shape = first.GetShape();
+    shape.insert(shape.begin(), static_cast<int64_t>(tensors.size()));
+    core::Device stack_device = first.GetDevice();
+    core::Tensor stacked =
+            stack_device.GetType() == core::Device::DeviceType::CPU &&
+                            device.GetType() == core::Device::DeviceType::CUDA
+                    ? core::Tensor::EmptyPinned(shape, first.GetDtype())
+                    : core::Tensor::Empty(shape, first.GetDtype(),
+                                          stack_device);
+    for (size_t i = 0; i < tensors.size(); ++i) {
+        if (tensors[i].GetShape() != first.GetShape() ||
+            tensors[i].GetDtype() != first.GetDtype() ||
+            tensors[i].GetDevice() != stack_device) {
+            utility::LogError(
+                    "Frame {} has shape {}, dtype {} and device {}, but frame "
+                    "0 has shape {}, dtype {} and device {}.",
+                    i, tensors[i].GetShape(), tensors[i].GetDtype().ToString(),
+                    tensors[i].GetDevice().ToString(), first.GetShape(),
+                    first.GetDtype().ToString(), stack_device.ToString());
+        }
+        stacked[i].AsRvalue() = tensors[i];
+    }
+    return stack_device == device ? stacked : stacked.Copy(device);
+}
+
+std::pair<core::Tensor, core::Tensor> MultiSensorCapture::StackFrames(
+        const std::vector<t::geometry::RGBDImage> &frames,
+        const core::Device &device) {
+    if (frames.empty()) {
+        utility::LogError("No frames to stack.");
+    }
+    std::vector<core::Tensor> colors, depths;
+    for (const auto &frame : frames) {
+        colors.push_back(frame.color_.AsTensor());
+        depths.push_back(frame.depth_.AsTensor());
+    }
+    return std::make_pair(StackTensors(colors, device),
+                          StackTensors(depths, device));
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
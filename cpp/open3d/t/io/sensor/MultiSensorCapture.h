@@ -0,0 +1,146 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/RGBDImage.h"
+#include "open3d/t/io/sensor/RGBDSensor.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+/// \class MultiSensorCapture
+///
+/// Synchronized capture from multiple RGBD sensors.
+///
+/// Each sensor is read by its own capture thread into a small queue.
+/// CaptureFrames() matches the queued frames by their timestamps and returns
+/// one frame per sensor, all within a tolerance of each other. Frames without
+/// a match are dropped. The sensor timestamps must be in the same time domain,
+/// e.g. with hardware synchronization or the global time of RealSense
+/// cameras.
+class MultiSensorCapture {
+public:
+    /// Constructor.
+    ///
+    /// \param sensors Initialized sensors, see RGBDSensor::InitSensor().
+    /// \param tolerance_us Max difference of the timestamps of matched frames
+    /// (us).
+    /// \param buffer_size Number of frames queued per sensor. Older frames are
+    /// dropped.
+    explicit MultiSensorCapture(
+            const std::vector<std::shared_ptr<RGBDSensor>> &sensors,
+            uint64_t tolerance_us = 5000,
+            size_t buffer_size = 4);
+    MultiSensorCapture(const MultiSensorCapture &) = delete;
+    MultiSensorCapture &operator=(const MultiSensorCapture &) = delete;
+    ~MultiSensorCapture();
+
+    /// Start capturing from all sensors, each in its own capture thread.
+    ///
+    /// \param start_record Start recording to the files of the sensors as
+    /// well.
+    /// \return true if all sensors started capturing.
+    bool StartCapture(bool start_record = false);
+
+    /// Stop capturing from all sensors.
+    void StopCapture();
+
+    /// Get the next matched set of frames, in the order of the sensors.
+    ///
+    /// \param wait If true wait for the next matched set, else return
+    /// immediately with an empty vector if it is not yet available.
+    std::vector<t::geometry::RGBDImage> CaptureFrames(bool wait = true);
+
+    /// Get the timestamps (in us) of the last matched set of frames.
+    std::vector<uint64_t> GetTimestamps() const { return timestamps_; }
+
+    /// Number of frames dropped since StartCapture(), because they had no
+    /// match or their queue was full.
+    uint64_t GetNumDroppedFrames() const;
+
+    /// Number of sensors.
+    size_t GetNumSensors() const { return sensors_.size(); }
+
+    /// Get the sensor \p index.
+    std::shared_ptr<RGBDSensor> GetSensor(size_t index) const {
+        return sensors_.at(index);
+    }
+
+    /// Stack frames of the same size to batched color and depth tensors of
+    /// shape {N, rows, cols, channels} on \p device, e.g. for batched
+    /// processing of multiple cameras on the GPU. Host frames are stacked in
+    /// pinned memory and uploaded to a CUDA device in one copy per tensor.
+    ///
+    /// \return The stacked color and depth tensors.
+    static std::pair<core::Tensor, core::Tensor> StackFrames(
+            const std::vector<t::geometry::RGBDImage> &frames,
+            const core::Device &device);
+
+private:
+    /// A captured frame and its timestamp.
+    struct TimedFrame {
+        t::geometry::RGBDImage frame;
+        uint64_t timestamp;
+    };
+
+    /// Capture thread of the sensor \p index.
+    void CaptureLoop(size_t index);
+
+    /// Pops a matched set of frames, if the queues have one. Drops the
+    /// frames that are too old to be matched.
+    bool PopMatchedFrames(std::vector<t::geometry::RGBDImage> &frames);
+
+    std::vector<std::shared_ptr<RGBDSensor>> sensors_;
+    uint64_t tolerance_us_;
+    size_t buffer_size_;
+    std::vector<uint64_t> timestamps_;
+
+    /// Guards the queues and the state below, shared with the capture
+    /// threads.
+    mutable std::mutex mutex_;
+    std::condition_variable frames_available_;
+    std::vector<std::deque<TimedFrame>> queues_;
+    bool is_capturing_ = false;
+    uint64_t num_dropped_frames_ = 0;
+    std::string capture_error_;
+    std::vector<std::thread> capture_threads_;
+};
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
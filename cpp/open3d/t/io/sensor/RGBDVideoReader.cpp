@@ -30,8 +30,10 @@
 
 #include "open3d/io/IJsonConvertibleIO.h"
 #include "open3d/io/ImageIO.h"
+#include "open3d/t/io/sensor/azure_kinect/MKVReader.h"
 #include "open3d/t/io/sensor/realsense/RSBagReader.h"
 #include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace t {
@@ -48,12 +50,7 @@ std::string RGBDVideoReader::ToString() const {
     }
 }
 
-void RGBDVideoReader::SaveFrames(const std::string &frame_path,
-                                 uint64_t start_time,
-                                 uint64_t end_time) {
-    if (!IsOpened()) {
-        utility::LogError("Null file handler. Please call Open().");
-    }
+void RGBDVideoReader::PrepareFramePath(const std::string &frame_path) const {
     bool success = utility::filesystem::MakeDirectoryHierarchy(
             fmt::format("{}/color", frame_path));
     success &= utility::filesystem::MakeDirectoryHierarchy(
@@ -66,12 +63,21 @@ void RGBDVideoReader::SaveFrames(const std::string &frame_path,
     }
     open3d::io::WriteIJsonConvertibleToJSON(
             fmt::format("{}/intrinsic.json", frame_path), GetMetadata());
+}
+
+void RGBDVideoReader::SaveFrames(const std::string &frame_path,
+                                 uint64_t start_time,
+                                 uint64_t end_time) {
+    if (!IsOpened()) {
+        utility::LogError("Null file handler. Please call Open().");
+    }
+    PrepareFramePath(frame_path);
     SeekTimestamp(start_time);
     int idx = 0;
     open3d::geometry::Image im_color, im_depth;
     for (auto tim_rgbd = NextFrame(); !IsEOF() && GetTimestamp() < end_time;
          ++idx, tim_rgbd = NextFrame())
-#pragma omp parallel sections
+#pragma omp parallel sections num_threads(utility::EstimateMaxThreads())
     {
 #pragma omp section
         {
@@ -96,17 +102,23 @@ void RGBDVideoReader::SaveFrames(const std::string &frame_path,
 
 std::shared_ptr<RGBDVideoReader> RGBDVideoReader::Create(
         const std::string &filename) {
+    const std::string extension =
+            utility::filesystem::GetFileExtensionInLowerCase(filename);
 #ifdef BUILD_LIBREALSENSE
-    if (utility::ToLower(filename).compare(filename.length() - 4, 4, ".bag") ==
-        0) {
+    if (extension == "bag") {
         auto reader = std::make_shared<RSBagReader>();
         reader->Open(filename);
         return reader;
-    } else
+    }
 #endif
-    {
-        utility::LogError("Unsupported file format for {}", filename);
+#ifdef BUILD_AZURE_KINECT
+    if (extension == "mkv") {
+        auto reader = std::make_shared<MKVReader>();
+        reader->Open(filename);
+        return reader;
     }
+#endif
+    utility::LogError("Unsupported file format for {}", filename);
 }
 }  // namespace io
 }  // namespace t
@@ -90,6 +90,11 @@ public:
 
     /// Factory function to create object based on RGBD video file type.
     static std::shared_ptr<RGBDVideoReader> Create(const std::string &filename);
+
+protected:
+    /// Creates the 'color' and 'depth' subfolders of \p frame_path and saves
+    /// the metadata to 'intrinsic.json' for SaveFrames().
+    void PrepareFramePath(const std::string &frame_path) const;
 };
 
 }  // namespace io
@@ -0,0 +1,392 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/sensor/azure_kinect/MKVReader.h"
+
+#include <json/json.h>
+#include <k4a/k4a.h>
+#include <k4arecord/playback.h>
+#include <turbojpeg.h>
+
+#include <algorithm>
+#include <unordered_map>
+
+#include "open3d/io/sensor/azure_kinect/K4aPlugin.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+namespace k4a_plugin = open3d::io::k4a_plugin;
+
+MKVReader::MKVReader(size_t buffer_size,
+                     size_t num_threads,
+                     const core::Device &device)
+    : buffer_size_(std::max<size_t>(buffer_size, 1)),
+      num_threads_(num_threads > 0
+                           ? num_threads
+                           : std::max(std::thread::hardware_concurrency(),
+                                      1u)),
+      device_(device) {}
+
+MKVReader::~MKVReader() {
+    if (IsOpened()) Close();
+}
+
+std::string MKVReader::GetTagInMetadata(const std::string &tag_name) {
+    char res_buffer[256];
+    size_t res_size = 256;
+
+    k4a_buffer_result_t result = k4a_plugin::k4a_playback_get_tag(
+            handle_, tag_name.c_str(), res_buffer, &res_size);
+    if (K4A_BUFFER_RESULT_SUCCEEDED == result) {
+        return res_buffer;
+    } else if (K4A_BUFFER_RESULT_TOO_SMALL == result) {
+        utility::LogError("{} tag's content is too long.", tag_name);
+    } else {
+        utility::LogError("{} tag does not exist.", tag_name);
+    }
+}
+
+Json::Value MKVReader::GetMetadataJson() {
+    static const std::unordered_map<int, double> fps_value = {
+            {K4A_FRAMES_PER_SECOND_5, 5.0},
+            {K4A_FRAMES_PER_SECOND_15, 15.0},
+            {K4A_FRAMES_PER_SECOND_30, 30.0}};
+
+    Json::Value value;
+
+    k4a_calibration_t calibration;
+    if (K4A_RESULT_SUCCEEDED !=
+        k4a_plugin::k4a_playback_get_calibration(handle_, &calibration)) {
+        utility::LogError("Failed to get calibration");
+    }
+    k4a_record_configuration_t config;
+    if (K4A_RESULT_SUCCEEDED !=
+        k4a_plugin::k4a_playback_get_record_configuration(handle_, &config)) {
+        utility::LogError("Failed to get record configuration");
+    }
+    if (config.color_format != K4A_IMAGE_FORMAT_COLOR_MJPG) {
+        utility::LogError("Only MJPG color streams are supported.");
+    }
+    start_timestamp_offset_usec_ = config.start_timestamp_offset_usec;
+
+    camera::PinholeCameraIntrinsic pinhole_camera;
+    auto color_camera_calibration = calibration.color_camera_calibration;
+    auto param = color_camera_calibration.intrinsics.parameters.param;
+    pinhole_camera.SetIntrinsics(color_camera_calibration.resolution_width,
+                                 color_camera_calibration.resolution_height,
+                                 param.fx, param.fy, param.cx, param.cy);
+    pinhole_camera.ConvertToJsonValue(value);
+
+    value["device_name"] = "Azure Kinect";
+    value["serial_number"] = GetTagInMetadata("K4A_DEVICE_SERIAL_NUMBER");
+    value["color_format"] = GetTagInMetadata("K4A_COLOR_MODE");
+    value["depth_format"] = GetTagInMetadata("K4A_DEPTH_MODE");
+    value["depth_scale"] = 1000.0;  // Depth in mm.
+
+    value["stream_length_usec"] =
+            k4a_plugin::k4a_playback_get_last_timestamp_usec(handle_);
+    value["width"] = color_camera_calibration.resolution_width;
+    value["height"] = color_camera_calibration.resolution_height;
+    value["fps"] = fps_value.at(config.camera_fps);
+
+    // One transformation per decoder thread.
+    for (size_t i = 0; i < num_threads_; ++i) {
+        transformations_.push_back(
+                k4a_plugin::k4a_transformation_create(&calibration));
+    }
+
+    return value;
+}
+
+bool MKVReader::Open(const std::string &filename) {
+    if (IsOpened()) {
+        Close();
+    }
+
+    if (K4A_RESULT_SUCCEEDED !=
+        k4a_plugin::k4a_playback_open(filename.c_str(), &handle_)) {
+        utility::LogWarning("Unable to open file {}", filename);
+        handle_ = nullptr;
+        return false;
+    }
+    metadata_.ConvertFromJsonValue(GetMetadataJson());
+    metadata_.color_dt_ = core::Dtype::UInt8;
+    metadata_.color_channels_ = 3;
+    metadata_.depth_dt_ = core::Dtype::UInt16;
+    filename_ = filename;
+    utility::LogInfo("File {} opened", filename);
+
+    is_opened_ = true;
+    is_eof_ = false;
+    seek_to_ = UINT64_MAX;
+    next_capture_id_ = next_frame_id_ = 0;
+    timestamp_ = 0;
+    reader_thread_ = std::thread(&MKVReader::ReadCaptures, this);
+    for (size_t i = 0; i < num_threads_; ++i) {
+        decoder_threads_.emplace_back(&MKVReader::DecodeCaptures, this, i);
+    }
+    return true;
+}
+
+void MKVReader::Close() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        is_opened_ = false;
+    }
+    state_changed_.notify_all();
+    if (reader_thread_.joinable()) reader_thread_.join();
+    for (auto &decoder_thread : decoder_threads_) {
+        decoder_thread.join();
+    }
+    decoder_threads_.clear();
+    for (const auto &capture : captures_) {
+        k4a_plugin::k4a_capture_release(capture.capture);
+    }
+    captures_.clear();
+    frames_.clear();
+    for (auto transformation : transformations_) {
+        k4a_plugin::k4a_transformation_destroy(transformation);
+    }
+    transformations_.clear();
+    k4a_plugin::k4a_playback_close(handle_);
+    handle_ = nullptr;
+}
+
+void MKVReader::ReadCaptures() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (is_opened_) {
+        if (seek_to_ != UINT64_MAX) {
+            if (K4A_RESULT_SUCCEEDED !=
+                k4a_plugin::k4a_playback_seek_timestamp(
+                        handle_, seek_to_, K4A_PLAYBACK_SEEK_BEGIN)) {
+                utility::LogWarning("Unable to go to timestamp {}", seek_to_);
+            }
+            // Drop the frames read before the seek.
+            for (const auto &capture : captures_) {
+                k4a_plugin::k4a_capture_release(capture.capture);
+            }
+            captures_.clear();
+            frames_.clear();
+            next_frame_id_ = next_capture_id_;
+            is_eof_ = false;
+            seek_to_ = UINT64_MAX;
+            state_changed_.notify_all();
+            continue;
+        }
+        if (is_eof_ || next_capture_id_ >= next_frame_id_ + buffer_size_) {
+            state_changed_.wait(lock);
+            continue;
+        }
+
+        lock.unlock();
+        k4a_capture_t capture;
+        k4a_stream_result_t res =
+                k4a_plugin::k4a_playback_get_next_capture(handle_, &capture);
+        lock.lock();
+        if (K4A_STREAM_RESULT_EOF == res) {
+            utility::LogDebug("Reader thread EOF.");
+            is_eof_ = true;
+            state_changed_.notify_all();
+        } else if (K4A_STREAM_RESULT_FAILED == res) {
+            utility::LogInfo("Empty frame encountered, skip");
+        } else if (seek_to_ != UINT64_MAX) {
+            k4a_plugin::k4a_capture_release(capture);
+        } else {
+            captures_.push_back({next_capture_id_++, capture});
+            state_changed_.notify_all();
+        }
+    }
+}
+
+/// Decodes a capture into an RGBDImage on \p device, with the depth image
+/// registered to the color camera. Returns an empty image on failure.
+static t::geometry::RGBDImage DecodeImages(k4a_image_t k4a_color,
+                                           k4a_image_t k4a_depth,
+                                           k4a_transformation_t transformation,
+                                           tjhandle decompressor,
+                                           const core::Device &device) {
+    if (K4A_IMAGE_FORMAT_COLOR_MJPG !=
+        k4a_plugin::k4a_image_get_format(k4a_color)) {
+        utility::LogWarning(
+                "Unexpected image format. The stream may have been corrupted.");
+        return t::geometry::RGBDImage();
+    }
+
+    int width = k4a_plugin::k4a_image_get_width_pixels(k4a_color);
+    int height = k4a_plugin::k4a_image_get_height_pixels(k4a_color);
+
+    // Decompress directly to RGB.
+    core::Tensor color({height, width, 3}, core::Dtype::UInt8);
+    if (0 != tjDecompress2(decompressor,
+                           k4a_plugin::k4a_image_get_buffer(k4a_color),
+                           static_cast<unsigned long>(
+                                   k4a_plugin::k4a_image_get_size(k4a_color)),
+                           static_cast<uint8_t *>(color.GetDataPtr()), width,
+                           0 /* pitch */, height, TJPF_RGB,
+                           TJFLAG_FASTDCT | TJFLAG_FASTUPSAMPLE)) {
+        utility::LogWarning("Failed to decompress color image.");
+        return t::geometry::RGBDImage();
+    }
+
+    // Transform depth to the color plane.
+    core::Tensor depth({height, width}, core::Dtype::UInt16);
+    k4a_image_t k4a_transformed_depth = nullptr;
+    if (K4A_RESULT_SUCCEEDED !=
+        k4a_plugin::k4a_image_create_from_buffer(
+                K4A_IMAGE_FORMAT_DEPTH16, width, height,
+                width * sizeof(uint16_t),
+                static_cast<uint8_t *>(depth.GetDataPtr()),
+                width * height * sizeof(uint16_t), NULL, NULL,
+                &k4a_transformed_depth)) {
+        utility::LogWarning("Failed to create transformed depth frame.");
+        return t::geometry::RGBDImage();
+    }
+    bool success = K4A_RESULT_SUCCEEDED ==
+                   k4a_plugin::k4a_transformation_depth_image_to_color_camera(
+                           transformation, k4a_depth, k4a_transformed_depth);
+    k4a_plugin::k4a_image_release(k4a_transformed_depth);
+    if (!success) {
+        utility::LogWarning("Failed to transform depth frame to color frame.");
+        return t::geometry::RGBDImage();
+    }
+
+    if (device != color.GetDevice()) {
+        color = color.Copy(device);
+        depth = depth.Copy(device);
+    }
+    return t::geometry::RGBDImage(color, depth);
+}
+
+void MKVReader::DecodeCaptures(size_t thread_id) {
+    tjhandle decompressor = tjInitDecompress();
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        state_changed_.wait(
+                lock, [this] { return !is_opened_ || !captures_.empty(); });
+        if (!is_opened_) break;
+        Capture capture = captures_.front();
+        captures_.pop_front();
+        lock.unlock();
+
+        Frame frame{t::geometry::RGBDImage(), 0};
+        k4a_image_t k4a_color =
+                k4a_plugin::k4a_capture_get_color_image(capture.capture);
+        k4a_image_t k4a_depth =
+                k4a_plugin::k4a_capture_get_depth_image(capture.capture);
+        if (k4a_color == nullptr || k4a_depth == nullptr) {
+            utility::LogDebug("Skipping empty captures.");
+        } else {
+            try {
+                frame.rgbd = DecodeImages(k4a_color, k4a_depth,
+                                          transformations_[thread_id],
+                                          decompressor, device_);
+            } catch (const std::exception &e) {
+                utility::LogWarning("Failed to decode frame: {}", e.what());
+            }
+            uint64_t timestamp =
+                    k4a_plugin::k4a_image_get_timestamp_usec(k4a_depth);
+            frame.timestamp = timestamp > start_timestamp_offset_usec_
+                                      ? timestamp - start_timestamp_offset_usec_
+                                      : 0;
+        }
+        if (k4a_color != nullptr) k4a_plugin::k4a_image_release(k4a_color);
+        if (k4a_depth != nullptr) k4a_plugin::k4a_image_release(k4a_depth);
+        k4a_plugin::k4a_capture_release(capture.capture);
+
+        lock.lock();
+        // Frames read before a seek are dropped.
+        if (capture.id >= next_frame_id_) {
+            frames_.emplace(capture.id, std::move(frame));
+            state_changed_.notify_all();
+        }
+    }
+    tjDestroy(decompressor);
+}
+
+bool MKVReader::IsEOF() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return is_eof_ && next_frame_id_ == next_capture_id_;
+}
+
+bool MKVReader::SeekTimestamp(uint64_t timestamp) {
+    if (!IsOpened()) {
+        utility::LogWarning("Null file handler. Please call Open().");
+        return false;
+    }
+    if (timestamp >= metadata_.stream_length_usec_) {
+        utility::LogWarning("Timestamp {} exceeds maximum {} (us).", timestamp,
+                            metadata_.stream_length_usec_);
+        return false;
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    seek_to_ = timestamp;
+    state_changed_.notify_all();
+    // Wait for the reader thread, so that no frames before the seek are
+    // returned.
+    state_changed_.wait(lock, [this] { return seek_to_ == UINT64_MAX; });
+    timestamp_ = timestamp;
+    return true;
+}
+
+uint64_t MKVReader::GetTimestamp() const {
+    if (!IsOpened()) {
+        utility::LogWarning("Null file handler. Please call Open().");
+        return UINT64_MAX;
+    }
+    return timestamp_;
+}
+
+t::geometry::RGBDImage MKVReader::NextFrame() {
+    if (!IsOpened()) {
+        utility::LogError("Null file handler. Please call Open().");
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        state_changed_.wait(lock, [this] {
+            return frames_.count(next_frame_id_) > 0 ||
+                   (is_eof_ && next_frame_id_ == next_capture_id_);
+        });
+        auto it = frames_.find(next_frame_id_);
+        if (it == frames_.end()) {
+            utility::LogInfo("EOF reached");
+            return t::geometry::RGBDImage();
+        }
+        Frame frame = std::move(it->second);
+        frames_.erase(it);
+        ++next_frame_id_;
+        state_changed_.notify_all();  // Read ahead.
+        if (!frame.rgbd.IsEmpty()) {
+            timestamp_ = frame.timestamp;
+            return frame.rgbd;
+        }
+    }
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,169 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "open3d/core/Device.h"
+#include "open3d/t/io/sensor/RGBDVideoReader.h"
+
+struct _k4a_playback_t;        // typedef _k4a_playback_t* k4a_playback_t;
+struct _k4a_capture_t;         // typedef _k4a_capture_t* k4a_capture_t;
+struct _k4a_transformation_t;  // typedef _k4a_transformation_t*
+                               // k4a_transformation_t;
+
+namespace open3d {
+namespace t {
+namespace io {
+
+/// \class MKVReader
+///
+/// Azure Kinect mkv file reader.
+///
+/// A reader thread demuxes the captures in order, while a pool of decoder
+/// threads decompresses the MJPG color images, registers the depth images to
+/// the color camera and copies the frames to the target device. Up to
+/// buffer_size frames are read ahead of NextFrame(), which returns them in
+/// order. The output depth frames are aligned to the color frames.
+class MKVReader : public RGBDVideoReader {
+public:
+    static const size_t DEFAULT_BUFFER_SIZE = 16;
+
+    /// Constructor
+    ///
+    /// \param buffer_size (optional) Max number of frames to read ahead.
+    /// \param num_threads (optional) Number of decoder threads. 0 uses one per
+    /// hardware thread.
+    /// \param device (optional) Device of the output frames.
+    explicit MKVReader(size_t buffer_size = DEFAULT_BUFFER_SIZE,
+                       size_t num_threads = 0,
+                       const core::Device &device = core::Device("CPU:0"));
+
+    MKVReader(const MKVReader &) = delete;
+    MKVReader &operator=(const MKVReader &) = delete;
+    virtual ~MKVReader();
+
+    /// Check If the mkv file is opened.
+    virtual bool IsOpened() const override { return handle_ != nullptr; }
+
+    /// Check if the mkv file is all read.
+    virtual bool IsEOF() const override;
+
+    /// Open an mkv playback.
+    ///
+    /// \param filename Path to the mkv file.
+    virtual bool Open(const std::string &filename) override;
+
+    /// Close the opened mkv playback.
+    virtual void Close() override;
+
+    /// Get (read-only) metadata of the playback.
+    virtual const RGBDVideoMetadata &GetMetadata() const override {
+        return metadata_;
+    }
+
+    /// Get reference to the metadata of the RGBD video playback.
+    virtual RGBDVideoMetadata &GetMetadata() override { return metadata_; }
+
+    /// Seek to the timestamp (in us).
+    ///
+    /// \param timestamp Time in us to seek to.
+    virtual bool SeekTimestamp(uint64_t timestamp) override;
+
+    /// Get current timestamp (in us).
+    virtual uint64_t GetTimestamp() const override;
+
+    /// Get the next decoded frame from the mkv playback and return the
+    /// RGBDImage object on the target device.
+    virtual t::geometry::RGBDImage NextFrame() override;
+
+    /// Return filename being read.
+    virtual std::string GetFilename() const override { return filename_; };
+
+    using RGBDVideoReader::SaveFrames;
+    using RGBDVideoReader::ToString;
+
+private:
+    /// A capture read from the file, waiting to be decoded.
+    struct Capture {
+        uint64_t id;
+        _k4a_capture_t *capture;
+    };
+
+    /// A decoded frame, empty if the capture could not be decoded.
+    struct Frame {
+        t::geometry::RGBDImage rgbd;
+        uint64_t timestamp;
+    };
+
+    std::string filename_;
+    RGBDVideoMetadata metadata_;
+    _k4a_playback_t *handle_ = nullptr;
+    /// One transformation per decoder thread, since they are not thread safe.
+    std::vector<_k4a_transformation_t *> transformations_;
+    uint64_t start_timestamp_offset_usec_ = 0;
+
+    size_t buffer_size_;
+    size_t num_threads_;
+    core::Device device_;
+
+    /// Guards all the state below, shared with the reader and decoder
+    /// threads.
+    mutable std::mutex mutex_;
+    std::condition_variable state_changed_;
+    bool is_opened_ = false;
+    bool is_eof_ = false;  ///< The reader thread reached the end of the file.
+    uint64_t seek_to_ = UINT64_MAX;
+    uint64_t next_capture_id_ = 0;  ///< Id of the next capture read.
+    uint64_t next_frame_id_ = 0;    ///< Id of the next frame returned.
+    std::deque<Capture> captures_;
+    std::map<uint64_t, Frame> frames_;
+    uint64_t timestamp_ = 0;  ///< Timestamp of the last returned frame.
+
+    /// Reader thread: reads the captures in order, up to buffer_size_ ahead
+    /// of NextFrame(), and performs the seeks.
+    void ReadCaptures();
+    /// Decoder thread: decodes the captures into frames with the
+    /// transformation \p thread_id.
+    void DecodeCaptures(size_t thread_id);
+    std::thread reader_thread_;
+    std::vector<std::thread> decoder_threads_;
+
+    Json::Value GetMetadataJson();
+    std::string GetTagInMetadata(const std::string &tag_name);
+};
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -28,25 +28,68 @@
 
 #include <json/json.h>
 
+#include <algorithm>
 #include <chrono>
+#include <cstdio>
+#include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <mutex>
 #include <sstream>
 #include <tuple>
 
+#include "open3d/io/IJsonConvertibleIO.h"
+#include "open3d/io/ImageIO.h"
 #include "open3d/t/io/sensor/realsense/RealSensePrivate.h"
 #include "open3d/t/io/sensor/realsense/RealSenseSensorConfig.h"
+#include "open3d/utility/FileSystem.h"
 
 namespace open3d {
 namespace t {
 namespace io {
 
-RSBagReader::RSBagReader(size_t buffer_size)
+static uint64_t GetFileSize(const std::string &filename) {
+    std::ifstream file(filename, std::ios::binary | std::ios::ate);
+    return file ? static_cast<uint64_t>(file.tellg()) : 0;
+}
+
+bool RSBagFrameIndex::ConvertToJsonValue(Json::Value &value) const {
+    value["file_size"] = file_size_;
+    value["stream_length_usec"] = stream_length_usec_;
+    Json::Value timestamps(Json::arrayValue);
+    for (uint64_t timestamp : timestamps_) {
+        timestamps.append(timestamp);
+    }
+    value["timestamps"] = timestamps;
+    return true;
+}
+
+bool RSBagFrameIndex::ConvertFromJsonValue(const Json::Value &value) {
+    if (!value.isObject() || !value["timestamps"].isArray()) {
+        utility::LogWarning(
+                "Frame index read failed: unsupported json format.");
+        return false;
+    }
+    file_size_ = value["file_size"].asUInt64();
+    stream_length_usec_ = value["stream_length_usec"].asUInt64();
+    const Json::Value &timestamps = value["timestamps"];
+    timestamps_.clear();
+    timestamps_.reserve(timestamps.size());
+    for (const auto &timestamp : timestamps) {
+        timestamps_.push_back(timestamp.asUInt64());
+    }
+    return true;
+}
+
+RSBagReader::RSBagReader(size_t buffer_size, size_t num_threads)
     : frame_buffer_(buffer_size),
       frame_position_us_(buffer_size),
       pipe_(new rs2::pipeline),
-      align_to_color_(new rs2::align(rs2_stream::RS2_STREAM_COLOR)) {}
+      align_to_color_(new rs2::align(rs2_stream::RS2_STREAM_COLOR)),
+      num_threads_(num_threads > 0
+                           ? num_threads
+                           : std::max(std::thread::hardware_concurrency(),
+                                      1u)) {}
 
 RSBagReader::~RSBagReader() {
     if (IsOpened()) Close();
@@ -75,6 +118,9 @@ bool RSBagReader::Open(const std::string &filename) {
         return false;
     }
     filename_ = filename;
+    if (load_frame_index_) {
+        LoadFrameIndex();
+    }
     is_eof_ = false;
     is_opened_ = true;
     // Launch thread to keep frame_buffer full
@@ -206,6 +252,12 @@ bool RSBagReader::SeekTimestamp(uint64_t timestamp) {
                             metadata_.stream_length_usec_);
         return false;
     }
+    const auto &timestamps = frame_index_.timestamps_;
+    auto it = std::lower_bound(timestamps.begin(), timestamps.end(),
+                               timestamp);
+    if (it != timestamps.end()) {
+        timestamp = *it;  // Seek exactly to the next frame.
+    }
     seek_to_ = timestamp;  // atomic
     if (is_eof_) {
         Open(filename_);  // EOF requires restarting pipeline.
@@ -225,6 +277,175 @@ uint64_t RSBagReader::GetTimestamp() const {
                    : frame_position_us_[(tail_fid_ - 1) % frame_buffer_.size()];
 }
 
+void RSBagReader::LoadFrameIndex() {
+    frame_index_ = RSBagFrameIndex();
+    const std::string index_filename = GetFrameIndexFilename(filename_);
+    if (!utility::filesystem::FileExists(index_filename)) return;
+    RSBagFrameIndex frame_index;
+    if (!open3d::io::ReadIJsonConvertibleFromJSON(index_filename,
+                                                  frame_index)) {
+        return;
+    }
+    if (frame_index.file_size_ != GetFileSize(filename_) ||
+        frame_index.stream_length_usec_ != metadata_.stream_length_usec_) {
+        utility::LogWarning("Ignoring stale frame index {}", index_filename);
+        return;
+    }
+    frame_index_ = std::move(frame_index);
+    utility::LogDebug("Loaded frame index of {} frames from {}",
+                      frame_index_.timestamps_.size(), index_filename);
+}
+
+bool RSBagReader::SaveFrameIndex(const std::vector<uint64_t> &timestamps) {
+    frame_index_.file_size_ = GetFileSize(filename_);
+    frame_index_.stream_length_usec_ = metadata_.stream_length_usec_;
+    frame_index_.timestamps_ = timestamps;
+    return open3d::io::WriteIJsonConvertibleToJSON(
+            GetFrameIndexFilename(filename_), frame_index_);
+}
+
+std::vector<uint64_t> RSBagReader::ReadFramesParallel(
+        uint64_t start_time,
+        uint64_t end_time,
+        const std::function<void(const t::geometry::RGBDImage &frame,
+                                 uint64_t timestamp)> &process) const {
+    end_time = std::min(end_time, metadata_.stream_length_usec_);
+    if (start_time >= end_time) return {};
+
+    // Split the time range into parts with about the same number of frames,
+    // or the same duration without a frame index.
+    std::vector<uint64_t> bounds{start_time};
+    const auto &timestamps = frame_index_.timestamps_;
+    if (!timestamps.empty()) {
+        auto first = std::lower_bound(timestamps.begin(), timestamps.end(),
+                                      start_time);
+        auto last = std::lower_bound(first, timestamps.end(), end_time);
+        const size_t num_frames = last - first;
+        const size_t num_parts = std::max<size_t>(
+                std::min(num_threads_, num_frames), 1);
+        for (size_t i = 1; i < num_parts; ++i) {
+            bounds.push_back(first[num_frames * i / num_parts]);
+        }
+    } else {
+        for (size_t i = 1; i < num_threads_; ++i) {
+            bounds.push_back(start_time +
+                             (end_time - start_time) * i / num_threads_);
+        }
+    }
+    bounds.push_back(end_time);
+
+    // Seeking may land after the requested position, so each reader starts a
+    // frame early and skips the frames of the previous part.
+    const uint64_t seek_margin =
+            static_cast<uint64_t>(1000 * 1000 / metadata_.fps_);
+    const size_t num_parts = bounds.size() - 1;
+    std::vector<std::vector<uint64_t>> part_timestamps(num_parts);
+    std::vector<std::string> errors(num_parts);
+    std::vector<std::thread> readers;
+    for (size_t i = 0; i < num_parts; ++i) {
+        if (bounds[i] >= bounds[i + 1]) continue;
+        readers.emplace_back([&, i] {
+            try {
+                RSBagReader reader(frame_buffer_.size(), 1);
+                reader.load_frame_index_ = false;
+                reader.seek_to_ =
+                        bounds[i] > seek_margin ? bounds[i] - seek_margin : 0;
+                if (!reader.Open(filename_)) {
+                    errors[i] = fmt::format("Unable to open file {}",
+                                            filename_);
+                    return;
+                }
+                for (auto frame = reader.NextFrame(); !frame.IsEmpty();
+                     frame = reader.NextFrame()) {
+                    const uint64_t timestamp = reader.GetTimestamp();
+                    if (timestamp >= bounds[i + 1]) break;
+                    if (timestamp < bounds[i] ||
+                        (!part_timestamps[i].empty() &&
+                         timestamp <= part_timestamps[i].back())) {
+                        continue;
+                    }
+                    process(frame, timestamp);
+                    part_timestamps[i].push_back(timestamp);
+                }
+            } catch (const std::exception &e) {
+                errors[i] = e.what();
+            }
+        });
+    }
+    for (auto &reader : readers) {
+        reader.join();
+    }
+    for (const auto &error : errors) {
+        if (!error.empty()) {
+            utility::LogError("Error in reading RealSense bag file: {}", error);
+        }
+    }
+
+    std::vector<uint64_t> frame_timestamps;
+    for (const auto &part : part_timestamps) {
+        frame_timestamps.insert(frame_timestamps.end(), part.begin(),
+                                part.end());
+    }
+    return frame_timestamps;
+}
+
+void RSBagReader::SaveFrames(const std::string &frame_path,
+                             uint64_t start_time_us,
+                             uint64_t end_time_us) {
+    if (!IsOpened()) {
+        utility::LogError("Null file handler. Please call Open().");
+    }
+    PrepareFramePath(frame_path);
+    // Frames are decoded out of order, so they are written under their
+    // timestamps and numbered once all parts are done.
+    auto timestamps = ReadFramesParallel(
+            start_time_us, end_time_us,
+            [&frame_path](const t::geometry::RGBDImage &frame,
+                          uint64_t timestamp) {
+                open3d::io::WriteImage(
+                        fmt::format("{0}/color/{1}.jpg.tmp", frame_path,
+                                    timestamp),
+                        frame.color_.ToLegacyImage());
+                open3d::io::WriteImage(
+                        fmt::format("{0}/depth/{1}.png.tmp", frame_path,
+                                    timestamp),
+                        frame.depth_.ToLegacyImage());
+            });
+    for (size_t idx = 0; idx < timestamps.size(); ++idx) {
+        for (const auto &image : {std::make_pair("color", "jpg"),
+                                  std::make_pair("depth", "png")}) {
+            auto image_file = fmt::format("{0}/{1}/{2:05d}.{3}", frame_path,
+                                          image.first, idx, image.second);
+            if (std::rename(fmt::format("{0}/{1}/{2}.{3}.tmp", frame_path,
+                                        image.first, timestamps[idx],
+                                        image.second)
+                                    .c_str(),
+                            image_file.c_str()) != 0) {
+                utility::LogError("Unable to write {}", image_file);
+            }
+            utility::LogDebug("Written {} image to {}", image.first,
+                              image_file);
+        }
+    }
+    if (start_time_us == 0 && end_time_us >= metadata_.stream_length_usec_) {
+        SaveFrameIndex(timestamps);
+    }
+    utility::LogInfo("Written {} depth and color images to {}/{{depth,color}}/",
+                     timestamps.size(), frame_path);
+}
+
+bool RSBagReader::BuildFrameIndex() {
+    if (!IsOpened()) {
+        utility::LogWarning("Null file handler. Please call Open().");
+        return false;
+    }
+    auto timestamps = ReadFramesParallel(
+            0, UINT64_MAX,
+            [](const t::geometry::RGBDImage &, uint64_t) {});
+    utility::LogInfo("Indexed {} frames of {}", timestamps.size(), filename_);
+    return SaveFrameIndex(timestamps);
+}
+
 }  // namespace io
 }  // namespace t
 }  // namespace open3d
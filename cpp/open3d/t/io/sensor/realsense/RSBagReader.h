@@ -28,6 +28,7 @@
 
 #include <atomic>
 #include <condition_variable>
+#include <functional>
 #include <string>
 #include <thread>
 #include <unordered_map>
@@ -47,6 +48,26 @@ namespace open3d {
 namespace t {
 namespace io {
 
+/// Index of the frames of a RealSense bag file, stored in a sidecar JSON file
+/// next to the bag file. The file size and stream length identify the bag
+/// file.
+class RSBagFrameIndex : public utility::IJsonConvertible {
+public:
+    bool ConvertToJsonValue(Json::Value &value) const override;
+
+    bool ConvertFromJsonValue(const Json::Value &value) override;
+
+public:
+    /// Size of the bag file in bytes.
+    uint64_t file_size_ = 0;
+
+    /// Length of the video (usec).
+    uint64_t stream_length_usec_ = 0;
+
+    /// Sorted timestamps (in us) of the synchronized frames.
+    std::vector<uint64_t> timestamps_;
+};
+
 ///  \class RSBagReader
 ///
 /// RealSense Bag file reader.
@@ -73,7 +94,11 @@ public:
     ///
     /// \param buffer_size (optional) Max number of frames to store in the frame
     /// buffer
-    explicit RSBagReader(size_t buffer_size = DEFAULT_BUFFER_SIZE);
+    /// \param num_threads (optional) Number of readers decoding parts of the
+    /// file in parallel in SaveFrames() and BuildFrameIndex(). 0 uses one per
+    /// hardware thread.
+    explicit RSBagReader(size_t buffer_size = DEFAULT_BUFFER_SIZE,
+                         size_t num_threads = 0);
 
     RSBagReader(const RSBagReader &) = delete;
     RSBagReader &operator=(const RSBagReader &) = delete;
@@ -85,7 +110,8 @@ public:
     /// Check if the RSBag file is all read.
     virtual bool IsEOF() const override;
 
-    /// Open an RGBD Video playback.
+    /// Open an RGBD Video playback. The frame index is loaded from the
+    /// sidecar file, if it matches the file.
     ///
     /// \param filename Path to the RSBag file.
     virtual bool Open(const std::string &filename) override;
@@ -101,7 +127,8 @@ public:
     /// Get reference to the metadata of the RGBD video playback.
     virtual RGBDVideoMetadata &GetMetadata() override { return metadata_; }
 
-    /// Seek to the timestamp (in us).
+    /// Seek to the timestamp (in us). With a frame index, this seeks to the
+    /// timestamp of the first frame at or after \p timestamp.
     ///
     /// \param timestamp Time in us to seek to.
     virtual bool SeekTimestamp(uint64_t timestamp) override;
@@ -115,7 +142,31 @@ public:
     /// Return filename being read
     virtual std::string GetFilename() const override { return filename_; };
 
-    using RGBDVideoReader::SaveFrames;
+    /// Save synchronized and aligned individual frames to subfolders, see
+    /// RGBDVideoReader::SaveFrames().
+    ///
+    /// Parts of the time range are decoded in parallel by separate readers,
+    /// which the frame index balances. Saving all frames also saves the frame
+    /// index.
+    virtual void SaveFrames(const std::string &frame_path,
+                            uint64_t start_time_us = 0,
+                            uint64_t end_time_us = UINT64_MAX) override;
+
+    /// Read all frames in parallel to build the frame index and save it to
+    /// the sidecar file.
+    ///
+    /// \return true if the index was saved.
+    bool BuildFrameIndex();
+
+    /// Get the frame index, whose timestamps are empty without an index.
+    const RSBagFrameIndex &GetFrameIndex() const { return frame_index_; }
+
+    /// Get the filename of the sidecar file with the frame index of the bag
+    /// file \p filename.
+    static std::string GetFrameIndexFilename(const std::string &filename) {
+        return filename + ".index.json";
+    }
+
     using RGBDVideoReader::ToString;
 
 private:
@@ -154,6 +205,23 @@ private:
     std::unique_ptr<rs2::pipeline> pipe_;
     std::unique_ptr<rs2::align> align_to_color_;
 
+    /// Reads the frames with timestamps in [start_time, end_time) with
+    /// separate readers for parts of the range, and calls \p process for each
+    /// frame from their threads. Returns the sorted timestamps of the frames.
+    std::vector<uint64_t> ReadFramesParallel(
+            uint64_t start_time,
+            uint64_t end_time,
+            const std::function<void(const t::geometry::RGBDImage &frame,
+                                      uint64_t timestamp)> &process) const;
+    /// Loads the frame index if the sidecar file matches the file.
+    void LoadFrameIndex();
+    /// Sets the frame index to \p timestamps and saves it.
+    bool SaveFrameIndex(const std::vector<uint64_t> &timestamps);
+    RSBagFrameIndex frame_index_;
+    size_t num_threads_;
+    /// False for the readers of ReadFramesParallel().
+    bool load_frame_index_ = true;
+
     Json::Value GetMetadataJson();
     std::string GetTagInMetadata(const std::string &tag_name);
 };
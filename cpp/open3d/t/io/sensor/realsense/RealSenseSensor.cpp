@@ -28,6 +28,7 @@
 
 #include <json/json.h>
 
+#include <chrono>
 #include <string>
 #include <thread>
 #include <vector>
@@ -131,6 +132,18 @@ std::vector<RealSenseValidConfigs> RealSenseSensor::EnumerateDevices() {
     return all_device_info;
 }
 
+/// Wraps the data of a RealSense frame in a CPU tensor without a copy. The
+/// frame must outlive the tensor.
+static core::Tensor WrapFrameData(const rs2::video_frame& frame,
+                                  const core::SizeVector& shape,
+                                  core::Dtype dtype) {
+    void* data = const_cast<void*>(frame.get_data());
+    core::Device device("CPU:0");
+    auto blob = std::make_shared<core::Blob>(device, data, [](void*) {});
+    return core::Tensor(shape, core::Tensor::DefaultStrides(shape), data,
+                        dtype, blob);
+}
+
 RealSenseSensor::RealSenseSensor()
     : pipe_{new rs2::pipeline},
       align_to_color_{new rs2::align(rs2_stream::RS2_STREAM_COLOR)},
@@ -214,6 +227,15 @@ bool RealSenseSensor::InitSensor(const RealSenseSensorConfig& sensor_config,
 }
 
 bool RealSenseSensor::StartCapture(bool start_record) {
+    return StartCapture(start_record, false);
+}
+
+bool RealSenseSensor::StartCapture(bool start_record,
+                                   bool async,
+                                   size_t buffer_size,
+                                   bool drop_oldest,
+                                   bool align_depth_to_color,
+                                   const core::Device& device) {
     if (is_capturing_) {
         utility::LogWarning("Capture already in progress.");
         return true;
@@ -235,6 +257,24 @@ bool RealSenseSensor::StartCapture(bool start_record) {
             utility::LogInfo("Recording {}to bag file {}",
                              start_record ? "" : "[Paused] ", filename_);
         }
+        if (async) {
+            // The frames are allocated by the first frames of the camera.
+            frame_buffer_.assign(std::max<size_t>(buffer_size, 2),
+                                 geometry::RGBDImage());
+            frame_timestamps_.assign(frame_buffer_.size(), 0);
+            head_fid_ = 0;
+            tail_fid_ = 0;
+            reading_fid_ = UINT64_MAX;
+            num_dropped_frames_ = 0;
+            drop_oldest_ = drop_oldest;
+            align_depth_to_color_ = align_depth_to_color;
+            device_ = device;
+            if (register_depth_on_device_) {
+                SetDepthCalibration(profile);
+            }
+            is_capturing_async_ = true;
+            capture_thread_ = std::thread(&RealSenseSensor::CaptureLoop, this);
+        }
         return true;
     } catch (const rs2::error& e) {
         utility::LogError("StartCapture() failed: {}: {}",
@@ -243,6 +283,52 @@ bool RealSenseSensor::StartCapture(bool start_record) {
     }
 }
 
+void RealSenseSensor::SetDepthProcessing(bool register_on_device,
+                                         int filter_kernel_size,
+                                         float filter_depth_sigma,
+                                         float filter_distance_sigma) {
+    if (is_capturing_) {
+        utility::LogError("Please SetDepthProcessing() before StartCapture().");
+    }
+    if (filter_kernel_size != 0 &&
+        (filter_kernel_size < 0 || filter_kernel_size % 2 == 0)) {
+        utility::LogError("Kernel size must be odd or 0, but got {}.",
+                          filter_kernel_size);
+    }
+    register_depth_on_device_ = register_on_device;
+    depth_filter_kernel_size_ = filter_kernel_size;
+    depth_filter_depth_sigma_ = filter_depth_sigma;
+    depth_filter_distance_sigma_ = filter_distance_sigma;
+}
+
+void RealSenseSensor::SetDepthCalibration(
+        const rs2::pipeline_profile& profile) {
+    const auto rs_depth = profile.get_stream(RS2_STREAM_DEPTH);
+    const auto rs_color = profile.get_stream(RS2_STREAM_COLOR);
+    auto to_intrinsic = [](const rs2_intrinsics& intr) {
+        return core::Tensor(std::vector<float>{intr.fx, 0, intr.ppx, 0,
+                                               intr.fy, intr.ppy, 0, 0, 1},
+                            {3, 3}, core::Dtype::Float32);
+    };
+    depth_intrinsic_ = to_intrinsic(
+            rs_depth.as<rs2::video_stream_profile>().get_intrinsics());
+    color_intrinsic_ = to_intrinsic(
+            rs_color.as<rs2::video_stream_profile>().get_intrinsics());
+
+    // The rotation of librealsense is column major.
+    const rs2_extrinsics extr =
+            rs_depth.as<rs2::video_stream_profile>().get_extrinsics_to(
+                    rs_color);
+    depth_to_color_ = core::Tensor::Eye(4, core::Dtype::Float32,
+                                        core::Device("CPU:0"));
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            depth_to_color_[i][j] = extr.rotation[j * 3 + i];
+        }
+        depth_to_color_[i][3] = extr.translation[i];
+    }
+}
+
 void RealSenseSensor::PauseRecord() {
     if (!enable_recording_ || !is_recording_) return;
     pipe_->get_active_profile().get_device().as<rs2::recorder>().pause();
@@ -277,6 +363,9 @@ geometry::RGBDImage RealSenseSensor::CaptureFrame(bool wait,
         utility::LogError("Please StartCapture() first.");
         return geometry::RGBDImage();
     }
+    if (is_capturing_async_) {
+        return ReadBufferedFrame(wait, false);
+    }
     try {
         rs2::frameset frames;
         if (!((wait && pipe_->try_wait_for_frames(&frames)) ||
@@ -304,7 +393,155 @@ geometry::RGBDImage RealSenseSensor::CaptureFrame(bool wait,
     }
 }
 
+geometry::RGBDImage RealSenseSensor::GetLatestFrame(bool wait) {
+    if (!is_capturing_async_) {
+        utility::LogError("Please StartCapture() with async first.");
+        return geometry::RGBDImage();
+    }
+    return ReadBufferedFrame(wait, true);
+}
+
+void RealSenseSensor::CaptureLoop() {
+    const uint64_t buffer_size = frame_buffer_.size();
+    while (is_capturing_async_) {
+        try {
+            rs2::frameset frames;
+            if (!pipe_->try_wait_for_frames(&frames, CAPTURE_TIMEOUT_MS)) {
+                continue;
+            }
+            const bool register_depth =
+                    align_depth_to_color_ && register_depth_on_device_;
+            if (align_depth_to_color_ && !register_depth) {
+                frames = align_to_color_->process(frames);
+            }
+
+            const uint64_t head = head_fid_;
+            uint64_t tail = tail_fid_;
+            if (head - tail >= buffer_size) {
+                if (!drop_oldest_) {
+                    ++num_dropped_frames_;
+                    continue;
+                }
+                // Fails if the caller has just read the oldest frame.
+                if (tail_fid_.compare_exchange_strong(tail, tail + 1)) {
+                    ++num_dropped_frames_;
+                }
+            }
+            if (head >= buffer_size && reading_fid_ == head - buffer_size) {
+                // The caller is copying the frame of this slot.
+                ++num_dropped_frames_;
+                continue;
+            }
+
+            const auto& color_frame = frames.get_color_frame();
+            const auto& depth_frame = frames.get_depth_frame();
+            core::Tensor color = WrapFrameData(
+                    color_frame,
+                    {color_frame.get_height(), color_frame.get_width(),
+                     metadata_.color_channels_},
+                    metadata_.color_dt_);
+            core::Tensor depth = WrapFrameData(
+                    depth_frame,
+                    {depth_frame.get_height(), depth_frame.get_width()},
+                    metadata_.depth_dt_);
+
+            // Copy into the preallocated frame, which is reallocated only if
+            // the image size changes.
+            geometry::RGBDImage& frame = frame_buffer_[head % buffer_size];
+            core::Tensor frame_color = frame.color_.AsTensor();
+            if (frame_color.GetShape() != color.GetShape()) {
+                frame_color = core::Tensor(color.GetShape(), color.GetDtype(),
+                                           device_);
+                frame.color_ = frame_color;
+            }
+            frame_color.AsRvalue() = color;
+            if (register_depth || depth_filter_kernel_size_ > 0) {
+                // The processed depth image is a new image, so only the raw
+                // depth image is uploaded to a preallocated tensor.
+                if (device_depth_.GetShape() != depth.GetShape()) {
+                    device_depth_ = core::Tensor(depth.GetShape(),
+                                                 depth.GetDtype(), device_);
+                }
+                device_depth_.AsRvalue() = depth;
+                geometry::Image processed(device_depth_);
+                if (register_depth) {
+                    processed = processed.RegisterDepth(
+                            depth_intrinsic_, color_intrinsic_,
+                            depth_to_color_, color.GetShape(0),
+                            color.GetShape(1), float(metadata_.depth_scale_));
+                }
+                if (depth_filter_kernel_size_ > 0) {
+                    processed = processed.FilterBilateralDepth(
+                            depth_filter_kernel_size_,
+                            depth_filter_depth_sigma_,
+                            depth_filter_distance_sigma_);
+                }
+                frame.depth_ = processed;
+            } else {
+                core::Tensor frame_depth = frame.depth_.AsTensor();
+                if (frame_depth.GetShape() != depth.GetShape()) {
+                    frame_depth = core::Tensor(depth.GetShape(),
+                                               depth.GetDtype(), device_);
+                    frame.depth_ = frame_depth;
+                }
+                frame_depth.AsRvalue() = depth;
+            }
+            frame.aligned_ = align_depth_to_color_;
+            frame_timestamps_[head % buffer_size] =
+                    uint64_t(frames.get_timestamp() * MILLISEC_TO_MICROSEC);
+            head_fid_ = head + 1;
+        } catch (const rs2::error& e) {
+            utility::LogWarning("Capture thread failed: {}: {}",
+                                rs2_exception_type_to_string(e.get_type()),
+                                e.what());
+        }
+    }
+}
+
+geometry::RGBDImage RealSenseSensor::ReadBufferedFrame(bool wait,
+                                                       bool latest) {
+    const uint64_t buffer_size = frame_buffer_.size();
+    while (true) {
+        const uint64_t tail = tail_fid_;
+        const uint64_t head = head_fid_;
+        if (tail == head) {
+            if (!wait) {
+                return geometry::RGBDImage();
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            continue;
+        }
+        const uint64_t fid = latest ? head - 1 : tail;
+        reading_fid_ = fid;
+        if (tail_fid_ > fid) {
+            // Dropped by the capture thread before it saw reading_fid_.
+            reading_fid_ = UINT64_MAX;
+            continue;
+        }
+        const geometry::RGBDImage& frame = frame_buffer_[fid % buffer_size];
+        geometry::RGBDImage image;
+        image.color_ = frame.color_.AsTensor().Copy();
+        image.depth_ = frame.depth_.AsTensor().Copy();
+        image.aligned_ = frame.aligned_;
+        timestamp_ = frame_timestamps_[fid % buffer_size];
+
+        uint64_t expected = tail;
+        while (expected <= fid &&
+               !tail_fid_.compare_exchange_weak(expected, fid + 1)) {
+        }
+        reading_fid_ = UINT64_MAX;
+        if (expected <= fid) {
+            num_dropped_frames_ += fid - expected;
+        }
+        return image;
+    }
+}
+
 void RealSenseSensor::StopCapture() {
+    if (is_capturing_async_) {
+        is_capturing_async_ = false;
+        capture_thread_.join();
+    }
     if (is_capturing_) {
         pipe_->stop();
         is_recording_ = false;
@@ -26,7 +26,10 @@
 
 #pragma once
 
+#include <atomic>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "open3d/t/geometry/RGBDImage.h"
 #include "open3d/t/io/sensor/RGBDSensor.h"
@@ -37,6 +40,7 @@ namespace rs2 {
 class pipeline;
 class align;
 class config;
+class pipeline_profile;
 }  // namespace rs2
 
 namespace open3d {
@@ -92,6 +96,47 @@ public:
     /// \param start_record start recording to the specified bag file as well.
     virtual bool StartCapture(bool start_record = false) override;
 
+    /// Start capturing synchronized depth and color frames, optionally in a
+    /// separate capture thread.
+    ///
+    /// The capture thread waits for the frames, aligns them, copies them to
+    /// \p device and stores them in a ring buffer of \p buffer_size
+    /// preallocated frames. Slow processing of the frames then does not stall
+    /// the camera. CaptureFrame() returns the oldest and GetLatestFrame() the
+    /// newest frame of the buffer.
+    /// \param start_record start recording to the specified bag file as well.
+    /// \param async Capture frames in a separate thread.
+    /// \param buffer_size Number of frames of the ring buffer.
+    /// \param drop_oldest If the buffer is full, drop the oldest frame instead
+    /// of the new frame.
+    /// \param align_depth_to_color Align the depth image to the color image.
+    /// \param device Device of the frames.
+    bool StartCapture(bool start_record,
+                      bool async,
+                      size_t buffer_size = 4,
+                      bool drop_oldest = true,
+                      bool align_depth_to_color = true,
+                      const core::Device &device = core::Device("CPU:0"));
+
+    /// Process the depth frames of the capture thread on its device, set
+    /// before StartCapture() with async.
+    ///
+    /// \param register_on_device Register the depth image to the color camera
+    /// with Image::RegisterDepth() on the device of the frames, instead of
+    /// aligning the frames with librealsense on the CPU. Lens distortion is
+    /// ignored.
+    /// \param filter_kernel_size Odd kernel size of
+    /// Image::FilterBilateralDepth() for the depth image, or 0 to not filter
+    /// it.
+    /// \param filter_depth_sigma Standard deviation of the difference of the
+    /// depths, in depth units.
+    /// \param filter_distance_sigma Standard deviation of the distance, in
+    /// pixels.
+    void SetDepthProcessing(bool register_on_device,
+                            int filter_kernel_size = 0,
+                            float filter_depth_sigma = 20.0f,
+                            float filter_distance_sigma = 3.0f);
+
     /// Pause recording to the bag file.
     virtual void PauseRecord() override;
 
@@ -101,6 +146,8 @@ public:
 
     ///  Acquire the next synchronized RGBD frameset from the camera.
     ///
+    /// With a capture thread, this returns the oldest frame of the buffer and
+    /// the alignment is set by StartCapture().
     /// \param wait If true wait for the next frame set, else return immediately
     /// with an empty RGBDImage if it is not yet available.
     /// \param align_depth_to_color Enable aligning WFOV depth image to
@@ -108,6 +155,17 @@ public:
     virtual geometry::RGBDImage CaptureFrame(
             bool wait = true, bool align_depth_to_color = true) override;
 
+    /// Acquire the newest frame of the capture thread and drop the older
+    /// frames of the buffer.
+    ///
+    /// \param wait If true wait for the next frame set, else return immediately
+    /// with an empty RGBDImage if it is not yet available.
+    geometry::RGBDImage GetLatestFrame(bool wait = true);
+
+    /// Number of frames dropped by the capture thread since StartCapture(),
+    /// because the buffer was full or by GetLatestFrame().
+    uint64_t GetNumDroppedFrames() const { return num_dropped_frames_; }
+
     /// Get current timestamp (in us)
     ///
     /// See
@@ -141,7 +199,46 @@ private:
     std::unique_ptr<rs2::align> align_to_color_;
     std::unique_ptr<rs2::config> rs_config_;
 
+    /// The capture thread and its ring buffer.
+    ///
+    /// This is a lock-free single producer single consumer queue. The capture
+    /// thread writes the frame at head_fid_ and the caller reads frames from
+    /// tail_fid_. When the buffer is full, the capture thread drops the oldest
+    /// frame by advancing tail_fid_. The caller announces the frame it copies
+    /// in reading_fid_, which the capture thread then does not overwrite.
+    void CaptureLoop();
+    /// Copies the oldest frame, or the newest frame if \p latest, out of the
+    /// buffer.
+    geometry::RGBDImage ReadBufferedFrame(bool wait, bool latest);
+    /// Reads the calibration of the depth registration from \p profile.
+    void SetDepthCalibration(const rs2::pipeline_profile &profile);
+    std::thread capture_thread_;
+    std::atomic<bool> is_capturing_async_{false};
+    bool align_depth_to_color_ = true;
+    bool drop_oldest_ = true;
+    core::Device device_;
+    std::vector<geometry::RGBDImage> frame_buffer_;
+    std::vector<uint64_t> frame_timestamps_;
+    std::atomic<uint64_t> head_fid_{0};
+    std::atomic<uint64_t> tail_fid_{0};
+    std::atomic<uint64_t> reading_fid_{UINT64_MAX};
+    std::atomic<uint64_t> num_dropped_frames_{0};
+
+    /// Depth processing of the capture thread, see SetDepthProcessing().
+    bool register_depth_on_device_ = false;
+    int depth_filter_kernel_size_ = 0;
+    float depth_filter_depth_sigma_ = 20.0f;
+    float depth_filter_distance_sigma_ = 3.0f;
+    /// Calibration of the streams for the depth registration.
+    core::Tensor depth_intrinsic_;
+    core::Tensor color_intrinsic_;
+    core::Tensor depth_to_color_;
+    /// Raw depth image on the device of the frames.
+    core::Tensor device_depth_;
+
     static const uint64_t MILLISEC_TO_MICROSEC = 1000;
+    /// Timeout of the capture thread, after which it checks if it should stop.
+    static const unsigned int CAPTURE_TIMEOUT_MS = 100;
 };
 
 }  // namespace io
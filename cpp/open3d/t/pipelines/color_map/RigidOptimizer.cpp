@@ -0,0 +1,275 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/t/pipelines/color_map/RigidOptimizer.h"
+
+#include <Eigen/Core>
+#include <algorithm>
+#include <tuple>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/nns/NearestNeighborSearch.h"
+#include "open3d/pipelines/color_map/ColorMapUtils.h"
+#include "open3d/t/geometry/Image.h"
+#include "open3d/t/geometry/kernel/PointCloud.h"
+#include "open3d/t/pipelines/kernel/ColorMap.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/Eigen.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace color_map {
+
+namespace {
+
+// Stacks legacy images of equal size into a tensor of shape {k, rows, cols,
+// channels}.
+core::Tensor StackImages(const std::vector<open3d::geometry::Image>& images,
+                         const core::Device& device) {
+    geometry::Image first = geometry::Image::FromLegacyImage(images[0], device);
+    core::Tensor stack({int64_t(images.size()), first.GetRows(),
+                        first.GetCols(), first.GetChannels()},
+                       first.GetDtype(), device);
+    for (size_t i = 0; i < images.size(); ++i) {
+        if (images[i].width_ != images[0].width_ ||
+            images[i].height_ != images[0].height_) {
+            utility::LogError(
+                    "All the images must have the same size, but image {} is "
+                    "{}x{} instead of {}x{}.",
+                    i, images[i].width_, images[i].height_, images[0].width_,
+                    images[0].height_);
+        }
+        stack[i] = geometry::Image::FromLegacyImage(images[i], device)
+                           .AsTensor();
+    }
+    return stack;
+}
+
+}  // namespace
+
+std::tuple<core::Tensor, core::Tensor> RunRigidOptimizer(
+        const geometry::TriangleMesh& mesh,
+        const std::vector<geometry::RGBDImage>& images_rgbd,
+        const core::Tensor& intrinsics,
+        const core::Tensor& extrinsics,
+        const open3d::pipelines::color_map::RigidOptimizerOption& option) {
+    const int64_t k = static_cast<int64_t>(images_rgbd.size());
+    if (k == 0) {
+        utility::LogError("No RGB-D images for the color map optimization.");
+    }
+    if (!mesh.HasVertices()) {
+        utility::LogError("The mesh has no vertices.");
+    }
+    intrinsics.AssertShape({k, 3, 3});
+    extrinsics.AssertShape({k, 4, 4});
+
+    core::Device device = mesh.GetVertices().GetDevice();
+    core::Device host("CPU:0");
+    core::Tensor vertices =
+            mesh.GetVertices().To(core::Dtype::Float32).Contiguous();
+    const int64_t n = vertices.GetLength();
+
+    // The filtering of the images and the depth boundary masks are those of
+    // the legacy optimizer, computed once on the host.
+    std::vector<open3d::geometry::RGBDImage> legacy_rgbd;
+    legacy_rgbd.reserve(k);
+    for (const geometry::RGBDImage& rgbd : images_rgbd) {
+        if (rgbd.color_.GetDtype() != core::Dtype::UInt8 ||
+            rgbd.color_.GetChannels() != 3) {
+            utility::LogError(
+                    "The color images must be UInt8 with 3 channels.");
+        }
+        if (rgbd.depth_.GetDtype() != core::Dtype::Float32) {
+            utility::LogError("The depth images must be Float32 in meters.");
+        }
+        legacy_rgbd.push_back(rgbd.ToLegacyRGBDImage());
+    }
+    std::vector<open3d::geometry::Image> images_gray, images_dx, images_dy,
+            images_color, images_depth;
+    std::tie(images_gray, images_dx, images_dy, images_color, images_depth) =
+            open3d::pipelines::color_map::CreateUtilImagesFromRGBD(
+                    legacy_rgbd);
+    std::vector<open3d::geometry::Image> images_mask =
+            open3d::pipelines::color_map::CreateDepthBoundaryMasks(
+                    images_depth,
+                    option.depth_threshold_for_discontinuity_check_,
+                    option.half_dilation_kernel_size_for_discontinuity_map_);
+
+    core::Tensor gray = StackImages(images_gray, device);
+    core::Tensor color = StackImages(images_color, device);
+    core::Tensor depth = StackImages(images_depth, device);
+    core::Tensor mask = StackImages(images_mask, device);
+    const int64_t rows = gray.GetShape()[1];
+    const int64_t cols = gray.GetShape()[2];
+    core::Tensor gray_maps = gray.Reshape({k, rows, cols});
+    core::Tensor dx_maps =
+            StackImages(images_dx, device).Reshape({k, rows, cols});
+    core::Tensor dy_maps =
+            StackImages(images_dy, device).Reshape({k, rows, cols});
+
+    // The (vertex, image) pairs, grouped by image for the linear systems and
+    // by vertex for the averages.
+    utility::LogDebug("[ColorMapOptimization] ComputeVisibility");
+    std::vector<core::Tensor> visible_vertices(k);
+    std::vector<int64_t> image_offsets_host(k + 1, 0);
+    for (int64_t i = 0; i < k; ++i) {
+        core::Tensor visible;
+        kernel::color_map::ComputeVisibility(
+                vertices, depth[i].Reshape({rows, cols}),
+                mask[i].Reshape({rows, cols}), intrinsics[i], extrinsics[i],
+                static_cast<float>(option.maximum_allowable_depth_),
+                static_cast<float>(
+                        option.depth_threshold_for_visibility_check_),
+                visible);
+        visible_vertices[i] = visible.NonZero()[0];
+        image_offsets_host[i + 1] =
+                image_offsets_host[i] + visible_vertices[i].GetLength();
+    }
+    const int64_t m = image_offsets_host[k];
+    core::Tensor pair_vertices({m}, core::Dtype::Int64, device);
+    core::Tensor pair_images({m}, core::Dtype::Int64, device);
+    for (int64_t i = 0; i < k; ++i) {
+        if (visible_vertices[i].GetLength() > 0) {
+            pair_vertices.Slice(0, image_offsets_host[i],
+                                image_offsets_host[i + 1]) =
+                    visible_vertices[i];
+            pair_images
+                    .Slice(0, image_offsets_host[i], image_offsets_host[i + 1])
+                    .Fill(i);
+        }
+    }
+    core::Tensor image_offsets(image_offsets_host, {k + 1}, core::Dtype::Int64,
+                               device);
+    core::Tensor vertex_offsets, vertex_order;
+    geometry::kernel::pointcloud::SortBySegment(pair_vertices, n,
+                                                vertex_offsets, vertex_order);
+
+    core::Tensor opt_extrinsics =
+            extrinsics.Copy(host).To(core::Dtype::Float64).Contiguous();
+
+    // Averages the images over the pairs of each vertex with the current
+    // poses.
+    auto average_images = [&](const core::Tensor& images,
+                              core::Tensor& averages, core::Tensor& counts) {
+        core::Tensor values, valid;
+        kernel::color_map::SampleImages(
+                vertices, pair_vertices, pair_images, images, intrinsics,
+                opt_extrinsics, option.image_boundary_margin_, values, valid);
+        kernel::color_map::AverageOverVertices(values, valid, vertex_offsets,
+                                               vertex_order, averages, counts);
+    };
+
+    utility::LogDebug("[ColorMapOptimization] Rigid Optimization");
+    core::Tensor proxy_intensity, counts;
+    average_images(gray, proxy_intensity, counts);
+    proxy_intensity = proxy_intensity.Reshape({n});
+    for (int itr = 0; itr < option.maximum_iteration_; ++itr) {
+        core::Tensor systems;
+        kernel::color_map::ComputeRigidSystems(
+                vertices, pair_vertices, image_offsets, proxy_intensity,
+                gray_maps, dx_maps, dy_maps, intrinsics, opt_extrinsics,
+                option.image_boundary_margin_, systems);
+        std::vector<float> A = systems.Copy(host).ToFlatVector<float>();
+        double* T_ptr = static_cast<double*>(opt_extrinsics.GetDataPtr());
+
+        double residual = 0.0;
+        int64_t total_num = 0;
+#pragma omp parallel for schedule(static) reduction(+ : residual, total_num) num_threads(utility::EstimateMaxThreads())
+        for (int64_t c = 0; c < k; ++c) {
+            const float* system =
+                    A.data() + kernel::color_map::kColorMapSystemSize * c;
+            Eigen::Matrix6d JtJ;
+            Eigen::Vector6d Jtr;
+            int idx = 0;
+            for (int i = 0; i < 6; ++i) {
+                for (int j = i; j < 6; ++j) {
+                    JtJ(i, j) = JtJ(j, i) = system[idx++];
+                }
+            }
+            for (int i = 0; i < 6; ++i) {
+                Jtr(i) = system[21 + i];
+            }
+
+            bool success;
+            Eigen::Matrix4d delta;
+            std::tie(success, delta) =
+                    utility::SolveJacobianSystemAndObtainExtrinsicMatrix(JtJ,
+                                                                         Jtr);
+            Eigen::Map<Eigen::Matrix<double, 4, 4, Eigen::RowMajor>> pose(
+                    T_ptr + 16 * c);
+            pose = delta * pose;
+            residual += system[27];
+            total_num += static_cast<int64_t>(system[28]);
+        }
+        utility::LogDebug(
+                "[Iteration {:04d}] Residual error : {:.6f} (avg : {:.6f})",
+                itr + 1, residual,
+                total_num > 0 ? residual / double(total_num) : 0.0);
+
+        average_images(gray, proxy_intensity, counts);
+        proxy_intensity = proxy_intensity.Reshape({n});
+    }
+
+    utility::LogDebug("[ColorMapOptimization] Set Mesh Color");
+    core::Tensor colors;
+    average_images(color, colors, counts);
+    colors = colors / 255.0f;
+
+    // The vertices seen by no image take the average color of their nearest
+    // visible vertices.
+    if (option.invisible_vertex_color_knn_ > 0) {
+        core::Tensor valid_indices = counts.Gt(0).NonZero()[0];
+        core::Tensor invalid_indices = counts.Eq(0).NonZero()[0];
+        const int64_t num_valid = valid_indices.GetLength();
+        const int64_t num_invalid = invalid_indices.GetLength();
+        if (num_valid > 0 && num_invalid > 0) {
+            int knn = static_cast<int>(std::min<int64_t>(
+                    option.invisible_vertex_color_knn_, num_valid));
+            core::nns::NearestNeighborSearch nns(
+                    vertices.IndexGet({valid_indices}));
+            nns.KnnIndex();
+            core::Tensor neighbors =
+                    nns.KnnSearch(vertices.IndexGet({invalid_indices}), knn)
+                            .first;
+            core::Tensor neighbor_colors =
+                    colors.IndexGet({valid_indices})
+                            .IndexGet({neighbors.Reshape({-1})})
+                            .Reshape({num_invalid, knn, 3});
+            colors.IndexSet({invalid_indices}, neighbor_colors.Mean({1}));
+        }
+    }
+
+    return std::make_tuple(colors, opt_extrinsics);
+}
+
+}  // namespace color_map
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
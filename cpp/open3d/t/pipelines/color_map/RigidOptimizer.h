@@ -0,0 +1,72 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <tuple>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/pipelines/color_map/RigidOptimizer.h"
+#include "open3d/t/geometry/RGBDImage.h"
+#include "open3d/t/geometry/TriangleMesh.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace color_map {
+
+/// \brief Rigid color map optimization of a tensor mesh, on the device of its
+/// vertices.
+///
+/// Optimizes the camera poses so that the images agree on the intensity of
+/// the vertices, as the legacy RunRigidOptimizer, then colors the vertices
+/// with the average of the images that see them. The visibility, the linear
+/// systems of all the images and the colors are computed by tensor kernels,
+/// and the 6x6 systems are solved on the host in a batch per iteration.
+///
+/// \param mesh Triangle mesh, whose vertices are Float32 or Float64.
+/// \param images_rgbd RGB-D images of equal size, with UInt8 3-channel colors
+/// and Float32 depth in meters.
+/// \param intrinsics Camera intrinsic matrices of shape {k, 3, 3}.
+/// \param extrinsics World to camera transformations of shape {k, 4, 4}.
+/// \param option Options of the legacy rigid optimizer. debug_output_dir_ is
+/// ignored.
+/// \return Tuple of the Float32 vertex colors of shape {n, 3}, on the device
+/// of the mesh, and the optimized Float64 extrinsics of shape {k, 4, 4} on
+/// the host.
+std::tuple<core::Tensor, core::Tensor> RunRigidOptimizer(
+        const geometry::TriangleMesh& mesh,
+        const std::vector<geometry::RGBDImage>& images_rgbd,
+        const core::Tensor& intrinsics,
+        const core::Tensor& extrinsics,
+        const open3d::pipelines::color_map::RigidOptimizerOption& option);
+
+}  // namespace color_map
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
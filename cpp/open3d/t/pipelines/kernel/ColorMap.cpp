@@ -0,0 +1,265 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/t/pipelines/kernel/ColorMap.h"
+
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+namespace color_map {
+
+namespace {
+
+// Packs the cameras of shape {k, 3, 3} and {k, 4, 4} into a Float32 tensor
+// of shape {k, 16} on device, with fx, fy, cx, cy, the row-major rotation
+// and the translation of each camera.
+core::Tensor PackCameras(const core::Tensor& intrinsics,
+                         const core::Tensor& extrinsics,
+                         const core::Device& device) {
+    int64_t k = extrinsics.GetShape(0);
+    intrinsics.AssertShape({k, 3, 3});
+    extrinsics.AssertShape({k, 4, 4});
+    std::vector<double> K = intrinsics.To(core::Dtype::Float64)
+                                    .Copy(core::Device("CPU:0"))
+                                    .ToFlatVector<double>();
+    std::vector<double> T = extrinsics.To(core::Dtype::Float64)
+                                    .Copy(core::Device("CPU:0"))
+                                    .ToFlatVector<double>();
+    std::vector<float> cameras(16 * k);
+    for (int64_t i = 0; i < k; ++i) {
+        float* camera = cameras.data() + 16 * i;
+        camera[0] = static_cast<float>(K[9 * i + 0]);
+        camera[1] = static_cast<float>(K[9 * i + 4]);
+        camera[2] = static_cast<float>(K[9 * i + 2]);
+        camera[3] = static_cast<float>(K[9 * i + 5]);
+        for (int r = 0; r < 3; ++r) {
+            for (int c = 0; c < 3; ++c) {
+                camera[4 + 3 * r + c] =
+                        static_cast<float>(T[16 * i + 4 * r + c]);
+            }
+            camera[13 + r] = static_cast<float>(T[16 * i + 4 * r + 3]);
+        }
+    }
+    return core::Tensor(cameras, {k, 16}, core::Dtype::Float32, device);
+}
+
+}  // namespace
+
+void ComputeVisibility(const core::Tensor& vertices,
+                       const core::Tensor& depth,
+                       const core::Tensor& mask,
+                       const core::Tensor& intrinsics,
+                       const core::Tensor& extrinsics,
+                       float maximum_allowable_depth,
+                       float depth_threshold,
+                       core::Tensor& visible) {
+    core::Device device = vertices.GetDevice();
+    vertices.AssertDtype(core::Dtype::Float32);
+    vertices.AssertShapeCompatible({utility::nullopt, 3});
+    depth.AssertDtype(core::Dtype::Float32);
+    depth.AssertDevice(device);
+    mask.AssertDtype(core::Dtype::UInt8);
+    mask.AssertShape(depth.GetShape());
+    mask.AssertDevice(device);
+    core::Tensor cameras =
+            PackCameras(intrinsics.Reshape({1, 3, 3}),
+                        extrinsics.Reshape({1, 4, 4}), device);
+    visible = core::Tensor({vertices.GetLength()}, core::Dtype::Bool, device);
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeVisibilityCPU(vertices.Contiguous(), depth.Contiguous(),
+                             mask.Contiguous(), cameras,
+                             maximum_allowable_depth, depth_threshold,
+                             visible);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        ComputeVisibilityCUDA(vertices.Contiguous(), depth.Contiguous(),
+                              mask.Contiguous(), cameras,
+                              maximum_allowable_depth, depth_threshold,
+                              visible);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void SampleImages(const core::Tensor& vertices,
+                  const core::Tensor& pair_vertices,
+                  const core::Tensor& pair_images,
+                  const core::Tensor& images,
+                  const core::Tensor& intrinsics,
+                  const core::Tensor& extrinsics,
+                  int image_boundary_margin,
+                  core::Tensor& values,
+                  core::Tensor& valid) {
+    core::Device device = vertices.GetDevice();
+    vertices.AssertDtype(core::Dtype::Float32);
+    pair_vertices.AssertDtype(core::Dtype::Int64);
+    pair_images.AssertDtype(core::Dtype::Int64);
+    pair_images.AssertShape(pair_vertices.GetShape());
+    if (images.NumDims() != 4) {
+        utility::LogError(
+                "[SampleImages] images must have shape {k, rows, cols, "
+                "channels}, but got {}.",
+                images.GetShape().ToString());
+    }
+    if (images.GetDtype() != core::Dtype::Float32 &&
+        images.GetDtype() != core::Dtype::UInt8) {
+        utility::LogError(
+                "[SampleImages] images must be Float32 or UInt8, but got {}.",
+                images.GetDtype().ToString());
+    }
+    images.AssertDevice(device);
+    core::Tensor cameras = PackCameras(intrinsics, extrinsics, device);
+    int64_t m = pair_vertices.GetLength();
+    values = core::Tensor({m, images.GetShape(3)}, core::Dtype::Float32,
+                          device);
+    valid = core::Tensor({m}, core::Dtype::Bool, device);
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        SampleImagesCPU(vertices.Contiguous(), pair_vertices.Contiguous(),
+                        pair_images.Contiguous(), images.Contiguous(), cameras,
+                        image_boundary_margin, values, valid);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        SampleImagesCUDA(vertices.Contiguous(), pair_vertices.Contiguous(),
+                         pair_images.Contiguous(), images.Contiguous(),
+                         cameras, image_boundary_margin, values, valid);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void AverageOverVertices(const core::Tensor& values,
+                         const core::Tensor& valid,
+                         const core::Tensor& offsets,
+                         const core::Tensor& order,
+                         core::Tensor& averages,
+                         core::Tensor& counts) {
+    core::Device device = values.GetDevice();
+    values.AssertDtype(core::Dtype::Float32);
+    valid.AssertDtype(core::Dtype::Bool);
+    offsets.AssertDtype(core::Dtype::Int64);
+    order.AssertDtype(core::Dtype::Int64);
+    int64_t n = offsets.GetLength() - 1;
+    averages = core::Tensor({n, values.GetShape(1)}, core::Dtype::Float32,
+                            device);
+    counts = core::Tensor({n}, core::Dtype::Int64, device);
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        AverageOverVerticesCPU(values.Contiguous(), valid.Contiguous(),
+                               offsets.Contiguous(), order.Contiguous(),
+                               averages, counts);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        AverageOverVerticesCUDA(values.Contiguous(), valid.Contiguous(),
+                                offsets.Contiguous(), order.Contiguous(),
+                                averages, counts);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void ComputeRigidSystems(const core::Tensor& vertices,
+                         const core::Tensor& pair_vertices,
+                         const core::Tensor& image_offsets,
+                         const core::Tensor& proxy_intensity,
+                         const core::Tensor& gray,
+                         const core::Tensor& gray_dx,
+                         const core::Tensor& gray_dy,
+                         const core::Tensor& intrinsics,
+                         const core::Tensor& extrinsics,
+                         int image_boundary_margin,
+                         core::Tensor& systems) {
+    core::Device device = vertices.GetDevice();
+    vertices.AssertDtype(core::Dtype::Float32);
+    pair_vertices.AssertDtype(core::Dtype::Int64);
+    image_offsets.AssertDtype(core::Dtype::Int64);
+    proxy_intensity.AssertDtype(core::Dtype::Float32);
+    gray.AssertDtype(core::Dtype::Float32);
+    if (gray.NumDims() != 3) {
+        utility::LogError(
+                "[ComputeRigidSystems] gray must have shape {k, rows, cols}, "
+                "but got {}.",
+                gray.GetShape().ToString());
+    }
+    gray_dx.AssertDtype(core::Dtype::Float32);
+    gray_dy.AssertDtype(core::Dtype::Float32);
+    gray_dx.AssertShape(gray.GetShape());
+    gray_dy.AssertShape(gray.GetShape());
+    int64_t k = gray.GetShape(0);
+    image_offsets.AssertShape({k + 1});
+    core::Tensor cameras = PackCameras(intrinsics, extrinsics, device);
+    systems = core::Tensor::Zeros({k, kColorMapSystemSize},
+                                  core::Dtype::Float32, device);
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeRigidSystemsCPU(
+                vertices.Contiguous(), pair_vertices.Contiguous(),
+                image_offsets.Contiguous(), proxy_intensity.Contiguous(),
+                gray.Contiguous(), gray_dx.Contiguous(), gray_dy.Contiguous(),
+                cameras,
+                image_boundary_margin, systems);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        ComputeRigidSystemsCUDA(
+                vertices.Contiguous(), pair_vertices.Contiguous(),
+                image_offsets.Contiguous(), proxy_intensity.Contiguous(),
+                gray.Contiguous(), gray_dx.Contiguous(), gray_dy.Contiguous(),
+                cameras,
+                image_boundary_margin, systems);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+}  // namespace color_map
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,225 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+namespace color_map {
+
+/// Number of floats of the linear system of each image accumulated by
+/// ComputeRigidSystems, in the layout of the odometry system: the 21 entries
+/// of the upper triangle of J^T J, the 6 entries of J^T r, the sum of squared
+/// residuals and the number of residuals.
+constexpr int64_t kColorMapSystemSize = 29;
+
+/// Marks the vertices visible in one RGB-D frame, as the legacy
+/// CreateVertexAndImageVisibility: a vertex is visible if it projects in
+/// front of the camera to a pixel whose sensor depth is at most
+/// maximum_allowable_depth, is not on a depth boundary, and is closer than
+/// depth_threshold to the depth of the vertex.
+///
+/// \param vertices Float32 tensor of shape {n, 3}.
+/// \param depth Float32 depth image of shape {rows, cols} in meters.
+/// \param mask UInt8 depth boundary mask of shape {rows, cols}, 255 on the
+/// boundaries.
+/// \param intrinsics Camera intrinsic matrix of shape {3, 3}.
+/// \param extrinsics World to camera transformation of shape {4, 4}.
+/// \param maximum_allowable_depth Maximum sensor depth of a visible vertex.
+/// \param depth_threshold Maximum difference of the sensor and vertex depths.
+/// \param visible Output Bool tensor of shape {n}.
+void ComputeVisibility(const core::Tensor& vertices,
+                       const core::Tensor& depth,
+                       const core::Tensor& mask,
+                       const core::Tensor& intrinsics,
+                       const core::Tensor& extrinsics,
+                       float maximum_allowable_depth,
+                       float depth_threshold,
+                       core::Tensor& visible);
+
+void ComputeVisibilityCPU(const core::Tensor& vertices,
+                          const core::Tensor& depth,
+                          const core::Tensor& mask,
+                          const core::Tensor& cameras,
+                          float maximum_allowable_depth,
+                          float depth_threshold,
+                          core::Tensor& visible);
+
+#ifdef BUILD_CUDA_MODULE
+void ComputeVisibilityCUDA(const core::Tensor& vertices,
+                           const core::Tensor& depth,
+                           const core::Tensor& mask,
+                           const core::Tensor& cameras,
+                           float maximum_allowable_depth,
+                           float depth_threshold,
+                           core::Tensor& visible);
+#endif
+
+/// Reads the pixels of the images at the projections of (vertex, image)
+/// pairs, rounding the coordinates down as the legacy color map.
+///
+/// \param vertices Float32 tensor of shape {n, 3}.
+/// \param pair_vertices Int64 vertex of each pair, of shape {m}.
+/// \param pair_images Int64 image of each pair, of shape {m}.
+/// \param images Float32 or UInt8 tensor of shape {k, rows, cols, channels}.
+/// \param intrinsics Camera intrinsic matrices of shape {k, 3, 3}.
+/// \param extrinsics World to camera transformations of shape {k, 4, 4}.
+/// \param image_boundary_margin Pairs that project closer than this to the
+/// image border are invalid.
+/// \param values Output Float32 tensor of shape {m, channels}.
+/// \param valid Output Bool tensor of shape {m}.
+void SampleImages(const core::Tensor& vertices,
+                  const core::Tensor& pair_vertices,
+                  const core::Tensor& pair_images,
+                  const core::Tensor& images,
+                  const core::Tensor& intrinsics,
+                  const core::Tensor& extrinsics,
+                  int image_boundary_margin,
+                  core::Tensor& values,
+                  core::Tensor& valid);
+
+void SampleImagesCPU(const core::Tensor& vertices,
+                     const core::Tensor& pair_vertices,
+                     const core::Tensor& pair_images,
+                     const core::Tensor& images,
+                     const core::Tensor& cameras,
+                     int image_boundary_margin,
+                     core::Tensor& values,
+                     core::Tensor& valid);
+
+#ifdef BUILD_CUDA_MODULE
+void SampleImagesCUDA(const core::Tensor& vertices,
+                      const core::Tensor& pair_vertices,
+                      const core::Tensor& pair_images,
+                      const core::Tensor& images,
+                      const core::Tensor& cameras,
+                      int image_boundary_margin,
+                      core::Tensor& values,
+                      core::Tensor& valid);
+#endif
+
+/// Averages the valid values of the pairs of each vertex.
+///
+/// \param values Float32 tensor of shape {m, channels}.
+/// \param valid Bool tensor of shape {m}.
+/// \param offsets Int64 tensor of shape {n + 1}: the pairs of vertex i are
+/// order[offsets[i]:offsets[i + 1]].
+/// \param order Int64 pair indices grouped by vertex, of shape {m}.
+/// \param averages Output Float32 tensor of shape {n, channels}, zero for the
+/// vertices without valid pairs.
+/// \param counts Output Int64 number of valid pairs of each vertex, of shape
+/// {n}.
+void AverageOverVertices(const core::Tensor& values,
+                         const core::Tensor& valid,
+                         const core::Tensor& offsets,
+                         const core::Tensor& order,
+                         core::Tensor& averages,
+                         core::Tensor& counts);
+
+void AverageOverVerticesCPU(const core::Tensor& values,
+                            const core::Tensor& valid,
+                            const core::Tensor& offsets,
+                            const core::Tensor& order,
+                            core::Tensor& averages,
+                            core::Tensor& counts);
+
+#ifdef BUILD_CUDA_MODULE
+void AverageOverVerticesCUDA(const core::Tensor& values,
+                             const core::Tensor& valid,
+                             const core::Tensor& offsets,
+                             const core::Tensor& order,
+                             core::Tensor& averages,
+                             core::Tensor& counts);
+#endif
+
+/// Accumulates the Gauss-Newton systems of the rigid color map optimization
+/// of all images in a single pass over the (vertex, image) pairs.
+///
+/// The residual of a pair is the bilinearly interpolated gray level of the
+/// image at the projection of the vertex minus the proxy intensity of the
+/// vertex, and its Jacobian is taken with respect to a perturbation exp(xi) T
+/// of the extrinsics T of the image, as in the legacy RigidOptimizer.
+///
+/// \param vertices Float32 tensor of shape {n, 3}.
+/// \param pair_vertices Int64 vertex of each pair, of shape {m}, with the
+/// pairs sorted by image.
+/// \param image_offsets Int64 tensor of shape {k + 1}: the pairs of image i
+/// are [image_offsets[i], image_offsets[i + 1]).
+/// \param proxy_intensity Float32 tensor of shape {n}.
+/// \param gray Float32 gray images of shape {k, rows, cols}.
+/// \param gray_dx Float32 Sobel gradient of gray along the columns.
+/// \param gray_dy Float32 Sobel gradient of gray along the rows.
+/// \param intrinsics Camera intrinsic matrices of shape {k, 3, 3}.
+/// \param extrinsics World to camera transformations of shape {k, 4, 4}.
+/// \param image_boundary_margin Pairs that project closer than this to the
+/// image border are skipped.
+/// \param systems Output Float32 tensor of shape {k, kColorMapSystemSize}.
+void ComputeRigidSystems(const core::Tensor& vertices,
+                         const core::Tensor& pair_vertices,
+                         const core::Tensor& image_offsets,
+                         const core::Tensor& proxy_intensity,
+                         const core::Tensor& gray,
+                         const core::Tensor& gray_dx,
+                         const core::Tensor& gray_dy,
+                         const core::Tensor& intrinsics,
+                         const core::Tensor& extrinsics,
+                         int image_boundary_margin,
+                         core::Tensor& systems);
+
+void ComputeRigidSystemsCPU(const core::Tensor& vertices,
+                            const core::Tensor& pair_vertices,
+                            const core::Tensor& image_offsets,
+                            const core::Tensor& proxy_intensity,
+                            const core::Tensor& gray,
+                            const core::Tensor& gray_dx,
+                            const core::Tensor& gray_dy,
+                            const core::Tensor& cameras,
+                            int image_boundary_margin,
+                            core::Tensor& systems);
+
+#ifdef BUILD_CUDA_MODULE
+void ComputeRigidSystemsCUDA(const core::Tensor& vertices,
+                             const core::Tensor& pair_vertices,
+                             const core::Tensor& image_offsets,
+                             const core::Tensor& proxy_intensity,
+                             const core::Tensor& gray,
+                             const core::Tensor& gray_dx,
+                             const core::Tensor& gray_dy,
+                             const core::Tensor& cameras,
+                             int image_boundary_margin,
+                             core::Tensor& systems);
+#endif
+
+}  // namespace color_map
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
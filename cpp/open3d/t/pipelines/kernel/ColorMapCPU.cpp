@@ -0,0 +1,79 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/CPULauncher.h"
+#include "open3d/t/pipelines/kernel/ColorMapImpl.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+namespace color_map {
+
+void ComputeRigidSystemsCPU(const core::Tensor& vertices,
+                            const core::Tensor& pair_vertices,
+                            const core::Tensor& image_offsets,
+                            const core::Tensor& proxy_intensity,
+                            const core::Tensor& gray,
+                            const core::Tensor& gray_dx,
+                            const core::Tensor& gray_dy,
+                            const core::Tensor& cameras,
+                            int image_boundary_margin,
+                            core::Tensor& systems) {
+    RigidSystemArgs args = MakeRigidSystemArgs(
+            vertices, pair_vertices, proxy_intensity, gray, gray_dx, gray_dy,
+            cameras, image_boundary_margin);
+    const int64_t* offsets_ptr =
+            static_cast<const int64_t*>(image_offsets.GetDataPtr());
+    float* systems_ptr = static_cast<float*>(systems.GetDataPtr());
+
+    // The images have different numbers of pairs, and each one is summed in
+    // double by a single thread.
+    int64_t k = systems.GetLength();
+#pragma omp parallel for schedule(dynamic) num_threads(utility::EstimateMaxThreads())
+    for (int64_t image_idx = 0; image_idx < k; ++image_idx) {
+        double A[kColorMapSystemSize] = {0};
+        for (int64_t pair_idx = offsets_ptr[image_idx];
+             pair_idx < offsets_ptr[image_idx + 1]; ++pair_idx) {
+            AccumulateRigidPair(pair_idx, image_idx, args, A);
+        }
+        for (int64_t i = 0; i < kColorMapSystemSize; ++i) {
+            systems_ptr[kColorMapSystemSize * image_idx + i] =
+                    static_cast<float>(A[i]);
+        }
+    }
+}
+
+}  // namespace color_map
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
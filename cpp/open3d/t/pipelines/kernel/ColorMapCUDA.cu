@@ -0,0 +1,142 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include <vector>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/CUDALauncher.cuh"
+#include "open3d/t/pipelines/kernel/ColorMapImpl.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+namespace color_map {
+
+namespace {
+
+constexpr int kBlockSize = 256;
+constexpr int kWarpSize = 32;
+
+__device__ inline float WarpReduceSum(float value) {
+#pragma unroll
+    for (int offset = kWarpSize / 2; offset > 0; offset /= 2) {
+        value += __shfl_down_sync(0xffffffff, value, offset);
+    }
+    return value;
+}
+
+// One thread per pair. Each block only has pairs of a single image, given by
+// the blocks table as (image, first pair, end of the pairs of the image), so
+// the systems of its threads are summed by warp shuffles and in shared
+// memory before a single addition to the system of the image.
+__global__ void ComputeRigidSystemsKernel(RigidSystemArgs args,
+                                          const int64_t* blocks,
+                                          float* systems) {
+    float A[kColorMapSystemSize];
+#pragma unroll
+    for (int k = 0; k < kColorMapSystemSize; ++k) {
+        A[k] = 0;
+    }
+
+    const int64_t* block = blocks + 3 * blockIdx.x;
+    int64_t image_idx = block[0];
+    int64_t pair_idx = block[1] + threadIdx.x;
+    if (pair_idx < block[2]) {
+        AccumulateRigidPair(pair_idx, image_idx, args, A);
+    }
+
+    __shared__ float warp_sums[kColorMapSystemSize][kBlockSize / kWarpSize];
+    int lane = threadIdx.x % kWarpSize;
+    int warp = threadIdx.x / kWarpSize;
+#pragma unroll
+    for (int k = 0; k < kColorMapSystemSize; ++k) {
+        float value = WarpReduceSum(A[k]);
+        if (lane == 0) {
+            warp_sums[k][warp] = value;
+        }
+    }
+    __syncthreads();
+
+    if (warp == 0) {
+        float* system = systems + kColorMapSystemSize * image_idx;
+        for (int k = 0; k < kColorMapSystemSize; ++k) {
+            float value =
+                    lane < kBlockSize / kWarpSize ? warp_sums[k][lane] : 0.0f;
+            value = WarpReduceSum(value);
+            if (lane == 0) {
+                atomicAdd(&system[k], value);
+            }
+        }
+    }
+}
+
+}  // namespace
+
+void ComputeRigidSystemsCUDA(const core::Tensor& vertices,
+                             const core::Tensor& pair_vertices,
+                             const core::Tensor& image_offsets,
+                             const core::Tensor& proxy_intensity,
+                             const core::Tensor& gray,
+                             const core::Tensor& gray_dx,
+                             const core::Tensor& gray_dy,
+                             const core::Tensor& cameras,
+                             int image_boundary_margin,
+                             core::Tensor& systems) {
+    RigidSystemArgs args = MakeRigidSystemArgs(
+            vertices, pair_vertices, proxy_intensity, gray, gray_dx, gray_dy,
+            cameras, image_boundary_margin);
+
+    std::vector<int64_t> offsets = image_offsets.Copy(core::Device("CPU:0"))
+                                           .ToFlatVector<int64_t>();
+    std::vector<int64_t> blocks;
+    for (size_t image_idx = 0; image_idx + 1 < offsets.size(); ++image_idx) {
+        for (int64_t begin = offsets[image_idx];
+             begin < offsets[image_idx + 1]; begin += kBlockSize) {
+            blocks.insert(blocks.end(), {int64_t(image_idx), begin,
+                                         offsets[image_idx + 1]});
+        }
+    }
+    int64_t num_blocks = int64_t(blocks.size()) / 3;
+    if (num_blocks == 0) {
+        return;
+    }
+    core::Tensor blocks_tensor(blocks, {num_blocks, 3}, core::Dtype::Int64,
+                               vertices.GetDevice());
+    ComputeRigidSystemsKernel<<<num_blocks, kBlockSize, 0,
+                                core::GetCUDACurrentStream()>>>(
+            args, static_cast<const int64_t*>(blocks_tensor.GetDataPtr()),
+            static_cast<float*>(systems.GetDataPtr()));
+    OPEN3D_CUDA_CHECK(cudaGetLastError());
+}
+
+}  // namespace color_map
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,335 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+// Private header. Do not include in Open3d.h.
+
+#include <cmath>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/pipelines/kernel/ColorMap.h"
+#include "open3d/t/pipelines/kernel/LinearSystemImpl.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+namespace color_map {
+
+/// Transforms the vertex X to the frame of a camera packed as fx, fy, cx,
+/// cy, the row-major rotation and the translation, and projects it to the
+/// pixel coordinates (u, v).
+OPEN3D_HOST_DEVICE inline void ProjectVertex(
+        const float* camera, const float* X, float* g, float& u, float& v) {
+    for (int i = 0; i < 3; ++i) {
+        g[i] = camera[4 + 3 * i] * X[0] + camera[5 + 3 * i] * X[1] +
+               camera[6 + 3 * i] * X[2] + camera[13 + i];
+    }
+    u = g[0] * camera[0] / g[2] + camera[2];
+    v = g[1] * camera[1] / g[2] + camera[3];
+}
+
+/// Whether (u, v) is at least margin inside the image, as the legacy
+/// Image::TestImageBoundary.
+OPEN3D_HOST_DEVICE inline bool IsInsideImage(
+        float u, float v, int64_t rows, int64_t cols, float margin) {
+    return u >= margin && u < cols - margin && v >= margin &&
+           v < rows - margin;
+}
+
+/// Bilinear interpolation of a single channel image, as the legacy
+/// Image::FloatValueAt, which is zero outside of the pixel centers.
+OPEN3D_HOST_DEVICE inline float InterpolateAt(
+        const float* image, int64_t rows, int64_t cols, float u, float v) {
+    if (!(u >= 0 && u <= cols - 1 && v >= 0 && v <= rows - 1)) {
+        return 0.0f;
+    }
+    int64_t ui = static_cast<int64_t>(u);
+    int64_t vi = static_cast<int64_t>(v);
+    ui = ui > cols - 2 ? cols - 2 : ui;
+    vi = vi > rows - 2 ? rows - 2 : vi;
+    ui = ui < 0 ? 0 : ui;
+    vi = vi < 0 ? 0 : vi;
+    float pu = u - ui;
+    float pv = v - vi;
+    const float* p = image + vi * cols + ui;
+    return (p[0] * (1 - pv) + p[cols] * pv) * (1 - pu) +
+           (p[1] * (1 - pv) + p[cols + 1] * pv) * pu;
+}
+
+/// Raw inputs of ComputeRigidSystems, passed by value to the kernels.
+struct RigidSystemArgs {
+    const float* vertices;
+    const int64_t* pair_vertices;
+    const float* proxy_intensity;
+    const float* gray;
+    const float* gray_dx;
+    const float* gray_dy;
+    const float* cameras;
+    int64_t rows;
+    int64_t cols;
+    float margin;
+};
+
+inline RigidSystemArgs MakeRigidSystemArgs(const core::Tensor& vertices,
+                                           const core::Tensor& pair_vertices,
+                                           const core::Tensor& proxy_intensity,
+                                           const core::Tensor& gray,
+                                           const core::Tensor& gray_dx,
+                                           const core::Tensor& gray_dy,
+                                           const core::Tensor& cameras,
+                                           int image_boundary_margin) {
+    RigidSystemArgs args;
+    args.vertices = static_cast<const float*>(vertices.GetDataPtr());
+    args.pair_vertices =
+            static_cast<const int64_t*>(pair_vertices.GetDataPtr());
+    args.proxy_intensity =
+            static_cast<const float*>(proxy_intensity.GetDataPtr());
+    args.gray = static_cast<const float*>(gray.GetDataPtr());
+    args.gray_dx = static_cast<const float*>(gray_dx.GetDataPtr());
+    args.gray_dy = static_cast<const float*>(gray_dy.GetDataPtr());
+    args.cameras = static_cast<const float*>(cameras.GetDataPtr());
+    args.rows = gray.GetShape(1);
+    args.cols = gray.GetShape(2);
+    args.margin = static_cast<float>(image_boundary_margin);
+    return args;
+}
+
+/// Adds the residual of the pair pair_idx of the image image_idx to the
+/// system A of size kColorMapSystemSize.
+///
+/// With g the vertex in the camera frame and (dI/du, dI/dv) the image
+/// gradient, the residual moves along the camera frame gradient
+/// (fx dI/du, fy dI/dv, -(fx dI/du g_x + fy dI/dv g_y) / g_z) / g_z, and its
+/// Jacobian with respect to xi = (omega, v) is (g x gradient, gradient).
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE inline void AccumulateRigidPair(int64_t pair_idx,
+                                                   int64_t image_idx,
+                                                   const RigidSystemArgs& args,
+                                                   scalar_t* A) {
+    int64_t vid = args.pair_vertices[pair_idx];
+    const float* camera = args.cameras + 16 * image_idx;
+    float g[3], u, v;
+    ProjectVertex(camera, args.vertices + 3 * vid, g, u, v);
+    if (!IsInsideImage(u, v, args.rows, args.cols, args.margin)) return;
+
+    int64_t offset = image_idx * args.rows * args.cols;
+    float gray = InterpolateAt(args.gray + offset, args.rows, args.cols, u, v);
+    float dIdu =
+            InterpolateAt(args.gray_dx + offset, args.rows, args.cols, u, v);
+    float dIdv =
+            InterpolateAt(args.gray_dy + offset, args.rows, args.cols, u, v);
+    float inv_z = 1.0f / g[2];
+    float grad[3];
+    grad[0] = dIdu * camera[0] * inv_z;
+    grad[1] = dIdv * camera[1] * inv_z;
+    grad[2] = -(grad[0] * g[0] + grad[1] * g[1]) * inv_z;
+    float J[6];
+    J[0] = g[1] * grad[2] - g[2] * grad[1];
+    J[1] = g[2] * grad[0] - g[0] * grad[2];
+    J[2] = g[0] * grad[1] - g[1] * grad[0];
+    J[3] = grad[0];
+    J[4] = grad[1];
+    J[5] = grad[2];
+    AccumulateResidual(A, J, gray - args.proxy_intensity[vid], 1.0f);
+    A[28] += 1;
+}
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void ComputeVisibilityCUDA
+#else
+void ComputeVisibilityCPU
+#endif
+        (const core::Tensor& vertices,
+         const core::Tensor& depth,
+         const core::Tensor& mask,
+         const core::Tensor& cameras,
+         float maximum_allowable_depth,
+         float depth_threshold,
+         core::Tensor& visible) {
+    int64_t rows = depth.GetShape(0);
+    int64_t cols = depth.GetShape(1);
+    const float* vertices_ptr =
+            static_cast<const float*>(vertices.GetDataPtr());
+    const float* depth_ptr = static_cast<const float*>(depth.GetDataPtr());
+    const uint8_t* mask_ptr = static_cast<const uint8_t*>(mask.GetDataPtr());
+    const float* camera = static_cast<const float*>(cameras.GetDataPtr());
+    bool* visible_ptr = static_cast<bool*>(visible.GetDataPtr());
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+    core::kernel::CUDALauncher::LaunchGeneralKernel(
+            vertices.GetLength(), [=] OPEN3D_DEVICE(int64_t workload_idx) {
+#else
+    core::kernel::CPULauncher::LaunchGeneralKernel(
+            vertices.GetLength(), [&](int64_t workload_idx) {
+#endif
+                visible_ptr[workload_idx] = false;
+                float g[3], u, v;
+                ProjectVertex(camera, vertices_ptr + 3 * workload_idx, g, u,
+                              v);
+                if (!(g[2] > 0.0f)) return;
+                float u_round = roundf(u);
+                float v_round = roundf(v);
+                if (!IsInsideImage(u_round, v_round, rows, cols, 0.0f)) {
+                    return;
+                }
+                int64_t pixel = static_cast<int64_t>(v_round) * cols +
+                                static_cast<int64_t>(u_round);
+                // Skip the background, the depth boundaries, where the
+                // color changes with the viewing angle, and the occluded
+                // vertices.
+                float d_sensor = depth_ptr[pixel];
+                if (d_sensor > maximum_allowable_depth) return;
+                if (mask_ptr[pixel] == 255) return;
+                if (fabsf(g[2] - d_sensor) >= depth_threshold) return;
+                visible_ptr[workload_idx] = true;
+            });
+}
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void SampleImagesCUDA
+#else
+void SampleImagesCPU
+#endif
+        (const core::Tensor& vertices,
+         const core::Tensor& pair_vertices,
+         const core::Tensor& pair_images,
+         const core::Tensor& images,
+         const core::Tensor& cameras,
+         int image_boundary_margin,
+         core::Tensor& values,
+         core::Tensor& valid) {
+    int64_t rows = images.GetShape(1);
+    int64_t cols = images.GetShape(2);
+    int64_t channels = images.GetShape(3);
+    float margin = static_cast<float>(image_boundary_margin);
+    const float* vertices_ptr =
+            static_cast<const float*>(vertices.GetDataPtr());
+    const int64_t* pair_vertices_ptr =
+            static_cast<const int64_t*>(pair_vertices.GetDataPtr());
+    const int64_t* pair_images_ptr =
+            static_cast<const int64_t*>(pair_images.GetDataPtr());
+    const float* cameras_ptr = static_cast<const float*>(cameras.GetDataPtr());
+    float* values_ptr = static_cast<float*>(values.GetDataPtr());
+    bool* valid_ptr = static_cast<bool*>(valid.GetDataPtr());
+
+    DISPATCH_DTYPE_TO_TEMPLATE(images.GetDtype(), [&]() {
+        const scalar_t* images_ptr =
+                static_cast<const scalar_t*>(images.GetDataPtr());
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+        core::kernel::CUDALauncher::LaunchGeneralKernel(
+                pair_vertices.GetLength(),
+                [=] OPEN3D_DEVICE(int64_t workload_idx) {
+#else
+        core::kernel::CPULauncher::LaunchGeneralKernel(
+                pair_vertices.GetLength(), [&](int64_t workload_idx) {
+#endif
+                    int64_t image_idx = pair_images_ptr[workload_idx];
+                    float* value = values_ptr + channels * workload_idx;
+                    float g[3], u, v;
+                    ProjectVertex(cameras_ptr + 16 * image_idx,
+                                  vertices_ptr +
+                                          3 * pair_vertices_ptr[workload_idx],
+                                  g, u, v);
+                    valid_ptr[workload_idx] =
+                            IsInsideImage(u, v, rows, cols, margin);
+                    if (!valid_ptr[workload_idx]) {
+                        for (int64_t ch = 0; ch < channels; ++ch) {
+                            value[ch] = 0.0f;
+                        }
+                        return;
+                    }
+                    const scalar_t* pixel =
+                            images_ptr +
+                            ((image_idx * rows + static_cast<int64_t>(v)) *
+                                     cols +
+                             static_cast<int64_t>(u)) *
+                                    channels;
+                    for (int64_t ch = 0; ch < channels; ++ch) {
+                        value[ch] = static_cast<float>(pixel[ch]);
+                    }
+                });
+    });
+}
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void AverageOverVerticesCUDA
+#else
+void AverageOverVerticesCPU
+#endif
+        (const core::Tensor& values,
+         const core::Tensor& valid,
+         const core::Tensor& offsets,
+         const core::Tensor& order,
+         core::Tensor& averages,
+         core::Tensor& counts) {
+    int64_t channels = values.GetShape(1);
+    const float* values_ptr = static_cast<const float*>(values.GetDataPtr());
+    const bool* valid_ptr = static_cast<const bool*>(valid.GetDataPtr());
+    const int64_t* offsets_ptr =
+            static_cast<const int64_t*>(offsets.GetDataPtr());
+    const int64_t* order_ptr = static_cast<const int64_t*>(order.GetDataPtr());
+    float* averages_ptr = static_cast<float*>(averages.GetDataPtr());
+    int64_t* counts_ptr = static_cast<int64_t*>(counts.GetDataPtr());
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+    core::kernel::CUDALauncher::LaunchGeneralKernel(
+            counts.GetLength(), [=] OPEN3D_DEVICE(int64_t workload_idx) {
+#else
+    core::kernel::CPULauncher::LaunchGeneralKernel(
+            counts.GetLength(), [&](int64_t workload_idx) {
+#endif
+                float* average = averages_ptr + channels * workload_idx;
+                for (int64_t ch = 0; ch < channels; ++ch) {
+                    average[ch] = 0.0f;
+                }
+                int64_t count = 0;
+                for (int64_t i = offsets_ptr[workload_idx];
+                     i < offsets_ptr[workload_idx + 1]; ++i) {
+                    int64_t pair = order_ptr[i];
+                    if (!valid_ptr[pair]) continue;
+                    for (int64_t ch = 0; ch < channels; ++ch) {
+                        average[ch] += values_ptr[channels * pair + ch];
+                    }
+                    ++count;
+                }
+                if (count > 0) {
+                    for (int64_t ch = 0; ch < channels; ++ch) {
+                        average[ch] /= count;
+                    }
+                }
+                counts_ptr[workload_idx] = count;
+            });
+}
+
+}  // namespace color_map
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,143 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/t/pipelines/kernel/Feature.h"
+
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+namespace registration {
+
+void ComputeFPFHFeature(const core::Tensor& points,
+                        const core::Tensor& normals,
+                        const core::Tensor& neighbor_indices,
+                        const core::Tensor& neighbor_distances,
+                        double max_distance2,
+                        core::Tensor& fpfh) {
+    core::Device device = points.GetDevice();
+    core::Dtype dtype = points.GetDtype();
+    if (dtype != core::Dtype::Float32 && dtype != core::Dtype::Float64) {
+        utility::LogError(
+                "[ComputeFPFHFeature] Points must be Float32 or Float64, but "
+                "got {}.",
+                dtype.ToString());
+    }
+    normals.AssertShape(points.GetShape());
+    normals.AssertDtype(dtype);
+    normals.AssertDevice(device);
+    neighbor_indices.AssertDtype(core::Dtype::Int64);
+    neighbor_indices.AssertDevice(device);
+    neighbor_distances.AssertShape(neighbor_indices.GetShape());
+    neighbor_distances.AssertDtype(dtype);
+    neighbor_distances.AssertDevice(device);
+
+    int64_t n = points.GetLength();
+    core::Tensor spfh = core::Tensor::Zeros({n, kFPFHDimension}, dtype, device);
+    fpfh = core::Tensor::Zeros({n, kFPFHDimension}, dtype, device);
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeFPFHFeatureCPU(points, normals, neighbor_indices,
+                              neighbor_distances, max_distance2, spfh, fpfh);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        ComputeFPFHFeatureCUDA(points, normals, neighbor_indices,
+                               neighbor_distances, max_distance2, spfh, fpfh);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void KnnFromInnerProducts(const core::Tensor& inner_products,
+                          const core::Tensor& query_norms2,
+                          const core::Tensor& dataset_norms2,
+                          int64_t knn,
+                          core::Tensor& indices,
+                          core::Tensor& distances) {
+    core::Device device = inner_products.GetDevice();
+    core::Dtype dtype = inner_products.GetDtype();
+    if (dtype != core::Dtype::Float32 && dtype != core::Dtype::Float64) {
+        utility::LogError(
+                "[KnnFromInnerProducts] Inner products must be Float32 or "
+                "Float64, but got {}.",
+                dtype.ToString());
+    }
+    if (!inner_products.IsContiguous()) {
+        utility::LogError(
+                "[KnnFromInnerProducts] Inner products must be contiguous.");
+    }
+    int64_t num_queries = inner_products.GetShape(0);
+    int64_t num_dataset = inner_products.GetShape(1);
+    if (knn < 1 || knn > num_dataset) {
+        utility::LogError(
+                "[KnnFromInnerProducts] knn must be in [1, {}], but got {}.",
+                num_dataset, knn);
+    }
+    query_norms2.AssertShape({num_queries});
+    query_norms2.AssertDtype(dtype);
+    query_norms2.AssertDevice(device);
+    dataset_norms2.AssertShape({num_dataset});
+    dataset_norms2.AssertDtype(dtype);
+    dataset_norms2.AssertDevice(device);
+    indices.AssertShape({num_queries, knn});
+    indices.AssertDtype(core::Dtype::Int64);
+    indices.AssertDevice(device);
+    distances.AssertShape({num_queries, knn});
+    distances.AssertDtype(dtype);
+    distances.AssertDevice(device);
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        KnnFromInnerProductsCPU(inner_products, query_norms2.Contiguous(),
+                                dataset_norms2.Contiguous(), knn, indices,
+                                distances);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        KnnFromInnerProductsCUDA(inner_products, query_norms2.Contiguous(),
+                                 dataset_norms2.Contiguous(), knn, indices,
+                                 distances);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+
+}  // namespace registration
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
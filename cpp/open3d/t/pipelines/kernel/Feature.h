@@ -0,0 +1,118 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+namespace registration {
+
+/// Number of bins of the FPFH feature, 11 for each of its 3 angles.
+constexpr int64_t kFPFHDimension = 33;
+
+/// Computes the FPFH features of a point cloud from one neighbor search, shared
+/// by the SPFH pass and the weighting pass. The histograms match the legacy
+/// open3d::pipelines::registration::ComputeFPFHFeature.
+///
+/// \param points Float32 or Float64 points of shape {N, 3}.
+/// \param normals Normals of shape {N, 3}, with the dtype of the points.
+/// \param neighbor_indices Int64 indices of shape {N, max_nn} of the nearest
+/// neighbors of the points, sorted by distance, with -1 for missing ones. The
+/// first neighbor of a point is the point itself.
+/// \param neighbor_distances Squared distances of shape {N, max_nn}, with the
+/// dtype of the points.
+/// \param max_distance2 Maximum squared distance of the neighbors.
+/// \param fpfh Output features of shape {N, kFPFHDimension}, with the dtype of
+/// the points.
+void ComputeFPFHFeature(const core::Tensor& points,
+                        const core::Tensor& normals,
+                        const core::Tensor& neighbor_indices,
+                        const core::Tensor& neighbor_distances,
+                        double max_distance2,
+                        core::Tensor& fpfh);
+
+/// Selects the \p knn nearest dataset points of each query from the inner
+/// products of the queries and the dataset, as used by a tiled brute-force
+/// search where the inner products come from one matrix multiplication. The
+/// squared distance of a pair is |q|^2 + |d|^2 - 2 q . d, clamped at 0.
+///
+/// \param inner_products Float32 or Float64 inner products of shape {Q, M}.
+/// \param query_norms2 Squared norms of the queries of shape {Q}.
+/// \param dataset_norms2 Squared norms of the dataset points of shape {M}.
+/// \param knn Number of neighbors, at most M.
+/// \param indices Output Int64 indices of shape {Q, knn}, sorted by distance.
+/// It may be a view of a larger tensor, contiguous along its rows.
+/// \param distances Output squared distances of shape {Q, knn}, with the dtype
+/// of the inner products. It may be a view as \p indices.
+void KnnFromInnerProducts(const core::Tensor& inner_products,
+                          const core::Tensor& query_norms2,
+                          const core::Tensor& dataset_norms2,
+                          int64_t knn,
+                          core::Tensor& indices,
+                          core::Tensor& distances);
+
+void ComputeFPFHFeatureCPU(const core::Tensor& points,
+                           const core::Tensor& normals,
+                           const core::Tensor& neighbor_indices,
+                           const core::Tensor& neighbor_distances,
+                           double max_distance2,
+                           core::Tensor& spfh,
+                           core::Tensor& fpfh);
+
+void KnnFromInnerProductsCPU(const core::Tensor& inner_products,
+                             const core::Tensor& query_norms2,
+                             const core::Tensor& dataset_norms2,
+                             int64_t knn,
+                             core::Tensor& indices,
+                             core::Tensor& distances);
+
+#ifdef BUILD_CUDA_MODULE
+void ComputeFPFHFeatureCUDA(const core::Tensor& points,
+                            const core::Tensor& normals,
+                            const core::Tensor& neighbor_indices,
+                            const core::Tensor& neighbor_distances,
+                            double max_distance2,
+                            core::Tensor& spfh,
+                            core::Tensor& fpfh);
+
+void KnnFromInnerProductsCUDA(const core::Tensor& inner_products,
+                              const core::Tensor& query_norms2,
+                              const core::Tensor& dataset_norms2,
+                              int64_t knn,
+                              core::Tensor& indices,
+                              core::Tensor& distances);
+#endif
+
+}  // namespace registration
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,298 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+// Private header. Do not include in Open3d.h.
+
+#include <cmath>
+#include <limits>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/CoreUtil.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/pipelines/kernel/Feature.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+namespace registration {
+
+/// Computes the pair feature (alpha, phi, theta, distance) of the points p1
+/// and p2 with normals n1 and n2, returning false for degenerate pairs.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE inline bool ComputePairFeatures(const scalar_t* p1,
+                                                   const scalar_t* n1,
+                                                   const scalar_t* p2,
+                                                   const scalar_t* n2,
+                                                   scalar_t* feature) {
+    scalar_t dp2p1[3] = {p2[0] - p1[0], p2[1] - p1[1], p2[2] - p1[2]};
+    feature[3] = sqrt(dp2p1[0] * dp2p1[0] + dp2p1[1] * dp2p1[1] +
+                      dp2p1[2] * dp2p1[2]);
+    if (feature[3] == 0) {
+        return false;
+    }
+    scalar_t angle1 =
+            (n1[0] * dp2p1[0] + n1[1] * dp2p1[1] + n1[2] * dp2p1[2]) /
+            feature[3];
+    scalar_t angle2 =
+            (n2[0] * dp2p1[0] + n2[1] * dp2p1[1] + n2[2] * dp2p1[2]) /
+            feature[3];
+    // acos(|angle1|) > acos(|angle2|) in the legacy implementation.
+    const scalar_t* n1_copy = n1;
+    const scalar_t* n2_copy = n2;
+    if (fabs(angle1) < fabs(angle2)) {
+        n1_copy = n2;
+        n2_copy = n1;
+        for (int i = 0; i < 3; ++i) {
+            dp2p1[i] = -dp2p1[i];
+        }
+        feature[2] = -angle2;
+    } else {
+        feature[2] = angle1;
+    }
+    scalar_t v[3] = {dp2p1[1] * n1_copy[2] - dp2p1[2] * n1_copy[1],
+                     dp2p1[2] * n1_copy[0] - dp2p1[0] * n1_copy[2],
+                     dp2p1[0] * n1_copy[1] - dp2p1[1] * n1_copy[0]};
+    scalar_t v_norm = sqrt(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+    if (v_norm == 0) {
+        return false;
+    }
+    for (int i = 0; i < 3; ++i) {
+        v[i] /= v_norm;
+    }
+    scalar_t w[3] = {n1_copy[1] * v[2] - n1_copy[2] * v[1],
+                     n1_copy[2] * v[0] - n1_copy[0] * v[2],
+                     n1_copy[0] * v[1] - n1_copy[1] * v[0]};
+    feature[1] = v[0] * n2_copy[0] + v[1] * n2_copy[1] + v[2] * n2_copy[2];
+    feature[0] = atan2(w[0] * n2_copy[0] + w[1] * n2_copy[1] +
+                               w[2] * n2_copy[2],
+                       n1_copy[0] * n2_copy[0] + n1_copy[1] * n2_copy[1] +
+                               n1_copy[2] * n2_copy[2]);
+    return true;
+}
+
+/// Bin of value in [min_value, max_value] among 11 bins, clamped.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE inline int FPFHBin(scalar_t value,
+                                      scalar_t min_value,
+                                      scalar_t max_value) {
+    int bin = static_cast<int>(
+            floor(11 * (value - min_value) / (max_value - min_value)));
+    return bin < 0 ? 0 : (bin >= 11 ? 10 : bin);
+}
+
+/// Number of valid neighbors. Neighbors are sorted by distance, so the valid
+/// ones come first.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE inline int64_t CountNeighbors(
+        const int64_t* nb_indices,
+        const scalar_t* nb_distances,
+        int64_t max_nn,
+        scalar_t max_dist2) {
+    int64_t count = 0;
+    while (count < max_nn && nb_indices[count] >= 0 &&
+           nb_distances[count] <= max_dist2) {
+        count++;
+    }
+    return count;
+}
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void ComputeFPFHFeatureCUDA
+#else
+void ComputeFPFHFeatureCPU
+#endif
+        (const core::Tensor& points,
+         const core::Tensor& normals,
+         const core::Tensor& neighbor_indices,
+         const core::Tensor& neighbor_distances,
+         double max_distance2,
+         core::Tensor& spfh,
+         core::Tensor& fpfh) {
+    int64_t n = points.GetLength();
+    int64_t max_nn = neighbor_indices.GetShape(1);
+    const int64_t* indices_ptr =
+            static_cast<const int64_t*>(neighbor_indices.GetDataPtr());
+
+    DISPATCH_FLOAT32_FLOAT64_DTYPE(points.GetDtype(), [&]() {
+        const scalar_t* points_ptr =
+                static_cast<const scalar_t*>(points.GetDataPtr());
+        const scalar_t* normals_ptr =
+                static_cast<const scalar_t*>(normals.GetDataPtr());
+        const scalar_t* distances_ptr =
+                static_cast<const scalar_t*>(neighbor_distances.GetDataPtr());
+        scalar_t* spfh_ptr = static_cast<scalar_t*>(spfh.GetDataPtr());
+        scalar_t* fpfh_ptr = static_cast<scalar_t*>(fpfh.GetDataPtr());
+        scalar_t max_dist2 = max_distance2 < std::numeric_limits<double>::max()
+                                     ? static_cast<scalar_t>(max_distance2)
+                                     : std::numeric_limits<scalar_t>::max();
+
+        // SPFH pass. The first neighbor, the point itself, is skipped.
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+        core::kernel::CUDALauncher::LaunchGeneralKernel(
+                n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+#else
+        core::kernel::CPULauncher::LaunchGeneralKernel(
+                n, [&](int64_t workload_idx) {
+#endif
+                    const int64_t* nb_indices =
+                            indices_ptr + workload_idx * max_nn;
+                    int64_t count = CountNeighbors(
+                            nb_indices, distances_ptr + workload_idx * max_nn,
+                            max_nn, max_dist2);
+                    if (count <= 1) return;
+                    const scalar_t* p = points_ptr + 3 * workload_idx;
+                    const scalar_t* np = normals_ptr + 3 * workload_idx;
+                    scalar_t* hist = spfh_ptr + kFPFHDimension * workload_idx;
+                    scalar_t hist_incr = 100.0 / (count - 1);
+                    for (int64_t k = 1; k < count; ++k) {
+                        scalar_t pf[4] = {0, 0, 0, 0};
+                        ComputePairFeatures(p, np,
+                                            points_ptr + 3 * nb_indices[k],
+                                            normals_ptr + 3 * nb_indices[k],
+                                            pf);
+                        hist[FPFHBin<scalar_t>(pf[0], -M_PI, M_PI)] +=
+                                hist_incr;
+                        hist[11 + FPFHBin<scalar_t>(pf[1], -1, 1)] +=
+                                hist_incr;
+                        hist[22 + FPFHBin<scalar_t>(pf[2], -1, 1)] +=
+                                hist_incr;
+                    }
+                });
+
+        // FPFH pass, over the same neighbors.
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+        core::kernel::CUDALauncher::LaunchGeneralKernel(
+                n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+#else
+        core::kernel::CPULauncher::LaunchGeneralKernel(
+                n, [&](int64_t workload_idx) {
+#endif
+                    const int64_t* nb_indices =
+                            indices_ptr + workload_idx * max_nn;
+                    const scalar_t* nb_distances =
+                            distances_ptr + workload_idx * max_nn;
+                    int64_t count = CountNeighbors(nb_indices, nb_distances,
+                                                   max_nn, max_dist2);
+                    if (count <= 1) return;
+                    scalar_t* hist = fpfh_ptr + kFPFHDimension * workload_idx;
+                    scalar_t sum[3] = {0, 0, 0};
+                    for (int64_t k = 1; k < count; ++k) {
+                        scalar_t dist = nb_distances[k];
+                        if (dist == 0) continue;
+                        const scalar_t* nb_spfh =
+                                spfh_ptr + kFPFHDimension * nb_indices[k];
+                        for (int j = 0; j < kFPFHDimension; ++j) {
+                            scalar_t val = nb_spfh[j] / dist;
+                            sum[j / 11] += val;
+                            hist[j] += val;
+                        }
+                    }
+                    for (int j = 0; j < 3; ++j) {
+                        if (sum[j] != 0) sum[j] = 100.0 / sum[j];
+                    }
+                    const scalar_t* own_spfh =
+                            spfh_ptr + kFPFHDimension * workload_idx;
+                    for (int j = 0; j < kFPFHDimension; ++j) {
+                        hist[j] = hist[j] * sum[j / 11] + own_spfh[j];
+                    }
+                });
+    });
+}
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void KnnFromInnerProductsCUDA
+#else
+void KnnFromInnerProductsCPU
+#endif
+        (const core::Tensor& inner_products,
+         const core::Tensor& query_norms2,
+         const core::Tensor& dataset_norms2,
+         int64_t knn,
+         core::Tensor& indices,
+         core::Tensor& distances) {
+    int64_t num_queries = inner_products.GetShape(0);
+    int64_t num_dataset = inner_products.GetShape(1);
+    // The outputs may be views of rows of larger tensors.
+    int64_t out_stride = indices.GetStride(0);
+    int64_t* indices_ptr = static_cast<int64_t*>(indices.GetDataPtr());
+
+    DISPATCH_FLOAT32_FLOAT64_DTYPE(inner_products.GetDtype(), [&]() {
+        const scalar_t* products_ptr =
+                static_cast<const scalar_t*>(inner_products.GetDataPtr());
+        const scalar_t* query_norms_ptr =
+                static_cast<const scalar_t*>(query_norms2.GetDataPtr());
+        const scalar_t* dataset_norms_ptr =
+                static_cast<const scalar_t*>(dataset_norms2.GetDataPtr());
+        scalar_t* distances_ptr =
+                static_cast<scalar_t*>(distances.GetDataPtr());
+        int64_t distances_stride = distances.GetStride(0);
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+        core::kernel::CUDALauncher::LaunchGeneralKernel(
+                num_queries, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+#else
+        core::kernel::CPULauncher::LaunchGeneralKernel(
+                num_queries, [&](int64_t workload_idx) {
+#endif
+                    const scalar_t* products =
+                            products_ptr + workload_idx * num_dataset;
+                    int64_t* nb_indices =
+                            indices_ptr + workload_idx * out_stride;
+                    scalar_t* nb_distances =
+                            distances_ptr + workload_idx * distances_stride;
+                    scalar_t query_norm2 = query_norms_ptr[workload_idx];
+
+                    // Insertion into the sorted list of the first count
+                    // neighbors, kept in the outputs.
+                    int64_t count = 0;
+                    for (int64_t j = 0; j < num_dataset; ++j) {
+                        scalar_t dist = query_norm2 + dataset_norms_ptr[j] -
+                                        2 * products[j];
+                        dist = dist < 0 ? 0 : dist;
+                        if (count == knn && dist >= nb_distances[knn - 1]) {
+                            continue;
+                        }
+                        int64_t k = count < knn ? count++ : knn - 1;
+                        while (k > 0 && nb_distances[k - 1] > dist) {
+                            nb_distances[k] = nb_distances[k - 1];
+                            nb_indices[k] = nb_indices[k - 1];
+                            k--;
+                        }
+                        nb_distances[k] = dist;
+                        nb_indices[k] = j;
+                    }
+                });
+    });
+}
+
+
+}  // namespace registration
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,181 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/t/pipelines/kernel/GlobalRegistration.h"
+
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+namespace registration {
+
+static void AssertCorrespondenceInputs(const core::Tensor& source_points,
+                                       const core::Tensor& target_points,
+                                       const core::Tensor& source_indices,
+                                       const core::Tensor& target_indices) {
+    core::Device device = source_points.GetDevice();
+    source_points.AssertDtype(core::Dtype::Float32);
+    target_points.AssertDtype(core::Dtype::Float32);
+    target_points.AssertDevice(device);
+    source_indices.AssertDtype(core::Dtype::Int64);
+    source_indices.AssertDevice(device);
+    target_indices.AssertShape(source_indices.GetShape());
+    target_indices.AssertDtype(core::Dtype::Int64);
+    target_indices.AssertDevice(device);
+}
+
+void EstimateRANSACHypotheses(const core::Tensor& source_points,
+                              const core::Tensor& target_points,
+                              const core::Tensor& source_indices,
+                              const core::Tensor& target_indices,
+                              const core::Tensor& samples,
+                              double edge_length_threshold,
+                              double max_distance2,
+                              core::Tensor& transformations,
+                              core::Tensor& valid) {
+    core::Device device = source_points.GetDevice();
+    AssertCorrespondenceInputs(source_points, target_points, source_indices,
+                               target_indices);
+    samples.AssertDtype(core::Dtype::Int64);
+    samples.AssertDevice(device);
+    if (samples.NumDims() != 2 || samples.GetShape(1) < 3) {
+        utility::LogError(
+                "Samples must have shape {{B, n}} with n >= 3, but got {}.",
+                samples.GetShape().ToString());
+    }
+
+    int64_t num_hypotheses = samples.GetLength();
+    transformations = core::Tensor::Empty({num_hypotheses, 4, 4},
+                                          core::Dtype::Float32, device);
+    valid = core::Tensor::Empty({num_hypotheses}, core::Dtype::Bool, device);
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        EstimateRANSACHypothesesCPU(source_points, target_points,
+                                    source_indices, target_indices, samples,
+                                    edge_length_threshold, max_distance2,
+                                    transformations, valid);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        EstimateRANSACHypothesesCUDA(source_points, target_points,
+                                     source_indices, target_indices, samples,
+                                     edge_length_threshold, max_distance2,
+                                     transformations, valid);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void EvaluateRANSACHypotheses(const core::Tensor& source_points,
+                              const core::Tensor& target_points,
+                              const core::Tensor& source_indices,
+                              const core::Tensor& target_indices,
+                              const core::Tensor& transformations,
+                              const core::Tensor& valid,
+                              double max_distance2,
+                              core::Tensor& inlier_counts,
+                              core::Tensor& inlier_errors) {
+    core::Device device = source_points.GetDevice();
+    AssertCorrespondenceInputs(source_points, target_points, source_indices,
+                               target_indices);
+    int64_t num_hypotheses = transformations.GetLength();
+    transformations.AssertShape({num_hypotheses, 4, 4});
+    transformations.AssertDtype(core::Dtype::Float32);
+    transformations.AssertDevice(device);
+    valid.AssertShape({num_hypotheses});
+    valid.AssertDtype(core::Dtype::Bool);
+    valid.AssertDevice(device);
+
+    inlier_counts =
+            core::Tensor::Zeros({num_hypotheses}, core::Dtype::Int64, device);
+    inlier_errors =
+            core::Tensor::Zeros({num_hypotheses}, core::Dtype::Float64, device);
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        EvaluateRANSACHypothesesCPU(source_points, target_points,
+                                    source_indices, target_indices,
+                                    transformations, valid, max_distance2,
+                                    inlier_counts, inlier_errors);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        EvaluateRANSACHypothesesCUDA(source_points, target_points,
+                                     source_indices, target_indices,
+                                     transformations, valid, max_distance2,
+                                     inlier_counts, inlier_errors);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void CheckFGRTuples(const core::Tensor& source_points,
+                    const core::Tensor& target_points,
+                    const core::Tensor& source_indices,
+                    const core::Tensor& target_indices,
+                    const core::Tensor& samples,
+                    double tuple_scale,
+                    core::Tensor& valid) {
+    core::Device device = source_points.GetDevice();
+    AssertCorrespondenceInputs(source_points, target_points, source_indices,
+                               target_indices);
+    samples.AssertDtype(core::Dtype::Int64);
+    samples.AssertDevice(device);
+    samples.AssertShapeCompatible({utility::nullopt, 3});
+
+    valid = core::Tensor::Empty({samples.GetLength()}, core::Dtype::Bool,
+                                device);
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        CheckFGRTuplesCPU(source_points, target_points, source_indices,
+                          target_indices, samples, tuple_scale, valid);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        CheckFGRTuplesCUDA(source_points, target_points, source_indices,
+                           target_indices, samples, tuple_scale, valid);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+
+}  // namespace registration
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,178 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+namespace registration {
+
+/// Estimates the rigid transformations of a batch of RANSAC hypotheses with
+/// the Kabsch algorithm, one thread per hypothesis.
+///
+/// A hypothesis is rejected if the edge lengths between its samples differ
+/// more than the threshold between the source and the target, as with the
+/// legacy CorrespondenceCheckerBasedOnEdgeLength, if its samples are
+/// degenerate, or if a sample is farther than the maximum correspondence
+/// distance after the transformation.
+///
+/// \param source_points Float32 source points of shape {N, 3}.
+/// \param target_points Float32 target points of shape {M, 3}.
+/// \param source_indices Int64 source indices of the correspondences, of
+/// shape {K}.
+/// \param target_indices Int64 target indices of the correspondences, of
+/// shape {K}.
+/// \param samples Int64 indices into the correspondences of shape {B, n}, with
+/// n >= 3 samples per hypothesis.
+/// \param edge_length_threshold Similarity threshold of the edge lengths in
+/// (0, 1), non-positive to disable the check.
+/// \param max_distance2 Squared maximum correspondence distance.
+/// \param transformations Output Float32 transformations of shape {B, 4, 4}.
+/// \param valid Output Bool tensor of shape {B}.
+void EstimateRANSACHypotheses(const core::Tensor& source_points,
+                              const core::Tensor& target_points,
+                              const core::Tensor& source_indices,
+                              const core::Tensor& target_indices,
+                              const core::Tensor& samples,
+                              double edge_length_threshold,
+                              double max_distance2,
+                              core::Tensor& transformations,
+                              core::Tensor& valid);
+
+/// Counts the inlier correspondences of each valid hypothesis, the
+/// correspondences whose transformed source point is within the maximum
+/// distance of the target point, and sums their squared distances.
+///
+/// \param source_points Float32 source points of shape {N, 3}.
+/// \param target_points Float32 target points of shape {M, 3}.
+/// \param source_indices Int64 source indices of the correspondences, of
+/// shape {K}.
+/// \param target_indices Int64 target indices of the correspondences, of
+/// shape {K}.
+/// \param transformations Float32 transformations of shape {B, 4, 4}.
+/// \param valid Bool tensor of shape {B}. Invalid hypotheses get no inliers.
+/// \param max_distance2 Squared maximum correspondence distance.
+/// \param inlier_counts Output Int64 tensor of shape {B}.
+/// \param inlier_errors Output Float64 tensor of shape {B}.
+void EvaluateRANSACHypotheses(const core::Tensor& source_points,
+                              const core::Tensor& target_points,
+                              const core::Tensor& source_indices,
+                              const core::Tensor& target_indices,
+                              const core::Tensor& transformations,
+                              const core::Tensor& valid,
+                              double max_distance2,
+                              core::Tensor& inlier_counts,
+                              core::Tensor& inlier_errors);
+
+/// Tests the tuples of Fast Global Registration, triples of correspondences
+/// whose edge lengths agree between the source and the target: each ratio of
+/// the edge lengths must be within (tuple_scale, 1 / tuple_scale).
+///
+/// \param source_points Float32 source points of shape {N, 3}.
+/// \param target_points Float32 target points of shape {M, 3}.
+/// \param source_indices Int64 source indices of the correspondences, of
+/// shape {K}.
+/// \param target_indices Int64 target indices of the correspondences, of
+/// shape {K}.
+/// \param samples Int64 indices into the correspondences of shape {B, 3}.
+/// \param tuple_scale Similarity of the edge lengths, in (0, 1).
+/// \param valid Output Bool tensor of shape {B}.
+void CheckFGRTuples(const core::Tensor& source_points,
+                    const core::Tensor& target_points,
+                    const core::Tensor& source_indices,
+                    const core::Tensor& target_indices,
+                    const core::Tensor& samples,
+                    double tuple_scale,
+                    core::Tensor& valid);
+
+void EstimateRANSACHypothesesCPU(const core::Tensor& source_points,
+                                 const core::Tensor& target_points,
+                                 const core::Tensor& source_indices,
+                                 const core::Tensor& target_indices,
+                                 const core::Tensor& samples,
+                                 double edge_length_threshold,
+                                 double max_distance2,
+                                 core::Tensor& transformations,
+                                 core::Tensor& valid);
+
+void EvaluateRANSACHypothesesCPU(const core::Tensor& source_points,
+                                 const core::Tensor& target_points,
+                                 const core::Tensor& source_indices,
+                                 const core::Tensor& target_indices,
+                                 const core::Tensor& transformations,
+                                 const core::Tensor& valid,
+                                 double max_distance2,
+                                 core::Tensor& inlier_counts,
+                                 core::Tensor& inlier_errors);
+
+void CheckFGRTuplesCPU(const core::Tensor& source_points,
+                       const core::Tensor& target_points,
+                       const core::Tensor& source_indices,
+                       const core::Tensor& target_indices,
+                       const core::Tensor& samples,
+                       double tuple_scale,
+                       core::Tensor& valid);
+
+#ifdef BUILD_CUDA_MODULE
+void EstimateRANSACHypothesesCUDA(const core::Tensor& source_points,
+                                  const core::Tensor& target_points,
+                                  const core::Tensor& source_indices,
+                                  const core::Tensor& target_indices,
+                                  const core::Tensor& samples,
+                                  double edge_length_threshold,
+                                  double max_distance2,
+                                  core::Tensor& transformations,
+                                  core::Tensor& valid);
+
+void EvaluateRANSACHypothesesCUDA(const core::Tensor& source_points,
+                                  const core::Tensor& target_points,
+                                  const core::Tensor& source_indices,
+                                  const core::Tensor& target_indices,
+                                  const core::Tensor& transformations,
+                                  const core::Tensor& valid,
+                                  double max_distance2,
+                                  core::Tensor& inlier_counts,
+                                  core::Tensor& inlier_errors);
+
+void CheckFGRTuplesCUDA(const core::Tensor& source_points,
+                        const core::Tensor& target_points,
+                        const core::Tensor& source_indices,
+                        const core::Tensor& target_indices,
+                        const core::Tensor& samples,
+                        double tuple_scale,
+                        core::Tensor& valid);
+#endif
+
+}  // namespace registration
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
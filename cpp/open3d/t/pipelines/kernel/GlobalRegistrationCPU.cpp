@@ -0,0 +1,83 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/CPULauncher.h"
+#include "open3d/t/pipelines/kernel/GlobalRegistrationImpl.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+namespace registration {
+
+void EvaluateRANSACHypothesesCPU(const core::Tensor& source_points,
+                                 const core::Tensor& target_points,
+                                 const core::Tensor& source_indices,
+                                 const core::Tensor& target_indices,
+                                 const core::Tensor& transformations,
+                                 const core::Tensor& valid,
+                                 double max_distance2,
+                                 core::Tensor& inlier_counts,
+                                 core::Tensor& inlier_errors) {
+    RANSACArgs args = MakeRANSACArgs(source_points, target_points,
+                                     source_indices, target_indices,
+                                     max_distance2);
+    int64_t num_hypotheses = transformations.GetLength();
+    const float* transformations_ptr =
+            static_cast<const float*>(transformations.GetDataPtr());
+    const bool* valid_ptr = static_cast<const bool*>(valid.GetDataPtr());
+    int64_t* counts_ptr = static_cast<int64_t*>(inlier_counts.GetDataPtr());
+    double* errors_ptr = static_cast<double*>(inlier_errors.GetDataPtr());
+
+    // One hypothesis per thread, so that each thread streams the
+    // correspondences without synchronization.
+#pragma omp parallel for schedule(dynamic) num_threads(utility::EstimateMaxThreads())
+    for (int64_t b = 0; b < num_hypotheses; ++b) {
+        if (!valid_ptr[b]) continue;
+        const float* T = transformations_ptr + 16 * b;
+        int64_t count = 0;
+        double error = 0;
+        for (int64_t c = 0; c < args.num_correspondences; ++c) {
+            float d2 = TransformedDistance2(T, SourcePoint(args, c),
+                                            TargetPoint(args, c));
+            if (d2 < args.max_distance2) {
+                count++;
+                error += d2;
+            }
+        }
+        counts_ptr[b] = count;
+        errors_ptr[b] = error;
+    }
+}
+
+}  // namespace registration
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
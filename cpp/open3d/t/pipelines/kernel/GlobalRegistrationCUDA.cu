@@ -0,0 +1,121 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/CUDALauncher.cuh"
+#include "open3d/t/pipelines/kernel/GlobalRegistrationImpl.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+namespace registration {
+
+namespace {
+
+constexpr int kBlockSize = 256;
+
+// One block per hypothesis. The threads of the block stride over the
+// correspondences and their inlier counts and errors are reduced in shared
+// memory.
+__global__ void EvaluateRANSACHypothesesKernel(RANSACArgs args,
+                                               const float* transformations,
+                                               const bool* valid,
+                                               int64_t* inlier_counts,
+                                               double* inlier_errors) {
+    int64_t b = blockIdx.x;
+    if (!valid[b]) return;
+
+    __shared__ float T[16];
+    if (threadIdx.x < 16) {
+        T[threadIdx.x] = transformations[16 * b + threadIdx.x];
+    }
+    __syncthreads();
+
+    int64_t count = 0;
+    float error = 0;
+    for (int64_t c = threadIdx.x; c < args.num_correspondences;
+         c += kBlockSize) {
+        float d2 = TransformedDistance2(T, SourcePoint(args, c),
+                                        TargetPoint(args, c));
+        if (d2 < args.max_distance2) {
+            count++;
+            error += d2;
+        }
+    }
+
+    __shared__ int64_t counts[kBlockSize];
+    __shared__ float errors[kBlockSize];
+    counts[threadIdx.x] = count;
+    errors[threadIdx.x] = error;
+    __syncthreads();
+    for (int offset = kBlockSize / 2; offset > 0; offset /= 2) {
+        if (threadIdx.x < offset) {
+            counts[threadIdx.x] += counts[threadIdx.x + offset];
+            errors[threadIdx.x] += errors[threadIdx.x + offset];
+        }
+        __syncthreads();
+    }
+    if (threadIdx.x == 0) {
+        inlier_counts[b] = counts[0];
+        inlier_errors[b] = errors[0];
+    }
+}
+
+}  // namespace
+
+void EvaluateRANSACHypothesesCUDA(const core::Tensor& source_points,
+                                  const core::Tensor& target_points,
+                                  const core::Tensor& source_indices,
+                                  const core::Tensor& target_indices,
+                                  const core::Tensor& transformations,
+                                  const core::Tensor& valid,
+                                  double max_distance2,
+                                  core::Tensor& inlier_counts,
+                                  core::Tensor& inlier_errors) {
+    RANSACArgs args = MakeRANSACArgs(source_points, target_points,
+                                     source_indices, target_indices,
+                                     max_distance2);
+    int64_t num_hypotheses = transformations.GetLength();
+    if (num_hypotheses == 0) {
+        return;
+    }
+    EvaluateRANSACHypothesesKernel<<<num_hypotheses, kBlockSize, 0,
+                                     core::GetCUDACurrentStream()>>>(
+            args, static_cast<const float*>(transformations.GetDataPtr()),
+            static_cast<const bool*>(valid.GetDataPtr()),
+            static_cast<int64_t*>(inlier_counts.GetDataPtr()),
+            static_cast<double*>(inlier_errors.GetDataPtr()));
+    OPEN3D_CUDA_CHECK(cudaGetLastError());
+}
+
+}  // namespace registration
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,325 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+// Private header. Do not include in Open3d.h.
+
+#include <cmath>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/linalg/SymmetricEigen3x3Shared.h"
+#include "open3d/t/pipelines/kernel/GlobalRegistration.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+namespace registration {
+
+/// Raw inputs of the RANSAC kernels, passed by value to the kernels.
+struct RANSACArgs {
+    const float* source_points;
+    const float* target_points;
+    const int64_t* source_indices;
+    const int64_t* target_indices;
+    int64_t num_correspondences;
+    float max_distance2;
+};
+
+inline RANSACArgs MakeRANSACArgs(const core::Tensor& source_points,
+                                 const core::Tensor& target_points,
+                                 const core::Tensor& source_indices,
+                                 const core::Tensor& target_indices,
+                                 double max_distance2) {
+    RANSACArgs args;
+    args.source_points = static_cast<const float*>(source_points.GetDataPtr());
+    args.target_points = static_cast<const float*>(target_points.GetDataPtr());
+    args.source_indices =
+            static_cast<const int64_t*>(source_indices.GetDataPtr());
+    args.target_indices =
+            static_cast<const int64_t*>(target_indices.GetDataPtr());
+    args.num_correspondences = source_indices.NumElements();
+    args.max_distance2 = static_cast<float>(max_distance2);
+    return args;
+}
+
+/// Source point of the correspondence c.
+OPEN3D_HOST_DEVICE inline const float* SourcePoint(const RANSACArgs& args,
+                                                   int64_t c) {
+    return args.source_points + 3 * args.source_indices[c];
+}
+
+/// Target point of the correspondence c.
+OPEN3D_HOST_DEVICE inline const float* TargetPoint(const RANSACArgs& args,
+                                                   int64_t c) {
+    return args.target_points + 3 * args.target_indices[c];
+}
+
+/// Squared distance between the target point and the source point transformed
+/// by the row-major 4x4 transformation T.
+OPEN3D_HOST_DEVICE inline float TransformedDistance2(const float* T,
+                                                     const float* s,
+                                                     const float* t) {
+    float d2 = 0;
+    for (int i = 0; i < 3; ++i) {
+        float d = T[i * 4 + 0] * s[0] + T[i * 4 + 1] * s[1] +
+                  T[i * 4 + 2] * s[2] + T[i * 4 + 3] - t[i];
+        d2 += d * d;
+    }
+    return d2;
+}
+
+/// Estimates the transformation T of the n correspondences sample, returning
+/// false for rejected samples.
+///
+/// The Kabsch rotation is sum_i v_i u_i^T over the singular vectors of the
+/// covariance H = sum (s - cs) (t - ct)^T. The right singular vectors v are the
+/// eigenvectors of H^T H and u = H v / |H v|. The third pair is completed by
+/// cross products, so that both bases are right-handed and the rotation needs
+/// no reflection fix. This also handles the rank 2 covariance of 3 samples.
+OPEN3D_HOST_DEVICE inline bool EstimateRANSACHypothesis(
+        const RANSACArgs& args,
+        const int64_t* sample,
+        int n,
+        float edge_length_threshold,
+        float* T) {
+    // Cheap edge length check before the estimation.
+    if (edge_length_threshold > 0) {
+        for (int i = 0; i < n; ++i) {
+            const float* si = SourcePoint(args, sample[i]);
+            const float* ti = TargetPoint(args, sample[i]);
+            for (int j = i + 1; j < n; ++j) {
+                const float* sj = SourcePoint(args, sample[j]);
+                const float* tj = TargetPoint(args, sample[j]);
+                float ds = 0, dt = 0;
+                for (int k = 0; k < 3; ++k) {
+                    ds += (si[k] - sj[k]) * (si[k] - sj[k]);
+                    dt += (ti[k] - tj[k]) * (ti[k] - tj[k]);
+                }
+                ds = sqrtf(ds);
+                dt = sqrtf(dt);
+                if (ds < edge_length_threshold * dt ||
+                    dt < edge_length_threshold * ds) {
+                    return false;
+                }
+            }
+        }
+    }
+
+    double cs[3] = {0, 0, 0}, ct[3] = {0, 0, 0};
+    for (int i = 0; i < n; ++i) {
+        const float* s = SourcePoint(args, sample[i]);
+        const float* t = TargetPoint(args, sample[i]);
+        for (int k = 0; k < 3; ++k) {
+            cs[k] += s[k];
+            ct[k] += t[k];
+        }
+    }
+    for (int k = 0; k < 3; ++k) {
+        cs[k] /= n;
+        ct[k] /= n;
+    }
+    double H[9] = {0, 0, 0, 0, 0, 0, 0, 0, 0};
+    for (int i = 0; i < n; ++i) {
+        const float* s = SourcePoint(args, sample[i]);
+        const float* t = TargetPoint(args, sample[i]);
+        for (int r = 0; r < 3; ++r) {
+            for (int c = 0; c < 3; ++c) {
+                H[r * 3 + c] += (s[r] - cs[r]) * (t[c] - ct[c]);
+            }
+        }
+    }
+    double HtH[9];
+    for (int r = 0; r < 3; ++r) {
+        for (int c = 0; c < 3; ++c) {
+            HtH[r * 3 + c] = H[0 * 3 + r] * H[0 * 3 + c] +
+                             H[1 * 3 + r] * H[1 * 3 + c] +
+                             H[2 * 3 + r] * H[2 * 3 + c];
+        }
+    }
+    double eigenvalues[3], eigenvectors[9];
+    core::SymmetricEigen3x3(HtH, eigenvalues, eigenvectors);
+
+    // Singular vectors of the two largest singular values.
+    double v[3][3], u[3][3];
+    for (int k = 0; k < 3; ++k) {
+        v[0][k] = eigenvectors[k * 3 + 2];
+        v[1][k] = eigenvectors[k * 3 + 1];
+    }
+    for (int a = 0; a < 2; ++a) {
+        for (int r = 0; r < 3; ++r) {
+            u[a][r] = H[r * 3 + 0] * v[a][0] + H[r * 3 + 1] * v[a][1] +
+                      H[r * 3 + 2] * v[a][2];
+        }
+    }
+    double norm0 = sqrt(core::eigen3x3::Dot3(u[0], u[0]));
+    if (!(norm0 > 1e-12)) {
+        return false;
+    }
+    for (int k = 0; k < 3; ++k) {
+        u[0][k] /= norm0;
+    }
+    double proj = core::eigen3x3::Dot3(u[1], u[0]);
+    for (int k = 0; k < 3; ++k) {
+        u[1][k] -= proj * u[0][k];
+    }
+    // Collinear samples leave the rotation about their line undetermined.
+    double norm1 = sqrt(core::eigen3x3::Dot3(u[1], u[1]));
+    if (!(norm1 > 1e-6 * norm0)) {
+        return false;
+    }
+    for (int k = 0; k < 3; ++k) {
+        u[1][k] /= norm1;
+    }
+    core::eigen3x3::Cross3(u[0], u[1], u[2]);
+    core::eigen3x3::Cross3(v[0], v[1], v[2]);
+
+    double R[9];
+    for (int r = 0; r < 3; ++r) {
+        for (int c = 0; c < 3; ++c) {
+            R[r * 3 + c] = v[0][r] * u[0][c] + v[1][r] * u[1][c] +
+                           v[2][r] * u[2][c];
+        }
+    }
+    for (int r = 0; r < 3; ++r) {
+        T[r * 4 + 0] = static_cast<float>(R[r * 3 + 0]);
+        T[r * 4 + 1] = static_cast<float>(R[r * 3 + 1]);
+        T[r * 4 + 2] = static_cast<float>(R[r * 3 + 2]);
+        T[r * 4 + 3] = static_cast<float>(
+                ct[r] - (R[r * 3 + 0] * cs[0] + R[r * 3 + 1] * cs[1] +
+                         R[r * 3 + 2] * cs[2]));
+    }
+    T[12] = 0;
+    T[13] = 0;
+    T[14] = 0;
+    T[15] = 1;
+
+    // The samples themselves must be inliers, as with the legacy
+    // CorrespondenceCheckerBasedOnDistance.
+    for (int i = 0; i < n; ++i) {
+        const float* s = SourcePoint(args, sample[i]);
+        const float* t = TargetPoint(args, sample[i]);
+        if (!(TransformedDistance2(T, s, t) < args.max_distance2)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void EstimateRANSACHypothesesCUDA
+#else
+void EstimateRANSACHypothesesCPU
+#endif
+        (const core::Tensor& source_points,
+         const core::Tensor& target_points,
+         const core::Tensor& source_indices,
+         const core::Tensor& target_indices,
+         const core::Tensor& samples,
+         double edge_length_threshold,
+         double max_distance2,
+         core::Tensor& transformations,
+         core::Tensor& valid) {
+    RANSACArgs args = MakeRANSACArgs(source_points, target_points,
+                                     source_indices, target_indices,
+                                     max_distance2);
+    int64_t num_hypotheses = samples.GetLength();
+    int n = static_cast<int>(samples.GetShape(1));
+    const int64_t* samples_ptr =
+            static_cast<const int64_t*>(samples.GetDataPtr());
+    float* transformations_ptr =
+            static_cast<float*>(transformations.GetDataPtr());
+    bool* valid_ptr = static_cast<bool*>(valid.GetDataPtr());
+    float threshold = static_cast<float>(edge_length_threshold);
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+    core::kernel::CUDALauncher::LaunchGeneralKernel(
+            num_hypotheses, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+#else
+    core::kernel::CPULauncher::LaunchGeneralKernel(
+            num_hypotheses, [&](int64_t workload_idx) {
+#endif
+                valid_ptr[workload_idx] = EstimateRANSACHypothesis(
+                        args, samples_ptr + n * workload_idx, n, threshold,
+                        transformations_ptr + 16 * workload_idx);
+            });
+}
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void CheckFGRTuplesCUDA
+#else
+void CheckFGRTuplesCPU
+#endif
+        (const core::Tensor& source_points,
+         const core::Tensor& target_points,
+         const core::Tensor& source_indices,
+         const core::Tensor& target_indices,
+         const core::Tensor& samples,
+         double tuple_scale,
+         core::Tensor& valid) {
+    RANSACArgs args = MakeRANSACArgs(source_points, target_points,
+                                     source_indices, target_indices, 0.0);
+    const int64_t* samples_ptr =
+            static_cast<const int64_t*>(samples.GetDataPtr());
+    bool* valid_ptr = static_cast<bool*>(valid.GetDataPtr());
+    float scale = static_cast<float>(tuple_scale);
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+    core::kernel::CUDALauncher::LaunchGeneralKernel(
+            samples.GetLength(), [=] OPEN3D_DEVICE(int64_t workload_idx) {
+#else
+    core::kernel::CPULauncher::LaunchGeneralKernel(
+            samples.GetLength(), [&](int64_t workload_idx) {
+#endif
+                const int64_t* sample = samples_ptr + 3 * workload_idx;
+                bool tuple_valid = true;
+                for (int i = 0; i < 3; ++i) {
+                    int j = (i + 1) % 3;
+                    const float* si = SourcePoint(args, sample[i]);
+                    const float* sj = SourcePoint(args, sample[j]);
+                    const float* ti = TargetPoint(args, sample[i]);
+                    const float* tj = TargetPoint(args, sample[j]);
+                    float ds = 0, dt = 0;
+                    for (int k = 0; k < 3; ++k) {
+                        ds += (si[k] - sj[k]) * (si[k] - sj[k]);
+                        dt += (ti[k] - tj[k]) * (ti[k] - tj[k]);
+                    }
+                    ds = sqrtf(ds);
+                    dt = sqrtf(dt);
+                    tuple_valid = tuple_valid && ds * scale < dt &&
+                                  dt < ds / scale;
+                }
+                valid_ptr[workload_idx] = tuple_valid;
+            });
+}
+
+
+}  // namespace registration
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
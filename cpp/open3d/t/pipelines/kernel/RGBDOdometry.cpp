@@ -0,0 +1,149 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/kernel/RGBDOdometry.h"
+
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+namespace odometry {
+
+void CreateVertexMap(const core::Tensor& depth_map,
+                     const core::Tensor& intrinsics,
+                     core::Tensor& vertex_map) {
+    depth_map.AssertDtype(core::Dtype::Float32);
+    core::Device device = depth_map.GetDevice();
+    vertex_map = core::Tensor({depth_map.GetShape(0), depth_map.GetShape(1), 3},
+                              core::Dtype::Float32, device);
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        CreateVertexMapCPU(depth_map, intrinsics, vertex_map);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        CreateVertexMapCUDA(depth_map, intrinsics, vertex_map);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void CreateNormalMap(const core::Tensor& vertex_map, core::Tensor& normal_map) {
+    vertex_map.AssertDtype(core::Dtype::Float32);
+    core::Device device = vertex_map.GetDevice();
+    normal_map = core::Tensor(vertex_map.GetShape(), core::Dtype::Float32,
+                              device);
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        CreateNormalMapCPU(vertex_map, normal_map);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        CreateNormalMapCUDA(vertex_map, normal_map);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void ComputeOdometrySystem(const core::Tensor& source_vertex_map,
+                           const core::Tensor& source_intensity,
+                           const core::Tensor& target_vertex_map,
+                           const core::Tensor& target_normal_map,
+                           const core::Tensor& target_intensity,
+                           const core::Tensor& target_intensity_dx,
+                           const core::Tensor& target_intensity_dy,
+                           const core::Tensor& intrinsics,
+                           const core::Tensor& source_to_target,
+                           core::Tensor& system,
+                           float depth_outlier_trunc,
+                           float depth_huber_delta,
+                           float intensity_huber_delta) {
+    core::Device device = source_vertex_map.GetDevice();
+    core::SizeVector vertex_shape = source_vertex_map.GetShape();
+    core::SizeVector intensity_shape{vertex_shape[0], vertex_shape[1], 1};
+    source_vertex_map.AssertDtype(core::Dtype::Float32);
+    target_vertex_map.AssertShape(vertex_shape);
+    target_vertex_map.AssertDtype(core::Dtype::Float32);
+    target_vertex_map.AssertDevice(device);
+
+    bool use_depth = target_normal_map.NumElements() != 0;
+    bool use_intensity = source_intensity.NumElements() != 0;
+    if (!use_depth && !use_intensity) {
+        utility::LogError(
+                "Either the target normal map or the intensities must be "
+                "given.");
+    }
+    if (use_depth) {
+        target_normal_map.AssertShape(vertex_shape);
+        target_normal_map.AssertDtype(core::Dtype::Float32);
+        target_normal_map.AssertDevice(device);
+    }
+    if (use_intensity) {
+        for (const core::Tensor* intensity :
+             {&source_intensity, &target_intensity, &target_intensity_dx,
+              &target_intensity_dy}) {
+            intensity->AssertShape(intensity_shape);
+            intensity->AssertDtype(core::Dtype::Float32);
+            intensity->AssertDevice(device);
+        }
+    }
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeOdometrySystemCPU(
+                source_vertex_map, source_intensity, target_vertex_map,
+                target_normal_map, target_intensity, target_intensity_dx,
+                target_intensity_dy, intrinsics, source_to_target, system,
+                depth_outlier_trunc, depth_huber_delta, intensity_huber_delta);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        ComputeOdometrySystemCUDA(
+                source_vertex_map, source_intensity, target_vertex_map,
+                target_normal_map, target_intensity, target_intensity_dx,
+                target_intensity_dy, intrinsics, source_to_target, system,
+                depth_outlier_trunc, depth_huber_delta, intensity_huber_delta);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+}  // namespace odometry
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,156 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+namespace odometry {
+
+/// Number of floats of the linear system accumulated by ComputeOdometrySystem:
+/// the 21 entries of the upper triangle of J^T W J in row-major order, the 6
+/// entries of J^T W r, the weighted sum of squared residuals and the number
+/// of inlier pixels.
+constexpr int64_t kOdometrySystemSize = 29;
+
+/// Unprojects a depth map to a vertex map in the camera frame.
+///
+/// \param depth_map Float32 depth map of shape {rows, cols, 1} in meters. The
+/// non-positive depths are invalid.
+/// \param intrinsics Camera intrinsic matrix of shape {3, 3}.
+/// \param vertex_map Output Float32 vertex map of shape {rows, cols, 3}. The
+/// invalid vertices are zero.
+void CreateVertexMap(const core::Tensor& depth_map,
+                     const core::Tensor& intrinsics,
+                     core::Tensor& vertex_map);
+
+void CreateVertexMapCPU(const core::Tensor& depth_map,
+                        const core::Tensor& intrinsics,
+                        core::Tensor& vertex_map);
+
+#ifdef BUILD_CUDA_MODULE
+void CreateVertexMapCUDA(const core::Tensor& depth_map,
+                         const core::Tensor& intrinsics,
+                         core::Tensor& vertex_map);
+#endif
+
+/// Computes the normal of each vertex from its right and bottom neighbors.
+///
+/// \param vertex_map Float32 vertex map of shape {rows, cols, 3}.
+/// \param normal_map Output Float32 unit normals of shape {rows, cols, 3}.
+/// The normals of the vertices with an invalid neighbor are zero.
+void CreateNormalMap(const core::Tensor& vertex_map, core::Tensor& normal_map);
+
+void CreateNormalMapCPU(const core::Tensor& vertex_map,
+                        core::Tensor& normal_map);
+
+#ifdef BUILD_CUDA_MODULE
+void CreateNormalMapCUDA(const core::Tensor& vertex_map,
+                         core::Tensor& normal_map);
+#endif
+
+/// Accumulates the Gauss-Newton system of one odometry iteration in a single
+/// pass over the source pixels.
+///
+/// Each valid source vertex is transformed by source_to_target and projected
+/// to the nearest target pixel. The point-to-plane residual is the distance
+/// to the tangent plane of the target vertex, and the intensity residual is
+/// the difference of the target and source intensities. Both use Huber
+/// weights, and correspondences farther than depth_outlier_trunc are skipped.
+///
+/// \param source_vertex_map Float32 {rows, cols, 3} source vertex map.
+/// \param source_intensity Float32 {rows, cols, 1} source intensity, or an
+/// empty tensor without intensity residual.
+/// \param target_vertex_map Float32 {rows, cols, 3} target vertex map.
+/// \param target_normal_map Float32 {rows, cols, 3} target normal map, or an
+/// empty tensor without point-to-plane residual.
+/// \param target_intensity Float32 {rows, cols, 1} target intensity, or an
+/// empty tensor without intensity residual.
+/// \param target_intensity_dx Float32 Sobel gradient of target_intensity
+/// along the columns.
+/// \param target_intensity_dy Float32 Sobel gradient of target_intensity
+/// along the rows.
+/// \param intrinsics Camera intrinsic matrix of shape {3, 3}.
+/// \param source_to_target Rigid transformation of shape {4, 4}.
+/// \param system Output Float32 tensor of shape {kOdometrySystemSize} on the
+/// device of the maps.
+/// \param depth_outlier_trunc Maximum point-to-plane or depth difference of a
+/// correspondence.
+/// \param depth_huber_delta Huber threshold of the point-to-plane residual.
+/// \param intensity_huber_delta Huber threshold of the intensity residual.
+void ComputeOdometrySystem(const core::Tensor& source_vertex_map,
+                           const core::Tensor& source_intensity,
+                           const core::Tensor& target_vertex_map,
+                           const core::Tensor& target_normal_map,
+                           const core::Tensor& target_intensity,
+                           const core::Tensor& target_intensity_dx,
+                           const core::Tensor& target_intensity_dy,
+                           const core::Tensor& intrinsics,
+                           const core::Tensor& source_to_target,
+                           core::Tensor& system,
+                           float depth_outlier_trunc,
+                           float depth_huber_delta,
+                           float intensity_huber_delta);
+
+void ComputeOdometrySystemCPU(const core::Tensor& source_vertex_map,
+                              const core::Tensor& source_intensity,
+                              const core::Tensor& target_vertex_map,
+                              const core::Tensor& target_normal_map,
+                              const core::Tensor& target_intensity,
+                              const core::Tensor& target_intensity_dx,
+                              const core::Tensor& target_intensity_dy,
+                              const core::Tensor& intrinsics,
+                              const core::Tensor& source_to_target,
+                              core::Tensor& system,
+                              float depth_outlier_trunc,
+                              float depth_huber_delta,
+                              float intensity_huber_delta);
+
+#ifdef BUILD_CUDA_MODULE
+void ComputeOdometrySystemCUDA(const core::Tensor& source_vertex_map,
+                               const core::Tensor& source_intensity,
+                               const core::Tensor& target_vertex_map,
+                               const core::Tensor& target_normal_map,
+                               const core::Tensor& target_intensity,
+                               const core::Tensor& target_intensity_dx,
+                               const core::Tensor& target_intensity_dy,
+                               const core::Tensor& intrinsics,
+                               const core::Tensor& source_to_target,
+                               core::Tensor& system,
+                               float depth_outlier_trunc,
+                               float depth_huber_delta,
+                               float intensity_huber_delta);
+#endif
+
+}  // namespace odometry
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
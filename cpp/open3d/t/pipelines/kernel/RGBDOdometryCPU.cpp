@@ -0,0 +1,86 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/CPULauncher.h"
+#include "open3d/t/pipelines/kernel/RGBDOdometryImpl.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+namespace odometry {
+
+void ComputeOdometrySystemCPU(const core::Tensor& source_vertex_map,
+                              const core::Tensor& source_intensity,
+                              const core::Tensor& target_vertex_map,
+                              const core::Tensor& target_normal_map,
+                              const core::Tensor& target_intensity,
+                              const core::Tensor& target_intensity_dx,
+                              const core::Tensor& target_intensity_dy,
+                              const core::Tensor& intrinsics,
+                              const core::Tensor& source_to_target,
+                              core::Tensor& system,
+                              float depth_outlier_trunc,
+                              float depth_huber_delta,
+                              float intensity_huber_delta) {
+    OdometrySystemArgs args = MakeOdometrySystemArgs(
+            source_vertex_map, source_intensity, target_vertex_map,
+            target_normal_map, target_intensity, target_intensity_dx,
+            target_intensity_dy, intrinsics, source_to_target,
+            depth_outlier_trunc, depth_huber_delta, intensity_huber_delta);
+
+    // Each thread accumulates its pixels in double before the reduction.
+    int64_t n = args.rows * args.cols;
+    std::vector<double> sum(kOdometrySystemSize, 0.0);
+#pragma omp parallel num_threads(utility::EstimateMaxThreads())
+    {
+        double A[kOdometrySystemSize] = {0};
+#pragma omp for schedule(static)
+        for (int64_t workload_idx = 0; workload_idx < n; ++workload_idx) {
+            AccumulateOdometryPixel(workload_idx, args, A);
+        }
+#pragma omp critical
+        {
+            for (int64_t k = 0; k < kOdometrySystemSize; ++k) {
+                sum[k] += A[k];
+            }
+        }
+    }
+
+    system = core::Tensor(std::vector<float>(sum.begin(), sum.end()),
+                          {kOdometrySystemSize}, core::Dtype::Float32,
+                          source_vertex_map.GetDevice());
+}
+
+}  // namespace odometry
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
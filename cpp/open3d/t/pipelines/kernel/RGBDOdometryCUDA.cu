@@ -0,0 +1,131 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/CUDALauncher.cuh"
+#include "open3d/t/pipelines/kernel/RGBDOdometryImpl.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+namespace odometry {
+
+namespace {
+
+constexpr int kBlockSize = 256;
+constexpr int kWarpSize = 32;
+
+__device__ inline float WarpReduceSum(float value) {
+#pragma unroll
+    for (int offset = kWarpSize / 2; offset > 0; offset /= 2) {
+        value += __shfl_down_sync(0xffffffff, value, offset);
+    }
+    return value;
+}
+
+// One thread per source pixel. The systems of the threads are summed by warp
+// shuffles, then across the warps of the block in shared memory, so each
+// block adds a single system to the output.
+__global__ void ComputeOdometrySystemKernel(OdometrySystemArgs args,
+                                            int64_t n,
+                                            float* system) {
+    float A[kOdometrySystemSize];
+#pragma unroll
+    for (int k = 0; k < kOdometrySystemSize; ++k) {
+        A[k] = 0;
+    }
+
+    int64_t workload_idx =
+            static_cast<int64_t>(blockIdx.x) * kBlockSize + threadIdx.x;
+    if (workload_idx < n) {
+        AccumulateOdometryPixel(workload_idx, args, A);
+    }
+
+    __shared__ float warp_sums[kOdometrySystemSize][kBlockSize / kWarpSize];
+    int lane = threadIdx.x % kWarpSize;
+    int warp = threadIdx.x / kWarpSize;
+#pragma unroll
+    for (int k = 0; k < kOdometrySystemSize; ++k) {
+        float value = WarpReduceSum(A[k]);
+        if (lane == 0) {
+            warp_sums[k][warp] = value;
+        }
+    }
+    __syncthreads();
+
+    if (warp == 0) {
+        for (int k = 0; k < kOdometrySystemSize; ++k) {
+            float value =
+                    lane < kBlockSize / kWarpSize ? warp_sums[k][lane] : 0.0f;
+            value = WarpReduceSum(value);
+            if (lane == 0) {
+                atomicAdd(&system[k], value);
+            }
+        }
+    }
+}
+
+}  // namespace
+
+void ComputeOdometrySystemCUDA(const core::Tensor& source_vertex_map,
+                               const core::Tensor& source_intensity,
+                               const core::Tensor& target_vertex_map,
+                               const core::Tensor& target_normal_map,
+                               const core::Tensor& target_intensity,
+                               const core::Tensor& target_intensity_dx,
+                               const core::Tensor& target_intensity_dy,
+                               const core::Tensor& intrinsics,
+                               const core::Tensor& source_to_target,
+                               core::Tensor& system,
+                               float depth_outlier_trunc,
+                               float depth_huber_delta,
+                               float intensity_huber_delta) {
+    OdometrySystemArgs args = MakeOdometrySystemArgs(
+            source_vertex_map, source_intensity, target_vertex_map,
+            target_normal_map, target_intensity, target_intensity_dx,
+            target_intensity_dy, intrinsics, source_to_target,
+            depth_outlier_trunc, depth_huber_delta, intensity_huber_delta);
+
+    system = core::Tensor::Zeros({kOdometrySystemSize}, core::Dtype::Float32,
+                                 source_vertex_map.GetDevice());
+    int64_t n = args.rows * args.cols;
+    if (n == 0) {
+        return;
+    }
+    int64_t grid_size = (n + kBlockSize - 1) / kBlockSize;
+    ComputeOdometrySystemKernel<<<grid_size, kBlockSize, 0,
+                                  core::GetCUDACurrentStream()>>>(
+            args, n, static_cast<float*>(system.GetDataPtr()));
+    OPEN3D_CUDA_CHECK(cudaGetLastError());
+}
+
+}  // namespace odometry
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
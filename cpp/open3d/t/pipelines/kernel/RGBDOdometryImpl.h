@@ -0,0 +1,326 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+// Private header. Do not include in Open3d.h.
+
+#include <cmath>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/pipelines/kernel/LinearSystemImpl.h"
+#include "open3d/t/pipelines/kernel/RGBDOdometry.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+namespace odometry {
+
+/// Weight of the point-to-plane residuals when combined with the intensity
+/// residuals, as in the legacy hybrid odometry.
+constexpr float kHybridDepthWeight = 0.968f;
+
+/// Normalization of the 3x3 Sobel gradients.
+constexpr float kSobelScale = 0.125f;
+
+/// Pinhole camera intrinsics, read on host.
+struct PinholeCamera {
+    float fx, fy, cx, cy;
+};
+
+inline PinholeCamera ReadPinholeCamera(const core::Tensor& intrinsics) {
+    intrinsics.AssertShape({3, 3});
+    core::Tensor K = intrinsics.To(core::Dtype::Float32)
+                             .Copy(core::Device("CPU:0"))
+                             .Contiguous();
+    const float* K_ptr = static_cast<const float*>(K.GetDataPtr());
+    return {K_ptr[0], K_ptr[4], K_ptr[2], K_ptr[5]};
+}
+
+/// Raw inputs of ComputeOdometrySystem, passed by value to the kernels. The
+/// map pointers of the disabled residuals are null.
+struct OdometrySystemArgs {
+    const float* source_vertex;
+    const float* source_intensity;
+    const float* target_vertex;
+    const float* target_normal;
+    const float* target_intensity;
+    const float* target_intensity_dx;
+    const float* target_intensity_dy;
+    int64_t rows;
+    int64_t cols;
+    PinholeCamera camera;
+    // Row-major rotation and translation of source_to_target.
+    float R[9];
+    float t[3];
+    float depth_outlier_trunc;
+    float depth_huber_delta;
+    float intensity_huber_delta;
+    float depth_weight;
+    float intensity_weight;
+};
+
+inline OdometrySystemArgs MakeOdometrySystemArgs(
+        const core::Tensor& source_vertex_map,
+        const core::Tensor& source_intensity,
+        const core::Tensor& target_vertex_map,
+        const core::Tensor& target_normal_map,
+        const core::Tensor& target_intensity,
+        const core::Tensor& target_intensity_dx,
+        const core::Tensor& target_intensity_dy,
+        const core::Tensor& intrinsics,
+        const core::Tensor& source_to_target,
+        float depth_outlier_trunc,
+        float depth_huber_delta,
+        float intensity_huber_delta) {
+    OdometrySystemArgs args;
+    bool use_depth = target_normal_map.NumElements() != 0;
+    bool use_intensity = source_intensity.NumElements() != 0;
+
+    args.source_vertex =
+            static_cast<const float*>(source_vertex_map.GetDataPtr());
+    args.target_vertex =
+            static_cast<const float*>(target_vertex_map.GetDataPtr());
+    args.target_normal =
+            use_depth ? static_cast<const float*>(
+                                target_normal_map.GetDataPtr())
+                      : nullptr;
+    args.source_intensity =
+            use_intensity
+                    ? static_cast<const float*>(source_intensity.GetDataPtr())
+                    : nullptr;
+    args.target_intensity =
+            use_intensity
+                    ? static_cast<const float*>(target_intensity.GetDataPtr())
+                    : nullptr;
+    args.target_intensity_dx =
+            use_intensity ? static_cast<const float*>(
+                                    target_intensity_dx.GetDataPtr())
+                          : nullptr;
+    args.target_intensity_dy =
+            use_intensity ? static_cast<const float*>(
+                                    target_intensity_dy.GetDataPtr())
+                          : nullptr;
+    args.rows = source_vertex_map.GetShape(0);
+    args.cols = source_vertex_map.GetShape(1);
+    args.camera = ReadPinholeCamera(intrinsics);
+
+    source_to_target.AssertShape({4, 4});
+    core::Tensor T = source_to_target.To(core::Dtype::Float32)
+                             .Copy(core::Device("CPU:0"))
+                             .Contiguous();
+    const float* T_ptr = static_cast<const float*>(T.GetDataPtr());
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            args.R[i * 3 + j] = T_ptr[i * 4 + j];
+        }
+        args.t[i] = T_ptr[i * 4 + 3];
+    }
+
+    args.depth_outlier_trunc = depth_outlier_trunc;
+    args.depth_huber_delta = depth_huber_delta;
+    args.intensity_huber_delta = intensity_huber_delta;
+    args.depth_weight = use_intensity ? kHybridDepthWeight : 1.0f;
+    args.intensity_weight = use_depth ? 1.0f - kHybridDepthWeight : 1.0f;
+    return args;
+}
+
+OPEN3D_HOST_DEVICE inline float HuberWeight(float r, float delta) {
+    float abs_r = fabsf(r);
+    return abs_r <= delta ? 1.0f : delta / abs_r;
+}
+
+/// Adds the residuals of the source pixel workload_idx to the system A of
+/// size kOdometrySystemSize.
+///
+/// The source_to_target transformation is perturbed as exp(xi) T with xi =
+/// (omega, v), so that a transformed vertex X moves by omega x X + v and the
+/// Jacobian of a residual with gradient g with respect to X is (X x g, g).
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE inline void AccumulateOdometryPixel(
+        int64_t workload_idx, const OdometrySystemArgs& args, scalar_t* A) {
+    const float* vs = args.source_vertex + 3 * workload_idx;
+    if (!(vs[2] > 0.0f)) return;
+
+    float X[3];
+    for (int i = 0; i < 3; ++i) {
+        X[i] = args.R[i * 3 + 0] * vs[0] + args.R[i * 3 + 1] * vs[1] +
+               args.R[i * 3 + 2] * vs[2] + args.t[i];
+    }
+    if (!(X[2] > 0.0f)) return;
+
+    const PinholeCamera& cam = args.camera;
+    float inv_z = 1.0f / X[2];
+    int64_t u = static_cast<int64_t>(floorf(cam.fx * X[0] * inv_z + cam.cx +
+                                            0.5f));
+    int64_t v = static_cast<int64_t>(floorf(cam.fy * X[1] * inv_z + cam.cy +
+                                            0.5f));
+    if (u < 0 || u >= args.cols || v < 0 || v >= args.rows) return;
+
+    int64_t target_idx = v * args.cols + u;
+    const float* vt = args.target_vertex + 3 * target_idx;
+    if (!(vt[2] > 0.0f)) return;
+
+    bool inlier = false;
+    float J[6];
+    if (args.target_normal != nullptr) {
+        const float* nt = args.target_normal + 3 * target_idx;
+        float r = (X[0] - vt[0]) * nt[0] + (X[1] - vt[1]) * nt[1] +
+                  (X[2] - vt[2]) * nt[2];
+        bool valid_normal = nt[0] != 0.0f || nt[1] != 0.0f || nt[2] != 0.0f;
+        if (valid_normal && fabsf(r) < args.depth_outlier_trunc) {
+            J[0] = X[1] * nt[2] - X[2] * nt[1];
+            J[1] = X[2] * nt[0] - X[0] * nt[2];
+            J[2] = X[0] * nt[1] - X[1] * nt[0];
+            J[3] = nt[0];
+            J[4] = nt[1];
+            J[5] = nt[2];
+            AccumulateResidual(
+                    A, J, r,
+                    args.depth_weight * HuberWeight(r, args.depth_huber_delta));
+            inlier = true;
+        }
+    }
+
+    // The depth check rejects the occluded correspondences.
+    if (args.source_intensity != nullptr &&
+        fabsf(X[2] - vt[2]) < args.depth_outlier_trunc) {
+        float r = args.target_intensity[target_idx] -
+                  args.source_intensity[workload_idx];
+        float dIdu = kSobelScale * args.target_intensity_dx[target_idx];
+        float dIdv = kSobelScale * args.target_intensity_dy[target_idx];
+        float g[3];
+        g[0] = dIdu * cam.fx * inv_z;
+        g[1] = dIdv * cam.fy * inv_z;
+        g[2] = -(g[0] * X[0] + g[1] * X[1]) * inv_z;
+        J[0] = X[1] * g[2] - X[2] * g[1];
+        J[1] = X[2] * g[0] - X[0] * g[2];
+        J[2] = X[0] * g[1] - X[1] * g[0];
+        J[3] = g[0];
+        J[4] = g[1];
+        J[5] = g[2];
+        AccumulateResidual(A, J, r,
+                           args.intensity_weight *
+                                   HuberWeight(r, args.intensity_huber_delta));
+        inlier = true;
+    }
+
+    if (inlier) {
+        A[28] += 1;
+    }
+}
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void CreateVertexMapCUDA
+#else
+void CreateVertexMapCPU
+#endif
+        (const core::Tensor& depth_map,
+         const core::Tensor& intrinsics,
+         core::Tensor& vertex_map) {
+    PinholeCamera cam = ReadPinholeCamera(intrinsics);
+    int64_t cols = depth_map.GetShape(1);
+    const float* depth_ptr = static_cast<const float*>(depth_map.GetDataPtr());
+    float* vertex_ptr = static_cast<float*>(vertex_map.GetDataPtr());
+
+    int64_t n = depth_map.GetShape(0) * cols;
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+    core::kernel::CUDALauncher::LaunchGeneralKernel(
+            n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+#else
+    core::kernel::CPULauncher::LaunchGeneralKernel(
+            n, [&](int64_t workload_idx) {
+#endif
+                float d = depth_ptr[workload_idx];
+                float* vertex = vertex_ptr + 3 * workload_idx;
+                if (d > 0.0f) {
+                    float u = static_cast<float>(workload_idx % cols);
+                    float v = static_cast<float>(workload_idx / cols);
+                    vertex[0] = (u - cam.cx) * d / cam.fx;
+                    vertex[1] = (v - cam.cy) * d / cam.fy;
+                    vertex[2] = d;
+                } else {
+                    vertex[0] = vertex[1] = vertex[2] = 0.0f;
+                }
+            });
+}
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void CreateNormalMapCUDA
+#else
+void CreateNormalMapCPU
+#endif
+        (const core::Tensor& vertex_map, core::Tensor& normal_map) {
+    int64_t rows = vertex_map.GetShape(0);
+    int64_t cols = vertex_map.GetShape(1);
+    const float* vertex_ptr =
+            static_cast<const float*>(vertex_map.GetDataPtr());
+    float* normal_ptr = static_cast<float*>(normal_map.GetDataPtr());
+
+    int64_t n = rows * cols;
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+    core::kernel::CUDALauncher::LaunchGeneralKernel(
+            n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+#else
+    core::kernel::CPULauncher::LaunchGeneralKernel(
+            n, [&](int64_t workload_idx) {
+#endif
+                float* normal = normal_ptr + 3 * workload_idx;
+                normal[0] = normal[1] = normal[2] = 0.0f;
+
+                int64_t r = workload_idx / cols;
+                int64_t c = workload_idx % cols;
+                if (r + 1 >= rows || c + 1 >= cols) return;
+
+                const float* v00 = vertex_ptr + 3 * workload_idx;
+                const float* v01 = v00 + 3;
+                const float* v10 = v00 + 3 * cols;
+                if (!(v00[2] > 0.0f && v01[2] > 0.0f && v10[2] > 0.0f)) return;
+
+                float dx[3], dy[3];
+                for (int i = 0; i < 3; ++i) {
+                    dx[i] = v01[i] - v00[i];
+                    dy[i] = v10[i] - v00[i];
+                }
+                float nx = dx[1] * dy[2] - dx[2] * dy[1];
+                float ny = dx[2] * dy[0] - dx[0] * dy[2];
+                float nz = dx[0] * dy[1] - dx[1] * dy[0];
+                float norm = sqrtf(nx * nx + ny * ny + nz * nz);
+                if (norm > 0.0f) {
+                    normal[0] = nx / norm;
+                    normal[1] = ny / norm;
+                    normal[2] = nz / norm;
+                }
+            });
+}
+
+}  // namespace odometry
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,234 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/kernel/TransformationEstimation.h"
+
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+namespace registration {
+
+void ComputePointToPlaneSystem(
+        const core::Tensor& source_points,
+        const core::Tensor& target_points,
+        const core::Tensor& target_normals,
+        const core::Tensor& source_indices,
+        const core::Tensor& target_indices,
+        const t::pipelines::registration::RobustKernel& kernel,
+        core::Tensor& system) {
+    core::Device device = source_points.GetDevice();
+    source_points.AssertDtype(core::Dtype::Float32);
+    target_points.AssertDtype(core::Dtype::Float32);
+    target_points.AssertDevice(device);
+    target_normals.AssertShape(target_points.GetShape());
+    target_normals.AssertDtype(core::Dtype::Float32);
+    target_normals.AssertDevice(device);
+    source_indices.AssertDtype(core::Dtype::Int64);
+    source_indices.AssertDevice(device);
+    target_indices.AssertShape(source_indices.GetShape());
+    target_indices.AssertDtype(core::Dtype::Int64);
+    target_indices.AssertDevice(device);
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputePointToPlaneSystemCPU(source_points, target_points,
+                                     target_normals, source_indices,
+                                     target_indices, kernel, system);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        ComputePointToPlaneSystemCUDA(source_points, target_points,
+                                      target_normals, source_indices,
+                                      target_indices, kernel, system);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void ComputeColoredICPSystem(
+        const core::Tensor& source_points,
+        const core::Tensor& source_colors,
+        const core::Tensor& target_points,
+        const core::Tensor& target_normals,
+        const core::Tensor& target_colors,
+        const core::Tensor& target_color_gradients,
+        const core::Tensor& source_indices,
+        const core::Tensor& target_indices,
+        double lambda_geometric,
+        const t::pipelines::registration::RobustKernel& kernel,
+        core::Tensor& system) {
+    core::Device device = source_points.GetDevice();
+    source_points.AssertDtype(core::Dtype::Float32);
+    source_colors.AssertShape(source_points.GetShape());
+    source_colors.AssertDtype(core::Dtype::Float32);
+    source_colors.AssertDevice(device);
+    target_points.AssertDtype(core::Dtype::Float32);
+    target_points.AssertDevice(device);
+    for (const core::Tensor* target_attr :
+         {&target_normals, &target_colors, &target_color_gradients}) {
+        target_attr->AssertShape(target_points.GetShape());
+        target_attr->AssertDtype(core::Dtype::Float32);
+        target_attr->AssertDevice(device);
+    }
+    source_indices.AssertDtype(core::Dtype::Int64);
+    source_indices.AssertDevice(device);
+    target_indices.AssertShape(source_indices.GetShape());
+    target_indices.AssertDtype(core::Dtype::Int64);
+    target_indices.AssertDevice(device);
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeColoredICPSystemCPU(source_points, source_colors, target_points,
+                                   target_normals, target_colors,
+                                   target_color_gradients, source_indices,
+                                   target_indices, lambda_geometric, kernel,
+                                   system);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        ComputeColoredICPSystemCUDA(source_points, source_colors, target_points,
+                                    target_normals, target_colors,
+                                    target_color_gradients, source_indices,
+                                    target_indices, lambda_geometric, kernel,
+                                    system);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void ComputeColorGradients(const core::Tensor& points,
+                           const core::Tensor& normals,
+                           const core::Tensor& colors,
+                           const core::Tensor& neighbor_indices,
+                           const core::Tensor& neighbor_distances,
+                           double max_distance2,
+                           core::Tensor& color_gradients) {
+    core::Device device = points.GetDevice();
+    points.AssertDtype(core::Dtype::Float32);
+    for (const core::Tensor* attr : {&normals, &colors}) {
+        attr->AssertShape(points.GetShape());
+        attr->AssertDtype(core::Dtype::Float32);
+        attr->AssertDevice(device);
+    }
+    neighbor_indices.AssertDtype(core::Dtype::Int64);
+    neighbor_indices.AssertDevice(device);
+    neighbor_distances.AssertShape(neighbor_indices.GetShape());
+    neighbor_distances.AssertDtype(core::Dtype::Float32);
+    neighbor_distances.AssertDevice(device);
+
+    color_gradients = core::Tensor::Zeros(points.GetShape(),
+                                          core::Dtype::Float32, device);
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeColorGradientsCPU(points, normals, colors, neighbor_indices,
+                                 neighbor_distances, max_distance2,
+                                 color_gradients);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        ComputeColorGradientsCUDA(points, normals, colors, neighbor_indices,
+                                  neighbor_distances, max_distance2,
+                                  color_gradients);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void ComputeFGRSystem(const core::Tensor& source_points,
+                      const core::Tensor& target_points,
+                      double mu,
+                      core::Tensor& system) {
+    core::Device device = source_points.GetDevice();
+    source_points.AssertShapeCompatible({utility::nullopt, 3});
+    source_points.AssertDtype(core::Dtype::Float32);
+    target_points.AssertShape(source_points.GetShape());
+    target_points.AssertDtype(core::Dtype::Float32);
+    target_points.AssertDevice(device);
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeFGRSystemCPU(source_points, target_points, mu, system);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        ComputeFGRSystemCUDA(source_points, target_points, mu, system);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void ComputeInformationMatrices(const core::Tensor& target_points,
+                                const core::Tensor& target_indices,
+                                const core::Tensor& edge_indices,
+                                int64_t num_edges,
+                                core::Tensor& information) {
+    core::Device device = target_points.GetDevice();
+    target_points.AssertShapeCompatible({utility::nullopt, 3});
+    target_points.AssertDtype(core::Dtype::Float32);
+    target_indices.AssertShapeCompatible({utility::nullopt});
+    target_indices.AssertDtype(core::Dtype::Int64);
+    target_indices.AssertDevice(device);
+    edge_indices.AssertShape(target_indices.GetShape());
+    edge_indices.AssertDtype(core::Dtype::Int64);
+    edge_indices.AssertDevice(device);
+    if (num_edges < 0) {
+        utility::LogError("num_edges must be non-negative, but got {}.",
+                          num_edges);
+    }
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeInformationMatricesCPU(target_points, target_indices,
+                                      edge_indices, num_edges, information);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        ComputeInformationMatricesCUDA(target_points, target_indices,
+                                       edge_indices, num_edges, information);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+}  // namespace registration
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,256 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+#include "open3d/t/pipelines/registration/RobustKernel.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+namespace registration {
+
+/// Number of floats of the linear systems accumulated by the ICP kernels, in
+/// the layout of the odometry system: the 21 entries of the upper triangle of
+/// J^T J in row-major order, the 6 entries of J^T r, the sum of squared
+/// residuals and the number of correspondences.
+constexpr int64_t kICPSystemSize = 29;
+
+/// Accumulates the Gauss-Newton system of one point-to-plane ICP iteration in
+/// a single pass over the correspondences.
+///
+/// The residual of a correspondence is (s - t) . n, for the source point s,
+/// the target point t and its normal n. Its Jacobian with respect to the pose
+/// [alpha, beta, gamma, tx, ty, tz] at the identity is (s x n, n). Residuals
+/// are weighted by the robust kernel.
+///
+/// \param source_points Float32 source points of shape {N, 3}.
+/// \param target_points Float32 target points of shape {M, 3}.
+/// \param target_normals Float32 target normals of shape {M, 3}.
+/// \param source_indices Int64 source indices of the correspondences, of
+/// shape {K}.
+/// \param target_indices Int64 target indices of the correspondences, of
+/// shape {K}. Correspondences with a negative target index are skipped, so
+/// that the raw output of a nearest neighbor search can be passed as is.
+/// \param kernel Robust kernel of the residuals.
+/// \param system Output Float32 tensor of shape {kICPSystemSize} on the device
+/// of the points.
+void ComputePointToPlaneSystem(
+        const core::Tensor& source_points,
+        const core::Tensor& target_points,
+        const core::Tensor& target_normals,
+        const core::Tensor& source_indices,
+        const core::Tensor& target_indices,
+        const t::pipelines::registration::RobustKernel& kernel,
+        core::Tensor& system);
+
+/// Accumulates the Gauss-Newton system of one colored ICP iteration, with the
+/// geometric and photometric residuals of J. Park, Q.-Y. Zhou, V. Koltun,
+/// Colored Point Cloud Registration Revisited, ICCV 2017.
+///
+/// The residuals are scaled by sqrt(lambda_geometric) and
+/// sqrt(1 - lambda_geometric) and weighted by the robust kernel. The sum of
+/// squared residuals is unweighted only for the L2 loss.
+///
+/// \param source_points Float32 source points of shape {N, 3}.
+/// \param source_colors Float32 source colors of shape {N, 3}.
+/// \param target_points Float32 target points of shape {M, 3}.
+/// \param target_normals Float32 target normals of shape {M, 3}.
+/// \param target_colors Float32 target colors of shape {M, 3}.
+/// \param target_color_gradients Float32 gradients of the target intensity
+/// of shape {M, 3}, from ComputeColorGradients.
+/// \param source_indices Int64 source indices of the correspondences, of
+/// shape {K}.
+/// \param target_indices Int64 target indices of the correspondences, of
+/// shape {K}. Correspondences with a negative target index are skipped.
+/// \param lambda_geometric Weight of the geometric residual, in [0, 1].
+/// \param kernel Robust kernel of the residuals.
+/// \param system Output Float32 tensor of shape {kICPSystemSize} on the device
+/// of the points.
+void ComputeColoredICPSystem(
+        const core::Tensor& source_points,
+        const core::Tensor& source_colors,
+        const core::Tensor& target_points,
+        const core::Tensor& target_normals,
+        const core::Tensor& target_colors,
+        const core::Tensor& target_color_gradients,
+        const core::Tensor& source_indices,
+        const core::Tensor& target_indices,
+        double lambda_geometric,
+        const t::pipelines::registration::RobustKernel& kernel,
+        core::Tensor& system);
+
+/// Computes the gradient of the intensity, the mean of the colors, on the
+/// tangent plane of each point by least squares over its neighbors. Points
+/// with less than 4 neighbors within the distance get a zero gradient.
+///
+/// \param points Float32 points of shape {N, 3}.
+/// \param normals Float32 normals of shape {N, 3}.
+/// \param colors Float32 colors of shape {N, 3}.
+/// \param neighbor_indices Int64 indices of shape {N, max_nn} of the nearest
+/// neighbors of the points, sorted by distance, with -1 for missing ones.
+/// \param neighbor_distances Float32 squared distances of shape {N, max_nn}.
+/// \param max_distance2 Maximum squared distance of the neighbors.
+/// \param color_gradients Output Float32 gradients of shape {N, 3}.
+void ComputeColorGradients(const core::Tensor& points,
+                           const core::Tensor& normals,
+                           const core::Tensor& colors,
+                           const core::Tensor& neighbor_indices,
+                           const core::Tensor& neighbor_distances,
+                           double max_distance2,
+                           core::Tensor& color_gradients);
+
+/// Accumulates the Gauss-Newton system of one iteration of Fast Global
+/// Registration, Q.-Y. Zhou, J. Park, V. Koltun, ECCV 2016, over pairs of
+/// points.
+///
+/// The residual of a pair is s - t, one row per axis, with the Jacobian
+/// (s x e_k, e_k) of the axis k. The rows are weighted by the line process
+/// of the scaled Geman-McClure estimator, (mu / (|s - t|^2 + mu))^2.
+///
+/// \param source_points Float32 source points of shape {K, 3}, transformed by
+/// the current estimate.
+/// \param target_points Float32 target points of shape {K, 3}, paired with the
+/// source points by row.
+/// \param mu Scale of the Geman-McClure estimator.
+/// \param system Output Float32 tensor of shape {kICPSystemSize} on the device
+/// of the points.
+void ComputeFGRSystem(const core::Tensor& source_points,
+                      const core::Tensor& target_points,
+                      double mu,
+                      core::Tensor& system);
+
+/// Computes the information matrices of a batch of registrations, as the
+/// legacy GetInformationMatrixFromPointClouds, in a single pass over their
+/// correspondences.
+///
+/// \param target_points Float32 target points of shape {M, 3}, e.g. the
+/// concatenated targets of the edges.
+/// \param target_indices Int64 target indices of the correspondences, of
+/// shape {K}. Correspondences with a negative target index are skipped.
+/// \param edge_indices Int64 edges of the correspondences in [0, num_edges),
+/// of shape {K}. The reduction is fastest when the correspondences of an edge
+/// are contiguous.
+/// \param num_edges Number of edges E.
+/// \param information Output Float64 tensor of shape {E, 6, 6} on the device
+/// of the points.
+void ComputeInformationMatrices(const core::Tensor& target_points,
+                                const core::Tensor& target_indices,
+                                const core::Tensor& edge_indices,
+                                int64_t num_edges,
+                                core::Tensor& information);
+
+void ComputePointToPlaneSystemCPU(
+        const core::Tensor& source_points,
+        const core::Tensor& target_points,
+        const core::Tensor& target_normals,
+        const core::Tensor& source_indices,
+        const core::Tensor& target_indices,
+        const t::pipelines::registration::RobustKernel& kernel,
+        core::Tensor& system);
+
+void ComputeColoredICPSystemCPU(
+        const core::Tensor& source_points,
+        const core::Tensor& source_colors,
+        const core::Tensor& target_points,
+        const core::Tensor& target_normals,
+        const core::Tensor& target_colors,
+        const core::Tensor& target_color_gradients,
+        const core::Tensor& source_indices,
+        const core::Tensor& target_indices,
+        double lambda_geometric,
+        const t::pipelines::registration::RobustKernel& kernel,
+        core::Tensor& system);
+
+void ComputeColorGradientsCPU(const core::Tensor& points,
+                              const core::Tensor& normals,
+                              const core::Tensor& colors,
+                              const core::Tensor& neighbor_indices,
+                              const core::Tensor& neighbor_distances,
+                              double max_distance2,
+                              core::Tensor& color_gradients);
+
+void ComputeFGRSystemCPU(const core::Tensor& source_points,
+                         const core::Tensor& target_points,
+                         double mu,
+                         core::Tensor& system);
+
+void ComputeInformationMatricesCPU(const core::Tensor& target_points,
+                                   const core::Tensor& target_indices,
+                                   const core::Tensor& edge_indices,
+                                   int64_t num_edges,
+                                   core::Tensor& information);
+
+#ifdef BUILD_CUDA_MODULE
+void ComputePointToPlaneSystemCUDA(
+        const core::Tensor& source_points,
+        const core::Tensor& target_points,
+        const core::Tensor& target_normals,
+        const core::Tensor& source_indices,
+        const core::Tensor& target_indices,
+        const t::pipelines::registration::RobustKernel& kernel,
+        core::Tensor& system);
+
+void ComputeColoredICPSystemCUDA(
+        const core::Tensor& source_points,
+        const core::Tensor& source_colors,
+        const core::Tensor& target_points,
+        const core::Tensor& target_normals,
+        const core::Tensor& target_colors,
+        const core::Tensor& target_color_gradients,
+        const core::Tensor& source_indices,
+        const core::Tensor& target_indices,
+        double lambda_geometric,
+        const t::pipelines::registration::RobustKernel& kernel,
+        core::Tensor& system);
+
+void ComputeColorGradientsCUDA(const core::Tensor& points,
+                               const core::Tensor& normals,
+                               const core::Tensor& colors,
+                               const core::Tensor& neighbor_indices,
+                               const core::Tensor& neighbor_distances,
+                               double max_distance2,
+                               core::Tensor& color_gradients);
+
+void ComputeFGRSystemCUDA(const core::Tensor& source_points,
+                          const core::Tensor& target_points,
+                          double mu,
+                          core::Tensor& system);
+
+void ComputeInformationMatricesCUDA(const core::Tensor& target_points,
+                                    const core::Tensor& target_indices,
+                                    const core::Tensor& edge_indices,
+                                    int64_t num_edges,
+                                    core::Tensor& information);
+#endif
+
+}  // namespace registration
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
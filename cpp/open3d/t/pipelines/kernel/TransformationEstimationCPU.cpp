@@ -0,0 +1,145 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/CPULauncher.h"
+#include "open3d/t/pipelines/kernel/TransformationEstimationImpl.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+namespace registration {
+
+namespace {
+
+/// Reduces the systems of the correspondences of args. Each thread accumulates
+/// its correspondences in double before the reduction.
+template <typename Args>
+core::Tensor ReduceICPSystem(const Args& args, const core::Device& device) {
+    std::vector<double> sum(kICPSystemSize, 0.0);
+#pragma omp parallel num_threads(utility::EstimateMaxThreads())
+    {
+        double A[kICPSystemSize] = {0};
+#pragma omp for schedule(static)
+        for (int64_t workload_idx = 0; workload_idx < args.n; ++workload_idx) {
+            AccumulateCorrespondence(workload_idx, args, A);
+        }
+#pragma omp critical
+        {
+            for (int64_t k = 0; k < kICPSystemSize; ++k) {
+                sum[k] += A[k];
+            }
+        }
+    }
+    return core::Tensor(std::vector<float>(sum.begin(), sum.end()),
+                        {kICPSystemSize}, core::Dtype::Float32, device);
+}
+
+}  // namespace
+
+void ComputePointToPlaneSystemCPU(
+        const core::Tensor& source_points,
+        const core::Tensor& target_points,
+        const core::Tensor& target_normals,
+        const core::Tensor& source_indices,
+        const core::Tensor& target_indices,
+        const t::pipelines::registration::RobustKernel& kernel,
+        core::Tensor& system) {
+    PointToPlaneSystemArgs args = MakePointToPlaneSystemArgs(
+            source_points, target_points, target_normals, source_indices,
+            target_indices, kernel);
+    system = ReduceICPSystem(args, source_points.GetDevice());
+}
+
+void ComputeColoredICPSystemCPU(
+        const core::Tensor& source_points,
+        const core::Tensor& source_colors,
+        const core::Tensor& target_points,
+        const core::Tensor& target_normals,
+        const core::Tensor& target_colors,
+        const core::Tensor& target_color_gradients,
+        const core::Tensor& source_indices,
+        const core::Tensor& target_indices,
+        double lambda_geometric,
+        const t::pipelines::registration::RobustKernel& kernel,
+        core::Tensor& system) {
+    ColoredICPSystemArgs args = MakeColoredICPSystemArgs(
+            source_points, source_colors, target_points, target_normals,
+            target_colors, target_color_gradients, source_indices,
+            target_indices, lambda_geometric, kernel);
+    system = ReduceICPSystem(args, source_points.GetDevice());
+}
+
+void ComputeFGRSystemCPU(const core::Tensor& source_points,
+                         const core::Tensor& target_points,
+                         double mu,
+                         core::Tensor& system) {
+    FGRSystemArgs args = MakeFGRSystemArgs(source_points, target_points, mu);
+    system = ReduceICPSystem(args, source_points.GetDevice());
+}
+
+void ComputeInformationMatricesCPU(const core::Tensor& target_points,
+                                   const core::Tensor& target_indices,
+                                   const core::Tensor& edge_indices,
+                                   int64_t num_edges,
+                                   core::Tensor& information) {
+    InformationMatrixArgs args = MakeInformationMatrixArgs(
+            target_points, target_indices, edge_indices);
+    const int64_t size = kInformationMomentsSize * num_edges;
+    std::vector<double> moments(size, 0.0);
+#pragma omp parallel num_threads(utility::EstimateMaxThreads())
+    {
+        std::vector<double> local_moments(size, 0.0);
+#pragma omp for schedule(static)
+        for (int64_t workload_idx = 0; workload_idx < args.n; ++workload_idx) {
+            float m[kInformationMomentsSize];
+            int64_t e = GetInformationMoments(workload_idx, args, m);
+            if (e < 0) continue;
+            double* dst = local_moments.data() + kInformationMomentsSize * e;
+            for (int64_t k = 0; k < kInformationMomentsSize; ++k) {
+                dst[k] += m[k];
+            }
+        }
+#pragma omp critical
+        {
+            for (int64_t k = 0; k < size; ++k) {
+                moments[k] += local_moments[k];
+            }
+        }
+    }
+    information = InformationMatricesFromMoments(moments, num_edges,
+                                                 target_points.GetDevice());
+}
+
+}  // namespace registration
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,220 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/CUDALauncher.cuh"
+#include "open3d/t/pipelines/kernel/TransformationEstimationImpl.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+namespace registration {
+
+namespace {
+
+constexpr int kBlockSize = 256;
+constexpr int kWarpSize = 32;
+
+__device__ inline float WarpReduceSum(float value) {
+#pragma unroll
+    for (int offset = kWarpSize / 2; offset > 0; offset /= 2) {
+        value += __shfl_down_sync(0xffffffff, value, offset);
+    }
+    return value;
+}
+
+// One thread per correspondence. The systems of the threads are summed by warp
+// shuffles, then across the warps of the block in shared memory, so each
+// block adds a single system to the output.
+template <typename Args>
+__global__ void ReduceICPSystemKernel(Args args, float* system) {
+    float A[kICPSystemSize];
+#pragma unroll
+    for (int k = 0; k < kICPSystemSize; ++k) {
+        A[k] = 0;
+    }
+
+    int64_t workload_idx =
+            static_cast<int64_t>(blockIdx.x) * kBlockSize + threadIdx.x;
+    if (workload_idx < args.n) {
+        AccumulateCorrespondence(workload_idx, args, A);
+    }
+
+    __shared__ float warp_sums[kICPSystemSize][kBlockSize / kWarpSize];
+    int lane = threadIdx.x % kWarpSize;
+    int warp = threadIdx.x / kWarpSize;
+#pragma unroll
+    for (int k = 0; k < kICPSystemSize; ++k) {
+        float value = WarpReduceSum(A[k]);
+        if (lane == 0) {
+            warp_sums[k][warp] = value;
+        }
+    }
+    __syncthreads();
+
+    if (warp == 0) {
+        for (int k = 0; k < kICPSystemSize; ++k) {
+            float value =
+                    lane < kBlockSize / kWarpSize ? warp_sums[k][lane] : 0.0f;
+            value = WarpReduceSum(value);
+            if (lane == 0) {
+                atomicAdd(&system[k], value);
+            }
+        }
+    }
+}
+
+template <typename Args>
+core::Tensor ReduceICPSystem(const Args& args, const core::Device& device) {
+    core::Tensor system =
+            core::Tensor::Zeros({kICPSystemSize}, core::Dtype::Float32, device);
+    if (args.n == 0) {
+        return system;
+    }
+    int64_t grid_size = (args.n + kBlockSize - 1) / kBlockSize;
+    ReduceICPSystemKernel<<<grid_size, kBlockSize, 0,
+                            core::GetCUDACurrentStream()>>>(
+            args, static_cast<float*>(system.GetDataPtr()));
+    OPEN3D_CUDA_CHECK(cudaGetLastError());
+    return system;
+}
+
+// One thread per correspondence. A warp whose correspondences all belong to
+// the same edge, the common case as the correspondences of an edge are
+// contiguous, sums its moments by shuffles and adds them once. Otherwise each
+// thread adds its own moments.
+__global__ void ReduceInformationMomentsKernel(InformationMatrixArgs args,
+                                               float* moments) {
+    float m[kInformationMomentsSize];
+    int64_t workload_idx =
+            static_cast<int64_t>(blockIdx.x) * kBlockSize + threadIdx.x;
+    int64_t e = -1;
+    if (workload_idx < args.n) {
+        e = GetInformationMoments(workload_idx, args, m);
+    }
+    if (e < 0) {
+#pragma unroll
+        for (int k = 0; k < kInformationMomentsSize; ++k) {
+            m[k] = 0;
+        }
+    }
+
+    int64_t first_e = __shfl_sync(0xffffffff, e, 0);
+    bool uniform = __all_sync(0xffffffff, e == first_e || e < 0);
+    if (uniform) {
+        if (first_e < 0) return;
+        int lane = threadIdx.x % kWarpSize;
+#pragma unroll
+        for (int k = 0; k < kInformationMomentsSize; ++k) {
+            float value = WarpReduceSum(m[k]);
+            if (lane == 0) {
+                atomicAdd(&moments[kInformationMomentsSize * first_e + k],
+                          value);
+            }
+        }
+    } else if (e >= 0) {
+#pragma unroll
+        for (int k = 0; k < kInformationMomentsSize; ++k) {
+            atomicAdd(&moments[kInformationMomentsSize * e + k], m[k]);
+        }
+    }
+}
+
+}  // namespace
+
+void ComputePointToPlaneSystemCUDA(
+        const core::Tensor& source_points,
+        const core::Tensor& target_points,
+        const core::Tensor& target_normals,
+        const core::Tensor& source_indices,
+        const core::Tensor& target_indices,
+        const t::pipelines::registration::RobustKernel& kernel,
+        core::Tensor& system) {
+    PointToPlaneSystemArgs args = MakePointToPlaneSystemArgs(
+            source_points, target_points, target_normals, source_indices,
+            target_indices, kernel);
+    system = ReduceICPSystem(args, source_points.GetDevice());
+}
+
+void ComputeColoredICPSystemCUDA(
+        const core::Tensor& source_points,
+        const core::Tensor& source_colors,
+        const core::Tensor& target_points,
+        const core::Tensor& target_normals,
+        const core::Tensor& target_colors,
+        const core::Tensor& target_color_gradients,
+        const core::Tensor& source_indices,
+        const core::Tensor& target_indices,
+        double lambda_geometric,
+        const t::pipelines::registration::RobustKernel& kernel,
+        core::Tensor& system) {
+    ColoredICPSystemArgs args = MakeColoredICPSystemArgs(
+            source_points, source_colors, target_points, target_normals,
+            target_colors, target_color_gradients, source_indices,
+            target_indices, lambda_geometric, kernel);
+    system = ReduceICPSystem(args, source_points.GetDevice());
+}
+
+void ComputeFGRSystemCUDA(const core::Tensor& source_points,
+                          const core::Tensor& target_points,
+                          double mu,
+                          core::Tensor& system) {
+    FGRSystemArgs args = MakeFGRSystemArgs(source_points, target_points, mu);
+    system = ReduceICPSystem(args, source_points.GetDevice());
+}
+
+void ComputeInformationMatricesCUDA(const core::Tensor& target_points,
+                                    const core::Tensor& target_indices,
+                                    const core::Tensor& edge_indices,
+                                    int64_t num_edges,
+                                    core::Tensor& information) {
+    InformationMatrixArgs args = MakeInformationMatrixArgs(
+            target_points, target_indices, edge_indices);
+    core::Tensor moments = core::Tensor::Zeros(
+            {num_edges, kInformationMomentsSize}, core::Dtype::Float32,
+            target_points.GetDevice());
+    if (args.n > 0 && num_edges > 0) {
+        int64_t grid_size = (args.n + kBlockSize - 1) / kBlockSize;
+        ReduceInformationMomentsKernel<<<grid_size, kBlockSize, 0,
+                                         core::GetCUDACurrentStream()>>>(
+                args, static_cast<float*>(moments.GetDataPtr()));
+        OPEN3D_CUDA_CHECK(cudaGetLastError());
+    }
+    // The 6x6 matrices are assembled on the host from the few moments.
+    information = InformationMatricesFromMoments(
+            moments.To(core::Dtype::Float64)
+                    .Copy(core::Device("CPU:0"))
+                    .ToFlatVector<double>(),
+            num_edges, target_points.GetDevice());
+}
+
+}  // namespace registration
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,469 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+// Private header. Do not include in Open3d.h.
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/pipelines/kernel/LinearSystemImpl.h"
+#include "open3d/t/pipelines/kernel/TransformationEstimation.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+namespace registration {
+
+using t::pipelines::registration::RobustKernel;
+using t::pipelines::registration::RobustKernelMethod;
+
+/// Weight of the residual r for the robust kernel method with scaling
+/// parameter k, as in the legacy RobustKernel classes.
+OPEN3D_HOST_DEVICE inline float RobustWeight(RobustKernelMethod method,
+                                             float k,
+                                             float r) {
+    float abs_r = fabsf(r);
+    switch (method) {
+        case RobustKernelMethod::L1Loss:
+            // The legacy weight 1 / |r| is infinite for exact matches.
+            return 1.0f / fmaxf(abs_r, 1e-6f);
+        case RobustKernelMethod::HuberLoss:
+            return k / fmaxf(abs_r, k);
+        case RobustKernelMethod::CauchyLoss:
+            return 1.0f / (1.0f + (r / k) * (r / k));
+        case RobustKernelMethod::GMLoss:
+            return k / ((k + r * r) * (k + r * r));
+        case RobustKernelMethod::TukeyLoss: {
+            float e = fminf(1.0f, abs_r / k);
+            return (1.0f - e * e) * (1.0f - e * e);
+        }
+        default:
+            return 1.0f;
+    }
+}
+
+/// Raw inputs of ComputePointToPlaneSystem, passed by value to the kernels.
+struct PointToPlaneSystemArgs {
+    const float* source_points;
+    const float* target_points;
+    const float* target_normals;
+    const int64_t* source_indices;
+    const int64_t* target_indices;
+    int64_t n;
+    RobustKernelMethod kernel_method;
+    float kernel_scale;
+};
+
+inline PointToPlaneSystemArgs MakePointToPlaneSystemArgs(
+        const core::Tensor& source_points,
+        const core::Tensor& target_points,
+        const core::Tensor& target_normals,
+        const core::Tensor& source_indices,
+        const core::Tensor& target_indices,
+        const RobustKernel& kernel) {
+    PointToPlaneSystemArgs args;
+    args.source_points = static_cast<const float*>(source_points.GetDataPtr());
+    args.target_points = static_cast<const float*>(target_points.GetDataPtr());
+    args.target_normals =
+            static_cast<const float*>(target_normals.GetDataPtr());
+    args.source_indices =
+            static_cast<const int64_t*>(source_indices.GetDataPtr());
+    args.target_indices =
+            static_cast<const int64_t*>(target_indices.GetDataPtr());
+    args.n = source_indices.NumElements();
+    args.kernel_method = kernel.type_;
+    args.kernel_scale = static_cast<float>(kernel.scaling_parameter_);
+    return args;
+}
+
+/// Raw inputs of ComputeColoredICPSystem, passed by value to the kernels.
+struct ColoredICPSystemArgs {
+    const float* source_points;
+    const float* source_colors;
+    const float* target_points;
+    const float* target_normals;
+    const float* target_colors;
+    const float* target_color_gradients;
+    const int64_t* source_indices;
+    const int64_t* target_indices;
+    int64_t n;
+    float sqrt_lambda_geometric;
+    float sqrt_lambda_photometric;
+    RobustKernelMethod kernel_method;
+    float kernel_scale;
+};
+
+inline ColoredICPSystemArgs MakeColoredICPSystemArgs(
+        const core::Tensor& source_points,
+        const core::Tensor& source_colors,
+        const core::Tensor& target_points,
+        const core::Tensor& target_normals,
+        const core::Tensor& target_colors,
+        const core::Tensor& target_color_gradients,
+        const core::Tensor& source_indices,
+        const core::Tensor& target_indices,
+        double lambda_geometric,
+        const RobustKernel& kernel) {
+    ColoredICPSystemArgs args;
+    args.source_points = static_cast<const float*>(source_points.GetDataPtr());
+    args.source_colors = static_cast<const float*>(source_colors.GetDataPtr());
+    args.target_points = static_cast<const float*>(target_points.GetDataPtr());
+    args.target_normals =
+            static_cast<const float*>(target_normals.GetDataPtr());
+    args.target_colors = static_cast<const float*>(target_colors.GetDataPtr());
+    args.target_color_gradients =
+            static_cast<const float*>(target_color_gradients.GetDataPtr());
+    args.source_indices =
+            static_cast<const int64_t*>(source_indices.GetDataPtr());
+    args.target_indices =
+            static_cast<const int64_t*>(target_indices.GetDataPtr());
+    args.n = source_indices.NumElements();
+    args.sqrt_lambda_geometric =
+            static_cast<float>(std::sqrt(lambda_geometric));
+    args.sqrt_lambda_photometric =
+            static_cast<float>(std::sqrt(1.0 - lambda_geometric));
+    args.kernel_method = kernel.type_;
+    args.kernel_scale = static_cast<float>(kernel.scaling_parameter_);
+    return args;
+}
+
+/// Raw inputs of ComputeFGRSystem, passed by value to the kernels.
+struct FGRSystemArgs {
+    const float* source_points;
+    const float* target_points;
+    int64_t n;
+    float mu;
+};
+
+inline FGRSystemArgs MakeFGRSystemArgs(const core::Tensor& source_points,
+                                       const core::Tensor& target_points,
+                                       double mu) {
+    FGRSystemArgs args;
+    args.source_points = static_cast<const float*>(source_points.GetDataPtr());
+    args.target_points = static_cast<const float*>(target_points.GetDataPtr());
+    args.n = source_points.GetLength();
+    args.mu = static_cast<float>(mu);
+    return args;
+}
+
+/// Adds the point-to-plane residual of the correspondence workload_idx to the
+/// system A of size kICPSystemSize.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE inline void AccumulateCorrespondence(
+        int64_t workload_idx,
+        const PointToPlaneSystemArgs& args,
+        scalar_t* A) {
+    if (args.target_indices[workload_idx] < 0) return;
+    const float* s = args.source_points + 3 * args.source_indices[workload_idx];
+    const float* t = args.target_points + 3 * args.target_indices[workload_idx];
+    const float* n =
+            args.target_normals + 3 * args.target_indices[workload_idx];
+
+    float J[6] = {s[1] * n[2] - s[2] * n[1], s[2] * n[0] - s[0] * n[2],
+                  s[0] * n[1] - s[1] * n[0], n[0],
+                  n[1],                      n[2]};
+    float r = (s[0] - t[0]) * n[0] + (s[1] - t[1]) * n[1] +
+              (s[2] - t[2]) * n[2];
+    AccumulateResidual(
+            A, J, r, RobustWeight(args.kernel_method, args.kernel_scale, r));
+    A[28] += 1;
+}
+
+/// Adds the geometric and photometric residuals of the correspondence
+/// workload_idx to the system A of size kICPSystemSize.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE inline void AccumulateCorrespondence(
+        int64_t workload_idx,
+        const ColoredICPSystemArgs& args,
+        scalar_t* A) {
+    int64_t cs = args.source_indices[workload_idx];
+    int64_t ct = args.target_indices[workload_idx];
+    if (ct < 0) return;
+    const float* s = args.source_points + 3 * cs;
+    const float* t = args.target_points + 3 * ct;
+    const float* n = args.target_normals + 3 * ct;
+    const float* dit = args.target_color_gradients + 3 * ct;
+
+    float d = (s[0] - t[0]) * n[0] + (s[1] - t[1]) * n[1] +
+              (s[2] - t[2]) * n[2];
+    float sg = args.sqrt_lambda_geometric;
+    float J[6] = {sg * (s[1] * n[2] - s[2] * n[1]),
+                  sg * (s[2] * n[0] - s[0] * n[2]),
+                  sg * (s[0] * n[1] - s[1] * n[0]),
+                  sg * n[0],
+                  sg * n[1],
+                  sg * n[2]};
+    float r = sg * d;
+    AccumulateResidual(
+            A, J, r, RobustWeight(args.kernel_method, args.kernel_scale, r));
+
+    // The source point projected on the tangent plane of the target point
+    // predicts the intensity from the target gradient. The Jacobian of the
+    // prediction is the gradient projected on the plane, -(I - n n^T) dit.
+    const float* c_s = args.source_colors + 3 * cs;
+    const float* c_t = args.target_colors + 3 * ct;
+    float is = (c_s[0] + c_s[1] + c_s[2]) / 3.0f;
+    float it = (c_t[0] + c_t[1] + c_t[2]) / 3.0f;
+    float dit_n = dit[0] * n[0] + dit[1] * n[1] + dit[2] * n[2];
+    float g[3];
+    float is0_proj = it;
+    for (int i = 0; i < 3; ++i) {
+        is0_proj += dit[i] * (s[i] - d * n[i] - t[i]);
+        g[i] = -(dit[i] - dit_n * n[i]);
+    }
+    float sp = args.sqrt_lambda_photometric;
+    J[0] = sp * (s[1] * g[2] - s[2] * g[1]);
+    J[1] = sp * (s[2] * g[0] - s[0] * g[2]);
+    J[2] = sp * (s[0] * g[1] - s[1] * g[0]);
+    J[3] = sp * g[0];
+    J[4] = sp * g[1];
+    J[5] = sp * g[2];
+    r = sp * (is - is0_proj);
+    AccumulateResidual(
+            A, J, r, RobustWeight(args.kernel_method, args.kernel_scale, r));
+    A[28] += 1;
+}
+
+/// Adds the three rows of the pair workload_idx, weighted by the line process,
+/// to the system A of size kICPSystemSize.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE inline void AccumulateCorrespondence(
+        int64_t workload_idx,
+        const FGRSystemArgs& args,
+        scalar_t* A) {
+    const float* s = args.source_points + 3 * workload_idx;
+    const float* t = args.target_points + 3 * workload_idx;
+    float r[3] = {s[0] - t[0], s[1] - t[1], s[2] - t[2]};
+    float l = args.mu / (r[0] * r[0] + r[1] * r[1] + r[2] * r[2] + args.mu);
+    float w = l * l;
+
+    float J[3][6] = {{0, s[2], -s[1], 1, 0, 0},
+                     {-s[2], 0, s[0], 0, 1, 0},
+                     {s[1], -s[0], 0, 0, 0, 1}};
+    for (int k = 0; k < 3; ++k) {
+        AccumulateResidual(A, J[k], r[k], w);
+    }
+    A[28] += 1;
+}
+
+/// Number of moments of the target points accumulated per edge by
+/// ComputeInformationMatrices: the number of correspondences, the sum of the
+/// points and the upper triangle of the sum of p p^T in row-major order.
+constexpr int64_t kInformationMomentsSize = 10;
+
+/// Raw inputs of ComputeInformationMatrices, passed by value to the kernels.
+struct InformationMatrixArgs {
+    const float* target_points;
+    const int64_t* target_indices;
+    const int64_t* edge_indices;
+    int64_t n;
+};
+
+inline InformationMatrixArgs MakeInformationMatrixArgs(
+        const core::Tensor& target_points,
+        const core::Tensor& target_indices,
+        const core::Tensor& edge_indices) {
+    InformationMatrixArgs args;
+    args.target_points = static_cast<const float*>(target_points.GetDataPtr());
+    args.target_indices =
+            static_cast<const int64_t*>(target_indices.GetDataPtr());
+    args.edge_indices = static_cast<const int64_t*>(edge_indices.GetDataPtr());
+    args.n = target_indices.GetLength();
+    return args;
+}
+
+/// Writes the moments of the correspondence workload_idx to m, and returns
+/// its edge, or -1 for a correspondence without a target point.
+OPEN3D_HOST_DEVICE inline int64_t GetInformationMoments(
+        int64_t workload_idx, const InformationMatrixArgs& args, float* m) {
+    int64_t t_idx = args.target_indices[workload_idx];
+    if (t_idx < 0) return -1;
+    const float* t = args.target_points + 3 * t_idx;
+    m[0] = 1;
+    m[1] = t[0];
+    m[2] = t[1];
+    m[3] = t[2];
+    m[4] = t[0] * t[0];
+    m[5] = t[0] * t[1];
+    m[6] = t[0] * t[2];
+    m[7] = t[1] * t[1];
+    m[8] = t[1] * t[2];
+    m[9] = t[2] * t[2];
+    return args.edge_indices[workload_idx];
+}
+
+/// Builds the Float64 information matrices of shape {E, 6, 6} on \p device
+/// from the moments of the E edges, in host memory.
+///
+/// The information matrix is the sum of G^T G over the target points p, with
+/// G = [-[p]x, I] the Jacobian of the point with respect to the pose
+/// [alpha, beta, gamma, tx, ty, tz]. This only depends on the moments:
+/// [[tr(S) I - S, [s]x], [[s]x^T, n I]] for the n points of sum s and sum of
+/// p p^T S.
+inline core::Tensor InformationMatricesFromMoments(
+        const std::vector<double>& moments,
+        int64_t num_edges,
+        const core::Device& device) {
+    std::vector<double> information(num_edges * 36, 0.0);
+    for (int64_t e = 0; e < num_edges; ++e) {
+        const double* m = moments.data() + kInformationMomentsSize * e;
+        double* info = information.data() + 36 * e;
+        const double S[3][3] = {{m[4], m[5], m[6]},
+                                {m[5], m[7], m[8]},
+                                {m[6], m[8], m[9]}};
+        const double trace = m[4] + m[7] + m[9];
+        const double cross[3][3] = {{0, -m[3], m[2]},
+                                    {m[3], 0, -m[1]},
+                                    {-m[2], m[1], 0}};
+        for (int i = 0; i < 3; ++i) {
+            for (int j = 0; j < 3; ++j) {
+                info[6 * i + j] = (i == j ? trace : 0.0) - S[i][j];
+                info[6 * i + j + 3] = cross[i][j];
+                info[6 * (j + 3) + i] = cross[i][j];
+            }
+            info[6 * (i + 3) + i + 3] = m[0];
+        }
+    }
+    return core::Tensor(information, {num_edges, 6, 6}, core::Dtype::Float64,
+                        device);
+}
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void ComputeColorGradientsCUDA
+#else
+void ComputeColorGradientsCPU
+#endif
+        (const core::Tensor& points,
+         const core::Tensor& normals,
+         const core::Tensor& colors,
+         const core::Tensor& neighbor_indices,
+         const core::Tensor& neighbor_distances,
+         double max_distance2,
+         core::Tensor& color_gradients) {
+    int64_t n = points.GetLength();
+    int64_t max_nn = neighbor_indices.GetShape(1);
+    const float* points_ptr = static_cast<const float*>(points.GetDataPtr());
+    const float* normals_ptr = static_cast<const float*>(normals.GetDataPtr());
+    const float* colors_ptr = static_cast<const float*>(colors.GetDataPtr());
+    const int64_t* indices_ptr =
+            static_cast<const int64_t*>(neighbor_indices.GetDataPtr());
+    const float* distances_ptr =
+            static_cast<const float*>(neighbor_distances.GetDataPtr());
+    float* gradients_ptr = static_cast<float*>(color_gradients.GetDataPtr());
+    float max_dist2 = max_distance2 < std::numeric_limits<float>::max()
+                              ? static_cast<float>(max_distance2)
+                              : std::numeric_limits<float>::max();
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+    core::kernel::CUDALauncher::LaunchGeneralKernel(
+            n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+#else
+    core::kernel::CPULauncher::LaunchGeneralKernel(
+            n, [&](int64_t workload_idx) {
+#endif
+                const int64_t* nb_indices = indices_ptr + workload_idx * max_nn;
+                const float* nb_distances =
+                        distances_ptr + workload_idx * max_nn;
+
+                // Neighbors are sorted by distance, so the valid ones come
+                // first and the first one is the point itself.
+                int64_t count = 0;
+                while (count < max_nn && nb_indices[count] >= 0 &&
+                       nb_distances[count] <= max_dist2) {
+                    count++;
+                }
+                if (count < 4) {
+                    return;
+                }
+
+                const float* vt = points_ptr + 3 * workload_idx;
+                const float* nt = normals_ptr + 3 * workload_idx;
+                const float* ct = colors_ptr + 3 * workload_idx;
+                float it = (ct[0] + ct[1] + ct[2]) / 3.0f;
+
+                // Normal equations A^T A x = A^T b of the rows of the
+                // neighbors and of the orthogonality constraint.
+                float AtA[6] = {0, 0, 0, 0, 0, 0};
+                float Atb[3] = {0, 0, 0};
+                for (int64_t k = 1; k < count; ++k) {
+                    const float* vt_adj = points_ptr + 3 * nb_indices[k];
+                    const float* ct_adj = colors_ptr + 3 * nb_indices[k];
+                    float d = (vt_adj[0] - vt[0]) * nt[0] +
+                              (vt_adj[1] - vt[1]) * nt[1] +
+                              (vt_adj[2] - vt[2]) * nt[2];
+                    float a[3];
+                    for (int i = 0; i < 3; ++i) {
+                        a[i] = vt_adj[i] - d * nt[i] - vt[i];
+                    }
+                    float b = (ct_adj[0] + ct_adj[1] + ct_adj[2]) / 3.0f - it;
+                    AtA[0] += a[0] * a[0];
+                    AtA[1] += a[0] * a[1];
+                    AtA[2] += a[0] * a[2];
+                    AtA[3] += a[1] * a[1];
+                    AtA[4] += a[1] * a[2];
+                    AtA[5] += a[2] * a[2];
+                    for (int i = 0; i < 3; ++i) {
+                        Atb[i] += a[i] * b;
+                    }
+                }
+                float w = static_cast<float>(count - 1);
+                AtA[0] += w * w * nt[0] * nt[0];
+                AtA[1] += w * w * nt[0] * nt[1];
+                AtA[2] += w * w * nt[0] * nt[2];
+                AtA[3] += w * w * nt[1] * nt[1];
+                AtA[4] += w * w * nt[1] * nt[2];
+                AtA[5] += w * w * nt[2] * nt[2];
+
+                // Symmetric 3x3 solve by the adjugate.
+                float c00 = AtA[3] * AtA[5] - AtA[4] * AtA[4];
+                float c01 = AtA[2] * AtA[4] - AtA[1] * AtA[5];
+                float c02 = AtA[1] * AtA[4] - AtA[2] * AtA[3];
+                float c11 = AtA[0] * AtA[5] - AtA[2] * AtA[2];
+                float c12 = AtA[1] * AtA[2] - AtA[0] * AtA[4];
+                float c22 = AtA[0] * AtA[3] - AtA[1] * AtA[1];
+                float det = AtA[0] * c00 + AtA[1] * c01 + AtA[2] * c02;
+                if (det == 0.0f) {
+                    return;
+                }
+                float* gradient = gradients_ptr + 3 * workload_idx;
+                gradient[0] =
+                        (c00 * Atb[0] + c01 * Atb[1] + c02 * Atb[2]) / det;
+                gradient[1] =
+                        (c01 * Atb[0] + c11 * Atb[1] + c12 * Atb[2]) / det;
+                gradient[2] =
+                        (c02 * Atb[0] + c12 * Atb[1] + c22 * Atb[2]) / det;
+            });
+}
+
+}  // namespace registration
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,354 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/odometry/RGBDOdometry.h"
+
+#include <Eigen/Core>
+#include <cmath>
+#include <tuple>
+#include <vector>
+
+#include "open3d/core/EigenConverter.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/pipelines/kernel/RGBDOdometry.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/Eigen.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace odometry {
+
+namespace {
+
+// Solves the accumulated Gauss-Newton system and applies the increment to
+// init_source_to_target.
+OdometryResult SolveOdometrySystem(const core::Tensor &system,
+                                   const core::Tensor &init_source_to_target,
+                                   int64_t num_pixels) {
+    std::vector<float> A =
+            system.Copy(core::Device("CPU:0")).ToFlatVector<float>();
+    std::vector<double> T_values =
+            init_source_to_target.To(core::Dtype::Float64)
+                    .Copy(core::Device("CPU:0"))
+                    .ToFlatVector<double>();
+    Eigen::Matrix4d T =
+            Eigen::Map<Eigen::Matrix<double, 4, 4, Eigen::RowMajor>>(
+                    T_values.data());
+
+    double inlier_count = A[28];
+    if (inlier_count < 6) {
+        utility::LogWarning("Too few inliers ({}) for the odometry.",
+                            inlier_count);
+        return OdometryResult(core::eigen_converter::EigenMatrixToTensor(T));
+    }
+
+    Eigen::Matrix6d JtJ;
+    Eigen::Vector6d Jtr;
+    int k = 0;
+    for (int i = 0; i < 6; ++i) {
+        for (int j = i; j < 6; ++j) {
+            JtJ(i, j) = JtJ(j, i) = A[k++];
+        }
+    }
+    for (int i = 0; i < 6; ++i) {
+        Jtr(i) = A[21 + i];
+    }
+
+    bool success;
+    Eigen::Matrix4d delta;
+    std::tie(success, delta) =
+            utility::SolveJacobianSystemAndObtainExtrinsicMatrix(JtJ, Jtr);
+    if (!success) {
+        utility::LogWarning("Singular odometry system.");
+    }
+    return OdometryResult(
+            core::eigen_converter::EigenMatrixToTensor(Eigen::Matrix4d(
+                    delta * T)),
+            std::sqrt(A[27] / inlier_count), inlier_count / num_pixels);
+}
+
+// Intensity in [0, 1] of a color image, a Float32 tensor of shape {rows,
+// cols, 1}.
+core::Tensor ColorToIntensity(const geometry::Image &color) {
+    core::Tensor color_float = color.To(core::Dtype::Float32).AsTensor();
+    if (color.GetChannels() == 1) {
+        return color_float;
+    }
+    if (color.GetChannels() != 3) {
+        utility::LogError("Color image must have 1 or 3 channels, but got {}.",
+                          color.GetChannels());
+    }
+    // Same weights as the legacy Image::CreateFloatImage.
+    core::Tensor weights(std::vector<float>{0.299f, 0.587f, 0.114f}, {3, 1},
+                         core::Dtype::Float32, color.GetDevice());
+    return color_float.Reshape({-1, 3}).Matmul(weights).Reshape(
+            {color.GetRows(), color.GetCols(), 1});
+}
+
+// Image pyramids of an RGB-D frame, from the original resolution to the
+// coarsest level.
+struct OdometryPyramid {
+    std::vector<core::Tensor> vertex_maps;
+    std::vector<core::Tensor> normal_maps;
+    std::vector<core::Tensor> intensities;
+    std::vector<core::Tensor> intensities_dx;
+    std::vector<core::Tensor> intensities_dy;
+};
+
+OdometryPyramid CreateOdometryPyramid(
+        const geometry::RGBDImage &rgbd,
+        const std::vector<core::Tensor> &intrinsics_pyramid,
+        float depth_scale,
+        float depth_max,
+        const OdometryLossParams &params,
+        bool is_target,
+        bool use_depth,
+        bool use_intensity) {
+    size_t num_levels = intrinsics_pyramid.size();
+    OdometryPyramid pyramid;
+
+    geometry::Image depth =
+            rgbd.depth_.ClipTransform(depth_scale, 0.0f, depth_max, 0.0f);
+    geometry::Image intensity;
+    if (use_intensity) {
+        intensity = geometry::Image(ColorToIntensity(rgbd.color_));
+    }
+    for (size_t level = 0; level < num_levels; ++level) {
+        if (level > 0) {
+            depth = depth.PyrDownDepth(2 * params.depth_outlier_trunc_, 0.0f);
+            if (use_intensity) {
+                intensity = intensity.PyrDown();
+            }
+        }
+
+        core::Tensor vertex_map =
+                CreateVertexMap(depth, intrinsics_pyramid[level]);
+        pyramid.vertex_maps.push_back(vertex_map);
+        if (is_target && use_depth) {
+            pyramid.normal_maps.push_back(CreateNormalMap(vertex_map));
+        }
+        if (use_intensity) {
+            pyramid.intensities.push_back(intensity.AsTensor());
+            if (is_target) {
+                geometry::Image dx, dy;
+                std::tie(dx, dy) = intensity.FilterSobel(3);
+                pyramid.intensities_dx.push_back(dx.AsTensor());
+                pyramid.intensities_dy.push_back(dy.AsTensor());
+            }
+        }
+    }
+    return pyramid;
+}
+
+}  // namespace
+
+OdometryResult RGBDOdometryMultiScale(
+        const geometry::RGBDImage &source,
+        const geometry::RGBDImage &target,
+        const core::Tensor &intrinsics,
+        const core::Tensor &init_source_to_target,
+        float depth_scale,
+        float depth_max,
+        const std::vector<OdometryConvergenceCriteria> &criteria_list,
+        Method method,
+        const OdometryLossParams &params) {
+    if (criteria_list.empty()) {
+        utility::LogError("At least one pyramid level is required.");
+    }
+    if (source.depth_.GetRows() != target.depth_.GetRows() ||
+        source.depth_.GetCols() != target.depth_.GetCols()) {
+        utility::LogError("Source and target images must have the same size.");
+    }
+    if (source.depth_.GetDevice() != target.depth_.GetDevice()) {
+        utility::LogError(
+                "Source device {} != Target device {}.",
+                source.depth_.GetDevice().ToString(),
+                target.depth_.GetDevice().ToString());
+    }
+    intrinsics.AssertShape({3, 3});
+    init_source_to_target.AssertShape({4, 4});
+
+    bool use_depth = method != Method::Intensity;
+    bool use_intensity = method != Method::PointToPlane;
+
+    // The pixels with even coordinates are kept by each level, so the
+    // intrinsics are halved.
+    size_t num_levels = criteria_list.size();
+    std::vector<core::Tensor> intrinsics_pyramid;
+    intrinsics_pyramid.push_back(
+            intrinsics.To(core::Dtype::Float64).Copy(core::Device("CPU:0")));
+    for (size_t level = 1; level < num_levels; ++level) {
+        core::Tensor K = intrinsics_pyramid.back().Div(2.0);
+        K[2][2] = 1.0;
+        intrinsics_pyramid.push_back(K);
+    }
+
+    OdometryPyramid source_pyramid =
+            CreateOdometryPyramid(source, intrinsics_pyramid, depth_scale,
+                                  depth_max, params, false, use_depth,
+                                  use_intensity);
+    OdometryPyramid target_pyramid =
+            CreateOdometryPyramid(target, intrinsics_pyramid, depth_scale,
+                                  depth_max, params, true, use_depth,
+                                  use_intensity);
+
+    OdometryResult result(init_source_to_target.To(core::Dtype::Float64)
+                                  .Copy(core::Device("CPU:0")));
+    for (size_t i = 0; i < num_levels; ++i) {
+        size_t level = num_levels - 1 - i;
+        const OdometryConvergenceCriteria &criteria = criteria_list[i];
+        for (int iteration = 0; iteration < criteria.max_iteration_;
+             ++iteration) {
+            OdometryResult prev_result = result;
+            if (method == Method::PointToPlane) {
+                result = ComputeOdometryResultPointToPlane(
+                        source_pyramid.vertex_maps[level],
+                        target_pyramid.vertex_maps[level],
+                        target_pyramid.normal_maps[level],
+                        intrinsics_pyramid[level], result.transformation_,
+                        params);
+            } else if (method == Method::Intensity) {
+                result = ComputeOdometryResultIntensity(
+                        source_pyramid.vertex_maps[level],
+                        source_pyramid.intensities[level],
+                        target_pyramid.vertex_maps[level],
+                        target_pyramid.intensities[level],
+                        target_pyramid.intensities_dx[level],
+                        target_pyramid.intensities_dy[level],
+                        intrinsics_pyramid[level], result.transformation_,
+                        params);
+            } else {
+                result = ComputeOdometryResultHybrid(
+                        source_pyramid.vertex_maps[level],
+                        source_pyramid.intensities[level],
+                        target_pyramid.vertex_maps[level],
+                        target_pyramid.normal_maps[level],
+                        target_pyramid.intensities[level],
+                        target_pyramid.intensities_dx[level],
+                        target_pyramid.intensities_dy[level],
+                        intrinsics_pyramid[level], result.transformation_,
+                        params);
+            }
+            utility::LogDebug(
+                    "Odometry level {} iteration {}: fitness {:.6f}, RMSE "
+                    "{:.6f}.",
+                    level, iteration, result.fitness_, result.inlier_rmse_);
+
+            if (iteration > 0 &&
+                std::abs(prev_result.fitness_ - result.fitness_) <
+                        criteria.relative_fitness_ &&
+                std::abs(prev_result.inlier_rmse_ - result.inlier_rmse_) <
+                        criteria.relative_rmse_) {
+                break;
+            }
+        }
+    }
+    return result;
+}
+
+OdometryResult ComputeOdometryResultPointToPlane(
+        const core::Tensor &source_vertex_map,
+        const core::Tensor &target_vertex_map,
+        const core::Tensor &target_normal_map,
+        const core::Tensor &intrinsics,
+        const core::Tensor &init_source_to_target,
+        const OdometryLossParams &params) {
+    core::Tensor system;
+    kernel::odometry::ComputeOdometrySystem(
+            source_vertex_map, core::Tensor(), target_vertex_map,
+            target_normal_map, core::Tensor(), core::Tensor(), core::Tensor(),
+            intrinsics, init_source_to_target, system,
+            params.depth_outlier_trunc_, params.depth_huber_delta_,
+            params.intensity_huber_delta_);
+    return SolveOdometrySystem(system, init_source_to_target,
+                               source_vertex_map.GetShape(0) *
+                                       source_vertex_map.GetShape(1));
+}
+
+OdometryResult ComputeOdometryResultIntensity(
+        const core::Tensor &source_vertex_map,
+        const core::Tensor &source_intensity,
+        const core::Tensor &target_vertex_map,
+        const core::Tensor &target_intensity,
+        const core::Tensor &target_intensity_dx,
+        const core::Tensor &target_intensity_dy,
+        const core::Tensor &intrinsics,
+        const core::Tensor &init_source_to_target,
+        const OdometryLossParams &params) {
+    core::Tensor system;
+    kernel::odometry::ComputeOdometrySystem(
+            source_vertex_map, source_intensity, target_vertex_map,
+            core::Tensor(), target_intensity, target_intensity_dx,
+            target_intensity_dy, intrinsics, init_source_to_target, system,
+            params.depth_outlier_trunc_, params.depth_huber_delta_,
+            params.intensity_huber_delta_);
+    return SolveOdometrySystem(system, init_source_to_target,
+                               source_vertex_map.GetShape(0) *
+                                       source_vertex_map.GetShape(1));
+}
+
+OdometryResult ComputeOdometryResultHybrid(
+        const core::Tensor &source_vertex_map,
+        const core::Tensor &source_intensity,
+        const core::Tensor &target_vertex_map,
+        const core::Tensor &target_normal_map,
+        const core::Tensor &target_intensity,
+        const core::Tensor &target_intensity_dx,
+        const core::Tensor &target_intensity_dy,
+        const core::Tensor &intrinsics,
+        const core::Tensor &init_source_to_target,
+        const OdometryLossParams &params) {
+    core::Tensor system;
+    kernel::odometry::ComputeOdometrySystem(
+            source_vertex_map, source_intensity, target_vertex_map,
+            target_normal_map, target_intensity, target_intensity_dx,
+            target_intensity_dy, intrinsics, init_source_to_target, system,
+            params.depth_outlier_trunc_, params.depth_huber_delta_,
+            params.intensity_huber_delta_);
+    return SolveOdometrySystem(system, init_source_to_target,
+                               source_vertex_map.GetShape(0) *
+                                       source_vertex_map.GetShape(1));
+}
+
+core::Tensor CreateVertexMap(const geometry::Image &depth,
+                             const core::Tensor &intrinsics) {
+    core::Tensor vertex_map;
+    kernel::odometry::CreateVertexMap(depth.AsTensor(), intrinsics,
+                                      vertex_map);
+    return vertex_map;
+}
+
+core::Tensor CreateNormalMap(const core::Tensor &vertex_map) {
+    core::Tensor normal_map;
+    kernel::odometry::CreateNormalMap(vertex_map, normal_map);
+    return normal_map;
+}
+
+}  // namespace odometry
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
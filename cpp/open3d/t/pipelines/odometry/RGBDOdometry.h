@@ -0,0 +1,223 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/Image.h"
+#include "open3d/t/geometry/RGBDImage.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace odometry {
+
+/// Residuals minimized by the RGB-D odometry.
+enum class Method {
+    /// Distance of the source points to the tangent planes of the target
+    /// points.
+    PointToPlane,
+    /// Difference of the source and target intensities.
+    Intensity,
+    /// Both residuals, weighted as in the legacy hybrid odometry.
+    Hybrid
+};
+
+/// \class OdometryConvergenceCriteria
+///
+/// \brief Convergence criteria of one pyramid level of the odometry.
+class OdometryConvergenceCriteria {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// The iterations stop if the relative change of fitness and rmse hit
+    /// \p relative_fitness and \p relative_rmse individually, or the
+    /// iteration number exceeds \p max_iteration.
+    OdometryConvergenceCriteria(int max_iteration,
+                                double relative_rmse = 1e-6,
+                                double relative_fitness = 1e-6)
+        : max_iteration_(max_iteration),
+          relative_rmse_(relative_rmse),
+          relative_fitness_(relative_fitness) {}
+
+public:
+    /// Maximum number of iterations.
+    int max_iteration_;
+    /// If relative change (difference) of inlier RMSE score is lower than
+    /// `relative_rmse`, the iteration stops.
+    double relative_rmse_;
+    /// If relative change (difference) of fitness score is lower than
+    /// `relative_fitness`, the iteration stops.
+    double relative_fitness_;
+};
+
+/// \class OdometryResult
+///
+/// \brief Result of the odometry.
+class OdometryResult {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param transformation The estimated transformation matrix.
+    /// \param inlier_rmse RMSE of the inlier residuals.
+    /// \param fitness Ratio of the inlier pixels.
+    OdometryResult(const core::Tensor &transformation = core::Tensor::Eye(
+                           4, core::Dtype::Float64, core::Device("CPU:0")),
+                   double inlier_rmse = 0.0,
+                   double fitness = 0.0)
+        : transformation_(transformation),
+          inlier_rmse_(inlier_rmse),
+          fitness_(fitness) {}
+
+public:
+    /// The estimated source to target transformation, a Float64 tensor of
+    /// shape {4, 4} on CPU.
+    core::Tensor transformation_;
+    /// RMSE of the Huber-weighted inlier residuals. Lower is better.
+    double inlier_rmse_;
+    /// Ratio of the source pixels with an inlier residual. Higher is better.
+    double fitness_;
+};
+
+/// \class OdometryLossParams
+///
+/// \brief Thresholds of the odometry residuals.
+class OdometryLossParams {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param depth_outlier_trunc Correspondences with a larger point-to-plane
+    /// or depth difference, in meters, are outliers.
+    /// \param depth_huber_delta Huber threshold of the point-to-plane
+    /// residuals, in meters.
+    /// \param intensity_huber_delta Huber threshold of the intensity residuals,
+    /// in [0, 1].
+    OdometryLossParams(float depth_outlier_trunc = 0.07f,
+                       float depth_huber_delta = 0.05f,
+                       float intensity_huber_delta = 0.1f)
+        : depth_outlier_trunc_(depth_outlier_trunc),
+          depth_huber_delta_(depth_huber_delta),
+          intensity_huber_delta_(intensity_huber_delta) {}
+
+public:
+    float depth_outlier_trunc_;
+    float depth_huber_delta_;
+    float intensity_huber_delta_;
+};
+
+/// \brief Estimates the rigid transformation from the source to the target
+/// RGB-D image by coarse to fine Gauss-Newton iterations over image pyramids.
+///
+/// Each iteration accumulates its 6x6 linear system in a single reduction
+/// kernel and solves it on host.
+///
+/// \param source The source RGB-D image, with a UInt16 or Float32 depth image
+/// and a UInt8 or Float32 color image.
+/// \param target The target RGB-D image, of the same size and device.
+/// \param intrinsics Camera intrinsic matrix of shape {3, 3}.
+/// \param init_source_to_target Initial transformation of shape {4, 4}.
+/// \param depth_scale The depth is scaled by 1 / \p depth_scale.
+/// \param depth_max Larger depths are invalid.
+/// \param criteria_list Convergence criteria of each pyramid level, from the
+/// coarsest to the original resolution. Its size is the number of levels.
+/// \param method Residuals to minimize.
+/// \param params Thresholds of the residuals.
+OdometryResult RGBDOdometryMultiScale(
+        const geometry::RGBDImage &source,
+        const geometry::RGBDImage &target,
+        const core::Tensor &intrinsics,
+        const core::Tensor &init_source_to_target = core::Tensor::Eye(
+                4, core::Dtype::Float64, core::Device("CPU:0")),
+        float depth_scale = 1000.0f,
+        float depth_max = 3.0f,
+        const std::vector<OdometryConvergenceCriteria> &criteria_list = {10, 5,
+                                                                        3},
+        Method method = Method::Hybrid,
+        const OdometryLossParams &params = OdometryLossParams());
+
+/// \brief One Gauss-Newton iteration of the point-to-plane odometry.
+///
+/// \param source_vertex_map Float32 {rows, cols, 3} source vertex map, see
+/// CreateVertexMap.
+/// \param target_vertex_map Float32 {rows, cols, 3} target vertex map.
+/// \param target_normal_map Float32 {rows, cols, 3} target normal map, see
+/// CreateNormalMap.
+/// \param intrinsics Camera intrinsic matrix of shape {3, 3}.
+/// \param init_source_to_target Transformation of shape {4, 4} to refine.
+/// \return The refined transformation and the residuals of
+/// \p init_source_to_target.
+OdometryResult ComputeOdometryResultPointToPlane(
+        const core::Tensor &source_vertex_map,
+        const core::Tensor &target_vertex_map,
+        const core::Tensor &target_normal_map,
+        const core::Tensor &intrinsics,
+        const core::Tensor &init_source_to_target,
+        const OdometryLossParams &params = OdometryLossParams());
+
+/// \brief One Gauss-Newton iteration of the photometric odometry.
+///
+/// The intensities are Float32 {rows, cols, 1} images, and the gradients of
+/// the target intensity are given by Image::FilterSobel(3).
+OdometryResult ComputeOdometryResultIntensity(
+        const core::Tensor &source_vertex_map,
+        const core::Tensor &source_intensity,
+        const core::Tensor &target_vertex_map,
+        const core::Tensor &target_intensity,
+        const core::Tensor &target_intensity_dx,
+        const core::Tensor &target_intensity_dy,
+        const core::Tensor &intrinsics,
+        const core::Tensor &init_source_to_target,
+        const OdometryLossParams &params = OdometryLossParams());
+
+/// \brief One Gauss-Newton iteration of the hybrid odometry, combining the
+/// point-to-plane and intensity residuals.
+OdometryResult ComputeOdometryResultHybrid(
+        const core::Tensor &source_vertex_map,
+        const core::Tensor &source_intensity,
+        const core::Tensor &target_vertex_map,
+        const core::Tensor &target_normal_map,
+        const core::Tensor &target_intensity,
+        const core::Tensor &target_intensity_dx,
+        const core::Tensor &target_intensity_dy,
+        const core::Tensor &intrinsics,
+        const core::Tensor &init_source_to_target,
+        const OdometryLossParams &params = OdometryLossParams());
+
+/// \brief Unprojects a Float32 depth image in meters to a Float32 vertex map
+/// of shape {rows, cols, 3}. The invalid vertices are zero.
+core::Tensor CreateVertexMap(const geometry::Image &depth,
+                             const core::Tensor &intrinsics);
+
+/// \brief Computes the Float32 unit normal map of shape {rows, cols, 3} of a
+/// vertex map. The normals of the vertices with an invalid neighbor are zero.
+core::Tensor CreateNormalMap(const core::Tensor &vertex_map);
+
+}  // namespace odometry
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
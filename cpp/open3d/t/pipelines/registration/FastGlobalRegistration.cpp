@@ -0,0 +1,256 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/t/pipelines/registration/FastGlobalRegistration.h"
+
+#include <Eigen/Core>
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include "open3d/core/EigenConverter.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/pipelines/kernel/GlobalRegistration.h"
+#include "open3d/t/pipelines/kernel/TransformationEstimation.h"
+#include "open3d/t/pipelines/registration/Feature.h"
+#include "open3d/t/pipelines/registration/Registration.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/Eigen.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace registration {
+
+/// Minimum number of trials tested by one kernel launch.
+static constexpr int64_t kMinTupleBatchSize = 1 << 16;
+
+/// Returns the indices into the correspondences of the accepted tuples, three
+/// per tuple, in the order they are drawn. Trials are drawn on the host and
+/// tested in batches on the device of the points.
+static std::vector<int64_t> SelectTuples(
+        const core::Tensor &source_points,
+        const core::Tensor &target_points,
+        const core::Tensor &source_indices,
+        const core::Tensor &target_indices,
+        const FastGlobalRegistrationOption &option) {
+    core::Device device = source_points.GetDevice();
+    int64_t num_corres = source_indices.NumElements();
+    int64_t number_of_trial = num_corres * 100;
+    size_t max_tuple_indices =
+            3 * static_cast<size_t>(std::max(option.maximum_tuple_count_, 0));
+    int64_t batch = std::max<int64_t>(
+            4 * static_cast<int64_t>(option.maximum_tuple_count_),
+            kMinTupleBatchSize);
+
+    std::mt19937 engine(std::random_device{}());
+    std::uniform_int_distribution<int64_t> distribution(0, num_corres - 1);
+    std::vector<int64_t> samples;
+    std::vector<int64_t> tuples;
+    int64_t itr = 0;
+    while (itr < number_of_trial && tuples.size() < max_tuple_indices) {
+        int64_t batch_size = std::min(batch, number_of_trial - itr);
+        samples.resize(batch_size * 3);
+        for (int64_t &sample : samples) {
+            sample = distribution(engine);
+        }
+        core::Tensor samples_device(samples, {batch_size, 3},
+                                    core::Dtype::Int64, device);
+        core::Tensor valid;
+        kernel::registration::CheckFGRTuples(
+                source_points, target_points, source_indices, target_indices,
+                samples_device, option.tuple_scale_, valid);
+        itr += batch_size;
+
+        std::vector<int64_t> accepted =
+                samples_device.IndexGet({valid}).ToFlatVector<int64_t>();
+        size_t count =
+                std::min(accepted.size(), max_tuple_indices - tuples.size());
+        tuples.insert(tuples.end(), accepted.begin(), accepted.begin() + count);
+    }
+    utility::LogDebug("{:d} tuples ({:d} trial, {:d} actual).",
+                      tuples.size() / 3, number_of_trial, itr);
+    return tuples;
+}
+
+/// Solves the 6x6 system of ComputeFGRSystem on the host. A singular system
+/// gives the identity.
+static Eigen::Matrix4d SolveFGRSystem(const core::Tensor &system) {
+    std::vector<float> A = system.ToFlatVector<float>();
+    Eigen::Matrix6d JtJ;
+    Eigen::Vector6d Jtr;
+    int k = 0;
+    for (int i = 0; i < 6; ++i) {
+        for (int j = i; j < 6; ++j) {
+            JtJ(i, j) = JtJ(j, i) = A[k++];
+        }
+    }
+    for (int i = 0; i < 6; ++i) {
+        Jtr(i) = A[21 + i];
+    }
+
+    bool success;
+    Eigen::VectorXd x;
+    std::tie(success, x) = utility::SolveLinearSystemPSD(JtJ, -Jtr);
+    if (!success) {
+        utility::LogWarning("Singular Fast Global Registration system.");
+        return Eigen::Matrix4d::Identity();
+    }
+    return utility::TransformVector6dToMatrix4d(x);
+}
+
+/// Maximum squared distance of the points to their mean.
+static double MaxDistance2(const core::Tensor &points,
+                           const core::Tensor &mean) {
+    core::Tensor diff = points - mean;
+    return static_cast<double>(diff.Mul_(diff).Sum({1}).Max({0}).Item<float>());
+}
+
+static Eigen::Vector3d TensorToVector3d(const core::Tensor &tensor) {
+    std::vector<float> values = tensor.ToFlatVector<float>();
+    return Eigen::Vector3d(values[0], values[1], values[2]);
+}
+
+RegistrationResult FastGlobalRegistrationBasedOnCorrespondence(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const CorrespondenceSet &corres,
+        const FastGlobalRegistrationOption &option) {
+    core::Device device = source.GetDevice();
+    core::Dtype dtype = core::Dtype::Float32;
+    source.GetPoints().AssertDtype(dtype);
+    target.GetPoints().AssertDtype(dtype);
+    if (target.GetDevice() != device) {
+        utility::LogError(
+                "Target Pointcloud device {} != Source Pointcloud's device {}.",
+                target.GetDevice().ToString(), device.ToString());
+    }
+
+    core::Tensor source_points = source.GetPoints().Contiguous();
+    core::Tensor target_points = target.GetPoints().Contiguous();
+    core::Tensor source_indices = corres.first.Copy(device);
+    core::Tensor target_indices = corres.second.Copy(device);
+    core::Tensor identity = core::Tensor::Eye(4, dtype, device);
+    if (source_indices.NumElements() == 0 || source_points.GetLength() == 0 ||
+        target_points.GetLength() == 0) {
+        return RegistrationResult(identity);
+    }
+
+    // STEP 1) TUPLE CONSTRAINT
+    std::vector<int64_t> tuples =
+            SelectTuples(source_points, target_points, source_indices,
+                         target_indices, option);
+    if (tuples.size() < 10) {
+        return EvaluateRegistration(source, target,
+                                    option.maximum_correspondence_distance_,
+                                    identity);
+    }
+    core::Tensor tuples_device(tuples, {static_cast<int64_t>(tuples.size())},
+                               core::Dtype::Int64, device);
+
+    // STEP 2) NORMALIZATION, X' = (X - mean) / scale
+    // Only the points of the tuples are normalized; the point clouds are only
+    // reduced to their means and scales.
+    core::Tensor source_mean = source_points.Mean({0});
+    core::Tensor target_mean = target_points.Mean({0});
+    double scale = std::sqrt(
+            std::max(MaxDistance2(source_points, source_mean),
+                     MaxDistance2(target_points, target_mean)));
+    double scale_global = option.use_absolute_scale_ ? 1.0 : scale;
+    utility::LogDebug("normalize points :: global scale : {:f}", scale_global);
+
+    core::Tensor source_tuples =
+            source_points.IndexGet({source_indices.IndexGet({tuples_device})});
+    core::Tensor target_tuples =
+            target_points.IndexGet({target_indices.IndexGet({tuples_device})});
+    geometry::PointCloud source_normalized(
+            (source_tuples - source_mean)
+                    .Div_(static_cast<float>(scale_global)));
+    target_tuples = (target_tuples - target_mean)
+                            .Div_(static_cast<float>(scale_global));
+
+    // STEP 3) GRADUATED NON-CONVEXITY
+    // The source tuples are moved to the target tuples, so the result needs
+    // no inversion.
+    utility::LogDebug("Pairwise rigid pose optimization");
+    Eigen::Matrix4d transformation = Eigen::Matrix4d::Identity();
+    double mu = scale_global;
+    for (int itr = 0; itr < option.iteration_number_; itr++) {
+        core::Tensor system;
+        kernel::registration::ComputeFGRSystem(
+                source_normalized.GetPoints().Contiguous(), target_tuples, mu,
+                system);
+        Eigen::Matrix4d delta = SolveFGRSystem(system);
+        transformation = delta * transformation;
+        source_normalized.Transform(
+                core::eigen_converter::EigenMatrixToTensor(delta)
+                        .To(dtype)
+                        .Copy(device));
+
+        if (option.decrease_mu_) {
+            if (itr % 4 == 0 && mu > option.maximum_correspondence_distance_) {
+                mu /= option.division_factor_;
+            }
+        }
+    }
+
+    // Back to the original scale: R (x - mean_s) + scale t + mean_t.
+    Eigen::Matrix3d R = transformation.block<3, 3>(0, 0);
+    Eigen::Vector3d t = transformation.block<3, 1>(0, 3);
+    Eigen::Matrix4d result = Eigen::Matrix4d::Identity();
+    result.block<3, 3>(0, 0) = R;
+    result.block<3, 1>(0, 3) = -R * TensorToVector3d(source_mean) +
+                               t * scale_global +
+                               TensorToVector3d(target_mean);
+    return EvaluateRegistration(
+            source, target, option.maximum_correspondence_distance_,
+            core::eigen_converter::EigenMatrixToTensor(result)
+                    .To(dtype)
+                    .Copy(device));
+}
+
+RegistrationResult FastGlobalRegistration(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const core::Tensor &source_features,
+        const core::Tensor &target_features,
+        const FastGlobalRegistrationOption &option) {
+    // The cross check of the legacy implementation keeps the mutual nearest
+    // neighbors of the features.
+    CorrespondenceSet corres = CorrespondencesFromFeatures(
+            source_features, target_features, true);
+    utility::LogDebug("points are remained : {:d}", corres.first.GetLength());
+    return FastGlobalRegistrationBasedOnCorrespondence(source, target, corres,
+                                                        option);
+}
+
+}  // namespace registration
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
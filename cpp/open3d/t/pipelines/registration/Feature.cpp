@@ -0,0 +1,173 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/t/pipelines/registration/Feature.h"
+
+#include <algorithm>
+#include <limits>
+#include <tuple>
+
+#include "open3d/core/nns/NearestNeighborSearch.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/pipelines/kernel/Feature.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace registration {
+
+core::Tensor ComputeFPFHFeature(const geometry::PointCloud &input,
+                                int max_nn,
+                                utility::optional<double> radius) {
+    if (!input.HasPointNormals()) {
+        utility::LogError(
+                "[ComputeFPFHFeature] Failed because input point cloud has no "
+                "normal.");
+    }
+    if (max_nn < 1) {
+        utility::LogError(
+                "[ComputeFPFHFeature] max_nn must be positive, but got {}.",
+                max_nn);
+    }
+    if (radius.has_value() && radius.value() <= 0) {
+        utility::LogError(
+                "[ComputeFPFHFeature] radius must be positive, but got {}.",
+                radius.value());
+    }
+
+    core::Tensor points = input.GetPoints().Contiguous();
+    core::Dtype dtype = points.GetDtype();
+    core::Tensor normals = input.GetPointNormals().To(dtype).Contiguous();
+    int64_t n = points.GetLength();
+    if (n == 0) {
+        return core::Tensor::Zeros({0, kernel::registration::kFPFHDimension},
+                                   dtype, points.GetDevice());
+    }
+
+    // The knn search is native on both CPU and CUDA; the radius limit of a
+    // hybrid search is applied by the kernel.
+    core::nns::NearestNeighborSearch nns(points);
+    nns.KnnIndex();
+    core::Tensor indices, distances;
+    int knn = static_cast<int>(std::min<int64_t>(max_nn, n));
+    std::tie(indices, distances) = nns.KnnSearch(points, knn);
+    double max_distance2 = radius.has_value()
+                                   ? radius.value() * radius.value()
+                                   : std::numeric_limits<double>::max();
+
+    core::Tensor fpfh;
+    kernel::registration::ComputeFPFHFeature(
+            points, normals, indices.Contiguous(), distances.Contiguous(),
+            max_distance2, fpfh);
+    return fpfh;
+}
+
+/// Maximum number of elements of the inner product matrix of a tile.
+static constexpr int64_t kMaxTileElements = 1 << 24;
+
+std::tuple<core::Tensor, core::Tensor> FeatureKnnSearch(
+        const core::Tensor &query_features,
+        const core::Tensor &dataset_features,
+        int knn) {
+    core::Device device = query_features.GetDevice();
+    core::Dtype dtype = query_features.GetDtype();
+    if (dtype != core::Dtype::Float32 && dtype != core::Dtype::Float64) {
+        utility::LogError(
+                "[FeatureKnnSearch] Features must be Float32 or Float64, but "
+                "got {}.",
+                dtype.ToString());
+    }
+    query_features.AssertShapeCompatible({utility::nullopt, utility::nullopt});
+    dataset_features.AssertShapeCompatible(
+            {utility::nullopt, query_features.GetShape(1)});
+    dataset_features.AssertDtype(dtype);
+    dataset_features.AssertDevice(device);
+    if (knn < 1) {
+        utility::LogError(
+                "[FeatureKnnSearch] knn must be positive, but got {}.", knn);
+    }
+    int64_t num_queries = query_features.GetLength();
+    int64_t num_dataset = dataset_features.GetLength();
+    if (num_dataset == 0) {
+        utility::LogError("[FeatureKnnSearch] Dataset features are empty.");
+    }
+
+    int64_t k = std::min<int64_t>(knn, num_dataset);
+    core::Tensor indices =
+            core::Tensor::Empty({num_queries, k}, core::Dtype::Int64, device);
+    core::Tensor distances =
+            core::Tensor::Empty({num_queries, k}, dtype, device);
+
+    core::Tensor queries = query_features.Contiguous();
+    core::Tensor dataset_t = dataset_features.ToChannelFirst();
+    core::Tensor query_norms2 = (queries * queries).Sum({1});
+    core::Tensor dataset_norms2 = (dataset_t * dataset_t).Sum({0});
+    int64_t tile_size = std::max<int64_t>(1, kMaxTileElements / num_dataset);
+    for (int64_t start = 0; start < num_queries; start += tile_size) {
+        int64_t stop = std::min(start + tile_size, num_queries);
+        core::Tensor inner_products =
+                queries.Slice(0, start, stop).Matmul(dataset_t);
+        core::Tensor tile_indices = indices.Slice(0, start, stop);
+        core::Tensor tile_distances = distances.Slice(0, start, stop);
+        kernel::registration::KnnFromInnerProducts(
+                inner_products, query_norms2.Slice(0, start, stop),
+                dataset_norms2, k, tile_indices, tile_distances);
+    }
+    return std::make_tuple(indices, distances);
+}
+
+CorrespondenceSet CorrespondencesFromFeatures(
+        const core::Tensor &source_features,
+        const core::Tensor &target_features,
+        bool mutual_filter) {
+    core::Device device = source_features.GetDevice();
+    int64_t num_source = source_features.GetLength();
+    core::Tensor source_to_target;
+    std::tie(source_to_target, std::ignore) =
+            FeatureKnnSearch(source_features, target_features, 1);
+    source_to_target = source_to_target.Reshape({-1});
+    core::Tensor source_indices = core::Tensor::Arange(
+            0, num_source, 1, core::Dtype::Int64, device);
+    if (!mutual_filter) {
+        return std::make_pair(source_indices, source_to_target);
+    }
+
+    core::Tensor target_to_source;
+    std::tie(target_to_source, std::ignore) =
+            FeatureKnnSearch(target_features, source_features, 1);
+    core::Tensor mutual = target_to_source.Reshape({-1})
+                                  .IndexGet({source_to_target})
+                                  .Eq(source_indices);
+    return std::make_pair(source_indices.IndexGet({mutual}),
+                          source_to_target.IndexGet({mutual}));
+}
+
+}  // namespace registration
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,102 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <tuple>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/t/pipelines/registration/TransformationEstimation.h"
+#include "open3d/utility/Optional.h"
+
+namespace open3d {
+namespace t {
+
+namespace geometry {
+class PointCloud;
+}
+
+namespace pipelines {
+namespace registration {
+
+/// \brief Function to compute FPFH feature for a point cloud, on its device.
+///
+/// The neighbors of the points are searched once and shared by the SPFH and
+/// FPFH passes. The features match the legacy ComputeFPFHFeature with the
+/// same neighbors.
+///
+/// \param input The Input point cloud, with normals.
+/// \param max_nn Maximum number of neighbors of each point, including the
+/// point itself.
+/// \param radius If given, neighbors farther than \p radius are ignored, as in
+/// a hybrid search.
+/// \return Tensor of shape {N, 33} with the dtype of the points, one row per
+/// point.
+core::Tensor ComputeFPFHFeature(
+        const geometry::PointCloud &input,
+        int max_nn = 100,
+        utility::optional<double> radius = utility::nullopt);
+
+/// \brief Function to find the \p knn nearest neighbors of features, such as
+/// FPFH features, by a batched brute-force search on their device.
+///
+/// The queries are processed in tiles: the inner products of a tile with all
+/// the dataset features come from one matrix multiplication, from which a
+/// kernel selects the nearest neighbors of each query.
+///
+/// \param query_features Float32 or Float64 features of shape {Q, D}.
+/// \param dataset_features Features of shape {M, D}, with the dtype and
+/// device of the queries.
+/// \param knn Number of neighbors. At most M neighbors are returned.
+/// \return Int64 indices of shape {Q, knn} sorted by distance, and the
+/// squared distances of shape {Q, knn}.
+std::tuple<core::Tensor, core::Tensor> FeatureKnnSearch(
+        const core::Tensor &query_features,
+        const core::Tensor &dataset_features,
+        int knn = 1);
+
+/// \brief Function to find correspondences between the points of two point
+/// clouds from the nearest neighbors of their features.
+///
+/// Each source point is matched to the target point of its nearest feature.
+/// With the mutual filter, a pair is kept only if the source point is also
+/// the nearest neighbor of the target point in feature space.
+///
+/// \param source_features Features of the source points of shape {N, D}.
+/// \param target_features Features of the target points of shape {M, D}.
+/// \param mutual_filter Keep only mutually nearest pairs.
+/// \return Correspondences as Int64 source and target indices of shape {K},
+/// for RegistrationRANSACBasedOnCorrespondence.
+CorrespondenceSet CorrespondencesFromFeatures(
+        const core::Tensor &source_features,
+        const core::Tensor &target_features,
+        bool mutual_filter = false);
+
+}  // namespace registration
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -26,23 +26,60 @@
 
 #include "open3d/t/pipelines/registration/Registration.h"
 
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <tuple>
+#include <utility>
+#include <vector>
+
 #include "open3d/core/Tensor.h"
 #include "open3d/core/nns/NearestNeighborSearch.h"
 #include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/pipelines/kernel/GlobalRegistration.h"
+#include "open3d/t/pipelines/kernel/TransformationEstimation.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/Helper.h"
+#include "open3d/utility/Timer.h"
+#include "open3d/utility/Trace.h"
 
 namespace open3d {
 namespace t {
 namespace pipelines {
 namespace registration {
 
+/// Builds the hybrid search index of the target, only needed for positive
+/// correspondence distances. On CPU, the spatial hash table is sized for
+/// \p max_correspondence_distance.
+static void SetTargetIndex(open3d::core::nns::NearestNeighborSearch &target_nns,
+                           double max_correspondence_distance) {
+    if (max_correspondence_distance <= 0.0) {
+        return;
+    }
+    bool check = target_nns.HybridIndex(max_correspondence_distance);
+    if (!check) {
+        utility::LogError(
+                "[Tensor: EvaluateRegistration: "
+                "GetRegistrationResultAndCorrespondences: "
+                "NearestNeighborSearch::HybridSearch] "
+                "Index is not set.");
+    }
+}
+
+/// Returns the result of the transformation, with the correspondences of
+/// \p source in \p target. If \p fixed_shape is true, correspondence_set_
+/// holds the target index of every source point, -1 for the points without a
+/// correspondence, and correspondence_select_bool_ is left empty. The shapes
+/// then only depend on the number of source points, and the fitness and RMSE
+/// are reduced in one pass with a single device to host copy.
 static RegistrationResult GetRegistrationResultAndCorrespondences(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
         open3d::core::nns::NearestNeighborSearch &target_nns,
         double max_correspondence_distance,
-        const core::Tensor &transformation) {
+        const core::Tensor &transformation,
+        bool fixed_shape = false) {
+    OPEN3D_TRACE_SCOPE("t::ICP::Correspondence");
     core::Device device = source.GetDevice();
     core::Dtype dtype = core::Dtype::Float32;
     source.GetPoints().AssertDtype(dtype);
@@ -66,14 +103,6 @@ static RegistrationResult GetRegistrationResultAndCorrespondences(
         return result;
     }
 
-    bool check = target_nns.HybridIndex();
-    if (!check) {
-        utility::LogError(
-                "[Tensor: EvaluateRegistration: "
-                "GetRegistrationResultAndCorrespondences: "
-                "NearestNeighborSearch::HybridSearch] "
-                "Index is not set.");
-    }
     // max_correspondece_dist in HybridSearch tensor implementation
     // is square root of that used in legacy implementation.
     max_correspondence_distance =
@@ -82,6 +111,26 @@ static RegistrationResult GetRegistrationResultAndCorrespondences(
     std::pair<core::Tensor, core::Tensor> result_nns = target_nns.HybridSearch(
             source.GetPoints(), max_correspondence_distance, 1);
 
+    if (fixed_shape) {
+        // Sum the inlier counts and the distances of the inliers, as the
+        // distances of the other points are -1.
+        int64_t n = result_nns.first.GetLength();
+        core::Tensor valid = result_nns.first.Ne(-1).To(dtype);
+        core::Tensor terms({n, 2}, dtype, device);
+        terms.Slice(1, 0, 1) = valid;
+        terms.Slice(1, 1, 2) = result_nns.second.Mul(valid);
+        std::vector<float> sums = terms.Sum({0})
+                                          .Copy(core::Device("CPU:0"))
+                                          .ToFlatVector<float>();
+        result.correspondence_set_ = result_nns.first.Reshape({-1});
+        result.fitness_ =
+                static_cast<double>(sums[0]) / static_cast<double>(n);
+        result.inlier_rmse_ = std::sqrt(static_cast<double>(sums[1]) /
+                                        static_cast<double>(sums[0]));
+        result.transformation_ = transformation;
+        return result;
+    }
+
     result.correspondence_select_bool_ =
             (result_nns.first.Ne(-1)).Reshape({-1});
     result.correspondence_set_ =
@@ -105,10 +154,163 @@ static RegistrationResult GetRegistrationResultAndCorrespondences(
     return result;
 }
 
+/// Returns the target with the "color_gradients" attribute needed by the
+/// colored ICP estimation. The gradients are computed on the device of the
+/// target from its neighbors within twice the correspondence distance, as the
+/// legacy RegistrationColoredICP does.
+static geometry::PointCloud PrepareTargetForEstimation(
+        const geometry::PointCloud &target,
+        double max_correspondence_distance,
+        const TransformationEstimation &estimation) {
+    if (estimation.GetTransformationEstimationType() !=
+                TransformationEstimationType::ColoredICP ||
+        target.HasPointAttr("color_gradients") ||
+        !target.HasPointNormals() || !target.HasPointColors()) {
+        return target;
+    }
+
+    core::Dtype dtype = core::Dtype::Float32;
+    core::Tensor points = target.GetPoints().Contiguous();
+    core::Tensor color_gradients;
+    if (points.GetLength() > 0) {
+        // The knn search is native on both CPU and CUDA; the radius limit of
+        // a hybrid search is applied by the kernel.
+        const int max_nn = 30;
+        double radius = max_correspondence_distance * 2.0;
+        open3d::core::nns::NearestNeighborSearch nns(points);
+        nns.KnnIndex();
+        core::Tensor indices, distances;
+        std::tie(indices, distances) = nns.KnnSearch(points, max_nn);
+        kernel::registration::ComputeColorGradients(
+                points, target.GetPointNormals().To(dtype).Contiguous(),
+                target.GetPointColors().To(dtype).Contiguous(),
+                indices.Contiguous(), distances.Contiguous(), radius * radius,
+                color_gradients);
+    } else {
+        color_gradients =
+                core::Tensor::Empty({0, 3}, dtype, points.GetDevice());
+    }
+
+    // The copy shares the tensors of the target.
+    geometry::PointCloud target_with_gradients = target;
+    target_with_gradients.SetPointAttr("color_gradients", color_gradients);
+    return target_with_gradients;
+}
+
+/// Returns true if the estimation accepts the fixed-shape correspondences of
+/// GetRegistrationResultAndCorrespondences, i.e. its kernels skip the source
+/// points without a correspondence.
+static bool AcceptsFixedShapeCorrespondences(
+        const TransformationEstimation &estimation) {
+    TransformationEstimationType type =
+            estimation.GetTransformationEstimationType();
+    return type == TransformationEstimationType::PointToPlane ||
+           type == TransformationEstimationType::ColoredICP;
+}
+
+/// Runs the ICP iterations from the transformation \p init, which is on the
+/// device of the point clouds, and sets \p iterations to the number of
+/// iterations run.
+static RegistrationResult ICPIterations(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        open3d::core::nns::NearestNeighborSearch &target_nns,
+        double max_correspondence_distance,
+        const core::Tensor &init,
+        const TransformationEstimation &estimation,
+        const ICPConvergenceCriteria &criteria,
+        int &iterations) {
+    OPEN3D_TRACE_SCOPE("t::ICP");
+    geometry::PointCloud target_prepared = PrepareTargetForEstimation(
+            target, max_correspondence_distance, estimation);
+    core::Tensor transformation_device = init;
+    geometry::PointCloud source_transformed = source.Copy();
+    source_transformed.Transform(transformation_device);
+
+    // The iterations of the kernel based estimations keep one correspondence
+    // slot per source point, which avoids compacting the correspondences on
+    // every iteration. They are compacted once at the end. The iterations are
+    // still not captured as a CUDA graph on the current CUDAStream: each one
+    // copies the 6x6 system to the host to solve it and the fitness and RMSE
+    // to test convergence, and the hybrid search allocates its outputs.
+    bool fixed_shape = AcceptsFixedShapeCorrespondences(estimation);
+    core::Tensor source_indices;
+    if (fixed_shape) {
+        source_indices =
+                core::Tensor::Arange(0, source.GetPoints().GetLength(), 1,
+                                     core::Dtype::Int64, source.GetDevice());
+    }
+    auto MakeCorrespondenceSet = [&](const RegistrationResult &result) {
+        if (!fixed_shape) {
+            return std::make_pair(result.correspondence_select_bool_,
+                                  result.correspondence_set_);
+        }
+        // No search is run for a non-positive distance.
+        return std::make_pair(
+                source_indices.Slice(0, 0,
+                                     result.correspondence_set_.GetLength()),
+                result.correspondence_set_);
+    };
+
+    // TODO: Default constructor absent in RegistrationResult class.
+    RegistrationResult result(transformation_device);
+
+    result = GetRegistrationResultAndCorrespondences(
+            source_transformed, target, target_nns, max_correspondence_distance,
+            transformation_device, fixed_shape);
+    CorrespondenceSet corres = MakeCorrespondenceSet(result);
+
+    iterations = 0;
+    for (int i = 0; i < criteria.max_iteration_; i++) {
+        iterations = i + 1;
+        utility::LogDebug("ICP Iteration #{:d}: Fitness {:.4f}, RMSE {:.4f}", i,
+                          result.fitness_, result.inlier_rmse_);
+        core::Tensor update = estimation.ComputeTransformation(
+                source_transformed, target_prepared, corres);
+        transformation_device = update.Matmul(transformation_device);
+        source_transformed.Transform(update);
+
+        double prev_fitness_ = result.fitness_;
+        double prev_inliner_rmse_ = result.inlier_rmse_;
+
+        result = GetRegistrationResultAndCorrespondences(
+                source_transformed, target, target_nns,
+                max_correspondence_distance, transformation_device,
+                fixed_shape);
+        corres = MakeCorrespondenceSet(result);
+
+        if (std::abs(prev_fitness_ - result.fitness_) <
+                    criteria.relative_fitness_ &&
+            std::abs(prev_inliner_rmse_ - result.inlier_rmse_) <
+                    criteria.relative_rmse_) {
+            break;
+        }
+    }
+
+    if (fixed_shape && result.correspondence_set_.GetLength() > 0) {
+        result.correspondence_select_bool_ = result.correspondence_set_.Ne(-1);
+        result.correspondence_set_ = result.correspondence_set_.IndexGet(
+                {result.correspondence_select_bool_});
+    }
+    return result;
+}
+
 RegistrationResult EvaluateRegistration(const geometry::PointCloud &source,
                                         const geometry::PointCloud &target,
                                         double max_correspondence_distance,
                                         const core::Tensor &transformation) {
+    open3d::core::nns::NearestNeighborSearch target_nns(target.GetPoints());
+    SetTargetIndex(target_nns, max_correspondence_distance);
+    return EvaluateRegistration(source, target, target_nns,
+                                max_correspondence_distance, transformation);
+}
+
+RegistrationResult EvaluateRegistration(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        open3d::core::nns::NearestNeighborSearch &target_nns,
+        double max_correspondence_distance,
+        const core::Tensor &transformation) {
     core::Device device = source.GetDevice();
     core::Dtype dtype = core::Dtype::Float32;
     source.GetPoints().AssertDtype(dtype);
@@ -127,8 +329,6 @@ RegistrationResult EvaluateRegistration(const geometry::PointCloud &source,
         transformation_device = transformation.Copy(device);
     }
 
-    open3d::core::nns::NearestNeighborSearch target_nns(target.GetPoints());
-
     geometry::PointCloud source_transformed = source.Copy();
     source_transformed.Transform(transformation_device);
     return GetRegistrationResultAndCorrespondences(
@@ -142,6 +342,21 @@ RegistrationResult RegistrationICP(const geometry::PointCloud &source,
                                    const core::Tensor &init,
                                    const TransformationEstimation &estimation,
                                    const ICPConvergenceCriteria &criteria) {
+    open3d::core::nns::NearestNeighborSearch target_nns(target.GetPoints());
+    SetTargetIndex(target_nns, max_correspondence_distance);
+    return RegistrationICP(source, target, target_nns,
+                           max_correspondence_distance, init, estimation,
+                           criteria);
+}
+
+RegistrationResult RegistrationICP(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        open3d::core::nns::NearestNeighborSearch &target_nns,
+        double max_correspondence_distance,
+        const core::Tensor &init,
+        const TransformationEstimation &estimation,
+        const ICPConvergenceCriteria &criteria) {
     core::Device device = source.GetDevice();
     core::Dtype dtype = core::Dtype::Float32;
     source.GetPoints().AssertDtype(dtype);
@@ -160,46 +375,338 @@ RegistrationResult RegistrationICP(const geometry::PointCloud &source,
         transformation_device = init.Copy(device);
     }
 
-    open3d::core::nns::NearestNeighborSearch target_nns(target.GetPoints());
-    geometry::PointCloud source_transformed = source.Copy();
-    source_transformed.Transform(transformation_device);
+    int iterations;
+    return ICPIterations(source, target, target_nns,
+                         max_correspondence_distance, transformation_device,
+                         estimation, criteria, iterations);
+}
 
-    // TODO: Default constructor absent in RegistrationResult class.
-    RegistrationResult result(transformation_device);
+MultiScaleRegistrationResult RegistrationMultiScaleICP(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const std::vector<double> &voxel_sizes,
+        const std::vector<ICPConvergenceCriteria> &criteria_list,
+        const std::vector<double> &max_correspondence_distances,
+        const core::Tensor &init,
+        const TransformationEstimation &estimation) {
+    core::Device device = source.GetDevice();
+    core::Dtype dtype = core::Dtype::Float32;
+    source.GetPoints().AssertDtype(dtype);
+    target.GetPoints().AssertDtype(dtype);
+    if (target.GetDevice() != device) {
+        utility::LogError(
+                "Target Pointcloud device {} != Source Pointcloud's device {}.",
+                target.GetDevice().ToString(), device.ToString());
+    }
+    size_t num_levels = voxel_sizes.size();
+    if (num_levels == 0) {
+        utility::LogError("[RegistrationMultiScaleICP] No level is given.");
+    }
+    if (criteria_list.size() != num_levels ||
+        max_correspondence_distances.size() != num_levels) {
+        utility::LogError(
+                "[RegistrationMultiScaleICP] Got {} voxel sizes, {} criteria "
+                "and {} correspondence distances, expected the same number.",
+                num_levels, criteria_list.size(),
+                max_correspondence_distances.size());
+    }
+    init.AssertShape({4, 4});
+    init.AssertDtype(dtype);
+    core::Tensor transformation_device;
+    if (init.GetDevice() == device) {
+        transformation_device = init;
+    } else {
+        transformation_device = init.Copy(device);
+    }
 
-    result = GetRegistrationResultAndCorrespondences(
-            source_transformed, target, target_nns, max_correspondence_distance,
-            transformation_device);
-    CorrespondenceSet corres = std::make_pair(
-            result.correspondence_select_bool_, result.correspondence_set_);
+    MultiScaleRegistrationResult result(transformation_device);
+    for (size_t level = 0; level < num_levels; ++level) {
+        ICPLevelStats stats;
+        stats.voxel_size_ = voxel_sizes[level];
+        utility::Timer timer;
 
-    for (int i = 0; i < criteria.max_iteration_; i++) {
-        utility::LogDebug("ICP Iteration #{:d}: Fitness {:.4f}, RMSE {:.4f}", i,
-                          result.fitness_, result.inlier_rmse_);
-        core::Tensor update = estimation.ComputeTransformation(
-                source_transformed, target, corres);
-        transformation_device = update.Matmul(transformation_device);
-        source_transformed.Transform(update);
+        // The full point clouds are used as they are, without copy.
+        timer.Start();
+        geometry::PointCloud source_level =
+                voxel_sizes[level] > 0.0
+                        ? source.VoxelDownSample(voxel_sizes[level])
+                        : source;
+        geometry::PointCloud target_level =
+                voxel_sizes[level] > 0.0
+                        ? target.VoxelDownSample(voxel_sizes[level])
+                        : target;
+        timer.Stop();
+        stats.downsample_time_ms_ = timer.GetDuration();
+        stats.num_source_points_ = source_level.GetPoints().GetLength();
+        stats.num_target_points_ = target_level.GetPoints().GetLength();
 
-        double prev_fitness_ = result.fitness_;
-        double prev_inliner_rmse_ = result.inlier_rmse_;
+        timer.Start();
+        open3d::core::nns::NearestNeighborSearch target_nns(
+                target_level.GetPoints());
+        SetTargetIndex(target_nns, max_correspondence_distances[level]);
+        timer.Stop();
+        stats.index_time_ms_ = timer.GetDuration();
 
-        result = GetRegistrationResultAndCorrespondences(
-                source_transformed, target, target_nns,
-                max_correspondence_distance, transformation_device);
-        corres = std::make_pair(result.correspondence_select_bool_,
-                                result.correspondence_set_);
+        timer.Start();
+        RegistrationResult level_result = ICPIterations(
+                source_level, target_level, target_nns,
+                max_correspondence_distances[level], transformation_device,
+                estimation, criteria_list[level], stats.iterations_);
+        timer.Stop();
+        stats.icp_time_ms_ = timer.GetDuration();
+        stats.fitness_ = level_result.fitness_;
+        stats.inlier_rmse_ = level_result.inlier_rmse_;
+        utility::LogDebug(
+                "Multi-scale ICP level {:d}: voxel size {:.4f}, {:d} "
+                "iterations, Fitness {:.4f}, RMSE {:.4f}",
+                level, stats.voxel_size_, stats.iterations_, stats.fitness_,
+                stats.inlier_rmse_);
 
-        if (std::abs(prev_fitness_ - result.fitness_) <
-                    criteria.relative_fitness_ &&
-            std::abs(prev_inliner_rmse_ - result.inlier_rmse_) <
-                    criteria.relative_rmse_) {
-            break;
-        }
+        transformation_device = level_result.transformation_;
+        static_cast<RegistrationResult &>(result) = level_result;
+        result.level_stats_.push_back(stats);
     }
     return result;
 }
 
+RegistrationResult RegistrationRANSACBasedOnCorrespondence(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const CorrespondenceSet &corres,
+        double max_correspondence_distance,
+        int ransac_n,
+        double edge_length_threshold,
+        const RANSACConvergenceCriteria &criteria) {
+    core::Device device = source.GetDevice();
+    core::Dtype dtype = core::Dtype::Float32;
+    source.GetPoints().AssertDtype(dtype);
+    target.GetPoints().AssertDtype(dtype);
+    if (target.GetDevice() != device) {
+        utility::LogError(
+                "Target Pointcloud device {} != Source Pointcloud's device {}.",
+                target.GetDevice().ToString(), device.ToString());
+    }
+    if (criteria.batch_size_ <= 0) {
+        utility::LogError("RANSAC batch size must be positive, but got {}.",
+                          criteria.batch_size_);
+    }
+
+    core::Tensor source_indices = corres.first.Copy(device);
+    core::Tensor target_indices = corres.second.Copy(device);
+    int64_t num_corres = source_indices.NumElements();
+    RegistrationResult best_result(core::Tensor::Eye(4, dtype, device));
+    if (ransac_n < 3 || num_corres < ransac_n ||
+        max_correspondence_distance <= 0.0) {
+        return best_result;
+    }
+
+    core::Tensor source_points = source.GetPoints().Contiguous();
+    core::Tensor target_points = target.GetPoints().Contiguous();
+    double max_distance2 =
+            max_correspondence_distance * max_correspondence_distance;
+
+    std::mt19937 engine(std::random_device{}());
+    std::uniform_int_distribution<int64_t> distribution(0, num_corres - 1);
+    std::vector<int64_t> samples;
+    int64_t best_count = 0;
+    double best_error = 0.0;
+    int64_t exit_itr = criteria.max_iteration_;
+    int64_t itr = 0;
+    while (itr < exit_itr) {
+        int64_t batch_size =
+                std::min<int64_t>(criteria.batch_size_, exit_itr - itr);
+        // Sampling on the host is cheap next to the validation; only the
+        // batch of indices is copied.
+        samples.resize(batch_size * ransac_n);
+        for (int64_t &sample : samples) {
+            sample = distribution(engine);
+        }
+        core::Tensor samples_device(samples, {batch_size, ransac_n},
+                                    core::Dtype::Int64, device);
+
+        core::Tensor transformations, valid, inlier_counts, inlier_errors;
+        kernel::registration::EstimateRANSACHypotheses(
+                source_points, target_points, source_indices, target_indices,
+                samples_device, edge_length_threshold, max_distance2,
+                transformations, valid);
+        kernel::registration::EvaluateRANSACHypotheses(
+                source_points, target_points, source_indices, target_indices,
+                transformations, valid, max_distance2, inlier_counts,
+                inlier_errors);
+        itr += batch_size;
+
+        std::vector<int64_t> counts = inlier_counts.ToFlatVector<int64_t>();
+        std::vector<double> errors = inlier_errors.ToFlatVector<double>();
+        int64_t batch_best = -1;
+        for (int64_t b = 0; b < batch_size; ++b) {
+            if (counts[b] == 0) continue;
+            if (counts[b] > best_count ||
+                (counts[b] == best_count &&
+                 errors[b] / counts[b] < best_error / best_count)) {
+                best_count = counts[b];
+                best_error = errors[b];
+                batch_best = b;
+            }
+        }
+        if (batch_best < 0) continue;
+
+        best_result.transformation_ = transformations[batch_best].Copy();
+        best_result.fitness_ = static_cast<double>(best_count) /
+                               static_cast<double>(num_corres);
+        best_result.inlier_rmse_ =
+                std::sqrt(best_error / static_cast<double>(best_count));
+
+        // Update exit condition if necessary.
+        double exit_itr_d =
+                std::log(1.0 - criteria.confidence_) /
+                std::log(1.0 - std::pow(best_result.fitness_, ransac_n));
+        if (exit_itr_d < static_cast<double>(exit_itr)) {
+            exit_itr = static_cast<int64_t>(std::ceil(exit_itr_d));
+        }
+    }
+    utility::LogDebug(
+            "RANSAC exits at {:d}-th iteration: inlier ratio {:e}, "
+            "RMSE {:e}",
+            itr, best_result.fitness_, best_result.inlier_rmse_);
+
+    if (best_count > 0) {
+        geometry::PointCloud source_selected(
+                source_points.IndexGet({source_indices}));
+        source_selected.Transform(best_result.transformation_);
+        core::Tensor diff = source_selected.GetPoints() -
+                            target_points.IndexGet({target_indices});
+        best_result.correspondence_select_bool_ =
+                diff.Mul_(diff).Sum({1}).Lt(static_cast<float>(max_distance2));
+        best_result.correspondence_set_ = target_indices.IndexGet(
+                {best_result.correspondence_select_bool_});
+    }
+    return best_result;
+}
+
+/// Returns the correspondence_set_ of the result as an Int64 tensor of shape
+/// {C} on \p device, also when the result has no correspondences.
+static core::Tensor GetTargetIndices(const RegistrationResult &result,
+                                     const core::Device &device) {
+    if (result.correspondence_set_.NumElements() == 0) {
+        return core::Tensor::Empty({0}, core::Dtype::Int64, device);
+    }
+    result.correspondence_set_.AssertDtype(core::Dtype::Int64);
+    result.correspondence_set_.AssertDevice(device);
+    return result.correspondence_set_.Reshape({-1});
+}
+
+core::Tensor GetInformationMatrix(const geometry::PointCloud &target,
+                                  const RegistrationResult &result) {
+    const core::Device device = target.GetDevice();
+    const core::Tensor target_indices = GetTargetIndices(result, device);
+    core::Tensor information;
+    kernel::registration::ComputeInformationMatrices(
+            target.GetPoints(), target_indices,
+            core::Tensor::Zeros(target_indices.GetShape(), core::Dtype::Int64,
+                                device),
+            1, information);
+    return information.Reshape({6, 6});
+}
+
+core::Tensor GetInformationMatrixFromPointClouds(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        double max_correspondence_distance,
+        const core::Tensor &transformation) {
+    return GetInformationMatrix(
+            target, EvaluateRegistration(source, target,
+                                         max_correspondence_distance,
+                                         transformation));
+}
+
+core::Tensor GetInformationMatrixFromPointClouds(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        open3d::core::nns::NearestNeighborSearch &target_nns,
+        double max_correspondence_distance,
+        const core::Tensor &transformation) {
+    return GetInformationMatrix(
+            target, EvaluateRegistration(source, target, target_nns,
+                                         max_correspondence_distance,
+                                         transformation));
+}
+
+core::Tensor GetInformationMatrices(
+        const std::vector<geometry::PointCloud> &point_clouds,
+        const std::vector<std::pair<int, int>> &pairs,
+        const std::vector<RegistrationResult> &results) {
+    if (pairs.size() != results.size()) {
+        utility::LogError("{} registration results for {} pairs.",
+                          results.size(), pairs.size());
+    }
+    const int64_t num_edges = static_cast<int64_t>(pairs.size());
+    const int num_clouds = static_cast<int>(point_clouds.size());
+    if (num_edges == 0) {
+        return core::Tensor::Zeros(
+                {0, 6, 6}, core::Dtype::Float64,
+                num_clouds > 0 ? point_clouds[0].GetDevice()
+                               : core::Device("CPU:0"));
+    }
+    for (const std::pair<int, int> &pair : pairs) {
+        if (pair.first < 0 || pair.first >= num_clouds || pair.second < 0 ||
+            pair.second >= num_clouds) {
+            utility::LogError("Pair ({}, {}) is out of range [0, {}).",
+                              pair.first, pair.second, num_clouds);
+        }
+    }
+    const core::Device device = point_clouds[pairs[0].second].GetDevice();
+
+    // Offsets of the targets in the concatenated points, -1 for the point
+    // clouds that are not a target.
+    std::vector<int64_t> point_offsets(num_clouds, -1);
+    int64_t num_points = 0;
+    std::vector<core::Tensor> target_indices(num_edges);
+    int64_t num_correspondences = 0;
+    for (int64_t e = 0; e < num_edges; ++e) {
+        const geometry::PointCloud &target = point_clouds[pairs[e].second];
+        if (target.GetDevice() != device) {
+            utility::LogError("Target of pair {} is on {}, instead of {}.", e,
+                              target.GetDevice().ToString(),
+                              device.ToString());
+        }
+        if (point_offsets[pairs[e].second] < 0) {
+            point_offsets[pairs[e].second] = num_points;
+            num_points += target.GetPoints().GetLength();
+        }
+        target_indices[e] = GetTargetIndices(results[e], device);
+        num_correspondences += target_indices[e].GetLength();
+    }
+
+    core::Tensor all_points({num_points, 3}, core::Dtype::Float32, device);
+    for (int i = 0; i < num_clouds; ++i) {
+        if (point_offsets[i] >= 0) {
+            const core::Tensor &points = point_clouds[i].GetPoints();
+            all_points
+                    .Slice(0, point_offsets[i],
+                           point_offsets[i] + points.GetLength())
+                    .AsRvalue() = points;
+        }
+    }
+    core::Tensor all_target_indices({num_correspondences}, core::Dtype::Int64,
+                                    device);
+    core::Tensor edge_indices({num_correspondences}, core::Dtype::Int64,
+                              device);
+    int64_t begin = 0;
+    for (int64_t e = 0; e < num_edges; ++e) {
+        const int64_t end = begin + target_indices[e].GetLength();
+        all_target_indices.Slice(0, begin, end).AsRvalue() =
+                target_indices[e].Add(point_offsets[pairs[e].second]);
+        edge_indices.Slice(0, begin, end).Fill(e);
+        begin = end;
+    }
+
+    core::Tensor information;
+    kernel::registration::ComputeInformationMatrices(
+            all_points, all_target_indices, edge_indices, num_edges,
+            information);
+    return information;
+}
+
 }  // namespace registration
 }  // namespace pipelines
 }  // namespace t
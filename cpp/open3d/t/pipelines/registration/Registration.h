@@ -27,12 +27,20 @@
 #pragma once
 
 #include <tuple>
+#include <utility>
 #include <vector>
 
 #include "open3d/core/Tensor.h"
 #include "open3d/t/pipelines/registration/TransformationEstimation.h"
 
 namespace open3d {
+
+namespace core {
+namespace nns {
+class NearestNeighborSearch;
+}
+}  // namespace core
+
 namespace t {
 
 namespace geometry {
@@ -77,6 +85,40 @@ public:
     int max_iteration_;
 };
 
+/// \class RANSACConvergenceCriteria
+///
+/// \brief Class that defines the convergence criteria of RANSAC.
+///
+/// RANSAC stops when max_iteration_ hypotheses have been evaluated, or earlier
+/// once the number of hypotheses estimated from the best inlier ratio for the
+/// desired confidence has been reached.
+class RANSACConvergenceCriteria {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param max_iteration Maximum number of hypotheses.
+    /// \param confidence Desired probability of success. Used for estimating
+    /// early termination by k = log(1 - confidence)/log(1 -
+    /// inlier_ratio^{ransac_n}).
+    /// \param batch_size Number of hypotheses sampled, estimated and
+    /// validated together on the device.
+    RANSACConvergenceCriteria(int max_iteration = 100000,
+                              double confidence = 0.999,
+                              int batch_size = 4096)
+        : max_iteration_(max_iteration),
+          confidence_(confidence),
+          batch_size_(batch_size) {}
+    ~RANSACConvergenceCriteria() {}
+
+public:
+    /// Maximum number of hypotheses.
+    int max_iteration_;
+    /// Desired probability of success.
+    double confidence_;
+    /// Number of hypotheses per batch.
+    int batch_size_;
+};
+
 /// \class RegistrationResult
 ///
 /// Class that contains the registration results.
@@ -111,6 +153,49 @@ public:
     double fitness_;
 };
 
+/// \class ICPLevelStats
+///
+/// Statistics of one level of RegistrationMultiScaleICP.
+class ICPLevelStats {
+public:
+    /// Voxel size of the level, non-positive if the level is not downsampled.
+    double voxel_size_ = 0.0;
+    /// Number of source points after downsampling.
+    int64_t num_source_points_ = 0;
+    /// Number of target points after downsampling.
+    int64_t num_target_points_ = 0;
+    /// Number of ICP iterations run at the level.
+    int iterations_ = 0;
+    /// Fitness of the level, on the downsampled point clouds.
+    double fitness_ = 0.0;
+    /// Inlier RMSE of the level, on the downsampled point clouds.
+    double inlier_rmse_ = 0.0;
+    /// Time spent downsampling the source and the target, in milliseconds.
+    double downsample_time_ms_ = 0.0;
+    /// Time spent building the search index of the target, in milliseconds.
+    double index_time_ms_ = 0.0;
+    /// Time spent in the ICP iterations, in milliseconds.
+    double icp_time_ms_ = 0.0;
+};
+
+/// \class MultiScaleRegistrationResult
+///
+/// Result of RegistrationMultiScaleICP: the registration result of the finest
+/// level, with the statistics of every level.
+class MultiScaleRegistrationResult : public RegistrationResult {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param transformation The estimated transformation matrix.
+    MultiScaleRegistrationResult(const core::Tensor &transformation)
+        : RegistrationResult(transformation) {}
+    ~MultiScaleRegistrationResult() {}
+
+public:
+    /// Statistics of the levels, from the coarsest to the finest.
+    std::vector<ICPLevelStats> level_stats_;
+};
+
 /// \brief Function for evaluating registration between point clouds.
 ///
 /// \param source The source point cloud.
@@ -128,6 +213,10 @@ RegistrationResult EvaluateRegistration(
 
 /// \brief Functions for ICP registration.
 ///
+/// With TransformationEstimationForColoredICP, the color gradients of the
+/// target are computed once on its device, unless it already has the
+/// "color_gradients" attribute.
+///
 /// \param source The source point cloud.
 /// \param target The target point cloud.
 /// \param max_correspondence_distance Maximum correspondence points-pair
@@ -144,6 +233,184 @@ RegistrationResult RegistrationICP(
                 TransformationEstimationPointToPoint(),
         const ICPConvergenceCriteria &criteria = ICPConvergenceCriteria());
 
+/// \brief Function for evaluating registration between point clouds, with a
+/// prebuilt search index of the target.
+///
+/// \param source The source point cloud.
+/// \param target The target point cloud.
+/// \param target_nns Search index built on the points of \p target, with
+/// HybridIndex() already set. It can be reused across calls as long as the
+/// target points do not change.
+/// \param max_correspondence_distance Maximum correspondence points-pair
+/// distance.
+/// \param transformation The 4x4 transformation matrix to transform
+/// source to target.
+RegistrationResult EvaluateRegistration(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        core::nns::NearestNeighborSearch &target_nns,
+        double max_correspondence_distance,
+        const core::Tensor &transformation = core::Tensor::Eye(
+                4, core::Dtype::Float32, core::Device("CPU:0")));
+
+/// \brief Functions for ICP registration, with a prebuilt search index of the
+/// target. Repeated registrations against the same target, e.g. in tracking,
+/// skip the index construction.
+///
+/// \param source The source point cloud.
+/// \param target The target point cloud.
+/// \param target_nns Search index built on the points of \p target, with
+/// HybridIndex() already set. It can be reused across calls as long as the
+/// target points do not change.
+/// \param max_correspondence_distance Maximum correspondence points-pair
+/// distance.
+/// \param init Initial transformation estimation.
+/// \param estimation Estimation method.
+/// \param criteria Convergence criteria.
+RegistrationResult RegistrationICP(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        core::nns::NearestNeighborSearch &target_nns,
+        double max_correspondence_distance,
+        const core::Tensor &init,
+        const TransformationEstimation &estimation =
+                TransformationEstimationPointToPoint(),
+        const ICPConvergenceCriteria &criteria = ICPConvergenceCriteria());
+
+/// \brief Functions for coarse-to-fine ICP registration.
+///
+/// Each level voxel downsamples the source and the target, on their device,
+/// and runs ICP from the transformation of the previous level. The search
+/// index of the target is built once per level.
+///
+/// \param source The source point cloud.
+/// \param target The target point cloud.
+/// \param voxel_sizes Voxel sizes of the levels, from the coarsest to the
+/// finest. A non-positive voxel size uses the full point clouds.
+/// \param criteria_list Convergence criteria of each level.
+/// \param max_correspondence_distances Maximum correspondence points-pair
+/// distance of each level.
+/// \param init Initial transformation estimation.
+/// \param estimation Estimation method.
+MultiScaleRegistrationResult RegistrationMultiScaleICP(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const std::vector<double> &voxel_sizes,
+        const std::vector<ICPConvergenceCriteria> &criteria_list,
+        const std::vector<double> &max_correspondence_distances,
+        const core::Tensor &init = core::Tensor::Eye(4,
+                                                     core::Dtype::Float32,
+                                                     core::Device("CPU:0")),
+        const TransformationEstimation &estimation =
+                TransformationEstimationPointToPoint());
+
+/// \brief Function for global RANSAC registration based on a set of
+/// correspondences.
+///
+/// Hypotheses are sampled in batches. The Kabsch transformations of a batch
+/// are estimated by one kernel, rejecting the samples whose edge lengths or
+/// distances do not match. The batch is then validated against all the
+/// correspondences by a second kernel, on the device of the point clouds.
+///
+/// The fitness of the result is the inlier ratio of the correspondences. Its
+/// correspondence_select_bool_ is a {K} Bool tensor marking the inlier
+/// correspondences, and its correspondence_set_ holds their target indices.
+///
+/// \param source The source point cloud.
+/// \param target The target point cloud.
+/// \param corres Correspondences, as a pair of Int64 source indices and target
+/// indices of shape {K}.
+/// \param max_correspondence_distance Maximum correspondence points-pair
+/// distance.
+/// \param ransac_n Fit ransac with ransac_n correspondences.
+/// \param edge_length_threshold Similarity threshold of the edge lengths
+/// between the samples, as in CorrespondenceCheckerBasedOnEdgeLength.
+/// Non-positive values disable the check.
+/// \param criteria Convergence criteria.
+RegistrationResult RegistrationRANSACBasedOnCorrespondence(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const CorrespondenceSet &corres,
+        double max_correspondence_distance,
+        int ransac_n = 3,
+        double edge_length_threshold = 0.9,
+        const RANSACConvergenceCriteria &criteria =
+                RANSACConvergenceCriteria());
+
+/// \brief Computes the information matrix of a registration from its
+/// correspondences, as the legacy GetInformationMatrixFromPointClouds, without
+/// searching them again.
+///
+/// The matrix is reduced on the device of \p target in a single pass over the
+/// correspondences.
+///
+/// \param target The target point cloud.
+/// \param result Result of a registration against \p target, e.g. of
+/// RegistrationICP(), whose correspondence_set_ holds the target indices of
+/// the correspondences at its transformation.
+/// \return Float64 information matrix of shape {6, 6} on the device of
+/// \p target.
+core::Tensor GetInformationMatrix(const geometry::PointCloud &target,
+                                  const RegistrationResult &result);
+
+/// \brief Computes the information matrix of the correspondences of
+/// \p source in \p target under \p transformation, as the legacy
+/// GetInformationMatrixFromPointClouds.
+///
+/// \param source The source point cloud.
+/// \param target The target point cloud.
+/// \param max_correspondence_distance Maximum correspondence points-pair
+/// distance.
+/// \param transformation The 4x4 transformation matrix to transform
+/// source to target.
+/// \return Float64 information matrix of shape {6, 6} on the device of
+/// \p target.
+core::Tensor GetInformationMatrixFromPointClouds(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        double max_correspondence_distance,
+        const core::Tensor &transformation = core::Tensor::Eye(
+                4, core::Dtype::Float32, core::Device("CPU:0")));
+
+/// \brief Computes the information matrix of the correspondences of
+/// \p source in \p target under \p transformation, with a prebuilt search
+/// index of the target.
+///
+/// \param source The source point cloud.
+/// \param target The target point cloud.
+/// \param target_nns Search index built on the points of \p target, with
+/// HybridIndex() already set, e.g. the one used for RegistrationICP().
+/// \param max_correspondence_distance Maximum correspondence points-pair
+/// distance.
+/// \param transformation The 4x4 transformation matrix to transform
+/// source to target.
+/// \return Float64 information matrix of shape {6, 6} on the device of
+/// \p target.
+core::Tensor GetInformationMatrixFromPointClouds(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        core::nns::NearestNeighborSearch &target_nns,
+        double max_correspondence_distance,
+        const core::Tensor &transformation = core::Tensor::Eye(
+                4, core::Dtype::Float32, core::Device("CPU:0")));
+
+/// \brief Computes the information matrices of a batch of registrations, such
+/// as the edges of a multiway registration, from their correspondences.
+///
+/// The targets are gathered once each, and all the matrices are reduced by a
+/// single kernel on their device.
+///
+/// \param point_clouds The point clouds, on the same device.
+/// \param pairs Pairs of indices (source, target) into \p point_clouds.
+/// \param results Registration result of each pair, as in
+/// GetInformationMatrix().
+/// \return Float64 information matrices of shape {E, 6, 6} for the E pairs,
+/// on the device of the point clouds.
+core::Tensor GetInformationMatrices(
+        const std::vector<geometry::PointCloud> &point_clouds,
+        const std::vector<std::pair<int, int>> &pairs,
+        const std::vector<RegistrationResult> &results);
+
 }  // namespace registration
 }  // namespace pipelines
 }  // namespace t
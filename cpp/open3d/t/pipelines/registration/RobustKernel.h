@@ -0,0 +1,72 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace registration {
+
+/// Robust kernels of the tensor registration, with the weights of the legacy
+/// open3d::pipelines::registration::RobustKernel classes.
+enum class RobustKernelMethod {
+    L2Loss = 0,
+    L1Loss = 1,
+    HuberLoss = 2,
+    CauchyLoss = 3,
+    GMLoss = 4,
+    TukeyLoss = 5,
+};
+
+/// \class RobustKernel
+///
+/// Robust kernel for outlier rejection, given by its method and scaling
+/// parameter. Unlike the legacy kernels it is a plain value, so the residual
+/// weights are computed in the CPU and CUDA kernels of the estimations.
+class RobustKernel {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param type Loss type of the kernel.
+    /// \param scaling_parameter Scaling parameter k of the Huber, Cauchy, GM
+    /// and Tukey losses, unused by the L2 and L1 losses.
+    explicit RobustKernel(RobustKernelMethod type = RobustKernelMethod::L2Loss,
+                          double scaling_parameter = 1.0)
+        : type_(type), scaling_parameter_(scaling_parameter) {}
+
+public:
+    /// Loss type of the kernel.
+    RobustKernelMethod type_ = RobustKernelMethod::L2Loss;
+    /// Scaling parameter of the loss.
+    double scaling_parameter_ = 1.0;
+};
+
+}  // namespace registration
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
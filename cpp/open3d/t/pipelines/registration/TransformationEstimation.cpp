@@ -26,11 +26,85 @@
 
 #include "open3d/t/pipelines/registration/TransformationEstimation.h"
 
+#include <Eigen/Core>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "open3d/t/pipelines/kernel/TransformationEstimation.h"
+#include "open3d/utility/Eigen.h"
+#include "open3d/utility/Trace.h"
+
 namespace open3d {
 namespace t {
 namespace pipelines {
 namespace registration {
 
+/// Returns the Int64 source indices of the correspondences, converting a
+/// Bool mask with NonZero.
+static core::Tensor GetSourceIndices(const CorrespondenceSet &corres) {
+    core::Tensor source_indices = corres.first;
+    if (source_indices.GetDtype() == core::Dtype::Bool) {
+        source_indices = source_indices.NonZero().Reshape({-1});
+    }
+    return source_indices.Contiguous();
+}
+
+/// Solves the 6x6 system of an ICP kernel on the host and returns the
+/// transformation on \p device. A singular system gives the identity.
+static core::Tensor SolveICPSystem(const core::Tensor &system,
+                                   const core::Device &device,
+                                   const std::string &name) {
+    std::vector<float> A =
+            system.Copy(core::Device("CPU:0")).ToFlatVector<float>();
+    Eigen::Matrix6d JtJ;
+    Eigen::Vector6d Jtr;
+    int k = 0;
+    for (int i = 0; i < 6; ++i) {
+        for (int j = i; j < 6; ++j) {
+            JtJ(i, j) = JtJ(j, i) = A[k++];
+        }
+    }
+    for (int i = 0; i < 6; ++i) {
+        Jtr(i) = A[21 + i];
+    }
+
+    bool success;
+    Eigen::VectorXd x;
+    std::tie(success, x) = utility::SolveLinearSystemPSD(JtJ, -Jtr);
+    if (!success) {
+        utility::LogWarning("Singular {} system.", name);
+        x = Eigen::VectorXd::Zero(6);
+    }
+    core::Tensor Pose(std::vector<float>(x.data(), x.data() + 6), {6},
+                      core::Dtype::Float32, device);
+    return t::pipelines::PoseToTransformation(Pose);
+}
+
+static void AssertColoredICPInputs(const geometry::PointCloud &source,
+                                   const geometry::PointCloud &target) {
+    core::Device device = source.GetDevice();
+    core::Dtype dtype = core::Dtype::Float32;
+    source.GetPoints().AssertDtype(dtype);
+    target.GetPoints().AssertDtype(dtype);
+    if (target.GetDevice() != device) {
+        utility::LogError(
+                "Target Pointcloud device {} != Source Pointcloud's device {}.",
+                target.GetDevice().ToString(), device.ToString());
+    }
+    if (!source.HasPointColors() || !target.HasPointColors() ||
+        !target.HasPointNormals()) {
+        utility::LogError(
+                "ColoredICP requires source colors and target colors and "
+                "normals.");
+    }
+    if (!target.HasPointAttr("color_gradients")) {
+        utility::LogError(
+                "ColoredICP requires the \"color_gradients\" attribute of the "
+                "target, computed by RegistrationICP.");
+    }
+}
+
 double TransformationEstimationPointToPoint::ComputeRMSE(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
@@ -60,6 +134,7 @@ core::Tensor TransformationEstimationPointToPoint::ComputeTransformation(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
         CorrespondenceSet &corres) const {
+    OPEN3D_TRACE_SCOPE("t::ICP::TransformationEstimation");
     core::Device device = source.GetDevice();
     core::Dtype dtype = core::Dtype::Float32;
     source.GetPoints().AssertDtype(dtype);
@@ -125,7 +200,7 @@ core::Tensor TransformationEstimationPointToPlane::ComputeTransformation(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
         CorrespondenceSet &corres) const {
-    // TODO: If corres empty throw Error.
+    OPEN3D_TRACE_SCOPE("t::ICP::TransformationEstimation");
     core::Device device = source.GetDevice();
     core::Dtype dtype = core::Dtype::Float32;
     source.GetPoints().AssertDtype(dtype);
@@ -136,60 +211,62 @@ core::Tensor TransformationEstimationPointToPlane::ComputeTransformation(
                 target.GetDevice().ToString(), device.ToString());
     }
 
-    core::Tensor source_select =
-            source.GetPoints().IndexGet({corres.first}).To(dtype);
-    core::Tensor target_select =
-            target.GetPoints().IndexGet({corres.second}).To(dtype);
-    core::Tensor target_n_select =
-            target.GetPointNormals().IndexGet({corres.second}).To(dtype);
-
-    core::Tensor B = ((target_select - source_select).Mul_(target_n_select))
-                             .Sum({1}, true)
-                             .To(dtype);
-
-    // --- Computing A in AX = B.
-    int64_t num_corres = source_select.GetShape()[0];
-    // Slicing normals: (nx, ny, nz) and source points: (sx, sy, sz).
-    core::Tensor nx =
-            target_n_select.GetItem({core::TensorKey::Slice(0, num_corres, 1),
-                                     core::TensorKey::Slice(0, 1, 1)});
-    core::Tensor ny =
-            target_n_select.GetItem({core::TensorKey::Slice(0, num_corres, 1),
-                                     core::TensorKey::Slice(1, 2, 1)});
-    core::Tensor nz =
-            target_n_select.GetItem({core::TensorKey::Slice(0, num_corres, 1),
-                                     core::TensorKey::Slice(2, 3, 1)});
-    core::Tensor sx =
-            source_select.GetItem({core::TensorKey::Slice(0, num_corres, 1),
-                                   core::TensorKey::Slice(0, 1, 1)});
-    core::Tensor sy =
-            source_select.GetItem({core::TensorKey::Slice(0, num_corres, 1),
-                                   core::TensorKey::Slice(1, 2, 1)});
-    core::Tensor sz =
-            source_select.GetItem({core::TensorKey::Slice(0, num_corres, 1),
-                                   core::TensorKey::Slice(2, 3, 1)});
-    // Cross product calculation.
-    core::Tensor a1 = (nz * sy) - (ny * sz);
-    core::Tensor a2 = (nx * sz) - (nz * sx);
-    core::Tensor a3 = (ny * sx) - (nx * sy);
-
-    // Putting the pieces back together.
-    core::Tensor A({num_corres, 6}, dtype, device);
-    A.SetItem({core::TensorKey::Slice(0, num_corres, 1),
-               core::TensorKey::Slice(0, 1, 1)},
-              a1);
-    A.SetItem({core::TensorKey::Slice(0, num_corres, 1),
-               core::TensorKey::Slice(1, 2, 1)},
-              a2);
-    A.SetItem({core::TensorKey::Slice(0, num_corres, 1),
-               core::TensorKey::Slice(2, 3, 1)},
-              a3);
-    A.SetItem({core::TensorKey::Slice(0, num_corres, 1),
-               core::TensorKey::Slice(3, 6, 1)},
-              target_n_select);
-
-    core::Tensor Pose = (A.LeastSquares(B)).Reshape({-1}).To(dtype);
-    return t::pipelines::PoseToTransformation(Pose);
+    // The Jacobian rows (s x n, n) and residuals (s - t) . n are reduced to
+    // J^T J and J^T r in one pass, without materializing the {N, 6} Jacobian.
+    core::Tensor system;
+    kernel::registration::ComputePointToPlaneSystem(
+            source.GetPoints().Contiguous(), target.GetPoints().Contiguous(),
+            target.GetPointNormals().To(dtype).Contiguous(),
+            GetSourceIndices(corres), corres.second.Contiguous(), kernel_,
+            system);
+    return SolveICPSystem(system, device, "point-to-plane");
+}
+
+double TransformationEstimationForColoredICP::ComputeRMSE(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        CorrespondenceSet &corres) const {
+    core::Dtype dtype = core::Dtype::Float32;
+    AssertColoredICPInputs(source, target);
+    if (corres.second.GetShape()[0] == 0) return 0.0;
+
+    // The unweighted system holds the sum of the squared residuals.
+    core::Tensor system;
+    kernel::registration::ComputeColoredICPSystem(
+            source.GetPoints().Contiguous(),
+            source.GetPointColors().To(dtype).Contiguous(),
+            target.GetPoints().Contiguous(),
+            target.GetPointNormals().To(dtype).Contiguous(),
+            target.GetPointColors().To(dtype).Contiguous(),
+            target.GetPointAttr("color_gradients").To(dtype).Contiguous(),
+            GetSourceIndices(corres), corres.second.Contiguous(),
+            lambda_geometric_, RobustKernel(RobustKernelMethod::L2Loss, 1.0),
+            system);
+    std::vector<float> A =
+            system.Copy(core::Device("CPU:0")).ToFlatVector<float>();
+    return std::sqrt(A[27] / A[28]);
+}
+
+core::Tensor TransformationEstimationForColoredICP::ComputeTransformation(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        CorrespondenceSet &corres) const {
+    OPEN3D_TRACE_SCOPE("t::ICP::TransformationEstimation");
+    core::Device device = source.GetDevice();
+    core::Dtype dtype = core::Dtype::Float32;
+    AssertColoredICPInputs(source, target);
+
+    core::Tensor system;
+    kernel::registration::ComputeColoredICPSystem(
+            source.GetPoints().Contiguous(),
+            source.GetPointColors().To(dtype).Contiguous(),
+            target.GetPoints().Contiguous(),
+            target.GetPointNormals().To(dtype).Contiguous(),
+            target.GetPointColors().To(dtype).Contiguous(),
+            target.GetPointAttr("color_gradients").To(dtype).Contiguous(),
+            GetSourceIndices(corres), corres.second.Contiguous(),
+            lambda_geometric_, kernel_, system);
+    return SolveICPSystem(system, device, "colored ICP");
 }
 
 }  // namespace registration
@@ -35,6 +35,7 @@
 #include "open3d/pipelines/registration/RobustKernel.h"
 #include "open3d/t/geometry/PointCloud.h"
 #include "open3d/t/pipelines/TransformationConverter.h"
+#include "open3d/t/pipelines/registration/RobustKernel.h"
 
 namespace open3d {
 
@@ -133,6 +134,13 @@ public:
     TransformationEstimationPointToPlane() {}
     ~TransformationEstimationPointToPlane() override {}
 
+    /// \brief Constructor that takes as input a RobustKernel.
+    ///
+    /// \param kernel Any of the implemented statistical robust kernel for
+    /// outlier rejection.
+    explicit TransformationEstimationPointToPlane(const RobustKernel &kernel)
+        : kernel_(kernel) {}
+
 public:
     TransformationEstimationType GetTransformationEstimationType()
             const override {
@@ -146,11 +154,65 @@ public:
             const geometry::PointCloud &target,
             CorrespondenceSet &corres) const override;
 
+public:
+    /// RobustKernel for outlier rejection.
+    RobustKernel kernel_ = RobustKernel(RobustKernelMethod::L2Loss, 1.0);
+
 private:
     const TransformationEstimationType type_ =
             TransformationEstimationType::PointToPlane;
 };
 
+/// \class TransformationEstimationForColoredICP
+///
+/// Class to estimate a transformation with the geometric and photometric
+/// residuals of J. Park, Q.-Y. Zhou, V. Koltun, Colored Point Cloud
+/// Registration Revisited, ICCV 2017.
+///
+/// The target needs normals, colors and the "color_gradients" attribute, which
+/// RegistrationICP computes on the device of the target when it is missing.
+class TransformationEstimationForColoredICP : public TransformationEstimation {
+public:
+    /// \brief Constructor.
+    ///
+    /// \param lambda_geometric Weight of the geometric residual, in [0, 1].
+    /// Out of range values fall back to the default 0.968.
+    /// \param kernel Robust kernel for outlier rejection.
+    explicit TransformationEstimationForColoredICP(
+            double lambda_geometric = 0.968,
+            const RobustKernel &kernel =
+                    RobustKernel(RobustKernelMethod::L2Loss, 1.0))
+        : lambda_geometric_(lambda_geometric), kernel_(kernel) {
+        if (lambda_geometric_ < 0 || lambda_geometric_ > 1.0) {
+            lambda_geometric_ = 0.968;
+        }
+    }
+    ~TransformationEstimationForColoredICP() override {}
+
+public:
+    TransformationEstimationType GetTransformationEstimationType()
+            const override {
+        return type_;
+    };
+    double ComputeRMSE(const geometry::PointCloud &source,
+                       const geometry::PointCloud &target,
+                       CorrespondenceSet &corres) const override;
+    core::Tensor ComputeTransformation(
+            const geometry::PointCloud &source,
+            const geometry::PointCloud &target,
+            CorrespondenceSet &corres) const override;
+
+public:
+    /// Weight of the geometric residual.
+    double lambda_geometric_ = 0.968;
+    /// RobustKernel for outlier rejection.
+    RobustKernel kernel_ = RobustKernel(RobustKernelMethod::L2Loss, 1.0);
+
+private:
+    const TransformationEstimationType type_ =
+            TransformationEstimationType::ColoredICP;
+};
+
 }  // namespace registration
 }  // namespace pipelines
 }  // namespace t
@@ -0,0 +1,380 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/utility/ASCIIParser.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+
+#include "open3d/utility/Console.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace utility {
+
+static bool IsDigit(char c) { return c >= '0' && c <= '9'; }
+
+static bool IsSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+/// Parses the token at \p begin with strtod, for the numbers that are not
+/// converted exactly by ParseDouble.
+static const char *ParseDoubleWithStrtod(const char *begin,
+                                         const char *end,
+                                         double &value) {
+    const char *token_end = begin;
+    while (token_end < end && !IsSpace(*token_end) && *token_end != '\n') {
+        ++token_end;
+    }
+    std::string token(begin, token_end);
+    char *parse_end;
+    value = std::strtod(token.c_str(), &parse_end);
+    return begin + (parse_end - token.c_str());
+}
+
+const char *ParseDouble(const char *begin, const char *end, double &value) {
+    // Powers of ten that are exact doubles.
+    static const double kPowersOf10[] = {
+            1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+            1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+            1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+    const uint64_t kMaxExactSignificand = uint64_t(1) << 53;
+
+    const char *p = begin;
+    bool negative = false;
+    if (p < end && (*p == '+' || *p == '-')) {
+        negative = *p == '-';
+        ++p;
+    }
+    uint64_t significand = 0;
+    int num_digits = 0;
+    int exponent = 0;
+    bool has_digits = false;
+    for (; p < end && IsDigit(*p); ++p) {
+        has_digits = true;
+        if (num_digits < 19) {
+            significand = significand * 10 + (*p - '0');
+            num_digits += significand != 0;
+        } else {
+            exponent++;
+        }
+    }
+    if (p < end && *p == '.') {
+        for (++p; p < end && IsDigit(*p); ++p) {
+            has_digits = true;
+            if (num_digits < 19) {
+                significand = significand * 10 + (*p - '0');
+                num_digits += significand != 0;
+                exponent--;
+            }
+        }
+    }
+    if (!has_digits) {
+        // nan and inf.
+        return ParseDoubleWithStrtod(begin, end, value);
+    }
+    if (p < end && (*p == 'e' || *p == 'E')) {
+        const char *q = p + 1;
+        bool negative_exponent = false;
+        if (q < end && (*q == '+' || *q == '-')) {
+            negative_exponent = *q == '-';
+            ++q;
+        }
+        if (q < end && IsDigit(*q)) {
+            int exponent_value = 0;
+            for (; q < end && IsDigit(*q); ++q) {
+                exponent_value =
+                        std::min(exponent_value * 10 + (*q - '0'), 100000);
+            }
+            exponent += negative_exponent ? -exponent_value : exponent_value;
+            p = q;
+        }
+    }
+    if (significand > kMaxExactSignificand || exponent < -22 ||
+        exponent > 22) {
+        return ParseDoubleWithStrtod(begin, end, value);
+    }
+    // Both the significand and the power of ten are exact, so the correctly
+    // rounded result is a single multiplication or division.
+    value = static_cast<double>(significand);
+    value = exponent < 0 ? value / kPowersOf10[-exponent]
+                         : value * kPowersOf10[exponent];
+    if (negative) {
+        value = -value;
+    }
+    return p;
+}
+
+const char *ParseInt64(const char *begin, const char *end, int64_t &value) {
+    const char *p = begin;
+    bool negative = false;
+    if (p < end && (*p == '+' || *p == '-')) {
+        negative = *p == '-';
+        ++p;
+    }
+    if (p == end || !IsDigit(*p)) {
+        return begin;
+    }
+    uint64_t magnitude = 0;
+    for (; p < end && IsDigit(*p); ++p) {
+        magnitude = magnitude * 10 + (*p - '0');
+    }
+    value = negative ? -static_cast<int64_t>(magnitude)
+                     : static_cast<int64_t>(magnitude);
+    return p;
+}
+
+const char *SkipASCIISpaces(const char *begin, const char *end) {
+    while (begin < end && IsSpace(*begin)) {
+        ++begin;
+    }
+    return begin;
+}
+
+bool ASCIIFileView::Open(const std::string &filename) {
+#ifndef _WIN32
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) != 0) {
+        close(fd);
+        return false;
+    }
+    size_ = static_cast<int64_t>(file_stat.st_size);
+    if (size_ == 0) {
+        close(fd);
+        return true;
+    }
+    void *data_ptr = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data_ptr == MAP_FAILED) {
+        return false;
+    }
+    int64_t size = size_;
+    mapping_ = std::shared_ptr<void>(
+            data_ptr, [size](void *ptr) { munmap(ptr, size); });
+    data_ = static_cast<const char *>(data_ptr);
+    return true;
+#else
+    filesystem::CFile file;
+    if (!file.Open(filename, "rb")) {
+        return false;
+    }
+    size_ = file.GetFileSize();
+    buffer_.resize(size_);
+    if (file.ReadData(buffer_.data(), 1, size_) !=
+        static_cast<size_t>(size_)) {
+        return false;
+    }
+    data_ = buffer_.data();
+    return true;
+#endif
+}
+
+std::vector<const char *> SplitASCIIRanges(const char *begin,
+                                          const char *end,
+                                          int64_t min_range_size) {
+    int64_t num_threads = utility::EstimateMaxThreads();
+    int64_t num_ranges = std::max<int64_t>(
+            1, std::min((end - begin) / std::max<int64_t>(min_range_size, 1),
+                        num_threads * 4));
+    std::vector<const char *> range_begins(num_ranges + 1, end);
+    range_begins[0] = begin;
+    for (int64_t r = 1; r < num_ranges; ++r) {
+        const char *split = std::max(begin + (end - begin) * r / num_ranges,
+                                     range_begins[r - 1]);
+        const char *line_end = static_cast<const char *>(
+                std::memchr(split, '\n', end - split));
+        range_begins[r] = line_end ? line_end + 1 : end;
+    }
+    return range_begins;
+}
+
+/// Parses the rows of the lines in [begin, end) and appends them to \p rows.
+static void ParseASCIIRows(const char *begin,
+                           const char *end,
+                           int64_t num_columns,
+                           std::vector<double> &rows) {
+    std::vector<double> row(num_columns);
+    const char *line = begin;
+    while (line < end) {
+        const char *line_end = static_cast<const char *>(
+                std::memchr(line, '\n', end - line));
+        line_end = line_end ? line_end : end;
+        const char *p = line;
+        int64_t c = 0;
+        for (; c < num_columns; ++c) {
+            while (p < line_end && IsSpace(*p)) {
+                ++p;
+            }
+            const char *next = ParseDouble(p, line_end, row[c]);
+            if (next == p) {
+                break;
+            }
+            p = next;
+        }
+        if (c == num_columns) {
+            rows.insert(rows.end(), row.begin(), row.end());
+        }
+        line = line_end < end ? line_end + 1 : end;
+    }
+}
+
+/// Skips up to \p num_lines lines from \p begin, and decrements \p num_lines
+/// by the number of lines skipped.
+static const char *SkipASCIILines(const char *begin,
+                                  const char *end,
+                                  int64_t &num_lines) {
+    for (; num_lines > 0 && begin < end; --num_lines) {
+        const char *line_end = static_cast<const char *>(
+                std::memchr(begin, '\n', end - begin));
+        begin = line_end ? line_end + 1 : end;
+    }
+    return begin;
+}
+
+/// Parses the rows of the lines in [begin, end) in parallel and appends them
+/// to \p rows, which holds at most \p max_rows rows unless \p max_rows is -1.
+static void AppendASCIIRows(const char *begin,
+                            const char *end,
+                            int64_t num_columns,
+                            int64_t max_rows,
+                            std::vector<double> &rows) {
+    // Split the lines into ranges of at least 1 MB, starting after newlines.
+    std::vector<const char *> range_begins =
+            SplitASCIIRanges(begin, end, 1 << 20);
+    int64_t num_ranges = static_cast<int64_t>(range_begins.size()) - 1;
+
+    std::vector<std::vector<double>> range_rows(num_ranges);
+#pragma omp parallel for schedule(dynamic) num_threads(utility::EstimateMaxThreads())
+    for (int64_t r = 0; r < num_ranges; ++r) {
+        ParseASCIIRows(range_begins[r], range_begins[r + 1], num_columns,
+                       range_rows[r]);
+    }
+
+    // Concatenate the rows of the ranges at their prefix sums.
+    std::vector<int64_t> offsets(num_ranges + 1, 0);
+    for (int64_t r = 0; r < num_ranges; ++r) {
+        offsets[r + 1] =
+                offsets[r] + static_cast<int64_t>(range_rows[r].size());
+    }
+    int64_t base = static_cast<int64_t>(rows.size());
+    int64_t num_values = offsets[num_ranges];
+    if (max_rows >= 0) {
+        num_values = std::max<int64_t>(
+                0, std::min(num_values, max_rows * num_columns - base));
+    }
+    rows.resize(base + num_values);
+#pragma omp parallel for schedule(dynamic) num_threads(utility::EstimateMaxThreads())
+    for (int64_t r = 0; r < num_ranges; ++r) {
+        int64_t count = std::min(static_cast<int64_t>(range_rows[r].size()),
+                                 num_values - offsets[r]);
+        if (count > 0) {
+            std::copy(range_rows[r].begin(), range_rows[r].begin() + count,
+                      rows.begin() + base + offsets[r]);
+        }
+    }
+}
+
+bool ReadASCIIRows(const std::string &filename,
+                   int64_t num_columns,
+                   std::vector<double> &rows,
+                   int64_t skip_lines /* = 0*/,
+                   int64_t max_rows /* = -1*/) {
+    rows.clear();
+    ASCIIFileView view;
+    if (!view.Open(filename)) {
+        return false;
+    }
+    const char *end = view.GetData() + view.GetSize();
+    const char *data = SkipASCIILines(view.GetData(), end, skip_lines);
+    AppendASCIIRows(data, end, num_columns, max_rows, rows);
+    return true;
+}
+
+bool ReadASCIIRows(const ASCIIStreamReader &read,
+                   int64_t num_columns,
+                   std::vector<double> &rows,
+                   int64_t skip_lines /* = 0*/,
+                   int64_t max_rows /* = -1*/,
+                   int64_t block_size /* = 1 << 24*/) {
+    rows.clear();
+    std::vector<char> buffer(std::max<int64_t>(block_size, 1));
+    int64_t size = 0;
+    bool is_end = false;
+    while (!is_end &&
+           (max_rows < 0 ||
+            static_cast<int64_t>(rows.size()) < max_rows * num_columns)) {
+        // Fill the buffer, which is only grown for a line longer than it.
+        if (size == static_cast<int64_t>(buffer.size())) {
+            buffer.resize(buffer.size() * 2);
+        }
+        while (!is_end && size < static_cast<int64_t>(buffer.size())) {
+            int64_t count = read(buffer.data() + size,
+                                 static_cast<int64_t>(buffer.size()) - size);
+            if (count < 0) {
+                return false;
+            }
+            is_end = count == 0;
+            size += count;
+        }
+
+        // Parse the complete lines, and all of the data at the end.
+        const char *begin = buffer.data();
+        const char *end = begin + size;
+        const char *parse_end = end;
+        if (!is_end) {
+            while (parse_end > begin && parse_end[-1] != '\n') {
+                --parse_end;
+            }
+            if (parse_end == begin) {
+                continue;
+            }
+        }
+        begin = SkipASCIILines(begin, parse_end, skip_lines);
+        AppendASCIIRows(begin, parse_end, num_columns, max_rows, rows);
+
+        size = end - parse_end;
+        std::memmove(buffer.data(), parse_end, size);
+    }
+    return true;
+}
+
+}  // namespace utility
+}  // namespace open3d
@@ -0,0 +1,136 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace open3d {
+namespace utility {
+
+/// \brief Parses a floating point number in [\p begin, \p end), which does not
+/// need to be null-terminated.
+///
+/// Decimal numbers whose significand and power of ten are exact doubles are
+/// converted without rounding errors and without locale lookups; other
+/// numbers, nan and inf fall back to strtod.
+///
+/// \param begin First character of the number.
+/// \param end End of the buffer.
+/// \param value Output value.
+/// \return Pointer past the number, or \p begin if it is not a number.
+const char *ParseDouble(const char *begin, const char *end, double &value);
+
+/// \brief Parses a decimal integer in [\p begin, \p end).
+///
+/// \return Pointer past the number, or \p begin if it is not a number.
+const char *ParseInt64(const char *begin, const char *end, int64_t &value);
+
+/// Returns the first character in [\p begin, \p end) that is not a space or
+/// a tab, or \p end. Newlines are not skipped.
+const char *SkipASCIISpaces(const char *begin, const char *end);
+
+/// Read-only view of the content of a file, memory mapped where supported.
+class ASCIIFileView {
+public:
+    /// Opens the file. An empty file gives an empty view.
+    bool Open(const std::string &filename);
+
+    const char *GetData() const { return data_; }
+    int64_t GetSize() const { return size_; }
+
+private:
+    const char *data_ = nullptr;
+    int64_t size_ = 0;
+    std::shared_ptr<void> mapping_;
+    std::vector<char> buffer_;
+};
+
+/// \brief Splits the lines in [\p begin, \p end) into ranges to be parsed in
+/// parallel.
+///
+/// \param min_range_size Minimum size of a range in bytes.
+/// \return The beginnings of the ranges, which start after newlines, followed
+/// by \p end.
+std::vector<const char *> SplitASCIIRanges(const char *begin,
+                                          const char *end,
+                                          int64_t min_range_size);
+
+/// \brief Reads the rows of numbers of an ASCII file in parallel.
+///
+/// The file is memory mapped where supported, and its lines are split into
+/// one range per task at newline boundaries. Each line that starts with at
+/// least \p num_columns numbers separated by whitespace gives a row of these
+/// numbers; the rest of the line is ignored, and other lines are skipped, as
+/// by sscanf. The rows of the ranges are concatenated in file order.
+///
+/// \param filename Path to the ASCII file.
+/// \param num_columns Number of numbers of a row.
+/// \param rows Output row-major values of the rows.
+/// \param skip_lines Number of header lines to skip.
+/// \param max_rows Maximum number of rows, or -1 for all the rows.
+/// \return False if the file cannot be read.
+bool ReadASCIIRows(const std::string &filename,
+                   int64_t num_columns,
+                   std::vector<double> &rows,
+                   int64_t skip_lines = 0,
+                   int64_t max_rows = -1);
+
+/// \brief Reads up to \p size bytes of a stream into \p data.
+///
+/// \return The number of bytes read, 0 at the end of the stream, or -1 on
+/// errors.
+using ASCIIStreamReader = std::function<int64_t(char *data, int64_t size)>;
+
+/// \brief Reads the rows of numbers of an ASCII stream, such as a
+/// decompressed file, in parallel blocks.
+///
+/// The stream is read into a buffer of \p block_size bytes whose complete
+/// lines are parsed as by ReadASCIIRows above, and the last partial line is
+/// moved to the start of the buffer for the next block. The buffer only grows
+/// for lines longer than a block, so that the stream is never held in memory
+/// as a whole.
+///
+/// \param read Reader of the stream.
+/// \param num_columns Number of numbers of a row.
+/// \param rows Output row-major values of the rows.
+/// \param skip_lines Number of header lines to skip.
+/// \param max_rows Maximum number of rows, or -1 for all the rows.
+/// \param block_size Size of the blocks parsed in parallel.
+/// \return False if the stream cannot be read.
+bool ReadASCIIRows(const ASCIIStreamReader &read,
+                   int64_t num_columns,
+                   std::vector<double> &rows,
+                   int64_t skip_lines = 0,
+                   int64_t max_rows = -1,
+                   int64_t block_size = 1 << 24);
+
+}  // namespace utility
+}  // namespace open3d
@@ -30,6 +30,7 @@
 #include <Eigen/Sparse>
 
 #include "open3d/utility/Console.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace utility {
@@ -171,7 +172,7 @@ std::tuple<MatType, VecType, double> ComputeJTJandJTr(
     double r2_sum = 0.0;
     JTJ.setZero();
     JTr.setZero();
-#pragma omp parallel
+#pragma omp parallel num_threads(utility::EstimateMaxThreads())
     {
         MatType JTJ_private;
         VecType JTr_private;
@@ -216,7 +217,7 @@ std::tuple<MatType, VecType, double> ComputeJTJandJTr(
     double r2_sum = 0.0;
     JTJ.setZero();
     JTr.setZero();
-#pragma omp parallel
+#pragma omp parallel num_threads(utility::EstimateMaxThreads())
     {
         MatType JTJ_private;
         VecType JTr_private;
@@ -303,11 +304,18 @@ Eigen::Vector3d ColorToDouble(const Eigen::Vector3uint8 &rgb) {
 template <typename IdxType>
 Eigen::Matrix3d ComputeCovariance(const std::vector<Eigen::Vector3d> &points,
                                   const std::vector<IdxType> &indices) {
+    return ComputeCovariance(points, indices.data(), indices.size());
+}
+
+template <typename IdxType>
+Eigen::Matrix3d ComputeCovariance(const std::vector<Eigen::Vector3d> &points,
+                                  const IdxType *indices,
+                                  size_t num_indices) {
     Eigen::Matrix3d covariance;
     Eigen::Matrix<double, 9, 1> cumulants;
     cumulants.setZero();
-    for (const auto &idx : indices) {
-        const Eigen::Vector3d &point = points[idx];
+    for (size_t i = 0; i < num_indices; i++) {
+        const Eigen::Vector3d &point = points[indices[i]];
         cumulants(0) += point(0);
         cumulants(1) += point(1);
         cumulants(2) += point(2);
@@ -318,7 +326,7 @@ Eigen::Matrix3d ComputeCovariance(const std::vector<Eigen::Vector3d> &points,
         cumulants(7) += point(1) * point(2);
         cumulants(8) += point(2) * point(2);
     }
-    cumulants /= (double)indices.size();
+    cumulants /= (double)num_indices;
     covariance(0, 0) = cumulants(3) - cumulants(0) * cumulants(0);
     covariance(1, 1) = cumulants(6) - cumulants(1) * cumulants(1);
     covariance(2, 2) = cumulants(8) - cumulants(2) * cumulants(2);
@@ -379,5 +387,13 @@ template Eigen::Matrix3d ComputeCovariance(
 template std::tuple<Eigen::Vector3d, Eigen::Matrix3d> ComputeMeanAndCovariance(
         const std::vector<Eigen::Vector3d> &points,
         const std::vector<int> &indices);
+template Eigen::Matrix3d ComputeCovariance(
+        const std::vector<Eigen::Vector3d> &points,
+        const size_t *indices,
+        size_t num_indices);
+template Eigen::Matrix3d ComputeCovariance(
+        const std::vector<Eigen::Vector3d> &points,
+        const int *indices,
+        size_t num_indices);
 }  // namespace utility
 }  // namespace open3d
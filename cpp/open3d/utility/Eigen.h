@@ -134,6 +134,13 @@ template <typename IdxType>
 Eigen::Matrix3d ComputeCovariance(const std::vector<Eigen::Vector3d> &points,
                                   const std::vector<IdxType> &indices);
 
+/// Function to compute the covariance matrix of a set of points, with the
+/// point indices given as an array of \p num_indices elements.
+template <typename IdxType>
+Eigen::Matrix3d ComputeCovariance(const std::vector<Eigen::Vector3d> &points,
+                                  const IdxType *indices,
+                                  size_t num_indices);
+
 /// Function to compute the mean and covariance matrix of a set of points.
 template <typename IdxType>
 std::tuple<Eigen::Vector3d, Eigen::Matrix3d> ComputeMeanAndCovariance(
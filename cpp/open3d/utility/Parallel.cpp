@@ -0,0 +1,113 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/utility/Parallel.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+#include <tbb/global_control.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace utility {
+
+static std::atomic<int> g_max_threads(0);
+static thread_local int t_scoped_max_threads = 0;
+
+int EstimateMaxThreads() {
+    if (t_scoped_max_threads > 0) {
+        return t_scoped_max_threads;
+    }
+    if (InParallel()) {
+        return 1;
+    }
+    int max_threads = g_max_threads.load(std::memory_order_relaxed);
+    if (max_threads > 0) {
+        return max_threads;
+    }
+#ifdef _OPENMP
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+}
+
+void SetMaxThreads(int num_threads) {
+    if (num_threads < 0) {
+        utility::LogError("Number of threads must be non-negative, but got {}.",
+                          num_threads);
+    }
+    static std::mutex mutex;
+    static std::unique_ptr<tbb::global_control> tbb_control;
+    std::lock_guard<std::mutex> lock(mutex);
+    g_max_threads = num_threads;
+    tbb_control.reset();
+    if (num_threads > 0) {
+        tbb_control = std::make_unique<tbb::global_control>(
+                tbb::global_control::max_allowed_parallelism, num_threads);
+    }
+}
+
+int GetMaxThreads() { return g_max_threads.load(std::memory_order_relaxed); }
+
+bool InParallel() {
+#ifdef _OPENMP
+    return omp_in_parallel();
+#else
+    return false;
+#endif
+}
+
+bool AreThreadsBound() {
+#ifdef _OPENMP
+    return omp_get_proc_bind() != omp_proc_bind_false;
+#else
+    return false;
+#endif
+}
+
+ScopedMaxThreads::ScopedMaxThreads(int num_threads)
+    : prev_num_threads_(t_scoped_max_threads) {
+    if (num_threads <= 0) {
+        utility::LogError("Number of threads must be positive, but got {}.",
+                          num_threads);
+    }
+    t_scoped_max_threads = num_threads;
+}
+
+ScopedMaxThreads::~ScopedMaxThreads() {
+    t_scoped_max_threads = prev_num_threads_;
+}
+
+}  // namespace utility
+}  // namespace open3d
@@ -0,0 +1,83 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+/// \file Parallel.h
+/// \brief Single control of the CPU parallelism of Open3D.
+///
+/// All OpenMP parallel regions of Open3D size their thread team with
+/// EstimateMaxThreads(). The count can be set globally with SetMaxThreads(),
+/// or for the calling thread with ScopedMaxThreads, e.g. to split the cores
+/// between several pipelines running concurrently in one process.
+
+#pragma once
+
+namespace open3d {
+namespace utility {
+
+/// Returns the number of threads a parallel region started by the calling
+/// thread should use:
+/// 1. The innermost ScopedMaxThreads of the calling thread, if any.
+/// 2. 1 if already inside a parallel region, so that nested calls do not
+/// oversubscribe the cores.
+/// 3. The count set with SetMaxThreads(), if any.
+/// 4. The OpenMP default, i.e. OMP_NUM_THREADS or the number of cores.
+int EstimateMaxThreads();
+
+/// Sets the number of threads used by parallel regions process-wide. Also caps
+/// the parallelism of TBB algorithms. 0 restores the default.
+void SetMaxThreads(int num_threads);
+
+/// Returns the count set with SetMaxThreads(), or 0 if unset.
+int GetMaxThreads();
+
+/// Returns true if called from inside a parallel region.
+bool InParallel();
+
+/// Returns true if the OpenMP threads are bound to places, i.e. OMP_PROC_BIND
+/// is set and not false. Thread i of a static schedule then stays on the same
+/// cores, and on the same NUMA node, across parallel regions.
+bool AreThreadsBound();
+
+/// \class ScopedMaxThreads
+///
+/// Overrides the number of threads of the parallel regions started by the
+/// calling thread within the scope. Also used inside a parallel region to
+/// explicitly allow nested parallelism.
+class ScopedMaxThreads {
+public:
+    explicit ScopedMaxThreads(int num_threads);
+    ~ScopedMaxThreads();
+
+    ScopedMaxThreads(const ScopedMaxThreads&) = delete;
+    ScopedMaxThreads& operator=(const ScopedMaxThreads&) = delete;
+
+private:
+    int prev_num_threads_;
+};
+
+}  // namespace utility
+}  // namespace open3d
@@ -0,0 +1,336 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/utility/Trace.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace utility {
+namespace trace {
+
+namespace {
+
+/// Device tracks are numbered after all thread tracks.
+constexpr uint32_t kFirstDeviceTrack = 1u << 20;
+
+/// Number of events of exited threads that are kept.
+constexpr size_t kRetiredEventCapacity = 1 << 16;
+
+/// Fixed-capacity ring buffer of the events of one thread. The mutex is only
+/// contended while the events are being collected.
+struct ThreadBuffer {
+    ThreadBuffer(size_t capacity, uint32_t track)
+        : events(capacity), track(track) {}
+
+    void Push(const TraceEvent& event) {
+        events[next] = event;
+        next = (next + 1) % events.size();
+        size = std::min(size + 1, events.size());
+    }
+
+    /// Appends the events, oldest first, to \p output.
+    void CopyTo(std::vector<TraceEvent>& output) const {
+        const size_t capacity = events.size();
+        const size_t first = (next + capacity - size) % capacity;
+        for (size_t i = 0; i < size; ++i) {
+            output.push_back(events[(first + i) % capacity]);
+        }
+    }
+
+    std::mutex mutex;
+    std::vector<TraceEvent> events;
+    size_t next = 0;
+    size_t size = 0;
+    uint32_t track;
+};
+
+class TraceRegistry {
+public:
+    static TraceRegistry& GetInstance() {
+        static TraceRegistry instance;
+        return instance;
+    }
+
+    TraceRegistry()
+        : retired_(std::make_shared<ThreadBuffer>(kRetiredEventCapacity, 0)) {
+        buffers_.push_back(retired_);
+    }
+
+    std::shared_ptr<ThreadBuffer> CreateThreadBuffer() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto buffer = std::make_shared<ThreadBuffer>(capacity_, next_track_++);
+        buffers_.push_back(buffer);
+        return buffer;
+    }
+
+    /// Moves the events of an exiting thread into the shared buffer of
+    /// retired events, and unregisters the buffer of the thread.
+    void RetireThreadBuffer(const std::shared_ptr<ThreadBuffer>& buffer) {
+        std::vector<TraceEvent> events;
+        {
+            std::lock_guard<std::mutex> lock(buffer->mutex);
+            buffer->CopyTo(events);
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        {
+            std::lock_guard<std::mutex> retired_lock(retired_->mutex);
+            for (const TraceEvent& event : events) {
+                retired_->Push(event);
+            }
+        }
+        buffers_.erase(std::remove(buffers_.begin(), buffers_.end(), buffer),
+                       buffers_.end());
+    }
+
+    uint32_t DeviceTrack(const std::string& device_name) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = device_tracks_.find(device_name);
+        if (it != device_tracks_.end()) {
+            return it->second;
+        }
+        uint32_t track = kFirstDeviceTrack +
+                         static_cast<uint32_t>(device_tracks_.size());
+        device_tracks_[device_name] = track;
+        return track;
+    }
+
+    std::atomic<bool> enabled_{false};
+    std::mutex mutex_;
+    size_t capacity_ = 1 << 16;
+    uint32_t next_track_ = 1;
+    /// Events of exited threads, also the first entry of buffers_.
+    std::shared_ptr<ThreadBuffer> retired_;
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers_;
+    std::unordered_map<std::string, uint32_t> device_tracks_;
+    std::vector<std::function<void()>> flush_callbacks_;
+};
+
+/// Registers the buffer of a thread, and retires it when the thread exits so
+/// that the registry does not grow with the number of threads ever started.
+struct ThreadBufferOwner {
+    ThreadBufferOwner()
+        : buffer(TraceRegistry::GetInstance().CreateThreadBuffer()) {}
+    ~ThreadBufferOwner() {
+        TraceRegistry::GetInstance().RetireThreadBuffer(buffer);
+    }
+
+    std::shared_ptr<ThreadBuffer> buffer;
+};
+
+ThreadBuffer& GetThreadBuffer() {
+    thread_local ThreadBufferOwner owner;
+    return *owner.buffer;
+}
+
+void AppendJSONString(std::string& json, const std::string& str) {
+    json += '"';
+    for (char c : str) {
+        switch (c) {
+            case '"':
+                json += "\\\"";
+                break;
+            case '\\':
+                json += "\\\\";
+                break;
+            case '\b':
+                json += "\\b";
+                break;
+            case '\f':
+                json += "\\f";
+                break;
+            case '\n':
+                json += "\\n";
+                break;
+            case '\r':
+                json += "\\r";
+                break;
+            case '\t':
+                json += "\\t";
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    json += fmt::format("\\u{:04x}", static_cast<int>(c));
+                } else {
+                    json += c;
+                }
+        }
+    }
+    json += '"';
+}
+
+}  // namespace
+
+void SetEnabled(bool enabled) {
+    TraceRegistry::GetInstance().enabled_.store(enabled,
+                                                std::memory_order_relaxed);
+}
+
+bool IsEnabled() {
+    return TraceRegistry::GetInstance().enabled_.load(
+            std::memory_order_relaxed);
+}
+
+void SetThreadBufferCapacity(size_t capacity) {
+    if (capacity == 0) {
+        utility::LogError("Trace buffer capacity must be positive.");
+    }
+    TraceRegistry& registry = TraceRegistry::GetInstance();
+    std::lock_guard<std::mutex> lock(registry.mutex_);
+    registry.capacity_ = capacity;
+}
+
+int64_t NowMicroseconds() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+}
+
+uint32_t CurrentThreadTrack() { return GetThreadBuffer().track; }
+
+uint32_t DeviceTrack(const std::string& device_name) {
+    return TraceRegistry::GetInstance().DeviceTrack(device_name);
+}
+
+void RecordEvent(const char* name,
+                 int64_t begin_us,
+                 int64_t end_us,
+                 uint32_t track) {
+    ThreadBuffer& buffer = GetThreadBuffer();
+    std::lock_guard<std::mutex> lock(buffer.mutex);
+    buffer.Push({name, begin_us, end_us - begin_us, track});
+}
+
+void AddFlushCallback(const std::function<void()>& callback) {
+    TraceRegistry& registry = TraceRegistry::GetInstance();
+    std::lock_guard<std::mutex> lock(registry.mutex_);
+    registry.flush_callbacks_.push_back(callback);
+}
+
+std::vector<TraceEvent> GetEvents() {
+    TraceRegistry& registry = TraceRegistry::GetInstance();
+    std::vector<std::function<void()>> callbacks;
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+    {
+        std::lock_guard<std::mutex> lock(registry.mutex_);
+        callbacks = registry.flush_callbacks_;
+    }
+    // Callbacks record events themselves, so they run without the lock.
+    for (const auto& callback : callbacks) {
+        callback();
+    }
+    {
+        std::lock_guard<std::mutex> lock(registry.mutex_);
+        buffers = registry.buffers_;
+    }
+
+    std::vector<TraceEvent> events;
+    for (const auto& buffer : buffers) {
+        std::lock_guard<std::mutex> lock(buffer->mutex);
+        buffer->CopyTo(events);
+    }
+    std::stable_sort(events.begin(), events.end(),
+                     [](const TraceEvent& a, const TraceEvent& b) {
+                         // Enclosing events first, as they end last.
+                         if (a.begin_us != b.begin_us) {
+                             return a.begin_us < b.begin_us;
+                         }
+                         return a.duration_us > b.duration_us;
+                     });
+    return events;
+}
+
+void Clear() {
+    TraceRegistry& registry = TraceRegistry::GetInstance();
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+    {
+        std::lock_guard<std::mutex> lock(registry.mutex_);
+        buffers = registry.buffers_;
+    }
+    for (const auto& buffer : buffers) {
+        std::lock_guard<std::mutex> lock(buffer->mutex);
+        buffer->next = 0;
+        buffer->size = 0;
+    }
+}
+
+std::string ToChromeTraceJSON() {
+    std::vector<TraceEvent> events = GetEvents();
+    std::unordered_map<uint32_t, std::string> track_names;
+    {
+        TraceRegistry& registry = TraceRegistry::GetInstance();
+        std::lock_guard<std::mutex> lock(registry.mutex_);
+        for (const auto& kv : registry.device_tracks_) {
+            track_names[kv.second] = kv.first;
+        }
+    }
+
+    std::string json = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool first = true;
+    for (const auto& kv : track_names) {
+        json += first ? "" : ",";
+        json += fmt::format(
+                "{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,"
+                "\"tid\":{},\"args\":{{\"name\":",
+                kv.first);
+        AppendJSONString(json, kv.second);
+        json += "}}";
+        first = false;
+    }
+    for (const TraceEvent& event : events) {
+        json += first ? "{\"name\":" : ",{\"name\":";
+        AppendJSONString(json, event.name);
+        json += fmt::format(
+                ",\"cat\":\"open3d\",\"ph\":\"X\",\"pid\":0,\"tid\":{},"
+                "\"ts\":{},\"dur\":{}}}",
+                event.track, event.begin_us, event.duration_us);
+        first = false;
+    }
+    json += "]}";
+    return json;
+}
+
+bool WriteChromeTrace(const std::string& filename) {
+    std::ofstream file(filename);
+    if (!file.is_open()) {
+        utility::LogWarning("Unable to write trace file {}.", filename);
+        return false;
+    }
+    file << ToChromeTraceJSON();
+    return file.good();
+}
+
+}  // namespace trace
+}  // namespace utility
+}  // namespace open3d
@@ -0,0 +1,139 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+/// \file Trace.h
+/// \brief Low-overhead scoped tracing with Chrome trace export.
+///
+/// Instrument code with OPEN3D_TRACE_SCOPE("Category::Name"). The macro is
+/// compiled out unless Open3D is built with BUILD_TRACING, and is a cheap
+/// check of an atomic flag while tracing is disabled at runtime. Events are
+/// kept in fixed-size per-thread ring buffers, so long runs keep the most
+/// recent events; the events of exited threads move to a shared ring buffer.
+/// Call trace::WriteChromeTrace() to dump them in the Chrome trace event
+/// format, which chrome://tracing and Perfetto can open.
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace open3d {
+namespace utility {
+namespace trace {
+
+/// A completed span of work.
+struct TraceEvent {
+    /// Name of the span. Must be a string literal or otherwise outlive the
+    /// recorder, as only the pointer is stored.
+    const char* name;
+    /// Begin time in microseconds, see NowMicroseconds().
+    int64_t begin_us;
+    /// Duration in microseconds.
+    int64_t duration_us;
+    /// Track the event is displayed on, i.e. the thread or device id.
+    uint32_t track;
+};
+
+/// Enables or disables recording at runtime. Disabled by default.
+void SetEnabled(bool enabled);
+
+/// Returns true if events are being recorded.
+bool IsEnabled();
+
+/// Sets the number of events kept per thread. Applies to threads that record
+/// their first event afterwards.
+void SetThreadBufferCapacity(size_t capacity);
+
+/// Microseconds on a monotonic clock, the time base of all events.
+int64_t NowMicroseconds();
+
+/// Returns the track of the calling thread.
+uint32_t CurrentThreadTrack();
+
+/// Returns the track reserved for a device, e.g. CUDA:0 work.
+uint32_t DeviceTrack(const std::string& device_name);
+
+/// Records a completed event in the ring buffer of the calling thread.
+void RecordEvent(const char* name,
+                 int64_t begin_us,
+                 int64_t end_us,
+                 uint32_t track = CurrentThreadTrack());
+
+/// Registers a function called before events are collected, e.g. to resolve
+/// asynchronous device timings into events.
+void AddFlushCallback(const std::function<void()>& callback);
+
+/// Returns the recorded events of all threads, ordered by begin time.
+std::vector<TraceEvent> GetEvents();
+
+/// Discards all recorded events.
+void Clear();
+
+/// Returns the recorded events in the Chrome trace event JSON format.
+std::string ToChromeTraceJSON();
+
+/// Writes the recorded events to \p filename in the Chrome trace event JSON
+/// format. Returns false if the file cannot be written.
+bool WriteChromeTrace(const std::string& filename);
+
+/// \class ScopedTrace
+///
+/// Records an event spanning its lifetime on the calling thread.
+class ScopedTrace {
+public:
+    explicit ScopedTrace(const char* name)
+        : name_(name), begin_us_(IsEnabled() ? NowMicroseconds() : -1) {}
+
+    ~ScopedTrace() {
+        if (begin_us_ >= 0) {
+            RecordEvent(name_, begin_us_, NowMicroseconds());
+        }
+    }
+
+    ScopedTrace(const ScopedTrace&) = delete;
+    ScopedTrace& operator=(const ScopedTrace&) = delete;
+
+private:
+    const char* name_;
+    int64_t begin_us_;
+};
+
+}  // namespace trace
+}  // namespace utility
+}  // namespace open3d
+
+#define OPEN3D_TRACE_CONCAT_IMPL(a, b) a##b
+#define OPEN3D_TRACE_CONCAT(a, b) OPEN3D_TRACE_CONCAT_IMPL(a, b)
+
+#ifdef BUILD_TRACING
+#define OPEN3D_TRACE_SCOPE(name)                               \
+    ::open3d::utility::trace::ScopedTrace OPEN3D_TRACE_CONCAT( \
+            open3d_trace_scope_, __LINE__)(name)
+#else
+#define OPEN3D_TRACE_SCOPE(name)
+#endif
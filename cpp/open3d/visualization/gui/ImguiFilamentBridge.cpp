@@ -495,6 +495,9 @@ void ImguiFilamentBridge::PopulateVertexData(size_t buffer_index,
                     ib_filament_data, num_ib_bytes,
                     [](void* buffer, size_t size, void* user) { free(buffer); },
                     /* user = */ nullptr));
+
+    visualization::rendering::EngineInstance::GetResourceManager()
+            .AddUploadedBytes(num_vb_bytes + num_ib_bytes);
 }
 
 void ImguiFilamentBridge::SyncThreads() {
@@ -48,6 +48,10 @@ struct ListView::Impl {
     std::string imgui_id_;
     std::vector<std::string> items_;
     int selected_index_ = NO_SELECTION;
+    // Widest item text, cached since measuring thousands of items is slow.
+    // Negative if it needs to be measured.
+    float max_text_width_ = -1.0f;
+    int max_text_width_font_size_ = -1;
     std::function<void(const char *, bool)> on_value_changed_;
 };
 
@@ -62,6 +66,7 @@ ListView::~ListView() {}
 void ListView::SetItems(const std::vector<std::string> &items) {
     impl_->items_ = items;
     impl_->selected_index_ = NO_SELECTION;
+    impl_->max_text_width_ = -1.0f;
 }
 
 int ListView::GetSelectedIndex() const { return impl_->selected_index_; }
@@ -86,16 +91,21 @@ void ListView::SetOnValueChanged(
 
 Size ListView::CalcPreferredSize(const Theme &theme) const {
     auto padding = ImGui::GetStyle().FramePadding;
-    auto *font = ImGui::GetFont();
-    ImVec2 size(0, 0);
-
-    for (auto &item : impl_->items_) {
-        auto item_size = font->CalcTextSizeA(
-                float(theme.font_size), Widget::DIM_GROW, 0.0, item.c_str());
-        size.x = std::max(size.x, item_size.x);
-        size.y += ImGui::GetFrameHeight();
+    if (impl_->max_text_width_ < 0.0f ||
+        impl_->max_text_width_font_size_ != theme.font_size) {
+        auto *font = ImGui::GetFont();
+        float width = 0.0f;
+        for (auto &item : impl_->items_) {
+            auto item_size = font->CalcTextSizeA(float(theme.font_size),
+                                                 Widget::DIM_GROW, 0.0,
+                                                 item.c_str());
+            width = std::max(width, item_size.x);
+        }
+        impl_->max_text_width_ = width;
+        impl_->max_text_width_font_size_ = theme.font_size;
     }
-    return Size(int(std::ceil(size.x + 2.0f * padding.x)), Widget::DIM_GROW);
+    return Size(int(std::ceil(impl_->max_text_width_ + 2.0f * padding.x)),
+                Widget::DIM_GROW);
 }
 
 Widget::DrawResult ListView::Draw(const DrawContext &context) {
@@ -121,35 +131,41 @@ Widget::DrawResult ListView::Draw(const DrawContext &context) {
     DrawImGuiPushEnabledState();
     if (ImGui::ListBoxHeader(impl_->imgui_id_.c_str(),
                              int(impl_->items_.size()), height_in_items)) {
-        for (size_t i = 0; i < impl_->items_.size(); ++i) {
-            bool is_selected = (int(i) == impl_->selected_index_);
-            // ImGUI's list wants to hover over items, which is not done by
-            // any major OS, is pretty unnecessary (you can see the cursor
-            // right over the row), and acts really weird. Worse, the hover
-            // is drawn instead of the selection color. So to get rid of it
-            // we need hover to be the selected color iff this item is
-            // selected, otherwise we want it to be transparent.
-            if (is_selected) {
-                ImGui::PushStyleColor(
-                        ImGuiCol_HeaderHovered,
-                        colorToImgui(context.theme.list_selected_color));
-            } else {
-                ImGui::PushStyleColor(ImGuiCol_HeaderHovered,
-                                      colorToImgui(Color(0, 0, 0, 0)));
-            }
-            if (ImGui::Selectable(impl_->items_[i].c_str(), &is_selected,
-                                  ImGuiSelectableFlags_AllowDoubleClick)) {
+        // Only submit the rows that are visible, so that long lists do not
+        // cost anything extra to draw.
+        ImGuiListClipper clipper;
+        clipper.Begin(int(impl_->items_.size()));
+        while (clipper.Step()) {
+            for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; ++i) {
+                bool is_selected = (i == impl_->selected_index_);
+                // ImGUI's list wants to hover over items, which is not done by
+                // any major OS, is pretty unnecessary (you can see the cursor
+                // right over the row), and acts really weird. Worse, the hover
+                // is drawn instead of the selection color. So to get rid of it
+                // we need hover to be the selected color iff this item is
+                // selected, otherwise we want it to be transparent.
                 if (is_selected) {
-                    new_selected_idx = int(i);
+                    ImGui::PushStyleColor(
+                            ImGuiCol_HeaderHovered,
+                            colorToImgui(context.theme.list_selected_color));
+                } else {
+                    ImGui::PushStyleColor(ImGuiCol_HeaderHovered,
+                                          colorToImgui(Color(0, 0, 0, 0)));
                 }
-                // Dear ImGUI seems to have a bug where it registers a
-                // double-click as long as you haven't moved the mouse,
-                // no matter how long the time between clicks was.
-                if (ImGui::IsMouseDoubleClicked(0)) {
-                    is_double_click = true;
+                if (ImGui::Selectable(impl_->items_[i].c_str(), &is_selected,
+                                      ImGuiSelectableFlags_AllowDoubleClick)) {
+                    if (is_selected) {
+                        new_selected_idx = i;
+                    }
+                    // Dear ImGUI seems to have a bug where it registers a
+                    // double-click as long as you haven't moved the mouse,
+                    // no matter how long the time between clicks was.
+                    if (ImGui::IsMouseDoubleClicked(0)) {
+                        is_double_click = true;
+                    }
                 }
+                ImGui::PopStyleColor();
             }
-            ImGui::PopStyleColor();
         }
         ImGui::ListBoxFooter();
 
@@ -26,7 +26,7 @@
 
 #include "open3d/visualization/gui/PickPointsInteractor.h"
 
-#include <unordered_map>
+#include <algorithm>
 
 #include "open3d/geometry/Image.h"
 #include "open3d/geometry/PointCloud.h"
@@ -39,6 +39,7 @@
 #include "open3d/visualization/rendering/Open3DScene.h"
 #include "open3d/visualization/rendering/Scene.h"
 #include "open3d/visualization/rendering/View.h"
+#include "open3d/visualization/utility/PickIndexBuffer.h"
 
 #define WANT_DEBUG_IMAGE 0
 
@@ -81,6 +82,30 @@ uint32_t GetIndexForColor(geometry::Image *image, int x, int y) {
     return (red | green | blue);
 }
 
+// Decodes the point indices of the pixels in the rectangle only, so that the
+// cost of a pick does not depend on the size of the pick image.
+PickIndexBuffer DecodeRegion(geometry::Image *image,
+                             size_t n_points,
+                             int x,
+                             int y,
+                             int width,
+                             int height) {
+    const int x0 = std::max(0, x);
+    const int y0 = std::max(0, y);
+    const int x1 = std::min(image->width_, x + width);
+    const int y1 = std::min(image->height_, y + height);
+    PickIndexBuffer buffer(x0, y0, x1 - x0, y1 - y0);
+    for (int py = y0; py < y1; ++py) {
+        for (int px = x0; px < x1; ++px) {
+            const uint32_t idx = GetIndexForColor(image, px, py);
+            if (IsValidIndex(idx) && idx < n_points) {
+                buffer.SetIndex(px, py, idx);
+            }
+        }
+    }
+    return buffer;
+}
+
 }  // namespace
 
 // ----------------------------------------------------------------------------
@@ -257,11 +282,36 @@ void PickPointsInteractor::SetOnPointsPicked(
 }
 
 void PickPointsInteractor::Mouse(const MouseEvent &e) {
-    if (e.type == MouseEvent::BUTTON_UP) {
-        gui::Rect pick_rect(e.x, e.y, 1, 1);
+    if (e.type == MouseEvent::BUTTON_DOWN) {
+        lasso_.clear();
+        lasso_.emplace_back(e.x, e.y);
+    } else if (e.type == MouseEvent::DRAG) {
+        if (!lasso_.empty() &&
+            (lasso_.back() - Eigen::Vector2d(e.x, e.y)).norm() >= 2.0) {
+            lasso_.emplace_back(e.x, e.y);
+        }
+    } else if (e.type == MouseEvent::BUTTON_UP) {
+        PickInfo info{gui::Rect(e.x, e.y, 1, 1), {}, e.modifiers};
+        // A drag larger than a point selects the points inside the lasso,
+        // otherwise this is a click.
+        if (lasso_.size() >= 3) {
+            Eigen::Vector2d min_bound = lasso_[0], max_bound = lasso_[0];
+            for (auto &p : lasso_) {
+                min_bound = min_bound.cwiseMin(p);
+                max_bound = max_bound.cwiseMax(p);
+            }
+            if ((max_bound - min_bound).maxCoeff() > point_size_) {
+                info.rect = gui::Rect(int(min_bound.x()), int(min_bound.y()),
+                                      int(max_bound.x() - min_bound.x()) + 1,
+                                      int(max_bound.y() - min_bound.y()) + 1);
+                info.polygon = lasso_;
+            }
+        }
+        lasso_.clear();
+
         if (dirty_) {
             SetNeedsRedraw();  // note: clears pending_
-            pending_.push({pick_rect, e.modifiers});
+            pending_.push(info);
             auto *view = picking_scene_->GetView();
             view->SetViewport(0, 0,  // in case scene widget changed size
                               matrix_logic_.GetViewWidth(),
@@ -278,7 +328,7 @@ void PickPointsInteractor::Mouse(const MouseEvent &e) {
                         this->OnPickImageDone(img);
                     });
         } else {
-            pending_.push({pick_rect, e.modifiers});
+            pending_.push(info);
             OnPickImageDone(pick_image_);
         }
     }
@@ -307,19 +357,24 @@ void PickPointsInteractor::OnPickImageDone(
     std::map<std::string, std::vector<std::pair<size_t, Eigen::Vector3d>>>
             indices;
     while (!pending_.empty()) {
-        PickInfo &info = pending_.back();
+        PickInfo &info = pending_.front();
         const int x0 = info.rect.x;
-        const int x1 = info.rect.GetRight();
         const int y0 = info.rect.y;
-        const int y1 = info.rect.GetBottom();
         auto *img = pick_image_.get();
         indices.clear();
-        if (x1 - x0 == 1 && y1 - y0 == 1) {
-            struct Score {  // this is a struct to force a default value
-                float score = 0;
-            };
-            std::unordered_map<unsigned int, Score> candidates;
-            auto clicked_idx = GetIndexForColor(img, x0, y0);
+        auto add_index = [this, &indices](uint32_t idx) {
+            auto &o = lookup_->ObjectForIndex(idx);
+            size_t obj_idx = idx - o.start_index;
+            indices[o.name].push_back(std::pair<size_t, Eigen::Vector3d>(
+                    obj_idx, points_[idx]));
+        };
+        if (info.polygon.empty() && info.rect.width == 1 &&
+            info.rect.height == 1) {
+            uint32_t clicked_idx = kMeshIndex;
+            if (x0 >= 0 && y0 >= 0 && x0 < img->width_ &&
+                y0 < img->height_) {
+                clicked_idx = GetIndexForColor(img, x0, y0);
+            }
             int radius;
             // HACK: the color for kMeshIndex doesn't come back quite right.
             //       We shouldn't need to check if the index is out of range,
@@ -334,52 +389,29 @@ void PickPointsInteractor::OnPickImageDone(
                 // close.
                 radius = 2 * point_size_;
             }
-            for (int y = y0 - radius; y < y0 + radius; ++y) {
-                for (int x = x0 - radius; x < x0 + radius; ++x) {
-                    unsigned int idx = GetIndexForColor(img, x, y);
-                    if (IsValidIndex(idx) && idx < points_.size()) {
-                        float dist = std::sqrt(float((x - x0) * (x - x0) +
-                                                     (y - y0) * (y - y0)));
-                        candidates[idx].score += radius - dist;
-                    }
-                }
-            }
-            if (!candidates.empty()) {
-                // Note that scores are (radius - dist), and since we take from
-                // a square pattern, a score can be negative. And multiple
-                // pixels of a point scoring negatively can make the negative up
-                // to -point_size^2.
-                float best_score = -1e30f;
-                unsigned int best_idx = (unsigned int)-1;
-                for (auto &idx_score : candidates) {
-                    if (idx_score.second.score > best_score) {
-                        best_score = idx_score.second.score;
-                        best_idx = idx_score.first;
-                    }
-                }
-                auto &o = lookup_->ObjectForIndex(best_idx);
-                size_t obj_idx = best_idx - o.start_index;
-                indices[o.name].push_back(std::pair<size_t, Eigen::Vector3d>(
-                        obj_idx, points_[best_idx]));
+            auto buffer = DecodeRegion(img, points_.size(), x0 - radius,
+                                       y0 - radius, 2 * radius, 2 * radius);
+            const uint32_t idx = buffer.GetNearestIndex(x0, y0, radius);
+            if (idx != PickIndexBuffer::kNoIndex) {
+                add_index(idx);
             }
         } else {
-            for (int y = y0; y < y1; ++y) {
-                for (int x = x0; x < x1; ++x) {
-                    unsigned int idx = GetIndexForColor(img, x, y);
-                    if (IsValidIndex(idx)) {
-                        auto &o = lookup_->ObjectForIndex(idx);
-                        size_t obj_idx = idx - o.start_index;
-                        indices[o.name].push_back(
-                                std::pair<size_t, Eigen::Vector3d>(
-                                        obj_idx, points_[idx]));
-                    }
-                }
+            auto buffer = DecodeRegion(img, points_.size(), x0, y0,
+                                       info.rect.width, info.rect.height);
+            const auto picked =
+                    info.polygon.empty()
+                            ? buffer.GetIndicesInRect(x0, y0, info.rect.width,
+                                                      info.rect.height)
+                            : buffer.GetIndicesInPolygon(info.polygon);
+            for (uint32_t idx : picked) {
+                add_index(idx);
             }
         }
+        const int keymods = info.keymods;
         pending_.pop();
 
         if (on_picked_ && !indices.empty()) {
-            on_picked_(indices, info.keymods);
+            on_picked_(indices, keymods);
         }
     }
 }
@@ -107,9 +107,13 @@ private:
     bool dirty_ = true;
     struct PickInfo {
         gui::Rect rect;
+        // Selects the points inside the polygon if not empty.
+        std::vector<Eigen::Vector2d> polygon;
         int keymods;
     };
     std::queue<PickInfo> pending_;
+    // The lasso being dragged, in pixels.
+    std::vector<Eigen::Vector2d> lasso_;
 };
 
 }  // namespace gui
@@ -32,6 +32,7 @@
 #include <list>
 #include <sstream>
 #include <unordered_map>
+#include <vector>
 
 #include "open3d/visualization/gui/Checkbox.h"
 #include "open3d/visualization/gui/ColorEdit.h"
@@ -224,8 +225,19 @@ struct TreeView::Impl {
         TreeView::ItemId id = -1;
         std::string id_string;
         std::shared_ptr<Widget> cell;
+        // Creates `cell` the first time it is needed (see AddLazyItem())
+        std::function<std::shared_ptr<Widget>()> create_cell;
         Item *parent = nullptr;
         std::list<Item> children;
+        bool is_open = true;
+        // Distance from the top of this row to the top of the next one,
+        // measured when the row was last drawn; -1 if it never was.
+        float row_height = -1.0f;
+    };
+    // A row of the tree as displayed: an item whose ancestors are all open.
+    struct Row {
+        Item *item;
+        int depth;
     };
     int id_;
     Item root_;
@@ -233,6 +245,36 @@ struct TreeView::Impl {
     TreeView::ItemId selected_id_ = -1;
     bool can_select_parents_ = false;
     std::function<void(TreeView::ItemId)> on_selection_changed_;
+    std::vector<Row> rows_;
+    bool rows_need_update_ = true;
+    // Height of the most recently drawn row, used for rows not drawn yet
+    float estimated_row_height_ = -1.0f;
+
+    std::shared_ptr<Widget> &GetCell(Item &item) {
+        if (!item.cell && item.create_cell) {
+            item.cell = item.create_cell();
+            item.create_cell = nullptr;
+        }
+        return item.cell;
+    }
+
+    void UpdateRows() {
+        if (!rows_need_update_) {
+            return;
+        }
+        rows_.clear();
+        std::function<void(Item &, int)> AddRows;
+        AddRows = [this, &AddRows](Item &parent, int depth) {
+            for (auto &child : parent.children) {
+                rows_.push_back({&child, depth});
+                if (child.is_open) {
+                    AddRows(child, depth + 1);
+                }
+            }
+        };
+        AddRows(root_, 0);
+        rows_need_update_ = false;
+    }
 };
 
 TreeView::ItemId TreeView::Impl::g_next_id = 0;
@@ -249,13 +291,19 @@ TreeView::ItemId TreeView::GetRootItem() const { return impl_->root_.id; }
 
 TreeView::ItemId TreeView::AddItem(ItemId parent_id,
                                    std::shared_ptr<Widget> w) {
+    return AddLazyItem(parent_id, [w]() { return w; });
+}
+
+TreeView::ItemId TreeView::AddLazyItem(
+        ItemId parent_id,
+        std::function<std::shared_ptr<Widget>()> create_cell) {
     Impl::Item item;
     item.id = Impl::g_next_id++;
     // ImGUI uses the text to identify the item, create a ID string
     std::stringstream s;
     s << "treeview" << impl_->id_ << "item" << item.id;
     item.id_string = s.str();
-    item.cell = w;
+    item.create_cell = create_cell;
 
     Impl::Item *parent = &impl_->root_;
     auto parent_it = impl_->id2item_.find(parent_id);
@@ -265,6 +313,7 @@ TreeView::ItemId TreeView::AddItem(ItemId parent_id,
     item.parent = parent;
     parent->children.push_back(item);
     impl_->id2item_[item.id] = &parent->children.back();
+    impl_->rows_need_update_ = true;
 
     return item.id;
 }
@@ -277,6 +326,7 @@ TreeView::ItemId TreeView::AddTextItem(ItemId parent_id, const char *text) {
 void TreeView::RemoveItem(ItemId item_id) {
     auto item_it = impl_->id2item_.find(item_id);
     if (item_it != impl_->id2item_.end()) {
+        impl_->rows_need_update_ = true;
         auto item = item_it->second;
         // Erase the item here, because RemoveItem(child) will also erase,
         // which will invalidate our iterator.
@@ -309,12 +359,14 @@ void TreeView::Clear() {
     impl_->selected_id_ = -1;
     impl_->id2item_.clear();
     impl_->root_.children.clear();
+    impl_->rows_.clear();
+    impl_->rows_need_update_ = true;
 }
 
 std::shared_ptr<Widget> TreeView::GetItem(ItemId item_id) const {
     auto item_it = impl_->id2item_.find(item_id);
     if (item_it != impl_->id2item_.end()) {
-        return item_it->second->cell;
+        return impl_->GetCell(*item_it->second);
     }
     return nullptr;
 }
@@ -401,10 +453,42 @@ Widget::DrawResult TreeView::Draw(const DrawContext &context) {
 
     Impl::Item *new_selection = nullptr;
 
-    std::function<void(Impl::Item &)> DrawItem;
-    DrawItem = [&DrawItem, this, &frame, &context, &new_selection,
-                &result](Impl::Item &item) {
-        int height = item.cell->CalcPreferredSize(context.theme).height;
+    // Only the rows that intersect the visible part of the tree are laid out
+    // and drawn, so that the cost of drawing does not depend on the number
+    // of items. The rows above and below are skipped over by moving the
+    // cursor, using the height each row had when it was last drawn (or an
+    // estimate if it never was), which also gives ImGUI the full content
+    // height for the scrollbar.
+    impl_->UpdateRows();
+    auto RowHeight = [this](const Impl::Row &row) {
+        if (row.item->row_height > 0.0f) {
+            return row.item->row_height;
+        } else if (impl_->estimated_row_height_ > 0.0f) {
+            return impl_->estimated_row_height_;
+        }
+        return ImGui::GetFrameHeightWithSpacing();
+    };
+    auto indent_width = ImGui::GetStyle().IndentSpacing;
+    auto view_top = ImGui::GetScrollY();
+    auto view_bottom = view_top + float(frame.height);
+    auto &rows = impl_->rows_;
+    auto y = ImGui::GetCursorPosY();
+    size_t row_idx = 0;
+    for (; row_idx < rows.size(); ++row_idx) {
+        auto h = RowHeight(rows[row_idx]);
+        if (y + h > view_top) {
+            break;
+        }
+        y += h;
+    }
+    ImGui::SetCursorPosY(y);
+
+    bool is_open_changed = false;
+    for (; row_idx < rows.size() && y < view_bottom; ++row_idx) {
+        auto &item = *rows[row_idx].item;
+        auto &cell = impl_->GetCell(item);
+        int height = (cell ? cell->CalcPreferredSize(context.theme).height
+                           : int(ImGui::GetFrameHeight()));
 
         // ImGUI's tree doesn't seem to support selected items,
         // so we have to draw our own selection.
@@ -413,15 +497,17 @@ Widget::DrawResult TreeView::Draw(const DrawContext &context) {
             // of the tree's frame. To draw directly to the window list we
             // need to the absolute coordinates (relative the OS window's
             // upper left)
-            auto y = frame.y + ImGui::GetCursorPosY() - ImGui::GetScrollY();
+            auto sel_y = frame.y + y - ImGui::GetScrollY();
             ImGui::GetWindowDrawList()->AddRectFilled(
-                    ImVec2(float(frame.x), y),
-                    ImVec2(float(frame.GetRight()), y + height),
+                    ImVec2(float(frame.x), sel_y),
+                    ImVec2(float(frame.GetRight()), sel_y + height),
                     colorToImguiRGBA(context.theme.tree_selected_color));
         }
 
-        int flags = ImGuiTreeNodeFlags_DefaultOpen |
-                    ImGuiTreeNodeFlags_AllowItemOverlap;
+        // We draw a flat list of rows, so the tree node must not push onto
+        // the ID stack or indent; we do that ourselves.
+        int flags = ImGuiTreeNodeFlags_AllowItemOverlap |
+                    ImGuiTreeNodeFlags_NoTreePushOnOpen;
         if (impl_->can_select_parents_) {
             flags |= ImGuiTreeNodeFlags_OpenOnDoubleClick;
             flags |= ImGuiTreeNodeFlags_OpenOnArrow;
@@ -431,24 +517,35 @@ Widget::DrawResult TreeView::Draw(const DrawContext &context) {
         }
         bool is_selectable =
                 (item.children.empty() || impl_->can_select_parents_);
-        auto DrawThis = [this, &tree_frame = frame, &context, &new_selection,
-                         &result](TreeView::Impl::Item &item, int height,
-                                  bool is_selectable) {
+
+        auto indent = float(rows[row_idx].depth) * indent_width;
+        if (indent > 0.0f) {
+            ImGui::Indent(indent);
+        }
+        ImGui::SetNextTreeNodeOpen(item.is_open);
+        bool is_open =
+                ImGui::TreeNodeEx(item.id_string.c_str(), flags, "%s", "");
+        if (!item.children.empty() && is_open != item.is_open) {
+            item.is_open = is_open;
+            is_open_changed = true;
+        }
+
+        if (cell) {
+            ImGui::PushID(item.id_string.c_str());
             ImGui::SameLine(0, 0);
             auto x = int(std::round(ImGui::GetCursorScreenPos().x));
-            auto y = int(std::round(ImGui::GetCursorScreenPos().y));
+            auto cell_y = int(std::round(ImGui::GetCursorScreenPos().y));
             auto scroll_width = int(ImGui::GetStyle().ScrollbarSize);
-            auto indent = x - tree_frame.x;
-            item.cell->SetFrame(Rect(
-                    x, y, tree_frame.width - indent - scroll_width, height));
+            auto cell_width = frame.width - (x - frame.x) - scroll_width;
+            cell->SetFrame(Rect(x, cell_y, cell_width, height));
             // Now that we know the frame we can finally layout. It would be
             // nice to not relayout until something changed, which would
             // usually work, unless the cell changes shape in response to
             // something, which would be a problem. So do it every time.
-            item.cell->Layout(context.theme);
+            cell->Layout(context.theme);
 
             ImGui::BeginGroup();
-            auto this_result = item.cell->Draw(context);
+            auto this_result = cell->Draw(context);
             if (this_result == Widget::DrawResult::REDRAW) {
                 result = Widget::DrawResult::REDRAW;
             }
@@ -458,21 +555,28 @@ Widget::DrawResult TreeView::Draw(const DrawContext &context) {
                 impl_->selected_id_ = item.id;
                 new_selection = &item;
             }
-        };
+            ImGui::PopID();
+        }
+        if (indent > 0.0f) {
+            ImGui::Unindent(indent);
+        }
 
-        if (ImGui::TreeNodeEx(item.id_string.c_str(), flags, "%s", "")) {
-            DrawThis(item, height, is_selectable);
+        auto next_y = ImGui::GetCursorPosY();
+        item.row_height = next_y - y;
+        impl_->estimated_row_height_ = item.row_height;
+        y = next_y;
+    }
 
-            for (auto &child : item.children) {
-                DrawItem(child);
-            }
-            ImGui::TreePop();
-        } else {
-            DrawThis(item, height, is_selectable);
-        }
-    };
-    for (auto &top : impl_->root_.children) {
-        DrawItem(top);
+    for (; row_idx < rows.size(); ++row_idx) {
+        y += RowHeight(rows[row_idx]);
+    }
+    ImGui::SetCursorPosY(y);
+
+    // Opening or closing an item changes which rows are displayed, but the
+    // rows were already drawn, so draw again with the new rows.
+    if (is_open_changed) {
+        impl_->rows_need_update_ = true;
+        result = Widget::DrawResult::REDRAW;
     }
 
     ImGui::EndChild();
@@ -116,13 +116,19 @@ public:
     ItemId GetRootItem() const;
     /// Adds an item to the tree.
     ItemId AddItem(ItemId parent_id, std::shared_ptr<Widget> item);
+    /// Adds an item whose widget is not created until it is first needed,
+    /// that is, when the row scrolls into view or GetItem() is called.
+    /// This keeps trees with thousands of items cheap to build.
+    ItemId AddLazyItem(ItemId parent_id,
+                       std::function<std::shared_ptr<Widget>()> create_cell);
     /// Adds a text item to the tree
     ItemId AddTextItem(ItemId parent_id, const char* text);
     /// Removes an item an all its children (if any) from the tree
     void RemoveItem(ItemId item_id);
     /// Clears all the items
     void Clear();
-    /// Returns item, or nullptr if item_id cannot be found.
+    /// Returns item, or nullptr if item_id cannot be found. If the item
+    /// was added with AddLazyItem(), this creates its widget.
     std::shared_ptr<Widget> GetItem(ItemId item_id) const;
     std::vector<ItemId> GetItemChildren(ItemId parent_id) const;
 
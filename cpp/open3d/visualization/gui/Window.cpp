@@ -38,6 +38,7 @@
 #include <vector>
 
 #include "open3d/utility/Console.h"
+#include "open3d/utility/Timer.h"
 #include "open3d/visualization/gui/Application.h"
 #include "open3d/visualization/gui/Button.h"
 #include "open3d/visualization/gui/Dialog.h"
@@ -68,6 +69,21 @@ static constexpr int AUTOSIZE_HEIGHT = 0;
 static constexpr int FALLBACK_MONITOR_WIDTH = 1024;
 static constexpr int FALLBACK_MONITOR_HEIGHT = 768;
 
+// Adds the time from its construction to its destruction to a total.
+class EventTimer {
+public:
+    explicit EventTimer(double& total_ms)
+        : total_ms_(total_ms),
+          start_ms_(utility::Timer::GetSystemTimeInMilliseconds()) {}
+    ~EventTimer() {
+        total_ms_ += utility::Timer::GetSystemTimeInMilliseconds() - start_ms_;
+    }
+
+private:
+    double& total_ms_;
+    double start_ms_;
+};
+
 // Assumes the correct ImGuiContext is current
 void UpdateImGuiForScaling(float new_scaling) {
     ImGuiStyle& style = ImGui::GetStyle();
@@ -193,6 +209,10 @@ struct Window::Impl {
     bool needs_redraw_ = true;  // set by PostRedraw to defer if already drawing
     bool is_resizing_ = false;
     bool is_drawing_ = false;
+
+    visualization::rendering::FrameStatisticsHistory frame_stats_;
+    double events_ms_ = 0.0;  // since the last frame
+    bool show_frame_stats_ = false;
 };
 
 Window::Window(const std::string& title, int flags /*= 0*/)
@@ -719,6 +739,20 @@ void Window::ShowMessageBox(const char* title, const char* message) {
     ShowDialog(dlg);
 }
 
+void Window::ShowFrameStatistics(bool show) {
+    impl_->show_frame_stats_ = show;
+    PostRedraw();
+}
+
+bool Window::IsShowingFrameStatistics() const {
+    return impl_->show_frame_stats_;
+}
+
+const visualization::rendering::FrameStatisticsHistory&
+Window::GetFrameStatistics() const {
+    return impl_->frame_stats_;
+}
+
 void Window::Layout(const Theme& theme) {
     if (impl_->children_.size() == 1) {
         auto r = GetContentRect();
@@ -796,6 +830,49 @@ Widget::DrawResult DrawChild(DrawContext& dc,
 
     return result;
 }
+void DrawFrameStatistics(
+        const visualization::rendering::FrameStatisticsHistory& history,
+        const Point& pos,
+        int em) {
+    const auto& last = history.GetLast();
+    const auto average = history.GetAverage();
+
+    ImGui::SetNextWindowPos(ImVec2(float(pos.x), float(pos.y)));
+    ImGui::SetNextWindowBgAlpha(0.75f);
+    ImGui::Begin("Frame statistics", nullptr,
+                 ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoInputs |
+                         ImGuiWindowFlags_NoNav |
+                         ImGuiWindowFlags_AlwaysAutoResize |
+                         ImGuiWindowFlags_NoSavedSettings);
+    ImGui::Text("%-14s %7s %7s", "ms", "last", "average");
+    auto Row = [](const char* name, double last_ms, double average_ms) {
+        ImGui::Text("%-14s %7.2f %7.2f", name, last_ms, average_ms);
+    };
+    Row("Events", last.events_ms, average.events_ms);
+    Row("GUI", last.gui_ms, average.gui_ms);
+    Row("Scene update", last.scene_update_ms, average.scene_update_ms);
+    Row("Begin frame", last.begin_frame_ms, average.begin_frame_ms);
+    Row("Render", last.render_ms, average.render_ms);
+    Row("End frame", last.end_frame_ms, average.end_frame_ms);
+    Row("Frame", last.frame_ms, average.frame_ms);
+    ImGui::Separator();
+    ImGui::Text("Uploads      %10.1f KB", double(last.upload_bytes) / 1024.0);
+    ImGui::Text("Draw calls   %10zu", last.draw_calls);
+    ImGui::Text("Triangles    %10zu", last.triangles);
+    ImGui::Text("Lines        %10zu", last.lines);
+    ImGui::Text("Points       %10zu", last.points);
+
+    // Frame times of the last frames, scaled to at least 30 fps
+    auto times = history.GetFrameTimes();
+    float max_ms = 1000.0f / 30.0f;
+    for (float t : times) {
+        max_ms = std::max(max_ms, t);
+    }
+    ImGui::PlotHistogram("##frame_times", times.data(), int(times.size()), 0,
+                         nullptr, 0.0f, max_ms,
+                         ImVec2(float(16 * em), float(3 * em)));
+    ImGui::End();
+}
 }  // namespace
 
 Widget::DrawResult Window::DrawOnce(bool is_layout_pass) {
@@ -813,6 +890,7 @@ Widget::DrawResult Window::DrawOnce(bool is_layout_pass) {
 
     bool needs_layout = false;
     bool needs_redraw = false;
+    const double gui_start_ms = utility::Timer::GetSystemTimeInMilliseconds();
 
     // ImGUI uses the dt parameter to calculate double-clicks, so it
     // needs to be reasonably accurate.
@@ -936,6 +1014,13 @@ Widget::DrawResult Window::DrawOnce(bool is_layout_pass) {
         ImGui::PopStyleVar(2);
     }
 
+    // Draw the statistics of the previous frames over everything else
+    if (impl_->show_frame_stats_ && !impl_->frame_stats_.IsEmpty()) {
+        auto content = GetContentRect();
+        DrawFrameStatistics(impl_->frame_stats_,
+                            Point(content.x + em / 2, content.y + em / 2), em);
+    }
+
     // Finish frame and generate the commands
     ImGui::PopFont();
     ImGui::EndFrame();
@@ -948,9 +1033,20 @@ Widget::DrawResult Window::DrawOnce(bool is_layout_pass) {
     // draw, and if we are drawing for layout purposes, don't actually
     // draw, because we are just going to draw again after this returns.
     if (!is_layout_pass) {
+        const double gui_ms =
+                utility::Timer::GetSystemTimeInMilliseconds() - gui_start_ms;
         impl_->renderer_->BeginFrame();
         impl_->renderer_->Draw();
         impl_->renderer_->EndFrame();
+
+        auto stats = impl_->renderer_->GetFrameStatistics();
+        stats.events_ms = impl_->events_ms_;
+        stats.gui_ms = gui_ms;
+        stats.frame_ms = stats.events_ms + stats.gui_ms +
+                         stats.scene_update_ms + stats.begin_frame_ms +
+                         stats.render_ms + stats.end_frame_ms;
+        impl_->frame_stats_.Add(stats);
+        impl_->events_ms_ = 0.0;
     }
 
     if (needs_layout) {
@@ -1084,6 +1180,7 @@ void Window::OnResize() {
 }
 
 void Window::OnMouseEvent(const MouseEvent& e) {
+    EventTimer timer(impl_->events_ms_);
     MakeDrawContextCurrent();
 
     // We don't have a good way of determining when resizing ends; the most
@@ -1199,6 +1296,7 @@ void Window::OnMouseEvent(const MouseEvent& e) {
 }
 
 void Window::OnKeyEvent(const KeyEvent& e) {
+    EventTimer timer(impl_->events_ms_);
     auto this_mod = 0;
     if (e.key == KEY_LSHIFT || e.key == KEY_RSHIFT) {
         this_mod = int(KeyModifier::SHIFT);
@@ -1232,6 +1330,7 @@ void Window::OnKeyEvent(const KeyEvent& e) {
 }
 
 void Window::OnTextInput(const TextInputEvent& e) {
+    EventTimer timer(impl_->events_ms_);
     auto old_context = MakeDrawContextCurrent();
     ImGuiIO& io = ImGui::GetIO();
     io.AddInputCharactersUTF8(e.utf8);
@@ -1239,6 +1338,7 @@ void Window::OnTextInput(const TextInputEvent& e) {
 }
 
 bool Window::OnTickEvent(const TickEvent& e) {
+    EventTimer timer(impl_->events_ms_);
     auto old_context = MakeDrawContextCurrent();
     bool redraw = false;
 
@@ -150,6 +150,17 @@ public:
 
     void ShowMessageBox(const char* title, const char* message);
 
+    /// Shows or hides an overlay with the timings of the last frame (events,
+    /// GUI layout, scene updates, and Filament's beginFrame(), render and
+    /// endFrame()), the bytes uploaded, the draw calls and primitives, and
+    /// a rolling histogram of the frame times.
+    void ShowFrameStatistics(bool show);
+    bool IsShowingFrameStatistics() const;
+    /// Returns the statistics of the last frames drawn by the window. They
+    /// are recorded whether or not the overlay is shown.
+    const visualization::rendering::FrameStatisticsHistory&
+    GetFrameStatistics() const;
+
     /// This is for internal use in rare circumstances when the destructor
     /// will not be called in a timely fashion.
     void DestroyWindow();
@@ -0,0 +1,148 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/visualization/rendering/BoundingVolumeHierarchy.h"
+
+#include <algorithm>
+#include <array>
+#include <numeric>
+
+namespace open3d {
+namespace visualization {
+namespace rendering {
+
+BoundingVolumeHierarchy::BoundingVolumeHierarchy(
+        const std::vector<geometry::AxisAlignedBoundingBox>& boxes) {
+    items_.resize(boxes.size());
+    std::iota(items_.begin(), items_.end(), 0);
+    if (!boxes.empty()) {
+        nodes_.reserve(2 * (boxes.size() / MAX_LEAF_SIZE + 1));
+        Build(boxes, 0, boxes.size());
+    }
+}
+
+int BoundingVolumeHierarchy::Build(
+        const std::vector<geometry::AxisAlignedBoundingBox>& boxes,
+        size_t first,
+        size_t count) {
+    const int node_idx = int(nodes_.size());
+    nodes_.emplace_back();
+
+    Eigen::Vector3d min_bound = boxes[items_[first]].min_bound_;
+    Eigen::Vector3d max_bound = boxes[items_[first]].max_bound_;
+    Eigen::Vector3d min_center = boxes[items_[first]].GetCenter();
+    Eigen::Vector3d max_center = min_center;
+    for (size_t i = first; i < first + count; ++i) {
+        const auto& box = boxes[items_[i]];
+        min_bound = min_bound.cwiseMin(box.min_bound_);
+        max_bound = max_bound.cwiseMax(box.max_bound_);
+        min_center = min_center.cwiseMin(box.GetCenter());
+        max_center = max_center.cwiseMax(box.GetCenter());
+    }
+
+    int left = -1, right = -1;
+    if (count > size_t(MAX_LEAF_SIZE)) {
+        int axis;
+        (max_center - min_center).maxCoeff(&axis);
+        auto begin = items_.begin() + first;
+        auto middle = begin + count / 2;
+        std::nth_element(begin, middle, begin + count,
+                         [&boxes, axis](size_t a, size_t b) {
+                             return boxes[a].GetCenter()(axis) <
+                                    boxes[b].GetCenter()(axis);
+                         });
+        left = Build(boxes, first, count / 2);
+        right = Build(boxes, first + count / 2, count - count / 2);
+    }
+
+    // The recursion may have reallocated nodes_.
+    Node& node = nodes_[node_idx];
+    node.min_bound = min_bound.cast<float>();
+    node.max_bound = max_bound.cast<float>();
+    node.left = left;
+    node.right = right;
+    node.first = first;
+    node.count = count;
+    return node_idx;
+}
+
+std::vector<size_t> BoundingVolumeHierarchy::SelectInFrustum(
+        const Eigen::Matrix4f& view_projection) const {
+    std::vector<size_t> selected;
+    if (nodes_.empty()) {
+        return selected;
+    }
+
+    // The planes of the frustum, with normals inside, from the rows of the
+    // matrix. The near and far planes are those of -w <= z <= w, which also
+    // hold for a 0 <= z <= w or reversed depth range.
+    const Eigen::RowVector4f w = view_projection.row(3);
+    const std::array<Eigen::RowVector4f, 6> planes = {
+            {w + view_projection.row(0), w - view_projection.row(0),
+             w + view_projection.row(1), w - view_projection.row(1),
+             w + view_projection.row(2), w - view_projection.row(2)}};
+
+    // Each entry is a node and the planes it may still cross, as a bit mask.
+    std::vector<std::pair<int, int>> stack = {{0, (1 << 6) - 1}};
+    while (!stack.empty()) {
+        const Node& node = nodes_[stack.back().first];
+        int crossed = stack.back().second;
+        stack.pop_back();
+
+        bool outside = false;
+        for (int i = 0; i < 6 && !outside; ++i) {
+            if (!(crossed & (1 << i))) continue;
+            const Eigen::RowVector4f& plane = planes[i];
+            // The corners farthest along and against the normal.
+            Eigen::Vector3f positive, negative;
+            for (int k = 0; k < 3; ++k) {
+                const bool along = plane(k) >= 0.0f;
+                positive(k) = along ? node.max_bound(k) : node.min_bound(k);
+                negative(k) = along ? node.min_bound(k) : node.max_bound(k);
+            }
+            if (plane.head<3>().dot(positive) + plane(3) < 0.0f) {
+                outside = true;
+            } else if (plane.head<3>().dot(negative) + plane(3) >= 0.0f) {
+                crossed &= ~(1 << i);
+            }
+        }
+
+        if (outside) {
+            continue;
+        } else if (crossed == 0 || node.left < 0) {
+            selected.insert(selected.end(), items_.begin() + node.first,
+                            items_.begin() + node.first + node.count);
+        } else {
+            stack.emplace_back(node.left, crossed);
+            stack.emplace_back(node.right, crossed);
+        }
+    }
+    return selected;
+}
+
+}  // namespace rendering
+}  // namespace visualization
+}  // namespace open3d
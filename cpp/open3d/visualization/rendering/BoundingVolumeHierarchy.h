@@ -0,0 +1,84 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <vector>
+
+#include "open3d/geometry/BoundingVolume.h"
+
+namespace open3d {
+namespace visualization {
+namespace rendering {
+
+/// Bounding volume hierarchy over the bounding boxes of the geometries of a
+/// scene, so that the geometries in the view frustum are found in time
+/// proportional to their number rather than to the size of the scene.
+class BoundingVolumeHierarchy {
+public:
+    /// Maximum number of items in a leaf.
+    static const int MAX_LEAF_SIZE = 4;
+
+    struct Node {
+        Eigen::Vector3f min_bound = Eigen::Vector3f::Zero();
+        Eigen::Vector3f max_bound = Eigen::Vector3f::Zero();
+        /// Children of an inner node, -1 for a leaf.
+        int left = -1;
+        int right = -1;
+        /// The items of the subtree are items_[first, first + count).
+        size_t first = 0;
+        size_t count = 0;
+    };
+
+    BoundingVolumeHierarchy() {}
+    /// Builds the hierarchy over \p boxes by splitting the items at the
+    /// median of the longest axis. The items are the indices of the boxes.
+    explicit BoundingVolumeHierarchy(
+            const std::vector<geometry::AxisAlignedBoundingBox>& boxes);
+
+    size_t GetNumItems() const { return items_.size(); }
+    const std::vector<Node>& GetNodes() const { return nodes_; }
+
+    /// Returns the items whose boxes intersect the frustum of
+    /// \p view_projection, the matrix from world to clip coordinates. Like
+    /// the usual plane tests, this is conservative: a box outside of the
+    /// frustum but near its edges may be returned.
+    std::vector<size_t> SelectInFrustum(
+            const Eigen::Matrix4f& view_projection) const;
+
+private:
+    int Build(const std::vector<geometry::AxisAlignedBoundingBox>& boxes,
+              size_t first,
+              size_t count);
+
+    std::vector<Node> nodes_;
+    std::vector<size_t> items_;
+};
+
+}  // namespace rendering
+}  // namespace visualization
+}  // namespace open3d
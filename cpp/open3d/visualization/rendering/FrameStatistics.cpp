@@ -0,0 +1,109 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/visualization/rendering/FrameStatistics.h"
+
+#include <algorithm>
+
+namespace open3d {
+namespace visualization {
+namespace rendering {
+
+FrameStatistics& FrameStatistics::operator+=(const FrameStatistics& other) {
+    events_ms += other.events_ms;
+    gui_ms += other.gui_ms;
+    scene_update_ms += other.scene_update_ms;
+    begin_frame_ms += other.begin_frame_ms;
+    render_ms += other.render_ms;
+    end_frame_ms += other.end_frame_ms;
+    frame_ms += other.frame_ms;
+    upload_bytes += other.upload_bytes;
+    draw_calls += other.draw_calls;
+    triangles += other.triangles;
+    lines += other.lines;
+    points += other.points;
+    return *this;
+}
+
+FrameStatisticsHistory::FrameStatisticsHistory(size_t capacity)
+    : capacity_(std::max(capacity, size_t(1))) {}
+
+void FrameStatisticsHistory::Add(const FrameStatistics& stats) {
+    if (frames_.size() >= capacity_) {
+        frames_.pop_front();
+    }
+    frames_.push_back(stats);
+}
+
+FrameStatistics FrameStatisticsHistory::GetAverage() const {
+    FrameStatistics sum;
+    if (frames_.empty()) {
+        return sum;
+    }
+    for (const auto& frame : frames_) {
+        sum += frame;
+    }
+    const size_t n = frames_.size();
+    sum.events_ms /= double(n);
+    sum.gui_ms /= double(n);
+    sum.scene_update_ms /= double(n);
+    sum.begin_frame_ms /= double(n);
+    sum.render_ms /= double(n);
+    sum.end_frame_ms /= double(n);
+    sum.frame_ms /= double(n);
+    sum.upload_bytes /= n;
+    sum.draw_calls /= n;
+    sum.triangles /= n;
+    sum.lines /= n;
+    sum.points /= n;
+    return sum;
+}
+
+std::vector<float> FrameStatisticsHistory::GetFrameTimes() const {
+    std::vector<float> times;
+    times.reserve(frames_.size());
+    for (const auto& frame : frames_) {
+        times.push_back(float(frame.frame_ms));
+    }
+    return times;
+}
+
+std::vector<int> FrameStatisticsHistory::GetFrameTimeHistogram(
+        int num_bins, double bin_ms) const {
+    std::vector<int> histogram(std::max(num_bins, 0), 0);
+    if (histogram.empty() || bin_ms <= 0.0) {
+        return histogram;
+    }
+    for (const auto& frame : frames_) {
+        int bin = int(std::max(frame.frame_ms, 0.0) / bin_ms);
+        histogram[std::min(bin, num_bins - 1)]++;
+    }
+    return histogram;
+}
+
+}  // namespace rendering
+}  // namespace visualization
+}  // namespace open3d
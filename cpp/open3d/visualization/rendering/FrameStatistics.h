@@ -0,0 +1,104 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <vector>
+
+namespace open3d {
+namespace visualization {
+namespace rendering {
+
+/// Timings and counters of one rendered frame, to tell whether a window is
+/// limited by the CPU (events, GUI layout, scene updates) or by the GPU.
+/// Times are in milliseconds.
+struct FrameStatistics {
+    /// Handling of the input and tick events since the previous frame.
+    double events_ms = 0.0;
+    /// Layout and recording of the widgets, and upload of the GUI geometry.
+    double gui_ms = 0.0;
+    /// Per frame updates of the scenes (level of detail, culling).
+    double scene_update_ms = 0.0;
+    /// Filament beginFrame(), including the pending render to buffers.
+    double begin_frame_ms = 0.0;
+    /// Rendering of the views of all the scenes.
+    double render_ms = 0.0;
+    /// Filament endFrame(), which submits and presents the frame.
+    double end_frame_ms = 0.0;
+    /// Sum of the times above. Filament waits for the GPU in beginFrame()
+    /// and endFrame(), so a GPU-bound frame spends most of it there.
+    double frame_ms = 0.0;
+
+    /// Bytes given to the vertex and index buffers since the previous frame.
+    size_t upload_bytes = 0;
+    /// Renderables drawn, summed over the views.
+    size_t draw_calls = 0;
+    size_t triangles = 0;
+    size_t lines = 0;
+    size_t points = 0;
+
+    /// Sums the counters and times of \p other into these.
+    FrameStatistics& operator+=(const FrameStatistics& other);
+};
+
+/// Rolling window of the statistics of the last frames.
+class FrameStatisticsHistory {
+public:
+    explicit FrameStatisticsHistory(size_t capacity = 240);
+
+    /// Appends the statistics of a frame, dropping the oldest frame if the
+    /// history is full.
+    void Add(const FrameStatistics& stats);
+    void Clear() { frames_.clear(); }
+
+    size_t GetCapacity() const { return capacity_; }
+    size_t Size() const { return frames_.size(); }
+    bool IsEmpty() const { return frames_.empty(); }
+    /// Statistics of the frame \p i, 0 being the oldest one.
+    const FrameStatistics& GetFrame(size_t i) const { return frames_[i]; }
+    /// Statistics of the last frame. The history must not be empty.
+    const FrameStatistics& GetLast() const { return frames_.back(); }
+
+    /// Returns the average of the statistics over the history. The counters
+    /// are rounded down.
+    FrameStatistics GetAverage() const;
+    /// Returns the frame times, oldest first, e.g. for plotting.
+    std::vector<float> GetFrameTimes() const;
+    /// Returns the number of frames whose frame time is in each of
+    /// \p num_bins bins of \p bin_ms milliseconds. The last bin also counts
+    /// the longer frames.
+    std::vector<int> GetFrameTimeHistogram(int num_bins, double bin_ms) const;
+
+private:
+    size_t capacity_;
+    std::deque<FrameStatistics> frames_;
+};
+
+}  // namespace rendering
+}  // namespace visualization
+}  // namespace open3d
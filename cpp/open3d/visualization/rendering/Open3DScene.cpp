@@ -31,6 +31,8 @@
 #include "open3d/geometry/LineSet.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/utility/Console.h"
 #include "open3d/visualization/gui/Application.h"
 #include "open3d/visualization/rendering/Material.h"
 #include "open3d/visualization/rendering/Scene.h"
@@ -43,8 +45,41 @@ namespace rendering {
 const std::string kAxisObjectName("__axis__");
 const std::string kFastModelObjectSuffix("__fast__");
 const std::string kLowQualityModelObjectSuffix("__low__");
+// The smallest number of points that the buffers of a streaming point cloud
+// have room for.
+const int64_t kMinStreamingCapacity = 4096;
 
 namespace {
+core::Tensor ToHostFloat32(const core::Tensor& tensor) {
+    const core::Tensor host =
+            tensor.GetDevice().GetType() == core::Device::DeviceType::CPU
+                    ? tensor
+                    : tensor.Copy(core::Device("CPU:0"));
+    return host.To(core::Dtype::Float32);
+}
+
+geometry::AxisAlignedBoundingBox ComputeBounds(const core::Tensor& points) {
+    auto ToVector3d = [](const core::Tensor& bound) {
+        auto values = bound.To(core::Dtype::Float64)
+                              .Copy(core::Device("CPU:0"))
+                              .ToFlatVector<double>();
+        return Eigen::Vector3d(values[0], values[1], values[2]);
+    };
+    return geometry::AxisAlignedBoundingBox(ToVector3d(points.Min({0})),
+                                            ToVector3d(points.Max({0})));
+}
+
+uint32_t GetUpdateFlag(const std::string& attribute) {
+    if (attribute == "points") {
+        return Scene::kUpdatePointsFlag;
+    } else if (attribute == "colors") {
+        return Scene::kUpdateColorsFlag;
+    } else if (attribute == "normals") {
+        return Scene::kUpdateNormalsFlag;
+    }
+    return 0;
+}
+
 std::shared_ptr<geometry::TriangleMesh> CreateAxisGeometry(double axis_length) {
     const double sphere_radius = 0.005 * axis_length;
     const double cyl_radius = 0.0025 * axis_length;
@@ -114,6 +149,15 @@ void RecreateAxis(Scene* scene,
 
 }  // namespace
 
+struct Open3DScene::StreamingData {
+    /// The attributes in CPU memory, with a row for each vertex of the
+    /// buffers, of which the first size rows are points.
+    t::geometry::PointCloud points;
+    int64_t size = 0;
+    int64_t capacity = 0;
+    Material material;
+};
+
 Open3DScene::Open3DScene(Renderer& renderer) : renderer_(renderer) {
     scene_ = renderer_.CreateScene();
     auto scene = renderer_.GetScene(scene_);
@@ -219,6 +263,7 @@ void Open3DScene::ClearGeometry() {
         }
     }
     geometries_.clear();
+    streaming_.clear();
     bounds_ = geometry::AxisAlignedBoundingBox();
     axis_dirty_ = true;
 }
@@ -295,6 +340,132 @@ void Open3DScene::AddGeometry(
     axis_dirty_ = true;
 }
 
+void Open3DScene::AppendPoints(const std::string& name,
+                               const t::geometry::PointCloud& points,
+                               const Material& mat) {
+    if (points.IsEmpty()) {
+        return;
+    }
+
+    auto it = streaming_.find(name);
+    if (it == streaming_.end()) {
+        RemoveGeometry(name);
+        auto data = std::make_shared<StreamingData>();
+        data->material = mat;
+        for (const std::string attribute : {"points", "colors", "normals"}) {
+            if (points.HasPointAttr(attribute)) {
+                data->points.SetPointAttr(
+                        attribute,
+                        core::Tensor::Empty({0, 3}, core::Dtype::Float32));
+            }
+        }
+        it = streaming_.emplace(name, data).first;
+    }
+    StreamingData& data = *it->second;
+    const int64_t start = data.size;
+    const int64_t size = start + points.GetPoints().GetLength();
+
+    // Growing the capacity uploads all the points again, which amortizes to a
+    // constant cost per point as the capacity doubles.
+    const bool grow = size > data.capacity;
+    if (grow) {
+        data.capacity =
+                std::max({size, 2 * data.capacity, kMinStreamingCapacity});
+        for (const auto& attribute : data.points.GetPointAttr()) {
+            core::Tensor values =
+                    attribute.first == "colors"
+                            ? core::Tensor::Ones({data.capacity, 3},
+                                                 core::Dtype::Float32)
+                            : core::Tensor::Zeros({data.capacity, 3},
+                                                  core::Dtype::Float32);
+            if (start > 0) {
+                values.Slice(0, 0, start) = attribute.second.Slice(0, 0, start);
+            }
+            data.points.SetPointAttr(attribute.first, values);
+        }
+    }
+
+    // The uploaded values are copies, as the scene may read them after this
+    // returns and the next call modifies the CPU copy.
+    t::geometry::PointCloud range;
+    uint32_t update_flags = 0;
+    for (const auto& attribute : data.points.GetPointAttr()) {
+        core::Tensor rows = attribute.second.Slice(0, start, size);
+        if (points.HasPointAttr(attribute.first)) {
+            rows = ToHostFloat32(points.GetPointAttr(attribute.first));
+        }
+        range.SetPointAttr(attribute.first, rows.Copy(core::Device("CPU:0")));
+        update_flags |= GetUpdateFlag(attribute.first);
+    }
+    for (const auto& attribute : range.GetPointAttr()) {
+        data.points.GetPointAttr(attribute.first).Slice(0, start, size) =
+                attribute.second;
+    }
+    data.size = size;
+
+    auto scene = renderer_.GetScene(scene_);
+    if (grow) {
+        t::geometry::PointCloud copy;
+        for (const auto& attribute : data.points.GetPointAttr()) {
+            copy.SetPointAttr(attribute.first,
+                              attribute.second.Copy(core::Device("CPU:0")));
+        }
+        auto info = geometries_.find(name);
+        const bool visible = info == geometries_.end() || info->second.visible;
+        scene->RemoveGeometry(name);
+        if (!scene->AddGeometry(name, copy, data.material)) {
+            streaming_.erase(it);
+            geometries_.erase(name);
+            return;
+        }
+        // The bounding box includes the spare capacity, so it is not culled
+        // by its bounds.
+        scene->SetGeometryCulling(name, false);
+        GeometryData new_info(name, "");
+        new_info.visible = visible;
+        geometries_[name] = new_info;
+        scene->ShowGeometry(name, visible);
+    } else {
+        scene->UpdateGeometryRange(name, range, size_t(start), update_flags);
+    }
+    scene->SetPointCloudDrawCount(name, size_t(size));
+
+    bounds_ += ComputeBounds(range.GetPoints());
+    axis_dirty_ = true;
+}
+
+void Open3DScene::UpdatePoints(const std::string& name,
+                               const std::string& attribute,
+                               size_t start,
+                               const core::Tensor& values) {
+    auto it = streaming_.find(name);
+    if (it == streaming_.end() ||
+        !it->second->points.HasPointAttr(attribute)) {
+        utility::LogWarning("Streaming point cloud {} has no {}", name,
+                            attribute);
+        return;
+    }
+    values.AssertShapeCompatible({utility::nullopt, 3});
+    StreamingData& data = *it->second;
+    const int64_t stop = int64_t(start) + values.GetLength();
+    if (stop > data.size) {
+        utility::LogWarning("Range [{}, {}) is out of the {} points of {}",
+                            start, stop, data.size, name);
+        return;
+    }
+
+    const core::Tensor rows = ToHostFloat32(values).Copy(core::Device("CPU:0"));
+    data.points.GetPointAttr(attribute).Slice(0, int64_t(start), stop) = rows;
+    t::geometry::PointCloud range;
+    range.SetPointAttr(attribute, rows);
+    renderer_.GetScene(scene_)->UpdateGeometryRange(name, range, start,
+                                                    GetUpdateFlag(attribute));
+    if (attribute == "points") {
+        bounds_ += ComputeBounds(rows);
+        axis_dirty_ = true;
+    }
+}
+
 bool Open3DScene::HasGeometry(const std::string& name) const {
     auto scene = renderer_.GetScene(scene_);
     return scene->HasGeometry(name);
@@ -313,6 +484,7 @@ void Open3DScene::RemoveGeometry(const std::string& name) {
         }
         geometries_.erase(name);
     }
+    streaming_.erase(name);
 }
 
 void Open3DScene::ModifyGeometryMaterial(const std::string& name,
@@ -326,6 +498,11 @@ void Open3DScene::ModifyGeometryMaterial(const std::string& name,
         }
         // Don't want to override low_name, as that is a bounding box.
     }
+    // Streaming point clouds are added again when they grow.
+    auto streaming = streaming_.find(name);
+    if (streaming != streaming_.end()) {
+        streaming->second->material = mat;
+    }
 }
 
 void Open3DScene::ShowGeometry(const std::string& name, bool show) {
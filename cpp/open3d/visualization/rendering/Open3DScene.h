@@ -27,6 +27,7 @@
 #pragma once
 
 #include <map>
+#include <memory>
 #include <vector>
 
 #include "open3d/geometry/BoundingVolume.h"
@@ -34,6 +35,10 @@
 
 namespace open3d {
 
+namespace core {
+class Tensor;
+}  // namespace core
+
 namespace geometry {
 class Geometry3D;
 class Image;
@@ -96,6 +101,20 @@ public:
                      const t::geometry::PointCloud* geom,
                      const Material& mat,
                      bool add_downsampled_copy_for_fast_rendering = true);
+    /// Appends \p points to the streaming point cloud \p name, which is
+    /// added with \p mat by the first call. Its buffers keep spare capacity
+    /// that doubles when it runs out, so that appending uploads only the new
+    /// points. The colors and normals are kept if the first points have them.
+    void AppendPoints(const std::string& name,
+                      const t::geometry::PointCloud& points,
+                      const Material& mat);
+    /// Overwrites the \p attribute ("points", "colors" or "normals") of the
+    /// points [start, start + N) of the streaming point cloud \p name with
+    /// the (N, 3) \p values, and uploads only these values.
+    void UpdatePoints(const std::string& name,
+                      const std::string& attribute,
+                      size_t start,
+                      const core::Tensor& values);
     bool HasGeometry(const std::string& name) const;
     void RemoveGeometry(const std::string& name);
     /// Shows or hides the geometry with the specified name.
@@ -137,6 +156,9 @@ private:
 
     void SetGeometryToLOD(const GeometryData&, LOD lod);
 
+    /// The points of a streaming point cloud and its buffer capacity.
+    struct StreamingData;
+
 private:
     Renderer& renderer_;
     SceneHandle scene_;
@@ -146,6 +168,7 @@ private:
     bool use_low_quality_if_available_ = false;
     bool axis_dirty_ = true;
     std::map<std::string, GeometryData> geometries_;  // name -> data
+    std::map<std::string, std::shared_ptr<StreamingData>> streaming_;
     geometry::AxisAlignedBoundingBox bounds_;
     size_t downsample_threshold_ = 6000000;
 };
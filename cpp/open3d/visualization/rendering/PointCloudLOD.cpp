@@ -0,0 +1,333 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/visualization/rendering/PointCloudLOD.h"
+
+#include <json/json.h>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <queue>
+#include <unordered_set>
+#include <utility>
+
+#include "open3d/io/IJsonConvertibleIO.h"
+#include "open3d/io/PointCloudIO.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/FileSystem.h"
+
+namespace open3d {
+namespace visualization {
+namespace rendering {
+
+namespace {
+
+std::string GetNodeFilename(const std::string& directory, size_t node_idx) {
+    return fmt::format("{}/nodes/{}.ply", directory, node_idx);
+}
+
+}  // namespace
+
+std::shared_ptr<PointCloudLOD> PointCloudLOD::Build(
+        const geometry::PointCloud& cloud, size_t max_points_per_node) {
+    auto lod = std::make_shared<PointCloudLOD>();
+    if (cloud.IsEmpty()) {
+        utility::LogWarning("Cannot build the octree of an empty point cloud.");
+        return lod;
+    }
+    max_points_per_node = std::max<size_t>(max_points_per_node, 1);
+
+    // The cube is slightly enlarged so that the points on the maximum bound
+    // fall into the last grid cell.
+    Eigen::Vector3d min_bound = cloud.GetMinBound();
+    double size = (cloud.GetMaxBound() - min_bound).maxCoeff();
+    size = std::max(size * (1.0 + 1e-6), 1e-6);
+
+    std::vector<size_t> indices(cloud.points_.size());
+    std::iota(indices.begin(), indices.end(), 0);
+    lod->BuildNode(cloud, indices, min_bound, size, 0, max_points_per_node);
+    utility::LogDebug("Built an octree of {} nodes for {} points.",
+                      lod->nodes_.size(), cloud.points_.size());
+    return lod;
+}
+
+int PointCloudLOD::BuildNode(const geometry::PointCloud& cloud,
+                             std::vector<size_t>& indices,
+                             const Eigen::Vector3d& min_bound,
+                             double size,
+                             int level,
+                             size_t max_points_per_node) {
+    const int node_idx = int(nodes_.size());
+    nodes_.emplace_back();
+    node_points_.emplace_back();
+    Node& node = nodes_.back();
+    node.min_bound = min_bound;
+    node.size = size;
+    node.spacing = size / GRID_SIZE;
+    node.level = level;
+
+    if (indices.size() <= max_points_per_node || level >= MAX_LEVEL) {
+        node.num_points = indices.size();
+        node_points_[node_idx] = cloud.SelectByIndex(indices);
+        return node_idx;
+    }
+
+    // Keeps the first point of each grid cell and passes the others to the
+    // child of their octant.
+    const double cell_scale = GRID_SIZE / size;
+    std::unordered_set<uint32_t> occupied_cells;
+    occupied_cells.reserve(std::min<size_t>(indices.size(), 1 << 20));
+    std::vector<size_t> selected;
+    std::array<std::vector<size_t>, 8> child_indices;
+    for (size_t idx : indices) {
+        const Eigen::Vector3d& p = cloud.points_[idx];
+        Eigen::Vector3i cell = ((p - min_bound) * cell_scale).cast<int>();
+        cell = cell.cwiseMax(0).cwiseMin(GRID_SIZE - 1);
+        uint32_t key = uint32_t((cell(0) * GRID_SIZE + cell(1)) * GRID_SIZE +
+                                cell(2));
+        if (occupied_cells.insert(key).second) {
+            selected.push_back(idx);
+        } else {
+            int octant = (cell(0) >= GRID_SIZE / 2 ? 1 : 0) |
+                         (cell(1) >= GRID_SIZE / 2 ? 2 : 0) |
+                         (cell(2) >= GRID_SIZE / 2 ? 4 : 0);
+            child_indices[octant].push_back(idx);
+        }
+    }
+    nodes_[node_idx].num_points = selected.size();
+    node_points_[node_idx] = cloud.SelectByIndex(selected);
+    std::vector<size_t>().swap(indices);
+
+    const double child_size = size / 2;
+    for (int octant = 0; octant < 8; ++octant) {
+        if (child_indices[octant].empty()) continue;
+        Eigen::Vector3d child_min =
+                min_bound + child_size * Eigen::Vector3d((octant & 1) ? 1 : 0,
+                                                         (octant & 2) ? 1 : 0,
+                                                         (octant & 4) ? 1 : 0);
+        int child_idx = BuildNode(cloud, child_indices[octant], child_min,
+                                  child_size, level + 1, max_points_per_node);
+        nodes_[node_idx].children[octant] = child_idx;
+    }
+    return node_idx;
+}
+
+std::shared_ptr<PointCloudLOD> PointCloudLOD::Read(
+        const std::string& directory) {
+    auto lod = std::make_shared<PointCloudLOD>();
+    if (!io::ReadIJsonConvertibleFromJSON(directory + "/hierarchy.json",
+                                          *lod)) {
+        utility::LogWarning("Failed to read the octree in {}.", directory);
+        return nullptr;
+    }
+    lod->directory_ = directory;
+    return lod;
+}
+
+bool PointCloudLOD::Write(const std::string& directory) const {
+    if (!utility::filesystem::MakeDirectoryHierarchy(directory + "/nodes")) {
+        utility::LogWarning("Failed to create the directory {}/nodes.",
+                            directory);
+        return false;
+    }
+    for (size_t i = 0; i < nodes_.size(); ++i) {
+        auto points = GetNodePoints(i);
+        if (!points ||
+            !io::WritePointCloud(GetNodeFilename(directory, i), *points)) {
+            utility::LogWarning("Failed to write node {} of the octree.", i);
+            return false;
+        }
+    }
+    return io::WriteIJsonConvertibleToJSON(directory + "/hierarchy.json",
+                                           *this);
+}
+
+bool PointCloudLOD::ConvertToJsonValue(Json::Value& value) const {
+    value["class_name"] = "PointCloudLOD";
+    value["version_major"] = 1;
+    value["version_minor"] = 0;
+    Json::Value nodes(Json::arrayValue);
+    for (const Node& node : nodes_) {
+        Json::Value node_value;
+        if (!EigenVector3dToJsonArray(node.min_bound,
+                                      node_value["min_bound"])) {
+            return false;
+        }
+        node_value["size"] = node.size;
+        node_value["spacing"] = node.spacing;
+        node_value["level"] = node.level;
+        Json::Value children(Json::arrayValue);
+        for (int child : node.children) {
+            children.append(child);
+        }
+        node_value["children"] = children;
+        node_value["num_points"] = Json::UInt64(node.num_points);
+        nodes.append(node_value);
+    }
+    value["nodes"] = nodes;
+    return true;
+}
+
+bool PointCloudLOD::ConvertFromJsonValue(const Json::Value& value) {
+    if (!value.isObject() || value.get("class_name", "") != "PointCloudLOD" ||
+        !value["nodes"].isArray()) {
+        utility::LogWarning(
+                "PointCloudLOD read JSON failed: unsupported json format.");
+        return false;
+    }
+    const Json::Value& nodes = value["nodes"];
+    nodes_.assign(nodes.size(), Node());
+    node_points_.clear();
+    for (Json::ArrayIndex i = 0; i < nodes.size(); ++i) {
+        const Json::Value& node_value = nodes[i];
+        Node& node = nodes_[i];
+        const Json::Value& children = node_value["children"];
+        if (!EigenVector3dFromJsonArray(node.min_bound,
+                                        node_value["min_bound"]) ||
+            !children.isArray() || children.size() != 8) {
+            utility::LogWarning(
+                    "PointCloudLOD read JSON failed: wrong format.");
+            return false;
+        }
+        node.size = node_value.get("size", 0.0).asDouble();
+        node.spacing = node_value.get("spacing", 0.0).asDouble();
+        node.level = node_value.get("level", 0).asInt();
+        for (Json::ArrayIndex k = 0; k < 8; ++k) {
+            node.children[k] = children[k].asInt();
+            if (node.children[k] >= int(nodes.size())) {
+                utility::LogWarning(
+                        "PointCloudLOD read JSON failed: invalid child {}.",
+                        node.children[k]);
+                return false;
+            }
+        }
+        node.num_points = node_value.get("num_points", 0).asUInt64();
+    }
+    return true;
+}
+
+size_t PointCloudLOD::GetNumPoints() const {
+    size_t num_points = 0;
+    for (const Node& node : nodes_) {
+        num_points += node.num_points;
+    }
+    return num_points;
+}
+
+std::shared_ptr<geometry::PointCloud> PointCloudLOD::GetNodePoints(
+        size_t node_idx) const {
+    if (node_idx >= nodes_.size()) {
+        utility::LogError("Node index {} is out of range [0, {}).", node_idx,
+                          nodes_.size());
+    }
+    if (directory_.empty()) {
+        return node_points_[node_idx];
+    }
+    auto points = std::make_shared<geometry::PointCloud>();
+    if (!io::ReadPointCloud(GetNodeFilename(directory_, node_idx), *points)) {
+        utility::LogWarning("Failed to read node {} of the octree in {}.",
+                            node_idx, directory_);
+        return nullptr;
+    }
+    return points;
+}
+
+std::vector<size_t> PointCloudLOD::SelectNodes(
+        const Eigen::Matrix4f& view,
+        const Eigen::Matrix4f& projection,
+        int viewport_height,
+        size_t point_budget,
+        float max_spacing_pixels) const {
+    std::vector<size_t> selected;
+    if (nodes_.empty()) return selected;
+
+    // Frustum planes of the view projection matrix, whose positive side is
+    // inside.
+    const Eigen::Matrix4f view_projection = projection * view;
+    std::array<Eigen::Vector4f, 6> planes;
+    for (int i = 0; i < 3; ++i) {
+        planes[2 * i] = view_projection.row(3) + view_projection.row(i);
+        planes[2 * i + 1] = view_projection.row(3) - view_projection.row(i);
+    }
+    auto is_visible = [&planes](const Node& node) {
+        for (const Eigen::Vector4f& plane : planes) {
+            // The corner of the cube farthest along the plane normal.
+            Eigen::Vector3f corner = node.min_bound.cast<float>();
+            for (int k = 0; k < 3; ++k) {
+                if (plane(k) > 0) corner(k) += float(node.size);
+            }
+            if (plane.head<3>().dot(corner) + plane(3) < 0) return false;
+        }
+        return true;
+    };
+
+    // Size on screen in pixels of a unit length at a distance of 1 for a
+    // perspective projection, or at any distance for an orthographic one.
+    const bool is_perspective = projection(3, 3) == 0.0f;
+    const float pixels_per_unit =
+            std::abs(projection(1, 1)) * 0.5f * float(viewport_height);
+    const Eigen::Vector3f camera_position = -view.topLeftCorner<3, 3>()
+                                                     .transpose() *
+                                             view.topRightCorner<3, 1>();
+    auto projected_spacing = [&](const Node& node) {
+        float spacing = float(node.spacing) * pixels_per_unit;
+        if (!is_perspective) return spacing;
+        // Distance from the camera to the nearest point of the cube.
+        Eigen::Vector3f min_bound = node.min_bound.cast<float>();
+        Eigen::Vector3f nearest = camera_position.cwiseMax(min_bound).cwiseMin(
+                min_bound + Eigen::Vector3f::Constant(float(node.size)));
+        float distance = std::max((nearest - camera_position).norm(), 1e-6f);
+        return spacing / distance;
+    };
+
+    using Candidate = std::pair<float, size_t>;
+    std::priority_queue<Candidate> candidates;
+    candidates.emplace(projected_spacing(nodes_[0]), 0);
+    size_t num_points = 0;
+    while (!candidates.empty()) {
+        const Candidate candidate = candidates.top();
+        candidates.pop();
+        const Node& node = nodes_[candidate.second];
+        if (!is_visible(node)) continue;
+        if (num_points + node.num_points > point_budget) break;
+        num_points += node.num_points;
+        selected.push_back(candidate.second);
+        if (candidate.first <= max_spacing_pixels) continue;
+        for (int child : node.children) {
+            if (child >= 0) {
+                candidates.emplace(projected_spacing(nodes_[child]),
+                                   size_t(child));
+            }
+        }
+    }
+    return selected;
+}
+
+}  // namespace rendering
+}  // namespace visualization
+}  // namespace open3d
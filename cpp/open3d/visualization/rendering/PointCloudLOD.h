@@ -0,0 +1,140 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <Eigen/Core>
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/utility/IJsonConvertible.h"
+
+namespace open3d {
+namespace visualization {
+namespace rendering {
+
+/// Level of detail octree of a point cloud for rendering large point clouds,
+/// as in Potree. Each node keeps a spatially uniform subset of the points in
+/// its cube, with at most one point per cell of a grid of GRID_SIZE^3 cells,
+/// and passes the other points to its children. A node and its ancestors
+/// together are a denser sample of the cloud in the cube of the node, so the
+/// renderer draws a subtree of the octree chosen by SelectNodes().
+///
+/// The octree is built in memory by Build(), or read from a directory written
+/// by Write(), in which case the points of the nodes are read from disk on
+/// demand by GetNodePoints().
+class PointCloudLOD : public utility::IJsonConvertible {
+public:
+    /// Resolution of the sampling grid of a node along each axis.
+    static const int GRID_SIZE = 128;
+    /// Depth at which nodes keep all their points.
+    static const int MAX_LEVEL = 20;
+
+    struct Node {
+        /// Minimum corner of the cube of the node.
+        Eigen::Vector3d min_bound = Eigen::Vector3d::Zero();
+        /// Edge length of the cube of the node.
+        double size = 0.0;
+        /// Distance between the points of the node, the grid cell size.
+        double spacing = 0.0;
+        int level = 0;
+        /// Indices of the eight children in octant order, -1 if absent.
+        std::array<int, 8> children = {{-1, -1, -1, -1, -1, -1, -1, -1}};
+        size_t num_points = 0;
+    };
+
+    PointCloudLOD() {}
+    ~PointCloudLOD() override {}
+
+    /// Builds the octree of \p cloud in memory.
+    ///
+    /// \param cloud Point cloud with optional colors and normals.
+    /// \param max_points_per_node Nodes with at most this many points in
+    /// their cube are leaves and keep all their points.
+    static std::shared_ptr<PointCloudLOD> Build(
+            const geometry::PointCloud& cloud,
+            size_t max_points_per_node = 20000);
+
+    /// Reads the hierarchy of an octree written by Write(). The points of the
+    /// nodes stay on disk until GetNodePoints() reads them.
+    static std::shared_ptr<PointCloudLOD> Read(const std::string& directory);
+
+    /// Writes the hierarchy to 'hierarchy.json' and the points of each node
+    /// to 'nodes/<index>.ply' in \p directory.
+    bool Write(const std::string& directory) const;
+
+    bool ConvertToJsonValue(Json::Value& value) const override;
+    bool ConvertFromJsonValue(const Json::Value& value) override;
+
+    /// The nodes, with the root first.
+    const std::vector<Node>& GetNodes() const { return nodes_; }
+
+    /// Total number of points of all nodes.
+    size_t GetNumPoints() const;
+
+    /// Returns the points of node \p node_idx, reading them from disk if the
+    /// octree was read by Read().
+    std::shared_ptr<geometry::PointCloud> GetNodePoints(size_t node_idx) const;
+
+    /// Selects the nodes to render from a camera, in decreasing order of
+    /// their projected point spacing. The children of a node are selected if
+    /// the spacing of its points on screen exceeds \p max_spacing_pixels, and
+    /// the nodes outside the view frustum are skipped.
+    ///
+    /// \param view View matrix in the coordinates of the point cloud.
+    /// \param projection Perspective or orthographic projection matrix.
+    /// \param viewport_height Height of the viewport in pixels.
+    /// \param point_budget Maximum number of points of the selected nodes.
+    /// \param max_spacing_pixels Point spacing on screen below which the
+    /// children of a node are not needed.
+    std::vector<size_t> SelectNodes(const Eigen::Matrix4f& view,
+                                    const Eigen::Matrix4f& projection,
+                                    int viewport_height,
+                                    size_t point_budget,
+                                    float max_spacing_pixels = 1.5f) const;
+
+private:
+    int BuildNode(const geometry::PointCloud& cloud,
+                  std::vector<size_t>& indices,
+                  const Eigen::Vector3d& min_bound,
+                  double size,
+                  int level,
+                  size_t max_points_per_node);
+
+    std::vector<Node> nodes_;
+    /// Points of the nodes built in memory, empty for an octree on disk.
+    std::vector<std::shared_ptr<geometry::PointCloud>> node_points_;
+    /// Directory of an octree on disk.
+    std::string directory_;
+};
+
+}  // namespace rendering
+}  // namespace visualization
+}  // namespace open3d
@@ -26,6 +26,7 @@
 
 #pragma once
 
+#include "open3d/visualization/rendering/FrameStatistics.h"
 #include "open3d/visualization/rendering/MaterialModifier.h"
 #include "open3d/visualization/rendering/RendererHandle.h"
 
@@ -78,6 +79,11 @@ public:
     virtual void Draw() = 0;
     virtual void EndFrame() = 0;
 
+    /// Returns the timings and counters of the last frame drawn with
+    /// BeginFrame(), Draw() and EndFrame(). The events and GUI times are
+    /// left to the window that drives the renderer.
+    virtual const FrameStatistics& GetFrameStatistics() const = 0;
+
     virtual MaterialHandle AddMaterial(const ResourceLoadRequest& request) = 0;
     virtual MaterialInstanceHandle AddMaterialInstance(
             const MaterialHandle& material) = 0;
@@ -43,12 +43,14 @@ class Image;
 namespace t {
 namespace geometry {
 class PointCloud;
-}
+class TriangleMesh;
+}  // namespace geometry
 }  // namespace t
 
 namespace visualization {
 namespace rendering {
 
+class PointCloudLOD;
 class Renderer;
 class View;
 struct TriangleMeshModel;
@@ -99,10 +101,40 @@ public:
                              size_t downsample_threshold = SIZE_MAX) = 0;
     virtual bool AddGeometry(const std::string& object_name,
                              const TriangleMeshModel& model) = 0;
+    /// Adds a tensor triangle mesh, whose vertex attributes are uploaded from
+    /// the tensors without converting it to a legacy triangle mesh.
+    virtual bool AddGeometry(const std::string& object_name,
+                             const t::geometry::TriangleMesh& mesh,
+                             const Material& material) = 0;
+    /// Adds a level of detail octree of a large point cloud. Each frame, the
+    /// nodes are selected by their point spacing on screen within
+    /// \p point_budget points, and their buffers are created as needed and
+    /// evicted when they exceed \p memory_budget bytes.
+    virtual bool AddGeometry(const std::string& object_name,
+                             std::shared_ptr<PointCloudLOD> lod,
+                             const Material& material,
+                             size_t point_budget = 10000000,
+                             size_t memory_budget = size_t(1) << 30) = 0;
     virtual bool HasGeometry(const std::string& object_name) const = 0;
     virtual void UpdateGeometry(const std::string& object_name,
                                 const t::geometry::PointCloud& point_cloud,
                                 uint32_t update_flags) = 0;
+    /// Replaces the flagged vertex attributes of a tensor triangle mesh with
+    /// the same number of vertices. The triangles are not updated.
+    virtual void UpdateGeometry(const std::string& object_name,
+                                const t::geometry::TriangleMesh& mesh,
+                                uint32_t update_flags) = 0;
+    /// Overwrites the vertices [start, start + N) of the flagged attributes
+    /// of a tensor point cloud with the N values of the same attributes of
+    /// \p point_cloud, which only needs to have the flagged attributes.
+    virtual void UpdateGeometryRange(const std::string& object_name,
+                                     const t::geometry::PointCloud& point_cloud,
+                                     size_t start,
+                                     uint32_t update_flags) = 0;
+    /// Draws only the first \p count points of a tensor point cloud, so that
+    /// the remaining vertices can be kept as spare capacity.
+    virtual void SetPointCloudDrawCount(const std::string& object_name,
+                                        size_t count) = 0;
     virtual void RemoveGeometry(const std::string& object_name) = 0;
     virtual void ShowGeometry(const std::string& object_name, bool show) = 0;
     virtual bool GeometryIsVisible(const std::string& object_name) = 0;
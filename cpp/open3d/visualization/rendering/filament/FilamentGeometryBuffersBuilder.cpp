@@ -26,10 +26,35 @@
 
 #include "open3d/visualization/rendering/filament/FilamentGeometryBuffersBuilder.h"
 
+// 4068: Filament has some clang-specific vectorizing pragma's that MSVC flags
+// 4146: Filament's utils/algorithm.h utils::details::ctz() tries to negate
+//       an unsigned int.
+// 4293: Filament's utils/algorithm.h utils::details::clz() does strange
+//       things with MSVC. Somehow sizeof(unsigned int) > 4, but its size is
+//       32 so that x >> 32 gives a warning. (Or maybe the compiler can't
+//       determine the if statement does not run.)
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 4068 4146 4293)
+#endif  // _MSC_VER
+
+#include <filament/IndexBuffer.h>
+#include <filament/VertexBuffer.h>
+#include <geometry/SurfaceOrientation.h>
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif  // _MSC_VER
+
+#include "open3d/core/Tensor.h"
 #include "open3d/geometry/BoundingVolume.h"
 #include "open3d/geometry/LineSet.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/geometry/TriangleMesh.h"
+#include "open3d/visualization/rendering/filament/FilamentEngine.h"
+#include "open3d/visualization/rendering/filament/FilamentResourceManager.h"
 
 namespace open3d {
 namespace visualization {
@@ -87,12 +112,86 @@ std::unique_ptr<GeometryBuffersBuilder> GeometryBuffersBuilder::GetBuilder(
     return std::make_unique<TPointCloudBuffersBuilder>(geometry);
 }
 
+std::unique_ptr<GeometryBuffersBuilder> GeometryBuffersBuilder::GetBuilder(
+        const t::geometry::TriangleMesh& geometry) {
+    return std::make_unique<TTriangleMeshBuffersBuilder>(geometry);
+}
+
+core::Tensor GeometryBuffersBuilder::ToHostFloat32(const core::Tensor& tensor) {
+    const core::Tensor host =
+            tensor.GetDevice().GetType() == core::Device::DeviceType::CPU
+                    ? tensor.Contiguous()
+                    : tensor.Copy(core::Device("CPU:0"));
+    return host.To(core::Dtype::Float32);
+}
+
+filament::backend::BufferDescriptor
+GeometryBuffersBuilder::CreateTensorDescriptor(const core::Tensor& tensor) {
+    auto* reference = new core::Tensor(tensor);
+    return filament::backend::BufferDescriptor(
+            reference->GetDataPtr(),
+            reference->NumElements() * reference->GetDtype().ByteSize(),
+            ReleaseTensor, reference);
+}
+
+filament::backend::BufferDescriptor
+GeometryBuffersBuilder::CreateTangentsDescriptor(const core::Tensor& normals,
+                                                 size_t n_vertices) {
+    const size_t tangents_size = n_vertices * 4 * sizeof(float);
+    auto* tangents =
+            static_cast<filament::math::quatf*>(malloc(tangents_size));
+    if (normals.NumElements() > 0) {
+        // Converting normals to Filament type - quaternions
+        using filament::math::float3;
+        auto orientation = filament::geometry::SurfaceOrientation::Builder()
+                                   .vertexCount(n_vertices)
+                                   .normals(reinterpret_cast<const float3*>(
+                                           normals.GetDataPtr()))
+                                   .build();
+        orientation->getQuats(tangents, n_vertices);
+        delete orientation;
+    } else {
+        float* tangent_ptr = reinterpret_cast<float*>(tangents);
+        for (size_t i = 0; i < n_vertices; ++i) {
+            *tangent_ptr++ = 0.f;
+            *tangent_ptr++ = 0.f;
+            *tangent_ptr++ = 0.f;
+            *tangent_ptr++ = 1.f;
+        }
+    }
+    return filament::backend::BufferDescriptor(tangents, tangents_size,
+                                               DeallocateBuffer);
+}
+
+void GeometryBuffersBuilder::UploadVertexBuffer(
+        filament::VertexBuffer& vbuf,
+        uint8_t buffer_index,
+        filament::backend::BufferDescriptor&& descriptor,
+        uint32_t byte_offset) {
+    EngineInstance::GetResourceManager().AddUploadedBytes(descriptor.size);
+    vbuf.setBufferAt(EngineInstance::GetInstance(), buffer_index,
+                     std::move(descriptor), byte_offset);
+}
+
+void GeometryBuffersBuilder::UploadIndexBuffer(
+        filament::IndexBuffer& ibuf,
+        filament::backend::BufferDescriptor&& descriptor) {
+    EngineInstance::GetResourceManager().AddUploadedBytes(descriptor.size);
+    ibuf.setBuffer(EngineInstance::GetInstance(), std::move(descriptor));
+}
+
 void GeometryBuffersBuilder::DeallocateBuffer(void* buffer,
                                               size_t size,
                                               void* user_ptr) {
     free(buffer);
 }
 
+void GeometryBuffersBuilder::ReleaseTensor(void* buffer,
+                                           size_t size,
+                                           void* user_ptr) {
+    delete static_cast<core::Tensor*>(user_ptr);
+}
+
 }  // namespace rendering
 }  // namespace visualization
 }  // namespace open3d
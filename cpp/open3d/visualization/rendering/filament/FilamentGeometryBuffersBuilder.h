@@ -43,6 +43,7 @@
 #pragma warning(disable : 4068 4146 4293)
 #endif // _MSC_VER
 
+#include <backend/BufferDescriptor.h>
 #include <filament/Box.h>
 #include <filament/RenderableManager.h>
 
@@ -54,8 +55,19 @@
 #include <memory>
 #include <tuple>
 
+/// @cond
+namespace filament {
+class IndexBuffer;
+class VertexBuffer;
+}  // namespace filament
+/// @endcond
+
 namespace open3d {
 
+namespace core {
+class Tensor;
+}  // namespace core
+
 namespace geometry {
 class Geometry3D;
 class LineSet;
@@ -66,7 +78,8 @@ class TriangleMesh;
 namespace t {
 namespace geometry {
 class PointCloud;
-}
+class TriangleMesh;
+}  // namespace geometry
 }  // namespace t
 
 namespace visualization {
@@ -86,6 +99,37 @@ public:
             const geometry::Geometry3D& geometry);
     static std::unique_ptr<GeometryBuffersBuilder> GetBuilder(
             const t::geometry::PointCloud& geometry);
+    static std::unique_ptr<GeometryBuffersBuilder> GetBuilder(
+            const t::geometry::TriangleMesh& geometry);
+
+    // Returns the tensor as a contiguous Float32 tensor in CPU memory. No
+    // copy is made if the tensor already is one. Filament can only upload
+    // from CPU memory, so tensors on other devices are staged through it.
+    static core::Tensor ToHostFloat32(const core::Tensor& tensor);
+
+    // Returns a descriptor of the memory of a contiguous CPU tensor. The
+    // descriptor holds a reference to the tensor until Filament has uploaded
+    // the buffer, so the tensor does not need to be copied or outlive it.
+    static filament::backend::BufferDescriptor CreateTensorDescriptor(
+            const core::Tensor& tensor);
+
+    // Returns a descriptor of the tangent quaternions of the (N, 3) host
+    // Float32 normals, or of the default tangents of n_vertices vertices if
+    // the normals are empty.
+    static filament::backend::BufferDescriptor CreateTangentsDescriptor(
+            const core::Tensor& normals, size_t n_vertices);
+
+    // Sets a buffer of the vertex buffer (or the indices of the index
+    // buffer), adding its size to the bytes uploaded by the resource manager
+    // that the renderer reports in its frame statistics.
+    static void UploadVertexBuffer(
+            filament::VertexBuffer& vbuf,
+            uint8_t buffer_index,
+            filament::backend::BufferDescriptor&& descriptor,
+            uint32_t byte_offset = 0);
+    static void UploadIndexBuffer(
+            filament::IndexBuffer& ibuf,
+            filament::backend::BufferDescriptor&& descriptor);
 
     virtual ~GeometryBuffersBuilder() = default;
 
@@ -117,6 +161,7 @@ protected:
     bool adjust_colors_for_srgb_tonemapping_ = true;
 
     static void DeallocateBuffer(void* buffer, size_t size, void* user_ptr);
+    static void ReleaseTensor(void* buffer, size_t size, void* user_ptr);
 
     static IndexBufferHandle CreateIndexBuffer(size_t max_index,
                                                size_t n_subsamples = SIZE_MAX);
@@ -164,6 +209,21 @@ private:
     const t::geometry::PointCloud& geometry_;
 };
 
+class TTriangleMeshBuffersBuilder : public GeometryBuffersBuilder {
+public:
+    explicit TTriangleMeshBuffersBuilder(
+            const t::geometry::TriangleMesh& geometry);
+
+    filament::RenderableManager::PrimitiveType GetPrimitiveType()
+            const override;
+
+    Buffers ConstructBuffers() override;
+    filament::Box ComputeAABB() override;
+
+private:
+    const t::geometry::TriangleMesh& geometry_;
+};
+
 class LineSetBuffersBuilder : public GeometryBuffersBuilder {
 public:
     explicit LineSetBuffersBuilder(const geometry::LineSet& geometry);
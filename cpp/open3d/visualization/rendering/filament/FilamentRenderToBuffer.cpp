@@ -52,6 +52,7 @@
 #endif  // _MSC_VER
 
 #include "open3d/utility/Console.h"
+#include "open3d/visualization/rendering/filament/FilamentCamera.h"
 #include "open3d/visualization/rendering/filament/FilamentEngine.h"
 #include "open3d/visualization/rendering/filament/FilamentRenderer.h"
 #include "open3d/visualization/rendering/filament/FilamentScene.h"
@@ -61,6 +62,39 @@ namespace open3d {
 namespace visualization {
 namespace rendering {
 
+namespace {
+
+struct BatchReadback {
+    int* in_flight;
+    // If not null, the frame holds depths packed by the depthValue material
+    // which are decoded into here.
+    float* depth;
+    std::size_t n_pixels;
+    double near_plane;
+    double far_plane;
+};
+
+void BatchReadPixelsCallback(void* buffer, size_t, void* user) {
+    auto* readback = static_cast<BatchReadback*>(user);
+    if (readback->depth) {
+        const auto* rgb = static_cast<const std::uint8_t*>(buffer);
+        const double scale =
+                (readback->far_plane - readback->near_plane) / 16777214.0;
+        for (std::size_t i = 0; i < readback->n_pixels; ++i, rgb += 3) {
+            const std::uint32_t value = (std::uint32_t(rgb[0]) << 16) |
+                                        (std::uint32_t(rgb[1]) << 8) | rgb[2];
+            readback->depth[i] =
+                    value == 0 ? 0.0f
+                               : float(readback->near_plane +
+                                       (value - 1) * scale);
+        }
+    }
+    --(*readback->in_flight);
+    delete readback;
+}
+
+}  // namespace
+
 FilamentRenderToBuffer::FilamentRenderToBuffer(filament::Engine& engine)
     : engine_(engine) {
     renderer_ = engine_.createRenderer();
@@ -204,6 +238,152 @@ void FilamentRenderToBuffer::RenderTick() {
     }
 }
 
+FilamentRenderToBuffer::BatchImages FilamentRenderToBuffer::RenderBatch(
+        const View* view,
+        Scene* scene,
+        int width,
+        int height,
+        const std::vector<Eigen::Matrix3d>& intrinsics,
+        const std::vector<Eigen::Matrix4d>& extrinsics,
+        double near_plane,
+        double far_plane,
+        bool render_depth) {
+    auto* filament_scene = dynamic_cast<FilamentScene*>(scene);
+    if (!filament_scene || !dynamic_cast<const FilamentView*>(view)) {
+        utility::LogError("Batch rendering requires a Filament view and scene");
+    }
+    if (intrinsics.size() != extrinsics.size()) {
+        utility::LogError("Got {} intrinsics for {} extrinsics",
+                          intrinsics.size(), extrinsics.size());
+    }
+    if (pending_) {
+        utility::LogError(
+                "Render to buffer can process only one request at time");
+    }
+
+    // The geometries culled for the views of the scene may be in view of the
+    // cameras of the batch.
+    const bool scene_culling = filament_scene->IsSceneCullingEnabled();
+    filament_scene->SetSceneCulling(false);
+
+    CopySettings(view);
+    const auto viewport = view_->GetNativeView()->getViewport();
+    FilamentCamera saved_camera(engine_);
+    saved_camera.CopyFrom(view_->GetCamera());
+    SetDimensions(width, height);
+
+    const int64_t n = int64_t(extrinsics.size());
+    BatchImages images;
+    images.color =
+            core::Tensor::Empty({n, height, width, 3}, core::Dtype::UInt8);
+    RenderBatchPass(intrinsics, extrinsics, near_plane, far_plane,
+                    images.color, nullptr);
+
+    if (render_depth) {
+        images.depth = core::Tensor::Empty({n, height, width, 1},
+                                           core::Dtype::Float32);
+
+        // Like for color picking, the packed depths must reach the buffer
+        // unaltered by post-processing and multisampling.
+        const bool post_processing =
+                view_->GetNativeView()->isPostProcessingEnabled();
+        const int sample_count = view_->GetSampleCount();
+        view_->SetPostProcessing(false);
+        view_->SetSampleCount(1);
+        filament::Renderer::ClearOptions opt;
+        opt.clearColor = {0.0f, 0.0f, 0.0f, 1.0f};
+        opt.clear = true;
+        opt.discard = true;
+        renderer_->setClearOptions(opt);
+
+        filament_scene->BeginDepthValueRendering(float(near_plane),
+                                                 float(far_plane));
+        RenderBatchPass(intrinsics, extrinsics, near_plane, far_plane,
+                        images.color, &images.depth);
+        filament_scene->EndDepthValueRendering();
+
+        view_->SetPostProcessing(post_processing);
+        view_->SetSampleCount(sample_count);
+        opt.clearColor = {1.0f, 1.0f, 1.0f, 1.0f};
+        renderer_->setClearOptions(opt);
+    }
+
+    view_->GetCamera()->CopyFrom(&saved_camera);
+    view_->SetViewport(viewport.left, viewport.bottom, viewport.width,
+                       viewport.height);
+    filament_scene->SetSceneCulling(scene_culling);
+    return images;
+}
+
+void FilamentRenderToBuffer::RenderBatchPass(
+        const std::vector<Eigen::Matrix3d>& intrinsics,
+        const std::vector<Eigen::Matrix4d>& extrinsics,
+        double near_plane,
+        double far_plane,
+        core::Tensor& color,
+        core::Tensor* depth) {
+    using namespace filament;
+    using namespace backend;
+
+    const std::size_t n_pixels = width_ * height_;
+    const std::size_t frame_size = n_pixels * 3;
+    // The packed depths are read into two staging frames used in turn, as
+    // at most two frames are in flight.
+    std::vector<std::uint8_t> staging[2];
+    if (depth) {
+        staging[0].resize(frame_size);
+        staging[1].resize(frame_size);
+    }
+
+    auto* camera = view_->GetCamera();
+    int in_flight = 0;
+    for (std::size_t i = 0; i < extrinsics.size(); ++i) {
+        // The extrinsic looks along +z with +y down, as in OpenCV.
+        const Eigen::Matrix3d rotation = extrinsics[i].block<3, 3>(0, 0);
+        const Eigen::Vector3d translation = extrinsics[i].block<3, 1>(0, 3);
+        const Eigen::Vector3f eye =
+                (-rotation.transpose() * translation).cast<float>();
+        const Eigen::Vector3f forward =
+                rotation.row(2).transpose().cast<float>();
+        const Eigen::Vector3f up = -rotation.row(1).transpose().cast<float>();
+        camera->SetProjection(intrinsics[i], near_plane, far_plane,
+                              double(width_), double(height_));
+        camera->LookAt(eye + forward, eye, up);
+
+        // Ticking pumps the readback callbacks of the previous frames.
+        while (in_flight >= 2) {
+            RenderTick();
+        }
+
+        auto* readback = new BatchReadback{&in_flight, nullptr, n_pixels,
+                                           near_plane, far_plane};
+        std::uint8_t* pixels;
+        if (depth) {
+            readback->depth = depth->GetDataPtr<float>() + i * n_pixels;
+            pixels = staging[i % 2].data();
+        } else {
+            pixels = color.GetDataPtr<std::uint8_t>() + i * frame_size;
+        }
+        PixelBufferDescriptor pd(pixels, frame_size, PixelDataFormat::RGB,
+                                 PixelDataType::UBYTE, BatchReadPixelsCallback,
+                                 readback);
+        ++in_flight;
+
+        // Filament may skip a frame to pace the rendering, so retry until
+        // the frame is accepted.
+        while (!renderer_->beginFrame(swapchain_)) {
+        }
+        renderer_->render(view_->GetNativeView());
+        renderer_->readPixels(0, 0, std::uint32_t(width_),
+                              std::uint32_t(height_), std::move(pd));
+        renderer_->endFrame();
+    }
+
+    while (in_flight > 0) {
+        RenderTick();
+    }
+}
+
 }  // namespace rendering
 }  // namespace visualization
 }  // namespace open3d
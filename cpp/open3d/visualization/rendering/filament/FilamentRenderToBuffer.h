@@ -26,6 +26,10 @@
 
 #pragma once
 
+#include <Eigen/Core>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
 #include "open3d/visualization/rendering/RenderToBuffer.h"
 
 /// @cond
@@ -68,6 +72,29 @@ public:
     // thread.
     void RenderTick();
 
+    struct BatchImages {
+        // (N, height, width, 3) UInt8 colors.
+        core::Tensor color;
+        // (N, height, width, 1) Float32 depths in world units, 0 where no
+        // geometry was drawn. Empty unless the depth was requested.
+        core::Tensor depth;
+    };
+
+    // Renders the scene of \p view once per camera, where extrinsics[i]
+    // is the world to camera transform of the camera with intrinsics[i].
+    // Up to two frames are in flight at once, so that the readback of a
+    // frame overlaps the rendering of the next one. The camera, viewport
+    // and settings of the view are restored afterwards.
+    BatchImages RenderBatch(const View* view,
+                            Scene* scene,
+                            int width,
+                            int height,
+                            const std::vector<Eigen::Matrix3d>& intrinsics,
+                            const std::vector<Eigen::Matrix4d>& extrinsics,
+                            double near_plane,
+                            double far_plane,
+                            bool render_depth = false);
+
 private:
     friend class FilamentRenderer;
 
@@ -88,6 +115,12 @@ private:
 
     static void ReadPixelsCallback(void* buffer, size_t size, void* user);
     void CopySettings(const View* view);
+    void RenderBatchPass(const std::vector<Eigen::Matrix3d>& intrinsics,
+                         const std::vector<Eigen::Matrix4d>& extrinsics,
+                         double near_plane,
+                         double far_plane,
+                         core::Tensor& color,
+                         core::Tensor* depth);
 };
 
 }  // namespace rendering
@@ -53,6 +53,8 @@
 #endif  // _MSC_VER
 
 #include "open3d/utility/Console.h"
+#include "open3d/utility/Timer.h"
+#include "open3d/utility/Trace.h"
 #include "open3d/visualization/rendering/filament/FilamentCamera.h"
 #include "open3d/visualization/rendering/filament/FilamentEntitiesMods.h"
 #include "open3d/visualization/rendering/filament/FilamentRenderToBuffer.h"
@@ -190,6 +192,10 @@ void FilamentRenderer::EnableCaching(bool enable) {
 }
 
 void FilamentRenderer::BeginFrame() {
+    OPEN3D_TRACE_SCOPE("Renderer::BeginFrame");
+    const double start = utility::Timer::GetSystemTimeInMilliseconds();
+    frame_stats_ = FrameStatistics();
+
     // We will complete render to buffer requests first
     for (auto& br : buffer_renderers_) {
         if (br->pending_) {
@@ -206,24 +212,37 @@ void FilamentRenderer::BeginFrame() {
     }
 
     frame_started_ = renderer_->beginFrame(swap_chain_);
+    frame_stats_.begin_frame_ms =
+            utility::Timer::GetSystemTimeInMilliseconds() - start;
 }
 
 void FilamentRenderer::Draw() {
+    OPEN3D_TRACE_SCOPE("Renderer::Draw");
     if (frame_started_) {
+        const double start = utility::Timer::GetSystemTimeInMilliseconds();
         for (const auto& pair : scenes_) {
-            pair.second->Draw(*renderer_);
+            pair.second->Draw(*renderer_, &frame_stats_);
         }
 
         if (gui_scene_) {
-            gui_scene_->Draw(*renderer_);
+            gui_scene_->Draw(*renderer_, &frame_stats_);
         }
+        // The scene updates are reported on their own.
+        frame_stats_.render_ms =
+                utility::Timer::GetSystemTimeInMilliseconds() - start -
+                frame_stats_.scene_update_ms;
     }
 }
 
 void FilamentRenderer::EndFrame() {
+    OPEN3D_TRACE_SCOPE("Renderer::EndFrame");
     if (frame_started_) {
+        const double start = utility::Timer::GetSystemTimeInMilliseconds();
         renderer_->endFrame();
+        frame_stats_.end_frame_ms =
+                utility::Timer::GetSystemTimeInMilliseconds() - start;
     }
+    frame_stats_.upload_bytes = resource_mgr_.TakeUploadedBytes();
 }
 
 MaterialHandle FilamentRenderer::AddMaterial(
@@ -76,6 +76,9 @@ public:
     void BeginFrame() override;
     void Draw() override;
     void EndFrame() override;
+    const FrameStatistics& GetFrameStatistics() const override {
+        return frame_stats_;
+    }
 
     MaterialHandle AddMaterial(const ResourceLoadRequest& request) override;
     MaterialInstanceHandle AddMaterialInstance(
@@ -125,6 +128,7 @@ private:
     std::unordered_set<FilamentRenderToBuffer*> buffer_renderers_;
 
     bool frame_started_ = false;
+    FrameStatistics frame_stats_;
     bool render_caching_enabled_ = false;
     int render_count_ = 0;
     float clear_color_[4];
@@ -250,6 +250,8 @@ const MaterialHandle FilamentResourceManager::kDefaultNormalShader =
         MaterialHandle::Next();
 const MaterialHandle FilamentResourceManager::kDefaultDepthShader =
         MaterialHandle::Next();
+const MaterialHandle FilamentResourceManager::kDefaultDepthValueShader =
+        MaterialHandle::Next();
 const MaterialHandle FilamentResourceManager::kDefaultUnlitGradientShader =
         MaterialHandle::Next();
 const MaterialHandle FilamentResourceManager::kDefaultUnlitSolidColorShader =
@@ -279,6 +281,7 @@ static const std::unordered_set<REHandle_abstract> kDefaultResources = {
         FilamentResourceManager::kDefaultUnlit,
         FilamentResourceManager::kDefaultNormalShader,
         FilamentResourceManager::kDefaultDepthShader,
+        FilamentResourceManager::kDefaultDepthValueShader,
         FilamentResourceManager::kDefaultUnlitGradientShader,
         FilamentResourceManager::kDefaultUnlitSolidColorShader,
         FilamentResourceManager::kDefaultUnlitBackgroundShader,
@@ -342,6 +345,7 @@ MaterialHandle FilamentResourceManager::CreateMaterial(
 
 MaterialInstanceHandle FilamentResourceManager::CreateMaterialInstance(
         const MaterialHandle& id) {
+    LoadDefaultOnFirstUse(id);
     auto found = materials_.find(id);
     if (found != materials_.end()) {
         auto material_instance = found->second->createInstance();
@@ -551,13 +555,21 @@ IndexBufferHandle FilamentResourceManager::CreateIndexBuffer(
     return handle;
 }
 
+size_t FilamentResourceManager::TakeUploadedBytes() {
+    size_t bytes = uploaded_bytes_;
+    uploaded_bytes_ = 0;
+    return bytes;
+}
+
 std::weak_ptr<filament::Material> FilamentResourceManager::GetMaterial(
         const MaterialHandle& id) {
+    LoadDefaultOnFirstUse(id);
     return FindResource(id, materials_);
 }
 
 std::weak_ptr<filament::MaterialInstance>
 FilamentResourceManager::GetMaterialInstance(const MaterialInstanceHandle& id) {
+    LoadDefaultOnFirstUse(id);
     return FindResource(id, material_instances_);
 }
 
@@ -587,6 +599,7 @@ std::weak_ptr<filament::IndexBuffer> FilamentResourceManager::GetIndexBuffer(
 }
 
 void FilamentResourceManager::DestroyAll() {
+    lazy_defaults_.clear();
     material_instances_.clear();
     materials_.clear();
     textures_.clear();
@@ -698,6 +711,17 @@ filament::Texture* FilamentResourceManager::LoadFilledTexture(
     return texture;
 }
 
+void FilamentResourceManager::LoadDefaultOnFirstUse(
+        const REHandle_abstract& id) {
+    auto found = lazy_defaults_.find(id);
+    if (found != lazy_defaults_.end()) {
+        // Removed before loading, as the loaders register new resources.
+        auto load = std::move(found->second);
+        lazy_defaults_.erase(found);
+        load();
+    }
+}
+
 void FilamentResourceManager::LoadDefaults() {
     // FIXME: Move to precompiled resource blobs
     const std::string& resource_root = EngineInstance::GetResourcePath();
@@ -722,167 +746,221 @@ void FilamentResourceManager::LoadDefaults() {
     const auto default_color_alpha =
             filament::math::float4{1.0f, 1.0f, 1.0f, 1.0f};
 
-    const auto lit_path = resource_root + "/defaultLit.filamat";
-    auto lit_mat = LoadMaterialFromFile(lit_path, engine_);
-    lit_mat->setDefaultParameter("baseColor", filament::RgbType::sRGB,
-                                 default_color);
-    lit_mat->setDefaultParameter("baseRoughness", 0.7f);
-    lit_mat->setDefaultParameter("reflectance", 0.5f);
-    lit_mat->setDefaultParameter("baseMetallic", 0.f);
-    lit_mat->setDefaultParameter("clearCoat", 0.f);
-    lit_mat->setDefaultParameter("clearCoatRoughness", 0.f);
-    lit_mat->setDefaultParameter("anisotropy", 0.f);
-    lit_mat->setDefaultParameter("pointSize", 3.f);
-    lit_mat->setDefaultParameter("albedo", texture, default_sampler);
-    lit_mat->setDefaultParameter("ao_rough_metalMap", texture, default_sampler);
-    lit_mat->setDefaultParameter("normalMap", normal_map, default_sampler);
-    lit_mat->setDefaultParameter("reflectanceMap", texture, default_sampler);
-    // NOTE: Disabled to avoid Filament warning until shader is reworked to
-    // reduce sampler usage.
-    // lit_mat->setDefaultParameter("clearCoatMap", texture, default_sampler);
-    // lit_mat->setDefaultParameter("clearCoatRoughnessMap", texture,
-    //                              default_sampler);
-    lit_mat->setDefaultParameter("anisotropyMap", texture, default_sampler);
-    materials_[kDefaultLit] = BoxResource(lit_mat, engine_);
-
-    const auto lit_trans_path =
-            resource_root + "/defaultLitTransparency.filamat";
-    auto lit_trans_mat = LoadMaterialFromFile(lit_trans_path, engine_);
-    lit_trans_mat->setDefaultParameter("baseColor",
-                                       filament::RgbaType::PREMULTIPLIED_sRGB,
-                                       default_color_alpha);
-    lit_trans_mat->setDefaultParameter("baseRoughness", 0.7f);
-    lit_trans_mat->setDefaultParameter("reflectance", 0.5f);
-    lit_trans_mat->setDefaultParameter("baseMetallic", 0.f);
-    lit_trans_mat->setDefaultParameter("clearCoat", 0.f);
-    lit_trans_mat->setDefaultParameter("clearCoatRoughness", 0.f);
-    lit_trans_mat->setDefaultParameter("anisotropy", 0.f);
-    lit_trans_mat->setDefaultParameter("pointSize", 3.f);
-    lit_trans_mat->setDefaultParameter("albedo", texture, default_sampler);
-    lit_trans_mat->setDefaultParameter("ao_rough_metalMap", texture,
-                                       default_sampler);
-    lit_trans_mat->setDefaultParameter("normalMap", normal_map,
-                                       default_sampler);
-    lit_trans_mat->setDefaultParameter("reflectanceMap", texture,
-                                       default_sampler);
-    // NOTE: Disabled to avoid Filament warning until shader is reworked to
-    // reduce sampler usage.
-    // lit_trans_mat->setDefaultParameter("clearCoatMap", texture,
-    // default_sampler);
-    // lit_trans_mat->setDefaultParameter("clearCoatRoughnessMap", texture,
-    //                              default_sampler);
-    lit_trans_mat->setDefaultParameter("anisotropyMap", texture,
-                                       default_sampler);
-    materials_[kDefaultLitWithTransparency] =
-            BoxResource(lit_trans_mat, engine_);
-
-    const auto lit_ssr_path = resource_root + "/defaultLitSSR.filamat";
-    auto lit_ssr_mat = LoadMaterialFromFile(lit_ssr_path, engine_);
-    lit_ssr_mat->setDefaultParameter("baseColor",
-                                     filament::RgbaType::PREMULTIPLIED_sRGB,
-                                     default_color_alpha);
-    lit_ssr_mat->setDefaultParameter("baseRoughness", 0.7f);
-    lit_ssr_mat->setDefaultParameter("reflectance", 0.5f);
-    lit_ssr_mat->setDefaultParameter("baseMetallic", 0.f);
-    lit_ssr_mat->setDefaultParameter("clearCoat", 0.f);
-    lit_ssr_mat->setDefaultParameter("clearCoatRoughness", 0.f);
-    lit_ssr_mat->setDefaultParameter("anisotropy", 0.f);
-    lit_ssr_mat->setDefaultParameter("thickness", 0.5f);
-    lit_ssr_mat->setDefaultParameter("transmission", 1.f);
-    lit_ssr_mat->setDefaultParameter("absorption",
-                                     filament::math::float3(0.f, 0.f, 0.f));
-    lit_ssr_mat->setDefaultParameter("pointSize", 3.f);
-    lit_ssr_mat->setDefaultParameter("albedo", texture, default_sampler);
-    lit_ssr_mat->setDefaultParameter("ao_rough_metalMap", texture,
+    // The materials are built on first use, as parsing all their packages
+    // up front delays the first frame.
+    lazy_defaults_[kDefaultLit] = [=]() {
+        const auto lit_path = resource_root + "/defaultLit.filamat";
+        auto lit_mat = LoadMaterialFromFile(lit_path, engine_);
+        lit_mat->setDefaultParameter("baseColor", filament::RgbType::sRGB,
+                                     default_color);
+        lit_mat->setDefaultParameter("baseRoughness", 0.7f);
+        lit_mat->setDefaultParameter("reflectance", 0.5f);
+        lit_mat->setDefaultParameter("baseMetallic", 0.f);
+        lit_mat->setDefaultParameter("clearCoat", 0.f);
+        lit_mat->setDefaultParameter("clearCoatRoughness", 0.f);
+        lit_mat->setDefaultParameter("anisotropy", 0.f);
+        lit_mat->setDefaultParameter("pointSize", 3.f);
+        lit_mat->setDefaultParameter("albedo", texture, default_sampler);
+        lit_mat->setDefaultParameter("ao_rough_metalMap", texture,
                                      default_sampler);
-    lit_ssr_mat->setDefaultParameter("normalMap", normal_map, default_sampler);
-    lit_ssr_mat->setDefaultParameter("reflectanceMap", texture,
+        lit_mat->setDefaultParameter("normalMap", normal_map, default_sampler);
+        lit_mat->setDefaultParameter("reflectanceMap", texture,
                                      default_sampler);
-    materials_[kDefaultLitSSR] = BoxResource(lit_ssr_mat, engine_);
-
-    const auto unlit_path = resource_root + "/defaultUnlit.filamat";
-    auto unlit_mat = LoadMaterialFromFile(unlit_path, engine_);
-    unlit_mat->setDefaultParameter("baseColor", filament::RgbType::sRGB,
-                                   default_color);
-    unlit_mat->setDefaultParameter("pointSize", 3.f);
-    unlit_mat->setDefaultParameter("albedo", texture, default_sampler);
-    materials_[kDefaultUnlit] = BoxResource(unlit_mat, engine_);
-
-    const auto unlit_trans_path =
-            resource_root + "/defaultUnlitTransparency.filamat";
-    auto unlit_trans_mat = LoadMaterialFromFile(unlit_trans_path, engine_);
-    unlit_trans_mat->setDefaultParameter("baseColor", filament::RgbType::sRGB,
-                                         default_color);
-    unlit_trans_mat->setDefaultParameter("pointSize", 3.f);
-    unlit_trans_mat->setDefaultParameter("albedo", texture, default_sampler);
-    materials_[kDefaultUnlitWithTransparency] =
-            BoxResource(unlit_trans_mat, engine_);
-
-    const auto depth_path = resource_root + "/depth.filamat";
-    auto depth_mat = LoadMaterialFromFile(depth_path, engine_);
-    depth_mat->setDefaultParameter("pointSize", 3.f);
-    materials_[kDefaultDepthShader] = BoxResource(depth_mat, engine_);
-
-    const auto gradient_path = resource_root + "/unlitGradient.filamat";
-    auto gradient_mat = LoadMaterialFromFile(gradient_path, engine_);
-    gradient_mat->setDefaultParameter("pointSize", 3.f);
-    materials_[kDefaultUnlitGradientShader] =
-            BoxResource(gradient_mat, engine_);
+        // NOTE: Disabled to avoid Filament warning until shader is reworked
+        // to reduce sampler usage.
+        // lit_mat->setDefaultParameter("clearCoatMap", texture,
+        //                              default_sampler);
+        // lit_mat->setDefaultParameter("clearCoatRoughnessMap", texture,
+        //                              default_sampler);
+        lit_mat->setDefaultParameter("anisotropyMap", texture, default_sampler);
+        materials_[kDefaultLit] = BoxResource(lit_mat, engine_);
+    };
+
+    lazy_defaults_[kDefaultLitWithTransparency] = [=]() {
+        const auto lit_trans_path =
+                resource_root + "/defaultLitTransparency.filamat";
+        auto lit_trans_mat = LoadMaterialFromFile(lit_trans_path, engine_);
+        lit_trans_mat->setDefaultParameter(
+                "baseColor", filament::RgbaType::PREMULTIPLIED_sRGB,
+                default_color_alpha);
+        lit_trans_mat->setDefaultParameter("baseRoughness", 0.7f);
+        lit_trans_mat->setDefaultParameter("reflectance", 0.5f);
+        lit_trans_mat->setDefaultParameter("baseMetallic", 0.f);
+        lit_trans_mat->setDefaultParameter("clearCoat", 0.f);
+        lit_trans_mat->setDefaultParameter("clearCoatRoughness", 0.f);
+        lit_trans_mat->setDefaultParameter("anisotropy", 0.f);
+        lit_trans_mat->setDefaultParameter("pointSize", 3.f);
+        lit_trans_mat->setDefaultParameter("albedo", texture, default_sampler);
+        lit_trans_mat->setDefaultParameter("ao_rough_metalMap", texture,
+                                           default_sampler);
+        lit_trans_mat->setDefaultParameter("normalMap", normal_map,
+                                           default_sampler);
+        lit_trans_mat->setDefaultParameter("reflectanceMap", texture,
+                                           default_sampler);
+        // NOTE: Disabled to avoid Filament warning until shader is reworked
+        // to reduce sampler usage.
+        // lit_trans_mat->setDefaultParameter("clearCoatMap", texture,
+        // default_sampler);
+        // lit_trans_mat->setDefaultParameter("clearCoatRoughnessMap", texture,
+        //                              default_sampler);
+        lit_trans_mat->setDefaultParameter("anisotropyMap", texture,
+                                           default_sampler);
+        materials_[kDefaultLitWithTransparency] =
+                BoxResource(lit_trans_mat, engine_);
+    };
+
+    lazy_defaults_[kDefaultLitSSR] = [=]() {
+        const auto lit_ssr_path = resource_root + "/defaultLitSSR.filamat";
+        auto lit_ssr_mat = LoadMaterialFromFile(lit_ssr_path, engine_);
+        lit_ssr_mat->setDefaultParameter(
+                "baseColor", filament::RgbaType::PREMULTIPLIED_sRGB,
+                default_color_alpha);
+        lit_ssr_mat->setDefaultParameter("baseRoughness", 0.7f);
+        lit_ssr_mat->setDefaultParameter("reflectance", 0.5f);
+        lit_ssr_mat->setDefaultParameter("baseMetallic", 0.f);
+        lit_ssr_mat->setDefaultParameter("clearCoat", 0.f);
+        lit_ssr_mat->setDefaultParameter("clearCoatRoughness", 0.f);
+        lit_ssr_mat->setDefaultParameter("anisotropy", 0.f);
+        lit_ssr_mat->setDefaultParameter("thickness", 0.5f);
+        lit_ssr_mat->setDefaultParameter("transmission", 1.f);
+        lit_ssr_mat->setDefaultParameter(
+                "absorption", filament::math::float3(0.f, 0.f, 0.f));
+        lit_ssr_mat->setDefaultParameter("pointSize", 3.f);
+        lit_ssr_mat->setDefaultParameter("albedo", texture, default_sampler);
+        lit_ssr_mat->setDefaultParameter("ao_rough_metalMap", texture,
+                                         default_sampler);
+        lit_ssr_mat->setDefaultParameter("normalMap", normal_map,
+                                         default_sampler);
+        lit_ssr_mat->setDefaultParameter("reflectanceMap", texture,
+                                         default_sampler);
+        materials_[kDefaultLitSSR] = BoxResource(lit_ssr_mat, engine_);
+    };
+
+    lazy_defaults_[kDefaultUnlit] = [=]() {
+        const auto unlit_path = resource_root + "/defaultUnlit.filamat";
+        auto unlit_mat = LoadMaterialFromFile(unlit_path, engine_);
+        unlit_mat->setDefaultParameter("baseColor", filament::RgbType::sRGB,
+                                       default_color);
+        unlit_mat->setDefaultParameter("pointSize", 3.f);
+        unlit_mat->setDefaultParameter("albedo", texture, default_sampler);
+        materials_[kDefaultUnlit] = BoxResource(unlit_mat, engine_);
+    };
+
+    lazy_defaults_[kDefaultUnlitWithTransparency] = [=]() {
+        const auto unlit_trans_path =
+                resource_root + "/defaultUnlitTransparency.filamat";
+        auto unlit_trans_mat =
+                LoadMaterialFromFile(unlit_trans_path, engine_);
+        unlit_trans_mat->setDefaultParameter(
+                "baseColor", filament::RgbType::sRGB, default_color);
+        unlit_trans_mat->setDefaultParameter("pointSize", 3.f);
+        unlit_trans_mat->setDefaultParameter("albedo", texture,
+                                             default_sampler);
+        materials_[kDefaultUnlitWithTransparency] =
+                BoxResource(unlit_trans_mat, engine_);
+    };
+
+    lazy_defaults_[kDefaultDepthShader] = [=]() {
+        const auto depth_path = resource_root + "/depth.filamat";
+        auto depth_mat = LoadMaterialFromFile(depth_path, engine_);
+        depth_mat->setDefaultParameter("pointSize", 3.f);
+        materials_[kDefaultDepthShader] = BoxResource(depth_mat, engine_);
+    };
+
+    lazy_defaults_[kDefaultDepthValueShader] = [=]() {
+        const auto depth_value_path = resource_root + "/depthValue.filamat";
+        auto depth_value_mat =
+                LoadMaterialFromFile(depth_value_path, engine_);
+        depth_value_mat->setDefaultParameter("pointSize", 3.f);
+        materials_[kDefaultDepthValueShader] =
+                BoxResource(depth_value_mat, engine_);
+    };
+
+    lazy_defaults_[kDefaultUnlitGradientShader] = [=]() {
+        const auto gradient_path = resource_root + "/unlitGradient.filamat";
+        auto gradient_mat = LoadMaterialFromFile(gradient_path, engine_);
+        gradient_mat->setDefaultParameter("pointSize", 3.f);
+        materials_[kDefaultUnlitGradientShader] =
+                BoxResource(gradient_mat, engine_);
+    };
 
     // NOTE: Legacy. Can be removed soon.
-    const auto hdepth = CreateMaterial(ResourceLoadRequest(depth_path.data()));
-    auto depth_mat_inst = materials_[hdepth];
-    depth_mat_inst->setDefaultParameter("pointSize", 3.f);
-    material_instances_[kDepthMaterial] =
-            BoxResource(depth_mat_inst->createInstance(), engine_);
+    lazy_defaults_[kDepthMaterial] = [=]() {
+        const auto depth_path = resource_root + "/depth.filamat";
+        const auto hdepth =
+                CreateMaterial(ResourceLoadRequest(depth_path.data()));
+        auto depth_mat_inst = materials_[hdepth];
+        depth_mat_inst->setDefaultParameter("pointSize", 3.f);
+        material_instances_[kDepthMaterial] =
+                BoxResource(depth_mat_inst->createInstance(), engine_);
+    };
 
-    const auto normals_path = resource_root + "/normals.filamat";
-    auto normals_mat = LoadMaterialFromFile(normals_path, engine_);
-    normals_mat->setDefaultParameter("pointSize", 3.f);
-    materials_[kDefaultNormalShader] = BoxResource(normals_mat, engine_);
+    lazy_defaults_[kDefaultNormalShader] = [=]() {
+        const auto normals_path = resource_root + "/normals.filamat";
+        auto normals_mat = LoadMaterialFromFile(normals_path, engine_);
+        normals_mat->setDefaultParameter("pointSize", 3.f);
+        materials_[kDefaultNormalShader] = BoxResource(normals_mat, engine_);
+    };
 
     // NOTE: Legacy. Can be removed soon.
-    const auto hnormals =
-            CreateMaterial(ResourceLoadRequest(normals_path.data()));
-    auto normals_mat_inst = materials_[hnormals];
-    normals_mat_inst->setDefaultParameter("pointSize", 3.f);
-    material_instances_[kNormalsMaterial] =
-            BoxResource(normals_mat_inst->createInstance(), engine_);
-
-    const auto colormap_map_path = resource_root + "/colorMap.filamat";
-    const auto hcolormap_mat =
-            CreateMaterial(ResourceLoadRequest(colormap_map_path.data()));
-    auto colormap_mat = materials_[hcolormap_mat];
-    auto colormap_mat_inst = colormap_mat->createInstance();
-    colormap_mat_inst->setParameter("colorMap", color_map, default_sampler);
-    material_instances_[kColorMapMaterial] =
-            BoxResource(colormap_mat_inst, engine_);
-
-    const auto solid_path = resource_root + "/unlitSolidColor.filamat";
-    auto solid_mat = LoadMaterialFromFile(solid_path, engine_);
-    solid_mat->setDefaultParameter("baseColor", filament::RgbType::sRGB,
-                                   {0.5f, 0.5f, 0.5f});
-    materials_[kDefaultUnlitSolidColorShader] = BoxResource(solid_mat, engine_);
-
-    const auto bg_path = resource_root + "/unlitBackground.filamat";
-    auto bg_mat = LoadMaterialFromFile(bg_path, engine_);
-    bg_mat->setDefaultParameter("baseColor", filament::RgbType::sRGB,
-                                {1.0f, 1.0f, 1.0f});
-    bg_mat->setDefaultParameter("albedo", texture, default_sampler);
-    bg_mat->setDefaultParameter("aspectRatio", 0.0f);
-    materials_[kDefaultUnlitBackgroundShader] = BoxResource(bg_mat, engine_);
-
-    const auto line_path = resource_root + "/unlitLine.filamat";
-    auto line_mat = LoadMaterialFromFile(line_path, engine_);
-    line_mat->setDefaultParameter("baseColor", filament::RgbType::LINEAR,
-                                  {1.f, 1.f, 1.f});
-    line_mat->setDefaultParameter("lineWidth", 1.f);
-    materials_[kDefaultLineShader] = BoxResource(line_mat, engine_);
-
-    const auto poffset_path = resource_root + "/unlitPolygonOffset.filamat";
-    auto poffset_mat = LoadMaterialFromFile(poffset_path, engine_);
-    materials_[kDefaultUnlitPolygonOffsetShader] =
-            BoxResource(poffset_mat, engine_);
+    lazy_defaults_[kNormalsMaterial] = [=]() {
+        const auto normals_path = resource_root + "/normals.filamat";
+        const auto hnormals =
+                CreateMaterial(ResourceLoadRequest(normals_path.data()));
+        auto normals_mat_inst = materials_[hnormals];
+        normals_mat_inst->setDefaultParameter("pointSize", 3.f);
+        material_instances_[kNormalsMaterial] =
+                BoxResource(normals_mat_inst->createInstance(), engine_);
+    };
+
+    lazy_defaults_[kColorMapMaterial] = [=]() {
+        const auto colormap_map_path = resource_root + "/colorMap.filamat";
+        const auto hcolormap_mat =
+                CreateMaterial(ResourceLoadRequest(colormap_map_path.data()));
+        auto colormap_mat = materials_[hcolormap_mat];
+        auto colormap_mat_inst = colormap_mat->createInstance();
+        colormap_mat_inst->setParameter("colorMap", color_map,
+                                        default_sampler);
+        material_instances_[kColorMapMaterial] =
+                BoxResource(colormap_mat_inst, engine_);
+    };
+
+    lazy_defaults_[kDefaultUnlitSolidColorShader] = [=]() {
+        const auto solid_path = resource_root + "/unlitSolidColor.filamat";
+        auto solid_mat = LoadMaterialFromFile(solid_path, engine_);
+        solid_mat->setDefaultParameter("baseColor", filament::RgbType::sRGB,
+                                       {0.5f, 0.5f, 0.5f});
+        materials_[kDefaultUnlitSolidColorShader] =
+                BoxResource(solid_mat, engine_);
+    };
+
+    lazy_defaults_[kDefaultUnlitBackgroundShader] = [=]() {
+        const auto bg_path = resource_root + "/unlitBackground.filamat";
+        auto bg_mat = LoadMaterialFromFile(bg_path, engine_);
+        bg_mat->setDefaultParameter("baseColor", filament::RgbType::sRGB,
+                                    {1.0f, 1.0f, 1.0f});
+        bg_mat->setDefaultParameter("albedo", texture, default_sampler);
+        bg_mat->setDefaultParameter("aspectRatio", 0.0f);
+        materials_[kDefaultUnlitBackgroundShader] =
+                BoxResource(bg_mat, engine_);
+    };
+
+    lazy_defaults_[kDefaultLineShader] = [=]() {
+        const auto line_path = resource_root + "/unlitLine.filamat";
+        auto line_mat = LoadMaterialFromFile(line_path, engine_);
+        line_mat->setDefaultParameter("baseColor", filament::RgbType::LINEAR,
+                                      {1.f, 1.f, 1.f});
+        line_mat->setDefaultParameter("lineWidth", 1.f);
+        materials_[kDefaultLineShader] = BoxResource(line_mat, engine_);
+    };
+
+    lazy_defaults_[kDefaultUnlitPolygonOffsetShader] = [=]() {
+        const auto poffset_path =
+                resource_root + "/unlitPolygonOffset.filamat";
+        auto poffset_mat = LoadMaterialFromFile(poffset_path, engine_);
+        materials_[kDefaultUnlitPolygonOffsetShader] =
+                BoxResource(poffset_mat, engine_);
+    };
 }
 
 }  // namespace rendering
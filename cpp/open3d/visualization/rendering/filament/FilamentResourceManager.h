@@ -26,6 +26,7 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <unordered_map>
 #include <unordered_set>
@@ -68,6 +69,7 @@ public:
     static const MaterialHandle kDefaultUnlitWithTransparency;
     static const MaterialHandle kDefaultNormalShader;
     static const MaterialHandle kDefaultDepthShader;
+    static const MaterialHandle kDefaultDepthValueShader;
     static const MaterialHandle kDefaultUnlitGradientShader;
     static const MaterialHandle kDefaultUnlitSolidColorShader;
     static const MaterialHandle kDefaultUnlitBackgroundShader;
@@ -125,6 +127,12 @@ public:
     void DestroyAll();
     void Destroy(const REHandle_abstract& id);
 
+    // Counts the bytes given to the vertex and index buffers, which the
+    // renderer reports in its frame statistics.
+    void AddUploadedBytes(size_t bytes) { uploaded_bytes_ += bytes; }
+    // Returns the bytes counted since the previous call.
+    size_t TakeUploadedBytes();
+
 public:
     // Only public so that .cpp file can use this
     template <class ResourceType>
@@ -140,6 +148,7 @@ public:
 
 private:
     filament::Engine& engine_;
+    size_t uploaded_bytes_ = 0;
 
     template <class ResourceType>
     using ResourcesContainer =
@@ -165,6 +174,12 @@ private:
     filament::Texture* LoadFilledTexture(const Eigen::Vector3f& color,
                                          size_t dimension);
 
+    // Loaders of the default materials and material instances not built yet.
+    std::unordered_map<REHandle_abstract, std::function<void()>>
+            lazy_defaults_;
+
+    // Builds the default resource \p id if it is not built yet.
+    void LoadDefaultOnFirstUse(const REHandle_abstract& id);
     void LoadDefaults();
 };
 
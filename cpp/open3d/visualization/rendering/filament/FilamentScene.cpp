@@ -32,6 +32,8 @@
 //       32 so that x >> 32 gives a warning. (Or maybe the compiler can't
 //       determine the if statement does not run.)
 // 4305: LightManager.h needs to specify some constants as floats
+#include <algorithm>
+#include <numeric>
 #include <unordered_set>
 #ifdef _MSC_VER
 #pragma warning(push)
@@ -72,10 +74,13 @@
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/geometry/TriangleMesh.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/Timer.h"
 #include "open3d/visualization/rendering/Light.h"
 #include "open3d/visualization/rendering/Material.h"
 #include "open3d/visualization/rendering/Model.h"
+#include "open3d/visualization/rendering/PointCloudLOD.h"
 #include "open3d/visualization/rendering/RendererHandle.h"
 #include "open3d/visualization/rendering/filament/FilamentEngine.h"
 #include "open3d/visualization/rendering/filament/FilamentEntitiesMods.h"
@@ -110,6 +115,7 @@ std::unordered_map<std::string, MaterialHandle> shader_mappings = {
         {"defaultUnlit", ResourceManager::kDefaultUnlit},
         {"normals", ResourceManager::kDefaultNormalShader},
         {"depth", ResourceManager::kDefaultDepthShader},
+        {"depthValue", ResourceManager::kDefaultDepthValueShader},
         {"unlitGradient", ResourceManager::kDefaultUnlitGradientShader},
         {"unlitSolidColor", ResourceManager::kDefaultUnlitSolidColorShader},
         {"unlitPolygonOffset",
@@ -309,7 +315,8 @@ bool FilamentScene::AddGeometry(const std::string& object_name,
             [](const t::geometry::PointCloud& cloud) -> filament::Box {
         Eigen::Vector3f min_pt = {1e30f, 1e30f, 1e30f};
         Eigen::Vector3f max_pt = {-1e30f, -1e30f, -1e30f};
-        const auto& points = cloud.GetPoints();
+        const auto points =
+                GeometryBuffersBuilder::ToHostFloat32(cloud.GetPoints());
         const size_t n = points.GetLength();
         float* pts = (float*)points.GetDataPtr();
         for (size_t i = 0; i < 3 * n; i += 3) {
@@ -334,18 +341,6 @@ bool FilamentScene::AddGeometry(const std::string& object_name,
         utility::LogWarning("Point cloud for object {} is empty", object_name);
         return false;
     }
-    const auto& points = point_cloud.GetPoints();
-    if (points.GetDevice().GetType() == core::Device::DeviceType::CUDA) {
-        utility::LogWarning(
-                "GPU resident tensor point clouds are not supported at this "
-                "time");
-        return false;
-    }
-    if (points.GetDtype() != core::Dtype::Float32) {
-        utility::LogWarning("tensor point cloud must have Dtype of Float32");
-        return false;
-    }
-
     auto buffer_builder = GeometryBuffersBuilder::GetBuilder(point_cloud);
     if (!downsampled_name.empty()) {
         buffer_builder->SetDownsampleThreshold(downsample_threshold);
@@ -374,6 +369,37 @@ bool FilamentScene::AddGeometry(const std::string& object_name,
     return success;
 }
 
+bool FilamentScene::AddGeometry(const std::string& object_name,
+                                const t::geometry::TriangleMesh& mesh,
+                                const Material& material) {
+    if (geometries_.count(object_name) > 0) {
+        utility::LogWarning(
+                "Geometry {} has already been added to scene graph.",
+                object_name);
+        return false;
+    }
+    if (mesh.IsEmpty() || !mesh.HasTriangles()) {
+        utility::LogWarning("Triangle mesh for object {} is empty",
+                            object_name);
+        return false;
+    }
+    if (!mesh.HasVertexNormals() &&
+        (material.shader == "defaultLit" ||
+         material.shader == "defaultLitTransparency")) {
+        utility::LogWarning(
+                "Using a shader with lighting but geometry has no normals.");
+    }
+
+    auto buffer_builder = GeometryBuffersBuilder::GetBuilder(mesh);
+    buffer_builder->SetAdjustColorsForSRGBToneMapping(material.sRGB_color);
+    auto buffers = buffer_builder->ConstructBuffers();
+    auto vb = std::get<0>(buffers);
+    auto ib = std::get<1>(buffers);
+    filament::Box aabb = buffer_builder->ComputeAABB();
+    return CreateAndAddFilamentEntity(object_name, *buffer_builder, aabb, vb,
+                                      ib, material);
+}
+
 #ifndef NDEBUG
 void OutputMaterialProperties(const visualization::rendering::Material& mat) {
     utility::LogInfo("Material {}", mat.name);
@@ -416,6 +442,110 @@ bool FilamentScene::AddGeometry(const std::string& object_name,
     return true;
 }
 
+bool FilamentScene::AddGeometry(const std::string& object_name,
+                                std::shared_ptr<PointCloudLOD> lod,
+                                const Material& material,
+                                size_t point_budget /*= 10000000*/,
+                                size_t memory_budget /*= 1 << 30*/) {
+    if (HasGeometry(object_name)) {
+        utility::LogWarning(
+                "Geometry {} has already been added to scene graph.",
+                object_name);
+        return false;
+    }
+    if (!lod || lod->GetNodes().empty()) {
+        utility::LogWarning("Point cloud octree for object {} is empty",
+                            object_name);
+        return false;
+    }
+
+    // The nodes are streamed in by the next Draw().
+    LODGeometry& lod_geom = lod_geometries_[object_name];
+    lod_geom.lod = lod;
+    lod_geom.material = material;
+    lod_geom.point_budget = point_budget;
+    lod_geom.memory_budget = memory_budget;
+    return true;
+}
+
+std::string FilamentScene::GetLODNodeName(const std::string& object_name,
+                                          size_t node_idx) {
+    return object_name + ":lod:" + std::to_string(node_idx);
+}
+
+void FilamentScene::UpdateLODGeometries(const View& view) {
+    // Size of a point in the vertex and index buffers of
+    // PointCloudBuffersBuilder.
+    static const size_t kBytesPerPoint = 56;
+    // Bounds the time of a frame spent creating buffers. The coarse nodes
+    // are selected first, so the missing nodes only lack detail.
+    static const int kMaxNewNodesPerFrame = 8;
+
+    const Camera* camera = view.GetCamera();
+    const int viewport_height = view.GetViewport()[3];
+    for (auto& entry : lod_geometries_) {
+        const std::string& object_name = entry.first;
+        LODGeometry& lod_geom = entry.second;
+        const auto& nodes = lod_geom.lod->GetNodes();
+        ++lod_geom.frame;
+
+        std::vector<size_t> selected;
+        if (lod_geom.visible) {
+            const Eigen::Matrix4f view_matrix =
+                    camera->GetViewMatrix().matrix() *
+                    lod_geom.transform.matrix();
+            selected = lod_geom.lod->SelectNodes(
+                    view_matrix, camera->GetProjectionMatrix().matrix(),
+                    viewport_height, lod_geom.point_budget);
+        }
+
+        int num_new_nodes = 0;
+        for (size_t node_idx : selected) {
+            const std::string node_name = GetLODNodeName(object_name, node_idx);
+            auto resident = lod_geom.resident_nodes.find(node_idx);
+            if (resident != lod_geom.resident_nodes.end()) {
+                resident->second = lod_geom.frame;
+                ShowGeometry(node_name, true);
+                continue;
+            }
+            if (num_new_nodes >= kMaxNewNodesPerFrame) continue;
+            ++num_new_nodes;
+            auto points = lod_geom.lod->GetNodePoints(node_idx);
+            // The nodes are selected in the frustum already, so they are left
+            // out of the scene culling.
+            const bool culling_dirty = culling_dirty_;
+            if (!points || points->IsEmpty() ||
+                !AddGeometry(node_name, *points, lod_geom.material)) {
+                continue;
+            }
+            geometries_[node_name].culling = false;
+            SetGeometryTransform(node_name, lod_geom.transform);
+            culling_dirty_ = culling_dirty;
+            lod_geom.resident_nodes[node_idx] = lod_geom.frame;
+            lod_geom.resident_bytes +=
+                    nodes[node_idx].num_points * kBytesPerPoint;
+        }
+
+        // Hides the nodes that are not selected, and releases the buffers of
+        // the least recently selected ones beyond the memory budget.
+        std::vector<std::pair<uint64_t, size_t>> unselected;
+        for (const auto& node : lod_geom.resident_nodes) {
+            if (node.second != lod_geom.frame) {
+                ShowGeometry(GetLODNodeName(object_name, node.first), false);
+                unselected.emplace_back(node.second, node.first);
+            }
+        }
+        std::sort(unselected.begin(), unselected.end());
+        for (const auto& node : unselected) {
+            if (lod_geom.resident_bytes <= lod_geom.memory_budget) break;
+            RemoveGeometry(GetLODNodeName(object_name, node.second));
+            lod_geom.resident_bytes -=
+                    nodes[node.second].num_points * kBytesPerPoint;
+            lod_geom.resident_nodes.erase(node.second);
+        }
+    }
+}
+
 bool FilamentScene::CreateAndAddFilamentEntity(
         const std::string& object_name,
         GeometryBuffersBuilder& buffer_builder,
@@ -454,8 +584,12 @@ bool FilamentScene::CreateAndAddFilamentEntity(
                                    vb,
                                    ib}));
 
+        auto& geom = giter.first->second;
+        geom.primitive_type = buffer_builder.GetPrimitiveType();
+        geom.index_count = ibuf->getIndexCount();
         SetGeometryTransform(object_name, Transform::Identity());
-        UpdateMaterialProperties(giter.first->second);
+        UpdateMaterialProperties(geom);
+        culling_dirty_ = true;
     } else {
         // NOTE: Is there a better way to handle builder failing? That's a
         // sign of a major problem.
@@ -473,19 +607,13 @@ bool FilamentScene::CreateAndAddFilamentEntity(
 }
 
 bool FilamentScene::HasGeometry(const std::string& object_name) const {
-    if (GeometryIsModel(object_name)) {
+    if (GeometryIsModel(object_name) || lod_geometries_.count(object_name)) {
         return true;
     }
     auto geom_entry = geometries_.find(object_name);
     return (geom_entry != geometries_.end());
 }
 
-static void deallocate_vertex_buffer(void* buffer,
-                                     size_t size,
-                                     void* user_ptr) {
-    free(buffer);
-}
-
 void FilamentScene::UpdateGeometry(const std::string& object_name,
                                    const t::geometry::PointCloud& point_cloud,
                                    uint32_t update_flags) {
@@ -496,8 +624,7 @@ void FilamentScene::UpdateGeometry(const std::string& object_name,
         auto vbuf_ptr = resource_mgr_.GetVertexBuffer(g->vb).lock();
         auto vbuf = vbuf_ptr.get();
 
-        const auto& points = point_cloud.GetPoints();
-        const size_t n_vertices = points.GetLength();
+        const size_t n_vertices = point_cloud.GetPoints().GetLength();
 
         // NOTE: number of points in the updated point cloud must be the
         // same as the number of points when the vertex buffer was first
@@ -512,72 +639,194 @@ void FilamentScene::UpdateGeometry(const std::string& object_name,
             return;
         }
 
+        // Only the flagged buffers are replaced. The descriptors share the
+        // memory of the Float32 CPU tensors until Filament has uploaded them.
+        using Builder = GeometryBuffersBuilder;
         if (update_flags & kUpdatePointsFlag) {
-            filament::VertexBuffer::BufferDescriptor pts_descriptor(
-                    points.GetDataPtr(), n_vertices * 3 * sizeof(float));
-            vbuf->setBufferAt(engine_, 0, std::move(pts_descriptor));
+            Builder::UploadVertexBuffer(
+                    *vbuf, 0,
+                    Builder::CreateTensorDescriptor(
+                            Builder::ToHostFloat32(point_cloud.GetPoints())));
         }
 
         if (update_flags & kUpdateColorsFlag && point_cloud.HasPointColors()) {
-            const size_t color_array_size = n_vertices * 3 * sizeof(float);
-            filament::VertexBuffer::BufferDescriptor color_descriptor(
-                    point_cloud.GetPointColors().GetDataPtr(),
-                    color_array_size);
-            vbuf->setBufferAt(engine_, 1, std::move(color_descriptor));
+            Builder::UploadVertexBuffer(
+                    *vbuf, 1,
+                    Builder::CreateTensorDescriptor(Builder::ToHostFloat32(
+                            point_cloud.GetPointColors())));
         }
 
         if (update_flags & kUpdateNormalsFlag &&
             point_cloud.HasPointNormals()) {
-            const size_t normal_array_size = n_vertices * 4 * sizeof(float);
-            const auto& normals = point_cloud.GetPointNormals();
-
-            // Converting normals to Filament type - quaternions
-            auto float4v_tangents = static_cast<filament::math::quatf*>(
-                    malloc(normal_array_size));
-            auto orientation = filament::geometry::SurfaceOrientation::Builder()
-                                       .vertexCount(n_vertices)
-                                       .normals(reinterpret_cast<
-                                                const filament::math::float3*>(
-                                               normals.GetDataPtr()))
-                                       .build();
-            orientation->getQuats(float4v_tangents, n_vertices);
-            filament::VertexBuffer::BufferDescriptor normals_descriptor(
-                    float4v_tangents, normal_array_size,
-                    deallocate_vertex_buffer);
-            vbuf->setBufferAt(engine_, 2, std::move(normals_descriptor));
+            Builder::UploadVertexBuffer(
+                    *vbuf, 2,
+                    Builder::CreateTangentsDescriptor(
+                            Builder::ToHostFloat32(
+                                    point_cloud.GetPointNormals()),
+                            n_vertices));
         }
 
         if (update_flags & kUpdateUv0Flag) {
             const size_t uv_array_size = n_vertices * 2 * sizeof(float);
             if (point_cloud.HasPointAttr("uv")) {
-                filament::VertexBuffer::BufferDescriptor uv_descriptor(
-                        point_cloud.GetPointAttr("uv").GetDataPtr(),
-                        uv_array_size);
-                vbuf->setBufferAt(engine_, 3, std::move(uv_descriptor));
+                Builder::UploadVertexBuffer(
+                        *vbuf, 3,
+                        Builder::CreateTensorDescriptor(Builder::ToHostFloat32(
+                                point_cloud.GetPointAttr("uv"))));
             } else if (point_cloud.HasPointAttr("__visualization_scalar")) {
                 // Update in PointCloudBuffers.cpp, too:
                 //     TPointCloudBuffersBuilder::ConstructBuffers
                 float* uv_array = static_cast<float*>(malloc(uv_array_size));
                 memset(uv_array, 0, uv_array_size);
-                const float* src = static_cast<const float*>(
-                        point_cloud.GetPointAttr("__visualization_scalar")
-                                .GetDataPtr());
+                const auto scalars = Builder::ToHostFloat32(
+                        point_cloud.GetPointAttr("__visualization_scalar"));
+                const float* src =
+                        static_cast<const float*>(scalars.GetDataPtr());
                 const size_t n = 2 * n_vertices;
                 for (size_t i = 0; i < n; i += 2) {
                     uv_array[i] = *src++;
                 }
                 filament::VertexBuffer::BufferDescriptor uv_descriptor(
                         uv_array, uv_array_size, DeallocateBuffer);
-                vbuf->setBufferAt(engine_, 3, std::move(uv_descriptor));
+                Builder::UploadVertexBuffer(*vbuf, 3,
+                                            std::move(uv_descriptor));
             }
         }
     }
 }
 
+void FilamentScene::UpdateGeometry(const std::string& object_name,
+                                   const t::geometry::TriangleMesh& mesh,
+                                   uint32_t update_flags) {
+    auto geoms = GetGeometry(object_name, false);
+    if (geoms.empty()) {
+        return;
+    }
+
+    auto vbuf = resource_mgr_.GetVertexBuffer(geoms[0]->vb).lock();
+    const size_t n_vertices = mesh.GetVertices().GetLength();
+    // The triangles are not updated, so the mesh must have the same vertices
+    // as when it was added, only moved or recolored.
+    if (n_vertices != vbuf->getVertexCount()) {
+        utility::LogWarning(
+                "Geometry for triangle mesh {} cannot be updated because the "
+                "number of vertices has changed (Old: {}, New: {})",
+                object_name, vbuf->getVertexCount(), n_vertices);
+        return;
+    }
+
+    using Builder = GeometryBuffersBuilder;
+    if (update_flags & kUpdatePointsFlag) {
+        Builder::UploadVertexBuffer(
+                *vbuf, 0,
+                Builder::CreateTensorDescriptor(
+                        Builder::ToHostFloat32(mesh.GetVertices())));
+    }
+    if (update_flags & kUpdateColorsFlag && mesh.HasVertexColors()) {
+        Builder::UploadVertexBuffer(
+                *vbuf, 1,
+                Builder::CreateTensorDescriptor(
+                        Builder::ToHostFloat32(mesh.GetVertexColors())));
+    }
+    if (update_flags & kUpdateNormalsFlag && mesh.HasVertexNormals()) {
+        Builder::UploadVertexBuffer(
+                *vbuf, 2,
+                Builder::CreateTangentsDescriptor(
+                        Builder::ToHostFloat32(mesh.GetVertexNormals()),
+                        n_vertices));
+    }
+    if (update_flags & kUpdateUv0Flag && mesh.HasVertexAttr("uv")) {
+        Builder::UploadVertexBuffer(
+                *vbuf, 3,
+                Builder::CreateTensorDescriptor(
+                        Builder::ToHostFloat32(mesh.GetVertexAttr("uv"))));
+    }
+}
+
+void FilamentScene::UpdateGeometryRange(
+        const std::string& object_name,
+        const t::geometry::PointCloud& point_cloud,
+        size_t start,
+        uint32_t update_flags) {
+    auto geoms = GetGeometry(object_name, false);
+    if (geoms.empty()) {
+        return;
+    }
+
+    auto vbuf = resource_mgr_.GetVertexBuffer(geoms[0]->vb).lock();
+    // Writes the rows of the attribute starting at the vertex start, which
+    // have row_floats floats each in the vertex buffer.
+    using Builder = GeometryBuffersBuilder;
+    auto SetRange = [this, &vbuf, &object_name, start](
+                            uint8_t buffer_index, size_t n_rows,
+                            size_t row_floats,
+                            filament::backend::BufferDescriptor&& buffer) {
+        if (start + n_rows > vbuf->getVertexCount()) {
+            utility::LogWarning(
+                    "Range [{}, {}) is out of the {} vertices of {}", start,
+                    start + n_rows, vbuf->getVertexCount(), object_name);
+            return;
+        }
+        Builder::UploadVertexBuffer(
+                *vbuf, buffer_index, std::move(buffer),
+                uint32_t(start * row_floats * sizeof(float)));
+    };
+
+    if (update_flags & kUpdatePointsFlag && point_cloud.HasPoints()) {
+        const auto points = Builder::ToHostFloat32(point_cloud.GetPoints());
+        SetRange(0, points.GetLength(), 3,
+                 Builder::CreateTensorDescriptor(points));
+    }
+    if (update_flags & kUpdateColorsFlag && point_cloud.HasPointColors()) {
+        const auto colors =
+                Builder::ToHostFloat32(point_cloud.GetPointColors());
+        SetRange(1, colors.GetLength(), 3,
+                 Builder::CreateTensorDescriptor(colors));
+    }
+    if (update_flags & kUpdateNormalsFlag && point_cloud.HasPointNormals()) {
+        const auto normals =
+                Builder::ToHostFloat32(point_cloud.GetPointNormals());
+        const size_t n_rows = normals.GetLength();
+        SetRange(2, n_rows, 4,
+                 Builder::CreateTangentsDescriptor(normals, n_rows));
+    }
+    if (update_flags & kUpdateUv0Flag && point_cloud.HasPointAttr("uv")) {
+        const auto uv = Builder::ToHostFloat32(point_cloud.GetPointAttr("uv"));
+        SetRange(3, uv.GetLength(), 2, Builder::CreateTensorDescriptor(uv));
+    }
+}
+
+void FilamentScene::SetPointCloudDrawCount(const std::string& object_name,
+                                           size_t count) {
+    auto geoms = GetGeometry(object_name);
+    for (auto* g : geoms) {
+        auto& renderable_mgr = engine_.getRenderableManager();
+        filament::RenderableManager::Instance inst =
+                renderable_mgr.getInstance(g->filament_entity);
+        // The index buffer of a point cloud indexes the vertices in order.
+        renderable_mgr.setGeometryAt(
+                inst, 0, filament::RenderableManager::PrimitiveType::POINTS, 0,
+                count);
+        g->index_count = count;
+    }
+}
+
 void FilamentScene::RemoveGeometry(const std::string& object_name) {
+    auto lod_entry = lod_geometries_.find(object_name);
+    if (lod_entry != lod_geometries_.end()) {
+        for (const auto& node : lod_entry->second.resident_nodes) {
+            RemoveGeometry(GetLODNodeName(object_name, node.first));
+        }
+        lod_geometries_.erase(lod_entry);
+        return;
+    }
+
     auto geoms = GetGeometry(object_name, false);
     if (!geoms.empty()) {
         for (auto* g : geoms) {
+            if (g->culling) {
+                culling_dirty_ = true;
+            }
             scene_->remove(g->filament_entity);
             g->ReleaseResources(engine_, resource_mgr_);
             geometries_.erase(g->name);
@@ -590,11 +839,19 @@ void FilamentScene::RemoveGeometry(const std::string& object_name) {
 }
 
 void FilamentScene::ShowGeometry(const std::string& object_name, bool show) {
+    auto lod_entry = lod_geometries_.find(object_name);
+    if (lod_entry != lod_geometries_.end()) {
+        // Draw() shows the selected nodes again.
+        lod_entry->second.visible = show;
+        if (show) return;
+    }
     auto geoms = GetGeometry(object_name);
     for (auto* g : geoms) {
         if (g->visible != show) {
             g->visible = show;
-            if (show) {
+            if (g->culled) {
+                continue;
+            } else if (show) {
                 scene_->addEntity(g->filament_entity);
             } else {
                 scene_->remove(g->filament_entity);
@@ -604,6 +861,10 @@ void FilamentScene::ShowGeometry(const std::string& object_name, bool show) {
 }
 
 bool FilamentScene::GeometryIsVisible(const std::string& object_name) {
+    auto lod_entry = lod_geometries_.find(object_name);
+    if (lod_entry != lod_geometries_.end()) {
+        return lod_entry->second.visible;
+    }
     auto geoms = GetGeometry(object_name);
     if (!geoms.empty()) {
         // NOTE: all meshes of model share same visibility so we only need to
@@ -631,8 +892,15 @@ FilamentScene::GetGeometryTransformInstance(RenderableGeometry* geom) {
 
 void FilamentScene::SetGeometryTransform(const std::string& object_name,
                                          const Transform& transform) {
+    auto lod_entry = lod_geometries_.find(object_name);
+    if (lod_entry != lod_geometries_.end()) {
+        lod_entry->second.transform = transform;
+    }
     auto geoms = GetGeometry(object_name);
     for (auto* g : geoms) {
+        if (g->culling) {
+            culling_dirty_ = true;
+        }
         auto itransform = GetGeometryTransformInstance(g);
         if (itransform.isValid()) {
             const auto& ematrix = transform.matrix();
@@ -646,6 +914,10 @@ void FilamentScene::SetGeometryTransform(const std::string& object_name,
 
 FilamentScene::Transform FilamentScene::GetGeometryTransform(
         const std::string& object_name) {
+    auto lod_entry = lod_geometries_.find(object_name);
+    if (lod_entry != lod_geometries_.end()) {
+        return lod_entry->second.transform;
+    }
     Transform etransform;
     auto geoms = GetGeometry(object_name);
     if (!geoms.empty()) {
@@ -662,23 +934,44 @@ FilamentScene::Transform FilamentScene::GetGeometryTransform(
 geometry::AxisAlignedBoundingBox FilamentScene::GetGeometryBoundingBox(
         const std::string& object_name) {
     geometry::AxisAlignedBoundingBox result;
+    auto lod_entry = lod_geometries_.find(object_name);
+    if (lod_entry != lod_geometries_.end()) {
+        // The nodes may not be resident, so this is the cube of the root.
+        const auto& root = lod_entry->second.lod->GetNodes()[0];
+        geometry::AxisAlignedBoundingBox cube(
+                root.min_bound,
+                root.min_bound + Eigen::Vector3d::Constant(root.size));
+        const Eigen::Matrix4d transform =
+                lod_entry->second.transform.matrix().cast<double>();
+        std::vector<Eigen::Vector3d> corners = cube.GetBoxPoints();
+        for (auto& corner : corners) {
+            corner = transform.topLeftCorner<3, 3>() * corner +
+                     transform.topRightCorner<3, 1>();
+        }
+        return geometry::AxisAlignedBoundingBox::CreateFromPoints(corners);
+    }
     auto geoms = GetGeometry(object_name);
     for (auto* g : geoms) {
-        auto& renderable_mgr = engine_.getRenderableManager();
-        auto inst = renderable_mgr.getInstance(g->filament_entity);
-        auto box = renderable_mgr.getAxisAlignedBoundingBox(inst);
+        result += GetWorldBoundingBox(*g);
+    }
+    return result;
+}
 
-        auto& transform_mgr = engine_.getTransformManager();
-        auto itransform = transform_mgr.getInstance(g->filament_entity);
-        auto transform = transform_mgr.getWorldTransform(itransform);
+geometry::AxisAlignedBoundingBox FilamentScene::GetWorldBoundingBox(
+        const RenderableGeometry& geom) {
+    auto& renderable_mgr = engine_.getRenderableManager();
+    auto inst = renderable_mgr.getInstance(geom.filament_entity);
+    auto box = renderable_mgr.getAxisAlignedBoundingBox(inst);
 
-        box = rigidTransform(box, transform);
+    auto& transform_mgr = engine_.getTransformManager();
+    auto itransform = transform_mgr.getInstance(geom.filament_entity);
+    auto transform = transform_mgr.getWorldTransform(itransform);
 
-        auto min = box.center - box.halfExtent;
-        auto max = box.center + box.halfExtent;
-        result += {{min.x, min.y, min.z}, {max.x, max.y, max.z}};
-    }
-    return result;
+    box = rigidTransform(box, transform);
+
+    auto min = box.center - box.halfExtent;
+    auto max = box.center + box.halfExtent;
+    return {{min.x, min.y, min.z}, {max.x, max.y, max.z}};
 }
 
 void FilamentScene::GeometryShadows(const std::string& object_name,
@@ -691,6 +984,11 @@ void FilamentScene::GeometryShadows(const std::string& object_name,
                 renderable_mgr.getInstance(g->filament_entity);
         renderable_mgr.setCastShadows(inst, cast_shadows);
         renderable_mgr.setReceiveShadows(inst, receive_shadows);
+        if (g->culling && g->cast_shadows != cast_shadows) {
+            culling_dirty_ = true;
+        }
+        g->cast_shadows = cast_shadows;
+        g->receive_shadow = receive_shadows;
     }
 }
 
@@ -702,6 +1000,11 @@ void FilamentScene::SetGeometryCulling(const std::string& object_name,
         filament::RenderableManager::Instance inst =
                 renderable_mgr.getInstance(g->filament_entity);
         renderable_mgr.setCulling(inst, enable);
+        if (g->culling != enable) {
+            g->culling = enable;
+            SetGeometryCulled(*g, false);
+            culling_dirty_ = true;
+        }
     }
 }
 
@@ -1001,7 +1304,7 @@ void FilamentScene::UpdateMaterialProperties(RenderableGeometry& geom) {
         UpdateDefaultUnlit(geom.mat);
     } else if (props.shader == "normals") {
         UpdateNormalShader(geom.mat);
-    } else if (props.shader == "depth") {
+    } else if (props.shader == "depth" || props.shader == "depthValue") {
         UpdateDepthShader(geom.mat);
     } else if (props.shader == "unlitGradient") {
         UpdateGradientShader(geom.mat);
@@ -1073,6 +1376,10 @@ void FilamentScene::OverrideMaterialInternal(RenderableGeometry* geom,
 
 void FilamentScene::OverrideMaterial(const std::string& object_name,
                                      const Material& material) {
+    auto lod_entry = lod_geometries_.find(object_name);
+    if (lod_entry != lod_geometries_.end()) {
+        lod_entry->second.material = material;
+    }
     auto geoms = GetGeometry(object_name);
     for (auto* g : geoms) {
         OverrideMaterialInternal(g, material);
@@ -1080,13 +1387,25 @@ void FilamentScene::OverrideMaterial(const std::string& object_name,
 }
 
 void FilamentScene::QueryGeometry(std::vector<std::string>& geometry) {
+    std::unordered_set<std::string> lod_nodes;
+    for (const auto& lod_entry : lod_geometries_) {
+        geometry.push_back(lod_entry.first);
+        for (const auto& node : lod_entry.second.resident_nodes) {
+            lod_nodes.insert(GetLODNodeName(lod_entry.first, node.first));
+        }
+    }
     for (const auto& ge : geometries_) {
-        geometry.push_back(ge.first);
+        if (lod_nodes.count(ge.first) == 0) {
+            geometry.push_back(ge.first);
+        }
     }
 }
 
 void FilamentScene::OverrideMaterialAll(const Material& material,
                                         bool shader_only) {
+    for (auto& lod_entry : lod_geometries_) {
+        lod_entry.second.material = material;
+    }
     for (auto& ge : geometries_) {
         OverrideMaterialInternal(&ge.second, material, shader_only);
     }
@@ -1553,6 +1872,52 @@ void FilamentScene::RenderToImage(
     renderer_.RenderToImage(view, this, callback);
 }
 
+void FilamentScene::BeginDepthValueRendering(float near, float far) {
+    if (!depth_value_materials_.empty()) {
+        EndDepthValueRendering();
+    }
+    // Hiding the skybox shows the background, so it is hidden first.
+    depth_value_skybox_visible_ = skybox_enabled_;
+    if (depth_value_skybox_visible_) {
+        ShowSkybox(false);
+    }
+    depth_value_background_visible_ =
+            HasGeometry(kBackgroundName) && GeometryIsVisible(kBackgroundName);
+    if (depth_value_background_visible_) {
+        ShowGeometry(kBackgroundName, false);
+    }
+    for (auto& ge : geometries_) {
+        if (ge.first == kBackgroundName) {
+            continue;
+        }
+        depth_value_materials_[ge.first] = ge.second.mat.properties;
+        // The point size is kept, and only the shader is replaced.
+        Material material = ge.second.mat.properties;
+        material.shader = "depthValue";
+        OverrideMaterialInternal(&ge.second, material, true);
+        renderer_.ModifyMaterial(ge.second.mat.mat_instance)
+                .SetParameter("cameraNear", near)
+                .SetParameter("cameraFar", far)
+                .Finish();
+    }
+}
+
+void FilamentScene::EndDepthValueRendering() {
+    for (const auto& entry : depth_value_materials_) {
+        auto ge = geometries_.find(entry.first);
+        if (ge != geometries_.end()) {
+            OverrideMaterialInternal(&ge->second, entry.second, true);
+        }
+    }
+    depth_value_materials_.clear();
+    if (depth_value_background_visible_) {
+        ShowGeometry(kBackgroundName, true);
+    }
+    if (depth_value_skybox_visible_) {
+        ShowSkybox(true);
+    }
+}
+
 std::vector<FilamentScene::RenderableGeometry*> FilamentScene::GetGeometry(
         const std::string& object_name, bool warn_if_not_found) {
     std::vector<RenderableGeometry*> geoms;
@@ -1568,6 +1933,15 @@ std::vector<FilamentScene::RenderableGeometry*> FilamentScene::GetGeometry(
                 geoms.push_back(&geom_entry->second);
             }
         }
+    } else if (lod_geometries_.count(object_name)) {
+        const auto& lod_geom = lod_geometries_[object_name];
+        for (const auto& node : lod_geom.resident_nodes) {
+            auto geom_entry =
+                    geometries_.find(GetLODNodeName(object_name, node.first));
+            if (geom_entry != geometries_.end()) {
+                geoms.push_back(&geom_entry->second);
+            }
+        }
     } else {
         auto geom_entry = geometries_.find(object_name);
         if (geom_entry == geometries_.end()) {
@@ -1625,7 +1999,130 @@ void FilamentScene::RenderableGeometry::ReleaseResources(
     filament_entity.clear();
 }
 
-void FilamentScene::Draw(filament::Renderer& renderer) {
+void FilamentScene::SetSceneCulling(bool enable) {
+    if (scene_culling_ == enable) {
+        return;
+    }
+    scene_culling_ = enable;
+    if (!enable) {
+        for (const auto& name : culling_names_) {
+            auto geom = geometries_.find(name);
+            if (geom != geometries_.end()) {
+                SetGeometryCulled(geom->second, false);
+            }
+        }
+        culling_names_.clear();
+        culling_unculled_.clear();
+        culling_bvh_ = BoundingVolumeHierarchy();
+    }
+    culling_dirty_ = true;
+}
+
+void FilamentScene::SetGeometryCulled(RenderableGeometry& geom, bool culled) {
+    if (geom.culled == culled) {
+        return;
+    }
+    geom.culled = culled;
+    if (geom.visible) {
+        if (culled) {
+            scene_->remove(geom.filament_entity);
+        } else {
+            scene_->addEntity(geom.filament_entity);
+        }
+    }
+}
+
+void FilamentScene::RebuildSceneCulling(bool shadows) {
+    // Below this, Filament's culling of each renderable costs less than
+    // keeping the hierarchy.
+    static const size_t kMinGeometriesForSceneCulling = 128;
+
+    // Shadow casters outside of the frustums may still cast shadows into
+    // them, so they are culled only if nothing draws shadows.
+    culling_names_.clear();
+    std::vector<geometry::AxisAlignedBoundingBox> boxes;
+    for (auto& entry : geometries_) {
+        auto& geom = entry.second;
+        if (!geom.culling || (shadows && geom.cast_shadows)) {
+            SetGeometryCulled(geom, false);
+            continue;
+        }
+        culling_names_.push_back(entry.first);
+        boxes.push_back(GetWorldBoundingBox(geom));
+    }
+    if (culling_names_.size() < kMinGeometriesForSceneCulling) {
+        for (const auto& name : culling_names_) {
+            SetGeometryCulled(geometries_[name], false);
+        }
+        culling_names_.clear();
+        boxes.clear();
+    }
+
+    culling_bvh_ = BoundingVolumeHierarchy(boxes);
+    // The culled state of every item is updated by the next frame.
+    culling_unculled_.resize(culling_names_.size());
+    std::iota(culling_unculled_.begin(), culling_unculled_.end(), 0);
+    culling_shadows_ = shadows;
+    culling_dirty_ = false;
+}
+
+void FilamentScene::UpdateSceneCulling(
+        const std::vector<ViewContainer*>& views) {
+    bool shadows = false;
+    auto& light_mgr = engine_.getLightManager();
+    auto is_shadow_caster = [&light_mgr](const LightEntity& light) {
+        return light.enabled &&
+               light_mgr.isShadowCaster(
+                       light_mgr.getInstance(light.filament_entity));
+    };
+    for (auto* container : views) {
+        if (container->view->GetNativeView()->isShadowingEnabled()) {
+            shadows = is_shadow_caster(sun_);
+            for (const auto& light : lights_) {
+                shadows = shadows || is_shadow_caster(light.second);
+            }
+            break;
+        }
+    }
+    if (culling_dirty_ || shadows != culling_shadows_) {
+        RebuildSceneCulling(shadows);
+    }
+    if (culling_names_.empty()) {
+        return;
+    }
+
+    std::vector<size_t> unculled;
+    for (auto* container : views) {
+        const Camera* camera = container->view->GetCamera();
+        const Eigen::Matrix4f view_projection =
+                camera->GetProjectionMatrix().matrix() *
+                camera->GetViewMatrix().matrix();
+        auto selected = culling_bvh_.SelectInFrustum(view_projection);
+        unculled.insert(unculled.end(), selected.begin(), selected.end());
+    }
+    if (views.size() > 1) {
+        std::sort(unculled.begin(), unculled.end());
+        unculled.erase(std::unique(unculled.begin(), unculled.end()),
+                       unculled.end());
+    }
+
+    // Only the geometries that were or are in the frustums are visited.
+    std::vector<char> in_frustum(culling_names_.size(), 0);
+    for (size_t item : unculled) {
+        in_frustum[item] = 1;
+        SetGeometryCulled(geometries_[culling_names_[item]], false);
+    }
+    for (size_t item : culling_unculled_) {
+        if (!in_frustum[item]) {
+            SetGeometryCulled(geometries_[culling_names_[item]], true);
+        }
+    }
+    culling_unculled_ = std::move(unculled);
+}
+
+void FilamentScene::Draw(filament::Renderer& renderer,
+                         FrameStatistics* stats /*= nullptr*/) {
+    std::vector<ViewContainer*> views;
     for (auto& pair : views_) {
         auto& container = pair.second;
         // Skip inactive views
@@ -1634,10 +2131,52 @@ void FilamentScene::Draw(filament::Renderer& renderer) {
             container.is_active = false;
             continue;
         }
+        views.push_back(&container);
+    }
+    if (views.empty()) {
+        return;
+    }
+
+    const double update_start = utility::Timer::GetSystemTimeInMilliseconds();
+    // The nodes of the level of detail point clouds are selected for the
+    // first view.
+    if (!lod_geometries_.empty()) {
+        UpdateLODGeometries(*views[0]->view);
+    }
+    if (scene_culling_) {
+        UpdateSceneCulling(views);
+    }
+
+    if (stats) {
+        stats->scene_update_ms +=
+                utility::Timer::GetSystemTimeInMilliseconds() - update_start;
+        // The geometries in the Filament scene are drawn by every view.
+        for (const auto& pair : geometries_) {
+            const auto& geom = pair.second;
+            if (!geom.visible || geom.culled) {
+                continue;
+            }
+            stats->draw_calls += views.size();
+            const size_t n = geom.index_count * views.size();
+            using PrimitiveType = filament::RenderableManager::PrimitiveType;
+            switch (geom.primitive_type) {
+                case PrimitiveType::POINTS:
+                    stats->points += n;
+                    break;
+                case PrimitiveType::LINES:
+                    stats->lines += n / 2;
+                    break;
+                default:
+                    stats->triangles += n / 3;
+                    break;
+            }
+        }
+    }
 
-        container.view->PreRender();
-        renderer.render(container.view->GetNativeView());
-        container.view->PostRender();
+    for (auto* container : views) {
+        container->view->PreRender();
+        renderer.render(container->view->GetNativeView());
+        container->view->PostRender();
     }
 }
 
@@ -48,11 +48,14 @@
 #endif  // _MSC_VER
 
 #include <Eigen/Geometry>
+#include <memory>
 #include <unordered_map>
 #include <vector>
 
 #include "open3d/geometry/BoundingVolume.h"
+#include "open3d/visualization/rendering/BoundingVolumeHierarchy.h"
 #include "open3d/visualization/rendering/Camera.h"
+#include "open3d/visualization/rendering/FrameStatistics.h"
 #include "open3d/visualization/rendering/Material.h"
 #include "open3d/visualization/rendering/RendererHandle.h"
 #include "open3d/visualization/rendering/Scene.h"
@@ -121,10 +124,27 @@ public:
                      size_t downsample_threshold = SIZE_MAX) override;
     bool AddGeometry(const std::string& object_name,
                      const TriangleMeshModel& model) override;
+    bool AddGeometry(const std::string& object_name,
+                     const t::geometry::TriangleMesh& mesh,
+                     const Material& material) override;
+    bool AddGeometry(const std::string& object_name,
+                     std::shared_ptr<PointCloudLOD> lod,
+                     const Material& material,
+                     size_t point_budget = 10000000,
+                     size_t memory_budget = size_t(1) << 30) override;
     bool HasGeometry(const std::string& object_name) const override;
     void UpdateGeometry(const std::string& object_name,
                         const t::geometry::PointCloud& point_cloud,
                         uint32_t update_flags) override;
+    void UpdateGeometry(const std::string& object_name,
+                        const t::geometry::TriangleMesh& mesh,
+                        uint32_t update_flags) override;
+    void UpdateGeometryRange(const std::string& object_name,
+                             const t::geometry::PointCloud& point_cloud,
+                             size_t start,
+                             uint32_t update_flags) override;
+    void SetPointCloudDrawCount(const std::string& object_name,
+                                size_t count) override;
     void RemoveGeometry(const std::string& object_name) override;
     void ShowGeometry(const std::string& object_name, bool show) override;
     bool GeometryIsVisible(const std::string& object_name) override;
@@ -214,7 +234,24 @@ public:
     void RenderToImage(std::function<void(std::shared_ptr<geometry::Image>)>
                                callback) override;
 
-    void Draw(filament::Renderer& renderer);
+    // Enables or disables the removal from the Filament scene of the
+    // geometries that are outside of the frustums of all the active views,
+    // which Draw() updates. It is enabled by default. Disable it while
+    // rendering from other cameras than those of the views, which would miss
+    // the removed geometries.
+    void SetSceneCulling(bool enable);
+    bool IsSceneCullingEnabled() const { return scene_culling_; }
+
+    // Draws the depths in [near, far] of all geometries, packed into the
+    // colors by the depthValue shader, until EndDepthValueRendering()
+    // restores their materials. The background and skybox are hidden
+    // meanwhile.
+    void BeginDepthValueRendering(float near, float far);
+    void EndDepthValueRendering();
+
+    // Renders the active views. If \p stats is not null, the time spent
+    // updating the scene and the renderables drawn are added to it.
+    void Draw(filament::Renderer& renderer, FrameStatistics* stats = nullptr);
     // NOTE: Can GetNativeScene be removed?
     filament::Scene* GetNativeScene() const { return scene_; }
 
@@ -273,6 +310,18 @@ private:
         utils::Entity filament_entity;
         VertexBufferHandle vb;
         IndexBufferHandle ib;
+
+        // Whether the geometry may be culled by the scene, and whether it is
+        // culled. The entity is in the Filament scene only if it is visible
+        // and not culled.
+        bool culling = true;
+        bool culled = false;
+
+        // Primitives drawn by the entity, for the frame statistics.
+        filament::RenderableManager::PrimitiveType primitive_type =
+                filament::RenderableManager::PrimitiveType::TRIANGLES;
+        size_t index_count = 0;
+
         void ReleaseResources(filament::Engine& engine,
                               FilamentResourceManager& manager);
     };
@@ -317,6 +366,46 @@ private:
     std::unordered_map<std::string, LightEntity> lights_;
     std::unordered_map<std::string, std::vector<std::string>> model_geometries_;
 
+    // Level of detail point clouds, whose nodes are added to geometries_ as
+    // they are streamed in by UpdateLODGeometries().
+    struct LODGeometry {
+        std::shared_ptr<PointCloudLOD> lod;
+        Material material;
+        size_t point_budget = 0;
+        size_t memory_budget = 0;
+        bool visible = true;
+        Transform transform = Transform::Identity();
+        // Frame in which each node with buffers was last selected.
+        std::unordered_map<size_t, uint64_t> resident_nodes;
+        size_t resident_bytes = 0;
+        uint64_t frame = 0;
+    };
+    std::unordered_map<std::string, LODGeometry> lod_geometries_;
+    static std::string GetLODNodeName(const std::string& object_name,
+                                      size_t node_idx);
+    void UpdateLODGeometries(const View& view);
+
+    // Scene culling. The items of culling_bvh_ are the geometries named by
+    // culling_names_, and culling_unculled_ are the items that are in the
+    // Filament scene, so that a frame only updates the geometries entering
+    // or leaving the view frustums.
+    void UpdateSceneCulling(const std::vector<ViewContainer*>& views);
+    void RebuildSceneCulling(bool shadows);
+    void SetGeometryCulled(RenderableGeometry& geom, bool culled);
+    geometry::AxisAlignedBoundingBox GetWorldBoundingBox(
+            const RenderableGeometry& geom);
+    bool scene_culling_ = true;
+    bool culling_dirty_ = true;
+    bool culling_shadows_ = false;
+    BoundingVolumeHierarchy culling_bvh_;
+    std::vector<std::string> culling_names_;
+    std::vector<size_t> culling_unculled_;
+
+    // The materials that EndDepthValueRendering() restores.
+    std::unordered_map<std::string, Material> depth_value_materials_;
+    bool depth_value_background_visible_ = false;
+    bool depth_value_skybox_visible_ = false;
+
     Eigen::Vector4f background_color_;
     std::shared_ptr<geometry::Image> background_image_;
     std::string ibl_name_;
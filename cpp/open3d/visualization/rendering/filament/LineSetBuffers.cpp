@@ -221,7 +221,7 @@ LineSetBuffersBuilder::Buffers LineSetBuffersBuilder::ConstructThinLines() {
     VertexBuffer::BufferDescriptor vb_descriptor(
             vertices, vertices_count * sizeof(ColoredVertex));
     vb_descriptor.setCallback(GeometryBuffersBuilder::DeallocateBuffer);
-    vbuf->setBufferAt(engine, 0, std::move(vb_descriptor));
+    UploadVertexBuffer(*vbuf, 0, std::move(vb_descriptor));
 
     const size_t indices_count = lines_count * 2;
     auto ib_handle =
@@ -237,7 +237,7 @@ LineSetBuffersBuilder::Buffers LineSetBuffersBuilder::ConstructThinLines() {
     // with DeallocateBuffer
     IndexBuffer::BufferDescriptor ib_descriptor(indices, indices_bytes_count);
     ib_descriptor.setCallback(GeometryBuffersBuilder::DeallocateBuffer);
-    ibuf->setBuffer(engine, std::move(ib_descriptor));
+    UploadIndexBuffer(*ibuf, std::move(ib_descriptor));
 
     return std::make_tuple(vb_handle, ib_handle, IndexBufferHandle());
 }
@@ -343,7 +343,7 @@ LineSetBuffersBuilder::Buffers LineSetBuffersBuilder::ConstructBuffers() {
     VertexBuffer::BufferDescriptor vb_descriptor(
             vertices, vertices_count * sizeof(ColoredVertex));
     vb_descriptor.setCallback(GeometryBuffersBuilder::DeallocateBuffer);
-    vbuf->setBufferAt(engine, 0, std::move(vb_descriptor));
+    UploadVertexBuffer(*vbuf, 0, std::move(vb_descriptor));
 
     // const size_t indices_count = lines_count * 6;
     const size_t indices_count = index_idx;
@@ -360,7 +360,7 @@ LineSetBuffersBuilder::Buffers LineSetBuffersBuilder::ConstructBuffers() {
     // with DeallocateBuffer
     IndexBuffer::BufferDescriptor ib_descriptor(indices, indices_bytes_count);
     ib_descriptor.setCallback(GeometryBuffersBuilder::DeallocateBuffer);
-    ibuf->setBuffer(engine, std::move(ib_descriptor));
+    UploadIndexBuffer(*ibuf, std::move(ib_descriptor));
 
     return std::make_tuple(vb_handle, ib_handle, IndexBufferHandle());
 }
@@ -104,7 +104,6 @@ struct ColoredVertex {
 IndexBufferHandle GeometryBuffersBuilder::CreateIndexBuffer(
         size_t max_index, size_t n_subsamples /*= SIZE_MAX*/) {
     using IndexType = GeometryBuffersBuilder::IndexType;
-    auto& engine = EngineInstance::GetInstance();
     auto& resource_mgr = EngineInstance::GetResourceManager();
 
     size_t n_indices = std::min(max_index, n_subsamples);
@@ -159,7 +158,7 @@ IndexBufferHandle GeometryBuffersBuilder::CreateIndexBuffer(
     // with DeallocateBuffer
     IndexBuffer::BufferDescriptor indices_descriptor(uint_indices, n_bytes);
     indices_descriptor.setCallback(GeometryBuffersBuilder::DeallocateBuffer);
-    ibuf->setBuffer(engine, std::move(indices_descriptor));
+    UploadIndexBuffer(*ibuf, std::move(indices_descriptor));
     return ib_handle;
 }
 
@@ -264,7 +263,7 @@ GeometryBuffersBuilder::Buffers PointCloudBuffersBuilder::ConstructBuffers() {
     // with DeallocateBuffer
     VertexBuffer::BufferDescriptor vb_descriptor(vertices, vertices_byte_count);
     vb_descriptor.setCallback(GeometryBuffersBuilder::DeallocateBuffer);
-    vbuf->setBufferAt(engine, 0, std::move(vb_descriptor));
+    UploadVertexBuffer(*vbuf, 0, std::move(vb_descriptor));
 
     auto ib_handle = CreateIndexBuffer(n_vertices);
 
@@ -306,11 +305,10 @@ GeometryBuffersBuilder::Buffers TPointCloudBuffersBuilder::ConstructBuffers() {
     auto& engine = EngineInstance::GetInstance();
     auto& resource_mgr = EngineInstance::GetResourceManager();
 
-    // NOTE: ConstructBuffers assumes caller has checked that DTYPE of the
-    // tensor is float32. It is an error to call this with a tensor of any other
-    // dtype
-
-    const auto& points = geometry_.GetPoints();
+    // The attributes are uploaded straight from the tensors when they are
+    // Float32 in CPU memory, and converted or staged through CPU memory
+    // otherwise.
+    const auto points = ToHostFloat32(geometry_.GetPoints());
     const size_t n_vertices = points.GetLength();
 
     // We use CUSTOM0 for tangents along with TANGENTS attribute
@@ -341,16 +339,14 @@ GeometryBuffersBuilder::Buffers TPointCloudBuffersBuilder::ConstructBuffers() {
         return {};
     }
 
-    VertexBuffer::BufferDescriptor pts_descriptor(
-            points.GetDataPtr(), n_vertices * 3 * sizeof(float));
-    vbuf->setBufferAt(engine, 0, std::move(pts_descriptor));
+    UploadVertexBuffer(*vbuf, 0, CreateTensorDescriptor(points));
 
-    const size_t color_array_size = n_vertices * 3 * sizeof(float);
     if (geometry_.HasPointColors()) {
-        VertexBuffer::BufferDescriptor color_descriptor(
-                geometry_.GetPointColors().GetDataPtr(), color_array_size);
-        vbuf->setBufferAt(engine, 1, std::move(color_descriptor));
+        UploadVertexBuffer(*vbuf, 1,
+                           CreateTensorDescriptor(
+                                   ToHostFloat32(geometry_.GetPointColors())));
     } else {
+        const size_t color_array_size = n_vertices * 3 * sizeof(float);
         float* color_array = static_cast<float*>(malloc(color_array_size));
         for (size_t i = 0; i < n_vertices * 3; ++i) {
             color_array[i] = 1.f;
@@ -358,63 +354,37 @@ GeometryBuffersBuilder::Buffers TPointCloudBuffersBuilder::ConstructBuffers() {
         VertexBuffer::BufferDescriptor color_descriptor(
                 color_array, color_array_size,
                 GeometryBuffersBuilder::DeallocateBuffer);
-        vbuf->setBufferAt(engine, 1, std::move(color_descriptor));
+        UploadVertexBuffer(*vbuf, 1, std::move(color_descriptor));
     }
 
-    const size_t normal_array_size = n_vertices * 4 * sizeof(float);
-    if (geometry_.HasPointNormals()) {
-        const auto& normals = geometry_.GetPointNormals();
-
-        // Converting normals to Filament type - quaternions
-        auto float4v_tangents =
-                static_cast<math::quatf*>(malloc(normal_array_size));
-        auto orientation =
-                filament::geometry::SurfaceOrientation::Builder()
-                        .vertexCount(n_vertices)
-                        .normals(reinterpret_cast<const math::float3*>(
-                                normals.GetDataPtr()))
-                        .build();
-        orientation->getQuats(float4v_tangents, n_vertices);
-        VertexBuffer::BufferDescriptor normals_descriptor(
-                float4v_tangents, normal_array_size,
-                GeometryBuffersBuilder::DeallocateBuffer);
-        vbuf->setBufferAt(engine, 2, std::move(normals_descriptor));
-    } else {
-        float* normal_array = static_cast<float*>(malloc(normal_array_size));
-        float* normal_ptr = normal_array;
-        for (size_t i = 0; i < n_vertices; ++i) {
-            *normal_ptr++ = 0.f;
-            *normal_ptr++ = 0.f;
-            *normal_ptr++ = 0.f;
-            *normal_ptr++ = 1.f;
-        }
-        VertexBuffer::BufferDescriptor normals_descriptor(
-                normal_array, normal_array_size,
-                GeometryBuffersBuilder::DeallocateBuffer);
-        vbuf->setBufferAt(engine, 2, std::move(normals_descriptor));
-    }
+    const auto normals = geometry_.HasPointNormals()
+                                 ? ToHostFloat32(geometry_.GetPointNormals())
+                                 : core::Tensor();
+    UploadVertexBuffer(*vbuf, 2, CreateTangentsDescriptor(normals, n_vertices));
 
-    const size_t uv_array_size = n_vertices * 2 * sizeof(float);
-    float* uv_array = static_cast<float*>(malloc(uv_array_size));
     if (geometry_.HasPointAttr("uv")) {
-        const float* uv_src = static_cast<const float*>(
-                geometry_.GetPointAttr("uv").GetDataPtr());
-        memcpy(uv_array, uv_src, uv_array_size);
-    } else if (geometry_.HasPointAttr("__visualization_scalar")) {
+        UploadVertexBuffer(*vbuf, 3,
+                           CreateTensorDescriptor(ToHostFloat32(
+                                   geometry_.GetPointAttr("uv"))));
+    } else {
         // Update in FilamentScene::UpdateGeometry(), too.
+        const size_t uv_array_size = n_vertices * 2 * sizeof(float);
+        float* uv_array = static_cast<float*>(malloc(uv_array_size));
         memset(uv_array, 0, uv_array_size);
-        const float* src = static_cast<const float*>(
-                geometry_.GetPointAttr("__visualization_scalar").GetDataPtr());
-        const size_t n = 2 * n_vertices;
-        for (size_t i = 0; i < n; i += 2) {
-            uv_array[i] = *src++;
+        if (geometry_.HasPointAttr("__visualization_scalar")) {
+            const auto scalars = ToHostFloat32(
+                    geometry_.GetPointAttr("__visualization_scalar"));
+            const float* src = static_cast<const float*>(scalars.GetDataPtr());
+            const size_t n = 2 * n_vertices;
+            for (size_t i = 0; i < n; i += 2) {
+                uv_array[i] = *src++;
+            }
         }
-    } else {
-        memset(uv_array, 0, uv_array_size);
+        VertexBuffer::BufferDescriptor uv_descriptor(
+                uv_array, uv_array_size,
+                GeometryBuffersBuilder::DeallocateBuffer);
+        UploadVertexBuffer(*vbuf, 3, std::move(uv_descriptor));
     }
-    VertexBuffer::BufferDescriptor uv_descriptor(
-            uv_array, uv_array_size, GeometryBuffersBuilder::DeallocateBuffer);
-    vbuf->setBufferAt(engine, 3, std::move(uv_descriptor));
 
     auto ib_handle = CreateIndexBuffer(n_vertices);
 
@@ -428,8 +398,8 @@ GeometryBuffersBuilder::Buffers TPointCloudBuffersBuilder::ConstructBuffers() {
 }
 
 filament::Box TPointCloudBuffersBuilder::ComputeAABB() {
-    auto min_bounds = geometry_.GetMinBound();
-    auto max_bounds = geometry_.GetMaxBound();
+    auto min_bounds = ToHostFloat32(geometry_.GetMinBound());
+    auto max_bounds = ToHostFloat32(geometry_.GetMaxBound());
     auto* min_bounds_float = static_cast<float*>(min_bounds.GetDataPtr());
     auto* max_bounds_float = static_cast<float*>(max_bounds.GetDataPtr());
 
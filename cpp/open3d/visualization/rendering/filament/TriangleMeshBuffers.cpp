@@ -52,6 +52,7 @@
 
 #include "open3d/geometry/BoundingVolume.h"
 #include "open3d/geometry/TriangleMesh.h"
+#include "open3d/t/geometry/TriangleMesh.h"
 #include "open3d/visualization/rendering/filament/FilamentEngine.h"
 #include "open3d/visualization/rendering/filament/FilamentGeometryBuffersBuilder.h"
 #include "open3d/visualization/rendering/filament/FilamentResourceManager.h"
@@ -451,7 +452,7 @@ GeometryBuffersBuilder::Buffers TriangleMeshBuffersBuilder::ConstructBuffers() {
     VertexBuffer::BufferDescriptor vb_descriptor(vertex_data.bytes,
                                                  vertex_data.bytes_to_copy);
     vb_descriptor.setCallback(GeometryBuffersBuilder::DeallocateBuffer);
-    vbuf->setBufferAt(engine, 0, std::move(vb_descriptor));
+    UploadVertexBuffer(*vbuf, 0, std::move(vb_descriptor));
 
     auto ib_handle = resource_mgr.CreateIndexBuffer(
             index_data.byte_count / index_data.stride, index_data.stride);
@@ -462,7 +463,7 @@ GeometryBuffersBuilder::Buffers TriangleMeshBuffersBuilder::ConstructBuffers() {
     IndexBuffer::BufferDescriptor ib_descriptor(index_data.bytes,
                                                 index_data.byte_count);
     ib_descriptor.setCallback(GeometryBuffersBuilder::DeallocateBuffer);
-    ibuf->setBuffer(engine, std::move(ib_descriptor));
+    UploadIndexBuffer(*ibuf, std::move(ib_descriptor));
 
     return std::make_tuple(vb_handle, ib_handle, IndexBufferHandle());
 }
@@ -483,6 +484,120 @@ filament::Box TriangleMeshBuffersBuilder::ComputeAABB() {
     return aabb;
 }
 
+TTriangleMeshBuffersBuilder::TTriangleMeshBuffersBuilder(
+        const t::geometry::TriangleMesh& geometry)
+    : geometry_(geometry) {}
+
+RenderableManager::PrimitiveType TTriangleMeshBuffersBuilder::GetPrimitiveType()
+        const {
+    return RenderableManager::PrimitiveType::TRIANGLES;
+}
+
+GeometryBuffersBuilder::Buffers
+TTriangleMeshBuffersBuilder::ConstructBuffers() {
+    auto& engine = EngineInstance::GetInstance();
+    auto& resource_mgr = EngineInstance::GetResourceManager();
+
+    // Each attribute has its own buffer, so that they are uploaded straight
+    // from the tensors, without interleaving them as TriangleMeshBuffersBuilder
+    // does, and FilamentScene::UpdateGeometry() can replace them one by one.
+    const auto vertices = ToHostFloat32(geometry_.GetVertices());
+    const size_t n_vertices = vertices.GetLength();
+
+    // See TPointCloudBuffersBuilder for why CUSTOM0 repeats the tangents.
+    VertexBuffer* vbuf = VertexBuffer::Builder()
+                                 .bufferCount(4)
+                                 .vertexCount(uint32_t(n_vertices))
+                                 .attribute(VertexAttribute::POSITION, 0,
+                                            VertexBuffer::AttributeType::FLOAT3)
+                                 .normalized(VertexAttribute::COLOR)
+                                 .attribute(VertexAttribute::COLOR, 1,
+                                            VertexBuffer::AttributeType::FLOAT3)
+                                 .normalized(VertexAttribute::TANGENTS)
+                                 .attribute(VertexAttribute::TANGENTS, 2,
+                                            VertexBuffer::AttributeType::FLOAT4)
+                                 .attribute(VertexAttribute::CUSTOM0, 2,
+                                            VertexBuffer::AttributeType::FLOAT4)
+                                 .attribute(VertexAttribute::UV0, 3,
+                                            VertexBuffer::AttributeType::FLOAT2)
+                                 .build(engine);
+
+    VertexBufferHandle vb_handle;
+    if (vbuf) {
+        vb_handle = resource_mgr.AddVertexBuffer(vbuf);
+    } else {
+        return {};
+    }
+
+    UploadVertexBuffer(*vbuf, 0, CreateTensorDescriptor(vertices));
+
+    // NOTE: Both default lit and unlit material shaders require per-vertex
+    // colors, so meshes without colors are white.
+    if (geometry_.HasVertexColors()) {
+        UploadVertexBuffer(*vbuf, 1,
+                           CreateTensorDescriptor(
+                                   ToHostFloat32(geometry_.GetVertexColors())));
+    } else {
+        const size_t color_array_size = n_vertices * 3 * sizeof(float);
+        float* color_array = static_cast<float*>(malloc(color_array_size));
+        for (size_t i = 0; i < n_vertices * 3; ++i) {
+            color_array[i] = 1.f;
+        }
+        VertexBuffer::BufferDescriptor color_descriptor(
+                color_array, color_array_size,
+                GeometryBuffersBuilder::DeallocateBuffer);
+        UploadVertexBuffer(*vbuf, 1, std::move(color_descriptor));
+    }
+
+    const auto normals = geometry_.HasVertexNormals()
+                                 ? ToHostFloat32(geometry_.GetVertexNormals())
+                                 : core::Tensor();
+    UploadVertexBuffer(*vbuf, 2, CreateTangentsDescriptor(normals, n_vertices));
+
+    if (geometry_.HasVertexAttr("uv")) {
+        UploadVertexBuffer(*vbuf, 3,
+                           CreateTensorDescriptor(ToHostFloat32(
+                                   geometry_.GetVertexAttr("uv"))));
+    } else {
+        const size_t uv_array_size = n_vertices * 2 * sizeof(float);
+        float* uv_array = static_cast<float*>(malloc(uv_array_size));
+        memset(uv_array, 0, uv_array_size);
+        VertexBuffer::BufferDescriptor uv_descriptor(
+                uv_array, uv_array_size,
+                GeometryBuffersBuilder::DeallocateBuffer);
+        UploadVertexBuffer(*vbuf, 3, std::move(uv_descriptor));
+    }
+
+    // Filament takes 32 bit indices. Int32 has the same bits as the unsigned
+    // indices for any mesh that fits in a vertex buffer.
+    const auto& triangles = geometry_.GetTriangles();
+    const auto indices =
+            triangles.Copy(core::Device("CPU:0")).To(core::Dtype::Int32);
+    auto ib_handle = resource_mgr.CreateIndexBuffer(indices.NumElements(),
+                                                    sizeof(IndexType));
+    auto ibuf = resource_mgr.GetIndexBuffer(ib_handle).lock();
+    UploadIndexBuffer(*ibuf, CreateTensorDescriptor(indices));
+
+    return std::make_tuple(vb_handle, ib_handle, IndexBufferHandle());
+}
+
+filament::Box TTriangleMeshBuffersBuilder::ComputeAABB() {
+    auto min_bounds = ToHostFloat32(geometry_.GetMinBound());
+    auto max_bounds = ToHostFloat32(geometry_.GetMaxBound());
+    auto* min_bounds_float = static_cast<float*>(min_bounds.GetDataPtr());
+    auto* max_bounds_float = static_cast<float*>(max_bounds.GetDataPtr());
+
+    const filament::math::float3 min(min_bounds_float[0], min_bounds_float[1],
+                                     min_bounds_float[2]);
+    const filament::math::float3 max(max_bounds_float[0], max_bounds_float[1],
+                                     max_bounds_float[2]);
+
+    Box aabb;
+    aabb.set(min, max);
+
+    return aabb;
+}
+
 }  // namespace rendering
 }  // namespace visualization
 }  // namespace open3d
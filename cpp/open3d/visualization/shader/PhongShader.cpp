@@ -29,7 +29,6 @@
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/visualization/shader/Shader.h"
-#include "open3d/visualization/utility/ColorMap.h"
 
 namespace open3d {
 namespace visualization {
@@ -57,24 +56,30 @@ bool PhongShader::Compile() {
     light_specular_shininess_ =
             glGetUniformLocation(program_, "light_specular_shininess_4");
     light_ambient_ = glGetUniformLocation(program_, "light_ambient");
+    color_map_axis_ = glGetUniformLocation(program_, "color_map_axis");
+    color_map_range_ = glGetUniformLocation(program_, "color_map_range");
+    color_map_ = glGetUniformLocation(program_, "color_map");
     return true;
 }
 
 void PhongShader::Release() {
     UnbindGeometry();
+    glDeleteBuffers(1, &vertex_position_buffer_);
+    glDeleteBuffers(1, &vertex_normal_buffer_);
+    glDeleteBuffers(1, &vertex_color_buffer_);
+    vertex_position_buffer_ = 0;
+    vertex_normal_buffer_ = 0;
+    vertex_color_buffer_ = 0;
+    ReleaseColorMapTexture();
     ReleaseProgram();
 }
 
 bool PhongShader::BindGeometry(const geometry::Geometry &geometry,
                                const RenderOption &option,
                                const ViewControl &view) {
-    // If there is already geometry, we first unbind it.
-    // We use GL_STATIC_DRAW. When geometry changes, we clear buffers and
-    // rebind the geometry. Note that this approach is slow. If the geometry is
-    // changing per frame, consider implementing a new ShaderWrapper using
-    // GL_STREAM_DRAW, and replace UnbindGeometry() with Buffer Object
-    // Streaming mechanisms.
-    UnbindGeometry();
+    // The buffers of the previous geometry are kept and refilled in place, so
+    // that a geometry updated every frame streams into the same buffers.
+    bound_ = false;
 
     // Prepare data to be passed to GPU
     std::vector<Eigen::Vector3f> points;
@@ -85,19 +90,14 @@ bool PhongShader::BindGeometry(const geometry::Geometry &geometry,
         return false;
     }
 
-    // Create buffers and bind the geometry
-    glGenBuffers(1, &vertex_position_buffer_);
-    glBindBuffer(GL_ARRAY_BUFFER, vertex_position_buffer_);
-    glBufferData(GL_ARRAY_BUFFER, points.size() * sizeof(Eigen::Vector3f),
-                 points.data(), GL_STATIC_DRAW);
-    glGenBuffers(1, &vertex_normal_buffer_);
-    glBindBuffer(GL_ARRAY_BUFFER, vertex_normal_buffer_);
-    glBufferData(GL_ARRAY_BUFFER, normals.size() * sizeof(Eigen::Vector3f),
-                 normals.data(), GL_STATIC_DRAW);
-    glGenBuffers(1, &vertex_color_buffer_);
-    glBindBuffer(GL_ARRAY_BUFFER, vertex_color_buffer_);
-    glBufferData(GL_ARRAY_BUFFER, colors.size() * sizeof(Eigen::Vector3f),
-                 colors.data(), GL_STATIC_DRAW);
+    // Upload the geometry to the buffers
+    UploadArrayBuffer(vertex_position_buffer_,
+                      points.size() * sizeof(Eigen::Vector3f), points.data());
+    UploadArrayBuffer(vertex_normal_buffer_,
+                      normals.size() * sizeof(Eigen::Vector3f),
+                      normals.data());
+    UploadArrayBuffer(vertex_color_buffer_,
+                      colors.size() * sizeof(Eigen::Vector3f), colors.data());
     bound_ = true;
     return true;
 }
@@ -121,15 +121,27 @@ bool PhongShader::RenderGeometry(const geometry::Geometry &geometry,
     glUniform4fv(light_specular_shininess_, 1,
                  light_specular_shininess_data_.data());
     glUniform4fv(light_ambient_, 1, light_ambient_data_.data());
+    glUniform1i(color_map_axis_, color_map_axis_data_);
     glEnableVertexAttribArray(vertex_position_);
     glBindBuffer(GL_ARRAY_BUFFER, vertex_position_buffer_);
     glVertexAttribPointer(vertex_position_, 3, GL_FLOAT, GL_FALSE, 0, NULL);
     glEnableVertexAttribArray(vertex_normal_);
     glBindBuffer(GL_ARRAY_BUFFER, vertex_normal_buffer_);
     glVertexAttribPointer(vertex_normal_, 3, GL_FLOAT, GL_FALSE, 0, NULL);
-    glEnableVertexAttribArray(vertex_color_);
-    glBindBuffer(GL_ARRAY_BUFFER, vertex_color_buffer_);
-    glVertexAttribPointer(vertex_color_, 3, GL_FLOAT, GL_FALSE, 0, NULL);
+    if (color_map_axis_data_ >= 0) {
+        // The range follows the view bounds without rebinding the geometry.
+        const auto &bounds = view.GetBoundingBox();
+        glUniform2f(color_map_range_,
+                    GLfloat(bounds.min_bound_(color_map_axis_data_)),
+                    GLfloat(bounds.max_bound_(color_map_axis_data_)));
+        glActiveTexture(GL_TEXTURE0);
+        BindColorMapTexture();
+        glUniform1i(color_map_, 0);
+    } else {
+        glEnableVertexAttribArray(vertex_color_);
+        glBindBuffer(GL_ARRAY_BUFFER, vertex_color_buffer_);
+        glVertexAttribPointer(vertex_color_, 3, GL_FLOAT, GL_FALSE, 0, NULL);
+    }
     glDrawArrays(draw_arrays_mode_, 0, draw_arrays_size_);
     glDisableVertexAttribArray(vertex_position_);
     glDisableVertexAttribArray(vertex_normal_);
@@ -138,12 +150,8 @@ bool PhongShader::RenderGeometry(const geometry::Geometry &geometry,
 }
 
 void PhongShader::UnbindGeometry() {
-    if (bound_) {
-        glDeleteBuffers(1, &vertex_position_buffer_);
-        glDeleteBuffers(1, &vertex_normal_buffer_);
-        glDeleteBuffers(1, &vertex_color_buffer_);
-        bound_ = false;
-    }
+    // The buffers are released with the shader, see Release().
+    bound_ = false;
 }
 
 void PhongShader::SetLighting(const ViewControl &view,
@@ -221,41 +229,21 @@ bool PhongShaderForPointCloud::PrepareBinding(
         PrintShaderWarning("Binding failed with pointcloud with no normals.");
         return false;
     }
-    const ColorMap &global_color_map = *GetGlobalColorMap();
+    // The vertex shader maps coordinates through the color map, so the
+    // colors are only uploaded when the points keep their own.
+    color_map_axis_data_ = GetColorMapAxis(option.point_color_option_,
+                                           pointcloud.HasColors());
     points.resize(pointcloud.points_.size());
     normals.resize(pointcloud.points_.size());
-    colors.resize(pointcloud.points_.size());
     for (size_t i = 0; i < pointcloud.points_.size(); i++) {
-        const auto &point = pointcloud.points_[i];
-        const auto &normal = pointcloud.normals_[i];
-        points[i] = point.cast<float>();
-        normals[i] = normal.cast<float>();
-        Eigen::Vector3d color;
-        switch (option.point_color_option_) {
-            case RenderOption::PointColorOption::XCoordinate:
-                color = global_color_map.GetColor(
-                        view.GetBoundingBox().GetXPercentage(point(0)));
-                break;
-            case RenderOption::PointColorOption::YCoordinate:
-                color = global_color_map.GetColor(
-                        view.GetBoundingBox().GetYPercentage(point(1)));
-                break;
-            case RenderOption::PointColorOption::ZCoordinate:
-                color = global_color_map.GetColor(
-                        view.GetBoundingBox().GetZPercentage(point(2)));
-                break;
-            case RenderOption::PointColorOption::Color:
-            case RenderOption::PointColorOption::Default:
-            default:
-                if (pointcloud.HasColors()) {
-                    color = pointcloud.colors_[i];
-                } else {
-                    color = global_color_map.GetColor(
-                            view.GetBoundingBox().GetZPercentage(point(2)));
-                }
-                break;
+        points[i] = pointcloud.points_[i].cast<float>();
+        normals[i] = pointcloud.normals_[i].cast<float>();
+    }
+    if (color_map_axis_data_ < 0) {
+        colors.resize(pointcloud.colors_.size());
+        for (size_t i = 0; i < pointcloud.colors_.size(); i++) {
+            colors[i] = pointcloud.colors_[i].cast<float>();
         }
-        colors[i] = color.cast<float>();
     }
     draw_arrays_mode_ = GL_POINTS;
     draw_arrays_size_ = GLsizei(points.size());
@@ -316,44 +304,31 @@ bool PhongShaderForTriangleMesh::PrepareBinding(
         PrintShaderWarning("Call ComputeVertexNormals() before binding.");
         return false;
     }
-    const ColorMap &global_color_map = *GetGlobalColorMap();
+    color_map_axis_data_ = GetColorMapAxis(option.mesh_color_option_);
     points.resize(mesh.triangles_.size() * 3);
     normals.resize(mesh.triangles_.size() * 3);
-    colors.resize(mesh.triangles_.size() * 3);
+    if (color_map_axis_data_ < 0) {
+        colors.resize(mesh.triangles_.size() * 3);
+    }
 
     for (size_t i = 0; i < mesh.triangles_.size(); i++) {
         const auto &triangle = mesh.triangles_[i];
         for (size_t j = 0; j < 3; j++) {
             size_t idx = i * 3 + j;
             size_t vi = triangle(j);
-            const auto &vertex = mesh.vertices_[vi];
-            points[idx] = vertex.cast<float>();
+            points[idx] = mesh.vertices_[vi].cast<float>();
 
-            Eigen::Vector3d color;
-            switch (option.mesh_color_option_) {
-                case RenderOption::MeshColorOption::XCoordinate:
-                    color = global_color_map.GetColor(
-                            view.GetBoundingBox().GetXPercentage(vertex(0)));
-                    break;
-                case RenderOption::MeshColorOption::YCoordinate:
-                    color = global_color_map.GetColor(
-                            view.GetBoundingBox().GetYPercentage(vertex(1)));
-                    break;
-                case RenderOption::MeshColorOption::ZCoordinate:
-                    color = global_color_map.GetColor(
-                            view.GetBoundingBox().GetZPercentage(vertex(2)));
-                    break;
-                case RenderOption::MeshColorOption::Color:
-                    if (mesh.HasVertexColors()) {
-                        color = mesh.vertex_colors_[vi];
-                        break;
-                    }
-                case RenderOption::MeshColorOption::Default:
-                default:
+            if (color_map_axis_data_ < 0) {
+                Eigen::Vector3d color;
+                if (option.mesh_color_option_ ==
+                            RenderOption::MeshColorOption::Color &&
+                    mesh.HasVertexColors()) {
+                    color = mesh.vertex_colors_[vi];
+                } else {
                     color = option.default_mesh_color_;
-                    break;
+                }
+                colors[idx] = color.cast<float>();
             }
-            colors[idx] = color.cast<float>();
 
             if (option.mesh_shade_option_ ==
                 RenderOption::MeshShadeOption::FlatShade) {
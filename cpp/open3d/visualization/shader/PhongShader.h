@@ -58,6 +58,9 @@ protected:
     virtual bool PrepareRendering(const geometry::Geometry &geometry,
                                   const RenderOption &option,
                                   const ViewControl &view) = 0;
+    /// Fills the points, normals and colors. Colors may be left empty if
+    /// color_map_axis_data_ is set to the coordinate axis that the vertex
+    /// shader maps through the global color map instead.
     virtual bool PrepareBinding(const geometry::Geometry &geometry,
                                 const RenderOption &option,
                                 const ViewControl &view,
@@ -70,11 +73,11 @@ protected:
 
 protected:
     GLuint vertex_position_;
-    GLuint vertex_position_buffer_;
+    GLuint vertex_position_buffer_ = 0;
     GLuint vertex_color_;
-    GLuint vertex_color_buffer_;
+    GLuint vertex_color_buffer_ = 0;
     GLuint vertex_normal_;
-    GLuint vertex_normal_buffer_;
+    GLuint vertex_normal_buffer_ = 0;
     GLuint MVP_;
     GLuint V_;
     GLuint M_;
@@ -84,6 +87,11 @@ protected:
     GLuint light_specular_power_;
     GLuint light_specular_shininess_;
     GLuint light_ambient_;
+    GLuint color_map_axis_;
+    GLuint color_map_range_;
+    GLuint color_map_;
+
+    int color_map_axis_data_ = -1;
 
     // At most support 4 lights
     gl_util::GLMatrix4f light_position_world_data_;
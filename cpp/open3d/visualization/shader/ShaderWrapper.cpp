@@ -26,14 +26,140 @@
 
 #include "open3d/visualization/shader/ShaderWrapper.h"
 
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
 #include "open3d/geometry/Geometry.h"
 #include "open3d/utility/Console.h"
+#include "open3d/visualization/utility/ColorMap.h"
+#include "open3d/utility/FileSystem.h"
 
 namespace open3d {
 namespace visualization {
 
 namespace glsl {
 
+namespace {
+
+// Identifies the cache files. Change it when their layout changes.
+const uint32_t kProgramCacheMagic = 0x4f334450;  // "O3DP"
+
+std::string &ProgramCacheDirectory() {
+    static std::string directory = []() -> std::string {
+        if (const char *env = std::getenv("OPEN3D_SHADER_CACHE_DIR")) {
+            return env;
+        }
+#ifdef _WIN32
+        if (const char *local_app_data = std::getenv("LOCALAPPDATA")) {
+            return std::string(local_app_data) + "/Open3D/shaders";
+        }
+#else
+        if (const char *home = std::getenv("HOME")) {
+            return std::string(home) + "/.cache/open3d/shaders";
+        }
+#endif
+        return "";
+    }();
+    return directory;
+}
+
+void HashString(uint64_t &hash, const char *str) {
+    // FNV-1a. The terminating null is hashed to separate the strings.
+    const uint64_t kPrime = 1099511628211ull;
+    if (str != NULL) {
+        for (; *str != '\0'; ++str) {
+            hash = (hash ^ static_cast<unsigned char>(*str)) * kPrime;
+        }
+    }
+    hash *= kPrime;
+}
+
+/// Returns the path of the cached binary of the program, or an empty string
+/// if the cache is disabled or the driver cannot return program binaries.
+std::string GetProgramCachePath(const char *const vertex_shader_code,
+                                const char *const geometry_shader_code,
+                                const char *const fragment_shader_code) {
+    const std::string &directory = ProgramCacheDirectory();
+    if (directory.empty() || !GLEW_ARB_get_program_binary) {
+        return "";
+    }
+    // Binaries are only valid for the driver that produced them.
+    uint64_t hash = 14695981039346656037ull;
+    for (GLenum name : {GL_VENDOR, GL_RENDERER, GL_VERSION}) {
+        HashString(hash, reinterpret_cast<const char *>(glGetString(name)));
+    }
+    HashString(hash, vertex_shader_code);
+    HashString(hash, geometry_shader_code);
+    HashString(hash, fragment_shader_code);
+    return fmt::format("{}/{:016x}.bin", directory, hash);
+}
+
+/// Loads the cached binary into \p program. Returns false if there is no
+/// usable binary, e.g. after a driver update.
+bool LoadProgramBinary(const std::string &path, GLuint program) {
+    std::vector<char> bytes;
+    std::string error_str;
+    if (!utility::filesystem::FileExists(path) ||
+        !utility::filesystem::FReadToBuffer(path, bytes, &error_str) ||
+        bytes.size() <= 2 * sizeof(uint32_t)) {
+        return false;
+    }
+    uint32_t header[2];
+    std::memcpy(header, bytes.data(), sizeof(header));
+    if (header[0] != kProgramCacheMagic) {
+        return false;
+    }
+    glProgramBinary(program, GLenum(header[1]), bytes.data() + sizeof(header),
+                    GLsizei(bytes.size() - sizeof(header)));
+    GLint result = GL_FALSE;
+    glGetProgramiv(program, GL_LINK_STATUS, &result);
+    if (result == GL_FALSE) {
+        utility::LogDebug("Discarding stale program binary {}.", path);
+        return false;
+    }
+    return true;
+}
+
+void SaveProgramBinary(const std::string &path, GLuint program) {
+    GLint length = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0) {
+        return;
+    }
+    std::vector<char> binary(length);
+    GLenum format = 0;
+    glGetProgramBinary(program, length, &length, &format, binary.data());
+    utility::filesystem::MakeDirectoryHierarchy(
+            utility::filesystem::GetFileParentDirectory(path));
+    // Written next to the target and renamed, so that concurrent processes
+    // never read a partial file.
+    std::string tmp_path = path + ".tmp";
+    FILE *file = utility::filesystem::FOpen(tmp_path, "wb");
+    if (file == NULL) {
+        return;
+    }
+    uint32_t header[2] = {kProgramCacheMagic, uint32_t(format)};
+    bool success = fwrite(header, sizeof(header), 1, file) == 1 &&
+                   fwrite(binary.data(), length, 1, file) == 1;
+    success = fclose(file) == 0 && success;
+    if (!success || std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+        std::remove(tmp_path.c_str());
+    }
+}
+
+}  // namespace
+
+void ShaderWrapper::SetProgramCacheDirectory(const std::string &directory) {
+    ProgramCacheDirectory() = directory;
+}
+
+const std::string &ShaderWrapper::GetProgramCacheDirectory() {
+    return ProgramCacheDirectory();
+}
+
 bool ShaderWrapper::Render(const geometry::Geometry &geometry,
                            const RenderOption &option,
                            const ViewControl &view) {
@@ -56,6 +182,88 @@ void ShaderWrapper::InvalidateGeometry() {
     }
 }
 
+void ShaderWrapper::UploadArrayBuffer(GLuint &buffer,
+                                      GLsizeiptr size,
+                                      const void *data) {
+    if (buffer == 0) {
+        glGenBuffers(1, &buffer);
+        glBindBuffer(GL_ARRAY_BUFFER, buffer);
+        glBufferData(GL_ARRAY_BUFFER, size, data, GL_STATIC_DRAW);
+        return;
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+    GLint capacity = 0;
+    glGetBufferParameteriv(GL_ARRAY_BUFFER, GL_BUFFER_SIZE, &capacity);
+    if (size > GLsizeiptr(capacity)) {
+        glBufferData(GL_ARRAY_BUFFER, size, data, GL_DYNAMIC_DRAW);
+    } else if (size > 0) {
+        // Orphan the old storage so that the driver can hand out a fresh
+        // block instead of synchronizing with the pending draws.
+        glBufferData(GL_ARRAY_BUFFER, capacity, NULL, GL_DYNAMIC_DRAW);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, size, data);
+    }
+}
+
+void ShaderWrapper::BindColorMapTexture() {
+    std::shared_ptr<const ColorMap> color_map = GetGlobalColorMap();
+    if (color_map_texture_ == 0) {
+        glGenTextures(1, &color_map_texture_);
+        glBindTexture(GL_TEXTURE_1D, color_map_texture_);
+        glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    } else {
+        glBindTexture(GL_TEXTURE_1D, color_map_texture_);
+    }
+    if (color_map != color_map_texture_source_) {
+        std::vector<Eigen::Vector3f> texels(kColorMapTextureSize);
+        for (int i = 0; i < kColorMapTextureSize; i++) {
+            double value = double(i) / (kColorMapTextureSize - 1);
+            texels[i] = color_map->GetColor(value).cast<float>();
+        }
+        glTexImage1D(GL_TEXTURE_1D, 0, GL_RGB32F, kColorMapTextureSize, 0,
+                     GL_RGB, GL_FLOAT, texels.data());
+        color_map_texture_source_ = color_map;
+    }
+}
+
+void ShaderWrapper::ReleaseColorMapTexture() {
+    if (color_map_texture_ != 0) {
+        glDeleteTextures(1, &color_map_texture_);
+        color_map_texture_ = 0;
+    }
+    color_map_texture_source_.reset();
+}
+
+int ShaderWrapper::GetColorMapAxis(RenderOption::PointColorOption option,
+                                   bool has_colors) {
+    switch (option) {
+        case RenderOption::PointColorOption::XCoordinate:
+            return 0;
+        case RenderOption::PointColorOption::YCoordinate:
+            return 1;
+        case RenderOption::PointColorOption::ZCoordinate:
+            return 2;
+        case RenderOption::PointColorOption::Color:
+        case RenderOption::PointColorOption::Default:
+        default:
+            return has_colors ? -1 : 2;
+    }
+}
+
+int ShaderWrapper::GetColorMapAxis(RenderOption::MeshColorOption option) {
+    switch (option) {
+        case RenderOption::MeshColorOption::XCoordinate:
+            return 0;
+        case RenderOption::MeshColorOption::YCoordinate:
+            return 1;
+        case RenderOption::MeshColorOption::ZCoordinate:
+            return 2;
+        default:
+            return -1;
+    }
+}
+
 void ShaderWrapper::PrintShaderWarning(const std::string &message) const {
     utility::LogWarning("[{}] {}", GetShaderName(), message);
 }
@@ -67,6 +275,17 @@ bool ShaderWrapper::CompileShaders(const char *const vertex_shader_code,
         return true;
     }
 
+    const std::string cache_path = GetProgramCachePath(
+            vertex_shader_code, geometry_shader_code, fragment_shader_code);
+    if (!cache_path.empty()) {
+        program_ = glCreateProgram();
+        if (LoadProgramBinary(cache_path, program_)) {
+            compiled_ = true;
+            return true;
+        }
+        glDeleteProgram(program_);
+    }
+
     if (vertex_shader_code != NULL) {
         vertex_shader_ = glCreateShader(GL_VERTEX_SHADER);
         const GLchar *vertex_shader_code_buffer = vertex_shader_code;
@@ -107,10 +326,17 @@ bool ShaderWrapper::CompileShaders(const char *const vertex_shader_code,
     if (fragment_shader_code != NULL) {
         glAttachShader(program_, fragment_shader_);
     }
+    if (!cache_path.empty()) {
+        glProgramParameteri(program_, GL_PROGRAM_BINARY_RETRIEVABLE_HINT,
+                            GL_TRUE);
+    }
     glLinkProgram(program_);
     if (!ValidateProgram(program_)) {
         return false;
     }
+    if (!cache_path.empty()) {
+        SaveProgramBinary(cache_path, program_);
+    }
 
     // Mark shader objects as deletable.
     // They will be released as soon as program is deleted.
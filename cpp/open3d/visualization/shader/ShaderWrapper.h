@@ -28,6 +28,8 @@
 
 #include <GL/glew.h>
 
+#include <memory>
+
 #include "open3d/geometry/Geometry.h"
 #include "open3d/visualization/visualizer/RenderOption.h"
 #include "open3d/visualization/visualizer/ViewControl.h"
@@ -35,6 +37,8 @@
 namespace open3d {
 namespace visualization {
 
+class ColorMap;
+
 namespace glsl {
 
 class ShaderWrapper {
@@ -63,6 +67,16 @@ public:
 
     void PrintShaderWarning(const std::string &message) const;
 
+    /// Sets the directory of the on-disk cache of linked program binaries.
+    /// Programs found in the cache skip the compilation and linking of their
+    /// GLSL sources. An empty directory disables the cache. Defaults to the
+    /// OPEN3D_SHADER_CACHE_DIR environment variable if set, else to
+    /// $HOME/.cache/open3d/shaders (%LOCALAPPDATA%/Open3D/shaders on
+    /// Windows).
+    static void SetProgramCacheDirectory(const std::string &directory);
+
+    static const std::string &GetProgramCacheDirectory();
+
 protected:
     /// Function to compile shader
     /// In a derived class, this must be declared as final, and called from
@@ -90,6 +104,30 @@ protected:
                         const char *const fragment_shader_code);
     void ReleaseProgram();
 
+    /// Uploads \p size bytes of \p data to the array buffer \p buffer,
+    /// generating the buffer if it is 0. An existing buffer is orphaned and
+    /// refilled in place when it is large enough, so that geometry updates
+    /// neither recreate the buffer nor wait for the draws that still read
+    /// its previous contents.
+    static void UploadArrayBuffer(GLuint &buffer,
+                                  GLsizeiptr size,
+                                  const void *data);
+
+    /// Binds the global color map as a 1D lookup texture to the active
+    /// texture unit. The texture is only uploaded again after
+    /// SetGlobalColorMap() has changed the color map, so that shaders mapping
+    /// coordinates to colors on the GPU do not rebind their geometry.
+    void BindColorMapTexture();
+    void ReleaseColorMapTexture();
+
+    /// Returns the coordinate axis whose value is mapped through the global
+    /// color map for \p option, or -1 if the points keep their own colors.
+    static int GetColorMapAxis(RenderOption::PointColorOption option,
+                               bool has_colors);
+    /// Returns the coordinate axis whose value is mapped through the global
+    /// color map for \p option, or -1 if the vertices keep their own colors.
+    static int GetColorMapAxis(RenderOption::MeshColorOption option);
+
 protected:
     GLuint vertex_shader_;
     GLuint geometry_shader_;
@@ -100,12 +138,18 @@ protected:
     bool compiled_ = false;
     bool bound_ = false;
 
+    /// Number of texels of the color map lookup texture.
+    static const int kColorMapTextureSize = 256;
+
     void SetShaderName(const std::string &shader_name) {
         shader_name_ = shader_name;
     }
 
 private:
     std::string shader_name_ = "ShaderWrapper";
+    GLuint color_map_texture_ = 0;
+    /// The color map last uploaded to color_map_texture_.
+    std::shared_ptr<const ColorMap> color_map_texture_source_;
 };
 
 }  // namespace glsl
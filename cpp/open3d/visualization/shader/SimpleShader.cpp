@@ -74,24 +74,28 @@ bool SimpleShader::Compile() {
     vertex_position_ = glGetAttribLocation(program_, "vertex_position");
     vertex_color_ = glGetAttribLocation(program_, "vertex_color");
     MVP_ = glGetUniformLocation(program_, "MVP");
+    color_map_axis_ = glGetUniformLocation(program_, "color_map_axis");
+    color_map_range_ = glGetUniformLocation(program_, "color_map_range");
+    color_map_ = glGetUniformLocation(program_, "color_map");
     return true;
 }
 
 void SimpleShader::Release() {
     UnbindGeometry();
+    glDeleteBuffers(1, &vertex_position_buffer_);
+    glDeleteBuffers(1, &vertex_color_buffer_);
+    vertex_position_buffer_ = 0;
+    vertex_color_buffer_ = 0;
+    ReleaseColorMapTexture();
     ReleaseProgram();
 }
 
 bool SimpleShader::BindGeometry(const geometry::Geometry &geometry,
                                 const RenderOption &option,
                                 const ViewControl &view) {
-    // If there is already geometry, we first unbind it.
-    // We use GL_STATIC_DRAW. When geometry changes, we clear buffers and
-    // rebind the geometry. Note that this approach is slow. If the geometry is
-    // changing per frame, consider implementing a new ShaderWrapper using
-    // GL_STREAM_DRAW, and replace InvalidateGeometry() with Buffer Object
-    // Streaming mechanisms.
-    UnbindGeometry();
+    // The buffers of the previous geometry are kept and refilled in place, so
+    // that a geometry updated every frame streams into the same buffers.
+    bound_ = false;
 
     // Prepare data to be passed to GPU
     std::vector<Eigen::Vector3f> points;
@@ -101,15 +105,11 @@ bool SimpleShader::BindGeometry(const geometry::Geometry &geometry,
         return false;
     }
 
-    // Create buffers and bind the geometry
-    glGenBuffers(1, &vertex_position_buffer_);
-    glBindBuffer(GL_ARRAY_BUFFER, vertex_position_buffer_);
-    glBufferData(GL_ARRAY_BUFFER, points.size() * sizeof(Eigen::Vector3f),
-                 points.data(), GL_STATIC_DRAW);
-    glGenBuffers(1, &vertex_color_buffer_);
-    glBindBuffer(GL_ARRAY_BUFFER, vertex_color_buffer_);
-    glBufferData(GL_ARRAY_BUFFER, colors.size() * sizeof(Eigen::Vector3f),
-                 colors.data(), GL_STATIC_DRAW);
+    // Upload the geometry to the buffers
+    UploadArrayBuffer(vertex_position_buffer_,
+                      points.size() * sizeof(Eigen::Vector3f), points.data());
+    UploadArrayBuffer(vertex_color_buffer_,
+                      colors.size() * sizeof(Eigen::Vector3f), colors.data());
     bound_ = true;
     return true;
 }
@@ -123,12 +123,24 @@ bool SimpleShader::RenderGeometry(const geometry::Geometry &geometry,
     }
     glUseProgram(program_);
     glUniformMatrix4fv(MVP_, 1, GL_FALSE, view.GetMVPMatrix().data());
+    glUniform1i(color_map_axis_, color_map_axis_data_);
     glEnableVertexAttribArray(vertex_position_);
     glBindBuffer(GL_ARRAY_BUFFER, vertex_position_buffer_);
     glVertexAttribPointer(vertex_position_, 3, GL_FLOAT, GL_FALSE, 0, NULL);
-    glEnableVertexAttribArray(vertex_color_);
-    glBindBuffer(GL_ARRAY_BUFFER, vertex_color_buffer_);
-    glVertexAttribPointer(vertex_color_, 3, GL_FLOAT, GL_FALSE, 0, NULL);
+    if (color_map_axis_data_ >= 0) {
+        // The range follows the view bounds without rebinding the geometry.
+        const auto &bounds = view.GetBoundingBox();
+        glUniform2f(color_map_range_,
+                    GLfloat(bounds.min_bound_(color_map_axis_data_)),
+                    GLfloat(bounds.max_bound_(color_map_axis_data_)));
+        glActiveTexture(GL_TEXTURE0);
+        BindColorMapTexture();
+        glUniform1i(color_map_, 0);
+    } else {
+        glEnableVertexAttribArray(vertex_color_);
+        glBindBuffer(GL_ARRAY_BUFFER, vertex_color_buffer_);
+        glVertexAttribPointer(vertex_color_, 3, GL_FLOAT, GL_FALSE, 0, NULL);
+    }
     glDrawArrays(draw_arrays_mode_, 0, draw_arrays_size_);
     glDisableVertexAttribArray(vertex_position_);
     glDisableVertexAttribArray(vertex_color_);
@@ -136,11 +148,8 @@ bool SimpleShader::RenderGeometry(const geometry::Geometry &geometry,
 }
 
 void SimpleShader::UnbindGeometry() {
-    if (bound_) {
-        glDeleteBuffers(1, &vertex_position_buffer_);
-        glDeleteBuffers(1, &vertex_color_buffer_);
-        bound_ = false;
-    }
+    // The buffers are released with the shader, see Release().
+    bound_ = false;
 }
 
 bool SimpleShaderForPointCloud::PrepareRendering(
@@ -175,38 +184,18 @@ bool SimpleShaderForPointCloud::PrepareBinding(
         PrintShaderWarning("Binding failed with empty pointcloud.");
         return false;
     }
-    const ColorMap &global_color_map = *GetGlobalColorMap();
+    // Coordinate colors are looked up in the vertex shader.
+    color_map_axis_data_ = GetColorMapAxis(option.point_color_option_,
+                                           pointcloud.HasColors());
     points.resize(pointcloud.points_.size());
-    colors.resize(pointcloud.points_.size());
     for (size_t i = 0; i < pointcloud.points_.size(); i++) {
-        const auto &point = pointcloud.points_[i];
-        points[i] = point.cast<float>();
-        Eigen::Vector3d color;
-        switch (option.point_color_option_) {
-            case RenderOption::PointColorOption::XCoordinate:
-                color = global_color_map.GetColor(
-                        view.GetBoundingBox().GetXPercentage(point(0)));
-                break;
-            case RenderOption::PointColorOption::YCoordinate:
-                color = global_color_map.GetColor(
-                        view.GetBoundingBox().GetYPercentage(point(1)));
-                break;
-            case RenderOption::PointColorOption::ZCoordinate:
-                color = global_color_map.GetColor(
-                        view.GetBoundingBox().GetZPercentage(point(2)));
-                break;
-            case RenderOption::PointColorOption::Color:
-            case RenderOption::PointColorOption::Default:
-            default:
-                if (pointcloud.HasColors()) {
-                    color = pointcloud.colors_[i];
-                } else {
-                    color = global_color_map.GetColor(
-                            view.GetBoundingBox().GetZPercentage(point(2)));
-                }
-                break;
+        points[i] = pointcloud.points_[i].cast<float>();
+    }
+    if (color_map_axis_data_ < 0) {
+        colors.resize(pointcloud.colors_.size());
+        for (size_t i = 0; i < pointcloud.colors_.size(); i++) {
+            colors[i] = pointcloud.colors_[i].cast<float>();
         }
-        colors[i] = color.cast<float>();
     }
     draw_arrays_mode_ = GL_POINTS;
     draw_arrays_size_ = GLsizei(points.size());
@@ -472,43 +461,30 @@ bool SimpleShaderForTriangleMesh::PrepareBinding(
         PrintShaderWarning("Binding failed with empty triangle mesh.");
         return false;
     }
-    const ColorMap &global_color_map = *GetGlobalColorMap();
+    color_map_axis_data_ = GetColorMapAxis(option.mesh_color_option_);
     points.resize(mesh.triangles_.size() * 3);
-    colors.resize(mesh.triangles_.size() * 3);
+    if (color_map_axis_data_ < 0) {
+        colors.resize(mesh.triangles_.size() * 3);
+    }
 
     for (size_t i = 0; i < mesh.triangles_.size(); i++) {
         const auto &triangle = mesh.triangles_[i];
         for (size_t j = 0; j < 3; j++) {
             size_t idx = i * 3 + j;
             size_t vi = triangle(j);
-            const auto &vertex = mesh.vertices_[vi];
-            points[idx] = vertex.cast<float>();
-
-            Eigen::Vector3d color;
-            switch (option.mesh_color_option_) {
-                case RenderOption::MeshColorOption::XCoordinate:
-                    color = global_color_map.GetColor(
-                            view.GetBoundingBox().GetXPercentage(vertex(0)));
-                    break;
-                case RenderOption::MeshColorOption::YCoordinate:
-                    color = global_color_map.GetColor(
-                            view.GetBoundingBox().GetYPercentage(vertex(1)));
-                    break;
-                case RenderOption::MeshColorOption::ZCoordinate:
-                    color = global_color_map.GetColor(
-                            view.GetBoundingBox().GetZPercentage(vertex(2)));
-                    break;
-                case RenderOption::MeshColorOption::Color:
-                    if (mesh.HasVertexColors()) {
-                        color = mesh.vertex_colors_[vi];
-                        break;
-                    }
-                case RenderOption::MeshColorOption::Default:
-                default:
+            points[idx] = mesh.vertices_[vi].cast<float>();
+
+            if (color_map_axis_data_ < 0) {
+                Eigen::Vector3d color;
+                if (option.mesh_color_option_ ==
+                            RenderOption::MeshColorOption::Color &&
+                    mesh.HasVertexColors()) {
+                    color = mesh.vertex_colors_[vi];
+                } else {
                     color = option.default_mesh_color_;
-                    break;
+                }
+                colors[idx] = color.cast<float>();
             }
-            colors[idx] = color.cast<float>();
         }
     }
     draw_arrays_mode_ = GL_TRIANGLES;
@@ -516,6 +492,130 @@ bool SimpleShaderForTriangleMesh::PrepareBinding(
     return true;
 }
 
+bool SimpleInstancedShader::Compile() {
+    if (!CompileShaders(SimpleInstancedVertexShader, NULL,
+                        SimpleFragmentShader)) {
+        PrintShaderWarning("Compiling shaders failed.");
+        return false;
+    }
+    vertex_position_ = glGetAttribLocation(program_, "vertex_position");
+    instance_origin_ = glGetAttribLocation(program_, "instance_origin");
+    instance_size_ = glGetAttribLocation(program_, "instance_size");
+    instance_color_ = glGetAttribLocation(program_, "instance_color");
+    MVP_ = glGetUniformLocation(program_, "MVP");
+    return true;
+}
+
+void SimpleInstancedShader::Release() {
+    UnbindGeometry();
+    glDeleteBuffers(1, &vertex_position_buffer_);
+    glDeleteBuffers(1, &instance_origin_buffer_);
+    glDeleteBuffers(1, &instance_size_buffer_);
+    glDeleteBuffers(1, &instance_color_buffer_);
+    vertex_position_buffer_ = 0;
+    instance_origin_buffer_ = 0;
+    instance_size_buffer_ = 0;
+    instance_color_buffer_ = 0;
+    ReleaseProgram();
+}
+
+bool SimpleInstancedShader::BindGeometry(const geometry::Geometry &geometry,
+                                         const RenderOption &option,
+                                         const ViewControl &view) {
+    // As in SimpleShader, the buffers are refilled in place.
+    bound_ = false;
+
+    // Prepare data to be passed to GPU
+    std::vector<Eigen::Vector3f> origins;
+    std::vector<float> sizes;
+    std::vector<Eigen::Vector3f> colors;
+    if (!PrepareBinding(geometry, option, view, origins, sizes, colors)) {
+        PrintShaderWarning("Binding failed when preparing data.");
+        return false;
+    }
+
+    // All instances draw the same unit cube, with 12 lines or 12 triangles
+    std::vector<Eigen::Vector3f> vertices;
+    if (draw_arrays_mode_ == GL_LINES) {
+        for (const Eigen::Vector2i &line_vertex_indices :
+             cuboid_lines_vertex_indices) {
+            for (int i = 0; i < 2; i++) {
+                vertices.push_back(
+                        cuboid_vertex_offsets[line_vertex_indices(i)]
+                                .cast<float>());
+            }
+        }
+    } else {
+        for (const Eigen::Vector3i &triangle_vertex_indices :
+             cuboid_triangles_vertex_indices) {
+            for (int i = 0; i < 3; i++) {
+                vertices.push_back(
+                        cuboid_vertex_offsets[triangle_vertex_indices(i)]
+                                .cast<float>());
+            }
+        }
+    }
+
+    // Upload the unit cube and the per instance attributes
+    UploadArrayBuffer(vertex_position_buffer_,
+                      vertices.size() * sizeof(Eigen::Vector3f),
+                      vertices.data());
+    UploadArrayBuffer(instance_origin_buffer_,
+                      origins.size() * sizeof(Eigen::Vector3f),
+                      origins.data());
+    UploadArrayBuffer(instance_size_buffer_, sizes.size() * sizeof(float),
+                      sizes.data());
+    UploadArrayBuffer(instance_color_buffer_,
+                      colors.size() * sizeof(Eigen::Vector3f), colors.data());
+    draw_arrays_size_ = GLsizei(vertices.size());
+    instance_count_ = GLsizei(origins.size());
+    bound_ = true;
+    return true;
+}
+
+bool SimpleInstancedShader::RenderGeometry(const geometry::Geometry &geometry,
+                                           const RenderOption &option,
+                                           const ViewControl &view) {
+    if (!PrepareRendering(geometry, option, view)) {
+        PrintShaderWarning("Rendering failed during preparation.");
+        return false;
+    }
+    glUseProgram(program_);
+    glUniformMatrix4fv(MVP_, 1, GL_FALSE, view.GetMVPMatrix().data());
+    glEnableVertexAttribArray(vertex_position_);
+    glBindBuffer(GL_ARRAY_BUFFER, vertex_position_buffer_);
+    glVertexAttribPointer(vertex_position_, 3, GL_FLOAT, GL_FALSE, 0, NULL);
+    glEnableVertexAttribArray(instance_origin_);
+    glBindBuffer(GL_ARRAY_BUFFER, instance_origin_buffer_);
+    glVertexAttribPointer(instance_origin_, 3, GL_FLOAT, GL_FALSE, 0, NULL);
+    glVertexAttribDivisor(instance_origin_, 1);
+    glEnableVertexAttribArray(instance_size_);
+    glBindBuffer(GL_ARRAY_BUFFER, instance_size_buffer_);
+    glVertexAttribPointer(instance_size_, 1, GL_FLOAT, GL_FALSE, 0, NULL);
+    glVertexAttribDivisor(instance_size_, 1);
+    glEnableVertexAttribArray(instance_color_);
+    glBindBuffer(GL_ARRAY_BUFFER, instance_color_buffer_);
+    glVertexAttribPointer(instance_color_, 3, GL_FLOAT, GL_FALSE, 0, NULL);
+    glVertexAttribDivisor(instance_color_, 1);
+    glDrawArraysInstanced(draw_arrays_mode_, 0, draw_arrays_size_,
+                          instance_count_);
+    // The vertex array is shared with the other shaders, which expect the
+    // attributes to advance per vertex.
+    glVertexAttribDivisor(instance_origin_, 0);
+    glVertexAttribDivisor(instance_size_, 0);
+    glVertexAttribDivisor(instance_color_, 0);
+    glDisableVertexAttribArray(vertex_position_);
+    glDisableVertexAttribArray(instance_origin_);
+    glDisableVertexAttribArray(instance_size_);
+    glDisableVertexAttribArray(instance_color_);
+    return true;
+}
+
+void SimpleInstancedShader::UnbindGeometry() {
+    // The buffers are released with the shader, see Release().
+    bound_ = false;
+}
+
 bool SimpleShaderForVoxelGridLine::PrepareRendering(
         const geometry::Geometry &geometry,
         const RenderOption &option,
@@ -535,7 +635,8 @@ bool SimpleShaderForVoxelGridLine::PrepareBinding(
         const geometry::Geometry &geometry,
         const RenderOption &option,
         const ViewControl &view,
-        std::vector<Eigen::Vector3f> &points,
+        std::vector<Eigen::Vector3f> &origins,
+        std::vector<float> &sizes,
         std::vector<Eigen::Vector3f> &colors) {
     if (geometry.GetGeometryType() !=
         geometry::Geometry::GeometryType::VoxelGrid) {
@@ -549,20 +650,17 @@ bool SimpleShaderForVoxelGridLine::PrepareBinding(
         return false;
     }
     const ColorMap &global_color_map = *GetGlobalColorMap();
-    points.clear();  // Final size: num_voxels * 12 * 2
-    colors.clear();  // Final size: num_voxels * 12 * 2
+    origins.resize(0);
+    sizes.resize(0);
+    colors.resize(0);
+    origins.reserve(voxel_grid.voxels_.size());
+    colors.reserve(voxel_grid.voxels_.size());
 
     for (auto &it : voxel_grid.voxels_) {
         const geometry::Voxel &voxel = it.second;
-        // 8 vertices in a voxel
         Eigen::Vector3f base_vertex =
                 voxel_grid.origin_.cast<float>() +
                 voxel.grid_index_.cast<float>() * voxel_grid.voxel_size_;
-        std::vector<Eigen::Vector3f> vertices;
-        for (const Eigen::Vector3i &vertex_offset : cuboid_vertex_offsets) {
-            vertices.push_back(base_vertex + vertex_offset.cast<float>() *
-                                                     voxel_grid.voxel_size_);
-        }
 
         // Voxel color (applied to all points)
         Eigen::Vector3d voxel_color;
@@ -589,20 +687,12 @@ bool SimpleShaderForVoxelGridLine::PrepareBinding(
                 voxel_color = option.default_mesh_color_;
                 break;
         }
-        Eigen::Vector3f voxel_color_f = voxel_color.cast<float>();
-
-        // 12 lines
-        for (const Eigen::Vector2i &line_vertex_indices :
-             cuboid_lines_vertex_indices) {
-            points.push_back(vertices[line_vertex_indices(0)]);
-            points.push_back(vertices[line_vertex_indices(1)]);
-            colors.push_back(voxel_color_f);
-            colors.push_back(voxel_color_f);
-        }
+        origins.push_back(base_vertex);
+        colors.push_back(voxel_color.cast<float>());
     }
+    sizes.resize(origins.size(), float(voxel_grid.voxel_size_));
 
     draw_arrays_mode_ = GL_LINES;
-    draw_arrays_size_ = GLsizei(points.size());
     return true;
 }
 
@@ -625,7 +715,8 @@ bool SimpleShaderForVoxelGridFace::PrepareBinding(
         const geometry::Geometry &geometry,
         const RenderOption &option,
         const ViewControl &view,
-        std::vector<Eigen::Vector3f> &points,
+        std::vector<Eigen::Vector3f> &origins,
+        std::vector<float> &sizes,
         std::vector<Eigen::Vector3f> &colors) {
     if (geometry.GetGeometryType() !=
         geometry::Geometry::GeometryType::VoxelGrid) {
@@ -639,20 +730,17 @@ bool SimpleShaderForVoxelGridFace::PrepareBinding(
         return false;
     }
     const ColorMap &global_color_map = *GetGlobalColorMap();
-    points.clear();  // Final size: num_voxels * 36
-    colors.clear();  // Final size: num_voxels * 36
+    origins.resize(0);
+    sizes.resize(0);
+    colors.resize(0);
+    origins.reserve(voxel_grid.voxels_.size());
+    colors.reserve(voxel_grid.voxels_.size());
 
     for (auto &it : voxel_grid.voxels_) {
         const geometry::Voxel &voxel = it.second;
-        // 8 vertices in a voxel
         Eigen::Vector3f base_vertex =
                 voxel_grid.origin_.cast<float>() +
                 voxel.grid_index_.cast<float>() * voxel_grid.voxel_size_;
-        std::vector<Eigen::Vector3f> vertices;
-        for (const Eigen::Vector3i &vertex_offset : cuboid_vertex_offsets) {
-            vertices.push_back(base_vertex + vertex_offset.cast<float>() *
-                                                     voxel_grid.voxel_size_);
-        }
 
         // Voxel color (applied to all points)
         Eigen::Vector3d voxel_color;
@@ -679,23 +767,12 @@ bool SimpleShaderForVoxelGridFace::PrepareBinding(
                 voxel_color = option.default_mesh_color_;
                 break;
         }
-        Eigen::Vector3f voxel_color_f = voxel_color.cast<float>();
-
-        // 12 triangles in a voxel
-        for (const Eigen::Vector3i &triangle_vertex_indices :
-             cuboid_triangles_vertex_indices) {
-            points.push_back(vertices[triangle_vertex_indices(0)]);
-            points.push_back(vertices[triangle_vertex_indices(1)]);
-            points.push_back(vertices[triangle_vertex_indices(2)]);
-            colors.push_back(voxel_color_f);
-            colors.push_back(voxel_color_f);
-            colors.push_back(voxel_color_f);
-        }
+        origins.push_back(base_vertex);
+        colors.push_back(voxel_color.cast<float>());
     }
+    sizes.resize(origins.size(), float(voxel_grid.voxel_size_));
 
     draw_arrays_mode_ = GL_TRIANGLES;
-    draw_arrays_size_ = GLsizei(points.size());
-
     return true;
 }
 
@@ -718,7 +795,8 @@ bool SimpleShaderForOctreeFace::PrepareBinding(
         const geometry::Geometry &geometry,
         const RenderOption &option,
         const ViewControl &view,
-        std::vector<Eigen::Vector3f> &points,
+        std::vector<Eigen::Vector3f> &origins,
+        std::vector<float> &sizes,
         std::vector<Eigen::Vector3f> &colors) {
     if (geometry.GetGeometryType() !=
         geometry::Geometry::GeometryType::Octree) {
@@ -731,10 +809,11 @@ bool SimpleShaderForOctreeFace::PrepareBinding(
         return false;
     }
     const ColorMap &global_color_map = *GetGlobalColorMap();
-    points.clear();  // Final size: num_voxels * 36
-    colors.clear();  // Final size: num_voxels * 36
+    origins.resize(0);
+    sizes.resize(0);
+    colors.resize(0);
 
-    auto f = [&points, &colors, &option, &global_color_map, &view](
+    auto f = [&origins, &sizes, &colors, &option, &global_color_map, &view](
                      const std::shared_ptr<geometry::OctreeNode> &node,
                      const std::shared_ptr<geometry::OctreeNodeInfo> &node_info)
             -> void {
@@ -743,13 +822,6 @@ bool SimpleShaderForOctreeFace::PrepareBinding(
                             node)) {
             // All vertex in the voxel share the same color
             Eigen::Vector3f base_vertex = node_info->origin_.cast<float>();
-            std::vector<Eigen::Vector3f> vertices;
-            for (const Eigen::Vector3i &vertex_offset : cuboid_vertex_offsets) {
-                vertices.push_back(base_vertex +
-                                   vertex_offset.cast<float>() *
-                                           float(node_info->size_));
-            }
-
             Eigen::Vector3d voxel_color;
             switch (option.mesh_color_option_) {
                 case RenderOption::MeshColorOption::XCoordinate:
@@ -775,26 +847,15 @@ bool SimpleShaderForOctreeFace::PrepareBinding(
                     voxel_color = option.default_mesh_color_;
                     break;
             }
-            Eigen::Vector3f voxel_color_f = voxel_color.cast<float>();
-
-            // 12 triangles in a voxel
-            for (const Eigen::Vector3i &triangle_vertex_indices :
-                 cuboid_triangles_vertex_indices) {
-                points.push_back(vertices[triangle_vertex_indices(0)]);
-                points.push_back(vertices[triangle_vertex_indices(1)]);
-                points.push_back(vertices[triangle_vertex_indices(2)]);
-                colors.push_back(voxel_color_f);
-                colors.push_back(voxel_color_f);
-                colors.push_back(voxel_color_f);
-            }
+            origins.push_back(base_vertex);
+            sizes.push_back(float(node_info->size_));
+            colors.push_back(voxel_color.cast<float>());
         }
     };
 
     octree.Traverse(f);
 
     draw_arrays_mode_ = GL_TRIANGLES;
-    draw_arrays_size_ = GLsizei(points.size());
-
     return true;
 }
 
@@ -817,7 +878,8 @@ bool SimpleShaderForOctreeLine::PrepareBinding(
         const geometry::Geometry &geometry,
         const RenderOption &option,
         const ViewControl &view,
-        std::vector<Eigen::Vector3f> &points,
+        std::vector<Eigen::Vector3f> &origins,
+        std::vector<float> &sizes,
         std::vector<Eigen::Vector3f> &colors) {
     if (geometry.GetGeometryType() !=
         geometry::Geometry::GeometryType::Octree) {
@@ -829,40 +891,28 @@ bool SimpleShaderForOctreeLine::PrepareBinding(
         PrintShaderWarning("Binding failed with empty octree.");
         return false;
     }
-    points.clear();  // Final size: num_voxels * 36
-    colors.clear();  // Final size: num_voxels * 36
+    origins.resize(0);
+    sizes.resize(0);
+    colors.resize(0);
 
-    auto f = [&points, &colors](
+    auto f = [&origins, &sizes, &colors](
                      const std::shared_ptr<geometry::OctreeNode> &node,
                      const std::shared_ptr<geometry::OctreeNodeInfo> &node_info)
             -> void {
-        Eigen::Vector3f base_vertex = node_info->origin_.cast<float>();
-        std::vector<Eigen::Vector3f> vertices;
-        for (const Eigen::Vector3i &vertex_offset : cuboid_vertex_offsets) {
-            vertices.push_back(base_vertex + vertex_offset.cast<float>() *
-                                                     float(node_info->size_));
-        }
         Eigen::Vector3f voxel_color = Eigen::Vector3f::Zero();
         if (auto leaf_node =
                     std::dynamic_pointer_cast<geometry::OctreeColorLeafNode>(
                             node)) {
             voxel_color = leaf_node->color_.cast<float>();
         }
-
-        for (const Eigen::Vector2i &line_vertex_indices :
-             cuboid_lines_vertex_indices) {
-            points.push_back(vertices[line_vertex_indices(0)]);
-            points.push_back(vertices[line_vertex_indices(1)]);
-            colors.push_back(voxel_color);
-            colors.push_back(voxel_color);
-        }
+        origins.push_back(node_info->origin_.cast<float>());
+        sizes.push_back(float(node_info->size_));
+        colors.push_back(voxel_color);
     };
 
     octree.Traverse(f);
 
     draw_arrays_mode_ = GL_LINES;
-    draw_arrays_size_ = GLsizei(points.size());
-
     return true;
 }
 
@@ -58,6 +58,9 @@ protected:
     virtual bool PrepareRendering(const geometry::Geometry &geometry,
                                   const RenderOption &option,
                                   const ViewControl &view) = 0;
+    /// Fills the points and their colors. Colors may be left empty if
+    /// color_map_axis_data_ is set to the coordinate axis that the vertex
+    /// shader maps through the global color map instead.
     virtual bool PrepareBinding(const geometry::Geometry &geometry,
                                 const RenderOption &option,
                                 const ViewControl &view,
@@ -66,10 +69,15 @@ protected:
 
 protected:
     GLuint vertex_position_;
-    GLuint vertex_position_buffer_;
+    GLuint vertex_position_buffer_ = 0;
     GLuint vertex_color_;
-    GLuint vertex_color_buffer_;
+    GLuint vertex_color_buffer_ = 0;
     GLuint MVP_;
+    GLuint color_map_axis_;
+    GLuint color_map_range_;
+    GLuint color_map_;
+
+    int color_map_axis_data_ = -1;
 };
 
 class SimpleShaderForPointCloud : public SimpleShader {
@@ -165,10 +173,57 @@ protected:
                         std::vector<Eigen::Vector3f> &colors) final;
 };
 
-class SimpleShaderForVoxelGridLine : public SimpleShader {
+class SimpleInstancedShader : public ShaderWrapper {
+public:
+    ~SimpleInstancedShader() override { Release(); }
+
+protected:
+    SimpleInstancedShader(const std::string &name) : ShaderWrapper(name) {
+        Compile();
+    }
+
+protected:
+    bool Compile() final;
+    void Release() final;
+    bool BindGeometry(const geometry::Geometry &geometry,
+                      const RenderOption &option,
+                      const ViewControl &view) final;
+    bool RenderGeometry(const geometry::Geometry &geometry,
+                        const RenderOption &option,
+                        const ViewControl &view) final;
+    void UnbindGeometry() final;
+
+protected:
+    virtual bool PrepareRendering(const geometry::Geometry &geometry,
+                                  const RenderOption &option,
+                                  const ViewControl &view) = 0;
+    /// Fills one axis aligned cube per instance, as its origin (min corner)
+    /// in xyz and its edge length in w, and sets draw_arrays_mode_ to
+    /// GL_TRIANGLES for the faces or to GL_LINES for the edges of the cubes.
+    virtual bool PrepareBinding(const geometry::Geometry &geometry,
+                                const RenderOption &option,
+                                const ViewControl &view,
+                                std::vector<Eigen::Vector3f> &origins,
+                        std::vector<float> &sizes,
+                                std::vector<Eigen::Vector3f> &colors) = 0;
+
+protected:
+    GLuint vertex_position_;
+    GLuint vertex_position_buffer_ = 0;
+    GLuint instance_origin_;
+    GLuint instance_origin_buffer_ = 0;
+    GLuint instance_size_;
+    GLuint instance_size_buffer_ = 0;
+    GLuint instance_color_;
+    GLuint instance_color_buffer_ = 0;
+    GLuint MVP_;
+    GLsizei instance_count_ = 0;
+};
+
+class SimpleShaderForVoxelGridLine : public SimpleInstancedShader {
 public:
     SimpleShaderForVoxelGridLine()
-        : SimpleShader("SimpleShaderForVoxelGridLine") {}
+        : SimpleInstancedShader("SimpleShaderForVoxelGridLine") {}
 
 protected:
     bool PrepareRendering(const geometry::Geometry &geometry,
@@ -177,14 +232,15 @@ protected:
     bool PrepareBinding(const geometry::Geometry &geometry,
                         const RenderOption &option,
                         const ViewControl &view,
-                        std::vector<Eigen::Vector3f> &points,
+                        std::vector<Eigen::Vector3f> &origins,
+                        std::vector<float> &sizes,
                         std::vector<Eigen::Vector3f> &colors) final;
 };
 
-class SimpleShaderForVoxelGridFace : public SimpleShader {
+class SimpleShaderForVoxelGridFace : public SimpleInstancedShader {
 public:
     SimpleShaderForVoxelGridFace()
-        : SimpleShader("SimpleShaderForVoxelGridFace") {}
+        : SimpleInstancedShader("SimpleShaderForVoxelGridFace") {}
 
 protected:
     bool PrepareRendering(const geometry::Geometry &geometry,
@@ -193,13 +249,15 @@ protected:
     bool PrepareBinding(const geometry::Geometry &geometry,
                         const RenderOption &option,
                         const ViewControl &view,
-                        std::vector<Eigen::Vector3f> &points,
+                        std::vector<Eigen::Vector3f> &origins,
+                        std::vector<float> &sizes,
                         std::vector<Eigen::Vector3f> &colors) final;
 };
 
-class SimpleShaderForOctreeLine : public SimpleShader {
+class SimpleShaderForOctreeLine : public SimpleInstancedShader {
 public:
-    SimpleShaderForOctreeLine() : SimpleShader("SimpleShaderForOctreeLine") {}
+    SimpleShaderForOctreeLine()
+        : SimpleInstancedShader("SimpleShaderForOctreeLine") {}
 
 protected:
     bool PrepareRendering(const geometry::Geometry &geometry,
@@ -208,13 +266,15 @@ protected:
     bool PrepareBinding(const geometry::Geometry &geometry,
                         const RenderOption &option,
                         const ViewControl &view,
-                        std::vector<Eigen::Vector3f> &points,
+                        std::vector<Eigen::Vector3f> &origins,
+                        std::vector<float> &sizes,
                         std::vector<Eigen::Vector3f> &colors) final;
 };
 
-class SimpleShaderForOctreeFace : public SimpleShader {
+class SimpleShaderForOctreeFace : public SimpleInstancedShader {
 public:
-    SimpleShaderForOctreeFace() : SimpleShader("SimpleShaderForOctreeFace") {}
+    SimpleShaderForOctreeFace()
+        : SimpleInstancedShader("SimpleShaderForOctreeFace") {}
 
 protected:
     bool PrepareRendering(const geometry::Geometry &geometry,
@@ -223,7 +283,8 @@ protected:
     bool PrepareBinding(const geometry::Geometry &geometry,
                         const RenderOption &option,
                         const ViewControl &view,
-                        std::vector<Eigen::Vector3f> &points,
+                        std::vector<Eigen::Vector3f> &origins,
+                        std::vector<float> &sizes,
                         std::vector<Eigen::Vector3f> &colors) final;
 };
 
@@ -15,6 +15,23 @@ uniform mat4 V;
 uniform mat4 M;
 uniform mat4 light_position_world_4;
 
+/* Coordinate mapped through the color map, or -1 to use vertex_color */
+uniform int color_map_axis;
+/* Coordinates mapped to the first and last color of the color map */
+uniform vec2 color_map_range;
+uniform sampler1D color_map;
+
+vec3 ColorMap(float coordinate) {
+    float extent = color_map_range.y - color_map_range.x;
+    float value = 0.0;
+    if (extent > 0.0) {
+        value = clamp((coordinate - color_map_range.x) / extent, 0.0, 1.0);
+    }
+    /* Sample the texel centers, so that 0 and 1 map to the end colors */
+    float size = float(textureSize(color_map, 0));
+    return texture(color_map, (value * (size - 1.0) + 0.5) / size).rgb;
+}
+
 void main()
 {
     gl_Position = MVP * vec4(vertex_position, 1);
@@ -30,5 +47,9 @@ void main()
     if (dot(eye_dir_camera, vertex_normal_camera) < 0.0)
         vertex_normal_camera = vertex_normal_camera * -1.0;
 
-    fragment_color = vertex_color;
+    if (color_map_axis < 0) {
+        fragment_color = vertex_color;
+    } else {
+        fragment_color = ColorMap(vertex_position[color_map_axis]);
+    }
 }
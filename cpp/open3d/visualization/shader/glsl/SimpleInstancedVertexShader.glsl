@@ -0,0 +1,16 @@
+#version 330
+
+in vec3 vertex_position;
+in vec3 instance_origin;
+in float instance_size;
+in vec3 instance_color;
+uniform mat4 MVP;
+
+out vec3 fragment_color;
+
+void main()
+{
+    vec3 position = instance_origin + vertex_position * instance_size;
+    gl_Position = MVP * vec4(position, 1);
+    fragment_color = instance_color;
+}
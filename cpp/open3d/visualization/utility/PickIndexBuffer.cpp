@@ -0,0 +1,169 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/visualization/utility/PickIndexBuffer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+
+namespace open3d {
+namespace visualization {
+
+namespace {
+
+void SortUnique(std::vector<uint32_t> &indices) {
+    std::sort(indices.begin(), indices.end());
+    indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+    if (!indices.empty() && indices.back() == PickIndexBuffer::kNoIndex) {
+        indices.pop_back();
+    }
+}
+
+}  // namespace
+
+constexpr uint32_t PickIndexBuffer::kNoIndex;
+
+PickIndexBuffer::PickIndexBuffer(int x, int y, int width, int height)
+    : x_(x),
+      y_(y),
+      width_(std::max(0, width)),
+      height_(std::max(0, height)),
+      indices_(size_t(width_) * size_t(height_), kNoIndex) {}
+
+uint32_t PickIndexBuffer::GetIndex(int x, int y) const {
+    x -= x_;
+    y -= y_;
+    if (x < 0 || y < 0 || x >= width_ || y >= height_) {
+        return kNoIndex;
+    }
+    return indices_[size_t(y) * width_ + x];
+}
+
+void PickIndexBuffer::SetIndex(int x, int y, uint32_t index) {
+    indices_[size_t(y - y_) * width_ + (x - x_)] = index;
+}
+
+std::vector<uint32_t> PickIndexBuffer::GetIndicesInRect(int x,
+                                                        int y,
+                                                        int width,
+                                                        int height) const {
+    const int x0 = std::max(x, x_) - x_;
+    const int x1 = std::min(x + width, x_ + width_) - x_;
+    const int y0 = std::max(y, y_) - y_;
+    const int y1 = std::min(y + height, y_ + height_) - y_;
+    std::vector<uint32_t> indices;
+    for (int row = y0; row < y1; ++row) {
+        const uint32_t *begin = indices_.data() + size_t(row) * width_;
+        indices.insert(indices.end(), begin + x0, begin + std::max(x0, x1));
+        // Keeps the memory bounded by the number of unique indices.
+        if (indices.size() > indices_.size() / 4 + 4096) {
+            SortUnique(indices);
+        }
+    }
+    SortUnique(indices);
+    return indices;
+}
+
+std::vector<uint32_t> PickIndexBuffer::GetIndicesInPolygon(
+        const std::vector<Eigen::Vector2d> &polygon) const {
+    std::vector<uint32_t> indices;
+    if (polygon.size() < 3) {
+        return indices;
+    }
+
+    double min_y = polygon[0].y(), max_y = polygon[0].y();
+    for (auto &p : polygon) {
+        min_y = std::min(min_y, p.y());
+        max_y = std::max(max_y, p.y());
+    }
+    const int y0 = std::max(y_, int(std::floor(min_y)));
+    const int y1 = std::min(y_ + height_, int(std::ceil(max_y)) + 1);
+
+    std::vector<double> nodes;
+    for (int y = y0; y < y1; ++y) {
+        const double center_y = y + 0.5;
+        nodes.clear();
+        for (size_t i = 0; i < polygon.size(); ++i) {
+            const auto &a = polygon[i];
+            const auto &b = polygon[(i + 1) % polygon.size()];
+            if ((a.y() < center_y && b.y() >= center_y) ||
+                (b.y() < center_y && a.y() >= center_y)) {
+                nodes.push_back(a.x() + (center_y - a.y()) / (b.y() - a.y()) *
+                                                (b.x() - a.x()));
+            }
+        }
+        std::sort(nodes.begin(), nodes.end());
+
+        const uint32_t *row = indices_.data() + size_t(y - y_) * width_;
+        for (size_t i = 0; i + 1 < nodes.size(); i += 2) {
+            // The pixels with nodes[i] <= x + 0.5 < nodes[i + 1].
+            const int begin = std::max(x_, int(std::ceil(nodes[i] - 0.5)));
+            const int end =
+                    std::min(x_ + width_, int(std::ceil(nodes[i + 1] - 0.5)));
+            if (begin < end) {
+                indices.insert(indices.end(), row + (begin - x_),
+                               row + (end - x_));
+            }
+        }
+        if (indices.size() > indices_.size() / 4 + 4096) {
+            SortUnique(indices);
+        }
+    }
+    SortUnique(indices);
+    return indices;
+}
+
+uint32_t PickIndexBuffer::GetNearestIndex(int x, int y, int radius) const {
+    std::unordered_map<uint32_t, float> scores;
+    for (int py = y - radius; py < y + radius; ++py) {
+        for (int px = x - radius; px < x + radius; ++px) {
+            const uint32_t index = GetIndex(px, py);
+            if (index != kNoIndex) {
+                const float dist = std::sqrt(
+                        float((px - x) * (px - x) + (py - y) * (py - y)));
+                scores[index] += float(radius) - dist;
+            }
+        }
+    }
+
+    // Scores are (radius - dist), and since the pixels are taken from a
+    // square, a score can be negative.
+    uint32_t best_index = kNoIndex;
+    float best_score = -1e30f;
+    for (auto &index_score : scores) {
+        if (index_score.second > best_score ||
+            (index_score.second == best_score &&
+             index_score.first < best_index)) {
+            best_score = index_score.second;
+            best_index = index_score.first;
+        }
+    }
+    return best_index;
+}
+
+}  // namespace visualization
+}  // namespace open3d
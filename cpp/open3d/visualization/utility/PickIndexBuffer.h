@@ -0,0 +1,91 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <cstdint>
+#include <vector>
+
+namespace open3d {
+namespace visualization {
+
+/// \class PickIndexBuffer
+///
+/// \brief Point indices read back from a region of a picking render, in
+/// which each point is drawn with a color that encodes its index.
+///
+/// The legacy VisualizerWithVertexSelection and the GUI
+/// PickPointsInteractor encode the indices differently, so the buffer holds
+/// the decoded indices. Pixels are addressed in the coordinates of the
+/// window, and the region starts at pixel (x, y).
+class PickIndexBuffer {
+public:
+    static constexpr uint32_t kNoIndex = 0xffffffff;
+
+    PickIndexBuffer() {}
+    /// Creates a region with no index at any pixel.
+    PickIndexBuffer(int x, int y, int width, int height);
+
+    int GetX() const { return x_; }
+    int GetY() const { return y_; }
+    int GetWidth() const { return width_; }
+    int GetHeight() const { return height_; }
+
+    /// Returns the index at pixel (x, y), or kNoIndex if the pixel is outside
+    /// the region.
+    uint32_t GetIndex(int x, int y) const;
+    /// Sets the index at pixel (x, y), which must be inside the region.
+    void SetIndex(int x, int y, uint32_t index);
+
+    /// Returns the sorted unique indices in the rectangle.
+    std::vector<uint32_t> GetIndicesInRect(int x,
+                                           int y,
+                                           int width,
+                                           int height) const;
+
+    /// Returns the sorted unique indices of the pixels whose centers are
+    /// inside the polygon by the even-odd rule. Each row is filled between
+    /// the crossings of the polygon edges, so only the pixels of the bounding
+    /// box of the polygon are visited.
+    std::vector<uint32_t> GetIndicesInPolygon(
+            const std::vector<Eigen::Vector2d>& polygon) const;
+
+    /// Returns the index nearest to pixel (x, y) within \p radius, where
+    /// each pixel of an index scores (radius - distance). Returns kNoIndex if
+    /// there is no index around.
+    uint32_t GetNearestIndex(int x, int y, int radius) const;
+
+private:
+    int x_ = 0;
+    int y_ = 0;
+    int width_ = 0;
+    int height_ = 0;
+    std::vector<uint32_t> indices_;
+};
+
+}  // namespace visualization
+}  // namespace open3d
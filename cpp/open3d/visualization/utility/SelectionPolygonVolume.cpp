@@ -28,13 +28,213 @@
 
 #include <json/json.h>
 
+#include <algorithm>
+#include <cmath>
+
+#include "open3d/core/CoreUtil.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
+#include "open3d/t/geometry/PointCloud.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace visualization {
 
+namespace {
+
+/// Number of points tested per parallel task.
+constexpr int64_t kCropChunkSize = 1 << 14;
+
+/// Number of cells along each side of the polygon raster.
+constexpr int kPolygonGridSize = 64;
+
+/// Indices of the in-plane axes u, v and of the orthogonal axis w.
+void GetPolygonAxes(const std::string &orthogonal_axis,
+                    int &u,
+                    int &v,
+                    int &w) {
+    if (orthogonal_axis == "x" || orthogonal_axis == "X") {
+        u = 1;
+        v = 2;
+        w = 0;
+    } else if (orthogonal_axis == "y" || orthogonal_axis == "Y") {
+        u = 0;
+        v = 2;
+        w = 1;
+    } else {
+        u = 0;
+        v = 1;
+        w = 2;
+    }
+}
+
+/// \class ProjectedPolygon
+///
+/// The bounding polygon projected on the (u, v) plane, with a raster of its
+/// bounding box. The cells that no edge touches are entirely inside or outside
+/// the polygon, so that their points are classified without the edge loop.
+class ProjectedPolygon {
+public:
+    ProjectedPolygon(const std::vector<Eigen::Vector3d> &polygon, int u, int v)
+        : min_u_(polygon[0](u)),
+          max_u_(polygon[0](u)),
+          min_v_(polygon[0](v)),
+          max_v_(polygon[0](v)) {
+        for (size_t i = 0; i < polygon.size(); i++) {
+            size_t j = (i + 1) % polygon.size();
+            u0_.push_back(polygon[i](u));
+            v0_.push_back(polygon[i](v));
+            u1_.push_back(polygon[j](u));
+            v1_.push_back(polygon[j](v));
+            min_u_ = std::min(min_u_, polygon[i](u));
+            max_u_ = std::max(max_u_, polygon[i](u));
+            min_v_ = std::min(min_v_, polygon[i](v));
+            max_v_ = std::max(max_v_, polygon[i](v));
+        }
+        // Points this close to an edge may be classified either way by the
+        // rounding of ContainsExact(), so cells this close count as touched.
+        double magnitude = std::max({std::abs(min_u_), std::abs(max_u_),
+                                     std::abs(min_v_), std::abs(max_v_)});
+        margin_ = std::max(
+                1e-9 * (magnitude + (max_u_ - min_u_) + (max_v_ - min_v_)),
+                1e-12);
+        min_u_ -= margin_;
+        max_u_ += margin_;
+        min_v_ -= margin_;
+        max_v_ += margin_;
+        cell_u_ = (max_u_ - min_u_) / kPolygonGridSize;
+        cell_v_ = (max_v_ - min_v_) / kPolygonGridSize;
+        BuildGrid();
+    }
+
+    /// Returns true if (pu, pv) is inside the polygon, by the even-odd rule.
+    bool Contains(double pu, double pv) const {
+        // Outside of the bounding box, including NaN coordinates.
+        if (!(pu >= min_u_ && pu <= max_u_ && pv >= min_v_ && pv <= max_v_)) {
+            return false;
+        }
+        int cu = std::min(int((pu - min_u_) / cell_u_), kPolygonGridSize - 1);
+        int cv = std::min(int((pv - min_v_) / cell_v_), kPolygonGridSize - 1);
+        int8_t cell = grid_[cv * kPolygonGridSize + cu];
+        return cell == kTouched ? ContainsExact(pu, pv) : cell == kInside;
+    }
+
+private:
+    /// Counts the edges that cross the line v = pv left of pu. The crossings
+    /// are computed for all the edges without branches, so that the loop
+    /// vectorizes, and only counted for the edges that span pv.
+    bool ContainsExact(double pu, double pv) const {
+        int count = 0;
+        for (size_t i = 0; i < u0_.size(); i++) {
+            bool spans = (v0_[i] < pv && v1_[i] >= pv) ||
+                         (v1_[i] < pv && v0_[i] >= pv);
+            double node = u0_[i] + (pv - v0_[i]) / (v1_[i] - v0_[i]) *
+                                           (u1_[i] - u0_[i]);
+            count += spans & (node < pu);
+        }
+        return count % 2 == 1;
+    }
+
+    /// Marks the cells touched by an edge, then classifies the others by
+    /// their centers.
+    void BuildGrid() {
+        grid_.assign(kPolygonGridSize * kPolygonGridSize, kUnknown);
+        for (size_t i = 0; i < u0_.size(); i++) {
+            int cu0 = CellIndex(std::min(u0_[i], u1_[i]) - margin_, min_u_,
+                                cell_u_);
+            int cu1 = CellIndex(std::max(u0_[i], u1_[i]) + margin_, min_u_,
+                                cell_u_);
+            int cv0 = CellIndex(std::min(v0_[i], v1_[i]) - margin_, min_v_,
+                                cell_v_);
+            int cv1 = CellIndex(std::max(v0_[i], v1_[i]) + margin_, min_v_,
+                                cell_v_);
+            for (int cv = cv0; cv <= cv1; cv++) {
+                for (int cu = cu0; cu <= cu1; cu++) {
+                    if (EdgeTouchesCell(i, cu, cv)) {
+                        grid_[cv * kPolygonGridSize + cu] = kTouched;
+                    }
+                }
+            }
+        }
+        for (int cv = 0; cv < kPolygonGridSize; cv++) {
+            for (int cu = 0; cu < kPolygonGridSize; cu++) {
+                int8_t &cell = grid_[cv * kPolygonGridSize + cu];
+                if (cell == kTouched) continue;
+                cell = ContainsExact(min_u_ + (cu + 0.5) * cell_u_,
+                                     min_v_ + (cv + 0.5) * cell_v_)
+                               ? kInside
+                               : kOutside;
+            }
+        }
+    }
+
+    static int CellIndex(double x, double min_x, double cell_size) {
+        return std::max(0, std::min(int(std::floor((x - min_x) / cell_size)),
+                                    kPolygonGridSize - 1));
+    }
+
+    /// Returns true if edge i is within margin_ of cell (cu, cv): the edge's
+    /// line separates no corner of the expanded cell from the others.
+    bool EdgeTouchesCell(size_t i, int cu, int cv) const {
+        double cell_min_u = min_u_ + cu * cell_u_ - margin_;
+        double cell_max_u = min_u_ + (cu + 1) * cell_u_ + margin_;
+        double cell_min_v = min_v_ + cv * cell_v_ - margin_;
+        double cell_max_v = min_v_ + (cv + 1) * cell_v_ + margin_;
+        double du = u1_[i] - u0_[i], dv = v1_[i] - v0_[i];
+        auto side = [&](double pu, double pv) {
+            return du * (pv - v0_[i]) - dv * (pu - u0_[i]);
+        };
+        double s0 = side(cell_min_u, cell_min_v);
+        double s1 = side(cell_max_u, cell_min_v);
+        double s2 = side(cell_min_u, cell_max_v);
+        double s3 = side(cell_max_u, cell_max_v);
+        return !((s0 > 0 && s1 > 0 && s2 > 0 && s3 > 0) ||
+                 (s0 < 0 && s1 < 0 && s2 < 0 && s3 < 0));
+    }
+
+    enum : int8_t { kUnknown = -1, kOutside = 0, kInside = 1, kTouched = 2 };
+
+    std::vector<double> u0_, v0_, u1_, v1_;
+    double min_u_, max_u_, min_v_, max_v_;
+    double margin_;
+    double cell_u_, cell_v_;
+    std::vector<int8_t> grid_;
+};
+
+/// Tests the \p num_points points at \p points, with 3 coordinates each,
+/// against the volume in parallel, and sets \p mask to 1 for those inside.
+template <typename scalar_t, typename mask_t>
+void ComputeInVolumeMask(const scalar_t *points,
+                         int64_t num_points,
+                         const ProjectedPolygon &polygon,
+                         int u,
+                         int v,
+                         int w,
+                         double axis_min,
+                         double axis_max,
+                         mask_t *mask,
+                         utility::ConsoleProgressBar *progress_bar) {
+    const int64_t num_chunks =
+            (num_points + kCropChunkSize - 1) / kCropChunkSize;
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int64_t c = 0; c < num_chunks; c++) {
+        const int64_t end = std::min(num_points, (c + 1) * kCropChunkSize);
+        for (int64_t k = c * kCropChunkSize; k < end; k++) {
+            const scalar_t *point = points + 3 * k;
+            double pw = point[w];
+            mask[k] = !(pw < axis_min || pw > axis_max) &&
+                      polygon.Contains(point[u], point[v]);
+        }
+        if (progress_bar != nullptr) {
+#pragma omp critical
+            { ++(*progress_bar); }
+        }
+    }
+}
+
+}  // namespace
+
 bool SelectionPolygonVolume::ConvertToJsonValue(Json::Value &value) const {
     Json::Value polygon_array;
     for (const auto &point : bounding_polygon_) {
@@ -122,50 +322,74 @@ SelectionPolygonVolume::CropTriangleMeshInPolygon(
     return input.SelectByIndex(CropInPolygon(input.vertices_));
 }
 
+t::geometry::PointCloud SelectionPolygonVolume::CropPointCloud(
+        const t::geometry::PointCloud &input) const {
+    return input.SelectByMask(GetPointMask(input));
+}
+
+core::Tensor SelectionPolygonVolume::GetPointMask(
+        const t::geometry::PointCloud &input) const {
+    const core::Tensor &points = input.GetPoints();
+    const core::Device device = points.GetDevice();
+    const int64_t num_points = points.GetLength();
+    if (orthogonal_axis_ == "" || bounding_polygon_.empty()) {
+        return core::Tensor::Zeros({num_points}, core::Dtype::Bool, device);
+    }
+    int u, v, w;
+    GetPolygonAxes(orthogonal_axis_, u, v, w);
+
+    if (device.GetType() == core::Device::DeviceType::CPU) {
+        const ProjectedPolygon polygon(bounding_polygon_, u, v);
+        const core::Tensor points_contiguous = points.Contiguous();
+        core::Tensor mask({num_points}, core::Dtype::Bool, device);
+        DISPATCH_FLOAT32_FLOAT64_DTYPE(points.GetDtype(), [&]() {
+            ComputeInVolumeMask(
+                    static_cast<const scalar_t *>(
+                            points_contiguous.GetDataPtr()),
+                    num_points, polygon, u, v, w, axis_min_, axis_max_,
+                    static_cast<bool *>(mask.GetDataPtr()), nullptr);
+        });
+        return mask;
+    }
+
+    // On other devices, the parity of the crossings is accumulated edge by
+    // edge with tensor operations.
+    const core::Tensor pu = points.IndexExtract(1, u);
+    const core::Tensor pv = points.IndexExtract(1, v);
+    const core::Tensor pw = points.IndexExtract(1, w);
+    core::Tensor inside =
+            core::Tensor::Zeros({num_points}, core::Dtype::Bool, device);
+    for (size_t i = 0; i < bounding_polygon_.size(); i++) {
+        size_t j = (i + 1) % bounding_polygon_.size();
+        double ui = bounding_polygon_[i](u), vi = bounding_polygon_[i](v);
+        double uj = bounding_polygon_[j](u), vj = bounding_polygon_[j](v);
+        // Horizontal edges span no line v = pv.
+        if (vi == vj) continue;
+        core::Tensor spans = vi < vj ? pv.Gt(vi).LogicalAnd(pv.Le(vj))
+                                     : pv.Gt(vj).LogicalAnd(pv.Le(vi));
+        core::Tensor node = pv.Sub(vi).Div(vj - vi).Mul(uj - ui).Add(ui);
+        inside.LogicalXor_(spans.LogicalAnd(node.Lt(pu)));
+    }
+    return inside.LogicalAnd(
+            pw.Lt(axis_min_).LogicalOr(pw.Gt(axis_max_)).LogicalNot());
+}
+
 std::vector<size_t> SelectionPolygonVolume::CropInPolygon(
         const std::vector<Eigen::Vector3d> &input) const {
     std::vector<size_t> output_index;
+    if (input.empty()) return output_index;
     int u, v, w;
-    if (orthogonal_axis_ == "x" || orthogonal_axis_ == "X") {
-        u = 1;
-        v = 2;
-        w = 0;
-    } else if (orthogonal_axis_ == "y" || orthogonal_axis_ == "Y") {
-        u = 0;
-        v = 2;
-        w = 1;
-    } else {
-        u = 0;
-        v = 1;
-        w = 2;
-    }
-    std::vector<double> nodes;
-    utility::ConsoleProgressBar progress_bar((int64_t)input.size(),
-                                             "Cropping geometry: ");
+    GetPolygonAxes(orthogonal_axis_, u, v, w);
+    const ProjectedPolygon polygon(bounding_polygon_, u, v);
+    const int64_t num_points = static_cast<int64_t>(input.size());
+    utility::ConsoleProgressBar progress_bar(
+            (num_points + kCropChunkSize - 1) / kCropChunkSize,
+            "Cropping geometry: ");
+    std::vector<uint8_t> mask(input.size());
+    ComputeInVolumeMask(input[0].data(), num_points, polygon, u, v, w,
+                        axis_min_, axis_max_, mask.data(), &progress_bar);
     for (size_t k = 0; k < input.size(); k++) {
-        ++progress_bar;
-        const auto &point = input[k];
-        if (point(w) < axis_min_ || point(w) > axis_max_) continue;
-        nodes.clear();
-        for (size_t i = 0; i < bounding_polygon_.size(); i++) {
-            size_t j = (i + 1) % bounding_polygon_.size();
-            if ((bounding_polygon_[i](v) < point(v) &&
-                 bounding_polygon_[j](v) >= point(v)) ||
-                (bounding_polygon_[j](v) < point(v) &&
-                 bounding_polygon_[i](v) >= point(v))) {
-                nodes.push_back(bounding_polygon_[i](u) +
-                                (point(v) - bounding_polygon_[i](v)) /
-                                        (bounding_polygon_[j](v) -
-                                         bounding_polygon_[i](v)) *
-                                        (bounding_polygon_[j](u) -
-                                         bounding_polygon_[i](u)));
-            }
-        }
-        std::sort(nodes.begin(), nodes.end());
-        auto loc = std::lower_bound(nodes.begin(), nodes.end(), point(u));
-        if (std::distance(nodes.begin(), loc) % 2 == 1) {
-            output_index.push_back(k);
-        }
+        if (mask[k]) output_index.push_back(k);
     }
     return output_index;
 }
@@ -31,6 +31,7 @@
 #include <string>
 #include <vector>
 
+#include "open3d/core/Tensor.h"
 #include "open3d/utility/IJsonConvertible.h"
 
 namespace open3d {
@@ -41,6 +42,12 @@ class PointCloud;
 class TriangleMesh;
 }  // namespace geometry
 
+namespace t {
+namespace geometry {
+class PointCloud;
+}  // namespace geometry
+}  // namespace t
+
 namespace visualization {
 
 /// \class SelectionPolygonVolume
@@ -63,6 +70,19 @@ public:
     /// \param input The input triangle mesh.
     std::shared_ptr<geometry::TriangleMesh> CropTriangleMesh(
             const geometry::TriangleMesh &input) const;
+    /// Function to crop a tensor point cloud, on its device.
+    ///
+    /// \param input The input point cloud.
+    t::geometry::PointCloud CropPointCloud(
+            const t::geometry::PointCloud &input) const;
+    /// Function to compute which points of a tensor point cloud are inside
+    /// the volume.
+    ///
+    /// CPU point clouds are tested in double precision, as the legacy point
+    /// clouds, and CUDA point clouds in the dtype of their points.
+    /// \param input The input point cloud.
+    /// \return Bool tensor of shape {n,} on the device of \p input.
+    core::Tensor GetPointMask(const t::geometry::PointCloud &input) const;
 
 private:
     std::shared_ptr<geometry::PointCloud> CropPointCloudInPolygon(
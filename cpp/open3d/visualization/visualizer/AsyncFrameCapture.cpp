@@ -0,0 +1,291 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/visualization/visualizer/AsyncFrameCapture.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include "open3d/geometry/Image.h"
+#include "open3d/io/ImageIO.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace visualization {
+
+namespace {
+
+size_t FrameBytes(const AsyncFrameCapture::FrameRequest &request) {
+    size_t bytes_per_pixel =
+            request.type_ == AsyncFrameCapture::FrameType::Color ? 3 : 4;
+    return size_t(request.width_) * size_t(request.height_) * bytes_per_pixel;
+}
+
+}  // unnamed namespace
+
+AsyncFrameCapture::AsyncFrameCapture(int num_buffers /* = 3*/,
+                                     int num_workers /* = 0*/) {
+    slots_.resize(std::max(num_buffers, 2));
+    if (num_workers <= 0) {
+        // Leave one core to the render thread.
+        int hardware_threads = int(std::thread::hardware_concurrency());
+        num_workers = std::min(std::max(hardware_threads - 1, 1), 4);
+    }
+    num_workers_ = size_t(num_workers);
+    // Bound the number of frames held in memory when encoding is slower
+    // than rendering.
+    max_queued_jobs_ = 2 * num_workers_ + slots_.size();
+}
+
+AsyncFrameCapture::~AsyncFrameCapture() {
+    for (const auto &slot : slots_) {
+        if (slot.busy_ || slot.pbo_ != 0) {
+            utility::LogWarning(
+                    "AsyncFrameCapture destroyed without Release(), pending "
+                    "frames are dropped.");
+            break;
+        }
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    job_available_.notify_all();
+    for (auto &worker : workers_) {
+        worker.join();
+    }
+}
+
+void AsyncFrameCapture::Capture(const FrameRequest &request) {
+    if (request.width_ <= 0 || request.height_ <= 0) {
+        utility::LogWarning("AsyncFrameCapture: invalid frame size {}x{}.",
+                            request.width_, request.height_);
+        return;
+    }
+    Slot &slot = slots_[next_slot_];
+    next_slot_ = (next_slot_ + 1) % slots_.size();
+    if (slot.busy_) {
+        Retrieve(slot);
+    }
+
+    size_t bytes = FrameBytes(request);
+    if (slot.pbo_ == 0) {
+        glGenBuffers(1, &slot.pbo_);
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.pbo_);
+    if (slot.capacity_ != bytes) {
+        glBufferData(GL_PIXEL_PACK_BUFFER, bytes, NULL, GL_STREAM_READ);
+        slot.capacity_ = bytes;
+    }
+    // With a pack buffer bound, the last argument is an offset into it and
+    // glReadPixels returns as soon as the copy has been queued.
+    if (request.type_ == FrameType::Color) {
+        glReadPixels(0, 0, request.width_, request.height_, GL_RGB,
+                     GL_UNSIGNED_BYTE, 0);
+    } else {
+        glReadPixels(0, 0, request.width_, request.height_,
+                     GL_DEPTH_COMPONENT, GL_FLOAT, 0);
+    }
+    slot.fence_ = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    slot.request_ = request;
+    slot.busy_ = true;
+}
+
+void AsyncFrameCapture::Flush() {
+    // Retrieve the oldest slot first so that frames reach the workers in
+    // capture order.
+    for (size_t i = 0; i < slots_.size(); i++) {
+        Slot &slot = slots_[(next_slot_ + i) % slots_.size()];
+        if (slot.busy_) {
+            Retrieve(slot);
+        }
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    job_finished_.wait(lock, [this]() {
+        return jobs_.empty() && num_running_jobs_ == 0;
+    });
+}
+
+void AsyncFrameCapture::Release() {
+    Flush();
+    for (auto &slot : slots_) {
+        if (slot.pbo_ != 0) {
+            glDeleteBuffers(1, &slot.pbo_);
+        }
+        slot = Slot();
+    }
+    next_slot_ = 0;
+}
+
+void AsyncFrameCapture::Retrieve(Slot &slot) {
+    GLenum status = GL_TIMEOUT_EXPIRED;
+    while (status == GL_TIMEOUT_EXPIRED) {
+        status = glClientWaitSync(slot.fence_, GL_SYNC_FLUSH_COMMANDS_BIT,
+                                  GLuint64(1000000000));
+    }
+    glDeleteSync(slot.fence_);
+    slot.fence_ = nullptr;
+    slot.busy_ = false;
+    if (status == GL_WAIT_FAILED) {
+        utility::LogWarning("AsyncFrameCapture: waiting for readback failed.");
+        return;
+    }
+
+    Job job;
+    job.request_ = std::move(slot.request_);
+    job.data_.resize(slot.capacity_);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.pbo_);
+    const void *mapped = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0,
+                                          slot.capacity_, GL_MAP_READ_BIT);
+    if (mapped == nullptr) {
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        utility::LogWarning("AsyncFrameCapture: failed to map pixel buffer.");
+        return;
+    }
+    memcpy(job.data_.data(), mapped, slot.capacity_);
+    glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    Submit(std::move(job));
+}
+
+void AsyncFrameCapture::Submit(Job &&job) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (workers_.empty()) {
+        for (size_t i = 0; i < num_workers_; i++) {
+            workers_.emplace_back(&AsyncFrameCapture::WorkerLoop, this);
+        }
+    }
+    job_finished_.wait(lock,
+                       [this]() { return jobs_.size() < max_queued_jobs_; });
+    jobs_.push_back(std::move(job));
+    lock.unlock();
+    job_available_.notify_one();
+}
+
+void AsyncFrameCapture::WorkerLoop() {
+    while (true) {
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            job_available_.wait(lock,
+                                [this]() { return stop_ || !jobs_.empty(); });
+            if (jobs_.empty()) {
+                return;
+            }
+            job = std::move(jobs_.front());
+            jobs_.pop_front();
+            num_running_jobs_++;
+        }
+        job_finished_.notify_all();
+        try {
+            ProcessJob(job);
+        } catch (const std::exception &e) {
+            utility::LogWarning("AsyncFrameCapture: {}", e.what());
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            num_running_jobs_--;
+        }
+        job_finished_.notify_all();
+    }
+}
+
+void AsyncFrameCapture::ProcessJob(const Job &job) {
+    const FrameRequest &request = job.request_;
+    const int width = request.width_;
+    const int height = request.height_;
+
+    // glReadPixels get the screen in a vertically flipped manner
+    // Thus we should flip it back.
+    auto image_ptr = std::make_shared<geometry::Image>();
+    if (request.type_ == FrameType::Color) {
+        image_ptr->Prepare(width, height, 3, 1);
+        int bytes_per_line = image_ptr->BytesPerLine();
+        for (int i = 0; i < height; i++) {
+            memcpy(image_ptr->data_.data() + bytes_per_line * i,
+                   job.data_.data() + bytes_per_line * (height - i - 1),
+                   bytes_per_line);
+        }
+        if (!request.filename_.empty()) {
+            utility::LogDebug("[Visualizer] Screen capture to {}",
+                              request.filename_);
+            io::WriteImage(request.filename_, *image_ptr);
+        }
+        if (request.callback_) {
+            request.callback_(image_ptr);
+        }
+        return;
+    }
+
+    // Convert the depth buffer to the correct depth value.
+    const double z_near = request.z_near_;
+    const double z_far = request.z_far_;
+    const bool write_png = !request.filename_.empty();
+    geometry::Image png_image;
+    image_ptr->Prepare(width, height, 1, 4);
+    if (write_png) {
+        png_image.Prepare(width, height, 1, 2);
+    }
+    for (int i = 0; i < height; i++) {
+        const float *p_depth = (const float *)(job.data_.data() +
+                                               image_ptr->BytesPerLine() *
+                                                       (height - i - 1));
+        float *p_image = (float *)(image_ptr->data_.data() +
+                                   image_ptr->BytesPerLine() * i);
+        uint16_t *p_png = write_png ? (uint16_t *)(png_image.data_.data() +
+                                                   png_image.BytesPerLine() * i)
+                                    : nullptr;
+        for (int j = 0; j < width; j++) {
+            if (p_depth[j] == 1.0) {
+                continue;
+            }
+            double z_depth =
+                    2.0 * z_near * z_far /
+                    (z_far + z_near -
+                     (2.0 * (double)p_depth[j] - 1.0) * (z_far - z_near));
+            p_image[j] = (float)z_depth;
+            if (write_png) {
+                p_png[j] = (uint16_t)std::min(
+                        std::round(request.depth_scale_ * z_depth),
+                        (double)INT16_MAX);
+            }
+        }
+    }
+    if (write_png) {
+        utility::LogDebug("[Visualizer] Depth capture to {}",
+                          request.filename_);
+        io::WriteImage(request.filename_, png_image);
+    }
+    if (request.callback_) {
+        request.callback_(image_ptr);
+    }
+}
+
+}  // namespace visualization
+}  // namespace open3d
@@ -0,0 +1,153 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+// Avoid warning caused by redefinition of APIENTRY macro
+// defined also in glfw3.h
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#include <GL/glew.h>
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace open3d {
+
+namespace geometry {
+class Image;
+}  // namespace geometry
+
+namespace visualization {
+
+/// \class AsyncFrameCapture
+///
+/// \brief Pipelined screen and depth readback through pixel buffer objects.
+///
+/// Each capture issues glReadPixels() into one of a ring of pixel pack
+/// buffers and returns without waiting for the GPU. A buffer is only mapped
+/// when its slot comes around again (or in Flush()), by which time the copy
+/// has normally completed. Mapped frames are flipped, converted and written
+/// to disk on a small pool of worker threads, so that encoding overlaps the
+/// rendering of the next frames.
+///
+/// Capture(), Flush() and Release() issue OpenGL calls and must be called
+/// with the owning context current.
+class AsyncFrameCapture {
+public:
+    enum class FrameType {
+        /// 8 bit RGB color buffer.
+        Color = 0,
+        /// Depth buffer, linearized to metric depth.
+        Depth = 1,
+    };
+
+    /// Callback receiving a finished frame. It is called from a worker
+    /// thread. Color frames are 3 channel uint8 images, depth frames are
+    /// single channel float images (see Visualizer::CaptureDepthFloatBuffer).
+    typedef std::function<void(std::shared_ptr<geometry::Image>)>
+            FrameCallback;
+
+    struct FrameRequest {
+        FrameType type_ = FrameType::Color;
+        int width_ = 0;
+        int height_ = 0;
+        /// Near and far clipping planes used to linearize depth frames.
+        double z_near_ = 0.0;
+        double z_far_ = 0.0;
+        /// Scale applied when writing a depth frame as a 16 bit image.
+        double depth_scale_ = 1000.0;
+        /// If not empty, the frame is written to this file.
+        std::string filename_;
+        /// If set, the frame is passed to this callback.
+        FrameCallback callback_;
+    };
+
+public:
+    /// \param num_buffers Number of pixel pack buffers in the ring (at
+    /// least 2).
+    /// \param num_workers Number of encoding threads. 0 picks a default
+    /// based on the hardware concurrency.
+    explicit AsyncFrameCapture(int num_buffers = 3, int num_workers = 0);
+    ~AsyncFrameCapture();
+    AsyncFrameCapture(const AsyncFrameCapture &) = delete;
+    AsyncFrameCapture &operator=(const AsyncFrameCapture &) = delete;
+
+public:
+    /// Queue a readback of the current read framebuffer.
+    void Capture(const FrameRequest &request);
+    /// Retrieve all outstanding readbacks and wait until every queued frame
+    /// has been processed.
+    void Flush();
+    /// Flush() and delete the pixel pack buffers.
+    void Release();
+
+private:
+    struct Slot {
+        GLuint pbo_ = 0;
+        size_t capacity_ = 0;
+        GLsync fence_ = nullptr;
+        bool busy_ = false;
+        FrameRequest request_;
+    };
+
+    struct Job {
+        FrameRequest request_;
+        std::vector<uint8_t> data_;
+    };
+
+    void Retrieve(Slot &slot);
+    void Submit(Job &&job);
+    void WorkerLoop();
+    static void ProcessJob(const Job &job);
+
+private:
+    std::vector<Slot> slots_;
+    size_t next_slot_ = 0;
+    size_t num_workers_ = 1;
+    size_t max_queued_jobs_ = 1;
+
+    std::vector<std::thread> workers_;
+    std::mutex mutex_;
+    std::condition_variable job_available_;
+    std::condition_variable job_finished_;
+    std::deque<Job> jobs_;
+    size_t num_running_jobs_ = 0;
+    bool stop_ = false;
+};
+
+}  // namespace visualization
+}  // namespace open3d
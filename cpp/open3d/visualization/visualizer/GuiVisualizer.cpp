@@ -26,6 +26,7 @@
 
 #include "open3d/visualization/visualizer/GuiVisualizer.h"
 
+#include <atomic>
 #include <random>
 
 #include "open3d/Open3DConfig.h"
@@ -353,6 +354,9 @@ struct GuiVisualizer::Impl {
     } settings_;
 
     rendering::TriangleMeshModel loaded_model_;
+    // Set to true to cancel the load in progress. Only accessed from the
+    // main thread; the loading thread holds its own reference.
+    std::shared_ptr<std::atomic<bool>> load_cancelled_;
 
     int app_menu_custom_items_index_ = -1;
     std::shared_ptr<gui::Menu> app_menu_;
@@ -893,9 +897,20 @@ bool GuiVisualizer::SetIBL(const char *path) {
 }
 
 void GuiVisualizer::LoadGeometry(const std::string &path) {
+    // A new load supersedes the one in progress, if any.
+    if (impl_->load_cancelled_) {
+        *impl_->load_cancelled_ = true;
+    }
+    auto cancelled = std::make_shared<std::atomic<bool>>(false);
+    impl_->load_cancelled_ = cancelled;
+
     auto progressbar = std::make_shared<gui::ProgressBar>();
     gui::Application::GetInstance().PostToMainThread(this, [this, path,
-                                                            progressbar]() {
+                                                            progressbar,
+                                                            cancelled]() {
+        if (*cancelled) {
+            return;
+        }
         auto &theme = GetTheme();
         auto loading_dlg = std::make_shared<gui::Dialog>("Loading");
         auto vert =
@@ -904,55 +919,73 @@ void GuiVisualizer::LoadGeometry(const std::string &path) {
         vert->AddChild(std::make_shared<gui::Label>(loading_text.c_str()));
         vert->AddFixed(theme.font_size);
         vert->AddChild(progressbar);
+        vert->AddFixed(theme.font_size);
+        auto cancel = std::make_shared<gui::Button>("Cancel");
+        cancel->SetOnClicked([this, cancelled]() {
+            *cancelled = true;
+            CloseDialog();
+        });
+        auto buttons = std::make_shared<gui::Horiz>();
+        buttons->AddStretch();
+        buttons->AddChild(cancel);
+        vert->AddChild(buttons);
         loading_dlg->AddChild(vert);
         ShowDialog(loading_dlg);
     });
 
-    gui::Application::GetInstance().RunInThread([this, path, progressbar]() {
-        auto UpdateProgress = [this, progressbar](float value) {
-            gui::Application::GetInstance().PostToMainThread(
-                    this,
-                    [progressbar, value]() { progressbar->SetValue(value); });
+    gui::Application::GetInstance().RunInThread([this, path, progressbar,
+                                                 cancelled]() {
+        // Only post to the main thread when the bar moves visibly, otherwise
+        // large files flood the event queue with redraws.
+        float last_progress = -1.0f;
+        auto UpdateProgress = [this, progressbar, cancelled,
+                               &last_progress](float value) -> bool {
+            if (value - last_progress >= 0.01f) {
+                last_progress = value;
+                gui::Application::GetInstance().PostToMainThread(
+                        this, [progressbar, value]() {
+                            progressbar->SetValue(value);
+                        });
+            }
+            return !*cancelled;
         };
 
-        // clear current model
-        impl_->loaded_model_.meshes_.clear();
-        impl_->loaded_model_.materials_.clear();
+        // The model is only handed over to impl_ on the main thread, so
+        // that the current scene stays intact while this one loads.
+        auto model = std::make_shared<rendering::TriangleMeshModel>();
 
         auto geometry_type = io::ReadFileGeometryType(path);
 
         bool model_success = false;
         if (geometry_type & io::CONTAINS_TRIANGLES) {
             try {
-                model_success = io::ReadTriangleModel(
-                        path, impl_->loaded_model_, false);
+                model_success = io::ReadTriangleModel(path, *model, false);
             } catch (...) {
                 model_success = false;
             }
         }
-        if (!model_success) {
+        if (!model_success && !*cancelled) {
             utility::LogInfo("{} appears to be a point cloud", path.c_str());
         }
 
         auto geometry = std::shared_ptr<geometry::Geometry3D>();
-        if (!model_success) {
+        if (!model_success && !*cancelled) {
             auto cloud = std::make_shared<geometry::PointCloud>();
             bool success = false;
             const float ioProgressAmount = 0.5f;
             try {
                 io::ReadPointCloudOption opt;
                 opt.update_progress = [ioProgressAmount,
-                                       UpdateProgress](double percent) -> bool {
-                    UpdateProgress(ioProgressAmount * float(percent / 100.0));
-                    return true;
+                                       &UpdateProgress](double percent) {
+                    return UpdateProgress(ioProgressAmount *
+                                          float(percent / 100.0));
                 };
                 success = io::ReadPointCloud(path, *cloud, opt);
             } catch (...) {
                 success = false;
             }
-            if (success) {
+            if (success && UpdateProgress(ioProgressAmount)) {
                 utility::LogInfo("Successfully read {}", path.c_str());
-                UpdateProgress(ioProgressAmount);
                 if (!cloud->HasNormals()) {
                     cloud->EstimateNormals();
                 }
@@ -960,25 +993,39 @@ void GuiVisualizer::LoadGeometry(const std::string &path) {
                 cloud->NormalizeNormals();
                 UpdateProgress(0.75f);
                 geometry = cloud;
-            } else {
+            } else if (!*cancelled) {
                 utility::LogWarning("Failed to read points {}", path.c_str());
-                cloud.reset();
             }
         }
 
+        if (*cancelled) {
+            utility::LogInfo("Cancelled loading {}", path.c_str());
+            return;
+        }
+
+        // The renderer is not thread-safe, so the GPU buffers are built by
+        // SetGeometry() on the main thread.
         if (model_success || geometry) {
             gui::Application::GetInstance().PostToMainThread(
-                    this, [this, model_success, geometry]() {
+                    this, [this, model, model_success, geometry, cancelled]() {
+                        if (*cancelled) {
+                            return;
+                        }
+                        impl_->loaded_model_ = std::move(*model);
                         SetGeometry(geometry, model_success);
                         CloseDialog();
                     });
         } else {
-            gui::Application::GetInstance().PostToMainThread(this, [this,
-                                                                    path]() {
-                CloseDialog();
-                auto msg = std::string("Could not load '") + path + "'.";
-                ShowMessageBox("Error", msg.c_str());
-            });
+            gui::Application::GetInstance().PostToMainThread(
+                    this, [this, path, cancelled]() {
+                        if (*cancelled) {
+                            return;
+                        }
+                        CloseDialog();
+                        auto msg =
+                                std::string("Could not load '") + path + "'.";
+                        ShowMessageBox("Error", msg.c_str());
+                    });
         }
     });
 }
@@ -83,6 +83,7 @@ enum MenuId {
     MENU_EXPORT_RGB,
     MENU_CLOSE,
     MENU_SETTINGS,
+    MENU_FRAME_STATISTICS,
     MENU_ACTIONS_BASE = 1000 /* this should be last */
 };
 
@@ -1372,12 +1373,22 @@ struct O3DVisualizer::Impl {
                                            : 0);
 #endif  // !GROUPS_USE_TREE
         flag |= (min_time_ != max_time_ ? DrawObjectTreeCell::FLAG_TIME : 0);
-        auto cell = std::make_shared<DrawObjectTreeCell>(
-                o.name.c_str(), o.group.c_str(), o.time, o.is_visible, flag,
-                [this, name = o.name](bool is_on) {
-                    ShowGeometry(name, is_on);
-                });
-        auto id = settings.geometries->AddItem(parent, cell);
+        // Scenes can have thousands of objects, so only create the cells
+        // of the rows that are actually shown.
+        auto create_cell = [this, name = o.name, group = o.group, time = o.time,
+                            flag]() -> std::shared_ptr<Widget> {
+            bool is_visible = true;
+            for (auto &obj : objects_) {
+                if (obj.name == name) {
+                    is_visible = obj.is_visible;
+                    break;
+                }
+            }
+            return std::make_shared<DrawObjectTreeCell>(
+                    name.c_str(), group.c_str(), time, is_visible, flag,
+                    [this, name](bool is_on) { ShowGeometry(name, is_on); });
+        };
+        auto id = settings.geometries->AddLazyItem(parent, create_cell);
         settings.object2itemid[o.name] = id;
     }
 
@@ -1647,6 +1658,8 @@ O3DVisualizer::O3DVisualizer(const std::string &title, int width, int height)
     auto actions_menu = std::make_shared<Menu>();
     actions_menu->AddItem("Show Settings", MENU_SETTINGS);
     actions_menu->SetChecked(MENU_SETTINGS, false);
+    actions_menu->AddItem("Show Frame Statistics", MENU_FRAME_STATISTICS);
+    actions_menu->SetChecked(MENU_FRAME_STATISTICS, false);
     menu->AddMenu("Actions", actions_menu);
     impl_->settings.actions_menu = actions_menu.get();
 
@@ -1664,6 +1677,14 @@ O3DVisualizer::O3DVisualizer(const std::string &title, int width, int height)
     SetOnMenuItemActivated(MENU_CLOSE, [this]() { this->impl_->OnClose(); });
     SetOnMenuItemActivated(MENU_SETTINGS,
                            [this]() { this->impl_->OnToggleSettings(); });
+    SetOnMenuItemActivated(MENU_FRAME_STATISTICS, [this]() {
+        bool show = !IsShowingFrameStatistics();
+        ShowFrameStatistics(show);
+        auto menubar = Application::GetInstance().GetMenubar();
+        if (menubar) {
+            menubar->SetChecked(MENU_FRAME_STATISTICS, show);
+        }
+    });
 
     impl_->ShowSettings(false, false);
 }
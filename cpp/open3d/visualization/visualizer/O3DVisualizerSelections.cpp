@@ -145,11 +145,21 @@ void O3DVisualizerSelections::UpdateSelectionGeometry() {
     }
 
     if (!points.empty()) {
+        // Copies one sphere per point rather than creating and appending a
+        // mesh per point, which lags on large selections.
+        auto sphere = geometry::TriangleMesh::CreateSphere(point_size_, 10);
+        const size_t n_vertices = sphere->vertices_.size();
         geometry::TriangleMesh spheres;
+        spheres.vertices_.reserve(points.size() * n_vertices);
+        spheres.triangles_.reserve(points.size() * sphere->triangles_.size());
         for (auto &p : points) {
-            auto ps = geometry::TriangleMesh::CreateSphere(point_size_, 10);
-            ps->Translate(p);
-            spheres += *ps;
+            const int offset = int(spheres.vertices_.size());
+            for (auto &v : sphere->vertices_) {
+                spheres.vertices_.push_back(v + p);
+            }
+            for (auto &t : sphere->triangles_) {
+                spheres.triangles_.push_back(t.array() + offset);
+            }
         }
         scene->AddGeometry(selection.name, &spheres, MakeMaterial());
         scene->GetScene()->GeometryShadows(selection.name, false, false);
@@ -28,10 +28,12 @@
 
 #include <zmq.hpp>
 
+#include "open3d/core/EigenConverter.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/io/rpc/MessageUtils.h"
 #include "open3d/io/rpc/Messages.h"
+#include "open3d/t/geometry/PointCloud.h"
 #include "open3d/visualization/gui/Application.h"
 #include "open3d/visualization/gui/Window.h"
 #include "open3d/visualization/rendering/Material.h"
@@ -42,6 +44,50 @@ using namespace open3d::utility;
 namespace open3d {
 namespace visualization {
 
+namespace {
+
+/// Creates a reply with the ErrorProcessingMessage status and \p str.
+std::shared_ptr<zmq::message_t> CreateErrorMsg(const std::string& str) {
+    auto status_err = messages::Status::ErrorProcessingMessage();
+    status_err.str += str;
+    msgpack::sbuffer sbuf;
+    messages::Reply reply{status_err.MsgId()};
+    msgpack::pack(sbuf, reply);
+    msgpack::pack(sbuf, status_err);
+    return std::shared_ptr<zmq::message_t>(
+            new zmq::message_t(sbuf.data(), sbuf.size()));
+}
+
+/// The vertex data of a PointCloud or TriangleMesh, which the updates modify.
+struct VertexData {
+    std::vector<Eigen::Vector3d>* vertices = nullptr;
+    /// The vertex attributes by name, e.g. "colors".
+    std::map<std::string, std::vector<Eigen::Vector3d>*> attributes;
+    /// The triangles of a TriangleMesh.
+    std::vector<Eigen::Vector3i>* triangles = nullptr;
+};
+
+VertexData GetVertexData(geometry::Geometry3D& geom) {
+    VertexData data;
+    if (geom.GetGeometryType() ==
+        geometry::Geometry::GeometryType::PointCloud) {
+        auto& pcd = static_cast<geometry::PointCloud&>(geom);
+        data.vertices = &pcd.points_;
+        data.attributes["normals"] = &pcd.normals_;
+        data.attributes["colors"] = &pcd.colors_;
+    } else if (geom.GetGeometryType() ==
+               geometry::Geometry::GeometryType::TriangleMesh) {
+        auto& mesh = static_cast<geometry::TriangleMesh&>(geom);
+        data.vertices = &mesh.vertices_;
+        data.attributes["normals"] = &mesh.vertex_normals_;
+        data.attributes["colors"] = &mesh.vertex_colors_;
+        data.triangles = &mesh.triangles_;
+    }
+    return data;
+}
+
+}  // namespace
+
 std::shared_ptr<zmq::message_t> Receiver::ProcessMessage(
         const messages::Request& req,
         const messages::SetMeshData& msg,
@@ -52,16 +98,39 @@ std::shared_ptr<zmq::message_t> Receiver::ProcessMessage(
 
     std::string errstr(":");
     if (!msg.data.CheckMessage(errstr)) {
-        auto status_err = messages::Status::ErrorProcessingMessage();
-        status_err.str += errstr;
-        msgpack::sbuffer sbuf;
-        messages::Reply reply{status_err.MsgId()};
-        msgpack::pack(sbuf, reply);
-        msgpack::pack(sbuf, status_err);
-        return std::shared_ptr<zmq::message_t>(
-                new zmq::message_t(sbuf.data(), sbuf.size()));
+        return CreateErrorMsg(errstr);
     }
 
+    // The arrays are converted through tensors, which view the data of arrays
+    // sent as extra frames without a copy.
+    auto ToVector3dVector = [this](const messages::Array& array) {
+        return core::eigen_converter::TensorToEigenVector3dVector(
+                GetArrayTensor(array));
+    };
+
+    // Converts the vertex attribute \p name of shape {N, 3} if it is valid.
+    auto SetVertexAttribute = [&](const std::string& name,
+                                  std::vector<Eigen::Vector3d>& attribute) {
+        if (!msg.data.vertex_attributes.count(name)) {
+            return;
+        }
+        errstr = "";
+        const auto& attr_arr = msg.data.vertex_attributes.at(name);
+        if (!attr_arr.CheckType(
+                    {messages::TypeStr<float>(), messages::TypeStr<double>()},
+                    errstr)) {
+            errstr = "Ignoring " + name + ". " + name +
+                     " have wrong data type:" + errstr;
+            LogInfo(errstr.c_str());
+        } else if (!attr_arr.CheckShape({-1, 3}, errstr)) {
+            errstr = "Ignoring " + name + ". " + name +
+                     " have wrong shape:" + errstr;
+            LogInfo(errstr.c_str());
+        } else {
+            attribute = ToVector3dVector(attr_arr);
+        }
+    };
+
     if (msg.data.faces.CheckNonEmpty()) {
         // create a TriangleMesh
         auto mesh = std::make_shared<geometry::TriangleMesh>();
@@ -74,98 +143,11 @@ std::shared_ptr<zmq::message_t> Receiver::ProcessMessage(
                      errstr;
             LogInfo(errstr.c_str());
         } else {
-            mesh->vertices_.resize(msg.data.vertices.shape[0]);
-            if (msg.data.vertices.type == messages::TypeStr<float>()) {
-                const float* ptr = msg.data.vertices.Ptr<float>();
-                for (int64_t i = 0; i < msg.data.vertices.shape[0]; ++i) {
-                    mesh->vertices_[i].x() = ptr[0];
-                    mesh->vertices_[i].y() = ptr[1];
-                    mesh->vertices_[i].z() = ptr[2];
-                    ptr += 3;
-                }
-            }
-            if (msg.data.vertices.type == messages::TypeStr<double>()) {
-                const double* ptr = msg.data.vertices.Ptr<double>();
-                for (int64_t i = 0; i < msg.data.vertices.shape[0]; ++i) {
-                    mesh->vertices_[i].x() = ptr[0];
-                    mesh->vertices_[i].y() = ptr[1];
-                    mesh->vertices_[i].z() = ptr[2];
-                    ptr += 3;
-                }
-            }
-        }
-
-        errstr = "";
-        if (msg.data.vertex_attributes.count("normals")) {
-            const auto& attr_arr = msg.data.vertex_attributes.at("normals");
-            auto& mesh_attr = mesh->vertex_normals_;
-            if (!attr_arr.CheckType({messages::TypeStr<float>(),
-                                     messages::TypeStr<double>()},
-                                    errstr)) {
-                errstr = "Ignoring normals. normals have wrong data type:" +
-                         errstr;
-                LogInfo(errstr.c_str());
-            } else if (!attr_arr.CheckShape({-1, 3}, errstr)) {
-                errstr = "Ignoring normals. normals have wrong shape:" + errstr;
-                LogInfo(errstr.c_str());
-            } else {
-                mesh_attr.resize(attr_arr.shape[0]);
-                if (attr_arr.type == messages::TypeStr<float>()) {
-                    const float* ptr = attr_arr.Ptr<float>();
-                    for (int64_t i = 0; i < attr_arr.shape[0]; ++i) {
-                        mesh_attr[i].x() = ptr[0];
-                        mesh_attr[i].y() = ptr[1];
-                        mesh_attr[i].z() = ptr[2];
-                        ptr += 3;
-                    }
-                }
-                if (attr_arr.type == messages::TypeStr<double>()) {
-                    const double* ptr = attr_arr.Ptr<double>();
-                    for (int64_t i = 0; i < attr_arr.shape[0]; ++i) {
-                        mesh_attr[i].x() = ptr[0];
-                        mesh_attr[i].y() = ptr[1];
-                        mesh_attr[i].z() = ptr[2];
-                        ptr += 3;
-                    }
-                }
-            }
+            mesh->vertices_ = ToVector3dVector(msg.data.vertices);
         }
 
-        errstr = "";
-        if (msg.data.vertex_attributes.count("colors")) {
-            const auto& attr_arr = msg.data.vertex_attributes.at("colors");
-            auto& mesh_attr = mesh->vertex_colors_;
-            if (!attr_arr.CheckType({messages::TypeStr<float>(),
-                                     messages::TypeStr<double>()},
-                                    errstr)) {
-                errstr = "Ignoring colors. colors have wrong data type:" +
-                         errstr;
-                LogInfo(errstr.c_str());
-            } else if (!attr_arr.CheckShape({-1, 3}, errstr)) {
-                errstr = "Ignoring colors. colors have wrong shape:" + errstr;
-                LogInfo(errstr.c_str());
-            } else {
-                mesh_attr.resize(attr_arr.shape[0]);
-                if (attr_arr.type == messages::TypeStr<float>()) {
-                    const float* ptr = attr_arr.Ptr<float>();
-                    for (int64_t i = 0; i < attr_arr.shape[0]; ++i) {
-                        mesh_attr[i].x() = ptr[0];
-                        mesh_attr[i].y() = ptr[1];
-                        mesh_attr[i].z() = ptr[2];
-                        ptr += 3;
-                    }
-                }
-                if (attr_arr.type == messages::TypeStr<double>()) {
-                    const double* ptr = attr_arr.Ptr<double>();
-                    for (int64_t i = 0; i < attr_arr.shape[0]; ++i) {
-                        mesh_attr[i].x() = ptr[0];
-                        mesh_attr[i].y() = ptr[1];
-                        mesh_attr[i].z() = ptr[2];
-                        ptr += 3;
-                    }
-                }
-            }
-        }
+        SetVertexAttribute("normals", mesh->vertex_normals_);
+        SetVertexAttribute("colors", mesh->vertex_colors_);
 
         errstr = "";
         if (!msg.data.faces.CheckShape({-1, 3}, errstr)) {
@@ -178,25 +160,9 @@ std::shared_ptr<zmq::message_t> Receiver::ProcessMessage(
             errstr = "Ignoring faces. Triangles have wrong data type:" + errstr;
             LogInfo(errstr.c_str());
         } else {
-            mesh->triangles_.resize(msg.data.faces.shape[0]);
-            if (msg.data.faces.type == messages::TypeStr<int32_t>()) {
-                const int32_t* ptr = msg.data.faces.Ptr<int32_t>();
-                for (int64_t i = 0; i < msg.data.faces.shape[0]; ++i) {
-                    mesh->triangles_[i].x() = ptr[0];
-                    mesh->triangles_[i].y() = ptr[1];
-                    mesh->triangles_[i].z() = ptr[2];
-                    ptr += 3;
-                }
-            }
-            if (msg.data.faces.type == messages::TypeStr<int64_t>()) {
-                const int64_t* ptr = msg.data.faces.Ptr<int64_t>();
-                for (int64_t i = 0; i < msg.data.faces.shape[0]; ++i) {
-                    mesh->triangles_[i].x() = static_cast<int>(ptr[0]);
-                    mesh->triangles_[i].y() = static_cast<int>(ptr[1]);
-                    mesh->triangles_[i].z() = static_cast<int>(ptr[2]);
-                    ptr += 3;
-                }
-            }
+            mesh->triangles_ =
+                    core::eigen_converter::TensorToEigenVector3iVector(
+                            GetArrayTensor(msg.data.faces));
         }
 
         SetGeometry(mesh, msg.path, msg.time, msg.layer);
@@ -211,115 +177,280 @@ std::shared_ptr<zmq::message_t> Receiver::ProcessMessage(
                      errstr;
             LogInfo(errstr.c_str());
         } else {
-            pcd->points_.resize(msg.data.vertices.shape[0]);
-            if (msg.data.vertices.type == messages::TypeStr<float>()) {
-                const float* ptr = msg.data.vertices.Ptr<float>();
-                for (int64_t i = 0; i < msg.data.vertices.shape[0]; ++i) {
-                    pcd->points_[i].x() = ptr[0];
-                    pcd->points_[i].y() = ptr[1];
-                    pcd->points_[i].z() = ptr[2];
-                    ptr += 3;
-                }
+            pcd->points_ = ToVector3dVector(msg.data.vertices);
+            SetVertexAttribute("normals", pcd->normals_);
+            SetVertexAttribute("colors", pcd->colors_);
+        }
+        SetGeometry(pcd, msg.path, msg.time, msg.layer);
+    }
+
+    return CreateStatusOKMsg();
+}
+
+std::shared_ptr<zmq::message_t> Receiver::ProcessMessage(
+        const messages::Request& req,
+        const messages::AppendMeshData& msg,
+        const MsgpackObject& obj) {
+    auto geom = GetGeometry(msg.path);
+    if (!geom) {
+        return CreateErrorMsg(": no mesh data at " + msg.path);
+    }
+
+    // Converts and checks everything before modifying the geometry.
+    std::string errstr(":");
+    std::vector<Eigen::Vector3d> vertices;
+    if (msg.data.vertices.CheckNonEmpty() &&
+        !GetVector3dVector(msg.data.vertices, vertices, errstr)) {
+        return CreateErrorMsg(errstr);
+    }
+    std::map<std::string, std::vector<Eigen::Vector3d>> attributes;
+    for (const auto& item : msg.data.vertex_attributes) {
+        if (!GetVector3dVector(item.second, attributes[item.first], errstr)) {
+            return CreateErrorMsg(errstr);
+        }
+    }
+    std::vector<Eigen::Vector3i> triangles;
+    if (msg.data.faces.CheckNonEmpty()) {
+        if (!msg.data.faces.CheckShape({-1, 3}, errstr) ||
+            !msg.data.faces.CheckType({messages::TypeStr<int32_t>(),
+                                       messages::TypeStr<int64_t>()},
+                                      errstr)) {
+            return CreateErrorMsg(errstr);
+        }
+        triangles = core::eigen_converter::TensorToEigenVector3iVector(
+                GetArrayTensor(msg.data.faces));
+    }
+
+    {
+        const std::lock_guard<std::mutex> lock(*geometry_mutex_);
+        VertexData data = GetVertexData(*geom);
+        if (!data.vertices) {
+            return CreateErrorMsg(": unsupported geometry at " + msg.path);
+        }
+        if (!triangles.empty() && !data.triangles) {
+            return CreateErrorMsg(": no triangles at " + msg.path);
+        }
+        // The attributes of the existing vertices must be continued.
+        for (const auto& item : data.attributes) {
+            bool has_attribute = !item.second->empty();
+            size_t size = attributes.count(item.first)
+                                  ? attributes[item.first].size()
+                                  : 0;
+            if (!vertices.empty() && has_attribute &&
+                size != vertices.size()) {
+                return CreateErrorMsg(": " + item.first +
+                                      " must match the appended vertices");
             }
-            if (msg.data.vertices.type == messages::TypeStr<double>()) {
-                const double* ptr = msg.data.vertices.Ptr<double>();
-                for (int64_t i = 0; i < msg.data.vertices.shape[0]; ++i) {
-                    pcd->points_[i].x() = ptr[0];
-                    pcd->points_[i].y() = ptr[1];
-                    pcd->points_[i].z() = ptr[2];
-                    ptr += 3;
-                }
+        }
+        const size_t num_vertices = data.vertices->size() + vertices.size();
+        for (const Eigen::Vector3i& triangle : triangles) {
+            if (triangle.minCoeff() < 0 ||
+                size_t(triangle.maxCoeff()) >= num_vertices) {
+                return CreateErrorMsg(": triangle indices out of range");
             }
+        }
 
-            errstr = "";
-            if (msg.data.vertex_attributes.count("normals")) {
-                const auto& attr_arr = msg.data.vertex_attributes.at("normals");
-                auto& mesh_attr = pcd->normals_;
-                if (!attr_arr.CheckType({messages::TypeStr<float>(),
-                                         messages::TypeStr<double>()},
-                                        errstr)) {
-                    errstr = "Ignoring normals. normals have wrong data type:" +
-                             errstr;
-                    LogInfo(errstr.c_str());
-                } else if (!attr_arr.CheckShape({-1, 3}, errstr)) {
-                    errstr = "Ignoring normals. normals have wrong shape:" +
-                             errstr;
-                    LogInfo(errstr.c_str());
-                } else {
-                    mesh_attr.resize(attr_arr.shape[0]);
-                    if (attr_arr.type == messages::TypeStr<float>()) {
-                        const float* ptr = attr_arr.Ptr<float>();
-                        for (int64_t i = 0; i < attr_arr.shape[0]; ++i) {
-                            mesh_attr[i].x() = ptr[0];
-                            mesh_attr[i].y() = ptr[1];
-                            mesh_attr[i].z() = ptr[2];
-                            ptr += 3;
-                        }
-                    }
-                    if (attr_arr.type == messages::TypeStr<double>()) {
-                        const double* ptr = attr_arr.Ptr<double>();
-                        for (int64_t i = 0; i < attr_arr.shape[0]; ++i) {
-                            mesh_attr[i].x() = ptr[0];
-                            mesh_attr[i].y() = ptr[1];
-                            mesh_attr[i].z() = ptr[2];
-                            ptr += 3;
-                        }
-                    }
+        if (!vertices.empty()) {
+            for (const auto& item : data.attributes) {
+                if (!item.second->empty()) {
+                    const auto& values = attributes[item.first];
+                    item.second->insert(item.second->end(), values.begin(),
+                                        values.end());
                 }
             }
+            data.vertices->insert(data.vertices->end(), vertices.begin(),
+                                  vertices.end());
+        }
+        if (!triangles.empty()) {
+            data.triangles->insert(data.triangles->end(), triangles.begin(),
+                                   triangles.end());
+        }
+    }
 
-            errstr = "";
-            if (msg.data.vertex_attributes.count("colors")) {
-                const auto& attr_arr = msg.data.vertex_attributes.at("colors");
-                auto& mesh_attr = pcd->colors_;
-                if (!attr_arr.CheckType({messages::TypeStr<float>(),
-                                         messages::TypeStr<double>()},
-                                        errstr)) {
-                    errstr = "Ignoring colors. colors have wrong data type:" +
-                             errstr;
-                    LogInfo(errstr.c_str());
-                } else if (!attr_arr.CheckShape({-1, 3}, errstr)) {
-                    errstr = "Ignoring colors. colors have wrong shape:" +
-                             errstr;
-                    LogInfo(errstr.c_str());
-                } else {
-                    mesh_attr.resize(attr_arr.shape[0]);
-                    if (attr_arr.type == messages::TypeStr<float>()) {
-                        const float* ptr = attr_arr.Ptr<float>();
-                        for (int64_t i = 0; i < attr_arr.shape[0]; ++i) {
-                            mesh_attr[i].x() = ptr[0];
-                            mesh_attr[i].y() = ptr[1];
-                            mesh_attr[i].z() = ptr[2];
-                            ptr += 3;
-                        }
-                    }
-                    if (attr_arr.type == messages::TypeStr<double>()) {
-                        const double* ptr = attr_arr.Ptr<double>();
-                        for (int64_t i = 0; i < attr_arr.shape[0]; ++i) {
-                            mesh_attr[i].x() = ptr[0];
-                            mesh_attr[i].y() = ptr[1];
-                            mesh_attr[i].z() = ptr[2];
-                            ptr += 3;
-                        }
-                    }
-                }
-            }
+    // Only the new points of a point cloud are uploaded.
+    if (geom->GetGeometryType() ==
+                geometry::Geometry::GeometryType::PointCloud &&
+        !vertices.empty()) {
+        const auto& pcd = static_cast<const geometry::PointCloud&>(*geom);
+        auto ToTensor = [](const std::vector<Eigen::Vector3d>& values) {
+            return core::eigen_converter::EigenVector3dVectorToTensor(
+                    values, core::Dtype::Float32, core::Device("CPU:0"));
+        };
+        t::geometry::PointCloud points(ToTensor(vertices));
+        if (pcd.HasColors()) {
+            points.SetPointColors(ToTensor(attributes["colors"]));
         }
-        SetGeometry(pcd, msg.path, msg.time, msg.layer);
+        if (pcd.HasNormals()) {
+            points.SetPointNormals(ToTensor(attributes["normals"]));
+        }
+        const std::string path = msg.path;
+        UpdateScene([path, points](rendering::Open3DScene& scene) {
+            scene.AppendPoints(path, points, rendering::Material());
+        });
+        return CreateStatusOKMsg();
+    }
+    SetGeometry(geom, msg.path, msg.time, msg.layer);
+    return CreateStatusOKMsg();
+}
+
+std::shared_ptr<zmq::message_t> Receiver::ProcessMessage(
+        const messages::Request& req,
+        const messages::SetVertexAttributeRange& msg,
+        const MsgpackObject& obj) {
+    auto geom = GetGeometry(msg.path);
+    if (!geom) {
+        return CreateErrorMsg(": no mesh data at " + msg.path);
+    }
+
+    std::string errstr(":");
+    std::vector<Eigen::Vector3d> values;
+    if (!GetVector3dVector(msg.values, values, errstr)) {
+        return CreateErrorMsg(errstr);
+    }
+
+    {
+        const std::lock_guard<std::mutex> lock(*geometry_mutex_);
+        VertexData data = GetVertexData(*geom);
+        std::vector<Eigen::Vector3d>* attribute =
+                msg.attribute == "vertices" ? data.vertices : nullptr;
+        if (data.attributes.count(msg.attribute)) {
+            attribute = data.attributes[msg.attribute];
+        }
+        if (!attribute || attribute->empty()) {
+            return CreateErrorMsg(": no " + msg.attribute + " at " +
+                                  msg.path);
+        }
+        if (msg.start < 0 ||
+            size_t(msg.start) + values.size() > attribute->size()) {
+            return CreateErrorMsg(": range out of bounds");
+        }
+        std::copy(values.begin(), values.end(),
+                  attribute->begin() + msg.start);
+    }
+
+    // Only the overwritten range of a point cloud is uploaded.
+    if (geom->GetGeometryType() ==
+        geometry::Geometry::GeometryType::PointCloud) {
+        const std::string path = msg.path;
+        const std::string attribute =
+                msg.attribute == "vertices" ? "points" : msg.attribute;
+        const size_t start = size_t(msg.start);
+        const core::Tensor tensor =
+                core::eigen_converter::EigenVector3dVectorToTensor(
+                        values, core::Dtype::Float32, core::Device("CPU:0"));
+        UpdateScene([path, attribute, start,
+                     tensor](rendering::Open3DScene& scene) {
+            scene.UpdatePoints(path, attribute, start, tensor);
+        });
+        return CreateStatusOKMsg();
+    }
+    SetGeometry(geom, msg.path, msg.time, msg.layer);
+    return CreateStatusOKMsg();
+}
+
+std::shared_ptr<zmq::message_t> Receiver::ProcessMessage(
+        const messages::Request& req,
+        const messages::RemoveVertices& msg,
+        const MsgpackObject& obj) {
+    auto geom = GetGeometry(msg.path);
+    if (!geom) {
+        return CreateErrorMsg(": no mesh data at " + msg.path);
     }
 
+    std::string errstr(":");
+    if (!msg.indices.CheckRank({1}, errstr) ||
+        !msg.indices.CheckType(
+                {messages::TypeStr<int32_t>(), messages::TypeStr<int64_t>()},
+                errstr)) {
+        return CreateErrorMsg(errstr);
+    }
+    std::vector<int64_t> indices =
+            GetArrayTensor(msg.indices)
+                    .To(core::Dtype::Int64)
+                    .ToFlatVector<int64_t>();
+
+    {
+        const std::lock_guard<std::mutex> lock(*geometry_mutex_);
+        VertexData data = GetVertexData(*geom);
+        if (!data.vertices) {
+            return CreateErrorMsg(": unsupported geometry at " + msg.path);
+        }
+        std::vector<size_t> vertex_indices;
+        vertex_indices.reserve(indices.size());
+        for (int64_t index : indices) {
+            if (index < 0 || size_t(index) >= data.vertices->size()) {
+                return CreateErrorMsg(": vertex index out of range");
+            }
+            vertex_indices.push_back(size_t(index));
+        }
+        if (data.triangles) {
+            auto& mesh = static_cast<geometry::TriangleMesh&>(*geom);
+            mesh.RemoveVerticesByIndex(vertex_indices);
+        } else {
+            auto& pcd = static_cast<geometry::PointCloud&>(*geom);
+            pcd = *pcd.SelectByIndex(vertex_indices, true);
+        }
+    }
+    SetGeometry(geom, msg.path, msg.time, msg.layer);
     return CreateStatusOKMsg();
 }
 
+bool Receiver::GetVector3dVector(const messages::Array& array,
+                                 std::vector<Eigen::Vector3d>& vec,
+                                 std::string& errstr) const {
+    if (!array.CheckShape({-1, 3}, errstr) ||
+        !array.CheckType(
+                {messages::TypeStr<float>(), messages::TypeStr<double>()},
+                errstr)) {
+        return false;
+    }
+    vec = core::eigen_converter::TensorToEigenVector3dVector(
+            GetArrayTensor(array));
+    return true;
+}
+
+std::shared_ptr<geometry::Geometry3D> Receiver::GetGeometry(
+        const std::string& path) const {
+    auto it = geometries_.find(path);
+    return it != geometries_.end() ? it->second : nullptr;
+}
+
 void Receiver::SetGeometry(std::shared_ptr<geometry::Geometry3D> geom,
                            const std::string& path,
                            int time,
                            const std::string& layer) {
+    (void)time;  // unused at the moment
+    // Only the receiver thread accesses the map, the scene copies the
+    // geometry on the main thread.
+    geometries_[path] = geom;
+    if (geom->GetGeometryType() ==
+        geometry::Geometry::GeometryType::PointCloud) {
+        // The points are converted now, as the later updates of the point
+        // cloud are posted as changes of this version.
+        const auto points = t::geometry::PointCloud::FromLegacyPointCloud(
+                static_cast<const geometry::PointCloud&>(*geom));
+        UpdateScene([path, points](rendering::Open3DScene& scene) {
+            scene.RemoveGeometry(path);
+            scene.AppendPoints(path, points, rendering::Material());
+        });
+        return;
+    }
+    UpdateScene([geom, path](rendering::Open3DScene& scene) {
+        if (scene.HasGeometry(path)) {
+            scene.RemoveGeometry(path);
+        }
+        scene.AddGeometry(path, geom.get(), rendering::Material());
+    });
+}
+
+void Receiver::UpdateScene(
+        std::function<void(rendering::Open3DScene&)> update) {
     std::shared_ptr<rendering::Open3DScene> scene = scene_;
+    std::shared_ptr<std::mutex> geometry_mutex = geometry_mutex_;
     gui::Application::GetInstance().PostToMainThread(
-            window_, [geom, path, time, layer, scene]() {
-                (void)time;  // unused at the moment
-                scene->AddGeometry(path, geom.get(), rendering::Material());
+            window_, [scene, geometry_mutex, update]() {
+                const std::lock_guard<std::mutex> lock(*geometry_mutex);
+                update(*scene);
             });
 }
 
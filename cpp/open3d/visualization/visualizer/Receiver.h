@@ -27,6 +27,12 @@
 
 #pragma once
 
+#include <Eigen/Core>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <vector>
+
 #include "open3d/io/rpc/ReceiverBase.h"
 #include "open3d/visualization/rendering/Open3DScene.h"
 
@@ -44,21 +50,64 @@ public:
              std::shared_ptr<rendering::Open3DScene> scene,
              const std::string& address,
              int timeout)
-        : ReceiverBase(address, timeout), window_(window), scene_(scene) {}
+        : ReceiverBase(address, timeout),
+          window_(window),
+          scene_(scene),
+          geometry_mutex_(std::make_shared<std::mutex>()) {}
 
     std::shared_ptr<zmq::message_t> ProcessMessage(
             const io::rpc::messages::Request& req,
             const io::rpc::messages::SetMeshData& msg,
             const MsgpackObject& obj) override;
 
+    /// Appends to the geometry at the path in place.
+    std::shared_ptr<zmq::message_t> ProcessMessage(
+            const io::rpc::messages::Request& req,
+            const io::rpc::messages::AppendMeshData& msg,
+            const MsgpackObject& obj) override;
+
+    /// Overwrites vertices of the geometry at the path in place.
+    std::shared_ptr<zmq::message_t> ProcessMessage(
+            const io::rpc::messages::Request& req,
+            const io::rpc::messages::SetVertexAttributeRange& msg,
+            const MsgpackObject& obj) override;
+
+    /// Removes vertices of the geometry at the path in place.
+    std::shared_ptr<zmq::message_t> ProcessMessage(
+            const io::rpc::messages::Request& req,
+            const io::rpc::messages::RemoveVertices& msg,
+            const MsgpackObject& obj) override;
+
 private:
+    /// Converts an array of shape [N,3] with float or double values. Returns
+    /// false and appends the reason to \p errstr otherwise.
+    bool GetVector3dVector(const io::rpc::messages::Array& array,
+                           std::vector<Eigen::Vector3d>& vec,
+                           std::string& errstr) const;
+
+    /// Returns the geometry set at \p path, or nullptr.
+    std::shared_ptr<geometry::Geometry3D> GetGeometry(
+            const std::string& path) const;
+
+    /// Adds the geometry at \p path to the scene again. Point clouds are
+    /// added as streaming point clouds, which the updates of a range of
+    /// points modify in place.
     void SetGeometry(std::shared_ptr<geometry::Geometry3D> geom,
                      const std::string& path,
                      int time,
                      const std::string& layer);
 
+    /// Runs \p update with the scene on the main thread, while holding the
+    /// geometry mutex.
+    void UpdateScene(std::function<void(rendering::Open3DScene&)> update);
+
     gui::Window* window_;
     std::shared_ptr<rendering::Open3DScene> scene_;
+    /// The geometries by path, which the updates modify. The time is ignored
+    /// as by SetMeshData. The mutex is held while the geometries are modified
+    /// or copied to the scene.
+    std::map<std::string, std::shared_ptr<geometry::Geometry3D>> geometries_;
+    std::shared_ptr<std::mutex> geometry_mutex_;
 };
 
 }  // namespace visualization
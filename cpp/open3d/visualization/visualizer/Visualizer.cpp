@@ -214,6 +214,11 @@ bool Visualizer::CreateVisualizerWindow(
 }
 
 void Visualizer::DestroyVisualizerWindow() {
+    if (frame_capture_ptr_) {
+        glfwMakeContextCurrent(window_);
+        frame_capture_ptr_->Release();
+        frame_capture_ptr_.reset();
+    }
     is_initialized_ = false;
     glDeleteVertexArrays(1, &vao_id_);
     glfwDestroyWindow(window_);
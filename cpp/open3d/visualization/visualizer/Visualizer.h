@@ -36,6 +36,7 @@
 #include <GLFW/glfw3.h>
 
 #include <Eigen/Core>
+#include <functional>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -44,6 +45,7 @@
 #include "open3d/geometry/Geometry.h"
 #include "open3d/visualization/shader/GeometryRenderer.h"
 #include "open3d/visualization/utility/ColorMap.h"
+#include "open3d/visualization/visualizer/AsyncFrameCapture.h"
 #include "open3d/visualization/visualizer/RenderOption.h"
 #include "open3d/visualization/visualizer/ViewControl.h"
 
@@ -54,6 +56,12 @@ class TriangleMesh;
 class Image;
 }  // namespace geometry
 
+namespace t {
+namespace geometry {
+class Image;
+}  // namespace geometry
+}  // namespace t
+
 namespace visualization {
 
 /// \class Visualizer
@@ -218,6 +226,55 @@ public:
     void CaptureDepthImage(const std::string &filename = "",
                            bool do_render = true,
                            double depth_scale = 1000.0);
+    /// \brief Function to capture and save a screen image asynchronously.
+    ///
+    /// The screen is read back into a pixel buffer object and encoded on a
+    /// background thread, so the call returns before the file is written.
+    /// Call WaitForAsyncCaptures() to make sure all files are on disk.
+    ///
+    /// \param filename Path to file.
+    /// \param do_render Set to `true` to do render.
+    void CaptureScreenImageAsync(const std::string &filename = "",
+                                 bool do_render = true);
+    /// \brief Function to capture and save a depth image asynchronously.
+    ///
+    /// \param filename Path to file.
+    /// \param do_render Set to `true` to do render.
+    /// \param depth_scale Scale depth value when capturing the depth image.
+    void CaptureDepthImageAsync(const std::string &filename = "",
+                                bool do_render = true,
+                                double depth_scale = 1000.0);
+    /// \brief Function to capture the screen asynchronously.
+    ///
+    /// \param callback Called from a background thread with the 8 bit RGB
+    /// screen image.
+    /// \param do_render Set to `true` to do render.
+    void CaptureScreenBufferAsync(
+            const std::function<void(std::shared_ptr<geometry::Image>)>
+                    &callback,
+            bool do_render = true);
+    /// \brief Function to capture depth in a float buffer asynchronously.
+    ///
+    /// \param callback Called from a background thread with the float depth
+    /// image.
+    /// \param do_render Set to `true` to do render.
+    void CaptureDepthFloatBufferAsync(
+            const std::function<void(std::shared_ptr<geometry::Image>)>
+                    &callback,
+            bool do_render = true);
+    /// \brief Function to capture the screen asynchronously as a tensor
+    /// image (UInt8, 3 channels).
+    void CaptureScreenTensorAsync(
+            const std::function<void(const t::geometry::Image &)> &callback,
+            bool do_render = true);
+    /// \brief Function to capture depth asynchronously as a tensor image
+    /// (Float32, 1 channel).
+    void CaptureDepthTensorAsync(
+            const std::function<void(const t::geometry::Image &)> &callback,
+            bool do_render = true);
+    /// \brief Function to block until all asynchronous captures have been
+    /// delivered.
+    void WaitForAsyncCaptures();
     /// \brief Function to capture and save local point cloud.
     ///
     /// \param filename Path to file.
@@ -248,6 +305,11 @@ protected:
     /// meshes individually).
     virtual void Render(bool render_screen = false);
 
+    /// Function to queue an asynchronous readback of the screen or depth
+    /// buffer.
+    void CaptureAsync(AsyncFrameCapture::FrameRequest request,
+                      bool do_render);
+
     void CopyViewStatusToClipboard();
 
     void CopyViewStatusFromClipboard();
@@ -292,6 +354,10 @@ protected:
     unsigned int render_rgb_tex_;
     unsigned int render_depth_stencil_rbo_;
 
+    // pixel buffer readback for the asynchronous capture functions, created
+    // on first use
+    std::unique_ptr<AsyncFrameCapture> frame_capture_ptr_;
+
     // view control
     std::unique_ptr<ViewControl> view_control_ptr_;
 
@@ -29,6 +29,7 @@
 #include "open3d/io/IJsonConvertibleIO.h"
 #include "open3d/io/ImageIO.h"
 #include "open3d/io/PointCloudIO.h"
+#include "open3d/t/geometry/Image.h"
 #include "open3d/visualization/utility/GLHelper.h"
 #include "open3d/visualization/visualizer/ViewParameters.h"
 #include "open3d/visualization/visualizer/ViewTrajectory.h"
@@ -427,6 +428,129 @@ void Visualizer::CaptureDepthImage(const std::string &filename /* = ""*/,
     }
 }
 
+void Visualizer::CaptureScreenImageAsync(
+        const std::string &filename /* = ""*/, bool do_render /* = true*/) {
+    AsyncFrameCapture::FrameRequest request;
+    request.type_ = AsyncFrameCapture::FrameType::Color;
+    request.filename_ = filename;
+    if (request.filename_.empty()) {
+        std::string timestamp = utility::GetCurrentTimeStamp();
+        request.filename_ = "ScreenCapture_" + timestamp + ".png";
+        std::string camera_filename = "ScreenCamera_" + timestamp + ".json";
+        utility::LogDebug("[Visualizer] Screen camera capture to {}",
+                          camera_filename.c_str());
+        camera::PinholeCameraParameters parameter;
+        view_control_ptr_->ConvertToPinholeCameraParameters(parameter);
+        io::WriteIJsonConvertible(camera_filename, parameter);
+    }
+    CaptureAsync(std::move(request), do_render);
+}
+
+void Visualizer::CaptureDepthImageAsync(const std::string &filename /* = ""*/,
+                                        bool do_render /* = true*/,
+                                        double depth_scale /* = 1000.0*/) {
+#if __APPLE__
+    // The column by column workaround in CaptureDepthImage() cannot be
+    // pipelined, fall back to the synchronous path.
+    CaptureDepthImage(filename, do_render, depth_scale);
+#else   //__APPLE__
+    AsyncFrameCapture::FrameRequest request;
+    request.type_ = AsyncFrameCapture::FrameType::Depth;
+    request.depth_scale_ = depth_scale;
+    request.filename_ = filename;
+    if (request.filename_.empty()) {
+        std::string timestamp = utility::GetCurrentTimeStamp();
+        request.filename_ = "DepthCapture_" + timestamp + ".png";
+        std::string camera_filename = "DepthCamera_" + timestamp + ".json";
+        utility::LogDebug("[Visualizer] Depth camera capture to {}",
+                          camera_filename.c_str());
+        camera::PinholeCameraParameters parameter;
+        view_control_ptr_->ConvertToPinholeCameraParameters(parameter);
+        io::WriteIJsonConvertible(camera_filename, parameter);
+    }
+    CaptureAsync(std::move(request), do_render);
+#endif  //__APPLE__
+}
+
+void Visualizer::CaptureScreenBufferAsync(
+        const std::function<void(std::shared_ptr<geometry::Image>)> &callback,
+        bool do_render /* = true*/) {
+    AsyncFrameCapture::FrameRequest request;
+    request.type_ = AsyncFrameCapture::FrameType::Color;
+    request.callback_ = callback;
+    CaptureAsync(std::move(request), do_render);
+}
+
+void Visualizer::CaptureDepthFloatBufferAsync(
+        const std::function<void(std::shared_ptr<geometry::Image>)> &callback,
+        bool do_render /* = true*/) {
+#if __APPLE__
+    callback(CaptureDepthFloatBuffer(do_render));
+#else   //__APPLE__
+    AsyncFrameCapture::FrameRequest request;
+    request.type_ = AsyncFrameCapture::FrameType::Depth;
+    request.callback_ = callback;
+    CaptureAsync(std::move(request), do_render);
+#endif  //__APPLE__
+}
+
+void Visualizer::CaptureScreenTensorAsync(
+        const std::function<void(const t::geometry::Image &)> &callback,
+        bool do_render /* = true*/) {
+    CaptureScreenBufferAsync(
+            [callback](std::shared_ptr<geometry::Image> image) {
+                callback(t::geometry::Image::FromLegacyImage(*image));
+            },
+            do_render);
+}
+
+void Visualizer::CaptureDepthTensorAsync(
+        const std::function<void(const t::geometry::Image &)> &callback,
+        bool do_render /* = true*/) {
+    CaptureDepthFloatBufferAsync(
+            [callback](std::shared_ptr<geometry::Image> image) {
+                callback(t::geometry::Image::FromLegacyImage(*image));
+            },
+            do_render);
+}
+
+void Visualizer::WaitForAsyncCaptures() {
+    if (frame_capture_ptr_) {
+        glfwMakeContextCurrent(window_);
+        frame_capture_ptr_->Flush();
+    }
+}
+
+void Visualizer::CaptureAsync(AsyncFrameCapture::FrameRequest request,
+                              bool do_render) {
+    if (!frame_capture_ptr_) {
+        frame_capture_ptr_ = std::make_unique<AsyncFrameCapture>();
+    }
+    request.width_ = view_control_ptr_->GetWindowWidth();
+    request.height_ = view_control_ptr_->GetWindowHeight();
+    request.z_near_ = view_control_ptr_->GetZNear();
+    request.z_far_ = view_control_ptr_->GetZFar();
+    bool is_color = request.type_ == AsyncFrameCapture::FrameType::Color;
+    if (do_render) {
+        // Color is read from the offscreen framebuffer, as in
+        // CaptureScreenImage(); depth from the default one.
+        Render(is_color);
+        is_redraw_required_ = false;
+    } else {
+        glfwMakeContextCurrent(window_);
+    }
+    // No glFinish() here: the readback is fenced and retrieved later.
+    frame_capture_ptr_->Capture(request);
+
+    if (render_fbo_ != 0) {
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        glDeleteFramebuffers(1, &render_fbo_);
+        glDeleteRenderbuffers(1, &render_depth_stencil_rbo_);
+        glDeleteTextures(1, &render_rgb_tex_);
+        render_fbo_ = 0;
+    }
+}
+
 void Visualizer::CaptureDepthPointCloud(
         const std::string &filename /* = ""*/,
         bool do_render /* = true*/,
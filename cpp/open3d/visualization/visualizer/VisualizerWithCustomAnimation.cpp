@@ -129,12 +129,12 @@ void VisualizerWithCustomAnimation::Play(
             if (recording_depth) {
                 buffer = fmt::format(recording_depth_filename_format_.c_str(),
                                      recording_file_index_);
-                CaptureDepthImage(
+                CaptureDepthImageAsync(
                         recording_depth_basedir_ + std::string(buffer), false);
             } else {
                 buffer = fmt::format(recording_image_filename_format_.c_str(),
                                      recording_file_index_);
-                CaptureScreenImage(
+                CaptureScreenImageAsync(
                         recording_image_basedir_ + std::string(buffer), false);
             }
         }
@@ -144,6 +144,9 @@ void VisualizerWithCustomAnimation::Play(
             view_control.SetAnimationMode(
                     ViewControlWithCustomAnimation::AnimationMode::FreeMode);
             RegisterAnimationCallback(nullptr);
+            if (recording) {
+                WaitForAsyncCaptures();
+            }
             if (recording && recording_trajectory) {
                 if (recording_depth) {
                     io::WriteIJsonConvertible(
@@ -39,6 +39,7 @@
 #include "open3d/io/TriangleMeshIO.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/visualization/utility/GLHelper.h"
+#include "open3d/visualization/utility/PickIndexBuffer.h"
 #include "open3d/visualization/utility/PointCloudPicker.h"
 #include "open3d/visualization/utility/SelectionPolygon.h"
 #include "open3d/visualization/utility/SelectionPolygonVolume.h"
@@ -396,21 +397,20 @@ std::vector<int> VisualizerWithVertexSelection::PickPoints(double winX,
     glBindFramebuffer(GL_FRAMEBUFFER, 0);
     glEnable(GL_MULTISAMPLE);
 
-    std::unordered_set<int> indexSet;
-    for (int i = 0; i < width * height; ++i) {
-        const uint8_t *rgbaPtr = rgba.data() + 4 * i;
-        int index = gl_util::ColorCodeToPickIndex(Eigen::Vector4i(
-                rgbaPtr[0], rgbaPtr[1], rgbaPtr[2], rgbaPtr[3]));
-        if (index >= 0) {
-            indexSet.insert(index);
+    PickIndexBuffer buffer(0, 0, width, height);
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            const uint8_t *rgbaPtr = rgba.data() + 4 * (y * width + x);
+            int index = gl_util::ColorCodeToPickIndex(Eigen::Vector4i(
+                    rgbaPtr[0], rgbaPtr[1], rgbaPtr[2], rgbaPtr[3]));
+            if (index >= 0) {
+                buffer.SetIndex(x, y, uint32_t(index));
+            }
         }
     }
 
-    std::vector<int> indices;
-    indices.reserve(indexSet.size());
-    for (int idx : indexSet) {
-        indices.push_back(idx);
-    }
+    const auto picked = buffer.GetIndicesInRect(0, 0, width, height);
+    std::vector<int> indices(picked.begin(), picked.end());
     points_in_rect_ = indices;
     return indices;
 }
@@ -36,6 +36,8 @@ void pybind_cuda_utils(py::module &m) {
     m_cuda.def("device_count", core::cuda::DeviceCount);
     m_cuda.def("is_available", core::cuda::IsAvailable);
     m_cuda.def("release_cache", core::cuda::ReleaseCache);
+    m_cuda.def("synchronize", core::cuda::Synchronize,
+               "Waits for the work submitted to the current CUDA stream.");
 }
 
 }  // namespace core
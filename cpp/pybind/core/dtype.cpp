@@ -49,8 +49,11 @@ void pybind_core_dtype(py::module &m) {
                                                     "Open3D data types.");
     dtype.def(py::init<Dtype::DtypeCode, int64_t, const std::string &>());
     dtype.def_readonly_static("Undefined", &Dtype::Undefined);
+    dtype.def_readonly_static("Float16", &Dtype::Float16);
     dtype.def_readonly_static("Float32", &Dtype::Float32);
     dtype.def_readonly_static("Float64", &Dtype::Float64);
+    dtype.def_readonly_static("Int8", &Dtype::Int8);
+    dtype.def_readonly_static("Int16", &Dtype::Int16);
     dtype.def_readonly_static("Int32", &Dtype::Int32);
     dtype.def_readonly_static("Int64", &Dtype::Int64);
     dtype.def_readonly_static("UInt8", &Dtype::UInt8);
@@ -75,6 +75,19 @@ void pybind_core_hashmap(py::module& m) {
         return py::make_tuple(addrs, masks);
     });
 
+    hashmap.def("insert_or_find",
+                [](Hashmap& h, const Tensor& keys, const Tensor& values) {
+                    Tensor addrs, masks;
+                    h.InsertOrFind(keys, values, addrs, masks);
+                    return py::make_tuple(addrs, masks);
+                });
+
+    hashmap.def("activate_or_find", [](Hashmap& h, const Tensor& keys) {
+        Tensor addrs, masks;
+        h.InsertOrFind(keys, addrs, masks);
+        return py::make_tuple(addrs, masks);
+    });
+
     hashmap.def("find", [](Hashmap& h, const Tensor& keys) {
         Tensor addrs, masks;
         h.Find(keys, addrs, masks);
@@ -100,6 +113,12 @@ void pybind_core_hashmap(py::module& m) {
     hashmap.def("get_value_tensor", &Hashmap::GetValueTensor);
 
     hashmap.def("rehash", &Hashmap::Rehash);
+    hashmap.def("reserve", &Hashmap::Reserve);
+    hashmap.def("save", &Hashmap::Save, "file_name"_a);
+    hashmap.def_static("load", &Hashmap::Load, "file_name"_a,
+                       "device"_a = Device("CPU:0"));
+    hashmap.def("set_max_load_factor", &Hashmap::SetMaxLoadFactor);
+    hashmap.def("get_max_load_factor", &Hashmap::GetMaxLoadFactor);
     hashmap.def("size", &Hashmap::Size);
     hashmap.def("capacity", &Hashmap::GetCapacity);
 }
@@ -48,7 +48,13 @@ void pybind_core_nns(py::module &m) {
                     {"radius", "Radius value for radius search."},
                     {"max_knn",
                      "Maximum number of neighbors to search per query point."},
-                    {"knn", "Number of neighbors to search per query point."}};
+                    {"knn", "Number of neighbors to search per query point."},
+                    {"checks",
+                     "Number of dataset points compared per query point for "
+                     "approximate search, -1 for exact search."},
+                    {"queries_row_splits",
+                     "Tensor of shape {batch_size + 1,} with the start and "
+                     "end of each batch in the query tensor."}};
 
     py::class_<NearestNeighborSearch, std::shared_ptr<NearestNeighborSearch>>
             nns(m_nns, "NearestNeighborSearch",
@@ -58,6 +64,11 @@ void pybind_core_nns(py::module &m) {
 
     // Constructors.
     nns.def(py::init<const Tensor &>(), "dataset_points"_a);
+    nns.def(py::init<const Tensor &, const Tensor &>(), "dataset_points"_a,
+            "points_row_splits"_a,
+            "Construct for a batch of datasets. points_row_splits of shape "
+            "{batch_size + 1,} gives the start and end of each batch in "
+            "dataset_points.");
 
     // Index functions.
     nns.def("knn_index", &NearestNeighborSearch::KnnIndex,
@@ -72,15 +83,31 @@ void pybind_core_nns(py::module &m) {
                 }
             },
             py::arg("radius") = py::none());
+    nns.def("approx_knn_index", &NearestNeighborSearch::ApproxKnnIndex,
+            "num_trees"_a = FlannIndex::kDefaultNumTrees,
+            "Set index for approximate knn search, a forest of num_trees "
+            "randomized KDTrees.");
     nns.def("multi_radius_index", &NearestNeighborSearch::MultiRadiusIndex,
             "Set index for multi-radius search.");
     nns.def("hybrid_index", &NearestNeighborSearch::HybridIndex,
-            "Set index for hybrid search.");
+            "radius"_a = py::none(),
+            "Set index for hybrid search. On CPU, a radius builds a spatial "
+            "hash table, then the search radius must not exceed its square.");
 
     // Search functions.
-    nns.def("knn_search", &NearestNeighborSearch::KnnSearch, "query_points"_a,
-            "knn"_a, "Perform knn search.");
-    nns.def("fixed_radius_search", &NearestNeighborSearch::FixedRadiusSearch,
+    nns.def("knn_search",
+            py::overload_cast<const Tensor &, int>(
+                    &NearestNeighborSearch::KnnSearch),
+            "query_points"_a, "knn"_a, "Perform knn search.");
+    nns.def("approx_knn_search", &NearestNeighborSearch::ApproxKnnSearch,
+            "query_points"_a, "knn"_a,
+            "checks"_a = FlannIndex::kDefaultChecks,
+            "Perform approximate knn search. checks is the number of dataset "
+            "points compared per query, higher values are more accurate and "
+            "slower. -1 gives the exact neighbors.");
+    nns.def("fixed_radius_search",
+            py::overload_cast<const Tensor &, double>(
+                    &NearestNeighborSearch::FixedRadiusSearch),
             "query_points"_a, "radius"_a,
             "Perform fixed radius search. All query points share the same "
             "radius.");
@@ -91,6 +118,25 @@ void pybind_core_nns(py::module &m) {
     nns.def("hybrid_search", &NearestNeighborSearch::HybridSearch,
             "query_points"_a, "radius"_a, "max_knn"_a,
             "Perform hybrid search.");
+    nns.def("batched_knn_search",
+            py::overload_cast<const Tensor &, const Tensor &, int>(
+                    &NearestNeighborSearch::KnnSearch),
+            "query_points"_a, "queries_row_splits"_a, "knn"_a,
+            "Perform knn search for a batch of queries. Neighbors are searched "
+            "in the dataset points of the same batch.");
+    nns.def("batched_fixed_radius_search",
+            py::overload_cast<const Tensor &, const Tensor &, double>(
+                    &NearestNeighborSearch::FixedRadiusSearch),
+            "query_points"_a, "queries_row_splits"_a, "radius"_a,
+            "Perform fixed radius search for a batch of queries. Neighbors are "
+            "searched in the dataset points of the same batch.");
+    nns.def("add_points", &NearestNeighborSearch::AddPoints, "points"_a,
+            "Add points to the dataset of the indices set so far. Added points "
+            "get the next indices.");
+    nns.def("remove_points", &NearestNeighborSearch::RemovePoints,
+            "indices"_a,
+            "Remove points from the dataset of the indices set so far. Indices "
+            "of the other points do not change.");
 
     // Docstrings.
     docstring::ClassMethodDocInject(m_nns, "NearestNeighborSearch",
@@ -105,6 +151,15 @@ void pybind_core_nns(py::module &m) {
     docstring::ClassMethodDocInject(m_nns, "NearestNeighborSearch",
                                     "hybrid_search",
                                     map_nearest_neighbor_search_method_docs);
+    docstring::ClassMethodDocInject(m_nns, "NearestNeighborSearch",
+                                    "approx_knn_search",
+                                    map_nearest_neighbor_search_method_docs);
+    docstring::ClassMethodDocInject(m_nns, "NearestNeighborSearch",
+                                    "batched_knn_search",
+                                    map_nearest_neighbor_search_method_docs);
+    docstring::ClassMethodDocInject(m_nns, "NearestNeighborSearch",
+                                    "batched_fixed_radius_search",
+                                    map_nearest_neighbor_search_method_docs);
 }
 
 }  // namespace nns
@@ -30,6 +30,7 @@
 
 #include "open3d/core/Blob.h"
 #include "open3d/core/CUDAUtils.h"
+#include "open3d/core/DLPack.h"
 #include "open3d/core/Device.h"
 #include "open3d/core/Dispatch.h"
 #include "open3d/core/Dtype.h"
@@ -202,6 +203,25 @@ static void BindTensorFullCreation(py::class_<Tensor>& tensor) {
             "device"_a = py::none());
 }
 
+/// Numpy array-interface type string of \p dtype, e.g. "<f4" for Float32.
+static std::string DtypeToTypeStr(const Dtype& dtype) {
+    const int64_t byte_size = dtype.ByteSize();
+    std::string byte_order = byte_size == 1 ? "|" : "<";
+    switch (dtype.GetDtypeCode()) {
+        case Dtype::DtypeCode::Bool:
+            return byte_order + "b" + std::to_string(byte_size);
+        case Dtype::DtypeCode::Int:
+            return byte_order + "i" + std::to_string(byte_size);
+        case Dtype::DtypeCode::UInt:
+            return byte_order + "u" + std::to_string(byte_size);
+        case Dtype::DtypeCode::Float:
+            return byte_order + "f" + std::to_string(byte_size);
+        default:
+            utility::LogError("Unsupported dtype {} for array interface.",
+                              dtype.ToString());
+    }
+}
+
 void pybind_core_tensor(py::module& m) {
     py::class_<Tensor> tensor(
             m, "Tensor",
@@ -361,46 +381,72 @@ void pybind_core_tensor(py::module& m) {
         return core::PyArrayToTensor(np_array, true);
     });
 
-    tensor.def("to_dlpack", [](const Tensor& tensor) {
-        DLManagedTensor* dl_managed_tensor = tensor.ToDLPack();
-        // See PyTorch's torch/csrc/Module.cpp
-        auto capsule_destructor = [](PyObject* data) {
-            DLManagedTensor* dl_managed_tensor =
-                    (DLManagedTensor*)PyCapsule_GetPointer(data, "dltensor");
-            if (dl_managed_tensor) {
-                // the dl_managed_tensor has not been consumed,
-                // call deleter ourselves
-                dl_managed_tensor->deleter(
-                        const_cast<DLManagedTensor*>(dl_managed_tensor));
-            } else {
-                // The dl_managed_tensor has been consumed
-                // PyCapsule_GetPointer has set an error indicator
-                PyErr_Clear();
-            }
-        };
-        return py::capsule(dl_managed_tensor, "dltensor", capsule_destructor);
-    });
+    tensor.def("to_dlpack", &TensorToDLPackCapsule);
+    tensor.def_static("from_dlpack", &DLPackToTensor, "ext"_a,
+                      "Imports a DLPack PyCapsule, or any object implementing "
+                      "__dlpack__, as a Tensor sharing its memory.");
 
-    tensor.def_static("from_dlpack", [](py::capsule data) {
-        DLManagedTensor* dl_managed_tensor =
-                static_cast<DLManagedTensor*>(data);
-        if (!dl_managed_tensor) {
-            utility::LogError(
-                    "from_dlpack must receive "
-                    "DLManagedTensor PyCapsule.");
-        }
-        // Make sure that the PyCapsule is not used again.
-        // See:
-        // torch/csrc/Module.cpp, and
-        // https://github.com/cupy/cupy/pull/1445/files#diff-ddf01ff512087ef616db57ecab88c6ae
-        Tensor t = Tensor::FromDLPack(dl_managed_tensor);
-        PyCapsule_SetName(data.ptr(), "used_dltensor");
-        return t;
+    // DLPack Python protocol, e.g. torch.from_dlpack(o3c_tensor).
+    tensor.def(
+            "__dlpack__",
+            [](const Tensor& tensor, py::object stream) {
+                if (tensor.GetDevice().GetType() == Device::DeviceType::CUDA) {
+                    // None means the consumer uses the legacy default stream,
+                    // -1 means it does not want any synchronization.
+                    intptr_t stream_handle =
+                            stream.is_none() ? 1 : stream.cast<intptr_t>();
+                    if (stream_handle != -1) {
+                        cuda::StreamWaitCurrent(stream_handle);
+                    }
+                }
+                return TensorToDLPackCapsule(tensor);
+            },
+            "stream"_a = py::none());
+    tensor.def("__dlpack_device__", [](const Tensor& tensor) {
+        const Device& device = tensor.GetDevice();
+        DLDeviceType dl_device_type =
+                device.GetType() == Device::DeviceType::CUDA
+                        ? DLDeviceType::kDLGPU
+                        : DLDeviceType::kDLCPU;
+        return py::make_tuple(static_cast<int>(dl_device_type),
+                              device.GetID());
     });
 
+    // CUDA Array Interface (version 3), e.g. cupy.asarray(o3c_tensor). The
+    // consumer must keep the Tensor alive while using the memory.
+    tensor.def_property_readonly(
+            "__cuda_array_interface__", [](const Tensor& tensor) {
+                if (tensor.GetDevice().GetType() !=
+                    Device::DeviceType::CUDA) {
+                    // Raise AttributeError such that hasattr() returns False.
+                    throw py::attribute_error(
+                            "__cuda_array_interface__ is only available for "
+                            "CUDA tensors.");
+                }
+                const int64_t byte_size = tensor.GetDtype().ByteSize();
+                py::list shape, strides;
+                for (int64_t i = 0; i < tensor.NumDims(); ++i) {
+                    shape.append(tensor.GetShape(i));
+                    strides.append(tensor.GetStride(i) * byte_size);
+                }
+                py::dict interface;
+                interface["shape"] = py::tuple(shape);
+                interface["typestr"] = DtypeToTypeStr(tensor.GetDtype());
+                interface["data"] = py::make_tuple(
+                        reinterpret_cast<intptr_t>(tensor.GetDataPtr()), false);
+                interface["strides"] = tensor.IsContiguous()
+                                               ? py::object(py::none())
+                                               : py::object(py::tuple(strides));
+                interface["stream"] = cuda::GetCurrentStreamHandle();
+                interface["version"] = 3;
+                return interface;
+            });
+
     /// Linalg operations.
-    tensor.def("matmul", &Tensor::Matmul);
-    tensor.def("__matmul__", &Tensor::Matmul);
+    tensor.def("matmul", py::overload_cast<const Tensor&>(&Tensor::Matmul,
+                                                          py::const_));
+    tensor.def("__matmul__", py::overload_cast<const Tensor&>(&Tensor::Matmul,
+                                                              py::const_));
     tensor.def("lstsq", &Tensor::LeastSquares);
     tensor.def("solve", &Tensor::Solve);
     tensor.def("inv", &Tensor::Inverse);
@@ -415,6 +461,10 @@ void pybind_core_tensor(py::module& m) {
             "dtype"_a, "copy"_a = false);
     tensor.def("T", &Tensor::T);
     tensor.def("contiguous", &Tensor::Contiguous);
+    tensor.def("to_channel_first",
+               [](const Tensor& tensor) { return tensor.ToChannelFirst(); });
+    tensor.def("to_channel_last",
+               [](const Tensor& tensor) { return tensor.ToChannelLast(); });
 
     // See "emulating numeric types" section for Python built-in numeric ops.
     // https://docs.python.org/3/reference/datamodel.html#emulating-numeric-types
@@ -509,22 +559,22 @@ void pybind_core_tensor(py::module& m) {
     tensor.def("__bool__", &Tensor::IsNonZero);  // Python 3.X.
 
     // Unary element-wise ops.
-    tensor.def("sqrt", &Tensor::Sqrt);
+    tensor.def("sqrt", py::overload_cast<>(&Tensor::Sqrt, py::const_));
     tensor.def("sqrt_", &Tensor::Sqrt_);
-    tensor.def("sin", &Tensor::Sin);
+    tensor.def("sin", py::overload_cast<>(&Tensor::Sin, py::const_));
     tensor.def("sin_", &Tensor::Sin_);
-    tensor.def("cos", &Tensor::Cos);
+    tensor.def("cos", py::overload_cast<>(&Tensor::Cos, py::const_));
     tensor.def("cos_", &Tensor::Cos_);
-    tensor.def("neg", &Tensor::Neg);
+    tensor.def("neg", py::overload_cast<>(&Tensor::Neg, py::const_));
     tensor.def("neg_", &Tensor::Neg_);
-    tensor.def("exp", &Tensor::Exp);
+    tensor.def("exp", py::overload_cast<>(&Tensor::Exp, py::const_));
     tensor.def("exp_", &Tensor::Exp_);
-    tensor.def("abs", &Tensor::Abs);
+    tensor.def("abs", py::overload_cast<>(&Tensor::Abs, py::const_));
     tensor.def("abs_", &Tensor::Abs_);
-    tensor.def("floor", &Tensor::Floor);
-    tensor.def("ceil", &Tensor::Ceil);
-    tensor.def("round", &Tensor::Round);
-    tensor.def("trunc", &Tensor::Trunc);
+    tensor.def("floor", py::overload_cast<>(&Tensor::Floor, py::const_));
+    tensor.def("ceil", py::overload_cast<>(&Tensor::Ceil, py::const_));
+    tensor.def("round", py::overload_cast<>(&Tensor::Round, py::const_));
+    tensor.def("trunc", py::overload_cast<>(&Tensor::Trunc, py::const_));
     tensor.def("logical_not", &Tensor::LogicalNot);
     tensor.def("logical_not_", &Tensor::LogicalNot_);
 
@@ -539,15 +589,46 @@ void pybind_core_tensor(py::module& m) {
                 }
             },
             "as_tuple"_a = false);
+    tensor.def("masked_select", &Tensor::MaskedSelect, "mask"_a);
     tensor.def("all", &Tensor::All);
     tensor.def("any", &Tensor::Any);
 
+    // Sorting.
+    tensor.def("sort", &Tensor::Sort);
+    tensor.def("argsort", &Tensor::ArgSort);
+    tensor.def(
+            "unique",
+            [](const Tensor& tensor, bool return_inverse,
+               bool return_counts) -> py::object {
+                Tensor unique, inverse, counts;
+                std::tie(unique, inverse, counts) =
+                        tensor.Unique(return_inverse, return_counts);
+                if (!return_inverse && !return_counts) {
+                    return py::cast(unique);
+                }
+                py::list results;
+                results.append(unique);
+                if (return_inverse) {
+                    results.append(inverse);
+                }
+                if (return_counts) {
+                    results.append(counts);
+                }
+                return py::tuple(results);
+            },
+            "return_inverse"_a = false, "return_counts"_a = false);
+    tensor.def("index_add_", &Tensor::IndexAdd_, "dim"_a, "index"_a, "src"_a,
+               "Adds the slices of src along dim at the positions given by "
+               "index, accumulating duplicate indices.");
+
     // Reduction ops.
     BIND_REDUCTION_OP(sum, Sum);
     BIND_REDUCTION_OP(mean, Mean);
     BIND_REDUCTION_OP(prod, Prod);
     BIND_REDUCTION_OP(min, Min);
     BIND_REDUCTION_OP(max, Max);
+    BIND_REDUCTION_OP(min_max, MinMax);
+    BIND_REDUCTION_OP(mean_var, MeanVar);
     BIND_REDUCTION_OP_NO_KEEPDIM(argmin, ArgMin);
     BIND_REDUCTION_OP_NO_KEEPDIM(argmax, ArgMax);
 
@@ -567,10 +648,16 @@ void pybind_core_tensor(py::module& m) {
     // Get item from Tensor of one element.
     tensor.def("item", [](const Tensor& tensor) -> py::object {
         Dtype dtype = tensor.GetDtype();
-        if (dtype == Dtype::Float32) {
+        if (dtype == Dtype::Float16) {
+            return py::float_(static_cast<float>(tensor.Item<Float16>()));
+        } else if (dtype == Dtype::Float32) {
             return py::float_(tensor.Item<float>());
         } else if (dtype == Dtype::Float64) {
             return py::float_(tensor.Item<double>());
+        } else if (dtype == Dtype::Int8) {
+            return py::int_(tensor.Item<int8_t>());
+        } else if (dtype == Dtype::Int16) {
+            return py::int_(tensor.Item<int16_t>());
         } else if (dtype == Dtype::Int32) {
             return py::int_(tensor.Item<int32_t>());
         } else if (dtype == Dtype::Int64) {
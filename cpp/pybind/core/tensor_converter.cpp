@@ -26,6 +26,8 @@
 
 #include "pybind/core/tensor_converter.h"
 
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/DLPack.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/utility/Console.h"
 #include "pybind/core/core.h"
@@ -282,5 +284,64 @@ SizeVector PyHandleToSizeVector(const py::handle& handle) {
     }
 }
 
+py::capsule TensorToDLPackCapsule(const Tensor& tensor) {
+    DLManagedTensor* dl_managed_tensor = tensor.ToDLPack();
+    // See PyTorch's torch/csrc/Module.cpp
+    auto capsule_destructor = [](PyObject* data) {
+        DLManagedTensor* dl_managed_tensor =
+                (DLManagedTensor*)PyCapsule_GetPointer(data, "dltensor");
+        if (dl_managed_tensor) {
+            // the dl_managed_tensor has not been consumed,
+            // call deleter ourselves
+            dl_managed_tensor->deleter(
+                    const_cast<DLManagedTensor*>(dl_managed_tensor));
+        } else {
+            // The dl_managed_tensor has been consumed
+            // PyCapsule_GetPointer has set an error indicator
+            PyErr_Clear();
+        }
+    };
+    return py::capsule(dl_managed_tensor, "dltensor", capsule_destructor);
+}
+
+Tensor DLPackToTensor(const py::object& ext) {
+    py::capsule data;
+    if (py::hasattr(ext, "__dlpack__")) {
+        // Producers with CUDA memory make the consumer stream wait for their
+        // pending work, so no device-wide synchronization is needed.
+        py::object stream = py::none();
+        if (py::hasattr(ext, "__dlpack_device__")) {
+            py::tuple dl_device = ext.attr("__dlpack_device__")();
+            if (dl_device[0].cast<int>() ==
+                static_cast<int>(DLDeviceType::kDLGPU)) {
+                stream = py::int_(cuda::GetCurrentStreamHandle());
+            }
+        }
+        data = ext.attr("__dlpack__")("stream"_a = stream);
+    } else if (PyCapsule_CheckExact(ext.ptr())) {
+        data = py::reinterpret_borrow<py::capsule>(ext);
+    } else {
+        utility::LogError(
+                "from_dlpack must receive DLManagedTensor PyCapsule or an "
+                "object implementing __dlpack__.");
+    }
+
+    DLManagedTensor* dl_managed_tensor = static_cast<DLManagedTensor*>(
+            PyCapsule_GetPointer(data.ptr(), "dltensor"));
+    if (!dl_managed_tensor) {
+        PyErr_Clear();
+        utility::LogError(
+                "from_dlpack must receive an unconsumed DLManagedTensor "
+                "PyCapsule.");
+    }
+    // Make sure that the PyCapsule is not used again.
+    // See:
+    // torch/csrc/Module.cpp, and
+    // https://github.com/cupy/cupy/pull/1445/files#diff-ddf01ff512087ef616db57ecab88c6ae
+    Tensor t = Tensor::FromDLPack(dl_managed_tensor);
+    PyCapsule_SetName(data.ptr(), "used_dltensor");
+    return t;
+}
+
 }  // namespace core
 }  // namespace open3d
@@ -65,6 +65,19 @@ py::array TensorToPyArray(const Tensor& tensor);
 /// python buffer will be copied.
 Tensor PyArrayToTensor(py::array array, bool inplace);
 
+/// Wrap Tensor::ToDLPack() in a "dltensor" PyCapsule, following the DLPack
+/// Python specification. The memory is shared with the Tensor. If the capsule
+/// is never consumed, the DLManagedTensor is released with the capsule.
+py::capsule TensorToDLPackCapsule(const Tensor& tensor);
+
+/// Import a DLPack-compatible Python object as a Tensor without copying.
+///
+/// \param ext Either a "dltensor" PyCapsule, or an object implementing
+/// `__dlpack__` (e.g. torch.Tensor, cupy.ndarray, Tensor). For CUDA producers,
+/// the current CUDA stream of the calling thread is handed to `__dlpack__`, so
+/// the producer orders its pending work before any work Open3D submits.
+Tensor DLPackToTensor(const py::object& ext);
+
 /// Convert py::list to Tensor.
 ///
 /// Nested lists are supported, e.g. [[0, 1, 2], [3, 4, 5]] becomes a 2x3
@@ -75,6 +75,16 @@ void pybind_boundingvolume(py::module &m) {
                     &OrientedBoundingBox::CreateFromPoints,
                     "Creates the bounding box that encloses the set of points.",
                     "points"_a)
+            .def_static("create_from_points_pca",
+                        &OrientedBoundingBox::CreateFromPointsPCA,
+                        "Creates the bounding box along the principal axes of "
+                        "all points, without the convex hull.",
+                        "points"_a)
+            .def_static("create_from_points_minimal",
+                        &OrientedBoundingBox::CreateFromPointsMinimal,
+                        "Creates an approximately minimal-volume bounding box "
+                        "that encloses the set of points.",
+                        "points"_a)
             .def("volume", &OrientedBoundingBox::Volume,
                  "Returns the volume of the bounding box.")
             .def("get_box_points", &OrientedBoundingBox::GetBoxPoints,
@@ -100,6 +110,12 @@ void pybind_boundingvolume(py::module &m) {
     docstring::ClassMethodDocInject(m, "OrientedBoundingBox",
                                     "create_from_points",
                                     {{"points", "A list of points."}});
+    docstring::ClassMethodDocInject(m, "OrientedBoundingBox",
+                                    "create_from_points_pca",
+                                    {{"points", "A list of points."}});
+    docstring::ClassMethodDocInject(
+            m, "OrientedBoundingBox", "create_from_points_minimal",
+            {{"points", "A list of points, at least 4 and not coplanar."}});
 
     py::class_<AxisAlignedBoundingBox, PyGeometry3D<AxisAlignedBoundingBox>,
                std::shared_ptr<AxisAlignedBoundingBox>, Geometry3D>
@@ -118,15 +118,29 @@ void pybind_kdtreeflann(py::module &m) {
                     {"data", "Matrix data."}};
     py::class_<KDTreeFlann, std::shared_ptr<KDTreeFlann>> kdtreeflann(
             m, "KDTreeFlann", "KDTree with FLANN for nearest neighbor search.");
-    kdtreeflann.def(py::init<>())
-            .def(py::init<const Eigen::MatrixXd &>(), "data"_a)
+
+    // open3d.geometry.KDTreeFlann.Precision
+    py::enum_<KDTreeFlann::Precision> kdtree_flann_precision(
+            kdtreeflann, "Precision",
+            "Scalar type of the points stored in the index.");
+    kdtree_flann_precision.value("Float64", KDTreeFlann::Precision::Float64)
+            .value("Float32", KDTreeFlann::Precision::Float32)
+            .export_values();
+
+    kdtreeflann
+            .def(py::init<KDTreeFlann::Precision>(),
+                 "precision"_a = KDTreeFlann::Precision::Float64)
+            .def(py::init<const Eigen::MatrixXd &, KDTreeFlann::Precision>(),
+                 "data"_a, "precision"_a = KDTreeFlann::Precision::Float64)
             .def("set_matrix_data", &KDTreeFlann::SetMatrixData,
                  "Sets the data for the KDTree from a matrix.", "data"_a)
-            .def(py::init<const Geometry &>(), "geometry"_a)
+            .def(py::init<const Geometry &, KDTreeFlann::Precision>(),
+                 "geometry"_a, "precision"_a = KDTreeFlann::Precision::Float64)
             .def("set_geometry", &KDTreeFlann::SetGeometry,
                  "Sets the data for the KDTree from geometry.", "geometry"_a)
-            .def(py::init<const pipelines::registration::Feature &>(),
-                 "feature"_a)
+            .def(py::init<const pipelines::registration::Feature &,
+                          KDTreeFlann::Precision>(),
+                 "feature"_a, "precision"_a = KDTreeFlann::Precision::Float64)
             .def("set_feature", &KDTreeFlann::SetFeature,
                  "Sets the data for the KDTree from the feature data.",
                  "feature"_a)
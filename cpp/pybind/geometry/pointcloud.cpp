@@ -29,6 +29,7 @@
 #include <vector>
 
 #include "open3d/camera/PinholeCameraIntrinsic.h"
+#include "open3d/geometry/DepthToPointCloudConverter.h"
 #include "open3d/geometry/Image.h"
 #include "open3d/geometry/RGBDImage.h"
 #include "pybind/docstring.h"
@@ -73,12 +74,14 @@ void pybind_pointcloud(py::module &m) {
                  "pointcloud.",
                  "indices"_a, "invert"_a = false)
             .def("voxel_down_sample", &PointCloud::VoxelDownSample,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to downsample input pointcloud into output "
                  "pointcloud with "
                  "a voxel. Normals and colors are averaged if they exist.",
                  "voxel_size"_a)
             .def("voxel_down_sample_and_trace",
                  &PointCloud::VoxelDownSampleAndTrace,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to downsample using "
                  "PointCloud::VoxelDownSample. Also records point "
                  "cloud index before downsampling",
@@ -107,20 +110,24 @@ void pybind_pointcloud(py::module &m) {
                  "Function to remove non-finite points from the PointCloud",
                  "remove_nan"_a = true, "remove_infinite"_a = true)
             .def("remove_radius_outlier", &PointCloud::RemoveRadiusOutliers,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to remove points that have less than nb_points"
                  " in a given sphere of a given radius",
                  "nb_points"_a, "radius"_a)
             .def("remove_statistical_outlier",
                  &PointCloud::RemoveStatisticalOutliers,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to remove points that are further away from their "
                  "neighbors in average",
                  "nb_neighbors"_a, "std_ratio"_a)
             .def("estimate_normals", &PointCloud::EstimateNormals,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to compute the normals of a point cloud. Normals "
                  "are oriented with respect to the input point cloud if "
                  "normals exist",
                  "search_param"_a = KDTreeSearchParamKNN(),
-                 "fast_normal_computation"_a = true)
+                 "fast_normal_computation"_a = true,
+                 "precision"_a = KDTreeFlann::Precision::Float64)
             .def("orient_normals_to_align_with_direction",
                  &PointCloud::OrientNormalsToAlignWithDirection,
                  "Function to orient the normals of a point cloud",
@@ -131,11 +138,13 @@ void pybind_pointcloud(py::module &m) {
                  "camera_location"_a = Eigen::Vector3d(0.0, 0.0, 0.0))
             .def("orient_normals_consistent_tangent_plane",
                  &PointCloud::OrientNormalsConsistentTangentPlane,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to orient the normals with respect to consistent "
                  "tangent planes",
                  "k"_a)
             .def("compute_point_cloud_distance",
                  &PointCloud::ComputePointCloudDistance,
+                 py::call_guard<py::gil_scoped_release>(),
                  "For each point in the source point cloud, compute the "
                  "distance to "
                  "the target point cloud.",
@@ -147,17 +156,21 @@ void pybind_pointcloud(py::module &m) {
                  "cloud.")
             .def("compute_mahalanobis_distance",
                  &PointCloud::ComputeMahalanobisDistance,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to compute the Mahalanobis distance for points in a "
                  "point "
                  "cloud. See: "
                  "https://en.wikipedia.org/wiki/Mahalanobis_distance.")
             .def("compute_nearest_neighbor_distance",
                  &PointCloud::ComputeNearestNeighborDistance,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to compute the distance from a point to its nearest "
                  "neighbor in the point cloud")
             .def("compute_convex_hull", &PointCloud::ComputeConvexHull,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Computes the convex hull of the point cloud.")
             .def("hidden_point_removal", &PointCloud::HiddenPointRemoval,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Removes hidden points from a point cloud and returns a mesh "
                  "of the remaining points. Based on Katz et al. 'Direct "
                  "Visibility of Point Sets', 2007. Additional information "
@@ -166,15 +179,27 @@ void pybind_pointcloud(py::module &m) {
                  "Data', 2010.",
                  "camera_location"_a, "radius"_a)
             .def("cluster_dbscan", &PointCloud::ClusterDBSCAN,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Cluster PointCloud using the DBSCAN algorithm  Ester et al., "
                  "'A Density-Based Algorithm for Discovering Clusters in Large "
                  "Spatial Databases with Noise', 1996. Returns a list of point "
                  "labels, -1 indicates noise according to the algorithm.",
                  "eps"_a, "min_points"_a, "print_progress"_a = false)
             .def("segment_plane", &PointCloud::SegmentPlane,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Segments a plane in the point cloud using the RANSAC "
                  "algorithm.",
-                 "distance_threshold"_a, "ransac_n"_a, "num_iterations"_a)
+                 "distance_threshold"_a, "ransac_n"_a, "num_iterations"_a,
+                 "probability"_a = 0.99999999)
+            .def("segment_planes", &PointCloud::SegmentPlanes,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Segments up to max_planes planes in the point cloud by "
+                 "repeatedly running RANSAC on the points that are not yet "
+                 "inliers of a plane. Returns a list of (plane_model, "
+                 "inliers).",
+                 "max_planes"_a, "distance_threshold"_a = 0.01,
+                 "ransac_n"_a = 3, "num_iterations"_a = 100,
+                 "min_num_inliers"_a = 3, "probability"_a = 0.99999999)
             .def_static(
                     "create_from_depth_image",
                     &PointCloud::CreateFromDepthImage,
@@ -192,6 +217,7 @@ void pybind_pointcloud(py::module &m) {
                     "stride"_a = 1, "project_valid_depth_only"_a = true)
             .def_static("create_from_rgbd_image",
                         &PointCloud::CreateFromRGBDImage,
+                        py::call_guard<py::gil_scoped_release>(),
                         "Factory function to create a pointcloud from an RGB-D "
                         "image and a        camera. Given depth value d at (u, "
                         "v) image coordinate, the corresponding 3d point is: "
@@ -262,7 +288,10 @@ void pybind_pointcloud(py::module &m) {
              {"fast_normal_computation",
               "If true, the normal estiamtion uses a non-iterative method to "
               "extract the eigenvector from the covariance matrix. This is "
-              "faster, but is not as numerical stable."}});
+              "faster, but is not as numerical stable."},
+             {"precision",
+              "Scalar type of the KDTree used for the neighborhood search. "
+              "Float32 halves the memory of the tree."}});
     docstring::ClassMethodDocInject(
             m, "PointCloud", "orient_normals_to_align_with_direction",
             {{"orientation_reference",
@@ -308,7 +337,26 @@ void pybind_pointcloud(py::module &m) {
              {"ransac_n",
               "Number of initial points to be considered inliers in each "
               "iteration."},
-             {"num_iterations", "Number of iterations."}});
+             {"num_iterations", "Number of iterations."},
+             {"probability",
+              "Expected probability of finding the optimal plane. The "
+              "iterations stop early once it is reached."}});
+    docstring::ClassMethodDocInject(
+            m, "PointCloud", "segment_planes",
+            {{"max_planes", "Maximum number of planes to segment."},
+             {"distance_threshold",
+              "Max distance a point can be from the plane model, and still be "
+              "considered an inlier."},
+             {"ransac_n",
+              "Number of initial points to be considered inliers in each "
+              "iteration."},
+             {"num_iterations", "Maximum number of iterations per plane."},
+             {"min_num_inliers",
+              "The segmentation stops at the first plane with fewer "
+              "inliers."},
+             {"probability",
+              "Expected probability of finding the optimal plane. The "
+              "iterations stop early once it is reached."}});
     docstring::ClassMethodDocInject(
             m, "PointCloud", "create_from_depth_image",
             {{"depth",
@@ -325,6 +373,28 @@ void pybind_pointcloud(py::module &m) {
             {{"image", "The input image."},
              {"intrinsic", "Intrinsic parameters of the camera."},
              {"extrnsic", "Extrinsic parameters of the camera."}});
+
+    // open3d.geometry.DepthToPointCloudConverter
+    py::class_<DepthToPointCloudConverter> converter(
+            m, "DepthToPointCloudConverter",
+            "Converts the depth and RGB-D images of a camera to point clouds, "
+            "caching the ray directions of the pixels between frames.");
+    converter
+            .def(py::init<const camera::PinholeCameraIntrinsic &, int>(),
+                 "intrinsic"_a, "stride"_a = 1)
+            .def("create_from_depth_image",
+                 &DepthToPointCloudConverter::CreateFromDepthImage,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Converts a depth image to a point cloud.", "depth"_a,
+                 "extrinsic"_a = Eigen::Matrix4d::Identity(),
+                 "depth_scale"_a = 1000.0, "depth_trunc"_a = 1000.0,
+                 "project_valid_depth_only"_a = true)
+            .def("create_from_rgbd_image",
+                 &DepthToPointCloudConverter::CreateFromRGBDImage,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Converts an RGB-D image to a point cloud.", "image"_a,
+                 "extrinsic"_a = Eigen::Matrix4d::Identity(),
+                 "project_valid_depth_only"_a = true);
 }
 
 void pybind_pointcloud_methods(py::module &m) {}
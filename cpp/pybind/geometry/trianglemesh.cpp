@@ -26,6 +26,7 @@
 
 #include "open3d/geometry/TriangleMesh.h"
 
+#include "open3d/geometry/ARAPDeformer.h"
 #include "open3d/geometry/Image.h"
 #include "open3d/geometry/PointCloud.h"
 #include "pybind/docstring.h"
@@ -84,6 +85,7 @@ void pybind_trianglemesh(py::module &m) {
                  "list is needed")
             .def("remove_duplicated_vertices",
                  &TriangleMesh::RemoveDuplicatedVertices,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function that removes duplicated verties, i.e., vertices "
                  "that have identical coordinates.")
             .def("remove_duplicated_triangles",
@@ -108,6 +110,7 @@ void pybind_trianglemesh(py::module &m) {
                  "area adjacent to the non-manifold edge until the number of "
                  "adjacent triangles to the edge is `<= 2`.")
             .def("merge_close_vertices", &TriangleMesh::MergeCloseVertices,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function that will merge close by vertices to a single one. "
                  "The vertex position, "
                  "normal and color will be the average of the vertices. The "
@@ -117,6 +120,7 @@ void pybind_trianglemesh(py::module &m) {
                  "close triangle soups.",
                  "eps"_a)
             .def("filter_sharpen", &TriangleMesh::FilterSharpen,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to sharpen triangle mesh. The output value "
                  "(:math:`v_o`) is the input value (:math:`v_i`) plus strength "
                  "times the input value minus he sum of he adjacent values. "
@@ -125,6 +129,7 @@ void pybind_trianglemesh(py::module &m) {
                  "number_of_iterations"_a = 1, "strength"_a = 1,
                  "filter_scope"_a = MeshBase::FilterScope::All)
             .def("filter_smooth_simple", &TriangleMesh::FilterSmoothSimple,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to smooth triangle mesh with simple neighbour "
                  "average. :math:`v_o = \\frac{v_i + \\sum_{n \\in N} "
                  "v_n)}{|N| + 1}`, with :math:`v_i` being the input value, "
@@ -134,6 +139,7 @@ void pybind_trianglemesh(py::module &m) {
                  "filter_scope"_a = MeshBase::FilterScope::All)
             .def("filter_smooth_laplacian",
                  &TriangleMesh::FilterSmoothLaplacian,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to smooth triangle mesh using Laplacian. :math:`v_o "
                  "= v_i \\cdot \\lambda (sum_{n \\in N} w_n v_n - v_i)`, with "
                  ":math:`v_i` being the input value, :math:`v_o` the output "
@@ -144,6 +150,7 @@ void pybind_trianglemesh(py::module &m) {
                  "number_of_iterations"_a = 1, "lambda"_a = 0.5,
                  "filter_scope"_a = MeshBase::FilterScope::All)
             .def("filter_smooth_taubin", &TriangleMesh::FilterSmoothTaubin,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to smooth triangle mesh using method of Taubin, "
                  "\"Curve and Surface Smoothing Without Shrinkage\", 1995. "
                  "Applies in each iteration two times filter_smooth_laplacian, "
@@ -193,9 +200,11 @@ void pybind_trianglemesh(py::module &m) {
             .def("is_vertex_manifold", &TriangleMesh::IsVertexManifold,
                  "Tests if all vertices of the triangle mesh are manifold.")
             .def("is_self_intersecting", &TriangleMesh::IsSelfIntersecting,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Tests if the triangle mesh is self-intersecting.")
             .def("get_self_intersecting_triangles",
                  &TriangleMesh::GetSelfIntersectingTriangles,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Returns a list of indices to triangles that intersect the "
                  "mesh.")
             .def("is_intersecting", &TriangleMesh::IsIntersecting,
@@ -238,11 +247,13 @@ void pybind_trianglemesh(py::module &m) {
                  "condition that it is watertight and orientable.")
             .def("sample_points_uniformly",
                  &TriangleMesh::SamplePointsUniformly,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to uniformly sample points from the mesh.",
                  "number_of_points"_a = 100, "use_triangle_normal"_a = false,
                  "seed"_a = -1)
             .def("sample_points_poisson_disk",
                  &TriangleMesh::SamplePointsPoissonDisk,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to sample points from the mesh, where each point "
                  "has "
                  "approximately the same distance to the neighbouring points "
@@ -252,30 +263,44 @@ void pybind_trianglemesh(py::module &m) {
                  "number_of_points"_a, "init_factor"_a = 5, "pcl"_a = nullptr,
                  "use_triangle_normal"_a = false, "seed"_a = -1)
             .def("subdivide_midpoint", &TriangleMesh::SubdivideMidpoint,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function subdivide mesh using midpoint algorithm.",
                  "number_of_iterations"_a = 1)
             .def("subdivide_loop", &TriangleMesh::SubdivideLoop,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function subdivide mesh using Loop's algorithm. Loop, "
                  "\"Smooth "
                  "subdivision surfaces based on triangles\", 1987.",
                  "number_of_iterations"_a = 1)
             .def("simplify_vertex_clustering",
                  &TriangleMesh::SimplifyVertexClustering,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to simplify mesh using vertex clustering.",
                  "voxel_size"_a,
                  "contraction"_a = MeshBase::SimplificationContraction::Average)
             .def("simplify_quadric_decimation",
                  &TriangleMesh::SimplifyQuadricDecimation,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to simplify mesh using Quadric Error Metric "
                  "Decimation by "
                  "Garland and Heckbert",
                  "target_number_of_triangles"_a,
                  "maximum_error"_a = std::numeric_limits<double>::infinity(),
                  "boundary_weight"_a = 1.0)
+            .def("simplify_quadric_decimation_parallel",
+                 &TriangleMesh::SimplifyQuadricDecimationParallel,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Parallel variant of simplify_quadric_decimation for large "
+                 "meshes, which collapses independent edges concurrently.",
+                 "target_number_of_triangles"_a,
+                 "maximum_error"_a = std::numeric_limits<double>::infinity(),
+                 "boundary_weight"_a = 1.0)
             .def("compute_convex_hull", &TriangleMesh::ComputeConvexHull,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Computes the convex hull of the triangle mesh.")
             .def("cluster_connected_triangles",
                  &TriangleMesh::ClusterConnectedTriangles,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function that clusters connected triangles, i.e., triangles "
                  "that are connected via edges are assigned the same cluster "
                  "index.  This function returns an array that contains the "
@@ -307,6 +332,7 @@ void pybind_trianglemesh(py::module &m) {
                  "vertex_mask"_a)
             .def("deform_as_rigid_as_possible",
                  &TriangleMesh::DeformAsRigidAsPossible,
+                 py::call_guard<py::gil_scoped_release>(),
                  "This function deforms the mesh using the method by Sorkine "
                  "and Alexa, "
                  "'As-Rigid-As-Possible Surface Modeling', 2007",
@@ -327,14 +353,29 @@ void pybind_trianglemesh(py::module &m) {
                     "pcd"_a, "alpha"_a)
             .def_static("create_from_point_cloud_alpha_shape",
                         &TriangleMesh::CreateFromPointCloudAlphaShape,
+                        py::call_guard<py::gil_scoped_release>(),
                         "Alpha shapes are a generalization of the convex hull. "
                         "With decreasing alpha value the shape schrinks and "
                         "creates cavities. See Edelsbrunner and Muecke, "
                         "\"Three-Dimensional Alpha Shapes\", 1994.",
                         "pcd"_a, "alpha"_a, "tetra_mesh"_a, "pt_map"_a)
+            .def_static(
+                    "create_from_point_cloud_alpha_shapes",
+                    [](const PointCloud &pcd,
+                       const std::vector<double> &alphas) {
+                        return TriangleMesh::CreateFromPointCloudAlphaShapes(
+                                pcd, alphas);
+                    },
+                    py::call_guard<py::gil_scoped_release>(),
+                    "Computes the alpha shapes for several alpha values, "
+                    "sharing the Delaunay tetrahedralization and the "
+                    "tetrahedra circumradii between them. Returns one mesh "
+                    "per alpha value.",
+                    "pcd"_a, "alphas"_a)
             .def_static(
                     "create_from_point_cloud_ball_pivoting",
                     &TriangleMesh::CreateFromPointCloudBallPivoting,
+                    py::call_guard<py::gil_scoped_release>(),
                     "Function that computes a triangle mesh from a oriented "
                     "PointCloud. This implements the Ball Pivoting algorithm "
                     "proposed in F. Bernardini et al., \"The ball-pivoting "
@@ -348,6 +389,7 @@ void pybind_trianglemesh(py::module &m) {
                     "pcd"_a, "radii"_a)
             .def_static("create_from_point_cloud_poisson",
                         &TriangleMesh::CreateFromPointCloudPoisson,
+                        py::call_guard<py::gil_scoped_release>(),
                         "Function that computes a triangle mesh from a "
                         "oriented PointCloud pcd. This implements the Screened "
                         "Poisson Reconstruction proposed in Kazhdan and Hoppe, "
@@ -355,7 +397,21 @@ void pybind_trianglemesh(py::module &m) {
                         "This function uses the original implementation by "
                         "Kazhdan. See https://github.com/mkazhdan/PoissonRecon",
                         "pcd"_a, "depth"_a = 8, "width"_a = 0, "scale"_a = 1.1,
-                        "linear_fit"_a = false, "n_threads"_a = -1)
+                        "linear_fit"_a = false, "n_threads"_a = -1,
+                        "density_quantile"_a = 0.0)
+            .def_static("create_from_point_cloud_poisson_tiled",
+                        &TriangleMesh::CreateFromPointCloudPoissonTiled,
+                        py::call_guard<py::gil_scoped_release>(),
+                        "Function that computes a triangle mesh from an "
+                        "oriented PointCloud pcd with the Screened Poisson "
+                        "Reconstruction, tile by tile. Each tile is "
+                        "reconstructed from the points within overlap of it, "
+                        "one after the other, so the memory is bounded by the "
+                        "largest tile. The seams between the tiles are not "
+                        "welded.",
+                        "pcd"_a, "tile_size"_a, "overlap"_a, "depth"_a = 8,
+                        "linear_fit"_a = false, "n_threads"_a = -1,
+                        "density_quantile"_a = 0.0)
             .def_static("create_box", &TriangleMesh::CreateBox,
                         "Factory function to create a box. The left bottom "
                         "corner on the "
@@ -613,6 +669,18 @@ void pybind_trianglemesh(py::module &m) {
              {"boundary_weight",
               "A weight applied to edge vertices used to preserve "
               "boundaries"}});
+    docstring::ClassMethodDocInject(
+            m, "TriangleMesh", "simplify_quadric_decimation_parallel",
+            {{"target_number_of_triangles",
+              "The number of triangles that the simplified mesh should have. "
+              "It is not guaranteed that this number will be reached."},
+             {"maximum_error",
+              "The maximum error where a vertex is allowed to be merged. With "
+              "a target of 0 triangles, the mesh is simplified until no edge "
+              "can be collapsed within this error."},
+             {"boundary_weight",
+              "A weight applied to edge vertices used to preserve "
+              "boundaries"}});
     docstring::ClassMethodDocInject(m, "TriangleMesh", "compute_convex_hull");
     docstring::ClassMethodDocInject(m, "TriangleMesh",
                                     "cluster_connected_triangles");
@@ -695,7 +763,33 @@ void pybind_trianglemesh(py::module &m) {
               "estimate the positions of iso-vertices."},
              {"n_threads",
               "Number of threads used for reconstruction. Set to -1 to "
-              "automatically determine it."}});
+              "automatically determine it."},
+             {"density_quantile",
+              "The vertices whose density is below this quantile of the "
+              "densities are removed with their triangles. 0 keeps all the "
+              "vertices."}});
+    docstring::ClassMethodDocInject(
+            m, "TriangleMesh", "create_from_point_cloud_poisson_tiled",
+            {{"pcd",
+              "PointCloud from which the TriangleMesh surface is "
+              "reconstructed. Has to contain normals."},
+             {"tile_size", "Edge length of the cubic tiles."},
+             {"overlap",
+              "Minimum distance by which the reconstruction of a tile extends "
+              "beyond the tile."},
+             {"depth",
+              "Maximum depth of the octree of each tile, whose cube is about "
+              "tile_size + 2 * overlap wide."},
+             {"linear_fit",
+              "If true, the reconstructor will use linear interpolation to "
+              "estimate the positions of iso-vertices."},
+             {"n_threads",
+              "Number of threads used for reconstruction. Set to -1 to "
+              "automatically determine it."},
+             {"density_quantile",
+              "The vertices whose density is below this quantile of the "
+              "densities are removed with their triangles. 0 keeps all the "
+              "vertices."}});
     docstring::ClassMethodDocInject(m, "TriangleMesh", "create_box",
                                     {{"width", "x-directional length."},
                                      {"height", "y-directional length."},
@@ -781,6 +875,25 @@ void pybind_trianglemesh(py::module &m) {
              {"flatness", "Controls the flatness/height of the Moebius strip."},
              {"width", "Width of the Moebius strip."},
              {"scale", "Scale the complete Moebius strip."}});
+
+    // open3d.geometry.ARAPDeformer
+    py::class_<ARAPDeformer> arap_deformer(
+            m, "ARAPDeformer",
+            "Deforms a mesh as rigid as possible, reusing the factorization "
+            "and the previous solution between calls.");
+    arap_deformer
+            .def(py::init<const TriangleMesh &,
+                          MeshBase::DeformAsRigidAsPossibleEnergy, double>(),
+                 "mesh"_a,
+                 "energy"_a = MeshBase::DeformAsRigidAsPossibleEnergy::Spokes,
+                 "smoothed_alpha"_a = 0.01)
+            .def("deform", &ARAPDeformer::Deform,
+                 "Deforms the rest mesh to satisfy the constraints, starting "
+                 "from the previous deformation.",
+                 "constraint_vertex_indices"_a, "constraint_vertex_positions"_a,
+                 "max_iter"_a)
+            .def("reset", &ARAPDeformer::Reset,
+                 "Restarts the next deformation from the rest mesh.");
 }
 
 void pybind_trianglemesh_methods(py::module &m) {}
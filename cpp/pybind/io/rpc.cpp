@@ -24,9 +24,11 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/io/rpc/AsyncConnection.h"
 #include "open3d/io/rpc/Connection.h"
 #include "open3d/io/rpc/DummyReceiver.h"
 #include "open3d/io/rpc/RemoteFunctions.h"
+#include "open3d/io/rpc/SharedMemoryConnection.h"
 #include "open3d/io/rpc/ZMQContext.h"
 #include "pybind/docstring.h"
 #include "pybind/open3d_pybind.h"
@@ -57,6 +59,45 @@ void pybind_rpc(py::module& m_io) {
                  "address"_a = "tcp://127.0.0.1:51454",
                  "connect_timeout"_a = 5000, "timeout"_a = 10000);
 
+    py::class_<rpc::AsyncConnection, std::shared_ptr<rpc::AsyncConnection>,
+               rpc::ConnectionBase>(
+            m, "AsyncConnection",
+            "Connection which sends messages without waiting for the "
+            "replies. At most max_in_flight messages await a reply and as "
+            "many wait in a queue. Sending to a full queue blocks, or drops "
+            "the oldest queued message if drop_oldest is True.")
+            .def(py::init([](std::string address, int connect_timeout,
+                             int timeout, int max_in_flight, bool drop_oldest) {
+                     return std::shared_ptr<rpc::AsyncConnection>(
+                             new rpc::AsyncConnection(address, connect_timeout,
+                                                      timeout, max_in_flight,
+                                                      drop_oldest));
+                 }),
+                 "Creates an asynchronous connection object",
+                 "address"_a = "tcp://127.0.0.1:51454",
+                 "connect_timeout"_a = 5000, "timeout"_a = 10000,
+                 "max_in_flight"_a = 4, "drop_oldest"_a = false)
+            .def("flush", &rpc::AsyncConnection::Flush,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Blocks until all messages are replied to, dropped or "
+                 "failed.");
+
+    py::class_<rpc::SharedMemoryConnection,
+               std::shared_ptr<rpc::SharedMemoryConnection>,
+               rpc::ConnectionBase>(
+            m, "SharedMemoryConnection",
+            "Connection to a receiver on the same host, which passes large "
+            "arrays through shared memory instead of the socket.")
+            .def(py::init([](std::string address, int connect_timeout,
+                             int timeout) {
+                     return std::shared_ptr<rpc::SharedMemoryConnection>(
+                             new rpc::SharedMemoryConnection(
+                                     address, connect_timeout, timeout));
+                 }),
+                 "Creates a shared memory connection object",
+                 "address"_a = "ipc:///tmp/open3d_ipc",
+                 "connect_timeout"_a = 5000, "timeout"_a = 10000);
+
     py::class_<rpc::DummyReceiver, std::shared_ptr<rpc::DummyReceiver>>(
             m, "_DummyReceiver",
             "Dummy receiver for the server side receiving requests from a "
@@ -141,6 +182,68 @@ void pybind_rpc(py::module& m_io) {
                      "the connection."},
             });
 
+    m.def("append_mesh_data", &rpc::AppendMeshData, "vertices"_a,
+          "path"_a = "", "time"_a = 0, "layer"_a = "",
+          "vertex_attributes"_a = std::map<std::string, core::Tensor>(),
+          "faces"_a = core::Tensor({0}, core::Dtype::Int32),
+          "connection"_a = std::shared_ptr<rpc::ConnectionBase>(),
+          "Appends vertices and faces to the mesh data at a path.");
+    docstring::FunctionDocInject(
+            m, "append_mesh_data",
+            {
+                    {"vertices", "Tensor defining the new vertices."},
+                    {"path", "A path descriptor, e.g., 'mygroup/points'."},
+                    {"time", "The time associated with this data."},
+                    {"layer", "The layer associated with this data."},
+                    {"vertex_attributes",
+                     "dict of Tensors with the attributes of the new "
+                     "vertices, which must match the existing attributes."},
+                    {"faces",
+                     "Tensor defining the new triangles with indices of all "
+                     "vertices."},
+                    {"connection",
+                     "A Connection object. Use None to automatically create "
+                     "the connection."},
+            });
+
+    m.def("set_vertex_attribute_range", &rpc::SetVertexAttributeRange,
+          "attribute"_a, "values"_a, "start"_a, "path"_a = "", "time"_a = 0,
+          "layer"_a = "",
+          "connection"_a = std::shared_ptr<rpc::ConnectionBase>(),
+          "Overwrites a range of vertices of the mesh data at a path.");
+    docstring::FunctionDocInject(
+            m, "set_vertex_attribute_range",
+            {
+                    {"attribute",
+                     "Name of the vertex attribute, e.g. 'colors', or "
+                     "'vertices' for the positions."},
+                    {"values", "Tensor with the new values."},
+                    {"start", "Index of the first vertex to overwrite."},
+                    {"path", "A path descriptor, e.g., 'mygroup/points'."},
+                    {"time", "The time associated with this data."},
+                    {"layer", "The layer associated with this data."},
+                    {"connection",
+                     "A Connection object. Use None to automatically create "
+                     "the connection."},
+            });
+
+    m.def("remove_vertices", &rpc::RemoveVertices, "indices"_a, "path"_a = "",
+          "time"_a = 0, "layer"_a = "",
+          "connection"_a = std::shared_ptr<rpc::ConnectionBase>(),
+          "Removes vertices and the faces using them from the mesh data at "
+          "a path.");
+    docstring::FunctionDocInject(
+            m, "remove_vertices",
+            {
+                    {"indices", "Tensor with the indices of the vertices."},
+                    {"path", "A path descriptor, e.g., 'mygroup/points'."},
+                    {"time", "The time associated with this data."},
+                    {"layer", "The layer associated with this data."},
+                    {"connection",
+                     "A Connection object. Use None to automatically create "
+                     "the connection."},
+            });
+
     m.def("set_legacy_camera", &rpc::SetLegacyCamera, "camera"_a, "path"_a = "",
           "time"_a = 0, "layer"_a = "",
           "connection"_a = std::shared_ptr<rpc::ConnectionBase>(),
@@ -113,6 +113,12 @@ void pybind_sensor(py::module &m) {
                  "Attempt to create and open an mkv file.")
             .def("close_record", &AzureKinectRecorder::CloseRecord,
                  "Close the recorded mkv file.")
+            .def("set_write_queue_size",
+                 &AzureKinectRecorder::SetWriteQueueSize, "queue_size"_a,
+                 "Write the captures to the mkv file from a background "
+                 "thread, with up to queue_size captures waiting to be "
+                 "written. 0 writes them in record_frame(). Call before "
+                 "open_record().")
             .def("record_frame", &AzureKinectRecorder::RecordFrame,
                  "enable_record"_a, "enable_align_depth_to_color"_a,
                  "Record a frame to mkv if flag is on and return an RGBD "
@@ -41,6 +41,9 @@ void pybind_contrib_nns(py::module& m_contrib) {
     m_contrib.def("radius_search", &RadiusSearch, "query_points"_a,
                   "dataset_points"_a, "query_batches"_a, "dataset_batches"_a,
                   "radius"_a);
+    m_contrib.def("batch_radius_neighbors", &BatchRadiusNeighbors,
+                  "queries"_a, "supports"_a, "queries_row_splits"_a,
+                  "supports_row_splits"_a, "radius"_a);
 }
 
 }  // namespace contrib
@@ -25,6 +25,7 @@
 // ----------------------------------------------------------------------------
 
 #include "open3d/ml/contrib/GridSubsampling.h"
+#include "open3d/ml/contrib/contrib_subsample.h"
 #include "pybind/core/tensor_converter.h"
 #include "pybind/docstring.h"
 #include "pybind/ml/contrib/contrib.h"
@@ -373,6 +374,10 @@ void pybind_contrib_subsample(py::module& m_contrib) {
                   "features"_a = py::none(), "classes"_a = py::none(),
                   "sampleDl"_a = 0.1, "method"_a = "barycenters", "max_p"_a = 0,
                   "verbose"_a = 0);
+
+    m_contrib.def("batch_grid_subsampling", &BatchGridSubsampling, "points"_a,
+                  "row_splits"_a, "features"_a = py::none(),
+                  "classes"_a = py::none(), "sampleDl"_a = 0.1, "max_p"_a = 0);
 }
 
 }  // namespace contrib
@@ -191,9 +191,11 @@ void pybind_color_map_options(py::module &m) {
 
 void pybind_color_map_classes(py::module &m) {
     m.def("run_rigid_optimizer", &pipelines::color_map::RunRigidOptimizer,
+          py::call_guard<py::gil_scoped_release>(),
           "Run rigid optimization.");
     m.def("run_non_rigid_optimizer",
           &pipelines::color_map::RunNonRigidOptimizer,
+          py::call_guard<py::gil_scoped_release>(),
           "Run non-rigid optimization.");
 }
 
@@ -58,6 +58,21 @@ public:
                                source, target, source_xyz, target_dx, target_dy,
                                extrinsic, corresps, intrinsic);
     }
+    // Python subclasses only override the rows, so they are accumulated one
+    // at a time even if the base class is a batched term.
+    std::tuple<Eigen::Matrix6d, Eigen::Vector6d, double> ComputeJTJandJTr(
+            const geometry::RGBDImage &source,
+            const geometry::RGBDImage &target,
+            const geometry::Image &source_xyz,
+            const geometry::RGBDImage &target_dx,
+            const geometry::RGBDImage &target_dy,
+            const Eigen::Matrix3d &intrinsic,
+            const Eigen::Matrix4d &extrinsic,
+            const CorrespondenceSetPixelWise &corresps) const override {
+        return RGBDOdometryJacobian::ComputeJTJandJTr(
+                source, target, source_xyz, target_dx, target_dy, intrinsic,
+                extrinsic, corresps);
+    }
 };
 
 void pybind_odometry_classes(py::module &m) {
@@ -174,10 +189,32 @@ Anonymous submission.)");
             "__repr__", [](const RGBDOdometryJacobianFromHybridTerm &te) {
                 return std::string("RGBDOdometryJacobianFromHybridTerm");
             });
+
+    // open3d.odometry.RGBDOdometryTracker
+    py::class_<RGBDOdometryTracker> tracker(
+            m, "RGBDOdometryTracker",
+            "RGB-D odometry over a sequence of frames, which preprocesses "
+            "each frame once for the two pairs it belongs to.");
+    tracker.def(py::init<const camera::PinholeCameraIntrinsic &,
+                         const OdometryOption &>(),
+                "pinhole_camera_intrinsic"_a, "option"_a = OdometryOption())
+            .def("track", &RGBDOdometryTracker::Track,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Estimates the motion from the previous frame to the given "
+                 "one. Output: (is_success, 4x4 motion matrix, 6x6 "
+                 "information matrix), unsuccessful for the first frame.",
+                 "rgbd"_a, "odo_init"_a = Eigen::Matrix4d::Identity(),
+                 "jacobian"_a = RGBDOdometryJacobianFromHybridTerm())
+            .def("reset", &RGBDOdometryTracker::Reset,
+                 "Forgets the previous frame.")
+            .def("has_previous_frame", &RGBDOdometryTracker::HasPreviousFrame,
+                 "Returns True if a frame has been tracked since the last "
+                 "reset.");
 }
 
 void pybind_odometry_methods(py::module &m) {
     m.def("compute_rgbd_odometry", &ComputeRGBDOdometry,
+          py::call_guard<py::gil_scoped_release>(),
           "Function to estimate 6D rigid motion from two RGBD image pairs. "
           "Output: (is_success, 4x4 motion matrix, 6x6 information matrix).",
           "rgbd_source"_a, "rgbd_target"_a,
@@ -30,10 +30,12 @@
 #include <utility>
 
 #include "open3d/geometry/PointCloud.h"
+#include "open3d/pipelines/registration/BatchRegistration.h"
 #include "open3d/pipelines/registration/ColoredICP.h"
 #include "open3d/pipelines/registration/CorrespondenceChecker.h"
 #include "open3d/pipelines/registration/FastGlobalRegistration.h"
 #include "open3d/pipelines/registration/Feature.h"
+#include "open3d/pipelines/registration/PoseGraph.h"
 #include "open3d/pipelines/registration/RobustKernel.h"
 #include "open3d/pipelines/registration/TransformationEstimation.h"
 #include "open3d/utility/Console.h"
@@ -79,6 +81,26 @@ public:
         PYBIND11_OVERLOAD_PURE(bool, CorrespondenceCheckerBase, source, target,
                                corres, transformation);
     }
+    void CheckBatch(
+            const geometry::PointCloud &source,
+            const geometry::PointCloud &target,
+            const CorrespondenceSet &corres,
+            const std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>
+                    &transformations,
+            std::vector<uint8_t> &mask) const override {
+        // A Check() overridden in Python must see every hypothesis, so the
+        // batched checks of the built-in checkers are bypassed.
+        py::gil_scoped_acquire gil;
+        py::function check = py::get_overload(
+                static_cast<const CorrespondenceCheckerBase *>(this), "Check");
+        if (check) {
+            CorrespondenceChecker::CheckBatch(source, target, corres,
+                                              transformations, mask);
+        } else {
+            CorrespondenceCheckerBase::CheckBatch(source, target, corres,
+                                                  transformations, mask);
+        }
+    }
 };
 
 void pybind_registration_classes(py::module &m) {
@@ -512,6 +534,34 @@ must hold true for all edges.)");
                         rr.fitness_, rr.inlier_rmse_,
                         rr.correspondence_set_.size());
             });
+
+    // open3d.registration.BatchRegistrationOption
+    py::class_<BatchRegistrationOption> batch_option(
+            m, "BatchRegistrationOption",
+            "Options for the scheduling of batches of pairwise "
+            "registrations. The pairs are distributed over ``num_workers`` "
+            "threads, and each registration uses ``threads_per_worker`` "
+            "threads.");
+    py::detail::bind_copy_functions<BatchRegistrationOption>(batch_option);
+    batch_option
+            .def(py::init([](int num_workers, int threads_per_worker) {
+                     return new BatchRegistrationOption(num_workers,
+                                                        threads_per_worker);
+                 }),
+                 "num_workers"_a = 0, "threads_per_worker"_a = 1)
+            .def_readwrite("num_workers",
+                           &BatchRegistrationOption::num_workers_,
+                           "int: Number of pairs registered concurrently, or "
+                           "0 for the maximum number of threads.")
+            .def_readwrite("threads_per_worker",
+                           &BatchRegistrationOption::threads_per_worker_,
+                           "int: Number of threads of each registration.")
+            .def("__repr__", [](const BatchRegistrationOption &c) {
+                return fmt::format(
+                        "BatchRegistrationOption class "
+                        "with num_workers={:d} and threads_per_worker={:d}",
+                        c.num_workers_, c.threads_per_worker_);
+            });
 }
 
 // Registration functions have similar arguments, sharing arg docstrings
@@ -543,6 +593,9 @@ static const std::unordered_map<std::string, std::string>
                  "``"
                  "TransformationEstimationForColoredICP``)"},
                 {"init", "Initial transformation estimation"},
+                {"inits",
+                 "Initial transformation of each pair, or empty for the "
+                 "identity."},
                 {"lambda_geometric", "lambda_geometric value"},
                 {"kernel", "Robust Kernel used in the Optimization"},
                 {"max_correspondence_distance",
@@ -551,6 +604,13 @@ static const std::unordered_map<std::string, std::string>
                  "Enables mutual filter such that the correspondence of the "
                  "source point's correspondence is itself."},
                 {"option", "Registration option"},
+                {"pairs",
+                 "List of (source, target) index pairs into "
+                 "``point_clouds``."},
+                {"point_clouds", "The point clouds."},
+                {"precision",
+                 "Scalar type of the KDTree built on the target. Float32 "
+                 "halves the memory of the tree."},
                 {"ransac_n", "Fit ransac with ``ransac_n`` correspondences"},
                 {"source_feature", "Source point cloud feature."},
                 {"source", "The source point cloud."},
@@ -562,21 +622,26 @@ static const std::unordered_map<std::string, std::string>
 
 void pybind_registration_methods(py::module &m) {
     m.def("evaluate_registration", &EvaluateRegistration,
+          py::call_guard<py::gil_scoped_release>(),
           "Function for evaluating registration between point clouds",
           "source"_a, "target"_a, "max_correspondence_distance"_a,
-          "transformation"_a = Eigen::Matrix4d::Identity());
+          "transformation"_a = Eigen::Matrix4d::Identity(),
+          "precision"_a = geometry::KDTreeFlann::Precision::Float64);
     docstring::FunctionDocInject(m, "evaluate_registration",
                                  map_shared_argument_docstrings);
 
     m.def("registration_icp", &RegistrationICP, "Function for ICP registration",
+          py::call_guard<py::gil_scoped_release>(),
           "source"_a, "target"_a, "max_correspondence_distance"_a,
           "init"_a = Eigen::Matrix4d::Identity(),
           "estimation_method"_a = TransformationEstimationPointToPoint(false),
-          "criteria"_a = ICPConvergenceCriteria());
+          "criteria"_a = ICPConvergenceCriteria(),
+          "precision"_a = geometry::KDTreeFlann::Precision::Float64);
     docstring::FunctionDocInject(m, "registration_icp",
                                  map_shared_argument_docstrings);
 
     m.def("registration_colored_icp", &RegistrationColoredICP,
+          py::call_guard<py::gil_scoped_release>(),
           "Function for Colored ICP registration", "source"_a, "target"_a,
           "max_correspondence_distance"_a,
           "init"_a = Eigen::Matrix4d::Identity(),
@@ -587,6 +652,7 @@ void pybind_registration_methods(py::module &m) {
 
     m.def("registration_ransac_based_on_correspondence",
           &RegistrationRANSACBasedOnCorrespondence,
+          py::call_guard<py::gil_scoped_release>(),
           "Function for global RANSAC registration based on a set of "
           "correspondences",
           "source"_a, "target"_a, "corres"_a, "max_correspondence_distance"_a,
@@ -601,6 +667,7 @@ void pybind_registration_methods(py::module &m) {
 
     m.def("registration_ransac_based_on_feature_matching",
           &RegistrationRANSACBasedOnFeatureMatching,
+          py::call_guard<py::gil_scoped_release>(),
           "Function for global RANSAC registration based on feature matching",
           "source"_a, "target"_a, "source_feature"_a, "target_feature"_a,
           "mutual_filter"_a, "max_correspondence_distance"_a,
@@ -615,6 +682,7 @@ void pybind_registration_methods(py::module &m) {
 
     m.def("registration_fast_based_on_feature_matching",
           &FastGlobalRegistration,
+          py::call_guard<py::gil_scoped_release>(),
           "Function for fast global registration based on feature matching",
           "source"_a, "target"_a, "source_feature"_a, "target_feature"_a,
           "option"_a = FastGlobalRegistrationOption());
@@ -624,12 +692,37 @@ void pybind_registration_methods(py::module &m) {
 
     m.def("get_information_matrix_from_point_clouds",
           &GetInformationMatrixFromPointClouds,
+          py::call_guard<py::gil_scoped_release>(),
           "Function for computing information matrix from transformation "
           "matrix",
           "source"_a, "target"_a, "max_correspondence_distance"_a,
           "transformation"_a);
     docstring::FunctionDocInject(m, "get_information_matrix_from_point_clouds",
                                  map_shared_argument_docstrings);
+
+    m.def("registration_icp_batch", &RegistrationICPBatch,
+          py::call_guard<py::gil_scoped_release>(),
+          "Function for ICP registration of a batch of pairs of point clouds",
+          "point_clouds"_a, "pairs"_a, "max_correspondence_distance"_a,
+          "inits"_a = temp_eigen_matrix4d(),
+          "estimation_method"_a = TransformationEstimationPointToPoint(false),
+          "criteria"_a = ICPConvergenceCriteria(),
+          "option"_a = BatchRegistrationOption());
+    docstring::FunctionDocInject(m, "registration_icp_batch",
+                                 map_shared_argument_docstrings);
+
+    m.def("create_pose_graph_from_pairwise_icp",
+          &CreatePoseGraphFromPairwiseICP,
+          py::call_guard<py::gil_scoped_release>(),
+          "Function to create a pose graph from the ICP registration of "
+          "pairs of point clouds. A pair (i, i + 1) gives an odometry edge, "
+          "the other pairs give uncertain loop closure edges.",
+          "point_clouds"_a, "pairs"_a, "max_correspondence_distance"_a,
+          "estimation_method"_a = TransformationEstimationPointToPoint(false),
+          "criteria"_a = ICPConvergenceCriteria(),
+          "option"_a = BatchRegistrationOption());
+    docstring::FunctionDocInject(m, "create_pose_graph_from_pairwise_icp",
+                                 map_shared_argument_docstrings);
 }
 
 void pybind_registration(py::module &m) {
@@ -41,11 +41,20 @@ core::Dtype ArrayFormatToDtype(const std::string& format, size_t byte_size) {
     //
     // However, some integer dtypes have aliases. E.g. "l" can be 4 bytes or 8
     // bytes depending on the OS. To be safe, we always check the byte size.
-    if (format == py::format_descriptor<float>::format() && byte_size == 4) {
+    if (format == "e" && byte_size == 2) {
+        return core::Dtype::Float16;
+    } else if (format == py::format_descriptor<float>::format() &&
+               byte_size == 4) {
         return core::Dtype::Float32;
     } else if (format == py::format_descriptor<double>::format() &&
                byte_size == 8) {
         return core::Dtype::Float64;
+    } else if (format == py::format_descriptor<int8_t>::format() &&
+               byte_size == 1) {
+        return core::Dtype::Int8;
+    } else if (format == py::format_descriptor<int16_t>::format() &&
+               byte_size == 2) {
+        return core::Dtype::Int16;
     } else if ((format == py::format_descriptor<int32_t>::format() ||
                 format == "i" || format == "l") &&
                byte_size == 4) {
@@ -72,10 +81,17 @@ core::Dtype ArrayFormatToDtype(const std::string& format, size_t byte_size) {
 }
 
 std::string DtypeToArrayFormat(const core::Dtype& dtype) {
-    if (dtype == core::Dtype::Float32) {
+    if (dtype == core::Dtype::Float16) {
+        // pybind11 has no format_descriptor for half precision floats.
+        return "e";
+    } else if (dtype == core::Dtype::Float32) {
         return py::format_descriptor<float>::format();
     } else if (dtype == core::Dtype::Float64) {
         return py::format_descriptor<double>::format();
+    } else if (dtype == core::Dtype::Int8) {
+        return py::format_descriptor<int8_t>::format();
+    } else if (dtype == core::Dtype::Int16) {
+        return py::format_descriptor<int16_t>::format();
     } else if (dtype == core::Dtype::Int32) {
         return py::format_descriptor<int32_t>::format();
     } else if (dtype == core::Dtype::Int64) {
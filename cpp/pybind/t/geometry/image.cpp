@@ -111,6 +111,55 @@ void pybind_image(py::module &m) {
                  "Compute max 2D coordinates for the data ({rows, cols}).")
             .def("__repr__", &Image::ToString);
 
+    // Image processing.
+    py::enum_<Image::InterpType>(image, "InterpType",
+                                 "Interpolation used to resize images.")
+            .value("Nearest", Image::InterpType::Nearest)
+            .value("Linear", Image::InterpType::Linear)
+            .export_values();
+    image.def("to", &Image::To, "dtype"_a, "copy"_a = false,
+              "scale"_a = py::none(), "offset"_a = 0.0,
+              "Returns an image of the given dtype, with the values "
+              "transformed as value * scale + offset. Integer results are "
+              "rounded and saturated.")
+            .def("clip_transform", &Image::ClipTransform, "scale"_a,
+                 "min_value"_a, "max_value"_a, "clip_fill"_a = 0.0f,
+                 "Returns a Float32 image of the values divided by scale, "
+                 "where the values that are not in (min_value, max_value) are "
+                 "set to clip_fill.")
+            .def("filter", &Image::Filter, "kernel"_a,
+                 "Convolves each channel with a Float32 2D kernel of odd "
+                 "sizes.")
+            .def("filter_gaussian", &Image::FilterGaussian,
+                 "kernel_size"_a = 3, "sigma"_a = 1.0f, "Gaussian filter.")
+            .def("filter_bilateral", &Image::FilterBilateral,
+                 "kernel_size"_a = 3, "value_sigma"_a = 20.0f,
+                 "distance_sigma"_a = 10.0f, "Bilateral filter.")
+            .def("filter_bilateral_depth", &Image::FilterBilateralDepth,
+                 "kernel_size"_a = 5, "depth_sigma"_a = 20.0f,
+                 "distance_sigma"_a = 3.0f,
+                 "Bilateral filter of a depth image, which averages only "
+                 "the valid depths.")
+            .def("register_depth", &Image::RegisterDepth, "depth_intrinsic"_a,
+                 "target_intrinsic"_a, "extrinsic"_a, "rows"_a, "cols"_a,
+                 "depth_scale"_a = 1000.0f,
+                 "Reprojects this depth image to another camera, keeping the "
+                 "nearest depth of each pixel.")
+            .def("filter_sobel", &Image::FilterSobel, "kernel_size"_a = 3,
+                 "Returns the Float32 gradients along the columns and the "
+                 "rows computed by the Sobel operator.")
+            .def("pyrdown", &Image::PyrDown,
+                 "Returns the half resolution image of the next pyramid "
+                 "level.")
+            .def("pyrdown_depth", &Image::PyrDownDepth, "diff_threshold"_a,
+                 "invalid_fill"_a = 0.0f,
+                 "Returns the half resolution depth image of the next "
+                 "pyramid level, without blurring the depth "
+                 "discontinuities.")
+            .def("resize", &Image::Resize, "sampling_rate"_a = 0.5f,
+                 "interp_type"_a = Image::InterpType::Nearest,
+                 "Returns the image resized by sampling_rate.");
+
     // Conversion.
     image.def("to_legacy_image", &Image::ToLegacyImage,
               "Convert to legacy Image type.");
@@ -28,6 +28,7 @@
 
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "pybind/t/geometry/geometry.h"
 
@@ -63,22 +64,144 @@ void pybind_pointcloud(py::module& m) {
                    "Returns the min bound for point coordinates.");
     pointcloud.def("get_max_bound", &PointCloud::GetMaxBound,
                    "Returns the max bound for point coordinates.");
+    pointcloud.def("get_min_max_bound", &PointCloud::GetMinMaxBound,
+                   "Returns the min and max bounds for point coordinates, "
+                   "computed in a single pass.");
     pointcloud.def("get_center", &PointCloud::GetCenter,
                    "Returns the center for point coordinates.");
     pointcloud.def("transform", &PointCloud::Transform, "transformation"_a,
                    "Transforms the points and normals (if exist).");
+    pointcloud.def_static(
+            "batch_transform",
+            [](std::vector<PointCloud> pointclouds,
+               const core::Tensor& transformations) {
+                PointCloud::BatchTransform(pointclouds, transformations);
+                return pointclouds;
+            },
+            "pointclouds"_a, "transformations"_a,
+            "Transforms each point cloud by its own transformation of the "
+            "{k, 4, 4} transformations tensor, in a single kernel launch, and "
+            "returns them.");
     pointcloud.def("translate", &PointCloud::Translate, "translation"_a,
                    "relative"_a = true, "Translates points.");
     pointcloud.def("scale", &PointCloud::Scale, "scale"_a, "center"_a,
                    "Scale points.");
     pointcloud.def("rotate", &PointCloud::Rotate, "R"_a, "center"_a,
                    "Rotate points and normals (if exist).");
+    pointcloud.def("append", &PointCloud::Append, "other"_a,
+                   "Appends the points of other in-place, with amortized "
+                   "linear time over repeated appends.");
+    pointcloud.def("shrink", &PointCloud::Shrink,
+                   "Releases the memory reserved by append.");
+    pointcloud.def("voxel_down_sample", &PointCloud::VoxelDownSample,
+                   py::call_guard<py::gil_scoped_release>(),
+                   "voxel_size"_a,
+                   "Downsamples the pointcloud with a voxel grid, averaging "
+                   "the attributes of the points in each voxel.");
+    pointcloud.def("select_by_mask", &PointCloud::SelectByMask, "mask"_a,
+                   "invert"_a = false,
+                   "Selects the points where the Bool mask is true.");
+    pointcloud.def("select_by_index", &PointCloud::SelectByIndex,
+                   "indices"_a, "invert"_a = false,
+                   "Selects the points of the Int64 indices.");
+    pointcloud.def("crop",
+                   (PointCloud(PointCloud::*)(
+                           const open3d::geometry::AxisAlignedBoundingBox &)
+                            const) &
+                           PointCloud::Crop,
+                   "bounding_box"_a,
+                   "Crops the pointcloud to the points inside the box.");
+    pointcloud.def("crop",
+                   (PointCloud(PointCloud::*)(
+                           const open3d::geometry::OrientedBoundingBox &)
+                            const) &
+                           PointCloud::Crop,
+                   "bounding_box"_a,
+                   "Crops the pointcloud to the points inside the box.");
+    pointcloud.def("estimate_normals", &PointCloud::EstimateNormals,
+                   "max_nn"_a = 30, "radius"_a = py::none(),
+                   "Estimates the normals from the covariance of the "
+                   "neighborhood of each point. Existing normals are used to "
+                   "orient the new ones. If radius is given, neighbors farther "
+                   "than radius are ignored.");
+    pointcloud.def("orient_normals_towards_camera_location",
+                   &PointCloud::OrientNormalsTowardsCameraLocation,
+                   "camera_location"_a =
+                           core::Tensor::Zeros({3}, core::Dtype::Float32),
+                   "Orients the normals towards the camera location.");
+    pointcloud.def("orient_normals_consistent_tangent_plane",
+                   &PointCloud::OrientNormalsConsistentTangentPlane, "k"_a,
+                   "Consistently orients the normals by propagating them "
+                   "along a minimum spanning tree of the k nearest neighbor "
+                   "graph.");
+    pointcloud.def("remove_radius_outliers", &PointCloud::RemoveRadiusOutliers,
+                   "nb_points"_a, "search_radius"_a,
+                   "Removes the points that have less than nb_points "
+                   "neighbors in a sphere of radius search_radius. Returns "
+                   "the kept points and the boolean mask of the kept points.");
+    pointcloud.def("remove_statistical_outliers",
+                   &PointCloud::RemoveStatisticalOutliers, "nb_neighbors"_a,
+                   "std_ratio"_a,
+                   "Removes the points that are further away from their "
+                   "neighbors than the average. Returns the kept points and "
+                   "the boolean mask of the kept points.");
+    pointcloud.def("compute_iss_keypoints", &PointCloud::ComputeISSKeypoints,
+                   "salient_radius"_a = 0.0, "non_max_radius"_a = 0.0,
+                   "gamma_21"_a = 0.975, "gamma_32"_a = 0.975,
+                   "min_neighbors"_a = 5,
+                   "Detects the ISS keypoints. Returns the keypoints and the "
+                   "boolean mask of the keypoints.");
+    pointcloud.def("compute_point_cloud_distance",
+                   &PointCloud::ComputePointCloudDistance, "target"_a,
+                   "max_distance"_a = 0.0,
+                   "For each point, computes the distance to the closest "
+                   "point of the target point cloud.");
+    pointcloud.def("hidden_point_removal", &PointCloud::HiddenPointRemoval,
+                   "camera_locations"_a, "radius"_a,
+                   "Returns the Bool masks of shape (k, n) of the points "
+                   "visible from each of the k camera locations.");
+    pointcloud.def("segment_plane", &PointCloud::SegmentPlane,
+                   "distance_threshold"_a = 0.01, "ransac_n"_a = 3,
+                   "num_iterations"_a = 100, "probability"_a = 0.99999999,
+                   "Segments a plane with RANSAC. Returns the Float64 plane "
+                   "model (a, b, c, d) and the Int64 indices of the inliers.");
+    pointcloud.def("segment_planes", &PointCloud::SegmentPlanes,
+                   "max_planes"_a, "distance_threshold"_a = 0.01,
+                   "ransac_n"_a = 3, "num_iterations"_a = 100,
+                   "min_num_inliers"_a = 3, "probability"_a = 0.99999999,
+                   "Segments up to max_planes planes, removing the inliers "
+                   "of each plane found. Returns a list of (plane_model, "
+                   "inliers).");
+    pointcloud.def("cluster_dbscan", &PointCloud::ClusterDBSCAN, "eps"_a,
+                   "min_points"_a, "print_progress"_a = false,
+                   "Clusters the points with DBSCAN. Returns the Int32 labels "
+                   "of the points, -1 for the noise.");
+    pointcloud.def("get_cluster_axis_aligned_bounding_boxes",
+                   &PointCloud::GetClusterAxisAlignedBoundingBoxes, "labels"_a,
+                   "Computes the axis-aligned bounding box of every cluster. "
+                   "Returns the (min_bound, max_bound) tensors of shape "
+                   "{k, 3}, ignoring the negative labels.");
+    pointcloud.def("get_cluster_oriented_bounding_boxes",
+                   &PointCloud::GetClusterOrientedBoundingBoxes, "labels"_a,
+                   "minimal"_a = false,
+                   "Computes the PCA, or approximately minimal-volume, "
+                   "oriented bounding box of every cluster. Returns the "
+                   "Float64 (center, R, extent) tensors of shapes {k, 3}, "
+                   "{k, 3, 3} and {k, 3}, ignoring the negative labels.");
     pointcloud.def_static(
             "create_from_depth_image", &PointCloud::CreateFromDepthImage,
             "depth"_a, "intrinsics"_a,
             "extrinsics"_a = core::Tensor::Eye(4, core::Dtype::Float32,
                                                core::Device("CPU:0")),
             "depth_scale"_a = 1000.0f, "depth_max"_a = 3.0f, "stride"_a = 1);
+    pointcloud.def_static(
+            "create_from_rgbd_image", &PointCloud::CreateFromRGBDImage,
+            "rgbd_image"_a, "intrinsics"_a,
+            "extrinsics"_a = core::Tensor::Eye(4, core::Dtype::Float32,
+                                               core::Device("CPU:0")),
+            "depth_scale"_a = 1000.0f, "depth_max"_a = 3.0f, "stride"_a = 1,
+            "Creates a colored pointcloud from an RGB-D image, unprojecting "
+            "the depth and gathering the colors in a single pass.");
     pointcloud.def_static(
             "from_legacy_pointcloud", &PointCloud::FromLegacyPointCloud,
             "pcd_legacy"_a, "dtype"_a = core::Dtype::Float32,
@@ -86,6 +209,16 @@ void pybind_pointcloud(py::module& m) {
             "Create a PointCloud from a legacy Open3D PointCloud.");
     pointcloud.def("to_legacy_pointcloud", &PointCloud::ToLegacyPointCloud,
                    "Convert to a legacy Open3D PointCloud.");
+    pointcloud.def_static(
+            "from_legacy_pointcloud_view",
+            &PointCloud::FromLegacyPointCloudView, "pcd_legacy"_a,
+            "Create a PointCloud whose Float64 CPU attributes share the memory "
+            "of a legacy Open3D PointCloud, without copy.");
+    pointcloud.def("to_legacy_pointcloud_view",
+                   &PointCloud::ToLegacyPointCloudView,
+                   "Convert to a legacy Open3D PointCloud, returning the "
+                   "viewed legacy PointCloud without copy if the attributes "
+                   "still share its memory.");
 }
 
 }  // namespace geometry
@@ -0,0 +1,100 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/RaycastingScene.h"
+
+#include <limits>
+
+#include "pybind/t/geometry/geometry.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+void pybind_raycasting_scene(py::module& m) {
+    py::class_<RaycastingScene> raycasting_scene(
+            m, "RaycastingScene",
+            "A scene of triangle meshes for ray and closest point queries on "
+            "the CPU, without a rendering context. Rays are Float32 tensors "
+            "of shape {..., 6} with the origins and the directions of the "
+            "rays.");
+    raycasting_scene.attr("INVALID_ID") =
+            py::int_(RaycastingScene::INVALID_ID);
+    raycasting_scene.def(py::init<>())
+            .def("add_triangles",
+                 py::overload_cast<const core::Tensor&, const core::Tensor&>(
+                         &RaycastingScene::AddTriangles),
+                 "vertices"_a, "triangles"_a,
+                 "Adds triangles to the scene and returns the ID of the added "
+                 "geometry.")
+            .def("add_triangles",
+                 py::overload_cast<const TriangleMesh&>(
+                         &RaycastingScene::AddTriangles),
+                 "mesh"_a,
+                 "Adds the triangles of a mesh to the scene and returns the ID "
+                 "of the added geometry.")
+            .def_property_readonly("num_geometries",
+                                   &RaycastingScene::GetNumGeometries,
+                                   "The number of geometries in the scene.")
+            .def_property_readonly("num_triangles",
+                                   &RaycastingScene::GetNumTriangles,
+                                   "The number of triangles in the scene.")
+            .def("cast_rays", &RaycastingScene::CastRays, "rays"_a,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Computes the first intersection of the rays with the scene. "
+                 "Returns a dict with 't_hit', 'geometry_ids', "
+                 "'primitive_ids', 'primitive_uvs' and 'primitive_normals'.")
+            .def("test_occlusions", &RaycastingScene::TestOcclusions, "rays"_a,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "tnear"_a = 0.f,
+                 "tfar"_a = std::numeric_limits<float>::infinity(),
+                 "Tests whether the rays hit the scene in [tnear, tfar).")
+            .def("count_intersections", &RaycastingScene::CountIntersections,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "rays"_a,
+                 "Counts the intersections of the rays with the scene.")
+            .def("compute_closest_points",
+                 &RaycastingScene::ComputeClosestPoints, "query_points"_a,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Computes the closest points on the surfaces of the scene. "
+                 "Returns a dict with 'points', 'geometry_ids' and "
+                 "'primitive_ids'.")
+            .def("compute_distance", &RaycastingScene::ComputeDistance,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "query_points"_a,
+                 "Computes the distances to the surfaces of the scene.")
+            .def_static("create_rays_pinhole",
+                        &RaycastingScene::CreateRaysPinhole,
+                        "intrinsic_matrix"_a, "extrinsic_matrix"_a,
+                        "width_px"_a, "height_px"_a,
+                        "Creates the rays of a pinhole camera, of shape "
+                        "{height_px, width_px, 6}. The hit distances of "
+                        "these rays are depths.");
+}
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
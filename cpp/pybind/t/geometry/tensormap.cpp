@@ -27,6 +27,7 @@
 #include "open3d/t/geometry/TensorMap.h"
 
 #include "open3d/t/geometry/PointCloud.h"
+#include "pybind/core/tensor_converter.h"
 #include "pybind/docstring.h"
 #include "pybind/t/geometry/geometry.h"
 
@@ -53,6 +54,36 @@ void pybind_tensormap(py::module& m) {
     tm.def("get_primary_key", &TensorMap::GetPrimaryKey);
     tm.def("is_size_synchronized", &TensorMap::IsSizeSynchronized);
     tm.def("assert_size_synchronized", &TensorMap::AssertSizeSynchronized);
+
+    // Zero-copy exchange of all attributes with DLPack consumers and
+    // producers, e.g. PyTorch and CuPy.
+    tm.def(
+            "to_dlpack",
+            [](const TensorMap& tensor_map) {
+                py::dict capsules;
+                for (const auto& kv : tensor_map) {
+                    capsules[py::str(kv.first)] =
+                            core::TensorToDLPackCapsule(kv.second);
+                }
+                return capsules;
+            },
+            "Returns a dict mapping each attribute name to a DLPack "
+            "PyCapsule sharing the attribute's memory.");
+    tm.def_static(
+            "from_dlpack",
+            [](const std::string& primary_key, const py::dict& attributes) {
+                TensorMap tensor_map(primary_key);
+                for (const auto& kv : attributes) {
+                    tensor_map[kv.first.cast<std::string>()] =
+                            core::DLPackToTensor(
+                                    py::reinterpret_borrow<py::object>(
+                                            kv.second));
+                }
+                return tensor_map;
+            },
+            "primary_key"_a, "attributes"_a,
+            "Creates a TensorMap from a dict of DLPack PyCapsules or objects "
+            "implementing __dlpack__, without copying.");
 }
 
 }  // namespace geometry
@@ -75,6 +75,98 @@ void pybind_trianglemesh(py::module& m) {
                       "Scale points.");
     triangle_mesh.def("rotate", &TriangleMesh::Rotate, "R"_a, "center"_a,
                       "Rotate points and normals (if exist).");
+    triangle_mesh.def("append", &TriangleMesh::Append, "other"_a,
+                      "Appends the vertices and triangles of other in-place, "
+                      "with amortized linear time over repeated appends.");
+    triangle_mesh.def("shrink", &TriangleMesh::Shrink,
+                      "Releases the memory reserved by append.");
+    triangle_mesh.def("compute_triangle_normals",
+                      &TriangleMesh::ComputeTriangleNormals,
+                      "normalized"_a = true,
+                      "Computes the triangle normals of the mesh.");
+    triangle_mesh.def("compute_vertex_normals",
+                      &TriangleMesh::ComputeVertexNormals,
+                      "normalized"_a = true,
+                      "Computes the vertex normals of the mesh from the "
+                      "normals of the adjacent triangles.");
+    triangle_mesh.def("remove_duplicated_vertices",
+                      &TriangleMesh::RemoveDuplicatedVertices,
+                      "Merges the vertices with exactly the same coordinates.");
+    triangle_mesh.def("simplify_vertex_clustering",
+                      &TriangleMesh::SimplifyVertexClustering, "voxel_size"_a,
+                      "Simplifies the mesh by averaging the vertices in each "
+                      "voxel, and removing the collapsed and duplicated "
+                      "triangles.");
+    triangle_mesh.def("cluster_connected_triangles",
+                      &TriangleMesh::ClusterConnectedTriangles,
+                      "Clusters the triangles connected through their edges. "
+                      "Returns the cluster index per triangle, the number of "
+                      "triangles per cluster and the surface area per "
+                      "cluster.");
+    triangle_mesh.def("select_by_mask", &TriangleMesh::SelectByMask,
+                      "mask"_a, "invert"_a = false,
+                      "Selects the vertices where the Bool mask is true and "
+                      "the triangles between them.");
+    triangle_mesh.def("select_by_index", &TriangleMesh::SelectByIndex,
+                      "indices"_a, "invert"_a = false,
+                      "Selects the vertices of the Int64 indices and the "
+                      "triangles between them.");
+    triangle_mesh.def(
+            "crop",
+            (TriangleMesh(TriangleMesh::*)(
+                    const open3d::geometry::AxisAlignedBoundingBox &) const) &
+                    TriangleMesh::Crop,
+            "bounding_box"_a,
+            "Crops the mesh to the vertices inside the box and the triangles "
+            "between them.");
+    triangle_mesh.def(
+            "crop",
+            (TriangleMesh(TriangleMesh::*)(
+                    const open3d::geometry::OrientedBoundingBox &) const) &
+                    TriangleMesh::Crop,
+            "bounding_box"_a,
+            "Crops the mesh to the vertices inside the box and the triangles "
+            "between them.");
+    triangle_mesh.def("sample_points_uniformly",
+                      &TriangleMesh::SamplePointsUniformly,
+                      "number_of_points"_a, "use_triangle_normal"_a = false,
+                      "seed"_a = -1,
+                      "Samples points uniformly on the surface of the mesh.");
+    triangle_mesh.def("sample_points_poisson_disk",
+                      &TriangleMesh::SamplePointsPoissonDisk,
+                      "number_of_points"_a, "init_factor"_a = 5,
+                      "use_triangle_normal"_a = false, "seed"_a = -1,
+                      "Samples evenly spaced points on the surface of the "
+                      "mesh by sample elimination.");
+    triangle_mesh.def("filter_sharpen", &TriangleMesh::FilterSharpen,
+                      "number_of_iterations"_a = 1, "strength"_a = 1,
+                      "scope"_a = TriangleMesh::FilterScope::All,
+                      "Sharpens the mesh by amplifying the differences of "
+                      "the vertices to their neighbors.");
+    triangle_mesh.def("filter_smooth_simple",
+                      &TriangleMesh::FilterSmoothSimple,
+                      "number_of_iterations"_a = 1,
+                      "scope"_a = TriangleMesh::FilterScope::All,
+                      "Smoothes the mesh by averaging each vertex with its "
+                      "neighbors.");
+    triangle_mesh.def("filter_smooth_laplacian",
+                      &TriangleMesh::FilterSmoothLaplacian,
+                      "number_of_iterations"_a = 1, "lambda"_a = 0.5,
+                      "scope"_a = TriangleMesh::FilterScope::All,
+                      "Smoothes the mesh with Laplacian steps weighted by the "
+                      "inverse distances to the neighbors.");
+    triangle_mesh.def("filter_smooth_taubin", &TriangleMesh::FilterSmoothTaubin,
+                      "number_of_iterations"_a = 1, "lambda"_a = 0.5,
+                      "mu"_a = -0.53,
+                      "scope"_a = TriangleMesh::FilterScope::All,
+                      "Smoothes the mesh with pairs of Laplacian steps of "
+                      "sizes lambda and mu, which limits the shrinkage.");
+    triangle_mesh.def("compute_distance", &TriangleMesh::ComputeDistance,
+                      "query_points"_a, "signed_distance"_a = false,
+                      "max_distance"_a = 0.0,
+                      "Computes the distances from the query points to the "
+                      "surface of the mesh, negative inside the mesh if "
+                      "signed_distance is true.");
     triangle_mesh.def_static(
             "from_legacy_triangle_mesh", &TriangleMesh::FromLegacyTriangleMesh,
             "mesh_legacy"_a, "vertex_dtype"_a = core::Dtype::Float32,
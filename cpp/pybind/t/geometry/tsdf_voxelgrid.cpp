@@ -26,7 +26,9 @@
 
 #include <string>
 #include <unordered_map>
+#include <vector>
 
+#include "open3d/t/geometry/PartitionedTSDFVoxelGrid.h"
 #include "open3d/t/geometry/TSDFVoxelGrid.h"
 #include "pybind/t/geometry/geometry.h"
 
@@ -56,23 +58,117 @@ void pybind_tsdf_voxelgrid(py::module& m) {
     tsdf_voxelgrid.def("integrate",
                        py::overload_cast<const Image&, const core::Tensor&,
                                          const core::Tensor&, float, float>(
-                               &TSDFVoxelGrid::Integrate));
+                               &TSDFVoxelGrid::Integrate),
+                       py::call_guard<py::gil_scoped_release>());
     tsdf_voxelgrid.def(
             "integrate",
             py::overload_cast<const Image&, const Image&, const core::Tensor&,
                               const core::Tensor&, float, float>(
-                    &TSDFVoxelGrid::Integrate));
+                    &TSDFVoxelGrid::Integrate),
+            py::call_guard<py::gil_scoped_release>());
+    tsdf_voxelgrid.def(
+            "integrate_batch", &TSDFVoxelGrid::IntegrateBatch, "depths"_a,
+            "colors"_a, "intrinsics"_a, "extrinsics"_a,
+            "depth_scale"_a = 1000.0f, "depth_max"_a = 3.0f,
+            py::call_guard<py::gil_scoped_release>(),
+            "Integrates a batch of frames in a single pass over the touched "
+            "blocks. colors may be empty, and intrinsics may hold a single "
+            "matrix shared by all the frames.");
+
+    tsdf_voxelgrid.def("ray_cast", &TSDFVoxelGrid::RayCast, "intrinsics"_a,
+                       py::call_guard<py::gil_scoped_release>(),
+                       "extrinsics"_a, "width"_a, "height"_a,
+                       "depth_min"_a = 0.1f, "depth_max"_a = 3.0f,
+                       "Renders the vertex, depth, normal and color maps of "
+                       "the TSDF zero-crossings seen from a camera.");
 
     tsdf_voxelgrid.def("extract_surface_points",
-                       &TSDFVoxelGrid::ExtractSurfacePoints);
+                       &TSDFVoxelGrid::ExtractSurfacePoints,
+                       py::call_guard<py::gil_scoped_release>());
     tsdf_voxelgrid.def("extract_surface_mesh",
-                       &TSDFVoxelGrid::ExtractSurfaceMesh);
+                       &TSDFVoxelGrid::ExtractSurfaceMesh,
+                       py::call_guard<py::gil_scoped_release>());
+    tsdf_voxelgrid.def("extract_surface_mesh_incremental",
+                       &TSDFVoxelGrid::ExtractSurfaceMeshIncremental,
+                       py::call_guard<py::gil_scoped_release>(),
+                       "Extract mesh near iso-surfaces, re-meshing only the "
+                       "blocks integrated since the previous call.");
+
+    tsdf_voxelgrid.def("stream_out_blocks", &TSDFVoxelGrid::StreamOutBlocks,
+                       "block_indices"_a,
+                       "Moves the blocks at the buffer indices from the device "
+                       "to the host hashmap.");
+    tsdf_voxelgrid.def("stream_in_blocks", &TSDFVoxelGrid::StreamInBlocks,
+                       "block_keys"_a,
+                       "Moves the blocks with the coordinates that are on host "
+                       "back to the device hashmap.");
+    tsdf_voxelgrid.def("stream_out_invisible_blocks",
+                       &TSDFVoxelGrid::StreamOutInvisibleBlocks,
+                       "intrinsics"_a, "extrinsics"_a, "width"_a, "height"_a,
+                       "depth_max"_a = 3.0f,
+                       "Streams out the blocks that a camera can not update.");
+    tsdf_voxelgrid.def("set_max_device_blocks",
+                       &TSDFVoxelGrid::SetMaxDeviceBlocks,
+                       "max_device_blocks"_a,
+                       "Bounds the number of blocks on device, streaming out "
+                       "the blocks outside the camera frustum after "
+                       "integration.");
+    tsdf_voxelgrid.def("save_host_blocks", &TSDFVoxelGrid::SaveHostBlocks,
+                       "file_name"_a);
+    tsdf_voxelgrid.def("load_host_blocks", &TSDFVoxelGrid::LoadHostBlocks,
+                       "file_name"_a);
+    tsdf_voxelgrid.def("get_active_block_count",
+                       &TSDFVoxelGrid::GetActiveBlockCount);
+    tsdf_voxelgrid.def("get_host_block_count",
+                       &TSDFVoxelGrid::GetHostBlockCount);
 
     tsdf_voxelgrid.def("copy", &TSDFVoxelGrid::Copy);
     tsdf_voxelgrid.def("cpu", &TSDFVoxelGrid::CPU);
     tsdf_voxelgrid.def("cuda", &TSDFVoxelGrid::CUDA);
 
     tsdf_voxelgrid.def("get_device", &TSDFVoxelGrid::GetDevice);
+
+    py::class_<PartitionedTSDFVoxelGrid> partitioned_tsdf_voxelgrid(
+            m, "PartitionedTSDFVoxelGrid",
+            "A TSDF voxel grid sharded across several devices by hashing "
+            "tiles of blocks.");
+    partitioned_tsdf_voxelgrid.def(
+            py::init<const std::vector<core::Device>&,
+                     const std::unordered_map<std::string, core::Dtype>&, float,
+                     float, int64_t, int64_t, int64_t>(),
+            "devices"_a,
+            "map_attrs_to_dtypes"_a =
+                    std::unordered_map<std::string, core::Dtype>{
+                            {"tsdf", core::Dtype::Float32},
+                            {"weight", core::Dtype::UInt16},
+                            {"color", core::Dtype::UInt16},
+                    },
+            "voxel_size"_a = 3.0 / 512, "sdf_trunc"_a = 0.04,
+            "block_resolution"_a = 16, "block_count"_a = 100,
+            "partition_tile_size"_a = 8);
+    partitioned_tsdf_voxelgrid.def(
+            "integrate",
+            py::overload_cast<const Image&, const core::Tensor&,
+                              const core::Tensor&, float, float>(
+                    &PartitionedTSDFVoxelGrid::Integrate),
+            py::call_guard<py::gil_scoped_release>());
+    partitioned_tsdf_voxelgrid.def(
+            "integrate",
+            py::overload_cast<const Image&, const Image&, const core::Tensor&,
+                              const core::Tensor&, float, float>(
+                    &PartitionedTSDFVoxelGrid::Integrate),
+            py::call_guard<py::gil_scoped_release>());
+    partitioned_tsdf_voxelgrid.def(
+            "extract_surface_mesh",
+            &PartitionedTSDFVoxelGrid::ExtractSurfaceMesh,
+            py::call_guard<py::gil_scoped_release>(),
+            "Extracts the mesh of each partition, and stitches them on CPU.");
+    partitioned_tsdf_voxelgrid.def(
+            "get_partition_count",
+            &PartitionedTSDFVoxelGrid::GetPartitionCount);
+    partitioned_tsdf_voxelgrid.def(
+            "get_active_block_count",
+            &PartitionedTSDFVoxelGrid::GetActiveBlockCount);
 }
 }  // namespace geometry
 }  // namespace t
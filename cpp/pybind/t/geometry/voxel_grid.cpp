@@ -0,0 +1,96 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/VoxelGrid.h"
+
+#include "pybind/t/geometry/geometry.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+void pybind_voxel_grid(py::module& m) {
+    py::class_<VoxelGrid> voxel_grid(
+            m, "VoxelGrid",
+            "A sparse voxel grid stored in a hashmap from voxel coordinates "
+            "to colors, on CPU or CUDA.");
+
+    voxel_grid.def(py::init<float, const core::Tensor&, int64_t,
+                            const core::Device&>(),
+                   "voxel_size"_a = 1.0f,
+                   "origin"_a = core::Tensor::Zeros({3}, core::Dtype::Float32),
+                   "init_capacity"_a = 1000,
+                   "device"_a = core::Device("CPU:0"));
+
+    voxel_grid.def_static("create_from_point_cloud",
+                          &VoxelGrid::CreateFromPointCloud, "pcd"_a,
+                          "voxel_size"_a,
+                          "Creates the voxels occupied by the points.");
+    voxel_grid.def_static("create_from_triangle_mesh",
+                          &VoxelGrid::CreateFromTriangleMesh, "mesh"_a,
+                          "voxel_size"_a,
+                          "Creates the voxels intersected by the triangles.");
+
+    voxel_grid.def("carve_depth_map", &VoxelGrid::CarveDepthMap, "depth"_a,
+                   "intrinsics"_a, "extrinsics"_a,
+                   "keep_voxels_outside_image"_a, "depth_scale"_a = 1.0f,
+                   "Removes the voxels in front of a depth map.");
+    voxel_grid.def("carve_silhouette", &VoxelGrid::CarveSilhouette,
+                   "silhouette_mask"_a, "intrinsics"_a, "extrinsics"_a,
+                   "keep_voxels_outside_image"_a,
+                   "Removes the voxels that project outside of a "
+                   "silhouette.");
+    voxel_grid.def("check_if_included", &VoxelGrid::CheckIfIncluded,
+                   "queries"_a,
+                   "Returns whether the voxels of the queries are in the "
+                   "grid.");
+
+    voxel_grid.def("get_voxel_indices", &VoxelGrid::GetVoxelIndices,
+                   "points"_a);
+    voxel_grid.def("get_voxel_coordinates", &VoxelGrid::GetVoxelCoordinates);
+    voxel_grid.def("get_voxel_colors", &VoxelGrid::GetVoxelColors);
+    voxel_grid.def("get_voxel_center_coordinates",
+                   &VoxelGrid::GetVoxelCenterCoordinates);
+    voxel_grid.def("num_voxels", &VoxelGrid::NumVoxels);
+    voxel_grid.def("has_voxels", &VoxelGrid::HasVoxels);
+    voxel_grid.def("get_voxel_size", &VoxelGrid::GetVoxelSize);
+    voxel_grid.def("get_origin", &VoxelGrid::GetOrigin);
+
+    voxel_grid.def_static("from_legacy_voxel_grid",
+                          &VoxelGrid::FromLegacyVoxelGrid,
+                          "voxel_grid_legacy"_a,
+                          "device"_a = core::Device("CPU:0"));
+    voxel_grid.def("to_legacy_voxel_grid", &VoxelGrid::ToLegacyVoxelGrid);
+
+    voxel_grid.def("copy", &VoxelGrid::Copy);
+    voxel_grid.def("cpu", &VoxelGrid::CPU);
+    voxel_grid.def("cuda", &VoxelGrid::CUDA, "device_id"_a = 0);
+    voxel_grid.def("get_device", &VoxelGrid::GetDevice);
+}
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
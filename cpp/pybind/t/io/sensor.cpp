@@ -27,6 +27,7 @@
 #include <memory>
 
 #include "open3d/geometry/RGBDImage.h"
+#include "open3d/t/io/sensor/MultiSensorCapture.h"
 #include "open3d/t/io/sensor/RGBDSensor.h"
 #include "open3d/t/io/sensor/RGBDVideoReader.h"
 #ifdef BUILD_LIBREALSENSE
@@ -34,6 +35,9 @@
 #include "open3d/t/io/sensor/realsense/RealSenseSensor.h"
 #include "open3d/t/io/sensor/realsense/RealSenseSensorConfig.h"
 #endif
+#ifdef BUILD_AZURE_KINECT
+#include "open3d/t/io/sensor/azure_kinect/MKVReader.h"
+#endif
 #include "pybind/docstring.h"
 #include "pybind/t/io/io.h"
 
@@ -56,7 +60,11 @@ void pybind_sensor(py::module &m) {
                      "(default video length) Save frames till this time (us)"},
                     {"buffer_size",
                      "Size of internal frame buffer, increase this if you "
-                     "experience frame drops."}};
+                     "experience frame drops."},
+                    {"num_threads",
+                     "(default 0) Number of parallel readers for "
+                     "save_frames() and build_frame_index(). 0 uses one per "
+                     "hardware thread."}};
 
     py::enum_<SensorType>(m, "SensorType", "Sensor type")
             .value("AZURE_KINECT", SensorType::AZURE_KINECT)
@@ -108,17 +116,61 @@ void pybind_sensor(py::module &m) {
                                     map_shared_argument_docstrings);
 
     // Class RGBD sensor
-    py::class_<RGBDSensor> rgbd_sensor(
+    py::class_<RGBDSensor, std::shared_ptr<RGBDSensor>> rgbd_sensor(
             m, "RGBDSensor", "Interface class for control of RGBD cameras.");
     rgbd_sensor.def("__repr__", &RGBDSensor::ToString);
 
+    // Class MultiSensorCapture
+    py::class_<MultiSensorCapture> multi_sensor_capture(
+            m, "MultiSensorCapture",
+            "Synchronized capture from multiple RGBD sensors. Frames are "
+            "captured in a thread per sensor and matched by timestamp.");
+    multi_sensor_capture
+            .def(py::init<const std::vector<std::shared_ptr<RGBDSensor>> &,
+                          uint64_t, size_t>(),
+                 "sensors"_a, "tolerance_us"_a = 5000, "buffer_size"_a = 4)
+            .def("start_capture", &MultiSensorCapture::StartCapture,
+                 "start_record"_a = false,
+                 "Start capturing from all sensors, each in its own capture "
+                 "thread.")
+            .def("stop_capture", &MultiSensorCapture::StopCapture,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Stop capturing from all sensors.")
+            .def("capture_frames", &MultiSensorCapture::CaptureFrames,
+                 py::call_guard<py::gil_scoped_release>(), "wait"_a = true,
+                 "Get the next matched set of frames, in the order of the "
+                 "sensors.")
+            .def("get_timestamps", &MultiSensorCapture::GetTimestamps,
+                 "Get the timestamps (in us) of the last matched set of "
+                 "frames.")
+            .def("get_num_dropped_frames",
+                 &MultiSensorCapture::GetNumDroppedFrames,
+                 "Number of frames dropped since start_capture(), because "
+                 "they had no match or their queue was full.")
+            .def("get_num_sensors", &MultiSensorCapture::GetNumSensors,
+                 "Number of sensors.")
+            .def_static("stack_frames", &MultiSensorCapture::StackFrames,
+                        "frames"_a, "device"_a,
+                        "Stack frames of the same size to batched color and "
+                        "depth tensors of shape {N, rows, cols, channels} on "
+                        "the device.");
+    docstring::ClassMethodDocInject(
+            m, "MultiSensorCapture", "__init__",
+            {{"sensors", "Initialized sensors."},
+             {"tolerance_us",
+              "Max difference of the timestamps of matched frames (us)."},
+             {"buffer_size",
+              "Number of frames queued per sensor. Older frames are "
+              "dropped."}});
+
 #ifdef BUILD_LIBREALSENSE
     // Class RS bag reader
     py::class_<RSBagReader, std::shared_ptr<RSBagReader>, RGBDVideoReader>
             rs_bag_reader(m, "RSBagReader", "RealSense Bag file reader.");
     rs_bag_reader.def(py::init<>())
-            .def(py::init<size_t>(),
-                 "buffer_size"_a = RSBagReader::DEFAULT_BUFFER_SIZE)
+            .def(py::init<size_t, size_t>(),
+                 "buffer_size"_a = RSBagReader::DEFAULT_BUFFER_SIZE,
+                 "num_threads"_a = 0)
             .def("is_opened", &RSBagReader::IsOpened,
                  "Check if the RS bag file  is opened.")
             .def("open",
@@ -146,6 +198,11 @@ void pybind_sensor(py::module &m) {
                  "start_time_us"_a = 0, "end_time_us"_a = UINT64_MAX,
                  "Save synchronized and aligned individual frames to "
                  "subfolders")
+            .def("build_frame_index", &RSBagReader::BuildFrameIndex,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Read all frames in parallel to build the frame index and "
+                 "save it next to the bag file. Returns true if the index was "
+                 "saved.")
             .def("__repr__", &RSBagReader::ToString);
     docstring::ClassMethodDocInject(m, "RSBagReader", "__init__",
                                     map_shared_argument_docstrings);
@@ -180,10 +237,10 @@ void pybind_sensor(py::module &m) {
                            "list of valid values.");
 
     // Class RealSenseSensor
-    py::class_<RealSenseSensor, RGBDSensor> realsense_sensor(
-            m, "RealSenseSensor",
-            "RealSense camera discovery, configuration, streaming and "
-            "recording");
+    py::class_<RealSenseSensor, std::shared_ptr<RealSenseSensor>, RGBDSensor>
+            realsense_sensor(m, "RealSenseSensor",
+                             "RealSense camera discovery, configuration, "
+                             "streaming and recording");
     realsense_sensor.def(py::init<>(), "Initialize with default settings.")
             .def_static("list_devices", &RealSenseSensor::ListDevices,
                         "List all RealSense cameras connected to the system "
@@ -210,9 +267,22 @@ void pybind_sensor(py::module &m) {
                  "Configure sensor with custom settings. If this is skipped, "
                  "default settings will be used. You can enable recording to a "
                  "bag file by specifying a filename.")
-            .def("start_capture", &RealSenseSensor::StartCapture,
-                 "start_record"_a = false,
-                 "Start capturing synchronized depth and color frames.")
+            .def("start_capture",
+                 py::overload_cast<bool, bool, size_t, bool, bool,
+                                   const core::Device &>(
+                         &RealSenseSensor::StartCapture),
+                 "start_record"_a = false, "async"_a = false,
+                 "buffer_size"_a = 4, "drop_oldest"_a = true,
+                 "align_depth_to_color"_a = true,
+                 "device"_a = core::Device("CPU:0"),
+                 "Start capturing synchronized depth and color frames, "
+                 "optionally in a separate capture thread.")
+            .def("set_depth_processing", &RealSenseSensor::SetDepthProcessing,
+                 "register_on_device"_a, "filter_kernel_size"_a = 0,
+                 "filter_depth_sigma"_a = 20.0f,
+                 "filter_distance_sigma"_a = 3.0f,
+                 "Process the depth frames of the capture thread on its "
+                 "device, set before start_capture() with async.")
             .def("pause_record", &RealSenseSensor::PauseRecord,
                  "Pause recording to the bag file.")
             .def("resume_record", &RealSenseSensor::ResumeRecord,
@@ -221,6 +291,13 @@ void pybind_sensor(py::module &m) {
             .def("capture_frame", &RealSenseSensor::CaptureFrame,
                  "wait"_a = true, "align_depth_to_color"_a = true,
                  "Acquire the next synchronized RGBD frameset from the camera.")
+            .def("get_latest_frame", &RealSenseSensor::GetLatestFrame,
+                 py::call_guard<py::gil_scoped_release>(), "wait"_a = true,
+                 "Acquire the newest frame of the capture thread and drop the "
+                 "older frames of the buffer.")
+            .def("get_num_dropped_frames",
+                 &RealSenseSensor::GetNumDroppedFrames,
+                 "Number of frames dropped by the capture thread.")
             .def("get_timestamp", &RealSenseSensor::GetTimestamp,
                  "Get current timestamp (in us)")
             .def("stop_capture", &RealSenseSensor::StopCapture,
@@ -247,7 +324,18 @@ void pybind_sensor(py::module &m) {
     docstring::ClassMethodDocInject(
             m, "RealSenseSensor", "start_capture",
             {{"start_record",
-              "Start recording to the specified bag file as well."}});
+              "Start recording to the specified bag file as well."},
+             {"async",
+              "Capture frames in a separate thread into a ring buffer of "
+              "preallocated frames. capture_frame() then returns the oldest "
+              "and get_latest_frame() the newest frame of the buffer."},
+             {"buffer_size", "Number of frames of the ring buffer."},
+             {"drop_oldest",
+              "If the buffer is full, drop the oldest frame instead of the "
+              "new frame."},
+             {"align_depth_to_color",
+              "Align the depth image to the color image."},
+             {"device", "Device of the frames."}});
     docstring::ClassMethodDocInject(
             m, "RealSenseSensor", "capture_frame",
             {{"wait",
@@ -258,6 +346,57 @@ void pybind_sensor(py::module &m) {
               "visualizer."}});
 
 #endif
+
+#ifdef BUILD_AZURE_KINECT
+    // Class Azure Kinect MKV reader
+    py::class_<MKVReader, std::shared_ptr<MKVReader>, RGBDVideoReader>
+            mkv_reader(m, "MKVReader",
+                       "Azure Kinect MKV file reader, decoding frames in "
+                       "background threads.");
+    mkv_reader
+            .def(py::init<size_t, size_t, const core::Device &>(),
+                 "buffer_size"_a = MKVReader::DEFAULT_BUFFER_SIZE,
+                 "num_threads"_a = 0, "device"_a = core::Device("CPU:0"))
+            .def("is_opened", &MKVReader::IsOpened,
+                 "Check if the mkv file is opened.")
+            .def("open", &MKVReader::Open, "filename"_a,
+                 "Open an mkv playback.")
+            .def("close", &MKVReader::Close, "Close the opened mkv playback.")
+            .def("is_eof", &MKVReader::IsEOF,
+                 "Check if the mkv file is all read.")
+            .def_property(
+                    "metadata",
+                    py::overload_cast<>(&MKVReader::GetMetadata, py::const_),
+                    py::overload_cast<>(&MKVReader::GetMetadata),
+                    "Get metadata of the mkv playback.")
+            .def("seek_timestamp", &MKVReader::SeekTimestamp, "timestamp"_a,
+                 "Seek to the timestamp (in us).")
+            .def("get_timestamp", &MKVReader::GetTimestamp,
+                 "Get current timestamp (in us).")
+            // Release Python GIL while waiting for the decoder threads.
+            .def("next_frame", &MKVReader::NextFrame,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Get next frame from the mkv playback and returns the RGBD "
+                 "object on the target device.")
+            .def("save_frames", &MKVReader::SaveFrames,
+                 py::call_guard<py::gil_scoped_release>(), "frame_path"_a,
+                 "start_time_us"_a = 0, "end_time_us"_a = UINT64_MAX,
+                 "Save synchronized and aligned individual frames to "
+                 "subfolders")
+            .def("__repr__", &MKVReader::ToString);
+    docstring::ClassMethodDocInject(
+            m, "MKVReader", "__init__",
+            {{"buffer_size", "Max number of frames to read ahead."},
+             {"num_threads",
+              "Number of decoder threads. 0 uses one per hardware thread."},
+             {"device", "Device of the output frames."}});
+    docstring::ClassMethodDocInject(m, "MKVReader", "open",
+                                    map_shared_argument_docstrings);
+    docstring::ClassMethodDocInject(m, "MKVReader", "seek_timestamp",
+                                    map_shared_argument_docstrings);
+    docstring::ClassMethodDocInject(m, "MKVReader", "save_frames",
+                                    map_shared_argument_docstrings);
+#endif
 }
 
 }  // namespace io
@@ -24,6 +24,8 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <cstring>
+
 #include "pybind/docstring.h"
 #include "pybind/open3d_pybind.h"
 
@@ -61,12 +63,16 @@ std::vector<EigenVector> py_array_to_vectors_double(
         throw py::cast_error();
     }
     std::vector<EigenVector> eigen_vectors(array.shape(0));
-    auto array_unchecked = array.mutable_unchecked<2>();
-    for (auto i = 0; i < array_unchecked.shape(0); ++i) {
-        // The EigenVector here must be a double-typed eigen vector, since only
-        // open3d::Vector3dVector binds to py_array_to_vectors_double.
-        // Therefore, we can use the memory map directly.
-        eigen_vectors[i] = Eigen::Map<EigenVector>(&array_unchecked(i, 0));
+    // The EigenVector here must be a double-typed eigen vector, since only
+    // open3d::Vector3dVector binds to py_array_to_vectors_double. The array is
+    // C-contiguous and fixed-size Eigen vectors are unpadded, so the rows can
+    // be copied in one go.
+    static_assert(sizeof(EigenVector) ==
+                          sizeof(double) * EigenVector::SizeAtCompileTime,
+                  "EigenVector must be densely packed.");
+    if (!eigen_vectors.empty()) {
+        std::memcpy(eigen_vectors.data(), array.data(),
+                    eigen_vectors.size() * sizeof(EigenVector));
     }
     return eigen_vectors;
 }
@@ -79,9 +85,12 @@ std::vector<EigenVector> py_array_to_vectors_int(
         throw py::cast_error();
     }
     std::vector<EigenVector> eigen_vectors(array.shape(0));
-    auto array_unchecked = array.mutable_unchecked<2>();
-    for (auto i = 0; i < array_unchecked.shape(0); ++i) {
-        eigen_vectors[i] = Eigen::Map<EigenVector>(&array_unchecked(i, 0));
+    static_assert(sizeof(EigenVector) ==
+                          sizeof(int) * EigenVector::SizeAtCompileTime,
+                  "EigenVector must be densely packed.");
+    if (!eigen_vectors.empty()) {
+        std::memcpy(eigen_vectors.data(), array.data(),
+                    eigen_vectors.size() * sizeof(EigenVector));
     }
     return eigen_vectors;
 }
@@ -96,9 +105,12 @@ py_array_to_vectors_int_eigen_allocator(
         throw py::cast_error();
     }
     std::vector<EigenVector, EigenAllocator> eigen_vectors(array.shape(0));
-    auto array_unchecked = array.mutable_unchecked<2>();
-    for (auto i = 0; i < array_unchecked.shape(0); ++i) {
-        eigen_vectors[i] = Eigen::Map<EigenVector>(&array_unchecked(i, 0));
+    static_assert(sizeof(EigenVector) ==
+                          sizeof(int) * EigenVector::SizeAtCompileTime,
+                  "EigenVector must be densely packed.");
+    if (!eigen_vectors.empty()) {
+        std::memcpy(eigen_vectors.data(), array.data(),
+                    eigen_vectors.size() * sizeof(EigenVector));
     }
     return eigen_vectors;
 }
@@ -113,9 +125,12 @@ py_array_to_vectors_int64_eigen_allocator(
         throw py::cast_error();
     }
     std::vector<EigenVector, EigenAllocator> eigen_vectors(array.shape(0));
-    auto array_unchecked = array.mutable_unchecked<2>();
-    for (auto i = 0; i < array_unchecked.shape(0); ++i) {
-        eigen_vectors[i] = Eigen::Map<EigenVector>(&array_unchecked(i, 0));
+    static_assert(sizeof(EigenVector) ==
+                          sizeof(int64_t) * EigenVector::SizeAtCompileTime,
+                  "EigenVector must be densely packed.");
+    if (!eigen_vectors.empty()) {
+        std::memcpy(eigen_vectors.data(), array.data(),
+                    eigen_vectors.size() * sizeof(EigenVector));
     }
     return eigen_vectors;
 }
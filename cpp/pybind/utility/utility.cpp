@@ -26,6 +26,7 @@
 
 #include "pybind/utility/utility.h"
 
+#include "open3d/utility/Parallel.h"
 #include "pybind/docstring.h"
 #include "pybind/open3d_pybind.h"
 
@@ -36,6 +37,14 @@ void pybind_utility(py::module &m) {
     py::module m_submodule = m.def_submodule("utility");
     pybind_console(m_submodule);
     pybind_eigen(m_submodule);
+
+    m_submodule.def("set_max_threads", &SetMaxThreads,
+                    "Set the number of threads used by the CPU parallel "
+                    "regions of Open3D. 0 restores the default.",
+                    "num_threads"_a);
+    m_submodule.def("get_max_threads", &GetMaxThreads,
+                    "Get the number of threads set with set_max_threads, or "
+                    "0 if unset.");
 }
 
 }  // namespace utility
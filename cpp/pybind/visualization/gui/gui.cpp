@@ -419,6 +419,39 @@ void pybind_gui_classes(py::module &m) {
             .def("show_message_box", &PyWindow::ShowMessageBox,
                  "Displays a simple dialog with a title and message and okay "
                  "button")
+            .def_property(
+                    "show_frame_statistics",
+                    &PyWindow::IsShowingFrameStatistics,
+                    &PyWindow::ShowFrameStatistics,
+                    "True if an overlay shows the timings, uploads and "
+                    "primitives of the last frames")
+            .def(
+                    "get_frame_statistics",
+                    [](const PyWindow &w) {
+                        const auto &history = w.GetFrameStatistics();
+                        py::list frames;
+                        for (size_t i = 0; i < history.Size(); ++i) {
+                            const auto &f = history.GetFrame(i);
+                            py::dict d;
+                            d["events_ms"] = f.events_ms;
+                            d["gui_ms"] = f.gui_ms;
+                            d["scene_update_ms"] = f.scene_update_ms;
+                            d["begin_frame_ms"] = f.begin_frame_ms;
+                            d["render_ms"] = f.render_ms;
+                            d["end_frame_ms"] = f.end_frame_ms;
+                            d["frame_ms"] = f.frame_ms;
+                            d["upload_bytes"] = f.upload_bytes;
+                            d["draw_calls"] = f.draw_calls;
+                            d["triangles"] = f.triangles;
+                            d["lines"] = f.lines;
+                            d["points"] = f.points;
+                            frames.append(d);
+                        }
+                        return frames;
+                    },
+                    "Returns the statistics of the last frames, oldest "
+                    "first, as a list of dicts of the timings in ms, the "
+                    "uploaded bytes, the draw calls and the primitives")
             .def_property_readonly(
                     "renderer", &PyWindow::GetRenderer,
                     "Gets the rendering.Renderer object for the Window");
@@ -25,15 +25,18 @@
 // ----------------------------------------------------------------------------
 
 #include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/geometry/TriangleMesh.h"
 #include "open3d/visualization/rendering/ColorGrading.h"
 #include "open3d/visualization/rendering/Gradient.h"
 #include "open3d/visualization/rendering/Material.h"
 #include "open3d/visualization/rendering/Model.h"
 #include "open3d/visualization/rendering/Open3DScene.h"
+#include "open3d/visualization/rendering/PointCloudLOD.h"
 #include "open3d/visualization/rendering/Renderer.h"
 #include "open3d/visualization/rendering/Scene.h"
 #include "open3d/visualization/rendering/View.h"
 #include "open3d/visualization/rendering/filament/FilamentEngine.h"
+#include "open3d/visualization/rendering/filament/FilamentRenderToBuffer.h"
 #include "open3d/visualization/rendering/filament/FilamentRenderer.h"
 #include "pybind/docstring.h"
 #include "pybind/visualization/gui/gui.h"
@@ -73,6 +76,19 @@ public:
         return gui::RenderToImageWithoutWindow(scene_, width_, height_);
     }
 
+    std::pair<core::Tensor, core::Tensor> RenderBatch(
+            const std::vector<Eigen::Matrix3d> &intrinsics,
+            const std::vector<Eigen::Matrix4d> &extrinsics,
+            double near_plane,
+            double far_plane,
+            bool render_depth) {
+        FilamentRenderToBuffer render(EngineInstance::GetInstance());
+        auto images = render.RenderBatch(
+                scene_->GetView(), scene_->GetScene(), width_, height_,
+                intrinsics, extrinsics, near_plane, far_plane, render_depth);
+        return std::make_pair(images.color, images.depth);
+    }
+
 private:
     int width_;
     int height_;
@@ -119,7 +135,17 @@ void pybind_rendering_classes(py::module &m) {
                     "be accessed after that point.")
             .def("render_to_image", &PyOffscreenRenderer::RenderToImage,
                  "Renders scene to an image, blocking until the image is "
-                 "returned");
+                 "returned")
+            .def("render_batch", &PyOffscreenRenderer::RenderBatch,
+                 "intrinsics"_a, "extrinsics"_a, "near_plane"_a = 0.1,
+                 "far_plane"_a = 100.0, "render_depth"_a = false,
+                 "Renders the scene once per camera, given the lists of "
+                 "intrinsic matrices and world to camera extrinsic matrices. "
+                 "Returns the (N, height, width, 3) UInt8 colors and the "
+                 "(N, height, width, 1) Float32 depths, which are empty "
+                 "unless render_depth is True. Each view can be wrapped in a "
+                 "t.geometry.Image. The frames are pipelined, which is "
+                 "faster than calling render_to_image per camera.");
 
     // ---- Camera ----
     py::class_<Camera, std::shared_ptr<Camera>> cam(m, "Camera",
@@ -209,6 +235,33 @@ void pybind_rendering_classes(py::module &m) {
             .def_property("points", &Gradient::GetPoints, &Gradient::SetPoints)
             .def_property("mode", &Gradient::GetMode, &Gradient::SetMode);
 
+    // ---- PointCloudLOD ----
+    py::class_<PointCloudLOD, std::shared_ptr<PointCloudLOD>> lod(
+            m, "PointCloudLOD",
+            "Level of detail octree of a point cloud for rendering large "
+            "point clouds. Each node keeps a spatially uniform subset of the "
+            "points in its cube and passes the other points to its "
+            "children.");
+    lod.def_static("build", &PointCloudLOD::Build, "cloud"_a,
+                   "max_points_per_node"_a = 20000,
+                   "Builds the octree of the point cloud in memory.")
+            .def_static("read", &PointCloudLOD::Read, "directory"_a,
+                        "Reads the hierarchy of an octree written by "
+                        "write(). The points of the nodes are read on "
+                        "demand.")
+            .def("write", &PointCloudLOD::Write, "directory"_a,
+                 "Writes the hierarchy and the points of each node to the "
+                 "directory.")
+            .def("get_num_nodes",
+                 [](const PointCloudLOD &self) {
+                     return self.GetNodes().size();
+                 },
+                 "Number of nodes of the octree.")
+            .def("get_num_points", &PointCloudLOD::GetNumPoints,
+                 "Total number of points of all nodes.")
+            .def("get_node_points", &PointCloudLOD::GetNodePoints,
+                 "node_idx"_a, "Returns the points of a node.");
+
     // ---- Material ----
     py::class_<Material> mat(m, "Material",
                              "Describes the real-world, physically based (PBR) "
@@ -326,14 +379,54 @@ void pybind_rendering_classes(py::module &m) {
                  "name"_a, "geometry"_a, "material"_a,
                  "downsampled_name"_a = "", "downsample_threshold"_a = SIZE_MAX,
                  "Adds a Geometry with a material to the scene")
+            .def("add_geometry",
+                 (bool (Scene::*)(const std::string &,
+                                  const t::geometry::TriangleMesh &,
+                                  const Material &)) &
+                         Scene::AddGeometry,
+                 "name"_a, "geometry"_a, "material"_a,
+                 "Adds a tgeometry.TriangleMesh with a material to the "
+                 "scene, uploading its vertex attributes from the tensors")
+            .def("add_geometry",
+                 (bool (Scene::*)(const std::string &,
+                                  std::shared_ptr<PointCloudLOD>,
+                                  const Material &, size_t, size_t)) &
+                         Scene::AddGeometry,
+                 "name"_a, "geometry"_a, "material"_a,
+                 "point_budget"_a = 10000000,
+                 "memory_budget"_a = size_t(1) << 30,
+                 "Adds a level of detail point cloud, whose nodes are "
+                 "streamed in by the point spacing on screen within the "
+                 "point and memory budgets")
             .def("has_geometry", &Scene::HasGeometry,
                  "Returns True if a geometry with the provided name exists in "
                  "the scene.")
-            .def("update_geometry", &Scene::UpdateGeometry,
+            .def("update_geometry",
+                 (void (Scene::*)(const std::string &,
+                                  const t::geometry::PointCloud &, uint32_t)) &
+                         Scene::UpdateGeometry,
+                 "name"_a, "point_cloud"_a, "update_flag"_a,
                  "Updates the flagged arrays from the tgeometry.PointCloud. "
                  "The flags should be ORed from Scene.UPDATE_POINTS_FLAG, "
                  "Scene.UPDATE_NORMALS_FLAG, Scene.UPDATE_COLORS_FLAG, and "
                  "Scene.UPDATE_UV0_FLAG")
+            .def("update_geometry",
+                 (void (Scene::*)(const std::string &,
+                                  const t::geometry::TriangleMesh &,
+                                  uint32_t)) &
+                         Scene::UpdateGeometry,
+                 "name"_a, "mesh"_a, "update_flag"_a,
+                 "Updates the flagged vertex arrays from the "
+                 "tgeometry.TriangleMesh, which must have the same number of "
+                 "vertices. The triangles are not updated")
+            .def("update_geometry_range", &Scene::UpdateGeometryRange,
+                 "name"_a, "point_cloud"_a, "start"_a, "update_flag"_a,
+                 "Overwrites the flagged arrays of the points [start, "
+                 "start + N) of a tensor point cloud with the N values of "
+                 "the tgeometry.PointCloud")
+            .def("set_point_cloud_draw_count", &Scene::SetPointCloudDrawCount,
+                 "name"_a, "count"_a,
+                 "Draws only the first count points of a tensor point cloud")
             .def("enable_indirect_light", &Scene::EnableIndirectLight,
                  "Enables or disables indirect lighting")
             .def("set_indirect_light", &Scene::SetIndirectLight,
@@ -436,6 +529,17 @@ void pybind_rendering_classes(py::module &m) {
                          &Open3DScene::AddGeometry),
                  "name"_a, "geometry"_a, "material"_a,
                  "add_downsampled_copy_for_fast_rendering"_a = true)
+            .def("append_points", &Open3DScene::AppendPoints, "name"_a,
+                 "points"_a, "material"_a,
+                 "Appends the tgeometry.PointCloud to the streaming point "
+                 "cloud with the given name, which is added by the first "
+                 "call. Only the new points are uploaded, except when the "
+                 "spare capacity of the buffers grows")
+            .def("update_points", &Open3DScene::UpdatePoints, "name"_a,
+                 "attribute"_a, "start"_a, "values"_a,
+                 "Overwrites the 'points', 'colors' or 'normals' of the "
+                 "points [start, start + N) of a streaming point cloud with "
+                 "the (N, 3) values")
             .def("add_model", &Open3DScene::AddModel,
                  "Adds TriangleMeshModel to the scene.")
             .def("has_geometry", &Open3DScene::HasGeometry,
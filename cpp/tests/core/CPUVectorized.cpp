@@ -0,0 +1,180 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/kernel/CPUVectorized.h"
+
+#include <random>
+#include <type_traits>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+// Spans several chunks of the vectorized kernels and is not a multiple of the
+// vector width.
+static constexpr int64_t kNumElements = 100003;
+
+/// Returns a non-contiguous view of a copy of src, which is computed by the
+/// generic Indexer kernels.
+static core::Tensor NonContiguous(const core::Tensor& src) {
+    core::SizeVector shape = src.GetShape();
+    shape.back() *= 2;
+    core::Tensor strided(shape, src.GetDtype(), src.GetDevice());
+    core::Tensor view = strided.Slice(src.NumDims() - 1, 0, shape.back(), 2);
+    view.AsRvalue() = src;
+    EXPECT_FALSE(view.IsContiguous());
+    return view;
+}
+
+template <typename T>
+static core::Tensor RandomTensor(int64_t n, T low, T high, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> dist(static_cast<int>(low),
+                                            static_cast<int>(high));
+    std::vector<T> vals(n);
+    for (T& val : vals) {
+        val = static_cast<T>(dist(rng));
+    }
+    // Non-integer values for floating point types.
+    if (std::is_floating_point<T>::value) {
+        for (T& val : vals) {
+            val = val / static_cast<T>(8) + static_cast<T>(0.0625);
+        }
+    }
+    return core::Tensor(vals, {n}, core::Dtype::FromType<T>());
+}
+
+template <typename T>
+static void CheckDtype() {
+    // Small range of values to have ties in ArgMin and ArgMax.
+    core::Tensor a = RandomTensor<T>(kNumElements, 1, 50, 0);
+    core::Tensor b = RandomTensor<T>(kNumElements, 1, 50, 1);
+    core::Tensor a_nc = NonContiguous(a);
+    core::Tensor b_nc = NonContiguous(b);
+    core::Tensor scalar = core::Tensor::Full({}, 7, a.GetDtype());
+
+    auto expect_equal = [](const core::Tensor& lhs, const core::Tensor& rhs) {
+        EXPECT_EQ(lhs.GetShape(), rhs.GetShape());
+        EXPECT_EQ(lhs.GetDtype(), rhs.GetDtype());
+        if (lhs.GetDtype() == core::Dtype::Bool) {
+            EXPECT_EQ(lhs.ToFlatVector<bool>(), rhs.ToFlatVector<bool>());
+        } else if (lhs.GetDtype() == core::Dtype::Int64) {
+            EXPECT_EQ(lhs.ToFlatVector<int64_t>(),
+                      rhs.ToFlatVector<int64_t>());
+        } else {
+            EXPECT_EQ(lhs.ToFlatVector<T>(), rhs.ToFlatVector<T>());
+        }
+    };
+
+    expect_equal(a + b, a_nc + b_nc);
+    expect_equal(a - b, a_nc - b_nc);
+    expect_equal(a * b, a_nc * b_nc);
+    expect_equal(a / b, a_nc / b_nc);
+    expect_equal(a.Gt(b), a_nc.Gt(b_nc));
+    expect_equal(a.Lt(b), a_nc.Lt(b_nc));
+    expect_equal(a.Ge(b), a_nc.Ge(b_nc));
+    expect_equal(a.Le(b), a_nc.Le(b_nc));
+    expect_equal(a.Eq(b), a_nc.Eq(b_nc));
+    expect_equal(a.Ne(b), a_nc.Ne(b_nc));
+
+    // Scalar broadcasting on either side.
+    expect_equal(a - scalar, a_nc - scalar);
+    expect_equal(scalar - a, scalar - a_nc);
+    expect_equal(scalar.Lt(a), scalar.Lt(a_nc));
+
+    // In-place.
+    core::Tensor c = a.Copy();
+    c *= b;
+    expect_equal(c, a_nc * b_nc);
+
+    expect_equal(a.Neg(), a_nc.Neg());
+    expect_equal((a - 25).Abs(), (a_nc - 25).Abs());
+    if (std::is_floating_point<T>::value) {
+        expect_equal(a.Sqrt(), a_nc.Sqrt());
+    }
+
+    EXPECT_TRUE(a.Sum({0}).AllClose(a_nc.Sum({0})));
+    expect_equal(a.Min({0}), a_nc.Min({0}));
+    expect_equal(a.Max({0}), a_nc.Max({0}));
+    expect_equal(a.ArgMin({0}), a_nc.ArgMin({0}));
+    expect_equal(a.ArgMax({0}), a_nc.ArgMax({0}));
+
+    // Multi-dimensional full reduction.
+    core::Tensor a_3d = a.Slice(0, 0, 99990).Reshape({10, 99, 101});
+    core::Tensor a_3d_nc = NonContiguous(a_3d);
+    expect_equal(a_3d.ArgMax({0, 1, 2}), a_3d_nc.ArgMax({0, 1, 2}));
+    expect_equal(a_3d.Min({0, 1, 2}, true), a_3d_nc.Min({0, 1, 2}, true));
+}
+
+TEST(CPUVectorized, MatchesGenericKernels) {
+    CheckDtype<float>();
+    CheckDtype<double>();
+    CheckDtype<int32_t>();
+    CheckDtype<int64_t>();
+}
+
+TEST(CPUVectorized, ArgMinArgMaxFirstIndex) {
+    std::vector<float> vals(kNumElements, 1.f);
+    vals[50000] = 0.f;
+    vals[70000] = 0.f;
+    vals[90000] = 0.f;
+    vals[20000] = 2.f;
+    vals[99999] = 2.f;
+    core::Tensor t(vals, {kNumElements}, core::Dtype::Float32);
+    EXPECT_EQ(t.ArgMin({0}).Item<int64_t>(), 50000);
+    EXPECT_EQ(t.ArgMax({0}).Item<int64_t>(), 20000);
+}
+
+TEST(CPUVectorized, Fallback) {
+    core::Tensor a = core::Tensor::Ones({4, 3}, core::Dtype::Float32);
+    core::Tensor b = core::Tensor::Ones({3}, core::Dtype::Float32);
+    core::Tensor dst({4, 3}, core::Dtype::Float32);
+
+    // Non-scalar broadcasting, transposed and mixed dtype operands are left to
+    // the generic kernels.
+    EXPECT_FALSE(core::kernel::TryBinaryEWContiguousCPU(
+            a, b, dst, core::kernel::BinaryEWOpCode::Add));
+    EXPECT_FALSE(core::kernel::TryUnaryEWContiguousCPU(
+            a.T().Contiguous().T(), dst, core::kernel::UnaryEWOpCode::Neg));
+    EXPECT_FALSE(core::kernel::TryBinaryEWContiguousCPU(
+            a, a.To(core::Dtype::Float64), dst,
+            core::kernel::BinaryEWOpCode::Add));
+
+    // Partial reductions.
+    core::Tensor dst_partial({3}, core::Dtype::Float32);
+    EXPECT_FALSE(core::kernel::TryReductionContiguousCPU(
+            a, dst_partial, {0}, core::kernel::ReductionOpCode::Sum));
+
+    EXPECT_TRUE(core::kernel::TryBinaryEWContiguousCPU(
+            a, a, dst, core::kernel::BinaryEWOpCode::Add));
+    EXPECT_EQ(dst.ToFlatVector<float>(), std::vector<float>(12, 2.f));
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -26,6 +26,7 @@
 
 #include "open3d/core/nns/FixedRadiusIndex.h"
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
 
@@ -34,12 +35,18 @@
 #include "open3d/core/SizeVector.h"
 #include "open3d/utility/Helper.h"
 #include "tests/UnitTest.h"
+#include "tests/core/CoreTest.h"
 
 namespace open3d {
 namespace tests {
 
-TEST(FixedRadiusIndex, SearchRadius) {
-    core::Device device = core::Device("CUDA:0");
+class FixedRadiusIndexPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(FixedRadiusIndex,
+                         FixedRadiusIndexPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(FixedRadiusIndexPermuteDevices, SearchRadius) {
+    core::Device device = GetParam();
     std::vector<int> ref_indices = {1, 4};
     std::vector<float> ref_distance = {0.00626358, 0.00747938};
 
@@ -68,5 +75,74 @@ TEST(FixedRadiusIndex, SearchRadius) {
              std::vector<float>({0.00626358, 0.00747938}));
 }
 
+TEST(FixedRadiusIndex, SearchHybrid) {
+    int size = 10;
+    std::vector<float> points{0.0, 0.0, 0.0, 0.0, 0.0, 0.1, 0.0, 0.0, 0.2, 0.0,
+                              0.1, 0.0, 0.0, 0.1, 0.1, 0.0, 0.1, 0.2, 0.0, 0.2,
+                              0.0, 0.0, 0.2, 0.1, 0.0, 0.2, 0.2, 0.1, 0.0, 0.0};
+    core::Tensor ref(points, {size, 3}, core::Dtype::Float32);
+    core::nns::FixedRadiusIndex index(ref, 0.1);
+
+    core::Tensor query(std::vector<float>({0.064705, 0.043921, 0.087843, 1.0,
+                                           1.0, 1.0}),
+                       {2, 3}, core::Dtype::Float32);
+
+    // The radius bounds the squared distances and must fit in the index.
+    EXPECT_THROW(index.SearchHybrid(query, 0.02, 3), std::runtime_error);
+
+    std::pair<core::Tensor, core::Tensor> result =
+            index.SearchHybrid(query, 0.01, 3);
+    ExpectEQ(result.first.ToFlatVector<int64_t>(),
+             std::vector<int64_t>({1, 4, -1, -1, -1, -1}));
+    ExpectEQ(result.second.ToFlatVector<float>(),
+             std::vector<float>({0.00626358, 0.00747938, -1, -1, -1, -1}));
+}
+
+TEST(FixedRadiusIndex, SearchRadiusRandom) {
+    // Compare with brute force on random points, including a search radius
+    // smaller than the one of the index.
+    const int64_t num_points = 3000;
+    const int64_t num_queries = 500;
+    std::vector<double> values(num_points * 3);
+    uint32_t seed = 42;
+    for (double &v : values) {
+        seed = seed * 1664525u + 1013904223u;
+        v = double(seed >> 8) / double(1 << 24) - 0.5;
+    }
+    core::Tensor dataset(values, {num_points, 3}, core::Dtype::Float64);
+    core::Tensor query = dataset.Slice(0, 0, num_queries).Add(0.01);
+    std::vector<double> query_values = query.ToFlatVector<double>();
+
+    core::nns::FixedRadiusIndex index(dataset, 0.1);
+    for (double radius : {0.1, 0.05}) {
+        std::vector<int64_t> ref_indices;
+        std::vector<int64_t> ref_num_neighbors;
+        for (int64_t i = 0; i < num_queries; ++i) {
+            std::vector<std::pair<double, int64_t>> neighbors;
+            for (int64_t j = 0; j < num_points; ++j) {
+                double dist = 0;
+                for (int k = 0; k < 3; ++k) {
+                    double d = values[3 * j + k] - query_values[3 * i + k];
+                    dist += d * d;
+                }
+                if (dist <= radius * radius) {
+                    neighbors.emplace_back(dist, j);
+                }
+            }
+            std::sort(neighbors.begin(), neighbors.end());
+            for (const auto &neighbor : neighbors) {
+                ref_indices.push_back(neighbor.second);
+            }
+            ref_num_neighbors.push_back(int64_t(neighbors.size()));
+        }
+
+        core::Tensor indices, num_neighbors;
+        std::tie(indices, std::ignore, num_neighbors) =
+                index.SearchRadius(query, radius);
+        ExpectEQ(num_neighbors.ToFlatVector<int64_t>(), ref_num_neighbors);
+        ExpectEQ(indices.ToFlatVector<int64_t>(), ref_indices);
+    }
+}
+
 }  // namespace tests
 }  // namespace open3d
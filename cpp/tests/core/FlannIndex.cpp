@@ -0,0 +1,122 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/nns/FlannIndex.h"
+
+#include <cmath>
+
+#include "open3d/core/Dtype.h"
+#include "open3d/core/SizeVector.h"
+#include "open3d/core/nns/NanoFlannIndex.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(FlannIndex, SearchKnn) {
+    // Set up index.
+    int size = 10;
+    std::vector<double> points{0.0, 0.0, 0.0, 0.0, 0.0, 0.1, 0.0, 0.0,
+                               0.2, 0.0, 0.1, 0.0, 0.0, 0.1, 0.1, 0.0,
+                               0.1, 0.2, 0.0, 0.2, 0.0, 0.0, 0.2, 0.1,
+                               0.0, 0.2, 0.2, 0.1, 0.0, 0.0};
+    core::Tensor ref(points, {size, 3}, core::Dtype::Float64);
+    core::nns::FlannIndex index(ref);
+
+    core::Tensor query(std::vector<double>({0.064705, 0.043921, 0.087843}),
+                       {1, 3}, core::Dtype::Float64);
+
+    // If k <= 0 or checks <= 0.
+    EXPECT_THROW(index.SearchKnn(query, -1), std::runtime_error);
+    EXPECT_THROW(index.SearchKnn(query, 0), std::runtime_error);
+    EXPECT_THROW(index.SearchKnn(query, 3, 0), std::runtime_error);
+
+    // If k == 3, exact search.
+    std::pair<core::Tensor, core::Tensor> result =
+            index.SearchKnn(query, 3, -1);
+    ExpectEQ(result.first.ToFlatVector<int64_t>(),
+             std::vector<int64_t>({1, 4, 9}));
+    ExpectEQ(result.second.ToFlatVector<double>(),
+             std::vector<double>({0.00626358, 0.00747938, 0.0108912}));
+
+    // If k > size, all the points are checked.
+    result = index.SearchKnn(query, 12);
+    ExpectEQ(result.first.ToFlatVector<int64_t>(),
+             std::vector<int64_t>({1, 4, 9, 0, 3, 2, 5, 7, 6, 8}));
+}
+
+TEST(FlannIndex, SearchKnnHighDimension) {
+    // Clustered 33-D points, similar to FPFH features.
+    int64_t num_points = 5000;
+    int64_t num_queries = 200;
+    int64_t dimension = 33;
+    int knn = 5;
+    std::vector<float> values(num_points * dimension);
+    for (int64_t i = 0; i < num_points; ++i) {
+        int64_t cluster = i % 50;
+        for (int64_t d = 0; d < dimension; ++d) {
+            int64_t j = i * dimension + d;
+            values[j] = std::sin(cluster * 7.13 + d * 3.7) * 10.0f +
+                        std::sin(j * 12.9898) * 2.0f;
+        }
+    }
+    core::Tensor points(values, {num_points, dimension},
+                        core::Dtype::Float32);
+    core::Tensor queries = points.Slice(0, 0, num_queries).Mul(1.01);
+
+    core::nns::NanoFlannIndex ref_index(points);
+    std::pair<core::Tensor, core::Tensor> ref_result =
+            ref_index.SearchKnn(queries, knn);
+
+    core::nns::FlannIndex index(points, 8);
+
+    // Exact search matches the KDTree.
+    std::pair<core::Tensor, core::Tensor> result =
+            index.SearchKnn(queries, knn, -1);
+    EXPECT_TRUE(result.second.AllClose(ref_result.second));
+
+    // Approximate search finds most neighbors, never closer ones.
+    result = index.SearchKnn(queries, knn, 512);
+    EXPECT_EQ(result.first.GetShape(), core::SizeVector({num_queries, knn}));
+    EXPECT_TRUE(result.second.Ge(ref_result.second.Mul(0.999)).All());
+    std::vector<int64_t> indices = result.first.ToFlatVector<int64_t>();
+    std::vector<int64_t> ref_indices = ref_result.first.ToFlatVector<int64_t>();
+    int64_t num_found = 0;
+    for (int64_t i = 0; i < num_queries; ++i) {
+        for (int j = 0; j < knn; ++j) {
+            for (int k = 0; k < knn; ++k) {
+                if (indices[i * knn + j] == ref_indices[i * knn + k]) {
+                    ++num_found;
+                    break;
+                }
+            }
+        }
+    }
+    EXPECT_GT(num_found, 0.8 * num_queries * knn);
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -167,6 +167,66 @@ TEST_P(HashmapPermuteDevices, Insert) {
     }
 }
 
+TEST_P(HashmapPermuteDevices, InsertOrFind) {
+    core::Device device = GetParam();
+    const int n = 1000000;
+    const int slots = 1023;
+    int init_capacity = slots;
+    core::Hashmap hashmap(init_capacity, core::Dtype::Int32, core::Dtype::Int32,
+                          {1}, {1}, device);
+
+    // Pre-insert half of the slots.
+    HashData<int, int> data(n, slots);
+    std::vector<int> half_keys_val, half_values_val;
+    for (int i = 0; i < slots / 2; ++i) {
+        half_keys_val.push_back(i * data.k_factor_);
+        half_values_val.push_back(i);
+    }
+    core::Tensor half_keys(half_keys_val, {slots / 2}, core::Dtype::Int32,
+                           device);
+    core::Tensor half_values(half_values_val, {slots / 2}, core::Dtype::Int32,
+                             device);
+    core::Tensor addrs, masks;
+    hashmap.Insert(half_keys, half_values, addrs, masks);
+
+    core::Tensor keys(data.keys_, {n}, core::Dtype::Int32, device);
+    core::Tensor values(data.vals_, {n}, core::Dtype::Int32, device);
+    hashmap.InsertOrFind(keys, values, addrs, masks);
+    EXPECT_EQ(masks.To(core::Dtype::Int64).Sum({0}).Item<int64_t>(),
+              slots - slots / 2);
+    EXPECT_EQ(hashmap.Size(), slots);
+
+    // Every key maps to a valid address, whether new or pre-existing.
+    core::Tensor found_addrs, found_masks;
+    hashmap.Find(keys, found_addrs, found_masks);
+    EXPECT_EQ(found_addrs.ToFlatVector<int>(), addrs.ToFlatVector<int>());
+    EXPECT_EQ(hashmap.GetValueTensor()
+                      .IndexGet({addrs.To(core::Dtype::Int64)})
+                      .ToFlatVector<int>(),
+              data.vals_);
+
+    // Keys are new exactly when they were not pre-inserted, and each new key
+    // is reported once.
+    std::vector<int> keys_vec = data.keys_;
+    std::vector<bool> masks_vec = masks.ToFlatVector<bool>();
+    std::vector<int> new_count(slots, 0);
+    for (int i = 0; i < n; ++i) {
+        int v = keys_vec[i] / data.k_factor_;
+        if (masks_vec[i]) {
+            EXPECT_GE(v, slots / 2);
+            new_count[v]++;
+        }
+    }
+    for (int v = slots / 2; v < slots; ++v) {
+        EXPECT_EQ(new_count[v], 1);
+    }
+
+    // Activation without values.
+    hashmap.InsertOrFind(keys * 2 + 1, addrs, masks);
+    EXPECT_EQ(masks.To(core::Dtype::Int64).Sum({0}).Item<int64_t>(), slots);
+    EXPECT_EQ(hashmap.Size(), 2 * slots);
+}
+
 TEST_P(HashmapPermuteDevices, Erase) {
     core::Device device = GetParam();
     const int n = 1000000;
@@ -262,6 +322,103 @@ TEST_P(HashmapPermuteDevices, Rehash) {
     }
 }
 
+TEST_P(HashmapPermuteDevices, Reserve) {
+    core::Device device = GetParam();
+    const int n = 1000;
+    core::Hashmap hashmap(n / 10, core::Dtype::Int32, core::Dtype::Int32, {1},
+                          {1}, device);
+
+    std::vector<int> keys_val(n), values_val(n);
+    for (int i = 0; i < n; ++i) {
+        keys_val[i] = i * 100;
+        values_val[i] = i;
+    }
+
+    // Fill up the initial capacity.
+    const int m = n / 10;
+    core::Tensor keys(std::vector<int>(keys_val.begin(), keys_val.begin() + m),
+                      {m}, core::Dtype::Int32, device);
+    core::Tensor values(
+            std::vector<int>(values_val.begin(), values_val.begin() + m), {m},
+            core::Dtype::Int32, device);
+    core::Tensor addrs, masks;
+    hashmap.Insert(keys, values, addrs, masks);
+    EXPECT_EQ(hashmap.Size(), m);
+
+    // Reserve keeps existing addresses and bounds the load factor.
+    hashmap.SetMaxLoadFactor(2);
+    hashmap.Reserve(n);
+    EXPECT_GE(hashmap.GetCapacity(), n);
+    EXPECT_EQ(hashmap.Size(), m);
+    EXPECT_LE(float(n) / float(hashmap.GetBucketCount()), 2.0f);
+
+    core::Tensor found_addrs, found_masks;
+    hashmap.Find(keys, found_addrs, found_masks);
+    EXPECT_EQ(found_masks.To(core::Dtype::Int64).Sum({0}).Item<int64_t>(), m);
+    EXPECT_EQ(found_addrs.ToFlatVector<int>(), addrs.ToFlatVector<int>());
+    EXPECT_EQ(hashmap.GetValueTensor()
+                      .IndexGet({found_addrs.To(core::Dtype::Int64)})
+                      .ToFlatVector<int>(),
+              std::vector<int>(values_val.begin(), values_val.begin() + m));
+
+    // Insertions beyond the capacity grow the hashmap automatically.
+    keys = core::Tensor(keys_val, {n}, core::Dtype::Int32, device);
+    values = core::Tensor(values_val, {n}, core::Dtype::Int32, device);
+    hashmap.Insert(keys, values, addrs, masks);
+    hashmap.Insert(keys * 2 + 1, values, addrs, masks);
+    EXPECT_EQ(hashmap.Size(), 2 * n);
+    EXPECT_GE(hashmap.GetCapacity(), 2 * n);
+
+    hashmap.Find(keys, found_addrs, found_masks);
+    EXPECT_EQ(found_masks.To(core::Dtype::Int64).Sum({0}).Item<int64_t>(), n);
+    EXPECT_EQ(hashmap.GetValueTensor()
+                      .IndexGet({found_addrs.To(core::Dtype::Int64)})
+                      .ToFlatVector<int>(),
+              values_val);
+}
+
+TEST_P(HashmapPermuteDevices, KeySizes) {
+    core::Device device = GetParam();
+
+    // Int64 and Int32x2 keys use the fixed-size 8-byte specialization, Int32x5
+    // keys the generic hash.
+    for (const auto &dtype_shape :
+         std::vector<std::pair<core::Dtype, core::SizeVector>>{
+                 {core::Dtype::Int64, {1}},
+                 {core::Dtype::Int32, {2}},
+                 {core::Dtype::Int32, {5}}}) {
+        const core::Dtype dtype = dtype_shape.first;
+        const core::SizeVector elem_shape = dtype_shape.second;
+        const int n = 1000;
+        core::Hashmap hashmap(n, dtype, core::Dtype::Int32, elem_shape, {1},
+                              device);
+
+        core::SizeVector key_shape = elem_shape;
+        key_shape.insert(key_shape.begin(), n);
+        core::Tensor keys = core::Tensor::Arange(0, n * elem_shape[0], 1,
+                                                 dtype, device)
+                                    .View(key_shape);
+        core::Tensor values =
+                core::Tensor::Arange(0, n, 1, core::Dtype::Int32, device);
+
+        core::Tensor addrs, masks;
+        hashmap.Insert(keys, values, addrs, masks);
+        EXPECT_EQ(hashmap.Size(), n);
+
+        hashmap.Find(keys, addrs, masks);
+        EXPECT_EQ(masks.To(core::Dtype::Int64).Sum({0}).Item<int64_t>(), n);
+        EXPECT_EQ(hashmap.GetValueTensor()
+                          .IndexGet({addrs.To(core::Dtype::Int64)})
+                          .ToFlatVector<int>(),
+                  values.ToFlatVector<int>());
+
+        // Shifted keys only overlap with the inserted ones for scalar keys.
+        hashmap.Find(keys + 1, addrs, masks);
+        EXPECT_EQ(masks.To(core::Dtype::Int64).Sum({0}).Item<int64_t>(),
+                  elem_shape[0] == 1 ? n - 1 : 0);
+    }
+}
+
 class int3 {
 public:
     int3() : x_(0), y_(0), z_(0){};
@@ -321,5 +478,116 @@ TEST_P(HashmapPermuteDevices, InsertComplexKeys) {
     }
 }
 
+TEST_P(HashmapPermuteDevices, SaveLoad) {
+    core::Device device = GetParam();
+    const int n = 1000000;
+    const int slots = 1023;
+    core::Hashmap hashmap(slots, core::Dtype::Int32, core::Dtype::Int32, {3},
+                          {1}, device);
+
+    HashData<int3, int> data(n, slots);
+    std::vector<int> keys_int3;
+    keys_int3.assign(reinterpret_cast<int *>(data.keys_.data()),
+                     reinterpret_cast<int *>(data.keys_.data()) + 3 * n);
+    core::Tensor keys(keys_int3, {n, 3}, core::Dtype::Int32, device);
+    core::Tensor values(data.vals_, {n}, core::Dtype::Int32, device);
+
+    core::Tensor addrs, masks;
+    hashmap.Insert(keys, values, addrs, masks);
+
+    std::string file_name = std::string(TEST_DATA_DIR) + "/temp_hashmap.bin";
+    hashmap.Save(file_name);
+    core::Hashmap loaded = core::Hashmap::Load(file_name, device);
+    EXPECT_EQ(std::remove(file_name.c_str()), 0);
+
+    EXPECT_EQ(loaded.Size(), slots);
+    EXPECT_EQ(loaded.GetCapacity(), hashmap.GetCapacity());
+    EXPECT_EQ(loaded.GetDevice(), device);
+
+    loaded.Find(keys, addrs, masks);
+    EXPECT_EQ(masks.To(core::Dtype::Int64).Sum({0}).Item<int64_t>(), n);
+    EXPECT_EQ(loaded.GetValueTensor()
+                      .IndexGet({addrs.To(core::Dtype::Int64)})
+                      .ToFlatVector<int>(),
+              data.vals_);
+
+    // Loading across devices.
+    hashmap.Save(file_name);
+    core::Hashmap loaded_cpu = core::Hashmap::Load(file_name);
+    EXPECT_EQ(std::remove(file_name.c_str()), 0);
+    EXPECT_EQ(loaded_cpu.Size(), slots);
+    EXPECT_EQ(loaded_cpu.GetDevice(), core::Device("CPU:0"));
+}
+
+TEST(Hashmap, LinearProbingBackend) {
+    core::Device device("CPU:0");
+    const int n = 1000000;
+    const int slots = 1023;
+    core::Hashmap hashmap(slots / 4, core::Dtype::Int32, core::Dtype::Int32,
+                          {1}, {1}, device,
+                          core::HashmapBackend::LinearProbing);
+    EXPECT_EQ(hashmap.GetBackend(), core::HashmapBackend::LinearProbing);
+
+    // Insertions beyond the capacity grow the slot array.
+    HashData<int, int> data(n, slots);
+    core::Tensor keys(data.keys_, {n}, core::Dtype::Int32, device);
+    core::Tensor values(data.vals_, {n}, core::Dtype::Int32, device);
+    core::Tensor addrs, masks;
+    hashmap.Insert(keys, values, addrs, masks);
+    EXPECT_EQ(masks.To(core::Dtype::Int64).Sum({0}).Item<int64_t>(), slots);
+    EXPECT_EQ(hashmap.Size(), slots);
+    EXPECT_LE(hashmap.LoadFactor(), 0.5);
+
+    hashmap.Find(keys, addrs, masks);
+    EXPECT_EQ(masks.To(core::Dtype::Int64).Sum({0}).Item<int64_t>(), n);
+    EXPECT_EQ(hashmap.GetValueTensor()
+                      .IndexGet({addrs.To(core::Dtype::Int64)})
+                      .ToFlatVector<int>(),
+              data.vals_);
+
+    // Erase half of the slots, duplicated keys only succeed once.
+    std::vector<int> erase_keys_val;
+    for (int i = 0; i < slots / 2; ++i) {
+        erase_keys_val.push_back(i * data.k_factor_);
+        erase_keys_val.push_back(i * data.k_factor_);
+    }
+    core::Tensor erase_keys(erase_keys_val,
+                            {int64_t(erase_keys_val.size())},
+                            core::Dtype::Int32, device);
+    hashmap.Erase(erase_keys, masks);
+    EXPECT_EQ(masks.To(core::Dtype::Int64).Sum({0}).Item<int64_t>(),
+              slots / 2);
+    EXPECT_EQ(hashmap.Size(), slots - slots / 2);
+
+    hashmap.Find(erase_keys, addrs, masks);
+    EXPECT_EQ(masks.To(core::Dtype::Int64).Sum({0}).Item<int64_t>(), 0);
+
+    // Re-insertion over tombstones, then all keys are found again.
+    hashmap.InsertOrFind(keys, values, addrs, masks);
+    EXPECT_EQ(masks.To(core::Dtype::Int64).Sum({0}).Item<int64_t>(),
+              slots / 2);
+    EXPECT_EQ(hashmap.Size(), slots);
+
+    core::Tensor active_addrs;
+    hashmap.GetActiveIndices(active_addrs);
+    std::vector<int> active_values_vec =
+            hashmap.GetValueTensor()
+                    .IndexGet({active_addrs.To(core::Dtype::Int64)})
+                    .ToFlatVector<int>();
+    std::sort(active_values_vec.begin(), active_values_vec.end());
+    for (int i = 0; i < slots; ++i) {
+        EXPECT_EQ(active_values_vec[i], i);
+    }
+
+    // Reserve and Rehash keep addresses.
+    hashmap.Find(keys, addrs, masks);
+    std::vector<int> addrs_vec = addrs.ToFlatVector<int>();
+    hashmap.Reserve(4 * slots);
+    hashmap.Rehash(hashmap.GetBucketCount() * 2);
+    hashmap.Find(keys, addrs, masks);
+    EXPECT_EQ(masks.To(core::Dtype::Int64).Sum({0}).Item<int64_t>(), n);
+    EXPECT_EQ(addrs.ToFlatVector<int>(), addrs_vec);
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -189,5 +189,42 @@ TEST_P(IndexerPermuteDevices, GetPointers) {
     EXPECT_EQ(indexer.GetOutputPtr(5), output_base_ptr + 5 * dtype_byte_size);
 }
 
+TEST_P(IndexerPermuteDevices, IsContiguous) {
+    core::Device device = GetParam();
+
+    // Same shapes, contiguous, mixed dtypes: linear offsets per operand.
+    core::Tensor input0({2, 1, 3}, core::Dtype::Float32, device);
+    core::Tensor input1({2, 1, 3}, core::Dtype::Int64, device);
+    core::Tensor output({2, 1, 3}, core::Dtype::Bool, device);
+    core::Indexer indexer({input0, input1}, output, core::DtypePolicy::NONE);
+    EXPECT_TRUE(indexer.IsContiguous());
+    for (int64_t i = 0; i < indexer.NumWorkloads(); i++) {
+        EXPECT_EQ(indexer.GetInputPtr(0, i),
+                  static_cast<char*>(input0.GetDataPtr()) + i * 4);
+        EXPECT_EQ(indexer.GetInputPtr(1, i),
+                  static_cast<char*>(input1.GetDataPtr()) + i * 8);
+        EXPECT_EQ(indexer.GetOutputPtr(i),
+                  static_cast<char*>(output.GetDataPtr()) + i);
+    }
+
+    // 0-d tensors.
+    core::Tensor scalar({}, core::Dtype::Float32, device);
+    EXPECT_TRUE(core::Indexer({scalar}, scalar).IsContiguous());
+
+    // Broadcasting.
+    core::Tensor row({1, 3}, core::Dtype::Float32, device);
+    core::Tensor dst({2, 3}, core::Dtype::Float32, device);
+    EXPECT_FALSE(core::Indexer({row}, dst).IsContiguous());
+
+    // Non-contiguous input.
+    core::Tensor src({3, 2}, core::Dtype::Float32, device);
+    EXPECT_FALSE(core::Indexer({src.T()}, dst).IsContiguous());
+
+    // Reductions restride the output.
+    core::Tensor sum({1, 3}, core::Dtype::Float32, device);
+    EXPECT_FALSE(core::Indexer({dst}, sum, core::DtypePolicy::ALL_SAME, {0})
+                         .IsContiguous());
+}
+
 }  // namespace tests
 }  // namespace open3d
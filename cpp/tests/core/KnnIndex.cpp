@@ -0,0 +1,149 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/nns/KnnIndex.h"
+
+#include <cmath>
+#include <limits>
+
+#include "open3d/core/Device.h"
+#include "open3d/core/Dtype.h"
+#include "open3d/core/SizeVector.h"
+#include "open3d/core/nns/NanoFlannIndex.h"
+#include "open3d/utility/Helper.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(KnnIndex, SearchKnn) {
+    core::Device device = core::Device("CUDA:0");
+
+    int size = 10;
+    std::vector<float> points{0.0, 0.0, 0.0, 0.0, 0.0, 0.1, 0.0, 0.0, 0.2, 0.0,
+                              0.1, 0.0, 0.0, 0.1, 0.1, 0.0, 0.1, 0.2, 0.0, 0.2,
+                              0.0, 0.0, 0.2, 0.1, 0.0, 0.2, 0.2, 0.1, 0.0, 0.0};
+    core::Tensor ref(points, {size, 3}, core::Dtype::Float32, device);
+    core::nns::KnnIndex index(ref);
+
+    core::Tensor query(std::vector<float>({0.064705, 0.043921, 0.087843}),
+                       {1, 3}, core::Dtype::Float32, device);
+
+    // If k <= 0.
+    EXPECT_THROW(index.SearchKnn(query, -1), std::runtime_error);
+    EXPECT_THROW(index.SearchKnn(query, 0), std::runtime_error);
+
+    // If k == 3.
+    std::pair<core::Tensor, core::Tensor> result = index.SearchKnn(query, 3);
+    ExpectEQ(result.first.ToFlatVector<int64_t>(),
+             std::vector<int64_t>({1, 4, 9}));
+    ExpectEQ(result.second.ToFlatVector<float>(),
+             std::vector<float>({0.00626358, 0.00747938, 0.0108912}));
+
+    // If k > size.
+    result = index.SearchKnn(query, 12);
+    ExpectEQ(result.first.ToFlatVector<int64_t>(),
+             std::vector<int64_t>({1, 4, 9, 0, 3, 2, 5, 7, 6, 8}));
+}
+
+TEST(KnnIndex, SearchKnnRandom) {
+    core::Device device = core::Device("CUDA:0");
+    int64_t num_points = 10000;
+    int64_t num_queries = 1000;
+    int knn = 30;
+
+    std::vector<double> values(num_points * 3);
+    for (size_t i = 0; i < values.size(); ++i) {
+        values[i] = std::sin(i * 12.9898) * 4.0;
+    }
+    core::Tensor points(values, {num_points, 3}, core::Dtype::Float64, device);
+    // Queries partly outside of the bounding box of the dataset.
+    core::Tensor queries = points.Slice(0, 0, num_queries).Mul(1.5);
+
+    core::nns::KnnIndex index(points);
+    std::pair<core::Tensor, core::Tensor> result =
+            index.SearchKnn(queries, knn);
+
+    core::nns::NanoFlannIndex ref_index(points.Copy(core::Device("CPU:0")));
+    std::pair<core::Tensor, core::Tensor> ref_result =
+            ref_index.SearchKnn(queries.Copy(core::Device("CPU:0")), knn);
+
+    EXPECT_EQ(result.first.GetShape(), core::SizeVector({num_queries, knn}));
+    EXPECT_TRUE(result.second.Copy(core::Device("CPU:0"))
+                        .AllClose(ref_result.second));
+}
+
+
+TEST(KnnIndex, SearchKnnBatched) {
+    core::Device device = core::Device("CUDA:0");
+    core::Device host = core::Device("CPU:0");
+    int64_t num_points = 6000;
+    int64_t num_queries = 600;
+    int knn = 16;
+
+    std::vector<double> values(num_points * 3);
+    for (size_t i = 0; i < values.size(); ++i) {
+        values[i] = std::sin(i * 12.9898) * 4.0;
+    }
+    core::Tensor points(values, {num_points, 3}, core::Dtype::Float64, device);
+    core::Tensor queries = points.Slice(0, 0, num_queries).Mul(1.1);
+    std::vector<int64_t> points_splits({0, 1000, 1000, 6000});
+    std::vector<int64_t> queries_splits({0, 100, 300, 600});
+
+    core::nns::KnnIndex index(
+            points, core::Tensor(points_splits, {4}, core::Dtype::Int64));
+    std::pair<core::Tensor, core::Tensor> result = index.SearchKnn(
+            queries, core::Tensor(queries_splits, {4}, core::Dtype::Int64),
+            knn);
+    EXPECT_EQ(result.first.GetShape(), core::SizeVector({num_queries, knn}));
+
+    // Compare each batch with an index built on its points only.
+    for (size_t b = 0; b + 1 < points_splits.size(); ++b) {
+        core::Tensor indices =
+                result.first.Slice(0, queries_splits[b], queries_splits[b + 1])
+                        .Copy(host);
+        core::Tensor distances =
+                result.second.Slice(0, queries_splits[b], queries_splits[b + 1])
+                        .Copy(host);
+        if (points_splits[b] == points_splits[b + 1]) {
+            EXPECT_TRUE(indices.Eq(-1).All());
+            continue;
+        }
+        core::nns::NanoFlannIndex ref_index(
+                points.Slice(0, points_splits[b], points_splits[b + 1])
+                        .Copy(host));
+        std::pair<core::Tensor, core::Tensor> ref_result = ref_index.SearchKnn(
+                queries.Slice(0, queries_splits[b], queries_splits[b + 1])
+                        .Copy(host),
+                knn);
+        EXPECT_TRUE(distances.AllClose(ref_result.second));
+        EXPECT_TRUE(indices.Ge(points_splits[b]).All());
+        EXPECT_TRUE(indices.Lt(points_splits[b + 1]).All());
+    }
+}
+
+}  // namespace tests
+}  // namespace open3d
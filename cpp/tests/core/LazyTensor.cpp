@@ -0,0 +1,152 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/LazyTensor.h"
+
+#include <cmath>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "tests/UnitTest.h"
+#include "tests/core/CoreTest.h"
+
+namespace open3d {
+namespace tests {
+
+class LazyTensorPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(LazyTensor,
+                         LazyTensorPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(LazyTensorPermuteDevices, BinaryUnaryChain) {
+    core::Device device = GetParam();
+
+    core::Tensor a = core::Tensor::Init<float>({{4, 9, 16}, {25, 36, 49}},
+                                               device);
+    core::Tensor b = core::Tensor::Init<float>({1, 2, 3}, device);
+    core::Tensor c = core::Tensor::Init<float>({2, 2, 2}, device);
+
+    core::Tensor eager = (a - b).Mul(c).Sqrt();
+    core::Tensor lazy = (a.Lazy() - b).Mul(c).Sqrt().Eval();
+    EXPECT_EQ(lazy.GetShape(), core::SizeVector({2, 3}));
+    EXPECT_EQ(lazy.GetDevice(), device);
+    EXPECT_TRUE(lazy.AllClose(eager));
+
+    // Implicit evaluation and scalar operands.
+    core::Tensor scaled = (a.Lazy() * 2 + 1).Neg();
+    EXPECT_EQ(scaled.ToFlatVector<float>(),
+              std::vector<float>({-9, -19, -33, -51, -73, -99}));
+
+    // The same leaf used multiple times.
+    core::Tensor squared = a.Lazy() * a;
+    EXPECT_TRUE(squared.AllClose(a * a));
+}
+
+TEST_P(LazyTensorPermuteDevices, Int) {
+    core::Device device = GetParam();
+
+    core::Tensor a = core::Tensor::Init<int32_t>({-3, -1, 2, 7}, device);
+    core::Tensor result = (a.Lazy().Abs() - 1) / 2;
+    EXPECT_EQ(result.ToFlatVector<int32_t>(),
+              std::vector<int32_t>({1, 0, 0, 3}));
+
+    // Float-only ops are rejected for integer dtypes.
+    EXPECT_ANY_THROW(a.Lazy().Sqrt());
+}
+
+TEST_P(LazyTensorPermuteDevices, LargeExpression) {
+    core::Device device = GetParam();
+
+    // Exceeds the number of instructions of one fused kernel, the expression
+    // is split into multiple kernels.
+    core::Tensor a = core::Tensor::Ones({10}, core::Dtype::Float64, device);
+    core::LazyTensor expr = a.Lazy();
+    for (int i = 0; i < 40; ++i) {
+        expr = expr + a;
+    }
+    core::Tensor result = expr.Eval();
+    EXPECT_TRUE(result.AllClose(
+            core::Tensor::Full({10}, 41.0, core::Dtype::Float64, device)));
+}
+
+TEST_P(LazyTensorPermuteDevices, SplitLargeExpression) {
+    core::Device device = GetParam();
+
+    // A chain much longer than one fused kernel, mixing unary and binary
+    // ops, is split into the largest sub-expressions that fit.
+    core::Tensor a = core::Tensor::Init<double>({0.5, 1, 2, 4}, device);
+    core::Tensor b = core::Tensor::Init<double>({1, 2, 3, 4}, device);
+    core::LazyTensor lazy = a.Lazy();
+    core::Tensor eager = a;
+    for (int i = 0; i < 500; ++i) {
+        if (i % 3 == 0) {
+            lazy = lazy.Abs();
+            eager = eager.Abs();
+        } else if (i % 3 == 1) {
+            lazy = lazy * 0.5 + b;
+            eager = eager * 0.5 + b;
+        } else {
+            lazy = lazy - b * 0.25;
+            eager = eager - b * 0.25;
+        }
+    }
+    EXPECT_TRUE(lazy.Eval().AllClose(eager));
+
+    // A right-nested expression exceeds the stack size of one kernel.
+    core::LazyTensor nested = b.Lazy();
+    core::Tensor nested_eager = b;
+    for (int i = 0; i < 20; ++i) {
+        nested = (a.Lazy() + i) * nested;
+        nested_eager = (a + i) * nested_eager;
+    }
+    EXPECT_TRUE(nested.Eval().AllClose(nested_eager));
+
+    // More distinct operands than the inputs of one kernel.
+    std::vector<core::Tensor> operands;
+    core::Tensor sum_eager = core::Tensor::Zeros({4}, a.GetDtype(), device);
+    for (int i = 0; i < 30; ++i) {
+        operands.push_back(a * double(i));
+        sum_eager = sum_eager + operands.back();
+    }
+    core::LazyTensor sum = operands[0].Lazy();
+    for (int i = 1; i < 30; ++i) {
+        sum = sum + operands[i];
+    }
+    EXPECT_TRUE(sum.Eval().AllClose(sum_eager));
+}
+
+TEST_P(LazyTensorPermuteDevices, Mismatch) {
+    core::Device device = GetParam();
+
+    core::Tensor a = core::Tensor::Ones({2, 3}, core::Dtype::Float32, device);
+    core::Tensor b = core::Tensor::Ones({2, 3}, core::Dtype::Float64, device);
+    core::Tensor c = core::Tensor::Ones({4}, core::Dtype::Float32, device);
+    EXPECT_ANY_THROW(a.Lazy() + b);
+    EXPECT_ANY_THROW(a.Lazy() + c);
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -33,6 +33,7 @@
 #include "open3d/core/SizeVector.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/core/kernel/Kernel.h"
+#include "open3d/core/linalg/SymmetricEigen3x3.h"
 #include "open3d/utility/Helper.h"
 #include "tests/UnitTest.h"
 #include "tests/core/CoreTest.h"
@@ -86,6 +87,51 @@ TEST_P(LinalgPermuteDevices, Matmul) {
     EXPECT_ANY_THROW(A.Matmul(core::Tensor::Zeros({3, 4, 5}, dtype)));
     EXPECT_ANY_THROW(A.Matmul(core::Tensor::Zeros({3, 0}, dtype)));
     EXPECT_ANY_THROW(A.Matmul(core::Tensor::Zeros({2, 4}, dtype)));
+
+    // Output version, writing into the preallocated tensor.
+    core::Tensor C_out = core::Tensor::Zeros({2, 4}, dtype, device);
+    void* C_out_ptr = C_out.GetDataPtr();
+    A.Matmul(B, C_out);
+    EXPECT_EQ(C_out.GetDataPtr(), C_out_ptr);
+    EXPECT_TRUE(C_out.AllClose(C));
+
+    // Non-contiguous output.
+    core::Tensor C_out_T = core::Tensor::Zeros({4, 2}, dtype, device).T();
+    A.Matmul(B, C_out_T);
+    EXPECT_TRUE(C_out_T.AllClose(C));
+
+    // Matrix-vector product.
+    core::Tensor v(std::vector<float>{1, 0, -1}, {3}, dtype, device);
+    core::Tensor Av = core::Tensor::Zeros({2, 1}, dtype, device);
+    A.Matmul(v, Av);
+    EXPECT_EQ(Av.ToFlatVector<float>(), std::vector<float>({-2, -2}));
+
+    EXPECT_ANY_THROW(A.Matmul(B, Av));
+    core::Tensor C_out_double =
+            core::Tensor::Zeros({2, 4}, core::Dtype::Float64, device);
+    EXPECT_ANY_THROW(A.Matmul(B, C_out_double));
+
+    // Batched matmul test, with small matrices and with matrices large enough
+    // to be multiplied by BLAS.
+    for (int64_t size : {3, 16}) {
+        core::Tensor A_batch =
+                core::Tensor::Arange(0, 4 * size * (size + 1), 1, dtype, device)
+                        .Reshape({4, size, size + 1});
+        core::Tensor B_batch =
+                core::Tensor::Arange(0, 4 * (size + 1) * 2, 1, dtype, device)
+                        .Reshape({4, size + 1, 2});
+        core::Tensor C_batch = A_batch.Matmul(B_batch);
+        EXPECT_EQ(C_batch.GetShape(), core::SizeVector({4, size, 2}));
+        for (int64_t i = 0; i < 4; ++i) {
+            EXPECT_TRUE(C_batch[i].AllClose(A_batch[i].Matmul(B_batch[i])));
+        }
+    }
+    EXPECT_ANY_THROW(core::Tensor::Ones({2, 3, 4}, dtype, device)
+                             .Matmul(core::Tensor::Ones({3, 4, 5}, dtype,
+                                                        device)));
+    EXPECT_ANY_THROW(core::Tensor::Ones({2, 3, 4}, dtype, device)
+                             .Matmul(core::Tensor::Ones({4, 5}, dtype,
+                                                        device)));
 }
 
 TEST_P(LinalgPermuteDevices, Inverse) {
@@ -114,6 +160,16 @@ TEST_P(LinalgPermuteDevices, Inverse) {
     EXPECT_ANY_THROW(core::Tensor::Ones({0}, dtype, device).Inverse());
     EXPECT_ANY_THROW(core::Tensor::Ones({2, 2, 2}, dtype, device).Inverse());
     EXPECT_ANY_THROW(core::Tensor::Ones({3, 4}, dtype, device).Inverse());
+
+    // Batched inverse test
+    core::Tensor A_batch = core::Tensor::Empty({2, 3, 3}, dtype, device);
+    A_batch[0] = A;
+    A_batch[1] = A.T().Mul(2);
+    core::Tensor A_batch_inv = A_batch.Inverse();
+    EXPECT_EQ(A_batch_inv.GetShape(), core::SizeVector({2, 3, 3}));
+    EXPECT_TRUE(A_batch_inv[0].AllClose(A_inv, 1e-5, 1e-5));
+    EXPECT_TRUE(A_batch_inv[1].AllClose(A_inv.T().Div(2), 1e-5, 1e-5));
+    EXPECT_ANY_THROW(core::Tensor::Ones({2, 3, 4}, dtype, device).Inverse());
 }
 
 TEST_P(LinalgPermuteDevices, SVD) {
@@ -159,6 +215,29 @@ TEST_P(LinalgPermuteDevices, SVD) {
     for (int i = 0; i < 8; ++i) {
         EXPECT_TRUE(std::abs(A_data[i] - USVT_data[i]) < EPSILON);
     }
+
+    // Batched SVD test
+    core::Tensor A_batch = core::Tensor::Empty({2, 4, 2}, dtype, device);
+    A_batch[0] = A;
+    A_batch[1] = A.Mul(-3);
+    core::Tensor U_batch, S_batch, VT_batch;
+    std::tie(U_batch, S_batch, VT_batch) = A_batch.SVD();
+    EXPECT_EQ(U_batch.GetShape(), core::SizeVector({2, 4, 4}));
+    EXPECT_EQ(S_batch.GetShape(), core::SizeVector({2, 2}));
+    EXPECT_EQ(VT_batch.GetShape(), core::SizeVector({2, 2, 2}));
+    EXPECT_TRUE(S_batch[0].AllClose(S, EPSILON, EPSILON));
+    EXPECT_TRUE(S_batch[1].AllClose(S.Mul(3), EPSILON, EPSILON));
+    for (int64_t i = 0; i < 2; ++i) {
+        core::Tensor USVT_i =
+                U_batch[i]
+                        .GetItem({core::TensorKey::Slice(core::None, core::None,
+                                                         core::None),
+                                  core::TensorKey::Slice(core::None, 2,
+                                                         core::None)})
+                        .Matmul(core::Tensor::Diag(S_batch[i])
+                                        .Matmul(VT_batch[i]));
+        EXPECT_TRUE(USVT_i.AllClose(A_batch[i], EPSILON, EPSILON));
+    }
 }
 
 TEST_P(LinalgPermuteDevices, Solve) {
@@ -187,6 +266,28 @@ TEST_P(LinalgPermuteDevices, Solve) {
     EXPECT_ANY_THROW(core::Tensor::Ones({2, 2, 2}, dtype, device).Solve(B));
     EXPECT_ANY_THROW(core::Tensor::Ones({2, 0}, dtype, device).Solve(B));
     EXPECT_ANY_THROW(core::Tensor::Ones({2}, dtype, device).Solve(B));
+
+    // Batched solve test
+    core::Tensor A_batch(std::vector<float>{3, 1, 1, 2, 2, 0, 0, 4}, {2, 2, 2},
+                         dtype, device);
+    core::Tensor B_batch(std::vector<float>{9, 8, 2, 4}, {2, 2}, dtype,
+                         device);
+    core::Tensor X_batch = A_batch.Solve(B_batch);
+    EXPECT_EQ(X_batch.GetShape(), core::SizeVector({2, 2}));
+    EXPECT_TRUE(X_batch.AllClose(core::Tensor(
+            std::vector<float>{2, 3, 1, 1}, {2, 2}, dtype, device)));
+
+    core::Tensor B_batch_matrix = B_batch.Reshape({2, 2, 1}).Mul(
+            core::Tensor(std::vector<float>{1, -1}, {1, 1, 2}, dtype, device));
+    X_batch = A_batch.Solve(B_batch_matrix);
+    EXPECT_EQ(X_batch.GetShape(), core::SizeVector({2, 2, 2}));
+    EXPECT_TRUE(X_batch.AllClose(
+            core::Tensor(std::vector<float>{2, -2, 3, -3, 1, -1, 1, -1},
+                         {2, 2, 2}, dtype, device)));
+
+    EXPECT_ANY_THROW(core::Tensor::Zeros({2, 2, 2}, dtype, device)
+                             .Solve(B_batch));
+    EXPECT_ANY_THROW(A_batch.Solve(B));
 }
 
 TEST_P(LinalgPermuteDevices, LeastSquares) {
@@ -216,5 +317,59 @@ TEST_P(LinalgPermuteDevices, LeastSquares) {
         EXPECT_TRUE(std::abs(X_data[i] - X_gt[i]) < EPSILON);
     }
 }
+
+TEST_P(LinalgPermuteDevices, SymmetricEigen3x3) {
+    core::Device device = GetParam();
+    core::Tensor eigenvalues, eigenvectors;
+
+    for (core::Dtype dtype : {core::Dtype::Float32, core::Dtype::Float64}) {
+        // The closed form loses precision for repeated eigenvalues in Float32.
+        double epsilon = dtype == core::Dtype::Float32 ? 1e-3 : 1e-8;
+
+        // A general matrix, a matrix of points on a plane, a diagonal matrix,
+        // a matrix with a repeated eigenvalue and a zero matrix.
+        core::Tensor A(std::vector<double>{4, 1, 2, 1, 3, 0, 2,  0, 5,  //
+                                           1, 1, 0, 1, 1, 0, 0,  0, 0,  //
+                                           3, 0, 0, 0, 1, 0, 0,  0, 2,  //
+                                           2, 1, 0, 1, 2, 0, 0,  0, 1,  //
+                                           0, 0, 0, 0, 0, 0, 0,  0, 0},
+                       {5, 3, 3}, core::Dtype::Float64, device);
+        A = A.To(dtype);
+
+        core::SymmetricEigen3x3(A, eigenvalues, eigenvectors);
+        EXPECT_EQ(eigenvalues.GetShape(), core::SizeVector({5, 3}));
+        EXPECT_EQ(eigenvectors.GetShape(), core::SizeVector({5, 3, 3}));
+
+        std::vector<double> eigenvalues_data =
+                eigenvalues.To(core::Dtype::Float64).ToFlatVector<double>();
+        std::vector<double> eigenvalues_gt = {
+                1.8548973088, 3.4760236029, 6.6690790883, 0, 0, 2, 1, 2, 3,
+                1,            1,            3,            0, 0, 0};
+        for (size_t i = 0; i < eigenvalues_gt.size(); ++i) {
+            EXPECT_NEAR(eigenvalues_data[i], eigenvalues_gt[i], epsilon);
+        }
+
+        // A V = V diag(eigenvalues) and V is orthonormal.
+        core::Tensor AV = A.Matmul(eigenvectors);
+        core::Tensor VD = eigenvectors.Mul(eigenvalues.Reshape({5, 1, 3}));
+        EXPECT_TRUE(AV.AllClose(VD, epsilon, epsilon));
+        core::Tensor VTV = eigenvectors.Transpose(1, 2).Matmul(eigenvectors);
+        core::Tensor eye = core::Tensor::Eye(3, dtype, device)
+                                   .Reshape({1, 3, 3})
+                                   .Expand({5, 3, 3});
+        EXPECT_TRUE(VTV.AllClose(eye, epsilon, epsilon));
+    }
+
+    // Shape test
+    EXPECT_ANY_THROW(core::SymmetricEigen3x3(
+            core::Tensor::Ones({3, 3}, core::Dtype::Float32, device),
+            eigenvalues, eigenvectors));
+    EXPECT_ANY_THROW(core::SymmetricEigen3x3(
+            core::Tensor::Ones({2, 2, 2}, core::Dtype::Float32, device),
+            eigenvalues, eigenvectors));
+    EXPECT_ANY_THROW(core::SymmetricEigen3x3(
+            core::Tensor::Ones({2, 3, 3}, core::Dtype::Int32, device),
+            eigenvalues, eigenvectors));
+}
 }  // namespace tests
 }  // namespace open3d
@@ -26,6 +26,8 @@
 
 #include "open3d/core/MemoryManager.h"
 
+#include <memory>
+#include <thread>
 #include <vector>
 
 #include "open3d/core/Blob.h"
@@ -78,5 +80,199 @@ TEST_P(MemoryManagerPermuteDevicePairs, Memcpy) {
     core::MemoryManager::Free(src_ptr, src_device);
 }
 
+TEST_P(MemoryManagerPermuteDevices, Statistics) {
+    core::Device device = GetParam();
+    core::MemoryManager::ResetPeakStatistics(device);
+    core::MemoryStatistics before = core::MemoryManager::GetStatistics(device);
+
+    void* ptr0 = core::MemoryManager::Malloc(100, device);
+    void* ptr1 = nullptr;
+    {
+        core::MemoryTagScope scope("test");
+        EXPECT_EQ(core::MemoryTagScope::GetCurrentTag(), "test");
+        ptr1 = core::MemoryManager::Malloc(200, device);
+    }
+    EXPECT_EQ(core::MemoryTagScope::GetCurrentTag(), "");
+
+    core::MemoryStatistics stats = core::MemoryManager::GetStatistics(device);
+    EXPECT_EQ(stats.bytes_allocated_ - before.bytes_allocated_, 300);
+    EXPECT_EQ(stats.num_allocations_ - before.num_allocations_, 2);
+    EXPECT_EQ(stats.num_total_allocations_ - before.num_total_allocations_,
+              2);
+    EXPECT_EQ(stats.peak_bytes_allocated_, stats.bytes_allocated_);
+    EXPECT_EQ(stats.bytes_allocated_per_tag_.at("test"), 200);
+
+    core::MemoryManager::Free(ptr1, device);
+    core::MemoryManager::Free(ptr0, device);
+    stats = core::MemoryManager::GetStatistics(device);
+    EXPECT_EQ(stats.bytes_allocated_, before.bytes_allocated_);
+    EXPECT_EQ(stats.num_allocations_, before.num_allocations_);
+    EXPECT_EQ(stats.peak_bytes_allocated_ - before.bytes_allocated_, 300);
+    EXPECT_EQ(stats.bytes_allocated_per_tag_.count("test"), 0);
+
+    core::MemoryManager::ResetPeakStatistics(device);
+    stats = core::MemoryManager::GetStatistics(device);
+    EXPECT_EQ(stats.peak_bytes_allocated_, stats.bytes_allocated_);
+}
+
+TEST(MemoryManager, StatisticsMultiThreaded) {
+    core::Device device("CPU:0");
+    core::MemoryStatistics before = core::MemoryManager::GetStatistics(device);
+
+    const int num_threads = 8;
+    const int num_iters = 1000;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&device, t]() {
+            // Odd threads account their allocations to a tag.
+            std::unique_ptr<core::MemoryTagScope> scope;
+            if (t % 2 == 1) {
+                scope.reset(new core::MemoryTagScope("multi_threaded"));
+            }
+            for (int i = 0; i < num_iters; ++i) {
+                void* ptr = core::MemoryManager::Malloc(64 + i, device);
+                core::MemoryManager::Free(ptr, device);
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    core::MemoryStatistics stats = core::MemoryManager::GetStatistics(device);
+    EXPECT_EQ(stats.bytes_allocated_, before.bytes_allocated_);
+    EXPECT_EQ(stats.num_allocations_, before.num_allocations_);
+    EXPECT_EQ(stats.num_total_allocations_ - before.num_total_allocations_,
+              num_threads * num_iters);
+    EXPECT_GE(stats.peak_bytes_allocated_ - before.bytes_allocated_, 64);
+    EXPECT_EQ(stats.bytes_allocated_per_tag_.count("multi_threaded"), 0);
+}
+
+TEST(MemoryManager, CPUCachedReuse) {
+    core::Device device("CPU:0");
+    core::CPUCachedMemoryManager manager;
+    core::CPUCachedMemoryManager::ReleaseCache();
+    core::CPUCacheStatistics before =
+            core::CPUCachedMemoryManager::GetCacheStatistics();
+
+    void* ptr = manager.Malloc(1000, device);
+    memset(ptr, 1, 1000);
+    manager.Free(ptr, device);
+    ASSERT_GT(core::CPUCachedMemoryManager::GetCacheStatistics().bytes_cached_,
+              0);
+
+    // Same size class, the block is reused.
+    void* ptr_reused = manager.Malloc(1010, device);
+    EXPECT_EQ(ptr_reused, ptr);
+    core::CPUCacheStatistics after =
+            core::CPUCachedMemoryManager::GetCacheStatistics();
+    EXPECT_EQ(after.num_mallocs_ - before.num_mallocs_, 2);
+    EXPECT_EQ(after.num_cache_hits_ - before.num_cache_hits_, 1);
+    manager.Free(ptr_reused, device);
+
+    // Large blocks are not cached.
+    void* ptr_large = manager.Malloc(size_t(1) << 27, device);
+    manager.Free(ptr_large, device);
+
+    core::CPUCachedMemoryManager::ReleaseCache();
+    after = core::CPUCachedMemoryManager::GetCacheStatistics();
+    EXPECT_EQ(after.bytes_cached_, 0);
+    EXPECT_EQ(after.num_cached_blocks_, 0);
+    EXPECT_EQ(manager.Malloc(0, device), nullptr);
+
+    void* ptr_stats = manager.Malloc(1000, device);
+    manager.Free(ptr_stats, device);
+    core::MemoryStatistics stats = manager.GetStatistics(device);
+    EXPECT_EQ(stats.bytes_allocated_, 0);
+    EXPECT_GE(stats.bytes_cached_, 1000);
+    core::CPUCachedMemoryManager::ReleaseCache();
+}
+
+TEST(MemoryManager, CPULargeAllocation) {
+    core::Device device("CPU:0");
+    const core::CPULargeAllocationOptions prev_options =
+            core::CPUMemoryManager::GetLargeAllocationOptions();
+    core::CPULargeAllocationOptions options;
+    options.min_bytes_ = size_t(1) << 22;
+    for (core::CPUPagePlacement placement :
+         {core::CPUPagePlacement::FirstTouch,
+          core::CPUPagePlacement::ParallelFirstTouch,
+          core::CPUPagePlacement::Interleave}) {
+        options.placement_ = placement;
+        core::CPUMemoryManager::SetLargeAllocationOptions(options);
+
+        core::CPUMemoryManager manager;
+        const size_t byte_size = (size_t(1) << 23) + 100;
+        char* ptr = static_cast<char*>(manager.Malloc(byte_size, device));
+        ASSERT_NE(ptr, nullptr);
+        std::vector<char> values(byte_size, 7);
+        memcpy(ptr, values.data(), byte_size);
+        EXPECT_EQ(ptr[0], 7);
+        EXPECT_EQ(ptr[byte_size - 1], 7);
+        EXPECT_EQ(manager.GetStatistics(device).bytes_allocated_,
+                  int64_t(byte_size));
+        manager.Free(ptr, device);
+        EXPECT_FALSE(core::CPUMemoryManager::FreeLarge(ptr));
+
+        // Small allocations still use the system allocator.
+        void* ptr_small = manager.Malloc(1000, device);
+        EXPECT_FALSE(core::CPUMemoryManager::FreeLarge(ptr_small));
+        manager.Free(ptr_small, device);
+
+        // Blocks too large to be cached are mapped by the cached manager.
+        core::CPUCachedMemoryManager cached_manager;
+        void* ptr_large = cached_manager.Malloc(size_t(1) << 27, device);
+        memset(ptr_large, 1, size_t(1) << 27);
+        cached_manager.Free(ptr_large, device);
+    }
+    core::CPUMemoryManager::SetLargeAllocationOptions(prev_options);
+}
+
+TEST(MemoryManager, SetLargeAllocationOptions) {
+    const core::CPULargeAllocationOptions prev_options =
+            core::CPUMemoryManager::GetLargeAllocationOptions();
+    core::CPULargeAllocationOptions options;
+    options.min_bytes_ = size_t(1) << 20;
+    options.placement_ = core::CPUPagePlacement::FirstTouch;
+    for (bool transparent_huge_pages : {false, true}) {
+        for (bool hugetlb : {false, true}) {
+            options.transparent_huge_pages_ = transparent_huge_pages;
+            options.hugetlb_ = hugetlb;
+            core::CPUMemoryManager::SetLargeAllocationOptions(options);
+            core::CPULargeAllocationOptions current =
+                    core::CPUMemoryManager::GetLargeAllocationOptions();
+            EXPECT_EQ(current.min_bytes_, options.min_bytes_);
+            EXPECT_EQ(current.placement_, options.placement_);
+            EXPECT_EQ(current.transparent_huge_pages_, transparent_huge_pages);
+            EXPECT_EQ(current.hugetlb_, hugetlb);
+
+            // Below the threshold nothing is mapped.
+            const size_t small_size = options.min_bytes_ - 1;
+            EXPECT_EQ(core::CPUMemoryManager::MallocLarge(small_size), nullptr);
+
+            const size_t byte_size = options.min_bytes_ + 12345;
+            char* ptr = static_cast<char*>(
+                    core::CPUMemoryManager::MallocLarge(byte_size));
+#ifdef __linux__
+            ASSERT_NE(ptr, nullptr);
+            EXPECT_EQ(reinterpret_cast<uintptr_t>(ptr) % (1 << 21), 0u);
+            memset(ptr, 3, byte_size);
+            EXPECT_EQ(ptr[0], 3);
+            EXPECT_EQ(ptr[byte_size - 1], 3);
+            EXPECT_TRUE(core::CPUMemoryManager::FreeLarge(ptr));
+            EXPECT_FALSE(core::CPUMemoryManager::FreeLarge(ptr));
+#else
+            EXPECT_EQ(ptr, nullptr);
+#endif
+        }
+    }
+
+    // A threshold of 0 disables large allocations.
+    options.min_bytes_ = 0;
+    core::CPUMemoryManager::SetLargeAllocationOptions(options);
+    EXPECT_EQ(core::CPUMemoryManager::MallocLarge(size_t(1) << 22), nullptr);
+    core::CPUMemoryManager::SetLargeAllocationOptions(prev_options);
+}
+
 }  // namespace tests
 }  // namespace open3d
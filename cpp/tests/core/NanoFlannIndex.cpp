@@ -108,5 +108,63 @@ TEST(NanoFlannIndex, SearchRadius) {
              std::vector<double>({0.00626358, 0.00747938}));
 }
 
+
+TEST(NanoFlannIndex, AddRemovePoints) {
+    // Points on a jittered grid, added and removed in batches.
+    int64_t size = 2000;
+    std::vector<double> points(size * 3);
+    for (int64_t i = 0; i < size * 3; ++i) {
+        points[i] = std::sin(i * 12.9898) * 4.0;
+    }
+    core::Tensor ref(points, {size, 3}, core::Dtype::Float64);
+    core::nns::NanoFlannIndex index(ref.Slice(0, 0, 100));
+    std::vector<bool> active(size, false);
+    for (int64_t i = 0; i < 100; ++i) {
+        active[i] = true;
+    }
+
+    for (int64_t begin = 100; begin < size; begin += 100) {
+        EXPECT_TRUE(index.AddPoints(ref.Slice(0, begin, begin + 100)));
+        std::vector<int64_t> removed;
+        for (int64_t i = begin; i < begin + 100; ++i) {
+            active[i] = true;
+        }
+        for (int64_t i = begin / 2; i < begin / 2 + 60; ++i) {
+            removed.push_back(i);
+            active[i] = false;
+        }
+        EXPECT_TRUE(index.RemovePoints(
+                core::Tensor(removed, {int64_t(removed.size())},
+                             core::Dtype::Int64)));
+    }
+
+    // Compare with an index built from scratch on the remaining points.
+    std::vector<int64_t> active_indices;
+    for (int64_t i = 0; i < size; ++i) {
+        if (active[i]) {
+            active_indices.push_back(i);
+        }
+    }
+    core::Tensor active_indices_t(active_indices,
+                                  {int64_t(active_indices.size())},
+                                  core::Dtype::Int64);
+    core::nns::NanoFlannIndex ref_index(ref.IndexGet({active_indices_t}));
+
+    core::Tensor query = ref.Slice(0, 0, 200).Mul(1.1);
+    core::Tensor indices, distances, ref_indices, ref_distances;
+    std::tie(indices, distances) = index.SearchKnn(query, 8);
+    std::tie(ref_indices, ref_distances) = ref_index.SearchKnn(query, 8);
+    EXPECT_TRUE(indices.AllClose(active_indices_t.IndexGet({ref_indices})));
+    EXPECT_TRUE(distances.AllClose(ref_distances));
+
+    core::Tensor num_neighbors, ref_num_neighbors;
+    std::tie(indices, distances, num_neighbors) =
+            index.SearchRadius(query, 1.0);
+    std::tie(ref_indices, ref_distances, ref_num_neighbors) =
+            ref_index.SearchRadius(query, 1.0);
+    EXPECT_TRUE(num_neighbors.AllClose(ref_num_neighbors));
+    EXPECT_TRUE(distances.AllClose(ref_distances));
+}
+
 }  // namespace tests
 }  // namespace open3d
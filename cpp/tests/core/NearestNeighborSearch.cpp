@@ -87,7 +87,7 @@ TEST_P(NNSPermuteDevices, KnnSearch) {
     // Multiple points.
     query = core::Tensor(std::vector<float>({0.064705, 0.043921, 0.087843,
                                              0.064705, 0.043921, 0.087843}),
-                         {2, 3}, core::Dtype::Float32);
+                         {2, 3}, core::Dtype::Float32, device);
     result = nns.KnnSearch(query, 3);
     indices = result.first;
     distances = result.second;
@@ -135,6 +135,97 @@ TEST_P(NNSPermuteDevices, FixedRadiusSearch) {
              std::vector<double>({0.00626358, 0.00747938}));
 }
 
+TEST_P(NNSPermuteDevices, BatchedSearch) {
+    // Set up nns with three batches, the second one being a copy of the first
+    // one and the third one holding its first two points.
+    core::Device device = GetParam();
+    std::vector<float> points{0.0, 0.0, 0.0, 0.0, 0.0, 0.1, 0.0, 0.0, 0.2, 0.0,
+                              0.1, 0.0, 0.0, 0.1, 0.1, 0.0, 0.1, 0.2, 0.0, 0.2,
+                              0.0, 0.0, 0.2, 0.1, 0.0, 0.2, 0.2, 0.1, 0.0, 0.0};
+    std::vector<float> batched_points = points;
+    batched_points.insert(batched_points.end(), points.begin(), points.end());
+    batched_points.insert(batched_points.end(), points.begin(),
+                          points.begin() + 6);
+    core::Tensor ref(batched_points, {22, 3}, core::Dtype::Float32, device);
+    core::Tensor points_row_splits(std::vector<int64_t>({0, 10, 20, 22}), {4},
+                                   core::Dtype::Int64);
+    core::nns::NearestNeighborSearch nns(ref, points_row_splits);
+
+    core::Tensor query(std::vector<float>({0.064705, 0.043921, 0.087843,
+                                           0.064705, 0.043921, 0.087843,
+                                           0.064705, 0.043921, 0.087843}),
+                       {3, 3}, core::Dtype::Float32, device);
+    core::Tensor queries_row_splits(std::vector<int64_t>({0, 1, 2, 3}), {4},
+                                    core::Dtype::Int64);
+
+    // Batched dataset points require batched queries.
+    EXPECT_THROW(nns.HybridIndex(), std::runtime_error);
+    nns.KnnIndex();
+    EXPECT_THROW(nns.KnnSearch(query, 3), std::runtime_error);
+    EXPECT_THROW(nns.KnnSearch(query, points_row_splits, 3),
+                 std::runtime_error);
+
+    // Neighbors are only searched in the batch of the query.
+    std::pair<core::Tensor, core::Tensor> knn_result =
+            nns.KnnSearch(query, queries_row_splits, 3);
+    ExpectEQ(knn_result.first.ToFlatVector<int64_t>(),
+             std::vector<int64_t>({1, 4, 9, 11, 14, 19, 21, 20, -1}));
+    ExpectEQ(knn_result.second.ToFlatVector<float>(),
+             std::vector<float>({0.00626358, 0.00747938, 0.0108912, 0.00626358,
+                                 0.00747938, 0.0108912, 0.00626358, 0.0138322,
+                                 -1}));
+
+    nns.FixedRadiusIndex(0.1);
+    std::tuple<core::Tensor, core::Tensor, core::Tensor> radius_result =
+            nns.FixedRadiusSearch(query, queries_row_splits, 0.1);
+    ExpectEQ(std::get<0>(radius_result).ToFlatVector<int64_t>(),
+             std::vector<int64_t>({1, 4, 11, 14, 21}));
+    ExpectEQ(std::get<1>(radius_result).ToFlatVector<float>(),
+             std::vector<float>({0.00626358, 0.00747938, 0.00626358,
+                                 0.00747938, 0.00626358}));
+    ExpectEQ(std::get<2>(radius_result).ToFlatVector<int64_t>(),
+             std::vector<int64_t>({2, 2, 1}));
+}
+
+TEST_P(NNSPermuteDevices, AddRemovePoints) {
+    // Set up nns with half of the points, then add the others.
+    core::Device device = GetParam();
+    std::vector<double> points{0.0, 0.0, 0.0, 0.0, 0.0, 0.1, 0.0, 0.0,
+                               0.2, 0.0, 0.1, 0.0, 0.0, 0.1, 0.1, 0.0,
+                               0.1, 0.2, 0.0, 0.2, 0.0, 0.0, 0.2, 0.1,
+                               0.0, 0.2, 0.2, 0.1, 0.0, 0.0};
+    core::Tensor ref(points, {10, 3}, core::Dtype::Float64, device);
+    core::nns::NearestNeighborSearch nns(ref.Slice(0, 0, 5));
+    core::Tensor query(std::vector<double>({0.064705, 0.043921, 0.087843}),
+                       {1, 3}, core::Dtype::Float64, device);
+
+    // Index is not set.
+    EXPECT_THROW(nns.AddPoints(ref.Slice(0, 5, 10)), std::runtime_error);
+
+    nns.FixedRadiusIndex(0.1);
+    nns.FixedRadiusSearch(query, 0.1);
+    EXPECT_TRUE(nns.AddPoints(ref.Slice(0, 5, 10)));
+    std::tuple<core::Tensor, core::Tensor, core::Tensor> result =
+            nns.FixedRadiusSearch(query, 0.1);
+    ExpectEQ(std::get<0>(result).ToFlatVector<int64_t>(),
+             std::vector<int64_t>({1, 4}));
+
+    // Removed points are not found, the others keep their indices.
+    EXPECT_TRUE(nns.RemovePoints(
+            core::Tensor(std::vector<int64_t>({1, 7}), {2}, core::Dtype::Int64,
+                         device)));
+    result = nns.FixedRadiusSearch(query, 0.1);
+    ExpectEQ(std::get<0>(result).ToFlatVector<int64_t>(),
+             std::vector<int64_t>({4}));
+    ExpectEQ(std::get<1>(result).ToFlatVector<double>(),
+             std::vector<double>({0.00747938}));
+
+    // Out of range.
+    EXPECT_THROW(nns.RemovePoints(core::Tensor(std::vector<int64_t>({10}), {1},
+                                               core::Dtype::Int64, device)),
+                 std::runtime_error);
+}
+
 TEST(NearestNeighborSearch, MultiRadiusSearch) {
     // Set up nns.
     int size = 10;
@@ -194,6 +285,17 @@ TEST_P(NNSPermuteDevices, HybridSearch) {
     ExpectEQ(indices.ToFlatVector<int64_t>(), std::vector<int64_t>({1}));
     ExpectEQ(distainces.ToFlatVector<float>(),
              std::vector<float>({0.00626358}));
+
+    // On CPU, a radius builds a spatial hash table for the hybrid search.
+    if (device.GetType() == core::Device::DeviceType::CPU) {
+        nns.HybridIndex(0.1);
+        result = nns.HybridSearch(query, 0.01, 2);
+        ExpectEQ(result.first.ToFlatVector<int64_t>(),
+                 std::vector<int64_t>({1, 4}));
+        ExpectEQ(result.second.ToFlatVector<float>(),
+                 std::vector<float>({0.00626358, 0.00747938}));
+        EXPECT_THROW(nns.HybridSearch(query, 0.1, 1), std::runtime_error);
+    }
 }
 
 }  // namespace tests
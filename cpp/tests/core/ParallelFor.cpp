@@ -0,0 +1,111 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/core/ParallelFor.h"
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(ParallelFor, FillWithAccessor) {
+    core::Device device("CPU:0");
+    for (int64_t n : {0, 1, 17, 12345}) {
+        core::Tensor points({n, 3}, core::Dtype::Float32, device);
+        core::TensorAccessor<float, 2> accessor(points);
+        core::ParallelFor(device, n, [=](int64_t workload_idx) {
+            for (int64_t c = 0; c < 3; ++c) {
+                accessor(workload_idx, c) =
+                        static_cast<float>(workload_idx * 3 + c);
+            }
+        });
+        core::Tensor expected =
+                core::Tensor::Arange(0, n * 3, 1, core::Dtype::Float32, device)
+                        .Reshape({n, 3});
+        EXPECT_TRUE(points.AllClose(expected));
+    }
+}
+
+TEST(ParallelFor, StridedAccessor) {
+    core::Device device("CPU:0");
+    core::Tensor points =
+            core::Tensor::Arange(0, 12, 1, core::Dtype::Int64, device)
+                    .Reshape({4, 3});
+    // The column has stride 3 and is not contiguous.
+    core::Tensor column = points.Slice(1, 1, 2).Reshape({4});
+    core::TensorAccessor<const int64_t, 1> accessor(column);
+    EXPECT_EQ(accessor.GetShape(0), 4);
+    EXPECT_EQ(accessor(0), 1);
+    EXPECT_EQ(accessor(3), 10);
+
+    EXPECT_ANY_THROW((core::TensorAccessor<float, 1>(column)));
+    EXPECT_ANY_THROW((core::TensorAccessor<int64_t, 2>(column)));
+}
+
+TEST(ParallelFor, ParallelReduce) {
+    core::Device device("CPU:0");
+    for (int64_t n : {0, 1, 17, 100000}) {
+        core::Tensor values =
+                core::Tensor::Arange(0, n, 1, core::Dtype::Int64, device);
+        core::TensorAccessor<const int64_t, 1> accessor(values);
+
+        int64_t sum = core::ParallelReduce(
+                device, n, int64_t(0),
+                [=](int64_t workload_idx) { return accessor(workload_idx); },
+                [](int64_t a, int64_t b) { return a + b; });
+        EXPECT_EQ(sum, n * (n - 1) / 2);
+
+        // 7919 is prime, so the map permutes [0, n) and the maximum is not at
+        // the end of a range.
+        int64_t max = core::ParallelReduce(
+                device, n, std::numeric_limits<int64_t>::lowest(),
+                [=](int64_t workload_idx) {
+                    return accessor(workload_idx) * 7919 % n;
+                },
+                [](int64_t a, int64_t b) { return a > b ? a : b; });
+        EXPECT_EQ(max, n == 0 ? std::numeric_limits<int64_t>::lowest() : n - 1);
+
+        // bool results of neighbouring ranges must not share storage.
+        for (int64_t target : {int64_t(0), n / 2, n - 1}) {
+            bool found = core::ParallelReduce(
+                    device, n, false,
+                    [=](int64_t workload_idx) {
+                        return accessor(workload_idx) == target;
+                    },
+                    [](bool a, bool b) { return a || b; });
+            EXPECT_EQ(found, n > 0);
+        }
+    }
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -0,0 +1,70 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/kernel/ParallelUtil.h"
+
+#include <atomic>
+#include <vector>
+
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(ParallelUtil, ParallelForSchedules) {
+    using core::kernel::ParallelSchedule;
+    std::vector<ParallelSchedule> schedules{
+            ParallelSchedule::Static(),       ParallelSchedule::Dynamic(),
+            ParallelSchedule::Dynamic(7),     ParallelSchedule::Guided(3),
+            ParallelSchedule::WorkStealing(), ParallelSchedule::WorkStealing(5),
+            ParallelSchedule::WorkStealing(1000)};
+
+    for (int64_t n : {0, 1, 17, 1000, 12345}) {
+        for (const ParallelSchedule& schedule : schedules) {
+            std::vector<int> visits(n, 0);
+            std::atomic<int64_t> sum(0);
+            core::kernel::ParallelFor(
+                    n,
+                    [&](int64_t workload_idx) {
+                        visits[workload_idx]++;
+                        sum += workload_idx;
+                    },
+                    schedule);
+            EXPECT_EQ(visits, std::vector<int>(n, 1));
+            EXPECT_EQ(sum.load(), n * (n - 1) / 2);
+        }
+    }
+}
+
+TEST(ParallelUtil, GrainSize) {
+    using core::kernel::ParallelSchedule;
+    EXPECT_EQ(ParallelSchedule::Dynamic(10).GetGrainSize(1000), 10);
+    EXPECT_GE(ParallelSchedule::Dynamic().GetGrainSize(0), 1);
+    EXPECT_GE(ParallelSchedule::WorkStealing().GetGrainSize(1000000), 1);
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -0,0 +1,149 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/core/SegmentedReduce.h"
+
+#include <vector>
+
+#include "tests/UnitTest.h"
+#include "tests/core/CoreTest.h"
+
+namespace open3d {
+namespace tests {
+
+class SegmentedReducePermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(SegmentedReduce,
+                         SegmentedReducePermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(SegmentedReducePermuteDevices, Ops) {
+    core::Device device = GetParam();
+
+    core::Tensor keys = core::Tensor::Init<int64_t>({7, 2, 7, 2, 5}, device);
+    core::Tensor values = core::Tensor::Init<float>(
+            {{1, -1}, {2, -2}, {3, -3}, {4, -4}, {5, -5}}, device);
+
+    core::Tensor unique_keys, reduced;
+    std::tie(unique_keys, reduced) = core::SegmentedReduce(
+            keys, values, core::kernel::ReductionOpCode::Sum);
+    EXPECT_EQ(unique_keys.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({2, 5, 7}));
+    EXPECT_EQ(reduced.GetShape(), core::SizeVector({3, 2}));
+    EXPECT_EQ(reduced.ToFlatVector<float>(),
+              std::vector<float>({6, -6, 5, -5, 4, -4}));
+
+    std::tie(unique_keys, reduced) = core::SegmentedReduce(
+            keys, values, core::kernel::ReductionOpCode::Prod);
+    EXPECT_EQ(reduced.ToFlatVector<float>(),
+              std::vector<float>({8, 8, 5, -5, 3, 3}));
+
+    std::tie(unique_keys, reduced) = core::SegmentedReduce(
+            keys, values, core::kernel::ReductionOpCode::Min);
+    EXPECT_EQ(reduced.ToFlatVector<float>(),
+              std::vector<float>({2, -4, 5, -5, 1, -3}));
+
+    std::tie(unique_keys, reduced) = core::SegmentedReduce(
+            keys, values, core::kernel::ReductionOpCode::Max);
+    EXPECT_EQ(reduced.ToFlatVector<float>(),
+              std::vector<float>({4, -2, 5, -5, 3, -1}));
+
+    // 1-D values reduce to 1-D.
+    std::tie(unique_keys, reduced) = core::SegmentedReduce(
+            keys, core::Tensor::Ones({5}, core::Dtype::Int32, device),
+            core::kernel::ReductionOpCode::Sum);
+    EXPECT_EQ(reduced.ToFlatVector<int32_t>(), std::vector<int32_t>({2, 1, 2}));
+
+    // Arg-reductions and mismatching lengths are not supported.
+    EXPECT_ANY_THROW(core::SegmentedReduce(
+            keys, values, core::kernel::ReductionOpCode::ArgMax));
+    EXPECT_ANY_THROW(core::SegmentedReduce(keys, values.Slice(0, 0, 4),
+                                           core::kernel::ReductionOpCode::Sum));
+}
+
+TEST_P(SegmentedReducePermuteDevices, ScatterReduce) {
+    core::Device device = GetParam();
+
+    core::Tensor index = core::Tensor::Init<int64_t>({2, 0, 2, 0, 3}, device);
+    core::Tensor values = core::Tensor::Init<float>(
+            {{1, -1}, {2, -2}, {3, -3}, {4, -4}, {5, -5}}, device);
+
+    // Accumulates into the existing rows, row 1 is not indexed.
+    core::Tensor dst = core::Tensor::Init<float>(
+            {{10, 10}, {20, 20}, {30, 30}, {40, 40}}, device);
+    core::ScatterReduce_(dst, index, values,
+                         core::kernel::ReductionOpCode::Sum);
+    EXPECT_EQ(dst.ToFlatVector<float>(),
+              std::vector<float>({16, 4, 20, 20, 34, 26, 45, 35}));
+
+    dst = core::Tensor::Full({4, 2}, 2.f, core::Dtype::Float32, device);
+    core::ScatterReduce_(dst, index, values,
+                         core::kernel::ReductionOpCode::Min);
+    EXPECT_EQ(dst.ToFlatVector<float>(),
+              std::vector<float>({2, -4, 2, 2, 1, -3, 2, -5}));
+
+    dst = core::Tensor::Full({4, 2}, 2.f, core::Dtype::Float32, device);
+    core::ScatterReduce_(dst, index, values,
+                         core::kernel::ReductionOpCode::Max);
+    EXPECT_EQ(dst.ToFlatVector<float>(),
+              std::vector<float>({4, 2, 2, 2, 3, 2, 5, 2}));
+
+    // Non-contiguous destination and Int32 indices.
+    core::Tensor counts =
+            core::Tensor::Zeros({4, 2}, core::Dtype::Int64, device);
+    core::Tensor counts_column = counts.Slice(1, 1, 2);
+    core::ScatterReduce_(counts_column, index.To(core::Dtype::Int32),
+                         core::Tensor::Ones({5, 1}, core::Dtype::Int64, device),
+                         core::kernel::ReductionOpCode::Sum);
+    EXPECT_EQ(counts.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({0, 2, 0, 0, 0, 2, 0, 1}));
+
+    // Out of range indices and mismatching shapes are rejected.
+    EXPECT_ANY_THROW(core::ScatterReduce_(
+            dst, core::Tensor::Init<int64_t>({0, 1, 2, 3, 4}, device), values,
+            core::kernel::ReductionOpCode::Sum));
+    EXPECT_ANY_THROW(core::ScatterReduce_(dst, index, values.Slice(0, 0, 4),
+                                          core::kernel::ReductionOpCode::Sum));
+}
+
+TEST_P(SegmentedReducePermuteDevices, ScatterMean) {
+    core::Device device = GetParam();
+
+    core::Tensor index = core::Tensor::Init<int64_t>({2, 0, 2, 0, 3}, device);
+    core::Tensor values = core::Tensor::Init<double>(
+            {{1, -1}, {2, -2}, {3, -3}, {4, -4}, {5, -5}}, device);
+
+    core::Tensor mean, counts;
+    std::tie(mean, counts) = core::ScatterMean(index, values, 5);
+    EXPECT_EQ(mean.GetShape(), core::SizeVector({5, 2}));
+    EXPECT_EQ(mean.ToFlatVector<double>(),
+              std::vector<double>({3, -3, 0, 0, 2, -2, 5, -5, 0, 0}));
+    EXPECT_EQ(counts.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({2, 0, 2, 1, 0}));
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -30,6 +30,7 @@
 #include <limits>
 
 #include "open3d/core/AdvancedIndexing.h"
+#include "open3d/core/CUDAUtils.h"
 #include "open3d/core/Dtype.h"
 #include "open3d/core/MemoryManager.h"
 #include "open3d/core/SizeVector.h"
@@ -147,6 +148,24 @@ TEST_P(TensorPermuteDevices, WithInitList) {
     EXPECT_EQ(t.ToFlatVector<uint8_t>(),
               std::vector<uint8_t>({0, 0, 0, 0, 255, 255, 255, 255}));
 
+    // Test int16 datatype.
+    t = core::Tensor::Init<int16_t>({{-32768, -1}, {1, 32767}}, device);
+    EXPECT_EQ(t.GetShape(), core::SizeVector({2, 2}));
+    EXPECT_EQ(t.GetDtype(), core::Dtype::Int16);
+    EXPECT_EQ(t.ToFlatVector<int16_t>(),
+              std::vector<int16_t>({-32768, -1, 1, 32767}));
+    EXPECT_EQ(t.To(core::Dtype::Float32).ToFlatVector<float>(),
+              std::vector<float>({-32768, -1, 1, 32767}));
+
+    // Test int8 datatype.
+    t = core::Tensor::Init<int8_t>({{-128, -1}, {1, 127}}, device);
+    EXPECT_EQ(t.GetShape(), core::SizeVector({2, 2}));
+    EXPECT_EQ(t.GetDtype(), core::Dtype::Int8);
+    EXPECT_EQ(t.ToFlatVector<int8_t>(),
+              std::vector<int8_t>({-128, -1, 1, 127}));
+    EXPECT_EQ(t.To(core::Dtype::Float32).ToFlatVector<float>(),
+              std::vector<float>({-128, -1, 1, 127}));
+
     // Check tensor element size mismatch.
     EXPECT_THROW(core::Tensor::Init<int>({{1, 2, 3}, {4, 5}}, device),
                  std::runtime_error);
@@ -320,6 +339,52 @@ TEST_P(TensorPermuteDevicePairs, Copy) {
     EXPECT_EQ(dst_t.ToFlatVector<float>(), vals);
 }
 
+TEST_P(TensorPermuteDevicePairs, CopyAsync) {
+    core::Device dst_device;
+    core::Device src_device;
+    std::tie(dst_device, src_device) = GetParam();
+
+    core::Dtype dtype(core::Dtype::Float32);
+    core::SizeVector shape{2, 3};
+
+    std::vector<float> vals{0, 1, 2, 3, 4, 5};
+    core::Tensor src_t(vals, shape, dtype, src_device);
+
+    core::Tensor dst_t = src_t.CopyAsync(dst_device);
+    core::cuda::Synchronize();
+
+    EXPECT_EQ(dst_t.GetShape(), src_t.GetShape());
+    EXPECT_EQ(dst_t.GetDevice(), dst_device);
+    EXPECT_EQ(dst_t.GetDtype(), src_t.GetDtype());
+    EXPECT_EQ(dst_t.ToFlatVector<float>(), vals);
+
+    // Non-contiguous.
+    core::Tensor src_t_slice = src_t.Slice(1, 0, 3, 2);
+    dst_t = src_t_slice.CopyAsync(dst_device);
+    core::cuda::Synchronize();
+    EXPECT_EQ(dst_t.ToFlatVector<float>(), std::vector<float>({0, 2, 3, 5}));
+}
+
+TEST_P(TensorPermuteDevices, EmptyPinned) {
+    core::Device device = GetParam();
+
+    std::vector<float> vals{0, 1, 2, 3, 4, 5};
+    core::Tensor src_t(vals, {2, 3}, core::Dtype::Float32, device);
+
+    core::Tensor pinned_t =
+            core::Tensor::EmptyPinned({2, 3}, core::Dtype::Float32);
+    EXPECT_EQ(pinned_t.GetDevice(), core::Device("CPU:0"));
+    EXPECT_EQ(pinned_t.GetShape(), core::SizeVector({2, 3}));
+    EXPECT_TRUE(pinned_t.IsContiguous());
+
+    pinned_t.CopyFrom(src_t);
+    EXPECT_EQ(pinned_t.ToFlatVector<float>(), vals);
+
+    core::Tensor dst_t = pinned_t.CopyAsync(device);
+    core::cuda::Synchronize();
+    EXPECT_EQ(dst_t.ToFlatVector<float>(), vals);
+}
+
 TEST_P(TensorPermuteDevicePairs, CopyBool) {
     core::Device dst_device;
     core::Device src_device;
@@ -1186,6 +1251,45 @@ TEST_P(TensorPermuteDevices, T) {
     EXPECT_THROW(t_3d.T(), std::runtime_error);
 }
 
+TEST_P(TensorPermuteDevices, ChannelLayout) {
+    core::Device device = GetParam();
+
+    // {N, C} array-of-structures to {C, N} structure-of-arrays.
+    core::Tensor aos = core::Tensor::Init<float>(
+            {{0, 1, 2}, {3, 4, 5}, {6, 7, 8}, {9, 10, 11}}, device);
+    core::Tensor soa = aos.ToChannelFirst();
+    EXPECT_TRUE(soa.IsContiguous());
+    EXPECT_EQ(soa.GetShape(), core::SizeVector({3, 4}));
+    EXPECT_EQ(soa.ToFlatVector<float>(),
+              std::vector<float>({0, 3, 6, 9, 1, 4, 7, 10, 2, 5, 8, 11}));
+    EXPECT_TRUE(soa.ToChannelLast().AllClose(aos));
+
+    // {H, W, C} to {C, H, W} and back.
+    core::Tensor hwc =
+            core::Tensor::Arange(0, 24, 1, core::Dtype::Int32, device)
+                    .Reshape({2, 4, 3});
+    core::Tensor chw = hwc.ToChannelFirst();
+    EXPECT_EQ(chw.GetShape(), core::SizeVector({3, 2, 4}));
+    EXPECT_EQ(chw[1][0][2].Item<int32_t>(), hwc[0][2][1].Item<int32_t>());
+    EXPECT_TRUE(chw.ToChannelLast().AllClose(hwc));
+
+    // A matching destination is reused, others are reassigned.
+    core::Tensor dst =
+            core::Tensor::Empty({3, 4}, core::Dtype::Float32, device);
+    const void* dst_ptr = dst.GetDataPtr();
+    aos.ToChannelFirst(dst);
+    EXPECT_EQ(dst.GetDataPtr(), dst_ptr);
+    EXPECT_TRUE(dst.AllClose(soa));
+    core::Tensor wrong_shape =
+            core::Tensor::Empty({4, 3}, core::Dtype::Float32, device);
+    aos.ToChannelFirst(wrong_shape);
+    EXPECT_EQ(wrong_shape.GetShape(), core::SizeVector({3, 4}));
+    EXPECT_TRUE(wrong_shape.AllClose(soa));
+
+    EXPECT_ANY_THROW(core::Tensor::Ones({3}, core::Dtype::Float32, device)
+                             .ToChannelFirst());
+}
+
 TEST_P(TensorPermuteDevices, Det) {
     core::Device device = GetParam();
 
@@ -2388,6 +2492,146 @@ TEST_P(TensorPermuteDevices, BooleanIndex) {
     EXPECT_EQ(y.GetDtype(), core::Dtype::Float32);
 }
 
+TEST_P(TensorPermuteDevices, MaskedSelect) {
+    core::Device device = GetParam();
+
+    // 1-D mask over the rows of a {4, 3} tensor.
+    core::Tensor x = core::Tensor::Init<int64_t>(
+            {{0, 1, 2}, {3, 4, 5}, {6, 7, 8}, {9, 10, 11}}, device);
+    core::Tensor mask =
+            core::Tensor::Init<bool>({true, false, false, true}, device);
+    core::Tensor y = x.MaskedSelect(mask);
+    EXPECT_EQ(y.GetShape(), core::SizeVector({2, 3}));
+    EXPECT_EQ(y.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({0, 1, 2, 9, 10, 11}));
+
+    // IndexGet with a single boolean tensor gives the same result.
+    EXPECT_EQ(x.IndexGet({mask}).ToFlatVector<int64_t>(),
+              y.ToFlatVector<int64_t>());
+
+    // Mask with the full shape, on a non-contiguous tensor.
+    core::Tensor xt = x.T();
+    core::Tensor y_full = xt.MaskedSelect(xt.Gt(7));
+    EXPECT_EQ(y_full.GetShape(), core::SizeVector({4}));
+    EXPECT_EQ(y_full.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({9, 10, 8, 11}));
+
+    // Odd row sizes take the byte copy path.
+    core::Tensor c = core::Tensor::Init<uint8_t>(
+            {{1, 2, 3}, {4, 5, 6}, {7, 8, 9}}, device);
+    EXPECT_EQ(c.MaskedSelect(core::Tensor::Init<bool>({false, true, true},
+                                                      device))
+                      .ToFlatVector<uint8_t>(),
+              std::vector<uint8_t>({4, 5, 6, 7, 8, 9}));
+
+    // Large input, spanning several CPU blocks.
+    core::Tensor large = core::Tensor::Arange(0, 100000, 1, core::Dtype::Int64,
+                                              device);
+    core::Tensor large_y = large.MaskedSelect(large.Lt(50000));
+    EXPECT_EQ(large_y.GetShape(), core::SizeVector({50000}));
+    EXPECT_EQ(large_y[49999].Item<int64_t>(), 49999);
+
+    // Nothing selected.
+    EXPECT_EQ(x.MaskedSelect(core::Tensor::Zeros({4}, core::Dtype::Bool,
+                                                 device))
+                      .GetShape(),
+              core::SizeVector({0, 3}));
+
+    // Mismatching mask shape and dtype.
+    EXPECT_ANY_THROW(x.MaskedSelect(core::Tensor::Init<bool>({true}, device)));
+    EXPECT_ANY_THROW(x.MaskedSelect(
+            core::Tensor::Init<int64_t>({1, 0, 0, 1}, device)));
+}
+
+TEST_P(TensorPermuteDevices, SortArgSort) {
+    core::Device device = GetParam();
+
+    core::Tensor a =
+            core::Tensor::Init<float>({3.5, -1, 0, 2, -1, -7.25}, device);
+    EXPECT_EQ(a.Sort().ToFlatVector<float>(),
+              std::vector<float>({-7.25, -1, -1, 0, 2, 3.5}));
+    // Stable: the two -1 keep their input order.
+    EXPECT_EQ(a.ArgSort().ToFlatVector<int64_t>(),
+              std::vector<int64_t>({5, 1, 4, 2, 3, 0}));
+
+    core::Tensor b = core::Tensor::Init<int32_t>({5, -3, 7, 0}, device);
+    EXPECT_EQ(b.Sort().ToFlatVector<int32_t>(),
+              std::vector<int32_t>({-3, 0, 5, 7}));
+
+    // Large reversed input, spanning several CPU blocks and radix passes.
+    core::Tensor large = core::Tensor::Arange(100000, 0, -1,
+                                              core::Dtype::Int64, device);
+    core::Tensor large_sorted = large.Sort();
+    EXPECT_EQ(large_sorted[0].Item<int64_t>(), 1);
+    EXPECT_EQ(large_sorted[99999].Item<int64_t>(), 100000);
+    EXPECT_EQ(large.ArgSort()[0].Item<int64_t>(), 99999);
+
+    // Only 1-D tensors can be sorted.
+    EXPECT_ANY_THROW(core::Tensor::Ones({2, 2}, core::Dtype::Float32, device)
+                             .Sort());
+}
+
+TEST_P(TensorPermuteDevices, Unique) {
+    core::Device device = GetParam();
+
+    core::Tensor a = core::Tensor::Init<int64_t>({4, 1, 4, 4, 9, 1}, device);
+    core::Tensor unique, inverse, counts;
+    std::tie(unique, inverse, counts) = a.Unique(true, true);
+    EXPECT_EQ(unique.ToFlatVector<int64_t>(), std::vector<int64_t>({1, 4, 9}));
+    EXPECT_EQ(inverse.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({1, 0, 1, 1, 2, 0}));
+    EXPECT_EQ(counts.ToFlatVector<int64_t>(), std::vector<int64_t>({2, 3, 1}));
+    EXPECT_TRUE(unique.IndexGet({inverse}).AllClose(a));
+
+    // Outputs that are not requested are empty.
+    std::tie(unique, inverse, counts) = a.Unique();
+    EXPECT_EQ(unique.ToFlatVector<int64_t>(), std::vector<int64_t>({1, 4, 9}));
+    EXPECT_EQ(inverse.NumElements(), 0);
+    EXPECT_EQ(counts.NumElements(), 0);
+
+    // Empty input.
+    std::tie(unique, inverse, counts) =
+            core::Tensor({0}, core::Dtype::Int32, device).Unique(true, true);
+    EXPECT_EQ(unique.GetShape(), core::SizeVector({0}));
+    EXPECT_EQ(inverse.GetShape(), core::SizeVector({0}));
+    EXPECT_EQ(counts.GetShape(), core::SizeVector({0}));
+}
+
+TEST_P(TensorPermuteDevices, IndexAdd_) {
+    core::Device device = GetParam();
+
+    // Duplicate indices accumulate along dim 0.
+    core::Tensor a = core::Tensor::Ones({3, 2}, core::Dtype::Float32, device);
+    core::Tensor index = core::Tensor::Init<int64_t>({2, 0, 2}, device);
+    core::Tensor src =
+            core::Tensor::Init<float>({{1, 2}, {3, 4}, {5, 6}}, device);
+    a.IndexAdd_(0, index, src);
+    EXPECT_EQ(a.ToFlatVector<float>(), std::vector<float>({4, 5, 1, 1, 7, 9}));
+
+    // Along the last dim, into a non-contiguous tensor.
+    core::Tensor b = core::Tensor::Zeros({3, 2}, core::Dtype::Int32, device);
+    core::Tensor b_t = b.T();
+    b_t.IndexAdd_(-1, core::Tensor::Init<int64_t>({1, 1}, device),
+                  core::Tensor::Init<int32_t>({{1, 2}, {3, 4}}, device));
+    EXPECT_EQ(b.ToFlatVector<int32_t>(),
+              std::vector<int32_t>({0, 0, 3, 7, 0, 0}));
+
+    // Histogram of Int64 values.
+    core::Tensor histogram =
+            core::Tensor::Zeros({4}, core::Dtype::Int64, device);
+    core::Tensor values = core::Tensor::Init<int64_t>({3, 1, 3, 3, 0}, device);
+    histogram.IndexAdd_(0, values,
+                        core::Tensor::Ones({5}, core::Dtype::Int64, device));
+    EXPECT_EQ(histogram.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({1, 1, 0, 3}));
+
+    // Out of range indices and mismatching shapes are rejected.
+    EXPECT_ANY_THROW(a.IndexAdd_(
+            0, core::Tensor::Init<int64_t>({3}, device),
+            core::Tensor::Ones({1, 2}, core::Dtype::Float32, device)));
+    EXPECT_ANY_THROW(a.IndexAdd_(0, index, src.Slice(1, 0, 1)));
+}
+
 TEST_P(TensorPermuteDevices, NonZeroNumpy) {
     core::Device device = GetParam();
 
@@ -2657,6 +2901,167 @@ TEST_P(TensorPermuteDevices, ReduceMean) {
     EXPECT_TRUE(std::isnan(dst.ToFlatVector<float>()[0]));
 }
 
+TEST_P(TensorPermuteDevices, OutputOps) {
+    core::Device device = GetParam();
+    core::Tensor a = core::Tensor::Init<float>({{1, 2, 3}, {4, 5, 6}}, device);
+    core::Tensor b = core::Tensor::Init<float>({10, 20, 30}, device);
+
+    core::Tensor dst =
+            core::Tensor::Zeros({2, 3}, core::Dtype::Float32, device);
+    void* dst_ptr = dst.GetDataPtr();
+    a.Add(b, dst);
+    EXPECT_EQ(dst.ToFlatVector<float>(),
+              std::vector<float>({11, 22, 33, 14, 25, 36}));
+    a.Sub(b, dst);
+    EXPECT_EQ(dst.ToFlatVector<float>(), (a - b).ToFlatVector<float>());
+    a.Mul(b, dst);
+    EXPECT_EQ(dst.ToFlatVector<float>(), (a * b).ToFlatVector<float>());
+    a.Div(b, dst);
+    EXPECT_EQ(dst.ToFlatVector<float>(), (a / b).ToFlatVector<float>());
+    a.Sqrt(dst);
+    EXPECT_EQ(dst.ToFlatVector<float>(), a.Sqrt().ToFlatVector<float>());
+    a.Neg(dst);
+    EXPECT_EQ(dst.ToFlatVector<float>(), a.Neg().ToFlatVector<float>());
+    EXPECT_EQ(dst.GetDataPtr(), dst_ptr);
+
+    // Writing to an operand.
+    a.Mul(a, a);
+    EXPECT_EQ(a.ToFlatVector<float>(),
+              std::vector<float>({1, 4, 9, 16, 25, 36}));
+
+    // Writing to a non-contiguous view.
+    core::Tensor dst_T =
+            core::Tensor::Zeros({3, 2}, core::Dtype::Float32, device).T();
+    a.Abs(dst_T);
+    EXPECT_EQ(dst_T.ToFlatVector<float>(), a.ToFlatVector<float>());
+
+    // Reductions.
+    core::Tensor dst_sum =
+            core::Tensor::Zeros({3}, core::Dtype::Float32, device);
+    a.Sum({0}, false, dst_sum);
+    EXPECT_EQ(dst_sum.ToFlatVector<float>(), std::vector<float>({17, 29, 45}));
+    a.Mean({0}, false, dst_sum);
+    EXPECT_EQ(dst_sum.ToFlatVector<float>(),
+              std::vector<float>({8.5, 14.5, 22.5}));
+    core::Tensor dst_keepdim =
+            core::Tensor::Zeros({2, 1}, core::Dtype::Float32, device);
+    a.Max({1}, true, dst_keepdim);
+    EXPECT_EQ(dst_keepdim.ToFlatVector<float>(), std::vector<float>({9, 36}));
+    a.Min({1}, true, dst_keepdim);
+    EXPECT_EQ(dst_keepdim.ToFlatVector<float>(), std::vector<float>({1, 16}));
+    a.Prod({1}, true, dst_keepdim);
+    EXPECT_EQ(dst_keepdim.ToFlatVector<float>(),
+              std::vector<float>({36, 14400}));
+
+    // The output must have the shape, dtype and device of the result.
+    EXPECT_THROW(a.Add(b, dst_sum), std::runtime_error);
+    EXPECT_THROW(a.Sum({0}, true, dst_sum), std::runtime_error);
+    core::Tensor dst_int =
+            core::Tensor::Zeros({2, 3}, core::Dtype::Int32, device);
+    EXPECT_THROW(a.Add(b, dst_int), std::runtime_error);
+    EXPECT_THROW(a.Sqrt(dst_int), std::runtime_error);
+}
+
+TEST_P(TensorPermuteDevices, ReduceMinMax) {
+    core::Device device = GetParam();
+    core::Tensor src = core::Tensor::Init<float>({{{22.f, 23.f, 20.f, 9.f},
+                                                   {6.f, 14.f, 18.f, 13.f},
+                                                   {15.f, 3.f, 17.f, 0.f}},
+                                                  {{7.f, 21.f, 11.f, 1.f},
+                                                   {4.f, 2.f, 10.f, 19.f},
+                                                   {5.f, 8.f, 16.f, 12.f}}},
+                                                 device);
+    core::Tensor dst_min, dst_max;
+
+    for (const core::SizeVector& dims :
+         std::vector<core::SizeVector>{{},
+                                       {0},
+                                       {1},
+                                       {2},
+                                       {0, 1},
+                                       {0, 2},
+                                       {1, 2},
+                                       {2, 0},
+                                       {0, 1, 2}}) {
+        for (bool keepdim : {false, true}) {
+            std::tie(dst_min, dst_max) = src.MinMax(dims, keepdim);
+            EXPECT_EQ(dst_min.GetShape(), src.Min(dims, keepdim).GetShape());
+            EXPECT_EQ(dst_min.ToFlatVector<float>(),
+                      src.Min(dims, keepdim).ToFlatVector<float>());
+            EXPECT_EQ(dst_max.ToFlatVector<float>(),
+                      src.Max(dims, keepdim).ToFlatVector<float>());
+        }
+    }
+
+    // Non-contiguous input and integer dtype.
+    core::Tensor src_int = src.To(core::Dtype::Int32).Slice(2, 1, 4, 2);
+    std::tie(dst_min, dst_max) = src_int.MinMax({0, 2});
+    EXPECT_EQ(dst_min.ToFlatVector<int>(), std::vector<int>({1, 2, 0}));
+    EXPECT_EQ(dst_max.ToFlatVector<int>(), std::vector<int>({23, 19, 12}));
+
+    // Large rows are reduced by several tasks.
+    core::Tensor large =
+            core::Tensor::Arange(0, 300000, 1, core::Dtype::Int64, device)
+                    .Reshape({100000, 3});
+    std::tie(dst_min, dst_max) = large.MinMax({0});
+    EXPECT_EQ(dst_min.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({0, 1, 2}));
+    EXPECT_EQ(dst_max.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({299997, 299998, 299999}));
+
+    // Zero-sized reduction.
+    src = core::Tensor::Ones({0, 3}, core::Dtype::Float32, device);
+    EXPECT_THROW(src.MinMax({0}), std::runtime_error);
+    std::tie(dst_min, dst_max) = src.MinMax({1});
+    EXPECT_EQ(dst_min.GetShape(), core::SizeVector({0}));
+}
+
+TEST_P(TensorPermuteDevices, ReduceMeanVar) {
+    core::Device device = GetParam();
+    core::Tensor src;
+    core::Tensor dst_mean, dst_var;
+
+    // Only Float32 and Float64 supports MeanVar.
+    src = core::Tensor::Ones({2, 3}, core::Dtype::Int64, device);
+    EXPECT_THROW(src.MeanVar({0}), std::runtime_error);
+
+    src = core::Tensor(std::vector<double>({0, 1, 2, 3, 4, 5}), {2, 3},
+                       core::Dtype::Float64, device);
+    std::tie(dst_mean, dst_var) = src.MeanVar({0});
+    EXPECT_EQ(dst_mean.GetShape(), core::SizeVector({3}));
+    EXPECT_EQ(dst_mean.ToFlatVector<double>(),
+              std::vector<double>({1.5, 2.5, 3.5}));
+    EXPECT_EQ(dst_var.ToFlatVector<double>(),
+              std::vector<double>({2.25, 2.25, 2.25}));
+    std::tie(dst_mean, dst_var) = src.MeanVar({1}, true);
+    EXPECT_EQ(dst_mean.GetShape(), core::SizeVector({2, 1}));
+    EXPECT_EQ(dst_mean.ToFlatVector<double>(), std::vector<double>({1, 4}));
+    EXPECT_TRUE(dst_var.AllClose(
+            core::Tensor::Full({2, 1}, 2. / 3., core::Dtype::Float64, device)));
+    std::tie(dst_mean, dst_var) = src.MeanVar({});
+    EXPECT_EQ(dst_mean.ToFlatVector<double>(), src.ToFlatVector<double>());
+    EXPECT_EQ(dst_var.ToFlatVector<double>(), std::vector<double>(6, 0));
+
+    // Large offset, where the naive E[x^2] - E[x]^2 loses all precision.
+    std::vector<float> vals(100000);
+    for (size_t i = 0; i < vals.size(); ++i) {
+        vals[i] = 1e4f + static_cast<float>(i % 2);
+    }
+    src = core::Tensor(vals, {100000, 1}, core::Dtype::Float32, device);
+    std::tie(dst_mean, dst_var) = src.MeanVar({0});
+    EXPECT_TRUE(dst_mean.AllClose(
+            core::Tensor::Full({1}, 1e4 + 0.5, core::Dtype::Float32, device)));
+    EXPECT_TRUE(dst_var.AllClose(
+            core::Tensor::Full({1}, 0.25, core::Dtype::Float32, device)));
+
+    // Input shape {0}.
+    src = core::Tensor::Ones({0}, core::Dtype::Float32, device);
+    std::tie(dst_mean, dst_var) = src.MeanVar({0});
+    EXPECT_EQ(dst_mean.GetShape(), core::SizeVector({}));
+    EXPECT_TRUE(std::isnan(dst_mean.ToFlatVector<float>()[0]));
+    EXPECT_TRUE(std::isnan(dst_var.ToFlatVector<float>()[0]));
+}
+
 TEST_P(TensorPermuteDevices, ToDLPackFromDLPack) {
     core::Device device = GetParam();
     core::Tensor src_t = core::Tensor::Init<float>(
@@ -2692,6 +3097,54 @@ TEST_P(TensorPermuteDevices, ToDLPackFromDLPack) {
               std::vector<float>({12, 14, 20, 22}));
 }
 
+TEST_P(TensorPermuteDevices, Float16) {
+    core::Device device = GetParam();
+
+    // Round trip through Float32, including values that need rounding.
+    core::Tensor src_t = core::Tensor::Init<float>(
+            {{0.5, -2, 65504}, {1.0009765625, 3.14159, 70000}}, device);
+    core::Tensor t = src_t.To(core::Dtype::Float16);
+    EXPECT_EQ(t.GetDtype(), core::Dtype::Float16);
+    EXPECT_EQ(t.GetShape(), core::SizeVector({2, 3}));
+    EXPECT_EQ(t.To(core::Dtype::Float32).ToFlatVector<float>(),
+              std::vector<float>({0.5, -2, 65504, 1.0009765625, 3.140625,
+                                  std::numeric_limits<float>::infinity()}));
+
+    // Element-wise ops compute in Float32 and round the result.
+    core::Tensor a = core::Tensor::Full({4}, 1.5, core::Dtype::Float16, device);
+    core::Tensor b =
+            core::Tensor::Init<float>({1, 2, 3, 4}, device)
+                    .To(core::Dtype::Float16);
+    EXPECT_EQ((a * b + a).To(core::Dtype::Float32).ToFlatVector<float>(),
+              std::vector<float>({3, 4.5, 6, 7.5}));
+    EXPECT_EQ((b > a).ToFlatVector<bool>(),
+              std::vector<bool>({false, true, true, true}));
+    EXPECT_EQ(b.Sqrt().To(core::Dtype::Float32).ToFlatVector<float>()[3], 2);
+    EXPECT_EQ(static_cast<float>(b.Max({0}).Item<core::Float16>()), 4);
+    EXPECT_EQ(b.ArgMin({0}).Item<int64_t>(), 0);
+
+    // Sum accumulates in Float32. A Float16 accumulator would get stuck at
+    // 2048, where adding 1 no longer changes the value.
+    core::Tensor ones = core::Tensor::Ones({10000}, core::Dtype::Float16,
+                                           device);
+    core::Tensor sum = ones.Sum({0});
+    EXPECT_EQ(sum.GetDtype(), core::Dtype::Float16);
+    EXPECT_EQ(static_cast<float>(sum.Item<core::Float16>()), 10000);
+
+    // Indexing.
+    core::Tensor idx = core::Tensor::Init<int64_t>({3, 0}, device);
+    EXPECT_EQ(b.IndexGet({idx}).To(core::Dtype::Float32).ToFlatVector<float>(),
+              std::vector<float>({4, 1}));
+
+    // DLPack.
+    core::Tensor dst_t = core::Tensor::FromDLPack(t.ToDLPack());
+    EXPECT_EQ(dst_t.GetDtype(), core::Dtype::Float16);
+    EXPECT_EQ(dst_t.GetDataPtr(), t.GetDataPtr());
+    core::Tensor i8 = core::Tensor::Init<int8_t>({-3, 7}, device);
+    EXPECT_EQ(core::Tensor::FromDLPack(i8.ToDLPack()).GetDtype(),
+              core::Dtype::Int8);
+}
+
 TEST_P(TensorPermuteDevices, IsSame) {
     core::Device device = GetParam();
 
@@ -0,0 +1,116 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/core/TensorRingBuffer.h"
+
+#include <vector>
+
+#include "tests/UnitTest.h"
+#include "tests/core/CoreTest.h"
+
+namespace open3d {
+namespace tests {
+
+class TensorRingBufferPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(TensorRingBuffer,
+                         TensorRingBufferPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(TensorRingBufferPermuteDevices, PushBackPopFront) {
+    core::Device device = GetParam();
+    core::Dtype dtype = core::Dtype::Float32;
+
+    core::TensorRingBuffer rb(3, {2}, dtype, device);
+    EXPECT_EQ(rb.GetSize(), 0);
+    EXPECT_EQ(rb.GetCapacity(), 3);
+    EXPECT_EQ(rb.GetInternalTensor().GetShape(), core::SizeVector({3, 2}));
+    const void* storage_ptr = rb.GetInternalTensor().GetDataPtr();
+
+    rb.PushBack(core::Tensor::Init<float>({0, 0}, device));
+    rb.PushBack(core::Tensor::Init<float>({1, 1}, device));
+    rb.PushBack(core::Tensor::Init<float>({2, 2}, device));
+    EXPECT_TRUE(rb.IsFull());
+    EXPECT_ANY_THROW(rb.PushBack(core::Tensor::Init<float>({3, 3}, device)));
+
+    rb.PopFront();
+    rb.PushBack(core::Tensor::Init<float>({3, 3}, device));
+    EXPECT_EQ(rb[0].ToFlatVector<float>(), std::vector<float>({1, 1}));
+    EXPECT_EQ(rb[-1].ToFlatVector<float>(), std::vector<float>({3, 3}));
+    EXPECT_EQ(rb.AsTensor().ToFlatVector<float>(),
+              std::vector<float>({1, 1, 2, 2, 3, 3}));
+
+    // No reallocation.
+    EXPECT_EQ(rb.GetInternalTensor().GetDataPtr(), storage_ptr);
+
+    // Mismatching shape, dtype.
+    rb.PopFront(3);
+    EXPECT_ANY_THROW(rb.PushBack(core::Tensor::Init<float>({1}, device)));
+    EXPECT_ANY_THROW(rb.PushBack(core::Tensor::Init<double>({1, 1}, device)));
+    EXPECT_ANY_THROW(rb.PopFront());
+}
+
+TEST_P(TensorRingBufferPermuteDevices, ExtendGetRange) {
+    core::Device device = GetParam();
+
+    // Sliding window over frames of {N_i, 1} points.
+    core::TensorRingBuffer rb(5, {1}, core::Dtype::Int32, device);
+    rb.Extend(core::Tensor::Init<int32_t>({{0}, {1}, {2}}, device));
+    rb.Extend(core::Tensor::Init<int32_t>({{3}, {4}}, device));
+    EXPECT_ANY_THROW(rb.Extend(core::Tensor::Init<int32_t>({{5}}, device)));
+
+    // Drop the first frame, then add a frame that wraps around.
+    rb.PopFront(3);
+    rb.Extend(core::Tensor::Init<int32_t>({{5}, {6}, {7}}, device));
+    EXPECT_EQ(rb.GetSize(), 5);
+
+    std::vector<core::Tensor> slices = rb.GetRange(0, 5);
+    ASSERT_EQ(slices.size(), 2u);
+    EXPECT_EQ(slices[0].ToFlatVector<int32_t>(),
+              std::vector<int32_t>({3, 4}));
+    EXPECT_EQ(slices[1].ToFlatVector<int32_t>(),
+              std::vector<int32_t>({5, 6, 7}));
+    // Views share memory with the storage.
+    EXPECT_EQ(slices[1].GetDataPtr(), rb.GetInternalTensor().GetDataPtr());
+
+    slices = rb.GetRange(2, 4);
+    ASSERT_EQ(slices.size(), 1u);
+    EXPECT_EQ(slices[0].ToFlatVector<int32_t>(),
+              std::vector<int32_t>({5, 6}));
+    EXPECT_TRUE(rb.GetRange(1, 1).empty());
+    EXPECT_ANY_THROW(rb.GetRange(3, 6));
+
+    // A wrapped ring buffer is copied into one tensor.
+    EXPECT_EQ(rb.AsTensor().ToFlatVector<int32_t>(),
+              std::vector<int32_t>({3, 4, 5, 6, 7}));
+
+    rb.Clear();
+    EXPECT_EQ(rb.GetSize(), 0);
+    EXPECT_EQ(rb.AsTensor().GetShape(), core::SizeVector({0, 1}));
+}
+
+}  // namespace tests
+}  // namespace open3d
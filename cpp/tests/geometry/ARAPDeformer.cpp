@@ -0,0 +1,76 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/ARAPDeformer.h"
+
+#include "open3d/geometry/TriangleMesh.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(ARAPDeformer, Deform) {
+    auto mesh = geometry::TriangleMesh::CreateSphere(1.0, 10);
+    // Fix the vertices of the lower half and lift the north pole.
+    std::vector<int> constraint_ids;
+    std::vector<Eigen::Vector3d> constraint_pos;
+    for (int i = 0; i < int(mesh->vertices_.size()); ++i) {
+        if (mesh->vertices_[i](2) < 0) {
+            constraint_ids.push_back(i);
+            constraint_pos.push_back(mesh->vertices_[i]);
+        }
+    }
+    constraint_ids.push_back(0);
+    constraint_pos.push_back(Eigen::Vector3d(0, 0, 1.5));
+
+    geometry::ARAPDeformer deformer(*mesh);
+    auto deformed = deformer.Deform(constraint_ids, constraint_pos, 20);
+    auto reference =
+            mesh->DeformAsRigidAsPossible(constraint_ids, constraint_pos, 20);
+    ExpectEQ(deformed->vertices_, reference->vertices_, 1e-10);
+    ExpectEQ(deformed->vertices_, deformer.GetPositions());
+    EXPECT_EQ(deformed->triangles_, mesh->triangles_);
+    for (size_t idx = 0; idx < constraint_ids.size(); ++idx) {
+        ExpectEQ(deformed->vertices_[constraint_ids[idx]],
+                 constraint_pos[idx]);
+    }
+
+    // Moving the pole again reuses the factorization and starts from the
+    // previous positions.
+    constraint_pos.back() = Eigen::Vector3d(0, 0, 1.6);
+    auto moved = deformer.Deform(constraint_ids, constraint_pos, 20);
+    ExpectEQ(moved->vertices_[0], Eigen::Vector3d(0, 0, 1.6));
+    EXPECT_GT(moved->vertices_[2](2), deformed->vertices_[2](2));
+
+    // After a reset, the deformation starts again from the rest mesh.
+    deformer.Reset();
+    constraint_pos.back() = Eigen::Vector3d(0, 0, 1.5);
+    auto restarted = deformer.Deform(constraint_ids, constraint_pos, 20);
+    ExpectEQ(restarted->vertices_, reference->vertices_, 1e-10);
+}
+
+}  // namespace tests
+}  // namespace open3d
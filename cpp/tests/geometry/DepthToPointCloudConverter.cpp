@@ -0,0 +1,133 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/DepthToPointCloudConverter.h"
+
+#include <cmath>
+
+#include "open3d/geometry/Image.h"
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/geometry/RGBDImage.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(DepthToPointCloudConverter, ConvertDepthImage) {
+    // 5x3 image in millimeters, with one invalid and one truncated pixel.
+    geometry::Image depth;
+    depth.Prepare(5, 3, 1, 2);
+    for (int v = 0; v < 3; ++v) {
+        for (int u = 0; u < 5; ++u) {
+            *depth.PointerAt<uint16_t>(u, v) = uint16_t(1000 + 100 * v + u);
+        }
+    }
+    *depth.PointerAt<uint16_t>(1, 1) = 0;
+    *depth.PointerAt<uint16_t>(3, 2) = 5000;
+    camera::PinholeCameraIntrinsic intrinsic(5, 3, 2.0, 4.0, 2.0, 1.0);
+    Eigen::Matrix4d extrinsic = Eigen::Matrix4d::Identity();
+    extrinsic.block<3, 1>(0, 3) = Eigen::Vector3d(1, 2, 3);
+
+    geometry::DepthToPointCloudConverter converter(intrinsic);
+    geometry::PointCloud pcd;
+    converter.ConvertDepthImage(depth, pcd, extrinsic, 1000.0, 2.0);
+    std::vector<Eigen::Vector3d> expected;
+    for (int v = 0; v < 3; ++v) {
+        for (int u = 0; u < 5; ++u) {
+            double z = (1000 + 100 * v + u) / 1000.0;
+            if ((u == 1 && v == 1) || (u == 3 && v == 2)) {
+                continue;
+            }
+            expected.push_back(Eigen::Vector3d((u - 2.0) * z / 2.0,
+                                               (v - 1.0) * z / 4.0, z) -
+                               Eigen::Vector3d(1, 2, 3));
+        }
+    }
+    ExpectEQ(pcd.points_, expected, 1e-6);
+    EXPECT_FALSE(pcd.HasColors());
+
+    // The same as the factory function, also for float images.
+    auto reference = geometry::PointCloud::CreateFromDepthImage(
+            depth, intrinsic, extrinsic, 1000.0, 2.0);
+    ExpectEQ(pcd.points_, reference->points_);
+    auto float_pcd = converter.CreateFromDepthImage(
+            *depth.ConvertDepthToFloatImage(1000.0, 2.0), extrinsic);
+    ExpectEQ(float_pcd->points_, expected, 1e-6);
+
+    // The next frames reuse the buffers.
+    const Eigen::Vector3d *data = pcd.points_.data();
+    *depth.PointerAt<uint16_t>(1, 1) = 1100;
+    converter.ConvertDepthImage(depth, pcd, extrinsic, 1000.0, 2.0);
+    EXPECT_EQ(pcd.points_.size(), 14u);
+    EXPECT_EQ(pcd.points_.data(), data);
+
+    // Invalid pixels give NaN points when kept.
+    converter.ConvertDepthImage(depth, pcd, extrinsic, 1000.0, 2.0, false);
+    EXPECT_EQ(pcd.points_.size(), 15u);
+    EXPECT_TRUE(std::isnan(pcd.points_[13](0)));
+
+    // Sampling with a stride keeps the last row and column.
+    geometry::DepthToPointCloudConverter strided(intrinsic, 2);
+    strided.ConvertDepthImage(depth, pcd, extrinsic, 1000.0, 2.0, false);
+    EXPECT_EQ(pcd.points_.size(), 6u);
+    ExpectEQ(pcd.points_[5], Eigen::Vector3d(0.204, 1.204 / 4.0 - 2, -1.796),
+             1e-6);
+
+    geometry::Image small_depth;
+    small_depth.Prepare(4, 3, 1, 2);
+    EXPECT_ANY_THROW(converter.ConvertDepthImage(small_depth, pcd));
+}
+
+TEST(DepthToPointCloudConverter, ConvertRGBDImage) {
+    geometry::Image depth;
+    depth.Prepare(4, 2, 1, 4);
+    geometry::Image color;
+    color.Prepare(4, 2, 3, 1);
+    for (int v = 0; v < 2; ++v) {
+        for (int u = 0; u < 4; ++u) {
+            *depth.PointerAt<float>(u, v) = u == 2 ? 0.0f : 1.0f + u + v;
+            for (int ch = 0; ch < 3; ++ch) {
+                *color.PointerAt<uint8_t>(u, v, ch) = uint8_t(10 * u + ch);
+            }
+        }
+    }
+    geometry::RGBDImage rgbd(color, depth);
+    camera::PinholeCameraIntrinsic intrinsic(4, 2, 1.0, 1.0, 1.5, 0.5);
+
+    geometry::DepthToPointCloudConverter converter(intrinsic);
+    auto pcd = converter.CreateFromRGBDImage(rgbd);
+    auto reference =
+            geometry::PointCloud::CreateFromRGBDImage(rgbd, intrinsic);
+    EXPECT_EQ(pcd->points_.size(), 6u);
+    ExpectEQ(pcd->points_, reference->points_);
+    ExpectEQ(pcd->colors_, reference->colors_);
+    ExpectEQ(pcd->points_[0], Eigen::Vector3d(-1.5, -0.5, 1.0));
+    ExpectEQ(pcd->colors_[2],
+             Eigen::Vector3d(30.0 / 255.0, 31.0 / 255.0, 32.0 / 255.0));
+}
+
+}  // namespace tests
+}  // namespace open3d
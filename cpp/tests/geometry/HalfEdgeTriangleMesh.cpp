@@ -29,6 +29,7 @@
 #include <iostream>
 #include <string>
 
+#include "open3d/core/EigenConverter.h"
 #include "open3d/io/TriangleMeshIO.h"
 #include "open3d/utility/Helper.h"
 #include "tests/UnitTest.h"
@@ -293,6 +294,28 @@ TEST(HalfEdgeTriangleMesh, Constructor_Sphere) {
     EXPECT_FALSE(het_mesh->IsEmpty());
 }
 
+TEST(HalfEdgeTriangleMesh, HalfEdgeArrays_TwoTriangles) {
+    geometry::TriangleMesh mesh = get_mesh_two_triangles();
+    geometry::HalfEdgeArrays arrays =
+            geometry::HalfEdgeArrays::Create(mesh.triangles_);
+    // Half-edges: 0: 0->2, 1: 2->1, 2: 1->0, 3: 1->2, 4: 2->3, 5: 3->1.
+    EXPECT_EQ(arrays.twins_, std::vector<int>({-1, 3, -1, 1, -1, -1}));
+    EXPECT_EQ(arrays.edges_,
+              std::vector<Eigen::Vector2i>({{0, 1}, {0, 2}, {1, 2}, {1, 3},
+                                            {2, 3}}));
+    EXPECT_EQ(arrays.edge_indices_, std::vector<int>({1, 2, 0, 2, 4, 3}));
+    EXPECT_EQ(arrays.edge_offsets_, std::vector<int64_t>({0, 1, 2, 4, 5, 6}));
+    EXPECT_EQ(arrays.edge_half_edges_, std::vector<int>({2, 0, 1, 3, 5, 4}));
+    EXPECT_EQ(arrays.NumHalfEdgesOfEdge(2), 2);
+
+    core::Tensor triangles = core::eigen_converter::EigenVector3iVectorToTensor(
+            mesh.triangles_, core::Dtype::Int64, core::Device("CPU:0"));
+    geometry::HalfEdgeArrays arrays_t =
+            geometry::HalfEdgeArrays::Create(triangles);
+    EXPECT_EQ(arrays_t.twins_, arrays.twins_);
+    EXPECT_EQ(arrays_t.edge_half_edges_, arrays.edge_half_edges_);
+}
+
 TEST(HalfEdgeTriangleMesh, OrderedHalfEdgesFromVertex_TwoTriangles) {
     auto mesh = get_mesh_two_triangles();
     auto het_mesh =
@@ -920,6 +920,35 @@ TEST(Image, Downsample) {
     ExpectEQ(ref, output->data_);
 }
 
+TEST(Image, FilterAndDownsample) {
+    geometry::Image image;
+
+    // odd dimensions spanning several filter tiles
+    int width = 301;
+    int height = 67;
+    int num_of_channels = 1;
+    int bytes_per_channel = 4;
+
+    image.Prepare(width, height, num_of_channels, bytes_per_channel);
+
+    Rand(image.data_, 0, 255, 0);
+
+    auto float_image = image.CreateFloatImage();
+
+    for (auto filter : {FilterType::Gaussian3, FilterType::Gaussian5,
+                        FilterType::Gaussian7, FilterType::Sobel3Dx,
+                        FilterType::Sobel3Dy}) {
+        auto ref = float_image->Filter(filter)->Downsample();
+        auto output = float_image->FilterAndDownsample(filter);
+
+        EXPECT_EQ(ref->width_, output->width_);
+        EXPECT_EQ(ref->height_, output->height_);
+        EXPECT_EQ(num_of_channels, output->num_of_channels_);
+        EXPECT_EQ(bytes_per_channel, output->bytes_per_channel_);
+        ExpectEQ(ref->data_, output->data_);
+    }
+}
+
 TEST(Image, Dilate) {
     // reference data used to validate the filtering of an image
     std::vector<uint8_t> ref = {
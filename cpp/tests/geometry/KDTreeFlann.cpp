@@ -144,5 +144,116 @@ TEST(KDTreeFlann, SearchHybrid) {
     ExpectEQ(ref_distance2, distance2);
 }
 
+TEST(KDTreeFlann, SearchBatch) {
+    int size = 100;
+
+    geometry::PointCloud pc;
+
+    Eigen::Vector3d vmin(0.0, 0.0, 0.0);
+    Eigen::Vector3d vmax(10.0, 10.0, 10.0);
+
+    pc.points_.resize(size);
+    Rand(pc.points_, vmin, vmax, 0);
+
+    geometry::KDTreeFlann kdtree(pc);
+
+    std::vector<Eigen::Vector3d> queries(20);
+    Rand(queries, vmin, vmax, 1);
+
+    geometry::KDTreeSearchParamKNN knn_param(7);
+    geometry::KDTreeSearchParamRadius radius_param(2.5);
+    geometry::KDTreeSearchParamHybrid hybrid_param(2.5, 5);
+    geometry::KDTreeSearchResult result;
+    for (const geometry::KDTreeSearchParam *param :
+         {(const geometry::KDTreeSearchParam *)&knn_param,
+          (const geometry::KDTreeSearchParam *)&radius_param,
+          (const geometry::KDTreeSearchParam *)&hybrid_param}) {
+        // The same result is reused across searches.
+        EXPECT_TRUE(kdtree.SearchBatch(queries, *param, result));
+        EXPECT_EQ(result.NumQueries(), queries.size());
+        EXPECT_EQ(result.offsets_.back(), result.indices_.size());
+        EXPECT_EQ(result.offsets_.back(), result.distance2_.size());
+        for (size_t i = 0; i < queries.size(); i++) {
+            std::vector<int> indices;
+            std::vector<double> distance2;
+            int k = kdtree.Search(queries[i], *param, indices, distance2);
+            ASSERT_EQ(result.NumNeighbors(i), k);
+            ExpectEQ(std::vector<int>(result.Indices(i), result.Indices(i) + k),
+                     indices);
+            ExpectEQ(std::vector<double>(result.Distance2(i),
+                                         result.Distance2(i) + k),
+                     distance2);
+        }
+    }
+
+    // Queries given as matrix columns match the point queries.
+    Eigen::MatrixXd query_matrix(3, queries.size());
+    for (size_t i = 0; i < queries.size(); i++) {
+        query_matrix.col(i) = queries[i];
+    }
+    geometry::KDTreeSearchResult matrix_result;
+    EXPECT_TRUE(kdtree.SearchBatch(query_matrix, hybrid_param, matrix_result));
+    ExpectEQ(matrix_result.indices_, result.indices_);
+    ExpectEQ(matrix_result.distance2_, result.distance2_);
+
+    // Queries of the wrong dimension give an empty result.
+    EXPECT_FALSE(kdtree.SearchBatch(Eigen::MatrixXd::Zero(2, 4), knn_param,
+                                    matrix_result));
+    EXPECT_EQ(matrix_result.NumQueries(), 4u);
+    EXPECT_TRUE(matrix_result.indices_.empty());
+}
+
+TEST(KDTreeFlann, Float32) {
+    int size = 1000;
+
+    geometry::PointCloud pc;
+
+    Eigen::Vector3d vmin(0.0, 0.0, 0.0);
+    Eigen::Vector3d vmax(10.0, 10.0, 10.0);
+
+    pc.points_.resize(size);
+    Rand(pc.points_, vmin, vmax, 0);
+
+    geometry::KDTreeFlann kdtree(pc);
+    geometry::KDTreeFlann kdtree_float(
+            pc, geometry::KDTreeFlann::Precision::Float32);
+    EXPECT_EQ(kdtree_float.GetPrecision(),
+              geometry::KDTreeFlann::Precision::Float32);
+
+    std::vector<Eigen::Vector3d> queries(20);
+    for (size_t i = 0; i < queries.size(); i++) {
+        queries[i] = pc.points_[i] + vmax * 0.01;
+    }
+
+    // The tree keeps its own copy of the points.
+    pc.Clear();
+
+    geometry::KDTreeSearchParamKNN knn_param(7);
+    geometry::KDTreeSearchParamHybrid hybrid_param(1.5, 5);
+    for (const geometry::KDTreeSearchParam *param :
+         {(const geometry::KDTreeSearchParam *)&knn_param,
+          (const geometry::KDTreeSearchParam *)&hybrid_param}) {
+        for (const Eigen::Vector3d &query : queries) {
+            std::vector<int> indices;
+            std::vector<double> distance2;
+            std::vector<int> indices_float;
+            std::vector<double> distance2_float;
+            int k = kdtree.Search(query, *param, indices, distance2);
+            int k_float = kdtree_float.Search(query, *param, indices_float,
+                                              distance2_float);
+            ASSERT_EQ(k, k_float);
+            ExpectEQ(indices, indices_float);
+            ExpectEQ(distance2, distance2_float, 1e-4);
+        }
+    }
+
+    geometry::KDTreeSearchResult result;
+    geometry::KDTreeSearchResult result_float;
+    EXPECT_TRUE(kdtree.SearchBatch(queries, knn_param, result));
+    EXPECT_TRUE(kdtree_float.SearchBatch(queries, knn_param, result_float));
+    ExpectEQ(result.indices_, result_float.indices_);
+    ExpectEQ(result.distance2_, result_float.distance2_, 1e-4);
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -0,0 +1,147 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/LinearOctree.h"
+
+#include <memory>
+
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/geometry/VoxelGrid.h"
+#include "open3d/io/PointCloudIO.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(LinearOctree, ZeroDepth) {
+    geometry::PointCloud pcd;
+    pcd.points_ = {Eigen::Vector3d(0, 0, 0), Eigen::Vector3d(1, 1, 1)};
+    pcd.colors_ = {Eigen::Vector3d(0, 0, 0), Eigen::Vector3d(1, 0.5, 0)};
+    geometry::LinearOctree octree(0);
+    octree.ConvertFromPointCloud(pcd, 0.01);
+
+    EXPECT_EQ(octree.NumNodes(), 1u);
+    EXPECT_TRUE(octree.IsLeaf(0));
+    ExpectEQ(octree.colors_[0], Eigen::Vector3d(0.5, 0.25, 0));
+    EXPECT_EQ(octree.LocateLeafNode(Eigen::Vector3d(0.5, 0.5, 0.5)), 0);
+    EXPECT_EQ(octree.LocateLeafNode(Eigen::Vector3d(-1, 0, 0)), -1);
+}
+
+TEST(LinearOctree, SevenCubes) {
+    std::vector<Eigen::Vector3d> points{
+            Eigen::Vector3d(0.5, 0.5, 0.5), Eigen::Vector3d(1.5, 0.5, 0.5),
+            Eigen::Vector3d(0.5, 1.5, 0.5), Eigen::Vector3d(1.5, 1.5, 0.5),
+            Eigen::Vector3d(0.5, 0.5, 1.5), Eigen::Vector3d(1.5, 0.5, 1.5),
+            Eigen::Vector3d(0.5, 1.5, 1.5)};
+    geometry::VoxelGrid voxel_grid;
+    voxel_grid.origin_ = Eigen::Vector3d(0, 0, 0);
+    voxel_grid.voxel_size_ = 1;
+    for (size_t i = 0; i < points.size(); ++i) {
+        voxel_grid.AddVoxel(geometry::Voxel(points[i].cast<int>(),
+                                            Eigen::Vector3d(double(i), 0, 0)));
+    }
+    geometry::LinearOctree octree(1);
+    octree.CreateFromVoxelGrid(voxel_grid);
+
+    // The root, then its children in the order of their child index, which
+    // is the order of the voxels above.
+    ASSERT_EQ(octree.NumNodes(), 8u);
+    EXPECT_EQ(octree.child_masks_[0], 0x7f);
+    EXPECT_EQ(octree.subtree_sizes_[0], 8u);
+    ExpectEQ(octree.colors_[0], Eigen::Vector3d(3, 0, 0));
+    for (size_t i = 0; i < points.size(); ++i) {
+        int64_t leaf = octree.LocateLeafNode(points[i]);
+        EXPECT_EQ(leaf, int64_t(i + 1));
+        EXPECT_EQ(octree.codes_[leaf], i);
+        geometry::OctreeNodeInfo info = octree.GetNodeInfo(leaf);
+        ExpectEQ(info.origin_,
+                 Eigen::Vector3d(points[i] - Eigen::Vector3d(0.5, 0.5, 0.5)));
+        EXPECT_EQ(info.size_, 1);
+        EXPECT_EQ(info.depth_, 1u);
+        EXPECT_EQ(info.child_index_, i);
+    }
+    EXPECT_EQ(octree.LocateLeafNode(Eigen::Vector3d(1.5, 1.5, 1.5)), -1);
+
+    // The traversal can skip the children of a node.
+    size_t num_visited = 0;
+    octree.Traverse([&](size_t, const geometry::OctreeNodeInfo&) {
+        ++num_visited;
+        return true;
+    });
+    EXPECT_EQ(num_visited, 1u);
+
+    std::shared_ptr<geometry::VoxelGrid> voxels = octree.ToVoxelGrid();
+    EXPECT_EQ(voxels->voxels_.size(), points.size());
+    EXPECT_EQ(voxels->voxel_size_, 1);
+    for (size_t i = 0; i < points.size(); ++i) {
+        ExpectEQ(voxels->voxels_.at(points[i].cast<int>()).color_,
+                 Eigen::Vector3d(double(i), 0, 0));
+    }
+}
+
+TEST(LinearOctree, FragmentPLYMatchesOctree) {
+    geometry::PointCloud pcd;
+    io::ReadPointCloud(std::string(TEST_DATA_DIR) + "/fragment.ply", pcd);
+    size_t max_depth = 5;
+    geometry::Octree octree(max_depth);
+    octree.ConvertFromPointCloud(pcd, 0.01);
+    geometry::LinearOctree linear_octree(max_depth);
+    linear_octree.ConvertFromPointCloud(pcd, 0.01);
+
+    // Same nodes in the same depth-first order.
+    std::vector<size_t> depths;
+    std::vector<Eigen::Vector3d> origins;
+    octree.Traverse([&](const std::shared_ptr<geometry::OctreeNode>&,
+                        const std::shared_ptr<geometry::OctreeNodeInfo>&
+                                node_info) {
+        depths.push_back(node_info->depth_);
+        origins.push_back(node_info->origin_);
+    });
+    ASSERT_EQ(linear_octree.NumNodes(), depths.size());
+    for (size_t node = 0; node < depths.size(); ++node) {
+        geometry::OctreeNodeInfo info = linear_octree.GetNodeInfo(node);
+        EXPECT_EQ(info.depth_, depths[node]);
+        ExpectEQ(info.origin_, origins[node]);
+    }
+
+    for (size_t idx = 0; idx < pcd.points_.size(); idx += 100) {
+        int64_t leaf = linear_octree.LocateLeafNode(pcd.points_[idx]);
+        ASSERT_GE(leaf, 0);
+        geometry::OctreeNodeInfo info = linear_octree.GetNodeInfo(leaf);
+        EXPECT_TRUE(geometry::Octree::IsPointInBound(pcd.points_[idx],
+                                                     info.origin_, info.size_));
+    }
+
+    // Converting to Octree and back keeps the tree.
+    geometry::LinearOctree round_trip;
+    round_trip.CreateFromOctree(*linear_octree.ToOctree());
+    EXPECT_EQ(round_trip.child_masks_, linear_octree.child_masks_);
+    EXPECT_EQ(round_trip.codes_, linear_octree.codes_);
+    ExpectEQ(round_trip.colors_, linear_octree.colors_);
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -27,6 +27,8 @@
 #include "open3d/geometry/PointCloud.h"
 
 #include <algorithm>
+#include <map>
+#include <numeric>
 
 #include "open3d/camera/PinholeCameraIntrinsic.h"
 #include "open3d/geometry/BoundingVolume.h"
@@ -193,6 +195,96 @@ TEST(PointCloud, GetOrientedBoundingBox) {
                                                 {3, 2, 1}})));
 }
 
+TEST(PointCloud, GetAxisAlignedBoundingBoxParallel) {
+    // Large enough for the reduction to run on several threads.
+    std::vector<Eigen::Vector3d> points(100000);
+    Rand(points, Eigen::Vector3d(-5, -5, -5), Eigen::Vector3d(5, 5, 5), 0);
+    points[12345] = Eigen::Vector3d(-6, 7, 0);
+    points[67890] = Eigen::Vector3d(8, 0, -9);
+
+    geometry::AxisAlignedBoundingBox aabb =
+            geometry::PointCloud(points).GetAxisAlignedBoundingBox();
+    EXPECT_EQ(aabb.min_bound_.x(), -6);
+    EXPECT_EQ(aabb.max_bound_.y(), 7);
+    EXPECT_EQ(aabb.max_bound_.x(), 8);
+    EXPECT_EQ(aabb.min_bound_.z(), -9);
+    EXPECT_GE(aabb.min_bound_.y(), -5);
+    EXPECT_LE(aabb.max_bound_.z(), 5);
+    ExpectEQ(aabb.min_bound_, geometry::PointCloud(points).GetMinBound());
+    ExpectEQ(aabb.max_bound_, geometry::PointCloud(points).GetMaxBound());
+}
+
+TEST(PointCloud, CreateFromPointsPCA) {
+    EXPECT_TRUE(geometry::OrientedBoundingBox::CreateFromPointsPCA({})
+                        .IsEmpty());
+
+    // Unlike CreateFromPoints, degenerate sets are accepted.
+    geometry::OrientedBoundingBox obb =
+            geometry::OrientedBoundingBox::CreateFromPointsPCA(
+                    {{0, 0, 0}, {1, 1, 1}});
+    ExpectEQ(obb.center_, Eigen::Vector3d(0.5, 0.5, 0.5));
+    EXPECT_NEAR(obb.extent_(0), std::sqrt(3), 1e-12);
+    EXPECT_NEAR(obb.extent_(1), 0, 1e-12);
+    EXPECT_NEAR(obb.extent_(2), 0, 1e-12);
+
+    // A rotated 3 x 2 x 1 box, with the corners and random interior points.
+    const Eigen::Matrix3d R =
+            geometry::Geometry3D::GetRotationMatrixFromXYZ({0.3, -0.5, 0.9});
+    const Eigen::Vector3d t(1, -2, 3);
+    std::vector<Eigen::Vector3d> points(50000);
+    Rand(points, Eigen::Vector3d(-1.5, -1, -0.5), Eigen::Vector3d(1.5, 1, 0.5),
+         0);
+    for (int i = 0; i < 8; i++) {
+        points[i] = Eigen::Vector3d(i & 1 ? 1.5 : -1.5, i & 2 ? 1 : -1,
+                                    i & 4 ? 0.5 : -0.5);
+    }
+    for (auto& p : points) {
+        p = R * p + t;
+    }
+    obb = geometry::OrientedBoundingBox::CreateFromPointsPCA(points);
+    // The interior points are in the covariance, so the axes are only
+    // approximately the box axes, up to the signs.
+    ExpectEQ(obb.center_, t, 1e-2);
+    ExpectEQ(obb.extent_, Eigen::Vector3d(3, 2, 1), 2e-2);
+    ExpectEQ(Eigen::Matrix3d((obb.R_.transpose() * R).cwiseAbs()),
+             Eigen::Matrix3d(Eigen::Matrix3d::Identity()), 2e-2);
+    // The extreme points are on the box up to the rounding.
+    obb.extent_ += Eigen::Vector3d::Constant(1e-9);
+    EXPECT_EQ(obb.GetPointIndicesWithinBoundingBox(points).size(),
+              points.size());
+}
+
+TEST(PointCloud, CreateFromPointsMinimal) {
+    EXPECT_ANY_THROW(geometry::OrientedBoundingBox::CreateFromPointsMinimal(
+            {{0, 0, 0}, {0, 0, 1}, {0, 1, 0}, {0, 1, 1}}));
+
+    // A rotated 3 x 2 x 1 box.
+    const Eigen::Matrix3d R =
+            geometry::Geometry3D::GetRotationMatrixFromXYZ({0.3, -0.5, 0.9});
+    std::vector<Eigen::Vector3d> points;
+    for (int i = 0; i < 8; i++) {
+        points.push_back(R * Eigen::Vector3d(i & 1 ? 3 : 0, i & 2 ? 2 : 0,
+                                             i & 4 ? 1 : 0));
+    }
+    geometry::OrientedBoundingBox obb =
+            geometry::OrientedBoundingBox::CreateFromPointsMinimal(points);
+    EXPECT_NEAR(obb.Volume(), 6, 1e-6);
+    EXPECT_NEAR(obb.R_.determinant(), 1, 1e-12);
+    ExpectEQ(obb.center_, Eigen::Vector3d(R * Eigen::Vector3d(1.5, 1, 0.5)),
+             1e-6);
+
+    // A right triangular prism, for which the PCA axes are tilted in the
+    // triangle plane and the PCA box is larger than the minimal one.
+    points = {{0, 0, 0}, {4, 0, 0}, {0, 1, 0}, {0, 0, 1}, {4, 0, 1}, {0, 1, 1}};
+    obb = geometry::OrientedBoundingBox::CreateFromPointsMinimal(points);
+    EXPECT_NEAR(obb.Volume(), 4, 1e-9);
+    EXPECT_GT(geometry::OrientedBoundingBox::CreateFromPoints(points).Volume(),
+              4 + 1e-3);
+    obb.extent_ += Eigen::Vector3d::Constant(1e-9);
+    EXPECT_EQ(obb.GetPointIndicesWithinBoundingBox(points).size(),
+              points.size());
+}
+
 TEST(PointCloud, Transform) {
     std::vector<Eigen::Vector3d> points = {
             {0, 0, 0},
@@ -594,6 +686,156 @@ TEST(PointCloud, VoxelDownSample) {
     ExpectEQ(ApplyIndices(pc_down->colors_, sort_indices), colors_down);
 }
 
+namespace {
+
+struct Vector3iLess {
+    bool operator()(const Eigen::Vector3i &a, const Eigen::Vector3i &b) const {
+        return std::lexicographical_compare(a.data(), a.data() + 3, b.data(),
+                                            b.data() + 3);
+    }
+};
+
+struct AccumulatedPoint {
+    int num_of_points_ = 0;
+    Eigen::Vector3d point_ = Eigen::Vector3d::Zero();
+    Eigen::Vector3d normal_ = Eigen::Vector3d::Zero();
+    Eigen::Vector3d color_ = Eigen::Vector3d::Zero();
+    std::map<int, int> classes_;
+    std::vector<std::pair<int, int>> original_id_;
+};
+
+// Serial voxel down sampling with an ordered map as reference. Voxels come out
+// in lexicographic order of their voxel index.
+std::tuple<std::shared_ptr<geometry::PointCloud>,
+           Eigen::MatrixXi,
+           std::vector<std::vector<int>>>
+VoxelDownSampleReference(const geometry::PointCloud &pcd,
+                         double voxel_size,
+                         const Eigen::Vector3d &voxel_min_bound,
+                         bool approximate_class) {
+    std::map<Eigen::Vector3i, AccumulatedPoint, Vector3iLess> accpoints;
+    int cid_temp[3] = {1, 2, 4};
+    for (int i = 0; i < int(pcd.points_.size()); i++) {
+        Eigen::Vector3d ref_coord =
+                (pcd.points_[i] - voxel_min_bound) / voxel_size;
+        Eigen::Vector3i voxel_index(int(floor(ref_coord(0))),
+                                    int(floor(ref_coord(1))),
+                                    int(floor(ref_coord(2))));
+        int cid = 0;
+        for (int c = 0; c < 3; c++) {
+            if ((ref_coord(c) - voxel_index(c)) >= 0.5) {
+                cid += cid_temp[c];
+            }
+        }
+        AccumulatedPoint &accpoint = accpoints[voxel_index];
+        accpoint.point_ += pcd.points_[i];
+        if (pcd.HasNormals() && !std::isnan(pcd.normals_[i](0)) &&
+            !std::isnan(pcd.normals_[i](1)) &&
+            !std::isnan(pcd.normals_[i](2))) {
+            accpoint.normal_ += pcd.normals_[i];
+        }
+        if (pcd.HasColors()) {
+            if (approximate_class) {
+                accpoint.classes_[int(pcd.colors_[i][0])]++;
+            } else {
+                accpoint.color_ += pcd.colors_[i];
+            }
+        }
+        accpoint.original_id_.emplace_back(i, cid);
+        accpoint.num_of_points_++;
+    }
+
+    auto output = std::make_shared<geometry::PointCloud>();
+    Eigen::MatrixXi cubic_id(accpoints.size(), 8);
+    cubic_id.setConstant(-1);
+    std::vector<std::vector<int>> original_indices(accpoints.size());
+    int cnt = 0;
+    for (const auto &it : accpoints) {
+        const AccumulatedPoint &accpoint = it.second;
+        double num = double(accpoint.num_of_points_);
+        output->points_.push_back(accpoint.point_ / num);
+        if (pcd.HasNormals()) {
+            output->normals_.push_back(accpoint.normal_ / num);
+        }
+        if (pcd.HasColors()) {
+            if (approximate_class) {
+                int max_class = -1;
+                int max_count = -1;
+                for (const auto &c : accpoint.classes_) {
+                    if (c.second > max_count) {
+                        max_count = c.second;
+                        max_class = c.first;
+                    }
+                }
+                output->colors_.emplace_back(max_class, max_class, max_class);
+            } else {
+                output->colors_.push_back(accpoint.color_ / num);
+            }
+        }
+        for (const auto &id : accpoint.original_id_) {
+            cubic_id(cnt, id.second) = id.first;
+            original_indices[cnt].push_back(id.first);
+        }
+        cnt++;
+    }
+    return std::make_tuple(output, cubic_id, original_indices);
+}
+
+geometry::PointCloud RandomPointCloudForVoxelDownSample() {
+    int size = 2000;
+    geometry::PointCloud pcd;
+    pcd.points_.resize(size);
+    pcd.normals_.resize(size);
+    pcd.colors_.resize(size);
+    Rand(pcd.points_, Eigen::Vector3d(-5.0, -5.0, -5.0),
+         Eigen::Vector3d(5.0, 5.0, 5.0), 0);
+    Rand(pcd.normals_, Eigen::Vector3d(-1.0, -1.0, -1.0),
+         Eigen::Vector3d(1.0, 1.0, 1.0), 1);
+    Rand(pcd.colors_, Eigen::Vector3d(0.0, 0.0, 0.0),
+         Eigen::Vector3d(3.99, 1.0, 1.0), 2);
+    for (int i = 0; i < size; i += 97) {
+        pcd.normals_[i](1) = std::numeric_limits<double>::quiet_NaN();
+    }
+    return pcd;
+}
+
+}  // namespace
+
+TEST(PointCloud, VoxelDownSampleMatchesReference) {
+    geometry::PointCloud pcd = RandomPointCloudForVoxelDownSample();
+    for (double voxel_size : {0.3, 1.0, 20.0}) {
+        Eigen::Vector3d voxel_min_bound =
+                pcd.GetMinBound() - Eigen::Vector3d::Constant(voxel_size * 0.5);
+        auto ref = std::get<0>(VoxelDownSampleReference(
+                pcd, voxel_size, voxel_min_bound, false));
+        auto pc_down = pcd.VoxelDownSample(voxel_size);
+        ExpectEQ(pc_down->points_, ref->points_);
+        ExpectEQ(pc_down->normals_, ref->normals_);
+        ExpectEQ(pc_down->colors_, ref->colors_);
+    }
+
+    geometry::PointCloud empty;
+    EXPECT_TRUE(empty.VoxelDownSample(1.0)->IsEmpty());
+}
+
+TEST(PointCloud, VoxelDownSampleAndTrace) {
+    geometry::PointCloud pcd = RandomPointCloudForVoxelDownSample();
+    // The bounds do not need to enclose the point cloud.
+    Eigen::Vector3d min_bound(-4.0, -4.0, -4.0);
+    Eigen::Vector3d max_bound(4.0, 4.0, 4.0);
+    for (bool approximate_class : {false, true}) {
+        auto ref = VoxelDownSampleReference(pcd, 0.7, min_bound,
+                                            approximate_class);
+        auto res = pcd.VoxelDownSampleAndTrace(0.7, min_bound, max_bound,
+                                               approximate_class);
+        ExpectEQ(std::get<0>(res)->points_, std::get<0>(ref)->points_);
+        ExpectEQ(std::get<0>(res)->normals_, std::get<0>(ref)->normals_);
+        ExpectEQ(std::get<0>(res)->colors_, std::get<0>(ref)->colors_);
+        EXPECT_EQ(std::get<1>(res), std::get<1>(ref));
+        EXPECT_EQ(std::get<2>(res), std::get<2>(ref));
+    }
+}
+
 TEST(PointCloud, UniformDownSample) {
     std::vector<Eigen::Vector3d> points({
             {0, 0, 0},
@@ -732,6 +974,7 @@ TEST(PointCloud, EstimateNormals) {
             {1, 1, 0},
             {1, 1, 1},
     });
+    geometry::PointCloud pcd_float32 = pcd;
     pcd.EstimateNormals(geometry::KDTreeSearchParamKNN(/*knn=*/4));
     pcd.NormalizeNormals();
     double v = 1.0 / std::sqrt(3.0);
@@ -743,6 +986,12 @@ TEST(PointCloud, EstimateNormals) {
                                                          {v, -v, v},
                                                          {-v, -v, v},
                                                          {v, v, v}}));
+
+    pcd_float32.EstimateNormals(geometry::KDTreeSearchParamKNN(/*knn=*/4),
+                                /*fast_normal_computation=*/true,
+                                geometry::KDTreeFlann::Precision::Float32);
+    pcd_float32.NormalizeNormals();
+    ExpectEQ(pcd_float32.normals_, pcd.normals_);
 }
 
 TEST(PointCloud, OrientNormalsToAlignWithDirection) {
@@ -1050,6 +1299,37 @@ TEST(PointCloud, SegmentPlaneKnownPlane) {
     ExpectEQ(pcd.SelectByIndex(inliers)->points_, ref);
 }
 
+TEST(PointCloud, SegmentPlanes) {
+    // Two 10 x 10 grids on the planes z = 0 and x = 2, and an outlier.
+    std::vector<Eigen::Vector3d> points;
+    for (int i = 0; i < 10; ++i) {
+        for (int j = 0; j < 10; ++j) {
+            points.emplace_back(0.1 * i, 0.1 * j, 0.0);
+        }
+    }
+    for (int i = 0; i < 10; ++i) {
+        for (int j = 0; j < 10; ++j) {
+            points.emplace_back(2.0, 0.1 * i, 0.5 + 0.1 * j);
+        }
+    }
+    points.emplace_back(1.0, 1.0, 1.0);
+    geometry::PointCloud pcd(points);
+
+    std::vector<std::tuple<Eigen::Vector4d, std::vector<size_t>>> planes =
+            pcd.SegmentPlanes(3, 0.01, 3, 100, 10);
+    ASSERT_EQ(planes.size(), 2);
+    std::vector<size_t> all_inliers;
+    for (const auto &plane : planes) {
+        const std::vector<size_t> &inliers = std::get<1>(plane);
+        EXPECT_EQ(inliers.size(), 100);
+        all_inliers.insert(all_inliers.end(), inliers.begin(), inliers.end());
+    }
+    std::sort(all_inliers.begin(), all_inliers.end());
+    std::vector<size_t> ref_inliers(200);
+    std::iota(ref_inliers.begin(), ref_inliers.end(), 0);
+    EXPECT_EQ(all_inliers, ref_inliers);
+}
+
 TEST(PointCloud, CreateFromDepthImage) {
     const std::string trajectory_path =
             std::string(TEST_DATA_DIR) + "/RGBD/trajectory.log";
@@ -0,0 +1,162 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/TriangleBVH.h"
+
+#include "open3d/geometry/IntersectionTest.h"
+#include "open3d/geometry/TriangleMesh.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(TriangleBVH, Empty) {
+    geometry::TriangleBVH bvh;
+    EXPECT_TRUE(bvh.IsEmpty());
+    EXPECT_FALSE(bvh.QueryAABB(Eigen::Vector3d(-1, -1, -1),
+                               Eigen::Vector3d(1, 1, 1),
+                               [](int) { return true; }));
+    EXPECT_EQ(std::get<0>(bvh.ComputeClosestPoint(Eigen::Vector3d(0, 0, 0))),
+              -1);
+}
+
+TEST(TriangleBVH, QueryAABB) {
+    std::vector<Eigen::Vector3d> vertices(300);
+    std::vector<Eigen::Vector3i> triangles(100);
+    Rand(vertices, Eigen::Vector3d(-1, -1, -1), Eigen::Vector3d(1, 1, 1), 0);
+    for (int i = 0; i < 100; ++i) {
+        triangles[i] = Eigen::Vector3i(3 * i, 3 * i + 1, 3 * i + 2);
+    }
+    geometry::TriangleBVH bvh(vertices, triangles, 2);
+    EXPECT_FALSE(bvh.IsEmpty());
+
+    const Eigen::Vector3d min_bound(-0.2, -0.3, 0.1);
+    const Eigen::Vector3d max_bound(0.4, 0.2, 0.5);
+    std::vector<int> found;
+    bvh.QueryAABB(min_bound, max_bound, [&](int tidx) {
+        found.push_back(tidx);
+        return false;
+    });
+    std::sort(found.begin(), found.end());
+
+    std::vector<int> expected;
+    for (int tidx = 0; tidx < 100; ++tidx) {
+        const Eigen::Vector3d &v0 = vertices[triangles[tidx](0)];
+        const Eigen::Vector3d &v1 = vertices[triangles[tidx](1)];
+        const Eigen::Vector3d &v2 = vertices[triangles[tidx](2)];
+        if (geometry::IntersectionTest::AABBAABB(
+                    v0.cwiseMin(v1).cwiseMin(v2), v0.cwiseMax(v1).cwiseMax(v2),
+                    min_bound, max_bound)) {
+            expected.push_back(tidx);
+        }
+    }
+    EXPECT_EQ(found, expected);
+
+    // The query stops at the first triangle if requested.
+    int num_calls = 0;
+    EXPECT_TRUE(bvh.QueryAABB(Eigen::Vector3d(-1, -1, -1),
+                              Eigen::Vector3d(1, 1, 1), [&](int) {
+                                  ++num_calls;
+                                  return true;
+                              }));
+    EXPECT_EQ(num_calls, 1);
+}
+
+TEST(TriangleBVH, ComputeClosestPoint) {
+    auto mesh = geometry::TriangleMesh::CreateSphere(1.0, 10);
+    geometry::TriangleBVH bvh(mesh->vertices_, mesh->triangles_);
+
+    int tidx;
+    Eigen::Vector3d point;
+    double distance2;
+    std::tie(tidx, point, distance2) =
+            bvh.ComputeClosestPoint(Eigen::Vector3d(0, 0, 3));
+    EXPECT_GE(tidx, 0);
+    EXPECT_NEAR(distance2, 4.0, 1e-6);
+    ExpectEQ(point, Eigen::Vector3d(0, 0, 1));
+
+    // A point on a face is at distance 0 from the mesh.
+    const Eigen::Vector3i &triangle = mesh->triangles_[7];
+    const Eigen::Vector3d centroid = (mesh->vertices_[triangle(0)] +
+                                      mesh->vertices_[triangle(1)] +
+                                      mesh->vertices_[triangle(2)]) /
+                                     3;
+    std::tie(tidx, point, distance2) = bvh.ComputeClosestPoint(centroid);
+    EXPECT_NEAR(distance2, 0.0, 1e-12);
+    ExpectEQ(point, centroid);
+}
+
+TEST(TriangleBVH, SelfIntersectingTriangles) {
+    // Two crossing quads made of two triangles each.
+    geometry::TriangleMesh mesh;
+    mesh.vertices_ = {{0, 0, 0}, {1, 0, 0}, {1, 1, 0}, {0, 1, 0},
+                      {0.5, 0.5, -1}, {0.5, 0.5, 1}, {0.5, -1, 1},
+                      {0.5, -1, -1}};
+    mesh.triangles_ = {{0, 1, 2}, {0, 2, 3}, {4, 5, 6}, {4, 6, 7}};
+    const auto pairs = mesh.GetSelfIntersectingTriangles();
+    std::vector<Eigen::Vector2i> brute_force;
+    for (int i = 0; i < 4; ++i) {
+        for (int j = i + 1; j < 4; ++j) {
+            const Eigen::Vector3i &p = mesh.triangles_[i];
+            const Eigen::Vector3i &q = mesh.triangles_[j];
+            if ((p.array() == q(0) || p.array() == q(1) ||
+                 p.array() == q(2))
+                        .any()) {
+                continue;
+            }
+            if (geometry::IntersectionTest::TriangleTriangle3d(
+                        mesh.vertices_[p(0)], mesh.vertices_[p(1)],
+                        mesh.vertices_[p(2)], mesh.vertices_[q(0)],
+                        mesh.vertices_[q(1)], mesh.vertices_[q(2)])) {
+                brute_force.push_back(Eigen::Vector2i(i, j));
+            }
+        }
+    }
+    EXPECT_FALSE(brute_force.empty());
+    ExpectEQ(pairs, brute_force);
+    EXPECT_TRUE(mesh.IsSelfIntersecting());
+
+    geometry::TriangleMesh empty;
+    EXPECT_TRUE(empty.GetSelfIntersectingTriangles().empty());
+    EXPECT_FALSE(empty.IsSelfIntersecting());
+}
+
+TEST(TriangleBVH, IsIntersecting) {
+    auto box0 = geometry::TriangleMesh::CreateBox();
+    auto box1 = geometry::TriangleMesh::CreateBox();
+    box1->Translate(Eigen::Vector3d(0.5, 0.5, 0.5));
+    auto box2 = geometry::TriangleMesh::CreateBox();
+    box2->Translate(Eigen::Vector3d(0.2, 0.2, 0.2));
+    box2->Scale(0.2, box2->GetCenter());
+    EXPECT_TRUE(box0->IsIntersecting(*box1));
+    EXPECT_TRUE(box1->IsIntersecting(*box0));
+    // box2 is inside box0: the boxes overlap, but not the surfaces.
+    EXPECT_TRUE(box0->IsBoundingBoxIntersecting(*box2));
+    EXPECT_FALSE(box0->IsIntersecting(*box2));
+}
+
+}  // namespace tests
+}  // namespace open3d
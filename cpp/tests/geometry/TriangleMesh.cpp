@@ -28,6 +28,8 @@
 
 #include "open3d/geometry/BoundingVolume.h"
 #include "open3d/geometry/PointCloud.h"
+#include "open3d/geometry/Qhull.h"
+#include "open3d/geometry/TetraMesh.h"
 #include "tests/UnitTest.h"
 
 namespace open3d {
@@ -839,6 +841,78 @@ TEST(TriangleMesh, FilterSmoothTaubin) {
     ExpectEQ(mesh->vertices_, ref2, 1e-4);
 }
 
+TEST(TriangleMesh, SimplifyQuadricDecimationParallel) {
+    // A collapse removes two triangles of a closed mesh, so the target is
+    // reached exactly, and the vertices stay close to the sphere.
+    auto sphere = geometry::TriangleMesh::CreateSphere(1.0, 20);
+    int target = int(sphere->triangles_.size()) / 4;
+    auto simplified = sphere->SimplifyQuadricDecimationParallel(target);
+    EXPECT_EQ(int(simplified->triangles_.size()), target);
+    EXPECT_TRUE(simplified->IsEdgeManifold());
+    for (const Eigen::Vector3d& vertex : simplified->vertices_) {
+        EXPECT_NEAR(vertex.norm(), 1.0, 0.01);
+    }
+
+    // With only a target error, a planar 10 x 10 grid is decimated to two
+    // triangles that cover the same square.
+    geometry::TriangleMesh grid;
+    for (int i = 0; i <= 10; ++i) {
+        for (int j = 0; j <= 10; ++j) {
+            grid.vertices_.emplace_back(0.1 * i, 0.1 * j, 0.0);
+        }
+    }
+    for (int i = 0; i < 10; ++i) {
+        for (int j = 0; j < 10; ++j) {
+            int vidx = i * 11 + j;
+            grid.triangles_.emplace_back(vidx, vidx + 11, vidx + 12);
+            grid.triangles_.emplace_back(vidx, vidx + 12, vidx + 1);
+        }
+    }
+    simplified = grid.SimplifyQuadricDecimationParallel(0, 1e-8);
+    EXPECT_EQ(simplified->triangles_.size(), 2);
+    EXPECT_NEAR(simplified->GetSurfaceArea(), 1.0, 1e-6);
+}
+
+TEST(TriangleMesh, SimplifyVertexClustering) {
+    // The coordinates 0, 0.1, ..., 1 of a 10 x 10 grid fall into 5 voxels per
+    // axis, so the grid is clustered into a 4 x 4 grid.
+    geometry::TriangleMesh grid;
+    for (int i = 0; i <= 10; ++i) {
+        for (int j = 0; j <= 10; ++j) {
+            grid.vertices_.emplace_back(0.1 * i, 0.1 * j, 0.0);
+        }
+    }
+    for (int i = 0; i < 10; ++i) {
+        for (int j = 0; j < 10; ++j) {
+            int vidx = i * 11 + j;
+            grid.triangles_.emplace_back(vidx, vidx + 11, vidx + 12);
+            grid.triangles_.emplace_back(vidx, vidx + 12, vidx + 1);
+        }
+    }
+    for (auto contraction : {geometry::MeshBase::SimplificationContraction::
+                                     Average,
+                             geometry::MeshBase::SimplificationContraction::
+                                     Quadric}) {
+        auto simplified = grid.SimplifyVertexClustering(0.25, contraction);
+        EXPECT_EQ(simplified->vertices_.size(), 25);
+        EXPECT_EQ(simplified->triangles_.size(), 32);
+        EXPECT_NEAR(simplified->vertices_[0].norm(), 0.05 * sqrt(2), 1e-12);
+
+        // The vertices are numbered in the order of their first original
+        // vertex, and each triangle starts at its smallest vertex.
+        EXPECT_LT(simplified->vertices_[1](1), simplified->vertices_[2](1));
+        for (const Eigen::Vector3i& triangle : simplified->triangles_) {
+            EXPECT_LT(triangle(0), triangle(1));
+            EXPECT_LT(triangle(0), triangle(2));
+        }
+        EXPECT_NEAR(simplified->GetSurfaceArea(),
+                    (simplified->GetMaxBound() - simplified->GetMinBound())
+                            .head<2>()
+                            .prod(),
+                    1e-12);
+    }
+}
+
 TEST(TriangleMesh, HasVertices) {
     int size = 100;
 
@@ -1890,6 +1964,41 @@ TEST(TriangleMesh, CreateFromPointCloudPoisson) {
     ExpectEQ(densities_es, densities_gt, 1e-4);
 }
 
+TEST(TriangleMesh, CreateFromPointCloudPoissonTiled) {
+    auto sphere = geometry::TriangleMesh::CreateSphere(1.0, 40);
+    sphere->ComputeVertexNormals();
+    auto pcd = sphere->SamplePointsUniformly(10000);
+
+    // The unit sphere spans 2 x 2 x 2 tiles, whose triangles together stay
+    // close to the sphere.
+    std::shared_ptr<geometry::TriangleMesh> mesh;
+    std::vector<double> densities;
+    std::tie(mesh, densities) =
+            geometry::TriangleMesh::CreateFromPointCloudPoissonTiled(
+                    *pcd, 1.0, 0.3, 6, false, /*n_threads=*/1);
+    EXPECT_GT(mesh->triangles_.size(), 0);
+    EXPECT_EQ(densities.size(), mesh->vertices_.size());
+    std::vector<double> errors;
+    for (const Eigen::Vector3d& vertex : mesh->vertices_) {
+        errors.push_back(std::abs(vertex.norm() - 1.0));
+    }
+    std::nth_element(errors.begin(), errors.begin() + errors.size() / 2,
+                     errors.end());
+    EXPECT_LT(errors[errors.size() / 2], 0.05);
+
+    // Trimming removes the vertices of lowest density.
+    std::shared_ptr<geometry::TriangleMesh> trimmed;
+    std::vector<double> trimmed_densities;
+    std::tie(trimmed, trimmed_densities) =
+            geometry::TriangleMesh::CreateFromPointCloudPoissonTiled(
+                    *pcd, 1.0, 0.3, 6, false, /*n_threads=*/1, 0.2);
+    EXPECT_LT(trimmed->vertices_.size(), mesh->vertices_.size());
+    EXPECT_EQ(trimmed_densities.size(), trimmed->vertices_.size());
+    EXPECT_GE(*std::min_element(trimmed_densities.begin(),
+                                trimmed_densities.end()),
+              *std::min_element(densities.begin(), densities.end()));
+}
+
 TEST(TriangleMesh, CreateFromPointCloudAlphaShape) {
     geometry::PointCloud pcd;
     pcd.points_ = {
@@ -1915,6 +2024,67 @@ TEST(TriangleMesh, CreateFromPointCloudAlphaShape) {
     ExpectMeshEQ(*mesh_es, mesh_gt);
 }
 
+TEST(TriangleMesh, CreateFromPointCloudAlphaShapes) {
+    geometry::PointCloud pcd;
+    pcd.points_ = {
+            {0.765822, 1.000000, 0.486627}, {0.034963, 1.000000, 0.632086},
+            {0.000000, 0.093962, 0.028012}, {0.000000, 0.910057, 0.049732},
+            {0.017178, 0.000000, 0.946382}, {0.972485, 0.000000, 0.431460},
+            {0.794109, 0.033417, 1.000000}, {0.700868, 0.648112, 1.000000},
+            {0.164379, 0.516339, 1.000000}, {0.521248, 0.377170, 0.000000}};
+    std::shared_ptr<geometry::TetraMesh> tetra_mesh;
+    std::vector<size_t> pt_map;
+    std::tie(tetra_mesh, pt_map) =
+            geometry::Qhull::ComputeDelaunayTetrahedralization(pcd.points_);
+
+    // Unsorted alphas, from an empty shape to the convex hull.
+    const std::vector<double> alphas = {1, 0.1, 0.6, 100, 0.5};
+    auto meshes = geometry::TriangleMesh::CreateFromPointCloudAlphaShapes(
+            pcd, alphas, tetra_mesh, &pt_map);
+    ASSERT_EQ(meshes.size(), alphas.size());
+    for (size_t i = 0; i < alphas.size(); ++i) {
+        auto mesh_gt = geometry::TriangleMesh::CreateFromPointCloudAlphaShape(
+                pcd, alphas[i], tetra_mesh, &pt_map);
+        ExpectMeshEQ(*meshes[i], *mesh_gt);
+    }
+    EXPECT_TRUE(meshes[1]->triangles_.empty());
+}
+
+TEST(TriangleMesh, CreateFromPointCloudBallPivoting) {
+    // A jittered 5x5 grid on a saddle, with the normals of the saddle.
+    geometry::PointCloud pcd;
+    for (int i = 0; i < 5; ++i) {
+        for (int j = 0; j < 5; ++j) {
+            double x = 0.1 * i + 0.013 * ((i * 7 + j * 3) % 5);
+            double y = 0.1 * j + 0.011 * ((i * 3 + j * 5) % 4);
+            pcd.points_.push_back({x, y, 0.2 * (x * x - y * y)});
+            pcd.normals_.push_back(
+                    Eigen::Vector3d(-0.4 * x, 0.4 * y, 1).normalized());
+        }
+    }
+    std::vector<Eigen::Vector3i> triangles_gt = {
+            {0, 5, 1},    {5, 6, 1},    {6, 7, 1},    {7, 2, 1},
+            {7, 8, 2},    {8, 3, 2},    {8, 4, 3},    {8, 9, 4},
+            {8, 14, 9},   {8, 13, 14},  {13, 19, 14}, {13, 18, 19},
+            {18, 23, 19}, {23, 24, 19}, {18, 17, 23}, {17, 22, 23},
+            {17, 16, 22}, {16, 21, 22}, {16, 15, 21}, {15, 20, 21},
+            {16, 10, 15}, {16, 11, 10}, {11, 5, 10},  {11, 6, 5},
+            {11, 7, 6},   {11, 12, 7},  {12, 13, 7},  {13, 8, 7},
+            {12, 17, 13}, {17, 18, 13}, {12, 11, 17}, {11, 16, 17},
+            {3, 4, 2}};
+
+    auto mesh = geometry::TriangleMesh::CreateFromPointCloudBallPivoting(
+            pcd, {0.1, 0.2});
+    ASSERT_EQ(mesh->vertices_.size(), 25u);
+    ExpectEQ(mesh->vertices_[0], Eigen::Vector3d(0, 0, 0));
+    ExpectEQ(mesh->vertices_[7], Eigen::Vector3d(0.139, 0.211, -0.005040));
+    ExpectEQ(mesh->vertices_[24], Eigen::Vector3d(0.4, 0.4, 0));
+    ExpectEQ(mesh->vertices_, pcd.points_);
+    ExpectEQ(mesh->vertex_normals_, pcd.normals_);
+    ASSERT_EQ(mesh->triangles_.size(), 33u);
+    ExpectEQ(mesh->triangles_, triangles_gt);
+}
+
 TEST(TriangleMesh, CreateMeshSphere) {
     std::vector<Eigen::Vector3d> ref_vertices = {
             {0.000000, 0.000000, 1.000000},
@@ -0,0 +1,91 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/io/ByteSource.h"
+
+#include <cstdio>
+#include <numeric>
+#include <vector>
+
+#include "open3d/utility/FileSystem.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(ByteSource, GetPathScheme) {
+    EXPECT_EQ(io::GetPathScheme("http://host/scan.ply"), "http");
+    EXPECT_EQ(io::GetPathScheme("S3://bucket/scan.pcd"), "s3");
+    EXPECT_EQ(io::GetPathScheme("/data/scan.ply"), "");
+    EXPECT_EQ(io::GetPathScheme("C://data/scan.ply"), "");
+    EXPECT_TRUE(io::IsURL("file:///data/scan.ply"));
+    EXPECT_FALSE(io::IsURL("scan.ply"));
+}
+
+TEST(ByteSource, GetPathExtensionInLowerCase) {
+    EXPECT_EQ(io::GetPathExtensionInLowerCase(
+                      "http://host.com/scan.PCD?X-Amz-Signature=a.b"),
+              "pcd");
+    EXPECT_EQ(io::GetPathExtensionInLowerCase("http://host.com/scan.ply.gz"),
+              "gz");
+    EXPECT_EQ(io::GetPathExtensionInLowerCase("http://host.com/scan#a.ply"),
+              "");
+    EXPECT_EQ(io::GetPathExtensionInLowerCase("data.d/scan.o3dt"), "o3dt");
+}
+
+TEST(ByteSource, ReadRanges) {
+    const std::string filename = "test_byte_source.bin";
+    std::vector<char> data(100000);
+    std::iota(data.begin(), data.end(), 0);
+    FILE *file = utility::filesystem::FOpen(filename, "wb");
+    ASSERT_NE(file, nullptr);
+    fwrite(data.data(), 1, data.size(), file);
+    fclose(file);
+
+    for (bool map_local : {false, true}) {
+        std::shared_ptr<io::ByteSource> source =
+                io::OpenByteSource(filename, map_local);
+        ASSERT_NE(source, nullptr);
+        EXPECT_EQ(source->GetSize(), int64_t(data.size()));
+        EXPECT_FALSE(source->IsRemote());
+
+        std::vector<char> first(10), last(60000);
+        EXPECT_TRUE(source->ReadRanges({{5, 10, first.data()},
+                                        {40000, 60000, last.data()}}));
+        EXPECT_EQ(first, std::vector<char>(data.begin() + 5,
+                                           data.begin() + 15));
+        EXPECT_EQ(last, std::vector<char>(data.begin() + 40000, data.end()));
+        EXPECT_FALSE(source->Read(99990, 11, first.data()));
+        EXPECT_FALSE(source->Read(-1, 1, first.data()));
+    }
+    EXPECT_EQ(io::OpenByteSource("missing_" + filename), nullptr);
+    EXPECT_EQ(io::OpenByteSource("unknown://" + filename), nullptr);
+    utility::filesystem::RemoveFile(filename);
+}
+
+}  // namespace tests
+}  // namespace open3d
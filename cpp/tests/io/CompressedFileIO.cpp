@@ -0,0 +1,131 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/io/CompressedFileIO.h"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "open3d/utility/FileSystem.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+/// Compressions to test, as extensions.
+static std::vector<std::string> GetCompressions() {
+#ifdef WITH_ZSTD
+    return {"gz", "zst"};
+#else
+    return {"gz"};
+#endif
+}
+
+TEST(CompressedFileIO, GetFileCompression) {
+    EXPECT_EQ(io::GetFileCompression("cloud.xyz.gz"), "gz");
+    EXPECT_EQ(io::GetFileCompression("cloud.PLY.ZST"), "zst");
+    EXPECT_EQ(io::GetFileCompression("cloud.ply"), "");
+}
+
+TEST(CompressedFileIO, WriteReadCompressedFile) {
+    // Spans several parallel compression blocks.
+    std::string text;
+    for (int i = 0; text.size() < (9 << 20); ++i) {
+        text += std::to_string(i) + " " + std::to_string(i + 1) + " " +
+                std::to_string(i + 2) + "\n";
+    }
+    for (const std::string &compression : GetCompressions()) {
+        SCOPED_TRACE(compression);
+        const std::string filename = "test_compressed.xyz." + compression;
+        std::string temporary_path;
+        EXPECT_TRUE(io::WriteCompressedFile(
+                filename, [&](const std::string &path) {
+                    temporary_path = path;
+                    FILE *file = std::fopen(path.c_str(), "wb");
+                    std::fwrite(text.data(), 1, text.size(), file);
+                    return std::fclose(file) == 0;
+                }));
+        EXPECT_EQ(utility::filesystem::GetFileExtensionInLowerCase(
+                          temporary_path),
+                  "xyz");
+        EXPECT_FALSE(utility::filesystem::FileExists(temporary_path));
+
+        std::string read_text;
+        EXPECT_TRUE(io::ReadCompressedFile(
+                filename, [&](const std::string &path) {
+                    temporary_path = path;
+                    read_text.resize(text.size() + 1);
+                    FILE *file = std::fopen(path.c_str(), "rb");
+                    read_text.resize(std::fread(&read_text[0], 1,
+                                                read_text.size(), file));
+                    std::fclose(file);
+                    return true;
+                }));
+        EXPECT_TRUE(read_text == text);
+        EXPECT_FALSE(utility::filesystem::FileExists(temporary_path));
+
+        std::vector<double> rows;
+        EXPECT_TRUE(io::ReadASCIIRowsFromFile(filename, 3, rows, 1, 2));
+        EXPECT_EQ(rows, std::vector<double>({1, 2, 3, 2, 3, 4}));
+        EXPECT_TRUE(io::ReadASCIIRowsFromFile(filename, 3, rows));
+        ASSERT_EQ(rows.size() % 3, 0u);
+        int64_t num_rows = static_cast<int64_t>(rows.size()) / 3;
+        EXPECT_EQ(rows[3 * (num_rows - 1)], num_rows - 1);
+        EXPECT_EQ(rows[3 * num_rows - 1], num_rows + 1);
+        std::remove(filename.c_str());
+    }
+}
+
+TEST(CompressedFileIO, ReadTruncatedFile) {
+    for (const std::string &compression : GetCompressions()) {
+        SCOPED_TRACE(compression);
+        const std::string filename = "test_truncated.xyz." + compression;
+        EXPECT_TRUE(io::WriteCompressedFile(
+                filename, [](const std::string &path) {
+                    FILE *file = std::fopen(path.c_str(), "wb");
+                    for (int i = 0; i < 1000; ++i) {
+                        std::fprintf(file, "%d %d %d\n", i, i * 7, i * 13);
+                    }
+                    return std::fclose(file) == 0;
+                }));
+        std::vector<char> data;
+        EXPECT_TRUE(utility::filesystem::FReadToBuffer(filename, data,
+                                                      nullptr));
+        FILE *file = std::fopen(filename.c_str(), "wb");
+        std::fwrite(data.data(), 1, data.size() / 2, file);
+        std::fclose(file);
+
+        std::vector<double> rows;
+        EXPECT_FALSE(io::ReadASCIIRowsFromFile(filename, 3, rows));
+        EXPECT_FALSE(io::ReadCompressedFile(
+                filename, [](const std::string &path) { return true; }));
+        std::remove(filename.c_str());
+    }
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -24,6 +24,8 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/io/PinholeCameraTrajectoryIO.h"
+
 #include "tests/UnitTest.h"
 
 namespace open3d {
@@ -50,5 +52,35 @@ TEST(PinholeCameraTrajectoryIO, DISABLED_WritePinholeCameraTrajectoryToLOG) {
     NotImplemented();
 }
 
+TEST(PinholeCameraTrajectoryIO, WriteReadO3DTRAJ) {
+    camera::PinholeCameraTrajectory trajectory;
+    for (int i = 0; i < 3; i++) {
+        camera::PinholeCameraParameters parameters;
+        parameters.intrinsic_.SetIntrinsics(640, 480, 525.0 + i, 525.0,
+                                            319.5, 239.5);
+        parameters.extrinsic_ = Eigen::Matrix4d::Identity();
+        parameters.extrinsic_.block<3, 1>(0, 3) = Eigen::Vector3d(i, 0.5, -i);
+        trajectory.parameters_.push_back(parameters);
+    }
+
+    EXPECT_TRUE(io::WritePinholeCameraTrajectory("test.o3dtraj", trajectory));
+    camera::PinholeCameraTrajectory trajectory_read;
+    EXPECT_TRUE(
+            io::ReadPinholeCameraTrajectory("test.o3dtraj", trajectory_read));
+    ASSERT_EQ(trajectory_read.parameters_.size(),
+              trajectory.parameters_.size());
+    for (size_t i = 0; i < trajectory.parameters_.size(); i++) {
+        const auto &parameters = trajectory.parameters_[i];
+        const auto &parameters_read = trajectory_read.parameters_[i];
+        EXPECT_EQ(parameters_read.intrinsic_.width_,
+                  parameters.intrinsic_.width_);
+        EXPECT_EQ(parameters_read.intrinsic_.height_,
+                  parameters.intrinsic_.height_);
+        ExpectEQ(parameters_read.intrinsic_.intrinsic_matrix_,
+                 parameters.intrinsic_.intrinsic_matrix_);
+        ExpectEQ(parameters_read.extrinsic_, parameters.extrinsic_);
+    }
+}
+
 }  // namespace tests
 }  // namespace open3d
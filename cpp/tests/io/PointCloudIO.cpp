@@ -135,6 +135,11 @@ std::vector<ReadWritePCArgs> pcArgs({
                             // test subsets of PTS
         {"testp.pts", IsAscii::BINARY, Compressed::UNCOMPRESSED,
          Compare::NONE},  // 24
+                            // test gzip-compressed files
+        {"testb.ply.gz", IsAscii::BINARY, Compressed::UNCOMPRESSED,
+         Compare::NORMALS_AND_COLORS},  // 25
+        {"test.xyzrgb.gz", IsAscii::BINARY, Compressed::UNCOMPRESSED,
+         Compare::COLORS},  // 26
 });
 
 class ReadWritePC : public testing::TestWithParam<ReadWritePCArgs> {};
@@ -24,6 +24,10 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/io/PoseGraphIO.h"
+
+#include <cstdio>
+
 #include "tests/UnitTest.h"
 
 namespace open3d {
@@ -35,5 +39,45 @@ TEST(PoseGraphIO, DISABLED_ReadPoseGraph) { NotImplemented(); }
 
 TEST(PoseGraphIO, DISABLED_WritePoseGraph) { NotImplemented(); }
 
+TEST(PoseGraphIO, WriteReadO3DPG) {
+    pipelines::registration::PoseGraph pose_graph;
+    for (int i = 0; i < 4; i++) {
+        Eigen::Matrix4d pose = Eigen::Matrix4d::Identity();
+        pose.block<3, 1>(0, 3) = Eigen::Vector3d(i, 2 * i, -i);
+        pose_graph.nodes_.emplace_back(pose);
+    }
+    for (int i = 0; i < 3; i++) {
+        Eigen::Matrix6d information = Eigen::Matrix6d::Random();
+        pose_graph.edges_.emplace_back(i, i + 1,
+                                       pose_graph.nodes_[i + 1].pose_,
+                                       information, i % 2 == 1, 0.25 * i);
+    }
+
+    EXPECT_TRUE(io::WritePoseGraph("test.o3dpg", pose_graph));
+    pipelines::registration::PoseGraph pose_graph_read;
+    EXPECT_TRUE(io::ReadPoseGraph("test.o3dpg", pose_graph_read));
+    ASSERT_EQ(pose_graph_read.nodes_.size(), pose_graph.nodes_.size());
+    ASSERT_EQ(pose_graph_read.edges_.size(), pose_graph.edges_.size());
+    for (size_t i = 0; i < pose_graph.nodes_.size(); i++) {
+        ExpectEQ(pose_graph_read.nodes_[i].pose_, pose_graph.nodes_[i].pose_);
+    }
+    for (size_t i = 0; i < pose_graph.edges_.size(); i++) {
+        const auto &edge = pose_graph.edges_[i];
+        const auto &edge_read = pose_graph_read.edges_[i];
+        EXPECT_EQ(edge_read.source_node_id_, edge.source_node_id_);
+        EXPECT_EQ(edge_read.target_node_id_, edge.target_node_id_);
+        ExpectEQ(edge_read.transformation_, edge.transformation_);
+        ExpectEQ(edge_read.information_, edge.information_);
+        EXPECT_EQ(edge_read.uncertain_, edge.uncertain_);
+        EXPECT_EQ(edge_read.confidence_, edge.confidence_);
+    }
+
+    // Files that do not start with the magic are rejected.
+    FILE *file = fopen("test_invalid.o3dpg", "wb");
+    fputs("not a pose graph", file);
+    fclose(file);
+    EXPECT_FALSE(io::ReadPoseGraph("test_invalid.o3dpg", pose_graph_read));
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -30,10 +30,13 @@
 
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
+#include "open3d/io/rpc/AsyncConnection.h"
 #include "open3d/io/rpc/BufferConnection.h"
 #include "open3d/io/rpc/Connection.h"
 #include "open3d/io/rpc/DummyReceiver.h"
 #include "open3d/io/rpc/MessageUtils.h"
+#include "open3d/io/rpc/Messages.h"
+#include "open3d/io/rpc/SharedMemoryConnection.h"
 #include "tests/UnitTest.h"
 
 using namespace open3d::io::rpc;
@@ -147,6 +150,115 @@ TEST(RemoteFunctions, SendReceiveUnpackMessages) {
     }
 }
 
+/// Receiver keeping the vertices of the last set_mesh_data message.
+class MeshDataReceiver : public DummyReceiver {
+public:
+    MeshDataReceiver(const std::string& address, int timeout)
+        : DummyReceiver(address, timeout) {}
+
+    using DummyReceiver::ProcessMessage;
+    std::shared_ptr<zmq::message_t> ProcessMessage(
+            const messages::Request& req,
+            const messages::SetMeshData& msg,
+            const MsgpackObject& obj) override {
+        // Frames in shared memory are only valid during the call.
+        vertices_ = GetArrayTensor(msg.data.vertices).Copy();
+        is_frame_ = msg.data.vertices.frame >= 0;
+        return CreateStatusOKMsg();
+    }
+
+    core::Tensor vertices_;
+    bool is_frame_ = false;
+};
+
+TEST(RemoteFunctions, SendMeshDataFrames) {
+    // Small arrays are inlined, large arrays are sent as extra frames.
+    for (int64_t num_vertices : {10, 100000}) {
+        MeshDataReceiver receiver(connection_address, 500);
+        receiver.Start();
+
+        core::Tensor vertices =
+                core::Tensor::Arange(0, num_vertices * 3, 1,
+                                     core::Dtype::Float32)
+                        .Reshape({num_vertices, 3});
+        core::Tensor empty({0}, core::Dtype::Int32);
+        auto connection =
+                std::make_shared<Connection>(connection_address, 500, 500);
+        ASSERT_TRUE(SetMeshData(vertices, "", 0, "", {}, empty, {}, empty, {},
+                                {}, connection));
+        receiver.Stop();
+
+        EXPECT_EQ(receiver.is_frame_, num_vertices == 100000);
+        EXPECT_TRUE(receiver.vertices_.AllClose(vertices, 0, 0));
+    }
+}
+
+TEST(RemoteFunctions, SendMeshDataUpdates) {
+    DummyReceiver receiver(connection_address, 500);
+    receiver.Start();
+
+    auto connection =
+            std::make_shared<Connection>(connection_address, 500, 500);
+    core::Tensor points = core::Tensor::Ones({100, 3}, core::Dtype::Float32);
+    core::Tensor colors = core::Tensor::Zeros({100, 3}, core::Dtype::Float32);
+    ASSERT_TRUE(AppendMeshData(points, "points", 0, "", {{"colors", colors}},
+                               core::Tensor({0}, core::Dtype::Int32),
+                               connection));
+    ASSERT_TRUE(SetVertexAttributeRange("colors", colors.Slice(0, 0, 10), 5,
+                                        "points", 0, "", connection));
+    core::Tensor indices = core::Tensor::Init<int64_t>({0, 1, 2});
+    ASSERT_TRUE(RemoveVertices(indices, "points", 0, "", connection));
+
+    receiver.Stop();
+}
+
+TEST(RemoteFunctions, SharedMemoryConnection) {
+    MeshDataReceiver receiver(connection_address, 500);
+    receiver.Start();
+
+    auto connection = std::make_shared<SharedMemoryConnection>(
+            connection_address, 500, 500);
+    core::Tensor empty({0}, core::Dtype::Int32);
+    // The segment is reused and grows with the frames.
+    for (int64_t num_vertices : {100000, 50000, 1000000}) {
+        core::Tensor vertices =
+                core::Tensor::Arange(0, num_vertices * 3, 1,
+                                     core::Dtype::Float32)
+                        .Reshape({num_vertices, 3});
+        ASSERT_TRUE(SetMeshData(vertices, "", 0, "", {}, empty, {}, empty, {},
+                                {}, connection));
+        EXPECT_TRUE(receiver.is_frame_);
+        EXPECT_TRUE(receiver.vertices_.AllClose(vertices, 0, 0));
+    }
+    receiver.Stop();
+}
+
+TEST(RemoteFunctions, AsyncConnection) {
+    {
+        DummyReceiver receiver(connection_address, 500);
+        receiver.Start();
+
+        // More messages than can be in flight are queued.
+        auto connection = std::make_shared<AsyncConnection>(connection_address,
+                                                            500, 500, 2);
+        for (int time = 0; time < 10; ++time) {
+            ASSERT_TRUE(SetTime(time, connection));
+        }
+        connection->Flush();
+        receiver.Stop();
+    }
+    {
+        // Without a receiver, the oldest queued messages are dropped instead
+        // of blocking, and the messages in flight fail after the timeout.
+        auto connection = std::make_shared<AsyncConnection>(connection_address,
+                                                            100, 100, 1, true);
+        for (int time = 0; time < 10; ++time) {
+            ASSERT_TRUE(SetTime(time, connection));
+        }
+        connection->Flush();
+    }
+}
+
 TEST(RemoteFunctions, SendGarbage) {
     std::mt19937 rng;
     rng.seed(123);
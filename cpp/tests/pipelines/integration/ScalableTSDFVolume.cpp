@@ -24,6 +24,15 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/pipelines/integration/ScalableTSDFVolume.h"
+
+#include <set>
+#include <tuple>
+
+#include "open3d/camera/PinholeCameraIntrinsic.h"
+#include "open3d/geometry/RGBDImage.h"
+#include "open3d/geometry/TriangleMesh.h"
+#include "open3d/utility/Parallel.h"
 #include "tests/UnitTest.h"
 
 namespace open3d {
@@ -39,11 +48,73 @@ TEST(ScalableTSDFVolume, DISABLED_MemberData) { NotImplemented(); }
 
 TEST(ScalableTSDFVolume, DISABLED_Reset) { NotImplemented(); }
 
-TEST(ScalableTSDFVolume, DISABLED_Integrate) { NotImplemented(); }
+TEST(ScalableTSDFVolume, Integrate) {
+    const int width = 64, height = 48;
+    camera::PinholeCameraIntrinsic intrinsic(width, height, 60, 60, 32, 24);
+    geometry::RGBDImage rgbd;
+    rgbd.depth_.Prepare(width, height, 1, 4);
+    for (int v = 0; v < height; v++) {
+        for (int u = 0; u < width; u++) {
+            *rgbd.depth_.PointerAt<float>(u, v) = 1.0f;
+        }
+    }
+
+    // The plane spans many volume units, integrated in parallel.
+    pipelines::integration::ScalableTSDFVolume volume(
+            0.01, 0.04, pipelines::integration::TSDFVolumeColorType::NoColor,
+            8);
+    for (int i = 0; i < 4; i++) {
+        volume.Integrate(rgbd, intrinsic, Eigen::Matrix4d::Identity());
+    }
+
+    auto pcd = volume.ExtractPointCloud();
+    ASSERT_GT(pcd->points_.size(), 0u);
+    for (const auto &point : pcd->points_) {
+        EXPECT_NEAR(point(2), 1.0, 1e-3);
+    }
+}
 
 TEST(ScalableTSDFVolume, DISABLED_ExtractPointCloud) { NotImplemented(); }
 
-TEST(ScalableTSDFVolume, DISABLED_ExtractTriangleMesh) { NotImplemented(); }
+TEST(ScalableTSDFVolume, ExtractTriangleMesh) {
+    const int width = 64, height = 48;
+    camera::PinholeCameraIntrinsic intrinsic(width, height, 60, 60, 32, 24);
+    geometry::RGBDImage rgbd;
+    rgbd.depth_.Prepare(width, height, 1, 4);
+    for (int v = 0; v < height; v++) {
+        for (int u = 0; u < width; u++) {
+            *rgbd.depth_.PointerAt<float>(u, v) = 1.0f;
+        }
+    }
+    pipelines::integration::ScalableTSDFVolume volume(
+            0.01, 0.04, pipelines::integration::TSDFVolumeColorType::NoColor,
+            8);
+    for (int i = 0; i < 4; i++) {
+        volume.Integrate(rgbd, intrinsic, Eigen::Matrix4d::Identity());
+    }
+
+    auto mesh = volume.ExtractTriangleMesh();
+    ASSERT_GT(mesh->triangles_.size(), 0u);
+    for (const auto &point : mesh->vertices_) {
+        EXPECT_NEAR(point(2), 1.0, 1e-3);
+    }
+    // Vertices on the border of volume units are shared, not duplicated.
+    std::set<std::tuple<double, double, double>> unique_vertices;
+    for (const auto &point : mesh->vertices_) {
+        unique_vertices.emplace(point(0), point(1), point(2));
+    }
+    EXPECT_EQ(unique_vertices.size(), mesh->vertices_.size());
+    for (const auto &triangle : mesh->triangles_) {
+        EXPECT_TRUE((triangle.array() >= 0).all());
+        EXPECT_TRUE((triangle.array() < int(mesh->vertices_.size())).all());
+    }
+
+    // The output does not depend on the number of threads.
+    utility::ScopedMaxThreads single_thread(1);
+    auto mesh_single_thread = volume.ExtractTriangleMesh();
+    EXPECT_EQ(mesh_single_thread->vertices_, mesh->vertices_);
+    EXPECT_EQ(mesh_single_thread->triangles_, mesh->triangles_);
+}
 
 TEST(ScalableTSDFVolume, DISABLED_ExtractVoxelPointCloud) { NotImplemented(); }
 
@@ -24,6 +24,12 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/pipelines/odometry/Odometry.h"
+
+#include <cmath>
+
+#include "open3d/geometry/Image.h"
+#include "open3d/geometry/RGBDImage.h"
 #include "tests/UnitTest.h"
 
 namespace open3d {
@@ -39,5 +45,55 @@ TEST(Odometry, DISABLED_RGBDOdometryJacobianFromHybridTerm) {
 
 TEST(Odometry, DISABLED_OdometryOption) { NotImplemented(); }
 
+// A textured bumpy surface seen by a 64x64 camera, shifted by shift pixels
+// along the columns.
+static geometry::RGBDImage SyntheticRGBDImage(double shift) {
+    geometry::Image color, depth;
+    color.Prepare(64, 64, 1, 4);
+    depth.Prepare(64, 64, 1, 4);
+    for (int v = 0; v < 64; v++) {
+        for (int u = 0; u < 64; u++) {
+            double x = u + shift;
+            *color.PointerAt<float>(u, v) =
+                    float(0.5 + 0.4 * std::sin(x / 3.0) * std::cos(v / 4.0));
+            *depth.PointerAt<float>(u, v) =
+                    float(1.0 + 0.1 * std::sin(x / 6.0) +
+                          0.1 * std::cos(v / 5.0));
+        }
+    }
+    return geometry::RGBDImage(color, depth);
+}
+
+TEST(Odometry, RGBDOdometryTracker) {
+    camera::PinholeCameraIntrinsic intrinsic(64, 64, 60, 60, 32, 32);
+    std::vector<geometry::RGBDImage> frames{SyntheticRGBDImage(0.0),
+                                            SyntheticRGBDImage(0.5),
+                                            SyntheticRGBDImage(1.0)};
+
+    pipelines::odometry::RGBDOdometryTracker tracker(intrinsic);
+    EXPECT_FALSE(tracker.HasPreviousFrame());
+    EXPECT_FALSE(std::get<0>(tracker.Track(frames[0])));
+    EXPECT_TRUE(tracker.HasPreviousFrame());
+
+    // The tracker gives the results of the pairwise odometry.
+    for (size_t i = 1; i < frames.size(); i++) {
+        bool success, expected_success;
+        Eigen::Matrix4d transformation, expected_transformation;
+        Eigen::Matrix6d information, expected_information;
+        std::tie(success, transformation, information) =
+                tracker.Track(frames[i]);
+        std::tie(expected_success, expected_transformation,
+                 expected_information) =
+                pipelines::odometry::ComputeRGBDOdometry(
+                        frames[i - 1], frames[i], intrinsic);
+        EXPECT_EQ(success, expected_success);
+        ExpectEQ(transformation, expected_transformation);
+        ExpectEQ(information, expected_information);
+    }
+
+    tracker.Reset();
+    EXPECT_FALSE(tracker.HasPreviousFrame());
+}
+
 }  // namespace tests
 }  // namespace open3d
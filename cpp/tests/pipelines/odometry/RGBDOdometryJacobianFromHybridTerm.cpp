@@ -129,5 +129,51 @@ TEST(RGBDOdometryJacobianFromHybridTerm, ComputeJacobianAndResidual) {
     }
 }
 
+TEST(RGBDOdometryJacobianFromHybridTerm, ComputeJTJandJTr) {
+    int width = 10;
+    int height = 10;
+
+    auto srcColor = GenerateImage(width, height, 1, 4, 0.0f, 1.0f, 1);
+    auto srcDepth = GenerateImage(width, height, 1, 4, 0.0f, 1.0f, 0);
+    auto tgtColor = GenerateImage(width, height, 1, 4, 0.0f, 1.0f, 2);
+    auto tgtDepth = GenerateImage(width, height, 1, 4, 1.0f, 2.0f, 3);
+    auto dxColor = GenerateImage(width, height, 1, 4, 0.0f, 1.0f, 4);
+    auto dyColor = GenerateImage(width, height, 1, 4, 0.0f, 1.0f, 5);
+
+    geometry::RGBDImage source(*srcColor, *srcDepth);
+    geometry::RGBDImage target(*tgtColor, *tgtDepth);
+    auto source_xyz = GenerateImage(width, height, 3, 4, 0.0f, 1.0f, 0);
+    geometry::RGBDImage target_dx(*dxColor, *tgtDepth);
+    geometry::RGBDImage target_dy(*dyColor, *tgtDepth);
+
+    Eigen::Matrix3d intrinsic = Eigen::Matrix3d::Zero();
+    intrinsic(0, 0) = 0.5;
+    intrinsic(1, 1) = 0.65;
+    intrinsic(0, 2) = 0.75;
+    intrinsic(1, 2) = 0.35;
+    Eigen::Matrix4d extrinsic = Eigen::Matrix4d::Identity();
+    extrinsic(2, 3) = 1.0;
+
+    // More correspondences than a block, with a partial last block.
+    std::vector<Eigen::Vector4i, utility::Vector4i_allocator> corresps(150);
+    Rand(corresps, 0, 9, 0);
+
+    // The batched evaluation matches the accumulation of the rows.
+    pipelines::odometry::RGBDOdometryJacobianFromHybridTerm jacobian_method;
+    Eigen::Matrix6d JTJ, ref_JTJ;
+    Eigen::Vector6d JTr, ref_JTr;
+    double r2, ref_r2;
+    std::tie(JTJ, JTr, r2) = jacobian_method.ComputeJTJandJTr(
+            source, target, *source_xyz, target_dx, target_dy, intrinsic,
+            extrinsic, corresps);
+    std::tie(ref_JTJ, ref_JTr, ref_r2) =
+            jacobian_method.RGBDOdometryJacobian::ComputeJTJandJTr(
+                    source, target, *source_xyz, target_dx, target_dy,
+                    intrinsic, extrinsic, corresps);
+    ExpectEQ(JTJ, ref_JTJ, 1e-8);
+    ExpectEQ(JTr, ref_JTr, 1e-8);
+    EXPECT_NEAR(r2, ref_r2, 1e-8);
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -0,0 +1,182 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/pipelines/registration/BatchRegistration.h"
+
+#include <Eigen/Geometry>
+#include <cmath>
+
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/pipelines/registration/PoseGraph.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+// Points of a 21 x 21 grid on a curved surface, such that ICP has a unique
+// solution.
+static geometry::PointCloud BatchRegistrationSurface() {
+    geometry::PointCloud pcd;
+    for (int x = 0; x <= 20; x++) {
+        for (int y = 0; y <= 20; y++) {
+            double u = x * 0.05, v = y * 0.05;
+            pcd.points_.push_back(Eigen::Vector3d(
+                    u, v, 0.2 * std::sin(3 * u) * std::cos(2 * v)));
+        }
+    }
+    return pcd;
+}
+
+// Pose of point cloud i, close enough to the others for ICP to converge.
+static Eigen::Matrix4d BatchRegistrationPose(int i) {
+    Eigen::Matrix4d pose = Eigen::Matrix4d::Identity();
+    pose.block<3, 3>(0, 0) =
+            Eigen::AngleAxisd(0.02 * i, Eigen::Vector3d(0, 0, 1))
+                    .toRotationMatrix();
+    pose.block<3, 1>(0, 3) = Eigen::Vector3d(0.01 * i, -0.005 * i, 0.0);
+    return pose;
+}
+
+static std::vector<std::shared_ptr<geometry::PointCloud>>
+BatchRegistrationPointClouds(int n) {
+    std::vector<std::shared_ptr<geometry::PointCloud>> point_clouds;
+    for (int i = 0; i < n; i++) {
+        auto pcd = std::make_shared<geometry::PointCloud>(
+                BatchRegistrationSurface());
+        pcd->Transform(BatchRegistrationPose(i));
+        point_clouds.push_back(pcd);
+    }
+    return point_clouds;
+}
+
+TEST(BatchRegistration, RegistrationICPBatch) {
+    auto point_clouds = BatchRegistrationPointClouds(4);
+    std::vector<std::pair<int, int>> pairs = {{0, 1}, {1, 2}, {2, 3}, {0, 2}};
+    pipelines::registration::ICPConvergenceCriteria criteria(1e-10, 1e-10,
+                                                             100);
+
+    for (const pipelines::registration::BatchRegistrationOption &option :
+         {pipelines::registration::BatchRegistrationOption(1, 1),
+          pipelines::registration::BatchRegistrationOption(0, 1),
+          pipelines::registration::BatchRegistrationOption(2, 2)}) {
+        std::vector<pipelines::registration::RegistrationResult> results =
+                pipelines::registration::RegistrationICPBatch(
+                        point_clouds, pairs, 0.05, {},
+                        pipelines::registration::
+                                TransformationEstimationPointToPoint(false),
+                        criteria, option);
+        ASSERT_EQ(results.size(), pairs.size());
+        for (size_t i = 0; i < pairs.size(); i++) {
+            const geometry::PointCloud &source = *point_clouds[pairs[i].first];
+            const geometry::PointCloud &target =
+                    *point_clouds[pairs[i].second];
+            pipelines::registration::RegistrationResult expected =
+                    pipelines::registration::RegistrationICP(
+                            source, target, 0.05, Eigen::Matrix4d::Identity(),
+                            pipelines::registration::
+                                    TransformationEstimationPointToPoint(false),
+                            criteria);
+            ExpectEQ(Eigen::Matrix4d(results[i].transformation_),
+                     Eigen::Matrix4d(expected.transformation_));
+            EXPECT_EQ(results[i].fitness_, expected.fitness_);
+            EXPECT_EQ(results[i].inlier_rmse_, expected.inlier_rmse_);
+            ExpectEQ(Eigen::Matrix4d(results[i].transformation_),
+                     Eigen::Matrix4d(BatchRegistrationPose(pairs[i].second) *
+                                     BatchRegistrationPose(pairs[i].first)
+                                             .inverse()),
+                     1e-4);
+        }
+    }
+
+    // Initial transformations.
+    std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator> inits;
+    for (const std::pair<int, int> &pair : pairs) {
+        inits.push_back(BatchRegistrationPose(pair.second) *
+                        BatchRegistrationPose(pair.first).inverse());
+    }
+    std::vector<pipelines::registration::RegistrationResult> results =
+            pipelines::registration::RegistrationICPBatch(
+                    point_clouds, pairs, 0.005, inits,
+                    pipelines::registration::
+                            TransformationEstimationPointToPoint(false),
+                    criteria);
+    for (size_t i = 0; i < pairs.size(); i++) {
+        EXPECT_NEAR(results[i].fitness_, 1.0, 1e-12);
+        ExpectEQ(Eigen::Matrix4d(results[i].transformation_), inits[i], 1e-6);
+    }
+
+    // Invalid arguments.
+    EXPECT_ANY_THROW(pipelines::registration::RegistrationICPBatch(
+            point_clouds, {{0, 4}}, 0.05));
+    EXPECT_ANY_THROW(pipelines::registration::RegistrationICPBatch(
+            point_clouds, {{-1, 0}}, 0.05));
+    EXPECT_ANY_THROW(pipelines::registration::RegistrationICPBatch(
+            point_clouds, pairs, 0.05, {Eigen::Matrix4d::Identity()}));
+}
+
+TEST(BatchRegistration, CreatePoseGraphFromPairwiseICP) {
+    auto point_clouds = BatchRegistrationPointClouds(3);
+    std::vector<std::pair<int, int>> pairs = {{0, 1}, {1, 2}, {0, 2}};
+    auto pose_graph =
+            pipelines::registration::CreatePoseGraphFromPairwiseICP(
+                    point_clouds, pairs, 0.05,
+                    pipelines::registration::
+                            TransformationEstimationPointToPoint(false),
+                    pipelines::registration::ICPConvergenceCriteria(
+                            1e-10, 1e-10, 100),
+                    pipelines::registration::BatchRegistrationOption(2, 1));
+
+    ASSERT_EQ(pose_graph->nodes_.size(), 3u);
+    ASSERT_EQ(pose_graph->edges_.size(), 3u);
+    for (size_t i = 0; i < pairs.size(); i++) {
+        const pipelines::registration::PoseGraphEdge &edge =
+                pose_graph->edges_[i];
+        EXPECT_EQ(edge.source_node_id_, pairs[i].first);
+        EXPECT_EQ(edge.target_node_id_, pairs[i].second);
+        // Only (0, 2) is a loop closure.
+        EXPECT_EQ(edge.uncertain_, i == 2);
+        ExpectEQ(Eigen::Matrix4d(edge.transformation_),
+                 Eigen::Matrix4d(BatchRegistrationPose(pairs[i].second) *
+                                 BatchRegistrationPose(pairs[i].first)
+                                         .inverse()),
+                 1e-4);
+        ExpectEQ(Eigen::Matrix6d(edge.information_),
+                 pipelines::registration::GetInformationMatrixFromPointClouds(
+                         *point_clouds[pairs[i].first],
+                         *point_clouds[pairs[i].second], 0.05,
+                         edge.transformation_));
+    }
+    // The nodes follow the odometry edges from the first point cloud.
+    for (int i = 0; i < 3; i++) {
+        ExpectEQ(Eigen::Matrix4d(pose_graph->nodes_[i].pose_),
+                 Eigen::Matrix4d(BatchRegistrationPose(0) *
+                                 BatchRegistrationPose(i).inverse()),
+                 1e-4);
+    }
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -24,6 +24,11 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/pipelines/registration/CorrespondenceChecker.h"
+
+#include <random>
+
+#include "open3d/geometry/PointCloud.h"
 #include "tests/UnitTest.h"
 
 namespace open3d {
@@ -37,6 +42,87 @@ TEST(CorrespondenceChecker, DISABLED_MemberData) { NotImplemented(); }
 
 TEST(CorrespondenceChecker, DISABLED_Check) { NotImplemented(); }
 
+TEST(CorrespondenceChecker, CheckBatch) {
+    // Target is the source under a rigid motion with noise, so that checks
+    // with the motion pass and checks with perturbed motions or wrong
+    // correspondences mostly fail.
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+    std::normal_distribution<double> noise(0.0, 0.01);
+    Eigen::Matrix4d motion = Eigen::Matrix4d::Identity();
+    motion.block<3, 3>(0, 0) =
+            Eigen::AngleAxisd(0.3, Eigen::Vector3d(1, 2, 3).normalized())
+                    .toRotationMatrix();
+    motion.block<3, 1>(0, 3) = Eigen::Vector3d(0.5, -0.2, 0.1);
+    geometry::PointCloud source, target;
+    for (int i = 0; i < 50; i++) {
+        Eigen::Vector3d p(uniform(rng), uniform(rng), uniform(rng));
+        Eigen::Vector3d n =
+                Eigen::Vector3d(uniform(rng), uniform(rng), uniform(rng))
+                        .normalized();
+        source.points_.push_back(p);
+        source.normals_.push_back(n);
+        target.points_.push_back(motion.block<3, 3>(0, 0) * p +
+                                 motion.block<3, 1>(0, 3) +
+                                 Eigen::Vector3d(noise(rng), noise(rng),
+                                                 noise(rng)));
+        target.normals_.push_back(
+                (motion.block<3, 3>(0, 0) * n +
+                 Eigen::Vector3d(noise(rng), noise(rng), noise(rng)))
+                        .normalized());
+    }
+
+    const int num_hypotheses = 200;
+    const int ransac_n = 4;
+    std::uniform_int_distribution<int> index(0, 49);
+    pipelines::registration::CorrespondenceSet corres;
+    std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator> transformations;
+    for (int h = 0; h < num_hypotheses; h++) {
+        for (int k = 0; k < ransac_n; k++) {
+            int i = index(rng);
+            corres.push_back(Eigen::Vector2i(
+                    i, h % 3 == 0 && k == 0 ? index(rng) : i));
+        }
+        Eigen::Matrix4d transformation = motion;
+        if (h % 5 == 0) {
+            transformation.block<3, 1>(0, 3) +=
+                    Eigen::Vector3d(uniform(rng), uniform(rng), uniform(rng)) *
+                    0.1;
+        }
+        transformations.push_back(transformation);
+    }
+
+    pipelines::registration::CorrespondenceCheckerBasedOnEdgeLength
+            edge_length(0.9);
+    pipelines::registration::CorrespondenceCheckerBasedOnDistance distance(
+            0.075);
+    pipelines::registration::CorrespondenceCheckerBasedOnNormal normal(0.1);
+    for (const pipelines::registration::CorrespondenceChecker *checker :
+         std::vector<const pipelines::registration::CorrespondenceChecker *>{
+                 &edge_length, &distance, &normal}) {
+        // Hypotheses masked out on input are not checked.
+        std::vector<uint8_t> mask(num_hypotheses, 1);
+        for (int h = 0; h < num_hypotheses; h += 7) {
+            mask[h] = 0;
+        }
+        checker->CheckBatch(source, target, corres, transformations, mask);
+
+        int num_passed = 0;
+        for (int h = 0; h < num_hypotheses; h++) {
+            pipelines::registration::CorrespondenceSet hypothesis(
+                    corres.begin() + h * ransac_n,
+                    corres.begin() + (h + 1) * ransac_n);
+            bool expected = h % 7 != 0 && checker->Check(source, target,
+                                                         hypothesis,
+                                                         transformations[h]);
+            EXPECT_EQ(bool(mask[h]), expected);
+            num_passed += expected;
+        }
+        EXPECT_GT(num_passed, 0);
+        EXPECT_LT(num_passed, num_hypotheses);
+    }
+}
+
 TEST(CorrespondenceChecker, DISABLED_CorrespondenceCheckerBasedOnEdgeLength) {
     NotImplemented();
 }
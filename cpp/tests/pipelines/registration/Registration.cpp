@@ -24,6 +24,9 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/pipelines/registration/Registration.h"
+
+#include "open3d/geometry/PointCloud.h"
 #include "tests/UnitTest.h"
 
 namespace open3d {
@@ -41,9 +44,74 @@ TEST(Registration, DISABLED_RANSACConvergenceCriteria) { NotImplemented(); }
 
 TEST(Registration, DISABLED_RegistrationResult) { NotImplemented(); }
 
-TEST(Registration, DISABLED_EvaluateRegistration) { NotImplemented(); }
+// Points of a 10 x 10 x 2 grid with a spacing of 0.1.
+static geometry::PointCloud RegistrationGrid() {
+    geometry::PointCloud pcd;
+    for (int x = 0; x < 10; x++) {
+        for (int y = 0; y < 10; y++) {
+            for (int z = 0; z < 2; z++) {
+                pcd.points_.push_back(Eigen::Vector3d(x, y, z) * 0.1);
+            }
+        }
+    }
+    return pcd;
+}
+
+TEST(Registration, EvaluateRegistration) {
+    geometry::PointCloud target = RegistrationGrid();
+    geometry::PointCloud source = target;
+    source.Translate(Eigen::Vector3d(0.01, 0, 0));
+    // Points beyond the max correspondence distance.
+    source.points_.push_back(Eigen::Vector3d(5, 5, 5));
+    source.points_.push_back(Eigen::Vector3d(-5, -5, -5));
+
+    auto result =
+            pipelines::registration::EvaluateRegistration(source, target, 0.03);
+    EXPECT_EQ(result.correspondence_set_.size(), 200u);
+    EXPECT_NEAR(result.fitness_, 200.0 / 202.0, 1e-12);
+    EXPECT_NEAR(result.inlier_rmse_, 0.01, 1e-9);
+    for (size_t i = 0; i < result.correspondence_set_.size(); i++) {
+        EXPECT_EQ(result.correspondence_set_[i](0), int(i));
+        EXPECT_EQ(result.correspondence_set_[i](1), int(i));
+    }
+
+    result = pipelines::registration::EvaluateRegistration(source, target,
+                                                           0.005);
+    EXPECT_TRUE(result.correspondence_set_.empty());
+    EXPECT_EQ(result.fitness_, 0.0);
+    EXPECT_EQ(result.inlier_rmse_, 0.0);
+}
 
-TEST(Registration, DISABLED_RegistrationICP) { NotImplemented(); }
+TEST(Registration, RegistrationICP) {
+    geometry::PointCloud target = RegistrationGrid();
+    geometry::PointCloud source = target;
+    source.Translate(Eigen::Vector3d(0.02, -0.01, 0.01));
+
+    auto result =
+            pipelines::registration::RegistrationICP(source, target, 0.05);
+    Eigen::Matrix4d expected = Eigen::Matrix4d::Identity();
+    expected.block<3, 1>(0, 3) = Eigen::Vector3d(-0.02, 0.01, -0.01);
+    ExpectEQ(Eigen::Matrix4d(result.transformation_), expected, 1e-6);
+    EXPECT_NEAR(result.fitness_, 1.0, 1e-12);
+    EXPECT_NEAR(result.inlier_rmse_, 0.0, 1e-6);
+}
+
+TEST(Registration, RegistrationICPFloat32) {
+    geometry::PointCloud target = RegistrationGrid();
+    geometry::PointCloud source = target;
+    source.Translate(Eigen::Vector3d(0.02, -0.01, 0.01));
+
+    auto result = pipelines::registration::RegistrationICP(
+            source, target, 0.05, Eigen::Matrix4d::Identity(),
+            pipelines::registration::TransformationEstimationPointToPoint(),
+            pipelines::registration::ICPConvergenceCriteria(),
+            geometry::KDTreeFlann::Precision::Float32);
+    Eigen::Matrix4d expected = Eigen::Matrix4d::Identity();
+    expected.block<3, 1>(0, 3) = Eigen::Vector3d(-0.02, 0.01, -0.01);
+    ExpectEQ(Eigen::Matrix4d(result.transformation_), expected, 1e-6);
+    EXPECT_NEAR(result.fitness_, 1.0, 1e-12);
+    EXPECT_NEAR(result.inlier_rmse_, 0.0, 1e-6);
+}
 
 TEST(Registration, DISABLED_TransformationEstimationPointToPoint) {
     NotImplemented();
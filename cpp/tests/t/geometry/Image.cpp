@@ -26,6 +26,9 @@
 
 #include "open3d/t/geometry/Image.h"
 
+#include <cmath>
+#include <tuple>
+
 #include "core/CoreTest.h"
 #include "open3d/core/TensorList.h"
 #include "tests/UnitTest.h"
@@ -152,5 +155,271 @@ TEST_P(ImagePermuteDevices, ToLegacyImage) {
                           *leg_im_3ch.PointerAt<uint16_t>(c, r, ch));
 }
 
+TEST_P(ImagePermuteDevices, To) {
+    core::Device device = GetParam();
+    t::geometry::Image im_uint8(core::Tensor(std::vector<uint8_t>{0, 51, 255},
+                                             {1, 3}, core::Dtype::UInt8,
+                                             device));
+
+    // UInt8 values are scaled to [0, 1] by default, and back.
+    t::geometry::Image im_float = im_uint8.To(core::Dtype::Float32);
+    EXPECT_EQ(im_float.GetDtype(), core::Dtype::Float32);
+    EXPECT_TRUE(im_float.AsTensor().AllClose(core::Tensor(
+            std::vector<float>{0, 0.2f, 1}, {1, 3, 1}, core::Dtype::Float32,
+            device)));
+    EXPECT_TRUE(im_float.To(core::Dtype::UInt8)
+                        .AsTensor()
+                        .AllClose(im_uint8.AsTensor()));
+
+    // Integer results are rounded and saturated.
+    t::geometry::Image im_saturated =
+            t::geometry::Image(core::Tensor(std::vector<float>{-1, 0.5f, 2},
+                                            {1, 3}, core::Dtype::Float32,
+                                            device))
+                    .To(core::Dtype::UInt8, false, 100.0, 10.0);
+    EXPECT_EQ(im_saturated.AsTensor().ToFlatVector<uint8_t>(),
+              std::vector<uint8_t>({0, 60, 210}));
+
+    // The identity conversion shares the memory unless copy is set.
+    EXPECT_TRUE(im_uint8.To(core::Dtype::UInt8).AsTensor().IsSame(
+            im_uint8.AsTensor()));
+    EXPECT_FALSE(im_uint8.To(core::Dtype::UInt8, true)
+                         .AsTensor()
+                         .IsSame(im_uint8.AsTensor()));
+    EXPECT_ANY_THROW(im_uint8.To(core::Dtype::Int32));
+}
+
+TEST_P(ImagePermuteDevices, ClipTransform) {
+    core::Device device = GetParam();
+    t::geometry::Image depth(
+            core::Tensor(std::vector<uint16_t>{0, 500, 1000, 4000}, {2, 2},
+                         core::Dtype::UInt16, device));
+
+    t::geometry::Image depth_float = depth.ClipTransform(1000.0f, 0.0f, 3.0f);
+    EXPECT_EQ(depth_float.GetDtype(), core::Dtype::Float32);
+    EXPECT_EQ(depth_float.AsTensor().ToFlatVector<float>(),
+              std::vector<float>({0.0f, 0.5f, 1.0f, 0.0f}));
+
+    depth_float = depth.ClipTransform(1000.0f, 0.6f, 5.0f, -1.0f);
+    EXPECT_EQ(depth_float.AsTensor().ToFlatVector<float>(),
+              std::vector<float>({-1.0f, -1.0f, 1.0f, 4.0f}));
+}
+
+TEST_P(ImagePermuteDevices, Filter) {
+    core::Device device = GetParam();
+
+    // A 3x3 box filter spreads a single bright pixel over its neighbors.
+    std::vector<float> vals(25, 0.0f);
+    vals[12] = 9.0f;
+    t::geometry::Image im(
+            core::Tensor(vals, {5, 5}, core::Dtype::Float32, device));
+    core::Tensor box =
+            core::Tensor::Ones({3, 3}, core::Dtype::Float32, device).Div(9.0f);
+    core::Tensor filtered = im.Filter(box).AsTensor();
+    EXPECT_TRUE(filtered.Slice(0, 1, 4).Slice(1, 1, 4).AllClose(
+            core::Tensor::Ones({3, 3, 1}, core::Dtype::Float32, device)));
+    EXPECT_NEAR(filtered.Sum({0, 1, 2}).Item<float>(), 9.0f, 1e-5);
+
+    // The separable Gaussian filter matches the 2D filter of its outer
+    // product.
+    std::vector<float> weights{std::exp(-0.5f), 1.0f, std::exp(-0.5f)};
+    float sum = weights[0] + weights[1] + weights[2];
+    std::vector<float> kernel_vals;
+    for (float wy : weights) {
+        for (float wx : weights) {
+            kernel_vals.push_back(wy * wx / (sum * sum));
+        }
+    }
+    core::Tensor gaussian(kernel_vals, {3, 3}, core::Dtype::Float32, device);
+    EXPECT_TRUE(im.FilterGaussian(3, 1.0f).AsTensor().AllClose(
+            im.Filter(gaussian).AsTensor(), 1e-5, 1e-6));
+
+    // Integer images are rounded, and constant images are unchanged.
+    t::geometry::Image im_const(core::Tensor::Full({4, 6, 3}, 100,
+                                                   core::Dtype::UInt8, device));
+    EXPECT_TRUE(im_const.FilterGaussian(5, 2.0f).AsTensor().AllClose(
+            im_const.AsTensor()));
+    EXPECT_TRUE(im_const.FilterBilateral(5, 10.0f, 3.0f).AsTensor().AllClose(
+            im_const.AsTensor()));
+
+    EXPECT_ANY_THROW(im.Filter(core::Tensor::Ones({2, 3}, core::Dtype::Float32,
+                                                  device)));
+    EXPECT_ANY_THROW(im.FilterGaussian(4));
+}
+
+TEST_P(ImagePermuteDevices, FilterBilateral) {
+    core::Device device = GetParam();
+
+    // A step edge is kept by a small value sigma, and blurred by a large one.
+    std::vector<uint8_t> vals(36);
+    for (int r = 0; r < 6; ++r) {
+        for (int c = 0; c < 6; ++c) {
+            vals[r * 6 + c] = c < 3 ? 0 : 200;
+        }
+    }
+    t::geometry::Image im(
+            core::Tensor(vals, {6, 6}, core::Dtype::UInt8, device));
+    EXPECT_TRUE(im.FilterBilateral(3, 5.0f, 10.0f).AsTensor().AllClose(
+            im.AsTensor()));
+    t::geometry::Image blurred = im.FilterBilateral(3, 1000.0f, 10.0f);
+    EXPECT_GT(blurred.At(2, 2).Item<uint8_t>(), 0);
+    EXPECT_LT(blurred.At(2, 3).Item<uint8_t>(), 200);
+}
+
+TEST_P(ImagePermuteDevices, FilterSobel) {
+    core::Device device = GetParam();
+
+    // Horizontal ramp: the gradient is constant along the columns away from
+    // the left and right borders, and zero along the rows.
+    std::vector<float> vals(20);
+    for (int r = 0; r < 4; ++r) {
+        for (int c = 0; c < 5; ++c) {
+            vals[r * 5 + c] = static_cast<float>(c);
+        }
+    }
+    t::geometry::Image im(
+            core::Tensor(vals, {4, 5}, core::Dtype::Float32, device));
+    t::geometry::Image dx, dy;
+    std::tie(dx, dy) = im.FilterSobel(3);
+    EXPECT_TRUE(dx.AsTensor().Slice(1, 1, 4).AllClose(core::Tensor::Full(
+            {4, 3, 1}, 8.0f, core::Dtype::Float32, device)));
+    EXPECT_TRUE(dy.AsTensor().AllClose(
+            core::Tensor::Zeros({4, 5, 1}, core::Dtype::Float32, device)));
+
+    std::tie(dx, dy) = im.To(core::Dtype::UInt8, false, 1.0).FilterSobel(5);
+    EXPECT_EQ(dx.GetDtype(), core::Dtype::Float32);
+    EXPECT_NEAR(dx.At(1, 2).Item<float>(), 128.0f, 1e-5);
+
+    EXPECT_ANY_THROW(im.FilterSobel(7));
+}
+
+TEST_P(ImagePermuteDevices, PyrDown) {
+    core::Device device = GetParam();
+    t::geometry::Image im(core::Tensor::Full({5, 7, 3}, 1000,
+                                             core::Dtype::UInt16, device));
+    t::geometry::Image im_down = im.PyrDown();
+    EXPECT_EQ(im_down.GetRows(), 3);
+    EXPECT_EQ(im_down.GetCols(), 4);
+    EXPECT_EQ(im_down.GetChannels(), 3);
+    EXPECT_TRUE(im_down.AsTensor().AllClose(core::Tensor::Full(
+            {3, 4, 3}, 1000, core::Dtype::UInt16, device)));
+}
+
+TEST_P(ImagePermuteDevices, PyrDownDepth) {
+    core::Device device = GetParam();
+
+    // Two depth planes at 1 and 2 meters, and an invalid pixel.
+    std::vector<float> vals(64);
+    for (int r = 0; r < 8; ++r) {
+        for (int c = 0; c < 8; ++c) {
+            vals[r * 8 + c] = c < 4 ? 1.0f : 2.0f;
+        }
+    }
+    vals[2 * 8 + 2] = 0.0f;
+    t::geometry::Image depth(
+            core::Tensor(vals, {8, 8}, core::Dtype::Float32, device));
+
+    core::Tensor depth_down = depth.PyrDownDepth(0.5f, -1.0f).AsTensor();
+    EXPECT_EQ(depth_down.GetShape(), core::SizeVector({4, 4, 1}));
+    std::vector<float> ref(16);
+    for (int r = 0; r < 4; ++r) {
+        for (int c = 0; c < 4; ++c) {
+            ref[r * 4 + c] = c < 2 ? 1.0f : 2.0f;
+        }
+    }
+    ref[1 * 4 + 1] = -1.0f;
+    EXPECT_TRUE(depth_down.AllClose(
+            core::Tensor(ref, {4, 4, 1}, core::Dtype::Float32, device)));
+
+    EXPECT_ANY_THROW(t::geometry::Image(core::Tensor::Zeros(
+                                                {8, 8}, core::Dtype::UInt16,
+                                                device))
+                             .PyrDownDepth(0.5f));
+}
+
+TEST_P(ImagePermuteDevices, FilterBilateralDepth) {
+    core::Device device = GetParam();
+
+    // Two depth planes next to a hole: the hole stays invalid, and the valid
+    // depths are neither blurred across the edge nor towards the hole.
+    std::vector<uint16_t> vals(36);
+    for (int r = 0; r < 6; ++r) {
+        for (int c = 0; c < 6; ++c) {
+            vals[r * 6 + c] = c < 3 ? 1000 : 2000;
+        }
+    }
+    vals[2 * 6 + 1] = 0;
+    t::geometry::Image depth(
+            core::Tensor(vals, {6, 6}, core::Dtype::UInt16, device));
+    EXPECT_TRUE(depth.FilterBilateralDepth(3, 20.0f, 3.0f)
+                        .AsTensor()
+                        .AllClose(depth.AsTensor()));
+
+    EXPECT_ANY_THROW(depth.FilterBilateralDepth(4));
+    EXPECT_ANY_THROW(t::geometry::Image(core::Tensor::Zeros(
+                                                {6, 6}, core::Dtype::UInt8,
+                                                device))
+                             .FilterBilateralDepth());
+}
+
+TEST_P(ImagePermuteDevices, RegisterDepth) {
+    core::Device device = GetParam();
+
+    std::vector<uint16_t> vals(24, 1000);
+    vals[1 * 6 + 2] = 500;
+    t::geometry::Image depth(
+            core::Tensor(vals, {4, 6}, core::Dtype::UInt16, device));
+    core::Tensor intrinsic(std::vector<float>{2, 0, 2.5, 0, 2, 1.5, 0, 0, 1},
+                           {3, 3}, core::Dtype::Float32);
+    core::Tensor extrinsic = core::Tensor::Eye(4, core::Dtype::Float32,
+                                               core::Device("CPU:0"));
+
+    // The same camera reproduces the depth image.
+    t::geometry::Image registered =
+            depth.RegisterDepth(intrinsic, intrinsic, extrinsic, 4, 6);
+    EXPECT_TRUE(registered.AsTensor().AllClose(depth.AsTensor()));
+
+    // Moving the camera by 0.5 m to the left moves the pixels at 1 m by one
+    // column to the right, and leaves the first column without depth.
+    extrinsic[0][3] = 0.5f;
+    registered = depth.RegisterDepth(intrinsic, intrinsic, extrinsic, 4, 6);
+    for (int64_t r = 0; r < 4; ++r) {
+        EXPECT_EQ(registered.At(r, 0).Item<uint16_t>(), 0);
+        EXPECT_EQ(registered.At(r, 1).Item<uint16_t>(), 1000);
+    }
+
+    EXPECT_ANY_THROW(
+            depth.RegisterDepth(intrinsic, intrinsic, extrinsic, 0, 6));
+}
+
+TEST_P(ImagePermuteDevices, Resize) {
+    core::Device device = GetParam();
+    t::geometry::Image im(core::Tensor(
+            std::vector<float>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13,
+                               14, 15},
+            {4, 4}, core::Dtype::Float32, device));
+
+    t::geometry::Image im_nearest = im.Resize(0.5f);
+    EXPECT_EQ(im_nearest.AsTensor().ToFlatVector<float>(),
+              std::vector<float>({0, 2, 8, 10}));
+
+    // Downsampling by two averages each 2x2 block.
+    t::geometry::Image im_linear =
+            im.Resize(0.5f, t::geometry::Image::InterpType::Linear);
+    EXPECT_TRUE(im_linear.AsTensor().AllClose(
+            core::Tensor(std::vector<float>{2.5f, 4.5f, 10.5f, 12.5f},
+                         {2, 2, 1}, core::Dtype::Float32, device)));
+
+    t::geometry::Image im_up =
+            im.Resize(2.0f, t::geometry::Image::InterpType::Linear);
+    EXPECT_EQ(im_up.GetRows(), 8);
+    EXPECT_EQ(im_up.GetCols(), 8);
+    EXPECT_NEAR(im_up.At(0, 0).Item<float>(), 0.0f, 1e-5);
+    EXPECT_NEAR(im_up.At(1, 1).Item<float>(), 1.25f, 1e-5);
+    EXPECT_NEAR(im_up.At(7, 7).Item<float>(), 15.0f, 1e-5);
+
+    EXPECT_ANY_THROW(im.Resize(0.1f));
+}
+
 }  // namespace tests
 }  // namespace open3d
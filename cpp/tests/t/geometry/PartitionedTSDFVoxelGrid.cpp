@@ -0,0 +1,122 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/PartitionedTSDFVoxelGrid.h"
+
+#include <set>
+#include <tuple>
+
+#include "core/CoreTest.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/TSDFVoxelGrid.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+class PartitionedTSDFVoxelGridPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(PartitionedTSDFVoxelGrid,
+                         PartitionedTSDFVoxelGridPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(PartitionedTSDFVoxelGridPermuteDevices, ExtractSurfaceMesh) {
+    core::Device device = GetParam();
+
+    std::unordered_map<std::string, core::Dtype> attr_dtype_map = {
+            {"tsdf", core::Dtype::Float32},
+            {"weight", core::Dtype::UInt16},
+            {"color", core::Dtype::UInt16}};
+    float voxel_size = 0.01;
+    t::geometry::TSDFVoxelGrid voxel_grid(attr_dtype_map, voxel_size, 0.04f,
+                                          16, 1000, device);
+    // Tiles of one block, so that every block borders other partitions.
+    t::geometry::PartitionedTSDFVoxelGrid partitioned_grid(
+            {device, device, device}, attr_dtype_map, voxel_size, 0.04f, 16,
+            1000, 1);
+    EXPECT_EQ(partitioned_grid.GetPartitionCount(), 3);
+
+    // A tilted plane spanning several blocks.
+    const int64_t rows = 48, cols = 64;
+    core::Tensor depth_tensor({rows, cols, 1}, core::Dtype::UInt16, device);
+    for (int64_t c = 0; c < cols; ++c) {
+        depth_tensor.Slice(1, c, c + 1) = core::Tensor::Full(
+                {rows, 1, 1}, 1005 + 3 * c, core::Dtype::UInt16, device);
+    }
+    t::geometry::Image depth(depth_tensor);
+    t::geometry::Image color(core::Tensor::Full({rows, cols, 3}, 128,
+                                                core::Dtype::UInt8, device));
+    core::Tensor intrinsics(std::vector<float>{60, 0, 32, 0, 60, 24, 0, 0, 1},
+                            {3, 3}, core::Dtype::Float32);
+    core::Tensor extrinsics = core::Tensor::Eye(4, core::Dtype::Float32,
+                                                core::Device("CPU:0"));
+    for (int i = 0; i < 4; ++i) {
+        voxel_grid.Integrate(depth, color, intrinsics, extrinsics);
+        partitioned_grid.Integrate(depth, color, intrinsics, extrinsics);
+    }
+
+    // Each block is allocated by exactly one partition.
+    EXPECT_EQ(partitioned_grid.GetActiveBlockCount(),
+              voxel_grid.GetActiveBlockCount());
+    for (int64_t i = 0; i < partitioned_grid.GetPartitionCount(); ++i) {
+        EXPECT_GT(partitioned_grid.GetPartition(i).GetActiveBlockCount(), 0);
+    }
+
+    // The stitched mesh has the triangles of the single grid, and its
+    // vertices at distinct positions.
+    t::geometry::TriangleMesh mesh = voxel_grid.ExtractSurfaceMesh();
+    t::geometry::TriangleMesh stitched_mesh =
+            partitioned_grid.ExtractSurfaceMesh();
+    ASSERT_GT(mesh.GetTriangles().GetLength(), 0);
+    core::Tensor vertices = mesh.GetVertices().Copy(core::Device("CPU:0"));
+    std::set<std::tuple<float, float, float>> positions;
+    for (int64_t i = 0; i < vertices.GetLength(); ++i) {
+        positions.emplace(vertices[i][0].Item<float>(),
+                          vertices[i][1].Item<float>(),
+                          vertices[i][2].Item<float>());
+    }
+    EXPECT_EQ(stitched_mesh.GetVertices().GetLength(),
+              static_cast<int64_t>(positions.size()));
+    EXPECT_EQ(stitched_mesh.GetTriangles().GetLength(),
+              mesh.GetTriangles().GetLength());
+    EXPECT_TRUE(stitched_mesh.HasVertexNormals());
+    EXPECT_TRUE(stitched_mesh.HasVertexColors());
+
+    auto CornerSum = [](const t::geometry::TriangleMesh& mesh) {
+        return mesh.GetVertices()
+                .IndexGet({mesh.GetTriangles().Reshape({-1})})
+                .To(core::Dtype::Float64)
+                .Sum({0})
+                .Copy(core::Device("CPU:0"));
+    };
+    EXPECT_TRUE(CornerSum(stitched_mesh).AllClose(CornerSum(mesh), 1e-6, 1e-4));
+
+    // Extraction leaves the partitions unchanged.
+    EXPECT_EQ(partitioned_grid.GetActiveBlockCount(),
+              voxel_grid.GetActiveBlockCount());
+}
+
+}  // namespace tests
+}  // namespace open3d
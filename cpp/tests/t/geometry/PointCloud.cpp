@@ -26,8 +26,15 @@
 
 #include "open3d/t/geometry/PointCloud.h"
 
+#include <algorithm>
+#include <numeric>
+
 #include "core/CoreTest.h"
+#include "open3d/core/EigenConverter.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/geometry/Keypoint.h"
+#include "open3d/geometry/TriangleMesh.h"
+#include "open3d/io/PointCloudIO.h"
 #include "tests/UnitTest.h"
 
 namespace open3d {
@@ -115,6 +122,11 @@ TEST_P(PointCloudPermuteDevices, GetMinBound_GetMaxBound_GetCenter) {
               std::vector<float>({4, 5, 6}));
     EXPECT_EQ(pcd.GetCenter().ToFlatVector<float>(),
               std::vector<float>({2.5, 3.5, 4.5}));
+
+    core::Tensor min_bound, max_bound;
+    std::tie(min_bound, max_bound) = pcd.GetMinMaxBound();
+    EXPECT_EQ(min_bound.ToFlatVector<float>(), std::vector<float>({1, 2, 3}));
+    EXPECT_EQ(max_bound.ToFlatVector<float>(), std::vector<float>({4, 5, 6}));
 }
 
 TEST_P(PointCloudPermuteDevicePairs, CopyDevice) {
@@ -141,6 +153,32 @@ TEST_P(PointCloudPermuteDevicePairs, CopyDevice) {
     EXPECT_EQ(pcd_copy.GetPoints().GetDtype(), pcd.GetPoints().GetDtype());
 }
 
+TEST_P(PointCloudPermuteDevices, Append) {
+    core::Device device = GetParam();
+    core::Dtype dtype = core::Dtype::Float32;
+
+    t::geometry::PointCloud frame(device);
+    frame.SetPoints(core::Tensor::Ones({2, 3}, dtype, device));
+    frame.SetPointColors(core::Tensor::Ones({2, 3}, dtype, device) * 2);
+
+    t::geometry::PointCloud map(device);
+    for (int i = 0; i < 10; ++i) {
+        map.Append(frame);
+    }
+    EXPECT_EQ(map.GetPoints().GetShape(), core::SizeVector({20, 3}));
+    EXPECT_TRUE(map.GetPointColors().AllClose(
+            core::Tensor::Ones({20, 3}, dtype, device) * 2));
+    EXPECT_TRUE(map.HasPointColors());
+
+    map.Shrink();
+    EXPECT_TRUE(map.GetPoints().AllClose(
+            core::Tensor::Ones({20, 3}, dtype, device)));
+
+    // Attributes must match.
+    frame.SetPointNormals(core::Tensor::Ones({2, 3}, dtype, device));
+    EXPECT_ANY_THROW(map.Append(frame));
+}
+
 TEST_P(PointCloudPermuteDevices, Copy) {
     core::Device device = GetParam();
     core::Dtype dtype = core::Dtype::Float32;
@@ -191,6 +229,43 @@ TEST_P(PointCloudPermuteDevices, Transform) {
               std::vector<float>({2, 2, 1}));
 }
 
+TEST_P(PointCloudPermuteDevices, BatchTransform) {
+    core::Device device = GetParam();
+    core::Dtype dtype = core::Dtype::Float64;
+    core::Tensor transformations(
+            std::vector<double>{0, -1, 0, 1, 1, 0, 0, 2, 0, 0, 1, 3, 0, 0, 0, 1,
+                                1, 0, 0, 5, 0, 0, -1, 6, 0, 1, 0, 7, 0, 0, 0, 1,
+                                2, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 0, 0, 0, 1},
+            {3, 4, 4}, dtype, device);
+
+    // Clouds of different sizes, with and without normals, and an empty one.
+    std::vector<t::geometry::PointCloud> pcds;
+    pcds.emplace_back(core::Tensor::Init<double>(
+            {{1, 0, 0}, {0, 1, 0}, {0, 0, 1}}, device));
+    pcds.back().SetPointNormals(core::Tensor::Init<double>(
+            {{0, 0, 1}, {0, 0, 1}, {1, 0, 0}}, device));
+    pcds.emplace_back(core::Tensor::Init<double>({{1, 2, 3}}, device));
+    pcds.emplace_back(core::Tensor::Empty({0, 3}, dtype, device));
+    std::vector<t::geometry::PointCloud> expected;
+    for (size_t i = 0; i < pcds.size(); ++i) {
+        expected.push_back(pcds[i].Copy());
+        expected.back().Transform(transformations[i]);
+    }
+
+    t::geometry::PointCloud::BatchTransform(pcds, transformations);
+    EXPECT_TRUE(pcds[0].GetPoints().AllClose(core::Tensor::Init<double>(
+            {{1, 3, 3}, {0, 2, 3}, {1, 2, 4}}, device)));
+    EXPECT_TRUE(pcds[0].GetPointNormals().AllClose(core::Tensor::Init<double>(
+            {{0, 0, 1}, {0, 0, 1}, {0, 1, 0}}, device)));
+    EXPECT_TRUE(pcds[1].GetPoints().AllClose(
+            core::Tensor::Init<double>({{6, 3, 9}}, device)));
+    for (size_t i = 0; i < pcds.size(); ++i) {
+        EXPECT_TRUE(pcds[i].GetPoints().AllClose(expected[i].GetPoints()));
+    }
+    EXPECT_TRUE(pcds[0].GetPointNormals().AllClose(
+            expected[0].GetPointNormals()));
+}
+
 TEST_P(PointCloudPermuteDevices, Translate) {
     core::Device device = GetParam();
     t::geometry::PointCloud pcd(device);
@@ -241,6 +316,7 @@ TEST_P(PointCloudPermuteDevices, Rotate) {
             core::Tensor(std::vector<float>{1, 1, 1}, {1, 3}, dtype, device));
 
     pcd.Rotate(rotation, center);
+    EXPECT_TRUE(pcd.GetPoints().IsContiguous());
     EXPECT_EQ(pcd.GetPoints().ToFlatVector<float>(),
               std::vector<float>({3, 3, 2}));
     EXPECT_EQ(pcd.GetPointNormals().ToFlatVector<float>(),
@@ -304,6 +380,55 @@ TEST_P(PointCloudPermuteDevices, ToLegacyPointCloud) {
                                           Eigen::Vector3d(2, 2, 2)});
 }
 
+TEST(PointCloud, LegacyPointCloudView) {
+    auto legacy_pcd = std::make_shared<geometry::PointCloud>();
+    legacy_pcd->points_ = std::vector<Eigen::Vector3d>{
+            Eigen::Vector3d(0, 1, 2), Eigen::Vector3d(3, 4, 5)};
+    legacy_pcd->normals_ = std::vector<Eigen::Vector3d>{
+            Eigen::Vector3d(0, 0, 1), Eigen::Vector3d(0, 1, 0)};
+    std::weak_ptr<geometry::PointCloud> weak_legacy_pcd = legacy_pcd;
+
+    t::geometry::PointCloud pcd =
+            t::geometry::PointCloud::FromLegacyPointCloudView(legacy_pcd);
+    EXPECT_TRUE(pcd.HasPoints());
+    EXPECT_FALSE(pcd.HasPointColors());
+    EXPECT_TRUE(pcd.HasPointNormals());
+    EXPECT_EQ(pcd.GetPoints().GetDtype(), core::Dtype::Float64);
+    EXPECT_EQ(pcd.GetPoints().GetDataPtr(), legacy_pcd->points_.data());
+    EXPECT_EQ(pcd.GetPointNormals().GetDataPtr(), legacy_pcd->normals_.data());
+    EXPECT_EQ(pcd.GetPoints().ToFlatVector<double>(),
+              std::vector<double>({0, 1, 2, 3, 4, 5}));
+
+    // Writes are shared in both directions.
+    pcd.GetPoints()[0][0] = 10.0;
+    EXPECT_EQ(legacy_pcd->points_[0](0), 10.0);
+    legacy_pcd->normals_[1](2) = 2.0;
+    EXPECT_EQ(pcd.GetPointNormals()[1][2].Item<double>(), 2.0);
+    EXPECT_EQ(pcd.ToLegacyPointCloudView(), legacy_pcd);
+
+    // The tensors keep the legacy PointCloud alive.
+    legacy_pcd.reset();
+    EXPECT_FALSE(weak_legacy_pcd.expired());
+    std::shared_ptr<geometry::PointCloud> legacy_view =
+            pcd.ToLegacyPointCloudView();
+    EXPECT_EQ(legacy_view, weak_legacy_pcd.lock());
+    legacy_view.reset();
+
+    // Once an attribute no longer views the legacy PointCloud, it is copied.
+    pcd.SetPointNormals(core::Tensor::Ones({2, 3}, core::Dtype::Float32));
+    legacy_view = pcd.ToLegacyPointCloudView();
+    EXPECT_NE(legacy_view, weak_legacy_pcd.lock());
+    ExpectEQ(legacy_view->points_,
+             std::vector<Eigen::Vector3d>{Eigen::Vector3d(10, 1, 2),
+                                          Eigen::Vector3d(3, 4, 5)});
+    ExpectEQ(legacy_view->normals_,
+             std::vector<Eigen::Vector3d>{Eigen::Vector3d(1, 1, 1),
+                                          Eigen::Vector3d(1, 1, 1)});
+
+    pcd.Clear();
+    EXPECT_TRUE(weak_legacy_pcd.expired());
+}
+
 TEST_P(PointCloudPermuteDevices, Getters) {
     core::Device device = GetParam();
     core::Dtype dtype = core::Dtype::Float32;
@@ -389,5 +514,584 @@ TEST_P(PointCloudPermuteDevices, Has) {
     EXPECT_TRUE(pcd.HasPointColors());
 }
 
+TEST_P(PointCloudPermuteDevices, EstimateNormals) {
+    core::Device device = GetParam();
+
+    for (core::Dtype dtype : {core::Dtype::Float32, core::Dtype::Float64}) {
+        // Fibonacci sphere of radius 1 around the origin.
+        const int64_t n = 500;
+        std::vector<double> points_data;
+        for (int64_t i = 0; i < n; i++) {
+            double z = 1 - 2 * (i + 0.5) / n;
+            double r = std::sqrt(1 - z * z);
+            double phi = i * M_PI * (3 - std::sqrt(5.0));
+            points_data.insert(points_data.end(),
+                               {r * std::cos(phi), r * std::sin(phi), z});
+        }
+        core::Tensor points =
+                core::Tensor(points_data, {n, 3}, core::Dtype::Float64, device)
+                        .To(dtype);
+        t::geometry::PointCloud pcd(points);
+
+        pcd.EstimateNormals(10);
+        EXPECT_EQ(pcd.GetPointNormals().GetShape(), points.GetShape());
+        EXPECT_EQ(pcd.GetPointNormals().GetDtype(), dtype);
+
+        // Oriented towards the center, the normals point inwards.
+        pcd.OrientNormalsTowardsCameraLocation(
+                core::Tensor::Zeros({3}, core::Dtype::Float32, device));
+        std::vector<double> normals = pcd.GetPointNormals()
+                                              .To(core::Dtype::Float64)
+                                              .ToFlatVector<double>();
+        for (int64_t i = 0; i < n; i++) {
+            double dot = 0, norm = 0;
+            for (int64_t j = 0; j < 3; j++) {
+                dot -= normals[3 * i + j] * points_data[3 * i + j];
+                norm += normals[3 * i + j] * normals[3 * i + j];
+            }
+            EXPECT_NEAR(norm, 1.0, 1e-4);
+            EXPECT_GT(dot, 0.99);
+        }
+
+        // Estimating again keeps the orientation of the existing normals.
+        pcd.EstimateNormals(10, 0.5);
+        EXPECT_TRUE(pcd.GetPointNormals().AllClose(
+                core::Tensor(normals, {n, 3}, core::Dtype::Float64, device)
+                        .To(dtype),
+                1e-3, 1e-3));
+
+        // With too few neighbors in the radius, the normals are (0, 0, 1).
+        t::geometry::PointCloud sparse_pcd(points);
+        sparse_pcd.EstimateNormals(10, 1e-3);
+        EXPECT_TRUE(sparse_pcd.GetPointNormals().AllClose(
+                core::Tensor::Zeros({n, 3}, dtype, device)
+                        .Add(core::Tensor(std::vector<double>{0, 0, 1}, {1, 3},
+                                          core::Dtype::Float64, device)
+                                     .To(dtype))));
+
+        EXPECT_ANY_THROW(pcd.EstimateNormals(2));
+        EXPECT_ANY_THROW(pcd.EstimateNormals(10, 0.0));
+    }
+}
+
+TEST_P(PointCloudPermuteDevices, OrientNormalsConsistentTangentPlane) {
+    core::Device device = GetParam();
+
+    // Fibonacci sphere of radius 1 around the origin, with radial normals
+    // flipped every other point.
+    const int64_t n = 500;
+    std::vector<double> points_data, normals_data;
+    for (int64_t i = 0; i < n; i++) {
+        double z = 1 - 2 * (i + 0.5) / n;
+        double r = std::sqrt(1 - z * z);
+        double phi = i * M_PI * (3 - std::sqrt(5.0));
+        double sign = i % 2 == 0 ? 1 : -1;
+        points_data.insert(points_data.end(),
+                           {r * std::cos(phi), r * std::sin(phi), z});
+        normals_data.insert(normals_data.end(), {sign * r * std::cos(phi),
+                                                 sign * r * std::sin(phi),
+                                                 sign * z});
+    }
+    t::geometry::PointCloud pcd(
+            core::Tensor(points_data, {n, 3}, core::Dtype::Float64, device));
+    pcd.SetPointNormals(
+            core::Tensor(normals_data, {n, 3}, core::Dtype::Float64, device)
+                    .To(core::Dtype::Float32));
+
+    // The top point is oriented towards +z, so all normals point outwards.
+    pcd.OrientNormalsConsistentTangentPlane(10);
+    EXPECT_EQ(pcd.GetPointNormals().GetDtype(), core::Dtype::Float32);
+    EXPECT_EQ(pcd.GetPointNormals().GetDevice(), device);
+    std::vector<float> normals = pcd.GetPointNormals().ToFlatVector<float>();
+    for (int64_t i = 0; i < n; i++) {
+        double dot = 0;
+        for (int64_t j = 0; j < 3; j++) {
+            dot += normals[3 * i + j] * points_data[3 * i + j];
+        }
+        EXPECT_GT(dot, 0.99);
+    }
+}
+
+TEST_P(PointCloudPermuteDevices, VoxelDownSample) {
+    core::Device device = GetParam();
+
+    t::geometry::PointCloud pcd(device);
+    pcd.SetPoints(core::Tensor(std::vector<float>{0.1, 0.1, 0.1, 1.5, 0.5, 0.5,
+                                                  -0.5, -0.5, -0.5, 0.2, 0.2,
+                                                  0.2, 1.7, 0.3, 0.5},
+                               {5, 3}, core::Dtype::Float32, device));
+    pcd.SetPointColors(core::Tensor(
+            std::vector<double>{0.0, 0.2, 0.4, 0.6, 0.8, 1.0, 0.5, 0.5, 0.5,
+                                0.2, 0.4, 0.6, 0.4, 0.2, 0.0},
+            {5, 3}, core::Dtype::Float64, device));
+    pcd.SetPointAttr("labels",
+                     core::Tensor(std::vector<int32_t>{2, 4, 6, 8, 10}, {5},
+                                  core::Dtype::Int32, device));
+
+    t::geometry::PointCloud pcd_down = pcd.VoxelDownSample(1.0);
+    EXPECT_EQ(pcd_down.GetDevice(), device);
+    ASSERT_EQ(pcd_down.GetPoints().GetLength(), 3);
+
+    // The order of the voxels is unspecified, sort them by x.
+    std::vector<float> points = pcd_down.GetPoints().ToFlatVector<float>();
+    std::vector<double> colors =
+            pcd_down.GetPointColors().ToFlatVector<double>();
+    std::vector<int32_t> labels =
+            pcd_down.GetPointAttr("labels").ToFlatVector<int32_t>();
+    std::vector<int> order = {0, 1, 2};
+    std::sort(order.begin(), order.end(),
+              [&](int a, int b) { return points[3 * a] < points[3 * b]; });
+
+    std::vector<float> ref_points = {-0.5, -0.5, -0.5, 0.15, 0.15,
+                                     0.15, 1.6,  0.4,  0.5};
+    std::vector<double> ref_colors = {0.5, 0.5, 0.5, 0.1, 0.3,
+                                      0.5, 0.5, 0.5, 0.5};
+    std::vector<int32_t> ref_labels = {6, 5, 7};
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            EXPECT_NEAR(points[3 * order[i] + j], ref_points[3 * i + j], 1e-6);
+            EXPECT_NEAR(colors[3 * order[i] + j], ref_colors[3 * i + j],
+                        1e-12);
+        }
+        EXPECT_EQ(labels[order[i]], ref_labels[i]);
+    }
+
+    EXPECT_ANY_THROW(pcd.VoxelDownSample(0.0));
+}
+
+// A 3x3x3 grid with spacing 0.1, followed by the outlier (5, 5, 5).
+static t::geometry::PointCloud GridWithOutlier(const core::Device &device) {
+    std::vector<float> points;
+    for (int i = 0; i < 27; i++) {
+        points.push_back(0.1 * (i % 3));
+        points.push_back(0.1 * (i / 3 % 3));
+        points.push_back(0.1 * (i / 9));
+    }
+    points.insert(points.end(), {5.0, 5.0, 5.0});
+    t::geometry::PointCloud pcd(
+            core::Tensor(points, {28, 3}, core::Dtype::Float32, device));
+    pcd.SetPointColors(
+            core::Tensor::Ones({28, 3}, core::Dtype::Float32, device));
+    return pcd;
+}
+
+TEST_P(PointCloudPermuteDevices, SelectAndCrop) {
+    core::Device device = GetParam();
+    t::geometry::PointCloud pcd = GridWithOutlier(device);
+    pcd.SetPointNormals(core::Tensor::Arange(0, 84, 1, core::Dtype::Float32,
+                                             device)
+                                .Reshape({28, 3}));
+    geometry::PointCloud pcd_legacy = pcd.ToLegacyPointCloud();
+
+    auto ExpectSame = [&](const t::geometry::PointCloud &selected,
+                          const geometry::PointCloud &reference) {
+        EXPECT_EQ(selected.GetDevice(), device);
+        geometry::PointCloud legacy = selected.ToLegacyPointCloud();
+        ExpectEQ(legacy.points_, reference.points_);
+        ExpectEQ(legacy.colors_, reference.colors_);
+        ExpectEQ(legacy.normals_, reference.normals_);
+    };
+
+    std::vector<size_t> indices = {27, 3, 5, 3, 0};
+    core::Tensor indices_tensor(
+            std::vector<int64_t>(indices.begin(), indices.end()), {5},
+            core::Dtype::Int64, device);
+    ExpectSame(pcd.SelectByIndex(indices_tensor),
+               *pcd_legacy.SelectByIndex(indices));
+    ExpectSame(pcd.SelectByIndex(indices_tensor, true),
+               *pcd_legacy.SelectByIndex(indices, true));
+    EXPECT_ANY_THROW(pcd.SelectByIndex(core::Tensor(
+            std::vector<int64_t>{28}, {1}, core::Dtype::Int64, device)));
+
+    core::Tensor mask = pcd.GetPoints().T()[0].Gt(0.05);
+    EXPECT_EQ(pcd.SelectByMask(mask).GetPoints().GetLength(), 19);
+    EXPECT_EQ(pcd.SelectByMask(mask, true).GetPoints().GetLength(), 9);
+
+    geometry::AxisAlignedBoundingBox aabb(Eigen::Vector3d(0, 0, 0),
+                                          Eigen::Vector3d(0.1, 0.2, 0.1));
+    ExpectSame(pcd.Crop(aabb), *pcd_legacy.Crop(aabb));
+    geometry::OrientedBoundingBox obb(
+            Eigen::Vector3d(0.1, 0.1, 0.1),
+            geometry::OrientedBoundingBox::GetRotationMatrixFromXYZ(
+                    Eigen::Vector3d(0.3, 0.2, 0.1)),
+            Eigen::Vector3d(0.25, 0.15, 0.3));
+    ExpectSame(pcd.Crop(obb), *pcd_legacy.Crop(obb));
+}
+
+TEST_P(PointCloudPermuteDevices, RemoveRadiusOutliers) {
+    core::Device device = GetParam();
+    t::geometry::PointCloud pcd = GridWithOutlier(device);
+
+    // The corners of the grid have 3 neighbors within the radius.
+    t::geometry::PointCloud pcd_clean;
+    core::Tensor mask;
+    std::tie(pcd_clean, mask) = pcd.RemoveRadiusOutliers(3, 0.11);
+    std::vector<bool> ref_mask(28, true);
+    ref_mask[27] = false;
+    EXPECT_EQ(mask.GetDevice(), device);
+    EXPECT_EQ(mask.GetDtype(), core::Dtype::Bool);
+    EXPECT_EQ(mask.ToFlatVector<bool>(), ref_mask);
+    EXPECT_TRUE(pcd_clean.GetPoints().AllClose(
+            pcd.GetPoints().Slice(0, 0, 27)));
+    EXPECT_EQ(pcd_clean.GetPointColors().GetLength(), 27);
+
+    // Asking for one more neighbor removes the corners.
+    std::tie(pcd_clean, mask) = pcd.RemoveRadiusOutliers(4, 0.11);
+    EXPECT_EQ(pcd_clean.GetPoints().GetLength(), 27 - 8);
+
+    EXPECT_ANY_THROW(pcd.RemoveRadiusOutliers(0, 0.11));
+    EXPECT_ANY_THROW(pcd.RemoveRadiusOutliers(3, 0.0));
+}
+
+TEST_P(PointCloudPermuteDevices, RemoveStatisticalOutliers) {
+    core::Device device = GetParam();
+    t::geometry::PointCloud pcd = GridWithOutlier(device);
+
+    t::geometry::PointCloud pcd_clean;
+    core::Tensor mask;
+    std::tie(pcd_clean, mask) = pcd.RemoveStatisticalOutliers(4, 1.0);
+    std::vector<bool> ref_mask(28, true);
+    ref_mask[27] = false;
+    EXPECT_EQ(mask.GetDevice(), device);
+    EXPECT_EQ(mask.ToFlatVector<bool>(), ref_mask);
+    EXPECT_TRUE(pcd_clean.GetPoints().AllClose(
+            pcd.GetPoints().Slice(0, 0, 27)));
+    EXPECT_EQ(pcd_clean.GetPointColors().GetLength(), 27);
+
+    EXPECT_ANY_THROW(pcd.RemoveStatisticalOutliers(0, 1.0));
+    EXPECT_ANY_THROW(pcd.RemoveStatisticalOutliers(4, 0.0));
+}
+
+TEST_P(PointCloudPermuteDevices, ComputeISSKeypoints) {
+    core::Device device = GetParam();
+    geometry::PointCloud pcd_legacy;
+    io::ReadPointCloud(std::string(TEST_DATA_DIR) + "/bathtub_0154.ply",
+                       pcd_legacy);
+    ASSERT_GT(pcd_legacy.points_.size(), 0u);
+    t::geometry::PointCloud pcd = t::geometry::PointCloud::FromLegacyPointCloud(
+            pcd_legacy, core::Dtype::Float64, device);
+
+    // Same keypoints as the legacy implementation, up to the points on the
+    // boundaries of the search radii.
+    // Radii from the model resolution, and a non-maximum suppression radius
+    // larger than the salient one.
+    for (double non_max_radius : {0.0, 9000.0}) {
+        double salient_radius = non_max_radius == 0.0 ? 0.0 : 6000.0;
+        auto keypoints_legacy = geometry::keypoint::ComputeISSKeypoints(
+                pcd_legacy, salient_radius, non_max_radius);
+        t::geometry::PointCloud keypoints;
+        core::Tensor mask;
+        std::tie(keypoints, mask) =
+                pcd.ComputeISSKeypoints(salient_radius, non_max_radius);
+        EXPECT_EQ(mask.GetDevice(), device);
+        EXPECT_EQ(mask.GetLength(), pcd.GetPoints().GetLength());
+        EXPECT_EQ(keypoints.GetPoints().GetLength(),
+                  mask.To(core::Dtype::Int64).Sum({0}).Item<int64_t>());
+
+        int64_t num_keypoints = keypoints.GetPoints().GetLength();
+        int64_t num_keypoints_legacy = keypoints_legacy->points_.size();
+        EXPECT_GT(num_keypoints_legacy, 0);
+        EXPECT_LE(std::abs(num_keypoints - num_keypoints_legacy),
+                  std::max<int64_t>(1, num_keypoints_legacy / 20));
+    }
+
+    t::geometry::PointCloud empty(device);
+    empty.SetPoints(core::Tensor::Empty({0, 3}, core::Dtype::Float32, device));
+    EXPECT_EQ(std::get<0>(empty.ComputeISSKeypoints()).GetPoints().GetLength(),
+              0);
+}
+
+TEST_P(PointCloudPermuteDevices, ComputePointCloudDistance) {
+    core::Device device = GetParam();
+
+    t::geometry::PointCloud source(
+            core::Tensor(std::vector<float>{0, 0, 0, 1, 0, 0, 0, 3, 0}, {3, 3},
+                         core::Dtype::Float32, device));
+    t::geometry::PointCloud target(
+            core::Tensor(std::vector<float>{0, 0, 1, 1, 0.5, 0}, {2, 3},
+                         core::Dtype::Float32, device));
+
+    core::Tensor distances = source.ComputePointCloudDistance(target);
+    EXPECT_EQ(distances.GetDevice(), device);
+    EXPECT_TRUE(distances.AllClose(
+            core::Tensor(std::vector<float>{1, 0.5, std::sqrt(7.25f)}, {3},
+                         core::Dtype::Float32, device)));
+
+    // The distances match the legacy PointCloud.
+    geometry::PointCloud source_legacy = source.ToLegacyPointCloud();
+    std::vector<double> distances_legacy =
+            source_legacy.ComputePointCloudDistance(
+                    target.ToLegacyPointCloud());
+    EXPECT_TRUE(distances.AllClose(core::Tensor(
+            std::vector<float>(distances_legacy.begin(),
+                               distances_legacy.end()),
+            {3}, core::Dtype::Float32, device)));
+
+    core::Tensor truncated = source.ComputePointCloudDistance(target, 2.0);
+    EXPECT_TRUE(truncated.AllClose(
+            core::Tensor(std::vector<float>{1, 0.5, 2}, {3},
+                         core::Dtype::Float32, device)));
+}
+
+TEST_P(PointCloudPermuteDevices, HiddenPointRemoval) {
+    core::Device device = GetParam();
+
+    auto sphere = geometry::TriangleMesh::CreateSphere(1.0, 10);
+    geometry::PointCloud pcd_legacy(sphere->vertices_);
+    t::geometry::PointCloud pcd = t::geometry::PointCloud::FromLegacyPointCloud(
+            pcd_legacy, core::Dtype::Float64, device);
+    int64_t num_points = pcd.GetPoints().GetLength();
+
+    std::vector<Eigen::Vector3d> cameras = {{0, 0, 5}, {5, 0, 0}, {0, -3, 3}};
+    core::Tensor visible = pcd.HiddenPointRemoval(
+            core::eigen_converter::EigenVector3dVectorToTensor(
+                    cameras, core::Dtype::Float64, device),
+            100);
+    EXPECT_EQ(visible.GetDevice(), device);
+    EXPECT_EQ(visible.GetShape(), core::SizeVector({3, num_points}));
+
+    // Each row matches the legacy PointCloud.
+    for (size_t i = 0; i < cameras.size(); ++i) {
+        std::vector<size_t> pt_map;
+        std::tie(std::ignore, pt_map) =
+                pcd_legacy.HiddenPointRemoval(cameras[i], 100);
+        std::vector<bool> ref(num_points, false);
+        for (size_t pidx : pt_map) {
+            ref[pidx] = true;
+        }
+        std::vector<bool> row = visible[i].ToFlatVector<bool>();
+        EXPECT_EQ(row, ref);
+        EXPECT_GT(pt_map.size(), 0u);
+        EXPECT_LT(pt_map.size(), size_t(num_points));
+    }
+
+    // A single camera gives a single mask.
+    core::Tensor single = pcd.HiddenPointRemoval(
+            core::Tensor(std::vector<double>{0, 0, 5}, {3},
+                         core::Dtype::Float64, device),
+            100);
+    EXPECT_EQ(single.ToFlatVector<bool>(), visible[0].ToFlatVector<bool>());
+}
+
+TEST_P(PointCloudPermuteDevices, ClusterDBSCAN) {
+    core::Device device = GetParam();
+    t::geometry::PointCloud pcd = GridWithOutlier(device);
+
+    // The grid is one cluster and the outlier is noise.
+    core::Tensor labels = pcd.ClusterDBSCAN(0.11, 3);
+    std::vector<int> ref_labels(28, 0);
+    ref_labels[27] = -1;
+    EXPECT_EQ(labels.GetDevice(), device);
+    EXPECT_EQ(labels.GetDtype(), core::Dtype::Int32);
+    EXPECT_EQ(labels.ToFlatVector<int>(), ref_labels);
+
+    // No point has enough neighbors.
+    labels = pcd.ClusterDBSCAN(0.11, 10);
+    EXPECT_EQ(labels.ToFlatVector<int>(), std::vector<int>(28, -1));
+}
+
+TEST_P(PointCloudPermuteDevices, GetClusterBoundingBoxes) {
+    core::Device device = GetParam();
+
+    // Cluster 0 is a 3 x 2 x 1 box, cluster 1 is empty, cluster 2 is a
+    // 1 x 0.5 x 0.25 box at (10, 10, 10), cluster 3 is a segment and the last
+    // point is noise.
+    std::vector<float> points;
+    std::vector<int> labels;
+    for (int i = 0; i < 8; ++i) {
+        points.insert(points.end(), {i & 1 ? 3.0f : 0.0f, i & 2 ? 2.0f : 0.0f,
+                                     i & 4 ? 1.0f : 0.0f});
+        points.insert(points.end(), {i & 1 ? 11.0f : 10.0f,
+                                     i & 2 ? 10.5f : 10.0f,
+                                     i & 4 ? 10.25f : 10.0f});
+        labels.insert(labels.end(), {0, 2});
+    }
+    points.insert(points.end(), {20, 20, 20, 21, 20, 20, 100, 100, 100});
+    labels.insert(labels.end(), {3, 3, -1});
+    t::geometry::PointCloud pcd(
+            core::Tensor(points, {19, 3}, core::Dtype::Float32, device));
+    core::Tensor labels_t(labels, {19}, core::Dtype::Int32, device);
+
+    core::Tensor min_bound, max_bound;
+    std::tie(min_bound, max_bound) =
+            pcd.GetClusterAxisAlignedBoundingBoxes(labels_t);
+    EXPECT_EQ(min_bound.GetDevice(), device);
+    EXPECT_EQ(min_bound.GetDtype(), core::Dtype::Float32);
+    EXPECT_TRUE(min_bound.AllClose(core::Tensor::Init<float>(
+            {{0, 0, 0}, {0, 0, 0}, {10, 10, 10}, {20, 20, 20}}, device)));
+    EXPECT_TRUE(max_bound.AllClose(core::Tensor::Init<float>(
+            {{3, 2, 1}, {0, 0, 0}, {11, 10.5, 10.25}, {21, 20, 20}}, device)));
+
+    core::Tensor center, R, extent;
+    std::tie(center, R, extent) = pcd.GetClusterOrientedBoundingBoxes(labels_t);
+    EXPECT_EQ(center.GetDevice(), device);
+    EXPECT_EQ(R.GetShape(), core::SizeVector({4, 3, 3}));
+    EXPECT_TRUE(center.AllClose(
+            core::Tensor::Init<double>({{1.5, 1, 0.5},
+                                        {0, 0, 0},
+                                        {10.5, 10.25, 10.125},
+                                        {20.5, 20, 20}},
+                                       device),
+            1e-5, 1e-5));
+    EXPECT_TRUE(extent.AllClose(
+            core::Tensor::Init<double>(
+                    {{3, 2, 1}, {0, 0, 0}, {1, 0.5, 0.25}, {1, 0, 0}}, device),
+            1e-5, 1e-5));
+
+    // The segment has no convex hull and keeps its PCA box.
+    core::Tensor center_min, R_min, extent_min;
+    std::tie(center_min, R_min, extent_min) =
+            pcd.GetClusterOrientedBoundingBoxes(labels_t, true);
+    EXPECT_TRUE(center_min.AllClose(center, 1e-5, 1e-5));
+    EXPECT_TRUE(extent_min.Prod({1}).AllClose(extent.Prod({1}), 1e-5, 1e-5));
+
+    EXPECT_ANY_THROW(pcd.GetClusterAxisAlignedBoundingBoxes(
+            labels_t.Slice(0, 0, 18)));
+    EXPECT_ANY_THROW(
+            pcd.GetClusterOrientedBoundingBoxes(labels_t.To(core::Dtype::Float32)));
+}
+
+TEST_P(PointCloudPermuteDevices, SegmentPlanes) {
+    core::Device device = GetParam();
+
+    // Two 10 x 10 grids on the planes z = 0 and x = 2, and an outlier.
+    std::vector<float> points;
+    for (int i = 0; i < 10; ++i) {
+        for (int j = 0; j < 10; ++j) {
+            points.insert(points.end(), {0.1f * i, 0.1f * j, 0.0f});
+        }
+    }
+    for (int i = 0; i < 10; ++i) {
+        for (int j = 0; j < 10; ++j) {
+            points.insert(points.end(), {2.0f, 0.1f * i, 0.5f + 0.1f * j});
+        }
+    }
+    points.insert(points.end(), {1.0f, 1.0f, 1.0f});
+    t::geometry::PointCloud pcd(
+            core::Tensor(points, {201, 3}, core::Dtype::Float32, device));
+
+    core::Tensor plane, inliers;
+    std::tie(plane, inliers) = pcd.SegmentPlane(0.01, 3, 100);
+    EXPECT_EQ(plane.GetShape(), core::SizeVector({4}));
+    EXPECT_EQ(plane.GetDevice(), device);
+    EXPECT_EQ(inliers.GetLength(), 100);
+
+    std::vector<std::tuple<core::Tensor, core::Tensor>> planes =
+            pcd.SegmentPlanes(3, 0.01, 3, 100, 10);
+    ASSERT_EQ(planes.size(), 2);
+    std::vector<int64_t> all_inliers;
+    for (const auto &p : planes) {
+        std::vector<int64_t> p_inliers = std::get<1>(p).ToFlatVector<int64_t>();
+        EXPECT_EQ(p_inliers.size(), 100);
+        all_inliers.insert(all_inliers.end(), p_inliers.begin(),
+                           p_inliers.end());
+    }
+    std::sort(all_inliers.begin(), all_inliers.end());
+    std::vector<int64_t> ref_inliers(200);
+    std::iota(ref_inliers.begin(), ref_inliers.end(), 0);
+    EXPECT_EQ(all_inliers, ref_inliers);
+}
+
+// Depth image of 3 x 4 pixels with depth 0.5 + 0.1 * (u + 4 * v) meters at
+// (u, v), except an invalid zero depth at (0, 0).
+static t::geometry::Image DepthImageForUnproject(const core::Device &device) {
+    std::vector<uint16_t> depth_vals(12);
+    for (int i = 0; i < 12; ++i) {
+        depth_vals[i] = static_cast<uint16_t>(500 + 100 * i);
+    }
+    depth_vals[0] = 0;
+    return t::geometry::Image(
+            core::Tensor(depth_vals, {3, 4, 1}, core::Dtype::UInt16, device));
+}
+
+TEST_P(PointCloudPermuteDevices, CreateFromDepthImage) {
+    core::Device device = GetParam();
+    t::geometry::Image depth = DepthImageForUnproject(device);
+    core::Tensor intrinsics =
+            core::Tensor::Eye(3, core::Dtype::Float32, device);
+
+    // The depths 1.5 at (2, 2) and 1.6 at (3, 2) are truncated by depth_max.
+    t::geometry::PointCloud pcd = t::geometry::PointCloud::CreateFromDepthImage(
+            depth, intrinsics,
+            core::Tensor::Eye(4, core::Dtype::Float32, device), 1000.0f, 1.5f);
+    core::Tensor points = pcd.GetPoints().Copy(core::Device("CPU:0"));
+    EXPECT_EQ(pcd.GetPoints().GetDevice(), device);
+    EXPECT_EQ(points.GetShape(), core::SizeVector({9, 3}));
+    for (int64_t i = 0; i < points.GetLength(); ++i) {
+        float z = points[i][2].Item<float>();
+        float u = points[i][0].Item<float>() / z;
+        float v = points[i][1].Item<float>() / z;
+        EXPECT_NEAR(z, 0.5f + 0.1f * (u + 4 * v), 1e-5);
+    }
+
+    // The camera is one meter in front of the world origin, and only the
+    // pixels with even coordinates are sampled, including the last row.
+    core::Tensor extrinsics =
+            core::Tensor::Eye(4, core::Dtype::Float32, device);
+    extrinsics[2][3] = 1.0f;
+    pcd = t::geometry::PointCloud::CreateFromDepthImage(
+            depth, intrinsics, extrinsics, 1000.0f, 1.5f, 2);
+    points = pcd.GetPoints().Copy(core::Device("CPU:0"));
+    std::vector<float> ref_points = points[0][0].Item<float>() == 0.0f
+                                            ? std::vector<float>{0.0f, 2.6f,
+                                                                 0.3f, 1.4f,
+                                                                 0.0f, -0.3f}
+                                            : std::vector<float>{1.4f, 0.0f,
+                                                                 -0.3f, 0.0f,
+                                                                 2.6f, 0.3f};
+    EXPECT_TRUE(points.AllClose(core::Tensor(ref_points, {2, 3},
+                                             core::Dtype::Float32)));
+
+    EXPECT_ANY_THROW(t::geometry::PointCloud::CreateFromDepthImage(
+            depth, intrinsics, extrinsics, 1000.0f, 1.5f, 0));
+}
+
+TEST_P(PointCloudPermuteDevices, CreateFromRGBDImage) {
+    core::Device device = GetParam();
+    t::geometry::Image depth = DepthImageForUnproject(device);
+    core::Tensor intrinsics =
+            core::Tensor::Eye(3, core::Dtype::Float32, device);
+
+    // The color at (u, v) is (10 * u, 20 * v, 255).
+    std::vector<uint8_t> color_vals(36);
+    for (int v = 0; v < 3; ++v) {
+        for (int u = 0; u < 4; ++u) {
+            color_vals[3 * (4 * v + u) + 0] = static_cast<uint8_t>(10 * u);
+            color_vals[3 * (4 * v + u) + 1] = static_cast<uint8_t>(20 * v);
+            color_vals[3 * (4 * v + u) + 2] = 255;
+        }
+    }
+    t::geometry::Image color(
+            core::Tensor(color_vals, {3, 4, 3}, core::Dtype::UInt8, device));
+
+    t::geometry::PointCloud pcd = t::geometry::PointCloud::CreateFromRGBDImage(
+            t::geometry::RGBDImage(color, depth), intrinsics,
+            core::Tensor::Eye(4, core::Dtype::Float32, device), 1000.0f, 1.5f);
+    core::Tensor points = pcd.GetPoints().Copy(core::Device("CPU:0"));
+    core::Tensor colors = pcd.GetPointColors().Copy(core::Device("CPU:0"));
+    EXPECT_EQ(pcd.GetPointColors().GetDevice(), device);
+    EXPECT_EQ(points.GetShape(), core::SizeVector({9, 3}));
+    EXPECT_EQ(colors.GetShape(), core::SizeVector({9, 3}));
+    for (int64_t i = 0; i < points.GetLength(); ++i) {
+        float z = points[i][2].Item<float>();
+        float u = points[i][0].Item<float>() / z;
+        float v = points[i][1].Item<float>() / z;
+        EXPECT_NEAR(colors[i][0].Item<float>(), 10.0f * u / 255.0f, 1e-5);
+        EXPECT_NEAR(colors[i][1].Item<float>(), 20.0f * v / 255.0f, 1e-5);
+        EXPECT_NEAR(colors[i][2].Item<float>(), 1.0f, 1e-5);
+    }
+
+    // Float colors are gathered as they are.
+    t::geometry::Image color_float(
+            color.AsTensor().To(core::Dtype::Float32).Div(255.0f));
+    t::geometry::PointCloud pcd_float =
+            t::geometry::PointCloud::CreateFromRGBDImage(
+                    t::geometry::RGBDImage(color_float, depth), intrinsics,
+                    core::Tensor::Eye(4, core::Dtype::Float32, device),
+                    1000.0f, 1.5f);
+    EXPECT_EQ(pcd_float.GetPointColors().GetShape(),
+              core::SizeVector({9, 3}));
+}
+
 }  // namespace tests
 }  // namespace open3d
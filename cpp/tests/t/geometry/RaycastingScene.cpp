@@ -0,0 +1,193 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/RaycastingScene.h"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+namespace {
+
+// Two triangles covering [0, size]^2 in the plane z = z.
+t::geometry::TriangleMesh CreateSquare(float z, float size = 1.f) {
+    core::Tensor vertices(std::vector<float>{0, 0, z, size, 0, z, size, size,
+                                             z, 0, size, z},
+                          {4, 3}, core::Dtype::Float32);
+    core::Tensor triangles(std::vector<int64_t>{0, 1, 2, 0, 2, 3}, {2, 3},
+                           core::Dtype::Int64);
+    return t::geometry::TriangleMesh(vertices, triangles);
+}
+
+// A grid of n x n squares in the plane z = 0 covering [0, 1]^2.
+t::geometry::TriangleMesh CreateGrid(int n) {
+    std::vector<float> vertices;
+    std::vector<int64_t> triangles;
+    for (int j = 0; j <= n; ++j) {
+        for (int i = 0; i <= n; ++i) {
+            vertices.insert(vertices.end(), {float(i) / n, float(j) / n, 0.f});
+        }
+    }
+    for (int j = 0; j < n; ++j) {
+        for (int i = 0; i < n; ++i) {
+            const int64_t v = j * (n + 1) + i;
+            triangles.insert(triangles.end(),
+                             {v, v + 1, v + n + 2, v, v + n + 2, v + n + 1});
+        }
+    }
+    const int64_t num_vertices = int64_t(vertices.size()) / 3;
+    const int64_t num_triangles = int64_t(triangles.size()) / 3;
+    return t::geometry::TriangleMesh(
+            core::Tensor(vertices, {num_vertices, 3}, core::Dtype::Float32),
+            core::Tensor(triangles, {num_triangles, 3}, core::Dtype::Int64));
+}
+
+}  // namespace
+
+TEST(RaycastingScene, CastRays) {
+    t::geometry::RaycastingScene scene;
+    EXPECT_EQ(scene.AddTriangles(CreateSquare(0.f)), 0);
+    EXPECT_EQ(scene.AddTriangles(CreateSquare(-1.f)), 1);
+    EXPECT_EQ(scene.GetNumGeometries(), 2);
+    EXPECT_EQ(scene.GetNumTriangles(), 4);
+
+    // The first ray hits both squares, the second misses.
+    core::Tensor rays(std::vector<float>{0.75f, 0.25f, 1.f, 0.f, 0.f, -2.f,
+                                         2.f, 2.f, 1.f, 0.f, 0.f, -1.f},
+                      {2, 6}, core::Dtype::Float32);
+    auto result = scene.CastRays(rays);
+    EXPECT_EQ(result["t_hit"].GetShape(), core::SizeVector({2}));
+    EXPECT_EQ(result["primitive_uvs"].GetShape(), core::SizeVector({2, 2}));
+    EXPECT_EQ(result["primitive_normals"].GetShape(),
+              core::SizeVector({2, 3}));
+
+    EXPECT_FLOAT_EQ(result["t_hit"][0].Item<float>(), 0.5f);
+    EXPECT_EQ(result["geometry_ids"][0].Item<int64_t>(), 0);
+    EXPECT_EQ(result["primitive_ids"][0].Item<int64_t>(), 0);
+    EXPECT_FLOAT_EQ(result["primitive_normals"][0][2].Item<float>(), 1.f);
+
+    EXPECT_EQ(result["t_hit"][1].Item<float>(),
+              std::numeric_limits<float>::infinity());
+    EXPECT_EQ(result["geometry_ids"][1].Item<int64_t>(),
+              t::geometry::RaycastingScene::INVALID_ID);
+    EXPECT_EQ(result["primitive_ids"][1].Item<int64_t>(),
+              t::geometry::RaycastingScene::INVALID_ID);
+
+    core::Tensor counts = scene.CountIntersections(rays);
+    EXPECT_EQ(counts[0].Item<int32_t>(), 2);
+    EXPECT_EQ(counts[1].Item<int32_t>(), 0);
+
+    core::Tensor occluded = scene.TestOcclusions(rays);
+    EXPECT_TRUE(occluded[0].Item<bool>());
+    EXPECT_FALSE(occluded[1].Item<bool>());
+    occluded = scene.TestOcclusions(rays, 0.f, 0.25f);
+    EXPECT_FALSE(occluded[0].Item<bool>());
+}
+
+TEST(RaycastingScene, CastRaysGrid) {
+    // Enough triangles for a BVH of several levels.
+    const int n = 32;
+    t::geometry::RaycastingScene scene;
+    scene.AddTriangles(CreateGrid(n));
+
+    std::vector<float> rays;
+    for (int j = 0; j < n; ++j) {
+        for (int i = 0; i < n; ++i) {
+            // Aim below the diagonal of each cell, at its first triangle.
+            rays.insert(rays.end(), {(i + 0.75f) / n, (j + 0.25f) / n, 1.f,
+                                     0.f, 0.f, -1.f});
+        }
+    }
+    auto result = scene.CastRays(
+            core::Tensor(rays, {n, n, 6}, core::Dtype::Float32));
+    EXPECT_EQ(result["t_hit"].GetShape(), core::SizeVector({n, n}));
+    for (int j = 0; j < n; ++j) {
+        for (int i = 0; i < n; ++i) {
+            EXPECT_FLOAT_EQ(result["t_hit"][j][i].Item<float>(), 1.f);
+            EXPECT_EQ(result["primitive_ids"][j][i].Item<int64_t>(),
+                      2 * (j * n + i));
+        }
+    }
+}
+
+TEST(RaycastingScene, ComputeDistance) {
+    t::geometry::RaycastingScene scene;
+    scene.AddTriangles(CreateGrid(8));
+    scene.AddTriangles(CreateSquare(-1.f));
+
+    core::Tensor query_points(
+            std::vector<float>{0.5f, 0.5f, 2.f, 2.f, 0.5f, 0.f, 0.5f, 0.5f,
+                               -0.75f},
+            {3, 3}, core::Dtype::Float32);
+    core::Tensor distances = scene.ComputeDistance(query_points);
+    EXPECT_FLOAT_EQ(distances[0].Item<float>(), 2.f);
+    EXPECT_FLOAT_EQ(distances[1].Item<float>(), 1.f);
+    EXPECT_FLOAT_EQ(distances[2].Item<float>(), 0.25f);
+
+    auto result = scene.ComputeClosestPoints(query_points);
+    EXPECT_EQ(result["points"].GetShape(), core::SizeVector({3, 3}));
+    EXPECT_FLOAT_EQ(result["points"][1][0].Item<float>(), 1.f);
+    EXPECT_FLOAT_EQ(result["points"][1][1].Item<float>(), 0.5f);
+    EXPECT_EQ(result["geometry_ids"][0].Item<int64_t>(), 0);
+    EXPECT_EQ(result["geometry_ids"][2].Item<int64_t>(), 1);
+}
+
+TEST(RaycastingScene, CreateRaysPinhole) {
+    t::geometry::RaycastingScene scene;
+    scene.AddTriangles(CreateSquare(0.f, 4.f));
+
+    // The camera looks down at the square from z = 2.
+    core::Tensor intrinsic(std::vector<double>{10, 0, 5, 0, 10, 4, 0, 0, 1},
+                           {3, 3}, core::Dtype::Float64);
+    core::Tensor extrinsic(std::vector<double>{1, 0, 0, -2, 0, -1, 0, 2, 0, 0,
+                                               -1, 2, 0, 0, 0, 1},
+                           {4, 4}, core::Dtype::Float64);
+    core::Tensor rays = t::geometry::RaycastingScene::CreateRaysPinhole(
+            intrinsic, extrinsic, 10, 8);
+    EXPECT_EQ(rays.GetShape(), core::SizeVector({8, 10, 6}));
+
+    // The principal point looks at the center of the square.
+    EXPECT_FLOAT_EQ(rays[4][5][0].Item<float>(), 2.f);
+    EXPECT_FLOAT_EQ(rays[4][5][1].Item<float>(), 2.f);
+    EXPECT_FLOAT_EQ(rays[4][5][2].Item<float>(), 2.f);
+    EXPECT_FLOAT_EQ(rays[4][5][5].Item<float>(), -1.f);
+
+    // All the pixels see the square at the depth of 2.
+    core::Tensor t_hit = scene.CastRays(rays)["t_hit"];
+    for (int64_t v = 0; v < 8; ++v) {
+        for (int64_t u = 0; u < 10; ++u) {
+            EXPECT_FLOAT_EQ(t_hit[v][u].Item<float>(), 2.f);
+        }
+    }
+}
+
+}  // namespace tests
+}  // namespace open3d
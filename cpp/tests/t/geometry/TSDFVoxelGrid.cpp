@@ -107,5 +107,363 @@ TEST_P(TSDFVoxelGridPermuteDevices, Integrate) {
     EXPECT_NEAR(result.fitness_, 1.0, 1e-5);
     EXPECT_NEAR(result.inlier_rmse_, 0, 1e-5);
 }
+
+TEST_P(TSDFVoxelGridPermuteDevices, RayCast) {
+    core::Device device = GetParam();
+
+    float voxel_size = 0.01;
+    t::geometry::TSDFVoxelGrid voxel_grid({{"tsdf", core::Dtype::Float32},
+                                           {"weight", core::Dtype::UInt16},
+                                           {"color", core::Dtype::UInt16}},
+                                          voxel_size, 0.04f, 16, 1000, device);
+
+    // A plane at 1 meter, facing the camera.
+    const int64_t rows = 48, cols = 64;
+    t::geometry::Image depth(core::Tensor::Full(
+            {rows, cols, 1}, 1000, core::Dtype::UInt16, device));
+    t::geometry::Image color(core::Tensor::Full({rows, cols, 3}, 128,
+                                                core::Dtype::UInt8, device));
+    core::Tensor intrinsics(std::vector<float>{60, 0, 32, 0, 60, 24, 0, 0, 1},
+                            {3, 3}, core::Dtype::Float32);
+    core::Tensor extrinsics = core::Tensor::Eye(4, core::Dtype::Float32,
+                                                core::Device("CPU:0"));
+    voxel_grid.Integrate(depth, color, intrinsics, extrinsics);
+
+    // Ray cast from the integrated view, then from a camera moved 0.1 meter
+    // towards the plane.
+    for (float offset : {0.0f, 0.1f}) {
+        core::Tensor camera = extrinsics.Copy(core::Device("CPU:0"));
+        camera[2][3] = -offset;
+        std::unordered_map<std::string, core::Tensor> maps =
+                voxel_grid.RayCast(intrinsics, camera, cols, rows, 0.1f, 3.0f);
+        ASSERT_EQ(maps.count("color"), 1);
+        EXPECT_EQ(maps.at("vertex").GetShape(),
+                  core::SizeVector({rows, cols, 3}));
+        EXPECT_EQ(maps.at("depth").GetShape(),
+                  core::SizeVector({rows, cols, 1}));
+
+        // The central pixel sees the plane.
+        float expected_depth = 1.0f - offset;
+        std::vector<float> vertex =
+                maps.at("vertex")[24][32].ToFlatVector<float>();
+        EXPECT_NEAR(vertex[0], 0.0f, 1e-3);
+        EXPECT_NEAR(vertex[1], 0.0f, 1e-3);
+        EXPECT_NEAR(vertex[2], expected_depth, voxel_size);
+        EXPECT_NEAR(maps.at("depth")[24][32][0].Item<float>(), expected_depth,
+                    voxel_size);
+        std::vector<float> normal =
+                maps.at("normal")[24][32].ToFlatVector<float>();
+        EXPECT_NEAR(normal[0], 0.0f, 1e-3);
+        EXPECT_NEAR(normal[1], 0.0f, 1e-3);
+        EXPECT_NEAR(normal[2], -1.0f, 1e-3);
+        EXPECT_NEAR(maps.at("color")[24][32][0].Item<float>(), 128.0f, 1.0f);
+    }
+
+    // Rays that miss the volume hit nothing.
+    core::Tensor away = extrinsics.Copy(core::Device("CPU:0"));
+    away[2][3] = 10.0f;
+    std::unordered_map<std::string, core::Tensor> maps =
+            voxel_grid.RayCast(intrinsics, away, cols, rows, 0.1f, 3.0f);
+    EXPECT_TRUE(maps.at("depth").AllClose(
+            core::Tensor::Zeros({rows, cols, 1}, core::Dtype::Float32,
+                                device)));
+}
+
+TEST_P(TSDFVoxelGridPermuteDevices, ExtractSurface) {
+    core::Device device = GetParam();
+
+    float voxel_size = 0.01;
+    t::geometry::TSDFVoxelGrid voxel_grid({{"tsdf", core::Dtype::Float32},
+                                           {"weight", core::Dtype::UInt16},
+                                           {"color", core::Dtype::UInt16}},
+                                          voxel_size, 0.04f, 16, 1000, device);
+
+    // A plane facing the camera between two voxel layers, so that no voxel
+    // lies exactly on the surface. Voxels need more than 3 observations to
+    // be extracted.
+    const int64_t rows = 48, cols = 64;
+    t::geometry::Image depth(core::Tensor::Full(
+            {rows, cols, 1}, 1005, core::Dtype::UInt16, device));
+    t::geometry::Image color(core::Tensor::Full({rows, cols, 3}, 128,
+                                                core::Dtype::UInt8, device));
+    core::Tensor intrinsics(std::vector<float>{60, 0, 32, 0, 60, 24, 0, 0, 1},
+                            {3, 3}, core::Dtype::Float32);
+    core::Tensor extrinsics = core::Tensor::Eye(4, core::Dtype::Float32,
+                                                core::Device("CPU:0"));
+    for (int i = 0; i < 4; ++i) {
+        voxel_grid.Integrate(depth, color, intrinsics, extrinsics);
+    }
+
+    // The surface spans several blocks, so that neighbor blocks are looked
+    // up across block boundaries.
+    t::geometry::PointCloud pcd = voxel_grid.ExtractSurfacePoints();
+    core::Tensor points = pcd.GetPoints();
+    ASSERT_GT(points.GetLength(), 0);
+    core::Tensor z = points.Slice(1, 2, 3);
+    EXPECT_TRUE(z.AllClose(core::Tensor::Full(z.GetShape(), 1.005,
+                                              core::Dtype::Float32, device),
+                           0, 1e-3));
+    EXPECT_TRUE(pcd.HasPointColors());
+    EXPECT_EQ(pcd.GetPointNormals().GetLength(), points.GetLength());
+
+    t::geometry::TriangleMesh mesh = voxel_grid.ExtractSurfaceMesh();
+    core::Tensor vertices = mesh.GetVertices();
+    ASSERT_GT(vertices.GetLength(), 0);
+    ASSERT_GT(mesh.GetTriangles().GetLength(), 0);
+    z = vertices.Slice(1, 2, 3);
+    EXPECT_TRUE(z.AllClose(core::Tensor::Full(z.GetShape(), 1.005,
+                                              core::Dtype::Float32, device),
+                           0, 1e-3));
+}
+
+TEST_P(TSDFVoxelGridPermuteDevices, ExtractSurfaceMeshIncremental) {
+    core::Device device = GetParam();
+
+    float voxel_size = 0.01;
+    t::geometry::TSDFVoxelGrid voxel_grid({{"tsdf", core::Dtype::Float32},
+                                           {"weight", core::Dtype::UInt16},
+                                           {"color", core::Dtype::UInt16}},
+                                          voxel_size, 0.04f, 16, 1000, device);
+
+    const int64_t rows = 48, cols = 64;
+    core::Tensor intrinsics(std::vector<float>{60, 0, 32, 0, 60, 24, 0, 0, 1},
+                            {3, 3}, core::Dtype::Float32);
+    core::Tensor extrinsics = core::Tensor::Eye(4, core::Dtype::Float32,
+                                                core::Device("CPU:0"));
+    t::geometry::Image color(core::Tensor::Full({rows, cols, 3}, 128,
+                                                core::Dtype::UInt8, device));
+
+    // Sum of the triangle corners, independent of the vertex order and of the
+    // duplicated vertices.
+    auto CornerSum = [](const t::geometry::TriangleMesh& mesh) {
+        return mesh.GetVertices()
+                .IndexGet({mesh.GetTriangles().Reshape({-1})})
+                .To(core::Dtype::Float64)
+                .Sum({0});
+    };
+    auto ExpectSameSurface = [&]() {
+        t::geometry::TriangleMesh mesh = voxel_grid.ExtractSurfaceMesh();
+        t::geometry::TriangleMesh mesh_incremental =
+                voxel_grid.ExtractSurfaceMeshIncremental();
+        ASSERT_GT(mesh.GetTriangles().GetLength(), 0);
+        EXPECT_EQ(mesh_incremental.GetTriangles().GetLength(),
+                  mesh.GetTriangles().GetLength());
+        EXPECT_TRUE(mesh_incremental.HasVertexNormals());
+        EXPECT_TRUE(mesh_incremental.HasVertexColors());
+        EXPECT_TRUE(CornerSum(mesh_incremental)
+                            .AllClose(CornerSum(mesh), 1e-6, 1e-4));
+    };
+
+    t::geometry::Image depth(core::Tensor::Full(
+            {rows, cols, 1}, 1005, core::Dtype::UInt16, device));
+    for (int i = 0; i < 4; ++i) {
+        voxel_grid.Integrate(depth, color, intrinsics, extrinsics);
+    }
+    ExpectSameSurface();
+
+    // Move the left part of the plane, only the touched blocks and their
+    // neighbors are re-meshed.
+    core::Tensor depth_left =
+            core::Tensor::Zeros({rows, cols, 1}, core::Dtype::UInt16, device);
+    depth_left.Slice(1, 0, 16) = core::Tensor::Full(
+            {rows, 16, 1}, 1025, core::Dtype::UInt16, device);
+    for (int i = 0; i < 8; ++i) {
+        voxel_grid.Integrate(t::geometry::Image(depth_left), color, intrinsics,
+                             extrinsics);
+    }
+    ExpectSameSurface();
+
+    // Nothing to update.
+    EXPECT_TRUE(CornerSum(voxel_grid.ExtractSurfaceMeshIncremental())
+                        .AllClose(CornerSum(voxel_grid.ExtractSurfaceMesh()),
+                                  1e-6, 1e-4));
+}
+
+TEST_P(TSDFVoxelGridPermuteDevices, QuantizedVoxels) {
+    core::Device device = GetParam();
+
+    const int64_t rows = 48, cols = 64;
+    t::geometry::Image depth(core::Tensor::Full(
+            {rows, cols, 1}, 1005, core::Dtype::UInt16, device));
+    t::geometry::Image color(core::Tensor::Full({rows, cols, 3}, 128,
+                                                core::Dtype::UInt8, device));
+    core::Tensor intrinsics(std::vector<float>{60, 0, 32, 0, 60, 24, 0, 0, 1},
+                            {3, 3}, core::Dtype::Float32);
+    core::Tensor extrinsics = core::Tensor::Eye(4, core::Dtype::Float32,
+                                                core::Device("CPU:0"));
+
+    std::vector<std::unordered_map<std::string, core::Dtype>> attr_dtype_maps =
+            {{{"tsdf", core::Dtype::Int16}, {"weight", core::Dtype::UInt16}},
+             {{"tsdf", core::Dtype::Int16},
+              {"weight", core::Dtype::UInt16},
+              {"color", core::Dtype::UInt8}}};
+    for (auto& attr_dtype_map : attr_dtype_maps) {
+        t::geometry::TSDFVoxelGrid voxel_grid(attr_dtype_map, 0.01f, 0.04f, 16,
+                                              1000, device);
+        for (int i = 0; i < 4; ++i) {
+            voxel_grid.Integrate(depth, color, intrinsics, extrinsics);
+        }
+
+        t::geometry::PointCloud pcd = voxel_grid.ExtractSurfacePoints();
+        core::Tensor points = pcd.GetPoints();
+        ASSERT_GT(points.GetLength(), 0);
+        core::Tensor z = points.Slice(1, 2, 3);
+        EXPECT_TRUE(z.AllClose(core::Tensor::Full(z.GetShape(), 1.005,
+                                                  core::Dtype::Float32, device),
+                               0, 1e-3));
+        if (attr_dtype_map.count("color") != 0) {
+            core::Tensor colors = pcd.GetPointColors();
+            EXPECT_TRUE(colors.AllClose(
+                    core::Tensor::Full(colors.GetShape(), 128.0f / 255.0f,
+                                       core::Dtype::Float32, device),
+                    0, 1e-3));
+        } else {
+            EXPECT_FALSE(pcd.HasPointColors());
+        }
+
+        auto result = voxel_grid.RayCast(intrinsics, extrinsics, cols, rows);
+        core::Tensor center = result.at("depth")[rows / 2][cols / 2];
+        EXPECT_NEAR(center.Item<float>(), 1.005f, 1e-3);
+    }
+}
+TEST_P(TSDFVoxelGridPermuteDevices, IntegrateBatch) {
+    core::Device device = GetParam();
+
+    const int64_t rows = 48, cols = 64;
+    std::vector<t::geometry::Image> depths;
+    std::vector<t::geometry::Image> colors;
+    std::vector<core::Tensor> extrinsics;
+    for (int i = 0; i < 4; ++i) {
+        depths.emplace_back(core::Tensor::Full(
+                {rows, cols, 1}, 1005, core::Dtype::UInt16, device));
+        colors.emplace_back(core::Tensor::Full(
+                {rows, cols, 3}, 60 * (i + 1), core::Dtype::UInt8, device));
+        core::Tensor extrinsic = core::Tensor::Eye(4, core::Dtype::Float32,
+                                                   core::Device("CPU:0"));
+        extrinsic[0][3] = 0.02f * i;
+        extrinsics.push_back(extrinsic);
+    }
+    core::Tensor intrinsics(std::vector<float>{60, 0, 32, 0, 60, 24, 0, 0, 1},
+                            {3, 3}, core::Dtype::Float32);
+
+    // A batch updates each voxel with the frames in order, as sequential
+    // integration does.
+    t::geometry::TSDFVoxelGrid sequential_grid(
+            {{"tsdf", core::Dtype::Float32},
+             {"weight", core::Dtype::UInt16},
+             {"color", core::Dtype::UInt16}},
+            0.01f, 0.04f, 16, 1000, device);
+    for (size_t i = 0; i < depths.size(); ++i) {
+        sequential_grid.Integrate(depths[i], colors[i], intrinsics,
+                                  extrinsics[i]);
+    }
+    t::geometry::TSDFVoxelGrid batch_grid({{"tsdf", core::Dtype::Float32},
+                                           {"weight", core::Dtype::UInt16},
+                                           {"color", core::Dtype::UInt16}},
+                                          0.01f, 0.04f, 16, 1000, device);
+    batch_grid.IntegrateBatch(depths, colors, {intrinsics}, extrinsics);
+
+    t::geometry::PointCloud pcd = batch_grid.ExtractSurfacePoints();
+    t::geometry::PointCloud pcd_sequential =
+            sequential_grid.ExtractSurfacePoints();
+    ASSERT_GT(pcd.GetPoints().GetLength(), 0);
+    EXPECT_EQ(pcd.GetPoints().GetLength(),
+              pcd_sequential.GetPoints().GetLength());
+    core::Tensor z = pcd.GetPoints().Slice(1, 2, 3);
+    EXPECT_TRUE(z.AllClose(core::Tensor::Full(z.GetShape(), 1.005,
+                                              core::Dtype::Float32, device),
+                           0, 1e-3));
+
+    auto result = batch_grid.RayCast(intrinsics, extrinsics[1], cols, rows);
+    auto result_sequential =
+            sequential_grid.RayCast(intrinsics, extrinsics[1], cols, rows);
+    EXPECT_TRUE(result.at("depth").AllClose(result_sequential.at("depth")));
+    // Near the frustum border the batch also updates blocks that were only
+    // touched by other frames of the batch, so compare colors in the center.
+    EXPECT_TRUE(result.at("color")
+                        .Slice(0, 16, 32)
+                        .Slice(1, 16, 48)
+                        .AllClose(result_sequential.at("color")
+                                          .Slice(0, 16, 32)
+                                          .Slice(1, 16, 48),
+                                  0, 1e-3));
+
+    // Depth-only batches, and mismatched batch sizes.
+    batch_grid.IntegrateBatch(depths, {}, {intrinsics}, extrinsics);
+    EXPECT_ANY_THROW(batch_grid.IntegrateBatch(depths, colors, {intrinsics},
+                                               {extrinsics[0]}));
+}
+
+TEST_P(TSDFVoxelGridPermuteDevices, StreamBlocks) {
+    core::Device device = GetParam();
+
+    const int64_t rows = 48, cols = 64;
+    t::geometry::Image depth(core::Tensor::Full(
+            {rows, cols, 1}, 1005, core::Dtype::UInt16, device));
+    t::geometry::Image color(core::Tensor::Full({rows, cols, 3}, 128,
+                                                core::Dtype::UInt8, device));
+    core::Tensor intrinsics(std::vector<float>{60, 0, 32, 0, 60, 24, 0, 0, 1},
+                            {3, 3}, core::Dtype::Float32);
+    core::Tensor extrinsics = core::Tensor::Eye(4, core::Dtype::Float32,
+                                                core::Device("CPU:0"));
+    // Camera 10m away along x, which sees none of the blocks of the first.
+    core::Tensor extrinsics_far(
+            std::vector<float>{1, 0, 0, -10, 0, 1, 0, 0,  //
+                               0, 0, 1, 0,   0, 0, 0, 1},
+            {4, 4}, core::Dtype::Float32);
+
+    t::geometry::TSDFVoxelGrid reference(
+            {{"tsdf", core::Dtype::Float32},
+             {"weight", core::Dtype::UInt16},
+             {"color", core::Dtype::UInt16}},
+            0.01f, 0.04f, 16, 1000, device);
+    t::geometry::TSDFVoxelGrid voxel_grid(
+            {{"tsdf", core::Dtype::Float32},
+             {"weight", core::Dtype::UInt16},
+             {"color", core::Dtype::UInt16}},
+            0.01f, 0.04f, 16, 1000, device);
+    voxel_grid.SetMaxDeviceBlocks(1);
+    for (int i = 0; i < 2; ++i) {
+        reference.Integrate(depth, color, intrinsics, extrinsics);
+        voxel_grid.Integrate(depth, color, intrinsics, extrinsics);
+    }
+    int64_t n = reference.GetActiveBlockCount();
+    EXPECT_EQ(voxel_grid.GetActiveBlockCount(), n);
+    EXPECT_EQ(voxel_grid.GetHostBlockCount(), 0);
+
+    // The blocks of the first camera are streamed out by the second one.
+    voxel_grid.Integrate(depth, color, intrinsics, extrinsics_far);
+    int64_t m = voxel_grid.GetActiveBlockCount();
+    EXPECT_EQ(voxel_grid.GetHostBlockCount(), n);
+
+    // Through a file, and back in when the first camera revisits them.
+    std::string file_name = std::string(TEST_DATA_DIR) + "/temp_blocks.bin";
+    voxel_grid.SaveHostBlocks(file_name);
+    EXPECT_EQ(voxel_grid.GetHostBlockCount(), 0);
+    voxel_grid.LoadHostBlocks(file_name);
+    EXPECT_EQ(std::remove(file_name.c_str()), 0);
+    EXPECT_EQ(voxel_grid.GetHostBlockCount(), n);
+
+    for (int i = 0; i < 2; ++i) {
+        reference.Integrate(depth, color, intrinsics, extrinsics);
+        voxel_grid.Integrate(depth, color, intrinsics, extrinsics);
+    }
+    EXPECT_EQ(voxel_grid.GetActiveBlockCount(), n);
+    EXPECT_EQ(voxel_grid.GetHostBlockCount(), m);
+    t::geometry::PointCloud pcd = voxel_grid.ExtractSurfacePoints();
+    t::geometry::PointCloud pcd_ref = reference.ExtractSurfacePoints();
+    ASSERT_GT(pcd_ref.GetPoints().GetLength(), 0);
+    EXPECT_EQ(pcd.GetPoints().GetLength(), pcd_ref.GetPoints().GetLength());
+    EXPECT_TRUE(pcd.GetPoints()
+                        .Sum({0})
+                        .AllClose(pcd_ref.GetPoints().Sum({0}), 1e-4, 1e-3));
+
+    // Explicit streaming of the whole working set.
+    EXPECT_EQ(voxel_grid.StreamOutInvisibleBlocks(intrinsics, extrinsics_far,
+                                                  cols, rows),
+              n);
+    EXPECT_EQ(voxel_grid.GetActiveBlockCount(), 0);
+    EXPECT_EQ(voxel_grid.GetHostBlockCount(), n + m);
+}
 }  // namespace tests
 }  // namespace open3d
@@ -113,5 +113,96 @@ TEST_P(TensorMapPermuteDevices, Contains) {
     EXPECT_FALSE(tm.Contains("normals"));
 }
 
+TEST_P(TensorMapPermuteDevices, IndexGet) {
+    core::Device device = GetParam();
+
+    t::geometry::TensorMap tm(
+            "points",
+            {{"points", core::Tensor::Arange(0, 12, 1, core::Dtype::Float64,
+                                             device)
+                                .Reshape({4, 3})},
+             {"labels",
+              core::Tensor::Arange(0, 4, 1, core::Dtype::Int32, device)},
+             {"masks", core::Tensor(std::vector<bool>{true, false, true, true},
+                                    {4, 1}, core::Dtype::Bool, device)}});
+    core::Tensor indices(std::vector<int64_t>{3, 0, 3}, {3},
+                         core::Dtype::Int64, device);
+
+    t::geometry::TensorMap gathered = tm.IndexGet(indices);
+    EXPECT_EQ(gathered.GetPrimaryKey(), "points");
+    EXPECT_EQ(gathered.size(), 3);
+    for (auto &kv : tm) {
+        EXPECT_EQ(gathered[kv.first].GetDevice(), device);
+        EXPECT_EQ(gathered[kv.first].GetDtype(), kv.second.GetDtype());
+    }
+    EXPECT_TRUE(gathered["points"].AllClose(tm["points"].IndexGet({indices})));
+    EXPECT_EQ(gathered["labels"].ToFlatVector<int32_t>(),
+              std::vector<int32_t>({3, 0, 3}));
+    EXPECT_EQ(gathered["masks"].ToFlatVector<bool>(),
+              std::vector<bool>({true, true, true}));
+}
+
+TEST_P(TensorMapPermuteDevices, Append) {
+    core::Device device = GetParam();
+
+    t::geometry::TensorMap tm("points");
+    t::geometry::TensorMap frame(
+            "points",
+            {{"points", core::Tensor::Ones({2, 3}, core::Dtype::Float32,
+                                           device)},
+             {"labels",
+              core::Tensor::Arange(0, 2, 1, core::Dtype::Int32, device)}});
+
+    // An empty map takes the keys of the appended one.
+    tm.Append(frame);
+    EXPECT_EQ(tm.size(), 2);
+    EXPECT_EQ(tm["points"].GetShape(), core::SizeVector({2, 3}));
+    EXPECT_EQ(tm["labels"].ToFlatVector<int32_t>(),
+              std::vector<int32_t>({0, 1}));
+
+    // Appends within the reserved memory do not reallocate. Capacity grows
+    // 2 -> 4 -> 8, so the fourth append fits.
+    tm.Append(frame);
+    tm.Append(frame);
+    const void *data_ptr = tm["points"].GetDataPtr();
+    tm.Append(frame);
+    EXPECT_EQ(tm["points"].GetDataPtr(), data_ptr);
+    EXPECT_EQ(tm["points"].GetShape(), core::SizeVector({8, 3}));
+    EXPECT_EQ(tm["labels"].ToFlatVector<int32_t>(),
+              std::vector<int32_t>({0, 1, 0, 1, 0, 1, 0, 1}));
+    EXPECT_TRUE(tm.IsSizeSynchronized());
+
+    // A shallow copy keeps its values when the original grows.
+    tm.Append(frame);
+    t::geometry::TensorMap tm_copy(tm);
+    tm["labels"][9] = 5;
+    tm.Append(frame);
+    EXPECT_EQ(tm["labels"].GetLength(), 12);
+    EXPECT_EQ(tm_copy["labels"].ToFlatVector<int32_t>(),
+              std::vector<int32_t>({0, 1, 0, 1, 0, 1, 0, 1, 0, 5}));
+    tm_copy.Append(tm_copy);
+    EXPECT_EQ(tm_copy["labels"].GetLength(), 20);
+    EXPECT_TRUE(tm_copy["points"].AllClose(
+            core::Tensor::Ones({20, 3}, core::Dtype::Float32, device)));
+    EXPECT_EQ(tm["labels"].ToFlatVector<int32_t>(),
+              std::vector<int32_t>({0, 1, 0, 1, 0, 1, 0, 1, 0, 5, 0, 1}));
+
+    // Shrink copies the tensors to exactly sized memory.
+    tm.Shrink();
+    EXPECT_EQ(tm["labels"].ToFlatVector<int32_t>(),
+              std::vector<int32_t>({0, 1, 0, 1, 0, 1, 0, 1, 0, 5, 0, 1}));
+
+    // Keys, dtypes and element shapes must match.
+    t::geometry::TensorMap other_keys(
+            "points",
+            {{"points",
+              core::Tensor::Ones({2, 3}, core::Dtype::Float32, device)}});
+    EXPECT_ANY_THROW(tm.Append(other_keys));
+    frame["labels"] = core::Tensor::Ones({2}, core::Dtype::Int64, device);
+    EXPECT_ANY_THROW(tm.Append(frame));
+    frame["labels"] = core::Tensor::Ones({2, 1}, core::Dtype::Int32, device);
+    EXPECT_ANY_THROW(tm.Append(frame));
+}
+
 }  // namespace tests
 }  // namespace open3d
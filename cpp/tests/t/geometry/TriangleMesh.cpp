@@ -26,8 +26,14 @@
 
 #include "open3d/t/geometry/TriangleMesh.h"
 
+#include <algorithm>
+#include <cmath>
+#include <tuple>
+
 #include "core/CoreTest.h"
+#include "open3d/core/EigenConverter.h"
 #include "open3d/core/TensorList.h"
+#include "open3d/geometry/TriangleMesh.h"
 #include "tests/UnitTest.h"
 
 namespace open3d {
@@ -274,5 +280,486 @@ TEST_P(TriangleMeshPermuteDevices, ToLegacyTriangleMesh) {
                       {Eigen::Vector3d(4, 4, 4), Eigen::Vector3d(4, 4, 4)}));
 }
 
+// A tetrahedron with outward facing triangles.
+static t::geometry::TriangleMesh Tetrahedron(const core::Device &device) {
+    return t::geometry::TriangleMesh(
+            core::Tensor(std::vector<float>{0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0,
+                                            1},
+                         {4, 3}, core::Dtype::Float32, device),
+            core::Tensor(std::vector<int32_t>{0, 2, 1, 0, 1, 3, 0, 3, 2, 1,
+                                              2, 3},
+                         {4, 3}, core::Dtype::Int32, device));
+}
+
+TEST_P(TriangleMeshPermuteDevices, GetMinBound_GetMaxBound_GetCenter) {
+    core::Device device = GetParam();
+    t::geometry::TriangleMesh mesh = Tetrahedron(device);
+
+    EXPECT_EQ(mesh.GetMinBound().ToFlatVector<float>(),
+              std::vector<float>({0, 0, 0}));
+    EXPECT_EQ(mesh.GetMaxBound().ToFlatVector<float>(),
+              std::vector<float>({1, 1, 1}));
+    EXPECT_EQ(mesh.GetCenter().ToFlatVector<float>(),
+              std::vector<float>({0.25, 0.25, 0.25}));
+}
+
+TEST_P(TriangleMeshPermuteDevices, Append) {
+    core::Device device = GetParam();
+    t::geometry::TriangleMesh mesh(device);
+    t::geometry::TriangleMesh tetrahedron = Tetrahedron(device);
+
+    // The triangles of each appended mesh are offset by the vertex count.
+    mesh.Append(tetrahedron);
+    mesh.Append(tetrahedron);
+    mesh.Append(tetrahedron);
+    EXPECT_EQ(mesh.GetVertices().GetShape(), core::SizeVector({12, 3}));
+    EXPECT_EQ(mesh.GetTriangles().GetShape(), core::SizeVector({12, 3}));
+    EXPECT_EQ(mesh.GetTriangles().Slice(0, 8, 12).ToFlatVector<int32_t>(),
+              std::vector<int32_t>({8, 10, 9, 8, 9, 11, 8, 11, 10, 9, 10, 11}));
+    EXPECT_TRUE(mesh.GetVertices().Slice(0, 4, 8).AllClose(
+            tetrahedron.GetVertices()));
+
+    mesh.Shrink();
+    EXPECT_EQ(mesh.GetTriangles().Slice(0, 0, 4).ToFlatVector<int32_t>(),
+              tetrahedron.GetTriangles().ToFlatVector<int32_t>());
+}
+
+TEST_P(TriangleMeshPermuteDevices, Transform) {
+    core::Device device = GetParam();
+    t::geometry::TriangleMesh mesh = Tetrahedron(device);
+    mesh.ComputeVertexNormals();
+
+    // Rotation by 90 degrees around z, followed by a translation.
+    core::Tensor transformation(std::vector<float>{0, -1, 0, 1, 1, 0, 0, 2,
+                                                   0, 0, 1, 3, 0, 0, 0, 1},
+                                {4, 4}, core::Dtype::Float32, device);
+    mesh.Transform(transformation);
+    EXPECT_TRUE(mesh.GetVertices().AllClose(core::Tensor(
+            std::vector<float>{1, 2, 3, 1, 3, 3, 0, 2, 3, 1, 2, 4}, {4, 3},
+            core::Dtype::Float32, device)));
+    EXPECT_TRUE(mesh.GetVertexNormals()[1].AllClose(core::Tensor(
+            std::vector<float>{0, 1, 0}, {3}, core::Dtype::Float32, device)));
+    EXPECT_TRUE(mesh.GetTriangleNormals()[1].AllClose(core::Tensor(
+            std::vector<float>{1, 0, 0}, {3}, core::Dtype::Float32, device)));
+}
+
+TEST_P(TriangleMeshPermuteDevices, Translate) {
+    core::Device device = GetParam();
+    t::geometry::TriangleMesh mesh = Tetrahedron(device);
+    core::Tensor translation(std::vector<float>{1, 2, 3}, {3},
+                             core::Dtype::Float32, device);
+
+    mesh.Translate(translation);
+    EXPECT_EQ(mesh.GetMinBound().ToFlatVector<float>(),
+              std::vector<float>({1, 2, 3}));
+
+    // Non-relative translation moves the center.
+    mesh.Translate(translation, /*relative=*/false);
+    EXPECT_TRUE(mesh.GetCenter().AllClose(translation));
+}
+
+TEST_P(TriangleMeshPermuteDevices, Scale) {
+    core::Device device = GetParam();
+    t::geometry::TriangleMesh mesh = Tetrahedron(device);
+    core::Tensor center(std::vector<float>{1, 0, 0}, {3}, core::Dtype::Float32,
+                        device);
+
+    mesh.Scale(2, center);
+    EXPECT_EQ(mesh.GetVertices().ToFlatVector<float>(),
+              std::vector<float>({-1, 0, 0, 1, 0, 0, -1, 2, 0, -1, 0, 2}));
+}
+
+TEST_P(TriangleMeshPermuteDevices, Rotate) {
+    core::Device device = GetParam();
+    t::geometry::TriangleMesh mesh = Tetrahedron(device);
+    mesh.ComputeTriangleNormals();
+
+    // Rotation by 90 degrees around z about (1, 0, 0).
+    core::Tensor R(std::vector<float>{0, -1, 0, 1, 0, 0, 0, 0, 1}, {3, 3},
+                   core::Dtype::Float32, device);
+    core::Tensor center(std::vector<float>{1, 0, 0}, {3}, core::Dtype::Float32,
+                        device);
+    mesh.Rotate(R, center);
+    EXPECT_TRUE(mesh.GetVertices().AllClose(core::Tensor(
+            std::vector<float>{1, -1, 0, 1, 0, 0, 0, -1, 0, 1, -1, 1}, {4, 3},
+            core::Dtype::Float32, device)));
+    EXPECT_TRUE(mesh.GetTriangleNormals()[1].AllClose(core::Tensor(
+            std::vector<float>{1, 0, 0}, {3}, core::Dtype::Float32, device)));
+}
+
+TEST_P(TriangleMeshPermuteDevices, ComputeTriangleNormals) {
+    core::Device device = GetParam();
+    t::geometry::TriangleMesh mesh = Tetrahedron(device);
+
+    mesh.ComputeTriangleNormals(/*normalized=*/false);
+    EXPECT_EQ(mesh.GetTriangleNormals().GetDtype(), core::Dtype::Float32);
+    EXPECT_TRUE(mesh.GetTriangleNormals().AllClose(
+            core::Tensor(std::vector<float>{0, 0, -1, 0, -1, 0, -1, 0, 0, 1, 1,
+                                            1},
+                         {4, 3}, core::Dtype::Float32, device)));
+
+    float s = 1 / std::sqrt(3.0f);
+    mesh.ComputeTriangleNormals();
+    EXPECT_TRUE(mesh.GetTriangleNormals().AllClose(
+            core::Tensor(std::vector<float>{0, 0, -1, 0, -1, 0, -1, 0, 0, s, s,
+                                            s},
+                         {4, 3}, core::Dtype::Float32, device)));
+}
+
+TEST_P(TriangleMeshPermuteDevices, ComputeVertexNormals) {
+    core::Device device = GetParam();
+    t::geometry::TriangleMesh mesh = Tetrahedron(device);
+
+    // The normals of the adjacent triangles are summed, weighted by area.
+    mesh.ComputeVertexNormals(/*normalized=*/false);
+    EXPECT_TRUE(mesh.GetVertexNormals().AllClose(
+            core::Tensor(std::vector<float>{-1, -1, -1, 1, 0, 0, 0, 1, 0, 0, 0,
+                                            1},
+                         {4, 3}, core::Dtype::Float32, device)));
+
+    float s = 1 / std::sqrt(3.0f);
+    mesh.ComputeVertexNormals();
+    EXPECT_TRUE(mesh.GetVertexNormals().AllClose(
+            core::Tensor(std::vector<float>{-s, -s, -s, 1, 0, 0, 0, 1, 0, 0,
+                                            0, 1},
+                         {4, 3}, core::Dtype::Float32, device)));
+}
+
+TEST_P(TriangleMeshPermuteDevices, RemoveDuplicatedVertices) {
+    core::Device device = GetParam();
+    t::geometry::TriangleMesh mesh(
+            core::Tensor(std::vector<double>{0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1,
+                                             0, 1, 0, 0, -0.0, 0, 0},
+                         {6, 3}, core::Dtype::Float64, device),
+            core::Tensor(std::vector<int64_t>{0, 1, 3, 2, 4, 3, 5, 4, 3},
+                         {3, 3}, core::Dtype::Int64, device));
+    core::Tensor colors =
+            core::Tensor::Arange(0, 6, 1, core::Dtype::Float64, device);
+    mesh.SetVertexColors(colors.Reshape({6, 1}).Mul(
+            core::Tensor::Ones({1, 3}, core::Dtype::Float64, device)));
+
+    mesh.RemoveDuplicatedVertices();
+    EXPECT_EQ(mesh.GetVertices().ToFlatVector<double>(),
+              std::vector<double>({0, 0, 0, 1, 0, 0, 0, 1, 0}));
+    EXPECT_EQ(mesh.GetVertexColors().ToFlatVector<double>(),
+              std::vector<double>({0, 0, 0, 1, 1, 1, 3, 3, 3}));
+    EXPECT_EQ(mesh.GetTriangles().GetDtype(), core::Dtype::Int64);
+    EXPECT_EQ(mesh.GetTriangles().ToFlatVector<int64_t>(),
+              std::vector<int64_t>({0, 1, 2, 0, 1, 2, 0, 1, 2}));
+}
+
+TEST_P(TriangleMeshPermuteDevices, SimplifyVertexClustering) {
+    core::Device device = GetParam();
+
+    // Two quads side by side, the vertices 0, 1 and 3, 4 fall into the same
+    // voxels.
+    t::geometry::TriangleMesh mesh(
+            core::Tensor(std::vector<float>{0, 0, 0, 0.1, 0, 0, 1, 0, 0,
+                                            0, 1, 0, 0.1, 1, 0, 1, 1, 0},
+                         {6, 3}, core::Dtype::Float32, device),
+            core::Tensor(std::vector<int32_t>{0, 1, 4, 0, 4, 3, 1, 2, 5, 4,
+                                              1, 5, 5, 4, 0},
+                         {5, 3}, core::Dtype::Int32, device));
+    core::Tensor colors =
+            core::Tensor::Arange(0, 6, 1, core::Dtype::Float32, device);
+    mesh.SetVertexColors(colors.Reshape({6, 1}).Mul(
+            core::Tensor::Ones({1, 3}, core::Dtype::Float32, device)));
+    mesh.ComputeTriangleNormals();
+
+    t::geometry::TriangleMesh simplified = mesh.SimplifyVertexClustering(0.5);
+    EXPECT_TRUE(simplified.GetVertices().AllClose(core::Tensor(
+            std::vector<float>{0.05, 0, 0, 1, 0, 0, 0.05, 1, 0, 1, 1, 0},
+            {4, 3}, core::Dtype::Float32, device)));
+    EXPECT_TRUE(simplified.GetVertexColors().AllClose(core::Tensor(
+            std::vector<float>{0.5, 0.5, 0.5, 2, 2, 2, 3.5, 3.5, 3.5, 5, 5, 5},
+            {4, 3}, core::Dtype::Float32, device)));
+
+    // The degenerate and duplicated triangles are removed, the others start
+    // at their smallest vertex.
+    EXPECT_EQ(simplified.GetTriangles().GetDtype(), core::Dtype::Int32);
+    EXPECT_EQ(simplified.GetTriangles().ToFlatVector<int32_t>(),
+              std::vector<int32_t>({0, 1, 3, 0, 3, 2}));
+    EXPECT_TRUE(simplified.HasTriangleNormals());
+}
+
+TEST_P(TriangleMeshPermuteDevices, ClusterConnectedTriangles) {
+    core::Device device = GetParam();
+
+    // Three spheres and a lone triangle, with the triangles interleaved.
+    geometry::TriangleMesh merged;
+    for (int i = 0; i < 3; ++i) {
+        auto sphere = geometry::TriangleMesh::CreateSphere(1.0, 4 + i);
+        sphere->Translate(Eigen::Vector3d(3.0 * i, 0, 0));
+        merged += *sphere;
+    }
+    merged.vertices_.push_back({0, 5, 0});
+    merged.vertices_.push_back({1, 5, 0});
+    merged.vertices_.push_back({0, 6, 0});
+    int n = int(merged.vertices_.size());
+    merged.triangles_.push_back({n - 3, n - 2, n - 1});
+    geometry::TriangleMesh mesh_legacy = merged;
+    size_t num_triangles = merged.triangles_.size();
+    ASSERT_NE(num_triangles % 7, 0u);
+    for (size_t i = 0; i < num_triangles; ++i) {
+        mesh_legacy.triangles_[i] = merged.triangles_[(i * 7) % num_triangles];
+    }
+    t::geometry::TriangleMesh mesh =
+            t::geometry::TriangleMesh::FromLegacyTriangleMesh(
+                    mesh_legacy, core::Dtype::Float64, core::Dtype::Int32,
+                    device);
+
+    std::vector<int> gt_clusters;
+    std::vector<size_t> gt_num_triangles;
+    std::vector<double> gt_areas;
+    std::tie(gt_clusters, gt_num_triangles, gt_areas) =
+            mesh_legacy.ClusterConnectedTriangles();
+    ASSERT_EQ(gt_num_triangles.size(), 4u);
+
+    core::Tensor clusters, num_triangles_per_cluster, areas;
+    std::tie(clusters, num_triangles_per_cluster, areas) =
+            mesh.ClusterConnectedTriangles();
+    EXPECT_EQ(clusters.GetDevice(), device);
+    EXPECT_EQ(clusters.ToFlatVector<int64_t>(),
+              std::vector<int64_t>(gt_clusters.begin(), gt_clusters.end()));
+    EXPECT_EQ(num_triangles_per_cluster.ToFlatVector<int64_t>(),
+              std::vector<int64_t>(gt_num_triangles.begin(),
+                                   gt_num_triangles.end()));
+    EXPECT_TRUE(areas.AllClose(core::Tensor(gt_areas, {4},
+                                            core::Dtype::Float64, device)));
+}
+
+TEST_P(TriangleMeshPermuteDevices, SelectAndCrop) {
+    core::Device device = GetParam();
+
+    auto mesh_legacy = geometry::TriangleMesh::CreateSphere(1.0, 6);
+    mesh_legacy->ComputeVertexNormals();
+    mesh_legacy->ComputeTriangleNormals();
+    t::geometry::TriangleMesh mesh =
+            t::geometry::TriangleMesh::FromLegacyTriangleMesh(
+                    *mesh_legacy, core::Dtype::Float64, core::Dtype::Int32,
+                    device);
+
+    auto ExpectSame = [&](const t::geometry::TriangleMesh &selected,
+                          const geometry::TriangleMesh &reference) {
+        EXPECT_EQ(selected.GetDevice(), device);
+        EXPECT_EQ(selected.GetTriangles().GetDtype(), core::Dtype::Int32);
+        geometry::TriangleMesh legacy = selected.ToLegacyTriangleMesh();
+        ExpectEQ(legacy.vertices_, reference.vertices_);
+        ExpectEQ(legacy.vertex_normals_, reference.vertex_normals_);
+        ExpectEQ(legacy.triangles_, reference.triangles_);
+        ExpectEQ(legacy.triangle_normals_, reference.triangle_normals_);
+    };
+
+    // The legacy TriangleMesh keeps the order of the indices, so they are
+    // sorted here.
+    std::vector<size_t> indices;
+    for (size_t i = 0; i < mesh_legacy->vertices_.size(); i += 2) {
+        indices.push_back(i);
+        indices.push_back(i + 1 < mesh_legacy->vertices_.size() && i % 3 == 0
+                                  ? i + 1
+                                  : i);
+    }
+    std::vector<size_t> unique_indices = indices;
+    unique_indices.erase(
+            std::unique(unique_indices.begin(), unique_indices.end()),
+            unique_indices.end());
+    t::geometry::TriangleMesh selected = mesh.SelectByIndex(core::Tensor(
+            std::vector<int64_t>(indices.begin(), indices.end()),
+            {int64_t(indices.size())}, core::Dtype::Int64, device));
+    ExpectSame(selected, *mesh_legacy->SelectByIndex(unique_indices, false));
+    EXPECT_GT(selected.GetTriangles().GetLength(), 0);
+
+    geometry::AxisAlignedBoundingBox aabb(Eigen::Vector3d(-1, -1, -0.5),
+                                          Eigen::Vector3d(1, 0.5, 1));
+    ExpectSame(mesh.Crop(aabb), *mesh_legacy->Crop(aabb));
+    geometry::OrientedBoundingBox obb(
+            Eigen::Vector3d(0.2, 0, 0),
+            geometry::OrientedBoundingBox::GetRotationMatrixFromXYZ(
+                    Eigen::Vector3d(0.5, 0.2, 0.1)),
+            Eigen::Vector3d(1.5, 2, 1.2));
+    ExpectSame(mesh.Crop(obb), *mesh_legacy->Crop(obb));
+
+    // All the vertices of a triangle must be selected.
+    core::Tensor mask =
+            core::Tensor::Ones({mesh.GetVertices().GetLength()},
+                               core::Dtype::Bool, device);
+    mask[0] = core::Tensor::Zeros({}, core::Dtype::Bool, device);
+    t::geometry::TriangleMesh without_first = mesh.SelectByMask(mask);
+    EXPECT_EQ(without_first.GetVertices().GetLength(),
+              mesh.GetVertices().GetLength() - 1);
+    EXPECT_EQ(without_first.GetTriangles().GetLength(),
+              mesh.GetTriangles().GetLength() - 12);
+    EXPECT_EQ(mesh.SelectByMask(mask, true).GetTriangles().GetLength(), 0);
+}
+
+TEST_P(TriangleMeshPermuteDevices, SamplePointsUniformly) {
+    core::Device device = GetParam();
+
+    // A unit square whose vertex colors are the x coordinates.
+    t::geometry::TriangleMesh mesh(
+            core::Tensor(std::vector<double>{0, 0, 0, 1, 0, 0, 1, 1, 0, 0, 1,
+                                             0},
+                         {4, 3}, core::Dtype::Float64, device),
+            core::Tensor(std::vector<int64_t>{0, 1, 2, 0, 2, 3}, {2, 3},
+                         core::Dtype::Int64, device));
+    mesh.SetVertexColors(core::Tensor(
+            std::vector<float>{0, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0}, {4, 3},
+            core::Dtype::Float32, device));
+
+    t::geometry::PointCloud pcd =
+            mesh.SamplePointsUniformly(1000, /*use_triangle_normal=*/true, 7);
+    core::Tensor points = pcd.GetPoints();
+    EXPECT_EQ(points.GetShape(), core::SizeVector({1000, 3}));
+    EXPECT_EQ(points.GetDtype(), core::Dtype::Float64);
+    EXPECT_EQ(points.GetDevice(), device);
+    EXPECT_GE(points.Min({0}).Min({0}).Item<double>(), 0);
+    EXPECT_LE(points.Max({0}).Max({0}).Item<double>(), 1);
+    EXPECT_TRUE(points.T()[2].AllClose(
+            core::Tensor::Zeros({1000}, core::Dtype::Float64, device)));
+    EXPECT_TRUE(pcd.GetPointColors().T()[0].AllClose(
+            points.T()[0].To(core::Dtype::Float32)));
+    EXPECT_TRUE(pcd.GetPointNormals().AllClose(
+            core::Tensor(std::vector<double>{0, 0, 1}, {1, 3},
+                         core::Dtype::Float64, device)
+                    .Mul(core::Tensor::Ones({1000, 1}, core::Dtype::Float64,
+                                            device))));
+
+    // The same seed gives the same points.
+    EXPECT_TRUE(mesh.SamplePointsUniformly(1000, false, 7)
+                        .GetPoints()
+                        .AllClose(points));
+    EXPECT_FALSE(mesh.SamplePointsUniformly(1000, false, 7).HasPointNormals());
+}
+
+TEST_P(TriangleMeshPermuteDevices, SamplePointsPoissonDisk) {
+    core::Device device = GetParam();
+
+    t::geometry::TriangleMesh mesh(
+            core::Tensor(std::vector<float>{0, 0, 0, 1, 0, 0, 1, 1, 0, 0, 1,
+                                            0},
+                         {4, 3}, core::Dtype::Float32, device),
+            core::Tensor(std::vector<int32_t>{0, 1, 2, 0, 2, 3}, {2, 3},
+                         core::Dtype::Int32, device));
+    mesh.ComputeVertexNormals();
+
+    t::geometry::PointCloud pcd =
+            mesh.SamplePointsPoissonDisk(100, 5, false, 3);
+    core::Tensor points = pcd.GetPoints();
+    EXPECT_EQ(points.GetShape(), core::SizeVector({100, 3}));
+    EXPECT_EQ(points.GetDtype(), core::Dtype::Float32);
+    EXPECT_GE(points.Min({0}).Min({0}).Item<float>(), 0);
+    EXPECT_LE(points.Max({0}).Max({0}).Item<float>(), 1);
+    EXPECT_EQ(pcd.GetPointNormals().GetShape(), core::SizeVector({100, 3}));
+
+    // The eliminated samples are evenly spaced: no two of them are much
+    // closer than the spacing of a hexagonal packing.
+    std::vector<float> xyz = points.ToFlatVector<float>();
+    float min_dist2 = 1;
+    for (size_t i = 0; i < 100; ++i) {
+        for (size_t j = i + 1; j < 100; ++j) {
+            float dx = xyz[3 * i] - xyz[3 * j];
+            float dy = xyz[3 * i + 1] - xyz[3 * j + 1];
+            min_dist2 = std::min(min_dist2, dx * dx + dy * dy);
+        }
+    }
+    EXPECT_GT(min_dist2, 0.02 * 0.02);
+
+    EXPECT_ANY_THROW(mesh.SamplePointsPoissonDisk(0));
+    EXPECT_ANY_THROW(mesh.SamplePointsPoissonDisk(100, 0.5));
+}
+
+TEST_P(TriangleMeshPermuteDevices, ComputeDistance) {
+    core::Device device = GetParam();
+
+    // The unit cube, with outward normals.
+    t::geometry::TriangleMesh mesh =
+            t::geometry::TriangleMesh::FromLegacyTriangleMesh(
+                    *geometry::TriangleMesh::CreateBox(), core::Dtype::Float32,
+                    core::Dtype::Int64, device);
+    core::Tensor query_points(
+            std::vector<float>{2, 0.5, 0.5, 0.5, 0.5, 0.5, 2, 2, 2, 1, 1, 0.5,
+                               0.5, 0.5, 5},
+            {5, 3}, core::Dtype::Float32, device);
+
+    core::Tensor distances = mesh.ComputeDistance(query_points);
+    EXPECT_EQ(distances.GetDtype(), core::Dtype::Float32);
+    EXPECT_EQ(distances.GetDevice(), device);
+    EXPECT_TRUE(distances.AllClose(core::Tensor(
+            std::vector<float>{1, 0.5, std::sqrt(3.f), 0, 4}, {5},
+            core::Dtype::Float32, device)));
+
+    // The sign is given by the face, vertex and edge pseudo-normals.
+    core::Tensor signed_distances =
+            mesh.ComputeDistance(query_points, /*signed_distance=*/true);
+    EXPECT_TRUE(signed_distances.AllClose(core::Tensor(
+            std::vector<float>{1, -0.5, std::sqrt(3.f), 0, 4}, {5},
+            core::Dtype::Float32, device)));
+    core::Tensor near_edge(std::vector<float>{0.9, 0.95, 0.5, 1.1, 1.1, 0.5},
+                           {2, 3}, core::Dtype::Float32, device);
+    EXPECT_TRUE(mesh.ComputeDistance(near_edge, true)
+                        .AllClose(core::Tensor(
+                                std::vector<float>{-0.05, std::sqrt(0.02f)},
+                                {2}, core::Dtype::Float32, device)));
+
+    // The farther points are truncated.
+    core::Tensor truncated = mesh.ComputeDistance(query_points, true, 1.5);
+    EXPECT_TRUE(truncated.AllClose(core::Tensor(
+            std::vector<float>{1, -0.5, 1.5, 0, 1.5}, {5},
+            core::Dtype::Float32, device)));
+}
+
+TEST_P(TriangleMeshPermuteDevices, FilterVertices) {
+    core::Device device = GetParam();
+
+    auto mesh_legacy = geometry::TriangleMesh::CreateSphere(1.0, 8);
+    mesh_legacy->ComputeVertexNormals();
+    mesh_legacy->vertex_colors_.resize(mesh_legacy->vertices_.size());
+    for (size_t i = 0; i < mesh_legacy->vertices_.size(); ++i) {
+        mesh_legacy->vertex_colors_[i] =
+                (mesh_legacy->vertices_[i].array() + 1) / 2;
+        mesh_legacy->vertices_[i] *= 1 + 0.1 * std::sin(7.0 * i);
+    }
+    t::geometry::TriangleMesh mesh =
+            t::geometry::TriangleMesh::FromLegacyTriangleMesh(
+                    *mesh_legacy, core::Dtype::Float64, core::Dtype::Int64,
+                    device);
+
+    auto ExpectMeshClose = [&](const t::geometry::TriangleMesh &filtered,
+                               const geometry::TriangleMesh &reference) {
+        EXPECT_EQ(filtered.GetDevice(), device);
+        EXPECT_TRUE(filtered.GetVertices().AllClose(
+                core::eigen_converter::EigenVector3dVectorToTensor(
+                        reference.vertices_, core::Dtype::Float64, device),
+                1e-7, 1e-10));
+        EXPECT_TRUE(filtered.GetVertexNormals().AllClose(
+                core::eigen_converter::EigenVector3dVectorToTensor(
+                        reference.vertex_normals_, core::Dtype::Float64,
+                        device),
+                1e-7, 1e-10));
+        EXPECT_TRUE(filtered.GetVertexColors().AllClose(
+                core::eigen_converter::EigenVector3dVectorToTensor(
+                        reference.vertex_colors_, core::Dtype::Float64,
+                        device),
+                1e-7, 1e-10));
+        EXPECT_TRUE(filtered.GetTriangles().AllClose(mesh.GetTriangles()));
+    };
+
+    ExpectMeshClose(mesh.FilterSharpen(2, 0.1),
+                    *mesh_legacy->FilterSharpen(2, 0.1));
+    ExpectMeshClose(mesh.FilterSmoothSimple(3),
+                    *mesh_legacy->FilterSmoothSimple(3));
+    ExpectMeshClose(mesh.FilterSmoothLaplacian(3, 0.5),
+                    *mesh_legacy->FilterSmoothLaplacian(3, 0.5));
+    ExpectMeshClose(mesh.FilterSmoothTaubin(3, 0.5, -0.53),
+                    *mesh_legacy->FilterSmoothTaubin(3, 0.5, -0.53));
+
+    // The attributes outside of the scope are unchanged.
+    t::geometry::TriangleMesh smoothed = mesh.FilterSmoothLaplacian(
+            3, 0.5, t::geometry::TriangleMesh::FilterScope::Color);
+    EXPECT_TRUE(smoothed.GetVertices().AllClose(mesh.GetVertices()));
+    EXPECT_TRUE(smoothed.GetVertexNormals().AllClose(mesh.GetVertexNormals()));
+    EXPECT_FALSE(smoothed.GetVertexColors().AllClose(mesh.GetVertexColors()));
+}
+
 }  // namespace tests
 }  // namespace open3d
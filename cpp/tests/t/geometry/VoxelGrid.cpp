@@ -0,0 +1,255 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/VoxelGrid.h"
+
+#include <array>
+#include <set>
+
+#include "core/CoreTest.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/geometry/IntersectionTest.h"
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/geometry/TriangleMesh.h"
+#include "open3d/geometry/VoxelGrid.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+namespace {
+std::set<std::array<int, 3>> KeySet(const core::Tensor &keys) {
+    std::vector<int32_t> flat =
+            keys.Copy(core::Device("CPU:0")).ToFlatVector<int32_t>();
+    std::set<std::array<int, 3>> key_set;
+    for (size_t i = 0; i < flat.size(); i += 3) {
+        key_set.insert({flat[i], flat[i + 1], flat[i + 2]});
+    }
+    return key_set;
+}
+
+std::set<std::array<int, 3>> KeySet(const geometry::VoxelGrid &voxel_grid) {
+    std::set<std::array<int, 3>> key_set;
+    for (const auto &it : voxel_grid.voxels_) {
+        const Eigen::Vector3i &key = it.second.grid_index_;
+        key_set.insert({key(0), key(1), key(2)});
+    }
+    return key_set;
+}
+
+// A 4 x 4 x 4 block of unit voxels at the origin.
+t::geometry::VoxelGrid CreateBlock(const core::Device &device) {
+    geometry::VoxelGrid voxel_grid_legacy;
+    voxel_grid_legacy.voxel_size_ = 1.0;
+    for (int i = 0; i < 4; ++i) {
+        for (int j = 0; j < 4; ++j) {
+            for (int k = 0; k < 4; ++k) {
+                voxel_grid_legacy.AddVoxel(
+                        geometry::Voxel(Eigen::Vector3i(i, j, k)));
+            }
+        }
+    }
+    return t::geometry::VoxelGrid::FromLegacyVoxelGrid(voxel_grid_legacy,
+                                                       device);
+}
+
+// Camera looking along +z at the block, which spans x and y in [-2, 2] and
+// depths in [5, 9].
+void GetCamera(core::Tensor &intrinsics, core::Tensor &extrinsics) {
+    intrinsics = core::Tensor(std::vector<float>{10, 0, 50, 0, 10, 50, 0, 0, 1},
+                              {3, 3}, core::Dtype::Float32);
+    extrinsics = core::Tensor::Eye(4, core::Dtype::Float32,
+                                   core::Device("CPU:0"));
+    extrinsics[0][3] = -2.0f;
+    extrinsics[1][3] = -2.0f;
+    extrinsics[2][3] = 5.0f;
+}
+}  // namespace
+
+class VoxelGridPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(VoxelGrid,
+                         VoxelGridPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(VoxelGridPermuteDevices, CreateFromPointCloud) {
+    core::Device device = GetParam();
+
+    geometry::PointCloud pcd_legacy;
+    pcd_legacy.points_ = {{0.0, 0.0, 0.0},  {0.02, 0.02, 0.01},
+                          {0.3, 0.1, 0.0},  {0.31, 0.12, 0.02},
+                          {0.9, 0.8, 0.7},  {-0.4, 0.5, 0.2}};
+    pcd_legacy.colors_ = {{1.0, 0.0, 0.0}, {0.0, 0.0, 1.0}, {0.2, 0.4, 0.6},
+                          {0.4, 0.6, 0.8}, {0.5, 0.5, 0.5}, {0.0, 1.0, 0.0}};
+    auto voxel_grid_legacy =
+            geometry::VoxelGrid::CreateFromPointCloud(pcd_legacy, 0.1);
+
+    t::geometry::PointCloud pcd = t::geometry::PointCloud::FromLegacyPointCloud(
+            pcd_legacy, core::Dtype::Float32, device);
+    t::geometry::VoxelGrid voxel_grid =
+            t::geometry::VoxelGrid::CreateFromPointCloud(pcd, 0.1f);
+    EXPECT_EQ(voxel_grid.GetDevice(), device);
+    EXPECT_EQ(voxel_grid.NumVoxels(), 4);
+    EXPECT_EQ(KeySet(voxel_grid.GetVoxelCoordinates()),
+              KeySet(*voxel_grid_legacy));
+
+    // Colors are averaged over the voxels.
+    open3d::geometry::VoxelGrid converted = voxel_grid.ToLegacyVoxelGrid();
+    for (const auto &it : voxel_grid_legacy->voxels_) {
+        ASSERT_EQ(converted.voxels_.count(it.first), 1u);
+        ExpectEQ(converted.voxels_.at(it.first).color_, it.second.color_,
+                 1e-6);
+    }
+}
+
+TEST_P(VoxelGridPermuteDevices, CreateFromTriangleMesh) {
+    core::Device device = GetParam();
+
+    auto mesh_legacy = geometry::TriangleMesh::CreateBox(1.0, 0.6, 0.4);
+    mesh_legacy->Rotate(mesh_legacy->GetRotationMatrixFromXYZ({0.3, 0.2, 0.1}),
+                        Eigen::Vector3d::Zero());
+    t::geometry::TriangleMesh mesh =
+            t::geometry::TriangleMesh::FromLegacyTriangleMesh(
+                    *mesh_legacy, core::Dtype::Float32, core::Dtype::Int64,
+                    device);
+    float voxel_size = 0.1f;
+    t::geometry::VoxelGrid voxel_grid =
+            t::geometry::VoxelGrid::CreateFromTriangleMesh(mesh, voxel_size);
+
+    // Brute force over the voxels of the bounding box.
+    std::vector<float> origin = voxel_grid.GetOrigin().ToFlatVector<float>();
+    Eigen::Vector3d origin_d(origin[0], origin[1], origin[2]);
+    Eigen::Vector3d extent = mesh_legacy->GetMaxBound() - origin_d;
+    Eigen::Vector3d half_size(voxel_size / 2, voxel_size / 2, voxel_size / 2);
+    std::set<std::array<int, 3>> expected;
+    for (int i = 0; i <= int(extent(0) / voxel_size); ++i) {
+        for (int j = 0; j <= int(extent(1) / voxel_size); ++j) {
+            for (int k = 0; k <= int(extent(2) / voxel_size); ++k) {
+                Eigen::Vector3d center =
+                        origin_d + (Eigen::Vector3d(i, j, k) +
+                                    Eigen::Vector3d::Constant(0.5)) *
+                                           voxel_size;
+                for (const Eigen::Vector3i &triangle :
+                     mesh_legacy->triangles_) {
+                    if (geometry::IntersectionTest::TriangleAABB(
+                                center, half_size,
+                                mesh_legacy->vertices_[triangle(0)],
+                                mesh_legacy->vertices_[triangle(1)],
+                                mesh_legacy->vertices_[triangle(2)])) {
+                        expected.insert({i, j, k});
+                        break;
+                    }
+                }
+            }
+        }
+    }
+
+    // Single precision may add or drop the voxels that the triangles barely
+    // touch.
+    std::set<std::array<int, 3>> result =
+            KeySet(voxel_grid.GetVoxelCoordinates());
+    int64_t num_different = 0;
+    for (const auto &key : result) {
+        num_different += expected.count(key) == 0;
+    }
+    for (const auto &key : expected) {
+        num_different += result.count(key) == 0;
+    }
+    EXPECT_GT(expected.size(), 0u);
+    EXPECT_LE(num_different, int64_t(expected.size() / 100));
+}
+
+TEST_P(VoxelGridPermuteDevices, CarveDepthMap) {
+    core::Device device = GetParam();
+
+    t::geometry::VoxelGrid voxel_grid = CreateBlock(device);
+    core::Tensor intrinsics, extrinsics;
+    GetCamera(intrinsics, extrinsics);
+
+    // The first layer of voxels, with depths in [5, 6], is in front of the
+    // depth map.
+    t::geometry::Image depth(core::Tensor::Full({100, 100, 1}, 6.5f,
+                                                core::Dtype::Float32, device));
+    voxel_grid.CarveDepthMap(depth, intrinsics, extrinsics, false);
+    EXPECT_EQ(voxel_grid.NumVoxels(), 48);
+    for (const auto &key : KeySet(voxel_grid.GetVoxelCoordinates())) {
+        EXPECT_GE(key[2], 1);
+    }
+}
+
+TEST_P(VoxelGridPermuteDevices, CarveSilhouette) {
+    core::Device device = GetParam();
+
+    t::geometry::VoxelGrid voxel_grid = CreateBlock(device);
+    core::Tensor intrinsics, extrinsics;
+    GetCamera(intrinsics, extrinsics);
+
+    // The first column of voxels, with x in [-2, -1] in the camera, projects
+    // left of the silhouette.
+    core::Tensor mask =
+            core::Tensor::Zeros({100, 100, 1}, core::Dtype::Float32, device);
+    mask.Slice(1, 50, 100) = 1.0f;
+    voxel_grid.CarveSilhouette(t::geometry::Image(mask), intrinsics,
+                               extrinsics, false);
+    EXPECT_EQ(voxel_grid.NumVoxels(), 48);
+    for (const auto &key : KeySet(voxel_grid.GetVoxelCoordinates())) {
+        EXPECT_GE(key[0], 1);
+    }
+
+    // Everything projects outside of a tiny image.
+    t::geometry::VoxelGrid outside = CreateBlock(device);
+    t::geometry::Image tiny(core::Tensor::Zeros({10, 10, 1},
+                                                core::Dtype::Float32, device));
+    outside.CarveSilhouette(tiny, intrinsics, extrinsics, true);
+    EXPECT_EQ(outside.NumVoxels(), 64);
+    outside.CarveSilhouette(tiny, intrinsics, extrinsics, false);
+    EXPECT_EQ(outside.NumVoxels(), 0);
+}
+
+TEST_P(VoxelGridPermuteDevices, CheckIfIncluded) {
+    core::Device device = GetParam();
+
+    t::geometry::VoxelGrid voxel_grid = CreateBlock(device);
+    core::Tensor queries(std::vector<float>{0.5f, 0.5f, 0.5f, 3.9f, 2.1f,
+                                            0.0f, 4.1f, 0.5f, 0.5f, -0.1f,
+                                            1.0f, 1.0f},
+                         {4, 3}, core::Dtype::Float32, device);
+    core::Tensor included = voxel_grid.CheckIfIncluded(queries);
+    EXPECT_EQ(included.ToFlatVector<bool>(),
+              std::vector<bool>({true, true, false, false}));
+
+    open3d::geometry::VoxelGrid voxel_grid_legacy =
+            voxel_grid.ToLegacyVoxelGrid();
+    EXPECT_EQ(voxel_grid_legacy.voxels_.size(), 64u);
+    EXPECT_EQ(KeySet(voxel_grid.GetVoxelCoordinates()),
+              KeySet(voxel_grid_legacy));
+
+    t::geometry::VoxelGrid voxel_grid_cpu = voxel_grid.CPU();
+    EXPECT_EQ(voxel_grid_cpu.NumVoxels(), 64);
+    EXPECT_EQ(voxel_grid_cpu.GetDevice(), core::Device("CPU:0"));
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -0,0 +1,67 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/t/io/ImageIO.h"
+
+#include <string>
+
+#include "open3d/io/ImageIO.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(TImageIO, ReadImageInto) {
+    for (const std::string name :
+         {"RGBD/color/00000.jpg", "RGBD/depth/00000.png", "lena_color.jpg",
+          "lena_gray.jpg"}) {
+        SCOPED_TRACE(name);
+        const std::string filename = std::string(TEST_DATA_DIR) + "/" + name;
+        geometry::Image legacy_image;
+        ASSERT_TRUE(io::ReadImage(filename, legacy_image));
+        core::Tensor expected =
+                t::geometry::Image::FromLegacyImage(legacy_image).AsTensor();
+
+        t::geometry::Image image;
+        EXPECT_TRUE(t::io::ReadImageInto(filename, image));
+        EXPECT_EQ(image.AsTensor().GetDtype(), expected.GetDtype());
+        EXPECT_TRUE(image.AsTensor().AllClose(expected, 0, 0));
+
+        // A second read reuses the buffer.
+        const void *data_ptr = image.AsTensor().GetDataPtr();
+        image.AsTensor().Fill(0);
+        EXPECT_TRUE(t::io::ReadImageInto(filename, image));
+        EXPECT_EQ(image.AsTensor().GetDataPtr(), data_ptr);
+        EXPECT_TRUE(image.AsTensor().AllClose(expected, 0, 0));
+    }
+
+    t::geometry::Image image;
+    EXPECT_FALSE(t::io::ReadImageInto("missing.png", image));
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -0,0 +1,127 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/sensor/MultiSensorCapture.h"
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+/// Sensor replaying frames with the given timestamps, filled with the index
+/// of the sensor.
+class FakeSensor : public t::io::RGBDSensor {
+public:
+    FakeSensor(uint8_t value, const std::vector<uint64_t> &timestamps)
+        : value_(value), timestamps_(timestamps) {}
+
+    bool InitSensor(const RGBDSensorConfig &sensor_config,
+                    size_t sensor_index = 0,
+                    const std::string &filename = "") override {
+        return true;
+    }
+    bool StartCapture(bool start_record = false) override {
+        next_ = 0;
+        return true;
+    }
+    void PauseRecord() override {}
+    void ResumeRecord() override {}
+    t::geometry::RGBDImage CaptureFrame(
+            bool wait = true, bool align_depth_to_color = true) override {
+        if (next_ == timestamps_.size()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            return t::geometry::RGBDImage();
+        }
+        timestamp_ = timestamps_[next_++];
+        return t::geometry::RGBDImage(
+                core::Tensor::Full({2, 3, 3}, value_, core::Dtype::UInt8),
+                core::Tensor::Full({2, 3, 1}, value_, core::Dtype::UInt16));
+    }
+    uint64_t GetTimestamp() const override { return timestamp_; }
+    void StopCapture() override {}
+    const t::io::RGBDVideoMetadata &GetMetadata() const override {
+        return metadata_;
+    }
+    std::string GetFilename() const override { return ""; }
+
+private:
+    uint8_t value_;
+    std::vector<uint64_t> timestamps_;
+    size_t next_ = 0;
+    uint64_t timestamp_ = 0;
+    t::io::RGBDVideoMetadata metadata_;
+};
+
+TEST(MultiSensorCapture, MatchFrames) {
+    std::vector<std::shared_ptr<t::io::RGBDSensor>> sensors{
+            std::make_shared<FakeSensor>(
+                    0, std::vector<uint64_t>{0, 33000, 66000}),
+            std::make_shared<FakeSensor>(
+                    1, std::vector<uint64_t>{1000, 40000, 67000})};
+    t::io::MultiSensorCapture capture(sensors, 5000, 8);
+    EXPECT_TRUE(capture.StartCapture());
+
+    auto frames = capture.CaptureFrames();
+    ASSERT_EQ(frames.size(), 2);
+    EXPECT_EQ(frames[0].color_.AsTensor()[0][0][0].Item<uint8_t>(), 0);
+    EXPECT_EQ(frames[1].color_.AsTensor()[0][0][0].Item<uint8_t>(), 1);
+    EXPECT_EQ(capture.GetTimestamps(), std::vector<uint64_t>({0, 1000}));
+
+    // 33000 and 40000 are not within the tolerance and are dropped.
+    frames = capture.CaptureFrames();
+    ASSERT_EQ(frames.size(), 2);
+    EXPECT_EQ(capture.GetTimestamps(), std::vector<uint64_t>({66000, 67000}));
+    EXPECT_EQ(capture.GetNumDroppedFrames(), 2);
+
+    EXPECT_TRUE(capture.CaptureFrames(false).empty());
+    capture.StopCapture();
+}
+
+TEST(MultiSensorCapture, StackFrames) {
+    std::vector<t::geometry::RGBDImage> frames;
+    for (int i = 0; i < 3; ++i) {
+        frames.emplace_back(
+                core::Tensor::Full({2, 3, 3}, i, core::Dtype::UInt8),
+                core::Tensor::Full({2, 3, 1}, i, core::Dtype::UInt16));
+    }
+    core::Tensor color, depth;
+    std::tie(color, depth) = t::io::MultiSensorCapture::StackFrames(
+            frames, core::Device("CPU:0"));
+    EXPECT_EQ(color.GetShape(), core::SizeVector({3, 2, 3, 3}));
+    EXPECT_EQ(depth.GetShape(), core::SizeVector({3, 2, 3, 1}));
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_TRUE(color[i].AllClose(frames[i].color_.AsTensor()));
+        EXPECT_TRUE(depth[i].AllClose(frames[i].depth_.AsTensor()));
+    }
+}
+
+}  // namespace tests
+}  // namespace open3d
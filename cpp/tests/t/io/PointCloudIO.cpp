@@ -33,6 +33,7 @@
 #include "open3d/core/SizeVector.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/core/TensorList.h"
+#include "open3d/io/ByteSource.h"
 #include "open3d/t/geometry/PointCloud.h"
 #include "tests/UnitTest.h"
 
@@ -55,6 +56,16 @@ struct ReadWritePCArgs {
     std::unordered_map<std::string, double> attributes_rel_tols;
 };
 
+/// Local file source that reads in parts of a few bytes, so that the ranges
+/// of the readers are split and read concurrently.
+class SmallPartFileByteSource : public io::FileByteSource {
+public:
+    using io::FileByteSource::FileByteSource;
+
+protected:
+    int64_t GetPartSize() const override { return 7; }
+};
+
 }  // namespace
 
 const std::unordered_map<std::string, TensorCtorData> pc_data_1{
@@ -76,6 +87,38 @@ const std::vector<ReadWritePCArgs> pcArgs({
          IsAscii::ASCII,
          Compressed::UNCOMPRESSED,
          {{"points", 1e-5}, {"intensities", 1e-5}}},  // 1
+        {"test_binary.ply",
+         IsAscii::BINARY,
+         Compressed::UNCOMPRESSED,
+         {{"points", 0}, {"intensities", 0}}},  // 2
+        {"test_ascii.pcd",
+         IsAscii::ASCII,
+         Compressed::UNCOMPRESSED,
+         {{"points", 0}, {"intensities", 0}}},  // 3
+        {"test_binary.pcd",
+         IsAscii::BINARY,
+         Compressed::UNCOMPRESSED,
+         {{"points", 0}, {"intensities", 0}}},  // 4
+        {"test_compressed.pcd",
+         IsAscii::BINARY,
+         Compressed::COMPRESSED,
+         {{"points", 0}, {"intensities", 0}}},  // 5
+        {"test.o3dt",
+         IsAscii::BINARY,
+         Compressed::UNCOMPRESSED,
+         {{"points", 0}, {"intensities", 0}}},  // 6
+        {"test_compressed.o3dt",
+         IsAscii::BINARY,
+         Compressed::COMPRESSED,
+         {{"points", 0}, {"intensities", 0}}},  // 7
+        {"test_binary.ply.gz",
+         IsAscii::BINARY,
+         Compressed::UNCOMPRESSED,
+         {{"points", 0}, {"intensities", 0}}},  // 8
+        {"test.xyzi.gz",
+         IsAscii::ASCII,
+         Compressed::UNCOMPRESSED,
+         {{"points", 1e-5}, {"intensities", 1e-5}}},  // 9
 });
 
 class ReadWriteTPC : public testing::TestWithParam<ReadWritePCArgs> {};
@@ -126,6 +169,42 @@ TEST_P(ReadWriteTPC, Basic) {
     }
 }
 
+TEST_P(ReadWriteTPC, ReadURL) {
+    ReadWritePCArgs args = GetParam();
+    t::geometry::PointCloud pc1;
+    for (const auto &attr_tensor : pc_data_1) {
+        const auto &tensor = attr_tensor.second;
+        pc1.SetPointAttr(attr_tensor.first,
+                         core::Tensor(tensor.values, tensor.size,
+                                      core::Dtype::Float64));
+    }
+    EXPECT_TRUE(t::io::WritePointCloud(
+            args.filename, pc1,
+            {bool(args.write_ascii), bool(args.compressed), false}));
+    t::geometry::PointCloud pc2;
+    EXPECT_TRUE(t::io::ReadPointCloud(args.filename, pc2,
+                                      {"auto", false, false, false}));
+
+    io::RegisterByteSource(
+            "test", [](const std::string &path)
+                            -> std::shared_ptr<io::ByteSource> {
+                std::string filename =
+                        path.substr(std::string("test://").size());
+                auto source = std::make_shared<SmallPartFileByteSource>(
+                        filename.substr(0, filename.find('?')));
+                return source->IsOpen() ? source : nullptr;
+            });
+    t::geometry::PointCloud pc3;
+    EXPECT_TRUE(t::io::ReadPointCloud("test://" + args.filename + "?v=1",
+                                      pc3, {"auto", false, false, false}));
+    for (const auto &attribute_rel_tol : args.attributes_rel_tols) {
+        const std::string &attribute = attribute_rel_tol.first;
+        SCOPED_TRACE(attribute);
+        EXPECT_TRUE(pc3.GetPointAttr(attribute).AllClose(
+                pc2.GetPointAttr(attribute), 0, 0));
+    }
+}
+
 TEST_P(ReadWriteTPC, WriteBadData) {
     ReadWritePCArgs args = GetParam();
     core::Device device("CPU", 0);
@@ -186,5 +265,56 @@ TEST(TPointCloudIO, ReadPointCloudFromPLY4) {
     EXPECT_EQ(pcd.GetPointAttr("intensity").GetLength(), 7);
 }
 
+// Reading binary PCD with colors, normals and other fields.
+TEST(TPointCloudIO, ReadPointCloudFromPCD) {
+    t::geometry::PointCloud pcd;
+    t::io::ReadPointCloud(std::string(TEST_DATA_DIR) + "/fragment.pcd", pcd,
+                          {"auto", false, false, true});
+    EXPECT_EQ(pcd.GetPoints().GetLength(), 113662);
+    EXPECT_EQ(pcd.GetPointNormals().GetLength(), 113662);
+    EXPECT_EQ(pcd.GetPointColors().GetDtype(), core::Dtype::UInt8);
+    EXPECT_EQ(pcd.GetPointAttr("curvature").GetShape(),
+              core::SizeVector({113662, 1}));
+    EXPECT_FALSE(pcd.HasPointAttr("rgb"));
+}
+
+// Custom fields keep their dtype and count.
+TEST(TPointCloudIO, WriteReadPointCloudPCDFields) {
+    for (bool write_ascii : {false, true}) {
+        for (bool compressed : {false, true}) {
+            t::geometry::PointCloud pcd1;
+            pcd1.SetPoints(core::Tensor(std::vector<float>{0, 1, 2, 3, 4, 5},
+                                        {2, 3}, core::Dtype::Float32));
+            pcd1.SetPointColors(
+                    core::Tensor(std::vector<uint8_t>{255, 0, 10, 20, 30, 40},
+                                 {2, 3}, core::Dtype::UInt8));
+            pcd1.SetPointAttr("ring",
+                              core::Tensor(std::vector<uint16_t>{7, 9}, {2, 1},
+                                           core::Dtype::UInt16));
+            pcd1.SetPointAttr(
+                    "timestamp",
+                    core::Tensor(std::vector<double>{1.5e9, 1.5e9 + 0.25},
+                                 {2, 1}, core::Dtype::Float64));
+            pcd1.SetPointAttr("labels",
+                              core::Tensor(std::vector<int32_t>{1, -2, 3, -4},
+                                           {2, 2}, core::Dtype::Int32));
+            EXPECT_TRUE(t::io::WritePointCloud("test_fields.pcd", pcd1,
+                                               {write_ascii, compressed}));
+
+            t::geometry::PointCloud pcd2;
+            EXPECT_TRUE(t::io::ReadPointCloud("test_fields.pcd", pcd2,
+                                              {"auto", false, false, false}));
+            for (const std::string attr :
+                 {"points", "colors", "ring", "timestamp", "labels"}) {
+                SCOPED_TRACE(attr);
+                EXPECT_EQ(pcd2.GetPointAttr(attr).GetDtype(),
+                          pcd1.GetPointAttr(attr).GetDtype());
+                EXPECT_TRUE(pcd2.GetPointAttr(attr).AllClose(
+                        pcd1.GetPointAttr(attr), 0, 0));
+            }
+        }
+    }
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -0,0 +1,146 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/t/io/PointCloudStream.h"
+
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/t/io/PointCloudIO.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+static t::geometry::PointCloud CreateStreamPointCloud(int64_t begin,
+                                                      int64_t end) {
+    std::vector<float> points;
+    std::vector<uint8_t> colors;
+    std::vector<double> intensities;
+    for (int64_t i = begin; i < end; ++i) {
+        points.insert(points.end(), {i * 1.0f, i * 2.0f, i * 3.0f});
+        colors.insert(colors.end(),
+                      {static_cast<uint8_t>(i), static_cast<uint8_t>(2 * i),
+                       static_cast<uint8_t>(3 * i)});
+        intensities.push_back(i * 0.5);
+    }
+    int64_t n = end - begin;
+    t::geometry::PointCloud pcd;
+    pcd.SetPoints(core::Tensor(points, {n, 3}, core::Dtype::Float32));
+    pcd.SetPointColors(core::Tensor(colors, {n, 3}, core::Dtype::UInt8));
+    pcd.SetPointAttr("intensities",
+                     core::Tensor(intensities, {n, 1}, core::Dtype::Float64));
+    return pcd;
+}
+
+TEST(PointCloudStream, WriteReadPLY) {
+    for (bool write_ascii : {false, true}) {
+        const std::string filename = "test_stream.ply";
+        t::io::PointCloudWriter writer;
+        EXPECT_TRUE(writer.Open(filename, write_ascii));
+        EXPECT_TRUE(writer.WriteNext(CreateStreamPointCloud(0, 4)));
+        EXPECT_TRUE(writer.WriteNext(CreateStreamPointCloud(4, 7)));
+        EXPECT_TRUE(writer.WriteNext(CreateStreamPointCloud(7, 10)));
+        writer.Close();
+
+        t::geometry::PointCloud expected = CreateStreamPointCloud(0, 10);
+        t::geometry::PointCloud pcd;
+        EXPECT_TRUE(t::io::ReadPointCloud(filename, pcd,
+                                          {"auto", false, false, false}));
+        EXPECT_EQ(pcd.GetPoints().ToFlatVector<float>(),
+                  expected.GetPoints().ToFlatVector<float>());
+
+        t::io::PointCloudReader reader;
+        EXPECT_TRUE(reader.Open(filename));
+        EXPECT_EQ(reader.GetNumPoints(), 10);
+        std::vector<float> points;
+        std::vector<uint8_t> colors;
+        std::vector<double> intensities;
+        int64_t num_batches = 0;
+        while (!reader.IsEOF()) {
+            t::geometry::PointCloud batch = reader.ReadNext(4);
+            EXPECT_LE(batch.GetPoints().GetLength(), 4);
+            std::vector<float> batch_points =
+                    batch.GetPoints().ToFlatVector<float>();
+            std::vector<uint8_t> batch_colors =
+                    batch.GetPointColors().ToFlatVector<uint8_t>();
+            std::vector<double> batch_intensities =
+                    batch.GetPointAttr("intensities").ToFlatVector<double>();
+            points.insert(points.end(), batch_points.begin(),
+                          batch_points.end());
+            colors.insert(colors.end(), batch_colors.begin(),
+                          batch_colors.end());
+            intensities.insert(intensities.end(), batch_intensities.begin(),
+                               batch_intensities.end());
+            num_batches++;
+        }
+        EXPECT_EQ(num_batches, 3);
+        EXPECT_EQ(points, expected.GetPoints().ToFlatVector<float>());
+        EXPECT_EQ(colors, expected.GetPointColors().ToFlatVector<uint8_t>());
+        EXPECT_EQ(intensities, expected.GetPointAttr("intensities")
+                                       .ToFlatVector<double>());
+        EXPECT_EQ(reader.ReadNext(4).GetPoints().GetLength(), 0);
+    }
+}
+
+TEST(PointCloudStream, WriteReadXYZ) {
+    const std::string filename = "test_stream.xyz";
+    t::io::PointCloudWriter writer;
+    EXPECT_TRUE(writer.Open(filename));
+    EXPECT_TRUE(writer.WriteNext(CreateStreamPointCloud(0, 5)));
+    EXPECT_TRUE(writer.WriteNext(CreateStreamPointCloud(5, 6)));
+    writer.Close();
+
+    t::io::PointCloudReader reader;
+    EXPECT_TRUE(reader.Open(filename));
+    EXPECT_EQ(reader.GetNumPoints(), -1);
+    std::vector<double> points;
+    while (!reader.IsEOF()) {
+        std::vector<double> batch_points =
+                reader.ReadNext(2).GetPoints().ToFlatVector<double>();
+        points.insert(points.end(), batch_points.begin(), batch_points.end());
+    }
+    std::vector<float> expected =
+            CreateStreamPointCloud(0, 6).GetPoints().ToFlatVector<float>();
+    EXPECT_EQ(points, std::vector<double>(expected.begin(), expected.end()));
+}
+
+TEST(PointCloudStream, ReadPCD) {
+    t::io::PointCloudReader reader;
+    EXPECT_TRUE(reader.Open(std::string(TEST_DATA_DIR) + "/fragment.pcd"));
+    int64_t num_points = 0;
+    while (!reader.IsEOF()) {
+        t::geometry::PointCloud batch = reader.ReadNext(50000);
+        EXPECT_TRUE(batch.HasPointColors());
+        num_points += batch.GetPoints().GetLength();
+    }
+    EXPECT_EQ(num_points, reader.GetNumPoints());
+    EXPECT_GT(num_points, 0);
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -0,0 +1,78 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/t/io/RGBDSequenceLoader.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "open3d/io/ImageIO.h"
+#include "open3d/t/geometry/Image.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(RGBDSequenceLoader, NextFrame) {
+    std::vector<std::pair<std::string, std::string>> filenames;
+    for (int i = 0; i < 5; ++i) {
+        filenames.emplace_back(
+                fmt::format("{}/RGBD/color/{:05d}.jpg", TEST_DATA_DIR, i),
+                fmt::format("{}/RGBD/depth/{:05d}.png", TEST_DATA_DIR, i));
+    }
+    filenames.emplace_back("missing.jpg", "missing.png");
+
+    // A queue shallower than the sequence reuses its slots.
+    t::io::RGBDSequenceLoader loader(filenames, core::Device("CPU:0"), 2);
+    EXPECT_EQ(loader.GetNumFrames(), 6);
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_FALSE(loader.IsEOF());
+        t::geometry::RGBDImage rgbd = loader.NextFrame();
+        geometry::Image color, depth;
+        ASSERT_TRUE(io::ReadImage(filenames[i].first, color));
+        ASSERT_TRUE(io::ReadImage(filenames[i].second, depth));
+        EXPECT_TRUE(rgbd.color_.AsTensor().AllClose(
+                t::geometry::Image::FromLegacyImage(color).AsTensor()));
+        EXPECT_TRUE(rgbd.depth_.AsTensor().AllClose(
+                t::geometry::Image::FromLegacyImage(depth).AsTensor()));
+    }
+    EXPECT_TRUE(loader.NextFrame().IsEmpty());
+    EXPECT_TRUE(loader.IsEOF());
+    EXPECT_TRUE(loader.NextFrame().IsEmpty());
+}
+
+TEST(RGBDSequenceLoader, StopEarly) {
+    std::vector<std::pair<std::string, std::string>> filenames(
+            5, {std::string(TEST_DATA_DIR) + "/RGBD/color/00000.jpg",
+                std::string(TEST_DATA_DIR) + "/RGBD/depth/00000.png"});
+    t::io::RGBDSequenceLoader loader(filenames, core::Device("CPU:0"), 1, 4);
+    EXPECT_FALSE(loader.NextFrame().IsEmpty());
+}
+
+}  // namespace tests
+}  // namespace open3d
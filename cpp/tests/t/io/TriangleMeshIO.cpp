@@ -0,0 +1,245 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/t/io/TriangleMeshIO.h"
+
+#include <cstdio>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/geometry/TriangleMesh.h"
+#include "open3d/t/io/PointCloudIO.h"
+#include "open3d/utility/FileSystem.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(TTriangleMeshIO, WriteReadTriangleMeshO3DT) {
+    t::geometry::TriangleMesh mesh1;
+    mesh1.SetVertices(core::Tensor(
+            std::vector<float>{0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1}, {4, 3},
+            core::Dtype::Float32));
+    mesh1.SetVertexColors(core::Tensor(
+            std::vector<uint8_t>{255, 0, 0, 0, 255, 0, 0, 0, 255, 9, 9, 9},
+            {4, 3}, core::Dtype::UInt8));
+    mesh1.SetVertexAttr("labels", core::Tensor(std::vector<int32_t>{1, 2, 3, 4},
+                                               {4}, core::Dtype::Int32));
+    mesh1.SetTriangles(core::Tensor(std::vector<int64_t>{0, 1, 2, 0, 2, 3},
+                                    {2, 3}, core::Dtype::Int64));
+    mesh1.SetTriangleNormals(core::Tensor(
+            std::vector<double>{0, 0, 1, 1, 0, 0}, {2, 3},
+            core::Dtype::Float64));
+
+    for (bool compressed : {false, true}) {
+        SCOPED_TRACE(compressed);
+        EXPECT_TRUE(t::io::WriteTriangleMesh("test.o3dt", mesh1, false,
+                                             compressed));
+        t::geometry::TriangleMesh mesh2;
+        EXPECT_TRUE(t::io::ReadTriangleMesh("test.o3dt", mesh2));
+        for (const std::string attr : {"vertices", "colors", "labels"}) {
+            SCOPED_TRACE(attr);
+            EXPECT_EQ(mesh2.GetVertexAttr(attr).GetDtype(),
+                      mesh1.GetVertexAttr(attr).GetDtype());
+            EXPECT_TRUE(mesh2.GetVertexAttr(attr).AllClose(
+                    mesh1.GetVertexAttr(attr), 0, 0));
+        }
+        for (const std::string attr : {"triangles", "normals"}) {
+            SCOPED_TRACE(attr);
+            EXPECT_EQ(mesh2.GetTriangleAttr(attr).GetDtype(),
+                      mesh1.GetTriangleAttr(attr).GetDtype());
+            EXPECT_TRUE(mesh2.GetTriangleAttr(attr).AllClose(
+                    mesh1.GetTriangleAttr(attr), 0, 0));
+        }
+
+        // Loaded attributes can be modified without changing the file.
+        mesh2.GetVertices().Fill(5);
+        t::geometry::TriangleMesh mesh3;
+        EXPECT_TRUE(t::io::ReadTriangleMesh("test.o3dt", mesh3));
+        EXPECT_TRUE(mesh3.GetVertices().AllClose(mesh1.GetVertices(), 0, 0));
+    }
+
+    // A point cloud file is not a triangle mesh.
+    t::geometry::PointCloud pcd(mesh1.GetVertices());
+    EXPECT_TRUE(t::io::WritePointCloud("test_pcd.o3dt", pcd));
+    t::geometry::TriangleMesh mesh4;
+    EXPECT_FALSE(t::io::ReadTriangleMesh("test_pcd.o3dt", mesh4));
+}
+
+TEST(TTriangleMeshIO, WriteReadTriangleMeshO3DTFiltered) {
+    // A grid spanning several chunks, whose rows compress well once filtered.
+    const int64_t n = 600;
+    std::vector<double> vertices;
+    std::vector<int64_t> triangles;
+    for (int64_t i = 0; i < n; ++i) {
+        for (int64_t j = 0; j < n; ++j) {
+            vertices.insert(vertices.end(), {i * 0.01, j * 0.01, 0.0});
+            if (i + 1 < n && j + 1 < n) {
+                int64_t v = i * n + j;
+                triangles.insert(triangles.end(),
+                                 {v, v + 1, v + n, v + 1, v + n + 1, v + n});
+            }
+        }
+    }
+    t::geometry::TriangleMesh mesh1;
+    mesh1.SetVertices(core::Tensor(vertices, {n * n, 3}, core::Dtype::Float64));
+    int64_t num_triangles = static_cast<int64_t>(triangles.size()) / 3;
+    mesh1.SetTriangles(
+            core::Tensor(triangles, {num_triangles, 3}, core::Dtype::Int64));
+
+    EXPECT_TRUE(t::io::WriteTriangleMesh("test_grid.o3dt", mesh1, false,
+                                         false));
+    EXPECT_TRUE(t::io::WriteTriangleMesh("test_grid_compressed.o3dt", mesh1,
+                                         false, true));
+    auto get_file_size = [](const std::string &filename) {
+        utility::filesystem::CFile file;
+        file.Open(filename, "rb");
+        return file.GetFileSize();
+    };
+    EXPECT_LT(get_file_size("test_grid_compressed.o3dt"),
+              get_file_size("test_grid.o3dt") / 4);
+    t::geometry::TriangleMesh mesh2;
+    EXPECT_TRUE(t::io::ReadTriangleMesh("test_grid_compressed.o3dt", mesh2));
+    EXPECT_TRUE(mesh2.GetVertices().AllClose(mesh1.GetVertices(), 0, 0));
+    EXPECT_TRUE(mesh2.GetTriangles().AllClose(mesh1.GetTriangles(), 0, 0));
+}
+
+// A unit square of two triangles.
+static t::geometry::TriangleMesh CreateSquareMesh() {
+    t::geometry::TriangleMesh mesh;
+    mesh.SetVertices(core::Tensor(
+            std::vector<float>{0, 0, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0}, {4, 3},
+            core::Dtype::Float32));
+    mesh.SetTriangles(core::Tensor(std::vector<int64_t>{0, 1, 2, 0, 2, 3},
+                                   {2, 3}, core::Dtype::Int64));
+    return mesh;
+}
+
+static void WriteTextFile(const std::string &filename,
+                          const std::string &content) {
+    FILE *file = fopen(filename.c_str(), "w");
+    fputs(content.c_str(), file);
+    fclose(file);
+}
+
+TEST(TTriangleMeshIO, WriteReadTriangleMeshPLY) {
+    t::geometry::TriangleMesh mesh1 = CreateSquareMesh();
+    mesh1.SetVertexNormals(core::Tensor(
+            std::vector<float>{0, 0, 1, 0, 0, 1, 0, 0, 1, 0, 0, 1}, {4, 3},
+            core::Dtype::Float32));
+    mesh1.SetVertexColors(core::Tensor(
+            std::vector<float>{1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0}, {4, 3},
+            core::Dtype::Float32));
+    for (bool write_ascii : {false, true}) {
+        SCOPED_TRACE(write_ascii);
+        EXPECT_TRUE(t::io::WriteTriangleMesh("test_mesh.ply", mesh1,
+                                             write_ascii));
+        t::geometry::TriangleMesh mesh2;
+        EXPECT_TRUE(t::io::ReadTriangleMesh("test_mesh.ply", mesh2));
+        for (const std::string attr : {"vertices", "normals", "colors"}) {
+            SCOPED_TRACE(attr);
+            EXPECT_EQ(mesh2.GetVertexAttr(attr).GetDtype(),
+                      core::Dtype::Float32);
+            EXPECT_TRUE(mesh2.GetVertexAttr(attr).AllClose(
+                    mesh1.GetVertexAttr(attr)));
+        }
+        EXPECT_TRUE(mesh2.GetTriangles().AllClose(mesh1.GetTriangles(), 0, 0));
+    }
+}
+
+TEST(TTriangleMeshIO, WriteReadTriangleMeshSTL) {
+    t::geometry::TriangleMesh mesh1 = CreateSquareMesh();
+    for (bool write_ascii : {false, true}) {
+        SCOPED_TRACE(write_ascii);
+        EXPECT_TRUE(t::io::WriteTriangleMesh("test_mesh.stl", mesh1,
+                                             write_ascii));
+        // The vertices of the facets are merged in their first order.
+        t::geometry::TriangleMesh mesh2;
+        EXPECT_TRUE(t::io::ReadTriangleMesh("test_mesh.stl", mesh2));
+        EXPECT_TRUE(mesh2.GetVertices().AllClose(mesh1.GetVertices()));
+        EXPECT_TRUE(mesh2.GetTriangles().AllClose(mesh1.GetTriangles(), 0, 0));
+        EXPECT_TRUE(mesh2.GetTriangleNormals().AllClose(core::Tensor(
+                std::vector<float>{0, 0, 1, 0, 0, 1}, {2, 3},
+                core::Dtype::Float32)));
+    }
+}
+
+TEST(TTriangleMeshIO, WriteReadTriangleMeshGzip) {
+    t::geometry::TriangleMesh mesh1 = CreateSquareMesh();
+    for (const std::string filename : {"test_mesh.ply.gz", "test_mesh.stl.gz",
+                                       "test_mesh.o3dt.gz"}) {
+        SCOPED_TRACE(filename);
+        EXPECT_TRUE(t::io::WriteTriangleMesh(filename, mesh1));
+        t::geometry::TriangleMesh mesh2;
+        EXPECT_TRUE(t::io::ReadTriangleMesh(filename, mesh2));
+        EXPECT_TRUE(mesh2.GetVertices().AllClose(mesh1.GetVertices()));
+        EXPECT_TRUE(mesh2.GetTriangles().AllClose(mesh1.GetTriangles(), 0, 0));
+    }
+}
+
+TEST(TTriangleMeshIO, ReadTriangleMeshOBJ) {
+    // Polygons are triangulated as fans and negative indices are relative.
+    WriteTextFile("test_mesh.obj",
+                  "# square\n"
+                  "v 0 0 0 1 0 0\nv 1 0 0 0 1 0\nv 1 1 0 0 0 1\n"
+                  "v 0 1 0 0 0 0\n"
+                  "vn 0 0 1\n"
+                  "vt 0 0\n"
+                  "f -4/1/1 -3/1/1 -2//1 -1//1\n");
+    t::geometry::TriangleMesh mesh1 = CreateSquareMesh();
+    t::geometry::TriangleMesh mesh2;
+    EXPECT_TRUE(t::io::ReadTriangleMesh("test_mesh.obj", mesh2));
+    EXPECT_TRUE(mesh2.GetVertices().AllClose(mesh1.GetVertices()));
+    EXPECT_TRUE(mesh2.GetTriangles().AllClose(mesh1.GetTriangles(), 0, 0));
+    EXPECT_TRUE(mesh2.GetVertexColors().AllClose(core::Tensor(
+            std::vector<float>{1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0}, {4, 3},
+            core::Dtype::Float32)));
+    EXPECT_TRUE(mesh2.GetVertexNormals().AllClose(core::Tensor(
+            std::vector<float>{0, 0, 1, 0, 0, 1, 0, 0, 1, 0, 0, 1}, {4, 3},
+            core::Dtype::Float32)));
+
+    WriteTextFile("test_mesh.obj", "v 0 0 0\nf 1 2 3\n");
+    EXPECT_FALSE(t::io::ReadTriangleMesh("test_mesh.obj", mesh2));
+}
+
+TEST(TTriangleMeshIO, ReadTriangleMeshOFF) {
+    WriteTextFile("test_mesh.off",
+                  "OFF\n# square\n4 1 0\n0 0 0\n1 0 0\n\n1 1 0\n0 1 0\n"
+                  "4 0 1 2 3\n");
+    t::geometry::TriangleMesh mesh1 = CreateSquareMesh();
+    t::geometry::TriangleMesh mesh2;
+    EXPECT_TRUE(t::io::ReadTriangleMesh("test_mesh.off", mesh2));
+    EXPECT_TRUE(mesh2.GetVertices().AllClose(mesh1.GetVertices()));
+    EXPECT_TRUE(mesh2.GetTriangles().AllClose(mesh1.GetTriangles(), 0, 0));
+
+    WriteTextFile("test_mesh.off", "OFF\n4 1 0\n0 0 0\n1 0 0\n");
+    EXPECT_FALSE(t::io::ReadTriangleMesh("test_mesh.off", mesh2));
+}
+
+}  // namespace tests
+}  // namespace open3d
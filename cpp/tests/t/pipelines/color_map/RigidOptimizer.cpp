@@ -0,0 +1,196 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/t/pipelines/color_map/RigidOptimizer.h"
+
+#include <cmath>
+
+#include "core/CoreTest.h"
+#include "open3d/core/EigenConverter.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/pipelines/color_map/RigidOptimizer.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+class ColorMapPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(ColorMap,
+                         ColorMapPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+static const int64_t kRows = 64;
+static const int64_t kCols = 64;
+
+// A textured wall at one meter, seen by a 64x64 camera.
+static t::geometry::RGBDImage SyntheticRGBDImage(const core::Device &device) {
+    std::vector<uint8_t> color_values(kRows * kCols * 3);
+    for (int64_t v = 0; v < kRows; ++v) {
+        for (int64_t u = 0; u < kCols; ++u) {
+            int64_t idx = v * kCols + u;
+            color_values[3 * idx + 0] = static_cast<uint8_t>(4 * u);
+            color_values[3 * idx + 1] = static_cast<uint8_t>(4 * v);
+            color_values[3 * idx + 2] = static_cast<uint8_t>(
+                    128 + 100 * std::sin(u / 3.0) * std::cos(v / 4.0));
+        }
+    }
+    core::Tensor color(color_values, {kRows, kCols, 3}, core::Dtype::UInt8,
+                       device);
+    core::Tensor depth = core::Tensor::Full({kRows, kCols, 1}, 1.0f,
+                                            core::Dtype::Float32, device);
+    return t::geometry::RGBDImage(t::geometry::Image(color),
+                                  t::geometry::Image(depth));
+}
+
+// Vertices on the wall that project to the centers of the pixels (u, v) of
+// the inner part of the image, plus a vertex behind the camera.
+static std::vector<Eigen::Vector3d> SyntheticVertices() {
+    std::vector<Eigen::Vector3d> vertices;
+    for (int v = 16; v < 48; v += 4) {
+        for (int u = 16; u < 48; u += 4) {
+            vertices.emplace_back((u + 0.5 - 32) / 60, (v + 0.5 - 32) / 60,
+                                  1.0);
+        }
+    }
+    vertices.emplace_back((16.5 - 32) / 60, (16.5 - 32) / 60, -1.0);
+    return vertices;
+}
+
+static t::geometry::TriangleMesh SyntheticMesh(const core::Device &device) {
+    std::vector<Eigen::Vector3d> vertices = SyntheticVertices();
+    std::vector<float> values;
+    for (const Eigen::Vector3d &vertex : vertices) {
+        values.insert(values.end(), {float(vertex(0)), float(vertex(1)),
+                                     float(vertex(2))});
+    }
+    return t::geometry::TriangleMesh(
+            core::Tensor(values, {int64_t(vertices.size()), 3},
+                         core::Dtype::Float32, device),
+            core::Tensor({0, 3}, core::Dtype::Int64, device));
+}
+
+static const Eigen::Matrix3d kIntrinsic =
+        (Eigen::Matrix3d() << 60, 0, 32, 0, 60, 32, 0, 0, 1).finished();
+
+TEST_P(ColorMapPermuteDevices, RunRigidOptimizerColors) {
+    core::Device device = GetParam();
+
+    t::geometry::TriangleMesh mesh = SyntheticMesh(device);
+    std::vector<t::geometry::RGBDImage> images{SyntheticRGBDImage(device)};
+    core::Tensor intrinsics =
+            core::eigen_converter::EigenMatrixToTensor(kIntrinsic)
+                    .Reshape({1, 3, 3});
+    core::Tensor extrinsics =
+            core::Tensor::Eye(4, core::Dtype::Float64, core::Device("CPU:0"))
+                    .Reshape({1, 4, 4});
+
+    pipelines::color_map::RigidOptimizerOption option;
+    option.maximum_iteration_ = 0;
+    option.invisible_vertex_color_knn_ = 1;
+    core::Tensor colors, opt_extrinsics;
+    std::tie(colors, opt_extrinsics) =
+            t::pipelines::color_map::RunRigidOptimizer(
+                    mesh, images, intrinsics, extrinsics, option);
+
+    EXPECT_TRUE(opt_extrinsics.AllClose(extrinsics));
+    std::vector<float> values =
+            colors.Copy(core::Device("CPU:0")).ToFlatVector<float>();
+    int64_t i = 0;
+    for (int v = 16; v < 48; v += 4) {
+        for (int u = 16; u < 48; u += 4) {
+            EXPECT_NEAR(values[3 * i + 0], 4 * u / 255.0f, 1e-6);
+            EXPECT_NEAR(values[3 * i + 1], 4 * v / 255.0f, 1e-6);
+            ++i;
+        }
+    }
+    // The vertex behind the camera takes the color of its nearest visible
+    // vertex, the first one.
+    for (int c = 0; c < 3; ++c) {
+        EXPECT_EQ(values[3 * i + c], values[c]);
+    }
+}
+
+TEST_P(ColorMapPermuteDevices, RunRigidOptimizerMatchesLegacy) {
+    core::Device device = GetParam();
+
+    // The second camera is moved by a few millimeters, so the optimization
+    // has to realign it with the first one.
+    Eigen::Matrix4d T0 = Eigen::Matrix4d::Identity();
+    Eigen::Matrix4d T1 = Eigen::Matrix4d::Identity();
+    T1(0, 3) = 0.004;
+    T1(1, 3) = -0.003;
+
+    pipelines::color_map::RigidOptimizerOption option;
+    option.maximum_iteration_ = 3;
+    option.invisible_vertex_color_knn_ = 0;
+
+    t::geometry::RGBDImage rgbd = SyntheticRGBDImage(device);
+    geometry::TriangleMesh legacy_mesh;
+    legacy_mesh.vertices_ = SyntheticVertices();
+    std::vector<geometry::RGBDImage> legacy_images{rgbd.ToLegacyRGBDImage(),
+                                                   rgbd.ToLegacyRGBDImage()};
+    camera::PinholeCameraTrajectory trajectory;
+    for (const Eigen::Matrix4d &T : {T0, T1}) {
+        camera::PinholeCameraParameters parameters;
+        parameters.intrinsic_.SetIntrinsics(int(kCols), int(kRows), 60, 60, 32,
+                                            32);
+        parameters.extrinsic_ = T;
+        trajectory.parameters_.push_back(parameters);
+    }
+    geometry::TriangleMesh legacy_result =
+            pipelines::color_map::RunRigidOptimizer(legacy_mesh, legacy_images,
+                                                    trajectory, option);
+
+    core::Tensor intrinsics =
+            core::eigen_converter::EigenMatrixToTensor(kIntrinsic)
+                    .Reshape({1, 3, 3})
+                    .Broadcast({2, 3, 3})
+                    .Contiguous();
+    core::Tensor extrinsics({2, 4, 4}, core::Dtype::Float64,
+                            core::Device("CPU:0"));
+    extrinsics[0] = core::eigen_converter::EigenMatrixToTensor(T0);
+    extrinsics[1] = core::eigen_converter::EigenMatrixToTensor(T1);
+    core::Tensor colors, opt_extrinsics;
+    std::tie(colors, opt_extrinsics) =
+            t::pipelines::color_map::RunRigidOptimizer(
+                    SyntheticMesh(device), {rgbd, rgbd}, intrinsics,
+                    extrinsics, option);
+
+    EXPECT_EQ(opt_extrinsics.GetShape(), core::SizeVector({2, 4, 4}));
+    std::vector<float> values =
+            colors.Copy(core::Device("CPU:0")).ToFlatVector<float>();
+    ASSERT_EQ(values.size(), 3 * legacy_result.vertex_colors_.size());
+    for (size_t i = 0; i < legacy_result.vertex_colors_.size(); ++i) {
+        for (int c = 0; c < 3; ++c) {
+            EXPECT_NEAR(values[3 * i + c], legacy_result.vertex_colors_[i](c),
+                        1e-5);
+        }
+    }
+}
+
+}  // namespace tests
+}  // namespace open3d
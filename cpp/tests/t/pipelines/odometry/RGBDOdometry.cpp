@@ -0,0 +1,138 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/odometry/RGBDOdometry.h"
+
+#include <cmath>
+
+#include "core/CoreTest.h"
+#include "open3d/core/Tensor.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+class OdometryPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(Odometry,
+                         OdometryPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+// A textured bumpy surface, so that all the degrees of freedom are
+// constrained, seen by a 64x64 camera.
+static t::geometry::RGBDImage SyntheticRGBDImage(const core::Device &device) {
+    const int64_t rows = 64, cols = 64;
+    std::vector<uint16_t> depth_values(rows * cols);
+    std::vector<uint8_t> color_values(rows * cols * 3);
+    for (int64_t v = 0; v < rows; ++v) {
+        for (int64_t u = 0; u < cols; ++u) {
+            int64_t idx = v * cols + u;
+            depth_values[idx] = static_cast<uint16_t>(
+                    1000 + 100 * std::sin(u / 6.0) + 100 * std::cos(v / 5.0));
+            uint8_t intensity = static_cast<uint8_t>(
+                    128 + 100 * std::sin(u / 3.0) * std::cos(v / 4.0));
+            for (int64_t c = 0; c < 3; ++c) {
+                color_values[3 * idx + c] = intensity;
+            }
+        }
+    }
+    core::Tensor depth(depth_values, {rows, cols, 1}, core::Dtype::UInt16,
+                       device);
+    core::Tensor color(color_values, {rows, cols, 3}, core::Dtype::UInt8,
+                       device);
+    return t::geometry::RGBDImage(t::geometry::Image(color),
+                                  t::geometry::Image(depth));
+}
+
+static core::Tensor SyntheticIntrinsics() {
+    return core::Tensor(std::vector<double>{60, 0, 32, 0, 60, 32, 0, 0, 1},
+                        {3, 3}, core::Dtype::Float64);
+}
+
+TEST_P(OdometryPermuteDevices, CreateVertexNormalMap) {
+    core::Device device = GetParam();
+
+    t::geometry::Image depth(
+            core::Tensor::Full({4, 4, 1}, 2.0f, core::Dtype::Float32, device));
+    depth.AsTensor()[3][3][0] = 0.0f;
+    core::Tensor intrinsics(std::vector<double>{2, 0, 1, 0, 2, 1, 0, 0, 1},
+                            {3, 3}, core::Dtype::Float64);
+
+    core::Tensor vertex_map =
+            t::pipelines::odometry::CreateVertexMap(depth, intrinsics);
+    EXPECT_EQ(vertex_map.GetShape(), core::SizeVector({4, 4, 3}));
+    EXPECT_EQ(vertex_map[2][3].ToFlatVector<float>(),
+              std::vector<float>({2, 1, 2}));
+    EXPECT_EQ(vertex_map[3][3].ToFlatVector<float>(),
+              std::vector<float>({0, 0, 0}));
+
+    core::Tensor normal_map =
+            t::pipelines::odometry::CreateNormalMap(vertex_map);
+    EXPECT_EQ(normal_map.GetShape(), core::SizeVector({4, 4, 3}));
+    EXPECT_EQ(normal_map[0][0].ToFlatVector<float>(),
+              std::vector<float>({0, 0, 1}));
+    // The last row and column, and the neighbors of the invalid vertex, have
+    // no normal.
+    EXPECT_EQ(normal_map[3][0].ToFlatVector<float>(),
+              std::vector<float>({0, 0, 0}));
+    EXPECT_EQ(normal_map[2][3].ToFlatVector<float>(),
+              std::vector<float>({0, 0, 0}));
+}
+
+TEST_P(OdometryPermuteDevices, RGBDOdometryMultiScale) {
+    core::Device device = GetParam();
+
+    t::geometry::RGBDImage rgbd = SyntheticRGBDImage(device);
+    core::Tensor intrinsics = SyntheticIntrinsics();
+
+    // The frames are identical, so the odometry must undo the initial
+    // perturbation. The intensity term looks up the nearest pixel, which
+    // bounds its accuracy to about half a pixel.
+    core::Tensor init = core::Tensor::Eye(4, core::Dtype::Float64,
+                                          core::Device("CPU:0"));
+    init[0][3] = 0.03;
+    init[1][3] = -0.02;
+    core::Tensor identity = core::Tensor::Eye(4, core::Dtype::Float64,
+                                              core::Device("CPU:0"));
+
+    for (t::pipelines::odometry::Method method :
+         {t::pipelines::odometry::Method::PointToPlane,
+          t::pipelines::odometry::Method::Intensity,
+          t::pipelines::odometry::Method::Hybrid}) {
+        t::pipelines::odometry::OdometryResult result =
+                t::pipelines::odometry::RGBDOdometryMultiScale(
+                        rgbd, rgbd, intrinsics, init, 1000.0f, 3.0f,
+                        {10, 5, 3}, method);
+        EXPECT_EQ(result.transformation_.GetDtype(), core::Dtype::Float64);
+        double atol =
+                method == t::pipelines::odometry::Method::PointToPlane ? 1e-3
+                                                                       : 1e-2;
+        EXPECT_TRUE(result.transformation_.AllClose(identity, 0, atol));
+        EXPECT_GT(result.fitness_, 0.5);
+    }
+}
+
+}  // namespace tests
+}  // namespace open3d
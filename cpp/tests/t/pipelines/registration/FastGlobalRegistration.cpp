@@ -0,0 +1,111 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/t/pipelines/registration/FastGlobalRegistration.h"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "core/CoreTest.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/pipelines/registration/Registration.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+class FastGlobalRegistrationPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(FastGlobalRegistration,
+                         FastGlobalRegistrationPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(FastGlobalRegistrationPermuteDevices,
+       FastGlobalRegistrationBasedOnCorrespondence) {
+    core::Device device = GetParam();
+    core::Dtype dtype = core::Dtype::Float32;
+
+    // Rotation of 0.5 rad around z and 0.2 rad around x, and a translation.
+    const float cz = std::cos(0.5f), sz = std::sin(0.5f);
+    const float cx = std::cos(0.2f), sx = std::sin(0.2f);
+    std::vector<float> T = {cz,  -sz * cx, sz * sx,  0.3f,  //
+                            sz,  cz * cx,  -cz * sx, -0.2f,  //
+                            0.f, sx,       cx,       0.1f,  //
+                            0.f, 0.f,      0.f,      1.f};
+
+    const int64_t n = 400;
+    std::mt19937 engine(0);
+    std::uniform_real_distribution<float> distribution(0.f, 1.f);
+    std::vector<float> source_points, target_points;
+    for (int64_t i = 0; i < n; ++i) {
+        float p[3] = {distribution(engine), distribution(engine),
+                      0.5f * distribution(engine)};
+        for (int k = 0; k < 3; ++k) {
+            source_points.push_back(p[k]);
+            target_points.push_back(T[4 * k] * p[0] + T[4 * k + 1] * p[1] +
+                                    T[4 * k + 2] * p[2] + T[4 * k + 3]);
+        }
+    }
+    t::geometry::PointCloud source(
+            core::Tensor(source_points, {n, 3}, dtype, device));
+    t::geometry::PointCloud target(
+            core::Tensor(target_points, {n, 3}, dtype, device));
+    core::Tensor indices =
+            core::Tensor::Arange(0, n, 1, core::Dtype::Int64, device);
+
+    t::pipelines::registration::RegistrationResult result =
+            t::pipelines::registration::
+                    FastGlobalRegistrationBasedOnCorrespondence(
+                            source, target, {indices, indices});
+    EXPECT_NEAR(result.fitness_, 1.0, 1e-6);
+    EXPECT_TRUE(result.transformation_.Copy(core::Device("CPU:0"))
+                        .AllClose(core::Tensor(T, {4, 4}, dtype), 1e-4,
+                                  1e-3));
+}
+
+TEST_P(FastGlobalRegistrationPermuteDevices, FastGlobalRegistrationFewTuples) {
+    core::Device device = GetParam();
+    core::Dtype dtype = core::Dtype::Float32;
+
+    // Without enough tuples, the registration keeps the identity.
+    t::geometry::PointCloud source(core::Tensor::Init<float>(
+            {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}}, device));
+    t::geometry::PointCloud target(core::Tensor::Init<float>(
+            {{0, 0, 0}, {3, 0, 0}, {0, 5, 0}}, device));
+    core::Tensor indices =
+            core::Tensor::Arange(0, 3, 1, core::Dtype::Int64, device);
+    t::pipelines::registration::RegistrationResult result =
+            t::pipelines::registration::
+                    FastGlobalRegistrationBasedOnCorrespondence(
+                            source, target, {indices, indices});
+    EXPECT_TRUE(result.transformation_.AllClose(
+            core::Tensor::Eye(4, dtype, device)));
+}
+
+}  // namespace tests
+}  // namespace open3d
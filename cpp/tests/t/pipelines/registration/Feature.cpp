@@ -0,0 +1,165 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/t/pipelines/registration/Feature.h"
+
+#include <cmath>
+#include <tuple>
+#include <vector>
+
+#include "core/CoreTest.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/pipelines/registration/Feature.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+class FeaturePermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(Feature,
+                         FeaturePermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+/// Points of a Fibonacci lattice on the unit sphere, with outward normals.
+static geometry::PointCloud CreateSpherePointCloud(int n) {
+    geometry::PointCloud pcd;
+    const double golden_angle = M_PI * (3.0 - std::sqrt(5.0));
+    for (int i = 0; i < n; ++i) {
+        double z = 1.0 - 2.0 * (i + 0.5) / n;
+        double r = std::sqrt(1.0 - z * z);
+        Eigen::Vector3d p(r * std::cos(golden_angle * i),
+                          r * std::sin(golden_angle * i), z);
+        pcd.points_.push_back(p);
+        pcd.normals_.push_back(p);
+    }
+    return pcd;
+}
+
+TEST_P(FeaturePermuteDevices, ComputeFPFHFeature) {
+    core::Device device = GetParam();
+    const int max_nn = 20;
+    geometry::PointCloud pcd_legacy = CreateSpherePointCloud(200);
+    t::geometry::PointCloud pcd = t::geometry::PointCloud::FromLegacyPointCloud(
+            pcd_legacy, core::Dtype::Float32, device);
+
+    core::Tensor fpfh =
+            t::pipelines::registration::ComputeFPFHFeature(pcd, max_nn);
+    EXPECT_EQ(fpfh.GetShape(), core::SizeVector({200, 33}));
+    EXPECT_EQ(fpfh.GetDevice(), device);
+
+    // Each of the 3 histograms sums to 100 in the SPFH and in the weighted
+    // neighbor SPFH.
+    core::Tensor sums =
+            fpfh.Reshape({200, 3, 11}).Sum({2}).Copy(core::Device("CPU:0"));
+    EXPECT_TRUE(sums.AllClose(
+            core::Tensor::Full({200, 3}, 200.0f, core::Dtype::Float32), 1e-4,
+            1e-2));
+
+    // Float64 features match the legacy ones, which are stored transposed.
+    core::Tensor fpfh_64 = t::pipelines::registration::ComputeFPFHFeature(
+            t::geometry::PointCloud::FromLegacyPointCloud(
+                    pcd_legacy, core::Dtype::Float64, device),
+            max_nn);
+    std::shared_ptr<pipelines::registration::Feature> fpfh_legacy =
+            pipelines::registration::ComputeFPFHFeature(
+                    pcd_legacy, geometry::KDTreeSearchParamKNN(max_nn));
+    std::vector<double> fpfh_legacy_vec;
+    for (int i = 0; i < 200; ++i) {
+        for (int j = 0; j < 33; ++j) {
+            fpfh_legacy_vec.push_back(fpfh_legacy->data_(j, i));
+        }
+    }
+    core::Tensor fpfh_legacy_t(fpfh_legacy_vec, {200, 33},
+                               core::Dtype::Float64);
+    EXPECT_TRUE(fpfh_64.Copy(core::Device("CPU:0"))
+                        .AllClose(fpfh_legacy_t, 1e-5, 1e-5));
+}
+
+TEST_P(FeaturePermuteDevices, ComputeFPFHFeatureRadius) {
+    core::Device device = GetParam();
+    geometry::PointCloud pcd_legacy = CreateSpherePointCloud(200);
+    t::geometry::PointCloud pcd = t::geometry::PointCloud::FromLegacyPointCloud(
+            pcd_legacy, core::Dtype::Float32, device);
+
+    // Without neighbors in the radius, the features are zero.
+    core::Tensor fpfh =
+            t::pipelines::registration::ComputeFPFHFeature(pcd, 30, 1e-3);
+    EXPECT_TRUE(fpfh.AllClose(core::Tensor::Zeros({200, 33},
+                                                  core::Dtype::Float32,
+                                                  device)));
+}
+
+TEST_P(FeaturePermuteDevices, FeatureKnnSearch) {
+    core::Device device = GetParam();
+    core::Tensor dataset = core::Tensor::Init<float>(
+            {{0, 0, 0}, {1, 0, 0}, {0, 2, 0}, {0, 0, 3}}, device);
+    core::Tensor queries =
+            core::Tensor::Init<float>({{0.9, 0, 0}, {0, 0, 2.5}}, device);
+
+    core::Tensor indices, distances;
+    std::tie(indices, distances) =
+            t::pipelines::registration::FeatureKnnSearch(queries, dataset, 2);
+    EXPECT_EQ(indices.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({1, 0, 3, 0}));
+    EXPECT_TRUE(distances.AllClose(
+            core::Tensor::Init<float>({{0.01, 0.81}, {0.25, 6.25}}, device),
+            1e-5, 1e-5));
+
+    // knn is limited by the size of the dataset.
+    std::tie(indices, distances) =
+            t::pipelines::registration::FeatureKnnSearch(queries, dataset, 10);
+    EXPECT_EQ(indices.GetShape(), core::SizeVector({2, 4}));
+}
+
+TEST_P(FeaturePermuteDevices, CorrespondencesFromFeatures) {
+    core::Device device = GetParam();
+    core::Tensor source_features =
+            core::Tensor::Init<float>({{0}, {1}, {5}, {10}}, device);
+    core::Tensor target_features =
+            core::Tensor::Init<float>({{9}, {0.1}, {4.9}}, device);
+
+    t::pipelines::registration::CorrespondenceSet corres =
+            t::pipelines::registration::CorrespondencesFromFeatures(
+                    source_features, target_features);
+    EXPECT_EQ(corres.first.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({0, 1, 2, 3}));
+    EXPECT_EQ(corres.second.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({1, 1, 2, 0}));
+
+    // Source 1 is not the nearest neighbor of target 1.
+    corres = t::pipelines::registration::CorrespondencesFromFeatures(
+            source_features, target_features, true);
+    EXPECT_EQ(corres.first.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({0, 2, 3}));
+    EXPECT_EQ(corres.second.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({1, 2, 0}));
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -26,9 +26,14 @@
 
 #include "open3d/t/pipelines/registration/Registration.h"
 
+#include <cmath>
+
 #include "core/CoreTest.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/core/nns/NearestNeighborSearch.h"
+#include "open3d/pipelines/registration/ColoredICP.h"
 #include "open3d/pipelines/registration/Registration.h"
+#include "open3d/pipelines/registration/RobustKernel.h"
 #include "open3d/t/io/PointCloudIO.h"
 #include "tests/UnitTest.h"
 
@@ -281,5 +286,501 @@ TEST_P(RegistrationPermuteDevices, RegistrationICPPointToPlane) {
     EXPECT_NEAR(reg_p2plane_t.inlier_rmse_, reg_p2plane_l.inlier_rmse_, 0.0005);
 }
 
+TEST_P(RegistrationPermuteDevices, RegistrationICPPointToPlaneCorrespondences) {
+    core::Device device = GetParam();
+    core::Dtype dtype = core::Dtype::Float32;
+
+    // A bumpy plane, and its copy shifted by 0.05 along its normal with 5
+    // outliers, which have no correspondence.
+    std::vector<float> target_points_vec;
+    std::vector<float> target_normals_vec;
+    std::vector<float> source_points_vec;
+    for (int i = 0; i < 5; ++i) {
+        for (int j = 0; j < 5; ++j) {
+            float x = 0.5f * i, y = 0.5f * j, z = 0.1f * (i % 2) * (j % 2);
+            target_points_vec.insert(target_points_vec.end(), {x, y, z});
+            target_normals_vec.insert(target_normals_vec.end(), {0, 0, 1});
+            source_points_vec.insert(source_points_vec.end(),
+                                     {x, y, z + 0.05f});
+        }
+        source_points_vec.insert(source_points_vec.end(), {0.5f * i, 0, 3});
+    }
+    t::geometry::PointCloud source(device);
+    source.SetPoints(core::Tensor(source_points_vec, {30, 3}, dtype, device));
+    t::geometry::PointCloud target(device);
+    target.SetPoints(core::Tensor(target_points_vec, {25, 3}, dtype, device));
+    target.SetPointNormals(
+            core::Tensor(target_normals_vec, {25, 3}, dtype, device));
+
+    // The iterations keep a correspondence slot per source point, and the
+    // result must be compacted as EvaluateRegistration compacts it.
+    double max_correspondence_dist = 0.4;
+    t::pipelines::registration::RegistrationResult result =
+            t::pipelines::registration::RegistrationICP(
+                    source, target, max_correspondence_dist,
+                    core::Tensor::Eye(4, dtype, device),
+                    t::pipelines::registration::
+                            TransformationEstimationPointToPlane(),
+                    t::pipelines::registration::ICPConvergenceCriteria(
+                            1e-6, 1e-6, 5));
+    t::pipelines::registration::RegistrationResult evaluation =
+            t::pipelines::registration::EvaluateRegistration(
+                    source, target, max_correspondence_dist,
+                    result.transformation_);
+
+    EXPECT_NEAR(result.fitness_, 25.0 / 30.0, 1e-6);
+    EXPECT_NEAR(result.fitness_, evaluation.fitness_, 1e-6);
+    EXPECT_NEAR(result.inlier_rmse_, evaluation.inlier_rmse_, 1e-5);
+    EXPECT_EQ(result.correspondence_select_bool_.GetShape(),
+              evaluation.correspondence_select_bool_.GetShape());
+    EXPECT_EQ(result.correspondence_select_bool_.ToFlatVector<bool>(),
+              evaluation.correspondence_select_bool_.ToFlatVector<bool>());
+    EXPECT_EQ(result.correspondence_set_.GetShape(),
+              evaluation.correspondence_set_.GetShape());
+    EXPECT_EQ(result.correspondence_set_.ToFlatVector<int64_t>(),
+              evaluation.correspondence_set_.ToFlatVector<int64_t>());
+}
+
+TEST_P(RegistrationPermuteDevices, RegistrationICPPointToPlaneRobustKernel) {
+    core::Device device = GetParam();
+    core::Dtype dtype = core::Dtype::Float32;
+
+    std::vector<float> src_points_vec{
+            1.15495,  2.40671, 1.15061,  1.81481,  2.06281, 1.71927, 0.888322,
+            2.05068,  2.04879, 3.78842,  1.70788,  1.30246, 1.8437,  2.22894,
+            0.986237, 2.95706, 2.2018,   0.987878, 1.72644, 1.24356, 1.93486,
+            0.922024, 1.14872, 2.34317,  3.70293,  1.85134, 1.15357, 3.06505,
+            1.30386,  1.55279, 0.634826, 1.04995,  2.47046, 1.40107, 1.37469,
+            1.09687,  2.93002, 1.96242,  1.48532,  3.74384, 1.30258, 1.30244};
+    core::Tensor source_points(src_points_vec, {14, 3}, dtype, device);
+    t::geometry::PointCloud source_device(device);
+    source_device.SetPoints(source_points);
+
+    std::vector<float> target_points_vec{
+            2.41766, 2.05397, 1.74994, 1.37848, 2.19793, 1.66553, 2.24325,
+            2.27183, 1.33708, 3.09898, 1.98482, 1.77401, 1.81615, 1.48337,
+            1.49697, 3.01758, 2.20312, 1.51502, 2.38836, 1.39096, 1.74914,
+            1.30911, 1.4252,  1.37429, 3.16847, 1.39194, 1.90959, 1.59412,
+            1.53304, 1.5804,  1.34342, 2.19027, 1.30075};
+    core::Tensor target_points(target_points_vec, {11, 3}, dtype, device);
+
+    std::vector<float> target_normals_vec{
+            -0.0085016, -0.22355,  -0.519574, 0.257463,   -0.0738755, -0.698319,
+            0.0574301,  -0.484248, -0.409929, -0.0123503, -0.230172,  -0.52072,
+            0.355904,   -0.142007, -0.720467, 0.0674038,  -0.418757,  -0.458602,
+            0.226091,   0.258253,  -0.874024, 0.43979,    0.122441,   -0.574998,
+            0.109144,   0.180992,  -0.762368, 0.273325,   0.292013,   -0.903111,
+            0.385407,   -0.212348, -0.277818};
+    core::Tensor target_normals(target_normals_vec, {11, 3}, dtype, device);
+    t::geometry::PointCloud target_device(device);
+    target_device.SetPoints(target_points);
+    target_device.SetPointNormals(target_normals);
+
+    open3d::geometry::PointCloud source_l_down =
+            source_device.ToLegacyPointCloud();
+    open3d::geometry::PointCloud target_l_down =
+            target_device.ToLegacyPointCloud();
+
+    core::Tensor init_trans_t = core::Tensor::Eye(4, dtype, device);
+    Eigen::Matrix4d init_trans_l = Eigen::Matrix4d::Identity();
+    double max_correspondence_dist = 2.0;
+    double relative_fitness = 1e-6;
+    double relative_rmse = 1e-6;
+    int max_iterations = 2;
+    t::pipelines::registration::RobustKernel kernel_t(
+            t::pipelines::registration::RobustKernelMethod::TukeyLoss, 0.5);
+    auto kernel_l =
+            std::make_shared<open3d::pipelines::registration::TukeyLoss>(0.5);
+
+    t::pipelines::registration::RegistrationResult reg_p2plane_t =
+            open3d::t::pipelines::registration::RegistrationICP(
+                    source_device, target_device, max_correspondence_dist,
+                    init_trans_t,
+                    open3d::t::pipelines::registration::
+                            TransformationEstimationPointToPlane(kernel_t),
+                    open3d::t::pipelines::registration::ICPConvergenceCriteria(
+                            relative_fitness, relative_rmse, max_iterations));
+
+    pipelines::registration::RegistrationResult reg_p2plane_l =
+            open3d::pipelines::registration::RegistrationICP(
+                    source_l_down, target_l_down, max_correspondence_dist,
+                    init_trans_l,
+                    open3d::pipelines::registration::
+                            TransformationEstimationPointToPlane(kernel_l),
+                    open3d::pipelines::registration::ICPConvergenceCriteria(
+                            relative_fitness, relative_rmse, max_iterations));
+
+    EXPECT_NEAR(reg_p2plane_t.fitness_, reg_p2plane_l.fitness_, 0.0005);
+    EXPECT_NEAR(reg_p2plane_t.inlier_rmse_, reg_p2plane_l.inlier_rmse_, 0.0005);
+}
+
+TEST_P(RegistrationPermuteDevices, RegistrationColoredICP) {
+    core::Device device = GetParam();
+    core::Dtype dtype = core::Dtype::Float32;
+
+    std::vector<float> src_points_vec{
+            1.15495,  2.40671, 1.15061,  1.81481,  2.06281, 1.71927, 0.888322,
+            2.05068,  2.04879, 3.78842,  1.70788,  1.30246, 1.8437,  2.22894,
+            0.986237, 2.95706, 2.2018,   0.987878, 1.72644, 1.24356, 1.93486,
+            0.922024, 1.14872, 2.34317,  3.70293,  1.85134, 1.15357, 3.06505,
+            1.30386,  1.55279, 0.634826, 1.04995,  2.47046, 1.40107, 1.37469,
+            1.09687,  2.93002, 1.96242,  1.48532,  3.74384, 1.30258, 1.30244};
+    core::Tensor source_points(src_points_vec, {14, 3}, dtype, device);
+    t::geometry::PointCloud source_device(device);
+    source_device.SetPoints(source_points);
+
+    std::vector<float> target_points_vec{
+            2.41766, 2.05397, 1.74994, 1.37848, 2.19793, 1.66553, 2.24325,
+            2.27183, 1.33708, 3.09898, 1.98482, 1.77401, 1.81615, 1.48337,
+            1.49697, 3.01758, 2.20312, 1.51502, 2.38836, 1.39096, 1.74914,
+            1.30911, 1.4252,  1.37429, 3.16847, 1.39194, 1.90959, 1.59412,
+            1.53304, 1.5804,  1.34342, 2.19027, 1.30075};
+    core::Tensor target_points(target_points_vec, {11, 3}, dtype, device);
+
+    std::vector<float> target_normals_vec{
+            -0.0085016, -0.22355,  -0.519574, 0.257463,   -0.0738755, -0.698319,
+            0.0574301,  -0.484248, -0.409929, -0.0123503, -0.230172,  -0.52072,
+            0.355904,   -0.142007, -0.720467, 0.0674038,  -0.418757,  -0.458602,
+            0.226091,   0.258253,  -0.874024, 0.43979,    0.122441,   -0.574998,
+            0.109144,   0.180992,  -0.762368, 0.273325,   0.292013,   -0.903111,
+            0.385407,   -0.212348, -0.277818};
+    core::Tensor target_normals(target_normals_vec, {11, 3}, dtype, device);
+    t::geometry::PointCloud target_device(device);
+    target_device.SetPoints(target_points);
+    target_device.SetPointNormals(target_normals);
+
+    std::vector<float> src_colors_vec(14 * 3);
+    for (size_t i = 0; i < src_colors_vec.size(); ++i) {
+        src_colors_vec[i] = static_cast<float>((i * 7) % 11) / 10.0f;
+    }
+    source_device.SetPointColors(
+            core::Tensor(src_colors_vec, {14, 3}, dtype, device));
+    std::vector<float> target_colors_vec(11 * 3);
+    for (size_t i = 0; i < target_colors_vec.size(); ++i) {
+        target_colors_vec[i] = static_cast<float>((i * 5) % 11) / 10.0f;
+    }
+    target_device.SetPointColors(
+            core::Tensor(target_colors_vec, {11, 3}, dtype, device));
+
+    open3d::geometry::PointCloud source_l_down =
+            source_device.ToLegacyPointCloud();
+    open3d::geometry::PointCloud target_l_down =
+            target_device.ToLegacyPointCloud();
+
+    core::Tensor init_trans_t = core::Tensor::Eye(4, dtype, device);
+    Eigen::Matrix4d init_trans_l = Eigen::Matrix4d::Identity();
+    double max_correspondence_dist = 2.0;
+    double relative_fitness = 1e-6;
+    double relative_rmse = 1e-6;
+    int max_iterations = 2;
+
+    t::pipelines::registration::RegistrationResult reg_colored_t =
+            open3d::t::pipelines::registration::RegistrationICP(
+                    source_device, target_device, max_correspondence_dist,
+                    init_trans_t,
+                    open3d::t::pipelines::registration::
+                            TransformationEstimationForColoredICP(),
+                    open3d::t::pipelines::registration::ICPConvergenceCriteria(
+                            relative_fitness, relative_rmse, max_iterations));
+
+    pipelines::registration::RegistrationResult reg_colored_l =
+            open3d::pipelines::registration::RegistrationColoredICP(
+                    source_l_down, target_l_down, max_correspondence_dist,
+                    init_trans_l,
+                    open3d::pipelines::registration::
+                            TransformationEstimationForColoredICP(),
+                    open3d::pipelines::registration::ICPConvergenceCriteria(
+                            relative_fitness, relative_rmse, max_iterations));
+
+    EXPECT_NEAR(reg_colored_t.fitness_, reg_colored_l.fitness_, 0.0005);
+    EXPECT_NEAR(reg_colored_t.inlier_rmse_, reg_colored_l.inlier_rmse_, 0.0005);
+    EXPECT_FALSE(target_device.HasPointAttr("color_gradients"));
+}
+
+TEST_P(RegistrationPermuteDevices, RegistrationICPPrebuiltIndex) {
+    core::Device device = GetParam();
+    core::Dtype dtype = core::Dtype::Float32;
+
+    std::vector<float> src_points_vec{
+            1.15495,  2.40671, 1.15061,  1.81481,  2.06281, 1.71927, 0.888322,
+            2.05068,  2.04879, 3.78842,  1.70788,  1.30246, 1.8437,  2.22894,
+            0.986237, 2.95706, 2.2018,   0.987878, 1.72644, 1.24356, 1.93486,
+            0.922024, 1.14872, 2.34317,  3.70293,  1.85134, 1.15357, 3.06505,
+            1.30386,  1.55279, 0.634826, 1.04995,  2.47046, 1.40107, 1.37469,
+            1.09687,  2.93002, 1.96242,  1.48532,  3.74384, 1.30258, 1.30244};
+    core::Tensor source_points(src_points_vec, {14, 3}, dtype, device);
+    t::geometry::PointCloud source_device(device);
+    source_device.SetPoints(source_points);
+
+    std::vector<float> target_points_vec{
+            2.41766, 2.05397, 1.74994, 1.37848, 2.19793, 1.66553, 2.24325,
+            2.27183, 1.33708, 3.09898, 1.98482, 1.77401, 1.81615, 1.48337,
+            1.49697, 3.01758, 2.20312, 1.51502, 2.38836, 1.39096, 1.74914,
+            1.30911, 1.4252,  1.37429, 3.16847, 1.39194, 1.90959, 1.59412,
+            1.53304, 1.5804,  1.34342, 2.19027, 1.30075};
+    core::Tensor target_points(target_points_vec, {11, 3}, dtype, device);
+    t::geometry::PointCloud target_device(device);
+    target_device.SetPoints(target_points);
+
+    core::Tensor init_trans_t = core::Tensor::Eye(4, dtype, device);
+    double max_correspondence_dist = 1.25;
+    open3d::t::pipelines::registration::ICPConvergenceCriteria criteria(
+            1e-6, 1e-6, 2);
+
+    t::pipelines::registration::RegistrationResult reg_p2p =
+            open3d::t::pipelines::registration::RegistrationICP(
+                    source_device, target_device, max_correspondence_dist,
+                    init_trans_t,
+                    open3d::t::pipelines::registration::
+                            TransformationEstimationPointToPoint(),
+                    criteria);
+
+    // The index is built once and reused by both registrations.
+    core::nns::NearestNeighborSearch target_nns(target_device.GetPoints());
+    EXPECT_TRUE(target_nns.HybridIndex());
+    for (int i = 0; i < 2; ++i) {
+        t::pipelines::registration::RegistrationResult reg_p2p_prebuilt =
+                open3d::t::pipelines::registration::RegistrationICP(
+                        source_device, target_device, target_nns,
+                        max_correspondence_dist, init_trans_t,
+                        open3d::t::pipelines::registration::
+                                TransformationEstimationPointToPoint(),
+                        criteria);
+        EXPECT_DOUBLE_EQ(reg_p2p_prebuilt.fitness_, reg_p2p.fitness_);
+        EXPECT_DOUBLE_EQ(reg_p2p_prebuilt.inlier_rmse_, reg_p2p.inlier_rmse_);
+    }
+
+    t::pipelines::registration::RegistrationResult evaluation =
+            open3d::t::pipelines::registration::EvaluateRegistration(
+                    source_device, target_device, target_nns,
+                    max_correspondence_dist, init_trans_t);
+    t::pipelines::registration::RegistrationResult evaluation_ref =
+            open3d::t::pipelines::registration::EvaluateRegistration(
+                    source_device, target_device, max_correspondence_dist,
+                    init_trans_t);
+    EXPECT_DOUBLE_EQ(evaluation.fitness_, evaluation_ref.fitness_);
+    EXPECT_DOUBLE_EQ(evaluation.inlier_rmse_, evaluation_ref.inlier_rmse_);
+}
+
+TEST_P(RegistrationPermuteDevices, GetInformationMatrix) {
+    core::Device device = GetParam();
+    core::Dtype dtype = core::Dtype::Float32;
+
+    std::vector<float> src_points_vec{
+            1.15495,  2.40671, 1.15061,  1.81481,  2.06281, 1.71927, 0.888322,
+            2.05068,  2.04879, 3.78842,  1.70788,  1.30246, 1.8437,  2.22894,
+            0.986237, 2.95706, 2.2018,   0.987878, 1.72644, 1.24356, 1.93486,
+            0.922024, 1.14872, 2.34317,  3.70293,  1.85134, 1.15357, 3.06505,
+            1.30386,  1.55279, 0.634826, 1.04995,  2.47046, 1.40107, 1.37469,
+            1.09687,  2.93002, 1.96242,  1.48532,  3.74384, 1.30258, 1.30244};
+    core::Tensor source_points(src_points_vec, {14, 3}, dtype, device);
+    t::geometry::PointCloud source_device(device);
+    source_device.SetPoints(source_points);
+
+    std::vector<float> target_points_vec{
+            2.41766, 2.05397, 1.74994, 1.37848, 2.19793, 1.66553, 2.24325,
+            2.27183, 1.33708, 3.09898, 1.98482, 1.77401, 1.81615, 1.48337,
+            1.49697, 3.01758, 2.20312, 1.51502, 2.38836, 1.39096, 1.74914,
+            1.30911, 1.4252,  1.37429, 3.16847, 1.39194, 1.90959, 1.59412,
+            1.53304, 1.5804,  1.34342, 2.19027, 1.30075};
+    core::Tensor target_points(target_points_vec, {11, 3}, dtype, device);
+    t::geometry::PointCloud target_device(device);
+    target_device.SetPoints(target_points);
+
+    open3d::geometry::PointCloud source_l = source_device.ToLegacyPointCloud();
+    open3d::geometry::PointCloud target_l = target_device.ToLegacyPointCloud();
+    core::Tensor init_trans_t = core::Tensor::Eye(4, dtype, device);
+    double max_correspondence_dist = 1.25;
+
+    auto ExpectInformationEQ = [](const core::Tensor &information_t,
+                                  const Eigen::Matrix6d &information_l) {
+        std::vector<double> values = information_t.ToFlatVector<double>();
+        for (int i = 0; i < 6; ++i) {
+            for (int j = 0; j < 6; ++j) {
+                EXPECT_NEAR(values[6 * i + j], information_l(i, j), 1e-3);
+            }
+        }
+    };
+
+    core::Tensor information =
+            t::pipelines::registration::GetInformationMatrixFromPointClouds(
+                    source_device, target_device, max_correspondence_dist,
+                    init_trans_t);
+    EXPECT_EQ(information.GetShape(), core::SizeVector({6, 6}));
+    EXPECT_EQ(information.GetDtype(), core::Dtype::Float64);
+    EXPECT_EQ(information.GetDevice(), device);
+    Eigen::Matrix6d information_l =
+            pipelines::registration::GetInformationMatrixFromPointClouds(
+                    source_l, target_l, max_correspondence_dist,
+                    Eigen::Matrix4d::Identity());
+    ExpectInformationEQ(information, information_l);
+
+    core::nns::NearestNeighborSearch target_nns(target_device.GetPoints());
+    EXPECT_TRUE(target_nns.HybridIndex(max_correspondence_dist));
+    EXPECT_TRUE(
+            t::pipelines::registration::GetInformationMatrixFromPointClouds(
+                    source_device, target_device, target_nns,
+                    max_correspondence_dist, init_trans_t)
+                    .AllClose(information));
+
+    // From the correspondences of ICP, without a new search.
+    t::pipelines::registration::RegistrationResult reg_p2p =
+            t::pipelines::registration::RegistrationICP(
+                    source_device, target_device, max_correspondence_dist,
+                    init_trans_t,
+                    t::pipelines::registration::
+                            TransformationEstimationPointToPoint(),
+                    t::pipelines::registration::ICPConvergenceCriteria(
+                            1e-6, 1e-6, 2));
+    std::vector<float> transformation_vec =
+            reg_p2p.transformation_.ToFlatVector<float>();
+    Eigen::Matrix4d transformation_l;
+    for (int i = 0; i < 4; ++i) {
+        for (int j = 0; j < 4; ++j) {
+            transformation_l(i, j) = transformation_vec[4 * i + j];
+        }
+    }
+    core::Tensor information_icp =
+            t::pipelines::registration::GetInformationMatrix(target_device,
+                                                             reg_p2p);
+    information_l =
+            pipelines::registration::GetInformationMatrixFromPointClouds(
+                    source_l, target_l, max_correspondence_dist,
+                    transformation_l);
+    ExpectInformationEQ(information_icp, information_l);
+
+    // All the edges in one call.
+    t::pipelines::registration::RegistrationResult evaluation_back =
+            t::pipelines::registration::EvaluateRegistration(
+                    target_device, source_device, max_correspondence_dist,
+                    init_trans_t);
+    core::Tensor informations =
+            t::pipelines::registration::GetInformationMatrices(
+                    {source_device, target_device}, {{0, 1}, {1, 0}, {0, 1}},
+                    {reg_p2p, evaluation_back, reg_p2p});
+    EXPECT_EQ(informations.GetShape(), core::SizeVector({3, 6, 6}));
+    EXPECT_TRUE(informations[0].AllClose(information_icp));
+    EXPECT_TRUE(informations[1].AllClose(
+            t::pipelines::registration::GetInformationMatrix(
+                    source_device, evaluation_back)));
+    EXPECT_TRUE(informations[2].AllClose(information_icp));
+
+    EXPECT_EQ(t::pipelines::registration::GetInformationMatrices(
+                      {source_device, target_device}, {}, {})
+                      .GetShape(),
+              core::SizeVector({0, 6, 6}));
+    EXPECT_ANY_THROW(t::pipelines::registration::GetInformationMatrices(
+            {source_device, target_device}, {{0, 1}}, {}));
+    EXPECT_ANY_THROW(t::pipelines::registration::GetInformationMatrices(
+            {source_device, target_device}, {{0, 2}}, {reg_p2p}));
+}
+
+TEST_P(RegistrationPermuteDevices, RegistrationRANSACBasedOnCorrespondence) {
+    core::Device device = GetParam();
+    core::Dtype dtype = core::Dtype::Float32;
+
+    const int64_t n = 100;
+    std::vector<float> points_vec(n * 3);
+    for (int64_t i = 0; i < n; ++i) {
+        points_vec[i * 3 + 0] = std::fmod(i * 0.6180339f, 1.0f);
+        points_vec[i * 3 + 1] = std::fmod(i * 0.4142135f, 1.0f);
+        points_vec[i * 3 + 2] = std::fmod(i * 0.7320508f, 1.0f);
+    }
+    t::geometry::PointCloud source_device(
+            core::Tensor(points_vec, {n, 3}, dtype, device));
+    core::Tensor gt_trans = t::pipelines::PoseToTransformation(core::Tensor(
+            std::vector<float>{0.1, -0.2, 0.3, 0.5, -0.4, 0.2}, {6}, dtype,
+            device));
+    t::geometry::PointCloud target_device = source_device.Copy();
+    target_device.Transform(gt_trans);
+
+    // A quarter of the correspondences are outliers.
+    std::vector<int64_t> source_indices_vec(n), target_indices_vec(n);
+    for (int64_t i = 0; i < n; ++i) {
+        source_indices_vec[i] = i;
+        target_indices_vec[i] = i % 4 == 3 ? (i * 7 + 1) % n : i;
+    }
+    t::pipelines::registration::CorrespondenceSet corres = std::make_pair(
+            core::Tensor(source_indices_vec, {n}, core::Dtype::Int64, device),
+            core::Tensor(target_indices_vec, {n}, core::Dtype::Int64, device));
+
+    t::pipelines::registration::RegistrationResult result =
+            t::pipelines::registration::RegistrationRANSACBasedOnCorrespondence(
+                    source_device, target_device, corres, 0.01, 3, 0.9,
+                    t::pipelines::registration::RANSACConvergenceCriteria(
+                            1000, 0.999, 64));
+
+    EXPECT_NEAR(result.fitness_, 0.75, 1e-6);
+    EXPECT_LT(result.inlier_rmse_, 1e-3);
+    EXPECT_TRUE(result.transformation_.AllClose(gt_trans, 1e-4, 1e-3));
+    EXPECT_EQ(result.correspondence_set_.GetLength(), 75);
+}
+
+TEST_P(RegistrationPermuteDevices, RegistrationMultiScaleICP) {
+    core::Device device = GetParam();
+    core::Dtype dtype = core::Dtype::Float32;
+
+    std::vector<float> src_points_vec{
+            1.15495,  2.40671, 1.15061,  1.81481,  2.06281, 1.71927, 0.888322,
+            2.05068,  2.04879, 3.78842,  1.70788,  1.30246, 1.8437,  2.22894,
+            0.986237, 2.95706, 2.2018,   0.987878, 1.72644, 1.24356, 1.93486,
+            0.922024, 1.14872, 2.34317,  3.70293,  1.85134, 1.15357, 3.06505,
+            1.30386,  1.55279, 0.634826, 1.04995,  2.47046, 1.40107, 1.37469,
+            1.09687,  2.93002, 1.96242,  1.48532,  3.74384, 1.30258, 1.30244};
+    core::Tensor source_points(src_points_vec, {14, 3}, dtype, device);
+    t::geometry::PointCloud source_device(device);
+    source_device.SetPoints(source_points);
+
+    std::vector<float> target_points_vec{
+            2.41766, 2.05397, 1.74994, 1.37848, 2.19793, 1.66553, 2.24325,
+            2.27183, 1.33708, 3.09898, 1.98482, 1.77401, 1.81615, 1.48337,
+            1.49697, 3.01758, 2.20312, 1.51502, 2.38836, 1.39096, 1.74914,
+            1.30911, 1.4252,  1.37429, 3.16847, 1.39194, 1.90959, 1.59412,
+            1.53304, 1.5804,  1.34342, 2.19027, 1.30075};
+    core::Tensor target_points(target_points_vec, {11, 3}, dtype, device);
+    t::geometry::PointCloud target_device(device);
+    target_device.SetPoints(target_points);
+
+    core::Tensor init_trans_t = core::Tensor::Eye(4, dtype, device);
+    double max_correspondence_dist = 1.25;
+    open3d::t::pipelines::registration::ICPConvergenceCriteria criteria(
+            1e-6, 1e-6, 2);
+
+    // The last level uses the full point clouds, so it matches plain ICP
+    // started from the transformation of the coarse level.
+    t::pipelines::registration::MultiScaleRegistrationResult reg_multi =
+            open3d::t::pipelines::registration::RegistrationMultiScaleICP(
+                    source_device, target_device, {0.5, -1.0},
+                    {criteria, criteria},
+                    {2.0 * max_correspondence_dist, max_correspondence_dist},
+                    init_trans_t);
+    ASSERT_EQ(reg_multi.level_stats_.size(), 2);
+    EXPECT_LE(reg_multi.level_stats_[0].num_source_points_, 14);
+    EXPECT_LE(reg_multi.level_stats_[0].num_target_points_, 11);
+    EXPECT_EQ(reg_multi.level_stats_[1].num_source_points_, 14);
+    EXPECT_EQ(reg_multi.level_stats_[1].num_target_points_, 11);
+    EXPECT_GE(reg_multi.level_stats_[1].iterations_, 1);
+    EXPECT_EQ(reg_multi.transformation_.GetDevice(), device);
+
+    t::pipelines::registration::RegistrationResult reg_coarse =
+            open3d::t::pipelines::registration::RegistrationICP(
+                    source_device.VoxelDownSample(0.5),
+                    target_device.VoxelDownSample(0.5),
+                    2.0 * max_correspondence_dist, init_trans_t,
+                    open3d::t::pipelines::registration::
+                            TransformationEstimationPointToPoint(),
+                    criteria);
+    t::pipelines::registration::RegistrationResult reg_fine =
+            open3d::t::pipelines::registration::RegistrationICP(
+                    source_device, target_device, max_correspondence_dist,
+                    reg_coarse.transformation_,
+                    open3d::t::pipelines::registration::
+                            TransformationEstimationPointToPoint(),
+                    criteria);
+    EXPECT_DOUBLE_EQ(reg_multi.fitness_, reg_fine.fitness_);
+    EXPECT_DOUBLE_EQ(reg_multi.inlier_rmse_, reg_fine.inlier_rmse_);
+    EXPECT_DOUBLE_EQ(reg_multi.level_stats_[1].fitness_, reg_fine.fitness_);
+}
+
 }  // namespace tests
 }  // namespace open3d
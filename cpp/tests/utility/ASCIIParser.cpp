@@ -0,0 +1,121 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/utility/ASCIIParser.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(ASCIIParser, ParseDouble) {
+    const char *numbers[] = {"0",      "-1.5",   "3.25e2", "1e-3",
+                             "+.5",    "123456", "1e300",  "-0.1e-310"};
+    for (const char *s : numbers) {
+        const char *end = s + std::strlen(s);
+        double value = 0.0;
+        EXPECT_EQ(utility::ParseDouble(s, end, value), end);
+        EXPECT_EQ(value, std::strtod(s, nullptr));
+    }
+
+    const char *s = "nan 1";
+    double value = 0.0;
+    EXPECT_EQ(utility::ParseDouble(s, s + 5, value), s + 3);
+    EXPECT_TRUE(std::isnan(value));
+
+    // The number stops at the end of the buffer.
+    s = "12345";
+    EXPECT_EQ(utility::ParseDouble(s, s + 3, value), s + 3);
+    EXPECT_EQ(value, 123.0);
+
+    s = "x1";
+    EXPECT_EQ(utility::ParseDouble(s, s + 2, value), s);
+}
+
+TEST(ASCIIParser, ReadASCIIRows) {
+    const std::string filename = "test_ascii_rows.txt";
+    FILE *f = std::fopen(filename.c_str(), "w");
+    ASSERT_NE(f, nullptr);
+    std::fputs("header\n1 2 3\ninvalid\n4 5\n6 7 8 9\n\n10 11 12", f);
+    std::fclose(f);
+
+    std::vector<double> rows;
+    EXPECT_TRUE(utility::ReadASCIIRows(filename, 3, rows));
+    EXPECT_EQ(rows, std::vector<double>({1, 2, 3, 6, 7, 8, 10, 11, 12}));
+
+    EXPECT_TRUE(utility::ReadASCIIRows(filename, 3, rows, 2, 1));
+    EXPECT_EQ(rows, std::vector<double>({6, 7, 8}));
+
+    EXPECT_TRUE(utility::ReadASCIIRows(filename, 4, rows));
+    EXPECT_EQ(rows, std::vector<double>({6, 7, 8, 9}));
+    std::remove(filename.c_str());
+
+    EXPECT_FALSE(utility::ReadASCIIRows(filename, 3, rows));
+}
+
+TEST(ASCIIParser, ReadASCIIRowsFromStream) {
+    const std::string text = "header\n1 2 3\ninvalid\n4 5\n6 7 8 9\n\n10 11 12";
+
+    // Reads the text 3 bytes at a time, into blocks shorter than most lines.
+    auto parse = [&](int64_t num_columns, std::vector<double> &rows,
+                     int64_t skip_lines, int64_t max_rows) {
+        size_t offset = 0;
+        return utility::ReadASCIIRows(
+                [&](char *data, int64_t size) -> int64_t {
+                    size_t count = std::min<size_t>(
+                            {size_t(size), size_t(3), text.size() - offset});
+                    std::memcpy(data, text.data() + offset, count);
+                    offset += count;
+                    return count;
+                },
+                num_columns, rows, skip_lines, max_rows, 4);
+    };
+
+    std::vector<double> rows;
+    EXPECT_TRUE(parse(3, rows, 0, -1));
+    EXPECT_EQ(rows, std::vector<double>({1, 2, 3, 6, 7, 8, 10, 11, 12}));
+
+    EXPECT_TRUE(parse(3, rows, 2, 1));
+    EXPECT_EQ(rows, std::vector<double>({6, 7, 8}));
+
+    EXPECT_TRUE(parse(4, rows, 0, -1));
+    EXPECT_EQ(rows, std::vector<double>({6, 7, 8, 9}));
+
+    EXPECT_FALSE(utility::ReadASCIIRows(
+            [](char *data, int64_t size) -> int64_t { return -1; }, 3, rows));
+}
+
+}  // namespace tests
+}  // namespace open3d
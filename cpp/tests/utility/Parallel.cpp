@@ -0,0 +1,77 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/utility/Parallel.h"
+
+#include <vector>
+
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(Parallel, SetMaxThreads) {
+    utility::SetMaxThreads(3);
+    EXPECT_EQ(utility::GetMaxThreads(), 3);
+    EXPECT_EQ(utility::EstimateMaxThreads(), 3);
+    utility::SetMaxThreads(0);
+    EXPECT_EQ(utility::GetMaxThreads(), 0);
+    EXPECT_GE(utility::EstimateMaxThreads(), 1);
+    EXPECT_ANY_THROW(utility::SetMaxThreads(-1));
+}
+
+TEST(Parallel, ScopedMaxThreads) {
+    utility::SetMaxThreads(4);
+    {
+        utility::ScopedMaxThreads outer(2);
+        EXPECT_EQ(utility::EstimateMaxThreads(), 2);
+        {
+            utility::ScopedMaxThreads inner(1);
+            EXPECT_EQ(utility::EstimateMaxThreads(), 1);
+        }
+        EXPECT_EQ(utility::EstimateMaxThreads(), 2);
+    }
+    EXPECT_EQ(utility::EstimateMaxThreads(), 4);
+    EXPECT_ANY_THROW(utility::ScopedMaxThreads invalid(0));
+    utility::SetMaxThreads(0);
+}
+
+TEST(Parallel, NestedRegion) {
+    utility::SetMaxThreads(2);
+    std::vector<int> nested_threads(2, -1);
+#pragma omp parallel for num_threads(utility::EstimateMaxThreads())
+    for (int i = 0; i < 2; ++i) {
+        nested_threads[i] = utility::EstimateMaxThreads();
+    }
+    utility::SetMaxThreads(0);
+#ifdef _OPENMP
+    EXPECT_EQ(nested_threads, std::vector<int>({1, 1}));
+#endif
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -0,0 +1,131 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/utility/Trace.h"
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(Trace, RecordAndExport) {
+    utility::trace::Clear();
+    utility::trace::SetEnabled(true);
+    {
+        utility::trace::ScopedTrace outer("Test::Outer");
+        utility::trace::ScopedTrace inner("Test::Inner");
+    }
+    std::thread([]() { utility::trace::ScopedTrace t("Test::Thread"); })
+            .join();
+    utility::trace::SetEnabled(false);
+    { utility::trace::ScopedTrace ignored("Test::Disabled"); }
+
+    std::vector<utility::trace::TraceEvent> events =
+            utility::trace::GetEvents();
+    ASSERT_EQ(events.size(), 3u);
+    std::vector<std::string> names;
+    for (const auto& event : events) {
+        EXPECT_GE(event.duration_us, 0);
+        names.push_back(event.name);
+    }
+    EXPECT_EQ(names[0], "Test::Outer");
+    EXPECT_EQ(names[1], "Test::Inner");
+    EXPECT_EQ(names[2], "Test::Thread");
+    EXPECT_NE(events[0].track, events[2].track);
+
+    std::string json = utility::trace::ToChromeTraceJSON();
+    EXPECT_EQ(json.find("{\"displayTimeUnit\":\"ms\",\"traceEvents\":["), 0u);
+    EXPECT_NE(json.find("\"name\":\"Test::Thread\""), std::string::npos);
+    EXPECT_EQ(json.find("Test::Disabled"), std::string::npos);
+
+    utility::trace::Clear();
+    EXPECT_TRUE(utility::trace::GetEvents().empty());
+}
+
+TEST(Trace, RingBufferKeepsRecentEvents) {
+    utility::trace::Clear();
+    utility::trace::SetThreadBufferCapacity(4);
+    std::thread([]() {
+        for (int64_t i = 0; i < 10; ++i) {
+            utility::trace::RecordEvent("Test::Ring", i, i + 1);
+        }
+    }).join();
+    utility::trace::SetThreadBufferCapacity(1 << 16);
+
+    std::vector<utility::trace::TraceEvent> events =
+            utility::trace::GetEvents();
+    ASSERT_EQ(events.size(), 4u);
+    for (int64_t i = 0; i < 4; ++i) {
+        EXPECT_EQ(events[i].begin_us, 6 + i);
+        EXPECT_EQ(events[i].duration_us, 1);
+    }
+    utility::trace::Clear();
+}
+
+TEST(Trace, ExitedThreadsKeepEvents) {
+    utility::trace::Clear();
+    std::vector<uint32_t> tracks;
+    for (int64_t i = 0; i < 64; ++i) {
+        std::thread([&]() {
+            tracks.push_back(utility::trace::CurrentThreadTrack());
+            utility::trace::RecordEvent("Test::Exited", i, i + 1);
+        }).join();
+    }
+
+    std::vector<utility::trace::TraceEvent> events =
+            utility::trace::GetEvents();
+    ASSERT_EQ(events.size(), 64u);
+    for (int64_t i = 0; i < 64; ++i) {
+        EXPECT_EQ(events[i].begin_us, i);
+        EXPECT_EQ(events[i].track, tracks[i]);
+    }
+    std::sort(tracks.begin(), tracks.end());
+    EXPECT_EQ(std::unique(tracks.begin(), tracks.end()), tracks.end());
+    utility::trace::Clear();
+}
+
+TEST(Trace, EscapeJSON) {
+    utility::trace::Clear();
+    utility::trace::RecordEvent("Test::\"Quoted\"\\\n\t\x01", 0, 1);
+    std::string json = utility::trace::ToChromeTraceJSON();
+    EXPECT_NE(json.find("\"Test::\\\"Quoted\\\"\\\\\\n\\t\\u0001\""),
+              std::string::npos);
+    utility::trace::Clear();
+}
+
+TEST(Trace, DeviceTrack) {
+    uint32_t track = utility::trace::DeviceTrack("Test:0");
+    EXPECT_EQ(utility::trace::DeviceTrack("Test:0"), track);
+    EXPECT_NE(utility::trace::DeviceTrack("Test:1"), track);
+    EXPECT_NE(utility::trace::CurrentThreadTrack(), track);
+}
+
+}  // namespace tests
+}  // namespace open3d
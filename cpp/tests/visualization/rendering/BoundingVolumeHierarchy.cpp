@@ -0,0 +1,104 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/visualization/rendering/BoundingVolumeHierarchy.h"
+
+#include <cmath>
+
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+using visualization::rendering::BoundingVolumeHierarchy;
+
+namespace {
+
+// Unit cubes at x = 0, 2, ..., 2 * (n - 1) along the x axis.
+std::vector<geometry::AxisAlignedBoundingBox> CreateBoxes(int n) {
+    std::vector<geometry::AxisAlignedBoundingBox> boxes;
+    for (int i = 0; i < n; ++i) {
+        boxes.emplace_back(Eigen::Vector3d(2.0 * i, 0.0, 0.0),
+                           Eigen::Vector3d(2.0 * i + 1.0, 1.0, 1.0));
+    }
+    return boxes;
+}
+
+// Orthographic projection of the box [x0, x1] x [-1, 2] x [-1, 2], seen
+// along -z.
+Eigen::Matrix4f CreateOrtho(float x0, float x1) {
+    Eigen::Matrix4f ortho = Eigen::Matrix4f::Identity();
+    ortho(0, 0) = 2.0f / (x1 - x0);
+    ortho(0, 3) = -(x1 + x0) / (x1 - x0);
+    ortho(1, 1) = 2.0f / 3.0f;
+    ortho(1, 3) = -1.0f / 3.0f;
+    ortho(2, 2) = -2.0f / 3.0f;
+    ortho(2, 3) = -1.0f / 3.0f;
+    return ortho;
+}
+
+}  // namespace
+
+TEST(BoundingVolumeHierarchy, Build) {
+    BoundingVolumeHierarchy bvh(CreateBoxes(100));
+    const auto& nodes = bvh.GetNodes();
+    EXPECT_EQ(bvh.GetNumItems(), 100u);
+    ASSERT_GT(nodes.size(), 1u);
+    EXPECT_EQ(nodes[0].count, 100u);
+    EXPECT_FLOAT_EQ(nodes[0].max_bound.x(), 199.0f);
+    for (const auto& node : nodes) {
+        if (node.left < 0) {
+            EXPECT_LE(node.count,
+                      size_t(BoundingVolumeHierarchy::MAX_LEAF_SIZE));
+        } else {
+            EXPECT_EQ(nodes[node.left].count + nodes[node.right].count,
+                      node.count);
+        }
+    }
+
+    EXPECT_TRUE(BoundingVolumeHierarchy()
+                        .SelectInFrustum(Eigen::Matrix4f::Identity())
+                        .empty());
+}
+
+TEST(BoundingVolumeHierarchy, SelectInFrustum) {
+    BoundingVolumeHierarchy bvh(CreateBoxes(100));
+
+    // The frustum spans the boxes 10 to 19, and touches the leaves around.
+    std::vector<size_t> selected =
+            bvh.SelectInFrustum(CreateOrtho(20.5f, 38.5f));
+    std::sort(selected.begin(), selected.end());
+    for (size_t i = 10; i < 20; ++i) {
+        EXPECT_TRUE(std::binary_search(selected.begin(), selected.end(), i));
+    }
+    EXPECT_LT(selected.size(), 20u);
+
+    EXPECT_EQ(bvh.SelectInFrustum(CreateOrtho(-10.0f, 300.0f)).size(), 100u);
+    EXPECT_TRUE(bvh.SelectInFrustum(CreateOrtho(300.0f, 400.0f)).empty());
+}
+
+}  // namespace tests
+}  // namespace open3d
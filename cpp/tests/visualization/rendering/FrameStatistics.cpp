@@ -0,0 +1,86 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/visualization/rendering/FrameStatistics.h"
+
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+using visualization::rendering::FrameStatistics;
+using visualization::rendering::FrameStatisticsHistory;
+
+namespace {
+
+FrameStatistics CreateFrame(double frame_ms, size_t triangles) {
+    FrameStatistics stats;
+    stats.frame_ms = frame_ms;
+    stats.render_ms = frame_ms / 2.0;
+    stats.triangles = triangles;
+    return stats;
+}
+
+}  // namespace
+
+TEST(FrameStatistics, RollingWindow) {
+    FrameStatisticsHistory history(3);
+    EXPECT_TRUE(history.IsEmpty());
+    for (int i = 1; i <= 5; ++i) {
+        history.Add(CreateFrame(10.0 * i, 100 * i));
+    }
+
+    // Only the last 3 frames are kept, oldest first.
+    EXPECT_EQ(history.Size(), 3u);
+    EXPECT_EQ(history.GetFrame(0).frame_ms, 30.0);
+    EXPECT_EQ(history.GetLast().frame_ms, 50.0);
+    EXPECT_EQ(history.GetFrameTimes(), std::vector<float>({30, 40, 50}));
+
+    FrameStatistics average = history.GetAverage();
+    EXPECT_EQ(average.frame_ms, 40.0);
+    EXPECT_EQ(average.render_ms, 20.0);
+    EXPECT_EQ(average.triangles, 400u);
+
+    history.Clear();
+    EXPECT_TRUE(history.IsEmpty());
+    EXPECT_EQ(history.GetAverage().frame_ms, 0.0);
+}
+
+TEST(FrameStatistics, FrameTimeHistogram) {
+    FrameStatisticsHistory history;
+    for (double ms : {1.0, 5.0, 15.0, 16.0, 40.0, 1000.0}) {
+        history.Add(CreateFrame(ms, 0));
+    }
+
+    // Bins of 10 ms; the frames of 30 ms or more go to the last bin.
+    EXPECT_EQ(history.GetFrameTimeHistogram(4, 10.0),
+              std::vector<int>({2, 2, 0, 2}));
+    EXPECT_TRUE(history.GetFrameTimeHistogram(0, 10.0).empty());
+    EXPECT_EQ(history.GetFrameTimeHistogram(2, 0.0), std::vector<int>(2, 0));
+}
+
+}  // namespace tests
+}  // namespace open3d
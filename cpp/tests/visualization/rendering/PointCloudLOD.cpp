@@ -0,0 +1,139 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/visualization/rendering/PointCloudLOD.h"
+
+#include <cmath>
+
+#include "open3d/utility/FileSystem.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+using visualization::rendering::PointCloudLOD;
+
+namespace {
+
+// Points on a 40x40x40 grid in a corner of the unit cube, which is denser
+// than the sampling grid of the root.
+geometry::PointCloud CreateGridCloud() {
+    geometry::PointCloud cloud;
+    for (int i = 0; i < 40; ++i) {
+        for (int j = 0; j < 40; ++j) {
+            for (int k = 0; k < 40; ++k) {
+                cloud.points_.emplace_back(i / 390.0, j / 390.0, k / 390.0);
+            }
+        }
+    }
+    cloud.points_.emplace_back(1.0, 1.0, 1.0);
+    return cloud;
+}
+
+// Perspective projection with a vertical field of view of 60 degrees.
+Eigen::Matrix4f CreateProjection() {
+    const float f = 1.0f / std::tan(float(M_PI) / 6.0f);
+    const float near = 0.1f, far = 100.0f;
+    Eigen::Matrix4f projection = Eigen::Matrix4f::Zero();
+    projection(0, 0) = f;
+    projection(1, 1) = f;
+    projection(2, 2) = (far + near) / (near - far);
+    projection(2, 3) = 2.0f * far * near / (near - far);
+    projection(3, 2) = -1.0f;
+    return projection;
+}
+
+}  // namespace
+
+TEST(PointCloudLOD, Build) {
+    geometry::PointCloud cloud = CreateGridCloud();
+    auto lod = PointCloudLOD::Build(cloud, 1000);
+    const auto& nodes = lod->GetNodes();
+    ASSERT_GT(nodes.size(), 1u);
+    EXPECT_EQ(lod->GetNumPoints(), cloud.points_.size());
+
+    size_t num_points = 0;
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        EXPECT_EQ(lod->GetNodePoints(i)->points_.size(), nodes[i].num_points);
+        num_points += nodes[i].num_points;
+        for (int child : nodes[i].children) {
+            if (child < 0) continue;
+            EXPECT_EQ(nodes[child].level, nodes[i].level + 1);
+            EXPECT_DOUBLE_EQ(nodes[child].size, nodes[i].size / 2);
+        }
+    }
+    EXPECT_EQ(num_points, cloud.points_.size());
+}
+
+TEST(PointCloudLOD, SelectNodes) {
+    auto lod = PointCloudLOD::Build(CreateGridCloud(), 1000);
+    const auto& nodes = lod->GetNodes();
+    const Eigen::Matrix4f projection = CreateProjection();
+
+    // The camera at z = 3 looks at the cloud along -z.
+    Eigen::Matrix4f view = Eigen::Matrix4f::Identity();
+    view.topRightCorner<3, 1>() = Eigen::Vector3f(-0.5f, -0.5f, -3.0f);
+    EXPECT_EQ(lod->SelectNodes(view, projection, 480, SIZE_MAX, 0.01f).size(),
+              nodes.size());
+
+    // The budget only fits the root, which is selected first.
+    std::vector<size_t> selected =
+            lod->SelectNodes(view, projection, 480, nodes[0].num_points, 0.01f);
+    ASSERT_EQ(selected.size(), 1u);
+    EXPECT_EQ(selected[0], 0u);
+
+    // A coarse spacing on screen only needs the root.
+    EXPECT_EQ(lod->SelectNodes(view, projection, 480, SIZE_MAX, 100.0f).size(),
+              1u);
+
+    // The cloud is behind the camera.
+    view(2, 3) = 3.0f;
+    EXPECT_TRUE(lod->SelectNodes(view, projection, 480, SIZE_MAX).empty());
+}
+
+TEST(PointCloudLOD, WriteRead) {
+    auto lod = PointCloudLOD::Build(CreateGridCloud(), 1000);
+    const std::string directory = "test_point_cloud_lod";
+    ASSERT_TRUE(lod->Write(directory));
+
+    auto lod_read = PointCloudLOD::Read(directory);
+    ASSERT_NE(lod_read, nullptr);
+    ASSERT_EQ(lod_read->GetNodes().size(), lod->GetNodes().size());
+    for (size_t i = 0; i < lod->GetNodes().size(); ++i) {
+        EXPECT_EQ(lod_read->GetNodes()[i].children,
+                  lod->GetNodes()[i].children);
+        EXPECT_EQ(lod_read->GetNodePoints(i)->points_.size(),
+                  lod->GetNodes()[i].num_points);
+        utility::filesystem::RemoveFile(
+                fmt::format("{}/nodes/{}.ply", directory, i));
+    }
+    utility::filesystem::RemoveFile(directory + "/hierarchy.json");
+    utility::filesystem::DeleteDirectory(directory + "/nodes");
+    utility::filesystem::DeleteDirectory(directory);
+}
+
+}  // namespace tests
+}  // namespace open3d
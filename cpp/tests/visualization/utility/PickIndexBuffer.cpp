@@ -0,0 +1,101 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/visualization/utility/PickIndexBuffer.h"
+
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+using visualization::PickIndexBuffer;
+
+namespace {
+
+// A 10x10 region at (5, 5), in which index (x + 100 * y) is drawn at the
+// pixels of the square [10, 12) x [10, 12) and index 7 at pixel (6, 13).
+PickIndexBuffer CreateBuffer() {
+    PickIndexBuffer buffer(5, 5, 10, 10);
+    for (int y = 10; y < 12; ++y) {
+        for (int x = 10; x < 12; ++x) {
+            buffer.SetIndex(x, y, uint32_t(x + 100 * y));
+        }
+    }
+    buffer.SetIndex(6, 13, 7);
+    return buffer;
+}
+
+}  // namespace
+
+TEST(PickIndexBuffer, GetIndex) {
+    PickIndexBuffer buffer = CreateBuffer();
+    EXPECT_EQ(buffer.GetIndex(11, 10), 1011u);
+    EXPECT_EQ(buffer.GetIndex(6, 13), 7u);
+    EXPECT_EQ(buffer.GetIndex(5, 5), PickIndexBuffer::kNoIndex);
+    EXPECT_EQ(buffer.GetIndex(4, 13), PickIndexBuffer::kNoIndex);
+    EXPECT_EQ(buffer.GetIndex(20, 20), PickIndexBuffer::kNoIndex);
+}
+
+TEST(PickIndexBuffer, GetIndicesInRect) {
+    PickIndexBuffer buffer = CreateBuffer();
+    EXPECT_EQ(buffer.GetIndicesInRect(0, 0, 100, 100),
+              std::vector<uint32_t>({7, 1010, 1011, 1110, 1111}));
+    EXPECT_EQ(buffer.GetIndicesInRect(11, 11, 1, 1),
+              std::vector<uint32_t>({1111}));
+    EXPECT_TRUE(buffer.GetIndicesInRect(0, 0, 5, 100).empty());
+}
+
+TEST(PickIndexBuffer, GetIndicesInPolygon) {
+    PickIndexBuffer buffer = CreateBuffer();
+    // The triangle contains the centers of (10, 10), (11, 10) and (10, 11).
+    std::vector<Eigen::Vector2d> triangle = {
+            {10.0, 10.0}, {12.5, 10.0}, {10.0, 12.5}};
+    EXPECT_EQ(buffer.GetIndicesInPolygon(triangle),
+              std::vector<uint32_t>({1010, 1011, 1110}));
+
+    // A concave polygon around both the square and (6, 13), which excludes
+    // the notch in between.
+    std::vector<Eigen::Vector2d> polygon = {{5.0, 9.0},  {13.0, 9.0},
+                                            {13.0, 15.0}, {5.0, 15.0},
+                                            {5.0, 12.0}, {12.0, 12.0},
+                                            {12.0, 10.5}, {5.0, 10.5}};
+    EXPECT_EQ(buffer.GetIndicesInPolygon(polygon),
+              std::vector<uint32_t>({7, 1010, 1011}));
+
+    EXPECT_TRUE(buffer.GetIndicesInPolygon({{0.0, 0.0}, {20.0, 20.0}})
+                        .empty());
+}
+
+TEST(PickIndexBuffer, GetNearestIndex) {
+    PickIndexBuffer buffer = CreateBuffer();
+    EXPECT_EQ(buffer.GetNearestIndex(6, 13, 2), 7u);
+    EXPECT_EQ(buffer.GetNearestIndex(14, 14, 1), PickIndexBuffer::kNoIndex);
+    // Near the square, the pixel nearest to the click scores the most.
+    EXPECT_EQ(buffer.GetNearestIndex(12, 12, 3), 1111u);
+}
+
+}  // namespace tests
+}  // namespace open3d
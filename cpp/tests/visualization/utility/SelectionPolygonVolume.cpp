@@ -0,0 +1,89 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/visualization/utility/SelectionPolygonVolume.h"
+
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+using visualization::SelectionPolygonVolume;
+
+namespace {
+
+// A concave "C" shape in the xz plane, cropped to y in [-1, 1].
+SelectionPolygonVolume CreateVolume() {
+    SelectionPolygonVolume volume;
+    volume.orthogonal_axis_ = "Y";
+    volume.axis_min_ = -1.0;
+    volume.axis_max_ = 1.0;
+    volume.bounding_polygon_ = {{0.0, 0.0, 0.0}, {3.0, 0.0, 0.0},
+                                {3.0, 0.0, 1.0}, {1.0, 0.0, 1.0},
+                                {1.0, 0.0, 2.0}, {3.0, 0.0, 2.0},
+                                {3.0, 0.0, 3.0}, {0.0, 0.0, 3.0}};
+    return volume;
+}
+
+geometry::PointCloud CreatePointCloud() {
+    geometry::PointCloud pcd;
+    pcd.points_ = {{0.5, 0.0, 0.5},  {2.0, 0.5, 0.5},  {2.0, 0.0, 1.5},
+                   {0.5, 0.0, 1.5},  {2.5, -0.5, 2.5}, {0.5, 2.0, 0.5},
+                   {-0.5, 0.0, 0.5}, {0.5, 0.0, 3.5}};
+    return pcd;
+}
+
+}  // namespace
+
+TEST(SelectionPolygonVolume, CropPointCloud) {
+    SelectionPolygonVolume volume = CreateVolume();
+    std::shared_ptr<geometry::PointCloud> cropped =
+            volume.CropPointCloud(CreatePointCloud());
+    EXPECT_EQ(cropped->points_,
+              std::vector<Eigen::Vector3d>({{0.5, 0.0, 0.5},
+                                            {2.0, 0.5, 0.5},
+                                            {0.5, 0.0, 1.5},
+                                            {2.5, -0.5, 2.5}}));
+}
+
+TEST(SelectionPolygonVolume, GetPointMask) {
+    SelectionPolygonVolume volume = CreateVolume();
+    for (core::Dtype dtype : {core::Dtype::Float32, core::Dtype::Float64}) {
+        t::geometry::PointCloud pcd =
+                t::geometry::PointCloud::FromLegacyPointCloud(
+                        CreatePointCloud(), dtype);
+        EXPECT_EQ(volume.GetPointMask(pcd).ToFlatVector<bool>(),
+                  std::vector<bool>({true, true, false, true, true, false,
+                                     false, false}));
+        EXPECT_EQ(volume.CropPointCloud(pcd).GetPoints().GetLength(), 4);
+    }
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -24,7 +24,12 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <limits>
+#include <mutex>
+#include <thread>
 
 #include "open3d/Open3D.h"
 
@@ -35,11 +40,25 @@ void PrintHelp() {
     utility::LogInfo("Usage:");
     utility::LogInfo("    > ConvertPointCloud source_file target_file [options]");
     utility::LogInfo("    > ConvertPointCloud source_directory target_directory [options]");
+    utility::LogInfo("    > ConvertPointCloud \"source_directory/*.ply\" target_directory [options]");
     utility::LogInfo("      Read point cloud from source file and convert it to target file.");
+    utility::LogInfo("      The files of a directory or a pattern with * and ? wildcards are");
+    utility::LogInfo("      converted concurrently.");
     utility::LogInfo("");
     utility::LogInfo("Options (listed in the order of execution priority):");
     utility::LogInfo("    --help, -h                : Print help information.");
     utility::LogInfo("    --verbose n               : Set verbose level (0-4).");
+    utility::LogInfo("    --jobs n                  : Number of files converted concurrently in batch");
+    utility::LogInfo("                                mode. Defaults to the number of cores.");
+    utility::LogInfo("    --memory_budget_mb m      : Bound the total size of the input files being");
+    utility::LogInfo("                                converted concurrently to m MB. A larger file is");
+    utility::LogInfo("                                converted alone. 0 (default) is unbounded.");
+    utility::LogInfo("    --target_extension ext    : Extension of the target files in batch mode,");
+    utility::LogInfo("                                e.g. ply. Defaults to the source extension.");
+    utility::LogInfo("    --stream_threshold_mb s   : Convert files larger than s MB (default 512) in");
+    utility::LogInfo("                                chunks, if only clipping and uniform sampling");
+    utility::LogInfo("                                are requested and the formats support it.");
+    utility::LogInfo("    --chunk_size n            : Number of points per chunk (default 1000000).");
     utility::LogInfo("    --clip_x_min x0           : Clip points with x coordinate < x0.");
     utility::LogInfo("    --clip_x_max x1           : Clip points with x coordinate > x1.");
     utility::LogInfo("    --clip_y_min y0           : Clip points with y coordinate < y0.");
@@ -65,10 +84,225 @@ void PrintHelp() {
     // clang-format on
 }
 
-void convert(int argc,
-             char **argv,
-             const std::string &file_in,
-             const std::string &file_out) {
+/// Returns the clipping box of the options, or false if no clipping is
+/// requested.
+bool GetClipBox(int argc,
+                char **argv,
+                open3d::geometry::AxisAlignedBoundingBox &bbox) {
+    using namespace open3d;
+    if (!utility::ProgramOptionExistsAny(
+                argc, argv,
+                {"--clip_x_min", "--clip_x_max", "--clip_y_min", "--clip_y_max",
+                 "--clip_z_min", "--clip_z_max"})) {
+        return false;
+    }
+    Eigen::Vector3d min_bound, max_bound;
+    min_bound(0) = utility::GetProgramOptionAsDouble(
+            argc, argv, "--clip_x_min", std::numeric_limits<double>::lowest());
+    min_bound(1) = utility::GetProgramOptionAsDouble(
+            argc, argv, "--clip_y_min", std::numeric_limits<double>::lowest());
+    min_bound(2) = utility::GetProgramOptionAsDouble(
+            argc, argv, "--clip_z_min", std::numeric_limits<double>::lowest());
+    max_bound(0) = utility::GetProgramOptionAsDouble(
+            argc, argv, "--clip_x_max", std::numeric_limits<double>::max());
+    max_bound(1) = utility::GetProgramOptionAsDouble(
+            argc, argv, "--clip_y_max", std::numeric_limits<double>::max());
+    max_bound(2) = utility::GetProgramOptionAsDouble(
+            argc, argv, "--clip_z_max", std::numeric_limits<double>::max());
+    bbox = geometry::AxisAlignedBoundingBox(min_bound, max_bound);
+    return true;
+}
+
+/// Returns true if the options need the legacy point cloud, i.e. outlier
+/// filtering or normals.
+bool NeedsLegacyPointCloud(int argc, char **argv) {
+    using namespace open3d;
+    return utility::GetProgramOptionAsDouble(argc, argv, "--filter_mahalanobis",
+                                             0.0) > 0.0 ||
+           utility::GetProgramOptionAsDouble(argc, argv, "--estimate_normals",
+                                             0.0) > 0.0 ||
+           utility::GetProgramOptionAsInt(argc, argv, "--estimate_normals_knn",
+                                          0) > 0 ||
+           utility::GetProgramOptionAsEigenVectorXd(argc, argv,
+                                                    "--orient_normals")
+                           .size() == 3 ||
+           utility::GetProgramOptionAsEigenVectorXd(argc, argv,
+                                                    "--camera_location")
+                           .size() == 3;
+}
+
+/// Returns true if the file can be converted chunk by chunk, i.e. the
+/// options only clip and sample uniformly, and PointCloudReader and
+/// PointCloudWriter support the formats.
+bool CanConvertStreaming(int argc,
+                         char **argv,
+                         const std::string &file_in,
+                         const std::string &file_out) {
+    using namespace open3d;
+    using namespace open3d::utility::filesystem;
+    if (NeedsLegacyPointCloud(argc, argv) ||
+        utility::GetProgramOptionAsDouble(argc, argv, "--voxel_sample", 0.0) >
+                0.0) {
+        return false;
+    }
+    const std::vector<std::string> read_formats{"ply", "pcd",    "xyz", "xyzn",
+                                                "xyzrgb", "xyzi", "pts"};
+    const std::vector<std::string> write_formats{"ply", "xyz", "xyzn",
+                                                 "xyzrgb", "xyzi"};
+    std::string format_in = GetFileExtensionInLowerCase(file_in);
+    std::string format_out = GetFileExtensionInLowerCase(file_out);
+    return std::find(read_formats.begin(), read_formats.end(), format_in) !=
+                   read_formats.end() &&
+           std::find(write_formats.begin(), write_formats.end(), format_out) !=
+                   write_formats.end();
+}
+
+/// Returns the size of a file in bytes, or 0 if it cannot be opened.
+int64_t GetFileSize(const std::string &filename) {
+    open3d::utility::filesystem::CFile file;
+    if (!file.Open(filename, "rb")) {
+        return 0;
+    }
+    return file.GetFileSize();
+}
+
+/// Returns the points with finite positions and normals, as the legacy reader
+/// keeps by default.
+open3d::t::geometry::PointCloud RemoveNonFinitePoints(
+        const open3d::t::geometry::PointCloud &pointcloud) {
+    using namespace open3d;
+    // The comparison is false for NaN, so the mask excludes NaN and +-inf.
+    auto is_finite = [](const core::Tensor &values) {
+        return values.Abs()
+                .Lt(std::numeric_limits<double>::infinity())
+                .To(core::Dtype::Int64)
+                .Sum({1})
+                .Eq(values.GetShape(1));
+    };
+    core::Tensor mask = is_finite(pointcloud.GetPoints());
+    if (pointcloud.HasPointNormals()) {
+        mask = mask.LogicalAnd(is_finite(pointcloud.GetPointNormals()));
+    }
+    return pointcloud.SelectByMask(mask);
+}
+
+/// Converts the file chunk by chunk, with memory bounded by --chunk_size.
+bool ConvertStreaming(int argc,
+                      char **argv,
+                      const std::string &file_in,
+                      const std::string &file_out) {
+    using namespace open3d;
+    int64_t chunk_size = std::max(
+            utility::GetProgramOptionAsInt(argc, argv, "--chunk_size", 1000000),
+            1);
+    geometry::AxisAlignedBoundingBox bbox;
+    bool clip = GetClipBox(argc, argv, bbox);
+    int64_t every_k = utility::GetProgramOptionAsInt(
+            argc, argv, "--uniform_sample_every", 0);
+
+    t::io::PointCloudReader reader;
+    t::io::PointCloudWriter writer;
+    if (!reader.Open(file_in) || !writer.Open(file_out)) {
+        return false;
+    }
+    // Number of points read, and kept by the clipping so far. The uniform
+    // sampling counts the clipped points across chunks, as the in-memory
+    // conversion does.
+    int64_t point_num_in = 0;
+    int64_t point_num_clipped = 0;
+    int64_t point_num_out = 0;
+    while (!reader.IsEOF()) {
+        t::geometry::PointCloud chunk = reader.ReadNext(chunk_size);
+        int64_t chunk_length = chunk.GetPoints().GetLength();
+        if (chunk_length == 0) {
+            break;
+        }
+        point_num_in += chunk_length;
+        chunk = RemoveNonFinitePoints(chunk);
+        chunk_length = chunk.GetPoints().GetLength();
+        if (clip) {
+            chunk = chunk.Crop(bbox);
+            chunk_length = chunk.GetPoints().GetLength();
+        }
+        if (every_k > 1) {
+            int64_t first = (every_k - point_num_clipped % every_k) % every_k;
+            chunk = chunk.SelectByIndex(core::Tensor::Arange(
+                    first, chunk_length, every_k, core::Dtype::Int64,
+                    chunk.GetDevice()));
+        }
+        point_num_clipped += chunk_length;
+        if (chunk.GetPoints().GetLength() == 0) {
+            continue;
+        }
+        point_num_out += chunk.GetPoints().GetLength();
+        if (!writer.WriteNext(chunk)) {
+            return false;
+        }
+    }
+    writer.Close();
+    if (clip || every_k > 1) {
+        utility::LogInfo(
+                "Processed point cloud {} from {:d} points to {:d} points in "
+                "chunks.",
+                file_in, point_num_in, point_num_out);
+    }
+    return true;
+}
+
+/// Converts the file with the tensor point cloud, for the options that do not
+/// need the legacy one.
+bool ConvertTensor(int argc,
+                   char **argv,
+                   const std::string &file_in,
+                   const std::string &file_out) {
+    using namespace open3d;
+    // The tensor readers do not remove the non-finite points themselves.
+    t::geometry::PointCloud pointcloud;
+    if (!t::io::ReadPointCloud(file_in, pointcloud, {"auto", false, false})) {
+        return false;
+    }
+    pointcloud = RemoveNonFinitePoints(pointcloud);
+    int64_t point_num_in = pointcloud.GetPoints().GetLength();
+    bool processed = false;
+
+    geometry::AxisAlignedBoundingBox bbox;
+    if (GetClipBox(argc, argv, bbox)) {
+        pointcloud = pointcloud.Crop(bbox);
+        processed = true;
+    }
+
+    int every_k = utility::GetProgramOptionAsInt(argc, argv,
+                                                 "--uniform_sample_every", 0);
+    if (every_k > 1) {
+        utility::LogDebug("Downsample point cloud uniformly every {:d} points.",
+                          every_k);
+        pointcloud = pointcloud.SelectByIndex(core::Tensor::Arange(
+                0, pointcloud.GetPoints().GetLength(), every_k,
+                core::Dtype::Int64, pointcloud.GetDevice()));
+        processed = true;
+    }
+
+    double voxel_size = utility::GetProgramOptionAsDouble(
+            argc, argv, "--voxel_sample", 0.0);
+    if (voxel_size > 0.0) {
+        utility::LogDebug("Downsample point cloud with voxel size {:.4f}.",
+                          voxel_size);
+        pointcloud = pointcloud.VoxelDownSample(voxel_size);
+        processed = true;
+    }
+
+    if (processed) {
+        utility::LogInfo(
+                "Processed point cloud from {:d} points to {:d} points.",
+                point_num_in, pointcloud.GetPoints().GetLength());
+    }
+    return t::io::WritePointCloud(file_out, pointcloud, {false, true});
+}
+
+bool ConvertLegacy(int argc,
+                   char **argv,
+                   const std::string &file_in,
+                   const std::string &file_out) {
     using namespace open3d;
     using namespace open3d::utility::filesystem;
     auto pointcloud_ptr = io::CreatePointCloudFromFile(file_in.c_str());
@@ -76,28 +310,9 @@ void convert(int argc,
     bool processed = false;
 
     // clip
-    if (utility::ProgramOptionExistsAny(
-                argc, argv,
-                {"--clip_x_min", "--clip_x_max", "--clip_y_min", "--clip_y_max",
-                 "--clip_z_min", "--clip_z_max"})) {
-        Eigen::Vector3d min_bound, max_bound;
-        min_bound(0) = utility::GetProgramOptionAsDouble(
-                argc, argv, "--clip_x_min",
-                std::numeric_limits<double>::lowest());
-        min_bound(1) = utility::GetProgramOptionAsDouble(
-                argc, argv, "--clip_y_min",
-                std::numeric_limits<double>::lowest());
-        min_bound(2) = utility::GetProgramOptionAsDouble(
-                argc, argv, "--clip_z_min",
-                std::numeric_limits<double>::lowest());
-        max_bound(0) = utility::GetProgramOptionAsDouble(
-                argc, argv, "--clip_x_max", std::numeric_limits<double>::max());
-        max_bound(1) = utility::GetProgramOptionAsDouble(
-                argc, argv, "--clip_y_max", std::numeric_limits<double>::max());
-        max_bound(2) = utility::GetProgramOptionAsDouble(
-                argc, argv, "--clip_z_max", std::numeric_limits<double>::max());
-        pointcloud_ptr = pointcloud_ptr->Crop(
-                geometry::AxisAlignedBoundingBox(min_bound, max_bound));
+    geometry::AxisAlignedBoundingBox bbox;
+    if (GetClipBox(argc, argv, bbox)) {
+        pointcloud_ptr = pointcloud_ptr->Crop(bbox);
         processed = true;
     }
 
@@ -184,7 +399,174 @@ void convert(int argc,
                 "Processed point cloud from {:d} points to {:d} points.",
                 (int)point_num_in, (int)point_num_out);
     }
-    io::WritePointCloud(file_out.c_str(), *pointcloud_ptr, {false, true});
+    return io::WritePointCloud(file_out.c_str(), *pointcloud_ptr,
+                               {false, true});
+}
+
+/// Converts one file, streaming it if it is larger than
+/// --stream_threshold_mb. Options that need the legacy point cloud use the
+/// legacy pipeline, the others the tensor one.
+bool convert(int argc,
+             char **argv,
+             const std::string &file_in,
+             const std::string &file_out) {
+    using namespace open3d;
+    if (NeedsLegacyPointCloud(argc, argv)) {
+        return ConvertLegacy(argc, argv, file_in, file_out);
+    }
+    double stream_threshold_mb = utility::GetProgramOptionAsDouble(
+            argc, argv, "--stream_threshold_mb", 512.0);
+    int64_t stream_threshold =
+            static_cast<int64_t>(stream_threshold_mb * 1024.0 * 1024.0);
+    if (GetFileSize(file_in) > stream_threshold &&
+        CanConvertStreaming(argc, argv, file_in, file_out)) {
+        return ConvertStreaming(argc, argv, file_in, file_out);
+    }
+    return ConvertTensor(argc, argv, file_in, file_out);
+}
+
+/// \class MemoryBudget
+///
+/// Bounds the total cost of the conversions in flight. A conversion costing
+/// more than the whole budget waits for all the others and runs alone.
+class MemoryBudget {
+public:
+    /// \param budget Total cost allowed, or 0 for no bound.
+    explicit MemoryBudget(int64_t budget) : budget_(budget) {}
+
+    /// Blocks until \p cost fits in the budget and reserves it. Returns the
+    /// reserved cost, to be passed to Release.
+    int64_t Acquire(int64_t cost) {
+        if (budget_ <= 0) {
+            return 0;
+        }
+        cost = std::min(cost, budget_);
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock, [&]() { return used_ + cost <= budget_; });
+        used_ += cost;
+        return cost;
+    }
+
+    void Release(int64_t cost) {
+        if (cost == 0) {
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            used_ -= cost;
+        }
+        cv_.notify_all();
+    }
+
+private:
+    int64_t budget_;
+    int64_t used_ = 0;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+};
+
+/// Returns true if \p name matches \p pattern, where * matches any sequence
+/// of characters and ? any single character.
+bool MatchWildcard(const std::string &pattern, const std::string &name) {
+    size_t p = 0, n = 0;
+    size_t star = std::string::npos, star_n = 0;
+    while (n < name.size()) {
+        if (p < pattern.size() &&
+            (pattern[p] == '?' || pattern[p] == name[n])) {
+            ++p;
+            ++n;
+        } else if (p < pattern.size() && pattern[p] == '*') {
+            star = p++;
+            star_n = n;
+        } else if (star != std::string::npos) {
+            p = star + 1;
+            n = ++star_n;
+        } else {
+            return false;
+        }
+    }
+    while (p < pattern.size() && pattern[p] == '*') {
+        ++p;
+    }
+    return p == pattern.size();
+}
+
+/// Converts the files concurrently into \p target_directory, largest first.
+/// Returns the number of files that failed.
+int ConvertBatch(int argc,
+                 char **argv,
+                 std::vector<std::string> filenames,
+                 const std::string &target_directory) {
+    using namespace open3d;
+    using namespace open3d::utility::filesystem;
+    MakeDirectoryHierarchy(target_directory);
+    std::string target_extension = utility::GetProgramOptionAsString(
+            argc, argv, "--target_extension", "");
+    if (!target_extension.empty() && target_extension[0] == '.') {
+        target_extension = target_extension.substr(1);
+    }
+
+    // Starting with the largest files keeps the tail of the batch short.
+    std::vector<std::pair<int64_t, std::string>> files;
+    for (const std::string &fn : filenames) {
+        files.emplace_back(GetFileSize(fn), fn);
+    }
+    std::sort(files.begin(), files.end(),
+              [](const std::pair<int64_t, std::string> &a,
+                 const std::pair<int64_t, std::string> &b) {
+                  return a.first > b.first;
+              });
+
+    int num_cores = std::max<int>(std::thread::hardware_concurrency(), 1);
+    int num_jobs = utility::GetProgramOptionAsInt(argc, argv, "--jobs",
+                                                  num_cores);
+    num_jobs = std::max(1, std::min<int>(num_jobs, int(files.size())));
+    double memory_budget_mb = utility::GetProgramOptionAsDouble(
+            argc, argv, "--memory_budget_mb", 0.0);
+    MemoryBudget budget(
+            static_cast<int64_t>(memory_budget_mb * 1024.0 * 1024.0));
+    utility::LogInfo("Converting {:d} files with {:d} jobs.", files.size(),
+                     num_jobs);
+
+    std::atomic<size_t> next_file(0);
+    std::atomic<int> num_failed(0);
+    auto worker = [&]() {
+        // The cores are split between the jobs, so that the parallel regions
+        // of the conversions do not oversubscribe them.
+        utility::ScopedMaxThreads max_threads(
+                std::max(1, num_cores / num_jobs));
+        size_t i;
+        while ((i = next_file++) < files.size()) {
+            const std::string &file_in = files[i].second;
+            std::string file_out =
+                    GetRegularizedDirectoryName(target_directory) +
+                    GetFileNameWithoutDirectory(file_in);
+            if (!target_extension.empty()) {
+                file_out = GetFileNameWithoutExtension(file_out) + "." +
+                           target_extension;
+            }
+            int64_t cost = budget.Acquire(files[i].first);
+            bool success = false;
+            try {
+                success = convert(argc, argv, file_in, file_out);
+            } catch (const std::exception &e) {
+                utility::LogWarning("{}", e.what());
+            }
+            budget.Release(cost);
+            if (!success) {
+                utility::LogWarning("Failed to convert {}.", file_in);
+                num_failed++;
+            }
+        }
+    };
+    std::vector<std::thread> threads;
+    for (int j = 0; j < num_jobs; ++j) {
+        threads.emplace_back(worker);
+    }
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+    return num_failed;
 }
 
 int main(int argc, char **argv) {
@@ -200,16 +582,35 @@ int main(int argc, char **argv) {
     int verbose = utility::GetProgramOptionAsInt(argc, argv, "--verbose", 2);
     utility::SetVerbosityLevel((utility::VerbosityLevel)verbose);
 
-    if (FileExists(argv[1])) {
-        convert(argc, argv, argv[1], argv[2]);
-    } else if (DirectoryExists(argv[1])) {
-        MakeDirectoryHierarchy(argv[2]);
+    std::string source = argv[1];
+    if (FileExists(source)) {
+        if (!convert(argc, argv, source, argv[2])) {
+            utility::LogWarning("Failed to convert {}.", source);
+            return 1;
+        }
+    } else if (DirectoryExists(source)) {
         std::vector<std::string> filenames;
-        ListFilesInDirectory(argv[1], filenames);
-        for (const auto &fn : filenames) {
-            convert(argc, argv, fn,
-                    GetRegularizedDirectoryName(argv[2]) +
-                            GetFileNameWithoutDirectory(fn));
+        ListFilesInDirectory(source, filenames);
+        if (ConvertBatch(argc, argv, filenames, argv[2]) > 0) {
+            return 1;
+        }
+    } else if (source.find_first_of("*?") != std::string::npos) {
+        std::string directory = GetFileParentDirectory(source);
+        std::string pattern = GetFileNameWithoutDirectory(source);
+        std::vector<std::string> all_filenames, filenames;
+        ListFilesInDirectory(directory.empty() ? "." : directory,
+                             all_filenames);
+        for (const auto &fn : all_filenames) {
+            if (MatchWildcard(pattern, GetFileNameWithoutDirectory(fn))) {
+                filenames.push_back(fn);
+            }
+        }
+        if (filenames.empty()) {
+            utility::LogWarning("No file matches {}.", source);
+            return 1;
+        }
+        if (ConvertBatch(argc, argv, filenames, argv[2]) > 0) {
+            return 1;
         }
     } else {
         utility::LogWarning("File or directory does not exist.");
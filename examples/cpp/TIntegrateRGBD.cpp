@@ -126,17 +126,17 @@ int main(int argc, char** argv) {
                                           static_cast<float>(sdf_trunc), 16,
                                           block_count, device);
 
+    // Decode the next frames while the current one is integrated.
+    std::vector<std::pair<std::string, std::string>> filenames;
     for (size_t i = 0; i < trajectory->parameters_.size(); ++i) {
-        // Load image
-        std::shared_ptr<geometry::Image> depth_legacy =
-                io::CreateImageFromFile(depth_filenames[i]);
-        std::shared_ptr<geometry::Image> color_legacy =
-                io::CreateImageFromFile(color_filenames[i]);
-
-        t::geometry::Image depth =
-                t::geometry::Image::FromLegacyImage(*depth_legacy, device);
-        t::geometry::Image color =
-                t::geometry::Image::FromLegacyImage(*color_legacy, device);
+        filenames.emplace_back(color_filenames[i], depth_filenames[i]);
+    }
+    t::io::RGBDSequenceLoader loader(filenames, device);
+
+    for (size_t i = 0; i < trajectory->parameters_.size(); ++i) {
+        t::geometry::RGBDImage rgbd = loader.NextFrame();
+        const t::geometry::Image &depth = rgbd.depth_;
+        const t::geometry::Image &color = rgbd.color_;
 
         Eigen::Matrix4f extrinsic =
                 trajectory->parameters_[i].extrinsic_.cast<float>();
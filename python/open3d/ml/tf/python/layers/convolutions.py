@@ -138,6 +138,10 @@ class ContinuousConv(tf.keras.layers.Layer):
           linear layer used for the center if 'use_dense_layer_for_center'
           is True.
 
+        neighbor_search_cache: An optional NeighborSearchCache shared with
+          other layers. Layers with the same positions and extents then reuse
+          the hash table and the neighbors of the fixed radius search.
+
         in_channels: This keyword argument is for compatibility with PyTorch.
           It is not used and in_channels will be inferred at the first execution
           of the layer.
@@ -163,6 +167,7 @@ class ContinuousConv(tf.keras.layers.Layer):
                  use_dense_layer_for_center=False,
                  dense_kernel_initializer='glorot_uniform',
                  dense_kernel_regularizer=None,
+                 neighbor_search_cache=None,
                  in_channels=None,
                  **kwargs):
 
@@ -196,7 +201,8 @@ class ContinuousConv(tf.keras.layers.Layer):
         self.fixed_radius_search = FixedRadiusSearch(
             metric=self.radius_search_metric,
             ignore_query_point=self.radius_search_ignore_query_points,
-            return_distances=not self.window_function is None)
+            return_distances=not self.window_function is None,
+            cache=neighbor_search_cache)
 
         self.radius_search = RadiusSearch(
             metric=self.radius_search_metric,
@@ -27,7 +27,166 @@
 from ...python.ops import ops
 import tensorflow as tf
 
-__all__ = ['FixedRadiusSearch', 'RadiusSearch', 'KNNSearch']
+__all__ = [
+    'NeighborSearchCache', 'FixedRadiusSearch', 'RadiusSearch', 'KNNSearch'
+]
+
+
+def _same_value(a, b):
+    """Returns True if a and b are the same object or have the same value.
+
+    Different tensors are only compared by value in eager mode.
+    """
+    if a is b:
+        return True
+    if tf.is_tensor(a) or tf.is_tensor(b):
+        if not (tf.executing_eagerly() and tf.is_tensor(a) and tf.is_tensor(b)):
+            return False
+        return (a.shape == b.shape and a.dtype == b.dtype and
+                bool(tf.reduce_all(tf.equal(a, b))))
+    return a == b
+
+
+def _same_tensor(a, b):
+    """Returns True if b is the tensor a. Variables never match because they
+    can be modified."""
+    return a is b and not isinstance(b, tf.Variable)
+
+
+class _NeighborSearchCacheEntry:
+
+    def __init__(self, points, radius, points_row_splits,
+                 hash_table_size_factor, max_hash_table_size, table):
+        self.points = points
+        self.radius = radius
+        self.points_row_splits = points_row_splits
+        self.hash_table_size_factor = hash_table_size_factor
+        self.max_hash_table_size = max_hash_table_size
+        self.table = table
+        self.results = []
+
+    def matches(self, points, radius, points_row_splits, hash_table_size_factor,
+                max_hash_table_size):
+        return (_same_tensor(self.points, points) and
+                _same_value(self.radius, radius) and
+                _same_value(self.points_row_splits, points_row_splits) and
+                self.hash_table_size_factor == hash_table_size_factor and
+                self.max_hash_table_size == max_hash_table_size)
+
+
+class NeighborSearchCache:
+    """Cache for reusing spatial hash tables and fixed radius search results.
+
+    Networks often run several fixed radius searches on the same points with
+    the same radius, e.g. a stack of continuous convolutions at the same
+    resolution. Sharing a cache between these layers builds the spatial hash
+    table only once. If the queries are the same, too, the neighbors computed
+    by a previous layer are returned directly.
+
+    Entries are matched by the identity of the points and queries tensors.
+    Variables are never cached since they can be modified. The cache keeps
+    references to the cached tensors until they are evicted or clear() is
+    called. In graph mode the cache only deduplicates searches within the
+    same trace.
+
+    Example:
+
+      This example shares the hash table and the neighbors between two layers.::
+
+        import tensorflow as tf
+        import open3d.ml.tf as ml3d
+
+        points = tf.random.normal([20,3])
+        radius = 0.8
+
+        cache = ml3d.layers.NeighborSearchCache()
+        nsearch1 = ml3d.layers.FixedRadiusSearch(cache=cache)
+        nsearch2 = ml3d.layers.FixedRadiusSearch(cache=cache)
+        ans1 = nsearch1(points, points, radius)
+        ans2 = nsearch2(points, points, radius)  # returns the cached ans1
+
+    Arguments:
+
+      max_entries: The maximum number of hash tables to keep. The least
+        recently used hash table and its search results are evicted first.
+    """
+
+    def __init__(self, max_entries=4):
+        self.max_entries = max_entries
+        self._entries = []
+
+    def clear(self):
+        """Removes all cached hash tables and search results."""
+        self._entries = []
+
+    def _entry(self, points, radius, points_row_splits, hash_table_size_factor,
+               max_hash_table_size):
+        for i, entry in enumerate(self._entries):
+            if entry.matches(points, radius, points_row_splits,
+                             hash_table_size_factor, max_hash_table_size):
+                self._entries.append(self._entries.pop(i))
+                return entry
+
+        if points_row_splits is None:
+            row_splits = tf.cast(tf.stack([0, tf.shape(points)[0]]),
+                                 dtype=tf.int64)
+        else:
+            row_splits = points_row_splits
+        table = ops.build_spatial_hash_table(
+            max_hash_table_size=max_hash_table_size,
+            points=points,
+            radius=radius,
+            points_row_splits=row_splits,
+            hash_table_size_factor=hash_table_size_factor)
+        entry = _NeighborSearchCacheEntry(points, radius, points_row_splits,
+                                          hash_table_size_factor,
+                                          max_hash_table_size, table)
+        self._entries.append(entry)
+        if len(self._entries) > self.max_entries:
+            self._entries.pop(0)
+        return entry
+
+    def hash_table(self,
+                   points,
+                   radius,
+                   points_row_splits=None,
+                   hash_table_size_factor=1 / 64,
+                   max_hash_table_size=32 * 2**20):
+        """Returns the spatial hash table for the points.
+
+        The hash table is only built if there is no matching entry in the
+        cache. The arguments are the same as for build_spatial_hash_table().
+        """
+        return self._entry(points, radius, points_row_splits,
+                           hash_table_size_factor, max_hash_table_size).table
+
+    def fixed_radius_search(self, layer, points, queries, radius,
+                            points_row_splits, queries_row_splits,
+                            hash_table_size_factor):
+        """Runs the fixed radius search of a FixedRadiusSearch layer.
+
+        Returns the cached result if the same search has been done before.
+        """
+        entry = self._entry(points, radius, points_row_splits,
+                            hash_table_size_factor, layer.max_hash_table_size)
+        options = (layer.metric, layer.ignore_query_point,
+                   layer.return_distances)
+        for (cached_queries, cached_queries_row_splits, cached_options,
+             result) in entry.results:
+            if (_same_tensor(cached_queries, queries) and _same_value(
+                    cached_queries_row_splits, queries_row_splits) and
+                    cached_options == options):
+                return result
+
+        result = layer(points,
+                       queries,
+                       radius,
+                       points_row_splits=points_row_splits,
+                       queries_row_splits=queries_row_splits,
+                       hash_table_size_factor=hash_table_size_factor,
+                       hash_table=entry.table)
+        entry.results.append((queries, queries_row_splits, options, result))
+        return result
 
 
 class FixedRadiusSearch(tf.keras.layers.Layer):
@@ -62,6 +221,10 @@ class FixedRadiusSearch(tf.keras.layers.Layer):
 
       return_distances: If True the distances for each neighbor will be returned.
         If False a zero length Tensor will be returned instead.
+
+      cache: An optional NeighborSearchCache shared with other layers. If set,
+        the hash table and the search results are reused for the same points
+        and queries.
     """
 
     def __init__(self,
@@ -69,11 +232,13 @@ class FixedRadiusSearch(tf.keras.layers.Layer):
                  ignore_query_point=False,
                  return_distances=False,
                  max_hash_table_size=32 * 2**20,
+                 cache=None,
                  **kwargs):
         self.metric = metric
         self.ignore_query_point = ignore_query_point
         self.return_distances = return_distances
         self.max_hash_table_size = max_hash_table_size
+        self.cache = cache
         super().__init__(autocast=False, **kwargs)
 
     def build(self, inp_shape):
@@ -131,6 +296,12 @@ class FixedRadiusSearch(tf.keras.layers.Layer):
             Note that the distances are squared if metric is L2.
             This is a zero length Tensor if 'return_distances' is False.
         """
+        if self.cache is not None and hash_table is None:
+            return self.cache.fixed_radius_search(self, points, queries, radius,
+                                                  points_row_splits,
+                                                  queries_row_splits,
+                                                  hash_table_size_factor)
+
         if points_row_splits is None:
             points_row_splits = tf.cast(tf.stack([0, tf.shape(points)[0]]),
                                         dtype=tf.int64)
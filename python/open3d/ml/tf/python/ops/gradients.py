@@ -43,6 +43,20 @@ def _voxel_pooling_grad(op, grad_pos, grad_feat):
     return [None, features_grad, None]
 
 
+@_ops.RegisterGradient("Open3DVoxelizePooling")
+def _voxelize_pooling_grad(op, grad_coords, grad_pos, grad_feat, grad_indices,
+                           grad_row_splits, grad_pooling_indices):
+    features_grad = _lib.open3d_voxelize_pooling_grad(
+        features=op.inputs[1],
+        voxel_point_indices=op.outputs[3],
+        voxel_point_row_splits=op.outputs[4],
+        pooling_indices=op.outputs[5],
+        pooled_features_gradient=grad_feat,
+        feature_fn=op.get_attr('feature_fn'),
+    )
+    return [None, features_grad, None, None, None]
+
+
 @_ops.RegisterGradient("Open3DContinuousConv")
 def _continuous_conv_grad(op, grad):
 
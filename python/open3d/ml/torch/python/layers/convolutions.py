@@ -132,6 +132,10 @@ class ContinuousConv(torch.nn.Module):
         dense_kernel_initializer: Initializer for the kernel weights of the
           linear layer used for the center if 'use_dense_layer_for_center'
           is True.
+
+        neighbor_search_cache: An optional NeighborSearchCache shared with
+          other layers. Layers with the same positions and extents then reuse
+          the hash table and the neighbors of the fixed radius search.
     """
 
     def __init__(
@@ -153,6 +157,7 @@ class ContinuousConv(torch.nn.Module):
             window_function=None,
             use_dense_layer_for_center=False,
             dense_kernel_initializer=torch.nn.init.xavier_uniform_,
+            neighbor_search_cache=None,
             **kwargs):
         super().__init__()
 
@@ -180,7 +185,8 @@ class ContinuousConv(torch.nn.Module):
         self.fixed_radius_search = FixedRadiusSearch(
             metric=self.radius_search_metric,
             ignore_query_point=self.radius_search_ignore_query_points,
-            return_distances=not self.window_function is None)
+            return_distances=not self.window_function is None,
+            cache=neighbor_search_cache)
 
         self.radius_search = RadiusSearch(
             metric=self.radius_search_metric,
@@ -27,7 +27,163 @@
 from ...python import ops
 import torch
 
-__all__ = ['FixedRadiusSearch', 'RadiusSearch', 'KNNSearch']
+__all__ = [
+    'NeighborSearchCache', 'FixedRadiusSearch', 'RadiusSearch', 'KNNSearch'
+]
+
+
+def _same_value(a, b):
+    """Returns True if a and b are the same object or have the same value."""
+    if a is b:
+        return True
+    if isinstance(a, torch.Tensor) or isinstance(b, torch.Tensor):
+        if not (isinstance(a, torch.Tensor) and isinstance(b, torch.Tensor)):
+            return False
+        return (a.shape == b.shape and a.device == b.device and
+                bool(torch.equal(a, b)))
+    return a == b
+
+
+def _same_tensor(a, a_version, b):
+    """Returns True if b is the tensor a and has not been modified in-place."""
+    return a is b and a_version == b._version
+
+
+class _NeighborSearchCacheEntry:
+
+    def __init__(self, points, radius, points_row_splits,
+                 hash_table_size_factor, max_hash_table_size, table):
+        self.points = points
+        self.points_version = points._version
+        self.radius = radius
+        self.points_row_splits = points_row_splits
+        self.hash_table_size_factor = hash_table_size_factor
+        self.max_hash_table_size = max_hash_table_size
+        self.table = table
+        self.results = []
+
+    def matches(self, points, radius, points_row_splits, hash_table_size_factor,
+                max_hash_table_size):
+        return (_same_tensor(self.points, self.points_version, points) and
+                _same_value(self.radius, radius) and
+                _same_value(self.points_row_splits, points_row_splits) and
+                self.hash_table_size_factor == hash_table_size_factor and
+                self.max_hash_table_size == max_hash_table_size)
+
+
+class NeighborSearchCache:
+    """Cache for reusing spatial hash tables and fixed radius search results.
+
+    Networks often run several fixed radius searches on the same points with
+    the same radius, e.g. a stack of continuous convolutions at the same
+    resolution. Sharing a cache between these layers builds the spatial hash
+    table only once. If the queries are the same, too, the neighbors computed
+    by a previous layer are returned directly.
+
+    Entries are matched by the identity of the points and queries tensors and
+    are invalidated if a tensor is modified in-place. The cache keeps
+    references to the cached tensors until they are evicted or clear() is
+    called.
+
+    Example:
+
+      This example shares the hash table and the neighbors between two layers.::
+
+        import torch
+        import open3d.ml.torch as ml3d
+
+        points = torch.randn([20,3])
+        radius = 0.8
+
+        cache = ml3d.layers.NeighborSearchCache()
+        nsearch1 = ml3d.layers.FixedRadiusSearch(cache=cache)
+        nsearch2 = ml3d.layers.FixedRadiusSearch(cache=cache)
+        ans1 = nsearch1(points, points, radius)
+        ans2 = nsearch2(points, points, radius)  # returns the cached ans1
+
+    Arguments:
+
+      max_entries: The maximum number of hash tables to keep. The least
+        recently used hash table and its search results are evicted first.
+    """
+
+    def __init__(self, max_entries=4):
+        self.max_entries = max_entries
+        self._entries = []
+
+    def clear(self):
+        """Removes all cached hash tables and search results."""
+        self._entries = []
+
+    def _entry(self, points, radius, points_row_splits, hash_table_size_factor,
+               max_hash_table_size):
+        for i, entry in enumerate(self._entries):
+            if entry.matches(points, radius, points_row_splits,
+                             hash_table_size_factor, max_hash_table_size):
+                self._entries.append(self._entries.pop(i))
+                return entry
+
+        if points_row_splits is None:
+            row_splits = torch.LongTensor([0, points.shape[0]])
+        else:
+            row_splits = points_row_splits
+        table = ops.build_spatial_hash_table(
+            max_hash_table_size=max_hash_table_size,
+            points=points,
+            radius=radius,
+            points_row_splits=row_splits,
+            hash_table_size_factor=hash_table_size_factor)
+        entry = _NeighborSearchCacheEntry(points, radius, points_row_splits,
+                                          hash_table_size_factor,
+                                          max_hash_table_size, table)
+        self._entries.append(entry)
+        if len(self._entries) > self.max_entries:
+            self._entries.pop(0)
+        return entry
+
+    def hash_table(self,
+                   points,
+                   radius,
+                   points_row_splits=None,
+                   hash_table_size_factor=1 / 64,
+                   max_hash_table_size=32 * 2**20):
+        """Returns the spatial hash table for the points.
+
+        The hash table is only built if there is no matching entry in the
+        cache. The arguments are the same as for build_spatial_hash_table().
+        """
+        return self._entry(points, radius, points_row_splits,
+                           hash_table_size_factor, max_hash_table_size).table
+
+    def fixed_radius_search(self, layer, points, queries, radius,
+                            points_row_splits, queries_row_splits,
+                            hash_table_size_factor):
+        """Runs the fixed radius search of a FixedRadiusSearch layer.
+
+        Returns the cached result if the same search has been done before.
+        """
+        entry = self._entry(points, radius, points_row_splits,
+                            hash_table_size_factor, layer.max_hash_table_size)
+        options = (layer.metric, layer.ignore_query_point,
+                   layer.return_distances)
+        for (cached_queries, cached_queries_version, cached_queries_row_splits,
+             cached_options, result) in entry.results:
+            if (_same_tensor(cached_queries, cached_queries_version, queries)
+                    and _same_value(cached_queries_row_splits,
+                                    queries_row_splits) and
+                    cached_options == options):
+                return result
+
+        result = layer(points,
+                       queries,
+                       radius,
+                       points_row_splits=points_row_splits,
+                       queries_row_splits=queries_row_splits,
+                       hash_table_size_factor=hash_table_size_factor,
+                       hash_table=entry.table)
+        entry.results.append((queries, queries._version, queries_row_splits,
+                              options, result))
+        return result
 
 
 class FixedRadiusSearch(torch.nn.Module):
@@ -62,6 +218,10 @@ class FixedRadiusSearch(torch.nn.Module):
 
       return_distances: If True the distances for each neighbor will be returned.
         If False a zero length Tensor will be returned instead.
+
+      cache: An optional NeighborSearchCache shared with other layers. If set,
+        the hash table and the search results are reused for the same points
+        and queries.
     """
 
     def __init__(self,
@@ -69,12 +229,14 @@ class FixedRadiusSearch(torch.nn.Module):
                  ignore_query_point=False,
                  return_distances=False,
                  max_hash_table_size=32 * 2**20,
+                 cache=None,
                  **kwargs):
         super().__init__()
         self.metric = metric
         self.ignore_query_point = ignore_query_point
         self.return_distances = return_distances
         self.max_hash_table_size = max_hash_table_size
+        self.cache = cache
 
     def forward(self,
                 points,
@@ -127,6 +289,12 @@ class FixedRadiusSearch(torch.nn.Module):
             Note that the distances are squared if metric is L2.
             This is a zero length Tensor if 'return_distances' is False.
         """
+        if self.cache is not None and hash_table is None:
+            return self.cache.fixed_radius_search(self, points, queries, radius,
+                                                  points_row_splits,
+                                                  queries_row_splits,
+                                                  hash_table_size_factor)
+
         if points_row_splits is None:
             points_row_splits = torch.LongTensor([0, points.shape[0]])
         if queries_row_splits is None:
@@ -114,3 +114,32 @@ def test_tensor_numpy_to_open3d_to_pytorch():
     np.testing.assert_equal(r, a)
     np.testing.assert_equal(r, b.cpu().numpy())
     np.testing.assert_equal(r, c.cpu().numpy())
+
+
+@pytest.mark.parametrize("device", list_devices_with_torch())
+def test_tensor_dlpack_protocol(device):
+    if not torch_available() or not hasattr(torch.Tensor, "__dlpack__"):
+        return
+
+    device_id = device.get_id()
+    device_type = device.get_type()
+
+    # Objects implementing __dlpack__ are accepted without to_dlpack().
+    a = torch.ones((2, 3))
+    if device_type == o3d.core.Device.DeviceType.CUDA:
+        a = a.cuda(device_id)
+    b = o3d.core.Tensor.from_dlpack(a)
+    assert b.__dlpack_device__() == (int(a.__dlpack_device__()[0]), device_id)
+
+    c = torch.utils.dlpack.from_dlpack(b.__dlpack__())
+    a[0, 0] = 100
+    np.testing.assert_equal(b.cpu().numpy(), a.cpu().numpy())
+    np.testing.assert_equal(c.cpu().numpy(), a.cpu().numpy())
+
+    if device_type == o3d.core.Device.DeviceType.CUDA:
+        interface = b.__cuda_array_interface__
+        assert interface["shape"] == (2, 3)
+        assert interface["typestr"] == "<f4"
+        assert interface["data"][0] == a.data_ptr()
+    else:
+        assert not hasattr(b, "__cuda_array_interface__")
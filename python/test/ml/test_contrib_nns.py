@@ -1,7 +1,12 @@
 import open3d.core as o3c
 import numpy as np
 import pytest
-from open3d.ml.contrib import knn_search, radius_search
+from open3d.ml.contrib import knn_search, radius_search, batch_radius_neighbors
+
+import sys
+import os
+sys.path.append(os.path.dirname(os.path.realpath(__file__)) + "/..")
+from open3d_test import list_devices
 
 
 def test_knn_search():
@@ -161,3 +166,32 @@ def test_radius_search():
                                 o3c.Tensor.from_numpy(query_batches),
                                 o3c.Tensor.from_numpy(dataset_batches),
                                 11.0).numpy()
+
+
+@pytest.mark.parametrize("device", list_devices())
+def test_batch_radius_neighbors(device):
+    points = np.array([[0, 0, 0], [1, 0, 0], [0, 1, 0], [0, 0, 1], [1, 1, 1],
+                       [5, 0, 0], [5, 1, 0]],
+                      dtype=np.float32)
+    queries_row_splits = np.array([0, 2, 5, 7], dtype=np.int64)
+    supports_row_splits = np.array([0, 3, 5, 7], dtype=np.int64)
+
+    indices = batch_radius_neighbors(
+        o3c.Tensor(points, device=device), o3c.Tensor(points, device=device),
+        o3c.Tensor(queries_row_splits, device=device),
+        o3c.Tensor(supports_row_splits, device=device), 11.0).cpu().numpy()
+    assert indices.dtype == np.int64
+
+    # Neighbors are padded with the number of supports, order aside.
+    indices_ref = np.array([[0, 1, 2], [0, 1, 2], [3, 4, 7], [3, 4, 7],
+                            [3, 4, 7], [5, 6, 7], [5, 6, 7]],
+                           dtype=np.int64)
+    np.testing.assert_equal(np.sort(indices, axis=1), indices_ref)
+
+    # Test wrong row splits.
+    with pytest.raises(RuntimeError):
+        batch_radius_neighbors(
+            o3c.Tensor(points, device=device),
+            o3c.Tensor(points, device=device),
+            o3c.Tensor(queries_row_splits, device=device),
+            o3c.Tensor(np.array([0, 7], dtype=np.int64), device=device), 11.0)
@@ -1,6 +1,12 @@
 import numpy as np
 import pytest
-from open3d.ml.contrib import subsample, subsample_batch
+import open3d.core as o3c
+from open3d.ml.contrib import subsample, subsample_batch, batch_grid_subsampling
+
+import sys
+import os
+sys.path.append(os.path.dirname(os.path.realpath(__file__)) + "/..")
+from open3d_test import list_devices
 
 
 def compare_results_with_sorting(actual_points,
@@ -230,3 +236,71 @@ def test_subsample_batch():
         sub_points = subsample_batch(points,
                                      np.array([1], dtype=np.int32),
                                      sampleDl=1.1)
+
+
+@pytest.mark.parametrize("device", list_devices())
+def test_batch_grid_subsampling(device):
+    points = np.array([[0, 0, 0], [1, 0, 0], [0, 1, 0], [0, 0, 1], [1, 1, 1],
+                       [5, 0, 0], [5, 1, 0]],
+                      dtype=np.float32)
+    features = np.array(range(28), dtype=np.float32).reshape(-1, 4)
+    labels = np.array([0, 0, 3, 1, 1, 2, 2], dtype=np.int32)
+    row_splits = np.array([0, 3, 5, 7], dtype=np.int64)
+
+    # Reference results.
+    sub_points_ref = np.array(
+        [[0.3333333, 0.3333333, 0], [0.5, 0.5, 1], [5, 0.5, 0]],
+        dtype=np.float32)
+    sub_row_splits_ref = np.array([0, 1, 2, 3], dtype=np.int64)
+    sub_features_ref = np.array(
+        [[4, 5, 6, 7], [14, 15, 16, 17], [22, 23, 24, 25]], dtype=np.float32)
+    sub_labels_ref = np.array([0, 1, 2], dtype=np.int32)
+
+    sub_points, sub_row_splits, sub_features, sub_labels = \
+        batch_grid_subsampling(o3c.Tensor(points, device=device),
+                               o3c.Tensor(row_splits, device=device),
+                               features=o3c.Tensor(features, device=device),
+                               classes=o3c.Tensor(labels, device=device),
+                               sampleDl=1.1)
+    np.testing.assert_allclose(sub_points.cpu().numpy(), sub_points_ref)
+    np.testing.assert_equal(sub_row_splits.cpu().numpy(), sub_row_splits_ref)
+    np.testing.assert_allclose(sub_features.cpu().numpy(), sub_features_ref)
+    np.testing.assert_equal(sub_labels.cpu().numpy(), sub_labels_ref)
+
+    # Compare with subsample_batch on random batches, with max_p.
+    np.random.seed(0)
+    points = np.random.rand(1000, 3).astype(np.float32)
+    batches = np.array([100, 400, 500], dtype=np.int32)
+    row_splits = np.concatenate([[0], np.cumsum(batches)]).astype(np.int64)
+    for max_p in [0, 20]:
+        sub_points_ref, sub_batch_ref = subsample_batch(points,
+                                                        batches,
+                                                        sampleDl=0.25,
+                                                        max_p=max_p)
+        sub_points, sub_row_splits, _, _ = batch_grid_subsampling(
+            o3c.Tensor(points, device=device),
+            o3c.Tensor(row_splits, device=device),
+            sampleDl=0.25,
+            max_p=max_p)
+        sub_points = sub_points.cpu().numpy()
+        sub_row_splits = sub_row_splits.cpu().numpy()
+        np.testing.assert_equal(np.diff(sub_row_splits), sub_batch_ref)
+        if max_p > 0:
+            continue
+        # The voxels of a batch come in any order.
+        for s, e in zip(sub_row_splits[:-1], sub_row_splits[1:]):
+            actual = sub_points[s:e]
+            expect = sub_points_ref[s:e]
+            actual = actual[np.lexsort(actual.T)]
+            expect = expect[np.lexsort(expect.T)]
+            np.testing.assert_allclose(actual, expect, rtol=1e-5, atol=1e-6)
+
+    # Test wrong dtype and row splits.
+    with pytest.raises(RuntimeError):
+        batch_grid_subsampling(
+            o3c.Tensor(points.astype(np.float64), device=device),
+            o3c.Tensor(row_splits, device=device))
+    with pytest.raises(RuntimeError):
+        batch_grid_subsampling(
+            o3c.Tensor(points, device=device),
+            o3c.Tensor(np.array([0, 10], dtype=np.int64), device=device))
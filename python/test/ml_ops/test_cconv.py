@@ -407,3 +407,54 @@ def test_cconv_gradient(ml, dtype, filter_size, out_channels, in_channels,
         debug_outputs=dbg,
         **tolerance)
     assert transpose_feature_gradient_OK
+
+
+@mltest.parametrize.ml_gpu_only
+@pytest.mark.parametrize('with_inp_importance', [False, True])
+def test_cconv_half(ml, with_inp_importance):
+    """Compares half precision features and filters to float32."""
+    np.random.seed(0)
+
+    conv_attrs = {
+        'align_corners': False,
+        'coordinate_mapping': 'ball_to_cube_radial',
+        'normalize': True,
+        'interpolation': 'linear',
+    }
+
+    filters = np.random.uniform(-1, 1, size=(3, 3, 3, 8, 16)).astype(
+        np.float32)
+    inp_positions = np.random.rand(256, 3).astype(np.float32)
+    out_positions = np.random.rand(32, 3).astype(np.float32)
+    if with_inp_importance:
+        inp_importance = np.random.rand(inp_positions.shape[0]).astype(
+            np.float32)
+    else:
+        inp_importance = np.empty((0,), dtype=np.float32)
+    extent = np.array([[0.4]], dtype=np.float32)
+    offset = np.array([0.0, 0.0, 0.0], dtype=np.float32)
+    inp_features = np.random.uniform(
+        -1, 1, size=inp_positions.shape[0:1] + (8,)).astype(np.float32)
+
+    fixed_radius_search = ml.layers.FixedRadiusSearch(metric='Linf')
+    neighbors_index, neighbors_row_splits, _ = mltest.run_op(
+        ml, ml.device, False, fixed_radius_search, inp_positions, out_positions,
+        extent[0, 0] / 2)
+    neighbors_importance = np.empty((0,), dtype=np.float32)
+
+    def conv(feat_dtype):
+        return mltest.run_op(ml, ml.device, True, ml.ops.continuous_conv,
+                             filters.astype(feat_dtype), out_positions, extent,
+                             offset, inp_positions,
+                             inp_features.astype(feat_dtype), inp_importance,
+                             neighbors_index, neighbors_importance,
+                             neighbors_row_splits, **conv_attrs)
+
+    y = conv(np.float32)
+    y_half = conv(np.float16)
+
+    assert y_half.dtype == np.float16
+    np.testing.assert_allclose(y_half.astype(np.float32),
+                               y,
+                               rtol=1e-2,
+                               atol=1e-2)
@@ -242,3 +242,73 @@ def test_fixed_radius_search_batches(dtype, ml, batch_size, radius,
                 else:
                     gt_dist = np.linalg.norm(q - points[j], ord=p_norm)
                 np.testing.assert_allclose(dist, gt_dist, rtol=1e-7, atol=1e-8)
+
+
+@mltest.parametrize.ml
+def test_fixed_radius_search_cache(ml):
+    rng = np.random.RandomState(123)
+
+    dtype = np.float32
+    radius = 0.3
+    points = rng.random(size=(100, 3)).astype(dtype)
+    queries = rng.random(size=(50, 3)).astype(dtype)
+
+    layer = ml.layers.FixedRadiusSearch(return_distances=True)
+    ans_ref = mltest.run_op(ml,
+                            ml.device,
+                            True,
+                            layer,
+                            points,
+                            queries=queries,
+                            radius=radius)
+
+    # the cache matches tensors by identity
+    if ml.module.__name__ == 'torch':
+        points = mltest.to_torch(points, ml.device)
+        queries = mltest.to_torch(queries, ml.device)
+    else:
+        with ml.module.device(ml.device):
+            points = ml.module.identity(points)
+            queries = ml.module.identity(queries)
+
+    cache = ml.layers.NeighborSearchCache()
+    layer1 = ml.layers.FixedRadiusSearch(return_distances=True, cache=cache)
+    layer2 = ml.layers.FixedRadiusSearch(return_distances=True, cache=cache)
+    layer3 = ml.layers.FixedRadiusSearch(return_distances=False, cache=cache)
+
+    ans1 = mltest.run_op(ml,
+                         ml.device,
+                         True,
+                         layer1,
+                         points,
+                         queries=queries,
+                         radius=radius)
+    table = cache.hash_table(points, radius)
+    ans2 = mltest.run_op(ml,
+                         ml.device,
+                         True,
+                         layer2,
+                         points,
+                         queries=queries,
+                         radius=radius)
+    ans3 = mltest.run_op(ml,
+                         ml.device,
+                         True,
+                         layer3,
+                         points,
+                         queries=points,
+                         radius=radius)
+    assert cache.hash_table(points, radius) is table
+    assert len(cache._entries) == 1
+    assert len(cache._entries[0].results) == 2
+
+    for ans in (ans1, ans2):
+        np.testing.assert_equal(ans.neighbors_index, ans_ref.neighbors_index)
+        np.testing.assert_equal(ans.neighbors_row_splits,
+                                ans_ref.neighbors_row_splits)
+        np.testing.assert_equal(ans.neighbors_distance,
+                                ans_ref.neighbors_distance)
+    assert ans3.neighbors_row_splits.shape == (101,)
+
+    cache.clear()
+    assert cache.hash_table(points, radius) is not table
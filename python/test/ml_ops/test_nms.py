@@ -74,3 +74,54 @@ def test_nms_empty(ml):
 
     np.testing.assert_equal(keep_indices, keep_indices_ref)
     assert keep_indices.dtype == keep_indices_ref.dtype
+
+
+@mltest.parametrize.ml
+def test_batched_nms(ml):
+    boxes = np.array([[15.0811, -7.9803, 15.6721, -6.8714, 0.5152],
+                      [15.1166, -7.9261, 15.7060, -6.8137, 0.6501],
+                      [15.1304, -7.8129, 15.7069, -6.8903, 0.7296],
+                      [15.2050, -7.8447, 15.8311, -6.7437, 1.0506],
+                      [15.1343, -7.8136, 15.7121, -6.8479, 1.0352],
+                      [15.0931, -7.9552, 15.6675, -7.0056, 0.5979]],
+                     dtype=np.float32)
+    scores = np.array([3, 1.1, 5, 2, 1, 0], dtype=np.float32)
+    # The second batch item repeats the boxes with two classes.
+    boxes = np.concatenate([boxes, boxes])
+    scores = np.concatenate([scores, scores])
+    labels = np.array([0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 1], dtype=np.int64)
+    row_splits = np.array([0, 6, 12], dtype=np.int64)
+    nms_overlap_thresh = 0.7
+
+    # Run the single class NMS for each batch item and class.
+    keep_indices_ref = []
+    keep_row_splits_ref = [0]
+    for begin, end in zip(row_splits[:-1], row_splits[1:]):
+        for label in np.unique(labels[begin:end]):
+            group = begin + np.where(labels[begin:end] == label)[0]
+            keep = mltest.run_op(ml,
+                                 ml.device,
+                                 True,
+                                 ml.ops.nms,
+                                 boxes[group],
+                                 scores[group],
+                                 nms_overlap_thresh=nms_overlap_thresh)
+            keep_indices_ref.extend(group[keep])
+        keep_row_splits_ref.append(len(keep_indices_ref))
+    keep_indices_ref = np.array(keep_indices_ref, dtype=np.int64)
+    keep_row_splits_ref = np.array(keep_row_splits_ref, dtype=np.int64)
+
+    keep_indices, keep_row_splits = mltest.run_op(
+        ml,
+        ml.device,
+        True,
+        ml.ops.batched_nms,
+        boxes,
+        scores,
+        labels,
+        row_splits,
+        nms_overlap_thresh=nms_overlap_thresh)
+
+    np.testing.assert_equal(keep_indices, keep_indices_ref)
+    np.testing.assert_equal(keep_row_splits, keep_row_splits_ref)
+    assert keep_indices.dtype == np.int64
@@ -0,0 +1,186 @@
+# ----------------------------------------------------------------------------
+# -                        Open3D: www.open3d.org                            -
+# ----------------------------------------------------------------------------
+# The MIT License (MIT)
+#
+# Copyright (c) 2020 www.open3d.org
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+# IN THE SOFTWARE.
+# ----------------------------------------------------------------------------
+
+import open3d as o3d
+import numpy as np
+import pytest
+import mltest
+from check_gradients import check_gradients
+
+# skip all tests if the ml ops were not built
+pytestmark = mltest.default_marks
+
+# the supported dtypes
+position_dtypes = pytest.mark.parametrize('pos_dtype', [np.float32, np.float64])
+feature_dtypes = pytest.mark.parametrize(
+    'feat_dtype', [np.float32, np.float64, np.int32, np.int64])
+
+# aggregation functions
+position_functions = pytest.mark.parametrize(
+    'position_fn', ['average', 'center', 'nearest_neighbor'])
+feature_functions = pytest.mark.parametrize(
+    'feature_fn', ['average', 'max', 'nearest_neighbor'])
+
+
+@mltest.parametrize.ml
+@position_dtypes
+@feature_dtypes
+@position_functions
+@feature_functions
+def test_voxelize_pooling(ml, pos_dtype, feat_dtype, position_fn, feature_fn):
+    # yapf: disable
+
+    points = np.array([
+        # 2 points in voxel [1,1,1]
+        [1.4, 1.5, 1.4],
+        [1.7, 1.2, 1.3],
+        # 3 points in voxel [0,0,0]
+        [0.5, 0.5, 0.5],
+        [0.7, 0.2, 0.3],
+        [0.7, 0.5, 0.9],
+        # point outside of the range
+        [9.3, 9.4, 9.4],
+        ], dtype=pos_dtype)
+
+    features = np.array([
+        [4,1],
+        [5,1],
+        [1,1],
+        [2,3],
+        [3,1],
+        [9,9],
+        ], dtype=feat_dtype)
+
+    # yapf: enable
+
+    voxel_size = np.array([1, 1, 1], dtype=pos_dtype)
+    points_range_min = np.array([0, 0, 0], dtype=pos_dtype)
+    points_range_max = np.array([2, 2, 2], dtype=pos_dtype)
+    ans = mltest.run_op(ml, ml.device, True, ml.ops.voxelize_pooling, points,
+                        features, voxel_size, points_range_min,
+                        points_range_max, position_fn, feature_fn)
+
+    # voxels are sorted by their linear index
+    np.testing.assert_equal(ans.voxel_coords, [[0, 0, 0], [1, 1, 1]])
+    np.testing.assert_equal(ans.voxel_point_row_splits, [0, 3, 5])
+    np.testing.assert_equal(np.sort(ans.voxel_point_indices[:3]), [2, 3, 4])
+    np.testing.assert_equal(np.sort(ans.voxel_point_indices[3:]), [0, 1])
+
+    groups = [[2, 3, 4], [0, 1]]
+    if position_fn == 'average':
+        expected_positions = np.stack(
+            [np.mean(points[g], axis=0) for g in groups])
+    elif position_fn == 'center':
+        expected_positions = np.array([[0.5, 0.5, 0.5], [1.5, 1.5, 1.5]],
+                                      dtype=pos_dtype)
+    elif position_fn == 'nearest_neighbor':
+        expected_positions = np.array([points[2], points[0]], dtype=pos_dtype)
+
+    np.testing.assert_allclose(ans.pooled_positions,
+                               expected_positions,
+                               rtol=1e-6)
+
+    if feature_fn == 'average':
+        if np.issubdtype(feat_dtype, np.integer):
+            expected_features = np.stack(
+                [np.sum(features[g], axis=0) // len(g) for g in groups])
+        else:
+            expected_features = np.stack(
+                [np.mean(features[g], axis=0) for g in groups])
+        assert ans.pooling_indices.shape == (0, 2)
+    elif feature_fn == 'max':
+        expected_features = np.stack(
+            [np.max(features[g], axis=0) for g in groups])
+        np.testing.assert_equal(ans.pooling_indices, [[4, 3], [1, 0]])
+    elif feature_fn == 'nearest_neighbor':
+        expected_features = np.array([features[2], features[0]])
+        np.testing.assert_equal(ans.pooling_indices, [[2, 2], [0, 0]])
+
+    np.testing.assert_allclose(ans.pooled_features, expected_features)
+
+
+@mltest.parametrize.ml
+@position_dtypes
+@feature_dtypes
+@position_functions
+@feature_functions
+def test_voxelize_pooling_empty_point_set(ml, pos_dtype, feat_dtype,
+                                          position_fn, feature_fn):
+    points = np.zeros(shape=[0, 3], dtype=pos_dtype)
+    features = np.zeros(shape=[0, 5], dtype=feat_dtype)
+
+    voxel_size = np.array([1, 1, 1], dtype=pos_dtype)
+    points_range_min = np.array([0, 0, 0], dtype=pos_dtype)
+    points_range_max = np.array([2, 2, 2], dtype=pos_dtype)
+    ans = mltest.run_op(ml, ml.device, True, ml.ops.voxelize_pooling, points,
+                        features, voxel_size, points_range_min,
+                        points_range_max, position_fn, feature_fn)
+
+    np.testing.assert_array_equal(points, ans.pooled_positions)
+    np.testing.assert_array_equal(features, ans.pooled_features)
+    np.testing.assert_array_equal(ans.voxel_point_row_splits, [0])
+
+
+# tf and torch does not support gradient computation for integer types
+gradient_feature_dtypes = pytest.mark.parametrize('feat_dtype',
+                                                  [np.float32, np.float64])
+
+
+@mltest.parametrize.ml
+@position_dtypes
+@gradient_feature_dtypes
+@feature_functions
+def test_voxelize_pooling_grad(ml, pos_dtype, feat_dtype, feature_fn):
+
+    rng = np.random.RandomState(123)
+
+    N = 50
+    channels = 4
+    positions = rng.uniform(0, 1, (N, 3)).astype(pos_dtype)
+
+    # make sure that the feature values are not too close to each other
+    features = np.linspace(0, N * channels, num=N * channels, endpoint=False)
+    rng.shuffle(features)
+    features = np.reshape(features, (N, channels)).astype(feat_dtype)
+    voxel_size = np.array([0.25, 0.25, 0.25], dtype=pos_dtype)
+    points_range_min = np.array([0, 0, 0], dtype=pos_dtype)
+    points_range_max = np.array([1, 1, 1], dtype=pos_dtype)
+
+    def fn(features):
+        ans = mltest.run_op(ml, ml.device, True, ml.ops.voxelize_pooling,
+                            positions, features, voxel_size, points_range_min,
+                            points_range_max, 'average', feature_fn)
+        return ans.pooled_features
+
+    def fn_grad(features_bp, features):
+        return mltest.run_op_grad(ml, ml.device, True,
+                                  ml.ops.voxelize_pooling, features,
+                                  'pooled_features', features_bp, positions,
+                                  features, voxel_size, points_range_min,
+                                  points_range_max, 'average', feature_fn)
+
+    gradient_OK = check_gradients(features, fn, fn_grad, epsilon=1)
+    assert gradient_OK
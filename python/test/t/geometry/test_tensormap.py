@@ -64,3 +64,22 @@ def test_tensormap(device):
     })
     assert "points" in tl
     assert "colors" in tl
+
+
+@pytest.mark.parametrize("device", list_devices())
+def test_tensormap_dlpack(device):
+    dtype = o3c.Dtype.Float32
+    tl = o3d.t.geometry.TensorMap("points", {
+        "points": o3c.Tensor.ones((4, 3), dtype, device),
+        "colors": o3c.Tensor.zeros((4, 3), dtype, device)
+    })
+
+    capsules = tl.to_dlpack()
+    assert set(capsules.keys()) == {"points", "colors"}
+
+    # The round trip shares memory with the original attributes.
+    tl_shared = o3d.t.geometry.TensorMap.from_dlpack("points", capsules)
+    assert tl_shared.get_primary_key() == "points"
+    tl_shared["colors"][0, 0] = 5
+    np.testing.assert_equal(tl["colors"].cpu().numpy(),
+                            tl_shared["colors"].cpu().numpy())